@@ -43,6 +43,11 @@ namespace ResourceAttributeTypeMapper
 AWS_MIGRATIONHUB_API ResourceAttributeType GetResourceAttributeTypeForName(const Aws::String& name);
 
 AWS_MIGRATIONHUB_API Aws::String GetNameForResourceAttributeType(ResourceAttributeType value);
+
+/**
+ * Same as GetNameForResourceAttributeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MIGRATIONHUB_API const char* GetNameForResourceAttributeTypeCStr(ResourceAttributeType value);
 } // namespace ResourceAttributeTypeMapper
 } // namespace Model
 } // namespace MigrationHub
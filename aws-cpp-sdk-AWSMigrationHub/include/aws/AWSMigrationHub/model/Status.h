@@ -37,6 +37,11 @@ namespace StatusMapper
 AWS_MIGRATIONHUB_API Status GetStatusForName(const Aws::String& name);
 
 AWS_MIGRATIONHUB_API Aws::String GetNameForStatus(Status value);
+
+/**
+ * Same as GetNameForStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MIGRATIONHUB_API const char* GetNameForStatusCStr(Status value);
 } // namespace StatusMapper
 } // namespace Model
 } // namespace MigrationHub
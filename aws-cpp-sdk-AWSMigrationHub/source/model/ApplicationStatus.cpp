@@ -30,25 +30,44 @@ namespace Aws
       namespace ApplicationStatusMapper
       {
 
-        static const int NOT_STARTED_HASH = HashingUtils::HashString("NOT_STARTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NOT_STARTED",
+          "IN_PROGRESS",
+          "COMPLETED",
+        };
 
         ApplicationStatus GetApplicationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_STARTED_HASH)
-          {
-            return ApplicationStatus::NOT_STARTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ApplicationStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return ApplicationStatus::COMPLETED;
+          case -1391247659:
+            if (name == "NOT_STARTED")
+            {
+              return ApplicationStatus::NOT_STARTED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return ApplicationStatus::IN_PROGRESS;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return ApplicationStatus::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ApplicationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForApplicationStatus(ApplicationStatus enumValue)
+        const char* GetNameForApplicationStatusCStr(ApplicationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ApplicationStatus::NOT_STARTED:
-            return "NOT_STARTED";
-          case ApplicationStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case ApplicationStatus::COMPLETED:
-            return "COMPLETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForApplicationStatus(ApplicationStatus enumValue)
+        {
+          return GetNameForApplicationStatusCStr(enumValue);
         }
 
       } // namespace ApplicationStatusMapper
@@ -30,60 +30,93 @@ namespace Aws
       namespace ResourceAttributeTypeMapper
       {
 
-        static const int IPV4_ADDRESS_HASH = HashingUtils::HashString("IPV4_ADDRESS");
-        static const int IPV6_ADDRESS_HASH = HashingUtils::HashString("IPV6_ADDRESS");
-        static const int MAC_ADDRESS_HASH = HashingUtils::HashString("MAC_ADDRESS");
-        static const int FQDN_HASH = HashingUtils::HashString("FQDN");
-        static const int VM_MANAGER_ID_HASH = HashingUtils::HashString("VM_MANAGER_ID");
-        static const int VM_MANAGED_OBJECT_REFERENCE_HASH = HashingUtils::HashString("VM_MANAGED_OBJECT_REFERENCE");
-        static const int VM_NAME_HASH = HashingUtils::HashString("VM_NAME");
-        static const int VM_PATH_HASH = HashingUtils::HashString("VM_PATH");
-        static const int BIOS_ID_HASH = HashingUtils::HashString("BIOS_ID");
-        static const int MOTHERBOARD_SERIAL_NUMBER_HASH = HashingUtils::HashString("MOTHERBOARD_SERIAL_NUMBER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IPV4_ADDRESS",
+          "IPV6_ADDRESS",
+          "MAC_ADDRESS",
+          "FQDN",
+          "VM_MANAGER_ID",
+          "VM_MANAGED_OBJECT_REFERENCE",
+          "VM_NAME",
+          "VM_PATH",
+          "BIOS_ID",
+          "MOTHERBOARD_SERIAL_NUMBER",
+        };
 
         ResourceAttributeType GetResourceAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IPV4_ADDRESS_HASH)
-          {
-            return ResourceAttributeType::IPV4_ADDRESS;
-          }
-          else if (hashCode == IPV6_ADDRESS_HASH)
-          {
-            return ResourceAttributeType::IPV6_ADDRESS;
-          }
-          else if (hashCode == MAC_ADDRESS_HASH)
-          {
-            return ResourceAttributeType::MAC_ADDRESS;
-          }
-          else if (hashCode == FQDN_HASH)
-          {
-            return ResourceAttributeType::FQDN;
-          }
-          else if (hashCode == VM_MANAGER_ID_HASH)
-          {
-            return ResourceAttributeType::VM_MANAGER_ID;
-          }
-          else if (hashCode == VM_MANAGED_OBJECT_REFERENCE_HASH)
-          {
-            return ResourceAttributeType::VM_MANAGED_OBJECT_REFERENCE;
-          }
-          else if (hashCode == VM_NAME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceAttributeType::VM_NAME;
-          }
-          else if (hashCode == VM_PATH_HASH)
-          {
-            return ResourceAttributeType::VM_PATH;
-          }
-          else if (hashCode == BIOS_ID_HASH)
-          {
-            return ResourceAttributeType::BIOS_ID;
-          }
-          else if (hashCode == MOTHERBOARD_SERIAL_NUMBER_HASH)
-          {
-            return ResourceAttributeType::MOTHERBOARD_SERIAL_NUMBER;
+          case 1520787354:
+            if (name == "IPV4_ADDRESS")
+            {
+              return ResourceAttributeType::IPV4_ADDRESS;
+            }
+            break;
+          case -2094121572:
+            if (name == "IPV6_ADDRESS")
+            {
+              return ResourceAttributeType::IPV6_ADDRESS;
+            }
+            break;
+          case 273373380:
+            if (name == "MAC_ADDRESS")
+            {
+              return ResourceAttributeType::MAC_ADDRESS;
+            }
+            break;
+          case 2165397:
+            if (name == "FQDN")
+            {
+              return ResourceAttributeType::FQDN;
+            }
+            break;
+          case 1660177813:
+            if (name == "VM_MANAGER_ID")
+            {
+              return ResourceAttributeType::VM_MANAGER_ID;
+            }
+            break;
+          case -779966605:
+            if (name == "VM_MANAGED_OBJECT_REFERENCE")
+            {
+              return ResourceAttributeType::VM_MANAGED_OBJECT_REFERENCE;
+            }
+            break;
+          case 1310472979:
+            if (name == "VM_NAME")
+            {
+              return ResourceAttributeType::VM_NAME;
+            }
+            break;
+          case 1310532781:
+            if (name == "VM_PATH")
+            {
+              return ResourceAttributeType::VM_PATH;
+            }
+            break;
+          case 611153263:
+            if (name == "BIOS_ID")
+            {
+              return ResourceAttributeType::BIOS_ID;
+            }
+            break;
+          case -813903208:
+            if (name == "MOTHERBOARD_SERIAL_NUMBER")
+            {
+              return ResourceAttributeType::MOTHERBOARD_SERIAL_NUMBER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return ResourceAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceAttributeType(ResourceAttributeType enumValue)
+        const char* GetNameForResourceAttributeTypeCStr(ResourceAttributeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceAttributeType::IPV4_ADDRESS:
-            return "IPV4_ADDRESS";
-          case ResourceAttributeType::IPV6_ADDRESS:
-            return "IPV6_ADDRESS";
-          case ResourceAttributeType::MAC_ADDRESS:
-            return "MAC_ADDRESS";
-          case ResourceAttributeType::FQDN:
-            return "FQDN";
-          case ResourceAttributeType::VM_MANAGER_ID:
-            return "VM_MANAGER_ID";
-          case ResourceAttributeType::VM_MANAGED_OBJECT_REFERENCE:
-            return "VM_MANAGED_OBJECT_REFERENCE";
-          case ResourceAttributeType::VM_NAME:
-            return "VM_NAME";
-          case ResourceAttributeType::VM_PATH:
-            return "VM_PATH";
-          case ResourceAttributeType::BIOS_ID:
-            return "BIOS_ID";
-          case ResourceAttributeType::MOTHERBOARD_SERIAL_NUMBER:
-            return "MOTHERBOARD_SERIAL_NUMBER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceAttributeType(ResourceAttributeType enumValue)
+        {
+          return GetNameForResourceAttributeTypeCStr(enumValue);
         }
 
       } // namespace ResourceAttributeTypeMapper
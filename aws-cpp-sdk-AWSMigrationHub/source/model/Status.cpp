@@ -30,30 +30,51 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int NOT_STARTED_HASH = HashingUtils::HashString("NOT_STARTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NOT_STARTED",
+          "IN_PROGRESS",
+          "FAILED",
+          "COMPLETED",
+        };
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_STARTED_HASH)
-          {
-            return Status::NOT_STARTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return Status::IN_PROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return Status::FAILED;
-          }
-          else if (hashCode == COMPLETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Status::COMPLETED;
+          case -1391247659:
+            if (name == "NOT_STARTED")
+            {
+              return Status::NOT_STARTED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return Status::IN_PROGRESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return Status::FAILED;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return Status::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Status::NOT_SET;
         }
 
-        Aws::String GetNameForStatus(Status enumValue)
+        const char* GetNameForStatusCStr(Status enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Status::NOT_STARTED:
-            return "NOT_STARTED";
-          case Status::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case Status::FAILED:
-            return "FAILED";
-          case Status::COMPLETED:
-            return "COMPLETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatus(Status enumValue)
+        {
+          return GetNameForStatusCStr(enumValue);
         }
 
       } // namespace StatusMapper
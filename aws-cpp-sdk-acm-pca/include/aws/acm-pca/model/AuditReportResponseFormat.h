@@ -35,6 +35,11 @@ namespace AuditReportResponseFormatMapper
 AWS_ACMPCA_API AuditReportResponseFormat GetAuditReportResponseFormatForName(const Aws::String& name);
 
 AWS_ACMPCA_API Aws::String GetNameForAuditReportResponseFormat(AuditReportResponseFormat value);
+
+/**
+ * Same as GetNameForAuditReportResponseFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACMPCA_API const char* GetNameForAuditReportResponseFormatCStr(AuditReportResponseFormat value);
 } // namespace AuditReportResponseFormatMapper
 } // namespace Model
 } // namespace ACMPCA
@@ -36,6 +36,11 @@ namespace AuditReportStatusMapper
 AWS_ACMPCA_API AuditReportStatus GetAuditReportStatusForName(const Aws::String& name);
 
 AWS_ACMPCA_API Aws::String GetNameForAuditReportStatus(AuditReportStatus value);
+
+/**
+ * Same as GetNameForAuditReportStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACMPCA_API const char* GetNameForAuditReportStatusCStr(AuditReportStatus value);
 } // namespace AuditReportStatusMapper
 } // namespace Model
 } // namespace ACMPCA
@@ -40,6 +40,11 @@ namespace CertificateAuthorityStatusMapper
 AWS_ACMPCA_API CertificateAuthorityStatus GetCertificateAuthorityStatusForName(const Aws::String& name);
 
 AWS_ACMPCA_API Aws::String GetNameForCertificateAuthorityStatus(CertificateAuthorityStatus value);
+
+/**
+ * Same as GetNameForCertificateAuthorityStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACMPCA_API const char* GetNameForCertificateAuthorityStatusCStr(CertificateAuthorityStatus value);
 } // namespace CertificateAuthorityStatusMapper
 } // namespace Model
 } // namespace ACMPCA
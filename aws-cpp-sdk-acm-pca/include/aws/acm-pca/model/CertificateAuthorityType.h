@@ -34,6 +34,11 @@ namespace CertificateAuthorityTypeMapper
 AWS_ACMPCA_API CertificateAuthorityType GetCertificateAuthorityTypeForName(const Aws::String& name);
 
 AWS_ACMPCA_API Aws::String GetNameForCertificateAuthorityType(CertificateAuthorityType value);
+
+/**
+ * Same as GetNameForCertificateAuthorityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACMPCA_API const char* GetNameForCertificateAuthorityTypeCStr(CertificateAuthorityType value);
 } // namespace CertificateAuthorityTypeMapper
 } // namespace Model
 } // namespace ACMPCA
@@ -36,6 +36,11 @@ namespace FailureReasonMapper
 AWS_ACMPCA_API FailureReason GetFailureReasonForName(const Aws::String& name);
 
 AWS_ACMPCA_API Aws::String GetNameForFailureReason(FailureReason value);
+
+/**
+ * Same as GetNameForFailureReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACMPCA_API const char* GetNameForFailureReasonCStr(FailureReason value);
 } // namespace FailureReasonMapper
 } // namespace Model
 } // namespace ACMPCA
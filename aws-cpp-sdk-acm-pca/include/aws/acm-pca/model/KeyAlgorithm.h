@@ -37,6 +37,11 @@ namespace KeyAlgorithmMapper
 AWS_ACMPCA_API KeyAlgorithm GetKeyAlgorithmForName(const Aws::String& name);
 
 AWS_ACMPCA_API Aws::String GetNameForKeyAlgorithm(KeyAlgorithm value);
+
+/**
+ * Same as GetNameForKeyAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACMPCA_API const char* GetNameForKeyAlgorithmCStr(KeyAlgorithm value);
 } // namespace KeyAlgorithmMapper
 } // namespace Model
 } // namespace ACMPCA
@@ -39,6 +39,11 @@ namespace SigningAlgorithmMapper
 AWS_ACMPCA_API SigningAlgorithm GetSigningAlgorithmForName(const Aws::String& name);
 
 AWS_ACMPCA_API Aws::String GetNameForSigningAlgorithm(SigningAlgorithm value);
+
+/**
+ * Same as GetNameForSigningAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACMPCA_API const char* GetNameForSigningAlgorithmCStr(SigningAlgorithm value);
 } // namespace SigningAlgorithmMapper
 } // namespace Model
 } // namespace ACMPCA
@@ -38,6 +38,11 @@ namespace ValidityPeriodTypeMapper
 AWS_ACMPCA_API ValidityPeriodType GetValidityPeriodTypeForName(const Aws::String& name);
 
 AWS_ACMPCA_API Aws::String GetNameForValidityPeriodType(ValidityPeriodType value);
+
+/**
+ * Same as GetNameForValidityPeriodType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACMPCA_API const char* GetNameForValidityPeriodTypeCStr(ValidityPeriodType value);
 } // namespace ValidityPeriodTypeMapper
 } // namespace Model
 } // namespace ACMPCA
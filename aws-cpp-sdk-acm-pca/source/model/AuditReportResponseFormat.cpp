@@ -30,20 +30,37 @@ namespace Aws
       namespace AuditReportResponseFormatMapper
       {
 
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "JSON",
+          "CSV",
+        };
 
         AuditReportResponseFormat GetAuditReportResponseFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JSON_HASH)
-          {
-            return AuditReportResponseFormat::JSON;
-          }
-          else if (hashCode == CSV_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuditReportResponseFormat::CSV;
+          case 2286824:
+            if (name == "JSON")
+            {
+              return AuditReportResponseFormat::JSON;
+            }
+            break;
+          case 67046:
+            if (name == "CSV")
+            {
+              return AuditReportResponseFormat::CSV;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AuditReportResponseFormat::NOT_SET;
         }
 
-        Aws::String GetNameForAuditReportResponseFormat(AuditReportResponseFormat enumValue)
+        const char* GetNameForAuditReportResponseFormatCStr(AuditReportResponseFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuditReportResponseFormat::JSON:
-            return "JSON";
-          case AuditReportResponseFormat::CSV:
-            return "CSV";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuditReportResponseFormat(AuditReportResponseFormat enumValue)
+        {
+          return GetNameForAuditReportResponseFormatCStr(enumValue);
         }
 
       } // namespace AuditReportResponseFormatMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AuditReportStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "SUCCESS",
+          "FAILED",
+        };
 
         AuditReportStatus GetAuditReportStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return AuditReportStatus::CREATING;
-          }
-          else if (hashCode == SUCCESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuditReportStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AuditReportStatus::FAILED;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return AuditReportStatus::CREATING;
+            }
+            break;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return AuditReportStatus::SUCCESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return AuditReportStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AuditReportStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAuditReportStatus(AuditReportStatus enumValue)
+        const char* GetNameForAuditReportStatusCStr(AuditReportStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuditReportStatus::CREATING:
-            return "CREATING";
-          case AuditReportStatus::SUCCESS:
-            return "SUCCESS";
-          case AuditReportStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuditReportStatus(AuditReportStatus enumValue)
+        {
+          return GetNameForAuditReportStatusCStr(enumValue);
         }
 
       } // namespace AuditReportStatusMapper
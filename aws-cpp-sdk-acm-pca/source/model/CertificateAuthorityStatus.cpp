@@ -30,45 +30,72 @@ namespace Aws
       namespace CertificateAuthorityStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int PENDING_CERTIFICATE_HASH = HashingUtils::HashString("PENDING_CERTIFICATE");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "PENDING_CERTIFICATE",
+          "ACTIVE",
+          "DELETED",
+          "DISABLED",
+          "EXPIRED",
+          "FAILED",
+        };
 
         CertificateAuthorityStatus GetCertificateAuthorityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return CertificateAuthorityStatus::CREATING;
-          }
-          else if (hashCode == PENDING_CERTIFICATE_HASH)
-          {
-            return CertificateAuthorityStatus::PENDING_CERTIFICATE;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CertificateAuthorityStatus::ACTIVE;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return CertificateAuthorityStatus::DELETED;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return CertificateAuthorityStatus::DISABLED;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return CertificateAuthorityStatus::EXPIRED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return CertificateAuthorityStatus::FAILED;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return CertificateAuthorityStatus::CREATING;
+            }
+            break;
+          case 640405167:
+            if (name == "PENDING_CERTIFICATE")
+            {
+              return CertificateAuthorityStatus::PENDING_CERTIFICATE;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return CertificateAuthorityStatus::ACTIVE;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return CertificateAuthorityStatus::DELETED;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return CertificateAuthorityStatus::DISABLED;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return CertificateAuthorityStatus::EXPIRED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return CertificateAuthorityStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return CertificateAuthorityStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCertificateAuthorityStatus(CertificateAuthorityStatus enumValue)
+        const char* GetNameForCertificateAuthorityStatusCStr(CertificateAuthorityStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CertificateAuthorityStatus::CREATING:
-            return "CREATING";
-          case CertificateAuthorityStatus::PENDING_CERTIFICATE:
-            return "PENDING_CERTIFICATE";
-          case CertificateAuthorityStatus::ACTIVE:
-            return "ACTIVE";
-          case CertificateAuthorityStatus::DELETED:
-            return "DELETED";
-          case CertificateAuthorityStatus::DISABLED:
-            return "DISABLED";
-          case CertificateAuthorityStatus::EXPIRED:
-            return "EXPIRED";
-          case CertificateAuthorityStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCertificateAuthorityStatus(CertificateAuthorityStatus enumValue)
+        {
+          return GetNameForCertificateAuthorityStatusCStr(enumValue);
         }
 
       } // namespace CertificateAuthorityStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace CertificateAuthorityTypeMapper
       {
 
-        static const int SUBORDINATE_HASH = HashingUtils::HashString("SUBORDINATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUBORDINATE",
+        };
 
         CertificateAuthorityType GetCertificateAuthorityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBORDINATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CertificateAuthorityType::SUBORDINATE;
+          case 345745196:
+            if (name == "SUBORDINATE")
+            {
+              return CertificateAuthorityType::SUBORDINATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return CertificateAuthorityType::NOT_SET;
         }
 
-        Aws::String GetNameForCertificateAuthorityType(CertificateAuthorityType enumValue)
+        const char* GetNameForCertificateAuthorityTypeCStr(CertificateAuthorityType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CertificateAuthorityType::SUBORDINATE:
-            return "SUBORDINATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCertificateAuthorityType(CertificateAuthorityType enumValue)
+        {
+          return GetNameForCertificateAuthorityTypeCStr(enumValue);
         }
 
       } // namespace CertificateAuthorityTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace FailureReasonMapper
       {
 
-        static const int REQUEST_TIMED_OUT_HASH = HashingUtils::HashString("REQUEST_TIMED_OUT");
-        static const int UNSUPPORTED_ALGORITHM_HASH = HashingUtils::HashString("UNSUPPORTED_ALGORITHM");
-        static const int OTHER_HASH = HashingUtils::HashString("OTHER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REQUEST_TIMED_OUT",
+          "UNSUPPORTED_ALGORITHM",
+          "OTHER",
+        };
 
         FailureReason GetFailureReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REQUEST_TIMED_OUT_HASH)
-          {
-            return FailureReason::REQUEST_TIMED_OUT;
-          }
-          else if (hashCode == UNSUPPORTED_ALGORITHM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FailureReason::UNSUPPORTED_ALGORITHM;
-          }
-          else if (hashCode == OTHER_HASH)
-          {
-            return FailureReason::OTHER;
+          case 43157558:
+            if (name == "REQUEST_TIMED_OUT")
+            {
+              return FailureReason::REQUEST_TIMED_OUT;
+            }
+            break;
+          case -1197826395:
+            if (name == "UNSUPPORTED_ALGORITHM")
+            {
+              return FailureReason::UNSUPPORTED_ALGORITHM;
+            }
+            break;
+          case 75532016:
+            if (name == "OTHER")
+            {
+              return FailureReason::OTHER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FailureReason::NOT_SET;
         }
 
-        Aws::String GetNameForFailureReason(FailureReason enumValue)
+        const char* GetNameForFailureReasonCStr(FailureReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FailureReason::REQUEST_TIMED_OUT:
-            return "REQUEST_TIMED_OUT";
-          case FailureReason::UNSUPPORTED_ALGORITHM:
-            return "UNSUPPORTED_ALGORITHM";
-          case FailureReason::OTHER:
-            return "OTHER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFailureReason(FailureReason enumValue)
+        {
+          return GetNameForFailureReasonCStr(enumValue);
         }
 
       } // namespace FailureReasonMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace KeyAlgorithmMapper
       {
 
-        static const int RSA_2048_HASH = HashingUtils::HashString("RSA_2048");
-        static const int RSA_4096_HASH = HashingUtils::HashString("RSA_4096");
-        static const int EC_prime256v1_HASH = HashingUtils::HashString("EC_prime256v1");
-        static const int EC_secp384r1_HASH = HashingUtils::HashString("EC_secp384r1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RSA_2048",
+          "RSA_4096",
+          "EC_prime256v1",
+          "EC_secp384r1",
+        };
 
         KeyAlgorithm GetKeyAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RSA_2048_HASH)
-          {
-            return KeyAlgorithm::RSA_2048;
-          }
-          else if (hashCode == RSA_4096_HASH)
-          {
-            return KeyAlgorithm::RSA_4096;
-          }
-          else if (hashCode == EC_prime256v1_HASH)
-          {
-            return KeyAlgorithm::EC_prime256v1;
-          }
-          else if (hashCode == EC_secp384r1_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return KeyAlgorithm::EC_secp384r1;
+          case -519912447:
+            if (name == "RSA_2048")
+            {
+              return KeyAlgorithm::RSA_2048;
+            }
+            break;
+          case -519852712:
+            if (name == "RSA_4096")
+            {
+              return KeyAlgorithm::RSA_4096;
+            }
+            break;
+          case 1155394352:
+            if (name == "EC_prime256v1")
+            {
+              return KeyAlgorithm::EC_prime256v1;
+            }
+            break;
+          case 2141358958:
+            if (name == "EC_secp384r1")
+            {
+              return KeyAlgorithm::EC_secp384r1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return KeyAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForKeyAlgorithm(KeyAlgorithm enumValue)
+        const char* GetNameForKeyAlgorithmCStr(KeyAlgorithm enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case KeyAlgorithm::RSA_2048:
-            return "RSA_2048";
-          case KeyAlgorithm::RSA_4096:
-            return "RSA_4096";
-          case KeyAlgorithm::EC_prime256v1:
-            return "EC_prime256v1";
-          case KeyAlgorithm::EC_secp384r1:
-            return "EC_secp384r1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForKeyAlgorithm(KeyAlgorithm enumValue)
+        {
+          return GetNameForKeyAlgorithmCStr(enumValue);
         }
 
       } // namespace KeyAlgorithmMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace RevocationReasonMapper
       {
 
-        static const int UNSPECIFIED_HASH = HashingUtils::HashString("UNSPECIFIED");
-        static const int KEY_COMPROMISE_HASH = HashingUtils::HashString("KEY_COMPROMISE");
-        static const int CERTIFICATE_AUTHORITY_COMPROMISE_HASH = HashingUtils::HashString("CERTIFICATE_AUTHORITY_COMPROMISE");
-        static const int AFFILIATION_CHANGED_HASH = HashingUtils::HashString("AFFILIATION_CHANGED");
-        static const int SUPERSEDED_HASH = HashingUtils::HashString("SUPERSEDED");
-        static const int CESSATION_OF_OPERATION_HASH = HashingUtils::HashString("CESSATION_OF_OPERATION");
-        static const int PRIVILEGE_WITHDRAWN_HASH = HashingUtils::HashString("PRIVILEGE_WITHDRAWN");
-        static const int A_A_COMPROMISE_HASH = HashingUtils::HashString("A_A_COMPROMISE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNSPECIFIED",
+          "KEY_COMPROMISE",
+          "CERTIFICATE_AUTHORITY_COMPROMISE",
+          "AFFILIATION_CHANGED",
+          "SUPERSEDED",
+          "CESSATION_OF_OPERATION",
+          "PRIVILEGE_WITHDRAWN",
+          "A_A_COMPROMISE",
+        };
 
         RevocationReason GetRevocationReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNSPECIFIED_HASH)
-          {
-            return RevocationReason::UNSPECIFIED;
-          }
-          else if (hashCode == KEY_COMPROMISE_HASH)
-          {
-            return RevocationReason::KEY_COMPROMISE;
-          }
-          else if (hashCode == CERTIFICATE_AUTHORITY_COMPROMISE_HASH)
-          {
-            return RevocationReason::CERTIFICATE_AUTHORITY_COMPROMISE;
-          }
-          else if (hashCode == AFFILIATION_CHANGED_HASH)
-          {
-            return RevocationReason::AFFILIATION_CHANGED;
-          }
-          else if (hashCode == SUPERSEDED_HASH)
-          {
-            return RevocationReason::SUPERSEDED;
-          }
-          else if (hashCode == CESSATION_OF_OPERATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RevocationReason::CESSATION_OF_OPERATION;
-          }
-          else if (hashCode == PRIVILEGE_WITHDRAWN_HASH)
-          {
-            return RevocationReason::PRIVILEGE_WITHDRAWN;
-          }
-          else if (hashCode == A_A_COMPROMISE_HASH)
-          {
-            return RevocationReason::A_A_COMPROMISE;
+          case 526786327:
+            if (name == "UNSPECIFIED")
+            {
+              return RevocationReason::UNSPECIFIED;
+            }
+            break;
+          case 1784301178:
+            if (name == "KEY_COMPROMISE")
+            {
+              return RevocationReason::KEY_COMPROMISE;
+            }
+            break;
+          case 363282654:
+            if (name == "CERTIFICATE_AUTHORITY_COMPROMISE")
+            {
+              return RevocationReason::CERTIFICATE_AUTHORITY_COMPROMISE;
+            }
+            break;
+          case 1816386597:
+            if (name == "AFFILIATION_CHANGED")
+            {
+              return RevocationReason::AFFILIATION_CHANGED;
+            }
+            break;
+          case -1215042090:
+            if (name == "SUPERSEDED")
+            {
+              return RevocationReason::SUPERSEDED;
+            }
+            break;
+          case -351852597:
+            if (name == "CESSATION_OF_OPERATION")
+            {
+              return RevocationReason::CESSATION_OF_OPERATION;
+            }
+            break;
+          case -1038997930:
+            if (name == "PRIVILEGE_WITHDRAWN")
+            {
+              return RevocationReason::PRIVILEGE_WITHDRAWN;
+            }
+            break;
+          case 408391286:
+            if (name == "A_A_COMPROMISE")
+            {
+              return RevocationReason::A_A_COMPROMISE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return RevocationReason::NOT_SET;
         }
 
-        Aws::String GetNameForRevocationReason(RevocationReason enumValue)
+        const char* GetNameForRevocationReasonCStr(RevocationReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RevocationReason::UNSPECIFIED:
-            return "UNSPECIFIED";
-          case RevocationReason::KEY_COMPROMISE:
-            return "KEY_COMPROMISE";
-          case RevocationReason::CERTIFICATE_AUTHORITY_COMPROMISE:
-            return "CERTIFICATE_AUTHORITY_COMPROMISE";
-          case RevocationReason::AFFILIATION_CHANGED:
-            return "AFFILIATION_CHANGED";
-          case RevocationReason::SUPERSEDED:
-            return "SUPERSEDED";
-          case RevocationReason::CESSATION_OF_OPERATION:
-            return "CESSATION_OF_OPERATION";
-          case RevocationReason::PRIVILEGE_WITHDRAWN:
-            return "PRIVILEGE_WITHDRAWN";
-          case RevocationReason::A_A_COMPROMISE:
-            return "A_A_COMPROMISE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRevocationReason(RevocationReason enumValue)
+        {
+          return GetNameForRevocationReasonCStr(enumValue);
         }
 
       } // namespace RevocationReasonMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace SigningAlgorithmMapper
       {
 
-        static const int SHA256WITHECDSA_HASH = HashingUtils::HashString("SHA256WITHECDSA");
-        static const int SHA384WITHECDSA_HASH = HashingUtils::HashString("SHA384WITHECDSA");
-        static const int SHA512WITHECDSA_HASH = HashingUtils::HashString("SHA512WITHECDSA");
-        static const int SHA256WITHRSA_HASH = HashingUtils::HashString("SHA256WITHRSA");
-        static const int SHA384WITHRSA_HASH = HashingUtils::HashString("SHA384WITHRSA");
-        static const int SHA512WITHRSA_HASH = HashingUtils::HashString("SHA512WITHRSA");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SHA256WITHECDSA",
+          "SHA384WITHECDSA",
+          "SHA512WITHECDSA",
+          "SHA256WITHRSA",
+          "SHA384WITHRSA",
+          "SHA512WITHRSA",
+        };
 
         SigningAlgorithm GetSigningAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SHA256WITHECDSA_HASH)
-          {
-            return SigningAlgorithm::SHA256WITHECDSA;
-          }
-          else if (hashCode == SHA384WITHECDSA_HASH)
-          {
-            return SigningAlgorithm::SHA384WITHECDSA;
-          }
-          else if (hashCode == SHA512WITHECDSA_HASH)
-          {
-            return SigningAlgorithm::SHA512WITHECDSA;
-          }
-          else if (hashCode == SHA256WITHRSA_HASH)
-          {
-            return SigningAlgorithm::SHA256WITHRSA;
-          }
-          else if (hashCode == SHA384WITHRSA_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SigningAlgorithm::SHA384WITHRSA;
-          }
-          else if (hashCode == SHA512WITHRSA_HASH)
-          {
-            return SigningAlgorithm::SHA512WITHRSA;
+          case -266489657:
+            if (name == "SHA256WITHECDSA")
+            {
+              return SigningAlgorithm::SHA256WITHECDSA;
+            }
+            break;
+          case -840266709:
+            if (name == "SHA384WITHECDSA")
+            {
+              return SigningAlgorithm::SHA384WITHECDSA;
+            }
+            break;
+          case -495316636:
+            if (name == "SHA512WITHECDSA")
+            {
+              return SigningAlgorithm::SHA512WITHECDSA;
+            }
+            break;
+          case 437724019:
+            if (name == "SHA256WITHRSA")
+            {
+              return SigningAlgorithm::SHA256WITHRSA;
+            }
+            break;
+          case -76838953:
+            if (name == "SHA384WITHRSA")
+            {
+              return SigningAlgorithm::SHA384WITHRSA;
+            }
+            break;
+          case 106760016:
+            if (name == "SHA512WITHRSA")
+            {
+              return SigningAlgorithm::SHA512WITHRSA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return SigningAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForSigningAlgorithm(SigningAlgorithm enumValue)
+        const char* GetNameForSigningAlgorithmCStr(SigningAlgorithm enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SigningAlgorithm::SHA256WITHECDSA:
-            return "SHA256WITHECDSA";
-          case SigningAlgorithm::SHA384WITHECDSA:
-            return "SHA384WITHECDSA";
-          case SigningAlgorithm::SHA512WITHECDSA:
-            return "SHA512WITHECDSA";
-          case SigningAlgorithm::SHA256WITHRSA:
-            return "SHA256WITHRSA";
-          case SigningAlgorithm::SHA384WITHRSA:
-            return "SHA384WITHRSA";
-          case SigningAlgorithm::SHA512WITHRSA:
-            return "SHA512WITHRSA";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSigningAlgorithm(SigningAlgorithm enumValue)
+        {
+          return GetNameForSigningAlgorithmCStr(enumValue);
         }
 
       } // namespace SigningAlgorithmMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ValidityPeriodTypeMapper
       {
 
-        static const int END_DATE_HASH = HashingUtils::HashString("END_DATE");
-        static const int ABSOLUTE_HASH = HashingUtils::HashString("ABSOLUTE");
-        static const int DAYS_HASH = HashingUtils::HashString("DAYS");
-        static const int MONTHS_HASH = HashingUtils::HashString("MONTHS");
-        static const int YEARS_HASH = HashingUtils::HashString("YEARS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "END_DATE",
+          "ABSOLUTE",
+          "DAYS",
+          "MONTHS",
+          "YEARS",
+        };
 
         ValidityPeriodType GetValidityPeriodTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == END_DATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ValidityPeriodType::END_DATE;
-          }
-          else if (hashCode == ABSOLUTE_HASH)
-          {
-            return ValidityPeriodType::ABSOLUTE;
-          }
-          else if (hashCode == DAYS_HASH)
-          {
-            return ValidityPeriodType::DAYS;
-          }
-          else if (hashCode == MONTHS_HASH)
-          {
-            return ValidityPeriodType::MONTHS;
-          }
-          else if (hashCode == YEARS_HASH)
-          {
-            return ValidityPeriodType::YEARS;
+          case -1757720398:
+            if (name == "END_DATE")
+            {
+              return ValidityPeriodType::END_DATE;
+            }
+            break;
+          case -1784218249:
+            if (name == "ABSOLUTE")
+            {
+              return ValidityPeriodType::ABSOLUTE;
+            }
+            break;
+          case 2091095:
+            if (name == "DAYS")
+            {
+              return ValidityPeriodType::DAYS;
+            }
+            break;
+          case -2015157773:
+            if (name == "MONTHS")
+            {
+              return ValidityPeriodType::MONTHS;
+            }
+            break;
+          case 84314038:
+            if (name == "YEARS")
+            {
+              return ValidityPeriodType::YEARS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ValidityPeriodType::NOT_SET;
         }
 
-        Aws::String GetNameForValidityPeriodType(ValidityPeriodType enumValue)
+        const char* GetNameForValidityPeriodTypeCStr(ValidityPeriodType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ValidityPeriodType::END_DATE:
-            return "END_DATE";
-          case ValidityPeriodType::ABSOLUTE:
-            return "ABSOLUTE";
-          case ValidityPeriodType::DAYS:
-            return "DAYS";
-          case ValidityPeriodType::MONTHS:
-            return "MONTHS";
-          case ValidityPeriodType::YEARS:
-            return "YEARS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForValidityPeriodType(ValidityPeriodType enumValue)
+        {
+          return GetNameForValidityPeriodTypeCStr(enumValue);
         }
 
       } // namespace ValidityPeriodTypeMapper
@@ -35,6 +35,11 @@ namespace CertificateTransparencyLoggingPreferenceMapper
 AWS_ACM_API CertificateTransparencyLoggingPreference GetCertificateTransparencyLoggingPreferenceForName(const Aws::String& name);
 
 AWS_ACM_API Aws::String GetNameForCertificateTransparencyLoggingPreference(CertificateTransparencyLoggingPreference value);
+
+/**
+ * Same as GetNameForCertificateTransparencyLoggingPreference(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACM_API const char* GetNameForCertificateTransparencyLoggingPreferenceCStr(CertificateTransparencyLoggingPreference value);
 } // namespace CertificateTransparencyLoggingPreferenceMapper
 } // namespace Model
 } // namespace ACM
@@ -36,6 +36,11 @@ namespace CertificateTypeMapper
 AWS_ACM_API CertificateType GetCertificateTypeForName(const Aws::String& name);
 
 AWS_ACM_API Aws::String GetNameForCertificateType(CertificateType value);
+
+/**
+ * Same as GetNameForCertificateType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACM_API const char* GetNameForCertificateTypeCStr(CertificateType value);
 } // namespace CertificateTypeMapper
 } // namespace Model
 } // namespace ACM
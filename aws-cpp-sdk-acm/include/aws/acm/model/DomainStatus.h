@@ -36,6 +36,11 @@ namespace DomainStatusMapper
 AWS_ACM_API DomainStatus GetDomainStatusForName(const Aws::String& name);
 
 AWS_ACM_API Aws::String GetNameForDomainStatus(DomainStatus value);
+
+/**
+ * Same as GetNameForDomainStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACM_API const char* GetNameForDomainStatusCStr(DomainStatus value);
 } // namespace DomainStatusMapper
 } // namespace Model
 } // namespace ACM
@@ -45,6 +45,11 @@ namespace ExtendedKeyUsageNameMapper
 AWS_ACM_API ExtendedKeyUsageName GetExtendedKeyUsageNameForName(const Aws::String& name);
 
 AWS_ACM_API Aws::String GetNameForExtendedKeyUsageName(ExtendedKeyUsageName value);
+
+/**
+ * Same as GetNameForExtendedKeyUsageName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACM_API const char* GetNameForExtendedKeyUsageNameCStr(ExtendedKeyUsageName value);
 } // namespace ExtendedKeyUsageNameMapper
 } // namespace Model
 } // namespace ACM
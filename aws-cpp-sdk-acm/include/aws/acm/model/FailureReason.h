@@ -45,6 +45,11 @@ namespace FailureReasonMapper
 AWS_ACM_API FailureReason GetFailureReasonForName(const Aws::String& name);
 
 AWS_ACM_API Aws::String GetNameForFailureReason(FailureReason value);
+
+/**
+ * Same as GetNameForFailureReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACM_API const char* GetNameForFailureReasonCStr(FailureReason value);
 } // namespace FailureReasonMapper
 } // namespace Model
 } // namespace ACM
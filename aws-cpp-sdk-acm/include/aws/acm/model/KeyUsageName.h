@@ -44,6 +44,11 @@ namespace KeyUsageNameMapper
 AWS_ACM_API KeyUsageName GetKeyUsageNameForName(const Aws::String& name);
 
 AWS_ACM_API Aws::String GetNameForKeyUsageName(KeyUsageName value);
+
+/**
+ * Same as GetNameForKeyUsageName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACM_API const char* GetNameForKeyUsageNameCStr(KeyUsageName value);
 } // namespace KeyUsageNameMapper
 } // namespace Model
 } // namespace ACM
@@ -34,6 +34,11 @@ namespace RecordTypeMapper
 AWS_ACM_API RecordType GetRecordTypeForName(const Aws::String& name);
 
 AWS_ACM_API Aws::String GetNameForRecordType(RecordType value);
+
+/**
+ * Same as GetNameForRecordType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACM_API const char* GetNameForRecordTypeCStr(RecordType value);
 } // namespace RecordTypeMapper
 } // namespace Model
 } // namespace ACM
@@ -35,6 +35,11 @@ namespace RenewalEligibilityMapper
 AWS_ACM_API RenewalEligibility GetRenewalEligibilityForName(const Aws::String& name);
 
 AWS_ACM_API Aws::String GetNameForRenewalEligibility(RenewalEligibility value);
+
+/**
+ * Same as GetNameForRenewalEligibility(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACM_API const char* GetNameForRenewalEligibilityCStr(RenewalEligibility value);
 } // namespace RenewalEligibilityMapper
 } // namespace Model
 } // namespace ACM
@@ -37,6 +37,11 @@ namespace RenewalStatusMapper
 AWS_ACM_API RenewalStatus GetRenewalStatusForName(const Aws::String& name);
 
 AWS_ACM_API Aws::String GetNameForRenewalStatus(RenewalStatus value);
+
+/**
+ * Same as GetNameForRenewalStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACM_API const char* GetNameForRenewalStatusCStr(RenewalStatus value);
 } // namespace RenewalStatusMapper
 } // namespace Model
 } // namespace ACM
@@ -43,6 +43,11 @@ namespace RevocationReasonMapper
 AWS_ACM_API RevocationReason GetRevocationReasonForName(const Aws::String& name);
 
 AWS_ACM_API Aws::String GetNameForRevocationReason(RevocationReason value);
+
+/**
+ * Same as GetNameForRevocationReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACM_API const char* GetNameForRevocationReasonCStr(RevocationReason value);
 } // namespace RevocationReasonMapper
 } // namespace Model
 } // namespace ACM
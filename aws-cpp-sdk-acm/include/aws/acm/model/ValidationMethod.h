@@ -35,6 +35,11 @@ namespace ValidationMethodMapper
 AWS_ACM_API ValidationMethod GetValidationMethodForName(const Aws::String& name);
 
 AWS_ACM_API Aws::String GetNameForValidationMethod(ValidationMethod value);
+
+/**
+ * Same as GetNameForValidationMethod(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ACM_API const char* GetNameForValidationMethodCStr(ValidationMethod value);
 } // namespace ValidationMethodMapper
 } // namespace Model
 } // namespace ACM
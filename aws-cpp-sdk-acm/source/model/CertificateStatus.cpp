@@ -30,45 +30,72 @@ namespace Aws
       namespace CertificateStatusMapper
       {
 
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int ISSUED_HASH = HashingUtils::HashString("ISSUED");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-        static const int VALIDATION_TIMED_OUT_HASH = HashingUtils::HashString("VALIDATION_TIMED_OUT");
-        static const int REVOKED_HASH = HashingUtils::HashString("REVOKED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING_VALIDATION",
+          "ISSUED",
+          "INACTIVE",
+          "EXPIRED",
+          "VALIDATION_TIMED_OUT",
+          "REVOKED",
+          "FAILED",
+        };
 
         CertificateStatus GetCertificateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_VALIDATION_HASH)
-          {
-            return CertificateStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == ISSUED_HASH)
-          {
-            return CertificateStatus::ISSUED;
-          }
-          else if (hashCode == INACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CertificateStatus::INACTIVE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return CertificateStatus::EXPIRED;
-          }
-          else if (hashCode == VALIDATION_TIMED_OUT_HASH)
-          {
-            return CertificateStatus::VALIDATION_TIMED_OUT;
-          }
-          else if (hashCode == REVOKED_HASH)
-          {
-            return CertificateStatus::REVOKED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return CertificateStatus::FAILED;
+          case 1438135361:
+            if (name == "PENDING_VALIDATION")
+            {
+              return CertificateStatus::PENDING_VALIDATION;
+            }
+            break;
+          case -2125830485:
+            if (name == "ISSUED")
+            {
+              return CertificateStatus::ISSUED;
+            }
+            break;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return CertificateStatus::INACTIVE;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return CertificateStatus::EXPIRED;
+            }
+            break;
+          case 1296873920:
+            if (name == "VALIDATION_TIMED_OUT")
+            {
+              return CertificateStatus::VALIDATION_TIMED_OUT;
+            }
+            break;
+          case 1818119806:
+            if (name == "REVOKED")
+            {
+              return CertificateStatus::REVOKED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return CertificateStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return CertificateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCertificateStatus(CertificateStatus enumValue)
+        const char* GetNameForCertificateStatusCStr(CertificateStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CertificateStatus::PENDING_VALIDATION:
-            return "PENDING_VALIDATION";
-          case CertificateStatus::ISSUED:
-            return "ISSUED";
-          case CertificateStatus::INACTIVE:
-            return "INACTIVE";
-          case CertificateStatus::EXPIRED:
-            return "EXPIRED";
-          case CertificateStatus::VALIDATION_TIMED_OUT:
-            return "VALIDATION_TIMED_OUT";
-          case CertificateStatus::REVOKED:
-            return "REVOKED";
-          case CertificateStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCertificateStatus(CertificateStatus enumValue)
+        {
+          return GetNameForCertificateStatusCStr(enumValue);
         }
 
       } // namespace CertificateStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace CertificateTypeMapper
       {
 
-        static const int IMPORTED_HASH = HashingUtils::HashString("IMPORTED");
-        static const int AMAZON_ISSUED_HASH = HashingUtils::HashString("AMAZON_ISSUED");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IMPORTED",
+          "AMAZON_ISSUED",
+          "PRIVATE",
+        };
 
         CertificateType GetCertificateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IMPORTED_HASH)
-          {
-            return CertificateType::IMPORTED;
-          }
-          else if (hashCode == AMAZON_ISSUED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CertificateType::AMAZON_ISSUED;
-          }
-          else if (hashCode == PRIVATE__HASH)
-          {
-            return CertificateType::PRIVATE_;
+          case 360258308:
+            if (name == "IMPORTED")
+            {
+              return CertificateType::IMPORTED;
+            }
+            break;
+          case 436919622:
+            if (name == "AMAZON_ISSUED")
+            {
+              return CertificateType::AMAZON_ISSUED;
+            }
+            break;
+          case 403485027:
+            if (name == "PRIVATE")
+            {
+              return CertificateType::PRIVATE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return CertificateType::NOT_SET;
         }
 
-        Aws::String GetNameForCertificateType(CertificateType enumValue)
+        const char* GetNameForCertificateTypeCStr(CertificateType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CertificateType::IMPORTED:
-            return "IMPORTED";
-          case CertificateType::AMAZON_ISSUED:
-            return "AMAZON_ISSUED";
-          case CertificateType::PRIVATE_:
-            return "PRIVATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCertificateType(CertificateType enumValue)
+        {
+          return GetNameForCertificateTypeCStr(enumValue);
         }
 
       } // namespace CertificateTypeMapper
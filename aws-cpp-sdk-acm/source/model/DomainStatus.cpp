@@ -30,25 +30,44 @@ namespace Aws
       namespace DomainStatusMapper
       {
 
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING_VALIDATION",
+          "SUCCESS",
+          "FAILED",
+        };
 
         DomainStatus GetDomainStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_VALIDATION_HASH)
-          {
-            return DomainStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == SUCCESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DomainStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return DomainStatus::FAILED;
+          case 1438135361:
+            if (name == "PENDING_VALIDATION")
+            {
+              return DomainStatus::PENDING_VALIDATION;
+            }
+            break;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return DomainStatus::SUCCESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return DomainStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DomainStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDomainStatus(DomainStatus enumValue)
+        const char* GetNameForDomainStatusCStr(DomainStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DomainStatus::PENDING_VALIDATION:
-            return "PENDING_VALIDATION";
-          case DomainStatus::SUCCESS:
-            return "SUCCESS";
-          case DomainStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDomainStatus(DomainStatus enumValue)
+        {
+          return GetNameForDomainStatusCStr(enumValue);
         }
 
       } // namespace DomainStatusMapper
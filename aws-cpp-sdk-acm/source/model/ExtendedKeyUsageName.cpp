@@ -30,70 +30,107 @@ namespace Aws
       namespace ExtendedKeyUsageNameMapper
       {
 
-        static const int TLS_WEB_SERVER_AUTHENTICATION_HASH = HashingUtils::HashString("TLS_WEB_SERVER_AUTHENTICATION");
-        static const int TLS_WEB_CLIENT_AUTHENTICATION_HASH = HashingUtils::HashString("TLS_WEB_CLIENT_AUTHENTICATION");
-        static const int CODE_SIGNING_HASH = HashingUtils::HashString("CODE_SIGNING");
-        static const int EMAIL_PROTECTION_HASH = HashingUtils::HashString("EMAIL_PROTECTION");
-        static const int TIME_STAMPING_HASH = HashingUtils::HashString("TIME_STAMPING");
-        static const int OCSP_SIGNING_HASH = HashingUtils::HashString("OCSP_SIGNING");
-        static const int IPSEC_END_SYSTEM_HASH = HashingUtils::HashString("IPSEC_END_SYSTEM");
-        static const int IPSEC_TUNNEL_HASH = HashingUtils::HashString("IPSEC_TUNNEL");
-        static const int IPSEC_USER_HASH = HashingUtils::HashString("IPSEC_USER");
-        static const int ANY_HASH = HashingUtils::HashString("ANY");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int CUSTOM_HASH = HashingUtils::HashString("CUSTOM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TLS_WEB_SERVER_AUTHENTICATION",
+          "TLS_WEB_CLIENT_AUTHENTICATION",
+          "CODE_SIGNING",
+          "EMAIL_PROTECTION",
+          "TIME_STAMPING",
+          "OCSP_SIGNING",
+          "IPSEC_END_SYSTEM",
+          "IPSEC_TUNNEL",
+          "IPSEC_USER",
+          "ANY",
+          "NONE",
+          "CUSTOM",
+        };
 
         ExtendedKeyUsageName GetExtendedKeyUsageNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TLS_WEB_SERVER_AUTHENTICATION_HASH)
-          {
-            return ExtendedKeyUsageName::TLS_WEB_SERVER_AUTHENTICATION;
-          }
-          else if (hashCode == TLS_WEB_CLIENT_AUTHENTICATION_HASH)
-          {
-            return ExtendedKeyUsageName::TLS_WEB_CLIENT_AUTHENTICATION;
-          }
-          else if (hashCode == CODE_SIGNING_HASH)
-          {
-            return ExtendedKeyUsageName::CODE_SIGNING;
-          }
-          else if (hashCode == EMAIL_PROTECTION_HASH)
-          {
-            return ExtendedKeyUsageName::EMAIL_PROTECTION;
-          }
-          else if (hashCode == TIME_STAMPING_HASH)
-          {
-            return ExtendedKeyUsageName::TIME_STAMPING;
-          }
-          else if (hashCode == OCSP_SIGNING_HASH)
-          {
-            return ExtendedKeyUsageName::OCSP_SIGNING;
-          }
-          else if (hashCode == IPSEC_END_SYSTEM_HASH)
-          {
-            return ExtendedKeyUsageName::IPSEC_END_SYSTEM;
-          }
-          else if (hashCode == IPSEC_TUNNEL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExtendedKeyUsageName::IPSEC_TUNNEL;
-          }
-          else if (hashCode == IPSEC_USER_HASH)
-          {
-            return ExtendedKeyUsageName::IPSEC_USER;
-          }
-          else if (hashCode == ANY_HASH)
-          {
-            return ExtendedKeyUsageName::ANY;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return ExtendedKeyUsageName::NONE;
-          }
-          else if (hashCode == CUSTOM_HASH)
-          {
-            return ExtendedKeyUsageName::CUSTOM;
+          case -1831230011:
+            if (name == "TLS_WEB_SERVER_AUTHENTICATION")
+            {
+              return ExtendedKeyUsageName::TLS_WEB_SERVER_AUTHENTICATION;
+            }
+            break;
+          case 1864777789:
+            if (name == "TLS_WEB_CLIENT_AUTHENTICATION")
+            {
+              return ExtendedKeyUsageName::TLS_WEB_CLIENT_AUTHENTICATION;
+            }
+            break;
+          case 64561299:
+            if (name == "CODE_SIGNING")
+            {
+              return ExtendedKeyUsageName::CODE_SIGNING;
+            }
+            break;
+          case 1913996156:
+            if (name == "EMAIL_PROTECTION")
+            {
+              return ExtendedKeyUsageName::EMAIL_PROTECTION;
+            }
+            break;
+          case -1753528719:
+            if (name == "TIME_STAMPING")
+            {
+              return ExtendedKeyUsageName::TIME_STAMPING;
+            }
+            break;
+          case 347268567:
+            if (name == "OCSP_SIGNING")
+            {
+              return ExtendedKeyUsageName::OCSP_SIGNING;
+            }
+            break;
+          case 5493736:
+            if (name == "IPSEC_END_SYSTEM")
+            {
+              return ExtendedKeyUsageName::IPSEC_END_SYSTEM;
+            }
+            break;
+          case 1223285917:
+            if (name == "IPSEC_TUNNEL")
+            {
+              return ExtendedKeyUsageName::IPSEC_TUNNEL;
+            }
+            break;
+          case 1713030464:
+            if (name == "IPSEC_USER")
+            {
+              return ExtendedKeyUsageName::IPSEC_USER;
+            }
+            break;
+          case 64972:
+            if (name == "ANY")
+            {
+              return ExtendedKeyUsageName::ANY;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return ExtendedKeyUsageName::NONE;
+            }
+            break;
+          case 1999208305:
+            if (name == "CUSTOM")
+            {
+              return ExtendedKeyUsageName::CUSTOM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return ExtendedKeyUsageName::NOT_SET;
         }
 
-        Aws::String GetNameForExtendedKeyUsageName(ExtendedKeyUsageName enumValue)
+        const char* GetNameForExtendedKeyUsageNameCStr(ExtendedKeyUsageName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExtendedKeyUsageName::TLS_WEB_SERVER_AUTHENTICATION:
-            return "TLS_WEB_SERVER_AUTHENTICATION";
-          case ExtendedKeyUsageName::TLS_WEB_CLIENT_AUTHENTICATION:
-            return "TLS_WEB_CLIENT_AUTHENTICATION";
-          case ExtendedKeyUsageName::CODE_SIGNING:
-            return "CODE_SIGNING";
-          case ExtendedKeyUsageName::EMAIL_PROTECTION:
-            return "EMAIL_PROTECTION";
-          case ExtendedKeyUsageName::TIME_STAMPING:
-            return "TIME_STAMPING";
-          case ExtendedKeyUsageName::OCSP_SIGNING:
-            return "OCSP_SIGNING";
-          case ExtendedKeyUsageName::IPSEC_END_SYSTEM:
-            return "IPSEC_END_SYSTEM";
-          case ExtendedKeyUsageName::IPSEC_TUNNEL:
-            return "IPSEC_TUNNEL";
-          case ExtendedKeyUsageName::IPSEC_USER:
-            return "IPSEC_USER";
-          case ExtendedKeyUsageName::ANY:
-            return "ANY";
-          case ExtendedKeyUsageName::NONE:
-            return "NONE";
-          case ExtendedKeyUsageName::CUSTOM:
-            return "CUSTOM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExtendedKeyUsageName(ExtendedKeyUsageName enumValue)
+        {
+          return GetNameForExtendedKeyUsageNameCStr(enumValue);
         }
 
       } // namespace ExtendedKeyUsageNameMapper
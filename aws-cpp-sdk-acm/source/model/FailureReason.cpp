@@ -30,70 +30,107 @@ namespace Aws
       namespace FailureReasonMapper
       {
 
-        static const int NO_AVAILABLE_CONTACTS_HASH = HashingUtils::HashString("NO_AVAILABLE_CONTACTS");
-        static const int ADDITIONAL_VERIFICATION_REQUIRED_HASH = HashingUtils::HashString("ADDITIONAL_VERIFICATION_REQUIRED");
-        static const int DOMAIN_NOT_ALLOWED_HASH = HashingUtils::HashString("DOMAIN_NOT_ALLOWED");
-        static const int INVALID_PUBLIC_DOMAIN_HASH = HashingUtils::HashString("INVALID_PUBLIC_DOMAIN");
-        static const int CAA_ERROR_HASH = HashingUtils::HashString("CAA_ERROR");
-        static const int PCA_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("PCA_LIMIT_EXCEEDED");
-        static const int PCA_INVALID_ARN_HASH = HashingUtils::HashString("PCA_INVALID_ARN");
-        static const int PCA_INVALID_STATE_HASH = HashingUtils::HashString("PCA_INVALID_STATE");
-        static const int PCA_REQUEST_FAILED_HASH = HashingUtils::HashString("PCA_REQUEST_FAILED");
-        static const int PCA_RESOURCE_NOT_FOUND_HASH = HashingUtils::HashString("PCA_RESOURCE_NOT_FOUND");
-        static const int PCA_INVALID_ARGS_HASH = HashingUtils::HashString("PCA_INVALID_ARGS");
-        static const int OTHER_HASH = HashingUtils::HashString("OTHER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NO_AVAILABLE_CONTACTS",
+          "ADDITIONAL_VERIFICATION_REQUIRED",
+          "DOMAIN_NOT_ALLOWED",
+          "INVALID_PUBLIC_DOMAIN",
+          "CAA_ERROR",
+          "PCA_LIMIT_EXCEEDED",
+          "PCA_INVALID_ARN",
+          "PCA_INVALID_STATE",
+          "PCA_REQUEST_FAILED",
+          "PCA_RESOURCE_NOT_FOUND",
+          "PCA_INVALID_ARGS",
+          "OTHER",
+        };
 
         FailureReason GetFailureReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_AVAILABLE_CONTACTS_HASH)
-          {
-            return FailureReason::NO_AVAILABLE_CONTACTS;
-          }
-          else if (hashCode == ADDITIONAL_VERIFICATION_REQUIRED_HASH)
-          {
-            return FailureReason::ADDITIONAL_VERIFICATION_REQUIRED;
-          }
-          else if (hashCode == DOMAIN_NOT_ALLOWED_HASH)
-          {
-            return FailureReason::DOMAIN_NOT_ALLOWED;
-          }
-          else if (hashCode == INVALID_PUBLIC_DOMAIN_HASH)
-          {
-            return FailureReason::INVALID_PUBLIC_DOMAIN;
-          }
-          else if (hashCode == CAA_ERROR_HASH)
-          {
-            return FailureReason::CAA_ERROR;
-          }
-          else if (hashCode == PCA_LIMIT_EXCEEDED_HASH)
-          {
-            return FailureReason::PCA_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == PCA_INVALID_ARN_HASH)
-          {
-            return FailureReason::PCA_INVALID_ARN;
-          }
-          else if (hashCode == PCA_INVALID_STATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FailureReason::PCA_INVALID_STATE;
-          }
-          else if (hashCode == PCA_REQUEST_FAILED_HASH)
-          {
-            return FailureReason::PCA_REQUEST_FAILED;
-          }
-          else if (hashCode == PCA_RESOURCE_NOT_FOUND_HASH)
-          {
-            return FailureReason::PCA_RESOURCE_NOT_FOUND;
-          }
-          else if (hashCode == PCA_INVALID_ARGS_HASH)
-          {
-            return FailureReason::PCA_INVALID_ARGS;
-          }
-          else if (hashCode == OTHER_HASH)
-          {
-            return FailureReason::OTHER;
+          case 1112412263:
+            if (name == "NO_AVAILABLE_CONTACTS")
+            {
+              return FailureReason::NO_AVAILABLE_CONTACTS;
+            }
+            break;
+          case 86162219:
+            if (name == "ADDITIONAL_VERIFICATION_REQUIRED")
+            {
+              return FailureReason::ADDITIONAL_VERIFICATION_REQUIRED;
+            }
+            break;
+          case -1683087103:
+            if (name == "DOMAIN_NOT_ALLOWED")
+            {
+              return FailureReason::DOMAIN_NOT_ALLOWED;
+            }
+            break;
+          case -1326738702:
+            if (name == "INVALID_PUBLIC_DOMAIN")
+            {
+              return FailureReason::INVALID_PUBLIC_DOMAIN;
+            }
+            break;
+          case 1117370956:
+            if (name == "CAA_ERROR")
+            {
+              return FailureReason::CAA_ERROR;
+            }
+            break;
+          case -772724952:
+            if (name == "PCA_LIMIT_EXCEEDED")
+            {
+              return FailureReason::PCA_LIMIT_EXCEEDED;
+            }
+            break;
+          case -479926844:
+            if (name == "PCA_INVALID_ARN")
+            {
+              return FailureReason::PCA_INVALID_ARN;
+            }
+            break;
+          case -1631523272:
+            if (name == "PCA_INVALID_STATE")
+            {
+              return FailureReason::PCA_INVALID_STATE;
+            }
+            break;
+          case -965131330:
+            if (name == "PCA_REQUEST_FAILED")
+            {
+              return FailureReason::PCA_REQUEST_FAILED;
+            }
+            break;
+          case 2007358230:
+            if (name == "PCA_RESOURCE_NOT_FOUND")
+            {
+              return FailureReason::PCA_RESOURCE_NOT_FOUND;
+            }
+            break;
+          case -1992830410:
+            if (name == "PCA_INVALID_ARGS")
+            {
+              return FailureReason::PCA_INVALID_ARGS;
+            }
+            break;
+          case 75532016:
+            if (name == "OTHER")
+            {
+              return FailureReason::OTHER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return FailureReason::NOT_SET;
         }
 
-        Aws::String GetNameForFailureReason(FailureReason enumValue)
+        const char* GetNameForFailureReasonCStr(FailureReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FailureReason::NO_AVAILABLE_CONTACTS:
-            return "NO_AVAILABLE_CONTACTS";
-          case FailureReason::ADDITIONAL_VERIFICATION_REQUIRED:
-            return "ADDITIONAL_VERIFICATION_REQUIRED";
-          case FailureReason::DOMAIN_NOT_ALLOWED:
-            return "DOMAIN_NOT_ALLOWED";
-          case FailureReason::INVALID_PUBLIC_DOMAIN:
-            return "INVALID_PUBLIC_DOMAIN";
-          case FailureReason::CAA_ERROR:
-            return "CAA_ERROR";
-          case FailureReason::PCA_LIMIT_EXCEEDED:
-            return "PCA_LIMIT_EXCEEDED";
-          case FailureReason::PCA_INVALID_ARN:
-            return "PCA_INVALID_ARN";
-          case FailureReason::PCA_INVALID_STATE:
-            return "PCA_INVALID_STATE";
-          case FailureReason::PCA_REQUEST_FAILED:
-            return "PCA_REQUEST_FAILED";
-          case FailureReason::PCA_RESOURCE_NOT_FOUND:
-            return "PCA_RESOURCE_NOT_FOUND";
-          case FailureReason::PCA_INVALID_ARGS:
-            return "PCA_INVALID_ARGS";
-          case FailureReason::OTHER:
-            return "OTHER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFailureReason(FailureReason enumValue)
+        {
+          return GetNameForFailureReasonCStr(enumValue);
         }
 
       } // namespace FailureReasonMapper
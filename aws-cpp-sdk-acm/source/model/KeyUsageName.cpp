@@ -30,65 +30,100 @@ namespace Aws
       namespace KeyUsageNameMapper
       {
 
-        static const int DIGITAL_SIGNATURE_HASH = HashingUtils::HashString("DIGITAL_SIGNATURE");
-        static const int NON_REPUDIATION_HASH = HashingUtils::HashString("NON_REPUDIATION");
-        static const int KEY_ENCIPHERMENT_HASH = HashingUtils::HashString("KEY_ENCIPHERMENT");
-        static const int DATA_ENCIPHERMENT_HASH = HashingUtils::HashString("DATA_ENCIPHERMENT");
-        static const int KEY_AGREEMENT_HASH = HashingUtils::HashString("KEY_AGREEMENT");
-        static const int CERTIFICATE_SIGNING_HASH = HashingUtils::HashString("CERTIFICATE_SIGNING");
-        static const int CRL_SIGNING_HASH = HashingUtils::HashString("CRL_SIGNING");
-        static const int ENCIPHER_ONLY_HASH = HashingUtils::HashString("ENCIPHER_ONLY");
-        static const int DECIPHER_ONLY_HASH = HashingUtils::HashString("DECIPHER_ONLY");
-        static const int ANY_HASH = HashingUtils::HashString("ANY");
-        static const int CUSTOM_HASH = HashingUtils::HashString("CUSTOM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DIGITAL_SIGNATURE",
+          "NON_REPUDIATION",
+          "KEY_ENCIPHERMENT",
+          "DATA_ENCIPHERMENT",
+          "KEY_AGREEMENT",
+          "CERTIFICATE_SIGNING",
+          "CRL_SIGNING",
+          "ENCIPHER_ONLY",
+          "DECIPHER_ONLY",
+          "ANY",
+          "CUSTOM",
+        };
 
         KeyUsageName GetKeyUsageNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DIGITAL_SIGNATURE_HASH)
-          {
-            return KeyUsageName::DIGITAL_SIGNATURE;
-          }
-          else if (hashCode == NON_REPUDIATION_HASH)
-          {
-            return KeyUsageName::NON_REPUDIATION;
-          }
-          else if (hashCode == KEY_ENCIPHERMENT_HASH)
-          {
-            return KeyUsageName::KEY_ENCIPHERMENT;
-          }
-          else if (hashCode == DATA_ENCIPHERMENT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return KeyUsageName::DATA_ENCIPHERMENT;
-          }
-          else if (hashCode == KEY_AGREEMENT_HASH)
-          {
-            return KeyUsageName::KEY_AGREEMENT;
-          }
-          else if (hashCode == CERTIFICATE_SIGNING_HASH)
-          {
-            return KeyUsageName::CERTIFICATE_SIGNING;
-          }
-          else if (hashCode == CRL_SIGNING_HASH)
-          {
-            return KeyUsageName::CRL_SIGNING;
-          }
-          else if (hashCode == ENCIPHER_ONLY_HASH)
-          {
-            return KeyUsageName::ENCIPHER_ONLY;
-          }
-          else if (hashCode == DECIPHER_ONLY_HASH)
-          {
-            return KeyUsageName::DECIPHER_ONLY;
-          }
-          else if (hashCode == ANY_HASH)
-          {
-            return KeyUsageName::ANY;
-          }
-          else if (hashCode == CUSTOM_HASH)
-          {
-            return KeyUsageName::CUSTOM;
+          case 203753233:
+            if (name == "DIGITAL_SIGNATURE")
+            {
+              return KeyUsageName::DIGITAL_SIGNATURE;
+            }
+            break;
+          case -2067002266:
+            if (name == "NON_REPUDIATION")
+            {
+              return KeyUsageName::NON_REPUDIATION;
+            }
+            break;
+          case -815064750:
+            if (name == "KEY_ENCIPHERMENT")
+            {
+              return KeyUsageName::KEY_ENCIPHERMENT;
+            }
+            break;
+          case -2081965625:
+            if (name == "DATA_ENCIPHERMENT")
+            {
+              return KeyUsageName::DATA_ENCIPHERMENT;
+            }
+            break;
+          case 1044970474:
+            if (name == "KEY_AGREEMENT")
+            {
+              return KeyUsageName::KEY_AGREEMENT;
+            }
+            break;
+          case 850470429:
+            if (name == "CERTIFICATE_SIGNING")
+            {
+              return KeyUsageName::CERTIFICATE_SIGNING;
+            }
+            break;
+          case 1871032419:
+            if (name == "CRL_SIGNING")
+            {
+              return KeyUsageName::CRL_SIGNING;
+            }
+            break;
+          case -1571837673:
+            if (name == "ENCIPHER_ONLY")
+            {
+              return KeyUsageName::ENCIPHER_ONLY;
+            }
+            break;
+          case 1854788159:
+            if (name == "DECIPHER_ONLY")
+            {
+              return KeyUsageName::DECIPHER_ONLY;
+            }
+            break;
+          case 64972:
+            if (name == "ANY")
+            {
+              return KeyUsageName::ANY;
+            }
+            break;
+          case 1999208305:
+            if (name == "CUSTOM")
+            {
+              return KeyUsageName::CUSTOM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return KeyUsageName::NOT_SET;
         }
 
-        Aws::String GetNameForKeyUsageName(KeyUsageName enumValue)
+        const char* GetNameForKeyUsageNameCStr(KeyUsageName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case KeyUsageName::DIGITAL_SIGNATURE:
-            return "DIGITAL_SIGNATURE";
-          case KeyUsageName::NON_REPUDIATION:
-            return "NON_REPUDIATION";
-          case KeyUsageName::KEY_ENCIPHERMENT:
-            return "KEY_ENCIPHERMENT";
-          case KeyUsageName::DATA_ENCIPHERMENT:
-            return "DATA_ENCIPHERMENT";
-          case KeyUsageName::KEY_AGREEMENT:
-            return "KEY_AGREEMENT";
-          case KeyUsageName::CERTIFICATE_SIGNING:
-            return "CERTIFICATE_SIGNING";
-          case KeyUsageName::CRL_SIGNING:
-            return "CRL_SIGNING";
-          case KeyUsageName::ENCIPHER_ONLY:
-            return "ENCIPHER_ONLY";
-          case KeyUsageName::DECIPHER_ONLY:
-            return "DECIPHER_ONLY";
-          case KeyUsageName::ANY:
-            return "ANY";
-          case KeyUsageName::CUSTOM:
-            return "CUSTOM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForKeyUsageName(KeyUsageName enumValue)
+        {
+          return GetNameForKeyUsageNameCStr(enumValue);
         }
 
       } // namespace KeyUsageNameMapper
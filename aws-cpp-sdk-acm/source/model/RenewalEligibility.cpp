@@ -30,20 +30,37 @@ namespace Aws
       namespace RenewalEligibilityMapper
       {
 
-        static const int ELIGIBLE_HASH = HashingUtils::HashString("ELIGIBLE");
-        static const int INELIGIBLE_HASH = HashingUtils::HashString("INELIGIBLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ELIGIBLE",
+          "INELIGIBLE",
+        };
 
         RenewalEligibility GetRenewalEligibilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ELIGIBLE_HASH)
-          {
-            return RenewalEligibility::ELIGIBLE;
-          }
-          else if (hashCode == INELIGIBLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RenewalEligibility::INELIGIBLE;
+          case 883370455:
+            if (name == "ELIGIBLE")
+            {
+              return RenewalEligibility::ELIGIBLE;
+            }
+            break;
+          case 175259132:
+            if (name == "INELIGIBLE")
+            {
+              return RenewalEligibility::INELIGIBLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RenewalEligibility::NOT_SET;
         }
 
-        Aws::String GetNameForRenewalEligibility(RenewalEligibility enumValue)
+        const char* GetNameForRenewalEligibilityCStr(RenewalEligibility enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RenewalEligibility::ELIGIBLE:
-            return "ELIGIBLE";
-          case RenewalEligibility::INELIGIBLE:
-            return "INELIGIBLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRenewalEligibility(RenewalEligibility enumValue)
+        {
+          return GetNameForRenewalEligibilityCStr(enumValue);
         }
 
       } // namespace RenewalEligibilityMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace RenewalStatusMapper
       {
 
-        static const int PENDING_AUTO_RENEWAL_HASH = HashingUtils::HashString("PENDING_AUTO_RENEWAL");
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING_AUTO_RENEWAL",
+          "PENDING_VALIDATION",
+          "SUCCESS",
+          "FAILED",
+        };
 
         RenewalStatus GetRenewalStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_AUTO_RENEWAL_HASH)
-          {
-            return RenewalStatus::PENDING_AUTO_RENEWAL;
-          }
-          else if (hashCode == PENDING_VALIDATION_HASH)
-          {
-            return RenewalStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return RenewalStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RenewalStatus::FAILED;
+          case 1130413712:
+            if (name == "PENDING_AUTO_RENEWAL")
+            {
+              return RenewalStatus::PENDING_AUTO_RENEWAL;
+            }
+            break;
+          case 1438135361:
+            if (name == "PENDING_VALIDATION")
+            {
+              return RenewalStatus::PENDING_VALIDATION;
+            }
+            break;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return RenewalStatus::SUCCESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return RenewalStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return RenewalStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRenewalStatus(RenewalStatus enumValue)
+        const char* GetNameForRenewalStatusCStr(RenewalStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RenewalStatus::PENDING_AUTO_RENEWAL:
-            return "PENDING_AUTO_RENEWAL";
-          case RenewalStatus::PENDING_VALIDATION:
-            return "PENDING_VALIDATION";
-          case RenewalStatus::SUCCESS:
-            return "SUCCESS";
-          case RenewalStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRenewalStatus(RenewalStatus enumValue)
+        {
+          return GetNameForRenewalStatusCStr(enumValue);
         }
 
       } // namespace RenewalStatusMapper
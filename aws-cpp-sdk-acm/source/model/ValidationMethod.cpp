@@ -30,20 +30,37 @@ namespace Aws
       namespace ValidationMethodMapper
       {
 
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
-        static const int DNS_HASH = HashingUtils::HashString("DNS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EMAIL",
+          "DNS",
+        };
 
         ValidationMethod GetValidationMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EMAIL_HASH)
-          {
-            return ValidationMethod::EMAIL;
-          }
-          else if (hashCode == DNS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ValidationMethod::DNS;
+          case 66081660:
+            if (name == "EMAIL")
+            {
+              return ValidationMethod::EMAIL;
+            }
+            break;
+          case 67849:
+            if (name == "DNS")
+            {
+              return ValidationMethod::DNS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ValidationMethod::NOT_SET;
         }
 
-        Aws::String GetNameForValidationMethod(ValidationMethod enumValue)
+        const char* GetNameForValidationMethodCStr(ValidationMethod enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ValidationMethod::EMAIL:
-            return "EMAIL";
-          case ValidationMethod::DNS:
-            return "DNS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForValidationMethod(ValidationMethod enumValue)
+        {
+          return GetNameForValidationMethodCStr(enumValue);
         }
 
       } // namespace ValidationMethodMapper
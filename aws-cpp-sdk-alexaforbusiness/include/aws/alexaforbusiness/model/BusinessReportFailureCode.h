@@ -36,6 +36,11 @@ namespace BusinessReportFailureCodeMapper
 AWS_ALEXAFORBUSINESS_API BusinessReportFailureCode GetBusinessReportFailureCodeForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForBusinessReportFailureCode(BusinessReportFailureCode value);
+
+/**
+ * Same as GetNameForBusinessReportFailureCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForBusinessReportFailureCodeCStr(BusinessReportFailureCode value);
 } // namespace BusinessReportFailureCodeMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -35,6 +35,11 @@ namespace BusinessReportFormatMapper
 AWS_ALEXAFORBUSINESS_API BusinessReportFormat GetBusinessReportFormatForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForBusinessReportFormat(BusinessReportFormat value);
+
+/**
+ * Same as GetNameForBusinessReportFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForBusinessReportFormatCStr(BusinessReportFormat value);
 } // namespace BusinessReportFormatMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -35,6 +35,11 @@ namespace BusinessReportIntervalMapper
 AWS_ALEXAFORBUSINESS_API BusinessReportInterval GetBusinessReportIntervalForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForBusinessReportInterval(BusinessReportInterval value);
+
+/**
+ * Same as GetNameForBusinessReportInterval(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForBusinessReportIntervalCStr(BusinessReportInterval value);
 } // namespace BusinessReportIntervalMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -36,6 +36,11 @@ namespace BusinessReportStatusMapper
 AWS_ALEXAFORBUSINESS_API BusinessReportStatus GetBusinessReportStatusForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForBusinessReportStatus(BusinessReportStatus value);
+
+/**
+ * Same as GetNameForBusinessReportStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForBusinessReportStatusCStr(BusinessReportStatus value);
 } // namespace BusinessReportStatusMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -36,6 +36,11 @@ namespace CommsProtocolMapper
 AWS_ALEXAFORBUSINESS_API CommsProtocol GetCommsProtocolForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForCommsProtocol(CommsProtocol value);
+
+/**
+ * Same as GetNameForCommsProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForCommsProtocolCStr(CommsProtocol value);
 } // namespace CommsProtocolMapper
 } // namespace Model
 } // namespace AlexaForBusiness
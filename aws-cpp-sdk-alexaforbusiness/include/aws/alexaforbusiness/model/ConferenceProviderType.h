@@ -43,6 +43,11 @@ namespace ConferenceProviderTypeMapper
 AWS_ALEXAFORBUSINESS_API ConferenceProviderType GetConferenceProviderTypeForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForConferenceProviderType(ConferenceProviderType value);
+
+/**
+ * Same as GetNameForConferenceProviderType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForConferenceProviderTypeCStr(ConferenceProviderType value);
 } // namespace ConferenceProviderTypeMapper
 } // namespace Model
 } // namespace AlexaForBusiness
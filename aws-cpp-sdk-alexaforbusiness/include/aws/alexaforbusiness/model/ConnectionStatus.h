@@ -35,6 +35,11 @@ namespace ConnectionStatusMapper
 AWS_ALEXAFORBUSINESS_API ConnectionStatus GetConnectionStatusForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForConnectionStatus(ConnectionStatus value);
+
+/**
+ * Same as GetNameForConnectionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForConnectionStatusCStr(ConnectionStatus value);
 } // namespace ConnectionStatusMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -35,6 +35,11 @@ namespace DeviceEventTypeMapper
 AWS_ALEXAFORBUSINESS_API DeviceEventType GetDeviceEventTypeForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForDeviceEventType(DeviceEventType value);
+
+/**
+ * Same as GetNameForDeviceEventType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForDeviceEventTypeCStr(DeviceEventType value);
 } // namespace DeviceEventTypeMapper
 } // namespace Model
 } // namespace AlexaForBusiness
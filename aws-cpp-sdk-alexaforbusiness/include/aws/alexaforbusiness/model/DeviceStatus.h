@@ -37,6 +37,11 @@ namespace DeviceStatusMapper
 AWS_ALEXAFORBUSINESS_API DeviceStatus GetDeviceStatusForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForDeviceStatus(DeviceStatus value);
+
+/**
+ * Same as GetNameForDeviceStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForDeviceStatusCStr(DeviceStatus value);
 } // namespace DeviceStatusMapper
 } // namespace Model
 } // namespace AlexaForBusiness
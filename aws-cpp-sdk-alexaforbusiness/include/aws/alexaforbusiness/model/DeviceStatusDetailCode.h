@@ -35,6 +35,11 @@ namespace DeviceStatusDetailCodeMapper
 AWS_ALEXAFORBUSINESS_API DeviceStatusDetailCode GetDeviceStatusDetailCodeForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForDeviceStatusDetailCode(DeviceStatusDetailCode value);
+
+/**
+ * Same as GetNameForDeviceStatusDetailCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForDeviceStatusDetailCodeCStr(DeviceStatusDetailCode value);
 } // namespace DeviceStatusDetailCodeMapper
 } // namespace Model
 } // namespace AlexaForBusiness
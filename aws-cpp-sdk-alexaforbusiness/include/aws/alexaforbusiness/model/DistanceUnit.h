@@ -35,6 +35,11 @@ namespace DistanceUnitMapper
 AWS_ALEXAFORBUSINESS_API DistanceUnit GetDistanceUnitForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForDistanceUnit(DistanceUnit value);
+
+/**
+ * Same as GetNameForDistanceUnit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForDistanceUnitCStr(DistanceUnit value);
 } // namespace DistanceUnitMapper
 } // namespace Model
 } // namespace AlexaForBusiness
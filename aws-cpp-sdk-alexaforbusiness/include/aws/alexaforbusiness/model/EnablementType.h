@@ -35,6 +35,11 @@ namespace EnablementTypeMapper
 AWS_ALEXAFORBUSINESS_API EnablementType GetEnablementTypeForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForEnablementType(EnablementType value);
+
+/**
+ * Same as GetNameForEnablementType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForEnablementTypeCStr(EnablementType value);
 } // namespace EnablementTypeMapper
 } // namespace Model
 } // namespace AlexaForBusiness
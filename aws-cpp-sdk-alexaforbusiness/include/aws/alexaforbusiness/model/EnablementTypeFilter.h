@@ -35,6 +35,11 @@ namespace EnablementTypeFilterMapper
 AWS_ALEXAFORBUSINESS_API EnablementTypeFilter GetEnablementTypeFilterForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForEnablementTypeFilter(EnablementTypeFilter value);
+
+/**
+ * Same as GetNameForEnablementTypeFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForEnablementTypeFilterCStr(EnablementTypeFilter value);
 } // namespace EnablementTypeFilterMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -38,6 +38,11 @@ namespace EnrollmentStatusMapper
 AWS_ALEXAFORBUSINESS_API EnrollmentStatus GetEnrollmentStatusForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForEnrollmentStatus(EnrollmentStatus value);
+
+/**
+ * Same as GetNameForEnrollmentStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForEnrollmentStatusCStr(EnrollmentStatus value);
 } // namespace EnrollmentStatusMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -39,6 +39,11 @@ namespace FeatureMapper
 AWS_ALEXAFORBUSINESS_API Feature GetFeatureForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForFeature(Feature value);
+
+/**
+ * Same as GetNameForFeature(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForFeatureCStr(Feature value);
 } // namespace FeatureMapper
 } // namespace Model
 } // namespace AlexaForBusiness
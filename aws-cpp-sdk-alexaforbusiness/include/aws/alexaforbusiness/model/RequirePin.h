@@ -36,6 +36,11 @@ namespace RequirePinMapper
 AWS_ALEXAFORBUSINESS_API RequirePin GetRequirePinForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForRequirePin(RequirePin value);
+
+/**
+ * Same as GetNameForRequirePin(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForRequirePinCStr(RequirePin value);
 } // namespace RequirePinMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -35,6 +35,11 @@ namespace SkillTypeMapper
 AWS_ALEXAFORBUSINESS_API SkillType GetSkillTypeForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForSkillType(SkillType value);
+
+/**
+ * Same as GetNameForSkillType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForSkillTypeCStr(SkillType value);
 } // namespace SkillTypeMapper
 } // namespace Model
 } // namespace AlexaForBusiness
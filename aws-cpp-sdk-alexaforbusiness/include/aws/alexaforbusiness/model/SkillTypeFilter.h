@@ -36,6 +36,11 @@ namespace SkillTypeFilterMapper
 AWS_ALEXAFORBUSINESS_API SkillTypeFilter GetSkillTypeFilterForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForSkillTypeFilter(SkillTypeFilter value);
+
+/**
+ * Same as GetNameForSkillTypeFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForSkillTypeFilterCStr(SkillTypeFilter value);
 } // namespace SkillTypeFilterMapper
 } // namespace Model
 } // namespace AlexaForBusiness
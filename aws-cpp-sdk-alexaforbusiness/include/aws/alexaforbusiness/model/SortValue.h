@@ -35,6 +35,11 @@ namespace SortValueMapper
 AWS_ALEXAFORBUSINESS_API SortValue GetSortValueForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForSortValue(SortValue value);
+
+/**
+ * Same as GetNameForSortValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForSortValueCStr(SortValue value);
 } // namespace SortValueMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -35,6 +35,11 @@ namespace TemperatureUnitMapper
 AWS_ALEXAFORBUSINESS_API TemperatureUnit GetTemperatureUnitForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForTemperatureUnit(TemperatureUnit value);
+
+/**
+ * Same as GetNameForTemperatureUnit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForTemperatureUnitCStr(TemperatureUnit value);
 } // namespace TemperatureUnitMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -37,6 +37,11 @@ namespace WakeWordMapper
 AWS_ALEXAFORBUSINESS_API WakeWord GetWakeWordForName(const Aws::String& name);
 
 AWS_ALEXAFORBUSINESS_API Aws::String GetNameForWakeWord(WakeWord value);
+
+/**
+ * Same as GetNameForWakeWord(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ALEXAFORBUSINESS_API const char* GetNameForWakeWordCStr(WakeWord value);
 } // namespace WakeWordMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -30,25 +30,44 @@ namespace Aws
       namespace BusinessReportFailureCodeMapper
       {
 
-        static const int ACCESS_DENIED_HASH = HashingUtils::HashString("ACCESS_DENIED");
-        static const int NO_SUCH_BUCKET_HASH = HashingUtils::HashString("NO_SUCH_BUCKET");
-        static const int INTERNAL_FAILURE_HASH = HashingUtils::HashString("INTERNAL_FAILURE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCESS_DENIED",
+          "NO_SUCH_BUCKET",
+          "INTERNAL_FAILURE",
+        };
 
         BusinessReportFailureCode GetBusinessReportFailureCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCESS_DENIED_HASH)
-          {
-            return BusinessReportFailureCode::ACCESS_DENIED;
-          }
-          else if (hashCode == NO_SUCH_BUCKET_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BusinessReportFailureCode::NO_SUCH_BUCKET;
-          }
-          else if (hashCode == INTERNAL_FAILURE_HASH)
-          {
-            return BusinessReportFailureCode::INTERNAL_FAILURE;
+          case 1006971606:
+            if (name == "ACCESS_DENIED")
+            {
+              return BusinessReportFailureCode::ACCESS_DENIED;
+            }
+            break;
+          case -980272796:
+            if (name == "NO_SUCH_BUCKET")
+            {
+              return BusinessReportFailureCode::NO_SUCH_BUCKET;
+            }
+            break;
+          case 1873612264:
+            if (name == "INTERNAL_FAILURE")
+            {
+              return BusinessReportFailureCode::INTERNAL_FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return BusinessReportFailureCode::NOT_SET;
         }
 
-        Aws::String GetNameForBusinessReportFailureCode(BusinessReportFailureCode enumValue)
+        const char* GetNameForBusinessReportFailureCodeCStr(BusinessReportFailureCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BusinessReportFailureCode::ACCESS_DENIED:
-            return "ACCESS_DENIED";
-          case BusinessReportFailureCode::NO_SUCH_BUCKET:
-            return "NO_SUCH_BUCKET";
-          case BusinessReportFailureCode::INTERNAL_FAILURE:
-            return "INTERNAL_FAILURE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBusinessReportFailureCode(BusinessReportFailureCode enumValue)
+        {
+          return GetNameForBusinessReportFailureCodeCStr(enumValue);
         }
 
       } // namespace BusinessReportFailureCodeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace BusinessReportFormatMapper
       {
 
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
-        static const int CSV_ZIP_HASH = HashingUtils::HashString("CSV_ZIP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CSV",
+          "CSV_ZIP",
+        };
 
         BusinessReportFormat GetBusinessReportFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CSV_HASH)
-          {
-            return BusinessReportFormat::CSV;
-          }
-          else if (hashCode == CSV_ZIP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BusinessReportFormat::CSV_ZIP;
+          case 67046:
+            if (name == "CSV")
+            {
+              return BusinessReportFormat::CSV;
+            }
+            break;
+          case 1791765800:
+            if (name == "CSV_ZIP")
+            {
+              return BusinessReportFormat::CSV_ZIP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BusinessReportFormat::NOT_SET;
         }
 
-        Aws::String GetNameForBusinessReportFormat(BusinessReportFormat enumValue)
+        const char* GetNameForBusinessReportFormatCStr(BusinessReportFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BusinessReportFormat::CSV:
-            return "CSV";
-          case BusinessReportFormat::CSV_ZIP:
-            return "CSV_ZIP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBusinessReportFormat(BusinessReportFormat enumValue)
+        {
+          return GetNameForBusinessReportFormatCStr(enumValue);
         }
 
       } // namespace BusinessReportFormatMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace BusinessReportIntervalMapper
       {
 
-        static const int ONE_DAY_HASH = HashingUtils::HashString("ONE_DAY");
-        static const int ONE_WEEK_HASH = HashingUtils::HashString("ONE_WEEK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ONE_DAY",
+          "ONE_WEEK",
+        };
 
         BusinessReportInterval GetBusinessReportIntervalForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONE_DAY_HASH)
-          {
-            return BusinessReportInterval::ONE_DAY;
-          }
-          else if (hashCode == ONE_WEEK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BusinessReportInterval::ONE_WEEK;
+          case -601958909:
+            if (name == "ONE_DAY")
+            {
+              return BusinessReportInterval::ONE_DAY;
+            }
+            break;
+          case -1480287667:
+            if (name == "ONE_WEEK")
+            {
+              return BusinessReportInterval::ONE_WEEK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BusinessReportInterval::NOT_SET;
         }
 
-        Aws::String GetNameForBusinessReportInterval(BusinessReportInterval enumValue)
+        const char* GetNameForBusinessReportIntervalCStr(BusinessReportInterval enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BusinessReportInterval::ONE_DAY:
-            return "ONE_DAY";
-          case BusinessReportInterval::ONE_WEEK:
-            return "ONE_WEEK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBusinessReportInterval(BusinessReportInterval enumValue)
+        {
+          return GetNameForBusinessReportIntervalCStr(enumValue);
         }
 
       } // namespace BusinessReportIntervalMapper
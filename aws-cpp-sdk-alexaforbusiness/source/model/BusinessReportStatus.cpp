@@ -30,25 +30,44 @@ namespace Aws
       namespace BusinessReportStatusMapper
       {
 
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RUNNING",
+          "SUCCEEDED",
+          "FAILED",
+        };
 
         BusinessReportStatus GetBusinessReportStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RUNNING_HASH)
-          {
-            return BusinessReportStatus::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BusinessReportStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return BusinessReportStatus::FAILED;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return BusinessReportStatus::RUNNING;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return BusinessReportStatus::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return BusinessReportStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return BusinessReportStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBusinessReportStatus(BusinessReportStatus enumValue)
+        const char* GetNameForBusinessReportStatusCStr(BusinessReportStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BusinessReportStatus::RUNNING:
-            return "RUNNING";
-          case BusinessReportStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case BusinessReportStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBusinessReportStatus(BusinessReportStatus enumValue)
+        {
+          return GetNameForBusinessReportStatusCStr(enumValue);
         }
 
       } // namespace BusinessReportStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace CommsProtocolMapper
       {
 
-        static const int SIP_HASH = HashingUtils::HashString("SIP");
-        static const int SIPS_HASH = HashingUtils::HashString("SIPS");
-        static const int H323_HASH = HashingUtils::HashString("H323");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SIP",
+          "SIPS",
+          "H323",
+        };
 
         CommsProtocol GetCommsProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIP_HASH)
-          {
-            return CommsProtocol::SIP;
-          }
-          else if (hashCode == SIPS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CommsProtocol::SIPS;
-          }
-          else if (hashCode == H323_HASH)
-          {
-            return CommsProtocol::H323;
+          case 82106:
+            if (name == "SIP")
+            {
+              return CommsProtocol::SIP;
+            }
+            break;
+          case 2545369:
+            if (name == "SIPS")
+            {
+              return CommsProtocol::SIPS;
+            }
+            break;
+          case 2195564:
+            if (name == "H323")
+            {
+              return CommsProtocol::H323;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return CommsProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForCommsProtocol(CommsProtocol enumValue)
+        const char* GetNameForCommsProtocolCStr(CommsProtocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CommsProtocol::SIP:
-            return "SIP";
-          case CommsProtocol::SIPS:
-            return "SIPS";
-          case CommsProtocol::H323:
-            return "H323";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCommsProtocol(CommsProtocol enumValue)
+        {
+          return GetNameForCommsProtocolCStr(enumValue);
         }
 
       } // namespace CommsProtocolMapper
@@ -30,60 +30,93 @@ namespace Aws
       namespace ConferenceProviderTypeMapper
       {
 
-        static const int CHIME_HASH = HashingUtils::HashString("CHIME");
-        static const int BLUEJEANS_HASH = HashingUtils::HashString("BLUEJEANS");
-        static const int FUZE_HASH = HashingUtils::HashString("FUZE");
-        static const int GOOGLE_HANGOUTS_HASH = HashingUtils::HashString("GOOGLE_HANGOUTS");
-        static const int POLYCOM_HASH = HashingUtils::HashString("POLYCOM");
-        static const int RINGCENTRAL_HASH = HashingUtils::HashString("RINGCENTRAL");
-        static const int SKYPE_FOR_BUSINESS_HASH = HashingUtils::HashString("SKYPE_FOR_BUSINESS");
-        static const int WEBEX_HASH = HashingUtils::HashString("WEBEX");
-        static const int ZOOM_HASH = HashingUtils::HashString("ZOOM");
-        static const int CUSTOM_HASH = HashingUtils::HashString("CUSTOM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CHIME",
+          "BLUEJEANS",
+          "FUZE",
+          "GOOGLE_HANGOUTS",
+          "POLYCOM",
+          "RINGCENTRAL",
+          "SKYPE_FOR_BUSINESS",
+          "WEBEX",
+          "ZOOM",
+          "CUSTOM",
+        };
 
         ConferenceProviderType GetConferenceProviderTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHIME_HASH)
-          {
-            return ConferenceProviderType::CHIME;
-          }
-          else if (hashCode == BLUEJEANS_HASH)
-          {
-            return ConferenceProviderType::BLUEJEANS;
-          }
-          else if (hashCode == FUZE_HASH)
-          {
-            return ConferenceProviderType::FUZE;
-          }
-          else if (hashCode == GOOGLE_HANGOUTS_HASH)
-          {
-            return ConferenceProviderType::GOOGLE_HANGOUTS;
-          }
-          else if (hashCode == POLYCOM_HASH)
-          {
-            return ConferenceProviderType::POLYCOM;
-          }
-          else if (hashCode == RINGCENTRAL_HASH)
-          {
-            return ConferenceProviderType::RINGCENTRAL;
-          }
-          else if (hashCode == SKYPE_FOR_BUSINESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConferenceProviderType::SKYPE_FOR_BUSINESS;
-          }
-          else if (hashCode == WEBEX_HASH)
-          {
-            return ConferenceProviderType::WEBEX;
-          }
-          else if (hashCode == ZOOM_HASH)
-          {
-            return ConferenceProviderType::ZOOM;
-          }
-          else if (hashCode == CUSTOM_HASH)
-          {
-            return ConferenceProviderType::CUSTOM;
+          case 64093468:
+            if (name == "CHIME")
+            {
+              return ConferenceProviderType::CHIME;
+            }
+            break;
+          case 450963089:
+            if (name == "BLUEJEANS")
+            {
+              return ConferenceProviderType::BLUEJEANS;
+            }
+            break;
+          case 2169914:
+            if (name == "FUZE")
+            {
+              return ConferenceProviderType::FUZE;
+            }
+            break;
+          case -1677282915:
+            if (name == "GOOGLE_HANGOUTS")
+            {
+              return ConferenceProviderType::GOOGLE_HANGOUTS;
+            }
+            break;
+          case 320459285:
+            if (name == "POLYCOM")
+            {
+              return ConferenceProviderType::POLYCOM;
+            }
+            break;
+          case -1460518619:
+            if (name == "RINGCENTRAL")
+            {
+              return ConferenceProviderType::RINGCENTRAL;
+            }
+            break;
+          case 2098917759:
+            if (name == "SKYPE_FOR_BUSINESS")
+            {
+              return ConferenceProviderType::SKYPE_FOR_BUSINESS;
+            }
+            break;
+          case 82467559:
+            if (name == "WEBEX")
+            {
+              return ConferenceProviderType::WEBEX;
+            }
+            break;
+          case 2759635:
+            if (name == "ZOOM")
+            {
+              return ConferenceProviderType::ZOOM;
+            }
+            break;
+          case 1999208305:
+            if (name == "CUSTOM")
+            {
+              return ConferenceProviderType::CUSTOM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return ConferenceProviderType::NOT_SET;
         }
 
-        Aws::String GetNameForConferenceProviderType(ConferenceProviderType enumValue)
+        const char* GetNameForConferenceProviderTypeCStr(ConferenceProviderType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConferenceProviderType::CHIME:
-            return "CHIME";
-          case ConferenceProviderType::BLUEJEANS:
-            return "BLUEJEANS";
-          case ConferenceProviderType::FUZE:
-            return "FUZE";
-          case ConferenceProviderType::GOOGLE_HANGOUTS:
-            return "GOOGLE_HANGOUTS";
-          case ConferenceProviderType::POLYCOM:
-            return "POLYCOM";
-          case ConferenceProviderType::RINGCENTRAL:
-            return "RINGCENTRAL";
-          case ConferenceProviderType::SKYPE_FOR_BUSINESS:
-            return "SKYPE_FOR_BUSINESS";
-          case ConferenceProviderType::WEBEX:
-            return "WEBEX";
-          case ConferenceProviderType::ZOOM:
-            return "ZOOM";
-          case ConferenceProviderType::CUSTOM:
-            return "CUSTOM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConferenceProviderType(ConferenceProviderType enumValue)
+        {
+          return GetNameForConferenceProviderTypeCStr(enumValue);
         }
 
       } // namespace ConferenceProviderTypeMapper
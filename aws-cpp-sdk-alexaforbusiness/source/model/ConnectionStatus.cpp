@@ -30,20 +30,37 @@ namespace Aws
       namespace ConnectionStatusMapper
       {
 
-        static const int ONLINE_HASH = HashingUtils::HashString("ONLINE");
-        static const int OFFLINE_HASH = HashingUtils::HashString("OFFLINE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ONLINE",
+          "OFFLINE",
+        };
 
         ConnectionStatus GetConnectionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONLINE_HASH)
-          {
-            return ConnectionStatus::ONLINE;
-          }
-          else if (hashCode == OFFLINE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectionStatus::OFFLINE;
+          case -1958892973:
+            if (name == "ONLINE")
+            {
+              return ConnectionStatus::ONLINE;
+            }
+            break;
+          case -830629437:
+            if (name == "OFFLINE")
+            {
+              return ConnectionStatus::OFFLINE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ConnectionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionStatus(ConnectionStatus enumValue)
+        const char* GetNameForConnectionStatusCStr(ConnectionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectionStatus::ONLINE:
-            return "ONLINE";
-          case ConnectionStatus::OFFLINE:
-            return "OFFLINE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectionStatus(ConnectionStatus enumValue)
+        {
+          return GetNameForConnectionStatusCStr(enumValue);
         }
 
       } // namespace ConnectionStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DeviceEventTypeMapper
       {
 
-        static const int CONNECTION_STATUS_HASH = HashingUtils::HashString("CONNECTION_STATUS");
-        static const int DEVICE_STATUS_HASH = HashingUtils::HashString("DEVICE_STATUS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONNECTION_STATUS",
+          "DEVICE_STATUS",
+        };
 
         DeviceEventType GetDeviceEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONNECTION_STATUS_HASH)
-          {
-            return DeviceEventType::CONNECTION_STATUS;
-          }
-          else if (hashCode == DEVICE_STATUS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeviceEventType::DEVICE_STATUS;
+          case 1463550067:
+            if (name == "CONNECTION_STATUS")
+            {
+              return DeviceEventType::CONNECTION_STATUS;
+            }
+            break;
+          case 484409851:
+            if (name == "DEVICE_STATUS")
+            {
+              return DeviceEventType::DEVICE_STATUS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeviceEventType::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceEventType(DeviceEventType enumValue)
+        const char* GetNameForDeviceEventTypeCStr(DeviceEventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeviceEventType::CONNECTION_STATUS:
-            return "CONNECTION_STATUS";
-          case DeviceEventType::DEVICE_STATUS:
-            return "DEVICE_STATUS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeviceEventType(DeviceEventType enumValue)
+        {
+          return GetNameForDeviceEventTypeCStr(enumValue);
         }
 
       } // namespace DeviceEventTypeMapper
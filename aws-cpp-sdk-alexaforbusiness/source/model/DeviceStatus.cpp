@@ -30,30 +30,51 @@ namespace Aws
       namespace DeviceStatusMapper
       {
 
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int WAS_OFFLINE_HASH = HashingUtils::HashString("WAS_OFFLINE");
-        static const int DEREGISTERED_HASH = HashingUtils::HashString("DEREGISTERED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "READY",
+          "PENDING",
+          "WAS_OFFLINE",
+          "DEREGISTERED",
+        };
 
         DeviceStatus GetDeviceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == READY_HASH)
-          {
-            return DeviceStatus::READY;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return DeviceStatus::PENDING;
-          }
-          else if (hashCode == WAS_OFFLINE_HASH)
-          {
-            return DeviceStatus::WAS_OFFLINE;
-          }
-          else if (hashCode == DEREGISTERED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeviceStatus::DEREGISTERED;
+          case 77848963:
+            if (name == "READY")
+            {
+              return DeviceStatus::READY;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return DeviceStatus::PENDING;
+            }
+            break;
+          case 228308557:
+            if (name == "WAS_OFFLINE")
+            {
+              return DeviceStatus::WAS_OFFLINE;
+            }
+            break;
+          case -632740413:
+            if (name == "DEREGISTERED")
+            {
+              return DeviceStatus::DEREGISTERED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DeviceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceStatus(DeviceStatus enumValue)
+        const char* GetNameForDeviceStatusCStr(DeviceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeviceStatus::READY:
-            return "READY";
-          case DeviceStatus::PENDING:
-            return "PENDING";
-          case DeviceStatus::WAS_OFFLINE:
-            return "WAS_OFFLINE";
-          case DeviceStatus::DEREGISTERED:
-            return "DEREGISTERED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeviceStatus(DeviceStatus enumValue)
+        {
+          return GetNameForDeviceStatusCStr(enumValue);
         }
 
       } // namespace DeviceStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DeviceStatusDetailCodeMapper
       {
 
-        static const int DEVICE_SOFTWARE_UPDATE_NEEDED_HASH = HashingUtils::HashString("DEVICE_SOFTWARE_UPDATE_NEEDED");
-        static const int DEVICE_WAS_OFFLINE_HASH = HashingUtils::HashString("DEVICE_WAS_OFFLINE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEVICE_SOFTWARE_UPDATE_NEEDED",
+          "DEVICE_WAS_OFFLINE",
+        };
 
         DeviceStatusDetailCode GetDeviceStatusDetailCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEVICE_SOFTWARE_UPDATE_NEEDED_HASH)
-          {
-            return DeviceStatusDetailCode::DEVICE_SOFTWARE_UPDATE_NEEDED;
-          }
-          else if (hashCode == DEVICE_WAS_OFFLINE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeviceStatusDetailCode::DEVICE_WAS_OFFLINE;
+          case -1713797284:
+            if (name == "DEVICE_SOFTWARE_UPDATE_NEEDED")
+            {
+              return DeviceStatusDetailCode::DEVICE_SOFTWARE_UPDATE_NEEDED;
+            }
+            break;
+          case -1442884124:
+            if (name == "DEVICE_WAS_OFFLINE")
+            {
+              return DeviceStatusDetailCode::DEVICE_WAS_OFFLINE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeviceStatusDetailCode::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceStatusDetailCode(DeviceStatusDetailCode enumValue)
+        const char* GetNameForDeviceStatusDetailCodeCStr(DeviceStatusDetailCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeviceStatusDetailCode::DEVICE_SOFTWARE_UPDATE_NEEDED:
-            return "DEVICE_SOFTWARE_UPDATE_NEEDED";
-          case DeviceStatusDetailCode::DEVICE_WAS_OFFLINE:
-            return "DEVICE_WAS_OFFLINE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeviceStatusDetailCode(DeviceStatusDetailCode enumValue)
+        {
+          return GetNameForDeviceStatusDetailCodeCStr(enumValue);
         }
 
       } // namespace DeviceStatusDetailCodeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DistanceUnitMapper
       {
 
-        static const int METRIC_HASH = HashingUtils::HashString("METRIC");
-        static const int IMPERIAL_HASH = HashingUtils::HashString("IMPERIAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "METRIC",
+          "IMPERIAL",
+        };
 
         DistanceUnit GetDistanceUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == METRIC_HASH)
-          {
-            return DistanceUnit::METRIC;
-          }
-          else if (hashCode == IMPERIAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DistanceUnit::IMPERIAL;
+          case -2024216144:
+            if (name == "METRIC")
+            {
+              return DistanceUnit::METRIC;
+            }
+            break;
+          case 351012411:
+            if (name == "IMPERIAL")
+            {
+              return DistanceUnit::IMPERIAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DistanceUnit::NOT_SET;
         }
 
-        Aws::String GetNameForDistanceUnit(DistanceUnit enumValue)
+        const char* GetNameForDistanceUnitCStr(DistanceUnit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DistanceUnit::METRIC:
-            return "METRIC";
-          case DistanceUnit::IMPERIAL:
-            return "IMPERIAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDistanceUnit(DistanceUnit enumValue)
+        {
+          return GetNameForDistanceUnitCStr(enumValue);
         }
 
       } // namespace DistanceUnitMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace EnablementTypeMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLED",
+          "PENDING",
+        };
 
         EnablementType GetEnablementTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
-          {
-            return EnablementType::ENABLED;
-          }
-          else if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnablementType::PENDING;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return EnablementType::ENABLED;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return EnablementType::PENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EnablementType::NOT_SET;
         }
 
-        Aws::String GetNameForEnablementType(EnablementType enumValue)
+        const char* GetNameForEnablementTypeCStr(EnablementType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnablementType::ENABLED:
-            return "ENABLED";
-          case EnablementType::PENDING:
-            return "PENDING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnablementType(EnablementType enumValue)
+        {
+          return GetNameForEnablementTypeCStr(enumValue);
         }
 
       } // namespace EnablementTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace EnablementTypeFilterMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLED",
+          "PENDING",
+        };
 
         EnablementTypeFilter GetEnablementTypeFilterForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
-          {
-            return EnablementTypeFilter::ENABLED;
-          }
-          else if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnablementTypeFilter::PENDING;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return EnablementTypeFilter::ENABLED;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return EnablementTypeFilter::PENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EnablementTypeFilter::NOT_SET;
         }
 
-        Aws::String GetNameForEnablementTypeFilter(EnablementTypeFilter enumValue)
+        const char* GetNameForEnablementTypeFilterCStr(EnablementTypeFilter enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnablementTypeFilter::ENABLED:
-            return "ENABLED";
-          case EnablementTypeFilter::PENDING:
-            return "PENDING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnablementTypeFilter(EnablementTypeFilter enumValue)
+        {
+          return GetNameForEnablementTypeFilterCStr(enumValue);
         }
 
       } // namespace EnablementTypeFilterMapper
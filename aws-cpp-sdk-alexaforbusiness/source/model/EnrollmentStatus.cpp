@@ -30,35 +30,58 @@ namespace Aws
       namespace EnrollmentStatusMapper
       {
 
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int REGISTERED_HASH = HashingUtils::HashString("REGISTERED");
-        static const int DISASSOCIATING_HASH = HashingUtils::HashString("DISASSOCIATING");
-        static const int DEREGISTERING_HASH = HashingUtils::HashString("DEREGISTERING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INITIALIZED",
+          "PENDING",
+          "REGISTERED",
+          "DISASSOCIATING",
+          "DEREGISTERING",
+        };
 
         EnrollmentStatus GetEnrollmentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnrollmentStatus::INITIALIZED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return EnrollmentStatus::PENDING;
-          }
-          else if (hashCode == REGISTERED_HASH)
-          {
-            return EnrollmentStatus::REGISTERED;
-          }
-          else if (hashCode == DISASSOCIATING_HASH)
-          {
-            return EnrollmentStatus::DISASSOCIATING;
-          }
-          else if (hashCode == DEREGISTERING_HASH)
-          {
-            return EnrollmentStatus::DEREGISTERING;
+          case -907986252:
+            if (name == "INITIALIZED")
+            {
+              return EnrollmentStatus::INITIALIZED;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return EnrollmentStatus::PENDING;
+            }
+            break;
+          case -1384838526:
+            if (name == "REGISTERED")
+            {
+              return EnrollmentStatus::REGISTERED;
+            }
+            break;
+          case -67406067:
+            if (name == "DISASSOCIATING")
+            {
+              return EnrollmentStatus::DISASSOCIATING;
+            }
+            break;
+          case 1859887902:
+            if (name == "DEREGISTERING")
+            {
+              return EnrollmentStatus::DEREGISTERING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return EnrollmentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEnrollmentStatus(EnrollmentStatus enumValue)
+        const char* GetNameForEnrollmentStatusCStr(EnrollmentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnrollmentStatus::INITIALIZED:
-            return "INITIALIZED";
-          case EnrollmentStatus::PENDING:
-            return "PENDING";
-          case EnrollmentStatus::REGISTERED:
-            return "REGISTERED";
-          case EnrollmentStatus::DISASSOCIATING:
-            return "DISASSOCIATING";
-          case EnrollmentStatus::DEREGISTERING:
-            return "DEREGISTERING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnrollmentStatus(EnrollmentStatus enumValue)
+        {
+          return GetNameForEnrollmentStatusCStr(enumValue);
         }
 
       } // namespace EnrollmentStatusMapper
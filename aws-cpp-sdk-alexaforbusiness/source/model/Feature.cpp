@@ -30,40 +30,65 @@ namespace Aws
       namespace FeatureMapper
       {
 
-        static const int BLUETOOTH_HASH = HashingUtils::HashString("BLUETOOTH");
-        static const int VOLUME_HASH = HashingUtils::HashString("VOLUME");
-        static const int NOTIFICATIONS_HASH = HashingUtils::HashString("NOTIFICATIONS");
-        static const int LISTS_HASH = HashingUtils::HashString("LISTS");
-        static const int SKILLS_HASH = HashingUtils::HashString("SKILLS");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLUETOOTH",
+          "VOLUME",
+          "NOTIFICATIONS",
+          "LISTS",
+          "SKILLS",
+          "ALL",
+        };
 
         Feature GetFeatureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLUETOOTH_HASH)
-          {
-            return Feature::BLUETOOTH;
-          }
-          else if (hashCode == VOLUME_HASH)
-          {
-            return Feature::VOLUME;
-          }
-          else if (hashCode == NOTIFICATIONS_HASH)
-          {
-            return Feature::NOTIFICATIONS;
-          }
-          else if (hashCode == LISTS_HASH)
-          {
-            return Feature::LISTS;
-          }
-          else if (hashCode == SKILLS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Feature::SKILLS;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return Feature::ALL;
+          case 460509838:
+            if (name == "BLUETOOTH")
+            {
+              return Feature::BLUETOOTH;
+            }
+            break;
+          case -1757553894:
+            if (name == "VOLUME")
+            {
+              return Feature::VOLUME;
+            }
+            break;
+          case 93629640:
+            if (name == "NOTIFICATIONS")
+            {
+              return Feature::NOTIFICATIONS;
+            }
+            break;
+          case 72444789:
+            if (name == "LISTS")
+            {
+              return Feature::LISTS;
+            }
+            break;
+          case -1847233470:
+            if (name == "SKILLS")
+            {
+              return Feature::SKILLS;
+            }
+            break;
+          case 64897:
+            if (name == "ALL")
+            {
+              return Feature::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return Feature::NOT_SET;
         }
 
-        Aws::String GetNameForFeature(Feature enumValue)
+        const char* GetNameForFeatureCStr(Feature enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Feature::BLUETOOTH:
-            return "BLUETOOTH";
-          case Feature::VOLUME:
-            return "VOLUME";
-          case Feature::NOTIFICATIONS:
-            return "NOTIFICATIONS";
-          case Feature::LISTS:
-            return "LISTS";
-          case Feature::SKILLS:
-            return "SKILLS";
-          case Feature::ALL:
-            return "ALL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFeature(Feature enumValue)
+        {
+          return GetNameForFeatureCStr(enumValue);
         }
 
       } // namespace FeatureMapper
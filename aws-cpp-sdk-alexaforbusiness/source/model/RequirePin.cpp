@@ -30,25 +30,44 @@ namespace Aws
       namespace RequirePinMapper
       {
 
-        static const int YES_HASH = HashingUtils::HashString("YES");
-        static const int NO_HASH = HashingUtils::HashString("NO");
-        static const int OPTIONAL_HASH = HashingUtils::HashString("OPTIONAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "YES",
+          "NO",
+          "OPTIONAL",
+        };
 
         RequirePin GetRequirePinForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == YES_HASH)
-          {
-            return RequirePin::YES;
-          }
-          else if (hashCode == NO_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RequirePin::NO;
-          }
-          else if (hashCode == OPTIONAL_HASH)
-          {
-            return RequirePin::OPTIONAL;
+          case 87751:
+            if (name == "YES")
+            {
+              return RequirePin::YES;
+            }
+            break;
+          case 2497:
+            if (name == "NO")
+            {
+              return RequirePin::NO;
+            }
+            break;
+          case 703609696:
+            if (name == "OPTIONAL")
+            {
+              return RequirePin::OPTIONAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RequirePin::NOT_SET;
         }
 
-        Aws::String GetNameForRequirePin(RequirePin enumValue)
+        const char* GetNameForRequirePinCStr(RequirePin enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RequirePin::YES:
-            return "YES";
-          case RequirePin::NO:
-            return "NO";
-          case RequirePin::OPTIONAL:
-            return "OPTIONAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRequirePin(RequirePin enumValue)
+        {
+          return GetNameForRequirePinCStr(enumValue);
         }
 
       } // namespace RequirePinMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace SkillTypeFilterMapper
       {
 
-        static const int PUBLIC__HASH = HashingUtils::HashString("PUBLIC");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PUBLIC",
+          "PRIVATE",
+          "ALL",
+        };
 
         SkillTypeFilter GetSkillTypeFilterForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PUBLIC__HASH)
-          {
-            return SkillTypeFilter::PUBLIC_;
-          }
-          else if (hashCode == PRIVATE__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SkillTypeFilter::PRIVATE_;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return SkillTypeFilter::ALL;
+          case -1924094359:
+            if (name == "PUBLIC")
+            {
+              return SkillTypeFilter::PUBLIC_;
+            }
+            break;
+          case 403485027:
+            if (name == "PRIVATE")
+            {
+              return SkillTypeFilter::PRIVATE_;
+            }
+            break;
+          case 64897:
+            if (name == "ALL")
+            {
+              return SkillTypeFilter::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SkillTypeFilter::NOT_SET;
         }
 
-        Aws::String GetNameForSkillTypeFilter(SkillTypeFilter enumValue)
+        const char* GetNameForSkillTypeFilterCStr(SkillTypeFilter enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SkillTypeFilter::PUBLIC_:
-            return "PUBLIC";
-          case SkillTypeFilter::PRIVATE_:
-            return "PRIVATE";
-          case SkillTypeFilter::ALL:
-            return "ALL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSkillTypeFilter(SkillTypeFilter enumValue)
+        {
+          return GetNameForSkillTypeFilterCStr(enumValue);
         }
 
       } // namespace SkillTypeFilterMapper
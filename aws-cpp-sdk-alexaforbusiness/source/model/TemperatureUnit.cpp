@@ -30,20 +30,37 @@ namespace Aws
       namespace TemperatureUnitMapper
       {
 
-        static const int FAHRENHEIT_HASH = HashingUtils::HashString("FAHRENHEIT");
-        static const int CELSIUS_HASH = HashingUtils::HashString("CELSIUS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FAHRENHEIT",
+          "CELSIUS",
+        };
 
         TemperatureUnit GetTemperatureUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAHRENHEIT_HASH)
-          {
-            return TemperatureUnit::FAHRENHEIT;
-          }
-          else if (hashCode == CELSIUS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TemperatureUnit::CELSIUS;
+          case 347343446:
+            if (name == "FAHRENHEIT")
+            {
+              return TemperatureUnit::FAHRENHEIT;
+            }
+            break;
+          case 1381349022:
+            if (name == "CELSIUS")
+            {
+              return TemperatureUnit::CELSIUS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TemperatureUnit::NOT_SET;
         }
 
-        Aws::String GetNameForTemperatureUnit(TemperatureUnit enumValue)
+        const char* GetNameForTemperatureUnitCStr(TemperatureUnit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TemperatureUnit::FAHRENHEIT:
-            return "FAHRENHEIT";
-          case TemperatureUnit::CELSIUS:
-            return "CELSIUS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTemperatureUnit(TemperatureUnit enumValue)
+        {
+          return GetNameForTemperatureUnitCStr(enumValue);
         }
 
       } // namespace TemperatureUnitMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace WakeWordMapper
       {
 
-        static const int ALEXA_HASH = HashingUtils::HashString("ALEXA");
-        static const int AMAZON_HASH = HashingUtils::HashString("AMAZON");
-        static const int ECHO_HASH = HashingUtils::HashString("ECHO");
-        static const int COMPUTER_HASH = HashingUtils::HashString("COMPUTER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALEXA",
+          "AMAZON",
+          "ECHO",
+          "COMPUTER",
+        };
 
         WakeWord GetWakeWordForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALEXA_HASH)
-          {
-            return WakeWord::ALEXA;
-          }
-          else if (hashCode == AMAZON_HASH)
-          {
-            return WakeWord::AMAZON;
-          }
-          else if (hashCode == ECHO_HASH)
-          {
-            return WakeWord::ECHO;
-          }
-          else if (hashCode == COMPUTER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WakeWord::COMPUTER;
+          case 62362083:
+            if (name == "ALEXA")
+            {
+              return WakeWord::ALEXA;
+            }
+            break;
+          case 1934031364:
+            if (name == "AMAZON")
+            {
+              return WakeWord::AMAZON;
+            }
+            break;
+          case 2122277:
+            if (name == "ECHO")
+            {
+              return WakeWord::ECHO;
+            }
+            break;
+          case 183463707:
+            if (name == "COMPUTER")
+            {
+              return WakeWord::COMPUTER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return WakeWord::NOT_SET;
         }
 
-        Aws::String GetNameForWakeWord(WakeWord enumValue)
+        const char* GetNameForWakeWordCStr(WakeWord enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WakeWord::ALEXA:
-            return "ALEXA";
-          case WakeWord::AMAZON:
-            return "AMAZON";
-          case WakeWord::ECHO:
-            return "ECHO";
-          case WakeWord::COMPUTER:
-            return "COMPUTER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWakeWord(WakeWord enumValue)
+        {
+          return GetNameForWakeWordCStr(enumValue);
         }
 
       } // namespace WakeWordMapper
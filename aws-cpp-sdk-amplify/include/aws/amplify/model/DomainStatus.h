@@ -38,6 +38,11 @@ namespace DomainStatusMapper
 AWS_AMPLIFY_API DomainStatus GetDomainStatusForName(const Aws::String& name);
 
 AWS_AMPLIFY_API Aws::String GetNameForDomainStatus(DomainStatus value);
+
+/**
+ * Same as GetNameForDomainStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AMPLIFY_API const char* GetNameForDomainStatusCStr(DomainStatus value);
 } // namespace DomainStatusMapper
 } // namespace Model
 } // namespace Amplify
@@ -40,6 +40,11 @@ namespace JobStatusMapper
 AWS_AMPLIFY_API JobStatus GetJobStatusForName(const Aws::String& name);
 
 AWS_AMPLIFY_API Aws::String GetNameForJobStatus(JobStatus value);
+
+/**
+ * Same as GetNameForJobStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AMPLIFY_API const char* GetNameForJobStatusCStr(JobStatus value);
 } // namespace JobStatusMapper
 } // namespace Model
 } // namespace Amplify
@@ -37,6 +37,11 @@ namespace StageMapper
 AWS_AMPLIFY_API Stage GetStageForName(const Aws::String& name);
 
 AWS_AMPLIFY_API Aws::String GetNameForStage(Stage value);
+
+/**
+ * Same as GetNameForStage(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AMPLIFY_API const char* GetNameForStageCStr(Stage value);
 } // namespace StageMapper
 } // namespace Model
 } // namespace Amplify
@@ -30,35 +30,58 @@ namespace Aws
       namespace DomainStatusMapper
       {
 
-        static const int PENDING_VERIFICATION_HASH = HashingUtils::HashString("PENDING_VERIFICATION");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int PENDING_DEPLOYMENT_HASH = HashingUtils::HashString("PENDING_DEPLOYMENT");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING_VERIFICATION",
+          "IN_PROGRESS",
+          "AVAILABLE",
+          "PENDING_DEPLOYMENT",
+          "FAILED",
+        };
 
         DomainStatus GetDomainStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_VERIFICATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DomainStatus::PENDING_VERIFICATION;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return DomainStatus::IN_PROGRESS;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return DomainStatus::AVAILABLE;
-          }
-          else if (hashCode == PENDING_DEPLOYMENT_HASH)
-          {
-            return DomainStatus::PENDING_DEPLOYMENT;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return DomainStatus::FAILED;
+          case 793439203:
+            if (name == "PENDING_VERIFICATION")
+            {
+              return DomainStatus::PENDING_VERIFICATION;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return DomainStatus::IN_PROGRESS;
+            }
+            break;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return DomainStatus::AVAILABLE;
+            }
+            break;
+          case -873748851:
+            if (name == "PENDING_DEPLOYMENT")
+            {
+              return DomainStatus::PENDING_DEPLOYMENT;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return DomainStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return DomainStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDomainStatus(DomainStatus enumValue)
+        const char* GetNameForDomainStatusCStr(DomainStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DomainStatus::PENDING_VERIFICATION:
-            return "PENDING_VERIFICATION";
-          case DomainStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case DomainStatus::AVAILABLE:
-            return "AVAILABLE";
-          case DomainStatus::PENDING_DEPLOYMENT:
-            return "PENDING_DEPLOYMENT";
-          case DomainStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDomainStatus(DomainStatus enumValue)
+        {
+          return GetNameForDomainStatusCStr(enumValue);
         }
 
       } // namespace DomainStatusMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int PROVISIONING_HASH = HashingUtils::HashString("PROVISIONING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SUCCEED_HASH = HashingUtils::HashString("SUCCEED");
-        static const int CANCELLING_HASH = HashingUtils::HashString("CANCELLING");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "PROVISIONING",
+          "RUNNING",
+          "FAILED",
+          "SUCCEED",
+          "CANCELLING",
+          "CANCELLED",
+        };
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return JobStatus::PENDING;
-          }
-          else if (hashCode == PROVISIONING_HASH)
-          {
-            return JobStatus::PROVISIONING;
-          }
-          else if (hashCode == RUNNING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobStatus::RUNNING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobStatus::FAILED;
-          }
-          else if (hashCode == SUCCEED_HASH)
-          {
-            return JobStatus::SUCCEED;
-          }
-          else if (hashCode == CANCELLING_HASH)
-          {
-            return JobStatus::CANCELLING;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return JobStatus::CANCELLED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return JobStatus::PENDING;
+            }
+            break;
+          case -1856587027:
+            if (name == "PROVISIONING")
+            {
+              return JobStatus::PROVISIONING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return JobStatus::RUNNING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return JobStatus::FAILED;
+            }
+            break;
+          case -1149187550:
+            if (name == "SUCCEED")
+            {
+              return JobStatus::SUCCEED;
+            }
+            break;
+          case -1920533136:
+            if (name == "CANCELLING")
+            {
+              return JobStatus::CANCELLING;
+            }
+            break;
+          case -1031784143:
+            if (name == "CANCELLED")
+            {
+              return JobStatus::CANCELLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatusCStr(JobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobStatus::PENDING:
-            return "PENDING";
-          case JobStatus::PROVISIONING:
-            return "PROVISIONING";
-          case JobStatus::RUNNING:
-            return "RUNNING";
-          case JobStatus::FAILED:
-            return "FAILED";
-          case JobStatus::SUCCEED:
-            return "SUCCEED";
-          case JobStatus::CANCELLING:
-            return "CANCELLING";
-          case JobStatus::CANCELLED:
-            return "CANCELLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        {
+          return GetNameForJobStatusCStr(enumValue);
         }
 
       } // namespace JobStatusMapper
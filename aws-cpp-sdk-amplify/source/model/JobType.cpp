@@ -30,25 +30,44 @@ namespace Aws
       namespace JobTypeMapper
       {
 
-        static const int RELEASE_HASH = HashingUtils::HashString("RELEASE");
-        static const int RETRY_HASH = HashingUtils::HashString("RETRY");
-        static const int WEB_HOOK_HASH = HashingUtils::HashString("WEB_HOOK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RELEASE",
+          "RETRY",
+          "WEB_HOOK",
+        };
 
         JobType GetJobTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RELEASE_HASH)
-          {
-            return JobType::RELEASE;
-          }
-          else if (hashCode == RETRY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobType::RETRY;
-          }
-          else if (hashCode == WEB_HOOK_HASH)
-          {
-            return JobType::WEB_HOOK;
+          case 1808577511:
+            if (name == "RELEASE")
+            {
+              return JobType::RELEASE;
+            }
+            break;
+          case 77867656:
+            if (name == "RETRY")
+            {
+              return JobType::RETRY;
+            }
+            break;
+          case 93370190:
+            if (name == "WEB_HOOK")
+            {
+              return JobType::WEB_HOOK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return JobType::NOT_SET;
         }
 
-        Aws::String GetNameForJobType(JobType enumValue)
+        const char* GetNameForJobTypeCStr(JobType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobType::RELEASE:
-            return "RELEASE";
-          case JobType::RETRY:
-            return "RETRY";
-          case JobType::WEB_HOOK:
-            return "WEB_HOOK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobType(JobType enumValue)
+        {
+          return GetNameForJobTypeCStr(enumValue);
         }
 
       } // namespace JobTypeMapper
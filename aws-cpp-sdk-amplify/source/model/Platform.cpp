@@ -30,30 +30,51 @@ namespace Aws
       namespace PlatformMapper
       {
 
-        static const int IOS_HASH = HashingUtils::HashString("IOS");
-        static const int ANDROID__HASH = HashingUtils::HashString("ANDROID");
-        static const int WEB_HASH = HashingUtils::HashString("WEB");
-        static const int REACT_NATIVE_HASH = HashingUtils::HashString("REACT_NATIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IOS",
+          "ANDROID",
+          "WEB",
+          "REACT_NATIVE",
+        };
 
         Platform GetPlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IOS_HASH)
-          {
-            return Platform::IOS;
-          }
-          else if (hashCode == ANDROID__HASH)
-          {
-            return Platform::ANDROID_;
-          }
-          else if (hashCode == WEB_HASH)
-          {
-            return Platform::WEB;
-          }
-          else if (hashCode == REACT_NATIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Platform::REACT_NATIVE;
+          case 72685:
+            if (name == "IOS")
+            {
+              return Platform::IOS;
+            }
+            break;
+          case -143408561:
+            if (name == "ANDROID")
+            {
+              return Platform::ANDROID_;
+            }
+            break;
+          case 85812:
+            if (name == "WEB")
+            {
+              return Platform::WEB;
+            }
+            break;
+          case -1388189961:
+            if (name == "REACT_NATIVE")
+            {
+              return Platform::REACT_NATIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Platform::NOT_SET;
         }
 
-        Aws::String GetNameForPlatform(Platform enumValue)
+        const char* GetNameForPlatformCStr(Platform enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Platform::IOS:
-            return "IOS";
-          case Platform::ANDROID_:
-            return "ANDROID";
-          case Platform::WEB:
-            return "WEB";
-          case Platform::REACT_NATIVE:
-            return "REACT_NATIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlatform(Platform enumValue)
+        {
+          return GetNameForPlatformCStr(enumValue);
         }
 
       } // namespace PlatformMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace StageMapper
       {
 
-        static const int PRODUCTION_HASH = HashingUtils::HashString("PRODUCTION");
-        static const int BETA_HASH = HashingUtils::HashString("BETA");
-        static const int DEVELOPMENT_HASH = HashingUtils::HashString("DEVELOPMENT");
-        static const int EXPERIMENTAL_HASH = HashingUtils::HashString("EXPERIMENTAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PRODUCTION",
+          "BETA",
+          "DEVELOPMENT",
+          "EXPERIMENTAL",
+        };
 
         Stage GetStageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRODUCTION_HASH)
-          {
-            return Stage::PRODUCTION;
-          }
-          else if (hashCode == BETA_HASH)
-          {
-            return Stage::BETA;
-          }
-          else if (hashCode == DEVELOPMENT_HASH)
-          {
-            return Stage::DEVELOPMENT;
-          }
-          else if (hashCode == EXPERIMENTAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Stage::EXPERIMENTAL;
+          case -2056856391:
+            if (name == "PRODUCTION")
+            {
+              return Stage::PRODUCTION;
+            }
+            break;
+          case 2035184:
+            if (name == "BETA")
+            {
+              return Stage::BETA;
+            }
+            break;
+          case 1928147227:
+            if (name == "DEVELOPMENT")
+            {
+              return Stage::DEVELOPMENT;
+            }
+            break;
+          case 1912718568:
+            if (name == "EXPERIMENTAL")
+            {
+              return Stage::EXPERIMENTAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Stage::NOT_SET;
         }
 
-        Aws::String GetNameForStage(Stage enumValue)
+        const char* GetNameForStageCStr(Stage enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Stage::PRODUCTION:
-            return "PRODUCTION";
-          case Stage::BETA:
-            return "BETA";
-          case Stage::DEVELOPMENT:
-            return "DEVELOPMENT";
-          case Stage::EXPERIMENTAL:
-            return "EXPERIMENTAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStage(Stage enumValue)
+        {
+          return GetNameForStageCStr(enumValue);
         }
 
       } // namespace StageMapper
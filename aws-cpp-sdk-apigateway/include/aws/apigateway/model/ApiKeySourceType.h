@@ -35,6 +35,11 @@ namespace ApiKeySourceTypeMapper
 AWS_APIGATEWAY_API ApiKeySourceType GetApiKeySourceTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForApiKeySourceType(ApiKeySourceType value);
+
+/**
+ * Same as GetNameForApiKeySourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForApiKeySourceTypeCStr(ApiKeySourceType value);
 } // namespace ApiKeySourceTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -34,6 +34,11 @@ namespace ApiKeysFormatMapper
 AWS_APIGATEWAY_API ApiKeysFormat GetApiKeysFormatForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForApiKeysFormat(ApiKeysFormat value);
+
+/**
+ * Same as GetNameForApiKeysFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForApiKeysFormatCStr(ApiKeysFormat value);
 } // namespace ApiKeysFormatMapper
 } // namespace Model
 } // namespace APIGateway
@@ -36,6 +36,11 @@ namespace AuthorizerTypeMapper
 AWS_APIGATEWAY_API AuthorizerType GetAuthorizerTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForAuthorizerType(AuthorizerType value);
+
+/**
+ * Same as GetNameForAuthorizerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForAuthorizerTypeCStr(AuthorizerType value);
 } // namespace AuthorizerTypeMapper
 } // namespace Model
 } // namespace APIGateway
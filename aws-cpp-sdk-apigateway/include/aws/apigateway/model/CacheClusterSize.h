@@ -41,6 +41,11 @@ namespace CacheClusterSizeMapper
 AWS_APIGATEWAY_API CacheClusterSize GetCacheClusterSizeForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForCacheClusterSize(CacheClusterSize value);
+
+/**
+ * Same as GetNameForCacheClusterSize(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForCacheClusterSizeCStr(CacheClusterSize value);
 } // namespace CacheClusterSizeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -38,6 +38,11 @@ namespace CacheClusterStatusMapper
 AWS_APIGATEWAY_API CacheClusterStatus GetCacheClusterStatusForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForCacheClusterStatus(CacheClusterStatus value);
+
+/**
+ * Same as GetNameForCacheClusterStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForCacheClusterStatusCStr(CacheClusterStatus value);
 } // namespace CacheClusterStatusMapper
 } // namespace Model
 } // namespace APIGateway
@@ -35,6 +35,11 @@ namespace ConnectionTypeMapper
 AWS_APIGATEWAY_API ConnectionType GetConnectionTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForConnectionType(ConnectionType value);
+
+/**
+ * Same as GetNameForConnectionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForConnectionTypeCStr(ConnectionType value);
 } // namespace ConnectionTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -45,6 +45,11 @@ namespace DocumentationPartTypeMapper
 AWS_APIGATEWAY_API DocumentationPartType GetDocumentationPartTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForDocumentationPartType(DocumentationPartType value);
+
+/**
+ * Same as GetNameForDocumentationPartType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForDocumentationPartTypeCStr(DocumentationPartType value);
 } // namespace DocumentationPartTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -36,6 +36,11 @@ namespace EndpointTypeMapper
 AWS_APIGATEWAY_API EndpointType GetEndpointTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForEndpointType(EndpointType value);
+
+/**
+ * Same as GetNameForEndpointType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForEndpointTypeCStr(EndpointType value);
 } // namespace EndpointTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -53,6 +53,11 @@ namespace GatewayResponseTypeMapper
 AWS_APIGATEWAY_API GatewayResponseType GetGatewayResponseTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForGatewayResponseType(GatewayResponseType value);
+
+/**
+ * Same as GetNameForGatewayResponseType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForGatewayResponseTypeCStr(GatewayResponseType value);
 } // namespace GatewayResponseTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -38,6 +38,11 @@ namespace IntegrationTypeMapper
 AWS_APIGATEWAY_API IntegrationType GetIntegrationTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForIntegrationType(IntegrationType value);
+
+/**
+ * Same as GetNameForIntegrationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForIntegrationTypeCStr(IntegrationType value);
 } // namespace IntegrationTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -35,6 +35,11 @@ namespace LocationStatusTypeMapper
 AWS_APIGATEWAY_API LocationStatusType GetLocationStatusTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForLocationStatusType(LocationStatusType value);
+
+/**
+ * Same as GetNameForLocationStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForLocationStatusTypeCStr(LocationStatusType value);
 } // namespace LocationStatusTypeMapper
 } // namespace Model
 } // namespace APIGateway
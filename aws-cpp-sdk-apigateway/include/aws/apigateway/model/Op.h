@@ -39,6 +39,11 @@ namespace OpMapper
 AWS_APIGATEWAY_API Op GetOpForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForOp(Op value);
+
+/**
+ * Same as GetNameForOp(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForOpCStr(Op value);
 } // namespace OpMapper
 } // namespace Model
 } // namespace APIGateway
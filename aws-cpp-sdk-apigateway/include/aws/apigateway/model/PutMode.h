@@ -35,6 +35,11 @@ namespace PutModeMapper
 AWS_APIGATEWAY_API PutMode GetPutModeForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForPutMode(PutMode value);
+
+/**
+ * Same as GetNameForPutMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForPutModeCStr(PutMode value);
 } // namespace PutModeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -36,6 +36,11 @@ namespace QuotaPeriodTypeMapper
 AWS_APIGATEWAY_API QuotaPeriodType GetQuotaPeriodTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForQuotaPeriodType(QuotaPeriodType value);
+
+/**
+ * Same as GetNameForQuotaPeriodType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForQuotaPeriodTypeCStr(QuotaPeriodType value);
 } // namespace QuotaPeriodTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -36,6 +36,11 @@ namespace UnauthorizedCacheControlHeaderStrategyMapper
 AWS_APIGATEWAY_API UnauthorizedCacheControlHeaderStrategy GetUnauthorizedCacheControlHeaderStrategyForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForUnauthorizedCacheControlHeaderStrategy(UnauthorizedCacheControlHeaderStrategy value);
+
+/**
+ * Same as GetNameForUnauthorizedCacheControlHeaderStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForUnauthorizedCacheControlHeaderStrategyCStr(UnauthorizedCacheControlHeaderStrategy value);
 } // namespace UnauthorizedCacheControlHeaderStrategyMapper
 } // namespace Model
 } // namespace APIGateway
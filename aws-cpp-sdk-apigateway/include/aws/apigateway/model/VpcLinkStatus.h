@@ -37,6 +37,11 @@ namespace VpcLinkStatusMapper
 AWS_APIGATEWAY_API VpcLinkStatus GetVpcLinkStatusForName(const Aws::String& name);
 
 AWS_APIGATEWAY_API Aws::String GetNameForVpcLinkStatus(VpcLinkStatus value);
+
+/**
+ * Same as GetNameForVpcLinkStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAY_API const char* GetNameForVpcLinkStatusCStr(VpcLinkStatus value);
 } // namespace VpcLinkStatusMapper
 } // namespace Model
 } // namespace APIGateway
@@ -30,20 +30,37 @@ namespace Aws
       namespace ApiKeySourceTypeMapper
       {
 
-        static const int HEADER_HASH = HashingUtils::HashString("HEADER");
-        static const int AUTHORIZER_HASH = HashingUtils::HashString("AUTHORIZER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HEADER",
+          "AUTHORIZER",
+        };
 
         ApiKeySourceType GetApiKeySourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HEADER_HASH)
-          {
-            return ApiKeySourceType::HEADER;
-          }
-          else if (hashCode == AUTHORIZER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ApiKeySourceType::AUTHORIZER;
+          case 2127025805:
+            if (name == "HEADER")
+            {
+              return ApiKeySourceType::HEADER;
+            }
+            break;
+          case -1015619159:
+            if (name == "AUTHORIZER")
+            {
+              return ApiKeySourceType::AUTHORIZER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ApiKeySourceType::NOT_SET;
         }
 
-        Aws::String GetNameForApiKeySourceType(ApiKeySourceType enumValue)
+        const char* GetNameForApiKeySourceTypeCStr(ApiKeySourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ApiKeySourceType::HEADER:
-            return "HEADER";
-          case ApiKeySourceType::AUTHORIZER:
-            return "AUTHORIZER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForApiKeySourceType(ApiKeySourceType enumValue)
+        {
+          return GetNameForApiKeySourceTypeCStr(enumValue);
         }
 
       } // namespace ApiKeySourceTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ApiKeysFormatMapper
       {
 
-        static const int csv_HASH = HashingUtils::HashString("csv");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "csv",
+        };
 
         ApiKeysFormat GetApiKeysFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == csv_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ApiKeysFormat::csv;
+          case 98822:
+            if (name == "csv")
+            {
+              return ApiKeysFormat::csv;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ApiKeysFormat::NOT_SET;
         }
 
-        Aws::String GetNameForApiKeysFormat(ApiKeysFormat enumValue)
+        const char* GetNameForApiKeysFormatCStr(ApiKeysFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ApiKeysFormat::csv:
-            return "csv";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForApiKeysFormat(ApiKeysFormat enumValue)
+        {
+          return GetNameForApiKeysFormatCStr(enumValue);
         }
 
       } // namespace ApiKeysFormatMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AuthorizerTypeMapper
       {
 
-        static const int TOKEN_HASH = HashingUtils::HashString("TOKEN");
-        static const int REQUEST_HASH = HashingUtils::HashString("REQUEST");
-        static const int COGNITO_USER_POOLS_HASH = HashingUtils::HashString("COGNITO_USER_POOLS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TOKEN",
+          "REQUEST",
+          "COGNITO_USER_POOLS",
+        };
 
         AuthorizerType GetAuthorizerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TOKEN_HASH)
-          {
-            return AuthorizerType::TOKEN;
-          }
-          else if (hashCode == REQUEST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthorizerType::REQUEST;
-          }
-          else if (hashCode == COGNITO_USER_POOLS_HASH)
-          {
-            return AuthorizerType::COGNITO_USER_POOLS;
+          case 80003545:
+            if (name == "TOKEN")
+            {
+              return AuthorizerType::TOKEN;
+            }
+            break;
+          case 1813675631:
+            if (name == "REQUEST")
+            {
+              return AuthorizerType::REQUEST;
+            }
+            break;
+          case 1501629937:
+            if (name == "COGNITO_USER_POOLS")
+            {
+              return AuthorizerType::COGNITO_USER_POOLS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AuthorizerType::NOT_SET;
         }
 
-        Aws::String GetNameForAuthorizerType(AuthorizerType enumValue)
+        const char* GetNameForAuthorizerTypeCStr(AuthorizerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthorizerType::TOKEN:
-            return "TOKEN";
-          case AuthorizerType::REQUEST:
-            return "REQUEST";
-          case AuthorizerType::COGNITO_USER_POOLS:
-            return "COGNITO_USER_POOLS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthorizerType(AuthorizerType enumValue)
+        {
+          return GetNameForAuthorizerTypeCStr(enumValue);
         }
 
       } // namespace AuthorizerTypeMapper
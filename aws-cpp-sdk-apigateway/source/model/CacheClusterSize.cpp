@@ -30,50 +30,79 @@ namespace Aws
       namespace CacheClusterSizeMapper
       {
 
-        static const int _0_5_HASH = HashingUtils::HashString("0.5");
-        static const int _1_6_HASH = HashingUtils::HashString("1.6");
-        static const int _6_1_HASH = HashingUtils::HashString("6.1");
-        static const int _13_5_HASH = HashingUtils::HashString("13.5");
-        static const int _28_4_HASH = HashingUtils::HashString("28.4");
-        static const int _58_2_HASH = HashingUtils::HashString("58.2");
-        static const int _118_HASH = HashingUtils::HashString("118");
-        static const int _237_HASH = HashingUtils::HashString("237");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "0.5",
+          "1.6",
+          "6.1",
+          "13.5",
+          "28.4",
+          "58.2",
+          "118",
+          "237",
+        };
 
         CacheClusterSize GetCacheClusterSizeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == _0_5_HASH)
-          {
-            return CacheClusterSize::_0_5;
-          }
-          else if (hashCode == _1_6_HASH)
-          {
-            return CacheClusterSize::_1_6;
-          }
-          else if (hashCode == _6_1_HASH)
-          {
-            return CacheClusterSize::_6_1;
-          }
-          else if (hashCode == _13_5_HASH)
-          {
-            return CacheClusterSize::_13_5;
-          }
-          else if (hashCode == _28_4_HASH)
-          {
-            return CacheClusterSize::_28_4;
-          }
-          else if (hashCode == _58_2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CacheClusterSize::_58_2;
-          }
-          else if (hashCode == _118_HASH)
-          {
-            return CacheClusterSize::_118;
-          }
-          else if (hashCode == _237_HASH)
-          {
-            return CacheClusterSize::_237;
+          case 47607:
+            if (name == "0.5")
+            {
+              return CacheClusterSize::_0_5;
+            }
+            break;
+          case 48569:
+            if (name == "1.6")
+            {
+              return CacheClusterSize::_1_6;
+            }
+            break;
+          case 53369:
+            if (name == "6.1")
+            {
+              return CacheClusterSize::_6_1;
+            }
+            break;
+          case 1510249:
+            if (name == "13.5")
+            {
+              return CacheClusterSize::_13_5;
+            }
+            break;
+          case 1544844:
+            if (name == "28.4")
+            {
+              return CacheClusterSize::_28_4;
+            }
+            break;
+          case 1634215:
+            if (name == "58.2")
+            {
+              return CacheClusterSize::_58_2;
+            }
+            break;
+          case 48664:
+            if (name == "118")
+            {
+              return CacheClusterSize::_118;
+            }
+            break;
+          case 49686:
+            if (name == "237")
+            {
+              return CacheClusterSize::_237;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return CacheClusterSize::NOT_SET;
         }
 
-        Aws::String GetNameForCacheClusterSize(CacheClusterSize enumValue)
+        const char* GetNameForCacheClusterSizeCStr(CacheClusterSize enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CacheClusterSize::_0_5:
-            return "0.5";
-          case CacheClusterSize::_1_6:
-            return "1.6";
-          case CacheClusterSize::_6_1:
-            return "6.1";
-          case CacheClusterSize::_13_5:
-            return "13.5";
-          case CacheClusterSize::_28_4:
-            return "28.4";
-          case CacheClusterSize::_58_2:
-            return "58.2";
-          case CacheClusterSize::_118:
-            return "118";
-          case CacheClusterSize::_237:
-            return "237";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCacheClusterSize(CacheClusterSize enumValue)
+        {
+          return GetNameForCacheClusterSizeCStr(enumValue);
         }
 
       } // namespace CacheClusterSizeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace CacheClusterStatusMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int NOT_AVAILABLE_HASH = HashingUtils::HashString("NOT_AVAILABLE");
-        static const int FLUSH_IN_PROGRESS_HASH = HashingUtils::HashString("FLUSH_IN_PROGRESS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE_IN_PROGRESS",
+          "AVAILABLE",
+          "DELETE_IN_PROGRESS",
+          "NOT_AVAILABLE",
+          "FLUSH_IN_PROGRESS",
+        };
 
         CacheClusterStatus GetCacheClusterStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CacheClusterStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return CacheClusterStatus::AVAILABLE;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
-            return CacheClusterStatus::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == NOT_AVAILABLE_HASH)
-          {
-            return CacheClusterStatus::NOT_AVAILABLE;
-          }
-          else if (hashCode == FLUSH_IN_PROGRESS_HASH)
-          {
-            return CacheClusterStatus::FLUSH_IN_PROGRESS;
+          case 43560260:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return CacheClusterStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return CacheClusterStatus::AVAILABLE;
+            }
+            break;
+          case 1089799027:
+            if (name == "DELETE_IN_PROGRESS")
+            {
+              return CacheClusterStatus::DELETE_IN_PROGRESS;
+            }
+            break;
+          case 140722205:
+            if (name == "NOT_AVAILABLE")
+            {
+              return CacheClusterStatus::NOT_AVAILABLE;
+            }
+            break;
+          case -499073236:
+            if (name == "FLUSH_IN_PROGRESS")
+            {
+              return CacheClusterStatus::FLUSH_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return CacheClusterStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCacheClusterStatus(CacheClusterStatus enumValue)
+        const char* GetNameForCacheClusterStatusCStr(CacheClusterStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CacheClusterStatus::CREATE_IN_PROGRESS:
-            return "CREATE_IN_PROGRESS";
-          case CacheClusterStatus::AVAILABLE:
-            return "AVAILABLE";
-          case CacheClusterStatus::DELETE_IN_PROGRESS:
-            return "DELETE_IN_PROGRESS";
-          case CacheClusterStatus::NOT_AVAILABLE:
-            return "NOT_AVAILABLE";
-          case CacheClusterStatus::FLUSH_IN_PROGRESS:
-            return "FLUSH_IN_PROGRESS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCacheClusterStatus(CacheClusterStatus enumValue)
+        {
+          return GetNameForCacheClusterStatusCStr(enumValue);
         }
 
       } // namespace CacheClusterStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ContentHandlingStrategyMapper
       {
 
-        static const int CONVERT_TO_BINARY_HASH = HashingUtils::HashString("CONVERT_TO_BINARY");
-        static const int CONVERT_TO_TEXT_HASH = HashingUtils::HashString("CONVERT_TO_TEXT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONVERT_TO_BINARY",
+          "CONVERT_TO_TEXT",
+        };
 
         ContentHandlingStrategy GetContentHandlingStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONVERT_TO_BINARY_HASH)
-          {
-            return ContentHandlingStrategy::CONVERT_TO_BINARY;
-          }
-          else if (hashCode == CONVERT_TO_TEXT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContentHandlingStrategy::CONVERT_TO_TEXT;
+          case 125979289:
+            if (name == "CONVERT_TO_BINARY")
+            {
+              return ContentHandlingStrategy::CONVERT_TO_BINARY;
+            }
+            break;
+          case -178106939:
+            if (name == "CONVERT_TO_TEXT")
+            {
+              return ContentHandlingStrategy::CONVERT_TO_TEXT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ContentHandlingStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForContentHandlingStrategy(ContentHandlingStrategy enumValue)
+        const char* GetNameForContentHandlingStrategyCStr(ContentHandlingStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContentHandlingStrategy::CONVERT_TO_BINARY:
-            return "CONVERT_TO_BINARY";
-          case ContentHandlingStrategy::CONVERT_TO_TEXT:
-            return "CONVERT_TO_TEXT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContentHandlingStrategy(ContentHandlingStrategy enumValue)
+        {
+          return GetNameForContentHandlingStrategyCStr(enumValue);
         }
 
       } // namespace ContentHandlingStrategyMapper
@@ -30,70 +30,107 @@ namespace Aws
       namespace DocumentationPartTypeMapper
       {
 
-        static const int API_HASH = HashingUtils::HashString("API");
-        static const int AUTHORIZER_HASH = HashingUtils::HashString("AUTHORIZER");
-        static const int MODEL_HASH = HashingUtils::HashString("MODEL");
-        static const int RESOURCE_HASH = HashingUtils::HashString("RESOURCE");
-        static const int METHOD_HASH = HashingUtils::HashString("METHOD");
-        static const int PATH_PARAMETER_HASH = HashingUtils::HashString("PATH_PARAMETER");
-        static const int QUERY_PARAMETER_HASH = HashingUtils::HashString("QUERY_PARAMETER");
-        static const int REQUEST_HEADER_HASH = HashingUtils::HashString("REQUEST_HEADER");
-        static const int REQUEST_BODY_HASH = HashingUtils::HashString("REQUEST_BODY");
-        static const int RESPONSE_HASH = HashingUtils::HashString("RESPONSE");
-        static const int RESPONSE_HEADER_HASH = HashingUtils::HashString("RESPONSE_HEADER");
-        static const int RESPONSE_BODY_HASH = HashingUtils::HashString("RESPONSE_BODY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "API",
+          "AUTHORIZER",
+          "MODEL",
+          "RESOURCE",
+          "METHOD",
+          "PATH_PARAMETER",
+          "QUERY_PARAMETER",
+          "REQUEST_HEADER",
+          "REQUEST_BODY",
+          "RESPONSE",
+          "RESPONSE_HEADER",
+          "RESPONSE_BODY",
+        };
 
         DocumentationPartType GetDocumentationPartTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == API_HASH)
-          {
-            return DocumentationPartType::API;
-          }
-          else if (hashCode == AUTHORIZER_HASH)
-          {
-            return DocumentationPartType::AUTHORIZER;
-          }
-          else if (hashCode == MODEL_HASH)
-          {
-            return DocumentationPartType::MODEL;
-          }
-          else if (hashCode == RESOURCE_HASH)
-          {
-            return DocumentationPartType::RESOURCE;
-          }
-          else if (hashCode == METHOD_HASH)
-          {
-            return DocumentationPartType::METHOD;
-          }
-          else if (hashCode == PATH_PARAMETER_HASH)
-          {
-            return DocumentationPartType::PATH_PARAMETER;
-          }
-          else if (hashCode == QUERY_PARAMETER_HASH)
-          {
-            return DocumentationPartType::QUERY_PARAMETER;
-          }
-          else if (hashCode == REQUEST_HEADER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DocumentationPartType::REQUEST_HEADER;
-          }
-          else if (hashCode == REQUEST_BODY_HASH)
-          {
-            return DocumentationPartType::REQUEST_BODY;
-          }
-          else if (hashCode == RESPONSE_HASH)
-          {
-            return DocumentationPartType::RESPONSE;
-          }
-          else if (hashCode == RESPONSE_HEADER_HASH)
-          {
-            return DocumentationPartType::RESPONSE_HEADER;
-          }
-          else if (hashCode == RESPONSE_BODY_HASH)
-          {
-            return DocumentationPartType::RESPONSE_BODY;
+          case 65018:
+            if (name == "API")
+            {
+              return DocumentationPartType::API;
+            }
+            break;
+          case -1015619159:
+            if (name == "AUTHORIZER")
+            {
+              return DocumentationPartType::AUTHORIZER;
+            }
+            break;
+          case 73532169:
+            if (name == "MODEL")
+            {
+              return DocumentationPartType::MODEL;
+            }
+            break;
+          case 441562126:
+            if (name == "RESOURCE")
+            {
+              return DocumentationPartType::RESOURCE;
+            }
+            break;
+          case -2024225567:
+            if (name == "METHOD")
+            {
+              return DocumentationPartType::METHOD;
+            }
+            break;
+          case 1292365807:
+            if (name == "PATH_PARAMETER")
+            {
+              return DocumentationPartType::PATH_PARAMETER;
+            }
+            break;
+          case -1297994574:
+            if (name == "QUERY_PARAMETER")
+            {
+              return DocumentationPartType::QUERY_PARAMETER;
+            }
+            break;
+          case -1584002467:
+            if (name == "REQUEST_HEADER")
+            {
+              return DocumentationPartType::REQUEST_HEADER;
+            }
+            break;
+          case -645392014:
+            if (name == "REQUEST_BODY")
+            {
+              return DocumentationPartType::REQUEST_BODY;
+            }
+            break;
+          case 442303553:
+            if (name == "RESPONSE")
+            {
+              return DocumentationPartType::RESPONSE;
+            }
+            break;
+          case -132467637:
+            if (name == "RESPONSE_HEADER")
+            {
+              return DocumentationPartType::RESPONSE_HEADER;
+            }
+            break;
+          case 527066848:
+            if (name == "RESPONSE_BODY")
+            {
+              return DocumentationPartType::RESPONSE_BODY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return DocumentationPartType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentationPartType(DocumentationPartType enumValue)
+        const char* GetNameForDocumentationPartTypeCStr(DocumentationPartType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DocumentationPartType::API:
-            return "API";
-          case DocumentationPartType::AUTHORIZER:
-            return "AUTHORIZER";
-          case DocumentationPartType::MODEL:
-            return "MODEL";
-          case DocumentationPartType::RESOURCE:
-            return "RESOURCE";
-          case DocumentationPartType::METHOD:
-            return "METHOD";
-          case DocumentationPartType::PATH_PARAMETER:
-            return "PATH_PARAMETER";
-          case DocumentationPartType::QUERY_PARAMETER:
-            return "QUERY_PARAMETER";
-          case DocumentationPartType::REQUEST_HEADER:
-            return "REQUEST_HEADER";
-          case DocumentationPartType::REQUEST_BODY:
-            return "REQUEST_BODY";
-          case DocumentationPartType::RESPONSE:
-            return "RESPONSE";
-          case DocumentationPartType::RESPONSE_HEADER:
-            return "RESPONSE_HEADER";
-          case DocumentationPartType::RESPONSE_BODY:
-            return "RESPONSE_BODY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDocumentationPartType(DocumentationPartType enumValue)
+        {
+          return GetNameForDocumentationPartTypeCStr(enumValue);
         }
 
       } // namespace DocumentationPartTypeMapper
@@ -30,110 +30,163 @@ namespace Aws
       namespace GatewayResponseTypeMapper
       {
 
-        static const int DEFAULT_4XX_HASH = HashingUtils::HashString("DEFAULT_4XX");
-        static const int DEFAULT_5XX_HASH = HashingUtils::HashString("DEFAULT_5XX");
-        static const int RESOURCE_NOT_FOUND_HASH = HashingUtils::HashString("RESOURCE_NOT_FOUND");
-        static const int UNAUTHORIZED_HASH = HashingUtils::HashString("UNAUTHORIZED");
-        static const int INVALID_API_KEY_HASH = HashingUtils::HashString("INVALID_API_KEY");
-        static const int ACCESS_DENIED_HASH = HashingUtils::HashString("ACCESS_DENIED");
-        static const int AUTHORIZER_FAILURE_HASH = HashingUtils::HashString("AUTHORIZER_FAILURE");
-        static const int AUTHORIZER_CONFIGURATION_ERROR_HASH = HashingUtils::HashString("AUTHORIZER_CONFIGURATION_ERROR");
-        static const int INVALID_SIGNATURE_HASH = HashingUtils::HashString("INVALID_SIGNATURE");
-        static const int EXPIRED_TOKEN_HASH = HashingUtils::HashString("EXPIRED_TOKEN");
-        static const int MISSING_AUTHENTICATION_TOKEN_HASH = HashingUtils::HashString("MISSING_AUTHENTICATION_TOKEN");
-        static const int INTEGRATION_FAILURE_HASH = HashingUtils::HashString("INTEGRATION_FAILURE");
-        static const int INTEGRATION_TIMEOUT_HASH = HashingUtils::HashString("INTEGRATION_TIMEOUT");
-        static const int API_CONFIGURATION_ERROR_HASH = HashingUtils::HashString("API_CONFIGURATION_ERROR");
-        static const int UNSUPPORTED_MEDIA_TYPE_HASH = HashingUtils::HashString("UNSUPPORTED_MEDIA_TYPE");
-        static const int BAD_REQUEST_PARAMETERS_HASH = HashingUtils::HashString("BAD_REQUEST_PARAMETERS");
-        static const int BAD_REQUEST_BODY_HASH = HashingUtils::HashString("BAD_REQUEST_BODY");
-        static const int REQUEST_TOO_LARGE_HASH = HashingUtils::HashString("REQUEST_TOO_LARGE");
-        static const int THROTTLED_HASH = HashingUtils::HashString("THROTTLED");
-        static const int QUOTA_EXCEEDED_HASH = HashingUtils::HashString("QUOTA_EXCEEDED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT_4XX",
+          "DEFAULT_5XX",
+          "RESOURCE_NOT_FOUND",
+          "UNAUTHORIZED",
+          "INVALID_API_KEY",
+          "ACCESS_DENIED",
+          "AUTHORIZER_FAILURE",
+          "AUTHORIZER_CONFIGURATION_ERROR",
+          "INVALID_SIGNATURE",
+          "EXPIRED_TOKEN",
+          "MISSING_AUTHENTICATION_TOKEN",
+          "INTEGRATION_FAILURE",
+          "INTEGRATION_TIMEOUT",
+          "API_CONFIGURATION_ERROR",
+          "UNSUPPORTED_MEDIA_TYPE",
+          "BAD_REQUEST_PARAMETERS",
+          "BAD_REQUEST_BODY",
+          "REQUEST_TOO_LARGE",
+          "THROTTLED",
+          "QUOTA_EXCEEDED",
+        };
 
         GatewayResponseType GetGatewayResponseTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_4XX_HASH)
-          {
-            return GatewayResponseType::DEFAULT_4XX;
-          }
-          else if (hashCode == DEFAULT_5XX_HASH)
-          {
-            return GatewayResponseType::DEFAULT_5XX;
-          }
-          else if (hashCode == RESOURCE_NOT_FOUND_HASH)
-          {
-            return GatewayResponseType::RESOURCE_NOT_FOUND;
-          }
-          else if (hashCode == UNAUTHORIZED_HASH)
-          {
-            return GatewayResponseType::UNAUTHORIZED;
-          }
-          else if (hashCode == INVALID_API_KEY_HASH)
-          {
-            return GatewayResponseType::INVALID_API_KEY;
-          }
-          else if (hashCode == ACCESS_DENIED_HASH)
-          {
-            return GatewayResponseType::ACCESS_DENIED;
-          }
-          else if (hashCode == AUTHORIZER_FAILURE_HASH)
-          {
-            return GatewayResponseType::AUTHORIZER_FAILURE;
-          }
-          else if (hashCode == AUTHORIZER_CONFIGURATION_ERROR_HASH)
-          {
-            return GatewayResponseType::AUTHORIZER_CONFIGURATION_ERROR;
-          }
-          else if (hashCode == INVALID_SIGNATURE_HASH)
-          {
-            return GatewayResponseType::INVALID_SIGNATURE;
-          }
-          else if (hashCode == EXPIRED_TOKEN_HASH)
-          {
-            return GatewayResponseType::EXPIRED_TOKEN;
-          }
-          else if (hashCode == MISSING_AUTHENTICATION_TOKEN_HASH)
-          {
-            return GatewayResponseType::MISSING_AUTHENTICATION_TOKEN;
-          }
-          else if (hashCode == INTEGRATION_FAILURE_HASH)
-          {
-            return GatewayResponseType::INTEGRATION_FAILURE;
-          }
-          else if (hashCode == INTEGRATION_TIMEOUT_HASH)
-          {
-            return GatewayResponseType::INTEGRATION_TIMEOUT;
-          }
-          else if (hashCode == API_CONFIGURATION_ERROR_HASH)
-          {
-            return GatewayResponseType::API_CONFIGURATION_ERROR;
-          }
-          else if (hashCode == UNSUPPORTED_MEDIA_TYPE_HASH)
-          {
-            return GatewayResponseType::UNSUPPORTED_MEDIA_TYPE;
-          }
-          else if (hashCode == BAD_REQUEST_PARAMETERS_HASH)
-          {
-            return GatewayResponseType::BAD_REQUEST_PARAMETERS;
-          }
-          else if (hashCode == BAD_REQUEST_BODY_HASH)
-          {
-            return GatewayResponseType::BAD_REQUEST_BODY;
-          }
-          else if (hashCode == REQUEST_TOO_LARGE_HASH)
-          {
-            return GatewayResponseType::REQUEST_TOO_LARGE;
-          }
-          else if (hashCode == THROTTLED_HASH)
-          {
-            return GatewayResponseType::THROTTLED;
-          }
-          else if (hashCode == QUOTA_EXCEEDED_HASH)
-          {
-            return GatewayResponseType::QUOTA_EXCEEDED;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 1717266198:
+            if (name == "DEFAULT_4XX")
+            {
+              return GatewayResponseType::DEFAULT_4XX;
+            }
+            break;
+          case 1717267159:
+            if (name == "DEFAULT_5XX")
+            {
+              return GatewayResponseType::DEFAULT_5XX;
+            }
+            break;
+          case -8285211:
+            if (name == "RESOURCE_NOT_FOUND")
+            {
+              return GatewayResponseType::RESOURCE_NOT_FOUND;
+            }
+            break;
+          case -1356775180:
+            if (name == "UNAUTHORIZED")
+            {
+              return GatewayResponseType::UNAUTHORIZED;
+            }
+            break;
+          case 1275142162:
+            if (name == "INVALID_API_KEY")
+            {
+              return GatewayResponseType::INVALID_API_KEY;
+            }
+            break;
+          case 1006971606:
+            if (name == "ACCESS_DENIED")
+            {
+              return GatewayResponseType::ACCESS_DENIED;
+            }
+            break;
+          case 1791659220:
+            if (name == "AUTHORIZER_FAILURE")
+            {
+              return GatewayResponseType::AUTHORIZER_FAILURE;
+            }
+            break;
+          case -580759127:
+            if (name == "AUTHORIZER_CONFIGURATION_ERROR")
+            {
+              return GatewayResponseType::AUTHORIZER_CONFIGURATION_ERROR;
+            }
+            break;
+          case 1586233392:
+            if (name == "INVALID_SIGNATURE")
+            {
+              return GatewayResponseType::INVALID_SIGNATURE;
+            }
+            break;
+          case 1349533727:
+            if (name == "EXPIRED_TOKEN")
+            {
+              return GatewayResponseType::EXPIRED_TOKEN;
+            }
+            break;
+          case 1523672747:
+            if (name == "MISSING_AUTHENTICATION_TOKEN")
+            {
+              return GatewayResponseType::MISSING_AUTHENTICATION_TOKEN;
+            }
+            break;
+          case -1545831969:
+            if (name == "INTEGRATION_FAILURE")
+            {
+              return GatewayResponseType::INTEGRATION_FAILURE;
+            }
+            break;
+          case -1773169226:
+            if (name == "INTEGRATION_TIMEOUT")
+            {
+              return GatewayResponseType::INTEGRATION_TIMEOUT;
+            }
+            break;
+          case 673979258:
+            if (name == "API_CONFIGURATION_ERROR")
+            {
+              return GatewayResponseType::API_CONFIGURATION_ERROR;
+            }
+            break;
+          case 796291903:
+            if (name == "UNSUPPORTED_MEDIA_TYPE")
+            {
+              return GatewayResponseType::UNSUPPORTED_MEDIA_TYPE;
+            }
+            break;
+          case -658955180:
+            if (name == "BAD_REQUEST_PARAMETERS")
+            {
+              return GatewayResponseType::BAD_REQUEST_PARAMETERS;
+            }
+            break;
+          case 1398947724:
+            if (name == "BAD_REQUEST_BODY")
+            {
+              return GatewayResponseType::BAD_REQUEST_BODY;
+            }
+            break;
+          case 140979840:
+            if (name == "REQUEST_TOO_LARGE")
+            {
+              return GatewayResponseType::REQUEST_TOO_LARGE;
+            }
+            break;
+          case 1528687194:
+            if (name == "THROTTLED")
+            {
+              return GatewayResponseType::THROTTLED;
+            }
+            break;
+          case -1800638118:
+            if (name == "QUOTA_EXCEEDED")
+            {
+              return GatewayResponseType::QUOTA_EXCEEDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -145,59 +198,26 @@ namespace Aws
           return GatewayResponseType::NOT_SET;
         }
 
-        Aws::String GetNameForGatewayResponseType(GatewayResponseType enumValue)
+        const char* GetNameForGatewayResponseTypeCStr(GatewayResponseType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GatewayResponseType::DEFAULT_4XX:
-            return "DEFAULT_4XX";
-          case GatewayResponseType::DEFAULT_5XX:
-            return "DEFAULT_5XX";
-          case GatewayResponseType::RESOURCE_NOT_FOUND:
-            return "RESOURCE_NOT_FOUND";
-          case GatewayResponseType::UNAUTHORIZED:
-            return "UNAUTHORIZED";
-          case GatewayResponseType::INVALID_API_KEY:
-            return "INVALID_API_KEY";
-          case GatewayResponseType::ACCESS_DENIED:
-            return "ACCESS_DENIED";
-          case GatewayResponseType::AUTHORIZER_FAILURE:
-            return "AUTHORIZER_FAILURE";
-          case GatewayResponseType::AUTHORIZER_CONFIGURATION_ERROR:
-            return "AUTHORIZER_CONFIGURATION_ERROR";
-          case GatewayResponseType::INVALID_SIGNATURE:
-            return "INVALID_SIGNATURE";
-          case GatewayResponseType::EXPIRED_TOKEN:
-            return "EXPIRED_TOKEN";
-          case GatewayResponseType::MISSING_AUTHENTICATION_TOKEN:
-            return "MISSING_AUTHENTICATION_TOKEN";
-          case GatewayResponseType::INTEGRATION_FAILURE:
-            return "INTEGRATION_FAILURE";
-          case GatewayResponseType::INTEGRATION_TIMEOUT:
-            return "INTEGRATION_TIMEOUT";
-          case GatewayResponseType::API_CONFIGURATION_ERROR:
-            return "API_CONFIGURATION_ERROR";
-          case GatewayResponseType::UNSUPPORTED_MEDIA_TYPE:
-            return "UNSUPPORTED_MEDIA_TYPE";
-          case GatewayResponseType::BAD_REQUEST_PARAMETERS:
-            return "BAD_REQUEST_PARAMETERS";
-          case GatewayResponseType::BAD_REQUEST_BODY:
-            return "BAD_REQUEST_BODY";
-          case GatewayResponseType::REQUEST_TOO_LARGE:
-            return "REQUEST_TOO_LARGE";
-          case GatewayResponseType::THROTTLED:
-            return "THROTTLED";
-          case GatewayResponseType::QUOTA_EXCEEDED:
-            return "QUOTA_EXCEEDED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGatewayResponseType(GatewayResponseType enumValue)
+        {
+          return GetNameForGatewayResponseTypeCStr(enumValue);
         }
 
       } // namespace GatewayResponseTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace LocationStatusTypeMapper
       {
 
-        static const int DOCUMENTED_HASH = HashingUtils::HashString("DOCUMENTED");
-        static const int UNDOCUMENTED_HASH = HashingUtils::HashString("UNDOCUMENTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DOCUMENTED",
+          "UNDOCUMENTED",
+        };
 
         LocationStatusType GetLocationStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DOCUMENTED_HASH)
-          {
-            return LocationStatusType::DOCUMENTED;
-          }
-          else if (hashCode == UNDOCUMENTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LocationStatusType::UNDOCUMENTED;
+          case -329847046:
+            if (name == "DOCUMENTED")
+            {
+              return LocationStatusType::DOCUMENTED;
+            }
+            break;
+          case -671003053:
+            if (name == "UNDOCUMENTED")
+            {
+              return LocationStatusType::UNDOCUMENTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LocationStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForLocationStatusType(LocationStatusType enumValue)
+        const char* GetNameForLocationStatusTypeCStr(LocationStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LocationStatusType::DOCUMENTED:
-            return "DOCUMENTED";
-          case LocationStatusType::UNDOCUMENTED:
-            return "UNDOCUMENTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLocationStatusType(LocationStatusType enumValue)
+        {
+          return GetNameForLocationStatusTypeCStr(enumValue);
         }
 
       } // namespace LocationStatusTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace OpMapper
       {
 
-        static const int add_HASH = HashingUtils::HashString("add");
-        static const int remove_HASH = HashingUtils::HashString("remove");
-        static const int replace_HASH = HashingUtils::HashString("replace");
-        static const int move_HASH = HashingUtils::HashString("move");
-        static const int copy_HASH = HashingUtils::HashString("copy");
-        static const int test_HASH = HashingUtils::HashString("test");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "add",
+          "remove",
+          "replace",
+          "move",
+          "copy",
+          "test",
+        };
 
         Op GetOpForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == add_HASH)
-          {
-            return Op::add;
-          }
-          else if (hashCode == remove_HASH)
-          {
-            return Op::remove;
-          }
-          else if (hashCode == replace_HASH)
-          {
-            return Op::replace;
-          }
-          else if (hashCode == move_HASH)
-          {
-            return Op::move;
-          }
-          else if (hashCode == copy_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Op::copy;
-          }
-          else if (hashCode == test_HASH)
-          {
-            return Op::test;
+          case 96417:
+            if (name == "add")
+            {
+              return Op::add;
+            }
+            break;
+          case -934610812:
+            if (name == "remove")
+            {
+              return Op::remove;
+            }
+            break;
+          case 1094496948:
+            if (name == "replace")
+            {
+              return Op::replace;
+            }
+            break;
+          case 3357649:
+            if (name == "move")
+            {
+              return Op::move;
+            }
+            break;
+          case 3059573:
+            if (name == "copy")
+            {
+              return Op::copy;
+            }
+            break;
+          case 3556498:
+            if (name == "test")
+            {
+              return Op::test;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return Op::NOT_SET;
         }
 
-        Aws::String GetNameForOp(Op enumValue)
+        const char* GetNameForOpCStr(Op enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Op::add:
-            return "add";
-          case Op::remove:
-            return "remove";
-          case Op::replace:
-            return "replace";
-          case Op::move:
-            return "move";
-          case Op::copy:
-            return "copy";
-          case Op::test:
-            return "test";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOp(Op enumValue)
+        {
+          return GetNameForOpCStr(enumValue);
         }
 
       } // namespace OpMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PutModeMapper
       {
 
-        static const int merge_HASH = HashingUtils::HashString("merge");
-        static const int overwrite_HASH = HashingUtils::HashString("overwrite");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "merge",
+          "overwrite",
+        };
 
         PutMode GetPutModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == merge_HASH)
-          {
-            return PutMode::merge;
-          }
-          else if (hashCode == overwrite_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PutMode::overwrite;
+          case 103785528:
+            if (name == "merge")
+            {
+              return PutMode::merge;
+            }
+            break;
+          case -745078901:
+            if (name == "overwrite")
+            {
+              return PutMode::overwrite;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PutMode::NOT_SET;
         }
 
-        Aws::String GetNameForPutMode(PutMode enumValue)
+        const char* GetNameForPutModeCStr(PutMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PutMode::merge:
-            return "merge";
-          case PutMode::overwrite:
-            return "overwrite";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPutMode(PutMode enumValue)
+        {
+          return GetNameForPutModeCStr(enumValue);
         }
 
       } // namespace PutModeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace QuotaPeriodTypeMapper
       {
 
-        static const int DAY_HASH = HashingUtils::HashString("DAY");
-        static const int WEEK_HASH = HashingUtils::HashString("WEEK");
-        static const int MONTH_HASH = HashingUtils::HashString("MONTH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DAY",
+          "WEEK",
+          "MONTH",
+        };
 
         QuotaPeriodType GetQuotaPeriodTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DAY_HASH)
-          {
-            return QuotaPeriodType::DAY;
-          }
-          else if (hashCode == WEEK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return QuotaPeriodType::WEEK;
-          }
-          else if (hashCode == MONTH_HASH)
-          {
-            return QuotaPeriodType::MONTH;
+          case 67452:
+            if (name == "DAY")
+            {
+              return QuotaPeriodType::DAY;
+            }
+            break;
+          case 2660340:
+            if (name == "WEEK")
+            {
+              return QuotaPeriodType::WEEK;
+            }
+            break;
+          case 73542240:
+            if (name == "MONTH")
+            {
+              return QuotaPeriodType::MONTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return QuotaPeriodType::NOT_SET;
         }
 
-        Aws::String GetNameForQuotaPeriodType(QuotaPeriodType enumValue)
+        const char* GetNameForQuotaPeriodTypeCStr(QuotaPeriodType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QuotaPeriodType::DAY:
-            return "DAY";
-          case QuotaPeriodType::WEEK:
-            return "WEEK";
-          case QuotaPeriodType::MONTH:
-            return "MONTH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQuotaPeriodType(QuotaPeriodType enumValue)
+        {
+          return GetNameForQuotaPeriodTypeCStr(enumValue);
         }
 
       } // namespace QuotaPeriodTypeMapper
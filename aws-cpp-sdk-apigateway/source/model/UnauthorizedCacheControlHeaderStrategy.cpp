@@ -30,25 +30,44 @@ namespace Aws
       namespace UnauthorizedCacheControlHeaderStrategyMapper
       {
 
-        static const int FAIL_WITH_403_HASH = HashingUtils::HashString("FAIL_WITH_403");
-        static const int SUCCEED_WITH_RESPONSE_HEADER_HASH = HashingUtils::HashString("SUCCEED_WITH_RESPONSE_HEADER");
-        static const int SUCCEED_WITHOUT_RESPONSE_HEADER_HASH = HashingUtils::HashString("SUCCEED_WITHOUT_RESPONSE_HEADER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FAIL_WITH_403",
+          "SUCCEED_WITH_RESPONSE_HEADER",
+          "SUCCEED_WITHOUT_RESPONSE_HEADER",
+        };
 
         UnauthorizedCacheControlHeaderStrategy GetUnauthorizedCacheControlHeaderStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAIL_WITH_403_HASH)
-          {
-            return UnauthorizedCacheControlHeaderStrategy::FAIL_WITH_403;
-          }
-          else if (hashCode == SUCCEED_WITH_RESPONSE_HEADER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITH_RESPONSE_HEADER;
-          }
-          else if (hashCode == SUCCEED_WITHOUT_RESPONSE_HEADER_HASH)
-          {
-            return UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITHOUT_RESPONSE_HEADER;
+          case 587158079:
+            if (name == "FAIL_WITH_403")
+            {
+              return UnauthorizedCacheControlHeaderStrategy::FAIL_WITH_403;
+            }
+            break;
+          case -1094860593:
+            if (name == "SUCCEED_WITH_RESPONSE_HEADER")
+            {
+              return UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITH_RESPONSE_HEADER;
+            }
+            break;
+          case 653283223:
+            if (name == "SUCCEED_WITHOUT_RESPONSE_HEADER")
+            {
+              return UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITHOUT_RESPONSE_HEADER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return UnauthorizedCacheControlHeaderStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForUnauthorizedCacheControlHeaderStrategy(UnauthorizedCacheControlHeaderStrategy enumValue)
+        const char* GetNameForUnauthorizedCacheControlHeaderStrategyCStr(UnauthorizedCacheControlHeaderStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UnauthorizedCacheControlHeaderStrategy::FAIL_WITH_403:
-            return "FAIL_WITH_403";
-          case UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITH_RESPONSE_HEADER:
-            return "SUCCEED_WITH_RESPONSE_HEADER";
-          case UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITHOUT_RESPONSE_HEADER:
-            return "SUCCEED_WITHOUT_RESPONSE_HEADER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUnauthorizedCacheControlHeaderStrategy(UnauthorizedCacheControlHeaderStrategy enumValue)
+        {
+          return GetNameForUnauthorizedCacheControlHeaderStrategyCStr(enumValue);
         }
 
       } // namespace UnauthorizedCacheControlHeaderStrategyMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace VpcLinkStatusMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AVAILABLE",
+          "PENDING",
+          "DELETING",
+          "FAILED",
+        };
 
         VpcLinkStatus GetVpcLinkStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
-          {
-            return VpcLinkStatus::AVAILABLE;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return VpcLinkStatus::PENDING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return VpcLinkStatus::DELETING;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VpcLinkStatus::FAILED;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return VpcLinkStatus::AVAILABLE;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return VpcLinkStatus::PENDING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return VpcLinkStatus::DELETING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return VpcLinkStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return VpcLinkStatus::NOT_SET;
         }
 
-        Aws::String GetNameForVpcLinkStatus(VpcLinkStatus enumValue)
+        const char* GetNameForVpcLinkStatusCStr(VpcLinkStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VpcLinkStatus::AVAILABLE:
-            return "AVAILABLE";
-          case VpcLinkStatus::PENDING:
-            return "PENDING";
-          case VpcLinkStatus::DELETING:
-            return "DELETING";
-          case VpcLinkStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVpcLinkStatus(VpcLinkStatus enumValue)
+        {
+          return GetNameForVpcLinkStatusCStr(enumValue);
         }
 
       } // namespace VpcLinkStatusMapper
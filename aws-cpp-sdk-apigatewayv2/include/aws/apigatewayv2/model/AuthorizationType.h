@@ -36,6 +36,11 @@ namespace AuthorizationTypeMapper
 AWS_APIGATEWAYV2_API AuthorizationType GetAuthorizationTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAYV2_API Aws::String GetNameForAuthorizationType(AuthorizationType value);
+
+/**
+ * Same as GetNameForAuthorizationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAYV2_API const char* GetNameForAuthorizationTypeCStr(AuthorizationType value);
 } // namespace AuthorizationTypeMapper
 } // namespace Model
 } // namespace ApiGatewayV2
@@ -34,6 +34,11 @@ namespace AuthorizerTypeMapper
 AWS_APIGATEWAYV2_API AuthorizerType GetAuthorizerTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAYV2_API Aws::String GetNameForAuthorizerType(AuthorizerType value);
+
+/**
+ * Same as GetNameForAuthorizerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAYV2_API const char* GetNameForAuthorizerTypeCStr(AuthorizerType value);
 } // namespace AuthorizerTypeMapper
 } // namespace Model
 } // namespace ApiGatewayV2
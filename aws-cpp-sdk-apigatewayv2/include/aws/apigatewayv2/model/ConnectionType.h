@@ -35,6 +35,11 @@ namespace ConnectionTypeMapper
 AWS_APIGATEWAYV2_API ConnectionType GetConnectionTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAYV2_API Aws::String GetNameForConnectionType(ConnectionType value);
+
+/**
+ * Same as GetNameForConnectionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAYV2_API const char* GetNameForConnectionTypeCStr(ConnectionType value);
 } // namespace ConnectionTypeMapper
 } // namespace Model
 } // namespace ApiGatewayV2
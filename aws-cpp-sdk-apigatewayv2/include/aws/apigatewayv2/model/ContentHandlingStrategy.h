@@ -35,6 +35,11 @@ namespace ContentHandlingStrategyMapper
 AWS_APIGATEWAYV2_API ContentHandlingStrategy GetContentHandlingStrategyForName(const Aws::String& name);
 
 AWS_APIGATEWAYV2_API Aws::String GetNameForContentHandlingStrategy(ContentHandlingStrategy value);
+
+/**
+ * Same as GetNameForContentHandlingStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAYV2_API const char* GetNameForContentHandlingStrategyCStr(ContentHandlingStrategy value);
 } // namespace ContentHandlingStrategyMapper
 } // namespace Model
 } // namespace ApiGatewayV2
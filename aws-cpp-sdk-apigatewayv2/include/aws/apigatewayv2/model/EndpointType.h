@@ -35,6 +35,11 @@ namespace EndpointTypeMapper
 AWS_APIGATEWAYV2_API EndpointType GetEndpointTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAYV2_API Aws::String GetNameForEndpointType(EndpointType value);
+
+/**
+ * Same as GetNameForEndpointType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAYV2_API const char* GetNameForEndpointTypeCStr(EndpointType value);
 } // namespace EndpointTypeMapper
 } // namespace Model
 } // namespace ApiGatewayV2
@@ -36,6 +36,11 @@ namespace LoggingLevelMapper
 AWS_APIGATEWAYV2_API LoggingLevel GetLoggingLevelForName(const Aws::String& name);
 
 AWS_APIGATEWAYV2_API Aws::String GetNameForLoggingLevel(LoggingLevel value);
+
+/**
+ * Same as GetNameForLoggingLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAYV2_API const char* GetNameForLoggingLevelCStr(LoggingLevel value);
 } // namespace LoggingLevelMapper
 } // namespace Model
 } // namespace ApiGatewayV2
@@ -36,6 +36,11 @@ namespace PassthroughBehaviorMapper
 AWS_APIGATEWAYV2_API PassthroughBehavior GetPassthroughBehaviorForName(const Aws::String& name);
 
 AWS_APIGATEWAYV2_API Aws::String GetNameForPassthroughBehavior(PassthroughBehavior value);
+
+/**
+ * Same as GetNameForPassthroughBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAYV2_API const char* GetNameForPassthroughBehaviorCStr(PassthroughBehavior value);
 } // namespace PassthroughBehaviorMapper
 } // namespace Model
 } // namespace ApiGatewayV2
@@ -34,6 +34,11 @@ namespace ProtocolTypeMapper
 AWS_APIGATEWAYV2_API ProtocolType GetProtocolTypeForName(const Aws::String& name);
 
 AWS_APIGATEWAYV2_API Aws::String GetNameForProtocolType(ProtocolType value);
+
+/**
+ * Same as GetNameForProtocolType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APIGATEWAYV2_API const char* GetNameForProtocolTypeCStr(ProtocolType value);
 } // namespace ProtocolTypeMapper
 } // namespace Model
 } // namespace ApiGatewayV2
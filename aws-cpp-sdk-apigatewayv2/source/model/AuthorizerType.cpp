@@ -30,15 +30,30 @@ namespace Aws
       namespace AuthorizerTypeMapper
       {
 
-        static const int REQUEST_HASH = HashingUtils::HashString("REQUEST");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REQUEST",
+        };
 
         AuthorizerType GetAuthorizerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REQUEST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthorizerType::REQUEST;
+          case 1813675631:
+            if (name == "REQUEST")
+            {
+              return AuthorizerType::REQUEST;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return AuthorizerType::NOT_SET;
         }
 
-        Aws::String GetNameForAuthorizerType(AuthorizerType enumValue)
+        const char* GetNameForAuthorizerTypeCStr(AuthorizerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthorizerType::REQUEST:
-            return "REQUEST";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthorizerType(AuthorizerType enumValue)
+        {
+          return GetNameForAuthorizerTypeCStr(enumValue);
         }
 
       } // namespace AuthorizerTypeMapper
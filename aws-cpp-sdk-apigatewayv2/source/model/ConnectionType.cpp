@@ -30,20 +30,37 @@ namespace Aws
       namespace ConnectionTypeMapper
       {
 
-        static const int INTERNET_HASH = HashingUtils::HashString("INTERNET");
-        static const int VPC_LINK_HASH = HashingUtils::HashString("VPC_LINK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INTERNET",
+          "VPC_LINK",
+        };
 
         ConnectionType GetConnectionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNET_HASH)
-          {
-            return ConnectionType::INTERNET;
-          }
-          else if (hashCode == VPC_LINK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectionType::VPC_LINK;
+          case 1353037633:
+            if (name == "INTERNET")
+            {
+              return ConnectionType::INTERNET;
+            }
+            break;
+          case -448091728:
+            if (name == "VPC_LINK")
+            {
+              return ConnectionType::VPC_LINK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ConnectionType::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionType(ConnectionType enumValue)
+        const char* GetNameForConnectionTypeCStr(ConnectionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectionType::INTERNET:
-            return "INTERNET";
-          case ConnectionType::VPC_LINK:
-            return "VPC_LINK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectionType(ConnectionType enumValue)
+        {
+          return GetNameForConnectionTypeCStr(enumValue);
         }
 
       } // namespace ConnectionTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DeploymentStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int DEPLOYED_HASH = HashingUtils::HashString("DEPLOYED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "FAILED",
+          "DEPLOYED",
+        };
 
         DeploymentStatus GetDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return DeploymentStatus::PENDING;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentStatus::FAILED;
-          }
-          else if (hashCode == DEPLOYED_HASH)
-          {
-            return DeploymentStatus::DEPLOYED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return DeploymentStatus::PENDING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return DeploymentStatus::FAILED;
+            }
+            break;
+          case 1723191238:
+            if (name == "DEPLOYED")
+            {
+              return DeploymentStatus::DEPLOYED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DeploymentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentStatus(DeploymentStatus enumValue)
+        const char* GetNameForDeploymentStatusCStr(DeploymentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentStatus::PENDING:
-            return "PENDING";
-          case DeploymentStatus::FAILED:
-            return "FAILED";
-          case DeploymentStatus::DEPLOYED:
-            return "DEPLOYED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentStatus(DeploymentStatus enumValue)
+        {
+          return GetNameForDeploymentStatusCStr(enumValue);
         }
 
       } // namespace DeploymentStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace EndpointTypeMapper
       {
 
-        static const int REGIONAL_HASH = HashingUtils::HashString("REGIONAL");
-        static const int EDGE_HASH = HashingUtils::HashString("EDGE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REGIONAL",
+          "EDGE",
+        };
 
         EndpointType GetEndpointTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGIONAL_HASH)
-          {
-            return EndpointType::REGIONAL;
-          }
-          else if (hashCode == EDGE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EndpointType::EDGE;
+          case 92288543:
+            if (name == "REGIONAL")
+            {
+              return EndpointType::REGIONAL;
+            }
+            break;
+          case 2123197:
+            if (name == "EDGE")
+            {
+              return EndpointType::EDGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EndpointType::NOT_SET;
         }
 
-        Aws::String GetNameForEndpointType(EndpointType enumValue)
+        const char* GetNameForEndpointTypeCStr(EndpointType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EndpointType::REGIONAL:
-            return "REGIONAL";
-          case EndpointType::EDGE:
-            return "EDGE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEndpointType(EndpointType enumValue)
+        {
+          return GetNameForEndpointTypeCStr(enumValue);
         }
 
       } // namespace EndpointTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace IntegrationTypeMapper
       {
 
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-        static const int MOCK_HASH = HashingUtils::HashString("MOCK");
-        static const int HTTP_PROXY_HASH = HashingUtils::HashString("HTTP_PROXY");
-        static const int AWS_PROXY_HASH = HashingUtils::HashString("AWS_PROXY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AWS",
+          "HTTP",
+          "MOCK",
+          "HTTP_PROXY",
+          "AWS_PROXY",
+        };
 
         IntegrationType GetIntegrationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IntegrationType::AWS;
-          }
-          else if (hashCode == HTTP_HASH)
-          {
-            return IntegrationType::HTTP;
-          }
-          else if (hashCode == MOCK_HASH)
-          {
-            return IntegrationType::MOCK;
-          }
-          else if (hashCode == HTTP_PROXY_HASH)
-          {
-            return IntegrationType::HTTP_PROXY;
-          }
-          else if (hashCode == AWS_PROXY_HASH)
-          {
-            return IntegrationType::AWS_PROXY;
+          case 65245:
+            if (name == "AWS")
+            {
+              return IntegrationType::AWS;
+            }
+            break;
+          case 2228360:
+            if (name == "HTTP")
+            {
+              return IntegrationType::HTTP;
+            }
+            break;
+          case 2371978:
+            if (name == "MOCK")
+            {
+              return IntegrationType::MOCK;
+            }
+            break;
+          case -1617186857:
+            if (name == "HTTP_PROXY")
+            {
+              return IntegrationType::HTTP_PROXY;
+            }
+            break;
+          case -1070212500:
+            if (name == "AWS_PROXY")
+            {
+              return IntegrationType::AWS_PROXY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return IntegrationType::NOT_SET;
         }
 
-        Aws::String GetNameForIntegrationType(IntegrationType enumValue)
+        const char* GetNameForIntegrationTypeCStr(IntegrationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IntegrationType::AWS:
-            return "AWS";
-          case IntegrationType::HTTP:
-            return "HTTP";
-          case IntegrationType::MOCK:
-            return "MOCK";
-          case IntegrationType::HTTP_PROXY:
-            return "HTTP_PROXY";
-          case IntegrationType::AWS_PROXY:
-            return "AWS_PROXY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIntegrationType(IntegrationType enumValue)
+        {
+          return GetNameForIntegrationTypeCStr(enumValue);
         }
 
       } // namespace IntegrationTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace LoggingLevelMapper
       {
 
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int false__HASH = HashingUtils::HashString("false");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ERROR",
+          "INFO",
+          "false",
+        };
 
         LoggingLevel GetLoggingLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ERROR__HASH)
-          {
-            return LoggingLevel::ERROR_;
-          }
-          else if (hashCode == INFO_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoggingLevel::INFO;
-          }
-          else if (hashCode == false__HASH)
-          {
-            return LoggingLevel::false_;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return LoggingLevel::ERROR_;
+            }
+            break;
+          case 2251950:
+            if (name == "INFO")
+            {
+              return LoggingLevel::INFO;
+            }
+            break;
+          case 97196323:
+            if (name == "false")
+            {
+              return LoggingLevel::false_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return LoggingLevel::NOT_SET;
         }
 
-        Aws::String GetNameForLoggingLevel(LoggingLevel enumValue)
+        const char* GetNameForLoggingLevelCStr(LoggingLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoggingLevel::ERROR_:
-            return "ERROR";
-          case LoggingLevel::INFO:
-            return "INFO";
-          case LoggingLevel::false_:
-            return "false";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoggingLevel(LoggingLevel enumValue)
+        {
+          return GetNameForLoggingLevelCStr(enumValue);
         }
 
       } // namespace LoggingLevelMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PassthroughBehaviorMapper
       {
 
-        static const int WHEN_NO_MATCH_HASH = HashingUtils::HashString("WHEN_NO_MATCH");
-        static const int NEVER_HASH = HashingUtils::HashString("NEVER");
-        static const int WHEN_NO_TEMPLATES_HASH = HashingUtils::HashString("WHEN_NO_TEMPLATES");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WHEN_NO_MATCH",
+          "NEVER",
+          "WHEN_NO_TEMPLATES",
+        };
 
         PassthroughBehavior GetPassthroughBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WHEN_NO_MATCH_HASH)
-          {
-            return PassthroughBehavior::WHEN_NO_MATCH;
-          }
-          else if (hashCode == NEVER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PassthroughBehavior::NEVER;
-          }
-          else if (hashCode == WHEN_NO_TEMPLATES_HASH)
-          {
-            return PassthroughBehavior::WHEN_NO_TEMPLATES;
+          case 1846003980:
+            if (name == "WHEN_NO_MATCH")
+            {
+              return PassthroughBehavior::WHEN_NO_MATCH;
+            }
+            break;
+          case 74175084:
+            if (name == "NEVER")
+            {
+              return PassthroughBehavior::NEVER;
+            }
+            break;
+          case 1967304448:
+            if (name == "WHEN_NO_TEMPLATES")
+            {
+              return PassthroughBehavior::WHEN_NO_TEMPLATES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PassthroughBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForPassthroughBehavior(PassthroughBehavior enumValue)
+        const char* GetNameForPassthroughBehaviorCStr(PassthroughBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PassthroughBehavior::WHEN_NO_MATCH:
-            return "WHEN_NO_MATCH";
-          case PassthroughBehavior::NEVER:
-            return "NEVER";
-          case PassthroughBehavior::WHEN_NO_TEMPLATES:
-            return "WHEN_NO_TEMPLATES";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPassthroughBehavior(PassthroughBehavior enumValue)
+        {
+          return GetNameForPassthroughBehaviorCStr(enumValue);
         }
 
       } // namespace PassthroughBehaviorMapper
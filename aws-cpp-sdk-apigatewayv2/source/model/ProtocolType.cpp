@@ -30,15 +30,30 @@ namespace Aws
       namespace ProtocolTypeMapper
       {
 
-        static const int WEBSOCKET_HASH = HashingUtils::HashString("WEBSOCKET");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WEBSOCKET",
+        };
 
         ProtocolType GetProtocolTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WEBSOCKET_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProtocolType::WEBSOCKET;
+          case -1737938009:
+            if (name == "WEBSOCKET")
+            {
+              return ProtocolType::WEBSOCKET;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ProtocolType::NOT_SET;
         }
 
-        Aws::String GetNameForProtocolType(ProtocolType enumValue)
+        const char* GetNameForProtocolTypeCStr(ProtocolType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProtocolType::WEBSOCKET:
-            return "WEBSOCKET";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProtocolType(ProtocolType enumValue)
+        {
+          return GetNameForProtocolTypeCStr(enumValue);
         }
 
       } // namespace ProtocolTypeMapper
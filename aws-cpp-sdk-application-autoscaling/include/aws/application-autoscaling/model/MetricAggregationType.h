@@ -36,6 +36,11 @@ namespace MetricAggregationTypeMapper
 AWS_APPLICATIONAUTOSCALING_API MetricAggregationType GetMetricAggregationTypeForName(const Aws::String& name);
 
 AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForMetricAggregationType(MetricAggregationType value);
+
+/**
+ * Same as GetNameForMetricAggregationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForMetricAggregationTypeCStr(MetricAggregationType value);
 } // namespace MetricAggregationTypeMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
@@ -44,6 +44,11 @@ namespace ScalableDimensionMapper
 AWS_APPLICATIONAUTOSCALING_API ScalableDimension GetScalableDimensionForName(const Aws::String& name);
 
 AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForScalableDimension(ScalableDimension value);
+
+/**
+ * Same as GetNameForScalableDimension(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForScalableDimensionCStr(ScalableDimension value);
 } // namespace ScalableDimensionMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
@@ -39,6 +39,11 @@ namespace ScalingActivityStatusCodeMapper
 AWS_APPLICATIONAUTOSCALING_API ScalingActivityStatusCode GetScalingActivityStatusCodeForName(const Aws::String& name);
 
 AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForScalingActivityStatusCode(ScalingActivityStatusCode value);
+
+/**
+ * Same as GetNameForScalingActivityStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForScalingActivityStatusCodeCStr(ScalingActivityStatusCode value);
 } // namespace ScalingActivityStatusCodeMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
@@ -41,6 +41,11 @@ namespace ServiceNamespaceMapper
 AWS_APPLICATIONAUTOSCALING_API ServiceNamespace GetServiceNamespaceForName(const Aws::String& name);
 
 AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForServiceNamespace(ServiceNamespace value);
+
+/**
+ * Same as GetNameForServiceNamespace(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForServiceNamespaceCStr(ServiceNamespace value);
 } // namespace ServiceNamespaceMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
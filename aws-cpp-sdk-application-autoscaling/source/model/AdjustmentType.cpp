@@ -30,25 +30,44 @@ namespace Aws
       namespace AdjustmentTypeMapper
       {
 
-        static const int ChangeInCapacity_HASH = HashingUtils::HashString("ChangeInCapacity");
-        static const int PercentChangeInCapacity_HASH = HashingUtils::HashString("PercentChangeInCapacity");
-        static const int ExactCapacity_HASH = HashingUtils::HashString("ExactCapacity");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ChangeInCapacity",
+          "PercentChangeInCapacity",
+          "ExactCapacity",
+        };
 
         AdjustmentType GetAdjustmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ChangeInCapacity_HASH)
-          {
-            return AdjustmentType::ChangeInCapacity;
-          }
-          else if (hashCode == PercentChangeInCapacity_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AdjustmentType::PercentChangeInCapacity;
-          }
-          else if (hashCode == ExactCapacity_HASH)
-          {
-            return AdjustmentType::ExactCapacity;
+          case -796727057:
+            if (name == "ChangeInCapacity")
+            {
+              return AdjustmentType::ChangeInCapacity;
+            }
+            break;
+          case 1784216340:
+            if (name == "PercentChangeInCapacity")
+            {
+              return AdjustmentType::PercentChangeInCapacity;
+            }
+            break;
+          case -160004935:
+            if (name == "ExactCapacity")
+            {
+              return AdjustmentType::ExactCapacity;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AdjustmentType::NOT_SET;
         }
 
-        Aws::String GetNameForAdjustmentType(AdjustmentType enumValue)
+        const char* GetNameForAdjustmentTypeCStr(AdjustmentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AdjustmentType::ChangeInCapacity:
-            return "ChangeInCapacity";
-          case AdjustmentType::PercentChangeInCapacity:
-            return "PercentChangeInCapacity";
-          case AdjustmentType::ExactCapacity:
-            return "ExactCapacity";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAdjustmentType(AdjustmentType enumValue)
+        {
+          return GetNameForAdjustmentTypeCStr(enumValue);
         }
 
       } // namespace AdjustmentTypeMapper
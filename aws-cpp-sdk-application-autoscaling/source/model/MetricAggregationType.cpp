@@ -30,25 +30,44 @@ namespace Aws
       namespace MetricAggregationTypeMapper
       {
 
-        static const int Average_HASH = HashingUtils::HashString("Average");
-        static const int Minimum_HASH = HashingUtils::HashString("Minimum");
-        static const int Maximum_HASH = HashingUtils::HashString("Maximum");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Average",
+          "Minimum",
+          "Maximum",
+        };
 
         MetricAggregationType GetMetricAggregationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Average_HASH)
-          {
-            return MetricAggregationType::Average;
-          }
-          else if (hashCode == Minimum_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MetricAggregationType::Minimum;
-          }
-          else if (hashCode == Maximum_HASH)
-          {
-            return MetricAggregationType::Maximum;
+          case 1033205245:
+            if (name == "Average")
+            {
+              return MetricAggregationType::Average;
+            }
+            break;
+          case -1565775890:
+            if (name == "Minimum")
+            {
+              return MetricAggregationType::Minimum;
+            }
+            break;
+          case -1785573888:
+            if (name == "Maximum")
+            {
+              return MetricAggregationType::Maximum;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return MetricAggregationType::NOT_SET;
         }
 
-        Aws::String GetNameForMetricAggregationType(MetricAggregationType enumValue)
+        const char* GetNameForMetricAggregationTypeCStr(MetricAggregationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MetricAggregationType::Average:
-            return "Average";
-          case MetricAggregationType::Minimum:
-            return "Minimum";
-          case MetricAggregationType::Maximum:
-            return "Maximum";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMetricAggregationType(MetricAggregationType enumValue)
+        {
+          return GetNameForMetricAggregationTypeCStr(enumValue);
         }
 
       } // namespace MetricAggregationTypeMapper
@@ -30,65 +30,100 @@ namespace Aws
       namespace MetricTypeMapper
       {
 
-        static const int DynamoDBReadCapacityUtilization_HASH = HashingUtils::HashString("DynamoDBReadCapacityUtilization");
-        static const int DynamoDBWriteCapacityUtilization_HASH = HashingUtils::HashString("DynamoDBWriteCapacityUtilization");
-        static const int ALBRequestCountPerTarget_HASH = HashingUtils::HashString("ALBRequestCountPerTarget");
-        static const int RDSReaderAverageCPUUtilization_HASH = HashingUtils::HashString("RDSReaderAverageCPUUtilization");
-        static const int RDSReaderAverageDatabaseConnections_HASH = HashingUtils::HashString("RDSReaderAverageDatabaseConnections");
-        static const int EC2SpotFleetRequestAverageCPUUtilization_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageCPUUtilization");
-        static const int EC2SpotFleetRequestAverageNetworkIn_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageNetworkIn");
-        static const int EC2SpotFleetRequestAverageNetworkOut_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageNetworkOut");
-        static const int SageMakerVariantInvocationsPerInstance_HASH = HashingUtils::HashString("SageMakerVariantInvocationsPerInstance");
-        static const int ECSServiceAverageCPUUtilization_HASH = HashingUtils::HashString("ECSServiceAverageCPUUtilization");
-        static const int ECSServiceAverageMemoryUtilization_HASH = HashingUtils::HashString("ECSServiceAverageMemoryUtilization");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DynamoDBReadCapacityUtilization",
+          "DynamoDBWriteCapacityUtilization",
+          "ALBRequestCountPerTarget",
+          "RDSReaderAverageCPUUtilization",
+          "RDSReaderAverageDatabaseConnections",
+          "EC2SpotFleetRequestAverageCPUUtilization",
+          "EC2SpotFleetRequestAverageNetworkIn",
+          "EC2SpotFleetRequestAverageNetworkOut",
+          "SageMakerVariantInvocationsPerInstance",
+          "ECSServiceAverageCPUUtilization",
+          "ECSServiceAverageMemoryUtilization",
+        };
 
         MetricType GetMetricTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DynamoDBReadCapacityUtilization_HASH)
-          {
-            return MetricType::DynamoDBReadCapacityUtilization;
-          }
-          else if (hashCode == DynamoDBWriteCapacityUtilization_HASH)
-          {
-            return MetricType::DynamoDBWriteCapacityUtilization;
-          }
-          else if (hashCode == ALBRequestCountPerTarget_HASH)
-          {
-            return MetricType::ALBRequestCountPerTarget;
-          }
-          else if (hashCode == RDSReaderAverageCPUUtilization_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MetricType::RDSReaderAverageCPUUtilization;
-          }
-          else if (hashCode == RDSReaderAverageDatabaseConnections_HASH)
-          {
-            return MetricType::RDSReaderAverageDatabaseConnections;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageCPUUtilization_HASH)
-          {
-            return MetricType::EC2SpotFleetRequestAverageCPUUtilization;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageNetworkIn_HASH)
-          {
-            return MetricType::EC2SpotFleetRequestAverageNetworkIn;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageNetworkOut_HASH)
-          {
-            return MetricType::EC2SpotFleetRequestAverageNetworkOut;
-          }
-          else if (hashCode == SageMakerVariantInvocationsPerInstance_HASH)
-          {
-            return MetricType::SageMakerVariantInvocationsPerInstance;
-          }
-          else if (hashCode == ECSServiceAverageCPUUtilization_HASH)
-          {
-            return MetricType::ECSServiceAverageCPUUtilization;
-          }
-          else if (hashCode == ECSServiceAverageMemoryUtilization_HASH)
-          {
-            return MetricType::ECSServiceAverageMemoryUtilization;
+          case -1193972822:
+            if (name == "DynamoDBReadCapacityUtilization")
+            {
+              return MetricType::DynamoDBReadCapacityUtilization;
+            }
+            break;
+          case 1632739729:
+            if (name == "DynamoDBWriteCapacityUtilization")
+            {
+              return MetricType::DynamoDBWriteCapacityUtilization;
+            }
+            break;
+          case -947560457:
+            if (name == "ALBRequestCountPerTarget")
+            {
+              return MetricType::ALBRequestCountPerTarget;
+            }
+            break;
+          case -105772877:
+            if (name == "RDSReaderAverageCPUUtilization")
+            {
+              return MetricType::RDSReaderAverageCPUUtilization;
+            }
+            break;
+          case 645492513:
+            if (name == "RDSReaderAverageDatabaseConnections")
+            {
+              return MetricType::RDSReaderAverageDatabaseConnections;
+            }
+            break;
+          case 1384183840:
+            if (name == "EC2SpotFleetRequestAverageCPUUtilization")
+            {
+              return MetricType::EC2SpotFleetRequestAverageCPUUtilization;
+            }
+            break;
+          case 568095597:
+            if (name == "EC2SpotFleetRequestAverageNetworkIn")
+            {
+              return MetricType::EC2SpotFleetRequestAverageNetworkIn;
+            }
+            break;
+          case 431100422:
+            if (name == "EC2SpotFleetRequestAverageNetworkOut")
+            {
+              return MetricType::EC2SpotFleetRequestAverageNetworkOut;
+            }
+            break;
+          case -1701661476:
+            if (name == "SageMakerVariantInvocationsPerInstance")
+            {
+              return MetricType::SageMakerVariantInvocationsPerInstance;
+            }
+            break;
+          case -1310835401:
+            if (name == "ECSServiceAverageCPUUtilization")
+            {
+              return MetricType::ECSServiceAverageCPUUtilization;
+            }
+            break;
+          case -350849180:
+            if (name == "ECSServiceAverageMemoryUtilization")
+            {
+              return MetricType::ECSServiceAverageMemoryUtilization;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return MetricType::NOT_SET;
         }
 
-        Aws::String GetNameForMetricType(MetricType enumValue)
+        const char* GetNameForMetricTypeCStr(MetricType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MetricType::DynamoDBReadCapacityUtilization:
-            return "DynamoDBReadCapacityUtilization";
-          case MetricType::DynamoDBWriteCapacityUtilization:
-            return "DynamoDBWriteCapacityUtilization";
-          case MetricType::ALBRequestCountPerTarget:
-            return "ALBRequestCountPerTarget";
-          case MetricType::RDSReaderAverageCPUUtilization:
-            return "RDSReaderAverageCPUUtilization";
-          case MetricType::RDSReaderAverageDatabaseConnections:
-            return "RDSReaderAverageDatabaseConnections";
-          case MetricType::EC2SpotFleetRequestAverageCPUUtilization:
-            return "EC2SpotFleetRequestAverageCPUUtilization";
-          case MetricType::EC2SpotFleetRequestAverageNetworkIn:
-            return "EC2SpotFleetRequestAverageNetworkIn";
-          case MetricType::EC2SpotFleetRequestAverageNetworkOut:
-            return "EC2SpotFleetRequestAverageNetworkOut";
-          case MetricType::SageMakerVariantInvocationsPerInstance:
-            return "SageMakerVariantInvocationsPerInstance";
-          case MetricType::ECSServiceAverageCPUUtilization:
-            return "ECSServiceAverageCPUUtilization";
-          case MetricType::ECSServiceAverageMemoryUtilization:
-            return "ECSServiceAverageMemoryUtilization";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMetricType(MetricType enumValue)
+        {
+          return GetNameForMetricTypeCStr(enumValue);
         }
 
       } // namespace MetricTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace ScalingActivityStatusCodeMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Successful_HASH = HashingUtils::HashString("Successful");
-        static const int Overridden_HASH = HashingUtils::HashString("Overridden");
-        static const int Unfulfilled_HASH = HashingUtils::HashString("Unfulfilled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "InProgress",
+          "Successful",
+          "Overridden",
+          "Unfulfilled",
+          "Failed",
+        };
 
         ScalingActivityStatusCode GetScalingActivityStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return ScalingActivityStatusCode::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return ScalingActivityStatusCode::InProgress;
-          }
-          else if (hashCode == Successful_HASH)
-          {
-            return ScalingActivityStatusCode::Successful;
-          }
-          else if (hashCode == Overridden_HASH)
-          {
-            return ScalingActivityStatusCode::Overridden;
-          }
-          else if (hashCode == Unfulfilled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalingActivityStatusCode::Unfulfilled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ScalingActivityStatusCode::Failed;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return ScalingActivityStatusCode::Pending;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return ScalingActivityStatusCode::InProgress;
+            }
+            break;
+          case 1259833018:
+            if (name == "Successful")
+            {
+              return ScalingActivityStatusCode::Successful;
+            }
+            break;
+          case 219233748:
+            if (name == "Overridden")
+            {
+              return ScalingActivityStatusCode::Overridden;
+            }
+            break;
+          case -103457146:
+            if (name == "Unfulfilled")
+            {
+              return ScalingActivityStatusCode::Unfulfilled;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return ScalingActivityStatusCode::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ScalingActivityStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForScalingActivityStatusCode(ScalingActivityStatusCode enumValue)
+        const char* GetNameForScalingActivityStatusCodeCStr(ScalingActivityStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalingActivityStatusCode::Pending:
-            return "Pending";
-          case ScalingActivityStatusCode::InProgress:
-            return "InProgress";
-          case ScalingActivityStatusCode::Successful:
-            return "Successful";
-          case ScalingActivityStatusCode::Overridden:
-            return "Overridden";
-          case ScalingActivityStatusCode::Unfulfilled:
-            return "Unfulfilled";
-          case ScalingActivityStatusCode::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalingActivityStatusCode(ScalingActivityStatusCode enumValue)
+        {
+          return GetNameForScalingActivityStatusCodeCStr(enumValue);
         }
 
       } // namespace ScalingActivityStatusCodeMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace ServiceNamespaceMapper
       {
 
-        static const int ecs_HASH = HashingUtils::HashString("ecs");
-        static const int elasticmapreduce_HASH = HashingUtils::HashString("elasticmapreduce");
-        static const int ec2_HASH = HashingUtils::HashString("ec2");
-        static const int appstream_HASH = HashingUtils::HashString("appstream");
-        static const int dynamodb_HASH = HashingUtils::HashString("dynamodb");
-        static const int rds_HASH = HashingUtils::HashString("rds");
-        static const int sagemaker_HASH = HashingUtils::HashString("sagemaker");
-        static const int custom_resource_HASH = HashingUtils::HashString("custom-resource");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ecs",
+          "elasticmapreduce",
+          "ec2",
+          "appstream",
+          "dynamodb",
+          "rds",
+          "sagemaker",
+          "custom-resource",
+        };
 
         ServiceNamespace GetServiceNamespaceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ecs_HASH)
-          {
-            return ServiceNamespace::ecs;
-          }
-          else if (hashCode == elasticmapreduce_HASH)
-          {
-            return ServiceNamespace::elasticmapreduce;
-          }
-          else if (hashCode == ec2_HASH)
-          {
-            return ServiceNamespace::ec2;
-          }
-          else if (hashCode == appstream_HASH)
-          {
-            return ServiceNamespace::appstream;
-          }
-          else if (hashCode == dynamodb_HASH)
-          {
-            return ServiceNamespace::dynamodb;
-          }
-          else if (hashCode == rds_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServiceNamespace::rds;
-          }
-          else if (hashCode == sagemaker_HASH)
-          {
-            return ServiceNamespace::sagemaker;
-          }
-          else if (hashCode == custom_resource_HASH)
-          {
-            return ServiceNamespace::custom_resource;
+          case 100245:
+            if (name == "ecs")
+            {
+              return ServiceNamespace::ecs;
+            }
+            break;
+          case 304861837:
+            if (name == "elasticmapreduce")
+            {
+              return ServiceNamespace::elasticmapreduce;
+            }
+            break;
+          case 100180:
+            if (name == "ec2")
+            {
+              return ServiceNamespace::ec2;
+            }
+            break;
+          case -1878987551:
+            if (name == "appstream")
+            {
+              return ServiceNamespace::appstream;
+            }
+            break;
+          case 1443282600:
+            if (name == "dynamodb")
+            {
+              return ServiceNamespace::dynamodb;
+            }
+            break;
+          case 112769:
+            if (name == "rds")
+            {
+              return ServiceNamespace::rds;
+            }
+            break;
+          case -231152616:
+            if (name == "sagemaker")
+            {
+              return ServiceNamespace::sagemaker;
+            }
+            break;
+          case 699665130:
+            if (name == "custom-resource")
+            {
+              return ServiceNamespace::custom_resource;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return ServiceNamespace::NOT_SET;
         }
 
-        Aws::String GetNameForServiceNamespace(ServiceNamespace enumValue)
+        const char* GetNameForServiceNamespaceCStr(ServiceNamespace enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServiceNamespace::ecs:
-            return "ecs";
-          case ServiceNamespace::elasticmapreduce:
-            return "elasticmapreduce";
-          case ServiceNamespace::ec2:
-            return "ec2";
-          case ServiceNamespace::appstream:
-            return "appstream";
-          case ServiceNamespace::dynamodb:
-            return "dynamodb";
-          case ServiceNamespace::rds:
-            return "rds";
-          case ServiceNamespace::sagemaker:
-            return "sagemaker";
-          case ServiceNamespace::custom_resource:
-            return "custom-resource";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServiceNamespace(ServiceNamespace enumValue)
+        {
+          return GetNameForServiceNamespaceCStr(enumValue);
         }
 
       } // namespace ServiceNamespaceMapper
@@ -36,6 +36,11 @@ namespace MeshStatusCodeMapper
 AWS_APPMESH_API MeshStatusCode GetMeshStatusCodeForName(const Aws::String& name);
 
 AWS_APPMESH_API Aws::String GetNameForMeshStatusCode(MeshStatusCode value);
+
+/**
+ * Same as GetNameForMeshStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPMESH_API const char* GetNameForMeshStatusCodeCStr(MeshStatusCode value);
 } // namespace MeshStatusCodeMapper
 } // namespace Model
 } // namespace AppMesh
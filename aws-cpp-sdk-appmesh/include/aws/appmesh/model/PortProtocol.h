@@ -35,6 +35,11 @@ namespace PortProtocolMapper
 AWS_APPMESH_API PortProtocol GetPortProtocolForName(const Aws::String& name);
 
 AWS_APPMESH_API Aws::String GetNameForPortProtocol(PortProtocol value);
+
+/**
+ * Same as GetNameForPortProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPMESH_API const char* GetNameForPortProtocolCStr(PortProtocol value);
 } // namespace PortProtocolMapper
 } // namespace Model
 } // namespace AppMesh
@@ -36,6 +36,11 @@ namespace RouteStatusCodeMapper
 AWS_APPMESH_API RouteStatusCode GetRouteStatusCodeForName(const Aws::String& name);
 
 AWS_APPMESH_API Aws::String GetNameForRouteStatusCode(RouteStatusCode value);
+
+/**
+ * Same as GetNameForRouteStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPMESH_API const char* GetNameForRouteStatusCodeCStr(RouteStatusCode value);
 } // namespace RouteStatusCodeMapper
 } // namespace Model
 } // namespace AppMesh
@@ -36,6 +36,11 @@ namespace VirtualNodeStatusCodeMapper
 AWS_APPMESH_API VirtualNodeStatusCode GetVirtualNodeStatusCodeForName(const Aws::String& name);
 
 AWS_APPMESH_API Aws::String GetNameForVirtualNodeStatusCode(VirtualNodeStatusCode value);
+
+/**
+ * Same as GetNameForVirtualNodeStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPMESH_API const char* GetNameForVirtualNodeStatusCodeCStr(VirtualNodeStatusCode value);
 } // namespace VirtualNodeStatusCodeMapper
 } // namespace Model
 } // namespace AppMesh
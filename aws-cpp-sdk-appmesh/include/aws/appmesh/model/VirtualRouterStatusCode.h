@@ -36,6 +36,11 @@ namespace VirtualRouterStatusCodeMapper
 AWS_APPMESH_API VirtualRouterStatusCode GetVirtualRouterStatusCodeForName(const Aws::String& name);
 
 AWS_APPMESH_API Aws::String GetNameForVirtualRouterStatusCode(VirtualRouterStatusCode value);
+
+/**
+ * Same as GetNameForVirtualRouterStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPMESH_API const char* GetNameForVirtualRouterStatusCodeCStr(VirtualRouterStatusCode value);
 } // namespace VirtualRouterStatusCodeMapper
 } // namespace Model
 } // namespace AppMesh
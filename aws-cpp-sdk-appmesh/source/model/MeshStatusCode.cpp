@@ -30,25 +30,44 @@ namespace Aws
       namespace MeshStatusCodeMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "DELETED",
+          "INACTIVE",
+        };
 
         MeshStatusCode GetMeshStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return MeshStatusCode::ACTIVE;
-          }
-          else if (hashCode == DELETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MeshStatusCode::DELETED;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return MeshStatusCode::INACTIVE;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return MeshStatusCode::ACTIVE;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return MeshStatusCode::DELETED;
+            }
+            break;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return MeshStatusCode::INACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return MeshStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForMeshStatusCode(MeshStatusCode enumValue)
+        const char* GetNameForMeshStatusCodeCStr(MeshStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MeshStatusCode::ACTIVE:
-            return "ACTIVE";
-          case MeshStatusCode::DELETED:
-            return "DELETED";
-          case MeshStatusCode::INACTIVE:
-            return "INACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMeshStatusCode(MeshStatusCode enumValue)
+        {
+          return GetNameForMeshStatusCodeCStr(enumValue);
         }
 
       } // namespace MeshStatusCodeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PortProtocolMapper
       {
 
-        static const int http_HASH = HashingUtils::HashString("http");
-        static const int tcp_HASH = HashingUtils::HashString("tcp");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "http",
+          "tcp",
+        };
 
         PortProtocol GetPortProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == http_HASH)
-          {
-            return PortProtocol::http;
-          }
-          else if (hashCode == tcp_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PortProtocol::tcp;
+          case 3213448:
+            if (name == "http")
+            {
+              return PortProtocol::http;
+            }
+            break;
+          case 114657:
+            if (name == "tcp")
+            {
+              return PortProtocol::tcp;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PortProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForPortProtocol(PortProtocol enumValue)
+        const char* GetNameForPortProtocolCStr(PortProtocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PortProtocol::http:
-            return "http";
-          case PortProtocol::tcp:
-            return "tcp";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPortProtocol(PortProtocol enumValue)
+        {
+          return GetNameForPortProtocolCStr(enumValue);
         }
 
       } // namespace PortProtocolMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace VirtualNodeStatusCodeMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "DELETED",
+          "INACTIVE",
+        };
 
         VirtualNodeStatusCode GetVirtualNodeStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return VirtualNodeStatusCode::ACTIVE;
-          }
-          else if (hashCode == DELETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VirtualNodeStatusCode::DELETED;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return VirtualNodeStatusCode::INACTIVE;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return VirtualNodeStatusCode::ACTIVE;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return VirtualNodeStatusCode::DELETED;
+            }
+            break;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return VirtualNodeStatusCode::INACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return VirtualNodeStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForVirtualNodeStatusCode(VirtualNodeStatusCode enumValue)
+        const char* GetNameForVirtualNodeStatusCodeCStr(VirtualNodeStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VirtualNodeStatusCode::ACTIVE:
-            return "ACTIVE";
-          case VirtualNodeStatusCode::DELETED:
-            return "DELETED";
-          case VirtualNodeStatusCode::INACTIVE:
-            return "INACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVirtualNodeStatusCode(VirtualNodeStatusCode enumValue)
+        {
+          return GetNameForVirtualNodeStatusCodeCStr(enumValue);
         }
 
       } // namespace VirtualNodeStatusCodeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace VirtualRouterStatusCodeMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "DELETED",
+          "INACTIVE",
+        };
 
         VirtualRouterStatusCode GetVirtualRouterStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return VirtualRouterStatusCode::ACTIVE;
-          }
-          else if (hashCode == DELETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VirtualRouterStatusCode::DELETED;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return VirtualRouterStatusCode::INACTIVE;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return VirtualRouterStatusCode::ACTIVE;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return VirtualRouterStatusCode::DELETED;
+            }
+            break;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return VirtualRouterStatusCode::INACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return VirtualRouterStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForVirtualRouterStatusCode(VirtualRouterStatusCode enumValue)
+        const char* GetNameForVirtualRouterStatusCodeCStr(VirtualRouterStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VirtualRouterStatusCode::ACTIVE:
-            return "ACTIVE";
-          case VirtualRouterStatusCode::DELETED:
-            return "DELETED";
-          case VirtualRouterStatusCode::INACTIVE:
-            return "INACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVirtualRouterStatusCode(VirtualRouterStatusCode enumValue)
+        {
+          return GetNameForVirtualRouterStatusCodeCStr(enumValue);
         }
 
       } // namespace VirtualRouterStatusCodeMapper
@@ -38,6 +38,11 @@ namespace ActionMapper
 AWS_APPSTREAM_API Action GetActionForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForAction(Action value);
+
+/**
+ * Same as GetNameForAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForActionCStr(Action value);
 } // namespace ActionMapper
 } // namespace Model
 } // namespace AppStream
@@ -36,6 +36,11 @@ namespace FleetAttributeMapper
 AWS_APPSTREAM_API FleetAttribute GetFleetAttributeForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForFleetAttribute(FleetAttribute value);
+
+/**
+ * Same as GetNameForFleetAttribute(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForFleetAttributeCStr(FleetAttribute value);
 } // namespace FleetAttributeMapper
 } // namespace Model
 } // namespace AppStream
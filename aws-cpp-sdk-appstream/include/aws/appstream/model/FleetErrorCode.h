@@ -59,6 +59,11 @@ namespace FleetErrorCodeMapper
 AWS_APPSTREAM_API FleetErrorCode GetFleetErrorCodeForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForFleetErrorCode(FleetErrorCode value);
+
+/**
+ * Same as GetNameForFleetErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForFleetErrorCodeCStr(FleetErrorCode value);
 } // namespace FleetErrorCodeMapper
 } // namespace Model
 } // namespace AppStream
@@ -37,6 +37,11 @@ namespace FleetStateMapper
 AWS_APPSTREAM_API FleetState GetFleetStateForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForFleetState(FleetState value);
+
+/**
+ * Same as GetNameForFleetState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForFleetStateCStr(FleetState value);
 } // namespace FleetStateMapper
 } // namespace Model
 } // namespace AppStream
@@ -35,6 +35,11 @@ namespace FleetTypeMapper
 AWS_APPSTREAM_API FleetType GetFleetTypeForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForFleetType(FleetType value);
+
+/**
+ * Same as GetNameForFleetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForFleetTypeCStr(FleetType value);
 } // namespace FleetTypeMapper
 } // namespace Model
 } // namespace AppStream
@@ -42,6 +42,11 @@ namespace ImageBuilderStateMapper
 AWS_APPSTREAM_API ImageBuilderState GetImageBuilderStateForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForImageBuilderState(ImageBuilderState value);
+
+/**
+ * Same as GetNameForImageBuilderState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForImageBuilderStateCStr(ImageBuilderState value);
 } // namespace ImageBuilderStateMapper
 } // namespace Model
 } // namespace AppStream
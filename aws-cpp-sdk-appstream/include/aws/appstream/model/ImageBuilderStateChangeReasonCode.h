@@ -35,6 +35,11 @@ namespace ImageBuilderStateChangeReasonCodeMapper
 AWS_APPSTREAM_API ImageBuilderStateChangeReasonCode GetImageBuilderStateChangeReasonCodeForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForImageBuilderStateChangeReasonCode(ImageBuilderStateChangeReasonCode value);
+
+/**
+ * Same as GetNameForImageBuilderStateChangeReasonCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForImageBuilderStateChangeReasonCodeCStr(ImageBuilderStateChangeReasonCode value);
 } // namespace ImageBuilderStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace AppStream
@@ -38,6 +38,11 @@ namespace ImageStateMapper
 AWS_APPSTREAM_API ImageState GetImageStateForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForImageState(ImageState value);
+
+/**
+ * Same as GetNameForImageState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForImageStateCStr(ImageState value);
 } // namespace ImageStateMapper
 } // namespace Model
 } // namespace AppStream
@@ -36,6 +36,11 @@ namespace ImageStateChangeReasonCodeMapper
 AWS_APPSTREAM_API ImageStateChangeReasonCode GetImageStateChangeReasonCodeForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForImageStateChangeReasonCode(ImageStateChangeReasonCode value);
+
+/**
+ * Same as GetNameForImageStateChangeReasonCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForImageStateChangeReasonCodeCStr(ImageStateChangeReasonCode value);
 } // namespace ImageStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace AppStream
@@ -35,6 +35,11 @@ namespace MessageActionMapper
 AWS_APPSTREAM_API MessageAction GetMessageActionForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForMessageAction(MessageAction value);
+
+/**
+ * Same as GetNameForMessageAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForMessageActionCStr(MessageAction value);
 } // namespace MessageActionMapper
 } // namespace Model
 } // namespace AppStream
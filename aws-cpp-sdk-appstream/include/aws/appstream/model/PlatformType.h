@@ -34,6 +34,11 @@ namespace PlatformTypeMapper
 AWS_APPSTREAM_API PlatformType GetPlatformTypeForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForPlatformType(PlatformType value);
+
+/**
+ * Same as GetNameForPlatformType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForPlatformTypeCStr(PlatformType value);
 } // namespace PlatformTypeMapper
 } // namespace Model
 } // namespace AppStream
@@ -36,6 +36,11 @@ namespace SessionStateMapper
 AWS_APPSTREAM_API SessionState GetSessionStateForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForSessionState(SessionState value);
+
+/**
+ * Same as GetNameForSessionState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForSessionStateCStr(SessionState value);
 } // namespace SessionStateMapper
 } // namespace Model
 } // namespace AppStream
@@ -41,6 +41,11 @@ namespace StackAttributeMapper
 AWS_APPSTREAM_API StackAttribute GetStackAttributeForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForStackAttribute(StackAttribute value);
+
+/**
+ * Same as GetNameForStackAttribute(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForStackAttributeCStr(StackAttribute value);
 } // namespace StackAttributeMapper
 } // namespace Model
 } // namespace AppStream
@@ -35,6 +35,11 @@ namespace StackErrorCodeMapper
 AWS_APPSTREAM_API StackErrorCode GetStackErrorCodeForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForStackErrorCode(StackErrorCode value);
+
+/**
+ * Same as GetNameForStackErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForStackErrorCodeCStr(StackErrorCode value);
 } // namespace StackErrorCodeMapper
 } // namespace Model
 } // namespace AppStream
@@ -36,6 +36,11 @@ namespace StorageConnectorTypeMapper
 AWS_APPSTREAM_API StorageConnectorType GetStorageConnectorTypeForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForStorageConnectorType(StorageConnectorType value);
+
+/**
+ * Same as GetNameForStorageConnectorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForStorageConnectorTypeCStr(StorageConnectorType value);
 } // namespace StorageConnectorTypeMapper
 } // namespace Model
 } // namespace AppStream
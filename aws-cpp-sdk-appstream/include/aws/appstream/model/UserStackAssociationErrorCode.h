@@ -36,6 +36,11 @@ namespace UserStackAssociationErrorCodeMapper
 AWS_APPSTREAM_API UserStackAssociationErrorCode GetUserStackAssociationErrorCodeForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForUserStackAssociationErrorCode(UserStackAssociationErrorCode value);
+
+/**
+ * Same as GetNameForUserStackAssociationErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForUserStackAssociationErrorCodeCStr(UserStackAssociationErrorCode value);
 } // namespace UserStackAssociationErrorCodeMapper
 } // namespace Model
 } // namespace AppStream
@@ -36,6 +36,11 @@ namespace VisibilityTypeMapper
 AWS_APPSTREAM_API VisibilityType GetVisibilityTypeForName(const Aws::String& name);
 
 AWS_APPSTREAM_API Aws::String GetNameForVisibilityType(VisibilityType value);
+
+/**
+ * Same as GetNameForVisibilityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSTREAM_API const char* GetNameForVisibilityTypeCStr(VisibilityType value);
 } // namespace VisibilityTypeMapper
 } // namespace Model
 } // namespace AppStream
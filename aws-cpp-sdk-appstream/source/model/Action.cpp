@@ -30,35 +30,58 @@ namespace Aws
       namespace ActionMapper
       {
 
-        static const int CLIPBOARD_COPY_FROM_LOCAL_DEVICE_HASH = HashingUtils::HashString("CLIPBOARD_COPY_FROM_LOCAL_DEVICE");
-        static const int CLIPBOARD_COPY_TO_LOCAL_DEVICE_HASH = HashingUtils::HashString("CLIPBOARD_COPY_TO_LOCAL_DEVICE");
-        static const int FILE_UPLOAD_HASH = HashingUtils::HashString("FILE_UPLOAD");
-        static const int FILE_DOWNLOAD_HASH = HashingUtils::HashString("FILE_DOWNLOAD");
-        static const int PRINTING_TO_LOCAL_DEVICE_HASH = HashingUtils::HashString("PRINTING_TO_LOCAL_DEVICE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CLIPBOARD_COPY_FROM_LOCAL_DEVICE",
+          "CLIPBOARD_COPY_TO_LOCAL_DEVICE",
+          "FILE_UPLOAD",
+          "FILE_DOWNLOAD",
+          "PRINTING_TO_LOCAL_DEVICE",
+        };
 
         Action GetActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLIPBOARD_COPY_FROM_LOCAL_DEVICE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Action::CLIPBOARD_COPY_FROM_LOCAL_DEVICE;
-          }
-          else if (hashCode == CLIPBOARD_COPY_TO_LOCAL_DEVICE_HASH)
-          {
-            return Action::CLIPBOARD_COPY_TO_LOCAL_DEVICE;
-          }
-          else if (hashCode == FILE_UPLOAD_HASH)
-          {
-            return Action::FILE_UPLOAD;
-          }
-          else if (hashCode == FILE_DOWNLOAD_HASH)
-          {
-            return Action::FILE_DOWNLOAD;
-          }
-          else if (hashCode == PRINTING_TO_LOCAL_DEVICE_HASH)
-          {
-            return Action::PRINTING_TO_LOCAL_DEVICE;
+          case 735950558:
+            if (name == "CLIPBOARD_COPY_FROM_LOCAL_DEVICE")
+            {
+              return Action::CLIPBOARD_COPY_FROM_LOCAL_DEVICE;
+            }
+            break;
+          case 709800813:
+            if (name == "CLIPBOARD_COPY_TO_LOCAL_DEVICE")
+            {
+              return Action::CLIPBOARD_COPY_TO_LOCAL_DEVICE;
+            }
+            break;
+          case -1702679004:
+            if (name == "FILE_UPLOAD")
+            {
+              return Action::FILE_UPLOAD;
+            }
+            break;
+          case -28153877:
+            if (name == "FILE_DOWNLOAD")
+            {
+              return Action::FILE_DOWNLOAD;
+            }
+            break;
+          case -927091996:
+            if (name == "PRINTING_TO_LOCAL_DEVICE")
+            {
+              return Action::PRINTING_TO_LOCAL_DEVICE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return Action::NOT_SET;
         }
 
-        Aws::String GetNameForAction(Action enumValue)
+        const char* GetNameForActionCStr(Action enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Action::CLIPBOARD_COPY_FROM_LOCAL_DEVICE:
-            return "CLIPBOARD_COPY_FROM_LOCAL_DEVICE";
-          case Action::CLIPBOARD_COPY_TO_LOCAL_DEVICE:
-            return "CLIPBOARD_COPY_TO_LOCAL_DEVICE";
-          case Action::FILE_UPLOAD:
-            return "FILE_UPLOAD";
-          case Action::FILE_DOWNLOAD:
-            return "FILE_DOWNLOAD";
-          case Action::PRINTING_TO_LOCAL_DEVICE:
-            return "PRINTING_TO_LOCAL_DEVICE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAction(Action enumValue)
+        {
+          return GetNameForActionCStr(enumValue);
         }
 
       } // namespace ActionMapper
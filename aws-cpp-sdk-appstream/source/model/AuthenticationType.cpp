@@ -30,25 +30,44 @@ namespace Aws
       namespace AuthenticationTypeMapper
       {
 
-        static const int API_HASH = HashingUtils::HashString("API");
-        static const int SAML_HASH = HashingUtils::HashString("SAML");
-        static const int USERPOOL_HASH = HashingUtils::HashString("USERPOOL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "API",
+          "SAML",
+          "USERPOOL",
+        };
 
         AuthenticationType GetAuthenticationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == API_HASH)
-          {
-            return AuthenticationType::API;
-          }
-          else if (hashCode == SAML_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthenticationType::SAML;
-          }
-          else if (hashCode == USERPOOL_HASH)
-          {
-            return AuthenticationType::USERPOOL;
+          case 65018:
+            if (name == "API")
+            {
+              return AuthenticationType::API;
+            }
+            break;
+          case 2537581:
+            if (name == "SAML")
+            {
+              return AuthenticationType::SAML;
+            }
+            break;
+          case 516986471:
+            if (name == "USERPOOL")
+            {
+              return AuthenticationType::USERPOOL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AuthenticationType::NOT_SET;
         }
 
-        Aws::String GetNameForAuthenticationType(AuthenticationType enumValue)
+        const char* GetNameForAuthenticationTypeCStr(AuthenticationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthenticationType::API:
-            return "API";
-          case AuthenticationType::SAML:
-            return "SAML";
-          case AuthenticationType::USERPOOL:
-            return "USERPOOL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthenticationType(AuthenticationType enumValue)
+        {
+          return GetNameForAuthenticationTypeCStr(enumValue);
         }
 
       } // namespace AuthenticationTypeMapper
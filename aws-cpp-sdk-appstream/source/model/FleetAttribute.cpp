@@ -30,25 +30,44 @@ namespace Aws
       namespace FleetAttributeMapper
       {
 
-        static const int VPC_CONFIGURATION_HASH = HashingUtils::HashString("VPC_CONFIGURATION");
-        static const int VPC_CONFIGURATION_SECURITY_GROUP_IDS_HASH = HashingUtils::HashString("VPC_CONFIGURATION_SECURITY_GROUP_IDS");
-        static const int DOMAIN_JOIN_INFO_HASH = HashingUtils::HashString("DOMAIN_JOIN_INFO");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VPC_CONFIGURATION",
+          "VPC_CONFIGURATION_SECURITY_GROUP_IDS",
+          "DOMAIN_JOIN_INFO",
+        };
 
         FleetAttribute GetFleetAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VPC_CONFIGURATION_HASH)
-          {
-            return FleetAttribute::VPC_CONFIGURATION;
-          }
-          else if (hashCode == VPC_CONFIGURATION_SECURITY_GROUP_IDS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetAttribute::VPC_CONFIGURATION_SECURITY_GROUP_IDS;
-          }
-          else if (hashCode == DOMAIN_JOIN_INFO_HASH)
-          {
-            return FleetAttribute::DOMAIN_JOIN_INFO;
+          case 424810464:
+            if (name == "VPC_CONFIGURATION")
+            {
+              return FleetAttribute::VPC_CONFIGURATION;
+            }
+            break;
+          case 1860089144:
+            if (name == "VPC_CONFIGURATION_SECURITY_GROUP_IDS")
+            {
+              return FleetAttribute::VPC_CONFIGURATION_SECURITY_GROUP_IDS;
+            }
+            break;
+          case -446068504:
+            if (name == "DOMAIN_JOIN_INFO")
+            {
+              return FleetAttribute::DOMAIN_JOIN_INFO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FleetAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForFleetAttribute(FleetAttribute enumValue)
+        const char* GetNameForFleetAttributeCStr(FleetAttribute enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetAttribute::VPC_CONFIGURATION:
-            return "VPC_CONFIGURATION";
-          case FleetAttribute::VPC_CONFIGURATION_SECURITY_GROUP_IDS:
-            return "VPC_CONFIGURATION_SECURITY_GROUP_IDS";
-          case FleetAttribute::DOMAIN_JOIN_INFO:
-            return "DOMAIN_JOIN_INFO";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetAttribute(FleetAttribute enumValue)
+        {
+          return GetNameForFleetAttributeCStr(enumValue);
         }
 
       } // namespace FleetAttributeMapper
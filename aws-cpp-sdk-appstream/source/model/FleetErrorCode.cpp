@@ -30,140 +30,205 @@ namespace Aws
       namespace FleetErrorCodeMapper
       {
 
-        static const int IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION");
-        static const int IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION");
-        static const int IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION");
-        static const int NETWORK_INTERFACE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("NETWORK_INTERFACE_LIMIT_EXCEEDED");
-        static const int INTERNAL_SERVICE_ERROR_HASH = HashingUtils::HashString("INTERNAL_SERVICE_ERROR");
-        static const int IAM_SERVICE_ROLE_IS_MISSING_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_IS_MISSING");
-        static const int SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES_HASH = HashingUtils::HashString("SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES");
-        static const int IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION");
-        static const int SUBNET_NOT_FOUND_HASH = HashingUtils::HashString("SUBNET_NOT_FOUND");
-        static const int IMAGE_NOT_FOUND_HASH = HashingUtils::HashString("IMAGE_NOT_FOUND");
-        static const int INVALID_SUBNET_CONFIGURATION_HASH = HashingUtils::HashString("INVALID_SUBNET_CONFIGURATION");
-        static const int SECURITY_GROUPS_NOT_FOUND_HASH = HashingUtils::HashString("SECURITY_GROUPS_NOT_FOUND");
-        static const int IGW_NOT_ATTACHED_HASH = HashingUtils::HashString("IGW_NOT_ATTACHED");
-        static const int IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION");
-        static const int DOMAIN_JOIN_ERROR_FILE_NOT_FOUND_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_FILE_NOT_FOUND");
-        static const int DOMAIN_JOIN_ERROR_ACCESS_DENIED_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_ACCESS_DENIED");
-        static const int DOMAIN_JOIN_ERROR_LOGON_FAILURE_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_LOGON_FAILURE");
-        static const int DOMAIN_JOIN_ERROR_INVALID_PARAMETER_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_INVALID_PARAMETER");
-        static const int DOMAIN_JOIN_ERROR_MORE_DATA_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_MORE_DATA");
-        static const int DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN");
-        static const int DOMAIN_JOIN_ERROR_NOT_SUPPORTED_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_NOT_SUPPORTED");
-        static const int DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME_HASH = HashingUtils::HashString("DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME");
-        static const int DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED_HASH = HashingUtils::HashString("DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED");
-        static const int DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED");
-        static const int DOMAIN_JOIN_NERR_PASSWORD_EXPIRED_HASH = HashingUtils::HashString("DOMAIN_JOIN_NERR_PASSWORD_EXPIRED");
-        static const int DOMAIN_JOIN_INTERNAL_SERVICE_ERROR_HASH = HashingUtils::HashString("DOMAIN_JOIN_INTERNAL_SERVICE_ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION",
+          "IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION",
+          "IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION",
+          "NETWORK_INTERFACE_LIMIT_EXCEEDED",
+          "INTERNAL_SERVICE_ERROR",
+          "IAM_SERVICE_ROLE_IS_MISSING",
+          "SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES",
+          "IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION",
+          "SUBNET_NOT_FOUND",
+          "IMAGE_NOT_FOUND",
+          "INVALID_SUBNET_CONFIGURATION",
+          "SECURITY_GROUPS_NOT_FOUND",
+          "IGW_NOT_ATTACHED",
+          "IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION",
+          "DOMAIN_JOIN_ERROR_FILE_NOT_FOUND",
+          "DOMAIN_JOIN_ERROR_ACCESS_DENIED",
+          "DOMAIN_JOIN_ERROR_LOGON_FAILURE",
+          "DOMAIN_JOIN_ERROR_INVALID_PARAMETER",
+          "DOMAIN_JOIN_ERROR_MORE_DATA",
+          "DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN",
+          "DOMAIN_JOIN_ERROR_NOT_SUPPORTED",
+          "DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME",
+          "DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED",
+          "DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED",
+          "DOMAIN_JOIN_NERR_PASSWORD_EXPIRED",
+          "DOMAIN_JOIN_INTERNAL_SERVICE_ERROR",
+        };
 
         FleetErrorCode GetFleetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION_HASH)
-          {
-            return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION;
-          }
-          else if (hashCode == IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION_HASH)
-          {
-            return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION;
-          }
-          else if (hashCode == IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION_HASH)
-          {
-            return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION;
-          }
-          else if (hashCode == NETWORK_INTERFACE_LIMIT_EXCEEDED_HASH)
-          {
-            return FleetErrorCode::NETWORK_INTERFACE_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == INTERNAL_SERVICE_ERROR_HASH)
-          {
-            return FleetErrorCode::INTERNAL_SERVICE_ERROR;
-          }
-          else if (hashCode == IAM_SERVICE_ROLE_IS_MISSING_HASH)
-          {
-            return FleetErrorCode::IAM_SERVICE_ROLE_IS_MISSING;
-          }
-          else if (hashCode == SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES_HASH)
-          {
-            return FleetErrorCode::SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES;
-          }
-          else if (hashCode == IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION_HASH)
-          {
-            return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION;
-          }
-          else if (hashCode == SUBNET_NOT_FOUND_HASH)
-          {
-            return FleetErrorCode::SUBNET_NOT_FOUND;
-          }
-          else if (hashCode == IMAGE_NOT_FOUND_HASH)
-          {
-            return FleetErrorCode::IMAGE_NOT_FOUND;
-          }
-          else if (hashCode == INVALID_SUBNET_CONFIGURATION_HASH)
-          {
-            return FleetErrorCode::INVALID_SUBNET_CONFIGURATION;
-          }
-          else if (hashCode == SECURITY_GROUPS_NOT_FOUND_HASH)
-          {
-            return FleetErrorCode::SECURITY_GROUPS_NOT_FOUND;
-          }
-          else if (hashCode == IGW_NOT_ATTACHED_HASH)
-          {
-            return FleetErrorCode::IGW_NOT_ATTACHED;
-          }
-          else if (hashCode == IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION_HASH)
-          {
-            return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_FILE_NOT_FOUND_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_FILE_NOT_FOUND;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_ACCESS_DENIED_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_ACCESS_DENIED;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_LOGON_FAILURE_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_LOGON_FAILURE;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_INVALID_PARAMETER_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_INVALID_PARAMETER;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_MORE_DATA_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_MORE_DATA;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_NOT_SUPPORTED_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_NOT_SUPPORTED;
-          }
-          else if (hashCode == DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME;
-          }
-          else if (hashCode == DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED;
-          }
-          else if (hashCode == DOMAIN_JOIN_NERR_PASSWORD_EXPIRED_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_NERR_PASSWORD_EXPIRED;
-          }
-          else if (hashCode == DOMAIN_JOIN_INTERNAL_SERVICE_ERROR_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_INTERNAL_SERVICE_ERROR;
+          case 525743901:
+            if (name == "IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION;
+            }
+            break;
+          case -871513972:
+            if (name == "IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION;
+            }
+            break;
+          case 972163325:
+            if (name == "IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION;
+            }
+            break;
+          case -334195602:
+            if (name == "NETWORK_INTERFACE_LIMIT_EXCEEDED")
+            {
+              return FleetErrorCode::NETWORK_INTERFACE_LIMIT_EXCEEDED;
+            }
+            break;
+          case 2056521148:
+            if (name == "INTERNAL_SERVICE_ERROR")
+            {
+              return FleetErrorCode::INTERNAL_SERVICE_ERROR;
+            }
+            break;
+          case 472643814:
+            if (name == "IAM_SERVICE_ROLE_IS_MISSING")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_IS_MISSING;
+            }
+            break;
+          case -461350337:
+            if (name == "SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES")
+            {
+              return FleetErrorCode::SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES;
+            }
+            break;
+          case -703972558:
+            if (name == "IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION;
+            }
+            break;
+          case -1318420364:
+            if (name == "SUBNET_NOT_FOUND")
+            {
+              return FleetErrorCode::SUBNET_NOT_FOUND;
+            }
+            break;
+          case 1186184402:
+            if (name == "IMAGE_NOT_FOUND")
+            {
+              return FleetErrorCode::IMAGE_NOT_FOUND;
+            }
+            break;
+          case -1653643044:
+            if (name == "INVALID_SUBNET_CONFIGURATION")
+            {
+              return FleetErrorCode::INVALID_SUBNET_CONFIGURATION;
+            }
+            break;
+          case -2082729654:
+            if (name == "SECURITY_GROUPS_NOT_FOUND")
+            {
+              return FleetErrorCode::SECURITY_GROUPS_NOT_FOUND;
+            }
+            break;
+          case 1248195894:
+            if (name == "IGW_NOT_ATTACHED")
+            {
+              return FleetErrorCode::IGW_NOT_ATTACHED;
+            }
+            break;
+          case -1741220952:
+            if (name == "IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION;
+            }
+            break;
+          case -938779836:
+            if (name == "DOMAIN_JOIN_ERROR_FILE_NOT_FOUND")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_FILE_NOT_FOUND;
+            }
+            break;
+          case -558499515:
+            if (name == "DOMAIN_JOIN_ERROR_ACCESS_DENIED")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_ACCESS_DENIED;
+            }
+            break;
+          case 586250141:
+            if (name == "DOMAIN_JOIN_ERROR_LOGON_FAILURE")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_LOGON_FAILURE;
+            }
+            break;
+          case -1161618928:
+            if (name == "DOMAIN_JOIN_ERROR_INVALID_PARAMETER")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_INVALID_PARAMETER;
+            }
+            break;
+          case -496396221:
+            if (name == "DOMAIN_JOIN_ERROR_MORE_DATA")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_MORE_DATA;
+            }
+            break;
+          case 2081735599:
+            if (name == "DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN;
+            }
+            break;
+          case -710649743:
+            if (name == "DOMAIN_JOIN_ERROR_NOT_SUPPORTED")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_NOT_SUPPORTED;
+            }
+            break;
+          case -1098754254:
+            if (name == "DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME;
+            }
+            break;
+          case -1707607637:
+            if (name == "DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED;
+            }
+            break;
+          case -1154066557:
+            if (name == "DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED;
+            }
+            break;
+          case -1850016401:
+            if (name == "DOMAIN_JOIN_NERR_PASSWORD_EXPIRED")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_NERR_PASSWORD_EXPIRED;
+            }
+            break;
+          case 495081334:
+            if (name == "DOMAIN_JOIN_INTERNAL_SERVICE_ERROR")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_INTERNAL_SERVICE_ERROR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -175,71 +240,26 @@ namespace Aws
           return FleetErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForFleetErrorCode(FleetErrorCode enumValue)
+        const char* GetNameForFleetErrorCodeCStr(FleetErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION:
-            return "IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION";
-          case FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION:
-            return "IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION";
-          case FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION:
-            return "IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION";
-          case FleetErrorCode::NETWORK_INTERFACE_LIMIT_EXCEEDED:
-            return "NETWORK_INTERFACE_LIMIT_EXCEEDED";
-          case FleetErrorCode::INTERNAL_SERVICE_ERROR:
-            return "INTERNAL_SERVICE_ERROR";
-          case FleetErrorCode::IAM_SERVICE_ROLE_IS_MISSING:
-            return "IAM_SERVICE_ROLE_IS_MISSING";
-          case FleetErrorCode::SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES:
-            return "SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES";
-          case FleetErrorCode::IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION:
-            return "IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION";
-          case FleetErrorCode::SUBNET_NOT_FOUND:
-            return "SUBNET_NOT_FOUND";
-          case FleetErrorCode::IMAGE_NOT_FOUND:
-            return "IMAGE_NOT_FOUND";
-          case FleetErrorCode::INVALID_SUBNET_CONFIGURATION:
-            return "INVALID_SUBNET_CONFIGURATION";
-          case FleetErrorCode::SECURITY_GROUPS_NOT_FOUND:
-            return "SECURITY_GROUPS_NOT_FOUND";
-          case FleetErrorCode::IGW_NOT_ATTACHED:
-            return "IGW_NOT_ATTACHED";
-          case FleetErrorCode::IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION:
-            return "IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION";
-          case FleetErrorCode::DOMAIN_JOIN_ERROR_FILE_NOT_FOUND:
-            return "DOMAIN_JOIN_ERROR_FILE_NOT_FOUND";
-          case FleetErrorCode::DOMAIN_JOIN_ERROR_ACCESS_DENIED:
-            return "DOMAIN_JOIN_ERROR_ACCESS_DENIED";
-          case FleetErrorCode::DOMAIN_JOIN_ERROR_LOGON_FAILURE:
-            return "DOMAIN_JOIN_ERROR_LOGON_FAILURE";
-          case FleetErrorCode::DOMAIN_JOIN_ERROR_INVALID_PARAMETER:
-            return "DOMAIN_JOIN_ERROR_INVALID_PARAMETER";
-          case FleetErrorCode::DOMAIN_JOIN_ERROR_MORE_DATA:
-            return "DOMAIN_JOIN_ERROR_MORE_DATA";
-          case FleetErrorCode::DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN:
-            return "DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN";
-          case FleetErrorCode::DOMAIN_JOIN_ERROR_NOT_SUPPORTED:
-            return "DOMAIN_JOIN_ERROR_NOT_SUPPORTED";
-          case FleetErrorCode::DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME:
-            return "DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME";
-          case FleetErrorCode::DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED:
-            return "DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED";
-          case FleetErrorCode::DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED:
-            return "DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED";
-          case FleetErrorCode::DOMAIN_JOIN_NERR_PASSWORD_EXPIRED:
-            return "DOMAIN_JOIN_NERR_PASSWORD_EXPIRED";
-          case FleetErrorCode::DOMAIN_JOIN_INTERNAL_SERVICE_ERROR:
-            return "DOMAIN_JOIN_INTERNAL_SERVICE_ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetErrorCode(FleetErrorCode enumValue)
+        {
+          return GetNameForFleetErrorCodeCStr(enumValue);
         }
 
       } // namespace FleetErrorCodeMapper
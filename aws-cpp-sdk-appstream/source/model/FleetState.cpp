@@ -30,30 +30,51 @@ namespace Aws
       namespace FleetStateMapper
       {
 
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STARTING",
+          "RUNNING",
+          "STOPPING",
+          "STOPPED",
+        };
 
         FleetState GetFleetStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTING_HASH)
-          {
-            return FleetState::STARTING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return FleetState::RUNNING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return FleetState::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetState::STOPPED;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return FleetState::STARTING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return FleetState::RUNNING;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return FleetState::STOPPING;
+            }
+            break;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return FleetState::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return FleetState::NOT_SET;
         }
 
-        Aws::String GetNameForFleetState(FleetState enumValue)
+        const char* GetNameForFleetStateCStr(FleetState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetState::STARTING:
-            return "STARTING";
-          case FleetState::RUNNING:
-            return "RUNNING";
-          case FleetState::STOPPING:
-            return "STOPPING";
-          case FleetState::STOPPED:
-            return "STOPPED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetState(FleetState enumValue)
+        {
+          return GetNameForFleetStateCStr(enumValue);
         }
 
       } // namespace FleetStateMapper
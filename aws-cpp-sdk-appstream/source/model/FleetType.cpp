@@ -30,20 +30,37 @@ namespace Aws
       namespace FleetTypeMapper
       {
 
-        static const int ALWAYS_ON_HASH = HashingUtils::HashString("ALWAYS_ON");
-        static const int ON_DEMAND_HASH = HashingUtils::HashString("ON_DEMAND");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALWAYS_ON",
+          "ON_DEMAND",
+        };
 
         FleetType GetFleetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALWAYS_ON_HASH)
-          {
-            return FleetType::ALWAYS_ON;
-          }
-          else if (hashCode == ON_DEMAND_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetType::ON_DEMAND;
+          case -361760241:
+            if (name == "ALWAYS_ON")
+            {
+              return FleetType::ALWAYS_ON;
+            }
+            break;
+          case -2128361301:
+            if (name == "ON_DEMAND")
+            {
+              return FleetType::ON_DEMAND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FleetType::NOT_SET;
         }
 
-        Aws::String GetNameForFleetType(FleetType enumValue)
+        const char* GetNameForFleetTypeCStr(FleetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetType::ALWAYS_ON:
-            return "ALWAYS_ON";
-          case FleetType::ON_DEMAND:
-            return "ON_DEMAND";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetType(FleetType enumValue)
+        {
+          return GetNameForFleetTypeCStr(enumValue);
         }
 
       } // namespace FleetTypeMapper
@@ -30,55 +30,86 @@ namespace Aws
       namespace ImageBuilderStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int UPDATING_AGENT_HASH = HashingUtils::HashString("UPDATING_AGENT");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-        static const int REBOOTING_HASH = HashingUtils::HashString("REBOOTING");
-        static const int SNAPSHOTTING_HASH = HashingUtils::HashString("SNAPSHOTTING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "UPDATING_AGENT",
+          "RUNNING",
+          "STOPPING",
+          "STOPPED",
+          "REBOOTING",
+          "SNAPSHOTTING",
+          "DELETING",
+          "FAILED",
+        };
 
         ImageBuilderState GetImageBuilderStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return ImageBuilderState::PENDING;
-          }
-          else if (hashCode == UPDATING_AGENT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ImageBuilderState::UPDATING_AGENT;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ImageBuilderState::RUNNING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return ImageBuilderState::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return ImageBuilderState::STOPPED;
-          }
-          else if (hashCode == REBOOTING_HASH)
-          {
-            return ImageBuilderState::REBOOTING;
-          }
-          else if (hashCode == SNAPSHOTTING_HASH)
-          {
-            return ImageBuilderState::SNAPSHOTTING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ImageBuilderState::DELETING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ImageBuilderState::FAILED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ImageBuilderState::PENDING;
+            }
+            break;
+          case -927213396:
+            if (name == "UPDATING_AGENT")
+            {
+              return ImageBuilderState::UPDATING_AGENT;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return ImageBuilderState::RUNNING;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return ImageBuilderState::STOPPING;
+            }
+            break;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return ImageBuilderState::STOPPED;
+            }
+            break;
+          case -1404612099:
+            if (name == "REBOOTING")
+            {
+              return ImageBuilderState::REBOOTING;
+            }
+            break;
+          case 1386712754:
+            if (name == "SNAPSHOTTING")
+            {
+              return ImageBuilderState::SNAPSHOTTING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ImageBuilderState::DELETING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ImageBuilderState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return ImageBuilderState::NOT_SET;
         }
 
-        Aws::String GetNameForImageBuilderState(ImageBuilderState enumValue)
+        const char* GetNameForImageBuilderStateCStr(ImageBuilderState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ImageBuilderState::PENDING:
-            return "PENDING";
-          case ImageBuilderState::UPDATING_AGENT:
-            return "UPDATING_AGENT";
-          case ImageBuilderState::RUNNING:
-            return "RUNNING";
-          case ImageBuilderState::STOPPING:
-            return "STOPPING";
-          case ImageBuilderState::STOPPED:
-            return "STOPPED";
-          case ImageBuilderState::REBOOTING:
-            return "REBOOTING";
-          case ImageBuilderState::SNAPSHOTTING:
-            return "SNAPSHOTTING";
-          case ImageBuilderState::DELETING:
-            return "DELETING";
-          case ImageBuilderState::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForImageBuilderState(ImageBuilderState enumValue)
+        {
+          return GetNameForImageBuilderStateCStr(enumValue);
         }
 
       } // namespace ImageBuilderStateMapper
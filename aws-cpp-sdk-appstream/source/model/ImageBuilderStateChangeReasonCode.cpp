@@ -30,20 +30,37 @@ namespace Aws
       namespace ImageBuilderStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int IMAGE_UNAVAILABLE_HASH = HashingUtils::HashString("IMAGE_UNAVAILABLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INTERNAL_ERROR",
+          "IMAGE_UNAVAILABLE",
+        };
 
         ImageBuilderStateChangeReasonCode GetImageBuilderStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
-          {
-            return ImageBuilderStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == IMAGE_UNAVAILABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ImageBuilderStateChangeReasonCode::IMAGE_UNAVAILABLE;
+          case -485608986:
+            if (name == "INTERNAL_ERROR")
+            {
+              return ImageBuilderStateChangeReasonCode::INTERNAL_ERROR;
+            }
+            break;
+          case -881886420:
+            if (name == "IMAGE_UNAVAILABLE")
+            {
+              return ImageBuilderStateChangeReasonCode::IMAGE_UNAVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ImageBuilderStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForImageBuilderStateChangeReasonCode(ImageBuilderStateChangeReasonCode enumValue)
+        const char* GetNameForImageBuilderStateChangeReasonCodeCStr(ImageBuilderStateChangeReasonCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ImageBuilderStateChangeReasonCode::INTERNAL_ERROR:
-            return "INTERNAL_ERROR";
-          case ImageBuilderStateChangeReasonCode::IMAGE_UNAVAILABLE:
-            return "IMAGE_UNAVAILABLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForImageBuilderStateChangeReasonCode(ImageBuilderStateChangeReasonCode enumValue)
+        {
+          return GetNameForImageBuilderStateChangeReasonCodeCStr(enumValue);
         }
 
       } // namespace ImageBuilderStateChangeReasonCodeMapper
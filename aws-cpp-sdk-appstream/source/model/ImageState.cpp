@@ -30,35 +30,58 @@ namespace Aws
       namespace ImageStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COPYING_HASH = HashingUtils::HashString("COPYING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "AVAILABLE",
+          "FAILED",
+          "COPYING",
+          "DELETING",
+        };
 
         ImageState GetImageStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ImageState::PENDING;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return ImageState::AVAILABLE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ImageState::FAILED;
-          }
-          else if (hashCode == COPYING_HASH)
-          {
-            return ImageState::COPYING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ImageState::DELETING;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ImageState::PENDING;
+            }
+            break;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return ImageState::AVAILABLE;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ImageState::FAILED;
+            }
+            break;
+          case 1671513133:
+            if (name == "COPYING")
+            {
+              return ImageState::COPYING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ImageState::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ImageState::NOT_SET;
         }
 
-        Aws::String GetNameForImageState(ImageState enumValue)
+        const char* GetNameForImageStateCStr(ImageState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ImageState::PENDING:
-            return "PENDING";
-          case ImageState::AVAILABLE:
-            return "AVAILABLE";
-          case ImageState::FAILED:
-            return "FAILED";
-          case ImageState::COPYING:
-            return "COPYING";
-          case ImageState::DELETING:
-            return "DELETING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForImageState(ImageState enumValue)
+        {
+          return GetNameForImageStateCStr(enumValue);
         }
 
       } // namespace ImageStateMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ImageStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int IMAGE_BUILDER_NOT_AVAILABLE_HASH = HashingUtils::HashString("IMAGE_BUILDER_NOT_AVAILABLE");
-        static const int IMAGE_COPY_FAILURE_HASH = HashingUtils::HashString("IMAGE_COPY_FAILURE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INTERNAL_ERROR",
+          "IMAGE_BUILDER_NOT_AVAILABLE",
+          "IMAGE_COPY_FAILURE",
+        };
 
         ImageStateChangeReasonCode GetImageStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
-          {
-            return ImageStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == IMAGE_BUILDER_NOT_AVAILABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ImageStateChangeReasonCode::IMAGE_BUILDER_NOT_AVAILABLE;
-          }
-          else if (hashCode == IMAGE_COPY_FAILURE_HASH)
-          {
-            return ImageStateChangeReasonCode::IMAGE_COPY_FAILURE;
+          case -485608986:
+            if (name == "INTERNAL_ERROR")
+            {
+              return ImageStateChangeReasonCode::INTERNAL_ERROR;
+            }
+            break;
+          case 1252384341:
+            if (name == "IMAGE_BUILDER_NOT_AVAILABLE")
+            {
+              return ImageStateChangeReasonCode::IMAGE_BUILDER_NOT_AVAILABLE;
+            }
+            break;
+          case 895653668:
+            if (name == "IMAGE_COPY_FAILURE")
+            {
+              return ImageStateChangeReasonCode::IMAGE_COPY_FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ImageStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForImageStateChangeReasonCode(ImageStateChangeReasonCode enumValue)
+        const char* GetNameForImageStateChangeReasonCodeCStr(ImageStateChangeReasonCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ImageStateChangeReasonCode::INTERNAL_ERROR:
-            return "INTERNAL_ERROR";
-          case ImageStateChangeReasonCode::IMAGE_BUILDER_NOT_AVAILABLE:
-            return "IMAGE_BUILDER_NOT_AVAILABLE";
-          case ImageStateChangeReasonCode::IMAGE_COPY_FAILURE:
-            return "IMAGE_COPY_FAILURE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForImageStateChangeReasonCode(ImageStateChangeReasonCode enumValue)
+        {
+          return GetNameForImageStateChangeReasonCodeCStr(enumValue);
         }
 
       } // namespace ImageStateChangeReasonCodeMapper
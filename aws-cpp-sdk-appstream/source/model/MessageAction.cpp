@@ -30,20 +30,37 @@ namespace Aws
       namespace MessageActionMapper
       {
 
-        static const int SUPPRESS_HASH = HashingUtils::HashString("SUPPRESS");
-        static const int RESEND_HASH = HashingUtils::HashString("RESEND");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUPPRESS",
+          "RESEND",
+        };
 
         MessageAction GetMessageActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUPPRESS_HASH)
-          {
-            return MessageAction::SUPPRESS;
-          }
-          else if (hashCode == RESEND_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MessageAction::RESEND;
+          case -880503115:
+            if (name == "SUPPRESS")
+            {
+              return MessageAction::SUPPRESS;
+            }
+            break;
+          case -1881112517:
+            if (name == "RESEND")
+            {
+              return MessageAction::RESEND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MessageAction::NOT_SET;
         }
 
-        Aws::String GetNameForMessageAction(MessageAction enumValue)
+        const char* GetNameForMessageActionCStr(MessageAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MessageAction::SUPPRESS:
-            return "SUPPRESS";
-          case MessageAction::RESEND:
-            return "RESEND";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMessageAction(MessageAction enumValue)
+        {
+          return GetNameForMessageActionCStr(enumValue);
         }
 
       } // namespace MessageActionMapper
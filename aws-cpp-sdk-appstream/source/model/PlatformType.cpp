@@ -30,15 +30,30 @@ namespace Aws
       namespace PlatformTypeMapper
       {
 
-        static const int WINDOWS_HASH = HashingUtils::HashString("WINDOWS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WINDOWS",
+        };
 
         PlatformType GetPlatformTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WINDOWS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlatformType::WINDOWS;
+          case 2067476067:
+            if (name == "WINDOWS")
+            {
+              return PlatformType::WINDOWS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return PlatformType::NOT_SET;
         }
 
-        Aws::String GetNameForPlatformType(PlatformType enumValue)
+        const char* GetNameForPlatformTypeCStr(PlatformType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlatformType::WINDOWS:
-            return "WINDOWS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlatformType(PlatformType enumValue)
+        {
+          return GetNameForPlatformTypeCStr(enumValue);
         }
 
       } // namespace PlatformTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace SessionStateMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "PENDING",
+          "EXPIRED",
+        };
 
         SessionState GetSessionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return SessionState::ACTIVE;
-          }
-          else if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SessionState::PENDING;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return SessionState::EXPIRED;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return SessionState::ACTIVE;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return SessionState::PENDING;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return SessionState::EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SessionState::NOT_SET;
         }
 
-        Aws::String GetNameForSessionState(SessionState enumValue)
+        const char* GetNameForSessionStateCStr(SessionState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SessionState::ACTIVE:
-            return "ACTIVE";
-          case SessionState::PENDING:
-            return "PENDING";
-          case SessionState::EXPIRED:
-            return "EXPIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSessionState(SessionState enumValue)
+        {
+          return GetNameForSessionStateCStr(enumValue);
         }
 
       } // namespace SessionStateMapper
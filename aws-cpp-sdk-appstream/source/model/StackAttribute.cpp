@@ -30,50 +30,79 @@ namespace Aws
       namespace StackAttributeMapper
       {
 
-        static const int STORAGE_CONNECTORS_HASH = HashingUtils::HashString("STORAGE_CONNECTORS");
-        static const int STORAGE_CONNECTOR_HOMEFOLDERS_HASH = HashingUtils::HashString("STORAGE_CONNECTOR_HOMEFOLDERS");
-        static const int STORAGE_CONNECTOR_GOOGLE_DRIVE_HASH = HashingUtils::HashString("STORAGE_CONNECTOR_GOOGLE_DRIVE");
-        static const int STORAGE_CONNECTOR_ONE_DRIVE_HASH = HashingUtils::HashString("STORAGE_CONNECTOR_ONE_DRIVE");
-        static const int REDIRECT_URL_HASH = HashingUtils::HashString("REDIRECT_URL");
-        static const int FEEDBACK_URL_HASH = HashingUtils::HashString("FEEDBACK_URL");
-        static const int THEME_NAME_HASH = HashingUtils::HashString("THEME_NAME");
-        static const int USER_SETTINGS_HASH = HashingUtils::HashString("USER_SETTINGS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STORAGE_CONNECTORS",
+          "STORAGE_CONNECTOR_HOMEFOLDERS",
+          "STORAGE_CONNECTOR_GOOGLE_DRIVE",
+          "STORAGE_CONNECTOR_ONE_DRIVE",
+          "REDIRECT_URL",
+          "FEEDBACK_URL",
+          "THEME_NAME",
+          "USER_SETTINGS",
+        };
 
         StackAttribute GetStackAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STORAGE_CONNECTORS_HASH)
-          {
-            return StackAttribute::STORAGE_CONNECTORS;
-          }
-          else if (hashCode == STORAGE_CONNECTOR_HOMEFOLDERS_HASH)
-          {
-            return StackAttribute::STORAGE_CONNECTOR_HOMEFOLDERS;
-          }
-          else if (hashCode == STORAGE_CONNECTOR_GOOGLE_DRIVE_HASH)
-          {
-            return StackAttribute::STORAGE_CONNECTOR_GOOGLE_DRIVE;
-          }
-          else if (hashCode == STORAGE_CONNECTOR_ONE_DRIVE_HASH)
-          {
-            return StackAttribute::STORAGE_CONNECTOR_ONE_DRIVE;
-          }
-          else if (hashCode == REDIRECT_URL_HASH)
-          {
-            return StackAttribute::REDIRECT_URL;
-          }
-          else if (hashCode == FEEDBACK_URL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StackAttribute::FEEDBACK_URL;
-          }
-          else if (hashCode == THEME_NAME_HASH)
-          {
-            return StackAttribute::THEME_NAME;
-          }
-          else if (hashCode == USER_SETTINGS_HASH)
-          {
-            return StackAttribute::USER_SETTINGS;
+          case 1500123690:
+            if (name == "STORAGE_CONNECTORS")
+            {
+              return StackAttribute::STORAGE_CONNECTORS;
+            }
+            break;
+          case 2059679728:
+            if (name == "STORAGE_CONNECTOR_HOMEFOLDERS")
+            {
+              return StackAttribute::STORAGE_CONNECTOR_HOMEFOLDERS;
+            }
+            break;
+          case 1709668634:
+            if (name == "STORAGE_CONNECTOR_GOOGLE_DRIVE")
+            {
+              return StackAttribute::STORAGE_CONNECTOR_GOOGLE_DRIVE;
+            }
+            break;
+          case -1626278725:
+            if (name == "STORAGE_CONNECTOR_ONE_DRIVE")
+            {
+              return StackAttribute::STORAGE_CONNECTOR_ONE_DRIVE;
+            }
+            break;
+          case -1025502612:
+            if (name == "REDIRECT_URL")
+            {
+              return StackAttribute::REDIRECT_URL;
+            }
+            break;
+          case 592775573:
+            if (name == "FEEDBACK_URL")
+            {
+              return StackAttribute::FEEDBACK_URL;
+            }
+            break;
+          case 1063702369:
+            if (name == "THEME_NAME")
+            {
+              return StackAttribute::THEME_NAME;
+            }
+            break;
+          case -1697509865:
+            if (name == "USER_SETTINGS")
+            {
+              return StackAttribute::USER_SETTINGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return StackAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForStackAttribute(StackAttribute enumValue)
+        const char* GetNameForStackAttributeCStr(StackAttribute enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackAttribute::STORAGE_CONNECTORS:
-            return "STORAGE_CONNECTORS";
-          case StackAttribute::STORAGE_CONNECTOR_HOMEFOLDERS:
-            return "STORAGE_CONNECTOR_HOMEFOLDERS";
-          case StackAttribute::STORAGE_CONNECTOR_GOOGLE_DRIVE:
-            return "STORAGE_CONNECTOR_GOOGLE_DRIVE";
-          case StackAttribute::STORAGE_CONNECTOR_ONE_DRIVE:
-            return "STORAGE_CONNECTOR_ONE_DRIVE";
-          case StackAttribute::REDIRECT_URL:
-            return "REDIRECT_URL";
-          case StackAttribute::FEEDBACK_URL:
-            return "FEEDBACK_URL";
-          case StackAttribute::THEME_NAME:
-            return "THEME_NAME";
-          case StackAttribute::USER_SETTINGS:
-            return "USER_SETTINGS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackAttribute(StackAttribute enumValue)
+        {
+          return GetNameForStackAttributeCStr(enumValue);
         }
 
       } // namespace StackAttributeMapper
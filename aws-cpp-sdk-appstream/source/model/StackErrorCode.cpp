@@ -30,20 +30,37 @@ namespace Aws
       namespace StackErrorCodeMapper
       {
 
-        static const int STORAGE_CONNECTOR_ERROR_HASH = HashingUtils::HashString("STORAGE_CONNECTOR_ERROR");
-        static const int INTERNAL_SERVICE_ERROR_HASH = HashingUtils::HashString("INTERNAL_SERVICE_ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STORAGE_CONNECTOR_ERROR",
+          "INTERNAL_SERVICE_ERROR",
+        };
 
         StackErrorCode GetStackErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STORAGE_CONNECTOR_ERROR_HASH)
-          {
-            return StackErrorCode::STORAGE_CONNECTOR_ERROR;
-          }
-          else if (hashCode == INTERNAL_SERVICE_ERROR_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StackErrorCode::INTERNAL_SERVICE_ERROR;
+          case 271169906:
+            if (name == "STORAGE_CONNECTOR_ERROR")
+            {
+              return StackErrorCode::STORAGE_CONNECTOR_ERROR;
+            }
+            break;
+          case 2056521148:
+            if (name == "INTERNAL_SERVICE_ERROR")
+            {
+              return StackErrorCode::INTERNAL_SERVICE_ERROR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return StackErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForStackErrorCode(StackErrorCode enumValue)
+        const char* GetNameForStackErrorCodeCStr(StackErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackErrorCode::STORAGE_CONNECTOR_ERROR:
-            return "STORAGE_CONNECTOR_ERROR";
-          case StackErrorCode::INTERNAL_SERVICE_ERROR:
-            return "INTERNAL_SERVICE_ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackErrorCode(StackErrorCode enumValue)
+        {
+          return GetNameForStackErrorCodeCStr(enumValue);
         }
 
       } // namespace StackErrorCodeMapper
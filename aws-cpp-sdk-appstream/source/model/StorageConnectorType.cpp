@@ -30,25 +30,44 @@ namespace Aws
       namespace StorageConnectorTypeMapper
       {
 
-        static const int HOMEFOLDERS_HASH = HashingUtils::HashString("HOMEFOLDERS");
-        static const int GOOGLE_DRIVE_HASH = HashingUtils::HashString("GOOGLE_DRIVE");
-        static const int ONE_DRIVE_HASH = HashingUtils::HashString("ONE_DRIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HOMEFOLDERS",
+          "GOOGLE_DRIVE",
+          "ONE_DRIVE",
+        };
 
         StorageConnectorType GetStorageConnectorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HOMEFOLDERS_HASH)
-          {
-            return StorageConnectorType::HOMEFOLDERS;
-          }
-          else if (hashCode == GOOGLE_DRIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StorageConnectorType::GOOGLE_DRIVE;
-          }
-          else if (hashCode == ONE_DRIVE_HASH)
-          {
-            return StorageConnectorType::ONE_DRIVE;
+          case -581654554:
+            if (name == "HOMEFOLDERS")
+            {
+              return StorageConnectorType::HOMEFOLDERS;
+            }
+            break;
+          case 1432684516:
+            if (name == "GOOGLE_DRIVE")
+            {
+              return StorageConnectorType::GOOGLE_DRIVE;
+            }
+            break;
+          case 1338567217:
+            if (name == "ONE_DRIVE")
+            {
+              return StorageConnectorType::ONE_DRIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StorageConnectorType::NOT_SET;
         }
 
-        Aws::String GetNameForStorageConnectorType(StorageConnectorType enumValue)
+        const char* GetNameForStorageConnectorTypeCStr(StorageConnectorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StorageConnectorType::HOMEFOLDERS:
-            return "HOMEFOLDERS";
-          case StorageConnectorType::GOOGLE_DRIVE:
-            return "GOOGLE_DRIVE";
-          case StorageConnectorType::ONE_DRIVE:
-            return "ONE_DRIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStorageConnectorType(StorageConnectorType enumValue)
+        {
+          return GetNameForStorageConnectorTypeCStr(enumValue);
         }
 
       } // namespace StorageConnectorTypeMapper
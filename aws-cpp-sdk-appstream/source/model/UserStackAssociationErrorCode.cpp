@@ -30,25 +30,44 @@ namespace Aws
       namespace UserStackAssociationErrorCodeMapper
       {
 
-        static const int STACK_NOT_FOUND_HASH = HashingUtils::HashString("STACK_NOT_FOUND");
-        static const int USER_NAME_NOT_FOUND_HASH = HashingUtils::HashString("USER_NAME_NOT_FOUND");
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STACK_NOT_FOUND",
+          "USER_NAME_NOT_FOUND",
+          "INTERNAL_ERROR",
+        };
 
         UserStackAssociationErrorCode GetUserStackAssociationErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STACK_NOT_FOUND_HASH)
-          {
-            return UserStackAssociationErrorCode::STACK_NOT_FOUND;
-          }
-          else if (hashCode == USER_NAME_NOT_FOUND_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UserStackAssociationErrorCode::USER_NAME_NOT_FOUND;
-          }
-          else if (hashCode == INTERNAL_ERROR_HASH)
-          {
-            return UserStackAssociationErrorCode::INTERNAL_ERROR;
+          case 1424753087:
+            if (name == "STACK_NOT_FOUND")
+            {
+              return UserStackAssociationErrorCode::STACK_NOT_FOUND;
+            }
+            break;
+          case 318190870:
+            if (name == "USER_NAME_NOT_FOUND")
+            {
+              return UserStackAssociationErrorCode::USER_NAME_NOT_FOUND;
+            }
+            break;
+          case -485608986:
+            if (name == "INTERNAL_ERROR")
+            {
+              return UserStackAssociationErrorCode::INTERNAL_ERROR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return UserStackAssociationErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForUserStackAssociationErrorCode(UserStackAssociationErrorCode enumValue)
+        const char* GetNameForUserStackAssociationErrorCodeCStr(UserStackAssociationErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UserStackAssociationErrorCode::STACK_NOT_FOUND:
-            return "STACK_NOT_FOUND";
-          case UserStackAssociationErrorCode::USER_NAME_NOT_FOUND:
-            return "USER_NAME_NOT_FOUND";
-          case UserStackAssociationErrorCode::INTERNAL_ERROR:
-            return "INTERNAL_ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUserStackAssociationErrorCode(UserStackAssociationErrorCode enumValue)
+        {
+          return GetNameForUserStackAssociationErrorCodeCStr(enumValue);
         }
 
       } // namespace UserStackAssociationErrorCodeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace VisibilityTypeMapper
       {
 
-        static const int PUBLIC__HASH = HashingUtils::HashString("PUBLIC");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
-        static const int SHARED_HASH = HashingUtils::HashString("SHARED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PUBLIC",
+          "PRIVATE",
+          "SHARED",
+        };
 
         VisibilityType GetVisibilityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PUBLIC__HASH)
-          {
-            return VisibilityType::PUBLIC_;
-          }
-          else if (hashCode == PRIVATE__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VisibilityType::PRIVATE_;
-          }
-          else if (hashCode == SHARED_HASH)
-          {
-            return VisibilityType::SHARED;
+          case -1924094359:
+            if (name == "PUBLIC")
+            {
+              return VisibilityType::PUBLIC_;
+            }
+            break;
+          case 403485027:
+            if (name == "PRIVATE")
+            {
+              return VisibilityType::PRIVATE_;
+            }
+            break;
+          case -1850236827:
+            if (name == "SHARED")
+            {
+              return VisibilityType::SHARED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return VisibilityType::NOT_SET;
         }
 
-        Aws::String GetNameForVisibilityType(VisibilityType enumValue)
+        const char* GetNameForVisibilityTypeCStr(VisibilityType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VisibilityType::PUBLIC_:
-            return "PUBLIC";
-          case VisibilityType::PRIVATE_:
-            return "PRIVATE";
-          case VisibilityType::SHARED:
-            return "SHARED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVisibilityType(VisibilityType enumValue)
+        {
+          return GetNameForVisibilityTypeCStr(enumValue);
         }
 
       } // namespace VisibilityTypeMapper
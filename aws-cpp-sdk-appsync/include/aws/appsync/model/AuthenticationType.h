@@ -37,6 +37,11 @@ namespace AuthenticationTypeMapper
 AWS_APPSYNC_API AuthenticationType GetAuthenticationTypeForName(const Aws::String& name);
 
 AWS_APPSYNC_API Aws::String GetNameForAuthenticationType(AuthenticationType value);
+
+/**
+ * Same as GetNameForAuthenticationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSYNC_API const char* GetNameForAuthenticationTypeCStr(AuthenticationType value);
 } // namespace AuthenticationTypeMapper
 } // namespace Model
 } // namespace AppSync
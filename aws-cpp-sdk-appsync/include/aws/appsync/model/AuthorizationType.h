@@ -34,6 +34,11 @@ namespace AuthorizationTypeMapper
 AWS_APPSYNC_API AuthorizationType GetAuthorizationTypeForName(const Aws::String& name);
 
 AWS_APPSYNC_API Aws::String GetNameForAuthorizationType(AuthorizationType value);
+
+/**
+ * Same as GetNameForAuthorizationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSYNC_API const char* GetNameForAuthorizationTypeCStr(AuthorizationType value);
 } // namespace AuthorizationTypeMapper
 } // namespace Model
 } // namespace AppSync
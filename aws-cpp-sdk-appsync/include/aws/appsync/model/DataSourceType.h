@@ -39,6 +39,11 @@ namespace DataSourceTypeMapper
 AWS_APPSYNC_API DataSourceType GetDataSourceTypeForName(const Aws::String& name);
 
 AWS_APPSYNC_API Aws::String GetNameForDataSourceType(DataSourceType value);
+
+/**
+ * Same as GetNameForDataSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSYNC_API const char* GetNameForDataSourceTypeCStr(DataSourceType value);
 } // namespace DataSourceTypeMapper
 } // namespace Model
 } // namespace AppSync
@@ -35,6 +35,11 @@ namespace DefaultActionMapper
 AWS_APPSYNC_API DefaultAction GetDefaultActionForName(const Aws::String& name);
 
 AWS_APPSYNC_API Aws::String GetNameForDefaultAction(DefaultAction value);
+
+/**
+ * Same as GetNameForDefaultAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSYNC_API const char* GetNameForDefaultActionCStr(DefaultAction value);
 } // namespace DefaultActionMapper
 } // namespace Model
 } // namespace AppSync
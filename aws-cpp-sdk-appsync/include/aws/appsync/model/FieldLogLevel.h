@@ -36,6 +36,11 @@ namespace FieldLogLevelMapper
 AWS_APPSYNC_API FieldLogLevel GetFieldLogLevelForName(const Aws::String& name);
 
 AWS_APPSYNC_API Aws::String GetNameForFieldLogLevel(FieldLogLevel value);
+
+/**
+ * Same as GetNameForFieldLogLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSYNC_API const char* GetNameForFieldLogLevelCStr(FieldLogLevel value);
 } // namespace FieldLogLevelMapper
 } // namespace Model
 } // namespace AppSync
@@ -35,6 +35,11 @@ namespace OutputTypeMapper
 AWS_APPSYNC_API OutputType GetOutputTypeForName(const Aws::String& name);
 
 AWS_APPSYNC_API Aws::String GetNameForOutputType(OutputType value);
+
+/**
+ * Same as GetNameForOutputType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSYNC_API const char* GetNameForOutputTypeCStr(OutputType value);
 } // namespace OutputTypeMapper
 } // namespace Model
 } // namespace AppSync
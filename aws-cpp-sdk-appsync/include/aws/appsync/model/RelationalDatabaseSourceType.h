@@ -34,6 +34,11 @@ namespace RelationalDatabaseSourceTypeMapper
 AWS_APPSYNC_API RelationalDatabaseSourceType GetRelationalDatabaseSourceTypeForName(const Aws::String& name);
 
 AWS_APPSYNC_API Aws::String GetNameForRelationalDatabaseSourceType(RelationalDatabaseSourceType value);
+
+/**
+ * Same as GetNameForRelationalDatabaseSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSYNC_API const char* GetNameForRelationalDatabaseSourceTypeCStr(RelationalDatabaseSourceType value);
 } // namespace RelationalDatabaseSourceTypeMapper
 } // namespace Model
 } // namespace AppSync
@@ -35,6 +35,11 @@ namespace ResolverKindMapper
 AWS_APPSYNC_API ResolverKind GetResolverKindForName(const Aws::String& name);
 
 AWS_APPSYNC_API Aws::String GetNameForResolverKind(ResolverKind value);
+
+/**
+ * Same as GetNameForResolverKind(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSYNC_API const char* GetNameForResolverKindCStr(ResolverKind value);
 } // namespace ResolverKindMapper
 } // namespace Model
 } // namespace AppSync
@@ -36,6 +36,11 @@ namespace SchemaStatusMapper
 AWS_APPSYNC_API SchemaStatus GetSchemaStatusForName(const Aws::String& name);
 
 AWS_APPSYNC_API Aws::String GetNameForSchemaStatus(SchemaStatus value);
+
+/**
+ * Same as GetNameForSchemaStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSYNC_API const char* GetNameForSchemaStatusCStr(SchemaStatus value);
 } // namespace SchemaStatusMapper
 } // namespace Model
 } // namespace AppSync
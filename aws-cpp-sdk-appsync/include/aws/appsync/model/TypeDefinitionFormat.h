@@ -35,6 +35,11 @@ namespace TypeDefinitionFormatMapper
 AWS_APPSYNC_API TypeDefinitionFormat GetTypeDefinitionFormatForName(const Aws::String& name);
 
 AWS_APPSYNC_API Aws::String GetNameForTypeDefinitionFormat(TypeDefinitionFormat value);
+
+/**
+ * Same as GetNameForTypeDefinitionFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPSYNC_API const char* GetNameForTypeDefinitionFormatCStr(TypeDefinitionFormat value);
 } // namespace TypeDefinitionFormatMapper
 } // namespace Model
 } // namespace AppSync
@@ -30,30 +30,51 @@ namespace Aws
       namespace AuthenticationTypeMapper
       {
 
-        static const int API_KEY_HASH = HashingUtils::HashString("API_KEY");
-        static const int AWS_IAM_HASH = HashingUtils::HashString("AWS_IAM");
-        static const int AMAZON_COGNITO_USER_POOLS_HASH = HashingUtils::HashString("AMAZON_COGNITO_USER_POOLS");
-        static const int OPENID_CONNECT_HASH = HashingUtils::HashString("OPENID_CONNECT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "API_KEY",
+          "AWS_IAM",
+          "AMAZON_COGNITO_USER_POOLS",
+          "OPENID_CONNECT",
+        };
 
         AuthenticationType GetAuthenticationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == API_KEY_HASH)
-          {
-            return AuthenticationType::API_KEY;
-          }
-          else if (hashCode == AWS_IAM_HASH)
-          {
-            return AuthenticationType::AWS_IAM;
-          }
-          else if (hashCode == AMAZON_COGNITO_USER_POOLS_HASH)
-          {
-            return AuthenticationType::AMAZON_COGNITO_USER_POOLS;
-          }
-          else if (hashCode == OPENID_CONNECT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthenticationType::OPENID_CONNECT;
+          case -81149318:
+            if (name == "API_KEY")
+            {
+              return AuthenticationType::API_KEY;
+            }
+            break;
+          case 128487891:
+            if (name == "AWS_IAM")
+            {
+              return AuthenticationType::AWS_IAM;
+            }
+            break;
+          case -1600818164:
+            if (name == "AMAZON_COGNITO_USER_POOLS")
+            {
+              return AuthenticationType::AMAZON_COGNITO_USER_POOLS;
+            }
+            break;
+          case -1474186384:
+            if (name == "OPENID_CONNECT")
+            {
+              return AuthenticationType::OPENID_CONNECT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AuthenticationType::NOT_SET;
         }
 
-        Aws::String GetNameForAuthenticationType(AuthenticationType enumValue)
+        const char* GetNameForAuthenticationTypeCStr(AuthenticationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthenticationType::API_KEY:
-            return "API_KEY";
-          case AuthenticationType::AWS_IAM:
-            return "AWS_IAM";
-          case AuthenticationType::AMAZON_COGNITO_USER_POOLS:
-            return "AMAZON_COGNITO_USER_POOLS";
-          case AuthenticationType::OPENID_CONNECT:
-            return "OPENID_CONNECT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthenticationType(AuthenticationType enumValue)
+        {
+          return GetNameForAuthenticationTypeCStr(enumValue);
         }
 
       } // namespace AuthenticationTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace AuthorizationTypeMapper
       {
 
-        static const int AWS_IAM_HASH = HashingUtils::HashString("AWS_IAM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AWS_IAM",
+        };
 
         AuthorizationType GetAuthorizationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_IAM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthorizationType::AWS_IAM;
+          case 128487891:
+            if (name == "AWS_IAM")
+            {
+              return AuthorizationType::AWS_IAM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return AuthorizationType::NOT_SET;
         }
 
-        Aws::String GetNameForAuthorizationType(AuthorizationType enumValue)
+        const char* GetNameForAuthorizationTypeCStr(AuthorizationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthorizationType::AWS_IAM:
-            return "AWS_IAM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthorizationType(AuthorizationType enumValue)
+        {
+          return GetNameForAuthorizationTypeCStr(enumValue);
         }
 
       } // namespace AuthorizationTypeMapper
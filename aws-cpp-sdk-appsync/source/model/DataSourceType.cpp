@@ -30,40 +30,65 @@ namespace Aws
       namespace DataSourceTypeMapper
       {
 
-        static const int AWS_LAMBDA_HASH = HashingUtils::HashString("AWS_LAMBDA");
-        static const int AMAZON_DYNAMODB_HASH = HashingUtils::HashString("AMAZON_DYNAMODB");
-        static const int AMAZON_ELASTICSEARCH_HASH = HashingUtils::HashString("AMAZON_ELASTICSEARCH");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-        static const int RELATIONAL_DATABASE_HASH = HashingUtils::HashString("RELATIONAL_DATABASE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AWS_LAMBDA",
+          "AMAZON_DYNAMODB",
+          "AMAZON_ELASTICSEARCH",
+          "NONE",
+          "HTTP",
+          "RELATIONAL_DATABASE",
+        };
 
         DataSourceType GetDataSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_LAMBDA_HASH)
-          {
-            return DataSourceType::AWS_LAMBDA;
-          }
-          else if (hashCode == AMAZON_DYNAMODB_HASH)
-          {
-            return DataSourceType::AMAZON_DYNAMODB;
-          }
-          else if (hashCode == AMAZON_ELASTICSEARCH_HASH)
-          {
-            return DataSourceType::AMAZON_ELASTICSEARCH;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return DataSourceType::NONE;
-          }
-          else if (hashCode == HTTP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DataSourceType::HTTP;
-          }
-          else if (hashCode == RELATIONAL_DATABASE_HASH)
-          {
-            return DataSourceType::RELATIONAL_DATABASE;
+          case 1052853097:
+            if (name == "AWS_LAMBDA")
+            {
+              return DataSourceType::AWS_LAMBDA;
+            }
+            break;
+          case -282465661:
+            if (name == "AMAZON_DYNAMODB")
+            {
+              return DataSourceType::AMAZON_DYNAMODB;
+            }
+            break;
+          case 44888482:
+            if (name == "AMAZON_ELASTICSEARCH")
+            {
+              return DataSourceType::AMAZON_ELASTICSEARCH;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return DataSourceType::NONE;
+            }
+            break;
+          case 2228360:
+            if (name == "HTTP")
+            {
+              return DataSourceType::HTTP;
+            }
+            break;
+          case -574854253:
+            if (name == "RELATIONAL_DATABASE")
+            {
+              return DataSourceType::RELATIONAL_DATABASE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return DataSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForDataSourceType(DataSourceType enumValue)
+        const char* GetNameForDataSourceTypeCStr(DataSourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DataSourceType::AWS_LAMBDA:
-            return "AWS_LAMBDA";
-          case DataSourceType::AMAZON_DYNAMODB:
-            return "AMAZON_DYNAMODB";
-          case DataSourceType::AMAZON_ELASTICSEARCH:
-            return "AMAZON_ELASTICSEARCH";
-          case DataSourceType::NONE:
-            return "NONE";
-          case DataSourceType::HTTP:
-            return "HTTP";
-          case DataSourceType::RELATIONAL_DATABASE:
-            return "RELATIONAL_DATABASE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDataSourceType(DataSourceType enumValue)
+        {
+          return GetNameForDataSourceTypeCStr(enumValue);
         }
 
       } // namespace DataSourceTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DefaultActionMapper
       {
 
-        static const int ALLOW_HASH = HashingUtils::HashString("ALLOW");
-        static const int DENY_HASH = HashingUtils::HashString("DENY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALLOW",
+          "DENY",
+        };
 
         DefaultAction GetDefaultActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALLOW_HASH)
-          {
-            return DefaultAction::ALLOW;
-          }
-          else if (hashCode == DENY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DefaultAction::DENY;
+          case 62368553:
+            if (name == "ALLOW")
+            {
+              return DefaultAction::ALLOW;
+            }
+            break;
+          case 2094604:
+            if (name == "DENY")
+            {
+              return DefaultAction::DENY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DefaultAction::NOT_SET;
         }
 
-        Aws::String GetNameForDefaultAction(DefaultAction enumValue)
+        const char* GetNameForDefaultActionCStr(DefaultAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DefaultAction::ALLOW:
-            return "ALLOW";
-          case DefaultAction::DENY:
-            return "DENY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDefaultAction(DefaultAction enumValue)
+        {
+          return GetNameForDefaultActionCStr(enumValue);
         }
 
       } // namespace DefaultActionMapper
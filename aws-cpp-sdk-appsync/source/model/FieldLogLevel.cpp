@@ -30,25 +30,44 @@ namespace Aws
       namespace FieldLogLevelMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "ERROR",
+          "ALL",
+        };
 
         FieldLogLevel GetFieldLogLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return FieldLogLevel::NONE;
-          }
-          else if (hashCode == ERROR__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FieldLogLevel::ERROR_;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return FieldLogLevel::ALL;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return FieldLogLevel::NONE;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return FieldLogLevel::ERROR_;
+            }
+            break;
+          case 64897:
+            if (name == "ALL")
+            {
+              return FieldLogLevel::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FieldLogLevel::NOT_SET;
         }
 
-        Aws::String GetNameForFieldLogLevel(FieldLogLevel enumValue)
+        const char* GetNameForFieldLogLevelCStr(FieldLogLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FieldLogLevel::NONE:
-            return "NONE";
-          case FieldLogLevel::ERROR_:
-            return "ERROR";
-          case FieldLogLevel::ALL:
-            return "ALL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFieldLogLevel(FieldLogLevel enumValue)
+        {
+          return GetNameForFieldLogLevelCStr(enumValue);
         }
 
       } // namespace FieldLogLevelMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace OutputTypeMapper
       {
 
-        static const int SDL_HASH = HashingUtils::HashString("SDL");
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SDL",
+          "JSON",
+        };
 
         OutputType GetOutputTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SDL_HASH)
-          {
-            return OutputType::SDL;
-          }
-          else if (hashCode == JSON_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OutputType::JSON;
+          case 81947:
+            if (name == "SDL")
+            {
+              return OutputType::SDL;
+            }
+            break;
+          case 2286824:
+            if (name == "JSON")
+            {
+              return OutputType::JSON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OutputType::NOT_SET;
         }
 
-        Aws::String GetNameForOutputType(OutputType enumValue)
+        const char* GetNameForOutputTypeCStr(OutputType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OutputType::SDL:
-            return "SDL";
-          case OutputType::JSON:
-            return "JSON";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOutputType(OutputType enumValue)
+        {
+          return GetNameForOutputTypeCStr(enumValue);
         }
 
       } // namespace OutputTypeMapper
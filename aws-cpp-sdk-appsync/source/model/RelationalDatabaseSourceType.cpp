@@ -30,15 +30,30 @@ namespace Aws
       namespace RelationalDatabaseSourceTypeMapper
       {
 
-        static const int RDS_HTTP_ENDPOINT_HASH = HashingUtils::HashString("RDS_HTTP_ENDPOINT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RDS_HTTP_ENDPOINT",
+        };
 
         RelationalDatabaseSourceType GetRelationalDatabaseSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RDS_HTTP_ENDPOINT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RelationalDatabaseSourceType::RDS_HTTP_ENDPOINT;
+          case 495822862:
+            if (name == "RDS_HTTP_ENDPOINT")
+            {
+              return RelationalDatabaseSourceType::RDS_HTTP_ENDPOINT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return RelationalDatabaseSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForRelationalDatabaseSourceType(RelationalDatabaseSourceType enumValue)
+        const char* GetNameForRelationalDatabaseSourceTypeCStr(RelationalDatabaseSourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RelationalDatabaseSourceType::RDS_HTTP_ENDPOINT:
-            return "RDS_HTTP_ENDPOINT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRelationalDatabaseSourceType(RelationalDatabaseSourceType enumValue)
+        {
+          return GetNameForRelationalDatabaseSourceTypeCStr(enumValue);
         }
 
       } // namespace RelationalDatabaseSourceTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ResolverKindMapper
       {
 
-        static const int UNIT_HASH = HashingUtils::HashString("UNIT");
-        static const int PIPELINE_HASH = HashingUtils::HashString("PIPELINE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNIT",
+          "PIPELINE",
+        };
 
         ResolverKind GetResolverKindForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNIT_HASH)
-          {
-            return ResolverKind::UNIT;
-          }
-          else if (hashCode == PIPELINE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResolverKind::PIPELINE;
+          case 2609540:
+            if (name == "UNIT")
+            {
+              return ResolverKind::UNIT;
+            }
+            break;
+          case 410557090:
+            if (name == "PIPELINE")
+            {
+              return ResolverKind::PIPELINE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ResolverKind::NOT_SET;
         }
 
-        Aws::String GetNameForResolverKind(ResolverKind enumValue)
+        const char* GetNameForResolverKindCStr(ResolverKind enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResolverKind::UNIT:
-            return "UNIT";
-          case ResolverKind::PIPELINE:
-            return "PIPELINE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResolverKind(ResolverKind enumValue)
+        {
+          return GetNameForResolverKindCStr(enumValue);
         }
 
       } // namespace ResolverKindMapper
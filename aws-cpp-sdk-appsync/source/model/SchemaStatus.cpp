@@ -30,25 +30,44 @@ namespace Aws
       namespace SchemaStatusMapper
       {
 
-        static const int PROCESSING_HASH = HashingUtils::HashString("PROCESSING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PROCESSING",
+          "ACTIVE",
+          "DELETING",
+        };
 
         SchemaStatus GetSchemaStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROCESSING_HASH)
-          {
-            return SchemaStatus::PROCESSING;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SchemaStatus::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return SchemaStatus::DELETING;
+          case 907287315:
+            if (name == "PROCESSING")
+            {
+              return SchemaStatus::PROCESSING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return SchemaStatus::ACTIVE;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return SchemaStatus::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SchemaStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSchemaStatus(SchemaStatus enumValue)
+        const char* GetNameForSchemaStatusCStr(SchemaStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SchemaStatus::PROCESSING:
-            return "PROCESSING";
-          case SchemaStatus::ACTIVE:
-            return "ACTIVE";
-          case SchemaStatus::DELETING:
-            return "DELETING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSchemaStatus(SchemaStatus enumValue)
+        {
+          return GetNameForSchemaStatusCStr(enumValue);
         }
 
       } // namespace SchemaStatusMapper
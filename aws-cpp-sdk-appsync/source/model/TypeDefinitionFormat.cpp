@@ -30,20 +30,37 @@ namespace Aws
       namespace TypeDefinitionFormatMapper
       {
 
-        static const int SDL_HASH = HashingUtils::HashString("SDL");
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SDL",
+          "JSON",
+        };
 
         TypeDefinitionFormat GetTypeDefinitionFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SDL_HASH)
-          {
-            return TypeDefinitionFormat::SDL;
-          }
-          else if (hashCode == JSON_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TypeDefinitionFormat::JSON;
+          case 81947:
+            if (name == "SDL")
+            {
+              return TypeDefinitionFormat::SDL;
+            }
+            break;
+          case 2286824:
+            if (name == "JSON")
+            {
+              return TypeDefinitionFormat::JSON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TypeDefinitionFormat::NOT_SET;
         }
 
-        Aws::String GetNameForTypeDefinitionFormat(TypeDefinitionFormat enumValue)
+        const char* GetNameForTypeDefinitionFormatCStr(TypeDefinitionFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TypeDefinitionFormat::SDL:
-            return "SDL";
-          case TypeDefinitionFormat::JSON:
-            return "JSON";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTypeDefinitionFormat(TypeDefinitionFormat enumValue)
+        {
+          return GetNameForTypeDefinitionFormatCStr(enumValue);
         }
 
       } // namespace TypeDefinitionFormatMapper
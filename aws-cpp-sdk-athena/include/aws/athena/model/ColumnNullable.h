@@ -36,6 +36,11 @@ namespace ColumnNullableMapper
 AWS_ATHENA_API ColumnNullable GetColumnNullableForName(const Aws::String& name);
 
 AWS_ATHENA_API Aws::String GetNameForColumnNullable(ColumnNullable value);
+
+/**
+ * Same as GetNameForColumnNullable(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ATHENA_API const char* GetNameForColumnNullableCStr(ColumnNullable value);
 } // namespace ColumnNullableMapper
 } // namespace Model
 } // namespace Athena
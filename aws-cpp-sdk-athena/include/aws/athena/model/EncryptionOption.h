@@ -36,6 +36,11 @@ namespace EncryptionOptionMapper
 AWS_ATHENA_API EncryptionOption GetEncryptionOptionForName(const Aws::String& name);
 
 AWS_ATHENA_API Aws::String GetNameForEncryptionOption(EncryptionOption value);
+
+/**
+ * Same as GetNameForEncryptionOption(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ATHENA_API const char* GetNameForEncryptionOptionCStr(EncryptionOption value);
 } // namespace EncryptionOptionMapper
 } // namespace Model
 } // namespace Athena
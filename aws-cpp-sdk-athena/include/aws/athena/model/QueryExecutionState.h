@@ -38,6 +38,11 @@ namespace QueryExecutionStateMapper
 AWS_ATHENA_API QueryExecutionState GetQueryExecutionStateForName(const Aws::String& name);
 
 AWS_ATHENA_API Aws::String GetNameForQueryExecutionState(QueryExecutionState value);
+
+/**
+ * Same as GetNameForQueryExecutionState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ATHENA_API const char* GetNameForQueryExecutionStateCStr(QueryExecutionState value);
 } // namespace QueryExecutionStateMapper
 } // namespace Model
 } // namespace Athena
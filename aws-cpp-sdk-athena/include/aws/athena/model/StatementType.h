@@ -36,6 +36,11 @@ namespace StatementTypeMapper
 AWS_ATHENA_API StatementType GetStatementTypeForName(const Aws::String& name);
 
 AWS_ATHENA_API Aws::String GetNameForStatementType(StatementType value);
+
+/**
+ * Same as GetNameForStatementType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ATHENA_API const char* GetNameForStatementTypeCStr(StatementType value);
 } // namespace StatementTypeMapper
 } // namespace Model
 } // namespace Athena
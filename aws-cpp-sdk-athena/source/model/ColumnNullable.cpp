@@ -30,25 +30,44 @@ namespace Aws
       namespace ColumnNullableMapper
       {
 
-        static const int NOT_NULL_HASH = HashingUtils::HashString("NOT_NULL");
-        static const int NULLABLE_HASH = HashingUtils::HashString("NULLABLE");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NOT_NULL",
+          "NULLABLE",
+          "UNKNOWN",
+        };
 
         ColumnNullable GetColumnNullableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_NULL_HASH)
-          {
-            return ColumnNullable::NOT_NULL;
-          }
-          else if (hashCode == NULLABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ColumnNullable::NULLABLE;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return ColumnNullable::UNKNOWN;
+          case -1906409581:
+            if (name == "NOT_NULL")
+            {
+              return ColumnNullable::NOT_NULL;
+            }
+            break;
+          case -1123340447:
+            if (name == "NULLABLE")
+            {
+              return ColumnNullable::NULLABLE;
+            }
+            break;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return ColumnNullable::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ColumnNullable::NOT_SET;
         }
 
-        Aws::String GetNameForColumnNullable(ColumnNullable enumValue)
+        const char* GetNameForColumnNullableCStr(ColumnNullable enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ColumnNullable::NOT_NULL:
-            return "NOT_NULL";
-          case ColumnNullable::NULLABLE:
-            return "NULLABLE";
-          case ColumnNullable::UNKNOWN:
-            return "UNKNOWN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForColumnNullable(ColumnNullable enumValue)
+        {
+          return GetNameForColumnNullableCStr(enumValue);
         }
 
       } // namespace ColumnNullableMapper
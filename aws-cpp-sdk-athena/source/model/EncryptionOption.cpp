@@ -30,25 +30,44 @@ namespace Aws
       namespace EncryptionOptionMapper
       {
 
-        static const int SSE_S3_HASH = HashingUtils::HashString("SSE_S3");
-        static const int SSE_KMS_HASH = HashingUtils::HashString("SSE_KMS");
-        static const int CSE_KMS_HASH = HashingUtils::HashString("CSE_KMS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SSE_S3",
+          "SSE_KMS",
+          "CSE_KMS",
+        };
 
         EncryptionOption GetEncryptionOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSE_S3_HASH)
-          {
-            return EncryptionOption::SSE_S3;
-          }
-          else if (hashCode == SSE_KMS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EncryptionOption::SSE_KMS;
-          }
-          else if (hashCode == CSE_KMS_HASH)
-          {
-            return EncryptionOption::CSE_KMS;
+          case -1839946022:
+            if (name == "SSE_S3")
+            {
+              return EncryptionOption::SSE_S3;
+            }
+            break;
+          case -1203758633:
+            if (name == "SSE_KMS")
+            {
+              return EncryptionOption::SSE_KMS;
+            }
+            break;
+          case 1776051655:
+            if (name == "CSE_KMS")
+            {
+              return EncryptionOption::CSE_KMS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EncryptionOption::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionOption(EncryptionOption enumValue)
+        const char* GetNameForEncryptionOptionCStr(EncryptionOption enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EncryptionOption::SSE_S3:
-            return "SSE_S3";
-          case EncryptionOption::SSE_KMS:
-            return "SSE_KMS";
-          case EncryptionOption::CSE_KMS:
-            return "CSE_KMS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEncryptionOption(EncryptionOption enumValue)
+        {
+          return GetNameForEncryptionOptionCStr(enumValue);
         }
 
       } // namespace EncryptionOptionMapper
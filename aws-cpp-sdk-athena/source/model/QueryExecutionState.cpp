@@ -30,35 +30,58 @@ namespace Aws
       namespace QueryExecutionStateMapper
       {
 
-        static const int QUEUED_HASH = HashingUtils::HashString("QUEUED");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "QUEUED",
+          "RUNNING",
+          "SUCCEEDED",
+          "FAILED",
+          "CANCELLED",
+        };
 
         QueryExecutionState GetQueryExecutionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == QUEUED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return QueryExecutionState::QUEUED;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return QueryExecutionState::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return QueryExecutionState::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return QueryExecutionState::FAILED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return QueryExecutionState::CANCELLED;
+          case -1895367309:
+            if (name == "QUEUED")
+            {
+              return QueryExecutionState::QUEUED;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return QueryExecutionState::RUNNING;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return QueryExecutionState::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return QueryExecutionState::FAILED;
+            }
+            break;
+          case -1031784143:
+            if (name == "CANCELLED")
+            {
+              return QueryExecutionState::CANCELLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return QueryExecutionState::NOT_SET;
         }
 
-        Aws::String GetNameForQueryExecutionState(QueryExecutionState enumValue)
+        const char* GetNameForQueryExecutionStateCStr(QueryExecutionState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QueryExecutionState::QUEUED:
-            return "QUEUED";
-          case QueryExecutionState::RUNNING:
-            return "RUNNING";
-          case QueryExecutionState::SUCCEEDED:
-            return "SUCCEEDED";
-          case QueryExecutionState::FAILED:
-            return "FAILED";
-          case QueryExecutionState::CANCELLED:
-            return "CANCELLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQueryExecutionState(QueryExecutionState enumValue)
+        {
+          return GetNameForQueryExecutionStateCStr(enumValue);
         }
 
       } // namespace QueryExecutionStateMapper
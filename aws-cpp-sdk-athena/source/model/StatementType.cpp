@@ -30,25 +30,44 @@ namespace Aws
       namespace StatementTypeMapper
       {
 
-        static const int DDL_HASH = HashingUtils::HashString("DDL");
-        static const int DML_HASH = HashingUtils::HashString("DML");
-        static const int UTILITY_HASH = HashingUtils::HashString("UTILITY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DDL",
+          "DML",
+          "UTILITY",
+        };
 
         StatementType GetStatementTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DDL_HASH)
-          {
-            return StatementType::DDL;
-          }
-          else if (hashCode == DML_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StatementType::DML;
-          }
-          else if (hashCode == UTILITY_HASH)
-          {
-            return StatementType::UTILITY;
+          case 67532:
+            if (name == "DDL")
+            {
+              return StatementType::DDL;
+            }
+            break;
+          case 67811:
+            if (name == "DML")
+            {
+              return StatementType::DML;
+            }
+            break;
+          case 603004236:
+            if (name == "UTILITY")
+            {
+              return StatementType::UTILITY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StatementType::NOT_SET;
         }
 
-        Aws::String GetNameForStatementType(StatementType enumValue)
+        const char* GetNameForStatementTypeCStr(StatementType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StatementType::DDL:
-            return "DDL";
-          case StatementType::DML:
-            return "DML";
-          case StatementType::UTILITY:
-            return "UTILITY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatementType(StatementType enumValue)
+        {
+          return GetNameForStatementTypeCStr(enumValue);
         }
 
       } // namespace StatementTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ThrottleReasonMapper
       {
 
-        static const int CONCURRENT_QUERY_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("CONCURRENT_QUERY_LIMIT_EXCEEDED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONCURRENT_QUERY_LIMIT_EXCEEDED",
+        };
 
         ThrottleReason GetThrottleReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONCURRENT_QUERY_LIMIT_EXCEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ThrottleReason::CONCURRENT_QUERY_LIMIT_EXCEEDED;
+          case 1837291894:
+            if (name == "CONCURRENT_QUERY_LIMIT_EXCEEDED")
+            {
+              return ThrottleReason::CONCURRENT_QUERY_LIMIT_EXCEEDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ThrottleReason::NOT_SET;
         }
 
-        Aws::String GetNameForThrottleReason(ThrottleReason enumValue)
+        const char* GetNameForThrottleReasonCStr(ThrottleReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ThrottleReason::CONCURRENT_QUERY_LIMIT_EXCEEDED:
-            return "CONCURRENT_QUERY_LIMIT_EXCEEDED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForThrottleReason(ThrottleReason enumValue)
+        {
+          return GetNameForThrottleReasonCStr(enumValue);
         }
 
       } // namespace ThrottleReasonMapper
@@ -37,6 +37,11 @@ namespace ForecastDataTypeMapper
 AWS_AUTOSCALINGPLANS_API ForecastDataType GetForecastDataTypeForName(const Aws::String& name);
 
 AWS_AUTOSCALINGPLANS_API Aws::String GetNameForForecastDataType(ForecastDataType value);
+
+/**
+ * Same as GetNameForForecastDataType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALINGPLANS_API const char* GetNameForForecastDataTypeCStr(ForecastDataType value);
 } // namespace ForecastDataTypeMapper
 } // namespace Model
 } // namespace AutoScalingPlans
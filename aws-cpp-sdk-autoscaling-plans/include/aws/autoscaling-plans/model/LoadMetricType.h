@@ -37,6 +37,11 @@ namespace LoadMetricTypeMapper
 AWS_AUTOSCALINGPLANS_API LoadMetricType GetLoadMetricTypeForName(const Aws::String& name);
 
 AWS_AUTOSCALINGPLANS_API Aws::String GetNameForLoadMetricType(LoadMetricType value);
+
+/**
+ * Same as GetNameForLoadMetricType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALINGPLANS_API const char* GetNameForLoadMetricTypeCStr(LoadMetricType value);
 } // namespace LoadMetricTypeMapper
 } // namespace Model
 } // namespace AutoScalingPlans
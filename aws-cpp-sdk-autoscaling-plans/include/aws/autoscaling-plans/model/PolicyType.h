@@ -34,6 +34,11 @@ namespace PolicyTypeMapper
 AWS_AUTOSCALINGPLANS_API PolicyType GetPolicyTypeForName(const Aws::String& name);
 
 AWS_AUTOSCALINGPLANS_API Aws::String GetNameForPolicyType(PolicyType value);
+
+/**
+ * Same as GetNameForPolicyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALINGPLANS_API const char* GetNameForPolicyTypeCStr(PolicyType value);
 } // namespace PolicyTypeMapper
 } // namespace Model
 } // namespace AutoScalingPlans
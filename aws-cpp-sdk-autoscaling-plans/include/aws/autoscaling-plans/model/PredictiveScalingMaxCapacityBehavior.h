@@ -36,6 +36,11 @@ namespace PredictiveScalingMaxCapacityBehaviorMapper
 AWS_AUTOSCALINGPLANS_API PredictiveScalingMaxCapacityBehavior GetPredictiveScalingMaxCapacityBehaviorForName(const Aws::String& name);
 
 AWS_AUTOSCALINGPLANS_API Aws::String GetNameForPredictiveScalingMaxCapacityBehavior(PredictiveScalingMaxCapacityBehavior value);
+
+/**
+ * Same as GetNameForPredictiveScalingMaxCapacityBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALINGPLANS_API const char* GetNameForPredictiveScalingMaxCapacityBehaviorCStr(PredictiveScalingMaxCapacityBehavior value);
 } // namespace PredictiveScalingMaxCapacityBehaviorMapper
 } // namespace Model
 } // namespace AutoScalingPlans
@@ -35,6 +35,11 @@ namespace PredictiveScalingModeMapper
 AWS_AUTOSCALINGPLANS_API PredictiveScalingMode GetPredictiveScalingModeForName(const Aws::String& name);
 
 AWS_AUTOSCALINGPLANS_API Aws::String GetNameForPredictiveScalingMode(PredictiveScalingMode value);
+
+/**
+ * Same as GetNameForPredictiveScalingMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALINGPLANS_API const char* GetNameForPredictiveScalingModeCStr(PredictiveScalingMode value);
 } // namespace PredictiveScalingModeMapper
 } // namespace Model
 } // namespace AutoScalingPlans
@@ -46,6 +46,11 @@ namespace ScalingMetricTypeMapper
 AWS_AUTOSCALINGPLANS_API ScalingMetricType GetScalingMetricTypeForName(const Aws::String& name);
 
 AWS_AUTOSCALINGPLANS_API Aws::String GetNameForScalingMetricType(ScalingMetricType value);
+
+/**
+ * Same as GetNameForScalingMetricType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALINGPLANS_API const char* GetNameForScalingMetricTypeCStr(ScalingMetricType value);
 } // namespace ScalingMetricTypeMapper
 } // namespace Model
 } // namespace AutoScalingPlans
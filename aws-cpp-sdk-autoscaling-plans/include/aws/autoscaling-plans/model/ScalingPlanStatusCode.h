@@ -41,6 +41,11 @@ namespace ScalingPlanStatusCodeMapper
 AWS_AUTOSCALINGPLANS_API ScalingPlanStatusCode GetScalingPlanStatusCodeForName(const Aws::String& name);
 
 AWS_AUTOSCALINGPLANS_API Aws::String GetNameForScalingPlanStatusCode(ScalingPlanStatusCode value);
+
+/**
+ * Same as GetNameForScalingPlanStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALINGPLANS_API const char* GetNameForScalingPlanStatusCodeCStr(ScalingPlanStatusCode value);
 } // namespace ScalingPlanStatusCodeMapper
 } // namespace Model
 } // namespace AutoScalingPlans
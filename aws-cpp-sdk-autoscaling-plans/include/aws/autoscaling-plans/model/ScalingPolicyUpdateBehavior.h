@@ -35,6 +35,11 @@ namespace ScalingPolicyUpdateBehaviorMapper
 AWS_AUTOSCALINGPLANS_API ScalingPolicyUpdateBehavior GetScalingPolicyUpdateBehaviorForName(const Aws::String& name);
 
 AWS_AUTOSCALINGPLANS_API Aws::String GetNameForScalingPolicyUpdateBehavior(ScalingPolicyUpdateBehavior value);
+
+/**
+ * Same as GetNameForScalingPolicyUpdateBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALINGPLANS_API const char* GetNameForScalingPolicyUpdateBehaviorCStr(ScalingPolicyUpdateBehavior value);
 } // namespace ScalingPolicyUpdateBehaviorMapper
 } // namespace Model
 } // namespace AutoScalingPlans
@@ -36,6 +36,11 @@ namespace ScalingStatusCodeMapper
 AWS_AUTOSCALINGPLANS_API ScalingStatusCode GetScalingStatusCodeForName(const Aws::String& name);
 
 AWS_AUTOSCALINGPLANS_API Aws::String GetNameForScalingStatusCode(ScalingStatusCode value);
+
+/**
+ * Same as GetNameForScalingStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALINGPLANS_API const char* GetNameForScalingStatusCodeCStr(ScalingStatusCode value);
 } // namespace ScalingStatusCodeMapper
 } // namespace Model
 } // namespace AutoScalingPlans
@@ -30,30 +30,51 @@ namespace Aws
       namespace ForecastDataTypeMapper
       {
 
-        static const int CapacityForecast_HASH = HashingUtils::HashString("CapacityForecast");
-        static const int LoadForecast_HASH = HashingUtils::HashString("LoadForecast");
-        static const int ScheduledActionMinCapacity_HASH = HashingUtils::HashString("ScheduledActionMinCapacity");
-        static const int ScheduledActionMaxCapacity_HASH = HashingUtils::HashString("ScheduledActionMaxCapacity");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CapacityForecast",
+          "LoadForecast",
+          "ScheduledActionMinCapacity",
+          "ScheduledActionMaxCapacity",
+        };
 
         ForecastDataType GetForecastDataTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CapacityForecast_HASH)
-          {
-            return ForecastDataType::CapacityForecast;
-          }
-          else if (hashCode == LoadForecast_HASH)
-          {
-            return ForecastDataType::LoadForecast;
-          }
-          else if (hashCode == ScheduledActionMinCapacity_HASH)
-          {
-            return ForecastDataType::ScheduledActionMinCapacity;
-          }
-          else if (hashCode == ScheduledActionMaxCapacity_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ForecastDataType::ScheduledActionMaxCapacity;
+          case 919219445:
+            if (name == "CapacityForecast")
+            {
+              return ForecastDataType::CapacityForecast;
+            }
+            break;
+          case 1914831137:
+            if (name == "LoadForecast")
+            {
+              return ForecastDataType::LoadForecast;
+            }
+            break;
+          case -852827127:
+            if (name == "ScheduledActionMinCapacity")
+            {
+              return ForecastDataType::ScheduledActionMinCapacity;
+            }
+            break;
+          case -175394533:
+            if (name == "ScheduledActionMaxCapacity")
+            {
+              return ForecastDataType::ScheduledActionMaxCapacity;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ForecastDataType::NOT_SET;
         }
 
-        Aws::String GetNameForForecastDataType(ForecastDataType enumValue)
+        const char* GetNameForForecastDataTypeCStr(ForecastDataType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ForecastDataType::CapacityForecast:
-            return "CapacityForecast";
-          case ForecastDataType::LoadForecast:
-            return "LoadForecast";
-          case ForecastDataType::ScheduledActionMinCapacity:
-            return "ScheduledActionMinCapacity";
-          case ForecastDataType::ScheduledActionMaxCapacity:
-            return "ScheduledActionMaxCapacity";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForForecastDataType(ForecastDataType enumValue)
+        {
+          return GetNameForForecastDataTypeCStr(enumValue);
         }
 
       } // namespace ForecastDataTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace LoadMetricTypeMapper
       {
 
-        static const int ASGTotalCPUUtilization_HASH = HashingUtils::HashString("ASGTotalCPUUtilization");
-        static const int ASGTotalNetworkIn_HASH = HashingUtils::HashString("ASGTotalNetworkIn");
-        static const int ASGTotalNetworkOut_HASH = HashingUtils::HashString("ASGTotalNetworkOut");
-        static const int ALBTargetGroupRequestCount_HASH = HashingUtils::HashString("ALBTargetGroupRequestCount");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ASGTotalCPUUtilization",
+          "ASGTotalNetworkIn",
+          "ASGTotalNetworkOut",
+          "ALBTargetGroupRequestCount",
+        };
 
         LoadMetricType GetLoadMetricTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASGTotalCPUUtilization_HASH)
-          {
-            return LoadMetricType::ASGTotalCPUUtilization;
-          }
-          else if (hashCode == ASGTotalNetworkIn_HASH)
-          {
-            return LoadMetricType::ASGTotalNetworkIn;
-          }
-          else if (hashCode == ASGTotalNetworkOut_HASH)
-          {
-            return LoadMetricType::ASGTotalNetworkOut;
-          }
-          else if (hashCode == ALBTargetGroupRequestCount_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadMetricType::ALBTargetGroupRequestCount;
+          case -1596877015:
+            if (name == "ASGTotalCPUUtilization")
+            {
+              return LoadMetricType::ASGTotalCPUUtilization;
+            }
+            break;
+          case -110832956:
+            if (name == "ASGTotalNetworkIn")
+            {
+              return LoadMetricType::ASGTotalNetworkIn;
+            }
+            break;
+          case 859151759:
+            if (name == "ASGTotalNetworkOut")
+            {
+              return LoadMetricType::ASGTotalNetworkOut;
+            }
+            break;
+          case -1237525801:
+            if (name == "ALBTargetGroupRequestCount")
+            {
+              return LoadMetricType::ALBTargetGroupRequestCount;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return LoadMetricType::NOT_SET;
         }
 
-        Aws::String GetNameForLoadMetricType(LoadMetricType enumValue)
+        const char* GetNameForLoadMetricTypeCStr(LoadMetricType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadMetricType::ASGTotalCPUUtilization:
-            return "ASGTotalCPUUtilization";
-          case LoadMetricType::ASGTotalNetworkIn:
-            return "ASGTotalNetworkIn";
-          case LoadMetricType::ASGTotalNetworkOut:
-            return "ASGTotalNetworkOut";
-          case LoadMetricType::ALBTargetGroupRequestCount:
-            return "ALBTargetGroupRequestCount";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadMetricType(LoadMetricType enumValue)
+        {
+          return GetNameForLoadMetricTypeCStr(enumValue);
         }
 
       } // namespace LoadMetricTypeMapper
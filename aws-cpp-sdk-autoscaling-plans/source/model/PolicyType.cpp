@@ -30,15 +30,30 @@ namespace Aws
       namespace PolicyTypeMapper
       {
 
-        static const int TargetTrackingScaling_HASH = HashingUtils::HashString("TargetTrackingScaling");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TargetTrackingScaling",
+        };
 
         PolicyType GetPolicyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TargetTrackingScaling_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PolicyType::TargetTrackingScaling;
+          case -903746849:
+            if (name == "TargetTrackingScaling")
+            {
+              return PolicyType::TargetTrackingScaling;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return PolicyType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyType(PolicyType enumValue)
+        const char* GetNameForPolicyTypeCStr(PolicyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PolicyType::TargetTrackingScaling:
-            return "TargetTrackingScaling";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPolicyType(PolicyType enumValue)
+        {
+          return GetNameForPolicyTypeCStr(enumValue);
         }
 
       } // namespace PolicyTypeMapper
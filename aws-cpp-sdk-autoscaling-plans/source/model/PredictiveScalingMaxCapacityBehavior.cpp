@@ -30,25 +30,44 @@ namespace Aws
       namespace PredictiveScalingMaxCapacityBehaviorMapper
       {
 
-        static const int SetForecastCapacityToMaxCapacity_HASH = HashingUtils::HashString("SetForecastCapacityToMaxCapacity");
-        static const int SetMaxCapacityToForecastCapacity_HASH = HashingUtils::HashString("SetMaxCapacityToForecastCapacity");
-        static const int SetMaxCapacityAboveForecastCapacity_HASH = HashingUtils::HashString("SetMaxCapacityAboveForecastCapacity");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SetForecastCapacityToMaxCapacity",
+          "SetMaxCapacityToForecastCapacity",
+          "SetMaxCapacityAboveForecastCapacity",
+        };
 
         PredictiveScalingMaxCapacityBehavior GetPredictiveScalingMaxCapacityBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SetForecastCapacityToMaxCapacity_HASH)
-          {
-            return PredictiveScalingMaxCapacityBehavior::SetForecastCapacityToMaxCapacity;
-          }
-          else if (hashCode == SetMaxCapacityToForecastCapacity_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PredictiveScalingMaxCapacityBehavior::SetMaxCapacityToForecastCapacity;
-          }
-          else if (hashCode == SetMaxCapacityAboveForecastCapacity_HASH)
-          {
-            return PredictiveScalingMaxCapacityBehavior::SetMaxCapacityAboveForecastCapacity;
+          case -1196954164:
+            if (name == "SetForecastCapacityToMaxCapacity")
+            {
+              return PredictiveScalingMaxCapacityBehavior::SetForecastCapacityToMaxCapacity;
+            }
+            break;
+          case -1491574228:
+            if (name == "SetMaxCapacityToForecastCapacity")
+            {
+              return PredictiveScalingMaxCapacityBehavior::SetMaxCapacityToForecastCapacity;
+            }
+            break;
+          case 1354149462:
+            if (name == "SetMaxCapacityAboveForecastCapacity")
+            {
+              return PredictiveScalingMaxCapacityBehavior::SetMaxCapacityAboveForecastCapacity;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PredictiveScalingMaxCapacityBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForPredictiveScalingMaxCapacityBehavior(PredictiveScalingMaxCapacityBehavior enumValue)
+        const char* GetNameForPredictiveScalingMaxCapacityBehaviorCStr(PredictiveScalingMaxCapacityBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PredictiveScalingMaxCapacityBehavior::SetForecastCapacityToMaxCapacity:
-            return "SetForecastCapacityToMaxCapacity";
-          case PredictiveScalingMaxCapacityBehavior::SetMaxCapacityToForecastCapacity:
-            return "SetMaxCapacityToForecastCapacity";
-          case PredictiveScalingMaxCapacityBehavior::SetMaxCapacityAboveForecastCapacity:
-            return "SetMaxCapacityAboveForecastCapacity";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPredictiveScalingMaxCapacityBehavior(PredictiveScalingMaxCapacityBehavior enumValue)
+        {
+          return GetNameForPredictiveScalingMaxCapacityBehaviorCStr(enumValue);
         }
 
       } // namespace PredictiveScalingMaxCapacityBehaviorMapper
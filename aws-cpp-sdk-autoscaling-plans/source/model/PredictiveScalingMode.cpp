@@ -30,20 +30,37 @@ namespace Aws
       namespace PredictiveScalingModeMapper
       {
 
-        static const int ForecastAndScale_HASH = HashingUtils::HashString("ForecastAndScale");
-        static const int ForecastOnly_HASH = HashingUtils::HashString("ForecastOnly");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ForecastAndScale",
+          "ForecastOnly",
+        };
 
         PredictiveScalingMode GetPredictiveScalingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ForecastAndScale_HASH)
-          {
-            return PredictiveScalingMode::ForecastAndScale;
-          }
-          else if (hashCode == ForecastOnly_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PredictiveScalingMode::ForecastOnly;
+          case 1834251502:
+            if (name == "ForecastAndScale")
+            {
+              return PredictiveScalingMode::ForecastAndScale;
+            }
+            break;
+          case -209240985:
+            if (name == "ForecastOnly")
+            {
+              return PredictiveScalingMode::ForecastOnly;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PredictiveScalingMode::NOT_SET;
         }
 
-        Aws::String GetNameForPredictiveScalingMode(PredictiveScalingMode enumValue)
+        const char* GetNameForPredictiveScalingModeCStr(PredictiveScalingMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PredictiveScalingMode::ForecastAndScale:
-            return "ForecastAndScale";
-          case PredictiveScalingMode::ForecastOnly:
-            return "ForecastOnly";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPredictiveScalingMode(PredictiveScalingMode enumValue)
+        {
+          return GetNameForPredictiveScalingModeCStr(enumValue);
         }
 
       } // namespace PredictiveScalingModeMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace ScalableDimensionMapper
       {
 
-        static const int autoscaling_autoScalingGroup_DesiredCapacity_HASH = HashingUtils::HashString("autoscaling:autoScalingGroup:DesiredCapacity");
-        static const int ecs_service_DesiredCount_HASH = HashingUtils::HashString("ecs:service:DesiredCount");
-        static const int ec2_spot_fleet_request_TargetCapacity_HASH = HashingUtils::HashString("ec2:spot-fleet-request:TargetCapacity");
-        static const int rds_cluster_ReadReplicaCount_HASH = HashingUtils::HashString("rds:cluster:ReadReplicaCount");
-        static const int dynamodb_table_ReadCapacityUnits_HASH = HashingUtils::HashString("dynamodb:table:ReadCapacityUnits");
-        static const int dynamodb_table_WriteCapacityUnits_HASH = HashingUtils::HashString("dynamodb:table:WriteCapacityUnits");
-        static const int dynamodb_index_ReadCapacityUnits_HASH = HashingUtils::HashString("dynamodb:index:ReadCapacityUnits");
-        static const int dynamodb_index_WriteCapacityUnits_HASH = HashingUtils::HashString("dynamodb:index:WriteCapacityUnits");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "autoscaling:autoScalingGroup:DesiredCapacity",
+          "ecs:service:DesiredCount",
+          "ec2:spot-fleet-request:TargetCapacity",
+          "rds:cluster:ReadReplicaCount",
+          "dynamodb:table:ReadCapacityUnits",
+          "dynamodb:table:WriteCapacityUnits",
+          "dynamodb:index:ReadCapacityUnits",
+          "dynamodb:index:WriteCapacityUnits",
+        };
 
         ScalableDimension GetScalableDimensionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == autoscaling_autoScalingGroup_DesiredCapacity_HASH)
-          {
-            return ScalableDimension::autoscaling_autoScalingGroup_DesiredCapacity;
-          }
-          else if (hashCode == ecs_service_DesiredCount_HASH)
-          {
-            return ScalableDimension::ecs_service_DesiredCount;
-          }
-          else if (hashCode == ec2_spot_fleet_request_TargetCapacity_HASH)
-          {
-            return ScalableDimension::ec2_spot_fleet_request_TargetCapacity;
-          }
-          else if (hashCode == rds_cluster_ReadReplicaCount_HASH)
-          {
-            return ScalableDimension::rds_cluster_ReadReplicaCount;
-          }
-          else if (hashCode == dynamodb_table_ReadCapacityUnits_HASH)
-          {
-            return ScalableDimension::dynamodb_table_ReadCapacityUnits;
-          }
-          else if (hashCode == dynamodb_table_WriteCapacityUnits_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalableDimension::dynamodb_table_WriteCapacityUnits;
-          }
-          else if (hashCode == dynamodb_index_ReadCapacityUnits_HASH)
-          {
-            return ScalableDimension::dynamodb_index_ReadCapacityUnits;
-          }
-          else if (hashCode == dynamodb_index_WriteCapacityUnits_HASH)
-          {
-            return ScalableDimension::dynamodb_index_WriteCapacityUnits;
+          case 1524425379:
+            if (name == "autoscaling:autoScalingGroup:DesiredCapacity")
+            {
+              return ScalableDimension::autoscaling_autoScalingGroup_DesiredCapacity;
+            }
+            break;
+          case -525255137:
+            if (name == "ecs:service:DesiredCount")
+            {
+              return ScalableDimension::ecs_service_DesiredCount;
+            }
+            break;
+          case 2103020410:
+            if (name == "ec2:spot-fleet-request:TargetCapacity")
+            {
+              return ScalableDimension::ec2_spot_fleet_request_TargetCapacity;
+            }
+            break;
+          case 119557734:
+            if (name == "rds:cluster:ReadReplicaCount")
+            {
+              return ScalableDimension::rds_cluster_ReadReplicaCount;
+            }
+            break;
+          case -2009983679:
+            if (name == "dynamodb:table:ReadCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_table_ReadCapacityUnits;
+            }
+            break;
+          case -996255468:
+            if (name == "dynamodb:table:WriteCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_table_WriteCapacityUnits;
+            }
+            break;
+          case 876955973:
+            if (name == "dynamodb:index:ReadCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_index_ReadCapacityUnits;
+            }
+            break;
+          case -1695439472:
+            if (name == "dynamodb:index:WriteCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_index_WriteCapacityUnits;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return ScalableDimension::NOT_SET;
         }
 
-        Aws::String GetNameForScalableDimension(ScalableDimension enumValue)
+        const char* GetNameForScalableDimensionCStr(ScalableDimension enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalableDimension::autoscaling_autoScalingGroup_DesiredCapacity:
-            return "autoscaling:autoScalingGroup:DesiredCapacity";
-          case ScalableDimension::ecs_service_DesiredCount:
-            return "ecs:service:DesiredCount";
-          case ScalableDimension::ec2_spot_fleet_request_TargetCapacity:
-            return "ec2:spot-fleet-request:TargetCapacity";
-          case ScalableDimension::rds_cluster_ReadReplicaCount:
-            return "rds:cluster:ReadReplicaCount";
-          case ScalableDimension::dynamodb_table_ReadCapacityUnits:
-            return "dynamodb:table:ReadCapacityUnits";
-          case ScalableDimension::dynamodb_table_WriteCapacityUnits:
-            return "dynamodb:table:WriteCapacityUnits";
-          case ScalableDimension::dynamodb_index_ReadCapacityUnits:
-            return "dynamodb:index:ReadCapacityUnits";
-          case ScalableDimension::dynamodb_index_WriteCapacityUnits:
-            return "dynamodb:index:WriteCapacityUnits";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalableDimension(ScalableDimension enumValue)
+        {
+          return GetNameForScalableDimensionCStr(enumValue);
         }
 
       } // namespace ScalableDimensionMapper
@@ -30,75 +30,114 @@ namespace Aws
       namespace ScalingMetricTypeMapper
       {
 
-        static const int ASGAverageCPUUtilization_HASH = HashingUtils::HashString("ASGAverageCPUUtilization");
-        static const int ASGAverageNetworkIn_HASH = HashingUtils::HashString("ASGAverageNetworkIn");
-        static const int ASGAverageNetworkOut_HASH = HashingUtils::HashString("ASGAverageNetworkOut");
-        static const int DynamoDBReadCapacityUtilization_HASH = HashingUtils::HashString("DynamoDBReadCapacityUtilization");
-        static const int DynamoDBWriteCapacityUtilization_HASH = HashingUtils::HashString("DynamoDBWriteCapacityUtilization");
-        static const int ECSServiceAverageCPUUtilization_HASH = HashingUtils::HashString("ECSServiceAverageCPUUtilization");
-        static const int ECSServiceAverageMemoryUtilization_HASH = HashingUtils::HashString("ECSServiceAverageMemoryUtilization");
-        static const int ALBRequestCountPerTarget_HASH = HashingUtils::HashString("ALBRequestCountPerTarget");
-        static const int RDSReaderAverageCPUUtilization_HASH = HashingUtils::HashString("RDSReaderAverageCPUUtilization");
-        static const int RDSReaderAverageDatabaseConnections_HASH = HashingUtils::HashString("RDSReaderAverageDatabaseConnections");
-        static const int EC2SpotFleetRequestAverageCPUUtilization_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageCPUUtilization");
-        static const int EC2SpotFleetRequestAverageNetworkIn_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageNetworkIn");
-        static const int EC2SpotFleetRequestAverageNetworkOut_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageNetworkOut");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ASGAverageCPUUtilization",
+          "ASGAverageNetworkIn",
+          "ASGAverageNetworkOut",
+          "DynamoDBReadCapacityUtilization",
+          "DynamoDBWriteCapacityUtilization",
+          "ECSServiceAverageCPUUtilization",
+          "ECSServiceAverageMemoryUtilization",
+          "ALBRequestCountPerTarget",
+          "RDSReaderAverageCPUUtilization",
+          "RDSReaderAverageDatabaseConnections",
+          "EC2SpotFleetRequestAverageCPUUtilization",
+          "EC2SpotFleetRequestAverageNetworkIn",
+          "EC2SpotFleetRequestAverageNetworkOut",
+        };
 
         ScalingMetricType GetScalingMetricTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASGAverageCPUUtilization_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalingMetricType::ASGAverageCPUUtilization;
-          }
-          else if (hashCode == ASGAverageNetworkIn_HASH)
-          {
-            return ScalingMetricType::ASGAverageNetworkIn;
-          }
-          else if (hashCode == ASGAverageNetworkOut_HASH)
-          {
-            return ScalingMetricType::ASGAverageNetworkOut;
-          }
-          else if (hashCode == DynamoDBReadCapacityUtilization_HASH)
-          {
-            return ScalingMetricType::DynamoDBReadCapacityUtilization;
-          }
-          else if (hashCode == DynamoDBWriteCapacityUtilization_HASH)
-          {
-            return ScalingMetricType::DynamoDBWriteCapacityUtilization;
-          }
-          else if (hashCode == ECSServiceAverageCPUUtilization_HASH)
-          {
-            return ScalingMetricType::ECSServiceAverageCPUUtilization;
-          }
-          else if (hashCode == ECSServiceAverageMemoryUtilization_HASH)
-          {
-            return ScalingMetricType::ECSServiceAverageMemoryUtilization;
-          }
-          else if (hashCode == ALBRequestCountPerTarget_HASH)
-          {
-            return ScalingMetricType::ALBRequestCountPerTarget;
-          }
-          else if (hashCode == RDSReaderAverageCPUUtilization_HASH)
-          {
-            return ScalingMetricType::RDSReaderAverageCPUUtilization;
-          }
-          else if (hashCode == RDSReaderAverageDatabaseConnections_HASH)
-          {
-            return ScalingMetricType::RDSReaderAverageDatabaseConnections;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageCPUUtilization_HASH)
-          {
-            return ScalingMetricType::EC2SpotFleetRequestAverageCPUUtilization;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageNetworkIn_HASH)
-          {
-            return ScalingMetricType::EC2SpotFleetRequestAverageNetworkIn;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageNetworkOut_HASH)
-          {
-            return ScalingMetricType::EC2SpotFleetRequestAverageNetworkOut;
+          case 1144585090:
+            if (name == "ASGAverageCPUUtilization")
+            {
+              return ScalingMetricType::ASGAverageCPUUtilization;
+            }
+            break;
+          case 2086951627:
+            if (name == "ASGAverageNetworkIn")
+            {
+              return ScalingMetricType::ASGAverageNetworkIn;
+            }
+            break;
+          case 270997096:
+            if (name == "ASGAverageNetworkOut")
+            {
+              return ScalingMetricType::ASGAverageNetworkOut;
+            }
+            break;
+          case -1193972822:
+            if (name == "DynamoDBReadCapacityUtilization")
+            {
+              return ScalingMetricType::DynamoDBReadCapacityUtilization;
+            }
+            break;
+          case 1632739729:
+            if (name == "DynamoDBWriteCapacityUtilization")
+            {
+              return ScalingMetricType::DynamoDBWriteCapacityUtilization;
+            }
+            break;
+          case -1310835401:
+            if (name == "ECSServiceAverageCPUUtilization")
+            {
+              return ScalingMetricType::ECSServiceAverageCPUUtilization;
+            }
+            break;
+          case -350849180:
+            if (name == "ECSServiceAverageMemoryUtilization")
+            {
+              return ScalingMetricType::ECSServiceAverageMemoryUtilization;
+            }
+            break;
+          case -947560457:
+            if (name == "ALBRequestCountPerTarget")
+            {
+              return ScalingMetricType::ALBRequestCountPerTarget;
+            }
+            break;
+          case -105772877:
+            if (name == "RDSReaderAverageCPUUtilization")
+            {
+              return ScalingMetricType::RDSReaderAverageCPUUtilization;
+            }
+            break;
+          case 645492513:
+            if (name == "RDSReaderAverageDatabaseConnections")
+            {
+              return ScalingMetricType::RDSReaderAverageDatabaseConnections;
+            }
+            break;
+          case 1384183840:
+            if (name == "EC2SpotFleetRequestAverageCPUUtilization")
+            {
+              return ScalingMetricType::EC2SpotFleetRequestAverageCPUUtilization;
+            }
+            break;
+          case 568095597:
+            if (name == "EC2SpotFleetRequestAverageNetworkIn")
+            {
+              return ScalingMetricType::EC2SpotFleetRequestAverageNetworkIn;
+            }
+            break;
+          case 431100422:
+            if (name == "EC2SpotFleetRequestAverageNetworkOut")
+            {
+              return ScalingMetricType::EC2SpotFleetRequestAverageNetworkOut;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,45 +149,26 @@ namespace Aws
           return ScalingMetricType::NOT_SET;
         }
 
-        Aws::String GetNameForScalingMetricType(ScalingMetricType enumValue)
+        const char* GetNameForScalingMetricTypeCStr(ScalingMetricType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalingMetricType::ASGAverageCPUUtilization:
-            return "ASGAverageCPUUtilization";
-          case ScalingMetricType::ASGAverageNetworkIn:
-            return "ASGAverageNetworkIn";
-          case ScalingMetricType::ASGAverageNetworkOut:
-            return "ASGAverageNetworkOut";
-          case ScalingMetricType::DynamoDBReadCapacityUtilization:
-            return "DynamoDBReadCapacityUtilization";
-          case ScalingMetricType::DynamoDBWriteCapacityUtilization:
-            return "DynamoDBWriteCapacityUtilization";
-          case ScalingMetricType::ECSServiceAverageCPUUtilization:
-            return "ECSServiceAverageCPUUtilization";
-          case ScalingMetricType::ECSServiceAverageMemoryUtilization:
-            return "ECSServiceAverageMemoryUtilization";
-          case ScalingMetricType::ALBRequestCountPerTarget:
-            return "ALBRequestCountPerTarget";
-          case ScalingMetricType::RDSReaderAverageCPUUtilization:
-            return "RDSReaderAverageCPUUtilization";
-          case ScalingMetricType::RDSReaderAverageDatabaseConnections:
-            return "RDSReaderAverageDatabaseConnections";
-          case ScalingMetricType::EC2SpotFleetRequestAverageCPUUtilization:
-            return "EC2SpotFleetRequestAverageCPUUtilization";
-          case ScalingMetricType::EC2SpotFleetRequestAverageNetworkIn:
-            return "EC2SpotFleetRequestAverageNetworkIn";
-          case ScalingMetricType::EC2SpotFleetRequestAverageNetworkOut:
-            return "EC2SpotFleetRequestAverageNetworkOut";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalingMetricType(ScalingMetricType enumValue)
+        {
+          return GetNameForScalingMetricTypeCStr(enumValue);
         }
 
       } // namespace ScalingMetricTypeMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace ScalingPlanStatusCodeMapper
       {
 
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int ActiveWithProblems_HASH = HashingUtils::HashString("ActiveWithProblems");
-        static const int CreationInProgress_HASH = HashingUtils::HashString("CreationInProgress");
-        static const int CreationFailed_HASH = HashingUtils::HashString("CreationFailed");
-        static const int DeletionInProgress_HASH = HashingUtils::HashString("DeletionInProgress");
-        static const int DeletionFailed_HASH = HashingUtils::HashString("DeletionFailed");
-        static const int UpdateInProgress_HASH = HashingUtils::HashString("UpdateInProgress");
-        static const int UpdateFailed_HASH = HashingUtils::HashString("UpdateFailed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Active",
+          "ActiveWithProblems",
+          "CreationInProgress",
+          "CreationFailed",
+          "DeletionInProgress",
+          "DeletionFailed",
+          "UpdateInProgress",
+          "UpdateFailed",
+        };
 
         ScalingPlanStatusCode GetScalingPlanStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Active_HASH)
-          {
-            return ScalingPlanStatusCode::Active;
-          }
-          else if (hashCode == ActiveWithProblems_HASH)
-          {
-            return ScalingPlanStatusCode::ActiveWithProblems;
-          }
-          else if (hashCode == CreationInProgress_HASH)
-          {
-            return ScalingPlanStatusCode::CreationInProgress;
-          }
-          else if (hashCode == CreationFailed_HASH)
-          {
-            return ScalingPlanStatusCode::CreationFailed;
-          }
-          else if (hashCode == DeletionInProgress_HASH)
-          {
-            return ScalingPlanStatusCode::DeletionInProgress;
-          }
-          else if (hashCode == DeletionFailed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalingPlanStatusCode::DeletionFailed;
-          }
-          else if (hashCode == UpdateInProgress_HASH)
-          {
-            return ScalingPlanStatusCode::UpdateInProgress;
-          }
-          else if (hashCode == UpdateFailed_HASH)
-          {
-            return ScalingPlanStatusCode::UpdateFailed;
+          case 1955883814:
+            if (name == "Active")
+            {
+              return ScalingPlanStatusCode::Active;
+            }
+            break;
+          case -974801184:
+            if (name == "ActiveWithProblems")
+            {
+              return ScalingPlanStatusCode::ActiveWithProblems;
+            }
+            break;
+          case 194214609:
+            if (name == "CreationInProgress")
+            {
+              return ScalingPlanStatusCode::CreationInProgress;
+            }
+            break;
+          case -1962485732:
+            if (name == "CreationFailed")
+            {
+              return ScalingPlanStatusCode::CreationFailed;
+            }
+            break;
+          case 1240453376:
+            if (name == "DeletionInProgress")
+            {
+              return ScalingPlanStatusCode::DeletionInProgress;
+            }
+            break;
+          case -643064373:
+            if (name == "DeletionFailed")
+            {
+              return ScalingPlanStatusCode::DeletionFailed;
+            }
+            break;
+          case 821489723:
+            if (name == "UpdateInProgress")
+            {
+              return ScalingPlanStatusCode::UpdateInProgress;
+            }
+            break;
+          case -1165913466:
+            if (name == "UpdateFailed")
+            {
+              return ScalingPlanStatusCode::UpdateFailed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return ScalingPlanStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForScalingPlanStatusCode(ScalingPlanStatusCode enumValue)
+        const char* GetNameForScalingPlanStatusCodeCStr(ScalingPlanStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalingPlanStatusCode::Active:
-            return "Active";
-          case ScalingPlanStatusCode::ActiveWithProblems:
-            return "ActiveWithProblems";
-          case ScalingPlanStatusCode::CreationInProgress:
-            return "CreationInProgress";
-          case ScalingPlanStatusCode::CreationFailed:
-            return "CreationFailed";
-          case ScalingPlanStatusCode::DeletionInProgress:
-            return "DeletionInProgress";
-          case ScalingPlanStatusCode::DeletionFailed:
-            return "DeletionFailed";
-          case ScalingPlanStatusCode::UpdateInProgress:
-            return "UpdateInProgress";
-          case ScalingPlanStatusCode::UpdateFailed:
-            return "UpdateFailed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalingPlanStatusCode(ScalingPlanStatusCode enumValue)
+        {
+          return GetNameForScalingPlanStatusCodeCStr(enumValue);
         }
 
       } // namespace ScalingPlanStatusCodeMapper
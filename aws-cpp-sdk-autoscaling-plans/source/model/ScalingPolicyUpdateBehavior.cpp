@@ -30,20 +30,37 @@ namespace Aws
       namespace ScalingPolicyUpdateBehaviorMapper
       {
 
-        static const int KeepExternalPolicies_HASH = HashingUtils::HashString("KeepExternalPolicies");
-        static const int ReplaceExternalPolicies_HASH = HashingUtils::HashString("ReplaceExternalPolicies");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "KeepExternalPolicies",
+          "ReplaceExternalPolicies",
+        };
 
         ScalingPolicyUpdateBehavior GetScalingPolicyUpdateBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == KeepExternalPolicies_HASH)
-          {
-            return ScalingPolicyUpdateBehavior::KeepExternalPolicies;
-          }
-          else if (hashCode == ReplaceExternalPolicies_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalingPolicyUpdateBehavior::ReplaceExternalPolicies;
+          case -563890176:
+            if (name == "KeepExternalPolicies")
+            {
+              return ScalingPolicyUpdateBehavior::KeepExternalPolicies;
+            }
+            break;
+          case -591944465:
+            if (name == "ReplaceExternalPolicies")
+            {
+              return ScalingPolicyUpdateBehavior::ReplaceExternalPolicies;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ScalingPolicyUpdateBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForScalingPolicyUpdateBehavior(ScalingPolicyUpdateBehavior enumValue)
+        const char* GetNameForScalingPolicyUpdateBehaviorCStr(ScalingPolicyUpdateBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalingPolicyUpdateBehavior::KeepExternalPolicies:
-            return "KeepExternalPolicies";
-          case ScalingPolicyUpdateBehavior::ReplaceExternalPolicies:
-            return "ReplaceExternalPolicies";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalingPolicyUpdateBehavior(ScalingPolicyUpdateBehavior enumValue)
+        {
+          return GetNameForScalingPolicyUpdateBehaviorCStr(enumValue);
         }
 
       } // namespace ScalingPolicyUpdateBehaviorMapper
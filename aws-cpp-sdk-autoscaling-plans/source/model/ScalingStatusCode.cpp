@@ -30,25 +30,44 @@ namespace Aws
       namespace ScalingStatusCodeMapper
       {
 
-        static const int Inactive_HASH = HashingUtils::HashString("Inactive");
-        static const int PartiallyActive_HASH = HashingUtils::HashString("PartiallyActive");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Inactive",
+          "PartiallyActive",
+          "Active",
+        };
 
         ScalingStatusCode GetScalingStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Inactive_HASH)
-          {
-            return ScalingStatusCode::Inactive;
-          }
-          else if (hashCode == PartiallyActive_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalingStatusCode::PartiallyActive;
-          }
-          else if (hashCode == Active_HASH)
-          {
-            return ScalingStatusCode::Active;
+          case 89309323:
+            if (name == "Inactive")
+            {
+              return ScalingStatusCode::Inactive;
+            }
+            break;
+          case -749221036:
+            if (name == "PartiallyActive")
+            {
+              return ScalingStatusCode::PartiallyActive;
+            }
+            break;
+          case 1955883814:
+            if (name == "Active")
+            {
+              return ScalingStatusCode::Active;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ScalingStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForScalingStatusCode(ScalingStatusCode enumValue)
+        const char* GetNameForScalingStatusCodeCStr(ScalingStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalingStatusCode::Inactive:
-            return "Inactive";
-          case ScalingStatusCode::PartiallyActive:
-            return "PartiallyActive";
-          case ScalingStatusCode::Active:
-            return "Active";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalingStatusCode(ScalingStatusCode enumValue)
+        {
+          return GetNameForScalingStatusCodeCStr(enumValue);
         }
 
       } // namespace ScalingStatusCodeMapper
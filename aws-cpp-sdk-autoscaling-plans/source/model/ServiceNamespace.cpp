@@ -30,35 +30,58 @@ namespace Aws
       namespace ServiceNamespaceMapper
       {
 
-        static const int autoscaling_HASH = HashingUtils::HashString("autoscaling");
-        static const int ecs_HASH = HashingUtils::HashString("ecs");
-        static const int ec2_HASH = HashingUtils::HashString("ec2");
-        static const int rds_HASH = HashingUtils::HashString("rds");
-        static const int dynamodb_HASH = HashingUtils::HashString("dynamodb");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "autoscaling",
+          "ecs",
+          "ec2",
+          "rds",
+          "dynamodb",
+        };
 
         ServiceNamespace GetServiceNamespaceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == autoscaling_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServiceNamespace::autoscaling;
-          }
-          else if (hashCode == ecs_HASH)
-          {
-            return ServiceNamespace::ecs;
-          }
-          else if (hashCode == ec2_HASH)
-          {
-            return ServiceNamespace::ec2;
-          }
-          else if (hashCode == rds_HASH)
-          {
-            return ServiceNamespace::rds;
-          }
-          else if (hashCode == dynamodb_HASH)
-          {
-            return ServiceNamespace::dynamodb;
+          case -1144837384:
+            if (name == "autoscaling")
+            {
+              return ServiceNamespace::autoscaling;
+            }
+            break;
+          case 100245:
+            if (name == "ecs")
+            {
+              return ServiceNamespace::ecs;
+            }
+            break;
+          case 100180:
+            if (name == "ec2")
+            {
+              return ServiceNamespace::ec2;
+            }
+            break;
+          case 112769:
+            if (name == "rds")
+            {
+              return ServiceNamespace::rds;
+            }
+            break;
+          case 1443282600:
+            if (name == "dynamodb")
+            {
+              return ServiceNamespace::dynamodb;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ServiceNamespace::NOT_SET;
         }
 
-        Aws::String GetNameForServiceNamespace(ServiceNamespace enumValue)
+        const char* GetNameForServiceNamespaceCStr(ServiceNamespace enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServiceNamespace::autoscaling:
-            return "autoscaling";
-          case ServiceNamespace::ecs:
-            return "ecs";
-          case ServiceNamespace::ec2:
-            return "ec2";
-          case ServiceNamespace::rds:
-            return "rds";
-          case ServiceNamespace::dynamodb:
-            return "dynamodb";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServiceNamespace(ServiceNamespace enumValue)
+        {
+          return GetNameForServiceNamespaceCStr(enumValue);
         }
 
       } // namespace ServiceNamespaceMapper
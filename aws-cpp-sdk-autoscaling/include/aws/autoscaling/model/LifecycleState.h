@@ -46,6 +46,11 @@ namespace LifecycleStateMapper
 AWS_AUTOSCALING_API LifecycleState GetLifecycleStateForName(const Aws::String& name);
 
 AWS_AUTOSCALING_API Aws::String GetNameForLifecycleState(LifecycleState value);
+
+/**
+ * Same as GetNameForLifecycleState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALING_API const char* GetNameForLifecycleStateCStr(LifecycleState value);
 } // namespace LifecycleStateMapper
 } // namespace Model
 } // namespace AutoScaling
@@ -38,6 +38,11 @@ namespace MetricStatisticMapper
 AWS_AUTOSCALING_API MetricStatistic GetMetricStatisticForName(const Aws::String& name);
 
 AWS_AUTOSCALING_API Aws::String GetNameForMetricStatistic(MetricStatistic value);
+
+/**
+ * Same as GetNameForMetricStatistic(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALING_API const char* GetNameForMetricStatisticCStr(MetricStatistic value);
 } // namespace MetricStatisticMapper
 } // namespace Model
 } // namespace AutoScaling
@@ -37,6 +37,11 @@ namespace MetricTypeMapper
 AWS_AUTOSCALING_API MetricType GetMetricTypeForName(const Aws::String& name);
 
 AWS_AUTOSCALING_API Aws::String GetNameForMetricType(MetricType value);
+
+/**
+ * Same as GetNameForMetricType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_AUTOSCALING_API const char* GetNameForMetricTypeCStr(MetricType value);
 } // namespace MetricTypeMapper
 } // namespace Model
 } // namespace AutoScaling
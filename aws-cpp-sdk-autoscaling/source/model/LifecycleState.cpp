@@ -30,75 +30,114 @@ namespace Aws
       namespace LifecycleStateMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Pending_Wait_HASH = HashingUtils::HashString("Pending:Wait");
-        static const int Pending_Proceed_HASH = HashingUtils::HashString("Pending:Proceed");
-        static const int Quarantined_HASH = HashingUtils::HashString("Quarantined");
-        static const int InService_HASH = HashingUtils::HashString("InService");
-        static const int Terminating_HASH = HashingUtils::HashString("Terminating");
-        static const int Terminating_Wait_HASH = HashingUtils::HashString("Terminating:Wait");
-        static const int Terminating_Proceed_HASH = HashingUtils::HashString("Terminating:Proceed");
-        static const int Terminated_HASH = HashingUtils::HashString("Terminated");
-        static const int Detaching_HASH = HashingUtils::HashString("Detaching");
-        static const int Detached_HASH = HashingUtils::HashString("Detached");
-        static const int EnteringStandby_HASH = HashingUtils::HashString("EnteringStandby");
-        static const int Standby_HASH = HashingUtils::HashString("Standby");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "Pending:Wait",
+          "Pending:Proceed",
+          "Quarantined",
+          "InService",
+          "Terminating",
+          "Terminating:Wait",
+          "Terminating:Proceed",
+          "Terminated",
+          "Detaching",
+          "Detached",
+          "EnteringStandby",
+          "Standby",
+        };
 
         LifecycleState GetLifecycleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LifecycleState::Pending;
-          }
-          else if (hashCode == Pending_Wait_HASH)
-          {
-            return LifecycleState::Pending_Wait;
-          }
-          else if (hashCode == Pending_Proceed_HASH)
-          {
-            return LifecycleState::Pending_Proceed;
-          }
-          else if (hashCode == Quarantined_HASH)
-          {
-            return LifecycleState::Quarantined;
-          }
-          else if (hashCode == InService_HASH)
-          {
-            return LifecycleState::InService;
-          }
-          else if (hashCode == Terminating_HASH)
-          {
-            return LifecycleState::Terminating;
-          }
-          else if (hashCode == Terminating_Wait_HASH)
-          {
-            return LifecycleState::Terminating_Wait;
-          }
-          else if (hashCode == Terminating_Proceed_HASH)
-          {
-            return LifecycleState::Terminating_Proceed;
-          }
-          else if (hashCode == Terminated_HASH)
-          {
-            return LifecycleState::Terminated;
-          }
-          else if (hashCode == Detaching_HASH)
-          {
-            return LifecycleState::Detaching;
-          }
-          else if (hashCode == Detached_HASH)
-          {
-            return LifecycleState::Detached;
-          }
-          else if (hashCode == EnteringStandby_HASH)
-          {
-            return LifecycleState::EnteringStandby;
-          }
-          else if (hashCode == Standby_HASH)
-          {
-            return LifecycleState::Standby;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return LifecycleState::Pending;
+            }
+            break;
+          case 292456888:
+            if (name == "Pending:Wait")
+            {
+              return LifecycleState::Pending_Wait;
+            }
+            break;
+          case 963746187:
+            if (name == "Pending:Proceed")
+            {
+              return LifecycleState::Pending_Proceed;
+            }
+            break;
+          case -5840938:
+            if (name == "Quarantined")
+            {
+              return LifecycleState::Quarantined;
+            }
+            break;
+          case -1010741840:
+            if (name == "InService")
+            {
+              return LifecycleState::InService;
+            }
+            break;
+          case -250712386:
+            if (name == "Terminating")
+            {
+              return LifecycleState::Terminating;
+            }
+            break;
+          case -2074513199:
+            if (name == "Terminating:Wait")
+            {
+              return LifecycleState::Terminating_Wait;
+            }
+            break;
+          case 1330950098:
+            if (name == "Terminating:Proceed")
+            {
+              return LifecycleState::Terminating_Proceed;
+            }
+            break;
+          case 684649027:
+            if (name == "Terminated")
+            {
+              return LifecycleState::Terminated;
+            }
+            break;
+          case 25236303:
+            if (name == "Detaching")
+            {
+              return LifecycleState::Detaching;
+            }
+            break;
+          case 1109192594:
+            if (name == "Detached")
+            {
+              return LifecycleState::Detached;
+            }
+            break;
+          case 1425998115:
+            if (name == "EnteringStandby")
+            {
+              return LifecycleState::EnteringStandby;
+            }
+            break;
+          case -232666483:
+            if (name == "Standby")
+            {
+              return LifecycleState::Standby;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,45 +149,26 @@ namespace Aws
           return LifecycleState::NOT_SET;
         }
 
-        Aws::String GetNameForLifecycleState(LifecycleState enumValue)
+        const char* GetNameForLifecycleStateCStr(LifecycleState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LifecycleState::Pending:
-            return "Pending";
-          case LifecycleState::Pending_Wait:
-            return "Pending:Wait";
-          case LifecycleState::Pending_Proceed:
-            return "Pending:Proceed";
-          case LifecycleState::Quarantined:
-            return "Quarantined";
-          case LifecycleState::InService:
-            return "InService";
-          case LifecycleState::Terminating:
-            return "Terminating";
-          case LifecycleState::Terminating_Wait:
-            return "Terminating:Wait";
-          case LifecycleState::Terminating_Proceed:
-            return "Terminating:Proceed";
-          case LifecycleState::Terminated:
-            return "Terminated";
-          case LifecycleState::Detaching:
-            return "Detaching";
-          case LifecycleState::Detached:
-            return "Detached";
-          case LifecycleState::EnteringStandby:
-            return "EnteringStandby";
-          case LifecycleState::Standby:
-            return "Standby";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLifecycleState(LifecycleState enumValue)
+        {
+          return GetNameForLifecycleStateCStr(enumValue);
         }
 
       } // namespace LifecycleStateMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace MetricTypeMapper
       {
 
-        static const int ASGAverageCPUUtilization_HASH = HashingUtils::HashString("ASGAverageCPUUtilization");
-        static const int ASGAverageNetworkIn_HASH = HashingUtils::HashString("ASGAverageNetworkIn");
-        static const int ASGAverageNetworkOut_HASH = HashingUtils::HashString("ASGAverageNetworkOut");
-        static const int ALBRequestCountPerTarget_HASH = HashingUtils::HashString("ALBRequestCountPerTarget");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ASGAverageCPUUtilization",
+          "ASGAverageNetworkIn",
+          "ASGAverageNetworkOut",
+          "ALBRequestCountPerTarget",
+        };
 
         MetricType GetMetricTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASGAverageCPUUtilization_HASH)
-          {
-            return MetricType::ASGAverageCPUUtilization;
-          }
-          else if (hashCode == ASGAverageNetworkIn_HASH)
-          {
-            return MetricType::ASGAverageNetworkIn;
-          }
-          else if (hashCode == ASGAverageNetworkOut_HASH)
-          {
-            return MetricType::ASGAverageNetworkOut;
-          }
-          else if (hashCode == ALBRequestCountPerTarget_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MetricType::ALBRequestCountPerTarget;
+          case 1144585090:
+            if (name == "ASGAverageCPUUtilization")
+            {
+              return MetricType::ASGAverageCPUUtilization;
+            }
+            break;
+          case 2086951627:
+            if (name == "ASGAverageNetworkIn")
+            {
+              return MetricType::ASGAverageNetworkIn;
+            }
+            break;
+          case 270997096:
+            if (name == "ASGAverageNetworkOut")
+            {
+              return MetricType::ASGAverageNetworkOut;
+            }
+            break;
+          case -947560457:
+            if (name == "ALBRequestCountPerTarget")
+            {
+              return MetricType::ALBRequestCountPerTarget;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return MetricType::NOT_SET;
         }
 
-        Aws::String GetNameForMetricType(MetricType enumValue)
+        const char* GetNameForMetricTypeCStr(MetricType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MetricType::ASGAverageCPUUtilization:
-            return "ASGAverageCPUUtilization";
-          case MetricType::ASGAverageNetworkIn:
-            return "ASGAverageNetworkIn";
-          case MetricType::ASGAverageNetworkOut:
-            return "ASGAverageNetworkOut";
-          case MetricType::ALBRequestCountPerTarget:
-            return "ALBRequestCountPerTarget";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMetricType(MetricType enumValue)
+        {
+          return GetNameForMetricTypeCStr(enumValue);
         }
 
       } // namespace MetricTypeMapper
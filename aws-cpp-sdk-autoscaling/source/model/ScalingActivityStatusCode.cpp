@@ -30,70 +30,107 @@ namespace Aws
       namespace ScalingActivityStatusCodeMapper
       {
 
-        static const int PendingSpotBidPlacement_HASH = HashingUtils::HashString("PendingSpotBidPlacement");
-        static const int WaitingForSpotInstanceRequestId_HASH = HashingUtils::HashString("WaitingForSpotInstanceRequestId");
-        static const int WaitingForSpotInstanceId_HASH = HashingUtils::HashString("WaitingForSpotInstanceId");
-        static const int WaitingForInstanceId_HASH = HashingUtils::HashString("WaitingForInstanceId");
-        static const int PreInService_HASH = HashingUtils::HashString("PreInService");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int WaitingForELBConnectionDraining_HASH = HashingUtils::HashString("WaitingForELBConnectionDraining");
-        static const int MidLifecycleAction_HASH = HashingUtils::HashString("MidLifecycleAction");
-        static const int WaitingForInstanceWarmup_HASH = HashingUtils::HashString("WaitingForInstanceWarmup");
-        static const int Successful_HASH = HashingUtils::HashString("Successful");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PendingSpotBidPlacement",
+          "WaitingForSpotInstanceRequestId",
+          "WaitingForSpotInstanceId",
+          "WaitingForInstanceId",
+          "PreInService",
+          "InProgress",
+          "WaitingForELBConnectionDraining",
+          "MidLifecycleAction",
+          "WaitingForInstanceWarmup",
+          "Successful",
+          "Failed",
+          "Cancelled",
+        };
 
         ScalingActivityStatusCode GetScalingActivityStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PendingSpotBidPlacement_HASH)
-          {
-            return ScalingActivityStatusCode::PendingSpotBidPlacement;
-          }
-          else if (hashCode == WaitingForSpotInstanceRequestId_HASH)
-          {
-            return ScalingActivityStatusCode::WaitingForSpotInstanceRequestId;
-          }
-          else if (hashCode == WaitingForSpotInstanceId_HASH)
-          {
-            return ScalingActivityStatusCode::WaitingForSpotInstanceId;
-          }
-          else if (hashCode == WaitingForInstanceId_HASH)
-          {
-            return ScalingActivityStatusCode::WaitingForInstanceId;
-          }
-          else if (hashCode == PreInService_HASH)
-          {
-            return ScalingActivityStatusCode::PreInService;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return ScalingActivityStatusCode::InProgress;
-          }
-          else if (hashCode == WaitingForELBConnectionDraining_HASH)
-          {
-            return ScalingActivityStatusCode::WaitingForELBConnectionDraining;
-          }
-          else if (hashCode == MidLifecycleAction_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalingActivityStatusCode::MidLifecycleAction;
-          }
-          else if (hashCode == WaitingForInstanceWarmup_HASH)
-          {
-            return ScalingActivityStatusCode::WaitingForInstanceWarmup;
-          }
-          else if (hashCode == Successful_HASH)
-          {
-            return ScalingActivityStatusCode::Successful;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ScalingActivityStatusCode::Failed;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return ScalingActivityStatusCode::Cancelled;
+          case 1049261089:
+            if (name == "PendingSpotBidPlacement")
+            {
+              return ScalingActivityStatusCode::PendingSpotBidPlacement;
+            }
+            break;
+          case 2018723863:
+            if (name == "WaitingForSpotInstanceRequestId")
+            {
+              return ScalingActivityStatusCode::WaitingForSpotInstanceRequestId;
+            }
+            break;
+          case 161750446:
+            if (name == "WaitingForSpotInstanceId")
+            {
+              return ScalingActivityStatusCode::WaitingForSpotInstanceId;
+            }
+            break;
+          case 1543291148:
+            if (name == "WaitingForInstanceId")
+            {
+              return ScalingActivityStatusCode::WaitingForInstanceId;
+            }
+            break;
+          case -636078451:
+            if (name == "PreInService")
+            {
+              return ScalingActivityStatusCode::PreInService;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return ScalingActivityStatusCode::InProgress;
+            }
+            break;
+          case 1679717863:
+            if (name == "WaitingForELBConnectionDraining")
+            {
+              return ScalingActivityStatusCode::WaitingForELBConnectionDraining;
+            }
+            break;
+          case 1022693112:
+            if (name == "MidLifecycleAction")
+            {
+              return ScalingActivityStatusCode::MidLifecycleAction;
+            }
+            break;
+          case -1236506799:
+            if (name == "WaitingForInstanceWarmup")
+            {
+              return ScalingActivityStatusCode::WaitingForInstanceWarmup;
+            }
+            break;
+          case 1259833018:
+            if (name == "Successful")
+            {
+              return ScalingActivityStatusCode::Successful;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return ScalingActivityStatusCode::Failed;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return ScalingActivityStatusCode::Cancelled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return ScalingActivityStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForScalingActivityStatusCode(ScalingActivityStatusCode enumValue)
+        const char* GetNameForScalingActivityStatusCodeCStr(ScalingActivityStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalingActivityStatusCode::PendingSpotBidPlacement:
-            return "PendingSpotBidPlacement";
-          case ScalingActivityStatusCode::WaitingForSpotInstanceRequestId:
-            return "WaitingForSpotInstanceRequestId";
-          case ScalingActivityStatusCode::WaitingForSpotInstanceId:
-            return "WaitingForSpotInstanceId";
-          case ScalingActivityStatusCode::WaitingForInstanceId:
-            return "WaitingForInstanceId";
-          case ScalingActivityStatusCode::PreInService:
-            return "PreInService";
-          case ScalingActivityStatusCode::InProgress:
-            return "InProgress";
-          case ScalingActivityStatusCode::WaitingForELBConnectionDraining:
-            return "WaitingForELBConnectionDraining";
-          case ScalingActivityStatusCode::MidLifecycleAction:
-            return "MidLifecycleAction";
-          case ScalingActivityStatusCode::WaitingForInstanceWarmup:
-            return "WaitingForInstanceWarmup";
-          case ScalingActivityStatusCode::Successful:
-            return "Successful";
-          case ScalingActivityStatusCode::Failed:
-            return "Failed";
-          case ScalingActivityStatusCode::Cancelled:
-            return "Cancelled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalingActivityStatusCode(ScalingActivityStatusCode enumValue)
+        {
+          return GetNameForScalingActivityStatusCodeCStr(enumValue);
         }
 
       } // namespace ScalingActivityStatusCodeMapper
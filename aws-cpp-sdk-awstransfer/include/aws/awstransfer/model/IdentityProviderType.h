@@ -35,6 +35,11 @@ namespace IdentityProviderTypeMapper
 AWS_TRANSFER_API IdentityProviderType GetIdentityProviderTypeForName(const Aws::String& name);
 
 AWS_TRANSFER_API Aws::String GetNameForIdentityProviderType(IdentityProviderType value);
+
+/**
+ * Same as GetNameForIdentityProviderType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_TRANSFER_API const char* GetNameForIdentityProviderTypeCStr(IdentityProviderType value);
 } // namespace IdentityProviderTypeMapper
 } // namespace Model
 } // namespace Transfer
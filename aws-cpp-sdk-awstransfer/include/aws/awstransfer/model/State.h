@@ -39,6 +39,11 @@ namespace StateMapper
 AWS_TRANSFER_API State GetStateForName(const Aws::String& name);
 
 AWS_TRANSFER_API Aws::String GetNameForState(State value);
+
+/**
+ * Same as GetNameForState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_TRANSFER_API const char* GetNameForStateCStr(State value);
 } // namespace StateMapper
 } // namespace Model
 } // namespace Transfer
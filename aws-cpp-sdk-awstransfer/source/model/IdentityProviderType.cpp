@@ -30,20 +30,37 @@ namespace Aws
       namespace IdentityProviderTypeMapper
       {
 
-        static const int SERVICE_MANAGED_HASH = HashingUtils::HashString("SERVICE_MANAGED");
-        static const int API_GATEWAY_HASH = HashingUtils::HashString("API_GATEWAY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SERVICE_MANAGED",
+          "API_GATEWAY",
+        };
 
         IdentityProviderType GetIdentityProviderTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SERVICE_MANAGED_HASH)
-          {
-            return IdentityProviderType::SERVICE_MANAGED;
-          }
-          else if (hashCode == API_GATEWAY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IdentityProviderType::API_GATEWAY;
+          case 1117138901:
+            if (name == "SERVICE_MANAGED")
+            {
+              return IdentityProviderType::SERVICE_MANAGED;
+            }
+            break;
+          case 412998879:
+            if (name == "API_GATEWAY")
+            {
+              return IdentityProviderType::API_GATEWAY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return IdentityProviderType::NOT_SET;
         }
 
-        Aws::String GetNameForIdentityProviderType(IdentityProviderType enumValue)
+        const char* GetNameForIdentityProviderTypeCStr(IdentityProviderType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IdentityProviderType::SERVICE_MANAGED:
-            return "SERVICE_MANAGED";
-          case IdentityProviderType::API_GATEWAY:
-            return "API_GATEWAY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIdentityProviderType(IdentityProviderType enumValue)
+        {
+          return GetNameForIdentityProviderTypeCStr(enumValue);
         }
 
       } // namespace IdentityProviderTypeMapper
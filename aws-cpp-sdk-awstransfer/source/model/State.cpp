@@ -30,40 +30,65 @@ namespace Aws
       namespace StateMapper
       {
 
-        static const int OFFLINE_HASH = HashingUtils::HashString("OFFLINE");
-        static const int ONLINE_HASH = HashingUtils::HashString("ONLINE");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int START_FAILED_HASH = HashingUtils::HashString("START_FAILED");
-        static const int STOP_FAILED_HASH = HashingUtils::HashString("STOP_FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OFFLINE",
+          "ONLINE",
+          "STARTING",
+          "STOPPING",
+          "START_FAILED",
+          "STOP_FAILED",
+        };
 
         State GetStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFFLINE_HASH)
-          {
-            return State::OFFLINE;
-          }
-          else if (hashCode == ONLINE_HASH)
-          {
-            return State::ONLINE;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return State::STARTING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return State::STOPPING;
-          }
-          else if (hashCode == START_FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return State::START_FAILED;
-          }
-          else if (hashCode == STOP_FAILED_HASH)
-          {
-            return State::STOP_FAILED;
+          case -830629437:
+            if (name == "OFFLINE")
+            {
+              return State::OFFLINE;
+            }
+            break;
+          case -1958892973:
+            if (name == "ONLINE")
+            {
+              return State::ONLINE;
+            }
+            break;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return State::STARTING;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return State::STOPPING;
+            }
+            break;
+          case 280021722:
+            if (name == "START_FAILED")
+            {
+              return State::START_FAILED;
+            }
+            break;
+          case -1034625254:
+            if (name == "STOP_FAILED")
+            {
+              return State::STOP_FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return State::NOT_SET;
         }
 
-        Aws::String GetNameForState(State enumValue)
+        const char* GetNameForStateCStr(State enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case State::OFFLINE:
-            return "OFFLINE";
-          case State::ONLINE:
-            return "ONLINE";
-          case State::STARTING:
-            return "STARTING";
-          case State::STOPPING:
-            return "STOPPING";
-          case State::START_FAILED:
-            return "START_FAILED";
-          case State::STOP_FAILED:
-            return "STOP_FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForState(State enumValue)
+        {
+          return GetNameForStateCStr(enumValue);
         }
 
       } // namespace StateMapper
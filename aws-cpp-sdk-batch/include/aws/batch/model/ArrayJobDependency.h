@@ -35,6 +35,11 @@ namespace ArrayJobDependencyMapper
 AWS_BATCH_API ArrayJobDependency GetArrayJobDependencyForName(const Aws::String& name);
 
 AWS_BATCH_API Aws::String GetNameForArrayJobDependency(ArrayJobDependency value);
+
+/**
+ * Same as GetNameForArrayJobDependency(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BATCH_API const char* GetNameForArrayJobDependencyCStr(ArrayJobDependency value);
 } // namespace ArrayJobDependencyMapper
 } // namespace Model
 } // namespace Batch
@@ -35,6 +35,11 @@ namespace CEStateMapper
 AWS_BATCH_API CEState GetCEStateForName(const Aws::String& name);
 
 AWS_BATCH_API Aws::String GetNameForCEState(CEState value);
+
+/**
+ * Same as GetNameForCEState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BATCH_API const char* GetNameForCEStateCStr(CEState value);
 } // namespace CEStateMapper
 } // namespace Model
 } // namespace Batch
@@ -39,6 +39,11 @@ namespace CEStatusMapper
 AWS_BATCH_API CEStatus GetCEStatusForName(const Aws::String& name);
 
 AWS_BATCH_API Aws::String GetNameForCEStatus(CEStatus value);
+
+/**
+ * Same as GetNameForCEStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BATCH_API const char* GetNameForCEStatusCStr(CEStatus value);
 } // namespace CEStatusMapper
 } // namespace Model
 } // namespace Batch
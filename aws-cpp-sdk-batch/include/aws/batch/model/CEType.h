@@ -35,6 +35,11 @@ namespace CETypeMapper
 AWS_BATCH_API CEType GetCETypeForName(const Aws::String& name);
 
 AWS_BATCH_API Aws::String GetNameForCEType(CEType value);
+
+/**
+ * Same as GetNameForCEType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BATCH_API const char* GetNameForCETypeCStr(CEType value);
 } // namespace CETypeMapper
 } // namespace Model
 } // namespace Batch
@@ -35,6 +35,11 @@ namespace CRTypeMapper
 AWS_BATCH_API CRType GetCRTypeForName(const Aws::String& name);
 
 AWS_BATCH_API Aws::String GetNameForCRType(CRType value);
+
+/**
+ * Same as GetNameForCRType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BATCH_API const char* GetNameForCRTypeCStr(CRType value);
 } // namespace CRTypeMapper
 } // namespace Model
 } // namespace Batch
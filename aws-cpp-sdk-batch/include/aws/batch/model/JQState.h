@@ -35,6 +35,11 @@ namespace JQStateMapper
 AWS_BATCH_API JQState GetJQStateForName(const Aws::String& name);
 
 AWS_BATCH_API Aws::String GetNameForJQState(JQState value);
+
+/**
+ * Same as GetNameForJQState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BATCH_API const char* GetNameForJQStateCStr(JQState value);
 } // namespace JQStateMapper
 } // namespace Model
 } // namespace Batch
@@ -39,6 +39,11 @@ namespace JQStatusMapper
 AWS_BATCH_API JQStatus GetJQStatusForName(const Aws::String& name);
 
 AWS_BATCH_API Aws::String GetNameForJQStatus(JQStatus value);
+
+/**
+ * Same as GetNameForJQStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BATCH_API const char* GetNameForJQStatusCStr(JQStatus value);
 } // namespace JQStatusMapper
 } // namespace Model
 } // namespace Batch
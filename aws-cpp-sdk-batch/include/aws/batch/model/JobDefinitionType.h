@@ -35,6 +35,11 @@ namespace JobDefinitionTypeMapper
 AWS_BATCH_API JobDefinitionType GetJobDefinitionTypeForName(const Aws::String& name);
 
 AWS_BATCH_API Aws::String GetNameForJobDefinitionType(JobDefinitionType value);
+
+/**
+ * Same as GetNameForJobDefinitionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BATCH_API const char* GetNameForJobDefinitionTypeCStr(JobDefinitionType value);
 } // namespace JobDefinitionTypeMapper
 } // namespace Model
 } // namespace Batch
@@ -30,20 +30,37 @@ namespace Aws
       namespace ArrayJobDependencyMapper
       {
 
-        static const int N_TO_N_HASH = HashingUtils::HashString("N_TO_N");
-        static const int SEQUENTIAL_HASH = HashingUtils::HashString("SEQUENTIAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "N_TO_N",
+          "SEQUENTIAL",
+        };
 
         ArrayJobDependency GetArrayJobDependencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == N_TO_N_HASH)
-          {
-            return ArrayJobDependency::N_TO_N;
-          }
-          else if (hashCode == SEQUENTIAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ArrayJobDependency::SEQUENTIAL;
+          case -1971577637:
+            if (name == "N_TO_N")
+            {
+              return ArrayJobDependency::N_TO_N;
+            }
+            break;
+          case 321080575:
+            if (name == "SEQUENTIAL")
+            {
+              return ArrayJobDependency::SEQUENTIAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ArrayJobDependency::NOT_SET;
         }
 
-        Aws::String GetNameForArrayJobDependency(ArrayJobDependency enumValue)
+        const char* GetNameForArrayJobDependencyCStr(ArrayJobDependency enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ArrayJobDependency::N_TO_N:
-            return "N_TO_N";
-          case ArrayJobDependency::SEQUENTIAL:
-            return "SEQUENTIAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForArrayJobDependency(ArrayJobDependency enumValue)
+        {
+          return GetNameForArrayJobDependencyCStr(enumValue);
         }
 
       } // namespace ArrayJobDependencyMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace CEStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int VALID_HASH = HashingUtils::HashString("VALID");
-        static const int INVALID_HASH = HashingUtils::HashString("INVALID");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "UPDATING",
+          "DELETING",
+          "DELETED",
+          "VALID",
+          "INVALID",
+        };
 
         CEStatus GetCEStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return CEStatus::CREATING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return CEStatus::UPDATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return CEStatus::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return CEStatus::DELETED;
-          }
-          else if (hashCode == VALID_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CEStatus::VALID;
-          }
-          else if (hashCode == INVALID_HASH)
-          {
-            return CEStatus::INVALID;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return CEStatus::CREATING;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return CEStatus::UPDATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return CEStatus::DELETING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return CEStatus::DELETED;
+            }
+            break;
+          case 81434588:
+            if (name == "VALID")
+            {
+              return CEStatus::VALID;
+            }
+            break;
+          case -1617199657:
+            if (name == "INVALID")
+            {
+              return CEStatus::INVALID;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return CEStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCEStatus(CEStatus enumValue)
+        const char* GetNameForCEStatusCStr(CEStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CEStatus::CREATING:
-            return "CREATING";
-          case CEStatus::UPDATING:
-            return "UPDATING";
-          case CEStatus::DELETING:
-            return "DELETING";
-          case CEStatus::DELETED:
-            return "DELETED";
-          case CEStatus::VALID:
-            return "VALID";
-          case CEStatus::INVALID:
-            return "INVALID";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCEStatus(CEStatus enumValue)
+        {
+          return GetNameForCEStatusCStr(enumValue);
         }
 
       } // namespace CEStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CETypeMapper
       {
 
-        static const int MANAGED_HASH = HashingUtils::HashString("MANAGED");
-        static const int UNMANAGED_HASH = HashingUtils::HashString("UNMANAGED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MANAGED",
+          "UNMANAGED",
+        };
 
         CEType GetCETypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MANAGED_HASH)
-          {
-            return CEType::MANAGED;
-          }
-          else if (hashCode == UNMANAGED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CEType::UNMANAGED;
+          case 1553243007:
+            if (name == "MANAGED")
+            {
+              return CEType::MANAGED;
+            }
+            break;
+          case 1038688966:
+            if (name == "UNMANAGED")
+            {
+              return CEType::UNMANAGED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CEType::NOT_SET;
         }
 
-        Aws::String GetNameForCEType(CEType enumValue)
+        const char* GetNameForCETypeCStr(CEType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CEType::MANAGED:
-            return "MANAGED";
-          case CEType::UNMANAGED:
-            return "UNMANAGED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCEType(CEType enumValue)
+        {
+          return GetNameForCETypeCStr(enumValue);
         }
 
       } // namespace CETypeMapper
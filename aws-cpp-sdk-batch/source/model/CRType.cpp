@@ -30,20 +30,37 @@ namespace Aws
       namespace CRTypeMapper
       {
 
-        static const int EC2_HASH = HashingUtils::HashString("EC2");
-        static const int SPOT_HASH = HashingUtils::HashString("SPOT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EC2",
+          "SPOT",
+        };
 
         CRType GetCRTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EC2_HASH)
-          {
-            return CRType::EC2;
-          }
-          else if (hashCode == SPOT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CRType::SPOT;
+          case 68436:
+            if (name == "EC2")
+            {
+              return CRType::EC2;
+            }
+            break;
+          case 2552066:
+            if (name == "SPOT")
+            {
+              return CRType::SPOT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CRType::NOT_SET;
         }
 
-        Aws::String GetNameForCRType(CRType enumValue)
+        const char* GetNameForCRTypeCStr(CRType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CRType::EC2:
-            return "EC2";
-          case CRType::SPOT:
-            return "SPOT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCRType(CRType enumValue)
+        {
+          return GetNameForCRTypeCStr(enumValue);
         }
 
       } // namespace CRTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace JQStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int VALID_HASH = HashingUtils::HashString("VALID");
-        static const int INVALID_HASH = HashingUtils::HashString("INVALID");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "UPDATING",
+          "DELETING",
+          "DELETED",
+          "VALID",
+          "INVALID",
+        };
 
         JQStatus GetJQStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return JQStatus::CREATING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return JQStatus::UPDATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return JQStatus::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return JQStatus::DELETED;
-          }
-          else if (hashCode == VALID_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JQStatus::VALID;
-          }
-          else if (hashCode == INVALID_HASH)
-          {
-            return JQStatus::INVALID;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return JQStatus::CREATING;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return JQStatus::UPDATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return JQStatus::DELETING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return JQStatus::DELETED;
+            }
+            break;
+          case 81434588:
+            if (name == "VALID")
+            {
+              return JQStatus::VALID;
+            }
+            break;
+          case -1617199657:
+            if (name == "INVALID")
+            {
+              return JQStatus::INVALID;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return JQStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJQStatus(JQStatus enumValue)
+        const char* GetNameForJQStatusCStr(JQStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JQStatus::CREATING:
-            return "CREATING";
-          case JQStatus::UPDATING:
-            return "UPDATING";
-          case JQStatus::DELETING:
-            return "DELETING";
-          case JQStatus::DELETED:
-            return "DELETED";
-          case JQStatus::VALID:
-            return "VALID";
-          case JQStatus::INVALID:
-            return "INVALID";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJQStatus(JQStatus enumValue)
+        {
+          return GetNameForJQStatusCStr(enumValue);
         }
 
       } // namespace JQStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace JobDefinitionTypeMapper
       {
 
-        static const int container_HASH = HashingUtils::HashString("container");
-        static const int multinode_HASH = HashingUtils::HashString("multinode");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "container",
+          "multinode",
+        };
 
         JobDefinitionType GetJobDefinitionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == container_HASH)
-          {
-            return JobDefinitionType::container;
-          }
-          else if (hashCode == multinode_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobDefinitionType::multinode;
+          case -410956671:
+            if (name == "container")
+            {
+              return JobDefinitionType::container;
+            }
+            break;
+          case -1206174021:
+            if (name == "multinode")
+            {
+              return JobDefinitionType::multinode;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return JobDefinitionType::NOT_SET;
         }
 
-        Aws::String GetNameForJobDefinitionType(JobDefinitionType enumValue)
+        const char* GetNameForJobDefinitionTypeCStr(JobDefinitionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobDefinitionType::container:
-            return "container";
-          case JobDefinitionType::multinode:
-            return "multinode";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobDefinitionType(JobDefinitionType enumValue)
+        {
+          return GetNameForJobDefinitionTypeCStr(enumValue);
         }
 
       } // namespace JobDefinitionTypeMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int RUNNABLE_HASH = HashingUtils::HashString("RUNNABLE");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUBMITTED",
+          "PENDING",
+          "RUNNABLE",
+          "STARTING",
+          "RUNNING",
+          "SUCCEEDED",
+          "FAILED",
+        };
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
-          {
-            return JobStatus::SUBMITTED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return JobStatus::PENDING;
-          }
-          else if (hashCode == RUNNABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobStatus::RUNNABLE;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return JobStatus::STARTING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return JobStatus::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return JobStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobStatus::FAILED;
+          case -1159694117:
+            if (name == "SUBMITTED")
+            {
+              return JobStatus::SUBMITTED;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return JobStatus::PENDING;
+            }
+            break;
+          case 1612038941:
+            if (name == "RUNNABLE")
+            {
+              return JobStatus::RUNNABLE;
+            }
+            break;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return JobStatus::STARTING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return JobStatus::RUNNING;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return JobStatus::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return JobStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatusCStr(JobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobStatus::SUBMITTED:
-            return "SUBMITTED";
-          case JobStatus::PENDING:
-            return "PENDING";
-          case JobStatus::RUNNABLE:
-            return "RUNNABLE";
-          case JobStatus::STARTING:
-            return "STARTING";
-          case JobStatus::RUNNING:
-            return "RUNNING";
-          case JobStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case JobStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        {
+          return GetNameForJobStatusCStr(enumValue);
         }
 
       } // namespace JobStatusMapper
@@ -37,6 +37,11 @@ namespace BudgetTypeMapper
 AWS_BUDGETS_API BudgetType GetBudgetTypeForName(const Aws::String& name);
 
 AWS_BUDGETS_API Aws::String GetNameForBudgetType(BudgetType value);
+
+/**
+ * Same as GetNameForBudgetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BUDGETS_API const char* GetNameForBudgetTypeCStr(BudgetType value);
 } // namespace BudgetTypeMapper
 } // namespace Model
 } // namespace Budgets
@@ -36,6 +36,11 @@ namespace ComparisonOperatorMapper
 AWS_BUDGETS_API ComparisonOperator GetComparisonOperatorForName(const Aws::String& name);
 
 AWS_BUDGETS_API Aws::String GetNameForComparisonOperator(ComparisonOperator value);
+
+/**
+ * Same as GetNameForComparisonOperator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BUDGETS_API const char* GetNameForComparisonOperatorCStr(ComparisonOperator value);
 } // namespace ComparisonOperatorMapper
 } // namespace Model
 } // namespace Budgets
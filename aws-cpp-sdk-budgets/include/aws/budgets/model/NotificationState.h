@@ -35,6 +35,11 @@ namespace NotificationStateMapper
 AWS_BUDGETS_API NotificationState GetNotificationStateForName(const Aws::String& name);
 
 AWS_BUDGETS_API Aws::String GetNameForNotificationState(NotificationState value);
+
+/**
+ * Same as GetNameForNotificationState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BUDGETS_API const char* GetNameForNotificationStateCStr(NotificationState value);
 } // namespace NotificationStateMapper
 } // namespace Model
 } // namespace Budgets
@@ -35,6 +35,11 @@ namespace NotificationTypeMapper
 AWS_BUDGETS_API NotificationType GetNotificationTypeForName(const Aws::String& name);
 
 AWS_BUDGETS_API Aws::String GetNameForNotificationType(NotificationType value);
+
+/**
+ * Same as GetNameForNotificationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BUDGETS_API const char* GetNameForNotificationTypeCStr(NotificationType value);
 } // namespace NotificationTypeMapper
 } // namespace Model
 } // namespace Budgets
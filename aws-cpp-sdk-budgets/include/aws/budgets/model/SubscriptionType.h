@@ -35,6 +35,11 @@ namespace SubscriptionTypeMapper
 AWS_BUDGETS_API SubscriptionType GetSubscriptionTypeForName(const Aws::String& name);
 
 AWS_BUDGETS_API Aws::String GetNameForSubscriptionType(SubscriptionType value);
+
+/**
+ * Same as GetNameForSubscriptionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BUDGETS_API const char* GetNameForSubscriptionTypeCStr(SubscriptionType value);
 } // namespace SubscriptionTypeMapper
 } // namespace Model
 } // namespace Budgets
@@ -35,6 +35,11 @@ namespace ThresholdTypeMapper
 AWS_BUDGETS_API ThresholdType GetThresholdTypeForName(const Aws::String& name);
 
 AWS_BUDGETS_API Aws::String GetNameForThresholdType(ThresholdType value);
+
+/**
+ * Same as GetNameForThresholdType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BUDGETS_API const char* GetNameForThresholdTypeCStr(ThresholdType value);
 } // namespace ThresholdTypeMapper
 } // namespace Model
 } // namespace Budgets
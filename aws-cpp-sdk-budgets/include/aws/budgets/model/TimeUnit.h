@@ -37,6 +37,11 @@ namespace TimeUnitMapper
 AWS_BUDGETS_API TimeUnit GetTimeUnitForName(const Aws::String& name);
 
 AWS_BUDGETS_API Aws::String GetNameForTimeUnit(TimeUnit value);
+
+/**
+ * Same as GetNameForTimeUnit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_BUDGETS_API const char* GetNameForTimeUnitCStr(TimeUnit value);
 } // namespace TimeUnitMapper
 } // namespace Model
 } // namespace Budgets
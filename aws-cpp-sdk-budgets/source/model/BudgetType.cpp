@@ -30,30 +30,51 @@ namespace Aws
       namespace BudgetTypeMapper
       {
 
-        static const int USAGE_HASH = HashingUtils::HashString("USAGE");
-        static const int COST_HASH = HashingUtils::HashString("COST");
-        static const int RI_UTILIZATION_HASH = HashingUtils::HashString("RI_UTILIZATION");
-        static const int RI_COVERAGE_HASH = HashingUtils::HashString("RI_COVERAGE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USAGE",
+          "COST",
+          "RI_UTILIZATION",
+          "RI_COVERAGE",
+        };
 
         BudgetType GetBudgetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USAGE_HASH)
-          {
-            return BudgetType::USAGE;
-          }
-          else if (hashCode == COST_HASH)
-          {
-            return BudgetType::COST;
-          }
-          else if (hashCode == RI_UTILIZATION_HASH)
-          {
-            return BudgetType::RI_UTILIZATION;
-          }
-          else if (hashCode == RI_COVERAGE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BudgetType::RI_COVERAGE;
+          case 81036673:
+            if (name == "USAGE")
+            {
+              return BudgetType::USAGE;
+            }
+            break;
+          case 2074573:
+            if (name == "COST")
+            {
+              return BudgetType::COST;
+            }
+            break;
+          case -1599107078:
+            if (name == "RI_UTILIZATION")
+            {
+              return BudgetType::RI_UTILIZATION;
+            }
+            break;
+          case 2034637552:
+            if (name == "RI_COVERAGE")
+            {
+              return BudgetType::RI_COVERAGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return BudgetType::NOT_SET;
         }
 
-        Aws::String GetNameForBudgetType(BudgetType enumValue)
+        const char* GetNameForBudgetTypeCStr(BudgetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BudgetType::USAGE:
-            return "USAGE";
-          case BudgetType::COST:
-            return "COST";
-          case BudgetType::RI_UTILIZATION:
-            return "RI_UTILIZATION";
-          case BudgetType::RI_COVERAGE:
-            return "RI_COVERAGE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBudgetType(BudgetType enumValue)
+        {
+          return GetNameForBudgetTypeCStr(enumValue);
         }
 
       } // namespace BudgetTypeMapper
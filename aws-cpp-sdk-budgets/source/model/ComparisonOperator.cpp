@@ -30,25 +30,44 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int EQUAL_TO_HASH = HashingUtils::HashString("EQUAL_TO");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GREATER_THAN",
+          "LESS_THAN",
+          "EQUAL_TO",
+        };
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GREATER_THAN_HASH)
-          {
-            return ComparisonOperator::GREATER_THAN;
-          }
-          else if (hashCode == LESS_THAN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComparisonOperator::LESS_THAN;
-          }
-          else if (hashCode == EQUAL_TO_HASH)
-          {
-            return ComparisonOperator::EQUAL_TO;
+          case 972152550:
+            if (name == "GREATER_THAN")
+            {
+              return ComparisonOperator::GREATER_THAN;
+            }
+            break;
+          case -1112834937:
+            if (name == "LESS_THAN")
+            {
+              return ComparisonOperator::LESS_THAN;
+            }
+            break;
+          case 1364047750:
+            if (name == "EQUAL_TO")
+            {
+              return ComparisonOperator::EQUAL_TO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperatorCStr(ComparisonOperator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComparisonOperator::GREATER_THAN:
-            return "GREATER_THAN";
-          case ComparisonOperator::LESS_THAN:
-            return "LESS_THAN";
-          case ComparisonOperator::EQUAL_TO:
-            return "EQUAL_TO";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        {
+          return GetNameForComparisonOperatorCStr(enumValue);
         }
 
       } // namespace ComparisonOperatorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace NotificationStateMapper
       {
 
-        static const int OK_HASH = HashingUtils::HashString("OK");
-        static const int ALARM_HASH = HashingUtils::HashString("ALARM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OK",
+          "ALARM",
+        };
 
         NotificationState GetNotificationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OK_HASH)
-          {
-            return NotificationState::OK;
-          }
-          else if (hashCode == ALARM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NotificationState::ALARM;
+          case 2524:
+            if (name == "OK")
+            {
+              return NotificationState::OK;
+            }
+            break;
+          case 62358065:
+            if (name == "ALARM")
+            {
+              return NotificationState::ALARM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return NotificationState::NOT_SET;
         }
 
-        Aws::String GetNameForNotificationState(NotificationState enumValue)
+        const char* GetNameForNotificationStateCStr(NotificationState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NotificationState::OK:
-            return "OK";
-          case NotificationState::ALARM:
-            return "ALARM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNotificationState(NotificationState enumValue)
+        {
+          return GetNameForNotificationStateCStr(enumValue);
         }
 
       } // namespace NotificationStateMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace NotificationTypeMapper
       {
 
-        static const int ACTUAL_HASH = HashingUtils::HashString("ACTUAL");
-        static const int FORECASTED_HASH = HashingUtils::HashString("FORECASTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTUAL",
+          "FORECASTED",
+        };
 
         NotificationType GetNotificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTUAL_HASH)
-          {
-            return NotificationType::ACTUAL;
-          }
-          else if (hashCode == FORECASTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NotificationType::FORECASTED;
+          case 1925356942:
+            if (name == "ACTUAL")
+            {
+              return NotificationType::ACTUAL;
+            }
+            break;
+          case -1955516454:
+            if (name == "FORECASTED")
+            {
+              return NotificationType::FORECASTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return NotificationType::NOT_SET;
         }
 
-        Aws::String GetNameForNotificationType(NotificationType enumValue)
+        const char* GetNameForNotificationTypeCStr(NotificationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NotificationType::ACTUAL:
-            return "ACTUAL";
-          case NotificationType::FORECASTED:
-            return "FORECASTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNotificationType(NotificationType enumValue)
+        {
+          return GetNameForNotificationTypeCStr(enumValue);
         }
 
       } // namespace NotificationTypeMapper
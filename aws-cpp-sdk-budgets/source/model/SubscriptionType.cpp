@@ -30,20 +30,37 @@ namespace Aws
       namespace SubscriptionTypeMapper
       {
 
-        static const int SNS_HASH = HashingUtils::HashString("SNS");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SNS",
+          "EMAIL",
+        };
 
         SubscriptionType GetSubscriptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SNS_HASH)
-          {
-            return SubscriptionType::SNS;
-          }
-          else if (hashCode == EMAIL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SubscriptionType::EMAIL;
+          case 82264:
+            if (name == "SNS")
+            {
+              return SubscriptionType::SNS;
+            }
+            break;
+          case 66081660:
+            if (name == "EMAIL")
+            {
+              return SubscriptionType::EMAIL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SubscriptionType::NOT_SET;
         }
 
-        Aws::String GetNameForSubscriptionType(SubscriptionType enumValue)
+        const char* GetNameForSubscriptionTypeCStr(SubscriptionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SubscriptionType::SNS:
-            return "SNS";
-          case SubscriptionType::EMAIL:
-            return "EMAIL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSubscriptionType(SubscriptionType enumValue)
+        {
+          return GetNameForSubscriptionTypeCStr(enumValue);
         }
 
       } // namespace SubscriptionTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ThresholdTypeMapper
       {
 
-        static const int PERCENTAGE_HASH = HashingUtils::HashString("PERCENTAGE");
-        static const int ABSOLUTE_VALUE_HASH = HashingUtils::HashString("ABSOLUTE_VALUE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PERCENTAGE",
+          "ABSOLUTE_VALUE",
+        };
 
         ThresholdType GetThresholdTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PERCENTAGE_HASH)
-          {
-            return ThresholdType::PERCENTAGE;
-          }
-          else if (hashCode == ABSOLUTE_VALUE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ThresholdType::ABSOLUTE_VALUE;
+          case -436740454:
+            if (name == "PERCENTAGE")
+            {
+              return ThresholdType::PERCENTAGE;
+            }
+            break;
+          case 129090697:
+            if (name == "ABSOLUTE_VALUE")
+            {
+              return ThresholdType::ABSOLUTE_VALUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ThresholdType::NOT_SET;
         }
 
-        Aws::String GetNameForThresholdType(ThresholdType enumValue)
+        const char* GetNameForThresholdTypeCStr(ThresholdType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ThresholdType::PERCENTAGE:
-            return "PERCENTAGE";
-          case ThresholdType::ABSOLUTE_VALUE:
-            return "ABSOLUTE_VALUE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForThresholdType(ThresholdType enumValue)
+        {
+          return GetNameForThresholdTypeCStr(enumValue);
         }
 
       } // namespace ThresholdTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace TimeUnitMapper
       {
 
-        static const int DAILY_HASH = HashingUtils::HashString("DAILY");
-        static const int MONTHLY_HASH = HashingUtils::HashString("MONTHLY");
-        static const int QUARTERLY_HASH = HashingUtils::HashString("QUARTERLY");
-        static const int ANNUALLY_HASH = HashingUtils::HashString("ANNUALLY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DAILY",
+          "MONTHLY",
+          "QUARTERLY",
+          "ANNUALLY",
+        };
 
         TimeUnit GetTimeUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DAILY_HASH)
-          {
-            return TimeUnit::DAILY;
-          }
-          else if (hashCode == MONTHLY_HASH)
-          {
-            return TimeUnit::MONTHLY;
-          }
-          else if (hashCode == QUARTERLY_HASH)
-          {
-            return TimeUnit::QUARTERLY;
-          }
-          else if (hashCode == ANNUALLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TimeUnit::ANNUALLY;
+          case 64808441:
+            if (name == "DAILY")
+            {
+              return TimeUnit::DAILY;
+            }
+            break;
+          case 1954618349:
+            if (name == "MONTHLY")
+            {
+              return TimeUnit::MONTHLY;
+            }
+            break;
+          case 1720567065:
+            if (name == "QUARTERLY")
+            {
+              return TimeUnit::QUARTERLY;
+            }
+            break;
+          case 137950124:
+            if (name == "ANNUALLY")
+            {
+              return TimeUnit::ANNUALLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return TimeUnit::NOT_SET;
         }
 
-        Aws::String GetNameForTimeUnit(TimeUnit enumValue)
+        const char* GetNameForTimeUnitCStr(TimeUnit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TimeUnit::DAILY:
-            return "DAILY";
-          case TimeUnit::MONTHLY:
-            return "MONTHLY";
-          case TimeUnit::QUARTERLY:
-            return "QUARTERLY";
-          case TimeUnit::ANNUALLY:
-            return "ANNUALLY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTimeUnit(TimeUnit enumValue)
+        {
+          return GetNameForTimeUnitCStr(enumValue);
         }
 
       } // namespace TimeUnitMapper
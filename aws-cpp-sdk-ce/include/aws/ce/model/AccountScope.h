@@ -35,6 +35,11 @@ namespace AccountScopeMapper
 AWS_COSTEXPLORER_API AccountScope GetAccountScopeForName(const Aws::String& name);
 
 AWS_COSTEXPLORER_API Aws::String GetNameForAccountScope(AccountScope value);
+
+/**
+ * Same as GetNameForAccountScope(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTEXPLORER_API const char* GetNameForAccountScopeCStr(AccountScope value);
 } // namespace AccountScopeMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -35,6 +35,11 @@ namespace ContextMapper
 AWS_COSTEXPLORER_API Context GetContextForName(const Aws::String& name);
 
 AWS_COSTEXPLORER_API Aws::String GetNameForContext(Context value);
+
+/**
+ * Same as GetNameForContext(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTEXPLORER_API const char* GetNameForContextCStr(Context value);
 } // namespace ContextMapper
 } // namespace Model
 } // namespace CostExplorer
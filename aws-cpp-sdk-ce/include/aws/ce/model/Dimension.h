@@ -55,6 +55,11 @@ namespace DimensionMapper
 AWS_COSTEXPLORER_API Dimension GetDimensionForName(const Aws::String& name);
 
 AWS_COSTEXPLORER_API Aws::String GetNameForDimension(Dimension value);
+
+/**
+ * Same as GetNameForDimension(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTEXPLORER_API const char* GetNameForDimensionCStr(Dimension value);
 } // namespace DimensionMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -36,6 +36,11 @@ namespace GranularityMapper
 AWS_COSTEXPLORER_API Granularity GetGranularityForName(const Aws::String& name);
 
 AWS_COSTEXPLORER_API Aws::String GetNameForGranularity(Granularity value);
+
+/**
+ * Same as GetNameForGranularity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTEXPLORER_API const char* GetNameForGranularityCStr(Granularity value);
 } // namespace GranularityMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -35,6 +35,11 @@ namespace GroupDefinitionTypeMapper
 AWS_COSTEXPLORER_API GroupDefinitionType GetGroupDefinitionTypeForName(const Aws::String& name);
 
 AWS_COSTEXPLORER_API Aws::String GetNameForGroupDefinitionType(GroupDefinitionType value);
+
+/**
+ * Same as GetNameForGroupDefinitionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTEXPLORER_API const char* GetNameForGroupDefinitionTypeCStr(GroupDefinitionType value);
 } // namespace GroupDefinitionTypeMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -36,6 +36,11 @@ namespace LookbackPeriodInDaysMapper
 AWS_COSTEXPLORER_API LookbackPeriodInDays GetLookbackPeriodInDaysForName(const Aws::String& name);
 
 AWS_COSTEXPLORER_API Aws::String GetNameForLookbackPeriodInDays(LookbackPeriodInDays value);
+
+/**
+ * Same as GetNameForLookbackPeriodInDays(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTEXPLORER_API const char* GetNameForLookbackPeriodInDaysCStr(LookbackPeriodInDays value);
 } // namespace LookbackPeriodInDaysMapper
 } // namespace Model
 } // namespace CostExplorer
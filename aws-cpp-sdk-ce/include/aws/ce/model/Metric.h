@@ -40,6 +40,11 @@ namespace MetricMapper
 AWS_COSTEXPLORER_API Metric GetMetricForName(const Aws::String& name);
 
 AWS_COSTEXPLORER_API Aws::String GetNameForMetric(Metric value);
+
+/**
+ * Same as GetNameForMetric(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTEXPLORER_API const char* GetNameForMetricCStr(Metric value);
 } // namespace MetricMapper
 } // namespace Model
 } // namespace CostExplorer
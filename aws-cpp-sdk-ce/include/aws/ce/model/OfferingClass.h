@@ -35,6 +35,11 @@ namespace OfferingClassMapper
 AWS_COSTEXPLORER_API OfferingClass GetOfferingClassForName(const Aws::String& name);
 
 AWS_COSTEXPLORER_API Aws::String GetNameForOfferingClass(OfferingClass value);
+
+/**
+ * Same as GetNameForOfferingClass(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTEXPLORER_API const char* GetNameForOfferingClassCStr(OfferingClass value);
 } // namespace OfferingClassMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -39,6 +39,11 @@ namespace PaymentOptionMapper
 AWS_COSTEXPLORER_API PaymentOption GetPaymentOptionForName(const Aws::String& name);
 
 AWS_COSTEXPLORER_API Aws::String GetNameForPaymentOption(PaymentOption value);
+
+/**
+ * Same as GetNameForPaymentOption(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTEXPLORER_API const char* GetNameForPaymentOptionCStr(PaymentOption value);
 } // namespace PaymentOptionMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -35,6 +35,11 @@ namespace TermInYearsMapper
 AWS_COSTEXPLORER_API TermInYears GetTermInYearsForName(const Aws::String& name);
 
 AWS_COSTEXPLORER_API Aws::String GetNameForTermInYears(TermInYears value);
+
+/**
+ * Same as GetNameForTermInYears(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTEXPLORER_API const char* GetNameForTermInYearsCStr(TermInYears value);
 } // namespace TermInYearsMapper
 } // namespace Model
 } // namespace CostExplorer
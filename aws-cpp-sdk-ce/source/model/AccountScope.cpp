@@ -30,20 +30,37 @@ namespace Aws
       namespace AccountScopeMapper
       {
 
-        static const int PAYER_HASH = HashingUtils::HashString("PAYER");
-        static const int LINKED_HASH = HashingUtils::HashString("LINKED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PAYER",
+          "LINKED",
+        };
 
         AccountScope GetAccountScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PAYER_HASH)
-          {
-            return AccountScope::PAYER;
-          }
-          else if (hashCode == LINKED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccountScope::LINKED;
+          case 75905845:
+            if (name == "PAYER")
+            {
+              return AccountScope::PAYER;
+            }
+            break;
+          case -2049336807:
+            if (name == "LINKED")
+            {
+              return AccountScope::LINKED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AccountScope::NOT_SET;
         }
 
-        Aws::String GetNameForAccountScope(AccountScope enumValue)
+        const char* GetNameForAccountScopeCStr(AccountScope enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccountScope::PAYER:
-            return "PAYER";
-          case AccountScope::LINKED:
-            return "LINKED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccountScope(AccountScope enumValue)
+        {
+          return GetNameForAccountScopeCStr(enumValue);
         }
 
       } // namespace AccountScopeMapper
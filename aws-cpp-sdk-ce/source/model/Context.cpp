@@ -30,20 +30,37 @@ namespace Aws
       namespace ContextMapper
       {
 
-        static const int COST_AND_USAGE_HASH = HashingUtils::HashString("COST_AND_USAGE");
-        static const int RESERVATIONS_HASH = HashingUtils::HashString("RESERVATIONS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COST_AND_USAGE",
+          "RESERVATIONS",
+        };
 
         Context GetContextForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COST_AND_USAGE_HASH)
-          {
-            return Context::COST_AND_USAGE;
-          }
-          else if (hashCode == RESERVATIONS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Context::RESERVATIONS;
+          case -1200388345:
+            if (name == "COST_AND_USAGE")
+            {
+              return Context::COST_AND_USAGE;
+            }
+            break;
+          case 1106386471:
+            if (name == "RESERVATIONS")
+            {
+              return Context::RESERVATIONS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Context::NOT_SET;
         }
 
-        Aws::String GetNameForContext(Context enumValue)
+        const char* GetNameForContextCStr(Context enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Context::COST_AND_USAGE:
-            return "COST_AND_USAGE";
-          case Context::RESERVATIONS:
-            return "RESERVATIONS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContext(Context enumValue)
+        {
+          return GetNameForContextCStr(enumValue);
         }
 
       } // namespace ContextMapper
@@ -30,120 +30,177 @@ namespace Aws
       namespace DimensionMapper
       {
 
-        static const int AZ_HASH = HashingUtils::HashString("AZ");
-        static const int INSTANCE_TYPE_HASH = HashingUtils::HashString("INSTANCE_TYPE");
-        static const int LINKED_ACCOUNT_HASH = HashingUtils::HashString("LINKED_ACCOUNT");
-        static const int OPERATION_HASH = HashingUtils::HashString("OPERATION");
-        static const int PURCHASE_TYPE_HASH = HashingUtils::HashString("PURCHASE_TYPE");
-        static const int REGION_HASH = HashingUtils::HashString("REGION");
-        static const int SERVICE_HASH = HashingUtils::HashString("SERVICE");
-        static const int USAGE_TYPE_HASH = HashingUtils::HashString("USAGE_TYPE");
-        static const int USAGE_TYPE_GROUP_HASH = HashingUtils::HashString("USAGE_TYPE_GROUP");
-        static const int RECORD_TYPE_HASH = HashingUtils::HashString("RECORD_TYPE");
-        static const int OPERATING_SYSTEM_HASH = HashingUtils::HashString("OPERATING_SYSTEM");
-        static const int TENANCY_HASH = HashingUtils::HashString("TENANCY");
-        static const int SCOPE_HASH = HashingUtils::HashString("SCOPE");
-        static const int PLATFORM_HASH = HashingUtils::HashString("PLATFORM");
-        static const int SUBSCRIPTION_ID_HASH = HashingUtils::HashString("SUBSCRIPTION_ID");
-        static const int LEGAL_ENTITY_NAME_HASH = HashingUtils::HashString("LEGAL_ENTITY_NAME");
-        static const int DEPLOYMENT_OPTION_HASH = HashingUtils::HashString("DEPLOYMENT_OPTION");
-        static const int DATABASE_ENGINE_HASH = HashingUtils::HashString("DATABASE_ENGINE");
-        static const int CACHE_ENGINE_HASH = HashingUtils::HashString("CACHE_ENGINE");
-        static const int INSTANCE_TYPE_FAMILY_HASH = HashingUtils::HashString("INSTANCE_TYPE_FAMILY");
-        static const int BILLING_ENTITY_HASH = HashingUtils::HashString("BILLING_ENTITY");
-        static const int RESERVATION_ID_HASH = HashingUtils::HashString("RESERVATION_ID");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AZ",
+          "INSTANCE_TYPE",
+          "LINKED_ACCOUNT",
+          "OPERATION",
+          "PURCHASE_TYPE",
+          "REGION",
+          "SERVICE",
+          "USAGE_TYPE",
+          "USAGE_TYPE_GROUP",
+          "RECORD_TYPE",
+          "OPERATING_SYSTEM",
+          "TENANCY",
+          "SCOPE",
+          "PLATFORM",
+          "SUBSCRIPTION_ID",
+          "LEGAL_ENTITY_NAME",
+          "DEPLOYMENT_OPTION",
+          "DATABASE_ENGINE",
+          "CACHE_ENGINE",
+          "INSTANCE_TYPE_FAMILY",
+          "BILLING_ENTITY",
+          "RESERVATION_ID",
+        };
 
         Dimension GetDimensionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AZ_HASH)
-          {
-            return Dimension::AZ;
-          }
-          else if (hashCode == INSTANCE_TYPE_HASH)
-          {
-            return Dimension::INSTANCE_TYPE;
-          }
-          else if (hashCode == LINKED_ACCOUNT_HASH)
-          {
-            return Dimension::LINKED_ACCOUNT;
-          }
-          else if (hashCode == OPERATION_HASH)
-          {
-            return Dimension::OPERATION;
-          }
-          else if (hashCode == PURCHASE_TYPE_HASH)
-          {
-            return Dimension::PURCHASE_TYPE;
-          }
-          else if (hashCode == REGION_HASH)
-          {
-            return Dimension::REGION;
-          }
-          else if (hashCode == SERVICE_HASH)
-          {
-            return Dimension::SERVICE;
-          }
-          else if (hashCode == USAGE_TYPE_HASH)
-          {
-            return Dimension::USAGE_TYPE;
-          }
-          else if (hashCode == USAGE_TYPE_GROUP_HASH)
-          {
-            return Dimension::USAGE_TYPE_GROUP;
-          }
-          else if (hashCode == RECORD_TYPE_HASH)
-          {
-            return Dimension::RECORD_TYPE;
-          }
-          else if (hashCode == OPERATING_SYSTEM_HASH)
-          {
-            return Dimension::OPERATING_SYSTEM;
-          }
-          else if (hashCode == TENANCY_HASH)
-          {
-            return Dimension::TENANCY;
-          }
-          else if (hashCode == SCOPE_HASH)
-          {
-            return Dimension::SCOPE;
-          }
-          else if (hashCode == PLATFORM_HASH)
-          {
-            return Dimension::PLATFORM;
-          }
-          else if (hashCode == SUBSCRIPTION_ID_HASH)
-          {
-            return Dimension::SUBSCRIPTION_ID;
-          }
-          else if (hashCode == LEGAL_ENTITY_NAME_HASH)
-          {
-            return Dimension::LEGAL_ENTITY_NAME;
-          }
-          else if (hashCode == DEPLOYMENT_OPTION_HASH)
-          {
-            return Dimension::DEPLOYMENT_OPTION;
-          }
-          else if (hashCode == DATABASE_ENGINE_HASH)
-          {
-            return Dimension::DATABASE_ENGINE;
-          }
-          else if (hashCode == CACHE_ENGINE_HASH)
-          {
-            return Dimension::CACHE_ENGINE;
-          }
-          else if (hashCode == INSTANCE_TYPE_FAMILY_HASH)
-          {
-            return Dimension::INSTANCE_TYPE_FAMILY;
-          }
-          else if (hashCode == BILLING_ENTITY_HASH)
-          {
-            return Dimension::BILLING_ENTITY;
-          }
-          else if (hashCode == RESERVATION_ID_HASH)
-          {
-            return Dimension::RESERVATION_ID;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 2105:
+            if (name == "AZ")
+            {
+              return Dimension::AZ;
+            }
+            break;
+          case 1763332260:
+            if (name == "INSTANCE_TYPE")
+            {
+              return Dimension::INSTANCE_TYPE;
+            }
+            break;
+          case -1283641881:
+            if (name == "LINKED_ACCOUNT")
+            {
+              return Dimension::LINKED_ACCOUNT;
+            }
+            break;
+          case 154330439:
+            if (name == "OPERATION")
+            {
+              return Dimension::OPERATION;
+            }
+            break;
+          case 1821983672:
+            if (name == "PURCHASE_TYPE")
+            {
+              return Dimension::PURCHASE_TYPE;
+            }
+            break;
+          case -1881466124:
+            if (name == "REGION")
+            {
+              return Dimension::REGION;
+            }
+            break;
+          case -1592831339:
+            if (name == "SERVICE")
+            {
+              return Dimension::SERVICE;
+            }
+            break;
+          case -1246100680:
+            if (name == "USAGE_TYPE")
+            {
+              return Dimension::USAGE_TYPE;
+            }
+            break;
+          case -311158120:
+            if (name == "USAGE_TYPE_GROUP")
+            {
+              return Dimension::USAGE_TYPE_GROUP;
+            }
+            break;
+          case -794989976:
+            if (name == "RECORD_TYPE")
+            {
+              return Dimension::RECORD_TYPE;
+            }
+            break;
+          case -1613256947:
+            if (name == "OPERATING_SYSTEM")
+            {
+              return Dimension::OPERATING_SYSTEM;
+            }
+            break;
+          case -709642528:
+            if (name == "TENANCY")
+            {
+              return Dimension::TENANCY;
+            }
+            break;
+          case 78726708:
+            if (name == "SCOPE")
+            {
+              return Dimension::SCOPE;
+            }
+            break;
+          case -1637656461:
+            if (name == "PLATFORM")
+            {
+              return Dimension::PLATFORM;
+            }
+            break;
+          case -284836995:
+            if (name == "SUBSCRIPTION_ID")
+            {
+              return Dimension::SUBSCRIPTION_ID;
+            }
+            break;
+          case 2083812545:
+            if (name == "LEGAL_ENTITY_NAME")
+            {
+              return Dimension::LEGAL_ENTITY_NAME;
+            }
+            break;
+          case -1289118929:
+            if (name == "DEPLOYMENT_OPTION")
+            {
+              return Dimension::DEPLOYMENT_OPTION;
+            }
+            break;
+          case 97081734:
+            if (name == "DATABASE_ENGINE")
+            {
+              return Dimension::DATABASE_ENGINE;
+            }
+            break;
+          case -1890352705:
+            if (name == "CACHE_ENGINE")
+            {
+              return Dimension::CACHE_ENGINE;
+            }
+            break;
+          case 210221919:
+            if (name == "INSTANCE_TYPE_FAMILY")
+            {
+              return Dimension::INSTANCE_TYPE_FAMILY;
+            }
+            break;
+          case 2081184327:
+            if (name == "BILLING_ENTITY")
+            {
+              return Dimension::BILLING_ENTITY;
+            }
+            break;
+          case -1914476914:
+            if (name == "RESERVATION_ID")
+            {
+              return Dimension::RESERVATION_ID;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -155,63 +212,26 @@ namespace Aws
           return Dimension::NOT_SET;
         }
 
-        Aws::String GetNameForDimension(Dimension enumValue)
+        const char* GetNameForDimensionCStr(Dimension enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Dimension::AZ:
-            return "AZ";
-          case Dimension::INSTANCE_TYPE:
-            return "INSTANCE_TYPE";
-          case Dimension::LINKED_ACCOUNT:
-            return "LINKED_ACCOUNT";
-          case Dimension::OPERATION:
-            return "OPERATION";
-          case Dimension::PURCHASE_TYPE:
-            return "PURCHASE_TYPE";
-          case Dimension::REGION:
-            return "REGION";
-          case Dimension::SERVICE:
-            return "SERVICE";
-          case Dimension::USAGE_TYPE:
-            return "USAGE_TYPE";
-          case Dimension::USAGE_TYPE_GROUP:
-            return "USAGE_TYPE_GROUP";
-          case Dimension::RECORD_TYPE:
-            return "RECORD_TYPE";
-          case Dimension::OPERATING_SYSTEM:
-            return "OPERATING_SYSTEM";
-          case Dimension::TENANCY:
-            return "TENANCY";
-          case Dimension::SCOPE:
-            return "SCOPE";
-          case Dimension::PLATFORM:
-            return "PLATFORM";
-          case Dimension::SUBSCRIPTION_ID:
-            return "SUBSCRIPTION_ID";
-          case Dimension::LEGAL_ENTITY_NAME:
-            return "LEGAL_ENTITY_NAME";
-          case Dimension::DEPLOYMENT_OPTION:
-            return "DEPLOYMENT_OPTION";
-          case Dimension::DATABASE_ENGINE:
-            return "DATABASE_ENGINE";
-          case Dimension::CACHE_ENGINE:
-            return "CACHE_ENGINE";
-          case Dimension::INSTANCE_TYPE_FAMILY:
-            return "INSTANCE_TYPE_FAMILY";
-          case Dimension::BILLING_ENTITY:
-            return "BILLING_ENTITY";
-          case Dimension::RESERVATION_ID:
-            return "RESERVATION_ID";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDimension(Dimension enumValue)
+        {
+          return GetNameForDimensionCStr(enumValue);
         }
 
       } // namespace DimensionMapper
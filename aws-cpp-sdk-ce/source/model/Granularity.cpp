@@ -30,25 +30,44 @@ namespace Aws
       namespace GranularityMapper
       {
 
-        static const int DAILY_HASH = HashingUtils::HashString("DAILY");
-        static const int MONTHLY_HASH = HashingUtils::HashString("MONTHLY");
-        static const int HOURLY_HASH = HashingUtils::HashString("HOURLY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DAILY",
+          "MONTHLY",
+          "HOURLY",
+        };
 
         Granularity GetGranularityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DAILY_HASH)
-          {
-            return Granularity::DAILY;
-          }
-          else if (hashCode == MONTHLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Granularity::MONTHLY;
-          }
-          else if (hashCode == HOURLY_HASH)
-          {
-            return Granularity::HOURLY;
+          case 64808441:
+            if (name == "DAILY")
+            {
+              return Granularity::DAILY;
+            }
+            break;
+          case 1954618349:
+            if (name == "MONTHLY")
+            {
+              return Granularity::MONTHLY;
+            }
+            break;
+          case 2136870513:
+            if (name == "HOURLY")
+            {
+              return Granularity::HOURLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Granularity::NOT_SET;
         }
 
-        Aws::String GetNameForGranularity(Granularity enumValue)
+        const char* GetNameForGranularityCStr(Granularity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Granularity::DAILY:
-            return "DAILY";
-          case Granularity::MONTHLY:
-            return "MONTHLY";
-          case Granularity::HOURLY:
-            return "HOURLY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGranularity(Granularity enumValue)
+        {
+          return GetNameForGranularityCStr(enumValue);
         }
 
       } // namespace GranularityMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace GroupDefinitionTypeMapper
       {
 
-        static const int DIMENSION_HASH = HashingUtils::HashString("DIMENSION");
-        static const int TAG_HASH = HashingUtils::HashString("TAG");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DIMENSION",
+          "TAG",
+        };
 
         GroupDefinitionType GetGroupDefinitionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DIMENSION_HASH)
-          {
-            return GroupDefinitionType::DIMENSION;
-          }
-          else if (hashCode == TAG_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GroupDefinitionType::TAG;
+          case 1691581766:
+            if (name == "DIMENSION")
+            {
+              return GroupDefinitionType::DIMENSION;
+            }
+            break;
+          case 82810:
+            if (name == "TAG")
+            {
+              return GroupDefinitionType::TAG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return GroupDefinitionType::NOT_SET;
         }
 
-        Aws::String GetNameForGroupDefinitionType(GroupDefinitionType enumValue)
+        const char* GetNameForGroupDefinitionTypeCStr(GroupDefinitionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GroupDefinitionType::DIMENSION:
-            return "DIMENSION";
-          case GroupDefinitionType::TAG:
-            return "TAG";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGroupDefinitionType(GroupDefinitionType enumValue)
+        {
+          return GetNameForGroupDefinitionTypeCStr(enumValue);
         }
 
       } // namespace GroupDefinitionTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace LookbackPeriodInDaysMapper
       {
 
-        static const int SEVEN_DAYS_HASH = HashingUtils::HashString("SEVEN_DAYS");
-        static const int THIRTY_DAYS_HASH = HashingUtils::HashString("THIRTY_DAYS");
-        static const int SIXTY_DAYS_HASH = HashingUtils::HashString("SIXTY_DAYS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SEVEN_DAYS",
+          "THIRTY_DAYS",
+          "SIXTY_DAYS",
+        };
 
         LookbackPeriodInDays GetLookbackPeriodInDaysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SEVEN_DAYS_HASH)
-          {
-            return LookbackPeriodInDays::SEVEN_DAYS;
-          }
-          else if (hashCode == THIRTY_DAYS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LookbackPeriodInDays::THIRTY_DAYS;
-          }
-          else if (hashCode == SIXTY_DAYS_HASH)
-          {
-            return LookbackPeriodInDays::SIXTY_DAYS;
+          case -597080727:
+            if (name == "SEVEN_DAYS")
+            {
+              return LookbackPeriodInDays::SEVEN_DAYS;
+            }
+            break;
+          case 370925716:
+            if (name == "THIRTY_DAYS")
+            {
+              return LookbackPeriodInDays::THIRTY_DAYS;
+            }
+            break;
+          case 696263375:
+            if (name == "SIXTY_DAYS")
+            {
+              return LookbackPeriodInDays::SIXTY_DAYS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return LookbackPeriodInDays::NOT_SET;
         }
 
-        Aws::String GetNameForLookbackPeriodInDays(LookbackPeriodInDays enumValue)
+        const char* GetNameForLookbackPeriodInDaysCStr(LookbackPeriodInDays enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LookbackPeriodInDays::SEVEN_DAYS:
-            return "SEVEN_DAYS";
-          case LookbackPeriodInDays::THIRTY_DAYS:
-            return "THIRTY_DAYS";
-          case LookbackPeriodInDays::SIXTY_DAYS:
-            return "SIXTY_DAYS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLookbackPeriodInDays(LookbackPeriodInDays enumValue)
+        {
+          return GetNameForLookbackPeriodInDaysCStr(enumValue);
         }
 
       } // namespace LookbackPeriodInDaysMapper
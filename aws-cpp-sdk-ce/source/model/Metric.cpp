@@ -30,45 +30,72 @@ namespace Aws
       namespace MetricMapper
       {
 
-        static const int BLENDED_COST_HASH = HashingUtils::HashString("BLENDED_COST");
-        static const int UNBLENDED_COST_HASH = HashingUtils::HashString("UNBLENDED_COST");
-        static const int AMORTIZED_COST_HASH = HashingUtils::HashString("AMORTIZED_COST");
-        static const int NET_UNBLENDED_COST_HASH = HashingUtils::HashString("NET_UNBLENDED_COST");
-        static const int NET_AMORTIZED_COST_HASH = HashingUtils::HashString("NET_AMORTIZED_COST");
-        static const int USAGE_QUANTITY_HASH = HashingUtils::HashString("USAGE_QUANTITY");
-        static const int NORMALIZED_USAGE_AMOUNT_HASH = HashingUtils::HashString("NORMALIZED_USAGE_AMOUNT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLENDED_COST",
+          "UNBLENDED_COST",
+          "AMORTIZED_COST",
+          "NET_UNBLENDED_COST",
+          "NET_AMORTIZED_COST",
+          "USAGE_QUANTITY",
+          "NORMALIZED_USAGE_AMOUNT",
+        };
 
         Metric GetMetricForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLENDED_COST_HASH)
-          {
-            return Metric::BLENDED_COST;
-          }
-          else if (hashCode == UNBLENDED_COST_HASH)
-          {
-            return Metric::UNBLENDED_COST;
-          }
-          else if (hashCode == AMORTIZED_COST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Metric::AMORTIZED_COST;
-          }
-          else if (hashCode == NET_UNBLENDED_COST_HASH)
-          {
-            return Metric::NET_UNBLENDED_COST;
-          }
-          else if (hashCode == NET_AMORTIZED_COST_HASH)
-          {
-            return Metric::NET_AMORTIZED_COST;
-          }
-          else if (hashCode == USAGE_QUANTITY_HASH)
-          {
-            return Metric::USAGE_QUANTITY;
-          }
-          else if (hashCode == NORMALIZED_USAGE_AMOUNT_HASH)
-          {
-            return Metric::NORMALIZED_USAGE_AMOUNT;
+          case -2020027876:
+            if (name == "BLENDED_COST")
+            {
+              return Metric::BLENDED_COST;
+            }
+            break;
+          case 841531189:
+            if (name == "UNBLENDED_COST")
+            {
+              return Metric::UNBLENDED_COST;
+            }
+            break;
+          case -670769257:
+            if (name == "AMORTIZED_COST")
+            {
+              return Metric::AMORTIZED_COST;
+            }
+            break;
+          case 816690743:
+            if (name == "NET_UNBLENDED_COST")
+            {
+              return Metric::NET_UNBLENDED_COST;
+            }
+            break;
+          case -695609703:
+            if (name == "NET_AMORTIZED_COST")
+            {
+              return Metric::NET_AMORTIZED_COST;
+            }
+            break;
+          case 1374069129:
+            if (name == "USAGE_QUANTITY")
+            {
+              return Metric::USAGE_QUANTITY;
+            }
+            break;
+          case 2083847454:
+            if (name == "NORMALIZED_USAGE_AMOUNT")
+            {
+              return Metric::NORMALIZED_USAGE_AMOUNT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return Metric::NOT_SET;
         }
 
-        Aws::String GetNameForMetric(Metric enumValue)
+        const char* GetNameForMetricCStr(Metric enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Metric::BLENDED_COST:
-            return "BLENDED_COST";
-          case Metric::UNBLENDED_COST:
-            return "UNBLENDED_COST";
-          case Metric::AMORTIZED_COST:
-            return "AMORTIZED_COST";
-          case Metric::NET_UNBLENDED_COST:
-            return "NET_UNBLENDED_COST";
-          case Metric::NET_AMORTIZED_COST:
-            return "NET_AMORTIZED_COST";
-          case Metric::USAGE_QUANTITY:
-            return "USAGE_QUANTITY";
-          case Metric::NORMALIZED_USAGE_AMOUNT:
-            return "NORMALIZED_USAGE_AMOUNT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMetric(Metric enumValue)
+        {
+          return GetNameForMetricCStr(enumValue);
         }
 
       } // namespace MetricMapper
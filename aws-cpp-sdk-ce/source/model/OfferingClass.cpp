@@ -30,20 +30,37 @@ namespace Aws
       namespace OfferingClassMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int CONVERTIBLE_HASH = HashingUtils::HashString("CONVERTIBLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STANDARD",
+          "CONVERTIBLE",
+        };
 
         OfferingClass GetOfferingClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
-          {
-            return OfferingClass::STANDARD;
-          }
-          else if (hashCode == CONVERTIBLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OfferingClass::CONVERTIBLE;
+          case 2095255229:
+            if (name == "STANDARD")
+            {
+              return OfferingClass::STANDARD;
+            }
+            break;
+          case 1069602917:
+            if (name == "CONVERTIBLE")
+            {
+              return OfferingClass::CONVERTIBLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OfferingClass::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingClass(OfferingClass enumValue)
+        const char* GetNameForOfferingClassCStr(OfferingClass enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OfferingClass::STANDARD:
-            return "STANDARD";
-          case OfferingClass::CONVERTIBLE:
-            return "CONVERTIBLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOfferingClass(OfferingClass enumValue)
+        {
+          return GetNameForOfferingClassCStr(enumValue);
         }
 
       } // namespace OfferingClassMapper
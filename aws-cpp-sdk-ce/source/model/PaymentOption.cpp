@@ -30,40 +30,65 @@ namespace Aws
       namespace PaymentOptionMapper
       {
 
-        static const int NO_UPFRONT_HASH = HashingUtils::HashString("NO_UPFRONT");
-        static const int PARTIAL_UPFRONT_HASH = HashingUtils::HashString("PARTIAL_UPFRONT");
-        static const int ALL_UPFRONT_HASH = HashingUtils::HashString("ALL_UPFRONT");
-        static const int LIGHT_UTILIZATION_HASH = HashingUtils::HashString("LIGHT_UTILIZATION");
-        static const int MEDIUM_UTILIZATION_HASH = HashingUtils::HashString("MEDIUM_UTILIZATION");
-        static const int HEAVY_UTILIZATION_HASH = HashingUtils::HashString("HEAVY_UTILIZATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NO_UPFRONT",
+          "PARTIAL_UPFRONT",
+          "ALL_UPFRONT",
+          "LIGHT_UTILIZATION",
+          "MEDIUM_UTILIZATION",
+          "HEAVY_UTILIZATION",
+        };
 
         PaymentOption GetPaymentOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_UPFRONT_HASH)
-          {
-            return PaymentOption::NO_UPFRONT;
-          }
-          else if (hashCode == PARTIAL_UPFRONT_HASH)
-          {
-            return PaymentOption::PARTIAL_UPFRONT;
-          }
-          else if (hashCode == ALL_UPFRONT_HASH)
-          {
-            return PaymentOption::ALL_UPFRONT;
-          }
-          else if (hashCode == LIGHT_UTILIZATION_HASH)
-          {
-            return PaymentOption::LIGHT_UTILIZATION;
-          }
-          else if (hashCode == MEDIUM_UTILIZATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PaymentOption::MEDIUM_UTILIZATION;
-          }
-          else if (hashCode == HEAVY_UTILIZATION_HASH)
-          {
-            return PaymentOption::HEAVY_UTILIZATION;
+          case -654007344:
+            if (name == "NO_UPFRONT")
+            {
+              return PaymentOption::NO_UPFRONT;
+            }
+            break;
+          case -2083041424:
+            if (name == "PARTIAL_UPFRONT")
+            {
+              return PaymentOption::PARTIAL_UPFRONT;
+            }
+            break;
+          case 28694416:
+            if (name == "ALL_UPFRONT")
+            {
+              return PaymentOption::ALL_UPFRONT;
+            }
+            break;
+          case 1049074745:
+            if (name == "LIGHT_UTILIZATION")
+            {
+              return PaymentOption::LIGHT_UTILIZATION;
+            }
+            break;
+          case 1750015032:
+            if (name == "MEDIUM_UTILIZATION")
+            {
+              return PaymentOption::MEDIUM_UTILIZATION;
+            }
+            break;
+          case 1562662506:
+            if (name == "HEAVY_UTILIZATION")
+            {
+              return PaymentOption::HEAVY_UTILIZATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return PaymentOption::NOT_SET;
         }
 
-        Aws::String GetNameForPaymentOption(PaymentOption enumValue)
+        const char* GetNameForPaymentOptionCStr(PaymentOption enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PaymentOption::NO_UPFRONT:
-            return "NO_UPFRONT";
-          case PaymentOption::PARTIAL_UPFRONT:
-            return "PARTIAL_UPFRONT";
-          case PaymentOption::ALL_UPFRONT:
-            return "ALL_UPFRONT";
-          case PaymentOption::LIGHT_UTILIZATION:
-            return "LIGHT_UTILIZATION";
-          case PaymentOption::MEDIUM_UTILIZATION:
-            return "MEDIUM_UTILIZATION";
-          case PaymentOption::HEAVY_UTILIZATION:
-            return "HEAVY_UTILIZATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPaymentOption(PaymentOption enumValue)
+        {
+          return GetNameForPaymentOptionCStr(enumValue);
         }
 
       } // namespace PaymentOptionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TermInYearsMapper
       {
 
-        static const int ONE_YEAR_HASH = HashingUtils::HashString("ONE_YEAR");
-        static const int THREE_YEARS_HASH = HashingUtils::HashString("THREE_YEARS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ONE_YEAR",
+          "THREE_YEARS",
+        };
 
         TermInYears GetTermInYearsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONE_YEAR_HASH)
-          {
-            return TermInYears::ONE_YEAR;
-          }
-          else if (hashCode == THREE_YEARS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TermInYears::THREE_YEARS;
+          case -1480228202:
+            if (name == "ONE_YEAR")
+            {
+              return TermInYears::ONE_YEAR;
+            }
+            break;
+          case -159383115:
+            if (name == "THREE_YEARS")
+            {
+              return TermInYears::THREE_YEARS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TermInYears::NOT_SET;
         }
 
-        Aws::String GetNameForTermInYears(TermInYears enumValue)
+        const char* GetNameForTermInYearsCStr(TermInYears enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TermInYears::ONE_YEAR:
-            return "ONE_YEAR";
-          case TermInYears::THREE_YEARS:
-            return "THREE_YEARS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTermInYears(TermInYears enumValue)
+        {
+          return GetNameForTermInYearsCStr(enumValue);
         }
 
       } // namespace TermInYearsMapper
@@ -37,6 +37,11 @@ namespace AccountTypeMapper
 AWS_CHIME_API AccountType GetAccountTypeForName(const Aws::String& name);
 
 AWS_CHIME_API Aws::String GetNameForAccountType(AccountType value);
+
+/**
+ * Same as GetNameForAccountType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CHIME_API const char* GetNameForAccountTypeCStr(AccountType value);
 } // namespace AccountTypeMapper
 } // namespace Model
 } // namespace Chime
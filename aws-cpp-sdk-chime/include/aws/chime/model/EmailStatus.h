@@ -36,6 +36,11 @@ namespace EmailStatusMapper
 AWS_CHIME_API EmailStatus GetEmailStatusForName(const Aws::String& name);
 
 AWS_CHIME_API Aws::String GetNameForEmailStatus(EmailStatus value);
+
+/**
+ * Same as GetNameForEmailStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CHIME_API const char* GetNameForEmailStatusCStr(EmailStatus value);
 } // namespace EmailStatusMapper
 } // namespace Model
 } // namespace Chime
@@ -36,6 +36,11 @@ namespace InviteStatusMapper
 AWS_CHIME_API InviteStatus GetInviteStatusForName(const Aws::String& name);
 
 AWS_CHIME_API Aws::String GetNameForInviteStatus(InviteStatus value);
+
+/**
+ * Same as GetNameForInviteStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CHIME_API const char* GetNameForInviteStatusCStr(InviteStatus value);
 } // namespace InviteStatusMapper
 } // namespace Model
 } // namespace Chime
@@ -37,6 +37,11 @@ namespace LicenseMapper
 AWS_CHIME_API License GetLicenseForName(const Aws::String& name);
 
 AWS_CHIME_API Aws::String GetNameForLicense(License value);
+
+/**
+ * Same as GetNameForLicense(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CHIME_API const char* GetNameForLicenseCStr(License value);
 } // namespace LicenseMapper
 } // namespace Model
 } // namespace Chime
@@ -30,30 +30,51 @@ namespace Aws
       namespace AccountTypeMapper
       {
 
-        static const int Team_HASH = HashingUtils::HashString("Team");
-        static const int EnterpriseDirectory_HASH = HashingUtils::HashString("EnterpriseDirectory");
-        static const int EnterpriseLWA_HASH = HashingUtils::HashString("EnterpriseLWA");
-        static const int EnterpriseOIDC_HASH = HashingUtils::HashString("EnterpriseOIDC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Team",
+          "EnterpriseDirectory",
+          "EnterpriseLWA",
+          "EnterpriseOIDC",
+        };
 
         AccountType GetAccountTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Team_HASH)
-          {
-            return AccountType::Team;
-          }
-          else if (hashCode == EnterpriseDirectory_HASH)
-          {
-            return AccountType::EnterpriseDirectory;
-          }
-          else if (hashCode == EnterpriseLWA_HASH)
-          {
-            return AccountType::EnterpriseLWA;
-          }
-          else if (hashCode == EnterpriseOIDC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccountType::EnterpriseOIDC;
+          case 2602621:
+            if (name == "Team")
+            {
+              return AccountType::Team;
+            }
+            break;
+          case 635178988:
+            if (name == "EnterpriseDirectory")
+            {
+              return AccountType::EnterpriseDirectory;
+            }
+            break;
+          case 829709557:
+            if (name == "EnterpriseLWA")
+            {
+              return AccountType::EnterpriseLWA;
+            }
+            break;
+          case -48731430:
+            if (name == "EnterpriseOIDC")
+            {
+              return AccountType::EnterpriseOIDC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AccountType::NOT_SET;
         }
 
-        Aws::String GetNameForAccountType(AccountType enumValue)
+        const char* GetNameForAccountTypeCStr(AccountType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccountType::Team:
-            return "Team";
-          case AccountType::EnterpriseDirectory:
-            return "EnterpriseDirectory";
-          case AccountType::EnterpriseLWA:
-            return "EnterpriseLWA";
-          case AccountType::EnterpriseOIDC:
-            return "EnterpriseOIDC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccountType(AccountType enumValue)
+        {
+          return GetNameForAccountTypeCStr(enumValue);
         }
 
       } // namespace AccountTypeMapper
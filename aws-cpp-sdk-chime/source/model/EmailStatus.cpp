@@ -30,25 +30,44 @@ namespace Aws
       namespace EmailStatusMapper
       {
 
-        static const int NotSent_HASH = HashingUtils::HashString("NotSent");
-        static const int Sent_HASH = HashingUtils::HashString("Sent");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NotSent",
+          "Sent",
+          "Failed",
+        };
 
         EmailStatus GetEmailStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NotSent_HASH)
-          {
-            return EmailStatus::NotSent;
-          }
-          else if (hashCode == Sent_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EmailStatus::Sent;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return EmailStatus::Failed;
+          case -501619477:
+            if (name == "NotSent")
+            {
+              return EmailStatus::NotSent;
+            }
+            break;
+          case 2573240:
+            if (name == "Sent")
+            {
+              return EmailStatus::Sent;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return EmailStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EmailStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEmailStatus(EmailStatus enumValue)
+        const char* GetNameForEmailStatusCStr(EmailStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EmailStatus::NotSent:
-            return "NotSent";
-          case EmailStatus::Sent:
-            return "Sent";
-          case EmailStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEmailStatus(EmailStatus enumValue)
+        {
+          return GetNameForEmailStatusCStr(enumValue);
         }
 
       } // namespace EmailStatusMapper
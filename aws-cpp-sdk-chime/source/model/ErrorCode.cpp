@@ -30,60 +30,93 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int Unauthorized_HASH = HashingUtils::HashString("Unauthorized");
-        static const int Forbidden_HASH = HashingUtils::HashString("Forbidden");
-        static const int NotFound_HASH = HashingUtils::HashString("NotFound");
-        static const int BadRequest_HASH = HashingUtils::HashString("BadRequest");
-        static const int Conflict_HASH = HashingUtils::HashString("Conflict");
-        static const int ServiceFailure_HASH = HashingUtils::HashString("ServiceFailure");
-        static const int ServiceUnavailable_HASH = HashingUtils::HashString("ServiceUnavailable");
-        static const int Unprocessable_HASH = HashingUtils::HashString("Unprocessable");
-        static const int Throttled_HASH = HashingUtils::HashString("Throttled");
-        static const int PreconditionFailed_HASH = HashingUtils::HashString("PreconditionFailed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Unauthorized",
+          "Forbidden",
+          "NotFound",
+          "BadRequest",
+          "Conflict",
+          "ServiceFailure",
+          "ServiceUnavailable",
+          "Unprocessable",
+          "Throttled",
+          "PreconditionFailed",
+        };
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Unauthorized_HASH)
-          {
-            return ErrorCode::Unauthorized;
-          }
-          else if (hashCode == Forbidden_HASH)
-          {
-            return ErrorCode::Forbidden;
-          }
-          else if (hashCode == NotFound_HASH)
-          {
-            return ErrorCode::NotFound;
-          }
-          else if (hashCode == BadRequest_HASH)
-          {
-            return ErrorCode::BadRequest;
-          }
-          else if (hashCode == Conflict_HASH)
-          {
-            return ErrorCode::Conflict;
-          }
-          else if (hashCode == ServiceFailure_HASH)
-          {
-            return ErrorCode::ServiceFailure;
-          }
-          else if (hashCode == ServiceUnavailable_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ErrorCode::ServiceUnavailable;
-          }
-          else if (hashCode == Unprocessable_HASH)
-          {
-            return ErrorCode::Unprocessable;
-          }
-          else if (hashCode == Throttled_HASH)
-          {
-            return ErrorCode::Throttled;
-          }
-          else if (hashCode == PreconditionFailed_HASH)
-          {
-            return ErrorCode::PreconditionFailed;
+          case 785231124:
+            if (name == "Unauthorized")
+            {
+              return ErrorCode::Unauthorized;
+            }
+            break;
+          case -787432487:
+            if (name == "Forbidden")
+            {
+              return ErrorCode::Forbidden;
+            }
+            break;
+          case 1617964175:
+            if (name == "NotFound")
+            {
+              return ErrorCode::NotFound;
+            }
+            break;
+          case 1633307370:
+            if (name == "BadRequest")
+            {
+              return ErrorCode::BadRequest;
+            }
+            break;
+          case -515403790:
+            if (name == "Conflict")
+            {
+              return ErrorCode::Conflict;
+            }
+            break;
+          case 167889205:
+            if (name == "ServiceFailure")
+            {
+              return ErrorCode::ServiceFailure;
+            }
+            break;
+          case -1847483781:
+            if (name == "ServiceUnavailable")
+            {
+              return ErrorCode::ServiceUnavailable;
+            }
+            break;
+          case -1947329552:
+            if (name == "Unprocessable")
+            {
+              return ErrorCode::Unprocessable;
+            }
+            break;
+          case 746060378:
+            if (name == "Throttled")
+            {
+              return ErrorCode::Throttled;
+            }
+            break;
+          case 1513061461:
+            if (name == "PreconditionFailed")
+            {
+              return ErrorCode::PreconditionFailed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return ErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        const char* GetNameForErrorCodeCStr(ErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ErrorCode::Unauthorized:
-            return "Unauthorized";
-          case ErrorCode::Forbidden:
-            return "Forbidden";
-          case ErrorCode::NotFound:
-            return "NotFound";
-          case ErrorCode::BadRequest:
-            return "BadRequest";
-          case ErrorCode::Conflict:
-            return "Conflict";
-          case ErrorCode::ServiceFailure:
-            return "ServiceFailure";
-          case ErrorCode::ServiceUnavailable:
-            return "ServiceUnavailable";
-          case ErrorCode::Unprocessable:
-            return "Unprocessable";
-          case ErrorCode::Throttled:
-            return "Throttled";
-          case ErrorCode::PreconditionFailed:
-            return "PreconditionFailed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        {
+          return GetNameForErrorCodeCStr(enumValue);
         }
 
       } // namespace ErrorCodeMapper
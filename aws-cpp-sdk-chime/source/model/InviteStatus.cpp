@@ -30,25 +30,44 @@ namespace Aws
       namespace InviteStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Accepted_HASH = HashingUtils::HashString("Accepted");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "Accepted",
+          "Failed",
+        };
 
         InviteStatus GetInviteStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return InviteStatus::Pending;
-          }
-          else if (hashCode == Accepted_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InviteStatus::Accepted;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return InviteStatus::Failed;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return InviteStatus::Pending;
+            }
+            break;
+          case -2081881145:
+            if (name == "Accepted")
+            {
+              return InviteStatus::Accepted;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return InviteStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InviteStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInviteStatus(InviteStatus enumValue)
+        const char* GetNameForInviteStatusCStr(InviteStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InviteStatus::Pending:
-            return "Pending";
-          case InviteStatus::Accepted:
-            return "Accepted";
-          case InviteStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInviteStatus(InviteStatus enumValue)
+        {
+          return GetNameForInviteStatusCStr(enumValue);
         }
 
       } // namespace InviteStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace LicenseMapper
       {
 
-        static const int Basic_HASH = HashingUtils::HashString("Basic");
-        static const int Plus_HASH = HashingUtils::HashString("Plus");
-        static const int Pro_HASH = HashingUtils::HashString("Pro");
-        static const int ProTrial_HASH = HashingUtils::HashString("ProTrial");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Basic",
+          "Plus",
+          "Pro",
+          "ProTrial",
+        };
 
         License GetLicenseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Basic_HASH)
-          {
-            return License::Basic;
-          }
-          else if (hashCode == Plus_HASH)
-          {
-            return License::Plus;
-          }
-          else if (hashCode == Pro_HASH)
-          {
-            return License::Pro;
-          }
-          else if (hashCode == ProTrial_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return License::ProTrial;
+          case 63955982:
+            if (name == "Basic")
+            {
+              return License::Basic;
+            }
+            break;
+          case 2490810:
+            if (name == "Plus")
+            {
+              return License::Plus;
+            }
+            break;
+          case 80525:
+            if (name == "Pro")
+            {
+              return License::Pro;
+            }
+            break;
+          case -953977719:
+            if (name == "ProTrial")
+            {
+              return License::ProTrial;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return License::NOT_SET;
         }
 
-        Aws::String GetNameForLicense(License enumValue)
+        const char* GetNameForLicenseCStr(License enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case License::Basic:
-            return "Basic";
-          case License::Plus:
-            return "Plus";
-          case License::Pro:
-            return "Pro";
-          case License::ProTrial:
-            return "ProTrial";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLicense(License enumValue)
+        {
+          return GetNameForLicenseCStr(enumValue);
         }
 
       } // namespace LicenseMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace RegistrationStatusMapper
       {
 
-        static const int Unregistered_HASH = HashingUtils::HashString("Unregistered");
-        static const int Registered_HASH = HashingUtils::HashString("Registered");
-        static const int Suspended_HASH = HashingUtils::HashString("Suspended");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Unregistered",
+          "Registered",
+          "Suspended",
+        };
 
         RegistrationStatus GetRegistrationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Unregistered_HASH)
-          {
-            return RegistrationStatus::Unregistered;
-          }
-          else if (hashCode == Registered_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RegistrationStatus::Registered;
-          }
-          else if (hashCode == Suspended_HASH)
-          {
-            return RegistrationStatus::Suspended;
+          case 416011771:
+            if (name == "Unregistered")
+            {
+              return RegistrationStatus::Unregistered;
+            }
+            break;
+          case 123533986:
+            if (name == "Registered")
+            {
+              return RegistrationStatus::Registered;
+            }
+            break;
+          case 342339003:
+            if (name == "Suspended")
+            {
+              return RegistrationStatus::Suspended;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RegistrationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRegistrationStatus(RegistrationStatus enumValue)
+        const char* GetNameForRegistrationStatusCStr(RegistrationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RegistrationStatus::Unregistered:
-            return "Unregistered";
-          case RegistrationStatus::Registered:
-            return "Registered";
-          case RegistrationStatus::Suspended:
-            return "Suspended";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRegistrationStatus(RegistrationStatus enumValue)
+        {
+          return GetNameForRegistrationStatusCStr(enumValue);
         }
 
       } // namespace RegistrationStatusMapper
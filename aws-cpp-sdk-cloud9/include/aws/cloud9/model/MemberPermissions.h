@@ -35,6 +35,11 @@ namespace MemberPermissionsMapper
 AWS_CLOUD9_API MemberPermissions GetMemberPermissionsForName(const Aws::String& name);
 
 AWS_CLOUD9_API Aws::String GetNameForMemberPermissions(MemberPermissions value);
+
+/**
+ * Same as GetNameForMemberPermissions(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUD9_API const char* GetNameForMemberPermissionsCStr(MemberPermissions value);
 } // namespace MemberPermissionsMapper
 } // namespace Model
 } // namespace Cloud9
@@ -36,6 +36,11 @@ namespace PermissionsMapper
 AWS_CLOUD9_API Permissions GetPermissionsForName(const Aws::String& name);
 
 AWS_CLOUD9_API Aws::String GetNameForPermissions(Permissions value);
+
+/**
+ * Same as GetNameForPermissions(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUD9_API const char* GetNameForPermissionsCStr(Permissions value);
 } // namespace PermissionsMapper
 } // namespace Model
 } // namespace Cloud9
@@ -30,45 +30,72 @@ namespace Aws
       namespace EnvironmentStatusMapper
       {
 
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int creating_HASH = HashingUtils::HashString("creating");
-        static const int connecting_HASH = HashingUtils::HashString("connecting");
-        static const int ready_HASH = HashingUtils::HashString("ready");
-        static const int stopping_HASH = HashingUtils::HashString("stopping");
-        static const int stopped_HASH = HashingUtils::HashString("stopped");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "error",
+          "creating",
+          "connecting",
+          "ready",
+          "stopping",
+          "stopped",
+          "deleting",
+        };
 
         EnvironmentStatus GetEnvironmentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == error_HASH)
-          {
-            return EnvironmentStatus::error;
-          }
-          else if (hashCode == creating_HASH)
-          {
-            return EnvironmentStatus::creating;
-          }
-          else if (hashCode == connecting_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnvironmentStatus::connecting;
-          }
-          else if (hashCode == ready_HASH)
-          {
-            return EnvironmentStatus::ready;
-          }
-          else if (hashCode == stopping_HASH)
-          {
-            return EnvironmentStatus::stopping;
-          }
-          else if (hashCode == stopped_HASH)
-          {
-            return EnvironmentStatus::stopped;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return EnvironmentStatus::deleting;
+          case 96784904:
+            if (name == "error")
+            {
+              return EnvironmentStatus::error;
+            }
+            break;
+          case 1820421817:
+            if (name == "creating")
+            {
+              return EnvironmentStatus::creating;
+            }
+            break;
+          case -775651656:
+            if (name == "connecting")
+            {
+              return EnvironmentStatus::connecting;
+            }
+            break;
+          case 108386723:
+            if (name == "ready")
+            {
+              return EnvironmentStatus::ready;
+            }
+            break;
+          case 1715648628:
+            if (name == "stopping")
+            {
+              return EnvironmentStatus::stopping;
+            }
+            break;
+          case -1884319283:
+            if (name == "stopped")
+            {
+              return EnvironmentStatus::stopped;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return EnvironmentStatus::deleting;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return EnvironmentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentStatus(EnvironmentStatus enumValue)
+        const char* GetNameForEnvironmentStatusCStr(EnvironmentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnvironmentStatus::error:
-            return "error";
-          case EnvironmentStatus::creating:
-            return "creating";
-          case EnvironmentStatus::connecting:
-            return "connecting";
-          case EnvironmentStatus::ready:
-            return "ready";
-          case EnvironmentStatus::stopping:
-            return "stopping";
-          case EnvironmentStatus::stopped:
-            return "stopped";
-          case EnvironmentStatus::deleting:
-            return "deleting";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnvironmentStatus(EnvironmentStatus enumValue)
+        {
+          return GetNameForEnvironmentStatusCStr(enumValue);
         }
 
       } // namespace EnvironmentStatusMapper
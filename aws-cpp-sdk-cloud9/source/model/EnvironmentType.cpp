@@ -30,20 +30,37 @@ namespace Aws
       namespace EnvironmentTypeMapper
       {
 
-        static const int ssh_HASH = HashingUtils::HashString("ssh");
-        static const int ec2_HASH = HashingUtils::HashString("ec2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ssh",
+          "ec2",
+        };
 
         EnvironmentType GetEnvironmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ssh_HASH)
-          {
-            return EnvironmentType::ssh;
-          }
-          else if (hashCode == ec2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnvironmentType::ec2;
+          case 114184:
+            if (name == "ssh")
+            {
+              return EnvironmentType::ssh;
+            }
+            break;
+          case 100180:
+            if (name == "ec2")
+            {
+              return EnvironmentType::ec2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EnvironmentType::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentType(EnvironmentType enumValue)
+        const char* GetNameForEnvironmentTypeCStr(EnvironmentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnvironmentType::ssh:
-            return "ssh";
-          case EnvironmentType::ec2:
-            return "ec2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnvironmentType(EnvironmentType enumValue)
+        {
+          return GetNameForEnvironmentTypeCStr(enumValue);
         }
 
       } // namespace EnvironmentTypeMapper
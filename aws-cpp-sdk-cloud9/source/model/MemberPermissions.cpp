@@ -30,20 +30,37 @@ namespace Aws
       namespace MemberPermissionsMapper
       {
 
-        static const int read_write_HASH = HashingUtils::HashString("read-write");
-        static const int read_only_HASH = HashingUtils::HashString("read-only");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "read-write",
+          "read-only",
+        };
 
         MemberPermissions GetMemberPermissionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == read_write_HASH)
-          {
-            return MemberPermissions::read_write;
-          }
-          else if (hashCode == read_only_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MemberPermissions::read_only;
+          case -1585333016:
+            if (name == "read-write")
+            {
+              return MemberPermissions::read_write;
+            }
+            break;
+          case -1159760509:
+            if (name == "read-only")
+            {
+              return MemberPermissions::read_only;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MemberPermissions::NOT_SET;
         }
 
-        Aws::String GetNameForMemberPermissions(MemberPermissions enumValue)
+        const char* GetNameForMemberPermissionsCStr(MemberPermissions enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MemberPermissions::read_write:
-            return "read-write";
-          case MemberPermissions::read_only:
-            return "read-only";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMemberPermissions(MemberPermissions enumValue)
+        {
+          return GetNameForMemberPermissionsCStr(enumValue);
         }
 
       } // namespace MemberPermissionsMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PermissionsMapper
       {
 
-        static const int owner_HASH = HashingUtils::HashString("owner");
-        static const int read_write_HASH = HashingUtils::HashString("read-write");
-        static const int read_only_HASH = HashingUtils::HashString("read-only");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "owner",
+          "read-write",
+          "read-only",
+        };
 
         Permissions GetPermissionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == owner_HASH)
-          {
-            return Permissions::owner;
-          }
-          else if (hashCode == read_write_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Permissions::read_write;
-          }
-          else if (hashCode == read_only_HASH)
-          {
-            return Permissions::read_only;
+          case 106164915:
+            if (name == "owner")
+            {
+              return Permissions::owner;
+            }
+            break;
+          case -1585333016:
+            if (name == "read-write")
+            {
+              return Permissions::read_write;
+            }
+            break;
+          case -1159760509:
+            if (name == "read-only")
+            {
+              return Permissions::read_only;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Permissions::NOT_SET;
         }
 
-        Aws::String GetNameForPermissions(Permissions enumValue)
+        const char* GetNameForPermissionsCStr(Permissions enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Permissions::owner:
-            return "owner";
-          case Permissions::read_write:
-            return "read-write";
-          case Permissions::read_only:
-            return "read-only";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPermissions(Permissions enumValue)
+        {
+          return GetNameForPermissionsCStr(enumValue);
         }
 
       } // namespace PermissionsMapper
@@ -46,6 +46,11 @@ namespace BatchReadExceptionTypeMapper
 AWS_CLOUDDIRECTORY_API BatchReadExceptionType GetBatchReadExceptionTypeForName(const Aws::String& name);
 
 AWS_CLOUDDIRECTORY_API Aws::String GetNameForBatchReadExceptionType(BatchReadExceptionType value);
+
+/**
+ * Same as GetNameForBatchReadExceptionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDDIRECTORY_API const char* GetNameForBatchReadExceptionTypeCStr(BatchReadExceptionType value);
 } // namespace BatchReadExceptionTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
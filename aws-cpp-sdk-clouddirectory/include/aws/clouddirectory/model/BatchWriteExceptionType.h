@@ -51,6 +51,11 @@ namespace BatchWriteExceptionTypeMapper
 AWS_CLOUDDIRECTORY_API BatchWriteExceptionType GetBatchWriteExceptionTypeForName(const Aws::String& name);
 
 AWS_CLOUDDIRECTORY_API Aws::String GetNameForBatchWriteExceptionType(BatchWriteExceptionType value);
+
+/**
+ * Same as GetNameForBatchWriteExceptionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDDIRECTORY_API const char* GetNameForBatchWriteExceptionTypeCStr(BatchWriteExceptionType value);
 } // namespace BatchWriteExceptionTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
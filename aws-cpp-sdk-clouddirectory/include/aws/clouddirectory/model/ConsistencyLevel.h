@@ -35,6 +35,11 @@ namespace ConsistencyLevelMapper
 AWS_CLOUDDIRECTORY_API ConsistencyLevel GetConsistencyLevelForName(const Aws::String& name);
 
 AWS_CLOUDDIRECTORY_API Aws::String GetNameForConsistencyLevel(ConsistencyLevel value);
+
+/**
+ * Same as GetNameForConsistencyLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDDIRECTORY_API const char* GetNameForConsistencyLevelCStr(ConsistencyLevel value);
 } // namespace ConsistencyLevelMapper
 } // namespace Model
 } // namespace CloudDirectory
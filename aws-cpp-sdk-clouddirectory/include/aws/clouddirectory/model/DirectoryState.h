@@ -36,6 +36,11 @@ namespace DirectoryStateMapper
 AWS_CLOUDDIRECTORY_API DirectoryState GetDirectoryStateForName(const Aws::String& name);
 
 AWS_CLOUDDIRECTORY_API Aws::String GetNameForDirectoryState(DirectoryState value);
+
+/**
+ * Same as GetNameForDirectoryState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDDIRECTORY_API const char* GetNameForDirectoryStateCStr(DirectoryState value);
 } // namespace DirectoryStateMapper
 } // namespace Model
 } // namespace CloudDirectory
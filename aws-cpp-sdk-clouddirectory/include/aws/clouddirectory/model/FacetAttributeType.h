@@ -39,6 +39,11 @@ namespace FacetAttributeTypeMapper
 AWS_CLOUDDIRECTORY_API FacetAttributeType GetFacetAttributeTypeForName(const Aws::String& name);
 
 AWS_CLOUDDIRECTORY_API Aws::String GetNameForFacetAttributeType(FacetAttributeType value);
+
+/**
+ * Same as GetNameForFacetAttributeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDDIRECTORY_API const char* GetNameForFacetAttributeTypeCStr(FacetAttributeType value);
 } // namespace FacetAttributeTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -35,6 +35,11 @@ namespace FacetStyleMapper
 AWS_CLOUDDIRECTORY_API FacetStyle GetFacetStyleForName(const Aws::String& name);
 
 AWS_CLOUDDIRECTORY_API Aws::String GetNameForFacetStyle(FacetStyle value);
+
+/**
+ * Same as GetNameForFacetStyle(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDDIRECTORY_API const char* GetNameForFacetStyleCStr(FacetStyle value);
 } // namespace FacetStyleMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -37,6 +37,11 @@ namespace ObjectTypeMapper
 AWS_CLOUDDIRECTORY_API ObjectType GetObjectTypeForName(const Aws::String& name);
 
 AWS_CLOUDDIRECTORY_API Aws::String GetNameForObjectType(ObjectType value);
+
+/**
+ * Same as GetNameForObjectType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDDIRECTORY_API const char* GetNameForObjectTypeCStr(ObjectType value);
 } // namespace ObjectTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
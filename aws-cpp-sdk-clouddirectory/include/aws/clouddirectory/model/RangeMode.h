@@ -38,6 +38,11 @@ namespace RangeModeMapper
 AWS_CLOUDDIRECTORY_API RangeMode GetRangeModeForName(const Aws::String& name);
 
 AWS_CLOUDDIRECTORY_API Aws::String GetNameForRangeMode(RangeMode value);
+
+/**
+ * Same as GetNameForRangeMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDDIRECTORY_API const char* GetNameForRangeModeCStr(RangeMode value);
 } // namespace RangeModeMapper
 } // namespace Model
 } // namespace CloudDirectory
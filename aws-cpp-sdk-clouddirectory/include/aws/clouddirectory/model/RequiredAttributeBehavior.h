@@ -35,6 +35,11 @@ namespace RequiredAttributeBehaviorMapper
 AWS_CLOUDDIRECTORY_API RequiredAttributeBehavior GetRequiredAttributeBehaviorForName(const Aws::String& name);
 
 AWS_CLOUDDIRECTORY_API Aws::String GetNameForRequiredAttributeBehavior(RequiredAttributeBehavior value);
+
+/**
+ * Same as GetNameForRequiredAttributeBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDDIRECTORY_API const char* GetNameForRequiredAttributeBehaviorCStr(RequiredAttributeBehavior value);
 } // namespace RequiredAttributeBehaviorMapper
 } // namespace Model
 } // namespace CloudDirectory
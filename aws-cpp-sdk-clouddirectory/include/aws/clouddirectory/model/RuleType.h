@@ -37,6 +37,11 @@ namespace RuleTypeMapper
 AWS_CLOUDDIRECTORY_API RuleType GetRuleTypeForName(const Aws::String& name);
 
 AWS_CLOUDDIRECTORY_API Aws::String GetNameForRuleType(RuleType value);
+
+/**
+ * Same as GetNameForRuleType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDDIRECTORY_API const char* GetNameForRuleTypeCStr(RuleType value);
 } // namespace RuleTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -35,6 +35,11 @@ namespace UpdateActionTypeMapper
 AWS_CLOUDDIRECTORY_API UpdateActionType GetUpdateActionTypeForName(const Aws::String& name);
 
 AWS_CLOUDDIRECTORY_API Aws::String GetNameForUpdateActionType(UpdateActionType value);
+
+/**
+ * Same as GetNameForUpdateActionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDDIRECTORY_API const char* GetNameForUpdateActionTypeCStr(UpdateActionType value);
 } // namespace UpdateActionTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -30,75 +30,114 @@ namespace Aws
       namespace BatchReadExceptionTypeMapper
       {
 
-        static const int ValidationException_HASH = HashingUtils::HashString("ValidationException");
-        static const int InvalidArnException_HASH = HashingUtils::HashString("InvalidArnException");
-        static const int ResourceNotFoundException_HASH = HashingUtils::HashString("ResourceNotFoundException");
-        static const int InvalidNextTokenException_HASH = HashingUtils::HashString("InvalidNextTokenException");
-        static const int AccessDeniedException_HASH = HashingUtils::HashString("AccessDeniedException");
-        static const int NotNodeException_HASH = HashingUtils::HashString("NotNodeException");
-        static const int FacetValidationException_HASH = HashingUtils::HashString("FacetValidationException");
-        static const int CannotListParentOfRootException_HASH = HashingUtils::HashString("CannotListParentOfRootException");
-        static const int NotIndexException_HASH = HashingUtils::HashString("NotIndexException");
-        static const int NotPolicyException_HASH = HashingUtils::HashString("NotPolicyException");
-        static const int DirectoryNotEnabledException_HASH = HashingUtils::HashString("DirectoryNotEnabledException");
-        static const int LimitExceededException_HASH = HashingUtils::HashString("LimitExceededException");
-        static const int InternalServiceException_HASH = HashingUtils::HashString("InternalServiceException");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ValidationException",
+          "InvalidArnException",
+          "ResourceNotFoundException",
+          "InvalidNextTokenException",
+          "AccessDeniedException",
+          "NotNodeException",
+          "FacetValidationException",
+          "CannotListParentOfRootException",
+          "NotIndexException",
+          "NotPolicyException",
+          "DirectoryNotEnabledException",
+          "LimitExceededException",
+          "InternalServiceException",
+        };
 
         BatchReadExceptionType GetBatchReadExceptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ValidationException_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BatchReadExceptionType::ValidationException;
-          }
-          else if (hashCode == InvalidArnException_HASH)
-          {
-            return BatchReadExceptionType::InvalidArnException;
-          }
-          else if (hashCode == ResourceNotFoundException_HASH)
-          {
-            return BatchReadExceptionType::ResourceNotFoundException;
-          }
-          else if (hashCode == InvalidNextTokenException_HASH)
-          {
-            return BatchReadExceptionType::InvalidNextTokenException;
-          }
-          else if (hashCode == AccessDeniedException_HASH)
-          {
-            return BatchReadExceptionType::AccessDeniedException;
-          }
-          else if (hashCode == NotNodeException_HASH)
-          {
-            return BatchReadExceptionType::NotNodeException;
-          }
-          else if (hashCode == FacetValidationException_HASH)
-          {
-            return BatchReadExceptionType::FacetValidationException;
-          }
-          else if (hashCode == CannotListParentOfRootException_HASH)
-          {
-            return BatchReadExceptionType::CannotListParentOfRootException;
-          }
-          else if (hashCode == NotIndexException_HASH)
-          {
-            return BatchReadExceptionType::NotIndexException;
-          }
-          else if (hashCode == NotPolicyException_HASH)
-          {
-            return BatchReadExceptionType::NotPolicyException;
-          }
-          else if (hashCode == DirectoryNotEnabledException_HASH)
-          {
-            return BatchReadExceptionType::DirectoryNotEnabledException;
-          }
-          else if (hashCode == LimitExceededException_HASH)
-          {
-            return BatchReadExceptionType::LimitExceededException;
-          }
-          else if (hashCode == InternalServiceException_HASH)
-          {
-            return BatchReadExceptionType::InternalServiceException;
+          case 1601562550:
+            if (name == "ValidationException")
+            {
+              return BatchReadExceptionType::ValidationException;
+            }
+            break;
+          case -2083479063:
+            if (name == "InvalidArnException")
+            {
+              return BatchReadExceptionType::InvalidArnException;
+            }
+            break;
+          case 1821306386:
+            if (name == "ResourceNotFoundException")
+            {
+              return BatchReadExceptionType::ResourceNotFoundException;
+            }
+            break;
+          case 1041575520:
+            if (name == "InvalidNextTokenException")
+            {
+              return BatchReadExceptionType::InvalidNextTokenException;
+            }
+            break;
+          case 122859728:
+            if (name == "AccessDeniedException")
+            {
+              return BatchReadExceptionType::AccessDeniedException;
+            }
+            break;
+          case 1696078970:
+            if (name == "NotNodeException")
+            {
+              return BatchReadExceptionType::NotNodeException;
+            }
+            break;
+          case 1477653695:
+            if (name == "FacetValidationException")
+            {
+              return BatchReadExceptionType::FacetValidationException;
+            }
+            break;
+          case -991833845:
+            if (name == "CannotListParentOfRootException")
+            {
+              return BatchReadExceptionType::CannotListParentOfRootException;
+            }
+            break;
+          case 264658224:
+            if (name == "NotIndexException")
+            {
+              return BatchReadExceptionType::NotIndexException;
+            }
+            break;
+          case -1174705142:
+            if (name == "NotPolicyException")
+            {
+              return BatchReadExceptionType::NotPolicyException;
+            }
+            break;
+          case -372069516:
+            if (name == "DirectoryNotEnabledException")
+            {
+              return BatchReadExceptionType::DirectoryNotEnabledException;
+            }
+            break;
+          case -1818544159:
+            if (name == "LimitExceededException")
+            {
+              return BatchReadExceptionType::LimitExceededException;
+            }
+            break;
+          case -1158088169:
+            if (name == "InternalServiceException")
+            {
+              return BatchReadExceptionType::InternalServiceException;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,45 +149,26 @@ namespace Aws
           return BatchReadExceptionType::NOT_SET;
         }
 
-        Aws::String GetNameForBatchReadExceptionType(BatchReadExceptionType enumValue)
+        const char* GetNameForBatchReadExceptionTypeCStr(BatchReadExceptionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BatchReadExceptionType::ValidationException:
-            return "ValidationException";
-          case BatchReadExceptionType::InvalidArnException:
-            return "InvalidArnException";
-          case BatchReadExceptionType::ResourceNotFoundException:
-            return "ResourceNotFoundException";
-          case BatchReadExceptionType::InvalidNextTokenException:
-            return "InvalidNextTokenException";
-          case BatchReadExceptionType::AccessDeniedException:
-            return "AccessDeniedException";
-          case BatchReadExceptionType::NotNodeException:
-            return "NotNodeException";
-          case BatchReadExceptionType::FacetValidationException:
-            return "FacetValidationException";
-          case BatchReadExceptionType::CannotListParentOfRootException:
-            return "CannotListParentOfRootException";
-          case BatchReadExceptionType::NotIndexException:
-            return "NotIndexException";
-          case BatchReadExceptionType::NotPolicyException:
-            return "NotPolicyException";
-          case BatchReadExceptionType::DirectoryNotEnabledException:
-            return "DirectoryNotEnabledException";
-          case BatchReadExceptionType::LimitExceededException:
-            return "LimitExceededException";
-          case BatchReadExceptionType::InternalServiceException:
-            return "InternalServiceException";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBatchReadExceptionType(BatchReadExceptionType enumValue)
+        {
+          return GetNameForBatchReadExceptionTypeCStr(enumValue);
         }
 
       } // namespace BatchReadExceptionTypeMapper
@@ -30,100 +30,149 @@ namespace Aws
       namespace BatchWriteExceptionTypeMapper
       {
 
-        static const int InternalServiceException_HASH = HashingUtils::HashString("InternalServiceException");
-        static const int ValidationException_HASH = HashingUtils::HashString("ValidationException");
-        static const int InvalidArnException_HASH = HashingUtils::HashString("InvalidArnException");
-        static const int LinkNameAlreadyInUseException_HASH = HashingUtils::HashString("LinkNameAlreadyInUseException");
-        static const int StillContainsLinksException_HASH = HashingUtils::HashString("StillContainsLinksException");
-        static const int FacetValidationException_HASH = HashingUtils::HashString("FacetValidationException");
-        static const int ObjectNotDetachedException_HASH = HashingUtils::HashString("ObjectNotDetachedException");
-        static const int ResourceNotFoundException_HASH = HashingUtils::HashString("ResourceNotFoundException");
-        static const int AccessDeniedException_HASH = HashingUtils::HashString("AccessDeniedException");
-        static const int InvalidAttachmentException_HASH = HashingUtils::HashString("InvalidAttachmentException");
-        static const int NotIndexException_HASH = HashingUtils::HashString("NotIndexException");
-        static const int NotNodeException_HASH = HashingUtils::HashString("NotNodeException");
-        static const int IndexedAttributeMissingException_HASH = HashingUtils::HashString("IndexedAttributeMissingException");
-        static const int ObjectAlreadyDetachedException_HASH = HashingUtils::HashString("ObjectAlreadyDetachedException");
-        static const int NotPolicyException_HASH = HashingUtils::HashString("NotPolicyException");
-        static const int DirectoryNotEnabledException_HASH = HashingUtils::HashString("DirectoryNotEnabledException");
-        static const int LimitExceededException_HASH = HashingUtils::HashString("LimitExceededException");
-        static const int UnsupportedIndexTypeException_HASH = HashingUtils::HashString("UnsupportedIndexTypeException");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InternalServiceException",
+          "ValidationException",
+          "InvalidArnException",
+          "LinkNameAlreadyInUseException",
+          "StillContainsLinksException",
+          "FacetValidationException",
+          "ObjectNotDetachedException",
+          "ResourceNotFoundException",
+          "AccessDeniedException",
+          "InvalidAttachmentException",
+          "NotIndexException",
+          "NotNodeException",
+          "IndexedAttributeMissingException",
+          "ObjectAlreadyDetachedException",
+          "NotPolicyException",
+          "DirectoryNotEnabledException",
+          "LimitExceededException",
+          "UnsupportedIndexTypeException",
+        };
 
         BatchWriteExceptionType GetBatchWriteExceptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InternalServiceException_HASH)
-          {
-            return BatchWriteExceptionType::InternalServiceException;
-          }
-          else if (hashCode == ValidationException_HASH)
-          {
-            return BatchWriteExceptionType::ValidationException;
-          }
-          else if (hashCode == InvalidArnException_HASH)
-          {
-            return BatchWriteExceptionType::InvalidArnException;
-          }
-          else if (hashCode == LinkNameAlreadyInUseException_HASH)
-          {
-            return BatchWriteExceptionType::LinkNameAlreadyInUseException;
-          }
-          else if (hashCode == StillContainsLinksException_HASH)
-          {
-            return BatchWriteExceptionType::StillContainsLinksException;
-          }
-          else if (hashCode == FacetValidationException_HASH)
-          {
-            return BatchWriteExceptionType::FacetValidationException;
-          }
-          else if (hashCode == ObjectNotDetachedException_HASH)
-          {
-            return BatchWriteExceptionType::ObjectNotDetachedException;
-          }
-          else if (hashCode == ResourceNotFoundException_HASH)
-          {
-            return BatchWriteExceptionType::ResourceNotFoundException;
-          }
-          else if (hashCode == AccessDeniedException_HASH)
-          {
-            return BatchWriteExceptionType::AccessDeniedException;
-          }
-          else if (hashCode == InvalidAttachmentException_HASH)
-          {
-            return BatchWriteExceptionType::InvalidAttachmentException;
-          }
-          else if (hashCode == NotIndexException_HASH)
-          {
-            return BatchWriteExceptionType::NotIndexException;
-          }
-          else if (hashCode == NotNodeException_HASH)
-          {
-            return BatchWriteExceptionType::NotNodeException;
-          }
-          else if (hashCode == IndexedAttributeMissingException_HASH)
-          {
-            return BatchWriteExceptionType::IndexedAttributeMissingException;
-          }
-          else if (hashCode == ObjectAlreadyDetachedException_HASH)
-          {
-            return BatchWriteExceptionType::ObjectAlreadyDetachedException;
-          }
-          else if (hashCode == NotPolicyException_HASH)
-          {
-            return BatchWriteExceptionType::NotPolicyException;
-          }
-          else if (hashCode == DirectoryNotEnabledException_HASH)
-          {
-            return BatchWriteExceptionType::DirectoryNotEnabledException;
-          }
-          else if (hashCode == LimitExceededException_HASH)
-          {
-            return BatchWriteExceptionType::LimitExceededException;
-          }
-          else if (hashCode == UnsupportedIndexTypeException_HASH)
-          {
-            return BatchWriteExceptionType::UnsupportedIndexTypeException;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1158088169:
+            if (name == "InternalServiceException")
+            {
+              return BatchWriteExceptionType::InternalServiceException;
+            }
+            break;
+          case 1601562550:
+            if (name == "ValidationException")
+            {
+              return BatchWriteExceptionType::ValidationException;
+            }
+            break;
+          case -2083479063:
+            if (name == "InvalidArnException")
+            {
+              return BatchWriteExceptionType::InvalidArnException;
+            }
+            break;
+          case -1746608640:
+            if (name == "LinkNameAlreadyInUseException")
+            {
+              return BatchWriteExceptionType::LinkNameAlreadyInUseException;
+            }
+            break;
+          case 2024351805:
+            if (name == "StillContainsLinksException")
+            {
+              return BatchWriteExceptionType::StillContainsLinksException;
+            }
+            break;
+          case 1477653695:
+            if (name == "FacetValidationException")
+            {
+              return BatchWriteExceptionType::FacetValidationException;
+            }
+            break;
+          case 1740224617:
+            if (name == "ObjectNotDetachedException")
+            {
+              return BatchWriteExceptionType::ObjectNotDetachedException;
+            }
+            break;
+          case 1821306386:
+            if (name == "ResourceNotFoundException")
+            {
+              return BatchWriteExceptionType::ResourceNotFoundException;
+            }
+            break;
+          case 122859728:
+            if (name == "AccessDeniedException")
+            {
+              return BatchWriteExceptionType::AccessDeniedException;
+            }
+            break;
+          case -480717035:
+            if (name == "InvalidAttachmentException")
+            {
+              return BatchWriteExceptionType::InvalidAttachmentException;
+            }
+            break;
+          case 264658224:
+            if (name == "NotIndexException")
+            {
+              return BatchWriteExceptionType::NotIndexException;
+            }
+            break;
+          case 1696078970:
+            if (name == "NotNodeException")
+            {
+              return BatchWriteExceptionType::NotNodeException;
+            }
+            break;
+          case 638923892:
+            if (name == "IndexedAttributeMissingException")
+            {
+              return BatchWriteExceptionType::IndexedAttributeMissingException;
+            }
+            break;
+          case 856012292:
+            if (name == "ObjectAlreadyDetachedException")
+            {
+              return BatchWriteExceptionType::ObjectAlreadyDetachedException;
+            }
+            break;
+          case -1174705142:
+            if (name == "NotPolicyException")
+            {
+              return BatchWriteExceptionType::NotPolicyException;
+            }
+            break;
+          case -372069516:
+            if (name == "DirectoryNotEnabledException")
+            {
+              return BatchWriteExceptionType::DirectoryNotEnabledException;
+            }
+            break;
+          case -1818544159:
+            if (name == "LimitExceededException")
+            {
+              return BatchWriteExceptionType::LimitExceededException;
+            }
+            break;
+          case -1031579272:
+            if (name == "UnsupportedIndexTypeException")
+            {
+              return BatchWriteExceptionType::UnsupportedIndexTypeException;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -135,55 +184,26 @@ namespace Aws
           return BatchWriteExceptionType::NOT_SET;
         }
 
-        Aws::String GetNameForBatchWriteExceptionType(BatchWriteExceptionType enumValue)
+        const char* GetNameForBatchWriteExceptionTypeCStr(BatchWriteExceptionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BatchWriteExceptionType::InternalServiceException:
-            return "InternalServiceException";
-          case BatchWriteExceptionType::ValidationException:
-            return "ValidationException";
-          case BatchWriteExceptionType::InvalidArnException:
-            return "InvalidArnException";
-          case BatchWriteExceptionType::LinkNameAlreadyInUseException:
-            return "LinkNameAlreadyInUseException";
-          case BatchWriteExceptionType::StillContainsLinksException:
-            return "StillContainsLinksException";
-          case BatchWriteExceptionType::FacetValidationException:
-            return "FacetValidationException";
-          case BatchWriteExceptionType::ObjectNotDetachedException:
-            return "ObjectNotDetachedException";
-          case BatchWriteExceptionType::ResourceNotFoundException:
-            return "ResourceNotFoundException";
-          case BatchWriteExceptionType::AccessDeniedException:
-            return "AccessDeniedException";
-          case BatchWriteExceptionType::InvalidAttachmentException:
-            return "InvalidAttachmentException";
-          case BatchWriteExceptionType::NotIndexException:
-            return "NotIndexException";
-          case BatchWriteExceptionType::NotNodeException:
-            return "NotNodeException";
-          case BatchWriteExceptionType::IndexedAttributeMissingException:
-            return "IndexedAttributeMissingException";
-          case BatchWriteExceptionType::ObjectAlreadyDetachedException:
-            return "ObjectAlreadyDetachedException";
-          case BatchWriteExceptionType::NotPolicyException:
-            return "NotPolicyException";
-          case BatchWriteExceptionType::DirectoryNotEnabledException:
-            return "DirectoryNotEnabledException";
-          case BatchWriteExceptionType::LimitExceededException:
-            return "LimitExceededException";
-          case BatchWriteExceptionType::UnsupportedIndexTypeException:
-            return "UnsupportedIndexTypeException";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBatchWriteExceptionType(BatchWriteExceptionType enumValue)
+        {
+          return GetNameForBatchWriteExceptionTypeCStr(enumValue);
         }
 
       } // namespace BatchWriteExceptionTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ConsistencyLevelMapper
       {
 
-        static const int SERIALIZABLE_HASH = HashingUtils::HashString("SERIALIZABLE");
-        static const int EVENTUAL_HASH = HashingUtils::HashString("EVENTUAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SERIALIZABLE",
+          "EVENTUAL",
+        };
 
         ConsistencyLevel GetConsistencyLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SERIALIZABLE_HASH)
-          {
-            return ConsistencyLevel::SERIALIZABLE;
-          }
-          else if (hashCode == EVENTUAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConsistencyLevel::EVENTUAL;
+          case -1116651265:
+            if (name == "SERIALIZABLE")
+            {
+              return ConsistencyLevel::SERIALIZABLE;
+            }
+            break;
+          case 1060766342:
+            if (name == "EVENTUAL")
+            {
+              return ConsistencyLevel::EVENTUAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ConsistencyLevel::NOT_SET;
         }
 
-        Aws::String GetNameForConsistencyLevel(ConsistencyLevel enumValue)
+        const char* GetNameForConsistencyLevelCStr(ConsistencyLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConsistencyLevel::SERIALIZABLE:
-            return "SERIALIZABLE";
-          case ConsistencyLevel::EVENTUAL:
-            return "EVENTUAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConsistencyLevel(ConsistencyLevel enumValue)
+        {
+          return GetNameForConsistencyLevelCStr(enumValue);
         }
 
       } // namespace ConsistencyLevelMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DirectoryStateMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLED",
+          "DISABLED",
+          "DELETED",
+        };
 
         DirectoryState GetDirectoryStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
-          {
-            return DirectoryState::ENABLED;
-          }
-          else if (hashCode == DISABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DirectoryState::DISABLED;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return DirectoryState::DELETED;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return DirectoryState::ENABLED;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return DirectoryState::DISABLED;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return DirectoryState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DirectoryState::NOT_SET;
         }
 
-        Aws::String GetNameForDirectoryState(DirectoryState enumValue)
+        const char* GetNameForDirectoryStateCStr(DirectoryState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DirectoryState::ENABLED:
-            return "ENABLED";
-          case DirectoryState::DISABLED:
-            return "DISABLED";
-          case DirectoryState::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDirectoryState(DirectoryState enumValue)
+        {
+          return GetNameForDirectoryStateCStr(enumValue);
         }
 
       } // namespace DirectoryStateMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace FacetAttributeTypeMapper
       {
 
-        static const int STRING_HASH = HashingUtils::HashString("STRING");
-        static const int BINARY_HASH = HashingUtils::HashString("BINARY");
-        static const int BOOLEAN_HASH = HashingUtils::HashString("BOOLEAN");
-        static const int NUMBER_HASH = HashingUtils::HashString("NUMBER");
-        static const int DATETIME_HASH = HashingUtils::HashString("DATETIME");
-        static const int VARIANT_HASH = HashingUtils::HashString("VARIANT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STRING",
+          "BINARY",
+          "BOOLEAN",
+          "NUMBER",
+          "DATETIME",
+          "VARIANT",
+        };
 
         FacetAttributeType GetFacetAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STRING_HASH)
-          {
-            return FacetAttributeType::STRING;
-          }
-          else if (hashCode == BINARY_HASH)
-          {
-            return FacetAttributeType::BINARY;
-          }
-          else if (hashCode == BOOLEAN_HASH)
-          {
-            return FacetAttributeType::BOOLEAN;
-          }
-          else if (hashCode == NUMBER_HASH)
-          {
-            return FacetAttributeType::NUMBER;
-          }
-          else if (hashCode == DATETIME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FacetAttributeType::DATETIME;
-          }
-          else if (hashCode == VARIANT_HASH)
-          {
-            return FacetAttributeType::VARIANT;
+          case -1838656495:
+            if (name == "STRING")
+            {
+              return FacetAttributeType::STRING;
+            }
+            break;
+          case 1959329793:
+            if (name == "BINARY")
+            {
+              return FacetAttributeType::BINARY;
+            }
+            break;
+          case 782694408:
+            if (name == "BOOLEAN")
+            {
+              return FacetAttributeType::BOOLEAN;
+            }
+            break;
+          case -1981034679:
+            if (name == "NUMBER")
+            {
+              return FacetAttributeType::NUMBER;
+            }
+            break;
+          case -1718637701:
+            if (name == "DATETIME")
+            {
+              return FacetAttributeType::DATETIME;
+            }
+            break;
+          case 954768485:
+            if (name == "VARIANT")
+            {
+              return FacetAttributeType::VARIANT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return FacetAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForFacetAttributeType(FacetAttributeType enumValue)
+        const char* GetNameForFacetAttributeTypeCStr(FacetAttributeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FacetAttributeType::STRING:
-            return "STRING";
-          case FacetAttributeType::BINARY:
-            return "BINARY";
-          case FacetAttributeType::BOOLEAN:
-            return "BOOLEAN";
-          case FacetAttributeType::NUMBER:
-            return "NUMBER";
-          case FacetAttributeType::DATETIME:
-            return "DATETIME";
-          case FacetAttributeType::VARIANT:
-            return "VARIANT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFacetAttributeType(FacetAttributeType enumValue)
+        {
+          return GetNameForFacetAttributeTypeCStr(enumValue);
         }
 
       } // namespace FacetAttributeTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FacetStyleMapper
       {
 
-        static const int STATIC__HASH = HashingUtils::HashString("STATIC");
-        static const int DYNAMIC_HASH = HashingUtils::HashString("DYNAMIC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STATIC",
+          "DYNAMIC",
+        };
 
         FacetStyle GetFacetStyleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STATIC__HASH)
-          {
-            return FacetStyle::STATIC_;
-          }
-          else if (hashCode == DYNAMIC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FacetStyle::DYNAMIC;
+          case -1839152530:
+            if (name == "STATIC")
+            {
+              return FacetStyle::STATIC_;
+            }
+            break;
+          case -1452217313:
+            if (name == "DYNAMIC")
+            {
+              return FacetStyle::DYNAMIC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FacetStyle::NOT_SET;
         }
 
-        Aws::String GetNameForFacetStyle(FacetStyle enumValue)
+        const char* GetNameForFacetStyleCStr(FacetStyle enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FacetStyle::STATIC_:
-            return "STATIC";
-          case FacetStyle::DYNAMIC:
-            return "DYNAMIC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFacetStyle(FacetStyle enumValue)
+        {
+          return GetNameForFacetStyleCStr(enumValue);
         }
 
       } // namespace FacetStyleMapper
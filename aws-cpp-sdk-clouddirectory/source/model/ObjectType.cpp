@@ -30,30 +30,51 @@ namespace Aws
       namespace ObjectTypeMapper
       {
 
-        static const int NODE_HASH = HashingUtils::HashString("NODE");
-        static const int LEAF_NODE_HASH = HashingUtils::HashString("LEAF_NODE");
-        static const int POLICY_HASH = HashingUtils::HashString("POLICY");
-        static const int INDEX_HASH = HashingUtils::HashString("INDEX");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NODE",
+          "LEAF_NODE",
+          "POLICY",
+          "INDEX",
+        };
 
         ObjectType GetObjectTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NODE_HASH)
-          {
-            return ObjectType::NODE;
-          }
-          else if (hashCode == LEAF_NODE_HASH)
-          {
-            return ObjectType::LEAF_NODE;
-          }
-          else if (hashCode == POLICY_HASH)
-          {
-            return ObjectType::POLICY;
-          }
-          else if (hashCode == INDEX_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ObjectType::INDEX;
+          case 2401794:
+            if (name == "NODE")
+            {
+              return ObjectType::NODE;
+            }
+            break;
+          case -280382909:
+            if (name == "LEAF_NODE")
+            {
+              return ObjectType::LEAF_NODE;
+            }
+            break;
+          case -1929340622:
+            if (name == "POLICY")
+            {
+              return ObjectType::POLICY;
+            }
+            break;
+          case 69808306:
+            if (name == "INDEX")
+            {
+              return ObjectType::INDEX;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ObjectType::NOT_SET;
         }
 
-        Aws::String GetNameForObjectType(ObjectType enumValue)
+        const char* GetNameForObjectTypeCStr(ObjectType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ObjectType::NODE:
-            return "NODE";
-          case ObjectType::LEAF_NODE:
-            return "LEAF_NODE";
-          case ObjectType::POLICY:
-            return "POLICY";
-          case ObjectType::INDEX:
-            return "INDEX";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForObjectType(ObjectType enumValue)
+        {
+          return GetNameForObjectTypeCStr(enumValue);
         }
 
       } // namespace ObjectTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace RangeModeMapper
       {
 
-        static const int FIRST_HASH = HashingUtils::HashString("FIRST");
-        static const int LAST_HASH = HashingUtils::HashString("LAST");
-        static const int LAST_BEFORE_MISSING_VALUES_HASH = HashingUtils::HashString("LAST_BEFORE_MISSING_VALUES");
-        static const int INCLUSIVE_HASH = HashingUtils::HashString("INCLUSIVE");
-        static const int EXCLUSIVE_HASH = HashingUtils::HashString("EXCLUSIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FIRST",
+          "LAST",
+          "LAST_BEFORE_MISSING_VALUES",
+          "INCLUSIVE",
+          "EXCLUSIVE",
+        };
 
         RangeMode GetRangeModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FIRST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RangeMode::FIRST;
-          }
-          else if (hashCode == LAST_HASH)
-          {
-            return RangeMode::LAST;
-          }
-          else if (hashCode == LAST_BEFORE_MISSING_VALUES_HASH)
-          {
-            return RangeMode::LAST_BEFORE_MISSING_VALUES;
-          }
-          else if (hashCode == INCLUSIVE_HASH)
-          {
-            return RangeMode::INCLUSIVE;
-          }
-          else if (hashCode == EXCLUSIVE_HASH)
-          {
-            return RangeMode::EXCLUSIVE;
+          case 66902672:
+            if (name == "FIRST")
+            {
+              return RangeMode::FIRST;
+            }
+            break;
+          case 2329238:
+            if (name == "LAST")
+            {
+              return RangeMode::LAST;
+            }
+            break;
+          case 955787794:
+            if (name == "LAST_BEFORE_MISSING_VALUES")
+            {
+              return RangeMode::LAST_BEFORE_MISSING_VALUES;
+            }
+            break;
+          case 1290127820:
+            if (name == "INCLUSIVE")
+            {
+              return RangeMode::INCLUSIVE;
+            }
+            break;
+          case 178245246:
+            if (name == "EXCLUSIVE")
+            {
+              return RangeMode::EXCLUSIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return RangeMode::NOT_SET;
         }
 
-        Aws::String GetNameForRangeMode(RangeMode enumValue)
+        const char* GetNameForRangeModeCStr(RangeMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RangeMode::FIRST:
-            return "FIRST";
-          case RangeMode::LAST:
-            return "LAST";
-          case RangeMode::LAST_BEFORE_MISSING_VALUES:
-            return "LAST_BEFORE_MISSING_VALUES";
-          case RangeMode::INCLUSIVE:
-            return "INCLUSIVE";
-          case RangeMode::EXCLUSIVE:
-            return "EXCLUSIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRangeMode(RangeMode enumValue)
+        {
+          return GetNameForRangeModeCStr(enumValue);
         }
 
       } // namespace RangeModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace RequiredAttributeBehaviorMapper
       {
 
-        static const int REQUIRED_ALWAYS_HASH = HashingUtils::HashString("REQUIRED_ALWAYS");
-        static const int NOT_REQUIRED_HASH = HashingUtils::HashString("NOT_REQUIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REQUIRED_ALWAYS",
+          "NOT_REQUIRED",
+        };
 
         RequiredAttributeBehavior GetRequiredAttributeBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REQUIRED_ALWAYS_HASH)
-          {
-            return RequiredAttributeBehavior::REQUIRED_ALWAYS;
-          }
-          else if (hashCode == NOT_REQUIRED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RequiredAttributeBehavior::NOT_REQUIRED;
+          case 103933615:
+            if (name == "REQUIRED_ALWAYS")
+            {
+              return RequiredAttributeBehavior::REQUIRED_ALWAYS;
+            }
+            break;
+          case -1888946261:
+            if (name == "NOT_REQUIRED")
+            {
+              return RequiredAttributeBehavior::NOT_REQUIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RequiredAttributeBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForRequiredAttributeBehavior(RequiredAttributeBehavior enumValue)
+        const char* GetNameForRequiredAttributeBehaviorCStr(RequiredAttributeBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RequiredAttributeBehavior::REQUIRED_ALWAYS:
-            return "REQUIRED_ALWAYS";
-          case RequiredAttributeBehavior::NOT_REQUIRED:
-            return "NOT_REQUIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRequiredAttributeBehavior(RequiredAttributeBehavior enumValue)
+        {
+          return GetNameForRequiredAttributeBehaviorCStr(enumValue);
         }
 
       } // namespace RequiredAttributeBehaviorMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace RuleTypeMapper
       {
 
-        static const int BINARY_LENGTH_HASH = HashingUtils::HashString("BINARY_LENGTH");
-        static const int NUMBER_COMPARISON_HASH = HashingUtils::HashString("NUMBER_COMPARISON");
-        static const int STRING_FROM_SET_HASH = HashingUtils::HashString("STRING_FROM_SET");
-        static const int STRING_LENGTH_HASH = HashingUtils::HashString("STRING_LENGTH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BINARY_LENGTH",
+          "NUMBER_COMPARISON",
+          "STRING_FROM_SET",
+          "STRING_LENGTH",
+        };
 
         RuleType GetRuleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BINARY_LENGTH_HASH)
-          {
-            return RuleType::BINARY_LENGTH;
-          }
-          else if (hashCode == NUMBER_COMPARISON_HASH)
-          {
-            return RuleType::NUMBER_COMPARISON;
-          }
-          else if (hashCode == STRING_FROM_SET_HASH)
-          {
-            return RuleType::STRING_FROM_SET;
-          }
-          else if (hashCode == STRING_LENGTH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RuleType::STRING_LENGTH;
+          case -704030492:
+            if (name == "BINARY_LENGTH")
+            {
+              return RuleType::BINARY_LENGTH;
+            }
+            break;
+          case -1492638017:
+            if (name == "NUMBER_COMPARISON")
+            {
+              return RuleType::NUMBER_COMPARISON;
+            }
+            break;
+          case -561677669:
+            if (name == "STRING_FROM_SET")
+            {
+              return RuleType::STRING_FROM_SET;
+            }
+            break;
+          case 1482052308:
+            if (name == "STRING_LENGTH")
+            {
+              return RuleType::STRING_LENGTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return RuleType::NOT_SET;
         }
 
-        Aws::String GetNameForRuleType(RuleType enumValue)
+        const char* GetNameForRuleTypeCStr(RuleType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RuleType::BINARY_LENGTH:
-            return "BINARY_LENGTH";
-          case RuleType::NUMBER_COMPARISON:
-            return "NUMBER_COMPARISON";
-          case RuleType::STRING_FROM_SET:
-            return "STRING_FROM_SET";
-          case RuleType::STRING_LENGTH:
-            return "STRING_LENGTH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRuleType(RuleType enumValue)
+        {
+          return GetNameForRuleTypeCStr(enumValue);
         }
 
       } // namespace RuleTypeMapper
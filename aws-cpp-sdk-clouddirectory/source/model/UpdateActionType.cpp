@@ -30,20 +30,37 @@ namespace Aws
       namespace UpdateActionTypeMapper
       {
 
-        static const int CREATE_OR_UPDATE_HASH = HashingUtils::HashString("CREATE_OR_UPDATE");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE_OR_UPDATE",
+          "DELETE",
+        };
 
         UpdateActionType GetUpdateActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_OR_UPDATE_HASH)
-          {
-            return UpdateActionType::CREATE_OR_UPDATE;
-          }
-          else if (hashCode == DELETE__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UpdateActionType::DELETE_;
+          case -822980830:
+            if (name == "CREATE_OR_UPDATE")
+            {
+              return UpdateActionType::CREATE_OR_UPDATE;
+            }
+            break;
+          case 2012838315:
+            if (name == "DELETE")
+            {
+              return UpdateActionType::DELETE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return UpdateActionType::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateActionType(UpdateActionType enumValue)
+        const char* GetNameForUpdateActionTypeCStr(UpdateActionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UpdateActionType::CREATE_OR_UPDATE:
-            return "CREATE_OR_UPDATE";
-          case UpdateActionType::DELETE_:
-            return "DELETE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUpdateActionType(UpdateActionType enumValue)
+        {
+          return GetNameForUpdateActionTypeCStr(enumValue);
         }
 
       } // namespace UpdateActionTypeMapper
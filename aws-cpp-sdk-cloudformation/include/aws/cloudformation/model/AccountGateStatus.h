@@ -36,6 +36,11 @@ namespace AccountGateStatusMapper
 AWS_CLOUDFORMATION_API AccountGateStatus GetAccountGateStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForAccountGateStatus(AccountGateStatus value);
+
+/**
+ * Same as GetNameForAccountGateStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForAccountGateStatusCStr(AccountGateStatus value);
 } // namespace AccountGateStatusMapper
 } // namespace Model
 } // namespace CloudFormation
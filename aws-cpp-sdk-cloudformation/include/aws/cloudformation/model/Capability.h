@@ -36,6 +36,11 @@ namespace CapabilityMapper
 AWS_CLOUDFORMATION_API Capability GetCapabilityForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForCapability(Capability value);
+
+/**
+ * Same as GetNameForCapability(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForCapabilityCStr(Capability value);
 } // namespace CapabilityMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -38,6 +38,11 @@ namespace ChangeSetStatusMapper
 AWS_CLOUDFORMATION_API ChangeSetStatus GetChangeSetStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForChangeSetStatus(ChangeSetStatus value);
+
+/**
+ * Same as GetNameForChangeSetStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForChangeSetStatusCStr(ChangeSetStatus value);
 } // namespace ChangeSetStatusMapper
 } // namespace Model
 } // namespace CloudFormation
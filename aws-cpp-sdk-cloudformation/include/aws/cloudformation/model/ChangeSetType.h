@@ -35,6 +35,11 @@ namespace ChangeSetTypeMapper
 AWS_CLOUDFORMATION_API ChangeSetType GetChangeSetTypeForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForChangeSetType(ChangeSetType value);
+
+/**
+ * Same as GetNameForChangeSetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForChangeSetTypeCStr(ChangeSetType value);
 } // namespace ChangeSetTypeMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -38,6 +38,11 @@ namespace ChangeSourceMapper
 AWS_CLOUDFORMATION_API ChangeSource GetChangeSourceForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForChangeSource(ChangeSource value);
+
+/**
+ * Same as GetNameForChangeSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForChangeSourceCStr(ChangeSource value);
 } // namespace ChangeSourceMapper
 } // namespace Model
 } // namespace CloudFormation
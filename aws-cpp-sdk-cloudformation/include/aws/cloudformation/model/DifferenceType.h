@@ -36,6 +36,11 @@ namespace DifferenceTypeMapper
 AWS_CLOUDFORMATION_API DifferenceType GetDifferenceTypeForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForDifferenceType(DifferenceType value);
+
+/**
+ * Same as GetNameForDifferenceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForDifferenceTypeCStr(DifferenceType value);
 } // namespace DifferenceTypeMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -35,6 +35,11 @@ namespace EvaluationTypeMapper
 AWS_CLOUDFORMATION_API EvaluationType GetEvaluationTypeForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForEvaluationType(EvaluationType value);
+
+/**
+ * Same as GetNameForEvaluationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForEvaluationTypeCStr(EvaluationType value);
 } // namespace EvaluationTypeMapper
 } // namespace Model
 } // namespace CloudFormation
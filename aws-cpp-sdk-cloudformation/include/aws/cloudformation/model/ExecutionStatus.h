@@ -39,6 +39,11 @@ namespace ExecutionStatusMapper
 AWS_CLOUDFORMATION_API ExecutionStatus GetExecutionStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForExecutionStatus(ExecutionStatus value);
+
+/**
+ * Same as GetNameForExecutionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForExecutionStatusCStr(ExecutionStatus value);
 } // namespace ExecutionStatusMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -36,6 +36,11 @@ namespace OnFailureMapper
 AWS_CLOUDFORMATION_API OnFailure GetOnFailureForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForOnFailure(OnFailure value);
+
+/**
+ * Same as GetNameForOnFailure(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForOnFailureCStr(OnFailure value);
 } // namespace OnFailureMapper
 } // namespace Model
 } // namespace CloudFormation
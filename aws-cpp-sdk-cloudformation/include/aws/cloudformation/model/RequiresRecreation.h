@@ -36,6 +36,11 @@ namespace RequiresRecreationMapper
 AWS_CLOUDFORMATION_API RequiresRecreation GetRequiresRecreationForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForRequiresRecreation(RequiresRecreation value);
+
+/**
+ * Same as GetNameForRequiresRecreation(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForRequiresRecreationCStr(RequiresRecreation value);
 } // namespace RequiresRecreationMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -35,6 +35,11 @@ namespace ResourceSignalStatusMapper
 AWS_CLOUDFORMATION_API ResourceSignalStatus GetResourceSignalStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForResourceSignalStatus(ResourceSignalStatus value);
+
+/**
+ * Same as GetNameForResourceSignalStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForResourceSignalStatusCStr(ResourceSignalStatus value);
 } // namespace ResourceSignalStatusMapper
 } // namespace Model
 } // namespace CloudFormation
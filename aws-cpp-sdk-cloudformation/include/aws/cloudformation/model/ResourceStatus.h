@@ -43,6 +43,11 @@ namespace ResourceStatusMapper
 AWS_CLOUDFORMATION_API ResourceStatus GetResourceStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForResourceStatus(ResourceStatus value);
+
+/**
+ * Same as GetNameForResourceStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForResourceStatusCStr(ResourceStatus value);
 } // namespace ResourceStatusMapper
 } // namespace Model
 } // namespace CloudFormation
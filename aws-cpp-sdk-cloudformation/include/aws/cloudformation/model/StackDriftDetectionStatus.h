@@ -36,6 +36,11 @@ namespace StackDriftDetectionStatusMapper
 AWS_CLOUDFORMATION_API StackDriftDetectionStatus GetStackDriftDetectionStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForStackDriftDetectionStatus(StackDriftDetectionStatus value);
+
+/**
+ * Same as GetNameForStackDriftDetectionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForStackDriftDetectionStatusCStr(StackDriftDetectionStatus value);
 } // namespace StackDriftDetectionStatusMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -37,6 +37,11 @@ namespace StackDriftStatusMapper
 AWS_CLOUDFORMATION_API StackDriftStatus GetStackDriftStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForStackDriftStatus(StackDriftStatus value);
+
+/**
+ * Same as GetNameForStackDriftStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForStackDriftStatusCStr(StackDriftStatus value);
 } // namespace StackDriftStatusMapper
 } // namespace Model
 } // namespace CloudFormation
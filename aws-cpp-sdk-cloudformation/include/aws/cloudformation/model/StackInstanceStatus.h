@@ -36,6 +36,11 @@ namespace StackInstanceStatusMapper
 AWS_CLOUDFORMATION_API StackInstanceStatus GetStackInstanceStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForStackInstanceStatus(StackInstanceStatus value);
+
+/**
+ * Same as GetNameForStackInstanceStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForStackInstanceStatusCStr(StackInstanceStatus value);
 } // namespace StackInstanceStatusMapper
 } // namespace Model
 } // namespace CloudFormation
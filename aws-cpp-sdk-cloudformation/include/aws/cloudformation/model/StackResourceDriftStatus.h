@@ -37,6 +37,11 @@ namespace StackResourceDriftStatusMapper
 AWS_CLOUDFORMATION_API StackResourceDriftStatus GetStackResourceDriftStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForStackResourceDriftStatus(StackResourceDriftStatus value);
+
+/**
+ * Same as GetNameForStackResourceDriftStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForStackResourceDriftStatusCStr(StackResourceDriftStatus value);
 } // namespace StackResourceDriftStatusMapper
 } // namespace Model
 } // namespace CloudFormation
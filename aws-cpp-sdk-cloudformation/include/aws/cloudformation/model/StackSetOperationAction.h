@@ -36,6 +36,11 @@ namespace StackSetOperationActionMapper
 AWS_CLOUDFORMATION_API StackSetOperationAction GetStackSetOperationActionForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForStackSetOperationAction(StackSetOperationAction value);
+
+/**
+ * Same as GetNameForStackSetOperationAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForStackSetOperationActionCStr(StackSetOperationAction value);
 } // namespace StackSetOperationActionMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -38,6 +38,11 @@ namespace StackSetOperationResultStatusMapper
 AWS_CLOUDFORMATION_API StackSetOperationResultStatus GetStackSetOperationResultStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForStackSetOperationResultStatus(StackSetOperationResultStatus value);
+
+/**
+ * Same as GetNameForStackSetOperationResultStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForStackSetOperationResultStatusCStr(StackSetOperationResultStatus value);
 } // namespace StackSetOperationResultStatusMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -38,6 +38,11 @@ namespace StackSetOperationStatusMapper
 AWS_CLOUDFORMATION_API StackSetOperationStatus GetStackSetOperationStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForStackSetOperationStatus(StackSetOperationStatus value);
+
+/**
+ * Same as GetNameForStackSetOperationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForStackSetOperationStatusCStr(StackSetOperationStatus value);
 } // namespace StackSetOperationStatusMapper
 } // namespace Model
 } // namespace CloudFormation
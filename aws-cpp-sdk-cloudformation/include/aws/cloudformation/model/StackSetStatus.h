@@ -35,6 +35,11 @@ namespace StackSetStatusMapper
 AWS_CLOUDFORMATION_API StackSetStatus GetStackSetStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForStackSetStatus(StackSetStatus value);
+
+/**
+ * Same as GetNameForStackSetStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForStackSetStatusCStr(StackSetStatus value);
 } // namespace StackSetStatusMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -50,6 +50,11 @@ namespace StackStatusMapper
 AWS_CLOUDFORMATION_API StackStatus GetStackStatusForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForStackStatus(StackStatus value);
+
+/**
+ * Same as GetNameForStackStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForStackStatusCStr(StackStatus value);
 } // namespace StackStatusMapper
 } // namespace Model
 } // namespace CloudFormation
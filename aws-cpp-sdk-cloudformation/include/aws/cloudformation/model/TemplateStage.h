@@ -35,6 +35,11 @@ namespace TemplateStageMapper
 AWS_CLOUDFORMATION_API TemplateStage GetTemplateStageForName(const Aws::String& name);
 
 AWS_CLOUDFORMATION_API Aws::String GetNameForTemplateStage(TemplateStage value);
+
+/**
+ * Same as GetNameForTemplateStage(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFORMATION_API const char* GetNameForTemplateStageCStr(TemplateStage value);
 } // namespace TemplateStageMapper
 } // namespace Model
 } // namespace CloudFormation
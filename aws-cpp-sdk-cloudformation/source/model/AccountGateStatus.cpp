@@ -30,25 +30,44 @@ namespace Aws
       namespace AccountGateStatusMapper
       {
 
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SKIPPED_HASH = HashingUtils::HashString("SKIPPED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCEEDED",
+          "FAILED",
+          "SKIPPED",
+        };
 
         AccountGateStatus GetAccountGateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCEEDED_HASH)
-          {
-            return AccountGateStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccountGateStatus::FAILED;
-          }
-          else if (hashCode == SKIPPED_HASH)
-          {
-            return AccountGateStatus::SKIPPED;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return AccountGateStatus::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return AccountGateStatus::FAILED;
+            }
+            break;
+          case -1429540080:
+            if (name == "SKIPPED")
+            {
+              return AccountGateStatus::SKIPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AccountGateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAccountGateStatus(AccountGateStatus enumValue)
+        const char* GetNameForAccountGateStatusCStr(AccountGateStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccountGateStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case AccountGateStatus::FAILED:
-            return "FAILED";
-          case AccountGateStatus::SKIPPED:
-            return "SKIPPED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccountGateStatus(AccountGateStatus enumValue)
+        {
+          return GetNameForAccountGateStatusCStr(enumValue);
         }
 
       } // namespace AccountGateStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace CapabilityMapper
       {
 
-        static const int CAPABILITY_IAM_HASH = HashingUtils::HashString("CAPABILITY_IAM");
-        static const int CAPABILITY_NAMED_IAM_HASH = HashingUtils::HashString("CAPABILITY_NAMED_IAM");
-        static const int CAPABILITY_AUTO_EXPAND_HASH = HashingUtils::HashString("CAPABILITY_AUTO_EXPAND");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CAPABILITY_IAM",
+          "CAPABILITY_NAMED_IAM",
+          "CAPABILITY_AUTO_EXPAND",
+        };
 
         Capability GetCapabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CAPABILITY_IAM_HASH)
-          {
-            return Capability::CAPABILITY_IAM;
-          }
-          else if (hashCode == CAPABILITY_NAMED_IAM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Capability::CAPABILITY_NAMED_IAM;
-          }
-          else if (hashCode == CAPABILITY_AUTO_EXPAND_HASH)
-          {
-            return Capability::CAPABILITY_AUTO_EXPAND;
+          case -1522397554:
+            if (name == "CAPABILITY_IAM")
+            {
+              return Capability::CAPABILITY_IAM;
+            }
+            break;
+          case 2041807272:
+            if (name == "CAPABILITY_NAMED_IAM")
+            {
+              return Capability::CAPABILITY_NAMED_IAM;
+            }
+            break;
+          case -429354365:
+            if (name == "CAPABILITY_AUTO_EXPAND")
+            {
+              return Capability::CAPABILITY_AUTO_EXPAND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Capability::NOT_SET;
         }
 
-        Aws::String GetNameForCapability(Capability enumValue)
+        const char* GetNameForCapabilityCStr(Capability enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Capability::CAPABILITY_IAM:
-            return "CAPABILITY_IAM";
-          case Capability::CAPABILITY_NAMED_IAM:
-            return "CAPABILITY_NAMED_IAM";
-          case Capability::CAPABILITY_AUTO_EXPAND:
-            return "CAPABILITY_AUTO_EXPAND";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCapability(Capability enumValue)
+        {
+          return GetNameForCapabilityCStr(enumValue);
         }
 
       } // namespace CapabilityMapper
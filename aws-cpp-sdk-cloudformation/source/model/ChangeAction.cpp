@@ -30,25 +30,44 @@ namespace Aws
       namespace ChangeActionMapper
       {
 
-        static const int Add_HASH = HashingUtils::HashString("Add");
-        static const int Modify_HASH = HashingUtils::HashString("Modify");
-        static const int Remove_HASH = HashingUtils::HashString("Remove");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Add",
+          "Modify",
+          "Remove",
+        };
 
         ChangeAction GetChangeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Add_HASH)
-          {
-            return ChangeAction::Add;
-          }
-          else if (hashCode == Modify_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeAction::Modify;
-          }
-          else if (hashCode == Remove_HASH)
-          {
-            return ChangeAction::Remove;
+          case 65665:
+            if (name == "Add")
+            {
+              return ChangeAction::Add;
+            }
+            break;
+          case -1984928550:
+            if (name == "Modify")
+            {
+              return ChangeAction::Modify;
+            }
+            break;
+          case -1850743644:
+            if (name == "Remove")
+            {
+              return ChangeAction::Remove;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ChangeAction::NOT_SET;
         }
 
-        Aws::String GetNameForChangeAction(ChangeAction enumValue)
+        const char* GetNameForChangeActionCStr(ChangeAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeAction::Add:
-            return "Add";
-          case ChangeAction::Modify:
-            return "Modify";
-          case ChangeAction::Remove:
-            return "Remove";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeAction(ChangeAction enumValue)
+        {
+          return GetNameForChangeActionCStr(enumValue);
         }
 
       } // namespace ChangeActionMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ChangeSetStatusMapper
       {
 
-        static const int CREATE_PENDING_HASH = HashingUtils::HashString("CREATE_PENDING");
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_COMPLETE_HASH = HashingUtils::HashString("CREATE_COMPLETE");
-        static const int DELETE_COMPLETE_HASH = HashingUtils::HashString("DELETE_COMPLETE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE_PENDING",
+          "CREATE_IN_PROGRESS",
+          "CREATE_COMPLETE",
+          "DELETE_COMPLETE",
+          "FAILED",
+        };
 
         ChangeSetStatus GetChangeSetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeSetStatus::CREATE_PENDING;
-          }
-          else if (hashCode == CREATE_IN_PROGRESS_HASH)
-          {
-            return ChangeSetStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_COMPLETE_HASH)
-          {
-            return ChangeSetStatus::CREATE_COMPLETE;
-          }
-          else if (hashCode == DELETE_COMPLETE_HASH)
-          {
-            return ChangeSetStatus::DELETE_COMPLETE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ChangeSetStatus::FAILED;
+          case 288199988:
+            if (name == "CREATE_PENDING")
+            {
+              return ChangeSetStatus::CREATE_PENDING;
+            }
+            break;
+          case 43560260:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return ChangeSetStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case -569796324:
+            if (name == "CREATE_COMPLETE")
+            {
+              return ChangeSetStatus::CREATE_COMPLETE;
+            }
+            break;
+          case 1677560141:
+            if (name == "DELETE_COMPLETE")
+            {
+              return ChangeSetStatus::DELETE_COMPLETE;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ChangeSetStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ChangeSetStatus::NOT_SET;
         }
 
-        Aws::String GetNameForChangeSetStatus(ChangeSetStatus enumValue)
+        const char* GetNameForChangeSetStatusCStr(ChangeSetStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeSetStatus::CREATE_PENDING:
-            return "CREATE_PENDING";
-          case ChangeSetStatus::CREATE_IN_PROGRESS:
-            return "CREATE_IN_PROGRESS";
-          case ChangeSetStatus::CREATE_COMPLETE:
-            return "CREATE_COMPLETE";
-          case ChangeSetStatus::DELETE_COMPLETE:
-            return "DELETE_COMPLETE";
-          case ChangeSetStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeSetStatus(ChangeSetStatus enumValue)
+        {
+          return GetNameForChangeSetStatusCStr(enumValue);
         }
 
       } // namespace ChangeSetStatusMapper
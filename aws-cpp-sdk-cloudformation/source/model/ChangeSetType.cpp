@@ -30,20 +30,37 @@ namespace Aws
       namespace ChangeSetTypeMapper
       {
 
-        static const int CREATE_HASH = HashingUtils::HashString("CREATE");
-        static const int UPDATE_HASH = HashingUtils::HashString("UPDATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE",
+          "UPDATE",
+        };
 
         ChangeSetType GetChangeSetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_HASH)
-          {
-            return ChangeSetType::CREATE;
-          }
-          else if (hashCode == UPDATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeSetType::UPDATE;
+          case 1996002556:
+            if (name == "CREATE")
+            {
+              return ChangeSetType::CREATE;
+            }
+            break;
+          case -1785516855:
+            if (name == "UPDATE")
+            {
+              return ChangeSetType::UPDATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ChangeSetType::NOT_SET;
         }
 
-        Aws::String GetNameForChangeSetType(ChangeSetType enumValue)
+        const char* GetNameForChangeSetTypeCStr(ChangeSetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeSetType::CREATE:
-            return "CREATE";
-          case ChangeSetType::UPDATE:
-            return "UPDATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeSetType(ChangeSetType enumValue)
+        {
+          return GetNameForChangeSetTypeCStr(enumValue);
         }
 
       } // namespace ChangeSetTypeMapper
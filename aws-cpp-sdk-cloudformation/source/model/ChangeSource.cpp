@@ -30,35 +30,58 @@ namespace Aws
       namespace ChangeSourceMapper
       {
 
-        static const int ResourceReference_HASH = HashingUtils::HashString("ResourceReference");
-        static const int ParameterReference_HASH = HashingUtils::HashString("ParameterReference");
-        static const int ResourceAttribute_HASH = HashingUtils::HashString("ResourceAttribute");
-        static const int DirectModification_HASH = HashingUtils::HashString("DirectModification");
-        static const int Automatic_HASH = HashingUtils::HashString("Automatic");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ResourceReference",
+          "ParameterReference",
+          "ResourceAttribute",
+          "DirectModification",
+          "Automatic",
+        };
 
         ChangeSource GetChangeSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ResourceReference_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeSource::ResourceReference;
-          }
-          else if (hashCode == ParameterReference_HASH)
-          {
-            return ChangeSource::ParameterReference;
-          }
-          else if (hashCode == ResourceAttribute_HASH)
-          {
-            return ChangeSource::ResourceAttribute;
-          }
-          else if (hashCode == DirectModification_HASH)
-          {
-            return ChangeSource::DirectModification;
-          }
-          else if (hashCode == Automatic_HASH)
-          {
-            return ChangeSource::Automatic;
+          case -966358339:
+            if (name == "ResourceReference")
+            {
+              return ChangeSource::ResourceReference;
+            }
+            break;
+          case 99055042:
+            if (name == "ParameterReference")
+            {
+              return ChangeSource::ParameterReference;
+            }
+            break;
+          case -28117490:
+            if (name == "ResourceAttribute")
+            {
+              return ChangeSource::ResourceAttribute;
+            }
+            break;
+          case -2146244539:
+            if (name == "DirectModification")
+            {
+              return ChangeSource::DirectModification;
+            }
+            break;
+          case -617328117:
+            if (name == "Automatic")
+            {
+              return ChangeSource::Automatic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ChangeSource::NOT_SET;
         }
 
-        Aws::String GetNameForChangeSource(ChangeSource enumValue)
+        const char* GetNameForChangeSourceCStr(ChangeSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeSource::ResourceReference:
-            return "ResourceReference";
-          case ChangeSource::ParameterReference:
-            return "ParameterReference";
-          case ChangeSource::ResourceAttribute:
-            return "ResourceAttribute";
-          case ChangeSource::DirectModification:
-            return "DirectModification";
-          case ChangeSource::Automatic:
-            return "Automatic";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeSource(ChangeSource enumValue)
+        {
+          return GetNameForChangeSourceCStr(enumValue);
         }
 
       } // namespace ChangeSourceMapper
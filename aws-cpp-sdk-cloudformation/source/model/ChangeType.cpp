@@ -30,15 +30,30 @@ namespace Aws
       namespace ChangeTypeMapper
       {
 
-        static const int Resource_HASH = HashingUtils::HashString("Resource");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Resource",
+        };
 
         ChangeType GetChangeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Resource_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeType::Resource;
+          case -276420562:
+            if (name == "Resource")
+            {
+              return ChangeType::Resource;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ChangeType::NOT_SET;
         }
 
-        Aws::String GetNameForChangeType(ChangeType enumValue)
+        const char* GetNameForChangeTypeCStr(ChangeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeType::Resource:
-            return "Resource";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeType(ChangeType enumValue)
+        {
+          return GetNameForChangeTypeCStr(enumValue);
         }
 
       } // namespace ChangeTypeMapper
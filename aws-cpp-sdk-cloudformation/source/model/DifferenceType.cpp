@@ -30,25 +30,44 @@ namespace Aws
       namespace DifferenceTypeMapper
       {
 
-        static const int ADD_HASH = HashingUtils::HashString("ADD");
-        static const int REMOVE_HASH = HashingUtils::HashString("REMOVE");
-        static const int NOT_EQUAL_HASH = HashingUtils::HashString("NOT_EQUAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADD",
+          "REMOVE",
+          "NOT_EQUAL",
+        };
 
         DifferenceType GetDifferenceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADD_HASH)
-          {
-            return DifferenceType::ADD;
-          }
-          else if (hashCode == REMOVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DifferenceType::REMOVE;
-          }
-          else if (hashCode == NOT_EQUAL_HASH)
-          {
-            return DifferenceType::NOT_EQUAL;
+          case 64641:
+            if (name == "ADD")
+            {
+              return DifferenceType::ADD;
+            }
+            break;
+          case -1881281404:
+            if (name == "REMOVE")
+            {
+              return DifferenceType::REMOVE;
+            }
+            break;
+          case 1022422664:
+            if (name == "NOT_EQUAL")
+            {
+              return DifferenceType::NOT_EQUAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DifferenceType::NOT_SET;
         }
 
-        Aws::String GetNameForDifferenceType(DifferenceType enumValue)
+        const char* GetNameForDifferenceTypeCStr(DifferenceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DifferenceType::ADD:
-            return "ADD";
-          case DifferenceType::REMOVE:
-            return "REMOVE";
-          case DifferenceType::NOT_EQUAL:
-            return "NOT_EQUAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDifferenceType(DifferenceType enumValue)
+        {
+          return GetNameForDifferenceTypeCStr(enumValue);
         }
 
       } // namespace DifferenceTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace EvaluationTypeMapper
       {
 
-        static const int Static_HASH = HashingUtils::HashString("Static");
-        static const int Dynamic_HASH = HashingUtils::HashString("Dynamic");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Static",
+          "Dynamic",
+        };
 
         EvaluationType GetEvaluationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Static_HASH)
-          {
-            return EvaluationType::Static;
-          }
-          else if (hashCode == Dynamic_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EvaluationType::Dynamic;
+          case -1808614770:
+            if (name == "Static")
+            {
+              return EvaluationType::Static;
+            }
+            break;
+          case -505546721:
+            if (name == "Dynamic")
+            {
+              return EvaluationType::Dynamic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EvaluationType::NOT_SET;
         }
 
-        Aws::String GetNameForEvaluationType(EvaluationType enumValue)
+        const char* GetNameForEvaluationTypeCStr(EvaluationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EvaluationType::Static:
-            return "Static";
-          case EvaluationType::Dynamic:
-            return "Dynamic";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEvaluationType(EvaluationType enumValue)
+        {
+          return GetNameForEvaluationTypeCStr(enumValue);
         }
 
       } // namespace EvaluationTypeMapper
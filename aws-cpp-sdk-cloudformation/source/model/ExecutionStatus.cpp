@@ -30,40 +30,65 @@ namespace Aws
       namespace ExecutionStatusMapper
       {
 
-        static const int UNAVAILABLE_HASH = HashingUtils::HashString("UNAVAILABLE");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int EXECUTE_IN_PROGRESS_HASH = HashingUtils::HashString("EXECUTE_IN_PROGRESS");
-        static const int EXECUTE_COMPLETE_HASH = HashingUtils::HashString("EXECUTE_COMPLETE");
-        static const int EXECUTE_FAILED_HASH = HashingUtils::HashString("EXECUTE_FAILED");
-        static const int OBSOLETE_HASH = HashingUtils::HashString("OBSOLETE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNAVAILABLE",
+          "AVAILABLE",
+          "EXECUTE_IN_PROGRESS",
+          "EXECUTE_COMPLETE",
+          "EXECUTE_FAILED",
+          "OBSOLETE",
+        };
 
         ExecutionStatus GetExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNAVAILABLE_HASH)
-          {
-            return ExecutionStatus::UNAVAILABLE;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return ExecutionStatus::AVAILABLE;
-          }
-          else if (hashCode == EXECUTE_IN_PROGRESS_HASH)
-          {
-            return ExecutionStatus::EXECUTE_IN_PROGRESS;
-          }
-          else if (hashCode == EXECUTE_COMPLETE_HASH)
-          {
-            return ExecutionStatus::EXECUTE_COMPLETE;
-          }
-          else if (hashCode == EXECUTE_FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExecutionStatus::EXECUTE_FAILED;
-          }
-          else if (hashCode == OBSOLETE_HASH)
-          {
-            return ExecutionStatus::OBSOLETE;
+          case 1487498288:
+            if (name == "UNAVAILABLE")
+            {
+              return ExecutionStatus::UNAVAILABLE;
+            }
+            break;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return ExecutionStatus::AVAILABLE;
+            }
+            break;
+          case -1159930339:
+            if (name == "EXECUTE_IN_PROGRESS")
+            {
+              return ExecutionStatus::EXECUTE_IN_PROGRESS;
+            }
+            break;
+          case 1307688675:
+            if (name == "EXECUTE_COMPLETE")
+            {
+              return ExecutionStatus::EXECUTE_COMPLETE;
+            }
+            break;
+          case -944797593:
+            if (name == "EXECUTE_FAILED")
+            {
+              return ExecutionStatus::EXECUTE_FAILED;
+            }
+            break;
+          case 1140274585:
+            if (name == "OBSOLETE")
+            {
+              return ExecutionStatus::OBSOLETE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionStatus(ExecutionStatus enumValue)
+        const char* GetNameForExecutionStatusCStr(ExecutionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExecutionStatus::UNAVAILABLE:
-            return "UNAVAILABLE";
-          case ExecutionStatus::AVAILABLE:
-            return "AVAILABLE";
-          case ExecutionStatus::EXECUTE_IN_PROGRESS:
-            return "EXECUTE_IN_PROGRESS";
-          case ExecutionStatus::EXECUTE_COMPLETE:
-            return "EXECUTE_COMPLETE";
-          case ExecutionStatus::EXECUTE_FAILED:
-            return "EXECUTE_FAILED";
-          case ExecutionStatus::OBSOLETE:
-            return "OBSOLETE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExecutionStatus(ExecutionStatus enumValue)
+        {
+          return GetNameForExecutionStatusCStr(enumValue);
         }
 
       } // namespace ExecutionStatusMapper
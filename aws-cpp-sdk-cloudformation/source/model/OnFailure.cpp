@@ -30,25 +30,44 @@ namespace Aws
       namespace OnFailureMapper
       {
 
-        static const int DO_NOTHING_HASH = HashingUtils::HashString("DO_NOTHING");
-        static const int ROLLBACK_HASH = HashingUtils::HashString("ROLLBACK");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DO_NOTHING",
+          "ROLLBACK",
+          "DELETE",
+        };
 
         OnFailure GetOnFailureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DO_NOTHING_HASH)
-          {
-            return OnFailure::DO_NOTHING;
-          }
-          else if (hashCode == ROLLBACK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OnFailure::ROLLBACK;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return OnFailure::DELETE_;
+          case -622434311:
+            if (name == "DO_NOTHING")
+            {
+              return OnFailure::DO_NOTHING;
+            }
+            break;
+          case 522907364:
+            if (name == "ROLLBACK")
+            {
+              return OnFailure::ROLLBACK;
+            }
+            break;
+          case 2012838315:
+            if (name == "DELETE")
+            {
+              return OnFailure::DELETE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return OnFailure::NOT_SET;
         }
 
-        Aws::String GetNameForOnFailure(OnFailure enumValue)
+        const char* GetNameForOnFailureCStr(OnFailure enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OnFailure::DO_NOTHING:
-            return "DO_NOTHING";
-          case OnFailure::ROLLBACK:
-            return "ROLLBACK";
-          case OnFailure::DELETE_:
-            return "DELETE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOnFailure(OnFailure enumValue)
+        {
+          return GetNameForOnFailureCStr(enumValue);
         }
 
       } // namespace OnFailureMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ReplacementMapper
       {
 
-        static const int True_HASH = HashingUtils::HashString("True");
-        static const int False_HASH = HashingUtils::HashString("False");
-        static const int Conditional_HASH = HashingUtils::HashString("Conditional");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "True",
+          "False",
+          "Conditional",
+        };
 
         Replacement GetReplacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == True_HASH)
-          {
-            return Replacement::True;
-          }
-          else if (hashCode == False_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Replacement::False;
-          }
-          else if (hashCode == Conditional_HASH)
-          {
-            return Replacement::Conditional;
+          case 2615726:
+            if (name == "True")
+            {
+              return Replacement::True;
+            }
+            break;
+          case 67643651:
+            if (name == "False")
+            {
+              return Replacement::False;
+            }
+            break;
+          case -1418967450:
+            if (name == "Conditional")
+            {
+              return Replacement::Conditional;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Replacement::NOT_SET;
         }
 
-        Aws::String GetNameForReplacement(Replacement enumValue)
+        const char* GetNameForReplacementCStr(Replacement enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Replacement::True:
-            return "True";
-          case Replacement::False:
-            return "False";
-          case Replacement::Conditional:
-            return "Conditional";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReplacement(Replacement enumValue)
+        {
+          return GetNameForReplacementCStr(enumValue);
         }
 
       } // namespace ReplacementMapper
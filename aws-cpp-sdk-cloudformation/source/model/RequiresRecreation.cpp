@@ -30,25 +30,44 @@ namespace Aws
       namespace RequiresRecreationMapper
       {
 
-        static const int Never_HASH = HashingUtils::HashString("Never");
-        static const int Conditionally_HASH = HashingUtils::HashString("Conditionally");
-        static const int Always_HASH = HashingUtils::HashString("Always");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Never",
+          "Conditionally",
+          "Always",
+        };
 
         RequiresRecreation GetRequiresRecreationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Never_HASH)
-          {
-            return RequiresRecreation::Never;
-          }
-          else if (hashCode == Conditionally_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RequiresRecreation::Conditionally;
-          }
-          else if (hashCode == Always_HASH)
-          {
-            return RequiresRecreation::Always;
+          case 75160172:
+            if (name == "Never")
+            {
+              return RequiresRecreation::Never;
+            }
+            break;
+          case -2123083149:
+            if (name == "Conditionally")
+            {
+              return RequiresRecreation::Conditionally;
+            }
+            break;
+          case 1964277295:
+            if (name == "Always")
+            {
+              return RequiresRecreation::Always;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RequiresRecreation::NOT_SET;
         }
 
-        Aws::String GetNameForRequiresRecreation(RequiresRecreation enumValue)
+        const char* GetNameForRequiresRecreationCStr(RequiresRecreation enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RequiresRecreation::Never:
-            return "Never";
-          case RequiresRecreation::Conditionally:
-            return "Conditionally";
-          case RequiresRecreation::Always:
-            return "Always";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRequiresRecreation(RequiresRecreation enumValue)
+        {
+          return GetNameForRequiresRecreationCStr(enumValue);
         }
 
       } // namespace RequiresRecreationMapper
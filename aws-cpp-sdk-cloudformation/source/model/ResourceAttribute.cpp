@@ -30,40 +30,65 @@ namespace Aws
       namespace ResourceAttributeMapper
       {
 
-        static const int Properties_HASH = HashingUtils::HashString("Properties");
-        static const int Metadata_HASH = HashingUtils::HashString("Metadata");
-        static const int CreationPolicy_HASH = HashingUtils::HashString("CreationPolicy");
-        static const int UpdatePolicy_HASH = HashingUtils::HashString("UpdatePolicy");
-        static const int DeletionPolicy_HASH = HashingUtils::HashString("DeletionPolicy");
-        static const int Tags_HASH = HashingUtils::HashString("Tags");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Properties",
+          "Metadata",
+          "CreationPolicy",
+          "UpdatePolicy",
+          "DeletionPolicy",
+          "Tags",
+        };
 
         ResourceAttribute GetResourceAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Properties_HASH)
-          {
-            return ResourceAttribute::Properties;
-          }
-          else if (hashCode == Metadata_HASH)
-          {
-            return ResourceAttribute::Metadata;
-          }
-          else if (hashCode == CreationPolicy_HASH)
-          {
-            return ResourceAttribute::CreationPolicy;
-          }
-          else if (hashCode == UpdatePolicy_HASH)
-          {
-            return ResourceAttribute::UpdatePolicy;
-          }
-          else if (hashCode == DeletionPolicy_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceAttribute::DeletionPolicy;
-          }
-          else if (hashCode == Tags_HASH)
-          {
-            return ResourceAttribute::Tags;
+          case 1067411795:
+            if (name == "Properties")
+            {
+              return ResourceAttribute::Properties;
+            }
+            break;
+          case -385360049:
+            if (name == "Metadata")
+            {
+              return ResourceAttribute::Metadata;
+            }
+            break;
+          case -1663178479:
+            if (name == "CreationPolicy")
+            {
+              return ResourceAttribute::CreationPolicy;
+            }
+            break;
+          case -866606213:
+            if (name == "UpdatePolicy")
+            {
+              return ResourceAttribute::UpdatePolicy;
+            }
+            break;
+          case -343757120:
+            if (name == "DeletionPolicy")
+            {
+              return ResourceAttribute::DeletionPolicy;
+            }
+            break;
+          case 2598969:
+            if (name == "Tags")
+            {
+              return ResourceAttribute::Tags;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ResourceAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForResourceAttribute(ResourceAttribute enumValue)
+        const char* GetNameForResourceAttributeCStr(ResourceAttribute enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceAttribute::Properties:
-            return "Properties";
-          case ResourceAttribute::Metadata:
-            return "Metadata";
-          case ResourceAttribute::CreationPolicy:
-            return "CreationPolicy";
-          case ResourceAttribute::UpdatePolicy:
-            return "UpdatePolicy";
-          case ResourceAttribute::DeletionPolicy:
-            return "DeletionPolicy";
-          case ResourceAttribute::Tags:
-            return "Tags";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceAttribute(ResourceAttribute enumValue)
+        {
+          return GetNameForResourceAttributeCStr(enumValue);
         }
 
       } // namespace ResourceAttributeMapper
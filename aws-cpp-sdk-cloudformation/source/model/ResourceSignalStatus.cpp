@@ -30,20 +30,37 @@ namespace Aws
       namespace ResourceSignalStatusMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILURE_HASH = HashingUtils::HashString("FAILURE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCESS",
+          "FAILURE",
+        };
 
         ResourceSignalStatus GetResourceSignalStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
-          {
-            return ResourceSignalStatus::SUCCESS;
-          }
-          else if (hashCode == FAILURE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceSignalStatus::FAILURE;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return ResourceSignalStatus::SUCCESS;
+            }
+            break;
+          case -368591510:
+            if (name == "FAILURE")
+            {
+              return ResourceSignalStatus::FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ResourceSignalStatus::NOT_SET;
         }
 
-        Aws::String GetNameForResourceSignalStatus(ResourceSignalStatus enumValue)
+        const char* GetNameForResourceSignalStatusCStr(ResourceSignalStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceSignalStatus::SUCCESS:
-            return "SUCCESS";
-          case ResourceSignalStatus::FAILURE:
-            return "FAILURE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceSignalStatus(ResourceSignalStatus enumValue)
+        {
+          return GetNameForResourceSignalStatusCStr(enumValue);
         }
 
       } // namespace ResourceSignalStatusMapper
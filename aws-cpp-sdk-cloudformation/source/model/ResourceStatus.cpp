@@ -30,60 +30,93 @@ namespace Aws
       namespace ResourceStatusMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
-        static const int CREATE_COMPLETE_HASH = HashingUtils::HashString("CREATE_COMPLETE");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int DELETE_FAILED_HASH = HashingUtils::HashString("DELETE_FAILED");
-        static const int DELETE_COMPLETE_HASH = HashingUtils::HashString("DELETE_COMPLETE");
-        static const int DELETE_SKIPPED_HASH = HashingUtils::HashString("DELETE_SKIPPED");
-        static const int UPDATE_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_IN_PROGRESS");
-        static const int UPDATE_FAILED_HASH = HashingUtils::HashString("UPDATE_FAILED");
-        static const int UPDATE_COMPLETE_HASH = HashingUtils::HashString("UPDATE_COMPLETE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE_IN_PROGRESS",
+          "CREATE_FAILED",
+          "CREATE_COMPLETE",
+          "DELETE_IN_PROGRESS",
+          "DELETE_FAILED",
+          "DELETE_COMPLETE",
+          "DELETE_SKIPPED",
+          "UPDATE_IN_PROGRESS",
+          "UPDATE_FAILED",
+          "UPDATE_COMPLETE",
+        };
 
         ResourceStatus GetResourceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
-          {
-            return ResourceStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
-          {
-            return ResourceStatus::CREATE_FAILED;
-          }
-          else if (hashCode == CREATE_COMPLETE_HASH)
-          {
-            return ResourceStatus::CREATE_COMPLETE;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
-            return ResourceStatus::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETE_FAILED_HASH)
-          {
-            return ResourceStatus::DELETE_FAILED;
-          }
-          else if (hashCode == DELETE_COMPLETE_HASH)
-          {
-            return ResourceStatus::DELETE_COMPLETE;
-          }
-          else if (hashCode == DELETE_SKIPPED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceStatus::DELETE_SKIPPED;
-          }
-          else if (hashCode == UPDATE_IN_PROGRESS_HASH)
-          {
-            return ResourceStatus::UPDATE_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_FAILED_HASH)
-          {
-            return ResourceStatus::UPDATE_FAILED;
-          }
-          else if (hashCode == UPDATE_COMPLETE_HASH)
-          {
-            return ResourceStatus::UPDATE_COMPLETE;
+          case 43560260:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return ResourceStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case -835019552:
+            if (name == "CREATE_FAILED")
+            {
+              return ResourceStatus::CREATE_FAILED;
+            }
+            break;
+          case -569796324:
+            if (name == "CREATE_COMPLETE")
+            {
+              return ResourceStatus::CREATE_COMPLETE;
+            }
+            break;
+          case 1089799027:
+            if (name == "DELETE_IN_PROGRESS")
+            {
+              return ResourceStatus::DELETE_IN_PROGRESS;
+            }
+            break;
+          case 1008657745:
+            if (name == "DELETE_FAILED")
+            {
+              return ResourceStatus::DELETE_FAILED;
+            }
+            break;
+          case 1677560141:
+            if (name == "DELETE_COMPLETE")
+            {
+              return ResourceStatus::DELETE_COMPLETE;
+            }
+            break;
+          case 142686332:
+            if (name == "DELETE_SKIPPED")
+            {
+              return ResourceStatus::DELETE_SKIPPED;
+            }
+            break;
+          case 1375009169:
+            if (name == "UPDATE_IN_PROGRESS")
+            {
+              return ResourceStatus::UPDATE_IN_PROGRESS;
+            }
+            break;
+          case -282520461:
+            if (name == "UPDATE_FAILED")
+            {
+              return ResourceStatus::UPDATE_FAILED;
+            }
+            break;
+          case 2100852719:
+            if (name == "UPDATE_COMPLETE")
+            {
+              return ResourceStatus::UPDATE_COMPLETE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return ResourceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForResourceStatus(ResourceStatus enumValue)
+        const char* GetNameForResourceStatusCStr(ResourceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceStatus::CREATE_IN_PROGRESS:
-            return "CREATE_IN_PROGRESS";
-          case ResourceStatus::CREATE_FAILED:
-            return "CREATE_FAILED";
-          case ResourceStatus::CREATE_COMPLETE:
-            return "CREATE_COMPLETE";
-          case ResourceStatus::DELETE_IN_PROGRESS:
-            return "DELETE_IN_PROGRESS";
-          case ResourceStatus::DELETE_FAILED:
-            return "DELETE_FAILED";
-          case ResourceStatus::DELETE_COMPLETE:
-            return "DELETE_COMPLETE";
-          case ResourceStatus::DELETE_SKIPPED:
-            return "DELETE_SKIPPED";
-          case ResourceStatus::UPDATE_IN_PROGRESS:
-            return "UPDATE_IN_PROGRESS";
-          case ResourceStatus::UPDATE_FAILED:
-            return "UPDATE_FAILED";
-          case ResourceStatus::UPDATE_COMPLETE:
-            return "UPDATE_COMPLETE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceStatus(ResourceStatus enumValue)
+        {
+          return GetNameForResourceStatusCStr(enumValue);
         }
 
       } // namespace ResourceStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace StackDriftDetectionStatusMapper
       {
 
-        static const int DETECTION_IN_PROGRESS_HASH = HashingUtils::HashString("DETECTION_IN_PROGRESS");
-        static const int DETECTION_FAILED_HASH = HashingUtils::HashString("DETECTION_FAILED");
-        static const int DETECTION_COMPLETE_HASH = HashingUtils::HashString("DETECTION_COMPLETE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DETECTION_IN_PROGRESS",
+          "DETECTION_FAILED",
+          "DETECTION_COMPLETE",
+        };
 
         StackDriftDetectionStatus GetStackDriftDetectionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DETECTION_IN_PROGRESS_HASH)
-          {
-            return StackDriftDetectionStatus::DETECTION_IN_PROGRESS;
-          }
-          else if (hashCode == DETECTION_FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StackDriftDetectionStatus::DETECTION_FAILED;
-          }
-          else if (hashCode == DETECTION_COMPLETE_HASH)
-          {
-            return StackDriftDetectionStatus::DETECTION_COMPLETE;
+          case 345906477:
+            if (name == "DETECTION_IN_PROGRESS")
+            {
+              return StackDriftDetectionStatus::DETECTION_IN_PROGRESS;
+            }
+            break;
+          case -1798889641:
+            if (name == "DETECTION_FAILED")
+            {
+              return StackDriftDetectionStatus::DETECTION_FAILED;
+            }
+            break;
+          case 863984083:
+            if (name == "DETECTION_COMPLETE")
+            {
+              return StackDriftDetectionStatus::DETECTION_COMPLETE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StackDriftDetectionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackDriftDetectionStatus(StackDriftDetectionStatus enumValue)
+        const char* GetNameForStackDriftDetectionStatusCStr(StackDriftDetectionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackDriftDetectionStatus::DETECTION_IN_PROGRESS:
-            return "DETECTION_IN_PROGRESS";
-          case StackDriftDetectionStatus::DETECTION_FAILED:
-            return "DETECTION_FAILED";
-          case StackDriftDetectionStatus::DETECTION_COMPLETE:
-            return "DETECTION_COMPLETE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackDriftDetectionStatus(StackDriftDetectionStatus enumValue)
+        {
+          return GetNameForStackDriftDetectionStatusCStr(enumValue);
         }
 
       } // namespace StackDriftDetectionStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace StackDriftStatusMapper
       {
 
-        static const int DRIFTED_HASH = HashingUtils::HashString("DRIFTED");
-        static const int IN_SYNC_HASH = HashingUtils::HashString("IN_SYNC");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-        static const int NOT_CHECKED_HASH = HashingUtils::HashString("NOT_CHECKED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DRIFTED",
+          "IN_SYNC",
+          "UNKNOWN",
+          "NOT_CHECKED",
+        };
 
         StackDriftStatus GetStackDriftStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DRIFTED_HASH)
-          {
-            return StackDriftStatus::DRIFTED;
-          }
-          else if (hashCode == IN_SYNC_HASH)
-          {
-            return StackDriftStatus::IN_SYNC;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return StackDriftStatus::UNKNOWN;
-          }
-          else if (hashCode == NOT_CHECKED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StackDriftStatus::NOT_CHECKED;
+          case -1657083416:
+            if (name == "DRIFTED")
+            {
+              return StackDriftStatus::DRIFTED;
+            }
+            break;
+          case -1608339083:
+            if (name == "IN_SYNC")
+            {
+              return StackDriftStatus::IN_SYNC;
+            }
+            break;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return StackDriftStatus::UNKNOWN;
+            }
+            break;
+          case 1248251387:
+            if (name == "NOT_CHECKED")
+            {
+              return StackDriftStatus::NOT_CHECKED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return StackDriftStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackDriftStatus(StackDriftStatus enumValue)
+        const char* GetNameForStackDriftStatusCStr(StackDriftStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackDriftStatus::DRIFTED:
-            return "DRIFTED";
-          case StackDriftStatus::IN_SYNC:
-            return "IN_SYNC";
-          case StackDriftStatus::UNKNOWN:
-            return "UNKNOWN";
-          case StackDriftStatus::NOT_CHECKED:
-            return "NOT_CHECKED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackDriftStatus(StackDriftStatus enumValue)
+        {
+          return GetNameForStackDriftStatusCStr(enumValue);
         }
 
       } // namespace StackDriftStatusMapper
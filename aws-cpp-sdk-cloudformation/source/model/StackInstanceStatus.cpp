@@ -30,25 +30,44 @@ namespace Aws
       namespace StackInstanceStatusMapper
       {
 
-        static const int CURRENT_HASH = HashingUtils::HashString("CURRENT");
-        static const int OUTDATED_HASH = HashingUtils::HashString("OUTDATED");
-        static const int INOPERABLE_HASH = HashingUtils::HashString("INOPERABLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CURRENT",
+          "OUTDATED",
+          "INOPERABLE",
+        };
 
         StackInstanceStatus GetStackInstanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CURRENT_HASH)
-          {
-            return StackInstanceStatus::CURRENT;
-          }
-          else if (hashCode == OUTDATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StackInstanceStatus::OUTDATED;
-          }
-          else if (hashCode == INOPERABLE_HASH)
-          {
-            return StackInstanceStatus::INOPERABLE;
+          case 1844922713:
+            if (name == "CURRENT")
+            {
+              return StackInstanceStatus::CURRENT;
+            }
+            break;
+          case 841132008:
+            if (name == "OUTDATED")
+            {
+              return StackInstanceStatus::OUTDATED;
+            }
+            break;
+          case -426055475:
+            if (name == "INOPERABLE")
+            {
+              return StackInstanceStatus::INOPERABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StackInstanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackInstanceStatus(StackInstanceStatus enumValue)
+        const char* GetNameForStackInstanceStatusCStr(StackInstanceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackInstanceStatus::CURRENT:
-            return "CURRENT";
-          case StackInstanceStatus::OUTDATED:
-            return "OUTDATED";
-          case StackInstanceStatus::INOPERABLE:
-            return "INOPERABLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackInstanceStatus(StackInstanceStatus enumValue)
+        {
+          return GetNameForStackInstanceStatusCStr(enumValue);
         }
 
       } // namespace StackInstanceStatusMapper
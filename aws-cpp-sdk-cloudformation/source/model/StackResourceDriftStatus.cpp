@@ -30,30 +30,51 @@ namespace Aws
       namespace StackResourceDriftStatusMapper
       {
 
-        static const int IN_SYNC_HASH = HashingUtils::HashString("IN_SYNC");
-        static const int MODIFIED_HASH = HashingUtils::HashString("MODIFIED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int NOT_CHECKED_HASH = HashingUtils::HashString("NOT_CHECKED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_SYNC",
+          "MODIFIED",
+          "DELETED",
+          "NOT_CHECKED",
+        };
 
         StackResourceDriftStatus GetStackResourceDriftStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_SYNC_HASH)
-          {
-            return StackResourceDriftStatus::IN_SYNC;
-          }
-          else if (hashCode == MODIFIED_HASH)
-          {
-            return StackResourceDriftStatus::MODIFIED;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return StackResourceDriftStatus::DELETED;
-          }
-          else if (hashCode == NOT_CHECKED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StackResourceDriftStatus::NOT_CHECKED;
+          case -1608339083:
+            if (name == "IN_SYNC")
+            {
+              return StackResourceDriftStatus::IN_SYNC;
+            }
+            break;
+          case 167113417:
+            if (name == "MODIFIED")
+            {
+              return StackResourceDriftStatus::MODIFIED;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return StackResourceDriftStatus::DELETED;
+            }
+            break;
+          case 1248251387:
+            if (name == "NOT_CHECKED")
+            {
+              return StackResourceDriftStatus::NOT_CHECKED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return StackResourceDriftStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackResourceDriftStatus(StackResourceDriftStatus enumValue)
+        const char* GetNameForStackResourceDriftStatusCStr(StackResourceDriftStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackResourceDriftStatus::IN_SYNC:
-            return "IN_SYNC";
-          case StackResourceDriftStatus::MODIFIED:
-            return "MODIFIED";
-          case StackResourceDriftStatus::DELETED:
-            return "DELETED";
-          case StackResourceDriftStatus::NOT_CHECKED:
-            return "NOT_CHECKED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackResourceDriftStatus(StackResourceDriftStatus enumValue)
+        {
+          return GetNameForStackResourceDriftStatusCStr(enumValue);
         }
 
       } // namespace StackResourceDriftStatusMapper
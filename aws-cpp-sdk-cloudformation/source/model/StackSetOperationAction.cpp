@@ -30,25 +30,44 @@ namespace Aws
       namespace StackSetOperationActionMapper
       {
 
-        static const int CREATE_HASH = HashingUtils::HashString("CREATE");
-        static const int UPDATE_HASH = HashingUtils::HashString("UPDATE");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE",
+          "UPDATE",
+          "DELETE",
+        };
 
         StackSetOperationAction GetStackSetOperationActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_HASH)
-          {
-            return StackSetOperationAction::CREATE;
-          }
-          else if (hashCode == UPDATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StackSetOperationAction::UPDATE;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return StackSetOperationAction::DELETE_;
+          case 1996002556:
+            if (name == "CREATE")
+            {
+              return StackSetOperationAction::CREATE;
+            }
+            break;
+          case -1785516855:
+            if (name == "UPDATE")
+            {
+              return StackSetOperationAction::UPDATE;
+            }
+            break;
+          case 2012838315:
+            if (name == "DELETE")
+            {
+              return StackSetOperationAction::DELETE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StackSetOperationAction::NOT_SET;
         }
 
-        Aws::String GetNameForStackSetOperationAction(StackSetOperationAction enumValue)
+        const char* GetNameForStackSetOperationActionCStr(StackSetOperationAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackSetOperationAction::CREATE:
-            return "CREATE";
-          case StackSetOperationAction::UPDATE:
-            return "UPDATE";
-          case StackSetOperationAction::DELETE_:
-            return "DELETE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackSetOperationAction(StackSetOperationAction enumValue)
+        {
+          return GetNameForStackSetOperationActionCStr(enumValue);
         }
 
       } // namespace StackSetOperationActionMapper
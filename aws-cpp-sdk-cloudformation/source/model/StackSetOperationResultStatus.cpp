@@ -30,35 +30,58 @@ namespace Aws
       namespace StackSetOperationResultStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "RUNNING",
+          "SUCCEEDED",
+          "FAILED",
+          "CANCELLED",
+        };
 
         StackSetOperationResultStatus GetStackSetOperationResultStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StackSetOperationResultStatus::PENDING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return StackSetOperationResultStatus::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return StackSetOperationResultStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StackSetOperationResultStatus::FAILED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return StackSetOperationResultStatus::CANCELLED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return StackSetOperationResultStatus::PENDING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return StackSetOperationResultStatus::RUNNING;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return StackSetOperationResultStatus::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return StackSetOperationResultStatus::FAILED;
+            }
+            break;
+          case -1031784143:
+            if (name == "CANCELLED")
+            {
+              return StackSetOperationResultStatus::CANCELLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return StackSetOperationResultStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackSetOperationResultStatus(StackSetOperationResultStatus enumValue)
+        const char* GetNameForStackSetOperationResultStatusCStr(StackSetOperationResultStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackSetOperationResultStatus::PENDING:
-            return "PENDING";
-          case StackSetOperationResultStatus::RUNNING:
-            return "RUNNING";
-          case StackSetOperationResultStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case StackSetOperationResultStatus::FAILED:
-            return "FAILED";
-          case StackSetOperationResultStatus::CANCELLED:
-            return "CANCELLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackSetOperationResultStatus(StackSetOperationResultStatus enumValue)
+        {
+          return GetNameForStackSetOperationResultStatusCStr(enumValue);
         }
 
       } // namespace StackSetOperationResultStatusMapper
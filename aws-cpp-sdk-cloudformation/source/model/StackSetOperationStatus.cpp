@@ -30,35 +30,58 @@ namespace Aws
       namespace StackSetOperationStatusMapper
       {
 
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RUNNING",
+          "SUCCEEDED",
+          "FAILED",
+          "STOPPING",
+          "STOPPED",
+        };
 
         StackSetOperationStatus GetStackSetOperationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RUNNING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StackSetOperationStatus::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return StackSetOperationStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StackSetOperationStatus::FAILED;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return StackSetOperationStatus::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return StackSetOperationStatus::STOPPED;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return StackSetOperationStatus::RUNNING;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return StackSetOperationStatus::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return StackSetOperationStatus::FAILED;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return StackSetOperationStatus::STOPPING;
+            }
+            break;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return StackSetOperationStatus::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return StackSetOperationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackSetOperationStatus(StackSetOperationStatus enumValue)
+        const char* GetNameForStackSetOperationStatusCStr(StackSetOperationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackSetOperationStatus::RUNNING:
-            return "RUNNING";
-          case StackSetOperationStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case StackSetOperationStatus::FAILED:
-            return "FAILED";
-          case StackSetOperationStatus::STOPPING:
-            return "STOPPING";
-          case StackSetOperationStatus::STOPPED:
-            return "STOPPED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackSetOperationStatus(StackSetOperationStatus enumValue)
+        {
+          return GetNameForStackSetOperationStatusCStr(enumValue);
         }
 
       } // namespace StackSetOperationStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace StackSetStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "DELETED",
+        };
 
         StackSetStatus GetStackSetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return StackSetStatus::ACTIVE;
-          }
-          else if (hashCode == DELETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StackSetStatus::DELETED;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return StackSetStatus::ACTIVE;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return StackSetStatus::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return StackSetStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackSetStatus(StackSetStatus enumValue)
+        const char* GetNameForStackSetStatusCStr(StackSetStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackSetStatus::ACTIVE:
-            return "ACTIVE";
-          case StackSetStatus::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackSetStatus(StackSetStatus enumValue)
+        {
+          return GetNameForStackSetStatusCStr(enumValue);
         }
 
       } // namespace StackSetStatusMapper
@@ -30,95 +30,142 @@ namespace Aws
       namespace StackStatusMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
-        static const int CREATE_COMPLETE_HASH = HashingUtils::HashString("CREATE_COMPLETE");
-        static const int ROLLBACK_IN_PROGRESS_HASH = HashingUtils::HashString("ROLLBACK_IN_PROGRESS");
-        static const int ROLLBACK_FAILED_HASH = HashingUtils::HashString("ROLLBACK_FAILED");
-        static const int ROLLBACK_COMPLETE_HASH = HashingUtils::HashString("ROLLBACK_COMPLETE");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int DELETE_FAILED_HASH = HashingUtils::HashString("DELETE_FAILED");
-        static const int DELETE_COMPLETE_HASH = HashingUtils::HashString("DELETE_COMPLETE");
-        static const int UPDATE_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_IN_PROGRESS");
-        static const int UPDATE_COMPLETE_CLEANUP_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_COMPLETE_CLEANUP_IN_PROGRESS");
-        static const int UPDATE_COMPLETE_HASH = HashingUtils::HashString("UPDATE_COMPLETE");
-        static const int UPDATE_ROLLBACK_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_IN_PROGRESS");
-        static const int UPDATE_ROLLBACK_FAILED_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_FAILED");
-        static const int UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS");
-        static const int UPDATE_ROLLBACK_COMPLETE_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_COMPLETE");
-        static const int REVIEW_IN_PROGRESS_HASH = HashingUtils::HashString("REVIEW_IN_PROGRESS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE_IN_PROGRESS",
+          "CREATE_FAILED",
+          "CREATE_COMPLETE",
+          "ROLLBACK_IN_PROGRESS",
+          "ROLLBACK_FAILED",
+          "ROLLBACK_COMPLETE",
+          "DELETE_IN_PROGRESS",
+          "DELETE_FAILED",
+          "DELETE_COMPLETE",
+          "UPDATE_IN_PROGRESS",
+          "UPDATE_COMPLETE_CLEANUP_IN_PROGRESS",
+          "UPDATE_COMPLETE",
+          "UPDATE_ROLLBACK_IN_PROGRESS",
+          "UPDATE_ROLLBACK_FAILED",
+          "UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS",
+          "UPDATE_ROLLBACK_COMPLETE",
+          "REVIEW_IN_PROGRESS",
+        };
 
         StackStatus GetStackStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
-          {
-            return StackStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
-          {
-            return StackStatus::CREATE_FAILED;
-          }
-          else if (hashCode == CREATE_COMPLETE_HASH)
-          {
-            return StackStatus::CREATE_COMPLETE;
-          }
-          else if (hashCode == ROLLBACK_IN_PROGRESS_HASH)
-          {
-            return StackStatus::ROLLBACK_IN_PROGRESS;
-          }
-          else if (hashCode == ROLLBACK_FAILED_HASH)
-          {
-            return StackStatus::ROLLBACK_FAILED;
-          }
-          else if (hashCode == ROLLBACK_COMPLETE_HASH)
-          {
-            return StackStatus::ROLLBACK_COMPLETE;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
-            return StackStatus::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETE_FAILED_HASH)
-          {
-            return StackStatus::DELETE_FAILED;
-          }
-          else if (hashCode == DELETE_COMPLETE_HASH)
-          {
-            return StackStatus::DELETE_COMPLETE;
-          }
-          else if (hashCode == UPDATE_IN_PROGRESS_HASH)
-          {
-            return StackStatus::UPDATE_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_COMPLETE_CLEANUP_IN_PROGRESS_HASH)
-          {
-            return StackStatus::UPDATE_COMPLETE_CLEANUP_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_COMPLETE_HASH)
-          {
-            return StackStatus::UPDATE_COMPLETE;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_IN_PROGRESS_HASH)
-          {
-            return StackStatus::UPDATE_ROLLBACK_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_FAILED_HASH)
-          {
-            return StackStatus::UPDATE_ROLLBACK_FAILED;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS_HASH)
-          {
-            return StackStatus::UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_COMPLETE_HASH)
-          {
-            return StackStatus::UPDATE_ROLLBACK_COMPLETE;
-          }
-          else if (hashCode == REVIEW_IN_PROGRESS_HASH)
-          {
-            return StackStatus::REVIEW_IN_PROGRESS;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 43560260:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return StackStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case -835019552:
+            if (name == "CREATE_FAILED")
+            {
+              return StackStatus::CREATE_FAILED;
+            }
+            break;
+          case -569796324:
+            if (name == "CREATE_COMPLETE")
+            {
+              return StackStatus::CREATE_COMPLETE;
+            }
+            break;
+          case -1546949844:
+            if (name == "ROLLBACK_IN_PROGRESS")
+            {
+              return StackStatus::ROLLBACK_IN_PROGRESS;
+            }
+            break;
+          case 1450364408:
+            if (name == "ROLLBACK_FAILED")
+            {
+              return StackStatus::ROLLBACK_FAILED;
+            }
+            break;
+          case 955900980:
+            if (name == "ROLLBACK_COMPLETE")
+            {
+              return StackStatus::ROLLBACK_COMPLETE;
+            }
+            break;
+          case 1089799027:
+            if (name == "DELETE_IN_PROGRESS")
+            {
+              return StackStatus::DELETE_IN_PROGRESS;
+            }
+            break;
+          case 1008657745:
+            if (name == "DELETE_FAILED")
+            {
+              return StackStatus::DELETE_FAILED;
+            }
+            break;
+          case 1677560141:
+            if (name == "DELETE_COMPLETE")
+            {
+              return StackStatus::DELETE_COMPLETE;
+            }
+            break;
+          case 1375009169:
+            if (name == "UPDATE_IN_PROGRESS")
+            {
+              return StackStatus::UPDATE_IN_PROGRESS;
+            }
+            break;
+          case 1430234748:
+            if (name == "UPDATE_COMPLETE_CLEANUP_IN_PROGRESS")
+            {
+              return StackStatus::UPDATE_COMPLETE_CLEANUP_IN_PROGRESS;
+            }
+            break;
+          case 2100852719:
+            if (name == "UPDATE_COMPLETE")
+            {
+              return StackStatus::UPDATE_COMPLETE;
+            }
+            break;
+          case -1611767582:
+            if (name == "UPDATE_ROLLBACK_IN_PROGRESS")
+            {
+              return StackStatus::UPDATE_ROLLBACK_IN_PROGRESS;
+            }
+            break;
+          case -1565614462:
+            if (name == "UPDATE_ROLLBACK_FAILED")
+            {
+              return StackStatus::UPDATE_ROLLBACK_FAILED;
+            }
+            break;
+          case 2089397067:
+            if (name == "UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS")
+            {
+              return StackStatus::UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS;
+            }
+            break;
+          case 1703131710:
+            if (name == "UPDATE_ROLLBACK_COMPLETE")
+            {
+              return StackStatus::UPDATE_ROLLBACK_COMPLETE;
+            }
+            break;
+          case -1052288608:
+            if (name == "REVIEW_IN_PROGRESS")
+            {
+              return StackStatus::REVIEW_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,53 +177,26 @@ namespace Aws
           return StackStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackStatus(StackStatus enumValue)
+        const char* GetNameForStackStatusCStr(StackStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackStatus::CREATE_IN_PROGRESS:
-            return "CREATE_IN_PROGRESS";
-          case StackStatus::CREATE_FAILED:
-            return "CREATE_FAILED";
-          case StackStatus::CREATE_COMPLETE:
-            return "CREATE_COMPLETE";
-          case StackStatus::ROLLBACK_IN_PROGRESS:
-            return "ROLLBACK_IN_PROGRESS";
-          case StackStatus::ROLLBACK_FAILED:
-            return "ROLLBACK_FAILED";
-          case StackStatus::ROLLBACK_COMPLETE:
-            return "ROLLBACK_COMPLETE";
-          case StackStatus::DELETE_IN_PROGRESS:
-            return "DELETE_IN_PROGRESS";
-          case StackStatus::DELETE_FAILED:
-            return "DELETE_FAILED";
-          case StackStatus::DELETE_COMPLETE:
-            return "DELETE_COMPLETE";
-          case StackStatus::UPDATE_IN_PROGRESS:
-            return "UPDATE_IN_PROGRESS";
-          case StackStatus::UPDATE_COMPLETE_CLEANUP_IN_PROGRESS:
-            return "UPDATE_COMPLETE_CLEANUP_IN_PROGRESS";
-          case StackStatus::UPDATE_COMPLETE:
-            return "UPDATE_COMPLETE";
-          case StackStatus::UPDATE_ROLLBACK_IN_PROGRESS:
-            return "UPDATE_ROLLBACK_IN_PROGRESS";
-          case StackStatus::UPDATE_ROLLBACK_FAILED:
-            return "UPDATE_ROLLBACK_FAILED";
-          case StackStatus::UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS:
-            return "UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS";
-          case StackStatus::UPDATE_ROLLBACK_COMPLETE:
-            return "UPDATE_ROLLBACK_COMPLETE";
-          case StackStatus::REVIEW_IN_PROGRESS:
-            return "REVIEW_IN_PROGRESS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackStatus(StackStatus enumValue)
+        {
+          return GetNameForStackStatusCStr(enumValue);
         }
 
       } // namespace StackStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TemplateStageMapper
       {
 
-        static const int Original_HASH = HashingUtils::HashString("Original");
-        static const int Processed_HASH = HashingUtils::HashString("Processed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Original",
+          "Processed",
+        };
 
         TemplateStage GetTemplateStageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Original_HASH)
-          {
-            return TemplateStage::Original;
-          }
-          else if (hashCode == Processed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TemplateStage::Processed;
+          case 1443687921:
+            if (name == "Original")
+            {
+              return TemplateStage::Original;
+            }
+            break;
+          case 909208366:
+            if (name == "Processed")
+            {
+              return TemplateStage::Processed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TemplateStage::NOT_SET;
         }
 
-        Aws::String GetNameForTemplateStage(TemplateStage enumValue)
+        const char* GetNameForTemplateStageCStr(TemplateStage enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TemplateStage::Original:
-            return "Original";
-          case TemplateStage::Processed:
-            return "Processed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTemplateStage(TemplateStage enumValue)
+        {
+          return GetNameForTemplateStageCStr(enumValue);
         }
 
       } // namespace TemplateStageMapper
@@ -37,6 +37,11 @@ namespace EventTypeMapper
 AWS_CLOUDFRONT_API EventType GetEventTypeForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForEventType(EventType value);
+
+/**
+ * Same as GetNameForEventType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForEventTypeCStr(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace CloudFront
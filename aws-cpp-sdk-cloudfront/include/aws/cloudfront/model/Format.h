@@ -34,6 +34,11 @@ namespace FormatMapper
 AWS_CLOUDFRONT_API Format GetFormatForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForFormat(Format value);
+
+/**
+ * Same as GetNameForFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForFormatCStr(Format value);
 } // namespace FormatMapper
 } // namespace Model
 } // namespace CloudFront
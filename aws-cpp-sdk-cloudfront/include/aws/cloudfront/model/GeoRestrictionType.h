@@ -36,6 +36,11 @@ namespace GeoRestrictionTypeMapper
 AWS_CLOUDFRONT_API GeoRestrictionType GetGeoRestrictionTypeForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForGeoRestrictionType(GeoRestrictionType value);
+
+/**
+ * Same as GetNameForGeoRestrictionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForGeoRestrictionTypeCStr(GeoRestrictionType value);
 } // namespace GeoRestrictionTypeMapper
 } // namespace Model
 } // namespace CloudFront
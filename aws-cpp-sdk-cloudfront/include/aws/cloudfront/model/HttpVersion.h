@@ -35,6 +35,11 @@ namespace HttpVersionMapper
 AWS_CLOUDFRONT_API HttpVersion GetHttpVersionForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForHttpVersion(HttpVersion value);
+
+/**
+ * Same as GetNameForHttpVersion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForHttpVersionCStr(HttpVersion value);
 } // namespace HttpVersionMapper
 } // namespace Model
 } // namespace CloudFront
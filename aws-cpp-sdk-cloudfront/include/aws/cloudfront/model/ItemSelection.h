@@ -36,6 +36,11 @@ namespace ItemSelectionMapper
 AWS_CLOUDFRONT_API ItemSelection GetItemSelectionForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForItemSelection(ItemSelection value);
+
+/**
+ * Same as GetNameForItemSelection(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForItemSelectionCStr(ItemSelection value);
 } // namespace ItemSelectionMapper
 } // namespace Model
 } // namespace CloudFront
@@ -40,6 +40,11 @@ namespace MethodMapper
 AWS_CLOUDFRONT_API Method GetMethodForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForMethod(Method value);
+
+/**
+ * Same as GetNameForMethod(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForMethodCStr(Method value);
 } // namespace MethodMapper
 } // namespace Model
 } // namespace CloudFront
@@ -38,6 +38,11 @@ namespace MinimumProtocolVersionMapper
 AWS_CLOUDFRONT_API MinimumProtocolVersion GetMinimumProtocolVersionForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForMinimumProtocolVersion(MinimumProtocolVersion value);
+
+/**
+ * Same as GetNameForMinimumProtocolVersion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForMinimumProtocolVersionCStr(MinimumProtocolVersion value);
 } // namespace MinimumProtocolVersionMapper
 } // namespace Model
 } // namespace CloudFront
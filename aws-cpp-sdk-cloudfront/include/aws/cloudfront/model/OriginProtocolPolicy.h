@@ -36,6 +36,11 @@ namespace OriginProtocolPolicyMapper
 AWS_CLOUDFRONT_API OriginProtocolPolicy GetOriginProtocolPolicyForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForOriginProtocolPolicy(OriginProtocolPolicy value);
+
+/**
+ * Same as GetNameForOriginProtocolPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForOriginProtocolPolicyCStr(OriginProtocolPolicy value);
 } // namespace OriginProtocolPolicyMapper
 } // namespace Model
 } // namespace CloudFront
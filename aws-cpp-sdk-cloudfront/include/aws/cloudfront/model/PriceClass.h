@@ -36,6 +36,11 @@ namespace PriceClassMapper
 AWS_CLOUDFRONT_API PriceClass GetPriceClassForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForPriceClass(PriceClass value);
+
+/**
+ * Same as GetNameForPriceClass(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForPriceClassCStr(PriceClass value);
 } // namespace PriceClassMapper
 } // namespace Model
 } // namespace CloudFront
@@ -35,6 +35,11 @@ namespace SSLSupportMethodMapper
 AWS_CLOUDFRONT_API SSLSupportMethod GetSSLSupportMethodForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForSSLSupportMethod(SSLSupportMethod value);
+
+/**
+ * Same as GetNameForSSLSupportMethod(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForSSLSupportMethodCStr(SSLSupportMethod value);
 } // namespace SSLSupportMethodMapper
 } // namespace Model
 } // namespace CloudFront
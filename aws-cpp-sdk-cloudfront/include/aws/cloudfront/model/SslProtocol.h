@@ -37,6 +37,11 @@ namespace SslProtocolMapper
 AWS_CLOUDFRONT_API SslProtocol GetSslProtocolForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForSslProtocol(SslProtocol value);
+
+/**
+ * Same as GetNameForSslProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForSslProtocolCStr(SslProtocol value);
 } // namespace SslProtocolMapper
 } // namespace Model
 } // namespace CloudFront
@@ -36,6 +36,11 @@ namespace ViewerProtocolPolicyMapper
 AWS_CLOUDFRONT_API ViewerProtocolPolicy GetViewerProtocolPolicyForName(const Aws::String& name);
 
 AWS_CLOUDFRONT_API Aws::String GetNameForViewerProtocolPolicy(ViewerProtocolPolicy value);
+
+/**
+ * Same as GetNameForViewerProtocolPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDFRONT_API const char* GetNameForViewerProtocolPolicyCStr(ViewerProtocolPolicy value);
 } // namespace ViewerProtocolPolicyMapper
 } // namespace Model
 } // namespace CloudFront
@@ -30,30 +30,51 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int viewer_request_HASH = HashingUtils::HashString("viewer-request");
-        static const int viewer_response_HASH = HashingUtils::HashString("viewer-response");
-        static const int origin_request_HASH = HashingUtils::HashString("origin-request");
-        static const int origin_response_HASH = HashingUtils::HashString("origin-response");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "viewer-request",
+          "viewer-response",
+          "origin-request",
+          "origin-response",
+        };
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == viewer_request_HASH)
-          {
-            return EventType::viewer_request;
-          }
-          else if (hashCode == viewer_response_HASH)
-          {
-            return EventType::viewer_response;
-          }
-          else if (hashCode == origin_request_HASH)
-          {
-            return EventType::origin_request;
-          }
-          else if (hashCode == origin_response_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventType::origin_response;
+          case 448058836:
+            if (name == "viewer-request")
+            {
+              return EventType::viewer_request;
+            }
+            break;
+          case 1057855900:
+            if (name == "viewer-response")
+            {
+              return EventType::viewer_response;
+            }
+            break;
+          case -1597047064:
+            if (name == "origin-request")
+            {
+              return EventType::origin_request;
+            }
+            break;
+          case 2084082440:
+            if (name == "origin-response")
+            {
+              return EventType::origin_response;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventTypeCStr(EventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventType::viewer_request:
-            return "viewer-request";
-          case EventType::viewer_response:
-            return "viewer-response";
-          case EventType::origin_request:
-            return "origin-request";
-          case EventType::origin_response:
-            return "origin-response";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventType(EventType enumValue)
+        {
+          return GetNameForEventTypeCStr(enumValue);
         }
 
       } // namespace EventTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace FormatMapper
       {
 
-        static const int URLEncoded_HASH = HashingUtils::HashString("URLEncoded");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "URLEncoded",
+        };
 
         Format GetFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == URLEncoded_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Format::URLEncoded;
+          case 1955695807:
+            if (name == "URLEncoded")
+            {
+              return Format::URLEncoded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return Format::NOT_SET;
         }
 
-        Aws::String GetNameForFormat(Format enumValue)
+        const char* GetNameForFormatCStr(Format enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Format::URLEncoded:
-            return "URLEncoded";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFormat(Format enumValue)
+        {
+          return GetNameForFormatCStr(enumValue);
         }
 
       } // namespace FormatMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace GeoRestrictionTypeMapper
       {
 
-        static const int blacklist_HASH = HashingUtils::HashString("blacklist");
-        static const int whitelist_HASH = HashingUtils::HashString("whitelist");
-        static const int none_HASH = HashingUtils::HashString("none");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "blacklist",
+          "whitelist",
+          "none",
+        };
 
         GeoRestrictionType GetGeoRestrictionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == blacklist_HASH)
-          {
-            return GeoRestrictionType::blacklist;
-          }
-          else if (hashCode == whitelist_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GeoRestrictionType::whitelist;
-          }
-          else if (hashCode == none_HASH)
-          {
-            return GeoRestrictionType::none;
+          case 1333012765:
+            if (name == "blacklist")
+            {
+              return GeoRestrictionType::blacklist;
+            }
+            break;
+          case -1653850041:
+            if (name == "whitelist")
+            {
+              return GeoRestrictionType::whitelist;
+            }
+            break;
+          case 3387192:
+            if (name == "none")
+            {
+              return GeoRestrictionType::none;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return GeoRestrictionType::NOT_SET;
         }
 
-        Aws::String GetNameForGeoRestrictionType(GeoRestrictionType enumValue)
+        const char* GetNameForGeoRestrictionTypeCStr(GeoRestrictionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GeoRestrictionType::blacklist:
-            return "blacklist";
-          case GeoRestrictionType::whitelist:
-            return "whitelist";
-          case GeoRestrictionType::none:
-            return "none";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGeoRestrictionType(GeoRestrictionType enumValue)
+        {
+          return GetNameForGeoRestrictionTypeCStr(enumValue);
         }
 
       } // namespace GeoRestrictionTypeMapper
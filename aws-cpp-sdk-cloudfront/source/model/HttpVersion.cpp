@@ -30,20 +30,37 @@ namespace Aws
       namespace HttpVersionMapper
       {
 
-        static const int http1_1_HASH = HashingUtils::HashString("http1.1");
-        static const int http2_HASH = HashingUtils::HashString("http2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "http1.1",
+          "http2",
+        };
 
         HttpVersion GetHttpVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == http1_1_HASH)
-          {
-            return HttpVersion::http1_1;
-          }
-          else if (hashCode == http2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HttpVersion::http2;
+          case 1242597420:
+            if (name == "http1.1")
+            {
+              return HttpVersion::http1_1;
+            }
+            break;
+          case 99616938:
+            if (name == "http2")
+            {
+              return HttpVersion::http2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HttpVersion::NOT_SET;
         }
 
-        Aws::String GetNameForHttpVersion(HttpVersion enumValue)
+        const char* GetNameForHttpVersionCStr(HttpVersion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HttpVersion::http1_1:
-            return "http1.1";
-          case HttpVersion::http2:
-            return "http2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHttpVersion(HttpVersion enumValue)
+        {
+          return GetNameForHttpVersionCStr(enumValue);
         }
 
       } // namespace HttpVersionMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ItemSelectionMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int whitelist_HASH = HashingUtils::HashString("whitelist");
-        static const int all_HASH = HashingUtils::HashString("all");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "none",
+          "whitelist",
+          "all",
+        };
 
         ItemSelection GetItemSelectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
-          {
-            return ItemSelection::none;
-          }
-          else if (hashCode == whitelist_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ItemSelection::whitelist;
-          }
-          else if (hashCode == all_HASH)
-          {
-            return ItemSelection::all;
+          case 3387192:
+            if (name == "none")
+            {
+              return ItemSelection::none;
+            }
+            break;
+          case -1653850041:
+            if (name == "whitelist")
+            {
+              return ItemSelection::whitelist;
+            }
+            break;
+          case 96673:
+            if (name == "all")
+            {
+              return ItemSelection::all;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ItemSelection::NOT_SET;
         }
 
-        Aws::String GetNameForItemSelection(ItemSelection enumValue)
+        const char* GetNameForItemSelectionCStr(ItemSelection enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ItemSelection::none:
-            return "none";
-          case ItemSelection::whitelist:
-            return "whitelist";
-          case ItemSelection::all:
-            return "all";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForItemSelection(ItemSelection enumValue)
+        {
+          return GetNameForItemSelectionCStr(enumValue);
         }
 
       } // namespace ItemSelectionMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace MethodMapper
       {
 
-        static const int GET__HASH = HashingUtils::HashString("GET");
-        static const int HEAD_HASH = HashingUtils::HashString("HEAD");
-        static const int POST_HASH = HashingUtils::HashString("POST");
-        static const int PUT_HASH = HashingUtils::HashString("PUT");
-        static const int PATCH_HASH = HashingUtils::HashString("PATCH");
-        static const int OPTIONS_HASH = HashingUtils::HashString("OPTIONS");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GET",
+          "HEAD",
+          "POST",
+          "PUT",
+          "PATCH",
+          "OPTIONS",
+          "DELETE",
+        };
 
         Method GetMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GET__HASH)
-          {
-            return Method::GET_;
-          }
-          else if (hashCode == HEAD_HASH)
-          {
-            return Method::HEAD;
-          }
-          else if (hashCode == POST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Method::POST;
-          }
-          else if (hashCode == PUT_HASH)
-          {
-            return Method::PUT;
-          }
-          else if (hashCode == PATCH_HASH)
-          {
-            return Method::PATCH;
-          }
-          else if (hashCode == OPTIONS_HASH)
-          {
-            return Method::OPTIONS;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return Method::DELETE_;
+          case 70454:
+            if (name == "GET")
+            {
+              return Method::GET_;
+            }
+            break;
+          case 2213344:
+            if (name == "HEAD")
+            {
+              return Method::HEAD;
+            }
+            break;
+          case 2461856:
+            if (name == "POST")
+            {
+              return Method::POST;
+            }
+            break;
+          case 79599:
+            if (name == "PUT")
+            {
+              return Method::PUT;
+            }
+            break;
+          case 75900968:
+            if (name == "PATCH")
+            {
+              return Method::PATCH;
+            }
+            break;
+          case -531492226:
+            if (name == "OPTIONS")
+            {
+              return Method::OPTIONS;
+            }
+            break;
+          case 2012838315:
+            if (name == "DELETE")
+            {
+              return Method::DELETE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return Method::NOT_SET;
         }
 
-        Aws::String GetNameForMethod(Method enumValue)
+        const char* GetNameForMethodCStr(Method enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Method::GET_:
-            return "GET";
-          case Method::HEAD:
-            return "HEAD";
-          case Method::POST:
-            return "POST";
-          case Method::PUT:
-            return "PUT";
-          case Method::PATCH:
-            return "PATCH";
-          case Method::OPTIONS:
-            return "OPTIONS";
-          case Method::DELETE_:
-            return "DELETE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMethod(Method enumValue)
+        {
+          return GetNameForMethodCStr(enumValue);
         }
 
       } // namespace MethodMapper
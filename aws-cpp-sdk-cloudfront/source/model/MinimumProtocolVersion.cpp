@@ -30,35 +30,58 @@ namespace Aws
       namespace MinimumProtocolVersionMapper
       {
 
-        static const int SSLv3_HASH = HashingUtils::HashString("SSLv3");
-        static const int TLSv1_HASH = HashingUtils::HashString("TLSv1");
-        static const int TLSv1_2016_HASH = HashingUtils::HashString("TLSv1_2016");
-        static const int TLSv1_1_2016_HASH = HashingUtils::HashString("TLSv1.1_2016");
-        static const int TLSv1_2_2018_HASH = HashingUtils::HashString("TLSv1.2_2018");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SSLv3",
+          "TLSv1",
+          "TLSv1_2016",
+          "TLSv1.1_2016",
+          "TLSv1.2_2018",
+        };
 
         MinimumProtocolVersion GetMinimumProtocolVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSLv3_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MinimumProtocolVersion::SSLv3;
-          }
-          else if (hashCode == TLSv1_HASH)
-          {
-            return MinimumProtocolVersion::TLSv1;
-          }
-          else if (hashCode == TLSv1_2016_HASH)
-          {
-            return MinimumProtocolVersion::TLSv1_2016;
-          }
-          else if (hashCode == TLSv1_1_2016_HASH)
-          {
-            return MinimumProtocolVersion::TLSv1_1_2016;
-          }
-          else if (hashCode == TLSv1_2_2018_HASH)
-          {
-            return MinimumProtocolVersion::TLSv1_2_2018;
+          case 79201641:
+            if (name == "SSLv3")
+            {
+              return MinimumProtocolVersion::SSLv3;
+            }
+            break;
+          case 79923350:
+            if (name == "TLSv1")
+            {
+              return MinimumProtocolVersion::TLSv1;
+            }
+            break;
+          case -1787129108:
+            if (name == "TLSv1_2016")
+            {
+              return MinimumProtocolVersion::TLSv1_2016;
+            }
+            break;
+          case 32640137:
+            if (name == "TLSv1.1_2016")
+            {
+              return MinimumProtocolVersion::TLSv1_1_2016;
+            }
+            break;
+          case 61269290:
+            if (name == "TLSv1.2_2018")
+            {
+              return MinimumProtocolVersion::TLSv1_2_2018;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return MinimumProtocolVersion::NOT_SET;
         }
 
-        Aws::String GetNameForMinimumProtocolVersion(MinimumProtocolVersion enumValue)
+        const char* GetNameForMinimumProtocolVersionCStr(MinimumProtocolVersion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MinimumProtocolVersion::SSLv3:
-            return "SSLv3";
-          case MinimumProtocolVersion::TLSv1:
-            return "TLSv1";
-          case MinimumProtocolVersion::TLSv1_2016:
-            return "TLSv1_2016";
-          case MinimumProtocolVersion::TLSv1_1_2016:
-            return "TLSv1.1_2016";
-          case MinimumProtocolVersion::TLSv1_2_2018:
-            return "TLSv1.2_2018";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMinimumProtocolVersion(MinimumProtocolVersion enumValue)
+        {
+          return GetNameForMinimumProtocolVersionCStr(enumValue);
         }
 
       } // namespace MinimumProtocolVersionMapper
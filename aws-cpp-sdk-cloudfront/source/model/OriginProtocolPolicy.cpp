@@ -30,25 +30,44 @@ namespace Aws
       namespace OriginProtocolPolicyMapper
       {
 
-        static const int http_only_HASH = HashingUtils::HashString("http-only");
-        static const int match_viewer_HASH = HashingUtils::HashString("match-viewer");
-        static const int https_only_HASH = HashingUtils::HashString("https-only");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "http-only",
+          "match-viewer",
+          "https-only",
+        };
 
         OriginProtocolPolicy GetOriginProtocolPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == http_only_HASH)
-          {
-            return OriginProtocolPolicy::http_only;
-          }
-          else if (hashCode == match_viewer_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OriginProtocolPolicy::match_viewer;
-          }
-          else if (hashCode == https_only_HASH)
-          {
-            return OriginProtocolPolicy::https_only;
+          case 133516753:
+            if (name == "http-only")
+            {
+              return OriginProtocolPolicy::http_only;
+            }
+            break;
+          case 139406106:
+            if (name == "match-viewer")
+            {
+              return OriginProtocolPolicy::match_viewer;
+            }
+            break;
+          case 1787171662:
+            if (name == "https-only")
+            {
+              return OriginProtocolPolicy::https_only;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return OriginProtocolPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForOriginProtocolPolicy(OriginProtocolPolicy enumValue)
+        const char* GetNameForOriginProtocolPolicyCStr(OriginProtocolPolicy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OriginProtocolPolicy::http_only:
-            return "http-only";
-          case OriginProtocolPolicy::match_viewer:
-            return "match-viewer";
-          case OriginProtocolPolicy::https_only:
-            return "https-only";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOriginProtocolPolicy(OriginProtocolPolicy enumValue)
+        {
+          return GetNameForOriginProtocolPolicyCStr(enumValue);
         }
 
       } // namespace OriginProtocolPolicyMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PriceClassMapper
       {
 
-        static const int PriceClass_100_HASH = HashingUtils::HashString("PriceClass_100");
-        static const int PriceClass_200_HASH = HashingUtils::HashString("PriceClass_200");
-        static const int PriceClass_All_HASH = HashingUtils::HashString("PriceClass_All");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PriceClass_100",
+          "PriceClass_200",
+          "PriceClass_All",
+        };
 
         PriceClass GetPriceClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PriceClass_100_HASH)
-          {
-            return PriceClass::PriceClass_100;
-          }
-          else if (hashCode == PriceClass_200_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PriceClass::PriceClass_200;
-          }
-          else if (hashCode == PriceClass_All_HASH)
-          {
-            return PriceClass::PriceClass_All;
+          case 1607579521:
+            if (name == "PriceClass_100")
+            {
+              return PriceClass::PriceClass_100;
+            }
+            break;
+          case 1607580482:
+            if (name == "PriceClass_200")
+            {
+              return PriceClass::PriceClass_200;
+            }
+            break;
+          case 1607596817:
+            if (name == "PriceClass_All")
+            {
+              return PriceClass::PriceClass_All;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PriceClass::NOT_SET;
         }
 
-        Aws::String GetNameForPriceClass(PriceClass enumValue)
+        const char* GetNameForPriceClassCStr(PriceClass enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PriceClass::PriceClass_100:
-            return "PriceClass_100";
-          case PriceClass::PriceClass_200:
-            return "PriceClass_200";
-          case PriceClass::PriceClass_All:
-            return "PriceClass_All";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPriceClass(PriceClass enumValue)
+        {
+          return GetNameForPriceClassCStr(enumValue);
         }
 
       } // namespace PriceClassMapper
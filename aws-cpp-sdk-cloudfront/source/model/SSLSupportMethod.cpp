@@ -30,20 +30,37 @@ namespace Aws
       namespace SSLSupportMethodMapper
       {
 
-        static const int sni_only_HASH = HashingUtils::HashString("sni-only");
-        static const int vip_HASH = HashingUtils::HashString("vip");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "sni-only",
+          "vip",
+        };
 
         SSLSupportMethod GetSSLSupportMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == sni_only_HASH)
-          {
-            return SSLSupportMethod::sni_only;
-          }
-          else if (hashCode == vip_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SSLSupportMethod::vip;
+          case 451917995:
+            if (name == "sni-only")
+            {
+              return SSLSupportMethod::sni_only;
+            }
+            break;
+          case 116765:
+            if (name == "vip")
+            {
+              return SSLSupportMethod::vip;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SSLSupportMethod::NOT_SET;
         }
 
-        Aws::String GetNameForSSLSupportMethod(SSLSupportMethod enumValue)
+        const char* GetNameForSSLSupportMethodCStr(SSLSupportMethod enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SSLSupportMethod::sni_only:
-            return "sni-only";
-          case SSLSupportMethod::vip:
-            return "vip";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSSLSupportMethod(SSLSupportMethod enumValue)
+        {
+          return GetNameForSSLSupportMethodCStr(enumValue);
         }
 
       } // namespace SSLSupportMethodMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace SslProtocolMapper
       {
 
-        static const int SSLv3_HASH = HashingUtils::HashString("SSLv3");
-        static const int TLSv1_HASH = HashingUtils::HashString("TLSv1");
-        static const int TLSv1_1_HASH = HashingUtils::HashString("TLSv1.1");
-        static const int TLSv1_2_HASH = HashingUtils::HashString("TLSv1.2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SSLv3",
+          "TLSv1",
+          "TLSv1.1",
+          "TLSv1.2",
+        };
 
         SslProtocol GetSslProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSLv3_HASH)
-          {
-            return SslProtocol::SSLv3;
-          }
-          else if (hashCode == TLSv1_HASH)
-          {
-            return SslProtocol::TLSv1;
-          }
-          else if (hashCode == TLSv1_1_HASH)
-          {
-            return SslProtocol::TLSv1_1;
-          }
-          else if (hashCode == TLSv1_2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SslProtocol::TLSv1_2;
+          case 79201641:
+            if (name == "SSLv3")
+            {
+              return SslProtocol::SSLv3;
+            }
+            break;
+          case 79923350:
+            if (name == "TLSv1")
+            {
+              return SslProtocol::TLSv1;
+            }
+            break;
+          case -503070503:
+            if (name == "TLSv1.1")
+            {
+              return SslProtocol::TLSv1_1;
+            }
+            break;
+          case -503070502:
+            if (name == "TLSv1.2")
+            {
+              return SslProtocol::TLSv1_2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return SslProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForSslProtocol(SslProtocol enumValue)
+        const char* GetNameForSslProtocolCStr(SslProtocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SslProtocol::SSLv3:
-            return "SSLv3";
-          case SslProtocol::TLSv1:
-            return "TLSv1";
-          case SslProtocol::TLSv1_1:
-            return "TLSv1.1";
-          case SslProtocol::TLSv1_2:
-            return "TLSv1.2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSslProtocol(SslProtocol enumValue)
+        {
+          return GetNameForSslProtocolCStr(enumValue);
         }
 
       } // namespace SslProtocolMapper
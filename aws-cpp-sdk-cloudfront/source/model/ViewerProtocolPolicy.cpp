@@ -30,25 +30,44 @@ namespace Aws
       namespace ViewerProtocolPolicyMapper
       {
 
-        static const int allow_all_HASH = HashingUtils::HashString("allow-all");
-        static const int https_only_HASH = HashingUtils::HashString("https-only");
-        static const int redirect_to_https_HASH = HashingUtils::HashString("redirect-to-https");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "allow-all",
+          "https-only",
+          "redirect-to-https",
+        };
 
         ViewerProtocolPolicy GetViewerProtocolPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == allow_all_HASH)
-          {
-            return ViewerProtocolPolicy::allow_all;
-          }
-          else if (hashCode == https_only_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ViewerProtocolPolicy::https_only;
-          }
-          else if (hashCode == redirect_to_https_HASH)
-          {
-            return ViewerProtocolPolicy::redirect_to_https;
+          case 370853149:
+            if (name == "allow-all")
+            {
+              return ViewerProtocolPolicy::allow_all;
+            }
+            break;
+          case 1787171662:
+            if (name == "https-only")
+            {
+              return ViewerProtocolPolicy::https_only;
+            }
+            break;
+          case -1851537942:
+            if (name == "redirect-to-https")
+            {
+              return ViewerProtocolPolicy::redirect_to_https;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ViewerProtocolPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForViewerProtocolPolicy(ViewerProtocolPolicy enumValue)
+        const char* GetNameForViewerProtocolPolicyCStr(ViewerProtocolPolicy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ViewerProtocolPolicy::allow_all:
-            return "allow-all";
-          case ViewerProtocolPolicy::https_only:
-            return "https-only";
-          case ViewerProtocolPolicy::redirect_to_https:
-            return "redirect-to-https";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForViewerProtocolPolicy(ViewerProtocolPolicy enumValue)
+        {
+          return GetNameForViewerProtocolPolicyCStr(enumValue);
         }
 
       } // namespace ViewerProtocolPolicyMapper
@@ -35,6 +35,11 @@ namespace ClientVersionMapper
 AWS_CLOUDHSM_API ClientVersion GetClientVersionForName(const Aws::String& name);
 
 AWS_CLOUDHSM_API Aws::String GetNameForClientVersion(ClientVersion value);
+
+/**
+ * Same as GetNameForClientVersion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDHSM_API const char* GetNameForClientVersionCStr(ClientVersion value);
 } // namespace ClientVersionMapper
 } // namespace Model
 } // namespace CloudHSM
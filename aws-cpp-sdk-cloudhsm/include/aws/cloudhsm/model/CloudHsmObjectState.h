@@ -36,6 +36,11 @@ namespace CloudHsmObjectStateMapper
 AWS_CLOUDHSM_API CloudHsmObjectState GetCloudHsmObjectStateForName(const Aws::String& name);
 
 AWS_CLOUDHSM_API Aws::String GetNameForCloudHsmObjectState(CloudHsmObjectState value);
+
+/**
+ * Same as GetNameForCloudHsmObjectState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDHSM_API const char* GetNameForCloudHsmObjectStateCStr(CloudHsmObjectState value);
 } // namespace CloudHsmObjectStateMapper
 } // namespace Model
 } // namespace CloudHSM
@@ -40,6 +40,11 @@ namespace HsmStatusMapper
 AWS_CLOUDHSM_API HsmStatus GetHsmStatusForName(const Aws::String& name);
 
 AWS_CLOUDHSM_API Aws::String GetNameForHsmStatus(HsmStatus value);
+
+/**
+ * Same as GetNameForHsmStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDHSM_API const char* GetNameForHsmStatusCStr(HsmStatus value);
 } // namespace HsmStatusMapper
 } // namespace Model
 } // namespace CloudHSM
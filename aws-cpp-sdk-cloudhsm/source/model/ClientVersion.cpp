@@ -30,20 +30,37 @@ namespace Aws
       namespace ClientVersionMapper
       {
 
-        static const int _5_1_HASH = HashingUtils::HashString("5.1");
-        static const int _5_3_HASH = HashingUtils::HashString("5.3");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "5.1",
+          "5.3",
+        };
 
         ClientVersion GetClientVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == _5_1_HASH)
-          {
-            return ClientVersion::_5_1;
-          }
-          else if (hashCode == _5_3_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClientVersion::_5_3;
+          case 52408:
+            if (name == "5.1")
+            {
+              return ClientVersion::_5_1;
+            }
+            break;
+          case 52410:
+            if (name == "5.3")
+            {
+              return ClientVersion::_5_3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ClientVersion::NOT_SET;
         }
 
-        Aws::String GetNameForClientVersion(ClientVersion enumValue)
+        const char* GetNameForClientVersionCStr(ClientVersion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClientVersion::_5_1:
-            return "5.1";
-          case ClientVersion::_5_3:
-            return "5.3";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClientVersion(ClientVersion enumValue)
+        {
+          return GetNameForClientVersionCStr(enumValue);
         }
 
       } // namespace ClientVersionMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace CloudHsmObjectStateMapper
       {
 
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DEGRADED_HASH = HashingUtils::HashString("DEGRADED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "READY",
+          "UPDATING",
+          "DEGRADED",
+        };
 
         CloudHsmObjectState GetCloudHsmObjectStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == READY_HASH)
-          {
-            return CloudHsmObjectState::READY;
-          }
-          else if (hashCode == UPDATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CloudHsmObjectState::UPDATING;
-          }
-          else if (hashCode == DEGRADED_HASH)
-          {
-            return CloudHsmObjectState::DEGRADED;
+          case 77848963:
+            if (name == "READY")
+            {
+              return CloudHsmObjectState::READY;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return CloudHsmObjectState::UPDATING;
+            }
+            break;
+          case 1470632750:
+            if (name == "DEGRADED")
+            {
+              return CloudHsmObjectState::DEGRADED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return CloudHsmObjectState::NOT_SET;
         }
 
-        Aws::String GetNameForCloudHsmObjectState(CloudHsmObjectState enumValue)
+        const char* GetNameForCloudHsmObjectStateCStr(CloudHsmObjectState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CloudHsmObjectState::READY:
-            return "READY";
-          case CloudHsmObjectState::UPDATING:
-            return "UPDATING";
-          case CloudHsmObjectState::DEGRADED:
-            return "DEGRADED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCloudHsmObjectState(CloudHsmObjectState enumValue)
+        {
+          return GetNameForCloudHsmObjectStateCStr(enumValue);
         }
 
       } // namespace CloudHsmObjectStateMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace HsmStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int DEGRADED_HASH = HashingUtils::HashString("DEGRADED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "RUNNING",
+          "UPDATING",
+          "SUSPENDED",
+          "TERMINATING",
+          "TERMINATED",
+          "DEGRADED",
+        };
 
         HsmStatus GetHsmStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return HsmStatus::PENDING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return HsmStatus::RUNNING;
-          }
-          else if (hashCode == UPDATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HsmStatus::UPDATING;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
-            return HsmStatus::SUSPENDED;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return HsmStatus::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return HsmStatus::TERMINATED;
-          }
-          else if (hashCode == DEGRADED_HASH)
-          {
-            return HsmStatus::DEGRADED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return HsmStatus::PENDING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return HsmStatus::RUNNING;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return HsmStatus::UPDATING;
+            }
+            break;
+          case 1124965819:
+            if (name == "SUSPENDED")
+            {
+              return HsmStatus::SUSPENDED;
+            }
+            break;
+          case 234379966:
+            if (name == "TERMINATING")
+            {
+              return HsmStatus::TERMINATING;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return HsmStatus::TERMINATED;
+            }
+            break;
+          case 1470632750:
+            if (name == "DEGRADED")
+            {
+              return HsmStatus::DEGRADED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return HsmStatus::NOT_SET;
         }
 
-        Aws::String GetNameForHsmStatus(HsmStatus enumValue)
+        const char* GetNameForHsmStatusCStr(HsmStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HsmStatus::PENDING:
-            return "PENDING";
-          case HsmStatus::RUNNING:
-            return "RUNNING";
-          case HsmStatus::UPDATING:
-            return "UPDATING";
-          case HsmStatus::SUSPENDED:
-            return "SUSPENDED";
-          case HsmStatus::TERMINATING:
-            return "TERMINATING";
-          case HsmStatus::TERMINATED:
-            return "TERMINATED";
-          case HsmStatus::DEGRADED:
-            return "DEGRADED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHsmStatus(HsmStatus enumValue)
+        {
+          return GetNameForHsmStatusCStr(enumValue);
         }
 
       } // namespace HsmStatusMapper
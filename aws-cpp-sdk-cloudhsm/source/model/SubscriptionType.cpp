@@ -30,15 +30,30 @@ namespace Aws
       namespace SubscriptionTypeMapper
       {
 
-        static const int PRODUCTION_HASH = HashingUtils::HashString("PRODUCTION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PRODUCTION",
+        };
 
         SubscriptionType GetSubscriptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRODUCTION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SubscriptionType::PRODUCTION;
+          case -2056856391:
+            if (name == "PRODUCTION")
+            {
+              return SubscriptionType::PRODUCTION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return SubscriptionType::NOT_SET;
         }
 
-        Aws::String GetNameForSubscriptionType(SubscriptionType enumValue)
+        const char* GetNameForSubscriptionTypeCStr(SubscriptionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SubscriptionType::PRODUCTION:
-            return "PRODUCTION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSubscriptionType(SubscriptionType enumValue)
+        {
+          return GetNameForSubscriptionTypeCStr(enumValue);
         }
 
       } // namespace SubscriptionTypeMapper
@@ -34,6 +34,11 @@ namespace BackupPolicyMapper
 AWS_CLOUDHSMV2_API BackupPolicy GetBackupPolicyForName(const Aws::String& name);
 
 AWS_CLOUDHSMV2_API Aws::String GetNameForBackupPolicy(BackupPolicy value);
+
+/**
+ * Same as GetNameForBackupPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDHSMV2_API const char* GetNameForBackupPolicyCStr(BackupPolicy value);
 } // namespace BackupPolicyMapper
 } // namespace Model
 } // namespace CloudHSMV2
@@ -37,6 +37,11 @@ namespace BackupStateMapper
 AWS_CLOUDHSMV2_API BackupState GetBackupStateForName(const Aws::String& name);
 
 AWS_CLOUDHSMV2_API Aws::String GetNameForBackupState(BackupState value);
+
+/**
+ * Same as GetNameForBackupState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDHSMV2_API const char* GetNameForBackupStateCStr(BackupState value);
 } // namespace BackupStateMapper
 } // namespace Model
 } // namespace CloudHSMV2
@@ -42,6 +42,11 @@ namespace ClusterStateMapper
 AWS_CLOUDHSMV2_API ClusterState GetClusterStateForName(const Aws::String& name);
 
 AWS_CLOUDHSMV2_API Aws::String GetNameForClusterState(ClusterState value);
+
+/**
+ * Same as GetNameForClusterState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDHSMV2_API const char* GetNameForClusterStateCStr(ClusterState value);
 } // namespace ClusterStateMapper
 } // namespace Model
 } // namespace CloudHSMV2
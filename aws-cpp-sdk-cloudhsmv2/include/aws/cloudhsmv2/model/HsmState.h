@@ -38,6 +38,11 @@ namespace HsmStateMapper
 AWS_CLOUDHSMV2_API HsmState GetHsmStateForName(const Aws::String& name);
 
 AWS_CLOUDHSMV2_API Aws::String GetNameForHsmState(HsmState value);
+
+/**
+ * Same as GetNameForHsmState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDHSMV2_API const char* GetNameForHsmStateCStr(HsmState value);
 } // namespace HsmStateMapper
 } // namespace Model
 } // namespace CloudHSMV2
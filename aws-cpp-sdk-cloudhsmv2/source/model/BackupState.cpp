@@ -30,30 +30,51 @@ namespace Aws
       namespace BackupStateMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int PENDING_DELETION_HASH = HashingUtils::HashString("PENDING_DELETION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE_IN_PROGRESS",
+          "READY",
+          "DELETED",
+          "PENDING_DELETION",
+        };
 
         BackupState GetBackupStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
-          {
-            return BackupState::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return BackupState::READY;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return BackupState::DELETED;
-          }
-          else if (hashCode == PENDING_DELETION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BackupState::PENDING_DELETION;
+          case 43560260:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return BackupState::CREATE_IN_PROGRESS;
+            }
+            break;
+          case 77848963:
+            if (name == "READY")
+            {
+              return BackupState::READY;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return BackupState::DELETED;
+            }
+            break;
+          case -1766447722:
+            if (name == "PENDING_DELETION")
+            {
+              return BackupState::PENDING_DELETION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return BackupState::NOT_SET;
         }
 
-        Aws::String GetNameForBackupState(BackupState enumValue)
+        const char* GetNameForBackupStateCStr(BackupState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BackupState::CREATE_IN_PROGRESS:
-            return "CREATE_IN_PROGRESS";
-          case BackupState::READY:
-            return "READY";
-          case BackupState::DELETED:
-            return "DELETED";
-          case BackupState::PENDING_DELETION:
-            return "PENDING_DELETION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBackupState(BackupState enumValue)
+        {
+          return GetNameForBackupStateCStr(enumValue);
         }
 
       } // namespace BackupStateMapper
@@ -30,55 +30,86 @@ namespace Aws
       namespace ClusterStateMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int UNINITIALIZED_HASH = HashingUtils::HashString("UNINITIALIZED");
-        static const int INITIALIZE_IN_PROGRESS_HASH = HashingUtils::HashString("INITIALIZE_IN_PROGRESS");
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int UPDATE_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_IN_PROGRESS");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int DEGRADED_HASH = HashingUtils::HashString("DEGRADED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE_IN_PROGRESS",
+          "UNINITIALIZED",
+          "INITIALIZE_IN_PROGRESS",
+          "INITIALIZED",
+          "ACTIVE",
+          "UPDATE_IN_PROGRESS",
+          "DELETE_IN_PROGRESS",
+          "DELETED",
+          "DEGRADED",
+        };
 
         ClusterState GetClusterStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
-          {
-            return ClusterState::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == UNINITIALIZED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClusterState::UNINITIALIZED;
-          }
-          else if (hashCode == INITIALIZE_IN_PROGRESS_HASH)
-          {
-            return ClusterState::INITIALIZE_IN_PROGRESS;
-          }
-          else if (hashCode == INITIALIZED_HASH)
-          {
-            return ClusterState::INITIALIZED;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return ClusterState::ACTIVE;
-          }
-          else if (hashCode == UPDATE_IN_PROGRESS_HASH)
-          {
-            return ClusterState::UPDATE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
-            return ClusterState::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ClusterState::DELETED;
-          }
-          else if (hashCode == DEGRADED_HASH)
-          {
-            return ClusterState::DEGRADED;
+          case 43560260:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return ClusterState::CREATE_IN_PROGRESS;
+            }
+            break;
+          case 1401079419:
+            if (name == "UNINITIALIZED")
+            {
+              return ClusterState::UNINITIALIZED;
+            }
+            break;
+          case 1133679064:
+            if (name == "INITIALIZE_IN_PROGRESS")
+            {
+              return ClusterState::INITIALIZE_IN_PROGRESS;
+            }
+            break;
+          case -907986252:
+            if (name == "INITIALIZED")
+            {
+              return ClusterState::INITIALIZED;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ClusterState::ACTIVE;
+            }
+            break;
+          case 1375009169:
+            if (name == "UPDATE_IN_PROGRESS")
+            {
+              return ClusterState::UPDATE_IN_PROGRESS;
+            }
+            break;
+          case 1089799027:
+            if (name == "DELETE_IN_PROGRESS")
+            {
+              return ClusterState::DELETE_IN_PROGRESS;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return ClusterState::DELETED;
+            }
+            break;
+          case 1470632750:
+            if (name == "DEGRADED")
+            {
+              return ClusterState::DEGRADED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return ClusterState::NOT_SET;
         }
 
-        Aws::String GetNameForClusterState(ClusterState enumValue)
+        const char* GetNameForClusterStateCStr(ClusterState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClusterState::CREATE_IN_PROGRESS:
-            return "CREATE_IN_PROGRESS";
-          case ClusterState::UNINITIALIZED:
-            return "UNINITIALIZED";
-          case ClusterState::INITIALIZE_IN_PROGRESS:
-            return "INITIALIZE_IN_PROGRESS";
-          case ClusterState::INITIALIZED:
-            return "INITIALIZED";
-          case ClusterState::ACTIVE:
-            return "ACTIVE";
-          case ClusterState::UPDATE_IN_PROGRESS:
-            return "UPDATE_IN_PROGRESS";
-          case ClusterState::DELETE_IN_PROGRESS:
-            return "DELETE_IN_PROGRESS";
-          case ClusterState::DELETED:
-            return "DELETED";
-          case ClusterState::DEGRADED:
-            return "DEGRADED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClusterState(ClusterState enumValue)
+        {
+          return GetNameForClusterStateCStr(enumValue);
         }
 
       } // namespace ClusterStateMapper
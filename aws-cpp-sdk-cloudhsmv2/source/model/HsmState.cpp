@@ -30,35 +30,58 @@ namespace Aws
       namespace HsmStateMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DEGRADED_HASH = HashingUtils::HashString("DEGRADED");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE_IN_PROGRESS",
+          "ACTIVE",
+          "DEGRADED",
+          "DELETE_IN_PROGRESS",
+          "DELETED",
+        };
 
         HsmState GetHsmStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HsmState::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return HsmState::ACTIVE;
-          }
-          else if (hashCode == DEGRADED_HASH)
-          {
-            return HsmState::DEGRADED;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
-            return HsmState::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return HsmState::DELETED;
+          case 43560260:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return HsmState::CREATE_IN_PROGRESS;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return HsmState::ACTIVE;
+            }
+            break;
+          case 1470632750:
+            if (name == "DEGRADED")
+            {
+              return HsmState::DEGRADED;
+            }
+            break;
+          case 1089799027:
+            if (name == "DELETE_IN_PROGRESS")
+            {
+              return HsmState::DELETE_IN_PROGRESS;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return HsmState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return HsmState::NOT_SET;
         }
 
-        Aws::String GetNameForHsmState(HsmState enumValue)
+        const char* GetNameForHsmStateCStr(HsmState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HsmState::CREATE_IN_PROGRESS:
-            return "CREATE_IN_PROGRESS";
-          case HsmState::ACTIVE:
-            return "ACTIVE";
-          case HsmState::DEGRADED:
-            return "DEGRADED";
-          case HsmState::DELETE_IN_PROGRESS:
-            return "DELETE_IN_PROGRESS";
-          case HsmState::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHsmState(HsmState enumValue)
+        {
+          return GetNameForHsmStateCStr(enumValue);
         }
 
       } // namespace HsmStateMapper
@@ -37,6 +37,11 @@ namespace AlgorithmicStemmingMapper
 AWS_CLOUDSEARCH_API AlgorithmicStemming GetAlgorithmicStemmingForName(const Aws::String& name);
 
 AWS_CLOUDSEARCH_API Aws::String GetNameForAlgorithmicStemming(AlgorithmicStemming value);
+
+/**
+ * Same as GetNameForAlgorithmicStemming(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDSEARCH_API const char* GetNameForAlgorithmicStemmingCStr(AlgorithmicStemming value);
 } // namespace AlgorithmicStemmingMapper
 } // namespace Model
 } // namespace CloudSearch
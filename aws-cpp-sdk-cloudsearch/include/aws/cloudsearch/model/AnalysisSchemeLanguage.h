@@ -68,6 +68,11 @@ namespace AnalysisSchemeLanguageMapper
 AWS_CLOUDSEARCH_API AnalysisSchemeLanguage GetAnalysisSchemeLanguageForName(const Aws::String& name);
 
 AWS_CLOUDSEARCH_API Aws::String GetNameForAnalysisSchemeLanguage(AnalysisSchemeLanguage value);
+
+/**
+ * Same as GetNameForAnalysisSchemeLanguage(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDSEARCH_API const char* GetNameForAnalysisSchemeLanguageCStr(AnalysisSchemeLanguage value);
 } // namespace AnalysisSchemeLanguageMapper
 } // namespace Model
 } // namespace CloudSearch
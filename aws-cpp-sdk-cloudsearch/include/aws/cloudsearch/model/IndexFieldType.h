@@ -44,6 +44,11 @@ namespace IndexFieldTypeMapper
 AWS_CLOUDSEARCH_API IndexFieldType GetIndexFieldTypeForName(const Aws::String& name);
 
 AWS_CLOUDSEARCH_API Aws::String GetNameForIndexFieldType(IndexFieldType value);
+
+/**
+ * Same as GetNameForIndexFieldType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDSEARCH_API const char* GetNameForIndexFieldTypeCStr(IndexFieldType value);
 } // namespace IndexFieldTypeMapper
 } // namespace Model
 } // namespace CloudSearch
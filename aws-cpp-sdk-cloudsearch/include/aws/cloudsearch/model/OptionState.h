@@ -37,6 +37,11 @@ namespace OptionStateMapper
 AWS_CLOUDSEARCH_API OptionState GetOptionStateForName(const Aws::String& name);
 
 AWS_CLOUDSEARCH_API Aws::String GetNameForOptionState(OptionState value);
+
+/**
+ * Same as GetNameForOptionState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDSEARCH_API const char* GetNameForOptionStateCStr(OptionState value);
 } // namespace OptionStateMapper
 } // namespace Model
 } // namespace CloudSearch
@@ -41,6 +41,11 @@ namespace PartitionInstanceTypeMapper
 AWS_CLOUDSEARCH_API PartitionInstanceType GetPartitionInstanceTypeForName(const Aws::String& name);
 
 AWS_CLOUDSEARCH_API Aws::String GetNameForPartitionInstanceType(PartitionInstanceType value);
+
+/**
+ * Same as GetNameForPartitionInstanceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDSEARCH_API const char* GetNameForPartitionInstanceTypeCStr(PartitionInstanceType value);
 } // namespace PartitionInstanceTypeMapper
 } // namespace Model
 } // namespace CloudSearch
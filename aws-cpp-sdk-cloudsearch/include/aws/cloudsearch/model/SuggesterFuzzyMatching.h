@@ -36,6 +36,11 @@ namespace SuggesterFuzzyMatchingMapper
 AWS_CLOUDSEARCH_API SuggesterFuzzyMatching GetSuggesterFuzzyMatchingForName(const Aws::String& name);
 
 AWS_CLOUDSEARCH_API Aws::String GetNameForSuggesterFuzzyMatching(SuggesterFuzzyMatching value);
+
+/**
+ * Same as GetNameForSuggesterFuzzyMatching(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDSEARCH_API const char* GetNameForSuggesterFuzzyMatchingCStr(SuggesterFuzzyMatching value);
 } // namespace SuggesterFuzzyMatchingMapper
 } // namespace Model
 } // namespace CloudSearch
@@ -30,30 +30,51 @@ namespace Aws
       namespace AlgorithmicStemmingMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int minimal_HASH = HashingUtils::HashString("minimal");
-        static const int light_HASH = HashingUtils::HashString("light");
-        static const int full_HASH = HashingUtils::HashString("full");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "none",
+          "minimal",
+          "light",
+          "full",
+        };
 
         AlgorithmicStemming GetAlgorithmicStemmingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
-          {
-            return AlgorithmicStemming::none;
-          }
-          else if (hashCode == minimal_HASH)
-          {
-            return AlgorithmicStemming::minimal;
-          }
-          else if (hashCode == light_HASH)
-          {
-            return AlgorithmicStemming::light;
-          }
-          else if (hashCode == full_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AlgorithmicStemming::full;
+          case 3387192:
+            if (name == "none")
+            {
+              return AlgorithmicStemming::none;
+            }
+            break;
+          case 1064537505:
+            if (name == "minimal")
+            {
+              return AlgorithmicStemming::minimal;
+            }
+            break;
+          case 102970646:
+            if (name == "light")
+            {
+              return AlgorithmicStemming::light;
+            }
+            break;
+          case 3154575:
+            if (name == "full")
+            {
+              return AlgorithmicStemming::full;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AlgorithmicStemming::NOT_SET;
         }
 
-        Aws::String GetNameForAlgorithmicStemming(AlgorithmicStemming enumValue)
+        const char* GetNameForAlgorithmicStemmingCStr(AlgorithmicStemming enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AlgorithmicStemming::none:
-            return "none";
-          case AlgorithmicStemming::minimal:
-            return "minimal";
-          case AlgorithmicStemming::light:
-            return "light";
-          case AlgorithmicStemming::full:
-            return "full";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAlgorithmicStemming(AlgorithmicStemming enumValue)
+        {
+          return GetNameForAlgorithmicStemmingCStr(enumValue);
         }
 
       } // namespace AlgorithmicStemmingMapper
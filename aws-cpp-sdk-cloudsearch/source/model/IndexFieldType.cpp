@@ -30,65 +30,100 @@ namespace Aws
       namespace IndexFieldTypeMapper
       {
 
-        static const int int__HASH = HashingUtils::HashString("int");
-        static const int double__HASH = HashingUtils::HashString("double");
-        static const int literal_HASH = HashingUtils::HashString("literal");
-        static const int text_HASH = HashingUtils::HashString("text");
-        static const int date_HASH = HashingUtils::HashString("date");
-        static const int latlon_HASH = HashingUtils::HashString("latlon");
-        static const int int_array_HASH = HashingUtils::HashString("int-array");
-        static const int double_array_HASH = HashingUtils::HashString("double-array");
-        static const int literal_array_HASH = HashingUtils::HashString("literal-array");
-        static const int text_array_HASH = HashingUtils::HashString("text-array");
-        static const int date_array_HASH = HashingUtils::HashString("date-array");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "int",
+          "double",
+          "literal",
+          "text",
+          "date",
+          "latlon",
+          "int-array",
+          "double-array",
+          "literal-array",
+          "text-array",
+          "date-array",
+        };
 
         IndexFieldType GetIndexFieldTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == int__HASH)
-          {
-            return IndexFieldType::int_;
-          }
-          else if (hashCode == double__HASH)
-          {
-            return IndexFieldType::double_;
-          }
-          else if (hashCode == literal_HASH)
-          {
-            return IndexFieldType::literal;
-          }
-          else if (hashCode == text_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IndexFieldType::text;
-          }
-          else if (hashCode == date_HASH)
-          {
-            return IndexFieldType::date;
-          }
-          else if (hashCode == latlon_HASH)
-          {
-            return IndexFieldType::latlon;
-          }
-          else if (hashCode == int_array_HASH)
-          {
-            return IndexFieldType::int_array;
-          }
-          else if (hashCode == double_array_HASH)
-          {
-            return IndexFieldType::double_array;
-          }
-          else if (hashCode == literal_array_HASH)
-          {
-            return IndexFieldType::literal_array;
-          }
-          else if (hashCode == text_array_HASH)
-          {
-            return IndexFieldType::text_array;
-          }
-          else if (hashCode == date_array_HASH)
-          {
-            return IndexFieldType::date_array;
+          case 104431:
+            if (name == "int")
+            {
+              return IndexFieldType::int_;
+            }
+            break;
+          case -1325958191:
+            if (name == "double")
+            {
+              return IndexFieldType::double_;
+            }
+            break;
+          case 182460591:
+            if (name == "literal")
+            {
+              return IndexFieldType::literal;
+            }
+            break;
+          case 3556653:
+            if (name == "text")
+            {
+              return IndexFieldType::text;
+            }
+            break;
+          case 3076014:
+            if (name == "date")
+            {
+              return IndexFieldType::date;
+            }
+            break;
+          case -1109874356:
+            if (name == "latlon")
+            {
+              return IndexFieldType::latlon;
+            }
+            break;
+          case -1115934981:
+            if (name == "int-array")
+            {
+              return IndexFieldType::int_array;
+            }
+            break;
+          case -58973859:
+            if (name == "double-array")
+            {
+              return IndexFieldType::double_array;
+            }
+            break;
+          case -1509873733:
+            if (name == "literal-array")
+            {
+              return IndexFieldType::literal_array;
+            }
+            break;
+          case 746419641:
+            if (name == "text-array")
+            {
+              return IndexFieldType::text_array;
+            }
+            break;
+          case -573408390:
+            if (name == "date-array")
+            {
+              return IndexFieldType::date_array;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return IndexFieldType::NOT_SET;
         }
 
-        Aws::String GetNameForIndexFieldType(IndexFieldType enumValue)
+        const char* GetNameForIndexFieldTypeCStr(IndexFieldType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IndexFieldType::int_:
-            return "int";
-          case IndexFieldType::double_:
-            return "double";
-          case IndexFieldType::literal:
-            return "literal";
-          case IndexFieldType::text:
-            return "text";
-          case IndexFieldType::date:
-            return "date";
-          case IndexFieldType::latlon:
-            return "latlon";
-          case IndexFieldType::int_array:
-            return "int-array";
-          case IndexFieldType::double_array:
-            return "double-array";
-          case IndexFieldType::literal_array:
-            return "literal-array";
-          case IndexFieldType::text_array:
-            return "text-array";
-          case IndexFieldType::date_array:
-            return "date-array";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIndexFieldType(IndexFieldType enumValue)
+        {
+          return GetNameForIndexFieldTypeCStr(enumValue);
         }
 
       } // namespace IndexFieldTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace OptionStateMapper
       {
 
-        static const int RequiresIndexDocuments_HASH = HashingUtils::HashString("RequiresIndexDocuments");
-        static const int Processing_HASH = HashingUtils::HashString("Processing");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int FailedToValidate_HASH = HashingUtils::HashString("FailedToValidate");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RequiresIndexDocuments",
+          "Processing",
+          "Active",
+          "FailedToValidate",
+        };
 
         OptionState GetOptionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RequiresIndexDocuments_HASH)
-          {
-            return OptionState::RequiresIndexDocuments;
-          }
-          else if (hashCode == Processing_HASH)
-          {
-            return OptionState::Processing;
-          }
-          else if (hashCode == Active_HASH)
-          {
-            return OptionState::Active;
-          }
-          else if (hashCode == FailedToValidate_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OptionState::FailedToValidate;
+          case 173781364:
+            if (name == "RequiresIndexDocuments")
+            {
+              return OptionState::RequiresIndexDocuments;
+            }
+            break;
+          case -1879307469:
+            if (name == "Processing")
+            {
+              return OptionState::Processing;
+            }
+            break;
+          case 1955883814:
+            if (name == "Active")
+            {
+              return OptionState::Active;
+            }
+            break;
+          case 1352215790:
+            if (name == "FailedToValidate")
+            {
+              return OptionState::FailedToValidate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return OptionState::NOT_SET;
         }
 
-        Aws::String GetNameForOptionState(OptionState enumValue)
+        const char* GetNameForOptionStateCStr(OptionState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OptionState::RequiresIndexDocuments:
-            return "RequiresIndexDocuments";
-          case OptionState::Processing:
-            return "Processing";
-          case OptionState::Active:
-            return "Active";
-          case OptionState::FailedToValidate:
-            return "FailedToValidate";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOptionState(OptionState enumValue)
+        {
+          return GetNameForOptionStateCStr(enumValue);
         }
 
       } // namespace OptionStateMapper
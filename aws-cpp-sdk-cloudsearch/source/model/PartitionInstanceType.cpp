@@ -30,50 +30,79 @@ namespace Aws
       namespace PartitionInstanceTypeMapper
       {
 
-        static const int search_m1_small_HASH = HashingUtils::HashString("search.m1.small");
-        static const int search_m1_large_HASH = HashingUtils::HashString("search.m1.large");
-        static const int search_m2_xlarge_HASH = HashingUtils::HashString("search.m2.xlarge");
-        static const int search_m2_2xlarge_HASH = HashingUtils::HashString("search.m2.2xlarge");
-        static const int search_m3_medium_HASH = HashingUtils::HashString("search.m3.medium");
-        static const int search_m3_large_HASH = HashingUtils::HashString("search.m3.large");
-        static const int search_m3_xlarge_HASH = HashingUtils::HashString("search.m3.xlarge");
-        static const int search_m3_2xlarge_HASH = HashingUtils::HashString("search.m3.2xlarge");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "search.m1.small",
+          "search.m1.large",
+          "search.m2.xlarge",
+          "search.m2.2xlarge",
+          "search.m3.medium",
+          "search.m3.large",
+          "search.m3.xlarge",
+          "search.m3.2xlarge",
+        };
 
         PartitionInstanceType GetPartitionInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == search_m1_small_HASH)
-          {
-            return PartitionInstanceType::search_m1_small;
-          }
-          else if (hashCode == search_m1_large_HASH)
-          {
-            return PartitionInstanceType::search_m1_large;
-          }
-          else if (hashCode == search_m2_xlarge_HASH)
-          {
-            return PartitionInstanceType::search_m2_xlarge;
-          }
-          else if (hashCode == search_m2_2xlarge_HASH)
-          {
-            return PartitionInstanceType::search_m2_2xlarge;
-          }
-          else if (hashCode == search_m3_medium_HASH)
-          {
-            return PartitionInstanceType::search_m3_medium;
-          }
-          else if (hashCode == search_m3_large_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PartitionInstanceType::search_m3_large;
-          }
-          else if (hashCode == search_m3_xlarge_HASH)
-          {
-            return PartitionInstanceType::search_m3_xlarge;
-          }
-          else if (hashCode == search_m3_2xlarge_HASH)
-          {
-            return PartitionInstanceType::search_m3_2xlarge;
+          case 1834835331:
+            if (name == "search.m1.small")
+            {
+              return PartitionInstanceType::search_m1_small;
+            }
+            break;
+          case 1828029367:
+            if (name == "search.m1.large")
+            {
+              return PartitionInstanceType::search_m1_large;
+            }
+            break;
+          case -1364608602:
+            if (name == "search.m2.xlarge")
+            {
+              return PartitionInstanceType::search_m2_xlarge;
+            }
+            break;
+          case -995696398:
+            if (name == "search.m2.2xlarge")
+            {
+              return PartitionInstanceType::search_m2_2xlarge;
+            }
+            break;
+          case 56897591:
+            if (name == "search.m3.medium")
+            {
+              return PartitionInstanceType::search_m3_medium;
+            }
+            break;
+          case -691930567:
+            if (name == "search.m3.large")
+            {
+              return PartitionInstanceType::search_m3_large;
+            }
+            break;
+          case 378201733:
+            if (name == "search.m3.xlarge")
+            {
+              return PartitionInstanceType::search_m3_xlarge;
+            }
+            break;
+          case 1491816435:
+            if (name == "search.m3.2xlarge")
+            {
+              return PartitionInstanceType::search_m3_2xlarge;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return PartitionInstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForPartitionInstanceType(PartitionInstanceType enumValue)
+        const char* GetNameForPartitionInstanceTypeCStr(PartitionInstanceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PartitionInstanceType::search_m1_small:
-            return "search.m1.small";
-          case PartitionInstanceType::search_m1_large:
-            return "search.m1.large";
-          case PartitionInstanceType::search_m2_xlarge:
-            return "search.m2.xlarge";
-          case PartitionInstanceType::search_m2_2xlarge:
-            return "search.m2.2xlarge";
-          case PartitionInstanceType::search_m3_medium:
-            return "search.m3.medium";
-          case PartitionInstanceType::search_m3_large:
-            return "search.m3.large";
-          case PartitionInstanceType::search_m3_xlarge:
-            return "search.m3.xlarge";
-          case PartitionInstanceType::search_m3_2xlarge:
-            return "search.m3.2xlarge";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPartitionInstanceType(PartitionInstanceType enumValue)
+        {
+          return GetNameForPartitionInstanceTypeCStr(enumValue);
         }
 
       } // namespace PartitionInstanceTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace SuggesterFuzzyMatchingMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int low_HASH = HashingUtils::HashString("low");
-        static const int high_HASH = HashingUtils::HashString("high");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "none",
+          "low",
+          "high",
+        };
 
         SuggesterFuzzyMatching GetSuggesterFuzzyMatchingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
-          {
-            return SuggesterFuzzyMatching::none;
-          }
-          else if (hashCode == low_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SuggesterFuzzyMatching::low;
-          }
-          else if (hashCode == high_HASH)
-          {
-            return SuggesterFuzzyMatching::high;
+          case 3387192:
+            if (name == "none")
+            {
+              return SuggesterFuzzyMatching::none;
+            }
+            break;
+          case 107348:
+            if (name == "low")
+            {
+              return SuggesterFuzzyMatching::low;
+            }
+            break;
+          case 3202466:
+            if (name == "high")
+            {
+              return SuggesterFuzzyMatching::high;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SuggesterFuzzyMatching::NOT_SET;
         }
 
-        Aws::String GetNameForSuggesterFuzzyMatching(SuggesterFuzzyMatching enumValue)
+        const char* GetNameForSuggesterFuzzyMatchingCStr(SuggesterFuzzyMatching enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SuggesterFuzzyMatching::none:
-            return "none";
-          case SuggesterFuzzyMatching::low:
-            return "low";
-          case SuggesterFuzzyMatching::high:
-            return "high";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSuggesterFuzzyMatching(SuggesterFuzzyMatching enumValue)
+        {
+          return GetNameForSuggesterFuzzyMatchingCStr(enumValue);
         }
 
       } // namespace SuggesterFuzzyMatchingMapper
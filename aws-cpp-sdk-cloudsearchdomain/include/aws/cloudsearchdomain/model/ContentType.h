@@ -35,6 +35,11 @@ namespace ContentTypeMapper
 AWS_CLOUDSEARCHDOMAIN_API ContentType GetContentTypeForName(const Aws::String& name);
 
 AWS_CLOUDSEARCHDOMAIN_API Aws::String GetNameForContentType(ContentType value);
+
+/**
+ * Same as GetNameForContentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDSEARCHDOMAIN_API const char* GetNameForContentTypeCStr(ContentType value);
 } // namespace ContentTypeMapper
 } // namespace Model
 } // namespace CloudSearchDomain
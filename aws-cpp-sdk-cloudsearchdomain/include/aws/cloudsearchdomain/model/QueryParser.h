@@ -37,6 +37,11 @@ namespace QueryParserMapper
 AWS_CLOUDSEARCHDOMAIN_API QueryParser GetQueryParserForName(const Aws::String& name);
 
 AWS_CLOUDSEARCHDOMAIN_API Aws::String GetNameForQueryParser(QueryParser value);
+
+/**
+ * Same as GetNameForQueryParser(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDSEARCHDOMAIN_API const char* GetNameForQueryParserCStr(QueryParser value);
 } // namespace QueryParserMapper
 } // namespace Model
 } // namespace CloudSearchDomain
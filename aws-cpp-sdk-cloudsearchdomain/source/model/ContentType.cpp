@@ -30,20 +30,37 @@ namespace Aws
       namespace ContentTypeMapper
       {
 
-        static const int application_json_HASH = HashingUtils::HashString("application/json");
-        static const int application_xml_HASH = HashingUtils::HashString("application/xml");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "application/json",
+          "application/xml",
+        };
 
         ContentType GetContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == application_json_HASH)
-          {
-            return ContentType::application_json;
-          }
-          else if (hashCode == application_xml_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContentType::application_xml;
+          case -43840953:
+            if (name == "application/json")
+            {
+              return ContentType::application_json;
+            }
+            break;
+          case -1248326952:
+            if (name == "application/xml")
+            {
+              return ContentType::application_xml;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ContentType::NOT_SET;
         }
 
-        Aws::String GetNameForContentType(ContentType enumValue)
+        const char* GetNameForContentTypeCStr(ContentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContentType::application_json:
-            return "application/json";
-          case ContentType::application_xml:
-            return "application/xml";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContentType(ContentType enumValue)
+        {
+          return GetNameForContentTypeCStr(enumValue);
         }
 
       } // namespace ContentTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace QueryParserMapper
       {
 
-        static const int simple_HASH = HashingUtils::HashString("simple");
-        static const int structured_HASH = HashingUtils::HashString("structured");
-        static const int lucene_HASH = HashingUtils::HashString("lucene");
-        static const int dismax_HASH = HashingUtils::HashString("dismax");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "simple",
+          "structured",
+          "lucene",
+          "dismax",
+        };
 
         QueryParser GetQueryParserForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == simple_HASH)
-          {
-            return QueryParser::simple;
-          }
-          else if (hashCode == structured_HASH)
-          {
-            return QueryParser::structured;
-          }
-          else if (hashCode == lucene_HASH)
-          {
-            return QueryParser::lucene;
-          }
-          else if (hashCode == dismax_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return QueryParser::dismax;
+          case -902286926:
+            if (name == "simple")
+            {
+              return QueryParser::simple;
+            }
+            break;
+          case 185106769:
+            if (name == "structured")
+            {
+              return QueryParser::structured;
+            }
+            break;
+          case -1091917150:
+            if (name == "lucene")
+            {
+              return QueryParser::lucene;
+            }
+            break;
+          case -1331548650:
+            if (name == "dismax")
+            {
+              return QueryParser::dismax;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return QueryParser::NOT_SET;
         }
 
-        Aws::String GetNameForQueryParser(QueryParser enumValue)
+        const char* GetNameForQueryParserCStr(QueryParser enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QueryParser::simple:
-            return "simple";
-          case QueryParser::structured:
-            return "structured";
-          case QueryParser::lucene:
-            return "lucene";
-          case QueryParser::dismax:
-            return "dismax";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQueryParser(QueryParser enumValue)
+        {
+          return GetNameForQueryParserCStr(enumValue);
         }
 
       } // namespace QueryParserMapper
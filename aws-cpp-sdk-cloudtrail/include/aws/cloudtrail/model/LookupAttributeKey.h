@@ -41,6 +41,11 @@ namespace LookupAttributeKeyMapper
 AWS_CLOUDTRAIL_API LookupAttributeKey GetLookupAttributeKeyForName(const Aws::String& name);
 
 AWS_CLOUDTRAIL_API Aws::String GetNameForLookupAttributeKey(LookupAttributeKey value);
+
+/**
+ * Same as GetNameForLookupAttributeKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDTRAIL_API const char* GetNameForLookupAttributeKeyCStr(LookupAttributeKey value);
 } // namespace LookupAttributeKeyMapper
 } // namespace Model
 } // namespace CloudTrail
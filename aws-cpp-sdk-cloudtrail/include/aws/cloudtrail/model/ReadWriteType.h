@@ -36,6 +36,11 @@ namespace ReadWriteTypeMapper
 AWS_CLOUDTRAIL_API ReadWriteType GetReadWriteTypeForName(const Aws::String& name);
 
 AWS_CLOUDTRAIL_API Aws::String GetNameForReadWriteType(ReadWriteType value);
+
+/**
+ * Same as GetNameForReadWriteType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDTRAIL_API const char* GetNameForReadWriteTypeCStr(ReadWriteType value);
 } // namespace ReadWriteTypeMapper
 } // namespace Model
 } // namespace CloudTrail
@@ -30,50 +30,79 @@ namespace Aws
       namespace LookupAttributeKeyMapper
       {
 
-        static const int EventId_HASH = HashingUtils::HashString("EventId");
-        static const int EventName_HASH = HashingUtils::HashString("EventName");
-        static const int ReadOnly_HASH = HashingUtils::HashString("ReadOnly");
-        static const int Username_HASH = HashingUtils::HashString("Username");
-        static const int ResourceType_HASH = HashingUtils::HashString("ResourceType");
-        static const int ResourceName_HASH = HashingUtils::HashString("ResourceName");
-        static const int EventSource_HASH = HashingUtils::HashString("EventSource");
-        static const int AccessKeyId_HASH = HashingUtils::HashString("AccessKeyId");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EventId",
+          "EventName",
+          "ReadOnly",
+          "Username",
+          "ResourceType",
+          "ResourceName",
+          "EventSource",
+          "AccessKeyId",
+        };
 
         LookupAttributeKey GetLookupAttributeKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EventId_HASH)
-          {
-            return LookupAttributeKey::EventId;
-          }
-          else if (hashCode == EventName_HASH)
-          {
-            return LookupAttributeKey::EventName;
-          }
-          else if (hashCode == ReadOnly_HASH)
-          {
-            return LookupAttributeKey::ReadOnly;
-          }
-          else if (hashCode == Username_HASH)
-          {
-            return LookupAttributeKey::Username;
-          }
-          else if (hashCode == ResourceType_HASH)
-          {
-            return LookupAttributeKey::ResourceType;
-          }
-          else if (hashCode == ResourceName_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LookupAttributeKey::ResourceName;
-          }
-          else if (hashCode == EventSource_HASH)
-          {
-            return LookupAttributeKey::EventSource;
-          }
-          else if (hashCode == AccessKeyId_HASH)
-          {
-            return LookupAttributeKey::AccessKeyId;
+          case 288150837:
+            if (name == "EventId")
+            {
+              return LookupAttributeKey::EventId;
+            }
+            break;
+          case 2035196965:
+            if (name == "EventName")
+            {
+              return LookupAttributeKey::EventName;
+            }
+            break;
+          case -803039614:
+            if (name == "ReadOnly")
+            {
+              return LookupAttributeKey::ReadOnly;
+            }
+            break;
+          case -201069322:
+            if (name == "Username")
+            {
+              return LookupAttributeKey::Username;
+            }
+            break;
+          case -220044152:
+            if (name == "ResourceType")
+            {
+              return LookupAttributeKey::ResourceType;
+            }
+            break;
+          case -220246055:
+            if (name == "ResourceName")
+            {
+              return LookupAttributeKey::ResourceName;
+            }
+            break;
+          case 1770492725:
+            if (name == "EventSource")
+            {
+              return LookupAttributeKey::EventSource;
+            }
+            break;
+          case 616582326:
+            if (name == "AccessKeyId")
+            {
+              return LookupAttributeKey::AccessKeyId;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return LookupAttributeKey::NOT_SET;
         }
 
-        Aws::String GetNameForLookupAttributeKey(LookupAttributeKey enumValue)
+        const char* GetNameForLookupAttributeKeyCStr(LookupAttributeKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LookupAttributeKey::EventId:
-            return "EventId";
-          case LookupAttributeKey::EventName:
-            return "EventName";
-          case LookupAttributeKey::ReadOnly:
-            return "ReadOnly";
-          case LookupAttributeKey::Username:
-            return "Username";
-          case LookupAttributeKey::ResourceType:
-            return "ResourceType";
-          case LookupAttributeKey::ResourceName:
-            return "ResourceName";
-          case LookupAttributeKey::EventSource:
-            return "EventSource";
-          case LookupAttributeKey::AccessKeyId:
-            return "AccessKeyId";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLookupAttributeKey(LookupAttributeKey enumValue)
+        {
+          return GetNameForLookupAttributeKeyCStr(enumValue);
         }
 
       } // namespace LookupAttributeKeyMapper
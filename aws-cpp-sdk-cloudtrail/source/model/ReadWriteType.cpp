@@ -30,25 +30,44 @@ namespace Aws
       namespace ReadWriteTypeMapper
       {
 
-        static const int ReadOnly_HASH = HashingUtils::HashString("ReadOnly");
-        static const int WriteOnly_HASH = HashingUtils::HashString("WriteOnly");
-        static const int All_HASH = HashingUtils::HashString("All");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ReadOnly",
+          "WriteOnly",
+          "All",
+        };
 
         ReadWriteType GetReadWriteTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ReadOnly_HASH)
-          {
-            return ReadWriteType::ReadOnly;
-          }
-          else if (hashCode == WriteOnly_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReadWriteType::WriteOnly;
-          }
-          else if (hashCode == All_HASH)
-          {
-            return ReadWriteType::All;
+          case -803039614:
+            if (name == "ReadOnly")
+            {
+              return ReadWriteType::ReadOnly;
+            }
+            break;
+          case 597492747:
+            if (name == "WriteOnly")
+            {
+              return ReadWriteType::WriteOnly;
+            }
+            break;
+          case 65921:
+            if (name == "All")
+            {
+              return ReadWriteType::All;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ReadWriteType::NOT_SET;
         }
 
-        Aws::String GetNameForReadWriteType(ReadWriteType enumValue)
+        const char* GetNameForReadWriteTypeCStr(ReadWriteType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReadWriteType::ReadOnly:
-            return "ReadOnly";
-          case ReadWriteType::WriteOnly:
-            return "WriteOnly";
-          case ReadWriteType::All:
-            return "All";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReadWriteType(ReadWriteType enumValue)
+        {
+          return GetNameForReadWriteTypeCStr(enumValue);
         }
 
       } // namespace ReadWriteTypeMapper
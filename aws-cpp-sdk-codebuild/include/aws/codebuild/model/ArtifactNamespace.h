@@ -35,6 +35,11 @@ namespace ArtifactNamespaceMapper
 AWS_CODEBUILD_API ArtifactNamespace GetArtifactNamespaceForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForArtifactNamespace(ArtifactNamespace value);
+
+/**
+ * Same as GetNameForArtifactNamespace(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForArtifactNamespaceCStr(ArtifactNamespace value);
 } // namespace ArtifactNamespaceMapper
 } // namespace Model
 } // namespace CodeBuild
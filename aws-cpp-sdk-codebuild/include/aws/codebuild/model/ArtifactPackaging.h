@@ -35,6 +35,11 @@ namespace ArtifactPackagingMapper
 AWS_CODEBUILD_API ArtifactPackaging GetArtifactPackagingForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForArtifactPackaging(ArtifactPackaging value);
+
+/**
+ * Same as GetNameForArtifactPackaging(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForArtifactPackagingCStr(ArtifactPackaging value);
 } // namespace ArtifactPackagingMapper
 } // namespace Model
 } // namespace CodeBuild
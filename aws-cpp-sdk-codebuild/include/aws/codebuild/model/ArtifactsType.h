@@ -36,6 +36,11 @@ namespace ArtifactsTypeMapper
 AWS_CODEBUILD_API ArtifactsType GetArtifactsTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForArtifactsType(ArtifactsType value);
+
+/**
+ * Same as GetNameForArtifactsType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForArtifactsTypeCStr(ArtifactsType value);
 } // namespace ArtifactsTypeMapper
 } // namespace Model
 } // namespace CodeBuild
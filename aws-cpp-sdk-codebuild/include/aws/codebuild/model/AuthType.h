@@ -36,6 +36,11 @@ namespace AuthTypeMapper
 AWS_CODEBUILD_API AuthType GetAuthTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForAuthType(AuthType value);
+
+/**
+ * Same as GetNameForAuthType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForAuthTypeCStr(AuthType value);
 } // namespace AuthTypeMapper
 } // namespace Model
 } // namespace CodeBuild
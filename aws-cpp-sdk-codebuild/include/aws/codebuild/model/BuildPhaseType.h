@@ -44,6 +44,11 @@ namespace BuildPhaseTypeMapper
 AWS_CODEBUILD_API BuildPhaseType GetBuildPhaseTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForBuildPhaseType(BuildPhaseType value);
+
+/**
+ * Same as GetNameForBuildPhaseType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForBuildPhaseTypeCStr(BuildPhaseType value);
 } // namespace BuildPhaseTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -35,6 +35,11 @@ namespace CacheTypeMapper
 AWS_CODEBUILD_API CacheType GetCacheTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForCacheType(CacheType value);
+
+/**
+ * Same as GetNameForCacheType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForCacheTypeCStr(CacheType value);
 } // namespace CacheTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -35,6 +35,11 @@ namespace EnvironmentTypeMapper
 AWS_CODEBUILD_API EnvironmentType GetEnvironmentTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForEnvironmentType(EnvironmentType value);
+
+/**
+ * Same as GetNameForEnvironmentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForEnvironmentTypeCStr(EnvironmentType value);
 } // namespace EnvironmentTypeMapper
 } // namespace Model
 } // namespace CodeBuild
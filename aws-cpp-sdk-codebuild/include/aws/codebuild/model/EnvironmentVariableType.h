@@ -35,6 +35,11 @@ namespace EnvironmentVariableTypeMapper
 AWS_CODEBUILD_API EnvironmentVariableType GetEnvironmentVariableTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForEnvironmentVariableType(EnvironmentVariableType value);
+
+/**
+ * Same as GetNameForEnvironmentVariableType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForEnvironmentVariableTypeCStr(EnvironmentVariableType value);
 } // namespace EnvironmentVariableTypeMapper
 } // namespace Model
 } // namespace CodeBuild
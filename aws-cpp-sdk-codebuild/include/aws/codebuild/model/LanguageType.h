@@ -43,6 +43,11 @@ namespace LanguageTypeMapper
 AWS_CODEBUILD_API LanguageType GetLanguageTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForLanguageType(LanguageType value);
+
+/**
+ * Same as GetNameForLanguageType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForLanguageTypeCStr(LanguageType value);
 } // namespace LanguageTypeMapper
 } // namespace Model
 } // namespace CodeBuild
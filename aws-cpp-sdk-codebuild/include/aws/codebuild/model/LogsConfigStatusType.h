@@ -35,6 +35,11 @@ namespace LogsConfigStatusTypeMapper
 AWS_CODEBUILD_API LogsConfigStatusType GetLogsConfigStatusTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForLogsConfigStatusType(LogsConfigStatusType value);
+
+/**
+ * Same as GetNameForLogsConfigStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForLogsConfigStatusTypeCStr(LogsConfigStatusType value);
 } // namespace LogsConfigStatusTypeMapper
 } // namespace Model
 } // namespace CodeBuild
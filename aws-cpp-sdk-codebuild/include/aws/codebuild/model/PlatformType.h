@@ -37,6 +37,11 @@ namespace PlatformTypeMapper
 AWS_CODEBUILD_API PlatformType GetPlatformTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForPlatformType(PlatformType value);
+
+/**
+ * Same as GetNameForPlatformType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForPlatformTypeCStr(PlatformType value);
 } // namespace PlatformTypeMapper
 } // namespace Model
 } // namespace CodeBuild
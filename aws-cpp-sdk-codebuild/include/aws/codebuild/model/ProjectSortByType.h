@@ -36,6 +36,11 @@ namespace ProjectSortByTypeMapper
 AWS_CODEBUILD_API ProjectSortByType GetProjectSortByTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForProjectSortByType(ProjectSortByType value);
+
+/**
+ * Same as GetNameForProjectSortByType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForProjectSortByTypeCStr(ProjectSortByType value);
 } // namespace ProjectSortByTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -36,6 +36,11 @@ namespace ServerTypeMapper
 AWS_CODEBUILD_API ServerType GetServerTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForServerType(ServerType value);
+
+/**
+ * Same as GetNameForServerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForServerTypeCStr(ServerType value);
 } // namespace ServerTypeMapper
 } // namespace Model
 } // namespace CodeBuild
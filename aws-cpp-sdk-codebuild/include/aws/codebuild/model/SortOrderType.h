@@ -35,6 +35,11 @@ namespace SortOrderTypeMapper
 AWS_CODEBUILD_API SortOrderType GetSortOrderTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForSortOrderType(SortOrderType value);
+
+/**
+ * Same as GetNameForSortOrderType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForSortOrderTypeCStr(SortOrderType value);
 } // namespace SortOrderTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -34,6 +34,11 @@ namespace SourceAuthTypeMapper
 AWS_CODEBUILD_API SourceAuthType GetSourceAuthTypeForName(const Aws::String& name);
 
 AWS_CODEBUILD_API Aws::String GetNameForSourceAuthType(SourceAuthType value);
+
+/**
+ * Same as GetNameForSourceAuthType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEBUILD_API const char* GetNameForSourceAuthTypeCStr(SourceAuthType value);
 } // namespace SourceAuthTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -30,20 +30,37 @@ namespace Aws
       namespace ArtifactNamespaceMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int BUILD_ID_HASH = HashingUtils::HashString("BUILD_ID");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "BUILD_ID",
+        };
 
         ArtifactNamespace GetArtifactNamespaceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return ArtifactNamespace::NONE;
-          }
-          else if (hashCode == BUILD_ID_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ArtifactNamespace::BUILD_ID;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return ArtifactNamespace::NONE;
+            }
+            break;
+          case -647998292:
+            if (name == "BUILD_ID")
+            {
+              return ArtifactNamespace::BUILD_ID;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ArtifactNamespace::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactNamespace(ArtifactNamespace enumValue)
+        const char* GetNameForArtifactNamespaceCStr(ArtifactNamespace enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ArtifactNamespace::NONE:
-            return "NONE";
-          case ArtifactNamespace::BUILD_ID:
-            return "BUILD_ID";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForArtifactNamespace(ArtifactNamespace enumValue)
+        {
+          return GetNameForArtifactNamespaceCStr(enumValue);
         }
 
       } // namespace ArtifactNamespaceMapper
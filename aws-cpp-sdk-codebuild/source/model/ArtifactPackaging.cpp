@@ -30,20 +30,37 @@ namespace Aws
       namespace ArtifactPackagingMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int ZIP_HASH = HashingUtils::HashString("ZIP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "ZIP",
+        };
 
         ArtifactPackaging GetArtifactPackagingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return ArtifactPackaging::NONE;
-          }
-          else if (hashCode == ZIP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ArtifactPackaging::ZIP;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return ArtifactPackaging::NONE;
+            }
+            break;
+          case 88833:
+            if (name == "ZIP")
+            {
+              return ArtifactPackaging::ZIP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ArtifactPackaging::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactPackaging(ArtifactPackaging enumValue)
+        const char* GetNameForArtifactPackagingCStr(ArtifactPackaging enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ArtifactPackaging::NONE:
-            return "NONE";
-          case ArtifactPackaging::ZIP:
-            return "ZIP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForArtifactPackaging(ArtifactPackaging enumValue)
+        {
+          return GetNameForArtifactPackagingCStr(enumValue);
         }
 
       } // namespace ArtifactPackagingMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ArtifactsTypeMapper
       {
 
-        static const int CODEPIPELINE_HASH = HashingUtils::HashString("CODEPIPELINE");
-        static const int S3_HASH = HashingUtils::HashString("S3");
-        static const int NO_ARTIFACTS_HASH = HashingUtils::HashString("NO_ARTIFACTS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CODEPIPELINE",
+          "S3",
+          "NO_ARTIFACTS",
+        };
 
         ArtifactsType GetArtifactsTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CODEPIPELINE_HASH)
-          {
-            return ArtifactsType::CODEPIPELINE;
-          }
-          else if (hashCode == S3_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ArtifactsType::S3;
-          }
-          else if (hashCode == NO_ARTIFACTS_HASH)
-          {
-            return ArtifactsType::NO_ARTIFACTS;
+          case -394394737:
+            if (name == "CODEPIPELINE")
+            {
+              return ArtifactsType::CODEPIPELINE;
+            }
+            break;
+          case 2624:
+            if (name == "S3")
+            {
+              return ArtifactsType::S3;
+            }
+            break;
+          case -1182053437:
+            if (name == "NO_ARTIFACTS")
+            {
+              return ArtifactsType::NO_ARTIFACTS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ArtifactsType::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactsType(ArtifactsType enumValue)
+        const char* GetNameForArtifactsTypeCStr(ArtifactsType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ArtifactsType::CODEPIPELINE:
-            return "CODEPIPELINE";
-          case ArtifactsType::S3:
-            return "S3";
-          case ArtifactsType::NO_ARTIFACTS:
-            return "NO_ARTIFACTS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForArtifactsType(ArtifactsType enumValue)
+        {
+          return GetNameForArtifactsTypeCStr(enumValue);
         }
 
       } // namespace ArtifactsTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AuthTypeMapper
       {
 
-        static const int OAUTH_HASH = HashingUtils::HashString("OAUTH");
-        static const int BASIC_AUTH_HASH = HashingUtils::HashString("BASIC_AUTH");
-        static const int PERSONAL_ACCESS_TOKEN_HASH = HashingUtils::HashString("PERSONAL_ACCESS_TOKEN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OAUTH",
+          "BASIC_AUTH",
+          "PERSONAL_ACCESS_TOKEN",
+        };
 
         AuthType GetAuthTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OAUTH_HASH)
-          {
-            return AuthType::OAUTH;
-          }
-          else if (hashCode == BASIC_AUTH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthType::BASIC_AUTH;
-          }
-          else if (hashCode == PERSONAL_ACCESS_TOKEN_HASH)
-          {
-            return AuthType::PERSONAL_ACCESS_TOKEN;
+          case 74978935:
+            if (name == "OAUTH")
+            {
+              return AuthType::OAUTH;
+            }
+            break;
+          case -609875143:
+            if (name == "BASIC_AUTH")
+            {
+              return AuthType::BASIC_AUTH;
+            }
+            break;
+          case 1199419101:
+            if (name == "PERSONAL_ACCESS_TOKEN")
+            {
+              return AuthType::PERSONAL_ACCESS_TOKEN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AuthType::NOT_SET;
         }
 
-        Aws::String GetNameForAuthType(AuthType enumValue)
+        const char* GetNameForAuthTypeCStr(AuthType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthType::OAUTH:
-            return "OAUTH";
-          case AuthType::BASIC_AUTH:
-            return "BASIC_AUTH";
-          case AuthType::PERSONAL_ACCESS_TOKEN:
-            return "PERSONAL_ACCESS_TOKEN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthType(AuthType enumValue)
+        {
+          return GetNameForAuthTypeCStr(enumValue);
         }
 
       } // namespace AuthTypeMapper
@@ -30,65 +30,100 @@ namespace Aws
       namespace BuildPhaseTypeMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int QUEUED_HASH = HashingUtils::HashString("QUEUED");
-        static const int PROVISIONING_HASH = HashingUtils::HashString("PROVISIONING");
-        static const int DOWNLOAD_SOURCE_HASH = HashingUtils::HashString("DOWNLOAD_SOURCE");
-        static const int INSTALL_HASH = HashingUtils::HashString("INSTALL");
-        static const int PRE_BUILD_HASH = HashingUtils::HashString("PRE_BUILD");
-        static const int BUILD_HASH = HashingUtils::HashString("BUILD");
-        static const int POST_BUILD_HASH = HashingUtils::HashString("POST_BUILD");
-        static const int UPLOAD_ARTIFACTS_HASH = HashingUtils::HashString("UPLOAD_ARTIFACTS");
-        static const int FINALIZING_HASH = HashingUtils::HashString("FINALIZING");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUBMITTED",
+          "QUEUED",
+          "PROVISIONING",
+          "DOWNLOAD_SOURCE",
+          "INSTALL",
+          "PRE_BUILD",
+          "BUILD",
+          "POST_BUILD",
+          "UPLOAD_ARTIFACTS",
+          "FINALIZING",
+          "COMPLETED",
+        };
 
         BuildPhaseType GetBuildPhaseTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
-          {
-            return BuildPhaseType::SUBMITTED;
-          }
-          else if (hashCode == QUEUED_HASH)
-          {
-            return BuildPhaseType::QUEUED;
-          }
-          else if (hashCode == PROVISIONING_HASH)
-          {
-            return BuildPhaseType::PROVISIONING;
-          }
-          else if (hashCode == DOWNLOAD_SOURCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BuildPhaseType::DOWNLOAD_SOURCE;
-          }
-          else if (hashCode == INSTALL_HASH)
-          {
-            return BuildPhaseType::INSTALL;
-          }
-          else if (hashCode == PRE_BUILD_HASH)
-          {
-            return BuildPhaseType::PRE_BUILD;
-          }
-          else if (hashCode == BUILD_HASH)
-          {
-            return BuildPhaseType::BUILD;
-          }
-          else if (hashCode == POST_BUILD_HASH)
-          {
-            return BuildPhaseType::POST_BUILD;
-          }
-          else if (hashCode == UPLOAD_ARTIFACTS_HASH)
-          {
-            return BuildPhaseType::UPLOAD_ARTIFACTS;
-          }
-          else if (hashCode == FINALIZING_HASH)
-          {
-            return BuildPhaseType::FINALIZING;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return BuildPhaseType::COMPLETED;
+          case -1159694117:
+            if (name == "SUBMITTED")
+            {
+              return BuildPhaseType::SUBMITTED;
+            }
+            break;
+          case -1895367309:
+            if (name == "QUEUED")
+            {
+              return BuildPhaseType::QUEUED;
+            }
+            break;
+          case -1856587027:
+            if (name == "PROVISIONING")
+            {
+              return BuildPhaseType::PROVISIONING;
+            }
+            break;
+          case -5015630:
+            if (name == "DOWNLOAD_SOURCE")
+            {
+              return BuildPhaseType::DOWNLOAD_SOURCE;
+            }
+            break;
+          case -1619414661:
+            if (name == "INSTALL")
+            {
+              return BuildPhaseType::INSTALL;
+            }
+            break;
+          case -2089338478:
+            if (name == "PRE_BUILD")
+            {
+              return BuildPhaseType::PRE_BUILD;
+            }
+            break;
+          case 63557198:
+            if (name == "BUILD")
+            {
+              return BuildPhaseType::BUILD;
+            }
+            break;
+          case -947598865:
+            if (name == "POST_BUILD")
+            {
+              return BuildPhaseType::POST_BUILD;
+            }
+            break;
+          case -1845955581:
+            if (name == "UPLOAD_ARTIFACTS")
+            {
+              return BuildPhaseType::UPLOAD_ARTIFACTS;
+            }
+            break;
+          case -1366796965:
+            if (name == "FINALIZING")
+            {
+              return BuildPhaseType::FINALIZING;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return BuildPhaseType::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return BuildPhaseType::NOT_SET;
         }
 
-        Aws::String GetNameForBuildPhaseType(BuildPhaseType enumValue)
+        const char* GetNameForBuildPhaseTypeCStr(BuildPhaseType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BuildPhaseType::SUBMITTED:
-            return "SUBMITTED";
-          case BuildPhaseType::QUEUED:
-            return "QUEUED";
-          case BuildPhaseType::PROVISIONING:
-            return "PROVISIONING";
-          case BuildPhaseType::DOWNLOAD_SOURCE:
-            return "DOWNLOAD_SOURCE";
-          case BuildPhaseType::INSTALL:
-            return "INSTALL";
-          case BuildPhaseType::PRE_BUILD:
-            return "PRE_BUILD";
-          case BuildPhaseType::BUILD:
-            return "BUILD";
-          case BuildPhaseType::POST_BUILD:
-            return "POST_BUILD";
-          case BuildPhaseType::UPLOAD_ARTIFACTS:
-            return "UPLOAD_ARTIFACTS";
-          case BuildPhaseType::FINALIZING:
-            return "FINALIZING";
-          case BuildPhaseType::COMPLETED:
-            return "COMPLETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBuildPhaseType(BuildPhaseType enumValue)
+        {
+          return GetNameForBuildPhaseTypeCStr(enumValue);
         }
 
       } // namespace BuildPhaseTypeMapper
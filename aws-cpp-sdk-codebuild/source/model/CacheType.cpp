@@ -30,20 +30,37 @@ namespace Aws
       namespace CacheTypeMapper
       {
 
-        static const int NO_CACHE_HASH = HashingUtils::HashString("NO_CACHE");
-        static const int S3_HASH = HashingUtils::HashString("S3");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NO_CACHE",
+          "S3",
+        };
 
         CacheType GetCacheTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_CACHE_HASH)
-          {
-            return CacheType::NO_CACHE;
-          }
-          else if (hashCode == S3_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CacheType::S3;
+          case -1617752220:
+            if (name == "NO_CACHE")
+            {
+              return CacheType::NO_CACHE;
+            }
+            break;
+          case 2624:
+            if (name == "S3")
+            {
+              return CacheType::S3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CacheType::NOT_SET;
         }
 
-        Aws::String GetNameForCacheType(CacheType enumValue)
+        const char* GetNameForCacheTypeCStr(CacheType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CacheType::NO_CACHE:
-            return "NO_CACHE";
-          case CacheType::S3:
-            return "S3";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCacheType(CacheType enumValue)
+        {
+          return GetNameForCacheTypeCStr(enumValue);
         }
 
       } // namespace CacheTypeMapper
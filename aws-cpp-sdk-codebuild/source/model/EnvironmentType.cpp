@@ -30,20 +30,37 @@ namespace Aws
       namespace EnvironmentTypeMapper
       {
 
-        static const int WINDOWS_CONTAINER_HASH = HashingUtils::HashString("WINDOWS_CONTAINER");
-        static const int LINUX_CONTAINER_HASH = HashingUtils::HashString("LINUX_CONTAINER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WINDOWS_CONTAINER",
+          "LINUX_CONTAINER",
+        };
 
         EnvironmentType GetEnvironmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WINDOWS_CONTAINER_HASH)
-          {
-            return EnvironmentType::WINDOWS_CONTAINER;
-          }
-          else if (hashCode == LINUX_CONTAINER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnvironmentType::LINUX_CONTAINER;
+          case -823843451:
+            if (name == "WINDOWS_CONTAINER")
+            {
+              return EnvironmentType::WINDOWS_CONTAINER;
+            }
+            break;
+          case -1295927626:
+            if (name == "LINUX_CONTAINER")
+            {
+              return EnvironmentType::LINUX_CONTAINER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EnvironmentType::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentType(EnvironmentType enumValue)
+        const char* GetNameForEnvironmentTypeCStr(EnvironmentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnvironmentType::WINDOWS_CONTAINER:
-            return "WINDOWS_CONTAINER";
-          case EnvironmentType::LINUX_CONTAINER:
-            return "LINUX_CONTAINER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnvironmentType(EnvironmentType enumValue)
+        {
+          return GetNameForEnvironmentTypeCStr(enumValue);
         }
 
       } // namespace EnvironmentTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace EnvironmentVariableTypeMapper
       {
 
-        static const int PLAINTEXT_HASH = HashingUtils::HashString("PLAINTEXT");
-        static const int PARAMETER_STORE_HASH = HashingUtils::HashString("PARAMETER_STORE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PLAINTEXT",
+          "PARAMETER_STORE",
+        };
 
         EnvironmentVariableType GetEnvironmentVariableTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PLAINTEXT_HASH)
-          {
-            return EnvironmentVariableType::PLAINTEXT;
-          }
-          else if (hashCode == PARAMETER_STORE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnvironmentVariableType::PARAMETER_STORE;
+          case 464861655:
+            if (name == "PLAINTEXT")
+            {
+              return EnvironmentVariableType::PLAINTEXT;
+            }
+            break;
+          case -1488741237:
+            if (name == "PARAMETER_STORE")
+            {
+              return EnvironmentVariableType::PARAMETER_STORE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EnvironmentVariableType::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentVariableType(EnvironmentVariableType enumValue)
+        const char* GetNameForEnvironmentVariableTypeCStr(EnvironmentVariableType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnvironmentVariableType::PLAINTEXT:
-            return "PLAINTEXT";
-          case EnvironmentVariableType::PARAMETER_STORE:
-            return "PARAMETER_STORE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnvironmentVariableType(EnvironmentVariableType enumValue)
+        {
+          return GetNameForEnvironmentVariableTypeCStr(enumValue);
         }
 
       } // namespace EnvironmentVariableTypeMapper
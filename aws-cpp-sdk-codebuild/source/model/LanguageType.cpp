@@ -30,60 +30,93 @@ namespace Aws
       namespace LanguageTypeMapper
       {
 
-        static const int JAVA_HASH = HashingUtils::HashString("JAVA");
-        static const int PYTHON_HASH = HashingUtils::HashString("PYTHON");
-        static const int NODE_JS_HASH = HashingUtils::HashString("NODE_JS");
-        static const int RUBY_HASH = HashingUtils::HashString("RUBY");
-        static const int GOLANG_HASH = HashingUtils::HashString("GOLANG");
-        static const int DOCKER_HASH = HashingUtils::HashString("DOCKER");
-        static const int ANDROID__HASH = HashingUtils::HashString("ANDROID");
-        static const int DOTNET_HASH = HashingUtils::HashString("DOTNET");
-        static const int BASE_HASH = HashingUtils::HashString("BASE");
-        static const int PHP_HASH = HashingUtils::HashString("PHP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "JAVA",
+          "PYTHON",
+          "NODE_JS",
+          "RUBY",
+          "GOLANG",
+          "DOCKER",
+          "ANDROID",
+          "DOTNET",
+          "BASE",
+          "PHP",
+        };
 
         LanguageType GetLanguageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JAVA_HASH)
-          {
-            return LanguageType::JAVA;
-          }
-          else if (hashCode == PYTHON_HASH)
-          {
-            return LanguageType::PYTHON;
-          }
-          else if (hashCode == NODE_JS_HASH)
-          {
-            return LanguageType::NODE_JS;
-          }
-          else if (hashCode == RUBY_HASH)
-          {
-            return LanguageType::RUBY;
-          }
-          else if (hashCode == GOLANG_HASH)
-          {
-            return LanguageType::GOLANG;
-          }
-          else if (hashCode == DOCKER_HASH)
-          {
-            return LanguageType::DOCKER;
-          }
-          else if (hashCode == ANDROID__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LanguageType::ANDROID_;
-          }
-          else if (hashCode == DOTNET_HASH)
-          {
-            return LanguageType::DOTNET;
-          }
-          else if (hashCode == BASE_HASH)
-          {
-            return LanguageType::BASE;
-          }
-          else if (hashCode == PHP_HASH)
-          {
-            return LanguageType::PHP;
+          case 2269730:
+            if (name == "JAVA")
+            {
+              return LanguageType::JAVA;
+            }
+            break;
+          case -1919867684:
+            if (name == "PYTHON")
+            {
+              return LanguageType::PYTHON;
+            }
+            break;
+          case -1462505306:
+            if (name == "NODE_JS")
+            {
+              return LanguageType::NODE_JS;
+            }
+            break;
+          case 2526682:
+            if (name == "RUBY")
+            {
+              return LanguageType::RUBY;
+            }
+            break;
+          case 2107956950:
+            if (name == "GOLANG")
+            {
+              return LanguageType::GOLANG;
+            }
+            break;
+          case 2021810720:
+            if (name == "DOCKER")
+            {
+              return LanguageType::DOCKER;
+            }
+            break;
+          case -143408561:
+            if (name == "ANDROID")
+            {
+              return LanguageType::ANDROID_;
+            }
+            break;
+          case 2022320052:
+            if (name == "DOTNET")
+            {
+              return LanguageType::DOTNET;
+            }
+            break;
+          case 2031313:
+            if (name == "BASE")
+            {
+              return LanguageType::BASE;
+            }
+            break;
+          case 79192:
+            if (name == "PHP")
+            {
+              return LanguageType::PHP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return LanguageType::NOT_SET;
         }
 
-        Aws::String GetNameForLanguageType(LanguageType enumValue)
+        const char* GetNameForLanguageTypeCStr(LanguageType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LanguageType::JAVA:
-            return "JAVA";
-          case LanguageType::PYTHON:
-            return "PYTHON";
-          case LanguageType::NODE_JS:
-            return "NODE_JS";
-          case LanguageType::RUBY:
-            return "RUBY";
-          case LanguageType::GOLANG:
-            return "GOLANG";
-          case LanguageType::DOCKER:
-            return "DOCKER";
-          case LanguageType::ANDROID_:
-            return "ANDROID";
-          case LanguageType::DOTNET:
-            return "DOTNET";
-          case LanguageType::BASE:
-            return "BASE";
-          case LanguageType::PHP:
-            return "PHP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLanguageType(LanguageType enumValue)
+        {
+          return GetNameForLanguageTypeCStr(enumValue);
         }
 
       } // namespace LanguageTypeMapper
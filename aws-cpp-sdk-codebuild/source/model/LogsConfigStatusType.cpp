@@ -30,20 +30,37 @@ namespace Aws
       namespace LogsConfigStatusTypeMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLED",
+          "DISABLED",
+        };
 
         LogsConfigStatusType GetLogsConfigStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
-          {
-            return LogsConfigStatusType::ENABLED;
-          }
-          else if (hashCode == DISABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LogsConfigStatusType::DISABLED;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return LogsConfigStatusType::ENABLED;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return LogsConfigStatusType::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LogsConfigStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForLogsConfigStatusType(LogsConfigStatusType enumValue)
+        const char* GetNameForLogsConfigStatusTypeCStr(LogsConfigStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LogsConfigStatusType::ENABLED:
-            return "ENABLED";
-          case LogsConfigStatusType::DISABLED:
-            return "DISABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLogsConfigStatusType(LogsConfigStatusType enumValue)
+        {
+          return GetNameForLogsConfigStatusTypeCStr(enumValue);
         }
 
       } // namespace LogsConfigStatusTypeMapper
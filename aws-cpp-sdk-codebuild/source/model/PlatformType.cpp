@@ -30,30 +30,51 @@ namespace Aws
       namespace PlatformTypeMapper
       {
 
-        static const int DEBIAN_HASH = HashingUtils::HashString("DEBIAN");
-        static const int AMAZON_LINUX_HASH = HashingUtils::HashString("AMAZON_LINUX");
-        static const int UBUNTU_HASH = HashingUtils::HashString("UBUNTU");
-        static const int WINDOWS_SERVER_HASH = HashingUtils::HashString("WINDOWS_SERVER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEBIAN",
+          "AMAZON_LINUX",
+          "UBUNTU",
+          "WINDOWS_SERVER",
+        };
 
         PlatformType GetPlatformTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEBIAN_HASH)
-          {
-            return PlatformType::DEBIAN;
-          }
-          else if (hashCode == AMAZON_LINUX_HASH)
-          {
-            return PlatformType::AMAZON_LINUX;
-          }
-          else if (hashCode == UBUNTU_HASH)
-          {
-            return PlatformType::UBUNTU;
-          }
-          else if (hashCode == WINDOWS_SERVER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlatformType::WINDOWS_SERVER;
+          case 2012543669:
+            if (name == "DEBIAN")
+            {
+              return PlatformType::DEBIAN;
+            }
+            break;
+          case -1230363943:
+            if (name == "AMAZON_LINUX")
+            {
+              return PlatformType::AMAZON_LINUX;
+            }
+            break;
+          case -1797927193:
+            if (name == "UBUNTU")
+            {
+              return PlatformType::UBUNTU;
+            }
+            break;
+          case 1368296607:
+            if (name == "WINDOWS_SERVER")
+            {
+              return PlatformType::WINDOWS_SERVER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return PlatformType::NOT_SET;
         }
 
-        Aws::String GetNameForPlatformType(PlatformType enumValue)
+        const char* GetNameForPlatformTypeCStr(PlatformType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlatformType::DEBIAN:
-            return "DEBIAN";
-          case PlatformType::AMAZON_LINUX:
-            return "AMAZON_LINUX";
-          case PlatformType::UBUNTU:
-            return "UBUNTU";
-          case PlatformType::WINDOWS_SERVER:
-            return "WINDOWS_SERVER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlatformType(PlatformType enumValue)
+        {
+          return GetNameForPlatformTypeCStr(enumValue);
         }
 
       } // namespace PlatformTypeMapper
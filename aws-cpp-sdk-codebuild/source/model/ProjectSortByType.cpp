@@ -30,25 +30,44 @@ namespace Aws
       namespace ProjectSortByTypeMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int CREATED_TIME_HASH = HashingUtils::HashString("CREATED_TIME");
-        static const int LAST_MODIFIED_TIME_HASH = HashingUtils::HashString("LAST_MODIFIED_TIME");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NAME",
+          "CREATED_TIME",
+          "LAST_MODIFIED_TIME",
+        };
 
         ProjectSortByType GetProjectSortByTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
-          {
-            return ProjectSortByType::NAME;
-          }
-          else if (hashCode == CREATED_TIME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProjectSortByType::CREATED_TIME;
-          }
-          else if (hashCode == LAST_MODIFIED_TIME_HASH)
-          {
-            return ProjectSortByType::LAST_MODIFIED_TIME;
+          case 2388619:
+            if (name == "NAME")
+            {
+              return ProjectSortByType::NAME;
+            }
+            break;
+          case 55014884:
+            if (name == "CREATED_TIME")
+            {
+              return ProjectSortByType::CREATED_TIME;
+            }
+            break;
+          case 2119795866:
+            if (name == "LAST_MODIFIED_TIME")
+            {
+              return ProjectSortByType::LAST_MODIFIED_TIME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ProjectSortByType::NOT_SET;
         }
 
-        Aws::String GetNameForProjectSortByType(ProjectSortByType enumValue)
+        const char* GetNameForProjectSortByTypeCStr(ProjectSortByType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProjectSortByType::NAME:
-            return "NAME";
-          case ProjectSortByType::CREATED_TIME:
-            return "CREATED_TIME";
-          case ProjectSortByType::LAST_MODIFIED_TIME:
-            return "LAST_MODIFIED_TIME";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProjectSortByType(ProjectSortByType enumValue)
+        {
+          return GetNameForProjectSortByTypeCStr(enumValue);
         }
 
       } // namespace ProjectSortByTypeMapper
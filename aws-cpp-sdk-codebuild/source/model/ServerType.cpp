@@ -30,25 +30,44 @@ namespace Aws
       namespace ServerTypeMapper
       {
 
-        static const int GITHUB_HASH = HashingUtils::HashString("GITHUB");
-        static const int BITBUCKET_HASH = HashingUtils::HashString("BITBUCKET");
-        static const int GITHUB_ENTERPRISE_HASH = HashingUtils::HashString("GITHUB_ENTERPRISE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GITHUB",
+          "BITBUCKET",
+          "GITHUB_ENTERPRISE",
+        };
 
         ServerType GetServerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GITHUB_HASH)
-          {
-            return ServerType::GITHUB;
-          }
-          else if (hashCode == BITBUCKET_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServerType::BITBUCKET;
-          }
-          else if (hashCode == GITHUB_ENTERPRISE_HASH)
-          {
-            return ServerType::GITHUB_ENTERPRISE;
+          case 2102661091:
+            if (name == "GITHUB")
+            {
+              return ServerType::GITHUB;
+            }
+            break;
+          case -1445783273:
+            if (name == "BITBUCKET")
+            {
+              return ServerType::BITBUCKET;
+            }
+            break;
+          case 257009981:
+            if (name == "GITHUB_ENTERPRISE")
+            {
+              return ServerType::GITHUB_ENTERPRISE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ServerType::NOT_SET;
         }
 
-        Aws::String GetNameForServerType(ServerType enumValue)
+        const char* GetNameForServerTypeCStr(ServerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServerType::GITHUB:
-            return "GITHUB";
-          case ServerType::BITBUCKET:
-            return "BITBUCKET";
-          case ServerType::GITHUB_ENTERPRISE:
-            return "GITHUB_ENTERPRISE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServerType(ServerType enumValue)
+        {
+          return GetNameForServerTypeCStr(enumValue);
         }
 
       } // namespace ServerTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace SourceAuthTypeMapper
       {
 
-        static const int OAUTH_HASH = HashingUtils::HashString("OAUTH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OAUTH",
+        };
 
         SourceAuthType GetSourceAuthTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OAUTH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SourceAuthType::OAUTH;
+          case 74978935:
+            if (name == "OAUTH")
+            {
+              return SourceAuthType::OAUTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return SourceAuthType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceAuthType(SourceAuthType enumValue)
+        const char* GetNameForSourceAuthTypeCStr(SourceAuthType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SourceAuthType::OAUTH:
-            return "OAUTH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSourceAuthType(SourceAuthType enumValue)
+        {
+          return GetNameForSourceAuthTypeCStr(enumValue);
         }
 
       } // namespace SourceAuthTypeMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int CODECOMMIT_HASH = HashingUtils::HashString("CODECOMMIT");
-        static const int CODEPIPELINE_HASH = HashingUtils::HashString("CODEPIPELINE");
-        static const int GITHUB_HASH = HashingUtils::HashString("GITHUB");
-        static const int S3_HASH = HashingUtils::HashString("S3");
-        static const int BITBUCKET_HASH = HashingUtils::HashString("BITBUCKET");
-        static const int GITHUB_ENTERPRISE_HASH = HashingUtils::HashString("GITHUB_ENTERPRISE");
-        static const int NO_SOURCE_HASH = HashingUtils::HashString("NO_SOURCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CODECOMMIT",
+          "CODEPIPELINE",
+          "GITHUB",
+          "S3",
+          "BITBUCKET",
+          "GITHUB_ENTERPRISE",
+          "NO_SOURCE",
+        };
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CODECOMMIT_HASH)
-          {
-            return SourceType::CODECOMMIT;
-          }
-          else if (hashCode == CODEPIPELINE_HASH)
-          {
-            return SourceType::CODEPIPELINE;
-          }
-          else if (hashCode == GITHUB_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SourceType::GITHUB;
-          }
-          else if (hashCode == S3_HASH)
-          {
-            return SourceType::S3;
-          }
-          else if (hashCode == BITBUCKET_HASH)
-          {
-            return SourceType::BITBUCKET;
-          }
-          else if (hashCode == GITHUB_ENTERPRISE_HASH)
-          {
-            return SourceType::GITHUB_ENTERPRISE;
-          }
-          else if (hashCode == NO_SOURCE_HASH)
-          {
-            return SourceType::NO_SOURCE;
+          case 17227108:
+            if (name == "CODECOMMIT")
+            {
+              return SourceType::CODECOMMIT;
+            }
+            break;
+          case -394394737:
+            if (name == "CODEPIPELINE")
+            {
+              return SourceType::CODEPIPELINE;
+            }
+            break;
+          case 2102661091:
+            if (name == "GITHUB")
+            {
+              return SourceType::GITHUB;
+            }
+            break;
+          case 2624:
+            if (name == "S3")
+            {
+              return SourceType::S3;
+            }
+            break;
+          case -1445783273:
+            if (name == "BITBUCKET")
+            {
+              return SourceType::BITBUCKET;
+            }
+            break;
+          case 257009981:
+            if (name == "GITHUB_ENTERPRISE")
+            {
+              return SourceType::GITHUB_ENTERPRISE;
+            }
+            break;
+          case 1860830297:
+            if (name == "NO_SOURCE")
+            {
+              return SourceType::NO_SOURCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceTypeCStr(SourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SourceType::CODECOMMIT:
-            return "CODECOMMIT";
-          case SourceType::CODEPIPELINE:
-            return "CODEPIPELINE";
-          case SourceType::GITHUB:
-            return "GITHUB";
-          case SourceType::S3:
-            return "S3";
-          case SourceType::BITBUCKET:
-            return "BITBUCKET";
-          case SourceType::GITHUB_ENTERPRISE:
-            return "GITHUB_ENTERPRISE";
-          case SourceType::NO_SOURCE:
-            return "NO_SOURCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSourceType(SourceType enumValue)
+        {
+          return GetNameForSourceTypeCStr(enumValue);
         }
 
       } // namespace SourceTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace StatusTypeMapper
       {
 
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int FAULT_HASH = HashingUtils::HashString("FAULT");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCEEDED",
+          "FAILED",
+          "FAULT",
+          "TIMED_OUT",
+          "IN_PROGRESS",
+          "STOPPED",
+        };
 
         StatusType GetStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCEEDED_HASH)
-          {
-            return StatusType::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StatusType::FAILED;
-          }
-          else if (hashCode == FAULT_HASH)
-          {
-            return StatusType::FAULT;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return StatusType::TIMED_OUT;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StatusType::IN_PROGRESS;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return StatusType::STOPPED;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return StatusType::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return StatusType::FAILED;
+            }
+            break;
+          case 66667010:
+            if (name == "FAULT")
+            {
+              return StatusType::FAULT;
+            }
+            break;
+          case -1466757626:
+            if (name == "TIMED_OUT")
+            {
+              return StatusType::TIMED_OUT;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return StatusType::IN_PROGRESS;
+            }
+            break;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return StatusType::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return StatusType::NOT_SET;
         }
 
-        Aws::String GetNameForStatusType(StatusType enumValue)
+        const char* GetNameForStatusTypeCStr(StatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StatusType::SUCCEEDED:
-            return "SUCCEEDED";
-          case StatusType::FAILED:
-            return "FAILED";
-          case StatusType::FAULT:
-            return "FAULT";
-          case StatusType::TIMED_OUT:
-            return "TIMED_OUT";
-          case StatusType::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case StatusType::STOPPED:
-            return "STOPPED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatusType(StatusType enumValue)
+        {
+          return GetNameForStatusTypeCStr(enumValue);
         }
 
       } // namespace StatusTypeMapper
@@ -36,6 +36,11 @@ namespace ChangeTypeEnumMapper
 AWS_CODECOMMIT_API ChangeTypeEnum GetChangeTypeEnumForName(const Aws::String& name);
 
 AWS_CODECOMMIT_API Aws::String GetNameForChangeTypeEnum(ChangeTypeEnum value);
+
+/**
+ * Same as GetNameForChangeTypeEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODECOMMIT_API const char* GetNameForChangeTypeEnumCStr(ChangeTypeEnum value);
 } // namespace ChangeTypeEnumMapper
 } // namespace Model
 } // namespace CodeCommit
@@ -36,6 +36,11 @@ namespace FileModeTypeEnumMapper
 AWS_CODECOMMIT_API FileModeTypeEnum GetFileModeTypeEnumForName(const Aws::String& name);
 
 AWS_CODECOMMIT_API Aws::String GetNameForFileModeTypeEnum(FileModeTypeEnum value);
+
+/**
+ * Same as GetNameForFileModeTypeEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODECOMMIT_API const char* GetNameForFileModeTypeEnumCStr(FileModeTypeEnum value);
 } // namespace FileModeTypeEnumMapper
 } // namespace Model
 } // namespace CodeCommit
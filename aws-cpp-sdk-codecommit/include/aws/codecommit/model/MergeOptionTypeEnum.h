@@ -34,6 +34,11 @@ namespace MergeOptionTypeEnumMapper
 AWS_CODECOMMIT_API MergeOptionTypeEnum GetMergeOptionTypeEnumForName(const Aws::String& name);
 
 AWS_CODECOMMIT_API Aws::String GetNameForMergeOptionTypeEnum(MergeOptionTypeEnum value);
+
+/**
+ * Same as GetNameForMergeOptionTypeEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODECOMMIT_API const char* GetNameForMergeOptionTypeEnumCStr(MergeOptionTypeEnum value);
 } // namespace MergeOptionTypeEnumMapper
 } // namespace Model
 } // namespace CodeCommit
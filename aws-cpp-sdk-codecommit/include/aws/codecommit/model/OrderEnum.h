@@ -35,6 +35,11 @@ namespace OrderEnumMapper
 AWS_CODECOMMIT_API OrderEnum GetOrderEnumForName(const Aws::String& name);
 
 AWS_CODECOMMIT_API Aws::String GetNameForOrderEnum(OrderEnum value);
+
+/**
+ * Same as GetNameForOrderEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODECOMMIT_API const char* GetNameForOrderEnumCStr(OrderEnum value);
 } // namespace OrderEnumMapper
 } // namespace Model
 } // namespace CodeCommit
@@ -37,6 +37,11 @@ namespace PullRequestEventTypeMapper
 AWS_CODECOMMIT_API PullRequestEventType GetPullRequestEventTypeForName(const Aws::String& name);
 
 AWS_CODECOMMIT_API Aws::String GetNameForPullRequestEventType(PullRequestEventType value);
+
+/**
+ * Same as GetNameForPullRequestEventType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODECOMMIT_API const char* GetNameForPullRequestEventTypeCStr(PullRequestEventType value);
 } // namespace PullRequestEventTypeMapper
 } // namespace Model
 } // namespace CodeCommit
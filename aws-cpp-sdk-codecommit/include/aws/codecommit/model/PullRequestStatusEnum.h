@@ -35,6 +35,11 @@ namespace PullRequestStatusEnumMapper
 AWS_CODECOMMIT_API PullRequestStatusEnum GetPullRequestStatusEnumForName(const Aws::String& name);
 
 AWS_CODECOMMIT_API Aws::String GetNameForPullRequestStatusEnum(PullRequestStatusEnum value);
+
+/**
+ * Same as GetNameForPullRequestStatusEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODECOMMIT_API const char* GetNameForPullRequestStatusEnumCStr(PullRequestStatusEnum value);
 } // namespace PullRequestStatusEnumMapper
 } // namespace Model
 } // namespace CodeCommit
@@ -35,6 +35,11 @@ namespace RelativeFileVersionEnumMapper
 AWS_CODECOMMIT_API RelativeFileVersionEnum GetRelativeFileVersionEnumForName(const Aws::String& name);
 
 AWS_CODECOMMIT_API Aws::String GetNameForRelativeFileVersionEnum(RelativeFileVersionEnum value);
+
+/**
+ * Same as GetNameForRelativeFileVersionEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODECOMMIT_API const char* GetNameForRelativeFileVersionEnumCStr(RelativeFileVersionEnum value);
 } // namespace RelativeFileVersionEnumMapper
 } // namespace Model
 } // namespace CodeCommit
@@ -37,6 +37,11 @@ namespace RepositoryTriggerEventEnumMapper
 AWS_CODECOMMIT_API RepositoryTriggerEventEnum GetRepositoryTriggerEventEnumForName(const Aws::String& name);
 
 AWS_CODECOMMIT_API Aws::String GetNameForRepositoryTriggerEventEnum(RepositoryTriggerEventEnum value);
+
+/**
+ * Same as GetNameForRepositoryTriggerEventEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODECOMMIT_API const char* GetNameForRepositoryTriggerEventEnumCStr(RepositoryTriggerEventEnum value);
 } // namespace RepositoryTriggerEventEnumMapper
 } // namespace Model
 } // namespace CodeCommit
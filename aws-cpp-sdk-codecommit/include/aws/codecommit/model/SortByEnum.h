@@ -35,6 +35,11 @@ namespace SortByEnumMapper
 AWS_CODECOMMIT_API SortByEnum GetSortByEnumForName(const Aws::String& name);
 
 AWS_CODECOMMIT_API Aws::String GetNameForSortByEnum(SortByEnum value);
+
+/**
+ * Same as GetNameForSortByEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODECOMMIT_API const char* GetNameForSortByEnumCStr(SortByEnum value);
 } // namespace SortByEnumMapper
 } // namespace Model
 } // namespace CodeCommit
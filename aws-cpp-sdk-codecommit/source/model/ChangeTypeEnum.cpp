@@ -30,25 +30,44 @@ namespace Aws
       namespace ChangeTypeEnumMapper
       {
 
-        static const int A_HASH = HashingUtils::HashString("A");
-        static const int M_HASH = HashingUtils::HashString("M");
-        static const int D_HASH = HashingUtils::HashString("D");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "A",
+          "M",
+          "D",
+        };
 
         ChangeTypeEnum GetChangeTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == A_HASH)
-          {
-            return ChangeTypeEnum::A;
-          }
-          else if (hashCode == M_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeTypeEnum::M;
-          }
-          else if (hashCode == D_HASH)
-          {
-            return ChangeTypeEnum::D;
+          case 65:
+            if (name == "A")
+            {
+              return ChangeTypeEnum::A;
+            }
+            break;
+          case 77:
+            if (name == "M")
+            {
+              return ChangeTypeEnum::M;
+            }
+            break;
+          case 68:
+            if (name == "D")
+            {
+              return ChangeTypeEnum::D;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ChangeTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForChangeTypeEnum(ChangeTypeEnum enumValue)
+        const char* GetNameForChangeTypeEnumCStr(ChangeTypeEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeTypeEnum::A:
-            return "A";
-          case ChangeTypeEnum::M:
-            return "M";
-          case ChangeTypeEnum::D:
-            return "D";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeTypeEnum(ChangeTypeEnum enumValue)
+        {
+          return GetNameForChangeTypeEnumCStr(enumValue);
         }
 
       } // namespace ChangeTypeEnumMapper
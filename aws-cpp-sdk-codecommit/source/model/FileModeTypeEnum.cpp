@@ -30,25 +30,44 @@ namespace Aws
       namespace FileModeTypeEnumMapper
       {
 
-        static const int EXECUTABLE_HASH = HashingUtils::HashString("EXECUTABLE");
-        static const int NORMAL_HASH = HashingUtils::HashString("NORMAL");
-        static const int SYMLINK_HASH = HashingUtils::HashString("SYMLINK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EXECUTABLE",
+          "NORMAL",
+          "SYMLINK",
+        };
 
         FileModeTypeEnum GetFileModeTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXECUTABLE_HASH)
-          {
-            return FileModeTypeEnum::EXECUTABLE;
-          }
-          else if (hashCode == NORMAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FileModeTypeEnum::NORMAL;
-          }
-          else if (hashCode == SYMLINK_HASH)
-          {
-            return FileModeTypeEnum::SYMLINK;
+          case 1024356426:
+            if (name == "EXECUTABLE")
+            {
+              return FileModeTypeEnum::EXECUTABLE;
+            }
+            break;
+          case -1986416409:
+            if (name == "NORMAL")
+            {
+              return FileModeTypeEnum::NORMAL;
+            }
+            break;
+          case -1025163487:
+            if (name == "SYMLINK")
+            {
+              return FileModeTypeEnum::SYMLINK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FileModeTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForFileModeTypeEnum(FileModeTypeEnum enumValue)
+        const char* GetNameForFileModeTypeEnumCStr(FileModeTypeEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FileModeTypeEnum::EXECUTABLE:
-            return "EXECUTABLE";
-          case FileModeTypeEnum::NORMAL:
-            return "NORMAL";
-          case FileModeTypeEnum::SYMLINK:
-            return "SYMLINK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFileModeTypeEnum(FileModeTypeEnum enumValue)
+        {
+          return GetNameForFileModeTypeEnumCStr(enumValue);
         }
 
       } // namespace FileModeTypeEnumMapper
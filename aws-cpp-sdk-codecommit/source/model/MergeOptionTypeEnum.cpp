@@ -30,15 +30,30 @@ namespace Aws
       namespace MergeOptionTypeEnumMapper
       {
 
-        static const int FAST_FORWARD_MERGE_HASH = HashingUtils::HashString("FAST_FORWARD_MERGE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FAST_FORWARD_MERGE",
+        };
 
         MergeOptionTypeEnum GetMergeOptionTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAST_FORWARD_MERGE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MergeOptionTypeEnum::FAST_FORWARD_MERGE;
+          case -1751404709:
+            if (name == "FAST_FORWARD_MERGE")
+            {
+              return MergeOptionTypeEnum::FAST_FORWARD_MERGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return MergeOptionTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForMergeOptionTypeEnum(MergeOptionTypeEnum enumValue)
+        const char* GetNameForMergeOptionTypeEnumCStr(MergeOptionTypeEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MergeOptionTypeEnum::FAST_FORWARD_MERGE:
-            return "FAST_FORWARD_MERGE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMergeOptionTypeEnum(MergeOptionTypeEnum enumValue)
+        {
+          return GetNameForMergeOptionTypeEnumCStr(enumValue);
         }
 
       } // namespace MergeOptionTypeEnumMapper
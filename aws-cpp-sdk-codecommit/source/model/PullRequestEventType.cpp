@@ -30,30 +30,51 @@ namespace Aws
       namespace PullRequestEventTypeMapper
       {
 
-        static const int PULL_REQUEST_CREATED_HASH = HashingUtils::HashString("PULL_REQUEST_CREATED");
-        static const int PULL_REQUEST_STATUS_CHANGED_HASH = HashingUtils::HashString("PULL_REQUEST_STATUS_CHANGED");
-        static const int PULL_REQUEST_SOURCE_REFERENCE_UPDATED_HASH = HashingUtils::HashString("PULL_REQUEST_SOURCE_REFERENCE_UPDATED");
-        static const int PULL_REQUEST_MERGE_STATE_CHANGED_HASH = HashingUtils::HashString("PULL_REQUEST_MERGE_STATE_CHANGED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PULL_REQUEST_CREATED",
+          "PULL_REQUEST_STATUS_CHANGED",
+          "PULL_REQUEST_SOURCE_REFERENCE_UPDATED",
+          "PULL_REQUEST_MERGE_STATE_CHANGED",
+        };
 
         PullRequestEventType GetPullRequestEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PULL_REQUEST_CREATED_HASH)
-          {
-            return PullRequestEventType::PULL_REQUEST_CREATED;
-          }
-          else if (hashCode == PULL_REQUEST_STATUS_CHANGED_HASH)
-          {
-            return PullRequestEventType::PULL_REQUEST_STATUS_CHANGED;
-          }
-          else if (hashCode == PULL_REQUEST_SOURCE_REFERENCE_UPDATED_HASH)
-          {
-            return PullRequestEventType::PULL_REQUEST_SOURCE_REFERENCE_UPDATED;
-          }
-          else if (hashCode == PULL_REQUEST_MERGE_STATE_CHANGED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PullRequestEventType::PULL_REQUEST_MERGE_STATE_CHANGED;
+          case 1310073598:
+            if (name == "PULL_REQUEST_CREATED")
+            {
+              return PullRequestEventType::PULL_REQUEST_CREATED;
+            }
+            break;
+          case 188589649:
+            if (name == "PULL_REQUEST_STATUS_CHANGED")
+            {
+              return PullRequestEventType::PULL_REQUEST_STATUS_CHANGED;
+            }
+            break;
+          case 1043412717:
+            if (name == "PULL_REQUEST_SOURCE_REFERENCE_UPDATED")
+            {
+              return PullRequestEventType::PULL_REQUEST_SOURCE_REFERENCE_UPDATED;
+            }
+            break;
+          case 1441025045:
+            if (name == "PULL_REQUEST_MERGE_STATE_CHANGED")
+            {
+              return PullRequestEventType::PULL_REQUEST_MERGE_STATE_CHANGED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return PullRequestEventType::NOT_SET;
         }
 
-        Aws::String GetNameForPullRequestEventType(PullRequestEventType enumValue)
+        const char* GetNameForPullRequestEventTypeCStr(PullRequestEventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PullRequestEventType::PULL_REQUEST_CREATED:
-            return "PULL_REQUEST_CREATED";
-          case PullRequestEventType::PULL_REQUEST_STATUS_CHANGED:
-            return "PULL_REQUEST_STATUS_CHANGED";
-          case PullRequestEventType::PULL_REQUEST_SOURCE_REFERENCE_UPDATED:
-            return "PULL_REQUEST_SOURCE_REFERENCE_UPDATED";
-          case PullRequestEventType::PULL_REQUEST_MERGE_STATE_CHANGED:
-            return "PULL_REQUEST_MERGE_STATE_CHANGED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPullRequestEventType(PullRequestEventType enumValue)
+        {
+          return GetNameForPullRequestEventTypeCStr(enumValue);
         }
 
       } // namespace PullRequestEventTypeMapper
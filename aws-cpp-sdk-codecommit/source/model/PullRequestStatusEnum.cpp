@@ -30,20 +30,37 @@ namespace Aws
       namespace PullRequestStatusEnumMapper
       {
 
-        static const int OPEN_HASH = HashingUtils::HashString("OPEN");
-        static const int CLOSED_HASH = HashingUtils::HashString("CLOSED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OPEN",
+          "CLOSED",
+        };
 
         PullRequestStatusEnum GetPullRequestStatusEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OPEN_HASH)
-          {
-            return PullRequestStatusEnum::OPEN;
-          }
-          else if (hashCode == CLOSED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PullRequestStatusEnum::CLOSED;
+          case 2432586:
+            if (name == "OPEN")
+            {
+              return PullRequestStatusEnum::OPEN;
+            }
+            break;
+          case 1990776172:
+            if (name == "CLOSED")
+            {
+              return PullRequestStatusEnum::CLOSED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PullRequestStatusEnum::NOT_SET;
         }
 
-        Aws::String GetNameForPullRequestStatusEnum(PullRequestStatusEnum enumValue)
+        const char* GetNameForPullRequestStatusEnumCStr(PullRequestStatusEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PullRequestStatusEnum::OPEN:
-            return "OPEN";
-          case PullRequestStatusEnum::CLOSED:
-            return "CLOSED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPullRequestStatusEnum(PullRequestStatusEnum enumValue)
+        {
+          return GetNameForPullRequestStatusEnumCStr(enumValue);
         }
 
       } // namespace PullRequestStatusEnumMapper
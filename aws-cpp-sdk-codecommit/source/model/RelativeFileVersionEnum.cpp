@@ -30,20 +30,37 @@ namespace Aws
       namespace RelativeFileVersionEnumMapper
       {
 
-        static const int BEFORE_HASH = HashingUtils::HashString("BEFORE");
-        static const int AFTER_HASH = HashingUtils::HashString("AFTER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BEFORE",
+          "AFTER",
+        };
 
         RelativeFileVersionEnum GetRelativeFileVersionEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BEFORE_HASH)
-          {
-            return RelativeFileVersionEnum::BEFORE;
-          }
-          else if (hashCode == AFTER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RelativeFileVersionEnum::AFTER;
+          case 1955410815:
+            if (name == "BEFORE")
+            {
+              return RelativeFileVersionEnum::BEFORE;
+            }
+            break;
+          case 62197180:
+            if (name == "AFTER")
+            {
+              return RelativeFileVersionEnum::AFTER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RelativeFileVersionEnum::NOT_SET;
         }
 
-        Aws::String GetNameForRelativeFileVersionEnum(RelativeFileVersionEnum enumValue)
+        const char* GetNameForRelativeFileVersionEnumCStr(RelativeFileVersionEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RelativeFileVersionEnum::BEFORE:
-            return "BEFORE";
-          case RelativeFileVersionEnum::AFTER:
-            return "AFTER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRelativeFileVersionEnum(RelativeFileVersionEnum enumValue)
+        {
+          return GetNameForRelativeFileVersionEnumCStr(enumValue);
         }
 
       } // namespace RelativeFileVersionEnumMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace RepositoryTriggerEventEnumMapper
       {
 
-        static const int all_HASH = HashingUtils::HashString("all");
-        static const int updateReference_HASH = HashingUtils::HashString("updateReference");
-        static const int createReference_HASH = HashingUtils::HashString("createReference");
-        static const int deleteReference_HASH = HashingUtils::HashString("deleteReference");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "all",
+          "updateReference",
+          "createReference",
+          "deleteReference",
+        };
 
         RepositoryTriggerEventEnum GetRepositoryTriggerEventEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == all_HASH)
-          {
-            return RepositoryTriggerEventEnum::all;
-          }
-          else if (hashCode == updateReference_HASH)
-          {
-            return RepositoryTriggerEventEnum::updateReference;
-          }
-          else if (hashCode == createReference_HASH)
-          {
-            return RepositoryTriggerEventEnum::createReference;
-          }
-          else if (hashCode == deleteReference_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RepositoryTriggerEventEnum::deleteReference;
+          case 96673:
+            if (name == "all")
+            {
+              return RepositoryTriggerEventEnum::all;
+            }
+            break;
+          case 280361090:
+            if (name == "updateReference")
+            {
+              return RepositoryTriggerEventEnum::updateReference;
+            }
+            break;
+          case 1904679343:
+            if (name == "createReference")
+            {
+              return RepositoryTriggerEventEnum::createReference;
+            }
+            break;
+          case -142931488:
+            if (name == "deleteReference")
+            {
+              return RepositoryTriggerEventEnum::deleteReference;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return RepositoryTriggerEventEnum::NOT_SET;
         }
 
-        Aws::String GetNameForRepositoryTriggerEventEnum(RepositoryTriggerEventEnum enumValue)
+        const char* GetNameForRepositoryTriggerEventEnumCStr(RepositoryTriggerEventEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RepositoryTriggerEventEnum::all:
-            return "all";
-          case RepositoryTriggerEventEnum::updateReference:
-            return "updateReference";
-          case RepositoryTriggerEventEnum::createReference:
-            return "createReference";
-          case RepositoryTriggerEventEnum::deleteReference:
-            return "deleteReference";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRepositoryTriggerEventEnum(RepositoryTriggerEventEnum enumValue)
+        {
+          return GetNameForRepositoryTriggerEventEnumCStr(enumValue);
         }
 
       } // namespace RepositoryTriggerEventEnumMapper
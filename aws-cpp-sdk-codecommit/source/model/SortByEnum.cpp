@@ -30,20 +30,37 @@ namespace Aws
       namespace SortByEnumMapper
       {
 
-        static const int repositoryName_HASH = HashingUtils::HashString("repositoryName");
-        static const int lastModifiedDate_HASH = HashingUtils::HashString("lastModifiedDate");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "repositoryName",
+          "lastModifiedDate",
+        };
 
         SortByEnum GetSortByEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == repositoryName_HASH)
-          {
-            return SortByEnum::repositoryName;
-          }
-          else if (hashCode == lastModifiedDate_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SortByEnum::lastModifiedDate;
+          case -208071435:
+            if (name == "repositoryName")
+            {
+              return SortByEnum::repositoryName;
+            }
+            break;
+          case -1540845619:
+            if (name == "lastModifiedDate")
+            {
+              return SortByEnum::lastModifiedDate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SortByEnum::NOT_SET;
         }
 
-        Aws::String GetNameForSortByEnum(SortByEnum enumValue)
+        const char* GetNameForSortByEnumCStr(SortByEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SortByEnum::repositoryName:
-            return "repositoryName";
-          case SortByEnum::lastModifiedDate:
-            return "lastModifiedDate";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSortByEnum(SortByEnum enumValue)
+        {
+          return GetNameForSortByEnumCStr(enumValue);
         }
 
       } // namespace SortByEnumMapper
@@ -36,6 +36,11 @@ namespace ApplicationRevisionSortByMapper
 AWS_CODEDEPLOY_API ApplicationRevisionSortBy GetApplicationRevisionSortByForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForApplicationRevisionSortBy(ApplicationRevisionSortBy value);
+
+/**
+ * Same as GetNameForApplicationRevisionSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForApplicationRevisionSortByCStr(ApplicationRevisionSortBy value);
 } // namespace ApplicationRevisionSortByMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -36,6 +36,11 @@ namespace AutoRollbackEventMapper
 AWS_CODEDEPLOY_API AutoRollbackEvent GetAutoRollbackEventForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForAutoRollbackEvent(AutoRollbackEvent value);
+
+/**
+ * Same as GetNameForAutoRollbackEvent(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForAutoRollbackEventCStr(AutoRollbackEvent value);
 } // namespace AutoRollbackEventMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -38,6 +38,11 @@ namespace BundleTypeMapper
 AWS_CODEDEPLOY_API BundleType GetBundleTypeForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForBundleType(BundleType value);
+
+/**
+ * Same as GetNameForBundleType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForBundleTypeCStr(BundleType value);
 } // namespace BundleTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -36,6 +36,11 @@ namespace ComputePlatformMapper
 AWS_CODEDEPLOY_API ComputePlatform GetComputePlatformForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForComputePlatform(ComputePlatform value);
+
+/**
+ * Same as GetNameForComputePlatform(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForComputePlatformCStr(ComputePlatform value);
 } // namespace ComputePlatformMapper
 } // namespace Model
 } // namespace CodeDeploy
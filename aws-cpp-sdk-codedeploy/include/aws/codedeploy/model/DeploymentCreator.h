@@ -36,6 +36,11 @@ namespace DeploymentCreatorMapper
 AWS_CODEDEPLOY_API DeploymentCreator GetDeploymentCreatorForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForDeploymentCreator(DeploymentCreator value);
+
+/**
+ * Same as GetNameForDeploymentCreator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForDeploymentCreatorCStr(DeploymentCreator value);
 } // namespace DeploymentCreatorMapper
 } // namespace Model
 } // namespace CodeDeploy
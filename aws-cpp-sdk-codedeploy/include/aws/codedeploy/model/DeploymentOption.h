@@ -35,6 +35,11 @@ namespace DeploymentOptionMapper
 AWS_CODEDEPLOY_API DeploymentOption GetDeploymentOptionForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForDeploymentOption(DeploymentOption value);
+
+/**
+ * Same as GetNameForDeploymentOption(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForDeploymentOptionCStr(DeploymentOption value);
 } // namespace DeploymentOptionMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,6 +35,11 @@ namespace DeploymentReadyActionMapper
 AWS_CODEDEPLOY_API DeploymentReadyAction GetDeploymentReadyActionForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForDeploymentReadyAction(DeploymentReadyAction value);
+
+/**
+ * Same as GetNameForDeploymentReadyAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForDeploymentReadyActionCStr(DeploymentReadyAction value);
 } // namespace DeploymentReadyActionMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -36,6 +36,11 @@ namespace DeploymentTargetTypeMapper
 AWS_CODEDEPLOY_API DeploymentTargetType GetDeploymentTargetTypeForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForDeploymentTargetType(DeploymentTargetType value);
+
+/**
+ * Same as GetNameForDeploymentTargetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForDeploymentTargetTypeCStr(DeploymentTargetType value);
 } // namespace DeploymentTargetTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,6 +35,11 @@ namespace DeploymentWaitTypeMapper
 AWS_CODEDEPLOY_API DeploymentWaitType GetDeploymentWaitTypeForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForDeploymentWaitType(DeploymentWaitType value);
+
+/**
+ * Same as GetNameForDeploymentWaitType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForDeploymentWaitTypeCStr(DeploymentWaitType value);
 } // namespace DeploymentWaitTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -36,6 +36,11 @@ namespace EC2TagFilterTypeMapper
 AWS_CODEDEPLOY_API EC2TagFilterType GetEC2TagFilterTypeForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForEC2TagFilterType(EC2TagFilterType value);
+
+/**
+ * Same as GetNameForEC2TagFilterType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForEC2TagFilterTypeCStr(EC2TagFilterType value);
 } // namespace EC2TagFilterTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -36,6 +36,11 @@ namespace FileExistsBehaviorMapper
 AWS_CODEDEPLOY_API FileExistsBehavior GetFileExistsBehaviorForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForFileExistsBehavior(FileExistsBehavior value);
+
+/**
+ * Same as GetNameForFileExistsBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForFileExistsBehaviorCStr(FileExistsBehavior value);
 } // namespace FileExistsBehaviorMapper
 } // namespace Model
 } // namespace CodeDeploy
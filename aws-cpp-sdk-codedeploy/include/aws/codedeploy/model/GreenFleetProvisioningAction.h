@@ -35,6 +35,11 @@ namespace GreenFleetProvisioningActionMapper
 AWS_CODEDEPLOY_API GreenFleetProvisioningAction GetGreenFleetProvisioningActionForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForGreenFleetProvisioningAction(GreenFleetProvisioningAction value);
+
+/**
+ * Same as GetNameForGreenFleetProvisioningAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForGreenFleetProvisioningActionCStr(GreenFleetProvisioningAction value);
 } // namespace GreenFleetProvisioningActionMapper
 } // namespace Model
 } // namespace CodeDeploy
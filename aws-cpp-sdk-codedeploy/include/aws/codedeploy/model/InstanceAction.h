@@ -35,6 +35,11 @@ namespace InstanceActionMapper
 AWS_CODEDEPLOY_API InstanceAction GetInstanceActionForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForInstanceAction(InstanceAction value);
+
+/**
+ * Same as GetNameForInstanceAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForInstanceActionCStr(InstanceAction value);
 } // namespace InstanceActionMapper
 } // namespace Model
 } // namespace CodeDeploy
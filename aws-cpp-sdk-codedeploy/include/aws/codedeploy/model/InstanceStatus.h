@@ -40,6 +40,11 @@ namespace InstanceStatusMapper
 AWS_CODEDEPLOY_API InstanceStatus GetInstanceStatusForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForInstanceStatus(InstanceStatus value);
+
+/**
+ * Same as GetNameForInstanceStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForInstanceStatusCStr(InstanceStatus value);
 } // namespace InstanceStatusMapper
 } // namespace Model
 } // namespace CodeDeploy
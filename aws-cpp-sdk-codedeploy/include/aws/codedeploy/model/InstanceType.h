@@ -35,6 +35,11 @@ namespace InstanceTypeMapper
 AWS_CODEDEPLOY_API InstanceType GetInstanceTypeForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForInstanceType(InstanceType value);
+
+/**
+ * Same as GetNameForInstanceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForInstanceTypeCStr(InstanceType value);
 } // namespace InstanceTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
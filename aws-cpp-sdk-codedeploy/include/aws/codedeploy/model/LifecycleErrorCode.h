@@ -39,6 +39,11 @@ namespace LifecycleErrorCodeMapper
 AWS_CODEDEPLOY_API LifecycleErrorCode GetLifecycleErrorCodeForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForLifecycleErrorCode(LifecycleErrorCode value);
+
+/**
+ * Same as GetNameForLifecycleErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForLifecycleErrorCodeCStr(LifecycleErrorCode value);
 } // namespace LifecycleErrorCodeMapper
 } // namespace Model
 } // namespace CodeDeploy
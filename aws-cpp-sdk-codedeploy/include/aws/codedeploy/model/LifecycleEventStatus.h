@@ -39,6 +39,11 @@ namespace LifecycleEventStatusMapper
 AWS_CODEDEPLOY_API LifecycleEventStatus GetLifecycleEventStatusForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForLifecycleEventStatus(LifecycleEventStatus value);
+
+/**
+ * Same as GetNameForLifecycleEventStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForLifecycleEventStatusCStr(LifecycleEventStatus value);
 } // namespace LifecycleEventStatusMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -36,6 +36,11 @@ namespace ListStateFilterActionMapper
 AWS_CODEDEPLOY_API ListStateFilterAction GetListStateFilterActionForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForListStateFilterAction(ListStateFilterAction value);
+
+/**
+ * Same as GetNameForListStateFilterAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForListStateFilterActionCStr(ListStateFilterAction value);
 } // namespace ListStateFilterActionMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,6 +35,11 @@ namespace MinimumHealthyHostsTypeMapper
 AWS_CODEDEPLOY_API MinimumHealthyHostsType GetMinimumHealthyHostsTypeForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForMinimumHealthyHostsType(MinimumHealthyHostsType value);
+
+/**
+ * Same as GetNameForMinimumHealthyHostsType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForMinimumHealthyHostsTypeCStr(MinimumHealthyHostsType value);
 } // namespace MinimumHealthyHostsTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,6 +35,11 @@ namespace RegistrationStatusMapper
 AWS_CODEDEPLOY_API RegistrationStatus GetRegistrationStatusForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForRegistrationStatus(RegistrationStatus value);
+
+/**
+ * Same as GetNameForRegistrationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForRegistrationStatusCStr(RegistrationStatus value);
 } // namespace RegistrationStatusMapper
 } // namespace Model
 } // namespace CodeDeploy
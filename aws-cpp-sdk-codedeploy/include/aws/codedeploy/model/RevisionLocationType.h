@@ -37,6 +37,11 @@ namespace RevisionLocationTypeMapper
 AWS_CODEDEPLOY_API RevisionLocationType GetRevisionLocationTypeForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForRevisionLocationType(RevisionLocationType value);
+
+/**
+ * Same as GetNameForRevisionLocationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForRevisionLocationTypeCStr(RevisionLocationType value);
 } // namespace RevisionLocationTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,6 +35,11 @@ namespace StopStatusMapper
 AWS_CODEDEPLOY_API StopStatus GetStopStatusForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForStopStatus(StopStatus value);
+
+/**
+ * Same as GetNameForStopStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForStopStatusCStr(StopStatus value);
 } // namespace StopStatusMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -36,6 +36,11 @@ namespace TagFilterTypeMapper
 AWS_CODEDEPLOY_API TagFilterType GetTagFilterTypeForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForTagFilterType(TagFilterType value);
+
+/**
+ * Same as GetNameForTagFilterType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForTagFilterTypeCStr(TagFilterType value);
 } // namespace TagFilterTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,6 +35,11 @@ namespace TargetFilterNameMapper
 AWS_CODEDEPLOY_API TargetFilterName GetTargetFilterNameForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForTargetFilterName(TargetFilterName value);
+
+/**
+ * Same as GetNameForTargetFilterName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForTargetFilterNameCStr(TargetFilterName value);
 } // namespace TargetFilterNameMapper
 } // namespace Model
 } // namespace CodeDeploy
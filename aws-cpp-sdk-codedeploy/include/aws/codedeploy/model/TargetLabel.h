@@ -35,6 +35,11 @@ namespace TargetLabelMapper
 AWS_CODEDEPLOY_API TargetLabel GetTargetLabelForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForTargetLabel(TargetLabel value);
+
+/**
+ * Same as GetNameForTargetLabel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForTargetLabelCStr(TargetLabel value);
 } // namespace TargetLabelMapper
 } // namespace Model
 } // namespace CodeDeploy
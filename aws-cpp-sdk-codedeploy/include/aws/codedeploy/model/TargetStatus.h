@@ -40,6 +40,11 @@ namespace TargetStatusMapper
 AWS_CODEDEPLOY_API TargetStatus GetTargetStatusForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForTargetStatus(TargetStatus value);
+
+/**
+ * Same as GetNameForTargetStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForTargetStatusCStr(TargetStatus value);
 } // namespace TargetStatusMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -36,6 +36,11 @@ namespace TrafficRoutingTypeMapper
 AWS_CODEDEPLOY_API TrafficRoutingType GetTrafficRoutingTypeForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForTrafficRoutingType(TrafficRoutingType value);
+
+/**
+ * Same as GetNameForTrafficRoutingType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForTrafficRoutingTypeCStr(TrafficRoutingType value);
 } // namespace TrafficRoutingTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -43,6 +43,11 @@ namespace TriggerEventTypeMapper
 AWS_CODEDEPLOY_API TriggerEventType GetTriggerEventTypeForName(const Aws::String& name);
 
 AWS_CODEDEPLOY_API Aws::String GetNameForTriggerEventType(TriggerEventType value);
+
+/**
+ * Same as GetNameForTriggerEventType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEDEPLOY_API const char* GetNameForTriggerEventTypeCStr(TriggerEventType value);
 } // namespace TriggerEventTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
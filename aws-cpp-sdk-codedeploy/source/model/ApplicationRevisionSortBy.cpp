@@ -30,25 +30,44 @@ namespace Aws
       namespace ApplicationRevisionSortByMapper
       {
 
-        static const int registerTime_HASH = HashingUtils::HashString("registerTime");
-        static const int firstUsedTime_HASH = HashingUtils::HashString("firstUsedTime");
-        static const int lastUsedTime_HASH = HashingUtils::HashString("lastUsedTime");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "registerTime",
+          "firstUsedTime",
+          "lastUsedTime",
+        };
 
         ApplicationRevisionSortBy GetApplicationRevisionSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == registerTime_HASH)
-          {
-            return ApplicationRevisionSortBy::registerTime;
-          }
-          else if (hashCode == firstUsedTime_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ApplicationRevisionSortBy::firstUsedTime;
-          }
-          else if (hashCode == lastUsedTime_HASH)
-          {
-            return ApplicationRevisionSortBy::lastUsedTime;
+          case -1707742192:
+            if (name == "registerTime")
+            {
+              return ApplicationRevisionSortBy::registerTime;
+            }
+            break;
+          case 1562120954:
+            if (name == "firstUsedTime")
+            {
+              return ApplicationRevisionSortBy::firstUsedTime;
+            }
+            break;
+          case -1999860512:
+            if (name == "lastUsedTime")
+            {
+              return ApplicationRevisionSortBy::lastUsedTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ApplicationRevisionSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForApplicationRevisionSortBy(ApplicationRevisionSortBy enumValue)
+        const char* GetNameForApplicationRevisionSortByCStr(ApplicationRevisionSortBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ApplicationRevisionSortBy::registerTime:
-            return "registerTime";
-          case ApplicationRevisionSortBy::firstUsedTime:
-            return "firstUsedTime";
-          case ApplicationRevisionSortBy::lastUsedTime:
-            return "lastUsedTime";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForApplicationRevisionSortBy(ApplicationRevisionSortBy enumValue)
+        {
+          return GetNameForApplicationRevisionSortByCStr(enumValue);
         }
 
       } // namespace ApplicationRevisionSortByMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AutoRollbackEventMapper
       {
 
-        static const int DEPLOYMENT_FAILURE_HASH = HashingUtils::HashString("DEPLOYMENT_FAILURE");
-        static const int DEPLOYMENT_STOP_ON_ALARM_HASH = HashingUtils::HashString("DEPLOYMENT_STOP_ON_ALARM");
-        static const int DEPLOYMENT_STOP_ON_REQUEST_HASH = HashingUtils::HashString("DEPLOYMENT_STOP_ON_REQUEST");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEPLOYMENT_FAILURE",
+          "DEPLOYMENT_STOP_ON_ALARM",
+          "DEPLOYMENT_STOP_ON_REQUEST",
+        };
 
         AutoRollbackEvent GetAutoRollbackEventForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEPLOYMENT_FAILURE_HASH)
-          {
-            return AutoRollbackEvent::DEPLOYMENT_FAILURE;
-          }
-          else if (hashCode == DEPLOYMENT_STOP_ON_ALARM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AutoRollbackEvent::DEPLOYMENT_STOP_ON_ALARM;
-          }
-          else if (hashCode == DEPLOYMENT_STOP_ON_REQUEST_HASH)
-          {
-            return AutoRollbackEvent::DEPLOYMENT_STOP_ON_REQUEST;
+          case -1145080336:
+            if (name == "DEPLOYMENT_FAILURE")
+            {
+              return AutoRollbackEvent::DEPLOYMENT_FAILURE;
+            }
+            break;
+          case -1816618124:
+            if (name == "DEPLOYMENT_STOP_ON_ALARM")
+            {
+              return AutoRollbackEvent::DEPLOYMENT_STOP_ON_ALARM;
+            }
+            break;
+          case 3822322:
+            if (name == "DEPLOYMENT_STOP_ON_REQUEST")
+            {
+              return AutoRollbackEvent::DEPLOYMENT_STOP_ON_REQUEST;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AutoRollbackEvent::NOT_SET;
         }
 
-        Aws::String GetNameForAutoRollbackEvent(AutoRollbackEvent enumValue)
+        const char* GetNameForAutoRollbackEventCStr(AutoRollbackEvent enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AutoRollbackEvent::DEPLOYMENT_FAILURE:
-            return "DEPLOYMENT_FAILURE";
-          case AutoRollbackEvent::DEPLOYMENT_STOP_ON_ALARM:
-            return "DEPLOYMENT_STOP_ON_ALARM";
-          case AutoRollbackEvent::DEPLOYMENT_STOP_ON_REQUEST:
-            return "DEPLOYMENT_STOP_ON_REQUEST";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAutoRollbackEvent(AutoRollbackEvent enumValue)
+        {
+          return GetNameForAutoRollbackEventCStr(enumValue);
         }
 
       } // namespace AutoRollbackEventMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace BundleTypeMapper
       {
 
-        static const int tar_HASH = HashingUtils::HashString("tar");
-        static const int tgz_HASH = HashingUtils::HashString("tgz");
-        static const int zip_HASH = HashingUtils::HashString("zip");
-        static const int YAML_HASH = HashingUtils::HashString("YAML");
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "tar",
+          "tgz",
+          "zip",
+          "YAML",
+          "JSON",
+        };
 
         BundleType GetBundleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == tar_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BundleType::tar;
-          }
-          else if (hashCode == tgz_HASH)
-          {
-            return BundleType::tgz;
-          }
-          else if (hashCode == zip_HASH)
-          {
-            return BundleType::zip;
-          }
-          else if (hashCode == YAML_HASH)
-          {
-            return BundleType::YAML;
-          }
-          else if (hashCode == JSON_HASH)
-          {
-            return BundleType::JSON;
+          case 114597:
+            if (name == "tar")
+            {
+              return BundleType::tar;
+            }
+            break;
+          case 114791:
+            if (name == "tgz")
+            {
+              return BundleType::tgz;
+            }
+            break;
+          case 120609:
+            if (name == "zip")
+            {
+              return BundleType::zip;
+            }
+            break;
+          case 2716327:
+            if (name == "YAML")
+            {
+              return BundleType::YAML;
+            }
+            break;
+          case 2286824:
+            if (name == "JSON")
+            {
+              return BundleType::JSON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return BundleType::NOT_SET;
         }
 
-        Aws::String GetNameForBundleType(BundleType enumValue)
+        const char* GetNameForBundleTypeCStr(BundleType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BundleType::tar:
-            return "tar";
-          case BundleType::tgz:
-            return "tgz";
-          case BundleType::zip:
-            return "zip";
-          case BundleType::YAML:
-            return "YAML";
-          case BundleType::JSON:
-            return "JSON";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBundleType(BundleType enumValue)
+        {
+          return GetNameForBundleTypeCStr(enumValue);
         }
 
       } // namespace BundleTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ComputePlatformMapper
       {
 
-        static const int Server_HASH = HashingUtils::HashString("Server");
-        static const int Lambda_HASH = HashingUtils::HashString("Lambda");
-        static const int ECS_HASH = HashingUtils::HashString("ECS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Server",
+          "Lambda",
+          "ECS",
+        };
 
         ComputePlatform GetComputePlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Server_HASH)
-          {
-            return ComputePlatform::Server;
-          }
-          else if (hashCode == Lambda_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComputePlatform::Lambda;
-          }
-          else if (hashCode == ECS_HASH)
-          {
-            return ComputePlatform::ECS;
+          case -1821959325:
+            if (name == "Server")
+            {
+              return ComputePlatform::Server;
+            }
+            break;
+          case -2026225689:
+            if (name == "Lambda")
+            {
+              return ComputePlatform::Lambda;
+            }
+            break;
+          case 68469:
+            if (name == "ECS")
+            {
+              return ComputePlatform::ECS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ComputePlatform::NOT_SET;
         }
 
-        Aws::String GetNameForComputePlatform(ComputePlatform enumValue)
+        const char* GetNameForComputePlatformCStr(ComputePlatform enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComputePlatform::Server:
-            return "Server";
-          case ComputePlatform::Lambda:
-            return "Lambda";
-          case ComputePlatform::ECS:
-            return "ECS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComputePlatform(ComputePlatform enumValue)
+        {
+          return GetNameForComputePlatformCStr(enumValue);
         }
 
       } // namespace ComputePlatformMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DeploymentCreatorMapper
       {
 
-        static const int user_HASH = HashingUtils::HashString("user");
-        static const int autoscaling_HASH = HashingUtils::HashString("autoscaling");
-        static const int codeDeployRollback_HASH = HashingUtils::HashString("codeDeployRollback");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "user",
+          "autoscaling",
+          "codeDeployRollback",
+        };
 
         DeploymentCreator GetDeploymentCreatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == user_HASH)
-          {
-            return DeploymentCreator::user;
-          }
-          else if (hashCode == autoscaling_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentCreator::autoscaling;
-          }
-          else if (hashCode == codeDeployRollback_HASH)
-          {
-            return DeploymentCreator::codeDeployRollback;
+          case 3599307:
+            if (name == "user")
+            {
+              return DeploymentCreator::user;
+            }
+            break;
+          case -1144837384:
+            if (name == "autoscaling")
+            {
+              return DeploymentCreator::autoscaling;
+            }
+            break;
+          case -906226632:
+            if (name == "codeDeployRollback")
+            {
+              return DeploymentCreator::codeDeployRollback;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DeploymentCreator::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentCreator(DeploymentCreator enumValue)
+        const char* GetNameForDeploymentCreatorCStr(DeploymentCreator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentCreator::user:
-            return "user";
-          case DeploymentCreator::autoscaling:
-            return "autoscaling";
-          case DeploymentCreator::codeDeployRollback:
-            return "codeDeployRollback";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentCreator(DeploymentCreator enumValue)
+        {
+          return GetNameForDeploymentCreatorCStr(enumValue);
         }
 
       } // namespace DeploymentCreatorMapper
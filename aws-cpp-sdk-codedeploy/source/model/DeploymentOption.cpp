@@ -30,20 +30,37 @@ namespace Aws
       namespace DeploymentOptionMapper
       {
 
-        static const int WITH_TRAFFIC_CONTROL_HASH = HashingUtils::HashString("WITH_TRAFFIC_CONTROL");
-        static const int WITHOUT_TRAFFIC_CONTROL_HASH = HashingUtils::HashString("WITHOUT_TRAFFIC_CONTROL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WITH_TRAFFIC_CONTROL",
+          "WITHOUT_TRAFFIC_CONTROL",
+        };
 
         DeploymentOption GetDeploymentOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WITH_TRAFFIC_CONTROL_HASH)
-          {
-            return DeploymentOption::WITH_TRAFFIC_CONTROL;
-          }
-          else if (hashCode == WITHOUT_TRAFFIC_CONTROL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentOption::WITHOUT_TRAFFIC_CONTROL;
+          case -558707870:
+            if (name == "WITH_TRAFFIC_CONTROL")
+            {
+              return DeploymentOption::WITH_TRAFFIC_CONTROL;
+            }
+            break;
+          case 1609280324:
+            if (name == "WITHOUT_TRAFFIC_CONTROL")
+            {
+              return DeploymentOption::WITHOUT_TRAFFIC_CONTROL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeploymentOption::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentOption(DeploymentOption enumValue)
+        const char* GetNameForDeploymentOptionCStr(DeploymentOption enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentOption::WITH_TRAFFIC_CONTROL:
-            return "WITH_TRAFFIC_CONTROL";
-          case DeploymentOption::WITHOUT_TRAFFIC_CONTROL:
-            return "WITHOUT_TRAFFIC_CONTROL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentOption(DeploymentOption enumValue)
+        {
+          return GetNameForDeploymentOptionCStr(enumValue);
         }
 
       } // namespace DeploymentOptionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DeploymentReadyActionMapper
       {
 
-        static const int CONTINUE_DEPLOYMENT_HASH = HashingUtils::HashString("CONTINUE_DEPLOYMENT");
-        static const int STOP_DEPLOYMENT_HASH = HashingUtils::HashString("STOP_DEPLOYMENT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONTINUE_DEPLOYMENT",
+          "STOP_DEPLOYMENT",
+        };
 
         DeploymentReadyAction GetDeploymentReadyActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONTINUE_DEPLOYMENT_HASH)
-          {
-            return DeploymentReadyAction::CONTINUE_DEPLOYMENT;
-          }
-          else if (hashCode == STOP_DEPLOYMENT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentReadyAction::STOP_DEPLOYMENT;
+          case -1692057251:
+            if (name == "CONTINUE_DEPLOYMENT")
+            {
+              return DeploymentReadyAction::CONTINUE_DEPLOYMENT;
+            }
+            break;
+          case 306136866:
+            if (name == "STOP_DEPLOYMENT")
+            {
+              return DeploymentReadyAction::STOP_DEPLOYMENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeploymentReadyAction::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentReadyAction(DeploymentReadyAction enumValue)
+        const char* GetNameForDeploymentReadyActionCStr(DeploymentReadyAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentReadyAction::CONTINUE_DEPLOYMENT:
-            return "CONTINUE_DEPLOYMENT";
-          case DeploymentReadyAction::STOP_DEPLOYMENT:
-            return "STOP_DEPLOYMENT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentReadyAction(DeploymentReadyAction enumValue)
+        {
+          return GetNameForDeploymentReadyActionCStr(enumValue);
         }
 
       } // namespace DeploymentReadyActionMapper
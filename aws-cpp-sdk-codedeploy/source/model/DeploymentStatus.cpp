@@ -30,45 +30,72 @@ namespace Aws
       namespace DeploymentStatusMapper
       {
 
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Queued_HASH = HashingUtils::HashString("Queued");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-        static const int Ready_HASH = HashingUtils::HashString("Ready");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Created",
+          "Queued",
+          "InProgress",
+          "Succeeded",
+          "Failed",
+          "Stopped",
+          "Ready",
+        };
 
         DeploymentStatus GetDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Created_HASH)
-          {
-            return DeploymentStatus::Created;
-          }
-          else if (hashCode == Queued_HASH)
-          {
-            return DeploymentStatus::Queued;
-          }
-          else if (hashCode == InProgress_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return DeploymentStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return DeploymentStatus::Failed;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return DeploymentStatus::Stopped;
-          }
-          else if (hashCode == Ready_HASH)
-          {
-            return DeploymentStatus::Ready;
+          case -1601759544:
+            if (name == "Created")
+            {
+              return DeploymentStatus::Created;
+            }
+            break;
+          case -1864829549:
+            if (name == "Queued")
+            {
+              return DeploymentStatus::Queued;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return DeploymentStatus::InProgress;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return DeploymentStatus::Succeeded;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return DeploymentStatus::Failed;
+            }
+            break;
+          case -219666003:
+            if (name == "Stopped")
+            {
+              return DeploymentStatus::Stopped;
+            }
+            break;
+          case 78834051:
+            if (name == "Ready")
+            {
+              return DeploymentStatus::Ready;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return DeploymentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentStatus(DeploymentStatus enumValue)
+        const char* GetNameForDeploymentStatusCStr(DeploymentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentStatus::Created:
-            return "Created";
-          case DeploymentStatus::Queued:
-            return "Queued";
-          case DeploymentStatus::InProgress:
-            return "InProgress";
-          case DeploymentStatus::Succeeded:
-            return "Succeeded";
-          case DeploymentStatus::Failed:
-            return "Failed";
-          case DeploymentStatus::Stopped:
-            return "Stopped";
-          case DeploymentStatus::Ready:
-            return "Ready";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentStatus(DeploymentStatus enumValue)
+        {
+          return GetNameForDeploymentStatusCStr(enumValue);
         }
 
       } // namespace DeploymentStatusMapper
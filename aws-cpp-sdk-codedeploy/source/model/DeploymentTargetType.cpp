@@ -30,25 +30,44 @@ namespace Aws
       namespace DeploymentTargetTypeMapper
       {
 
-        static const int InstanceTarget_HASH = HashingUtils::HashString("InstanceTarget");
-        static const int LambdaTarget_HASH = HashingUtils::HashString("LambdaTarget");
-        static const int ECSTarget_HASH = HashingUtils::HashString("ECSTarget");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InstanceTarget",
+          "LambdaTarget",
+          "ECSTarget",
+        };
 
         DeploymentTargetType GetDeploymentTargetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InstanceTarget_HASH)
-          {
-            return DeploymentTargetType::InstanceTarget;
-          }
-          else if (hashCode == LambdaTarget_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentTargetType::LambdaTarget;
-          }
-          else if (hashCode == ECSTarget_HASH)
-          {
-            return DeploymentTargetType::ECSTarget;
+          case -1241367898:
+            if (name == "InstanceTarget")
+            {
+              return DeploymentTargetType::InstanceTarget;
+            }
+            break;
+          case -1393437608:
+            if (name == "LambdaTarget")
+            {
+              return DeploymentTargetType::LambdaTarget;
+            }
+            break;
+          case -504808090:
+            if (name == "ECSTarget")
+            {
+              return DeploymentTargetType::ECSTarget;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DeploymentTargetType::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentTargetType(DeploymentTargetType enumValue)
+        const char* GetNameForDeploymentTargetTypeCStr(DeploymentTargetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentTargetType::InstanceTarget:
-            return "InstanceTarget";
-          case DeploymentTargetType::LambdaTarget:
-            return "LambdaTarget";
-          case DeploymentTargetType::ECSTarget:
-            return "ECSTarget";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentTargetType(DeploymentTargetType enumValue)
+        {
+          return GetNameForDeploymentTargetTypeCStr(enumValue);
         }
 
       } // namespace DeploymentTargetTypeMapper
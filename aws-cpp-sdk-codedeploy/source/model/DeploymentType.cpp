@@ -30,20 +30,37 @@ namespace Aws
       namespace DeploymentTypeMapper
       {
 
-        static const int IN_PLACE_HASH = HashingUtils::HashString("IN_PLACE");
-        static const int BLUE_GREEN_HASH = HashingUtils::HashString("BLUE_GREEN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PLACE",
+          "BLUE_GREEN",
+        };
 
         DeploymentType GetDeploymentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PLACE_HASH)
-          {
-            return DeploymentType::IN_PLACE;
-          }
-          else if (hashCode == BLUE_GREEN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentType::BLUE_GREEN;
+          case 1677925709:
+            if (name == "IN_PLACE")
+            {
+              return DeploymentType::IN_PLACE;
+            }
+            break;
+          case 1698510526:
+            if (name == "BLUE_GREEN")
+            {
+              return DeploymentType::BLUE_GREEN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeploymentType::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentType(DeploymentType enumValue)
+        const char* GetNameForDeploymentTypeCStr(DeploymentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentType::IN_PLACE:
-            return "IN_PLACE";
-          case DeploymentType::BLUE_GREEN:
-            return "BLUE_GREEN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentType(DeploymentType enumValue)
+        {
+          return GetNameForDeploymentTypeCStr(enumValue);
         }
 
       } // namespace DeploymentTypeMapper
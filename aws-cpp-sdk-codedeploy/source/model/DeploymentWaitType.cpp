@@ -30,20 +30,37 @@ namespace Aws
       namespace DeploymentWaitTypeMapper
       {
 
-        static const int READY_WAIT_HASH = HashingUtils::HashString("READY_WAIT");
-        static const int TERMINATION_WAIT_HASH = HashingUtils::HashString("TERMINATION_WAIT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "READY_WAIT",
+          "TERMINATION_WAIT",
+        };
 
         DeploymentWaitType GetDeploymentWaitTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == READY_WAIT_HASH)
-          {
-            return DeploymentWaitType::READY_WAIT;
-          }
-          else if (hashCode == TERMINATION_WAIT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentWaitType::TERMINATION_WAIT;
+          case 1083103921:
+            if (name == "READY_WAIT")
+            {
+              return DeploymentWaitType::READY_WAIT;
+            }
+            break;
+          case 195302896:
+            if (name == "TERMINATION_WAIT")
+            {
+              return DeploymentWaitType::TERMINATION_WAIT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeploymentWaitType::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentWaitType(DeploymentWaitType enumValue)
+        const char* GetNameForDeploymentWaitTypeCStr(DeploymentWaitType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentWaitType::READY_WAIT:
-            return "READY_WAIT";
-          case DeploymentWaitType::TERMINATION_WAIT:
-            return "TERMINATION_WAIT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentWaitType(DeploymentWaitType enumValue)
+        {
+          return GetNameForDeploymentWaitTypeCStr(enumValue);
         }
 
       } // namespace DeploymentWaitTypeMapper
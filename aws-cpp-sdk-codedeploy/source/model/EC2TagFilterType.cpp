@@ -30,25 +30,44 @@ namespace Aws
       namespace EC2TagFilterTypeMapper
       {
 
-        static const int KEY_ONLY_HASH = HashingUtils::HashString("KEY_ONLY");
-        static const int VALUE_ONLY_HASH = HashingUtils::HashString("VALUE_ONLY");
-        static const int KEY_AND_VALUE_HASH = HashingUtils::HashString("KEY_AND_VALUE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "KEY_ONLY",
+          "VALUE_ONLY",
+          "KEY_AND_VALUE",
+        };
 
         EC2TagFilterType GetEC2TagFilterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == KEY_ONLY_HASH)
-          {
-            return EC2TagFilterType::KEY_ONLY;
-          }
-          else if (hashCode == VALUE_ONLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EC2TagFilterType::VALUE_ONLY;
-          }
-          else if (hashCode == KEY_AND_VALUE_HASH)
-          {
-            return EC2TagFilterType::KEY_AND_VALUE;
+          case 1313160620:
+            if (name == "KEY_ONLY")
+            {
+              return EC2TagFilterType::KEY_ONLY;
+            }
+            break;
+          case -1737137702:
+            if (name == "VALUE_ONLY")
+            {
+              return EC2TagFilterType::VALUE_ONLY;
+            }
+            break;
+          case 1579298505:
+            if (name == "KEY_AND_VALUE")
+            {
+              return EC2TagFilterType::KEY_AND_VALUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EC2TagFilterType::NOT_SET;
         }
 
-        Aws::String GetNameForEC2TagFilterType(EC2TagFilterType enumValue)
+        const char* GetNameForEC2TagFilterTypeCStr(EC2TagFilterType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EC2TagFilterType::KEY_ONLY:
-            return "KEY_ONLY";
-          case EC2TagFilterType::VALUE_ONLY:
-            return "VALUE_ONLY";
-          case EC2TagFilterType::KEY_AND_VALUE:
-            return "KEY_AND_VALUE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEC2TagFilterType(EC2TagFilterType enumValue)
+        {
+          return GetNameForEC2TagFilterTypeCStr(enumValue);
         }
 
       } // namespace EC2TagFilterTypeMapper
@@ -30,160 +30,233 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int DEPLOYMENT_GROUP_MISSING_HASH = HashingUtils::HashString("DEPLOYMENT_GROUP_MISSING");
-        static const int APPLICATION_MISSING_HASH = HashingUtils::HashString("APPLICATION_MISSING");
-        static const int REVISION_MISSING_HASH = HashingUtils::HashString("REVISION_MISSING");
-        static const int IAM_ROLE_MISSING_HASH = HashingUtils::HashString("IAM_ROLE_MISSING");
-        static const int IAM_ROLE_PERMISSIONS_HASH = HashingUtils::HashString("IAM_ROLE_PERMISSIONS");
-        static const int NO_EC2_SUBSCRIPTION_HASH = HashingUtils::HashString("NO_EC2_SUBSCRIPTION");
-        static const int OVER_MAX_INSTANCES_HASH = HashingUtils::HashString("OVER_MAX_INSTANCES");
-        static const int NO_INSTANCES_HASH = HashingUtils::HashString("NO_INSTANCES");
-        static const int TIMEOUT_HASH = HashingUtils::HashString("TIMEOUT");
-        static const int HEALTH_CONSTRAINTS_INVALID_HASH = HashingUtils::HashString("HEALTH_CONSTRAINTS_INVALID");
-        static const int HEALTH_CONSTRAINTS_HASH = HashingUtils::HashString("HEALTH_CONSTRAINTS");
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int THROTTLED_HASH = HashingUtils::HashString("THROTTLED");
-        static const int ALARM_ACTIVE_HASH = HashingUtils::HashString("ALARM_ACTIVE");
-        static const int AGENT_ISSUE_HASH = HashingUtils::HashString("AGENT_ISSUE");
-        static const int AUTO_SCALING_IAM_ROLE_PERMISSIONS_HASH = HashingUtils::HashString("AUTO_SCALING_IAM_ROLE_PERMISSIONS");
-        static const int AUTO_SCALING_CONFIGURATION_HASH = HashingUtils::HashString("AUTO_SCALING_CONFIGURATION");
-        static const int MANUAL_STOP_HASH = HashingUtils::HashString("MANUAL_STOP");
-        static const int MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION_HASH = HashingUtils::HashString("MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION");
-        static const int MISSING_ELB_INFORMATION_HASH = HashingUtils::HashString("MISSING_ELB_INFORMATION");
-        static const int MISSING_GITHUB_TOKEN_HASH = HashingUtils::HashString("MISSING_GITHUB_TOKEN");
-        static const int ELASTIC_LOAD_BALANCING_INVALID_HASH = HashingUtils::HashString("ELASTIC_LOAD_BALANCING_INVALID");
-        static const int ELB_INVALID_INSTANCE_HASH = HashingUtils::HashString("ELB_INVALID_INSTANCE");
-        static const int INVALID_LAMBDA_CONFIGURATION_HASH = HashingUtils::HashString("INVALID_LAMBDA_CONFIGURATION");
-        static const int INVALID_LAMBDA_FUNCTION_HASH = HashingUtils::HashString("INVALID_LAMBDA_FUNCTION");
-        static const int HOOK_EXECUTION_FAILURE_HASH = HashingUtils::HashString("HOOK_EXECUTION_FAILURE");
-        static const int AUTOSCALING_VALIDATION_ERROR_HASH = HashingUtils::HashString("AUTOSCALING_VALIDATION_ERROR");
-        static const int INVALID_ECS_SERVICE_HASH = HashingUtils::HashString("INVALID_ECS_SERVICE");
-        static const int ECS_UPDATE_ERROR_HASH = HashingUtils::HashString("ECS_UPDATE_ERROR");
-        static const int INVALID_REVISION_HASH = HashingUtils::HashString("INVALID_REVISION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEPLOYMENT_GROUP_MISSING",
+          "APPLICATION_MISSING",
+          "REVISION_MISSING",
+          "IAM_ROLE_MISSING",
+          "IAM_ROLE_PERMISSIONS",
+          "NO_EC2_SUBSCRIPTION",
+          "OVER_MAX_INSTANCES",
+          "NO_INSTANCES",
+          "TIMEOUT",
+          "HEALTH_CONSTRAINTS_INVALID",
+          "HEALTH_CONSTRAINTS",
+          "INTERNAL_ERROR",
+          "THROTTLED",
+          "ALARM_ACTIVE",
+          "AGENT_ISSUE",
+          "AUTO_SCALING_IAM_ROLE_PERMISSIONS",
+          "AUTO_SCALING_CONFIGURATION",
+          "MANUAL_STOP",
+          "MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION",
+          "MISSING_ELB_INFORMATION",
+          "MISSING_GITHUB_TOKEN",
+          "ELASTIC_LOAD_BALANCING_INVALID",
+          "ELB_INVALID_INSTANCE",
+          "INVALID_LAMBDA_CONFIGURATION",
+          "INVALID_LAMBDA_FUNCTION",
+          "HOOK_EXECUTION_FAILURE",
+          "AUTOSCALING_VALIDATION_ERROR",
+          "INVALID_ECS_SERVICE",
+          "ECS_UPDATE_ERROR",
+          "INVALID_REVISION",
+        };
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEPLOYMENT_GROUP_MISSING_HASH)
-          {
-            return ErrorCode::DEPLOYMENT_GROUP_MISSING;
-          }
-          else if (hashCode == APPLICATION_MISSING_HASH)
-          {
-            return ErrorCode::APPLICATION_MISSING;
-          }
-          else if (hashCode == REVISION_MISSING_HASH)
-          {
-            return ErrorCode::REVISION_MISSING;
-          }
-          else if (hashCode == IAM_ROLE_MISSING_HASH)
-          {
-            return ErrorCode::IAM_ROLE_MISSING;
-          }
-          else if (hashCode == IAM_ROLE_PERMISSIONS_HASH)
-          {
-            return ErrorCode::IAM_ROLE_PERMISSIONS;
-          }
-          else if (hashCode == NO_EC2_SUBSCRIPTION_HASH)
-          {
-            return ErrorCode::NO_EC2_SUBSCRIPTION;
-          }
-          else if (hashCode == OVER_MAX_INSTANCES_HASH)
-          {
-            return ErrorCode::OVER_MAX_INSTANCES;
-          }
-          else if (hashCode == NO_INSTANCES_HASH)
-          {
-            return ErrorCode::NO_INSTANCES;
-          }
-          else if (hashCode == TIMEOUT_HASH)
-          {
-            return ErrorCode::TIMEOUT;
-          }
-          else if (hashCode == HEALTH_CONSTRAINTS_INVALID_HASH)
-          {
-            return ErrorCode::HEALTH_CONSTRAINTS_INVALID;
-          }
-          else if (hashCode == HEALTH_CONSTRAINTS_HASH)
-          {
-            return ErrorCode::HEALTH_CONSTRAINTS;
-          }
-          else if (hashCode == INTERNAL_ERROR_HASH)
-          {
-            return ErrorCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == THROTTLED_HASH)
-          {
-            return ErrorCode::THROTTLED;
-          }
-          else if (hashCode == ALARM_ACTIVE_HASH)
-          {
-            return ErrorCode::ALARM_ACTIVE;
-          }
-          else if (hashCode == AGENT_ISSUE_HASH)
-          {
-            return ErrorCode::AGENT_ISSUE;
-          }
-          else if (hashCode == AUTO_SCALING_IAM_ROLE_PERMISSIONS_HASH)
-          {
-            return ErrorCode::AUTO_SCALING_IAM_ROLE_PERMISSIONS;
-          }
-          else if (hashCode == AUTO_SCALING_CONFIGURATION_HASH)
-          {
-            return ErrorCode::AUTO_SCALING_CONFIGURATION;
-          }
-          else if (hashCode == MANUAL_STOP_HASH)
-          {
-            return ErrorCode::MANUAL_STOP;
-          }
-          else if (hashCode == MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION_HASH)
-          {
-            return ErrorCode::MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION;
-          }
-          else if (hashCode == MISSING_ELB_INFORMATION_HASH)
-          {
-            return ErrorCode::MISSING_ELB_INFORMATION;
-          }
-          else if (hashCode == MISSING_GITHUB_TOKEN_HASH)
-          {
-            return ErrorCode::MISSING_GITHUB_TOKEN;
-          }
-          else if (hashCode == ELASTIC_LOAD_BALANCING_INVALID_HASH)
-          {
-            return ErrorCode::ELASTIC_LOAD_BALANCING_INVALID;
-          }
-          else if (hashCode == ELB_INVALID_INSTANCE_HASH)
-          {
-            return ErrorCode::ELB_INVALID_INSTANCE;
-          }
-          else if (hashCode == INVALID_LAMBDA_CONFIGURATION_HASH)
-          {
-            return ErrorCode::INVALID_LAMBDA_CONFIGURATION;
-          }
-          else if (hashCode == INVALID_LAMBDA_FUNCTION_HASH)
-          {
-            return ErrorCode::INVALID_LAMBDA_FUNCTION;
-          }
-          else if (hashCode == HOOK_EXECUTION_FAILURE_HASH)
-          {
-            return ErrorCode::HOOK_EXECUTION_FAILURE;
-          }
-          else if (hashCode == AUTOSCALING_VALIDATION_ERROR_HASH)
-          {
-            return ErrorCode::AUTOSCALING_VALIDATION_ERROR;
-          }
-          else if (hashCode == INVALID_ECS_SERVICE_HASH)
-          {
-            return ErrorCode::INVALID_ECS_SERVICE;
-          }
-          else if (hashCode == ECS_UPDATE_ERROR_HASH)
-          {
-            return ErrorCode::ECS_UPDATE_ERROR;
-          }
-          else if (hashCode == INVALID_REVISION_HASH)
-          {
-            return ErrorCode::INVALID_REVISION;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1874813076:
+            if (name == "DEPLOYMENT_GROUP_MISSING")
+            {
+              return ErrorCode::DEPLOYMENT_GROUP_MISSING;
+            }
+            break;
+          case -1606607561:
+            if (name == "APPLICATION_MISSING")
+            {
+              return ErrorCode::APPLICATION_MISSING;
+            }
+            break;
+          case -685223710:
+            if (name == "REVISION_MISSING")
+            {
+              return ErrorCode::REVISION_MISSING;
+            }
+            break;
+          case 1920377927:
+            if (name == "IAM_ROLE_MISSING")
+            {
+              return ErrorCode::IAM_ROLE_MISSING;
+            }
+            break;
+          case 1170061029:
+            if (name == "IAM_ROLE_PERMISSIONS")
+            {
+              return ErrorCode::IAM_ROLE_PERMISSIONS;
+            }
+            break;
+          case -786720026:
+            if (name == "NO_EC2_SUBSCRIPTION")
+            {
+              return ErrorCode::NO_EC2_SUBSCRIPTION;
+            }
+            break;
+          case 1462923512:
+            if (name == "OVER_MAX_INSTANCES")
+            {
+              return ErrorCode::OVER_MAX_INSTANCES;
+            }
+            break;
+          case -1714907808:
+            if (name == "NO_INSTANCES")
+            {
+              return ErrorCode::NO_INSTANCES;
+            }
+            break;
+          case -595928767:
+            if (name == "TIMEOUT")
+            {
+              return ErrorCode::TIMEOUT;
+            }
+            break;
+          case 1509533259:
+            if (name == "HEALTH_CONSTRAINTS_INVALID")
+            {
+              return ErrorCode::HEALTH_CONSTRAINTS_INVALID;
+            }
+            break;
+          case 655942835:
+            if (name == "HEALTH_CONSTRAINTS")
+            {
+              return ErrorCode::HEALTH_CONSTRAINTS;
+            }
+            break;
+          case -485608986:
+            if (name == "INTERNAL_ERROR")
+            {
+              return ErrorCode::INTERNAL_ERROR;
+            }
+            break;
+          case 1528687194:
+            if (name == "THROTTLED")
+            {
+              return ErrorCode::THROTTLED;
+            }
+            break;
+          case -8502060:
+            if (name == "ALARM_ACTIVE")
+            {
+              return ErrorCode::ALARM_ACTIVE;
+            }
+            break;
+          case 760274655:
+            if (name == "AGENT_ISSUE")
+            {
+              return ErrorCode::AGENT_ISSUE;
+            }
+            break;
+          case 365177165:
+            if (name == "AUTO_SCALING_IAM_ROLE_PERMISSIONS")
+            {
+              return ErrorCode::AUTO_SCALING_IAM_ROLE_PERMISSIONS;
+            }
+            break;
+          case -886472850:
+            if (name == "AUTO_SCALING_CONFIGURATION")
+            {
+              return ErrorCode::AUTO_SCALING_CONFIGURATION;
+            }
+            break;
+          case 1871988955:
+            if (name == "MANUAL_STOP")
+            {
+              return ErrorCode::MANUAL_STOP;
+            }
+            break;
+          case -1991809852:
+            if (name == "MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION")
+            {
+              return ErrorCode::MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION;
+            }
+            break;
+          case 247310927:
+            if (name == "MISSING_ELB_INFORMATION")
+            {
+              return ErrorCode::MISSING_ELB_INFORMATION;
+            }
+            break;
+          case 1225530582:
+            if (name == "MISSING_GITHUB_TOKEN")
+            {
+              return ErrorCode::MISSING_GITHUB_TOKEN;
+            }
+            break;
+          case 592858562:
+            if (name == "ELASTIC_LOAD_BALANCING_INVALID")
+            {
+              return ErrorCode::ELASTIC_LOAD_BALANCING_INVALID;
+            }
+            break;
+          case 866800961:
+            if (name == "ELB_INVALID_INSTANCE")
+            {
+              return ErrorCode::ELB_INVALID_INSTANCE;
+            }
+            break;
+          case 1411807174:
+            if (name == "INVALID_LAMBDA_CONFIGURATION")
+            {
+              return ErrorCode::INVALID_LAMBDA_CONFIGURATION;
+            }
+            break;
+          case 1211458280:
+            if (name == "INVALID_LAMBDA_FUNCTION")
+            {
+              return ErrorCode::INVALID_LAMBDA_FUNCTION;
+            }
+            break;
+          case 923335431:
+            if (name == "HOOK_EXECUTION_FAILURE")
+            {
+              return ErrorCode::HOOK_EXECUTION_FAILURE;
+            }
+            break;
+          case -2028429015:
+            if (name == "AUTOSCALING_VALIDATION_ERROR")
+            {
+              return ErrorCode::AUTOSCALING_VALIDATION_ERROR;
+            }
+            break;
+          case -2065002141:
+            if (name == "INVALID_ECS_SERVICE")
+            {
+              return ErrorCode::INVALID_ECS_SERVICE;
+            }
+            break;
+          case -1432661124:
+            if (name == "ECS_UPDATE_ERROR")
+            {
+              return ErrorCode::ECS_UPDATE_ERROR;
+            }
+            break;
+          case -382796477:
+            if (name == "INVALID_REVISION")
+            {
+              return ErrorCode::INVALID_REVISION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -195,79 +268,26 @@ namespace Aws
           return ErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        const char* GetNameForErrorCodeCStr(ErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ErrorCode::DEPLOYMENT_GROUP_MISSING:
-            return "DEPLOYMENT_GROUP_MISSING";
-          case ErrorCode::APPLICATION_MISSING:
-            return "APPLICATION_MISSING";
-          case ErrorCode::REVISION_MISSING:
-            return "REVISION_MISSING";
-          case ErrorCode::IAM_ROLE_MISSING:
-            return "IAM_ROLE_MISSING";
-          case ErrorCode::IAM_ROLE_PERMISSIONS:
-            return "IAM_ROLE_PERMISSIONS";
-          case ErrorCode::NO_EC2_SUBSCRIPTION:
-            return "NO_EC2_SUBSCRIPTION";
-          case ErrorCode::OVER_MAX_INSTANCES:
-            return "OVER_MAX_INSTANCES";
-          case ErrorCode::NO_INSTANCES:
-            return "NO_INSTANCES";
-          case ErrorCode::TIMEOUT:
-            return "TIMEOUT";
-          case ErrorCode::HEALTH_CONSTRAINTS_INVALID:
-            return "HEALTH_CONSTRAINTS_INVALID";
-          case ErrorCode::HEALTH_CONSTRAINTS:
-            return "HEALTH_CONSTRAINTS";
-          case ErrorCode::INTERNAL_ERROR:
-            return "INTERNAL_ERROR";
-          case ErrorCode::THROTTLED:
-            return "THROTTLED";
-          case ErrorCode::ALARM_ACTIVE:
-            return "ALARM_ACTIVE";
-          case ErrorCode::AGENT_ISSUE:
-            return "AGENT_ISSUE";
-          case ErrorCode::AUTO_SCALING_IAM_ROLE_PERMISSIONS:
-            return "AUTO_SCALING_IAM_ROLE_PERMISSIONS";
-          case ErrorCode::AUTO_SCALING_CONFIGURATION:
-            return "AUTO_SCALING_CONFIGURATION";
-          case ErrorCode::MANUAL_STOP:
-            return "MANUAL_STOP";
-          case ErrorCode::MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION:
-            return "MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION";
-          case ErrorCode::MISSING_ELB_INFORMATION:
-            return "MISSING_ELB_INFORMATION";
-          case ErrorCode::MISSING_GITHUB_TOKEN:
-            return "MISSING_GITHUB_TOKEN";
-          case ErrorCode::ELASTIC_LOAD_BALANCING_INVALID:
-            return "ELASTIC_LOAD_BALANCING_INVALID";
-          case ErrorCode::ELB_INVALID_INSTANCE:
-            return "ELB_INVALID_INSTANCE";
-          case ErrorCode::INVALID_LAMBDA_CONFIGURATION:
-            return "INVALID_LAMBDA_CONFIGURATION";
-          case ErrorCode::INVALID_LAMBDA_FUNCTION:
-            return "INVALID_LAMBDA_FUNCTION";
-          case ErrorCode::HOOK_EXECUTION_FAILURE:
-            return "HOOK_EXECUTION_FAILURE";
-          case ErrorCode::AUTOSCALING_VALIDATION_ERROR:
-            return "AUTOSCALING_VALIDATION_ERROR";
-          case ErrorCode::INVALID_ECS_SERVICE:
-            return "INVALID_ECS_SERVICE";
-          case ErrorCode::ECS_UPDATE_ERROR:
-            return "ECS_UPDATE_ERROR";
-          case ErrorCode::INVALID_REVISION:
-            return "INVALID_REVISION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        {
+          return GetNameForErrorCodeCStr(enumValue);
         }
 
       } // namespace ErrorCodeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace FileExistsBehaviorMapper
       {
 
-        static const int DISALLOW_HASH = HashingUtils::HashString("DISALLOW");
-        static const int OVERWRITE_HASH = HashingUtils::HashString("OVERWRITE");
-        static const int RETAIN_HASH = HashingUtils::HashString("RETAIN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISALLOW",
+          "OVERWRITE",
+          "RETAIN",
+        };
 
         FileExistsBehavior GetFileExistsBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISALLOW_HASH)
-          {
-            return FileExistsBehavior::DISALLOW;
-          }
-          else if (hashCode == OVERWRITE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FileExistsBehavior::OVERWRITE;
-          }
-          else if (hashCode == RETAIN_HASH)
-          {
-            return FileExistsBehavior::RETAIN;
+          case 1053865851:
+            if (name == "DISALLOW")
+            {
+              return FileExistsBehavior::DISALLOW;
+            }
+            break;
+          case 2041515883:
+            if (name == "OVERWRITE")
+            {
+              return FileExistsBehavior::OVERWRITE;
+            }
+            break;
+          case -1881086715:
+            if (name == "RETAIN")
+            {
+              return FileExistsBehavior::RETAIN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FileExistsBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForFileExistsBehavior(FileExistsBehavior enumValue)
+        const char* GetNameForFileExistsBehaviorCStr(FileExistsBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FileExistsBehavior::DISALLOW:
-            return "DISALLOW";
-          case FileExistsBehavior::OVERWRITE:
-            return "OVERWRITE";
-          case FileExistsBehavior::RETAIN:
-            return "RETAIN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFileExistsBehavior(FileExistsBehavior enumValue)
+        {
+          return GetNameForFileExistsBehaviorCStr(enumValue);
         }
 
       } // namespace FileExistsBehaviorMapper
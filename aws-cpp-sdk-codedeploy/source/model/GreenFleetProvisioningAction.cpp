@@ -30,20 +30,37 @@ namespace Aws
       namespace GreenFleetProvisioningActionMapper
       {
 
-        static const int DISCOVER_EXISTING_HASH = HashingUtils::HashString("DISCOVER_EXISTING");
-        static const int COPY_AUTO_SCALING_GROUP_HASH = HashingUtils::HashString("COPY_AUTO_SCALING_GROUP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISCOVER_EXISTING",
+          "COPY_AUTO_SCALING_GROUP",
+        };
 
         GreenFleetProvisioningAction GetGreenFleetProvisioningActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISCOVER_EXISTING_HASH)
-          {
-            return GreenFleetProvisioningAction::DISCOVER_EXISTING;
-          }
-          else if (hashCode == COPY_AUTO_SCALING_GROUP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GreenFleetProvisioningAction::COPY_AUTO_SCALING_GROUP;
+          case 1169343777:
+            if (name == "DISCOVER_EXISTING")
+            {
+              return GreenFleetProvisioningAction::DISCOVER_EXISTING;
+            }
+            break;
+          case -455523839:
+            if (name == "COPY_AUTO_SCALING_GROUP")
+            {
+              return GreenFleetProvisioningAction::COPY_AUTO_SCALING_GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return GreenFleetProvisioningAction::NOT_SET;
         }
 
-        Aws::String GetNameForGreenFleetProvisioningAction(GreenFleetProvisioningAction enumValue)
+        const char* GetNameForGreenFleetProvisioningActionCStr(GreenFleetProvisioningAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GreenFleetProvisioningAction::DISCOVER_EXISTING:
-            return "DISCOVER_EXISTING";
-          case GreenFleetProvisioningAction::COPY_AUTO_SCALING_GROUP:
-            return "COPY_AUTO_SCALING_GROUP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGreenFleetProvisioningAction(GreenFleetProvisioningAction enumValue)
+        {
+          return GetNameForGreenFleetProvisioningActionCStr(enumValue);
         }
 
       } // namespace GreenFleetProvisioningActionMapper
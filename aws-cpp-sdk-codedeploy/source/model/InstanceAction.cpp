@@ -30,20 +30,37 @@ namespace Aws
       namespace InstanceActionMapper
       {
 
-        static const int TERMINATE_HASH = HashingUtils::HashString("TERMINATE");
-        static const int KEEP_ALIVE_HASH = HashingUtils::HashString("KEEP_ALIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TERMINATE",
+          "KEEP_ALIVE",
+        };
 
         InstanceAction GetInstanceActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERMINATE_HASH)
-          {
-            return InstanceAction::TERMINATE;
-          }
-          else if (hashCode == KEEP_ALIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceAction::KEEP_ALIVE;
+          case 527617601:
+            if (name == "TERMINATE")
+            {
+              return InstanceAction::TERMINATE;
+            }
+            break;
+          case -1251102861:
+            if (name == "KEEP_ALIVE")
+            {
+              return InstanceAction::KEEP_ALIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InstanceAction::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceAction(InstanceAction enumValue)
+        const char* GetNameForInstanceActionCStr(InstanceAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceAction::TERMINATE:
-            return "TERMINATE";
-          case InstanceAction::KEEP_ALIVE:
-            return "KEEP_ALIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceAction(InstanceAction enumValue)
+        {
+          return GetNameForInstanceActionCStr(enumValue);
         }
 
       } // namespace InstanceActionMapper
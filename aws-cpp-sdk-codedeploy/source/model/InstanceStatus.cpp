@@ -30,45 +30,72 @@ namespace Aws
       namespace InstanceStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Skipped_HASH = HashingUtils::HashString("Skipped");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-        static const int Ready_HASH = HashingUtils::HashString("Ready");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "InProgress",
+          "Succeeded",
+          "Failed",
+          "Skipped",
+          "Unknown",
+          "Ready",
+        };
 
         InstanceStatus GetInstanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return InstanceStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return InstanceStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return InstanceStatus::Failed;
-          }
-          else if (hashCode == Skipped_HASH)
-          {
-            return InstanceStatus::Skipped;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return InstanceStatus::Unknown;
-          }
-          else if (hashCode == Ready_HASH)
-          {
-            return InstanceStatus::Ready;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return InstanceStatus::Pending;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return InstanceStatus::InProgress;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return InstanceStatus::Succeeded;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return InstanceStatus::Failed;
+            }
+            break;
+          case -482869488:
+            if (name == "Skipped")
+            {
+              return InstanceStatus::Skipped;
+            }
+            break;
+          case 1379812394:
+            if (name == "Unknown")
+            {
+              return InstanceStatus::Unknown;
+            }
+            break;
+          case 78834051:
+            if (name == "Ready")
+            {
+              return InstanceStatus::Ready;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return InstanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceStatus(InstanceStatus enumValue)
+        const char* GetNameForInstanceStatusCStr(InstanceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceStatus::Pending:
-            return "Pending";
-          case InstanceStatus::InProgress:
-            return "InProgress";
-          case InstanceStatus::Succeeded:
-            return "Succeeded";
-          case InstanceStatus::Failed:
-            return "Failed";
-          case InstanceStatus::Skipped:
-            return "Skipped";
-          case InstanceStatus::Unknown:
-            return "Unknown";
-          case InstanceStatus::Ready:
-            return "Ready";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceStatus(InstanceStatus enumValue)
+        {
+          return GetNameForInstanceStatusCStr(enumValue);
         }
 
       } // namespace InstanceStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace InstanceTypeMapper
       {
 
-        static const int Blue_HASH = HashingUtils::HashString("Blue");
-        static const int Green_HASH = HashingUtils::HashString("Green");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Blue",
+          "Green",
+        };
 
         InstanceType GetInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Blue_HASH)
-          {
-            return InstanceType::Blue;
-          }
-          else if (hashCode == Green_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceType::Green;
+          case 2073722:
+            if (name == "Blue")
+            {
+              return InstanceType::Blue;
+            }
+            break;
+          case 69066467:
+            if (name == "Green")
+            {
+              return InstanceType::Green;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceType(InstanceType enumValue)
+        const char* GetNameForInstanceTypeCStr(InstanceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceType::Blue:
-            return "Blue";
-          case InstanceType::Green:
-            return "Green";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceType(InstanceType enumValue)
+        {
+          return GetNameForInstanceTypeCStr(enumValue);
         }
 
       } // namespace InstanceTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace LifecycleErrorCodeMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int ScriptMissing_HASH = HashingUtils::HashString("ScriptMissing");
-        static const int ScriptNotExecutable_HASH = HashingUtils::HashString("ScriptNotExecutable");
-        static const int ScriptTimedOut_HASH = HashingUtils::HashString("ScriptTimedOut");
-        static const int ScriptFailed_HASH = HashingUtils::HashString("ScriptFailed");
-        static const int UnknownError_HASH = HashingUtils::HashString("UnknownError");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Success",
+          "ScriptMissing",
+          "ScriptNotExecutable",
+          "ScriptTimedOut",
+          "ScriptFailed",
+          "UnknownError",
+        };
 
         LifecycleErrorCode GetLifecycleErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
-          {
-            return LifecycleErrorCode::Success;
-          }
-          else if (hashCode == ScriptMissing_HASH)
-          {
-            return LifecycleErrorCode::ScriptMissing;
-          }
-          else if (hashCode == ScriptNotExecutable_HASH)
-          {
-            return LifecycleErrorCode::ScriptNotExecutable;
-          }
-          else if (hashCode == ScriptTimedOut_HASH)
-          {
-            return LifecycleErrorCode::ScriptTimedOut;
-          }
-          else if (hashCode == ScriptFailed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LifecycleErrorCode::ScriptFailed;
-          }
-          else if (hashCode == UnknownError_HASH)
-          {
-            return LifecycleErrorCode::UnknownError;
+          case -202516509:
+            if (name == "Success")
+            {
+              return LifecycleErrorCode::Success;
+            }
+            break;
+          case 1628769787:
+            if (name == "ScriptMissing")
+            {
+              return LifecycleErrorCode::ScriptMissing;
+            }
+            break;
+          case -601298862:
+            if (name == "ScriptNotExecutable")
+            {
+              return LifecycleErrorCode::ScriptNotExecutable;
+            }
+            break;
+          case -1917856094:
+            if (name == "ScriptTimedOut")
+            {
+              return LifecycleErrorCode::ScriptTimedOut;
+            }
+            break;
+          case -1818124024:
+            if (name == "ScriptFailed")
+            {
+              return LifecycleErrorCode::ScriptFailed;
+            }
+            break;
+          case -1179015170:
+            if (name == "UnknownError")
+            {
+              return LifecycleErrorCode::UnknownError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return LifecycleErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForLifecycleErrorCode(LifecycleErrorCode enumValue)
+        const char* GetNameForLifecycleErrorCodeCStr(LifecycleErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LifecycleErrorCode::Success:
-            return "Success";
-          case LifecycleErrorCode::ScriptMissing:
-            return "ScriptMissing";
-          case LifecycleErrorCode::ScriptNotExecutable:
-            return "ScriptNotExecutable";
-          case LifecycleErrorCode::ScriptTimedOut:
-            return "ScriptTimedOut";
-          case LifecycleErrorCode::ScriptFailed:
-            return "ScriptFailed";
-          case LifecycleErrorCode::UnknownError:
-            return "UnknownError";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLifecycleErrorCode(LifecycleErrorCode enumValue)
+        {
+          return GetNameForLifecycleErrorCodeCStr(enumValue);
         }
 
       } // namespace LifecycleErrorCodeMapper
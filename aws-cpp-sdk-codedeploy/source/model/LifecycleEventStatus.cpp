@@ -30,40 +30,65 @@ namespace Aws
       namespace LifecycleEventStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Skipped_HASH = HashingUtils::HashString("Skipped");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "InProgress",
+          "Succeeded",
+          "Failed",
+          "Skipped",
+          "Unknown",
+        };
 
         LifecycleEventStatus GetLifecycleEventStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return LifecycleEventStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return LifecycleEventStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return LifecycleEventStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return LifecycleEventStatus::Failed;
-          }
-          else if (hashCode == Skipped_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LifecycleEventStatus::Skipped;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return LifecycleEventStatus::Unknown;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return LifecycleEventStatus::Pending;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return LifecycleEventStatus::InProgress;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return LifecycleEventStatus::Succeeded;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return LifecycleEventStatus::Failed;
+            }
+            break;
+          case -482869488:
+            if (name == "Skipped")
+            {
+              return LifecycleEventStatus::Skipped;
+            }
+            break;
+          case 1379812394:
+            if (name == "Unknown")
+            {
+              return LifecycleEventStatus::Unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return LifecycleEventStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLifecycleEventStatus(LifecycleEventStatus enumValue)
+        const char* GetNameForLifecycleEventStatusCStr(LifecycleEventStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LifecycleEventStatus::Pending:
-            return "Pending";
-          case LifecycleEventStatus::InProgress:
-            return "InProgress";
-          case LifecycleEventStatus::Succeeded:
-            return "Succeeded";
-          case LifecycleEventStatus::Failed:
-            return "Failed";
-          case LifecycleEventStatus::Skipped:
-            return "Skipped";
-          case LifecycleEventStatus::Unknown:
-            return "Unknown";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLifecycleEventStatus(LifecycleEventStatus enumValue)
+        {
+          return GetNameForLifecycleEventStatusCStr(enumValue);
         }
 
       } // namespace LifecycleEventStatusMapper
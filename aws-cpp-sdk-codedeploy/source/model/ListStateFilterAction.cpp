@@ -30,25 +30,44 @@ namespace Aws
       namespace ListStateFilterActionMapper
       {
 
-        static const int include_HASH = HashingUtils::HashString("include");
-        static const int exclude_HASH = HashingUtils::HashString("exclude");
-        static const int ignore_HASH = HashingUtils::HashString("ignore");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "include",
+          "exclude",
+          "ignore",
+        };
 
         ListStateFilterAction GetListStateFilterActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == include_HASH)
-          {
-            return ListStateFilterAction::include;
-          }
-          else if (hashCode == exclude_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ListStateFilterAction::exclude;
-          }
-          else if (hashCode == ignore_HASH)
-          {
-            return ListStateFilterAction::ignore;
+          case 1942574248:
+            if (name == "include")
+            {
+              return ListStateFilterAction::include;
+            }
+            break;
+          case -1321148966:
+            if (name == "exclude")
+            {
+              return ListStateFilterAction::exclude;
+            }
+            break;
+          case -1190396462:
+            if (name == "ignore")
+            {
+              return ListStateFilterAction::ignore;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ListStateFilterAction::NOT_SET;
         }
 
-        Aws::String GetNameForListStateFilterAction(ListStateFilterAction enumValue)
+        const char* GetNameForListStateFilterActionCStr(ListStateFilterAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ListStateFilterAction::include:
-            return "include";
-          case ListStateFilterAction::exclude:
-            return "exclude";
-          case ListStateFilterAction::ignore:
-            return "ignore";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForListStateFilterAction(ListStateFilterAction enumValue)
+        {
+          return GetNameForListStateFilterActionCStr(enumValue);
         }
 
       } // namespace ListStateFilterActionMapper
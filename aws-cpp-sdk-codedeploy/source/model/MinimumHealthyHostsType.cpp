@@ -30,20 +30,37 @@ namespace Aws
       namespace MinimumHealthyHostsTypeMapper
       {
 
-        static const int HOST_COUNT_HASH = HashingUtils::HashString("HOST_COUNT");
-        static const int FLEET_PERCENT_HASH = HashingUtils::HashString("FLEET_PERCENT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HOST_COUNT",
+          "FLEET_PERCENT",
+        };
 
         MinimumHealthyHostsType GetMinimumHealthyHostsTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HOST_COUNT_HASH)
-          {
-            return MinimumHealthyHostsType::HOST_COUNT;
-          }
-          else if (hashCode == FLEET_PERCENT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MinimumHealthyHostsType::FLEET_PERCENT;
+          case 625265560:
+            if (name == "HOST_COUNT")
+            {
+              return MinimumHealthyHostsType::HOST_COUNT;
+            }
+            break;
+          case -1353150956:
+            if (name == "FLEET_PERCENT")
+            {
+              return MinimumHealthyHostsType::FLEET_PERCENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MinimumHealthyHostsType::NOT_SET;
         }
 
-        Aws::String GetNameForMinimumHealthyHostsType(MinimumHealthyHostsType enumValue)
+        const char* GetNameForMinimumHealthyHostsTypeCStr(MinimumHealthyHostsType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MinimumHealthyHostsType::HOST_COUNT:
-            return "HOST_COUNT";
-          case MinimumHealthyHostsType::FLEET_PERCENT:
-            return "FLEET_PERCENT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMinimumHealthyHostsType(MinimumHealthyHostsType enumValue)
+        {
+          return GetNameForMinimumHealthyHostsTypeCStr(enumValue);
         }
 
       } // namespace MinimumHealthyHostsTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace RegistrationStatusMapper
       {
 
-        static const int Registered_HASH = HashingUtils::HashString("Registered");
-        static const int Deregistered_HASH = HashingUtils::HashString("Deregistered");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Registered",
+          "Deregistered",
+        };
 
         RegistrationStatus GetRegistrationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Registered_HASH)
-          {
-            return RegistrationStatus::Registered;
-          }
-          else if (hashCode == Deregistered_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RegistrationStatus::Deregistered;
+          case 123533986:
+            if (name == "Registered")
+            {
+              return RegistrationStatus::Registered;
+            }
+            break;
+          case 1509265891:
+            if (name == "Deregistered")
+            {
+              return RegistrationStatus::Deregistered;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RegistrationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRegistrationStatus(RegistrationStatus enumValue)
+        const char* GetNameForRegistrationStatusCStr(RegistrationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RegistrationStatus::Registered:
-            return "Registered";
-          case RegistrationStatus::Deregistered:
-            return "Deregistered";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRegistrationStatus(RegistrationStatus enumValue)
+        {
+          return GetNameForRegistrationStatusCStr(enumValue);
         }
 
       } // namespace RegistrationStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace RevisionLocationTypeMapper
       {
 
-        static const int S3_HASH = HashingUtils::HashString("S3");
-        static const int GitHub_HASH = HashingUtils::HashString("GitHub");
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int AppSpecContent_HASH = HashingUtils::HashString("AppSpecContent");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "S3",
+          "GitHub",
+          "String",
+          "AppSpecContent",
+        };
 
         RevisionLocationType GetRevisionLocationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == S3_HASH)
-          {
-            return RevisionLocationType::S3;
-          }
-          else if (hashCode == GitHub_HASH)
-          {
-            return RevisionLocationType::GitHub;
-          }
-          else if (hashCode == String_HASH)
-          {
-            return RevisionLocationType::String;
-          }
-          else if (hashCode == AppSpecContent_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RevisionLocationType::AppSpecContent;
+          case 2624:
+            if (name == "S3")
+            {
+              return RevisionLocationType::S3;
+            }
+            break;
+          case 2133168099:
+            if (name == "GitHub")
+            {
+              return RevisionLocationType::GitHub;
+            }
+            break;
+          case -1808118735:
+            if (name == "String")
+            {
+              return RevisionLocationType::String;
+            }
+            break;
+          case 2108082045:
+            if (name == "AppSpecContent")
+            {
+              return RevisionLocationType::AppSpecContent;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return RevisionLocationType::NOT_SET;
         }
 
-        Aws::String GetNameForRevisionLocationType(RevisionLocationType enumValue)
+        const char* GetNameForRevisionLocationTypeCStr(RevisionLocationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RevisionLocationType::S3:
-            return "S3";
-          case RevisionLocationType::GitHub:
-            return "GitHub";
-          case RevisionLocationType::String:
-            return "String";
-          case RevisionLocationType::AppSpecContent:
-            return "AppSpecContent";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRevisionLocationType(RevisionLocationType enumValue)
+        {
+          return GetNameForRevisionLocationTypeCStr(enumValue);
         }
 
       } // namespace RevisionLocationTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SortOrderMapper
       {
 
-        static const int ascending_HASH = HashingUtils::HashString("ascending");
-        static const int descending_HASH = HashingUtils::HashString("descending");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ascending",
+          "descending",
+        };
 
         SortOrder GetSortOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ascending_HASH)
-          {
-            return SortOrder::ascending;
-          }
-          else if (hashCode == descending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SortOrder::descending;
+          case -4931880:
+            if (name == "ascending")
+            {
+              return SortOrder::ascending;
+            }
+            break;
+          case -1116296456:
+            if (name == "descending")
+            {
+              return SortOrder::descending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SortOrder::NOT_SET;
         }
 
-        Aws::String GetNameForSortOrder(SortOrder enumValue)
+        const char* GetNameForSortOrderCStr(SortOrder enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SortOrder::ascending:
-            return "ascending";
-          case SortOrder::descending:
-            return "descending";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSortOrder(SortOrder enumValue)
+        {
+          return GetNameForSortOrderCStr(enumValue);
         }
 
       } // namespace SortOrderMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace StopStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "Succeeded",
+        };
 
         StopStatus GetStopStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return StopStatus::Pending;
-          }
-          else if (hashCode == Succeeded_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StopStatus::Succeeded;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return StopStatus::Pending;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return StopStatus::Succeeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return StopStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStopStatus(StopStatus enumValue)
+        const char* GetNameForStopStatusCStr(StopStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StopStatus::Pending:
-            return "Pending";
-          case StopStatus::Succeeded:
-            return "Succeeded";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStopStatus(StopStatus enumValue)
+        {
+          return GetNameForStopStatusCStr(enumValue);
         }
 
       } // namespace StopStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TargetFilterNameMapper
       {
 
-        static const int TargetStatus_HASH = HashingUtils::HashString("TargetStatus");
-        static const int ServerInstanceLabel_HASH = HashingUtils::HashString("ServerInstanceLabel");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TargetStatus",
+          "ServerInstanceLabel",
+        };
 
         TargetFilterName GetTargetFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TargetStatus_HASH)
-          {
-            return TargetFilterName::TargetStatus;
-          }
-          else if (hashCode == ServerInstanceLabel_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TargetFilterName::ServerInstanceLabel;
+          case -376745725:
+            if (name == "TargetStatus")
+            {
+              return TargetFilterName::TargetStatus;
+            }
+            break;
+          case 86342844:
+            if (name == "ServerInstanceLabel")
+            {
+              return TargetFilterName::ServerInstanceLabel;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TargetFilterName::NOT_SET;
         }
 
-        Aws::String GetNameForTargetFilterName(TargetFilterName enumValue)
+        const char* GetNameForTargetFilterNameCStr(TargetFilterName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TargetFilterName::TargetStatus:
-            return "TargetStatus";
-          case TargetFilterName::ServerInstanceLabel:
-            return "ServerInstanceLabel";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTargetFilterName(TargetFilterName enumValue)
+        {
+          return GetNameForTargetFilterNameCStr(enumValue);
         }
 
       } // namespace TargetFilterNameMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TargetLabelMapper
       {
 
-        static const int Blue_HASH = HashingUtils::HashString("Blue");
-        static const int Green_HASH = HashingUtils::HashString("Green");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Blue",
+          "Green",
+        };
 
         TargetLabel GetTargetLabelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Blue_HASH)
-          {
-            return TargetLabel::Blue;
-          }
-          else if (hashCode == Green_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TargetLabel::Green;
+          case 2073722:
+            if (name == "Blue")
+            {
+              return TargetLabel::Blue;
+            }
+            break;
+          case 69066467:
+            if (name == "Green")
+            {
+              return TargetLabel::Green;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TargetLabel::NOT_SET;
         }
 
-        Aws::String GetNameForTargetLabel(TargetLabel enumValue)
+        const char* GetNameForTargetLabelCStr(TargetLabel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TargetLabel::Blue:
-            return "Blue";
-          case TargetLabel::Green:
-            return "Green";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTargetLabel(TargetLabel enumValue)
+        {
+          return GetNameForTargetLabelCStr(enumValue);
         }
 
       } // namespace TargetLabelMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace TargetStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Skipped_HASH = HashingUtils::HashString("Skipped");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-        static const int Ready_HASH = HashingUtils::HashString("Ready");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "InProgress",
+          "Succeeded",
+          "Failed",
+          "Skipped",
+          "Unknown",
+          "Ready",
+        };
 
         TargetStatus GetTargetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return TargetStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return TargetStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TargetStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return TargetStatus::Failed;
-          }
-          else if (hashCode == Skipped_HASH)
-          {
-            return TargetStatus::Skipped;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return TargetStatus::Unknown;
-          }
-          else if (hashCode == Ready_HASH)
-          {
-            return TargetStatus::Ready;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return TargetStatus::Pending;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return TargetStatus::InProgress;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return TargetStatus::Succeeded;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return TargetStatus::Failed;
+            }
+            break;
+          case -482869488:
+            if (name == "Skipped")
+            {
+              return TargetStatus::Skipped;
+            }
+            break;
+          case 1379812394:
+            if (name == "Unknown")
+            {
+              return TargetStatus::Unknown;
+            }
+            break;
+          case 78834051:
+            if (name == "Ready")
+            {
+              return TargetStatus::Ready;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return TargetStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTargetStatus(TargetStatus enumValue)
+        const char* GetNameForTargetStatusCStr(TargetStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TargetStatus::Pending:
-            return "Pending";
-          case TargetStatus::InProgress:
-            return "InProgress";
-          case TargetStatus::Succeeded:
-            return "Succeeded";
-          case TargetStatus::Failed:
-            return "Failed";
-          case TargetStatus::Skipped:
-            return "Skipped";
-          case TargetStatus::Unknown:
-            return "Unknown";
-          case TargetStatus::Ready:
-            return "Ready";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTargetStatus(TargetStatus enumValue)
+        {
+          return GetNameForTargetStatusCStr(enumValue);
         }
 
       } // namespace TargetStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TrafficRoutingTypeMapper
       {
 
-        static const int TimeBasedCanary_HASH = HashingUtils::HashString("TimeBasedCanary");
-        static const int TimeBasedLinear_HASH = HashingUtils::HashString("TimeBasedLinear");
-        static const int AllAtOnce_HASH = HashingUtils::HashString("AllAtOnce");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TimeBasedCanary",
+          "TimeBasedLinear",
+          "AllAtOnce",
+        };
 
         TrafficRoutingType GetTrafficRoutingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TimeBasedCanary_HASH)
-          {
-            return TrafficRoutingType::TimeBasedCanary;
-          }
-          else if (hashCode == TimeBasedLinear_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TrafficRoutingType::TimeBasedLinear;
-          }
-          else if (hashCode == AllAtOnce_HASH)
-          {
-            return TrafficRoutingType::AllAtOnce;
+          case 1644384510:
+            if (name == "TimeBasedCanary")
+            {
+              return TrafficRoutingType::TimeBasedCanary;
+            }
+            break;
+          case 1909438347:
+            if (name == "TimeBasedLinear")
+            {
+              return TrafficRoutingType::TimeBasedLinear;
+            }
+            break;
+          case 1056134709:
+            if (name == "AllAtOnce")
+            {
+              return TrafficRoutingType::AllAtOnce;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TrafficRoutingType::NOT_SET;
         }
 
-        Aws::String GetNameForTrafficRoutingType(TrafficRoutingType enumValue)
+        const char* GetNameForTrafficRoutingTypeCStr(TrafficRoutingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TrafficRoutingType::TimeBasedCanary:
-            return "TimeBasedCanary";
-          case TrafficRoutingType::TimeBasedLinear:
-            return "TimeBasedLinear";
-          case TrafficRoutingType::AllAtOnce:
-            return "AllAtOnce";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTrafficRoutingType(TrafficRoutingType enumValue)
+        {
+          return GetNameForTrafficRoutingTypeCStr(enumValue);
         }
 
       } // namespace TrafficRoutingTypeMapper
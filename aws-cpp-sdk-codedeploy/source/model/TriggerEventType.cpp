@@ -30,60 +30,93 @@ namespace Aws
       namespace TriggerEventTypeMapper
       {
 
-        static const int DeploymentStart_HASH = HashingUtils::HashString("DeploymentStart");
-        static const int DeploymentSuccess_HASH = HashingUtils::HashString("DeploymentSuccess");
-        static const int DeploymentFailure_HASH = HashingUtils::HashString("DeploymentFailure");
-        static const int DeploymentStop_HASH = HashingUtils::HashString("DeploymentStop");
-        static const int DeploymentRollback_HASH = HashingUtils::HashString("DeploymentRollback");
-        static const int DeploymentReady_HASH = HashingUtils::HashString("DeploymentReady");
-        static const int InstanceStart_HASH = HashingUtils::HashString("InstanceStart");
-        static const int InstanceSuccess_HASH = HashingUtils::HashString("InstanceSuccess");
-        static const int InstanceFailure_HASH = HashingUtils::HashString("InstanceFailure");
-        static const int InstanceReady_HASH = HashingUtils::HashString("InstanceReady");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DeploymentStart",
+          "DeploymentSuccess",
+          "DeploymentFailure",
+          "DeploymentStop",
+          "DeploymentRollback",
+          "DeploymentReady",
+          "InstanceStart",
+          "InstanceSuccess",
+          "InstanceFailure",
+          "InstanceReady",
+        };
 
         TriggerEventType GetTriggerEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DeploymentStart_HASH)
-          {
-            return TriggerEventType::DeploymentStart;
-          }
-          else if (hashCode == DeploymentSuccess_HASH)
-          {
-            return TriggerEventType::DeploymentSuccess;
-          }
-          else if (hashCode == DeploymentFailure_HASH)
-          {
-            return TriggerEventType::DeploymentFailure;
-          }
-          else if (hashCode == DeploymentStop_HASH)
-          {
-            return TriggerEventType::DeploymentStop;
-          }
-          else if (hashCode == DeploymentRollback_HASH)
-          {
-            return TriggerEventType::DeploymentRollback;
-          }
-          else if (hashCode == DeploymentReady_HASH)
-          {
-            return TriggerEventType::DeploymentReady;
-          }
-          else if (hashCode == InstanceStart_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TriggerEventType::InstanceStart;
-          }
-          else if (hashCode == InstanceSuccess_HASH)
-          {
-            return TriggerEventType::InstanceSuccess;
-          }
-          else if (hashCode == InstanceFailure_HASH)
-          {
-            return TriggerEventType::InstanceFailure;
-          }
-          else if (hashCode == InstanceReady_HASH)
-          {
-            return TriggerEventType::InstanceReady;
+          case 999212157:
+            if (name == "DeploymentStart")
+            {
+              return TriggerEventType::DeploymentStart;
+            }
+            break;
+          case -1799772834:
+            if (name == "DeploymentSuccess")
+            {
+              return TriggerEventType::DeploymentSuccess;
+            }
+            break;
+          case -1019177243:
+            if (name == "DeploymentFailure")
+            {
+              return TriggerEventType::DeploymentFailure;
+            }
+            break;
+          case 586422407:
+            if (name == "DeploymentStop")
+            {
+              return TriggerEventType::DeploymentStop;
+            }
+            break;
+          case 1829586153:
+            if (name == "DeploymentRollback")
+            {
+              return TriggerEventType::DeploymentRollback;
+            }
+            break;
+          case 997841342:
+            if (name == "DeploymentReady")
+            {
+              return TriggerEventType::DeploymentReady;
+            }
+            break;
+          case -594606931:
+            if (name == "InstanceStart")
+            {
+              return TriggerEventType::InstanceStart;
+            }
+            break;
+          case -156591730:
+            if (name == "InstanceSuccess")
+            {
+              return TriggerEventType::InstanceSuccess;
+            }
+            break;
+          case 624003861:
+            if (name == "InstanceFailure")
+            {
+              return TriggerEventType::InstanceFailure;
+            }
+            break;
+          case -595977746:
+            if (name == "InstanceReady")
+            {
+              return TriggerEventType::InstanceReady;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return TriggerEventType::NOT_SET;
         }
 
-        Aws::String GetNameForTriggerEventType(TriggerEventType enumValue)
+        const char* GetNameForTriggerEventTypeCStr(TriggerEventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TriggerEventType::DeploymentStart:
-            return "DeploymentStart";
-          case TriggerEventType::DeploymentSuccess:
-            return "DeploymentSuccess";
-          case TriggerEventType::DeploymentFailure:
-            return "DeploymentFailure";
-          case TriggerEventType::DeploymentStop:
-            return "DeploymentStop";
-          case TriggerEventType::DeploymentRollback:
-            return "DeploymentRollback";
-          case TriggerEventType::DeploymentReady:
-            return "DeploymentReady";
-          case TriggerEventType::InstanceStart:
-            return "InstanceStart";
-          case TriggerEventType::InstanceSuccess:
-            return "InstanceSuccess";
-          case TriggerEventType::InstanceFailure:
-            return "InstanceFailure";
-          case TriggerEventType::InstanceReady:
-            return "InstanceReady";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTriggerEventType(TriggerEventType enumValue)
+        {
+          return GetNameForTriggerEventTypeCStr(enumValue);
         }
 
       } // namespace TriggerEventTypeMapper
@@ -39,6 +39,11 @@ namespace ActionCategoryMapper
 AWS_CODEPIPELINE_API ActionCategory GetActionCategoryForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForActionCategory(ActionCategory value);
+
+/**
+ * Same as GetNameForActionCategory(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForActionCategoryCStr(ActionCategory value);
 } // namespace ActionCategoryMapper
 } // namespace Model
 } // namespace CodePipeline
@@ -36,6 +36,11 @@ namespace ActionConfigurationPropertyTypeMapper
 AWS_CODEPIPELINE_API ActionConfigurationPropertyType GetActionConfigurationPropertyTypeForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForActionConfigurationPropertyType(ActionConfigurationPropertyType value);
+
+/**
+ * Same as GetNameForActionConfigurationPropertyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForActionConfigurationPropertyTypeCStr(ActionConfigurationPropertyType value);
 } // namespace ActionConfigurationPropertyTypeMapper
 } // namespace Model
 } // namespace CodePipeline
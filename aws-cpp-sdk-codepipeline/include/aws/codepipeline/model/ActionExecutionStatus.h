@@ -36,6 +36,11 @@ namespace ActionExecutionStatusMapper
 AWS_CODEPIPELINE_API ActionExecutionStatus GetActionExecutionStatusForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForActionExecutionStatus(ActionExecutionStatus value);
+
+/**
+ * Same as GetNameForActionExecutionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForActionExecutionStatusCStr(ActionExecutionStatus value);
 } // namespace ActionExecutionStatusMapper
 } // namespace Model
 } // namespace CodePipeline
@@ -36,6 +36,11 @@ namespace ActionOwnerMapper
 AWS_CODEPIPELINE_API ActionOwner GetActionOwnerForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForActionOwner(ActionOwner value);
+
+/**
+ * Same as GetNameForActionOwner(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForActionOwnerCStr(ActionOwner value);
 } // namespace ActionOwnerMapper
 } // namespace Model
 } // namespace CodePipeline
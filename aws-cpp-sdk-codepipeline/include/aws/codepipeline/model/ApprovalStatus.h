@@ -35,6 +35,11 @@ namespace ApprovalStatusMapper
 AWS_CODEPIPELINE_API ApprovalStatus GetApprovalStatusForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForApprovalStatus(ApprovalStatus value);
+
+/**
+ * Same as GetNameForApprovalStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForApprovalStatusCStr(ApprovalStatus value);
 } // namespace ApprovalStatusMapper
 } // namespace Model
 } // namespace CodePipeline
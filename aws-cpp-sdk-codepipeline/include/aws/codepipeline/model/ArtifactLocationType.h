@@ -34,6 +34,11 @@ namespace ArtifactLocationTypeMapper
 AWS_CODEPIPELINE_API ArtifactLocationType GetArtifactLocationTypeForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForArtifactLocationType(ArtifactLocationType value);
+
+/**
+ * Same as GetNameForArtifactLocationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForArtifactLocationTypeCStr(ArtifactLocationType value);
 } // namespace ArtifactLocationTypeMapper
 } // namespace Model
 } // namespace CodePipeline
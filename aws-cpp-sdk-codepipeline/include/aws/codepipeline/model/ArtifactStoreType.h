@@ -34,6 +34,11 @@ namespace ArtifactStoreTypeMapper
 AWS_CODEPIPELINE_API ArtifactStoreType GetArtifactStoreTypeForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForArtifactStoreType(ArtifactStoreType value);
+
+/**
+ * Same as GetNameForArtifactStoreType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForArtifactStoreTypeCStr(ArtifactStoreType value);
 } // namespace ArtifactStoreTypeMapper
 } // namespace Model
 } // namespace CodePipeline
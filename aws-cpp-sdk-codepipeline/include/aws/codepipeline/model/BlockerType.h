@@ -34,6 +34,11 @@ namespace BlockerTypeMapper
 AWS_CODEPIPELINE_API BlockerType GetBlockerTypeForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForBlockerType(BlockerType value);
+
+/**
+ * Same as GetNameForBlockerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForBlockerTypeCStr(BlockerType value);
 } // namespace BlockerTypeMapper
 } // namespace Model
 } // namespace CodePipeline
@@ -34,6 +34,11 @@ namespace EncryptionKeyTypeMapper
 AWS_CODEPIPELINE_API EncryptionKeyType GetEncryptionKeyTypeForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForEncryptionKeyType(EncryptionKeyType value);
+
+/**
+ * Same as GetNameForEncryptionKeyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForEncryptionKeyTypeCStr(EncryptionKeyType value);
 } // namespace EncryptionKeyTypeMapper
 } // namespace Model
 } // namespace CodePipeline
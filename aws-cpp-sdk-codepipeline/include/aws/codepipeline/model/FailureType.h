@@ -39,6 +39,11 @@ namespace FailureTypeMapper
 AWS_CODEPIPELINE_API FailureType GetFailureTypeForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForFailureType(FailureType value);
+
+/**
+ * Same as GetNameForFailureType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForFailureTypeCStr(FailureType value);
 } // namespace FailureTypeMapper
 } // namespace Model
 } // namespace CodePipeline
@@ -37,6 +37,11 @@ namespace PipelineExecutionStatusMapper
 AWS_CODEPIPELINE_API PipelineExecutionStatus GetPipelineExecutionStatusForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForPipelineExecutionStatus(PipelineExecutionStatus value);
+
+/**
+ * Same as GetNameForPipelineExecutionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForPipelineExecutionStatusCStr(PipelineExecutionStatus value);
 } // namespace PipelineExecutionStatusMapper
 } // namespace Model
 } // namespace CodePipeline
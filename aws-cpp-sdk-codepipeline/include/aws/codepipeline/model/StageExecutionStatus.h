@@ -36,6 +36,11 @@ namespace StageExecutionStatusMapper
 AWS_CODEPIPELINE_API StageExecutionStatus GetStageExecutionStatusForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForStageExecutionStatus(StageExecutionStatus value);
+
+/**
+ * Same as GetNameForStageExecutionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForStageExecutionStatusCStr(StageExecutionStatus value);
 } // namespace StageExecutionStatusMapper
 } // namespace Model
 } // namespace CodePipeline
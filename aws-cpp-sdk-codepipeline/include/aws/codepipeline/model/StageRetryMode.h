@@ -34,6 +34,11 @@ namespace StageRetryModeMapper
 AWS_CODEPIPELINE_API StageRetryMode GetStageRetryModeForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForStageRetryMode(StageRetryMode value);
+
+/**
+ * Same as GetNameForStageRetryMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForStageRetryModeCStr(StageRetryMode value);
 } // namespace StageRetryModeMapper
 } // namespace Model
 } // namespace CodePipeline
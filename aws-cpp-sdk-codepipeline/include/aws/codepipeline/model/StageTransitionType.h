@@ -35,6 +35,11 @@ namespace StageTransitionTypeMapper
 AWS_CODEPIPELINE_API StageTransitionType GetStageTransitionTypeForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForStageTransitionType(StageTransitionType value);
+
+/**
+ * Same as GetNameForStageTransitionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForStageTransitionTypeCStr(StageTransitionType value);
 } // namespace StageTransitionTypeMapper
 } // namespace Model
 } // namespace CodePipeline
@@ -36,6 +36,11 @@ namespace WebhookAuthenticationTypeMapper
 AWS_CODEPIPELINE_API WebhookAuthenticationType GetWebhookAuthenticationTypeForName(const Aws::String& name);
 
 AWS_CODEPIPELINE_API Aws::String GetNameForWebhookAuthenticationType(WebhookAuthenticationType value);
+
+/**
+ * Same as GetNameForWebhookAuthenticationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CODEPIPELINE_API const char* GetNameForWebhookAuthenticationTypeCStr(WebhookAuthenticationType value);
 } // namespace WebhookAuthenticationTypeMapper
 } // namespace Model
 } // namespace CodePipeline
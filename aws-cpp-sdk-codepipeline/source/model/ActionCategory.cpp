@@ -30,40 +30,65 @@ namespace Aws
       namespace ActionCategoryMapper
       {
 
-        static const int Source_HASH = HashingUtils::HashString("Source");
-        static const int Build_HASH = HashingUtils::HashString("Build");
-        static const int Deploy_HASH = HashingUtils::HashString("Deploy");
-        static const int Test_HASH = HashingUtils::HashString("Test");
-        static const int Invoke_HASH = HashingUtils::HashString("Invoke");
-        static const int Approval_HASH = HashingUtils::HashString("Approval");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Source",
+          "Build",
+          "Deploy",
+          "Test",
+          "Invoke",
+          "Approval",
+        };
 
         ActionCategory GetActionCategoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Source_HASH)
-          {
-            return ActionCategory::Source;
-          }
-          else if (hashCode == Build_HASH)
-          {
-            return ActionCategory::Build;
-          }
-          else if (hashCode == Deploy_HASH)
-          {
-            return ActionCategory::Deploy;
-          }
-          else if (hashCode == Test_HASH)
-          {
-            return ActionCategory::Test;
-          }
-          else if (hashCode == Invoke_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionCategory::Invoke;
-          }
-          else if (hashCode == Approval_HASH)
-          {
-            return ActionCategory::Approval;
+          case -1812638661:
+            if (name == "Source")
+            {
+              return ActionCategory::Source;
+            }
+            break;
+          case 64542286:
+            if (name == "Build")
+            {
+              return ActionCategory::Build;
+            }
+            break;
+          case 2043501831:
+            if (name == "Deploy")
+            {
+              return ActionCategory::Deploy;
+            }
+            break;
+          case 2603186:
+            if (name == "Test")
+            {
+              return ActionCategory::Test;
+            }
+            break;
+          case -2099826536:
+            if (name == "Invoke")
+            {
+              return ActionCategory::Invoke;
+            }
+            break;
+          case 1249888867:
+            if (name == "Approval")
+            {
+              return ActionCategory::Approval;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ActionCategory::NOT_SET;
         }
 
-        Aws::String GetNameForActionCategory(ActionCategory enumValue)
+        const char* GetNameForActionCategoryCStr(ActionCategory enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionCategory::Source:
-            return "Source";
-          case ActionCategory::Build:
-            return "Build";
-          case ActionCategory::Deploy:
-            return "Deploy";
-          case ActionCategory::Test:
-            return "Test";
-          case ActionCategory::Invoke:
-            return "Invoke";
-          case ActionCategory::Approval:
-            return "Approval";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionCategory(ActionCategory enumValue)
+        {
+          return GetNameForActionCategoryCStr(enumValue);
         }
 
       } // namespace ActionCategoryMapper
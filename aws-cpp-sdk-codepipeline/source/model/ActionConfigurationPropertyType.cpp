@@ -30,25 +30,44 @@ namespace Aws
       namespace ActionConfigurationPropertyTypeMapper
       {
 
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int Number_HASH = HashingUtils::HashString("Number");
-        static const int Boolean_HASH = HashingUtils::HashString("Boolean");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "String",
+          "Number",
+          "Boolean",
+        };
 
         ActionConfigurationPropertyType GetActionConfigurationPropertyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == String_HASH)
-          {
-            return ActionConfigurationPropertyType::String;
-          }
-          else if (hashCode == Number_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionConfigurationPropertyType::Number;
-          }
-          else if (hashCode == Boolean_HASH)
-          {
-            return ActionConfigurationPropertyType::Boolean;
+          case -1808118735:
+            if (name == "String")
+            {
+              return ActionConfigurationPropertyType::String;
+            }
+            break;
+          case -1950496919:
+            if (name == "Number")
+            {
+              return ActionConfigurationPropertyType::Number;
+            }
+            break;
+          case 1729365000:
+            if (name == "Boolean")
+            {
+              return ActionConfigurationPropertyType::Boolean;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ActionConfigurationPropertyType::NOT_SET;
         }
 
-        Aws::String GetNameForActionConfigurationPropertyType(ActionConfigurationPropertyType enumValue)
+        const char* GetNameForActionConfigurationPropertyTypeCStr(ActionConfigurationPropertyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionConfigurationPropertyType::String:
-            return "String";
-          case ActionConfigurationPropertyType::Number:
-            return "Number";
-          case ActionConfigurationPropertyType::Boolean:
-            return "Boolean";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionConfigurationPropertyType(ActionConfigurationPropertyType enumValue)
+        {
+          return GetNameForActionConfigurationPropertyTypeCStr(enumValue);
         }
 
       } // namespace ActionConfigurationPropertyTypeMapper
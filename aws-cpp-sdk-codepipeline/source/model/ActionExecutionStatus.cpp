@@ -30,25 +30,44 @@ namespace Aws
       namespace ActionExecutionStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InProgress",
+          "Succeeded",
+          "Failed",
+        };
 
         ActionExecutionStatus GetActionExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
-          {
-            return ActionExecutionStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionExecutionStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ActionExecutionStatus::Failed;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return ActionExecutionStatus::InProgress;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return ActionExecutionStatus::Succeeded;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return ActionExecutionStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ActionExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForActionExecutionStatus(ActionExecutionStatus enumValue)
+        const char* GetNameForActionExecutionStatusCStr(ActionExecutionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionExecutionStatus::InProgress:
-            return "InProgress";
-          case ActionExecutionStatus::Succeeded:
-            return "Succeeded";
-          case ActionExecutionStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionExecutionStatus(ActionExecutionStatus enumValue)
+        {
+          return GetNameForActionExecutionStatusCStr(enumValue);
         }
 
       } // namespace ActionExecutionStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ActionOwnerMapper
       {
 
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int ThirdParty_HASH = HashingUtils::HashString("ThirdParty");
-        static const int Custom_HASH = HashingUtils::HashString("Custom");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AWS",
+          "ThirdParty",
+          "Custom",
+        };
 
         ActionOwner GetActionOwnerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_HASH)
-          {
-            return ActionOwner::AWS;
-          }
-          else if (hashCode == ThirdParty_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionOwner::ThirdParty;
-          }
-          else if (hashCode == Custom_HASH)
-          {
-            return ActionOwner::Custom;
+          case 65245:
+            if (name == "AWS")
+            {
+              return ActionOwner::AWS;
+            }
+            break;
+          case 1023527391:
+            if (name == "ThirdParty")
+            {
+              return ActionOwner::ThirdParty;
+            }
+            break;
+          case 2029746065:
+            if (name == "Custom")
+            {
+              return ActionOwner::Custom;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ActionOwner::NOT_SET;
         }
 
-        Aws::String GetNameForActionOwner(ActionOwner enumValue)
+        const char* GetNameForActionOwnerCStr(ActionOwner enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionOwner::AWS:
-            return "AWS";
-          case ActionOwner::ThirdParty:
-            return "ThirdParty";
-          case ActionOwner::Custom:
-            return "Custom";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionOwner(ActionOwner enumValue)
+        {
+          return GetNameForActionOwnerCStr(enumValue);
         }
 
       } // namespace ActionOwnerMapper
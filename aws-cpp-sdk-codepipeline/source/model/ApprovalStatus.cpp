@@ -30,20 +30,37 @@ namespace Aws
       namespace ApprovalStatusMapper
       {
 
-        static const int Approved_HASH = HashingUtils::HashString("Approved");
-        static const int Rejected_HASH = HashingUtils::HashString("Rejected");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Approved",
+          "Rejected",
+        };
 
         ApprovalStatus GetApprovalStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Approved_HASH)
-          {
-            return ApprovalStatus::Approved;
-          }
-          else if (hashCode == Rejected_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ApprovalStatus::Rejected;
+          case 1249888983:
+            if (name == "Approved")
+            {
+              return ApprovalStatus::Approved;
+            }
+            break;
+          case -543852386:
+            if (name == "Rejected")
+            {
+              return ApprovalStatus::Rejected;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ApprovalStatus::NOT_SET;
         }
 
-        Aws::String GetNameForApprovalStatus(ApprovalStatus enumValue)
+        const char* GetNameForApprovalStatusCStr(ApprovalStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ApprovalStatus::Approved:
-            return "Approved";
-          case ApprovalStatus::Rejected:
-            return "Rejected";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForApprovalStatus(ApprovalStatus enumValue)
+        {
+          return GetNameForApprovalStatusCStr(enumValue);
         }
 
       } // namespace ApprovalStatusMapper
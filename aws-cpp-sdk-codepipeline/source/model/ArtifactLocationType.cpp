@@ -30,15 +30,30 @@ namespace Aws
       namespace ArtifactLocationTypeMapper
       {
 
-        static const int S3_HASH = HashingUtils::HashString("S3");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "S3",
+        };
 
         ArtifactLocationType GetArtifactLocationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == S3_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ArtifactLocationType::S3;
+          case 2624:
+            if (name == "S3")
+            {
+              return ArtifactLocationType::S3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ArtifactLocationType::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactLocationType(ArtifactLocationType enumValue)
+        const char* GetNameForArtifactLocationTypeCStr(ArtifactLocationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ArtifactLocationType::S3:
-            return "S3";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForArtifactLocationType(ArtifactLocationType enumValue)
+        {
+          return GetNameForArtifactLocationTypeCStr(enumValue);
         }
 
       } // namespace ArtifactLocationTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ArtifactStoreTypeMapper
       {
 
-        static const int S3_HASH = HashingUtils::HashString("S3");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "S3",
+        };
 
         ArtifactStoreType GetArtifactStoreTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == S3_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ArtifactStoreType::S3;
+          case 2624:
+            if (name == "S3")
+            {
+              return ArtifactStoreType::S3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ArtifactStoreType::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactStoreType(ArtifactStoreType enumValue)
+        const char* GetNameForArtifactStoreTypeCStr(ArtifactStoreType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ArtifactStoreType::S3:
-            return "S3";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForArtifactStoreType(ArtifactStoreType enumValue)
+        {
+          return GetNameForArtifactStoreTypeCStr(enumValue);
         }
 
       } // namespace ArtifactStoreTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace BlockerTypeMapper
       {
 
-        static const int Schedule_HASH = HashingUtils::HashString("Schedule");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Schedule",
+        };
 
         BlockerType GetBlockerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Schedule_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BlockerType::Schedule;
+          case -633276745:
+            if (name == "Schedule")
+            {
+              return BlockerType::Schedule;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return BlockerType::NOT_SET;
         }
 
-        Aws::String GetNameForBlockerType(BlockerType enumValue)
+        const char* GetNameForBlockerTypeCStr(BlockerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BlockerType::Schedule:
-            return "Schedule";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBlockerType(BlockerType enumValue)
+        {
+          return GetNameForBlockerTypeCStr(enumValue);
         }
 
       } // namespace BlockerTypeMapper
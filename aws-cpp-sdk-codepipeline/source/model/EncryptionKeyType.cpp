@@ -30,15 +30,30 @@ namespace Aws
       namespace EncryptionKeyTypeMapper
       {
 
-        static const int KMS_HASH = HashingUtils::HashString("KMS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "KMS",
+        };
 
         EncryptionKeyType GetEncryptionKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == KMS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EncryptionKeyType::KMS;
+          case 74545:
+            if (name == "KMS")
+            {
+              return EncryptionKeyType::KMS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return EncryptionKeyType::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionKeyType(EncryptionKeyType enumValue)
+        const char* GetNameForEncryptionKeyTypeCStr(EncryptionKeyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EncryptionKeyType::KMS:
-            return "KMS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEncryptionKeyType(EncryptionKeyType enumValue)
+        {
+          return GetNameForEncryptionKeyTypeCStr(enumValue);
         }
 
       } // namespace EncryptionKeyTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace FailureTypeMapper
       {
 
-        static const int JobFailed_HASH = HashingUtils::HashString("JobFailed");
-        static const int ConfigurationError_HASH = HashingUtils::HashString("ConfigurationError");
-        static const int PermissionError_HASH = HashingUtils::HashString("PermissionError");
-        static const int RevisionOutOfSync_HASH = HashingUtils::HashString("RevisionOutOfSync");
-        static const int RevisionUnavailable_HASH = HashingUtils::HashString("RevisionUnavailable");
-        static const int SystemUnavailable_HASH = HashingUtils::HashString("SystemUnavailable");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "JobFailed",
+          "ConfigurationError",
+          "PermissionError",
+          "RevisionOutOfSync",
+          "RevisionUnavailable",
+          "SystemUnavailable",
+        };
 
         FailureType GetFailureTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JobFailed_HASH)
-          {
-            return FailureType::JobFailed;
-          }
-          else if (hashCode == ConfigurationError_HASH)
-          {
-            return FailureType::ConfigurationError;
-          }
-          else if (hashCode == PermissionError_HASH)
-          {
-            return FailureType::PermissionError;
-          }
-          else if (hashCode == RevisionOutOfSync_HASH)
-          {
-            return FailureType::RevisionOutOfSync;
-          }
-          else if (hashCode == RevisionUnavailable_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FailureType::RevisionUnavailable;
-          }
-          else if (hashCode == SystemUnavailable_HASH)
-          {
-            return FailureType::SystemUnavailable;
+          case -1551320518:
+            if (name == "JobFailed")
+            {
+              return FailureType::JobFailed;
+            }
+            break;
+          case -1671245102:
+            if (name == "ConfigurationError")
+            {
+              return FailureType::ConfigurationError;
+            }
+            break;
+          case 1652366681:
+            if (name == "PermissionError")
+            {
+              return FailureType::PermissionError;
+            }
+            break;
+          case 2003800133:
+            if (name == "RevisionOutOfSync")
+            {
+              return FailureType::RevisionOutOfSync;
+            }
+            break;
+          case 397322581:
+            if (name == "RevisionUnavailable")
+            {
+              return FailureType::RevisionUnavailable;
+            }
+            break;
+          case 388590209:
+            if (name == "SystemUnavailable")
+            {
+              return FailureType::SystemUnavailable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return FailureType::NOT_SET;
         }
 
-        Aws::String GetNameForFailureType(FailureType enumValue)
+        const char* GetNameForFailureTypeCStr(FailureType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FailureType::JobFailed:
-            return "JobFailed";
-          case FailureType::ConfigurationError:
-            return "ConfigurationError";
-          case FailureType::PermissionError:
-            return "PermissionError";
-          case FailureType::RevisionOutOfSync:
-            return "RevisionOutOfSync";
-          case FailureType::RevisionUnavailable:
-            return "RevisionUnavailable";
-          case FailureType::SystemUnavailable:
-            return "SystemUnavailable";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFailureType(FailureType enumValue)
+        {
+          return GetNameForFailureTypeCStr(enumValue);
         }
 
       } // namespace FailureTypeMapper
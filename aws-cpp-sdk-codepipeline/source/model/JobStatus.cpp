@@ -30,45 +30,72 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Queued_HASH = HashingUtils::HashString("Queued");
-        static const int Dispatched_HASH = HashingUtils::HashString("Dispatched");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Created",
+          "Queued",
+          "Dispatched",
+          "InProgress",
+          "TimedOut",
+          "Succeeded",
+          "Failed",
+        };
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Created_HASH)
-          {
-            return JobStatus::Created;
-          }
-          else if (hashCode == Queued_HASH)
-          {
-            return JobStatus::Queued;
-          }
-          else if (hashCode == Dispatched_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobStatus::Dispatched;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return JobStatus::InProgress;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
-            return JobStatus::TimedOut;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return JobStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return JobStatus::Failed;
+          case -1601759544:
+            if (name == "Created")
+            {
+              return JobStatus::Created;
+            }
+            break;
+          case -1864829549:
+            if (name == "Queued")
+            {
+              return JobStatus::Queued;
+            }
+            break;
+          case 780924601:
+            if (name == "Dispatched")
+            {
+              return JobStatus::Dispatched;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return JobStatus::InProgress;
+            }
+            break;
+          case -2012269385:
+            if (name == "TimedOut")
+            {
+              return JobStatus::TimedOut;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return JobStatus::Succeeded;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return JobStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatusCStr(JobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobStatus::Created:
-            return "Created";
-          case JobStatus::Queued:
-            return "Queued";
-          case JobStatus::Dispatched:
-            return "Dispatched";
-          case JobStatus::InProgress:
-            return "InProgress";
-          case JobStatus::TimedOut:
-            return "TimedOut";
-          case JobStatus::Succeeded:
-            return "Succeeded";
-          case JobStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        {
+          return GetNameForJobStatusCStr(enumValue);
         }
 
       } // namespace JobStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace PipelineExecutionStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Superseded_HASH = HashingUtils::HashString("Superseded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InProgress",
+          "Succeeded",
+          "Superseded",
+          "Failed",
+        };
 
         PipelineExecutionStatus GetPipelineExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
-          {
-            return PipelineExecutionStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return PipelineExecutionStatus::Succeeded;
-          }
-          else if (hashCode == Superseded_HASH)
-          {
-            return PipelineExecutionStatus::Superseded;
-          }
-          else if (hashCode == Failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PipelineExecutionStatus::Failed;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return PipelineExecutionStatus::InProgress;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return PipelineExecutionStatus::Succeeded;
+            }
+            break;
+          case 293330422:
+            if (name == "Superseded")
+            {
+              return PipelineExecutionStatus::Superseded;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return PipelineExecutionStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return PipelineExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPipelineExecutionStatus(PipelineExecutionStatus enumValue)
+        const char* GetNameForPipelineExecutionStatusCStr(PipelineExecutionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PipelineExecutionStatus::InProgress:
-            return "InProgress";
-          case PipelineExecutionStatus::Succeeded:
-            return "Succeeded";
-          case PipelineExecutionStatus::Superseded:
-            return "Superseded";
-          case PipelineExecutionStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPipelineExecutionStatus(PipelineExecutionStatus enumValue)
+        {
+          return GetNameForPipelineExecutionStatusCStr(enumValue);
         }
 
       } // namespace PipelineExecutionStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace StageExecutionStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InProgress",
+          "Failed",
+          "Succeeded",
+        };
 
         StageExecutionStatus GetStageExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
-          {
-            return StageExecutionStatus::InProgress;
-          }
-          else if (hashCode == Failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StageExecutionStatus::Failed;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return StageExecutionStatus::Succeeded;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return StageExecutionStatus::InProgress;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return StageExecutionStatus::Failed;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return StageExecutionStatus::Succeeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StageExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStageExecutionStatus(StageExecutionStatus enumValue)
+        const char* GetNameForStageExecutionStatusCStr(StageExecutionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StageExecutionStatus::InProgress:
-            return "InProgress";
-          case StageExecutionStatus::Failed:
-            return "Failed";
-          case StageExecutionStatus::Succeeded:
-            return "Succeeded";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStageExecutionStatus(StageExecutionStatus enumValue)
+        {
+          return GetNameForStageExecutionStatusCStr(enumValue);
         }
 
       } // namespace StageExecutionStatusMapper
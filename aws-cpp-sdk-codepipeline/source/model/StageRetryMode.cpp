@@ -30,15 +30,30 @@ namespace Aws
       namespace StageRetryModeMapper
       {
 
-        static const int FAILED_ACTIONS_HASH = HashingUtils::HashString("FAILED_ACTIONS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FAILED_ACTIONS",
+        };
 
         StageRetryMode GetStageRetryModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAILED_ACTIONS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StageRetryMode::FAILED_ACTIONS;
+          case 1670084315:
+            if (name == "FAILED_ACTIONS")
+            {
+              return StageRetryMode::FAILED_ACTIONS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return StageRetryMode::NOT_SET;
         }
 
-        Aws::String GetNameForStageRetryMode(StageRetryMode enumValue)
+        const char* GetNameForStageRetryModeCStr(StageRetryMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StageRetryMode::FAILED_ACTIONS:
-            return "FAILED_ACTIONS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStageRetryMode(StageRetryMode enumValue)
+        {
+          return GetNameForStageRetryModeCStr(enumValue);
         }
 
       } // namespace StageRetryModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace StageTransitionTypeMapper
       {
 
-        static const int Inbound_HASH = HashingUtils::HashString("Inbound");
-        static const int Outbound_HASH = HashingUtils::HashString("Outbound");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Inbound",
+          "Outbound",
+        };
 
         StageTransitionType GetStageTransitionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Inbound_HASH)
-          {
-            return StageTransitionType::Inbound;
-          }
-          else if (hashCode == Outbound_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StageTransitionType::Outbound;
+          case -688573607:
+            if (name == "Inbound")
+            {
+              return StageTransitionType::Inbound;
+            }
+            break;
+          case 121720592:
+            if (name == "Outbound")
+            {
+              return StageTransitionType::Outbound;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return StageTransitionType::NOT_SET;
         }
 
-        Aws::String GetNameForStageTransitionType(StageTransitionType enumValue)
+        const char* GetNameForStageTransitionTypeCStr(StageTransitionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StageTransitionType::Inbound:
-            return "Inbound";
-          case StageTransitionType::Outbound:
-            return "Outbound";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStageTransitionType(StageTransitionType enumValue)
+        {
+          return GetNameForStageTransitionTypeCStr(enumValue);
         }
 
       } // namespace StageTransitionTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace WebhookAuthenticationTypeMapper
       {
 
-        static const int GITHUB_HMAC_HASH = HashingUtils::HashString("GITHUB_HMAC");
-        static const int IP_HASH = HashingUtils::HashString("IP");
-        static const int UNAUTHENTICATED_HASH = HashingUtils::HashString("UNAUTHENTICATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GITHUB_HMAC",
+          "IP",
+          "UNAUTHENTICATED",
+        };
 
         WebhookAuthenticationType GetWebhookAuthenticationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GITHUB_HMAC_HASH)
-          {
-            return WebhookAuthenticationType::GITHUB_HMAC;
-          }
-          else if (hashCode == IP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WebhookAuthenticationType::IP;
-          }
-          else if (hashCode == UNAUTHENTICATED_HASH)
-          {
-            return WebhookAuthenticationType::UNAUTHENTICATED;
+          case -661257533:
+            if (name == "GITHUB_HMAC")
+            {
+              return WebhookAuthenticationType::GITHUB_HMAC;
+            }
+            break;
+          case 2343:
+            if (name == "IP")
+            {
+              return WebhookAuthenticationType::IP;
+            }
+            break;
+          case -849706474:
+            if (name == "UNAUTHENTICATED")
+            {
+              return WebhookAuthenticationType::UNAUTHENTICATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return WebhookAuthenticationType::NOT_SET;
         }
 
-        Aws::String GetNameForWebhookAuthenticationType(WebhookAuthenticationType enumValue)
+        const char* GetNameForWebhookAuthenticationTypeCStr(WebhookAuthenticationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WebhookAuthenticationType::GITHUB_HMAC:
-            return "GITHUB_HMAC";
-          case WebhookAuthenticationType::IP:
-            return "IP";
-          case WebhookAuthenticationType::UNAUTHENTICATED:
-            return "UNAUTHENTICATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWebhookAuthenticationType(WebhookAuthenticationType enumValue)
+        {
+          return GetNameForWebhookAuthenticationTypeCStr(enumValue);
         }
 
       } // namespace WebhookAuthenticationTypeMapper
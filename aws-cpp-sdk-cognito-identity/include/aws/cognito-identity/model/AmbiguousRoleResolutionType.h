@@ -35,6 +35,11 @@ namespace AmbiguousRoleResolutionTypeMapper
 AWS_COGNITOIDENTITY_API AmbiguousRoleResolutionType GetAmbiguousRoleResolutionTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITY_API Aws::String GetNameForAmbiguousRoleResolutionType(AmbiguousRoleResolutionType value);
+
+/**
+ * Same as GetNameForAmbiguousRoleResolutionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITY_API const char* GetNameForAmbiguousRoleResolutionTypeCStr(AmbiguousRoleResolutionType value);
 } // namespace AmbiguousRoleResolutionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentity
@@ -37,6 +37,11 @@ namespace MappingRuleMatchTypeMapper
 AWS_COGNITOIDENTITY_API MappingRuleMatchType GetMappingRuleMatchTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITY_API Aws::String GetNameForMappingRuleMatchType(MappingRuleMatchType value);
+
+/**
+ * Same as GetNameForMappingRuleMatchType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITY_API const char* GetNameForMappingRuleMatchTypeCStr(MappingRuleMatchType value);
 } // namespace MappingRuleMatchTypeMapper
 } // namespace Model
 } // namespace CognitoIdentity
@@ -35,6 +35,11 @@ namespace RoleMappingTypeMapper
 AWS_COGNITOIDENTITY_API RoleMappingType GetRoleMappingTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITY_API Aws::String GetNameForRoleMappingType(RoleMappingType value);
+
+/**
+ * Same as GetNameForRoleMappingType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITY_API const char* GetNameForRoleMappingTypeCStr(RoleMappingType value);
 } // namespace RoleMappingTypeMapper
 } // namespace Model
 } // namespace CognitoIdentity
@@ -30,20 +30,37 @@ namespace Aws
       namespace AmbiguousRoleResolutionTypeMapper
       {
 
-        static const int AuthenticatedRole_HASH = HashingUtils::HashString("AuthenticatedRole");
-        static const int Deny_HASH = HashingUtils::HashString("Deny");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AuthenticatedRole",
+          "Deny",
+        };
 
         AmbiguousRoleResolutionType GetAmbiguousRoleResolutionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AuthenticatedRole_HASH)
-          {
-            return AmbiguousRoleResolutionType::AuthenticatedRole;
-          }
-          else if (hashCode == Deny_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AmbiguousRoleResolutionType::Deny;
+          case 2067151141:
+            if (name == "AuthenticatedRole")
+            {
+              return AmbiguousRoleResolutionType::AuthenticatedRole;
+            }
+            break;
+          case 2126380:
+            if (name == "Deny")
+            {
+              return AmbiguousRoleResolutionType::Deny;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AmbiguousRoleResolutionType::NOT_SET;
         }
 
-        Aws::String GetNameForAmbiguousRoleResolutionType(AmbiguousRoleResolutionType enumValue)
+        const char* GetNameForAmbiguousRoleResolutionTypeCStr(AmbiguousRoleResolutionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AmbiguousRoleResolutionType::AuthenticatedRole:
-            return "AuthenticatedRole";
-          case AmbiguousRoleResolutionType::Deny:
-            return "Deny";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAmbiguousRoleResolutionType(AmbiguousRoleResolutionType enumValue)
+        {
+          return GetNameForAmbiguousRoleResolutionTypeCStr(enumValue);
         }
 
       } // namespace AmbiguousRoleResolutionTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int AccessDenied_HASH = HashingUtils::HashString("AccessDenied");
-        static const int InternalServerError_HASH = HashingUtils::HashString("InternalServerError");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AccessDenied",
+          "InternalServerError",
+        };
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AccessDenied_HASH)
-          {
-            return ErrorCode::AccessDenied;
-          }
-          else if (hashCode == InternalServerError_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ErrorCode::InternalServerError;
+          case 1733482047:
+            if (name == "AccessDenied")
+            {
+              return ErrorCode::AccessDenied;
+            }
+            break;
+          case -1943616152:
+            if (name == "InternalServerError")
+            {
+              return ErrorCode::InternalServerError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        const char* GetNameForErrorCodeCStr(ErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ErrorCode::AccessDenied:
-            return "AccessDenied";
-          case ErrorCode::InternalServerError:
-            return "InternalServerError";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        {
+          return GetNameForErrorCodeCStr(enumValue);
         }
 
       } // namespace ErrorCodeMapper
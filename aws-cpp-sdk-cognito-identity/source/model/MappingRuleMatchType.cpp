@@ -30,30 +30,51 @@ namespace Aws
       namespace MappingRuleMatchTypeMapper
       {
 
-        static const int Equals_HASH = HashingUtils::HashString("Equals");
-        static const int Contains_HASH = HashingUtils::HashString("Contains");
-        static const int StartsWith_HASH = HashingUtils::HashString("StartsWith");
-        static const int NotEqual_HASH = HashingUtils::HashString("NotEqual");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Equals",
+          "Contains",
+          "StartsWith",
+          "NotEqual",
+        };
 
         MappingRuleMatchType GetMappingRuleMatchTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Equals_HASH)
-          {
-            return MappingRuleMatchType::Equals;
-          }
-          else if (hashCode == Contains_HASH)
-          {
-            return MappingRuleMatchType::Contains;
-          }
-          else if (hashCode == StartsWith_HASH)
-          {
-            return MappingRuleMatchType::StartsWith;
-          }
-          else if (hashCode == NotEqual_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MappingRuleMatchType::NotEqual;
+          case 2083351519:
+            if (name == "Equals")
+            {
+              return MappingRuleMatchType::Equals;
+            }
+            break;
+          case -502801857:
+            if (name == "Contains")
+            {
+              return MappingRuleMatchType::Contains;
+            }
+            break;
+          case 437926103:
+            if (name == "StartsWith")
+            {
+              return MappingRuleMatchType::StartsWith;
+            }
+            break;
+          case 1617099841:
+            if (name == "NotEqual")
+            {
+              return MappingRuleMatchType::NotEqual;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return MappingRuleMatchType::NOT_SET;
         }
 
-        Aws::String GetNameForMappingRuleMatchType(MappingRuleMatchType enumValue)
+        const char* GetNameForMappingRuleMatchTypeCStr(MappingRuleMatchType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MappingRuleMatchType::Equals:
-            return "Equals";
-          case MappingRuleMatchType::Contains:
-            return "Contains";
-          case MappingRuleMatchType::StartsWith:
-            return "StartsWith";
-          case MappingRuleMatchType::NotEqual:
-            return "NotEqual";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMappingRuleMatchType(MappingRuleMatchType enumValue)
+        {
+          return GetNameForMappingRuleMatchTypeCStr(enumValue);
         }
 
       } // namespace MappingRuleMatchTypeMapper
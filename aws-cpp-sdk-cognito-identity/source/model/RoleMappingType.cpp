@@ -30,20 +30,37 @@ namespace Aws
       namespace RoleMappingTypeMapper
       {
 
-        static const int Token_HASH = HashingUtils::HashString("Token");
-        static const int Rules_HASH = HashingUtils::HashString("Rules");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Token",
+          "Rules",
+        };
 
         RoleMappingType GetRoleMappingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Token_HASH)
-          {
-            return RoleMappingType::Token;
-          }
-          else if (hashCode == Rules_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RoleMappingType::Rules;
+          case 80988633:
+            if (name == "Token")
+            {
+              return RoleMappingType::Token;
+            }
+            break;
+          case 79321303:
+            if (name == "Rules")
+            {
+              return RoleMappingType::Rules;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RoleMappingType::NOT_SET;
         }
 
-        Aws::String GetNameForRoleMappingType(RoleMappingType enumValue)
+        const char* GetNameForRoleMappingTypeCStr(RoleMappingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RoleMappingType::Token:
-            return "Token";
-          case RoleMappingType::Rules:
-            return "Rules";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRoleMappingType(RoleMappingType enumValue)
+        {
+          return GetNameForRoleMappingTypeCStr(enumValue);
         }
 
       } // namespace RoleMappingTypeMapper
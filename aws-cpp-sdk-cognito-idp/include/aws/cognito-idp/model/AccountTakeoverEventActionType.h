@@ -37,6 +37,11 @@ namespace AccountTakeoverEventActionTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API AccountTakeoverEventActionType GetAccountTakeoverEventActionTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForAccountTakeoverEventActionType(AccountTakeoverEventActionType value);
+
+/**
+ * Same as GetNameForAccountTakeoverEventActionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForAccountTakeoverEventActionTypeCStr(AccountTakeoverEventActionType value);
 } // namespace AccountTakeoverEventActionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
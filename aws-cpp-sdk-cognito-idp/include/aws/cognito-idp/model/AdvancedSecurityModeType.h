@@ -36,6 +36,11 @@ namespace AdvancedSecurityModeTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API AdvancedSecurityModeType GetAdvancedSecurityModeTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForAdvancedSecurityModeType(AdvancedSecurityModeType value);
+
+/**
+ * Same as GetNameForAdvancedSecurityModeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForAdvancedSecurityModeTypeCStr(AdvancedSecurityModeType value);
 } // namespace AdvancedSecurityModeTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
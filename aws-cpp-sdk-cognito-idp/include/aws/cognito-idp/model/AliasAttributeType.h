@@ -36,6 +36,11 @@ namespace AliasAttributeTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API AliasAttributeType GetAliasAttributeTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForAliasAttributeType(AliasAttributeType value);
+
+/**
+ * Same as GetNameForAliasAttributeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForAliasAttributeTypeCStr(AliasAttributeType value);
 } // namespace AliasAttributeTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -37,6 +37,11 @@ namespace AttributeDataTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API AttributeDataType GetAttributeDataTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForAttributeDataType(AttributeDataType value);
+
+/**
+ * Same as GetNameForAttributeDataType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForAttributeDataTypeCStr(AttributeDataType value);
 } // namespace AttributeDataTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
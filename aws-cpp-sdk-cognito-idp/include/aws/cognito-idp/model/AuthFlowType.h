@@ -39,6 +39,11 @@ namespace AuthFlowTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API AuthFlowType GetAuthFlowTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForAuthFlowType(AuthFlowType value);
+
+/**
+ * Same as GetNameForAuthFlowType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForAuthFlowTypeCStr(AuthFlowType value);
 } // namespace AuthFlowTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,6 +35,11 @@ namespace ChallengeNameMapper
 AWS_COGNITOIDENTITYPROVIDER_API ChallengeName GetChallengeNameForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForChallengeName(ChallengeName value);
+
+/**
+ * Same as GetNameForChallengeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForChallengeNameCStr(ChallengeName value);
 } // namespace ChallengeNameMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
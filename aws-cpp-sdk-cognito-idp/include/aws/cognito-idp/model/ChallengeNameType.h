@@ -43,6 +43,11 @@ namespace ChallengeNameTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API ChallengeNameType GetChallengeNameTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForChallengeNameType(ChallengeNameType value);
+
+/**
+ * Same as GetNameForChallengeNameType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForChallengeNameTypeCStr(ChallengeNameType value);
 } // namespace ChallengeNameTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,6 +35,11 @@ namespace ChallengeResponseMapper
 AWS_COGNITOIDENTITYPROVIDER_API ChallengeResponse GetChallengeResponseForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForChallengeResponse(ChallengeResponse value);
+
+/**
+ * Same as GetNameForChallengeResponse(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForChallengeResponseCStr(ChallengeResponse value);
 } // namespace ChallengeResponseMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,6 +35,11 @@ namespace CompromisedCredentialsEventActionTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API CompromisedCredentialsEventActionType GetCompromisedCredentialsEventActionTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForCompromisedCredentialsEventActionType(CompromisedCredentialsEventActionType value);
+
+/**
+ * Same as GetNameForCompromisedCredentialsEventActionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForCompromisedCredentialsEventActionTypeCStr(CompromisedCredentialsEventActionType value);
 } // namespace CompromisedCredentialsEventActionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,6 +35,11 @@ namespace DefaultEmailOptionTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API DefaultEmailOptionType GetDefaultEmailOptionTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForDefaultEmailOptionType(DefaultEmailOptionType value);
+
+/**
+ * Same as GetNameForDefaultEmailOptionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForDefaultEmailOptionTypeCStr(DefaultEmailOptionType value);
 } // namespace DefaultEmailOptionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
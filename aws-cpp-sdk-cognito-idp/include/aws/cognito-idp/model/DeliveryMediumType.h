@@ -35,6 +35,11 @@ namespace DeliveryMediumTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API DeliveryMediumType GetDeliveryMediumTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForDeliveryMediumType(DeliveryMediumType value);
+
+/**
+ * Same as GetNameForDeliveryMediumType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForDeliveryMediumTypeCStr(DeliveryMediumType value);
 } // namespace DeliveryMediumTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
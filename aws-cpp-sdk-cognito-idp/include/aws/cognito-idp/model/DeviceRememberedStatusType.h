@@ -35,6 +35,11 @@ namespace DeviceRememberedStatusTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API DeviceRememberedStatusType GetDeviceRememberedStatusTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForDeviceRememberedStatusType(DeviceRememberedStatusType value);
+
+/**
+ * Same as GetNameForDeviceRememberedStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForDeviceRememberedStatusTypeCStr(DeviceRememberedStatusType value);
 } // namespace DeviceRememberedStatusTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
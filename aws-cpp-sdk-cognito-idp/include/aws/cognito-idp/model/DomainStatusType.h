@@ -38,6 +38,11 @@ namespace DomainStatusTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API DomainStatusType GetDomainStatusTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForDomainStatusType(DomainStatusType value);
+
+/**
+ * Same as GetNameForDomainStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForDomainStatusTypeCStr(DomainStatusType value);
 } // namespace DomainStatusTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -36,6 +36,11 @@ namespace EventFilterTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API EventFilterType GetEventFilterTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForEventFilterType(EventFilterType value);
+
+/**
+ * Same as GetNameForEventFilterType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForEventFilterTypeCStr(EventFilterType value);
 } // namespace EventFilterTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,6 +35,11 @@ namespace EventResponseTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API EventResponseType GetEventResponseTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForEventResponseType(EventResponseType value);
+
+/**
+ * Same as GetNameForEventResponseType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForEventResponseTypeCStr(EventResponseType value);
 } // namespace EventResponseTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -36,6 +36,11 @@ namespace ExplicitAuthFlowsTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API ExplicitAuthFlowsType GetExplicitAuthFlowsTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForExplicitAuthFlowsType(ExplicitAuthFlowsType value);
+
+/**
+ * Same as GetNameForExplicitAuthFlowsType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForExplicitAuthFlowsTypeCStr(ExplicitAuthFlowsType value);
 } // namespace ExplicitAuthFlowsTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,6 +35,11 @@ namespace FeedbackValueTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API FeedbackValueType GetFeedbackValueTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForFeedbackValueType(FeedbackValueType value);
+
+/**
+ * Same as GetNameForFeedbackValueType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForFeedbackValueTypeCStr(FeedbackValueType value);
 } // namespace FeedbackValueTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -38,6 +38,11 @@ namespace IdentityProviderTypeTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API IdentityProviderTypeType GetIdentityProviderTypeTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForIdentityProviderTypeType(IdentityProviderTypeType value);
+
+/**
+ * Same as GetNameForIdentityProviderTypeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForIdentityProviderTypeTypeCStr(IdentityProviderTypeType value);
 } // namespace IdentityProviderTypeTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,6 +35,11 @@ namespace MessageActionTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API MessageActionType GetMessageActionTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForMessageActionType(MessageActionType value);
+
+/**
+ * Same as GetNameForMessageActionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForMessageActionTypeCStr(MessageActionType value);
 } // namespace MessageActionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
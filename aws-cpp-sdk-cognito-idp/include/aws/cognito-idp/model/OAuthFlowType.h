@@ -36,6 +36,11 @@ namespace OAuthFlowTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API OAuthFlowType GetOAuthFlowTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForOAuthFlowType(OAuthFlowType value);
+
+/**
+ * Same as GetNameForOAuthFlowType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForOAuthFlowTypeCStr(OAuthFlowType value);
 } // namespace OAuthFlowTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -36,6 +36,11 @@ namespace RiskDecisionTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API RiskDecisionType GetRiskDecisionTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForRiskDecisionType(RiskDecisionType value);
+
+/**
+ * Same as GetNameForRiskDecisionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForRiskDecisionTypeCStr(RiskDecisionType value);
 } // namespace RiskDecisionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -36,6 +36,11 @@ namespace RiskLevelTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API RiskLevelType GetRiskLevelTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForRiskLevelType(RiskLevelType value);
+
+/**
+ * Same as GetNameForRiskLevelType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForRiskLevelTypeCStr(RiskLevelType value);
 } // namespace RiskLevelTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
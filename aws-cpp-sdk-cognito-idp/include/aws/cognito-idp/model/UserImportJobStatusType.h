@@ -41,6 +41,11 @@ namespace UserImportJobStatusTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API UserImportJobStatusType GetUserImportJobStatusTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForUserImportJobStatusType(UserImportJobStatusType value);
+
+/**
+ * Same as GetNameForUserImportJobStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForUserImportJobStatusTypeCStr(UserImportJobStatusType value);
 } // namespace UserImportJobStatusTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -36,6 +36,11 @@ namespace UserPoolMfaTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API UserPoolMfaType GetUserPoolMfaTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForUserPoolMfaType(UserPoolMfaType value);
+
+/**
+ * Same as GetNameForUserPoolMfaType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForUserPoolMfaTypeCStr(UserPoolMfaType value);
 } // namespace UserPoolMfaTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -40,6 +40,11 @@ namespace UserStatusTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API UserStatusType GetUserStatusTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForUserStatusType(UserStatusType value);
+
+/**
+ * Same as GetNameForUserStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForUserStatusTypeCStr(UserStatusType value);
 } // namespace UserStatusTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,6 +35,11 @@ namespace UsernameAttributeTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API UsernameAttributeType GetUsernameAttributeTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForUsernameAttributeType(UsernameAttributeType value);
+
+/**
+ * Same as GetNameForUsernameAttributeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForUsernameAttributeTypeCStr(UsernameAttributeType value);
 } // namespace UsernameAttributeTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,6 +35,11 @@ namespace VerifiedAttributeTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API VerifiedAttributeType GetVerifiedAttributeTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForVerifiedAttributeType(VerifiedAttributeType value);
+
+/**
+ * Same as GetNameForVerifiedAttributeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForVerifiedAttributeTypeCStr(VerifiedAttributeType value);
 } // namespace VerifiedAttributeTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
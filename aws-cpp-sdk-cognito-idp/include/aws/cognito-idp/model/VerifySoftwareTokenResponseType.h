@@ -35,6 +35,11 @@ namespace VerifySoftwareTokenResponseTypeMapper
 AWS_COGNITOIDENTITYPROVIDER_API VerifySoftwareTokenResponseType GetVerifySoftwareTokenResponseTypeForName(const Aws::String& name);
 
 AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForVerifySoftwareTokenResponseType(VerifySoftwareTokenResponseType value);
+
+/**
+ * Same as GetNameForVerifySoftwareTokenResponseType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForVerifySoftwareTokenResponseTypeCStr(VerifySoftwareTokenResponseType value);
 } // namespace VerifySoftwareTokenResponseTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
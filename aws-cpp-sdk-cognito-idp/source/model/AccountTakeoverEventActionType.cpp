@@ -30,30 +30,51 @@ namespace Aws
       namespace AccountTakeoverEventActionTypeMapper
       {
 
-        static const int BLOCK_HASH = HashingUtils::HashString("BLOCK");
-        static const int MFA_IF_CONFIGURED_HASH = HashingUtils::HashString("MFA_IF_CONFIGURED");
-        static const int MFA_REQUIRED_HASH = HashingUtils::HashString("MFA_REQUIRED");
-        static const int NO_ACTION_HASH = HashingUtils::HashString("NO_ACTION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLOCK",
+          "MFA_IF_CONFIGURED",
+          "MFA_REQUIRED",
+          "NO_ACTION",
+        };
 
         AccountTakeoverEventActionType GetAccountTakeoverEventActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLOCK_HASH)
-          {
-            return AccountTakeoverEventActionType::BLOCK;
-          }
-          else if (hashCode == MFA_IF_CONFIGURED_HASH)
-          {
-            return AccountTakeoverEventActionType::MFA_IF_CONFIGURED;
-          }
-          else if (hashCode == MFA_REQUIRED_HASH)
-          {
-            return AccountTakeoverEventActionType::MFA_REQUIRED;
-          }
-          else if (hashCode == NO_ACTION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccountTakeoverEventActionType::NO_ACTION;
+          case 63294573:
+            if (name == "BLOCK")
+            {
+              return AccountTakeoverEventActionType::BLOCK;
+            }
+            break;
+          case 1079348329:
+            if (name == "MFA_IF_CONFIGURED")
+            {
+              return AccountTakeoverEventActionType::MFA_IF_CONFIGURED;
+            }
+            break;
+          case 708420662:
+            if (name == "MFA_REQUIRED")
+            {
+              return AccountTakeoverEventActionType::MFA_REQUIRED;
+            }
+            break;
+          case 1334385268:
+            if (name == "NO_ACTION")
+            {
+              return AccountTakeoverEventActionType::NO_ACTION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AccountTakeoverEventActionType::NOT_SET;
         }
 
-        Aws::String GetNameForAccountTakeoverEventActionType(AccountTakeoverEventActionType enumValue)
+        const char* GetNameForAccountTakeoverEventActionTypeCStr(AccountTakeoverEventActionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccountTakeoverEventActionType::BLOCK:
-            return "BLOCK";
-          case AccountTakeoverEventActionType::MFA_IF_CONFIGURED:
-            return "MFA_IF_CONFIGURED";
-          case AccountTakeoverEventActionType::MFA_REQUIRED:
-            return "MFA_REQUIRED";
-          case AccountTakeoverEventActionType::NO_ACTION:
-            return "NO_ACTION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccountTakeoverEventActionType(AccountTakeoverEventActionType enumValue)
+        {
+          return GetNameForAccountTakeoverEventActionTypeCStr(enumValue);
         }
 
       } // namespace AccountTakeoverEventActionTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AdvancedSecurityModeTypeMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int AUDIT_HASH = HashingUtils::HashString("AUDIT");
-        static const int ENFORCED_HASH = HashingUtils::HashString("ENFORCED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OFF",
+          "AUDIT",
+          "ENFORCED",
+        };
 
         AdvancedSecurityModeType GetAdvancedSecurityModeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
-          {
-            return AdvancedSecurityModeType::OFF;
-          }
-          else if (hashCode == AUDIT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AdvancedSecurityModeType::AUDIT;
-          }
-          else if (hashCode == ENFORCED_HASH)
-          {
-            return AdvancedSecurityModeType::ENFORCED;
+          case 78159:
+            if (name == "OFF")
+            {
+              return AdvancedSecurityModeType::OFF;
+            }
+            break;
+          case 62628795:
+            if (name == "AUDIT")
+            {
+              return AdvancedSecurityModeType::AUDIT;
+            }
+            break;
+          case -1714819902:
+            if (name == "ENFORCED")
+            {
+              return AdvancedSecurityModeType::ENFORCED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AdvancedSecurityModeType::NOT_SET;
         }
 
-        Aws::String GetNameForAdvancedSecurityModeType(AdvancedSecurityModeType enumValue)
+        const char* GetNameForAdvancedSecurityModeTypeCStr(AdvancedSecurityModeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AdvancedSecurityModeType::OFF:
-            return "OFF";
-          case AdvancedSecurityModeType::AUDIT:
-            return "AUDIT";
-          case AdvancedSecurityModeType::ENFORCED:
-            return "ENFORCED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAdvancedSecurityModeType(AdvancedSecurityModeType enumValue)
+        {
+          return GetNameForAdvancedSecurityModeTypeCStr(enumValue);
         }
 
       } // namespace AdvancedSecurityModeTypeMapper
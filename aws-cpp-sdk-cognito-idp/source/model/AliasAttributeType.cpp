@@ -30,25 +30,44 @@ namespace Aws
       namespace AliasAttributeTypeMapper
       {
 
-        static const int phone_number_HASH = HashingUtils::HashString("phone_number");
-        static const int email_HASH = HashingUtils::HashString("email");
-        static const int preferred_username_HASH = HashingUtils::HashString("preferred_username");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "phone_number",
+          "email",
+          "preferred_username",
+        };
 
         AliasAttributeType GetAliasAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == phone_number_HASH)
-          {
-            return AliasAttributeType::phone_number;
-          }
-          else if (hashCode == email_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AliasAttributeType::email;
-          }
-          else if (hashCode == preferred_username_HASH)
-          {
-            return AliasAttributeType::preferred_username;
+          case -612351174:
+            if (name == "phone_number")
+            {
+              return AliasAttributeType::phone_number;
+            }
+            break;
+          case 96619420:
+            if (name == "email")
+            {
+              return AliasAttributeType::email;
+            }
+            break;
+          case -1746981164:
+            if (name == "preferred_username")
+            {
+              return AliasAttributeType::preferred_username;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AliasAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForAliasAttributeType(AliasAttributeType enumValue)
+        const char* GetNameForAliasAttributeTypeCStr(AliasAttributeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AliasAttributeType::phone_number:
-            return "phone_number";
-          case AliasAttributeType::email:
-            return "email";
-          case AliasAttributeType::preferred_username:
-            return "preferred_username";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAliasAttributeType(AliasAttributeType enumValue)
+        {
+          return GetNameForAliasAttributeTypeCStr(enumValue);
         }
 
       } // namespace AliasAttributeTypeMapper
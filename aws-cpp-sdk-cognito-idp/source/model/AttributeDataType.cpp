@@ -30,30 +30,51 @@ namespace Aws
       namespace AttributeDataTypeMapper
       {
 
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int Number_HASH = HashingUtils::HashString("Number");
-        static const int DateTime_HASH = HashingUtils::HashString("DateTime");
-        static const int Boolean_HASH = HashingUtils::HashString("Boolean");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "String",
+          "Number",
+          "DateTime",
+          "Boolean",
+        };
 
         AttributeDataType GetAttributeDataTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == String_HASH)
-          {
-            return AttributeDataType::String;
-          }
-          else if (hashCode == Number_HASH)
-          {
-            return AttributeDataType::Number;
-          }
-          else if (hashCode == DateTime_HASH)
-          {
-            return AttributeDataType::DateTime;
-          }
-          else if (hashCode == Boolean_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AttributeDataType::Boolean;
+          case -1808118735:
+            if (name == "String")
+            {
+              return AttributeDataType::String;
+            }
+            break;
+          case -1950496919:
+            if (name == "Number")
+            {
+              return AttributeDataType::Number;
+            }
+            break;
+          case 1857393595:
+            if (name == "DateTime")
+            {
+              return AttributeDataType::DateTime;
+            }
+            break;
+          case 1729365000:
+            if (name == "Boolean")
+            {
+              return AttributeDataType::Boolean;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AttributeDataType::NOT_SET;
         }
 
-        Aws::String GetNameForAttributeDataType(AttributeDataType enumValue)
+        const char* GetNameForAttributeDataTypeCStr(AttributeDataType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AttributeDataType::String:
-            return "String";
-          case AttributeDataType::Number:
-            return "Number";
-          case AttributeDataType::DateTime:
-            return "DateTime";
-          case AttributeDataType::Boolean:
-            return "Boolean";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAttributeDataType(AttributeDataType enumValue)
+        {
+          return GetNameForAttributeDataTypeCStr(enumValue);
         }
 
       } // namespace AttributeDataTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace AuthFlowTypeMapper
       {
 
-        static const int USER_SRP_AUTH_HASH = HashingUtils::HashString("USER_SRP_AUTH");
-        static const int REFRESH_TOKEN_AUTH_HASH = HashingUtils::HashString("REFRESH_TOKEN_AUTH");
-        static const int REFRESH_TOKEN_HASH = HashingUtils::HashString("REFRESH_TOKEN");
-        static const int CUSTOM_AUTH_HASH = HashingUtils::HashString("CUSTOM_AUTH");
-        static const int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::HashString("ADMIN_NO_SRP_AUTH");
-        static const int USER_PASSWORD_AUTH_HASH = HashingUtils::HashString("USER_PASSWORD_AUTH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USER_SRP_AUTH",
+          "REFRESH_TOKEN_AUTH",
+          "REFRESH_TOKEN",
+          "CUSTOM_AUTH",
+          "ADMIN_NO_SRP_AUTH",
+          "USER_PASSWORD_AUTH",
+        };
 
         AuthFlowType GetAuthFlowTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_SRP_AUTH_HASH)
-          {
-            return AuthFlowType::USER_SRP_AUTH;
-          }
-          else if (hashCode == REFRESH_TOKEN_AUTH_HASH)
-          {
-            return AuthFlowType::REFRESH_TOKEN_AUTH;
-          }
-          else if (hashCode == REFRESH_TOKEN_HASH)
-          {
-            return AuthFlowType::REFRESH_TOKEN;
-          }
-          else if (hashCode == CUSTOM_AUTH_HASH)
-          {
-            return AuthFlowType::CUSTOM_AUTH;
-          }
-          else if (hashCode == ADMIN_NO_SRP_AUTH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthFlowType::ADMIN_NO_SRP_AUTH;
-          }
-          else if (hashCode == USER_PASSWORD_AUTH_HASH)
-          {
-            return AuthFlowType::USER_PASSWORD_AUTH;
+          case 1145514314:
+            if (name == "USER_SRP_AUTH")
+            {
+              return AuthFlowType::USER_SRP_AUTH;
+            }
+            break;
+          case -277458862:
+            if (name == "REFRESH_TOKEN_AUTH")
+            {
+              return AuthFlowType::REFRESH_TOKEN_AUTH;
+            }
+            break;
+          case -1694626987:
+            if (name == "REFRESH_TOKEN")
+            {
+              return AuthFlowType::REFRESH_TOKEN;
+            }
+            break;
+          case 404426166:
+            if (name == "CUSTOM_AUTH")
+            {
+              return AuthFlowType::CUSTOM_AUTH;
+            }
+            break;
+          case 1330737924:
+            if (name == "ADMIN_NO_SRP_AUTH")
+            {
+              return AuthFlowType::ADMIN_NO_SRP_AUTH;
+            }
+            break;
+          case -1521679528:
+            if (name == "USER_PASSWORD_AUTH")
+            {
+              return AuthFlowType::USER_PASSWORD_AUTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return AuthFlowType::NOT_SET;
         }
 
-        Aws::String GetNameForAuthFlowType(AuthFlowType enumValue)
+        const char* GetNameForAuthFlowTypeCStr(AuthFlowType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthFlowType::USER_SRP_AUTH:
-            return "USER_SRP_AUTH";
-          case AuthFlowType::REFRESH_TOKEN_AUTH:
-            return "REFRESH_TOKEN_AUTH";
-          case AuthFlowType::REFRESH_TOKEN:
-            return "REFRESH_TOKEN";
-          case AuthFlowType::CUSTOM_AUTH:
-            return "CUSTOM_AUTH";
-          case AuthFlowType::ADMIN_NO_SRP_AUTH:
-            return "ADMIN_NO_SRP_AUTH";
-          case AuthFlowType::USER_PASSWORD_AUTH:
-            return "USER_PASSWORD_AUTH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthFlowType(AuthFlowType enumValue)
+        {
+          return GetNameForAuthFlowTypeCStr(enumValue);
         }
 
       } // namespace AuthFlowTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ChallengeNameMapper
       {
 
-        static const int Password_HASH = HashingUtils::HashString("Password");
-        static const int Mfa_HASH = HashingUtils::HashString("Mfa");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Password",
+          "Mfa",
+        };
 
         ChallengeName GetChallengeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Password_HASH)
-          {
-            return ChallengeName::Password;
-          }
-          else if (hashCode == Mfa_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChallengeName::Mfa;
+          case 1281629883:
+            if (name == "Password")
+            {
+              return ChallengeName::Password;
+            }
+            break;
+          case 77256:
+            if (name == "Mfa")
+            {
+              return ChallengeName::Mfa;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ChallengeName::NOT_SET;
         }
 
-        Aws::String GetNameForChallengeName(ChallengeName enumValue)
+        const char* GetNameForChallengeNameCStr(ChallengeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChallengeName::Password:
-            return "Password";
-          case ChallengeName::Mfa:
-            return "Mfa";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChallengeName(ChallengeName enumValue)
+        {
+          return GetNameForChallengeNameCStr(enumValue);
         }
 
       } // namespace ChallengeNameMapper
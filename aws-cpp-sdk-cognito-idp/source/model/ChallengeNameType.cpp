@@ -30,60 +30,93 @@ namespace Aws
       namespace ChallengeNameTypeMapper
       {
 
-        static const int SMS_MFA_HASH = HashingUtils::HashString("SMS_MFA");
-        static const int SOFTWARE_TOKEN_MFA_HASH = HashingUtils::HashString("SOFTWARE_TOKEN_MFA");
-        static const int SELECT_MFA_TYPE_HASH = HashingUtils::HashString("SELECT_MFA_TYPE");
-        static const int MFA_SETUP_HASH = HashingUtils::HashString("MFA_SETUP");
-        static const int PASSWORD_VERIFIER_HASH = HashingUtils::HashString("PASSWORD_VERIFIER");
-        static const int CUSTOM_CHALLENGE_HASH = HashingUtils::HashString("CUSTOM_CHALLENGE");
-        static const int DEVICE_SRP_AUTH_HASH = HashingUtils::HashString("DEVICE_SRP_AUTH");
-        static const int DEVICE_PASSWORD_VERIFIER_HASH = HashingUtils::HashString("DEVICE_PASSWORD_VERIFIER");
-        static const int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::HashString("ADMIN_NO_SRP_AUTH");
-        static const int NEW_PASSWORD_REQUIRED_HASH = HashingUtils::HashString("NEW_PASSWORD_REQUIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SMS_MFA",
+          "SOFTWARE_TOKEN_MFA",
+          "SELECT_MFA_TYPE",
+          "MFA_SETUP",
+          "PASSWORD_VERIFIER",
+          "CUSTOM_CHALLENGE",
+          "DEVICE_SRP_AUTH",
+          "DEVICE_PASSWORD_VERIFIER",
+          "ADMIN_NO_SRP_AUTH",
+          "NEW_PASSWORD_REQUIRED",
+        };
 
         ChallengeNameType GetChallengeNameTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SMS_MFA_HASH)
-          {
-            return ChallengeNameType::SMS_MFA;
-          }
-          else if (hashCode == SOFTWARE_TOKEN_MFA_HASH)
-          {
-            return ChallengeNameType::SOFTWARE_TOKEN_MFA;
-          }
-          else if (hashCode == SELECT_MFA_TYPE_HASH)
-          {
-            return ChallengeNameType::SELECT_MFA_TYPE;
-          }
-          else if (hashCode == MFA_SETUP_HASH)
-          {
-            return ChallengeNameType::MFA_SETUP;
-          }
-          else if (hashCode == PASSWORD_VERIFIER_HASH)
-          {
-            return ChallengeNameType::PASSWORD_VERIFIER;
-          }
-          else if (hashCode == CUSTOM_CHALLENGE_HASH)
-          {
-            return ChallengeNameType::CUSTOM_CHALLENGE;
-          }
-          else if (hashCode == DEVICE_SRP_AUTH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChallengeNameType::DEVICE_SRP_AUTH;
-          }
-          else if (hashCode == DEVICE_PASSWORD_VERIFIER_HASH)
-          {
-            return ChallengeNameType::DEVICE_PASSWORD_VERIFIER;
-          }
-          else if (hashCode == ADMIN_NO_SRP_AUTH_HASH)
-          {
-            return ChallengeNameType::ADMIN_NO_SRP_AUTH;
-          }
-          else if (hashCode == NEW_PASSWORD_REQUIRED_HASH)
-          {
-            return ChallengeNameType::NEW_PASSWORD_REQUIRED;
+          case -1362602558:
+            if (name == "SMS_MFA")
+            {
+              return ChallengeNameType::SMS_MFA;
+            }
+            break;
+          case 161754570:
+            if (name == "SOFTWARE_TOKEN_MFA")
+            {
+              return ChallengeNameType::SOFTWARE_TOKEN_MFA;
+            }
+            break;
+          case 872896308:
+            if (name == "SELECT_MFA_TYPE")
+            {
+              return ChallengeNameType::SELECT_MFA_TYPE;
+            }
+            break;
+          case 359356710:
+            if (name == "MFA_SETUP")
+            {
+              return ChallengeNameType::MFA_SETUP;
+            }
+            break;
+          case -1737337862:
+            if (name == "PASSWORD_VERIFIER")
+            {
+              return ChallengeNameType::PASSWORD_VERIFIER;
+            }
+            break;
+          case 645737717:
+            if (name == "CUSTOM_CHALLENGE")
+            {
+              return ChallengeNameType::CUSTOM_CHALLENGE;
+            }
+            break;
+          case 325396255:
+            if (name == "DEVICE_SRP_AUTH")
+            {
+              return ChallengeNameType::DEVICE_SRP_AUTH;
+            }
+            break;
+          case 1362077265:
+            if (name == "DEVICE_PASSWORD_VERIFIER")
+            {
+              return ChallengeNameType::DEVICE_PASSWORD_VERIFIER;
+            }
+            break;
+          case 1330737924:
+            if (name == "ADMIN_NO_SRP_AUTH")
+            {
+              return ChallengeNameType::ADMIN_NO_SRP_AUTH;
+            }
+            break;
+          case 338106308:
+            if (name == "NEW_PASSWORD_REQUIRED")
+            {
+              return ChallengeNameType::NEW_PASSWORD_REQUIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return ChallengeNameType::NOT_SET;
         }
 
-        Aws::String GetNameForChallengeNameType(ChallengeNameType enumValue)
+        const char* GetNameForChallengeNameTypeCStr(ChallengeNameType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChallengeNameType::SMS_MFA:
-            return "SMS_MFA";
-          case ChallengeNameType::SOFTWARE_TOKEN_MFA:
-            return "SOFTWARE_TOKEN_MFA";
-          case ChallengeNameType::SELECT_MFA_TYPE:
-            return "SELECT_MFA_TYPE";
-          case ChallengeNameType::MFA_SETUP:
-            return "MFA_SETUP";
-          case ChallengeNameType::PASSWORD_VERIFIER:
-            return "PASSWORD_VERIFIER";
-          case ChallengeNameType::CUSTOM_CHALLENGE:
-            return "CUSTOM_CHALLENGE";
-          case ChallengeNameType::DEVICE_SRP_AUTH:
-            return "DEVICE_SRP_AUTH";
-          case ChallengeNameType::DEVICE_PASSWORD_VERIFIER:
-            return "DEVICE_PASSWORD_VERIFIER";
-          case ChallengeNameType::ADMIN_NO_SRP_AUTH:
-            return "ADMIN_NO_SRP_AUTH";
-          case ChallengeNameType::NEW_PASSWORD_REQUIRED:
-            return "NEW_PASSWORD_REQUIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChallengeNameType(ChallengeNameType enumValue)
+        {
+          return GetNameForChallengeNameTypeCStr(enumValue);
         }
 
       } // namespace ChallengeNameTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CompromisedCredentialsEventActionTypeMapper
       {
 
-        static const int BLOCK_HASH = HashingUtils::HashString("BLOCK");
-        static const int NO_ACTION_HASH = HashingUtils::HashString("NO_ACTION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLOCK",
+          "NO_ACTION",
+        };
 
         CompromisedCredentialsEventActionType GetCompromisedCredentialsEventActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLOCK_HASH)
-          {
-            return CompromisedCredentialsEventActionType::BLOCK;
-          }
-          else if (hashCode == NO_ACTION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CompromisedCredentialsEventActionType::NO_ACTION;
+          case 63294573:
+            if (name == "BLOCK")
+            {
+              return CompromisedCredentialsEventActionType::BLOCK;
+            }
+            break;
+          case 1334385268:
+            if (name == "NO_ACTION")
+            {
+              return CompromisedCredentialsEventActionType::NO_ACTION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CompromisedCredentialsEventActionType::NOT_SET;
         }
 
-        Aws::String GetNameForCompromisedCredentialsEventActionType(CompromisedCredentialsEventActionType enumValue)
+        const char* GetNameForCompromisedCredentialsEventActionTypeCStr(CompromisedCredentialsEventActionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CompromisedCredentialsEventActionType::BLOCK:
-            return "BLOCK";
-          case CompromisedCredentialsEventActionType::NO_ACTION:
-            return "NO_ACTION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCompromisedCredentialsEventActionType(CompromisedCredentialsEventActionType enumValue)
+        {
+          return GetNameForCompromisedCredentialsEventActionTypeCStr(enumValue);
         }
 
       } // namespace CompromisedCredentialsEventActionTypeMapper
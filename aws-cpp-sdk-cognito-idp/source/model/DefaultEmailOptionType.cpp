@@ -30,20 +30,37 @@ namespace Aws
       namespace DefaultEmailOptionTypeMapper
       {
 
-        static const int CONFIRM_WITH_LINK_HASH = HashingUtils::HashString("CONFIRM_WITH_LINK");
-        static const int CONFIRM_WITH_CODE_HASH = HashingUtils::HashString("CONFIRM_WITH_CODE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONFIRM_WITH_LINK",
+          "CONFIRM_WITH_CODE",
+        };
 
         DefaultEmailOptionType GetDefaultEmailOptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONFIRM_WITH_LINK_HASH)
-          {
-            return DefaultEmailOptionType::CONFIRM_WITH_LINK;
-          }
-          else if (hashCode == CONFIRM_WITH_CODE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DefaultEmailOptionType::CONFIRM_WITH_CODE;
+          case -1534793484:
+            if (name == "CONFIRM_WITH_LINK")
+            {
+              return DefaultEmailOptionType::CONFIRM_WITH_LINK;
+            }
+            break;
+          case -1535056153:
+            if (name == "CONFIRM_WITH_CODE")
+            {
+              return DefaultEmailOptionType::CONFIRM_WITH_CODE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DefaultEmailOptionType::NOT_SET;
         }
 
-        Aws::String GetNameForDefaultEmailOptionType(DefaultEmailOptionType enumValue)
+        const char* GetNameForDefaultEmailOptionTypeCStr(DefaultEmailOptionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DefaultEmailOptionType::CONFIRM_WITH_LINK:
-            return "CONFIRM_WITH_LINK";
-          case DefaultEmailOptionType::CONFIRM_WITH_CODE:
-            return "CONFIRM_WITH_CODE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDefaultEmailOptionType(DefaultEmailOptionType enumValue)
+        {
+          return GetNameForDefaultEmailOptionTypeCStr(enumValue);
         }
 
       } // namespace DefaultEmailOptionTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DeliveryMediumTypeMapper
       {
 
-        static const int SMS_HASH = HashingUtils::HashString("SMS");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SMS",
+          "EMAIL",
+        };
 
         DeliveryMediumType GetDeliveryMediumTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SMS_HASH)
-          {
-            return DeliveryMediumType::SMS;
-          }
-          else if (hashCode == EMAIL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeliveryMediumType::EMAIL;
+          case 82233:
+            if (name == "SMS")
+            {
+              return DeliveryMediumType::SMS;
+            }
+            break;
+          case 66081660:
+            if (name == "EMAIL")
+            {
+              return DeliveryMediumType::EMAIL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeliveryMediumType::NOT_SET;
         }
 
-        Aws::String GetNameForDeliveryMediumType(DeliveryMediumType enumValue)
+        const char* GetNameForDeliveryMediumTypeCStr(DeliveryMediumType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeliveryMediumType::SMS:
-            return "SMS";
-          case DeliveryMediumType::EMAIL:
-            return "EMAIL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeliveryMediumType(DeliveryMediumType enumValue)
+        {
+          return GetNameForDeliveryMediumTypeCStr(enumValue);
         }
 
       } // namespace DeliveryMediumTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DeviceRememberedStatusTypeMapper
       {
 
-        static const int remembered_HASH = HashingUtils::HashString("remembered");
-        static const int not_remembered_HASH = HashingUtils::HashString("not_remembered");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "remembered",
+          "not_remembered",
+        };
 
         DeviceRememberedStatusType GetDeviceRememberedStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == remembered_HASH)
-          {
-            return DeviceRememberedStatusType::remembered;
-          }
-          else if (hashCode == not_remembered_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeviceRememberedStatusType::not_remembered;
+          case 553550828:
+            if (name == "remembered")
+            {
+              return DeviceRememberedStatusType::remembered;
+            }
+            break;
+          case 1450720472:
+            if (name == "not_remembered")
+            {
+              return DeviceRememberedStatusType::not_remembered;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeviceRememberedStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceRememberedStatusType(DeviceRememberedStatusType enumValue)
+        const char* GetNameForDeviceRememberedStatusTypeCStr(DeviceRememberedStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeviceRememberedStatusType::remembered:
-            return "remembered";
-          case DeviceRememberedStatusType::not_remembered:
-            return "not_remembered";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeviceRememberedStatusType(DeviceRememberedStatusType enumValue)
+        {
+          return GetNameForDeviceRememberedStatusTypeCStr(enumValue);
         }
 
       } // namespace DeviceRememberedStatusTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace DomainStatusTypeMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "DELETING",
+          "UPDATING",
+          "ACTIVE",
+          "FAILED",
+        };
 
         DomainStatusType GetDomainStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DomainStatusType::CREATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return DomainStatusType::DELETING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return DomainStatusType::UPDATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return DomainStatusType::ACTIVE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return DomainStatusType::FAILED;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return DomainStatusType::CREATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return DomainStatusType::DELETING;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return DomainStatusType::UPDATING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return DomainStatusType::ACTIVE;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return DomainStatusType::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return DomainStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForDomainStatusType(DomainStatusType enumValue)
+        const char* GetNameForDomainStatusTypeCStr(DomainStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DomainStatusType::CREATING:
-            return "CREATING";
-          case DomainStatusType::DELETING:
-            return "DELETING";
-          case DomainStatusType::UPDATING:
-            return "UPDATING";
-          case DomainStatusType::ACTIVE:
-            return "ACTIVE";
-          case DomainStatusType::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDomainStatusType(DomainStatusType enumValue)
+        {
+          return GetNameForDomainStatusTypeCStr(enumValue);
         }
 
       } // namespace DomainStatusTypeMapper
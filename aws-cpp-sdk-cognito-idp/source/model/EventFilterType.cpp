@@ -30,25 +30,44 @@ namespace Aws
       namespace EventFilterTypeMapper
       {
 
-        static const int SIGN_IN_HASH = HashingUtils::HashString("SIGN_IN");
-        static const int PASSWORD_CHANGE_HASH = HashingUtils::HashString("PASSWORD_CHANGE");
-        static const int SIGN_UP_HASH = HashingUtils::HashString("SIGN_UP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SIGN_IN",
+          "PASSWORD_CHANGE",
+          "SIGN_UP",
+        };
 
         EventFilterType GetEventFilterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIGN_IN_HASH)
-          {
-            return EventFilterType::SIGN_IN;
-          }
-          else if (hashCode == PASSWORD_CHANGE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventFilterType::PASSWORD_CHANGE;
-          }
-          else if (hashCode == SIGN_UP_HASH)
-          {
-            return EventFilterType::SIGN_UP;
+          case -1488690457:
+            if (name == "SIGN_IN")
+            {
+              return EventFilterType::SIGN_IN;
+            }
+            break;
+          case 1793934804:
+            if (name == "PASSWORD_CHANGE")
+            {
+              return EventFilterType::PASSWORD_CHANGE;
+            }
+            break;
+          case -1488690083:
+            if (name == "SIGN_UP")
+            {
+              return EventFilterType::SIGN_UP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EventFilterType::NOT_SET;
         }
 
-        Aws::String GetNameForEventFilterType(EventFilterType enumValue)
+        const char* GetNameForEventFilterTypeCStr(EventFilterType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventFilterType::SIGN_IN:
-            return "SIGN_IN";
-          case EventFilterType::PASSWORD_CHANGE:
-            return "PASSWORD_CHANGE";
-          case EventFilterType::SIGN_UP:
-            return "SIGN_UP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventFilterType(EventFilterType enumValue)
+        {
+          return GetNameForEventFilterTypeCStr(enumValue);
         }
 
       } // namespace EventFilterTypeMapper
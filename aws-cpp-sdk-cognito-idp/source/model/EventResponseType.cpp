@@ -30,20 +30,37 @@ namespace Aws
       namespace EventResponseTypeMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failure_HASH = HashingUtils::HashString("Failure");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Success",
+          "Failure",
+        };
 
         EventResponseType GetEventResponseTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
-          {
-            return EventResponseType::Success;
-          }
-          else if (hashCode == Failure_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventResponseType::Failure;
+          case -202516509:
+            if (name == "Success")
+            {
+              return EventResponseType::Success;
+            }
+            break;
+          case 578079082:
+            if (name == "Failure")
+            {
+              return EventResponseType::Failure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EventResponseType::NOT_SET;
         }
 
-        Aws::String GetNameForEventResponseType(EventResponseType enumValue)
+        const char* GetNameForEventResponseTypeCStr(EventResponseType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventResponseType::Success:
-            return "Success";
-          case EventResponseType::Failure:
-            return "Failure";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventResponseType(EventResponseType enumValue)
+        {
+          return GetNameForEventResponseTypeCStr(enumValue);
         }
 
       } // namespace EventResponseTypeMapper
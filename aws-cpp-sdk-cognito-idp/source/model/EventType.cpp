@@ -30,25 +30,44 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int SignIn_HASH = HashingUtils::HashString("SignIn");
-        static const int SignUp_HASH = HashingUtils::HashString("SignUp");
-        static const int ForgotPassword_HASH = HashingUtils::HashString("ForgotPassword");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SignIn",
+          "SignUp",
+          "ForgotPassword",
+        };
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SignIn_HASH)
-          {
-            return EventType::SignIn;
-          }
-          else if (hashCode == SignUp_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventType::SignUp;
-          }
-          else if (hashCode == ForgotPassword_HASH)
-          {
-            return EventType::ForgotPassword;
+          case -1818601502:
+            if (name == "SignIn")
+            {
+              return EventType::SignIn;
+            }
+            break;
+          case -1818601128:
+            if (name == "SignUp")
+            {
+              return EventType::SignUp;
+            }
+            break;
+          case -372049154:
+            if (name == "ForgotPassword")
+            {
+              return EventType::ForgotPassword;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventTypeCStr(EventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventType::SignIn:
-            return "SignIn";
-          case EventType::SignUp:
-            return "SignUp";
-          case EventType::ForgotPassword:
-            return "ForgotPassword";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventType(EventType enumValue)
+        {
+          return GetNameForEventTypeCStr(enumValue);
         }
 
       } // namespace EventTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ExplicitAuthFlowsTypeMapper
       {
 
-        static const int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::HashString("ADMIN_NO_SRP_AUTH");
-        static const int CUSTOM_AUTH_FLOW_ONLY_HASH = HashingUtils::HashString("CUSTOM_AUTH_FLOW_ONLY");
-        static const int USER_PASSWORD_AUTH_HASH = HashingUtils::HashString("USER_PASSWORD_AUTH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADMIN_NO_SRP_AUTH",
+          "CUSTOM_AUTH_FLOW_ONLY",
+          "USER_PASSWORD_AUTH",
+        };
 
         ExplicitAuthFlowsType GetExplicitAuthFlowsTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADMIN_NO_SRP_AUTH_HASH)
-          {
-            return ExplicitAuthFlowsType::ADMIN_NO_SRP_AUTH;
-          }
-          else if (hashCode == CUSTOM_AUTH_FLOW_ONLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExplicitAuthFlowsType::CUSTOM_AUTH_FLOW_ONLY;
-          }
-          else if (hashCode == USER_PASSWORD_AUTH_HASH)
-          {
-            return ExplicitAuthFlowsType::USER_PASSWORD_AUTH;
+          case 1330737924:
+            if (name == "ADMIN_NO_SRP_AUTH")
+            {
+              return ExplicitAuthFlowsType::ADMIN_NO_SRP_AUTH;
+            }
+            break;
+          case 1605910740:
+            if (name == "CUSTOM_AUTH_FLOW_ONLY")
+            {
+              return ExplicitAuthFlowsType::CUSTOM_AUTH_FLOW_ONLY;
+            }
+            break;
+          case -1521679528:
+            if (name == "USER_PASSWORD_AUTH")
+            {
+              return ExplicitAuthFlowsType::USER_PASSWORD_AUTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ExplicitAuthFlowsType::NOT_SET;
         }
 
-        Aws::String GetNameForExplicitAuthFlowsType(ExplicitAuthFlowsType enumValue)
+        const char* GetNameForExplicitAuthFlowsTypeCStr(ExplicitAuthFlowsType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExplicitAuthFlowsType::ADMIN_NO_SRP_AUTH:
-            return "ADMIN_NO_SRP_AUTH";
-          case ExplicitAuthFlowsType::CUSTOM_AUTH_FLOW_ONLY:
-            return "CUSTOM_AUTH_FLOW_ONLY";
-          case ExplicitAuthFlowsType::USER_PASSWORD_AUTH:
-            return "USER_PASSWORD_AUTH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExplicitAuthFlowsType(ExplicitAuthFlowsType enumValue)
+        {
+          return GetNameForExplicitAuthFlowsTypeCStr(enumValue);
         }
 
       } // namespace ExplicitAuthFlowsTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FeedbackValueTypeMapper
       {
 
-        static const int Valid_HASH = HashingUtils::HashString("Valid");
-        static const int Invalid_HASH = HashingUtils::HashString("Invalid");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Valid",
+          "Invalid",
+        };
 
         FeedbackValueType GetFeedbackValueTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Valid_HASH)
-          {
-            return FeedbackValueType::Valid;
-          }
-          else if (hashCode == Invalid_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FeedbackValueType::Invalid;
+          case 82419676:
+            if (name == "Valid")
+            {
+              return FeedbackValueType::Valid;
+            }
+            break;
+          case -670529065:
+            if (name == "Invalid")
+            {
+              return FeedbackValueType::Invalid;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FeedbackValueType::NOT_SET;
         }
 
-        Aws::String GetNameForFeedbackValueType(FeedbackValueType enumValue)
+        const char* GetNameForFeedbackValueTypeCStr(FeedbackValueType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FeedbackValueType::Valid:
-            return "Valid";
-          case FeedbackValueType::Invalid:
-            return "Invalid";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFeedbackValueType(FeedbackValueType enumValue)
+        {
+          return GetNameForFeedbackValueTypeCStr(enumValue);
         }
 
       } // namespace FeedbackValueTypeMapper
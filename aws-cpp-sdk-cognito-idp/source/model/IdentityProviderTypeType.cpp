@@ -30,35 +30,58 @@ namespace Aws
       namespace IdentityProviderTypeTypeMapper
       {
 
-        static const int SAML_HASH = HashingUtils::HashString("SAML");
-        static const int Facebook_HASH = HashingUtils::HashString("Facebook");
-        static const int Google_HASH = HashingUtils::HashString("Google");
-        static const int LoginWithAmazon_HASH = HashingUtils::HashString("LoginWithAmazon");
-        static const int OIDC_HASH = HashingUtils::HashString("OIDC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SAML",
+          "Facebook",
+          "Google",
+          "LoginWithAmazon",
+          "OIDC",
+        };
 
         IdentityProviderTypeType GetIdentityProviderTypeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SAML_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IdentityProviderTypeType::SAML;
-          }
-          else if (hashCode == Facebook_HASH)
-          {
-            return IdentityProviderTypeType::Facebook;
-          }
-          else if (hashCode == Google_HASH)
-          {
-            return IdentityProviderTypeType::Google;
-          }
-          else if (hashCode == LoginWithAmazon_HASH)
-          {
-            return IdentityProviderTypeType::LoginWithAmazon;
-          }
-          else if (hashCode == OIDC_HASH)
-          {
-            return IdentityProviderTypeType::OIDC;
+          case 2537581:
+            if (name == "SAML")
+            {
+              return IdentityProviderTypeType::SAML;
+            }
+            break;
+          case 561774310:
+            if (name == "Facebook")
+            {
+              return IdentityProviderTypeType::Facebook;
+            }
+            break;
+          case 2138589785:
+            if (name == "Google")
+            {
+              return IdentityProviderTypeType::Google;
+            }
+            break;
+          case -1898476909:
+            if (name == "LoginWithAmazon")
+            {
+              return IdentityProviderTypeType::LoginWithAmazon;
+            }
+            break;
+          case 2425817:
+            if (name == "OIDC")
+            {
+              return IdentityProviderTypeType::OIDC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return IdentityProviderTypeType::NOT_SET;
         }
 
-        Aws::String GetNameForIdentityProviderTypeType(IdentityProviderTypeType enumValue)
+        const char* GetNameForIdentityProviderTypeTypeCStr(IdentityProviderTypeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IdentityProviderTypeType::SAML:
-            return "SAML";
-          case IdentityProviderTypeType::Facebook:
-            return "Facebook";
-          case IdentityProviderTypeType::Google:
-            return "Google";
-          case IdentityProviderTypeType::LoginWithAmazon:
-            return "LoginWithAmazon";
-          case IdentityProviderTypeType::OIDC:
-            return "OIDC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIdentityProviderTypeType(IdentityProviderTypeType enumValue)
+        {
+          return GetNameForIdentityProviderTypeTypeCStr(enumValue);
         }
 
       } // namespace IdentityProviderTypeTypeMapper
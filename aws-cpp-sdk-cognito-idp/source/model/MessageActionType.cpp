@@ -30,20 +30,37 @@ namespace Aws
       namespace MessageActionTypeMapper
       {
 
-        static const int RESEND_HASH = HashingUtils::HashString("RESEND");
-        static const int SUPPRESS_HASH = HashingUtils::HashString("SUPPRESS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RESEND",
+          "SUPPRESS",
+        };
 
         MessageActionType GetMessageActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RESEND_HASH)
-          {
-            return MessageActionType::RESEND;
-          }
-          else if (hashCode == SUPPRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MessageActionType::SUPPRESS;
+          case -1881112517:
+            if (name == "RESEND")
+            {
+              return MessageActionType::RESEND;
+            }
+            break;
+          case -880503115:
+            if (name == "SUPPRESS")
+            {
+              return MessageActionType::SUPPRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MessageActionType::NOT_SET;
         }
 
-        Aws::String GetNameForMessageActionType(MessageActionType enumValue)
+        const char* GetNameForMessageActionTypeCStr(MessageActionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MessageActionType::RESEND:
-            return "RESEND";
-          case MessageActionType::SUPPRESS:
-            return "SUPPRESS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMessageActionType(MessageActionType enumValue)
+        {
+          return GetNameForMessageActionTypeCStr(enumValue);
         }
 
       } // namespace MessageActionTypeMapper
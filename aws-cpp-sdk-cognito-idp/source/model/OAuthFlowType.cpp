@@ -30,25 +30,44 @@ namespace Aws
       namespace OAuthFlowTypeMapper
       {
 
-        static const int code_HASH = HashingUtils::HashString("code");
-        static const int implicit_HASH = HashingUtils::HashString("implicit");
-        static const int client_credentials_HASH = HashingUtils::HashString("client_credentials");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "code",
+          "implicit",
+          "client_credentials",
+        };
 
         OAuthFlowType GetOAuthFlowTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == code_HASH)
-          {
-            return OAuthFlowType::code;
-          }
-          else if (hashCode == implicit_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OAuthFlowType::implicit;
-          }
-          else if (hashCode == client_credentials_HASH)
-          {
-            return OAuthFlowType::client_credentials;
+          case 3059181:
+            if (name == "code")
+            {
+              return OAuthFlowType::code;
+            }
+            break;
+          case -425423387:
+            if (name == "implicit")
+            {
+              return OAuthFlowType::implicit;
+            }
+            break;
+          case 290069640:
+            if (name == "client_credentials")
+            {
+              return OAuthFlowType::client_credentials;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return OAuthFlowType::NOT_SET;
         }
 
-        Aws::String GetNameForOAuthFlowType(OAuthFlowType enumValue)
+        const char* GetNameForOAuthFlowTypeCStr(OAuthFlowType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OAuthFlowType::code:
-            return "code";
-          case OAuthFlowType::implicit:
-            return "implicit";
-          case OAuthFlowType::client_credentials:
-            return "client_credentials";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOAuthFlowType(OAuthFlowType enumValue)
+        {
+          return GetNameForOAuthFlowTypeCStr(enumValue);
         }
 
       } // namespace OAuthFlowTypeMapper
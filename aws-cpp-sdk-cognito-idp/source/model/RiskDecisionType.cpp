@@ -30,25 +30,44 @@ namespace Aws
       namespace RiskDecisionTypeMapper
       {
 
-        static const int NoRisk_HASH = HashingUtils::HashString("NoRisk");
-        static const int AccountTakeover_HASH = HashingUtils::HashString("AccountTakeover");
-        static const int Block_HASH = HashingUtils::HashString("Block");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NoRisk",
+          "AccountTakeover",
+          "Block",
+        };
 
         RiskDecisionType GetRiskDecisionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoRisk_HASH)
-          {
-            return RiskDecisionType::NoRisk;
-          }
-          else if (hashCode == AccountTakeover_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RiskDecisionType::AccountTakeover;
-          }
-          else if (hashCode == Block_HASH)
-          {
-            return RiskDecisionType::Block;
+          case -1956835248:
+            if (name == "NoRisk")
+            {
+              return RiskDecisionType::NoRisk;
+            }
+            break;
+          case -860029176:
+            if (name == "AccountTakeover")
+            {
+              return RiskDecisionType::AccountTakeover;
+            }
+            break;
+          case 64279661:
+            if (name == "Block")
+            {
+              return RiskDecisionType::Block;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RiskDecisionType::NOT_SET;
         }
 
-        Aws::String GetNameForRiskDecisionType(RiskDecisionType enumValue)
+        const char* GetNameForRiskDecisionTypeCStr(RiskDecisionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RiskDecisionType::NoRisk:
-            return "NoRisk";
-          case RiskDecisionType::AccountTakeover:
-            return "AccountTakeover";
-          case RiskDecisionType::Block:
-            return "Block";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRiskDecisionType(RiskDecisionType enumValue)
+        {
+          return GetNameForRiskDecisionTypeCStr(enumValue);
         }
 
       } // namespace RiskDecisionTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace RiskLevelTypeMapper
       {
 
-        static const int Low_HASH = HashingUtils::HashString("Low");
-        static const int Medium_HASH = HashingUtils::HashString("Medium");
-        static const int High_HASH = HashingUtils::HashString("High");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Low",
+          "Medium",
+          "High",
+        };
 
         RiskLevelType GetRiskLevelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Low_HASH)
-          {
-            return RiskLevelType::Low;
-          }
-          else if (hashCode == Medium_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RiskLevelType::Medium;
-          }
-          else if (hashCode == High_HASH)
-          {
-            return RiskLevelType::High;
+          case 76596:
+            if (name == "Low")
+            {
+              return RiskLevelType::Low;
+            }
+            break;
+          case -1994163307:
+            if (name == "Medium")
+            {
+              return RiskLevelType::Medium;
+            }
+            break;
+          case 2249154:
+            if (name == "High")
+            {
+              return RiskLevelType::High;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RiskLevelType::NOT_SET;
         }
 
-        Aws::String GetNameForRiskLevelType(RiskLevelType enumValue)
+        const char* GetNameForRiskLevelTypeCStr(RiskLevelType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RiskLevelType::Low:
-            return "Low";
-          case RiskLevelType::Medium:
-            return "Medium";
-          case RiskLevelType::High:
-            return "High";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRiskLevelType(RiskLevelType enumValue)
+        {
+          return GetNameForRiskLevelTypeCStr(enumValue);
         }
 
       } // namespace RiskLevelTypeMapper
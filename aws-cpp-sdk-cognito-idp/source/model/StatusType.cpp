@@ -30,20 +30,37 @@ namespace Aws
       namespace StatusTypeMapper
       {
 
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-        static const int Disabled_HASH = HashingUtils::HashString("Disabled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Enabled",
+          "Disabled",
+        };
 
         StatusType GetStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enabled_HASH)
-          {
-            return StatusType::Enabled;
-          }
-          else if (hashCode == Disabled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StatusType::Disabled;
+          case 55059233:
+            if (name == "Enabled")
+            {
+              return StatusType::Enabled;
+            }
+            break;
+          case 335584924:
+            if (name == "Disabled")
+            {
+              return StatusType::Disabled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return StatusType::NOT_SET;
         }
 
-        Aws::String GetNameForStatusType(StatusType enumValue)
+        const char* GetNameForStatusTypeCStr(StatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StatusType::Enabled:
-            return "Enabled";
-          case StatusType::Disabled:
-            return "Disabled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatusType(StatusType enumValue)
+        {
+          return GetNameForStatusTypeCStr(enumValue);
         }
 
       } // namespace StatusTypeMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace UserImportJobStatusTypeMapper
       {
 
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
-        static const int Expired_HASH = HashingUtils::HashString("Expired");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Created",
+          "Pending",
+          "InProgress",
+          "Stopping",
+          "Expired",
+          "Stopped",
+          "Failed",
+          "Succeeded",
+        };
 
         UserImportJobStatusType GetUserImportJobStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Created_HASH)
-          {
-            return UserImportJobStatusType::Created;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return UserImportJobStatusType::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return UserImportJobStatusType::InProgress;
-          }
-          else if (hashCode == Stopping_HASH)
-          {
-            return UserImportJobStatusType::Stopping;
-          }
-          else if (hashCode == Expired_HASH)
-          {
-            return UserImportJobStatusType::Expired;
-          }
-          else if (hashCode == Stopped_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UserImportJobStatusType::Stopped;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return UserImportJobStatusType::Failed;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return UserImportJobStatusType::Succeeded;
+          case -1601759544:
+            if (name == "Created")
+            {
+              return UserImportJobStatusType::Created;
+            }
+            break;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return UserImportJobStatusType::Pending;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return UserImportJobStatusType::InProgress;
+            }
+            break;
+          case 1780292756:
+            if (name == "Stopping")
+            {
+              return UserImportJobStatusType::Stopping;
+            }
+            break;
+          case 355417861:
+            if (name == "Expired")
+            {
+              return UserImportJobStatusType::Expired;
+            }
+            break;
+          case -219666003:
+            if (name == "Stopped")
+            {
+              return UserImportJobStatusType::Stopped;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return UserImportJobStatusType::Failed;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return UserImportJobStatusType::Succeeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return UserImportJobStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForUserImportJobStatusType(UserImportJobStatusType enumValue)
+        const char* GetNameForUserImportJobStatusTypeCStr(UserImportJobStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UserImportJobStatusType::Created:
-            return "Created";
-          case UserImportJobStatusType::Pending:
-            return "Pending";
-          case UserImportJobStatusType::InProgress:
-            return "InProgress";
-          case UserImportJobStatusType::Stopping:
-            return "Stopping";
-          case UserImportJobStatusType::Expired:
-            return "Expired";
-          case UserImportJobStatusType::Stopped:
-            return "Stopped";
-          case UserImportJobStatusType::Failed:
-            return "Failed";
-          case UserImportJobStatusType::Succeeded:
-            return "Succeeded";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUserImportJobStatusType(UserImportJobStatusType enumValue)
+        {
+          return GetNameForUserImportJobStatusTypeCStr(enumValue);
         }
 
       } // namespace UserImportJobStatusTypeMapper
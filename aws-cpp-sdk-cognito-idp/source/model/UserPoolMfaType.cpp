@@ -30,25 +30,44 @@ namespace Aws
       namespace UserPoolMfaTypeMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int ON_HASH = HashingUtils::HashString("ON");
-        static const int OPTIONAL_HASH = HashingUtils::HashString("OPTIONAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OFF",
+          "ON",
+          "OPTIONAL",
+        };
 
         UserPoolMfaType GetUserPoolMfaTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
-          {
-            return UserPoolMfaType::OFF;
-          }
-          else if (hashCode == ON_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UserPoolMfaType::ON;
-          }
-          else if (hashCode == OPTIONAL_HASH)
-          {
-            return UserPoolMfaType::OPTIONAL;
+          case 78159:
+            if (name == "OFF")
+            {
+              return UserPoolMfaType::OFF;
+            }
+            break;
+          case 2527:
+            if (name == "ON")
+            {
+              return UserPoolMfaType::ON;
+            }
+            break;
+          case 703609696:
+            if (name == "OPTIONAL")
+            {
+              return UserPoolMfaType::OPTIONAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return UserPoolMfaType::NOT_SET;
         }
 
-        Aws::String GetNameForUserPoolMfaType(UserPoolMfaType enumValue)
+        const char* GetNameForUserPoolMfaTypeCStr(UserPoolMfaType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UserPoolMfaType::OFF:
-            return "OFF";
-          case UserPoolMfaType::ON:
-            return "ON";
-          case UserPoolMfaType::OPTIONAL:
-            return "OPTIONAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUserPoolMfaType(UserPoolMfaType enumValue)
+        {
+          return GetNameForUserPoolMfaTypeCStr(enumValue);
         }
 
       } // namespace UserPoolMfaTypeMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace UserStatusTypeMapper
       {
 
-        static const int UNCONFIRMED_HASH = HashingUtils::HashString("UNCONFIRMED");
-        static const int CONFIRMED_HASH = HashingUtils::HashString("CONFIRMED");
-        static const int ARCHIVED_HASH = HashingUtils::HashString("ARCHIVED");
-        static const int COMPROMISED_HASH = HashingUtils::HashString("COMPROMISED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-        static const int RESET_REQUIRED_HASH = HashingUtils::HashString("RESET_REQUIRED");
-        static const int FORCE_CHANGE_PASSWORD_HASH = HashingUtils::HashString("FORCE_CHANGE_PASSWORD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNCONFIRMED",
+          "CONFIRMED",
+          "ARCHIVED",
+          "COMPROMISED",
+          "UNKNOWN",
+          "RESET_REQUIRED",
+          "FORCE_CHANGE_PASSWORD",
+        };
 
         UserStatusType GetUserStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNCONFIRMED_HASH)
-          {
-            return UserStatusType::UNCONFIRMED;
-          }
-          else if (hashCode == CONFIRMED_HASH)
-          {
-            return UserStatusType::CONFIRMED;
-          }
-          else if (hashCode == ARCHIVED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UserStatusType::ARCHIVED;
-          }
-          else if (hashCode == COMPROMISED_HASH)
-          {
-            return UserStatusType::COMPROMISED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return UserStatusType::UNKNOWN;
-          }
-          else if (hashCode == RESET_REQUIRED_HASH)
-          {
-            return UserStatusType::RESET_REQUIRED;
-          }
-          else if (hashCode == FORCE_CHANGE_PASSWORD_HASH)
-          {
-            return UserStatusType::FORCE_CHANGE_PASSWORD;
+          case 1417290950:
+            if (name == "UNCONFIRMED")
+            {
+              return UserStatusType::UNCONFIRMED;
+            }
+            break;
+          case 1982485311:
+            if (name == "CONFIRMED")
+            {
+              return UserStatusType::CONFIRMED;
+            }
+            break;
+          case -933681182:
+            if (name == "ARCHIVED")
+            {
+              return UserStatusType::ARCHIVED;
+            }
+            break;
+          case -429560054:
+            if (name == "COMPROMISED")
+            {
+              return UserStatusType::COMPROMISED;
+            }
+            break;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return UserStatusType::UNKNOWN;
+            }
+            break;
+          case -2024960849:
+            if (name == "RESET_REQUIRED")
+            {
+              return UserStatusType::RESET_REQUIRED;
+            }
+            break;
+          case 1148218582:
+            if (name == "FORCE_CHANGE_PASSWORD")
+            {
+              return UserStatusType::FORCE_CHANGE_PASSWORD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return UserStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForUserStatusType(UserStatusType enumValue)
+        const char* GetNameForUserStatusTypeCStr(UserStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UserStatusType::UNCONFIRMED:
-            return "UNCONFIRMED";
-          case UserStatusType::CONFIRMED:
-            return "CONFIRMED";
-          case UserStatusType::ARCHIVED:
-            return "ARCHIVED";
-          case UserStatusType::COMPROMISED:
-            return "COMPROMISED";
-          case UserStatusType::UNKNOWN:
-            return "UNKNOWN";
-          case UserStatusType::RESET_REQUIRED:
-            return "RESET_REQUIRED";
-          case UserStatusType::FORCE_CHANGE_PASSWORD:
-            return "FORCE_CHANGE_PASSWORD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUserStatusType(UserStatusType enumValue)
+        {
+          return GetNameForUserStatusTypeCStr(enumValue);
         }
 
       } // namespace UserStatusTypeMapper
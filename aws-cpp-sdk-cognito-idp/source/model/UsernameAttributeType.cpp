@@ -30,20 +30,37 @@ namespace Aws
       namespace UsernameAttributeTypeMapper
       {
 
-        static const int phone_number_HASH = HashingUtils::HashString("phone_number");
-        static const int email_HASH = HashingUtils::HashString("email");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "phone_number",
+          "email",
+        };
 
         UsernameAttributeType GetUsernameAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == phone_number_HASH)
-          {
-            return UsernameAttributeType::phone_number;
-          }
-          else if (hashCode == email_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UsernameAttributeType::email;
+          case -612351174:
+            if (name == "phone_number")
+            {
+              return UsernameAttributeType::phone_number;
+            }
+            break;
+          case 96619420:
+            if (name == "email")
+            {
+              return UsernameAttributeType::email;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return UsernameAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForUsernameAttributeType(UsernameAttributeType enumValue)
+        const char* GetNameForUsernameAttributeTypeCStr(UsernameAttributeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UsernameAttributeType::phone_number:
-            return "phone_number";
-          case UsernameAttributeType::email:
-            return "email";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUsernameAttributeType(UsernameAttributeType enumValue)
+        {
+          return GetNameForUsernameAttributeTypeCStr(enumValue);
         }
 
       } // namespace UsernameAttributeTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace VerifiedAttributeTypeMapper
       {
 
-        static const int phone_number_HASH = HashingUtils::HashString("phone_number");
-        static const int email_HASH = HashingUtils::HashString("email");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "phone_number",
+          "email",
+        };
 
         VerifiedAttributeType GetVerifiedAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == phone_number_HASH)
-          {
-            return VerifiedAttributeType::phone_number;
-          }
-          else if (hashCode == email_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VerifiedAttributeType::email;
+          case -612351174:
+            if (name == "phone_number")
+            {
+              return VerifiedAttributeType::phone_number;
+            }
+            break;
+          case 96619420:
+            if (name == "email")
+            {
+              return VerifiedAttributeType::email;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return VerifiedAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForVerifiedAttributeType(VerifiedAttributeType enumValue)
+        const char* GetNameForVerifiedAttributeTypeCStr(VerifiedAttributeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VerifiedAttributeType::phone_number:
-            return "phone_number";
-          case VerifiedAttributeType::email:
-            return "email";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVerifiedAttributeType(VerifiedAttributeType enumValue)
+        {
+          return GetNameForVerifiedAttributeTypeCStr(enumValue);
         }
 
       } // namespace VerifiedAttributeTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace VerifySoftwareTokenResponseTypeMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCESS",
+          "ERROR",
+        };
 
         VerifySoftwareTokenResponseType GetVerifySoftwareTokenResponseTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
-          {
-            return VerifySoftwareTokenResponseType::SUCCESS;
-          }
-          else if (hashCode == ERROR__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VerifySoftwareTokenResponseType::ERROR_;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return VerifySoftwareTokenResponseType::SUCCESS;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return VerifySoftwareTokenResponseType::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return VerifySoftwareTokenResponseType::NOT_SET;
         }
 
-        Aws::String GetNameForVerifySoftwareTokenResponseType(VerifySoftwareTokenResponseType enumValue)
+        const char* GetNameForVerifySoftwareTokenResponseTypeCStr(VerifySoftwareTokenResponseType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VerifySoftwareTokenResponseType::SUCCESS:
-            return "SUCCESS";
-          case VerifySoftwareTokenResponseType::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVerifySoftwareTokenResponseType(VerifySoftwareTokenResponseType enumValue)
+        {
+          return GetNameForVerifySoftwareTokenResponseTypeCStr(enumValue);
         }
 
       } // namespace VerifySoftwareTokenResponseTypeMapper
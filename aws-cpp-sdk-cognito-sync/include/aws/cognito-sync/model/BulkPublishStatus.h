@@ -37,6 +37,11 @@ namespace BulkPublishStatusMapper
 AWS_COGNITOSYNC_API BulkPublishStatus GetBulkPublishStatusForName(const Aws::String& name);
 
 AWS_COGNITOSYNC_API Aws::String GetNameForBulkPublishStatus(BulkPublishStatus value);
+
+/**
+ * Same as GetNameForBulkPublishStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOSYNC_API const char* GetNameForBulkPublishStatusCStr(BulkPublishStatus value);
 } // namespace BulkPublishStatusMapper
 } // namespace Model
 } // namespace CognitoSync
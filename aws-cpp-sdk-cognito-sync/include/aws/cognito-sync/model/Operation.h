@@ -35,6 +35,11 @@ namespace OperationMapper
 AWS_COGNITOSYNC_API Operation GetOperationForName(const Aws::String& name);
 
 AWS_COGNITOSYNC_API Aws::String GetNameForOperation(Operation value);
+
+/**
+ * Same as GetNameForOperation(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOSYNC_API const char* GetNameForOperationCStr(Operation value);
 } // namespace OperationMapper
 } // namespace Model
 } // namespace CognitoSync
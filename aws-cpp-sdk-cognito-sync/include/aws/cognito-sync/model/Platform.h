@@ -37,6 +37,11 @@ namespace PlatformMapper
 AWS_COGNITOSYNC_API Platform GetPlatformForName(const Aws::String& name);
 
 AWS_COGNITOSYNC_API Aws::String GetNameForPlatform(Platform value);
+
+/**
+ * Same as GetNameForPlatform(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOSYNC_API const char* GetNameForPlatformCStr(Platform value);
 } // namespace PlatformMapper
 } // namespace Model
 } // namespace CognitoSync
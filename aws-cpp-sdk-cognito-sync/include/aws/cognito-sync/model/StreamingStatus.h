@@ -35,6 +35,11 @@ namespace StreamingStatusMapper
 AWS_COGNITOSYNC_API StreamingStatus GetStreamingStatusForName(const Aws::String& name);
 
 AWS_COGNITOSYNC_API Aws::String GetNameForStreamingStatus(StreamingStatus value);
+
+/**
+ * Same as GetNameForStreamingStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COGNITOSYNC_API const char* GetNameForStreamingStatusCStr(StreamingStatus value);
 } // namespace StreamingStatusMapper
 } // namespace Model
 } // namespace CognitoSync
@@ -30,30 +30,51 @@ namespace Aws
       namespace BulkPublishStatusMapper
       {
 
-        static const int NOT_STARTED_HASH = HashingUtils::HashString("NOT_STARTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NOT_STARTED",
+          "IN_PROGRESS",
+          "FAILED",
+          "SUCCEEDED",
+        };
 
         BulkPublishStatus GetBulkPublishStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_STARTED_HASH)
-          {
-            return BulkPublishStatus::NOT_STARTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return BulkPublishStatus::IN_PROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return BulkPublishStatus::FAILED;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BulkPublishStatus::SUCCEEDED;
+          case -1391247659:
+            if (name == "NOT_STARTED")
+            {
+              return BulkPublishStatus::NOT_STARTED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return BulkPublishStatus::IN_PROGRESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return BulkPublishStatus::FAILED;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return BulkPublishStatus::SUCCEEDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return BulkPublishStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBulkPublishStatus(BulkPublishStatus enumValue)
+        const char* GetNameForBulkPublishStatusCStr(BulkPublishStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BulkPublishStatus::NOT_STARTED:
-            return "NOT_STARTED";
-          case BulkPublishStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case BulkPublishStatus::FAILED:
-            return "FAILED";
-          case BulkPublishStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBulkPublishStatus(BulkPublishStatus enumValue)
+        {
+          return GetNameForBulkPublishStatusCStr(enumValue);
         }
 
       } // namespace BulkPublishStatusMapper
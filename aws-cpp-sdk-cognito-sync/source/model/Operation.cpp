@@ -30,20 +30,37 @@ namespace Aws
       namespace OperationMapper
       {
 
-        static const int replace_HASH = HashingUtils::HashString("replace");
-        static const int remove_HASH = HashingUtils::HashString("remove");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "replace",
+          "remove",
+        };
 
         Operation GetOperationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == replace_HASH)
-          {
-            return Operation::replace;
-          }
-          else if (hashCode == remove_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Operation::remove;
+          case 1094496948:
+            if (name == "replace")
+            {
+              return Operation::replace;
+            }
+            break;
+          case -934610812:
+            if (name == "remove")
+            {
+              return Operation::remove;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Operation::NOT_SET;
         }
 
-        Aws::String GetNameForOperation(Operation enumValue)
+        const char* GetNameForOperationCStr(Operation enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Operation::replace:
-            return "replace";
-          case Operation::remove:
-            return "remove";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperation(Operation enumValue)
+        {
+          return GetNameForOperationCStr(enumValue);
         }
 
       } // namespace OperationMapper
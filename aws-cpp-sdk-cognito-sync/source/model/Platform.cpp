@@ -30,30 +30,51 @@ namespace Aws
       namespace PlatformMapper
       {
 
-        static const int APNS_HASH = HashingUtils::HashString("APNS");
-        static const int APNS_SANDBOX_HASH = HashingUtils::HashString("APNS_SANDBOX");
-        static const int GCM_HASH = HashingUtils::HashString("GCM");
-        static const int ADM_HASH = HashingUtils::HashString("ADM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "APNS",
+          "APNS_SANDBOX",
+          "GCM",
+          "ADM",
+        };
 
         Platform GetPlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == APNS_HASH)
-          {
-            return Platform::APNS;
-          }
-          else if (hashCode == APNS_SANDBOX_HASH)
-          {
-            return Platform::APNS_SANDBOX;
-          }
-          else if (hashCode == GCM_HASH)
-          {
-            return Platform::GCM;
-          }
-          else if (hashCode == ADM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Platform::ADM;
+          case 2015796:
+            if (name == "APNS")
+            {
+              return Platform::APNS;
+            }
+            break;
+          case 581844892:
+            if (name == "APNS_SANDBOX")
+            {
+              return Platform::APNS_SANDBOX;
+            }
+            break;
+          case 70385:
+            if (name == "GCM")
+            {
+              return Platform::GCM;
+            }
+            break;
+          case 64650:
+            if (name == "ADM")
+            {
+              return Platform::ADM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Platform::NOT_SET;
         }
 
-        Aws::String GetNameForPlatform(Platform enumValue)
+        const char* GetNameForPlatformCStr(Platform enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Platform::APNS:
-            return "APNS";
-          case Platform::APNS_SANDBOX:
-            return "APNS_SANDBOX";
-          case Platform::GCM:
-            return "GCM";
-          case Platform::ADM:
-            return "ADM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlatform(Platform enumValue)
+        {
+          return GetNameForPlatformCStr(enumValue);
         }
 
       } // namespace PlatformMapper
@@ -42,6 +42,11 @@ namespace EntityTypeMapper
 AWS_COMPREHEND_API EntityType GetEntityTypeForName(const Aws::String& name);
 
 AWS_COMPREHEND_API Aws::String GetNameForEntityType(EntityType value);
+
+/**
+ * Same as GetNameForEntityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COMPREHEND_API const char* GetNameForEntityTypeCStr(EntityType value);
 } // namespace EntityTypeMapper
 } // namespace Model
 } // namespace Comprehend
@@ -35,6 +35,11 @@ namespace InputFormatMapper
 AWS_COMPREHEND_API InputFormat GetInputFormatForName(const Aws::String& name);
 
 AWS_COMPREHEND_API Aws::String GetNameForInputFormat(InputFormat value);
+
+/**
+ * Same as GetNameForInputFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COMPREHEND_API const char* GetNameForInputFormatCStr(InputFormat value);
 } // namespace InputFormatMapper
 } // namespace Model
 } // namespace Comprehend
@@ -39,6 +39,11 @@ namespace LanguageCodeMapper
 AWS_COMPREHEND_API LanguageCode GetLanguageCodeForName(const Aws::String& name);
 
 AWS_COMPREHEND_API Aws::String GetNameForLanguageCode(LanguageCode value);
+
+/**
+ * Same as GetNameForLanguageCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COMPREHEND_API const char* GetNameForLanguageCodeCStr(LanguageCode value);
 } // namespace LanguageCodeMapper
 } // namespace Model
 } // namespace Comprehend
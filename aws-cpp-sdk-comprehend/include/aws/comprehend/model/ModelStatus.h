@@ -40,6 +40,11 @@ namespace ModelStatusMapper
 AWS_COMPREHEND_API ModelStatus GetModelStatusForName(const Aws::String& name);
 
 AWS_COMPREHEND_API Aws::String GetNameForModelStatus(ModelStatus value);
+
+/**
+ * Same as GetNameForModelStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COMPREHEND_API const char* GetNameForModelStatusCStr(ModelStatus value);
 } // namespace ModelStatusMapper
 } // namespace Model
 } // namespace Comprehend
@@ -51,6 +51,11 @@ namespace PartOfSpeechTagTypeMapper
 AWS_COMPREHEND_API PartOfSpeechTagType GetPartOfSpeechTagTypeForName(const Aws::String& name);
 
 AWS_COMPREHEND_API Aws::String GetNameForPartOfSpeechTagType(PartOfSpeechTagType value);
+
+/**
+ * Same as GetNameForPartOfSpeechTagType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COMPREHEND_API const char* GetNameForPartOfSpeechTagTypeCStr(PartOfSpeechTagType value);
 } // namespace PartOfSpeechTagTypeMapper
 } // namespace Model
 } // namespace Comprehend
@@ -37,6 +37,11 @@ namespace SentimentTypeMapper
 AWS_COMPREHEND_API SentimentType GetSentimentTypeForName(const Aws::String& name);
 
 AWS_COMPREHEND_API Aws::String GetNameForSentimentType(SentimentType value);
+
+/**
+ * Same as GetNameForSentimentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COMPREHEND_API const char* GetNameForSentimentTypeCStr(SentimentType value);
 } // namespace SentimentTypeMapper
 } // namespace Model
 } // namespace Comprehend
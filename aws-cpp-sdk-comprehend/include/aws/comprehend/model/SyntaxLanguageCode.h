@@ -39,6 +39,11 @@ namespace SyntaxLanguageCodeMapper
 AWS_COMPREHEND_API SyntaxLanguageCode GetSyntaxLanguageCodeForName(const Aws::String& name);
 
 AWS_COMPREHEND_API Aws::String GetNameForSyntaxLanguageCode(SyntaxLanguageCode value);
+
+/**
+ * Same as GetNameForSyntaxLanguageCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COMPREHEND_API const char* GetNameForSyntaxLanguageCodeCStr(SyntaxLanguageCode value);
 } // namespace SyntaxLanguageCodeMapper
 } // namespace Model
 } // namespace Comprehend
@@ -30,55 +30,86 @@ namespace Aws
       namespace EntityTypeMapper
       {
 
-        static const int PERSON_HASH = HashingUtils::HashString("PERSON");
-        static const int LOCATION_HASH = HashingUtils::HashString("LOCATION");
-        static const int ORGANIZATION_HASH = HashingUtils::HashString("ORGANIZATION");
-        static const int COMMERCIAL_ITEM_HASH = HashingUtils::HashString("COMMERCIAL_ITEM");
-        static const int EVENT_HASH = HashingUtils::HashString("EVENT");
-        static const int DATE_HASH = HashingUtils::HashString("DATE");
-        static const int QUANTITY_HASH = HashingUtils::HashString("QUANTITY");
-        static const int TITLE_HASH = HashingUtils::HashString("TITLE");
-        static const int OTHER_HASH = HashingUtils::HashString("OTHER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PERSON",
+          "LOCATION",
+          "ORGANIZATION",
+          "COMMERCIAL_ITEM",
+          "EVENT",
+          "DATE",
+          "QUANTITY",
+          "TITLE",
+          "OTHER",
+        };
 
         EntityType GetEntityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PERSON_HASH)
-          {
-            return EntityType::PERSON;
-          }
-          else if (hashCode == LOCATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EntityType::LOCATION;
-          }
-          else if (hashCode == ORGANIZATION_HASH)
-          {
-            return EntityType::ORGANIZATION;
-          }
-          else if (hashCode == COMMERCIAL_ITEM_HASH)
-          {
-            return EntityType::COMMERCIAL_ITEM;
-          }
-          else if (hashCode == EVENT_HASH)
-          {
-            return EntityType::EVENT;
-          }
-          else if (hashCode == DATE_HASH)
-          {
-            return EntityType::DATE;
-          }
-          else if (hashCode == QUANTITY_HASH)
-          {
-            return EntityType::QUANTITY;
-          }
-          else if (hashCode == TITLE_HASH)
-          {
-            return EntityType::TITLE;
-          }
-          else if (hashCode == OTHER_HASH)
-          {
-            return EntityType::OTHER;
+          case -1938387115:
+            if (name == "PERSON")
+            {
+              return EntityType::PERSON;
+            }
+            break;
+          case -1611296843:
+            if (name == "LOCATION")
+            {
+              return EntityType::LOCATION;
+            }
+            break;
+          case -798763725:
+            if (name == "ORGANIZATION")
+            {
+              return EntityType::ORGANIZATION;
+            }
+            break;
+          case 159482600:
+            if (name == "COMMERCIAL_ITEM")
+            {
+              return EntityType::COMMERCIAL_ITEM;
+            }
+            break;
+          case 66353786:
+            if (name == "EVENT")
+            {
+              return EntityType::EVENT;
+            }
+            break;
+          case 2090926:
+            if (name == "DATE")
+            {
+              return EntityType::DATE;
+            }
+            break;
+          case -502377333:
+            if (name == "QUANTITY")
+            {
+              return EntityType::QUANTITY;
+            }
+            break;
+          case 79833656:
+            if (name == "TITLE")
+            {
+              return EntityType::TITLE;
+            }
+            break;
+          case 75532016:
+            if (name == "OTHER")
+            {
+              return EntityType::OTHER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return EntityType::NOT_SET;
         }
 
-        Aws::String GetNameForEntityType(EntityType enumValue)
+        const char* GetNameForEntityTypeCStr(EntityType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EntityType::PERSON:
-            return "PERSON";
-          case EntityType::LOCATION:
-            return "LOCATION";
-          case EntityType::ORGANIZATION:
-            return "ORGANIZATION";
-          case EntityType::COMMERCIAL_ITEM:
-            return "COMMERCIAL_ITEM";
-          case EntityType::EVENT:
-            return "EVENT";
-          case EntityType::DATE:
-            return "DATE";
-          case EntityType::QUANTITY:
-            return "QUANTITY";
-          case EntityType::TITLE:
-            return "TITLE";
-          case EntityType::OTHER:
-            return "OTHER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEntityType(EntityType enumValue)
+        {
+          return GetNameForEntityTypeCStr(enumValue);
         }
 
       } // namespace EntityTypeMapper
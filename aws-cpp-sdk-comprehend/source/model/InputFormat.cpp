@@ -30,20 +30,37 @@ namespace Aws
       namespace InputFormatMapper
       {
 
-        static const int ONE_DOC_PER_FILE_HASH = HashingUtils::HashString("ONE_DOC_PER_FILE");
-        static const int ONE_DOC_PER_LINE_HASH = HashingUtils::HashString("ONE_DOC_PER_LINE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ONE_DOC_PER_FILE",
+          "ONE_DOC_PER_LINE",
+        };
 
         InputFormat GetInputFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONE_DOC_PER_FILE_HASH)
-          {
-            return InputFormat::ONE_DOC_PER_FILE;
-          }
-          else if (hashCode == ONE_DOC_PER_LINE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputFormat::ONE_DOC_PER_LINE;
+          case -1671789538:
+            if (name == "ONE_DOC_PER_FILE")
+            {
+              return InputFormat::ONE_DOC_PER_FILE;
+            }
+            break;
+          case -1671610730:
+            if (name == "ONE_DOC_PER_LINE")
+            {
+              return InputFormat::ONE_DOC_PER_LINE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InputFormat::NOT_SET;
         }
 
-        Aws::String GetNameForInputFormat(InputFormat enumValue)
+        const char* GetNameForInputFormatCStr(InputFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputFormat::ONE_DOC_PER_FILE:
-            return "ONE_DOC_PER_FILE";
-          case InputFormat::ONE_DOC_PER_LINE:
-            return "ONE_DOC_PER_LINE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputFormat(InputFormat enumValue)
+        {
+          return GetNameForInputFormatCStr(enumValue);
         }
 
       } // namespace InputFormatMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int STOP_REQUESTED_HASH = HashingUtils::HashString("STOP_REQUESTED");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUBMITTED",
+          "IN_PROGRESS",
+          "COMPLETED",
+          "FAILED",
+          "STOP_REQUESTED",
+          "STOPPED",
+        };
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
-          {
-            return JobStatus::SUBMITTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return JobStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return JobStatus::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobStatus::FAILED;
-          }
-          else if (hashCode == STOP_REQUESTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobStatus::STOP_REQUESTED;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return JobStatus::STOPPED;
+          case -1159694117:
+            if (name == "SUBMITTED")
+            {
+              return JobStatus::SUBMITTED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return JobStatus::IN_PROGRESS;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return JobStatus::COMPLETED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return JobStatus::FAILED;
+            }
+            break;
+          case -605681839:
+            if (name == "STOP_REQUESTED")
+            {
+              return JobStatus::STOP_REQUESTED;
+            }
+            break;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return JobStatus::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatusCStr(JobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobStatus::SUBMITTED:
-            return "SUBMITTED";
-          case JobStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case JobStatus::COMPLETED:
-            return "COMPLETED";
-          case JobStatus::FAILED:
-            return "FAILED";
-          case JobStatus::STOP_REQUESTED:
-            return "STOP_REQUESTED";
-          case JobStatus::STOPPED:
-            return "STOPPED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        {
+          return GetNameForJobStatusCStr(enumValue);
         }
 
       } // namespace JobStatusMapper
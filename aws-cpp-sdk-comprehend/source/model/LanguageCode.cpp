@@ -30,40 +30,65 @@ namespace Aws
       namespace LanguageCodeMapper
       {
 
-        static const int en_HASH = HashingUtils::HashString("en");
-        static const int es_HASH = HashingUtils::HashString("es");
-        static const int fr_HASH = HashingUtils::HashString("fr");
-        static const int de_HASH = HashingUtils::HashString("de");
-        static const int it_HASH = HashingUtils::HashString("it");
-        static const int pt_HASH = HashingUtils::HashString("pt");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "en",
+          "es",
+          "fr",
+          "de",
+          "it",
+          "pt",
+        };
 
         LanguageCode GetLanguageCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == en_HASH)
-          {
-            return LanguageCode::en;
-          }
-          else if (hashCode == es_HASH)
-          {
-            return LanguageCode::es;
-          }
-          else if (hashCode == fr_HASH)
-          {
-            return LanguageCode::fr;
-          }
-          else if (hashCode == de_HASH)
-          {
-            return LanguageCode::de;
-          }
-          else if (hashCode == it_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LanguageCode::it;
-          }
-          else if (hashCode == pt_HASH)
-          {
-            return LanguageCode::pt;
+          case 3241:
+            if (name == "en")
+            {
+              return LanguageCode::en;
+            }
+            break;
+          case 3246:
+            if (name == "es")
+            {
+              return LanguageCode::es;
+            }
+            break;
+          case 3276:
+            if (name == "fr")
+            {
+              return LanguageCode::fr;
+            }
+            break;
+          case 3201:
+            if (name == "de")
+            {
+              return LanguageCode::de;
+            }
+            break;
+          case 3371:
+            if (name == "it")
+            {
+              return LanguageCode::it;
+            }
+            break;
+          case 3588:
+            if (name == "pt")
+            {
+              return LanguageCode::pt;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return LanguageCode::NOT_SET;
         }
 
-        Aws::String GetNameForLanguageCode(LanguageCode enumValue)
+        const char* GetNameForLanguageCodeCStr(LanguageCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LanguageCode::en:
-            return "en";
-          case LanguageCode::es:
-            return "es";
-          case LanguageCode::fr:
-            return "fr";
-          case LanguageCode::de:
-            return "de";
-          case LanguageCode::it:
-            return "it";
-          case LanguageCode::pt:
-            return "pt";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLanguageCode(LanguageCode enumValue)
+        {
+          return GetNameForLanguageCodeCStr(enumValue);
         }
 
       } // namespace LanguageCodeMapper
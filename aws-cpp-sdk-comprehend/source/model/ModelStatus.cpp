@@ -30,45 +30,72 @@ namespace Aws
       namespace ModelStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int TRAINING_HASH = HashingUtils::HashString("TRAINING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int STOP_REQUESTED_HASH = HashingUtils::HashString("STOP_REQUESTED");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-        static const int IN_ERROR_HASH = HashingUtils::HashString("IN_ERROR");
-        static const int TRAINED_HASH = HashingUtils::HashString("TRAINED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUBMITTED",
+          "TRAINING",
+          "DELETING",
+          "STOP_REQUESTED",
+          "STOPPED",
+          "IN_ERROR",
+          "TRAINED",
+        };
 
         ModelStatus GetModelStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
-          {
-            return ModelStatus::SUBMITTED;
-          }
-          else if (hashCode == TRAINING_HASH)
-          {
-            return ModelStatus::TRAINING;
-          }
-          else if (hashCode == DELETING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ModelStatus::DELETING;
-          }
-          else if (hashCode == STOP_REQUESTED_HASH)
-          {
-            return ModelStatus::STOP_REQUESTED;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return ModelStatus::STOPPED;
-          }
-          else if (hashCode == IN_ERROR_HASH)
-          {
-            return ModelStatus::IN_ERROR;
-          }
-          else if (hashCode == TRAINED_HASH)
-          {
-            return ModelStatus::TRAINED;
+          case -1159694117:
+            if (name == "SUBMITTED")
+            {
+              return ModelStatus::SUBMITTED;
+            }
+            break;
+          case 2058746074:
+            if (name == "TRAINING")
+            {
+              return ModelStatus::TRAINING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ModelStatus::DELETING;
+            }
+            break;
+          case -605681839:
+            if (name == "STOP_REQUESTED")
+            {
+              return ModelStatus::STOP_REQUESTED;
+            }
+            break;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return ModelStatus::STOPPED;
+            }
+            break;
+          case 1667962446:
+            if (name == "IN_ERROR")
+            {
+              return ModelStatus::IN_ERROR;
+            }
+            break;
+          case -349230969:
+            if (name == "TRAINED")
+            {
+              return ModelStatus::TRAINED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ModelStatus::NOT_SET;
         }
 
-        Aws::String GetNameForModelStatus(ModelStatus enumValue)
+        const char* GetNameForModelStatusCStr(ModelStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ModelStatus::SUBMITTED:
-            return "SUBMITTED";
-          case ModelStatus::TRAINING:
-            return "TRAINING";
-          case ModelStatus::DELETING:
-            return "DELETING";
-          case ModelStatus::STOP_REQUESTED:
-            return "STOP_REQUESTED";
-          case ModelStatus::STOPPED:
-            return "STOPPED";
-          case ModelStatus::IN_ERROR:
-            return "IN_ERROR";
-          case ModelStatus::TRAINED:
-            return "TRAINED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForModelStatus(ModelStatus enumValue)
+        {
+          return GetNameForModelStatusCStr(enumValue);
         }
 
       } // namespace ModelStatusMapper
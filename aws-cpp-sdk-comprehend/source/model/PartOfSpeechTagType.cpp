@@ -30,100 +30,149 @@ namespace Aws
       namespace PartOfSpeechTagTypeMapper
       {
 
-        static const int ADJ_HASH = HashingUtils::HashString("ADJ");
-        static const int ADP_HASH = HashingUtils::HashString("ADP");
-        static const int ADV_HASH = HashingUtils::HashString("ADV");
-        static const int AUX_HASH = HashingUtils::HashString("AUX");
-        static const int CONJ_HASH = HashingUtils::HashString("CONJ");
-        static const int CCONJ_HASH = HashingUtils::HashString("CCONJ");
-        static const int DET_HASH = HashingUtils::HashString("DET");
-        static const int INTJ_HASH = HashingUtils::HashString("INTJ");
-        static const int NOUN_HASH = HashingUtils::HashString("NOUN");
-        static const int NUM_HASH = HashingUtils::HashString("NUM");
-        static const int O_HASH = HashingUtils::HashString("O");
-        static const int PART_HASH = HashingUtils::HashString("PART");
-        static const int PRON_HASH = HashingUtils::HashString("PRON");
-        static const int PROPN_HASH = HashingUtils::HashString("PROPN");
-        static const int PUNCT_HASH = HashingUtils::HashString("PUNCT");
-        static const int SCONJ_HASH = HashingUtils::HashString("SCONJ");
-        static const int SYM_HASH = HashingUtils::HashString("SYM");
-        static const int VERB_HASH = HashingUtils::HashString("VERB");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADJ",
+          "ADP",
+          "ADV",
+          "AUX",
+          "CONJ",
+          "CCONJ",
+          "DET",
+          "INTJ",
+          "NOUN",
+          "NUM",
+          "O",
+          "PART",
+          "PRON",
+          "PROPN",
+          "PUNCT",
+          "SCONJ",
+          "SYM",
+          "VERB",
+        };
 
         PartOfSpeechTagType GetPartOfSpeechTagTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADJ_HASH)
-          {
-            return PartOfSpeechTagType::ADJ;
-          }
-          else if (hashCode == ADP_HASH)
-          {
-            return PartOfSpeechTagType::ADP;
-          }
-          else if (hashCode == ADV_HASH)
-          {
-            return PartOfSpeechTagType::ADV;
-          }
-          else if (hashCode == AUX_HASH)
-          {
-            return PartOfSpeechTagType::AUX;
-          }
-          else if (hashCode == CONJ_HASH)
-          {
-            return PartOfSpeechTagType::CONJ;
-          }
-          else if (hashCode == CCONJ_HASH)
-          {
-            return PartOfSpeechTagType::CCONJ;
-          }
-          else if (hashCode == DET_HASH)
-          {
-            return PartOfSpeechTagType::DET;
-          }
-          else if (hashCode == INTJ_HASH)
-          {
-            return PartOfSpeechTagType::INTJ;
-          }
-          else if (hashCode == NOUN_HASH)
-          {
-            return PartOfSpeechTagType::NOUN;
-          }
-          else if (hashCode == NUM_HASH)
-          {
-            return PartOfSpeechTagType::NUM;
-          }
-          else if (hashCode == O_HASH)
-          {
-            return PartOfSpeechTagType::O;
-          }
-          else if (hashCode == PART_HASH)
-          {
-            return PartOfSpeechTagType::PART;
-          }
-          else if (hashCode == PRON_HASH)
-          {
-            return PartOfSpeechTagType::PRON;
-          }
-          else if (hashCode == PROPN_HASH)
-          {
-            return PartOfSpeechTagType::PROPN;
-          }
-          else if (hashCode == PUNCT_HASH)
-          {
-            return PartOfSpeechTagType::PUNCT;
-          }
-          else if (hashCode == SCONJ_HASH)
-          {
-            return PartOfSpeechTagType::SCONJ;
-          }
-          else if (hashCode == SYM_HASH)
-          {
-            return PartOfSpeechTagType::SYM;
-          }
-          else if (hashCode == VERB_HASH)
-          {
-            return PartOfSpeechTagType::VERB;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 64647:
+            if (name == "ADJ")
+            {
+              return PartOfSpeechTagType::ADJ;
+            }
+            break;
+          case 64653:
+            if (name == "ADP")
+            {
+              return PartOfSpeechTagType::ADP;
+            }
+            break;
+          case 64659:
+            if (name == "ADV")
+            {
+              return PartOfSpeechTagType::ADV;
+            }
+            break;
+          case 65188:
+            if (name == "AUX")
+            {
+              return PartOfSpeechTagType::AUX;
+            }
+            break;
+          case 2074408:
+            if (name == "CONJ")
+            {
+              return PartOfSpeechTagType::CONJ;
+            }
+            break;
+          case 63950315:
+            if (name == "CCONJ")
+            {
+              return PartOfSpeechTagType::CCONJ;
+            }
+            break;
+          case 67571:
+            if (name == "DET")
+            {
+              return PartOfSpeechTagType::DET;
+            }
+            break;
+          case 2252379:
+            if (name == "INTJ")
+            {
+              return PartOfSpeechTagType::INTJ;
+            }
+            break;
+          case 2402330:
+            if (name == "NOUN")
+            {
+              return PartOfSpeechTagType::NOUN;
+            }
+            break;
+          case 77670:
+            if (name == "NUM")
+            {
+              return PartOfSpeechTagType::NUM;
+            }
+            break;
+          case 79:
+            if (name == "O")
+            {
+              return PartOfSpeechTagType::O;
+            }
+            break;
+          case 2448371:
+            if (name == "PART")
+            {
+              return PartOfSpeechTagType::PART;
+            }
+            break;
+          case 2464609:
+            if (name == "PRON")
+            {
+              return PartOfSpeechTagType::PRON;
+            }
+            break;
+          case 76403019:
+            if (name == "PROPN")
+            {
+              return PartOfSpeechTagType::PROPN;
+            }
+            break;
+          case 76491034:
+            if (name == "PUNCT")
+            {
+              return PartOfSpeechTagType::PUNCT;
+            }
+            break;
+          case 78726651:
+            if (name == "SCONJ")
+            {
+              return PartOfSpeechTagType::SCONJ;
+            }
+            break;
+          case 82599:
+            if (name == "SYM")
+            {
+              return PartOfSpeechTagType::SYM;
+            }
+            break;
+          case 2630943:
+            if (name == "VERB")
+            {
+              return PartOfSpeechTagType::VERB;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -135,55 +184,26 @@ namespace Aws
           return PartOfSpeechTagType::NOT_SET;
         }
 
-        Aws::String GetNameForPartOfSpeechTagType(PartOfSpeechTagType enumValue)
+        const char* GetNameForPartOfSpeechTagTypeCStr(PartOfSpeechTagType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PartOfSpeechTagType::ADJ:
-            return "ADJ";
-          case PartOfSpeechTagType::ADP:
-            return "ADP";
-          case PartOfSpeechTagType::ADV:
-            return "ADV";
-          case PartOfSpeechTagType::AUX:
-            return "AUX";
-          case PartOfSpeechTagType::CONJ:
-            return "CONJ";
-          case PartOfSpeechTagType::CCONJ:
-            return "CCONJ";
-          case PartOfSpeechTagType::DET:
-            return "DET";
-          case PartOfSpeechTagType::INTJ:
-            return "INTJ";
-          case PartOfSpeechTagType::NOUN:
-            return "NOUN";
-          case PartOfSpeechTagType::NUM:
-            return "NUM";
-          case PartOfSpeechTagType::O:
-            return "O";
-          case PartOfSpeechTagType::PART:
-            return "PART";
-          case PartOfSpeechTagType::PRON:
-            return "PRON";
-          case PartOfSpeechTagType::PROPN:
-            return "PROPN";
-          case PartOfSpeechTagType::PUNCT:
-            return "PUNCT";
-          case PartOfSpeechTagType::SCONJ:
-            return "SCONJ";
-          case PartOfSpeechTagType::SYM:
-            return "SYM";
-          case PartOfSpeechTagType::VERB:
-            return "VERB";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPartOfSpeechTagType(PartOfSpeechTagType enumValue)
+        {
+          return GetNameForPartOfSpeechTagTypeCStr(enumValue);
         }
 
       } // namespace PartOfSpeechTagTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace SentimentTypeMapper
       {
 
-        static const int POSITIVE_HASH = HashingUtils::HashString("POSITIVE");
-        static const int NEGATIVE_HASH = HashingUtils::HashString("NEGATIVE");
-        static const int NEUTRAL_HASH = HashingUtils::HashString("NEUTRAL");
-        static const int MIXED_HASH = HashingUtils::HashString("MIXED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "POSITIVE",
+          "NEGATIVE",
+          "NEUTRAL",
+          "MIXED",
+        };
 
         SentimentType GetSentimentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == POSITIVE_HASH)
-          {
-            return SentimentType::POSITIVE;
-          }
-          else if (hashCode == NEGATIVE_HASH)
-          {
-            return SentimentType::NEGATIVE;
-          }
-          else if (hashCode == NEUTRAL_HASH)
-          {
-            return SentimentType::NEUTRAL;
-          }
-          else if (hashCode == MIXED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SentimentType::MIXED;
+          case 1530431993:
+            if (name == "POSITIVE")
+            {
+              return SentimentType::POSITIVE;
+            }
+            break;
+          case 1703738421:
+            if (name == "NEGATIVE")
+            {
+              return SentimentType::NEGATIVE;
+            }
+            break;
+          case -1732662873:
+            if (name == "NEUTRAL")
+            {
+              return SentimentType::NEUTRAL;
+            }
+            break;
+          case 73372635:
+            if (name == "MIXED")
+            {
+              return SentimentType::MIXED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return SentimentType::NOT_SET;
         }
 
-        Aws::String GetNameForSentimentType(SentimentType enumValue)
+        const char* GetNameForSentimentTypeCStr(SentimentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SentimentType::POSITIVE:
-            return "POSITIVE";
-          case SentimentType::NEGATIVE:
-            return "NEGATIVE";
-          case SentimentType::NEUTRAL:
-            return "NEUTRAL";
-          case SentimentType::MIXED:
-            return "MIXED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSentimentType(SentimentType enumValue)
+        {
+          return GetNameForSentimentTypeCStr(enumValue);
         }
 
       } // namespace SentimentTypeMapper
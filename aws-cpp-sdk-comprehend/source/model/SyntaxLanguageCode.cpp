@@ -30,40 +30,65 @@ namespace Aws
       namespace SyntaxLanguageCodeMapper
       {
 
-        static const int en_HASH = HashingUtils::HashString("en");
-        static const int es_HASH = HashingUtils::HashString("es");
-        static const int fr_HASH = HashingUtils::HashString("fr");
-        static const int de_HASH = HashingUtils::HashString("de");
-        static const int it_HASH = HashingUtils::HashString("it");
-        static const int pt_HASH = HashingUtils::HashString("pt");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "en",
+          "es",
+          "fr",
+          "de",
+          "it",
+          "pt",
+        };
 
         SyntaxLanguageCode GetSyntaxLanguageCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == en_HASH)
-          {
-            return SyntaxLanguageCode::en;
-          }
-          else if (hashCode == es_HASH)
-          {
-            return SyntaxLanguageCode::es;
-          }
-          else if (hashCode == fr_HASH)
-          {
-            return SyntaxLanguageCode::fr;
-          }
-          else if (hashCode == de_HASH)
-          {
-            return SyntaxLanguageCode::de;
-          }
-          else if (hashCode == it_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SyntaxLanguageCode::it;
-          }
-          else if (hashCode == pt_HASH)
-          {
-            return SyntaxLanguageCode::pt;
+          case 3241:
+            if (name == "en")
+            {
+              return SyntaxLanguageCode::en;
+            }
+            break;
+          case 3246:
+            if (name == "es")
+            {
+              return SyntaxLanguageCode::es;
+            }
+            break;
+          case 3276:
+            if (name == "fr")
+            {
+              return SyntaxLanguageCode::fr;
+            }
+            break;
+          case 3201:
+            if (name == "de")
+            {
+              return SyntaxLanguageCode::de;
+            }
+            break;
+          case 3371:
+            if (name == "it")
+            {
+              return SyntaxLanguageCode::it;
+            }
+            break;
+          case 3588:
+            if (name == "pt")
+            {
+              return SyntaxLanguageCode::pt;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return SyntaxLanguageCode::NOT_SET;
         }
 
-        Aws::String GetNameForSyntaxLanguageCode(SyntaxLanguageCode enumValue)
+        const char* GetNameForSyntaxLanguageCodeCStr(SyntaxLanguageCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SyntaxLanguageCode::en:
-            return "en";
-          case SyntaxLanguageCode::es:
-            return "es";
-          case SyntaxLanguageCode::fr:
-            return "fr";
-          case SyntaxLanguageCode::de:
-            return "de";
-          case SyntaxLanguageCode::it:
-            return "it";
-          case SyntaxLanguageCode::pt:
-            return "pt";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSyntaxLanguageCode(SyntaxLanguageCode enumValue)
+        {
+          return GetNameForSyntaxLanguageCodeCStr(enumValue);
         }
 
       } // namespace SyntaxLanguageCodeMapper
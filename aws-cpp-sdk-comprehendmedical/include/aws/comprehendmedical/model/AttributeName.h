@@ -37,6 +37,11 @@ namespace AttributeNameMapper
 AWS_COMPREHENDMEDICAL_API AttributeName GetAttributeNameForName(const Aws::String& name);
 
 AWS_COMPREHENDMEDICAL_API Aws::String GetNameForAttributeName(AttributeName value);
+
+/**
+ * Same as GetNameForAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COMPREHENDMEDICAL_API const char* GetNameForAttributeNameCStr(AttributeName value);
 } // namespace AttributeNameMapper
 } // namespace Model
 } // namespace ComprehendMedical
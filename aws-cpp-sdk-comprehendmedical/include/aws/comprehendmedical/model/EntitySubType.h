@@ -61,6 +61,11 @@ namespace EntitySubTypeMapper
 AWS_COMPREHENDMEDICAL_API EntitySubType GetEntitySubTypeForName(const Aws::String& name);
 
 AWS_COMPREHENDMEDICAL_API Aws::String GetNameForEntitySubType(EntitySubType value);
+
+/**
+ * Same as GetNameForEntitySubType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COMPREHENDMEDICAL_API const char* GetNameForEntitySubTypeCStr(EntitySubType value);
 } // namespace EntitySubTypeMapper
 } // namespace Model
 } // namespace ComprehendMedical
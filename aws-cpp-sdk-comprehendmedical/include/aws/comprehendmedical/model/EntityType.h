@@ -38,6 +38,11 @@ namespace EntityTypeMapper
 AWS_COMPREHENDMEDICAL_API EntityType GetEntityTypeForName(const Aws::String& name);
 
 AWS_COMPREHENDMEDICAL_API Aws::String GetNameForEntityType(EntityType value);
+
+/**
+ * Same as GetNameForEntityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COMPREHENDMEDICAL_API const char* GetNameForEntityTypeCStr(EntityType value);
 } // namespace EntityTypeMapper
 } // namespace Model
 } // namespace ComprehendMedical
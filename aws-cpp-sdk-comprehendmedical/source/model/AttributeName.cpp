@@ -30,30 +30,51 @@ namespace Aws
       namespace AttributeNameMapper
       {
 
-        static const int SIGN_HASH = HashingUtils::HashString("SIGN");
-        static const int SYMPTOM_HASH = HashingUtils::HashString("SYMPTOM");
-        static const int DIAGNOSIS_HASH = HashingUtils::HashString("DIAGNOSIS");
-        static const int NEGATION_HASH = HashingUtils::HashString("NEGATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SIGN",
+          "SYMPTOM",
+          "DIAGNOSIS",
+          "NEGATION",
+        };
 
         AttributeName GetAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIGN_HASH)
-          {
-            return AttributeName::SIGN;
-          }
-          else if (hashCode == SYMPTOM_HASH)
-          {
-            return AttributeName::SYMPTOM;
-          }
-          else if (hashCode == DIAGNOSIS_HASH)
-          {
-            return AttributeName::DIAGNOSIS;
-          }
-          else if (hashCode == NEGATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AttributeName::NEGATION;
+          case 2545085:
+            if (name == "SIGN")
+            {
+              return AttributeName::SIGN;
+            }
+            break;
+          case -1025033719:
+            if (name == "SYMPTOM")
+            {
+              return AttributeName::SYMPTOM;
+            }
+            break;
+          case -311379247:
+            if (name == "DIAGNOSIS")
+            {
+              return AttributeName::DIAGNOSIS;
+            }
+            break;
+          case 1703738213:
+            if (name == "NEGATION")
+            {
+              return AttributeName::NEGATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForAttributeName(AttributeName enumValue)
+        const char* GetNameForAttributeNameCStr(AttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AttributeName::SIGN:
-            return "SIGN";
-          case AttributeName::SYMPTOM:
-            return "SYMPTOM";
-          case AttributeName::DIAGNOSIS:
-            return "DIAGNOSIS";
-          case AttributeName::NEGATION:
-            return "NEGATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAttributeName(AttributeName enumValue)
+        {
+          return GetNameForAttributeNameCStr(enumValue);
         }
 
       } // namespace AttributeNameMapper
@@ -30,150 +30,219 @@ namespace Aws
       namespace EntitySubTypeMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int DOSAGE_HASH = HashingUtils::HashString("DOSAGE");
-        static const int ROUTE_OR_MODE_HASH = HashingUtils::HashString("ROUTE_OR_MODE");
-        static const int FORM_HASH = HashingUtils::HashString("FORM");
-        static const int FREQUENCY_HASH = HashingUtils::HashString("FREQUENCY");
-        static const int DURATION_HASH = HashingUtils::HashString("DURATION");
-        static const int GENERIC_NAME_HASH = HashingUtils::HashString("GENERIC_NAME");
-        static const int BRAND_NAME_HASH = HashingUtils::HashString("BRAND_NAME");
-        static const int STRENGTH_HASH = HashingUtils::HashString("STRENGTH");
-        static const int RATE_HASH = HashingUtils::HashString("RATE");
-        static const int ACUITY_HASH = HashingUtils::HashString("ACUITY");
-        static const int TEST_NAME_HASH = HashingUtils::HashString("TEST_NAME");
-        static const int TEST_VALUE_HASH = HashingUtils::HashString("TEST_VALUE");
-        static const int TEST_UNITS_HASH = HashingUtils::HashString("TEST_UNITS");
-        static const int PROCEDURE_NAME_HASH = HashingUtils::HashString("PROCEDURE_NAME");
-        static const int TREATMENT_NAME_HASH = HashingUtils::HashString("TREATMENT_NAME");
-        static const int DATE_HASH = HashingUtils::HashString("DATE");
-        static const int AGE_HASH = HashingUtils::HashString("AGE");
-        static const int CONTACT_POINT_HASH = HashingUtils::HashString("CONTACT_POINT");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
-        static const int IDENTIFIER_HASH = HashingUtils::HashString("IDENTIFIER");
-        static const int URL_HASH = HashingUtils::HashString("URL");
-        static const int ADDRESS_HASH = HashingUtils::HashString("ADDRESS");
-        static const int PROFESSION_HASH = HashingUtils::HashString("PROFESSION");
-        static const int SYSTEM_ORGAN_SITE_HASH = HashingUtils::HashString("SYSTEM_ORGAN_SITE");
-        static const int DIRECTION_HASH = HashingUtils::HashString("DIRECTION");
-        static const int QUALITY_HASH = HashingUtils::HashString("QUALITY");
-        static const int QUANTITY_HASH = HashingUtils::HashString("QUANTITY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NAME",
+          "DOSAGE",
+          "ROUTE_OR_MODE",
+          "FORM",
+          "FREQUENCY",
+          "DURATION",
+          "GENERIC_NAME",
+          "BRAND_NAME",
+          "STRENGTH",
+          "RATE",
+          "ACUITY",
+          "TEST_NAME",
+          "TEST_VALUE",
+          "TEST_UNITS",
+          "PROCEDURE_NAME",
+          "TREATMENT_NAME",
+          "DATE",
+          "AGE",
+          "CONTACT_POINT",
+          "EMAIL",
+          "IDENTIFIER",
+          "URL",
+          "ADDRESS",
+          "PROFESSION",
+          "SYSTEM_ORGAN_SITE",
+          "DIRECTION",
+          "QUALITY",
+          "QUANTITY",
+        };
 
         EntitySubType GetEntitySubTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
-          {
-            return EntitySubType::NAME;
-          }
-          else if (hashCode == DOSAGE_HASH)
-          {
-            return EntitySubType::DOSAGE;
-          }
-          else if (hashCode == ROUTE_OR_MODE_HASH)
-          {
-            return EntitySubType::ROUTE_OR_MODE;
-          }
-          else if (hashCode == FORM_HASH)
-          {
-            return EntitySubType::FORM;
-          }
-          else if (hashCode == FREQUENCY_HASH)
-          {
-            return EntitySubType::FREQUENCY;
-          }
-          else if (hashCode == DURATION_HASH)
-          {
-            return EntitySubType::DURATION;
-          }
-          else if (hashCode == GENERIC_NAME_HASH)
-          {
-            return EntitySubType::GENERIC_NAME;
-          }
-          else if (hashCode == BRAND_NAME_HASH)
-          {
-            return EntitySubType::BRAND_NAME;
-          }
-          else if (hashCode == STRENGTH_HASH)
-          {
-            return EntitySubType::STRENGTH;
-          }
-          else if (hashCode == RATE_HASH)
-          {
-            return EntitySubType::RATE;
-          }
-          else if (hashCode == ACUITY_HASH)
-          {
-            return EntitySubType::ACUITY;
-          }
-          else if (hashCode == TEST_NAME_HASH)
-          {
-            return EntitySubType::TEST_NAME;
-          }
-          else if (hashCode == TEST_VALUE_HASH)
-          {
-            return EntitySubType::TEST_VALUE;
-          }
-          else if (hashCode == TEST_UNITS_HASH)
-          {
-            return EntitySubType::TEST_UNITS;
-          }
-          else if (hashCode == PROCEDURE_NAME_HASH)
-          {
-            return EntitySubType::PROCEDURE_NAME;
-          }
-          else if (hashCode == TREATMENT_NAME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EntitySubType::TREATMENT_NAME;
-          }
-          else if (hashCode == DATE_HASH)
-          {
-            return EntitySubType::DATE;
-          }
-          else if (hashCode == AGE_HASH)
-          {
-            return EntitySubType::AGE;
-          }
-          else if (hashCode == CONTACT_POINT_HASH)
-          {
-            return EntitySubType::CONTACT_POINT;
-          }
-          else if (hashCode == EMAIL_HASH)
-          {
-            return EntitySubType::EMAIL;
-          }
-          else if (hashCode == IDENTIFIER_HASH)
-          {
-            return EntitySubType::IDENTIFIER;
-          }
-          else if (hashCode == URL_HASH)
-          {
-            return EntitySubType::URL;
-          }
-          else if (hashCode == ADDRESS_HASH)
-          {
-            return EntitySubType::ADDRESS;
-          }
-          else if (hashCode == PROFESSION_HASH)
-          {
-            return EntitySubType::PROFESSION;
-          }
-          else if (hashCode == SYSTEM_ORGAN_SITE_HASH)
-          {
-            return EntitySubType::SYSTEM_ORGAN_SITE;
-          }
-          else if (hashCode == DIRECTION_HASH)
-          {
-            return EntitySubType::DIRECTION;
-          }
-          else if (hashCode == QUALITY_HASH)
-          {
-            return EntitySubType::QUALITY;
-          }
-          else if (hashCode == QUANTITY_HASH)
-          {
-            return EntitySubType::QUANTITY;
+          case 2388619:
+            if (name == "NAME")
+            {
+              return EntitySubType::NAME;
+            }
+            break;
+          case 2022277815:
+            if (name == "DOSAGE")
+            {
+              return EntitySubType::DOSAGE;
+            }
+            break;
+          case -986923415:
+            if (name == "ROUTE_OR_MODE")
+            {
+              return EntitySubType::ROUTE_OR_MODE;
+            }
+            break;
+          case 2163908:
+            if (name == "FORM")
+            {
+              return EntitySubType::FORM;
+            }
+            break;
+          case -1578396356:
+            if (name == "FREQUENCY")
+            {
+              return EntitySubType::FREQUENCY;
+            }
+            break;
+          case -1209385580:
+            if (name == "DURATION")
+            {
+              return EntitySubType::DURATION;
+            }
+            break;
+          case 2083950611:
+            if (name == "GENERIC_NAME")
+            {
+              return EntitySubType::GENERIC_NAME;
+            }
+            break;
+          case 1888870499:
+            if (name == "BRAND_NAME")
+            {
+              return EntitySubType::BRAND_NAME;
+            }
+            break;
+          case -1721024447:
+            if (name == "STRENGTH")
+            {
+              return EntitySubType::STRENGTH;
+            }
+            break;
+          case 2508000:
+            if (name == "RATE")
+            {
+              return EntitySubType::RATE;
+            }
+            break;
+          case 1925375803:
+            if (name == "ACUITY")
+            {
+              return EntitySubType::ACUITY;
+            }
+            break;
+          case 1635842584:
+            if (name == "TEST_NAME")
+            {
+              return EntitySubType::TEST_NAME;
+            }
+            break;
+          case -821099676:
+            if (name == "TEST_VALUE")
+            {
+              return EntitySubType::TEST_VALUE;
+            }
+            break;
+          case -821638814:
+            if (name == "TEST_UNITS")
+            {
+              return EntitySubType::TEST_UNITS;
+            }
+            break;
+          case 2005749911:
+            if (name == "PROCEDURE_NAME")
+            {
+              return EntitySubType::PROCEDURE_NAME;
+            }
+            break;
+          case -689104366:
+            if (name == "TREATMENT_NAME")
+            {
+              return EntitySubType::TREATMENT_NAME;
+            }
+            break;
+          case 2090926:
+            if (name == "DATE")
+            {
+              return EntitySubType::DATE;
+            }
+            break;
+          case 64735:
+            if (name == "AGE")
+            {
+              return EntitySubType::AGE;
+            }
+            break;
+          case 694644849:
+            if (name == "CONTACT_POINT")
+            {
+              return EntitySubType::CONTACT_POINT;
+            }
+            break;
+          case 66081660:
+            if (name == "EMAIL")
+            {
+              return EntitySubType::EMAIL;
+            }
+            break;
+          case -1133340503:
+            if (name == "IDENTIFIER")
+            {
+              return EntitySubType::IDENTIFIER;
+            }
+            break;
+          case 84303:
+            if (name == "URL")
+            {
+              return EntitySubType::URL;
+            }
+            break;
+          case -429709356:
+            if (name == "ADDRESS")
+            {
+              return EntitySubType::ADDRESS;
+            }
+            break;
+          case -725168900:
+            if (name == "PROFESSION")
+            {
+              return EntitySubType::PROFESSION;
+            }
+            break;
+          case 1430917349:
+            if (name == "SYSTEM_ORGAN_SITE")
+            {
+              return EntitySubType::SYSTEM_ORGAN_SITE;
+            }
+            break;
+          case 1824003935:
+            if (name == "DIRECTION")
+            {
+              return EntitySubType::DIRECTION;
+            }
+            break;
+          case 1369197791:
+            if (name == "QUALITY")
+            {
+              return EntitySubType::QUALITY;
+            }
+            break;
+          case -502377333:
+            if (name == "QUANTITY")
+            {
+              return EntitySubType::QUANTITY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -185,75 +254,26 @@ namespace Aws
           return EntitySubType::NOT_SET;
         }
 
-        Aws::String GetNameForEntitySubType(EntitySubType enumValue)
+        const char* GetNameForEntitySubTypeCStr(EntitySubType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EntitySubType::NAME:
-            return "NAME";
-          case EntitySubType::DOSAGE:
-            return "DOSAGE";
-          case EntitySubType::ROUTE_OR_MODE:
-            return "ROUTE_OR_MODE";
-          case EntitySubType::FORM:
-            return "FORM";
-          case EntitySubType::FREQUENCY:
-            return "FREQUENCY";
-          case EntitySubType::DURATION:
-            return "DURATION";
-          case EntitySubType::GENERIC_NAME:
-            return "GENERIC_NAME";
-          case EntitySubType::BRAND_NAME:
-            return "BRAND_NAME";
-          case EntitySubType::STRENGTH:
-            return "STRENGTH";
-          case EntitySubType::RATE:
-            return "RATE";
-          case EntitySubType::ACUITY:
-            return "ACUITY";
-          case EntitySubType::TEST_NAME:
-            return "TEST_NAME";
-          case EntitySubType::TEST_VALUE:
-            return "TEST_VALUE";
-          case EntitySubType::TEST_UNITS:
-            return "TEST_UNITS";
-          case EntitySubType::PROCEDURE_NAME:
-            return "PROCEDURE_NAME";
-          case EntitySubType::TREATMENT_NAME:
-            return "TREATMENT_NAME";
-          case EntitySubType::DATE:
-            return "DATE";
-          case EntitySubType::AGE:
-            return "AGE";
-          case EntitySubType::CONTACT_POINT:
-            return "CONTACT_POINT";
-          case EntitySubType::EMAIL:
-            return "EMAIL";
-          case EntitySubType::IDENTIFIER:
-            return "IDENTIFIER";
-          case EntitySubType::URL:
-            return "URL";
-          case EntitySubType::ADDRESS:
-            return "ADDRESS";
-          case EntitySubType::PROFESSION:
-            return "PROFESSION";
-          case EntitySubType::SYSTEM_ORGAN_SITE:
-            return "SYSTEM_ORGAN_SITE";
-          case EntitySubType::DIRECTION:
-            return "DIRECTION";
-          case EntitySubType::QUALITY:
-            return "QUALITY";
-          case EntitySubType::QUANTITY:
-            return "QUANTITY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEntitySubType(EntitySubType enumValue)
+        {
+          return GetNameForEntitySubTypeCStr(enumValue);
         }
 
       } // namespace EntitySubTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace EntityTypeMapper
       {
 
-        static const int MEDICATION_HASH = HashingUtils::HashString("MEDICATION");
-        static const int MEDICAL_CONDITION_HASH = HashingUtils::HashString("MEDICAL_CONDITION");
-        static const int PROTECTED_HEALTH_INFORMATION_HASH = HashingUtils::HashString("PROTECTED_HEALTH_INFORMATION");
-        static const int TEST_TREATMENT_PROCEDURE_HASH = HashingUtils::HashString("TEST_TREATMENT_PROCEDURE");
-        static const int ANATOMY_HASH = HashingUtils::HashString("ANATOMY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MEDICATION",
+          "MEDICAL_CONDITION",
+          "PROTECTED_HEALTH_INFORMATION",
+          "TEST_TREATMENT_PROCEDURE",
+          "ANATOMY",
+        };
 
         EntityType GetEntityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MEDICATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EntityType::MEDICATION;
-          }
-          else if (hashCode == MEDICAL_CONDITION_HASH)
-          {
-            return EntityType::MEDICAL_CONDITION;
-          }
-          else if (hashCode == PROTECTED_HEALTH_INFORMATION_HASH)
-          {
-            return EntityType::PROTECTED_HEALTH_INFORMATION;
-          }
-          else if (hashCode == TEST_TREATMENT_PROCEDURE_HASH)
-          {
-            return EntityType::TEST_TREATMENT_PROCEDURE;
-          }
-          else if (hashCode == ANATOMY_HASH)
-          {
-            return EntityType::ANATOMY;
+          case -1810909489:
+            if (name == "MEDICATION")
+            {
+              return EntityType::MEDICATION;
+            }
+            break;
+          case 71074989:
+            if (name == "MEDICAL_CONDITION")
+            {
+              return EntityType::MEDICAL_CONDITION;
+            }
+            break;
+          case 1159759866:
+            if (name == "PROTECTED_HEALTH_INFORMATION")
+            {
+              return EntityType::PROTECTED_HEALTH_INFORMATION;
+            }
+            break;
+          case -818785185:
+            if (name == "TEST_TREATMENT_PROCEDURE")
+            {
+              return EntityType::TEST_TREATMENT_PROCEDURE;
+            }
+            break;
+          case -146119397:
+            if (name == "ANATOMY")
+            {
+              return EntityType::ANATOMY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return EntityType::NOT_SET;
         }
 
-        Aws::String GetNameForEntityType(EntityType enumValue)
+        const char* GetNameForEntityTypeCStr(EntityType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EntityType::MEDICATION:
-            return "MEDICATION";
-          case EntityType::MEDICAL_CONDITION:
-            return "MEDICAL_CONDITION";
-          case EntityType::PROTECTED_HEALTH_INFORMATION:
-            return "PROTECTED_HEALTH_INFORMATION";
-          case EntityType::TEST_TREATMENT_PROCEDURE:
-            return "TEST_TREATMENT_PROCEDURE";
-          case EntityType::ANATOMY:
-            return "ANATOMY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEntityType(EntityType enumValue)
+        {
+          return GetNameForEntityTypeCStr(enumValue);
         }
 
       } // namespace EntityTypeMapper
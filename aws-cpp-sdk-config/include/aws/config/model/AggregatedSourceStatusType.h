@@ -36,6 +36,11 @@ namespace AggregatedSourceStatusTypeMapper
 AWS_CONFIGSERVICE_API AggregatedSourceStatusType GetAggregatedSourceStatusTypeForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForAggregatedSourceStatusType(AggregatedSourceStatusType value);
+
+/**
+ * Same as GetNameForAggregatedSourceStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForAggregatedSourceStatusTypeCStr(AggregatedSourceStatusType value);
 } // namespace AggregatedSourceStatusTypeMapper
 } // namespace Model
 } // namespace ConfigService
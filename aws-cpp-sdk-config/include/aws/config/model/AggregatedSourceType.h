@@ -35,6 +35,11 @@ namespace AggregatedSourceTypeMapper
 AWS_CONFIGSERVICE_API AggregatedSourceType GetAggregatedSourceTypeForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForAggregatedSourceType(AggregatedSourceType value);
+
+/**
+ * Same as GetNameForAggregatedSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForAggregatedSourceTypeCStr(AggregatedSourceType value);
 } // namespace AggregatedSourceTypeMapper
 } // namespace Model
 } // namespace ConfigService
@@ -35,6 +35,11 @@ namespace ChronologicalOrderMapper
 AWS_CONFIGSERVICE_API ChronologicalOrder GetChronologicalOrderForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForChronologicalOrder(ChronologicalOrder value);
+
+/**
+ * Same as GetNameForChronologicalOrder(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForChronologicalOrderCStr(ChronologicalOrder value);
 } // namespace ChronologicalOrderMapper
 } // namespace Model
 } // namespace ConfigService
@@ -37,6 +37,11 @@ namespace ComplianceTypeMapper
 AWS_CONFIGSERVICE_API ComplianceType GetComplianceTypeForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForComplianceType(ComplianceType value);
+
+/**
+ * Same as GetNameForComplianceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForComplianceTypeCStr(ComplianceType value);
 } // namespace ComplianceTypeMapper
 } // namespace Model
 } // namespace ConfigService
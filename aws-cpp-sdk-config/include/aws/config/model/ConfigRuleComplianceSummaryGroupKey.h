@@ -35,6 +35,11 @@ namespace ConfigRuleComplianceSummaryGroupKeyMapper
 AWS_CONFIGSERVICE_API ConfigRuleComplianceSummaryGroupKey GetConfigRuleComplianceSummaryGroupKeyForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForConfigRuleComplianceSummaryGroupKey(ConfigRuleComplianceSummaryGroupKey value);
+
+/**
+ * Same as GetNameForConfigRuleComplianceSummaryGroupKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForConfigRuleComplianceSummaryGroupKeyCStr(ConfigRuleComplianceSummaryGroupKey value);
 } // namespace ConfigRuleComplianceSummaryGroupKeyMapper
 } // namespace Model
 } // namespace ConfigService
@@ -37,6 +37,11 @@ namespace ConfigRuleStateMapper
 AWS_CONFIGSERVICE_API ConfigRuleState GetConfigRuleStateForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForConfigRuleState(ConfigRuleState value);
+
+/**
+ * Same as GetNameForConfigRuleState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForConfigRuleStateCStr(ConfigRuleState value);
 } // namespace ConfigRuleStateMapper
 } // namespace Model
 } // namespace ConfigService
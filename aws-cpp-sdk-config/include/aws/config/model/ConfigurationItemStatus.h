@@ -38,6 +38,11 @@ namespace ConfigurationItemStatusMapper
 AWS_CONFIGSERVICE_API ConfigurationItemStatus GetConfigurationItemStatusForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForConfigurationItemStatus(ConfigurationItemStatus value);
+
+/**
+ * Same as GetNameForConfigurationItemStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForConfigurationItemStatusCStr(ConfigurationItemStatus value);
 } // namespace ConfigurationItemStatusMapper
 } // namespace Model
 } // namespace ConfigService
@@ -36,6 +36,11 @@ namespace DeliveryStatusMapper
 AWS_CONFIGSERVICE_API DeliveryStatus GetDeliveryStatusForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForDeliveryStatus(DeliveryStatus value);
+
+/**
+ * Same as GetNameForDeliveryStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForDeliveryStatusCStr(DeliveryStatus value);
 } // namespace DeliveryStatusMapper
 } // namespace Model
 } // namespace ConfigService
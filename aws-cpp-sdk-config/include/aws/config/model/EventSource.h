@@ -34,6 +34,11 @@ namespace EventSourceMapper
 AWS_CONFIGSERVICE_API EventSource GetEventSourceForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForEventSource(EventSource value);
+
+/**
+ * Same as GetNameForEventSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForEventSourceCStr(EventSource value);
 } // namespace EventSourceMapper
 } // namespace Model
 } // namespace ConfigService
@@ -38,6 +38,11 @@ namespace MaximumExecutionFrequencyMapper
 AWS_CONFIGSERVICE_API MaximumExecutionFrequency GetMaximumExecutionFrequencyForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForMaximumExecutionFrequency(MaximumExecutionFrequency value);
+
+/**
+ * Same as GetNameForMaximumExecutionFrequency(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForMaximumExecutionFrequencyCStr(MaximumExecutionFrequency value);
 } // namespace MaximumExecutionFrequencyMapper
 } // namespace Model
 } // namespace ConfigService
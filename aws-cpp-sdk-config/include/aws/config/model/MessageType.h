@@ -37,6 +37,11 @@ namespace MessageTypeMapper
 AWS_CONFIGSERVICE_API MessageType GetMessageTypeForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForMessageType(MessageType value);
+
+/**
+ * Same as GetNameForMessageType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForMessageTypeCStr(MessageType value);
 } // namespace MessageTypeMapper
 } // namespace Model
 } // namespace ConfigService
@@ -35,6 +35,11 @@ namespace OwnerMapper
 AWS_CONFIGSERVICE_API Owner GetOwnerForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForOwner(Owner value);
+
+/**
+ * Same as GetNameForOwner(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForOwnerCStr(Owner value);
 } // namespace OwnerMapper
 } // namespace Model
 } // namespace ConfigService
@@ -36,6 +36,11 @@ namespace RecorderStatusMapper
 AWS_CONFIGSERVICE_API RecorderStatus GetRecorderStatusForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForRecorderStatus(RecorderStatus value);
+
+/**
+ * Same as GetNameForRecorderStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForRecorderStatusCStr(RecorderStatus value);
 } // namespace RecorderStatusMapper
 } // namespace Model
 } // namespace ConfigService
@@ -36,6 +36,11 @@ namespace ResourceCountGroupKeyMapper
 AWS_CONFIGSERVICE_API ResourceCountGroupKey GetResourceCountGroupKeyForName(const Aws::String& name);
 
 AWS_CONFIGSERVICE_API Aws::String GetNameForResourceCountGroupKey(ResourceCountGroupKey value);
+
+/**
+ * Same as GetNameForResourceCountGroupKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONFIGSERVICE_API const char* GetNameForResourceCountGroupKeyCStr(ResourceCountGroupKey value);
 } // namespace ResourceCountGroupKeyMapper
 } // namespace Model
 } // namespace ConfigService
@@ -30,25 +30,44 @@ namespace Aws
       namespace AggregatedSourceStatusTypeMapper
       {
 
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int OUTDATED_HASH = HashingUtils::HashString("OUTDATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FAILED",
+          "SUCCEEDED",
+          "OUTDATED",
+        };
 
         AggregatedSourceStatusType GetAggregatedSourceStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAILED_HASH)
-          {
-            return AggregatedSourceStatusType::FAILED;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AggregatedSourceStatusType::SUCCEEDED;
-          }
-          else if (hashCode == OUTDATED_HASH)
-          {
-            return AggregatedSourceStatusType::OUTDATED;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return AggregatedSourceStatusType::FAILED;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return AggregatedSourceStatusType::SUCCEEDED;
+            }
+            break;
+          case 841132008:
+            if (name == "OUTDATED")
+            {
+              return AggregatedSourceStatusType::OUTDATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AggregatedSourceStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForAggregatedSourceStatusType(AggregatedSourceStatusType enumValue)
+        const char* GetNameForAggregatedSourceStatusTypeCStr(AggregatedSourceStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AggregatedSourceStatusType::FAILED:
-            return "FAILED";
-          case AggregatedSourceStatusType::SUCCEEDED:
-            return "SUCCEEDED";
-          case AggregatedSourceStatusType::OUTDATED:
-            return "OUTDATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAggregatedSourceStatusType(AggregatedSourceStatusType enumValue)
+        {
+          return GetNameForAggregatedSourceStatusTypeCStr(enumValue);
         }
 
       } // namespace AggregatedSourceStatusTypeMapper
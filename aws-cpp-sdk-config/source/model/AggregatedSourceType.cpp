@@ -30,20 +30,37 @@ namespace Aws
       namespace AggregatedSourceTypeMapper
       {
 
-        static const int ACCOUNT_HASH = HashingUtils::HashString("ACCOUNT");
-        static const int ORGANIZATION_HASH = HashingUtils::HashString("ORGANIZATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCOUNT",
+          "ORGANIZATION",
+        };
 
         AggregatedSourceType GetAggregatedSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_HASH)
-          {
-            return AggregatedSourceType::ACCOUNT;
-          }
-          else if (hashCode == ORGANIZATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AggregatedSourceType::ORGANIZATION;
+          case -459336179:
+            if (name == "ACCOUNT")
+            {
+              return AggregatedSourceType::ACCOUNT;
+            }
+            break;
+          case -798763725:
+            if (name == "ORGANIZATION")
+            {
+              return AggregatedSourceType::ORGANIZATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AggregatedSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForAggregatedSourceType(AggregatedSourceType enumValue)
+        const char* GetNameForAggregatedSourceTypeCStr(AggregatedSourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AggregatedSourceType::ACCOUNT:
-            return "ACCOUNT";
-          case AggregatedSourceType::ORGANIZATION:
-            return "ORGANIZATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAggregatedSourceType(AggregatedSourceType enumValue)
+        {
+          return GetNameForAggregatedSourceTypeCStr(enumValue);
         }
 
       } // namespace AggregatedSourceTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ChronologicalOrderMapper
       {
 
-        static const int Reverse_HASH = HashingUtils::HashString("Reverse");
-        static const int Forward_HASH = HashingUtils::HashString("Forward");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Reverse",
+          "Forward",
+        };
 
         ChronologicalOrder GetChronologicalOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Reverse_HASH)
-          {
-            return ChronologicalOrder::Reverse;
-          }
-          else if (hashCode == Forward_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChronologicalOrder::Forward;
+          case -1530467646:
+            if (name == "Reverse")
+            {
+              return ChronologicalOrder::Reverse;
+            }
+            break;
+          case 987507365:
+            if (name == "Forward")
+            {
+              return ChronologicalOrder::Forward;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ChronologicalOrder::NOT_SET;
         }
 
-        Aws::String GetNameForChronologicalOrder(ChronologicalOrder enumValue)
+        const char* GetNameForChronologicalOrderCStr(ChronologicalOrder enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChronologicalOrder::Reverse:
-            return "Reverse";
-          case ChronologicalOrder::Forward:
-            return "Forward";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChronologicalOrder(ChronologicalOrder enumValue)
+        {
+          return GetNameForChronologicalOrderCStr(enumValue);
         }
 
       } // namespace ChronologicalOrderMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ComplianceTypeMapper
       {
 
-        static const int COMPLIANT_HASH = HashingUtils::HashString("COMPLIANT");
-        static const int NON_COMPLIANT_HASH = HashingUtils::HashString("NON_COMPLIANT");
-        static const int NOT_APPLICABLE_HASH = HashingUtils::HashString("NOT_APPLICABLE");
-        static const int INSUFFICIENT_DATA_HASH = HashingUtils::HashString("INSUFFICIENT_DATA");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COMPLIANT",
+          "NON_COMPLIANT",
+          "NOT_APPLICABLE",
+          "INSUFFICIENT_DATA",
+        };
 
         ComplianceType GetComplianceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLIANT_HASH)
-          {
-            return ComplianceType::COMPLIANT;
-          }
-          else if (hashCode == NON_COMPLIANT_HASH)
-          {
-            return ComplianceType::NON_COMPLIANT;
-          }
-          else if (hashCode == NOT_APPLICABLE_HASH)
-          {
-            return ComplianceType::NOT_APPLICABLE;
-          }
-          else if (hashCode == INSUFFICIENT_DATA_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComplianceType::INSUFFICIENT_DATA;
+          case 1383764347:
+            if (name == "COMPLIANT")
+            {
+              return ComplianceType::COMPLIANT;
+            }
+            break;
+          case 1663567465:
+            if (name == "NON_COMPLIANT")
+            {
+              return ComplianceType::NON_COMPLIANT;
+            }
+            break;
+          case 978028715:
+            if (name == "NOT_APPLICABLE")
+            {
+              return ComplianceType::NOT_APPLICABLE;
+            }
+            break;
+          case -1936956826:
+            if (name == "INSUFFICIENT_DATA")
+            {
+              return ComplianceType::INSUFFICIENT_DATA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ComplianceType::NOT_SET;
         }
 
-        Aws::String GetNameForComplianceType(ComplianceType enumValue)
+        const char* GetNameForComplianceTypeCStr(ComplianceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComplianceType::COMPLIANT:
-            return "COMPLIANT";
-          case ComplianceType::NON_COMPLIANT:
-            return "NON_COMPLIANT";
-          case ComplianceType::NOT_APPLICABLE:
-            return "NOT_APPLICABLE";
-          case ComplianceType::INSUFFICIENT_DATA:
-            return "INSUFFICIENT_DATA";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComplianceType(ComplianceType enumValue)
+        {
+          return GetNameForComplianceTypeCStr(enumValue);
         }
 
       } // namespace ComplianceTypeMapper
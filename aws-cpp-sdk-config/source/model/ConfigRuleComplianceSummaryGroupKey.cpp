@@ -30,20 +30,37 @@ namespace Aws
       namespace ConfigRuleComplianceSummaryGroupKeyMapper
       {
 
-        static const int ACCOUNT_ID_HASH = HashingUtils::HashString("ACCOUNT_ID");
-        static const int AWS_REGION_HASH = HashingUtils::HashString("AWS_REGION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCOUNT_ID",
+          "AWS_REGION",
+        };
 
         ConfigRuleComplianceSummaryGroupKey GetConfigRuleComplianceSummaryGroupKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_ID_HASH)
-          {
-            return ConfigRuleComplianceSummaryGroupKey::ACCOUNT_ID;
-          }
-          else if (hashCode == AWS_REGION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConfigRuleComplianceSummaryGroupKey::AWS_REGION;
+          case -318209907:
+            if (name == "ACCOUNT_ID")
+            {
+              return ConfigRuleComplianceSummaryGroupKey::ACCOUNT_ID;
+            }
+            break;
+          case 1228150422:
+            if (name == "AWS_REGION")
+            {
+              return ConfigRuleComplianceSummaryGroupKey::AWS_REGION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ConfigRuleComplianceSummaryGroupKey::NOT_SET;
         }
 
-        Aws::String GetNameForConfigRuleComplianceSummaryGroupKey(ConfigRuleComplianceSummaryGroupKey enumValue)
+        const char* GetNameForConfigRuleComplianceSummaryGroupKeyCStr(ConfigRuleComplianceSummaryGroupKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConfigRuleComplianceSummaryGroupKey::ACCOUNT_ID:
-            return "ACCOUNT_ID";
-          case ConfigRuleComplianceSummaryGroupKey::AWS_REGION:
-            return "AWS_REGION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConfigRuleComplianceSummaryGroupKey(ConfigRuleComplianceSummaryGroupKey enumValue)
+        {
+          return GetNameForConfigRuleComplianceSummaryGroupKeyCStr(enumValue);
         }
 
       } // namespace ConfigRuleComplianceSummaryGroupKeyMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ConfigRuleStateMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETING_RESULTS_HASH = HashingUtils::HashString("DELETING_RESULTS");
-        static const int EVALUATING_HASH = HashingUtils::HashString("EVALUATING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "DELETING",
+          "DELETING_RESULTS",
+          "EVALUATING",
+        };
 
         ConfigRuleState GetConfigRuleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return ConfigRuleState::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ConfigRuleState::DELETING;
-          }
-          else if (hashCode == DELETING_RESULTS_HASH)
-          {
-            return ConfigRuleState::DELETING_RESULTS;
-          }
-          else if (hashCode == EVALUATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConfigRuleState::EVALUATING;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ConfigRuleState::ACTIVE;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ConfigRuleState::DELETING;
+            }
+            break;
+          case -72476097:
+            if (name == "DELETING_RESULTS")
+            {
+              return ConfigRuleState::DELETING_RESULTS;
+            }
+            break;
+          case 1343615766:
+            if (name == "EVALUATING")
+            {
+              return ConfigRuleState::EVALUATING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ConfigRuleState::NOT_SET;
         }
 
-        Aws::String GetNameForConfigRuleState(ConfigRuleState enumValue)
+        const char* GetNameForConfigRuleStateCStr(ConfigRuleState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConfigRuleState::ACTIVE:
-            return "ACTIVE";
-          case ConfigRuleState::DELETING:
-            return "DELETING";
-          case ConfigRuleState::DELETING_RESULTS:
-            return "DELETING_RESULTS";
-          case ConfigRuleState::EVALUATING:
-            return "EVALUATING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConfigRuleState(ConfigRuleState enumValue)
+        {
+          return GetNameForConfigRuleStateCStr(enumValue);
         }
 
       } // namespace ConfigRuleStateMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ConfigurationItemStatusMapper
       {
 
-        static const int OK_HASH = HashingUtils::HashString("OK");
-        static const int ResourceDiscovered_HASH = HashingUtils::HashString("ResourceDiscovered");
-        static const int ResourceNotRecorded_HASH = HashingUtils::HashString("ResourceNotRecorded");
-        static const int ResourceDeleted_HASH = HashingUtils::HashString("ResourceDeleted");
-        static const int ResourceDeletedNotRecorded_HASH = HashingUtils::HashString("ResourceDeletedNotRecorded");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OK",
+          "ResourceDiscovered",
+          "ResourceNotRecorded",
+          "ResourceDeleted",
+          "ResourceDeletedNotRecorded",
+        };
 
         ConfigurationItemStatus GetConfigurationItemStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConfigurationItemStatus::OK;
-          }
-          else if (hashCode == ResourceDiscovered_HASH)
-          {
-            return ConfigurationItemStatus::ResourceDiscovered;
-          }
-          else if (hashCode == ResourceNotRecorded_HASH)
-          {
-            return ConfigurationItemStatus::ResourceNotRecorded;
-          }
-          else if (hashCode == ResourceDeleted_HASH)
-          {
-            return ConfigurationItemStatus::ResourceDeleted;
-          }
-          else if (hashCode == ResourceDeletedNotRecorded_HASH)
-          {
-            return ConfigurationItemStatus::ResourceDeletedNotRecorded;
+          case 2524:
+            if (name == "OK")
+            {
+              return ConfigurationItemStatus::OK;
+            }
+            break;
+          case -739749610:
+            if (name == "ResourceDiscovered")
+            {
+              return ConfigurationItemStatus::ResourceDiscovered;
+            }
+            break;
+          case -1321440363:
+            if (name == "ResourceNotRecorded")
+            {
+              return ConfigurationItemStatus::ResourceNotRecorded;
+            }
+            break;
+          case 1188409355:
+            if (name == "ResourceDeleted")
+            {
+              return ConfigurationItemStatus::ResourceDeleted;
+            }
+            break;
+          case 1428047768:
+            if (name == "ResourceDeletedNotRecorded")
+            {
+              return ConfigurationItemStatus::ResourceDeletedNotRecorded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ConfigurationItemStatus::NOT_SET;
         }
 
-        Aws::String GetNameForConfigurationItemStatus(ConfigurationItemStatus enumValue)
+        const char* GetNameForConfigurationItemStatusCStr(ConfigurationItemStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConfigurationItemStatus::OK:
-            return "OK";
-          case ConfigurationItemStatus::ResourceDiscovered:
-            return "ResourceDiscovered";
-          case ConfigurationItemStatus::ResourceNotRecorded:
-            return "ResourceNotRecorded";
-          case ConfigurationItemStatus::ResourceDeleted:
-            return "ResourceDeleted";
-          case ConfigurationItemStatus::ResourceDeletedNotRecorded:
-            return "ResourceDeletedNotRecorded";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConfigurationItemStatus(ConfigurationItemStatus enumValue)
+        {
+          return GetNameForConfigurationItemStatusCStr(enumValue);
         }
 
       } // namespace ConfigurationItemStatusMapper
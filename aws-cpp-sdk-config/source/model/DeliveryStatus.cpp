@@ -30,25 +30,44 @@ namespace Aws
       namespace DeliveryStatusMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failure_HASH = HashingUtils::HashString("Failure");
-        static const int Not_Applicable_HASH = HashingUtils::HashString("Not_Applicable");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Success",
+          "Failure",
+          "Not_Applicable",
+        };
 
         DeliveryStatus GetDeliveryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
-          {
-            return DeliveryStatus::Success;
-          }
-          else if (hashCode == Failure_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeliveryStatus::Failure;
-          }
-          else if (hashCode == Not_Applicable_HASH)
-          {
-            return DeliveryStatus::Not_Applicable;
+          case -202516509:
+            if (name == "Success")
+            {
+              return DeliveryStatus::Success;
+            }
+            break;
+          case 578079082:
+            if (name == "Failure")
+            {
+              return DeliveryStatus::Failure;
+            }
+            break;
+          case 1523119307:
+            if (name == "Not_Applicable")
+            {
+              return DeliveryStatus::Not_Applicable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DeliveryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeliveryStatus(DeliveryStatus enumValue)
+        const char* GetNameForDeliveryStatusCStr(DeliveryStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeliveryStatus::Success:
-            return "Success";
-          case DeliveryStatus::Failure:
-            return "Failure";
-          case DeliveryStatus::Not_Applicable:
-            return "Not_Applicable";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeliveryStatus(DeliveryStatus enumValue)
+        {
+          return GetNameForDeliveryStatusCStr(enumValue);
         }
 
       } // namespace DeliveryStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace EventSourceMapper
       {
 
-        static const int aws_config_HASH = HashingUtils::HashString("aws.config");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "aws.config",
+        };
 
         EventSource GetEventSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_config_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventSource::aws_config;
+          case 1449707347:
+            if (name == "aws.config")
+            {
+              return EventSource::aws_config;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return EventSource::NOT_SET;
         }
 
-        Aws::String GetNameForEventSource(EventSource enumValue)
+        const char* GetNameForEventSourceCStr(EventSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventSource::aws_config:
-            return "aws.config";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventSource(EventSource enumValue)
+        {
+          return GetNameForEventSourceCStr(enumValue);
         }
 
       } // namespace EventSourceMapper
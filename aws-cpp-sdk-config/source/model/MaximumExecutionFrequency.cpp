@@ -30,35 +30,58 @@ namespace Aws
       namespace MaximumExecutionFrequencyMapper
       {
 
-        static const int One_Hour_HASH = HashingUtils::HashString("One_Hour");
-        static const int Three_Hours_HASH = HashingUtils::HashString("Three_Hours");
-        static const int Six_Hours_HASH = HashingUtils::HashString("Six_Hours");
-        static const int Twelve_Hours_HASH = HashingUtils::HashString("Twelve_Hours");
-        static const int TwentyFour_Hours_HASH = HashingUtils::HashString("TwentyFour_Hours");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "One_Hour",
+          "Three_Hours",
+          "Six_Hours",
+          "Twelve_Hours",
+          "TwentyFour_Hours",
+        };
 
         MaximumExecutionFrequency GetMaximumExecutionFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == One_Hour_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MaximumExecutionFrequency::One_Hour;
-          }
-          else if (hashCode == Three_Hours_HASH)
-          {
-            return MaximumExecutionFrequency::Three_Hours;
-          }
-          else if (hashCode == Six_Hours_HASH)
-          {
-            return MaximumExecutionFrequency::Six_Hours;
-          }
-          else if (hashCode == Twelve_Hours_HASH)
-          {
-            return MaximumExecutionFrequency::Twelve_Hours;
-          }
-          else if (hashCode == TwentyFour_Hours_HASH)
-          {
-            return MaximumExecutionFrequency::TwentyFour_Hours;
+          case 2065754205:
+            if (name == "One_Hour")
+            {
+              return MaximumExecutionFrequency::One_Hour;
+            }
+            break;
+          case -1605543698:
+            if (name == "Three_Hours")
+            {
+              return MaximumExecutionFrequency::Three_Hours;
+            }
+            break;
+          case 532571442:
+            if (name == "Six_Hours")
+            {
+              return MaximumExecutionFrequency::Six_Hours;
+            }
+            break;
+          case 291052009:
+            if (name == "Twelve_Hours")
+            {
+              return MaximumExecutionFrequency::Twelve_Hours;
+            }
+            break;
+          case 45622151:
+            if (name == "TwentyFour_Hours")
+            {
+              return MaximumExecutionFrequency::TwentyFour_Hours;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return MaximumExecutionFrequency::NOT_SET;
         }
 
-        Aws::String GetNameForMaximumExecutionFrequency(MaximumExecutionFrequency enumValue)
+        const char* GetNameForMaximumExecutionFrequencyCStr(MaximumExecutionFrequency enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MaximumExecutionFrequency::One_Hour:
-            return "One_Hour";
-          case MaximumExecutionFrequency::Three_Hours:
-            return "Three_Hours";
-          case MaximumExecutionFrequency::Six_Hours:
-            return "Six_Hours";
-          case MaximumExecutionFrequency::Twelve_Hours:
-            return "Twelve_Hours";
-          case MaximumExecutionFrequency::TwentyFour_Hours:
-            return "TwentyFour_Hours";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMaximumExecutionFrequency(MaximumExecutionFrequency enumValue)
+        {
+          return GetNameForMaximumExecutionFrequencyCStr(enumValue);
         }
 
       } // namespace MaximumExecutionFrequencyMapper
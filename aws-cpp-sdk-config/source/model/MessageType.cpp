@@ -30,30 +30,51 @@ namespace Aws
       namespace MessageTypeMapper
       {
 
-        static const int ConfigurationItemChangeNotification_HASH = HashingUtils::HashString("ConfigurationItemChangeNotification");
-        static const int ConfigurationSnapshotDeliveryCompleted_HASH = HashingUtils::HashString("ConfigurationSnapshotDeliveryCompleted");
-        static const int ScheduledNotification_HASH = HashingUtils::HashString("ScheduledNotification");
-        static const int OversizedConfigurationItemChangeNotification_HASH = HashingUtils::HashString("OversizedConfigurationItemChangeNotification");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ConfigurationItemChangeNotification",
+          "ConfigurationSnapshotDeliveryCompleted",
+          "ScheduledNotification",
+          "OversizedConfigurationItemChangeNotification",
+        };
 
         MessageType GetMessageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ConfigurationItemChangeNotification_HASH)
-          {
-            return MessageType::ConfigurationItemChangeNotification;
-          }
-          else if (hashCode == ConfigurationSnapshotDeliveryCompleted_HASH)
-          {
-            return MessageType::ConfigurationSnapshotDeliveryCompleted;
-          }
-          else if (hashCode == ScheduledNotification_HASH)
-          {
-            return MessageType::ScheduledNotification;
-          }
-          else if (hashCode == OversizedConfigurationItemChangeNotification_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MessageType::OversizedConfigurationItemChangeNotification;
+          case 498929060:
+            if (name == "ConfigurationItemChangeNotification")
+            {
+              return MessageType::ConfigurationItemChangeNotification;
+            }
+            break;
+          case -1988423907:
+            if (name == "ConfigurationSnapshotDeliveryCompleted")
+            {
+              return MessageType::ConfigurationSnapshotDeliveryCompleted;
+            }
+            break;
+          case -1149349352:
+            if (name == "ScheduledNotification")
+            {
+              return MessageType::ScheduledNotification;
+            }
+            break;
+          case -1707379915:
+            if (name == "OversizedConfigurationItemChangeNotification")
+            {
+              return MessageType::OversizedConfigurationItemChangeNotification;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return MessageType::NOT_SET;
         }
 
-        Aws::String GetNameForMessageType(MessageType enumValue)
+        const char* GetNameForMessageTypeCStr(MessageType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MessageType::ConfigurationItemChangeNotification:
-            return "ConfigurationItemChangeNotification";
-          case MessageType::ConfigurationSnapshotDeliveryCompleted:
-            return "ConfigurationSnapshotDeliveryCompleted";
-          case MessageType::ScheduledNotification:
-            return "ScheduledNotification";
-          case MessageType::OversizedConfigurationItemChangeNotification:
-            return "OversizedConfigurationItemChangeNotification";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMessageType(MessageType enumValue)
+        {
+          return GetNameForMessageTypeCStr(enumValue);
         }
 
       } // namespace MessageTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace OwnerMapper
       {
 
-        static const int CUSTOM_LAMBDA_HASH = HashingUtils::HashString("CUSTOM_LAMBDA");
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CUSTOM_LAMBDA",
+          "AWS",
+        };
 
         Owner GetOwnerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CUSTOM_LAMBDA_HASH)
-          {
-            return Owner::CUSTOM_LAMBDA;
-          }
-          else if (hashCode == AWS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Owner::AWS;
+          case -1892240299:
+            if (name == "CUSTOM_LAMBDA")
+            {
+              return Owner::CUSTOM_LAMBDA;
+            }
+            break;
+          case 65245:
+            if (name == "AWS")
+            {
+              return Owner::AWS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Owner::NOT_SET;
         }
 
-        Aws::String GetNameForOwner(Owner enumValue)
+        const char* GetNameForOwnerCStr(Owner enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Owner::CUSTOM_LAMBDA:
-            return "CUSTOM_LAMBDA";
-          case Owner::AWS:
-            return "AWS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOwner(Owner enumValue)
+        {
+          return GetNameForOwnerCStr(enumValue);
         }
 
       } // namespace OwnerMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace RecorderStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failure_HASH = HashingUtils::HashString("Failure");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "Success",
+          "Failure",
+        };
 
         RecorderStatus GetRecorderStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return RecorderStatus::Pending;
-          }
-          else if (hashCode == Success_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RecorderStatus::Success;
-          }
-          else if (hashCode == Failure_HASH)
-          {
-            return RecorderStatus::Failure;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return RecorderStatus::Pending;
+            }
+            break;
+          case -202516509:
+            if (name == "Success")
+            {
+              return RecorderStatus::Success;
+            }
+            break;
+          case 578079082:
+            if (name == "Failure")
+            {
+              return RecorderStatus::Failure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RecorderStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRecorderStatus(RecorderStatus enumValue)
+        const char* GetNameForRecorderStatusCStr(RecorderStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RecorderStatus::Pending:
-            return "Pending";
-          case RecorderStatus::Success:
-            return "Success";
-          case RecorderStatus::Failure:
-            return "Failure";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRecorderStatus(RecorderStatus enumValue)
+        {
+          return GetNameForRecorderStatusCStr(enumValue);
         }
 
       } // namespace RecorderStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ResourceCountGroupKeyMapper
       {
 
-        static const int RESOURCE_TYPE_HASH = HashingUtils::HashString("RESOURCE_TYPE");
-        static const int ACCOUNT_ID_HASH = HashingUtils::HashString("ACCOUNT_ID");
-        static const int AWS_REGION_HASH = HashingUtils::HashString("AWS_REGION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RESOURCE_TYPE",
+          "ACCOUNT_ID",
+          "AWS_REGION",
+        };
 
         ResourceCountGroupKey GetResourceCountGroupKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RESOURCE_TYPE_HASH)
-          {
-            return ResourceCountGroupKey::RESOURCE_TYPE;
-          }
-          else if (hashCode == ACCOUNT_ID_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceCountGroupKey::ACCOUNT_ID;
-          }
-          else if (hashCode == AWS_REGION_HASH)
-          {
-            return ResourceCountGroupKey::AWS_REGION;
+          case -169548597:
+            if (name == "RESOURCE_TYPE")
+            {
+              return ResourceCountGroupKey::RESOURCE_TYPE;
+            }
+            break;
+          case -318209907:
+            if (name == "ACCOUNT_ID")
+            {
+              return ResourceCountGroupKey::ACCOUNT_ID;
+            }
+            break;
+          case 1228150422:
+            if (name == "AWS_REGION")
+            {
+              return ResourceCountGroupKey::AWS_REGION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ResourceCountGroupKey::NOT_SET;
         }
 
-        Aws::String GetNameForResourceCountGroupKey(ResourceCountGroupKey enumValue)
+        const char* GetNameForResourceCountGroupKeyCStr(ResourceCountGroupKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceCountGroupKey::RESOURCE_TYPE:
-            return "RESOURCE_TYPE";
-          case ResourceCountGroupKey::ACCOUNT_ID:
-            return "ACCOUNT_ID";
-          case ResourceCountGroupKey::AWS_REGION:
-            return "AWS_REGION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceCountGroupKey(ResourceCountGroupKey enumValue)
+        {
+          return GetNameForResourceCountGroupKeyCStr(enumValue);
         }
 
       } // namespace ResourceCountGroupKeyMapper
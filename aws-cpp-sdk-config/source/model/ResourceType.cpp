@@ -30,330 +30,471 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int AWS_EC2_CustomerGateway_HASH = HashingUtils::HashString("AWS::EC2::CustomerGateway");
-        static const int AWS_EC2_EIP_HASH = HashingUtils::HashString("AWS::EC2::EIP");
-        static const int AWS_EC2_Host_HASH = HashingUtils::HashString("AWS::EC2::Host");
-        static const int AWS_EC2_Instance_HASH = HashingUtils::HashString("AWS::EC2::Instance");
-        static const int AWS_EC2_InternetGateway_HASH = HashingUtils::HashString("AWS::EC2::InternetGateway");
-        static const int AWS_EC2_NetworkAcl_HASH = HashingUtils::HashString("AWS::EC2::NetworkAcl");
-        static const int AWS_EC2_NetworkInterface_HASH = HashingUtils::HashString("AWS::EC2::NetworkInterface");
-        static const int AWS_EC2_RouteTable_HASH = HashingUtils::HashString("AWS::EC2::RouteTable");
-        static const int AWS_EC2_SecurityGroup_HASH = HashingUtils::HashString("AWS::EC2::SecurityGroup");
-        static const int AWS_EC2_Subnet_HASH = HashingUtils::HashString("AWS::EC2::Subnet");
-        static const int AWS_CloudTrail_Trail_HASH = HashingUtils::HashString("AWS::CloudTrail::Trail");
-        static const int AWS_EC2_Volume_HASH = HashingUtils::HashString("AWS::EC2::Volume");
-        static const int AWS_EC2_VPC_HASH = HashingUtils::HashString("AWS::EC2::VPC");
-        static const int AWS_EC2_VPNConnection_HASH = HashingUtils::HashString("AWS::EC2::VPNConnection");
-        static const int AWS_EC2_VPNGateway_HASH = HashingUtils::HashString("AWS::EC2::VPNGateway");
-        static const int AWS_IAM_Group_HASH = HashingUtils::HashString("AWS::IAM::Group");
-        static const int AWS_IAM_Policy_HASH = HashingUtils::HashString("AWS::IAM::Policy");
-        static const int AWS_IAM_Role_HASH = HashingUtils::HashString("AWS::IAM::Role");
-        static const int AWS_IAM_User_HASH = HashingUtils::HashString("AWS::IAM::User");
-        static const int AWS_ACM_Certificate_HASH = HashingUtils::HashString("AWS::ACM::Certificate");
-        static const int AWS_RDS_DBInstance_HASH = HashingUtils::HashString("AWS::RDS::DBInstance");
-        static const int AWS_RDS_DBSubnetGroup_HASH = HashingUtils::HashString("AWS::RDS::DBSubnetGroup");
-        static const int AWS_RDS_DBSecurityGroup_HASH = HashingUtils::HashString("AWS::RDS::DBSecurityGroup");
-        static const int AWS_RDS_DBSnapshot_HASH = HashingUtils::HashString("AWS::RDS::DBSnapshot");
-        static const int AWS_RDS_EventSubscription_HASH = HashingUtils::HashString("AWS::RDS::EventSubscription");
-        static const int AWS_ElasticLoadBalancingV2_LoadBalancer_HASH = HashingUtils::HashString("AWS::ElasticLoadBalancingV2::LoadBalancer");
-        static const int AWS_S3_Bucket_HASH = HashingUtils::HashString("AWS::S3::Bucket");
-        static const int AWS_SSM_ManagedInstanceInventory_HASH = HashingUtils::HashString("AWS::SSM::ManagedInstanceInventory");
-        static const int AWS_Redshift_Cluster_HASH = HashingUtils::HashString("AWS::Redshift::Cluster");
-        static const int AWS_Redshift_ClusterSnapshot_HASH = HashingUtils::HashString("AWS::Redshift::ClusterSnapshot");
-        static const int AWS_Redshift_ClusterParameterGroup_HASH = HashingUtils::HashString("AWS::Redshift::ClusterParameterGroup");
-        static const int AWS_Redshift_ClusterSecurityGroup_HASH = HashingUtils::HashString("AWS::Redshift::ClusterSecurityGroup");
-        static const int AWS_Redshift_ClusterSubnetGroup_HASH = HashingUtils::HashString("AWS::Redshift::ClusterSubnetGroup");
-        static const int AWS_Redshift_EventSubscription_HASH = HashingUtils::HashString("AWS::Redshift::EventSubscription");
-        static const int AWS_CloudWatch_Alarm_HASH = HashingUtils::HashString("AWS::CloudWatch::Alarm");
-        static const int AWS_CloudFormation_Stack_HASH = HashingUtils::HashString("AWS::CloudFormation::Stack");
-        static const int AWS_DynamoDB_Table_HASH = HashingUtils::HashString("AWS::DynamoDB::Table");
-        static const int AWS_AutoScaling_AutoScalingGroup_HASH = HashingUtils::HashString("AWS::AutoScaling::AutoScalingGroup");
-        static const int AWS_AutoScaling_LaunchConfiguration_HASH = HashingUtils::HashString("AWS::AutoScaling::LaunchConfiguration");
-        static const int AWS_AutoScaling_ScalingPolicy_HASH = HashingUtils::HashString("AWS::AutoScaling::ScalingPolicy");
-        static const int AWS_AutoScaling_ScheduledAction_HASH = HashingUtils::HashString("AWS::AutoScaling::ScheduledAction");
-        static const int AWS_CodeBuild_Project_HASH = HashingUtils::HashString("AWS::CodeBuild::Project");
-        static const int AWS_WAF_RateBasedRule_HASH = HashingUtils::HashString("AWS::WAF::RateBasedRule");
-        static const int AWS_WAF_Rule_HASH = HashingUtils::HashString("AWS::WAF::Rule");
-        static const int AWS_WAF_WebACL_HASH = HashingUtils::HashString("AWS::WAF::WebACL");
-        static const int AWS_WAFRegional_RateBasedRule_HASH = HashingUtils::HashString("AWS::WAFRegional::RateBasedRule");
-        static const int AWS_WAFRegional_Rule_HASH = HashingUtils::HashString("AWS::WAFRegional::Rule");
-        static const int AWS_WAFRegional_WebACL_HASH = HashingUtils::HashString("AWS::WAFRegional::WebACL");
-        static const int AWS_CloudFront_Distribution_HASH = HashingUtils::HashString("AWS::CloudFront::Distribution");
-        static const int AWS_CloudFront_StreamingDistribution_HASH = HashingUtils::HashString("AWS::CloudFront::StreamingDistribution");
-        static const int AWS_WAF_RuleGroup_HASH = HashingUtils::HashString("AWS::WAF::RuleGroup");
-        static const int AWS_WAFRegional_RuleGroup_HASH = HashingUtils::HashString("AWS::WAFRegional::RuleGroup");
-        static const int AWS_Lambda_Function_HASH = HashingUtils::HashString("AWS::Lambda::Function");
-        static const int AWS_ElasticBeanstalk_Application_HASH = HashingUtils::HashString("AWS::ElasticBeanstalk::Application");
-        static const int AWS_ElasticBeanstalk_ApplicationVersion_HASH = HashingUtils::HashString("AWS::ElasticBeanstalk::ApplicationVersion");
-        static const int AWS_ElasticBeanstalk_Environment_HASH = HashingUtils::HashString("AWS::ElasticBeanstalk::Environment");
-        static const int AWS_ElasticLoadBalancing_LoadBalancer_HASH = HashingUtils::HashString("AWS::ElasticLoadBalancing::LoadBalancer");
-        static const int AWS_XRay_EncryptionConfig_HASH = HashingUtils::HashString("AWS::XRay::EncryptionConfig");
-        static const int AWS_SSM_AssociationCompliance_HASH = HashingUtils::HashString("AWS::SSM::AssociationCompliance");
-        static const int AWS_SSM_PatchCompliance_HASH = HashingUtils::HashString("AWS::SSM::PatchCompliance");
-        static const int AWS_Shield_Protection_HASH = HashingUtils::HashString("AWS::Shield::Protection");
-        static const int AWS_ShieldRegional_Protection_HASH = HashingUtils::HashString("AWS::ShieldRegional::Protection");
-        static const int AWS_Config_ResourceCompliance_HASH = HashingUtils::HashString("AWS::Config::ResourceCompliance");
-        static const int AWS_CodePipeline_Pipeline_HASH = HashingUtils::HashString("AWS::CodePipeline::Pipeline");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AWS::EC2::CustomerGateway",
+          "AWS::EC2::EIP",
+          "AWS::EC2::Host",
+          "AWS::EC2::Instance",
+          "AWS::EC2::InternetGateway",
+          "AWS::EC2::NetworkAcl",
+          "AWS::EC2::NetworkInterface",
+          "AWS::EC2::RouteTable",
+          "AWS::EC2::SecurityGroup",
+          "AWS::EC2::Subnet",
+          "AWS::CloudTrail::Trail",
+          "AWS::EC2::Volume",
+          "AWS::EC2::VPC",
+          "AWS::EC2::VPNConnection",
+          "AWS::EC2::VPNGateway",
+          "AWS::IAM::Group",
+          "AWS::IAM::Policy",
+          "AWS::IAM::Role",
+          "AWS::IAM::User",
+          "AWS::ACM::Certificate",
+          "AWS::RDS::DBInstance",
+          "AWS::RDS::DBSubnetGroup",
+          "AWS::RDS::DBSecurityGroup",
+          "AWS::RDS::DBSnapshot",
+          "AWS::RDS::EventSubscription",
+          "AWS::ElasticLoadBalancingV2::LoadBalancer",
+          "AWS::S3::Bucket",
+          "AWS::SSM::ManagedInstanceInventory",
+          "AWS::Redshift::Cluster",
+          "AWS::Redshift::ClusterSnapshot",
+          "AWS::Redshift::ClusterParameterGroup",
+          "AWS::Redshift::ClusterSecurityGroup",
+          "AWS::Redshift::ClusterSubnetGroup",
+          "AWS::Redshift::EventSubscription",
+          "AWS::CloudWatch::Alarm",
+          "AWS::CloudFormation::Stack",
+          "AWS::DynamoDB::Table",
+          "AWS::AutoScaling::AutoScalingGroup",
+          "AWS::AutoScaling::LaunchConfiguration",
+          "AWS::AutoScaling::ScalingPolicy",
+          "AWS::AutoScaling::ScheduledAction",
+          "AWS::CodeBuild::Project",
+          "AWS::WAF::RateBasedRule",
+          "AWS::WAF::Rule",
+          "AWS::WAF::WebACL",
+          "AWS::WAFRegional::RateBasedRule",
+          "AWS::WAFRegional::Rule",
+          "AWS::WAFRegional::WebACL",
+          "AWS::CloudFront::Distribution",
+          "AWS::CloudFront::StreamingDistribution",
+          "AWS::WAF::RuleGroup",
+          "AWS::WAFRegional::RuleGroup",
+          "AWS::Lambda::Function",
+          "AWS::ElasticBeanstalk::Application",
+          "AWS::ElasticBeanstalk::ApplicationVersion",
+          "AWS::ElasticBeanstalk::Environment",
+          "AWS::ElasticLoadBalancing::LoadBalancer",
+          "AWS::XRay::EncryptionConfig",
+          "AWS::SSM::AssociationCompliance",
+          "AWS::SSM::PatchCompliance",
+          "AWS::Shield::Protection",
+          "AWS::ShieldRegional::Protection",
+          "AWS::Config::ResourceCompliance",
+          "AWS::CodePipeline::Pipeline",
+        };
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_EC2_CustomerGateway_HASH)
-          {
-            return ResourceType::AWS_EC2_CustomerGateway;
-          }
-          else if (hashCode == AWS_EC2_EIP_HASH)
-          {
-            return ResourceType::AWS_EC2_EIP;
-          }
-          else if (hashCode == AWS_EC2_Host_HASH)
-          {
-            return ResourceType::AWS_EC2_Host;
-          }
-          else if (hashCode == AWS_EC2_Instance_HASH)
-          {
-            return ResourceType::AWS_EC2_Instance;
-          }
-          else if (hashCode == AWS_EC2_InternetGateway_HASH)
-          {
-            return ResourceType::AWS_EC2_InternetGateway;
-          }
-          else if (hashCode == AWS_EC2_NetworkAcl_HASH)
-          {
-            return ResourceType::AWS_EC2_NetworkAcl;
-          }
-          else if (hashCode == AWS_EC2_NetworkInterface_HASH)
-          {
-            return ResourceType::AWS_EC2_NetworkInterface;
-          }
-          else if (hashCode == AWS_EC2_RouteTable_HASH)
-          {
-            return ResourceType::AWS_EC2_RouteTable;
-          }
-          else if (hashCode == AWS_EC2_SecurityGroup_HASH)
-          {
-            return ResourceType::AWS_EC2_SecurityGroup;
-          }
-          else if (hashCode == AWS_EC2_Subnet_HASH)
-          {
-            return ResourceType::AWS_EC2_Subnet;
-          }
-          else if (hashCode == AWS_CloudTrail_Trail_HASH)
-          {
-            return ResourceType::AWS_CloudTrail_Trail;
-          }
-          else if (hashCode == AWS_EC2_Volume_HASH)
-          {
-            return ResourceType::AWS_EC2_Volume;
-          }
-          else if (hashCode == AWS_EC2_VPC_HASH)
-          {
-            return ResourceType::AWS_EC2_VPC;
-          }
-          else if (hashCode == AWS_EC2_VPNConnection_HASH)
-          {
-            return ResourceType::AWS_EC2_VPNConnection;
-          }
-          else if (hashCode == AWS_EC2_VPNGateway_HASH)
-          {
-            return ResourceType::AWS_EC2_VPNGateway;
-          }
-          else if (hashCode == AWS_IAM_Group_HASH)
-          {
-            return ResourceType::AWS_IAM_Group;
-          }
-          else if (hashCode == AWS_IAM_Policy_HASH)
-          {
-            return ResourceType::AWS_IAM_Policy;
-          }
-          else if (hashCode == AWS_IAM_Role_HASH)
-          {
-            return ResourceType::AWS_IAM_Role;
-          }
-          else if (hashCode == AWS_IAM_User_HASH)
-          {
-            return ResourceType::AWS_IAM_User;
-          }
-          else if (hashCode == AWS_ACM_Certificate_HASH)
-          {
-            return ResourceType::AWS_ACM_Certificate;
-          }
-          else if (hashCode == AWS_RDS_DBInstance_HASH)
-          {
-            return ResourceType::AWS_RDS_DBInstance;
-          }
-          else if (hashCode == AWS_RDS_DBSubnetGroup_HASH)
-          {
-            return ResourceType::AWS_RDS_DBSubnetGroup;
-          }
-          else if (hashCode == AWS_RDS_DBSecurityGroup_HASH)
-          {
-            return ResourceType::AWS_RDS_DBSecurityGroup;
-          }
-          else if (hashCode == AWS_RDS_DBSnapshot_HASH)
-          {
-            return ResourceType::AWS_RDS_DBSnapshot;
-          }
-          else if (hashCode == AWS_RDS_EventSubscription_HASH)
-          {
-            return ResourceType::AWS_RDS_EventSubscription;
-          }
-          else if (hashCode == AWS_ElasticLoadBalancingV2_LoadBalancer_HASH)
-          {
-            return ResourceType::AWS_ElasticLoadBalancingV2_LoadBalancer;
-          }
-          else if (hashCode == AWS_S3_Bucket_HASH)
-          {
-            return ResourceType::AWS_S3_Bucket;
-          }
-          else if (hashCode == AWS_SSM_ManagedInstanceInventory_HASH)
-          {
-            return ResourceType::AWS_SSM_ManagedInstanceInventory;
-          }
-          else if (hashCode == AWS_Redshift_Cluster_HASH)
-          {
-            return ResourceType::AWS_Redshift_Cluster;
-          }
-          else if (hashCode == AWS_Redshift_ClusterSnapshot_HASH)
-          {
-            return ResourceType::AWS_Redshift_ClusterSnapshot;
-          }
-          else if (hashCode == AWS_Redshift_ClusterParameterGroup_HASH)
-          {
-            return ResourceType::AWS_Redshift_ClusterParameterGroup;
-          }
-          else if (hashCode == AWS_Redshift_ClusterSecurityGroup_HASH)
-          {
-            return ResourceType::AWS_Redshift_ClusterSecurityGroup;
-          }
-          else if (hashCode == AWS_Redshift_ClusterSubnetGroup_HASH)
-          {
-            return ResourceType::AWS_Redshift_ClusterSubnetGroup;
-          }
-          else if (hashCode == AWS_Redshift_EventSubscription_HASH)
-          {
-            return ResourceType::AWS_Redshift_EventSubscription;
-          }
-          else if (hashCode == AWS_CloudWatch_Alarm_HASH)
-          {
-            return ResourceType::AWS_CloudWatch_Alarm;
-          }
-          else if (hashCode == AWS_CloudFormation_Stack_HASH)
-          {
-            return ResourceType::AWS_CloudFormation_Stack;
-          }
-          else if (hashCode == AWS_DynamoDB_Table_HASH)
-          {
-            return ResourceType::AWS_DynamoDB_Table;
-          }
-          else if (hashCode == AWS_AutoScaling_AutoScalingGroup_HASH)
-          {
-            return ResourceType::AWS_AutoScaling_AutoScalingGroup;
-          }
-          else if (hashCode == AWS_AutoScaling_LaunchConfiguration_HASH)
-          {
-            return ResourceType::AWS_AutoScaling_LaunchConfiguration;
-          }
-          else if (hashCode == AWS_AutoScaling_ScalingPolicy_HASH)
-          {
-            return ResourceType::AWS_AutoScaling_ScalingPolicy;
-          }
-          else if (hashCode == AWS_AutoScaling_ScheduledAction_HASH)
-          {
-            return ResourceType::AWS_AutoScaling_ScheduledAction;
-          }
-          else if (hashCode == AWS_CodeBuild_Project_HASH)
-          {
-            return ResourceType::AWS_CodeBuild_Project;
-          }
-          else if (hashCode == AWS_WAF_RateBasedRule_HASH)
-          {
-            return ResourceType::AWS_WAF_RateBasedRule;
-          }
-          else if (hashCode == AWS_WAF_Rule_HASH)
-          {
-            return ResourceType::AWS_WAF_Rule;
-          }
-          else if (hashCode == AWS_WAF_WebACL_HASH)
-          {
-            return ResourceType::AWS_WAF_WebACL;
-          }
-          else if (hashCode == AWS_WAFRegional_RateBasedRule_HASH)
-          {
-            return ResourceType::AWS_WAFRegional_RateBasedRule;
-          }
-          else if (hashCode == AWS_WAFRegional_Rule_HASH)
-          {
-            return ResourceType::AWS_WAFRegional_Rule;
-          }
-          else if (hashCode == AWS_WAFRegional_WebACL_HASH)
-          {
-            return ResourceType::AWS_WAFRegional_WebACL;
-          }
-          else if (hashCode == AWS_CloudFront_Distribution_HASH)
-          {
-            return ResourceType::AWS_CloudFront_Distribution;
-          }
-          else if (hashCode == AWS_CloudFront_StreamingDistribution_HASH)
-          {
-            return ResourceType::AWS_CloudFront_StreamingDistribution;
-          }
-          else if (hashCode == AWS_WAF_RuleGroup_HASH)
-          {
-            return ResourceType::AWS_WAF_RuleGroup;
-          }
-          else if (hashCode == AWS_WAFRegional_RuleGroup_HASH)
-          {
-            return ResourceType::AWS_WAFRegional_RuleGroup;
-          }
-          else if (hashCode == AWS_Lambda_Function_HASH)
-          {
-            return ResourceType::AWS_Lambda_Function;
-          }
-          else if (hashCode == AWS_ElasticBeanstalk_Application_HASH)
-          {
-            return ResourceType::AWS_ElasticBeanstalk_Application;
-          }
-          else if (hashCode == AWS_ElasticBeanstalk_ApplicationVersion_HASH)
-          {
-            return ResourceType::AWS_ElasticBeanstalk_ApplicationVersion;
-          }
-          else if (hashCode == AWS_ElasticBeanstalk_Environment_HASH)
-          {
-            return ResourceType::AWS_ElasticBeanstalk_Environment;
-          }
-          else if (hashCode == AWS_ElasticLoadBalancing_LoadBalancer_HASH)
-          {
-            return ResourceType::AWS_ElasticLoadBalancing_LoadBalancer;
-          }
-          else if (hashCode == AWS_XRay_EncryptionConfig_HASH)
-          {
-            return ResourceType::AWS_XRay_EncryptionConfig;
-          }
-          else if (hashCode == AWS_SSM_AssociationCompliance_HASH)
-          {
-            return ResourceType::AWS_SSM_AssociationCompliance;
-          }
-          else if (hashCode == AWS_SSM_PatchCompliance_HASH)
-          {
-            return ResourceType::AWS_SSM_PatchCompliance;
-          }
-          else if (hashCode == AWS_Shield_Protection_HASH)
-          {
-            return ResourceType::AWS_Shield_Protection;
-          }
-          else if (hashCode == AWS_ShieldRegional_Protection_HASH)
-          {
-            return ResourceType::AWS_ShieldRegional_Protection;
-          }
-          else if (hashCode == AWS_Config_ResourceCompliance_HASH)
-          {
-            return ResourceType::AWS_Config_ResourceCompliance;
-          }
-          else if (hashCode == AWS_CodePipeline_Pipeline_HASH)
-          {
-            return ResourceType::AWS_CodePipeline_Pipeline;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1411585361:
+            if (name == "AWS::EC2::CustomerGateway")
+            {
+              return ResourceType::AWS_EC2_CustomerGateway;
+            }
+            break;
+          case -1820312587:
+            if (name == "AWS::EC2::EIP")
+            {
+              return ResourceType::AWS_EC2_EIP;
+            }
+            break;
+          case -594988257:
+            if (name == "AWS::EC2::Host")
+            {
+              return ResourceType::AWS_EC2_Host;
+            }
+            break;
+          case 1939160716:
+            if (name == "AWS::EC2::Instance")
+            {
+              return ResourceType::AWS_EC2_Instance;
+            }
+            break;
+          case -1748689428:
+            if (name == "AWS::EC2::InternetGateway")
+            {
+              return ResourceType::AWS_EC2_InternetGateway;
+            }
+            break;
+          case -1862641741:
+            if (name == "AWS::EC2::NetworkAcl")
+            {
+              return ResourceType::AWS_EC2_NetworkAcl;
+            }
+            break;
+          case 459966882:
+            if (name == "AWS::EC2::NetworkInterface")
+            {
+              return ResourceType::AWS_EC2_NetworkInterface;
+            }
+            break;
+          case -482367684:
+            if (name == "AWS::EC2::RouteTable")
+            {
+              return ResourceType::AWS_EC2_RouteTable;
+            }
+            break;
+          case 1769213832:
+            if (name == "AWS::EC2::SecurityGroup")
+            {
+              return ResourceType::AWS_EC2_SecurityGroup;
+            }
+            break;
+          case -233111788:
+            if (name == "AWS::EC2::Subnet")
+            {
+              return ResourceType::AWS_EC2_Subnet;
+            }
+            break;
+          case -1212490920:
+            if (name == "AWS::CloudTrail::Trail")
+            {
+              return ResourceType::AWS_CloudTrail_Trail;
+            }
+            break;
+          case -152460591:
+            if (name == "AWS::EC2::Volume")
+            {
+              return ResourceType::AWS_EC2_Volume;
+            }
+            break;
+          case -1820296046:
+            if (name == "AWS::EC2::VPC")
+            {
+              return ResourceType::AWS_EC2_VPC;
+            }
+            break;
+          case -1829931173:
+            if (name == "AWS::EC2::VPNConnection")
+            {
+              return ResourceType::AWS_EC2_VPNConnection;
+            }
+            break;
+          case -1689819417:
+            if (name == "AWS::EC2::VPNGateway")
+            {
+              return ResourceType::AWS_EC2_VPNGateway;
+            }
+            break;
+          case 1374489063:
+            if (name == "AWS::IAM::Group")
+            {
+              return ResourceType::AWS_IAM_Group;
+            }
+            break;
+          case -85721398:
+            if (name == "AWS::IAM::Policy")
+            {
+              return ResourceType::AWS_IAM_Policy;
+            }
+            break;
+          case -232431602:
+            if (name == "AWS::IAM::Role")
+            {
+              return ResourceType::AWS_IAM_Role;
+            }
+            break;
+          case -232338589:
+            if (name == "AWS::IAM::User")
+            {
+              return ResourceType::AWS_IAM_User;
+            }
+            break;
+          case -1031730039:
+            if (name == "AWS::ACM::Certificate")
+            {
+              return ResourceType::AWS_ACM_Certificate;
+            }
+            break;
+          case -1448618793:
+            if (name == "AWS::RDS::DBInstance")
+            {
+              return ResourceType::AWS_RDS_DBInstance;
+            }
+            break;
+          case 355145120:
+            if (name == "AWS::RDS::DBSubnetGroup")
+            {
+              return ResourceType::AWS_RDS_DBSubnetGroup;
+            }
+            break;
+          case -1517637603:
+            if (name == "AWS::RDS::DBSecurityGroup")
+            {
+              return ResourceType::AWS_RDS_DBSecurityGroup;
+            }
+            break;
+          case -1718872570:
+            if (name == "AWS::RDS::DBSnapshot")
+            {
+              return ResourceType::AWS_RDS_DBSnapshot;
+            }
+            break;
+          case 95073939:
+            if (name == "AWS::RDS::EventSubscription")
+            {
+              return ResourceType::AWS_RDS_EventSubscription;
+            }
+            break;
+          case -1750931693:
+            if (name == "AWS::ElasticLoadBalancingV2::LoadBalancer")
+            {
+              return ResourceType::AWS_ElasticLoadBalancingV2_LoadBalancer;
+            }
+            break;
+          case 461318695:
+            if (name == "AWS::S3::Bucket")
+            {
+              return ResourceType::AWS_S3_Bucket;
+            }
+            break;
+          case 1253381048:
+            if (name == "AWS::SSM::ManagedInstanceInventory")
+            {
+              return ResourceType::AWS_SSM_ManagedInstanceInventory;
+            }
+            break;
+          case -644654644:
+            if (name == "AWS::Redshift::Cluster")
+            {
+              return ResourceType::AWS_Redshift_Cluster;
+            }
+            break;
+          case -1668806736:
+            if (name == "AWS::Redshift::ClusterSnapshot")
+            {
+              return ResourceType::AWS_Redshift_ClusterSnapshot;
+            }
+            break;
+          case 94192962:
+            if (name == "AWS::Redshift::ClusterParameterGroup")
+            {
+              return ResourceType::AWS_Redshift_ClusterParameterGroup;
+            }
+            break;
+          case -1451935565:
+            if (name == "AWS::Redshift::ClusterSecurityGroup")
+            {
+              return ResourceType::AWS_Redshift_ClusterSecurityGroup;
+            }
+            break;
+          case 1512754102:
+            if (name == "AWS::Redshift::ClusterSubnetGroup")
+            {
+              return ResourceType::AWS_Redshift_ClusterSubnetGroup;
+            }
+            break;
+          case -1754975703:
+            if (name == "AWS::Redshift::EventSubscription")
+            {
+              return ResourceType::AWS_Redshift_EventSubscription;
+            }
+            break;
+          case -219837254:
+            if (name == "AWS::CloudWatch::Alarm")
+            {
+              return ResourceType::AWS_CloudWatch_Alarm;
+            }
+            break;
+          case -1747725617:
+            if (name == "AWS::CloudFormation::Stack")
+            {
+              return ResourceType::AWS_CloudFormation_Stack;
+            }
+            break;
+          case -1209039831:
+            if (name == "AWS::DynamoDB::Table")
+            {
+              return ResourceType::AWS_DynamoDB_Table;
+            }
+            break;
+          case 1795680482:
+            if (name == "AWS::AutoScaling::AutoScalingGroup")
+            {
+              return ResourceType::AWS_AutoScaling_AutoScalingGroup;
+            }
+            break;
+          case 1876253640:
+            if (name == "AWS::AutoScaling::LaunchConfiguration")
+            {
+              return ResourceType::AWS_AutoScaling_LaunchConfiguration;
+            }
+            break;
+          case 1646854942:
+            if (name == "AWS::AutoScaling::ScalingPolicy")
+            {
+              return ResourceType::AWS_AutoScaling_ScalingPolicy;
+            }
+            break;
+          case 1819664264:
+            if (name == "AWS::AutoScaling::ScheduledAction")
+            {
+              return ResourceType::AWS_AutoScaling_ScheduledAction;
+            }
+            break;
+          case -961658347:
+            if (name == "AWS::CodeBuild::Project")
+            {
+              return ResourceType::AWS_CodeBuild_Project;
+            }
+            break;
+          case 1773900880:
+            if (name == "AWS::WAF::RateBasedRule")
+            {
+              return ResourceType::AWS_WAF_RateBasedRule;
+            }
+            break;
+          case -1684543013:
+            if (name == "AWS::WAF::Rule")
+            {
+              return ResourceType::AWS_WAF_Rule;
+            }
+            break;
+          case 484874165:
+            if (name == "AWS::WAF::WebACL")
+            {
+              return ResourceType::AWS_WAF_WebACL;
+            }
+            break;
+          case -1757785295:
+            if (name == "AWS::WAFRegional::RateBasedRule")
+            {
+              return ResourceType::AWS_WAFRegional_RateBasedRule;
+            }
+            break;
+          case 1054456282:
+            if (name == "AWS::WAFRegional::Rule")
+            {
+              return ResourceType::AWS_WAFRegional_Rule;
+            }
+            break;
+          case -151755788:
+            if (name == "AWS::WAFRegional::WebACL")
+            {
+              return ResourceType::AWS_WAFRegional_WebACL;
+            }
+            break;
+          case 1594562517:
+            if (name == "AWS::CloudFront::Distribution")
+            {
+              return ResourceType::AWS_CloudFront_Distribution;
+            }
+            break;
+          case -376153643:
+            if (name == "AWS::CloudFront::StreamingDistribution")
+            {
+              return ResourceType::AWS_CloudFront_StreamingDistribution;
+            }
+            break;
+          case 499453284:
+            if (name == "AWS::WAF::RuleGroup")
+            {
+              return ResourceType::AWS_WAF_RuleGroup;
+            }
+            break;
+          case 1232102597:
+            if (name == "AWS::WAFRegional::RuleGroup")
+            {
+              return ResourceType::AWS_WAFRegional_RuleGroup;
+            }
+            break;
+          case -1744776388:
+            if (name == "AWS::Lambda::Function")
+            {
+              return ResourceType::AWS_Lambda_Function;
+            }
+            break;
+          case -2063010887:
+            if (name == "AWS::ElasticBeanstalk::Application")
+            {
+              return ResourceType::AWS_ElasticBeanstalk_Application;
+            }
+            break;
+          case -1988702497:
+            if (name == "AWS::ElasticBeanstalk::ApplicationVersion")
+            {
+              return ResourceType::AWS_ElasticBeanstalk_ApplicationVersion;
+            }
+            break;
+          case 591798396:
+            if (name == "AWS::ElasticBeanstalk::Environment")
+            {
+              return ResourceType::AWS_ElasticBeanstalk_Environment;
+            }
+            break;
+          case 1018814519:
+            if (name == "AWS::ElasticLoadBalancing::LoadBalancer")
+            {
+              return ResourceType::AWS_ElasticLoadBalancing_LoadBalancer;
+            }
+            break;
+          case -2141969580:
+            if (name == "AWS::XRay::EncryptionConfig")
+            {
+              return ResourceType::AWS_XRay_EncryptionConfig;
+            }
+            break;
+          case 2060347436:
+            if (name == "AWS::SSM::AssociationCompliance")
+            {
+              return ResourceType::AWS_SSM_AssociationCompliance;
+            }
+            break;
+          case 1799889715:
+            if (name == "AWS::SSM::PatchCompliance")
+            {
+              return ResourceType::AWS_SSM_PatchCompliance;
+            }
+            break;
+          case 818846175:
+            if (name == "AWS::Shield::Protection")
+            {
+              return ResourceType::AWS_Shield_Protection;
+            }
+            break;
+          case -1013459042:
+            if (name == "AWS::ShieldRegional::Protection")
+            {
+              return ResourceType::AWS_ShieldRegional_Protection;
+            }
+            break;
+          case 85929256:
+            if (name == "AWS::Config::ResourceCompliance")
+            {
+              return ResourceType::AWS_Config_ResourceCompliance;
+            }
+            break;
+          case -355990994:
+            if (name == "AWS::CodePipeline::Pipeline")
+            {
+              return ResourceType::AWS_CodePipeline_Pipeline;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -365,147 +506,26 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceTypeCStr(ResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceType::AWS_EC2_CustomerGateway:
-            return "AWS::EC2::CustomerGateway";
-          case ResourceType::AWS_EC2_EIP:
-            return "AWS::EC2::EIP";
-          case ResourceType::AWS_EC2_Host:
-            return "AWS::EC2::Host";
-          case ResourceType::AWS_EC2_Instance:
-            return "AWS::EC2::Instance";
-          case ResourceType::AWS_EC2_InternetGateway:
-            return "AWS::EC2::InternetGateway";
-          case ResourceType::AWS_EC2_NetworkAcl:
-            return "AWS::EC2::NetworkAcl";
-          case ResourceType::AWS_EC2_NetworkInterface:
-            return "AWS::EC2::NetworkInterface";
-          case ResourceType::AWS_EC2_RouteTable:
-            return "AWS::EC2::RouteTable";
-          case ResourceType::AWS_EC2_SecurityGroup:
-            return "AWS::EC2::SecurityGroup";
-          case ResourceType::AWS_EC2_Subnet:
-            return "AWS::EC2::Subnet";
-          case ResourceType::AWS_CloudTrail_Trail:
-            return "AWS::CloudTrail::Trail";
-          case ResourceType::AWS_EC2_Volume:
-            return "AWS::EC2::Volume";
-          case ResourceType::AWS_EC2_VPC:
-            return "AWS::EC2::VPC";
-          case ResourceType::AWS_EC2_VPNConnection:
-            return "AWS::EC2::VPNConnection";
-          case ResourceType::AWS_EC2_VPNGateway:
-            return "AWS::EC2::VPNGateway";
-          case ResourceType::AWS_IAM_Group:
-            return "AWS::IAM::Group";
-          case ResourceType::AWS_IAM_Policy:
-            return "AWS::IAM::Policy";
-          case ResourceType::AWS_IAM_Role:
-            return "AWS::IAM::Role";
-          case ResourceType::AWS_IAM_User:
-            return "AWS::IAM::User";
-          case ResourceType::AWS_ACM_Certificate:
-            return "AWS::ACM::Certificate";
-          case ResourceType::AWS_RDS_DBInstance:
-            return "AWS::RDS::DBInstance";
-          case ResourceType::AWS_RDS_DBSubnetGroup:
-            return "AWS::RDS::DBSubnetGroup";
-          case ResourceType::AWS_RDS_DBSecurityGroup:
-            return "AWS::RDS::DBSecurityGroup";
-          case ResourceType::AWS_RDS_DBSnapshot:
-            return "AWS::RDS::DBSnapshot";
-          case ResourceType::AWS_RDS_EventSubscription:
-            return "AWS::RDS::EventSubscription";
-          case ResourceType::AWS_ElasticLoadBalancingV2_LoadBalancer:
-            return "AWS::ElasticLoadBalancingV2::LoadBalancer";
-          case ResourceType::AWS_S3_Bucket:
-            return "AWS::S3::Bucket";
-          case ResourceType::AWS_SSM_ManagedInstanceInventory:
-            return "AWS::SSM::ManagedInstanceInventory";
-          case ResourceType::AWS_Redshift_Cluster:
-            return "AWS::Redshift::Cluster";
-          case ResourceType::AWS_Redshift_ClusterSnapshot:
-            return "AWS::Redshift::ClusterSnapshot";
-          case ResourceType::AWS_Redshift_ClusterParameterGroup:
-            return "AWS::Redshift::ClusterParameterGroup";
-          case ResourceType::AWS_Redshift_ClusterSecurityGroup:
-            return "AWS::Redshift::ClusterSecurityGroup";
-          case ResourceType::AWS_Redshift_ClusterSubnetGroup:
-            return "AWS::Redshift::ClusterSubnetGroup";
-          case ResourceType::AWS_Redshift_EventSubscription:
-            return "AWS::Redshift::EventSubscription";
-          case ResourceType::AWS_CloudWatch_Alarm:
-            return "AWS::CloudWatch::Alarm";
-          case ResourceType::AWS_CloudFormation_Stack:
-            return "AWS::CloudFormation::Stack";
-          case ResourceType::AWS_DynamoDB_Table:
-            return "AWS::DynamoDB::Table";
-          case ResourceType::AWS_AutoScaling_AutoScalingGroup:
-            return "AWS::AutoScaling::AutoScalingGroup";
-          case ResourceType::AWS_AutoScaling_LaunchConfiguration:
-            return "AWS::AutoScaling::LaunchConfiguration";
-          case ResourceType::AWS_AutoScaling_ScalingPolicy:
-            return "AWS::AutoScaling::ScalingPolicy";
-          case ResourceType::AWS_AutoScaling_ScheduledAction:
-            return "AWS::AutoScaling::ScheduledAction";
-          case ResourceType::AWS_CodeBuild_Project:
-            return "AWS::CodeBuild::Project";
-          case ResourceType::AWS_WAF_RateBasedRule:
-            return "AWS::WAF::RateBasedRule";
-          case ResourceType::AWS_WAF_Rule:
-            return "AWS::WAF::Rule";
-          case ResourceType::AWS_WAF_WebACL:
-            return "AWS::WAF::WebACL";
-          case ResourceType::AWS_WAFRegional_RateBasedRule:
-            return "AWS::WAFRegional::RateBasedRule";
-          case ResourceType::AWS_WAFRegional_Rule:
-            return "AWS::WAFRegional::Rule";
-          case ResourceType::AWS_WAFRegional_WebACL:
-            return "AWS::WAFRegional::WebACL";
-          case ResourceType::AWS_CloudFront_Distribution:
-            return "AWS::CloudFront::Distribution";
-          case ResourceType::AWS_CloudFront_StreamingDistribution:
-            return "AWS::CloudFront::StreamingDistribution";
-          case ResourceType::AWS_WAF_RuleGroup:
-            return "AWS::WAF::RuleGroup";
-          case ResourceType::AWS_WAFRegional_RuleGroup:
-            return "AWS::WAFRegional::RuleGroup";
-          case ResourceType::AWS_Lambda_Function:
-            return "AWS::Lambda::Function";
-          case ResourceType::AWS_ElasticBeanstalk_Application:
-            return "AWS::ElasticBeanstalk::Application";
-          case ResourceType::AWS_ElasticBeanstalk_ApplicationVersion:
-            return "AWS::ElasticBeanstalk::ApplicationVersion";
-          case ResourceType::AWS_ElasticBeanstalk_Environment:
-            return "AWS::ElasticBeanstalk::Environment";
-          case ResourceType::AWS_ElasticLoadBalancing_LoadBalancer:
-            return "AWS::ElasticLoadBalancing::LoadBalancer";
-          case ResourceType::AWS_XRay_EncryptionConfig:
-            return "AWS::XRay::EncryptionConfig";
-          case ResourceType::AWS_SSM_AssociationCompliance:
-            return "AWS::SSM::AssociationCompliance";
-          case ResourceType::AWS_SSM_PatchCompliance:
-            return "AWS::SSM::PatchCompliance";
-          case ResourceType::AWS_Shield_Protection:
-            return "AWS::Shield::Protection";
-          case ResourceType::AWS_ShieldRegional_Protection:
-            return "AWS::ShieldRegional::Protection";
-          case ResourceType::AWS_Config_ResourceCompliance:
-            return "AWS::Config::ResourceCompliance";
-          case ResourceType::AWS_CodePipeline_Pipeline:
-            return "AWS::CodePipeline::Pipeline";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceType(ResourceType enumValue)
+        {
+          return GetNameForResourceTypeCStr(enumValue);
         }
 
       } // namespace ResourceTypeMapper
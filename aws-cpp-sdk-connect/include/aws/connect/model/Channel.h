@@ -34,6 +34,11 @@ namespace ChannelMapper
 AWS_CONNECT_API Channel GetChannelForName(const Aws::String& name);
 
 AWS_CONNECT_API Aws::String GetNameForChannel(Channel value);
+
+/**
+ * Same as GetNameForChannel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONNECT_API const char* GetNameForChannelCStr(Channel value);
 } // namespace ChannelMapper
 } // namespace Model
 } // namespace Connect
@@ -34,6 +34,11 @@ namespace ComparisonMapper
 AWS_CONNECT_API Comparison GetComparisonForName(const Aws::String& name);
 
 AWS_CONNECT_API Aws::String GetNameForComparison(Comparison value);
+
+/**
+ * Same as GetNameForComparison(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONNECT_API const char* GetNameForComparisonCStr(Comparison value);
 } // namespace ComparisonMapper
 } // namespace Model
 } // namespace Connect
@@ -43,6 +43,11 @@ namespace CurrentMetricNameMapper
 AWS_CONNECT_API CurrentMetricName GetCurrentMetricNameForName(const Aws::String& name);
 
 AWS_CONNECT_API Aws::String GetNameForCurrentMetricName(CurrentMetricName value);
+
+/**
+ * Same as GetNameForCurrentMetricName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONNECT_API const char* GetNameForCurrentMetricNameCStr(CurrentMetricName value);
 } // namespace CurrentMetricNameMapper
 } // namespace Model
 } // namespace Connect
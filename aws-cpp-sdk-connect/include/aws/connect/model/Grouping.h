@@ -35,6 +35,11 @@ namespace GroupingMapper
 AWS_CONNECT_API Grouping GetGroupingForName(const Aws::String& name);
 
 AWS_CONNECT_API Aws::String GetNameForGrouping(Grouping value);
+
+/**
+ * Same as GetNameForGrouping(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONNECT_API const char* GetNameForGroupingCStr(Grouping value);
 } // namespace GroupingMapper
 } // namespace Model
 } // namespace Connect
@@ -58,6 +58,11 @@ namespace HistoricalMetricNameMapper
 AWS_CONNECT_API HistoricalMetricName GetHistoricalMetricNameForName(const Aws::String& name);
 
 AWS_CONNECT_API Aws::String GetNameForHistoricalMetricName(HistoricalMetricName value);
+
+/**
+ * Same as GetNameForHistoricalMetricName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONNECT_API const char* GetNameForHistoricalMetricNameCStr(HistoricalMetricName value);
 } // namespace HistoricalMetricNameMapper
 } // namespace Model
 } // namespace Connect
@@ -35,6 +35,11 @@ namespace PhoneTypeMapper
 AWS_CONNECT_API PhoneType GetPhoneTypeForName(const Aws::String& name);
 
 AWS_CONNECT_API Aws::String GetNameForPhoneType(PhoneType value);
+
+/**
+ * Same as GetNameForPhoneType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONNECT_API const char* GetNameForPhoneTypeCStr(PhoneType value);
 } // namespace PhoneTypeMapper
 } // namespace Model
 } // namespace Connect
@@ -36,6 +36,11 @@ namespace StatisticMapper
 AWS_CONNECT_API Statistic GetStatisticForName(const Aws::String& name);
 
 AWS_CONNECT_API Aws::String GetNameForStatistic(Statistic value);
+
+/**
+ * Same as GetNameForStatistic(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONNECT_API const char* GetNameForStatisticCStr(Statistic value);
 } // namespace StatisticMapper
 } // namespace Model
 } // namespace Connect
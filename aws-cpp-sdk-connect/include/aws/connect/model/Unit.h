@@ -36,6 +36,11 @@ namespace UnitMapper
 AWS_CONNECT_API Unit GetUnitForName(const Aws::String& name);
 
 AWS_CONNECT_API Aws::String GetNameForUnit(Unit value);
+
+/**
+ * Same as GetNameForUnit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CONNECT_API const char* GetNameForUnitCStr(Unit value);
 } // namespace UnitMapper
 } // namespace Model
 } // namespace Connect
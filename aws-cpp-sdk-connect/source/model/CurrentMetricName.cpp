@@ -30,60 +30,93 @@ namespace Aws
       namespace CurrentMetricNameMapper
       {
 
-        static const int AGENTS_ONLINE_HASH = HashingUtils::HashString("AGENTS_ONLINE");
-        static const int AGENTS_AVAILABLE_HASH = HashingUtils::HashString("AGENTS_AVAILABLE");
-        static const int AGENTS_ON_CALL_HASH = HashingUtils::HashString("AGENTS_ON_CALL");
-        static const int AGENTS_NON_PRODUCTIVE_HASH = HashingUtils::HashString("AGENTS_NON_PRODUCTIVE");
-        static const int AGENTS_AFTER_CONTACT_WORK_HASH = HashingUtils::HashString("AGENTS_AFTER_CONTACT_WORK");
-        static const int AGENTS_ERROR_HASH = HashingUtils::HashString("AGENTS_ERROR");
-        static const int AGENTS_STAFFED_HASH = HashingUtils::HashString("AGENTS_STAFFED");
-        static const int CONTACTS_IN_QUEUE_HASH = HashingUtils::HashString("CONTACTS_IN_QUEUE");
-        static const int OLDEST_CONTACT_AGE_HASH = HashingUtils::HashString("OLDEST_CONTACT_AGE");
-        static const int CONTACTS_SCHEDULED_HASH = HashingUtils::HashString("CONTACTS_SCHEDULED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AGENTS_ONLINE",
+          "AGENTS_AVAILABLE",
+          "AGENTS_ON_CALL",
+          "AGENTS_NON_PRODUCTIVE",
+          "AGENTS_AFTER_CONTACT_WORK",
+          "AGENTS_ERROR",
+          "AGENTS_STAFFED",
+          "CONTACTS_IN_QUEUE",
+          "OLDEST_CONTACT_AGE",
+          "CONTACTS_SCHEDULED",
+        };
 
         CurrentMetricName GetCurrentMetricNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AGENTS_ONLINE_HASH)
-          {
-            return CurrentMetricName::AGENTS_ONLINE;
-          }
-          else if (hashCode == AGENTS_AVAILABLE_HASH)
-          {
-            return CurrentMetricName::AGENTS_AVAILABLE;
-          }
-          else if (hashCode == AGENTS_ON_CALL_HASH)
-          {
-            return CurrentMetricName::AGENTS_ON_CALL;
-          }
-          else if (hashCode == AGENTS_NON_PRODUCTIVE_HASH)
-          {
-            return CurrentMetricName::AGENTS_NON_PRODUCTIVE;
-          }
-          else if (hashCode == AGENTS_AFTER_CONTACT_WORK_HASH)
-          {
-            return CurrentMetricName::AGENTS_AFTER_CONTACT_WORK;
-          }
-          else if (hashCode == AGENTS_ERROR_HASH)
-          {
-            return CurrentMetricName::AGENTS_ERROR;
-          }
-          else if (hashCode == AGENTS_STAFFED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CurrentMetricName::AGENTS_STAFFED;
-          }
-          else if (hashCode == CONTACTS_IN_QUEUE_HASH)
-          {
-            return CurrentMetricName::CONTACTS_IN_QUEUE;
-          }
-          else if (hashCode == OLDEST_CONTACT_AGE_HASH)
-          {
-            return CurrentMetricName::OLDEST_CONTACT_AGE;
-          }
-          else if (hashCode == CONTACTS_SCHEDULED_HASH)
-          {
-            return CurrentMetricName::CONTACTS_SCHEDULED;
+          case -1028535900:
+            if (name == "AGENTS_ONLINE")
+            {
+              return CurrentMetricName::AGENTS_ONLINE;
+            }
+            break;
+          case -1398673992:
+            if (name == "AGENTS_AVAILABLE")
+            {
+              return CurrentMetricName::AGENTS_AVAILABLE;
+            }
+            break;
+          case -1802485875:
+            if (name == "AGENTS_ON_CALL")
+            {
+              return CurrentMetricName::AGENTS_ON_CALL;
+            }
+            break;
+          case 1089750188:
+            if (name == "AGENTS_NON_PRODUCTIVE")
+            {
+              return CurrentMetricName::AGENTS_NON_PRODUCTIVE;
+            }
+            break;
+          case -437714076:
+            if (name == "AGENTS_AFTER_CONTACT_WORK")
+            {
+              return CurrentMetricName::AGENTS_AFTER_CONTACT_WORK;
+            }
+            break;
+          case 650447991:
+            if (name == "AGENTS_ERROR")
+            {
+              return CurrentMetricName::AGENTS_ERROR;
+            }
+            break;
+          case 1891692078:
+            if (name == "AGENTS_STAFFED")
+            {
+              return CurrentMetricName::AGENTS_STAFFED;
+            }
+            break;
+          case 1093725123:
+            if (name == "CONTACTS_IN_QUEUE")
+            {
+              return CurrentMetricName::CONTACTS_IN_QUEUE;
+            }
+            break;
+          case -1711342112:
+            if (name == "OLDEST_CONTACT_AGE")
+            {
+              return CurrentMetricName::OLDEST_CONTACT_AGE;
+            }
+            break;
+          case 1658458017:
+            if (name == "CONTACTS_SCHEDULED")
+            {
+              return CurrentMetricName::CONTACTS_SCHEDULED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return CurrentMetricName::NOT_SET;
         }
 
-        Aws::String GetNameForCurrentMetricName(CurrentMetricName enumValue)
+        const char* GetNameForCurrentMetricNameCStr(CurrentMetricName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CurrentMetricName::AGENTS_ONLINE:
-            return "AGENTS_ONLINE";
-          case CurrentMetricName::AGENTS_AVAILABLE:
-            return "AGENTS_AVAILABLE";
-          case CurrentMetricName::AGENTS_ON_CALL:
-            return "AGENTS_ON_CALL";
-          case CurrentMetricName::AGENTS_NON_PRODUCTIVE:
-            return "AGENTS_NON_PRODUCTIVE";
-          case CurrentMetricName::AGENTS_AFTER_CONTACT_WORK:
-            return "AGENTS_AFTER_CONTACT_WORK";
-          case CurrentMetricName::AGENTS_ERROR:
-            return "AGENTS_ERROR";
-          case CurrentMetricName::AGENTS_STAFFED:
-            return "AGENTS_STAFFED";
-          case CurrentMetricName::CONTACTS_IN_QUEUE:
-            return "CONTACTS_IN_QUEUE";
-          case CurrentMetricName::OLDEST_CONTACT_AGE:
-            return "OLDEST_CONTACT_AGE";
-          case CurrentMetricName::CONTACTS_SCHEDULED:
-            return "CONTACTS_SCHEDULED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCurrentMetricName(CurrentMetricName enumValue)
+        {
+          return GetNameForCurrentMetricNameCStr(enumValue);
         }
 
       } // namespace CurrentMetricNameMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace GroupingMapper
       {
 
-        static const int QUEUE_HASH = HashingUtils::HashString("QUEUE");
-        static const int CHANNEL_HASH = HashingUtils::HashString("CHANNEL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "QUEUE",
+          "CHANNEL",
+        };
 
         Grouping GetGroupingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == QUEUE_HASH)
-          {
-            return Grouping::QUEUE;
-          }
-          else if (hashCode == CHANNEL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Grouping::CHANNEL;
+          case 77406449:
+            if (name == "QUEUE")
+            {
+              return Grouping::QUEUE;
+            }
+            break;
+          case 1456933091:
+            if (name == "CHANNEL")
+            {
+              return Grouping::CHANNEL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Grouping::NOT_SET;
         }
 
-        Aws::String GetNameForGrouping(Grouping enumValue)
+        const char* GetNameForGroupingCStr(Grouping enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Grouping::QUEUE:
-            return "QUEUE";
-          case Grouping::CHANNEL:
-            return "CHANNEL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGrouping(Grouping enumValue)
+        {
+          return GetNameForGroupingCStr(enumValue);
         }
 
       } // namespace GroupingMapper
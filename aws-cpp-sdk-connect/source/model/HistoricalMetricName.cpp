@@ -30,135 +30,198 @@ namespace Aws
       namespace HistoricalMetricNameMapper
       {
 
-        static const int CONTACTS_QUEUED_HASH = HashingUtils::HashString("CONTACTS_QUEUED");
-        static const int CONTACTS_HANDLED_HASH = HashingUtils::HashString("CONTACTS_HANDLED");
-        static const int CONTACTS_ABANDONED_HASH = HashingUtils::HashString("CONTACTS_ABANDONED");
-        static const int CONTACTS_CONSULTED_HASH = HashingUtils::HashString("CONTACTS_CONSULTED");
-        static const int CONTACTS_AGENT_HUNG_UP_FIRST_HASH = HashingUtils::HashString("CONTACTS_AGENT_HUNG_UP_FIRST");
-        static const int CONTACTS_HANDLED_INCOMING_HASH = HashingUtils::HashString("CONTACTS_HANDLED_INCOMING");
-        static const int CONTACTS_HANDLED_OUTBOUND_HASH = HashingUtils::HashString("CONTACTS_HANDLED_OUTBOUND");
-        static const int CONTACTS_HOLD_ABANDONS_HASH = HashingUtils::HashString("CONTACTS_HOLD_ABANDONS");
-        static const int CONTACTS_TRANSFERRED_IN_HASH = HashingUtils::HashString("CONTACTS_TRANSFERRED_IN");
-        static const int CONTACTS_TRANSFERRED_OUT_HASH = HashingUtils::HashString("CONTACTS_TRANSFERRED_OUT");
-        static const int CONTACTS_TRANSFERRED_IN_FROM_QUEUE_HASH = HashingUtils::HashString("CONTACTS_TRANSFERRED_IN_FROM_QUEUE");
-        static const int CONTACTS_TRANSFERRED_OUT_FROM_QUEUE_HASH = HashingUtils::HashString("CONTACTS_TRANSFERRED_OUT_FROM_QUEUE");
-        static const int CONTACTS_MISSED_HASH = HashingUtils::HashString("CONTACTS_MISSED");
-        static const int CALLBACK_CONTACTS_HANDLED_HASH = HashingUtils::HashString("CALLBACK_CONTACTS_HANDLED");
-        static const int API_CONTACTS_HANDLED_HASH = HashingUtils::HashString("API_CONTACTS_HANDLED");
-        static const int OCCUPANCY_HASH = HashingUtils::HashString("OCCUPANCY");
-        static const int HANDLE_TIME_HASH = HashingUtils::HashString("HANDLE_TIME");
-        static const int AFTER_CONTACT_WORK_TIME_HASH = HashingUtils::HashString("AFTER_CONTACT_WORK_TIME");
-        static const int QUEUED_TIME_HASH = HashingUtils::HashString("QUEUED_TIME");
-        static const int ABANDON_TIME_HASH = HashingUtils::HashString("ABANDON_TIME");
-        static const int QUEUE_ANSWER_TIME_HASH = HashingUtils::HashString("QUEUE_ANSWER_TIME");
-        static const int HOLD_TIME_HASH = HashingUtils::HashString("HOLD_TIME");
-        static const int INTERACTION_TIME_HASH = HashingUtils::HashString("INTERACTION_TIME");
-        static const int INTERACTION_AND_HOLD_TIME_HASH = HashingUtils::HashString("INTERACTION_AND_HOLD_TIME");
-        static const int SERVICE_LEVEL_HASH = HashingUtils::HashString("SERVICE_LEVEL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONTACTS_QUEUED",
+          "CONTACTS_HANDLED",
+          "CONTACTS_ABANDONED",
+          "CONTACTS_CONSULTED",
+          "CONTACTS_AGENT_HUNG_UP_FIRST",
+          "CONTACTS_HANDLED_INCOMING",
+          "CONTACTS_HANDLED_OUTBOUND",
+          "CONTACTS_HOLD_ABANDONS",
+          "CONTACTS_TRANSFERRED_IN",
+          "CONTACTS_TRANSFERRED_OUT",
+          "CONTACTS_TRANSFERRED_IN_FROM_QUEUE",
+          "CONTACTS_TRANSFERRED_OUT_FROM_QUEUE",
+          "CONTACTS_MISSED",
+          "CALLBACK_CONTACTS_HANDLED",
+          "API_CONTACTS_HANDLED",
+          "OCCUPANCY",
+          "HANDLE_TIME",
+          "AFTER_CONTACT_WORK_TIME",
+          "QUEUED_TIME",
+          "ABANDON_TIME",
+          "QUEUE_ANSWER_TIME",
+          "HOLD_TIME",
+          "INTERACTION_TIME",
+          "INTERACTION_AND_HOLD_TIME",
+          "SERVICE_LEVEL",
+        };
 
         HistoricalMetricName GetHistoricalMetricNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONTACTS_QUEUED_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_QUEUED;
-          }
-          else if (hashCode == CONTACTS_HANDLED_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_HANDLED;
-          }
-          else if (hashCode == CONTACTS_ABANDONED_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_ABANDONED;
-          }
-          else if (hashCode == CONTACTS_CONSULTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HistoricalMetricName::CONTACTS_CONSULTED;
-          }
-          else if (hashCode == CONTACTS_AGENT_HUNG_UP_FIRST_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_AGENT_HUNG_UP_FIRST;
-          }
-          else if (hashCode == CONTACTS_HANDLED_INCOMING_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_HANDLED_INCOMING;
-          }
-          else if (hashCode == CONTACTS_HANDLED_OUTBOUND_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_HANDLED_OUTBOUND;
-          }
-          else if (hashCode == CONTACTS_HOLD_ABANDONS_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_HOLD_ABANDONS;
-          }
-          else if (hashCode == CONTACTS_TRANSFERRED_IN_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_TRANSFERRED_IN;
-          }
-          else if (hashCode == CONTACTS_TRANSFERRED_OUT_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_TRANSFERRED_OUT;
-          }
-          else if (hashCode == CONTACTS_TRANSFERRED_IN_FROM_QUEUE_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_TRANSFERRED_IN_FROM_QUEUE;
-          }
-          else if (hashCode == CONTACTS_TRANSFERRED_OUT_FROM_QUEUE_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_TRANSFERRED_OUT_FROM_QUEUE;
-          }
-          else if (hashCode == CONTACTS_MISSED_HASH)
-          {
-            return HistoricalMetricName::CONTACTS_MISSED;
-          }
-          else if (hashCode == CALLBACK_CONTACTS_HANDLED_HASH)
-          {
-            return HistoricalMetricName::CALLBACK_CONTACTS_HANDLED;
-          }
-          else if (hashCode == API_CONTACTS_HANDLED_HASH)
-          {
-            return HistoricalMetricName::API_CONTACTS_HANDLED;
-          }
-          else if (hashCode == OCCUPANCY_HASH)
-          {
-            return HistoricalMetricName::OCCUPANCY;
-          }
-          else if (hashCode == HANDLE_TIME_HASH)
-          {
-            return HistoricalMetricName::HANDLE_TIME;
-          }
-          else if (hashCode == AFTER_CONTACT_WORK_TIME_HASH)
-          {
-            return HistoricalMetricName::AFTER_CONTACT_WORK_TIME;
-          }
-          else if (hashCode == QUEUED_TIME_HASH)
-          {
-            return HistoricalMetricName::QUEUED_TIME;
-          }
-          else if (hashCode == ABANDON_TIME_HASH)
-          {
-            return HistoricalMetricName::ABANDON_TIME;
-          }
-          else if (hashCode == QUEUE_ANSWER_TIME_HASH)
-          {
-            return HistoricalMetricName::QUEUE_ANSWER_TIME;
-          }
-          else if (hashCode == HOLD_TIME_HASH)
-          {
-            return HistoricalMetricName::HOLD_TIME;
-          }
-          else if (hashCode == INTERACTION_TIME_HASH)
-          {
-            return HistoricalMetricName::INTERACTION_TIME;
-          }
-          else if (hashCode == INTERACTION_AND_HOLD_TIME_HASH)
-          {
-            return HistoricalMetricName::INTERACTION_AND_HOLD_TIME;
-          }
-          else if (hashCode == SERVICE_LEVEL_HASH)
-          {
-            return HistoricalMetricName::SERVICE_LEVEL;
+          case -1404356897:
+            if (name == "CONTACTS_QUEUED")
+            {
+              return HistoricalMetricName::CONTACTS_QUEUED;
+            }
+            break;
+          case -547760336:
+            if (name == "CONTACTS_HANDLED")
+            {
+              return HistoricalMetricName::CONTACTS_HANDLED;
+            }
+            break;
+          case 724984008:
+            if (name == "CONTACTS_ABANDONED")
+            {
+              return HistoricalMetricName::CONTACTS_ABANDONED;
+            }
+            break;
+          case 1398148223:
+            if (name == "CONTACTS_CONSULTED")
+            {
+              return HistoricalMetricName::CONTACTS_CONSULTED;
+            }
+            break;
+          case 822643391:
+            if (name == "CONTACTS_AGENT_HUNG_UP_FIRST")
+            {
+              return HistoricalMetricName::CONTACTS_AGENT_HUNG_UP_FIRST;
+            }
+            break;
+          case 169891925:
+            if (name == "CONTACTS_HANDLED_INCOMING")
+            {
+              return HistoricalMetricName::CONTACTS_HANDLED_INCOMING;
+            }
+            break;
+          case 134171423:
+            if (name == "CONTACTS_HANDLED_OUTBOUND")
+            {
+              return HistoricalMetricName::CONTACTS_HANDLED_OUTBOUND;
+            }
+            break;
+          case 747548978:
+            if (name == "CONTACTS_HOLD_ABANDONS")
+            {
+              return HistoricalMetricName::CONTACTS_HOLD_ABANDONS;
+            }
+            break;
+          case 1999759562:
+            if (name == "CONTACTS_TRANSFERRED_IN")
+            {
+              return HistoricalMetricName::CONTACTS_TRANSFERRED_IN;
+            }
+            break;
+          case 1863010345:
+            if (name == "CONTACTS_TRANSFERRED_OUT")
+            {
+              return HistoricalMetricName::CONTACTS_TRANSFERRED_OUT;
+            }
+            break;
+          case 160339633:
+            if (name == "CONTACTS_TRANSFERRED_IN_FROM_QUEUE")
+            {
+              return HistoricalMetricName::CONTACTS_TRANSFERRED_IN_FROM_QUEUE;
+            }
+            break;
+          case -1486866958:
+            if (name == "CONTACTS_TRANSFERRED_OUT_FROM_QUEUE")
+            {
+              return HistoricalMetricName::CONTACTS_TRANSFERRED_OUT_FROM_QUEUE;
+            }
+            break;
+          case -1529540601:
+            if (name == "CONTACTS_MISSED")
+            {
+              return HistoricalMetricName::CONTACTS_MISSED;
+            }
+            break;
+          case -743105558:
+            if (name == "CALLBACK_CONTACTS_HANDLED")
+            {
+              return HistoricalMetricName::CALLBACK_CONTACTS_HANDLED;
+            }
+            break;
+          case -246239531:
+            if (name == "API_CONTACTS_HANDLED")
+            {
+              return HistoricalMetricName::API_CONTACTS_HANDLED;
+            }
+            break;
+          case 1591771181:
+            if (name == "OCCUPANCY")
+            {
+              return HistoricalMetricName::OCCUPANCY;
+            }
+            break;
+          case -618939772:
+            if (name == "HANDLE_TIME")
+            {
+              return HistoricalMetricName::HANDLE_TIME;
+            }
+            break;
+          case 917582329:
+            if (name == "AFTER_CONTACT_WORK_TIME")
+            {
+              return HistoricalMetricName::AFTER_CONTACT_WORK_TIME;
+            }
+            break;
+          case 1752069657:
+            if (name == "QUEUED_TIME")
+            {
+              return HistoricalMetricName::QUEUED_TIME;
+            }
+            break;
+          case -1517961:
+            if (name == "ABANDON_TIME")
+            {
+              return HistoricalMetricName::ABANDON_TIME;
+            }
+            break;
+          case 901256288:
+            if (name == "QUEUE_ANSWER_TIME")
+            {
+              return HistoricalMetricName::QUEUE_ANSWER_TIME;
+            }
+            break;
+          case -276744627:
+            if (name == "HOLD_TIME")
+            {
+              return HistoricalMetricName::HOLD_TIME;
+            }
+            break;
+          case 1894582522:
+            if (name == "INTERACTION_TIME")
+            {
+              return HistoricalMetricName::INTERACTION_TIME;
+            }
+            break;
+          case 446667320:
+            if (name == "INTERACTION_AND_HOLD_TIME")
+            {
+              return HistoricalMetricName::INTERACTION_AND_HOLD_TIME;
+            }
+            break;
+          case -1992927942:
+            if (name == "SERVICE_LEVEL")
+            {
+              return HistoricalMetricName::SERVICE_LEVEL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -170,69 +233,26 @@ namespace Aws
           return HistoricalMetricName::NOT_SET;
         }
 
-        Aws::String GetNameForHistoricalMetricName(HistoricalMetricName enumValue)
+        const char* GetNameForHistoricalMetricNameCStr(HistoricalMetricName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HistoricalMetricName::CONTACTS_QUEUED:
-            return "CONTACTS_QUEUED";
-          case HistoricalMetricName::CONTACTS_HANDLED:
-            return "CONTACTS_HANDLED";
-          case HistoricalMetricName::CONTACTS_ABANDONED:
-            return "CONTACTS_ABANDONED";
-          case HistoricalMetricName::CONTACTS_CONSULTED:
-            return "CONTACTS_CONSULTED";
-          case HistoricalMetricName::CONTACTS_AGENT_HUNG_UP_FIRST:
-            return "CONTACTS_AGENT_HUNG_UP_FIRST";
-          case HistoricalMetricName::CONTACTS_HANDLED_INCOMING:
-            return "CONTACTS_HANDLED_INCOMING";
-          case HistoricalMetricName::CONTACTS_HANDLED_OUTBOUND:
-            return "CONTACTS_HANDLED_OUTBOUND";
-          case HistoricalMetricName::CONTACTS_HOLD_ABANDONS:
-            return "CONTACTS_HOLD_ABANDONS";
-          case HistoricalMetricName::CONTACTS_TRANSFERRED_IN:
-            return "CONTACTS_TRANSFERRED_IN";
-          case HistoricalMetricName::CONTACTS_TRANSFERRED_OUT:
-            return "CONTACTS_TRANSFERRED_OUT";
-          case HistoricalMetricName::CONTACTS_TRANSFERRED_IN_FROM_QUEUE:
-            return "CONTACTS_TRANSFERRED_IN_FROM_QUEUE";
-          case HistoricalMetricName::CONTACTS_TRANSFERRED_OUT_FROM_QUEUE:
-            return "CONTACTS_TRANSFERRED_OUT_FROM_QUEUE";
-          case HistoricalMetricName::CONTACTS_MISSED:
-            return "CONTACTS_MISSED";
-          case HistoricalMetricName::CALLBACK_CONTACTS_HANDLED:
-            return "CALLBACK_CONTACTS_HANDLED";
-          case HistoricalMetricName::API_CONTACTS_HANDLED:
-            return "API_CONTACTS_HANDLED";
-          case HistoricalMetricName::OCCUPANCY:
-            return "OCCUPANCY";
-          case HistoricalMetricName::HANDLE_TIME:
-            return "HANDLE_TIME";
-          case HistoricalMetricName::AFTER_CONTACT_WORK_TIME:
-            return "AFTER_CONTACT_WORK_TIME";
-          case HistoricalMetricName::QUEUED_TIME:
-            return "QUEUED_TIME";
-          case HistoricalMetricName::ABANDON_TIME:
-            return "ABANDON_TIME";
-          case HistoricalMetricName::QUEUE_ANSWER_TIME:
-            return "QUEUE_ANSWER_TIME";
-          case HistoricalMetricName::HOLD_TIME:
-            return "HOLD_TIME";
-          case HistoricalMetricName::INTERACTION_TIME:
-            return "INTERACTION_TIME";
-          case HistoricalMetricName::INTERACTION_AND_HOLD_TIME:
-            return "INTERACTION_AND_HOLD_TIME";
-          case HistoricalMetricName::SERVICE_LEVEL:
-            return "SERVICE_LEVEL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHistoricalMetricName(HistoricalMetricName enumValue)
+        {
+          return GetNameForHistoricalMetricNameCStr(enumValue);
         }
 
       } // namespace HistoricalMetricNameMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PhoneTypeMapper
       {
 
-        static const int SOFT_PHONE_HASH = HashingUtils::HashString("SOFT_PHONE");
-        static const int DESK_PHONE_HASH = HashingUtils::HashString("DESK_PHONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SOFT_PHONE",
+          "DESK_PHONE",
+        };
 
         PhoneType GetPhoneTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SOFT_PHONE_HASH)
-          {
-            return PhoneType::SOFT_PHONE;
-          }
-          else if (hashCode == DESK_PHONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PhoneType::DESK_PHONE;
+          case 1588677881:
+            if (name == "SOFT_PHONE")
+            {
+              return PhoneType::SOFT_PHONE;
+            }
+            break;
+          case -1374779352:
+            if (name == "DESK_PHONE")
+            {
+              return PhoneType::DESK_PHONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PhoneType::NOT_SET;
         }
 
-        Aws::String GetNameForPhoneType(PhoneType enumValue)
+        const char* GetNameForPhoneTypeCStr(PhoneType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PhoneType::SOFT_PHONE:
-            return "SOFT_PHONE";
-          case PhoneType::DESK_PHONE:
-            return "DESK_PHONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPhoneType(PhoneType enumValue)
+        {
+          return GetNameForPhoneTypeCStr(enumValue);
         }
 
       } // namespace PhoneTypeMapper
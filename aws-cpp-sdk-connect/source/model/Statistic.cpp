@@ -30,25 +30,44 @@ namespace Aws
       namespace StatisticMapper
       {
 
-        static const int SUM_HASH = HashingUtils::HashString("SUM");
-        static const int MAX_HASH = HashingUtils::HashString("MAX");
-        static const int AVG_HASH = HashingUtils::HashString("AVG");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUM",
+          "MAX",
+          "AVG",
+        };
 
         Statistic GetStatisticForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUM_HASH)
-          {
-            return Statistic::SUM;
-          }
-          else if (hashCode == MAX_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Statistic::MAX;
-          }
-          else if (hashCode == AVG_HASH)
-          {
-            return Statistic::AVG;
+          case 82475:
+            if (name == "SUM")
+            {
+              return Statistic::SUM;
+            }
+            break;
+          case 76100:
+            if (name == "MAX")
+            {
+              return Statistic::MAX;
+            }
+            break;
+          case 65202:
+            if (name == "AVG")
+            {
+              return Statistic::AVG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Statistic::NOT_SET;
         }
 
-        Aws::String GetNameForStatistic(Statistic enumValue)
+        const char* GetNameForStatisticCStr(Statistic enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Statistic::SUM:
-            return "SUM";
-          case Statistic::MAX:
-            return "MAX";
-          case Statistic::AVG:
-            return "AVG";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatistic(Statistic enumValue)
+        {
+          return GetNameForStatisticCStr(enumValue);
         }
 
       } // namespace StatisticMapper
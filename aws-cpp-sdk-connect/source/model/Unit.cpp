@@ -30,25 +30,44 @@ namespace Aws
       namespace UnitMapper
       {
 
-        static const int SECONDS_HASH = HashingUtils::HashString("SECONDS");
-        static const int COUNT_HASH = HashingUtils::HashString("COUNT");
-        static const int PERCENT_HASH = HashingUtils::HashString("PERCENT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SECONDS",
+          "COUNT",
+          "PERCENT",
+        };
 
         Unit GetUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SECONDS_HASH)
-          {
-            return Unit::SECONDS;
-          }
-          else if (hashCode == COUNT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Unit::COUNT;
-          }
-          else if (hashCode == PERCENT_HASH)
-          {
-            return Unit::PERCENT;
+          case -1606887841:
+            if (name == "SECONDS")
+            {
+              return Unit::SECONDS;
+            }
+            break;
+          case 64313583:
+            if (name == "COUNT")
+            {
+              return Unit::COUNT;
+            }
+            break;
+          case 39055397:
+            if (name == "PERCENT")
+            {
+              return Unit::PERCENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Unit::NOT_SET;
         }
 
-        Aws::String GetNameForUnit(Unit enumValue)
+        const char* GetNameForUnitCStr(Unit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Unit::SECONDS:
-            return "SECONDS";
-          case Unit::COUNT:
-            return "COUNT";
-          case Unit::PERCENT:
-            return "PERCENT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUnit(Unit enumValue)
+        {
+          return GetNameForUnitCStr(enumValue);
         }
 
       } // namespace UnitMapper
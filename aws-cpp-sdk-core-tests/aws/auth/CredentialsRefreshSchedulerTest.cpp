@@ -0,0 +1,381 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/auth/CredentialsRefreshScheduler.h>
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/UnreferencedParam.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils;
+
+static const char CREDENTIALS_REFRESH_TEST_ALLOCATION_TAG[] = "CredentialsRefreshSchedulerTest";
+
+static AWSCredentials NumberedCredentials(int number)
+{
+    Aws::StringStream accessKey;
+    accessKey << "AKID" << number;
+    return AWSCredentials(accessKey.str(), "secretKey", "token");
+}
+
+// Waits up to 5 seconds for condition to hold.
+static bool Eventually(const std::function<bool()>& condition)
+{
+    auto giveUpAt = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() > giveUpAt)
+        {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+TEST(CredentialsRefreshSchedulerTest, TestConcurrentFirstCallersFetchOnce)
+{
+    std::atomic<int> fetches(0);
+    CredentialsRefreshScheduler scheduler([&fetches](AWSCredentials& credentials)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        credentials = NumberedCredentials(++fetches);
+        return true;
+    }, 1000 * 60 * 15);
+
+    Aws::Vector<std::thread> threads;
+    std::atomic<int> wrongCredentials(0);
+    for (int i = 0; i < 8; ++i)
+    {
+        threads.emplace_back([&scheduler, &wrongCredentials]()
+        {
+            if (scheduler.GetCredentials().GetAWSAccessKeyId() != "AKID1")
+            {
+                wrongCredentials++;
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_EQ(1, fetches);
+    ASSERT_EQ(0, wrongCredentials);
+}
+
+TEST(CredentialsRefreshSchedulerTest, TestServesCurrentCredentialsWhileRefreshing)
+{
+    std::mutex lock;
+    std::condition_variable signal;
+    bool released = false;
+    std::atomic<int> fetches(0);
+    CredentialsRefreshScheduler scheduler([&](AWSCredentials& credentials)
+    {
+        int fetch = ++fetches;
+        if (fetch > 1)
+        {
+            std::unique_lock<std::mutex> locker(lock);
+            signal.wait(locker, [&released]() { return released; });
+        }
+        credentials = NumberedCredentials(fetch);
+        return true;
+    }, 20);
+
+    ASSERT_EQ("AKID1", scheduler.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_TRUE(Eventually([&fetches]() { return fetches == 2; }));
+
+    // the background refresh is stuck on the credentials source, the current credentials are still returned straight away.
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ("AKID1", scheduler.GetCredentials().GetAWSAccessKeyId());
+    }
+    ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+
+    {
+        std::lock_guard<std::mutex> locker(lock);
+        released = true;
+        signal.notify_all();
+    }
+    ASSERT_TRUE(Eventually([&scheduler]() { return scheduler.GetCredentials().GetAWSAccessKeyId() != "AKID1"; }));
+}
+
+TEST(CredentialsRefreshSchedulerTest, TestRefreshesAheadOfExpiration)
+{
+    std::atomic<int> fetches(0);
+    CredentialsRefreshScheduler scheduler([&fetches](AWSCredentials& credentials)
+    {
+        credentials = NumberedCredentials(++fetches);
+        credentials.SetExpiration(DateTime(DateTime::Now().Millis() + 60 * 1000));
+        return true;
+    }, 1000 * 60 * 15, 60 * 1000 - 100);
+
+    ASSERT_EQ("AKID1", scheduler.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_TRUE(Eventually([&scheduler]() { return scheduler.GetCredentials().GetAWSAccessKeyId() == "AKID2"; }));
+}
+
+TEST(CredentialsRefreshSchedulerTest, TestFetchesExpiredCredentialsRightAway)
+{
+    std::atomic<int> fetches(0);
+    CredentialsRefreshScheduler scheduler([&fetches](AWSCredentials& credentials)
+    {
+        credentials = NumberedCredentials(++fetches);
+        credentials.SetExpiration(DateTime::Now());
+        return true;
+    }, 1000 * 60 * 15);
+
+    ASSERT_EQ("AKID1", scheduler.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_NE("AKID1", scheduler.GetCredentials().GetAWSAccessKeyId());
+}
+
+TEST(CredentialsRefreshSchedulerTest, TestRetriesFailedFetchesKeepingCurrentCredentials)
+{
+    std::atomic<int> fetches(0);
+    std::atomic<int> failures(0);
+    CredentialsRefreshScheduler scheduler([&](AWSCredentials& credentials)
+    {
+        int fetch = ++fetches;
+        if (failures > 0)
+        {
+            failures--;
+            return false;
+        }
+        credentials = NumberedCredentials(fetch);
+        return true;
+    }, 50, CredentialsRefreshScheduler::DEFAULT_REFRESH_AHEAD_MS, 10, 40);
+
+    ASSERT_EQ("AKID1", scheduler.GetCredentials().GetAWSAccessKeyId());
+    failures = 3;
+    bool onlyCurrentCredentials = true;
+    ASSERT_TRUE(Eventually([&]()
+    {
+        auto accessKeyId = scheduler.GetCredentials().GetAWSAccessKeyId();
+        onlyCurrentCredentials = onlyCurrentCredentials && (accessKeyId == "AKID1" || accessKeyId == "AKID5");
+        return accessKeyId == "AKID5";
+    }));
+    ASSERT_TRUE(onlyCurrentCredentials);
+}
+
+TEST(CredentialsRefreshSchedulerTest, TestRetriesFailedFirstFetch)
+{
+    std::atomic<int> fetches(0);
+    CredentialsRefreshScheduler scheduler([&fetches](AWSCredentials& credentials)
+    {
+        int fetch = ++fetches;
+        if (fetch < 4)
+        {
+            return false;
+        }
+        credentials = NumberedCredentials(fetch);
+        return true;
+    }, 1000 * 60 * 15, CredentialsRefreshScheduler::DEFAULT_REFRESH_AHEAD_MS, 10, 40);
+
+    // empty credentials until a retry succeeds, rather than each caller fetching them.
+    ASSERT_EQ("", scheduler.GetCredentials().GetAWSAccessKeyId());
+    ASSERT_TRUE(Eventually([&scheduler]() { return scheduler.GetCredentials().GetAWSAccessKeyId() == "AKID4"; }));
+    ASSERT_EQ(4, fetches);
+
+    scheduler.Refresh();
+    ASSERT_EQ("AKID5", scheduler.GetCredentials().GetAWSAccessKeyId());
+}
+
+TEST(CredentialsRefreshSchedulerTest, TestSharedSchedulers)
+{
+    auto create = []()
+    {
+        return Aws::MakeShared<CredentialsRefreshScheduler>(CREDENTIALS_REFRESH_TEST_ALLOCATION_TAG,
+            [](AWSCredentials& credentials) { credentials = NumberedCredentials(1); return true; }, 1000);
+    };
+    auto scheduler = CredentialsRefreshScheduler::GetShared("source", create);
+    ASSERT_EQ(scheduler, CredentialsRefreshScheduler::GetShared("source", create));
+    ASSERT_NE(scheduler, CredentialsRefreshScheduler::GetShared("otherSource", create));
+
+    // not kept alive by the registry.
+    std::weak_ptr<CredentialsRefreshScheduler> released(scheduler);
+    scheduler = nullptr;
+    ASSERT_TRUE(released.expired());
+    ASSERT_NE(nullptr, CredentialsRefreshScheduler::GetShared("source", create));
+}
+
+TEST(CredentialsRefreshSchedulerTest, TestSchedulersAreNotSharedAfterShutdown)
+{
+    auto create = []()
+    {
+        return Aws::MakeShared<CredentialsRefreshScheduler>(CREDENTIALS_REFRESH_TEST_ALLOCATION_TAG,
+            [](AWSCredentials& credentials) { credentials = NumberedCredentials(1); return true; }, 1000);
+    };
+    auto registered = CredentialsRefreshScheduler::GetShared("source", create);
+
+    CleanupCredentialsRefreshSchedulers();
+    auto unshared = CredentialsRefreshScheduler::GetShared("source", create);
+    ASSERT_NE(nullptr, unshared);
+    ASSERT_NE(unshared, CredentialsRefreshScheduler::GetShared("source", create));
+    // outliving the registry it was taken from.
+    registered = nullptr;
+
+    InitCredentialsRefreshSchedulers();
+    auto shared = CredentialsRefreshScheduler::GetShared("source", create);
+    ASSERT_NE(unshared, shared);
+    ASSERT_EQ(shared, CredentialsRefreshScheduler::GetShared("source", create));
+}
+
+/**
+ * Stands in for the EC2 instance metadata service and the ECS credentials endpoint, handing out credentials numbered by how many
+ * times they were asked for.
+ */
+class MetadataServiceHttpClient : public HttpClient
+{
+public:
+    MetadataServiceHttpClient() : m_credentialsFetches(0), m_credentialsLifetimeMs(6 * 60 * 60 * 1000) {}
+
+    void SetCredentialsLifetimeMs(long credentialsLifetimeMs) { m_credentialsLifetimeMs = credentialsLifetimeMs; }
+
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        AWS_UNREFERENCED_PARAM(request);
+        AWS_UNREFERENCED_PARAM(readLimiter);
+        AWS_UNREFERENCED_PARAM(writeLimiter);
+        return nullptr;
+    }
+
+    std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        AWS_UNREFERENCED_PARAM(readLimiter);
+        AWS_UNREFERENCED_PARAM(writeLimiter);
+
+        auto response = Aws::MakeShared<StandardHttpResponse>(CREDENTIALS_REFRESH_TEST_ALLOCATION_TAG, request);
+        response->SetResponseCode(HttpResponseCode::OK);
+        const Aws::String& path = request->GetUri().GetPath();
+        if (path == "/latest/meta-data/iam/security-credentials")
+        {
+            response->GetResponseBody() << "test-role\n";
+        }
+        else if (path == "/latest/meta-data/iam/security-credentials/test-role" || path == "/v2/credentials/test-task")
+        {
+            DateTime expiration(DateTime::Now().Millis() + m_credentialsLifetimeMs);
+            response->GetResponseBody() << "{ \"AccessKeyId\": \"" << NumberedCredentials(++m_credentialsFetches).GetAWSAccessKeyId()
+                << "\", \"SecretAccessKey\": \"secretKey\", \"Token\": \"token\", \"Expiration\": \""
+                << expiration.ToGmtString(DateFormat::ISO_8601) << "\" }";
+        }
+        else if (path == "/latest/meta-data/placement/availability-zone")
+        {
+            response->GetResponseBody() << "us-west-2a";
+        }
+        else
+        {
+            response->SetResponseCode(HttpResponseCode::NOT_FOUND);
+        }
+        return response;
+    }
+
+    int GetCredentialsFetches() const { return m_credentialsFetches; }
+
+private:
+    mutable std::atomic<int> m_credentialsFetches;
+    long m_credentialsLifetimeMs;
+};
+
+class MetadataServiceHttpClientFactory : public HttpClientFactory
+{
+public:
+    MetadataServiceHttpClientFactory(const std::shared_ptr<MetadataServiceHttpClient>& client) : m_client(client) {}
+
+    std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration& clientConfiguration) const override
+    {
+        AWS_UNREFERENCED_PARAM(clientConfiguration);
+        return m_client;
+    }
+
+    std::shared_ptr<HttpRequest> CreateHttpRequest(const Aws::String& uri, HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override
+    {
+        return CreateHttpRequest(URI(uri), method, streamFactory);
+    }
+
+    std::shared_ptr<HttpRequest> CreateHttpRequest(const URI& uri, HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override
+    {
+        auto request = Aws::MakeShared<StandardHttpRequest>(CREDENTIALS_REFRESH_TEST_ALLOCATION_TAG, uri, method);
+        request->SetResponseStreamFactory(streamFactory);
+        return request;
+    }
+
+private:
+    std::shared_ptr<MetadataServiceHttpClient> m_client;
+};
+
+class MetadataServiceCredentialsTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<MetadataServiceHttpClient> metadataService;
+
+    void SetUp()
+    {
+        metadataService = Aws::MakeShared<MetadataServiceHttpClient>(CREDENTIALS_REFRESH_TEST_ALLOCATION_TAG);
+        SetHttpClientFactory(Aws::MakeShared<MetadataServiceHttpClientFactory>(CREDENTIALS_REFRESH_TEST_ALLOCATION_TAG, metadataService));
+    }
+
+    void TearDown()
+    {
+        metadataService = nullptr;
+        CleanupHttp();
+        InitHttp();
+    }
+};
+
+TEST_F(MetadataServiceCredentialsTest, TestInstanceProfileProvidersShareCredentials)
+{
+    InstanceProfileCredentialsProvider provider;
+    InstanceProfileCredentialsProvider otherProvider;
+    ASSERT_EQ("AKID1", provider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("AKID1", otherProvider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(1, metadataService->GetCredentialsFetches());
+
+    InstanceProfileCredentialsProvider fasterProvider(1000);
+    ASSERT_EQ("AKID2", fasterProvider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ(2, metadataService->GetCredentialsFetches());
+}
+
+TEST_F(MetadataServiceCredentialsTest, TestInstanceProfileCredentialsExpiration)
+{
+    metadataService->SetCredentialsLifetimeMs(60 * 60 * 1000);
+    InstanceProfileCredentialsProvider provider;
+    auto expiration = provider.GetAWSCredentials().GetExpiration();
+    ASSERT_NEAR(static_cast<double>(DateTime::Now().Millis() + 60 * 60 * 1000), static_cast<double>(expiration.Millis()), 2000.0);
+}
+
+TEST_F(MetadataServiceCredentialsTest, TestTaskRoleProvidersShareCredentials)
+{
+    TaskRoleCredentialsProvider provider("http://169.254.170.2/v2/credentials/test-task", "");
+    TaskRoleCredentialsProvider otherProvider("http://169.254.170.2/v2/credentials/test-task", "");
+    ASSERT_EQ("AKID1", provider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("secretKey", otherProvider.GetAWSCredentials().GetAWSSecretKey());
+    ASSERT_EQ("token", otherProvider.GetAWSCredentials().GetSessionToken());
+    ASSERT_EQ(1, metadataService->GetCredentialsFetches());
+}
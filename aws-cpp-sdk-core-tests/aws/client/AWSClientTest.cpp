@@ -243,6 +243,32 @@ TEST(AWSClientTest, TestBuildHttpRequestWithHeadersOnly)
     ASSERT_FALSE(finalHeaders[Http::USER_AGENT_HEADER].empty());
 	}
 
+TEST(AWSClientTest, TestBuildHttpRequestPassesResponseBodyBuffers)
+{
+    unsigned char first[16];
+    unsigned char second[32];
+    ResponseBodyBufferList bodyBuffers;
+    bodyBuffers.push_back(ResponseBodyBuffer(first, sizeof(first)));
+    bodyBuffers.push_back(ResponseBodyBuffer(second, sizeof(second)));
+
+    AmazonWebServiceRequestMock amazonWebServiceRequest;
+    amazonWebServiceRequest.SetResponseBodyBuffers(bodyBuffers);
+
+    URI uri("http://www.uri.com");
+    std::shared_ptr<Standard::StandardHttpRequest> httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_GET);
+    ASSERT_TRUE(httpRequest->GetResponseBodyBuffers().empty());
+
+    AccessViolatingAWSClient awsClient;
+    awsClient.InvokeBuildHttpRequest(amazonWebServiceRequest, httpRequest);
+
+    const ResponseBodyBufferList& passedBuffers = httpRequest->GetResponseBodyBuffers();
+    ASSERT_EQ(2u, passedBuffers.size());
+    ASSERT_EQ(first, passedBuffers[0].data);
+    ASSERT_EQ(sizeof(first), passedBuffers[0].length);
+    ASSERT_EQ(second, passedBuffers[1].data);
+    ASSERT_EQ(sizeof(second), passedBuffers[1].length);
+}
+
 TEST(AWSClientTest, TestBuildHttpRequestWithHeadersAndBody)
 {
     HeaderValueCollection headerValues;
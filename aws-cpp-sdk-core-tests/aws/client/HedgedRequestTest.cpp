@@ -0,0 +1,540 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/AWSErrorMarshaller.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/RequestLatencyTracker.h>
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/utils/memory/stl/AWSList.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/testing/mocks/aws/client/MockAWSClient.h>
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+static const char HEDGED_REQUEST_TEST_ALLOCATION_TAG[] = "HedgedRequestTest";
+
+TEST(RequestLatencyTrackerTest, TestNeedsMinimumSamples)
+{
+    RequestLatencyTracker tracker;
+    std::chrono::milliseconds value(-1);
+    for (size_t i = 1; i < RequestLatencyTracker::MIN_SAMPLES; ++i)
+    {
+        tracker.AddSample("GetObject", std::chrono::milliseconds(10));
+    }
+    ASSERT_FALSE(tracker.GetPercentile("GetObject", 95, value));
+    ASSERT_EQ(-1, value.count());
+
+    tracker.AddSample("GetObject", std::chrono::milliseconds(10));
+    ASSERT_TRUE(tracker.GetPercentile("GetObject", 95, value));
+    ASSERT_EQ(10, value.count());
+    ASSERT_FALSE(tracker.GetPercentile("HeadObject", 95, value));
+}
+
+TEST(RequestLatencyTrackerTest, TestPercentileOfLatestWindow)
+{
+    RequestLatencyTracker tracker;
+    for (int i = 0; i < 1000; ++i)
+    {
+        tracker.AddSample("GetObject", std::chrono::milliseconds(100000));
+    }
+    // only the last WINDOW_SIZE samples count.
+    for (size_t i = 1; i <= RequestLatencyTracker::WINDOW_SIZE; ++i)
+    {
+        tracker.AddSample("GetObject", std::chrono::milliseconds(i));
+    }
+
+    std::chrono::milliseconds value(0);
+    ASSERT_TRUE(tracker.GetPercentile("GetObject", 50, value));
+    ASSERT_NEAR(static_cast<double>(RequestLatencyTracker::WINDOW_SIZE) / 2, static_cast<double>(value.count()), 1.0);
+    ASSERT_TRUE(tracker.GetPercentile("GetObject", 95, value));
+    ASSERT_NEAR(RequestLatencyTracker::WINDOW_SIZE * .95, static_cast<double>(value.count()), 1.0);
+    ASSERT_TRUE(tracker.GetPercentile("GetObject", 100, value));
+    ASSERT_EQ(static_cast<long long>(RequestLatencyTracker::WINDOW_SIZE), value.count());
+}
+
+/**
+ * Stands in for an endpoint where some attempts straggle: each attempt takes the next latency queued, or the default one, and
+ * gives up early, like the curl client does, when its request is cancelled. With async requests enabled, MakeRequestAsync makes
+ * each attempt on a thread of its own, the way an event loop client would leave the calling thread free.
+ */
+class StragglingHttpClient : public HttpClient
+{
+public:
+    StragglingHttpClient() : m_defaultLatency(0), m_failedAttempts(0), m_asyncRequests(false), m_attempts(0), m_cancelled(0) {}
+
+    ~StragglingHttpClient()
+    {
+        for (auto& requestThread : m_requestThreads)
+        {
+            requestThread.join();
+        }
+    }
+
+    void SetDefaultLatency(std::chrono::milliseconds latency) { m_defaultLatency = latency; }
+
+    void QueueLatency(std::chrono::milliseconds latency)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_latencies.push_back(latency);
+    }
+
+    void SetFailedAttempts(int failedAttempts) { m_failedAttempts = failedAttempts; }
+
+    void SetAsyncRequests(bool asyncRequests) { m_asyncRequests = asyncRequests; }
+
+    bool SupportsAsyncRequests() const override { return m_asyncRequests; }
+
+    void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpResponseHandler& handler,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        if (!m_asyncRequests)
+        {
+            HttpClient::MakeRequestAsync(request, handler, readLimiter, writeLimiter);
+            return;
+        }
+
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_requestThreads.emplace_back([this, request, handler]() { handler(request, MakeRequest(request)); });
+    }
+
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        AWS_UNREFERENCED_PARAM(request);
+        AWS_UNREFERENCED_PARAM(readLimiter);
+        AWS_UNREFERENCED_PARAM(writeLimiter);
+        return nullptr;
+    }
+
+    std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        AWS_UNREFERENCED_PARAM(readLimiter);
+        AWS_UNREFERENCED_PARAM(writeLimiter);
+
+        int attempt = m_attempts++;
+        auto finishAt = std::chrono::steady_clock::now() + NextLatency();
+        auto response = Aws::MakeShared<StandardHttpResponse>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, request);
+        while (std::chrono::steady_clock::now() < finishAt)
+        {
+            if (!ContinueRequest(*request))
+            {
+                m_cancelled++;
+                response->SetResponseCode(HttpResponseCode::REQUEST_NOT_MADE);
+                return response;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (request->GetContentBody())
+        {
+            Aws::StringStream body;
+            body << request->GetContentBody()->rdbuf();
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_lastBody = body.str();
+        }
+        response->SetResponseCode(attempt < m_failedAttempts ? HttpResponseCode::INTERNAL_SERVER_ERROR : HttpResponseCode::OK);
+        response->GetResponseBody() << "{}";
+        return response;
+    }
+
+    int GetAttempts() const { return m_attempts; }
+    int GetCancelled() const { return m_cancelled; }
+
+    Aws::String GetLastBody() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_lastBody;
+    }
+
+private:
+    std::chrono::milliseconds NextLatency() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        if (m_latencies.empty())
+        {
+            return m_defaultLatency;
+        }
+        auto latency = m_latencies.front();
+        m_latencies.pop_front();
+        return latency;
+    }
+
+    std::chrono::milliseconds m_defaultLatency;
+    int m_failedAttempts;
+    bool m_asyncRequests;
+    mutable std::mutex m_lock;
+    mutable Aws::Vector<std::thread> m_requestThreads;
+    mutable Aws::List<std::chrono::milliseconds> m_latencies;
+    mutable Aws::String m_lastBody;
+    mutable std::atomic<int> m_attempts;
+    mutable std::atomic<int> m_cancelled;
+};
+
+class StragglingHttpClientFactory : public HttpClientFactory
+{
+public:
+    StragglingHttpClientFactory(const std::shared_ptr<StragglingHttpClient>& client) : m_client(client) {}
+
+    std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration& clientConfiguration) const override
+    {
+        AWS_UNREFERENCED_PARAM(clientConfiguration);
+        return m_client;
+    }
+
+    std::shared_ptr<HttpRequest> CreateHttpRequest(const Aws::String& uri, HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override
+    {
+        return CreateHttpRequest(URI(uri), method, streamFactory);
+    }
+
+    std::shared_ptr<HttpRequest> CreateHttpRequest(const URI& uri, HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override
+    {
+        auto request = Aws::MakeShared<StandardHttpRequest>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, uri, method);
+        request->SetResponseStreamFactory(streamFactory);
+        return request;
+    }
+
+private:
+    std::shared_ptr<StragglingHttpClient> m_client;
+};
+
+class StragglingServiceClient : public AWSJsonClient
+{
+public:
+    StragglingServiceClient(const ClientConfiguration& config) : AWSJsonClient(config,
+        Aws::MakeShared<AWSAuthV4Signer>(HEDGED_REQUEST_TEST_ALLOCATION_TAG,
+            Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"),
+            "service", Aws::Region::US_EAST_1),
+        Aws::MakeShared<JsonErrorMarshaller>(HEDGED_REQUEST_TEST_ALLOCATION_TAG))
+    {
+    }
+
+    ~StragglingServiceClient()
+    {
+        WaitForPendingRequests();
+    }
+
+    HttpResponseOutcome MakeRequest(bool hedgingEnabled, long deadlineMs = 0, const std::shared_ptr<Aws::IOStream>& body = nullptr) const
+    {
+        AmazonWebServiceRequestMock request;
+        request.SetHedgingEnabled(hedgingEnabled);
+        request.SetDeadlineMs(deadlineMs);
+        request.SetBody(body);
+        return AttemptExhaustively(URI("http://localhost/"), request, body ? HttpMethod::HTTP_PUT : HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER);
+    }
+
+    void MakeRequestAsync(const HttpResponseOutcomeHandler& handler) const
+    {
+        auto request = Aws::MakeShared<AmazonWebServiceRequestMock>(HEDGED_REQUEST_TEST_ALLOCATION_TAG);
+        AttemptExhaustivelyAsync(URI("http://localhost/"), request, HttpMethod::HTTP_GET, Aws::Auth::SIGV4_SIGNER, handler);
+    }
+
+    // hands the outcome to executor to be handled, the way generated clients parse the response.
+    void MakeRequestAsync(Aws::Utils::Threading::Executor& executor, const HttpResponseOutcomeHandler& handler) const
+    {
+        MakeRequestAsync([this, &executor, handler](const HttpResponseOutcome& outcome)
+        {
+            auto pendingRequest = TrackPendingRequest();
+            executor.Submit([handler, outcome, pendingRequest]() { handler(outcome); });
+        });
+    }
+
+    bool SupportsAsyncRequests() const { return AWSJsonClient::SupportsAsyncRequests(); }
+
+    const char* GetServiceClientName() const override { return "StragglingService"; }
+};
+
+class HedgedRequestTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<StragglingHttpClient> endpoint;
+
+    void SetUp()
+    {
+        endpoint = Aws::MakeShared<StragglingHttpClient>(HEDGED_REQUEST_TEST_ALLOCATION_TAG);
+        SetHttpClientFactory(Aws::MakeShared<StragglingHttpClientFactory>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, endpoint));
+    }
+
+    void TearDown()
+    {
+        endpoint = nullptr;
+        CleanupHttp();
+        InitHttp();
+    }
+
+    Aws::UniquePtr<StragglingServiceClient> MakeClient(const std::shared_ptr<RetryStrategy>& retryStrategy = nullptr)
+    {
+        ClientConfiguration config;
+        config.scheme = Scheme::HTTP;
+        if (retryStrategy)
+        {
+            config.retryStrategy = retryStrategy;
+        }
+        return Aws::MakeUnique<StragglingServiceClient>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, config);
+    }
+
+    static long ElapsedMs(const std::chrono::steady_clock::time_point& start)
+    {
+        return static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+};
+
+TEST_F(HedgedRequestTest, TestHedgeWinsOverStraggler)
+{
+    auto client = MakeClient();
+    endpoint->SetDefaultLatency(std::chrono::milliseconds(2));
+    for (size_t i = 0; i < RequestLatencyTracker::MIN_SAMPLES; ++i)
+    {
+        ASSERT_TRUE(client->MakeRequest(true).IsSuccess());
+    }
+    ASSERT_EQ(0, endpoint->GetCancelled());
+
+    endpoint->QueueLatency(std::chrono::milliseconds(10000));
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(client->MakeRequest(true).IsSuccess());
+    ASSERT_LT(ElapsedMs(start), 5000);
+    ASSERT_EQ(static_cast<int>(RequestLatencyTracker::MIN_SAMPLES) + 2, endpoint->GetAttempts());
+
+    // the straggler is cancelled rather than left running; the client waits for it before going away.
+    client = nullptr;
+    ASSERT_EQ(1, endpoint->GetCancelled());
+    ASSERT_LT(ElapsedMs(start), 5000);
+}
+
+TEST_F(HedgedRequestTest, TestNoHedgeUntilLatenciesAreKnown)
+{
+    auto client = MakeClient();
+    endpoint->SetDefaultLatency(std::chrono::milliseconds(100));
+    ASSERT_TRUE(client->MakeRequest(true).IsSuccess());
+    ASSERT_EQ(1, endpoint->GetAttempts());
+}
+
+TEST_F(HedgedRequestTest, TestNoHedgeWhenNotEnabled)
+{
+    auto client = MakeClient();
+    endpoint->SetDefaultLatency(std::chrono::milliseconds(1));
+    for (size_t i = 0; i < RequestLatencyTracker::MIN_SAMPLES; ++i)
+    {
+        ASSERT_TRUE(client->MakeRequest(true).IsSuccess());
+    }
+
+    endpoint->QueueLatency(std::chrono::milliseconds(200));
+    ASSERT_TRUE(client->MakeRequest(false).IsSuccess());
+    ASSERT_EQ(static_cast<int>(RequestLatencyTracker::MIN_SAMPLES) + 1, endpoint->GetAttempts());
+}
+
+TEST_F(HedgedRequestTest, TestNoHedgeWhenBodyStreamIsShared)
+{
+    auto client = MakeClient();
+    endpoint->SetDefaultLatency(std::chrono::milliseconds(1));
+    for (size_t i = 0; i < RequestLatencyTracker::MIN_SAMPLES; ++i)
+    {
+        ASSERT_TRUE(client->MakeRequest(true).IsSuccess());
+    }
+
+    // the request hands out the same stream every time, so a second attempt would be built from the one still being sent.
+    auto body = Aws::MakeShared<Aws::StringStream>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, "streaming body");
+    endpoint->QueueLatency(std::chrono::milliseconds(200));
+    ASSERT_TRUE(client->MakeRequest(true, 0, body).IsSuccess());
+    ASSERT_EQ(static_cast<int>(RequestLatencyTracker::MIN_SAMPLES) + 1, endpoint->GetAttempts());
+    ASSERT_EQ("streaming body", endpoint->GetLastBody());
+}
+
+TEST_F(HedgedRequestTest, TestDeadlineCancelsAttempt)
+{
+    auto client = MakeClient();
+    endpoint->SetDefaultLatency(std::chrono::milliseconds(10000));
+
+    auto start = std::chrono::steady_clock::now();
+    auto outcome = client->MakeRequest(false, 100);
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(CoreErrors::REQUEST_TIMEOUT, outcome.GetError().GetErrorType());
+    ASSERT_FALSE(outcome.GetError().ShouldRetry());
+    ASSERT_GE(ElapsedMs(start), 100);
+    ASSERT_LT(ElapsedMs(start), 5000);
+
+    client = nullptr;
+    ASSERT_EQ(1, endpoint->GetAttempts());
+    ASSERT_EQ(1, endpoint->GetCancelled());
+}
+
+TEST_F(HedgedRequestTest, TestDeadlineSpansRetries)
+{
+    // retries straight away, then after 2 s.
+    auto client = MakeClient(Aws::MakeShared<DefaultRetryStrategy>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, 10, 1000));
+    endpoint->SetFailedAttempts(1000);
+
+    auto start = std::chrono::steady_clock::now();
+    auto outcome = client->MakeRequest(false, 1000);
+    ASSERT_FALSE(outcome.IsSuccess());
+    // the last error rather than a timeout: the deadline left no time for the next retry, so it was never started.
+    ASSERT_EQ(HttpResponseCode::INTERNAL_SERVER_ERROR, outcome.GetError().GetResponseCode());
+    ASSERT_EQ(2, endpoint->GetAttempts());
+    ASSERT_LT(ElapsedMs(start), 1000);
+}
+
+TEST_F(HedgedRequestTest, TestAsyncRequestLeavesCallingThreadFree)
+{
+    auto client = MakeClient(Aws::MakeShared<DefaultRetryStrategy>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, 10, 1));
+    ASSERT_FALSE(client->SupportsAsyncRequests());
+    endpoint->SetAsyncRequests(true);
+    ASSERT_TRUE(client->SupportsAsyncRequests());
+    endpoint->SetDefaultLatency(std::chrono::milliseconds(200));
+    endpoint->SetFailedAttempts(2);
+
+    std::promise<HttpResponseOutcome> outcomePromise;
+    auto start = std::chrono::steady_clock::now();
+    client->MakeRequestAsync([&outcomePromise](const HttpResponseOutcome& outcome) { outcomePromise.set_value(outcome); });
+    ASSERT_LT(ElapsedMs(start), 200);
+
+    // retried off the calling thread until the third attempt succeeds.
+    auto outcome = outcomePromise.get_future().get();
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(3, endpoint->GetAttempts());
+    ASSERT_GE(ElapsedMs(start), 600);
+}
+
+TEST_F(HedgedRequestTest, TestAsyncRequestCompletesBeforeClientGoesAway)
+{
+    auto client = MakeClient(Aws::MakeShared<DefaultRetryStrategy>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, 0));
+    endpoint->SetAsyncRequests(true);
+    endpoint->SetDefaultLatency(std::chrono::milliseconds(100));
+
+    std::atomic<bool> completed(false);
+    client->MakeRequestAsync([&completed](const HttpResponseOutcome& outcome)
+    {
+        ASSERT_TRUE(outcome.IsSuccess());
+        completed = true;
+    });
+    client = nullptr;
+    ASSERT_TRUE(completed);
+}
+
+TEST_F(HedgedRequestTest, TestAsyncRequestHandedToExecutorCompletesBeforeClientGoesAway)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(1);
+    auto client = MakeClient(Aws::MakeShared<DefaultRetryStrategy>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, 0));
+    endpoint->SetAsyncRequests(true);
+
+    std::atomic<bool> completed(false);
+    client->MakeRequestAsync(executor, [&completed](const HttpResponseOutcome& outcome)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        ASSERT_TRUE(outcome.IsSuccess());
+        completed = true;
+    });
+    client = nullptr;
+    ASSERT_TRUE(completed);
+}
+
+/**
+ * Holds back the first attempt it is asked about, as a client side send rate limit would.
+ */
+class HoldingBackRetryStrategy : public DefaultRetryStrategy
+{
+public:
+    HoldingBackRetryStrategy(long holdBackMs) : DefaultRetryStrategy(0), m_holdBackMs(holdBackMs) {}
+
+    long AcquireSendToken() override
+    {
+        return m_holdBackMs.exchange(0);
+    }
+
+private:
+    std::atomic<long> m_holdBackMs;
+};
+
+TEST_F(HedgedRequestTest, TestAsyncRequestWaitsForSendTokenOffCallingThread)
+{
+    auto client = MakeClient(Aws::MakeShared<HoldingBackRetryStrategy>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, 300));
+    endpoint->SetAsyncRequests(true);
+
+    std::promise<HttpResponseOutcome> outcomePromise;
+    auto start = std::chrono::steady_clock::now();
+    client->MakeRequestAsync([&outcomePromise](const HttpResponseOutcome& outcome) { outcomePromise.set_value(outcome); });
+    ASSERT_LT(ElapsedMs(start), 200);
+    ASSERT_EQ(0, endpoint->GetAttempts());
+
+    auto outcome = outcomePromise.get_future().get();
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(1, endpoint->GetAttempts());
+    ASSERT_GE(ElapsedMs(start), 300);
+}
+
+TEST_F(HedgedRequestTest, TestAsyncRetryDelayEndsWhenRequestsGetCancelled)
+{
+    auto client = MakeClient(Aws::MakeShared<DefaultRetryStrategy>(HEDGED_REQUEST_TEST_ALLOCATION_TAG, 10, 10000));
+    endpoint->SetAsyncRequests(true);
+    endpoint->SetFailedAttempts(1);
+
+    std::promise<HttpResponseOutcome> outcomePromise;
+    auto start = std::chrono::steady_clock::now();
+    client->MakeRequestAsync([&outcomePromise](const HttpResponseOutcome& outcome) { outcomePromise.set_value(outcome); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    client->DisableRequestProcessing();
+
+    // the second attempt would have waited 10 seconds.
+    outcomePromise.get_future().get();
+    ASSERT_LT(ElapsedMs(start), 5000);
+}
+
+// Requests against an endpoint where 1 in 50 attempts straggles, with and without hedging.
+TEST_F(HedgedRequestTest, DISABLED_TailLatencyWithStragglers)
+{
+    static const int requests = 500;
+    auto run = [&](const char* name, bool hedgingEnabled)
+    {
+        auto client = MakeClient();
+        endpoint->SetDefaultLatency(std::chrono::milliseconds(5));
+        for (size_t i = 0; i < RequestLatencyTracker::MIN_SAMPLES; ++i)
+        {
+            client->MakeRequest(true);
+        }
+
+        std::minstd_rand random(42);
+        Aws::Vector<long> latencies;
+        for (int i = 0; i < requests; ++i)
+        {
+            if (random() % 50 == 0)
+            {
+                endpoint->QueueLatency(std::chrono::milliseconds(500));
+            }
+            auto start = std::chrono::steady_clock::now();
+            client->MakeRequest(hedgingEnabled);
+            latencies.push_back(ElapsedMs(start));
+        }
+        std::sort(latencies.begin(), latencies.end());
+        std::cout << name << ": p50 " << latencies[requests / 2] << " ms, p99 " << latencies[requests * 99 / 100] << " ms, max "
+            << latencies.back() << " ms" << std::endl;
+    };
+
+    run("Single attempts", false);
+    run("Hedged attempts", true);
+}
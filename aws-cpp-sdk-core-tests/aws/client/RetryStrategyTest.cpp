@@ -0,0 +1,498 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/external/gtest.h>
+#include <aws/core/client/AdaptiveRetryStrategy.h>
+#include <aws/core/client/AWSErrorMarshaller.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/RetryQuotaContainer.h>
+#include <aws/core/client/SendRateLimiter.h>
+#include <aws/core/client/StandardRetryStrategy.h>
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/testing/mocks/aws/client/MockAWSClient.h>
+
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+static const char RETRY_STRATEGY_TEST_ALLOCATION_TAG[] = "RetryStrategyTest";
+
+static AWSError<CoreErrors> ThrottlingError()
+{
+    return AWSError<CoreErrors>(CoreErrors::THROTTLING, "ThrottlingException", "Rate exceeded", true);
+}
+
+static HttpResponseOutcome SuccessOutcome()
+{
+    return HttpResponseOutcome(std::shared_ptr<HttpResponse>());
+}
+
+TEST(RetryQuotaContainerTest, TestAcquiresUntilQuotaIsUsedUp)
+{
+    RetryQuotaContainer quota;
+    for (int i = 0; i < RetryQuotaContainer::DEFAULT_RETRY_QUOTA / RetryQuotaContainer::RETRY_COST; ++i)
+    {
+        ASSERT_TRUE(quota.AcquireRetryQuota(ThrottlingError()));
+    }
+    ASSERT_EQ(0, quota.GetRetryQuota());
+    ASSERT_FALSE(quota.AcquireRetryQuota(ThrottlingError()));
+    ASSERT_EQ(0, quota.GetRetryQuota());
+}
+
+TEST(RetryQuotaContainerTest, TestTimeoutsCostMore)
+{
+    RetryQuotaContainer quota;
+    ASSERT_TRUE(quota.AcquireRetryQuota(AWSError<CoreErrors>(CoreErrors::REQUEST_TIMEOUT, true)));
+    ASSERT_EQ(RetryQuotaContainer::DEFAULT_RETRY_QUOTA - RetryQuotaContainer::TIMEOUT_RETRY_COST, quota.GetRetryQuota());
+    ASSERT_TRUE(quota.AcquireRetryQuota(AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, true)));
+    ASSERT_EQ(RetryQuotaContainer::DEFAULT_RETRY_QUOTA - 2 * RetryQuotaContainer::TIMEOUT_RETRY_COST, quota.GetRetryQuota());
+
+    RetryQuotaContainer smallQuota(RetryQuotaContainer::TIMEOUT_RETRY_COST - 1);
+    ASSERT_FALSE(smallQuota.AcquireRetryQuota(AWSError<CoreErrors>(CoreErrors::REQUEST_TIMEOUT, true)));
+    ASSERT_TRUE(smallQuota.AcquireRetryQuota(ThrottlingError()));
+}
+
+TEST(RetryQuotaContainerTest, TestReleaseIsCappedAtInitialQuota)
+{
+    RetryQuotaContainer quota(20);
+    ASSERT_TRUE(quota.AcquireRetryQuota(AWSError<CoreErrors>(CoreErrors::REQUEST_TIMEOUT, true)));
+    quota.ReleaseRetryQuota(ThrottlingError());
+    ASSERT_EQ(15, quota.GetRetryQuota());
+    quota.ReleaseRetryQuota(AWSError<CoreErrors>(CoreErrors::REQUEST_TIMEOUT, true));
+    ASSERT_EQ(20, quota.GetRetryQuota());
+}
+
+TEST(CoreErrorsMapperTest, TestIsThrottlingError)
+{
+    ASSERT_TRUE(CoreErrorsMapper::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::THROTTLING, true)));
+    ASSERT_TRUE(CoreErrorsMapper::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::SLOW_DOWN, true)));
+    ASSERT_TRUE(CoreErrorsMapper::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::SERVICE_EXTENSION_START_RANGE,
+        "ProvisionedThroughputExceededException", "", true)));
+    AWSError<CoreErrors> tooManyRequests(CoreErrors::UNKNOWN, false);
+    tooManyRequests.SetResponseCode(HttpResponseCode::TOO_MANY_REQUESTS);
+    ASSERT_TRUE(CoreErrorsMapper::IsThrottlingError(tooManyRequests));
+
+    ASSERT_FALSE(CoreErrorsMapper::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::SERVICE_UNAVAILABLE, true)));
+    ASSERT_FALSE(CoreErrorsMapper::IsThrottlingError(AWSError<CoreErrors>(CoreErrors::ACCESS_DENIED, "AccessDeniedException", "", false)));
+}
+
+TEST(StandardRetryStrategyTest, TestShouldRetry)
+{
+    auto quota = Aws::MakeShared<RetryQuotaContainer>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, 10);
+    StandardRetryStrategy strategy(quota, 3);
+
+    ASSERT_FALSE(strategy.ShouldRetry(AWSError<CoreErrors>(CoreErrors::ACCESS_DENIED, false), 0));
+    ASSERT_FALSE(strategy.ShouldRetry(ThrottlingError(), 3));
+    ASSERT_EQ(10, quota->GetRetryQuota());
+
+    ASSERT_TRUE(strategy.ShouldRetry(ThrottlingError(), 0));
+    ASSERT_TRUE(strategy.ShouldRetry(ThrottlingError(), 1));
+    ASSERT_EQ(0, quota->GetRetryQuota());
+    ASSERT_FALSE(strategy.ShouldRetry(ThrottlingError(), 2));
+}
+
+TEST(StandardRetryStrategyTest, TestBookkeepingReleasesQuota)
+{
+    auto quota = Aws::MakeShared<RetryQuotaContainer>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, 100);
+    StandardRetryStrategy strategy(quota);
+
+    ASSERT_TRUE(strategy.ShouldRetry(ThrottlingError(), 0));
+    ASSERT_TRUE(strategy.ShouldRetry(ThrottlingError(), 0));
+    ASSERT_EQ(90, quota->GetRetryQuota());
+
+    // a failed retry gives nothing back, a successful one its cost, a successful first attempt a little.
+    strategy.RequestBookkeeping(HttpResponseOutcome(ThrottlingError()), ThrottlingError());
+    ASSERT_EQ(90, quota->GetRetryQuota());
+    strategy.RequestBookkeeping(SuccessOutcome(), ThrottlingError());
+    ASSERT_EQ(95, quota->GetRetryQuota());
+    strategy.RequestBookkeeping(HttpResponseOutcome(ThrottlingError()));
+    ASSERT_EQ(95, quota->GetRetryQuota());
+    strategy.RequestBookkeeping(SuccessOutcome());
+    ASSERT_EQ(96, quota->GetRetryQuota());
+}
+
+TEST(StandardRetryStrategyTest, TestFullJitterDelaysStayWithinExponentialLimit)
+{
+    StandardRetryStrategy strategy(10, 100, 5000);
+    for (long retries = 0; retries < 10; ++retries)
+    {
+        long limit = (std::min)(100L << retries, 5000L);
+        long minDelay = limit;
+        long maxDelay = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            long delay = strategy.CalculateDelayBeforeNextRetry(ThrottlingError(), retries);
+            ASSERT_GE(delay, 0);
+            ASSERT_LE(delay, limit);
+            minDelay = (std::min)(minDelay, delay);
+            maxDelay = (std::max)(maxDelay, delay);
+        }
+        // spread over the whole range, not clustered at the limit like plain exponential backoff.
+        ASSERT_LT(minDelay, limit / 10);
+        ASSERT_GT(maxDelay, limit - limit / 10);
+    }
+
+    ASSERT_LE(strategy.CalculateDelayBeforeNextRetry(ThrottlingError(), 1000), 5000);
+    ASSERT_EQ(0, StandardRetryStrategy(3, 0).CalculateDelayBeforeNextRetry(ThrottlingError(), 2));
+}
+
+class SendRateLimiterTest : public ::testing::Test
+{
+protected:
+    SendRateLimiterTest() :
+        now(SendRateLimiter::ClockType::now()),
+        limiter([this]() { return now; })
+    {
+    }
+
+    // sends requests at requestsPerSecond for the given time, all of them succeeding.
+    void SendSuccessfully(double requestsPerSecond, double seconds)
+    {
+        auto interval = std::chrono::duration_cast<SendRateLimiter::ClockType::duration>(std::chrono::duration<double>(1.0 / requestsPerSecond));
+        for (int i = 0; i < static_cast<int>(requestsPerSecond * seconds); ++i)
+        {
+            now += interval;
+            limiter.UpdateSendingRate(false);
+        }
+    }
+
+    void Advance(double seconds)
+    {
+        now += std::chrono::duration_cast<SendRateLimiter::ClockType::duration>(std::chrono::duration<double>(seconds));
+    }
+
+    SendRateLimiter::ClockType::time_point now;
+    SendRateLimiter limiter;
+};
+
+TEST_F(SendRateLimiterTest, TestDoesNotLimitUntilThrottled)
+{
+    SendSuccessfully(100, 5);
+    ASSERT_FALSE(limiter.IsEnabled());
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(0, limiter.AcquireToken());
+    }
+}
+
+TEST_F(SendRateLimiterTest, TestThrottlingCutsRateBelowMeasuredRate)
+{
+    SendSuccessfully(10, 5);
+    ASSERT_NEAR(10.0, limiter.GetMeasuredSendRate(), 0.1);
+
+    Advance(0.01);
+    limiter.UpdateSendingRate(true);
+    ASSERT_TRUE(limiter.IsEnabled());
+    ASSERT_NEAR(10.0 * SendRateLimiter::BETA, limiter.GetFillRate(), 0.1);
+
+    // what the bucket holds goes right away, then tokens come at the new rate.
+    int sentRightAway = 0;
+    while (limiter.AcquireToken() == 0)
+    {
+        ASSERT_LT(++sentRightAway, 100);
+    }
+    ASSERT_EQ(6, sentRightAway);
+    long delay = limiter.AcquireToken();
+    ASSERT_GT(delay, 0);
+    ASSERT_LE(static_cast<double>(delay), std::ceil(1000 / limiter.GetFillRate()));
+    ASSERT_EQ(delay, limiter.AcquireToken());
+    Advance(delay / 1000.0);
+    ASSERT_EQ(0, limiter.AcquireToken());
+    ASSERT_NEAR(1000 / limiter.GetFillRate(), static_cast<double>(limiter.AcquireToken()), 2.0);
+
+    // throttled again right after, the rate is cut from the one already limited to.
+    double fillRate = limiter.GetFillRate();
+    limiter.UpdateSendingRate(true);
+    ASSERT_NEAR(fillRate * SendRateLimiter::BETA, limiter.GetFillRate(), 0.1);
+}
+
+TEST_F(SendRateLimiterTest, TestRateGrowsBackAlongCubicCurve)
+{
+    SendSuccessfully(10, 5);
+    limiter.UpdateSendingRate(true);
+    double rate = limiter.GetFillRate();
+
+    // back to the rate throttled at after cbrt(lastMaxRate * (1 - BETA) / SCALE_CONSTANT) seconds.
+    double timeWindow = std::cbrt(10.0 * (1.0 - SendRateLimiter::BETA) / SendRateLimiter::SCALE_CONSTANT);
+    for (int i = 0; i < static_cast<int>(timeWindow * 10) - 1; ++i)
+    {
+        SendSuccessfully(10, 0.1);
+        ASSERT_GE(limiter.GetFillRate(), rate);
+        ASSERT_LT(limiter.GetFillRate(), 10.0);
+        rate = limiter.GetFillRate();
+    }
+    SendSuccessfully(10, 0.2);
+    ASSERT_GE(limiter.GetFillRate(), 10.0);
+
+    // and past it, never more than twice the rate requests are actually sent at.
+    SendSuccessfully(10, 10);
+    ASSERT_NEAR(20.0, limiter.GetFillRate(), 0.5);
+}
+
+/**
+ * Stands in for a service endpoint which throttles requests, either the first few ones or the ones over a rate, the way
+ * DynamoDB does: with a 400 and a ThrottlingException JSON error.
+ */
+class ThrottlingHttpClient : public HttpClient
+{
+public:
+    ThrottlingHttpClient() :
+        m_throttledAttempts(0),
+        m_maxRequestsPerSecond(0),
+        m_tokens(0),
+        m_lastRefill(std::chrono::steady_clock::now()),
+        m_attempts(0),
+        m_throttled(0)
+    {
+    }
+
+    void SetThrottledAttempts(int throttledAttempts) { m_throttledAttempts = throttledAttempts; }
+
+    void SetMaxRequestsPerSecond(double maxRequestsPerSecond)
+    {
+        m_maxRequestsPerSecond = maxRequestsPerSecond;
+        m_tokens = maxRequestsPerSecond;
+    }
+
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        AWS_UNREFERENCED_PARAM(request);
+        AWS_UNREFERENCED_PARAM(readLimiter);
+        AWS_UNREFERENCED_PARAM(writeLimiter);
+        return nullptr;
+    }
+
+    std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+    {
+        AWS_UNREFERENCED_PARAM(readLimiter);
+        AWS_UNREFERENCED_PARAM(writeLimiter);
+
+        auto response = Aws::MakeShared<StandardHttpResponse>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, request);
+        if (ShouldThrottle())
+        {
+            m_throttled++;
+            response->SetResponseCode(HttpResponseCode::BAD_REQUEST);
+            response->GetResponseBody() << "{\"__type\":\"com.amazonaws.dynamodb.v20120810#ThrottlingException\",\"message\":\"Rate exceeded\"}";
+        }
+        else
+        {
+            response->SetResponseCode(HttpResponseCode::OK);
+            response->GetResponseBody() << "{}";
+        }
+        return response;
+    }
+
+    int GetAttempts() const { return m_attempts; }
+    int GetThrottled() const { return m_throttled; }
+
+private:
+    bool ShouldThrottle() const
+    {
+        int attempt = m_attempts++;
+        if (attempt < m_throttledAttempts)
+        {
+            return true;
+        }
+        if (m_maxRequestsPerSecond <= 0)
+        {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> locker(m_lock);
+        auto now = std::chrono::steady_clock::now();
+        m_tokens = (std::min)(m_maxRequestsPerSecond, m_tokens + std::chrono::duration<double>(now - m_lastRefill).count() * m_maxRequestsPerSecond);
+        m_lastRefill = now;
+        if (m_tokens < 1.0)
+        {
+            return true;
+        }
+        m_tokens -= 1.0;
+        return false;
+    }
+
+    int m_throttledAttempts;
+    double m_maxRequestsPerSecond;
+    mutable std::mutex m_lock;
+    mutable double m_tokens;
+    mutable std::chrono::steady_clock::time_point m_lastRefill;
+    mutable std::atomic<int> m_attempts;
+    mutable std::atomic<int> m_throttled;
+};
+
+class ThrottlingHttpClientFactory : public HttpClientFactory
+{
+public:
+    ThrottlingHttpClientFactory(const std::shared_ptr<ThrottlingHttpClient>& client) : m_client(client) {}
+
+    std::shared_ptr<HttpClient> CreateHttpClient(const ClientConfiguration& clientConfiguration) const override
+    {
+        AWS_UNREFERENCED_PARAM(clientConfiguration);
+        return m_client;
+    }
+
+    std::shared_ptr<HttpRequest> CreateHttpRequest(const Aws::String& uri, HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override
+    {
+        return CreateHttpRequest(URI(uri), method, streamFactory);
+    }
+
+    std::shared_ptr<HttpRequest> CreateHttpRequest(const URI& uri, HttpMethod method, const Aws::IOStreamFactory& streamFactory) const override
+    {
+        auto request = Aws::MakeShared<StandardHttpRequest>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, uri, method);
+        request->SetResponseStreamFactory(streamFactory);
+        return request;
+    }
+
+private:
+    std::shared_ptr<ThrottlingHttpClient> m_client;
+};
+
+class ThrottledServiceClient : public AWSJsonClient
+{
+public:
+    ThrottledServiceClient(const ClientConfiguration& config) : AWSJsonClient(config,
+        Aws::MakeShared<AWSAuthV4Signer>(RETRY_STRATEGY_TEST_ALLOCATION_TAG,
+            Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"),
+            "service", Aws::Region::US_EAST_1),
+        Aws::MakeShared<JsonErrorMarshaller>(RETRY_STRATEGY_TEST_ALLOCATION_TAG))
+    {
+    }
+
+    HttpResponseOutcome MakeRequest() const
+    {
+        AmazonWebServiceRequestMock request;
+        return AttemptExhaustively(URI("http://localhost/"), request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+    }
+
+    const char* GetServiceClientName() const override { return "ThrottledService"; }
+};
+
+class RetryStrategyClientTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<ThrottlingHttpClient> endpoint;
+
+    void SetUp()
+    {
+        endpoint = Aws::MakeShared<ThrottlingHttpClient>(RETRY_STRATEGY_TEST_ALLOCATION_TAG);
+        SetHttpClientFactory(Aws::MakeShared<ThrottlingHttpClientFactory>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, endpoint));
+    }
+
+    void TearDown()
+    {
+        endpoint = nullptr;
+        CleanupHttp();
+        InitHttp();
+    }
+
+    Aws::UniquePtr<ThrottledServiceClient> MakeClient(const std::shared_ptr<RetryStrategy>& retryStrategy)
+    {
+        ClientConfiguration config;
+        config.scheme = Scheme::HTTP;
+        config.retryStrategy = retryStrategy;
+        return Aws::MakeUnique<ThrottledServiceClient>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, config);
+    }
+};
+
+TEST_F(RetryStrategyClientTest, TestAdaptiveStrategyRetriesThrottlingAndLimitsSendRate)
+{
+    // a clock running fast enough for the limiter never to make the test wait.
+    auto fakeNow = std::make_shared<SendRateLimiter::ClockType::time_point>(SendRateLimiter::ClockType::now());
+    auto limiter = Aws::MakeShared<SendRateLimiter>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, [fakeNow]() { return *fakeNow += std::chrono::seconds(10); });
+    auto quota = Aws::MakeShared<RetryQuotaContainer>(RETRY_STRATEGY_TEST_ALLOCATION_TAG);
+    auto client = MakeClient(Aws::MakeShared<AdaptiveRetryStrategy>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, quota, limiter, 2, 0));
+    endpoint->SetThrottledAttempts(2);
+
+    auto outcome = client->MakeRequest();
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(3, endpoint->GetAttempts());
+    ASSERT_EQ(2, endpoint->GetThrottled());
+    // two retries taken, the one that succeeded given back.
+    ASSERT_EQ(RetryQuotaContainer::DEFAULT_RETRY_QUOTA - RetryQuotaContainer::RETRY_COST, quota->GetRetryQuota());
+    ASSERT_TRUE(limiter->IsEnabled());
+}
+
+TEST_F(RetryStrategyClientTest, TestClientsSharingStrategyShareRetryQuota)
+{
+    auto quota = Aws::MakeShared<RetryQuotaContainer>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, 20);
+    auto strategy = Aws::MakeShared<StandardRetryStrategy>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, quota, 3, 0);
+    auto client = MakeClient(strategy);
+    auto otherClient = MakeClient(strategy);
+    endpoint->SetThrottledAttempts(1000);
+
+    // 3 retries, then 1 more before the quota is used up, then none.
+    ASSERT_FALSE(client->MakeRequest().IsSuccess());
+    ASSERT_EQ(4, endpoint->GetAttempts());
+    ASSERT_FALSE(otherClient->MakeRequest().IsSuccess());
+    ASSERT_EQ(6, endpoint->GetAttempts());
+    ASSERT_FALSE(client->MakeRequest().IsSuccess());
+    ASSERT_EQ(7, endpoint->GetAttempts());
+    ASSERT_EQ(0, quota->GetRetryQuota());
+}
+
+// Many workers hammering an endpoint throttling them, with exponential backoff and with the adaptive strategy shared by all of them.
+TEST_F(RetryStrategyClientTest, DISABLED_RetryStormAgainstThrottlingEndpoint)
+{
+    static const int workers = 32;
+    static const int requestsPerWorker = 25;
+    const double maxRequestsPerSecond = 100;
+
+    auto run = [&](const char* name, const std::function<std::shared_ptr<RetryStrategy>()>& makeStrategy)
+    {
+        endpoint = Aws::MakeShared<ThrottlingHttpClient>(RETRY_STRATEGY_TEST_ALLOCATION_TAG);
+        endpoint->SetMaxRequestsPerSecond(maxRequestsPerSecond);
+        SetHttpClientFactory(Aws::MakeShared<ThrottlingHttpClientFactory>(RETRY_STRATEGY_TEST_ALLOCATION_TAG, endpoint));
+
+        std::atomic<int> failed(0);
+        auto start = std::chrono::steady_clock::now();
+        Aws::Vector<Aws::UniquePtr<ThrottledServiceClient>> clients;
+        Aws::Vector<std::thread> threads;
+        for (int i = 0; i < workers; ++i)
+        {
+            clients.push_back(MakeClient(makeStrategy()));
+            const ThrottledServiceClient* client = clients.back().get();
+            threads.emplace_back([&failed, client]()
+            {
+                for (int j = 0; j < requestsPerWorker; ++j)
+                {
+                    if (!client->MakeRequest().IsSuccess())
+                    {
+                        failed++;
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::cout << name << ": " << workers * requestsPerWorker << " requests, " << endpoint->GetAttempts() << " attempts, "
+            << endpoint->GetThrottled() << " throttled, " << failed << " failed, " << seconds << " s" << std::endl;
+    };
+
+    run("DefaultRetryStrategy", []() { return Aws::MakeShared<DefaultRetryStrategy>(RETRY_STRATEGY_TEST_ALLOCATION_TAG); });
+    auto adaptiveStrategy = Aws::MakeShared<AdaptiveRetryStrategy>(RETRY_STRATEGY_TEST_ALLOCATION_TAG);
+    run("AdaptiveRetryStrategy", [adaptiveStrategy]() { return adaptiveStrategy; });
+}
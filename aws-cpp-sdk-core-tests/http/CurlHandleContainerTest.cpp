@@ -0,0 +1,97 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#if ENABLE_CURL_CLIENT
+#include <aws/core/http/curl/CurlHandleContainer.h>
+#include <thread>
+
+using namespace Aws::Http;
+
+TEST(CurlHandleContainerTest, TestGrowsUpToMaxSize)
+{
+    CurlHandleContainer container(3);
+    CURL* first = container.AcquireCurlHandle("a:443");
+    CURL* second = container.AcquireCurlHandle("a:443");
+    CURL* third = container.AcquireCurlHandle("b:443");
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    ASSERT_NE(nullptr, third);
+
+    auto stats = container.GetStats();
+    ASSERT_EQ(3u, stats.poolSize);
+    ASSERT_EQ(3u, stats.misses);
+    ASSERT_EQ(0u, stats.hits);
+
+    container.ReleaseCurlHandle(first, "a:443");
+    container.ReleaseCurlHandle(second, "a:443");
+    container.ReleaseCurlHandle(third, "b:443");
+    // going back to the host they talked to, the handles keep their options.
+    ASSERT_EQ(0u, container.GetStats().resets);
+}
+
+TEST(CurlHandleContainerTest, TestPrefersHandleForSameHost)
+{
+    CurlHandleContainer container(2);
+    CURL* hostA = container.AcquireCurlHandle("a:443");
+    CURL* hostB = container.AcquireCurlHandle("b:443");
+    container.ReleaseCurlHandle(hostA, "a:443");
+    container.ReleaseCurlHandle(hostB, "b:443");
+
+    ASSERT_EQ(hostB, container.AcquireCurlHandle("b:443"));
+    ASSERT_EQ(hostA, container.AcquireCurlHandle("a:443"));
+    ASSERT_EQ(2u, container.GetStats().hits);
+    ASSERT_EQ(0u, container.GetStats().resets);
+
+    container.ReleaseCurlHandle(hostA, "a:443");
+    container.ReleaseCurlHandle(hostB, "b:443");
+
+    // A host nobody talked to yet takes over an idle handle instead of growing the pool.
+    CURL* hostC = container.AcquireCurlHandle("c:443");
+    ASSERT_TRUE(hostC == hostA || hostC == hostB);
+    ASSERT_EQ(2u, container.GetStats().poolSize);
+    ASSERT_EQ(1u, container.GetStats().resets);
+    container.ReleaseCurlHandle(hostC, "c:443");
+
+    // each host gets back the handle it released, without another reset.
+    CURL* other = hostC == hostA ? hostB : hostA;
+    ASSERT_EQ(other, container.AcquireCurlHandle(hostC == hostA ? "b:443" : "a:443"));
+    ASSERT_EQ(hostC, container.AcquireCurlHandle("c:443"));
+    ASSERT_EQ(1u, container.GetStats().resets);
+    container.ReleaseCurlHandle(other, hostC == hostA ? "b:443" : "a:443");
+    container.ReleaseCurlHandle(hostC, "c:443");
+}
+
+TEST(CurlHandleContainerTest, TestBlocksUntilHandleIsReleased)
+{
+    CurlHandleContainer container(1);
+    CURL* handle = container.AcquireCurlHandle("a:443");
+
+    std::thread releaser([&]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        container.ReleaseCurlHandle(handle, "a:443");
+    });
+
+    ASSERT_EQ(handle, container.AcquireCurlHandle("b:443"));
+    releaser.join();
+
+    auto stats = container.GetStats();
+    ASSERT_EQ(1u, stats.waits);
+    ASSERT_EQ(1u, stats.poolSize);
+    container.ReleaseCurlHandle(handle, "b:443");
+}
+#endif
@@ -29,3 +29,198 @@ TEST(HttpClientTest, TestNullResponse)
 	auto response = httpClient->MakeRequest(request);
 	ASSERT_EQ(nullptr, response);
 }
+
+#if ENABLE_CURL_CLIENT && defined(__linux__)
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+TEST(HttpClientTest, TestCurlMultiClientNullResponse)
+{
+    auto request = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws"),
+            HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    Aws::Client::ClientConfiguration config;
+    config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+    auto httpClient = CreateHttpClient(config);
+    auto response = httpClient->MakeRequest(request);
+    ASSERT_EQ(nullptr, response);
+}
+
+TEST(HttpClientTest, TestCurlMultiClientWithHttp2NullResponse)
+{
+    auto request = CreateHttpRequest(Aws::String("https://some.unknown1234xxx.test.aws"),
+            HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    Aws::Client::ClientConfiguration config;
+    config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+    config.enableHttp2 = true;
+    auto httpClient = CreateHttpClient(config);
+    auto response = httpClient->MakeRequest(request);
+    ASSERT_EQ(nullptr, response);
+}
+
+TEST(HttpClientTest, TestCurlMultiClientCompletesAsyncRequests)
+{
+    Aws::Client::ClientConfiguration config;
+    config.curlMultiIoThreads = 2;
+    CurlMultiHttpClient httpClient(config);
+
+    const int requestCount = 8;
+    std::atomic<int> completed(0);
+    std::mutex completionLock;
+    std::condition_variable completionSignal;
+
+    for (int i = 0; i < requestCount; ++i)
+    {
+        auto request = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws"),
+                HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        httpClient.MakeRequestAsync(request, [&](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& response)
+        {
+            ASSERT_EQ(nullptr, response);
+            std::lock_guard<std::mutex> locker(completionLock);
+            ++completed;
+            completionSignal.notify_one();
+        });
+    }
+
+    std::unique_lock<std::mutex> locker(completionLock);
+    ASSERT_TRUE(completionSignal.wait_for(locker, std::chrono::seconds(30), [&] { return completed == requestCount; }));
+}
+
+TEST(HttpClientTest, TestCurlMultiClientBlockingRequestFromEventLoopThread)
+{
+    Aws::Client::ClientConfiguration config;
+    CurlMultiHttpClient httpClient(config);
+    ASSERT_TRUE(httpClient.SupportsAsyncRequests());
+
+    std::mutex completionLock;
+    std::condition_variable completionSignal;
+    bool completed = false;
+
+    // waiting for the event loop from its own thread would never return, so the nested request is made on the calling thread.
+    auto request = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws"),
+            HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    httpClient.MakeRequestAsync(request, [&](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>&)
+    {
+        auto nestedRequest = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws"),
+                HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto nestedResponse = httpClient.MakeRequest(nestedRequest);
+        ASSERT_EQ(nullptr, nestedResponse);
+        std::lock_guard<std::mutex> locker(completionLock);
+        completed = true;
+        completionSignal.notify_one();
+    });
+
+    std::unique_lock<std::mutex> locker(completionLock);
+    ASSERT_TRUE(completionSignal.wait_for(locker, std::chrono::seconds(30), [&] { return completed; }));
+}
+
+TEST(HttpClientTest, TestDefaultClientWithHttp2IsCurlMultiClient)
+{
+    Aws::Client::ClientConfiguration config;
+    config.enableHttp2 = true;
+    auto httpClient = CreateHttpClient(config);
+    ASSERT_TRUE(httpClient->SupportsAsyncRequests());
+
+    config.httpLibOverride = TransferLibType::CURL_CLIENT;
+    auto curlClient = CreateHttpClient(config);
+    ASSERT_FALSE(curlClient->SupportsAsyncRequests());
+    auto request = CreateHttpRequest(Aws::String("https://some.unknown1234xxx.test.aws"),
+            HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    ASSERT_EQ(nullptr, curlClient->MakeRequest(request));
+}
+#endif
+
+#if ENABLE_CURL_CLIENT
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <cstring>
+
+namespace
+{
+    /**
+     * Hands chunks of a response body to curl's write callback the way curl does during a transfer.
+     */
+    class WriteDataCurlHttpClient : public CurlHttpClient
+    {
+    public:
+        WriteDataCurlHttpClient() : CurlHttpClient(Aws::Client::ClientConfiguration()) {}
+
+        size_t Write(CurlWriteCallbackContext& context, const char* chunk) const
+        {
+            Aws::Vector<char> data(chunk, chunk + strlen(chunk));
+            return WriteData(data.data(), 1, data.size(), &context);
+        }
+    };
+}
+
+TEST(HttpClientTest, TestCurlWriteDataFillsResponseBodyBuffers)
+{
+    unsigned char first[4] = {};
+    unsigned char second[6] = {};
+    ResponseBodyBufferList bodyBuffers;
+    bodyBuffers.push_back(ResponseBodyBuffer(first, sizeof(first)));
+    bodyBuffers.push_back(ResponseBodyBuffer(second, sizeof(second)));
+    auto request = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws"),
+            HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    request->SetResponseBodyBuffers(bodyBuffers);
+    long long receivedBytes = 0;
+    request->SetDataReceivedEventHandler([&receivedBytes](const HttpRequest*, HttpResponse*, long long amount) { receivedBytes += amount; });
+    Standard::StandardHttpResponse response(request);
+    response.SetResponseCode(HttpResponseCode::OK);
+
+    WriteDataCurlHttpClient httpClient;
+    CurlWriteCallbackContext context(&httpClient, request.get(), &response, nullptr);
+    // the second chunk spans both buffers and fills them exactly.
+    ASSERT_EQ(3u, httpClient.Write(context, "abc"));
+    ASSERT_EQ(7u, httpClient.Write(context, "defghij"));
+
+    ASSERT_EQ(0, memcmp("abcd", first, sizeof(first)));
+    ASSERT_EQ(0, memcmp("efghij", second, sizeof(second)));
+    ASSERT_EQ(10u, response.GetResponseBodyBufferedBytes());
+    ASSERT_EQ(10, receivedBytes);
+    ASSERT_EQ(EOF, response.GetResponseBody().peek());
+}
+
+TEST(HttpClientTest, TestCurlWriteDataAbortsBodyLargerThanBuffers)
+{
+    unsigned char buffer[4] = {};
+    ResponseBodyBufferList bodyBuffers;
+    bodyBuffers.push_back(ResponseBodyBuffer(buffer, sizeof(buffer)));
+    auto request = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws"),
+            HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    request->SetResponseBodyBuffers(bodyBuffers);
+    Standard::StandardHttpResponse response(request);
+    response.SetResponseCode(HttpResponseCode::PARTIAL_CONTENT);
+
+    WriteDataCurlHttpClient httpClient;
+    CurlWriteCallbackContext context(&httpClient, request.get(), &response, nullptr);
+    ASSERT_EQ(3u, httpClient.Write(context, "abc"));
+    ASSERT_EQ(0u, httpClient.Write(context, "de"));
+    ASSERT_EQ(3u, response.GetResponseBodyBufferedBytes());
+}
+
+TEST(HttpClientTest, TestCurlWriteDataLeavesErrorBodiesInStream)
+{
+    unsigned char buffer[4] = {};
+    ResponseBodyBufferList bodyBuffers;
+    bodyBuffers.push_back(ResponseBodyBuffer(buffer, sizeof(buffer)));
+    auto request = CreateHttpRequest(Aws::String("http://some.unknown1234xxx.test.aws"),
+            HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    request->SetResponseBodyBuffers(bodyBuffers);
+    Standard::StandardHttpResponse response(request);
+    response.SetResponseCode(HttpResponseCode::NOT_FOUND);
+
+    WriteDataCurlHttpClient httpClient;
+    CurlWriteCallbackContext context(&httpClient, request.get(), &response, nullptr);
+    // larger than the buffers, which doesn't matter for a body that doesn't go to them.
+    ASSERT_EQ(16u, httpClient.Write(context, "<Error>NoSuchKey"));
+
+    Aws::StringStream body;
+    body << response.GetResponseBody().rdbuf();
+    ASSERT_STREQ("<Error>NoSuchKey", body.str().c_str());
+    ASSERT_EQ(0u, response.GetResponseBodyBufferedBytes());
+    ASSERT_EQ(0, buffer[0]);
+}
+#endif
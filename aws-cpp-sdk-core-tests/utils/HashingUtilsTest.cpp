@@ -16,8 +16,18 @@
 #include <aws/external/gtest.h>
 
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/base64/Base64.h>
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/Sha256.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
+#include <chrono>
+#include <cstring>
+#include <iostream>
 
 using namespace Aws::Utils;
 
@@ -318,3 +328,389 @@ TEST(HashingUtilsTest, TestMD5FromStream)
     TestMD5FromStream( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", "V+30oivjyVWsSdouIQe2eg==" );
 }
 
+static void TestIncrementalHashEqualsCalculate(Aws::Utils::Crypto::Hash& hash)
+{
+    Aws::String value;
+    for (int i = 0; i < 1000; ++i)
+    {
+        value.push_back(static_cast<char>('a' + i % 26));
+    }
+
+    // split the input every few bytes, the result must not depend on where it is split. Empty updates change nothing.
+    for (size_t step : {1uL, 7uL, 64uL, 333uL, 1000uL})
+    {
+        for (size_t position = 0; position < value.size(); position += step)
+        {
+            hash.Update(reinterpret_cast<const unsigned char*>(value.c_str()) + position, (std::min)(step, value.size() - position));
+            hash.Update(reinterpret_cast<const unsigned char*>(value.c_str()), 0);
+        }
+        ASSERT_EQ(HashingUtils::HexEncode(hash.Calculate(value).GetResult()), HashingUtils::HexEncode(hash.GetHash().GetResult()));
+    }
+
+    // GetHash starts over, with nothing added it is the hash of the empty string.
+    ASSERT_EQ(HashingUtils::HexEncode(hash.Calculate("").GetResult()), HashingUtils::HexEncode(hash.GetHash().GetResult()));
+}
+
+// A hash written before Update and GetHash existed, which only knows how to Calculate.
+class CalculateOnlyMD5 : public Aws::Utils::Crypto::Hash
+{
+public:
+    Aws::Utils::Crypto::HashResult Calculate(const Aws::String& str) override { return m_md5.Calculate(str); }
+    Aws::Utils::Crypto::HashResult Calculate(Aws::IStream& stream) override { return m_md5.Calculate(stream); }
+
+private:
+    Aws::Utils::Crypto::MD5 m_md5;
+};
+
+TEST(HashingUtilsTest, TestIncrementalDefaultsToCalculate)
+{
+    CalculateOnlyMD5 md5;
+    TestIncrementalHashEqualsCalculate(md5);
+    ASSERT_EQ("d41d8cd98f00b204e9800998ecf8427e", HashingUtils::HexEncode(md5.GetHash().GetResult()));
+}
+
+TEST(HashingUtilsTest, TestMD5Incremental)
+{
+    Aws::Utils::Crypto::MD5 md5;
+    TestIncrementalHashEqualsCalculate(md5);
+    ASSERT_EQ("d41d8cd98f00b204e9800998ecf8427e", HashingUtils::HexEncode(md5.GetHash().GetResult()));
+}
+
+TEST(HashingUtilsTest, TestSHA256Incremental)
+{
+    Aws::Utils::Crypto::Sha256 sha256;
+    TestIncrementalHashEqualsCalculate(sha256);
+    ASSERT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", HashingUtils::HexEncode(sha256.GetHash().GetResult()));
+}
+
+TEST(HashingUtilsTest, TestCRC32Incremental)
+{
+    Aws::Utils::Crypto::CRC32 crc32;
+    TestIncrementalHashEqualsCalculate(crc32);
+    Aws::Utils::Crypto::CRC32C crc32c;
+    TestIncrementalHashEqualsCalculate(crc32c);
+}
+
+TEST(HashingUtilsTest, TestCRC32KnownValues)
+{
+    ASSERT_EQ("00000000", HashingUtils::HexEncode(HashingUtils::CalculateCRC32("")));
+    ASSERT_EQ("cbf43926", HashingUtils::HexEncode(HashingUtils::CalculateCRC32("123456789")));
+    ASSERT_EQ("414fa339", HashingUtils::HexEncode(HashingUtils::CalculateCRC32("The quick brown fox jumps over the lazy dog")));
+
+    ASSERT_EQ("00000000", HashingUtils::HexEncode(HashingUtils::CalculateCRC32C("")));
+    ASSERT_EQ("e3069283", HashingUtils::HexEncode(HashingUtils::CalculateCRC32C("123456789")));
+    ASSERT_EQ("22620404", HashingUtils::HexEncode(HashingUtils::CalculateCRC32C("The quick brown fox jumps over the lazy dog")));
+
+    Aws::StringStream stream;
+    stream.str("123456789");
+    ASSERT_EQ("cbf43926", HashingUtils::HexEncode(HashingUtils::CalculateCRC32(stream)));
+    stream.clear();
+    stream.str("123456789");
+    ASSERT_EQ("e3069283", HashingUtils::HexEncode(HashingUtils::CalculateCRC32C(stream)));
+}
+
+static uint32_t BitwiseCrc(const unsigned char* data, size_t length, uint32_t polynomial)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; ++i)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc >> 1) ^ (polynomial & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+TEST(HashingUtilsTest, TestCRC32MatchesBitwiseReference)
+{
+    // lengths and alignments around the block sizes of the hardware and table implementations.
+    Aws::Vector<unsigned char> data(1200);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<unsigned char>((i * 131 + 7) ^ (i >> 3));
+    }
+
+    for (size_t offset = 0; offset < 9; ++offset)
+    {
+        for (size_t length = 0; length + offset <= data.size(); length += (length < 300 ? 1 : 97))
+        {
+            const unsigned char* begin = data.data() + offset;
+            ASSERT_EQ(BitwiseCrc(begin, length, 0xEDB88320), Aws::Utils::Crypto::CRC32::Checksum(begin, length));
+            ASSERT_EQ(BitwiseCrc(begin, length, 0x82F63B78), Aws::Utils::Crypto::CRC32C::Checksum(begin, length));
+        }
+    }
+
+    // continuing a checksum is the same as computing it in one go.
+    uint32_t crc = Aws::Utils::Crypto::CRC32::Checksum(data.data(), 500);
+    ASSERT_EQ(BitwiseCrc(data.data(), data.size(), 0xEDB88320), Aws::Utils::Crypto::CRC32::Checksum(data.data() + 500, data.size() - 500, crc));
+    crc = Aws::Utils::Crypto::CRC32C::Checksum(data.data(), 77);
+    ASSERT_EQ(BitwiseCrc(data.data(), data.size(), 0x82F63B78), Aws::Utils::Crypto::CRC32C::Checksum(data.data() + 77, data.size() - 77, crc));
+}
+
+TEST(HashingUtilsTest, TestHashStringKnownValues)
+{
+    // generated enum mappers switch on these hashes, computed by the code generator, which has to hash the same way.
+    ASSERT_EQ(0, HashingUtils::HashString(""));
+    ASSERT_EQ(0, HashingUtils::HashString(nullptr));
+    ASSERT_EQ(2112, HashingUtils::HashString("Aa"));
+    ASSERT_EQ(2112, HashingUtils::HashString("BB"));
+    ASSERT_EQ(-2033592365, HashingUtils::HashString("t1.micro"));
+}
+
+static const char BASE64_URL_TABLE[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// byte at a time codecs the vectorized ones have to match.
+static Aws::String ReferenceBase64Encode(const unsigned char* data, size_t length, const char* table)
+{
+    Aws::String encoded;
+    for (size_t i = 0; i < length; i += 3)
+    {
+        uint32_t block = static_cast<uint32_t>(data[i]) << 16;
+        block |= i + 1 < length ? static_cast<uint32_t>(data[i + 1]) << 8 : 0;
+        block |= i + 2 < length ? data[i + 2] : 0;
+        encoded += table[(block >> 18) & 0x3F];
+        encoded += table[(block >> 12) & 0x3F];
+        encoded += i + 1 < length ? table[(block >> 6) & 0x3F] : '=';
+        encoded += i + 2 < length ? table[block & 0x3F] : '=';
+    }
+    return encoded;
+}
+
+static Aws::Vector<unsigned char> ReferenceBase64Decode(const Aws::String& encoded)
+{
+    uint8_t table[256] = {};
+    const char* mime = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    for (uint8_t i = 0; i < 64; ++i)
+    {
+        table[static_cast<unsigned char>(mime[i])] = i;
+    }
+    table[static_cast<unsigned char>('=')] = 255;
+
+    Aws::Vector<unsigned char> decoded(Aws::Utils::Base64::Base64::CalculateBase64DecodedLength(encoded));
+    for (size_t i = 0; i + 4 <= encoded.size(); i += 4)
+    {
+        uint32_t values[4];
+        for (size_t j = 0; j < 4; ++j)
+        {
+            values[j] = table[static_cast<unsigned char>(encoded[i + j])];
+        }
+        size_t index = i / 4 * 3;
+        unsigned char bytes[3] = { static_cast<unsigned char>((values[0] << 2) | ((values[1] >> 4) & 0x03)),
+            static_cast<unsigned char>(((values[1] << 4) & 0xF0) | ((values[2] >> 2) & 0x0F)),
+            static_cast<unsigned char>((values[2] & 0x03) << 6 | values[3]) };
+        size_t count = values[2] == 255 ? 1 : (values[3] == 255 ? 2 : 3);
+        for (size_t j = 0; j < count && index + j < decoded.size(); ++j)
+        {
+            decoded[index + j] = bytes[j];
+        }
+    }
+    return decoded;
+}
+
+static Aws::Vector<unsigned char> ReferenceHexDecode(const Aws::String& str)
+{
+    Aws::Vector<unsigned char> decoded;
+    for (size_t i = str.compare(0, 2, "0x") == 0 ? 2 : 0; i + 1 < str.size(); i += 2)
+    {
+        unsigned char value = 0;
+        for (size_t j = 0; j < 2; ++j)
+        {
+            char c = str[i + j];
+            value = static_cast<unsigned char>(value * 16 + (isalpha(c) ? toupper(c) - 'A' + 10 : c - '0'));
+        }
+        decoded.push_back(value);
+    }
+    return decoded;
+}
+
+static Aws::Vector<unsigned char> TestBytes(size_t length)
+{
+    Aws::Vector<unsigned char> data(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        data[i] = static_cast<unsigned char>((i * 167 + 13) ^ (i >> 2));
+    }
+    return data;
+}
+
+TEST(HashingUtilsTest, TestBase64MatchesReference)
+{
+    Aws::Vector<unsigned char> data = TestBytes(400);
+    Aws::Utils::Base64::Base64 urlBase64(BASE64_URL_TABLE);
+    Aws::Vector<char> encoded(Aws::Utils::Base64::Base64::CalculateBase64EncodedLength(data.size()) + 1, '*');
+    Aws::Vector<unsigned char> decoded(data.size() + 1);
+
+    // every length at every alignment goes through the vector loops and the scalar code after them.
+    for (size_t offset = 0; offset < 4; ++offset)
+    {
+        for (size_t length = 0; length + offset <= data.size(); ++length)
+        {
+            const unsigned char* begin = data.data() + offset;
+            Aws::String expected = ReferenceBase64Encode(begin, length, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+            encoded[expected.size()] = '*';
+            size_t encodedLength = HashingUtils::Base64Encode(begin, length, encoded.data());
+            ASSERT_EQ(expected, Aws::String(encoded.data(), encodedLength));
+            ASSERT_EQ('*', encoded[encodedLength]);
+            ASSERT_EQ(ReferenceBase64Encode(begin, length, BASE64_URL_TABLE), urlBase64.Encode(ByteBuffer(begin, length)));
+
+            decoded[length] = 0xA5;
+            ASSERT_EQ(length, HashingUtils::Base64Decode(expected.c_str(), expected.size(), decoded.data()));
+            ASSERT_EQ(0, memcmp(begin, decoded.data(), length));
+            ASSERT_EQ(0xA5, decoded[length]);
+        }
+    }
+}
+
+TEST(HashingUtilsTest, TestBase64DecodeMalformedMatchesReference)
+{
+    Aws::Vector<unsigned char> data = TestBytes(300);
+    Aws::String valid = HashingUtils::Base64Encode(ByteBuffer(data.data(), data.size()));
+
+    // chars outside of the table, or padding, anywhere make the vector loops hand over to the scalar code, which decodes them as it always did.
+    const char replacements[] = { '=', '*', '\x80', '\xff', '-' };
+    for (char replacement : replacements)
+    {
+        for (size_t position = 0; position < valid.size(); position += 7)
+        {
+            Aws::String malformed = valid;
+            malformed[position] = replacement;
+            Aws::Vector<unsigned char> expected = ReferenceBase64Decode(malformed);
+            // blocks with padding in them leave bytes out.
+            Aws::Vector<unsigned char> decoded(expected.size());
+            ASSERT_EQ(expected.size(), HashingUtils::Base64Decode(malformed.c_str(), malformed.size(), decoded.data()));
+            ASSERT_EQ(expected, decoded);
+        }
+    }
+
+    ASSERT_EQ(0u, HashingUtils::Base64Decode("=").GetLength());
+    // the block decodes to 2 bytes, more than the length computed from the padding, which is all that is written.
+    ByteBuffer truncated = HashingUtils::Base64Decode("Zm8==");
+    ASSERT_EQ(1u, truncated.GetLength());
+    ASSERT_EQ('f', truncated[0]);
+}
+
+TEST(HashingUtilsTest, TestHexMatchesReference)
+{
+    Aws::Vector<unsigned char> data = TestBytes(300);
+    Aws::Vector<char> encoded(2 * data.size() + 1, '*');
+    Aws::Vector<unsigned char> decoded(data.size() + 1);
+
+    for (size_t offset = 0; offset < 4; ++offset)
+    {
+        for (size_t length = 0; length + offset <= data.size(); ++length)
+        {
+            const unsigned char* begin = data.data() + offset;
+            Aws::String expected;
+            for (size_t i = 0; i < length; ++i)
+            {
+                expected += "0123456789abcdef"[begin[i] >> 4];
+                expected += "0123456789abcdef"[begin[i] & 0x0F];
+            }
+            encoded[2 * length] = '*';
+            ASSERT_EQ(2 * length, HashingUtils::HexEncode(begin, length, encoded.data()));
+            ASSERT_EQ(expected, Aws::String(encoded.data(), 2 * length));
+            ASSERT_EQ('*', encoded[2 * length]);
+
+            Aws::String upper = StringUtils::ToUpper(expected.c_str());
+            decoded[length] = 0xA5;
+            ASSERT_EQ(length, HashingUtils::HexDecode(upper.c_str(), upper.size(), decoded.data()));
+            ASSERT_EQ(0, memcmp(begin, decoded.data(), length));
+            ASSERT_EQ(0xA5, decoded[length]);
+        }
+    }
+
+    Aws::String prefixed = "0x" + HashingUtils::HexEncode(ByteBuffer(data.data(), data.size()));
+    ASSERT_EQ(ByteBuffer(data.data(), data.size()), HashingUtils::HexDecode(prefixed));
+    ASSERT_EQ(0u, HashingUtils::HexDecode("abc", 3, decoded.data()));
+
+    // letters past f aren't hex digits, the vector loops leave them to the scalar code.
+    Aws::String invalid = HashingUtils::HexEncode(ByteBuffer(data.data(), data.size()));
+    invalid[100] = 'g';
+    invalid[250] = 'Z';
+    Aws::Vector<unsigned char> expected = ReferenceHexDecode(invalid);
+    ASSERT_EQ(expected.size(), HashingUtils::HexDecode(invalid.c_str(), invalid.size(), decoded.data()));
+    ASSERT_EQ(0, memcmp(expected.data(), decoded.data(), expected.size()));
+}
+
+TEST(HashingUtilsTest, DISABLED_CodecThroughput)
+{
+    Aws::Vector<unsigned char> data = TestBytes(1024 * 1024);
+    Aws::Vector<char> encoded(2 * data.size());
+    Aws::Vector<unsigned char> decoded(data.size());
+    const size_t iterations = 50;
+    double megabytes = static_cast<double>(data.size() * iterations) / (1024 * 1024);
+    auto throughput = [megabytes](std::chrono::steady_clock::time_point start)
+    {
+        return megabytes * 1000000 / std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    Aws::String reference;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        reference = ReferenceBase64Encode(data.data(), data.size(), BASE64_URL_TABLE);
+    }
+    double referenceEncode = throughput(start);
+
+    Aws::Utils::Base64::Base64 urlBase64(BASE64_URL_TABLE);
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        urlBase64.Encode(data.data(), data.size(), encoded.data());
+    }
+    double scalarEncode = throughput(start);
+
+    start = std::chrono::steady_clock::now();
+    size_t encodedLength = 0;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        encodedLength = HashingUtils::Base64Encode(data.data(), data.size(), encoded.data());
+    }
+    double vectorEncode = throughput(start);
+
+    Aws::String base64(encoded.data(), encodedLength);
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        ReferenceBase64Decode(base64);
+    }
+    double referenceDecode = throughput(start);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        HashingUtils::Base64Decode(base64.c_str(), base64.size(), decoded.data());
+    }
+    double vectorDecode = throughput(start);
+    ASSERT_EQ(0, memcmp(data.data(), decoded.data(), data.size()));
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        HashingUtils::HexEncode(data.data(), data.size(), encoded.data());
+    }
+    double hexEncode = throughput(start);
+
+    Aws::String hex(encoded.data(), 2 * data.size());
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        ReferenceHexDecode(hex);
+    }
+    double referenceHexDecode = throughput(start);
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        HashingUtils::HexDecode(hex.c_str(), hex.size(), decoded.data());
+    }
+    double vectorHexDecode = throughput(start);
+    ASSERT_EQ(0, memcmp(data.data(), decoded.data(), data.size()));
+
+    std::cout << "MB/s of binary data. base64 encode: reference " << referenceEncode << ", scalar " << scalarEncode
+        << ", dispatched " << vectorEncode << "; base64 decode: reference " << referenceDecode << ", dispatched " << vectorDecode
+        << "; hex encode: dispatched " << hexEncode << "; hex decode: reference " << referenceHexDecode << ", dispatched "
+        << vectorHexDecode << std::endl;
+}
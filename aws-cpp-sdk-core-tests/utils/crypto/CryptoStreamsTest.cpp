@@ -19,6 +19,7 @@
 #include <aws/core/utils/crypto/CryptoStream.h>
 #include <aws/core/utils/memory/stl/AWSQueue.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/crypto/Factories.h>
 
@@ -725,6 +726,49 @@ TEST(CryptoStreamsTest, TestLiveSymmetricCipher)
         ASSERT_STREQ(data_raw.c_str(), plainTextOutput.c_str());
     }
 }
+
+TEST(CryptoStreamsTest, TestLiveCipherAcrossManyBufferFills)
+{
+    Aws::String plainText;
+    for (size_t i = 0; i < 5000; ++i)
+    {
+        plainText.push_back(static_cast<char>('a' + i % 26));
+    }
+    CryptoBuffer key = SymmetricCipher::GenerateKey();
+    auto cipher = CreateAES_CBCImplementation(key);
+    CryptoBuffer iv = cipher->GetIV();
+
+    // a buffer size that is neither a multiple of the block size nor of the data, with ungets across the refills of the get area.
+    Aws::String cipherText;
+    {
+        Aws::IStringStream is(plainText);
+        SymmetricCryptoStream stream((std::istream&)is, CipherMode::Encrypt, *cipher, 37);
+        char c;
+        while (stream.get(c))
+        {
+            if (cipherText.size() % 37 == 0 && stream.unget())
+            {
+                ASSERT_TRUE(static_cast<bool>(stream.get(c)));
+            }
+            cipherText.push_back(c);
+        }
+    }
+    ASSERT_EQ((plainText.size() / 16 + 1) * 16, cipherText.size());
+
+    auto oneShotCipher = CreateAES_CBCImplementation(key, iv);
+    CryptoBuffer oneShot = oneShotCipher->EncryptBuffer(CryptoBuffer(reinterpret_cast<const unsigned char*>(plainText.c_str()), plainText.size()));
+    CryptoBuffer oneShotFinal = oneShotCipher->FinalizeEncryption();
+    ASSERT_EQ(HashingUtils::HexEncode(CryptoBuffer({&oneShot, &oneShotFinal})),
+        HashingUtils::HexEncode(CryptoBuffer(reinterpret_cast<const unsigned char*>(cipherText.c_str()), cipherText.size())));
+
+    auto decryptionCipher = CreateAES_CBCImplementation(key, iv);
+    Aws::OStringStream os;
+    {
+        SymmetricCryptoStream stream(os, CipherMode::Decrypt, *decryptionCipher, 37);
+        stream.write(cipherText.c_str(), cipherText.size());
+    }
+    ASSERT_EQ(plainText, os.str());
+}
 #endif
 
 #endif // NO_SYMMETRIC_ENCRYPTION
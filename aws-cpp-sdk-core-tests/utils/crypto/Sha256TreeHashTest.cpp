@@ -0,0 +1,116 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/crypto/Sha256TreeHash.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <thread>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const size_t ONE_MB = 1024 * 1024;
+// tree hash of 8MB of '0', generated by the java example code at
+// http://docs.aws.amazon.com/amazonglacier/latest/dev/checksum-calculations.html#checksum-calculations-examples
+static const char EIGHT_MB_TREE_HASH[] = "ff9ea39186cb33cd5ade7aca078e297a1622f8c1abdd4cc47bcbf66dc5877e1f";
+// and of 5.5MB of '0'
+static const char FIVE_POINT_FIVE_MB_TREE_HASH[] = "154e26c78fd74d0c2c9b3cc4644191619dc4f2cd539ae2a74d5fd07957a3ee6a";
+
+static const unsigned char* Bytes(const Aws::String& str, size_t offset = 0)
+{
+    return reinterpret_cast<const unsigned char*>(str.c_str()) + offset;
+}
+
+TEST(Sha256TreeHashTest, TestWholeArchiveInOneUpdate)
+{
+    Aws::String data(8 * ONE_MB, '0');
+    Sha256TreeHash treeHash;
+    ASSERT_TRUE(treeHash.Update(0, Bytes(data), data.size()));
+    ASSERT_EQ(EIGHT_MB_TREE_HASH, HashingUtils::HexEncode(treeHash.GetHash()));
+
+    treeHash.Reset();
+    data.resize(5767168);
+    ASSERT_TRUE(treeHash.Update(0, Bytes(data), data.size()));
+    ASSERT_EQ(FIVE_POINT_FIVE_MB_TREE_HASH, HashingUtils::HexEncode(treeHash.GetHash()));
+}
+
+TEST(Sha256TreeHashTest, TestEmptyArchive)
+{
+    Sha256TreeHash treeHash;
+    ASSERT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", HashingUtils::HexEncode(treeHash.GetHash()));
+}
+
+TEST(Sha256TreeHashTest, TestPartsOutOfOrderOnExecutor)
+{
+    Aws::String data(8 * ONE_MB, '0');
+    Threading::PooledThreadExecutor executor(4);
+    Sha256TreeHash treeHash(&executor, 4);
+
+    // 2MB parts added from several threads in reverse order, their leaves hashed on the executor.
+    Aws::Vector<std::thread> threads;
+    for (size_t part = 4; part > 0; --part)
+    {
+        size_t offset = (part - 1) * 2 * ONE_MB;
+        threads.emplace_back([&treeHash, &data, offset]() { ASSERT_TRUE(treeHash.Update(offset, Bytes(data, offset), 2 * ONE_MB)); });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(EIGHT_MB_TREE_HASH, HashingUtils::HexEncode(treeHash.GetHash()));
+}
+
+TEST(Sha256TreeHashTest, TestPartHashesFromLeafHashes)
+{
+    Aws::String data(5767168, '0');
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<char>('a' + (i / 4096) % 26);
+    }
+
+    Sha256TreeHash treeHash;
+    ASSERT_TRUE(treeHash.Update(0, Bytes(data), data.size()));
+
+    // parts of a multipart upload are a power of two MBs, the last one may be shorter.
+    for (size_t partSize : {ONE_MB, 2 * ONE_MB, 4 * ONE_MB})
+    {
+        for (size_t offset = 0; offset < data.size(); offset += partSize)
+        {
+            size_t length = (std::min)(partSize, data.size() - offset);
+            ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateSHA256TreeHash(data.substr(offset, length))),
+                HashingUtils::HexEncode(treeHash.GetRangeHash(offset, length)));
+        }
+    }
+    ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateSHA256TreeHash(data)), HashingUtils::HexEncode(treeHash.GetHash()));
+}
+
+TEST(Sha256TreeHashTest, TestMissingAndMisalignedLeaves)
+{
+    Aws::String data(3 * ONE_MB, '0');
+    Sha256TreeHash treeHash;
+    ASSERT_FALSE(treeHash.Update(ONE_MB / 2, Bytes(data), ONE_MB));
+
+    ASSERT_TRUE(treeHash.Update(2 * ONE_MB, Bytes(data), ONE_MB));
+    ASSERT_EQ(0u, treeHash.GetHash().GetLength());
+    ASSERT_EQ(0u, treeHash.GetRangeHash(0, 3 * ONE_MB).GetLength());
+    ASSERT_EQ(32u, treeHash.GetRangeHash(2 * ONE_MB, ONE_MB).GetLength());
+    ASSERT_EQ(0u, treeHash.GetRangeHash(2 * ONE_MB, 2 * ONE_MB).GetLength());
+
+    ASSERT_TRUE(treeHash.Update(0, Bytes(data), 2 * ONE_MB));
+    ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateSHA256TreeHash(data)), HashingUtils::HexEncode(treeHash.GetHash()));
+}
@@ -0,0 +1,96 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/json/JsonArena.h>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace Aws::Utils::Json;
+
+TEST(JsonArenaTest, TestAllocationsAreAlignedAndDistinct)
+{
+    JsonArena arena;
+    ASSERT_EQ(0u, arena.GetCapacity());
+
+    char* previous = nullptr;
+    for (size_t size = 1; size < 200; ++size)
+    {
+        auto memory = static_cast<char*>(arena.Allocate(size));
+        ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(memory) % alignof(double));
+        memset(memory, 0x5A, size);
+        ASSERT_NE(previous, memory);
+        previous = memory;
+    }
+    ASSERT_GT(arena.GetCapacity(), 0u);
+
+    const char* copy = arena.CopyString("abc", 2);
+    ASSERT_STREQ("ab", copy);
+    ASSERT_STREQ("", arena.CopyString(nullptr, 0));
+
+    arena.Clear();
+    ASSERT_EQ(0u, arena.GetCapacity());
+}
+
+TEST(JsonArenaTest, TestLargeAllocation)
+{
+    JsonArena arena;
+    char* small = static_cast<char*>(arena.Allocate(16));
+    char* large = static_cast<char*>(arena.Allocate(1024 * 1024));
+    memset(large, 1, 1024 * 1024);
+    ASSERT_GE(arena.GetCapacity(), 1024u * 1024u);
+
+    // what is left of the block the small allocation came from is still used.
+    char* next = static_cast<char*>(arena.Allocate(16));
+    ASSERT_EQ(small + 16, next);
+}
+
+TEST(JsonArenaTest, TestAdoptKeepsMemoryAlive)
+{
+    JsonArena parent;
+    char* parentString = parent.CopyString("parent", 6);
+
+    char* childString = nullptr;
+    size_t childCapacity = 0;
+    {
+        JsonArena child;
+        childString = child.CopyString("child", 5);
+        childCapacity = child.GetCapacity();
+        size_t parentCapacity = parent.GetCapacity();
+        parent.Adopt(child);
+        ASSERT_EQ(0u, child.GetCapacity());
+        ASSERT_EQ(parentCapacity + childCapacity, parent.GetCapacity());
+        // adopting an empty arena or itself changes nothing.
+        parent.Adopt(child);
+        parent.Adopt(parent);
+        ASSERT_EQ(parentCapacity + childCapacity, parent.GetCapacity());
+    }
+
+    ASSERT_STREQ("parent", parentString);
+    ASSERT_STREQ("child", childString);
+
+    JsonArena moved(std::move(parent));
+    ASSERT_EQ(0u, parent.GetCapacity());
+    ASSERT_STREQ("child", childString);
+    moved.Allocate(8);
+
+    JsonArena assigned;
+    assigned.Allocate(8);
+    assigned = std::move(moved);
+    ASSERT_EQ(0u, moved.GetCapacity());
+    ASSERT_STREQ("parent", parentString);
+}
@@ -0,0 +1,313 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <chrono>
+#include <iostream>
+
+using namespace Aws::Utils::Json;
+using namespace Aws::Utils;
+
+static const char QUERY_RESPONSE[] = "{\"Count\":2,\"Items\":[{\"Id\":{\"N\":\"101\"},\"Name\":{\"S\":\"caf\\u00e9 \\\"au lait\\\"\\n\"}},"
+    "{\"Id\":{\"N\":\"-2.5e3\"},\"Tags\":{\"SS\":[\"a\",\"b\\ud83d\\ude00\"]},\"Nested\":{\"M\":{\"x\":{\"NULL\":true},\"y\":{\"L\":[]}}}}],"
+    " \"ScannedCount\" : 1234567890123, \"Ratio\": 0.75, \"Done\": false, \"Unknown\": {\"a\":[1,{\"b\":null}]} }";
+
+// reads the whole document token by token into a canonical text, to compare the outcome of different ways of feeding it.
+static Aws::String ReadTokens(JsonReader& reader)
+{
+    Aws::StringStream ss;
+    for (;;)
+    {
+        JsonTokenType type = reader.Next();
+        EXPECT_NE(JsonTokenType::NeedMoreInput, type);
+        if (type == JsonTokenType::EndOfDocument || type == JsonTokenType::Error || type == JsonTokenType::NeedMoreInput)
+        {
+            break;
+        }
+        ss << static_cast<int>(type);
+        if (type == JsonTokenType::MemberName || type == JsonTokenType::String || type == JsonTokenType::Number)
+        {
+            ss << ":" << reader.GetTokenText();
+        }
+        ss << "|";
+    }
+    return ss.str();
+}
+
+TEST(JsonReaderTest, TestReadStructuredDocument)
+{
+    Aws::StringStream input(QUERY_RESPONSE);
+    JsonReader reader(input, 7);
+
+    int count = 0;
+    int64_t scannedCount = 0;
+    double ratio = 0;
+    bool done = true;
+    Aws::Vector<Aws::String> names;
+    Aws::Vector<Aws::String> tags;
+    ASSERT_TRUE(reader.StartObject());
+    while (reader.NextMember())
+    {
+        if (reader.GetMemberName() == "Count")
+        {
+            count = reader.ReadInteger();
+        }
+        else if (reader.GetMemberName() == "ScannedCount")
+        {
+            scannedCount = reader.ReadInt64();
+        }
+        else if (reader.GetMemberName() == "Ratio")
+        {
+            ratio = reader.ReadDouble();
+        }
+        else if (reader.GetMemberName() == "Done")
+        {
+            done = reader.ReadBool();
+        }
+        else if (reader.GetMemberName() == "Items")
+        {
+            ASSERT_TRUE(reader.StartArray());
+            while (reader.NextElement())
+            {
+                ASSERT_TRUE(reader.StartObject());
+                while (reader.NextMember())
+                {
+                    if (reader.GetMemberName() == "Name")
+                    {
+                        ASSERT_TRUE(reader.StartObject());
+                        ASSERT_TRUE(reader.NextMember());
+                        names.push_back(reader.ReadString());
+                        ASSERT_FALSE(reader.NextMember());
+                    }
+                    else if (reader.GetMemberName() == "Tags")
+                    {
+                        ASSERT_TRUE(reader.StartObject());
+                        ASSERT_TRUE(reader.NextMember());
+                        ASSERT_TRUE(reader.StartArray());
+                        while (reader.NextElement())
+                        {
+                            tags.push_back(reader.ReadString());
+                        }
+                        ASSERT_FALSE(reader.NextMember());
+                    }
+                    else
+                    {
+                        reader.SkipValue();
+                    }
+                }
+            }
+        }
+        else
+        {
+            reader.SkipValue();
+        }
+    }
+
+    ASSERT_EQ(JsonTokenType::EndOfDocument, reader.Next());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+    ASSERT_EQ(2, count);
+    ASSERT_EQ(1234567890123ll, scannedCount);
+    ASSERT_DOUBLE_EQ(0.75, ratio);
+    ASSERT_FALSE(done);
+    ASSERT_EQ(1u, names.size());
+    ASSERT_EQ("caf\xc3\xa9 \"au lait\"\n", names[0]);
+    ASSERT_EQ(2u, tags.size());
+    ASSERT_EQ("a", tags[0]);
+    ASSERT_EQ("b\xf0\x9f\x98\x80", tags[1]);
+}
+
+TEST(JsonReaderTest, TestFeedByteByByte)
+{
+    Aws::StringStream input(QUERY_RESPONSE);
+    JsonReader wholeReader(input);
+    Aws::String expected = ReadTokens(wholeReader);
+    ASSERT_TRUE(wholeReader.WasParseSuccessful());
+
+    // tokens are read as the input comes in, those cut by the end of the input so far are read again once the rest is there.
+    JsonReader reader;
+    Aws::StringStream ss;
+    Aws::String document(QUERY_RESPONSE);
+    for (char c : document)
+    {
+        reader.Feed(&c, 1);
+        JsonTokenType type;
+        while ((type = reader.Next()) != JsonTokenType::NeedMoreInput)
+        {
+            ASSERT_NE(JsonTokenType::Error, type);
+            ASSERT_NE(JsonTokenType::EndOfDocument, type);
+            ss << static_cast<int>(type);
+            if (type == JsonTokenType::MemberName || type == JsonTokenType::String || type == JsonTokenType::Number)
+            {
+                ss << ":" << reader.GetTokenText();
+            }
+            ss << "|";
+        }
+    }
+    reader.EndOfInput();
+    ASSERT_EQ(JsonTokenType::EndOfDocument, reader.Next());
+    ASSERT_EQ(expected, ss.str());
+}
+
+TEST(JsonReaderTest, TestTopLevelScalarsAndEmptyDocument)
+{
+    JsonReader numberReader;
+    numberReader.Feed("42", 2);
+    ASSERT_EQ(JsonTokenType::NeedMoreInput, numberReader.Next());
+    numberReader.EndOfInput();
+    ASSERT_EQ(JsonTokenType::Number, numberReader.Next());
+    ASSERT_EQ("42", numberReader.GetTokenText());
+    ASSERT_EQ(JsonTokenType::EndOfDocument, numberReader.Next());
+
+    Aws::StringStream empty("  ");
+    JsonReader emptyReader(empty);
+    ASSERT_FALSE(emptyReader.StartObject());
+    ASSERT_EQ(JsonTokenType::EndOfDocument, emptyReader.Next());
+    ASSERT_TRUE(emptyReader.WasParseSuccessful());
+
+    Aws::StringStream null("null");
+    JsonReader nullReader(null);
+    ASSERT_FALSE(nullReader.StartObject());
+    ASSERT_EQ(JsonTokenType::EndOfDocument, nullReader.Next());
+}
+
+TEST(JsonReaderTest, TestTypeMismatchesReadAsDefaults)
+{
+    Aws::StringStream input("{\"a\":{\"x\":[1,2]},\"b\":[{}],\"c\":\"1\",\"d\":1,\"e\":true}");
+    JsonReader reader(input);
+    ASSERT_TRUE(reader.StartObject());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_EQ("", reader.ReadString());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_EQ(0, reader.ReadInteger());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_EQ(0.0, reader.ReadDouble());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_FALSE(reader.StartArray());
+    ASSERT_TRUE(reader.NextMember());
+    ASSERT_EQ("e", reader.GetMemberName());
+    ASSERT_TRUE(reader.ReadBool());
+    ASSERT_FALSE(reader.NextMember());
+    ASSERT_EQ(JsonTokenType::EndOfDocument, reader.Next());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(JsonReaderTest, TestMalformedDocuments)
+{
+    const char* malformed[] = { "{\"a\":1,}", "[1,]", "{\"a\" 1}", "{\"a\":1]", "[1 2]", "{1:2}", "[01]", "[1.]", "[-]", "[tru]",
+        "[\"abc]", "[\"\\x\"]", "[\"\\ud800\"]", "{\"a\":1}}", "{\"a\":", "[nul" };
+    for (const char* document : malformed)
+    {
+        Aws::StringStream input(document);
+        JsonReader reader(input);
+        JsonTokenType type;
+        while ((type = reader.Next()) != JsonTokenType::Error)
+        {
+            ASSERT_NE(JsonTokenType::EndOfDocument, type) << document;
+        }
+        ASSERT_FALSE(reader.WasParseSuccessful()) << document;
+        ASSERT_FALSE(reader.GetErrorMessage().empty());
+        ASSERT_EQ(JsonTokenType::Error, reader.Next());
+    }
+}
+
+TEST(JsonReaderTest, TestLongStringAcrossChunks)
+{
+    Aws::String value(100000, 'x');
+    value[5000] = '\\';
+    value[5001] = 't';
+    Aws::StringStream input("[\"" + value + "\"]");
+    JsonReader reader(input, 64);
+    ASSERT_TRUE(reader.StartArray());
+    ASSERT_TRUE(reader.NextElement());
+    Aws::String read = reader.ReadString();
+    ASSERT_EQ(value.size() - 1, read.size());
+    ASSERT_EQ('\t', read[5000]);
+    ASSERT_FALSE(reader.NextElement());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(JsonReaderTest, DISABLED_ReaderVersusDomThroughput)
+{
+    Aws::StringStream document;
+    document << "{\"Count\":2000,\"Items\":[";
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        document << (i ? "," : "") << "{\"Id\":{\"N\":\"" << i << "\"},\"Name\":{\"S\":\"item name " << i
+            << "\"},\"Tags\":{\"SS\":[\"red\",\"green\",\"blue\"]},\"Price\":{\"N\":\"" << i * 1.25 << "\"}}";
+    }
+    document << "],\"ScannedCount\":2000}";
+    Aws::String text = document.str();
+
+    const size_t iterations = 20;
+    auto start = std::chrono::steady_clock::now();
+    size_t domNames = 0;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        Aws::StringStream input(text);
+        JsonValue value(input);
+        auto items = value.View().GetArray("Items");
+        for (size_t j = 0; j < items.GetLength(); ++j)
+        {
+            domNames += items[j].GetObject("Name").GetString("S").size();
+        }
+    }
+    auto domTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    size_t readerNames = 0;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        Aws::StringStream input(text);
+        JsonReader reader(input);
+        ASSERT_TRUE(reader.StartObject());
+        while (reader.NextMember())
+        {
+            if (reader.GetMemberName() != "Items" || !reader.StartArray())
+            {
+                reader.SkipValue();
+                continue;
+            }
+            while (reader.NextElement())
+            {
+                reader.StartObject();
+                while (reader.NextMember())
+                {
+                    if (reader.GetMemberName() == "Name" && reader.StartObject())
+                    {
+                        while (reader.NextMember())
+                        {
+                            readerNames += reader.ReadString().size();
+                        }
+                    }
+                    else
+                    {
+                        reader.SkipValue();
+                    }
+                }
+            }
+        }
+    }
+    auto readerTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(domNames, readerNames);
+    double megabytes = static_cast<double>(text.size() * iterations) / (1024 * 1024);
+    std::cout << "document " << text.size() << " bytes, JsonValue " << megabytes * 1000000 / domTime << " MB/s, JsonReader "
+        << megabytes * 1000000 / readerTime << " MB/s" << std::endl;
+}
@@ -18,6 +18,10 @@
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils;
 
@@ -384,3 +388,189 @@ TEST(JsonSerializer, TestEquality)
     built.WithString("AWS", "Amazon Web Services");
     ASSERT_NE(parsed, built);
 }
+
+TEST(JsonSerializer, TestMovedValuesAreNotCopied)
+{
+    JsonValue leaf;
+    leaf.WithString("S", "leaf value");
+    // a view of the leaf's node, which stays valid (and the same node) once the leaf is moved into its parent.
+    JsonView leafView = leaf.View();
+
+    Array<JsonValue> elements(2);
+    elements[0].AsObject(std::move(leaf));
+    elements[1].AsString("second");
+    JsonValue list;
+    list.WithArray("List", std::move(elements));
+    ASSERT_TRUE(elements[0].View().WriteCompact(false).empty());
+
+    JsonValue root;
+    root.WithObject("Child", std::move(list)).WithInteger("Count", 2);
+    ASSERT_EQ("leaf value", leafView.GetString("S"));
+    ASSERT_STREQ(R"({"Child":{"List":[{"S":"leaf value"},"second"]},"Count":2})", root.View().WriteCompact().c_str());
+
+    JsonValue moved(std::move(root));
+    ASSERT_EQ("leaf value", leafView.GetString("S"));
+    ASSERT_TRUE(root.View().WriteCompact(false).empty());
+
+    // replacing a member leaves views of the previous one readable.
+    JsonView childView = moved.View().GetObject("Child");
+    moved.WithString("Child", "replaced");
+    ASSERT_EQ("leaf value", childView.GetArray("List")[0].GetString("S"));
+    ASSERT_STREQ(R"({"Child":"replaced","Count":2})", moved.View().WriteCompact().c_str());
+
+    JsonValue copy(moved);
+    moved.AsBool(true);
+    ASSERT_STREQ(R"({"Child":"replaced","Count":2})", copy.View().WriteCompact().c_str());
+    ASSERT_TRUE(moved.View().AsBool());
+}
+
+TEST(JsonSerializer, TestWriteFormats)
+{
+    JsonValue value(Aws::String(R"({"a":[1,-2.5,1e+300,0.1,true,null],"b":{},"c":[],"d":{"e":"tab\tquote\"slash\\\u0001"}})"));
+    ASSERT_TRUE(value.WasParseSuccessful());
+    ASSERT_STREQ(R"({"a":[1,-2.5,1e+300,0.1,true,null],"b":{},"c":[],"d":{"e":"tab\tquote\"slash\\\u0001"}})",
+        value.View().WriteCompact().c_str());
+    ASSERT_STREQ("{\n\t\"a\":\t[1, -2.5, 1e+300, 0.1, true, null],\n\t\"b\":\t{\n\t},\n\t\"c\":\t[],\n"
+        "\t\"d\":\t{\n\t\t\"e\":\t\"tab\\tquote\\\"slash\\\\\\u0001\"\n\t}\n}", value.View().WriteReadable().c_str());
+
+    JsonValue numbers;
+    numbers.WithInt64("big", 1234567890123456789LL).WithInteger("negative", -42).WithDouble("fraction", 0.5);
+    ASSERT_STREQ(R"({"big":1.2345678901234568e+18,"negative":-42,"fraction":0.5})", numbers.View().WriteCompact().c_str());
+    ASSERT_EQ(-42, numbers.View().GetInteger("negative"));
+}
+
+TEST(JsonSerializer, TestParseErrors)
+{
+    ASSERT_FALSE(JsonValue(Aws::String("")).WasParseSuccessful());
+    ASSERT_STREQ("Failed to parse JSON at: ", JsonValue(Aws::String("")).GetErrorMessage().c_str());
+    ASSERT_STREQ("Failed to parse JSON at: ]", JsonValue(Aws::String("[1,]")).GetErrorMessage().c_str());
+    ASSERT_STREQ("Failed to parse JSON at: x", JsonValue(Aws::String("{} x")).GetErrorMessage().c_str());
+
+    // the rest of the input is reported even when it hasn't been read from the stream yet.
+    Aws::StringStream ss;
+    ss << "{\"a\":[1,2,3,}" << Aws::String(64 * 1024, ' ') << "end";
+    JsonValue value(ss);
+    ASSERT_FALSE(value.WasParseSuccessful());
+    ASSERT_EQ(64u * 1024u + 4u + sizeof("Failed to parse JSON. Invalid input at: ") - 1, value.GetErrorMessage().size());
+    ASSERT_EQ(0u, value.GetErrorMessage().find("Failed to parse JSON. Invalid input at: }"));
+    ASSERT_TRUE(value.View().WriteCompact(false).empty());
+}
+
+// builds a BatchWriteItem-like request the way the generated Jsonize() functions do.
+static JsonValue BuildLargeRequest(size_t itemCount, size_t attributeCount)
+{
+    Array<JsonValue> writes(itemCount);
+    for (size_t i = 0; i < itemCount; ++i)
+    {
+        JsonValue item;
+        for (size_t a = 0; a < attributeCount; ++a)
+        {
+            char key[32];
+            snprintf(key, sizeof(key), "attribute%u", static_cast<unsigned>(a));
+            JsonValue attribute;
+            if (a % 2 == 0)
+            {
+                attribute.WithString("S", Aws::String("value of ") + key);
+            }
+            else
+            {
+                Array<JsonValue> list(2);
+                list[0].AsObject(JsonValue().WithString("N", "12.5"));
+                list[1].AsObject(JsonValue().WithBool("BOOL", true));
+                attribute.WithArray("L", std::move(list));
+            }
+            item.WithObject(key, std::move(attribute));
+        }
+        JsonValue putRequest;
+        putRequest.WithObject("Item", std::move(item));
+        writes[i].AsObject(JsonValue().WithObject("PutRequest", std::move(putRequest)));
+    }
+    JsonValue requestItems;
+    requestItems.WithArray("Table", std::move(writes));
+    JsonValue payload;
+    payload.WithObject("RequestItems", std::move(requestItems));
+    return payload;
+}
+
+// the same request built with the cJSON calls JsonValue used to make: a malloc per node and string, and deep copies of
+// what the generated code adds with AsObject() and WithArray().
+static cJSON* BuildLargeRequestWithCJson(size_t itemCount, size_t attributeCount)
+{
+    cJSON* writes = cJSON_CreateArray();
+    for (size_t i = 0; i < itemCount; ++i)
+    {
+        cJSON* item = cJSON_CreateObject();
+        for (size_t a = 0; a < attributeCount; ++a)
+        {
+            char key[32];
+            snprintf(key, sizeof(key), "attribute%u", static_cast<unsigned>(a));
+            cJSON* attribute = cJSON_CreateObject();
+            if (a % 2 == 0)
+            {
+                cJSON_AddItemToObject(attribute, "S", cJSON_CreateString((Aws::String("value of ") + key).c_str()));
+            }
+            else
+            {
+                cJSON* number = cJSON_CreateObject();
+                cJSON_AddItemToObject(number, "N", cJSON_CreateString("12.5"));
+                cJSON* boolean = cJSON_CreateObject();
+                cJSON_AddItemToObject(boolean, "BOOL", cJSON_CreateBool(true));
+                cJSON* list = cJSON_CreateArray();
+                cJSON_AddItemToArray(list, cJSON_Duplicate(number, true));
+                cJSON_AddItemToArray(list, cJSON_Duplicate(boolean, true));
+                cJSON_Delete(number);
+                cJSON_Delete(boolean);
+                cJSON_AddItemToObject(attribute, "L", list);
+            }
+            cJSON_AddItemToObject(item, key, attribute);
+        }
+        cJSON* putRequest = cJSON_CreateObject();
+        cJSON_AddItemToObject(putRequest, "Item", item);
+        cJSON* write = cJSON_CreateObject();
+        cJSON_AddItemToObject(write, "PutRequest", putRequest);
+        cJSON_AddItemToArray(writes, cJSON_Duplicate(write, true));
+        cJSON_Delete(write);
+    }
+    cJSON* requestItems = cJSON_CreateObject();
+    cJSON_AddItemToObject(requestItems, "Table", writes);
+    cJSON* payload = cJSON_CreateObject();
+    cJSON_AddItemToObject(payload, "RequestItems", requestItems);
+    return payload;
+}
+
+TEST(JsonSerializer, DISABLED_ArenaVersusCJsonLargeRequest)
+{
+    const size_t items = 25;
+    const size_t attributes = 40;
+    const size_t iterations = 50;
+
+    cJSON* reference = BuildLargeRequestWithCJson(items, attributes);
+    char* referenceText = cJSON_Print(reference);
+    cJSON_Delete(reference);
+    ASSERT_STREQ(referenceText, BuildLargeRequest(items, attributes).View().WriteReadable().c_str());
+
+    auto start = std::chrono::steady_clock::now();
+    size_t cJsonBytes = 0;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        cJSON* payload = BuildLargeRequestWithCJson(items, attributes);
+        char* text = cJSON_Print(payload);
+        cJsonBytes += strlen(text);
+        cJSON_free(text);
+        cJSON_Delete(payload);
+    }
+    auto cJsonTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    size_t arenaBytes = 0;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        arenaBytes += BuildLargeRequest(items, attributes).View().WriteReadable().size();
+    }
+    auto arenaTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(cJsonBytes, arenaBytes);
+    std::cout << "request " << strlen(referenceText) << " bytes, cJSON " << cJsonTime / iterations << " us, arena JsonValue "
+        << arenaTime / iterations << " us" << std::endl;
+    cJSON_free(referenceText);
+}
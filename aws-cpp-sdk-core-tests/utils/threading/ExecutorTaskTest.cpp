@@ -0,0 +1,116 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/ExecutorTask.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/threading/Semaphore.h>
+#include <array>
+#include <memory>
+
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+    struct CountingCallable
+    {
+        CountingCallable(int* calls, std::shared_ptr<int> alive) : m_calls(calls), m_alive(alive) {}
+        void operator()() { ++*m_calls; }
+        int* m_calls;
+        std::shared_ptr<int> m_alive;
+    };
+
+    struct LargeCallable : CountingCallable
+    {
+        LargeCallable(int* calls, std::shared_ptr<int> alive) : CountingCallable(calls, alive) { m_padding.fill(0); }
+        std::array<char, ExecutorTask::INLINE_SIZE> m_padding;
+    };
+
+    /**
+    * Executor that only implements SubmitToThread, like executors written before ExecutorTask.
+    */
+    class InlineExecutor : public Executor
+    {
+    protected:
+        bool SubmitToThread(std::function<void()>&& fn) override
+        {
+            fn();
+            return true;
+        }
+    };
+}
+
+TEST(ExecutorTaskTest, KeepsSmallCallablesInline)
+{
+    static_assert(ExecutorTask::FitsInline<CountingCallable>::value, "CountingCallable should be kept in the task");
+    static_assert(ExecutorTask::FitsInline<std::function<void()>>::value, "std::function should be kept in the task");
+    static_assert(!ExecutorTask::FitsInline<LargeCallable>::value, "LargeCallable should be allocated");
+
+    int calls = 0;
+    auto alive = std::make_shared<int>(0);
+    {
+        ExecutorTask task(CountingCallable(&calls, alive));
+        ASSERT_TRUE(static_cast<bool>(task));
+        ExecutorTask moved(std::move(task));
+        ASSERT_FALSE(static_cast<bool>(task));
+        moved();
+        moved();
+        ASSERT_EQ(2, calls);
+        ASSERT_EQ(2, alive.use_count());
+    }
+    ASSERT_EQ(1, alive.use_count());
+}
+
+TEST(ExecutorTaskTest, AllocatesLargeCallablesOnce)
+{
+    int calls = 0;
+    auto alive = std::make_shared<int>(0);
+    {
+        ExecutorTask task(LargeCallable(&calls, alive));
+        ExecutorTask assigned;
+        assigned = std::move(task);
+        ASSERT_FALSE(static_cast<bool>(task));
+        assigned();
+        ASSERT_EQ(1, calls);
+        ASSERT_EQ(2, alive.use_count());
+
+        assigned = ExecutorTask(CountingCallable(&calls, alive));
+        ASSERT_EQ(2, alive.use_count());
+    }
+    ASSERT_EQ(1, alive.use_count());
+}
+
+TEST(ExecutorTaskTest, ExecutorsOnlyImplementingSubmitToThreadStillRunTasks)
+{
+    InlineExecutor exec;
+    Aws::String result;
+    ASSERT_TRUE(exec.Submit([&result](const Aws::String& value) { result = value; }, Aws::String("submitted")));
+    ASSERT_STREQ("submitted", result.c_str());
+}
+
+TEST(ExecutorTaskTest, PooledThreadExecutorRunsBoundTasks)
+{
+    Semaphore done(0, 1);
+    int calls = 0;
+    auto alive = std::make_shared<int>(0);
+    {
+        PooledThreadExecutor exec(2);
+        ASSERT_TRUE(exec.Submit([&done](LargeCallable callable) { callable(); done.Release(); }, LargeCallable(&calls, alive)));
+        done.WaitOne();
+    }
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(1, alive.use_count());
+}
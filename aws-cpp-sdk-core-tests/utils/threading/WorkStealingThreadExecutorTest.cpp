@@ -0,0 +1,102 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/Semaphore.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+
+using namespace Aws::Utils::Threading;
+
+static const size_t TASK_COUNT = 10000;
+
+TEST(WorkStealingThreadExecutor, RunsAllSubmittedTasks)
+{
+    std::atomic<size_t> completed(0);
+    std::mutex lock;
+    std::condition_variable done;
+    {
+        WorkStealingThreadExecutor exec(4);
+        for (size_t i = 0; i < TASK_COUNT; ++i)
+        {
+            ASSERT_TRUE(exec.Submit([&] {
+                if (++completed == TASK_COUNT)
+                {
+                    std::lock_guard<std::mutex> locker(lock);
+                    done.notify_all();
+                }
+            }));
+        }
+
+        std::unique_lock<std::mutex> locker(lock);
+        ASSERT_TRUE(done.wait_for(locker, std::chrono::seconds(30), [&] { return completed.load() == TASK_COUNT; }));
+    }
+    ASSERT_EQ(TASK_COUNT, completed.load());
+}
+
+TEST(WorkStealingThreadExecutor, RunsTasksSubmittedFromPoolThreads)
+{
+    std::atomic<size_t> completed(0);
+    Semaphore finished(0, 1);
+    WorkStealingThreadExecutor exec(3);
+
+    std::function<void(size_t)> chain = [&](size_t remaining) {
+        if (remaining == 0)
+        {
+            finished.Release();
+            return;
+        }
+        ++completed;
+        exec.Submit(chain, remaining - 1);
+    };
+    exec.Submit(chain, TASK_COUNT);
+
+    finished.WaitOne();
+    ASSERT_EQ(TASK_COUNT, completed.load());
+}
+
+TEST(WorkStealingThreadExecutor, IdleThreadsTakeTasksQueuedForBusyThreads)
+{
+    Semaphore blockerStarted(0, 1);
+    Semaphore releaseBlocker(0, 1);
+    std::atomic<size_t> completed(0);
+    std::mutex lock;
+    std::condition_variable done;
+
+    WorkStealingThreadExecutor exec(2);
+    exec.Submit([&] { blockerStarted.Release(); releaseBlocker.WaitOne(); });
+    blockerStarted.WaitOne();
+
+    // tasks submitted from outside the pool alternate between both queues, so half of them wait behind the blocked thread.
+    for (size_t i = 0; i < 100; ++i)
+    {
+        exec.Submit([&] {
+            if (++completed == 100)
+            {
+                std::lock_guard<std::mutex> locker(lock);
+                done.notify_all();
+            }
+        });
+    }
+
+    {
+        std::unique_lock<std::mutex> locker(lock);
+        ASSERT_TRUE(done.wait_for(locker, std::chrono::seconds(30), [&] { return completed.load() == 100; }));
+    }
+    releaseBlocker.Release();
+}
@@ -0,0 +1,350 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <chrono>
+#include <iostream>
+
+using namespace Aws::Utils::Xml;
+using namespace Aws::Utils;
+
+static const char LIST_RESPONSE[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\"><Name>bucket</Name><Prefix/><KeyCount>2</KeyCount>"
+    "<IsTruncated>false</IsTruncated><!-- a comment -->\n"
+    "  <Contents><Key>a &amp; b.txt</Key><ETag>&quot;9b2cf535f27731c974343645a3985328&quot;</ETag><Size>1024</Size>"
+    "<Owner><ID>owner-id</ID><DisplayName>owner</DisplayName></Owner></Contents>\r\n"
+    "  <Contents><Key>caf&#xe9;&#60;&#62;'</Key><Unknown><Nested a='1'>x</Nested></Unknown><Size>7</Size></Contents>"
+    "</ListBucketResult>";
+
+// reads the whole document token by token into a canonical text, to compare the outcome of different ways of feeding it.
+static Aws::String ReadTokens(XmlReader& reader)
+{
+    Aws::StringStream ss;
+    for (;;)
+    {
+        XmlTokenType type = reader.Next();
+        EXPECT_NE(XmlTokenType::NeedMoreInput, type);
+        if (type == XmlTokenType::EndOfDocument || type == XmlTokenType::Error || type == XmlTokenType::NeedMoreInput)
+        {
+            break;
+        }
+        ss << static_cast<int>(type) << ":" << reader.GetDepth() << ":";
+        if (type == XmlTokenType::Text)
+        {
+            ss << Aws::String(reader.GetText(), reader.GetTextLength());
+        }
+        else
+        {
+            ss << Aws::String(reader.GetName(), reader.GetNameLength());
+        }
+        ss << "|";
+    }
+    return ss.str();
+}
+
+TEST(XmlReaderTest, TestReadStructuredDocument)
+{
+    Aws::StringStream input(LIST_RESPONSE);
+    XmlReader reader(input, 7);
+
+    ASSERT_TRUE(reader.StartRootElement());
+    ASSERT_TRUE(reader.IsName("ListBucketResult"));
+    Aws::String xmlns;
+    ASSERT_TRUE(reader.GetAttributeValue("xmlns", xmlns));
+    ASSERT_EQ("http://s3.amazonaws.com/doc/2006-03-01/", xmlns);
+
+    Aws::String name;
+    Aws::String prefix = "not set";
+    int keyCount = 0;
+    Aws::Vector<Aws::String> keys;
+    Aws::Vector<Aws::String> eTags;
+    Aws::Vector<long long> sizes;
+    Aws::String ownerId;
+    while (reader.NextChild())
+    {
+        if (reader.IsName("Name"))
+        {
+            name = reader.ReadTrimmedText();
+        }
+        else if (reader.IsName("Prefix"))
+        {
+            prefix = reader.ReadTrimmedText();
+        }
+        else if (reader.IsName("KeyCount"))
+        {
+            keyCount = StringUtils::ConvertToInt32(reader.ReadTrimmedText().c_str());
+        }
+        else if (reader.IsName("Contents"))
+        {
+            while (reader.NextChild())
+            {
+                if (reader.IsName("Key"))
+                {
+                    keys.push_back(reader.ReadTrimmedText());
+                }
+                else if (reader.IsName("ETag"))
+                {
+                    eTags.push_back(reader.ReadTrimmedText());
+                }
+                else if (reader.IsName("Size"))
+                {
+                    sizes.push_back(StringUtils::ConvertToInt64(reader.ReadTrimmedText().c_str()));
+                }
+                else if (reader.IsName("Owner"))
+                {
+                    while (reader.NextChild())
+                    {
+                        if (reader.IsName("ID"))
+                        {
+                            ownerId = reader.ReadTrimmedText();
+                        }
+                        else
+                        {
+                            reader.SkipElement();
+                        }
+                    }
+                }
+                else
+                {
+                    reader.SkipElement();
+                }
+            }
+        }
+        else
+        {
+            reader.SkipElement();
+        }
+    }
+
+    ASSERT_EQ(XmlTokenType::EndOfDocument, reader.Next());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+    ASSERT_EQ("bucket", name);
+    ASSERT_EQ("", prefix);
+    ASSERT_EQ(2, keyCount);
+    ASSERT_EQ(2u, keys.size());
+    ASSERT_EQ("a &amp; b.txt", keys[0]);
+    ASSERT_EQ("caf\xc3\xa9&lt;&gt;'", keys[1]);
+    ASSERT_EQ(1u, eTags.size());
+    ASSERT_EQ("\"9b2cf535f27731c974343645a3985328\"", eTags[0]);
+    ASSERT_EQ(2u, sizes.size());
+    ASSERT_EQ(1024, sizes[0]);
+    ASSERT_EQ(7, sizes[1]);
+    ASSERT_EQ("owner-id", ownerId);
+}
+
+TEST(XmlReaderTest, TestTextMatchesXmlNodeGetText)
+{
+    // deserializers read the same values from either, whatever the escaping.
+    const char* texts[] = { "plain", "  padded\t", "a &amp; b &lt;c&gt; d", "&quot;etag&quot; &apos;q&apos;", "raw > and ' and \"",
+        "&#65;&#x42;&#x20AC;&#128512;", "&unknown; & &#xZZ;", "line\r\nbreaks\rand\n\rmore", "<![CDATA[ <kept> & ]]>",
+        "before<![CDATA[cdata]]>after", "x<!-- comment -->y", "" };
+    for (const char* text : texts)
+    {
+        Aws::String document = Aws::String("<Root><Value>") + text + "</Value></Root>";
+        XmlDocument xmlDocument = XmlDocument::CreateFromXmlString(document);
+        ASSERT_TRUE(xmlDocument.WasParseSuccessful()) << text;
+        Aws::String expected = xmlDocument.GetRootElement().FirstChild("Value").GetText();
+        if (Aws::String(text) == "x<!-- comment -->y")
+        {
+            // comments are skipped by the reader, XmlNode::GetText() prints them.
+            expected = "xy";
+        }
+
+        Aws::StringStream input(document);
+        XmlReader reader(input, 3);
+        ASSERT_TRUE(reader.StartRootElement());
+        ASSERT_TRUE(reader.NextChild());
+        ASSERT_EQ(expected, reader.ReadText()) << text;
+        ASSERT_FALSE(reader.NextChild());
+        ASSERT_EQ(XmlTokenType::EndOfDocument, reader.Next());
+        ASSERT_TRUE(reader.WasParseSuccessful());
+    }
+}
+
+TEST(XmlReaderTest, TestFeedByteByByte)
+{
+    Aws::StringStream input(LIST_RESPONSE);
+    XmlReader wholeReader(input);
+    Aws::String expected = ReadTokens(wholeReader);
+    ASSERT_TRUE(wholeReader.WasParseSuccessful());
+
+    // tokens are read as the input comes in, those cut by the end of the input so far are read again once the rest is there.
+    XmlReader reader;
+    Aws::StringStream ss;
+    Aws::String document(LIST_RESPONSE);
+    for (char c : document)
+    {
+        reader.Feed(&c, 1);
+        XmlTokenType type;
+        while ((type = reader.Next()) != XmlTokenType::NeedMoreInput)
+        {
+            ASSERT_NE(XmlTokenType::Error, type);
+            ASSERT_NE(XmlTokenType::EndOfDocument, type);
+            ss << static_cast<int>(type) << ":" << reader.GetDepth() << ":";
+            if (type == XmlTokenType::Text)
+            {
+                ss << Aws::String(reader.GetText(), reader.GetTextLength());
+            }
+            else
+            {
+                ss << Aws::String(reader.GetName(), reader.GetNameLength());
+            }
+            ss << "|";
+        }
+    }
+    reader.EndOfInput();
+    ASSERT_EQ(XmlTokenType::EndOfDocument, reader.Next());
+    ASSERT_EQ(expected, ss.str());
+}
+
+TEST(XmlReaderTest, TestEmptyElementsAndAttributes)
+{
+    Aws::StringStream input("<a x=\"1\" y = 'a &amp; &quot;b&quot;'><b/><c z=\"/>\" /><d></d></a>");
+    XmlReader reader(input);
+    ASSERT_EQ(XmlTokenType::StartElement, reader.Next());
+    ASSERT_EQ(1u, reader.GetDepth());
+    Aws::String value;
+    ASSERT_TRUE(reader.GetAttributeValue("y", value));
+    ASSERT_EQ("a & \"b\"", value);
+    ASSERT_TRUE(reader.GetAttributeValue("x", value));
+    ASSERT_EQ("1", value);
+    ASSERT_FALSE(reader.GetAttributeValue("z", value));
+
+    ASSERT_EQ(XmlTokenType::StartElement, reader.Next());
+    ASSERT_TRUE(reader.IsName("b"));
+    ASSERT_EQ(2u, reader.GetDepth());
+    ASSERT_EQ(XmlTokenType::EndElement, reader.Next());
+    ASSERT_TRUE(reader.IsName("b"));
+    ASSERT_EQ(1u, reader.GetDepth());
+
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_TRUE(reader.IsName("c"));
+    ASSERT_TRUE(reader.GetAttributeValue("z", value));
+    ASSERT_EQ("/>", value);
+    ASSERT_EQ("", reader.ReadText());
+
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_TRUE(reader.IsName("d"));
+    ASSERT_EQ("", reader.ReadTrimmedText());
+    ASSERT_FALSE(reader.NextChild());
+    ASSERT_EQ(0u, reader.GetDepth());
+    ASSERT_EQ(XmlTokenType::EndOfDocument, reader.Next());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, TestMalformedDocuments)
+{
+    const char* malformed[] = { "", "  ", "<a>", "<a></b>", "<a><b></a></b>", "</a>", "<a/><b/>", "text<a/>", "<a/>text", "<a",
+        "<a x=\"1></a>", "<>x</>", "<a><!-- x</a>", "<a><![CDATA[x</a>", "<a></a >x" };
+    for (const char* document : malformed)
+    {
+        Aws::StringStream input(document);
+        XmlReader reader(input);
+        XmlTokenType type;
+        while ((type = reader.Next()) != XmlTokenType::Error)
+        {
+            ASSERT_NE(XmlTokenType::EndOfDocument, type) << document;
+        }
+        ASSERT_FALSE(reader.WasParseSuccessful()) << document;
+        ASSERT_FALSE(reader.GetErrorMessage().empty());
+        ASSERT_EQ(XmlTokenType::Error, reader.Next());
+    }
+}
+
+TEST(XmlReaderTest, TestLongTextAcrossChunks)
+{
+    Aws::String value(100000, 'x');
+    value.replace(5000, 5, "&amp;");
+    Aws::StringStream input("<a><b>" + value + "</b><c>after</c></a>");
+    XmlReader reader(input, 64);
+    ASSERT_TRUE(reader.StartRootElement());
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_EQ(value, reader.ReadText());
+    ASSERT_TRUE(reader.NextChild());
+    ASSERT_EQ("after", reader.ReadText());
+    ASSERT_FALSE(reader.NextChild());
+    ASSERT_TRUE(reader.WasParseSuccessful());
+}
+
+TEST(XmlReaderTest, DISABLED_ReaderVersusDomThroughput)
+{
+    Aws::StringStream document;
+    document << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+        << "<Name>bucket</Name><KeyCount>1000</KeyCount><IsTruncated>true</IsTruncated>";
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        document << "<Contents><Key>photos/2017/some/longer/prefix/object-" << i << ".jpg</Key>"
+            << "<LastModified>2017-09-12T20:21:10.000Z</LastModified><ETag>&quot;d41d8cd98f00b204e9800998ecf8427e&quot;</ETag>"
+            << "<Size>" << i * 1024 << "</Size><StorageClass>STANDARD</StorageClass></Contents>";
+    }
+    document << "</ListBucketResult>";
+    Aws::String text = document.str();
+
+    const size_t iterations = 20;
+    auto start = std::chrono::steady_clock::now();
+    size_t domKeys = 0;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        Aws::StringStream input(text);
+        XmlDocument xmlDocument = XmlDocument::CreateFromXmlStream(input);
+        XmlNode contents = xmlDocument.GetRootElement().FirstChild("Contents");
+        while (!contents.IsNull())
+        {
+            domKeys += StringUtils::Trim(contents.FirstChild("Key").GetText().c_str()).size();
+            contents = contents.NextNode("Contents");
+        }
+    }
+    auto domTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    size_t readerKeys = 0;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        Aws::StringStream input(text);
+        XmlReader reader(input);
+        ASSERT_TRUE(reader.StartRootElement());
+        while (reader.NextChild())
+        {
+            if (!reader.IsName("Contents"))
+            {
+                reader.SkipElement();
+                continue;
+            }
+            while (reader.NextChild())
+            {
+                if (reader.IsName("Key"))
+                {
+                    readerKeys += reader.ReadTrimmedText().size();
+                }
+                else
+                {
+                    reader.SkipElement();
+                }
+            }
+        }
+    }
+    auto readerTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    ASSERT_EQ(domKeys, readerKeys);
+    double megabytes = static_cast<double>(text.size() * iterations) / (1024 * 1024);
+    std::cout << "document " << text.size() << " bytes, XmlDocument " << megabytes * 1000000 / domTime << " MB/s, XmlReader "
+        << megabytes * 1000000 / readerTime << " MB/s" << std::endl;
+}
@@ -83,6 +83,33 @@ namespace Aws
          * Set the response stream factory.
          */
         void SetResponseStreamFactory(const Aws::IOStreamFactory& factory) { m_responseStreamFactory = factory; }
+        /**
+         * Retrieves the caller owned buffers the response body is written into, see Aws::Http::HttpRequest::SetResponseBodyBuffers.
+         */
+        const Aws::Http::ResponseBodyBufferList& GetResponseBodyBuffers() const { return m_responseBodyBuffers; }
+        /**
+         * Have the response body written straight into caller owned buffers instead of the stream created by the response stream factory.
+         * The buffers must stay valid until the request completes. Only honored by the curl http clients.
+         */
+        void SetResponseBodyBuffers(const Aws::Http::ResponseBodyBufferList& buffers) { m_responseBodyBuffers = buffers; }
+        /**
+         * Retrieves the hashes updated with the body while it is sent, see Aws::Http::HttpRequest::AddRequestBodyHash.
+         */
+        const Aws::Http::BodyHashList& GetRequestBodyHashes() const { return m_requestBodyHashes; }
+        /**
+         * Have hash updated with the body while it is sent, instead of reading the body once more to hash it. Call GetHash() on it once the request completes.
+         * Only honored by the curl http clients.
+         */
+        void AddRequestBodyHash(const std::shared_ptr<Aws::Utils::Crypto::Hash>& hash) { m_requestBodyHashes.push_back(hash); }
+        /**
+         * Retrieves the hashes updated with the response body while it is received, see Aws::Http::HttpRequest::AddResponseBodyHash.
+         */
+        const Aws::Http::BodyHashList& GetResponseBodyHashes() const { return m_responseBodyHashes; }
+        /**
+         * Have hash updated with the response body while it is received. Call GetHash() on it once the request completes.
+         * Only honored by the curl http clients.
+         */
+        void AddResponseBodyHash(const std::shared_ptr<Aws::Utils::Crypto::Hash>& hash) { m_responseBodyHashes.push_back(hash); }
         /**
          * Register closure for data recieved event.
          */
@@ -131,6 +158,28 @@ namespace Aws
          * get closure for notification that a request is being retried
          */
         inline virtual const RequestRetryHandler& GetRequestRetryHandler() const { return m_requestRetryHandler; }
+        /**
+         * Opts the request in to hedging, for idempotent requests only: once an attempt has taken longer than the client's
+         * hedgingPercentile of the latencies of the operation's attempts, a second attempt is sent on another connection, the first one
+         * to succeed is kept and the other cancelled. Ignored for requests with response body buffers or body hashes, which the
+         * attempts would share. Default false.
+         */
+        inline void SetHedgingEnabled(bool hedgingEnabled) { m_hedgingEnabled = hedgingEnabled; }
+        /**
+         * Whether the request is hedged.
+         */
+        inline bool IsHedgingEnabled() const { return m_hedgingEnabled; }
+        /**
+         * Time in milliseconds the request may take, all its attempts and the waits in between included. An attempt still running
+         * at the deadline is cancelled and the request fails with CoreErrors::REQUEST_TIMEOUT; a retry the deadline leaves no time
+         * for isn't started, and the request fails with the last error instead. Default 0, for no limit other than the client's
+         * timeouts and retry strategy.
+         */
+        inline void SetDeadlineMs(long deadlineMs) { m_deadlineMs = deadlineMs; }
+        /**
+         * Time in milliseconds the request may take, all its attempts included. 0 if unlimited.
+         */
+        inline long GetDeadlineMs() const { return m_deadlineMs; }
         /**
          * If this is set to true, content-md5 needs to be computed and set on the request
          */
@@ -147,11 +196,16 @@ namespace Aws
 
     private:
         Aws::IOStreamFactory m_responseStreamFactory;
+        Aws::Http::ResponseBodyBufferList m_responseBodyBuffers;
+        Aws::Http::BodyHashList m_requestBodyHashes;
+        Aws::Http::BodyHashList m_responseBodyHashes;
 
         Aws::Http::DataReceivedEventHandler m_onDataReceived;
         Aws::Http::DataSentEventHandler m_onDataSent;
         Aws::Http::ContinueRequestHandler m_continueRequest;
         RequestRetryHandler m_requestRetryHandler;
+        bool m_hedgingEnabled;
+        long m_deadlineMs;
     };
 
 } // namespace Aws
@@ -142,7 +142,13 @@ namespace Aws
                 /**
                  * Never sign the body of the request
                  */
-                Never
+                Never,
+                /**
+                 * Sign the body of the request chunk by chunk while it is sent (aws-chunked, STREAMING-AWS4-HMAC-SHA256-PAYLOAD), so it is read
+                 * only once and does not need to be seekable. Needs the content-length of the body and an http client that supports it
+                 * (HttpClient::SupportsChunkedPayloadSigning, the curl clients), other requests are signed as with Always.
+                 */
+                Streaming
             };
             /**
              * credentialsProvider, source of AWS Credentials to sign requests with
@@ -151,7 +157,8 @@ namespace Aws
              * signPayloads, if Always, the payload will have a sha256 computed on the body of the request. If this is set
              *    to Never, the sha256 will not be computed on the body. This is only useful for Amazon S3 over Https. If
              *    Https is not used then this flag will be ignored. If set to RequestDependent, compute or not is based on
-             *    the value from AmazonWebServiceRequest::SignBody()
+             *    the value from AmazonWebServiceRequest::SignBody(). If set to Streaming, the body is signed in chunks while it is sent,
+             *    see AWSChunkedPayloadSigner.
              */
             AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider,
                             const char* serviceName, const Aws::String& region, PayloadSigningPolicy signingPolicy = PayloadSigningPolicy::RequestDependent,
@@ -217,9 +224,9 @@ namespace Aws
             Aws::String GenerateSignature(const Aws::String& stringToSign, const Aws::Utils::ByteBuffer& key) const;
             bool ServiceRequireUnsignedPayload(const Aws::String& serviceName) const;
             Aws::String ComputePayloadHash(Aws::Http::HttpRequest&) const;
-            Aws::String GenerateStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate,
-                    const Aws::String& canonicalRequestHash, const Aws::String& region,
-                    const Aws::String& serviceName) const;
+            Aws::String GenerateCredentialScope(const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
+            Aws::String GenerateStringToSign(const Aws::String& dateValue, const Aws::String& credentialScope,
+                    const Aws::String& canonicalRequestHash) const;
             Aws::Utils::ByteBuffer ComputeHash(const Aws::String& secretKey, const Aws::String& simpleDate) const;
             Aws::Utils::ByteBuffer ComputeHash(const Aws::String& secretKey,
                     const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const;
@@ -234,13 +241,11 @@ namespace Aws
 
             Aws::Set<Aws::String> m_unsignedHeaders;
 
-            //these next four fields are ONLY for caching purposes and do not change
-            //the logical state of the signer. They are marked mutable so the
-            //interface can remain const.
-            mutable Aws::Utils::ByteBuffer m_partialSignature;
-            mutable Aws::String m_currentDateStr;
-            mutable Aws::String m_currentSecretKey;
-            mutable Utils::Threading::ReaderWriterLock m_partialSignatureLock;
+            //derived signing key for the secret key and date it was last computed for. This is ONLY for caching purposes and does not change
+            //the logical state of the signer, it is marked mutable so the interface can remain const.
+            //The entry is never modified once published, a new key replaces it as a whole with std::atomic_store so signing doesn't take a lock.
+            struct SigningKeyCacheEntry;
+            mutable std::shared_ptr<const SigningKeyCacheEntry> m_signingKeyCache;
             PayloadSigningPolicy m_payloadSigningPolicy;
             bool m_urlEscapePath;
         };
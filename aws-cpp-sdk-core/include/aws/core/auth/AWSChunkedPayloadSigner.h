@@ -0,0 +1,132 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/Array.h>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            class Sha256;
+            class Sha256HMAC;
+            class Hash;
+        } // namespace Crypto
+    } // namespace Utils
+
+    namespace Client
+    {
+        /**
+         * Encodes a request body as aws-chunked while it is being sent, signing every chunk with the signature of the chunk before it,
+         * starting from the seed signature of the request (STREAMING-AWS4-HMAC-SHA256-PAYLOAD). This way the body is read once, while it is sent,
+         * instead of once for the payload hash and once more to send it. More information can be found here:
+         * http://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-streaming.html
+         *
+         * Created by AWSAuthV4Signer and attached to the request, the http client then reads the body through it.
+         */
+        class AWS_CORE_API AWSChunkedPayloadSigner
+        {
+        public:
+            /**
+             * Size of the chunks the body is split into, the last chunk holding data may be smaller.
+             */
+            static const size_t DEFAULT_CHUNK_SIZE;
+
+            /**
+             * signingKey, the derived SigV4 key for the date, region and service of the request
+             * dateTime, value of the X-Amz-Date header of the request
+             * credentialScope, date/region/service/aws4_request scope of the request
+             * seedSignature, signature of the request headers, in the Authorization header
+             * payloadLength, number of body bytes to encode, the x-amz-decoded-content-length header of the request
+             */
+            AWSChunkedPayloadSigner(const Aws::Utils::ByteBuffer& signingKey, const Aws::String& dateTime, const Aws::String& credentialScope,
+                    const Aws::String& seedSignature, uint64_t payloadLength, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+            ~AWSChunkedPayloadSigner();
+
+            /**
+             * Size of the encoded body of payloadLength bytes, this is the content-length the request is sent with.
+             */
+            static uint64_t ComputeEncodedLength(uint64_t payloadLength, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+            /**
+             * Fills up to length bytes of buffer with the encoded body, reading the next chunk from body whenever the previous one has been written out.
+             * Returns the number of bytes written, 0 once the final chunk has been written or if the signer failed.
+             * payloadBytes is set to how many of the written bytes are body bytes, for progress reporting.
+             * If payloadHashes is given, each chunk of the body is also added to them (see Aws::Utils::Crypto::Hash::Update) as it is read.
+             */
+            size_t Read(Aws::IStream& body, char* buffer, size_t length, size_t& payloadBytes,
+                    const Aws::Vector<std::shared_ptr<Aws::Utils::Crypto::Hash>>* payloadHashes = nullptr);
+
+            /**
+             * Computes the signature of the next chunk holding the given data, an empty chunk being the final one, and chains it to the next chunk.
+             * Returns an empty string if hashing failed.
+             */
+            Aws::String SignChunk(const Aws::String& chunkData);
+
+            /**
+             * Goes back to the start of the encoded body, for when the body has to be sent again. The body stream must be rewound by the caller.
+             */
+            void Reset();
+
+            /**
+             * True if the body ended before payloadLength bytes were read from it, or hashing failed.
+             */
+            inline bool HasFailed() const { return m_failed; }
+
+            /**
+             * True once the final chunk has been written out.
+             */
+            inline bool IsFinished() const { return m_finalChunkSigned && m_encodedPosition == m_encoded.size(); }
+
+        private:
+            AWSChunkedPayloadSigner(const AWSChunkedPayloadSigner&) = delete;
+            AWSChunkedPayloadSigner& operator=(const AWSChunkedPayloadSigner&) = delete;
+
+            bool EncodeNextChunk(Aws::IStream& body, const Aws::Vector<std::shared_ptr<Aws::Utils::Crypto::Hash>>* payloadHashes);
+
+            Aws::Utils::ByteBuffer m_signingKey;
+            Aws::String m_dateTime;
+            Aws::String m_credentialScope;
+            Aws::String m_seedSignature;
+            uint64_t m_payloadLength;
+            size_t m_chunkSize;
+            Aws::UniquePtr<Aws::Utils::Crypto::Sha256> m_hash;
+            Aws::UniquePtr<Aws::Utils::Crypto::Sha256HMAC> m_HMAC;
+
+            Aws::String m_previousSignature;
+            uint64_t m_payloadRead;
+            bool m_finalChunkSigned;
+            bool m_failed;
+
+            // the chunk being written out: header, data and trailing CRLF, and where its data lies in it.
+            Aws::String m_chunkData;
+            Aws::String m_encoded;
+            size_t m_encodedPosition;
+            size_t m_dataBegin;
+            size_t m_dataEnd;
+        };
+
+    } // namespace Client
+} // namespace Aws
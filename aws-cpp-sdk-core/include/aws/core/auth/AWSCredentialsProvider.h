@@ -37,21 +37,25 @@ namespace Aws
     {
         static int REFRESH_THRESHOLD = 1000 * 60 * 5;
 
+        class CredentialsRefreshScheduler;
+
         /**
          * Simple data object around aws credentials
          */
         class AWS_CORE_API AWSCredentials
         {
         public:
-            AWSCredentials()
+            AWSCredentials() : m_expiration((std::chrono::system_clock::time_point::max)())
             {
             }
 
             /**
-             * Initializes object with accessKeyId, secretKey, and sessionToken. Session token defaults to empty.
+             * Initializes object with accessKeyId, secretKey, and sessionToken. Session token defaults to empty. The credentials
+             * don't expire.
              */
             AWSCredentials(const Aws::String& accessKeyId, const Aws::String& secretKey, const Aws::String& sessionToken = "") :
-                m_accessKeyId(accessKeyId), m_secretKey(secretKey), m_sessionToken(sessionToken)
+                m_accessKeyId(accessKeyId), m_secretKey(secretKey), m_sessionToken(sessionToken),
+                m_expiration((std::chrono::system_clock::time_point::max)())
             {
             }
 
@@ -79,6 +83,14 @@ namespace Aws
                 return m_sessionToken;
             }
 
+            /**
+             * Gets the time temporary credentials expire at, the end of time for credentials which don't.
+             */
+            inline const Aws::Utils::DateTime& GetExpiration() const
+            {
+                return m_expiration;
+            }
+
             /**
              * Sets the underlying access key credential. Copies from parameter accessKeyId.
              */
@@ -103,6 +115,14 @@ namespace Aws
                 m_sessionToken = sessionToken;
             }
 
+            /**
+             * Sets the time temporary credentials expire at.
+             */
+            inline void SetExpiration(const Aws::Utils::DateTime& expiration)
+            {
+                m_expiration = expiration;
+            }
+
             /**
             * Sets the underlying access key credential. Copies from parameter accessKeyId.
             */
@@ -131,6 +151,7 @@ namespace Aws
             Aws::String m_accessKeyId;
             Aws::String m_secretKey;
             Aws::String m_sessionToken;
+            Aws::Utils::DateTime m_expiration;
         };
 
         /**
@@ -290,14 +311,16 @@ namespace Aws
 
         /**
         * Credentials provider implementation that loads credentials from the Amazon
-        * EC2 Instance Metadata Service.
+        * EC2 Instance Metadata Service. The credentials are refreshed on a background thread, every refresh period and ahead
+        * of their expiration, and returned without waiting on the metadata service meanwhile (see CredentialsRefreshScheduler).
         */
         class AWS_CORE_API InstanceProfileCredentialsProvider : public AWSCredentialsProvider
         {
         public:
             /**
              * Initializes the provider to refresh credentials form the EC2 instance metadata service every 5 minutes.
-             * Constructs an EC2MetadataClient using the default http stack (most likely what you want).
+             * Constructs an EC2MetadataClient using the default http stack (most likely what you want). All the providers
+             * constructed this way with the same refresh rate share their credentials and background refresh.
              */
             InstanceProfileCredentialsProvider(long refreshRateMs = REFRESH_THRESHOLD);
 
@@ -316,15 +339,15 @@ namespace Aws
             void Reload() override;
 
         private:
-            void RefreshIfExpired();
-
-            std::shared_ptr<Aws::Config::AWSProfileConfigLoader> m_ec2MetadataConfigLoader;
-            long m_loadFrequencyMs;
+            std::shared_ptr<CredentialsRefreshScheduler> m_refreshScheduler;
         };
 
         /**
         * ECS credentials provider implementation that loads credentials from the Amazon
-        * ECS metadata service or an arbitrary endpoint.
+        * ECS metadata service or an arbitrary endpoint. The credentials are refreshed on a background thread, every refresh
+        * period and ahead of their expiration, and returned without waiting on the endpoint meanwhile (see
+        * CredentialsRefreshScheduler). Providers constructed with the same resource path, or endpoint and token, and
+        * refresh rate share their credentials and background refresh.
         */
         class AWS_CORE_API TaskRoleCredentialsProvider : public AWSCredentialsProvider
         {
@@ -360,15 +383,9 @@ namespace Aws
 
         protected:
             void Reload() override;
-        private:
-            bool ExpiresSoon() const;
-            void RefreshIfExpired();
 
         private:
-            std::shared_ptr<Aws::Internal::ECSCredentialsClient> m_ecsCredentialsClient;
-            long m_loadFrequencyMs;
-            Aws::Utils::DateTime m_expirationDate;
-            Aws::Auth::AWSCredentials m_credentials;
+            std::shared_ptr<CredentialsRefreshScheduler> m_refreshScheduler;
         };
 
     } // namespace Auth
@@ -0,0 +1,158 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace Aws
+{
+    namespace Auth
+    {
+        /**
+         * Keeps credentials from a source of temporary credentials, such as the EC2 instance metadata service, fresh on a background
+         * thread: the credentials are fetched again every refresh period and ahead of their expiration, while GetCredentials() keeps
+         * returning the current ones without waiting on the fetch. Failed fetches are tried again after a jittered, exponentially
+         * growing delay, and the current credentials are kept meanwhile. Only when there are no credentials yet, or they are about to
+         * expire, does GetCredentials() fetch them itself, once for all the threads calling it.
+         *
+         * The background thread starts with the first call to GetCredentials(), so that a provider never asked for credentials, like
+         * the last ones of a provider chain, never reaches out to its source.
+         */
+        class AWS_CORE_API CredentialsRefreshScheduler
+        {
+        public:
+            /**
+             * Fetches credentials from the source, setting their expiration if the source tells it. Returns false on failure.
+             */
+            typedef std::function<bool(AWSCredentials&)> FetchFunctionType;
+
+            /**
+             * Shortest time between two scheduled fetches, whatever the refresh period.
+             */
+            static const long MIN_REFRESH_INTERVAL_MS = 10;
+            /**
+             * How long before their expiration credentials are fetched again by default.
+             */
+            static const long DEFAULT_REFRESH_AHEAD_MS = 5 * 60 * 1000;
+            /**
+             * Credentials closer than this to their expiration are no longer returned without fetching new ones first.
+             */
+            static const long EXPIRATION_GRACE_PERIOD_MS = 5 * 1000;
+            /**
+             * Limit of the delay before the first retry of a failed fetch; each further retry doubles it, up to maxRetryDelayMs.
+             */
+            static const long DEFAULT_RETRY_BASE_DELAY_MS = 1000;
+            static const long DEFAULT_MAX_RETRY_DELAY_MS = 60 * 1000;
+
+            /**
+             * @param fetch Fetches the credentials, called on the background thread or the thread calling GetCredentials().
+             * @param refreshRateMs Time after which the credentials are fetched again, even if they don't expire by then.
+             * @param refreshAheadMs How long before their expiration credentials are fetched again.
+             * @param retryBaseDelayMs Limit of the delay before the first retry of a failed fetch.
+             * @param maxRetryDelayMs Limit of the delay between retries.
+             */
+            CredentialsRefreshScheduler(const FetchFunctionType& fetch, long refreshRateMs, long refreshAheadMs = DEFAULT_REFRESH_AHEAD_MS,
+                long retryBaseDelayMs = DEFAULT_RETRY_BASE_DELAY_MS, long maxRetryDelayMs = DEFAULT_MAX_RETRY_DELAY_MS);
+
+            /**
+             * Stops the background thread, waiting for a fetch in progress to finish.
+             */
+            ~CredentialsRefreshScheduler();
+
+            CredentialsRefreshScheduler(const CredentialsRefreshScheduler&) = delete;
+            CredentialsRefreshScheduler& operator=(const CredentialsRefreshScheduler&) = delete;
+
+            /**
+             * Returns the current credentials, empty ones if none could be fetched.
+             */
+            AWSCredentials GetCredentials();
+
+            /**
+             * Fetches the credentials right away on the calling thread, keeping the current ones if that fails.
+             */
+            void Refresh();
+
+            /**
+             * Returns the scheduler registered under sourceKey, creating it with create if there is none, so that all the providers
+             * of a process getting credentials from the same source share one set of credentials and one background thread. The
+             * registry doesn't keep schedulers alive: once no provider uses it, the next one gets a new scheduler. The registry only
+             * lives between Aws::InitAPI and Aws::ShutdownAPI; outside of them every call gets a new, unshared scheduler.
+             */
+            static std::shared_ptr<CredentialsRefreshScheduler> GetShared(const Aws::String& sourceKey,
+                const std::function<std::shared_ptr<CredentialsRefreshScheduler>()>& create);
+
+        private:
+            struct Loaded
+            {
+                AWSCredentials credentials;
+                std::chrono::steady_clock::time_point loadedAt;
+                // false for the empty credentials published when the first fetch fails.
+                bool fetched;
+            };
+
+            std::shared_ptr<const Loaded> GetLoaded() const;
+            bool NeedsFetchNow(const std::shared_ptr<const Loaded>& loaded) const;
+            std::chrono::steady_clock::time_point GetRefreshTime(const Loaded& loaded) const;
+            std::chrono::steady_clock::time_point GetRetryTime(long failures);
+            // fetches the credentials and publishes them on success; m_fetchLock must be held.
+            bool FetchLocked();
+            void RefreshLoop();
+
+            FetchFunctionType m_fetch;
+            std::chrono::milliseconds m_refreshRate;
+            std::chrono::milliseconds m_refreshAhead;
+            long m_retryBaseDelayMs;
+            long m_maxRetryDelayMs;
+
+            // read and replaced with the atomic shared_ptr functions, never locked by readers.
+            std::shared_ptr<const Loaded> m_loaded;
+            std::mutex m_fetchLock;
+
+            std::atomic<bool> m_refreshStarted;
+            std::mutex m_refreshLock;
+            std::condition_variable m_refreshSignal;
+            bool m_stopping;
+            std::thread m_refreshThread;
+            std::minstd_rand m_random;
+
+            // set on the schedulers registered with GetShared().
+            Aws::String m_sourceKey;
+        };
+
+        /**
+         * Creates the registry of schedulers shared through CredentialsRefreshScheduler::GetShared().
+         * This should only be called once from within Aws::InitAPI
+         */
+        AWS_CORE_API void InitCredentialsRefreshSchedulers();
+
+        /**
+         * Destroys the registry of shared schedulers. Schedulers still in use keep working, they just aren't shared anymore.
+         * This should only be called once from within Aws::ShutdownAPI
+         */
+        AWS_CORE_API void CleanupCredentialsRefreshSchedulers();
+    } // namespace Auth
+} // namespace Aws
@@ -24,6 +24,10 @@
 #include <aws/core/auth/AWSAuthSignerProvider.h>
 #include <memory>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
 
 namespace Aws
 {
@@ -83,9 +87,13 @@ namespace Aws
         class AWSAuthSigner;
         struct ClientConfiguration;
         class RetryStrategy;
+        class RequestLatencyTracker;
+        struct AsyncRequestState;
+        class AsyncAttemptScheduler;
 
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
+        typedef std::function<void(const HttpResponseOutcome&)> HttpResponseOutcomeHandler;
 
         /**
          * Abstract AWS Client. Contains most of the functionality necessary to build an http request, get it signed, and send it accross the wire.
@@ -111,7 +119,10 @@ namespace Aws
                 const std::shared_ptr<Aws::Auth::AWSAuthSignerProvider>& signerProvider,
                 const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller);
 
-            virtual ~AWSClient() { };
+            /**
+             * Waits for the attempts of hedged and deadline bounded requests given up on, cancelled, to wind down.
+             */
+            virtual ~AWSClient();
 
             /**
              * Generates a signed Uri using the injected signer. for the supplied uri and http method. expirationInSecodns defaults
@@ -160,6 +171,20 @@ namespace Aws
             inline virtual const char* GetServiceClientName() const { return nullptr; }
 
         protected:
+            /**
+             * Waits for the requests sent with AttemptExhaustivelyAsync to complete, and for the attempts of hedged and deadline bounded
+             * requests given up on to wind down. Completing a request calls back into the client, so subclasses call this from their
+             * destructor, while their overrides are still around.
+             */
+            void WaitForPendingRequests() const;
+
+            /**
+             * Counts one more request as pending for WaitForPendingRequests, until the returned token and every copy of it are gone.
+             * An AttemptExhaustivelyAsync handler that hands the rest of the work to an executor takes one, while its own request still
+             * counts, and keeps it with the task, so the client isn't destroyed before the task has run.
+             */
+            std::shared_ptr<const void> TrackPendingRequest() const;
+
             /**
              * Calls AttemptOnRequest until it either, succeeds, runs out of retries from the retry strategy,
              * or encounters and error that is not retryable.
@@ -178,6 +203,31 @@ namespace Aws
                     const char* signerName,
                     const char* requestName = nullptr) const;
 
+            /**
+             * Returns true if the http client sends requests without a thread waiting on each of them, so AttemptExhaustivelyAsync
+             * leaves the calling thread free.
+             */
+            bool SupportsAsyncRequests() const;
+
+            /**
+             * Returns true if request can be sent with AttemptExhaustivelyAsync: the http client supports it, and the request neither is
+             * hedged nor has a deadline, which only AttemptExhaustively applies. Operations send the other requests from an executor.
+             */
+            bool SupportsAsyncRequests(const Aws::AmazonWebServiceRequest& request) const;
+
+            /**
+             * Sends request through HttpClient::MakeRequestAsync, retrying it the way AttemptExhaustively does, and calls handler with the
+             * outcome of the last attempt. handler may run on the http client's event loop thread, so it must hand any real work, like parsing
+             * the response, to an executor. Attempts delayed by the retry strategy, whether to back off or to wait for a send token, are kept
+             * on a timer and sent from one thread per client, so no thread waits out the delay. Hedging and deadlines are not applied on this path,
+             * requests that ask for them are for AttemptExhaustively, see SupportsAsyncRequests(request).
+             */
+            void AttemptExhaustivelyAsync(const Aws::Http::URI& uri,
+                    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+                    Http::HttpMethod httpMethod,
+                    const char* signerName,
+                    const HttpResponseOutcomeHandler& handler) const;
+
             /**
              * Build an Http Request from the AmazonWebServiceRequest object. Signs the request, sends it accross the wire
              * then reports the http response.
@@ -212,6 +262,11 @@ namespace Aws
                     const char* signerName = Aws::Auth::SIGV4_SIGNER,
                     const char* requestName = nullptr) const;
 
+            /**
+             * Transfers ownership of the response stream of httpOutcome to a StreamOutcome, as MakeRequestWithUnparsedResponse does.
+             */
+            StreamOutcome BuildStreamOutcome(const HttpResponseOutcome& httpOutcome) const;
+
             /**
              * Abstract.  Subclassing clients should override this to tell the client how to marshall error payloads
              */
@@ -242,6 +297,31 @@ namespace Aws
              * return true if signer's clock is adjusted, false otherwise.
              */
             bool AdjustClockSkew(HttpResponseOutcome& outcome, const char* signerName) const;
+            /**
+             * Waits until the retry strategy lets the next attempt of a request be sent, or requests get cancelled.
+             */
+            void AcquireSendToken(const std::chrono::steady_clock::time_point& deadline) const;
+            /**
+             * Attempts request the way AttemptOneRequest does, but gives up on it at deadline, and with a positive hedgeDelay sends a second
+             * attempt if the first one hasn't finished after it, keeping the first one to succeed. The attempts run on threads of their own,
+             * left to wind down cancelled when given up on. httpRequest is set to the request of the attempt kept.
+             */
+            HttpResponseOutcome AttemptHedgedRequest(const Aws::Http::URI& uri, Http::HttpMethod method,
+                std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const Aws::AmazonWebServiceRequest& request, const char* signerName,
+                std::chrono::milliseconds hedgeDelay, const std::chrono::steady_clock::time_point& deadline) const;
+            /**
+             * Signs the next attempt of an AttemptExhaustivelyAsync request and hands it to the http client, or, if the retry strategy
+             * has no send token for it yet, schedules it again for when it says to.
+             */
+            void SendAsyncAttempt(const std::shared_ptr<AsyncRequestState>& state) const;
+            /**
+             * Retries the AttemptExhaustivelyAsync request after a failed attempt, or completes it.
+             */
+            void OnAsyncAttemptDone(const std::shared_ptr<AsyncRequestState>& state, HttpResponseOutcome&& outcome) const;
+            /**
+             * Delay after which the next attempt of request gets hedged, 0 if it shouldn't be.
+             */
+            std::chrono::milliseconds GetHedgeDelay(const Aws::AmazonWebServiceRequest& request) const;
             void AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const Http::HeaderValueCollection& headerValues) const;
             void AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
                                          const std::shared_ptr<Aws::IOStream>& body, bool needsContentMd5 = false) const;
@@ -259,6 +339,13 @@ namespace Aws
             Aws::String m_userAgent;
             std::shared_ptr<Aws::Utils::Crypto::Hash> m_hash;
             bool m_enableClockSkewAdjustment;
+            std::shared_ptr<RequestLatencyTracker> m_latencyTracker;
+            double m_hedgingPercentile;
+            std::chrono::milliseconds m_hedgingMinDelay;
+            mutable std::mutex m_attemptThreadsLock;
+            mutable std::condition_variable m_attemptThreadsSignal;
+            mutable size_t m_attemptThreads;
+            std::shared_ptr<AsyncAttemptScheduler> m_asyncAttemptScheduler;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Json::JsonValue>, AWSError<CoreErrors>> JsonOutcome;
@@ -294,6 +381,11 @@ namespace Aws
              */
             virtual AWSError<CoreErrors> BuildAWSError(const std::shared_ptr<Aws::Http::HttpResponse>& response) const override;
 
+            /**
+             * Parses the response body of httpOutcome, as returned by AttemptExhaustively or AttemptExhaustivelyAsync, into a Json document.
+             */
+            JsonOutcome BuildJsonOutcome(const HttpResponseOutcome& httpOutcome) const;
+
             /**
              * Returns a Json document or an error from the request. Does some marshalling json and raw streams,
              * then just calls AttemptExhaustively.
@@ -0,0 +1,60 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/StandardRetryStrategy.h>
+#include <aws/core/client/SendRateLimiter.h>
+
+#include <memory>
+
+namespace Aws
+{
+namespace Client
+{
+
+/**
+ * StandardRetryStrategy which also limits the rate at which requests are sent once the service starts throttling them, using a
+ * SendRateLimiter adapted to the responses of every attempt. When a service throttles a fleet of clients, they back off together
+ * instead of retrying in lockstep, and ramp back up as the service stops throttling.
+ *
+ * To limit all the clients of a process talking to a service as one, give them the same strategy, or strategies sharing
+ * the same retry quota and send rate limiter.
+ */
+class AWS_CORE_API AdaptiveRetryStrategy : public StandardRetryStrategy
+{
+public:
+    AdaptiveRetryStrategy(long maxRetries = DEFAULT_MAX_RETRIES, long scaleFactor = DEFAULT_SCALE_FACTOR, long maxBackoff = DEFAULT_MAX_BACKOFF);
+
+    AdaptiveRetryStrategy(const std::shared_ptr<RetryQuotaContainer>& retryQuotaContainer, const std::shared_ptr<SendRateLimiter>& sendRateLimiter,
+        long maxRetries = DEFAULT_MAX_RETRIES, long scaleFactor = DEFAULT_SCALE_FACTOR, long maxBackoff = DEFAULT_MAX_BACKOFF);
+
+    long AcquireSendToken() override;
+
+    void RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome) override;
+
+    void RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome, const AWSError<CoreErrors>& lastError) override;
+
+    inline const std::shared_ptr<SendRateLimiter>& GetSendRateLimiter() const { return m_sendRateLimiter; }
+
+private:
+    void UpdateSendingRate(const HttpResponseOutcome& httpResponseOutcome);
+
+    std::shared_ptr<SendRateLimiter> m_sendRateLimiter;
+};
+
+} // namespace Client
+} // namespace Aws
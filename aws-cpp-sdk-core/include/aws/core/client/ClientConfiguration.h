@@ -94,7 +94,9 @@ namespace Aws
              */
             unsigned long lowSpeedLimit;
             /**
-             * Strategy to use in case of failed requests. Default is DefaultRetryStrategy (e.g. exponential backoff)
+             * Strategy to use in case of failed requests. Default is DefaultRetryStrategy (e.g. exponential backoff).
+             * StandardRetryStrategy adds jitter and a retry budget, AdaptiveRetryStrategy also limits the send rate when the service throttles.
+             * Several clients can share the same strategy.
              */
             std::shared_ptr<RetryStrategy> retryStrategy;
             /**
@@ -154,6 +156,19 @@ namespace Aws
              * Override the http implementation the default factory returns.
              */
             Aws::Http::TransferLibType httpLibOverride;
+            /**
+             * Number of event loop threads the curl multi http client uses to drive its transfers. Default 1.
+             * Only used when httpLibOverride is CURL_MULTI_CLIENT.
+             */
+            unsigned curlMultiIoThreads;
+            /**
+             * If set to true the http stack offers HTTP/2 through ALPN on https connections and falls back to HTTP/1.1 when the server doesn't accept it.
+             * With the curl multi http client, concurrent requests to the same endpoint are then multiplexed as streams over a shared connection
+             * instead of opening a connection each, so on Linux the default factory creates the curl multi http client unless httpLibOverride
+             * says otherwise. The curl http client shares DNS and tls sessions between its connections instead. Multiplexing needs libcurl 8.0
+             * or later. Default false. Only for CURL clients currently.
+             */
+            bool enableHttp2;
             /**
              * If set to true the http stack will follow 300 redirect codes.
              */
@@ -175,6 +190,18 @@ namespace Aws
              */
             bool enableClockSkewAdjustment;
 
+            /**
+             * Percentile of the latencies of an operation's recent attempts after which hedged requests (see
+             * AmazonWebServiceRequest::SetHedgingEnabled) send a second attempt. Hedged requests aren't hedged until the client has
+             * seen enough attempts of the operation. Default 95.
+             */
+            double hedgingPercentile;
+
+            /**
+             * Shortest time in milliseconds hedged requests wait for an attempt before sending a second one. Default 10.
+             */
+            long hedgingMinDelayMs;
+
             /**
              * Enable host prefix injection. 
              * For services whose endpoint is injectable. e.g. servicediscovery, you can modify the http host's prefix so as to add "data-" prefix for DiscoverInstances request.
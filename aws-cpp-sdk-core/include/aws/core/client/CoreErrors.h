@@ -73,6 +73,11 @@ namespace Aws
              * Finds a CoreErrors member if possible by HTTP response code
              */
             AWS_CORE_API AWSError<CoreErrors> GetErrorForHttpResponseCode(Aws::Http::HttpResponseCode code);
+            /**
+             * Whether error is the service throttling the client, either through one of the core throttling errors or a service
+             * specific one such as DynamoDB's ProvisionedThroughputExceededException, or through an HTTP 429 response.
+             */
+            AWS_CORE_API bool IsThrottlingError(const AWSError<CoreErrors>& error);
         } // namespace CoreErrorsMapper
     } // namespace Client
 } // namespace Aws
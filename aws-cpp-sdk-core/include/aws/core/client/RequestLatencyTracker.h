@@ -0,0 +1,69 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <chrono>
+#include <mutex>
+
+namespace Aws
+{
+namespace Client
+{
+
+/**
+ * Keeps the latencies of the last attempts of each operation of a client, so that hedged requests can tell when an attempt takes
+ * longer than most attempts of the same operation. Thread safe.
+ */
+class AWS_CORE_API RequestLatencyTracker
+{
+public:
+    /**
+     * Number of latencies kept per operation.
+     */
+    static const size_t WINDOW_SIZE = 128;
+    /**
+     * Number of latencies an operation needs before GetPercentile() reports one.
+     */
+    static const size_t MIN_SAMPLES = 20;
+
+    void AddSample(const char* operationName, std::chrono::milliseconds latency);
+
+    /**
+     * Sets value to the given percentile, between 0 and 100, of the latencies kept for operationName. Returns false, leaving
+     * value alone, if fewer than MIN_SAMPLES have been added for it.
+     */
+    bool GetPercentile(const char* operationName, double percentile, std::chrono::milliseconds& value) const;
+
+private:
+    struct Window
+    {
+        Window() : next(0) {}
+
+        Aws::Vector<long long> samples;
+        size_t next;
+    };
+
+    mutable std::mutex m_lock;
+    Aws::Map<Aws::String, Window> m_windows;
+};
+
+} // namespace Client
+} // namespace Aws
@@ -0,0 +1,73 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <mutex>
+
+namespace Aws
+{
+namespace Client
+{
+
+enum class CoreErrors;
+template<typename ERROR_TYPE>
+class AWSError;
+
+/**
+ * Budget of retries, shared by the retry strategies holding it, which stops clients from amplifying a service outage by retrying
+ * every failed request. Each retry takes some of the quota, more for timeouts and connection failures than for other errors, and
+ * requests succeeding give some back: the cost of their retry when it is a retry that succeeded, a little otherwise.
+ * Once the quota has been used up, failed requests aren't retried until enough of them succeed again.
+ */
+class AWS_CORE_API RetryQuotaContainer
+{
+public:
+    static const int DEFAULT_RETRY_QUOTA = 500;
+    static const int RETRY_COST = 5;
+    static const int TIMEOUT_RETRY_COST = 10;
+    static const int NO_RETRY_INCREMENT = 1;
+
+    RetryQuotaContainer(int maxRetryQuota = DEFAULT_RETRY_QUOTA);
+
+    /**
+     * Takes the cost of retrying error from the quota. Returns false, taking nothing, if there isn't enough quota left.
+     */
+    bool AcquireRetryQuota(const AWSError<CoreErrors>& error);
+
+    /**
+     * Gives back the cost of a retry of error, which succeeded.
+     */
+    void ReleaseRetryQuota(const AWSError<CoreErrors>& error);
+
+    /**
+     * Gives back capacity, up to the initial quota.
+     */
+    void ReleaseRetryQuota(int capacity);
+
+    int GetRetryQuota() const;
+
+    static int GetRetryCost(const AWSError<CoreErrors>& error);
+
+private:
+    mutable std::mutex m_lock;
+    int m_maxRetryQuota;
+    int m_retryQuota;
+};
+
+} // namespace Client
+} // namespace Aws
@@ -16,15 +16,23 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/UnreferencedParam.h>
+
+#include <memory>
 
 namespace Aws
 {
-    namespace Client
+    namespace Http
     {
+        class HttpResponse;
+    }
 
-        enum class CoreErrors;
-        template<typename ERROR_TYPE>
-        class AWSError;
+    namespace Client
+    {
+        typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
 
         /**
          * Interface for defining a Retry Strategy. Override this class to provide your own custom retry behavior.
@@ -43,6 +51,27 @@ namespace Aws
              */
             virtual long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const = 0;
 
+            /**
+             * Called before every attempt of a request, the first one included, so that strategies can limit the rate at which requests
+             * are sent. Returns 0 when the request can be sent, otherwise the time in milliseconds the client should wait before
+             * calling it again. Defaults to always sending right away.
+             */
+            virtual long AcquireSendToken() { return 0; }
+
+            /**
+             * Called with the outcome of the first attempt of a request.
+             */
+            virtual void RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome) { AWS_UNREFERENCED_PARAM(httpResponseOutcome); }
+
+            /**
+             * Called with the outcome of a retry of a request, lastError being the error of the attempt retried.
+             */
+            virtual void RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome, const AWSError<CoreErrors>& lastError)
+            {
+                AWS_UNREFERENCED_PARAM(httpResponseOutcome);
+                AWS_UNREFERENCED_PARAM(lastError);
+            }
+
         };
 
     } // namespace Client
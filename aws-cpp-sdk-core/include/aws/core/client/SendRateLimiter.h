@@ -0,0 +1,106 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+
+namespace Aws
+{
+namespace Client
+{
+
+/**
+ * Client side limit on the rate at which requests are sent, adapted to the throttling responses of the service the way CUBIC adapts
+ * a TCP congestion window: the rate is cut by a constant factor when a request gets throttled, then grows back along a cubic curve,
+ * quickly while it is well below the rate it got throttled at, slowly around it, quickly again past it.
+ *
+ * The limiter lets everything through until the first throttling response. From then on, sending a request takes a token from a bucket
+ * filled at the current rate; when the bucket is empty, the caller is told how long to wait before trying again, by when the rate may
+ * have changed.
+ *
+ * Thread safe, and meant to be shared by all the clients sending requests to the same service.
+ */
+class AWS_CORE_API SendRateLimiter
+{
+public:
+    using ClockType = std::chrono::steady_clock;
+    using TimeFunctionType = std::function<ClockType::time_point()>;
+
+    static const double MIN_FILL_RATE;
+    static const double MIN_CAPACITY;
+    static const double SMOOTH;
+    static const double BETA;
+    static const double SCALE_CONSTANT;
+
+    SendRateLimiter(TimeFunctionType timeFunction = ClockType::now);
+
+    /**
+     * Takes a token for sending a request, returning 0, or returns the time in milliseconds until the bucket holds one again.
+     */
+    long AcquireToken();
+
+    /**
+     * Adapts the rate to a response of the service, throttling or not.
+     */
+    void UpdateSendingRate(bool isThrottlingResponse);
+
+    /**
+     * Whether the service has throttled requests, and the rate is being limited since.
+     */
+    bool IsEnabled() const;
+
+    /**
+     * Rate at which requests are currently allowed to be sent, in requests per second.
+     */
+    double GetFillRate() const;
+
+    /**
+     * Smoothed rate at which responses have been coming in, in requests per second.
+     */
+    double GetMeasuredSendRate() const;
+
+private:
+    double Now() const;
+    void Refill(double now);
+    void UpdateRate(double now, double newRate);
+    void UpdateMeasuredRate(double now);
+    void CalculateTimeWindow();
+    double CubicSuccess(double now) const;
+    double CubicThrottle(double rateToUse) const;
+
+    TimeFunctionType m_timeFunction;
+    ClockType::time_point m_start;
+    mutable std::mutex m_lock;
+    bool m_enabled;
+    double m_fillRate;
+    double m_maxCapacity;
+    double m_currentCapacity;
+    double m_lastTimestamp;
+    bool m_hasLastTimestamp;
+    double m_measuredTxRate;
+    double m_lastTxRateBucket;
+    long m_requestCount;
+    double m_lastMaxRate;
+    double m_lastThrottleTime;
+    double m_timeWindow;
+};
+
+} // namespace Client
+} // namespace Aws
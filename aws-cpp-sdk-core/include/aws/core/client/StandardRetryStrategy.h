@@ -0,0 +1,72 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/RetryStrategy.h>
+#include <aws/core/client/RetryQuotaContainer.h>
+
+#include <memory>
+#include <mutex>
+#include <random>
+
+namespace Aws
+{
+namespace Client
+{
+
+/**
+ * Retry strategy which waits a random time between 0 and an exponentially growing limit before each retry ("full jitter"), so that
+ * clients failing at the same time don't all retry at the same time again, and which only retries as long as the retry quota it
+ * holds allows. Share the quota between strategies, or the strategy between clients, to give all of them a single retry budget.
+ */
+class AWS_CORE_API StandardRetryStrategy : public RetryStrategy
+{
+public:
+    static const long DEFAULT_MAX_RETRIES = 2;
+    static const long DEFAULT_SCALE_FACTOR = 100;
+    static const long DEFAULT_MAX_BACKOFF = 20000;
+
+    /**
+     * Retries a request up to maxRetries times, with a delay before retry n of up to scaleFactor * 2^n milliseconds,
+     * at most maxBackoff.
+     */
+    StandardRetryStrategy(long maxRetries = DEFAULT_MAX_RETRIES, long scaleFactor = DEFAULT_SCALE_FACTOR, long maxBackoff = DEFAULT_MAX_BACKOFF);
+
+    StandardRetryStrategy(const std::shared_ptr<RetryQuotaContainer>& retryQuotaContainer, long maxRetries = DEFAULT_MAX_RETRIES,
+        long scaleFactor = DEFAULT_SCALE_FACTOR, long maxBackoff = DEFAULT_MAX_BACKOFF);
+
+    bool ShouldRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const override;
+
+    long CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const override;
+
+    void RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome) override;
+
+    void RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome, const AWSError<CoreErrors>& lastError) override;
+
+    inline const std::shared_ptr<RetryQuotaContainer>& GetRetryQuotaContainer() const { return m_retryQuotaContainer; }
+
+private:
+    std::shared_ptr<RetryQuotaContainer> m_retryQuotaContainer;
+    long m_maxRetries;
+    long m_scaleFactor;
+    long m_maxBackoff;
+    mutable std::mutex m_randomLock;
+    mutable std::minstd_rand m_random;
+};
+
+} // namespace Client
+} // namespace Aws
@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <atomic>
+#include <functional>
 #include <mutex>
 #include <condition_variable>
 
@@ -38,6 +39,11 @@ namespace Aws
         class HttpRequest;
         class HttpResponse;
 
+        /**
+         * Closure type invoked once a request made with HttpClient::MakeRequestAsync completes. The response is nullptr if the request failed.
+         */
+        typedef std::function<void(const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>&)> HttpResponseHandler;
+
         /**
           * Abstract HttpClient. All it does is make HttpRequests and return their response.
           */
@@ -69,6 +75,25 @@ namespace Aws
                 return nullptr;
             }
 
+            /**
+             * Returns true if this client sends request bodies through their chunked payload signer (aws-chunked), which signing
+             * with PayloadSigningPolicy::Streaming needs. Clients that don't send the body as is, so it has to be signed up front.
+             */
+            virtual bool SupportsChunkedPayloadSigning() const { return false; }
+
+            /**
+             * Returns true if MakeRequestAsync returns before the request completes, leaving no thread waiting on it.
+             */
+            virtual bool SupportsAsyncRequests() const { return false; }
+
+            /**
+             * Makes request and calls handler with its response once it completes. The default implementation makes the request
+             * on the calling thread through MakeRequest; clients that override it may call handler on a thread of their own, which must not block.
+             */
+            virtual void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpResponseHandler& handler,
+                Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+                Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const;
+
             /**
              * Stops all requests in progress and prevents any others from initiating.
              */
@@ -21,6 +21,7 @@
 #include <aws/core/http/HttpTypes.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/monitoring/HttpClientMetrics.h>
 #include <memory>
@@ -30,6 +31,19 @@ using namespace Aws::Monitoring;
 
 namespace Aws
 {
+    namespace Client
+    {
+        class AWSChunkedPayloadSigner;
+    } // namespace Client
+
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            class Hash;
+        } // namespace Crypto
+    } // namespace Utils
+
     namespace Http
     {
         extern AWS_CORE_API const char* DATE_HEADER;
@@ -67,6 +81,29 @@ namespace Aws
          */
         typedef std::function<bool(const HttpRequest*)> ContinueRequestHandler;
 
+        /**
+         * A caller owned region of memory that the response body is written into directly, instead of going through the
+         * response body stream. The memory must stay valid until the request completes.
+         */
+        struct ResponseBodyBuffer
+        {
+            ResponseBodyBuffer() : data(nullptr), length(0) {}
+            ResponseBodyBuffer(unsigned char* bufferData, size_t bufferLength) : data(bufferData), length(bufferLength) {}
+
+            unsigned char* data;
+            size_t length;
+        };
+
+        /**
+         * Scatter list of regions filled in order; the body continues in the next region once one is full.
+         */
+        typedef Aws::Vector<ResponseBodyBuffer> ResponseBodyBufferList;
+
+        /**
+         * Hashes (see Aws::Utils::Crypto::Hash::Update) fed with the body bytes as they go over the wire. Call GetHash() on them once the request completes.
+         */
+        typedef Aws::Vector<std::shared_ptr<Aws::Utils::Crypto::Hash>> BodyHashList;
+
         /**
           * Abstract class for representing an HttpRequest.
           */
@@ -77,7 +114,7 @@ namespace Aws
              * Initializes an HttpRequest object with uri and http method.
              */
             HttpRequest(const URI& uri, HttpMethod method) :
-                m_uri(uri), m_method(method)
+                m_uri(uri), m_method(method), m_chunkedPayloadSigningSupported(false)
             {}
 
             virtual ~HttpRequest() {}
@@ -468,6 +505,65 @@ namespace Aws
 
             inline const ContinueRequestHandler& GetContinueRequestHandler() const { return m_continueRequest; }
 
+            /**
+             * Sets caller owned buffers that a successful (2xx) response body is written into directly, leaving the response body stream empty.
+             * Error bodies still go to the stream so they can be parsed. A body larger than the buffers fails the request.
+             * HttpResponse::GetResponseBodyBufferedBytes tells how much of the buffers the body filled.
+             * Only honored by the curl http clients; other clients write to the response body stream as usual.
+             */
+            inline void SetResponseBodyBuffers(const ResponseBodyBufferList& buffers) { m_responseBodyBuffers = buffers; }
+            /**
+             * Gets the caller owned buffers the response body is written into. Empty if the body goes to the response body stream.
+             */
+            inline const ResponseBodyBufferList& GetResponseBodyBuffers() const { return m_responseBodyBuffers; }
+
+            /**
+             * Sets the signer the content body is encoded (aws-chunked) and signed through, chunk by chunk, while it is sent.
+             * Set by AWSAuthV4Signer when signing with PayloadSigningPolicy::Streaming. Only honored by the curl http client.
+             */
+            inline void SetChunkedPayloadSigner(const std::shared_ptr<Aws::Client::AWSChunkedPayloadSigner>& signer) { m_chunkedPayloadSigner = signer; }
+            /**
+             * Gets the signer the content body is sent through, nullptr if the body is sent as is.
+             */
+            inline const std::shared_ptr<Aws::Client::AWSChunkedPayloadSigner>& GetChunkedPayloadSigner() const { return m_chunkedPayloadSigner; }
+            /**
+             * Sets whether the http client this request is sent with honors a chunked payload signer. Set by AWSClient before signing,
+             * AWSAuthV4Signer signs the whole body up front instead of in chunks when it is false.
+             */
+            inline void SetChunkedPayloadSigningSupported(bool supported) { m_chunkedPayloadSigningSupported = supported; }
+            /**
+             * Gets whether the http client this request is sent with honors a chunked payload signer.
+             */
+            inline bool IsChunkedPayloadSigningSupported() const { return m_chunkedPayloadSigningSupported; }
+
+            /**
+             * Adds a hash that is updated with the content body (not its aws-chunked encoding) while it is sent, so it is computed without reading the body again.
+             * The hash is started over when the body is rewound for a retry. Only honored by the curl http client.
+             */
+            inline void AddRequestBodyHash(const std::shared_ptr<Aws::Utils::Crypto::Hash>& hash) { m_requestBodyHashes.push_back(hash); }
+            /**
+             * Sets the hashes updated with the content body while it is sent.
+             */
+            inline void SetRequestBodyHashes(const BodyHashList& hashes) { m_requestBodyHashes = hashes; }
+            /**
+             * Gets the hashes updated with the content body while it is sent.
+             */
+            inline const BodyHashList& GetRequestBodyHashes() const { return m_requestBodyHashes; }
+
+            /**
+             * Adds a hash that is updated with the response body while it is received, e.g. to check it against a checksum header of the response.
+             * Only honored by the curl http client.
+             */
+            inline void AddResponseBodyHash(const std::shared_ptr<Aws::Utils::Crypto::Hash>& hash) { m_responseBodyHashes.push_back(hash); }
+            /**
+             * Sets the hashes updated with the response body while it is received.
+             */
+            inline void SetResponseBodyHashes(const BodyHashList& hashes) { m_responseBodyHashes = hashes; }
+            /**
+             * Gets the hashes updated with the response body while it is received.
+             */
+            inline const BodyHashList& GetResponseBodyHashes() const { return m_responseBodyHashes; }
+
             /**
              * Gets the AWS Access Key if this HttpRequest is signed with Aws Access Key
              */
@@ -509,6 +605,11 @@ namespace Aws
             DataReceivedEventHandler m_onDataReceived;
             DataSentEventHandler m_onDataSent;
             ContinueRequestHandler m_continueRequest;
+            ResponseBodyBufferList m_responseBodyBuffers;
+            std::shared_ptr<Aws::Client::AWSChunkedPayloadSigner> m_chunkedPayloadSigner;
+            bool m_chunkedPayloadSigningSupported;
+            BodyHashList m_requestBodyHashes;
+            BodyHashList m_responseBodyHashes;
             Aws::String m_signingRegion;
             Aws::String m_signingAccessKey;
             HttpClientMetricsCollection m_httpRequestMetrics;
@@ -148,7 +148,8 @@ namespace Aws
                 m_sharedHttpRequest(nullptr),
                 m_responseCode(HttpResponseCode::REQUEST_NOT_MADE),
                 m_hasClientSigningError(false),
-                m_hasNetworkConnectionError(false)
+                m_hasNetworkConnectionError(false),
+                m_responseBodyBufferedBytes(0)
             {}
 
             /**
@@ -159,7 +160,8 @@ namespace Aws
                 m_sharedHttpRequest(originatingRequest),
                 m_responseCode(HttpResponseCode::REQUEST_NOT_MADE),
                 m_hasClientSigningError(false),
-                m_hasNetworkConnectionError(false)
+                m_hasNetworkConnectionError(false),
+                m_responseBodyBufferedBytes(0)
             {}
 
             virtual ~HttpResponse() = default;
@@ -217,6 +219,15 @@ namespace Aws
              * responsibility to clean up this object.
              */
             virtual Utils::Stream::ResponseStream&& SwapResponseStreamOwnership() = 0;
+            /**
+             * Gets the number of body bytes written into the response body buffers of the originating request instead of the response body.
+             * 0 if the request has none, or the body went to the response body stream because the response is an error.
+             */
+            virtual inline uint64_t GetResponseBodyBufferedBytes() const { return m_responseBodyBufferedBytes; }
+            /**
+             * Adds to the number of body bytes written into the response body buffers of the originating request.
+             */
+            virtual inline void AddResponseBodyBufferedBytes(uint64_t bytes) { m_responseBodyBufferedBytes += bytes; }
             /**
              * Adds a header to the http response object.
              */
@@ -235,6 +246,7 @@ namespace Aws
             HttpResponseCode m_responseCode;
             bool m_hasClientSigningError;
             bool m_hasNetworkConnectionError;
+            uint64_t m_responseBodyBufferedBytes;
         };
 
 
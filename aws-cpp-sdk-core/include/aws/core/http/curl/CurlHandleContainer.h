@@ -1,12 +1,12 @@
 /*
   * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
-  * 
+  *
   * Licensed under the Apache License, Version 2.0 (the "License").
   * You may not use this file except in compliance with the License.
   * A copy of the License is located at
-  * 
+  *
   *  http://aws.amazon.com/apache2.0
-  * 
+  *
   * or in the "license" file accompanying this file. This file is distributed
   * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
   * express or implied. See the License for the specific language governing
@@ -15,8 +15,13 @@
 
 #pragma once
 
-#include <aws/core/utils/ResourceManager.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <utility>
 #include <curl/curl.h>
 
@@ -26,10 +31,45 @@ namespace Http
 {
 
 /**
-  * Simple Connection pool manager for Curl. It maintains connections in a thread safe manner. You
-  * can call into acquire a handle, then put it back when finished. It is assumed that reusing an already
-  * initialized handle is preferable (especially for synchronous clients). The pool doubles in capacity as
-  * needed up to the maximum amount of connections.
+  * Point in time snapshot of the counters kept by CurlHandleContainer.
+  */
+struct CurlHandlePoolStats
+{
+    CurlHandlePoolStats() : hits(0), misses(0), waits(0), waitTimeMs(0), resets(0), poolSize(0) {}
+
+    /**
+     * Acquisitions served by an idle handle that last talked to the same host, so its connection is likely still warm.
+     */
+    uint64_t hits;
+    /**
+     * Acquisitions served by a newly created handle or by an idle handle that last talked to a different host.
+     */
+    uint64_t misses;
+    /**
+     * Acquisitions that had to block because every handle was in use.
+     */
+    uint64_t waits;
+    /**
+     * Total time in milliseconds spent blocked in those acquisitions.
+     */
+    uint64_t waitTimeMs;
+    /**
+     * Idle handles reset and re-initialized with the default options because they were handed to a different host than the one they
+     * last talked to. Handles going back to the same host are reused as they are.
+     */
+    uint64_t resets;
+    /**
+     * Handles created so far, never more than the max pool size.
+     */
+    unsigned poolSize;
+};
+
+/**
+  * Connection pool manager for Curl. It maintains connections in a thread safe manner. You
+  * can call into acquire a handle, then put it back when finished. Idle handles are kept in shards keyed by the host they
+  * last talked to, so acquiring for a host prefers a handle whose connection (and tls session) to that host is still open,
+  * and threads talking to different hosts rarely contend on the same lock. The pool grows one handle at a time
+  * as needed up to the maximum amount of connections.
   */
 class CurlHandleContainer
 {
@@ -38,19 +78,39 @@ public:
       * Initializes an empty stack of CURL handles. If you are only making synchronous calls via your http client
       * then a small size is best. For async support, a good value would be 6 * number of Processors.   *
       */
+    /**
+      * With shareSessions, the handles share one DNS cache and one tls session cache, so a handle opening a new connection
+      * to a host another handle already talked to skips the lookup and resumes the tls session.
+      */
     CurlHandleContainer(unsigned maxSize = 50, long requestTimeout = 3000, long connectTimeout = 1000,
-                        bool tcpKeepAlive = true, unsigned long tcpKeepAliveIntervalMs = 30000, unsigned long lowSpeedLimit = 1);
+                        bool tcpKeepAlive = true, unsigned long tcpKeepAliveIntervalMs = 30000, unsigned long lowSpeedLimit = 1,
+                        bool shareSessions = false);
     ~CurlHandleContainer();
 
     /**
       * Blocks until a curl handle from the pool is available for use.
       */
     CURL* AcquireCurlHandle();
+    /**
+      * Blocks until a curl handle from the pool is available for use, preferring one that last talked to hostKey.
+      * hostKey is any string identifying the endpoint, e.g. "host:port". A handle that last talked to hostKey is returned with the
+      * options of its previous request still set, callers set every option they rely on.
+      */
+    CURL* AcquireCurlHandle(const Aws::String& hostKey);
     /**
       * Returns a handle to the pool for reuse. It is imperative that this is called
       * after you are finished with the handle.
       */
     void ReleaseCurlHandle(CURL* handle);
+    /**
+      * Returns a handle that was used to talk to hostKey to the pool for reuse.
+      */
+    void ReleaseCurlHandle(CURL* handle, const Aws::String& hostKey);
+
+    /**
+      * Returns a snapshot of the pool counters.
+      */
+    CurlHandlePoolStats GetStats() const;
 
 private:
     CurlHandleContainer(const CurlHandleContainer&) = delete;
@@ -58,18 +118,45 @@ private:
     CurlHandleContainer(const CurlHandleContainer&&) = delete;
     const CurlHandleContainer& operator = (const CurlHandleContainer&&) = delete;
 
-    bool CheckAndGrowPool();
+    static const size_t SHARD_COUNT = 16;
+
+    struct PoolShard
+    {
+        std::mutex shardLock;
+        Aws::Map<Aws::String, Aws::Vector<CURL*>> idleHandles;
+    };
+
+    size_t GetShardIndex(const Aws::String& hostKey) const;
+    /**
+      * Takes an idle handle of hostKey, or of any host if hostKey is nullptr, out of a shard. The handle is reset if it last talked to
+      * another host than acquiringHostKey.
+      */
+    CURL* TryAcquireFromShard(size_t shardIndex, const Aws::String* hostKey, const Aws::String& acquiringHostKey);
+    CURL* TryCreateHandle();
     void SetDefaultOptionsOnHandle(CURL* handle);
+    static void LockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr);
+    static void UnlockShare(CURL* handle, curl_lock_data data, void* userptr);
 
-    Aws::Utils::ExclusiveOwnershipResourceManager<CURL*> m_handleContainer;
+    PoolShard m_shards[SHARD_COUNT];
     unsigned m_maxPoolSize;
     unsigned long m_requestTimeout;
     unsigned long m_connectTimeout;
     bool m_enableTcpKeepAlive;
     unsigned long m_tcpKeepAliveIntervalMs;
     unsigned long m_lowSpeedLimit;
-    unsigned m_poolSize;
-    std::mutex m_containerLock;
+    std::atomic<unsigned> m_poolSize;
+    std::atomic<unsigned> m_idleCount;
+    std::atomic<unsigned> m_waiters;
+    std::mutex m_waitLock;
+    std::condition_variable m_waitSignal;
+
+    std::atomic<uint64_t> m_hits;
+    std::atomic<uint64_t> m_misses;
+    std::atomic<uint64_t> m_waits;
+    std::atomic<uint64_t> m_waitTimeMs;
+    std::atomic<uint64_t> m_resets;
+    CURLSH* m_share;
+    std::mutex m_shareLocks[CURL_LOCK_DATA_LAST];
 };
 
 } // namespace Http
@@ -32,6 +32,52 @@ namespace Standard
     class StandardHttpResponse;
 }
 
+class CurlHttpClient;
+
+/**
+ * State handed to curl's write callback for the lifetime of one transfer.
+ */
+struct CurlWriteCallbackContext
+{
+    CurlWriteCallbackContext(const CurlHttpClient* client,
+                             HttpRequest* request,
+                             HttpResponse* response,
+                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
+        m_client(client),
+        m_request(request),
+        m_response(response),
+        m_rateLimiter(rateLimiter),
+        m_numBytesResponseReceived(0),
+        m_bodyBufferIndex(0),
+        m_bodyBufferOffset(0)
+    {}
+
+    const CurlHttpClient* m_client;
+    HttpRequest* m_request;
+    HttpResponse* m_response;
+    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    int64_t m_numBytesResponseReceived;
+    // position in the request's response body buffers, if it has any
+    size_t m_bodyBufferIndex;
+    size_t m_bodyBufferOffset;
+};
+
+/**
+ * State handed to curl's read and seek callbacks for the lifetime of one transfer.
+ */
+struct CurlReadCallbackContext
+{
+    CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request, Aws::Utils::RateLimits::RateLimiterInterface* limiter) :
+        m_client(client),
+        m_rateLimiter(limiter),
+        m_request(request)
+    {}
+
+    const CurlHttpClient* m_client;
+    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    HttpRequest* m_request;
+};
+
 //Curl implementation of an http client. Right now it is only synchronous.
 class AWS_CORE_API CurlHttpClient: public HttpClient
 {
@@ -50,11 +96,49 @@ public:
     std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
             Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
 
+    //Request bodies are read through their chunked payload signer, if they have one.
+    bool SupportsChunkedPayloadSigning() const override { return true; }
+
+    //Returns hit/miss/wait counters of the curl handle pool backing this client.
+    CurlHandlePoolStats GetConnectionPoolStats() const;
+
     static void InitGlobalState();
     static void CleanupGlobalState();
 
-private:
+protected:
+    /**
+     * Returns the scheme://authority:port key that identifies the endpoint request is sent to, used to keep handles and
+     * connections affine to a host.
+     */
+    static Aws::String ComputeConnectionPoolKey(const HttpRequest& request);
+    /**
+     * Builds the curl header list for request. The caller owns the list and must free it with curl_slist_free_all
+     * once the transfer has completed.
+     */
+    struct curl_slist* BuildHeaderList(const HttpRequest& request) const;
+    /**
+     * Applies every per-request option (url, method, callbacks, tls, proxy) to an acquired handle.
+     * The contexts must outlive the transfer.
+     */
+    void ConfigureHandleForRequest(CURL* connectionHandle, HttpRequest& request, struct curl_slist* headers,
+        CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const;
+    /**
+     * Inspects a finished transfer: sets the response code and content type, validates the body length and records
+     * http client metrics on the request. Sets response to nullptr if the transfer failed.
+     */
+    void HandleTransferResult(CURL* connectionHandle, CURLcode curlResponseCode, HttpRequest& request,
+        std::shared_ptr<Standard::StandardHttpResponse>& response, const CurlWriteCallbackContext& writeContext) const;
+
+    /**
+     * curl's write callback: writes a chunk of the response body, userdata being the CurlWriteCallbackContext of the transfer, into the
+     * request's response body buffers if it has any and the response is a success, otherwise into the response body stream.
+     * Returns 0, which aborts the transfer, if the request was cancelled or the body doesn't fit in the buffers.
+     */
+    static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata);
+
     mutable CurlHandleContainer m_curlHandleContainer;
+
+private:
     bool m_isUsingProxy;
     Aws::String m_proxyUserName;
     Aws::String m_proxyPassword;
@@ -66,6 +150,7 @@ private:
     Aws::String m_caFile;
     bool m_disableExpectHeader;
     bool m_allowRedirects;
+    bool m_enableHttp2;
     static std::atomic<bool> isInit;
 
     void MakeRequestInternal(HttpRequest& request, std::shared_ptr<Standard::StandardHttpResponse>& response,
@@ -76,10 +161,14 @@ private:
     static size_t ReadBody(char* ptr, size_t size, size_t nmemb, void* userdata);
     //Callback to seek the content from the content body of the request
     static size_t SeekBody(void* userdata, curl_off_t offset, int origin);
-    //callback to write the content from the response to the response object
-    static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata);
     //callback to write the headers from the response to the response
     static size_t WriteHeader(char* ptr, size_t size, size_t nmemb, void* userdata);
+    //callback curl calls at least once a second during a transfer, which aborts it once the request is cancelled
+#if LIBCURL_VERSION_NUM >= 0x072000
+    static int CheckTransferProgress(void* userdata, curl_off_t downloadTotal, curl_off_t downloaded, curl_off_t uploadTotal, curl_off_t uploaded);
+#else
+    static int CheckTransferProgress(void* userdata, double downloadTotal, double downloaded, double uploadTotal, double uploaded);
+#endif
 
 };
 
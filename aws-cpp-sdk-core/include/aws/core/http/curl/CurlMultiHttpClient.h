@@ -0,0 +1,101 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <atomic>
+#include <functional>
+
+#if defined(__linux__)
+
+namespace Aws
+{
+namespace Http
+{
+
+class CurlMultiEventLoop;
+struct CurlMultiTransfer;
+
+/**
+ * Closure type invoked when an asynchronous curl multi transfer completes. The response is nullptr if the transfer failed.
+ * The handler runs on the event loop thread, so it must not block.
+ */
+typedef HttpResponseHandler CurlMultiResponseHandler;
+
+/**
+ * Curl implementation of an http client that drives many transfers concurrently through curl_multi_socket_action.
+ * Each event loop thread owns one multi handle and waits for socket readiness with epoll, so thousands of requests can be
+ * in flight without dedicating a thread to each of them. Transfers are spread across the event loops in round robin order.
+ * Select it by setting ClientConfiguration::httpLibOverride to TransferLibType::CURL_MULTI_CLIENT.
+ * With ClientConfiguration::enableHttp2, concurrent requests to the same https endpoint become streams on a shared connection.
+ *
+ * Callbacks registered on the request (data sent/received, continue request) and rate limiters run on the event loop thread.
+ */
+class AWS_CORE_API CurlMultiHttpClient: public CurlHttpClient
+{
+public:
+
+    using Base = CurlHttpClient;
+
+    //Creates client and starts clientConfig.curlMultiIoThreads event loop threads.
+    CurlMultiHttpClient(const Aws::Client::ClientConfiguration& clientConfig);
+    //Stops the event loops; transfers still in flight complete with a nullptr response.
+    ~CurlMultiHttpClient();
+
+    //Makes request and blocks the calling thread until the event loop completes it
+    AWS_DEPRECATED("This funciton in base class has been deprecated")
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    /**
+     * Makes request with shared_ptr typed request and blocks the calling thread until the event loop completes it.
+     * Called from an event loop thread, e.g. from a response handler, it makes the request on that thread the way CurlHttpClient does
+     * instead, as waiting for the loop would deadlock it.
+     */
+    std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    bool SupportsAsyncRequests() const override { return true; }
+
+    /**
+     * Queues request on one of the event loops and returns immediately; handler is invoked once the transfer completes.
+     * Blocks only when maxConnections transfers are already in flight.
+     */
+    void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const CurlMultiResponseHandler& handler,
+            Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+private:
+    friend class CurlMultiEventLoop;
+
+    //Returns true if the calling thread is one of this client's event loop threads.
+    bool IsEventLoopThread() const;
+
+    //Called on the event loop thread once curl has finished with the transfer.
+    void CompleteTransfer(CurlMultiTransfer* transfer, CURLcode curlResponseCode) const;
+
+    Aws::Vector<std::shared_ptr<CurlMultiEventLoop>> m_eventLoops;
+    mutable std::atomic<size_t> m_nextEventLoop;
+    bool m_multiplexStreams;
+};
+
+} // namespace Http
+} // namespace Aws
+
+#endif // defined(__linux__)
@@ -82,7 +82,13 @@ namespace Aws
             /**
              * Unknow Metrics Type
              */
-            Unknown
+            Unknown,
+
+            /**
+             * Requires the SDK to know which http protocol version was used for the request,
+             * contains the major and minor version as a two digit number, e.g. 11 for HTTP/1.1 and 20 for HTTP/2.
+             */
+            HttpVersion
         };
 
         typedef Aws::Map<Aws::String, int64_t> HttpClientMetricsCollection;
@@ -0,0 +1,74 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+/**
+ * AWS_CPU_X86_64 is defined when building for x86-64 with a compiler whose intrinsics the optimized code paths use.
+ * Functions using instructions the baseline doesn't have are declared with AWS_CPU_TARGET("<features>"), and only called
+ * when CpuFeatures says the cpu has them.
+ */
+#if (defined(__x86_64__) || defined(_M_X64)) && (defined(__GNUC__) || defined(_MSC_VER))
+#define AWS_CPU_X86_64 1
+#if defined(_MSC_VER) && !defined(__clang__)
+#define AWS_CPU_TARGET(features)
+#else
+#define AWS_CPU_TARGET(features) __attribute__((target(features)))
+#endif
+#endif
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Instruction set extensions of the cpu the process runs on, which optimized code paths are picked by at runtime.
+         * All false on other architectures than x86-64.
+         */
+        class AWS_CORE_API CpuFeatures
+        {
+        public:
+            /**
+             * Features of this cpu, detected the first time this is called.
+             */
+            static const CpuFeatures& Get();
+
+            inline bool HasSSSE3() const { return m_ssse3; }
+
+            inline bool HasSSE41() const { return m_sse41; }
+
+            inline bool HasSSE42() const { return m_sse42; }
+
+            inline bool HasPCLMUL() const { return m_pclmul; }
+
+            /**
+             * True only if the operating system also saves the AVX registers on context switches.
+             */
+            inline bool HasAVX2() const { return m_avx2; }
+
+        private:
+            CpuFeatures();
+
+            bool m_ssse3;
+            bool m_sse41;
+            bool m_sse42;
+            bool m_pclmul;
+            bool m_avx2;
+        };
+
+    } // namespace Utils
+} // namespace Aws
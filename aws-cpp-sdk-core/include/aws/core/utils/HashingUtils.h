@@ -52,6 +52,30 @@ namespace Aws
             */
             static ByteBuffer HexDecode(const Aws::String& str);
 
+            /**
+            * Base64 encodes length bytes of data into output, which must have room for Base64::CalculateBase64EncodedLength(length) chars.
+            * No null terminator is written. Returns the number of chars written.
+            */
+            static size_t Base64Encode(const unsigned char* data, size_t length, char* output);
+
+            /**
+            * Base64 decodes length chars of encoded into output, which must have room for
+            * Base64::CalculateBase64DecodedLength(encoded, length) bytes. Returns that length.
+            */
+            static size_t Base64Decode(const char* encoded, size_t length, unsigned char* output);
+
+            /**
+            * Hex encodes length bytes of data into output, which must have room for 2 * length chars.
+            * No null terminator is written. Returns the number of chars written.
+            */
+            static size_t HexEncode(const unsigned char* data, size_t length, char* output);
+
+            /**
+            * Hex decodes length chars of str, optionally prefixed with 0x, into output, which must have room for length / 2 bytes.
+            * Returns the number of bytes written, 0 if length is odd.
+            */
+            static size_t HexDecode(const char* str, size_t length, unsigned char* output);
+
             /**
             * Calculates a SHA256 HMAC digest (not hex encoded)
             */
@@ -87,6 +111,26 @@ namespace Aws
             */
             static ByteBuffer CalculateMD5(Aws::IOStream& stream);
 
+            /**
+            * Calculates a CRC32 checksum (4 bytes, big-endian)
+            */
+            static ByteBuffer CalculateCRC32(const Aws::String& str);
+
+            /**
+            * Calculates a CRC32 checksum on a stream (the entire stream is read, 4 bytes, big-endian)
+            */
+            static ByteBuffer CalculateCRC32(Aws::IOStream& stream);
+
+            /**
+            * Calculates a CRC32C checksum (4 bytes, big-endian)
+            */
+            static ByteBuffer CalculateCRC32C(const Aws::String& str);
+
+            /**
+            * Calculates a CRC32C checksum on a stream (the entire stream is read, 4 bytes, big-endian)
+            */
+            static ByteBuffer CalculateCRC32C(Aws::IOStream& stream);
+
             static int HashString(const char* strToHash);
 
         };
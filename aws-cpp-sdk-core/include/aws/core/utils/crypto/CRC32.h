@@ -0,0 +1,108 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/crypto/Hash.h>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            /**
+             * CRC32 (the gzip/zip polynomial) checksum. Uses carry-less multiplication (PCLMULQDQ) when the cpu supports it,
+             * and a table based implementation otherwise. The hash is the 4 bytes of the checksum in big-endian order.
+             */
+            class AWS_CORE_API CRC32 : public Hash
+            {
+            public:
+                CRC32() : m_crc(0) {}
+                virtual ~CRC32() {}
+
+                /**
+                * Calculates the CRC32 of str
+                */
+                virtual HashResult Calculate(const Aws::String& str) override;
+
+                /**
+                * Calculates the CRC32 of a stream (the entire stream is read)
+                */
+                virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                /**
+                * Adds bufferSize bytes of buffer to the checksum being computed incrementally.
+                */
+                virtual void Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Finishes the incremental checksum and starts a new one.
+                */
+                virtual HashResult GetHash() override;
+
+                /**
+                 * Continues the checksum previousCrc with length bytes of data, 0 starts a new checksum.
+                 */
+                static uint32_t Checksum(const unsigned char* data, size_t length, uint32_t previousCrc = 0);
+
+            private:
+                uint32_t m_crc;
+            };
+
+            /**
+             * CRC32C (the Castagnoli polynomial) checksum. Uses the SSE4.2 crc32 instruction when the cpu supports it,
+             * and a table based implementation otherwise. The hash is the 4 bytes of the checksum in big-endian order.
+             */
+            class AWS_CORE_API CRC32C : public Hash
+            {
+            public:
+                CRC32C() : m_crc(0) {}
+                virtual ~CRC32C() {}
+
+                /**
+                * Calculates the CRC32C of str
+                */
+                virtual HashResult Calculate(const Aws::String& str) override;
+
+                /**
+                * Calculates the CRC32C of a stream (the entire stream is read)
+                */
+                virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                /**
+                * Adds bufferSize bytes of buffer to the checksum being computed incrementally.
+                */
+                virtual void Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Finishes the incremental checksum and starts a new one.
+                */
+                virtual HashResult GetHash() override;
+
+                /**
+                 * Continues the checksum previousCrc with length bytes of data, 0 starts a new checksum.
+                 */
+                static uint32_t Checksum(const unsigned char* data, size_t length, uint32_t previousCrc = 0);
+
+            private:
+                uint32_t m_crc;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
@@ -95,8 +95,17 @@ namespace Aws
                 int_type underflow() override;
                 off_type ComputeAbsSeekPosition(off_type, std::ios_base::seekdir,  std::fpos<FPOS_TYPE>);
                 void FinalizeCipher();
+                /**
+                 * Runs the first readSize bytes of the src buffer through the cipher.
+                 */
+                CryptoBuffer TransformSrcBuffer(size_t readSize);
+                /**
+                 * Copies data after the put back area of the get area and points the get area at it. Returns the start of the get area.
+                 */
+                char* FillGetArea(const CryptoBuffer& data);
 
                 CryptoBuffer m_isBuf;
+                CryptoBuffer m_srcBuf;
                 SymmetricCipher& m_cipher;
                 Aws::IStream& m_stream;
                 CipherMode m_cipherMode;
@@ -146,6 +155,10 @@ namespace Aws
                 int_type overflow(int_type ch) override;
                 int sync() override;
                 bool writeOutput(bool finalize);
+                /**
+                 * Writes data to the sink, leaving out its first skip bytes. Returns how many bytes are left to skip after it.
+                 */
+                size_t WriteToSink(const CryptoBuffer& data, size_t skip);
 
                 CryptoBuffer m_osBuf;
                 SymmetricCipher& m_cipher;
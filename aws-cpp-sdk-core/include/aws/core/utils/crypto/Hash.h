@@ -46,8 +46,23 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) = 0;
 
+                /**
+                * Adds bufferSize bytes of buffer to the digest being computed incrementally, for data that is only seen a piece at a time.
+                * Independent of Calculate. By default the data is kept until GetHash hashes all of it with Calculate; implementations
+                * that can digest a piece at a time override both.
+                */
+                virtual void Update(const unsigned char* buffer, size_t bufferSize);
+
+                /**
+                * Finishes the digest of everything passed to Update since the last call to GetHash, and starts a new one.
+                */
+                virtual HashResult GetHash();
+
                 // when hashing streams, this is the size of our internal buffer we read the stream into
                 static const uint32_t INTERNAL_HASH_STREAM_BUFFER_SIZE = 8192;
+
+            private:
+                Aws::String m_pendingUpdates;
             };
 
             /**
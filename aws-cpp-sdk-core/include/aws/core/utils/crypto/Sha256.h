@@ -64,6 +64,16 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                /**
+                * Adds bufferSize bytes of buffer to the digest being computed incrementally.
+                */
+                virtual void Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Finishes the incremental digest and starts a new one.
+                */
+                virtual HashResult GetHash() override;
+
             private:
 
                 std::shared_ptr< Hash > m_hashImpl;
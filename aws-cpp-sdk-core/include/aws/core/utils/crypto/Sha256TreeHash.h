@@ -0,0 +1,95 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
+
+        namespace Crypto
+        {
+            /**
+             * Computes the SHA256 tree hash of an archive (see http://docs.aws.amazon.com/amazonglacier/latest/dev/checksum-calculations.html)
+             * out of the 1MB leaves of it, which can be added in any order and from several threads, e.g. as the parts of a multipart upload are read.
+             * The leaves of a part are hashed in parallel on the executor, if one is given. The tree hash of a part, and once all the leaves
+             * are in, of the whole archive, are then computed from the leaf hashes kept here, without hashing the data again.
+             */
+            class AWS_CORE_API Sha256TreeHash
+            {
+            public:
+                /**
+                 * Size of the leaves of the tree, the last leaf of an archive may be smaller.
+                 */
+                static const size_t LEAF_SIZE;
+
+                /**
+                 * executor, if not null the leaves of the data given to Update() are hashed in parallel on it, the calling thread hashing leaves as well.
+                 * Not owned, it must outlive this object.
+                 * parallelism, how many threads at most hash the leaves of one Update() call, including the calling one. 0 is the number of cpu cores.
+                 */
+                Sha256TreeHash(Aws::Utils::Threading::Executor* executor = nullptr, size_t parallelism = 0);
+
+                /**
+                 * Hashes the leaves of length bytes of data found at offset in the archive. offset must be a multiple of LEAF_SIZE, and so must length
+                 * unless the data ends the archive. Safe to call from several threads for different parts of the archive.
+                 * Returns false if offset isn't a leaf boundary or hashing failed.
+                 */
+                bool Update(uint64_t offset, const unsigned char* data, size_t length);
+
+                /**
+                 * Tree hash of the length bytes of the archive at offset, e.g. the checksum of an upload part, computed from the leaf hashes.
+                 * offset must be a multiple of LEAF_SIZE. Returns an empty buffer if a leaf of the range hasn't been added.
+                 */
+                ByteBuffer GetRangeHash(uint64_t offset, uint64_t length) const;
+
+                /**
+                 * Tree hash of the whole archive, the leaves added so far starting at offset 0. Returns an empty buffer if there is a gap among them.
+                 * The hash of an empty archive is the SHA256 of no data.
+                 */
+                ByteBuffer GetHash() const;
+
+                /**
+                 * Forgets the leaf hashes, to start over with another archive.
+                 */
+                void Reset();
+
+                /**
+                 * Combines consecutive leaf hashes, two by two, level by level, into their tree hash. leafHashes must not be empty.
+                 */
+                static ByteBuffer ComputeTreeHash(const Aws::Vector<ByteBuffer>& leafHashes, size_t begin, size_t end);
+
+            private:
+                Aws::Utils::Threading::Executor* m_executor;
+                size_t m_parallelism;
+                Aws::Vector<ByteBuffer> m_leafHashes;
+                mutable std::mutex m_leafHashesLock;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
@@ -78,6 +78,14 @@ namespace Aws
                  * Calculates a Hash on the stream without loading the entire stream into memory at once.
                  */
                 HashResult Calculate(Aws::IStream& stream);
+                /**
+                 * Adds bufferSize bytes of buffer to the hash being computed incrementally.
+                 */
+                void Update(const unsigned char* buffer, size_t bufferSize);
+                /**
+                 * Finishes the incremental hash and starts a new one.
+                 */
+                HashResult GetHash();
 
             private:
 
@@ -94,6 +102,11 @@ namespace Aws
                 DWORD m_hashObjectLength;
                 PBYTE m_hashObject;
 
+                //the incremental hash keeps its own handle and object so Calculate can still be used in between.
+                BCRYPT_HASH_HANDLE m_incrementalHashHandle;
+                PBYTE m_incrementalHashObject;
+                bool m_incrementalHashFailed;
+
                 //I'm 99% sure the algorithm handle for windows is not thread safe, but I can't 
                 //prove or disprove that theory. Therefore, we have to lock to be safe.
                 std::mutex m_algorithmMutex;
@@ -119,6 +132,14 @@ namespace Aws
                  * Calculates a md5 hash on the stream without loading the entire stream into memory at once.
                  */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+                /**
+                 * Adds bufferSize bytes of buffer to the md5 hash being computed incrementally.
+                 */
+                virtual void Update(const unsigned char* buffer, size_t bufferSize) override;
+                /**
+                 * Finishes the incremental md5 hash and starts a new one.
+                 */
+                virtual HashResult GetHash() override;
 
             private:
                 BCryptHashImpl m_impl;
@@ -144,6 +165,14 @@ namespace Aws
                  * Calculates a sha256 hash on the stream without loading the entire stream into memory at once.
                  */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+                /**
+                 * Adds bufferSize bytes of buffer to the sha256 hash being computed incrementally.
+                 */
+                virtual void Update(const unsigned char* buffer, size_t bufferSize) override;
+                /**
+                 * Finishes the incremental sha256 hash and starts a new one.
+                 */
+                virtual HashResult GetHash() override;
 
             private:
                 BCryptHashImpl m_impl;
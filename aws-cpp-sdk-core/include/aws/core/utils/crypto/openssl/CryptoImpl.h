@@ -69,28 +69,49 @@ namespace Aws
             {
             public:
 
-                MD5OpenSSLImpl()
-                { }
+                MD5OpenSSLImpl();
 
-                virtual ~MD5OpenSSLImpl() = default;
+                virtual ~MD5OpenSSLImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual void Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                MD5OpenSSLImpl(const MD5OpenSSLImpl&) = delete;
+                MD5OpenSSLImpl& operator=(const MD5OpenSSLImpl&) = delete;
+
+                // context of the incremental digest, started on the first Update after GetHash.
+                EVP_MD_CTX* m_ctx;
+                bool m_started;
             };
 
             class Sha256OpenSSLImpl : public Hash
             {
             public:
-                Sha256OpenSSLImpl()
-                { }
+                Sha256OpenSSLImpl();
 
-                virtual ~Sha256OpenSSLImpl() = default;
+                virtual ~Sha256OpenSSLImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                virtual void Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                Sha256OpenSSLImpl(const Sha256OpenSSLImpl&) = delete;
+                Sha256OpenSSLImpl& operator=(const Sha256OpenSSLImpl&) = delete;
+
+                // context of the incremental digest, started on the first Update after GetHash.
+                EVP_MD_CTX* m_ctx;
+                bool m_started;
             };
 
             class Sha256HMACOpenSSLImpl : public HMAC
@@ -0,0 +1,90 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Json
+        {
+            /**
+             * Bump allocator holding the nodes and strings of one JSON DOM. Memory is taken from blocks of growing size and is only
+             * given back all at once, when the arena is cleared or destroyed, so building a document costs a handful of allocations
+             * instead of several per node.
+             * Documents built from smaller ones take over the arenas of their parts (see Adopt()) rather than copying them.
+             */
+            class AWS_CORE_API JsonArena
+            {
+            public:
+                JsonArena();
+                ~JsonArena();
+
+                JsonArena(JsonArena&& other);
+                JsonArena& operator=(JsonArena&& other);
+
+                JsonArena(const JsonArena&) = delete;
+                JsonArena& operator=(const JsonArena&) = delete;
+
+                /**
+                 * Allocates size bytes, suitably aligned for a DOM node. The memory lives as long as the arena does.
+                 */
+                void* Allocate(size_t size);
+
+                /**
+                 * Copies length chars of str, followed by a null terminator, into the arena.
+                 */
+                char* CopyString(const char* str, size_t length);
+
+                /**
+                 * Takes over all the memory of other, which is left empty. Whatever was allocated from other stays valid and is now
+                 * freed along with this arena.
+                 */
+                void Adopt(JsonArena& other);
+
+                /**
+                 * Frees all the memory of the arena.
+                 */
+                void Clear();
+
+                /**
+                 * Total size of the blocks the arena holds.
+                 */
+                inline size_t GetCapacity() const { return m_capacity; }
+
+            private:
+                struct Block
+                {
+                    Block* next;
+                };
+
+                void* AllocateFromNewBlock(size_t size);
+
+                Block* m_blocks;
+                Block* m_lastBlock;
+                char* m_next;
+                char* m_end;
+                size_t m_nextBlockSize;
+                size_t m_capacity;
+            };
+
+        } // namespace Json
+    } // namespace Utils
+} // namespace Aws
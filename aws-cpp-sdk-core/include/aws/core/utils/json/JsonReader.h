@@ -0,0 +1,241 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Json
+        {
+            /**
+             * Kinds of tokens a JsonReader reads.
+             */
+            enum class JsonTokenType
+            {
+                NeedMoreInput,
+                StartObject,
+                EndObject,
+                StartArray,
+                EndArray,
+                MemberName,
+                String,
+                Number,
+                True,
+                False,
+                Null,
+                EndOfDocument,
+                Error
+            };
+
+            /**
+             * Pull parser reading a JSON document one token at a time, without building a DOM, so that it can be deserialized in a single pass
+             * straight into model objects. Either reads its input from a stream a chunk at a time, or is fed chunks of it as they come in,
+             * e.g. from the receive callback of an http client. Only the input of the token being read is kept in memory, plus whatever
+             * hasn't been read yet of the chunks fed to it.
+             *
+             * The Read* helpers are what deserializers use: they read the next value and convert it, a value of another type than the one
+             * asked for being skipped and read as the default of the type, the way JsonView getters treat missing values.
+             * Reading a document looks like:
+             *
+             *     if (reader.StartObject())
+             *     {
+             *         while (reader.NextMember())
+             *         {
+             *             if (reader.GetMemberName() == "Count") { count = reader.ReadInteger(); }
+             *             else { reader.SkipValue(); }
+             *         }
+             *     }
+             *
+             * When fed, the helpers only work once the whole document has been fed (EndOfInput() called). Before that, use Next() and
+             * Peek(), which return JsonTokenType::NeedMoreInput when the input fed so far ends in the middle of a token.
+             */
+            class AWS_CORE_API JsonReader
+            {
+            public:
+                /**
+                 * Size of the chunks read from the input stream at a time.
+                 */
+                static const size_t DEFAULT_CHUNK_SIZE;
+
+                /**
+                 * Constructs a reader to feed the document to.
+                 */
+                JsonReader();
+
+                /**
+                 * Constructs a reader reading the document from stream, chunkSize bytes at a time. The stream must outlive the reader.
+                 */
+                JsonReader(Aws::IStream& stream, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+                JsonReader(const JsonReader&) = delete;
+                JsonReader& operator=(const JsonReader&) = delete;
+
+                /**
+                 * Appends length bytes of the document, to be read after what has already been fed.
+                 */
+                void Feed(const char* data, size_t length);
+
+                /**
+                 * Tells the reader that the whole document has been fed.
+                 */
+                void EndOfInput();
+
+                /**
+                 * Reads the next token. Its text, if it has any, is then available from GetTokenText().
+                 * Returns JsonTokenType::EndOfDocument once the top level value has been read, and JsonTokenType::Error from then on
+                 * if the document is malformed.
+                 */
+                JsonTokenType Next();
+
+                /**
+                 * Reads the next token ahead without moving past it, the next call to Next() returns it.
+                 * Doesn't change the current token or its text.
+                 */
+                JsonTokenType Peek();
+
+                /**
+                 * Type of the current token, the one Next() last returned.
+                 */
+                inline JsonTokenType GetTokenType() const { return m_tokenType; }
+
+                /**
+                 * Text of the current token: the unescaped value of a string or member name, or the literal text of a number.
+                 */
+                inline const Aws::String& GetTokenText() const { return m_tokenText; }
+
+                /**
+                 * Name of the member NextMember() moved to.
+                 */
+                inline const Aws::String& GetMemberName() const { return m_tokenText; }
+
+                /**
+                 * Reads the start of an object. Returns false, having skipped the value, if the next value isn't an object.
+                 */
+                bool StartObject();
+
+                /**
+                 * Moves to the next member of the object being read, whose name is then in GetMemberName(), its value having to be read
+                 * (or skipped) before moving to the next one. Returns false at the end of the object.
+                 */
+                bool NextMember();
+
+                /**
+                 * Reads the start of an array. Returns false, having skipped the value, if the next value isn't an array.
+                 */
+                bool StartArray();
+
+                /**
+                 * Returns whether there is another element in the array being read, which then has to be read (or skipped).
+                 * Returns false, having read the end of the array, at the end of it.
+                 */
+                bool NextElement();
+
+                /**
+                 * Reads a string value. An empty string if the value is of another type.
+                 */
+                Aws::String ReadString();
+
+                /**
+                 * Reads a boolean value. false if the value is of another type.
+                 */
+                bool ReadBool();
+
+                /**
+                 * Reads a number value as an int. 0 if the value is of another type.
+                 */
+                int ReadInteger();
+
+                /**
+                 * Reads a number value as an int64_t. 0 if the value is of another type.
+                 */
+                int64_t ReadInt64();
+
+                /**
+                 * Reads a number value as a double. 0 if the value is of another type.
+                 */
+                double ReadDouble();
+
+                /**
+                 * Skips the next value, along with everything in it if it is an object or an array.
+                 */
+                void SkipValue();
+
+                /**
+                 * False once the document turned out to be malformed, or ended before its top level value did.
+                 */
+                inline bool WasParseSuccessful() const { return !m_failed; }
+
+                /**
+                 * What was wrong with the document, if WasParseSuccessful() is false.
+                 */
+                inline const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+                /**
+                 * Reads all the input that is left, starting from the token being read, e.g. to show where a malformed document went wrong.
+                 */
+                Aws::String ReadRemainingInput();
+
+            private:
+                enum class Expect
+                {
+                    Value,
+                    ValueOrEnd,
+                    MemberName,
+                    MemberNameOrEnd,
+                    Colon,
+                    CommaOrEnd,
+                    Done
+                };
+
+                JsonTokenType ReadToken(Aws::String& text);
+                JsonTokenType ReadStringToken(Aws::String& text, size_t& end);
+                JsonTokenType ReadNumberToken(Aws::String& text, size_t& end);
+                JsonTokenType ReadLiteralToken(const char* literal, size_t literalLength, JsonTokenType type, size_t& end);
+                bool Refill();
+                void Compact();
+                void AfterValue();
+                JsonTokenType Fail(const char* message);
+                void SkipRestOfValue(JsonTokenType firstToken);
+
+                Aws::IStream* m_stream;
+                size_t m_chunkSize;
+                bool m_inputEnded;
+                Aws::String m_buffer;
+                size_t m_position;
+                size_t m_discarded;
+                Aws::Vector<bool> m_containers;
+                Expect m_expect;
+                JsonTokenType m_tokenType;
+                Aws::String m_tokenText;
+                bool m_hasPeeked;
+                JsonTokenType m_peekedType;
+                Aws::String m_peekedText;
+                bool m_failed;
+                Aws::String m_errorMessage;
+            };
+
+        } // namespace Json
+    } // namespace Utils
+} // namespace Aws
@@ -21,6 +21,7 @@
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/json/JsonArena.h>
 #include <aws/core/external/cjson/cJSON.h>
 
 #include <utility>
@@ -32,9 +33,13 @@ namespace Aws
         namespace Json
         {
             class JsonView;
+            class JsonReader;
             /**
              * JSON DOM manipulation class.
              * To read or serialize use @ref View function.
+             * The nodes and strings of the DOM are allocated from an arena owned by the value. Values moved into another one
+             * hand their arena over to it instead of being copied, so documents are best built bottom-up out of rvalues.
+             * Members replaced by the With* functions keep their memory until the whole value is destroyed or reassigned.
              */
             class AWS_CORE_API JsonValue
             {
@@ -215,8 +220,11 @@ namespace Aws
 
             private:
                 void Destroy();
+                void Parse(JsonReader& reader, const char* errorMessagePrefix);
+                cJSON* NewObjectIfEmpty();
                 JsonValue(cJSON* value);
                 cJSON* m_value;
+                JsonArena m_arena;
                 bool m_wasParseSuccessful;
                 Aws::String m_errorMessage;
                 friend class JsonView;
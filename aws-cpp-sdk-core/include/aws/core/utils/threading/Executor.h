@@ -20,10 +20,13 @@
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/threading/Semaphore.h>
+#include <aws/core/utils/threading/ExecutorTask.h>
 #include <functional>
 #include <future>
 #include <mutex>
 #include <atomic>
+#include <thread>
+#include <condition_variable>
 
 namespace Aws
 {
@@ -43,13 +46,12 @@ namespace Aws
                 virtual ~Executor() = default;
 
                 /**
-                 * Send function and its arguments to the SubmitToThread function.
+                 * Send function and its arguments to the SubmitTask function.
                  */
                 template<class Fn, class ... Args>
                 bool Submit(Fn&& fn, Args&& ... args)
                 {
-                    std::function<void()> callable{ std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...) };
-                    return SubmitToThread(std::move(callable));
+                    return SubmitTask(ExecutorTask(std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...)));
                 }
 
             protected:
@@ -57,6 +59,12 @@ namespace Aws
                 * To implement your own executor implementation, then simply subclass Executor and implement this method.
                 */
                 virtual bool SubmitToThread(std::function<void()>&&) = 0;
+
+                /**
+                * Executors that can queue an ExecutorTask as it is override this, so the task is not wrapped in a std::function.
+                * By default the task is moved to the heap and handed to SubmitToThread.
+                */
+                virtual bool SubmitTask(ExecutorTask&& task);
             };
 
 
@@ -105,9 +113,10 @@ namespace Aws
 
             protected:
                 bool SubmitToThread(std::function<void()>&&) override;
+                bool SubmitTask(ExecutorTask&& task) override;
 
             private:
-                Aws::Queue<std::function<void()>*> m_tasks;
+                Aws::Queue<ExecutorTask*> m_tasks;
                 std::mutex m_queueLock;
                 Aws::Utils::Threading::Semaphore m_sync;
                 Aws::Vector<ThreadTask*> m_threadTaskHandles;
@@ -117,12 +126,69 @@ namespace Aws
                 /**
                  * Once you call this, you are responsible for freeing the memory pointed to by task.
                  */
-                std::function<void()>* PopTask();
+                ExecutorTask* PopTask();
                 bool HasTasks();
 
                 friend class ThreadTask;
             };
 
+            /**
+            * Thread pool executor where every thread has its own queue of tasks. Tasks submitted from one of the pool's threads, such as async calls
+            * made from a completion handler, go to that thread's queue and are taken newest first. Tasks submitted from other threads are spread over
+            * the queues in turn. A thread that runs out of work takes the oldest tasks from the other queues.
+            * Submitting or taking a task only locks the queue involved, so threads do not contend on a single queue the way they do in
+            * PooledThreadExecutor, and tasks are kept in the queues by value instead of being allocated one by one.
+            * Like PooledThreadExecutor, tasks that are still queued when the executor is destroyed are dropped without running.
+            */
+            class AWS_CORE_API WorkStealingThreadExecutor : public Executor
+            {
+            public:
+                /**
+                * If pinThreadsToCores is true, thread i of the pool only runs on core i modulo the number of cores.
+                * Only supported on Linux and Android, ignored elsewhere.
+                */
+                WorkStealingThreadExecutor(size_t poolSize, bool pinThreadsToCores = false);
+                ~WorkStealingThreadExecutor();
+
+                /**
+                * Rule of 5 stuff.
+                * Don't copy or move
+                */
+                WorkStealingThreadExecutor(const WorkStealingThreadExecutor&) = delete;
+                WorkStealingThreadExecutor& operator =(const WorkStealingThreadExecutor&) = delete;
+                WorkStealingThreadExecutor(WorkStealingThreadExecutor&&) = delete;
+                WorkStealingThreadExecutor& operator =(WorkStealingThreadExecutor&&) = delete;
+
+            protected:
+                bool SubmitToThread(std::function<void()>&&) override;
+                bool SubmitTask(ExecutorTask&& task) override;
+
+            private:
+                class WorkQueue;
+
+                void RunWorker(size_t index, bool pinToCore);
+                /**
+                * Takes the newest task of the queue of thread index, or else the oldest task of another queue.
+                */
+                bool TakeTask(size_t index, ExecutorTask& task);
+                /**
+                * Index of the calling thread in the pool, or the pool size if it is not one of the pool's threads.
+                */
+                size_t CurrentThreadIndex() const;
+
+                Aws::Vector<WorkQueue*> m_queues;
+                Aws::Vector<std::thread> m_threads;
+                // filled in once all threads are started and never changed after that, so it is read without locking.
+                Aws::UnorderedMap<std::thread::id, size_t> m_threadIndices;
+                size_t m_poolSize;
+                std::atomic<size_t> m_nextQueue;
+                std::atomic<size_t> m_queuedTasks;
+                std::atomic<size_t> m_idleThreads;
+                std::atomic<bool> m_continue;
+                std::mutex m_idleLock;
+                std::condition_variable m_idleSignal;
+            };
+
 
         } // namespace Threading
     } // namespace Utils
@@ -0,0 +1,158 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+            * Move only task submitted to an Executor. Callables of up to INLINE_SIZE bytes are kept inside the task,
+            * larger ones are allocated once. std::function only keeps callables of two pointers or so in place, which leaves out
+            * nearly every bound call an Executor is given.
+            */
+            class ExecutorTask
+            {
+                static const char* ALLOCATION_TAG() { return "ExecutorTask"; }
+
+            public:
+                static const size_t INLINE_SIZE = 64;
+
+                ExecutorTask() : m_ops(nullptr) {}
+
+                template<class Fn, class = typename std::enable_if<!std::is_same<typename std::decay<Fn>::type, ExecutorTask>::value>::type>
+                ExecutorTask(Fn&& fn) : m_ops(nullptr)
+                {
+                    typedef typename std::decay<Fn>::type Callable;
+                    Store<Callable>(std::forward<Fn>(fn), std::integral_constant<bool, FitsInline<Callable>::value>());
+                }
+
+                ExecutorTask(ExecutorTask&& other) : m_ops(other.m_ops)
+                {
+                    if (m_ops)
+                    {
+                        m_ops->move(&m_storage, &other.m_storage);
+                        other.m_ops = nullptr;
+                    }
+                }
+
+                ExecutorTask& operator=(ExecutorTask&& other)
+                {
+                    if (this != &other)
+                    {
+                        Reset();
+                        if (other.m_ops)
+                        {
+                            other.m_ops->move(&m_storage, &other.m_storage);
+                            m_ops = other.m_ops;
+                            other.m_ops = nullptr;
+                        }
+                    }
+                    return *this;
+                }
+
+                ExecutorTask(const ExecutorTask&) = delete;
+                ExecutorTask& operator=(const ExecutorTask&) = delete;
+
+                ~ExecutorTask() { Reset(); }
+
+                void operator()() { m_ops->invoke(&m_storage); }
+
+                explicit operator bool() const { return m_ops != nullptr; }
+
+                /**
+                * Whether a callable of type Fn is kept inside the task rather than allocated.
+                */
+                template<class Fn>
+                struct FitsInline : std::integral_constant<bool, sizeof(Fn) <= INLINE_SIZE &&
+                    alignof(Fn) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible<Fn>::value> {};
+
+            private:
+                struct Ops
+                {
+                    void (*invoke)(void* storage);
+                    // moves the callable from src into the empty dst and destroys what is left in src.
+                    void (*move)(void* dst, void* src);
+                    void (*destroy)(void* storage);
+                };
+
+                template<class Fn>
+                struct InlineOps
+                {
+                    static void Invoke(void* storage) { (*static_cast<Fn*>(storage))(); }
+                    static void Move(void* dst, void* src)
+                    {
+                        new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+                        static_cast<Fn*>(src)->~Fn();
+                    }
+                    static void Destroy(void* storage) { static_cast<Fn*>(storage)->~Fn(); }
+                    static const Ops* Get()
+                    {
+                        static const Ops ops = { &Invoke, &Move, &Destroy };
+                        return &ops;
+                    }
+                };
+
+                template<class Fn>
+                struct HeapOps
+                {
+                    static void Invoke(void* storage) { (**static_cast<Fn**>(storage))(); }
+                    static void Move(void* dst, void* src) { *static_cast<Fn**>(dst) = *static_cast<Fn**>(src); }
+                    static void Destroy(void* storage) { Aws::Delete(*static_cast<Fn**>(storage)); }
+                    static const Ops* Get()
+                    {
+                        static const Ops ops = { &Invoke, &Move, &Destroy };
+                        return &ops;
+                    }
+                };
+
+                template<class Callable, class Fn>
+                void Store(Fn&& fn, std::true_type)
+                {
+                    new (&m_storage) Callable(std::forward<Fn>(fn));
+                    m_ops = InlineOps<Callable>::Get();
+                }
+
+                template<class Callable, class Fn>
+                void Store(Fn&& fn, std::false_type)
+                {
+                    *reinterpret_cast<Callable**>(&m_storage) = Aws::New<Callable>(ALLOCATION_TAG(), std::forward<Fn>(fn));
+                    m_ops = HeapOps<Callable>::Get();
+                }
+
+                void Reset()
+                {
+                    if (m_ops)
+                    {
+                        m_ops->destroy(&m_storage);
+                        m_ops = nullptr;
+                    }
+                }
+
+                const Ops* m_ops;
+                typename std::aligned_storage<INLINE_SIZE, alignof(std::max_align_t)>::type m_storage;
+            };
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
@@ -0,0 +1,226 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstddef>
+#include <cstring>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Xml
+        {
+            /**
+             * Kinds of tokens an XmlReader reads. The XML declaration, processing instructions, comments and the document type
+             * declaration are skipped.
+             */
+            enum class XmlTokenType
+            {
+                NeedMoreInput,
+                StartElement,
+                EndElement,
+                Text,
+                EndOfDocument,
+                Error
+            };
+
+            /**
+             * Pull parser reading an XML document one token at a time, without building a DOM, so that large responses can be deserialized
+             * in a single pass straight into model objects. Either reads its input from a stream a chunk at a time, or is fed chunks of it
+             * as they come in. Only the input of the token being read is kept in memory, plus whatever hasn't been read yet of the chunks
+             * fed to it.
+             *
+             * Names and text are handed out as views into the reader's buffer (GetName()/GetNameLength(), GetText()/GetTextLength()),
+             * which stay valid until the next token is read. Text is raw: entity references aren't resolved.
+             *
+             * The StartRootElement()/NextChild()/ReadText()/SkipElement() helpers are what deserializers use. Reading a document looks like:
+             *
+             *     if (reader.StartRootElement())
+             *     {
+             *         while (reader.NextChild())
+             *         {
+             *             if (reader.IsName("KeyCount")) { keyCount = StringUtils::ConvertToInt32(reader.ReadTrimmedText().c_str()); }
+             *             else { reader.SkipElement(); }
+             *         }
+             *     }
+             *
+             * When fed, the helpers only work once the whole document has been fed (EndOfInput() called). Before that, use Next(),
+             * which returns XmlTokenType::NeedMoreInput when the input fed so far ends in the middle of a token.
+             */
+            class AWS_CORE_API XmlReader
+            {
+            public:
+                /**
+                 * Size of the chunks read from the input stream at a time.
+                 */
+                static const size_t DEFAULT_CHUNK_SIZE;
+
+                /**
+                 * Constructs a reader to feed the document to.
+                 */
+                XmlReader();
+
+                /**
+                 * Constructs a reader reading the document from stream, chunkSize bytes at a time. The stream must outlive the reader.
+                 */
+                XmlReader(Aws::IStream& stream, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+                XmlReader(const XmlReader&) = delete;
+                XmlReader& operator=(const XmlReader&) = delete;
+
+                /**
+                 * Appends length bytes of the document, to be read after what has already been fed.
+                 */
+                void Feed(const char* data, size_t length);
+
+                /**
+                 * Tells the reader that the whole document has been fed.
+                 */
+                void EndOfInput();
+
+                /**
+                 * Reads the next token. An empty element (<a/>) is read as a StartElement followed by an EndElement. Text only made of
+                 * whitespace is skipped, the way XmlDocument drops it.
+                 * Returns XmlTokenType::EndOfDocument once the root element has been read, and XmlTokenType::Error from then on
+                 * if the document is malformed.
+                 */
+                XmlTokenType Next();
+
+                /**
+                 * Type of the current token, the one Next() last returned.
+                 */
+                inline XmlTokenType GetTokenType() const { return m_tokenType; }
+
+                /**
+                 * Name of the element the current StartElement or EndElement token opens or closes. Not null terminated.
+                 */
+                inline const char* GetName() const { return m_buffer.data() + m_tokenStart; }
+
+                inline size_t GetNameLength() const { return m_tokenLength; }
+
+                /**
+                 * Whether the current StartElement or EndElement token is for an element called name.
+                 */
+                inline bool IsName(const char* name) const
+                {
+                    return strlen(name) == m_tokenLength && memcmp(name, GetName(), m_tokenLength) == 0;
+                }
+
+                /**
+                 * Raw text of the current Text token, as it is in the document. Not null terminated.
+                 */
+                inline const char* GetText() const { return m_buffer.data() + m_tokenStart; }
+
+                inline size_t GetTextLength() const { return m_tokenLength; }
+
+                /**
+                 * Whether the current Text token is a CDATA section, GetText() being its content then.
+                 */
+                inline bool IsCData() const { return m_isCData; }
+
+                /**
+                 * Depth of the current token, 1 being the root element. A StartElement token is counted in the depth, an EndElement isn't.
+                 */
+                inline size_t GetDepth() const { return m_openElementLengths.size(); }
+
+                /**
+                 * Looks up attribute name of the element the current StartElement token opens. Returns false if the element doesn't
+                 * have it, otherwise sets value to its value, entity references resolved.
+                 */
+                bool GetAttributeValue(const char* name, Aws::String& value) const;
+
+                /**
+                 * Reads the start of the root element. Returns false if the document has none.
+                 */
+                bool StartRootElement();
+
+                /**
+                 * Moves to the next child element of the element being read, whose name is then checked with IsName(), its content having
+                 * to be read (or skipped) before moving to the next one. Text in between children is skipped. Returns false, having read
+                 * the end of the element, when it has no more children.
+                 */
+                bool NextChild();
+
+                /**
+                 * Reads the content of the element NextChild() moved to, up to and including its end. Returns its text the way
+                 * XmlNode::GetText() does, so that deserializers read the same values from either: entity references are resolved,
+                 * then &, < and > are escaped again, new lines are normalized and CDATA sections keep their markers.
+                 * Child elements, which XmlNode::GetText() would print, are skipped.
+                 */
+                Aws::String ReadText();
+
+                /**
+                 * ReadText() with leading and trailing whitespace removed, like StringUtils::Trim().
+                 */
+                Aws::String ReadTrimmedText();
+
+                /**
+                 * Skips the content of the element NextChild() moved to, up to and including its end.
+                 */
+                void SkipElement();
+
+                /**
+                 * False once the document turned out to be malformed, or ended before its root element did.
+                 */
+                inline bool WasParseSuccessful() const { return !m_failed; }
+
+                /**
+                 * What was wrong with the document, if WasParseSuccessful() is false.
+                 */
+                inline const Aws::String& GetErrorMessage() const { return m_errorMessage; }
+
+            private:
+                XmlTokenType ReadToken();
+                XmlTokenType ReadTextToken(size_t& end);
+                XmlTokenType ReadStartElementToken(size_t& end);
+                XmlTokenType ReadEndElementToken(size_t& end);
+                XmlTokenType ReadCDataToken(size_t& end);
+                void PopOpenElement();
+                bool Refill();
+                void Compact();
+                XmlTokenType Fail(const char* message);
+
+                Aws::IStream* m_stream;
+                size_t m_chunkSize;
+                bool m_inputEnded;
+                Aws::String m_buffer;
+                size_t m_position;
+                size_t m_discarded;
+                XmlTokenType m_tokenType;
+                size_t m_tokenStart;
+                size_t m_tokenLength;
+                size_t m_attributesStart;
+                size_t m_attributesLength;
+                bool m_isCData;
+                bool m_pendingEndElement;
+                bool m_rootElementRead;
+                // names of the elements being read, back to back, so that end tags can be matched without an allocation per element.
+                Aws::String m_openElementNames;
+                Aws::Vector<size_t> m_openElementLengths;
+                bool m_failed;
+                Aws::String m_errorMessage;
+            };
+
+        } // namespace Xml
+    } // namespace Utils
+} // namespace Aws
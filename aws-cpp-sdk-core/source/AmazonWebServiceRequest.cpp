@@ -21,7 +21,9 @@ using namespace Aws;
 AmazonWebServiceRequest::AmazonWebServiceRequest() :
     m_responseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod),
     m_onDataReceived(nullptr),
-    m_onDataSent(nullptr)
+    m_onDataSent(nullptr),
+    m_hedgingEnabled(false),
+    m_deadlineMs(0)
 {
 }
 
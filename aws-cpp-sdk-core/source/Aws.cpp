@@ -18,6 +18,7 @@
 #include <aws/core/utils/logging/AWSLogging.h>
 #include <aws/core/utils/logging/DefaultLogSystem.h>
 #include <aws/core/Globals.h>
+#include <aws/core/auth/CredentialsRefreshScheduler.h>
 #include <aws/core/external/cjson/cJSON.h>
 #include <aws/core/monitoring/MonitoringManager.h>
 #include <aws/core/net/Net.h>
@@ -102,6 +103,7 @@ namespace Aws
         Aws::Http::SetInstallSigPipeHandlerFlag(options.httpOptions.installSigPipeHandler);
         Aws::Http::InitHttp();
         Aws::InitializeEnumOverflowContainer();
+        Aws::Auth::InitCredentialsRefreshSchedulers();
         cJSON_Hooks hooks;
         hooks.malloc_fn = [](size_t sz) { return Aws::Malloc("cJSON_Tag", sz); };
         hooks.free_fn = Aws::Free;
@@ -114,6 +116,7 @@ namespace Aws
     {
         Aws::Monitoring::CleanupMonitoring();
         Aws::Net::CleanupNetwork();
+        Aws::Auth::CleanupCredentialsRefreshSchedulers();
         Aws::CleanupEnumOverflowContainer();
         Aws::Http::CleanupHttp();
         Aws::Utils::Crypto::CleanupCrypto();
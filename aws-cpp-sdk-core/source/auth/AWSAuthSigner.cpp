@@ -15,6 +15,7 @@
 
 #include <aws/core/auth/AWSAuthSigner.h>
 
+#include <aws/core/auth/AWSChunkedPayloadSigner.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/http/HttpRequest.h>
@@ -28,6 +29,7 @@
 #include <aws/core/utils/crypto/Sha256.h>
 #include <aws/core/utils/crypto/Sha256HMAC.h>
 
+#include <cctype>
 #include <cstdio>
 #include <iomanip>
 #include <math.h>
@@ -51,12 +53,20 @@ static const char* X_AMZ_SIGNED_HEADERS = "X-Amz-SignedHeaders";
 static const char* X_AMZ_ALGORITHM = "X-Amz-Algorithm";
 static const char* X_AMZ_CREDENTIAL = "X-Amz-Credential";
 static const char* UNSIGNED_PAYLOAD = "UNSIGNED-PAYLOAD";
+static const char* STREAMING_PAYLOAD = "STREAMING-AWS4-HMAC-SHA256-PAYLOAD";
+static const char* X_AMZ_CONTENT_SHA256 = "x-amz-content-sha256";
+static const char* X_AMZ_DECODED_CONTENT_LENGTH = "x-amz-decoded-content-length";
+static const char* CONTENT_ENCODING = "content-encoding";
+static const char* AWS_CHUNKED = "aws-chunked";
 static const char* X_AMZ_SIGNATURE = "X-Amz-Signature";
 static const char* SIGNING_KEY = "AWS4";
 static const char* LONG_DATE_FORMAT_STR = "%Y%m%dT%H%M%SZ";
 static const char* SIMPLE_DATE_FORMAT_STR = "%Y%m%d";
 static const char* EMPTY_STRING_SHA256 = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
 
+static const size_t CANONICAL_REQUEST_RESERVE = 512;
+static const size_t AUTHORIZATION_RESERVE = 128;
+
 static const char* v4LogTag = "AWSAuthV4Signer";
 
 namespace Aws
@@ -68,45 +78,40 @@ namespace Aws
     }
 }
 
-static Aws::String CanonicalizeRequestSigningString(HttpRequest& request, bool urlEscapePath)
+//appends the method, path and query string lines of the canonical request to canonicalRequest.
+static void AppendCanonicalRequestSigningString(Aws::String& canonicalRequest, HttpRequest& request, bool urlEscapePath)
 {
     request.CanonicalizeRequest();
-    Aws::StringStream signingStringStream;
-    signingStringStream << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod());
+    canonicalRequest.append(HttpMethodMapper::GetNameForHttpMethod(request.GetMethod()));
+    canonicalRequest.append(NEWLINE);
 
-    URI uriCpy = request.GetUri();
     // Many AWS services do not decode the URL before calculating SignatureV4 on their end.
     // This results in the signature getting calculated with a double encoded URL.
     // That means we have to double encode it here for the signature to match on the service side.
     if(urlEscapePath)
     {
         // RFC3986 is how we encode the URL before sending it on the wire.
-        auto rfc3986EncodedPath = URI::URLEncodePathRFC3986(uriCpy.GetPath());
-        uriCpy.SetPath(rfc3986EncodedPath);
-        // However, SignatureV4 uses this URL encoding scheme
-        signingStringStream << NEWLINE << uriCpy.GetURLEncodedPath() << NEWLINE;
+        // However, SignatureV4 uses the URL encoding scheme of URI::URLEncodePath on top of it.
+        canonicalRequest.append(URI::URLEncodePath(URI::URLEncodePathRFC3986(request.GetUri().GetPath())));
     }
     else
     {
         // For the services that DO decode the URL first; we don't need to double encode it.
-        uriCpy.SetPath(uriCpy.GetURLEncodedPath());
-        signingStringStream << NEWLINE << uriCpy.GetPath() << NEWLINE;
+        canonicalRequest.append(request.GetUri().GetURLEncodedPath());
     }
+    canonicalRequest.append(NEWLINE);
 
-    if (request.GetQueryString().find('=') != std::string::npos)
-    {
-        signingStringStream << request.GetQueryString().substr(1) << NEWLINE;
-    }
-    else if (request.GetQueryString().size() > 1)
+    const Aws::String& queryString = request.GetQueryString();
+    if (queryString.find('=') != std::string::npos)
     {
-        signingStringStream << request.GetQueryString().substr(1) << "=" << NEWLINE;
+        canonicalRequest.append(queryString, 1, Aws::String::npos);
     }
-    else
+    else if (queryString.size() > 1)
     {
-        signingStringStream << NEWLINE;
+        canonicalRequest.append(queryString, 1, Aws::String::npos);
+        canonicalRequest.append(EQ);
     }
-
-    return signingStringStream.str();
+    canonicalRequest.append(NEWLINE);
 }
 
 static Http::HeaderValueCollection CanonicalizeHeaders(Http::HeaderValueCollection&& headers)
@@ -143,6 +148,74 @@ static Http::HeaderValueCollection CanonicalizeHeaders(Http::HeaderValueCollecti
     return canonicalHeaders;
 }
 
+//true if the header would be changed by CanonicalizeHeaders: surrounding whitespace, several lines or runs of spaces.
+static bool NeedsCanonicalization(const Aws::String& headerName, const Aws::String& headerValue)
+{
+    if (headerName.empty() || ::isspace(static_cast<unsigned char>(headerName.front())) || ::isspace(static_cast<unsigned char>(headerName.back())))
+    {
+        return true;
+    }
+    if (!headerValue.empty() && (::isspace(static_cast<unsigned char>(headerValue.front())) || ::isspace(static_cast<unsigned char>(headerValue.back()))))
+    {
+        return true;
+    }
+    return headerValue.find('\n') != Aws::String::npos || headerValue.find("  ") != Aws::String::npos;
+}
+
+static bool IsUnsignedHeader(const Aws::Set<Aws::String>& unsignedHeaders, const Aws::String& headerName)
+{
+    // the headers of StandardHttpRequest are already lower case, don't copy them just to look them up.
+    for (char c : headerName)
+    {
+        if (::isupper(static_cast<unsigned char>(c)))
+        {
+            return unsignedHeaders.find(StringUtils::ToLower(headerName.c_str())) != unsignedHeaders.cend();
+        }
+    }
+    return unsignedHeaders.find(headerName) != unsignedHeaders.cend();
+}
+
+//appends the "name:value\n" lines of the signed headers to canonicalHeaders and their names, separated by ';', to signedHeaders.
+static void AppendCanonicalHeaders(Http::HeaderValueCollection&& headers, const Aws::Set<Aws::String>& unsignedHeaders,
+        Aws::String& canonicalHeaders, Aws::String& signedHeaders)
+{
+    bool needsCanonicalization = false;
+    for (const auto& header : headers)
+    {
+        if (NeedsCanonicalization(header.first, header.second))
+        {
+            needsCanonicalization = true;
+            break;
+        }
+    }
+    if (needsCanonicalization)
+    {
+        headers = CanonicalizeHeaders(std::move(headers));
+    }
+
+    bool firstSignedHeader = true;
+    for (const auto& header : headers)
+    {
+        if (!IsUnsignedHeader(unsignedHeaders, header.first))
+        {
+            canonicalHeaders.append(header.first).append(":").append(header.second).append(NEWLINE);
+            if (!firstSignedHeader)
+            {
+                signedHeaders.append(";");
+            }
+            signedHeaders.append(header.first);
+            firstSignedHeader = false;
+        }
+    }
+}
+
+struct AWSAuthV4Signer::SigningKeyCacheEntry
+{
+    Aws::String secretKey;
+    Aws::String simpleDate;
+    ByteBuffer signingKey;
+};
+
 AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider,
     const char* serviceName, const Aws::String& region, PayloadSigningPolicy signingPolicy, bool urlEscapePath) :
     m_includeSha256HashHeader(true),
@@ -167,7 +240,7 @@ AWSAuthV4Signer::~AWSAuthV4Signer()
 
 bool AWSAuthV4Signer::ShouldSignHeader(const Aws::String& header) const
 {
-    return m_unsignedHeaders.find(Aws::Utils::StringUtils::ToLower(header.c_str())) == m_unsignedHeaders.cend();
+    return !IsUnsignedHeader(m_unsignedHeaders, header);
 }
 
 bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
@@ -194,6 +267,7 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, bool signBody
     switch(m_payloadSigningPolicy)
     {
         case PayloadSigningPolicy::Always:
+        case PayloadSigningPolicy::Streaming:
             signBody = true;
             break;
         case PayloadSigningPolicy::Never:
@@ -205,7 +279,34 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, bool signBody
             break;
     }
 
-    if(signBody || request.GetUri().GetScheme() != Http::Scheme::HTTPS)
+    //the body is hashed while it is sent, this only needs its length. Http clients that would send the body as is get it signed up front.
+    bool streamPayload = m_payloadSigningPolicy == PayloadSigningPolicy::Streaming && request.GetContentBody() &&
+        request.IsChunkedPayloadSigningSupported() &&
+        (request.HasHeader(X_AMZ_DECODED_CONTENT_LENGTH) || request.HasHeader(Http::CONTENT_LENGTH_HEADER));
+    uint64_t payloadLength = 0;
+
+    if (streamPayload)
+    {
+        if (!request.HasHeader(X_AMZ_DECODED_CONTENT_LENGTH))
+        {
+            request.SetHeaderValue(X_AMZ_DECODED_CONTENT_LENGTH, request.GetContentLength());
+        }
+        payloadLength = static_cast<uint64_t>(StringUtils::ConvertToInt64(request.GetHeaderValue(X_AMZ_DECODED_CONTENT_LENGTH).c_str()));
+        request.SetContentLength(StringUtils::to_string(AWSChunkedPayloadSigner::ComputeEncodedLength(payloadLength)));
+
+        //aws-chunked goes first, S3 stores any other encoding as the object's content-encoding.
+        Aws::String contentEncoding(AWS_CHUNKED);
+        if (request.HasHeader(CONTENT_ENCODING))
+        {
+            const Aws::String& requestEncoding = request.GetHeaderValue(CONTENT_ENCODING);
+            contentEncoding = requestEncoding.find(AWS_CHUNKED) == 0 ? requestEncoding : contentEncoding + "," + requestEncoding;
+        }
+        request.SetHeaderValue(CONTENT_ENCODING, contentEncoding);
+        request.SetHeaderValue(X_AMZ_CONTENT_SHA256, STREAMING_PAYLOAD);
+        payloadHash.assign(STREAMING_PAYLOAD);
+        AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing payload of " << payloadLength << " bytes in chunks while it is sent.");
+    }
+    else if(signBody || request.GetUri().GetScheme() != Http::Scheme::HTTPS)
     {
         payloadHash.assign(ComputePayloadHash(request));
         if (payloadHash.empty())
@@ -221,7 +322,7 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, bool signBody
 
     if(m_includeSha256HashHeader)
     {
-        request.SetHeaderValue("x-amz-content-sha256", payloadHash);
+        request.SetHeaderValue(X_AMZ_CONTENT_SHA256, payloadHash);
     }
 
     //calculate date header to use in internal signature (this also goes into date header).
@@ -229,36 +330,14 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, bool signBody
     Aws::String dateHeaderValue = now.ToGmtString(LONG_DATE_FORMAT_STR);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
-    {
-        if(ShouldSignHeader(header.first))
-        {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
-        }
-    }
-
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
-
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
-    if (!signedHeadersValue.empty())
-    {
-        signedHeadersValue.pop_back();   
-    }
-
+    //build the canonical request in one string: method, path, query string, headers, signed headers and payload hash.
+    Aws::String canonicalRequestString;
+    Aws::String signedHeadersValue;
+    canonicalRequestString.reserve(CANONICAL_REQUEST_RESERVE);
+    AppendCanonicalRequestSigningString(canonicalRequestString, request, m_urlEscapePath);
+    AppendCanonicalHeaders(request.GetHeaders(), m_unsignedHeaders, canonicalRequestString, signedHeadersValue);
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
 
-    //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath);
-
-    //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
     canonicalRequestString.append(NEWLINE);
     canonicalRequestString.append(signedHeadersValue);
     canonicalRequestString.append(NEWLINE);
@@ -275,22 +354,37 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, bool signBody
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    Aws::String cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
+    Aws::String cannonicalRequestHash = HashingUtils::HexEncode(hashResult.GetResult());
     Aws::String simpleDate = now.ToGmtString(SIMPLE_DATE_FORMAT_STR);
+    Aws::String credentialScope = GenerateCredentialScope(simpleDate, m_region, m_serviceName);
 
-    Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, cannonicalRequestHash, m_region,
-            m_serviceName);
+    Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, credentialScope, cannonicalRequestHash);
     auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate);
 
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << m_region << "/" << m_serviceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << finalSignature;
+    Aws::String awsAuthString(AWS_HMAC_SHA256);
+    awsAuthString.reserve(AUTHORIZATION_RESERVE + credentialScope.size() + signedHeadersValue.size());
+    awsAuthString.append(" ").append(CREDENTIAL).append(EQ).append(credentials.GetAWSAccessKeyId()).append("/").append(credentialScope)
+        .append(", ").append(SIGNED_HEADERS).append(EQ).append(signedHeadersValue)
+        .append(", ").append(SIGNATURE).append(EQ).append(finalSignature);
 
-    auto awsAuthString = ss.str();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing request with: " << awsAuthString);
     request.SetAwsAuthorization(awsAuthString);
+
+    if (streamPayload)
+    {
+        if (finalSignature.empty())
+        {
+            return false;
+        }
+
+        request.SetChunkedPayloadSigner(Aws::MakeShared<AWSChunkedPayloadSigner>(v4LogTag, ComputeHash(credentials.GetAWSSecretKey(), simpleDate),
+                dateHeaderValue, credentialScope, finalSignature, payloadLength));
+    }
+    else
+    {
+        request.SetChunkedPayloadSigner(nullptr);
+    }
+
     request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
     request.SetSigningRegion(m_region);
     return true;
@@ -330,45 +424,28 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char
     Aws::String dateQueryValue = now.ToGmtString(LONG_DATE_FORMAT_STR);
     request.AddQueryStringParameter(Http::AWS_DATE_HEADER, dateQueryValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
-    {
-        if(ShouldSignHeader(header.first))
-        {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
-        }
-    }
-
-    Aws::String canonicalHeadersString = headersStream.str();
+    //the signed headers go into the query string, which is part of the canonical request, so they are canonicalized first.
+    Aws::String canonicalHeadersString;
+    Aws::String signedHeadersValue;
+    AppendCanonicalHeaders(request.GetHeaders(), m_unsignedHeaders, canonicalHeadersString, signedHeadersValue);
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
 
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue(signedHeadersStream.str());
-    //remove that last semi-colon
-    if (!signedHeadersValue.empty())
-    {
-        signedHeadersValue.pop_back();
-    }
-
     request.AddQueryStringParameter(X_AMZ_SIGNED_HEADERS, signedHeadersValue);
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value: " << signedHeadersValue);
 
-    Aws::StringStream ss;
     Aws::String simpleDate = now.ToGmtString(SIMPLE_DATE_FORMAT_STR);
-    ss << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << region << "/" << serviceName << "/" << AWS4_REQUEST;
+    Aws::String credentialScope = GenerateCredentialScope(simpleDate, region, serviceName);
 
     request.AddQueryStringParameter(X_AMZ_ALGORITHM, AWS_HMAC_SHA256);
-    request.AddQueryStringParameter(X_AMZ_CREDENTIAL, ss.str());
-    ss.str("");
+    request.AddQueryStringParameter(X_AMZ_CREDENTIAL, credentials.GetAWSAccessKeyId() + "/" + credentialScope);
 
     request.SetSigningAccessKey(credentials.GetAWSAccessKeyId());
     request.SetSigningRegion(region);
 
     //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request, m_urlEscapePath);
+    Aws::String canonicalRequestString;
+    canonicalRequestString.reserve(CANONICAL_REQUEST_RESERVE + canonicalHeadersString.size());
+    AppendCanonicalRequestSigningString(canonicalRequestString, request, m_urlEscapePath);
 
     //append v4 stuff to the canonical request string.
     canonicalRequestString.append(canonicalHeadersString);
@@ -391,10 +468,9 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char
         return false;
     }
 
-    auto sha256Digest = hashResult.GetResult();
-    auto cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
+    auto cannonicalRequestHash = HashingUtils::HexEncode(hashResult.GetResult());
 
-    auto stringToSign = GenerateStringToSign(dateQueryValue, simpleDate, cannonicalRequestHash, region, serviceName);
+    auto stringToSign = GenerateStringToSign(dateQueryValue, credentialScope, cannonicalRequestHash);
 
     auto finalSigningHash = GenerateSignature(credentials, stringToSign, simpleDate, region, serviceName);
     if (finalSigningHash.empty())
@@ -437,8 +513,6 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const Aws::String& stringToSign,
 {
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Final String to sign: " << stringToSign);
 
-    Aws::StringStream ss;
-
     auto hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), key);
     if (!hashResult.IsSuccess())
     {
@@ -448,9 +522,7 @@ Aws::String AWSAuthV4Signer::GenerateSignature(const Aws::String& stringToSign,
     }
 
     //now we finally sign our request string with our hex encoded derived hash.
-    auto finalSigningDigest = hashResult.GetResult();
-
-    auto finalSigningHash = HashingUtils::HexEncode(finalSigningDigest);
+    auto finalSigningHash = HashingUtils::HexEncode(hashResult.GetResult());
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Final computed signing hash: " << finalSigningHash);
 
     return finalSigningHash;
@@ -486,33 +558,42 @@ Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request)
     return payloadHash;
 }
 
-Aws::String AWSAuthV4Signer::GenerateStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate,
-        const Aws::String& canonicalRequestHash, const Aws::String& region, const Aws::String& serviceName) const
+Aws::String AWSAuthV4Signer::GenerateCredentialScope(const Aws::String& simpleDate, const Aws::String& region, const Aws::String& serviceName) const
 {
-    //generate the actual string we will use in signing the final request.
-    Aws::StringStream ss;
-
-    ss << AWS_HMAC_SHA256 << NEWLINE << dateValue << NEWLINE << simpleDate << "/" << region << "/"
-        << serviceName << "/" << AWS4_REQUEST << NEWLINE << canonicalRequestHash;
+    Aws::String credentialScope;
+    credentialScope.reserve(simpleDate.size() + region.size() + serviceName.size() + strlen(AWS4_REQUEST) + 3);
+    credentialScope.append(simpleDate).append("/").append(region).append("/").append(serviceName).append("/").append(AWS4_REQUEST);
+    return credentialScope;
+}
 
-    return ss.str();
+Aws::String AWSAuthV4Signer::GenerateStringToSign(const Aws::String& dateValue, const Aws::String& credentialScope,
+        const Aws::String& canonicalRequestHash) const
+{
+    //generate the actual string we will use in signing the final request.
+    Aws::String stringToSign(AWS_HMAC_SHA256);
+    stringToSign.reserve(strlen(AWS_HMAC_SHA256) + dateValue.size() + credentialScope.size() + canonicalRequestHash.size() + 3);
+    stringToSign.append(NEWLINE).append(dateValue).append(NEWLINE).append(credentialScope).append(NEWLINE).append(canonicalRequestHash);
+    return stringToSign;
 }
 
 ByteBuffer AWSAuthV4Signer::ComputeHash(const Aws::String& secretKey, const Aws::String& simpleDate) const
 {
-    Utils::Threading::ReaderLockGuard guard(m_partialSignatureLock);
-    if (m_currentDateStr != simpleDate || m_currentSecretKey != secretKey)
+    auto cached = std::atomic_load(&m_signingKeyCache);
+    if (cached && cached->simpleDate == simpleDate && cached->secretKey == secretKey)
     {
-        guard.UpgradeToWriterLock();
-        // check again to prevent racing writers
-        if (m_currentDateStr != simpleDate || m_currentSecretKey != secretKey)
-        {
-            m_currentSecretKey = secretKey;
-            m_currentDateStr = simpleDate;
-            m_partialSignature = ComputeHash(m_currentSecretKey, m_currentDateStr, m_region, m_serviceName);
-        }
+        return cached->signingKey;
+    }
+
+    // racing signers may both derive the key, whichever is stored last is as good as the other.
+    auto entry = Aws::MakeShared<SigningKeyCacheEntry>(v4LogTag);
+    entry->secretKey = secretKey;
+    entry->simpleDate = simpleDate;
+    entry->signingKey = ComputeHash(secretKey, simpleDate, m_region, m_serviceName);
+    if (entry->signingKey.GetLength() > 0)
+    {
+        std::atomic_store(&m_signingKeyCache, std::shared_ptr<const SigningKeyCacheEntry>(entry));
     }
-    return m_partialSignature;
+    return entry->signingKey;
 }
 
 Aws::Utils::ByteBuffer AWSAuthV4Signer::ComputeHash(const Aws::String& secretKey,
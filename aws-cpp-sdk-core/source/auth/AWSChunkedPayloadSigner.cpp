@@ -0,0 +1,213 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/auth/AWSChunkedPayloadSigner.h>
+
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/crypto/Sha256HMAC.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Aws;
+using namespace Aws::Client;
+using namespace Aws::Utils;
+
+static const char* AWS_HMAC_SHA256_PAYLOAD = "AWS4-HMAC-SHA256-PAYLOAD";
+static const char* CHUNK_SIGNATURE = ";chunk-signature=";
+static const char* CRLF = "\r\n";
+static const char* NEWLINE = "\n";
+static const char* EMPTY_STRING_SHA256 = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+static const size_t SIGNATURE_LENGTH = 64;
+
+static const char* chunkedSignerLogTag = "AWSChunkedPayloadSigner";
+
+const size_t AWSChunkedPayloadSigner::DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+static Aws::String HexLength(uint64_t value)
+{
+    Aws::StringStream ss;
+    ss << std::hex << value;
+    return ss.str();
+}
+
+static uint64_t ChunkOverhead(uint64_t chunkLength)
+{
+    return HexLength(chunkLength).size() + strlen(CHUNK_SIGNATURE) + SIGNATURE_LENGTH + 2 * strlen(CRLF);
+}
+
+AWSChunkedPayloadSigner::AWSChunkedPayloadSigner(const ByteBuffer& signingKey, const Aws::String& dateTime, const Aws::String& credentialScope,
+        const Aws::String& seedSignature, uint64_t payloadLength, size_t chunkSize) :
+    m_signingKey(signingKey),
+    m_dateTime(dateTime),
+    m_credentialScope(credentialScope),
+    m_seedSignature(seedSignature),
+    m_payloadLength(payloadLength),
+    m_chunkSize(chunkSize > 0 ? chunkSize : DEFAULT_CHUNK_SIZE),
+    m_hash(Aws::MakeUnique<Crypto::Sha256>(chunkedSignerLogTag)),
+    m_HMAC(Aws::MakeUnique<Crypto::Sha256HMAC>(chunkedSignerLogTag)),
+    m_previousSignature(seedSignature),
+    m_payloadRead(0),
+    m_finalChunkSigned(false),
+    m_failed(false),
+    m_encodedPosition(0),
+    m_dataBegin(0),
+    m_dataEnd(0)
+{
+}
+
+AWSChunkedPayloadSigner::~AWSChunkedPayloadSigner()
+{
+    // empty destructor in .cpp file to keep from needing the implementation of (Sha256, Sha256HMAC) in the header file
+}
+
+uint64_t AWSChunkedPayloadSigner::ComputeEncodedLength(uint64_t payloadLength, size_t chunkSize)
+{
+    if (chunkSize == 0)
+    {
+        chunkSize = DEFAULT_CHUNK_SIZE;
+    }
+
+    uint64_t fullChunks = payloadLength / chunkSize;
+    uint64_t lastChunkLength = payloadLength % chunkSize;
+    uint64_t encodedLength = payloadLength + fullChunks * ChunkOverhead(chunkSize) + ChunkOverhead(0);
+    if (lastChunkLength > 0)
+    {
+        encodedLength += ChunkOverhead(lastChunkLength);
+    }
+    return encodedLength;
+}
+
+Aws::String AWSChunkedPayloadSigner::SignChunk(const Aws::String& chunkData)
+{
+    auto hashResult = m_hash->Calculate(chunkData);
+    if (!hashResult.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(chunkedSignerLogTag, "Unable to hash (sha256) chunk of " << chunkData.size() << " bytes");
+        return "";
+    }
+
+    Aws::String stringToSign(AWS_HMAC_SHA256_PAYLOAD);
+    stringToSign.append(NEWLINE).append(m_dateTime)
+        .append(NEWLINE).append(m_credentialScope)
+        .append(NEWLINE).append(m_previousSignature)
+        .append(NEWLINE).append(EMPTY_STRING_SHA256)
+        .append(NEWLINE).append(HashingUtils::HexEncode(hashResult.GetResult()));
+
+    auto signatureResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), m_signingKey);
+    if (!signatureResult.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(chunkedSignerLogTag, "Unable to hmac (sha256) chunk string to sign");
+        AWS_LOGSTREAM_DEBUG(chunkedSignerLogTag, "The chunk string to sign is: \"" << stringToSign << "\"");
+        return "";
+    }
+
+    m_previousSignature = HashingUtils::HexEncode(signatureResult.GetResult());
+    return m_previousSignature;
+}
+
+bool AWSChunkedPayloadSigner::EncodeNextChunk(Aws::IStream& body, const Aws::Vector<std::shared_ptr<Crypto::Hash>>* payloadHashes)
+{
+    size_t chunkLength = static_cast<size_t>((std::min<uint64_t>)(m_chunkSize, m_payloadLength - m_payloadRead));
+    m_chunkData.resize(chunkLength);
+    if (chunkLength > 0)
+    {
+        body.read(&m_chunkData[0], static_cast<std::streamsize>(chunkLength));
+        if (static_cast<size_t>(body.gcount()) != chunkLength)
+        {
+            AWS_LOGSTREAM_ERROR(chunkedSignerLogTag, "Request body ended after " << m_payloadRead + body.gcount() << " bytes, expected " << m_payloadLength);
+            return false;
+        }
+        m_payloadRead += chunkLength;
+
+        if (payloadHashes)
+        {
+            for (const auto& hash : *payloadHashes)
+            {
+                hash->Update(reinterpret_cast<const unsigned char*>(m_chunkData.data()), chunkLength);
+            }
+        }
+    }
+
+    Aws::String signature = SignChunk(m_chunkData);
+    if (signature.empty())
+    {
+        return false;
+    }
+
+    m_encoded.assign(HexLength(chunkLength)).append(CHUNK_SIGNATURE).append(signature).append(CRLF);
+    m_dataBegin = m_encoded.size();
+    m_encoded.append(m_chunkData);
+    m_dataEnd = m_encoded.size();
+    m_encoded.append(CRLF);
+    m_encodedPosition = 0;
+    m_finalChunkSigned = chunkLength == 0;
+    return true;
+}
+
+size_t AWSChunkedPayloadSigner::Read(Aws::IStream& body, char* buffer, size_t length, size_t& payloadBytes,
+        const Aws::Vector<std::shared_ptr<Crypto::Hash>>* payloadHashes)
+{
+    payloadBytes = 0;
+    size_t written = 0;
+    while (written < length && !m_failed)
+    {
+        if (m_encodedPosition == m_encoded.size())
+        {
+            if (m_finalChunkSigned)
+            {
+                break;
+            }
+            if (!EncodeNextChunk(body, payloadHashes))
+            {
+                m_failed = true;
+                break;
+            }
+        }
+
+        size_t toCopy = (std::min)(length - written, m_encoded.size() - m_encodedPosition);
+        memcpy(buffer + written, m_encoded.data() + m_encodedPosition, toCopy);
+
+        size_t dataFrom = (std::max)(m_encodedPosition, m_dataBegin);
+        size_t dataTo = (std::min)(m_encodedPosition + toCopy, m_dataEnd);
+        if (dataTo > dataFrom)
+        {
+            payloadBytes += dataTo - dataFrom;
+        }
+
+        m_encodedPosition += toCopy;
+        written += toCopy;
+    }
+
+    return m_failed ? 0 : written;
+}
+
+void AWSChunkedPayloadSigner::Reset()
+{
+    m_previousSignature = m_seedSignature;
+    m_payloadRead = 0;
+    m_finalChunkSigned = false;
+    m_failed = false;
+    m_encoded.clear();
+    m_encodedPosition = 0;
+    m_dataBegin = 0;
+    m_dataEnd = 0;
+}
@@ -16,11 +16,14 @@
 
 #include <aws/core/auth/AWSCredentialsProvider.h>
 
+#include <aws/core/auth/CredentialsRefreshScheduler.h>
+
 #include <aws/core/config/AWSProfileConfigLoader.h>
 #include <aws/core/platform/Environment.h>
 #include <aws/core/platform/FileSystem.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/utils/FileSystemUtils.h>
 
@@ -59,8 +62,6 @@ static const char DIRECTORY_JOIN[] = "/";
 #endif // _WIN32
 
 
-static const int EXPIRATION_GRACE_PERIOD = 5 * 1000;
-
 void AWSCredentialsProvider::Reload()
 {
     m_lastLoadedMs = DateTime::Now().Millis();
@@ -236,18 +237,45 @@ void ProfileConfigFileAWSCredentialsProvider::RefreshIfExpired()
 
 static const char* INSTANCE_LOG_TAG = "InstanceProfileCredentialsProvider";
 
-InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refreshRateMs) :
-        m_ec2MetadataConfigLoader(Aws::MakeShared<Aws::Config::EC2InstanceProfileConfigLoader>(INSTANCE_LOG_TAG)),
-        m_loadFrequencyMs(refreshRateMs)
+static bool FetchInstanceProfileCredentials(Aws::Config::AWSProfileConfigLoader& loader, AWSCredentials& credentials)
+{
+    AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Pulling credentials from EC2 Metadata Service.");
+    if (!loader.Load())
+    {
+        return false;
+    }
+
+    auto profileIter = loader.GetProfiles().find(Aws::Config::INSTANCE_PROFILE_KEY);
+    if (profileIter == loader.GetProfiles().end() || profileIter->second.GetCredentials().GetAWSAccessKeyId().empty())
+    {
+        return false;
+    }
+    credentials = profileIter->second.GetCredentials();
+    return true;
+}
+
+static std::shared_ptr<CredentialsRefreshScheduler> MakeInstanceProfileRefreshScheduler(
+        const std::shared_ptr<Aws::Config::AWSProfileConfigLoader>& loader, long refreshRateMs)
+{
+    return Aws::MakeShared<CredentialsRefreshScheduler>(INSTANCE_LOG_TAG,
+            [loader](AWSCredentials& credentials) { return FetchInstanceProfileCredentials(*loader, credentials); }, refreshRateMs);
+}
+
+InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refreshRateMs)
 {
     AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Creating Instance with default EC2MetadataClient and refresh rate " << refreshRateMs);
+    Aws::StringStream sourceKey;
+    sourceKey << "InstanceProfile/" << refreshRateMs;
+    m_refreshScheduler = CredentialsRefreshScheduler::GetShared(sourceKey.str(), [refreshRateMs]()
+    {
+        return MakeInstanceProfileRefreshScheduler(Aws::MakeShared<Aws::Config::EC2InstanceProfileConfigLoader>(INSTANCE_LOG_TAG), refreshRateMs);
+    });
 }
 
 
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(const std::shared_ptr<Aws::Config::EC2InstanceProfileConfigLoader>& loader,
                                                                        long refreshRateMs) :
-        m_ec2MetadataConfigLoader(loader),
-        m_loadFrequencyMs(refreshRateMs)
+        m_refreshScheduler(MakeInstanceProfileRefreshScheduler(loader, refreshRateMs))
 {
     AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Creating Instance with injected EC2MetadataClient and refresh rate " << refreshRateMs);
 }
@@ -255,128 +283,99 @@ InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(const std
 
 AWSCredentials InstanceProfileCredentialsProvider::GetAWSCredentials()
 {
-    RefreshIfExpired();
-    ReaderLockGuard guard(m_reloadLock);
-    auto profileIter = m_ec2MetadataConfigLoader->GetProfiles().find(Aws::Config::INSTANCE_PROFILE_KEY);
-
-    if(profileIter != m_ec2MetadataConfigLoader->GetProfiles().end())
-    {
-        return profileIter->second.GetCredentials();
-    }
-
-    return AWSCredentials();
+    return m_refreshScheduler->GetCredentials();
 }
 
 void InstanceProfileCredentialsProvider::Reload()
 {
     AWS_LOGSTREAM_INFO(INSTANCE_LOG_TAG, "Credentials have expired attempting to repull from EC2 Metadata Service.");
-    m_ec2MetadataConfigLoader->Load();
+    m_refreshScheduler->Refresh();
     AWSCredentialsProvider::Reload();
 }
 
-void InstanceProfileCredentialsProvider::RefreshIfExpired()
+static const char TASK_ROLE_LOG_TAG[] = "TaskRoleCredentialsProvider";
+
+static bool FetchTaskRoleCredentials(const ECSCredentialsClient& client, AWSCredentials& credentials)
 {
-    AWS_LOGSTREAM_DEBUG(INSTANCE_LOG_TAG, "Checking if latest credential pull has expired.");
-    ReaderLockGuard guard(m_reloadLock);
-    if (!IsTimeToRefresh(m_loadFrequencyMs))
+    AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Pulling credentials from ECS IAM Service.");
+
+    auto credentialsStr = client.GetECSCredentials();
+    if (credentialsStr.empty()) return false;
+
+    Json::JsonValue credentialsDoc(credentialsStr);
+    if (!credentialsDoc.WasParseSuccessful()) 
     {
-        return;
+        AWS_LOGSTREAM_ERROR(TASK_ROLE_LOG_TAG, "Failed to parse output from ECSCredentialService with error " << credentialsDoc.GetErrorMessage());
+        return false;
     }
 
-    guard.UpgradeToWriterLock();
-    if (!IsTimeToRefresh(m_loadFrequencyMs)) // double-checked lock to avoid refreshing twice
+    Json::JsonView credentialsView(credentialsDoc);
+    Aws::String accessKey = credentialsView.GetString("AccessKeyId");
+    if (accessKey.empty())
     {
-        return; 
+        AWS_LOGSTREAM_ERROR(TASK_ROLE_LOG_TAG, "No credentials in output from ECSCredentialService.");
+        return false;
     }
-    Reload();
+    AWS_LOGSTREAM_DEBUG(TASK_ROLE_LOG_TAG, "Successfully pulled credentials from metadata service with access key " << accessKey);
+
+    credentials = AWSCredentials(accessKey, credentialsView.GetString("SecretAccessKey"), credentialsView.GetString("Token"));
+    DateTime expiration(credentialsView.GetString("Expiration"), DateFormat::ISO_8601);
+    if (expiration.WasParseSuccessful())
+    {
+        credentials.SetExpiration(expiration);
+    }
+    return true;
 }
 
-static const char TASK_ROLE_LOG_TAG[] = "TaskRoleCredentialsProvider";
+static std::shared_ptr<CredentialsRefreshScheduler> MakeTaskRoleRefreshScheduler(const std::shared_ptr<ECSCredentialsClient>& client,
+        long refreshRateMs)
+{
+    return Aws::MakeShared<CredentialsRefreshScheduler>(TASK_ROLE_LOG_TAG,
+            [client](AWSCredentials& credentials) { return FetchTaskRoleCredentials(*client, credentials); }, refreshRateMs);
+}
 
-TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* URI, long refreshRateMs) :
-    m_ecsCredentialsClient(Aws::MakeShared<Aws::Internal::ECSCredentialsClient>(TASK_ROLE_LOG_TAG, URI)),
-    m_loadFrequencyMs(refreshRateMs),
-    m_expirationDate(DateTime::Now()),
-    m_credentials(Aws::Auth::AWSCredentials())
+TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* URI, long refreshRateMs)
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
+    Aws::StringStream sourceKey;
+    sourceKey << "TaskRole/" << URI << "/" << refreshRateMs;
+    Aws::String resourcePath(URI);
+    m_refreshScheduler = CredentialsRefreshScheduler::GetShared(sourceKey.str(), [resourcePath, refreshRateMs]()
+    {
+        return MakeTaskRoleRefreshScheduler(Aws::MakeShared<ECSCredentialsClient>(TASK_ROLE_LOG_TAG, resourcePath.c_str()), refreshRateMs);
+    });
 }
 
-TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* endpoint, const char* token, long refreshRateMs) :
-    m_ecsCredentialsClient(Aws::MakeShared<Aws::Internal::ECSCredentialsClient>(TASK_ROLE_LOG_TAG, ""/*resourcePath*/,
-                endpoint, token)),
-    m_loadFrequencyMs(refreshRateMs),
-    m_expirationDate(DateTime::Now()),
-    m_credentials(Aws::Auth::AWSCredentials())
+TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(const char* endpoint, const char* token, long refreshRateMs)
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
+    Aws::StringStream sourceKey;
+    // keyed on a hash of the token, so that the token itself never ends up anywhere but in the requests.
+    sourceKey << "TaskRole/" << endpoint << "/" << HashingUtils::HexEncode(HashingUtils::CalculateSHA256(token)) << "/" << refreshRateMs;
+    Aws::String endpointUri(endpoint);
+    Aws::String authToken(token);
+    m_refreshScheduler = CredentialsRefreshScheduler::GetShared(sourceKey.str(), [endpointUri, authToken, refreshRateMs]()
+    {
+        return MakeTaskRoleRefreshScheduler(Aws::MakeShared<ECSCredentialsClient>(TASK_ROLE_LOG_TAG, ""/*resourcePath*/,
+                    endpointUri.c_str(), authToken.c_str()), refreshRateMs);
+    });
 }
 
 TaskRoleCredentialsProvider::TaskRoleCredentialsProvider(
         const std::shared_ptr<Aws::Internal::ECSCredentialsClient>& client, long refreshRateMs) :
-    m_ecsCredentialsClient(client),
-    m_loadFrequencyMs(refreshRateMs),
-    m_expirationDate(DateTime::Now()),
-    m_credentials(Aws::Auth::AWSCredentials())
+    m_refreshScheduler(MakeTaskRoleRefreshScheduler(client, refreshRateMs))
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Creating TaskRole with default ECSCredentialsClient and refresh rate " << refreshRateMs);
 }
 
 AWSCredentials TaskRoleCredentialsProvider::GetAWSCredentials()
 {
-    RefreshIfExpired();
-    ReaderLockGuard guard(m_reloadLock);
-    return m_credentials;
-}
-
-bool TaskRoleCredentialsProvider::ExpiresSoon() const
-{
-    return (m_expirationDate.Millis() - Aws::Utils::DateTime::Now().Millis() < EXPIRATION_GRACE_PERIOD);
+    return m_refreshScheduler->GetCredentials();
 }
 
 void TaskRoleCredentialsProvider::Reload()
 {
     AWS_LOGSTREAM_INFO(TASK_ROLE_LOG_TAG, "Credentials have expired or will expire, attempting to repull from ECS IAM Service.");
-
-    auto credentialsStr = m_ecsCredentialsClient->GetECSCredentials();
-    if (credentialsStr.empty()) return;
-
-    Json::JsonValue credentialsDoc(credentialsStr);
-    if (!credentialsDoc.WasParseSuccessful()) 
-    {
-        AWS_LOGSTREAM_ERROR(TASK_ROLE_LOG_TAG, "Failed to parse output from ECSCredentialService with error " << credentialsDoc.GetErrorMessage());
-        return;
-    }
-
-    Aws::String accessKey, secretKey, token;
-    Utils::Json::JsonView credentialsView(credentialsDoc);
-    accessKey = credentialsView.GetString("AccessKeyId");
-    secretKey = credentialsView.GetString("SecretAccessKey");
-    token = credentialsView.GetString("Token");
-    AWS_LOGSTREAM_DEBUG(TASK_ROLE_LOG_TAG, "Successfully pulled credentials from metadata service with access key " << accessKey);
-
-    m_credentials.SetAWSAccessKeyId(accessKey);
-    m_credentials.SetAWSSecretKey(secretKey);
-    m_credentials.SetSessionToken(token);
-    m_expirationDate = Aws::Utils::DateTime(credentialsView.GetString("Expiration"), DateFormat::ISO_8601);
+    m_refreshScheduler->Refresh();
     AWSCredentialsProvider::Reload();
 }
-
-void TaskRoleCredentialsProvider::RefreshIfExpired()
-{
-    AWS_LOGSTREAM_DEBUG(TASK_ROLE_LOG_TAG, "Checking if latest credential pull has expired.");
-    ReaderLockGuard guard(m_reloadLock);
-    if (!IsTimeToRefresh(m_loadFrequencyMs) && !ExpiresSoon())
-    {
-        return;
-    }
-
-    guard.UpgradeToWriterLock();
-
-    if (!IsTimeToRefresh(m_loadFrequencyMs) && !ExpiresSoon())
-    {
-        return;
-    }
-
-    Reload();
-}
@@ -0,0 +1,251 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/auth/CredentialsRefreshScheduler.h>
+
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+
+#include <algorithm>
+
+using namespace Aws::Auth;
+using namespace Aws::Utils;
+
+static const char CREDENTIALS_REFRESH_SCHEDULER_LOG_TAG[] = "CredentialsRefreshScheduler";
+
+const long CredentialsRefreshScheduler::MIN_REFRESH_INTERVAL_MS;
+const long CredentialsRefreshScheduler::DEFAULT_REFRESH_AHEAD_MS;
+const long CredentialsRefreshScheduler::EXPIRATION_GRACE_PERIOD_MS;
+const long CredentialsRefreshScheduler::DEFAULT_RETRY_BASE_DELAY_MS;
+const long CredentialsRefreshScheduler::DEFAULT_MAX_RETRY_DELAY_MS;
+
+typedef Aws::Map<Aws::String, std::weak_ptr<CredentialsRefreshScheduler>> SharedRefreshSchedulers;
+
+// created by Aws::InitAPI and destroyed by Aws::ShutdownAPI, both under the lock.
+static std::mutex s_sharedRefreshSchedulersLock;
+static SharedRefreshSchedulers* s_sharedRefreshSchedulers = nullptr;
+
+static bool ExpiresAtSomePoint(const AWSCredentials& credentials)
+{
+    return credentials.GetExpiration().UnderlyingTimestamp() != (std::chrono::system_clock::time_point::max)();
+}
+
+static long long MillisUntilExpiration(const AWSCredentials& credentials)
+{
+    return credentials.GetExpiration().Millis() - DateTime::Now().Millis();
+}
+
+CredentialsRefreshScheduler::CredentialsRefreshScheduler(const FetchFunctionType& fetch, long refreshRateMs, long refreshAheadMs,
+    long retryBaseDelayMs, long maxRetryDelayMs) :
+    m_fetch(fetch),
+    m_refreshRate(refreshRateMs),
+    m_refreshAhead(refreshAheadMs),
+    m_retryBaseDelayMs(retryBaseDelayMs),
+    m_maxRetryDelayMs(maxRetryDelayMs),
+    m_refreshStarted(false),
+    m_stopping(false),
+    m_random(std::random_device()())
+{
+}
+
+CredentialsRefreshScheduler::~CredentialsRefreshScheduler()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_refreshLock);
+        m_stopping = true;
+        m_refreshSignal.notify_all();
+    }
+    if (m_refreshThread.joinable())
+    {
+        m_refreshThread.join();
+    }
+
+    if (!m_sourceKey.empty())
+    {
+        std::lock_guard<std::mutex> locker(s_sharedRefreshSchedulersLock);
+        if (s_sharedRefreshSchedulers)
+        {
+            auto schedulerIter = s_sharedRefreshSchedulers->find(m_sourceKey);
+            // unless a new scheduler for the source took this one's place already.
+            if (schedulerIter != s_sharedRefreshSchedulers->end() && schedulerIter->second.expired())
+            {
+                s_sharedRefreshSchedulers->erase(schedulerIter);
+            }
+        }
+    }
+}
+
+AWSCredentials CredentialsRefreshScheduler::GetCredentials()
+{
+    auto loaded = GetLoaded();
+    if (NeedsFetchNow(loaded))
+    {
+        std::lock_guard<std::mutex> locker(m_fetchLock);
+        // another thread may have fetched them while this one waited for it.
+        if (NeedsFetchNow(GetLoaded()))
+        {
+            FetchLocked();
+        }
+        loaded = GetLoaded();
+    }
+
+    if (!m_refreshStarted.exchange(true))
+    {
+        std::lock_guard<std::mutex> locker(m_refreshLock);
+        m_refreshThread = std::thread(&CredentialsRefreshScheduler::RefreshLoop, this);
+    }
+
+    return loaded ? loaded->credentials : AWSCredentials();
+}
+
+void CredentialsRefreshScheduler::Refresh()
+{
+    std::lock_guard<std::mutex> locker(m_fetchLock);
+    FetchLocked();
+}
+
+std::shared_ptr<CredentialsRefreshScheduler> CredentialsRefreshScheduler::GetShared(const Aws::String& sourceKey,
+    const std::function<std::shared_ptr<CredentialsRefreshScheduler>()>& create)
+{
+    std::lock_guard<std::mutex> locker(s_sharedRefreshSchedulersLock);
+    if (!s_sharedRefreshSchedulers)
+    {
+        // the key isn't logged, it can be made of secrets.
+        AWS_LOGSTREAM_WARN(CREDENTIALS_REFRESH_SCHEDULER_LOG_TAG, "Credentials refresh schedulers can't be shared outside of "
+            "Aws::InitAPI and Aws::ShutdownAPI, creating an unshared one.");
+        return create();
+    }
+
+    auto scheduler = (*s_sharedRefreshSchedulers)[sourceKey].lock();
+    if (!scheduler)
+    {
+        scheduler = create();
+        scheduler->m_sourceKey = sourceKey;
+        (*s_sharedRefreshSchedulers)[sourceKey] = scheduler;
+    }
+    return scheduler;
+}
+
+void Aws::Auth::InitCredentialsRefreshSchedulers()
+{
+    std::lock_guard<std::mutex> locker(s_sharedRefreshSchedulersLock);
+    if (!s_sharedRefreshSchedulers)
+    {
+        s_sharedRefreshSchedulers = Aws::New<SharedRefreshSchedulers>(CREDENTIALS_REFRESH_SCHEDULER_LOG_TAG);
+    }
+}
+
+void Aws::Auth::CleanupCredentialsRefreshSchedulers()
+{
+    std::lock_guard<std::mutex> locker(s_sharedRefreshSchedulersLock);
+    Aws::Delete(s_sharedRefreshSchedulers);
+    s_sharedRefreshSchedulers = nullptr;
+}
+
+std::shared_ptr<const CredentialsRefreshScheduler::Loaded> CredentialsRefreshScheduler::GetLoaded() const
+{
+    return std::atomic_load(&m_loaded);
+}
+
+bool CredentialsRefreshScheduler::NeedsFetchNow(const std::shared_ptr<const Loaded>& loaded) const
+{
+    return !loaded || (ExpiresAtSomePoint(loaded->credentials) && MillisUntilExpiration(loaded->credentials) < EXPIRATION_GRACE_PERIOD_MS);
+}
+
+std::chrono::steady_clock::time_point CredentialsRefreshScheduler::GetRefreshTime(const Loaded& loaded) const
+{
+    auto refreshAt = loaded.loadedAt + m_refreshRate;
+    if (ExpiresAtSomePoint(loaded.credentials))
+    {
+        auto expiresAt = std::chrono::steady_clock::now() + std::chrono::milliseconds(MillisUntilExpiration(loaded.credentials));
+        // credentials which didn't live longer than the refresh ahead time to begin with are refreshed halfway through their life.
+        auto refreshAheadAt = expiresAt - m_refreshAhead > loaded.loadedAt ? expiresAt - m_refreshAhead :
+            loaded.loadedAt + (expiresAt - loaded.loadedAt) / 2;
+        refreshAt = (std::min)(refreshAt, refreshAheadAt);
+    }
+    return (std::max)(refreshAt, loaded.loadedAt + std::chrono::milliseconds(MIN_REFRESH_INTERVAL_MS));
+}
+
+bool CredentialsRefreshScheduler::FetchLocked()
+{
+    AWSCredentials credentials;
+    bool fetched = m_fetch(credentials);
+    if (!fetched && GetLoaded())
+    {
+        AWS_LOGSTREAM_WARN(CREDENTIALS_REFRESH_SCHEDULER_LOG_TAG, "Failed to fetch credentials, keeping the current ones.");
+        return false;
+    }
+
+    // without any credentials, empty ones are handed out until a retry succeeds, rather than every caller fetching them.
+    auto loaded = Aws::MakeShared<Loaded>(CREDENTIALS_REFRESH_SCHEDULER_LOG_TAG);
+    loaded->credentials = fetched ? credentials : AWSCredentials();
+    loaded->loadedAt = std::chrono::steady_clock::now();
+    loaded->fetched = fetched;
+    std::atomic_store(&m_loaded, std::shared_ptr<const Loaded>(loaded));
+    return fetched;
+}
+
+std::chrono::steady_clock::time_point CredentialsRefreshScheduler::GetRetryTime(long failures)
+{
+    // full jitter, so that the processes of a fleet failing together don't retry together.
+    long exponent = (std::min)(failures, 20L);
+    long long limit = (std::min)(static_cast<long long>(m_retryBaseDelayMs) << exponent, static_cast<long long>(m_maxRetryDelayMs));
+    long long delay = limit > 0 ? std::uniform_int_distribution<long long>(0, limit)(m_random) : 0;
+    AWS_LOGSTREAM_INFO(CREDENTIALS_REFRESH_SCHEDULER_LOG_TAG, "Retrying credentials fetch in " << delay << " ms.");
+    return std::chrono::steady_clock::now() + std::chrono::milliseconds(delay);
+}
+
+void CredentialsRefreshScheduler::RefreshLoop()
+{
+    AWS_LOGSTREAM_DEBUG(CREDENTIALS_REFRESH_SCHEDULER_LOG_TAG, "Starting background credentials refresh.");
+    long failures = 0;
+    std::chrono::steady_clock::time_point retryAt;
+    std::unique_lock<std::mutex> locker(m_refreshLock);
+    while (!m_stopping)
+    {
+        auto loaded = GetLoaded();
+        if (failures == 0 && !loaded->fetched)
+        {
+            retryAt = GetRetryTime(failures++);
+        }
+        auto refreshAt = failures > 0 ? retryAt : GetRefreshTime(*loaded);
+        if (m_refreshSignal.wait_until(locker, refreshAt, [this]() { return m_stopping; }))
+        {
+            break;
+        }
+        if (failures == 0 && GetLoaded() != loaded)
+        {
+            // a caller fetched them in the meantime.
+            continue;
+        }
+
+        locker.unlock();
+        bool fetched = false;
+        {
+            std::lock_guard<std::mutex> fetchLocker(m_fetchLock);
+            fetched = FetchLocked();
+        }
+        locker.lock();
+
+        if (fetched)
+        {
+            failures = 0;
+        }
+        else
+        {
+            retryAt = GetRetryTime(failures++);
+        }
+    }
+}
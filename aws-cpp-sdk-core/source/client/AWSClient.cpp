@@ -21,6 +21,7 @@
 #include <aws/core/client/AWSErrorMarshaller.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/RequestLatencyTracker.h>
 #include <aws/core/client/RetryStrategy.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpClientFactory.h>
@@ -32,10 +33,12 @@
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/Globals.h>
 #include <aws/core/utils/EnumParseOverflowContainer.h>
 #include <aws/core/utils/crypto/MD5.h>
+#include <atomic>
 #include <thread>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/crypto/Factories.h>
@@ -72,6 +75,145 @@ static CoreErrors GuessBodylessErrorType(Aws::Http::HttpResponseCode responseCod
     }    
 }
 
+namespace Aws
+{
+namespace Client
+{
+    /**
+     * Runs tasks once their delay is over, on a thread started with the first of them. AttemptExhaustivelyAsync keeps the attempts the
+     * retry strategy holds back here rather than leaving a thread asleep for each of them, and as sending an attempt can block, e.g. on a
+     * connection when the pool is exhausted, they are not sent from the http client's event loop either.
+     */
+    class AsyncAttemptScheduler
+    {
+    public:
+        AsyncAttemptScheduler() : m_tasks(Aws::MakeShared<Tasks>(AWS_CLIENT_LOG_TAG)) {}
+
+        ~AsyncAttemptScheduler()
+        {
+            {
+                std::lock_guard<std::mutex> locker(m_tasks->lock);
+                m_tasks->stopping = true;
+            }
+            m_tasks->signal.notify_one();
+            if (!m_thread.joinable())
+            {
+                return;
+            }
+            // the task running may be what lets go of the client, the thread then winds down on its own.
+            if (m_thread.get_id() == std::this_thread::get_id())
+            {
+                m_thread.detach();
+            }
+            else
+            {
+                m_thread.join();
+            }
+        }
+
+        AsyncAttemptScheduler(const AsyncAttemptScheduler&) = delete;
+        AsyncAttemptScheduler& operator=(const AsyncAttemptScheduler&) = delete;
+
+        void Schedule(std::chrono::milliseconds delay, std::function<void()>&& task)
+        {
+            {
+                std::lock_guard<std::mutex> locker(m_tasks->lock);
+                m_tasks->waiting.emplace(std::chrono::steady_clock::now() + delay, std::move(task));
+                if (!m_thread.joinable())
+                {
+                    m_thread = std::thread(&AsyncAttemptScheduler::Run, m_tasks);
+                }
+            }
+            m_tasks->signal.notify_one();
+        }
+
+        /**
+         * Runs the tasks scheduled so far without waiting for their delay, as when requests get cancelled.
+         */
+        void RunWaitingTasks()
+        {
+            {
+                std::lock_guard<std::mutex> locker(m_tasks->lock);
+                m_tasks->runWaiting = !m_tasks->waiting.empty();
+            }
+            m_tasks->signal.notify_one();
+        }
+
+    private:
+        // shared with the thread, which may outlive the scheduler.
+        struct Tasks
+        {
+            Tasks() : stopping(false), runWaiting(false) {}
+
+            std::mutex lock;
+            std::condition_variable signal;
+            Aws::MultiMap<std::chrono::steady_clock::time_point, std::function<void()>> waiting;
+            bool stopping;
+            bool runWaiting;
+        };
+
+        static void Run(std::shared_ptr<Tasks> tasks)
+        {
+            std::unique_lock<std::mutex> locker(tasks->lock);
+            while (!tasks->stopping)
+            {
+                if (tasks->waiting.empty())
+                {
+                    tasks->runWaiting = false;
+                    tasks->signal.wait(locker);
+                    continue;
+                }
+
+                auto nextTask = tasks->waiting.begin();
+                if (!tasks->runWaiting && nextTask->first > std::chrono::steady_clock::now())
+                {
+                    tasks->signal.wait_until(locker, nextTask->first);
+                    continue;
+                }
+
+                {
+                    std::function<void()> task = std::move(nextTask->second);
+                    tasks->waiting.erase(nextTask);
+                    locker.unlock();
+                    task();
+                }
+                locker.lock();
+            }
+        }
+
+        std::shared_ptr<Tasks> m_tasks;
+        std::thread m_thread;
+    };
+
+    // Handed out by AWSClient::TrackPendingRequest, counting a request as pending for as long as it is around.
+    class PendingRequestToken
+    {
+    public:
+        PendingRequestToken(std::mutex& lock, std::condition_variable& signal, size_t& pendingRequests) :
+            m_lock(lock), m_signal(signal), m_pendingRequests(pendingRequests)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_pendingRequests++;
+        }
+
+        ~PendingRequestToken()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_pendingRequests--;
+            m_signal.notify_all();
+        }
+
+        PendingRequestToken(const PendingRequestToken&) = delete;
+        PendingRequestToken& operator=(const PendingRequestToken&) = delete;
+
+    private:
+        std::mutex& m_lock;
+        std::condition_variable& m_signal;
+        size_t& m_pendingRequests;
+    };
+} // namespace Client
+} // namespace Aws
+
 AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     const std::shared_ptr<Aws::Client::AWSAuthSigner>& signer,
     const std::shared_ptr<AWSErrorMarshaller>& errorMarshaller) :
@@ -83,7 +225,12 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_latencyTracker(Aws::MakeShared<RequestLatencyTracker>(AWS_CLIENT_LOG_TAG)),
+    m_hedgingPercentile(configuration.hedgingPercentile),
+    m_hedgingMinDelay(configuration.hedgingMinDelayMs),
+    m_attemptThreads(0),
+    m_asyncAttemptScheduler(Aws::MakeShared<AsyncAttemptScheduler>(AWS_CLIENT_LOG_TAG))
 {
 }
 
@@ -98,13 +245,36 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_latencyTracker(Aws::MakeShared<RequestLatencyTracker>(AWS_CLIENT_LOG_TAG)),
+    m_hedgingPercentile(configuration.hedgingPercentile),
+    m_hedgingMinDelay(configuration.hedgingMinDelayMs),
+    m_attemptThreads(0),
+    m_asyncAttemptScheduler(Aws::MakeShared<AsyncAttemptScheduler>(AWS_CLIENT_LOG_TAG))
 {
 }
 
+AWSClient::~AWSClient()
+{
+    WaitForPendingRequests();
+}
+
+void AWSClient::WaitForPendingRequests() const
+{
+    std::unique_lock<std::mutex> locker(m_attemptThreadsLock);
+    m_attemptThreadsSignal.wait(locker, [this]() { return m_attemptThreads == 0; });
+}
+
+std::shared_ptr<const void> AWSClient::TrackPendingRequest() const
+{
+    return Aws::MakeShared<PendingRequestToken>(AWS_CLIENT_LOG_TAG, m_attemptThreadsLock, m_attemptThreadsSignal, m_attemptThreads);
+}
+
 void AWSClient::DisableRequestProcessing() 
 { 
     m_httpClient->DisableRequestProcessing(); 
+    // the attempts waiting on a delay go out right away, to be cancelled, the way those waiting in RetryRequestSleep wake up.
+    m_asyncAttemptScheduler->RunWaitingTasks();
 }
 
 void AWSClient::EnableRequestProcessing() 
@@ -175,9 +345,30 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
     Aws::Monitoring::CoreMetricsCollection coreMetrics;
     auto contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), request.GetServiceRequestName(), httpRequest);
 
+    bool boundedAttempts = request.IsHedgingEnabled() || request.GetDeadlineMs() > 0;
+    auto deadline = request.GetDeadlineMs() > 0 ? std::chrono::steady_clock::now() + std::chrono::milliseconds(request.GetDeadlineMs()) :
+        std::chrono::steady_clock::time_point::max();
+    AWSError<CoreErrors> lastError;
     for (long retries = 0;; retries++)
     {
-        outcome = AttemptOneRequest(httpRequest, request, signerName);
+        AcquireSendToken(deadline);
+
+        if (boundedAttempts)
+        {
+            outcome = AttemptHedgedRequest(uri, method, httpRequest, request, signerName, GetHedgeDelay(request), deadline);
+        }
+        else
+        {
+            outcome = AttemptOneRequest(httpRequest, request, signerName);
+        }
+        if (retries == 0)
+        {
+            m_retryStrategy->RequestBookkeeping(outcome);
+        }
+        else
+        {
+            m_retryStrategy->RequestBookkeeping(outcome, lastError);
+        }
         coreMetrics.httpClientMetrics = httpRequest->GetRequestMetrics();
         if (outcome.IsSuccess())
         {
@@ -199,10 +390,17 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
         //sleep if clock skew was NOT the problem. AdjustClockSkew may update error inside outcome.
         bool shouldSleep = !AdjustClockSkew(outcome, signerName);
 
+        if (std::chrono::steady_clock::now() + std::chrono::milliseconds(shouldSleep ? sleepMillis : 0) >= deadline)
+        {
+            AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, and its deadline leaves no time for another attempt.");
+            break;
+        }
+
         if (!m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
         {
             break;
         }
+        lastError = outcome.GetError();
 
         AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
         if(request.GetBody())
@@ -234,9 +432,20 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri, Ht
     Aws::Monitoring::CoreMetricsCollection coreMetrics;
     auto contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), requestName, httpRequest);
 
+    AWSError<CoreErrors> lastError;
     for (long retries = 0;; retries++)
     {
+        AcquireSendToken(std::chrono::steady_clock::time_point::max());
+
         outcome = AttemptOneRequest(httpRequest, signerName);
+        if (retries == 0)
+        {
+            m_retryStrategy->RequestBookkeeping(outcome);
+        }
+        else
+        {
+            m_retryStrategy->RequestBookkeeping(outcome, lastError);
+        }
         coreMetrics.httpClientMetrics = httpRequest->GetRequestMetrics();
         if (outcome.IsSuccess())
         {
@@ -262,6 +471,7 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri, Ht
         {
             break;
         }
+        lastError = outcome.GetError();
 
         AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
 
@@ -285,6 +495,358 @@ static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& respo
 
 }
 
+namespace Aws
+{
+namespace Client
+{
+    // What an AttemptExhaustivelyAsync request carries from one attempt to the next.
+    struct AsyncRequestState
+    {
+        Aws::Http::URI uri;
+        std::shared_ptr<const Aws::AmazonWebServiceRequest> request;
+        HttpMethod method;
+        const char* signerName;
+        HttpResponseOutcomeHandler handler;
+        std::shared_ptr<HttpRequest> httpRequest;
+        long retries;
+        AWSError<CoreErrors> lastError;
+        Aws::Monitoring::CoreMetricsCollection coreMetrics;
+        Aws::Vector<void*> contexts;
+    };
+} // namespace Client
+} // namespace Aws
+
+bool AWSClient::SupportsAsyncRequests() const
+{
+    return m_httpClient->SupportsAsyncRequests();
+}
+
+bool AWSClient::SupportsAsyncRequests(const Aws::AmazonWebServiceRequest& request) const
+{
+    return SupportsAsyncRequests() && !request.IsHedgingEnabled() && request.GetDeadlineMs() <= 0;
+}
+
+void AWSClient::AttemptExhaustivelyAsync(const Aws::Http::URI& uri,
+    const std::shared_ptr<const Aws::AmazonWebServiceRequest>& request,
+    HttpMethod method,
+    const char* signerName,
+    const HttpResponseOutcomeHandler& handler) const
+{
+    if (request->IsHedgingEnabled() || request->GetDeadlineMs() > 0)
+    {
+        AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Hedging and deadlines are not applied to requests sent asynchronously through the http client.");
+    }
+    auto state = Aws::MakeShared<AsyncRequestState>(AWS_CLIENT_LOG_TAG);
+    state->uri = uri;
+    state->request = request;
+    state->method = method;
+    state->signerName = signerName;
+    state->handler = handler;
+    state->httpRequest = CreateHttpRequest(uri, method, request->GetResponseStreamFactory());
+    state->retries = 0;
+    state->contexts = Aws::Monitoring::OnRequestStarted(this->GetServiceClientName(), request->GetServiceRequestName(), state->httpRequest);
+
+    // the client waits for the request to complete before being destroyed, as its attempts call back into it.
+    {
+        std::lock_guard<std::mutex> locker(m_attemptThreadsLock);
+        m_attemptThreads++;
+    }
+    SendAsyncAttempt(state);
+}
+
+void AWSClient::SendAsyncAttempt(const std::shared_ptr<AsyncRequestState>& state) const
+{
+    long sendTokenDelayMillis = m_retryStrategy->AcquireSendToken();
+    if (sendTokenDelayMillis > 0 && m_httpClient->IsRequestProcessingEnabled())
+    {
+        AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Delaying request by " << sendTokenDelayMillis << " ms for the client side send rate limit.");
+        m_asyncAttemptScheduler->Schedule(std::chrono::milliseconds(sendTokenDelayMillis), [this, state]() { SendAsyncAttempt(state); });
+        return;
+    }
+
+    BuildHttpRequest(*state->request, state->httpRequest);
+    if (!GetSignerByName(state->signerName)->SignRequest(*state->httpRequest, state->request->SignBody()))
+    {
+        AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
+        OnAsyncAttemptDone(state, HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/)));
+        return;
+    }
+
+    AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request Successfully signed");
+    m_httpClient->MakeRequestAsync(state->httpRequest, [this, state](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& httpResponse)
+    {
+        if (DoesResponseGenerateError(httpResponse))
+        {
+            AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
+            OnAsyncAttemptDone(state, HttpResponseOutcome(BuildAWSError(httpResponse)));
+            return;
+        }
+        AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned successful response.");
+        OnAsyncAttemptDone(state, HttpResponseOutcome(httpResponse));
+    }, m_readRateLimiter.get(), m_writeRateLimiter.get());
+}
+
+void AWSClient::OnAsyncAttemptDone(const std::shared_ptr<AsyncRequestState>& state, HttpResponseOutcome&& outcome) const
+{
+    const Aws::AmazonWebServiceRequest& request = *state->request;
+    if (state->retries == 0)
+    {
+        m_retryStrategy->RequestBookkeeping(outcome);
+    }
+    else
+    {
+        m_retryStrategy->RequestBookkeeping(outcome, state->lastError);
+    }
+    state->coreMetrics.httpClientMetrics = state->httpRequest->GetRequestMetrics();
+
+    bool retry = false;
+    bool shouldSleep = false;
+    long sleepMillis = 0;
+    if (outcome.IsSuccess())
+    {
+        Aws::Monitoring::OnRequestSucceeded(this->GetServiceClientName(), request.GetServiceRequestName(), state->httpRequest, outcome, state->coreMetrics, state->contexts);
+        AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request successful returning.");
+    }
+    else
+    {
+        Aws::Monitoring::OnRequestFailed(this->GetServiceClientName(), request.GetServiceRequestName(), state->httpRequest, outcome, state->coreMetrics, state->contexts);
+        if (!m_httpClient->IsRequestProcessingEnabled())
+        {
+            AWS_LOGSTREAM_TRACE(AWS_CLIENT_LOG_TAG, "Request was cancelled externally.");
+        }
+        else
+        {
+            sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), state->retries);
+            //AdjustClockSkew returns true means clock skew was the problem and skew was adjusted, false otherwise.
+            shouldSleep = !AdjustClockSkew(outcome, state->signerName);
+            retry = m_retryStrategy->ShouldRetry(outcome.GetError(), state->retries);
+        }
+    }
+
+    if (!retry)
+    {
+        Aws::Monitoring::OnFinish(this->GetServiceClientName(), request.GetServiceRequestName(), state->httpRequest, state->contexts);
+        state->handler(outcome);
+
+        std::lock_guard<std::mutex> locker(m_attemptThreadsLock);
+        m_attemptThreads--;
+        m_attemptThreadsSignal.notify_all();
+        return;
+    }
+
+    state->lastError = outcome.GetError();
+    state->retries++;
+    AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request failed, now waiting " << sleepMillis << " ms before attempting again.");
+    if (request.GetBody())
+    {
+        request.GetBody()->clear();
+        request.GetBody()->seekg(0);
+    }
+
+    if (request.GetRequestRetryHandler())
+    {
+        request.GetRequestRetryHandler()(request);
+    }
+
+    state->httpRequest = CreateHttpRequest(state->uri, state->method, request.GetResponseStreamFactory());
+    Aws::Monitoring::OnRequestRetry(this->GetServiceClientName(), request.GetServiceRequestName(), state->httpRequest, state->contexts);
+
+    // this may be the event loop thread, which must neither wait out the delay nor send the next attempt.
+    m_asyncAttemptScheduler->Schedule(std::chrono::milliseconds(shouldSleep ? sleepMillis : 0), [this, state]() { SendAsyncAttempt(state); });
+}
+
+void AWSClient::AcquireSendToken(const std::chrono::steady_clock::time_point& deadline) const
+{
+    for (long sendTokenDelayMillis = m_retryStrategy->AcquireSendToken(); sendTokenDelayMillis > 0 && m_httpClient->IsRequestProcessingEnabled();
+        sendTokenDelayMillis = m_retryStrategy->AcquireSendToken())
+    {
+        auto untilDeadline = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (untilDeadline.count() <= 0)
+        {
+            // the attempt fails right away on its deadline.
+            return;
+        }
+        AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Waiting " << sendTokenDelayMillis << " ms for the client side send rate limit.");
+        m_httpClient->RetryRequestSleep((std::min)(std::chrono::milliseconds(sendTokenDelayMillis), untilDeadline));
+    }
+}
+
+// What the attempts of a hedged request share with the thread waiting for them, which may give up on them before they finish.
+struct HedgedRequestAttempts
+{
+    HedgedRequestAttempts() : running(0), finished(false), abandoned(false) {}
+
+    std::mutex lock;
+    std::condition_variable signal;
+    size_t running;
+    // set once an attempt succeeds, or all of them have failed, to the attempt kept.
+    bool finished;
+    std::shared_ptr<HttpRequest> httpRequest;
+    std::shared_ptr<HttpResponse> httpResponse;
+    std::chrono::milliseconds latency;
+    // cancels the attempts still running.
+    std::atomic<bool> abandoned;
+};
+
+HttpResponseOutcome AWSClient::AttemptHedgedRequest(const Aws::Http::URI& uri, HttpMethod method, std::shared_ptr<HttpRequest>& httpRequest,
+    const Aws::AmazonWebServiceRequest& request, const char* signerName, std::chrono::milliseconds hedgeDelay,
+    const std::chrono::steady_clock::time_point& deadline) const
+{
+    auto attempts = Aws::MakeShared<HedgedRequestAttempts>(AWS_CLIENT_LOG_TAG);
+    ContinueRequestHandler continueRequest = request.GetContinueRequestHandler();
+    // weak, as the attempt kept ends up referencing its own request.
+    std::weak_ptr<HedgedRequestAttempts> attemptsRef(attempts);
+    ContinueRequestHandler continueAttempt = [attemptsRef, continueRequest, deadline](const HttpRequest* attemptRequest)
+    {
+        auto hedgedAttempts = attemptsRef.lock();
+        return hedgedAttempts && !hedgedAttempts->abandoned && std::chrono::steady_clock::now() < deadline &&
+            (!continueRequest || continueRequest(attemptRequest));
+    };
+    auto prepareAttempt = [&](const std::shared_ptr<HttpRequest>& attemptRequest)
+    {
+        BuildHttpRequest(request, attemptRequest);
+        attemptRequest->SetContinueRequestHandle(continueAttempt);
+        return GetSignerByName(signerName)->SignRequest(*attemptRequest, request.SignBody());
+    };
+
+    if (!prepareAttempt(httpRequest))
+    {
+        AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
+        return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::CLIENT_SIGNING_FAILURE, "", "SDK failed to sign the request", false/*retryable*/));
+    }
+
+    // the attempts would write to the same buffers and hashes: no hedging, and the deadline only enforced by cancelling the attempt.
+    if (!request.GetResponseBodyBuffers().empty() || !request.GetRequestBodyHashes().empty() || !request.GetResponseBodyHashes().empty())
+    {
+        std::shared_ptr<HttpResponse> httpResponse(m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::REQUEST_TIMEOUT, "", "Request did not complete before its deadline", false));
+        }
+        return DoesResponseGenerateError(httpResponse) ? HttpResponseOutcome(BuildAWSError(httpResponse)) : HttpResponseOutcome(httpResponse);
+    }
+
+    auto startAttempt = [&](const std::shared_ptr<HttpRequest>& attemptRequest)
+    {
+        {
+            std::lock_guard<std::mutex> locker(attempts->lock);
+            attempts->running++;
+        }
+        {
+            std::lock_guard<std::mutex> locker(m_attemptThreadsLock);
+            m_attemptThreads++;
+        }
+
+        std::thread attemptThread([this, attempts, attemptRequest]()
+        {
+            auto start = std::chrono::steady_clock::now();
+            std::shared_ptr<HttpResponse> httpResponse(m_httpClient->MakeRequest(attemptRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+            {
+                std::lock_guard<std::mutex> locker(attempts->lock);
+                attempts->running--;
+                if (!attempts->finished && (!DoesResponseGenerateError(httpResponse) || attempts->running == 0))
+                {
+                    attempts->finished = true;
+                    attempts->httpRequest = attemptRequest;
+                    attempts->httpResponse = httpResponse;
+                    attempts->latency = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+                }
+                attempts->signal.notify_all();
+            }
+
+            // the client waits for this before being destroyed.
+            std::lock_guard<std::mutex> locker(m_attemptThreadsLock);
+            m_attemptThreads--;
+            m_attemptThreadsSignal.notify_all();
+        });
+        attemptThread.detach();
+    };
+
+    startAttempt(httpRequest);
+
+    bool hedged = hedgeDelay.count() <= 0;
+    auto hedgeAt = hedged ? std::chrono::steady_clock::time_point::max() : std::chrono::steady_clock::now() + hedgeDelay;
+    std::unique_lock<std::mutex> locker(attempts->lock);
+    while (!attempts->finished)
+    {
+        auto wakeAt = (std::min)(hedgeAt, deadline);
+        if (wakeAt == std::chrono::steady_clock::time_point::max())
+        {
+            attempts->signal.wait(locker);
+            continue;
+        }
+
+        attempts->signal.wait_until(locker, wakeAt);
+        auto now = std::chrono::steady_clock::now();
+        if (attempts->finished || now >= deadline)
+        {
+            break;
+        }
+        if (!hedged && now >= hedgeAt)
+        {
+            hedged = true;
+            hedgeAt = std::chrono::steady_clock::time_point::max();
+            locker.unlock();
+
+            // a body stream the request hands out again, rather than a fresh one, is still being sent by the first attempt:
+            // building and signing a second attempt would read and seek it, so such a request is left to the first attempt.
+            auto body = request.GetBody();
+            if (body && body == request.GetBody())
+            {
+                AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Attempt still running after " << hedgeDelay.count() << " ms, but its body stream can't be sent twice.");
+            }
+            else
+            {
+                auto hedgeRequest = CreateHttpRequest(uri, method, request.GetResponseStreamFactory());
+                if (prepareAttempt(hedgeRequest))
+                {
+                    AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Attempt still running after " << hedgeDelay.count() << " ms, sending a second one.");
+                    startAttempt(hedgeRequest);
+                }
+            }
+            locker.lock();
+        }
+    }
+
+    attempts->abandoned = true;
+    // an attempt cancelled on the deadline may have finished before this thread woke up to it.
+    if (!attempts->finished || (DoesResponseGenerateError(attempts->httpResponse) && std::chrono::steady_clock::now() >= deadline))
+    {
+        AWS_LOGSTREAM_WARN(AWS_CLIENT_LOG_TAG, "Request did not complete before its deadline.");
+        // the attempt given up on still uses its request.
+        httpRequest = CreateHttpRequest(uri, method, request.GetResponseStreamFactory());
+        return HttpResponseOutcome(AWSError<CoreErrors>(CoreErrors::REQUEST_TIMEOUT, "", "Request did not complete before its deadline", false));
+    }
+
+    httpRequest = attempts->httpRequest;
+    std::shared_ptr<HttpResponse> httpResponse = attempts->httpResponse;
+    auto latency = attempts->latency;
+    locker.unlock();
+
+    if (DoesResponseGenerateError(httpResponse))
+    {
+        AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
+        return HttpResponseOutcome(BuildAWSError(httpResponse));
+    }
+
+    if (request.IsHedgingEnabled())
+    {
+        m_latencyTracker->AddSample(request.GetServiceRequestName(), latency);
+    }
+    AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned successful response.");
+    return HttpResponseOutcome(httpResponse);
+}
+
+std::chrono::milliseconds AWSClient::GetHedgeDelay(const Aws::AmazonWebServiceRequest& request) const
+{
+    std::chrono::milliseconds percentile(0);
+    if (!request.IsHedgingEnabled() || !m_latencyTracker->GetPercentile(request.GetServiceRequestName(), m_hedgingPercentile, percentile))
+    {
+        return std::chrono::milliseconds(0);
+    }
+    return (std::max)(percentile, m_hedgingMinDelay);
+}
+
 HttpResponseOutcome AWSClient::AttemptOneRequest(const std::shared_ptr<HttpRequest>& httpRequest,
     const Aws::AmazonWebServiceRequest& request, const char* signerName) const
 {
@@ -345,29 +907,25 @@ StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::Http::URI& u
     Http::HttpMethod method,
     const char* signerName) const
 {
-    HttpResponseOutcome httpResponseOutcome = AttemptExhaustively(uri, request, method, signerName);
-    if (httpResponseOutcome.IsSuccess())
-    {
-        return StreamOutcome(AmazonWebServiceResult<Stream::ResponseStream>(
-            httpResponseOutcome.GetResult()->SwapResponseStreamOwnership(),
-            httpResponseOutcome.GetResult()->GetHeaders(), httpResponseOutcome.GetResult()->GetResponseCode()));
-    }
-
-    return StreamOutcome(httpResponseOutcome.GetError());
+    return BuildStreamOutcome(AttemptExhaustively(uri, request, method, signerName));
 }
 
 StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::Http::URI& uri, Http::HttpMethod method, 
         const char* signerName, const char* requestName) const
 {
-    HttpResponseOutcome httpResponseOutcome = AttemptExhaustively(uri, method, signerName, requestName);
-    if (httpResponseOutcome.IsSuccess())
+    return BuildStreamOutcome(AttemptExhaustively(uri, method, signerName, requestName));
+}
+
+StreamOutcome AWSClient::BuildStreamOutcome(const HttpResponseOutcome& httpOutcome) const
+{
+    if (httpOutcome.IsSuccess())
     {
         return StreamOutcome(AmazonWebServiceResult<Stream::ResponseStream>(
-            httpResponseOutcome.GetResult()->SwapResponseStreamOwnership(),
-            httpResponseOutcome.GetResult()->GetHeaders(), httpResponseOutcome.GetResult()->GetResponseCode()));
+            httpOutcome.GetResult()->SwapResponseStreamOwnership(),
+            httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
     }
 
-    return StreamOutcome(httpResponseOutcome.GetError());
+    return StreamOutcome(httpOutcome.GetError());
 }
 
 XmlOutcome AWSXMLClient::MakeRequestWithEventStream(const Aws::Http::URI& uri,
@@ -472,6 +1030,10 @@ void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
     httpRequest->SetDataReceivedEventHandler(request.GetDataReceivedEventHandler());
     httpRequest->SetDataSentEventHandler(request.GetDataSentEventHandler());
     httpRequest->SetContinueRequestHandle(request.GetContinueRequestHandler());
+    httpRequest->SetResponseBodyBuffers(request.GetResponseBodyBuffers());
+    httpRequest->SetRequestBodyHashes(request.GetRequestBodyHashes());
+    httpRequest->SetResponseBodyHashes(request.GetResponseBodyHashes());
+    httpRequest->SetChunkedPayloadSigningSupported(m_httpClient->SupportsChunkedPayloadSigning());
 
     request.AddQueryStringParameters(httpRequest->GetUri());
 }
@@ -611,20 +1173,7 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
     Http::HttpMethod method,
     const char* signerName) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName));
-    if (!httpOutcome.IsSuccess())
-    {
-        return JsonOutcome(httpOutcome.GetError());
-    }
-
-    if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
-        //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(httpOutcome.GetResult()->GetResponseBody()),
-        httpOutcome.GetResult()->GetHeaders(),
-        httpOutcome.GetResult()->GetResponseCode()));
-
-    else
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
+    return BuildJsonOutcome(BASECLASS::AttemptExhaustively(uri, request, method, signerName));
 }
 
 JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
@@ -632,7 +1181,11 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
     const char* signerName,
     const char* requestName) const
 {
-    HttpResponseOutcome httpOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName));
+    return BuildJsonOutcome(BASECLASS::AttemptExhaustively(uri, method, signerName, requestName));
+}
+
+JsonOutcome AWSJsonClient::BuildJsonOutcome(const HttpResponseOutcome& httpOutcome) const
+{
     if (!httpOutcome.IsSuccess())
     {
         return JsonOutcome(httpOutcome.GetError());
@@ -0,0 +1,59 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/AdaptiveRetryStrategy.h>
+
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+using namespace Aws::Client;
+
+static const char ADAPTIVE_RETRY_STRATEGY_ALLOCATION_TAG[] = "AdaptiveRetryStrategy";
+
+AdaptiveRetryStrategy::AdaptiveRetryStrategy(long maxRetries, long scaleFactor, long maxBackoff) :
+    AdaptiveRetryStrategy(Aws::MakeShared<RetryQuotaContainer>(ADAPTIVE_RETRY_STRATEGY_ALLOCATION_TAG),
+        Aws::MakeShared<SendRateLimiter>(ADAPTIVE_RETRY_STRATEGY_ALLOCATION_TAG), maxRetries, scaleFactor, maxBackoff)
+{
+}
+
+AdaptiveRetryStrategy::AdaptiveRetryStrategy(const std::shared_ptr<RetryQuotaContainer>& retryQuotaContainer,
+    const std::shared_ptr<SendRateLimiter>& sendRateLimiter, long maxRetries, long scaleFactor, long maxBackoff) :
+    StandardRetryStrategy(retryQuotaContainer, maxRetries, scaleFactor, maxBackoff),
+    m_sendRateLimiter(sendRateLimiter)
+{
+}
+
+long AdaptiveRetryStrategy::AcquireSendToken()
+{
+    return m_sendRateLimiter->AcquireToken();
+}
+
+void AdaptiveRetryStrategy::RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome)
+{
+    StandardRetryStrategy::RequestBookkeeping(httpResponseOutcome);
+    UpdateSendingRate(httpResponseOutcome);
+}
+
+void AdaptiveRetryStrategy::RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome, const AWSError<CoreErrors>& lastError)
+{
+    StandardRetryStrategy::RequestBookkeeping(httpResponseOutcome, lastError);
+    UpdateSendingRate(httpResponseOutcome);
+}
+
+void AdaptiveRetryStrategy::UpdateSendingRate(const HttpResponseOutcome& httpResponseOutcome)
+{
+    m_sendRateLimiter->UpdateSendingRate(!httpResponseOutcome.IsSuccess() && CoreErrorsMapper::IsThrottlingError(httpResponseOutcome.GetError()));
+}
@@ -56,9 +56,13 @@ ClientConfiguration::ClientConfiguration() :
     writeRateLimiter(nullptr),
     readRateLimiter(nullptr),
     httpLibOverride(Aws::Http::TransferLibType::DEFAULT_CLIENT),
+    curlMultiIoThreads(1),
+    enableHttp2(false),
     followRedirects(true),
     disableExpectHeader(false),
     enableClockSkewAdjustment(true),
+    hedgingPercentile(95.0),
+    hedgingMinDelayMs(10),
     enableHostPrefixInjection(true),
     enableEndpointDiscovery(false)
 {
@@ -217,3 +217,40 @@ AWS_CORE_API AWSError<CoreErrors> CoreErrorsMapper::GetErrorForHttpResponseCode(
             return AWSError<CoreErrors>(CoreErrors::UNKNOWN, codeValue >= 500 && codeValue < 600);
     }
 }
+
+// services whose throttling errors aren't mapped to CoreErrors::THROTTLING or CoreErrors::SLOW_DOWN
+static const char* const SERVICE_THROTTLING_ERROR_NAMES[] =
+{
+    "ThrottlingException",
+    "ThrottledException",
+    "RequestThrottledException",
+    "TooManyRequestsException",
+    "ProvisionedThroughputExceededException",
+    "TransactionInProgressException",
+    "RequestLimitExceeded",
+    "BandwidthLimitExceeded",
+    "LimitExceededException",
+    "RequestThrottled",
+    "SlowDown",
+    "PriorRequestNotComplete",
+    "EC2ThrottledException"
+};
+
+AWS_CORE_API bool CoreErrorsMapper::IsThrottlingError(const AWSError<CoreErrors>& error)
+{
+    if (error.GetErrorType() == CoreErrors::THROTTLING || error.GetErrorType() == CoreErrors::SLOW_DOWN ||
+        error.GetResponseCode() == HttpResponseCode::TOO_MANY_REQUESTS)
+    {
+        return true;
+    }
+
+    const Aws::String& exceptionName = error.GetExceptionName();
+    for (const char* name : SERVICE_THROTTLING_ERROR_NAMES)
+    {
+        if (exceptionName == name)
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,58 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/RequestLatencyTracker.h>
+
+#include <algorithm>
+
+using namespace Aws::Client;
+
+const size_t RequestLatencyTracker::WINDOW_SIZE;
+const size_t RequestLatencyTracker::MIN_SAMPLES;
+
+void RequestLatencyTracker::AddSample(const char* operationName, std::chrono::milliseconds latency)
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    Window& window = m_windows[operationName];
+    if (window.samples.size() < WINDOW_SIZE)
+    {
+        window.samples.push_back(latency.count());
+    }
+    else
+    {
+        window.samples[window.next] = latency.count();
+        window.next = (window.next + 1) % WINDOW_SIZE;
+    }
+}
+
+bool RequestLatencyTracker::GetPercentile(const char* operationName, double percentile, std::chrono::milliseconds& value) const
+{
+    Aws::Vector<long long> samples;
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        auto window = m_windows.find(operationName);
+        if (window == m_windows.end() || window->second.samples.size() < MIN_SAMPLES)
+        {
+            return false;
+        }
+        samples = window->second.samples;
+    }
+
+    percentile = (std::min)((std::max)(percentile, 0.0), 100.0);
+    size_t rank = (std::min)(static_cast<size_t>(percentile / 100.0 * samples.size()), samples.size() - 1);
+    std::nth_element(samples.begin(), samples.begin() + rank, samples.end());
+    value = std::chrono::milliseconds(samples[rank]);
+    return true;
+}
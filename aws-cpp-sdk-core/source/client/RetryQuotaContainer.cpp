@@ -0,0 +1,69 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/RetryQuotaContainer.h>
+
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+
+#include <algorithm>
+
+using namespace Aws::Client;
+
+const int RetryQuotaContainer::DEFAULT_RETRY_QUOTA;
+const int RetryQuotaContainer::RETRY_COST;
+const int RetryQuotaContainer::TIMEOUT_RETRY_COST;
+const int RetryQuotaContainer::NO_RETRY_INCREMENT;
+
+RetryQuotaContainer::RetryQuotaContainer(int maxRetryQuota) :
+    m_maxRetryQuota(maxRetryQuota),
+    m_retryQuota(maxRetryQuota)
+{
+}
+
+bool RetryQuotaContainer::AcquireRetryQuota(const AWSError<CoreErrors>& error)
+{
+    int cost = GetRetryCost(error);
+    std::lock_guard<std::mutex> locker(m_lock);
+    if (cost > m_retryQuota)
+    {
+        return false;
+    }
+    m_retryQuota -= cost;
+    return true;
+}
+
+void RetryQuotaContainer::ReleaseRetryQuota(const AWSError<CoreErrors>& error)
+{
+    ReleaseRetryQuota(GetRetryCost(error));
+}
+
+void RetryQuotaContainer::ReleaseRetryQuota(int capacity)
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    m_retryQuota = (std::min)(m_retryQuota + capacity, m_maxRetryQuota);
+}
+
+int RetryQuotaContainer::GetRetryQuota() const
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    return m_retryQuota;
+}
+
+int RetryQuotaContainer::GetRetryCost(const AWSError<CoreErrors>& error)
+{
+    return error.GetErrorType() == CoreErrors::REQUEST_TIMEOUT || error.GetErrorType() == CoreErrors::NETWORK_CONNECTION ?
+        TIMEOUT_RETRY_COST : RETRY_COST;
+}
@@ -0,0 +1,165 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/SendRateLimiter.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Aws::Client;
+
+const double SendRateLimiter::MIN_FILL_RATE = 0.5;
+const double SendRateLimiter::MIN_CAPACITY = 1.0;
+// weight of the last half second in the measured rate.
+const double SendRateLimiter::SMOOTH = 0.8;
+// factor the rate is cut by on throttling.
+const double SendRateLimiter::BETA = 0.7;
+// how fast the rate grows back.
+const double SendRateLimiter::SCALE_CONSTANT = 0.4;
+
+SendRateLimiter::SendRateLimiter(TimeFunctionType timeFunction) :
+    m_timeFunction(timeFunction),
+    m_start(timeFunction()),
+    m_enabled(false),
+    m_fillRate(0.0),
+    m_maxCapacity(0.0),
+    m_currentCapacity(0.0),
+    m_lastTimestamp(0.0),
+    m_hasLastTimestamp(false),
+    m_measuredTxRate(0.0),
+    m_lastTxRateBucket(0.0),
+    m_requestCount(0),
+    m_lastMaxRate(0.0),
+    m_lastThrottleTime(0.0),
+    m_timeWindow(0.0)
+{
+}
+
+long SendRateLimiter::AcquireToken()
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    if (!m_enabled)
+    {
+        return 0;
+    }
+
+    Refill(Now());
+    if (m_currentCapacity >= 1.0)
+    {
+        m_currentCapacity -= 1.0;
+        return 0;
+    }
+    return (std::max)(1L, static_cast<long>(std::ceil((1.0 - m_currentCapacity) / m_fillRate * 1000.0)));
+}
+
+void SendRateLimiter::UpdateSendingRate(bool isThrottlingResponse)
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    double now = Now();
+    UpdateMeasuredRate(now);
+
+    double calculatedRate;
+    if (isThrottlingResponse)
+    {
+        double rateToUse = m_enabled ? (std::min)(m_measuredTxRate, m_fillRate) : m_measuredTxRate;
+        m_lastMaxRate = rateToUse;
+        CalculateTimeWindow();
+        m_lastThrottleTime = now;
+        calculatedRate = CubicThrottle(rateToUse);
+        m_enabled = true;
+    }
+    else
+    {
+        CalculateTimeWindow();
+        calculatedRate = CubicSuccess(now);
+    }
+
+    UpdateRate(now, (std::min)(calculatedRate, 2.0 * m_measuredTxRate));
+}
+
+bool SendRateLimiter::IsEnabled() const
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    return m_enabled;
+}
+
+double SendRateLimiter::GetFillRate() const
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    return m_fillRate;
+}
+
+double SendRateLimiter::GetMeasuredSendRate() const
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    return m_measuredTxRate;
+}
+
+double SendRateLimiter::Now() const
+{
+    return std::chrono::duration<double>(m_timeFunction() - m_start).count();
+}
+
+void SendRateLimiter::Refill(double now)
+{
+    if (!m_hasLastTimestamp)
+    {
+        m_lastTimestamp = now;
+        m_hasLastTimestamp = true;
+        return;
+    }
+
+    m_currentCapacity = (std::min)(m_maxCapacity, m_currentCapacity + (now - m_lastTimestamp) * m_fillRate);
+    m_lastTimestamp = now;
+}
+
+void SendRateLimiter::UpdateRate(double now, double newRate)
+{
+    Refill(now);
+    m_fillRate = (std::max)(newRate, MIN_FILL_RATE);
+    m_maxCapacity = (std::max)(newRate, MIN_CAPACITY);
+    m_currentCapacity = (std::min)(m_currentCapacity, m_maxCapacity);
+}
+
+// the rate responses come in at, measured over half second buckets.
+void SendRateLimiter::UpdateMeasuredRate(double now)
+{
+    double timeBucket = std::floor(now * 2.0) / 2.0;
+    m_requestCount++;
+    if (timeBucket > m_lastTxRateBucket)
+    {
+        double currentRate = m_requestCount / (timeBucket - m_lastTxRateBucket);
+        m_measuredTxRate = currentRate * SMOOTH + m_measuredTxRate * (1.0 - SMOOTH);
+        m_requestCount = 0;
+        m_lastTxRateBucket = timeBucket;
+    }
+}
+
+// time the cubic curve takes to get back to the rate throttled at.
+void SendRateLimiter::CalculateTimeWindow()
+{
+    m_timeWindow = std::cbrt(m_lastMaxRate * (1.0 - BETA) / SCALE_CONSTANT);
+}
+
+double SendRateLimiter::CubicSuccess(double now) const
+{
+    double dt = now - m_lastThrottleTime;
+    return SCALE_CONSTANT * std::pow(dt - m_timeWindow, 3.0) + m_lastMaxRate;
+}
+
+double SendRateLimiter::CubicThrottle(double rateToUse) const
+{
+    return rateToUse * BETA;
+}
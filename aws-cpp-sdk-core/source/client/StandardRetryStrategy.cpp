@@ -0,0 +1,88 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  * 
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  * 
+  *  http://aws.amazon.com/apache2.0
+  * 
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/client/StandardRetryStrategy.h>
+
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/utils/UnreferencedParam.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <algorithm>
+
+using namespace Aws::Client;
+
+static const char STANDARD_RETRY_STRATEGY_ALLOCATION_TAG[] = "StandardRetryStrategy";
+
+const long StandardRetryStrategy::DEFAULT_MAX_RETRIES;
+const long StandardRetryStrategy::DEFAULT_SCALE_FACTOR;
+const long StandardRetryStrategy::DEFAULT_MAX_BACKOFF;
+
+StandardRetryStrategy::StandardRetryStrategy(long maxRetries, long scaleFactor, long maxBackoff) :
+    StandardRetryStrategy(Aws::MakeShared<RetryQuotaContainer>(STANDARD_RETRY_STRATEGY_ALLOCATION_TAG), maxRetries, scaleFactor, maxBackoff)
+{
+}
+
+StandardRetryStrategy::StandardRetryStrategy(const std::shared_ptr<RetryQuotaContainer>& retryQuotaContainer, long maxRetries,
+    long scaleFactor, long maxBackoff) :
+    m_retryQuotaContainer(retryQuotaContainer),
+    m_maxRetries(maxRetries),
+    m_scaleFactor(scaleFactor),
+    m_maxBackoff(maxBackoff),
+    m_random(std::random_device()())
+{
+}
+
+bool StandardRetryStrategy::ShouldRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const
+{
+    if (attemptedRetries >= m_maxRetries || !error.ShouldRetry())
+    {
+        return false;
+    }
+
+    return m_retryQuotaContainer->AcquireRetryQuota(error);
+}
+
+long StandardRetryStrategy::CalculateDelayBeforeNextRetry(const AWSError<CoreErrors>& error, long attemptedRetries) const
+{
+    AWS_UNREFERENCED_PARAM(error);
+
+    // past 2^20 times the scale factor, the limit is the max backoff for any sensible settings anyway.
+    long exponent = (std::min)(attemptedRetries, 20L);
+    long long limit = (std::min)(static_cast<long long>(m_scaleFactor) << exponent, static_cast<long long>(m_maxBackoff));
+    if (limit <= 0)
+    {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> locker(m_randomLock);
+    return static_cast<long>(std::uniform_int_distribution<long long>(0, limit)(m_random));
+}
+
+void StandardRetryStrategy::RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome)
+{
+    if (httpResponseOutcome.IsSuccess())
+    {
+        m_retryQuotaContainer->ReleaseRetryQuota(RetryQuotaContainer::NO_RETRY_INCREMENT);
+    }
+}
+
+void StandardRetryStrategy::RequestBookkeeping(const HttpResponseOutcome& httpResponseOutcome, const AWSError<CoreErrors>& lastError)
+{
+    if (httpResponseOutcome.IsSuccess())
+    {
+        m_retryQuotaContainer->ReleaseRetryQuota(lastError);
+    }
+}
@@ -340,8 +340,15 @@ namespace Aws
 
             auto region = m_ec2metadataClient->GetCurrentRegion();
 
+            AWSCredentials credentials(accessKey, secretKey, token);
+            DateTime expiration(credentialsView.GetString("Expiration"), DateFormat::ISO_8601);
+            if (expiration.WasParseSuccessful())
+            {
+                credentials.SetExpiration(expiration);
+            }
+
             Profile profile;
-            profile.SetCredentials(AWSCredentials(accessKey, secretKey, token));
+            profile.SetCredentials(credentials);
             profile.SetRegion(region);
             profile.SetName(INSTANCE_PROFILE_KEY);
 
@@ -15,6 +15,7 @@
 
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
 
 using namespace Aws;
 using namespace Aws::Http;
@@ -26,6 +27,17 @@ HttpClient::HttpClient() :
 {
 }
 
+void HttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpResponseHandler& handler,
+    Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+    Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    std::shared_ptr<HttpResponse> response = MakeRequest(request, readLimiter, writeLimiter);
+    if (handler)
+    {
+        handler(request, response);
+    }
+}
+
 void HttpClient::DisableRequestProcessing() 
 { 
     m_disableRequestProcessing = true;
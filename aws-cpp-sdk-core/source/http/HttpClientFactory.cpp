@@ -17,6 +17,7 @@
 
 #if ENABLE_CURL_CLIENT
 #include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
 #include <signal.h>
 
 #elif ENABLE_WINDOWS_CLIENT
@@ -100,6 +101,17 @@ namespace Aws
                 }
 #endif // ENABLE_WINDOWS_IXML_HTTP_REQUEST_2_CLIENT
 #elif ENABLE_CURL_CLIENT
+                // Only transfers driven by the same multi handle can share an h2 connection, so h2 takes the multi client by default.
+                if (clientConfiguration.httpLibOverride == TransferLibType::CURL_MULTI_CLIENT ||
+                    (clientConfiguration.httpLibOverride == TransferLibType::DEFAULT_CLIENT && clientConfiguration.enableHttp2))
+                {
+#if defined(__linux__)
+                    AWS_LOGSTREAM_INFO(HTTP_CLIENT_FACTORY_ALLOCATION_TAG, "Creating curl multi http client.");
+                    return Aws::MakeShared<CurlMultiHttpClient>(HTTP_CLIENT_FACTORY_ALLOCATION_TAG, clientConfiguration);
+#else
+                    AWS_LOGSTREAM_WARN(HTTP_CLIENT_FACTORY_ALLOCATION_TAG, "Curl multi http client is only supported on Linux, falling back to the curl http client.");
+#endif
+                }
                 return Aws::MakeShared<CurlHttpClient>(HTTP_CLIENT_FACTORY_ALLOCATION_TAG, clientConfiguration);
 #else
                 // When neither of these clients is enabled, gcc gives a warning (converted
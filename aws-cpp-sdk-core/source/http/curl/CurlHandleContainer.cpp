@@ -14,97 +14,298 @@
   */
 
 #include <aws/core/http/curl/CurlHandleContainer.h>
+#include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/UnreferencedParam.h>
 
 #include <algorithm>
+#include <chrono>
 
+using namespace Aws::Utils;
 using namespace Aws::Utils::Logging;
 using namespace Aws::Http;
 
 static const char* CURL_HANDLE_CONTAINER_TAG = "CurlHandleContainer";
+// Handles released without a host are parked under this key and handed out to anyone.
+static const Aws::String NO_HOST_KEY;
 
 
-CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout, long connectTimeout, bool enableTcpKeepAlive, unsigned long tcpKeepAliveIntervalMs, unsigned long lowSpeedLimit) :
+CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout, long connectTimeout, bool enableTcpKeepAlive, unsigned long tcpKeepAliveIntervalMs, unsigned long lowSpeedLimit,
+                bool shareSessions) :
                 m_maxPoolSize(maxSize), m_requestTimeout(requestTimeout), m_connectTimeout(connectTimeout),
-                m_enableTcpKeepAlive(enableTcpKeepAlive), m_tcpKeepAliveIntervalMs(tcpKeepAliveIntervalMs), m_lowSpeedLimit(lowSpeedLimit), m_poolSize(0)
+                m_enableTcpKeepAlive(enableTcpKeepAlive), m_tcpKeepAliveIntervalMs(tcpKeepAliveIntervalMs), m_lowSpeedLimit(lowSpeedLimit),
+                m_poolSize(0), m_idleCount(0), m_waiters(0), m_hits(0), m_misses(0), m_waits(0), m_waitTimeMs(0), m_resets(0),
+                m_share(nullptr)
 {
     AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Initializing CurlHandleContainer with size " << maxSize);
+    if (shareSessions)
+    {
+        m_share = curl_share_init();
+        if (m_share)
+        {
+            curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, &CurlHandleContainer::LockShare);
+            curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, &CurlHandleContainer::UnlockShare);
+            curl_share_setopt(m_share, CURLSHOPT_USERDATA, this);
+            curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+            curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        }
+        else
+        {
+            AWS_LOGSTREAM_WARN(CURL_HANDLE_CONTAINER_TAG, "curl_share_init failed, handles will keep DNS and tls sessions to themselves.");
+        }
+    }
 }
 
 CurlHandleContainer::~CurlHandleContainer()
 {
     AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Cleaning up CurlHandleContainer.");
-    for (CURL* handle : m_handleContainer.ShutdownAndWait(m_poolSize))
     {
-        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Cleaning up " << handle);
-        curl_easy_cleanup(handle);
+        //wait for all acquired handles to be released.
+        std::unique_lock<std::mutex> locker(m_waitLock);
+        ++m_waiters;
+        m_waitSignal.wait(locker, [this]() { return m_idleCount.load() == m_poolSize.load(); });
+        --m_waiters;
+    }
+
+    for (auto& shard : m_shards)
+    {
+        std::lock_guard<std::mutex> locker(shard.shardLock);
+        for (auto& hostHandles : shard.idleHandles)
+        {
+            for (CURL* handle : hostHandles.second)
+            {
+                AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Cleaning up " << handle);
+                curl_easy_cleanup(handle);
+            }
+        }
+        shard.idleHandles.clear();
+    }
+
+    // only once no handle uses it any more.
+    if (m_share)
+    {
+        curl_share_cleanup(m_share);
     }
 }
 
+void CurlHandleContainer::LockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr)
+{
+    AWS_UNREFERENCED_PARAM(handle);
+    AWS_UNREFERENCED_PARAM(access);
+    CurlHandleContainer* container = reinterpret_cast<CurlHandleContainer*>(userptr);
+    container->m_shareLocks[data].lock();
+}
+
+void CurlHandleContainer::UnlockShare(CURL* handle, curl_lock_data data, void* userptr)
+{
+    AWS_UNREFERENCED_PARAM(handle);
+    CurlHandleContainer* container = reinterpret_cast<CurlHandleContainer*>(userptr);
+    container->m_shareLocks[data].unlock();
+}
+
 CURL* CurlHandleContainer::AcquireCurlHandle()
 {
-    AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Attempting to acquire curl connection.");
+    return AcquireCurlHandle(NO_HOST_KEY);
+}
+
+CURL* CurlHandleContainer::AcquireCurlHandle(const Aws::String& hostKey)
+{
+    AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Attempting to acquire curl connection for " << hostKey);
+
+    size_t homeShard = GetShardIndex(hostKey);
+    CURL* handle = nullptr;
+    std::chrono::steady_clock::time_point waitStart;
+    bool waited = false;
+    while (!handle)
+    {
+        handle = hostKey.empty() ? nullptr : TryAcquireFromShard(homeShard, &hostKey, hostKey);
+        if (handle)
+        {
+            ++m_hits;
+            break;
+        }
+
+        // A fresh handle leaves the warm connections of other hosts alone, so prefer it while the pool can still grow.
+        if (!hostKey.empty())
+        {
+            handle = TryCreateHandle();
+            if (handle)
+            {
+                ++m_misses;
+                break;
+            }
+        }
+
+        // Any idle handle will do, starting with our own shard.
+        for (size_t i = 0; i < SHARD_COUNT && !handle; ++i)
+        {
+            handle = TryAcquireFromShard((homeShard + i) % SHARD_COUNT, nullptr, hostKey);
+        }
+
+        if (handle)
+        {
+            // Without a host preference every idle handle is as good as any other.
+            if (hostKey.empty())
+            {
+                ++m_hits;
+            }
+            else
+            {
+                ++m_misses;
+            }
+            break;
+        }
+
+        if (hostKey.empty())
+        {
+            handle = TryCreateHandle();
+            if (handle)
+            {
+                ++m_misses;
+                break;
+            }
+        }
+
+        if (m_poolSize.load() == 0)
+        {
+            AWS_LOGSTREAM_ERROR(CURL_HANDLE_CONTAINER_TAG, "Unable to create any curl handle.");
+            return nullptr;
+        }
+
+        if (!waited)
+        {
+            AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Pool is at max size and every handle is in use. Waiting for one to be released.");
+            waited = true;
+            waitStart = std::chrono::steady_clock::now();
+            ++m_waits;
+        }
 
-    if(!m_handleContainer.HasResourcesAvailable())
+        std::unique_lock<std::mutex> locker(m_waitLock);
+        ++m_waiters;
+        m_waitSignal.wait(locker, [this]() { return m_idleCount.load() > 0 || m_poolSize.load() < m_maxPoolSize; });
+        --m_waiters;
+    }
+
+    if (waited)
     {
-        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "No current connections available in pool. Attempting to create new connections.");
-        CheckAndGrowPool();
+        m_waitTimeMs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - waitStart).count());
+        AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Connection has been released. Continuing.");
     }
 
-    CURL* handle = m_handleContainer.Acquire();
-    AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Connection has been released. Continuing.");
     AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Returning connection handle " << handle);
     return handle;
 }
 
 void CurlHandleContainer::ReleaseCurlHandle(CURL* handle)
+{
+    ReleaseCurlHandle(handle, NO_HOST_KEY);
+}
+
+void CurlHandleContainer::ReleaseCurlHandle(CURL* handle, const Aws::String& hostKey)
 {
     if (handle)
     {
-        curl_easy_reset(handle);
-        SetDefaultOptionsOnHandle(handle);
+        // Not reset here: the next request to the same host sets every option it uses anyway, see TryAcquireFromShard.
         AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Releasing curl handle " << handle);
-        m_handleContainer.Release(handle);
-        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Notified waiting threads.");
+
+        PoolShard& shard = m_shards[GetShardIndex(hostKey)];
+        {
+            std::lock_guard<std::mutex> locker(shard.shardLock);
+            shard.idleHandles[hostKey].push_back(handle);
+        }
+        ++m_idleCount;
+
+        // Only touch the wait lock when somebody is actually blocked on it.
+        if (m_waiters.load() > 0)
+        {
+            std::lock_guard<std::mutex> locker(m_waitLock);
+            m_waitSignal.notify_all();
+            AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "Notified waiting threads.");
+        }
     }
 }
 
-bool CurlHandleContainer::CheckAndGrowPool()
+CurlHandlePoolStats CurlHandleContainer::GetStats() const
+{
+    CurlHandlePoolStats stats;
+    stats.hits = m_hits.load();
+    stats.misses = m_misses.load();
+    stats.waits = m_waits.load();
+    stats.waitTimeMs = m_waitTimeMs.load();
+    stats.resets = m_resets.load();
+    stats.poolSize = m_poolSize.load();
+    return stats;
+}
+
+size_t CurlHandleContainer::GetShardIndex(const Aws::String& hostKey) const
+{
+    return static_cast<size_t>(static_cast<unsigned>(HashingUtils::HashString(hostKey.c_str()))) % SHARD_COUNT;
+}
+
+CURL* CurlHandleContainer::TryAcquireFromShard(size_t shardIndex, const Aws::String* hostKey, const Aws::String& acquiringHostKey)
 {
-    std::lock_guard<std::mutex> locker(m_containerLock);
-    if (m_poolSize < m_maxPoolSize)
+    PoolShard& shard = m_shards[shardIndex];
+    CURL* handle = nullptr;
+    bool evicted = false;
     {
-        unsigned multiplier = m_poolSize > 0 ? m_poolSize : 1;
-        unsigned amountToAdd = (std::min)(multiplier * 2, m_maxPoolSize - m_poolSize);
-        AWS_LOGSTREAM_DEBUG(CURL_HANDLE_CONTAINER_TAG, "attempting to grow pool size by " << amountToAdd);
+        std::lock_guard<std::mutex> locker(shard.shardLock);
 
-        unsigned actuallyAdded = 0;
-        for (unsigned i = 0; i < amountToAdd; ++i)
+        // hosts only have an entry while they have idle handles.
+        auto hostHandles = hostKey ? shard.idleHandles.find(*hostKey) : shard.idleHandles.begin();
+        if (hostHandles == shard.idleHandles.end())
         {
-            CURL* curlHandle = curl_easy_init();
-
-            if (curlHandle)
-            {
-                SetDefaultOptionsOnHandle(curlHandle);
-                m_handleContainer.Release(curlHandle);
-                ++actuallyAdded;
-            }
-            else
-            {
-                AWS_LOGSTREAM_ERROR(CURL_HANDLE_CONTAINER_TAG, "curl_easy_init failed to allocate.");
-                break;
-            }
+            return nullptr;
         }
 
-        AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Pool grown by " << actuallyAdded);
-        m_poolSize += actuallyAdded;
+        handle = hostHandles->second.back();
+        hostHandles->second.pop_back();
+        evicted = hostHandles->first != acquiringHostKey;
+        if (hostHandles->second.empty())
+        {
+            shard.idleHandles.erase(hostHandles);
+        }
+    }
+    --m_idleCount;
 
-        return actuallyAdded > 0;
+    if (evicted)
+    {
+        // The handle leaves the host it last talked to, so options left over from that host's requests go too.
+        // reset keeps the live connections and session caches of the handle, it only drops the options.
+        curl_easy_reset(handle);
+        SetDefaultOptionsOnHandle(handle);
+        ++m_resets;
     }
+    return handle;
+}
 
-    AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Pool cannot be grown any further, already at max size.");
+CURL* CurlHandleContainer::TryCreateHandle()
+{
+    unsigned poolSize = m_poolSize.load();
+    do
+    {
+        if (poolSize >= m_maxPoolSize)
+        {
+            return nullptr;
+        }
+    } while (!m_poolSize.compare_exchange_weak(poolSize, poolSize + 1));
 
-    return false;
+    CURL* curlHandle = curl_easy_init();
+    if (curlHandle)
+    {
+        SetDefaultOptionsOnHandle(curlHandle);
+        // curl_easy_reset leaves the share in place, so the handle keeps it for good.
+        if (m_share)
+        {
+            curl_easy_setopt(curlHandle, CURLOPT_SHARE, m_share);
+        }
+        AWS_LOGSTREAM_INFO(CURL_HANDLE_CONTAINER_TAG, "Pool grown by 1 to " << poolSize + 1);
+    }
+    else
+    {
+        AWS_LOGSTREAM_ERROR(CURL_HANDLE_CONTAINER_TAG, "curl_easy_init failed to allocate.");
+        --m_poolSize;
+    }
+    return curlHandle;
 }
 
 void CurlHandleContainer::SetDefaultOptionsOnHandle(CURL* handle)
@@ -14,14 +14,19 @@
   */
 
 #include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/auth/AWSChunkedPayloadSigner.h>
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
 #include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/monitoring/HttpClientMetrics.h>
 #include <cassert>
+#include <cstring>
 #include <algorithm>
 
 
@@ -130,41 +135,15 @@ static char* strdup_callback(const char* str)
 
 #endif
 
-struct CurlWriteCallbackContext
-{
-    CurlWriteCallbackContext(const CurlHttpClient* client,
-                             HttpRequest* request, 
-                             HttpResponse* response, 
-                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
-        m_client(client),
-        m_request(request),
-        m_response(response),
-        m_rateLimiter(rateLimiter),
-        m_numBytesResponseReceived(0)
-    {}
-
-    const CurlHttpClient* m_client;
-    HttpRequest* m_request;
-    HttpResponse* m_response;
-    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
-    int64_t m_numBytesResponseReceived;
-};
-
-struct CurlReadCallbackContext
-{
-    CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request, Aws::Utils::RateLimits::RateLimiterInterface* limiter) :
-        m_client(client),
-        m_rateLimiter(limiter),
-        m_request(request)
-    {}
-
-    const CurlHttpClient* m_client;
-    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
-    HttpRequest* m_request;
-};
-
 static const char* CURL_HTTP_CLIENT_TAG = "CurlHttpClient";
 
+// Easy handles keep their connections open between requests, so handing a handle back to the same endpoint reuses the connection.
+Aws::String CurlHttpClient::ComputeConnectionPoolKey(const HttpRequest& request)
+{
+    const URI& uri = request.GetUri();
+    return SchemeMapper::ToString(uri.GetScheme()) + Aws::String("://") + uri.GetAuthority() + ":" + StringUtils::to_string(uri.GetPort());
+}
+
 void SetOptCodeForHttpMethod(CURL* requestHandle, const HttpRequest& request)
 {
     switch (request.GetMethod())
@@ -294,33 +273,22 @@ int CurlDebugCallback(CURL *handle, curl_infotype type, char *data, size_t size,
 CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
     Base(),   
     m_curlHandleContainer(clientConfig.maxConnections, clientConfig.requestTimeoutMs, clientConfig.connectTimeoutMs,
-                          clientConfig.enableTcpKeepAlive, clientConfig.tcpKeepAliveIntervalMs, clientConfig.lowSpeedLimit),
+                          clientConfig.enableTcpKeepAlive, clientConfig.tcpKeepAliveIntervalMs, clientConfig.lowSpeedLimit, clientConfig.enableHttp2),
     m_isUsingProxy(!clientConfig.proxyHost.empty()), m_proxyUserName(clientConfig.proxyUserName),
     m_proxyPassword(clientConfig.proxyPassword), m_proxyScheme(SchemeMapper::ToString(clientConfig.proxyScheme)), m_proxyHost(clientConfig.proxyHost),
     m_proxyPort(clientConfig.proxyPort), m_verifySSL(clientConfig.verifySSL), m_caPath(clientConfig.caPath),
     m_caFile(clientConfig.caFile), 
     m_disableExpectHeader(clientConfig.disableExpectHeader),
-    m_allowRedirects(clientConfig.followRedirects)
+    m_allowRedirects(clientConfig.followRedirects),
+    m_enableHttp2(clientConfig.enableHttp2)
 {
 }
 
 
-void CurlHttpClient::MakeRequestInternal(HttpRequest& request, 
-        std::shared_ptr<StandardHttpResponse>& response,
-        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, 
-        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+struct curl_slist* CurlHttpClient::BuildHeaderList(const HttpRequest& request) const
 {
-    URI uri = request.GetUri();
-    Aws::String url = uri.GetURIString();
-
-    AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Making request to " << url);
     struct curl_slist* headers = NULL;
 
-    if (writeLimiter != nullptr)
-    {
-        writeLimiter->ApplyAndPayForCost(request.GetSize());
-    }
-
     Aws::StringStream headerStream;
     HeaderValueCollection requestHeaders = request.GetHeaders();
 
@@ -351,158 +319,277 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
         headers = curl_slist_append(headers, "Expect:");
     }
 
-    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
+    return headers;
+}
 
-    if (connectionHandle)
+void CurlHttpClient::ConfigureHandleForRequest(CURL* connectionHandle, HttpRequest& request, struct curl_slist* headers,
+        CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const
+{
+    if (headers)
     {
-        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Obtained connection handle " << connectionHandle);
-
-        if (headers)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
-        }
-
-        CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
-        CurlReadCallbackContext readContext(this, &request, writeLimiter);
-
-        SetOptCodeForHttpMethod(connectionHandle, request);
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
+    }
 
-        curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, &CurlHttpClient::WriteData);
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, &CurlHttpClient::WriteHeader);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, response.get());
+    // A handle reused for the same host still carries the method of its previous request: start over from a plain GET.
+    curl_easy_setopt(connectionHandle, CURLOPT_HTTPGET, 1L);
+    curl_easy_setopt(connectionHandle, CURLOPT_CUSTOMREQUEST, static_cast<char*>(nullptr));
+    SetOptCodeForHttpMethod(connectionHandle, request);
+
+    curl_easy_setopt(connectionHandle, CURLOPT_URL, request.GetURIString().c_str());
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, &CurlHttpClient::WriteData);
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, &CurlHttpClient::WriteHeader);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, writeContext.m_response);
+    // without it, a cancelled request would go on until the server sent or asked for more data.
+    curl_easy_setopt(connectionHandle, CURLOPT_NOPROGRESS, 0L);
+#if LIBCURL_VERSION_NUM >= 0x072000
+    curl_easy_setopt(connectionHandle, CURLOPT_XFERINFOFUNCTION, &CurlHttpClient::CheckTransferProgress);
+    curl_easy_setopt(connectionHandle, CURLOPT_XFERINFODATA, &writeContext);
+#else
+    curl_easy_setopt(connectionHandle, CURLOPT_PROGRESSFUNCTION, &CurlHttpClient::CheckTransferProgress);
+    curl_easy_setopt(connectionHandle, CURLOPT_PROGRESSDATA, &writeContext);
+#endif
 
-        //we only want to override the default path if someone has explicitly told us to.
-        if(!m_caPath.empty())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
-        }
-        if(!m_caFile.empty())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_CAINFO, m_caFile.c_str());
-        }
+    //we only want to override the default path if someone has explicitly told us to.
+    if(!m_caPath.empty())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
+    }
+    if(!m_caFile.empty())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_CAINFO, m_caFile.c_str());
+    }
 
-	// only set by android test builds because the emulator is missing a cert needed for aws services
+// only set by android test builds because the emulator is missing a cert needed for aws services
 #ifdef TEST_CERT_PATH
-	curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
+    curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
 #endif // TEST_CERT_PATH
 
-        if (m_verifySSL)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
+    if (m_verifySSL)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
 
 #if LIBCURL_VERSION_MAJOR >= 7
 #if LIBCURL_VERSION_MINOR >= 34
-            curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
 #endif //LIBCURL_VERSION_MINOR
 #endif //LIBCURL_VERSION_MAJOR
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
-        }
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
 
-        if (m_allowRedirects)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
-        }
-        //curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
-        //curl_easy_setopt(connectionHandle, CURLOPT_DEBUGFUNCTION, CurlDebugCallback);
+    if (m_allowRedirects)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
+    }
+    if (m_enableHttp2)
+    {
+#ifdef CURL_HTTP_VERSION_2TLS
+        // h2 is offered via ALPN on https only; plain http stays on HTTP/1.1.
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+#elif defined(CURL_HTTP_VERSION_2_0)
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_0);
+#endif
+#if LIBCURL_VERSION_NUM >= 0x072B00
+        // Rather wait for a connection that may turn out to multiplex than open a new one right away.
+        curl_easy_setopt(connectionHandle, CURLOPT_PIPEWAIT, 1L);
+#endif
+    }
+    else
+    {
+        // Newer libcurl negotiates h2 on its own; keep it opt-in.
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+    }
+    //curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
+    //curl_easy_setopt(connectionHandle, CURLOPT_DEBUGFUNCTION, CurlDebugCallback);
 
-        if (m_isUsingProxy)
-        {
-            Aws::StringStream ss;
-            ss << m_proxyScheme << "://" << m_proxyHost;
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, ss.str().c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, "");
-        }
+    if (m_isUsingProxy)
+    {
+        Aws::StringStream ss;
+        ss << m_proxyScheme << "://" << m_proxyHost;
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, ss.str().c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, "");
+    }
 
-        if (request.GetContentBody())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, &CurlHttpClient::ReadBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
-            curl_easy_setopt(connectionHandle, CURLOPT_SEEKFUNCTION, &CurlHttpClient::SeekBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_SEEKDATA, &readContext);
-        }
-        Aws::Utils::DateTime startTransmissionTime = Aws::Utils::DateTime::Now();
-        CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
-        bool shouldContinueRequest = ContinueRequest(request);
-        if (curlResponseCode != CURLE_OK && shouldContinueRequest)
-        {
-            response = nullptr;
-            AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Curl returned error code " << curlResponseCode
-                    << " - " << curl_easy_strerror(curlResponseCode));
-        }
-        else if(!shouldContinueRequest)
+    // set even without a body, so that no context of an earlier request is left on the handle.
+    curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, &CurlHttpClient::ReadBody);
+    curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
+    curl_easy_setopt(connectionHandle, CURLOPT_SEEKFUNCTION, &CurlHttpClient::SeekBody);
+    curl_easy_setopt(connectionHandle, CURLOPT_SEEKDATA, &readContext);
+}
+
+void CurlHttpClient::HandleTransferResult(CURL* connectionHandle, CURLcode curlResponseCode, HttpRequest& request,
+        std::shared_ptr<StandardHttpResponse>& response, const CurlWriteCallbackContext& writeContext) const
+{
+    bool shouldContinueRequest = ContinueRequest(request);
+    if (curlResponseCode != CURLE_OK && shouldContinueRequest)
+    {
+        response = nullptr;
+        AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Curl returned error code " << curlResponseCode
+                << " - " << curl_easy_strerror(curlResponseCode));
+    }
+    else if(!shouldContinueRequest)
+    {
+        response->SetResponseCode(HttpResponseCode::REQUEST_NOT_MADE);
+    }
+    else
+    {
+        long responseCode;
+        curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+        response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned http response code " << responseCode);
+
+        char* contentType = nullptr;
+        curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
+        if (contentType)
         {
-            response->SetResponseCode(HttpResponseCode::REQUEST_NOT_MADE);
+            response->SetContentType(contentType);
+            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned content type " << contentType);
         }
-        else
+
+        if (request.GetMethod() != HttpMethod::HTTP_HEAD &&
+            writeContext.m_client->IsRequestProcessingEnabled() &&
+            response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
         {
-            long responseCode;
-            curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
-            response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
-            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned http response code " << responseCode);
-
-            char* contentType = nullptr;
-            curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
-            if (contentType)
+            const Aws::String& contentLength = response->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER);
+            int64_t numBytesResponseReceived = writeContext.m_numBytesResponseReceived;
+            AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response content-length header: " << contentLength);
+            AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response body length: " << numBytesResponseReceived);
+            if (StringUtils::ConvertToInt64(contentLength.c_str()) != numBytesResponseReceived)
             {
-                response->SetContentType(contentType);
-                AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Returned content type " << contentType);
+                response = nullptr;
+                AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Response body length doesn't match the content-length header.");
             }
+        }
 
-            if (request.GetMethod() != HttpMethod::HTTP_HEAD &&
-                writeContext.m_client->IsRequestProcessingEnabled() &&
-                response->HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
-            {
-                const Aws::String& contentLength = response->GetHeader(Aws::Http::CONTENT_LENGTH_HEADER);
-                int64_t numBytesResponseReceived = writeContext.m_numBytesResponseReceived;
-                AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response content-length header: " << contentLength);
-                AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Response body length: " << numBytesResponseReceived);
-                if (StringUtils::ConvertToInt64(contentLength.c_str()) != numBytesResponseReceived)
-                {
-                    response = nullptr;
-                    AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Response body length doesn't match the content-length header.");
-                }
-            }
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Releasing curl handle " << connectionHandle);
+    }
 
-            AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Releasing curl handle " << connectionHandle);
-        }
+    double timep;
+    CURLcode ret = curl_easy_getinfo(connectionHandle, CURLINFO_NAMELOOKUP_TIME, &timep); // DNS Resolve Latency, seconds.
+    if (ret == CURLE_OK)
+    {
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency), static_cast<int64_t>(timep * 1000));// to milliseconds
+    }
 
-        double timep;
-        CURLcode ret = curl_easy_getinfo(connectionHandle, CURLINFO_NAMELOOKUP_TIME, &timep); // DNS Resolve Latency, seconds.
-        if (ret == CURLE_OK)
-        {
-            request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::DnsLatency), static_cast<int64_t>(timep * 1000));// to milliseconds
-        }
+    ret = curl_easy_getinfo(connectionHandle, CURLINFO_STARTTRANSFER_TIME, &timep); // Connect Latency 
+    if (ret == CURLE_OK)
+    {
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectLatency), static_cast<int64_t>(timep * 1000));
+    }
+
+    ret = curl_easy_getinfo(connectionHandle, CURLINFO_APPCONNECT_TIME, &timep); // Ssl Latency
+    if (ret == CURLE_OK)
+    {
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency), static_cast<int64_t>(timep * 1000));
+    }
+
+    ret = curl_easy_getinfo(connectionHandle, CURLINFO_CONNECT_TIME, &timep); // Tcp Latency
+    if (ret == CURLE_OK)
+    {
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::TcpLatency), static_cast<int64_t>(timep * 1000));
+    }
 
-        ret = curl_easy_getinfo(connectionHandle, CURLINFO_STARTTRANSFER_TIME, &timep); // Connect Latency 
-        if (ret == CURLE_OK)
+    long numConnects;
+    ret = curl_easy_getinfo(connectionHandle, CURLINFO_NUM_CONNECTS, &numConnects); // 0 if the request went over an existing connection or stream
+    if (ret == CURLE_OK)
+    {
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectionReused), numConnects == 0 ? 1 : 0);
+    }
+
+#if LIBCURL_VERSION_NUM >= 0x073200
+    long httpVersion;
+    ret = curl_easy_getinfo(connectionHandle, CURLINFO_HTTP_VERSION, &httpVersion);
+    if (ret == CURLE_OK && curlResponseCode == CURLE_OK)
+    {
+        int64_t version = 0;
+        switch (httpVersion)
         {
-            request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::ConnectLatency), static_cast<int64_t>(timep * 1000));
+            case CURL_HTTP_VERSION_1_0:
+                version = 10;
+                break;
+            case CURL_HTTP_VERSION_1_1:
+                version = 11;
+                break;
+            case CURL_HTTP_VERSION_2_0:
+                version = 20;
+                break;
+            default:
+                break;
         }
-
-        ret = curl_easy_getinfo(connectionHandle, CURLINFO_APPCONNECT_TIME, &timep); // Ssl Latency
-        if (ret == CURLE_OK)
+        if (version)
         {
-            request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::SslLatency), static_cast<int64_t>(timep * 1000));
+            request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::HttpVersion), version);
         }
+    }
+#endif
+}
+
+static void UpdateBodyHashes(const BodyHashList& hashes, const char* data, size_t length)
+{
+    for (const auto& hash : hashes)
+    {
+        hash->Update(reinterpret_cast<const unsigned char*>(data), length);
+    }
+}
+
+// GetHash() finishes whatever a previous attempt fed the hashes, so they start over with the body being sent again.
+static void ResetBodyHashes(const BodyHashList& hashes)
+{
+    for (const auto& hash : hashes)
+    {
+        hash->GetHash();
+    }
+}
+
+void CurlHttpClient::MakeRequestInternal(HttpRequest& request, 
+        std::shared_ptr<StandardHttpResponse>& response,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, 
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Making request to " << request.GetURIString());
+
+    if (writeLimiter != nullptr)
+    {
+        writeLimiter->ApplyAndPayForCost(request.GetSize());
+    }
+
+    ResetBodyHashes(request.GetRequestBodyHashes());
+    ResetBodyHashes(request.GetResponseBodyHashes());
+
+    struct curl_slist* headers = BuildHeaderList(request);
+
+    Aws::String connectionPoolKey = ComputeConnectionPoolKey(request);
+    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle(connectionPoolKey);
 
-        m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
+    if (connectionHandle)
+    {
+        AWS_LOGSTREAM_DEBUG(CURL_HTTP_CLIENT_TAG, "Obtained connection handle " << connectionHandle);
+
+        CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
+        CurlReadCallbackContext readContext(this, &request, writeLimiter);
+
+        ConfigureHandleForRequest(connectionHandle, request, headers, writeContext, readContext);
+
+        Aws::Utils::DateTime startTransmissionTime = Aws::Utils::DateTime::Now();
+        CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
+        HandleTransferResult(connectionHandle, curlResponseCode, request, response, writeContext);
+
+        m_curlHandleContainer.ReleaseCurlHandle(connectionHandle, connectionPoolKey);
         //go ahead and flush the response body stream
         if(response)
         {
@@ -517,6 +604,11 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
     }
 }
 
+CurlHandlePoolStats CurlHttpClient::GetConnectionPoolStats() const
+{
+    return m_curlHandleContainer.GetStats();
+}
+
 std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request, 
         Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
         Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
@@ -534,6 +626,32 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(const std::shared_ptr<
     return response;
 }
 
+// Copies straight from curl's receive buffer into the caller's buffers, continuing where the previous chunk left off.
+static bool CopyToResponseBodyBuffers(CurlWriteCallbackContext* context, const char* data, size_t length)
+{
+    const ResponseBodyBufferList& bodyBuffers = context->m_request->GetResponseBodyBuffers();
+    while (length > 0)
+    {
+        if (context->m_bodyBufferIndex >= bodyBuffers.size())
+        {
+            return false;
+        }
+
+        const ResponseBodyBuffer& bodyBuffer = bodyBuffers[context->m_bodyBufferIndex];
+        size_t toCopy = (std::min)(length, bodyBuffer.length - context->m_bodyBufferOffset);
+        memcpy(bodyBuffer.data + context->m_bodyBufferOffset, data, toCopy);
+        data += toCopy;
+        length -= toCopy;
+        context->m_bodyBufferOffset += toCopy;
+        if (context->m_bodyBufferOffset == bodyBuffer.length)
+        {
+            ++context->m_bodyBufferIndex;
+            context->m_bodyBufferOffset = 0;
+        }
+    }
+    return true;
+}
+
 size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
     if (ptr)
@@ -553,7 +671,21 @@ size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* use
             context->m_rateLimiter->ApplyAndPayForCost(static_cast<int64_t>(sizeToWrite));
         }
 
-        response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
+        // Only successful bodies go to the caller's buffers, error bodies are left in the stream for the error marshaller.
+        if (!context->m_request->GetResponseBodyBuffers().empty() && static_cast<int>(response->GetResponseCode()) / 100 == 2)
+        {
+            if (!CopyToResponseBodyBuffers(context, ptr, sizeToWrite))
+            {
+                AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Response body doesn't fit in the response body buffers of the request.");
+                return 0;
+            }
+            response->AddResponseBodyBufferedBytes(sizeToWrite);
+        }
+        else
+        {
+            response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
+        }
+        UpdateBodyHashes(context->m_request->GetResponseBodyHashes(), ptr, sizeToWrite);
         auto& receivedHandler = context->m_request->GetDataReceivedEventHandler();
         if (receivedHandler)
         {
@@ -567,6 +699,22 @@ size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* use
     return 0;
 }
 
+#if LIBCURL_VERSION_NUM >= 0x072000
+int CurlHttpClient::CheckTransferProgress(void* userdata, curl_off_t downloadTotal, curl_off_t downloaded, curl_off_t uploadTotal, curl_off_t uploaded)
+#else
+int CurlHttpClient::CheckTransferProgress(void* userdata, double downloadTotal, double downloaded, double uploadTotal, double uploaded)
+#endif
+{
+    AWS_UNREFERENCED_PARAM(downloadTotal);
+    AWS_UNREFERENCED_PARAM(downloaded);
+    AWS_UNREFERENCED_PARAM(uploadTotal);
+    AWS_UNREFERENCED_PARAM(uploaded);
+
+    CurlWriteCallbackContext* context = reinterpret_cast<CurlWriteCallbackContext*>(userdata);
+    const CurlHttpClient* client = context->m_client;
+    return client->ContinueRequest(*context->m_request) && client->IsRequestProcessingEnabled() ? 0 : 1;
+}
+
 size_t CurlHttpClient::WriteHeader(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
     if (ptr)
@@ -574,6 +722,18 @@ size_t CurlHttpClient::WriteHeader(char* ptr, size_t size, size_t nmemb, void* u
         AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, ptr);
         HttpResponse* response = (HttpResponse*) userdata;
         Aws::String headerLine(ptr);
+        // The body callback needs to know whether the body is an error before the transfer completes, so track the status line.
+        // With redirects or 100-continue the last status line seen is the one the body belongs to.
+        if (headerLine.compare(0, 5, "HTTP/") == 0)
+        {
+            Aws::Vector<Aws::String> statusLine = StringUtils::Split(headerLine, ' ');
+            if (statusLine.size() >= 2)
+            {
+                response->SetResponseCode(static_cast<HttpResponseCode>(StringUtils::ConvertToInt32(statusLine[1].c_str())));
+            }
+            return size * nmemb;
+        }
+
         Aws::Vector<Aws::String> keyValuePair = StringUtils::Split(headerLine, ':', 2);
 
         if (keyValuePair.size() == 2)
@@ -607,12 +767,32 @@ size_t CurlHttpClient::ReadBody(char* ptr, size_t size, size_t nmemb, void* user
     const size_t amountToRead = size * nmemb;
     if (ioStream != nullptr && amountToRead > 0)
     {
-        ioStream->read(ptr, amountToRead);
-        size_t amountRead = static_cast<size_t>(ioStream->gcount());
+        size_t amountRead = 0;
+        size_t payloadRead = 0;
+        const auto& chunkedPayloadSigner = request->GetChunkedPayloadSigner();
+        if (chunkedPayloadSigner)
+        {
+            // the body is hashed and signed chunk by chunk as curl asks for it, the handlers only see the body bytes.
+            const BodyHashList& bodyHashes = request->GetRequestBodyHashes();
+            amountRead = chunkedPayloadSigner->Read(*ioStream, ptr, amountToRead, payloadRead, bodyHashes.empty() ? nullptr : &bodyHashes);
+            if (chunkedPayloadSigner->HasFailed())
+            {
+                AWS_LOGSTREAM_ERROR(CURL_HTTP_CLIENT_TAG, "Failed to sign the request body while sending it, aborting request.");
+                return CURL_READFUNC_ABORT;
+            }
+        }
+        else
+        {
+            ioStream->read(ptr, amountToRead);
+            amountRead = static_cast<size_t>(ioStream->gcount());
+            payloadRead = amountRead;
+            UpdateBodyHashes(request->GetRequestBodyHashes(), ptr, amountRead);
+        }
+
         auto& sentHandler = request->GetDataSentEventHandler();
         if (sentHandler)
         {
-            sentHandler(request, static_cast<long long>(amountRead));
+            sentHandler(request, static_cast<long long>(payloadRead));
         }
 
         if (context->m_rateLimiter)
@@ -642,6 +822,10 @@ size_t CurlHttpClient::SeekBody(void* userdata, curl_off_t offset, int origin)
 
     HttpRequest* request = context->m_request;
     const std::shared_ptr<Aws::IOStream>& ioStream = request->GetContentBody();
+    if (!ioStream)
+    {
+        return CURL_SEEKFUNC_CANTSEEK;
+    }
 
     std::ios_base::seekdir dir;
     switch(origin)
@@ -659,6 +843,27 @@ size_t CurlHttpClient::SeekBody(void* userdata, curl_off_t offset, int origin)
             return CURL_SEEKFUNC_FAIL;
     }
 
+    const auto& chunkedPayloadSigner = request->GetChunkedPayloadSigner();
+    if (chunkedPayloadSigner)
+    {
+        // the encoded body can only be produced again from its start.
+        if (offset != 0 || dir != std::ios_base::beg)
+        {
+            return CURL_SEEKFUNC_CANTSEEK;
+        }
+        chunkedPayloadSigner->Reset();
+    }
+
+    if (!request->GetRequestBodyHashes().empty())
+    {
+        // the hashes can only start over, they can't follow the body to any other position.
+        if (offset != 0 || dir != std::ios_base::beg)
+        {
+            return CURL_SEEKFUNC_CANTSEEK;
+        }
+        ResetBodyHashes(request->GetRequestBodyHashes());
+    }
+
     ioStream->clear();
     ioStream->seekg(offset, dir);
     if (ioStream->fail()) {
@@ -0,0 +1,492 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+
+#if defined(__linux__)
+
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <errno.h>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+using namespace Aws::Monitoring;
+
+static const char* CURL_MULTI_HTTP_CLIENT_TAG = "CurlMultiHttpClient";
+static const int MAX_EPOLL_EVENTS = 64;
+
+namespace Aws
+{
+namespace Http
+{
+
+/**
+ * Everything that has to stay alive while curl owns the transfer.
+ */
+struct CurlMultiTransfer
+{
+    CurlMultiTransfer(const CurlHttpClient* client, const std::shared_ptr<HttpRequest>& request, const CurlMultiResponseHandler& handler,
+            Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) :
+        m_request(request),
+        m_response(Aws::MakeShared<StandardHttpResponse>(CURL_MULTI_HTTP_CLIENT_TAG, request)),
+        m_handler(handler),
+        m_connectionPoolKey(),
+        m_connectionHandle(nullptr),
+        m_headers(nullptr),
+        m_writeContext(client, request.get(), m_response.get(), readLimiter),
+        m_readContext(client, request.get(), writeLimiter)
+    {}
+
+    std::shared_ptr<HttpRequest> m_request;
+    std::shared_ptr<StandardHttpResponse> m_response;
+    CurlMultiResponseHandler m_handler;
+    Aws::String m_connectionPoolKey;
+    CURL* m_connectionHandle;
+    struct curl_slist* m_headers;
+    CurlWriteCallbackContext m_writeContext;
+    CurlReadCallbackContext m_readContext;
+    DateTime m_startTransmissionTime;
+};
+
+/**
+ * One multi handle driven by one thread. curl tells us which sockets to watch through the socket callback and when to
+ * wake up through the timer callback; new transfers are handed over through a queue and an eventfd.
+ */
+class CurlMultiEventLoop
+{
+public:
+    CurlMultiEventLoop(const CurlMultiHttpClient* client, long maxConnections, bool multiplexStreams) :
+        m_client(client),
+        m_multiHandle(curl_multi_init()),
+        m_epollFd(epoll_create1(EPOLL_CLOEXEC)),
+        m_wakeupFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+        m_hasTimer(false),
+        m_continue(true)
+    {
+        curl_multi_setopt(m_multiHandle, CURLMOPT_SOCKETFUNCTION, &CurlMultiEventLoop::SocketCallback);
+        curl_multi_setopt(m_multiHandle, CURLMOPT_SOCKETDATA, this);
+        curl_multi_setopt(m_multiHandle, CURLMOPT_TIMERFUNCTION, &CurlMultiEventLoop::TimerCallback);
+        curl_multi_setopt(m_multiHandle, CURLMOPT_TIMERDATA, this);
+        curl_multi_setopt(m_multiHandle, CURLMOPT_MAXCONNECTS, maxConnections);
+#ifdef CURLPIPE_MULTIPLEX
+        // Streams to the same endpoint share one connection once the server has agreed to h2.
+        curl_multi_setopt(m_multiHandle, CURLMOPT_PIPELINING, multiplexStreams ? CURLPIPE_MULTIPLEX : CURLPIPE_NOTHING);
+#else
+        AWS_UNREFERENCED_PARAM(multiplexStreams);
+#endif
+
+        struct epoll_event event;
+        event.events = EPOLLIN;
+        event.data.fd = m_wakeupFd;
+        epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_wakeupFd, &event);
+
+        m_thread = std::thread(&CurlMultiEventLoop::Run, this);
+    }
+
+    ~CurlMultiEventLoop()
+    {
+        m_continue = false;
+        Wakeup();
+        m_thread.join();
+
+        // Nothing drives curl any more, fail whatever is left.
+        for (CurlMultiTransfer* transfer : m_inFlight)
+        {
+            curl_multi_remove_handle(m_multiHandle, transfer->m_connectionHandle);
+            m_client->CompleteTransfer(transfer, CURLE_ABORTED_BY_CALLBACK);
+        }
+        m_inFlight.clear();
+
+        for (CurlMultiTransfer* transfer : m_pending)
+        {
+            m_client->CompleteTransfer(transfer, CURLE_ABORTED_BY_CALLBACK);
+        }
+        m_pending.clear();
+
+        curl_multi_cleanup(m_multiHandle);
+        close(m_wakeupFd);
+        close(m_epollFd);
+    }
+
+    std::thread::id GetThreadId() const
+    {
+        return m_thread.get_id();
+    }
+
+    void Submit(CurlMultiTransfer* transfer)
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_pendingLock);
+            m_pending.push_back(transfer);
+        }
+        Wakeup();
+    }
+
+private:
+    CurlMultiEventLoop(const CurlMultiEventLoop&) = delete;
+    CurlMultiEventLoop& operator=(const CurlMultiEventLoop&) = delete;
+
+    void Wakeup()
+    {
+        uint64_t one = 1;
+        ssize_t written = write(m_wakeupFd, &one, sizeof(one));
+        AWS_UNREFERENCED_PARAM(written);
+    }
+
+    void Run()
+    {
+        struct epoll_event events[MAX_EPOLL_EVENTS];
+        int runningHandles = 0;
+
+        while (m_continue)
+        {
+            int timeoutMs = -1;
+            if (m_hasTimer)
+            {
+                auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(m_timerDeadline - std::chrono::steady_clock::now()).count();
+                timeoutMs = remaining > 0 ? static_cast<int>(remaining) : 0;
+            }
+
+            int numEvents = epoll_wait(m_epollFd, events, MAX_EPOLL_EVENTS, timeoutMs);
+            if (numEvents < 0)
+            {
+                if (errno != EINTR)
+                {
+                    AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "epoll_wait failed with errno " << errno);
+                }
+                continue;
+            }
+
+            for (int i = 0; i < numEvents; ++i)
+            {
+                if (events[i].data.fd == m_wakeupFd)
+                {
+                    uint64_t count = 0;
+                    ssize_t bytesRead = read(m_wakeupFd, &count, sizeof(count));
+                    AWS_UNREFERENCED_PARAM(bytesRead);
+                    AddPendingTransfers();
+                    continue;
+                }
+
+                int actionMask = 0;
+                if (events[i].events & EPOLLIN)
+                {
+                    actionMask |= CURL_CSELECT_IN;
+                }
+                if (events[i].events & EPOLLOUT)
+                {
+                    actionMask |= CURL_CSELECT_OUT;
+                }
+                if (events[i].events & (EPOLLERR | EPOLLHUP))
+                {
+                    actionMask |= CURL_CSELECT_ERR;
+                }
+                curl_multi_socket_action(m_multiHandle, events[i].data.fd, actionMask, &runningHandles);
+            }
+
+            if (m_hasTimer && std::chrono::steady_clock::now() >= m_timerDeadline)
+            {
+                // curl may arm a new timer from inside socket_action, so clear ours first.
+                m_hasTimer = false;
+                curl_multi_socket_action(m_multiHandle, CURL_SOCKET_TIMEOUT, 0, &runningHandles);
+            }
+
+            CheckCompletedTransfers();
+        }
+    }
+
+    void AddPendingTransfers()
+    {
+        Aws::Vector<CurlMultiTransfer*> transfers;
+        {
+            std::lock_guard<std::mutex> locker(m_pendingLock);
+            transfers.swap(m_pending);
+        }
+
+        for (CurlMultiTransfer* transfer : transfers)
+        {
+            CURLMcode code = curl_multi_add_handle(m_multiHandle, transfer->m_connectionHandle);
+            if (code != CURLM_OK)
+            {
+                AWS_LOGSTREAM_ERROR(CURL_MULTI_HTTP_CLIENT_TAG, "curl_multi_add_handle failed with " << curl_multi_strerror(code));
+                m_client->CompleteTransfer(transfer, CURLE_FAILED_INIT);
+                continue;
+            }
+            m_inFlight.insert(transfer);
+        }
+    }
+
+    void CheckCompletedTransfers()
+    {
+        int messagesLeft = 0;
+        CURLMsg* message = nullptr;
+        while ((message = curl_multi_info_read(m_multiHandle, &messagesLeft)) != nullptr)
+        {
+            if (message->msg != CURLMSG_DONE)
+            {
+                continue;
+            }
+
+            char* privateData = nullptr;
+            curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &privateData);
+            CurlMultiTransfer* transfer = reinterpret_cast<CurlMultiTransfer*>(privateData);
+            CURLcode result = message->data.result;
+
+            curl_multi_remove_handle(m_multiHandle, message->easy_handle);
+            m_inFlight.erase(transfer);
+            m_client->CompleteTransfer(transfer, result);
+        }
+    }
+
+    static int SocketCallback(CURL* easy, curl_socket_t socket, int what, void* userp, void* socketp)
+    {
+        AWS_UNREFERENCED_PARAM(easy);
+        CurlMultiEventLoop* eventLoop = reinterpret_cast<CurlMultiEventLoop*>(userp);
+
+        if (what == CURL_POLL_REMOVE)
+        {
+            // The socket may already be closed, in which case the kernel dropped it from the interest list for us.
+            epoll_ctl(eventLoop->m_epollFd, EPOLL_CTL_DEL, socket, nullptr);
+            curl_multi_assign(eventLoop->m_multiHandle, socket, nullptr);
+            return 0;
+        }
+
+        struct epoll_event event;
+        event.events = 0;
+        event.data.fd = socket;
+        if (what == CURL_POLL_IN || what == CURL_POLL_INOUT)
+        {
+            event.events |= EPOLLIN;
+        }
+        if (what == CURL_POLL_OUT || what == CURL_POLL_INOUT)
+        {
+            event.events |= EPOLLOUT;
+        }
+
+        if (socketp)
+        {
+            epoll_ctl(eventLoop->m_epollFd, EPOLL_CTL_MOD, socket, &event);
+        }
+        else
+        {
+            epoll_ctl(eventLoop->m_epollFd, EPOLL_CTL_ADD, socket, &event);
+            // any non null value marks the socket as registered with epoll
+            curl_multi_assign(eventLoop->m_multiHandle, socket, eventLoop);
+        }
+        return 0;
+    }
+
+    static int TimerCallback(CURLM* multi, long timeoutMs, void* userp)
+    {
+        AWS_UNREFERENCED_PARAM(multi);
+        CurlMultiEventLoop* eventLoop = reinterpret_cast<CurlMultiEventLoop*>(userp);
+        if (timeoutMs < 0)
+        {
+            eventLoop->m_hasTimer = false;
+        }
+        else
+        {
+            eventLoop->m_hasTimer = true;
+            eventLoop->m_timerDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        }
+        return 0;
+    }
+
+    const CurlMultiHttpClient* m_client;
+    CURLM* m_multiHandle;
+    int m_epollFd;
+    int m_wakeupFd;
+    // timer state is only touched by the event loop thread
+    bool m_hasTimer;
+    std::chrono::steady_clock::time_point m_timerDeadline;
+    std::atomic<bool> m_continue;
+    std::mutex m_pendingLock;
+    Aws::Vector<CurlMultiTransfer*> m_pending;
+    Aws::Set<CurlMultiTransfer*> m_inFlight;
+    std::thread m_thread;
+};
+
+} // namespace Http
+} // namespace Aws
+
+// libcurl before 8.0 occasionally stalls one of the h2 streams multiplexed on a connection driven by curl_multi_socket_action,
+// until the low speed limit aborts it.
+static const unsigned MIN_MULTIPLEXING_CURL_VERSION = 0x080000;
+
+static bool CanMultiplexStreams(const ClientConfiguration& clientConfig)
+{
+    if (!clientConfig.enableHttp2)
+    {
+        return false;
+    }
+
+    const curl_version_info_data* versionInfo = curl_version_info(CURLVERSION_NOW);
+    if (versionInfo && versionInfo->version_num < MIN_MULTIPLEXING_CURL_VERSION)
+    {
+        AWS_LOGSTREAM_WARN(CURL_MULTI_HTTP_CLIENT_TAG, "libcurl " << versionInfo->version << " is known to stall multiplexed h2 streams, "
+                "so each request gets a connection of its own. Upgrade to libcurl 8.0 or later to share connections.");
+        return false;
+    }
+    return true;
+}
+
+CurlMultiHttpClient::CurlMultiHttpClient(const ClientConfiguration& clientConfig) :
+    Base(clientConfig),
+    m_nextEventLoop(0),
+    m_multiplexStreams(CanMultiplexStreams(clientConfig))
+{
+    unsigned ioThreads = clientConfig.curlMultiIoThreads > 0 ? clientConfig.curlMultiIoThreads : 1;
+    AWS_LOGSTREAM_INFO(CURL_MULTI_HTTP_CLIENT_TAG, "Starting " << ioThreads << " curl multi event loops.");
+    for (unsigned i = 0; i < ioThreads; ++i)
+    {
+        m_eventLoops.push_back(Aws::MakeShared<CurlMultiEventLoop>(CURL_MULTI_HTTP_CLIENT_TAG, this, static_cast<long>(clientConfig.maxConnections), m_multiplexStreams));
+    }
+}
+
+CurlMultiHttpClient::~CurlMultiHttpClient()
+{
+    // Join the event loops while the handle container in the base class is still around to take the handles back.
+    m_eventLoops.clear();
+}
+
+std::shared_ptr<HttpResponse> CurlMultiHttpClient::MakeRequest(HttpRequest& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    // We block until the transfer is done, so the caller's request outlives it.
+    std::shared_ptr<HttpRequest> unownedRequest(&request, [](HttpRequest*) {});
+    return MakeRequest(unownedRequest, readLimiter, writeLimiter);
+}
+
+std::shared_ptr<HttpResponse> CurlMultiHttpClient::MakeRequest(const std::shared_ptr<HttpRequest>& request,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    if (IsEventLoopThread())
+    {
+        AWS_LOGSTREAM_WARN(CURL_MULTI_HTTP_CLIENT_TAG, "Blocking request to " << request->GetURIString()
+                << " made from an event loop thread, making it on the calling thread. This stalls every other transfer of the loop.");
+        return Base::MakeRequest(request, readLimiter, writeLimiter);
+    }
+
+    std::promise<std::shared_ptr<HttpResponse>> responsePromise;
+    std::future<std::shared_ptr<HttpResponse>> responseFuture = responsePromise.get_future();
+    MakeRequestAsync(request, [&responsePromise](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& response)
+    {
+        responsePromise.set_value(response);
+    }, readLimiter, writeLimiter);
+    return responseFuture.get();
+}
+
+void CurlMultiHttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const CurlMultiResponseHandler& handler,
+        Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+        Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    AWS_LOGSTREAM_TRACE(CURL_MULTI_HTTP_CLIENT_TAG, "Queueing request to " << request->GetURIString());
+
+    if (writeLimiter != nullptr)
+    {
+        writeLimiter->ApplyAndPayForCost(request->GetSize());
+    }
+
+    CurlMultiTransfer* transfer = Aws::New<CurlMultiTransfer>(CURL_MULTI_HTTP_CLIENT_TAG, this, request, handler, readLimiter, writeLimiter);
+    transfer->m_headers = BuildHeaderList(*request);
+    transfer->m_connectionPoolKey = ComputeConnectionPoolKey(*request);
+    transfer->m_connectionHandle = m_curlHandleContainer.AcquireCurlHandle(transfer->m_connectionPoolKey);
+
+    if (!transfer->m_connectionHandle)
+    {
+        CompleteTransfer(transfer, CURLE_FAILED_INIT);
+        return;
+    }
+
+    AWS_LOGSTREAM_DEBUG(CURL_MULTI_HTTP_CLIENT_TAG, "Obtained connection handle " << transfer->m_connectionHandle);
+    ConfigureHandleForRequest(transfer->m_connectionHandle, *request, transfer->m_headers, transfer->m_writeContext, transfer->m_readContext);
+    curl_easy_setopt(transfer->m_connectionHandle, CURLOPT_PRIVATE, transfer);
+    transfer->m_startTransmissionTime = DateTime::Now();
+
+    // Streams can only share a connection within one multi handle, so keep every request to an endpoint on the same loop.
+    size_t eventLoopIndex = m_multiplexStreams ? static_cast<size_t>(static_cast<unsigned>(HashingUtils::HashString(transfer->m_connectionPoolKey.c_str()))) % m_eventLoops.size()
+                                               : m_nextEventLoop.fetch_add(1) % m_eventLoops.size();
+    m_eventLoops[eventLoopIndex]->Submit(transfer);
+}
+
+bool CurlMultiHttpClient::IsEventLoopThread() const
+{
+    std::thread::id currentThread = std::this_thread::get_id();
+    for (const auto& eventLoop : m_eventLoops)
+    {
+        if (eventLoop->GetThreadId() == currentThread)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CurlMultiHttpClient::CompleteTransfer(CurlMultiTransfer* transfer, CURLcode curlResponseCode) const
+{
+    HttpRequest& request = *transfer->m_request;
+    std::shared_ptr<StandardHttpResponse> response = transfer->m_response;
+
+    if (transfer->m_connectionHandle)
+    {
+        HandleTransferResult(transfer->m_connectionHandle, curlResponseCode, request, response, transfer->m_writeContext);
+        m_curlHandleContainer.ReleaseCurlHandle(transfer->m_connectionHandle, transfer->m_connectionPoolKey);
+        //go ahead and flush the response body stream
+        if (response)
+        {
+            response->GetResponseBody().flush();
+        }
+        request.AddRequestMetric(GetHttpClientMetricNameByType(HttpClientMetricsType::RequestLatency), (DateTime::Now() - transfer->m_startTransmissionTime).count());
+    }
+    else
+    {
+        response = nullptr;
+    }
+
+    if (transfer->m_headers)
+    {
+        curl_slist_free_all(transfer->m_headers);
+    }
+
+    CurlMultiResponseHandler handler = std::move(transfer->m_handler);
+    std::shared_ptr<HttpRequest> requestPtr = transfer->m_request;
+    Aws::Delete(transfer);
+
+    if (handler)
+    {
+        handler(requestPtr, response);
+    }
+}
+
+#endif // defined(__linux__)
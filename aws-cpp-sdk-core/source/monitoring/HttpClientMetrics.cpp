@@ -28,6 +28,7 @@ namespace Aws
         static const char HTTP_CLIENT_METRICS_DNS_LATENCY[] = "DnsLatency";
         static const char HTTP_CLIENT_METRICS_TCP_LEATENCY[] = "TcpLatency";
         static const char HTTP_CLIENT_METRICS_SSL_LATENCY[] = "SslLatency";
+        static const char HTTP_CLIENT_METRICS_HTTP_VERSION[] = "HttpVersion";
         static const char HTTP_CLIENT_METRICS_UNKNOWN[] = "Unknown";
 
         using namespace Aws::Utils;
@@ -42,7 +43,8 @@ namespace Aws
                 std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_REQUEST_LATENCY), HttpClientMetricsType::RequestLatency),
                 std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_DNS_LATENCY), HttpClientMetricsType::DnsLatency),
                 std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_TCP_LEATENCY), HttpClientMetricsType::TcpLatency),
-                std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_SSL_LATENCY), HttpClientMetricsType::SslLatency)
+                std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_SSL_LATENCY), HttpClientMetricsType::SslLatency),
+                std::pair<int, HttpClientMetricsType>(HashingUtils::HashString(HTTP_CLIENT_METRICS_HTTP_VERSION), HttpClientMetricsType::HttpVersion)
             };
 
             int nameHash = HashingUtils::HashString(name.c_str());
@@ -66,6 +68,7 @@ namespace Aws
                 std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::DnsLatency), HTTP_CLIENT_METRICS_DNS_LATENCY),
                 std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::TcpLatency), HTTP_CLIENT_METRICS_TCP_LEATENCY),
                 std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::SslLatency), HTTP_CLIENT_METRICS_SSL_LATENCY),
+                std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::HttpVersion), HTTP_CLIENT_METRICS_HTTP_VERSION),
                 std::pair<int, std::string>(static_cast<int>(HttpClientMetricsType::Unknown), HTTP_CLIENT_METRICS_UNKNOWN)
             };
 
@@ -0,0 +1,90 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/CpuFeatures.h>
+
+#ifdef AWS_CPU_X86_64
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+using namespace Aws::Utils;
+
+#ifdef AWS_CPU_X86_64
+static void Cpuid(unsigned int leaf, unsigned int registers[4])
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = {0, 0, 0, 0};
+    __cpuidex(info, static_cast<int>(leaf), 0);
+    for (int i = 0; i < 4; ++i)
+    {
+        registers[i] = static_cast<unsigned int>(info[i]);
+    }
+#else
+    registers[0] = registers[1] = registers[2] = registers[3] = 0;
+    if (__get_cpuid_max(0, nullptr) >= leaf)
+    {
+        __cpuid_count(leaf, 0, registers[0], registers[1], registers[2], registers[3]);
+    }
+#endif
+}
+
+// which register sets the operating system saves on context switches.
+static unsigned long long ExtendedControlRegister()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#else
+    unsigned int eax = 0, edx = 0;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+#endif
+
+CpuFeatures::CpuFeatures() :
+    m_ssse3(false),
+    m_sse41(false),
+    m_sse42(false),
+    m_pclmul(false),
+    m_avx2(false)
+{
+#ifdef AWS_CPU_X86_64
+    unsigned int registers[4];
+    Cpuid(1, registers);
+    unsigned int ecx = registers[2];
+    m_ssse3 = (ecx & (1u << 9)) != 0;
+    m_sse41 = (ecx & (1u << 19)) != 0;
+    m_sse42 = (ecx & (1u << 20)) != 0;
+    m_pclmul = (ecx & (1u << 1)) != 0;
+
+    bool osSavesAvxState = (ecx & (1u << 27)) != 0 && (ecx & (1u << 28)) != 0 && (ExtendedControlRegister() & 0x6) == 0x6;
+    if (osSavesAvxState)
+    {
+        Cpuid(7, registers);
+        m_avx2 = (registers[1] & (1u << 5)) != 0;
+    }
+#endif
+}
+
+const CpuFeatures& CpuFeatures::Get()
+{
+    static const CpuFeatures features;
+    return features;
+}
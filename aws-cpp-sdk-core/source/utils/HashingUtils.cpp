@@ -18,13 +18,17 @@
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/base64/Base64.h>
 #include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/crypto/Sha256TreeHash.h>
 #include <aws/core/utils/crypto/Sha256HMAC.h>
 #include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/CpuFeatures.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
-#include <aws/core/utils/memory/stl/AWSList.h>
 
-#include <iomanip>
+#ifdef AWS_CPU_X86_64
+#include <immintrin.h>
+#endif
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Base64;
@@ -36,6 +40,129 @@ static Aws::Utils::Base64::Base64 s_base64;
 // Aws Glacier Tree Hash calculates hash value for each 1MB data
 const static size_t TREE_HASH_ONE_MB = 1024 * 1024;
 
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+#ifdef AWS_CPU_X86_64
+namespace
+{
+    /*
+    SIMD hex encoding and decoding. Each returns how much of its input it consumed, the rest being left to the scalar code:
+    they only work on whole vectors, and decoding stops at the first vector holding something else than hex digits.
+    */
+
+    AWS_CPU_TARGET("ssse3")
+    size_t HexEncodeSSSE3(const unsigned char* data, size_t length, char* output)
+    {
+        const __m128i digits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_DIGITS));
+        const __m128i lowNibble = _mm_set1_epi8(0x0f);
+
+        size_t consumed = 0;
+        for (; length - consumed >= 16; consumed += 16, output += 32)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed));
+            __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), lowNibble));
+            __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, lowNibble));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_unpacklo_epi8(high, low));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16), _mm_unpackhi_epi8(high, low));
+        }
+        return consumed;
+    }
+
+    AWS_CPU_TARGET("avx2")
+    size_t HexEncodeAVX2(const unsigned char* data, size_t length, char* output)
+    {
+        const __m256i digits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_DIGITS)));
+        const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+
+        size_t consumed = 0;
+        for (; length - consumed >= 32; consumed += 32, output += 64)
+        {
+            __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + consumed));
+            __m256i high = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), lowNibble));
+            __m256i low = _mm256_shuffle_epi8(digits, _mm256_and_si256(bytes, lowNibble));
+            // unpacking works within 128 bit lanes, the first lanes of both hold the first 16 bytes' digits.
+            __m256i first = _mm256_unpacklo_epi8(high, low);
+            __m256i second = _mm256_unpackhi_epi8(high, low);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), _mm256_permute2x128_si256(first, second, 0x20));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 32), _mm256_permute2x128_si256(first, second, 0x31));
+        }
+        return consumed;
+    }
+
+    /**
+     * Values of the 16 hex digits in chars, valid being set to all ones in the lanes holding hex digits.
+     */
+    AWS_CPU_TARGET("ssse3")
+    inline __m128i HexDigitValuesSSSE3(__m128i chars, __m128i& valid)
+    {
+        // signed comparisons, so chars above 0x7f end up out of both ranges.
+        __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+        __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(digit, _mm_set1_epi8(-1)), _mm_cmpgt_epi8(_mm_set1_epi8(10), digit));
+        __m128i letter = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+        __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(letter, _mm_set1_epi8(-1)), _mm_cmpgt_epi8(_mm_set1_epi8(6), letter));
+        valid = _mm_or_si128(isDigit, isLetter);
+        return _mm_or_si128(_mm_and_si128(isDigit, digit), _mm_and_si128(isLetter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+    }
+
+    AWS_CPU_TARGET("ssse3")
+    size_t HexDecodeSSSE3(const char* str, size_t length, unsigned char* output)
+    {
+        // the first digit of each pair is the high nibble.
+        const __m128i nibbleWeights = _mm_set1_epi16(0x0110);
+
+        size_t consumed = 0;
+        for (; length - consumed >= 32; consumed += 32, output += 16)
+        {
+            __m128i firstValid, secondValid;
+            __m128i first = HexDigitValuesSSSE3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + consumed)), firstValid);
+            __m128i second = HexDigitValuesSSSE3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + consumed + 16)), secondValid);
+            if (_mm_movemask_epi8(_mm_and_si128(firstValid, secondValid)) != 0xFFFF)
+            {
+                break;
+            }
+
+            __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(first, nibbleWeights), _mm_maddubs_epi16(second, nibbleWeights));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), bytes);
+        }
+        return consumed;
+    }
+
+    AWS_CPU_TARGET("avx2")
+    inline __m256i HexDigitValuesAVX2(__m256i chars, __m256i& valid)
+    {
+        __m256i digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+        __m256i isDigit = _mm256_and_si256(_mm256_cmpgt_epi8(digit, _mm256_set1_epi8(-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8(10), digit));
+        __m256i letter = _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+        __m256i isLetter = _mm256_and_si256(_mm256_cmpgt_epi8(letter, _mm256_set1_epi8(-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8(6), letter));
+        valid = _mm256_or_si256(isDigit, isLetter);
+        return _mm256_or_si256(_mm256_and_si256(isDigit, digit), _mm256_and_si256(isLetter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+    }
+
+    AWS_CPU_TARGET("avx2")
+    size_t HexDecodeAVX2(const char* str, size_t length, unsigned char* output)
+    {
+        const __m256i nibbleWeights = _mm256_set1_epi16(0x0110);
+
+        size_t consumed = 0;
+        for (; length - consumed >= 64; consumed += 64, output += 32)
+        {
+            __m256i firstValid, secondValid;
+            __m256i first = HexDigitValuesAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + consumed)), firstValid);
+            __m256i second = HexDigitValuesAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + consumed + 32)), secondValid);
+            if (_mm256_movemask_epi8(_mm256_and_si256(firstValid, secondValid)) != -1)
+            {
+                break;
+            }
+
+            // packing works within 128 bit lanes too, which leaves the 64 bit quarters in the 0, 2, 1, 3 order.
+            __m256i bytes = _mm256_packus_epi16(_mm256_maddubs_epi16(first, nibbleWeights), _mm256_maddubs_epi16(second, nibbleWeights));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), _mm256_permute4x64_epi64(bytes, 0xD8));
+        }
+        return consumed;
+    }
+}
+#endif
+
 Aws::String HashingUtils::Base64Encode(const ByteBuffer& message)
 {
     return s_base64.Encode(message);
@@ -46,6 +173,16 @@ ByteBuffer HashingUtils::Base64Decode(const Aws::String& encodedMessage)
     return s_base64.Decode(encodedMessage);
 }
 
+size_t HashingUtils::Base64Encode(const unsigned char* data, size_t length, char* output)
+{
+    return s_base64.Encode(data, length, output);
+}
+
+size_t HashingUtils::Base64Decode(const char* encoded, size_t length, unsigned char* output)
+{
+    return s_base64.Decode(encoded, length, output);
+}
+
 ByteBuffer HashingUtils::CalculateSHA256HMAC(const ByteBuffer& toSign, const ByteBuffer& secret)
 {
     Sha256HMAC hash;
@@ -64,62 +201,22 @@ ByteBuffer HashingUtils::CalculateSHA256(Aws::IOStream& stream)
     return hash.Calculate(stream).GetResult();
 }
 
-/**
- * This function is only used by HashingUtils::CalculateSHA256TreeHash() in this cpp file
- * It's a helper function be used to compute the TreeHash defined at:
- * http://docs.aws.amazon.com/amazonglacier/latest/dev/checksum-calculations.html
- */
-static ByteBuffer TreeHashFinalCompute(Aws::List<ByteBuffer>& input)
-{
-    Sha256 hash;
-    assert(input.size() != 0);
-
-    // O(n) time complexity of merging (n + n/2 + n/4 + n/8 +...+ 1)
-    while (input.size() > 1)
-    {
-        auto iter = input.begin();
-        // if only one element left, just left it there
-        while (std::next(iter) != input.end())
-        {
-            // if >= two elements
-            Aws::String str(reinterpret_cast<char*>(iter->GetUnderlyingData()), iter->GetLength());
-            // list erase returns iterator of next element next to the erased element or end() if erased the last one
-            // list insert inserts element before pos, here we erase two elements, and insert a new element
-            iter = input.erase(iter);
-            str.append(reinterpret_cast<char*>(iter->GetUnderlyingData()), iter->GetLength());
-            iter = input.erase(iter);
-            input.insert(iter, hash.Calculate(str).GetResult());
-
-            if (iter == input.end()) break;
-        } // while process to the last element
-    } // while the list has only one element left
-
-    return *(input.begin());
-}
-
 ByteBuffer HashingUtils::CalculateSHA256TreeHash(const Aws::String& str)
 {
-    Sha256 hash;
     if (str.size() == 0)
     {
+        Sha256 hash;
         return hash.Calculate(str).GetResult();
     }
 
-    Aws::List<ByteBuffer> input;
-    size_t pos = 0;
-    while (pos < str.size())
-    {
-        input.push_back(hash.Calculate(Aws::String(str, pos, TREE_HASH_ONE_MB)).GetResult());
-        pos += TREE_HASH_ONE_MB;
-    }
-
-    return TreeHashFinalCompute(input);
+    Sha256TreeHash treeHash;
+    treeHash.Update(0, reinterpret_cast<const unsigned char*>(str.c_str()), str.size());
+    return treeHash.GetHash();
 }
 
 ByteBuffer HashingUtils::CalculateSHA256TreeHash(Aws::IOStream& stream)
 {
-    Sha256 hash;
-    Aws::List<ByteBuffer> input;
+    Sha256TreeHash treeHash;
     auto currentPos = stream.tellg();
     if (currentPos == std::ios::pos_type(-1))
     {
@@ -128,36 +225,55 @@ ByteBuffer HashingUtils::CalculateSHA256TreeHash(Aws::IOStream& stream)
     }
     stream.seekg(0, stream.beg);
     Array<char> streamBuffer(TREE_HASH_ONE_MB);
+    uint64_t offset = 0;
     while (stream.good())
     {
         stream.read(streamBuffer.GetUnderlyingData(), TREE_HASH_ONE_MB);
         auto bytesRead = stream.gcount();
         if (bytesRead > 0)
         {
-            input.push_back(hash.Calculate(Aws::String(reinterpret_cast<char*>(streamBuffer.GetUnderlyingData()), static_cast<size_t>(bytesRead))).GetResult());
+            treeHash.Update(offset, reinterpret_cast<unsigned char*>(streamBuffer.GetUnderlyingData()), static_cast<size_t>(bytesRead));
+            offset += static_cast<uint64_t>(bytesRead);
         }
     }
     stream.clear();
     stream.seekg(currentPos, stream.beg);
 
-    if (input.size() == 0)
+    return treeHash.GetHash();
+}
+
+Aws::String HashingUtils::HexEncode(const ByteBuffer& message)
+{
+    Aws::String encoded(message.GetLength() * 2, '0');
+    if (!encoded.empty())
     {
-        return hash.Calculate("").GetResult();
+        HexEncode(message.GetUnderlyingData(), message.GetLength(), &encoded[0]);
     }
-    return TreeHashFinalCompute(input);
+
+    return encoded;
 }
 
-Aws::String HashingUtils::HexEncode(const ByteBuffer& message)
+size_t HashingUtils::HexEncode(const unsigned char* data, size_t length, char* output)
 {
-    Aws::StringStream ss;
+    size_t consumed = 0;
+#ifdef AWS_CPU_X86_64
+    if (CpuFeatures::Get().HasAVX2())
+    {
+        consumed = HexEncodeAVX2(data, length, output);
+    }
+    if (CpuFeatures::Get().HasSSSE3())
+    {
+        consumed += HexEncodeSSSE3(data + consumed, length - consumed, output + 2 * consumed);
+    }
+#endif
 
-    for (unsigned i = 0; i < message.GetLength(); ++i)
+    for (size_t i = consumed; i < length; ++i)
     {
-        ss << std::hex << std::setw(2) << std::setfill('0')
-            << (unsigned int) message[i];
+        output[2 * i] = HEX_DIGITS[data[i] >> 4];
+        output[2 * i + 1] = HEX_DIGITS[data[i] & 0x0F];
     }
 
-    return ss.str();
+    return 2 * length;
 }
 
 ByteBuffer HashingUtils::HexDecode(const Aws::String& str)
@@ -171,19 +287,41 @@ ByteBuffer HashingUtils::HexDecode(const Aws::String& str)
         return ByteBuffer();
     }
 
-    size_t strLength = str.length();
-    size_t readIndex = 0;
+    bool hasPrefix = str[0] == '0' && (str[1] == 'x' || str[1] == 'X');
+    ByteBuffer hexBuffer((str.length() - (hasPrefix ? 2 : 0)) / 2);
+    HexDecode(str.c_str(), str.length(), hexBuffer.GetUnderlyingData());
+
+    return hexBuffer;
+}
+
+size_t HashingUtils::HexDecode(const char* str, size_t length, unsigned char* output)
+{
+    if(length < 2 || length % 2 != 0)
+    {
+        return 0;
+    }
 
     if(str[0] == '0' && (str[1] == 'x' || str[1] == 'X'))
     {
-        strLength -= 2;
-        readIndex = 2;
+        str += 2;
+        length -= 2;
+    }
+
+    size_t consumed = 0;
+#ifdef AWS_CPU_X86_64
+    if (CpuFeatures::Get().HasAVX2())
+    {
+        consumed = HexDecodeAVX2(str, length, output);
+    }
+    if (CpuFeatures::Get().HasSSSE3())
+    {
+        consumed += HexDecodeSSSE3(str + consumed, length - consumed, output + consumed / 2);
     }
+#endif
 
-    ByteBuffer hexBuffer(strLength / 2);
-    size_t bufferIndex = 0;
+    size_t bufferIndex = consumed / 2;
 
-    for (size_t i = readIndex; i < str.length(); i += 2)
+    for (size_t i = consumed; i < length; i += 2)
     {
         if(!StringUtils::IsAlnum(str[i]) || !StringUtils::IsAlnum(str[i + 1]))
         {
@@ -212,10 +350,10 @@ ByteBuffer HashingUtils::HexDecode(const Aws::String& str)
         }
 
         val += distance;
-        hexBuffer[bufferIndex++] = val;
+        output[bufferIndex++] = val;
     }
 
-    return hexBuffer;
+    return length / 2;
 }
 
 ByteBuffer HashingUtils::CalculateMD5(const Aws::String& str)
@@ -230,6 +368,30 @@ ByteBuffer HashingUtils::CalculateMD5(Aws::IOStream& stream)
     return hash.Calculate(stream).GetResult();
 }
 
+ByteBuffer HashingUtils::CalculateCRC32(const Aws::String& str)
+{
+    CRC32 hash;
+    return hash.Calculate(str).GetResult();
+}
+
+ByteBuffer HashingUtils::CalculateCRC32(Aws::IOStream& stream)
+{
+    CRC32 hash;
+    return hash.Calculate(stream).GetResult();
+}
+
+ByteBuffer HashingUtils::CalculateCRC32C(const Aws::String& str)
+{
+    CRC32C hash;
+    return hash.Calculate(str).GetResult();
+}
+
+ByteBuffer HashingUtils::CalculateCRC32C(Aws::IOStream& stream)
+{
+    CRC32C hash;
+    return hash.Calculate(stream).GetResult();
+}
+
 int HashingUtils::HashString(const char* strToHash)
 {
     if (!strToHash)
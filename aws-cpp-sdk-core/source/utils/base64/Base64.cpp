@@ -14,13 +14,167 @@
   */
 
 #include <aws/core/utils/base64/Base64.h>
+#include <aws/core/utils/CpuFeatures.h>
 #include <cstring>
 
+#ifdef AWS_CPU_X86_64
+#include <immintrin.h>
+#endif
+
 using namespace Aws::Utils::Base64;
 
 static const uint8_t SENTINEL_VALUE = 255;
 static const char BASE64_ENCODING_TABLE_MIME[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
 
+#ifdef AWS_CPU_X86_64
+namespace
+{
+    /*
+    The SIMD code paths follow "Faster Base64 Encoding and Decoding Using AVX2 Instructions" (Mula, Lemire, 2018), for the default
+    encoding table only. Each returns how much of its input it consumed, the rest being left to the scalar code: they only work on
+    whole vectors, and decoding stops at the first vector holding a char outside of the table, padding included, so that the scalar
+    code handles those exactly like it always did.
+    */
+
+    AWS_CPU_TARGET("ssse3")
+    size_t Base64EncodeSSSE3(const unsigned char* data, size_t length, char* output)
+    {
+        // each 32 bit lane gets 3 input bytes, in the order the 6 bit indices are then extracted from.
+        const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+        // maps the range each index falls in to the offset turning it into its char, see Base64DecodeSSSE3() for the reverse.
+        const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+        size_t consumed = 0;
+        // 16 bytes are read for the 12 encoded.
+        while (length - consumed >= 16)
+        {
+            __m128i in = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed)), shuffle);
+            __m128i indices = _mm_or_si128(
+                    _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040)),
+                    _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010)));
+
+            __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+            range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+            __m128i chars = _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), chars);
+            consumed += 12;
+            output += 16;
+        }
+        return consumed;
+    }
+
+    AWS_CPU_TARGET("avx2")
+    size_t Base64EncodeAVX2(const unsigned char* data, size_t length, char* output)
+    {
+        const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+        const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+        size_t consumed = 0;
+        // 12 bytes are encoded per 128 bit lane, the second lane's 16 bytes are read from 12 bytes in.
+        while (length - consumed >= 28)
+        {
+            __m256i in = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed + 12)), 1);
+            in = _mm256_shuffle_epi8(in, shuffle);
+            __m256i indices = _mm256_or_si256(
+                    _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040)),
+                    _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010)));
+
+            __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+            range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+            __m256i chars = _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), chars);
+            consumed += 24;
+            output += 32;
+        }
+        return consumed;
+    }
+
+    AWS_CPU_TARGET("ssse3")
+    size_t Base64DecodeSSSE3(const char* input, size_t length, unsigned char* output, size_t capacity)
+    {
+        // a char is in the table if the bits its low and high nibbles select in these don't intersect.
+        const __m128i lowNibbleBits = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m128i highNibbleBits = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        // what to add to a char to get its index, by high nibble, '/' being moved to slot 1.
+        const __m128i offsets = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i slash = _mm_set1_epi8(0x2f);
+        const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+        size_t consumed = 0;
+        size_t produced = 0;
+        // 16 bytes are written for the 12 decoded.
+        while (length - consumed >= 16 && capacity - produced >= 16)
+        {
+            __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + consumed));
+            // the 0x2f mask clears the top bit, which would make the shuffles below return 0, the bit it keeps they ignore.
+            __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), slash);
+            __m128i lowNibbles = _mm_and_si128(chars, slash);
+            __m128i invalid = _mm_and_si128(_mm_shuffle_epi8(lowNibbleBits, lowNibbles), _mm_shuffle_epi8(highNibbleBits, highNibbles));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128())) != 0xFFFF)
+            {
+                break;
+            }
+
+            __m128i slot = _mm_add_epi8(_mm_cmpeq_epi8(chars, slash), highNibbles);
+            __m128i indices = _mm_add_epi8(chars, _mm_shuffle_epi8(offsets, slot));
+            // merges pairs of 6 bit indices into 12 bits, then pairs of those into 24 bits, and packs the bytes in big endian order.
+            __m128i merged = _mm_madd_epi16(_mm_maddubs_epi16(indices, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + produced), _mm_shuffle_epi8(merged, pack));
+            consumed += 16;
+            produced += 12;
+        }
+        return consumed;
+    }
+
+    AWS_CPU_TARGET("avx2")
+    size_t Base64DecodeAVX2(const char* input, size_t length, unsigned char* output, size_t capacity)
+    {
+        const __m256i lowNibbleBits = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m256i highNibbleBits = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        const __m256i offsets = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m256i slash = _mm256_set1_epi8(0x2f);
+        const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+        // moves the 12 bytes decoded in the second lane right after the ones of the first.
+        const __m256i join = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+        size_t consumed = 0;
+        size_t produced = 0;
+        while (length - consumed >= 32 && capacity - produced >= 32)
+        {
+            __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + consumed));
+            __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), slash);
+            __m256i lowNibbles = _mm256_and_si256(chars, slash);
+            if (!_mm256_testz_si256(_mm256_shuffle_epi8(lowNibbleBits, lowNibbles), _mm256_shuffle_epi8(highNibbleBits, highNibbles)))
+            {
+                break;
+            }
+
+            __m256i slot = _mm256_add_epi8(_mm256_cmpeq_epi8(chars, slash), highNibbles);
+            __m256i indices = _mm256_add_epi8(chars, _mm256_shuffle_epi8(offsets, slot));
+            __m256i merged = _mm256_madd_epi16(_mm256_maddubs_epi16(indices, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+            merged = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(merged, pack), join);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + produced), merged);
+            consumed += 32;
+            produced += 24;
+        }
+        return consumed;
+    }
+}
+#endif
+
 namespace Aws
 {
 namespace Utils
@@ -43,6 +197,7 @@ Base64::Base64(const char *encodingTable)
     }
 
     memcpy(m_mimeBase64EncodingTable, encodingTable, encodingTableLength);
+    m_isMimeEncodingTable = memcmp(m_mimeBase64EncodingTable, BASE64_ENCODING_TABLE_MIME, 64) == 0;
 
     memset((void *)m_mimeBase64DecodingTable, 0, 256);
 
@@ -57,102 +212,147 @@ Base64::Base64(const char *encodingTable)
 
 Aws::String Base64::Encode(const Aws::Utils::ByteBuffer& buffer) const
 {
-    size_t bufferLength = buffer.GetLength();
-    size_t blockCount = (bufferLength + 2) / 3;
-    size_t remainderCount = (bufferLength % 3);
+    Aws::String outputString(CalculateBase64EncodedLength(buffer), '\0');
+    if (!outputString.empty())
+    {
+        Encode(buffer.GetUnderlyingData(), buffer.GetLength(), &outputString[0]);
+    }
+    return outputString;
+}
 
-    Aws::String outputString;
-    outputString.reserve(CalculateBase64EncodedLength(buffer));
+Aws::Utils::ByteBuffer Base64::Decode(const Aws::String& str) const
+{
+    Aws::Utils::ByteBuffer buffer(CalculateBase64DecodedLength(str));
+    Decode(str.c_str(), str.length(), buffer.GetUnderlyingData());
+    return buffer;
+}
 
-    for(size_t i = 0; i < bufferLength; i += 3 )
+size_t Base64::Encode(const unsigned char* data, size_t length, char* output) const
+{
+    char* outputStart = output;
+#ifdef AWS_CPU_X86_64
+    if (m_isMimeEncodingTable)
     {
-        uint32_t block = buffer[ i ];
-
-        block <<= 8;
-        if (i + 1 < bufferLength)
+        size_t consumed = 0;
+        if (CpuFeatures::Get().HasAVX2())
         {
-            block = block | buffer[ i + 1 ];
+            consumed = Base64EncodeAVX2(data, length, output);
         }
-
-        block <<= 8;
-        if (i + 2 < bufferLength)
+        if (CpuFeatures::Get().HasSSSE3())
         {
-            block = block | buffer[ i + 2 ];
+            consumed += Base64EncodeSSSE3(data + consumed, length - consumed, output + consumed / 3 * 4);
         }
+        data += consumed;
+        length -= consumed;
+        output += consumed / 3 * 4;
+    }
+#endif
 
-        outputString.push_back(m_mimeBase64EncodingTable[(block >> 18) & 0x3F]);
-        outputString.push_back(m_mimeBase64EncodingTable[(block >> 12) & 0x3F]);
-        outputString.push_back(m_mimeBase64EncodingTable[(block >> 6) & 0x3F]);
-        outputString.push_back(m_mimeBase64EncodingTable[block & 0x3F]);
+    for (; length >= 3; data += 3, length -= 3)
+    {
+        uint32_t block = static_cast<uint32_t>(data[0]) << 16 | static_cast<uint32_t>(data[1]) << 8 | data[2];
+        *output++ = m_mimeBase64EncodingTable[(block >> 18) & 0x3F];
+        *output++ = m_mimeBase64EncodingTable[(block >> 12) & 0x3F];
+        *output++ = m_mimeBase64EncodingTable[(block >> 6) & 0x3F];
+        *output++ = m_mimeBase64EncodingTable[block & 0x3F];
     }
 
-    if(remainderCount > 0)
+    if (length > 0)
     {
-        outputString[blockCount * 4 - 1] = '=';
-        if(remainderCount == 1)
-        {
-            outputString[blockCount * 4 - 2] = '=';
-        }
+        uint32_t block = static_cast<uint32_t>(data[0]) << 16 | (length == 2 ? static_cast<uint32_t>(data[1]) << 8 : 0);
+        *output++ = m_mimeBase64EncodingTable[(block >> 18) & 0x3F];
+        *output++ = m_mimeBase64EncodingTable[(block >> 12) & 0x3F];
+        *output++ = length == 2 ? m_mimeBase64EncodingTable[(block >> 6) & 0x3F] : '=';
+        *output++ = '=';
     }
 
-    return outputString;
+    return static_cast<size_t>(output - outputStart);
 }
 
-Aws::Utils::ByteBuffer Base64::Decode(const Aws::String& str) const
+size_t Base64::Decode(const char* b64input, size_t length, unsigned char* output) const
 {
-    size_t decodedLength = CalculateBase64DecodedLength(str);
-
-    Aws::Utils::ByteBuffer buffer(decodedLength);
+    size_t decodedLength = CalculateBase64DecodedLength(b64input, length);
+    size_t blockCount = length / 4;
+    size_t i = 0;
+#ifdef AWS_CPU_X86_64
+    if (m_isMimeEncodingTable)
+    {
+        size_t consumed = 0;
+        if (CpuFeatures::Get().HasAVX2())
+        {
+            consumed = Base64DecodeAVX2(b64input, blockCount * 4, output, decodedLength);
+        }
+        if (CpuFeatures::Get().HasSSSE3())
+        {
+            consumed += Base64DecodeSSSE3(b64input + consumed, blockCount * 4 - consumed, output + consumed / 4 * 3,
+                    decodedLength - consumed / 4 * 3);
+        }
+        i = consumed / 4;
+    }
+#endif
 
-    const char* rawString = str.c_str();
-    size_t blockCount = str.length() / 4;
-    for(size_t i = 0; i < blockCount; ++i)
+    // malformed input, e.g. padding in the middle of the string, may decode to more than decodedLength bytes, which are dropped.
+    for(; i < blockCount; ++i)
     {
         size_t stringIndex = i * 4;
 
-        uint32_t value1 = m_mimeBase64DecodingTable[uint32_t(rawString[stringIndex])];
-        uint32_t value2 = m_mimeBase64DecodingTable[uint32_t(rawString[++stringIndex])];
-        uint32_t value3 = m_mimeBase64DecodingTable[uint32_t(rawString[++stringIndex])];
-        uint32_t value4 = m_mimeBase64DecodingTable[uint32_t(rawString[++stringIndex])];
+        uint32_t value1 = m_mimeBase64DecodingTable[static_cast<unsigned char>(b64input[stringIndex])];
+        uint32_t value2 = m_mimeBase64DecodingTable[static_cast<unsigned char>(b64input[++stringIndex])];
+        uint32_t value3 = m_mimeBase64DecodingTable[static_cast<unsigned char>(b64input[++stringIndex])];
+        uint32_t value4 = m_mimeBase64DecodingTable[static_cast<unsigned char>(b64input[++stringIndex])];
 
         size_t bufferIndex = i * 3;
-        buffer[bufferIndex] = static_cast<uint8_t>((value1 << 2) | ((value2 >> 4) & 0x03));
-        if(value3 != SENTINEL_VALUE)
+        if (bufferIndex >= decodedLength)
         {
-            buffer[++bufferIndex] = static_cast<uint8_t>(((value2 << 4) & 0xF0) | ((value3 >> 2) & 0x0F));
-            if(value4 != SENTINEL_VALUE)
+            break;
+        }
+        output[bufferIndex] = static_cast<uint8_t>((value1 << 2) | ((value2 >> 4) & 0x03));
+        if(value3 != SENTINEL_VALUE && bufferIndex + 1 < decodedLength)
+        {
+            output[++bufferIndex] = static_cast<uint8_t>(((value2 << 4) & 0xF0) | ((value3 >> 2) & 0x0F));
+            if(value4 != SENTINEL_VALUE && bufferIndex + 1 < decodedLength)
             {
-                buffer[++bufferIndex] = static_cast<uint8_t>((value3 & 0x03) << 6 | value4);
+                output[++bufferIndex] = static_cast<uint8_t>((value3 & 0x03) << 6 | value4);
             }
         }
     }
 
-    return buffer;
+    return decodedLength;
 }
 
 size_t Base64::CalculateBase64DecodedLength(const Aws::String& b64input)
 {
-    size_t len = b64input.length();
-    if(len == 0)
+    return CalculateBase64DecodedLength(b64input.c_str(), b64input.length());
+}
+
+size_t Base64::CalculateBase64DecodedLength(const char* b64input, size_t length)
+{
+    if(length == 0)
     {
         return 0;
     }
 
     size_t padding = 0;
 
-    if (b64input[len - 1] == '=' && b64input[len - 2] == '=') //last two chars are =
+    if (length >= 2 && b64input[length - 1] == '=' && b64input[length - 2] == '=') //last two chars are =
         padding = 2;
-    else if (b64input[len - 1] == '=') //last char is =
+    else if (b64input[length - 1] == '=') //last char is =
         padding = 1;
 
-    return (len * 3 / 4 - padding);
+    size_t decodedLength = length * 3 / 4;
+    return decodedLength > padding ? decodedLength - padding : 0;
 }
 
 size_t Base64::CalculateBase64EncodedLength(const Aws::Utils::ByteBuffer& buffer)
 {
-    return 4 * ((buffer.GetLength() + 2) / 3);
+    return CalculateBase64EncodedLength(buffer.GetLength());
+}
+
+size_t Base64::CalculateBase64EncodedLength(size_t length)
+{
+    return 4 * ((length + 2) / 3);
 }
 
 } // namespace Base64
 } // namespace Utils
-} // namespace Aws
\ No newline at end of file
+} // namespace Aws
@@ -0,0 +1,308 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/CpuFeatures.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <cstring>
+
+#ifdef AWS_CPU_X86_64
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+// bit reflected polynomials
+static const uint32_t CRC32_POLYNOMIAL = 0xEDB88320;
+static const uint32_t CRC32C_POLYNOMIAL = 0x82F63B78;
+
+namespace
+{
+    /**
+     * Slice-by-8 lookup tables: table[k][b] is the crc of byte b followed by k zero bytes.
+     */
+    struct CrcTables
+    {
+        explicit CrcTables(uint32_t polynomial)
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc >> 1) ^ ((crc & 1) ? polynomial : 0);
+                }
+                table[0][i] = crc;
+            }
+
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                for (size_t k = 1; k < 8; ++k)
+                {
+                    table[k][i] = (table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xff];
+                }
+            }
+        }
+
+        uint32_t table[8][256];
+    };
+
+    const CrcTables& Crc32Tables()
+    {
+        static const CrcTables tables(CRC32_POLYNOMIAL);
+        return tables;
+    }
+
+    const CrcTables& Crc32cTables()
+    {
+        static const CrcTables tables(CRC32C_POLYNOMIAL);
+        return tables;
+    }
+
+    /**
+     * Portable implementation, crc is the running (inverted) value.
+     */
+    uint32_t ChecksumSoftware(const CrcTables& tables, const unsigned char* data, size_t length, uint32_t crc)
+    {
+        const uint32_t (&t)[8][256] = tables.table;
+        while (length >= 8)
+        {
+            uint32_t one = crc ^ (static_cast<uint32_t>(data[0]) | static_cast<uint32_t>(data[1]) << 8 |
+                    static_cast<uint32_t>(data[2]) << 16 | static_cast<uint32_t>(data[3]) << 24);
+            uint32_t two = static_cast<uint32_t>(data[4]) | static_cast<uint32_t>(data[5]) << 8 |
+                    static_cast<uint32_t>(data[6]) << 16 | static_cast<uint32_t>(data[7]) << 24;
+            crc = t[7][one & 0xff] ^ t[6][(one >> 8) & 0xff] ^ t[5][(one >> 16) & 0xff] ^ t[4][one >> 24] ^
+                t[3][two & 0xff] ^ t[2][(two >> 8) & 0xff] ^ t[1][(two >> 16) & 0xff] ^ t[0][two >> 24];
+            data += 8;
+            length -= 8;
+        }
+
+        while (length-- > 0)
+        {
+            crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xff];
+        }
+        return crc;
+    }
+
+#ifdef AWS_CPU_X86_64
+    AWS_CPU_TARGET("sse4.2")
+    uint32_t Crc32cHardware(const unsigned char* data, size_t length, uint32_t crc)
+    {
+        uint64_t crc64 = crc;
+        while (length >= 8)
+        {
+            uint64_t value;
+            memcpy(&value, data, sizeof(value));
+            crc64 = _mm_crc32_u64(crc64, value);
+            data += 8;
+            length -= 8;
+        }
+
+        crc = static_cast<uint32_t>(crc64);
+        while (length-- > 0)
+        {
+            crc = _mm_crc32_u8(crc, *data++);
+        }
+        return crc;
+    }
+
+    /**
+     * Folds 64 bytes at a time with carry-less multiplication and reduces the result with Barrett reduction, as described in
+     * "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel). length must be at least 64 and a multiple of 16.
+     */
+    AWS_CPU_TARGET("pclmul,sse4.1")
+    uint32_t Crc32Hardware(const unsigned char* data, size_t length, uint32_t crc)
+    {
+        // bit reflected constants from the paper: x^(4*128+32), x^(4*128-32), x^(128+32), x^(128-32), x^64, and the Barrett constants.
+        const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+        const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+        const __m128i k5k0 = _mm_set_epi64x(0x0000000000LL, 0x0163cd6124LL);
+        const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+        const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+        __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+        __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+        __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+        __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+        x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+        data += 64;
+        length -= 64;
+
+        while (length >= 64)
+        {
+            __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+            __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+            __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+            __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+            x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+            x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+            x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+            x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+            x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00)));
+            x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10)));
+            x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20)));
+            x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30)));
+
+            data += 64;
+            length -= 64;
+        }
+
+        // fold the four lanes into one.
+        __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x2), x5);
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x3), x5);
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x4), x5);
+
+        while (length >= 16)
+        {
+            x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+            x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data))), x5);
+            data += 16;
+            length -= 16;
+        }
+
+        // fold 128 bits to 64 bits.
+        x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+        x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5k0, 0x00), x2);
+
+        // Barrett reduction to 32 bits.
+        x2 = _mm_and_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10), mask32);
+        x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+
+        return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+    }
+#endif
+
+    HashResult ChecksumResult(uint32_t crc)
+    {
+        ByteBuffer hash(4);
+        hash[0] = static_cast<unsigned char>(crc >> 24);
+        hash[1] = static_cast<unsigned char>(crc >> 16);
+        hash[2] = static_cast<unsigned char>(crc >> 8);
+        hash[3] = static_cast<unsigned char>(crc);
+        return HashResult(std::move(hash));
+    }
+
+    template<typename ChecksumFn>
+    HashResult ChecksumStream(Aws::IStream& stream, ChecksumFn checksum)
+    {
+        auto currentPos = stream.tellg();
+        if (currentPos == -1)
+        {
+            currentPos = 0;
+            stream.clear();
+        }
+        stream.seekg(0, stream.beg);
+
+        uint32_t crc = 0;
+        unsigned char streamBuffer[Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE];
+        while (stream.good())
+        {
+            stream.read(reinterpret_cast<char*>(streamBuffer), Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
+            auto bytesRead = stream.gcount();
+            if (bytesRead > 0)
+            {
+                crc = checksum(streamBuffer, static_cast<size_t>(bytesRead), crc);
+            }
+        }
+
+        stream.clear();
+        stream.seekg(currentPos, stream.beg);
+
+        return ChecksumResult(crc);
+    }
+}
+
+uint32_t CRC32::Checksum(const unsigned char* data, size_t length, uint32_t previousCrc)
+{
+    uint32_t crc = ~previousCrc;
+#ifdef AWS_CPU_X86_64
+    // the folding also needs sse4.1.
+    if (length >= 64 && CpuFeatures::Get().HasPCLMUL() && CpuFeatures::Get().HasSSE41())
+    {
+        size_t foldedLength = length & ~static_cast<size_t>(15);
+        crc = Crc32Hardware(data, foldedLength, crc);
+        data += foldedLength;
+        length -= foldedLength;
+    }
+#endif
+    return ~ChecksumSoftware(Crc32Tables(), data, length, crc);
+}
+
+HashResult CRC32::Calculate(const Aws::String& str)
+{
+    return ChecksumResult(Checksum(reinterpret_cast<const unsigned char*>(str.c_str()), str.size()));
+}
+
+HashResult CRC32::Calculate(Aws::IStream& stream)
+{
+    return ChecksumStream(stream, &CRC32::Checksum);
+}
+
+void CRC32::Update(const unsigned char* buffer, size_t bufferSize)
+{
+    m_crc = Checksum(buffer, bufferSize, m_crc);
+}
+
+HashResult CRC32::GetHash()
+{
+    uint32_t crc = m_crc;
+    m_crc = 0;
+    return ChecksumResult(crc);
+}
+
+uint32_t CRC32C::Checksum(const unsigned char* data, size_t length, uint32_t previousCrc)
+{
+#ifdef AWS_CPU_X86_64
+    if (CpuFeatures::Get().HasSSE42())
+    {
+        return ~Crc32cHardware(data, length, ~previousCrc);
+    }
+#endif
+    return ~ChecksumSoftware(Crc32cTables(), data, length, ~previousCrc);
+}
+
+HashResult CRC32C::Calculate(const Aws::String& str)
+{
+    return ChecksumResult(Checksum(reinterpret_cast<const unsigned char*>(str.c_str()), str.size()));
+}
+
+HashResult CRC32C::Calculate(Aws::IStream& stream)
+{
+    return ChecksumStream(stream, &CRC32C::Checksum);
+}
+
+void CRC32C::Update(const unsigned char* buffer, size_t bufferSize)
+{
+    m_crc = Checksum(buffer, bufferSize, m_crc);
+}
+
+HashResult CRC32C::GetHash()
+{
+    uint32_t crc = m_crc;
+    m_crc = 0;
+    return ChecksumResult(crc);
+}
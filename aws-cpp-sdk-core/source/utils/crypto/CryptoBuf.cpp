@@ -15,18 +15,23 @@
 
 #include <aws/core/utils/crypto/CryptoBuf.h>
 
+#include <cstring>
+
 namespace Aws
 {
     namespace Utils
     {
         namespace Crypto
         {
+            //room left in the get area for what a cipher may output on top of its input, e.g. padding or a tag.
+            static const size_t CIPHER_OUTPUT_SLACK = 32;
+
             SymmetricCryptoBufSrc::SymmetricCryptoBufSrc(Aws::IStream& stream, SymmetricCipher& cipher, CipherMode cipherMode, size_t bufferSize)
                     :
-                    m_isBuf(PUT_BACK_SIZE), m_cipher(cipher), m_stream(stream), m_cipherMode(cipherMode), m_isFinalized(false),
-                    m_bufferSize(bufferSize), m_putBack(PUT_BACK_SIZE)
+                    m_isBuf(PUT_BACK_SIZE + bufferSize + CIPHER_OUTPUT_SLACK), m_srcBuf(bufferSize), m_cipher(cipher), m_stream(stream), m_cipherMode(cipherMode),
+                    m_isFinalized(false), m_bufferSize(bufferSize), m_putBack(PUT_BACK_SIZE)
             {
-                char* end = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData() + m_isBuf.GetLength());
+                char* end = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData() + m_putBack);
                 setg(end, end, end);
             }
 
@@ -65,24 +70,16 @@ namespace Aws
                     {
                         size_t max_read = std::min<size_t>(static_cast<size_t>(seekTo - index), m_bufferSize);
 
-                        Aws::Utils::Array<char> buf(max_read);
                         size_t readSize(0);
                         if(m_stream)
                         {
-                            m_stream.read(buf.GetUnderlyingData(), max_read);
+                            m_stream.read(reinterpret_cast<char*>(m_srcBuf.GetUnderlyingData()), max_read);
                             readSize = static_cast<size_t>(m_stream.gcount());
                         }
 
                         if (readSize > 0)
                         {
-                            if (m_cipherMode == CipherMode::Encrypt)
-                            {
-                                cryptoBuffer = m_cipher.EncryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                            }
-                            else
-                            {
-                                cryptoBuffer = m_cipher.DecryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                            }
+                            cryptoBuffer = TransformSrcBuffer(readSize);
                         }
                         else
                         {
@@ -103,21 +100,18 @@ namespace Aws
 
                     if (cryptoBuffer.GetLength() && m_cipher)
                     {
-                        CryptoBuffer putBackArea(m_putBack);
-                                                
-                        m_isBuf = CryptoBuffer({&putBackArea, &cryptoBuffer});
+                        memset(m_isBuf.GetUnderlyingData(), 0, m_putBack);
+                        char* baseBufPtr = FillGetArea(cryptoBuffer);
                         //in the very unlikely case that the cipher had less output than the source stream.
                         assert(seekTo <= index);
                         size_t newBufferPos = index > seekTo ? cryptoBuffer.GetLength() - (index - seekTo) : cryptoBuffer.GetLength();
-                        char* baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
-                        setg(baseBufPtr, baseBufPtr + m_putBack + newBufferPos, baseBufPtr + m_isBuf.GetLength());
+                        setg(baseBufPtr, baseBufPtr + m_putBack + newBufferPos, egptr());
 
                         return pos_type(seekTo);
                     }
                     else if (seekTo == 0)
                     {
-                        m_isBuf = CryptoBuffer(m_putBack);
-                        char* end = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData() + m_isBuf.GetLength());
+                        char* end = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData() + m_putBack);
                         setg(end, end, end);
                         return pos_type(seekTo);
                     }
@@ -143,34 +137,16 @@ namespace Aws
                     return traits_type::to_int_type(*gptr());
                 }
 
-                char* baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
-                CryptoBuffer putBackArea(m_putBack);
-
-                //eback is properly set after the first fill. So this guarantees we are on the second or later fill.
-                if (eback() == baseBufPtr)
-                {
-                    //just fill in the last bit of the previous buffer into the put back area so that it has some data in it
-                    memcpy(putBackArea.GetUnderlyingData(), egptr() - m_putBack, m_putBack);
-                }
-
                 CryptoBuffer newDataBuf;
 
                 while(!newDataBuf.GetLength() && !m_isFinalized)
                 {
-                    Aws::Utils::Array<char> buf(m_bufferSize);
-                    m_stream.read(buf.GetUnderlyingData(), m_bufferSize);
+                    m_stream.read(reinterpret_cast<char*>(m_srcBuf.GetUnderlyingData()), m_bufferSize);
                     size_t readSize = static_cast<size_t>(m_stream.gcount());
 
                     if (readSize > 0)
                     {
-                        if (m_cipherMode == CipherMode::Encrypt)
-                        {
-                            newDataBuf = m_cipher.EncryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                        }
-                        else
-                        {
-                            newDataBuf = m_cipher.DecryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                        }
+                        newDataBuf = TransformSrcBuffer(readSize);
                     }
                     else
                     {
@@ -190,10 +166,20 @@ namespace Aws
 
                 if(newDataBuf.GetLength() > 0)
                 {
-                    m_isBuf = CryptoBuffer({&putBackArea, &newDataBuf});
+                    char* baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
+                    //eback is properly set after the first fill. So this guarantees we are on the second or later fill.
+                    if (eback() == baseBufPtr)
+                    {
+                        //just fill in the last bit of the previous buffer into the put back area so that it has some data in it
+                        memmove(baseBufPtr, egptr() - m_putBack, m_putBack);
+                    }
+                    else
+                    {
+                        memset(baseBufPtr, 0, m_putBack);
+                    }
 
-                    baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
-                    setg(baseBufPtr, baseBufPtr + m_putBack, baseBufPtr + m_isBuf.GetLength());
+                    baseBufPtr = FillGetArea(newDataBuf);
+                    setg(baseBufPtr, baseBufPtr + m_putBack, egptr());
 
                     return traits_type::to_int_type(*gptr());
                 }
@@ -201,6 +187,35 @@ namespace Aws
                 return traits_type::eof();
             }
 
+            CryptoBuffer SymmetricCryptoBufSrc::TransformSrcBuffer(size_t readSize)
+            {
+                //a full buffer goes to the cipher as is, only the short read at the end of the stream needs a copy of its own.
+                CryptoBuffer shortRead;
+                if (readSize < m_srcBuf.GetLength())
+                {
+                    shortRead = CryptoBuffer(m_srcBuf.GetUnderlyingData(), readSize);
+                }
+                const CryptoBuffer& input = readSize < m_srcBuf.GetLength() ? shortRead : m_srcBuf;
+
+                return m_cipherMode == CipherMode::Encrypt ? m_cipher.EncryptBuffer(input) : m_cipher.DecryptBuffer(input);
+            }
+
+            char* SymmetricCryptoBufSrc::FillGetArea(const CryptoBuffer& data)
+            {
+                //the get area is reused from one fill to the next, it only grows if the cipher ever outputs more than it was sized for.
+                if (m_putBack + data.GetLength() > m_isBuf.GetLength())
+                {
+                    CryptoBuffer largerBuf(m_putBack + data.GetLength());
+                    memcpy(largerBuf.GetUnderlyingData(), m_isBuf.GetUnderlyingData(), m_putBack);
+                    m_isBuf = std::move(largerBuf);
+                }
+
+                memcpy(m_isBuf.GetUnderlyingData() + m_putBack, data.GetUnderlyingData(), data.GetLength());
+                char* baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
+                setg(baseBufPtr, baseBufPtr + m_putBack, baseBufPtr + m_putBack + data.GetLength());
+                return baseBufPtr;
+            }
+
             SymmetricCryptoBufSrc::off_type SymmetricCryptoBufSrc::ComputeAbsSeekPosition(off_type pos, std::ios_base::seekdir dir,  std::fpos<FPOS_TYPE> curPos)
             {
                 switch(dir)
@@ -263,22 +278,31 @@ namespace Aws
                 if(!m_isFinalized)
                 {
                     CryptoBuffer cryptoBuf;
-                    if (pptr() > pbase())
+                    size_t pending = static_cast<size_t>(pptr() - pbase());
+                    if (pending > 0)
                     {
+                        //a full put area goes to the cipher as is, only a partial one (on sync or finalize) needs a copy of its own.
+                        CryptoBuffer partialBuf;
+                        if (pending < m_osBuf.GetLength())
+                        {
+                            partialBuf = CryptoBuffer(reinterpret_cast<unsigned char*>(pbase()), pending);
+                        }
+                        const CryptoBuffer& input = pending < m_osBuf.GetLength() ? partialBuf : m_osBuf;
+
                         if (m_cipherMode == CipherMode::Encrypt)
                         {
-                            cryptoBuf = m_cipher.EncryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(pbase()), pptr() - pbase()));
+                            cryptoBuf = m_cipher.EncryptBuffer(input);
                         }
                         else
                         {
-                            cryptoBuf = m_cipher.DecryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(pbase()), pptr() - pbase()));
+                            cryptoBuf = m_cipher.DecryptBuffer(input);
                         }
 
-                        pbump(-(static_cast<int>(pptr() - pbase())));
+                        pbump(-(static_cast<int>(pending)));
                     }
+                    CryptoBuffer finalBuffer;
                     if(finalize)
                     {
-                        CryptoBuffer finalBuffer;
                         if (m_cipherMode == CipherMode::Encrypt)
                         {
                             finalBuffer = m_cipher.FinalizeEncryption();
@@ -287,27 +311,20 @@ namespace Aws
                         {
                             finalBuffer = m_cipher.FinalizeDecryption();
                         }
-                        if(cryptoBuf.GetLength())
-                        {
-                            cryptoBuf = CryptoBuffer({&cryptoBuf, &finalBuffer});
-                        }
-                        else
-                        {
-                            cryptoBuf = std::move(finalBuffer);
-                        }
 
                         m_isFinalized = true;
                     }
 
                     if (m_cipher)
                     {
-                        if(cryptoBuf.GetLength())
+                        if(cryptoBuf.GetLength() || finalBuffer.GetLength())
                         {
                             //allow mid block decryption. We have to decrypt it, but we don't have to write it to the stream.
                             //the assumption here is that tellp() will always be 0 or >= 16 bytes. The block offset should only 
                             //be the offset of the first block read.
-                            auto blockOffset = m_stream.tellp() > m_blockOffset ? 0 : m_blockOffset;
-                            m_stream.write(reinterpret_cast<char*>(cryptoBuf.GetUnderlyingData() + blockOffset), cryptoBuf.GetLength() - blockOffset);
+                            size_t blockOffset = m_stream.tellp() > m_blockOffset ? 0 : static_cast<size_t>(m_blockOffset);
+                            blockOffset = WriteToSink(cryptoBuf, blockOffset);
+                            WriteToSink(finalBuffer, blockOffset);
                         }
                         return true;
                     }
@@ -316,6 +333,17 @@ namespace Aws
                 return false;
             }
 
+            size_t SymmetricCryptoBufSink::WriteToSink(const CryptoBuffer& data, size_t skip)
+            {
+                if (skip >= data.GetLength())
+                {
+                    return skip - data.GetLength();
+                }
+
+                m_stream.write(reinterpret_cast<const char*>(data.GetUnderlyingData() + skip), data.GetLength() - skip);
+                return 0;
+            }
+
             SymmetricCryptoBufSink::int_type SymmetricCryptoBufSink::overflow(int_type ch)
             {
                 if(m_cipher && m_stream)
@@ -0,0 +1,213 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/Sha256TreeHash.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstring>
+#include <thread>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char* TREE_HASH_LOG_TAG = "Sha256TreeHash";
+
+const size_t Sha256TreeHash::LEAF_SIZE = 1024 * 1024;
+
+namespace
+{
+    /**
+     * The leaves of one Update() call. Shared with the executor tasks, a task that only starts once all the leaves are taken finds nothing to do,
+     * so the caller never waits for tasks, only for leaves, and the data isn't touched after Update() returns.
+     */
+    struct LeafHashJob
+    {
+        LeafHashJob(const unsigned char* leafData, size_t leafDataLength) :
+            data(leafData), length(leafDataLength), leafCount((leafDataLength + Sha256TreeHash::LEAF_SIZE - 1) / Sha256TreeHash::LEAF_SIZE),
+            hashes(leafCount), nextLeaf(0), finishedLeaves(0), failed(false)
+        {
+        }
+
+        void HashLeaves()
+        {
+            Sha256 hash;
+            size_t leaf;
+            while ((leaf = nextLeaf.fetch_add(1)) < leafCount)
+            {
+                size_t leafOffset = leaf * Sha256TreeHash::LEAF_SIZE;
+                hash.Update(data + leafOffset, (std::min)(Sha256TreeHash::LEAF_SIZE, length - leafOffset));
+                auto hashResult = hash.GetHash();
+
+                std::lock_guard<std::mutex> locker(mutex);
+                if (hashResult.IsSuccess())
+                {
+                    hashes[leaf] = hashResult.GetResult();
+                }
+                else
+                {
+                    failed = true;
+                }
+                if (++finishedLeaves == leafCount)
+                {
+                    done.notify_all();
+                }
+            }
+        }
+
+        const unsigned char* data;
+        size_t length;
+        size_t leafCount;
+        Aws::Vector<ByteBuffer> hashes;
+        std::atomic<size_t> nextLeaf;
+        size_t finishedLeaves;
+        bool failed;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+}
+
+Sha256TreeHash::Sha256TreeHash(Aws::Utils::Threading::Executor* executor, size_t parallelism) :
+    m_executor(executor),
+    m_parallelism(parallelism > 0 ? parallelism : (std::max)(1u, std::thread::hardware_concurrency()))
+{
+}
+
+bool Sha256TreeHash::Update(uint64_t offset, const unsigned char* data, size_t length)
+{
+    if (offset % LEAF_SIZE != 0)
+    {
+        AWS_LOGSTREAM_ERROR(TREE_HASH_LOG_TAG, "Tree hash data must start at a leaf boundary, offset " << offset << " isn't a multiple of " << LEAF_SIZE);
+        return false;
+    }
+    if (length == 0)
+    {
+        return true;
+    }
+
+    auto job = Aws::MakeShared<LeafHashJob>(TREE_HASH_LOG_TAG, data, length);
+    if (m_executor && job->leafCount > 1)
+    {
+        size_t helpers = (std::min)(job->leafCount, m_parallelism) - 1;
+        for (size_t i = 0; i < helpers; ++i)
+        {
+            if (!m_executor->Submit([job]() { job->HashLeaves(); }))
+            {
+                break;
+            }
+        }
+    }
+
+    // the calling thread hashes leaves too, so this makes progress even if the executor is busy (or is what runs the caller).
+    job->HashLeaves();
+    {
+        std::unique_lock<std::mutex> locker(job->mutex);
+        job->done.wait(locker, [&job]() { return job->finishedLeaves == job->leafCount; });
+        if (job->failed)
+        {
+            AWS_LOGSTREAM_ERROR(TREE_HASH_LOG_TAG, "Failed to hash (sha256) the leaves of " << length << " bytes at offset " << offset);
+            return false;
+        }
+    }
+
+    size_t firstLeaf = static_cast<size_t>(offset / LEAF_SIZE);
+    std::lock_guard<std::mutex> locker(m_leafHashesLock);
+    if (m_leafHashes.size() < firstLeaf + job->leafCount)
+    {
+        m_leafHashes.resize(firstLeaf + job->leafCount);
+    }
+    std::move(job->hashes.begin(), job->hashes.end(), m_leafHashes.begin() + firstLeaf);
+    return true;
+}
+
+ByteBuffer Sha256TreeHash::GetRangeHash(uint64_t offset, uint64_t length) const
+{
+    if (offset % LEAF_SIZE != 0)
+    {
+        AWS_LOGSTREAM_ERROR(TREE_HASH_LOG_TAG, "Tree hash ranges must start at a leaf boundary, offset " << offset << " isn't a multiple of " << LEAF_SIZE);
+        return ByteBuffer();
+    }
+    if (length == 0)
+    {
+        return Sha256().Calculate("").GetResult();
+    }
+
+    size_t begin = static_cast<size_t>(offset / LEAF_SIZE);
+    size_t end = static_cast<size_t>((offset + length + LEAF_SIZE - 1) / LEAF_SIZE);
+    std::lock_guard<std::mutex> locker(m_leafHashesLock);
+    if (end > m_leafHashes.size())
+    {
+        return ByteBuffer();
+    }
+    for (size_t leaf = begin; leaf < end; ++leaf)
+    {
+        if (m_leafHashes[leaf].GetLength() == 0)
+        {
+            return ByteBuffer();
+        }
+    }
+    return ComputeTreeHash(m_leafHashes, begin, end);
+}
+
+ByteBuffer Sha256TreeHash::GetHash() const
+{
+    size_t leafCount = 0;
+    {
+        std::lock_guard<std::mutex> locker(m_leafHashesLock);
+        leafCount = m_leafHashes.size();
+    }
+    return GetRangeHash(0, static_cast<uint64_t>(leafCount) * LEAF_SIZE);
+}
+
+void Sha256TreeHash::Reset()
+{
+    std::lock_guard<std::mutex> locker(m_leafHashesLock);
+    m_leafHashes.clear();
+}
+
+ByteBuffer Sha256TreeHash::ComputeTreeHash(const Aws::Vector<ByteBuffer>& leafHashes, size_t begin, size_t end)
+{
+    assert(begin < end && end <= leafHashes.size());
+
+    // O(n) time complexity of merging (n + n/2 + n/4 + n/8 +...+ 1), each level is built in place of the one below it.
+    Aws::Vector<ByteBuffer> level(leafHashes.begin() + begin, leafHashes.begin() + end);
+    Sha256 hash;
+    unsigned char pair[64];
+    while (level.size() > 1)
+    {
+        size_t combined = 0;
+        for (size_t i = 0; i + 1 < level.size(); i += 2)
+        {
+            memcpy(pair, level[i].GetUnderlyingData(), 32);
+            memcpy(pair + 32, level[i + 1].GetUnderlyingData(), 32);
+            hash.Update(pair, sizeof(pair));
+            level[combined++] = hash.GetHash().GetResult();
+        }
+        // if only one element is left, it goes up to the next level as is.
+        if (level.size() % 2 == 1)
+        {
+            level[combined++] = std::move(level.back());
+        }
+        level.resize(combined);
+    }
+
+    return level.front();
+}
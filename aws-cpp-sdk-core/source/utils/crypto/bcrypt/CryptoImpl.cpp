@@ -128,6 +128,9 @@ namespace Aws
                 m_hashBuffer(nullptr),
                 m_hashObjectLength(0),
                 m_hashObject(nullptr),
+                m_incrementalHashHandle(nullptr),
+                m_incrementalHashObject(nullptr),
+                m_incrementalHashFailed(false),
                 m_algorithmMutex()
             {
                 NTSTATUS status = BCryptOpenAlgorithmProvider(&m_algorithmHandle, algorithmName, MS_PRIMITIVE_PROVIDER, isHMAC ? BCRYPT_ALG_HANDLE_HMAC_FLAG : 0);
@@ -166,10 +169,23 @@ namespace Aws
                     AWS_LOGSTREAM_ERROR(logTag, "Error allocating hash object.");
                     return;
                 }
+
+                m_incrementalHashObject = Aws::NewArray<BYTE>(m_hashObjectLength, logTag);
+                if (!m_incrementalHashObject)
+                {
+                    AWS_LOGSTREAM_ERROR(logTag, "Error allocating incremental hash object.");
+                    return;
+                }
             }
 
             BCryptHashImpl::~BCryptHashImpl()
             {
+                if (m_incrementalHashHandle)
+                {
+                    BCryptDestroyHash(m_incrementalHashHandle);
+                }
+
+                Aws::DeleteArray(m_incrementalHashObject);
                 Aws::DeleteArray(m_hashObject);
                 Aws::DeleteArray(m_hashBuffer);
 
@@ -238,7 +254,83 @@ namespace Aws
 
             bool BCryptHashImpl::IsValid() const
             {
-                return m_hashBuffer != nullptr && m_hashBufferLength > 0 && m_hashObject != nullptr && m_hashObjectLength > 0;
+                return m_hashBuffer != nullptr && m_hashBufferLength > 0 && m_hashObject != nullptr && m_hashObjectLength > 0 && m_incrementalHashObject != nullptr;
+            }
+
+            void BCryptHashImpl::Update(const unsigned char* buffer, size_t bufferSize)
+            {
+                if (!IsValid())
+                {
+                    m_incrementalHashFailed = true;
+                    return;
+                }
+
+                std::lock_guard<std::mutex> locker(m_algorithmMutex);
+                if (m_incrementalHashFailed)
+                {
+                    return;
+                }
+
+                if (!m_incrementalHashHandle)
+                {
+                    NTSTATUS status = BCryptCreateHash(m_algorithmHandle, &m_incrementalHashHandle, m_incrementalHashObject, m_hashObjectLength, nullptr, 0, 0);
+                    if (!NT_SUCCESS(status))
+                    {
+                        AWS_LOGSTREAM_ERROR(logTag, "Error creating hash handle.");
+                        m_incrementalHashHandle = nullptr;
+                        m_incrementalHashFailed = true;
+                        return;
+                    }
+                }
+
+                if (bufferSize == 0)
+                {
+                    return;
+                }
+
+                NTSTATUS status = BCryptHashData(m_incrementalHashHandle, const_cast<PBYTE>(buffer), static_cast<ULONG>(bufferSize), 0);
+                if (!NT_SUCCESS(status))
+                {
+                    AWS_LOGSTREAM_ERROR(logTag, "Error computing hash.");
+                    m_incrementalHashFailed = true;
+                }
+            }
+
+            HashResult BCryptHashImpl::GetHash()
+            {
+                if (!m_incrementalHashHandle && !m_incrementalHashFailed)
+                {
+                    //nothing was hashed, finish the hash of no data.
+                    Update(nullptr, 0);
+                }
+
+                std::lock_guard<std::mutex> locker(m_algorithmMutex);
+                bool failed = m_incrementalHashFailed;
+                m_incrementalHashFailed = false;
+
+                NTSTATUS status = 0;
+                if (!failed)
+                {
+                    status = BCryptFinishHash(m_incrementalHashHandle, m_hashBuffer, m_hashBufferLength, 0);
+                    if (!NT_SUCCESS(status))
+                    {
+                        AWS_LOGSTREAM_ERROR(logTag, "Error obtaining computed hash");
+                        failed = true;
+                    }
+                }
+
+                if (m_incrementalHashHandle)
+                {
+                    BCryptDestroyHash(m_incrementalHashHandle);
+                    m_incrementalHashHandle = nullptr;
+                }
+
+                if (failed)
+                {
+                    return HashResult();
+                }
+
+                return HashResult(ByteBuffer(m_hashBuffer, m_hashBufferLength));
             }
 
             bool BCryptHashImpl::HashStream(Aws::IStream& stream)
@@ -325,6 +417,16 @@ namespace Aws
                 return m_impl.Calculate(stream);
             }
 
+            void MD5BcryptImpl::Update(const unsigned char* buffer, size_t bufferSize)
+            {
+                m_impl.Update(buffer, bufferSize);
+            }
+
+            HashResult MD5BcryptImpl::GetHash()
+            {
+                return m_impl.GetHash();
+            }
+
             Sha256BcryptImpl::Sha256BcryptImpl() :
                 m_impl(BCRYPT_SHA256_ALGORITHM, false)
             {
@@ -340,6 +442,16 @@ namespace Aws
                 return m_impl.Calculate(stream);
             }
 
+            void Sha256BcryptImpl::Update(const unsigned char* buffer, size_t bufferSize)
+            {
+                m_impl.Update(buffer, bufferSize);
+            }
+
+            HashResult Sha256BcryptImpl::GetHash()
+            {
+                return m_impl.GetHash();
+            }
+
             Sha256HMACBcryptImpl::Sha256HMACBcryptImpl() :
                 m_impl(BCRYPT_SHA256_ALGORITHM, true)
             {
@@ -147,6 +147,59 @@ namespace Aws
                 EVP_MD_CTX *m_ctx;
             };
 
+            static void StartIncrementalDigest(EVP_MD_CTX* ctx, const EVP_MD* digest, bool allowNonFips)
+            {
+                if (allowNonFips)
+                {
+                    EVP_MD_CTX_set_flags(ctx, EVP_MD_CTX_FLAG_NON_FIPS_ALLOW);
+                }
+                EVP_DigestInit_ex(ctx, digest, nullptr);
+            }
+
+            static HashResult FinishIncrementalDigest(EVP_MD_CTX* ctx, const EVP_MD* digest, bool allowNonFips, bool& started)
+            {
+                if (!started)
+                {
+                    StartIncrementalDigest(ctx, digest, allowNonFips);
+                }
+                started = false;
+
+                ByteBuffer hash(EVP_MD_size(digest));
+                if (!EVP_DigestFinal_ex(ctx, hash.GetUnderlyingData(), nullptr))
+                {
+                    return HashResult();
+                }
+
+                return HashResult(std::move(hash));
+            }
+
+            MD5OpenSSLImpl::MD5OpenSSLImpl() :
+                m_ctx(EVP_MD_CTX_create()),
+                m_started(false)
+            {
+                assert(m_ctx != nullptr);
+            }
+
+            MD5OpenSSLImpl::~MD5OpenSSLImpl()
+            {
+                EVP_MD_CTX_destroy(m_ctx);
+            }
+
+            void MD5OpenSSLImpl::Update(const unsigned char* buffer, size_t bufferSize)
+            {
+                if (!m_started)
+                {
+                    StartIncrementalDigest(m_ctx, EVP_md5(), true);
+                    m_started = true;
+                }
+                EVP_DigestUpdate(m_ctx, buffer, bufferSize);
+            }
+
+            HashResult MD5OpenSSLImpl::GetHash()
+            {
+                return FinishIncrementalDigest(m_ctx, EVP_md5(), true, m_started);
+            }
+
             HashResult MD5OpenSSLImpl::Calculate(const Aws::String& str)
             {
                 OpensslCtxRAIIGuard guard;
@@ -197,6 +250,33 @@ namespace Aws
                 return HashResult(std::move(hash));
             }
 
+            Sha256OpenSSLImpl::Sha256OpenSSLImpl() :
+                m_ctx(EVP_MD_CTX_create()),
+                m_started(false)
+            {
+                assert(m_ctx != nullptr);
+            }
+
+            Sha256OpenSSLImpl::~Sha256OpenSSLImpl()
+            {
+                EVP_MD_CTX_destroy(m_ctx);
+            }
+
+            void Sha256OpenSSLImpl::Update(const unsigned char* buffer, size_t bufferSize)
+            {
+                if (!m_started)
+                {
+                    StartIncrementalDigest(m_ctx, EVP_sha256(), false);
+                    m_started = true;
+                }
+                EVP_DigestUpdate(m_ctx, buffer, bufferSize);
+            }
+
+            HashResult Sha256OpenSSLImpl::GetHash()
+            {
+                return FinishIncrementalDigest(m_ctx, EVP_sha256(), false, m_started);
+            }
+
             HashResult Sha256OpenSSLImpl::Calculate(const Aws::String& str)
             {
                 OpensslCtxRAIIGuard guard;
@@ -0,0 +1,173 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/json/JsonArena.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Aws::Utils::Json;
+
+static const char* JSON_ARENA_ALLOCATION_TAG = "JsonArena";
+
+// nodes hold doubles and pointers, strings need no alignment but are rounded up as well so that the next node is aligned.
+static const size_t ALIGNMENT = alignof(double) > alignof(void*) ? alignof(double) : alignof(void*);
+// small documents, e.g. the ones model objects Jsonize() into before being added to their parent's, fit in the first block.
+static const size_t FIRST_BLOCK_SIZE = 256;
+static const size_t MAX_BLOCK_SIZE = 64 * 1024;
+
+static size_t AlignUp(size_t size)
+{
+    return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+JsonArena::JsonArena() :
+    m_blocks(nullptr),
+    m_lastBlock(nullptr),
+    m_next(nullptr),
+    m_end(nullptr),
+    m_nextBlockSize(FIRST_BLOCK_SIZE),
+    m_capacity(0)
+{
+}
+
+JsonArena::~JsonArena()
+{
+    Clear();
+}
+
+JsonArena::JsonArena(JsonArena&& other) :
+    m_blocks(other.m_blocks),
+    m_lastBlock(other.m_lastBlock),
+    m_next(other.m_next),
+    m_end(other.m_end),
+    m_nextBlockSize(other.m_nextBlockSize),
+    m_capacity(other.m_capacity)
+{
+    other.m_blocks = nullptr;
+    other.m_lastBlock = nullptr;
+    other.m_next = nullptr;
+    other.m_end = nullptr;
+    other.m_nextBlockSize = FIRST_BLOCK_SIZE;
+    other.m_capacity = 0;
+}
+
+JsonArena& JsonArena::operator=(JsonArena&& other)
+{
+    if (this != &other)
+    {
+        Clear();
+        Adopt(other);
+    }
+    return *this;
+}
+
+void* JsonArena::Allocate(size_t size)
+{
+    size = AlignUp(size);
+    if (static_cast<size_t>(m_end - m_next) < size)
+    {
+        return AllocateFromNewBlock(size);
+    }
+
+    void* memory = m_next;
+    m_next += size;
+    return memory;
+}
+
+char* JsonArena::CopyString(const char* str, size_t length)
+{
+    char* copy = static_cast<char*>(Allocate(length + 1));
+    if (length > 0)
+    {
+        memcpy(copy, str, length);
+    }
+    copy[length] = '\0';
+    return copy;
+}
+
+void* JsonArena::AllocateFromNewBlock(size_t size)
+{
+    static const size_t headerSize = AlignUp(sizeof(Block));
+
+    size_t blockSize = (std::max)(m_nextBlockSize, headerSize + size);
+    auto block = static_cast<Block*>(Aws::Malloc(JSON_ARENA_ALLOCATION_TAG, blockSize));
+    block->next = m_blocks;
+    m_blocks = block;
+    if (!m_lastBlock)
+    {
+        m_lastBlock = block;
+    }
+    m_capacity += blockSize;
+    m_nextBlockSize = (std::min)(m_nextBlockSize * 2, MAX_BLOCK_SIZE);
+
+    char* memory = reinterpret_cast<char*>(block) + headerSize;
+    // an allocation too big for a regular block gets a block of its own, what is left of the current block is still used after it.
+    if (blockSize - headerSize - size >= static_cast<size_t>(m_end - m_next))
+    {
+        m_next = memory + size;
+        m_end = reinterpret_cast<char*>(block) + blockSize;
+    }
+    return memory;
+}
+
+void JsonArena::Adopt(JsonArena& other)
+{
+    if (this == &other || !other.m_blocks)
+    {
+        return;
+    }
+
+    if (m_blocks)
+    {
+        m_lastBlock->next = other.m_blocks;
+    }
+    else
+    {
+        m_blocks = other.m_blocks;
+    }
+    m_lastBlock = other.m_lastBlock;
+    // keep allocating from whichever of the two current blocks has the most room left.
+    if (other.m_end - other.m_next > m_end - m_next)
+    {
+        m_next = other.m_next;
+        m_end = other.m_end;
+    }
+    m_nextBlockSize = (std::max)(m_nextBlockSize, other.m_nextBlockSize);
+    m_capacity += other.m_capacity;
+
+    other.m_blocks = nullptr;
+    other.m_lastBlock = nullptr;
+    other.m_next = nullptr;
+    other.m_end = nullptr;
+    other.m_nextBlockSize = FIRST_BLOCK_SIZE;
+    other.m_capacity = 0;
+}
+
+void JsonArena::Clear()
+{
+    while (m_blocks)
+    {
+        Block* next = m_blocks->next;
+        Aws::Free(m_blocks);
+        m_blocks = next;
+    }
+    m_lastBlock = nullptr;
+    m_next = nullptr;
+    m_end = nullptr;
+    m_nextBlockSize = FIRST_BLOCK_SIZE;
+    m_capacity = 0;
+}
@@ -0,0 +1,692 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+
+const size_t JsonReader::DEFAULT_CHUNK_SIZE = 16 * 1024;
+
+static inline bool IsWhitespace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static inline bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+static inline bool IsNumberCharacter(char c)
+{
+    return IsDigit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+// -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+static bool IsValidNumber(const char* text, size_t length)
+{
+    size_t i = 0;
+    if (i < length && text[i] == '-')
+    {
+        ++i;
+    }
+    if (i == length || !IsDigit(text[i]))
+    {
+        return false;
+    }
+    if (text[i++] != '0')
+    {
+        while (i < length && IsDigit(text[i]))
+        {
+            ++i;
+        }
+    }
+    if (i < length && text[i] == '.')
+    {
+        size_t fractionStart = ++i;
+        while (i < length && IsDigit(text[i]))
+        {
+            ++i;
+        }
+        if (i == fractionStart)
+        {
+            return false;
+        }
+    }
+    if (i < length && (text[i] == 'e' || text[i] == 'E'))
+    {
+        if (++i < length && (text[i] == '+' || text[i] == '-'))
+        {
+            ++i;
+        }
+        size_t exponentStart = i;
+        while (i < length && IsDigit(text[i]))
+        {
+            ++i;
+        }
+        if (i == exponentStart)
+        {
+            return false;
+        }
+    }
+    return i == length;
+}
+
+static bool ParseHex4(const char* text, unsigned& codePoint)
+{
+    codePoint = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        char c = text[i];
+        codePoint <<= 4;
+        if (IsDigit(c))
+        {
+            codePoint |= static_cast<unsigned>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            codePoint |= static_cast<unsigned>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            codePoint |= static_cast<unsigned>(c - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void AppendUtf8(Aws::String& text, unsigned codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        text.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        text.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        text.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        text.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        text.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        text.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        text.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+JsonReader::JsonReader() :
+    m_stream(nullptr),
+    m_chunkSize(0),
+    m_inputEnded(false),
+    m_position(0),
+    m_discarded(0),
+    m_expect(Expect::Value),
+    m_tokenType(JsonTokenType::NeedMoreInput),
+    m_hasPeeked(false),
+    m_peekedType(JsonTokenType::NeedMoreInput),
+    m_failed(false)
+{
+}
+
+JsonReader::JsonReader(Aws::IStream& stream, size_t chunkSize) :
+    m_stream(&stream),
+    m_chunkSize(chunkSize > 0 ? chunkSize : DEFAULT_CHUNK_SIZE),
+    m_inputEnded(false),
+    m_position(0),
+    m_discarded(0),
+    m_expect(Expect::Value),
+    m_tokenType(JsonTokenType::NeedMoreInput),
+    m_hasPeeked(false),
+    m_peekedType(JsonTokenType::NeedMoreInput),
+    m_failed(false)
+{
+}
+
+void JsonReader::Feed(const char* data, size_t length)
+{
+    Compact();
+    m_buffer.append(data, length);
+}
+
+void JsonReader::EndOfInput()
+{
+    m_inputEnded = true;
+}
+
+JsonTokenType JsonReader::Next()
+{
+    if (m_hasPeeked)
+    {
+        m_hasPeeked = false;
+        m_tokenType = m_peekedType;
+        m_tokenText.swap(m_peekedText);
+        return m_tokenType;
+    }
+
+    m_tokenType = ReadToken(m_tokenText);
+    return m_tokenType;
+}
+
+JsonTokenType JsonReader::Peek()
+{
+    if (!m_hasPeeked)
+    {
+        JsonTokenType type = ReadToken(m_peekedText);
+        if (type == JsonTokenType::NeedMoreInput)
+        {
+            return type;
+        }
+        m_peekedType = type;
+        m_hasPeeked = true;
+    }
+    return m_peekedType;
+}
+
+bool JsonReader::StartObject()
+{
+    JsonTokenType type = Next();
+    if (type == JsonTokenType::StartObject)
+    {
+        return true;
+    }
+    SkipRestOfValue(type);
+    return false;
+}
+
+bool JsonReader::NextMember()
+{
+    return Next() == JsonTokenType::MemberName;
+}
+
+bool JsonReader::StartArray()
+{
+    JsonTokenType type = Next();
+    if (type == JsonTokenType::StartArray)
+    {
+        return true;
+    }
+    SkipRestOfValue(type);
+    return false;
+}
+
+bool JsonReader::NextElement()
+{
+    switch (Peek())
+    {
+        case JsonTokenType::EndArray:
+            Next();
+            return false;
+        case JsonTokenType::Error:
+        case JsonTokenType::NeedMoreInput:
+        case JsonTokenType::EndOfDocument:
+            return false;
+        default:
+            return true;
+    }
+}
+
+Aws::String JsonReader::ReadString()
+{
+    Aws::String value;
+    JsonTokenType type = Next();
+    if (type == JsonTokenType::String)
+    {
+        // the value goes to the model as is, no need to copy it.
+        value.swap(m_tokenText);
+    }
+    else
+    {
+        SkipRestOfValue(type);
+    }
+    return value;
+}
+
+bool JsonReader::ReadBool()
+{
+    JsonTokenType type = Next();
+    SkipRestOfValue(type);
+    return type == JsonTokenType::True;
+}
+
+int JsonReader::ReadInteger()
+{
+    return static_cast<int>(ReadInt64());
+}
+
+int64_t JsonReader::ReadInt64()
+{
+    JsonTokenType type = Next();
+    if (type != JsonTokenType::Number)
+    {
+        SkipRestOfValue(type);
+        return 0;
+    }
+    if (m_tokenText.find_first_of(".eE") == Aws::String::npos)
+    {
+        return static_cast<int64_t>(strtoll(m_tokenText.c_str(), nullptr, 10));
+    }
+    return static_cast<int64_t>(strtod(m_tokenText.c_str(), nullptr));
+}
+
+double JsonReader::ReadDouble()
+{
+    JsonTokenType type = Next();
+    if (type != JsonTokenType::Number)
+    {
+        SkipRestOfValue(type);
+        return 0.0;
+    }
+    return strtod(m_tokenText.c_str(), nullptr);
+}
+
+void JsonReader::SkipValue()
+{
+    SkipRestOfValue(Next());
+}
+
+void JsonReader::SkipRestOfValue(JsonTokenType firstToken)
+{
+    if (firstToken != JsonTokenType::StartObject && firstToken != JsonTokenType::StartArray)
+    {
+        return;
+    }
+
+    size_t depth = 1;
+    while (depth > 0)
+    {
+        switch (Next())
+        {
+            case JsonTokenType::StartObject:
+            case JsonTokenType::StartArray:
+                ++depth;
+                break;
+            case JsonTokenType::EndObject:
+            case JsonTokenType::EndArray:
+                --depth;
+                break;
+            case JsonTokenType::Error:
+            case JsonTokenType::NeedMoreInput:
+            case JsonTokenType::EndOfDocument:
+                return;
+            default:
+                break;
+        }
+    }
+}
+
+JsonTokenType JsonReader::ReadToken(Aws::String& text)
+{
+    for (;;)
+    {
+        if (m_failed)
+        {
+            return JsonTokenType::Error;
+        }
+
+        const char* data = m_buffer.data();
+        size_t size = m_buffer.size();
+        while (m_position < size)
+        {
+            char c = data[m_position];
+            if (IsWhitespace(c))
+            {
+                ++m_position;
+            }
+            else if (m_expect == Expect::Colon)
+            {
+                if (c != ':')
+                {
+                    return Fail("Expected ':' after a member name");
+                }
+                ++m_position;
+                m_expect = Expect::Value;
+            }
+            else if (m_expect == Expect::CommaOrEnd && c == ',')
+            {
+                ++m_position;
+                m_expect = m_containers.back() ? Expect::MemberName : Expect::Value;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (m_position == size)
+        {
+            if (Refill())
+            {
+                continue;
+            }
+            if (!m_inputEnded)
+            {
+                return JsonTokenType::NeedMoreInput;
+            }
+            // nothing at all is an empty document rather than a malformed one, e.g. the empty body of a response.
+            if (m_expect == Expect::Done || (m_expect == Expect::Value && m_containers.empty()))
+            {
+                return JsonTokenType::EndOfDocument;
+            }
+            return Fail("Unexpected end of the document");
+        }
+
+        char c = data[m_position];
+        switch (m_expect)
+        {
+            case Expect::Done:
+                return Fail("Unexpected characters after the end of the document");
+            case Expect::CommaOrEnd:
+                if (c != '}' && c != ']')
+                {
+                    return Fail("Expected ',' or the end of the object or array");
+                }
+                break;
+            case Expect::MemberName:
+                if (c != '"')
+                {
+                    return Fail("Expected a member name");
+                }
+                break;
+            case Expect::MemberNameOrEnd:
+                if (c != '"' && c != '}')
+                {
+                    return Fail("Expected a member name or the end of the object");
+                }
+                break;
+            case Expect::Value:
+                if (c == ']' || c == '}')
+                {
+                    return Fail("Expected a value");
+                }
+                break;
+            case Expect::ValueOrEnd:
+                if (c == '}')
+                {
+                    return Fail("Expected a value or the end of the array");
+                }
+                break;
+            default:
+                break;
+        }
+
+        JsonTokenType type = JsonTokenType::Error;
+        size_t end = m_position + 1;
+        switch (c)
+        {
+            case '{':
+                m_containers.push_back(true);
+                m_expect = Expect::MemberNameOrEnd;
+                m_position = end;
+                return JsonTokenType::StartObject;
+            case '[':
+                m_containers.push_back(false);
+                m_expect = Expect::ValueOrEnd;
+                m_position = end;
+                return JsonTokenType::StartArray;
+            case '}':
+            case ']':
+                if (m_containers.empty() || m_containers.back() != (c == '}'))
+                {
+                    return Fail("Mismatched end of object or array");
+                }
+                m_containers.pop_back();
+                m_position = end;
+                AfterValue();
+                return c == '}' ? JsonTokenType::EndObject : JsonTokenType::EndArray;
+            case '"':
+                type = ReadStringToken(text, end);
+                break;
+            case 't':
+                type = ReadLiteralToken("true", 4, JsonTokenType::True, end);
+                break;
+            case 'f':
+                type = ReadLiteralToken("false", 5, JsonTokenType::False, end);
+                break;
+            case 'n':
+                type = ReadLiteralToken("null", 4, JsonTokenType::Null, end);
+                break;
+            default:
+                if (c != '-' && !IsDigit(c))
+                {
+                    return Fail("Unexpected character");
+                }
+                type = ReadNumberToken(text, end);
+                break;
+        }
+
+        if (type == JsonTokenType::NeedMoreInput)
+        {
+            // the token is read again from its start once there is more input.
+            if (Refill())
+            {
+                continue;
+            }
+            return type;
+        }
+        if (type == JsonTokenType::Error)
+        {
+            return type;
+        }
+
+        m_position = end;
+        if (m_expect == Expect::MemberName || m_expect == Expect::MemberNameOrEnd)
+        {
+            m_expect = Expect::Colon;
+            return JsonTokenType::MemberName;
+        }
+        AfterValue();
+        return type;
+    }
+}
+
+JsonTokenType JsonReader::ReadStringToken(Aws::String& text, size_t& end)
+{
+    const char* data = m_buffer.data();
+    size_t size = m_buffer.size();
+    size_t start = m_position + 1;
+    size_t i = start;
+    bool hasEscapes = false;
+    // finds the closing quote first, so that text is only touched once the whole string is there.
+    for (; i < size; ++i)
+    {
+        char c = data[i];
+        if (c == '"')
+        {
+            break;
+        }
+        if (c == '\\')
+        {
+            hasEscapes = true;
+            i += i + 1 < size && data[i + 1] == 'u' ? 5 : 1;
+        }
+    }
+    if (i >= size)
+    {
+        return m_inputEnded ? Fail("Unterminated string") : JsonTokenType::NeedMoreInput;
+    }
+    end = i + 1;
+
+    if (!hasEscapes)
+    {
+        text.assign(data + start, i - start);
+        return JsonTokenType::String;
+    }
+
+    text.clear();
+    text.reserve(i - start);
+    for (size_t j = start; j < i; ++j)
+    {
+        char c = data[j];
+        if (c != '\\')
+        {
+            text.push_back(c);
+            continue;
+        }
+        switch (data[++j])
+        {
+            case '"': text.push_back('"'); break;
+            case '\\': text.push_back('\\'); break;
+            case '/': text.push_back('/'); break;
+            case 'b': text.push_back('\b'); break;
+            case 'f': text.push_back('\f'); break;
+            case 'n': text.push_back('\n'); break;
+            case 'r': text.push_back('\r'); break;
+            case 't': text.push_back('\t'); break;
+            case 'u':
+            {
+                unsigned codePoint = 0;
+                if (!ParseHex4(data + j + 1, codePoint))
+                {
+                    return Fail("Invalid unicode escape in string");
+                }
+                j += 4;
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                {
+                    // a code point above the basic multilingual plane, escaped as a surrogate pair.
+                    unsigned lowSurrogate = 0;
+                    if (j + 6 >= i || data[j + 1] != '\\' || data[j + 2] != 'u' || !ParseHex4(data + j + 3, lowSurrogate)
+                            || lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+                    {
+                        return Fail("Invalid surrogate pair in string");
+                    }
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                    j += 6;
+                }
+                else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF)
+                {
+                    return Fail("Invalid surrogate pair in string");
+                }
+                AppendUtf8(text, codePoint);
+                break;
+            }
+            default:
+                return Fail("Invalid escape in string");
+        }
+    }
+    return JsonTokenType::String;
+}
+
+JsonTokenType JsonReader::ReadNumberToken(Aws::String& text, size_t& end)
+{
+    const char* data = m_buffer.data();
+    size_t size = m_buffer.size();
+    size_t i = m_position;
+    while (i < size && IsNumberCharacter(data[i]))
+    {
+        ++i;
+    }
+    if (i == size && !m_inputEnded)
+    {
+        return JsonTokenType::NeedMoreInput;
+    }
+    if (!IsValidNumber(data + m_position, i - m_position))
+    {
+        return Fail("Invalid number");
+    }
+    text.assign(data + m_position, i - m_position);
+    end = i;
+    return JsonTokenType::Number;
+}
+
+JsonTokenType JsonReader::ReadLiteralToken(const char* literal, size_t literalLength, JsonTokenType type, size_t& end)
+{
+    size_t available = m_buffer.size() - m_position;
+    size_t compared = (std::min)(available, literalLength);
+    if (memcmp(m_buffer.data() + m_position, literal, compared) != 0)
+    {
+        return Fail("Unexpected character");
+    }
+    if (compared < literalLength)
+    {
+        return m_inputEnded ? Fail("Unexpected end of the document") : JsonTokenType::NeedMoreInput;
+    }
+    end = m_position + literalLength;
+    return type;
+}
+
+bool JsonReader::Refill()
+{
+    if (!m_stream || m_inputEnded)
+    {
+        return false;
+    }
+
+    Compact();
+    // reads at least as much as is buffered, so that a token spanning many chunks isn't scanned again from its start for each of them.
+    size_t buffered = m_buffer.size();
+    size_t toRead = (std::max)(m_chunkSize, buffered);
+    m_buffer.resize(buffered + toRead);
+    m_stream->read(&m_buffer[buffered], static_cast<std::streamsize>(toRead));
+    size_t readCount = static_cast<size_t>(m_stream->gcount());
+    m_buffer.resize(buffered + readCount);
+    if (readCount < toRead)
+    {
+        m_inputEnded = true;
+    }
+    return true;
+}
+
+void JsonReader::Compact()
+{
+    if (m_position > 0)
+    {
+        m_buffer.erase(0, m_position);
+        m_discarded += m_position;
+        m_position = 0;
+    }
+}
+
+void JsonReader::AfterValue()
+{
+    m_expect = m_containers.empty() ? Expect::Done : Expect::CommaOrEnd;
+}
+
+Aws::String JsonReader::ReadRemainingInput()
+{
+    Aws::String remaining(m_buffer, m_position);
+    m_position = m_buffer.size();
+    while (Refill())
+    {
+        remaining.append(m_buffer, m_position, Aws::String::npos);
+        m_position = m_buffer.size();
+    }
+    return remaining;
+}
+
+JsonTokenType JsonReader::Fail(const char* message)
+{
+    m_failed = true;
+    Aws::StringStream ss;
+    ss << message << " at offset " << (m_discarded + m_position);
+    m_errorMessage = ss.str();
+    return JsonTokenType::Error;
+}
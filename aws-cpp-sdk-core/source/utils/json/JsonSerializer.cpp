@@ -14,63 +14,249 @@
   */
 
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
-#include <iterator>
 #include <algorithm>
-#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <climits>
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Json;
 
-JsonValue::JsonValue() : m_wasParseSuccessful(true)
+static const char* JSON_VALUE_LOG_TAG = "JsonValue";
+
+static cJSON* NewNode(JsonArena& arena, int type)
 {
-    m_value = nullptr;
+    auto node = static_cast<cJSON*>(arena.Allocate(sizeof(cJSON)));
+    memset(node, 0, sizeof(cJSON));
+    node->type = type;
+    return node;
 }
 
-JsonValue::JsonValue(cJSON* value) :
-    m_value(cJSON_Duplicate(value, true /* recurse */)),
-    m_wasParseSuccessful(true)
+static cJSON* NewString(JsonArena& arena, const char* value, size_t length)
+{
+    auto node = NewNode(arena, cJSON_String);
+    node->valuestring = arena.CopyString(value, length);
+    return node;
+}
+
+static cJSON* NewBool(JsonArena& arena, bool value)
+{
+    auto node = NewNode(arena, value ? cJSON_True : cJSON_False);
+    node->valueint = value ? 1 : 0;
+    return node;
+}
+
+static cJSON* NewNumber(JsonArena& arena, double value)
+{
+    auto node = NewNode(arena, cJSON_Number);
+    node->valuedouble = value;
+    // same saturation as cJSON
+    if (value >= INT_MAX)
+    {
+        node->valueint = INT_MAX;
+    }
+    else if (value <= INT_MIN)
+    {
+        node->valueint = INT_MIN;
+    }
+    else
+    {
+        node->valueint = static_cast<int>(value);
+    }
+    return node;
+}
+
+static cJSON* Duplicate(JsonArena& arena, const cJSON* item)
+{
+    auto copy = NewNode(arena, item->type);
+    copy->valueint = item->valueint;
+    copy->valuedouble = item->valuedouble;
+    if (item->valuestring)
+    {
+        copy->valuestring = arena.CopyString(item->valuestring, strlen(item->valuestring));
+    }
+    if (item->string)
+    {
+        copy->string = arena.CopyString(item->string, strlen(item->string));
+    }
+
+    cJSON* last = nullptr;
+    for (auto child = item->child; child; child = child->next)
+    {
+        auto childCopy = Duplicate(arena, child);
+        childCopy->prev = last;
+        if (last)
+        {
+            last->next = childCopy;
+        }
+        else
+        {
+            copy->child = childCopy;
+        }
+        last = childCopy;
+    }
+    return copy;
+}
+
+static void Append(cJSON* container, cJSON* last, cJSON* item)
+{
+    item->prev = last;
+    item->next = nullptr;
+    if (last)
+    {
+        last->next = item;
+    }
+    else
+    {
+        container->child = item;
+    }
+}
+
+static double ParseNumber(const Aws::String& text)
 {
+    // strtod uses the decimal point of the current locale, json always uses '.'
+    const char decimalPoint = *localeconv()->decimal_point;
+    if (decimalPoint == '.' || text.find('.') == Aws::String::npos)
+    {
+        return strtod(text.c_str(), nullptr);
+    }
+
+    Aws::String localized(text);
+    std::replace(localized.begin(), localized.end(), '.', decimalPoint);
+    return strtod(localized.c_str(), nullptr);
 }
 
-JsonValue::JsonValue(const Aws::String& value) : m_wasParseSuccessful(true)
+JsonValue::JsonValue() : m_value(nullptr), m_wasParseSuccessful(true)
 {
-    const char* return_parse_end;
-    m_value = cJSON_ParseWithOpts(value.c_str(), &return_parse_end, 1/*require_null_terminated*/);
+}
 
-    if (!m_value || cJSON_IsInvalid(m_value))
+JsonValue::JsonValue(cJSON* value) :
+    m_value(nullptr),
+    m_wasParseSuccessful(true)
+{
+    if (value)
     {
-        m_wasParseSuccessful = false;
-        m_errorMessage = "Failed to parse JSON at: ";
-        m_errorMessage += return_parse_end;
+        m_value = Duplicate(m_arena, value);
     }
 }
 
-JsonValue::JsonValue(Aws::IStream& istream) : m_wasParseSuccessful(true)
+JsonValue::JsonValue(const Aws::String& value) : m_value(nullptr), m_wasParseSuccessful(true)
 {
-    Aws::StringStream memoryStream;
-    std::copy(std::istreambuf_iterator<char>(istream), std::istreambuf_iterator<char>(), std::ostreambuf_iterator<char>(memoryStream));
-    const char* return_parse_end;
-    const auto input = memoryStream.str();
-    m_value = cJSON_ParseWithOpts(input.c_str(), &return_parse_end, 1/*require_null_terminated*/);
+    JsonReader reader;
+    reader.Feed(value.c_str(), value.size());
+    reader.EndOfInput();
+    Parse(reader, "Failed to parse JSON at: ");
+}
+
+JsonValue::JsonValue(Aws::IStream& istream) : m_value(nullptr), m_wasParseSuccessful(true)
+{
+    JsonReader reader(istream);
+    Parse(reader, "Failed to parse JSON. Invalid input at: ");
+}
 
-    if (!m_value || cJSON_IsInvalid(m_value))
+void JsonValue::Parse(JsonReader& reader, const char* errorMessagePrefix)
+{
+    struct Container
+    {
+        cJSON* node;
+        cJSON* lastChild;
+    };
+    Aws::Vector<Container> containers;
+    const char* memberName = nullptr;
+
+    for (;;)
     {
-        m_wasParseSuccessful = false;
-        m_errorMessage = "Failed to parse JSON. Invalid input at: ";
-        m_errorMessage += return_parse_end;
+        JsonTokenType token = reader.Next();
+        cJSON* node = nullptr;
+        switch (token)
+        {
+            case JsonTokenType::MemberName:
+                memberName = m_arena.CopyString(reader.GetTokenText().c_str(), reader.GetTokenText().size());
+                continue;
+            case JsonTokenType::EndObject:
+            case JsonTokenType::EndArray:
+                containers.pop_back();
+                continue;
+            case JsonTokenType::StartObject:
+                node = NewNode(m_arena, cJSON_Object);
+                break;
+            case JsonTokenType::StartArray:
+                node = NewNode(m_arena, cJSON_Array);
+                break;
+            case JsonTokenType::String:
+                node = NewString(m_arena, reader.GetTokenText().c_str(), reader.GetTokenText().size());
+                break;
+            case JsonTokenType::Number:
+                node = NewNumber(m_arena, ParseNumber(reader.GetTokenText()));
+                break;
+            case JsonTokenType::True:
+            case JsonTokenType::False:
+                node = NewBool(m_arena, token == JsonTokenType::True);
+                break;
+            case JsonTokenType::Null:
+                node = NewNode(m_arena, cJSON_NULL);
+                break;
+            case JsonTokenType::EndOfDocument:
+                if (m_value)
+                {
+                    return;
+                }
+                // an empty document, which cJSON never accepted either.
+                m_errorMessage = errorMessagePrefix;
+                m_wasParseSuccessful = false;
+                return;
+            default:
+                AWS_LOGSTREAM_DEBUG(JSON_VALUE_LOG_TAG, "Failed to parse JSON: " << reader.GetErrorMessage());
+                m_errorMessage = errorMessagePrefix;
+                m_errorMessage += reader.ReadRemainingInput();
+                m_wasParseSuccessful = false;
+                Destroy();
+                return;
+        }
+
+        if (containers.empty())
+        {
+            m_value = node;
+        }
+        else
+        {
+            Container& parent = containers.back();
+            if (cJSON_IsObject(parent.node))
+            {
+                node->string = const_cast<char*>(memberName);
+            }
+            Append(parent.node, parent.lastChild, node);
+            parent.lastChild = node;
+        }
+
+        if (token == JsonTokenType::StartObject || token == JsonTokenType::StartArray)
+        {
+            containers.push_back({node, nullptr});
+        }
     }
 }
 
 JsonValue::JsonValue(const JsonValue& value) :
-    m_value(cJSON_Duplicate(value.m_value, true/*recurse*/)),
+    m_value(nullptr),
     m_wasParseSuccessful(value.m_wasParseSuccessful),
     m_errorMessage(value.m_errorMessage)
 {
+    if (value.m_value)
+    {
+        m_value = Duplicate(m_arena, value.m_value);
+    }
 }
 
 JsonValue::JsonValue(JsonValue&& value) :
     m_value(value.m_value),
+    m_arena(std::move(value.m_arena)),
     m_wasParseSuccessful(value.m_wasParseSuccessful),
     m_errorMessage(std::move(value.m_errorMessage))
 {
@@ -79,7 +265,8 @@ JsonValue::JsonValue(JsonValue&& value) :
 
 void JsonValue::Destroy()
 {
-    cJSON_Delete(m_value);
+    m_value = nullptr;
+    m_arena.Clear();
 }
 
 JsonValue::~JsonValue()
@@ -95,7 +282,10 @@ JsonValue& JsonValue::operator=(const JsonValue& other)
     }
 
     Destroy();
-    m_value = cJSON_Duplicate(other.m_value, true /*recurse*/);
+    if (other.m_value)
+    {
+        m_value = Duplicate(m_arena, other.m_value);
+    }
     m_wasParseSuccessful = other.m_wasParseSuccessful;
     m_errorMessage = other.m_errorMessage;
     return *this;
@@ -111,32 +301,58 @@ JsonValue& JsonValue::operator=(JsonValue&& other)
     using std::swap;
     swap(m_value, other.m_value);
     swap(m_errorMessage, other.m_errorMessage);
+    JsonArena arena(std::move(m_arena));
+    m_arena = std::move(other.m_arena);
+    other.m_arena = std::move(arena);
     m_wasParseSuccessful = other.m_wasParseSuccessful;
     return *this;
 }
 
-static void AddOrReplace(cJSON* root, const char* key, cJSON* value)
+cJSON* JsonValue::NewObjectIfEmpty()
 {
-    const auto existing = cJSON_GetObjectItemCaseSensitive(root, key);
-    if (existing)
-    {
-        cJSON_ReplaceItemInObjectCaseSensitive(root, key, value);
-    }
-    else
+    if (!m_value)
     {
-        cJSON_AddItemToObject(root, key, value);
+        m_value = NewNode(m_arena, cJSON_Object);
     }
+    return m_value;
 }
 
-JsonValue& JsonValue::WithString(const char* key, const Aws::String& value)
+static void AddOrReplace(JsonArena& arena, cJSON* root, const char* key, cJSON* value)
 {
-    if (!m_value)
+    cJSON* last = nullptr;
+    for (auto child = root->child; child; child = child->next)
     {
-        m_value = cJSON_CreateObject();
+        if (child->string && strcmp(child->string, key) == 0)
+        {
+            // the replaced member stays in the arena until the document goes away, views of it are still valid.
+            value->string = child->string;
+            value->prev = child->prev;
+            value->next = child->next;
+            if (child->next)
+            {
+                child->next->prev = value;
+            }
+            if (child->prev)
+            {
+                child->prev->next = value;
+            }
+            else
+            {
+                root->child = value;
+            }
+            return;
+        }
+        last = child;
     }
 
-    const auto val = cJSON_CreateString(value.c_str());
-    AddOrReplace(m_value, key, val);
+    value->string = arena.CopyString(key, strlen(key));
+    Append(root, last, value);
+}
+
+JsonValue& JsonValue::WithString(const char* key, const Aws::String& value)
+{
+    NewObjectIfEmpty();
+    AddOrReplace(m_arena, m_value, key, NewString(m_arena, value.c_str(), value.size()));
     return *this;
 }
 
@@ -148,19 +364,14 @@ JsonValue& JsonValue::WithString(const Aws::String& key, const Aws::String& valu
 JsonValue& JsonValue::AsString(const Aws::String& value)
 {
     Destroy();
-    m_value = cJSON_CreateString(value.c_str());
+    m_value = NewString(m_arena, value.c_str(), value.size());
     return *this;
 }
 
 JsonValue& JsonValue::WithBool(const char* key, bool value)
 {
-    if (!m_value)
-    {
-        m_value = cJSON_CreateObject();
-    }
-
-    const auto val = cJSON_CreateBool(value);
-    AddOrReplace(m_value, key, val);
+    NewObjectIfEmpty();
+    AddOrReplace(m_arena, m_value, key, NewBool(m_arena, value));
     return *this;
 }
 
@@ -172,7 +383,7 @@ JsonValue& JsonValue::WithBool(const Aws::String& key, bool value)
 JsonValue& JsonValue::AsBool(bool value)
 {
     Destroy();
-    m_value = cJSON_CreateBool(value);
+    m_value = NewBool(m_arena, value);
     return *this;
 }
 
@@ -189,7 +400,7 @@ JsonValue& JsonValue::WithInteger(const Aws::String& key, int value)
 JsonValue& JsonValue::AsInteger(int value)
 {
     Destroy();
-    m_value = cJSON_CreateNumber(static_cast<double>(value));
+    m_value = NewNumber(m_arena, static_cast<double>(value));
     return *this;
 }
 
@@ -210,13 +421,8 @@ JsonValue& JsonValue::AsInt64(long long value)
 
 JsonValue& JsonValue::WithDouble(const char* key, double value)
 {
-    if (!m_value)
-    {
-        m_value = cJSON_CreateObject();
-    }
-
-    const auto val = cJSON_CreateNumber(value);
-    AddOrReplace(m_value, key, val);
+    NewObjectIfEmpty();
+    AddOrReplace(m_arena, m_value, key, NewNumber(m_arena, value));
     return *this;
 }
 
@@ -228,24 +434,24 @@ JsonValue& JsonValue::WithDouble(const Aws::String& key, double value)
 JsonValue& JsonValue::AsDouble(double value)
 {
     Destroy();
-    m_value = cJSON_CreateNumber(value);
+    m_value = NewNumber(m_arena, value);
     return *this;
 }
 
 JsonValue& JsonValue::WithArray(const char* key, const Array<Aws::String>& array)
 {
-    if (!m_value)
-    {
-        m_value = cJSON_CreateObject();
-    }
+    NewObjectIfEmpty();
 
-    auto arrayValue = cJSON_CreateArray();
+    auto arrayValue = NewNode(m_arena, cJSON_Array);
+    cJSON* last = nullptr;
     for (unsigned i = 0; i < array.GetLength(); ++i)
     {
-        cJSON_AddItemToArray(arrayValue, cJSON_CreateString(array[i].c_str()));
+        auto element = NewString(m_arena, array[i].c_str(), array[i].size());
+        Append(arrayValue, last, element);
+        last = element;
     }
 
-    AddOrReplace(m_value, key, arrayValue);
+    AddOrReplace(m_arena, m_value, key, arrayValue);
     return *this;
 }
 
@@ -256,75 +462,94 @@ JsonValue& JsonValue::WithArray(const Aws::String& key, const Array<Aws::String>
 
 JsonValue& JsonValue::WithArray(const Aws::String& key, const Array<JsonValue>& array)
 {
-    if (!m_value)
-    {
-        m_value = cJSON_CreateObject();
-    }
+    NewObjectIfEmpty();
 
-    auto arrayValue = cJSON_CreateArray();
+    auto arrayValue = NewNode(m_arena, cJSON_Array);
+    cJSON* last = nullptr;
     for (unsigned i = 0; i < array.GetLength(); ++i)
     {
-        cJSON_AddItemToArray(arrayValue, cJSON_Duplicate(array[i].m_value, true /*recurse*/));
+        if (array[i].m_value)
+        {
+            auto element = Duplicate(m_arena, array[i].m_value);
+            Append(arrayValue, last, element);
+            last = element;
+        }
     }
 
-    AddOrReplace(m_value, key.c_str(), arrayValue);
+    AddOrReplace(m_arena, m_value, key.c_str(), arrayValue);
     return *this;
 }
 
 JsonValue& JsonValue::WithArray(const Aws::String& key, Array<JsonValue>&& array)
 {
-    if (!m_value)
-    {
-        m_value = cJSON_CreateObject();
-    }
+    NewObjectIfEmpty();
 
-    auto arrayValue = cJSON_CreateArray();
+    auto arrayValue = NewNode(m_arena, cJSON_Array);
+    cJSON* last = nullptr;
     for (unsigned i = 0; i < array.GetLength(); ++i)
     {
-        cJSON_AddItemToArray(arrayValue, array[i].m_value);
-        array[i].m_value = nullptr;
+        if (array[i].m_value)
+        {
+            m_arena.Adopt(array[i].m_arena);
+            Append(arrayValue, last, array[i].m_value);
+            last = array[i].m_value;
+            array[i].m_value = nullptr;
+        }
     }
 
-    AddOrReplace(m_value, key.c_str(), arrayValue);
+    AddOrReplace(m_arena, m_value, key.c_str(), arrayValue);
     return *this;
 }
 
 JsonValue& JsonValue::AsArray(const Array<JsonValue>& array)
 {
-    auto arrayValue = cJSON_CreateArray();
+    JsonArena arena;
+    auto arrayValue = NewNode(arena, cJSON_Array);
+    cJSON* last = nullptr;
     for (unsigned i = 0; i < array.GetLength(); ++i)
     {
-        cJSON_AddItemToArray(arrayValue, cJSON_Duplicate(array[i].m_value, true /*recurse*/));
+        if (array[i].m_value)
+        {
+            auto element = Duplicate(arena, array[i].m_value);
+            Append(arrayValue, last, element);
+            last = element;
+        }
     }
 
     Destroy();
+    m_arena = std::move(arena);
     m_value = arrayValue;
     return *this;
 }
 
 JsonValue& JsonValue::AsArray(Array<JsonValue>&& array)
 {
-    auto arrayValue = cJSON_CreateArray();
+    JsonArena arena;
+    auto arrayValue = NewNode(arena, cJSON_Array);
+    cJSON* last = nullptr;
     for (unsigned i = 0; i < array.GetLength(); ++i)
     {
-        cJSON_AddItemToArray(arrayValue, array[i].m_value);
-        array[i].m_value = nullptr;
+        if (array[i].m_value)
+        {
+            arena.Adopt(array[i].m_arena);
+            Append(arrayValue, last, array[i].m_value);
+            last = array[i].m_value;
+            array[i].m_value = nullptr;
+        }
     }
 
     Destroy();
+    m_arena = std::move(arena);
     m_value = arrayValue;
     return *this;
 }
 
 JsonValue& JsonValue::WithObject(const char* key, const JsonValue& value)
 {
-    if (!m_value)
-    {
-        m_value = cJSON_CreateObject();
-    }
+    NewObjectIfEmpty();
 
-    const auto copy = value.m_value == nullptr ? cJSON_CreateObject() : cJSON_Duplicate(value.m_value, true /*recurse*/);
-    AddOrReplace(m_value, key, copy);
+    const auto copy = value.m_value == nullptr ? NewNode(m_arena, cJSON_Object) : Duplicate(m_arena, value.m_value);
+    AddOrReplace(m_arena, m_value, key, copy);
     return *this;
 }
 
@@ -335,13 +560,19 @@ JsonValue& JsonValue::WithObject(const Aws::String& key, const JsonValue& value)
 
 JsonValue& JsonValue::WithObject(const char* key, JsonValue&& value)
 {
-    if (!m_value)
+    NewObjectIfEmpty();
+
+    auto item = value.m_value;
+    if (item)
     {
-        m_value = cJSON_CreateObject();
+        m_arena.Adopt(value.m_arena);
+        value.m_value = nullptr;
     }
-
-    AddOrReplace(m_value, key, value.m_value == nullptr ? cJSON_CreateObject() : value.m_value);
-    value.m_value = nullptr;
+    else
+    {
+        item = NewNode(m_arena, cJSON_Object);
+    }
+    AddOrReplace(m_arena, m_value, key, item);
     return *this;
 }
 
@@ -598,6 +829,179 @@ bool JsonView::IsNull() const
     return cJSON_IsNull(m_value) != 0;
 }
 
+
+static void WriteString(const char* str, Aws::String& out)
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+
+    out += '"';
+    if (str)
+    {
+        const char* run = str;
+        for (const char* c = str; *c; ++c)
+        {
+            unsigned char character = static_cast<unsigned char>(*c);
+            if (character > 31 && character != '"' && character != '\\')
+            {
+                continue;
+            }
+
+            out.append(run, c - run);
+            run = c + 1;
+            out += '\\';
+            switch (character)
+            {
+                case '"':
+                case '\\':
+                    out += static_cast<char>(character);
+                    break;
+                case '\b':
+                    out += 'b';
+                    break;
+                case '\f':
+                    out += 'f';
+                    break;
+                case '\n':
+                    out += 'n';
+                    break;
+                case '\r':
+                    out += 'r';
+                    break;
+                case '\t':
+                    out += 't';
+                    break;
+                default:
+                    out += "u00";
+                    out += HEX_DIGITS[character >> 4];
+                    out += HEX_DIGITS[character & 0xF];
+                    break;
+            }
+        }
+        out += run;
+    }
+    out += '"';
+}
+
+static void WriteNumber(double value, Aws::String& out)
+{
+    // NaN and infinities
+    if (value * 0 != 0)
+    {
+        out += "null";
+        return;
+    }
+
+    // integers below 1e15 print the same as %1.15g does without going through printf.
+    if (value == std::floor(value) && std::fabs(value) < 1e15 && !(value == 0 && std::signbit(value)))
+    {
+        char digits[24];
+        char* end = digits + sizeof(digits);
+        char* begin = end;
+        long long integer = static_cast<long long>(value);
+        unsigned long long magnitude = integer < 0 ? 0ull - static_cast<unsigned long long>(integer) : static_cast<unsigned long long>(integer);
+        do
+        {
+            *--begin = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude);
+        if (integer < 0)
+        {
+            *--begin = '-';
+        }
+        out.append(begin, end - begin);
+        return;
+    }
+
+    // same as cJSON: 15 significant digits unless it takes 17 to read the same double back.
+    char buffer[32];
+    int length = snprintf(buffer, sizeof(buffer), "%1.15g", value);
+    double readBack = 0;
+    if (sscanf(buffer, "%lg", &readBack) != 1 || readBack != value)
+    {
+        length = snprintf(buffer, sizeof(buffer), "%1.17g", value);
+    }
+    if (length < 0 || length >= static_cast<int>(sizeof(buffer)))
+    {
+        return;
+    }
+
+    const char decimalPoint = *localeconv()->decimal_point;
+    if (decimalPoint != '.')
+    {
+        std::replace(buffer, buffer + length, decimalPoint, '.');
+    }
+    out.append(buffer, length);
+}
+
+// Writes the same text as cJSON_Print (formatted) and cJSON_PrintUnformatted, appending to out rather than to a buffer of its own.
+static void WriteValue(const cJSON* item, bool formatted, size_t depth, Aws::String& out)
+{
+    switch (item->type & 0xFF)
+    {
+        case cJSON_NULL:
+            out += "null";
+            break;
+        case cJSON_False:
+            out += "false";
+            break;
+        case cJSON_True:
+            out += "true";
+            break;
+        case cJSON_Number:
+            WriteNumber(item->valuedouble, out);
+            break;
+        case cJSON_Raw:
+            if (item->valuestring)
+            {
+                out += item->valuestring;
+            }
+            break;
+        case cJSON_String:
+            WriteString(item->valuestring, out);
+            break;
+        case cJSON_Array:
+            out += '[';
+            for (auto element = item->child; element; element = element->next)
+            {
+                WriteValue(element, formatted, depth + 1, out);
+                if (element->next)
+                {
+                    out += formatted ? ", " : ",";
+                }
+            }
+            out += ']';
+            break;
+        case cJSON_Object:
+            out += formatted ? "{\n" : "{";
+            for (auto member = item->child; member; member = member->next)
+            {
+                if (formatted)
+                {
+                    out.append(depth + 1, '\t');
+                }
+                WriteString(member->string, out);
+                out += formatted ? ":\t" : ":";
+                WriteValue(member, formatted, depth + 1, out);
+                if (member->next)
+                {
+                    out += ',';
+                }
+                if (formatted)
+                {
+                    out += '\n';
+                }
+            }
+            if (formatted)
+            {
+                out.append(depth, '\t');
+            }
+            out += '}';
+            break;
+        default:
+            break;
+    }
+}
+
 Aws::String JsonView::WriteCompact(bool treatAsObject) const
 {
     if (!m_value)
@@ -609,9 +1013,8 @@ Aws::String JsonView::WriteCompact(bool treatAsObject) const
         return "";
     }
 
-    auto temp = cJSON_PrintUnformatted(m_value);
-    Aws::String out(temp);
-    cJSON_free(temp);
+    Aws::String out;
+    WriteValue(m_value, false /*formatted*/, 0, out);
     return out;
 }
 
@@ -626,9 +1029,8 @@ Aws::String JsonView::WriteReadable(bool treatAsObject) const
         return "";
     }
 
-    auto temp = cJSON_Print(m_value);
-    Aws::String out(temp);
-    cJSON_free(temp);
+    Aws::String out;
+    WriteValue(m_value, true /*formatted*/, 0, out);
     return out;
 }
 
@@ -15,13 +15,30 @@
 
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/threading/ThreadTask.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/UnreferencedParam.h>
 #include <thread>
 #include <cassert>
 
+#if defined(__linux__)
+#include <sched.h>
+#include <errno.h>
+#endif
+
+static const char* EXECUTOR_CLASS_TAG = "Executor";
 static const char* POOLED_CLASS_TAG = "PooledThreadExecutor";
+static const char* WORK_STEALING_CLASS_TAG = "WorkStealingThreadExecutor";
 
 using namespace Aws::Utils::Threading;
 
+bool Executor::SubmitTask(ExecutorTask&& task)
+{
+    // std::function needs a copyable callable, so the move only task is shared.
+    auto sharedTask = Aws::MakeShared<ExecutorTask>(EXECUTOR_CLASS_TAG, std::move(task));
+    return SubmitToThread([sharedTask]() { (*sharedTask)(); });
+}
+
 bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
 {
     auto main = [fx, this] { 
@@ -108,7 +125,7 @@ PooledThreadExecutor::~PooledThreadExecutor()
 
     while(m_tasks.size() > 0)
     {
-        std::function<void()>* fn = m_tasks.front();
+        ExecutorTask* fn = m_tasks.front();
         m_tasks.pop();
 
         if(fn)
@@ -120,9 +137,14 @@ PooledThreadExecutor::~PooledThreadExecutor()
 }
 
 bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fn)
+{
+    return SubmitTask(ExecutorTask(std::move(fn)));
+}
+
+bool PooledThreadExecutor::SubmitTask(ExecutorTask&& task)
 {
     //avoid the need to do copies inside the lock. Instead lets do a pointer push.
-    std::function<void()>* fnCpy = Aws::New<std::function<void()>>(POOLED_CLASS_TAG, std::forward<std::function<void()>>(fn));
+    ExecutorTask* fnCpy = Aws::New<ExecutorTask>(POOLED_CLASS_TAG, std::move(task));
 
     {
         std::lock_guard<std::mutex> locker(m_queueLock);
@@ -141,13 +163,13 @@ bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fn)
     return true;
 }
 
-std::function<void()>* PooledThreadExecutor::PopTask()
+ExecutorTask* PooledThreadExecutor::PopTask()
 {
     std::lock_guard<std::mutex> locker(m_queueLock);
 
     if (m_tasks.size() > 0)
     {
-        std::function<void()>* fn = m_tasks.front();
+        ExecutorTask* fn = m_tasks.front();
         if (fn)
         {           
             m_tasks.pop();
@@ -163,3 +185,183 @@ bool PooledThreadExecutor::HasTasks()
     std::lock_guard<std::mutex> locker(m_queueLock);
     return m_tasks.size() > 0;
 }
+
+class WorkStealingThreadExecutor::WorkQueue
+{
+public:
+    void PushBack(ExecutorTask&& task)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_tasks.push_back(std::move(task));
+    }
+
+    bool PopBack(ExecutorTask& task)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        if (m_tasks.empty())
+        {
+            return false;
+        }
+
+        task = std::move(m_tasks.back());
+        m_tasks.pop_back();
+        return true;
+    }
+
+    bool PopFront(ExecutorTask& task)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        if (m_tasks.empty())
+        {
+            return false;
+        }
+
+        task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        return true;
+    }
+
+private:
+    std::mutex m_lock;
+    Aws::Deque<ExecutorTask> m_tasks;
+};
+
+static void PinCurrentThreadToCore(size_t index)
+{
+#if defined(__linux__)
+    unsigned cores = std::thread::hardware_concurrency();
+    if (cores == 0)
+    {
+        return;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(index % cores, &cpuSet);
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+    {
+        AWS_LOGSTREAM_WARN(WORK_STEALING_CLASS_TAG, "Failed to pin thread " << index << " to core " << index % cores << ", errno " << errno);
+    }
+#else
+    AWS_UNREFERENCED_PARAM(index);
+#endif
+}
+
+WorkStealingThreadExecutor::WorkStealingThreadExecutor(size_t poolSize, bool pinThreadsToCores) :
+    m_poolSize(poolSize), m_nextQueue(0), m_queuedTasks(0), m_idleThreads(0), m_continue(true)
+{
+    assert(m_poolSize > 0);
+    for (size_t index = 0; index < m_poolSize; ++index)
+    {
+        m_queues.push_back(Aws::New<WorkQueue>(WORK_STEALING_CLASS_TAG));
+    }
+
+    m_threads.reserve(m_poolSize);
+    for (size_t index = 0; index < m_poolSize; ++index)
+    {
+        m_threads.emplace_back(&WorkStealingThreadExecutor::RunWorker, this, index, pinThreadsToCores);
+    }
+
+    // the workers only look themselves up while running a task, and no task can be submitted before the constructor returns.
+    for (size_t index = 0; index < m_poolSize; ++index)
+    {
+        m_threadIndices[m_threads[index].get_id()] = index;
+    }
+}
+
+WorkStealingThreadExecutor::~WorkStealingThreadExecutor()
+{
+    m_continue = false;
+    {
+        std::lock_guard<std::mutex> locker(m_idleLock);
+        m_idleSignal.notify_all();
+    }
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+
+    for (auto queue : m_queues)
+    {
+        Aws::Delete(queue);
+    }
+}
+
+bool WorkStealingThreadExecutor::SubmitToThread(std::function<void()>&& fn)
+{
+    return SubmitTask(ExecutorTask(std::move(fn)));
+}
+
+bool WorkStealingThreadExecutor::SubmitTask(ExecutorTask&& task)
+{
+    size_t index = CurrentThreadIndex();
+    if (index == m_poolSize)
+    {
+        index = m_nextQueue++ % m_poolSize;
+    }
+
+    // counted before it is queued so the count never drops below the number of queued tasks.
+    ++m_queuedTasks;
+    m_queues[index]->PushBack(std::move(task));
+
+    // the idle count is raised under m_idleLock before an idle thread checks m_queuedTasks for the last time, so either that thread
+    // sees this task or the notification below reaches it.
+    if (m_idleThreads.load() > 0)
+    {
+        std::lock_guard<std::mutex> locker(m_idleLock);
+        m_idleSignal.notify_one();
+    }
+
+    return true;
+}
+
+size_t WorkStealingThreadExecutor::CurrentThreadIndex() const
+{
+    auto threadIndex = m_threadIndices.find(std::this_thread::get_id());
+    return threadIndex != m_threadIndices.end() ? threadIndex->second : m_poolSize;
+}
+
+bool WorkStealingThreadExecutor::TakeTask(size_t index, ExecutorTask& task)
+{
+    if (m_queues[index]->PopBack(task))
+    {
+        --m_queuedTasks;
+        return true;
+    }
+
+    for (size_t offset = 1; offset < m_poolSize; ++offset)
+    {
+        if (m_queues[(index + offset) % m_poolSize]->PopFront(task))
+        {
+            --m_queuedTasks;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void WorkStealingThreadExecutor::RunWorker(size_t index, bool pinToCore)
+{
+    if (pinToCore)
+    {
+        PinCurrentThreadToCore(index);
+    }
+
+    ExecutorTask task;
+    while (m_continue)
+    {
+        if (TakeTask(index, task))
+        {
+            task();
+            task = ExecutorTask();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> locker(m_idleLock);
+        ++m_idleThreads;
+        m_idleSignal.wait(locker, [this] { return !m_continue || m_queuedTasks.load() > 0; });
+        --m_idleThreads;
+    }
+}
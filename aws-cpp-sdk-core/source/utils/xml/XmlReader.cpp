@@ -0,0 +1,719 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Xml;
+
+const size_t XmlReader::DEFAULT_CHUNK_SIZE = 16 * 1024;
+
+// the longest of the markup starts told apart, "<![CDATA[".
+static const size_t MARKUP_START_LENGTH = 9;
+
+static inline bool IsWhitespace(char c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static inline bool IsNameEnd(char c)
+{
+    return IsWhitespace(c) || c == '/' || c == '>';
+}
+
+static bool IsAllWhitespace(const char* text, size_t length)
+{
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (!IsWhitespace(text[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// same as StringUtils::Trim().
+static inline bool IsTrimmed(char c)
+{
+    return c < 0 || ::isspace(c) == 0;
+}
+
+static inline bool StartsWith(const char* text, const char* prefix, size_t prefixLength)
+{
+    return memcmp(text, prefix, prefixLength) == 0;
+}
+
+static size_t EncodeUtf8(unsigned long codePoint, char* output)
+{
+    if (codePoint < 0x80)
+    {
+        output[0] = static_cast<char>(codePoint);
+        return 1;
+    }
+    if (codePoint < 0x800)
+    {
+        output[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+        output[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        return 2;
+    }
+    if (codePoint < 0x10000)
+    {
+        output[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+        output[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        output[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        return 3;
+    }
+    if (codePoint < 0x200000)
+    {
+        output[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+        output[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        output[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        output[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+        return 4;
+    }
+    // tinyxml2 drops code points it can't encode.
+    return 0;
+}
+
+/**
+ * Resolves the entity or character reference text starts with. Returns the length of the reference, 0 if it isn't a valid one,
+ * in which case the '&' is taken literally, as tinyxml2 does.
+ */
+static size_t ResolveReference(const char* text, size_t length, char* resolved, size_t& resolvedLength)
+{
+    static const struct { const char* name; size_t length; char value; } ENTITIES[] = {
+        { "lt;", 3, '<' }, { "gt;", 3, '>' }, { "amp;", 4, '&' }, { "quot;", 5, '"' }, { "apos;", 5, '\'' }
+    };
+
+    if (length > 2 && text[1] == '#')
+    {
+        bool hex = text[2] == 'x';
+        size_t i = hex ? 3 : 2;
+        size_t digitsStart = i;
+        unsigned long codePoint = 0;
+        for (; i < length && text[i] != ';'; ++i)
+        {
+            char c = text[i];
+            unsigned digit = 0;
+            if (c >= '0' && c <= '9')
+            {
+                digit = static_cast<unsigned>(c - '0');
+            }
+            else if (hex && c >= 'a' && c <= 'f')
+            {
+                digit = static_cast<unsigned>(c - 'a' + 10);
+            }
+            else if (hex && c >= 'A' && c <= 'F')
+            {
+                digit = static_cast<unsigned>(c - 'A' + 10);
+            }
+            else
+            {
+                return 0;
+            }
+            codePoint = (std::min)(codePoint * (hex ? 16 : 10) + digit, 0x200000UL);
+        }
+        if (i == length || i == digitsStart)
+        {
+            return 0;
+        }
+        resolvedLength = EncodeUtf8(codePoint, resolved);
+        return i + 1;
+    }
+
+    for (const auto& entity : ENTITIES)
+    {
+        if (length > entity.length && StartsWith(text + 1, entity.name, entity.length))
+        {
+            resolved[0] = entity.value;
+            resolvedLength = 1;
+            return entity.length + 1;
+        }
+    }
+    return 0;
+}
+
+static inline void AppendEscaped(Aws::String& text, char c)
+{
+    switch (c)
+    {
+        case '&': text.append("&amp;", 5); break;
+        case '<': text.append("&lt;", 4); break;
+        case '>': text.append("&gt;", 4); break;
+        default: text.push_back(c); break;
+    }
+}
+
+/**
+ * Appends length chars of raw text, new lines normalized the way tinyxml2 does. References are resolved if resolveReferences is set,
+ * and &, < and > are escaped if escape is set.
+ */
+static void AppendXmlText(Aws::String& text, const char* raw, size_t length, bool resolveReferences, bool escape)
+{
+    size_t runStart = 0;
+    size_t i = 0;
+    while (i < length)
+    {
+        char c = raw[i];
+        if (c == '\r' || (c == '\n' && i + 1 < length && raw[i + 1] == '\r'))
+        {
+            // CR LF, LF CR and a lone CR all become LF.
+            text.append(raw + runStart, i - runStart);
+            text.push_back('\n');
+            i += (i + 1 < length && (raw[i + 1] == '\n' || raw[i + 1] == '\r') && raw[i + 1] != c) ? 2 : 1;
+            runStart = i;
+        }
+        else if (c == '&' && resolveReferences)
+        {
+            text.append(raw + runStart, i - runStart);
+            char resolved[4];
+            size_t resolvedLength = 0;
+            size_t referenceLength = ResolveReference(raw + i, length - i, resolved, resolvedLength);
+            if (referenceLength == 0)
+            {
+                resolved[0] = '&';
+                resolvedLength = 1;
+                referenceLength = 1;
+            }
+            for (size_t j = 0; j < resolvedLength; ++j)
+            {
+                if (escape)
+                {
+                    AppendEscaped(text, resolved[j]);
+                }
+                else
+                {
+                    text.push_back(resolved[j]);
+                }
+            }
+            i += referenceLength;
+            runStart = i;
+        }
+        else if (c == '>' && escape)
+        {
+            text.append(raw + runStart, i - runStart);
+            text.append("&gt;", 4);
+            runStart = ++i;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    text.append(raw + runStart, length - runStart);
+}
+
+XmlReader::XmlReader() :
+    m_stream(nullptr),
+    m_chunkSize(0),
+    m_inputEnded(false),
+    m_position(0),
+    m_discarded(0),
+    m_tokenType(XmlTokenType::NeedMoreInput),
+    m_tokenStart(0),
+    m_tokenLength(0),
+    m_attributesStart(0),
+    m_attributesLength(0),
+    m_isCData(false),
+    m_pendingEndElement(false),
+    m_rootElementRead(false),
+    m_failed(false)
+{
+}
+
+XmlReader::XmlReader(Aws::IStream& stream, size_t chunkSize) :
+    m_stream(&stream),
+    m_chunkSize(chunkSize > 0 ? chunkSize : DEFAULT_CHUNK_SIZE),
+    m_inputEnded(false),
+    m_position(0),
+    m_discarded(0),
+    m_tokenType(XmlTokenType::NeedMoreInput),
+    m_tokenStart(0),
+    m_tokenLength(0),
+    m_attributesStart(0),
+    m_attributesLength(0),
+    m_isCData(false),
+    m_pendingEndElement(false),
+    m_rootElementRead(false),
+    m_failed(false)
+{
+}
+
+void XmlReader::Feed(const char* data, size_t length)
+{
+    // the current token is kept, its name or text may still be looked at.
+    size_t keep = (std::min)(m_position, m_tokenStart);
+    if (keep > 0)
+    {
+        m_buffer.erase(0, keep);
+        m_discarded += keep;
+        m_position -= keep;
+        m_tokenStart -= keep;
+        m_attributesStart = m_attributesStart >= keep ? m_attributesStart - keep : 0;
+    }
+    m_buffer.append(data, length);
+}
+
+void XmlReader::EndOfInput()
+{
+    m_inputEnded = true;
+}
+
+XmlTokenType XmlReader::Next()
+{
+    m_tokenType = ReadToken();
+    return m_tokenType;
+}
+
+bool XmlReader::GetAttributeValue(const char* name, Aws::String& value) const
+{
+    if (m_tokenType != XmlTokenType::StartElement)
+    {
+        return false;
+    }
+
+    const char* attributes = m_buffer.data() + m_attributesStart;
+    size_t length = m_attributesLength;
+    size_t nameLength = strlen(name);
+    size_t i = 0;
+    while (i < length)
+    {
+        while (i < length && IsWhitespace(attributes[i]))
+        {
+            ++i;
+        }
+        size_t nameStart = i;
+        while (i < length && attributes[i] != '=' && !IsWhitespace(attributes[i]))
+        {
+            ++i;
+        }
+        size_t nameEnd = i;
+        while (i < length && IsWhitespace(attributes[i]))
+        {
+            ++i;
+        }
+        if (i == length || attributes[i] != '=')
+        {
+            return false;
+        }
+        ++i;
+        while (i < length && IsWhitespace(attributes[i]))
+        {
+            ++i;
+        }
+        if (i == length || (attributes[i] != '"' && attributes[i] != '\''))
+        {
+            return false;
+        }
+        char quote = attributes[i++];
+        size_t valueStart = i;
+        while (i < length && attributes[i] != quote)
+        {
+            ++i;
+        }
+        if (i == length)
+        {
+            return false;
+        }
+        if (nameEnd - nameStart == nameLength && memcmp(attributes + nameStart, name, nameLength) == 0)
+        {
+            value.clear();
+            AppendXmlText(value, attributes + valueStart, i - valueStart, true, false);
+            return true;
+        }
+        ++i;
+    }
+    return false;
+}
+
+bool XmlReader::StartRootElement()
+{
+    return Next() == XmlTokenType::StartElement;
+}
+
+bool XmlReader::NextChild()
+{
+    for (;;)
+    {
+        switch (Next())
+        {
+            case XmlTokenType::StartElement:
+                return true;
+            case XmlTokenType::Text:
+                break;
+            default:
+                return false;
+        }
+    }
+}
+
+Aws::String XmlReader::ReadText()
+{
+    Aws::String text;
+    for (;;)
+    {
+        switch (Next())
+        {
+            case XmlTokenType::Text:
+                if (m_isCData)
+                {
+                    text.append("<![CDATA[", 9);
+                    AppendXmlText(text, GetText(), m_tokenLength, false, false);
+                    text.append("]]>", 3);
+                }
+                else
+                {
+                    AppendXmlText(text, GetText(), m_tokenLength, true, true);
+                }
+                break;
+            case XmlTokenType::StartElement:
+                SkipElement();
+                break;
+            default:
+                return text;
+        }
+    }
+}
+
+Aws::String XmlReader::ReadTrimmedText()
+{
+    Aws::String text = ReadText();
+    size_t end = text.size();
+    while (end > 0 && !IsTrimmed(text[end - 1]))
+    {
+        --end;
+    }
+    size_t start = 0;
+    while (start < end && !IsTrimmed(text[start]))
+    {
+        ++start;
+    }
+    text.erase(end);
+    text.erase(0, start);
+    return text;
+}
+
+void XmlReader::SkipElement()
+{
+    size_t depth = 1;
+    while (depth > 0)
+    {
+        switch (Next())
+        {
+            case XmlTokenType::StartElement:
+                ++depth;
+                break;
+            case XmlTokenType::EndElement:
+                --depth;
+                break;
+            case XmlTokenType::Text:
+                break;
+            default:
+                return;
+        }
+    }
+}
+
+XmlTokenType XmlReader::ReadToken()
+{
+    if (m_failed)
+    {
+        return XmlTokenType::Error;
+    }
+    if (m_pendingEndElement)
+    {
+        // the end of an empty element, its name is still the current one.
+        m_pendingEndElement = false;
+        PopOpenElement();
+        return XmlTokenType::EndElement;
+    }
+
+    m_isCData = false;
+    for (;;)
+    {
+        size_t size = m_buffer.size();
+        if (m_position == size)
+        {
+            if (Refill())
+            {
+                continue;
+            }
+            if (!m_inputEnded)
+            {
+                return XmlTokenType::NeedMoreInput;
+            }
+            if (!m_rootElementRead || !m_openElementLengths.empty())
+            {
+                return Fail("Unexpected end of the document");
+            }
+            return XmlTokenType::EndOfDocument;
+        }
+
+        const char* data = m_buffer.data() + m_position;
+        size_t available = size - m_position;
+        XmlTokenType type = XmlTokenType::NeedMoreInput;
+        size_t end = m_position;
+        const char* skipUntil = nullptr;
+        if (data[0] != '<')
+        {
+            type = ReadTextToken(end);
+        }
+        else if (available < MARKUP_START_LENGTH && !m_inputEnded)
+        {
+            type = XmlTokenType::NeedMoreInput;
+        }
+        else if (available >= 2 && StartsWith(data, "<?", 2))
+        {
+            skipUntil = "?>";
+        }
+        else if (available >= 4 && StartsWith(data, "<!--", 4))
+        {
+            skipUntil = "-->";
+        }
+        else if (available >= 9 && StartsWith(data, "<![CDATA[", 9))
+        {
+            type = ReadCDataToken(end);
+        }
+        else if (available >= 2 && StartsWith(data, "<!", 2))
+        {
+            skipUntil = ">";
+        }
+        else if (available >= 2 && data[1] == '/')
+        {
+            type = ReadEndElementToken(end);
+        }
+        else
+        {
+            type = ReadStartElementToken(end);
+        }
+
+        if (skipUntil)
+        {
+            size_t found = m_buffer.find(skipUntil, m_position + 2);
+            if (found != Aws::String::npos)
+            {
+                m_position = found + strlen(skipUntil);
+                continue;
+            }
+            type = m_inputEnded ? Fail("Unterminated markup") : XmlTokenType::NeedMoreInput;
+        }
+
+        switch (type)
+        {
+            case XmlTokenType::NeedMoreInput:
+                if (Refill())
+                {
+                    continue;
+                }
+                return type;
+            case XmlTokenType::Text:
+                m_position = end;
+                if (IsAllWhitespace(GetText(), m_tokenLength) && !m_isCData)
+                {
+                    continue;
+                }
+                if (m_openElementLengths.empty())
+                {
+                    return Fail("Text outside of the root element");
+                }
+                return type;
+            case XmlTokenType::Error:
+                return type;
+            default:
+                m_position = end;
+                return type;
+        }
+    }
+}
+
+XmlTokenType XmlReader::ReadTextToken(size_t& end)
+{
+    const char* data = m_buffer.data();
+    size_t size = m_buffer.size();
+    const char* markup = static_cast<const char*>(memchr(data + m_position, '<', size - m_position));
+    if (!markup && !m_inputEnded)
+    {
+        return XmlTokenType::NeedMoreInput;
+    }
+    end = markup ? static_cast<size_t>(markup - data) : size;
+    m_tokenStart = m_position;
+    m_tokenLength = end - m_position;
+    return XmlTokenType::Text;
+}
+
+XmlTokenType XmlReader::ReadCDataToken(size_t& end)
+{
+    size_t found = m_buffer.find("]]>", m_position + MARKUP_START_LENGTH);
+    if (found == Aws::String::npos)
+    {
+        return m_inputEnded ? Fail("Unterminated CDATA section") : XmlTokenType::NeedMoreInput;
+    }
+    m_tokenStart = m_position + MARKUP_START_LENGTH;
+    m_tokenLength = found - m_tokenStart;
+    m_isCData = true;
+    end = found + 3;
+    return XmlTokenType::Text;
+}
+
+XmlTokenType XmlReader::ReadStartElementToken(size_t& end)
+{
+    const char* data = m_buffer.data();
+    size_t size = m_buffer.size();
+    size_t nameStart = m_position + 1;
+    size_t i = nameStart;
+    while (i < size && !IsNameEnd(data[i]))
+    {
+        ++i;
+    }
+    size_t attributesStart = i;
+    char quote = 0;
+    for (; i < size; ++i)
+    {
+        char c = data[i];
+        if (quote)
+        {
+            quote = c == quote ? 0 : quote;
+        }
+        else if (c == '"' || c == '\'')
+        {
+            quote = c;
+        }
+        else if (c == '>')
+        {
+            break;
+        }
+        else if (c == '<')
+        {
+            return Fail("Unexpected '<' in element");
+        }
+    }
+    if (i == size)
+    {
+        return m_inputEnded ? Fail("Unexpected end of the document") : XmlTokenType::NeedMoreInput;
+    }
+    if (attributesStart == nameStart)
+    {
+        return Fail("Missing element name");
+    }
+    if (m_rootElementRead && m_openElementLengths.empty())
+    {
+        return Fail("More than one root element");
+    }
+
+    bool empty = i > attributesStart && data[i - 1] == '/';
+    m_tokenStart = nameStart;
+    m_tokenLength = attributesStart - nameStart;
+    m_attributesStart = attributesStart;
+    m_attributesLength = (empty ? i - 1 : i) - attributesStart;
+    m_openElementNames.append(data + nameStart, m_tokenLength);
+    m_openElementLengths.push_back(m_tokenLength);
+    m_rootElementRead = true;
+    m_pendingEndElement = empty;
+    end = i + 1;
+    return XmlTokenType::StartElement;
+}
+
+XmlTokenType XmlReader::ReadEndElementToken(size_t& end)
+{
+    const char* data = m_buffer.data();
+    size_t size = m_buffer.size();
+    size_t nameStart = m_position + 2;
+    size_t i = nameStart;
+    while (i < size && !IsNameEnd(data[i]))
+    {
+        ++i;
+    }
+    size_t nameLength = i - nameStart;
+    while (i < size && IsWhitespace(data[i]))
+    {
+        ++i;
+    }
+    if (i == size)
+    {
+        return m_inputEnded ? Fail("Unexpected end of the document") : XmlTokenType::NeedMoreInput;
+    }
+    if (data[i] != '>')
+    {
+        return Fail("Invalid end tag");
+    }
+    if (m_openElementLengths.empty())
+    {
+        return Fail("End tag outside of the root element");
+    }
+    size_t openLength = m_openElementLengths.back();
+    if (openLength != nameLength || memcmp(m_openElementNames.data() + m_openElementNames.size() - openLength, data + nameStart, nameLength) != 0)
+    {
+        return Fail("End tag doesn't match the element's start tag");
+    }
+
+    PopOpenElement();
+    m_tokenStart = nameStart;
+    m_tokenLength = nameLength;
+    end = i + 1;
+    return XmlTokenType::EndElement;
+}
+
+void XmlReader::PopOpenElement()
+{
+    m_openElementNames.resize(m_openElementNames.size() - m_openElementLengths.back());
+    m_openElementLengths.pop_back();
+}
+
+bool XmlReader::Refill()
+{
+    if (!m_stream || m_inputEnded)
+    {
+        return false;
+    }
+
+    Compact();
+    // reads at least as much as is buffered, so that a token spanning many chunks isn't scanned again from its start for each of them.
+    size_t buffered = m_buffer.size();
+    size_t toRead = (std::max)(m_chunkSize, buffered);
+    m_buffer.resize(buffered + toRead);
+    m_stream->read(&m_buffer[buffered], static_cast<std::streamsize>(toRead));
+    size_t readCount = static_cast<size_t>(m_stream->gcount());
+    m_buffer.resize(buffered + readCount);
+    if (readCount < toRead)
+    {
+        m_inputEnded = true;
+    }
+    return true;
+}
+
+void XmlReader::Compact()
+{
+    if (m_position > 0)
+    {
+        m_buffer.erase(0, m_position);
+        m_discarded += m_position;
+        m_position = 0;
+    }
+}
+
+XmlTokenType XmlReader::Fail(const char* message)
+{
+    m_failed = true;
+    Aws::StringStream ss;
+    ss << message << " at offset " << (m_discarded + m_position);
+    m_errorMessage = ss.str();
+    return XmlTokenType::Error;
+}
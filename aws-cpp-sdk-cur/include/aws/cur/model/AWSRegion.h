@@ -41,6 +41,11 @@ namespace AWSRegionMapper
 AWS_COSTANDUSAGEREPORTSERVICE_API AWSRegion GetAWSRegionForName(const Aws::String& name);
 
 AWS_COSTANDUSAGEREPORTSERVICE_API Aws::String GetNameForAWSRegion(AWSRegion value);
+
+/**
+ * Same as GetNameForAWSRegion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTANDUSAGEREPORTSERVICE_API const char* GetNameForAWSRegionCStr(AWSRegion value);
 } // namespace AWSRegionMapper
 } // namespace Model
 } // namespace CostandUsageReportService
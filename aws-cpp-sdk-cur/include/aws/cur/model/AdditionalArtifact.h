@@ -35,6 +35,11 @@ namespace AdditionalArtifactMapper
 AWS_COSTANDUSAGEREPORTSERVICE_API AdditionalArtifact GetAdditionalArtifactForName(const Aws::String& name);
 
 AWS_COSTANDUSAGEREPORTSERVICE_API Aws::String GetNameForAdditionalArtifact(AdditionalArtifact value);
+
+/**
+ * Same as GetNameForAdditionalArtifact(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTANDUSAGEREPORTSERVICE_API const char* GetNameForAdditionalArtifactCStr(AdditionalArtifact value);
 } // namespace AdditionalArtifactMapper
 } // namespace Model
 } // namespace CostandUsageReportService
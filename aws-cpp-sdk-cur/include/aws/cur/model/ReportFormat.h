@@ -34,6 +34,11 @@ namespace ReportFormatMapper
 AWS_COSTANDUSAGEREPORTSERVICE_API ReportFormat GetReportFormatForName(const Aws::String& name);
 
 AWS_COSTANDUSAGEREPORTSERVICE_API Aws::String GetNameForReportFormat(ReportFormat value);
+
+/**
+ * Same as GetNameForReportFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTANDUSAGEREPORTSERVICE_API const char* GetNameForReportFormatCStr(ReportFormat value);
 } // namespace ReportFormatMapper
 } // namespace Model
 } // namespace CostandUsageReportService
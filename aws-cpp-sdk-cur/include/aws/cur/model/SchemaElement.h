@@ -34,6 +34,11 @@ namespace SchemaElementMapper
 AWS_COSTANDUSAGEREPORTSERVICE_API SchemaElement GetSchemaElementForName(const Aws::String& name);
 
 AWS_COSTANDUSAGEREPORTSERVICE_API Aws::String GetNameForSchemaElement(SchemaElement value);
+
+/**
+ * Same as GetNameForSchemaElement(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTANDUSAGEREPORTSERVICE_API const char* GetNameForSchemaElementCStr(SchemaElement value);
 } // namespace SchemaElementMapper
 } // namespace Model
 } // namespace CostandUsageReportService
@@ -35,6 +35,11 @@ namespace TimeUnitMapper
 AWS_COSTANDUSAGEREPORTSERVICE_API TimeUnit GetTimeUnitForName(const Aws::String& name);
 
 AWS_COSTANDUSAGEREPORTSERVICE_API Aws::String GetNameForTimeUnit(TimeUnit value);
+
+/**
+ * Same as GetNameForTimeUnit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_COSTANDUSAGEREPORTSERVICE_API const char* GetNameForTimeUnitCStr(TimeUnit value);
 } // namespace TimeUnitMapper
 } // namespace Model
 } // namespace CostandUsageReportService
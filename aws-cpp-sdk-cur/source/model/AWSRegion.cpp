@@ -30,50 +30,79 @@ namespace Aws
       namespace AWSRegionMapper
       {
 
-        static const int us_east_1_HASH = HashingUtils::HashString("us-east-1");
-        static const int us_west_1_HASH = HashingUtils::HashString("us-west-1");
-        static const int us_west_2_HASH = HashingUtils::HashString("us-west-2");
-        static const int eu_central_1_HASH = HashingUtils::HashString("eu-central-1");
-        static const int eu_west_1_HASH = HashingUtils::HashString("eu-west-1");
-        static const int ap_southeast_1_HASH = HashingUtils::HashString("ap-southeast-1");
-        static const int ap_southeast_2_HASH = HashingUtils::HashString("ap-southeast-2");
-        static const int ap_northeast_1_HASH = HashingUtils::HashString("ap-northeast-1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "us-east-1",
+          "us-west-1",
+          "us-west-2",
+          "eu-central-1",
+          "eu-west-1",
+          "ap-southeast-1",
+          "ap-southeast-2",
+          "ap-northeast-1",
+        };
 
         AWSRegion GetAWSRegionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == us_east_1_HASH)
-          {
-            return AWSRegion::us_east_1;
-          }
-          else if (hashCode == us_west_1_HASH)
-          {
-            return AWSRegion::us_west_1;
-          }
-          else if (hashCode == us_west_2_HASH)
-          {
-            return AWSRegion::us_west_2;
-          }
-          else if (hashCode == eu_central_1_HASH)
-          {
-            return AWSRegion::eu_central_1;
-          }
-          else if (hashCode == eu_west_1_HASH)
-          {
-            return AWSRegion::eu_west_1;
-          }
-          else if (hashCode == ap_southeast_1_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AWSRegion::ap_southeast_1;
-          }
-          else if (hashCode == ap_southeast_2_HASH)
-          {
-            return AWSRegion::ap_southeast_2;
-          }
-          else if (hashCode == ap_northeast_1_HASH)
-          {
-            return AWSRegion::ap_northeast_1;
+          case 1808575600:
+            if (name == "us-east-1")
+            {
+              return AWSRegion::us_east_1;
+            }
+            break;
+          case -1967372894:
+            if (name == "us-west-1")
+            {
+              return AWSRegion::us_west_1;
+            }
+            break;
+          case -1967372893:
+            if (name == "us-west-2")
+            {
+              return AWSRegion::us_west_2;
+            }
+            break;
+          case -534364932:
+            if (name == "eu-central-1")
+            {
+              return AWSRegion::eu_central_1;
+            }
+            break;
+          case 372748112:
+            if (name == "eu-west-1")
+            {
+              return AWSRegion::eu_west_1;
+            }
+            break;
+          case 468199888:
+            if (name == "ap-southeast-1")
+            {
+              return AWSRegion::ap_southeast_1;
+            }
+            break;
+          case 468199889:
+            if (name == "ap-southeast-2")
+            {
+              return AWSRegion::ap_southeast_2;
+            }
+            break;
+          case 1990418184:
+            if (name == "ap-northeast-1")
+            {
+              return AWSRegion::ap_northeast_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return AWSRegion::NOT_SET;
         }
 
-        Aws::String GetNameForAWSRegion(AWSRegion enumValue)
+        const char* GetNameForAWSRegionCStr(AWSRegion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AWSRegion::us_east_1:
-            return "us-east-1";
-          case AWSRegion::us_west_1:
-            return "us-west-1";
-          case AWSRegion::us_west_2:
-            return "us-west-2";
-          case AWSRegion::eu_central_1:
-            return "eu-central-1";
-          case AWSRegion::eu_west_1:
-            return "eu-west-1";
-          case AWSRegion::ap_southeast_1:
-            return "ap-southeast-1";
-          case AWSRegion::ap_southeast_2:
-            return "ap-southeast-2";
-          case AWSRegion::ap_northeast_1:
-            return "ap-northeast-1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAWSRegion(AWSRegion enumValue)
+        {
+          return GetNameForAWSRegionCStr(enumValue);
         }
 
       } // namespace AWSRegionMapper
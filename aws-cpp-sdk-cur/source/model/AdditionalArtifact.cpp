@@ -30,20 +30,37 @@ namespace Aws
       namespace AdditionalArtifactMapper
       {
 
-        static const int REDSHIFT_HASH = HashingUtils::HashString("REDSHIFT");
-        static const int QUICKSIGHT_HASH = HashingUtils::HashString("QUICKSIGHT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REDSHIFT",
+          "QUICKSIGHT",
+        };
 
         AdditionalArtifact GetAdditionalArtifactForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REDSHIFT_HASH)
-          {
-            return AdditionalArtifact::REDSHIFT;
-          }
-          else if (hashCode == QUICKSIGHT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AdditionalArtifact::QUICKSIGHT;
+          case 15423121:
+            if (name == "REDSHIFT")
+            {
+              return AdditionalArtifact::REDSHIFT;
+            }
+            break;
+          case -2112074800:
+            if (name == "QUICKSIGHT")
+            {
+              return AdditionalArtifact::QUICKSIGHT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AdditionalArtifact::NOT_SET;
         }
 
-        Aws::String GetNameForAdditionalArtifact(AdditionalArtifact enumValue)
+        const char* GetNameForAdditionalArtifactCStr(AdditionalArtifact enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AdditionalArtifact::REDSHIFT:
-            return "REDSHIFT";
-          case AdditionalArtifact::QUICKSIGHT:
-            return "QUICKSIGHT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAdditionalArtifact(AdditionalArtifact enumValue)
+        {
+          return GetNameForAdditionalArtifactCStr(enumValue);
         }
 
       } // namespace AdditionalArtifactMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CompressionFormatMapper
       {
 
-        static const int ZIP_HASH = HashingUtils::HashString("ZIP");
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ZIP",
+          "GZIP",
+        };
 
         CompressionFormat GetCompressionFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ZIP_HASH)
-          {
-            return CompressionFormat::ZIP;
-          }
-          else if (hashCode == GZIP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CompressionFormat::GZIP;
+          case 88833:
+            if (name == "ZIP")
+            {
+              return CompressionFormat::ZIP;
+            }
+            break;
+          case 2203994:
+            if (name == "GZIP")
+            {
+              return CompressionFormat::GZIP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CompressionFormat::NOT_SET;
         }
 
-        Aws::String GetNameForCompressionFormat(CompressionFormat enumValue)
+        const char* GetNameForCompressionFormatCStr(CompressionFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CompressionFormat::ZIP:
-            return "ZIP";
-          case CompressionFormat::GZIP:
-            return "GZIP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCompressionFormat(CompressionFormat enumValue)
+        {
+          return GetNameForCompressionFormatCStr(enumValue);
         }
 
       } // namespace CompressionFormatMapper
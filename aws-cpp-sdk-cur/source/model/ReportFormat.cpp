@@ -30,15 +30,30 @@ namespace Aws
       namespace ReportFormatMapper
       {
 
-        static const int textORcsv_HASH = HashingUtils::HashString("textORcsv");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "textORcsv",
+        };
 
         ReportFormat GetReportFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == textORcsv_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReportFormat::textORcsv;
+          case -1053362122:
+            if (name == "textORcsv")
+            {
+              return ReportFormat::textORcsv;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ReportFormat::NOT_SET;
         }
 
-        Aws::String GetNameForReportFormat(ReportFormat enumValue)
+        const char* GetNameForReportFormatCStr(ReportFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReportFormat::textORcsv:
-            return "textORcsv";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReportFormat(ReportFormat enumValue)
+        {
+          return GetNameForReportFormatCStr(enumValue);
         }
 
       } // namespace ReportFormatMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace SchemaElementMapper
       {
 
-        static const int RESOURCES_HASH = HashingUtils::HashString("RESOURCES");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RESOURCES",
+        };
 
         SchemaElement GetSchemaElementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RESOURCES_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SchemaElement::RESOURCES;
+          case 803524101:
+            if (name == "RESOURCES")
+            {
+              return SchemaElement::RESOURCES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return SchemaElement::NOT_SET;
         }
 
-        Aws::String GetNameForSchemaElement(SchemaElement enumValue)
+        const char* GetNameForSchemaElementCStr(SchemaElement enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SchemaElement::RESOURCES:
-            return "RESOURCES";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSchemaElement(SchemaElement enumValue)
+        {
+          return GetNameForSchemaElementCStr(enumValue);
         }
 
       } // namespace SchemaElementMapper
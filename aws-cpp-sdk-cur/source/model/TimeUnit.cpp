@@ -30,20 +30,37 @@ namespace Aws
       namespace TimeUnitMapper
       {
 
-        static const int HOURLY_HASH = HashingUtils::HashString("HOURLY");
-        static const int DAILY_HASH = HashingUtils::HashString("DAILY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HOURLY",
+          "DAILY",
+        };
 
         TimeUnit GetTimeUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HOURLY_HASH)
-          {
-            return TimeUnit::HOURLY;
-          }
-          else if (hashCode == DAILY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TimeUnit::DAILY;
+          case 2136870513:
+            if (name == "HOURLY")
+            {
+              return TimeUnit::HOURLY;
+            }
+            break;
+          case 64808441:
+            if (name == "DAILY")
+            {
+              return TimeUnit::DAILY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TimeUnit::NOT_SET;
         }
 
-        Aws::String GetNameForTimeUnit(TimeUnit enumValue)
+        const char* GetNameForTimeUnitCStr(TimeUnit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TimeUnit::HOURLY:
-            return "HOURLY";
-          case TimeUnit::DAILY:
-            return "DAILY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTimeUnit(TimeUnit enumValue)
+        {
+          return GetNameForTimeUnitCStr(enumValue);
         }
 
       } // namespace TimeUnitMapper
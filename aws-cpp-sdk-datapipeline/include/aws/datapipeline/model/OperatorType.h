@@ -38,6 +38,11 @@ namespace OperatorTypeMapper
 AWS_DATAPIPELINE_API OperatorType GetOperatorTypeForName(const Aws::String& name);
 
 AWS_DATAPIPELINE_API Aws::String GetNameForOperatorType(OperatorType value);
+
+/**
+ * Same as GetNameForOperatorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATAPIPELINE_API const char* GetNameForOperatorTypeCStr(OperatorType value);
 } // namespace OperatorTypeMapper
 } // namespace Model
 } // namespace DataPipeline
@@ -36,6 +36,11 @@ namespace TaskStatusMapper
 AWS_DATAPIPELINE_API TaskStatus GetTaskStatusForName(const Aws::String& name);
 
 AWS_DATAPIPELINE_API Aws::String GetNameForTaskStatus(TaskStatus value);
+
+/**
+ * Same as GetNameForTaskStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATAPIPELINE_API const char* GetNameForTaskStatusCStr(TaskStatus value);
 } // namespace TaskStatusMapper
 } // namespace Model
 } // namespace DataPipeline
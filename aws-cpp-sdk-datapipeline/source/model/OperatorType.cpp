@@ -30,35 +30,58 @@ namespace Aws
       namespace OperatorTypeMapper
       {
 
-        static const int EQ_HASH = HashingUtils::HashString("EQ");
-        static const int REF_EQ_HASH = HashingUtils::HashString("REF_EQ");
-        static const int LE_HASH = HashingUtils::HashString("LE");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int BETWEEN_HASH = HashingUtils::HashString("BETWEEN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EQ",
+          "REF_EQ",
+          "LE",
+          "GE",
+          "BETWEEN",
+        };
 
         OperatorType GetOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQ_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperatorType::EQ;
-          }
-          else if (hashCode == REF_EQ_HASH)
-          {
-            return OperatorType::REF_EQ;
-          }
-          else if (hashCode == LE_HASH)
-          {
-            return OperatorType::LE;
-          }
-          else if (hashCode == GE_HASH)
-          {
-            return OperatorType::GE;
-          }
-          else if (hashCode == BETWEEN_HASH)
-          {
-            return OperatorType::BETWEEN;
+          case 2220:
+            if (name == "EQ")
+            {
+              return OperatorType::EQ;
+            }
+            break;
+          case -1881475080:
+            if (name == "REF_EQ")
+            {
+              return OperatorType::REF_EQ;
+            }
+            break;
+          case 2425:
+            if (name == "LE")
+            {
+              return OperatorType::LE;
+            }
+            break;
+          case 2270:
+            if (name == "GE")
+            {
+              return OperatorType::GE;
+            }
+            break;
+          case 501348328:
+            if (name == "BETWEEN")
+            {
+              return OperatorType::BETWEEN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return OperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForOperatorType(OperatorType enumValue)
+        const char* GetNameForOperatorTypeCStr(OperatorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperatorType::EQ:
-            return "EQ";
-          case OperatorType::REF_EQ:
-            return "REF_EQ";
-          case OperatorType::LE:
-            return "LE";
-          case OperatorType::GE:
-            return "GE";
-          case OperatorType::BETWEEN:
-            return "BETWEEN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperatorType(OperatorType enumValue)
+        {
+          return GetNameForOperatorTypeCStr(enumValue);
         }
 
       } // namespace OperatorTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TaskStatusMapper
       {
 
-        static const int FINISHED_HASH = HashingUtils::HashString("FINISHED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int FALSE_HASH = HashingUtils::HashString("FALSE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FINISHED",
+          "FAILED",
+          "FALSE",
+        };
 
         TaskStatus GetTaskStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FINISHED_HASH)
-          {
-            return TaskStatus::FINISHED;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TaskStatus::FAILED;
-          }
-          else if (hashCode == FALSE_HASH)
-          {
-            return TaskStatus::FALSE;
+          case 108966002:
+            if (name == "FINISHED")
+            {
+              return TaskStatus::FINISHED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return TaskStatus::FAILED;
+            }
+            break;
+          case 66658563:
+            if (name == "FALSE")
+            {
+              return TaskStatus::FALSE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TaskStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTaskStatus(TaskStatus enumValue)
+        const char* GetNameForTaskStatusCStr(TaskStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TaskStatus::FINISHED:
-            return "FINISHED";
-          case TaskStatus::FAILED:
-            return "FAILED";
-          case TaskStatus::FALSE:
-            return "FALSE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTaskStatus(TaskStatus enumValue)
+        {
+          return GetNameForTaskStatusCStr(enumValue);
         }
 
       } // namespace TaskStatusMapper
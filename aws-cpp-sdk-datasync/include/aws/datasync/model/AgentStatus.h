@@ -35,6 +35,11 @@ namespace AgentStatusMapper
 AWS_DATASYNC_API AgentStatus GetAgentStatusForName(const Aws::String& name);
 
 AWS_DATASYNC_API Aws::String GetNameForAgentStatus(AgentStatus value);
+
+/**
+ * Same as GetNameForAgentStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATASYNC_API const char* GetNameForAgentStatusCStr(AgentStatus value);
 } // namespace AgentStatusMapper
 } // namespace Model
 } // namespace DataSync
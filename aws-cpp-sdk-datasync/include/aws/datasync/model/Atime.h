@@ -35,6 +35,11 @@ namespace AtimeMapper
 AWS_DATASYNC_API Atime GetAtimeForName(const Aws::String& name);
 
 AWS_DATASYNC_API Aws::String GetNameForAtime(Atime value);
+
+/**
+ * Same as GetNameForAtime(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATASYNC_API const char* GetNameForAtimeCStr(Atime value);
 } // namespace AtimeMapper
 } // namespace Model
 } // namespace DataSync
@@ -37,6 +37,11 @@ namespace GidMapper
 AWS_DATASYNC_API Gid GetGidForName(const Aws::String& name);
 
 AWS_DATASYNC_API Aws::String GetNameForGid(Gid value);
+
+/**
+ * Same as GetNameForGid(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATASYNC_API const char* GetNameForGidCStr(Gid value);
 } // namespace GidMapper
 } // namespace Model
 } // namespace DataSync
@@ -35,6 +35,11 @@ namespace MtimeMapper
 AWS_DATASYNC_API Mtime GetMtimeForName(const Aws::String& name);
 
 AWS_DATASYNC_API Aws::String GetNameForMtime(Mtime value);
+
+/**
+ * Same as GetNameForMtime(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATASYNC_API const char* GetNameForMtimeCStr(Mtime value);
 } // namespace MtimeMapper
 } // namespace Model
 } // namespace DataSync
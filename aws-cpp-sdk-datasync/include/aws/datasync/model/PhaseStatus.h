@@ -36,6 +36,11 @@ namespace PhaseStatusMapper
 AWS_DATASYNC_API PhaseStatus GetPhaseStatusForName(const Aws::String& name);
 
 AWS_DATASYNC_API Aws::String GetNameForPhaseStatus(PhaseStatus value);
+
+/**
+ * Same as GetNameForPhaseStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATASYNC_API const char* GetNameForPhaseStatusCStr(PhaseStatus value);
 } // namespace PhaseStatusMapper
 } // namespace Model
 } // namespace DataSync
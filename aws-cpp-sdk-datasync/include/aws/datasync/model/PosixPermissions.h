@@ -36,6 +36,11 @@ namespace PosixPermissionsMapper
 AWS_DATASYNC_API PosixPermissions GetPosixPermissionsForName(const Aws::String& name);
 
 AWS_DATASYNC_API Aws::String GetNameForPosixPermissions(PosixPermissions value);
+
+/**
+ * Same as GetNameForPosixPermissions(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATASYNC_API const char* GetNameForPosixPermissionsCStr(PosixPermissions value);
 } // namespace PosixPermissionsMapper
 } // namespace Model
 } // namespace DataSync
@@ -35,6 +35,11 @@ namespace PreserveDeletedFilesMapper
 AWS_DATASYNC_API PreserveDeletedFiles GetPreserveDeletedFilesForName(const Aws::String& name);
 
 AWS_DATASYNC_API Aws::String GetNameForPreserveDeletedFiles(PreserveDeletedFiles value);
+
+/**
+ * Same as GetNameForPreserveDeletedFiles(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATASYNC_API const char* GetNameForPreserveDeletedFilesCStr(PreserveDeletedFiles value);
 } // namespace PreserveDeletedFilesMapper
 } // namespace Model
 } // namespace DataSync
@@ -35,6 +35,11 @@ namespace PreserveDevicesMapper
 AWS_DATASYNC_API PreserveDevices GetPreserveDevicesForName(const Aws::String& name);
 
 AWS_DATASYNC_API Aws::String GetNameForPreserveDevices(PreserveDevices value);
+
+/**
+ * Same as GetNameForPreserveDevices(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATASYNC_API const char* GetNameForPreserveDevicesCStr(PreserveDevices value);
 } // namespace PreserveDevicesMapper
 } // namespace Model
 } // namespace DataSync
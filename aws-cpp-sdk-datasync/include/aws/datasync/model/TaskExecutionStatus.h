@@ -39,6 +39,11 @@ namespace TaskExecutionStatusMapper
 AWS_DATASYNC_API TaskExecutionStatus GetTaskExecutionStatusForName(const Aws::String& name);
 
 AWS_DATASYNC_API Aws::String GetNameForTaskExecutionStatus(TaskExecutionStatus value);
+
+/**
+ * Same as GetNameForTaskExecutionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATASYNC_API const char* GetNameForTaskExecutionStatusCStr(TaskExecutionStatus value);
 } // namespace TaskExecutionStatusMapper
 } // namespace Model
 } // namespace DataSync
@@ -37,6 +37,11 @@ namespace UidMapper
 AWS_DATASYNC_API Uid GetUidForName(const Aws::String& name);
 
 AWS_DATASYNC_API Aws::String GetNameForUid(Uid value);
+
+/**
+ * Same as GetNameForUid(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATASYNC_API const char* GetNameForUidCStr(Uid value);
 } // namespace UidMapper
 } // namespace Model
 } // namespace DataSync
@@ -35,6 +35,11 @@ namespace VerifyModeMapper
 AWS_DATASYNC_API VerifyMode GetVerifyModeForName(const Aws::String& name);
 
 AWS_DATASYNC_API Aws::String GetNameForVerifyMode(VerifyMode value);
+
+/**
+ * Same as GetNameForVerifyMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATASYNC_API const char* GetNameForVerifyModeCStr(VerifyMode value);
 } // namespace VerifyModeMapper
 } // namespace Model
 } // namespace DataSync
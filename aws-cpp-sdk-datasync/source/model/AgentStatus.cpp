@@ -30,20 +30,37 @@ namespace Aws
       namespace AgentStatusMapper
       {
 
-        static const int ONLINE_HASH = HashingUtils::HashString("ONLINE");
-        static const int OFFLINE_HASH = HashingUtils::HashString("OFFLINE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ONLINE",
+          "OFFLINE",
+        };
 
         AgentStatus GetAgentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONLINE_HASH)
-          {
-            return AgentStatus::ONLINE;
-          }
-          else if (hashCode == OFFLINE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AgentStatus::OFFLINE;
+          case -1958892973:
+            if (name == "ONLINE")
+            {
+              return AgentStatus::ONLINE;
+            }
+            break;
+          case -830629437:
+            if (name == "OFFLINE")
+            {
+              return AgentStatus::OFFLINE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AgentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAgentStatus(AgentStatus enumValue)
+        const char* GetNameForAgentStatusCStr(AgentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AgentStatus::ONLINE:
-            return "ONLINE";
-          case AgentStatus::OFFLINE:
-            return "OFFLINE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAgentStatus(AgentStatus enumValue)
+        {
+          return GetNameForAgentStatusCStr(enumValue);
         }
 
       } // namespace AgentStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace AtimeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int BEST_EFFORT_HASH = HashingUtils::HashString("BEST_EFFORT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "BEST_EFFORT",
+        };
 
         Atime GetAtimeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return Atime::NONE;
-          }
-          else if (hashCode == BEST_EFFORT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Atime::BEST_EFFORT;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Atime::NONE;
+            }
+            break;
+          case 2113805223:
+            if (name == "BEST_EFFORT")
+            {
+              return Atime::BEST_EFFORT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Atime::NOT_SET;
         }
 
-        Aws::String GetNameForAtime(Atime enumValue)
+        const char* GetNameForAtimeCStr(Atime enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Atime::NONE:
-            return "NONE";
-          case Atime::BEST_EFFORT:
-            return "BEST_EFFORT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAtime(Atime enumValue)
+        {
+          return GetNameForAtimeCStr(enumValue);
         }
 
       } // namespace AtimeMapper
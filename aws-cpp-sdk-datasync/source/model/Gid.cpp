@@ -30,30 +30,51 @@ namespace Aws
       namespace GidMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int INT_VALUE_HASH = HashingUtils::HashString("INT_VALUE");
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int BOTH_HASH = HashingUtils::HashString("BOTH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "INT_VALUE",
+          "NAME",
+          "BOTH",
+        };
 
         Gid GetGidForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return Gid::NONE;
-          }
-          else if (hashCode == INT_VALUE_HASH)
-          {
-            return Gid::INT_VALUE;
-          }
-          else if (hashCode == NAME_HASH)
-          {
-            return Gid::NAME;
-          }
-          else if (hashCode == BOTH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Gid::BOTH;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Gid::NONE;
+            }
+            break;
+          case -257834783:
+            if (name == "INT_VALUE")
+            {
+              return Gid::INT_VALUE;
+            }
+            break;
+          case 2388619:
+            if (name == "NAME")
+            {
+              return Gid::NAME;
+            }
+            break;
+          case 2044801:
+            if (name == "BOTH")
+            {
+              return Gid::BOTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Gid::NOT_SET;
         }
 
-        Aws::String GetNameForGid(Gid enumValue)
+        const char* GetNameForGidCStr(Gid enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Gid::NONE:
-            return "NONE";
-          case Gid::INT_VALUE:
-            return "INT_VALUE";
-          case Gid::NAME:
-            return "NAME";
-          case Gid::BOTH:
-            return "BOTH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGid(Gid enumValue)
+        {
+          return GetNameForGidCStr(enumValue);
         }
 
       } // namespace GidMapper
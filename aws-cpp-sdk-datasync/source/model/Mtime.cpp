@@ -30,20 +30,37 @@ namespace Aws
       namespace MtimeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PRESERVE_HASH = HashingUtils::HashString("PRESERVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "PRESERVE",
+        };
 
         Mtime GetMtimeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return Mtime::NONE;
-          }
-          else if (hashCode == PRESERVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mtime::PRESERVE;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Mtime::NONE;
+            }
+            break;
+          case -494035380:
+            if (name == "PRESERVE")
+            {
+              return Mtime::PRESERVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Mtime::NOT_SET;
         }
 
-        Aws::String GetNameForMtime(Mtime enumValue)
+        const char* GetNameForMtimeCStr(Mtime enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mtime::NONE:
-            return "NONE";
-          case Mtime::PRESERVE:
-            return "PRESERVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMtime(Mtime enumValue)
+        {
+          return GetNameForMtimeCStr(enumValue);
         }
 
       } // namespace MtimeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PhaseStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "SUCCESS",
+          "ERROR",
+        };
 
         PhaseStatus GetPhaseStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return PhaseStatus::PENDING;
-          }
-          else if (hashCode == SUCCESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PhaseStatus::SUCCESS;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return PhaseStatus::ERROR_;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return PhaseStatus::PENDING;
+            }
+            break;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return PhaseStatus::SUCCESS;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return PhaseStatus::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PhaseStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPhaseStatus(PhaseStatus enumValue)
+        const char* GetNameForPhaseStatusCStr(PhaseStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PhaseStatus::PENDING:
-            return "PENDING";
-          case PhaseStatus::SUCCESS:
-            return "SUCCESS";
-          case PhaseStatus::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPhaseStatus(PhaseStatus enumValue)
+        {
+          return GetNameForPhaseStatusCStr(enumValue);
         }
 
       } // namespace PhaseStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PosixPermissionsMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int BEST_EFFORT_HASH = HashingUtils::HashString("BEST_EFFORT");
-        static const int PRESERVE_HASH = HashingUtils::HashString("PRESERVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "BEST_EFFORT",
+          "PRESERVE",
+        };
 
         PosixPermissions GetPosixPermissionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return PosixPermissions::NONE;
-          }
-          else if (hashCode == BEST_EFFORT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PosixPermissions::BEST_EFFORT;
-          }
-          else if (hashCode == PRESERVE_HASH)
-          {
-            return PosixPermissions::PRESERVE;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return PosixPermissions::NONE;
+            }
+            break;
+          case 2113805223:
+            if (name == "BEST_EFFORT")
+            {
+              return PosixPermissions::BEST_EFFORT;
+            }
+            break;
+          case -494035380:
+            if (name == "PRESERVE")
+            {
+              return PosixPermissions::PRESERVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PosixPermissions::NOT_SET;
         }
 
-        Aws::String GetNameForPosixPermissions(PosixPermissions enumValue)
+        const char* GetNameForPosixPermissionsCStr(PosixPermissions enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PosixPermissions::NONE:
-            return "NONE";
-          case PosixPermissions::BEST_EFFORT:
-            return "BEST_EFFORT";
-          case PosixPermissions::PRESERVE:
-            return "PRESERVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPosixPermissions(PosixPermissions enumValue)
+        {
+          return GetNameForPosixPermissionsCStr(enumValue);
         }
 
       } // namespace PosixPermissionsMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PreserveDeletedFilesMapper
       {
 
-        static const int PRESERVE_HASH = HashingUtils::HashString("PRESERVE");
-        static const int REMOVE_HASH = HashingUtils::HashString("REMOVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PRESERVE",
+          "REMOVE",
+        };
 
         PreserveDeletedFiles GetPreserveDeletedFilesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRESERVE_HASH)
-          {
-            return PreserveDeletedFiles::PRESERVE;
-          }
-          else if (hashCode == REMOVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PreserveDeletedFiles::REMOVE;
+          case -494035380:
+            if (name == "PRESERVE")
+            {
+              return PreserveDeletedFiles::PRESERVE;
+            }
+            break;
+          case -1881281404:
+            if (name == "REMOVE")
+            {
+              return PreserveDeletedFiles::REMOVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PreserveDeletedFiles::NOT_SET;
         }
 
-        Aws::String GetNameForPreserveDeletedFiles(PreserveDeletedFiles enumValue)
+        const char* GetNameForPreserveDeletedFilesCStr(PreserveDeletedFiles enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PreserveDeletedFiles::PRESERVE:
-            return "PRESERVE";
-          case PreserveDeletedFiles::REMOVE:
-            return "REMOVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPreserveDeletedFiles(PreserveDeletedFiles enumValue)
+        {
+          return GetNameForPreserveDeletedFilesCStr(enumValue);
         }
 
       } // namespace PreserveDeletedFilesMapper
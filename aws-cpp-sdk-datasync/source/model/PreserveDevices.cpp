@@ -30,20 +30,37 @@ namespace Aws
       namespace PreserveDevicesMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PRESERVE_HASH = HashingUtils::HashString("PRESERVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "PRESERVE",
+        };
 
         PreserveDevices GetPreserveDevicesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return PreserveDevices::NONE;
-          }
-          else if (hashCode == PRESERVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PreserveDevices::PRESERVE;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return PreserveDevices::NONE;
+            }
+            break;
+          case -494035380:
+            if (name == "PRESERVE")
+            {
+              return PreserveDevices::PRESERVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PreserveDevices::NOT_SET;
         }
 
-        Aws::String GetNameForPreserveDevices(PreserveDevices enumValue)
+        const char* GetNameForPreserveDevicesCStr(PreserveDevices enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PreserveDevices::NONE:
-            return "NONE";
-          case PreserveDevices::PRESERVE:
-            return "PRESERVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPreserveDevices(PreserveDevices enumValue)
+        {
+          return GetNameForPreserveDevicesCStr(enumValue);
         }
 
       } // namespace PreserveDevicesMapper
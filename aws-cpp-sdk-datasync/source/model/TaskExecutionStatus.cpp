@@ -30,40 +30,65 @@ namespace Aws
       namespace TaskExecutionStatusMapper
       {
 
-        static const int LAUNCHING_HASH = HashingUtils::HashString("LAUNCHING");
-        static const int PREPARING_HASH = HashingUtils::HashString("PREPARING");
-        static const int TRANSFERRING_HASH = HashingUtils::HashString("TRANSFERRING");
-        static const int VERIFYING_HASH = HashingUtils::HashString("VERIFYING");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LAUNCHING",
+          "PREPARING",
+          "TRANSFERRING",
+          "VERIFYING",
+          "SUCCESS",
+          "ERROR",
+        };
 
         TaskExecutionStatus GetTaskExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LAUNCHING_HASH)
-          {
-            return TaskExecutionStatus::LAUNCHING;
-          }
-          else if (hashCode == PREPARING_HASH)
-          {
-            return TaskExecutionStatus::PREPARING;
-          }
-          else if (hashCode == TRANSFERRING_HASH)
-          {
-            return TaskExecutionStatus::TRANSFERRING;
-          }
-          else if (hashCode == VERIFYING_HASH)
-          {
-            return TaskExecutionStatus::VERIFYING;
-          }
-          else if (hashCode == SUCCESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TaskExecutionStatus::SUCCESS;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return TaskExecutionStatus::ERROR_;
+          case 2111505199:
+            if (name == "LAUNCHING")
+            {
+              return TaskExecutionStatus::LAUNCHING;
+            }
+            break;
+          case 1775178724:
+            if (name == "PREPARING")
+            {
+              return TaskExecutionStatus::PREPARING;
+            }
+            break;
+          case 174660763:
+            if (name == "TRANSFERRING")
+            {
+              return TaskExecutionStatus::TRANSFERRING;
+            }
+            break;
+          case 1090724009:
+            if (name == "VERIFYING")
+            {
+              return TaskExecutionStatus::VERIFYING;
+            }
+            break;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return TaskExecutionStatus::SUCCESS;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return TaskExecutionStatus::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return TaskExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTaskExecutionStatus(TaskExecutionStatus enumValue)
+        const char* GetNameForTaskExecutionStatusCStr(TaskExecutionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TaskExecutionStatus::LAUNCHING:
-            return "LAUNCHING";
-          case TaskExecutionStatus::PREPARING:
-            return "PREPARING";
-          case TaskExecutionStatus::TRANSFERRING:
-            return "TRANSFERRING";
-          case TaskExecutionStatus::VERIFYING:
-            return "VERIFYING";
-          case TaskExecutionStatus::SUCCESS:
-            return "SUCCESS";
-          case TaskExecutionStatus::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTaskExecutionStatus(TaskExecutionStatus enumValue)
+        {
+          return GetNameForTaskExecutionStatusCStr(enumValue);
         }
 
       } // namespace TaskExecutionStatusMapper
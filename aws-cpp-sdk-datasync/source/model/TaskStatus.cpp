@@ -30,30 +30,51 @@ namespace Aws
       namespace TaskStatusMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int UNAVAILABLE_HASH = HashingUtils::HashString("UNAVAILABLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AVAILABLE",
+          "CREATING",
+          "RUNNING",
+          "UNAVAILABLE",
+        };
 
         TaskStatus GetTaskStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
-          {
-            return TaskStatus::AVAILABLE;
-          }
-          else if (hashCode == CREATING_HASH)
-          {
-            return TaskStatus::CREATING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return TaskStatus::RUNNING;
-          }
-          else if (hashCode == UNAVAILABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TaskStatus::UNAVAILABLE;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return TaskStatus::AVAILABLE;
+            }
+            break;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return TaskStatus::CREATING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return TaskStatus::RUNNING;
+            }
+            break;
+          case 1487498288:
+            if (name == "UNAVAILABLE")
+            {
+              return TaskStatus::UNAVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return TaskStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTaskStatus(TaskStatus enumValue)
+        const char* GetNameForTaskStatusCStr(TaskStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TaskStatus::AVAILABLE:
-            return "AVAILABLE";
-          case TaskStatus::CREATING:
-            return "CREATING";
-          case TaskStatus::RUNNING:
-            return "RUNNING";
-          case TaskStatus::UNAVAILABLE:
-            return "UNAVAILABLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTaskStatus(TaskStatus enumValue)
+        {
+          return GetNameForTaskStatusCStr(enumValue);
         }
 
       } // namespace TaskStatusMapper
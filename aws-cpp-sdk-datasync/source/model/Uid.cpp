@@ -30,30 +30,51 @@ namespace Aws
       namespace UidMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int INT_VALUE_HASH = HashingUtils::HashString("INT_VALUE");
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int BOTH_HASH = HashingUtils::HashString("BOTH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "INT_VALUE",
+          "NAME",
+          "BOTH",
+        };
 
         Uid GetUidForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return Uid::NONE;
-          }
-          else if (hashCode == INT_VALUE_HASH)
-          {
-            return Uid::INT_VALUE;
-          }
-          else if (hashCode == NAME_HASH)
-          {
-            return Uid::NAME;
-          }
-          else if (hashCode == BOTH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Uid::BOTH;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Uid::NONE;
+            }
+            break;
+          case -257834783:
+            if (name == "INT_VALUE")
+            {
+              return Uid::INT_VALUE;
+            }
+            break;
+          case 2388619:
+            if (name == "NAME")
+            {
+              return Uid::NAME;
+            }
+            break;
+          case 2044801:
+            if (name == "BOTH")
+            {
+              return Uid::BOTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Uid::NOT_SET;
         }
 
-        Aws::String GetNameForUid(Uid enumValue)
+        const char* GetNameForUidCStr(Uid enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Uid::NONE:
-            return "NONE";
-          case Uid::INT_VALUE:
-            return "INT_VALUE";
-          case Uid::NAME:
-            return "NAME";
-          case Uid::BOTH:
-            return "BOTH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUid(Uid enumValue)
+        {
+          return GetNameForUidCStr(enumValue);
         }
 
       } // namespace UidMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace VerifyModeMapper
       {
 
-        static const int POINT_IN_TIME_CONSISTENT_HASH = HashingUtils::HashString("POINT_IN_TIME_CONSISTENT");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "POINT_IN_TIME_CONSISTENT",
+          "NONE",
+        };
 
         VerifyMode GetVerifyModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == POINT_IN_TIME_CONSISTENT_HASH)
-          {
-            return VerifyMode::POINT_IN_TIME_CONSISTENT;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VerifyMode::NONE;
+          case 1990303577:
+            if (name == "POINT_IN_TIME_CONSISTENT")
+            {
+              return VerifyMode::POINT_IN_TIME_CONSISTENT;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return VerifyMode::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return VerifyMode::NOT_SET;
         }
 
-        Aws::String GetNameForVerifyMode(VerifyMode enumValue)
+        const char* GetNameForVerifyModeCStr(VerifyMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VerifyMode::POINT_IN_TIME_CONSISTENT:
-            return "POINT_IN_TIME_CONSISTENT";
-          case VerifyMode::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVerifyMode(VerifyMode enumValue)
+        {
+          return GetNameForVerifyModeCStr(enumValue);
         }
 
       } // namespace VerifyModeMapper
@@ -36,6 +36,11 @@ namespace IsModifiableMapper
 AWS_DAX_API IsModifiable GetIsModifiableForName(const Aws::String& name);
 
 AWS_DAX_API Aws::String GetNameForIsModifiable(IsModifiable value);
+
+/**
+ * Same as GetNameForIsModifiable(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DAX_API const char* GetNameForIsModifiableCStr(IsModifiable value);
 } // namespace IsModifiableMapper
 } // namespace Model
 } // namespace DAX
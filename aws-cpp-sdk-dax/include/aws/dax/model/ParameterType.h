@@ -35,6 +35,11 @@ namespace ParameterTypeMapper
 AWS_DAX_API ParameterType GetParameterTypeForName(const Aws::String& name);
 
 AWS_DAX_API Aws::String GetNameForParameterType(ParameterType value);
+
+/**
+ * Same as GetNameForParameterType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DAX_API const char* GetNameForParameterTypeCStr(ParameterType value);
 } // namespace ParameterTypeMapper
 } // namespace Model
 } // namespace DAX
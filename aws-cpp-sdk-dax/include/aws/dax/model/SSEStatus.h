@@ -37,6 +37,11 @@ namespace SSEStatusMapper
 AWS_DAX_API SSEStatus GetSSEStatusForName(const Aws::String& name);
 
 AWS_DAX_API Aws::String GetNameForSSEStatus(SSEStatus value);
+
+/**
+ * Same as GetNameForSSEStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DAX_API const char* GetNameForSSEStatusCStr(SSEStatus value);
 } // namespace SSEStatusMapper
 } // namespace Model
 } // namespace DAX
@@ -36,6 +36,11 @@ namespace SourceTypeMapper
 AWS_DAX_API SourceType GetSourceTypeForName(const Aws::String& name);
 
 AWS_DAX_API Aws::String GetNameForSourceType(SourceType value);
+
+/**
+ * Same as GetNameForSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DAX_API const char* GetNameForSourceTypeCStr(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace DAX
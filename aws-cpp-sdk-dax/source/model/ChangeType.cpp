@@ -30,20 +30,37 @@ namespace Aws
       namespace ChangeTypeMapper
       {
 
-        static const int IMMEDIATE_HASH = HashingUtils::HashString("IMMEDIATE");
-        static const int REQUIRES_REBOOT_HASH = HashingUtils::HashString("REQUIRES_REBOOT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IMMEDIATE",
+          "REQUIRES_REBOOT",
+        };
 
         ChangeType GetChangeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IMMEDIATE_HASH)
-          {
-            return ChangeType::IMMEDIATE;
-          }
-          else if (hashCode == REQUIRES_REBOOT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeType::REQUIRES_REBOOT;
+          case -383989871:
+            if (name == "IMMEDIATE")
+            {
+              return ChangeType::IMMEDIATE;
+            }
+            break;
+          case 955903318:
+            if (name == "REQUIRES_REBOOT")
+            {
+              return ChangeType::REQUIRES_REBOOT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ChangeType::NOT_SET;
         }
 
-        Aws::String GetNameForChangeType(ChangeType enumValue)
+        const char* GetNameForChangeTypeCStr(ChangeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeType::IMMEDIATE:
-            return "IMMEDIATE";
-          case ChangeType::REQUIRES_REBOOT:
-            return "REQUIRES_REBOOT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeType(ChangeType enumValue)
+        {
+          return GetNameForChangeTypeCStr(enumValue);
         }
 
       } // namespace ChangeTypeMapper
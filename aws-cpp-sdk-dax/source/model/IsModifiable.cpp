@@ -30,25 +30,44 @@ namespace Aws
       namespace IsModifiableMapper
       {
 
-        static const int TRUE_HASH = HashingUtils::HashString("TRUE");
-        static const int FALSE_HASH = HashingUtils::HashString("FALSE");
-        static const int CONDITIONAL_HASH = HashingUtils::HashString("CONDITIONAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TRUE",
+          "FALSE",
+          "CONDITIONAL",
+        };
 
         IsModifiable GetIsModifiableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRUE_HASH)
-          {
-            return IsModifiable::TRUE;
-          }
-          else if (hashCode == FALSE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IsModifiable::FALSE;
-          }
-          else if (hashCode == CONDITIONAL_HASH)
-          {
-            return IsModifiable::CONDITIONAL;
+          case 2583950:
+            if (name == "TRUE")
+            {
+              return IsModifiable::TRUE;
+            }
+            break;
+          case 66658563:
+            if (name == "FALSE")
+            {
+              return IsModifiable::FALSE;
+            }
+            break;
+          case -933875098:
+            if (name == "CONDITIONAL")
+            {
+              return IsModifiable::CONDITIONAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return IsModifiable::NOT_SET;
         }
 
-        Aws::String GetNameForIsModifiable(IsModifiable enumValue)
+        const char* GetNameForIsModifiableCStr(IsModifiable enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IsModifiable::TRUE:
-            return "TRUE";
-          case IsModifiable::FALSE:
-            return "FALSE";
-          case IsModifiable::CONDITIONAL:
-            return "CONDITIONAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIsModifiable(IsModifiable enumValue)
+        {
+          return GetNameForIsModifiableCStr(enumValue);
         }
 
       } // namespace IsModifiableMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ParameterTypeMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int NODE_TYPE_SPECIFIC_HASH = HashingUtils::HashString("NODE_TYPE_SPECIFIC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "NODE_TYPE_SPECIFIC",
+        };
 
         ParameterType GetParameterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return ParameterType::DEFAULT;
-          }
-          else if (hashCode == NODE_TYPE_SPECIFIC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ParameterType::NODE_TYPE_SPECIFIC;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return ParameterType::DEFAULT;
+            }
+            break;
+          case -1057173222:
+            if (name == "NODE_TYPE_SPECIFIC")
+            {
+              return ParameterType::NODE_TYPE_SPECIFIC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ParameterType::NOT_SET;
         }
 
-        Aws::String GetNameForParameterType(ParameterType enumValue)
+        const char* GetNameForParameterTypeCStr(ParameterType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ParameterType::DEFAULT:
-            return "DEFAULT";
-          case ParameterType::NODE_TYPE_SPECIFIC:
-            return "NODE_TYPE_SPECIFIC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForParameterType(ParameterType enumValue)
+        {
+          return GetNameForParameterTypeCStr(enumValue);
         }
 
       } // namespace ParameterTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace SSEStatusMapper
       {
 
-        static const int ENABLING_HASH = HashingUtils::HashString("ENABLING");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLING_HASH = HashingUtils::HashString("DISABLING");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLING",
+          "ENABLED",
+          "DISABLING",
+          "DISABLED",
+        };
 
         SSEStatus GetSSEStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLING_HASH)
-          {
-            return SSEStatus::ENABLING;
-          }
-          else if (hashCode == ENABLED_HASH)
-          {
-            return SSEStatus::ENABLED;
-          }
-          else if (hashCode == DISABLING_HASH)
-          {
-            return SSEStatus::DISABLING;
-          }
-          else if (hashCode == DISABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SSEStatus::DISABLED;
+          case -1870144128:
+            if (name == "ENABLING")
+            {
+              return SSEStatus::ENABLING;
+            }
+            break;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return SSEStatus::ENABLED;
+            }
+            break;
+          case -1699138171:
+            if (name == "DISABLING")
+            {
+              return SSEStatus::DISABLING;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return SSEStatus::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return SSEStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSSEStatus(SSEStatus enumValue)
+        const char* GetNameForSSEStatusCStr(SSEStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SSEStatus::ENABLING:
-            return "ENABLING";
-          case SSEStatus::ENABLED:
-            return "ENABLED";
-          case SSEStatus::DISABLING:
-            return "DISABLING";
-          case SSEStatus::DISABLED:
-            return "DISABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSSEStatus(SSEStatus enumValue)
+        {
+          return GetNameForSSEStatusCStr(enumValue);
         }
 
       } // namespace SSEStatusMapper
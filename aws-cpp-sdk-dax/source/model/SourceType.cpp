@@ -30,25 +30,44 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int CLUSTER_HASH = HashingUtils::HashString("CLUSTER");
-        static const int PARAMETER_GROUP_HASH = HashingUtils::HashString("PARAMETER_GROUP");
-        static const int SUBNET_GROUP_HASH = HashingUtils::HashString("SUBNET_GROUP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CLUSTER",
+          "PARAMETER_GROUP",
+          "SUBNET_GROUP",
+        };
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLUSTER_HASH)
-          {
-            return SourceType::CLUSTER;
-          }
-          else if (hashCode == PARAMETER_GROUP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SourceType::PARAMETER_GROUP;
-          }
-          else if (hashCode == SUBNET_GROUP_HASH)
-          {
-            return SourceType::SUBNET_GROUP;
+          case 1590074842:
+            if (name == "CLUSTER")
+            {
+              return SourceType::CLUSTER;
+            }
+            break;
+          case -1499882967:
+            if (name == "PARAMETER_GROUP")
+            {
+              return SourceType::PARAMETER_GROUP;
+            }
+            break;
+          case 397991677:
+            if (name == "SUBNET_GROUP")
+            {
+              return SourceType::SUBNET_GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceTypeCStr(SourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SourceType::CLUSTER:
-            return "CLUSTER";
-          case SourceType::PARAMETER_GROUP:
-            return "PARAMETER_GROUP";
-          case SourceType::SUBNET_GROUP:
-            return "SUBNET_GROUP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSourceType(SourceType enumValue)
+        {
+          return GetNameForSourceTypeCStr(enumValue);
         }
 
       } // namespace SourceTypeMapper
@@ -36,6 +36,11 @@ namespace ArtifactCategoryMapper
 AWS_DEVICEFARM_API ArtifactCategory GetArtifactCategoryForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForArtifactCategory(ArtifactCategory value);
+
+/**
+ * Same as GetNameForArtifactCategory(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForArtifactCategoryCStr(ArtifactCategory value);
 } // namespace ArtifactCategoryMapper
 } // namespace Model
 } // namespace DeviceFarm
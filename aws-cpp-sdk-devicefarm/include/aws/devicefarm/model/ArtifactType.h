@@ -61,6 +61,11 @@ namespace ArtifactTypeMapper
 AWS_DEVICEFARM_API ArtifactType GetArtifactTypeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForArtifactType(ArtifactType value);
+
+/**
+ * Same as GetNameForArtifactType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForArtifactTypeCStr(ArtifactType value);
 } // namespace ArtifactTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -35,6 +35,11 @@ namespace BillingMethodMapper
 AWS_DEVICEFARM_API BillingMethod GetBillingMethodForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForBillingMethod(BillingMethod value);
+
+/**
+ * Same as GetNameForBillingMethod(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForBillingMethodCStr(BillingMethod value);
 } // namespace BillingMethodMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -34,6 +34,11 @@ namespace CurrencyCodeMapper
 AWS_DEVICEFARM_API CurrencyCode GetCurrencyCodeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForCurrencyCode(CurrencyCode value);
+
+/**
+ * Same as GetNameForCurrencyCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForCurrencyCodeCStr(CurrencyCode value);
 } // namespace CurrencyCodeMapper
 } // namespace Model
 } // namespace DeviceFarm
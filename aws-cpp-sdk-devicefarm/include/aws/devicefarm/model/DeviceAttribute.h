@@ -43,6 +43,11 @@ namespace DeviceAttributeMapper
 AWS_DEVICEFARM_API DeviceAttribute GetDeviceAttributeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForDeviceAttribute(DeviceAttribute value);
+
+/**
+ * Same as GetNameForDeviceAttribute(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForDeviceAttributeCStr(DeviceAttribute value);
 } // namespace DeviceAttributeMapper
 } // namespace Model
 } // namespace DeviceFarm
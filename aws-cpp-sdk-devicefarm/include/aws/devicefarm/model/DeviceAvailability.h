@@ -37,6 +37,11 @@ namespace DeviceAvailabilityMapper
 AWS_DEVICEFARM_API DeviceAvailability GetDeviceAvailabilityForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForDeviceAvailability(DeviceAvailability value);
+
+/**
+ * Same as GetNameForDeviceAvailability(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForDeviceAvailabilityCStr(DeviceAvailability value);
 } // namespace DeviceAvailabilityMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -45,6 +45,11 @@ namespace DeviceFilterAttributeMapper
 AWS_DEVICEFARM_API DeviceFilterAttribute GetDeviceFilterAttributeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForDeviceFilterAttribute(DeviceFilterAttribute value);
+
+/**
+ * Same as GetNameForDeviceFilterAttribute(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForDeviceFilterAttributeCStr(DeviceFilterAttribute value);
 } // namespace DeviceFilterAttributeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -41,6 +41,11 @@ namespace DeviceFilterOperatorMapper
 AWS_DEVICEFARM_API DeviceFilterOperator GetDeviceFilterOperatorForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForDeviceFilterOperator(DeviceFilterOperator value);
+
+/**
+ * Same as GetNameForDeviceFilterOperator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForDeviceFilterOperatorCStr(DeviceFilterOperator value);
 } // namespace DeviceFilterOperatorMapper
 } // namespace Model
 } // namespace DeviceFarm
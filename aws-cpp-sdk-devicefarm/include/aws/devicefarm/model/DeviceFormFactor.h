@@ -35,6 +35,11 @@ namespace DeviceFormFactorMapper
 AWS_DEVICEFARM_API DeviceFormFactor GetDeviceFormFactorForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForDeviceFormFactor(DeviceFormFactor value);
+
+/**
+ * Same as GetNameForDeviceFormFactor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForDeviceFormFactorCStr(DeviceFormFactor value);
 } // namespace DeviceFormFactorMapper
 } // namespace Model
 } // namespace DeviceFarm
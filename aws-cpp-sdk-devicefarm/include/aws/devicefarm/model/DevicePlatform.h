@@ -35,6 +35,11 @@ namespace DevicePlatformMapper
 AWS_DEVICEFARM_API DevicePlatform GetDevicePlatformForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForDevicePlatform(DevicePlatform value);
+
+/**
+ * Same as GetNameForDevicePlatform(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForDevicePlatformCStr(DevicePlatform value);
 } // namespace DevicePlatformMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -35,6 +35,11 @@ namespace DevicePoolTypeMapper
 AWS_DEVICEFARM_API DevicePoolType GetDevicePoolTypeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForDevicePoolType(DevicePoolType value);
+
+/**
+ * Same as GetNameForDevicePoolType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForDevicePoolTypeCStr(DevicePoolType value);
 } // namespace DevicePoolTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -40,6 +40,11 @@ namespace ExecutionResultMapper
 AWS_DEVICEFARM_API ExecutionResult GetExecutionResultForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForExecutionResult(ExecutionResult value);
+
+/**
+ * Same as GetNameForExecutionResult(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForExecutionResultCStr(ExecutionResult value);
 } // namespace ExecutionResultMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -35,6 +35,11 @@ namespace ExecutionResultCodeMapper
 AWS_DEVICEFARM_API ExecutionResultCode GetExecutionResultCodeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForExecutionResultCode(ExecutionResultCode value);
+
+/**
+ * Same as GetNameForExecutionResultCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForExecutionResultCodeCStr(ExecutionResultCode value);
 } // namespace ExecutionResultCodeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -42,6 +42,11 @@ namespace ExecutionStatusMapper
 AWS_DEVICEFARM_API ExecutionStatus GetExecutionStatusForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForExecutionStatus(ExecutionStatus value);
+
+/**
+ * Same as GetNameForExecutionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForExecutionStatusCStr(ExecutionStatus value);
 } // namespace ExecutionStatusMapper
 } // namespace Model
 } // namespace DeviceFarm
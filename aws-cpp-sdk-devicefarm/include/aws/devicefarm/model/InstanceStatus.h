@@ -37,6 +37,11 @@ namespace InstanceStatusMapper
 AWS_DEVICEFARM_API InstanceStatus GetInstanceStatusForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForInstanceStatus(InstanceStatus value);
+
+/**
+ * Same as GetNameForInstanceStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForInstanceStatusCStr(InstanceStatus value);
 } // namespace InstanceStatusMapper
 } // namespace Model
 } // namespace DeviceFarm
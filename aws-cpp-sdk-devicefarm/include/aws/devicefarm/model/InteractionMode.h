@@ -36,6 +36,11 @@ namespace InteractionModeMapper
 AWS_DEVICEFARM_API InteractionMode GetInteractionModeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForInteractionMode(InteractionMode value);
+
+/**
+ * Same as GetNameForInteractionMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForInteractionModeCStr(InteractionMode value);
 } // namespace InteractionModeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -35,6 +35,11 @@ namespace NetworkProfileTypeMapper
 AWS_DEVICEFARM_API NetworkProfileType GetNetworkProfileTypeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForNetworkProfileType(NetworkProfileType value);
+
+/**
+ * Same as GetNameForNetworkProfileType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForNetworkProfileTypeCStr(NetworkProfileType value);
 } // namespace NetworkProfileTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
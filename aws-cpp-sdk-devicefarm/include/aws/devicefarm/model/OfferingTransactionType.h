@@ -36,6 +36,11 @@ namespace OfferingTransactionTypeMapper
 AWS_DEVICEFARM_API OfferingTransactionType GetOfferingTransactionTypeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForOfferingTransactionType(OfferingTransactionType value);
+
+/**
+ * Same as GetNameForOfferingTransactionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForOfferingTransactionTypeCStr(OfferingTransactionType value);
 } // namespace OfferingTransactionTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
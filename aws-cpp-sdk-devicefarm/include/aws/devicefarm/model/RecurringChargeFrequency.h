@@ -34,6 +34,11 @@ namespace RecurringChargeFrequencyMapper
 AWS_DEVICEFARM_API RecurringChargeFrequency GetRecurringChargeFrequencyForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForRecurringChargeFrequency(RecurringChargeFrequency value);
+
+/**
+ * Same as GetNameForRecurringChargeFrequency(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForRecurringChargeFrequencyCStr(RecurringChargeFrequency value);
 } // namespace RecurringChargeFrequencyMapper
 } // namespace Model
 } // namespace DeviceFarm
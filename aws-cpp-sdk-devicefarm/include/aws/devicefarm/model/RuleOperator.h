@@ -39,6 +39,11 @@ namespace RuleOperatorMapper
 AWS_DEVICEFARM_API RuleOperator GetRuleOperatorForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForRuleOperator(RuleOperator value);
+
+/**
+ * Same as GetNameForRuleOperator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForRuleOperatorCStr(RuleOperator value);
 } // namespace RuleOperatorMapper
 } // namespace Model
 } // namespace DeviceFarm
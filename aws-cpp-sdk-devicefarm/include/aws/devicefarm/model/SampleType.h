@@ -50,6 +50,11 @@ namespace SampleTypeMapper
 AWS_DEVICEFARM_API SampleType GetSampleTypeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForSampleType(SampleType value);
+
+/**
+ * Same as GetNameForSampleType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForSampleTypeCStr(SampleType value);
 } // namespace SampleTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
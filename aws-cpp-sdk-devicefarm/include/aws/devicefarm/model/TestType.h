@@ -50,6 +50,11 @@ namespace TestTypeMapper
 AWS_DEVICEFARM_API TestType GetTestTypeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForTestType(TestType value);
+
+/**
+ * Same as GetNameForTestType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForTestTypeCStr(TestType value);
 } // namespace TestTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
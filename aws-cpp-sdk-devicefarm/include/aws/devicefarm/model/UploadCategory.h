@@ -35,6 +35,11 @@ namespace UploadCategoryMapper
 AWS_DEVICEFARM_API UploadCategory GetUploadCategoryForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForUploadCategory(UploadCategory value);
+
+/**
+ * Same as GetNameForUploadCategory(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForUploadCategoryCStr(UploadCategory value);
 } // namespace UploadCategoryMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -37,6 +37,11 @@ namespace UploadStatusMapper
 AWS_DEVICEFARM_API UploadStatus GetUploadStatusForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForUploadStatus(UploadStatus value);
+
+/**
+ * Same as GetNameForUploadStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForUploadStatusCStr(UploadStatus value);
 } // namespace UploadStatusMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -57,6 +57,11 @@ namespace UploadTypeMapper
 AWS_DEVICEFARM_API UploadType GetUploadTypeForName(const Aws::String& name);
 
 AWS_DEVICEFARM_API Aws::String GetNameForUploadType(UploadType value);
+
+/**
+ * Same as GetNameForUploadType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DEVICEFARM_API const char* GetNameForUploadTypeCStr(UploadType value);
 } // namespace UploadTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -30,25 +30,44 @@ namespace Aws
       namespace ArtifactCategoryMapper
       {
 
-        static const int SCREENSHOT_HASH = HashingUtils::HashString("SCREENSHOT");
-        static const int FILE_HASH = HashingUtils::HashString("FILE");
-        static const int LOG_HASH = HashingUtils::HashString("LOG");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SCREENSHOT",
+          "FILE",
+          "LOG",
+        };
 
         ArtifactCategory GetArtifactCategoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SCREENSHOT_HASH)
-          {
-            return ArtifactCategory::SCREENSHOT;
-          }
-          else if (hashCode == FILE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ArtifactCategory::FILE;
-          }
-          else if (hashCode == LOG_HASH)
-          {
-            return ArtifactCategory::LOG;
+          case 68645222:
+            if (name == "SCREENSHOT")
+            {
+              return ArtifactCategory::SCREENSHOT;
+            }
+            break;
+          case 2157948:
+            if (name == "FILE")
+            {
+              return ArtifactCategory::FILE;
+            }
+            break;
+          case 75556:
+            if (name == "LOG")
+            {
+              return ArtifactCategory::LOG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ArtifactCategory::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactCategory(ArtifactCategory enumValue)
+        const char* GetNameForArtifactCategoryCStr(ArtifactCategory enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ArtifactCategory::SCREENSHOT:
-            return "SCREENSHOT";
-          case ArtifactCategory::FILE:
-            return "FILE";
-          case ArtifactCategory::LOG:
-            return "LOG";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForArtifactCategory(ArtifactCategory enumValue)
+        {
+          return GetNameForArtifactCategoryCStr(enumValue);
         }
 
       } // namespace ArtifactCategoryMapper
@@ -30,150 +30,219 @@ namespace Aws
       namespace ArtifactTypeMapper
       {
 
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-        static const int SCREENSHOT_HASH = HashingUtils::HashString("SCREENSHOT");
-        static const int DEVICE_LOG_HASH = HashingUtils::HashString("DEVICE_LOG");
-        static const int MESSAGE_LOG_HASH = HashingUtils::HashString("MESSAGE_LOG");
-        static const int VIDEO_LOG_HASH = HashingUtils::HashString("VIDEO_LOG");
-        static const int RESULT_LOG_HASH = HashingUtils::HashString("RESULT_LOG");
-        static const int SERVICE_LOG_HASH = HashingUtils::HashString("SERVICE_LOG");
-        static const int WEBKIT_LOG_HASH = HashingUtils::HashString("WEBKIT_LOG");
-        static const int INSTRUMENTATION_OUTPUT_HASH = HashingUtils::HashString("INSTRUMENTATION_OUTPUT");
-        static const int EXERCISER_MONKEY_OUTPUT_HASH = HashingUtils::HashString("EXERCISER_MONKEY_OUTPUT");
-        static const int CALABASH_JSON_OUTPUT_HASH = HashingUtils::HashString("CALABASH_JSON_OUTPUT");
-        static const int CALABASH_PRETTY_OUTPUT_HASH = HashingUtils::HashString("CALABASH_PRETTY_OUTPUT");
-        static const int CALABASH_STANDARD_OUTPUT_HASH = HashingUtils::HashString("CALABASH_STANDARD_OUTPUT");
-        static const int CALABASH_JAVA_XML_OUTPUT_HASH = HashingUtils::HashString("CALABASH_JAVA_XML_OUTPUT");
-        static const int AUTOMATION_OUTPUT_HASH = HashingUtils::HashString("AUTOMATION_OUTPUT");
-        static const int APPIUM_SERVER_OUTPUT_HASH = HashingUtils::HashString("APPIUM_SERVER_OUTPUT");
-        static const int APPIUM_JAVA_OUTPUT_HASH = HashingUtils::HashString("APPIUM_JAVA_OUTPUT");
-        static const int APPIUM_JAVA_XML_OUTPUT_HASH = HashingUtils::HashString("APPIUM_JAVA_XML_OUTPUT");
-        static const int APPIUM_PYTHON_OUTPUT_HASH = HashingUtils::HashString("APPIUM_PYTHON_OUTPUT");
-        static const int APPIUM_PYTHON_XML_OUTPUT_HASH = HashingUtils::HashString("APPIUM_PYTHON_XML_OUTPUT");
-        static const int EXPLORER_EVENT_LOG_HASH = HashingUtils::HashString("EXPLORER_EVENT_LOG");
-        static const int EXPLORER_SUMMARY_LOG_HASH = HashingUtils::HashString("EXPLORER_SUMMARY_LOG");
-        static const int APPLICATION_CRASH_REPORT_HASH = HashingUtils::HashString("APPLICATION_CRASH_REPORT");
-        static const int XCTEST_LOG_HASH = HashingUtils::HashString("XCTEST_LOG");
-        static const int VIDEO_HASH = HashingUtils::HashString("VIDEO");
-        static const int CUSTOMER_ARTIFACT_HASH = HashingUtils::HashString("CUSTOMER_ARTIFACT");
-        static const int CUSTOMER_ARTIFACT_LOG_HASH = HashingUtils::HashString("CUSTOMER_ARTIFACT_LOG");
-        static const int TESTSPEC_OUTPUT_HASH = HashingUtils::HashString("TESTSPEC_OUTPUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNKNOWN",
+          "SCREENSHOT",
+          "DEVICE_LOG",
+          "MESSAGE_LOG",
+          "VIDEO_LOG",
+          "RESULT_LOG",
+          "SERVICE_LOG",
+          "WEBKIT_LOG",
+          "INSTRUMENTATION_OUTPUT",
+          "EXERCISER_MONKEY_OUTPUT",
+          "CALABASH_JSON_OUTPUT",
+          "CALABASH_PRETTY_OUTPUT",
+          "CALABASH_STANDARD_OUTPUT",
+          "CALABASH_JAVA_XML_OUTPUT",
+          "AUTOMATION_OUTPUT",
+          "APPIUM_SERVER_OUTPUT",
+          "APPIUM_JAVA_OUTPUT",
+          "APPIUM_JAVA_XML_OUTPUT",
+          "APPIUM_PYTHON_OUTPUT",
+          "APPIUM_PYTHON_XML_OUTPUT",
+          "EXPLORER_EVENT_LOG",
+          "EXPLORER_SUMMARY_LOG",
+          "APPLICATION_CRASH_REPORT",
+          "XCTEST_LOG",
+          "VIDEO",
+          "CUSTOMER_ARTIFACT",
+          "CUSTOMER_ARTIFACT_LOG",
+          "TESTSPEC_OUTPUT",
+        };
 
         ArtifactType GetArtifactTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNKNOWN_HASH)
-          {
-            return ArtifactType::UNKNOWN;
-          }
-          else if (hashCode == SCREENSHOT_HASH)
-          {
-            return ArtifactType::SCREENSHOT;
-          }
-          else if (hashCode == DEVICE_LOG_HASH)
-          {
-            return ArtifactType::DEVICE_LOG;
-          }
-          else if (hashCode == MESSAGE_LOG_HASH)
-          {
-            return ArtifactType::MESSAGE_LOG;
-          }
-          else if (hashCode == VIDEO_LOG_HASH)
-          {
-            return ArtifactType::VIDEO_LOG;
-          }
-          else if (hashCode == RESULT_LOG_HASH)
-          {
-            return ArtifactType::RESULT_LOG;
-          }
-          else if (hashCode == SERVICE_LOG_HASH)
-          {
-            return ArtifactType::SERVICE_LOG;
-          }
-          else if (hashCode == WEBKIT_LOG_HASH)
-          {
-            return ArtifactType::WEBKIT_LOG;
-          }
-          else if (hashCode == INSTRUMENTATION_OUTPUT_HASH)
-          {
-            return ArtifactType::INSTRUMENTATION_OUTPUT;
-          }
-          else if (hashCode == EXERCISER_MONKEY_OUTPUT_HASH)
-          {
-            return ArtifactType::EXERCISER_MONKEY_OUTPUT;
-          }
-          else if (hashCode == CALABASH_JSON_OUTPUT_HASH)
-          {
-            return ArtifactType::CALABASH_JSON_OUTPUT;
-          }
-          else if (hashCode == CALABASH_PRETTY_OUTPUT_HASH)
-          {
-            return ArtifactType::CALABASH_PRETTY_OUTPUT;
-          }
-          else if (hashCode == CALABASH_STANDARD_OUTPUT_HASH)
-          {
-            return ArtifactType::CALABASH_STANDARD_OUTPUT;
-          }
-          else if (hashCode == CALABASH_JAVA_XML_OUTPUT_HASH)
-          {
-            return ArtifactType::CALABASH_JAVA_XML_OUTPUT;
-          }
-          else if (hashCode == AUTOMATION_OUTPUT_HASH)
-          {
-            return ArtifactType::AUTOMATION_OUTPUT;
-          }
-          else if (hashCode == APPIUM_SERVER_OUTPUT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ArtifactType::APPIUM_SERVER_OUTPUT;
-          }
-          else if (hashCode == APPIUM_JAVA_OUTPUT_HASH)
-          {
-            return ArtifactType::APPIUM_JAVA_OUTPUT;
-          }
-          else if (hashCode == APPIUM_JAVA_XML_OUTPUT_HASH)
-          {
-            return ArtifactType::APPIUM_JAVA_XML_OUTPUT;
-          }
-          else if (hashCode == APPIUM_PYTHON_OUTPUT_HASH)
-          {
-            return ArtifactType::APPIUM_PYTHON_OUTPUT;
-          }
-          else if (hashCode == APPIUM_PYTHON_XML_OUTPUT_HASH)
-          {
-            return ArtifactType::APPIUM_PYTHON_XML_OUTPUT;
-          }
-          else if (hashCode == EXPLORER_EVENT_LOG_HASH)
-          {
-            return ArtifactType::EXPLORER_EVENT_LOG;
-          }
-          else if (hashCode == EXPLORER_SUMMARY_LOG_HASH)
-          {
-            return ArtifactType::EXPLORER_SUMMARY_LOG;
-          }
-          else if (hashCode == APPLICATION_CRASH_REPORT_HASH)
-          {
-            return ArtifactType::APPLICATION_CRASH_REPORT;
-          }
-          else if (hashCode == XCTEST_LOG_HASH)
-          {
-            return ArtifactType::XCTEST_LOG;
-          }
-          else if (hashCode == VIDEO_HASH)
-          {
-            return ArtifactType::VIDEO;
-          }
-          else if (hashCode == CUSTOMER_ARTIFACT_HASH)
-          {
-            return ArtifactType::CUSTOMER_ARTIFACT;
-          }
-          else if (hashCode == CUSTOMER_ARTIFACT_LOG_HASH)
-          {
-            return ArtifactType::CUSTOMER_ARTIFACT_LOG;
-          }
-          else if (hashCode == TESTSPEC_OUTPUT_HASH)
-          {
-            return ArtifactType::TESTSPEC_OUTPUT;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return ArtifactType::UNKNOWN;
+            }
+            break;
+          case 68645222:
+            if (name == "SCREENSHOT")
+            {
+              return ArtifactType::SCREENSHOT;
+            }
+            break;
+          case 1267551675:
+            if (name == "DEVICE_LOG")
+            {
+              return ArtifactType::DEVICE_LOG;
+            }
+            break;
+          case 1281136332:
+            if (name == "MESSAGE_LOG")
+            {
+              return ArtifactType::MESSAGE_LOG;
+            }
+            break;
+          case -174142144:
+            if (name == "VIDEO_LOG")
+            {
+              return ArtifactType::VIDEO_LOG;
+            }
+            break;
+          case -85476350:
+            if (name == "RESULT_LOG")
+            {
+              return ArtifactType::RESULT_LOG;
+            }
+            break;
+          case 225859194:
+            if (name == "SERVICE_LOG")
+            {
+              return ArtifactType::SERVICE_LOG;
+            }
+            break;
+          case -1002038169:
+            if (name == "WEBKIT_LOG")
+            {
+              return ArtifactType::WEBKIT_LOG;
+            }
+            break;
+          case -1179088110:
+            if (name == "INSTRUMENTATION_OUTPUT")
+            {
+              return ArtifactType::INSTRUMENTATION_OUTPUT;
+            }
+            break;
+          case -1882315544:
+            if (name == "EXERCISER_MONKEY_OUTPUT")
+            {
+              return ArtifactType::EXERCISER_MONKEY_OUTPUT;
+            }
+            break;
+          case -1547207776:
+            if (name == "CALABASH_JSON_OUTPUT")
+            {
+              return ArtifactType::CALABASH_JSON_OUTPUT;
+            }
+            break;
+          case 9981522:
+            if (name == "CALABASH_PRETTY_OUTPUT")
+            {
+              return ArtifactType::CALABASH_PRETTY_OUTPUT;
+            }
+            break;
+          case -96627669:
+            if (name == "CALABASH_STANDARD_OUTPUT")
+            {
+              return ArtifactType::CALABASH_STANDARD_OUTPUT;
+            }
+            break;
+          case 993412078:
+            if (name == "CALABASH_JAVA_XML_OUTPUT")
+            {
+              return ArtifactType::CALABASH_JAVA_XML_OUTPUT;
+            }
+            break;
+          case 1515057449:
+            if (name == "AUTOMATION_OUTPUT")
+            {
+              return ArtifactType::AUTOMATION_OUTPUT;
+            }
+            break;
+          case -737629570:
+            if (name == "APPIUM_SERVER_OUTPUT")
+            {
+              return ArtifactType::APPIUM_SERVER_OUTPUT;
+            }
+            break;
+          case 1061080831:
+            if (name == "APPIUM_JAVA_OUTPUT")
+            {
+              return ArtifactType::APPIUM_JAVA_OUTPUT;
+            }
+            break;
+          case -1710279353:
+            if (name == "APPIUM_JAVA_XML_OUTPUT")
+            {
+              return ArtifactType::APPIUM_JAVA_XML_OUTPUT;
+            }
+            break;
+          case -1689429307:
+            if (name == "APPIUM_PYTHON_OUTPUT")
+            {
+              return ArtifactType::APPIUM_PYTHON_OUTPUT;
+            }
+            break;
+          case -255431155:
+            if (name == "APPIUM_PYTHON_XML_OUTPUT")
+            {
+              return ArtifactType::APPIUM_PYTHON_XML_OUTPUT;
+            }
+            break;
+          case 222774239:
+            if (name == "EXPLORER_EVENT_LOG")
+            {
+              return ArtifactType::EXPLORER_EVENT_LOG;
+            }
+            break;
+          case 1081710315:
+            if (name == "EXPLORER_SUMMARY_LOG")
+            {
+              return ArtifactType::EXPLORER_SUMMARY_LOG;
+            }
+            break;
+          case -866688101:
+            if (name == "APPLICATION_CRASH_REPORT")
+            {
+              return ArtifactType::APPLICATION_CRASH_REPORT;
+            }
+            break;
+          case -1316558366:
+            if (name == "XCTEST_LOG")
+            {
+              return ArtifactType::XCTEST_LOG;
+            }
+            break;
+          case 81665115:
+            if (name == "VIDEO")
+            {
+              return ArtifactType::VIDEO;
+            }
+            break;
+          case 2007150867:
+            if (name == "CUSTOMER_ARTIFACT")
+            {
+              return ArtifactType::CUSTOMER_ARTIFACT;
+            }
+            break;
+          case -1776663048:
+            if (name == "CUSTOMER_ARTIFACT_LOG")
+            {
+              return ArtifactType::CUSTOMER_ARTIFACT_LOG;
+            }
+            break;
+          case 672765491:
+            if (name == "TESTSPEC_OUTPUT")
+            {
+              return ArtifactType::TESTSPEC_OUTPUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -185,75 +254,26 @@ namespace Aws
           return ArtifactType::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactType(ArtifactType enumValue)
+        const char* GetNameForArtifactTypeCStr(ArtifactType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ArtifactType::UNKNOWN:
-            return "UNKNOWN";
-          case ArtifactType::SCREENSHOT:
-            return "SCREENSHOT";
-          case ArtifactType::DEVICE_LOG:
-            return "DEVICE_LOG";
-          case ArtifactType::MESSAGE_LOG:
-            return "MESSAGE_LOG";
-          case ArtifactType::VIDEO_LOG:
-            return "VIDEO_LOG";
-          case ArtifactType::RESULT_LOG:
-            return "RESULT_LOG";
-          case ArtifactType::SERVICE_LOG:
-            return "SERVICE_LOG";
-          case ArtifactType::WEBKIT_LOG:
-            return "WEBKIT_LOG";
-          case ArtifactType::INSTRUMENTATION_OUTPUT:
-            return "INSTRUMENTATION_OUTPUT";
-          case ArtifactType::EXERCISER_MONKEY_OUTPUT:
-            return "EXERCISER_MONKEY_OUTPUT";
-          case ArtifactType::CALABASH_JSON_OUTPUT:
-            return "CALABASH_JSON_OUTPUT";
-          case ArtifactType::CALABASH_PRETTY_OUTPUT:
-            return "CALABASH_PRETTY_OUTPUT";
-          case ArtifactType::CALABASH_STANDARD_OUTPUT:
-            return "CALABASH_STANDARD_OUTPUT";
-          case ArtifactType::CALABASH_JAVA_XML_OUTPUT:
-            return "CALABASH_JAVA_XML_OUTPUT";
-          case ArtifactType::AUTOMATION_OUTPUT:
-            return "AUTOMATION_OUTPUT";
-          case ArtifactType::APPIUM_SERVER_OUTPUT:
-            return "APPIUM_SERVER_OUTPUT";
-          case ArtifactType::APPIUM_JAVA_OUTPUT:
-            return "APPIUM_JAVA_OUTPUT";
-          case ArtifactType::APPIUM_JAVA_XML_OUTPUT:
-            return "APPIUM_JAVA_XML_OUTPUT";
-          case ArtifactType::APPIUM_PYTHON_OUTPUT:
-            return "APPIUM_PYTHON_OUTPUT";
-          case ArtifactType::APPIUM_PYTHON_XML_OUTPUT:
-            return "APPIUM_PYTHON_XML_OUTPUT";
-          case ArtifactType::EXPLORER_EVENT_LOG:
-            return "EXPLORER_EVENT_LOG";
-          case ArtifactType::EXPLORER_SUMMARY_LOG:
-            return "EXPLORER_SUMMARY_LOG";
-          case ArtifactType::APPLICATION_CRASH_REPORT:
-            return "APPLICATION_CRASH_REPORT";
-          case ArtifactType::XCTEST_LOG:
-            return "XCTEST_LOG";
-          case ArtifactType::VIDEO:
-            return "VIDEO";
-          case ArtifactType::CUSTOMER_ARTIFACT:
-            return "CUSTOMER_ARTIFACT";
-          case ArtifactType::CUSTOMER_ARTIFACT_LOG:
-            return "CUSTOMER_ARTIFACT_LOG";
-          case ArtifactType::TESTSPEC_OUTPUT:
-            return "TESTSPEC_OUTPUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForArtifactType(ArtifactType enumValue)
+        {
+          return GetNameForArtifactTypeCStr(enumValue);
         }
 
       } // namespace ArtifactTypeMapper
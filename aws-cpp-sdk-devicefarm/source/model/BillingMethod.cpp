@@ -30,20 +30,37 @@ namespace Aws
       namespace BillingMethodMapper
       {
 
-        static const int METERED_HASH = HashingUtils::HashString("METERED");
-        static const int UNMETERED_HASH = HashingUtils::HashString("UNMETERED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "METERED",
+          "UNMETERED",
+        };
 
         BillingMethod GetBillingMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == METERED_HASH)
-          {
-            return BillingMethod::METERED;
-          }
-          else if (hashCode == UNMETERED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BillingMethod::UNMETERED;
+          case 1673430472:
+            if (name == "METERED")
+            {
+              return BillingMethod::METERED;
+            }
+            break;
+          case 1158876431:
+            if (name == "UNMETERED")
+            {
+              return BillingMethod::UNMETERED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BillingMethod::NOT_SET;
         }
 
-        Aws::String GetNameForBillingMethod(BillingMethod enumValue)
+        const char* GetNameForBillingMethodCStr(BillingMethod enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BillingMethod::METERED:
-            return "METERED";
-          case BillingMethod::UNMETERED:
-            return "UNMETERED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBillingMethod(BillingMethod enumValue)
+        {
+          return GetNameForBillingMethodCStr(enumValue);
         }
 
       } // namespace BillingMethodMapper
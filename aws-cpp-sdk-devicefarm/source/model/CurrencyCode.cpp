@@ -30,15 +30,30 @@ namespace Aws
       namespace CurrencyCodeMapper
       {
 
-        static const int USD_HASH = HashingUtils::HashString("USD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USD",
+        };
 
         CurrencyCode GetCurrencyCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CurrencyCode::USD;
+          case 84326:
+            if (name == "USD")
+            {
+              return CurrencyCode::USD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return CurrencyCode::NOT_SET;
         }
 
-        Aws::String GetNameForCurrencyCode(CurrencyCode enumValue)
+        const char* GetNameForCurrencyCodeCStr(CurrencyCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CurrencyCode::USD:
-            return "USD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCurrencyCode(CurrencyCode enumValue)
+        {
+          return GetNameForCurrencyCodeCStr(enumValue);
         }
 
       } // namespace CurrencyCodeMapper
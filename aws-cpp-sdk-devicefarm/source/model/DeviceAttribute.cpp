@@ -30,60 +30,93 @@ namespace Aws
       namespace DeviceAttributeMapper
       {
 
-        static const int ARN_HASH = HashingUtils::HashString("ARN");
-        static const int PLATFORM_HASH = HashingUtils::HashString("PLATFORM");
-        static const int FORM_FACTOR_HASH = HashingUtils::HashString("FORM_FACTOR");
-        static const int MANUFACTURER_HASH = HashingUtils::HashString("MANUFACTURER");
-        static const int REMOTE_ACCESS_ENABLED_HASH = HashingUtils::HashString("REMOTE_ACCESS_ENABLED");
-        static const int REMOTE_DEBUG_ENABLED_HASH = HashingUtils::HashString("REMOTE_DEBUG_ENABLED");
-        static const int APPIUM_VERSION_HASH = HashingUtils::HashString("APPIUM_VERSION");
-        static const int INSTANCE_ARN_HASH = HashingUtils::HashString("INSTANCE_ARN");
-        static const int INSTANCE_LABELS_HASH = HashingUtils::HashString("INSTANCE_LABELS");
-        static const int FLEET_TYPE_HASH = HashingUtils::HashString("FLEET_TYPE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ARN",
+          "PLATFORM",
+          "FORM_FACTOR",
+          "MANUFACTURER",
+          "REMOTE_ACCESS_ENABLED",
+          "REMOTE_DEBUG_ENABLED",
+          "APPIUM_VERSION",
+          "INSTANCE_ARN",
+          "INSTANCE_LABELS",
+          "FLEET_TYPE",
+        };
 
         DeviceAttribute GetDeviceAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ARN_HASH)
-          {
-            return DeviceAttribute::ARN;
-          }
-          else if (hashCode == PLATFORM_HASH)
-          {
-            return DeviceAttribute::PLATFORM;
-          }
-          else if (hashCode == FORM_FACTOR_HASH)
-          {
-            return DeviceAttribute::FORM_FACTOR;
-          }
-          else if (hashCode == MANUFACTURER_HASH)
-          {
-            return DeviceAttribute::MANUFACTURER;
-          }
-          else if (hashCode == REMOTE_ACCESS_ENABLED_HASH)
-          {
-            return DeviceAttribute::REMOTE_ACCESS_ENABLED;
-          }
-          else if (hashCode == REMOTE_DEBUG_ENABLED_HASH)
-          {
-            return DeviceAttribute::REMOTE_DEBUG_ENABLED;
-          }
-          else if (hashCode == APPIUM_VERSION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeviceAttribute::APPIUM_VERSION;
-          }
-          else if (hashCode == INSTANCE_ARN_HASH)
-          {
-            return DeviceAttribute::INSTANCE_ARN;
-          }
-          else if (hashCode == INSTANCE_LABELS_HASH)
-          {
-            return DeviceAttribute::INSTANCE_LABELS;
-          }
-          else if (hashCode == FLEET_TYPE_HASH)
-          {
-            return DeviceAttribute::FLEET_TYPE;
+          case 65085:
+            if (name == "ARN")
+            {
+              return DeviceAttribute::ARN;
+            }
+            break;
+          case -1637656461:
+            if (name == "PLATFORM")
+            {
+              return DeviceAttribute::PLATFORM;
+            }
+            break;
+          case -227557078:
+            if (name == "FORM_FACTOR")
+            {
+              return DeviceAttribute::FORM_FACTOR;
+            }
+            break;
+          case 347933649:
+            if (name == "MANUFACTURER")
+            {
+              return DeviceAttribute::MANUFACTURER;
+            }
+            break;
+          case 562262111:
+            if (name == "REMOTE_ACCESS_ENABLED")
+            {
+              return DeviceAttribute::REMOTE_ACCESS_ENABLED;
+            }
+            break;
+          case 365642972:
+            if (name == "REMOTE_DEBUG_ENABLED")
+            {
+              return DeviceAttribute::REMOTE_DEBUG_ENABLED;
+            }
+            break;
+          case 1078272633:
+            if (name == "APPIUM_VERSION")
+            {
+              return DeviceAttribute::APPIUM_VERSION;
+            }
+            break;
+          case 1580883859:
+            if (name == "INSTANCE_ARN")
+            {
+              return DeviceAttribute::INSTANCE_ARN;
+            }
+            break;
+          case 2093574889:
+            if (name == "INSTANCE_LABELS")
+            {
+              return DeviceAttribute::INSTANCE_LABELS;
+            }
+            break;
+          case -1495382101:
+            if (name == "FLEET_TYPE")
+            {
+              return DeviceAttribute::FLEET_TYPE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return DeviceAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceAttribute(DeviceAttribute enumValue)
+        const char* GetNameForDeviceAttributeCStr(DeviceAttribute enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeviceAttribute::ARN:
-            return "ARN";
-          case DeviceAttribute::PLATFORM:
-            return "PLATFORM";
-          case DeviceAttribute::FORM_FACTOR:
-            return "FORM_FACTOR";
-          case DeviceAttribute::MANUFACTURER:
-            return "MANUFACTURER";
-          case DeviceAttribute::REMOTE_ACCESS_ENABLED:
-            return "REMOTE_ACCESS_ENABLED";
-          case DeviceAttribute::REMOTE_DEBUG_ENABLED:
-            return "REMOTE_DEBUG_ENABLED";
-          case DeviceAttribute::APPIUM_VERSION:
-            return "APPIUM_VERSION";
-          case DeviceAttribute::INSTANCE_ARN:
-            return "INSTANCE_ARN";
-          case DeviceAttribute::INSTANCE_LABELS:
-            return "INSTANCE_LABELS";
-          case DeviceAttribute::FLEET_TYPE:
-            return "FLEET_TYPE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeviceAttribute(DeviceAttribute enumValue)
+        {
+          return GetNameForDeviceAttributeCStr(enumValue);
         }
 
       } // namespace DeviceAttributeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace DeviceAvailabilityMapper
       {
 
-        static const int TEMPORARY_NOT_AVAILABLE_HASH = HashingUtils::HashString("TEMPORARY_NOT_AVAILABLE");
-        static const int BUSY_HASH = HashingUtils::HashString("BUSY");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int HIGHLY_AVAILABLE_HASH = HashingUtils::HashString("HIGHLY_AVAILABLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TEMPORARY_NOT_AVAILABLE",
+          "BUSY",
+          "AVAILABLE",
+          "HIGHLY_AVAILABLE",
+        };
 
         DeviceAvailability GetDeviceAvailabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TEMPORARY_NOT_AVAILABLE_HASH)
-          {
-            return DeviceAvailability::TEMPORARY_NOT_AVAILABLE;
-          }
-          else if (hashCode == BUSY_HASH)
-          {
-            return DeviceAvailability::BUSY;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return DeviceAvailability::AVAILABLE;
-          }
-          else if (hashCode == HIGHLY_AVAILABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeviceAvailability::HIGHLY_AVAILABLE;
+          case 134772367:
+            if (name == "TEMPORARY_NOT_AVAILABLE")
+            {
+              return DeviceAvailability::TEMPORARY_NOT_AVAILABLE;
+            }
+            break;
+          case 2050553:
+            if (name == "BUSY")
+            {
+              return DeviceAvailability::BUSY;
+            }
+            break;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return DeviceAvailability::AVAILABLE;
+            }
+            break;
+          case -137476839:
+            if (name == "HIGHLY_AVAILABLE")
+            {
+              return DeviceAvailability::HIGHLY_AVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DeviceAvailability::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceAvailability(DeviceAvailability enumValue)
+        const char* GetNameForDeviceAvailabilityCStr(DeviceAvailability enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeviceAvailability::TEMPORARY_NOT_AVAILABLE:
-            return "TEMPORARY_NOT_AVAILABLE";
-          case DeviceAvailability::BUSY:
-            return "BUSY";
-          case DeviceAvailability::AVAILABLE:
-            return "AVAILABLE";
-          case DeviceAvailability::HIGHLY_AVAILABLE:
-            return "HIGHLY_AVAILABLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeviceAvailability(DeviceAvailability enumValue)
+        {
+          return GetNameForDeviceAvailabilityCStr(enumValue);
         }
 
       } // namespace DeviceAvailabilityMapper
@@ -30,70 +30,107 @@ namespace Aws
       namespace DeviceFilterAttributeMapper
       {
 
-        static const int ARN_HASH = HashingUtils::HashString("ARN");
-        static const int PLATFORM_HASH = HashingUtils::HashString("PLATFORM");
-        static const int OS_VERSION_HASH = HashingUtils::HashString("OS_VERSION");
-        static const int MODEL_HASH = HashingUtils::HashString("MODEL");
-        static const int AVAILABILITY_HASH = HashingUtils::HashString("AVAILABILITY");
-        static const int FORM_FACTOR_HASH = HashingUtils::HashString("FORM_FACTOR");
-        static const int MANUFACTURER_HASH = HashingUtils::HashString("MANUFACTURER");
-        static const int REMOTE_ACCESS_ENABLED_HASH = HashingUtils::HashString("REMOTE_ACCESS_ENABLED");
-        static const int REMOTE_DEBUG_ENABLED_HASH = HashingUtils::HashString("REMOTE_DEBUG_ENABLED");
-        static const int INSTANCE_ARN_HASH = HashingUtils::HashString("INSTANCE_ARN");
-        static const int INSTANCE_LABELS_HASH = HashingUtils::HashString("INSTANCE_LABELS");
-        static const int FLEET_TYPE_HASH = HashingUtils::HashString("FLEET_TYPE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ARN",
+          "PLATFORM",
+          "OS_VERSION",
+          "MODEL",
+          "AVAILABILITY",
+          "FORM_FACTOR",
+          "MANUFACTURER",
+          "REMOTE_ACCESS_ENABLED",
+          "REMOTE_DEBUG_ENABLED",
+          "INSTANCE_ARN",
+          "INSTANCE_LABELS",
+          "FLEET_TYPE",
+        };
 
         DeviceFilterAttribute GetDeviceFilterAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ARN_HASH)
-          {
-            return DeviceFilterAttribute::ARN;
-          }
-          else if (hashCode == PLATFORM_HASH)
-          {
-            return DeviceFilterAttribute::PLATFORM;
-          }
-          else if (hashCode == OS_VERSION_HASH)
-          {
-            return DeviceFilterAttribute::OS_VERSION;
-          }
-          else if (hashCode == MODEL_HASH)
-          {
-            return DeviceFilterAttribute::MODEL;
-          }
-          else if (hashCode == AVAILABILITY_HASH)
-          {
-            return DeviceFilterAttribute::AVAILABILITY;
-          }
-          else if (hashCode == FORM_FACTOR_HASH)
-          {
-            return DeviceFilterAttribute::FORM_FACTOR;
-          }
-          else if (hashCode == MANUFACTURER_HASH)
-          {
-            return DeviceFilterAttribute::MANUFACTURER;
-          }
-          else if (hashCode == REMOTE_ACCESS_ENABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeviceFilterAttribute::REMOTE_ACCESS_ENABLED;
-          }
-          else if (hashCode == REMOTE_DEBUG_ENABLED_HASH)
-          {
-            return DeviceFilterAttribute::REMOTE_DEBUG_ENABLED;
-          }
-          else if (hashCode == INSTANCE_ARN_HASH)
-          {
-            return DeviceFilterAttribute::INSTANCE_ARN;
-          }
-          else if (hashCode == INSTANCE_LABELS_HASH)
-          {
-            return DeviceFilterAttribute::INSTANCE_LABELS;
-          }
-          else if (hashCode == FLEET_TYPE_HASH)
-          {
-            return DeviceFilterAttribute::FLEET_TYPE;
+          case 65085:
+            if (name == "ARN")
+            {
+              return DeviceFilterAttribute::ARN;
+            }
+            break;
+          case -1637656461:
+            if (name == "PLATFORM")
+            {
+              return DeviceFilterAttribute::PLATFORM;
+            }
+            break;
+          case 1093285213:
+            if (name == "OS_VERSION")
+            {
+              return DeviceFilterAttribute::OS_VERSION;
+            }
+            break;
+          case 73532169:
+            if (name == "MODEL")
+            {
+              return DeviceFilterAttribute::MODEL;
+            }
+            break;
+          case 19856731:
+            if (name == "AVAILABILITY")
+            {
+              return DeviceFilterAttribute::AVAILABILITY;
+            }
+            break;
+          case -227557078:
+            if (name == "FORM_FACTOR")
+            {
+              return DeviceFilterAttribute::FORM_FACTOR;
+            }
+            break;
+          case 347933649:
+            if (name == "MANUFACTURER")
+            {
+              return DeviceFilterAttribute::MANUFACTURER;
+            }
+            break;
+          case 562262111:
+            if (name == "REMOTE_ACCESS_ENABLED")
+            {
+              return DeviceFilterAttribute::REMOTE_ACCESS_ENABLED;
+            }
+            break;
+          case 365642972:
+            if (name == "REMOTE_DEBUG_ENABLED")
+            {
+              return DeviceFilterAttribute::REMOTE_DEBUG_ENABLED;
+            }
+            break;
+          case 1580883859:
+            if (name == "INSTANCE_ARN")
+            {
+              return DeviceFilterAttribute::INSTANCE_ARN;
+            }
+            break;
+          case 2093574889:
+            if (name == "INSTANCE_LABELS")
+            {
+              return DeviceFilterAttribute::INSTANCE_LABELS;
+            }
+            break;
+          case -1495382101:
+            if (name == "FLEET_TYPE")
+            {
+              return DeviceFilterAttribute::FLEET_TYPE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return DeviceFilterAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceFilterAttribute(DeviceFilterAttribute enumValue)
+        const char* GetNameForDeviceFilterAttributeCStr(DeviceFilterAttribute enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeviceFilterAttribute::ARN:
-            return "ARN";
-          case DeviceFilterAttribute::PLATFORM:
-            return "PLATFORM";
-          case DeviceFilterAttribute::OS_VERSION:
-            return "OS_VERSION";
-          case DeviceFilterAttribute::MODEL:
-            return "MODEL";
-          case DeviceFilterAttribute::AVAILABILITY:
-            return "AVAILABILITY";
-          case DeviceFilterAttribute::FORM_FACTOR:
-            return "FORM_FACTOR";
-          case DeviceFilterAttribute::MANUFACTURER:
-            return "MANUFACTURER";
-          case DeviceFilterAttribute::REMOTE_ACCESS_ENABLED:
-            return "REMOTE_ACCESS_ENABLED";
-          case DeviceFilterAttribute::REMOTE_DEBUG_ENABLED:
-            return "REMOTE_DEBUG_ENABLED";
-          case DeviceFilterAttribute::INSTANCE_ARN:
-            return "INSTANCE_ARN";
-          case DeviceFilterAttribute::INSTANCE_LABELS:
-            return "INSTANCE_LABELS";
-          case DeviceFilterAttribute::FLEET_TYPE:
-            return "FLEET_TYPE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeviceFilterAttribute(DeviceFilterAttribute enumValue)
+        {
+          return GetNameForDeviceFilterAttributeCStr(enumValue);
         }
 
       } // namespace DeviceFilterAttributeMapper
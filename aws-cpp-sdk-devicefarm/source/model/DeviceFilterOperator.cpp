@@ -30,50 +30,79 @@ namespace Aws
       namespace DeviceFilterOperatorMapper
       {
 
-        static const int EQUALS_HASH = HashingUtils::HashString("EQUALS");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int LESS_THAN_OR_EQUALS_HASH = HashingUtils::HashString("LESS_THAN_OR_EQUALS");
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
-        static const int GREATER_THAN_OR_EQUALS_HASH = HashingUtils::HashString("GREATER_THAN_OR_EQUALS");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int NOT_IN_HASH = HashingUtils::HashString("NOT_IN");
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EQUALS",
+          "LESS_THAN",
+          "LESS_THAN_OR_EQUALS",
+          "GREATER_THAN",
+          "GREATER_THAN_OR_EQUALS",
+          "IN",
+          "NOT_IN",
+          "CONTAINS",
+        };
 
         DeviceFilterOperator GetDeviceFilterOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQUALS_HASH)
-          {
-            return DeviceFilterOperator::EQUALS;
-          }
-          else if (hashCode == LESS_THAN_HASH)
-          {
-            return DeviceFilterOperator::LESS_THAN;
-          }
-          else if (hashCode == LESS_THAN_OR_EQUALS_HASH)
-          {
-            return DeviceFilterOperator::LESS_THAN_OR_EQUALS;
-          }
-          else if (hashCode == GREATER_THAN_HASH)
-          {
-            return DeviceFilterOperator::GREATER_THAN;
-          }
-          else if (hashCode == GREATER_THAN_OR_EQUALS_HASH)
-          {
-            return DeviceFilterOperator::GREATER_THAN_OR_EQUALS;
-          }
-          else if (hashCode == IN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeviceFilterOperator::IN;
-          }
-          else if (hashCode == NOT_IN_HASH)
-          {
-            return DeviceFilterOperator::NOT_IN;
-          }
-          else if (hashCode == CONTAINS_HASH)
-          {
-            return DeviceFilterOperator::CONTAINS;
+          case 2052813759:
+            if (name == "EQUALS")
+            {
+              return DeviceFilterOperator::EQUALS;
+            }
+            break;
+          case -1112834937:
+            if (name == "LESS_THAN")
+            {
+              return DeviceFilterOperator::LESS_THAN;
+            }
+            break;
+          case -110769181:
+            if (name == "LESS_THAN_OR_EQUALS")
+            {
+              return DeviceFilterOperator::LESS_THAN_OR_EQUALS;
+            }
+            break;
+          case 972152550:
+            if (name == "GREATER_THAN")
+            {
+              return DeviceFilterOperator::GREATER_THAN;
+            }
+            break;
+          case 595067778:
+            if (name == "GREATER_THAN_OR_EQUALS")
+            {
+              return DeviceFilterOperator::GREATER_THAN_OR_EQUALS;
+            }
+            break;
+          case 2341:
+            if (name == "IN")
+            {
+              return DeviceFilterOperator::IN;
+            }
+            break;
+          case -1986339279:
+            if (name == "NOT_IN")
+            {
+              return DeviceFilterOperator::NOT_IN;
+            }
+            break;
+          case 215180831:
+            if (name == "CONTAINS")
+            {
+              return DeviceFilterOperator::CONTAINS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return DeviceFilterOperator::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceFilterOperator(DeviceFilterOperator enumValue)
+        const char* GetNameForDeviceFilterOperatorCStr(DeviceFilterOperator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeviceFilterOperator::EQUALS:
-            return "EQUALS";
-          case DeviceFilterOperator::LESS_THAN:
-            return "LESS_THAN";
-          case DeviceFilterOperator::LESS_THAN_OR_EQUALS:
-            return "LESS_THAN_OR_EQUALS";
-          case DeviceFilterOperator::GREATER_THAN:
-            return "GREATER_THAN";
-          case DeviceFilterOperator::GREATER_THAN_OR_EQUALS:
-            return "GREATER_THAN_OR_EQUALS";
-          case DeviceFilterOperator::IN:
-            return "IN";
-          case DeviceFilterOperator::NOT_IN:
-            return "NOT_IN";
-          case DeviceFilterOperator::CONTAINS:
-            return "CONTAINS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeviceFilterOperator(DeviceFilterOperator enumValue)
+        {
+          return GetNameForDeviceFilterOperatorCStr(enumValue);
         }
 
       } // namespace DeviceFilterOperatorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DeviceFormFactorMapper
       {
 
-        static const int PHONE_HASH = HashingUtils::HashString("PHONE");
-        static const int TABLET_HASH = HashingUtils::HashString("TABLET");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PHONE",
+          "TABLET",
+        };
 
         DeviceFormFactor GetDeviceFormFactorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PHONE_HASH)
-          {
-            return DeviceFormFactor::PHONE;
-          }
-          else if (hashCode == TABLET_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeviceFormFactor::TABLET;
+          case 76105038:
+            if (name == "PHONE")
+            {
+              return DeviceFormFactor::PHONE;
+            }
+            break;
+          case -1828048282:
+            if (name == "TABLET")
+            {
+              return DeviceFormFactor::TABLET;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeviceFormFactor::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceFormFactor(DeviceFormFactor enumValue)
+        const char* GetNameForDeviceFormFactorCStr(DeviceFormFactor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeviceFormFactor::PHONE:
-            return "PHONE";
-          case DeviceFormFactor::TABLET:
-            return "TABLET";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeviceFormFactor(DeviceFormFactor enumValue)
+        {
+          return GetNameForDeviceFormFactorCStr(enumValue);
         }
 
       } // namespace DeviceFormFactorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DevicePlatformMapper
       {
 
-        static const int ANDROID__HASH = HashingUtils::HashString("ANDROID");
-        static const int IOS_HASH = HashingUtils::HashString("IOS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ANDROID",
+          "IOS",
+        };
 
         DevicePlatform GetDevicePlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ANDROID__HASH)
-          {
-            return DevicePlatform::ANDROID_;
-          }
-          else if (hashCode == IOS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DevicePlatform::IOS;
+          case -143408561:
+            if (name == "ANDROID")
+            {
+              return DevicePlatform::ANDROID_;
+            }
+            break;
+          case 72685:
+            if (name == "IOS")
+            {
+              return DevicePlatform::IOS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DevicePlatform::NOT_SET;
         }
 
-        Aws::String GetNameForDevicePlatform(DevicePlatform enumValue)
+        const char* GetNameForDevicePlatformCStr(DevicePlatform enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DevicePlatform::ANDROID_:
-            return "ANDROID";
-          case DevicePlatform::IOS:
-            return "IOS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDevicePlatform(DevicePlatform enumValue)
+        {
+          return GetNameForDevicePlatformCStr(enumValue);
         }
 
       } // namespace DevicePlatformMapper
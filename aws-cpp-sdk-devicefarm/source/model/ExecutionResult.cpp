@@ -30,45 +30,72 @@ namespace Aws
       namespace ExecutionResultMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int PASSED_HASH = HashingUtils::HashString("PASSED");
-        static const int WARNED_HASH = HashingUtils::HashString("WARNED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SKIPPED_HASH = HashingUtils::HashString("SKIPPED");
-        static const int ERRORED_HASH = HashingUtils::HashString("ERRORED");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "PASSED",
+          "WARNED",
+          "FAILED",
+          "SKIPPED",
+          "ERRORED",
+          "STOPPED",
+        };
 
         ExecutionResult GetExecutionResultForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return ExecutionResult::PENDING;
-          }
-          else if (hashCode == PASSED_HASH)
-          {
-            return ExecutionResult::PASSED;
-          }
-          else if (hashCode == WARNED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExecutionResult::WARNED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ExecutionResult::FAILED;
-          }
-          else if (hashCode == SKIPPED_HASH)
-          {
-            return ExecutionResult::SKIPPED;
-          }
-          else if (hashCode == ERRORED_HASH)
-          {
-            return ExecutionResult::ERRORED;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return ExecutionResult::STOPPED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ExecutionResult::PENDING;
+            }
+            break;
+          case -1942051728:
+            if (name == "PASSED")
+            {
+              return ExecutionResult::PASSED;
+            }
+            break;
+          case -1741682267:
+            if (name == "WARNED")
+            {
+              return ExecutionResult::WARNED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ExecutionResult::FAILED;
+            }
+            break;
+          case -1429540080:
+            if (name == "SKIPPED")
+            {
+              return ExecutionResult::SKIPPED;
+            }
+            break;
+          case -761001849:
+            if (name == "ERRORED")
+            {
+              return ExecutionResult::ERRORED;
+            }
+            break;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return ExecutionResult::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ExecutionResult::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionResult(ExecutionResult enumValue)
+        const char* GetNameForExecutionResultCStr(ExecutionResult enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExecutionResult::PENDING:
-            return "PENDING";
-          case ExecutionResult::PASSED:
-            return "PASSED";
-          case ExecutionResult::WARNED:
-            return "WARNED";
-          case ExecutionResult::FAILED:
-            return "FAILED";
-          case ExecutionResult::SKIPPED:
-            return "SKIPPED";
-          case ExecutionResult::ERRORED:
-            return "ERRORED";
-          case ExecutionResult::STOPPED:
-            return "STOPPED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExecutionResult(ExecutionResult enumValue)
+        {
+          return GetNameForExecutionResultCStr(enumValue);
         }
 
       } // namespace ExecutionResultMapper
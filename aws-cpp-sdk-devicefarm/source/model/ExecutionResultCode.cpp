@@ -30,20 +30,37 @@ namespace Aws
       namespace ExecutionResultCodeMapper
       {
 
-        static const int PARSING_FAILED_HASH = HashingUtils::HashString("PARSING_FAILED");
-        static const int VPC_ENDPOINT_SETUP_FAILED_HASH = HashingUtils::HashString("VPC_ENDPOINT_SETUP_FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PARSING_FAILED",
+          "VPC_ENDPOINT_SETUP_FAILED",
+        };
 
         ExecutionResultCode GetExecutionResultCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PARSING_FAILED_HASH)
-          {
-            return ExecutionResultCode::PARSING_FAILED;
-          }
-          else if (hashCode == VPC_ENDPOINT_SETUP_FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExecutionResultCode::VPC_ENDPOINT_SETUP_FAILED;
+          case -1552375604:
+            if (name == "PARSING_FAILED")
+            {
+              return ExecutionResultCode::PARSING_FAILED;
+            }
+            break;
+          case 1409157075:
+            if (name == "VPC_ENDPOINT_SETUP_FAILED")
+            {
+              return ExecutionResultCode::VPC_ENDPOINT_SETUP_FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ExecutionResultCode::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionResultCode(ExecutionResultCode enumValue)
+        const char* GetNameForExecutionResultCodeCStr(ExecutionResultCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExecutionResultCode::PARSING_FAILED:
-            return "PARSING_FAILED";
-          case ExecutionResultCode::VPC_ENDPOINT_SETUP_FAILED:
-            return "VPC_ENDPOINT_SETUP_FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExecutionResultCode(ExecutionResultCode enumValue)
+        {
+          return GetNameForExecutionResultCodeCStr(enumValue);
         }
 
       } // namespace ExecutionResultCodeMapper
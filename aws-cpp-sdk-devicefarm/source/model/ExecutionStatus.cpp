@@ -30,55 +30,86 @@ namespace Aws
       namespace ExecutionStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int PENDING_CONCURRENCY_HASH = HashingUtils::HashString("PENDING_CONCURRENCY");
-        static const int PENDING_DEVICE_HASH = HashingUtils::HashString("PENDING_DEVICE");
-        static const int PROCESSING_HASH = HashingUtils::HashString("PROCESSING");
-        static const int SCHEDULING_HASH = HashingUtils::HashString("SCHEDULING");
-        static const int PREPARING_HASH = HashingUtils::HashString("PREPARING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "PENDING_CONCURRENCY",
+          "PENDING_DEVICE",
+          "PROCESSING",
+          "SCHEDULING",
+          "PREPARING",
+          "RUNNING",
+          "COMPLETED",
+          "STOPPING",
+        };
 
         ExecutionStatus GetExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return ExecutionStatus::PENDING;
-          }
-          else if (hashCode == PENDING_CONCURRENCY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExecutionStatus::PENDING_CONCURRENCY;
-          }
-          else if (hashCode == PENDING_DEVICE_HASH)
-          {
-            return ExecutionStatus::PENDING_DEVICE;
-          }
-          else if (hashCode == PROCESSING_HASH)
-          {
-            return ExecutionStatus::PROCESSING;
-          }
-          else if (hashCode == SCHEDULING_HASH)
-          {
-            return ExecutionStatus::SCHEDULING;
-          }
-          else if (hashCode == PREPARING_HASH)
-          {
-            return ExecutionStatus::PREPARING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ExecutionStatus::RUNNING;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return ExecutionStatus::COMPLETED;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return ExecutionStatus::STOPPING;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ExecutionStatus::PENDING;
+            }
+            break;
+          case 164191403:
+            if (name == "PENDING_CONCURRENCY")
+            {
+              return ExecutionStatus::PENDING_CONCURRENCY;
+            }
+            break;
+          case -2111031778:
+            if (name == "PENDING_DEVICE")
+            {
+              return ExecutionStatus::PENDING_DEVICE;
+            }
+            break;
+          case 907287315:
+            if (name == "PROCESSING")
+            {
+              return ExecutionStatus::PROCESSING;
+            }
+            break;
+          case -201961068:
+            if (name == "SCHEDULING")
+            {
+              return ExecutionStatus::SCHEDULING;
+            }
+            break;
+          case 1775178724:
+            if (name == "PREPARING")
+            {
+              return ExecutionStatus::PREPARING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return ExecutionStatus::RUNNING;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return ExecutionStatus::COMPLETED;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return ExecutionStatus::STOPPING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return ExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionStatus(ExecutionStatus enumValue)
+        const char* GetNameForExecutionStatusCStr(ExecutionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExecutionStatus::PENDING:
-            return "PENDING";
-          case ExecutionStatus::PENDING_CONCURRENCY:
-            return "PENDING_CONCURRENCY";
-          case ExecutionStatus::PENDING_DEVICE:
-            return "PENDING_DEVICE";
-          case ExecutionStatus::PROCESSING:
-            return "PROCESSING";
-          case ExecutionStatus::SCHEDULING:
-            return "SCHEDULING";
-          case ExecutionStatus::PREPARING:
-            return "PREPARING";
-          case ExecutionStatus::RUNNING:
-            return "RUNNING";
-          case ExecutionStatus::COMPLETED:
-            return "COMPLETED";
-          case ExecutionStatus::STOPPING:
-            return "STOPPING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExecutionStatus(ExecutionStatus enumValue)
+        {
+          return GetNameForExecutionStatusCStr(enumValue);
         }
 
       } // namespace ExecutionStatusMapper
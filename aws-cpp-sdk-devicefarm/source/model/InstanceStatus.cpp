@@ -30,30 +30,51 @@ namespace Aws
       namespace InstanceStatusMapper
       {
 
-        static const int IN_USE_HASH = HashingUtils::HashString("IN_USE");
-        static const int PREPARING_HASH = HashingUtils::HashString("PREPARING");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int NOT_AVAILABLE_HASH = HashingUtils::HashString("NOT_AVAILABLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_USE",
+          "PREPARING",
+          "AVAILABLE",
+          "NOT_AVAILABLE",
+        };
 
         InstanceStatus GetInstanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_USE_HASH)
-          {
-            return InstanceStatus::IN_USE;
-          }
-          else if (hashCode == PREPARING_HASH)
-          {
-            return InstanceStatus::PREPARING;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return InstanceStatus::AVAILABLE;
-          }
-          else if (hashCode == NOT_AVAILABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceStatus::NOT_AVAILABLE;
+          case -2130090163:
+            if (name == "IN_USE")
+            {
+              return InstanceStatus::IN_USE;
+            }
+            break;
+          case 1775178724:
+            if (name == "PREPARING")
+            {
+              return InstanceStatus::PREPARING;
+            }
+            break;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return InstanceStatus::AVAILABLE;
+            }
+            break;
+          case 140722205:
+            if (name == "NOT_AVAILABLE")
+            {
+              return InstanceStatus::NOT_AVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return InstanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceStatus(InstanceStatus enumValue)
+        const char* GetNameForInstanceStatusCStr(InstanceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceStatus::IN_USE:
-            return "IN_USE";
-          case InstanceStatus::PREPARING:
-            return "PREPARING";
-          case InstanceStatus::AVAILABLE:
-            return "AVAILABLE";
-          case InstanceStatus::NOT_AVAILABLE:
-            return "NOT_AVAILABLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceStatus(InstanceStatus enumValue)
+        {
+          return GetNameForInstanceStatusCStr(enumValue);
         }
 
       } // namespace InstanceStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace InteractionModeMapper
       {
 
-        static const int INTERACTIVE_HASH = HashingUtils::HashString("INTERACTIVE");
-        static const int NO_VIDEO_HASH = HashingUtils::HashString("NO_VIDEO");
-        static const int VIDEO_ONLY_HASH = HashingUtils::HashString("VIDEO_ONLY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INTERACTIVE",
+          "NO_VIDEO",
+          "VIDEO_ONLY",
+        };
 
         InteractionMode GetInteractionModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERACTIVE_HASH)
-          {
-            return InteractionMode::INTERACTIVE;
-          }
-          else if (hashCode == NO_VIDEO_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InteractionMode::NO_VIDEO;
-          }
-          else if (hashCode == VIDEO_ONLY_HASH)
-          {
-            return InteractionMode::VIDEO_ONLY;
+          case -297901374:
+            if (name == "INTERACTIVE")
+            {
+              return InteractionMode::INTERACTIVE;
+            }
+            break;
+          case -1599966115:
+            if (name == "NO_VIDEO")
+            {
+              return InteractionMode::NO_VIDEO;
+            }
+            break;
+          case -1103350512:
+            if (name == "VIDEO_ONLY")
+            {
+              return InteractionMode::VIDEO_ONLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InteractionMode::NOT_SET;
         }
 
-        Aws::String GetNameForInteractionMode(InteractionMode enumValue)
+        const char* GetNameForInteractionModeCStr(InteractionMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InteractionMode::INTERACTIVE:
-            return "INTERACTIVE";
-          case InteractionMode::NO_VIDEO:
-            return "NO_VIDEO";
-          case InteractionMode::VIDEO_ONLY:
-            return "VIDEO_ONLY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInteractionMode(InteractionMode enumValue)
+        {
+          return GetNameForInteractionModeCStr(enumValue);
         }
 
       } // namespace InteractionModeMapper
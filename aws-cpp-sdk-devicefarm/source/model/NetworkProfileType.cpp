@@ -30,20 +30,37 @@ namespace Aws
       namespace NetworkProfileTypeMapper
       {
 
-        static const int CURATED_HASH = HashingUtils::HashString("CURATED");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CURATED",
+          "PRIVATE",
+        };
 
         NetworkProfileType GetNetworkProfileTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CURATED_HASH)
-          {
-            return NetworkProfileType::CURATED;
-          }
-          else if (hashCode == PRIVATE__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NetworkProfileType::PRIVATE_;
+          case 1844430386:
+            if (name == "CURATED")
+            {
+              return NetworkProfileType::CURATED;
+            }
+            break;
+          case 403485027:
+            if (name == "PRIVATE")
+            {
+              return NetworkProfileType::PRIVATE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return NetworkProfileType::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkProfileType(NetworkProfileType enumValue)
+        const char* GetNameForNetworkProfileTypeCStr(NetworkProfileType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NetworkProfileType::CURATED:
-            return "CURATED";
-          case NetworkProfileType::PRIVATE_:
-            return "PRIVATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNetworkProfileType(NetworkProfileType enumValue)
+        {
+          return GetNameForNetworkProfileTypeCStr(enumValue);
         }
 
       } // namespace NetworkProfileTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace OfferingTransactionTypeMapper
       {
 
-        static const int PURCHASE_HASH = HashingUtils::HashString("PURCHASE");
-        static const int RENEW_HASH = HashingUtils::HashString("RENEW");
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PURCHASE",
+          "RENEW",
+          "SYSTEM",
+        };
 
         OfferingTransactionType GetOfferingTransactionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PURCHASE_HASH)
-          {
-            return OfferingTransactionType::PURCHASE;
-          }
-          else if (hashCode == RENEW_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OfferingTransactionType::RENEW;
-          }
-          else if (hashCode == SYSTEM_HASH)
-          {
-            return OfferingTransactionType::SYSTEM;
+          case -1769016063:
+            if (name == "PURCHASE")
+            {
+              return OfferingTransactionType::PURCHASE;
+            }
+            break;
+          case 77861485:
+            if (name == "RENEW")
+            {
+              return OfferingTransactionType::RENEW;
+            }
+            break;
+          case -1833998801:
+            if (name == "SYSTEM")
+            {
+              return OfferingTransactionType::SYSTEM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return OfferingTransactionType::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingTransactionType(OfferingTransactionType enumValue)
+        const char* GetNameForOfferingTransactionTypeCStr(OfferingTransactionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OfferingTransactionType::PURCHASE:
-            return "PURCHASE";
-          case OfferingTransactionType::RENEW:
-            return "RENEW";
-          case OfferingTransactionType::SYSTEM:
-            return "SYSTEM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOfferingTransactionType(OfferingTransactionType enumValue)
+        {
+          return GetNameForOfferingTransactionTypeCStr(enumValue);
         }
 
       } // namespace OfferingTransactionTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace OfferingTypeMapper
       {
 
-        static const int RECURRING_HASH = HashingUtils::HashString("RECURRING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RECURRING",
+        };
 
         OfferingType GetOfferingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RECURRING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OfferingType::RECURRING;
+          case -342622531:
+            if (name == "RECURRING")
+            {
+              return OfferingType::RECURRING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return OfferingType::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingType(OfferingType enumValue)
+        const char* GetNameForOfferingTypeCStr(OfferingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OfferingType::RECURRING:
-            return "RECURRING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOfferingType(OfferingType enumValue)
+        {
+          return GetNameForOfferingTypeCStr(enumValue);
         }
 
       } // namespace OfferingTypeMapper
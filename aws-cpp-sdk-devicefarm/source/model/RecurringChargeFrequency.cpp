@@ -30,15 +30,30 @@ namespace Aws
       namespace RecurringChargeFrequencyMapper
       {
 
-        static const int MONTHLY_HASH = HashingUtils::HashString("MONTHLY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MONTHLY",
+        };
 
         RecurringChargeFrequency GetRecurringChargeFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MONTHLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RecurringChargeFrequency::MONTHLY;
+          case 1954618349:
+            if (name == "MONTHLY")
+            {
+              return RecurringChargeFrequency::MONTHLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return RecurringChargeFrequency::NOT_SET;
         }
 
-        Aws::String GetNameForRecurringChargeFrequency(RecurringChargeFrequency enumValue)
+        const char* GetNameForRecurringChargeFrequencyCStr(RecurringChargeFrequency enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RecurringChargeFrequency::MONTHLY:
-            return "MONTHLY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRecurringChargeFrequency(RecurringChargeFrequency enumValue)
+        {
+          return GetNameForRecurringChargeFrequencyCStr(enumValue);
         }
 
       } // namespace RecurringChargeFrequencyMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace RuleOperatorMapper
       {
 
-        static const int EQUALS_HASH = HashingUtils::HashString("EQUALS");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int NOT_IN_HASH = HashingUtils::HashString("NOT_IN");
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EQUALS",
+          "LESS_THAN",
+          "GREATER_THAN",
+          "IN",
+          "NOT_IN",
+          "CONTAINS",
+        };
 
         RuleOperator GetRuleOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQUALS_HASH)
-          {
-            return RuleOperator::EQUALS;
-          }
-          else if (hashCode == LESS_THAN_HASH)
-          {
-            return RuleOperator::LESS_THAN;
-          }
-          else if (hashCode == GREATER_THAN_HASH)
-          {
-            return RuleOperator::GREATER_THAN;
-          }
-          else if (hashCode == IN_HASH)
-          {
-            return RuleOperator::IN;
-          }
-          else if (hashCode == NOT_IN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RuleOperator::NOT_IN;
-          }
-          else if (hashCode == CONTAINS_HASH)
-          {
-            return RuleOperator::CONTAINS;
+          case 2052813759:
+            if (name == "EQUALS")
+            {
+              return RuleOperator::EQUALS;
+            }
+            break;
+          case -1112834937:
+            if (name == "LESS_THAN")
+            {
+              return RuleOperator::LESS_THAN;
+            }
+            break;
+          case 972152550:
+            if (name == "GREATER_THAN")
+            {
+              return RuleOperator::GREATER_THAN;
+            }
+            break;
+          case 2341:
+            if (name == "IN")
+            {
+              return RuleOperator::IN;
+            }
+            break;
+          case -1986339279:
+            if (name == "NOT_IN")
+            {
+              return RuleOperator::NOT_IN;
+            }
+            break;
+          case 215180831:
+            if (name == "CONTAINS")
+            {
+              return RuleOperator::CONTAINS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return RuleOperator::NOT_SET;
         }
 
-        Aws::String GetNameForRuleOperator(RuleOperator enumValue)
+        const char* GetNameForRuleOperatorCStr(RuleOperator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RuleOperator::EQUALS:
-            return "EQUALS";
-          case RuleOperator::LESS_THAN:
-            return "LESS_THAN";
-          case RuleOperator::GREATER_THAN:
-            return "GREATER_THAN";
-          case RuleOperator::IN:
-            return "IN";
-          case RuleOperator::NOT_IN:
-            return "NOT_IN";
-          case RuleOperator::CONTAINS:
-            return "CONTAINS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRuleOperator(RuleOperator enumValue)
+        {
+          return GetNameForRuleOperatorCStr(enumValue);
         }
 
       } // namespace RuleOperatorMapper
@@ -30,95 +30,142 @@ namespace Aws
       namespace SampleTypeMapper
       {
 
-        static const int CPU_HASH = HashingUtils::HashString("CPU");
-        static const int MEMORY_HASH = HashingUtils::HashString("MEMORY");
-        static const int THREADS_HASH = HashingUtils::HashString("THREADS");
-        static const int RX_RATE_HASH = HashingUtils::HashString("RX_RATE");
-        static const int TX_RATE_HASH = HashingUtils::HashString("TX_RATE");
-        static const int RX_HASH = HashingUtils::HashString("RX");
-        static const int TX_HASH = HashingUtils::HashString("TX");
-        static const int NATIVE_FRAMES_HASH = HashingUtils::HashString("NATIVE_FRAMES");
-        static const int NATIVE_FPS_HASH = HashingUtils::HashString("NATIVE_FPS");
-        static const int NATIVE_MIN_DRAWTIME_HASH = HashingUtils::HashString("NATIVE_MIN_DRAWTIME");
-        static const int NATIVE_AVG_DRAWTIME_HASH = HashingUtils::HashString("NATIVE_AVG_DRAWTIME");
-        static const int NATIVE_MAX_DRAWTIME_HASH = HashingUtils::HashString("NATIVE_MAX_DRAWTIME");
-        static const int OPENGL_FRAMES_HASH = HashingUtils::HashString("OPENGL_FRAMES");
-        static const int OPENGL_FPS_HASH = HashingUtils::HashString("OPENGL_FPS");
-        static const int OPENGL_MIN_DRAWTIME_HASH = HashingUtils::HashString("OPENGL_MIN_DRAWTIME");
-        static const int OPENGL_AVG_DRAWTIME_HASH = HashingUtils::HashString("OPENGL_AVG_DRAWTIME");
-        static const int OPENGL_MAX_DRAWTIME_HASH = HashingUtils::HashString("OPENGL_MAX_DRAWTIME");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CPU",
+          "MEMORY",
+          "THREADS",
+          "RX_RATE",
+          "TX_RATE",
+          "RX",
+          "TX",
+          "NATIVE_FRAMES",
+          "NATIVE_FPS",
+          "NATIVE_MIN_DRAWTIME",
+          "NATIVE_AVG_DRAWTIME",
+          "NATIVE_MAX_DRAWTIME",
+          "OPENGL_FRAMES",
+          "OPENGL_FPS",
+          "OPENGL_MIN_DRAWTIME",
+          "OPENGL_AVG_DRAWTIME",
+          "OPENGL_MAX_DRAWTIME",
+        };
 
         SampleType GetSampleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CPU_HASH)
-          {
-            return SampleType::CPU;
-          }
-          else if (hashCode == MEMORY_HASH)
-          {
-            return SampleType::MEMORY;
-          }
-          else if (hashCode == THREADS_HASH)
-          {
-            return SampleType::THREADS;
-          }
-          else if (hashCode == RX_RATE_HASH)
-          {
-            return SampleType::RX_RATE;
-          }
-          else if (hashCode == TX_RATE_HASH)
-          {
-            return SampleType::TX_RATE;
-          }
-          else if (hashCode == RX_HASH)
-          {
-            return SampleType::RX;
-          }
-          else if (hashCode == TX_HASH)
-          {
-            return SampleType::TX;
-          }
-          else if (hashCode == NATIVE_FRAMES_HASH)
-          {
-            return SampleType::NATIVE_FRAMES;
-          }
-          else if (hashCode == NATIVE_FPS_HASH)
-          {
-            return SampleType::NATIVE_FPS;
-          }
-          else if (hashCode == NATIVE_MIN_DRAWTIME_HASH)
-          {
-            return SampleType::NATIVE_MIN_DRAWTIME;
-          }
-          else if (hashCode == NATIVE_AVG_DRAWTIME_HASH)
-          {
-            return SampleType::NATIVE_AVG_DRAWTIME;
-          }
-          else if (hashCode == NATIVE_MAX_DRAWTIME_HASH)
-          {
-            return SampleType::NATIVE_MAX_DRAWTIME;
-          }
-          else if (hashCode == OPENGL_FRAMES_HASH)
-          {
-            return SampleType::OPENGL_FRAMES;
-          }
-          else if (hashCode == OPENGL_FPS_HASH)
-          {
-            return SampleType::OPENGL_FPS;
-          }
-          else if (hashCode == OPENGL_MIN_DRAWTIME_HASH)
-          {
-            return SampleType::OPENGL_MIN_DRAWTIME;
-          }
-          else if (hashCode == OPENGL_AVG_DRAWTIME_HASH)
-          {
-            return SampleType::OPENGL_AVG_DRAWTIME;
-          }
-          else if (hashCode == OPENGL_MAX_DRAWTIME_HASH)
-          {
-            return SampleType::OPENGL_MAX_DRAWTIME;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 66952:
+            if (name == "CPU")
+            {
+              return SampleType::CPU;
+            }
+            break;
+          case -2024427263:
+            if (name == "MEMORY")
+            {
+              return SampleType::MEMORY;
+            }
+            break;
+          case -619954295:
+            if (name == "THREADS")
+            {
+              return SampleType::THREADS;
+            }
+            break;
+          case -1924501703:
+            if (name == "RX_RATE")
+            {
+              return SampleType::RX_RATE;
+            }
+            break;
+          case -149494341:
+            if (name == "TX_RATE")
+            {
+              return SampleType::TX_RATE;
+            }
+            break;
+          case 2630:
+            if (name == "RX")
+            {
+              return SampleType::RX;
+            }
+            break;
+          case 2692:
+            if (name == "TX")
+            {
+              return SampleType::TX;
+            }
+            break;
+          case 272021966:
+            if (name == "NATIVE_FRAMES")
+            {
+              return SampleType::NATIVE_FRAMES;
+            }
+            break;
+          case -704405343:
+            if (name == "NATIVE_FPS")
+            {
+              return SampleType::NATIVE_FPS;
+            }
+            break;
+          case 658264230:
+            if (name == "NATIVE_MIN_DRAWTIME")
+            {
+              return SampleType::NATIVE_MIN_DRAWTIME;
+            }
+            break;
+          case -1400665050:
+            if (name == "NATIVE_AVG_DRAWTIME")
+            {
+              return SampleType::NATIVE_AVG_DRAWTIME;
+            }
+            break;
+          case 183838164:
+            if (name == "NATIVE_MAX_DRAWTIME")
+            {
+              return SampleType::NATIVE_MAX_DRAWTIME;
+            }
+            break;
+          case -1521424842:
+            if (name == "OPENGL_FRAMES")
+            {
+              return SampleType::OPENGL_FRAMES;
+            }
+            break;
+          case 1399262521:
+            if (name == "OPENGL_FPS")
+            {
+              return SampleType::OPENGL_FPS;
+            }
+            break;
+          case 277712654:
+            if (name == "OPENGL_MIN_DRAWTIME")
+            {
+              return SampleType::OPENGL_MIN_DRAWTIME;
+            }
+            break;
+          case -1781216626:
+            if (name == "OPENGL_AVG_DRAWTIME")
+            {
+              return SampleType::OPENGL_AVG_DRAWTIME;
+            }
+            break;
+          case -196713412:
+            if (name == "OPENGL_MAX_DRAWTIME")
+            {
+              return SampleType::OPENGL_MAX_DRAWTIME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,53 +177,26 @@ namespace Aws
           return SampleType::NOT_SET;
         }
 
-        Aws::String GetNameForSampleType(SampleType enumValue)
+        const char* GetNameForSampleTypeCStr(SampleType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SampleType::CPU:
-            return "CPU";
-          case SampleType::MEMORY:
-            return "MEMORY";
-          case SampleType::THREADS:
-            return "THREADS";
-          case SampleType::RX_RATE:
-            return "RX_RATE";
-          case SampleType::TX_RATE:
-            return "TX_RATE";
-          case SampleType::RX:
-            return "RX";
-          case SampleType::TX:
-            return "TX";
-          case SampleType::NATIVE_FRAMES:
-            return "NATIVE_FRAMES";
-          case SampleType::NATIVE_FPS:
-            return "NATIVE_FPS";
-          case SampleType::NATIVE_MIN_DRAWTIME:
-            return "NATIVE_MIN_DRAWTIME";
-          case SampleType::NATIVE_AVG_DRAWTIME:
-            return "NATIVE_AVG_DRAWTIME";
-          case SampleType::NATIVE_MAX_DRAWTIME:
-            return "NATIVE_MAX_DRAWTIME";
-          case SampleType::OPENGL_FRAMES:
-            return "OPENGL_FRAMES";
-          case SampleType::OPENGL_FPS:
-            return "OPENGL_FPS";
-          case SampleType::OPENGL_MIN_DRAWTIME:
-            return "OPENGL_MIN_DRAWTIME";
-          case SampleType::OPENGL_AVG_DRAWTIME:
-            return "OPENGL_AVG_DRAWTIME";
-          case SampleType::OPENGL_MAX_DRAWTIME:
-            return "OPENGL_MAX_DRAWTIME";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSampleType(SampleType enumValue)
+        {
+          return GetNameForSampleTypeCStr(enumValue);
         }
 
       } // namespace SampleTypeMapper
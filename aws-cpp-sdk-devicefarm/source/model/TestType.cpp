@@ -30,95 +30,142 @@ namespace Aws
       namespace TestTypeMapper
       {
 
-        static const int BUILTIN_FUZZ_HASH = HashingUtils::HashString("BUILTIN_FUZZ");
-        static const int BUILTIN_EXPLORER_HASH = HashingUtils::HashString("BUILTIN_EXPLORER");
-        static const int WEB_PERFORMANCE_PROFILE_HASH = HashingUtils::HashString("WEB_PERFORMANCE_PROFILE");
-        static const int APPIUM_JAVA_JUNIT_HASH = HashingUtils::HashString("APPIUM_JAVA_JUNIT");
-        static const int APPIUM_JAVA_TESTNG_HASH = HashingUtils::HashString("APPIUM_JAVA_TESTNG");
-        static const int APPIUM_PYTHON_HASH = HashingUtils::HashString("APPIUM_PYTHON");
-        static const int APPIUM_WEB_JAVA_JUNIT_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_JUNIT");
-        static const int APPIUM_WEB_JAVA_TESTNG_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_TESTNG");
-        static const int APPIUM_WEB_PYTHON_HASH = HashingUtils::HashString("APPIUM_WEB_PYTHON");
-        static const int CALABASH_HASH = HashingUtils::HashString("CALABASH");
-        static const int INSTRUMENTATION_HASH = HashingUtils::HashString("INSTRUMENTATION");
-        static const int UIAUTOMATION_HASH = HashingUtils::HashString("UIAUTOMATION");
-        static const int UIAUTOMATOR_HASH = HashingUtils::HashString("UIAUTOMATOR");
-        static const int XCTEST_HASH = HashingUtils::HashString("XCTEST");
-        static const int XCTEST_UI_HASH = HashingUtils::HashString("XCTEST_UI");
-        static const int REMOTE_ACCESS_RECORD_HASH = HashingUtils::HashString("REMOTE_ACCESS_RECORD");
-        static const int REMOTE_ACCESS_REPLAY_HASH = HashingUtils::HashString("REMOTE_ACCESS_REPLAY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BUILTIN_FUZZ",
+          "BUILTIN_EXPLORER",
+          "WEB_PERFORMANCE_PROFILE",
+          "APPIUM_JAVA_JUNIT",
+          "APPIUM_JAVA_TESTNG",
+          "APPIUM_PYTHON",
+          "APPIUM_WEB_JAVA_JUNIT",
+          "APPIUM_WEB_JAVA_TESTNG",
+          "APPIUM_WEB_PYTHON",
+          "CALABASH",
+          "INSTRUMENTATION",
+          "UIAUTOMATION",
+          "UIAUTOMATOR",
+          "XCTEST",
+          "XCTEST_UI",
+          "REMOTE_ACCESS_RECORD",
+          "REMOTE_ACCESS_REPLAY",
+        };
 
         TestType GetTestTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BUILTIN_FUZZ_HASH)
-          {
-            return TestType::BUILTIN_FUZZ;
-          }
-          else if (hashCode == BUILTIN_EXPLORER_HASH)
-          {
-            return TestType::BUILTIN_EXPLORER;
-          }
-          else if (hashCode == WEB_PERFORMANCE_PROFILE_HASH)
-          {
-            return TestType::WEB_PERFORMANCE_PROFILE;
-          }
-          else if (hashCode == APPIUM_JAVA_JUNIT_HASH)
-          {
-            return TestType::APPIUM_JAVA_JUNIT;
-          }
-          else if (hashCode == APPIUM_JAVA_TESTNG_HASH)
-          {
-            return TestType::APPIUM_JAVA_TESTNG;
-          }
-          else if (hashCode == APPIUM_PYTHON_HASH)
-          {
-            return TestType::APPIUM_PYTHON;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_JUNIT_HASH)
-          {
-            return TestType::APPIUM_WEB_JAVA_JUNIT;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_TESTNG_HASH)
-          {
-            return TestType::APPIUM_WEB_JAVA_TESTNG;
-          }
-          else if (hashCode == APPIUM_WEB_PYTHON_HASH)
-          {
-            return TestType::APPIUM_WEB_PYTHON;
-          }
-          else if (hashCode == CALABASH_HASH)
-          {
-            return TestType::CALABASH;
-          }
-          else if (hashCode == INSTRUMENTATION_HASH)
-          {
-            return TestType::INSTRUMENTATION;
-          }
-          else if (hashCode == UIAUTOMATION_HASH)
-          {
-            return TestType::UIAUTOMATION;
-          }
-          else if (hashCode == UIAUTOMATOR_HASH)
-          {
-            return TestType::UIAUTOMATOR;
-          }
-          else if (hashCode == XCTEST_HASH)
-          {
-            return TestType::XCTEST;
-          }
-          else if (hashCode == XCTEST_UI_HASH)
-          {
-            return TestType::XCTEST_UI;
-          }
-          else if (hashCode == REMOTE_ACCESS_RECORD_HASH)
-          {
-            return TestType::REMOTE_ACCESS_RECORD;
-          }
-          else if (hashCode == REMOTE_ACCESS_REPLAY_HASH)
-          {
-            return TestType::REMOTE_ACCESS_REPLAY;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -822237429:
+            if (name == "BUILTIN_FUZZ")
+            {
+              return TestType::BUILTIN_FUZZ;
+            }
+            break;
+          case 1603147003:
+            if (name == "BUILTIN_EXPLORER")
+            {
+              return TestType::BUILTIN_EXPLORER;
+            }
+            break;
+          case 533170895:
+            if (name == "WEB_PERFORMANCE_PROFILE")
+            {
+              return TestType::WEB_PERFORMANCE_PROFILE;
+            }
+            break;
+          case 1969267472:
+            if (name == "APPIUM_JAVA_JUNIT")
+            {
+              return TestType::APPIUM_JAVA_JUNIT;
+            }
+            break;
+          case 1189424073:
+            if (name == "APPIUM_JAVA_TESTNG")
+            {
+              return TestType::APPIUM_JAVA_TESTNG;
+            }
+            break;
+          case -811208965:
+            if (name == "APPIUM_PYTHON")
+            {
+              return TestType::APPIUM_PYTHON;
+            }
+            break;
+          case 1734048123:
+            if (name == "APPIUM_WEB_JAVA_JUNIT")
+            {
+              return TestType::APPIUM_WEB_JAVA_JUNIT;
+            }
+            break;
+          case -1807408450:
+            if (name == "APPIUM_WEB_JAVA_TESTNG")
+            {
+              return TestType::APPIUM_WEB_JAVA_TESTNG;
+            }
+            break;
+          case 717927142:
+            if (name == "APPIUM_WEB_PYTHON")
+            {
+              return TestType::APPIUM_WEB_PYTHON;
+            }
+            break;
+          case 600248231:
+            if (name == "CALABASH")
+            {
+              return TestType::CALABASH;
+            }
+            break;
+          case 1661782862:
+            if (name == "INSTRUMENTATION")
+            {
+              return TestType::INSTRUMENTATION;
+            }
+            break;
+          case 882959019:
+            if (name == "UIAUTOMATION")
+            {
+              return TestType::UIAUTOMATION;
+            }
+            break;
+          case 582672064:
+            if (name == "UIAUTOMATOR")
+            {
+              return TestType::UIAUTOMATOR;
+            }
+            break;
+          case -1711154691:
+            if (name == "XCTEST")
+            {
+              return TestType::XCTEST;
+            }
+            break;
+          case -42469354:
+            if (name == "XCTEST_UI")
+            {
+              return TestType::XCTEST_UI;
+            }
+            break;
+          case 104982355:
+            if (name == "REMOTE_ACCESS_RECORD")
+            {
+              return TestType::REMOTE_ACCESS_RECORD;
+            }
+            break;
+          case 105366249:
+            if (name == "REMOTE_ACCESS_REPLAY")
+            {
+              return TestType::REMOTE_ACCESS_REPLAY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,53 +177,26 @@ namespace Aws
           return TestType::NOT_SET;
         }
 
-        Aws::String GetNameForTestType(TestType enumValue)
+        const char* GetNameForTestTypeCStr(TestType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TestType::BUILTIN_FUZZ:
-            return "BUILTIN_FUZZ";
-          case TestType::BUILTIN_EXPLORER:
-            return "BUILTIN_EXPLORER";
-          case TestType::WEB_PERFORMANCE_PROFILE:
-            return "WEB_PERFORMANCE_PROFILE";
-          case TestType::APPIUM_JAVA_JUNIT:
-            return "APPIUM_JAVA_JUNIT";
-          case TestType::APPIUM_JAVA_TESTNG:
-            return "APPIUM_JAVA_TESTNG";
-          case TestType::APPIUM_PYTHON:
-            return "APPIUM_PYTHON";
-          case TestType::APPIUM_WEB_JAVA_JUNIT:
-            return "APPIUM_WEB_JAVA_JUNIT";
-          case TestType::APPIUM_WEB_JAVA_TESTNG:
-            return "APPIUM_WEB_JAVA_TESTNG";
-          case TestType::APPIUM_WEB_PYTHON:
-            return "APPIUM_WEB_PYTHON";
-          case TestType::CALABASH:
-            return "CALABASH";
-          case TestType::INSTRUMENTATION:
-            return "INSTRUMENTATION";
-          case TestType::UIAUTOMATION:
-            return "UIAUTOMATION";
-          case TestType::UIAUTOMATOR:
-            return "UIAUTOMATOR";
-          case TestType::XCTEST:
-            return "XCTEST";
-          case TestType::XCTEST_UI:
-            return "XCTEST_UI";
-          case TestType::REMOTE_ACCESS_RECORD:
-            return "REMOTE_ACCESS_RECORD";
-          case TestType::REMOTE_ACCESS_REPLAY:
-            return "REMOTE_ACCESS_REPLAY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTestType(TestType enumValue)
+        {
+          return GetNameForTestTypeCStr(enumValue);
         }
 
       } // namespace TestTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace UploadCategoryMapper
       {
 
-        static const int CURATED_HASH = HashingUtils::HashString("CURATED");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CURATED",
+          "PRIVATE",
+        };
 
         UploadCategory GetUploadCategoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CURATED_HASH)
-          {
-            return UploadCategory::CURATED;
-          }
-          else if (hashCode == PRIVATE__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UploadCategory::PRIVATE_;
+          case 1844430386:
+            if (name == "CURATED")
+            {
+              return UploadCategory::CURATED;
+            }
+            break;
+          case 403485027:
+            if (name == "PRIVATE")
+            {
+              return UploadCategory::PRIVATE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return UploadCategory::NOT_SET;
         }
 
-        Aws::String GetNameForUploadCategory(UploadCategory enumValue)
+        const char* GetNameForUploadCategoryCStr(UploadCategory enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UploadCategory::CURATED:
-            return "CURATED";
-          case UploadCategory::PRIVATE_:
-            return "PRIVATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUploadCategory(UploadCategory enumValue)
+        {
+          return GetNameForUploadCategoryCStr(enumValue);
         }
 
       } // namespace UploadCategoryMapper
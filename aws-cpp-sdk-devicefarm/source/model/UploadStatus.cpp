@@ -30,30 +30,51 @@ namespace Aws
       namespace UploadStatusMapper
       {
 
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int PROCESSING_HASH = HashingUtils::HashString("PROCESSING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INITIALIZED",
+          "PROCESSING",
+          "SUCCEEDED",
+          "FAILED",
+        };
 
         UploadStatus GetUploadStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZED_HASH)
-          {
-            return UploadStatus::INITIALIZED;
-          }
-          else if (hashCode == PROCESSING_HASH)
-          {
-            return UploadStatus::PROCESSING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return UploadStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UploadStatus::FAILED;
+          case -907986252:
+            if (name == "INITIALIZED")
+            {
+              return UploadStatus::INITIALIZED;
+            }
+            break;
+          case 907287315:
+            if (name == "PROCESSING")
+            {
+              return UploadStatus::PROCESSING;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return UploadStatus::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return UploadStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return UploadStatus::NOT_SET;
         }
 
-        Aws::String GetNameForUploadStatus(UploadStatus enumValue)
+        const char* GetNameForUploadStatusCStr(UploadStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UploadStatus::INITIALIZED:
-            return "INITIALIZED";
-          case UploadStatus::PROCESSING:
-            return "PROCESSING";
-          case UploadStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case UploadStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUploadStatus(UploadStatus enumValue)
+        {
+          return GetNameForUploadStatusCStr(enumValue);
         }
 
       } // namespace UploadStatusMapper
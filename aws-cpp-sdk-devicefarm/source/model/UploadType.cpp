@@ -30,130 +30,191 @@ namespace Aws
       namespace UploadTypeMapper
       {
 
-        static const int ANDROID_APP_HASH = HashingUtils::HashString("ANDROID_APP");
-        static const int IOS_APP_HASH = HashingUtils::HashString("IOS_APP");
-        static const int WEB_APP_HASH = HashingUtils::HashString("WEB_APP");
-        static const int EXTERNAL_DATA_HASH = HashingUtils::HashString("EXTERNAL_DATA");
-        static const int APPIUM_JAVA_JUNIT_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_JAVA_JUNIT_TEST_PACKAGE");
-        static const int APPIUM_JAVA_TESTNG_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_JAVA_TESTNG_TEST_PACKAGE");
-        static const int APPIUM_PYTHON_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_PYTHON_TEST_PACKAGE");
-        static const int APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE");
-        static const int APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE");
-        static const int APPIUM_WEB_PYTHON_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_WEB_PYTHON_TEST_PACKAGE");
-        static const int CALABASH_TEST_PACKAGE_HASH = HashingUtils::HashString("CALABASH_TEST_PACKAGE");
-        static const int INSTRUMENTATION_TEST_PACKAGE_HASH = HashingUtils::HashString("INSTRUMENTATION_TEST_PACKAGE");
-        static const int UIAUTOMATION_TEST_PACKAGE_HASH = HashingUtils::HashString("UIAUTOMATION_TEST_PACKAGE");
-        static const int UIAUTOMATOR_TEST_PACKAGE_HASH = HashingUtils::HashString("UIAUTOMATOR_TEST_PACKAGE");
-        static const int XCTEST_TEST_PACKAGE_HASH = HashingUtils::HashString("XCTEST_TEST_PACKAGE");
-        static const int XCTEST_UI_TEST_PACKAGE_HASH = HashingUtils::HashString("XCTEST_UI_TEST_PACKAGE");
-        static const int APPIUM_JAVA_JUNIT_TEST_SPEC_HASH = HashingUtils::HashString("APPIUM_JAVA_JUNIT_TEST_SPEC");
-        static const int APPIUM_JAVA_TESTNG_TEST_SPEC_HASH = HashingUtils::HashString("APPIUM_JAVA_TESTNG_TEST_SPEC");
-        static const int APPIUM_PYTHON_TEST_SPEC_HASH = HashingUtils::HashString("APPIUM_PYTHON_TEST_SPEC");
-        static const int APPIUM_WEB_JAVA_JUNIT_TEST_SPEC_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_JUNIT_TEST_SPEC");
-        static const int APPIUM_WEB_JAVA_TESTNG_TEST_SPEC_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_TESTNG_TEST_SPEC");
-        static const int APPIUM_WEB_PYTHON_TEST_SPEC_HASH = HashingUtils::HashString("APPIUM_WEB_PYTHON_TEST_SPEC");
-        static const int INSTRUMENTATION_TEST_SPEC_HASH = HashingUtils::HashString("INSTRUMENTATION_TEST_SPEC");
-        static const int XCTEST_UI_TEST_SPEC_HASH = HashingUtils::HashString("XCTEST_UI_TEST_SPEC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ANDROID_APP",
+          "IOS_APP",
+          "WEB_APP",
+          "EXTERNAL_DATA",
+          "APPIUM_JAVA_JUNIT_TEST_PACKAGE",
+          "APPIUM_JAVA_TESTNG_TEST_PACKAGE",
+          "APPIUM_PYTHON_TEST_PACKAGE",
+          "APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE",
+          "APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE",
+          "APPIUM_WEB_PYTHON_TEST_PACKAGE",
+          "CALABASH_TEST_PACKAGE",
+          "INSTRUMENTATION_TEST_PACKAGE",
+          "UIAUTOMATION_TEST_PACKAGE",
+          "UIAUTOMATOR_TEST_PACKAGE",
+          "XCTEST_TEST_PACKAGE",
+          "XCTEST_UI_TEST_PACKAGE",
+          "APPIUM_JAVA_JUNIT_TEST_SPEC",
+          "APPIUM_JAVA_TESTNG_TEST_SPEC",
+          "APPIUM_PYTHON_TEST_SPEC",
+          "APPIUM_WEB_JAVA_JUNIT_TEST_SPEC",
+          "APPIUM_WEB_JAVA_TESTNG_TEST_SPEC",
+          "APPIUM_WEB_PYTHON_TEST_SPEC",
+          "INSTRUMENTATION_TEST_SPEC",
+          "XCTEST_UI_TEST_SPEC",
+        };
 
         UploadType GetUploadTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ANDROID_APP_HASH)
-          {
-            return UploadType::ANDROID_APP;
-          }
-          else if (hashCode == IOS_APP_HASH)
-          {
-            return UploadType::IOS_APP;
-          }
-          else if (hashCode == WEB_APP_HASH)
-          {
-            return UploadType::WEB_APP;
-          }
-          else if (hashCode == EXTERNAL_DATA_HASH)
-          {
-            return UploadType::EXTERNAL_DATA;
-          }
-          else if (hashCode == APPIUM_JAVA_JUNIT_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_JAVA_JUNIT_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_JAVA_TESTNG_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_JAVA_TESTNG_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_PYTHON_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_PYTHON_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_WEB_PYTHON_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_WEB_PYTHON_TEST_PACKAGE;
-          }
-          else if (hashCode == CALABASH_TEST_PACKAGE_HASH)
-          {
-            return UploadType::CALABASH_TEST_PACKAGE;
-          }
-          else if (hashCode == INSTRUMENTATION_TEST_PACKAGE_HASH)
-          {
-            return UploadType::INSTRUMENTATION_TEST_PACKAGE;
-          }
-          else if (hashCode == UIAUTOMATION_TEST_PACKAGE_HASH)
-          {
-            return UploadType::UIAUTOMATION_TEST_PACKAGE;
-          }
-          else if (hashCode == UIAUTOMATOR_TEST_PACKAGE_HASH)
-          {
-            return UploadType::UIAUTOMATOR_TEST_PACKAGE;
-          }
-          else if (hashCode == XCTEST_TEST_PACKAGE_HASH)
-          {
-            return UploadType::XCTEST_TEST_PACKAGE;
-          }
-          else if (hashCode == XCTEST_UI_TEST_PACKAGE_HASH)
-          {
-            return UploadType::XCTEST_UI_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_JAVA_JUNIT_TEST_SPEC_HASH)
-          {
-            return UploadType::APPIUM_JAVA_JUNIT_TEST_SPEC;
-          }
-          else if (hashCode == APPIUM_JAVA_TESTNG_TEST_SPEC_HASH)
-          {
-            return UploadType::APPIUM_JAVA_TESTNG_TEST_SPEC;
-          }
-          else if (hashCode == APPIUM_PYTHON_TEST_SPEC_HASH)
-          {
-            return UploadType::APPIUM_PYTHON_TEST_SPEC;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_JUNIT_TEST_SPEC_HASH)
-          {
-            return UploadType::APPIUM_WEB_JAVA_JUNIT_TEST_SPEC;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_TESTNG_TEST_SPEC_HASH)
-          {
-            return UploadType::APPIUM_WEB_JAVA_TESTNG_TEST_SPEC;
-          }
-          else if (hashCode == APPIUM_WEB_PYTHON_TEST_SPEC_HASH)
-          {
-            return UploadType::APPIUM_WEB_PYTHON_TEST_SPEC;
-          }
-          else if (hashCode == INSTRUMENTATION_TEST_SPEC_HASH)
-          {
-            return UploadType::INSTRUMENTATION_TEST_SPEC;
-          }
-          else if (hashCode == XCTEST_UI_TEST_SPEC_HASH)
-          {
-            return UploadType::XCTEST_UI_TEST_SPEC;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1203228655:
+            if (name == "ANDROID_APP")
+            {
+              return UploadType::ANDROID_APP;
+            }
+            break;
+          case -1590457681:
+            if (name == "IOS_APP")
+            {
+              return UploadType::IOS_APP;
+            }
+            break;
+          case 1942667894:
+            if (name == "WEB_APP")
+            {
+              return UploadType::WEB_APP;
+            }
+            break;
+          case -1153502306:
+            if (name == "EXTERNAL_DATA")
+            {
+              return UploadType::EXTERNAL_DATA;
+            }
+            break;
+          case 669987400:
+            if (name == "APPIUM_JAVA_JUNIT_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_JAVA_JUNIT_TEST_PACKAGE;
+            }
+            break;
+          case -112304593:
+            if (name == "APPIUM_JAVA_TESTNG_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_JAVA_TESTNG_TEST_PACKAGE;
+            }
+            break;
+          case -1233920963:
+            if (name == "APPIUM_PYTHON_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_PYTHON_TEST_PACKAGE;
+            }
+            break;
+          case -1972149827:
+            if (name == "APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE;
+            }
+            break;
+          case -414180006:
+            if (name == "APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE;
+            }
+            break;
+          case -587461070:
+            if (name == "APPIUM_WEB_PYTHON_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_WEB_PYTHON_TEST_PACKAGE;
+            }
+            break;
+          case 1512715025:
+            if (name == "CALABASH_TEST_PACKAGE")
+            {
+              return UploadType::CALABASH_TEST_PACKAGE;
+            }
+            break;
+          case 754638538:
+            if (name == "INSTRUMENTATION_TEST_PACKAGE")
+            {
+              return UploadType::INSTRUMENTATION_TEST_PACKAGE;
+            }
+            break;
+          case -2036963699:
+            if (name == "UIAUTOMATION_TEST_PACKAGE")
+            {
+              return UploadType::UIAUTOMATION_TEST_PACKAGE;
+            }
+            break;
+          case -490244968:
+            if (name == "UIAUTOMATOR_TEST_PACKAGE")
+            {
+              return UploadType::UIAUTOMATOR_TEST_PACKAGE;
+            }
+            break;
+          case 868836475:
+            if (name == "XCTEST_TEST_PACKAGE")
+            {
+              return UploadType::XCTEST_TEST_PACKAGE;
+            }
+            break;
+          case -1403209982:
+            if (name == "XCTEST_UI_TEST_PACKAGE")
+            {
+              return UploadType::XCTEST_UI_TEST_PACKAGE;
+            }
+            break;
+          case 843088089:
+            if (name == "APPIUM_JAVA_JUNIT_TEST_SPEC")
+            {
+              return UploadType::APPIUM_JAVA_JUNIT_TEST_SPEC;
+            }
+            break;
+          case 117454418:
+            if (name == "APPIUM_JAVA_TESTNG_TEST_SPEC")
+            {
+              return UploadType::APPIUM_JAVA_TESTNG_TEST_SPEC;
+            }
+            break;
+          case -392944892:
+            if (name == "APPIUM_PYTHON_TEST_SPEC")
+            {
+              return UploadType::APPIUM_PYTHON_TEST_SPEC;
+            }
+            break;
+          case -591491708:
+            if (name == "APPIUM_WEB_JAVA_JUNIT_TEST_SPEC")
+            {
+              return UploadType::APPIUM_WEB_JAVA_JUNIT_TEST_SPEC;
+            }
+            break;
+          case -1404846329:
+            if (name == "APPIUM_WEB_JAVA_TESTNG_TEST_SPEC")
+            {
+              return UploadType::APPIUM_WEB_JAVA_TESTNG_TEST_SPEC;
+            }
+            break;
+          case -1999553233:
+            if (name == "APPIUM_WEB_PYTHON_TEST_SPEC")
+            {
+              return UploadType::APPIUM_WEB_PYTHON_TEST_SPEC;
+            }
+            break;
+          case -1002572905:
+            if (name == "INSTRUMENTATION_TEST_SPEC")
+            {
+              return UploadType::INSTRUMENTATION_TEST_SPEC;
+            }
+            break;
+          case 911066719:
+            if (name == "XCTEST_UI_TEST_SPEC")
+            {
+              return UploadType::XCTEST_UI_TEST_SPEC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -165,67 +226,26 @@ namespace Aws
           return UploadType::NOT_SET;
         }
 
-        Aws::String GetNameForUploadType(UploadType enumValue)
+        const char* GetNameForUploadTypeCStr(UploadType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UploadType::ANDROID_APP:
-            return "ANDROID_APP";
-          case UploadType::IOS_APP:
-            return "IOS_APP";
-          case UploadType::WEB_APP:
-            return "WEB_APP";
-          case UploadType::EXTERNAL_DATA:
-            return "EXTERNAL_DATA";
-          case UploadType::APPIUM_JAVA_JUNIT_TEST_PACKAGE:
-            return "APPIUM_JAVA_JUNIT_TEST_PACKAGE";
-          case UploadType::APPIUM_JAVA_TESTNG_TEST_PACKAGE:
-            return "APPIUM_JAVA_TESTNG_TEST_PACKAGE";
-          case UploadType::APPIUM_PYTHON_TEST_PACKAGE:
-            return "APPIUM_PYTHON_TEST_PACKAGE";
-          case UploadType::APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE:
-            return "APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE";
-          case UploadType::APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE:
-            return "APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE";
-          case UploadType::APPIUM_WEB_PYTHON_TEST_PACKAGE:
-            return "APPIUM_WEB_PYTHON_TEST_PACKAGE";
-          case UploadType::CALABASH_TEST_PACKAGE:
-            return "CALABASH_TEST_PACKAGE";
-          case UploadType::INSTRUMENTATION_TEST_PACKAGE:
-            return "INSTRUMENTATION_TEST_PACKAGE";
-          case UploadType::UIAUTOMATION_TEST_PACKAGE:
-            return "UIAUTOMATION_TEST_PACKAGE";
-          case UploadType::UIAUTOMATOR_TEST_PACKAGE:
-            return "UIAUTOMATOR_TEST_PACKAGE";
-          case UploadType::XCTEST_TEST_PACKAGE:
-            return "XCTEST_TEST_PACKAGE";
-          case UploadType::XCTEST_UI_TEST_PACKAGE:
-            return "XCTEST_UI_TEST_PACKAGE";
-          case UploadType::APPIUM_JAVA_JUNIT_TEST_SPEC:
-            return "APPIUM_JAVA_JUNIT_TEST_SPEC";
-          case UploadType::APPIUM_JAVA_TESTNG_TEST_SPEC:
-            return "APPIUM_JAVA_TESTNG_TEST_SPEC";
-          case UploadType::APPIUM_PYTHON_TEST_SPEC:
-            return "APPIUM_PYTHON_TEST_SPEC";
-          case UploadType::APPIUM_WEB_JAVA_JUNIT_TEST_SPEC:
-            return "APPIUM_WEB_JAVA_JUNIT_TEST_SPEC";
-          case UploadType::APPIUM_WEB_JAVA_TESTNG_TEST_SPEC:
-            return "APPIUM_WEB_JAVA_TESTNG_TEST_SPEC";
-          case UploadType::APPIUM_WEB_PYTHON_TEST_SPEC:
-            return "APPIUM_WEB_PYTHON_TEST_SPEC";
-          case UploadType::INSTRUMENTATION_TEST_SPEC:
-            return "INSTRUMENTATION_TEST_SPEC";
-          case UploadType::XCTEST_UI_TEST_SPEC:
-            return "XCTEST_UI_TEST_SPEC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUploadType(UploadType enumValue)
+        {
+          return GetNameForUploadTypeCStr(enumValue);
         }
 
       } // namespace UploadTypeMapper
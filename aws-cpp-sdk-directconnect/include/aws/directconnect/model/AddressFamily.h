@@ -35,6 +35,11 @@ namespace AddressFamilyMapper
 AWS_DIRECTCONNECT_API AddressFamily GetAddressFamilyForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForAddressFamily(AddressFamily value);
+
+/**
+ * Same as GetNameForAddressFamily(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForAddressFamilyCStr(AddressFamily value);
 } // namespace AddressFamilyMapper
 } // namespace Model
 } // namespace DirectConnect
@@ -38,6 +38,11 @@ namespace BGPPeerStateMapper
 AWS_DIRECTCONNECT_API BGPPeerState GetBGPPeerStateForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForBGPPeerState(BGPPeerState value);
+
+/**
+ * Same as GetNameForBGPPeerState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForBGPPeerStateCStr(BGPPeerState value);
 } // namespace BGPPeerStateMapper
 } // namespace Model
 } // namespace DirectConnect
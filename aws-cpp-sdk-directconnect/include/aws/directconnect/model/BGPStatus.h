@@ -35,6 +35,11 @@ namespace BGPStatusMapper
 AWS_DIRECTCONNECT_API BGPStatus GetBGPStatusForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForBGPStatus(BGPStatus value);
+
+/**
+ * Same as GetNameForBGPStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForBGPStatusCStr(BGPStatus value);
 } // namespace BGPStatusMapper
 } // namespace Model
 } // namespace DirectConnect
@@ -41,6 +41,11 @@ namespace ConnectionStateMapper
 AWS_DIRECTCONNECT_API ConnectionState GetConnectionStateForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForConnectionState(ConnectionState value);
+
+/**
+ * Same as GetNameForConnectionState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForConnectionStateCStr(ConnectionState value);
 } // namespace ConnectionStateMapper
 } // namespace Model
 } // namespace DirectConnect
@@ -37,6 +37,11 @@ namespace DirectConnectGatewayAssociationStateMapper
 AWS_DIRECTCONNECT_API DirectConnectGatewayAssociationState GetDirectConnectGatewayAssociationStateForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForDirectConnectGatewayAssociationState(DirectConnectGatewayAssociationState value);
+
+/**
+ * Same as GetNameForDirectConnectGatewayAssociationState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForDirectConnectGatewayAssociationStateCStr(DirectConnectGatewayAssociationState value);
 } // namespace DirectConnectGatewayAssociationStateMapper
 } // namespace Model
 } // namespace DirectConnect
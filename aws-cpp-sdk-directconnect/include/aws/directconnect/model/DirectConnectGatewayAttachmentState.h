@@ -37,6 +37,11 @@ namespace DirectConnectGatewayAttachmentStateMapper
 AWS_DIRECTCONNECT_API DirectConnectGatewayAttachmentState GetDirectConnectGatewayAttachmentStateForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForDirectConnectGatewayAttachmentState(DirectConnectGatewayAttachmentState value);
+
+/**
+ * Same as GetNameForDirectConnectGatewayAttachmentState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForDirectConnectGatewayAttachmentStateCStr(DirectConnectGatewayAttachmentState value);
 } // namespace DirectConnectGatewayAttachmentStateMapper
 } // namespace Model
 } // namespace DirectConnect
@@ -37,6 +37,11 @@ namespace DirectConnectGatewayStateMapper
 AWS_DIRECTCONNECT_API DirectConnectGatewayState GetDirectConnectGatewayStateForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForDirectConnectGatewayState(DirectConnectGatewayState value);
+
+/**
+ * Same as GetNameForDirectConnectGatewayState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForDirectConnectGatewayStateCStr(DirectConnectGatewayState value);
 } // namespace DirectConnectGatewayStateMapper
 } // namespace Model
 } // namespace DirectConnect
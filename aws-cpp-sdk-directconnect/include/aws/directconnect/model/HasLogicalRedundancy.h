@@ -36,6 +36,11 @@ namespace HasLogicalRedundancyMapper
 AWS_DIRECTCONNECT_API HasLogicalRedundancy GetHasLogicalRedundancyForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForHasLogicalRedundancy(HasLogicalRedundancy value);
+
+/**
+ * Same as GetNameForHasLogicalRedundancy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForHasLogicalRedundancyCStr(HasLogicalRedundancy value);
 } // namespace HasLogicalRedundancyMapper
 } // namespace Model
 } // namespace DirectConnect
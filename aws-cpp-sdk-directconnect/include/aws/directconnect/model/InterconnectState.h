@@ -39,6 +39,11 @@ namespace InterconnectStateMapper
 AWS_DIRECTCONNECT_API InterconnectState GetInterconnectStateForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForInterconnectState(InterconnectState value);
+
+/**
+ * Same as GetNameForInterconnectState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForInterconnectStateCStr(InterconnectState value);
 } // namespace InterconnectStateMapper
 } // namespace Model
 } // namespace DirectConnect
@@ -39,6 +39,11 @@ namespace LagStateMapper
 AWS_DIRECTCONNECT_API LagState GetLagStateForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForLagState(LagState value);
+
+/**
+ * Same as GetNameForLagState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForLagStateCStr(LagState value);
 } // namespace LagStateMapper
 } // namespace Model
 } // namespace DirectConnect
@@ -34,6 +34,11 @@ namespace LoaContentTypeMapper
 AWS_DIRECTCONNECT_API LoaContentType GetLoaContentTypeForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForLoaContentType(LoaContentType value);
+
+/**
+ * Same as GetNameForLoaContentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForLoaContentTypeCStr(LoaContentType value);
 } // namespace LoaContentTypeMapper
 } // namespace Model
 } // namespace DirectConnect
@@ -41,6 +41,11 @@ namespace VirtualInterfaceStateMapper
 AWS_DIRECTCONNECT_API VirtualInterfaceState GetVirtualInterfaceStateForName(const Aws::String& name);
 
 AWS_DIRECTCONNECT_API Aws::String GetNameForVirtualInterfaceState(VirtualInterfaceState value);
+
+/**
+ * Same as GetNameForVirtualInterfaceState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTCONNECT_API const char* GetNameForVirtualInterfaceStateCStr(VirtualInterfaceState value);
 } // namespace VirtualInterfaceStateMapper
 } // namespace Model
 } // namespace DirectConnect
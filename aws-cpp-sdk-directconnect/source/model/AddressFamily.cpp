@@ -30,20 +30,37 @@ namespace Aws
       namespace AddressFamilyMapper
       {
 
-        static const int ipv4_HASH = HashingUtils::HashString("ipv4");
-        static const int ipv6_HASH = HashingUtils::HashString("ipv6");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ipv4",
+          "ipv6",
+        };
 
         AddressFamily GetAddressFamilyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ipv4_HASH)
-          {
-            return AddressFamily::ipv4;
-          }
-          else if (hashCode == ipv6_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AddressFamily::ipv6;
+          case 3239397:
+            if (name == "ipv4")
+            {
+              return AddressFamily::ipv4;
+            }
+            break;
+          case 3239399:
+            if (name == "ipv6")
+            {
+              return AddressFamily::ipv6;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AddressFamily::NOT_SET;
         }
 
-        Aws::String GetNameForAddressFamily(AddressFamily enumValue)
+        const char* GetNameForAddressFamilyCStr(AddressFamily enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AddressFamily::ipv4:
-            return "ipv4";
-          case AddressFamily::ipv6:
-            return "ipv6";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAddressFamily(AddressFamily enumValue)
+        {
+          return GetNameForAddressFamilyCStr(enumValue);
         }
 
       } // namespace AddressFamilyMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace BGPPeerStateMapper
       {
 
-        static const int verifying_HASH = HashingUtils::HashString("verifying");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "verifying",
+          "pending",
+          "available",
+          "deleting",
+          "deleted",
+        };
 
         BGPPeerState GetBGPPeerStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == verifying_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BGPPeerState::verifying;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return BGPPeerState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return BGPPeerState::available;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return BGPPeerState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return BGPPeerState::deleted;
+          case -1695870775:
+            if (name == "verifying")
+            {
+              return BGPPeerState::verifying;
+            }
+            break;
+          case -682587753:
+            if (name == "pending")
+            {
+              return BGPPeerState::pending;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return BGPPeerState::available;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return BGPPeerState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return BGPPeerState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return BGPPeerState::NOT_SET;
         }
 
-        Aws::String GetNameForBGPPeerState(BGPPeerState enumValue)
+        const char* GetNameForBGPPeerStateCStr(BGPPeerState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BGPPeerState::verifying:
-            return "verifying";
-          case BGPPeerState::pending:
-            return "pending";
-          case BGPPeerState::available:
-            return "available";
-          case BGPPeerState::deleting:
-            return "deleting";
-          case BGPPeerState::deleted:
-            return "deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBGPPeerState(BGPPeerState enumValue)
+        {
+          return GetNameForBGPPeerStateCStr(enumValue);
         }
 
       } // namespace BGPPeerStateMapper
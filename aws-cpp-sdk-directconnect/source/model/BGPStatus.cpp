@@ -30,20 +30,37 @@ namespace Aws
       namespace BGPStatusMapper
       {
 
-        static const int up_HASH = HashingUtils::HashString("up");
-        static const int down_HASH = HashingUtils::HashString("down");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "up",
+          "down",
+        };
 
         BGPStatus GetBGPStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == up_HASH)
-          {
-            return BGPStatus::up;
-          }
-          else if (hashCode == down_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BGPStatus::down;
+          case 3739:
+            if (name == "up")
+            {
+              return BGPStatus::up;
+            }
+            break;
+          case 3089570:
+            if (name == "down")
+            {
+              return BGPStatus::down;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BGPStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBGPStatus(BGPStatus enumValue)
+        const char* GetNameForBGPStatusCStr(BGPStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BGPStatus::up:
-            return "up";
-          case BGPStatus::down:
-            return "down";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBGPStatus(BGPStatus enumValue)
+        {
+          return GetNameForBGPStatusCStr(enumValue);
         }
 
       } // namespace BGPStatusMapper
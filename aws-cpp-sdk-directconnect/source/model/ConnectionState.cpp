@@ -30,50 +30,79 @@ namespace Aws
       namespace ConnectionStateMapper
       {
 
-        static const int ordering_HASH = HashingUtils::HashString("ordering");
-        static const int requested_HASH = HashingUtils::HashString("requested");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int down_HASH = HashingUtils::HashString("down");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int rejected_HASH = HashingUtils::HashString("rejected");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ordering",
+          "requested",
+          "pending",
+          "available",
+          "down",
+          "deleting",
+          "deleted",
+          "rejected",
+        };
 
         ConnectionState GetConnectionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ordering_HASH)
-          {
-            return ConnectionState::ordering;
-          }
-          else if (hashCode == requested_HASH)
-          {
-            return ConnectionState::requested;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return ConnectionState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return ConnectionState::available;
-          }
-          else if (hashCode == down_HASH)
-          {
-            return ConnectionState::down;
-          }
-          else if (hashCode == deleting_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectionState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return ConnectionState::deleted;
-          }
-          else if (hashCode == rejected_HASH)
-          {
-            return ConnectionState::rejected;
+          case 1234314708:
+            if (name == "ordering")
+            {
+              return ConnectionState::ordering;
+            }
+            break;
+          case 693933934:
+            if (name == "requested")
+            {
+              return ConnectionState::requested;
+            }
+            break;
+          case -682587753:
+            if (name == "pending")
+            {
+              return ConnectionState::pending;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return ConnectionState::available;
+            }
+            break;
+          case 3089570:
+            if (name == "down")
+            {
+              return ConnectionState::down;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return ConnectionState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return ConnectionState::deleted;
+            }
+            break;
+          case -608496514:
+            if (name == "rejected")
+            {
+              return ConnectionState::rejected;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return ConnectionState::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionState(ConnectionState enumValue)
+        const char* GetNameForConnectionStateCStr(ConnectionState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectionState::ordering:
-            return "ordering";
-          case ConnectionState::requested:
-            return "requested";
-          case ConnectionState::pending:
-            return "pending";
-          case ConnectionState::available:
-            return "available";
-          case ConnectionState::down:
-            return "down";
-          case ConnectionState::deleting:
-            return "deleting";
-          case ConnectionState::deleted:
-            return "deleted";
-          case ConnectionState::rejected:
-            return "rejected";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectionState(ConnectionState enumValue)
+        {
+          return GetNameForConnectionStateCStr(enumValue);
         }
 
       } // namespace ConnectionStateMapper
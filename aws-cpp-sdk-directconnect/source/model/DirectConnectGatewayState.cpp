@@ -30,30 +30,51 @@ namespace Aws
       namespace DirectConnectGatewayStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "available",
+          "deleting",
+          "deleted",
+        };
 
         DirectConnectGatewayState GetDirectConnectGatewayStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return DirectConnectGatewayState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return DirectConnectGatewayState::available;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return DirectConnectGatewayState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DirectConnectGatewayState::deleted;
+          case -682587753:
+            if (name == "pending")
+            {
+              return DirectConnectGatewayState::pending;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return DirectConnectGatewayState::available;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return DirectConnectGatewayState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return DirectConnectGatewayState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DirectConnectGatewayState::NOT_SET;
         }
 
-        Aws::String GetNameForDirectConnectGatewayState(DirectConnectGatewayState enumValue)
+        const char* GetNameForDirectConnectGatewayStateCStr(DirectConnectGatewayState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DirectConnectGatewayState::pending:
-            return "pending";
-          case DirectConnectGatewayState::available:
-            return "available";
-          case DirectConnectGatewayState::deleting:
-            return "deleting";
-          case DirectConnectGatewayState::deleted:
-            return "deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDirectConnectGatewayState(DirectConnectGatewayState enumValue)
+        {
+          return GetNameForDirectConnectGatewayStateCStr(enumValue);
         }
 
       } // namespace DirectConnectGatewayStateMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace HasLogicalRedundancyMapper
       {
 
-        static const int unknown_HASH = HashingUtils::HashString("unknown");
-        static const int yes_HASH = HashingUtils::HashString("yes");
-        static const int no_HASH = HashingUtils::HashString("no");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "unknown",
+          "yes",
+          "no",
+        };
 
         HasLogicalRedundancy GetHasLogicalRedundancyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == unknown_HASH)
-          {
-            return HasLogicalRedundancy::unknown;
-          }
-          else if (hashCode == yes_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HasLogicalRedundancy::yes;
-          }
-          else if (hashCode == no_HASH)
-          {
-            return HasLogicalRedundancy::no;
+          case -284840886:
+            if (name == "unknown")
+            {
+              return HasLogicalRedundancy::unknown;
+            }
+            break;
+          case 119527:
+            if (name == "yes")
+            {
+              return HasLogicalRedundancy::yes;
+            }
+            break;
+          case 3521:
+            if (name == "no")
+            {
+              return HasLogicalRedundancy::no;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return HasLogicalRedundancy::NOT_SET;
         }
 
-        Aws::String GetNameForHasLogicalRedundancy(HasLogicalRedundancy enumValue)
+        const char* GetNameForHasLogicalRedundancyCStr(HasLogicalRedundancy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HasLogicalRedundancy::unknown:
-            return "unknown";
-          case HasLogicalRedundancy::yes:
-            return "yes";
-          case HasLogicalRedundancy::no:
-            return "no";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHasLogicalRedundancy(HasLogicalRedundancy enumValue)
+        {
+          return GetNameForHasLogicalRedundancyCStr(enumValue);
         }
 
       } // namespace HasLogicalRedundancyMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace InterconnectStateMapper
       {
 
-        static const int requested_HASH = HashingUtils::HashString("requested");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int down_HASH = HashingUtils::HashString("down");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "requested",
+          "pending",
+          "available",
+          "down",
+          "deleting",
+          "deleted",
+        };
 
         InterconnectState GetInterconnectStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == requested_HASH)
-          {
-            return InterconnectState::requested;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return InterconnectState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return InterconnectState::available;
-          }
-          else if (hashCode == down_HASH)
-          {
-            return InterconnectState::down;
-          }
-          else if (hashCode == deleting_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InterconnectState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return InterconnectState::deleted;
+          case 693933934:
+            if (name == "requested")
+            {
+              return InterconnectState::requested;
+            }
+            break;
+          case -682587753:
+            if (name == "pending")
+            {
+              return InterconnectState::pending;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return InterconnectState::available;
+            }
+            break;
+          case 3089570:
+            if (name == "down")
+            {
+              return InterconnectState::down;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return InterconnectState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return InterconnectState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return InterconnectState::NOT_SET;
         }
 
-        Aws::String GetNameForInterconnectState(InterconnectState enumValue)
+        const char* GetNameForInterconnectStateCStr(InterconnectState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InterconnectState::requested:
-            return "requested";
-          case InterconnectState::pending:
-            return "pending";
-          case InterconnectState::available:
-            return "available";
-          case InterconnectState::down:
-            return "down";
-          case InterconnectState::deleting:
-            return "deleting";
-          case InterconnectState::deleted:
-            return "deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInterconnectState(InterconnectState enumValue)
+        {
+          return GetNameForInterconnectStateCStr(enumValue);
         }
 
       } // namespace InterconnectStateMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace LagStateMapper
       {
 
-        static const int requested_HASH = HashingUtils::HashString("requested");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int down_HASH = HashingUtils::HashString("down");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "requested",
+          "pending",
+          "available",
+          "down",
+          "deleting",
+          "deleted",
+        };
 
         LagState GetLagStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == requested_HASH)
-          {
-            return LagState::requested;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return LagState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return LagState::available;
-          }
-          else if (hashCode == down_HASH)
-          {
-            return LagState::down;
-          }
-          else if (hashCode == deleting_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LagState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return LagState::deleted;
+          case 693933934:
+            if (name == "requested")
+            {
+              return LagState::requested;
+            }
+            break;
+          case -682587753:
+            if (name == "pending")
+            {
+              return LagState::pending;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return LagState::available;
+            }
+            break;
+          case 3089570:
+            if (name == "down")
+            {
+              return LagState::down;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return LagState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return LagState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return LagState::NOT_SET;
         }
 
-        Aws::String GetNameForLagState(LagState enumValue)
+        const char* GetNameForLagStateCStr(LagState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LagState::requested:
-            return "requested";
-          case LagState::pending:
-            return "pending";
-          case LagState::available:
-            return "available";
-          case LagState::down:
-            return "down";
-          case LagState::deleting:
-            return "deleting";
-          case LagState::deleted:
-            return "deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLagState(LagState enumValue)
+        {
+          return GetNameForLagStateCStr(enumValue);
         }
 
       } // namespace LagStateMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace LoaContentTypeMapper
       {
 
-        static const int application_pdf_HASH = HashingUtils::HashString("application/pdf");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "application/pdf",
+        };
 
         LoaContentType GetLoaContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == application_pdf_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoaContentType::application_pdf;
+          case -1248334925:
+            if (name == "application/pdf")
+            {
+              return LoaContentType::application_pdf;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return LoaContentType::NOT_SET;
         }
 
-        Aws::String GetNameForLoaContentType(LoaContentType enumValue)
+        const char* GetNameForLoaContentTypeCStr(LoaContentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoaContentType::application_pdf:
-            return "application/pdf";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoaContentType(LoaContentType enumValue)
+        {
+          return GetNameForLoaContentTypeCStr(enumValue);
         }
 
       } // namespace LoaContentTypeMapper
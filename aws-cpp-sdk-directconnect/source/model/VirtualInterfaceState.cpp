@@ -30,50 +30,79 @@ namespace Aws
       namespace VirtualInterfaceStateMapper
       {
 
-        static const int confirming_HASH = HashingUtils::HashString("confirming");
-        static const int verifying_HASH = HashingUtils::HashString("verifying");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int down_HASH = HashingUtils::HashString("down");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int rejected_HASH = HashingUtils::HashString("rejected");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "confirming",
+          "verifying",
+          "pending",
+          "available",
+          "down",
+          "deleting",
+          "deleted",
+          "rejected",
+        };
 
         VirtualInterfaceState GetVirtualInterfaceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == confirming_HASH)
-          {
-            return VirtualInterfaceState::confirming;
-          }
-          else if (hashCode == verifying_HASH)
-          {
-            return VirtualInterfaceState::verifying;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return VirtualInterfaceState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return VirtualInterfaceState::available;
-          }
-          else if (hashCode == down_HASH)
-          {
-            return VirtualInterfaceState::down;
-          }
-          else if (hashCode == deleting_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VirtualInterfaceState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return VirtualInterfaceState::deleted;
-          }
-          else if (hashCode == rejected_HASH)
-          {
-            return VirtualInterfaceState::rejected;
+          case 842414370:
+            if (name == "confirming")
+            {
+              return VirtualInterfaceState::confirming;
+            }
+            break;
+          case -1695870775:
+            if (name == "verifying")
+            {
+              return VirtualInterfaceState::verifying;
+            }
+            break;
+          case -682587753:
+            if (name == "pending")
+            {
+              return VirtualInterfaceState::pending;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return VirtualInterfaceState::available;
+            }
+            break;
+          case 3089570:
+            if (name == "down")
+            {
+              return VirtualInterfaceState::down;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return VirtualInterfaceState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return VirtualInterfaceState::deleted;
+            }
+            break;
+          case -608496514:
+            if (name == "rejected")
+            {
+              return VirtualInterfaceState::rejected;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return VirtualInterfaceState::NOT_SET;
         }
 
-        Aws::String GetNameForVirtualInterfaceState(VirtualInterfaceState enumValue)
+        const char* GetNameForVirtualInterfaceStateCStr(VirtualInterfaceState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VirtualInterfaceState::confirming:
-            return "confirming";
-          case VirtualInterfaceState::verifying:
-            return "verifying";
-          case VirtualInterfaceState::pending:
-            return "pending";
-          case VirtualInterfaceState::available:
-            return "available";
-          case VirtualInterfaceState::down:
-            return "down";
-          case VirtualInterfaceState::deleting:
-            return "deleting";
-          case VirtualInterfaceState::deleted:
-            return "deleted";
-          case VirtualInterfaceState::rejected:
-            return "rejected";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVirtualInterfaceState(VirtualInterfaceState enumValue)
+        {
+          return GetNameForVirtualInterfaceStateCStr(enumValue);
         }
 
       } // namespace VirtualInterfaceStateMapper
@@ -39,6 +39,11 @@ namespace AgentStatusMapper
 AWS_APPLICATIONDISCOVERYSERVICE_API AgentStatus GetAgentStatusForName(const Aws::String& name);
 
 AWS_APPLICATIONDISCOVERYSERVICE_API Aws::String GetNameForAgentStatus(AgentStatus value);
+
+/**
+ * Same as GetNameForAgentStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPLICATIONDISCOVERYSERVICE_API const char* GetNameForAgentStatusCStr(AgentStatus value);
 } // namespace AgentStatusMapper
 } // namespace Model
 } // namespace ApplicationDiscoveryService
@@ -37,6 +37,11 @@ namespace ConfigurationItemTypeMapper
 AWS_APPLICATIONDISCOVERYSERVICE_API ConfigurationItemType GetConfigurationItemTypeForName(const Aws::String& name);
 
 AWS_APPLICATIONDISCOVERYSERVICE_API Aws::String GetNameForConfigurationItemType(ConfigurationItemType value);
+
+/**
+ * Same as GetNameForConfigurationItemType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPLICATIONDISCOVERYSERVICE_API const char* GetNameForConfigurationItemTypeCStr(ConfigurationItemType value);
 } // namespace ConfigurationItemTypeMapper
 } // namespace Model
 } // namespace ApplicationDiscoveryService
@@ -40,6 +40,11 @@ namespace ContinuousExportStatusMapper
 AWS_APPLICATIONDISCOVERYSERVICE_API ContinuousExportStatus GetContinuousExportStatusForName(const Aws::String& name);
 
 AWS_APPLICATIONDISCOVERYSERVICE_API Aws::String GetNameForContinuousExportStatus(ContinuousExportStatus value);
+
+/**
+ * Same as GetNameForContinuousExportStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPLICATIONDISCOVERYSERVICE_API const char* GetNameForContinuousExportStatusCStr(ContinuousExportStatus value);
 } // namespace ContinuousExportStatusMapper
 } // namespace Model
 } // namespace ApplicationDiscoveryService
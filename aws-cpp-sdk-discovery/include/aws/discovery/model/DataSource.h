@@ -34,6 +34,11 @@ namespace DataSourceMapper
 AWS_APPLICATIONDISCOVERYSERVICE_API DataSource GetDataSourceForName(const Aws::String& name);
 
 AWS_APPLICATIONDISCOVERYSERVICE_API Aws::String GetNameForDataSource(DataSource value);
+
+/**
+ * Same as GetNameForDataSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPLICATIONDISCOVERYSERVICE_API const char* GetNameForDataSourceCStr(DataSource value);
 } // namespace DataSourceMapper
 } // namespace Model
 } // namespace ApplicationDiscoveryService
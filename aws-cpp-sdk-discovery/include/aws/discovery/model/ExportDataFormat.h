@@ -35,6 +35,11 @@ namespace ExportDataFormatMapper
 AWS_APPLICATIONDISCOVERYSERVICE_API ExportDataFormat GetExportDataFormatForName(const Aws::String& name);
 
 AWS_APPLICATIONDISCOVERYSERVICE_API Aws::String GetNameForExportDataFormat(ExportDataFormat value);
+
+/**
+ * Same as GetNameForExportDataFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPLICATIONDISCOVERYSERVICE_API const char* GetNameForExportDataFormatCStr(ExportDataFormat value);
 } // namespace ExportDataFormatMapper
 } // namespace Model
 } // namespace ApplicationDiscoveryService
@@ -35,6 +35,11 @@ namespace OrderStringMapper
 AWS_APPLICATIONDISCOVERYSERVICE_API OrderString GetOrderStringForName(const Aws::String& name);
 
 AWS_APPLICATIONDISCOVERYSERVICE_API Aws::String GetNameForOrderString(OrderString value);
+
+/**
+ * Same as GetNameForOrderString(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_APPLICATIONDISCOVERYSERVICE_API const char* GetNameForOrderStringCStr(OrderString value);
 } // namespace OrderStringMapper
 } // namespace Model
 } // namespace ApplicationDiscoveryService
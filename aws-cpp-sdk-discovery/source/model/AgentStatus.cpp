@@ -30,40 +30,65 @@ namespace Aws
       namespace AgentStatusMapper
       {
 
-        static const int HEALTHY_HASH = HashingUtils::HashString("HEALTHY");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-        static const int BLACKLISTED_HASH = HashingUtils::HashString("BLACKLISTED");
-        static const int SHUTDOWN_HASH = HashingUtils::HashString("SHUTDOWN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HEALTHY",
+          "UNHEALTHY",
+          "RUNNING",
+          "UNKNOWN",
+          "BLACKLISTED",
+          "SHUTDOWN",
+        };
 
         AgentStatus GetAgentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HEALTHY_HASH)
-          {
-            return AgentStatus::HEALTHY;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
-            return AgentStatus::UNHEALTHY;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return AgentStatus::RUNNING;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return AgentStatus::UNKNOWN;
-          }
-          else if (hashCode == BLACKLISTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AgentStatus::BLACKLISTED;
-          }
-          else if (hashCode == SHUTDOWN_HASH)
-          {
-            return AgentStatus::SHUTDOWN;
+          case 1513543037:
+            if (name == "HEALTHY")
+            {
+              return AgentStatus::HEALTHY;
+            }
+            break;
+          case 998988996:
+            if (name == "UNHEALTHY")
+            {
+              return AgentStatus::UNHEALTHY;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return AgentStatus::RUNNING;
+            }
+            break;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return AgentStatus::UNKNOWN;
+            }
+            break;
+          case -1016990116:
+            if (name == "BLACKLISTED")
+            {
+              return AgentStatus::BLACKLISTED;
+            }
+            break;
+          case 613283414:
+            if (name == "SHUTDOWN")
+            {
+              return AgentStatus::SHUTDOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return AgentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAgentStatus(AgentStatus enumValue)
+        const char* GetNameForAgentStatusCStr(AgentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AgentStatus::HEALTHY:
-            return "HEALTHY";
-          case AgentStatus::UNHEALTHY:
-            return "UNHEALTHY";
-          case AgentStatus::RUNNING:
-            return "RUNNING";
-          case AgentStatus::UNKNOWN:
-            return "UNKNOWN";
-          case AgentStatus::BLACKLISTED:
-            return "BLACKLISTED";
-          case AgentStatus::SHUTDOWN:
-            return "SHUTDOWN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAgentStatus(AgentStatus enumValue)
+        {
+          return GetNameForAgentStatusCStr(enumValue);
         }
 
       } // namespace AgentStatusMapper
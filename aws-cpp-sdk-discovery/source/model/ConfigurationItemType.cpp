@@ -30,30 +30,51 @@ namespace Aws
       namespace ConfigurationItemTypeMapper
       {
 
-        static const int SERVER_HASH = HashingUtils::HashString("SERVER");
-        static const int PROCESS_HASH = HashingUtils::HashString("PROCESS");
-        static const int CONNECTION_HASH = HashingUtils::HashString("CONNECTION");
-        static const int APPLICATION_HASH = HashingUtils::HashString("APPLICATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SERVER",
+          "PROCESS",
+          "CONNECTION",
+          "APPLICATION",
+        };
 
         ConfigurationItemType GetConfigurationItemTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SERVER_HASH)
-          {
-            return ConfigurationItemType::SERVER;
-          }
-          else if (hashCode == PROCESS_HASH)
-          {
-            return ConfigurationItemType::PROCESS;
-          }
-          else if (hashCode == CONNECTION_HASH)
-          {
-            return ConfigurationItemType::CONNECTION;
-          }
-          else if (hashCode == APPLICATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConfigurationItemType::APPLICATION;
+          case -1852497085:
+            if (name == "SERVER")
+            {
+              return ConfigurationItemType::SERVER;
+            }
+            break;
+          case 408463951:
+            if (name == "PROCESS")
+            {
+              return ConfigurationItemType::PROCESS;
+            }
+            break;
+          case -290559266:
+            if (name == "CONNECTION")
+            {
+              return ConfigurationItemType::CONNECTION;
+            }
+            break;
+          case -587753168:
+            if (name == "APPLICATION")
+            {
+              return ConfigurationItemType::APPLICATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ConfigurationItemType::NOT_SET;
         }
 
-        Aws::String GetNameForConfigurationItemType(ConfigurationItemType enumValue)
+        const char* GetNameForConfigurationItemTypeCStr(ConfigurationItemType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConfigurationItemType::SERVER:
-            return "SERVER";
-          case ConfigurationItemType::PROCESS:
-            return "PROCESS";
-          case ConfigurationItemType::CONNECTION:
-            return "CONNECTION";
-          case ConfigurationItemType::APPLICATION:
-            return "APPLICATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConfigurationItemType(ConfigurationItemType enumValue)
+        {
+          return GetNameForConfigurationItemTypeCStr(enumValue);
         }
 
       } // namespace ConfigurationItemTypeMapper
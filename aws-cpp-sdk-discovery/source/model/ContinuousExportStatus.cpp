@@ -30,45 +30,72 @@ namespace Aws
       namespace ContinuousExportStatusMapper
       {
 
-        static const int START_IN_PROGRESS_HASH = HashingUtils::HashString("START_IN_PROGRESS");
-        static const int START_FAILED_HASH = HashingUtils::HashString("START_FAILED");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int STOP_IN_PROGRESS_HASH = HashingUtils::HashString("STOP_IN_PROGRESS");
-        static const int STOP_FAILED_HASH = HashingUtils::HashString("STOP_FAILED");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "START_IN_PROGRESS",
+          "START_FAILED",
+          "ACTIVE",
+          "ERROR",
+          "STOP_IN_PROGRESS",
+          "STOP_FAILED",
+          "INACTIVE",
+        };
 
         ContinuousExportStatus GetContinuousExportStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == START_IN_PROGRESS_HASH)
-          {
-            return ContinuousExportStatus::START_IN_PROGRESS;
-          }
-          else if (hashCode == START_FAILED_HASH)
-          {
-            return ContinuousExportStatus::START_FAILED;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContinuousExportStatus::ACTIVE;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return ContinuousExportStatus::ERROR_;
-          }
-          else if (hashCode == STOP_IN_PROGRESS_HASH)
-          {
-            return ContinuousExportStatus::STOP_IN_PROGRESS;
-          }
-          else if (hashCode == STOP_FAILED_HASH)
-          {
-            return ContinuousExportStatus::STOP_FAILED;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return ContinuousExportStatus::INACTIVE;
+          case 1318202250:
+            if (name == "START_IN_PROGRESS")
+            {
+              return ContinuousExportStatus::START_IN_PROGRESS;
+            }
+            break;
+          case 280021722:
+            if (name == "START_FAILED")
+            {
+              return ContinuousExportStatus::START_FAILED;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ContinuousExportStatus::ACTIVE;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return ContinuousExportStatus::ERROR_;
+            }
+            break;
+          case -1852784822:
+            if (name == "STOP_IN_PROGRESS")
+            {
+              return ContinuousExportStatus::STOP_IN_PROGRESS;
+            }
+            break;
+          case -1034625254:
+            if (name == "STOP_FAILED")
+            {
+              return ContinuousExportStatus::STOP_FAILED;
+            }
+            break;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return ContinuousExportStatus::INACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ContinuousExportStatus::NOT_SET;
         }
 
-        Aws::String GetNameForContinuousExportStatus(ContinuousExportStatus enumValue)
+        const char* GetNameForContinuousExportStatusCStr(ContinuousExportStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContinuousExportStatus::START_IN_PROGRESS:
-            return "START_IN_PROGRESS";
-          case ContinuousExportStatus::START_FAILED:
-            return "START_FAILED";
-          case ContinuousExportStatus::ACTIVE:
-            return "ACTIVE";
-          case ContinuousExportStatus::ERROR_:
-            return "ERROR";
-          case ContinuousExportStatus::STOP_IN_PROGRESS:
-            return "STOP_IN_PROGRESS";
-          case ContinuousExportStatus::STOP_FAILED:
-            return "STOP_FAILED";
-          case ContinuousExportStatus::INACTIVE:
-            return "INACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContinuousExportStatus(ContinuousExportStatus enumValue)
+        {
+          return GetNameForContinuousExportStatusCStr(enumValue);
         }
 
       } // namespace ContinuousExportStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace DataSourceMapper
       {
 
-        static const int AGENT_HASH = HashingUtils::HashString("AGENT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AGENT",
+        };
 
         DataSource GetDataSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AGENT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DataSource::AGENT;
+          case 62212837:
+            if (name == "AGENT")
+            {
+              return DataSource::AGENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return DataSource::NOT_SET;
         }
 
-        Aws::String GetNameForDataSource(DataSource enumValue)
+        const char* GetNameForDataSourceCStr(DataSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DataSource::AGENT:
-            return "AGENT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDataSource(DataSource enumValue)
+        {
+          return GetNameForDataSourceCStr(enumValue);
         }
 
       } // namespace DataSourceMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ExportDataFormatMapper
       {
 
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
-        static const int GRAPHML_HASH = HashingUtils::HashString("GRAPHML");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CSV",
+          "GRAPHML",
+        };
 
         ExportDataFormat GetExportDataFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CSV_HASH)
-          {
-            return ExportDataFormat::CSV;
-          }
-          else if (hashCode == GRAPHML_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExportDataFormat::GRAPHML;
+          case 67046:
+            if (name == "CSV")
+            {
+              return ExportDataFormat::CSV;
+            }
+            break;
+          case 998326093:
+            if (name == "GRAPHML")
+            {
+              return ExportDataFormat::GRAPHML;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ExportDataFormat::NOT_SET;
         }
 
-        Aws::String GetNameForExportDataFormat(ExportDataFormat enumValue)
+        const char* GetNameForExportDataFormatCStr(ExportDataFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExportDataFormat::CSV:
-            return "CSV";
-          case ExportDataFormat::GRAPHML:
-            return "GRAPHML";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExportDataFormat(ExportDataFormat enumValue)
+        {
+          return GetNameForExportDataFormatCStr(enumValue);
         }
 
       } // namespace ExportDataFormatMapper
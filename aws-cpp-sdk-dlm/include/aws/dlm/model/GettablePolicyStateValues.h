@@ -36,6 +36,11 @@ namespace GettablePolicyStateValuesMapper
 AWS_DLM_API GettablePolicyStateValues GetGettablePolicyStateValuesForName(const Aws::String& name);
 
 AWS_DLM_API Aws::String GetNameForGettablePolicyStateValues(GettablePolicyStateValues value);
+
+/**
+ * Same as GetNameForGettablePolicyStateValues(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DLM_API const char* GetNameForGettablePolicyStateValuesCStr(GettablePolicyStateValues value);
 } // namespace GettablePolicyStateValuesMapper
 } // namespace Model
 } // namespace DLM
@@ -34,6 +34,11 @@ namespace IntervalUnitValuesMapper
 AWS_DLM_API IntervalUnitValues GetIntervalUnitValuesForName(const Aws::String& name);
 
 AWS_DLM_API Aws::String GetNameForIntervalUnitValues(IntervalUnitValues value);
+
+/**
+ * Same as GetNameForIntervalUnitValues(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DLM_API const char* GetNameForIntervalUnitValuesCStr(IntervalUnitValues value);
 } // namespace IntervalUnitValuesMapper
 } // namespace Model
 } // namespace DLM
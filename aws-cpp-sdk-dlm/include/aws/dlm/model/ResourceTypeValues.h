@@ -34,6 +34,11 @@ namespace ResourceTypeValuesMapper
 AWS_DLM_API ResourceTypeValues GetResourceTypeValuesForName(const Aws::String& name);
 
 AWS_DLM_API Aws::String GetNameForResourceTypeValues(ResourceTypeValues value);
+
+/**
+ * Same as GetNameForResourceTypeValues(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DLM_API const char* GetNameForResourceTypeValuesCStr(ResourceTypeValues value);
 } // namespace ResourceTypeValuesMapper
 } // namespace Model
 } // namespace DLM
@@ -35,6 +35,11 @@ namespace SettablePolicyStateValuesMapper
 AWS_DLM_API SettablePolicyStateValues GetSettablePolicyStateValuesForName(const Aws::String& name);
 
 AWS_DLM_API Aws::String GetNameForSettablePolicyStateValues(SettablePolicyStateValues value);
+
+/**
+ * Same as GetNameForSettablePolicyStateValues(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DLM_API const char* GetNameForSettablePolicyStateValuesCStr(SettablePolicyStateValues value);
 } // namespace SettablePolicyStateValuesMapper
 } // namespace Model
 } // namespace DLM
@@ -30,25 +30,44 @@ namespace Aws
       namespace GettablePolicyStateValuesMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLED",
+          "DISABLED",
+          "ERROR",
+        };
 
         GettablePolicyStateValues GetGettablePolicyStateValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
-          {
-            return GettablePolicyStateValues::ENABLED;
-          }
-          else if (hashCode == DISABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GettablePolicyStateValues::DISABLED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return GettablePolicyStateValues::ERROR_;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return GettablePolicyStateValues::ENABLED;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return GettablePolicyStateValues::DISABLED;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return GettablePolicyStateValues::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return GettablePolicyStateValues::NOT_SET;
         }
 
-        Aws::String GetNameForGettablePolicyStateValues(GettablePolicyStateValues enumValue)
+        const char* GetNameForGettablePolicyStateValuesCStr(GettablePolicyStateValues enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GettablePolicyStateValues::ENABLED:
-            return "ENABLED";
-          case GettablePolicyStateValues::DISABLED:
-            return "DISABLED";
-          case GettablePolicyStateValues::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGettablePolicyStateValues(GettablePolicyStateValues enumValue)
+        {
+          return GetNameForGettablePolicyStateValuesCStr(enumValue);
         }
 
       } // namespace GettablePolicyStateValuesMapper
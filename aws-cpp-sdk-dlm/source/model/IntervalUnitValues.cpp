@@ -30,15 +30,30 @@ namespace Aws
       namespace IntervalUnitValuesMapper
       {
 
-        static const int HOURS_HASH = HashingUtils::HashString("HOURS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HOURS",
+        };
 
         IntervalUnitValues GetIntervalUnitValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HOURS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IntervalUnitValues::HOURS;
+          case 68931311:
+            if (name == "HOURS")
+            {
+              return IntervalUnitValues::HOURS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return IntervalUnitValues::NOT_SET;
         }
 
-        Aws::String GetNameForIntervalUnitValues(IntervalUnitValues enumValue)
+        const char* GetNameForIntervalUnitValuesCStr(IntervalUnitValues enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IntervalUnitValues::HOURS:
-            return "HOURS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIntervalUnitValues(IntervalUnitValues enumValue)
+        {
+          return GetNameForIntervalUnitValuesCStr(enumValue);
         }
 
       } // namespace IntervalUnitValuesMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ResourceTypeValuesMapper
       {
 
-        static const int VOLUME_HASH = HashingUtils::HashString("VOLUME");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VOLUME",
+        };
 
         ResourceTypeValues GetResourceTypeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VOLUME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceTypeValues::VOLUME;
+          case -1757553894:
+            if (name == "VOLUME")
+            {
+              return ResourceTypeValues::VOLUME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ResourceTypeValues::NOT_SET;
         }
 
-        Aws::String GetNameForResourceTypeValues(ResourceTypeValues enumValue)
+        const char* GetNameForResourceTypeValuesCStr(ResourceTypeValues enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceTypeValues::VOLUME:
-            return "VOLUME";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceTypeValues(ResourceTypeValues enumValue)
+        {
+          return GetNameForResourceTypeValuesCStr(enumValue);
         }
 
       } // namespace ResourceTypeValuesMapper
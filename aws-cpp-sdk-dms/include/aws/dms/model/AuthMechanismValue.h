@@ -36,6 +36,11 @@ namespace AuthMechanismValueMapper
 AWS_DATABASEMIGRATIONSERVICE_API AuthMechanismValue GetAuthMechanismValueForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForAuthMechanismValue(AuthMechanismValue value);
+
+/**
+ * Same as GetNameForAuthMechanismValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForAuthMechanismValueCStr(AuthMechanismValue value);
 } // namespace AuthMechanismValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
@@ -35,6 +35,11 @@ namespace AuthTypeValueMapper
 AWS_DATABASEMIGRATIONSERVICE_API AuthTypeValue GetAuthTypeValueForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForAuthTypeValue(AuthTypeValue value);
+
+/**
+ * Same as GetNameForAuthTypeValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForAuthTypeValueCStr(AuthTypeValue value);
 } // namespace AuthTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
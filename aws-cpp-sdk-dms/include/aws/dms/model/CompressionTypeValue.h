@@ -35,6 +35,11 @@ namespace CompressionTypeValueMapper
 AWS_DATABASEMIGRATIONSERVICE_API CompressionTypeValue GetCompressionTypeValueForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForCompressionTypeValue(CompressionTypeValue value);
+
+/**
+ * Same as GetNameForCompressionTypeValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForCompressionTypeValueCStr(CompressionTypeValue value);
 } // namespace CompressionTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
@@ -37,6 +37,11 @@ namespace DmsSslModeValueMapper
 AWS_DATABASEMIGRATIONSERVICE_API DmsSslModeValue GetDmsSslModeValueForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForDmsSslModeValue(DmsSslModeValue value);
+
+/**
+ * Same as GetNameForDmsSslModeValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForDmsSslModeValueCStr(DmsSslModeValue value);
 } // namespace DmsSslModeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
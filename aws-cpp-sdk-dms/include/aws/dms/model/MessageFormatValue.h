@@ -34,6 +34,11 @@ namespace MessageFormatValueMapper
 AWS_DATABASEMIGRATIONSERVICE_API MessageFormatValue GetMessageFormatValueForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForMessageFormatValue(MessageFormatValue value);
+
+/**
+ * Same as GetNameForMessageFormatValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForMessageFormatValueCStr(MessageFormatValue value);
 } // namespace MessageFormatValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
@@ -36,6 +36,11 @@ namespace MigrationTypeValueMapper
 AWS_DATABASEMIGRATIONSERVICE_API MigrationTypeValue GetMigrationTypeValueForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForMigrationTypeValue(MigrationTypeValue value);
+
+/**
+ * Same as GetNameForMigrationTypeValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForMigrationTypeValueCStr(MigrationTypeValue value);
 } // namespace MigrationTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
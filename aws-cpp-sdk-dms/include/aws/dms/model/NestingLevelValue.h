@@ -35,6 +35,11 @@ namespace NestingLevelValueMapper
 AWS_DATABASEMIGRATIONSERVICE_API NestingLevelValue GetNestingLevelValueForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForNestingLevelValue(NestingLevelValue value);
+
+/**
+ * Same as GetNameForNestingLevelValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForNestingLevelValueCStr(NestingLevelValue value);
 } // namespace NestingLevelValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
@@ -36,6 +36,11 @@ namespace RefreshSchemasStatusTypeValueMapper
 AWS_DATABASEMIGRATIONSERVICE_API RefreshSchemasStatusTypeValue GetRefreshSchemasStatusTypeValueForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForRefreshSchemasStatusTypeValue(RefreshSchemasStatusTypeValue value);
+
+/**
+ * Same as GetNameForRefreshSchemasStatusTypeValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForRefreshSchemasStatusTypeValueCStr(RefreshSchemasStatusTypeValue value);
 } // namespace RefreshSchemasStatusTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
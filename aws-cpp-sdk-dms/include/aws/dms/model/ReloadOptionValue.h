@@ -35,6 +35,11 @@ namespace ReloadOptionValueMapper
 AWS_DATABASEMIGRATIONSERVICE_API ReloadOptionValue GetReloadOptionValueForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForReloadOptionValue(ReloadOptionValue value);
+
+/**
+ * Same as GetNameForReloadOptionValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForReloadOptionValueCStr(ReloadOptionValue value);
 } // namespace ReloadOptionValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
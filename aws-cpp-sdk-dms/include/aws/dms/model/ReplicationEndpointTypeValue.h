@@ -35,6 +35,11 @@ namespace ReplicationEndpointTypeValueMapper
 AWS_DATABASEMIGRATIONSERVICE_API ReplicationEndpointTypeValue GetReplicationEndpointTypeValueForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForReplicationEndpointTypeValue(ReplicationEndpointTypeValue value);
+
+/**
+ * Same as GetNameForReplicationEndpointTypeValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForReplicationEndpointTypeValueCStr(ReplicationEndpointTypeValue value);
 } // namespace ReplicationEndpointTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
@@ -34,6 +34,11 @@ namespace SourceTypeMapper
 AWS_DATABASEMIGRATIONSERVICE_API SourceType GetSourceTypeForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForSourceType(SourceType value);
+
+/**
+ * Same as GetNameForSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForSourceTypeCStr(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
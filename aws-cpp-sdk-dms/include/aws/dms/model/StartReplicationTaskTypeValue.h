@@ -36,6 +36,11 @@ namespace StartReplicationTaskTypeValueMapper
 AWS_DATABASEMIGRATIONSERVICE_API StartReplicationTaskTypeValue GetStartReplicationTaskTypeValueForName(const Aws::String& name);
 
 AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForStartReplicationTaskTypeValue(StartReplicationTaskTypeValue value);
+
+/**
+ * Same as GetNameForStartReplicationTaskTypeValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForStartReplicationTaskTypeValueCStr(StartReplicationTaskTypeValue value);
 } // namespace StartReplicationTaskTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
@@ -30,25 +30,44 @@ namespace Aws
       namespace AuthMechanismValueMapper
       {
 
-        static const int default__HASH = HashingUtils::HashString("default");
-        static const int mongodb_cr_HASH = HashingUtils::HashString("mongodb_cr");
-        static const int scram_sha_1_HASH = HashingUtils::HashString("scram_sha_1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "default",
+          "mongodb_cr",
+          "scram_sha_1",
+        };
 
         AuthMechanismValue GetAuthMechanismValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == default__HASH)
-          {
-            return AuthMechanismValue::default_;
-          }
-          else if (hashCode == mongodb_cr_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthMechanismValue::mongodb_cr;
-          }
-          else if (hashCode == scram_sha_1_HASH)
-          {
-            return AuthMechanismValue::scram_sha_1;
+          case 1544803905:
+            if (name == "default")
+            {
+              return AuthMechanismValue::default_;
+            }
+            break;
+          case -76709028:
+            if (name == "mongodb_cr")
+            {
+              return AuthMechanismValue::mongodb_cr;
+            }
+            break;
+          case -325622355:
+            if (name == "scram_sha_1")
+            {
+              return AuthMechanismValue::scram_sha_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AuthMechanismValue::NOT_SET;
         }
 
-        Aws::String GetNameForAuthMechanismValue(AuthMechanismValue enumValue)
+        const char* GetNameForAuthMechanismValueCStr(AuthMechanismValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthMechanismValue::default_:
-            return "default";
-          case AuthMechanismValue::mongodb_cr:
-            return "mongodb_cr";
-          case AuthMechanismValue::scram_sha_1:
-            return "scram_sha_1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthMechanismValue(AuthMechanismValue enumValue)
+        {
+          return GetNameForAuthMechanismValueCStr(enumValue);
         }
 
       } // namespace AuthMechanismValueMapper
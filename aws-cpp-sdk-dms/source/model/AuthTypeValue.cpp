@@ -30,20 +30,37 @@ namespace Aws
       namespace AuthTypeValueMapper
       {
 
-        static const int no_HASH = HashingUtils::HashString("no");
-        static const int password_HASH = HashingUtils::HashString("password");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "no",
+          "password",
+        };
 
         AuthTypeValue GetAuthTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == no_HASH)
-          {
-            return AuthTypeValue::no;
-          }
-          else if (hashCode == password_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthTypeValue::password;
+          case 3521:
+            if (name == "no")
+            {
+              return AuthTypeValue::no;
+            }
+            break;
+          case 1216985755:
+            if (name == "password")
+            {
+              return AuthTypeValue::password;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AuthTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForAuthTypeValue(AuthTypeValue enumValue)
+        const char* GetNameForAuthTypeValueCStr(AuthTypeValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthTypeValue::no:
-            return "no";
-          case AuthTypeValue::password:
-            return "password";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthTypeValue(AuthTypeValue enumValue)
+        {
+          return GetNameForAuthTypeValueCStr(enumValue);
         }
 
       } // namespace AuthTypeValueMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CompressionTypeValueMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int gzip_HASH = HashingUtils::HashString("gzip");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "none",
+          "gzip",
+        };
 
         CompressionTypeValue GetCompressionTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
-          {
-            return CompressionTypeValue::none;
-          }
-          else if (hashCode == gzip_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CompressionTypeValue::gzip;
+          case 3387192:
+            if (name == "none")
+            {
+              return CompressionTypeValue::none;
+            }
+            break;
+          case 3189082:
+            if (name == "gzip")
+            {
+              return CompressionTypeValue::gzip;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CompressionTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForCompressionTypeValue(CompressionTypeValue enumValue)
+        const char* GetNameForCompressionTypeValueCStr(CompressionTypeValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CompressionTypeValue::none:
-            return "none";
-          case CompressionTypeValue::gzip:
-            return "gzip";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCompressionTypeValue(CompressionTypeValue enumValue)
+        {
+          return GetNameForCompressionTypeValueCStr(enumValue);
         }
 
       } // namespace CompressionTypeValueMapper
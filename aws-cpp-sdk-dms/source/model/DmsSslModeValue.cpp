@@ -30,30 +30,51 @@ namespace Aws
       namespace DmsSslModeValueMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int require_HASH = HashingUtils::HashString("require");
-        static const int verify_ca_HASH = HashingUtils::HashString("verify-ca");
-        static const int verify_full_HASH = HashingUtils::HashString("verify-full");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "none",
+          "require",
+          "verify-ca",
+          "verify-full",
+        };
 
         DmsSslModeValue GetDmsSslModeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
-          {
-            return DmsSslModeValue::none;
-          }
-          else if (hashCode == require_HASH)
-          {
-            return DmsSslModeValue::require;
-          }
-          else if (hashCode == verify_ca_HASH)
-          {
-            return DmsSslModeValue::verify_ca;
-          }
-          else if (hashCode == verify_full_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DmsSslModeValue::verify_full;
+          case 3387192:
+            if (name == "none")
+            {
+              return DmsSslModeValue::none;
+            }
+            break;
+          case 1095696741:
+            if (name == "require")
+            {
+              return DmsSslModeValue::require;
+            }
+            break;
+          case -1695928782:
+            if (name == "verify-ca")
+            {
+              return DmsSslModeValue::verify_ca;
+            }
+            break;
+          case -1994842269:
+            if (name == "verify-full")
+            {
+              return DmsSslModeValue::verify_full;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DmsSslModeValue::NOT_SET;
         }
 
-        Aws::String GetNameForDmsSslModeValue(DmsSslModeValue enumValue)
+        const char* GetNameForDmsSslModeValueCStr(DmsSslModeValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DmsSslModeValue::none:
-            return "none";
-          case DmsSslModeValue::require:
-            return "require";
-          case DmsSslModeValue::verify_ca:
-            return "verify-ca";
-          case DmsSslModeValue::verify_full:
-            return "verify-full";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDmsSslModeValue(DmsSslModeValue enumValue)
+        {
+          return GetNameForDmsSslModeValueCStr(enumValue);
         }
 
       } // namespace DmsSslModeValueMapper
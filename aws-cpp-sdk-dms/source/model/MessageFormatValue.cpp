@@ -30,15 +30,30 @@ namespace Aws
       namespace MessageFormatValueMapper
       {
 
-        static const int json_HASH = HashingUtils::HashString("json");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "json",
+        };
 
         MessageFormatValue GetMessageFormatValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == json_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MessageFormatValue::json;
+          case 3271912:
+            if (name == "json")
+            {
+              return MessageFormatValue::json;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return MessageFormatValue::NOT_SET;
         }
 
-        Aws::String GetNameForMessageFormatValue(MessageFormatValue enumValue)
+        const char* GetNameForMessageFormatValueCStr(MessageFormatValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MessageFormatValue::json:
-            return "json";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMessageFormatValue(MessageFormatValue enumValue)
+        {
+          return GetNameForMessageFormatValueCStr(enumValue);
         }
 
       } // namespace MessageFormatValueMapper
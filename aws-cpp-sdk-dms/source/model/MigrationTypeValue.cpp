@@ -30,25 +30,44 @@ namespace Aws
       namespace MigrationTypeValueMapper
       {
 
-        static const int full_load_HASH = HashingUtils::HashString("full-load");
-        static const int cdc_HASH = HashingUtils::HashString("cdc");
-        static const int full_load_and_cdc_HASH = HashingUtils::HashString("full-load-and-cdc");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "full-load",
+          "cdc",
+          "full-load-and-cdc",
+        };
 
         MigrationTypeValue GetMigrationTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == full_load_HASH)
-          {
-            return MigrationTypeValue::full_load;
-          }
-          else if (hashCode == cdc_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MigrationTypeValue::cdc;
-          }
-          else if (hashCode == full_load_and_cdc_HASH)
-          {
-            return MigrationTypeValue::full_load_and_cdc;
+          case -1723398812:
+            if (name == "full-load")
+            {
+              return MigrationTypeValue::full_load;
+            }
+            break;
+          case 98338:
+            if (name == "cdc")
+            {
+              return MigrationTypeValue::cdc;
+            }
+            break;
+          case -1303711805:
+            if (name == "full-load-and-cdc")
+            {
+              return MigrationTypeValue::full_load_and_cdc;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return MigrationTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForMigrationTypeValue(MigrationTypeValue enumValue)
+        const char* GetNameForMigrationTypeValueCStr(MigrationTypeValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MigrationTypeValue::full_load:
-            return "full-load";
-          case MigrationTypeValue::cdc:
-            return "cdc";
-          case MigrationTypeValue::full_load_and_cdc:
-            return "full-load-and-cdc";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMigrationTypeValue(MigrationTypeValue enumValue)
+        {
+          return GetNameForMigrationTypeValueCStr(enumValue);
         }
 
       } // namespace MigrationTypeValueMapper
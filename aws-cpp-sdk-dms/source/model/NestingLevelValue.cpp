@@ -30,20 +30,37 @@ namespace Aws
       namespace NestingLevelValueMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int one_HASH = HashingUtils::HashString("one");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "none",
+          "one",
+        };
 
         NestingLevelValue GetNestingLevelValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
-          {
-            return NestingLevelValue::none;
-          }
-          else if (hashCode == one_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NestingLevelValue::one;
+          case 3387192:
+            if (name == "none")
+            {
+              return NestingLevelValue::none;
+            }
+            break;
+          case 110182:
+            if (name == "one")
+            {
+              return NestingLevelValue::one;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return NestingLevelValue::NOT_SET;
         }
 
-        Aws::String GetNameForNestingLevelValue(NestingLevelValue enumValue)
+        const char* GetNameForNestingLevelValueCStr(NestingLevelValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NestingLevelValue::none:
-            return "none";
-          case NestingLevelValue::one:
-            return "one";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNestingLevelValue(NestingLevelValue enumValue)
+        {
+          return GetNameForNestingLevelValueCStr(enumValue);
         }
 
       } // namespace NestingLevelValueMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace RefreshSchemasStatusTypeValueMapper
       {
 
-        static const int successful_HASH = HashingUtils::HashString("successful");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int refreshing_HASH = HashingUtils::HashString("refreshing");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "successful",
+          "failed",
+          "refreshing",
+        };
 
         RefreshSchemasStatusTypeValue GetRefreshSchemasStatusTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == successful_HASH)
-          {
-            return RefreshSchemasStatusTypeValue::successful;
-          }
-          else if (hashCode == failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RefreshSchemasStatusTypeValue::failed;
-          }
-          else if (hashCode == refreshing_HASH)
-          {
-            return RefreshSchemasStatusTypeValue::refreshing;
+          case -733631846:
+            if (name == "successful")
+            {
+              return RefreshSchemasStatusTypeValue::successful;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return RefreshSchemasStatusTypeValue::failed;
+            }
+            break;
+          case -321826009:
+            if (name == "refreshing")
+            {
+              return RefreshSchemasStatusTypeValue::refreshing;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RefreshSchemasStatusTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForRefreshSchemasStatusTypeValue(RefreshSchemasStatusTypeValue enumValue)
+        const char* GetNameForRefreshSchemasStatusTypeValueCStr(RefreshSchemasStatusTypeValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RefreshSchemasStatusTypeValue::successful:
-            return "successful";
-          case RefreshSchemasStatusTypeValue::failed:
-            return "failed";
-          case RefreshSchemasStatusTypeValue::refreshing:
-            return "refreshing";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRefreshSchemasStatusTypeValue(RefreshSchemasStatusTypeValue enumValue)
+        {
+          return GetNameForRefreshSchemasStatusTypeValueCStr(enumValue);
         }
 
       } // namespace RefreshSchemasStatusTypeValueMapper
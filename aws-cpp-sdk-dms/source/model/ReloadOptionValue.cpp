@@ -30,20 +30,37 @@ namespace Aws
       namespace ReloadOptionValueMapper
       {
 
-        static const int data_reload_HASH = HashingUtils::HashString("data-reload");
-        static const int validate_only_HASH = HashingUtils::HashString("validate-only");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "data-reload",
+          "validate-only",
+        };
 
         ReloadOptionValue GetReloadOptionValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == data_reload_HASH)
-          {
-            return ReloadOptionValue::data_reload;
-          }
-          else if (hashCode == validate_only_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReloadOptionValue::validate_only;
+          case 1497426204:
+            if (name == "data-reload")
+            {
+              return ReloadOptionValue::data_reload;
+            }
+            break;
+          case -877173245:
+            if (name == "validate-only")
+            {
+              return ReloadOptionValue::validate_only;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReloadOptionValue::NOT_SET;
         }
 
-        Aws::String GetNameForReloadOptionValue(ReloadOptionValue enumValue)
+        const char* GetNameForReloadOptionValueCStr(ReloadOptionValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReloadOptionValue::data_reload:
-            return "data-reload";
-          case ReloadOptionValue::validate_only:
-            return "validate-only";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReloadOptionValue(ReloadOptionValue enumValue)
+        {
+          return GetNameForReloadOptionValueCStr(enumValue);
         }
 
       } // namespace ReloadOptionValueMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ReplicationEndpointTypeValueMapper
       {
 
-        static const int source_HASH = HashingUtils::HashString("source");
-        static const int target_HASH = HashingUtils::HashString("target");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "source",
+          "target",
+        };
 
         ReplicationEndpointTypeValue GetReplicationEndpointTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == source_HASH)
-          {
-            return ReplicationEndpointTypeValue::source;
-          }
-          else if (hashCode == target_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReplicationEndpointTypeValue::target;
+          case -896505829:
+            if (name == "source")
+            {
+              return ReplicationEndpointTypeValue::source;
+            }
+            break;
+          case -880905839:
+            if (name == "target")
+            {
+              return ReplicationEndpointTypeValue::target;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReplicationEndpointTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForReplicationEndpointTypeValue(ReplicationEndpointTypeValue enumValue)
+        const char* GetNameForReplicationEndpointTypeValueCStr(ReplicationEndpointTypeValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReplicationEndpointTypeValue::source:
-            return "source";
-          case ReplicationEndpointTypeValue::target:
-            return "target";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReplicationEndpointTypeValue(ReplicationEndpointTypeValue enumValue)
+        {
+          return GetNameForReplicationEndpointTypeValueCStr(enumValue);
         }
 
       } // namespace ReplicationEndpointTypeValueMapper
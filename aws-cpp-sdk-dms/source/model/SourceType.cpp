@@ -30,15 +30,30 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int replication_instance_HASH = HashingUtils::HashString("replication-instance");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "replication-instance",
+        };
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == replication_instance_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SourceType::replication_instance;
+          case 512759158:
+            if (name == "replication-instance")
+            {
+              return SourceType::replication_instance;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceTypeCStr(SourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SourceType::replication_instance:
-            return "replication-instance";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSourceType(SourceType enumValue)
+        {
+          return GetNameForSourceTypeCStr(enumValue);
         }
 
       } // namespace SourceTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace StartReplicationTaskTypeValueMapper
       {
 
-        static const int start_replication_HASH = HashingUtils::HashString("start-replication");
-        static const int resume_processing_HASH = HashingUtils::HashString("resume-processing");
-        static const int reload_target_HASH = HashingUtils::HashString("reload-target");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "start-replication",
+          "resume-processing",
+          "reload-target",
+        };
 
         StartReplicationTaskTypeValue GetStartReplicationTaskTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == start_replication_HASH)
-          {
-            return StartReplicationTaskTypeValue::start_replication;
-          }
-          else if (hashCode == resume_processing_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StartReplicationTaskTypeValue::resume_processing;
-          }
-          else if (hashCode == reload_target_HASH)
-          {
-            return StartReplicationTaskTypeValue::reload_target;
+          case 1100176097:
+            if (name == "start-replication")
+            {
+              return StartReplicationTaskTypeValue::start_replication;
+            }
+            break;
+          case 1583146163:
+            if (name == "resume-processing")
+            {
+              return StartReplicationTaskTypeValue::resume_processing;
+            }
+            break;
+          case -711127995:
+            if (name == "reload-target")
+            {
+              return StartReplicationTaskTypeValue::reload_target;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StartReplicationTaskTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForStartReplicationTaskTypeValue(StartReplicationTaskTypeValue enumValue)
+        const char* GetNameForStartReplicationTaskTypeValueCStr(StartReplicationTaskTypeValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StartReplicationTaskTypeValue::start_replication:
-            return "start-replication";
-          case StartReplicationTaskTypeValue::resume_processing:
-            return "resume-processing";
-          case StartReplicationTaskTypeValue::reload_target:
-            return "reload-target";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStartReplicationTaskTypeValue(StartReplicationTaskTypeValue enumValue)
+        {
+          return GetNameForStartReplicationTaskTypeValueCStr(enumValue);
         }
 
       } // namespace StartReplicationTaskTypeValueMapper
@@ -35,6 +35,11 @@ namespace DirectoryEditionMapper
 AWS_DIRECTORYSERVICE_API DirectoryEdition GetDirectoryEditionForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForDirectoryEdition(DirectoryEdition value);
+
+/**
+ * Same as GetNameForDirectoryEdition(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForDirectoryEditionCStr(DirectoryEdition value);
 } // namespace DirectoryEditionMapper
 } // namespace Model
 } // namespace DirectoryService
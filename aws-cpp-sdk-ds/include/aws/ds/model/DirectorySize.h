@@ -35,6 +35,11 @@ namespace DirectorySizeMapper
 AWS_DIRECTORYSERVICE_API DirectorySize GetDirectorySizeForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForDirectorySize(DirectorySize value);
+
+/**
+ * Same as GetNameForDirectorySize(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForDirectorySizeCStr(DirectorySize value);
 } // namespace DirectorySizeMapper
 } // namespace Model
 } // namespace DirectoryService
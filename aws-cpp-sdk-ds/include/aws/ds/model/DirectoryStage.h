@@ -44,6 +44,11 @@ namespace DirectoryStageMapper
 AWS_DIRECTORYSERVICE_API DirectoryStage GetDirectoryStageForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForDirectoryStage(DirectoryStage value);
+
+/**
+ * Same as GetNameForDirectoryStage(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForDirectoryStageCStr(DirectoryStage value);
 } // namespace DirectoryStageMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -37,6 +37,11 @@ namespace DirectoryTypeMapper
 AWS_DIRECTORYSERVICE_API DirectoryType GetDirectoryTypeForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForDirectoryType(DirectoryType value);
+
+/**
+ * Same as GetNameForDirectoryType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForDirectoryTypeCStr(DirectoryType value);
 } // namespace DirectoryTypeMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -40,6 +40,11 @@ namespace DomainControllerStatusMapper
 AWS_DIRECTORYSERVICE_API DomainControllerStatus GetDomainControllerStatusForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForDomainControllerStatus(DomainControllerStatus value);
+
+/**
+ * Same as GetNameForDomainControllerStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForDomainControllerStatusCStr(DomainControllerStatus value);
 } // namespace DomainControllerStatusMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -39,6 +39,11 @@ namespace IpRouteStatusMsgMapper
 AWS_DIRECTORYSERVICE_API IpRouteStatusMsg GetIpRouteStatusMsgForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForIpRouteStatusMsg(IpRouteStatusMsg value);
+
+/**
+ * Same as GetNameForIpRouteStatusMsg(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForIpRouteStatusMsgCStr(IpRouteStatusMsg value);
 } // namespace IpRouteStatusMsgMapper
 } // namespace Model
 } // namespace DirectoryService
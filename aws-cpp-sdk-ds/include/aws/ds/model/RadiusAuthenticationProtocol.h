@@ -37,6 +37,11 @@ namespace RadiusAuthenticationProtocolMapper
 AWS_DIRECTORYSERVICE_API RadiusAuthenticationProtocol GetRadiusAuthenticationProtocolForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForRadiusAuthenticationProtocol(RadiusAuthenticationProtocol value);
+
+/**
+ * Same as GetNameForRadiusAuthenticationProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForRadiusAuthenticationProtocolCStr(RadiusAuthenticationProtocol value);
 } // namespace RadiusAuthenticationProtocolMapper
 } // namespace Model
 } // namespace DirectoryService
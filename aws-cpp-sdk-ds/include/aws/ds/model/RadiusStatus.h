@@ -36,6 +36,11 @@ namespace RadiusStatusMapper
 AWS_DIRECTORYSERVICE_API RadiusStatus GetRadiusStatusForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForRadiusStatus(RadiusStatus value);
+
+/**
+ * Same as GetNameForRadiusStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForRadiusStatusCStr(RadiusStatus value);
 } // namespace RadiusStatusMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -34,6 +34,11 @@ namespace ReplicationScopeMapper
 AWS_DIRECTORYSERVICE_API ReplicationScope GetReplicationScopeForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForReplicationScope(ReplicationScope value);
+
+/**
+ * Same as GetNameForReplicationScope(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForReplicationScopeCStr(ReplicationScope value);
 } // namespace ReplicationScopeMapper
 } // namespace Model
 } // namespace DirectoryService
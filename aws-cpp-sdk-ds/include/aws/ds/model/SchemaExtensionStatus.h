@@ -42,6 +42,11 @@ namespace SchemaExtensionStatusMapper
 AWS_DIRECTORYSERVICE_API SchemaExtensionStatus GetSchemaExtensionStatusForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForSchemaExtensionStatus(SchemaExtensionStatus value);
+
+/**
+ * Same as GetNameForSchemaExtensionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForSchemaExtensionStatusCStr(SchemaExtensionStatus value);
 } // namespace SchemaExtensionStatusMapper
 } // namespace Model
 } // namespace DirectoryService
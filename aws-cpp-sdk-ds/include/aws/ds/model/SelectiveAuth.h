@@ -35,6 +35,11 @@ namespace SelectiveAuthMapper
 AWS_DIRECTORYSERVICE_API SelectiveAuth GetSelectiveAuthForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForSelectiveAuth(SelectiveAuth value);
+
+/**
+ * Same as GetNameForSelectiveAuth(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForSelectiveAuthCStr(SelectiveAuth value);
 } // namespace SelectiveAuthMapper
 } // namespace Model
 } // namespace DirectoryService
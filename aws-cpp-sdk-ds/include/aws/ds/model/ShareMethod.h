@@ -35,6 +35,11 @@ namespace ShareMethodMapper
 AWS_DIRECTORYSERVICE_API ShareMethod GetShareMethodForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForShareMethod(ShareMethod value);
+
+/**
+ * Same as GetNameForShareMethod(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForShareMethodCStr(ShareMethod value);
 } // namespace ShareMethodMapper
 } // namespace Model
 } // namespace DirectoryService
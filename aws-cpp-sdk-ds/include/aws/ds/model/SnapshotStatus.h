@@ -36,6 +36,11 @@ namespace SnapshotStatusMapper
 AWS_DIRECTORYSERVICE_API SnapshotStatus GetSnapshotStatusForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForSnapshotStatus(SnapshotStatus value);
+
+/**
+ * Same as GetNameForSnapshotStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForSnapshotStatusCStr(SnapshotStatus value);
 } // namespace SnapshotStatusMapper
 } // namespace Model
 } // namespace DirectoryService
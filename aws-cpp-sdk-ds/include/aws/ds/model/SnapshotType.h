@@ -35,6 +35,11 @@ namespace SnapshotTypeMapper
 AWS_DIRECTORYSERVICE_API SnapshotType GetSnapshotTypeForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForSnapshotType(SnapshotType value);
+
+/**
+ * Same as GetNameForSnapshotType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForSnapshotTypeCStr(SnapshotType value);
 } // namespace SnapshotTypeMapper
 } // namespace Model
 } // namespace DirectoryService
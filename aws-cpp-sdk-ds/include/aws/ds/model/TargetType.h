@@ -34,6 +34,11 @@ namespace TargetTypeMapper
 AWS_DIRECTORYSERVICE_API TargetType GetTargetTypeForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForTargetType(TargetType value);
+
+/**
+ * Same as GetNameForTargetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForTargetTypeCStr(TargetType value);
 } // namespace TargetTypeMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -37,6 +37,11 @@ namespace TopicStatusMapper
 AWS_DIRECTORYSERVICE_API TopicStatus GetTopicStatusForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForTopicStatus(TopicStatus value);
+
+/**
+ * Same as GetNameForTopicStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForTopicStatusCStr(TopicStatus value);
 } // namespace TopicStatusMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -36,6 +36,11 @@ namespace TrustDirectionMapper
 AWS_DIRECTORYSERVICE_API TrustDirection GetTrustDirectionForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForTrustDirection(TrustDirection value);
+
+/**
+ * Same as GetNameForTrustDirection(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForTrustDirectionCStr(TrustDirection value);
 } // namespace TrustDirectionMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -44,6 +44,11 @@ namespace TrustStateMapper
 AWS_DIRECTORYSERVICE_API TrustState GetTrustStateForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForTrustState(TrustState value);
+
+/**
+ * Same as GetNameForTrustState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForTrustStateCStr(TrustState value);
 } // namespace TrustStateMapper
 } // namespace Model
 } // namespace DirectoryService
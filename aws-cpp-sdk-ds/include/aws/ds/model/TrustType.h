@@ -35,6 +35,11 @@ namespace TrustTypeMapper
 AWS_DIRECTORYSERVICE_API TrustType GetTrustTypeForName(const Aws::String& name);
 
 AWS_DIRECTORYSERVICE_API Aws::String GetNameForTrustType(TrustType value);
+
+/**
+ * Same as GetNameForTrustType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DIRECTORYSERVICE_API const char* GetNameForTrustTypeCStr(TrustType value);
 } // namespace TrustTypeMapper
 } // namespace Model
 } // namespace DirectoryService
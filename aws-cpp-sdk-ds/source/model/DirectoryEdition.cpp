@@ -30,20 +30,37 @@ namespace Aws
       namespace DirectoryEditionMapper
       {
 
-        static const int Enterprise_HASH = HashingUtils::HashString("Enterprise");
-        static const int Standard_HASH = HashingUtils::HashString("Standard");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Enterprise",
+          "Standard",
+        };
 
         DirectoryEdition GetDirectoryEditionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enterprise_HASH)
-          {
-            return DirectoryEdition::Enterprise;
-          }
-          else if (hashCode == Standard_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DirectoryEdition::Standard;
+          case 1190727553:
+            if (name == "Enterprise")
+            {
+              return DirectoryEdition::Enterprise;
+            }
+            break;
+          case 1377272541:
+            if (name == "Standard")
+            {
+              return DirectoryEdition::Standard;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DirectoryEdition::NOT_SET;
         }
 
-        Aws::String GetNameForDirectoryEdition(DirectoryEdition enumValue)
+        const char* GetNameForDirectoryEditionCStr(DirectoryEdition enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DirectoryEdition::Enterprise:
-            return "Enterprise";
-          case DirectoryEdition::Standard:
-            return "Standard";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDirectoryEdition(DirectoryEdition enumValue)
+        {
+          return GetNameForDirectoryEditionCStr(enumValue);
         }
 
       } // namespace DirectoryEditionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DirectorySizeMapper
       {
 
-        static const int Small_HASH = HashingUtils::HashString("Small");
-        static const int Large_HASH = HashingUtils::HashString("Large");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Small",
+          "Large",
+        };
 
         DirectorySize GetDirectorySizeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Small_HASH)
-          {
-            return DirectorySize::Small;
-          }
-          else if (hashCode == Large_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DirectorySize::Large;
+          case 79996135:
+            if (name == "Small")
+            {
+              return DirectorySize::Small;
+            }
+            break;
+          case 73190171:
+            if (name == "Large")
+            {
+              return DirectorySize::Large;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DirectorySize::NOT_SET;
         }
 
-        Aws::String GetNameForDirectorySize(DirectorySize enumValue)
+        const char* GetNameForDirectorySizeCStr(DirectorySize enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DirectorySize::Small:
-            return "Small";
-          case DirectorySize::Large:
-            return "Large";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDirectorySize(DirectorySize enumValue)
+        {
+          return GetNameForDirectorySizeCStr(enumValue);
         }
 
       } // namespace DirectorySizeMapper
@@ -30,65 +30,100 @@ namespace Aws
       namespace DirectoryStageMapper
       {
 
-        static const int Requested_HASH = HashingUtils::HashString("Requested");
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Inoperable_HASH = HashingUtils::HashString("Inoperable");
-        static const int Impaired_HASH = HashingUtils::HashString("Impaired");
-        static const int Restoring_HASH = HashingUtils::HashString("Restoring");
-        static const int RestoreFailed_HASH = HashingUtils::HashString("RestoreFailed");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Requested",
+          "Creating",
+          "Created",
+          "Active",
+          "Inoperable",
+          "Impaired",
+          "Restoring",
+          "RestoreFailed",
+          "Deleting",
+          "Deleted",
+          "Failed",
+        };
 
         DirectoryStage GetDirectoryStageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Requested_HASH)
-          {
-            return DirectoryStage::Requested;
-          }
-          else if (hashCode == Creating_HASH)
-          {
-            return DirectoryStage::Creating;
-          }
-          else if (hashCode == Created_HASH)
-          {
-            return DirectoryStage::Created;
-          }
-          else if (hashCode == Active_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DirectoryStage::Active;
-          }
-          else if (hashCode == Inoperable_HASH)
-          {
-            return DirectoryStage::Inoperable;
-          }
-          else if (hashCode == Impaired_HASH)
-          {
-            return DirectoryStage::Impaired;
-          }
-          else if (hashCode == Restoring_HASH)
-          {
-            return DirectoryStage::Restoring;
-          }
-          else if (hashCode == RestoreFailed_HASH)
-          {
-            return DirectoryStage::RestoreFailed;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return DirectoryStage::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return DirectoryStage::Deleted;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return DirectoryStage::Failed;
+          case -1597065394:
+            if (name == "Requested")
+            {
+              return DirectoryStage::Requested;
+            }
+            break;
+          case 1885065945:
+            if (name == "Creating")
+            {
+              return DirectoryStage::Creating;
+            }
+            break;
+          case -1601759544:
+            if (name == "Created")
+            {
+              return DirectoryStage::Created;
+            }
+            break;
+          case 1955883814:
+            if (name == "Active")
+            {
+              return DirectoryStage::Active;
+            }
+            break;
+          case 1082317037:
+            if (name == "Inoperable")
+            {
+              return DirectoryStage::Inoperable;
+            }
+            break;
+          case -370923715:
+            if (name == "Impaired")
+            {
+              return DirectoryStage::Impaired;
+            }
+            break;
+          case 158507947:
+            if (name == "Restoring")
+            {
+              return DirectoryStage::Restoring;
+            }
+            break;
+          case -355147701:
+            if (name == "RestoreFailed")
+            {
+              return DirectoryStage::RestoreFailed;
+            }
+            break;
+          case 884361160:
+            if (name == "Deleting")
+            {
+              return DirectoryStage::Deleting;
+            }
+            break;
+          case -1079851015:
+            if (name == "Deleted")
+            {
+              return DirectoryStage::Deleted;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return DirectoryStage::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return DirectoryStage::NOT_SET;
         }
 
-        Aws::String GetNameForDirectoryStage(DirectoryStage enumValue)
+        const char* GetNameForDirectoryStageCStr(DirectoryStage enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DirectoryStage::Requested:
-            return "Requested";
-          case DirectoryStage::Creating:
-            return "Creating";
-          case DirectoryStage::Created:
-            return "Created";
-          case DirectoryStage::Active:
-            return "Active";
-          case DirectoryStage::Inoperable:
-            return "Inoperable";
-          case DirectoryStage::Impaired:
-            return "Impaired";
-          case DirectoryStage::Restoring:
-            return "Restoring";
-          case DirectoryStage::RestoreFailed:
-            return "RestoreFailed";
-          case DirectoryStage::Deleting:
-            return "Deleting";
-          case DirectoryStage::Deleted:
-            return "Deleted";
-          case DirectoryStage::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDirectoryStage(DirectoryStage enumValue)
+        {
+          return GetNameForDirectoryStageCStr(enumValue);
         }
 
       } // namespace DirectoryStageMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace DirectoryTypeMapper
       {
 
-        static const int SimpleAD_HASH = HashingUtils::HashString("SimpleAD");
-        static const int ADConnector_HASH = HashingUtils::HashString("ADConnector");
-        static const int MicrosoftAD_HASH = HashingUtils::HashString("MicrosoftAD");
-        static const int SharedMicrosoftAD_HASH = HashingUtils::HashString("SharedMicrosoftAD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SimpleAD",
+          "ADConnector",
+          "MicrosoftAD",
+          "SharedMicrosoftAD",
+        };
 
         DirectoryType GetDirectoryTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SimpleAD_HASH)
-          {
-            return DirectoryType::SimpleAD;
-          }
-          else if (hashCode == ADConnector_HASH)
-          {
-            return DirectoryType::ADConnector;
-          }
-          else if (hashCode == MicrosoftAD_HASH)
-          {
-            return DirectoryType::MicrosoftAD;
-          }
-          else if (hashCode == SharedMicrosoftAD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DirectoryType::SharedMicrosoftAD;
+          case 550304117:
+            if (name == "SimpleAD")
+            {
+              return DirectoryType::SimpleAD;
+            }
+            break;
+          case 109020010:
+            if (name == "ADConnector")
+            {
+              return DirectoryType::ADConnector;
+            }
+            break;
+          case 1308843377:
+            if (name == "MicrosoftAD")
+            {
+              return DirectoryType::MicrosoftAD;
+            }
+            break;
+          case -732581940:
+            if (name == "SharedMicrosoftAD")
+            {
+              return DirectoryType::SharedMicrosoftAD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DirectoryType::NOT_SET;
         }
 
-        Aws::String GetNameForDirectoryType(DirectoryType enumValue)
+        const char* GetNameForDirectoryTypeCStr(DirectoryType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DirectoryType::SimpleAD:
-            return "SimpleAD";
-          case DirectoryType::ADConnector:
-            return "ADConnector";
-          case DirectoryType::MicrosoftAD:
-            return "MicrosoftAD";
-          case DirectoryType::SharedMicrosoftAD:
-            return "SharedMicrosoftAD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDirectoryType(DirectoryType enumValue)
+        {
+          return GetNameForDirectoryTypeCStr(enumValue);
         }
 
       } // namespace DirectoryTypeMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace DomainControllerStatusMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Impaired_HASH = HashingUtils::HashString("Impaired");
-        static const int Restoring_HASH = HashingUtils::HashString("Restoring");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Creating",
+          "Active",
+          "Impaired",
+          "Restoring",
+          "Deleting",
+          "Deleted",
+          "Failed",
+        };
 
         DomainControllerStatus GetDomainControllerStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
-          {
-            return DomainControllerStatus::Creating;
-          }
-          else if (hashCode == Active_HASH)
-          {
-            return DomainControllerStatus::Active;
-          }
-          else if (hashCode == Impaired_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DomainControllerStatus::Impaired;
-          }
-          else if (hashCode == Restoring_HASH)
-          {
-            return DomainControllerStatus::Restoring;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return DomainControllerStatus::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return DomainControllerStatus::Deleted;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return DomainControllerStatus::Failed;
+          case 1885065945:
+            if (name == "Creating")
+            {
+              return DomainControllerStatus::Creating;
+            }
+            break;
+          case 1955883814:
+            if (name == "Active")
+            {
+              return DomainControllerStatus::Active;
+            }
+            break;
+          case -370923715:
+            if (name == "Impaired")
+            {
+              return DomainControllerStatus::Impaired;
+            }
+            break;
+          case 158507947:
+            if (name == "Restoring")
+            {
+              return DomainControllerStatus::Restoring;
+            }
+            break;
+          case 884361160:
+            if (name == "Deleting")
+            {
+              return DomainControllerStatus::Deleting;
+            }
+            break;
+          case -1079851015:
+            if (name == "Deleted")
+            {
+              return DomainControllerStatus::Deleted;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return DomainControllerStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return DomainControllerStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDomainControllerStatus(DomainControllerStatus enumValue)
+        const char* GetNameForDomainControllerStatusCStr(DomainControllerStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DomainControllerStatus::Creating:
-            return "Creating";
-          case DomainControllerStatus::Active:
-            return "Active";
-          case DomainControllerStatus::Impaired:
-            return "Impaired";
-          case DomainControllerStatus::Restoring:
-            return "Restoring";
-          case DomainControllerStatus::Deleting:
-            return "Deleting";
-          case DomainControllerStatus::Deleted:
-            return "Deleted";
-          case DomainControllerStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDomainControllerStatus(DomainControllerStatus enumValue)
+        {
+          return GetNameForDomainControllerStatusCStr(enumValue);
         }
 
       } // namespace DomainControllerStatusMapper
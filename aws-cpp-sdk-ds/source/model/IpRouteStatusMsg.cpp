@@ -30,40 +30,65 @@ namespace Aws
       namespace IpRouteStatusMsgMapper
       {
 
-        static const int Adding_HASH = HashingUtils::HashString("Adding");
-        static const int Added_HASH = HashingUtils::HashString("Added");
-        static const int Removing_HASH = HashingUtils::HashString("Removing");
-        static const int Removed_HASH = HashingUtils::HashString("Removed");
-        static const int AddFailed_HASH = HashingUtils::HashString("AddFailed");
-        static const int RemoveFailed_HASH = HashingUtils::HashString("RemoveFailed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Adding",
+          "Added",
+          "Removing",
+          "Removed",
+          "AddFailed",
+          "RemoveFailed",
+        };
 
         IpRouteStatusMsg GetIpRouteStatusMsgForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Adding_HASH)
-          {
-            return IpRouteStatusMsg::Adding;
-          }
-          else if (hashCode == Added_HASH)
-          {
-            return IpRouteStatusMsg::Added;
-          }
-          else if (hashCode == Removing_HASH)
-          {
-            return IpRouteStatusMsg::Removing;
-          }
-          else if (hashCode == Removed_HASH)
-          {
-            return IpRouteStatusMsg::Removed;
-          }
-          else if (hashCode == AddFailed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IpRouteStatusMsg::AddFailed;
-          }
-          else if (hashCode == RemoveFailed_HASH)
-          {
-            return IpRouteStatusMsg::RemoveFailed;
+          case 1956330433:
+            if (name == "Adding")
+            {
+              return IpRouteStatusMsg::Adding;
+            }
+            break;
+          case 63107296:
+            if (name == "Added")
+            {
+              return IpRouteStatusMsg::Added;
+            }
+            break;
+          case -448173983:
+            if (name == "Removing")
+            {
+              return IpRouteStatusMsg::Removing;
+            }
+            break;
+          case -1538478016:
+            if (name == "Removed")
+            {
+              return IpRouteStatusMsg::Removed;
+            }
+            break;
+          case 1614830622:
+            if (name == "AddFailed")
+            {
+              return IpRouteStatusMsg::AddFailed;
+            }
+            break;
+          case -1079092735:
+            if (name == "RemoveFailed")
+            {
+              return IpRouteStatusMsg::RemoveFailed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return IpRouteStatusMsg::NOT_SET;
         }
 
-        Aws::String GetNameForIpRouteStatusMsg(IpRouteStatusMsg enumValue)
+        const char* GetNameForIpRouteStatusMsgCStr(IpRouteStatusMsg enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IpRouteStatusMsg::Adding:
-            return "Adding";
-          case IpRouteStatusMsg::Added:
-            return "Added";
-          case IpRouteStatusMsg::Removing:
-            return "Removing";
-          case IpRouteStatusMsg::Removed:
-            return "Removed";
-          case IpRouteStatusMsg::AddFailed:
-            return "AddFailed";
-          case IpRouteStatusMsg::RemoveFailed:
-            return "RemoveFailed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIpRouteStatusMsg(IpRouteStatusMsg enumValue)
+        {
+          return GetNameForIpRouteStatusMsgCStr(enumValue);
         }
 
       } // namespace IpRouteStatusMsgMapper
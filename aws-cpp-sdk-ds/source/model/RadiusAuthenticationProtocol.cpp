@@ -30,30 +30,51 @@ namespace Aws
       namespace RadiusAuthenticationProtocolMapper
       {
 
-        static const int PAP_HASH = HashingUtils::HashString("PAP");
-        static const int CHAP_HASH = HashingUtils::HashString("CHAP");
-        static const int MS_CHAPv1_HASH = HashingUtils::HashString("MS-CHAPv1");
-        static const int MS_CHAPv2_HASH = HashingUtils::HashString("MS-CHAPv2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PAP",
+          "CHAP",
+          "MS-CHAPv1",
+          "MS-CHAPv2",
+        };
 
         RadiusAuthenticationProtocol GetRadiusAuthenticationProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PAP_HASH)
-          {
-            return RadiusAuthenticationProtocol::PAP;
-          }
-          else if (hashCode == CHAP_HASH)
-          {
-            return RadiusAuthenticationProtocol::CHAP;
-          }
-          else if (hashCode == MS_CHAPv1_HASH)
-          {
-            return RadiusAuthenticationProtocol::MS_CHAPv1;
-          }
-          else if (hashCode == MS_CHAPv2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RadiusAuthenticationProtocol::MS_CHAPv2;
+          case 78975:
+            if (name == "PAP")
+            {
+              return RadiusAuthenticationProtocol::PAP;
+            }
+            break;
+          case 2067284:
+            if (name == "CHAP")
+            {
+              return RadiusAuthenticationProtocol::CHAP;
+            }
+            break;
+          case 158953174:
+            if (name == "MS-CHAPv1")
+            {
+              return RadiusAuthenticationProtocol::MS_CHAPv1;
+            }
+            break;
+          case 158953175:
+            if (name == "MS-CHAPv2")
+            {
+              return RadiusAuthenticationProtocol::MS_CHAPv2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return RadiusAuthenticationProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForRadiusAuthenticationProtocol(RadiusAuthenticationProtocol enumValue)
+        const char* GetNameForRadiusAuthenticationProtocolCStr(RadiusAuthenticationProtocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RadiusAuthenticationProtocol::PAP:
-            return "PAP";
-          case RadiusAuthenticationProtocol::CHAP:
-            return "CHAP";
-          case RadiusAuthenticationProtocol::MS_CHAPv1:
-            return "MS-CHAPv1";
-          case RadiusAuthenticationProtocol::MS_CHAPv2:
-            return "MS-CHAPv2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRadiusAuthenticationProtocol(RadiusAuthenticationProtocol enumValue)
+        {
+          return GetNameForRadiusAuthenticationProtocolCStr(enumValue);
         }
 
       } // namespace RadiusAuthenticationProtocolMapper
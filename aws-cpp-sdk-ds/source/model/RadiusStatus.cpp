@@ -30,25 +30,44 @@ namespace Aws
       namespace RadiusStatusMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Creating",
+          "Completed",
+          "Failed",
+        };
 
         RadiusStatus GetRadiusStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
-          {
-            return RadiusStatus::Creating;
-          }
-          else if (hashCode == Completed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RadiusStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return RadiusStatus::Failed;
+          case 1885065945:
+            if (name == "Creating")
+            {
+              return RadiusStatus::Creating;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return RadiusStatus::Completed;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return RadiusStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RadiusStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRadiusStatus(RadiusStatus enumValue)
+        const char* GetNameForRadiusStatusCStr(RadiusStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RadiusStatus::Creating:
-            return "Creating";
-          case RadiusStatus::Completed:
-            return "Completed";
-          case RadiusStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRadiusStatus(RadiusStatus enumValue)
+        {
+          return GetNameForRadiusStatusCStr(enumValue);
         }
 
       } // namespace RadiusStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ReplicationScopeMapper
       {
 
-        static const int Domain_HASH = HashingUtils::HashString("Domain");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Domain",
+        };
 
         ReplicationScope GetReplicationScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Domain_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReplicationScope::Domain;
+          case 2052636900:
+            if (name == "Domain")
+            {
+              return ReplicationScope::Domain;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ReplicationScope::NOT_SET;
         }
 
-        Aws::String GetNameForReplicationScope(ReplicationScope enumValue)
+        const char* GetNameForReplicationScopeCStr(ReplicationScope enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReplicationScope::Domain:
-            return "Domain";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReplicationScope(ReplicationScope enumValue)
+        {
+          return GetNameForReplicationScopeCStr(enumValue);
         }
 
       } // namespace ReplicationScopeMapper
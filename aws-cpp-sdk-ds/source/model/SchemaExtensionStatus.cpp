@@ -30,55 +30,86 @@ namespace Aws
       namespace SchemaExtensionStatusMapper
       {
 
-        static const int Initializing_HASH = HashingUtils::HashString("Initializing");
-        static const int CreatingSnapshot_HASH = HashingUtils::HashString("CreatingSnapshot");
-        static const int UpdatingSchema_HASH = HashingUtils::HashString("UpdatingSchema");
-        static const int Replicating_HASH = HashingUtils::HashString("Replicating");
-        static const int CancelInProgress_HASH = HashingUtils::HashString("CancelInProgress");
-        static const int RollbackInProgress_HASH = HashingUtils::HashString("RollbackInProgress");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Initializing",
+          "CreatingSnapshot",
+          "UpdatingSchema",
+          "Replicating",
+          "CancelInProgress",
+          "RollbackInProgress",
+          "Cancelled",
+          "Failed",
+          "Completed",
+        };
 
         SchemaExtensionStatus GetSchemaExtensionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Initializing_HASH)
-          {
-            return SchemaExtensionStatus::Initializing;
-          }
-          else if (hashCode == CreatingSnapshot_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SchemaExtensionStatus::CreatingSnapshot;
-          }
-          else if (hashCode == UpdatingSchema_HASH)
-          {
-            return SchemaExtensionStatus::UpdatingSchema;
-          }
-          else if (hashCode == Replicating_HASH)
-          {
-            return SchemaExtensionStatus::Replicating;
-          }
-          else if (hashCode == CancelInProgress_HASH)
-          {
-            return SchemaExtensionStatus::CancelInProgress;
-          }
-          else if (hashCode == RollbackInProgress_HASH)
-          {
-            return SchemaExtensionStatus::RollbackInProgress;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return SchemaExtensionStatus::Cancelled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return SchemaExtensionStatus::Failed;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return SchemaExtensionStatus::Completed;
+          case -235759507:
+            if (name == "Initializing")
+            {
+              return SchemaExtensionStatus::Initializing;
+            }
+            break;
+          case -884923459:
+            if (name == "CreatingSnapshot")
+            {
+              return SchemaExtensionStatus::CreatingSnapshot;
+            }
+            break;
+          case -1006294873:
+            if (name == "UpdatingSchema")
+            {
+              return SchemaExtensionStatus::UpdatingSchema;
+            }
+            break;
+          case 605400966:
+            if (name == "Replicating")
+            {
+              return SchemaExtensionStatus::Replicating;
+            }
+            break;
+          case 1600273580:
+            if (name == "CancelInProgress")
+            {
+              return SchemaExtensionStatus::CancelInProgress;
+            }
+            break;
+          case 886737046:
+            if (name == "RollbackInProgress")
+            {
+              return SchemaExtensionStatus::RollbackInProgress;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return SchemaExtensionStatus::Cancelled;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return SchemaExtensionStatus::Failed;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return SchemaExtensionStatus::Completed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return SchemaExtensionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSchemaExtensionStatus(SchemaExtensionStatus enumValue)
+        const char* GetNameForSchemaExtensionStatusCStr(SchemaExtensionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SchemaExtensionStatus::Initializing:
-            return "Initializing";
-          case SchemaExtensionStatus::CreatingSnapshot:
-            return "CreatingSnapshot";
-          case SchemaExtensionStatus::UpdatingSchema:
-            return "UpdatingSchema";
-          case SchemaExtensionStatus::Replicating:
-            return "Replicating";
-          case SchemaExtensionStatus::CancelInProgress:
-            return "CancelInProgress";
-          case SchemaExtensionStatus::RollbackInProgress:
-            return "RollbackInProgress";
-          case SchemaExtensionStatus::Cancelled:
-            return "Cancelled";
-          case SchemaExtensionStatus::Failed:
-            return "Failed";
-          case SchemaExtensionStatus::Completed:
-            return "Completed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSchemaExtensionStatus(SchemaExtensionStatus enumValue)
+        {
+          return GetNameForSchemaExtensionStatusCStr(enumValue);
         }
 
       } // namespace SchemaExtensionStatusMapper
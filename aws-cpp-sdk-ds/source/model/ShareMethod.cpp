@@ -30,20 +30,37 @@ namespace Aws
       namespace ShareMethodMapper
       {
 
-        static const int ORGANIZATIONS_HASH = HashingUtils::HashString("ORGANIZATIONS");
-        static const int HANDSHAKE_HASH = HashingUtils::HashString("HANDSHAKE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ORGANIZATIONS",
+          "HANDSHAKE",
+        };
 
         ShareMethod GetShareMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ORGANIZATIONS_HASH)
-          {
-            return ShareMethod::ORGANIZATIONS;
-          }
-          else if (hashCode == HANDSHAKE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ShareMethod::HANDSHAKE;
+          case 1008128384:
+            if (name == "ORGANIZATIONS")
+            {
+              return ShareMethod::ORGANIZATIONS;
+            }
+            break;
+          case -1437692969:
+            if (name == "HANDSHAKE")
+            {
+              return ShareMethod::HANDSHAKE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ShareMethod::NOT_SET;
         }
 
-        Aws::String GetNameForShareMethod(ShareMethod enumValue)
+        const char* GetNameForShareMethodCStr(ShareMethod enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ShareMethod::ORGANIZATIONS:
-            return "ORGANIZATIONS";
-          case ShareMethod::HANDSHAKE:
-            return "HANDSHAKE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForShareMethod(ShareMethod enumValue)
+        {
+          return GetNameForShareMethodCStr(enumValue);
         }
 
       } // namespace ShareMethodMapper
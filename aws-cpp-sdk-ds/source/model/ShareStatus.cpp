@@ -30,55 +30,86 @@ namespace Aws
       namespace ShareStatusMapper
       {
 
-        static const int Shared_HASH = HashingUtils::HashString("Shared");
-        static const int PendingAcceptance_HASH = HashingUtils::HashString("PendingAcceptance");
-        static const int Rejected_HASH = HashingUtils::HashString("Rejected");
-        static const int Rejecting_HASH = HashingUtils::HashString("Rejecting");
-        static const int RejectFailed_HASH = HashingUtils::HashString("RejectFailed");
-        static const int Sharing_HASH = HashingUtils::HashString("Sharing");
-        static const int ShareFailed_HASH = HashingUtils::HashString("ShareFailed");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Shared",
+          "PendingAcceptance",
+          "Rejected",
+          "Rejecting",
+          "RejectFailed",
+          "Sharing",
+          "ShareFailed",
+          "Deleted",
+          "Deleting",
+        };
 
         ShareStatus GetShareStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Shared_HASH)
-          {
-            return ShareStatus::Shared;
-          }
-          else if (hashCode == PendingAcceptance_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ShareStatus::PendingAcceptance;
-          }
-          else if (hashCode == Rejected_HASH)
-          {
-            return ShareStatus::Rejected;
-          }
-          else if (hashCode == Rejecting_HASH)
-          {
-            return ShareStatus::Rejecting;
-          }
-          else if (hashCode == RejectFailed_HASH)
-          {
-            return ShareStatus::RejectFailed;
-          }
-          else if (hashCode == Sharing_HASH)
-          {
-            return ShareStatus::Sharing;
-          }
-          else if (hashCode == ShareFailed_HASH)
-          {
-            return ShareStatus::ShareFailed;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return ShareStatus::Deleted;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return ShareStatus::Deleting;
+          case -1819699067:
+            if (name == "Shared")
+            {
+              return ShareStatus::Shared;
+            }
+            break;
+          case 1113098030:
+            if (name == "PendingAcceptance")
+            {
+              return ShareStatus::PendingAcceptance;
+            }
+            break;
+          case -543852386:
+            if (name == "Rejected")
+            {
+              return ShareStatus::Rejected;
+            }
+            break;
+          case 320449475:
+            if (name == "Rejecting")
+            {
+              return ShareStatus::Rejecting;
+            }
+            break;
+          case 2079118556:
+            if (name == "RejectFailed")
+            {
+              return ShareStatus::RejectFailed;
+            }
+            break;
+          case -576091972:
+            if (name == "Sharing")
+            {
+              return ShareStatus::Sharing;
+            }
+            break;
+          case 1342231772:
+            if (name == "ShareFailed")
+            {
+              return ShareStatus::ShareFailed;
+            }
+            break;
+          case -1079851015:
+            if (name == "Deleted")
+            {
+              return ShareStatus::Deleted;
+            }
+            break;
+          case 884361160:
+            if (name == "Deleting")
+            {
+              return ShareStatus::Deleting;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return ShareStatus::NOT_SET;
         }
 
-        Aws::String GetNameForShareStatus(ShareStatus enumValue)
+        const char* GetNameForShareStatusCStr(ShareStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ShareStatus::Shared:
-            return "Shared";
-          case ShareStatus::PendingAcceptance:
-            return "PendingAcceptance";
-          case ShareStatus::Rejected:
-            return "Rejected";
-          case ShareStatus::Rejecting:
-            return "Rejecting";
-          case ShareStatus::RejectFailed:
-            return "RejectFailed";
-          case ShareStatus::Sharing:
-            return "Sharing";
-          case ShareStatus::ShareFailed:
-            return "ShareFailed";
-          case ShareStatus::Deleted:
-            return "Deleted";
-          case ShareStatus::Deleting:
-            return "Deleting";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForShareStatus(ShareStatus enumValue)
+        {
+          return GetNameForShareStatusCStr(enumValue);
         }
 
       } // namespace ShareStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace SnapshotStatusMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Creating",
+          "Completed",
+          "Failed",
+        };
 
         SnapshotStatus GetSnapshotStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
-          {
-            return SnapshotStatus::Creating;
-          }
-          else if (hashCode == Completed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SnapshotStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return SnapshotStatus::Failed;
+          case 1885065945:
+            if (name == "Creating")
+            {
+              return SnapshotStatus::Creating;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return SnapshotStatus::Completed;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return SnapshotStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SnapshotStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSnapshotStatus(SnapshotStatus enumValue)
+        const char* GetNameForSnapshotStatusCStr(SnapshotStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SnapshotStatus::Creating:
-            return "Creating";
-          case SnapshotStatus::Completed:
-            return "Completed";
-          case SnapshotStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSnapshotStatus(SnapshotStatus enumValue)
+        {
+          return GetNameForSnapshotStatusCStr(enumValue);
         }
 
       } // namespace SnapshotStatusMapper
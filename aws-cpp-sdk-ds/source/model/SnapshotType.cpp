@@ -30,20 +30,37 @@ namespace Aws
       namespace SnapshotTypeMapper
       {
 
-        static const int Auto_HASH = HashingUtils::HashString("Auto");
-        static const int Manual_HASH = HashingUtils::HashString("Manual");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Auto",
+          "Manual",
+        };
 
         SnapshotType GetSnapshotTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Auto_HASH)
-          {
-            return SnapshotType::Auto;
-          }
-          else if (hashCode == Manual_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SnapshotType::Manual;
+          case 2052559:
+            if (name == "Auto")
+            {
+              return SnapshotType::Auto;
+            }
+            break;
+          case -1997548570:
+            if (name == "Manual")
+            {
+              return SnapshotType::Manual;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SnapshotType::NOT_SET;
         }
 
-        Aws::String GetNameForSnapshotType(SnapshotType enumValue)
+        const char* GetNameForSnapshotTypeCStr(SnapshotType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SnapshotType::Auto:
-            return "Auto";
-          case SnapshotType::Manual:
-            return "Manual";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSnapshotType(SnapshotType enumValue)
+        {
+          return GetNameForSnapshotTypeCStr(enumValue);
         }
 
       } // namespace SnapshotTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace TopicStatusMapper
       {
 
-        static const int Registered_HASH = HashingUtils::HashString("Registered");
-        static const int Topic_not_found_HASH = HashingUtils::HashString("Topic not found");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Registered",
+          "Topic not found",
+          "Failed",
+          "Deleted",
+        };
 
         TopicStatus GetTopicStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Registered_HASH)
-          {
-            return TopicStatus::Registered;
-          }
-          else if (hashCode == Topic_not_found_HASH)
-          {
-            return TopicStatus::Topic_not_found;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return TopicStatus::Failed;
-          }
-          else if (hashCode == Deleted_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TopicStatus::Deleted;
+          case 123533986:
+            if (name == "Registered")
+            {
+              return TopicStatus::Registered;
+            }
+            break;
+          case -20847068:
+            if (name == "Topic not found")
+            {
+              return TopicStatus::Topic_not_found;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return TopicStatus::Failed;
+            }
+            break;
+          case -1079851015:
+            if (name == "Deleted")
+            {
+              return TopicStatus::Deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return TopicStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTopicStatus(TopicStatus enumValue)
+        const char* GetNameForTopicStatusCStr(TopicStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TopicStatus::Registered:
-            return "Registered";
-          case TopicStatus::Topic_not_found:
-            return "Topic not found";
-          case TopicStatus::Failed:
-            return "Failed";
-          case TopicStatus::Deleted:
-            return "Deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTopicStatus(TopicStatus enumValue)
+        {
+          return GetNameForTopicStatusCStr(enumValue);
         }
 
       } // namespace TopicStatusMapper
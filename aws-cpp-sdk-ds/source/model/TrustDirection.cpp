@@ -30,25 +30,44 @@ namespace Aws
       namespace TrustDirectionMapper
       {
 
-        static const int One_Way_Outgoing_HASH = HashingUtils::HashString("One-Way: Outgoing");
-        static const int One_Way_Incoming_HASH = HashingUtils::HashString("One-Way: Incoming");
-        static const int Two_Way_HASH = HashingUtils::HashString("Two-Way");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "One-Way: Outgoing",
+          "One-Way: Incoming",
+          "Two-Way",
+        };
 
         TrustDirection GetTrustDirectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == One_Way_Outgoing_HASH)
-          {
-            return TrustDirection::One_Way_Outgoing;
-          }
-          else if (hashCode == One_Way_Incoming_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TrustDirection::One_Way_Incoming;
-          }
-          else if (hashCode == Two_Way_HASH)
-          {
-            return TrustDirection::Two_Way;
+          case 978233722:
+            if (name == "One-Way: Outgoing")
+            {
+              return TrustDirection::One_Way_Outgoing;
+            }
+            break;
+          case 1009348148:
+            if (name == "One-Way: Incoming")
+            {
+              return TrustDirection::One_Way_Incoming;
+            }
+            break;
+          case 751705006:
+            if (name == "Two-Way")
+            {
+              return TrustDirection::Two_Way;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TrustDirection::NOT_SET;
         }
 
-        Aws::String GetNameForTrustDirection(TrustDirection enumValue)
+        const char* GetNameForTrustDirectionCStr(TrustDirection enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TrustDirection::One_Way_Outgoing:
-            return "One-Way: Outgoing";
-          case TrustDirection::One_Way_Incoming:
-            return "One-Way: Incoming";
-          case TrustDirection::Two_Way:
-            return "Two-Way";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTrustDirection(TrustDirection enumValue)
+        {
+          return GetNameForTrustDirectionCStr(enumValue);
         }
 
       } // namespace TrustDirectionMapper
@@ -30,65 +30,100 @@ namespace Aws
       namespace TrustStateMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Verifying_HASH = HashingUtils::HashString("Verifying");
-        static const int VerifyFailed_HASH = HashingUtils::HashString("VerifyFailed");
-        static const int Verified_HASH = HashingUtils::HashString("Verified");
-        static const int Updating_HASH = HashingUtils::HashString("Updating");
-        static const int UpdateFailed_HASH = HashingUtils::HashString("UpdateFailed");
-        static const int Updated_HASH = HashingUtils::HashString("Updated");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Creating",
+          "Created",
+          "Verifying",
+          "VerifyFailed",
+          "Verified",
+          "Updating",
+          "UpdateFailed",
+          "Updated",
+          "Deleting",
+          "Deleted",
+          "Failed",
+        };
 
         TrustState GetTrustStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
-          {
-            return TrustState::Creating;
-          }
-          else if (hashCode == Created_HASH)
-          {
-            return TrustState::Created;
-          }
-          else if (hashCode == Verifying_HASH)
-          {
-            return TrustState::Verifying;
-          }
-          else if (hashCode == VerifyFailed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TrustState::VerifyFailed;
-          }
-          else if (hashCode == Verified_HASH)
-          {
-            return TrustState::Verified;
-          }
-          else if (hashCode == Updating_HASH)
-          {
-            return TrustState::Updating;
-          }
-          else if (hashCode == UpdateFailed_HASH)
-          {
-            return TrustState::UpdateFailed;
-          }
-          else if (hashCode == Updated_HASH)
-          {
-            return TrustState::Updated;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return TrustState::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return TrustState::Deleted;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return TrustState::Failed;
+          case 1885065945:
+            if (name == "Creating")
+            {
+              return TrustState::Creating;
+            }
+            break;
+          case -1601759544:
+            if (name == "Created")
+            {
+              return TrustState::Created;
+            }
+            break;
+          case 308097193:
+            if (name == "Verifying")
+            {
+              return TrustState::Verifying;
+            }
+            break;
+          case -835494346:
+            if (name == "VerifyFailed")
+            {
+              return TrustState::VerifyFailed;
+            }
+            break;
+          case -1929739544:
+            if (name == "Verified")
+            {
+              return TrustState::Verified;
+            }
+            break;
+          case 1387244390:
+            if (name == "Updating")
+            {
+              return TrustState::Updating;
+            }
+            break;
+          case -1165913466:
+            if (name == "UpdateFailed")
+            {
+              return TrustState::UpdateFailed;
+            }
+            break;
+          case 1430223003:
+            if (name == "Updated")
+            {
+              return TrustState::Updated;
+            }
+            break;
+          case 884361160:
+            if (name == "Deleting")
+            {
+              return TrustState::Deleting;
+            }
+            break;
+          case -1079851015:
+            if (name == "Deleted")
+            {
+              return TrustState::Deleted;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return TrustState::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return TrustState::NOT_SET;
         }
 
-        Aws::String GetNameForTrustState(TrustState enumValue)
+        const char* GetNameForTrustStateCStr(TrustState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TrustState::Creating:
-            return "Creating";
-          case TrustState::Created:
-            return "Created";
-          case TrustState::Verifying:
-            return "Verifying";
-          case TrustState::VerifyFailed:
-            return "VerifyFailed";
-          case TrustState::Verified:
-            return "Verified";
-          case TrustState::Updating:
-            return "Updating";
-          case TrustState::UpdateFailed:
-            return "UpdateFailed";
-          case TrustState::Updated:
-            return "Updated";
-          case TrustState::Deleting:
-            return "Deleting";
-          case TrustState::Deleted:
-            return "Deleted";
-          case TrustState::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTrustState(TrustState enumValue)
+        {
+          return GetNameForTrustStateCStr(enumValue);
         }
 
       } // namespace TrustStateMapper
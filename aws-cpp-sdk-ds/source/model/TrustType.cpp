@@ -30,20 +30,37 @@ namespace Aws
       namespace TrustTypeMapper
       {
 
-        static const int Forest_HASH = HashingUtils::HashString("Forest");
-        static const int External_HASH = HashingUtils::HashString("External");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Forest",
+          "External",
+        };
 
         TrustType GetTrustTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Forest_HASH)
-          {
-            return TrustType::Forest;
-          }
-          else if (hashCode == External_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TrustType::External;
+          case 2110048317:
+            if (name == "Forest")
+            {
+              return TrustType::Forest;
+            }
+            break;
+          case -1756117013:
+            if (name == "External")
+            {
+              return TrustType::External;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TrustType::NOT_SET;
         }
 
-        Aws::String GetNameForTrustType(TrustType enumValue)
+        const char* GetNameForTrustTypeCStr(TrustType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TrustType::Forest:
-            return "Forest";
-          case TrustType::External:
-            return "External";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTrustType(TrustType enumValue)
+        {
+          return GetNameForTrustTypeCStr(enumValue);
         }
 
       } // namespace TrustTypeMapper
@@ -0,0 +1,227 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <aws/dynamodb/model/GetItemRequest.h>
+#include <aws/dynamodb/model/QueryRequest.h>
+#include <aws/dynamodb/model/ScanRequest.h>
+#include <aws/testing/mocks/http/MockHttpClient.h>
+#include <atomic>
+#include <future>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::DynamoDB;
+using namespace Aws::DynamoDB::Model;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+namespace
+{
+    static const char* ALLOCATION_TAG = "ResultParsingTest";
+    static const char* QUERY_RESPONSE = "{\"Count\":2,\"Items\":[{\"id\":{\"S\":\"first\"},\"size\":{\"N\":\"1\"}},"
+                                        "{\"id\":{\"S\":\"second\"},\"size\":{\"N\":\"2\"}}],\"ScannedCount\":2}";
+
+    // Claims to send requests without blocking, so the client takes its event loop path; the default MakeRequestAsync completes them inline.
+    class AsyncMockHttpClient : public MockHttpClient
+    {
+    public:
+        AsyncMockHttpClient() : m_asyncRequests(0) {}
+
+        bool SupportsAsyncRequests() const override { return true; }
+
+        void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpResponseHandler& handler,
+            Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+        {
+            m_asyncRequests++;
+            MockHttpClient::MakeRequestAsync(request, handler, readLimiter, writeLimiter);
+        }
+
+        int GetAsyncRequests() const { return m_asyncRequests; }
+
+    private:
+        mutable std::atomic<int> m_asyncRequests;
+    };
+
+    class ResultParsingTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            CreateClient(Aws::MakeShared<MockHttpClient>(ALLOCATION_TAG));
+        }
+
+        void CreateClient(const std::shared_ptr<MockHttpClient>& httpClient)
+        {
+            ClientConfiguration config;
+            config.scheme = Scheme::HTTP;
+            config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(ALLOCATION_TAG, 0);
+
+            dynamoClient = nullptr;
+            mockHttpClient = httpClient;
+            mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(ALLOCATION_TAG);
+            mockHttpClientFactory->SetClient(mockHttpClient);
+            SetHttpClientFactory(mockHttpClientFactory);
+            dynamoClient = Aws::MakeShared<DynamoDBClient>(ALLOCATION_TAG,
+                                                           Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "akid", "secret"),
+                                                           config);
+        }
+
+        void TearDown() override
+        {
+            dynamoClient = nullptr;
+            mockHttpClient = nullptr;
+            mockHttpClientFactory = nullptr;
+
+            // We override the global http factory in SetUp(), so reset back to the default state as we leave this test suite.
+            CleanupHttp();
+            InitHttp();
+        }
+
+        void AddResponseToReturn(const Aws::String& body)
+        {
+            std::shared_ptr<HttpRequest> request =
+                mockHttpClientFactory->CreateHttpRequest(URI("www.uri.com"), HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            std::shared_ptr<StandardHttpResponse> response = Aws::MakeShared<StandardHttpResponse>(ALLOCATION_TAG, *request);
+            response->SetResponseCode(HttpResponseCode::OK);
+            response->GetResponseBody() << body;
+            mockHttpClient->AddResponseToReturn(response);
+        }
+
+        std::shared_ptr<DynamoDBClient> dynamoClient;
+        std::shared_ptr<MockHttpClient> mockHttpClient;
+        std::shared_ptr<MockHttpClientFactory> mockHttpClientFactory;
+    };
+
+    TEST_F(ResultParsingTest, TestQueryReadsItemsFromResponseStream)
+    {
+        AddResponseToReturn(QUERY_RESPONSE);
+
+        auto outcome = dynamoClient->Query(QueryRequest().WithTableName("table"));
+
+        ASSERT_TRUE(outcome.IsSuccess());
+        ASSERT_EQ(2, outcome.GetResult().GetCount());
+        ASSERT_EQ(2u, outcome.GetResult().GetItems().size());
+        ASSERT_EQ("second", outcome.GetResult().GetItems()[1].at("id").GetS());
+    }
+
+    TEST_F(ResultParsingTest, TestTruncatedQueryResponseIsParseError)
+    {
+        Aws::String truncated(QUERY_RESPONSE);
+        AddResponseToReturn(truncated.substr(0, truncated.size() / 2));
+
+        auto outcome = dynamoClient->Query(QueryRequest().WithTableName("table"));
+
+        ASSERT_FALSE(outcome.IsSuccess());
+        ASSERT_EQ(DynamoDBErrors::UNKNOWN, outcome.GetError().GetErrorType());
+        ASSERT_EQ("Json Parser Error", outcome.GetError().GetExceptionName());
+        ASSERT_FALSE(outcome.GetError().GetMessage().empty());
+        ASSERT_FALSE(outcome.GetError().ShouldRetry());
+    }
+
+    TEST_F(ResultParsingTest, TestMalformedScanResponseIsParseError)
+    {
+        AddResponseToReturn("{\"Count\":1,\"Items\":[{\"id\":{\"S\":\"first\"}}]");
+
+        auto outcome = dynamoClient->Scan(ScanRequest().WithTableName("table"));
+
+        ASSERT_FALSE(outcome.IsSuccess());
+        ASSERT_EQ("Json Parser Error", outcome.GetError().GetExceptionName());
+    }
+
+    TEST_F(ResultParsingTest, TestQueryAsyncThroughAsyncHttpClient)
+    {
+        auto asyncHttpClient = Aws::MakeShared<AsyncMockHttpClient>(ALLOCATION_TAG);
+        CreateClient(asyncHttpClient);
+        AddResponseToReturn(QUERY_RESPONSE);
+
+        std::promise<QueryOutcome> outcomePromise;
+        dynamoClient->QueryAsync(QueryRequest().WithTableName("table"),
+            [&outcomePromise](const DynamoDBClient*, const QueryRequest& request, const QueryOutcome& outcome, const std::shared_ptr<const AsyncCallerContext>&)
+            {
+                ASSERT_EQ("table", request.GetTableName());
+                outcomePromise.set_value(outcome);
+            });
+
+        auto outcome = outcomePromise.get_future().get();
+        ASSERT_TRUE(outcome.IsSuccess());
+        ASSERT_EQ(2u, outcome.GetResult().GetItems().size());
+        ASSERT_EQ("second", outcome.GetResult().GetItems()[1].at("id").GetS());
+        ASSERT_EQ(1, asyncHttpClient->GetAsyncRequests());
+    }
+
+    TEST_F(ResultParsingTest, TestMalformedQueryAsyncResponseIsParseError)
+    {
+        CreateClient(Aws::MakeShared<AsyncMockHttpClient>(ALLOCATION_TAG));
+        AddResponseToReturn("{\"Count\":2,\"Items\":[");
+
+        auto outcome = dynamoClient->QueryCallable(QueryRequest().WithTableName("table")).get();
+
+        ASSERT_FALSE(outcome.IsSuccess());
+        ASSERT_EQ("Json Parser Error", outcome.GetError().GetExceptionName());
+    }
+
+    TEST_F(ResultParsingTest, TestGetItemCallableThroughAsyncHttpClient)
+    {
+        auto asyncHttpClient = Aws::MakeShared<AsyncMockHttpClient>(ALLOCATION_TAG);
+        CreateClient(asyncHttpClient);
+        AddResponseToReturn("{\"Item\":{\"id\":{\"S\":\"first\"}}}");
+
+        auto outcome = dynamoClient->GetItemCallable(GetItemRequest().WithTableName("table")).get();
+
+        ASSERT_TRUE(outcome.IsSuccess());
+        ASSERT_EQ("first", outcome.GetResult().GetItem().at("id").GetS());
+        ASSERT_EQ(1, asyncHttpClient->GetAsyncRequests());
+    }
+
+    TEST_F(ResultParsingTest, TestHedgedOrDeadlineBoundQueryAsyncUsesExecutor)
+    {
+        auto asyncHttpClient = Aws::MakeShared<AsyncMockHttpClient>(ALLOCATION_TAG);
+        CreateClient(asyncHttpClient);
+
+        QueryRequest hedgedRequest;
+        hedgedRequest.SetTableName("table");
+        hedgedRequest.SetHedgingEnabled(true);
+        QueryRequest boundedRequest;
+        boundedRequest.SetTableName("table");
+        boundedRequest.SetDeadlineMs(10000);
+
+        for (const QueryRequest* request : { &hedgedRequest, &boundedRequest })
+        {
+            AddResponseToReturn(QUERY_RESPONSE);
+            std::promise<QueryOutcome> outcomePromise;
+            dynamoClient->QueryAsync(*request,
+                [&outcomePromise](const DynamoDBClient*, const QueryRequest&, const QueryOutcome& outcome, const std::shared_ptr<const AsyncCallerContext>&)
+                {
+                    outcomePromise.set_value(outcome);
+                });
+            auto outcome = outcomePromise.get_future().get();
+            ASSERT_TRUE(outcome.IsSuccess());
+            ASSERT_EQ(2u, outcome.GetResult().GetItems().size());
+
+            AddResponseToReturn(QUERY_RESPONSE);
+            ASSERT_TRUE(dynamoClient->QueryCallable(*request).get().IsSuccess());
+        }
+
+        // hedging and deadlines are only applied by the blocking path, which the executor takes.
+        ASSERT_EQ(0, asyncHttpClient->GetAsyncRequests());
+    }
+}
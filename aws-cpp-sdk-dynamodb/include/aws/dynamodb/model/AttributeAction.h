@@ -36,6 +36,11 @@ namespace AttributeActionMapper
 AWS_DYNAMODB_API AttributeAction GetAttributeActionForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForAttributeAction(AttributeAction value);
+
+/**
+ * Same as GetNameForAttributeAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForAttributeActionCStr(AttributeAction value);
 } // namespace AttributeActionMapper
 } // namespace Model
 } // namespace DynamoDB
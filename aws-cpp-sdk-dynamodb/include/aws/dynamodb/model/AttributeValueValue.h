@@ -23,6 +23,7 @@
 #include <aws/core/utils/json/JsonSerializer.h>
 
 #include <cassert>
+#include <utility>
 
 namespace Aws
 {
@@ -88,6 +89,7 @@ class AttributeValueString final : public AttributeValueValue
 {
 public:
     explicit AttributeValueString(const Aws::String& value) : m_s(value) {}
+    explicit AttributeValueString(Aws::String&& value) : m_s(std::move(value)) {}
     explicit AttributeValueString(Aws::Utils::Json::JsonView jsonValue) : m_s(jsonValue.GetString("S")) {}
     const Aws::String& GetS() const override { return m_s; }
     bool IsDefault() const override { return m_s == DEFAULT_STRING; }
@@ -104,6 +106,7 @@ class AttributeValueNumeric final : public AttributeValueValue
 {
 public:
     explicit AttributeValueNumeric(const Aws::String& value) : m_n(value) {}
+    explicit AttributeValueNumeric(Aws::String&& value) : m_n(std::move(value)) {}
     explicit AttributeValueNumeric(Aws::Utils::Json::JsonView jsonValue) : m_n(jsonValue.GetString("N")) {}
     const Aws::String& GetN() const override { return m_n; }
     bool IsDefault() const override { return m_n == DEFAULT_STRING; }
@@ -120,6 +123,7 @@ class AttributeValueByteBuffer final : public AttributeValueValue
 {
 public:
     explicit AttributeValueByteBuffer(const Aws::Utils::ByteBuffer& value) : m_b(value) {}
+    explicit AttributeValueByteBuffer(Aws::Utils::ByteBuffer&& value) : m_b(std::move(value)) {}
     explicit AttributeValueByteBuffer(Aws::Utils::Json::JsonView jsonValue);
     const Aws::Utils::ByteBuffer& GetB() const override { return m_b; }
     bool IsDefault() const override { return m_b == DEFAULT_BYTEBUFFER; }
@@ -136,6 +140,7 @@ class AttributeValueStringSet final : public AttributeValueValue
 {
 public:
     explicit AttributeValueStringSet(const Aws::Vector<Aws::String>& value) : m_sS(value) {}
+    explicit AttributeValueStringSet(Aws::Vector<Aws::String>&& value) : m_sS(std::move(value)) {}
     explicit AttributeValueStringSet(Aws::Utils::Json::JsonView jsonValue);
     const Aws::Vector<Aws::String>& GetSS() const override { return m_sS; }
     void AddSItem(const Aws::String& sItem) override { m_sS.push_back(sItem); }
@@ -153,6 +158,7 @@ class AttributeValueNumberSet final : public AttributeValueValue
 {
 public:
     explicit AttributeValueNumberSet(const Aws::Vector<Aws::String>& value) : m_nS(value) {}
+    explicit AttributeValueNumberSet(Aws::Vector<Aws::String>&& value) : m_nS(std::move(value)) {}
     explicit AttributeValueNumberSet(Aws::Utils::Json::JsonView jsonValue);
     const Aws::Vector<Aws::String>& GetNS() const override { return m_nS; }
     void AddNItem(const Aws::String& nItem) override { m_nS.push_back(nItem); }
@@ -170,6 +176,7 @@ class AttributeValueByteBufferSet final : public AttributeValueValue
 {
 public:
     explicit AttributeValueByteBufferSet(const Aws::Vector<Aws::Utils::ByteBuffer>& value) : m_bS(value) {}
+    explicit AttributeValueByteBufferSet(Aws::Vector<Aws::Utils::ByteBuffer>&& value) : m_bS(std::move(value)) {}
     explicit AttributeValueByteBufferSet(Aws::Utils::Json::JsonView jsonValue);
     const Aws::Vector<Aws::Utils::ByteBuffer>& GetBS() const override { return m_bS; }
     void AddBItem(const Aws::Utils::ByteBuffer& bItem) override { m_bS.push_back(bItem); }
@@ -187,6 +194,7 @@ class AttributeValueMap final : public AttributeValueValue
 {
 public:
     explicit AttributeValueMap(const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>& value) : m_m(value) {}
+    explicit AttributeValueMap(Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>&& value) : m_m(std::move(value)) {}
     explicit AttributeValueMap(Aws::Utils::Json::JsonView jsonValue);
     const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>>& GetM() const override{ return m_m; }
     void AddMEntry(const Aws::String& key, const std::shared_ptr<AttributeValue>& value) override;
@@ -204,6 +212,7 @@ class AttributeValueList final : public AttributeValueValue
 {
 public:
     explicit AttributeValueList(const Aws::Vector<std::shared_ptr<AttributeValue>>& value) : m_l(value) {}
+    explicit AttributeValueList(Aws::Vector<std::shared_ptr<AttributeValue>>&& value) : m_l(std::move(value)) {}
     explicit AttributeValueList(Aws::Utils::Json::JsonView jsonValue);
     const Aws::Vector<std::shared_ptr<AttributeValue>>& GetL() const override { return m_l; }
     void AddLItem(const std::shared_ptr<AttributeValue>& listItem) override { m_l.push_back(listItem); }
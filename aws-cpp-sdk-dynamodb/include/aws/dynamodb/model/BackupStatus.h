@@ -36,6 +36,11 @@ namespace BackupStatusMapper
 AWS_DYNAMODB_API BackupStatus GetBackupStatusForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForBackupStatus(BackupStatus value);
+
+/**
+ * Same as GetNameForBackupStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForBackupStatusCStr(BackupStatus value);
 } // namespace BackupStatusMapper
 } // namespace Model
 } // namespace DynamoDB
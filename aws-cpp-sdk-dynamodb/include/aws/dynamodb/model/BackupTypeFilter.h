@@ -36,6 +36,11 @@ namespace BackupTypeFilterMapper
 AWS_DYNAMODB_API BackupTypeFilter GetBackupTypeFilterForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForBackupTypeFilter(BackupTypeFilter value);
+
+/**
+ * Same as GetNameForBackupTypeFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForBackupTypeFilterCStr(BackupTypeFilter value);
 } // namespace BackupTypeFilterMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -35,6 +35,11 @@ namespace BillingModeMapper
 AWS_DYNAMODB_API BillingMode GetBillingModeForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForBillingMode(BillingMode value);
+
+/**
+ * Same as GetNameForBillingMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForBillingModeCStr(BillingMode value);
 } // namespace BillingModeMapper
 } // namespace Model
 } // namespace DynamoDB
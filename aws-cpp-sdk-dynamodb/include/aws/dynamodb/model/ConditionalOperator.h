@@ -35,6 +35,11 @@ namespace ConditionalOperatorMapper
 AWS_DYNAMODB_API ConditionalOperator GetConditionalOperatorForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForConditionalOperator(ConditionalOperator value);
+
+/**
+ * Same as GetNameForConditionalOperator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForConditionalOperatorCStr(ConditionalOperator value);
 } // namespace ConditionalOperatorMapper
 } // namespace Model
 } // namespace DynamoDB
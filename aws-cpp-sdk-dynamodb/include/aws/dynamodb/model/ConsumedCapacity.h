@@ -28,6 +28,7 @@ namespace Json
 {
   class JsonValue;
   class JsonView;
+  class JsonReader;
 } // namespace Json
 } // namespace Utils
 namespace DynamoDB
@@ -52,6 +53,8 @@ namespace Model
     ConsumedCapacity();
     ConsumedCapacity(Aws::Utils::Json::JsonView jsonValue);
     ConsumedCapacity& operator=(Aws::Utils::Json::JsonView jsonValue);
+    ConsumedCapacity(Aws::Utils::Json::JsonReader& jsonReader);
+    ConsumedCapacity& operator=(Aws::Utils::Json::JsonReader& jsonReader);
     Aws::Utils::Json::JsonValue Jsonize() const;
 
 
@@ -35,6 +35,11 @@ namespace ContinuousBackupsStatusMapper
 AWS_DYNAMODB_API ContinuousBackupsStatus GetContinuousBackupsStatusForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForContinuousBackupsStatus(ContinuousBackupsStatus value);
+
+/**
+ * Same as GetNameForContinuousBackupsStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForContinuousBackupsStatusCStr(ContinuousBackupsStatus value);
 } // namespace ContinuousBackupsStatusMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -37,6 +37,11 @@ namespace GlobalTableStatusMapper
 AWS_DYNAMODB_API GlobalTableStatus GetGlobalTableStatusForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForGlobalTableStatus(GlobalTableStatus value);
+
+/**
+ * Same as GetNameForGlobalTableStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForGlobalTableStatusCStr(GlobalTableStatus value);
 } // namespace GlobalTableStatusMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -37,6 +37,11 @@ namespace IndexStatusMapper
 AWS_DYNAMODB_API IndexStatus GetIndexStatusForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForIndexStatus(IndexStatus value);
+
+/**
+ * Same as GetNameForIndexStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForIndexStatusCStr(IndexStatus value);
 } // namespace IndexStatusMapper
 } // namespace Model
 } // namespace DynamoDB
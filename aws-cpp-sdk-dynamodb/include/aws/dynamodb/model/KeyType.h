@@ -35,6 +35,11 @@ namespace KeyTypeMapper
 AWS_DYNAMODB_API KeyType GetKeyTypeForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForKeyType(KeyType value);
+
+/**
+ * Same as GetNameForKeyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForKeyTypeCStr(KeyType value);
 } // namespace KeyTypeMapper
 } // namespace Model
 } // namespace DynamoDB
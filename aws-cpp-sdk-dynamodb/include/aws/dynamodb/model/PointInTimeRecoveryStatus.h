@@ -35,6 +35,11 @@ namespace PointInTimeRecoveryStatusMapper
 AWS_DYNAMODB_API PointInTimeRecoveryStatus GetPointInTimeRecoveryStatusForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForPointInTimeRecoveryStatus(PointInTimeRecoveryStatus value);
+
+/**
+ * Same as GetNameForPointInTimeRecoveryStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForPointInTimeRecoveryStatusCStr(PointInTimeRecoveryStatus value);
 } // namespace PointInTimeRecoveryStatusMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -36,6 +36,11 @@ namespace ProjectionTypeMapper
 AWS_DYNAMODB_API ProjectionType GetProjectionTypeForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForProjectionType(ProjectionType value);
+
+/**
+ * Same as GetNameForProjectionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForProjectionTypeCStr(ProjectionType value);
 } // namespace ProjectionTypeMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -37,6 +37,11 @@ namespace ReplicaStatusMapper
 AWS_DYNAMODB_API ReplicaStatus GetReplicaStatusForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForReplicaStatus(ReplicaStatus value);
+
+/**
+ * Same as GetNameForReplicaStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForReplicaStatusCStr(ReplicaStatus value);
 } // namespace ReplicaStatusMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -36,6 +36,11 @@ namespace ReturnConsumedCapacityMapper
 AWS_DYNAMODB_API ReturnConsumedCapacity GetReturnConsumedCapacityForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForReturnConsumedCapacity(ReturnConsumedCapacity value);
+
+/**
+ * Same as GetNameForReturnConsumedCapacity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForReturnConsumedCapacityCStr(ReturnConsumedCapacity value);
 } // namespace ReturnConsumedCapacityMapper
 } // namespace Model
 } // namespace DynamoDB
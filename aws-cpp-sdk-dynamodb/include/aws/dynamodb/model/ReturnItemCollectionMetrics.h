@@ -35,6 +35,11 @@ namespace ReturnItemCollectionMetricsMapper
 AWS_DYNAMODB_API ReturnItemCollectionMetrics GetReturnItemCollectionMetricsForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForReturnItemCollectionMetrics(ReturnItemCollectionMetrics value);
+
+/**
+ * Same as GetNameForReturnItemCollectionMetrics(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForReturnItemCollectionMetricsCStr(ReturnItemCollectionMetrics value);
 } // namespace ReturnItemCollectionMetricsMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -38,6 +38,11 @@ namespace ReturnValueMapper
 AWS_DYNAMODB_API ReturnValue GetReturnValueForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForReturnValue(ReturnValue value);
+
+/**
+ * Same as GetNameForReturnValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForReturnValueCStr(ReturnValue value);
 } // namespace ReturnValueMapper
 } // namespace Model
 } // namespace DynamoDB
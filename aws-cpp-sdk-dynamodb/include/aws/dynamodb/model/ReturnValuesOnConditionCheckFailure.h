@@ -35,6 +35,11 @@ namespace ReturnValuesOnConditionCheckFailureMapper
 AWS_DYNAMODB_API ReturnValuesOnConditionCheckFailure GetReturnValuesOnConditionCheckFailureForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForReturnValuesOnConditionCheckFailure(ReturnValuesOnConditionCheckFailure value);
+
+/**
+ * Same as GetNameForReturnValuesOnConditionCheckFailure(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForReturnValuesOnConditionCheckFailureCStr(ReturnValuesOnConditionCheckFailure value);
 } // namespace ReturnValuesOnConditionCheckFailureMapper
 } // namespace Model
 } // namespace DynamoDB
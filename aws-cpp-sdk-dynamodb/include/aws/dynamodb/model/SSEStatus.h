@@ -38,6 +38,11 @@ namespace SSEStatusMapper
 AWS_DYNAMODB_API SSEStatus GetSSEStatusForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForSSEStatus(SSEStatus value);
+
+/**
+ * Same as GetNameForSSEStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForSSEStatusCStr(SSEStatus value);
 } // namespace SSEStatusMapper
 } // namespace Model
 } // namespace DynamoDB
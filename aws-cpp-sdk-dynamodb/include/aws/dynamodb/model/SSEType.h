@@ -35,6 +35,11 @@ namespace SSETypeMapper
 AWS_DYNAMODB_API SSEType GetSSETypeForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForSSEType(SSEType value);
+
+/**
+ * Same as GetNameForSSEType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForSSETypeCStr(SSEType value);
 } // namespace SSETypeMapper
 } // namespace Model
 } // namespace DynamoDB
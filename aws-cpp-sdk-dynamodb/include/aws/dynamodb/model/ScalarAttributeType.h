@@ -36,6 +36,11 @@ namespace ScalarAttributeTypeMapper
 AWS_DYNAMODB_API ScalarAttributeType GetScalarAttributeTypeForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForScalarAttributeType(ScalarAttributeType value);
+
+/**
+ * Same as GetNameForScalarAttributeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForScalarAttributeTypeCStr(ScalarAttributeType value);
 } // namespace ScalarAttributeTypeMapper
 } // namespace Model
 } // namespace DynamoDB
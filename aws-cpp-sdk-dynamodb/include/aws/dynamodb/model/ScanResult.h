@@ -33,6 +33,10 @@ namespace Json
 {
   class JsonValue;
 } // namespace Json
+namespace Stream
+{
+  class ResponseStream;
+} // namespace Stream
 } // namespace Utils
 namespace DynamoDB
 {
@@ -50,6 +54,18 @@ namespace Model
     ScanResult();
     ScanResult(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
     ScanResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Json::JsonValue>& result);
+    ScanResult(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+    ScanResult& operator=(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+
+    /**
+     * Whether the response body this result was read from is well formed JSON.
+     */
+    inline bool WasParseSuccessful() const { return m_parseErrorMessage.empty(); }
+
+    /**
+     * What was wrong with the response body, if WasParseSuccessful() is false.
+     */
+    inline const Aws::String& GetParseErrorMessage() const { return m_parseErrorMessage; }
 
 
     /**
@@ -367,6 +383,8 @@ namespace Model
     Aws::Map<Aws::String, AttributeValue> m_lastEvaluatedKey;
 
     ConsumedCapacity m_consumedCapacity;
+
+    Aws::String m_parseErrorMessage;
   };
 
 } // namespace Model
@@ -37,6 +37,11 @@ namespace SelectMapper
 AWS_DYNAMODB_API Select GetSelectForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForSelect(Select value);
+
+/**
+ * Same as GetNameForSelect(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForSelectCStr(Select value);
 } // namespace SelectMapper
 } // namespace Model
 } // namespace DynamoDB
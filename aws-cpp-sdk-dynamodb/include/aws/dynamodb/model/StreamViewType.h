@@ -37,6 +37,11 @@ namespace StreamViewTypeMapper
 AWS_DYNAMODB_API StreamViewType GetStreamViewTypeForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForStreamViewType(StreamViewType value);
+
+/**
+ * Same as GetNameForStreamViewType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForStreamViewTypeCStr(StreamViewType value);
 } // namespace StreamViewTypeMapper
 } // namespace Model
 } // namespace DynamoDB
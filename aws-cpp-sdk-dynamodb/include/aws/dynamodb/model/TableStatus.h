@@ -37,6 +37,11 @@ namespace TableStatusMapper
 AWS_DYNAMODB_API TableStatus GetTableStatusForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForTableStatus(TableStatus value);
+
+/**
+ * Same as GetNameForTableStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForTableStatusCStr(TableStatus value);
 } // namespace TableStatusMapper
 } // namespace Model
 } // namespace DynamoDB
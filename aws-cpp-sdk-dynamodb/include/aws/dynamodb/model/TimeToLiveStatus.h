@@ -37,6 +37,11 @@ namespace TimeToLiveStatusMapper
 AWS_DYNAMODB_API TimeToLiveStatus GetTimeToLiveStatusForName(const Aws::String& name);
 
 AWS_DYNAMODB_API Aws::String GetNameForTimeToLiveStatus(TimeToLiveStatus value);
+
+/**
+ * Same as GetNameForTimeToLiveStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODB_API const char* GetNameForTimeToLiveStatusCStr(TimeToLiveStatus value);
 } // namespace TimeToLiveStatusMapper
 } // namespace Model
 } // namespace DynamoDB
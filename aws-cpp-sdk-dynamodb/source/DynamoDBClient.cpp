@@ -112,6 +112,7 @@ DynamoDBClient::DynamoDBClient(const std::shared_ptr<AWSCredentialsProvider>& cr
 
 DynamoDBClient::~DynamoDBClient()
 {
+  WaitForPendingRequests();
 }
 
 void DynamoDBClient::init(const ClientConfiguration& config)
@@ -193,6 +194,12 @@ BatchGetItemOutcome DynamoDBClient::BatchGetItem(const BatchGetItemRequest& requ
 
 BatchGetItemOutcomeCallable DynamoDBClient::BatchGetItemCallable(const BatchGetItemRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< BatchGetItemOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::BatchGetItemAsync(request, [outcomePromise](const DynamoDBClient*, const BatchGetItemRequest&, const BatchGetItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< BatchGetItemOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->BatchGetItem(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -201,7 +208,35 @@ BatchGetItemOutcomeCallable DynamoDBClient::BatchGetItemCallable(const BatchGetI
 
 void DynamoDBClient::BatchGetItemAsync(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->BatchGetItemAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->BatchGetItemAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<BatchGetItemRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, BatchGetItemOutcome(BatchGetItemResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, BatchGetItemOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::BatchGetItemAsyncHelper(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -255,6 +290,12 @@ BatchWriteItemOutcome DynamoDBClient::BatchWriteItem(const BatchWriteItemRequest
 
 BatchWriteItemOutcomeCallable DynamoDBClient::BatchWriteItemCallable(const BatchWriteItemRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< BatchWriteItemOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::BatchWriteItemAsync(request, [outcomePromise](const DynamoDBClient*, const BatchWriteItemRequest&, const BatchWriteItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< BatchWriteItemOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->BatchWriteItem(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -263,7 +304,35 @@ BatchWriteItemOutcomeCallable DynamoDBClient::BatchWriteItemCallable(const Batch
 
 void DynamoDBClient::BatchWriteItemAsync(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->BatchWriteItemAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->BatchWriteItemAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<BatchWriteItemRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, BatchWriteItemOutcome(BatchWriteItemResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, BatchWriteItemOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::BatchWriteItemAsyncHelper(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -317,6 +386,12 @@ CreateBackupOutcome DynamoDBClient::CreateBackup(const CreateBackupRequest& requ
 
 CreateBackupOutcomeCallable DynamoDBClient::CreateBackupCallable(const CreateBackupRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< CreateBackupOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::CreateBackupAsync(request, [outcomePromise](const DynamoDBClient*, const CreateBackupRequest&, const CreateBackupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< CreateBackupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateBackup(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -325,7 +400,35 @@ CreateBackupOutcomeCallable DynamoDBClient::CreateBackupCallable(const CreateBac
 
 void DynamoDBClient::CreateBackupAsync(const CreateBackupRequest& request, const CreateBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateBackupAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->CreateBackupAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateBackupRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, CreateBackupOutcome(CreateBackupResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, CreateBackupOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::CreateBackupAsyncHelper(const CreateBackupRequest& request, const CreateBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -379,6 +482,12 @@ CreateGlobalTableOutcome DynamoDBClient::CreateGlobalTable(const CreateGlobalTab
 
 CreateGlobalTableOutcomeCallable DynamoDBClient::CreateGlobalTableCallable(const CreateGlobalTableRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< CreateGlobalTableOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::CreateGlobalTableAsync(request, [outcomePromise](const DynamoDBClient*, const CreateGlobalTableRequest&, const CreateGlobalTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< CreateGlobalTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateGlobalTable(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -387,7 +496,35 @@ CreateGlobalTableOutcomeCallable DynamoDBClient::CreateGlobalTableCallable(const
 
 void DynamoDBClient::CreateGlobalTableAsync(const CreateGlobalTableRequest& request, const CreateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateGlobalTableAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->CreateGlobalTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateGlobalTableRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, CreateGlobalTableOutcome(CreateGlobalTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, CreateGlobalTableOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::CreateGlobalTableAsyncHelper(const CreateGlobalTableRequest& request, const CreateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -441,6 +578,12 @@ CreateTableOutcome DynamoDBClient::CreateTable(const CreateTableRequest& request
 
 CreateTableOutcomeCallable DynamoDBClient::CreateTableCallable(const CreateTableRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< CreateTableOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::CreateTableAsync(request, [outcomePromise](const DynamoDBClient*, const CreateTableRequest&, const CreateTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< CreateTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateTable(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -449,7 +592,35 @@ CreateTableOutcomeCallable DynamoDBClient::CreateTableCallable(const CreateTable
 
 void DynamoDBClient::CreateTableAsync(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->CreateTableAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->CreateTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<CreateTableRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, CreateTableOutcome(CreateTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, CreateTableOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::CreateTableAsyncHelper(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -503,6 +674,12 @@ DeleteBackupOutcome DynamoDBClient::DeleteBackup(const DeleteBackupRequest& requ
 
 DeleteBackupOutcomeCallable DynamoDBClient::DeleteBackupCallable(const DeleteBackupRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< DeleteBackupOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::DeleteBackupAsync(request, [outcomePromise](const DynamoDBClient*, const DeleteBackupRequest&, const DeleteBackupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< DeleteBackupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteBackup(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -511,7 +688,35 @@ DeleteBackupOutcomeCallable DynamoDBClient::DeleteBackupCallable(const DeleteBac
 
 void DynamoDBClient::DeleteBackupAsync(const DeleteBackupRequest& request, const DeleteBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteBackupAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteBackupAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteBackupRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, DeleteBackupOutcome(DeleteBackupResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, DeleteBackupOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::DeleteBackupAsyncHelper(const DeleteBackupRequest& request, const DeleteBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -565,6 +770,12 @@ DeleteItemOutcome DynamoDBClient::DeleteItem(const DeleteItemRequest& request) c
 
 DeleteItemOutcomeCallable DynamoDBClient::DeleteItemCallable(const DeleteItemRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< DeleteItemOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::DeleteItemAsync(request, [outcomePromise](const DynamoDBClient*, const DeleteItemRequest&, const DeleteItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< DeleteItemOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteItem(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -573,7 +784,35 @@ DeleteItemOutcomeCallable DynamoDBClient::DeleteItemCallable(const DeleteItemReq
 
 void DynamoDBClient::DeleteItemAsync(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteItemAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteItemAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteItemRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, DeleteItemOutcome(DeleteItemResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, DeleteItemOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::DeleteItemAsyncHelper(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -627,6 +866,12 @@ DeleteTableOutcome DynamoDBClient::DeleteTable(const DeleteTableRequest& request
 
 DeleteTableOutcomeCallable DynamoDBClient::DeleteTableCallable(const DeleteTableRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< DeleteTableOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::DeleteTableAsync(request, [outcomePromise](const DynamoDBClient*, const DeleteTableRequest&, const DeleteTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< DeleteTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteTable(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -635,7 +880,35 @@ DeleteTableOutcomeCallable DynamoDBClient::DeleteTableCallable(const DeleteTable
 
 void DynamoDBClient::DeleteTableAsync(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DeleteTableAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DeleteTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DeleteTableRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, DeleteTableOutcome(DeleteTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, DeleteTableOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::DeleteTableAsyncHelper(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -689,6 +962,12 @@ DescribeBackupOutcome DynamoDBClient::DescribeBackup(const DescribeBackupRequest
 
 DescribeBackupOutcomeCallable DynamoDBClient::DescribeBackupCallable(const DescribeBackupRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< DescribeBackupOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::DescribeBackupAsync(request, [outcomePromise](const DynamoDBClient*, const DescribeBackupRequest&, const DescribeBackupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< DescribeBackupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeBackup(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -697,7 +976,35 @@ DescribeBackupOutcomeCallable DynamoDBClient::DescribeBackupCallable(const Descr
 
 void DynamoDBClient::DescribeBackupAsync(const DescribeBackupRequest& request, const DescribeBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeBackupAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeBackupAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeBackupRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, DescribeBackupOutcome(DescribeBackupResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, DescribeBackupOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::DescribeBackupAsyncHelper(const DescribeBackupRequest& request, const DescribeBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -751,6 +1058,12 @@ DescribeContinuousBackupsOutcome DynamoDBClient::DescribeContinuousBackups(const
 
 DescribeContinuousBackupsOutcomeCallable DynamoDBClient::DescribeContinuousBackupsCallable(const DescribeContinuousBackupsRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< DescribeContinuousBackupsOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::DescribeContinuousBackupsAsync(request, [outcomePromise](const DynamoDBClient*, const DescribeContinuousBackupsRequest&, const DescribeContinuousBackupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< DescribeContinuousBackupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeContinuousBackups(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -759,7 +1072,35 @@ DescribeContinuousBackupsOutcomeCallable DynamoDBClient::DescribeContinuousBacku
 
 void DynamoDBClient::DescribeContinuousBackupsAsync(const DescribeContinuousBackupsRequest& request, const DescribeContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeContinuousBackupsAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeContinuousBackupsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeContinuousBackupsRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, DescribeContinuousBackupsOutcome(DescribeContinuousBackupsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, DescribeContinuousBackupsOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::DescribeContinuousBackupsAsyncHelper(const DescribeContinuousBackupsRequest& request, const DescribeContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -786,6 +1127,12 @@ DescribeEndpointsOutcome DynamoDBClient::DescribeEndpoints(const DescribeEndpoin
 
 DescribeEndpointsOutcomeCallable DynamoDBClient::DescribeEndpointsCallable(const DescribeEndpointsRequest& request) const
 {
+  if (SupportsAsyncRequests(request))
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< DescribeEndpointsOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::DescribeEndpointsAsync(request, [outcomePromise](const DynamoDBClient*, const DescribeEndpointsRequest&, const DescribeEndpointsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< DescribeEndpointsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeEndpoints(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -794,7 +1141,35 @@ DescribeEndpointsOutcomeCallable DynamoDBClient::DescribeEndpointsCallable(const
 
 void DynamoDBClient::DescribeEndpointsAsync(const DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeEndpointsAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request))
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeEndpointsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeEndpointsRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, DescribeEndpointsOutcome(DescribeEndpointsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, DescribeEndpointsOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::DescribeEndpointsAsyncHelper(const DescribeEndpointsRequest& request, const DescribeEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -848,6 +1223,12 @@ DescribeGlobalTableOutcome DynamoDBClient::DescribeGlobalTable(const DescribeGlo
 
 DescribeGlobalTableOutcomeCallable DynamoDBClient::DescribeGlobalTableCallable(const DescribeGlobalTableRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< DescribeGlobalTableOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::DescribeGlobalTableAsync(request, [outcomePromise](const DynamoDBClient*, const DescribeGlobalTableRequest&, const DescribeGlobalTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< DescribeGlobalTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeGlobalTable(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -856,7 +1237,35 @@ DescribeGlobalTableOutcomeCallable DynamoDBClient::DescribeGlobalTableCallable(c
 
 void DynamoDBClient::DescribeGlobalTableAsync(const DescribeGlobalTableRequest& request, const DescribeGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeGlobalTableAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeGlobalTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeGlobalTableRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, DescribeGlobalTableOutcome(DescribeGlobalTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, DescribeGlobalTableOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::DescribeGlobalTableAsyncHelper(const DescribeGlobalTableRequest& request, const DescribeGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -910,6 +1319,12 @@ DescribeGlobalTableSettingsOutcome DynamoDBClient::DescribeGlobalTableSettings(c
 
 DescribeGlobalTableSettingsOutcomeCallable DynamoDBClient::DescribeGlobalTableSettingsCallable(const DescribeGlobalTableSettingsRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< DescribeGlobalTableSettingsOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::DescribeGlobalTableSettingsAsync(request, [outcomePromise](const DynamoDBClient*, const DescribeGlobalTableSettingsRequest&, const DescribeGlobalTableSettingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< DescribeGlobalTableSettingsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeGlobalTableSettings(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -918,7 +1333,35 @@ DescribeGlobalTableSettingsOutcomeCallable DynamoDBClient::DescribeGlobalTableSe
 
 void DynamoDBClient::DescribeGlobalTableSettingsAsync(const DescribeGlobalTableSettingsRequest& request, const DescribeGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeGlobalTableSettingsAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeGlobalTableSettingsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeGlobalTableSettingsRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, DescribeGlobalTableSettingsOutcome(DescribeGlobalTableSettingsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, DescribeGlobalTableSettingsOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::DescribeGlobalTableSettingsAsyncHelper(const DescribeGlobalTableSettingsRequest& request, const DescribeGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -972,6 +1415,12 @@ DescribeLimitsOutcome DynamoDBClient::DescribeLimits(const DescribeLimitsRequest
 
 DescribeLimitsOutcomeCallable DynamoDBClient::DescribeLimitsCallable(const DescribeLimitsRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< DescribeLimitsOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::DescribeLimitsAsync(request, [outcomePromise](const DynamoDBClient*, const DescribeLimitsRequest&, const DescribeLimitsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< DescribeLimitsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeLimits(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -980,7 +1429,35 @@ DescribeLimitsOutcomeCallable DynamoDBClient::DescribeLimitsCallable(const Descr
 
 void DynamoDBClient::DescribeLimitsAsync(const DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeLimitsAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeLimitsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeLimitsRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, DescribeLimitsOutcome(DescribeLimitsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, DescribeLimitsOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::DescribeLimitsAsyncHelper(const DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1034,6 +1511,12 @@ DescribeTableOutcome DynamoDBClient::DescribeTable(const DescribeTableRequest& r
 
 DescribeTableOutcomeCallable DynamoDBClient::DescribeTableCallable(const DescribeTableRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< DescribeTableOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::DescribeTableAsync(request, [outcomePromise](const DynamoDBClient*, const DescribeTableRequest&, const DescribeTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< DescribeTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeTable(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1042,7 +1525,35 @@ DescribeTableOutcomeCallable DynamoDBClient::DescribeTableCallable(const Describ
 
 void DynamoDBClient::DescribeTableAsync(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeTableAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeTableRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, DescribeTableOutcome(DescribeTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, DescribeTableOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::DescribeTableAsyncHelper(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1096,6 +1607,12 @@ DescribeTimeToLiveOutcome DynamoDBClient::DescribeTimeToLive(const DescribeTimeT
 
 DescribeTimeToLiveOutcomeCallable DynamoDBClient::DescribeTimeToLiveCallable(const DescribeTimeToLiveRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< DescribeTimeToLiveOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::DescribeTimeToLiveAsync(request, [outcomePromise](const DynamoDBClient*, const DescribeTimeToLiveRequest&, const DescribeTimeToLiveOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< DescribeTimeToLiveOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeTimeToLive(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1104,7 +1621,35 @@ DescribeTimeToLiveOutcomeCallable DynamoDBClient::DescribeTimeToLiveCallable(con
 
 void DynamoDBClient::DescribeTimeToLiveAsync(const DescribeTimeToLiveRequest& request, const DescribeTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->DescribeTimeToLiveAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->DescribeTimeToLiveAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<DescribeTimeToLiveRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, DescribeTimeToLiveOutcome(DescribeTimeToLiveResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, DescribeTimeToLiveOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::DescribeTimeToLiveAsyncHelper(const DescribeTimeToLiveRequest& request, const DescribeTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1158,6 +1703,12 @@ GetItemOutcome DynamoDBClient::GetItem(const GetItemRequest& request) const
 
 GetItemOutcomeCallable DynamoDBClient::GetItemCallable(const GetItemRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< GetItemOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::GetItemAsync(request, [outcomePromise](const DynamoDBClient*, const GetItemRequest&, const GetItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< GetItemOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetItem(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1166,7 +1717,35 @@ GetItemOutcomeCallable DynamoDBClient::GetItemCallable(const GetItemRequest& req
 
 void DynamoDBClient::GetItemAsync(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->GetItemAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->GetItemAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<GetItemRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, GetItemOutcome(GetItemResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, GetItemOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::GetItemAsyncHelper(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1220,6 +1799,12 @@ ListBackupsOutcome DynamoDBClient::ListBackups(const ListBackupsRequest& request
 
 ListBackupsOutcomeCallable DynamoDBClient::ListBackupsCallable(const ListBackupsRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< ListBackupsOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::ListBackupsAsync(request, [outcomePromise](const DynamoDBClient*, const ListBackupsRequest&, const ListBackupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< ListBackupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListBackups(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1228,7 +1813,35 @@ ListBackupsOutcomeCallable DynamoDBClient::ListBackupsCallable(const ListBackups
 
 void DynamoDBClient::ListBackupsAsync(const ListBackupsRequest& request, const ListBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListBackupsAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListBackupsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListBackupsRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, ListBackupsOutcome(ListBackupsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, ListBackupsOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::ListBackupsAsyncHelper(const ListBackupsRequest& request, const ListBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1282,6 +1895,12 @@ ListGlobalTablesOutcome DynamoDBClient::ListGlobalTables(const ListGlobalTablesR
 
 ListGlobalTablesOutcomeCallable DynamoDBClient::ListGlobalTablesCallable(const ListGlobalTablesRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< ListGlobalTablesOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::ListGlobalTablesAsync(request, [outcomePromise](const DynamoDBClient*, const ListGlobalTablesRequest&, const ListGlobalTablesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< ListGlobalTablesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListGlobalTables(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1290,7 +1909,35 @@ ListGlobalTablesOutcomeCallable DynamoDBClient::ListGlobalTablesCallable(const L
 
 void DynamoDBClient::ListGlobalTablesAsync(const ListGlobalTablesRequest& request, const ListGlobalTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListGlobalTablesAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListGlobalTablesAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListGlobalTablesRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, ListGlobalTablesOutcome(ListGlobalTablesResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, ListGlobalTablesOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::ListGlobalTablesAsyncHelper(const ListGlobalTablesRequest& request, const ListGlobalTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1344,6 +1991,12 @@ ListTablesOutcome DynamoDBClient::ListTables(const ListTablesRequest& request) c
 
 ListTablesOutcomeCallable DynamoDBClient::ListTablesCallable(const ListTablesRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< ListTablesOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::ListTablesAsync(request, [outcomePromise](const DynamoDBClient*, const ListTablesRequest&, const ListTablesOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< ListTablesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTables(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1352,7 +2005,35 @@ ListTablesOutcomeCallable DynamoDBClient::ListTablesCallable(const ListTablesReq
 
 void DynamoDBClient::ListTablesAsync(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListTablesAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListTablesAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTablesRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, ListTablesOutcome(ListTablesResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, ListTablesOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::ListTablesAsyncHelper(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1406,6 +2087,12 @@ ListTagsOfResourceOutcome DynamoDBClient::ListTagsOfResource(const ListTagsOfRes
 
 ListTagsOfResourceOutcomeCallable DynamoDBClient::ListTagsOfResourceCallable(const ListTagsOfResourceRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< ListTagsOfResourceOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::ListTagsOfResourceAsync(request, [outcomePromise](const DynamoDBClient*, const ListTagsOfResourceRequest&, const ListTagsOfResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< ListTagsOfResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTagsOfResource(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1414,7 +2101,35 @@ ListTagsOfResourceOutcomeCallable DynamoDBClient::ListTagsOfResourceCallable(con
 
 void DynamoDBClient::ListTagsOfResourceAsync(const ListTagsOfResourceRequest& request, const ListTagsOfResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ListTagsOfResourceAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ListTagsOfResourceAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ListTagsOfResourceRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, ListTagsOfResourceOutcome(ListTagsOfResourceResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, ListTagsOfResourceOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::ListTagsOfResourceAsyncHelper(const ListTagsOfResourceRequest& request, const ListTagsOfResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1468,6 +2183,12 @@ PutItemOutcome DynamoDBClient::PutItem(const PutItemRequest& request) const
 
 PutItemOutcomeCallable DynamoDBClient::PutItemCallable(const PutItemRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< PutItemOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::PutItemAsync(request, [outcomePromise](const DynamoDBClient*, const PutItemRequest&, const PutItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< PutItemOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutItem(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1476,7 +2197,35 @@ PutItemOutcomeCallable DynamoDBClient::PutItemCallable(const PutItemRequest& req
 
 void DynamoDBClient::PutItemAsync(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->PutItemAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->PutItemAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<PutItemRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, PutItemOutcome(PutItemResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, PutItemOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::PutItemAsyncHelper(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1517,10 +2266,15 @@ QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
-    return QueryOutcome(QueryResult(outcome.GetResult()));
+    QueryResult result(outcome.GetResultWithOwnership());
+    if(!result.WasParseSuccessful())
+    {
+      return QueryOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", result.GetParseErrorMessage(), false));
+    }
+    return QueryOutcome(std::move(result));
   }
   else
   {
@@ -1530,6 +2284,12 @@ QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
 
 QueryOutcomeCallable DynamoDBClient::QueryCallable(const QueryRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< QueryOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::QueryAsync(request, [outcomePromise](const DynamoDBClient*, const QueryRequest&, const QueryOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< QueryOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->Query(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1538,7 +2298,41 @@ QueryOutcomeCallable DynamoDBClient::QueryCallable(const QueryRequest& request)
 
 void DynamoDBClient::QueryAsync(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->QueryAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->QueryAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<QueryRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      StreamOutcome outcome = BuildStreamOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        QueryResult result(outcome.GetResultWithOwnership());
+        if(!result.WasParseSuccessful())
+        {
+          handler(this, *sharedRequest, QueryOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", result.GetParseErrorMessage(), false)), context);
+          return;
+        }
+        handler(this, *sharedRequest, QueryOutcome(std::move(result)), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, QueryOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::QueryAsyncHelper(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1592,6 +2386,12 @@ RestoreTableFromBackupOutcome DynamoDBClient::RestoreTableFromBackup(const Resto
 
 RestoreTableFromBackupOutcomeCallable DynamoDBClient::RestoreTableFromBackupCallable(const RestoreTableFromBackupRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< RestoreTableFromBackupOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::RestoreTableFromBackupAsync(request, [outcomePromise](const DynamoDBClient*, const RestoreTableFromBackupRequest&, const RestoreTableFromBackupOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< RestoreTableFromBackupOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RestoreTableFromBackup(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1600,7 +2400,35 @@ RestoreTableFromBackupOutcomeCallable DynamoDBClient::RestoreTableFromBackupCall
 
 void DynamoDBClient::RestoreTableFromBackupAsync(const RestoreTableFromBackupRequest& request, const RestoreTableFromBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RestoreTableFromBackupAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->RestoreTableFromBackupAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RestoreTableFromBackupRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, RestoreTableFromBackupOutcome(RestoreTableFromBackupResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, RestoreTableFromBackupOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::RestoreTableFromBackupAsyncHelper(const RestoreTableFromBackupRequest& request, const RestoreTableFromBackupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1654,6 +2482,12 @@ RestoreTableToPointInTimeOutcome DynamoDBClient::RestoreTableToPointInTime(const
 
 RestoreTableToPointInTimeOutcomeCallable DynamoDBClient::RestoreTableToPointInTimeCallable(const RestoreTableToPointInTimeRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< RestoreTableToPointInTimeOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::RestoreTableToPointInTimeAsync(request, [outcomePromise](const DynamoDBClient*, const RestoreTableToPointInTimeRequest&, const RestoreTableToPointInTimeOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< RestoreTableToPointInTimeOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->RestoreTableToPointInTime(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1662,7 +2496,35 @@ RestoreTableToPointInTimeOutcomeCallable DynamoDBClient::RestoreTableToPointInTi
 
 void DynamoDBClient::RestoreTableToPointInTimeAsync(const RestoreTableToPointInTimeRequest& request, const RestoreTableToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->RestoreTableToPointInTimeAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->RestoreTableToPointInTimeAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<RestoreTableToPointInTimeRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, RestoreTableToPointInTimeOutcome(RestoreTableToPointInTimeResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, RestoreTableToPointInTimeOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::RestoreTableToPointInTimeAsyncHelper(const RestoreTableToPointInTimeRequest& request, const RestoreTableToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1703,10 +2565,15 @@ ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
   Aws::StringStream ss;
   ss << "/";
   uri.SetPath(uri.GetPath() + ss.str());
-  JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
-    return ScanOutcome(ScanResult(outcome.GetResult()));
+    ScanResult result(outcome.GetResultWithOwnership());
+    if(!result.WasParseSuccessful())
+    {
+      return ScanOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", result.GetParseErrorMessage(), false));
+    }
+    return ScanOutcome(std::move(result));
   }
   else
   {
@@ -1716,6 +2583,12 @@ ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
 
 ScanOutcomeCallable DynamoDBClient::ScanCallable(const ScanRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< ScanOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::ScanAsync(request, [outcomePromise](const DynamoDBClient*, const ScanRequest&, const ScanOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< ScanOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->Scan(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1724,7 +2597,41 @@ ScanOutcomeCallable DynamoDBClient::ScanCallable(const ScanRequest& request) con
 
 void DynamoDBClient::ScanAsync(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->ScanAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->ScanAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<ScanRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      StreamOutcome outcome = BuildStreamOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        ScanResult result(outcome.GetResultWithOwnership());
+        if(!result.WasParseSuccessful())
+        {
+          handler(this, *sharedRequest, ScanOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", result.GetParseErrorMessage(), false)), context);
+          return;
+        }
+        handler(this, *sharedRequest, ScanOutcome(std::move(result)), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, ScanOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::ScanAsyncHelper(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1778,6 +2685,12 @@ TagResourceOutcome DynamoDBClient::TagResource(const TagResourceRequest& request
 
 TagResourceOutcomeCallable DynamoDBClient::TagResourceCallable(const TagResourceRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< TagResourceOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::TagResourceAsync(request, [outcomePromise](const DynamoDBClient*, const TagResourceRequest&, const TagResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< TagResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TagResource(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1786,7 +2699,35 @@ TagResourceOutcomeCallable DynamoDBClient::TagResourceCallable(const TagResource
 
 void DynamoDBClient::TagResourceAsync(const TagResourceRequest& request, const TagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TagResourceAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->TagResourceAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<TagResourceRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, TagResourceOutcome(NoResult()), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, TagResourceOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::TagResourceAsyncHelper(const TagResourceRequest& request, const TagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1840,6 +2781,12 @@ TransactGetItemsOutcome DynamoDBClient::TransactGetItems(const TransactGetItemsR
 
 TransactGetItemsOutcomeCallable DynamoDBClient::TransactGetItemsCallable(const TransactGetItemsRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< TransactGetItemsOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::TransactGetItemsAsync(request, [outcomePromise](const DynamoDBClient*, const TransactGetItemsRequest&, const TransactGetItemsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< TransactGetItemsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TransactGetItems(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1848,7 +2795,35 @@ TransactGetItemsOutcomeCallable DynamoDBClient::TransactGetItemsCallable(const T
 
 void DynamoDBClient::TransactGetItemsAsync(const TransactGetItemsRequest& request, const TransactGetItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TransactGetItemsAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->TransactGetItemsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<TransactGetItemsRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, TransactGetItemsOutcome(TransactGetItemsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, TransactGetItemsOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::TransactGetItemsAsyncHelper(const TransactGetItemsRequest& request, const TransactGetItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1902,6 +2877,12 @@ TransactWriteItemsOutcome DynamoDBClient::TransactWriteItems(const TransactWrite
 
 TransactWriteItemsOutcomeCallable DynamoDBClient::TransactWriteItemsCallable(const TransactWriteItemsRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< TransactWriteItemsOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::TransactWriteItemsAsync(request, [outcomePromise](const DynamoDBClient*, const TransactWriteItemsRequest&, const TransactWriteItemsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< TransactWriteItemsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->TransactWriteItems(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1910,7 +2891,35 @@ TransactWriteItemsOutcomeCallable DynamoDBClient::TransactWriteItemsCallable(con
 
 void DynamoDBClient::TransactWriteItemsAsync(const TransactWriteItemsRequest& request, const TransactWriteItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->TransactWriteItemsAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->TransactWriteItemsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<TransactWriteItemsRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, TransactWriteItemsOutcome(TransactWriteItemsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, TransactWriteItemsOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::TransactWriteItemsAsyncHelper(const TransactWriteItemsRequest& request, const TransactWriteItemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1964,6 +2973,12 @@ UntagResourceOutcome DynamoDBClient::UntagResource(const UntagResourceRequest& r
 
 UntagResourceOutcomeCallable DynamoDBClient::UntagResourceCallable(const UntagResourceRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< UntagResourceOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::UntagResourceAsync(request, [outcomePromise](const DynamoDBClient*, const UntagResourceRequest&, const UntagResourceOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< UntagResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UntagResource(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -1972,7 +2987,35 @@ UntagResourceOutcomeCallable DynamoDBClient::UntagResourceCallable(const UntagRe
 
 void DynamoDBClient::UntagResourceAsync(const UntagResourceRequest& request, const UntagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UntagResourceAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UntagResourceAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UntagResourceRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, UntagResourceOutcome(NoResult()), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, UntagResourceOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::UntagResourceAsyncHelper(const UntagResourceRequest& request, const UntagResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2026,6 +3069,12 @@ UpdateContinuousBackupsOutcome DynamoDBClient::UpdateContinuousBackups(const Upd
 
 UpdateContinuousBackupsOutcomeCallable DynamoDBClient::UpdateContinuousBackupsCallable(const UpdateContinuousBackupsRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< UpdateContinuousBackupsOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::UpdateContinuousBackupsAsync(request, [outcomePromise](const DynamoDBClient*, const UpdateContinuousBackupsRequest&, const UpdateContinuousBackupsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< UpdateContinuousBackupsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateContinuousBackups(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -2034,7 +3083,35 @@ UpdateContinuousBackupsOutcomeCallable DynamoDBClient::UpdateContinuousBackupsCa
 
 void DynamoDBClient::UpdateContinuousBackupsAsync(const UpdateContinuousBackupsRequest& request, const UpdateContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateContinuousBackupsAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateContinuousBackupsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateContinuousBackupsRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, UpdateContinuousBackupsOutcome(UpdateContinuousBackupsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, UpdateContinuousBackupsOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::UpdateContinuousBackupsAsyncHelper(const UpdateContinuousBackupsRequest& request, const UpdateContinuousBackupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2088,6 +3165,12 @@ UpdateGlobalTableOutcome DynamoDBClient::UpdateGlobalTable(const UpdateGlobalTab
 
 UpdateGlobalTableOutcomeCallable DynamoDBClient::UpdateGlobalTableCallable(const UpdateGlobalTableRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< UpdateGlobalTableOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::UpdateGlobalTableAsync(request, [outcomePromise](const DynamoDBClient*, const UpdateGlobalTableRequest&, const UpdateGlobalTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< UpdateGlobalTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateGlobalTable(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -2096,7 +3179,35 @@ UpdateGlobalTableOutcomeCallable DynamoDBClient::UpdateGlobalTableCallable(const
 
 void DynamoDBClient::UpdateGlobalTableAsync(const UpdateGlobalTableRequest& request, const UpdateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateGlobalTableAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateGlobalTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateGlobalTableRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, UpdateGlobalTableOutcome(UpdateGlobalTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, UpdateGlobalTableOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::UpdateGlobalTableAsyncHelper(const UpdateGlobalTableRequest& request, const UpdateGlobalTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2150,6 +3261,12 @@ UpdateGlobalTableSettingsOutcome DynamoDBClient::UpdateGlobalTableSettings(const
 
 UpdateGlobalTableSettingsOutcomeCallable DynamoDBClient::UpdateGlobalTableSettingsCallable(const UpdateGlobalTableSettingsRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< UpdateGlobalTableSettingsOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::UpdateGlobalTableSettingsAsync(request, [outcomePromise](const DynamoDBClient*, const UpdateGlobalTableSettingsRequest&, const UpdateGlobalTableSettingsOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< UpdateGlobalTableSettingsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateGlobalTableSettings(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -2158,7 +3275,35 @@ UpdateGlobalTableSettingsOutcomeCallable DynamoDBClient::UpdateGlobalTableSettin
 
 void DynamoDBClient::UpdateGlobalTableSettingsAsync(const UpdateGlobalTableSettingsRequest& request, const UpdateGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateGlobalTableSettingsAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateGlobalTableSettingsAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateGlobalTableSettingsRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, UpdateGlobalTableSettingsOutcome(UpdateGlobalTableSettingsResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, UpdateGlobalTableSettingsOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::UpdateGlobalTableSettingsAsyncHelper(const UpdateGlobalTableSettingsRequest& request, const UpdateGlobalTableSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2212,6 +3357,12 @@ UpdateItemOutcome DynamoDBClient::UpdateItem(const UpdateItemRequest& request) c
 
 UpdateItemOutcomeCallable DynamoDBClient::UpdateItemCallable(const UpdateItemRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< UpdateItemOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::UpdateItemAsync(request, [outcomePromise](const DynamoDBClient*, const UpdateItemRequest&, const UpdateItemOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< UpdateItemOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateItem(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -2220,7 +3371,35 @@ UpdateItemOutcomeCallable DynamoDBClient::UpdateItemCallable(const UpdateItemReq
 
 void DynamoDBClient::UpdateItemAsync(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateItemAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateItemAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateItemRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, UpdateItemOutcome(UpdateItemResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, UpdateItemOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::UpdateItemAsyncHelper(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2274,6 +3453,12 @@ UpdateTableOutcome DynamoDBClient::UpdateTable(const UpdateTableRequest& request
 
 UpdateTableOutcomeCallable DynamoDBClient::UpdateTableCallable(const UpdateTableRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< UpdateTableOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::UpdateTableAsync(request, [outcomePromise](const DynamoDBClient*, const UpdateTableRequest&, const UpdateTableOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< UpdateTableOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateTable(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -2282,7 +3467,35 @@ UpdateTableOutcomeCallable DynamoDBClient::UpdateTableCallable(const UpdateTable
 
 void DynamoDBClient::UpdateTableAsync(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateTableAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateTableAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateTableRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, UpdateTableOutcome(UpdateTableResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, UpdateTableOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::UpdateTableAsyncHelper(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2336,6 +3549,12 @@ UpdateTimeToLiveOutcome DynamoDBClient::UpdateTimeToLive(const UpdateTimeToLiveR
 
 UpdateTimeToLiveOutcomeCallable DynamoDBClient::UpdateTimeToLiveCallable(const UpdateTimeToLiveRequest& request) const
 {
+  if (SupportsAsyncRequests(request) && !m_enableEndpointDiscovery)
+  {
+    auto outcomePromise = Aws::MakeShared< std::promise< UpdateTimeToLiveOutcome > >(ALLOCATION_TAG);
+    DynamoDBClient::UpdateTimeToLiveAsync(request, [outcomePromise](const DynamoDBClient*, const UpdateTimeToLiveRequest&, const UpdateTimeToLiveOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) { outcomePromise->set_value(outcome); });
+    return outcomePromise->get_future();
+  }
   auto task = Aws::MakeShared< std::packaged_task< UpdateTimeToLiveOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateTimeToLive(request); } );
   auto packagedFunction = [task]() { (*task)(); };
   m_executor->Submit(packagedFunction);
@@ -2344,7 +3563,35 @@ UpdateTimeToLiveOutcomeCallable DynamoDBClient::UpdateTimeToLiveCallable(const U
 
 void DynamoDBClient::UpdateTimeToLiveAsync(const UpdateTimeToLiveRequest& request, const UpdateTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit( [this, request, handler, context](){ this->UpdateTimeToLiveAsyncHelper( request, handler, context ); } );
+  if (!SupportsAsyncRequests(request) || m_enableEndpointDiscovery)
+  {
+    m_executor->Submit( [this, request, handler, context](){ this->UpdateTimeToLiveAsyncHelper( request, handler, context ); } );
+    return;
+  }
+  // The http client sends the request from its event loop, so no executor thread waits for the response.
+  Aws::Http::URI uri = m_uri;
+  Aws::StringStream ss;
+  ss << "/";
+  uri.SetPath(uri.GetPath() + ss.str());
+  auto sharedRequest = Aws::MakeShared<UpdateTimeToLiveRequest>(ALLOCATION_TAG, request);
+  auto executor = m_executor;
+  AttemptExhaustivelyAsync(uri, sharedRequest, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER, [this, executor, sharedRequest, handler, context](const HttpResponseOutcome& httpOutcome)
+  {
+    // The response is parsed on the executor rather than on the event loop thread, the request counts as pending until it is.
+    auto pendingRequest = TrackPendingRequest();
+    executor->Submit( [this, sharedRequest, handler, context, httpOutcome, pendingRequest]()
+    {
+      JsonOutcome outcome = BuildJsonOutcome(httpOutcome);
+      if(outcome.IsSuccess())
+      {
+        handler(this, *sharedRequest, UpdateTimeToLiveOutcome(UpdateTimeToLiveResult(outcome.GetResult())), context);
+      }
+      else
+      {
+        handler(this, *sharedRequest, UpdateTimeToLiveOutcome(outcome.GetError()), context);
+      }
+    } );
+  });
 }
 
 void DynamoDBClient::UpdateTimeToLiveAsyncHelper(const UpdateTimeToLiveRequest& request, const UpdateTimeToLiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
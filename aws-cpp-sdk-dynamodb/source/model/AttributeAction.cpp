@@ -30,25 +30,44 @@ namespace Aws
       namespace AttributeActionMapper
       {
 
-        static const int ADD_HASH = HashingUtils::HashString("ADD");
-        static const int PUT_HASH = HashingUtils::HashString("PUT");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADD",
+          "PUT",
+          "DELETE",
+        };
 
         AttributeAction GetAttributeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADD_HASH)
-          {
-            return AttributeAction::ADD;
-          }
-          else if (hashCode == PUT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AttributeAction::PUT;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return AttributeAction::DELETE_;
+          case 64641:
+            if (name == "ADD")
+            {
+              return AttributeAction::ADD;
+            }
+            break;
+          case 79599:
+            if (name == "PUT")
+            {
+              return AttributeAction::PUT;
+            }
+            break;
+          case 2012838315:
+            if (name == "DELETE")
+            {
+              return AttributeAction::DELETE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AttributeAction::NOT_SET;
         }
 
-        Aws::String GetNameForAttributeAction(AttributeAction enumValue)
+        const char* GetNameForAttributeActionCStr(AttributeAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AttributeAction::ADD:
-            return "ADD";
-          case AttributeAction::PUT:
-            return "PUT";
-          case AttributeAction::DELETE_:
-            return "DELETE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAttributeAction(AttributeAction enumValue)
+        {
+          return GetNameForAttributeActionCStr(enumValue);
         }
 
       } // namespace AttributeActionMapper
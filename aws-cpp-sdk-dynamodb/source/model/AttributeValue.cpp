@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/AttributeValue.h>
 #include <aws/dynamodb/model/AttributeValueValue.h>
+#include <aws/core/utils/HashingUtils.h>
 
 #include <utility>
 
@@ -350,6 +351,102 @@ AttributeValue& AttributeValue::operator =(JsonView jsonValue)
     return *this;
 }
 
+AttributeValue& AttributeValue::operator =(JsonReader& jsonReader)
+{
+    if (!jsonReader.StartObject())
+    {
+        return *this;
+    }
+
+    while (jsonReader.NextMember())
+    {
+        const Aws::String& memberName = jsonReader.GetMemberName();
+        if (memberName == "S")
+        {
+            m_value = Aws::MakeShared<AttributeValueString>("AttributeValue", jsonReader.ReadString());
+        }
+        else if (memberName == "N")
+        {
+            m_value = Aws::MakeShared<AttributeValueNumeric>("AttributeValue", jsonReader.ReadString());
+        }
+        else if (memberName == "B")
+        {
+            m_value = Aws::MakeShared<AttributeValueByteBuffer>("AttributeValue", HashingUtils::Base64Decode(jsonReader.ReadString()));
+        }
+        else if (memberName == "SS" || memberName == "NS")
+        {
+            bool isStringSet = memberName == "SS";
+            Aws::Vector<Aws::String> set;
+            if (jsonReader.StartArray())
+            {
+                while (jsonReader.NextElement())
+                {
+                    set.push_back(jsonReader.ReadString());
+                }
+            }
+            if (isStringSet)
+            {
+                m_value = Aws::MakeShared<AttributeValueStringSet>("AttributeValue", std::move(set));
+            }
+            else
+            {
+                m_value = Aws::MakeShared<AttributeValueNumberSet>("AttributeValue", std::move(set));
+            }
+        }
+        else if (memberName == "BS")
+        {
+            Aws::Vector<ByteBuffer> bs;
+            if (jsonReader.StartArray())
+            {
+                while (jsonReader.NextElement())
+                {
+                    bs.push_back(HashingUtils::Base64Decode(jsonReader.ReadString()));
+                }
+            }
+            m_value = Aws::MakeShared<AttributeValueByteBufferSet>("AttributeValue", std::move(bs));
+        }
+        else if (memberName == "M")
+        {
+            Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> m;
+            if (jsonReader.StartObject())
+            {
+                while (jsonReader.NextMember())
+                {
+                    Aws::String key = jsonReader.GetMemberName();
+                    m.emplace(std::move(key), Aws::MakeShared<AttributeValue>("AttributeValue", jsonReader));
+                }
+            }
+            m_value = Aws::MakeShared<AttributeValueMap>("AttributeValue", std::move(m));
+        }
+        else if (memberName == "L")
+        {
+            Aws::Vector<std::shared_ptr<AttributeValue>> l;
+            if (jsonReader.StartArray())
+            {
+                while (jsonReader.NextElement())
+                {
+                    l.push_back(Aws::MakeShared<AttributeValue>("AttributeValue", jsonReader));
+                }
+            }
+            m_value = Aws::MakeShared<AttributeValueList>("AttributeValue", std::move(l));
+        }
+        else if (memberName == "BOOL")
+        {
+            m_value = Aws::MakeShared<AttributeValueBool>("AttributeValue", jsonReader.ReadBool());
+        }
+        else if (memberName == "NULL")
+        {
+            m_value = Aws::MakeShared<AttributeValueNull>("AttributeValue", jsonReader.ReadBool());
+        }
+        else
+        {
+            jsonReader.SkipValue();
+        }
+    }
+
+    return *this;
+}
+
 bool AttributeValue::operator ==(const AttributeValue& other) const
 {
     if (this == &other)
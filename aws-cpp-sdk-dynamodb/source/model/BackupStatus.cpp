@@ -30,25 +30,44 @@ namespace Aws
       namespace BackupStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "DELETED",
+          "AVAILABLE",
+        };
 
         BackupStatus GetBackupStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return BackupStatus::CREATING;
-          }
-          else if (hashCode == DELETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BackupStatus::DELETED;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return BackupStatus::AVAILABLE;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return BackupStatus::CREATING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return BackupStatus::DELETED;
+            }
+            break;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return BackupStatus::AVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return BackupStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBackupStatus(BackupStatus enumValue)
+        const char* GetNameForBackupStatusCStr(BackupStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BackupStatus::CREATING:
-            return "CREATING";
-          case BackupStatus::DELETED:
-            return "DELETED";
-          case BackupStatus::AVAILABLE:
-            return "AVAILABLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBackupStatus(BackupStatus enumValue)
+        {
+          return GetNameForBackupStatusCStr(enumValue);
         }
 
       } // namespace BackupStatusMapper
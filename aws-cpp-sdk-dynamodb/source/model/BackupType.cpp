@@ -30,20 +30,37 @@ namespace Aws
       namespace BackupTypeMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USER",
+          "SYSTEM",
+        };
 
         BackupType GetBackupTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
-          {
-            return BackupType::USER;
-          }
-          else if (hashCode == SYSTEM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BackupType::SYSTEM;
+          case 2614219:
+            if (name == "USER")
+            {
+              return BackupType::USER;
+            }
+            break;
+          case -1833998801:
+            if (name == "SYSTEM")
+            {
+              return BackupType::SYSTEM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BackupType::NOT_SET;
         }
 
-        Aws::String GetNameForBackupType(BackupType enumValue)
+        const char* GetNameForBackupTypeCStr(BackupType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BackupType::USER:
-            return "USER";
-          case BackupType::SYSTEM:
-            return "SYSTEM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBackupType(BackupType enumValue)
+        {
+          return GetNameForBackupTypeCStr(enumValue);
         }
 
       } // namespace BackupTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace BackupTypeFilterMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USER",
+          "SYSTEM",
+          "ALL",
+        };
 
         BackupTypeFilter GetBackupTypeFilterForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
-          {
-            return BackupTypeFilter::USER;
-          }
-          else if (hashCode == SYSTEM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BackupTypeFilter::SYSTEM;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return BackupTypeFilter::ALL;
+          case 2614219:
+            if (name == "USER")
+            {
+              return BackupTypeFilter::USER;
+            }
+            break;
+          case -1833998801:
+            if (name == "SYSTEM")
+            {
+              return BackupTypeFilter::SYSTEM;
+            }
+            break;
+          case 64897:
+            if (name == "ALL")
+            {
+              return BackupTypeFilter::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return BackupTypeFilter::NOT_SET;
         }
 
-        Aws::String GetNameForBackupTypeFilter(BackupTypeFilter enumValue)
+        const char* GetNameForBackupTypeFilterCStr(BackupTypeFilter enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BackupTypeFilter::USER:
-            return "USER";
-          case BackupTypeFilter::SYSTEM:
-            return "SYSTEM";
-          case BackupTypeFilter::ALL:
-            return "ALL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBackupTypeFilter(BackupTypeFilter enumValue)
+        {
+          return GetNameForBackupTypeFilterCStr(enumValue);
         }
 
       } // namespace BackupTypeFilterMapper
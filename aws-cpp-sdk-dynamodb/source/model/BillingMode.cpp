@@ -30,20 +30,37 @@ namespace Aws
       namespace BillingModeMapper
       {
 
-        static const int PROVISIONED_HASH = HashingUtils::HashString("PROVISIONED");
-        static const int PAY_PER_REQUEST_HASH = HashingUtils::HashString("PAY_PER_REQUEST");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PROVISIONED",
+          "PAY_PER_REQUEST",
+        };
 
         BillingMode GetBillingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROVISIONED_HASH)
-          {
-            return BillingMode::PROVISIONED;
-          }
-          else if (hashCode == PAY_PER_REQUEST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BillingMode::PAY_PER_REQUEST;
+          case 355751956:
+            if (name == "PROVISIONED")
+            {
+              return BillingMode::PROVISIONED;
+            }
+            break;
+          case 171185142:
+            if (name == "PAY_PER_REQUEST")
+            {
+              return BillingMode::PAY_PER_REQUEST;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BillingMode::NOT_SET;
         }
 
-        Aws::String GetNameForBillingMode(BillingMode enumValue)
+        const char* GetNameForBillingModeCStr(BillingMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BillingMode::PROVISIONED:
-            return "PROVISIONED";
-          case BillingMode::PAY_PER_REQUEST:
-            return "PAY_PER_REQUEST";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBillingMode(BillingMode enumValue)
+        {
+          return GetNameForBillingModeCStr(enumValue);
         }
 
       } // namespace BillingModeMapper
@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/Capacity.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -75,6 +76,49 @@ Capacity& Capacity::operator =(JsonView jsonValue)
   return *this;
 }
 
+Capacity::Capacity(JsonReader& jsonReader) : 
+    m_readCapacityUnits(0.0),
+    m_readCapacityUnitsHasBeenSet(false),
+    m_writeCapacityUnits(0.0),
+    m_writeCapacityUnitsHasBeenSet(false),
+    m_capacityUnits(0.0),
+    m_capacityUnitsHasBeenSet(false)
+{
+  *this = jsonReader;
+}
+
+Capacity& Capacity::operator =(JsonReader& jsonReader)
+{
+  if(jsonReader.StartObject())
+  {
+    while(jsonReader.NextMember())
+    {
+      const Aws::String& memberName = jsonReader.GetMemberName();
+      if(memberName == "ReadCapacityUnits")
+      {
+        m_readCapacityUnits = jsonReader.ReadDouble();
+        m_readCapacityUnitsHasBeenSet = true;
+      }
+      else if(memberName == "WriteCapacityUnits")
+      {
+        m_writeCapacityUnits = jsonReader.ReadDouble();
+        m_writeCapacityUnitsHasBeenSet = true;
+      }
+      else if(memberName == "CapacityUnits")
+      {
+        m_capacityUnits = jsonReader.ReadDouble();
+        m_capacityUnitsHasBeenSet = true;
+      }
+      else
+      {
+        jsonReader.SkipValue();
+      }
+    }
+  }
+
+  return *this;
+}
+
 JsonValue Capacity::Jsonize() const
 {
   JsonValue payload;
@@ -30,75 +30,114 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int EQ_HASH = HashingUtils::HashString("EQ");
-        static const int NE_HASH = HashingUtils::HashString("NE");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int LE_HASH = HashingUtils::HashString("LE");
-        static const int LT_HASH = HashingUtils::HashString("LT");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int GT_HASH = HashingUtils::HashString("GT");
-        static const int BETWEEN_HASH = HashingUtils::HashString("BETWEEN");
-        static const int NOT_NULL_HASH = HashingUtils::HashString("NOT_NULL");
-        static const int NULL__HASH = HashingUtils::HashString("NULL");
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
-        static const int NOT_CONTAINS_HASH = HashingUtils::HashString("NOT_CONTAINS");
-        static const int BEGINS_WITH_HASH = HashingUtils::HashString("BEGINS_WITH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EQ",
+          "NE",
+          "IN",
+          "LE",
+          "LT",
+          "GE",
+          "GT",
+          "BETWEEN",
+          "NOT_NULL",
+          "NULL",
+          "CONTAINS",
+          "NOT_CONTAINS",
+          "BEGINS_WITH",
+        };
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQ_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComparisonOperator::EQ;
-          }
-          else if (hashCode == NE_HASH)
-          {
-            return ComparisonOperator::NE;
-          }
-          else if (hashCode == IN_HASH)
-          {
-            return ComparisonOperator::IN;
-          }
-          else if (hashCode == LE_HASH)
-          {
-            return ComparisonOperator::LE;
-          }
-          else if (hashCode == LT_HASH)
-          {
-            return ComparisonOperator::LT;
-          }
-          else if (hashCode == GE_HASH)
-          {
-            return ComparisonOperator::GE;
-          }
-          else if (hashCode == GT_HASH)
-          {
-            return ComparisonOperator::GT;
-          }
-          else if (hashCode == BETWEEN_HASH)
-          {
-            return ComparisonOperator::BETWEEN;
-          }
-          else if (hashCode == NOT_NULL_HASH)
-          {
-            return ComparisonOperator::NOT_NULL;
-          }
-          else if (hashCode == NULL__HASH)
-          {
-            return ComparisonOperator::NULL_;
-          }
-          else if (hashCode == CONTAINS_HASH)
-          {
-            return ComparisonOperator::CONTAINS;
-          }
-          else if (hashCode == NOT_CONTAINS_HASH)
-          {
-            return ComparisonOperator::NOT_CONTAINS;
-          }
-          else if (hashCode == BEGINS_WITH_HASH)
-          {
-            return ComparisonOperator::BEGINS_WITH;
+          case 2220:
+            if (name == "EQ")
+            {
+              return ComparisonOperator::EQ;
+            }
+            break;
+          case 2487:
+            if (name == "NE")
+            {
+              return ComparisonOperator::NE;
+            }
+            break;
+          case 2341:
+            if (name == "IN")
+            {
+              return ComparisonOperator::IN;
+            }
+            break;
+          case 2425:
+            if (name == "LE")
+            {
+              return ComparisonOperator::LE;
+            }
+            break;
+          case 2440:
+            if (name == "LT")
+            {
+              return ComparisonOperator::LT;
+            }
+            break;
+          case 2270:
+            if (name == "GE")
+            {
+              return ComparisonOperator::GE;
+            }
+            break;
+          case 2285:
+            if (name == "GT")
+            {
+              return ComparisonOperator::GT;
+            }
+            break;
+          case 501348328:
+            if (name == "BETWEEN")
+            {
+              return ComparisonOperator::BETWEEN;
+            }
+            break;
+          case -1906409581:
+            if (name == "NOT_NULL")
+            {
+              return ComparisonOperator::NOT_NULL;
+            }
+            break;
+          case 2407815:
+            if (name == "NULL")
+            {
+              return ComparisonOperator::NULL_;
+            }
+            break;
+          case 215180831:
+            if (name == "CONTAINS")
+            {
+              return ComparisonOperator::CONTAINS;
+            }
+            break;
+          case -2063252949:
+            if (name == "NOT_CONTAINS")
+            {
+              return ComparisonOperator::NOT_CONTAINS;
+            }
+            break;
+          case -1440886021:
+            if (name == "BEGINS_WITH")
+            {
+              return ComparisonOperator::BEGINS_WITH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,45 +149,26 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperatorCStr(ComparisonOperator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComparisonOperator::EQ:
-            return "EQ";
-          case ComparisonOperator::NE:
-            return "NE";
-          case ComparisonOperator::IN:
-            return "IN";
-          case ComparisonOperator::LE:
-            return "LE";
-          case ComparisonOperator::LT:
-            return "LT";
-          case ComparisonOperator::GE:
-            return "GE";
-          case ComparisonOperator::GT:
-            return "GT";
-          case ComparisonOperator::BETWEEN:
-            return "BETWEEN";
-          case ComparisonOperator::NOT_NULL:
-            return "NOT_NULL";
-          case ComparisonOperator::NULL_:
-            return "NULL";
-          case ComparisonOperator::CONTAINS:
-            return "CONTAINS";
-          case ComparisonOperator::NOT_CONTAINS:
-            return "NOT_CONTAINS";
-          case ComparisonOperator::BEGINS_WITH:
-            return "BEGINS_WITH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        {
+          return GetNameForComparisonOperatorCStr(enumValue);
         }
 
       } // namespace ComparisonOperatorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ConditionalOperatorMapper
       {
 
-        static const int AND_HASH = HashingUtils::HashString("AND");
-        static const int OR_HASH = HashingUtils::HashString("OR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AND",
+          "OR",
+        };
 
         ConditionalOperator GetConditionalOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AND_HASH)
-          {
-            return ConditionalOperator::AND;
-          }
-          else if (hashCode == OR_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConditionalOperator::OR;
+          case 64951:
+            if (name == "AND")
+            {
+              return ConditionalOperator::AND;
+            }
+            break;
+          case 2531:
+            if (name == "OR")
+            {
+              return ConditionalOperator::OR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ConditionalOperator::NOT_SET;
         }
 
-        Aws::String GetNameForConditionalOperator(ConditionalOperator enumValue)
+        const char* GetNameForConditionalOperatorCStr(ConditionalOperator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConditionalOperator::AND:
-            return "AND";
-          case ConditionalOperator::OR:
-            return "OR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConditionalOperator(ConditionalOperator enumValue)
+        {
+          return GetNameForConditionalOperatorCStr(enumValue);
         }
 
       } // namespace ConditionalOperatorMapper
@@ -15,6 +15,7 @@
 
 #include <aws/dynamodb/model/ConsumedCapacity.h>
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/json/JsonReader.h>
 
 #include <utility>
 
@@ -117,6 +118,87 @@ ConsumedCapacity& ConsumedCapacity::operator =(JsonView jsonValue)
   return *this;
 }
 
+ConsumedCapacity::ConsumedCapacity(JsonReader& jsonReader) : 
+    m_tableNameHasBeenSet(false),
+    m_capacityUnits(0.0),
+    m_capacityUnitsHasBeenSet(false),
+    m_readCapacityUnits(0.0),
+    m_readCapacityUnitsHasBeenSet(false),
+    m_writeCapacityUnits(0.0),
+    m_writeCapacityUnitsHasBeenSet(false),
+    m_tableHasBeenSet(false),
+    m_localSecondaryIndexesHasBeenSet(false),
+    m_globalSecondaryIndexesHasBeenSet(false)
+{
+  *this = jsonReader;
+}
+
+ConsumedCapacity& ConsumedCapacity::operator =(JsonReader& jsonReader)
+{
+  if(jsonReader.StartObject())
+  {
+    while(jsonReader.NextMember())
+    {
+      const Aws::String& memberName = jsonReader.GetMemberName();
+      if(memberName == "TableName")
+      {
+        m_tableName = jsonReader.ReadString();
+        m_tableNameHasBeenSet = true;
+      }
+      else if(memberName == "CapacityUnits")
+      {
+        m_capacityUnits = jsonReader.ReadDouble();
+        m_capacityUnitsHasBeenSet = true;
+      }
+      else if(memberName == "ReadCapacityUnits")
+      {
+        m_readCapacityUnits = jsonReader.ReadDouble();
+        m_readCapacityUnitsHasBeenSet = true;
+      }
+      else if(memberName == "WriteCapacityUnits")
+      {
+        m_writeCapacityUnits = jsonReader.ReadDouble();
+        m_writeCapacityUnitsHasBeenSet = true;
+      }
+      else if(memberName == "Table")
+      {
+        m_table = jsonReader;
+        m_tableHasBeenSet = true;
+      }
+      else if(memberName == "LocalSecondaryIndexes")
+      {
+        if(jsonReader.StartObject())
+        {
+          while(jsonReader.NextMember())
+          {
+            Aws::String localSecondaryIndexesKey = jsonReader.GetMemberName();
+            m_localSecondaryIndexes[std::move(localSecondaryIndexesKey)] = jsonReader;
+          }
+        }
+        m_localSecondaryIndexesHasBeenSet = true;
+      }
+      else if(memberName == "GlobalSecondaryIndexes")
+      {
+        if(jsonReader.StartObject())
+        {
+          while(jsonReader.NextMember())
+          {
+            Aws::String globalSecondaryIndexesKey = jsonReader.GetMemberName();
+            m_globalSecondaryIndexes[std::move(globalSecondaryIndexesKey)] = jsonReader;
+          }
+        }
+        m_globalSecondaryIndexesHasBeenSet = true;
+      }
+      else
+      {
+        jsonReader.SkipValue();
+      }
+    }
+  }
+
+  return *this;
+}
+
 JsonValue ConsumedCapacity::Jsonize() const
 {
   JsonValue payload;
@@ -30,30 +30,51 @@ namespace Aws
       namespace GlobalTableStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "ACTIVE",
+          "DELETING",
+          "UPDATING",
+        };
 
         GlobalTableStatus GetGlobalTableStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return GlobalTableStatus::CREATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return GlobalTableStatus::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return GlobalTableStatus::DELETING;
-          }
-          else if (hashCode == UPDATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GlobalTableStatus::UPDATING;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return GlobalTableStatus::CREATING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return GlobalTableStatus::ACTIVE;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return GlobalTableStatus::DELETING;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return GlobalTableStatus::UPDATING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return GlobalTableStatus::NOT_SET;
         }
 
-        Aws::String GetNameForGlobalTableStatus(GlobalTableStatus enumValue)
+        const char* GetNameForGlobalTableStatusCStr(GlobalTableStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GlobalTableStatus::CREATING:
-            return "CREATING";
-          case GlobalTableStatus::ACTIVE:
-            return "ACTIVE";
-          case GlobalTableStatus::DELETING:
-            return "DELETING";
-          case GlobalTableStatus::UPDATING:
-            return "UPDATING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGlobalTableStatus(GlobalTableStatus enumValue)
+        {
+          return GetNameForGlobalTableStatusCStr(enumValue);
         }
 
       } // namespace GlobalTableStatusMapper
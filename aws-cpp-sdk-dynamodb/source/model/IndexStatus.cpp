@@ -30,30 +30,51 @@ namespace Aws
       namespace IndexStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "UPDATING",
+          "DELETING",
+          "ACTIVE",
+        };
 
         IndexStatus GetIndexStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return IndexStatus::CREATING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return IndexStatus::UPDATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return IndexStatus::DELETING;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IndexStatus::ACTIVE;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return IndexStatus::CREATING;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return IndexStatus::UPDATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return IndexStatus::DELETING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return IndexStatus::ACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return IndexStatus::NOT_SET;
         }
 
-        Aws::String GetNameForIndexStatus(IndexStatus enumValue)
+        const char* GetNameForIndexStatusCStr(IndexStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IndexStatus::CREATING:
-            return "CREATING";
-          case IndexStatus::UPDATING:
-            return "UPDATING";
-          case IndexStatus::DELETING:
-            return "DELETING";
-          case IndexStatus::ACTIVE:
-            return "ACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIndexStatus(IndexStatus enumValue)
+        {
+          return GetNameForIndexStatusCStr(enumValue);
         }
 
       } // namespace IndexStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace KeyTypeMapper
       {
 
-        static const int HASH_HASH = HashingUtils::HashString("HASH");
-        static const int RANGE_HASH = HashingUtils::HashString("RANGE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HASH",
+          "RANGE",
+        };
 
         KeyType GetKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HASH_HASH)
-          {
-            return KeyType::HASH;
-          }
-          else if (hashCode == RANGE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return KeyType::RANGE;
+          case 2210062:
+            if (name == "HASH")
+            {
+              return KeyType::HASH;
+            }
+            break;
+          case 77742365:
+            if (name == "RANGE")
+            {
+              return KeyType::RANGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return KeyType::NOT_SET;
         }
 
-        Aws::String GetNameForKeyType(KeyType enumValue)
+        const char* GetNameForKeyTypeCStr(KeyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case KeyType::HASH:
-            return "HASH";
-          case KeyType::RANGE:
-            return "RANGE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForKeyType(KeyType enumValue)
+        {
+          return GetNameForKeyTypeCStr(enumValue);
         }
 
       } // namespace KeyTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ProjectionTypeMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int KEYS_ONLY_HASH = HashingUtils::HashString("KEYS_ONLY");
-        static const int INCLUDE_HASH = HashingUtils::HashString("INCLUDE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALL",
+          "KEYS_ONLY",
+          "INCLUDE",
+        };
 
         ProjectionType GetProjectionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
-          {
-            return ProjectionType::ALL;
-          }
-          else if (hashCode == KEYS_ONLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProjectionType::KEYS_ONLY;
-          }
-          else if (hashCode == INCLUDE_HASH)
-          {
-            return ProjectionType::INCLUDE;
+          case 64897:
+            if (name == "ALL")
+            {
+              return ProjectionType::ALL;
+            }
+            break;
+          case 1724531479:
+            if (name == "KEYS_ONLY")
+            {
+              return ProjectionType::KEYS_ONLY;
+            }
+            break;
+          case -1634410360:
+            if (name == "INCLUDE")
+            {
+              return ProjectionType::INCLUDE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ProjectionType::NOT_SET;
         }
 
-        Aws::String GetNameForProjectionType(ProjectionType enumValue)
+        const char* GetNameForProjectionTypeCStr(ProjectionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProjectionType::ALL:
-            return "ALL";
-          case ProjectionType::KEYS_ONLY:
-            return "KEYS_ONLY";
-          case ProjectionType::INCLUDE:
-            return "INCLUDE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProjectionType(ProjectionType enumValue)
+        {
+          return GetNameForProjectionTypeCStr(enumValue);
         }
 
       } // namespace ProjectionTypeMapper
@@ -18,11 +18,14 @@
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
+#include <aws/core/utils/json/JsonReader.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 
 #include <utility>
 
 using namespace Aws::DynamoDB::Model;
 using namespace Aws::Utils::Json;
+using namespace Aws::Utils::Stream;
 using namespace Aws::Utils;
 using namespace Aws;
 
@@ -86,5 +89,74 @@ QueryResult& QueryResult::operator =(const Aws::AmazonWebServiceResult<JsonValue
 
 
 
+  return *this;
+}
+
+QueryResult::QueryResult(Aws::AmazonWebServiceResult<ResponseStream>&& result) : 
+    m_count(0),
+    m_scannedCount(0)
+{
+  *this = std::move(result);
+}
+
+QueryResult& QueryResult::operator =(Aws::AmazonWebServiceResult<ResponseStream>&& result)
+{
+  JsonReader jsonReader(result.GetPayload().GetUnderlyingStream());
+  if(jsonReader.StartObject())
+  {
+    while(jsonReader.NextMember())
+    {
+      const Aws::String& memberName = jsonReader.GetMemberName();
+      if(memberName == "Items")
+      {
+        if(jsonReader.StartArray())
+        {
+          while(jsonReader.NextElement())
+          {
+            Aws::Map<Aws::String, AttributeValue> attributeMapMap;
+            if(jsonReader.StartObject())
+            {
+              while(jsonReader.NextMember())
+              {
+                Aws::String attributeMapKey = jsonReader.GetMemberName();
+                attributeMapMap[std::move(attributeMapKey)] = jsonReader;
+              }
+            }
+            m_items.push_back(std::move(attributeMapMap));
+          }
+        }
+      }
+      else if(memberName == "Count")
+      {
+        m_count = jsonReader.ReadInteger();
+      }
+      else if(memberName == "ScannedCount")
+      {
+        m_scannedCount = jsonReader.ReadInteger();
+      }
+      else if(memberName == "LastEvaluatedKey")
+      {
+        if(jsonReader.StartObject())
+        {
+          while(jsonReader.NextMember())
+          {
+            Aws::String lastEvaluatedKeyKey = jsonReader.GetMemberName();
+            m_lastEvaluatedKey[std::move(lastEvaluatedKeyKey)] = jsonReader;
+          }
+        }
+      }
+      else if(memberName == "ConsumedCapacity")
+      {
+        m_consumedCapacity = jsonReader;
+      }
+      else
+      {
+        jsonReader.SkipValue();
+      }
+    }
+  }
+
+  m_parseErrorMessage = jsonReader.WasParseSuccessful() ? "" : jsonReader.GetErrorMessage();
+
   return *this;
 }
@@ -30,25 +30,44 @@ namespace Aws
       namespace ReturnConsumedCapacityMapper
       {
 
-        static const int INDEXES_HASH = HashingUtils::HashString("INDEXES");
-        static const int TOTAL_HASH = HashingUtils::HashString("TOTAL");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INDEXES",
+          "TOTAL",
+          "NONE",
+        };
 
         ReturnConsumedCapacity GetReturnConsumedCapacityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INDEXES_HASH)
-          {
-            return ReturnConsumedCapacity::INDEXES;
-          }
-          else if (hashCode == TOTAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReturnConsumedCapacity::TOTAL;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return ReturnConsumedCapacity::NONE;
+          case -1633692448:
+            if (name == "INDEXES")
+            {
+              return ReturnConsumedCapacity::INDEXES;
+            }
+            break;
+          case 80012068:
+            if (name == "TOTAL")
+            {
+              return ReturnConsumedCapacity::TOTAL;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return ReturnConsumedCapacity::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ReturnConsumedCapacity::NOT_SET;
         }
 
-        Aws::String GetNameForReturnConsumedCapacity(ReturnConsumedCapacity enumValue)
+        const char* GetNameForReturnConsumedCapacityCStr(ReturnConsumedCapacity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReturnConsumedCapacity::INDEXES:
-            return "INDEXES";
-          case ReturnConsumedCapacity::TOTAL:
-            return "TOTAL";
-          case ReturnConsumedCapacity::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReturnConsumedCapacity(ReturnConsumedCapacity enumValue)
+        {
+          return GetNameForReturnConsumedCapacityCStr(enumValue);
         }
 
       } // namespace ReturnConsumedCapacityMapper
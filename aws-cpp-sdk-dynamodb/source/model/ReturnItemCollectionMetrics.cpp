@@ -30,20 +30,37 @@ namespace Aws
       namespace ReturnItemCollectionMetricsMapper
       {
 
-        static const int SIZE_HASH = HashingUtils::HashString("SIZE");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SIZE",
+          "NONE",
+        };
 
         ReturnItemCollectionMetrics GetReturnItemCollectionMetricsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIZE_HASH)
-          {
-            return ReturnItemCollectionMetrics::SIZE;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReturnItemCollectionMetrics::NONE;
+          case 2545665:
+            if (name == "SIZE")
+            {
+              return ReturnItemCollectionMetrics::SIZE;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return ReturnItemCollectionMetrics::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReturnItemCollectionMetrics::NOT_SET;
         }
 
-        Aws::String GetNameForReturnItemCollectionMetrics(ReturnItemCollectionMetrics enumValue)
+        const char* GetNameForReturnItemCollectionMetricsCStr(ReturnItemCollectionMetrics enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReturnItemCollectionMetrics::SIZE:
-            return "SIZE";
-          case ReturnItemCollectionMetrics::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReturnItemCollectionMetrics(ReturnItemCollectionMetrics enumValue)
+        {
+          return GetNameForReturnItemCollectionMetricsCStr(enumValue);
         }
 
       } // namespace ReturnItemCollectionMetricsMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ReturnValueMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int ALL_OLD_HASH = HashingUtils::HashString("ALL_OLD");
-        static const int UPDATED_OLD_HASH = HashingUtils::HashString("UPDATED_OLD");
-        static const int ALL_NEW_HASH = HashingUtils::HashString("ALL_NEW");
-        static const int UPDATED_NEW_HASH = HashingUtils::HashString("UPDATED_NEW");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "ALL_OLD",
+          "UPDATED_OLD",
+          "ALL_NEW",
+          "UPDATED_NEW",
+        };
 
         ReturnValue GetReturnValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReturnValue::NONE;
-          }
-          else if (hashCode == ALL_OLD_HASH)
-          {
-            return ReturnValue::ALL_OLD;
-          }
-          else if (hashCode == UPDATED_OLD_HASH)
-          {
-            return ReturnValue::UPDATED_OLD;
-          }
-          else if (hashCode == ALL_NEW_HASH)
-          {
-            return ReturnValue::ALL_NEW;
-          }
-          else if (hashCode == UPDATED_NEW_HASH)
-          {
-            return ReturnValue::UPDATED_NEW;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return ReturnValue::NONE;
+            }
+            break;
+          case -192891319:
+            if (name == "ALL_OLD")
+            {
+              return ReturnValue::ALL_OLD;
+            }
+            break;
+          case 1584466019:
+            if (name == "UPDATED_OLD")
+            {
+              return ReturnValue::UPDATED_OLD;
+            }
+            break;
+          case -192892478:
+            if (name == "ALL_NEW")
+            {
+              return ReturnValue::ALL_NEW;
+            }
+            break;
+          case 1584464860:
+            if (name == "UPDATED_NEW")
+            {
+              return ReturnValue::UPDATED_NEW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ReturnValue::NOT_SET;
         }
 
-        Aws::String GetNameForReturnValue(ReturnValue enumValue)
+        const char* GetNameForReturnValueCStr(ReturnValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReturnValue::NONE:
-            return "NONE";
-          case ReturnValue::ALL_OLD:
-            return "ALL_OLD";
-          case ReturnValue::UPDATED_OLD:
-            return "UPDATED_OLD";
-          case ReturnValue::ALL_NEW:
-            return "ALL_NEW";
-          case ReturnValue::UPDATED_NEW:
-            return "UPDATED_NEW";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReturnValue(ReturnValue enumValue)
+        {
+          return GetNameForReturnValueCStr(enumValue);
         }
 
       } // namespace ReturnValueMapper
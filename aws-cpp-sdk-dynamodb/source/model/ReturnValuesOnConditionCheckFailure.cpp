@@ -30,20 +30,37 @@ namespace Aws
       namespace ReturnValuesOnConditionCheckFailureMapper
       {
 
-        static const int ALL_OLD_HASH = HashingUtils::HashString("ALL_OLD");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALL_OLD",
+          "NONE",
+        };
 
         ReturnValuesOnConditionCheckFailure GetReturnValuesOnConditionCheckFailureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_OLD_HASH)
-          {
-            return ReturnValuesOnConditionCheckFailure::ALL_OLD;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReturnValuesOnConditionCheckFailure::NONE;
+          case -192891319:
+            if (name == "ALL_OLD")
+            {
+              return ReturnValuesOnConditionCheckFailure::ALL_OLD;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return ReturnValuesOnConditionCheckFailure::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReturnValuesOnConditionCheckFailure::NOT_SET;
         }
 
-        Aws::String GetNameForReturnValuesOnConditionCheckFailure(ReturnValuesOnConditionCheckFailure enumValue)
+        const char* GetNameForReturnValuesOnConditionCheckFailureCStr(ReturnValuesOnConditionCheckFailure enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReturnValuesOnConditionCheckFailure::ALL_OLD:
-            return "ALL_OLD";
-          case ReturnValuesOnConditionCheckFailure::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReturnValuesOnConditionCheckFailure(ReturnValuesOnConditionCheckFailure enumValue)
+        {
+          return GetNameForReturnValuesOnConditionCheckFailureCStr(enumValue);
         }
 
       } // namespace ReturnValuesOnConditionCheckFailureMapper
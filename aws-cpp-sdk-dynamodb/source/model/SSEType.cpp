@@ -30,20 +30,37 @@ namespace Aws
       namespace SSETypeMapper
       {
 
-        static const int AES256_HASH = HashingUtils::HashString("AES256");
-        static const int KMS_HASH = HashingUtils::HashString("KMS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AES256",
+          "KMS",
+        };
 
         SSEType GetSSETypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES256_HASH)
-          {
-            return SSEType::AES256;
-          }
-          else if (hashCode == KMS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SSEType::KMS;
+          case 1927140164:
+            if (name == "AES256")
+            {
+              return SSEType::AES256;
+            }
+            break;
+          case 74545:
+            if (name == "KMS")
+            {
+              return SSEType::KMS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SSEType::NOT_SET;
         }
 
-        Aws::String GetNameForSSEType(SSEType enumValue)
+        const char* GetNameForSSETypeCStr(SSEType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SSEType::AES256:
-            return "AES256";
-          case SSEType::KMS:
-            return "KMS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSSEType(SSEType enumValue)
+        {
+          return GetNameForSSETypeCStr(enumValue);
         }
 
       } // namespace SSETypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ScalarAttributeTypeMapper
       {
 
-        static const int S_HASH = HashingUtils::HashString("S");
-        static const int N_HASH = HashingUtils::HashString("N");
-        static const int B_HASH = HashingUtils::HashString("B");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "S",
+          "N",
+          "B",
+        };
 
         ScalarAttributeType GetScalarAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == S_HASH)
-          {
-            return ScalarAttributeType::S;
-          }
-          else if (hashCode == N_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalarAttributeType::N;
-          }
-          else if (hashCode == B_HASH)
-          {
-            return ScalarAttributeType::B;
+          case 83:
+            if (name == "S")
+            {
+              return ScalarAttributeType::S;
+            }
+            break;
+          case 78:
+            if (name == "N")
+            {
+              return ScalarAttributeType::N;
+            }
+            break;
+          case 66:
+            if (name == "B")
+            {
+              return ScalarAttributeType::B;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ScalarAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForScalarAttributeType(ScalarAttributeType enumValue)
+        const char* GetNameForScalarAttributeTypeCStr(ScalarAttributeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalarAttributeType::S:
-            return "S";
-          case ScalarAttributeType::N:
-            return "N";
-          case ScalarAttributeType::B:
-            return "B";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalarAttributeType(ScalarAttributeType enumValue)
+        {
+          return GetNameForScalarAttributeTypeCStr(enumValue);
         }
 
       } // namespace ScalarAttributeTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace SelectMapper
       {
 
-        static const int ALL_ATTRIBUTES_HASH = HashingUtils::HashString("ALL_ATTRIBUTES");
-        static const int ALL_PROJECTED_ATTRIBUTES_HASH = HashingUtils::HashString("ALL_PROJECTED_ATTRIBUTES");
-        static const int SPECIFIC_ATTRIBUTES_HASH = HashingUtils::HashString("SPECIFIC_ATTRIBUTES");
-        static const int COUNT_HASH = HashingUtils::HashString("COUNT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALL_ATTRIBUTES",
+          "ALL_PROJECTED_ATTRIBUTES",
+          "SPECIFIC_ATTRIBUTES",
+          "COUNT",
+        };
 
         Select GetSelectForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_ATTRIBUTES_HASH)
-          {
-            return Select::ALL_ATTRIBUTES;
-          }
-          else if (hashCode == ALL_PROJECTED_ATTRIBUTES_HASH)
-          {
-            return Select::ALL_PROJECTED_ATTRIBUTES;
-          }
-          else if (hashCode == SPECIFIC_ATTRIBUTES_HASH)
-          {
-            return Select::SPECIFIC_ATTRIBUTES;
-          }
-          else if (hashCode == COUNT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Select::COUNT;
+          case -420928811:
+            if (name == "ALL_ATTRIBUTES")
+            {
+              return Select::ALL_ATTRIBUTES;
+            }
+            break;
+          case 349496988:
+            if (name == "ALL_PROJECTED_ATTRIBUTES")
+            {
+              return Select::ALL_PROJECTED_ATTRIBUTES;
+            }
+            break;
+          case -1043218812:
+            if (name == "SPECIFIC_ATTRIBUTES")
+            {
+              return Select::SPECIFIC_ATTRIBUTES;
+            }
+            break;
+          case 64313583:
+            if (name == "COUNT")
+            {
+              return Select::COUNT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Select::NOT_SET;
         }
 
-        Aws::String GetNameForSelect(Select enumValue)
+        const char* GetNameForSelectCStr(Select enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Select::ALL_ATTRIBUTES:
-            return "ALL_ATTRIBUTES";
-          case Select::ALL_PROJECTED_ATTRIBUTES:
-            return "ALL_PROJECTED_ATTRIBUTES";
-          case Select::SPECIFIC_ATTRIBUTES:
-            return "SPECIFIC_ATTRIBUTES";
-          case Select::COUNT:
-            return "COUNT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSelect(Select enumValue)
+        {
+          return GetNameForSelectCStr(enumValue);
         }
 
       } // namespace SelectMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace StreamViewTypeMapper
       {
 
-        static const int NEW_IMAGE_HASH = HashingUtils::HashString("NEW_IMAGE");
-        static const int OLD_IMAGE_HASH = HashingUtils::HashString("OLD_IMAGE");
-        static const int NEW_AND_OLD_IMAGES_HASH = HashingUtils::HashString("NEW_AND_OLD_IMAGES");
-        static const int KEYS_ONLY_HASH = HashingUtils::HashString("KEYS_ONLY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NEW_IMAGE",
+          "OLD_IMAGE",
+          "NEW_AND_OLD_IMAGES",
+          "KEYS_ONLY",
+        };
 
         StreamViewType GetStreamViewTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NEW_IMAGE_HASH)
-          {
-            return StreamViewType::NEW_IMAGE;
-          }
-          else if (hashCode == OLD_IMAGE_HASH)
-          {
-            return StreamViewType::OLD_IMAGE;
-          }
-          else if (hashCode == NEW_AND_OLD_IMAGES_HASH)
-          {
-            return StreamViewType::NEW_AND_OLD_IMAGES;
-          }
-          else if (hashCode == KEYS_ONLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StreamViewType::KEYS_ONLY;
+          case -854711876:
+            if (name == "NEW_IMAGE")
+            {
+              return StreamViewType::NEW_IMAGE;
+            }
+            break;
+          case 1264870659:
+            if (name == "OLD_IMAGE")
+            {
+              return StreamViewType::OLD_IMAGE;
+            }
+            break;
+          case 363674583:
+            if (name == "NEW_AND_OLD_IMAGES")
+            {
+              return StreamViewType::NEW_AND_OLD_IMAGES;
+            }
+            break;
+          case 1724531479:
+            if (name == "KEYS_ONLY")
+            {
+              return StreamViewType::KEYS_ONLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return StreamViewType::NOT_SET;
         }
 
-        Aws::String GetNameForStreamViewType(StreamViewType enumValue)
+        const char* GetNameForStreamViewTypeCStr(StreamViewType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StreamViewType::NEW_IMAGE:
-            return "NEW_IMAGE";
-          case StreamViewType::OLD_IMAGE:
-            return "OLD_IMAGE";
-          case StreamViewType::NEW_AND_OLD_IMAGES:
-            return "NEW_AND_OLD_IMAGES";
-          case StreamViewType::KEYS_ONLY:
-            return "KEYS_ONLY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStreamViewType(StreamViewType enumValue)
+        {
+          return GetNameForStreamViewTypeCStr(enumValue);
         }
 
       } // namespace StreamViewTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace TimeToLiveStatusMapper
       {
 
-        static const int ENABLING_HASH = HashingUtils::HashString("ENABLING");
-        static const int DISABLING_HASH = HashingUtils::HashString("DISABLING");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLING",
+          "DISABLING",
+          "ENABLED",
+          "DISABLED",
+        };
 
         TimeToLiveStatus GetTimeToLiveStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLING_HASH)
-          {
-            return TimeToLiveStatus::ENABLING;
-          }
-          else if (hashCode == DISABLING_HASH)
-          {
-            return TimeToLiveStatus::DISABLING;
-          }
-          else if (hashCode == ENABLED_HASH)
-          {
-            return TimeToLiveStatus::ENABLED;
-          }
-          else if (hashCode == DISABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TimeToLiveStatus::DISABLED;
+          case -1870144128:
+            if (name == "ENABLING")
+            {
+              return TimeToLiveStatus::ENABLING;
+            }
+            break;
+          case -1699138171:
+            if (name == "DISABLING")
+            {
+              return TimeToLiveStatus::DISABLING;
+            }
+            break;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return TimeToLiveStatus::ENABLED;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return TimeToLiveStatus::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return TimeToLiveStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTimeToLiveStatus(TimeToLiveStatus enumValue)
+        const char* GetNameForTimeToLiveStatusCStr(TimeToLiveStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TimeToLiveStatus::ENABLING:
-            return "ENABLING";
-          case TimeToLiveStatus::DISABLING:
-            return "DISABLING";
-          case TimeToLiveStatus::ENABLED:
-            return "ENABLED";
-          case TimeToLiveStatus::DISABLED:
-            return "DISABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTimeToLiveStatus(TimeToLiveStatus enumValue)
+        {
+          return GetNameForTimeToLiveStatusCStr(enumValue);
         }
 
       } // namespace TimeToLiveStatusMapper
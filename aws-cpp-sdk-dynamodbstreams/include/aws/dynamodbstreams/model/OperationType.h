@@ -36,6 +36,11 @@ namespace OperationTypeMapper
 AWS_DYNAMODBSTREAMS_API OperationType GetOperationTypeForName(const Aws::String& name);
 
 AWS_DYNAMODBSTREAMS_API Aws::String GetNameForOperationType(OperationType value);
+
+/**
+ * Same as GetNameForOperationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODBSTREAMS_API const char* GetNameForOperationTypeCStr(OperationType value);
 } // namespace OperationTypeMapper
 } // namespace Model
 } // namespace DynamoDBStreams
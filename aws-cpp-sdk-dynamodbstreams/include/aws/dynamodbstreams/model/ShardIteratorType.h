@@ -37,6 +37,11 @@ namespace ShardIteratorTypeMapper
 AWS_DYNAMODBSTREAMS_API ShardIteratorType GetShardIteratorTypeForName(const Aws::String& name);
 
 AWS_DYNAMODBSTREAMS_API Aws::String GetNameForShardIteratorType(ShardIteratorType value);
+
+/**
+ * Same as GetNameForShardIteratorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODBSTREAMS_API const char* GetNameForShardIteratorTypeCStr(ShardIteratorType value);
 } // namespace ShardIteratorTypeMapper
 } // namespace Model
 } // namespace DynamoDBStreams
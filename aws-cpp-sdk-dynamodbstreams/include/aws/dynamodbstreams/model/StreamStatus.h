@@ -37,6 +37,11 @@ namespace StreamStatusMapper
 AWS_DYNAMODBSTREAMS_API StreamStatus GetStreamStatusForName(const Aws::String& name);
 
 AWS_DYNAMODBSTREAMS_API Aws::String GetNameForStreamStatus(StreamStatus value);
+
+/**
+ * Same as GetNameForStreamStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_DYNAMODBSTREAMS_API const char* GetNameForStreamStatusCStr(StreamStatus value);
 } // namespace StreamStatusMapper
 } // namespace Model
 } // namespace DynamoDBStreams
@@ -30,25 +30,44 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int INSERT_HASH = HashingUtils::HashString("INSERT");
-        static const int MODIFY_HASH = HashingUtils::HashString("MODIFY");
-        static const int REMOVE_HASH = HashingUtils::HashString("REMOVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INSERT",
+          "MODIFY",
+          "REMOVE",
+        };
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSERT_HASH)
-          {
-            return OperationType::INSERT;
-          }
-          else if (hashCode == MODIFY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperationType::MODIFY;
-          }
-          else if (hashCode == REMOVE_HASH)
-          {
-            return OperationType::REMOVE;
+          case -2130463047:
+            if (name == "INSERT")
+            {
+              return OperationType::INSERT;
+            }
+            break;
+          case -2015466310:
+            if (name == "MODIFY")
+            {
+              return OperationType::MODIFY;
+            }
+            break;
+          case -1881281404:
+            if (name == "REMOVE")
+            {
+              return OperationType::REMOVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return OperationType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationType(OperationType enumValue)
+        const char* GetNameForOperationTypeCStr(OperationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperationType::INSERT:
-            return "INSERT";
-          case OperationType::MODIFY:
-            return "MODIFY";
-          case OperationType::REMOVE:
-            return "REMOVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperationType(OperationType enumValue)
+        {
+          return GetNameForOperationTypeCStr(enumValue);
         }
 
       } // namespace OperationTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ShardIteratorTypeMapper
       {
 
-        static const int TRIM_HORIZON_HASH = HashingUtils::HashString("TRIM_HORIZON");
-        static const int LATEST_HASH = HashingUtils::HashString("LATEST");
-        static const int AT_SEQUENCE_NUMBER_HASH = HashingUtils::HashString("AT_SEQUENCE_NUMBER");
-        static const int AFTER_SEQUENCE_NUMBER_HASH = HashingUtils::HashString("AFTER_SEQUENCE_NUMBER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TRIM_HORIZON",
+          "LATEST",
+          "AT_SEQUENCE_NUMBER",
+          "AFTER_SEQUENCE_NUMBER",
+        };
 
         ShardIteratorType GetShardIteratorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRIM_HORIZON_HASH)
-          {
-            return ShardIteratorType::TRIM_HORIZON;
-          }
-          else if (hashCode == LATEST_HASH)
-          {
-            return ShardIteratorType::LATEST;
-          }
-          else if (hashCode == AT_SEQUENCE_NUMBER_HASH)
-          {
-            return ShardIteratorType::AT_SEQUENCE_NUMBER;
-          }
-          else if (hashCode == AFTER_SEQUENCE_NUMBER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ShardIteratorType::AFTER_SEQUENCE_NUMBER;
+          case 1909941854:
+            if (name == "TRIM_HORIZON")
+            {
+              return ShardIteratorType::TRIM_HORIZON;
+            }
+            break;
+          case -2056551545:
+            if (name == "LATEST")
+            {
+              return ShardIteratorType::LATEST;
+            }
+            break;
+          case -1489047173:
+            if (name == "AT_SEQUENCE_NUMBER")
+            {
+              return ShardIteratorType::AT_SEQUENCE_NUMBER;
+            }
+            break;
+          case 489800964:
+            if (name == "AFTER_SEQUENCE_NUMBER")
+            {
+              return ShardIteratorType::AFTER_SEQUENCE_NUMBER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ShardIteratorType::NOT_SET;
         }
 
-        Aws::String GetNameForShardIteratorType(ShardIteratorType enumValue)
+        const char* GetNameForShardIteratorTypeCStr(ShardIteratorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ShardIteratorType::TRIM_HORIZON:
-            return "TRIM_HORIZON";
-          case ShardIteratorType::LATEST:
-            return "LATEST";
-          case ShardIteratorType::AT_SEQUENCE_NUMBER:
-            return "AT_SEQUENCE_NUMBER";
-          case ShardIteratorType::AFTER_SEQUENCE_NUMBER:
-            return "AFTER_SEQUENCE_NUMBER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForShardIteratorType(ShardIteratorType enumValue)
+        {
+          return GetNameForShardIteratorTypeCStr(enumValue);
         }
 
       } // namespace ShardIteratorTypeMapper
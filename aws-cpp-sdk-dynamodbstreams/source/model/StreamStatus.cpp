@@ -30,30 +30,51 @@ namespace Aws
       namespace StreamStatusMapper
       {
 
-        static const int ENABLING_HASH = HashingUtils::HashString("ENABLING");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLING_HASH = HashingUtils::HashString("DISABLING");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLING",
+          "ENABLED",
+          "DISABLING",
+          "DISABLED",
+        };
 
         StreamStatus GetStreamStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLING_HASH)
-          {
-            return StreamStatus::ENABLING;
-          }
-          else if (hashCode == ENABLED_HASH)
-          {
-            return StreamStatus::ENABLED;
-          }
-          else if (hashCode == DISABLING_HASH)
-          {
-            return StreamStatus::DISABLING;
-          }
-          else if (hashCode == DISABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StreamStatus::DISABLED;
+          case -1870144128:
+            if (name == "ENABLING")
+            {
+              return StreamStatus::ENABLING;
+            }
+            break;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return StreamStatus::ENABLED;
+            }
+            break;
+          case -1699138171:
+            if (name == "DISABLING")
+            {
+              return StreamStatus::DISABLING;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return StreamStatus::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return StreamStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStreamStatus(StreamStatus enumValue)
+        const char* GetNameForStreamStatusCStr(StreamStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StreamStatus::ENABLING:
-            return "ENABLING";
-          case StreamStatus::ENABLED:
-            return "ENABLED";
-          case StreamStatus::DISABLING:
-            return "DISABLING";
-          case StreamStatus::DISABLED:
-            return "DISABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStreamStatus(StreamStatus enumValue)
+        {
+          return GetNameForStreamStatusCStr(enumValue);
         }
 
       } // namespace StreamStatusMapper
@@ -35,6 +35,11 @@ namespace AccountAttributeNameMapper
 AWS_EC2_API AccountAttributeName GetAccountAttributeNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForAccountAttributeName(AccountAttributeName value);
+
+/**
+ * Same as GetNameForAccountAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForAccountAttributeNameCStr(AccountAttributeName value);
 } // namespace AccountAttributeNameMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace ActivityStatusMapper
 AWS_EC2_API ActivityStatus GetActivityStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForActivityStatus(ActivityStatus value);
+
+/**
+ * Same as GetNameForActivityStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForActivityStatusCStr(ActivityStatus value);
 } // namespace ActivityStatusMapper
 } // namespace Model
 } // namespace EC2
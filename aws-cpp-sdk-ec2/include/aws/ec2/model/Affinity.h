@@ -35,6 +35,11 @@ namespace AffinityMapper
 AWS_EC2_API Affinity GetAffinityForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForAffinity(Affinity value);
+
+/**
+ * Same as GetNameForAffinity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForAffinityCStr(Affinity value);
 } // namespace AffinityMapper
 } // namespace Model
 } // namespace EC2
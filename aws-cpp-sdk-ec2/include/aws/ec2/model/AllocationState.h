@@ -38,6 +38,11 @@ namespace AllocationStateMapper
 AWS_EC2_API AllocationState GetAllocationStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForAllocationState(AllocationState value);
+
+/**
+ * Same as GetNameForAllocationState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForAllocationStateCStr(AllocationState value);
 } // namespace AllocationStateMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace AllocationStrategyMapper
 AWS_EC2_API AllocationStrategy GetAllocationStrategyForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForAllocationStrategy(AllocationStrategy value);
+
+/**
+ * Same as GetNameForAllocationStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForAllocationStrategyCStr(AllocationStrategy value);
 } // namespace AllocationStrategyMapper
 } // namespace Model
 } // namespace EC2
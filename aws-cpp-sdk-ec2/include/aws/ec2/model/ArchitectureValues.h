@@ -36,6 +36,11 @@ namespace ArchitectureValuesMapper
 AWS_EC2_API ArchitectureValues GetArchitectureValuesForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForArchitectureValues(ArchitectureValues value);
+
+/**
+ * Same as GetNameForArchitectureValues(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForArchitectureValuesCStr(ArchitectureValues value);
 } // namespace ArchitectureValuesMapper
 } // namespace Model
 } // namespace EC2
@@ -34,6 +34,11 @@ namespace AssociatedNetworkTypeMapper
 AWS_EC2_API AssociatedNetworkType GetAssociatedNetworkTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForAssociatedNetworkType(AssociatedNetworkType value);
+
+/**
+ * Same as GetNameForAssociatedNetworkType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForAssociatedNetworkTypeCStr(AssociatedNetworkType value);
 } // namespace AssociatedNetworkTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -38,6 +38,11 @@ namespace AssociationStatusCodeMapper
 AWS_EC2_API AssociationStatusCode GetAssociationStatusCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForAssociationStatusCode(AssociationStatusCode value);
+
+/**
+ * Same as GetNameForAssociationStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForAssociationStatusCodeCStr(AssociationStatusCode value);
 } // namespace AssociationStatusCodeMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace AttachmentStatusMapper
 AWS_EC2_API AttachmentStatus GetAttachmentStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForAttachmentStatus(AttachmentStatus value);
+
+/**
+ * Same as GetNameForAttachmentStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForAttachmentStatusCStr(AttachmentStatus value);
 } // namespace AttachmentStatusMapper
 } // namespace Model
 } // namespace EC2
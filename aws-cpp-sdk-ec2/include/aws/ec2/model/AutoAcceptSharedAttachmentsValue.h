@@ -35,6 +35,11 @@ namespace AutoAcceptSharedAttachmentsValueMapper
 AWS_EC2_API AutoAcceptSharedAttachmentsValue GetAutoAcceptSharedAttachmentsValueForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForAutoAcceptSharedAttachmentsValue(AutoAcceptSharedAttachmentsValue value);
+
+/**
+ * Same as GetNameForAutoAcceptSharedAttachmentsValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForAutoAcceptSharedAttachmentsValueCStr(AutoAcceptSharedAttachmentsValue value);
 } // namespace AutoAcceptSharedAttachmentsValueMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace AutoPlacementMapper
 AWS_EC2_API AutoPlacement GetAutoPlacementForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForAutoPlacement(AutoPlacement value);
+
+/**
+ * Same as GetNameForAutoPlacement(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForAutoPlacementCStr(AutoPlacement value);
 } // namespace AutoPlacementMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace AvailabilityZoneStateMapper
 AWS_EC2_API AvailabilityZoneState GetAvailabilityZoneStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForAvailabilityZoneState(AvailabilityZoneState value);
+
+/**
+ * Same as GetNameForAvailabilityZoneState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForAvailabilityZoneStateCStr(AvailabilityZoneState value);
 } // namespace AvailabilityZoneStateMapper
 } // namespace Model
 } // namespace EC2
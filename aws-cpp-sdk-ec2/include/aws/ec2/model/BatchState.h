@@ -40,6 +40,11 @@ namespace BatchStateMapper
 AWS_EC2_API BatchState GetBatchStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForBatchState(BatchState value);
+
+/**
+ * Same as GetNameForBatchState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForBatchStateCStr(BatchState value);
 } // namespace BatchStateMapper
 } // namespace Model
 } // namespace EC2
@@ -40,6 +40,11 @@ namespace BundleTaskStateMapper
 AWS_EC2_API BundleTaskState GetBundleTaskStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForBundleTaskState(BundleTaskState value);
+
+/**
+ * Same as GetNameForBundleTaskState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForBundleTaskStateCStr(BundleTaskState value);
 } // namespace BundleTaskStateMapper
 } // namespace Model
 } // namespace EC2
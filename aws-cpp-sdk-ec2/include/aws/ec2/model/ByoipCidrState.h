@@ -40,6 +40,11 @@ namespace ByoipCidrStateMapper
 AWS_EC2_API ByoipCidrState GetByoipCidrStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForByoipCidrState(ByoipCidrState value);
+
+/**
+ * Same as GetNameForByoipCidrState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForByoipCidrStateCStr(ByoipCidrState value);
 } // namespace ByoipCidrStateMapper
 } // namespace Model
 } // namespace EC2
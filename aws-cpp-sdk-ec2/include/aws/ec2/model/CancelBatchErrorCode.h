@@ -37,6 +37,11 @@ namespace CancelBatchErrorCodeMapper
 AWS_EC2_API CancelBatchErrorCode GetCancelBatchErrorCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForCancelBatchErrorCode(CancelBatchErrorCode value);
+
+/**
+ * Same as GetNameForCancelBatchErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForCancelBatchErrorCodeCStr(CancelBatchErrorCode value);
 } // namespace CancelBatchErrorCodeMapper
 } // namespace Model
 } // namespace EC2
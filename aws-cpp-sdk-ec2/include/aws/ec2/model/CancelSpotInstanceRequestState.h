@@ -38,6 +38,11 @@ namespace CancelSpotInstanceRequestStateMapper
 AWS_EC2_API CancelSpotInstanceRequestState GetCancelSpotInstanceRequestStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForCancelSpotInstanceRequestState(CancelSpotInstanceRequestState value);
+
+/**
+ * Same as GetNameForCancelSpotInstanceRequestState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForCancelSpotInstanceRequestStateCStr(CancelSpotInstanceRequestState value);
 } // namespace CancelSpotInstanceRequestStateMapper
 } // namespace Model
 } // namespace EC2
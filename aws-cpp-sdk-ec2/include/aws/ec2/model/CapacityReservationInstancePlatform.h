@@ -41,6 +41,11 @@ namespace CapacityReservationInstancePlatformMapper
 AWS_EC2_API CapacityReservationInstancePlatform GetCapacityReservationInstancePlatformForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForCapacityReservationInstancePlatform(CapacityReservationInstancePlatform value);
+
+/**
+ * Same as GetNameForCapacityReservationInstancePlatform(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForCapacityReservationInstancePlatformCStr(CapacityReservationInstancePlatform value);
 } // namespace CapacityReservationInstancePlatformMapper
 } // namespace Model
 } // namespace EC2
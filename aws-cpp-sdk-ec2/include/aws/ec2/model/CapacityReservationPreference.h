@@ -35,6 +35,11 @@ namespace CapacityReservationPreferenceMapper
 AWS_EC2_API CapacityReservationPreference GetCapacityReservationPreferenceForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForCapacityReservationPreference(CapacityReservationPreference value);
+
+/**
+ * Same as GetNameForCapacityReservationPreference(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForCapacityReservationPreferenceCStr(CapacityReservationPreference value);
 } // namespace CapacityReservationPreferenceMapper
 } // namespace Model
 } // namespace EC2
@@ -38,6 +38,11 @@ namespace CapacityReservationStateMapper
 AWS_EC2_API CapacityReservationState GetCapacityReservationStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForCapacityReservationState(CapacityReservationState value);
+
+/**
+ * Same as GetNameForCapacityReservationState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForCapacityReservationStateCStr(CapacityReservationState value);
 } // namespace CapacityReservationStateMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace CapacityReservationTenancyMapper
 AWS_EC2_API CapacityReservationTenancy GetCapacityReservationTenancyForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForCapacityReservationTenancy(CapacityReservationTenancy value);
+
+/**
+ * Same as GetNameForCapacityReservationTenancy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForCapacityReservationTenancyCStr(CapacityReservationTenancy value);
 } // namespace CapacityReservationTenancyMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace ClientCertificateRevocationListStatusCodeMapper
 AWS_EC2_API ClientCertificateRevocationListStatusCode GetClientCertificateRevocationListStatusCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForClientCertificateRevocationListStatusCode(ClientCertificateRevocationListStatusCode value);
+
+/**
+ * Same as GetNameForClientCertificateRevocationListStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForClientCertificateRevocationListStatusCodeCStr(ClientCertificateRevocationListStatusCode value);
 } // namespace ClientCertificateRevocationListStatusCodeMapper
 } // namespace Model
 } // namespace EC2
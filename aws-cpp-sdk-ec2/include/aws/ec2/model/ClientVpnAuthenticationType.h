@@ -35,6 +35,11 @@ namespace ClientVpnAuthenticationTypeMapper
 AWS_EC2_API ClientVpnAuthenticationType GetClientVpnAuthenticationTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForClientVpnAuthenticationType(ClientVpnAuthenticationType value);
+
+/**
+ * Same as GetNameForClientVpnAuthenticationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForClientVpnAuthenticationTypeCStr(ClientVpnAuthenticationType value);
 } // namespace ClientVpnAuthenticationTypeMapper
 } // namespace Model
 } // namespace EC2
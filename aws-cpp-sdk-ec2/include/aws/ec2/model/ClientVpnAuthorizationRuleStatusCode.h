@@ -37,6 +37,11 @@ namespace ClientVpnAuthorizationRuleStatusCodeMapper
 AWS_EC2_API ClientVpnAuthorizationRuleStatusCode GetClientVpnAuthorizationRuleStatusCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForClientVpnAuthorizationRuleStatusCode(ClientVpnAuthorizationRuleStatusCode value);
+
+/**
+ * Same as GetNameForClientVpnAuthorizationRuleStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForClientVpnAuthorizationRuleStatusCodeCStr(ClientVpnAuthorizationRuleStatusCode value);
 } // namespace ClientVpnAuthorizationRuleStatusCodeMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace ClientVpnConnectionStatusCodeMapper
 AWS_EC2_API ClientVpnConnectionStatusCode GetClientVpnConnectionStatusCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForClientVpnConnectionStatusCode(ClientVpnConnectionStatusCode value);
+
+/**
+ * Same as GetNameForClientVpnConnectionStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForClientVpnConnectionStatusCodeCStr(ClientVpnConnectionStatusCode value);
 } // namespace ClientVpnConnectionStatusCodeMapper
 } // namespace Model
 } // namespace EC2
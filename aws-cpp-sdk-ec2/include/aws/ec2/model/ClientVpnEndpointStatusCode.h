@@ -37,6 +37,11 @@ namespace ClientVpnEndpointStatusCodeMapper
 AWS_EC2_API ClientVpnEndpointStatusCode GetClientVpnEndpointStatusCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForClientVpnEndpointStatusCode(ClientVpnEndpointStatusCode value);
+
+/**
+ * Same as GetNameForClientVpnEndpointStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForClientVpnEndpointStatusCodeCStr(ClientVpnEndpointStatusCode value);
 } // namespace ClientVpnEndpointStatusCodeMapper
 } // namespace Model
 } // namespace EC2
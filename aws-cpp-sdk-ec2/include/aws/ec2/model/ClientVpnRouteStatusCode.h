@@ -37,6 +37,11 @@ namespace ClientVpnRouteStatusCodeMapper
 AWS_EC2_API ClientVpnRouteStatusCode GetClientVpnRouteStatusCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForClientVpnRouteStatusCode(ClientVpnRouteStatusCode value);
+
+/**
+ * Same as GetNameForClientVpnRouteStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForClientVpnRouteStatusCodeCStr(ClientVpnRouteStatusCode value);
 } // namespace ClientVpnRouteStatusCodeMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace ConnectionNotificationStateMapper
 AWS_EC2_API ConnectionNotificationState GetConnectionNotificationStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForConnectionNotificationState(ConnectionNotificationState value);
+
+/**
+ * Same as GetNameForConnectionNotificationState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForConnectionNotificationStateCStr(ConnectionNotificationState value);
 } // namespace ConnectionNotificationStateMapper
 } // namespace Model
 } // namespace EC2
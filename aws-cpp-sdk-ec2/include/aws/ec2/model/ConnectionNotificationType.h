@@ -34,6 +34,11 @@ namespace ConnectionNotificationTypeMapper
 AWS_EC2_API ConnectionNotificationType GetConnectionNotificationTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForConnectionNotificationType(ConnectionNotificationType value);
+
+/**
+ * Same as GetNameForConnectionNotificationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForConnectionNotificationTypeCStr(ConnectionNotificationType value);
 } // namespace ConnectionNotificationTypeMapper
 } // namespace Model
 } // namespace EC2
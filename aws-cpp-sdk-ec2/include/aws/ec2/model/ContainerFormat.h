@@ -34,6 +34,11 @@ namespace ContainerFormatMapper
 AWS_EC2_API ContainerFormat GetContainerFormatForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForContainerFormat(ContainerFormat value);
+
+/**
+ * Same as GetNameForContainerFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForContainerFormatCStr(ContainerFormat value);
 } // namespace ContainerFormatMapper
 } // namespace Model
 } // namespace EC2
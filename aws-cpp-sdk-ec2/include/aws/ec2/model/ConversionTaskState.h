@@ -37,6 +37,11 @@ namespace ConversionTaskStateMapper
 AWS_EC2_API ConversionTaskState GetConversionTaskStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForConversionTaskState(ConversionTaskState value);
+
+/**
+ * Same as GetNameForConversionTaskState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForConversionTaskStateCStr(ConversionTaskState value);
 } // namespace ConversionTaskStateMapper
 } // namespace Model
 } // namespace EC2
@@ -34,6 +34,11 @@ namespace CurrencyCodeValuesMapper
 AWS_EC2_API CurrencyCodeValues GetCurrencyCodeValuesForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForCurrencyCodeValues(CurrencyCodeValues value);
+
+/**
+ * Same as GetNameForCurrencyCodeValues(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForCurrencyCodeValuesCStr(CurrencyCodeValues value);
 } // namespace CurrencyCodeValuesMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace DatafeedSubscriptionStateMapper
 AWS_EC2_API DatafeedSubscriptionState GetDatafeedSubscriptionStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForDatafeedSubscriptionState(DatafeedSubscriptionState value);
+
+/**
+ * Same as GetNameForDatafeedSubscriptionState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForDatafeedSubscriptionStateCStr(DatafeedSubscriptionState value);
 } // namespace DatafeedSubscriptionStateMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace DefaultRouteTableAssociationValueMapper
 AWS_EC2_API DefaultRouteTableAssociationValue GetDefaultRouteTableAssociationValueForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForDefaultRouteTableAssociationValue(DefaultRouteTableAssociationValue value);
+
+/**
+ * Same as GetNameForDefaultRouteTableAssociationValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForDefaultRouteTableAssociationValueCStr(DefaultRouteTableAssociationValue value);
 } // namespace DefaultRouteTableAssociationValueMapper
 } // namespace Model
 } // namespace EC2
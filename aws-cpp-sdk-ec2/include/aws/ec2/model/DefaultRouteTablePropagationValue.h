@@ -35,6 +35,11 @@ namespace DefaultRouteTablePropagationValueMapper
 AWS_EC2_API DefaultRouteTablePropagationValue GetDefaultRouteTablePropagationValueForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForDefaultRouteTablePropagationValue(DefaultRouteTablePropagationValue value);
+
+/**
+ * Same as GetNameForDefaultRouteTablePropagationValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForDefaultRouteTablePropagationValueCStr(DefaultRouteTablePropagationValue value);
 } // namespace DefaultRouteTablePropagationValueMapper
 } // namespace Model
 } // namespace EC2
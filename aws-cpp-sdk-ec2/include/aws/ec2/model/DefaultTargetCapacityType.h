@@ -35,6 +35,11 @@ namespace DefaultTargetCapacityTypeMapper
 AWS_EC2_API DefaultTargetCapacityType GetDefaultTargetCapacityTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForDefaultTargetCapacityType(DefaultTargetCapacityType value);
+
+/**
+ * Same as GetNameForDefaultTargetCapacityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForDefaultTargetCapacityTypeCStr(DefaultTargetCapacityType value);
 } // namespace DefaultTargetCapacityTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace DeleteFleetErrorCodeMapper
 AWS_EC2_API DeleteFleetErrorCode GetDeleteFleetErrorCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForDeleteFleetErrorCode(DeleteFleetErrorCode value);
+
+/**
+ * Same as GetNameForDeleteFleetErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForDeleteFleetErrorCodeCStr(DeleteFleetErrorCode value);
 } // namespace DeleteFleetErrorCodeMapper
 } // namespace Model
 } // namespace EC2
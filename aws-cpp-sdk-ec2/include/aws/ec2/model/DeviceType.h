@@ -35,6 +35,11 @@ namespace DeviceTypeMapper
 AWS_EC2_API DeviceType GetDeviceTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForDeviceType(DeviceType value);
+
+/**
+ * Same as GetNameForDeviceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForDeviceTypeCStr(DeviceType value);
 } // namespace DeviceTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -36,6 +36,11 @@ namespace DiskImageFormatMapper
 AWS_EC2_API DiskImageFormat GetDiskImageFormatForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForDiskImageFormat(DiskImageFormat value);
+
+/**
+ * Same as GetNameForDiskImageFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForDiskImageFormatCStr(DiskImageFormat value);
 } // namespace DiskImageFormatMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace DnsSupportValueMapper
 AWS_EC2_API DnsSupportValue GetDnsSupportValueForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForDnsSupportValue(DnsSupportValue value);
+
+/**
+ * Same as GetNameForDnsSupportValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForDnsSupportValueCStr(DnsSupportValue value);
 } // namespace DnsSupportValueMapper
 } // namespace Model
 } // namespace EC2
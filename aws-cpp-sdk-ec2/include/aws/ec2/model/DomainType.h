@@ -35,6 +35,11 @@ namespace DomainTypeMapper
 AWS_EC2_API DomainType GetDomainTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForDomainType(DomainType value);
+
+/**
+ * Same as GetNameForDomainType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForDomainTypeCStr(DomainType value);
 } // namespace DomainTypeMapper
 } // namespace Model
 } // namespace EC2
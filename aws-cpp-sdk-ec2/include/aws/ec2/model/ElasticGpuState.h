@@ -34,6 +34,11 @@ namespace ElasticGpuStateMapper
 AWS_EC2_API ElasticGpuState GetElasticGpuStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForElasticGpuState(ElasticGpuState value);
+
+/**
+ * Same as GetNameForElasticGpuState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForElasticGpuStateCStr(ElasticGpuState value);
 } // namespace ElasticGpuStateMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace ElasticGpuStatusMapper
 AWS_EC2_API ElasticGpuStatus GetElasticGpuStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForElasticGpuStatus(ElasticGpuStatus value);
+
+/**
+ * Same as GetNameForElasticGpuStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForElasticGpuStatusCStr(ElasticGpuStatus value);
 } // namespace ElasticGpuStatusMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace EndDateTypeMapper
 AWS_EC2_API EndDateType GetEndDateTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForEndDateType(EndDateType value);
+
+/**
+ * Same as GetNameForEndDateType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForEndDateTypeCStr(EndDateType value);
 } // namespace EndDateTypeMapper
 } // namespace Model
 } // namespace EC2
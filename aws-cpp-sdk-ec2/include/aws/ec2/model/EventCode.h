@@ -38,6 +38,11 @@ namespace EventCodeMapper
 AWS_EC2_API EventCode GetEventCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForEventCode(EventCode value);
+
+/**
+ * Same as GetNameForEventCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForEventCodeCStr(EventCode value);
 } // namespace EventCodeMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace ExcessCapacityTerminationPolicyMapper
 AWS_EC2_API ExcessCapacityTerminationPolicy GetExcessCapacityTerminationPolicyForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForExcessCapacityTerminationPolicy(ExcessCapacityTerminationPolicy value);
+
+/**
+ * Same as GetNameForExcessCapacityTerminationPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForExcessCapacityTerminationPolicyCStr(ExcessCapacityTerminationPolicy value);
 } // namespace ExcessCapacityTerminationPolicyMapper
 } // namespace Model
 } // namespace EC2
@@ -36,6 +36,11 @@ namespace ExportEnvironmentMapper
 AWS_EC2_API ExportEnvironment GetExportEnvironmentForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForExportEnvironment(ExportEnvironment value);
+
+/**
+ * Same as GetNameForExportEnvironment(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForExportEnvironmentCStr(ExportEnvironment value);
 } // namespace ExportEnvironmentMapper
 } // namespace Model
 } // namespace EC2
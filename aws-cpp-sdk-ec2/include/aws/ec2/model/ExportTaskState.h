@@ -37,6 +37,11 @@ namespace ExportTaskStateMapper
 AWS_EC2_API ExportTaskState GetExportTaskStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForExportTaskState(ExportTaskState value);
+
+/**
+ * Same as GetNameForExportTaskState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForExportTaskStateCStr(ExportTaskState value);
 } // namespace ExportTaskStateMapper
 } // namespace Model
 } // namespace EC2
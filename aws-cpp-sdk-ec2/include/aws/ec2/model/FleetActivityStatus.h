@@ -37,6 +37,11 @@ namespace FleetActivityStatusMapper
 AWS_EC2_API FleetActivityStatus GetFleetActivityStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForFleetActivityStatus(FleetActivityStatus value);
+
+/**
+ * Same as GetNameForFleetActivityStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForFleetActivityStatusCStr(FleetActivityStatus value);
 } // namespace FleetActivityStatusMapper
 } // namespace Model
 } // namespace EC2
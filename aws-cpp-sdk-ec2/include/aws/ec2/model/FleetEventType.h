@@ -36,6 +36,11 @@ namespace FleetEventTypeMapper
 AWS_EC2_API FleetEventType GetFleetEventTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForFleetEventType(FleetEventType value);
+
+/**
+ * Same as GetNameForFleetEventType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForFleetEventTypeCStr(FleetEventType value);
 } // namespace FleetEventTypeMapper
 } // namespace Model
 } // namespace EC2
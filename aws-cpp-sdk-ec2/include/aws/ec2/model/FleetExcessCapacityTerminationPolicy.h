@@ -35,6 +35,11 @@ namespace FleetExcessCapacityTerminationPolicyMapper
 AWS_EC2_API FleetExcessCapacityTerminationPolicy GetFleetExcessCapacityTerminationPolicyForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForFleetExcessCapacityTerminationPolicy(FleetExcessCapacityTerminationPolicy value);
+
+/**
+ * Same as GetNameForFleetExcessCapacityTerminationPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForFleetExcessCapacityTerminationPolicyCStr(FleetExcessCapacityTerminationPolicy value);
 } // namespace FleetExcessCapacityTerminationPolicyMapper
 } // namespace Model
 } // namespace EC2
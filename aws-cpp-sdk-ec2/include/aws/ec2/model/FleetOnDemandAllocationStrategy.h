@@ -35,6 +35,11 @@ namespace FleetOnDemandAllocationStrategyMapper
 AWS_EC2_API FleetOnDemandAllocationStrategy GetFleetOnDemandAllocationStrategyForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForFleetOnDemandAllocationStrategy(FleetOnDemandAllocationStrategy value);
+
+/**
+ * Same as GetNameForFleetOnDemandAllocationStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForFleetOnDemandAllocationStrategyCStr(FleetOnDemandAllocationStrategy value);
 } // namespace FleetOnDemandAllocationStrategyMapper
 } // namespace Model
 } // namespace EC2
@@ -40,6 +40,11 @@ namespace FleetStateCodeMapper
 AWS_EC2_API FleetStateCode GetFleetStateCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForFleetStateCode(FleetStateCode value);
+
+/**
+ * Same as GetNameForFleetStateCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForFleetStateCodeCStr(FleetStateCode value);
 } // namespace FleetStateCodeMapper
 } // namespace Model
 } // namespace EC2
@@ -36,6 +36,11 @@ namespace FlowLogsResourceTypeMapper
 AWS_EC2_API FlowLogsResourceType GetFlowLogsResourceTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForFlowLogsResourceType(FlowLogsResourceType value);
+
+/**
+ * Same as GetNameForFlowLogsResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForFlowLogsResourceTypeCStr(FlowLogsResourceType value);
 } // namespace FlowLogsResourceTypeMapper
 } // namespace Model
 } // namespace EC2
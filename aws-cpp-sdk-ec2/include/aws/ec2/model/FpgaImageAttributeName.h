@@ -37,6 +37,11 @@ namespace FpgaImageAttributeNameMapper
 AWS_EC2_API FpgaImageAttributeName GetFpgaImageAttributeNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForFpgaImageAttributeName(FpgaImageAttributeName value);
+
+/**
+ * Same as GetNameForFpgaImageAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForFpgaImageAttributeNameCStr(FpgaImageAttributeName value);
 } // namespace FpgaImageAttributeNameMapper
 } // namespace Model
 } // namespace EC2
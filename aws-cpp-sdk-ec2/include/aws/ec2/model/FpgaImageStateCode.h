@@ -37,6 +37,11 @@ namespace FpgaImageStateCodeMapper
 AWS_EC2_API FpgaImageStateCode GetFpgaImageStateCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForFpgaImageStateCode(FpgaImageStateCode value);
+
+/**
+ * Same as GetNameForFpgaImageStateCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForFpgaImageStateCodeCStr(FpgaImageStateCode value);
 } // namespace FpgaImageStateCodeMapper
 } // namespace Model
 } // namespace EC2
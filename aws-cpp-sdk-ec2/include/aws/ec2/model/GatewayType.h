@@ -34,6 +34,11 @@ namespace GatewayTypeMapper
 AWS_EC2_API GatewayType GetGatewayTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForGatewayType(GatewayType value);
+
+/**
+ * Same as GetNameForGatewayType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForGatewayTypeCStr(GatewayType value);
 } // namespace GatewayTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace HostTenancyMapper
 AWS_EC2_API HostTenancy GetHostTenancyForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForHostTenancy(HostTenancy value);
+
+/**
+ * Same as GetNameForHostTenancy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForHostTenancyCStr(HostTenancy value);
 } // namespace HostTenancyMapper
 } // namespace Model
 } // namespace EC2
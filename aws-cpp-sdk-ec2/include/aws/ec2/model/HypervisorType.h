@@ -35,6 +35,11 @@ namespace HypervisorTypeMapper
 AWS_EC2_API HypervisorType GetHypervisorTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForHypervisorType(HypervisorType value);
+
+/**
+ * Same as GetNameForHypervisorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForHypervisorTypeCStr(HypervisorType value);
 } // namespace HypervisorTypeMapper
 } // namespace Model
 } // namespace EC2
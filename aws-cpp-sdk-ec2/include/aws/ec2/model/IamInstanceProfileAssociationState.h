@@ -37,6 +37,11 @@ namespace IamInstanceProfileAssociationStateMapper
 AWS_EC2_API IamInstanceProfileAssociationState GetIamInstanceProfileAssociationStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForIamInstanceProfileAssociationState(IamInstanceProfileAssociationState value);
+
+/**
+ * Same as GetNameForIamInstanceProfileAssociationState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForIamInstanceProfileAssociationStateCStr(IamInstanceProfileAssociationState value);
 } // namespace IamInstanceProfileAssociationStateMapper
 } // namespace Model
 } // namespace EC2
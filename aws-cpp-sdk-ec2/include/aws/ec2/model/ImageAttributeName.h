@@ -40,6 +40,11 @@ namespace ImageAttributeNameMapper
 AWS_EC2_API ImageAttributeName GetImageAttributeNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForImageAttributeName(ImageAttributeName value);
+
+/**
+ * Same as GetNameForImageAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForImageAttributeNameCStr(ImageAttributeName value);
 } // namespace ImageAttributeNameMapper
 } // namespace Model
 } // namespace EC2
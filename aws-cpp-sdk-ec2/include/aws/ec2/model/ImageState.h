@@ -40,6 +40,11 @@ namespace ImageStateMapper
 AWS_EC2_API ImageState GetImageStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForImageState(ImageState value);
+
+/**
+ * Same as GetNameForImageState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForImageStateCStr(ImageState value);
 } // namespace ImageStateMapper
 } // namespace Model
 } // namespace EC2
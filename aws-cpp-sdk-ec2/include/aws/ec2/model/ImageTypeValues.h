@@ -36,6 +36,11 @@ namespace ImageTypeValuesMapper
 AWS_EC2_API ImageTypeValues GetImageTypeValuesForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForImageTypeValues(ImageTypeValues value);
+
+/**
+ * Same as GetNameForImageTypeValues(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForImageTypeValuesCStr(ImageTypeValues value);
 } // namespace ImageTypeValuesMapper
 } // namespace Model
 } // namespace EC2
@@ -47,6 +47,11 @@ namespace InstanceAttributeNameMapper
 AWS_EC2_API InstanceAttributeName GetInstanceAttributeNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForInstanceAttributeName(InstanceAttributeName value);
+
+/**
+ * Same as GetNameForInstanceAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForInstanceAttributeNameCStr(InstanceAttributeName value);
 } // namespace InstanceAttributeNameMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace InstanceHealthStatusMapper
 AWS_EC2_API InstanceHealthStatus GetInstanceHealthStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForInstanceHealthStatus(InstanceHealthStatus value);
+
+/**
+ * Same as GetNameForInstanceHealthStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForInstanceHealthStatusCStr(InstanceHealthStatus value);
 } // namespace InstanceHealthStatusMapper
 } // namespace Model
 } // namespace EC2
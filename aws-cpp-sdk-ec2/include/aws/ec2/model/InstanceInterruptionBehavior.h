@@ -36,6 +36,11 @@ namespace InstanceInterruptionBehaviorMapper
 AWS_EC2_API InstanceInterruptionBehavior GetInstanceInterruptionBehaviorForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForInstanceInterruptionBehavior(InstanceInterruptionBehavior value);
+
+/**
+ * Same as GetNameForInstanceInterruptionBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForInstanceInterruptionBehaviorCStr(InstanceInterruptionBehavior value);
 } // namespace InstanceInterruptionBehaviorMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace InstanceLifecycleMapper
 AWS_EC2_API InstanceLifecycle GetInstanceLifecycleForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForInstanceLifecycle(InstanceLifecycle value);
+
+/**
+ * Same as GetNameForInstanceLifecycle(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForInstanceLifecycleCStr(InstanceLifecycle value);
 } // namespace InstanceLifecycleMapper
 } // namespace Model
 } // namespace EC2
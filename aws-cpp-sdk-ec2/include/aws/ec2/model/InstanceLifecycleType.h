@@ -35,6 +35,11 @@ namespace InstanceLifecycleTypeMapper
 AWS_EC2_API InstanceLifecycleType GetInstanceLifecycleTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForInstanceLifecycleType(InstanceLifecycleType value);
+
+/**
+ * Same as GetNameForInstanceLifecycleType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForInstanceLifecycleTypeCStr(InstanceLifecycleType value);
 } // namespace InstanceLifecycleTypeMapper
 } // namespace Model
 } // namespace EC2
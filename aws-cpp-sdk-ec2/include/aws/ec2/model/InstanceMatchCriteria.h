@@ -35,6 +35,11 @@ namespace InstanceMatchCriteriaMapper
 AWS_EC2_API InstanceMatchCriteria GetInstanceMatchCriteriaForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForInstanceMatchCriteria(InstanceMatchCriteria value);
+
+/**
+ * Same as GetNameForInstanceMatchCriteria(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForInstanceMatchCriteriaCStr(InstanceMatchCriteria value);
 } // namespace InstanceMatchCriteriaMapper
 } // namespace Model
 } // namespace EC2
@@ -39,6 +39,11 @@ namespace InstanceStateNameMapper
 AWS_EC2_API InstanceStateName GetInstanceStateNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForInstanceStateName(InstanceStateName value);
+
+/**
+ * Same as GetNameForInstanceStateName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForInstanceStateNameCStr(InstanceStateName value);
 } // namespace InstanceStateNameMapper
 } // namespace Model
 } // namespace EC2
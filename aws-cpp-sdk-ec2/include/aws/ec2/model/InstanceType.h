@@ -211,6 +211,11 @@ namespace InstanceTypeMapper
 AWS_EC2_API InstanceType GetInstanceTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForInstanceType(InstanceType value);
+
+/**
+ * Same as GetNameForInstanceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForInstanceTypeCStr(InstanceType value);
 } // namespace InstanceTypeMapper
 } // namespace Model
 } // namespace EC2
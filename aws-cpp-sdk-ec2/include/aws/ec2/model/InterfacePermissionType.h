@@ -35,6 +35,11 @@ namespace InterfacePermissionTypeMapper
 AWS_EC2_API InterfacePermissionType GetInterfacePermissionTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForInterfacePermissionType(InterfacePermissionType value);
+
+/**
+ * Same as GetNameForInterfacePermissionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForInterfacePermissionTypeCStr(InterfacePermissionType value);
 } // namespace InterfacePermissionTypeMapper
 } // namespace Model
 } // namespace EC2
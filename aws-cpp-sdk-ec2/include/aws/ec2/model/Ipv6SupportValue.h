@@ -35,6 +35,11 @@ namespace Ipv6SupportValueMapper
 AWS_EC2_API Ipv6SupportValue GetIpv6SupportValueForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForIpv6SupportValue(Ipv6SupportValue value);
+
+/**
+ * Same as GetNameForIpv6SupportValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForIpv6SupportValueCStr(Ipv6SupportValue value);
 } // namespace Ipv6SupportValueMapper
 } // namespace Model
 } // namespace EC2
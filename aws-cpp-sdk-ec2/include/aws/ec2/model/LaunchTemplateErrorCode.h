@@ -39,6 +39,11 @@ namespace LaunchTemplateErrorCodeMapper
 AWS_EC2_API LaunchTemplateErrorCode GetLaunchTemplateErrorCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForLaunchTemplateErrorCode(LaunchTemplateErrorCode value);
+
+/**
+ * Same as GetNameForLaunchTemplateErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForLaunchTemplateErrorCodeCStr(LaunchTemplateErrorCode value);
 } // namespace LaunchTemplateErrorCodeMapper
 } // namespace Model
 } // namespace EC2
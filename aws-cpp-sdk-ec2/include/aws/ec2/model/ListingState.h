@@ -37,6 +37,11 @@ namespace ListingStateMapper
 AWS_EC2_API ListingState GetListingStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForListingState(ListingState value);
+
+/**
+ * Same as GetNameForListingState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForListingStateCStr(ListingState value);
 } // namespace ListingStateMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace ListingStatusMapper
 AWS_EC2_API ListingStatus GetListingStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForListingStatus(ListingStatus value);
+
+/**
+ * Same as GetNameForListingStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForListingStatusCStr(ListingStatus value);
 } // namespace ListingStatusMapper
 } // namespace Model
 } // namespace EC2
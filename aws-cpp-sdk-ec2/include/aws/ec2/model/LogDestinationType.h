@@ -35,6 +35,11 @@ namespace LogDestinationTypeMapper
 AWS_EC2_API LogDestinationType GetLogDestinationTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForLogDestinationType(LogDestinationType value);
+
+/**
+ * Same as GetNameForLogDestinationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForLogDestinationTypeCStr(LogDestinationType value);
 } // namespace LogDestinationTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -34,6 +34,11 @@ namespace MarketTypeMapper
 AWS_EC2_API MarketType GetMarketTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForMarketType(MarketType value);
+
+/**
+ * Same as GetNameForMarketType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForMarketTypeCStr(MarketType value);
 } // namespace MarketTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace MonitoringStateMapper
 AWS_EC2_API MonitoringState GetMonitoringStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForMonitoringState(MonitoringState value);
+
+/**
+ * Same as GetNameForMonitoringState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForMonitoringStateCStr(MonitoringState value);
 } // namespace MonitoringStateMapper
 } // namespace Model
 } // namespace EC2
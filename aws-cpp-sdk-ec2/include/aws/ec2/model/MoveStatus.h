@@ -35,6 +35,11 @@ namespace MoveStatusMapper
 AWS_EC2_API MoveStatus GetMoveStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForMoveStatus(MoveStatus value);
+
+/**
+ * Same as GetNameForMoveStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForMoveStatusCStr(MoveStatus value);
 } // namespace MoveStatusMapper
 } // namespace Model
 } // namespace EC2
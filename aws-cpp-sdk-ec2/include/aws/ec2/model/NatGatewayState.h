@@ -38,6 +38,11 @@ namespace NatGatewayStateMapper
 AWS_EC2_API NatGatewayState GetNatGatewayStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForNatGatewayState(NatGatewayState value);
+
+/**
+ * Same as GetNameForNatGatewayState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForNatGatewayStateCStr(NatGatewayState value);
 } // namespace NatGatewayStateMapper
 } // namespace Model
 } // namespace EC2
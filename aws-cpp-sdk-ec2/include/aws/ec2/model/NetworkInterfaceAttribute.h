@@ -37,6 +37,11 @@ namespace NetworkInterfaceAttributeMapper
 AWS_EC2_API NetworkInterfaceAttribute GetNetworkInterfaceAttributeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForNetworkInterfaceAttribute(NetworkInterfaceAttribute value);
+
+/**
+ * Same as GetNameForNetworkInterfaceAttribute(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForNetworkInterfaceAttributeCStr(NetworkInterfaceAttribute value);
 } // namespace NetworkInterfaceAttributeMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace NetworkInterfacePermissionStateCodeMapper
 AWS_EC2_API NetworkInterfacePermissionStateCode GetNetworkInterfacePermissionStateCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForNetworkInterfacePermissionStateCode(NetworkInterfacePermissionStateCode value);
+
+/**
+ * Same as GetNameForNetworkInterfacePermissionStateCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForNetworkInterfacePermissionStateCodeCStr(NetworkInterfacePermissionStateCode value);
 } // namespace NetworkInterfacePermissionStateCodeMapper
 } // namespace Model
 } // namespace EC2
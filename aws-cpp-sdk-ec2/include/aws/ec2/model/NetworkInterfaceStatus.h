@@ -38,6 +38,11 @@ namespace NetworkInterfaceStatusMapper
 AWS_EC2_API NetworkInterfaceStatus GetNetworkInterfaceStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForNetworkInterfaceStatus(NetworkInterfaceStatus value);
+
+/**
+ * Same as GetNameForNetworkInterfaceStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForNetworkInterfaceStatusCStr(NetworkInterfaceStatus value);
 } // namespace NetworkInterfaceStatusMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace NetworkInterfaceTypeMapper
 AWS_EC2_API NetworkInterfaceType GetNetworkInterfaceTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForNetworkInterfaceType(NetworkInterfaceType value);
+
+/**
+ * Same as GetNameForNetworkInterfaceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForNetworkInterfaceTypeCStr(NetworkInterfaceType value);
 } // namespace NetworkInterfaceTypeMapper
 } // namespace Model
 } // namespace EC2
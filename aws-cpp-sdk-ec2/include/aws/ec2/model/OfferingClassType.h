@@ -35,6 +35,11 @@ namespace OfferingClassTypeMapper
 AWS_EC2_API OfferingClassType GetOfferingClassTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForOfferingClassType(OfferingClassType value);
+
+/**
+ * Same as GetNameForOfferingClassType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForOfferingClassTypeCStr(OfferingClassType value);
 } // namespace OfferingClassTypeMapper
 } // namespace Model
 } // namespace EC2
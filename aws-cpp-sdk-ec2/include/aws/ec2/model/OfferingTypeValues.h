@@ -39,6 +39,11 @@ namespace OfferingTypeValuesMapper
 AWS_EC2_API OfferingTypeValues GetOfferingTypeValuesForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForOfferingTypeValues(OfferingTypeValues value);
+
+/**
+ * Same as GetNameForOfferingTypeValues(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForOfferingTypeValuesCStr(OfferingTypeValues value);
 } // namespace OfferingTypeValuesMapper
 } // namespace Model
 } // namespace EC2
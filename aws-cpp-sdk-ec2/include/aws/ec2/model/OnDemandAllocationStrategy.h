@@ -35,6 +35,11 @@ namespace OnDemandAllocationStrategyMapper
 AWS_EC2_API OnDemandAllocationStrategy GetOnDemandAllocationStrategyForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForOnDemandAllocationStrategy(OnDemandAllocationStrategy value);
+
+/**
+ * Same as GetNameForOnDemandAllocationStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForOnDemandAllocationStrategyCStr(OnDemandAllocationStrategy value);
 } // namespace OnDemandAllocationStrategyMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace OperationTypeMapper
 AWS_EC2_API OperationType GetOperationTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForOperationType(OperationType value);
+
+/**
+ * Same as GetNameForOperationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForOperationTypeCStr(OperationType value);
 } // namespace OperationTypeMapper
 } // namespace Model
 } // namespace EC2
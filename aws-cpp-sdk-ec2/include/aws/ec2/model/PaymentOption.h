@@ -36,6 +36,11 @@ namespace PaymentOptionMapper
 AWS_EC2_API PaymentOption GetPaymentOptionForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForPaymentOption(PaymentOption value);
+
+/**
+ * Same as GetNameForPaymentOption(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForPaymentOptionCStr(PaymentOption value);
 } // namespace PaymentOptionMapper
 } // namespace Model
 } // namespace EC2
@@ -34,6 +34,11 @@ namespace PermissionGroupMapper
 AWS_EC2_API PermissionGroup GetPermissionGroupForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForPermissionGroup(PermissionGroup value);
+
+/**
+ * Same as GetNameForPermissionGroup(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForPermissionGroupCStr(PermissionGroup value);
 } // namespace PermissionGroupMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace PlacementGroupStateMapper
 AWS_EC2_API PlacementGroupState GetPlacementGroupStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForPlacementGroupState(PlacementGroupState value);
+
+/**
+ * Same as GetNameForPlacementGroupState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForPlacementGroupStateCStr(PlacementGroupState value);
 } // namespace PlacementGroupStateMapper
 } // namespace Model
 } // namespace EC2
@@ -36,6 +36,11 @@ namespace PlacementStrategyMapper
 AWS_EC2_API PlacementStrategy GetPlacementStrategyForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForPlacementStrategy(PlacementStrategy value);
+
+/**
+ * Same as GetNameForPlacementStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForPlacementStrategyCStr(PlacementStrategy value);
 } // namespace PlacementStrategyMapper
 } // namespace Model
 } // namespace EC2
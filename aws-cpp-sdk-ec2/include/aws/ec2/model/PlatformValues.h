@@ -34,6 +34,11 @@ namespace PlatformValuesMapper
 AWS_EC2_API PlatformValues GetPlatformValuesForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForPlatformValues(PlatformValues value);
+
+/**
+ * Same as GetNameForPlatformValues(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForPlatformValuesCStr(PlatformValues value);
 } // namespace PlatformValuesMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace ProductCodeValuesMapper
 AWS_EC2_API ProductCodeValues GetProductCodeValuesForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForProductCodeValues(ProductCodeValues value);
+
+/**
+ * Same as GetNameForProductCodeValues(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForProductCodeValuesCStr(ProductCodeValues value);
 } // namespace ProductCodeValuesMapper
 } // namespace Model
 } // namespace EC2
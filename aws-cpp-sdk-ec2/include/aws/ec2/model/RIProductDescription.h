@@ -37,6 +37,11 @@ namespace RIProductDescriptionMapper
 AWS_EC2_API RIProductDescription GetRIProductDescriptionForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForRIProductDescription(RIProductDescription value);
+
+/**
+ * Same as GetNameForRIProductDescription(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForRIProductDescriptionCStr(RIProductDescription value);
 } // namespace RIProductDescriptionMapper
 } // namespace Model
 } // namespace EC2
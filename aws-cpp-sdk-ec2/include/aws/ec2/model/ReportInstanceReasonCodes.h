@@ -42,6 +42,11 @@ namespace ReportInstanceReasonCodesMapper
 AWS_EC2_API ReportInstanceReasonCodes GetReportInstanceReasonCodesForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForReportInstanceReasonCodes(ReportInstanceReasonCodes value);
+
+/**
+ * Same as GetNameForReportInstanceReasonCodes(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForReportInstanceReasonCodesCStr(ReportInstanceReasonCodes value);
 } // namespace ReportInstanceReasonCodesMapper
 } // namespace Model
 } // namespace EC2
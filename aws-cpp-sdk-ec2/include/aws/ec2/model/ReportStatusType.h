@@ -35,6 +35,11 @@ namespace ReportStatusTypeMapper
 AWS_EC2_API ReportStatusType GetReportStatusTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForReportStatusType(ReportStatusType value);
+
+/**
+ * Same as GetNameForReportStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForReportStatusTypeCStr(ReportStatusType value);
 } // namespace ReportStatusTypeMapper
 } // namespace Model
 } // namespace EC2
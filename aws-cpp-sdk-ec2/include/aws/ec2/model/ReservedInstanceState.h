@@ -37,6 +37,11 @@ namespace ReservedInstanceStateMapper
 AWS_EC2_API ReservedInstanceState GetReservedInstanceStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForReservedInstanceState(ReservedInstanceState value);
+
+/**
+ * Same as GetNameForReservedInstanceState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForReservedInstanceStateCStr(ReservedInstanceState value);
 } // namespace ReservedInstanceStateMapper
 } // namespace Model
 } // namespace EC2
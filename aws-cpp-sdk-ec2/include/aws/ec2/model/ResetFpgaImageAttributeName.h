@@ -34,6 +34,11 @@ namespace ResetFpgaImageAttributeNameMapper
 AWS_EC2_API ResetFpgaImageAttributeName GetResetFpgaImageAttributeNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForResetFpgaImageAttributeName(ResetFpgaImageAttributeName value);
+
+/**
+ * Same as GetNameForResetFpgaImageAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForResetFpgaImageAttributeNameCStr(ResetFpgaImageAttributeName value);
 } // namespace ResetFpgaImageAttributeNameMapper
 } // namespace Model
 } // namespace EC2
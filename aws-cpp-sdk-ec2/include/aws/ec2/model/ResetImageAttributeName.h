@@ -34,6 +34,11 @@ namespace ResetImageAttributeNameMapper
 AWS_EC2_API ResetImageAttributeName GetResetImageAttributeNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForResetImageAttributeName(ResetImageAttributeName value);
+
+/**
+ * Same as GetNameForResetImageAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForResetImageAttributeNameCStr(ResetImageAttributeName value);
 } // namespace ResetImageAttributeNameMapper
 } // namespace Model
 } // namespace EC2
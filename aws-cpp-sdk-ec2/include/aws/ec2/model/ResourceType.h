@@ -60,6 +60,11 @@ namespace ResourceTypeMapper
 AWS_EC2_API ResourceType GetResourceTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForResourceType(ResourceType value);
+
+/**
+ * Same as GetNameForResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForResourceTypeCStr(ResourceType value);
 } // namespace ResourceTypeMapper
 } // namespace Model
 } // namespace EC2
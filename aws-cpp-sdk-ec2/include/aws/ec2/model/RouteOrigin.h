@@ -36,6 +36,11 @@ namespace RouteOriginMapper
 AWS_EC2_API RouteOrigin GetRouteOriginForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForRouteOrigin(RouteOrigin value);
+
+/**
+ * Same as GetNameForRouteOrigin(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForRouteOriginCStr(RouteOrigin value);
 } // namespace RouteOriginMapper
 } // namespace Model
 } // namespace EC2
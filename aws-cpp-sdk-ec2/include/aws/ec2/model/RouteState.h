@@ -35,6 +35,11 @@ namespace RouteStateMapper
 AWS_EC2_API RouteState GetRouteStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForRouteState(RouteState value);
+
+/**
+ * Same as GetNameForRouteState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForRouteStateCStr(RouteState value);
 } // namespace RouteStateMapper
 } // namespace Model
 } // namespace EC2
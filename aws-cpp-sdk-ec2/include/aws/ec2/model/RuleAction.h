@@ -35,6 +35,11 @@ namespace RuleActionMapper
 AWS_EC2_API RuleAction GetRuleActionForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForRuleAction(RuleAction value);
+
+/**
+ * Same as GetNameForRuleAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForRuleActionCStr(RuleAction value);
 } // namespace RuleActionMapper
 } // namespace Model
 } // namespace EC2
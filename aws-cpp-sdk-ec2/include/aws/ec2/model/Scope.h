@@ -35,6 +35,11 @@ namespace ScopeMapper
 AWS_EC2_API Scope GetScopeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForScope(Scope value);
+
+/**
+ * Same as GetNameForScope(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForScopeCStr(Scope value);
 } // namespace ScopeMapper
 } // namespace Model
 } // namespace EC2
@@ -38,6 +38,11 @@ namespace ServiceStateMapper
 AWS_EC2_API ServiceState GetServiceStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForServiceState(ServiceState value);
+
+/**
+ * Same as GetNameForServiceState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForServiceStateCStr(ServiceState value);
 } // namespace ServiceStateMapper
 } // namespace Model
 } // namespace EC2
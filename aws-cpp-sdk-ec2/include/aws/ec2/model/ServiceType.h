@@ -35,6 +35,11 @@ namespace ServiceTypeMapper
 AWS_EC2_API ServiceType GetServiceTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForServiceType(ServiceType value);
+
+/**
+ * Same as GetNameForServiceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForServiceTypeCStr(ServiceType value);
 } // namespace ServiceTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace ShutdownBehaviorMapper
 AWS_EC2_API ShutdownBehavior GetShutdownBehaviorForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForShutdownBehavior(ShutdownBehavior value);
+
+/**
+ * Same as GetNameForShutdownBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForShutdownBehaviorCStr(ShutdownBehavior value);
 } // namespace ShutdownBehaviorMapper
 } // namespace Model
 } // namespace EC2
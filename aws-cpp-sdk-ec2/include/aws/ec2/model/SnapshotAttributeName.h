@@ -35,6 +35,11 @@ namespace SnapshotAttributeNameMapper
 AWS_EC2_API SnapshotAttributeName GetSnapshotAttributeNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForSnapshotAttributeName(SnapshotAttributeName value);
+
+/**
+ * Same as GetNameForSnapshotAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForSnapshotAttributeNameCStr(SnapshotAttributeName value);
 } // namespace SnapshotAttributeNameMapper
 } // namespace Model
 } // namespace EC2
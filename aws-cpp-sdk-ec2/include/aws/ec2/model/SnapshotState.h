@@ -36,6 +36,11 @@ namespace SnapshotStateMapper
 AWS_EC2_API SnapshotState GetSnapshotStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForSnapshotState(SnapshotState value);
+
+/**
+ * Same as GetNameForSnapshotState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForSnapshotStateCStr(SnapshotState value);
 } // namespace SnapshotStateMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace SpotAllocationStrategyMapper
 AWS_EC2_API SpotAllocationStrategy GetSpotAllocationStrategyForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForSpotAllocationStrategy(SpotAllocationStrategy value);
+
+/**
+ * Same as GetNameForSpotAllocationStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForSpotAllocationStrategyCStr(SpotAllocationStrategy value);
 } // namespace SpotAllocationStrategyMapper
 } // namespace Model
 } // namespace EC2
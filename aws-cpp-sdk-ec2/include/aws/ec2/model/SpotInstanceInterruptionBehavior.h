@@ -36,6 +36,11 @@ namespace SpotInstanceInterruptionBehaviorMapper
 AWS_EC2_API SpotInstanceInterruptionBehavior GetSpotInstanceInterruptionBehaviorForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForSpotInstanceInterruptionBehavior(SpotInstanceInterruptionBehavior value);
+
+/**
+ * Same as GetNameForSpotInstanceInterruptionBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForSpotInstanceInterruptionBehaviorCStr(SpotInstanceInterruptionBehavior value);
 } // namespace SpotInstanceInterruptionBehaviorMapper
 } // namespace Model
 } // namespace EC2
@@ -39,6 +39,11 @@ namespace SpotInstanceStateMapper
 AWS_EC2_API SpotInstanceState GetSpotInstanceStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForSpotInstanceState(SpotInstanceState value);
+
+/**
+ * Same as GetNameForSpotInstanceState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForSpotInstanceStateCStr(SpotInstanceState value);
 } // namespace SpotInstanceStateMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace SpotInstanceTypeMapper
 AWS_EC2_API SpotInstanceType GetSpotInstanceTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForSpotInstanceType(SpotInstanceType value);
+
+/**
+ * Same as GetNameForSpotInstanceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForSpotInstanceTypeCStr(SpotInstanceType value);
 } // namespace SpotInstanceTypeMapper
 } // namespace Model
 } // namespace EC2
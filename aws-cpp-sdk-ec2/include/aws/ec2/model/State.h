@@ -41,6 +41,11 @@ namespace StateMapper
 AWS_EC2_API State GetStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForState(State value);
+
+/**
+ * Same as GetNameForState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForStateCStr(State value);
 } // namespace StateMapper
 } // namespace Model
 } // namespace EC2
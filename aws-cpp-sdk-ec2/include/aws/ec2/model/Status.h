@@ -36,6 +36,11 @@ namespace StatusMapper
 AWS_EC2_API Status GetStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForStatus(Status value);
+
+/**
+ * Same as GetNameForStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForStatusCStr(Status value);
 } // namespace StatusMapper
 } // namespace Model
 } // namespace EC2
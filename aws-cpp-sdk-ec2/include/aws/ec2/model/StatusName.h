@@ -34,6 +34,11 @@ namespace StatusNameMapper
 AWS_EC2_API StatusName GetStatusNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForStatusName(StatusName value);
+
+/**
+ * Same as GetNameForStatusName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForStatusNameCStr(StatusName value);
 } // namespace StatusNameMapper
 } // namespace Model
 } // namespace EC2
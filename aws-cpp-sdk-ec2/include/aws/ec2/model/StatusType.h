@@ -37,6 +37,11 @@ namespace StatusTypeMapper
 AWS_EC2_API StatusType GetStatusTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForStatusType(StatusType value);
+
+/**
+ * Same as GetNameForStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForStatusTypeCStr(StatusType value);
 } // namespace StatusTypeMapper
 } // namespace Model
 } // namespace EC2
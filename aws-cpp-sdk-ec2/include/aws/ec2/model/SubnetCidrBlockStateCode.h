@@ -39,6 +39,11 @@ namespace SubnetCidrBlockStateCodeMapper
 AWS_EC2_API SubnetCidrBlockStateCode GetSubnetCidrBlockStateCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForSubnetCidrBlockStateCode(SubnetCidrBlockStateCode value);
+
+/**
+ * Same as GetNameForSubnetCidrBlockStateCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForSubnetCidrBlockStateCodeCStr(SubnetCidrBlockStateCode value);
 } // namespace SubnetCidrBlockStateCodeMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace SubnetStateMapper
 AWS_EC2_API SubnetState GetSubnetStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForSubnetState(SubnetState value);
+
+/**
+ * Same as GetNameForSubnetState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForSubnetStateCStr(SubnetState value);
 } // namespace SubnetStateMapper
 } // namespace Model
 } // namespace EC2
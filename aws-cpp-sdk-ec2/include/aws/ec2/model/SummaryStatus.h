@@ -38,6 +38,11 @@ namespace SummaryStatusMapper
 AWS_EC2_API SummaryStatus GetSummaryStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForSummaryStatus(SummaryStatus value);
+
+/**
+ * Same as GetNameForSummaryStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForSummaryStatusCStr(SummaryStatus value);
 } // namespace SummaryStatusMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace TelemetryStatusMapper
 AWS_EC2_API TelemetryStatus GetTelemetryStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTelemetryStatus(TelemetryStatus value);
+
+/**
+ * Same as GetNameForTelemetryStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTelemetryStatusCStr(TelemetryStatus value);
 } // namespace TelemetryStatusMapper
 } // namespace Model
 } // namespace EC2
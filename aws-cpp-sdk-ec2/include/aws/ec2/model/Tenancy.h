@@ -36,6 +36,11 @@ namespace TenancyMapper
 AWS_EC2_API Tenancy GetTenancyForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTenancy(Tenancy value);
+
+/**
+ * Same as GetNameForTenancy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTenancyCStr(Tenancy value);
 } // namespace TenancyMapper
 } // namespace Model
 } // namespace EC2
@@ -36,6 +36,11 @@ namespace TrafficTypeMapper
 AWS_EC2_API TrafficType GetTrafficTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTrafficType(TrafficType value);
+
+/**
+ * Same as GetNameForTrafficType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTrafficTypeCStr(TrafficType value);
 } // namespace TrafficTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace TransitGatewayAssociationStateMapper
 AWS_EC2_API TransitGatewayAssociationState GetTransitGatewayAssociationStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTransitGatewayAssociationState(TransitGatewayAssociationState value);
+
+/**
+ * Same as GetNameForTransitGatewayAssociationState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTransitGatewayAssociationStateCStr(TransitGatewayAssociationState value);
 } // namespace TransitGatewayAssociationStateMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace TransitGatewayAttachmentResourceTypeMapper
 AWS_EC2_API TransitGatewayAttachmentResourceType GetTransitGatewayAttachmentResourceTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTransitGatewayAttachmentResourceType(TransitGatewayAttachmentResourceType value);
+
+/**
+ * Same as GetNameForTransitGatewayAttachmentResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTransitGatewayAttachmentResourceTypeCStr(TransitGatewayAttachmentResourceType value);
 } // namespace TransitGatewayAttachmentResourceTypeMapper
 } // namespace Model
 } // namespace EC2
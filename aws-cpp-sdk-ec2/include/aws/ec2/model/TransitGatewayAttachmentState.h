@@ -44,6 +44,11 @@ namespace TransitGatewayAttachmentStateMapper
 AWS_EC2_API TransitGatewayAttachmentState GetTransitGatewayAttachmentStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTransitGatewayAttachmentState(TransitGatewayAttachmentState value);
+
+/**
+ * Same as GetNameForTransitGatewayAttachmentState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTransitGatewayAttachmentStateCStr(TransitGatewayAttachmentState value);
 } // namespace TransitGatewayAttachmentStateMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace TransitGatewayPropagationStateMapper
 AWS_EC2_API TransitGatewayPropagationState GetTransitGatewayPropagationStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTransitGatewayPropagationState(TransitGatewayPropagationState value);
+
+/**
+ * Same as GetNameForTransitGatewayPropagationState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTransitGatewayPropagationStateCStr(TransitGatewayPropagationState value);
 } // namespace TransitGatewayPropagationStateMapper
 } // namespace Model
 } // namespace EC2
@@ -38,6 +38,11 @@ namespace TransitGatewayRouteStateMapper
 AWS_EC2_API TransitGatewayRouteState GetTransitGatewayRouteStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTransitGatewayRouteState(TransitGatewayRouteState value);
+
+/**
+ * Same as GetNameForTransitGatewayRouteState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTransitGatewayRouteStateCStr(TransitGatewayRouteState value);
 } // namespace TransitGatewayRouteStateMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace TransitGatewayRouteTableStateMapper
 AWS_EC2_API TransitGatewayRouteTableState GetTransitGatewayRouteTableStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTransitGatewayRouteTableState(TransitGatewayRouteTableState value);
+
+/**
+ * Same as GetNameForTransitGatewayRouteTableState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTransitGatewayRouteTableStateCStr(TransitGatewayRouteTableState value);
 } // namespace TransitGatewayRouteTableStateMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace TransitGatewayRouteTypeMapper
 AWS_EC2_API TransitGatewayRouteType GetTransitGatewayRouteTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTransitGatewayRouteType(TransitGatewayRouteType value);
+
+/**
+ * Same as GetNameForTransitGatewayRouteType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTransitGatewayRouteTypeCStr(TransitGatewayRouteType value);
 } // namespace TransitGatewayRouteTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -38,6 +38,11 @@ namespace TransitGatewayStateMapper
 AWS_EC2_API TransitGatewayState GetTransitGatewayStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTransitGatewayState(TransitGatewayState value);
+
+/**
+ * Same as GetNameForTransitGatewayState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTransitGatewayStateCStr(TransitGatewayState value);
 } // namespace TransitGatewayStateMapper
 } // namespace Model
 } // namespace EC2
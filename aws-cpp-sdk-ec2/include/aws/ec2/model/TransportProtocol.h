@@ -35,6 +35,11 @@ namespace TransportProtocolMapper
 AWS_EC2_API TransportProtocol GetTransportProtocolForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForTransportProtocol(TransportProtocol value);
+
+/**
+ * Same as GetNameForTransportProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForTransportProtocolCStr(TransportProtocol value);
 } // namespace TransportProtocolMapper
 } // namespace Model
 } // namespace EC2
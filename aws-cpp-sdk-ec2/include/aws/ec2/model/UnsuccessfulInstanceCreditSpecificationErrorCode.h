@@ -37,6 +37,11 @@ namespace UnsuccessfulInstanceCreditSpecificationErrorCodeMapper
 AWS_EC2_API UnsuccessfulInstanceCreditSpecificationErrorCode GetUnsuccessfulInstanceCreditSpecificationErrorCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForUnsuccessfulInstanceCreditSpecificationErrorCode(UnsuccessfulInstanceCreditSpecificationErrorCode value);
+
+/**
+ * Same as GetNameForUnsuccessfulInstanceCreditSpecificationErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForUnsuccessfulInstanceCreditSpecificationErrorCodeCStr(UnsuccessfulInstanceCreditSpecificationErrorCode value);
 } // namespace UnsuccessfulInstanceCreditSpecificationErrorCodeMapper
 } // namespace Model
 } // namespace EC2
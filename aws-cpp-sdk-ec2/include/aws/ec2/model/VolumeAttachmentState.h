@@ -38,6 +38,11 @@ namespace VolumeAttachmentStateMapper
 AWS_EC2_API VolumeAttachmentState GetVolumeAttachmentStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVolumeAttachmentState(VolumeAttachmentState value);
+
+/**
+ * Same as GetNameForVolumeAttachmentState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVolumeAttachmentStateCStr(VolumeAttachmentState value);
 } // namespace VolumeAttachmentStateMapper
 } // namespace Model
 } // namespace EC2
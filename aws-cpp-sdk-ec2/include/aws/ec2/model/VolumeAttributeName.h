@@ -35,6 +35,11 @@ namespace VolumeAttributeNameMapper
 AWS_EC2_API VolumeAttributeName GetVolumeAttributeNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVolumeAttributeName(VolumeAttributeName value);
+
+/**
+ * Same as GetNameForVolumeAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVolumeAttributeNameCStr(VolumeAttributeName value);
 } // namespace VolumeAttributeNameMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace VolumeModificationStateMapper
 AWS_EC2_API VolumeModificationState GetVolumeModificationStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVolumeModificationState(VolumeModificationState value);
+
+/**
+ * Same as GetNameForVolumeModificationState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVolumeModificationStateCStr(VolumeModificationState value);
 } // namespace VolumeModificationStateMapper
 } // namespace Model
 } // namespace EC2
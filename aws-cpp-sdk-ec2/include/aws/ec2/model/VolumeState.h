@@ -39,6 +39,11 @@ namespace VolumeStateMapper
 AWS_EC2_API VolumeState GetVolumeStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVolumeState(VolumeState value);
+
+/**
+ * Same as GetNameForVolumeState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVolumeStateCStr(VolumeState value);
 } // namespace VolumeStateMapper
 } // namespace Model
 } // namespace EC2
@@ -36,6 +36,11 @@ namespace VolumeStatusInfoStatusMapper
 AWS_EC2_API VolumeStatusInfoStatus GetVolumeStatusInfoStatusForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVolumeStatusInfoStatus(VolumeStatusInfoStatus value);
+
+/**
+ * Same as GetNameForVolumeStatusInfoStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVolumeStatusInfoStatusCStr(VolumeStatusInfoStatus value);
 } // namespace VolumeStatusInfoStatusMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace VolumeStatusNameMapper
 AWS_EC2_API VolumeStatusName GetVolumeStatusNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVolumeStatusName(VolumeStatusName value);
+
+/**
+ * Same as GetNameForVolumeStatusName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVolumeStatusNameCStr(VolumeStatusName value);
 } // namespace VolumeStatusNameMapper
 } // namespace Model
 } // namespace EC2
@@ -38,6 +38,11 @@ namespace VolumeTypeMapper
 AWS_EC2_API VolumeType GetVolumeTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVolumeType(VolumeType value);
+
+/**
+ * Same as GetNameForVolumeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVolumeTypeCStr(VolumeType value);
 } // namespace VolumeTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace VpcAttributeNameMapper
 AWS_EC2_API VpcAttributeName GetVpcAttributeNameForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVpcAttributeName(VpcAttributeName value);
+
+/**
+ * Same as GetNameForVpcAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVpcAttributeNameCStr(VpcAttributeName value);
 } // namespace VpcAttributeNameMapper
 } // namespace Model
 } // namespace EC2
@@ -39,6 +39,11 @@ namespace VpcCidrBlockStateCodeMapper
 AWS_EC2_API VpcCidrBlockStateCode GetVpcCidrBlockStateCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVpcCidrBlockStateCode(VpcCidrBlockStateCode value);
+
+/**
+ * Same as GetNameForVpcCidrBlockStateCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVpcCidrBlockStateCodeCStr(VpcCidrBlockStateCode value);
 } // namespace VpcCidrBlockStateCodeMapper
 } // namespace Model
 } // namespace EC2
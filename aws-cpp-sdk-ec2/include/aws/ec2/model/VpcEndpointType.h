@@ -35,6 +35,11 @@ namespace VpcEndpointTypeMapper
 AWS_EC2_API VpcEndpointType GetVpcEndpointTypeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVpcEndpointType(VpcEndpointType value);
+
+/**
+ * Same as GetNameForVpcEndpointType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVpcEndpointTypeCStr(VpcEndpointType value);
 } // namespace VpcEndpointTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -42,6 +42,11 @@ namespace VpcPeeringConnectionStateReasonCodeMapper
 AWS_EC2_API VpcPeeringConnectionStateReasonCode GetVpcPeeringConnectionStateReasonCodeForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVpcPeeringConnectionStateReasonCode(VpcPeeringConnectionStateReasonCode value);
+
+/**
+ * Same as GetNameForVpcPeeringConnectionStateReasonCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVpcPeeringConnectionStateReasonCodeCStr(VpcPeeringConnectionStateReasonCode value);
 } // namespace VpcPeeringConnectionStateReasonCodeMapper
 } // namespace Model
 } // namespace EC2
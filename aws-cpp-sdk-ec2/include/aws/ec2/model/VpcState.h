@@ -35,6 +35,11 @@ namespace VpcStateMapper
 AWS_EC2_API VpcState GetVpcStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVpcState(VpcState value);
+
+/**
+ * Same as GetNameForVpcState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVpcStateCStr(VpcState value);
 } // namespace VpcStateMapper
 } // namespace Model
 } // namespace EC2
@@ -34,6 +34,11 @@ namespace VpcTenancyMapper
 AWS_EC2_API VpcTenancy GetVpcTenancyForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVpcTenancy(VpcTenancy value);
+
+/**
+ * Same as GetNameForVpcTenancy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVpcTenancyCStr(VpcTenancy value);
 } // namespace VpcTenancyMapper
 } // namespace Model
 } // namespace EC2
@@ -35,6 +35,11 @@ namespace VpnEcmpSupportValueMapper
 AWS_EC2_API VpnEcmpSupportValue GetVpnEcmpSupportValueForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVpnEcmpSupportValue(VpnEcmpSupportValue value);
+
+/**
+ * Same as GetNameForVpnEcmpSupportValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVpnEcmpSupportValueCStr(VpnEcmpSupportValue value);
 } // namespace VpnEcmpSupportValueMapper
 } // namespace Model
 } // namespace EC2
@@ -34,6 +34,11 @@ namespace VpnProtocolMapper
 AWS_EC2_API VpnProtocol GetVpnProtocolForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVpnProtocol(VpnProtocol value);
+
+/**
+ * Same as GetNameForVpnProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVpnProtocolCStr(VpnProtocol value);
 } // namespace VpnProtocolMapper
 } // namespace Model
 } // namespace EC2
@@ -37,6 +37,11 @@ namespace VpnStateMapper
 AWS_EC2_API VpnState GetVpnStateForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVpnState(VpnState value);
+
+/**
+ * Same as GetNameForVpnState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVpnStateCStr(VpnState value);
 } // namespace VpnStateMapper
 } // namespace Model
 } // namespace EC2
@@ -34,6 +34,11 @@ namespace VpnStaticRouteSourceMapper
 AWS_EC2_API VpnStaticRouteSource GetVpnStaticRouteSourceForName(const Aws::String& name);
 
 AWS_EC2_API Aws::String GetNameForVpnStaticRouteSource(VpnStaticRouteSource value);
+
+/**
+ * Same as GetNameForVpnStaticRouteSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EC2_API const char* GetNameForVpnStaticRouteSourceCStr(VpnStaticRouteSource value);
 } // namespace VpnStaticRouteSourceMapper
 } // namespace Model
 } // namespace EC2
@@ -30,20 +30,37 @@ namespace Aws
       namespace AccountAttributeNameMapper
       {
 
-        static const int supported_platforms_HASH = HashingUtils::HashString("supported-platforms");
-        static const int default_vpc_HASH = HashingUtils::HashString("default-vpc");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "supported-platforms",
+          "default-vpc",
+        };
 
         AccountAttributeName GetAccountAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == supported_platforms_HASH)
-          {
-            return AccountAttributeName::supported_platforms;
-          }
-          else if (hashCode == default_vpc_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccountAttributeName::default_vpc;
+          case 2112019457:
+            if (name == "supported-platforms")
+            {
+              return AccountAttributeName::supported_platforms;
+            }
+            break;
+          case -438105251:
+            if (name == "default-vpc")
+            {
+              return AccountAttributeName::default_vpc;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AccountAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForAccountAttributeName(AccountAttributeName enumValue)
+        const char* GetNameForAccountAttributeNameCStr(AccountAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccountAttributeName::supported_platforms:
-            return "supported-platforms";
-          case AccountAttributeName::default_vpc:
-            return "default-vpc";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccountAttributeName(AccountAttributeName enumValue)
+        {
+          return GetNameForAccountAttributeNameCStr(enumValue);
         }
 
       } // namespace AccountAttributeNameMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ActivityStatusMapper
       {
 
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int pending_fulfillment_HASH = HashingUtils::HashString("pending_fulfillment");
-        static const int pending_termination_HASH = HashingUtils::HashString("pending_termination");
-        static const int fulfilled_HASH = HashingUtils::HashString("fulfilled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "error",
+          "pending_fulfillment",
+          "pending_termination",
+          "fulfilled",
+        };
 
         ActivityStatus GetActivityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == error_HASH)
-          {
-            return ActivityStatus::error;
-          }
-          else if (hashCode == pending_fulfillment_HASH)
-          {
-            return ActivityStatus::pending_fulfillment;
-          }
-          else if (hashCode == pending_termination_HASH)
-          {
-            return ActivityStatus::pending_termination;
-          }
-          else if (hashCode == fulfilled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActivityStatus::fulfilled;
+          case 96784904:
+            if (name == "error")
+            {
+              return ActivityStatus::error;
+            }
+            break;
+          case 1646628662:
+            if (name == "pending_fulfillment")
+            {
+              return ActivityStatus::pending_fulfillment;
+            }
+            break;
+          case -1784347556:
+            if (name == "pending_termination")
+            {
+              return ActivityStatus::pending_termination;
+            }
+            break;
+          case -1839765217:
+            if (name == "fulfilled")
+            {
+              return ActivityStatus::fulfilled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ActivityStatus::NOT_SET;
         }
 
-        Aws::String GetNameForActivityStatus(ActivityStatus enumValue)
+        const char* GetNameForActivityStatusCStr(ActivityStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActivityStatus::error:
-            return "error";
-          case ActivityStatus::pending_fulfillment:
-            return "pending_fulfillment";
-          case ActivityStatus::pending_termination:
-            return "pending_termination";
-          case ActivityStatus::fulfilled:
-            return "fulfilled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActivityStatus(ActivityStatus enumValue)
+        {
+          return GetNameForActivityStatusCStr(enumValue);
         }
 
       } // namespace ActivityStatusMapper
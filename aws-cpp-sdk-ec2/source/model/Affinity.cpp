@@ -30,20 +30,37 @@ namespace Aws
       namespace AffinityMapper
       {
 
-        static const int default__HASH = HashingUtils::HashString("default");
-        static const int host_HASH = HashingUtils::HashString("host");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "default",
+          "host",
+        };
 
         Affinity GetAffinityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == default__HASH)
-          {
-            return Affinity::default_;
-          }
-          else if (hashCode == host_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Affinity::host;
+          case 1544803905:
+            if (name == "default")
+            {
+              return Affinity::default_;
+            }
+            break;
+          case 3208616:
+            if (name == "host")
+            {
+              return Affinity::host;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Affinity::NOT_SET;
         }
 
-        Aws::String GetNameForAffinity(Affinity enumValue)
+        const char* GetNameForAffinityCStr(Affinity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Affinity::default_:
-            return "default";
-          case Affinity::host:
-            return "host";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAffinity(Affinity enumValue)
+        {
+          return GetNameForAffinityCStr(enumValue);
         }
 
       } // namespace AffinityMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace AllocationStateMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int under_assessment_HASH = HashingUtils::HashString("under-assessment");
-        static const int permanent_failure_HASH = HashingUtils::HashString("permanent-failure");
-        static const int released_HASH = HashingUtils::HashString("released");
-        static const int released_permanent_failure_HASH = HashingUtils::HashString("released-permanent-failure");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "available",
+          "under-assessment",
+          "permanent-failure",
+          "released",
+          "released-permanent-failure",
+        };
 
         AllocationState GetAllocationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AllocationState::available;
-          }
-          else if (hashCode == under_assessment_HASH)
-          {
-            return AllocationState::under_assessment;
-          }
-          else if (hashCode == permanent_failure_HASH)
-          {
-            return AllocationState::permanent_failure;
-          }
-          else if (hashCode == released_HASH)
-          {
-            return AllocationState::released;
-          }
-          else if (hashCode == released_permanent_failure_HASH)
-          {
-            return AllocationState::released_permanent_failure;
+          case -733902135:
+            if (name == "available")
+            {
+              return AllocationState::available;
+            }
+            break;
+          case 535341271:
+            if (name == "under-assessment")
+            {
+              return AllocationState::under_assessment;
+            }
+            break;
+          case 211344235:
+            if (name == "permanent-failure")
+            {
+              return AllocationState::permanent_failure;
+            }
+            break;
+          case -551298755:
+            if (name == "released")
+            {
+              return AllocationState::released;
+            }
+            break;
+          case -2062123301:
+            if (name == "released-permanent-failure")
+            {
+              return AllocationState::released_permanent_failure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return AllocationState::NOT_SET;
         }
 
-        Aws::String GetNameForAllocationState(AllocationState enumValue)
+        const char* GetNameForAllocationStateCStr(AllocationState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AllocationState::available:
-            return "available";
-          case AllocationState::under_assessment:
-            return "under-assessment";
-          case AllocationState::permanent_failure:
-            return "permanent-failure";
-          case AllocationState::released:
-            return "released";
-          case AllocationState::released_permanent_failure:
-            return "released-permanent-failure";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAllocationState(AllocationState enumValue)
+        {
+          return GetNameForAllocationStateCStr(enumValue);
         }
 
       } // namespace AllocationStateMapper
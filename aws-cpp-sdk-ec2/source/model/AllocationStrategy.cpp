@@ -30,20 +30,37 @@ namespace Aws
       namespace AllocationStrategyMapper
       {
 
-        static const int lowestPrice_HASH = HashingUtils::HashString("lowestPrice");
-        static const int diversified_HASH = HashingUtils::HashString("diversified");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "lowestPrice",
+          "diversified",
+        };
 
         AllocationStrategy GetAllocationStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == lowestPrice_HASH)
-          {
-            return AllocationStrategy::lowestPrice;
-          }
-          else if (hashCode == diversified_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AllocationStrategy::diversified;
+          case 838159031:
+            if (name == "lowestPrice")
+            {
+              return AllocationStrategy::lowestPrice;
+            }
+            break;
+          case 127033974:
+            if (name == "diversified")
+            {
+              return AllocationStrategy::diversified;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AllocationStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForAllocationStrategy(AllocationStrategy enumValue)
+        const char* GetNameForAllocationStrategyCStr(AllocationStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AllocationStrategy::lowestPrice:
-            return "lowestPrice";
-          case AllocationStrategy::diversified:
-            return "diversified";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAllocationStrategy(AllocationStrategy enumValue)
+        {
+          return GetNameForAllocationStrategyCStr(enumValue);
         }
 
       } // namespace AllocationStrategyMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ArchitectureValuesMapper
       {
 
-        static const int i386_HASH = HashingUtils::HashString("i386");
-        static const int x86_64_HASH = HashingUtils::HashString("x86_64");
-        static const int arm64_HASH = HashingUtils::HashString("arm64");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "i386",
+          "x86_64",
+          "arm64",
+        };
 
         ArchitectureValues GetArchitectureValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == i386_HASH)
-          {
-            return ArchitectureValues::i386;
-          }
-          else if (hashCode == x86_64_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ArchitectureValues::x86_64;
-          }
-          else if (hashCode == arm64_HASH)
-          {
-            return ArchitectureValues::arm64;
+          case 3178856:
+            if (name == "i386")
+            {
+              return ArchitectureValues::i386;
+            }
+            break;
+          case -806050265:
+            if (name == "x86_64")
+            {
+              return ArchitectureValues::x86_64;
+            }
+            break;
+          case 93084186:
+            if (name == "arm64")
+            {
+              return ArchitectureValues::arm64;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ArchitectureValues::NOT_SET;
         }
 
-        Aws::String GetNameForArchitectureValues(ArchitectureValues enumValue)
+        const char* GetNameForArchitectureValuesCStr(ArchitectureValues enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ArchitectureValues::i386:
-            return "i386";
-          case ArchitectureValues::x86_64:
-            return "x86_64";
-          case ArchitectureValues::arm64:
-            return "arm64";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForArchitectureValues(ArchitectureValues enumValue)
+        {
+          return GetNameForArchitectureValuesCStr(enumValue);
         }
 
       } // namespace ArchitectureValuesMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace AssociatedNetworkTypeMapper
       {
 
-        static const int vpc_HASH = HashingUtils::HashString("vpc");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "vpc",
+        };
 
         AssociatedNetworkType GetAssociatedNetworkTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == vpc_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssociatedNetworkType::vpc;
+          case 116969:
+            if (name == "vpc")
+            {
+              return AssociatedNetworkType::vpc;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return AssociatedNetworkType::NOT_SET;
         }
 
-        Aws::String GetNameForAssociatedNetworkType(AssociatedNetworkType enumValue)
+        const char* GetNameForAssociatedNetworkTypeCStr(AssociatedNetworkType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssociatedNetworkType::vpc:
-            return "vpc";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssociatedNetworkType(AssociatedNetworkType enumValue)
+        {
+          return GetNameForAssociatedNetworkTypeCStr(enumValue);
         }
 
       } // namespace AssociatedNetworkTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace AssociationStatusCodeMapper
       {
 
-        static const int associating_HASH = HashingUtils::HashString("associating");
-        static const int associated_HASH = HashingUtils::HashString("associated");
-        static const int association_failed_HASH = HashingUtils::HashString("association-failed");
-        static const int disassociating_HASH = HashingUtils::HashString("disassociating");
-        static const int disassociated_HASH = HashingUtils::HashString("disassociated");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "associating",
+          "associated",
+          "association-failed",
+          "disassociating",
+          "disassociated",
+        };
 
         AssociationStatusCode GetAssociationStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == associating_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssociationStatusCode::associating;
-          }
-          else if (hashCode == associated_HASH)
-          {
-            return AssociationStatusCode::associated;
-          }
-          else if (hashCode == association_failed_HASH)
-          {
-            return AssociationStatusCode::association_failed;
-          }
-          else if (hashCode == disassociating_HASH)
-          {
-            return AssociationStatusCode::disassociating;
-          }
-          else if (hashCode == disassociated_HASH)
-          {
-            return AssociationStatusCode::disassociated;
+          case -87499685:
+            if (name == "associating")
+            {
+              return AssociationStatusCode::associating;
+            }
+            break;
+          case 1936839942:
+            if (name == "associated")
+            {
+              return AssociationStatusCode::associated;
+            }
+            break;
+          case -1353826551:
+            if (name == "association-failed")
+            {
+              return AssociationStatusCode::association_failed;
+            }
+            break;
+          case 2113311501:
+            if (name == "disassociating")
+            {
+              return AssociationStatusCode::disassociating;
+            }
+            break;
+          case -1455849452:
+            if (name == "disassociated")
+            {
+              return AssociationStatusCode::disassociated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return AssociationStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationStatusCode(AssociationStatusCode enumValue)
+        const char* GetNameForAssociationStatusCodeCStr(AssociationStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssociationStatusCode::associating:
-            return "associating";
-          case AssociationStatusCode::associated:
-            return "associated";
-          case AssociationStatusCode::association_failed:
-            return "association-failed";
-          case AssociationStatusCode::disassociating:
-            return "disassociating";
-          case AssociationStatusCode::disassociated:
-            return "disassociated";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssociationStatusCode(AssociationStatusCode enumValue)
+        {
+          return GetNameForAssociationStatusCodeCStr(enumValue);
         }
 
       } // namespace AssociationStatusCodeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace AttachmentStatusMapper
       {
 
-        static const int attaching_HASH = HashingUtils::HashString("attaching");
-        static const int attached_HASH = HashingUtils::HashString("attached");
-        static const int detaching_HASH = HashingUtils::HashString("detaching");
-        static const int detached_HASH = HashingUtils::HashString("detached");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "attaching",
+          "attached",
+          "detaching",
+          "detached",
+        };
 
         AttachmentStatus GetAttachmentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == attaching_HASH)
-          {
-            return AttachmentStatus::attaching;
-          }
-          else if (hashCode == attached_HASH)
-          {
-            return AttachmentStatus::attached;
-          }
-          else if (hashCode == detaching_HASH)
-          {
-            return AttachmentStatus::detaching;
-          }
-          else if (hashCode == detached_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AttachmentStatus::detached;
+          case -478984323:
+            if (name == "attaching")
+            {
+              return AttachmentStatus::attaching;
+            }
+            break;
+          case 538738084:
+            if (name == "attached")
+            {
+              return AttachmentStatus::attached;
+            }
+            break;
+          case -1978731665:
+            if (name == "detaching")
+            {
+              return AttachmentStatus::detaching;
+            }
+            break;
+          case 1044548466:
+            if (name == "detached")
+            {
+              return AttachmentStatus::detached;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AttachmentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAttachmentStatus(AttachmentStatus enumValue)
+        const char* GetNameForAttachmentStatusCStr(AttachmentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AttachmentStatus::attaching:
-            return "attaching";
-          case AttachmentStatus::attached:
-            return "attached";
-          case AttachmentStatus::detaching:
-            return "detaching";
-          case AttachmentStatus::detached:
-            return "detached";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAttachmentStatus(AttachmentStatus enumValue)
+        {
+          return GetNameForAttachmentStatusCStr(enumValue);
         }
 
       } // namespace AttachmentStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace AutoPlacementMapper
       {
 
-        static const int on_HASH = HashingUtils::HashString("on");
-        static const int off_HASH = HashingUtils::HashString("off");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "on",
+          "off",
+        };
 
         AutoPlacement GetAutoPlacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == on_HASH)
-          {
-            return AutoPlacement::on;
-          }
-          else if (hashCode == off_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AutoPlacement::off;
+          case 3551:
+            if (name == "on")
+            {
+              return AutoPlacement::on;
+            }
+            break;
+          case 109935:
+            if (name == "off")
+            {
+              return AutoPlacement::off;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AutoPlacement::NOT_SET;
         }
 
-        Aws::String GetNameForAutoPlacement(AutoPlacement enumValue)
+        const char* GetNameForAutoPlacementCStr(AutoPlacement enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AutoPlacement::on:
-            return "on";
-          case AutoPlacement::off:
-            return "off";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAutoPlacement(AutoPlacement enumValue)
+        {
+          return GetNameForAutoPlacementCStr(enumValue);
         }
 
       } // namespace AutoPlacementMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace AvailabilityZoneStateMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int information_HASH = HashingUtils::HashString("information");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
-        static const int unavailable_HASH = HashingUtils::HashString("unavailable");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "available",
+          "information",
+          "impaired",
+          "unavailable",
+        };
 
         AvailabilityZoneState GetAvailabilityZoneStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
-          {
-            return AvailabilityZoneState::available;
-          }
-          else if (hashCode == information_HASH)
-          {
-            return AvailabilityZoneState::information;
-          }
-          else if (hashCode == impaired_HASH)
-          {
-            return AvailabilityZoneState::impaired;
-          }
-          else if (hashCode == unavailable_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AvailabilityZoneState::unavailable;
+          case -733902135:
+            if (name == "available")
+            {
+              return AvailabilityZoneState::available;
+            }
+            break;
+          case 1968600364:
+            if (name == "information")
+            {
+              return AvailabilityZoneState::information;
+            }
+            break;
+          case -435567843:
+            if (name == "impaired")
+            {
+              return AvailabilityZoneState::impaired;
+            }
+            break;
+          case -665462704:
+            if (name == "unavailable")
+            {
+              return AvailabilityZoneState::unavailable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AvailabilityZoneState::NOT_SET;
         }
 
-        Aws::String GetNameForAvailabilityZoneState(AvailabilityZoneState enumValue)
+        const char* GetNameForAvailabilityZoneStateCStr(AvailabilityZoneState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AvailabilityZoneState::available:
-            return "available";
-          case AvailabilityZoneState::information:
-            return "information";
-          case AvailabilityZoneState::impaired:
-            return "impaired";
-          case AvailabilityZoneState::unavailable:
-            return "unavailable";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAvailabilityZoneState(AvailabilityZoneState enumValue)
+        {
+          return GetNameForAvailabilityZoneStateCStr(enumValue);
         }
 
       } // namespace AvailabilityZoneStateMapper
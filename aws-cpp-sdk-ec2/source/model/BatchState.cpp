@@ -30,45 +30,72 @@ namespace Aws
       namespace BatchStateMapper
       {
 
-        static const int submitted_HASH = HashingUtils::HashString("submitted");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int cancelled_running_HASH = HashingUtils::HashString("cancelled_running");
-        static const int cancelled_terminating_HASH = HashingUtils::HashString("cancelled_terminating");
-        static const int modifying_HASH = HashingUtils::HashString("modifying");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "submitted",
+          "active",
+          "cancelled",
+          "failed",
+          "cancelled_running",
+          "cancelled_terminating",
+          "modifying",
+        };
 
         BatchState GetBatchStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == submitted_HASH)
-          {
-            return BatchState::submitted;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return BatchState::active;
-          }
-          else if (hashCode == cancelled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BatchState::cancelled;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return BatchState::failed;
-          }
-          else if (hashCode == cancelled_running_HASH)
-          {
-            return BatchState::cancelled_running;
-          }
-          else if (hashCode == cancelled_terminating_HASH)
-          {
-            return BatchState::cancelled_terminating;
-          }
-          else if (hashCode == modifying_HASH)
-          {
-            return BatchState::modifying;
+          case 348678395:
+            if (name == "submitted")
+            {
+              return BatchState::submitted;
+            }
+            break;
+          case -1422950650:
+            if (name == "active")
+            {
+              return BatchState::active;
+            }
+            break;
+          case 476588369:
+            if (name == "cancelled")
+            {
+              return BatchState::cancelled;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return BatchState::failed;
+            }
+            break;
+          case -53148463:
+            if (name == "cancelled_running")
+            {
+              return BatchState::cancelled_running;
+            }
+            break;
+          case -1669800720:
+            if (name == "cancelled_terminating")
+            {
+              return BatchState::cancelled_terminating;
+            }
+            break;
+          case -1900565272:
+            if (name == "modifying")
+            {
+              return BatchState::modifying;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return BatchState::NOT_SET;
         }
 
-        Aws::String GetNameForBatchState(BatchState enumValue)
+        const char* GetNameForBatchStateCStr(BatchState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BatchState::submitted:
-            return "submitted";
-          case BatchState::active:
-            return "active";
-          case BatchState::cancelled:
-            return "cancelled";
-          case BatchState::failed:
-            return "failed";
-          case BatchState::cancelled_running:
-            return "cancelled_running";
-          case BatchState::cancelled_terminating:
-            return "cancelled_terminating";
-          case BatchState::modifying:
-            return "modifying";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBatchState(BatchState enumValue)
+        {
+          return GetNameForBatchStateCStr(enumValue);
         }
 
       } // namespace BatchStateMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace BundleTaskStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int waiting_for_shutdown_HASH = HashingUtils::HashString("waiting-for-shutdown");
-        static const int bundling_HASH = HashingUtils::HashString("bundling");
-        static const int storing_HASH = HashingUtils::HashString("storing");
-        static const int cancelling_HASH = HashingUtils::HashString("cancelling");
-        static const int complete_HASH = HashingUtils::HashString("complete");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "waiting-for-shutdown",
+          "bundling",
+          "storing",
+          "cancelling",
+          "complete",
+          "failed",
+        };
 
         BundleTaskState GetBundleTaskStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return BundleTaskState::pending;
-          }
-          else if (hashCode == waiting_for_shutdown_HASH)
-          {
-            return BundleTaskState::waiting_for_shutdown;
-          }
-          else if (hashCode == bundling_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BundleTaskState::bundling;
-          }
-          else if (hashCode == storing_HASH)
-          {
-            return BundleTaskState::storing;
-          }
-          else if (hashCode == cancelling_HASH)
-          {
-            return BundleTaskState::cancelling;
-          }
-          else if (hashCode == complete_HASH)
-          {
-            return BundleTaskState::complete;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return BundleTaskState::failed;
+          case -682587753:
+            if (name == "pending")
+            {
+              return BundleTaskState::pending;
+            }
+            break;
+          case 596460122:
+            if (name == "waiting-for-shutdown")
+            {
+              return BundleTaskState::waiting_for_shutdown;
+            }
+            break;
+          case -1294650177:
+            if (name == "bundling")
+            {
+              return BundleTaskState::bundling;
+            }
+            break;
+          case -1884266146:
+            if (name == "storing")
+            {
+              return BundleTaskState::storing;
+            }
+            break;
+          case 1889341808:
+            if (name == "cancelling")
+            {
+              return BundleTaskState::cancelling;
+            }
+            break;
+          case -599445191:
+            if (name == "complete")
+            {
+              return BundleTaskState::complete;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return BundleTaskState::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return BundleTaskState::NOT_SET;
         }
 
-        Aws::String GetNameForBundleTaskState(BundleTaskState enumValue)
+        const char* GetNameForBundleTaskStateCStr(BundleTaskState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BundleTaskState::pending:
-            return "pending";
-          case BundleTaskState::waiting_for_shutdown:
-            return "waiting-for-shutdown";
-          case BundleTaskState::bundling:
-            return "bundling";
-          case BundleTaskState::storing:
-            return "storing";
-          case BundleTaskState::cancelling:
-            return "cancelling";
-          case BundleTaskState::complete:
-            return "complete";
-          case BundleTaskState::failed:
-            return "failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBundleTaskState(BundleTaskState enumValue)
+        {
+          return GetNameForBundleTaskStateCStr(enumValue);
         }
 
       } // namespace BundleTaskStateMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace ByoipCidrStateMapper
       {
 
-        static const int advertised_HASH = HashingUtils::HashString("advertised");
-        static const int deprovisioned_HASH = HashingUtils::HashString("deprovisioned");
-        static const int failed_deprovision_HASH = HashingUtils::HashString("failed-deprovision");
-        static const int failed_provision_HASH = HashingUtils::HashString("failed-provision");
-        static const int pending_deprovision_HASH = HashingUtils::HashString("pending-deprovision");
-        static const int pending_provision_HASH = HashingUtils::HashString("pending-provision");
-        static const int provisioned_HASH = HashingUtils::HashString("provisioned");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "advertised",
+          "deprovisioned",
+          "failed-deprovision",
+          "failed-provision",
+          "pending-deprovision",
+          "pending-provision",
+          "provisioned",
+        };
 
         ByoipCidrState GetByoipCidrStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == advertised_HASH)
-          {
-            return ByoipCidrState::advertised;
-          }
-          else if (hashCode == deprovisioned_HASH)
-          {
-            return ByoipCidrState::deprovisioned;
-          }
-          else if (hashCode == failed_deprovision_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ByoipCidrState::failed_deprovision;
-          }
-          else if (hashCode == failed_provision_HASH)
-          {
-            return ByoipCidrState::failed_provision;
-          }
-          else if (hashCode == pending_deprovision_HASH)
-          {
-            return ByoipCidrState::pending_deprovision;
-          }
-          else if (hashCode == pending_provision_HASH)
-          {
-            return ByoipCidrState::pending_provision;
-          }
-          else if (hashCode == provisioned_HASH)
-          {
-            return ByoipCidrState::provisioned;
+          case 72080669:
+            if (name == "advertised")
+            {
+              return ByoipCidrState::advertised;
+            }
+            break;
+          case -920285933:
+            if (name == "deprovisioned")
+            {
+              return ByoipCidrState::deprovisioned;
+            }
+            break;
+          case 1535000548:
+            if (name == "failed-deprovision")
+            {
+              return ByoipCidrState::failed_deprovision;
+            }
+            break;
+          case 842573637:
+            if (name == "failed-provision")
+            {
+              return ByoipCidrState::failed_provision;
+            }
+            break;
+          case -251593154:
+            if (name == "pending-deprovision")
+            {
+              return ByoipCidrState::pending_deprovision;
+            }
+            break;
+          case -97831905:
+            if (name == "pending-provision")
+            {
+              return ByoipCidrState::pending_provision;
+            }
+            break;
+          case -1797209036:
+            if (name == "provisioned")
+            {
+              return ByoipCidrState::provisioned;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ByoipCidrState::NOT_SET;
         }
 
-        Aws::String GetNameForByoipCidrState(ByoipCidrState enumValue)
+        const char* GetNameForByoipCidrStateCStr(ByoipCidrState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ByoipCidrState::advertised:
-            return "advertised";
-          case ByoipCidrState::deprovisioned:
-            return "deprovisioned";
-          case ByoipCidrState::failed_deprovision:
-            return "failed-deprovision";
-          case ByoipCidrState::failed_provision:
-            return "failed-provision";
-          case ByoipCidrState::pending_deprovision:
-            return "pending-deprovision";
-          case ByoipCidrState::pending_provision:
-            return "pending-provision";
-          case ByoipCidrState::provisioned:
-            return "provisioned";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForByoipCidrState(ByoipCidrState enumValue)
+        {
+          return GetNameForByoipCidrStateCStr(enumValue);
         }
 
       } // namespace ByoipCidrStateMapper
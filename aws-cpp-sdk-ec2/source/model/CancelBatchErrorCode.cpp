@@ -30,30 +30,51 @@ namespace Aws
       namespace CancelBatchErrorCodeMapper
       {
 
-        static const int fleetRequestIdDoesNotExist_HASH = HashingUtils::HashString("fleetRequestIdDoesNotExist");
-        static const int fleetRequestIdMalformed_HASH = HashingUtils::HashString("fleetRequestIdMalformed");
-        static const int fleetRequestNotInCancellableState_HASH = HashingUtils::HashString("fleetRequestNotInCancellableState");
-        static const int unexpectedError_HASH = HashingUtils::HashString("unexpectedError");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "fleetRequestIdDoesNotExist",
+          "fleetRequestIdMalformed",
+          "fleetRequestNotInCancellableState",
+          "unexpectedError",
+        };
 
         CancelBatchErrorCode GetCancelBatchErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == fleetRequestIdDoesNotExist_HASH)
-          {
-            return CancelBatchErrorCode::fleetRequestIdDoesNotExist;
-          }
-          else if (hashCode == fleetRequestIdMalformed_HASH)
-          {
-            return CancelBatchErrorCode::fleetRequestIdMalformed;
-          }
-          else if (hashCode == fleetRequestNotInCancellableState_HASH)
-          {
-            return CancelBatchErrorCode::fleetRequestNotInCancellableState;
-          }
-          else if (hashCode == unexpectedError_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CancelBatchErrorCode::unexpectedError;
+          case -1688989191:
+            if (name == "fleetRequestIdDoesNotExist")
+            {
+              return CancelBatchErrorCode::fleetRequestIdDoesNotExist;
+            }
+            break;
+          case -483855169:
+            if (name == "fleetRequestIdMalformed")
+            {
+              return CancelBatchErrorCode::fleetRequestIdMalformed;
+            }
+            break;
+          case -290190596:
+            if (name == "fleetRequestNotInCancellableState")
+            {
+              return CancelBatchErrorCode::fleetRequestNotInCancellableState;
+            }
+            break;
+          case 1317945399:
+            if (name == "unexpectedError")
+            {
+              return CancelBatchErrorCode::unexpectedError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return CancelBatchErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForCancelBatchErrorCode(CancelBatchErrorCode enumValue)
+        const char* GetNameForCancelBatchErrorCodeCStr(CancelBatchErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CancelBatchErrorCode::fleetRequestIdDoesNotExist:
-            return "fleetRequestIdDoesNotExist";
-          case CancelBatchErrorCode::fleetRequestIdMalformed:
-            return "fleetRequestIdMalformed";
-          case CancelBatchErrorCode::fleetRequestNotInCancellableState:
-            return "fleetRequestNotInCancellableState";
-          case CancelBatchErrorCode::unexpectedError:
-            return "unexpectedError";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCancelBatchErrorCode(CancelBatchErrorCode enumValue)
+        {
+          return GetNameForCancelBatchErrorCodeCStr(enumValue);
         }
 
       } // namespace CancelBatchErrorCodeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace CancelSpotInstanceRequestStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int closed_HASH = HashingUtils::HashString("closed");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int completed_HASH = HashingUtils::HashString("completed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "active",
+          "open",
+          "closed",
+          "cancelled",
+          "completed",
+        };
 
         CancelSpotInstanceRequestState GetCancelSpotInstanceRequestStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CancelSpotInstanceRequestState::active;
-          }
-          else if (hashCode == open_HASH)
-          {
-            return CancelSpotInstanceRequestState::open;
-          }
-          else if (hashCode == closed_HASH)
-          {
-            return CancelSpotInstanceRequestState::closed;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return CancelSpotInstanceRequestState::cancelled;
-          }
-          else if (hashCode == completed_HASH)
-          {
-            return CancelSpotInstanceRequestState::completed;
+          case -1422950650:
+            if (name == "active")
+            {
+              return CancelSpotInstanceRequestState::active;
+            }
+            break;
+          case 3417674:
+            if (name == "open")
+            {
+              return CancelSpotInstanceRequestState::open;
+            }
+            break;
+          case -1357520532:
+            if (name == "closed")
+            {
+              return CancelSpotInstanceRequestState::closed;
+            }
+            break;
+          case 476588369:
+            if (name == "cancelled")
+            {
+              return CancelSpotInstanceRequestState::cancelled;
+            }
+            break;
+          case -1402931637:
+            if (name == "completed")
+            {
+              return CancelSpotInstanceRequestState::completed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return CancelSpotInstanceRequestState::NOT_SET;
         }
 
-        Aws::String GetNameForCancelSpotInstanceRequestState(CancelSpotInstanceRequestState enumValue)
+        const char* GetNameForCancelSpotInstanceRequestStateCStr(CancelSpotInstanceRequestState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CancelSpotInstanceRequestState::active:
-            return "active";
-          case CancelSpotInstanceRequestState::open:
-            return "open";
-          case CancelSpotInstanceRequestState::closed:
-            return "closed";
-          case CancelSpotInstanceRequestState::cancelled:
-            return "cancelled";
-          case CancelSpotInstanceRequestState::completed:
-            return "completed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCancelSpotInstanceRequestState(CancelSpotInstanceRequestState enumValue)
+        {
+          return GetNameForCancelSpotInstanceRequestStateCStr(enumValue);
         }
 
       } // namespace CancelSpotInstanceRequestStateMapper
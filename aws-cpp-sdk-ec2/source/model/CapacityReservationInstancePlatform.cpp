@@ -30,50 +30,79 @@ namespace Aws
       namespace CapacityReservationInstancePlatformMapper
       {
 
-        static const int Linux_UNIX_HASH = HashingUtils::HashString("Linux/UNIX");
-        static const int Red_Hat_Enterprise_Linux_HASH = HashingUtils::HashString("Red Hat Enterprise Linux");
-        static const int SUSE_Linux_HASH = HashingUtils::HashString("SUSE Linux");
-        static const int Windows_HASH = HashingUtils::HashString("Windows");
-        static const int Windows_with_SQL_Server_HASH = HashingUtils::HashString("Windows with SQL Server");
-        static const int Windows_with_SQL_Server_Enterprise_HASH = HashingUtils::HashString("Windows with SQL Server Enterprise");
-        static const int Windows_with_SQL_Server_Standard_HASH = HashingUtils::HashString("Windows with SQL Server Standard");
-        static const int Windows_with_SQL_Server_Web_HASH = HashingUtils::HashString("Windows with SQL Server Web");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Linux/UNIX",
+          "Red Hat Enterprise Linux",
+          "SUSE Linux",
+          "Windows",
+          "Windows with SQL Server",
+          "Windows with SQL Server Enterprise",
+          "Windows with SQL Server Standard",
+          "Windows with SQL Server Web",
+        };
 
         CapacityReservationInstancePlatform GetCapacityReservationInstancePlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Linux_UNIX_HASH)
-          {
-            return CapacityReservationInstancePlatform::Linux_UNIX;
-          }
-          else if (hashCode == Red_Hat_Enterprise_Linux_HASH)
-          {
-            return CapacityReservationInstancePlatform::Red_Hat_Enterprise_Linux;
-          }
-          else if (hashCode == SUSE_Linux_HASH)
-          {
-            return CapacityReservationInstancePlatform::SUSE_Linux;
-          }
-          else if (hashCode == Windows_HASH)
-          {
-            return CapacityReservationInstancePlatform::Windows;
-          }
-          else if (hashCode == Windows_with_SQL_Server_HASH)
-          {
-            return CapacityReservationInstancePlatform::Windows_with_SQL_Server;
-          }
-          else if (hashCode == Windows_with_SQL_Server_Enterprise_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CapacityReservationInstancePlatform::Windows_with_SQL_Server_Enterprise;
-          }
-          else if (hashCode == Windows_with_SQL_Server_Standard_HASH)
-          {
-            return CapacityReservationInstancePlatform::Windows_with_SQL_Server_Standard;
-          }
-          else if (hashCode == Windows_with_SQL_Server_Web_HASH)
-          {
-            return CapacityReservationInstancePlatform::Windows_with_SQL_Server_Web;
+          case -178444829:
+            if (name == "Linux/UNIX")
+            {
+              return CapacityReservationInstancePlatform::Linux_UNIX;
+            }
+            break;
+          case 545749705:
+            if (name == "Red Hat Enterprise Linux")
+            {
+              return CapacityReservationInstancePlatform::Red_Hat_Enterprise_Linux;
+            }
+            break;
+          case -1718386200:
+            if (name == "SUSE Linux")
+            {
+              return CapacityReservationInstancePlatform::SUSE_Linux;
+            }
+            break;
+          case -1280820637:
+            if (name == "Windows")
+            {
+              return CapacityReservationInstancePlatform::Windows;
+            }
+            break;
+          case -1586101774:
+            if (name == "Windows with SQL Server")
+            {
+              return CapacityReservationInstancePlatform::Windows_with_SQL_Server;
+            }
+            break;
+          case -739435921:
+            if (name == "Windows with SQL Server Enterprise")
+            {
+              return CapacityReservationInstancePlatform::Windows_with_SQL_Server_Enterprise;
+            }
+            break;
+          case -1261604533:
+            if (name == "Windows with SQL Server Standard")
+            {
+              return CapacityReservationInstancePlatform::Windows_with_SQL_Server_Standard;
+            }
+            break;
+          case 300914694:
+            if (name == "Windows with SQL Server Web")
+            {
+              return CapacityReservationInstancePlatform::Windows_with_SQL_Server_Web;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return CapacityReservationInstancePlatform::NOT_SET;
         }
 
-        Aws::String GetNameForCapacityReservationInstancePlatform(CapacityReservationInstancePlatform enumValue)
+        const char* GetNameForCapacityReservationInstancePlatformCStr(CapacityReservationInstancePlatform enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CapacityReservationInstancePlatform::Linux_UNIX:
-            return "Linux/UNIX";
-          case CapacityReservationInstancePlatform::Red_Hat_Enterprise_Linux:
-            return "Red Hat Enterprise Linux";
-          case CapacityReservationInstancePlatform::SUSE_Linux:
-            return "SUSE Linux";
-          case CapacityReservationInstancePlatform::Windows:
-            return "Windows";
-          case CapacityReservationInstancePlatform::Windows_with_SQL_Server:
-            return "Windows with SQL Server";
-          case CapacityReservationInstancePlatform::Windows_with_SQL_Server_Enterprise:
-            return "Windows with SQL Server Enterprise";
-          case CapacityReservationInstancePlatform::Windows_with_SQL_Server_Standard:
-            return "Windows with SQL Server Standard";
-          case CapacityReservationInstancePlatform::Windows_with_SQL_Server_Web:
-            return "Windows with SQL Server Web";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCapacityReservationInstancePlatform(CapacityReservationInstancePlatform enumValue)
+        {
+          return GetNameForCapacityReservationInstancePlatformCStr(enumValue);
         }
 
       } // namespace CapacityReservationInstancePlatformMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CapacityReservationPreferenceMapper
       {
 
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int none_HASH = HashingUtils::HashString("none");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "open",
+          "none",
+        };
 
         CapacityReservationPreference GetCapacityReservationPreferenceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == open_HASH)
-          {
-            return CapacityReservationPreference::open;
-          }
-          else if (hashCode == none_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CapacityReservationPreference::none;
+          case 3417674:
+            if (name == "open")
+            {
+              return CapacityReservationPreference::open;
+            }
+            break;
+          case 3387192:
+            if (name == "none")
+            {
+              return CapacityReservationPreference::none;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CapacityReservationPreference::NOT_SET;
         }
 
-        Aws::String GetNameForCapacityReservationPreference(CapacityReservationPreference enumValue)
+        const char* GetNameForCapacityReservationPreferenceCStr(CapacityReservationPreference enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CapacityReservationPreference::open:
-            return "open";
-          case CapacityReservationPreference::none:
-            return "none";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCapacityReservationPreference(CapacityReservationPreference enumValue)
+        {
+          return GetNameForCapacityReservationPreferenceCStr(enumValue);
         }
 
       } // namespace CapacityReservationPreferenceMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace CapacityReservationStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int expired_HASH = HashingUtils::HashString("expired");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "active",
+          "expired",
+          "cancelled",
+          "pending",
+          "failed",
+        };
 
         CapacityReservationState GetCapacityReservationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CapacityReservationState::active;
-          }
-          else if (hashCode == expired_HASH)
-          {
-            return CapacityReservationState::expired;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return CapacityReservationState::cancelled;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return CapacityReservationState::pending;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return CapacityReservationState::failed;
+          case -1422950650:
+            if (name == "active")
+            {
+              return CapacityReservationState::active;
+            }
+            break;
+          case -1309235419:
+            if (name == "expired")
+            {
+              return CapacityReservationState::expired;
+            }
+            break;
+          case 476588369:
+            if (name == "cancelled")
+            {
+              return CapacityReservationState::cancelled;
+            }
+            break;
+          case -682587753:
+            if (name == "pending")
+            {
+              return CapacityReservationState::pending;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return CapacityReservationState::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return CapacityReservationState::NOT_SET;
         }
 
-        Aws::String GetNameForCapacityReservationState(CapacityReservationState enumValue)
+        const char* GetNameForCapacityReservationStateCStr(CapacityReservationState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CapacityReservationState::active:
-            return "active";
-          case CapacityReservationState::expired:
-            return "expired";
-          case CapacityReservationState::cancelled:
-            return "cancelled";
-          case CapacityReservationState::pending:
-            return "pending";
-          case CapacityReservationState::failed:
-            return "failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCapacityReservationState(CapacityReservationState enumValue)
+        {
+          return GetNameForCapacityReservationStateCStr(enumValue);
         }
 
       } // namespace CapacityReservationStateMapper
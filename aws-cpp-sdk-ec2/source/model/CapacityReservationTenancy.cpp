@@ -30,20 +30,37 @@ namespace Aws
       namespace CapacityReservationTenancyMapper
       {
 
-        static const int default__HASH = HashingUtils::HashString("default");
-        static const int dedicated_HASH = HashingUtils::HashString("dedicated");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "default",
+          "dedicated",
+        };
 
         CapacityReservationTenancy GetCapacityReservationTenancyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == default__HASH)
-          {
-            return CapacityReservationTenancy::default_;
-          }
-          else if (hashCode == dedicated_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CapacityReservationTenancy::dedicated;
+          case 1544803905:
+            if (name == "default")
+            {
+              return CapacityReservationTenancy::default_;
+            }
+            break;
+          case 1229913583:
+            if (name == "dedicated")
+            {
+              return CapacityReservationTenancy::dedicated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CapacityReservationTenancy::NOT_SET;
         }
 
-        Aws::String GetNameForCapacityReservationTenancy(CapacityReservationTenancy enumValue)
+        const char* GetNameForCapacityReservationTenancyCStr(CapacityReservationTenancy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CapacityReservationTenancy::default_:
-            return "default";
-          case CapacityReservationTenancy::dedicated:
-            return "dedicated";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCapacityReservationTenancy(CapacityReservationTenancy enumValue)
+        {
+          return GetNameForCapacityReservationTenancyCStr(enumValue);
         }
 
       } // namespace CapacityReservationTenancyMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ClientCertificateRevocationListStatusCodeMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int active_HASH = HashingUtils::HashString("active");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "active",
+        };
 
         ClientCertificateRevocationListStatusCode GetClientCertificateRevocationListStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return ClientCertificateRevocationListStatusCode::pending;
-          }
-          else if (hashCode == active_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClientCertificateRevocationListStatusCode::active;
+          case -682587753:
+            if (name == "pending")
+            {
+              return ClientCertificateRevocationListStatusCode::pending;
+            }
+            break;
+          case -1422950650:
+            if (name == "active")
+            {
+              return ClientCertificateRevocationListStatusCode::active;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ClientCertificateRevocationListStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForClientCertificateRevocationListStatusCode(ClientCertificateRevocationListStatusCode enumValue)
+        const char* GetNameForClientCertificateRevocationListStatusCodeCStr(ClientCertificateRevocationListStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClientCertificateRevocationListStatusCode::pending:
-            return "pending";
-          case ClientCertificateRevocationListStatusCode::active:
-            return "active";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClientCertificateRevocationListStatusCode(ClientCertificateRevocationListStatusCode enumValue)
+        {
+          return GetNameForClientCertificateRevocationListStatusCodeCStr(enumValue);
         }
 
       } // namespace ClientCertificateRevocationListStatusCodeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ClientVpnAuthenticationTypeMapper
       {
 
-        static const int certificate_authentication_HASH = HashingUtils::HashString("certificate-authentication");
-        static const int directory_service_authentication_HASH = HashingUtils::HashString("directory-service-authentication");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "certificate-authentication",
+          "directory-service-authentication",
+        };
 
         ClientVpnAuthenticationType GetClientVpnAuthenticationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == certificate_authentication_HASH)
-          {
-            return ClientVpnAuthenticationType::certificate_authentication;
-          }
-          else if (hashCode == directory_service_authentication_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClientVpnAuthenticationType::directory_service_authentication;
+          case 1566182766:
+            if (name == "certificate-authentication")
+            {
+              return ClientVpnAuthenticationType::certificate_authentication;
+            }
+            break;
+          case 1506988016:
+            if (name == "directory-service-authentication")
+            {
+              return ClientVpnAuthenticationType::directory_service_authentication;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ClientVpnAuthenticationType::NOT_SET;
         }
 
-        Aws::String GetNameForClientVpnAuthenticationType(ClientVpnAuthenticationType enumValue)
+        const char* GetNameForClientVpnAuthenticationTypeCStr(ClientVpnAuthenticationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClientVpnAuthenticationType::certificate_authentication:
-            return "certificate-authentication";
-          case ClientVpnAuthenticationType::directory_service_authentication:
-            return "directory-service-authentication";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClientVpnAuthenticationType(ClientVpnAuthenticationType enumValue)
+        {
+          return GetNameForClientVpnAuthenticationTypeCStr(enumValue);
         }
 
       } // namespace ClientVpnAuthenticationTypeMapper
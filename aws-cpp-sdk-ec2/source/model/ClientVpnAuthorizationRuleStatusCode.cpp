@@ -30,30 +30,51 @@ namespace Aws
       namespace ClientVpnAuthorizationRuleStatusCodeMapper
       {
 
-        static const int authorizing_HASH = HashingUtils::HashString("authorizing");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int revoking_HASH = HashingUtils::HashString("revoking");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "authorizing",
+          "active",
+          "failed",
+          "revoking",
+        };
 
         ClientVpnAuthorizationRuleStatusCode GetClientVpnAuthorizationRuleStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == authorizing_HASH)
-          {
-            return ClientVpnAuthorizationRuleStatusCode::authorizing;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return ClientVpnAuthorizationRuleStatusCode::active;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return ClientVpnAuthorizationRuleStatusCode::failed;
-          }
-          else if (hashCode == revoking_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClientVpnAuthorizationRuleStatusCode::revoking;
+          case 722587238:
+            if (name == "authorizing")
+            {
+              return ClientVpnAuthorizationRuleStatusCode::authorizing;
+            }
+            break;
+          case -1422950650:
+            if (name == "active")
+            {
+              return ClientVpnAuthorizationRuleStatusCode::active;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return ClientVpnAuthorizationRuleStatusCode::failed;
+            }
+            break;
+          case -255483453:
+            if (name == "revoking")
+            {
+              return ClientVpnAuthorizationRuleStatusCode::revoking;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ClientVpnAuthorizationRuleStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForClientVpnAuthorizationRuleStatusCode(ClientVpnAuthorizationRuleStatusCode enumValue)
+        const char* GetNameForClientVpnAuthorizationRuleStatusCodeCStr(ClientVpnAuthorizationRuleStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClientVpnAuthorizationRuleStatusCode::authorizing:
-            return "authorizing";
-          case ClientVpnAuthorizationRuleStatusCode::active:
-            return "active";
-          case ClientVpnAuthorizationRuleStatusCode::failed:
-            return "failed";
-          case ClientVpnAuthorizationRuleStatusCode::revoking:
-            return "revoking";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClientVpnAuthorizationRuleStatusCode(ClientVpnAuthorizationRuleStatusCode enumValue)
+        {
+          return GetNameForClientVpnAuthorizationRuleStatusCodeCStr(enumValue);
         }
 
       } // namespace ClientVpnAuthorizationRuleStatusCodeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ClientVpnConnectionStatusCodeMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int failed_to_terminate_HASH = HashingUtils::HashString("failed-to-terminate");
-        static const int terminating_HASH = HashingUtils::HashString("terminating");
-        static const int terminated_HASH = HashingUtils::HashString("terminated");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "active",
+          "failed-to-terminate",
+          "terminating",
+          "terminated",
+        };
 
         ClientVpnConnectionStatusCode GetClientVpnConnectionStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
-          {
-            return ClientVpnConnectionStatusCode::active;
-          }
-          else if (hashCode == failed_to_terminate_HASH)
-          {
-            return ClientVpnConnectionStatusCode::failed_to_terminate;
-          }
-          else if (hashCode == terminating_HASH)
-          {
-            return ClientVpnConnectionStatusCode::terminating;
-          }
-          else if (hashCode == terminated_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClientVpnConnectionStatusCode::terminated;
+          case -1422950650:
+            if (name == "active")
+            {
+              return ClientVpnConnectionStatusCode::active;
+            }
+            break;
+          case -1115214561:
+            if (name == "failed-to-terminate")
+            {
+              return ClientVpnConnectionStatusCode::failed_to_terminate;
+            }
+            break;
+          case -1918581026:
+            if (name == "terminating")
+            {
+              return ClientVpnConnectionStatusCode::terminating;
+            }
+            break;
+          case -1308815837:
+            if (name == "terminated")
+            {
+              return ClientVpnConnectionStatusCode::terminated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ClientVpnConnectionStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForClientVpnConnectionStatusCode(ClientVpnConnectionStatusCode enumValue)
+        const char* GetNameForClientVpnConnectionStatusCodeCStr(ClientVpnConnectionStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClientVpnConnectionStatusCode::active:
-            return "active";
-          case ClientVpnConnectionStatusCode::failed_to_terminate:
-            return "failed-to-terminate";
-          case ClientVpnConnectionStatusCode::terminating:
-            return "terminating";
-          case ClientVpnConnectionStatusCode::terminated:
-            return "terminated";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClientVpnConnectionStatusCode(ClientVpnConnectionStatusCode enumValue)
+        {
+          return GetNameForClientVpnConnectionStatusCodeCStr(enumValue);
         }
 
       } // namespace ClientVpnConnectionStatusCodeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ClientVpnEndpointStatusCodeMapper
       {
 
-        static const int pending_associate_HASH = HashingUtils::HashString("pending-associate");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending-associate",
+          "available",
+          "deleting",
+          "deleted",
+        };
 
         ClientVpnEndpointStatusCode GetClientVpnEndpointStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_associate_HASH)
-          {
-            return ClientVpnEndpointStatusCode::pending_associate;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return ClientVpnEndpointStatusCode::available;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return ClientVpnEndpointStatusCode::deleting;
-          }
-          else if (hashCode == deleted_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClientVpnEndpointStatusCode::deleted;
+          case 2035788392:
+            if (name == "pending-associate")
+            {
+              return ClientVpnEndpointStatusCode::pending_associate;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return ClientVpnEndpointStatusCode::available;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return ClientVpnEndpointStatusCode::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return ClientVpnEndpointStatusCode::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ClientVpnEndpointStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForClientVpnEndpointStatusCode(ClientVpnEndpointStatusCode enumValue)
+        const char* GetNameForClientVpnEndpointStatusCodeCStr(ClientVpnEndpointStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClientVpnEndpointStatusCode::pending_associate:
-            return "pending-associate";
-          case ClientVpnEndpointStatusCode::available:
-            return "available";
-          case ClientVpnEndpointStatusCode::deleting:
-            return "deleting";
-          case ClientVpnEndpointStatusCode::deleted:
-            return "deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClientVpnEndpointStatusCode(ClientVpnEndpointStatusCode enumValue)
+        {
+          return GetNameForClientVpnEndpointStatusCodeCStr(enumValue);
         }
 
       } // namespace ClientVpnEndpointStatusCodeMapper
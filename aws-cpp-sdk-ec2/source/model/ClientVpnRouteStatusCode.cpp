@@ -30,30 +30,51 @@ namespace Aws
       namespace ClientVpnRouteStatusCodeMapper
       {
 
-        static const int creating_HASH = HashingUtils::HashString("creating");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "creating",
+          "active",
+          "failed",
+          "deleting",
+        };
 
         ClientVpnRouteStatusCode GetClientVpnRouteStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == creating_HASH)
-          {
-            return ClientVpnRouteStatusCode::creating;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return ClientVpnRouteStatusCode::active;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return ClientVpnRouteStatusCode::failed;
-          }
-          else if (hashCode == deleting_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClientVpnRouteStatusCode::deleting;
+          case 1820421817:
+            if (name == "creating")
+            {
+              return ClientVpnRouteStatusCode::creating;
+            }
+            break;
+          case -1422950650:
+            if (name == "active")
+            {
+              return ClientVpnRouteStatusCode::active;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return ClientVpnRouteStatusCode::failed;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return ClientVpnRouteStatusCode::deleting;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ClientVpnRouteStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForClientVpnRouteStatusCode(ClientVpnRouteStatusCode enumValue)
+        const char* GetNameForClientVpnRouteStatusCodeCStr(ClientVpnRouteStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClientVpnRouteStatusCode::creating:
-            return "creating";
-          case ClientVpnRouteStatusCode::active:
-            return "active";
-          case ClientVpnRouteStatusCode::failed:
-            return "failed";
-          case ClientVpnRouteStatusCode::deleting:
-            return "deleting";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClientVpnRouteStatusCode(ClientVpnRouteStatusCode enumValue)
+        {
+          return GetNameForClientVpnRouteStatusCodeCStr(enumValue);
         }
 
       } // namespace ClientVpnRouteStatusCodeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ConnectionNotificationTypeMapper
       {
 
-        static const int Topic_HASH = HashingUtils::HashString("Topic");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Topic",
+        };
 
         ConnectionNotificationType GetConnectionNotificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Topic_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectionNotificationType::Topic;
+          case 80993551:
+            if (name == "Topic")
+            {
+              return ConnectionNotificationType::Topic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ConnectionNotificationType::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionNotificationType(ConnectionNotificationType enumValue)
+        const char* GetNameForConnectionNotificationTypeCStr(ConnectionNotificationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectionNotificationType::Topic:
-            return "Topic";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectionNotificationType(ConnectionNotificationType enumValue)
+        {
+          return GetNameForConnectionNotificationTypeCStr(enumValue);
         }
 
       } // namespace ConnectionNotificationTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ContainerFormatMapper
       {
 
-        static const int ova_HASH = HashingUtils::HashString("ova");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ova",
+        };
 
         ContainerFormat GetContainerFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ova_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContainerFormat::ova;
+          case 110426:
+            if (name == "ova")
+            {
+              return ContainerFormat::ova;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ContainerFormat::NOT_SET;
         }
 
-        Aws::String GetNameForContainerFormat(ContainerFormat enumValue)
+        const char* GetNameForContainerFormatCStr(ContainerFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContainerFormat::ova:
-            return "ova";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContainerFormat(ContainerFormat enumValue)
+        {
+          return GetNameForContainerFormatCStr(enumValue);
         }
 
       } // namespace ContainerFormatMapper
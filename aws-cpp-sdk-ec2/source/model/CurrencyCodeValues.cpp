@@ -30,15 +30,30 @@ namespace Aws
       namespace CurrencyCodeValuesMapper
       {
 
-        static const int USD_HASH = HashingUtils::HashString("USD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USD",
+        };
 
         CurrencyCodeValues GetCurrencyCodeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CurrencyCodeValues::USD;
+          case 84326:
+            if (name == "USD")
+            {
+              return CurrencyCodeValues::USD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return CurrencyCodeValues::NOT_SET;
         }
 
-        Aws::String GetNameForCurrencyCodeValues(CurrencyCodeValues enumValue)
+        const char* GetNameForCurrencyCodeValuesCStr(CurrencyCodeValues enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CurrencyCodeValues::USD:
-            return "USD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCurrencyCodeValues(CurrencyCodeValues enumValue)
+        {
+          return GetNameForCurrencyCodeValuesCStr(enumValue);
         }
 
       } // namespace CurrencyCodeValuesMapper
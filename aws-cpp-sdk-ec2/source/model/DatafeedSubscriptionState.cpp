@@ -30,20 +30,37 @@ namespace Aws
       namespace DatafeedSubscriptionStateMapper
       {
 
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Inactive_HASH = HashingUtils::HashString("Inactive");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Active",
+          "Inactive",
+        };
 
         DatafeedSubscriptionState GetDatafeedSubscriptionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Active_HASH)
-          {
-            return DatafeedSubscriptionState::Active;
-          }
-          else if (hashCode == Inactive_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DatafeedSubscriptionState::Inactive;
+          case 1955883814:
+            if (name == "Active")
+            {
+              return DatafeedSubscriptionState::Active;
+            }
+            break;
+          case 89309323:
+            if (name == "Inactive")
+            {
+              return DatafeedSubscriptionState::Inactive;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DatafeedSubscriptionState::NOT_SET;
         }
 
-        Aws::String GetNameForDatafeedSubscriptionState(DatafeedSubscriptionState enumValue)
+        const char* GetNameForDatafeedSubscriptionStateCStr(DatafeedSubscriptionState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DatafeedSubscriptionState::Active:
-            return "Active";
-          case DatafeedSubscriptionState::Inactive:
-            return "Inactive";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDatafeedSubscriptionState(DatafeedSubscriptionState enumValue)
+        {
+          return GetNameForDatafeedSubscriptionStateCStr(enumValue);
         }
 
       } // namespace DatafeedSubscriptionStateMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DefaultRouteTableAssociationValueMapper
       {
 
-        static const int enable_HASH = HashingUtils::HashString("enable");
-        static const int disable_HASH = HashingUtils::HashString("disable");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "enable",
+          "disable",
+        };
 
         DefaultRouteTableAssociationValue GetDefaultRouteTableAssociationValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enable_HASH)
-          {
-            return DefaultRouteTableAssociationValue::enable;
-          }
-          else if (hashCode == disable_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DefaultRouteTableAssociationValue::disable;
+          case -1298848381:
+            if (name == "enable")
+            {
+              return DefaultRouteTableAssociationValue::enable;
+            }
+            break;
+          case 1671308008:
+            if (name == "disable")
+            {
+              return DefaultRouteTableAssociationValue::disable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DefaultRouteTableAssociationValue::NOT_SET;
         }
 
-        Aws::String GetNameForDefaultRouteTableAssociationValue(DefaultRouteTableAssociationValue enumValue)
+        const char* GetNameForDefaultRouteTableAssociationValueCStr(DefaultRouteTableAssociationValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DefaultRouteTableAssociationValue::enable:
-            return "enable";
-          case DefaultRouteTableAssociationValue::disable:
-            return "disable";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDefaultRouteTableAssociationValue(DefaultRouteTableAssociationValue enumValue)
+        {
+          return GetNameForDefaultRouteTableAssociationValueCStr(enumValue);
         }
 
       } // namespace DefaultRouteTableAssociationValueMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DefaultTargetCapacityTypeMapper
       {
 
-        static const int spot_HASH = HashingUtils::HashString("spot");
-        static const int on_demand_HASH = HashingUtils::HashString("on-demand");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "spot",
+          "on-demand",
+        };
 
         DefaultTargetCapacityType GetDefaultTargetCapacityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == spot_HASH)
-          {
-            return DefaultTargetCapacityType::spot;
-          }
-          else if (hashCode == on_demand_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DefaultTargetCapacityType::on_demand;
+          case 3537154:
+            if (name == "spot")
+            {
+              return DefaultTargetCapacityType::spot;
+            }
+            break;
+          case -380846599:
+            if (name == "on-demand")
+            {
+              return DefaultTargetCapacityType::on_demand;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DefaultTargetCapacityType::NOT_SET;
         }
 
-        Aws::String GetNameForDefaultTargetCapacityType(DefaultTargetCapacityType enumValue)
+        const char* GetNameForDefaultTargetCapacityTypeCStr(DefaultTargetCapacityType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DefaultTargetCapacityType::spot:
-            return "spot";
-          case DefaultTargetCapacityType::on_demand:
-            return "on-demand";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDefaultTargetCapacityType(DefaultTargetCapacityType enumValue)
+        {
+          return GetNameForDefaultTargetCapacityTypeCStr(enumValue);
         }
 
       } // namespace DefaultTargetCapacityTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace DeleteFleetErrorCodeMapper
       {
 
-        static const int fleetIdDoesNotExist_HASH = HashingUtils::HashString("fleetIdDoesNotExist");
-        static const int fleetIdMalformed_HASH = HashingUtils::HashString("fleetIdMalformed");
-        static const int fleetNotInDeletableState_HASH = HashingUtils::HashString("fleetNotInDeletableState");
-        static const int unexpectedError_HASH = HashingUtils::HashString("unexpectedError");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "fleetIdDoesNotExist",
+          "fleetIdMalformed",
+          "fleetNotInDeletableState",
+          "unexpectedError",
+        };
 
         DeleteFleetErrorCode GetDeleteFleetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == fleetIdDoesNotExist_HASH)
-          {
-            return DeleteFleetErrorCode::fleetIdDoesNotExist;
-          }
-          else if (hashCode == fleetIdMalformed_HASH)
-          {
-            return DeleteFleetErrorCode::fleetIdMalformed;
-          }
-          else if (hashCode == fleetNotInDeletableState_HASH)
-          {
-            return DeleteFleetErrorCode::fleetNotInDeletableState;
-          }
-          else if (hashCode == unexpectedError_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeleteFleetErrorCode::unexpectedError;
+          case -229666010:
+            if (name == "fleetIdDoesNotExist")
+            {
+              return DeleteFleetErrorCode::fleetIdDoesNotExist;
+            }
+            break;
+          case 1471138482:
+            if (name == "fleetIdMalformed")
+            {
+              return DeleteFleetErrorCode::fleetIdMalformed;
+            }
+            break;
+          case -764297241:
+            if (name == "fleetNotInDeletableState")
+            {
+              return DeleteFleetErrorCode::fleetNotInDeletableState;
+            }
+            break;
+          case 1317945399:
+            if (name == "unexpectedError")
+            {
+              return DeleteFleetErrorCode::unexpectedError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DeleteFleetErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForDeleteFleetErrorCode(DeleteFleetErrorCode enumValue)
+        const char* GetNameForDeleteFleetErrorCodeCStr(DeleteFleetErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeleteFleetErrorCode::fleetIdDoesNotExist:
-            return "fleetIdDoesNotExist";
-          case DeleteFleetErrorCode::fleetIdMalformed:
-            return "fleetIdMalformed";
-          case DeleteFleetErrorCode::fleetNotInDeletableState:
-            return "fleetNotInDeletableState";
-          case DeleteFleetErrorCode::unexpectedError:
-            return "unexpectedError";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeleteFleetErrorCode(DeleteFleetErrorCode enumValue)
+        {
+          return GetNameForDeleteFleetErrorCodeCStr(enumValue);
         }
 
       } // namespace DeleteFleetErrorCodeMapper
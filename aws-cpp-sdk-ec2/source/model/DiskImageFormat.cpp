@@ -30,25 +30,44 @@ namespace Aws
       namespace DiskImageFormatMapper
       {
 
-        static const int VMDK_HASH = HashingUtils::HashString("VMDK");
-        static const int RAW_HASH = HashingUtils::HashString("RAW");
-        static const int VHD_HASH = HashingUtils::HashString("VHD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VMDK",
+          "RAW",
+          "VHD",
+        };
 
         DiskImageFormat GetDiskImageFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VMDK_HASH)
-          {
-            return DiskImageFormat::VMDK;
-          }
-          else if (hashCode == RAW_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DiskImageFormat::RAW;
-          }
-          else if (hashCode == VHD_HASH)
-          {
-            return DiskImageFormat::VHD;
+          case 2638206:
+            if (name == "VMDK")
+            {
+              return DiskImageFormat::VMDK;
+            }
+            break;
+          case 80904:
+            if (name == "RAW")
+            {
+              return DiskImageFormat::RAW;
+            }
+            break;
+          case 84946:
+            if (name == "VHD")
+            {
+              return DiskImageFormat::VHD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DiskImageFormat::NOT_SET;
         }
 
-        Aws::String GetNameForDiskImageFormat(DiskImageFormat enumValue)
+        const char* GetNameForDiskImageFormatCStr(DiskImageFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DiskImageFormat::VMDK:
-            return "VMDK";
-          case DiskImageFormat::RAW:
-            return "RAW";
-          case DiskImageFormat::VHD:
-            return "VHD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDiskImageFormat(DiskImageFormat enumValue)
+        {
+          return GetNameForDiskImageFormatCStr(enumValue);
         }
 
       } // namespace DiskImageFormatMapper
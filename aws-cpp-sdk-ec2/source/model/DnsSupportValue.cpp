@@ -30,20 +30,37 @@ namespace Aws
       namespace DnsSupportValueMapper
       {
 
-        static const int enable_HASH = HashingUtils::HashString("enable");
-        static const int disable_HASH = HashingUtils::HashString("disable");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "enable",
+          "disable",
+        };
 
         DnsSupportValue GetDnsSupportValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enable_HASH)
-          {
-            return DnsSupportValue::enable;
-          }
-          else if (hashCode == disable_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DnsSupportValue::disable;
+          case -1298848381:
+            if (name == "enable")
+            {
+              return DnsSupportValue::enable;
+            }
+            break;
+          case 1671308008:
+            if (name == "disable")
+            {
+              return DnsSupportValue::disable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DnsSupportValue::NOT_SET;
         }
 
-        Aws::String GetNameForDnsSupportValue(DnsSupportValue enumValue)
+        const char* GetNameForDnsSupportValueCStr(DnsSupportValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DnsSupportValue::enable:
-            return "enable";
-          case DnsSupportValue::disable:
-            return "disable";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDnsSupportValue(DnsSupportValue enumValue)
+        {
+          return GetNameForDnsSupportValueCStr(enumValue);
         }
 
       } // namespace DnsSupportValueMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DomainTypeMapper
       {
 
-        static const int vpc_HASH = HashingUtils::HashString("vpc");
-        static const int standard_HASH = HashingUtils::HashString("standard");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "vpc",
+          "standard",
+        };
 
         DomainType GetDomainTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == vpc_HASH)
-          {
-            return DomainType::vpc;
-          }
-          else if (hashCode == standard_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DomainType::standard;
+          case 116969:
+            if (name == "vpc")
+            {
+              return DomainType::vpc;
+            }
+            break;
+          case 1312628413:
+            if (name == "standard")
+            {
+              return DomainType::standard;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DomainType::NOT_SET;
         }
 
-        Aws::String GetNameForDomainType(DomainType enumValue)
+        const char* GetNameForDomainTypeCStr(DomainType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DomainType::vpc:
-            return "vpc";
-          case DomainType::standard:
-            return "standard";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDomainType(DomainType enumValue)
+        {
+          return GetNameForDomainTypeCStr(enumValue);
         }
 
       } // namespace DomainTypeMapper
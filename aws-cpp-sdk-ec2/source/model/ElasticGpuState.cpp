@@ -30,15 +30,30 @@ namespace Aws
       namespace ElasticGpuStateMapper
       {
 
-        static const int ATTACHED_HASH = HashingUtils::HashString("ATTACHED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ATTACHED",
+        };
 
         ElasticGpuState GetElasticGpuStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ATTACHED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ElasticGpuState::ATTACHED;
+          case 1321364900:
+            if (name == "ATTACHED")
+            {
+              return ElasticGpuState::ATTACHED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ElasticGpuState::NOT_SET;
         }
 
-        Aws::String GetNameForElasticGpuState(ElasticGpuState enumValue)
+        const char* GetNameForElasticGpuStateCStr(ElasticGpuState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ElasticGpuState::ATTACHED:
-            return "ATTACHED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForElasticGpuState(ElasticGpuState enumValue)
+        {
+          return GetNameForElasticGpuStateCStr(enumValue);
         }
 
       } // namespace ElasticGpuStateMapper
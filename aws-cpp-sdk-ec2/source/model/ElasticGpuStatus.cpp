@@ -30,20 +30,37 @@ namespace Aws
       namespace ElasticGpuStatusMapper
       {
 
-        static const int OK_HASH = HashingUtils::HashString("OK");
-        static const int IMPAIRED_HASH = HashingUtils::HashString("IMPAIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OK",
+          "IMPAIRED",
+        };
 
         ElasticGpuStatus GetElasticGpuStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OK_HASH)
-          {
-            return ElasticGpuStatus::OK;
-          }
-          else if (hashCode == IMPAIRED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ElasticGpuStatus::IMPAIRED;
+          case 2524:
+            if (name == "OK")
+            {
+              return ElasticGpuStatus::OK;
+            }
+            break;
+          case 347058973:
+            if (name == "IMPAIRED")
+            {
+              return ElasticGpuStatus::IMPAIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ElasticGpuStatus::NOT_SET;
         }
 
-        Aws::String GetNameForElasticGpuStatus(ElasticGpuStatus enumValue)
+        const char* GetNameForElasticGpuStatusCStr(ElasticGpuStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ElasticGpuStatus::OK:
-            return "OK";
-          case ElasticGpuStatus::IMPAIRED:
-            return "IMPAIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForElasticGpuStatus(ElasticGpuStatus enumValue)
+        {
+          return GetNameForElasticGpuStatusCStr(enumValue);
         }
 
       } // namespace ElasticGpuStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace EndDateTypeMapper
       {
 
-        static const int unlimited_HASH = HashingUtils::HashString("unlimited");
-        static const int limited_HASH = HashingUtils::HashString("limited");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "unlimited",
+          "limited",
+        };
 
         EndDateType GetEndDateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == unlimited_HASH)
-          {
-            return EndDateType::unlimited;
-          }
-          else if (hashCode == limited_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EndDateType::limited;
+          case 1887918305:
+            if (name == "unlimited")
+            {
+              return EndDateType::unlimited;
+            }
+            break;
+          case 176117146:
+            if (name == "limited")
+            {
+              return EndDateType::limited;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EndDateType::NOT_SET;
         }
 
-        Aws::String GetNameForEndDateType(EndDateType enumValue)
+        const char* GetNameForEndDateTypeCStr(EndDateType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EndDateType::unlimited:
-            return "unlimited";
-          case EndDateType::limited:
-            return "limited";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEndDateType(EndDateType enumValue)
+        {
+          return GetNameForEndDateTypeCStr(enumValue);
         }
 
       } // namespace EndDateTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace EventCodeMapper
       {
 
-        static const int instance_reboot_HASH = HashingUtils::HashString("instance-reboot");
-        static const int system_reboot_HASH = HashingUtils::HashString("system-reboot");
-        static const int system_maintenance_HASH = HashingUtils::HashString("system-maintenance");
-        static const int instance_retirement_HASH = HashingUtils::HashString("instance-retirement");
-        static const int instance_stop_HASH = HashingUtils::HashString("instance-stop");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "instance-reboot",
+          "system-reboot",
+          "system-maintenance",
+          "instance-retirement",
+          "instance-stop",
+        };
 
         EventCode GetEventCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instance_reboot_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventCode::instance_reboot;
-          }
-          else if (hashCode == system_reboot_HASH)
-          {
-            return EventCode::system_reboot;
-          }
-          else if (hashCode == system_maintenance_HASH)
-          {
-            return EventCode::system_maintenance;
-          }
-          else if (hashCode == instance_retirement_HASH)
-          {
-            return EventCode::instance_retirement;
-          }
-          else if (hashCode == instance_stop_HASH)
-          {
-            return EventCode::instance_stop;
+          case 1390963677:
+            if (name == "instance-reboot")
+            {
+              return EventCode::instance_reboot;
+            }
+            break;
+          case 712305923:
+            if (name == "system-reboot")
+            {
+              return EventCode::system_reboot;
+            }
+            break;
+          case -1858557835:
+            if (name == "system-maintenance")
+            {
+              return EventCode::system_maintenance;
+            }
+            break;
+          case -1546438607:
+            if (name == "instance-retirement")
+            {
+              return EventCode::instance_retirement;
+            }
+            break;
+          case -1428673990:
+            if (name == "instance-stop")
+            {
+              return EventCode::instance_stop;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return EventCode::NOT_SET;
         }
 
-        Aws::String GetNameForEventCode(EventCode enumValue)
+        const char* GetNameForEventCodeCStr(EventCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventCode::instance_reboot:
-            return "instance-reboot";
-          case EventCode::system_reboot:
-            return "system-reboot";
-          case EventCode::system_maintenance:
-            return "system-maintenance";
-          case EventCode::instance_retirement:
-            return "instance-retirement";
-          case EventCode::instance_stop:
-            return "instance-stop";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventCode(EventCode enumValue)
+        {
+          return GetNameForEventCodeCStr(enumValue);
         }
 
       } // namespace EventCodeMapper
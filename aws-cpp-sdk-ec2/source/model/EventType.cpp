@@ -30,25 +30,44 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int instanceChange_HASH = HashingUtils::HashString("instanceChange");
-        static const int fleetRequestChange_HASH = HashingUtils::HashString("fleetRequestChange");
-        static const int error_HASH = HashingUtils::HashString("error");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "instanceChange",
+          "fleetRequestChange",
+          "error",
+        };
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instanceChange_HASH)
-          {
-            return EventType::instanceChange;
-          }
-          else if (hashCode == fleetRequestChange_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventType::fleetRequestChange;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return EventType::error;
+          case -720105307:
+            if (name == "instanceChange")
+            {
+              return EventType::instanceChange;
+            }
+            break;
+          case -1951511439:
+            if (name == "fleetRequestChange")
+            {
+              return EventType::fleetRequestChange;
+            }
+            break;
+          case 96784904:
+            if (name == "error")
+            {
+              return EventType::error;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventTypeCStr(EventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventType::instanceChange:
-            return "instanceChange";
-          case EventType::fleetRequestChange:
-            return "fleetRequestChange";
-          case EventType::error:
-            return "error";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventType(EventType enumValue)
+        {
+          return GetNameForEventTypeCStr(enumValue);
         }
 
       } // namespace EventTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ExcessCapacityTerminationPolicyMapper
       {
 
-        static const int noTermination_HASH = HashingUtils::HashString("noTermination");
-        static const int default__HASH = HashingUtils::HashString("default");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "noTermination",
+          "default",
+        };
 
         ExcessCapacityTerminationPolicy GetExcessCapacityTerminationPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == noTermination_HASH)
-          {
-            return ExcessCapacityTerminationPolicy::noTermination;
-          }
-          else if (hashCode == default__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExcessCapacityTerminationPolicy::default_;
+          case -1016992125:
+            if (name == "noTermination")
+            {
+              return ExcessCapacityTerminationPolicy::noTermination;
+            }
+            break;
+          case 1544803905:
+            if (name == "default")
+            {
+              return ExcessCapacityTerminationPolicy::default_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ExcessCapacityTerminationPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForExcessCapacityTerminationPolicy(ExcessCapacityTerminationPolicy enumValue)
+        const char* GetNameForExcessCapacityTerminationPolicyCStr(ExcessCapacityTerminationPolicy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExcessCapacityTerminationPolicy::noTermination:
-            return "noTermination";
-          case ExcessCapacityTerminationPolicy::default_:
-            return "default";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExcessCapacityTerminationPolicy(ExcessCapacityTerminationPolicy enumValue)
+        {
+          return GetNameForExcessCapacityTerminationPolicyCStr(enumValue);
         }
 
       } // namespace ExcessCapacityTerminationPolicyMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ExportEnvironmentMapper
       {
 
-        static const int citrix_HASH = HashingUtils::HashString("citrix");
-        static const int vmware_HASH = HashingUtils::HashString("vmware");
-        static const int microsoft_HASH = HashingUtils::HashString("microsoft");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "citrix",
+          "vmware",
+          "microsoft",
+        };
 
         ExportEnvironment GetExportEnvironmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == citrix_HASH)
-          {
-            return ExportEnvironment::citrix;
-          }
-          else if (hashCode == vmware_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExportEnvironment::vmware;
-          }
-          else if (hashCode == microsoft_HASH)
-          {
-            return ExportEnvironment::microsoft;
+          case -1360142957:
+            if (name == "citrix")
+            {
+              return ExportEnvironment::citrix;
+            }
+            break;
+          case -812421708:
+            if (name == "vmware")
+            {
+              return ExportEnvironment::vmware;
+            }
+            break;
+          case -94228242:
+            if (name == "microsoft")
+            {
+              return ExportEnvironment::microsoft;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ExportEnvironment::NOT_SET;
         }
 
-        Aws::String GetNameForExportEnvironment(ExportEnvironment enumValue)
+        const char* GetNameForExportEnvironmentCStr(ExportEnvironment enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExportEnvironment::citrix:
-            return "citrix";
-          case ExportEnvironment::vmware:
-            return "vmware";
-          case ExportEnvironment::microsoft:
-            return "microsoft";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExportEnvironment(ExportEnvironment enumValue)
+        {
+          return GetNameForExportEnvironmentCStr(enumValue);
         }
 
       } // namespace ExportEnvironmentMapper
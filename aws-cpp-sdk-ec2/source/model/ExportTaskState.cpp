@@ -30,30 +30,51 @@ namespace Aws
       namespace ExportTaskStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int cancelling_HASH = HashingUtils::HashString("cancelling");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int completed_HASH = HashingUtils::HashString("completed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "active",
+          "cancelling",
+          "cancelled",
+          "completed",
+        };
 
         ExportTaskState GetExportTaskStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
-          {
-            return ExportTaskState::active;
-          }
-          else if (hashCode == cancelling_HASH)
-          {
-            return ExportTaskState::cancelling;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return ExportTaskState::cancelled;
-          }
-          else if (hashCode == completed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExportTaskState::completed;
+          case -1422950650:
+            if (name == "active")
+            {
+              return ExportTaskState::active;
+            }
+            break;
+          case 1889341808:
+            if (name == "cancelling")
+            {
+              return ExportTaskState::cancelling;
+            }
+            break;
+          case 476588369:
+            if (name == "cancelled")
+            {
+              return ExportTaskState::cancelled;
+            }
+            break;
+          case -1402931637:
+            if (name == "completed")
+            {
+              return ExportTaskState::completed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ExportTaskState::NOT_SET;
         }
 
-        Aws::String GetNameForExportTaskState(ExportTaskState enumValue)
+        const char* GetNameForExportTaskStateCStr(ExportTaskState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExportTaskState::active:
-            return "active";
-          case ExportTaskState::cancelling:
-            return "cancelling";
-          case ExportTaskState::cancelled:
-            return "cancelled";
-          case ExportTaskState::completed:
-            return "completed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExportTaskState(ExportTaskState enumValue)
+        {
+          return GetNameForExportTaskStateCStr(enumValue);
         }
 
       } // namespace ExportTaskStateMapper
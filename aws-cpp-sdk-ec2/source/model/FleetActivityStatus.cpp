@@ -30,30 +30,51 @@ namespace Aws
       namespace FleetActivityStatusMapper
       {
 
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int pending_fulfillment_HASH = HashingUtils::HashString("pending-fulfillment");
-        static const int pending_termination_HASH = HashingUtils::HashString("pending-termination");
-        static const int fulfilled_HASH = HashingUtils::HashString("fulfilled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "error",
+          "pending-fulfillment",
+          "pending-termination",
+          "fulfilled",
+        };
 
         FleetActivityStatus GetFleetActivityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == error_HASH)
-          {
-            return FleetActivityStatus::error;
-          }
-          else if (hashCode == pending_fulfillment_HASH)
-          {
-            return FleetActivityStatus::pending_fulfillment;
-          }
-          else if (hashCode == pending_termination_HASH)
-          {
-            return FleetActivityStatus::pending_termination;
-          }
-          else if (hashCode == fulfilled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetActivityStatus::fulfilled;
+          case 96784904:
+            if (name == "error")
+            {
+              return FleetActivityStatus::error;
+            }
+            break;
+          case -512539992:
+            if (name == "pending-fulfillment")
+            {
+              return FleetActivityStatus::pending_fulfillment;
+            }
+            break;
+          case 351451086:
+            if (name == "pending-termination")
+            {
+              return FleetActivityStatus::pending_termination;
+            }
+            break;
+          case -1839765217:
+            if (name == "fulfilled")
+            {
+              return FleetActivityStatus::fulfilled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return FleetActivityStatus::NOT_SET;
         }
 
-        Aws::String GetNameForFleetActivityStatus(FleetActivityStatus enumValue)
+        const char* GetNameForFleetActivityStatusCStr(FleetActivityStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetActivityStatus::error:
-            return "error";
-          case FleetActivityStatus::pending_fulfillment:
-            return "pending-fulfillment";
-          case FleetActivityStatus::pending_termination:
-            return "pending-termination";
-          case FleetActivityStatus::fulfilled:
-            return "fulfilled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetActivityStatus(FleetActivityStatus enumValue)
+        {
+          return GetNameForFleetActivityStatusCStr(enumValue);
         }
 
       } // namespace FleetActivityStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace FleetEventTypeMapper
       {
 
-        static const int instance_change_HASH = HashingUtils::HashString("instance-change");
-        static const int fleet_change_HASH = HashingUtils::HashString("fleet-change");
-        static const int service_error_HASH = HashingUtils::HashString("service-error");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "instance-change",
+          "fleet-change",
+          "service-error",
+        };
 
         FleetEventType GetFleetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instance_change_HASH)
-          {
-            return FleetEventType::instance_change;
-          }
-          else if (hashCode == fleet_change_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetEventType::fleet_change;
-          }
-          else if (hashCode == service_error_HASH)
-          {
-            return FleetEventType::service_error;
+          case 964265960:
+            if (name == "instance-change")
+            {
+              return FleetEventType::instance_change;
+            }
+            break;
+          case -829125361:
+            if (name == "fleet-change")
+            {
+              return FleetEventType::fleet_change;
+            }
+            break;
+          case 1127092464:
+            if (name == "service-error")
+            {
+              return FleetEventType::service_error;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FleetEventType::NOT_SET;
         }
 
-        Aws::String GetNameForFleetEventType(FleetEventType enumValue)
+        const char* GetNameForFleetEventTypeCStr(FleetEventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetEventType::instance_change:
-            return "instance-change";
-          case FleetEventType::fleet_change:
-            return "fleet-change";
-          case FleetEventType::service_error:
-            return "service-error";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetEventType(FleetEventType enumValue)
+        {
+          return GetNameForFleetEventTypeCStr(enumValue);
         }
 
       } // namespace FleetEventTypeMapper
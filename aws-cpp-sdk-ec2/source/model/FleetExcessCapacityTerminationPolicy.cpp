@@ -30,20 +30,37 @@ namespace Aws
       namespace FleetExcessCapacityTerminationPolicyMapper
       {
 
-        static const int no_termination_HASH = HashingUtils::HashString("no-termination");
-        static const int termination_HASH = HashingUtils::HashString("termination");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "no-termination",
+          "termination",
+        };
 
         FleetExcessCapacityTerminationPolicy GetFleetExcessCapacityTerminationPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == no_termination_HASH)
-          {
-            return FleetExcessCapacityTerminationPolicy::no_termination;
-          }
-          else if (hashCode == termination_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetExcessCapacityTerminationPolicy::termination;
+          case 1610304760:
+            if (name == "no-termination")
+            {
+              return FleetExcessCapacityTerminationPolicy::no_termination;
+            }
+            break;
+          case -1918580988:
+            if (name == "termination")
+            {
+              return FleetExcessCapacityTerminationPolicy::termination;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FleetExcessCapacityTerminationPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForFleetExcessCapacityTerminationPolicy(FleetExcessCapacityTerminationPolicy enumValue)
+        const char* GetNameForFleetExcessCapacityTerminationPolicyCStr(FleetExcessCapacityTerminationPolicy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetExcessCapacityTerminationPolicy::no_termination:
-            return "no-termination";
-          case FleetExcessCapacityTerminationPolicy::termination:
-            return "termination";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetExcessCapacityTerminationPolicy(FleetExcessCapacityTerminationPolicy enumValue)
+        {
+          return GetNameForFleetExcessCapacityTerminationPolicyCStr(enumValue);
         }
 
       } // namespace FleetExcessCapacityTerminationPolicyMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FleetOnDemandAllocationStrategyMapper
       {
 
-        static const int lowest_price_HASH = HashingUtils::HashString("lowest-price");
-        static const int prioritized_HASH = HashingUtils::HashString("prioritized");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "lowest-price",
+          "prioritized",
+        };
 
         FleetOnDemandAllocationStrategy GetFleetOnDemandAllocationStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == lowest_price_HASH)
-          {
-            return FleetOnDemandAllocationStrategy::lowest_price;
-          }
-          else if (hashCode == prioritized_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetOnDemandAllocationStrategy::prioritized;
+          case -790467218:
+            if (name == "lowest-price")
+            {
+              return FleetOnDemandAllocationStrategy::lowest_price;
+            }
+            break;
+          case 264111237:
+            if (name == "prioritized")
+            {
+              return FleetOnDemandAllocationStrategy::prioritized;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FleetOnDemandAllocationStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForFleetOnDemandAllocationStrategy(FleetOnDemandAllocationStrategy enumValue)
+        const char* GetNameForFleetOnDemandAllocationStrategyCStr(FleetOnDemandAllocationStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetOnDemandAllocationStrategy::lowest_price:
-            return "lowest-price";
-          case FleetOnDemandAllocationStrategy::prioritized:
-            return "prioritized";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetOnDemandAllocationStrategy(FleetOnDemandAllocationStrategy enumValue)
+        {
+          return GetNameForFleetOnDemandAllocationStrategyCStr(enumValue);
         }
 
       } // namespace FleetOnDemandAllocationStrategyMapper
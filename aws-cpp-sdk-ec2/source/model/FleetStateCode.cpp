@@ -30,45 +30,72 @@ namespace Aws
       namespace FleetStateCodeMapper
       {
 
-        static const int submitted_HASH = HashingUtils::HashString("submitted");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int deleted_running_HASH = HashingUtils::HashString("deleted-running");
-        static const int deleted_terminating_HASH = HashingUtils::HashString("deleted-terminating");
-        static const int modifying_HASH = HashingUtils::HashString("modifying");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "submitted",
+          "active",
+          "deleted",
+          "failed",
+          "deleted-running",
+          "deleted-terminating",
+          "modifying",
+        };
 
         FleetStateCode GetFleetStateCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == submitted_HASH)
-          {
-            return FleetStateCode::submitted;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return FleetStateCode::active;
-          }
-          else if (hashCode == deleted_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetStateCode::deleted;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return FleetStateCode::failed;
-          }
-          else if (hashCode == deleted_running_HASH)
-          {
-            return FleetStateCode::deleted_running;
-          }
-          else if (hashCode == deleted_terminating_HASH)
-          {
-            return FleetStateCode::deleted_terminating;
-          }
-          else if (hashCode == modifying_HASH)
-          {
-            return FleetStateCode::modifying;
+          case 348678395:
+            if (name == "submitted")
+            {
+              return FleetStateCode::submitted;
+            }
+            break;
+          case -1422950650:
+            if (name == "active")
+            {
+              return FleetStateCode::active;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return FleetStateCode::deleted;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return FleetStateCode::failed;
+            }
+            break;
+          case 1089273867:
+            if (name == "deleted-running")
+            {
+              return FleetStateCode::deleted_running;
+            }
+            break;
+          case -783504598:
+            if (name == "deleted-terminating")
+            {
+              return FleetStateCode::deleted_terminating;
+            }
+            break;
+          case -1900565272:
+            if (name == "modifying")
+            {
+              return FleetStateCode::modifying;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return FleetStateCode::NOT_SET;
         }
 
-        Aws::String GetNameForFleetStateCode(FleetStateCode enumValue)
+        const char* GetNameForFleetStateCodeCStr(FleetStateCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetStateCode::submitted:
-            return "submitted";
-          case FleetStateCode::active:
-            return "active";
-          case FleetStateCode::deleted:
-            return "deleted";
-          case FleetStateCode::failed:
-            return "failed";
-          case FleetStateCode::deleted_running:
-            return "deleted-running";
-          case FleetStateCode::deleted_terminating:
-            return "deleted-terminating";
-          case FleetStateCode::modifying:
-            return "modifying";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetStateCode(FleetStateCode enumValue)
+        {
+          return GetNameForFleetStateCodeCStr(enumValue);
         }
 
       } // namespace FleetStateCodeMapper
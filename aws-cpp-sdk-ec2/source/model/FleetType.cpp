@@ -30,25 +30,44 @@ namespace Aws
       namespace FleetTypeMapper
       {
 
-        static const int request_HASH = HashingUtils::HashString("request");
-        static const int maintain_HASH = HashingUtils::HashString("maintain");
-        static const int instant_HASH = HashingUtils::HashString("instant");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "request",
+          "maintain",
+          "instant",
+        };
 
         FleetType GetFleetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == request_HASH)
-          {
-            return FleetType::request;
-          }
-          else if (hashCode == maintain_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetType::maintain;
-          }
-          else if (hashCode == instant_HASH)
-          {
-            return FleetType::instant;
+          case 1095692943:
+            if (name == "request")
+            {
+              return FleetType::request;
+            }
+            break;
+          case -7490165:
+            if (name == "maintain")
+            {
+              return FleetType::maintain;
+            }
+            break;
+          case 1957570017:
+            if (name == "instant")
+            {
+              return FleetType::instant;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FleetType::NOT_SET;
         }
 
-        Aws::String GetNameForFleetType(FleetType enumValue)
+        const char* GetNameForFleetTypeCStr(FleetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetType::request:
-            return "request";
-          case FleetType::maintain:
-            return "maintain";
-          case FleetType::instant:
-            return "instant";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetType(FleetType enumValue)
+        {
+          return GetNameForFleetTypeCStr(enumValue);
         }
 
       } // namespace FleetTypeMapper
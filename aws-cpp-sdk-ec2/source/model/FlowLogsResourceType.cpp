@@ -30,25 +30,44 @@ namespace Aws
       namespace FlowLogsResourceTypeMapper
       {
 
-        static const int VPC_HASH = HashingUtils::HashString("VPC");
-        static const int Subnet_HASH = HashingUtils::HashString("Subnet");
-        static const int NetworkInterface_HASH = HashingUtils::HashString("NetworkInterface");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VPC",
+          "Subnet",
+          "NetworkInterface",
+        };
 
         FlowLogsResourceType GetFlowLogsResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VPC_HASH)
-          {
-            return FlowLogsResourceType::VPC;
-          }
-          else if (hashCode == Subnet_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FlowLogsResourceType::Subnet;
-          }
-          else if (hashCode == NetworkInterface_HASH)
-          {
-            return FlowLogsResourceType::NetworkInterface;
+          case 85193:
+            if (name == "VPC")
+            {
+              return FlowLogsResourceType::VPC;
+            }
+            break;
+          case -1807667331:
+            if (name == "Subnet")
+            {
+              return FlowLogsResourceType::Subnet;
+            }
+            break;
+          case -1184757045:
+            if (name == "NetworkInterface")
+            {
+              return FlowLogsResourceType::NetworkInterface;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FlowLogsResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForFlowLogsResourceType(FlowLogsResourceType enumValue)
+        const char* GetNameForFlowLogsResourceTypeCStr(FlowLogsResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FlowLogsResourceType::VPC:
-            return "VPC";
-          case FlowLogsResourceType::Subnet:
-            return "Subnet";
-          case FlowLogsResourceType::NetworkInterface:
-            return "NetworkInterface";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFlowLogsResourceType(FlowLogsResourceType enumValue)
+        {
+          return GetNameForFlowLogsResourceTypeCStr(enumValue);
         }
 
       } // namespace FlowLogsResourceTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace FpgaImageAttributeNameMapper
       {
 
-        static const int description_HASH = HashingUtils::HashString("description");
-        static const int name_HASH = HashingUtils::HashString("name");
-        static const int loadPermission_HASH = HashingUtils::HashString("loadPermission");
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "description",
+          "name",
+          "loadPermission",
+          "productCodes",
+        };
 
         FpgaImageAttributeName GetFpgaImageAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == description_HASH)
-          {
-            return FpgaImageAttributeName::description;
-          }
-          else if (hashCode == name_HASH)
-          {
-            return FpgaImageAttributeName::name;
-          }
-          else if (hashCode == loadPermission_HASH)
-          {
-            return FpgaImageAttributeName::loadPermission;
-          }
-          else if (hashCode == productCodes_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FpgaImageAttributeName::productCodes;
+          case -1724546052:
+            if (name == "description")
+            {
+              return FpgaImageAttributeName::description;
+            }
+            break;
+          case 3373707:
+            if (name == "name")
+            {
+              return FpgaImageAttributeName::name;
+            }
+            break;
+          case 536739669:
+            if (name == "loadPermission")
+            {
+              return FpgaImageAttributeName::loadPermission;
+            }
+            break;
+          case 988549239:
+            if (name == "productCodes")
+            {
+              return FpgaImageAttributeName::productCodes;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return FpgaImageAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForFpgaImageAttributeName(FpgaImageAttributeName enumValue)
+        const char* GetNameForFpgaImageAttributeNameCStr(FpgaImageAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FpgaImageAttributeName::description:
-            return "description";
-          case FpgaImageAttributeName::name:
-            return "name";
-          case FpgaImageAttributeName::loadPermission:
-            return "loadPermission";
-          case FpgaImageAttributeName::productCodes:
-            return "productCodes";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFpgaImageAttributeName(FpgaImageAttributeName enumValue)
+        {
+          return GetNameForFpgaImageAttributeNameCStr(enumValue);
         }
 
       } // namespace FpgaImageAttributeNameMapper
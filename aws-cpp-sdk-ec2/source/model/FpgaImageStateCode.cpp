@@ -30,30 +30,51 @@ namespace Aws
       namespace FpgaImageStateCodeMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int unavailable_HASH = HashingUtils::HashString("unavailable");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "failed",
+          "available",
+          "unavailable",
+        };
 
         FpgaImageStateCode GetFpgaImageStateCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return FpgaImageStateCode::pending;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return FpgaImageStateCode::failed;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return FpgaImageStateCode::available;
-          }
-          else if (hashCode == unavailable_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FpgaImageStateCode::unavailable;
+          case -682587753:
+            if (name == "pending")
+            {
+              return FpgaImageStateCode::pending;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return FpgaImageStateCode::failed;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return FpgaImageStateCode::available;
+            }
+            break;
+          case -665462704:
+            if (name == "unavailable")
+            {
+              return FpgaImageStateCode::unavailable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return FpgaImageStateCode::NOT_SET;
         }
 
-        Aws::String GetNameForFpgaImageStateCode(FpgaImageStateCode enumValue)
+        const char* GetNameForFpgaImageStateCodeCStr(FpgaImageStateCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FpgaImageStateCode::pending:
-            return "pending";
-          case FpgaImageStateCode::failed:
-            return "failed";
-          case FpgaImageStateCode::available:
-            return "available";
-          case FpgaImageStateCode::unavailable:
-            return "unavailable";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFpgaImageStateCode(FpgaImageStateCode enumValue)
+        {
+          return GetNameForFpgaImageStateCodeCStr(enumValue);
         }
 
       } // namespace FpgaImageStateCodeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace GatewayTypeMapper
       {
 
-        static const int ipsec_1_HASH = HashingUtils::HashString("ipsec.1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ipsec.1",
+        };
 
         GatewayType GetGatewayTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ipsec_1_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GatewayType::ipsec_1;
+          case 2014381325:
+            if (name == "ipsec.1")
+            {
+              return GatewayType::ipsec_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return GatewayType::NOT_SET;
         }
 
-        Aws::String GetNameForGatewayType(GatewayType enumValue)
+        const char* GetNameForGatewayTypeCStr(GatewayType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GatewayType::ipsec_1:
-            return "ipsec.1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGatewayType(GatewayType enumValue)
+        {
+          return GetNameForGatewayTypeCStr(enumValue);
         }
 
       } // namespace GatewayTypeMapper
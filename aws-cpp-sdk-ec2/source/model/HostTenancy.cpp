@@ -30,20 +30,37 @@ namespace Aws
       namespace HostTenancyMapper
       {
 
-        static const int dedicated_HASH = HashingUtils::HashString("dedicated");
-        static const int host_HASH = HashingUtils::HashString("host");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "dedicated",
+          "host",
+        };
 
         HostTenancy GetHostTenancyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == dedicated_HASH)
-          {
-            return HostTenancy::dedicated;
-          }
-          else if (hashCode == host_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HostTenancy::host;
+          case 1229913583:
+            if (name == "dedicated")
+            {
+              return HostTenancy::dedicated;
+            }
+            break;
+          case 3208616:
+            if (name == "host")
+            {
+              return HostTenancy::host;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HostTenancy::NOT_SET;
         }
 
-        Aws::String GetNameForHostTenancy(HostTenancy enumValue)
+        const char* GetNameForHostTenancyCStr(HostTenancy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HostTenancy::dedicated:
-            return "dedicated";
-          case HostTenancy::host:
-            return "host";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHostTenancy(HostTenancy enumValue)
+        {
+          return GetNameForHostTenancyCStr(enumValue);
         }
 
       } // namespace HostTenancyMapper
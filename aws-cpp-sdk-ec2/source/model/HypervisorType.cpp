@@ -30,20 +30,37 @@ namespace Aws
       namespace HypervisorTypeMapper
       {
 
-        static const int ovm_HASH = HashingUtils::HashString("ovm");
-        static const int xen_HASH = HashingUtils::HashString("xen");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ovm",
+          "xen",
+        };
 
         HypervisorType GetHypervisorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ovm_HASH)
-          {
-            return HypervisorType::ovm;
-          }
-          else if (hashCode == xen_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HypervisorType::xen;
+          case 110438:
+            if (name == "ovm")
+            {
+              return HypervisorType::ovm;
+            }
+            break;
+          case 118561:
+            if (name == "xen")
+            {
+              return HypervisorType::xen;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HypervisorType::NOT_SET;
         }
 
-        Aws::String GetNameForHypervisorType(HypervisorType enumValue)
+        const char* GetNameForHypervisorTypeCStr(HypervisorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HypervisorType::ovm:
-            return "ovm";
-          case HypervisorType::xen:
-            return "xen";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHypervisorType(HypervisorType enumValue)
+        {
+          return GetNameForHypervisorTypeCStr(enumValue);
         }
 
       } // namespace HypervisorTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace IamInstanceProfileAssociationStateMapper
       {
 
-        static const int associating_HASH = HashingUtils::HashString("associating");
-        static const int associated_HASH = HashingUtils::HashString("associated");
-        static const int disassociating_HASH = HashingUtils::HashString("disassociating");
-        static const int disassociated_HASH = HashingUtils::HashString("disassociated");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "associating",
+          "associated",
+          "disassociating",
+          "disassociated",
+        };
 
         IamInstanceProfileAssociationState GetIamInstanceProfileAssociationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == associating_HASH)
-          {
-            return IamInstanceProfileAssociationState::associating;
-          }
-          else if (hashCode == associated_HASH)
-          {
-            return IamInstanceProfileAssociationState::associated;
-          }
-          else if (hashCode == disassociating_HASH)
-          {
-            return IamInstanceProfileAssociationState::disassociating;
-          }
-          else if (hashCode == disassociated_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IamInstanceProfileAssociationState::disassociated;
+          case -87499685:
+            if (name == "associating")
+            {
+              return IamInstanceProfileAssociationState::associating;
+            }
+            break;
+          case 1936839942:
+            if (name == "associated")
+            {
+              return IamInstanceProfileAssociationState::associated;
+            }
+            break;
+          case 2113311501:
+            if (name == "disassociating")
+            {
+              return IamInstanceProfileAssociationState::disassociating;
+            }
+            break;
+          case -1455849452:
+            if (name == "disassociated")
+            {
+              return IamInstanceProfileAssociationState::disassociated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return IamInstanceProfileAssociationState::NOT_SET;
         }
 
-        Aws::String GetNameForIamInstanceProfileAssociationState(IamInstanceProfileAssociationState enumValue)
+        const char* GetNameForIamInstanceProfileAssociationStateCStr(IamInstanceProfileAssociationState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IamInstanceProfileAssociationState::associating:
-            return "associating";
-          case IamInstanceProfileAssociationState::associated:
-            return "associated";
-          case IamInstanceProfileAssociationState::disassociating:
-            return "disassociating";
-          case IamInstanceProfileAssociationState::disassociated:
-            return "disassociated";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIamInstanceProfileAssociationState(IamInstanceProfileAssociationState enumValue)
+        {
+          return GetNameForIamInstanceProfileAssociationStateCStr(enumValue);
         }
 
       } // namespace IamInstanceProfileAssociationStateMapper
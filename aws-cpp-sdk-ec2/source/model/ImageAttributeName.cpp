@@ -30,45 +30,72 @@ namespace Aws
       namespace ImageAttributeNameMapper
       {
 
-        static const int description_HASH = HashingUtils::HashString("description");
-        static const int kernel_HASH = HashingUtils::HashString("kernel");
-        static const int ramdisk_HASH = HashingUtils::HashString("ramdisk");
-        static const int launchPermission_HASH = HashingUtils::HashString("launchPermission");
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
-        static const int blockDeviceMapping_HASH = HashingUtils::HashString("blockDeviceMapping");
-        static const int sriovNetSupport_HASH = HashingUtils::HashString("sriovNetSupport");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "description",
+          "kernel",
+          "ramdisk",
+          "launchPermission",
+          "productCodes",
+          "blockDeviceMapping",
+          "sriovNetSupport",
+        };
 
         ImageAttributeName GetImageAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == description_HASH)
-          {
-            return ImageAttributeName::description;
-          }
-          else if (hashCode == kernel_HASH)
-          {
-            return ImageAttributeName::kernel;
-          }
-          else if (hashCode == ramdisk_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ImageAttributeName::ramdisk;
-          }
-          else if (hashCode == launchPermission_HASH)
-          {
-            return ImageAttributeName::launchPermission;
-          }
-          else if (hashCode == productCodes_HASH)
-          {
-            return ImageAttributeName::productCodes;
-          }
-          else if (hashCode == blockDeviceMapping_HASH)
-          {
-            return ImageAttributeName::blockDeviceMapping;
-          }
-          else if (hashCode == sriovNetSupport_HASH)
-          {
-            return ImageAttributeName::sriovNetSupport;
+          case -1724546052:
+            if (name == "description")
+            {
+              return ImageAttributeName::description;
+            }
+            break;
+          case -1134867395:
+            if (name == "kernel")
+            {
+              return ImageAttributeName::kernel;
+            }
+            break;
+          case 976979643:
+            if (name == "ramdisk")
+            {
+              return ImageAttributeName::ramdisk;
+            }
+            break;
+          case -1159069214:
+            if (name == "launchPermission")
+            {
+              return ImageAttributeName::launchPermission;
+            }
+            break;
+          case 988549239:
+            if (name == "productCodes")
+            {
+              return ImageAttributeName::productCodes;
+            }
+            break;
+          case 1546575371:
+            if (name == "blockDeviceMapping")
+            {
+              return ImageAttributeName::blockDeviceMapping;
+            }
+            break;
+          case -1315506269:
+            if (name == "sriovNetSupport")
+            {
+              return ImageAttributeName::sriovNetSupport;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ImageAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForImageAttributeName(ImageAttributeName enumValue)
+        const char* GetNameForImageAttributeNameCStr(ImageAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ImageAttributeName::description:
-            return "description";
-          case ImageAttributeName::kernel:
-            return "kernel";
-          case ImageAttributeName::ramdisk:
-            return "ramdisk";
-          case ImageAttributeName::launchPermission:
-            return "launchPermission";
-          case ImageAttributeName::productCodes:
-            return "productCodes";
-          case ImageAttributeName::blockDeviceMapping:
-            return "blockDeviceMapping";
-          case ImageAttributeName::sriovNetSupport:
-            return "sriovNetSupport";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForImageAttributeName(ImageAttributeName enumValue)
+        {
+          return GetNameForImageAttributeNameCStr(enumValue);
         }
 
       } // namespace ImageAttributeNameMapper
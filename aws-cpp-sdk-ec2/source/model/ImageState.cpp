@@ -30,45 +30,72 @@ namespace Aws
       namespace ImageStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int invalid_HASH = HashingUtils::HashString("invalid");
-        static const int deregistered_HASH = HashingUtils::HashString("deregistered");
-        static const int transient_HASH = HashingUtils::HashString("transient");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int error_HASH = HashingUtils::HashString("error");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "available",
+          "invalid",
+          "deregistered",
+          "transient",
+          "failed",
+          "error",
+        };
 
         ImageState GetImageStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return ImageState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return ImageState::available;
-          }
-          else if (hashCode == invalid_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ImageState::invalid;
-          }
-          else if (hashCode == deregistered_HASH)
-          {
-            return ImageState::deregistered;
-          }
-          else if (hashCode == transient_HASH)
-          {
-            return ImageState::transient;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return ImageState::failed;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return ImageState::error;
+          case -682587753:
+            if (name == "pending")
+            {
+              return ImageState::pending;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return ImageState::available;
+            }
+            break;
+          case 1959784951:
+            if (name == "invalid")
+            {
+              return ImageState::invalid;
+            }
+            break;
+          case 1344945603:
+            if (name == "deregistered")
+            {
+              return ImageState::deregistered;
+            }
+            break;
+          case 1052746378:
+            if (name == "transient")
+            {
+              return ImageState::transient;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return ImageState::failed;
+            }
+            break;
+          case 96784904:
+            if (name == "error")
+            {
+              return ImageState::error;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ImageState::NOT_SET;
         }
 
-        Aws::String GetNameForImageState(ImageState enumValue)
+        const char* GetNameForImageStateCStr(ImageState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ImageState::pending:
-            return "pending";
-          case ImageState::available:
-            return "available";
-          case ImageState::invalid:
-            return "invalid";
-          case ImageState::deregistered:
-            return "deregistered";
-          case ImageState::transient:
-            return "transient";
-          case ImageState::failed:
-            return "failed";
-          case ImageState::error:
-            return "error";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForImageState(ImageState enumValue)
+        {
+          return GetNameForImageStateCStr(enumValue);
         }
 
       } // namespace ImageStateMapper
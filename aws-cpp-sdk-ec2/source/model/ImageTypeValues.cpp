@@ -30,25 +30,44 @@ namespace Aws
       namespace ImageTypeValuesMapper
       {
 
-        static const int machine_HASH = HashingUtils::HashString("machine");
-        static const int kernel_HASH = HashingUtils::HashString("kernel");
-        static const int ramdisk_HASH = HashingUtils::HashString("ramdisk");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "machine",
+          "kernel",
+          "ramdisk",
+        };
 
         ImageTypeValues GetImageTypeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == machine_HASH)
-          {
-            return ImageTypeValues::machine;
-          }
-          else if (hashCode == kernel_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ImageTypeValues::kernel;
-          }
-          else if (hashCode == ramdisk_HASH)
-          {
-            return ImageTypeValues::ramdisk;
+          case 825312327:
+            if (name == "machine")
+            {
+              return ImageTypeValues::machine;
+            }
+            break;
+          case -1134867395:
+            if (name == "kernel")
+            {
+              return ImageTypeValues::kernel;
+            }
+            break;
+          case 976979643:
+            if (name == "ramdisk")
+            {
+              return ImageTypeValues::ramdisk;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ImageTypeValues::NOT_SET;
         }
 
-        Aws::String GetNameForImageTypeValues(ImageTypeValues enumValue)
+        const char* GetNameForImageTypeValuesCStr(ImageTypeValues enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ImageTypeValues::machine:
-            return "machine";
-          case ImageTypeValues::kernel:
-            return "kernel";
-          case ImageTypeValues::ramdisk:
-            return "ramdisk";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForImageTypeValues(ImageTypeValues enumValue)
+        {
+          return GetNameForImageTypeValuesCStr(enumValue);
         }
 
       } // namespace ImageTypeValuesMapper
@@ -30,80 +30,121 @@ namespace Aws
       namespace InstanceAttributeNameMapper
       {
 
-        static const int instanceType_HASH = HashingUtils::HashString("instanceType");
-        static const int kernel_HASH = HashingUtils::HashString("kernel");
-        static const int ramdisk_HASH = HashingUtils::HashString("ramdisk");
-        static const int userData_HASH = HashingUtils::HashString("userData");
-        static const int disableApiTermination_HASH = HashingUtils::HashString("disableApiTermination");
-        static const int instanceInitiatedShutdownBehavior_HASH = HashingUtils::HashString("instanceInitiatedShutdownBehavior");
-        static const int rootDeviceName_HASH = HashingUtils::HashString("rootDeviceName");
-        static const int blockDeviceMapping_HASH = HashingUtils::HashString("blockDeviceMapping");
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
-        static const int sourceDestCheck_HASH = HashingUtils::HashString("sourceDestCheck");
-        static const int groupSet_HASH = HashingUtils::HashString("groupSet");
-        static const int ebsOptimized_HASH = HashingUtils::HashString("ebsOptimized");
-        static const int sriovNetSupport_HASH = HashingUtils::HashString("sriovNetSupport");
-        static const int enaSupport_HASH = HashingUtils::HashString("enaSupport");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "instanceType",
+          "kernel",
+          "ramdisk",
+          "userData",
+          "disableApiTermination",
+          "instanceInitiatedShutdownBehavior",
+          "rootDeviceName",
+          "blockDeviceMapping",
+          "productCodes",
+          "sourceDestCheck",
+          "groupSet",
+          "ebsOptimized",
+          "sriovNetSupport",
+          "enaSupport",
+        };
 
         InstanceAttributeName GetInstanceAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instanceType_HASH)
-          {
-            return InstanceAttributeName::instanceType;
-          }
-          else if (hashCode == kernel_HASH)
-          {
-            return InstanceAttributeName::kernel;
-          }
-          else if (hashCode == ramdisk_HASH)
-          {
-            return InstanceAttributeName::ramdisk;
-          }
-          else if (hashCode == userData_HASH)
-          {
-            return InstanceAttributeName::userData;
-          }
-          else if (hashCode == disableApiTermination_HASH)
-          {
-            return InstanceAttributeName::disableApiTermination;
-          }
-          else if (hashCode == instanceInitiatedShutdownBehavior_HASH)
-          {
-            return InstanceAttributeName::instanceInitiatedShutdownBehavior;
-          }
-          else if (hashCode == rootDeviceName_HASH)
-          {
-            return InstanceAttributeName::rootDeviceName;
-          }
-          else if (hashCode == blockDeviceMapping_HASH)
-          {
-            return InstanceAttributeName::blockDeviceMapping;
-          }
-          else if (hashCode == productCodes_HASH)
-          {
-            return InstanceAttributeName::productCodes;
-          }
-          else if (hashCode == sourceDestCheck_HASH)
-          {
-            return InstanceAttributeName::sourceDestCheck;
-          }
-          else if (hashCode == groupSet_HASH)
-          {
-            return InstanceAttributeName::groupSet;
-          }
-          else if (hashCode == ebsOptimized_HASH)
-          {
-            return InstanceAttributeName::ebsOptimized;
-          }
-          else if (hashCode == sriovNetSupport_HASH)
-          {
-            return InstanceAttributeName::sriovNetSupport;
-          }
-          else if (hashCode == enaSupport_HASH)
-          {
-            return InstanceAttributeName::enaSupport;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -737655441:
+            if (name == "instanceType")
+            {
+              return InstanceAttributeName::instanceType;
+            }
+            break;
+          case -1134867395:
+            if (name == "kernel")
+            {
+              return InstanceAttributeName::kernel;
+            }
+            break;
+          case 976979643:
+            if (name == "ramdisk")
+            {
+              return InstanceAttributeName::ramdisk;
+            }
+            break;
+          case -266964459:
+            if (name == "userData")
+            {
+              return InstanceAttributeName::userData;
+            }
+            break;
+          case 362887570:
+            if (name == "disableApiTermination")
+            {
+              return InstanceAttributeName::disableApiTermination;
+            }
+            break;
+          case -1947213122:
+            if (name == "instanceInitiatedShutdownBehavior")
+            {
+              return InstanceAttributeName::instanceInitiatedShutdownBehavior;
+            }
+            break;
+          case 1922702467:
+            if (name == "rootDeviceName")
+            {
+              return InstanceAttributeName::rootDeviceName;
+            }
+            break;
+          case 1546575371:
+            if (name == "blockDeviceMapping")
+            {
+              return InstanceAttributeName::blockDeviceMapping;
+            }
+            break;
+          case 988549239:
+            if (name == "productCodes")
+            {
+              return InstanceAttributeName::productCodes;
+            }
+            break;
+          case -1670942293:
+            if (name == "sourceDestCheck")
+            {
+              return InstanceAttributeName::sourceDestCheck;
+            }
+            break;
+          case 506349923:
+            if (name == "groupSet")
+            {
+              return InstanceAttributeName::groupSet;
+            }
+            break;
+          case -1426872751:
+            if (name == "ebsOptimized")
+            {
+              return InstanceAttributeName::ebsOptimized;
+            }
+            break;
+          case -1315506269:
+            if (name == "sriovNetSupport")
+            {
+              return InstanceAttributeName::sriovNetSupport;
+            }
+            break;
+          case 1734241239:
+            if (name == "enaSupport")
+            {
+              return InstanceAttributeName::enaSupport;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -115,47 +156,26 @@ namespace Aws
           return InstanceAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceAttributeName(InstanceAttributeName enumValue)
+        const char* GetNameForInstanceAttributeNameCStr(InstanceAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceAttributeName::instanceType:
-            return "instanceType";
-          case InstanceAttributeName::kernel:
-            return "kernel";
-          case InstanceAttributeName::ramdisk:
-            return "ramdisk";
-          case InstanceAttributeName::userData:
-            return "userData";
-          case InstanceAttributeName::disableApiTermination:
-            return "disableApiTermination";
-          case InstanceAttributeName::instanceInitiatedShutdownBehavior:
-            return "instanceInitiatedShutdownBehavior";
-          case InstanceAttributeName::rootDeviceName:
-            return "rootDeviceName";
-          case InstanceAttributeName::blockDeviceMapping:
-            return "blockDeviceMapping";
-          case InstanceAttributeName::productCodes:
-            return "productCodes";
-          case InstanceAttributeName::sourceDestCheck:
-            return "sourceDestCheck";
-          case InstanceAttributeName::groupSet:
-            return "groupSet";
-          case InstanceAttributeName::ebsOptimized:
-            return "ebsOptimized";
-          case InstanceAttributeName::sriovNetSupport:
-            return "sriovNetSupport";
-          case InstanceAttributeName::enaSupport:
-            return "enaSupport";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceAttributeName(InstanceAttributeName enumValue)
+        {
+          return GetNameForInstanceAttributeNameCStr(enumValue);
         }
 
       } // namespace InstanceAttributeNameMapper
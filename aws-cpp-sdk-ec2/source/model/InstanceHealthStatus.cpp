@@ -30,20 +30,37 @@ namespace Aws
       namespace InstanceHealthStatusMapper
       {
 
-        static const int healthy_HASH = HashingUtils::HashString("healthy");
-        static const int unhealthy_HASH = HashingUtils::HashString("unhealthy");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "healthy",
+          "unhealthy",
+        };
 
         InstanceHealthStatus GetInstanceHealthStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == healthy_HASH)
-          {
-            return InstanceHealthStatus::healthy;
-          }
-          else if (hashCode == unhealthy_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceHealthStatus::unhealthy;
+          case 795560349:
+            if (name == "healthy")
+            {
+              return InstanceHealthStatus::healthy;
+            }
+            break;
+          case -1787605788:
+            if (name == "unhealthy")
+            {
+              return InstanceHealthStatus::unhealthy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InstanceHealthStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceHealthStatus(InstanceHealthStatus enumValue)
+        const char* GetNameForInstanceHealthStatusCStr(InstanceHealthStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceHealthStatus::healthy:
-            return "healthy";
-          case InstanceHealthStatus::unhealthy:
-            return "unhealthy";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceHealthStatus(InstanceHealthStatus enumValue)
+        {
+          return GetNameForInstanceHealthStatusCStr(enumValue);
         }
 
       } // namespace InstanceHealthStatusMapper
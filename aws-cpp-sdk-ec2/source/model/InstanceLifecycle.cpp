@@ -30,20 +30,37 @@ namespace Aws
       namespace InstanceLifecycleMapper
       {
 
-        static const int spot_HASH = HashingUtils::HashString("spot");
-        static const int on_demand_HASH = HashingUtils::HashString("on-demand");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "spot",
+          "on-demand",
+        };
 
         InstanceLifecycle GetInstanceLifecycleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == spot_HASH)
-          {
-            return InstanceLifecycle::spot;
-          }
-          else if (hashCode == on_demand_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceLifecycle::on_demand;
+          case 3537154:
+            if (name == "spot")
+            {
+              return InstanceLifecycle::spot;
+            }
+            break;
+          case -380846599:
+            if (name == "on-demand")
+            {
+              return InstanceLifecycle::on_demand;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InstanceLifecycle::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceLifecycle(InstanceLifecycle enumValue)
+        const char* GetNameForInstanceLifecycleCStr(InstanceLifecycle enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceLifecycle::spot:
-            return "spot";
-          case InstanceLifecycle::on_demand:
-            return "on-demand";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceLifecycle(InstanceLifecycle enumValue)
+        {
+          return GetNameForInstanceLifecycleCStr(enumValue);
         }
 
       } // namespace InstanceLifecycleMapper
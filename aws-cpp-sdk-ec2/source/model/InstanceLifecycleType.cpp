@@ -30,20 +30,37 @@ namespace Aws
       namespace InstanceLifecycleTypeMapper
       {
 
-        static const int spot_HASH = HashingUtils::HashString("spot");
-        static const int scheduled_HASH = HashingUtils::HashString("scheduled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "spot",
+          "scheduled",
+        };
 
         InstanceLifecycleType GetInstanceLifecycleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == spot_HASH)
-          {
-            return InstanceLifecycleType::spot;
-          }
-          else if (hashCode == scheduled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceLifecycleType::scheduled;
+          case 3537154:
+            if (name == "spot")
+            {
+              return InstanceLifecycleType::spot;
+            }
+            break;
+          case -160710483:
+            if (name == "scheduled")
+            {
+              return InstanceLifecycleType::scheduled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InstanceLifecycleType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceLifecycleType(InstanceLifecycleType enumValue)
+        const char* GetNameForInstanceLifecycleTypeCStr(InstanceLifecycleType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceLifecycleType::spot:
-            return "spot";
-          case InstanceLifecycleType::scheduled:
-            return "scheduled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceLifecycleType(InstanceLifecycleType enumValue)
+        {
+          return GetNameForInstanceLifecycleTypeCStr(enumValue);
         }
 
       } // namespace InstanceLifecycleTypeMapper
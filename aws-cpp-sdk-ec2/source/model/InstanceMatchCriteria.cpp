@@ -30,20 +30,37 @@ namespace Aws
       namespace InstanceMatchCriteriaMapper
       {
 
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int targeted_HASH = HashingUtils::HashString("targeted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "open",
+          "targeted",
+        };
 
         InstanceMatchCriteria GetInstanceMatchCriteriaForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == open_HASH)
-          {
-            return InstanceMatchCriteria::open;
-          }
-          else if (hashCode == targeted_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceMatchCriteria::targeted;
+          case 3417674:
+            if (name == "open")
+            {
+              return InstanceMatchCriteria::open;
+            }
+            break;
+          case -441950736:
+            if (name == "targeted")
+            {
+              return InstanceMatchCriteria::targeted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InstanceMatchCriteria::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceMatchCriteria(InstanceMatchCriteria enumValue)
+        const char* GetNameForInstanceMatchCriteriaCStr(InstanceMatchCriteria enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceMatchCriteria::open:
-            return "open";
-          case InstanceMatchCriteria::targeted:
-            return "targeted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceMatchCriteria(InstanceMatchCriteria enumValue)
+        {
+          return GetNameForInstanceMatchCriteriaCStr(enumValue);
         }
 
       } // namespace InstanceMatchCriteriaMapper
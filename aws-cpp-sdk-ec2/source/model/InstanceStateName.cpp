@@ -30,40 +30,65 @@ namespace Aws
       namespace InstanceStateNameMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int running_HASH = HashingUtils::HashString("running");
-        static const int shutting_down_HASH = HashingUtils::HashString("shutting-down");
-        static const int terminated_HASH = HashingUtils::HashString("terminated");
-        static const int stopping_HASH = HashingUtils::HashString("stopping");
-        static const int stopped_HASH = HashingUtils::HashString("stopped");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "running",
+          "shutting-down",
+          "terminated",
+          "stopping",
+          "stopped",
+        };
 
         InstanceStateName GetInstanceStateNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return InstanceStateName::pending;
-          }
-          else if (hashCode == running_HASH)
-          {
-            return InstanceStateName::running;
-          }
-          else if (hashCode == shutting_down_HASH)
-          {
-            return InstanceStateName::shutting_down;
-          }
-          else if (hashCode == terminated_HASH)
-          {
-            return InstanceStateName::terminated;
-          }
-          else if (hashCode == stopping_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceStateName::stopping;
-          }
-          else if (hashCode == stopped_HASH)
-          {
-            return InstanceStateName::stopped;
+          case -682587753:
+            if (name == "pending")
+            {
+              return InstanceStateName::pending;
+            }
+            break;
+          case 1550783935:
+            if (name == "running")
+            {
+              return InstanceStateName::running;
+            }
+            break;
+          case 982230765:
+            if (name == "shutting-down")
+            {
+              return InstanceStateName::shutting_down;
+            }
+            break;
+          case -1308815837:
+            if (name == "terminated")
+            {
+              return InstanceStateName::terminated;
+            }
+            break;
+          case 1715648628:
+            if (name == "stopping")
+            {
+              return InstanceStateName::stopping;
+            }
+            break;
+          case -1884319283:
+            if (name == "stopped")
+            {
+              return InstanceStateName::stopped;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return InstanceStateName::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceStateName(InstanceStateName enumValue)
+        const char* GetNameForInstanceStateNameCStr(InstanceStateName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceStateName::pending:
-            return "pending";
-          case InstanceStateName::running:
-            return "running";
-          case InstanceStateName::shutting_down:
-            return "shutting-down";
-          case InstanceStateName::terminated:
-            return "terminated";
-          case InstanceStateName::stopping:
-            return "stopping";
-          case InstanceStateName::stopped:
-            return "stopped";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceStateName(InstanceStateName enumValue)
+        {
+          return GetNameForInstanceStateNameCStr(enumValue);
         }
 
       } // namespace InstanceStateNameMapper
@@ -30,1651 +30,1269 @@ namespace Aws
       namespace InstanceTypeMapper
       {
 
-        static const int t1_micro_HASH = HashingUtils::HashString("t1.micro");
-        static const int t2_nano_HASH = HashingUtils::HashString("t2.nano");
-        static const int t2_micro_HASH = HashingUtils::HashString("t2.micro");
-        static const int t2_small_HASH = HashingUtils::HashString("t2.small");
-        static const int t2_medium_HASH = HashingUtils::HashString("t2.medium");
-        static const int t2_large_HASH = HashingUtils::HashString("t2.large");
-        static const int t2_xlarge_HASH = HashingUtils::HashString("t2.xlarge");
-        static const int t2_2xlarge_HASH = HashingUtils::HashString("t2.2xlarge");
-        static const int t3_nano_HASH = HashingUtils::HashString("t3.nano");
-        static const int t3_micro_HASH = HashingUtils::HashString("t3.micro");
-        static const int t3_small_HASH = HashingUtils::HashString("t3.small");
-        static const int t3_medium_HASH = HashingUtils::HashString("t3.medium");
-        static const int t3_large_HASH = HashingUtils::HashString("t3.large");
-        static const int t3_xlarge_HASH = HashingUtils::HashString("t3.xlarge");
-        static const int t3_2xlarge_HASH = HashingUtils::HashString("t3.2xlarge");
-        static const int m1_small_HASH = HashingUtils::HashString("m1.small");
-        static const int m1_medium_HASH = HashingUtils::HashString("m1.medium");
-        static const int m1_large_HASH = HashingUtils::HashString("m1.large");
-        static const int m1_xlarge_HASH = HashingUtils::HashString("m1.xlarge");
-        static const int m3_medium_HASH = HashingUtils::HashString("m3.medium");
-        static const int m3_large_HASH = HashingUtils::HashString("m3.large");
-        static const int m3_xlarge_HASH = HashingUtils::HashString("m3.xlarge");
-        static const int m3_2xlarge_HASH = HashingUtils::HashString("m3.2xlarge");
-        static const int m4_large_HASH = HashingUtils::HashString("m4.large");
-        static const int m4_xlarge_HASH = HashingUtils::HashString("m4.xlarge");
-        static const int m4_2xlarge_HASH = HashingUtils::HashString("m4.2xlarge");
-        static const int m4_4xlarge_HASH = HashingUtils::HashString("m4.4xlarge");
-        static const int m4_10xlarge_HASH = HashingUtils::HashString("m4.10xlarge");
-        static const int m4_16xlarge_HASH = HashingUtils::HashString("m4.16xlarge");
-        static const int m2_xlarge_HASH = HashingUtils::HashString("m2.xlarge");
-        static const int m2_2xlarge_HASH = HashingUtils::HashString("m2.2xlarge");
-        static const int m2_4xlarge_HASH = HashingUtils::HashString("m2.4xlarge");
-        static const int cr1_8xlarge_HASH = HashingUtils::HashString("cr1.8xlarge");
-        static const int r3_large_HASH = HashingUtils::HashString("r3.large");
-        static const int r3_xlarge_HASH = HashingUtils::HashString("r3.xlarge");
-        static const int r3_2xlarge_HASH = HashingUtils::HashString("r3.2xlarge");
-        static const int r3_4xlarge_HASH = HashingUtils::HashString("r3.4xlarge");
-        static const int r3_8xlarge_HASH = HashingUtils::HashString("r3.8xlarge");
-        static const int r4_large_HASH = HashingUtils::HashString("r4.large");
-        static const int r4_xlarge_HASH = HashingUtils::HashString("r4.xlarge");
-        static const int r4_2xlarge_HASH = HashingUtils::HashString("r4.2xlarge");
-        static const int r4_4xlarge_HASH = HashingUtils::HashString("r4.4xlarge");
-        static const int r4_8xlarge_HASH = HashingUtils::HashString("r4.8xlarge");
-        static const int r4_16xlarge_HASH = HashingUtils::HashString("r4.16xlarge");
-        static const int r5_large_HASH = HashingUtils::HashString("r5.large");
-        static const int r5_xlarge_HASH = HashingUtils::HashString("r5.xlarge");
-        static const int r5_2xlarge_HASH = HashingUtils::HashString("r5.2xlarge");
-        static const int r5_4xlarge_HASH = HashingUtils::HashString("r5.4xlarge");
-        static const int r5_8xlarge_HASH = HashingUtils::HashString("r5.8xlarge");
-        static const int r5_12xlarge_HASH = HashingUtils::HashString("r5.12xlarge");
-        static const int r5_16xlarge_HASH = HashingUtils::HashString("r5.16xlarge");
-        static const int r5_24xlarge_HASH = HashingUtils::HashString("r5.24xlarge");
-        static const int r5_metal_HASH = HashingUtils::HashString("r5.metal");
-        static const int r5a_large_HASH = HashingUtils::HashString("r5a.large");
-        static const int r5a_xlarge_HASH = HashingUtils::HashString("r5a.xlarge");
-        static const int r5a_2xlarge_HASH = HashingUtils::HashString("r5a.2xlarge");
-        static const int r5a_4xlarge_HASH = HashingUtils::HashString("r5a.4xlarge");
-        static const int r5a_12xlarge_HASH = HashingUtils::HashString("r5a.12xlarge");
-        static const int r5a_24xlarge_HASH = HashingUtils::HashString("r5a.24xlarge");
-        static const int r5d_large_HASH = HashingUtils::HashString("r5d.large");
-        static const int r5d_xlarge_HASH = HashingUtils::HashString("r5d.xlarge");
-        static const int r5d_2xlarge_HASH = HashingUtils::HashString("r5d.2xlarge");
-        static const int r5d_4xlarge_HASH = HashingUtils::HashString("r5d.4xlarge");
-        static const int r5d_8xlarge_HASH = HashingUtils::HashString("r5d.8xlarge");
-        static const int r5d_12xlarge_HASH = HashingUtils::HashString("r5d.12xlarge");
-        static const int r5d_16xlarge_HASH = HashingUtils::HashString("r5d.16xlarge");
-        static const int r5d_24xlarge_HASH = HashingUtils::HashString("r5d.24xlarge");
-        static const int r5d_metal_HASH = HashingUtils::HashString("r5d.metal");
-        static const int x1_16xlarge_HASH = HashingUtils::HashString("x1.16xlarge");
-        static const int x1_32xlarge_HASH = HashingUtils::HashString("x1.32xlarge");
-        static const int x1e_xlarge_HASH = HashingUtils::HashString("x1e.xlarge");
-        static const int x1e_2xlarge_HASH = HashingUtils::HashString("x1e.2xlarge");
-        static const int x1e_4xlarge_HASH = HashingUtils::HashString("x1e.4xlarge");
-        static const int x1e_8xlarge_HASH = HashingUtils::HashString("x1e.8xlarge");
-        static const int x1e_16xlarge_HASH = HashingUtils::HashString("x1e.16xlarge");
-        static const int x1e_32xlarge_HASH = HashingUtils::HashString("x1e.32xlarge");
-        static const int i2_xlarge_HASH = HashingUtils::HashString("i2.xlarge");
-        static const int i2_2xlarge_HASH = HashingUtils::HashString("i2.2xlarge");
-        static const int i2_4xlarge_HASH = HashingUtils::HashString("i2.4xlarge");
-        static const int i2_8xlarge_HASH = HashingUtils::HashString("i2.8xlarge");
-        static const int i3_large_HASH = HashingUtils::HashString("i3.large");
-        static const int i3_xlarge_HASH = HashingUtils::HashString("i3.xlarge");
-        static const int i3_2xlarge_HASH = HashingUtils::HashString("i3.2xlarge");
-        static const int i3_4xlarge_HASH = HashingUtils::HashString("i3.4xlarge");
-        static const int i3_8xlarge_HASH = HashingUtils::HashString("i3.8xlarge");
-        static const int i3_16xlarge_HASH = HashingUtils::HashString("i3.16xlarge");
-        static const int i3_metal_HASH = HashingUtils::HashString("i3.metal");
-        static const int hi1_4xlarge_HASH = HashingUtils::HashString("hi1.4xlarge");
-        static const int hs1_8xlarge_HASH = HashingUtils::HashString("hs1.8xlarge");
-        static const int c1_medium_HASH = HashingUtils::HashString("c1.medium");
-        static const int c1_xlarge_HASH = HashingUtils::HashString("c1.xlarge");
-        static const int c3_large_HASH = HashingUtils::HashString("c3.large");
-        static const int c3_xlarge_HASH = HashingUtils::HashString("c3.xlarge");
-        static const int c3_2xlarge_HASH = HashingUtils::HashString("c3.2xlarge");
-        static const int c3_4xlarge_HASH = HashingUtils::HashString("c3.4xlarge");
-        static const int c3_8xlarge_HASH = HashingUtils::HashString("c3.8xlarge");
-        static const int c4_large_HASH = HashingUtils::HashString("c4.large");
-        static const int c4_xlarge_HASH = HashingUtils::HashString("c4.xlarge");
-        static const int c4_2xlarge_HASH = HashingUtils::HashString("c4.2xlarge");
-        static const int c4_4xlarge_HASH = HashingUtils::HashString("c4.4xlarge");
-        static const int c4_8xlarge_HASH = HashingUtils::HashString("c4.8xlarge");
-        static const int c5_large_HASH = HashingUtils::HashString("c5.large");
-        static const int c5_xlarge_HASH = HashingUtils::HashString("c5.xlarge");
-        static const int c5_2xlarge_HASH = HashingUtils::HashString("c5.2xlarge");
-        static const int c5_4xlarge_HASH = HashingUtils::HashString("c5.4xlarge");
-        static const int c5_9xlarge_HASH = HashingUtils::HashString("c5.9xlarge");
-        static const int c5_18xlarge_HASH = HashingUtils::HashString("c5.18xlarge");
-        static const int c5d_large_HASH = HashingUtils::HashString("c5d.large");
-        static const int c5d_xlarge_HASH = HashingUtils::HashString("c5d.xlarge");
-        static const int c5d_2xlarge_HASH = HashingUtils::HashString("c5d.2xlarge");
-        static const int c5d_4xlarge_HASH = HashingUtils::HashString("c5d.4xlarge");
-        static const int c5d_9xlarge_HASH = HashingUtils::HashString("c5d.9xlarge");
-        static const int c5d_18xlarge_HASH = HashingUtils::HashString("c5d.18xlarge");
-        static const int c5n_large_HASH = HashingUtils::HashString("c5n.large");
-        static const int c5n_xlarge_HASH = HashingUtils::HashString("c5n.xlarge");
-        static const int c5n_2xlarge_HASH = HashingUtils::HashString("c5n.2xlarge");
-        static const int c5n_4xlarge_HASH = HashingUtils::HashString("c5n.4xlarge");
-        static const int c5n_9xlarge_HASH = HashingUtils::HashString("c5n.9xlarge");
-        static const int c5n_18xlarge_HASH = HashingUtils::HashString("c5n.18xlarge");
-        static const int cc1_4xlarge_HASH = HashingUtils::HashString("cc1.4xlarge");
-        static const int cc2_8xlarge_HASH = HashingUtils::HashString("cc2.8xlarge");
-        static const int g2_2xlarge_HASH = HashingUtils::HashString("g2.2xlarge");
-        static const int g2_8xlarge_HASH = HashingUtils::HashString("g2.8xlarge");
-        static const int g3_4xlarge_HASH = HashingUtils::HashString("g3.4xlarge");
-        static const int g3_8xlarge_HASH = HashingUtils::HashString("g3.8xlarge");
-        static const int g3_16xlarge_HASH = HashingUtils::HashString("g3.16xlarge");
-        static const int g3s_xlarge_HASH = HashingUtils::HashString("g3s.xlarge");
-        static const int cg1_4xlarge_HASH = HashingUtils::HashString("cg1.4xlarge");
-        static const int p2_xlarge_HASH = HashingUtils::HashString("p2.xlarge");
-        static const int p2_8xlarge_HASH = HashingUtils::HashString("p2.8xlarge");
-        static const int p2_16xlarge_HASH = HashingUtils::HashString("p2.16xlarge");
-        static const int p3_2xlarge_HASH = HashingUtils::HashString("p3.2xlarge");
-        static const int p3_8xlarge_HASH = HashingUtils::HashString("p3.8xlarge");
-        static const int p3_16xlarge_HASH = HashingUtils::HashString("p3.16xlarge");
-        static const int p3dn_24xlarge_HASH = HashingUtils::HashString("p3dn.24xlarge");
-        static const int d2_xlarge_HASH = HashingUtils::HashString("d2.xlarge");
-        static const int d2_2xlarge_HASH = HashingUtils::HashString("d2.2xlarge");
-        static const int d2_4xlarge_HASH = HashingUtils::HashString("d2.4xlarge");
-        static const int d2_8xlarge_HASH = HashingUtils::HashString("d2.8xlarge");
-        static const int f1_2xlarge_HASH = HashingUtils::HashString("f1.2xlarge");
-        static const int f1_4xlarge_HASH = HashingUtils::HashString("f1.4xlarge");
-        static const int f1_16xlarge_HASH = HashingUtils::HashString("f1.16xlarge");
-        static const int m5_large_HASH = HashingUtils::HashString("m5.large");
-        static const int m5_xlarge_HASH = HashingUtils::HashString("m5.xlarge");
-        static const int m5_2xlarge_HASH = HashingUtils::HashString("m5.2xlarge");
-        static const int m5_4xlarge_HASH = HashingUtils::HashString("m5.4xlarge");
-        static const int m5_12xlarge_HASH = HashingUtils::HashString("m5.12xlarge");
-        static const int m5_24xlarge_HASH = HashingUtils::HashString("m5.24xlarge");
-        static const int m5a_large_HASH = HashingUtils::HashString("m5a.large");
-        static const int m5a_xlarge_HASH = HashingUtils::HashString("m5a.xlarge");
-        static const int m5a_2xlarge_HASH = HashingUtils::HashString("m5a.2xlarge");
-        static const int m5a_4xlarge_HASH = HashingUtils::HashString("m5a.4xlarge");
-        static const int m5a_12xlarge_HASH = HashingUtils::HashString("m5a.12xlarge");
-        static const int m5a_24xlarge_HASH = HashingUtils::HashString("m5a.24xlarge");
-        static const int m5d_large_HASH = HashingUtils::HashString("m5d.large");
-        static const int m5d_xlarge_HASH = HashingUtils::HashString("m5d.xlarge");
-        static const int m5d_2xlarge_HASH = HashingUtils::HashString("m5d.2xlarge");
-        static const int m5d_4xlarge_HASH = HashingUtils::HashString("m5d.4xlarge");
-        static const int m5d_12xlarge_HASH = HashingUtils::HashString("m5d.12xlarge");
-        static const int m5d_24xlarge_HASH = HashingUtils::HashString("m5d.24xlarge");
-        static const int h1_2xlarge_HASH = HashingUtils::HashString("h1.2xlarge");
-        static const int h1_4xlarge_HASH = HashingUtils::HashString("h1.4xlarge");
-        static const int h1_8xlarge_HASH = HashingUtils::HashString("h1.8xlarge");
-        static const int h1_16xlarge_HASH = HashingUtils::HashString("h1.16xlarge");
-        static const int z1d_large_HASH = HashingUtils::HashString("z1d.large");
-        static const int z1d_xlarge_HASH = HashingUtils::HashString("z1d.xlarge");
-        static const int z1d_2xlarge_HASH = HashingUtils::HashString("z1d.2xlarge");
-        static const int z1d_3xlarge_HASH = HashingUtils::HashString("z1d.3xlarge");
-        static const int z1d_6xlarge_HASH = HashingUtils::HashString("z1d.6xlarge");
-        static const int z1d_12xlarge_HASH = HashingUtils::HashString("z1d.12xlarge");
-        static const int u_6tb1_metal_HASH = HashingUtils::HashString("u-6tb1.metal");
-        static const int u_9tb1_metal_HASH = HashingUtils::HashString("u-9tb1.metal");
-        static const int u_12tb1_metal_HASH = HashingUtils::HashString("u-12tb1.metal");
-        static const int a1_medium_HASH = HashingUtils::HashString("a1.medium");
-        static const int a1_large_HASH = HashingUtils::HashString("a1.large");
-        static const int a1_xlarge_HASH = HashingUtils::HashString("a1.xlarge");
-        static const int a1_2xlarge_HASH = HashingUtils::HashString("a1.2xlarge");
-        static const int a1_4xlarge_HASH = HashingUtils::HashString("a1.4xlarge");
-
-        /*
-        The if-else chains in this file are converted into a jump table by the compiler,
-        which allows constant time lookup. The chain has been broken into helper functions
-        because MSVC has a maximum of 122 chained if-else blocks.
-        */
-        static bool GetEnumForNameHelper0(int hashCode, InstanceType& enumValue)
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
         {
-          if (hashCode == t1_micro_HASH)
-          {
-            enumValue = InstanceType::t1_micro;
-            return true;
-          }
-          else if (hashCode == t2_nano_HASH)
-          {
-            enumValue = InstanceType::t2_nano;
-            return true;
-          }
-          else if (hashCode == t2_micro_HASH)
-          {
-            enumValue = InstanceType::t2_micro;
-            return true;
-          }
-          else if (hashCode == t2_small_HASH)
-          {
-            enumValue = InstanceType::t2_small;
-            return true;
-          }
-          else if (hashCode == t2_medium_HASH)
-          {
-            enumValue = InstanceType::t2_medium;
-            return true;
-          }
-          else if (hashCode == t2_large_HASH)
-          {
-            enumValue = InstanceType::t2_large;
-            return true;
-          }
-          else if (hashCode == t2_xlarge_HASH)
-          {
-            enumValue = InstanceType::t2_xlarge;
-            return true;
-          }
-          else if (hashCode == t2_2xlarge_HASH)
-          {
-            enumValue = InstanceType::t2_2xlarge;
-            return true;
-          }
-          else if (hashCode == t3_nano_HASH)
-          {
-            enumValue = InstanceType::t3_nano;
-            return true;
-          }
-          else if (hashCode == t3_micro_HASH)
-          {
-            enumValue = InstanceType::t3_micro;
-            return true;
-          }
-          else if (hashCode == t3_small_HASH)
-          {
-            enumValue = InstanceType::t3_small;
-            return true;
-          }
-          else if (hashCode == t3_medium_HASH)
-          {
-            enumValue = InstanceType::t3_medium;
-            return true;
-          }
-          else if (hashCode == t3_large_HASH)
-          {
-            enumValue = InstanceType::t3_large;
-            return true;
-          }
-          else if (hashCode == t3_xlarge_HASH)
-          {
-            enumValue = InstanceType::t3_xlarge;
-            return true;
-          }
-          else if (hashCode == t3_2xlarge_HASH)
-          {
-            enumValue = InstanceType::t3_2xlarge;
-            return true;
-          }
-          else if (hashCode == m1_small_HASH)
-          {
-            enumValue = InstanceType::m1_small;
-            return true;
-          }
-          else if (hashCode == m1_medium_HASH)
-          {
-            enumValue = InstanceType::m1_medium;
-            return true;
-          }
-          else if (hashCode == m1_large_HASH)
-          {
-            enumValue = InstanceType::m1_large;
-            return true;
-          }
-          else if (hashCode == m1_xlarge_HASH)
-          {
-            enumValue = InstanceType::m1_xlarge;
-            return true;
-          }
-          else if (hashCode == m3_medium_HASH)
-          {
-            enumValue = InstanceType::m3_medium;
-            return true;
-          }
-          else if (hashCode == m3_large_HASH)
-          {
-            enumValue = InstanceType::m3_large;
-            return true;
-          }
-          else if (hashCode == m3_xlarge_HASH)
-          {
-            enumValue = InstanceType::m3_xlarge;
-            return true;
-          }
-          else if (hashCode == m3_2xlarge_HASH)
-          {
-            enumValue = InstanceType::m3_2xlarge;
-            return true;
-          }
-          else if (hashCode == m4_large_HASH)
-          {
-            enumValue = InstanceType::m4_large;
-            return true;
-          }
-          else if (hashCode == m4_xlarge_HASH)
-          {
-            enumValue = InstanceType::m4_xlarge;
-            return true;
-          }
-          else if (hashCode == m4_2xlarge_HASH)
-          {
-            enumValue = InstanceType::m4_2xlarge;
-            return true;
-          }
-          else if (hashCode == m4_4xlarge_HASH)
-          {
-            enumValue = InstanceType::m4_4xlarge;
-            return true;
-          }
-          else if (hashCode == m4_10xlarge_HASH)
-          {
-            enumValue = InstanceType::m4_10xlarge;
-            return true;
-          }
-          else if (hashCode == m4_16xlarge_HASH)
-          {
-            enumValue = InstanceType::m4_16xlarge;
-            return true;
-          }
-          else if (hashCode == m2_xlarge_HASH)
-          {
-            enumValue = InstanceType::m2_xlarge;
-            return true;
-          }
-          else if (hashCode == m2_2xlarge_HASH)
-          {
-            enumValue = InstanceType::m2_2xlarge;
-            return true;
-          }
-          else if (hashCode == m2_4xlarge_HASH)
-          {
-            enumValue = InstanceType::m2_4xlarge;
-            return true;
-          }
-          else if (hashCode == cr1_8xlarge_HASH)
-          {
-            enumValue = InstanceType::cr1_8xlarge;
-            return true;
-          }
-          else if (hashCode == r3_large_HASH)
-          {
-            enumValue = InstanceType::r3_large;
-            return true;
-          }
-          else if (hashCode == r3_xlarge_HASH)
-          {
-            enumValue = InstanceType::r3_xlarge;
-            return true;
-          }
-          else if (hashCode == r3_2xlarge_HASH)
-          {
-            enumValue = InstanceType::r3_2xlarge;
-            return true;
-          }
-          else if (hashCode == r3_4xlarge_HASH)
-          {
-            enumValue = InstanceType::r3_4xlarge;
-            return true;
-          }
-          else if (hashCode == r3_8xlarge_HASH)
-          {
-            enumValue = InstanceType::r3_8xlarge;
-            return true;
-          }
-          else if (hashCode == r4_large_HASH)
-          {
-            enumValue = InstanceType::r4_large;
-            return true;
-          }
-          else if (hashCode == r4_xlarge_HASH)
-          {
-            enumValue = InstanceType::r4_xlarge;
-            return true;
-          }
-          else if (hashCode == r4_2xlarge_HASH)
-          {
-            enumValue = InstanceType::r4_2xlarge;
-            return true;
-          }
-          else if (hashCode == r4_4xlarge_HASH)
-          {
-            enumValue = InstanceType::r4_4xlarge;
-            return true;
-          }
-          else if (hashCode == r4_8xlarge_HASH)
-          {
-            enumValue = InstanceType::r4_8xlarge;
-            return true;
-          }
-          else if (hashCode == r4_16xlarge_HASH)
-          {
-            enumValue = InstanceType::r4_16xlarge;
-            return true;
-          }
-          else if (hashCode == r5_large_HASH)
-          {
-            enumValue = InstanceType::r5_large;
-            return true;
-          }
-          else if (hashCode == r5_xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_xlarge;
-            return true;
-          }
-          else if (hashCode == r5_2xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_2xlarge;
-            return true;
-          }
-          else if (hashCode == r5_4xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_4xlarge;
-            return true;
-          }
-          else if (hashCode == r5_8xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_8xlarge;
-            return true;
-          }
-          else if (hashCode == r5_12xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_12xlarge;
-            return true;
-          }
-          else if (hashCode == r5_16xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_16xlarge;
-            return true;
-          }
-          else if (hashCode == r5_24xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_24xlarge;
-            return true;
-          }
-          else if (hashCode == r5_metal_HASH)
-          {
-            enumValue = InstanceType::r5_metal;
-            return true;
-          }
-          else if (hashCode == r5a_large_HASH)
-          {
-            enumValue = InstanceType::r5a_large;
-            return true;
-          }
-          else if (hashCode == r5a_xlarge_HASH)
-          {
-            enumValue = InstanceType::r5a_xlarge;
-            return true;
-          }
-          else if (hashCode == r5a_2xlarge_HASH)
-          {
-            enumValue = InstanceType::r5a_2xlarge;
-            return true;
-          }
-          else if (hashCode == r5a_4xlarge_HASH)
-          {
-            enumValue = InstanceType::r5a_4xlarge;
-            return true;
-          }
-          else if (hashCode == r5a_12xlarge_HASH)
-          {
-            enumValue = InstanceType::r5a_12xlarge;
-            return true;
-          }
-          else if (hashCode == r5a_24xlarge_HASH)
-          {
-            enumValue = InstanceType::r5a_24xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_large_HASH)
-          {
-            enumValue = InstanceType::r5d_large;
-            return true;
-          }
-          else if (hashCode == r5d_xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_2xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_2xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_4xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_4xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_8xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_8xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_12xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_12xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_16xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_16xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_24xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_24xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_metal_HASH)
-          {
-            enumValue = InstanceType::r5d_metal;
-            return true;
-          }
-          else if (hashCode == x1_16xlarge_HASH)
-          {
-            enumValue = InstanceType::x1_16xlarge;
-            return true;
-          }
-          else if (hashCode == x1_32xlarge_HASH)
-          {
-            enumValue = InstanceType::x1_32xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_2xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_2xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_4xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_4xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_8xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_8xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_16xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_16xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_32xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_32xlarge;
-            return true;
-          }
-          else if (hashCode == i2_xlarge_HASH)
-          {
-            enumValue = InstanceType::i2_xlarge;
-            return true;
-          }
-          else if (hashCode == i2_2xlarge_HASH)
-          {
-            enumValue = InstanceType::i2_2xlarge;
-            return true;
-          }
-          else if (hashCode == i2_4xlarge_HASH)
-          {
-            enumValue = InstanceType::i2_4xlarge;
-            return true;
-          }
-          else if (hashCode == i2_8xlarge_HASH)
-          {
-            enumValue = InstanceType::i2_8xlarge;
-            return true;
-          }
-          else if (hashCode == i3_large_HASH)
-          {
-            enumValue = InstanceType::i3_large;
-            return true;
-          }
-          else if (hashCode == i3_xlarge_HASH)
-          {
-            enumValue = InstanceType::i3_xlarge;
-            return true;
-          }
-          else if (hashCode == i3_2xlarge_HASH)
-          {
-            enumValue = InstanceType::i3_2xlarge;
-            return true;
-          }
-          else if (hashCode == i3_4xlarge_HASH)
-          {
-            enumValue = InstanceType::i3_4xlarge;
-            return true;
-          }
-          else if (hashCode == i3_8xlarge_HASH)
-          {
-            enumValue = InstanceType::i3_8xlarge;
-            return true;
-          }
-          else if (hashCode == i3_16xlarge_HASH)
-          {
-            enumValue = InstanceType::i3_16xlarge;
-            return true;
-          }
-          else if (hashCode == i3_metal_HASH)
-          {
-            enumValue = InstanceType::i3_metal;
-            return true;
-          }
-          else if (hashCode == hi1_4xlarge_HASH)
-          {
-            enumValue = InstanceType::hi1_4xlarge;
-            return true;
-          }
-          else if (hashCode == hs1_8xlarge_HASH)
-          {
-            enumValue = InstanceType::hs1_8xlarge;
-            return true;
-          }
-          else if (hashCode == c1_medium_HASH)
-          {
-            enumValue = InstanceType::c1_medium;
-            return true;
-          }
-          else if (hashCode == c1_xlarge_HASH)
-          {
-            enumValue = InstanceType::c1_xlarge;
-            return true;
-          }
-          else if (hashCode == c3_large_HASH)
-          {
-            enumValue = InstanceType::c3_large;
-            return true;
-          }
-          else if (hashCode == c3_xlarge_HASH)
-          {
-            enumValue = InstanceType::c3_xlarge;
-            return true;
-          }
-          else if (hashCode == c3_2xlarge_HASH)
-          {
-            enumValue = InstanceType::c3_2xlarge;
-            return true;
-          }
-          else if (hashCode == c3_4xlarge_HASH)
-          {
-            enumValue = InstanceType::c3_4xlarge;
-            return true;
-          }
-          else if (hashCode == c3_8xlarge_HASH)
-          {
-            enumValue = InstanceType::c3_8xlarge;
-            return true;
-          }
-          else if (hashCode == c4_large_HASH)
-          {
-            enumValue = InstanceType::c4_large;
-            return true;
-          }
-          else if (hashCode == c4_xlarge_HASH)
-          {
-            enumValue = InstanceType::c4_xlarge;
-            return true;
-          }
-          else if (hashCode == c4_2xlarge_HASH)
-          {
-            enumValue = InstanceType::c4_2xlarge;
-            return true;
-          }
-          else if (hashCode == c4_4xlarge_HASH)
-          {
-            enumValue = InstanceType::c4_4xlarge;
-            return true;
-          }
-          else if (hashCode == c4_8xlarge_HASH)
-          {
-            enumValue = InstanceType::c4_8xlarge;
-            return true;
-          }
-          else if (hashCode == c5_large_HASH)
-          {
-            enumValue = InstanceType::c5_large;
-            return true;
-          }
-          else if (hashCode == c5_xlarge_HASH)
-          {
-            enumValue = InstanceType::c5_xlarge;
-            return true;
-          }
-          else if (hashCode == c5_2xlarge_HASH)
-          {
-            enumValue = InstanceType::c5_2xlarge;
-            return true;
-          }
-          else if (hashCode == c5_4xlarge_HASH)
-          {
-            enumValue = InstanceType::c5_4xlarge;
-            return true;
-          }
-          else if (hashCode == c5_9xlarge_HASH)
-          {
-            enumValue = InstanceType::c5_9xlarge;
-            return true;
-          }
-          else if (hashCode == c5_18xlarge_HASH)
-          {
-            enumValue = InstanceType::c5_18xlarge;
-            return true;
-          }
-          else if (hashCode == c5d_large_HASH)
-          {
-            enumValue = InstanceType::c5d_large;
-            return true;
-          }
-          else if (hashCode == c5d_xlarge_HASH)
-          {
-            enumValue = InstanceType::c5d_xlarge;
-            return true;
-          }
-          else if (hashCode == c5d_2xlarge_HASH)
-          {
-            enumValue = InstanceType::c5d_2xlarge;
-            return true;
-          }
-          else if (hashCode == c5d_4xlarge_HASH)
-          {
-            enumValue = InstanceType::c5d_4xlarge;
-            return true;
-          }
-          else if (hashCode == c5d_9xlarge_HASH)
-          {
-            enumValue = InstanceType::c5d_9xlarge;
-            return true;
-          }
-          else if (hashCode == c5d_18xlarge_HASH)
-          {
-            enumValue = InstanceType::c5d_18xlarge;
-            return true;
-          }
-          else if (hashCode == c5n_large_HASH)
-          {
-            enumValue = InstanceType::c5n_large;
-            return true;
-          }
-          else if (hashCode == c5n_xlarge_HASH)
-          {
-            enumValue = InstanceType::c5n_xlarge;
-            return true;
-          }
-          else if (hashCode == c5n_2xlarge_HASH)
-          {
-            enumValue = InstanceType::c5n_2xlarge;
-            return true;
-          }
-          else if (hashCode == c5n_4xlarge_HASH)
-          {
-            enumValue = InstanceType::c5n_4xlarge;
-            return true;
-          }
-          else if (hashCode == c5n_9xlarge_HASH)
-          {
-            enumValue = InstanceType::c5n_9xlarge;
-            return true;
-          }
-          else if (hashCode == c5n_18xlarge_HASH)
-          {
-            enumValue = InstanceType::c5n_18xlarge;
-            return true;
-          }
-          else if (hashCode == cc1_4xlarge_HASH)
-          {
-            enumValue = InstanceType::cc1_4xlarge;
-            return true;
-          }
-          else if (hashCode == cc2_8xlarge_HASH)
-          {
-            enumValue = InstanceType::cc2_8xlarge;
-            return true;
-          }
-          else if (hashCode == g2_2xlarge_HASH)
-          {
-            enumValue = InstanceType::g2_2xlarge;
-            return true;
-          }
-          return false;
-        }
-        static bool GetEnumForNameHelper1(int hashCode, InstanceType& enumValue)
-        {
-          if (hashCode == g2_8xlarge_HASH)
-          {
-            enumValue = InstanceType::g2_8xlarge;
-            return true;
-          }
-          else if (hashCode == g3_4xlarge_HASH)
-          {
-            enumValue = InstanceType::g3_4xlarge;
-            return true;
-          }
-          else if (hashCode == g3_8xlarge_HASH)
-          {
-            enumValue = InstanceType::g3_8xlarge;
-            return true;
-          }
-          else if (hashCode == g3_16xlarge_HASH)
-          {
-            enumValue = InstanceType::g3_16xlarge;
-            return true;
-          }
-          else if (hashCode == g3s_xlarge_HASH)
-          {
-            enumValue = InstanceType::g3s_xlarge;
-            return true;
-          }
-          else if (hashCode == cg1_4xlarge_HASH)
-          {
-            enumValue = InstanceType::cg1_4xlarge;
-            return true;
-          }
-          else if (hashCode == p2_xlarge_HASH)
-          {
-            enumValue = InstanceType::p2_xlarge;
-            return true;
-          }
-          else if (hashCode == p2_8xlarge_HASH)
-          {
-            enumValue = InstanceType::p2_8xlarge;
-            return true;
-          }
-          else if (hashCode == p2_16xlarge_HASH)
-          {
-            enumValue = InstanceType::p2_16xlarge;
-            return true;
-          }
-          else if (hashCode == p3_2xlarge_HASH)
-          {
-            enumValue = InstanceType::p3_2xlarge;
-            return true;
-          }
-          else if (hashCode == p3_8xlarge_HASH)
-          {
-            enumValue = InstanceType::p3_8xlarge;
-            return true;
-          }
-          else if (hashCode == p3_16xlarge_HASH)
-          {
-            enumValue = InstanceType::p3_16xlarge;
-            return true;
-          }
-          else if (hashCode == p3dn_24xlarge_HASH)
-          {
-            enumValue = InstanceType::p3dn_24xlarge;
-            return true;
-          }
-          else if (hashCode == d2_xlarge_HASH)
-          {
-            enumValue = InstanceType::d2_xlarge;
-            return true;
-          }
-          else if (hashCode == d2_2xlarge_HASH)
-          {
-            enumValue = InstanceType::d2_2xlarge;
-            return true;
-          }
-          else if (hashCode == d2_4xlarge_HASH)
-          {
-            enumValue = InstanceType::d2_4xlarge;
-            return true;
-          }
-          else if (hashCode == d2_8xlarge_HASH)
-          {
-            enumValue = InstanceType::d2_8xlarge;
-            return true;
-          }
-          else if (hashCode == f1_2xlarge_HASH)
-          {
-            enumValue = InstanceType::f1_2xlarge;
-            return true;
-          }
-          else if (hashCode == f1_4xlarge_HASH)
-          {
-            enumValue = InstanceType::f1_4xlarge;
-            return true;
-          }
-          else if (hashCode == f1_16xlarge_HASH)
-          {
-            enumValue = InstanceType::f1_16xlarge;
-            return true;
-          }
-          else if (hashCode == m5_large_HASH)
-          {
-            enumValue = InstanceType::m5_large;
-            return true;
-          }
-          else if (hashCode == m5_xlarge_HASH)
-          {
-            enumValue = InstanceType::m5_xlarge;
-            return true;
-          }
-          else if (hashCode == m5_2xlarge_HASH)
-          {
-            enumValue = InstanceType::m5_2xlarge;
-            return true;
-          }
-          else if (hashCode == m5_4xlarge_HASH)
-          {
-            enumValue = InstanceType::m5_4xlarge;
-            return true;
-          }
-          else if (hashCode == m5_12xlarge_HASH)
-          {
-            enumValue = InstanceType::m5_12xlarge;
-            return true;
-          }
-          else if (hashCode == m5_24xlarge_HASH)
-          {
-            enumValue = InstanceType::m5_24xlarge;
-            return true;
-          }
-          else if (hashCode == m5a_large_HASH)
-          {
-            enumValue = InstanceType::m5a_large;
-            return true;
-          }
-          else if (hashCode == m5a_xlarge_HASH)
-          {
-            enumValue = InstanceType::m5a_xlarge;
-            return true;
-          }
-          else if (hashCode == m5a_2xlarge_HASH)
-          {
-            enumValue = InstanceType::m5a_2xlarge;
-            return true;
-          }
-          else if (hashCode == m5a_4xlarge_HASH)
-          {
-            enumValue = InstanceType::m5a_4xlarge;
-            return true;
-          }
-          else if (hashCode == m5a_12xlarge_HASH)
-          {
-            enumValue = InstanceType::m5a_12xlarge;
-            return true;
-          }
-          else if (hashCode == m5a_24xlarge_HASH)
-          {
-            enumValue = InstanceType::m5a_24xlarge;
-            return true;
-          }
-          else if (hashCode == m5d_large_HASH)
-          {
-            enumValue = InstanceType::m5d_large;
-            return true;
-          }
-          else if (hashCode == m5d_xlarge_HASH)
-          {
-            enumValue = InstanceType::m5d_xlarge;
-            return true;
-          }
-          else if (hashCode == m5d_2xlarge_HASH)
-          {
-            enumValue = InstanceType::m5d_2xlarge;
-            return true;
-          }
-          else if (hashCode == m5d_4xlarge_HASH)
-          {
-            enumValue = InstanceType::m5d_4xlarge;
-            return true;
-          }
-          else if (hashCode == m5d_12xlarge_HASH)
-          {
-            enumValue = InstanceType::m5d_12xlarge;
-            return true;
-          }
-          else if (hashCode == m5d_24xlarge_HASH)
-          {
-            enumValue = InstanceType::m5d_24xlarge;
-            return true;
-          }
-          else if (hashCode == h1_2xlarge_HASH)
-          {
-            enumValue = InstanceType::h1_2xlarge;
-            return true;
-          }
-          else if (hashCode == h1_4xlarge_HASH)
-          {
-            enumValue = InstanceType::h1_4xlarge;
-            return true;
-          }
-          else if (hashCode == h1_8xlarge_HASH)
-          {
-            enumValue = InstanceType::h1_8xlarge;
-            return true;
-          }
-          else if (hashCode == h1_16xlarge_HASH)
-          {
-            enumValue = InstanceType::h1_16xlarge;
-            return true;
-          }
-          else if (hashCode == z1d_large_HASH)
-          {
-            enumValue = InstanceType::z1d_large;
-            return true;
-          }
-          else if (hashCode == z1d_xlarge_HASH)
-          {
-            enumValue = InstanceType::z1d_xlarge;
-            return true;
-          }
-          else if (hashCode == z1d_2xlarge_HASH)
-          {
-            enumValue = InstanceType::z1d_2xlarge;
-            return true;
-          }
-          else if (hashCode == z1d_3xlarge_HASH)
-          {
-            enumValue = InstanceType::z1d_3xlarge;
-            return true;
-          }
-          else if (hashCode == z1d_6xlarge_HASH)
-          {
-            enumValue = InstanceType::z1d_6xlarge;
-            return true;
-          }
-          else if (hashCode == z1d_12xlarge_HASH)
-          {
-            enumValue = InstanceType::z1d_12xlarge;
-            return true;
-          }
-          else if (hashCode == u_6tb1_metal_HASH)
-          {
-            enumValue = InstanceType::u_6tb1_metal;
-            return true;
-          }
-          else if (hashCode == u_9tb1_metal_HASH)
-          {
-            enumValue = InstanceType::u_9tb1_metal;
-            return true;
-          }
-          else if (hashCode == u_12tb1_metal_HASH)
-          {
-            enumValue = InstanceType::u_12tb1_metal;
-            return true;
-          }
-          else if (hashCode == a1_medium_HASH)
-          {
-            enumValue = InstanceType::a1_medium;
-            return true;
-          }
-          else if (hashCode == a1_large_HASH)
-          {
-            enumValue = InstanceType::a1_large;
-            return true;
-          }
-          else if (hashCode == a1_xlarge_HASH)
-          {
-            enumValue = InstanceType::a1_xlarge;
-            return true;
-          }
-          else if (hashCode == a1_2xlarge_HASH)
-          {
-            enumValue = InstanceType::a1_2xlarge;
-            return true;
-          }
-          else if (hashCode == a1_4xlarge_HASH)
-          {
-            enumValue = InstanceType::a1_4xlarge;
-            return true;
-          }
-          return false;
-        }
-
-        static bool GetNameForEnumHelper0(InstanceType enumValue, Aws::String& value)
-        {
-          switch(enumValue)
-          {
-          case InstanceType::t1_micro:
-            value = "t1.micro";
-            return true;
-          case InstanceType::t2_nano:
-            value = "t2.nano";
-            return true;
-          case InstanceType::t2_micro:
-            value = "t2.micro";
-            return true;
-          case InstanceType::t2_small:
-            value = "t2.small";
-            return true;
-          case InstanceType::t2_medium:
-            value = "t2.medium";
-            return true;
-          case InstanceType::t2_large:
-            value = "t2.large";
-            return true;
-          case InstanceType::t2_xlarge:
-            value = "t2.xlarge";
-            return true;
-          case InstanceType::t2_2xlarge:
-            value = "t2.2xlarge";
-            return true;
-          case InstanceType::t3_nano:
-            value = "t3.nano";
-            return true;
-          case InstanceType::t3_micro:
-            value = "t3.micro";
-            return true;
-          case InstanceType::t3_small:
-            value = "t3.small";
-            return true;
-          case InstanceType::t3_medium:
-            value = "t3.medium";
-            return true;
-          case InstanceType::t3_large:
-            value = "t3.large";
-            return true;
-          case InstanceType::t3_xlarge:
-            value = "t3.xlarge";
-            return true;
-          case InstanceType::t3_2xlarge:
-            value = "t3.2xlarge";
-            return true;
-          case InstanceType::m1_small:
-            value = "m1.small";
-            return true;
-          case InstanceType::m1_medium:
-            value = "m1.medium";
-            return true;
-          case InstanceType::m1_large:
-            value = "m1.large";
-            return true;
-          case InstanceType::m1_xlarge:
-            value = "m1.xlarge";
-            return true;
-          case InstanceType::m3_medium:
-            value = "m3.medium";
-            return true;
-          case InstanceType::m3_large:
-            value = "m3.large";
-            return true;
-          case InstanceType::m3_xlarge:
-            value = "m3.xlarge";
-            return true;
-          case InstanceType::m3_2xlarge:
-            value = "m3.2xlarge";
-            return true;
-          case InstanceType::m4_large:
-            value = "m4.large";
-            return true;
-          case InstanceType::m4_xlarge:
-            value = "m4.xlarge";
-            return true;
-          case InstanceType::m4_2xlarge:
-            value = "m4.2xlarge";
-            return true;
-          case InstanceType::m4_4xlarge:
-            value = "m4.4xlarge";
-            return true;
-          case InstanceType::m4_10xlarge:
-            value = "m4.10xlarge";
-            return true;
-          case InstanceType::m4_16xlarge:
-            value = "m4.16xlarge";
-            return true;
-          case InstanceType::m2_xlarge:
-            value = "m2.xlarge";
-            return true;
-          case InstanceType::m2_2xlarge:
-            value = "m2.2xlarge";
-            return true;
-          case InstanceType::m2_4xlarge:
-            value = "m2.4xlarge";
-            return true;
-          case InstanceType::cr1_8xlarge:
-            value = "cr1.8xlarge";
-            return true;
-          case InstanceType::r3_large:
-            value = "r3.large";
-            return true;
-          case InstanceType::r3_xlarge:
-            value = "r3.xlarge";
-            return true;
-          case InstanceType::r3_2xlarge:
-            value = "r3.2xlarge";
-            return true;
-          case InstanceType::r3_4xlarge:
-            value = "r3.4xlarge";
-            return true;
-          case InstanceType::r3_8xlarge:
-            value = "r3.8xlarge";
-            return true;
-          case InstanceType::r4_large:
-            value = "r4.large";
-            return true;
-          case InstanceType::r4_xlarge:
-            value = "r4.xlarge";
-            return true;
-          case InstanceType::r4_2xlarge:
-            value = "r4.2xlarge";
-            return true;
-          case InstanceType::r4_4xlarge:
-            value = "r4.4xlarge";
-            return true;
-          case InstanceType::r4_8xlarge:
-            value = "r4.8xlarge";
-            return true;
-          case InstanceType::r4_16xlarge:
-            value = "r4.16xlarge";
-            return true;
-          case InstanceType::r5_large:
-            value = "r5.large";
-            return true;
-          case InstanceType::r5_xlarge:
-            value = "r5.xlarge";
-            return true;
-          case InstanceType::r5_2xlarge:
-            value = "r5.2xlarge";
-            return true;
-          case InstanceType::r5_4xlarge:
-            value = "r5.4xlarge";
-            return true;
-          case InstanceType::r5_8xlarge:
-            value = "r5.8xlarge";
-            return true;
-          case InstanceType::r5_12xlarge:
-            value = "r5.12xlarge";
-            return true;
-          case InstanceType::r5_16xlarge:
-            value = "r5.16xlarge";
-            return true;
-          case InstanceType::r5_24xlarge:
-            value = "r5.24xlarge";
-            return true;
-          case InstanceType::r5_metal:
-            value = "r5.metal";
-            return true;
-          case InstanceType::r5a_large:
-            value = "r5a.large";
-            return true;
-          case InstanceType::r5a_xlarge:
-            value = "r5a.xlarge";
-            return true;
-          case InstanceType::r5a_2xlarge:
-            value = "r5a.2xlarge";
-            return true;
-          case InstanceType::r5a_4xlarge:
-            value = "r5a.4xlarge";
-            return true;
-          case InstanceType::r5a_12xlarge:
-            value = "r5a.12xlarge";
-            return true;
-          case InstanceType::r5a_24xlarge:
-            value = "r5a.24xlarge";
-            return true;
-          case InstanceType::r5d_large:
-            value = "r5d.large";
-            return true;
-          case InstanceType::r5d_xlarge:
-            value = "r5d.xlarge";
-            return true;
-          case InstanceType::r5d_2xlarge:
-            value = "r5d.2xlarge";
-            return true;
-          case InstanceType::r5d_4xlarge:
-            value = "r5d.4xlarge";
-            return true;
-          case InstanceType::r5d_8xlarge:
-            value = "r5d.8xlarge";
-            return true;
-          case InstanceType::r5d_12xlarge:
-            value = "r5d.12xlarge";
-            return true;
-          case InstanceType::r5d_16xlarge:
-            value = "r5d.16xlarge";
-            return true;
-          case InstanceType::r5d_24xlarge:
-            value = "r5d.24xlarge";
-            return true;
-          case InstanceType::r5d_metal:
-            value = "r5d.metal";
-            return true;
-          case InstanceType::x1_16xlarge:
-            value = "x1.16xlarge";
-            return true;
-          case InstanceType::x1_32xlarge:
-            value = "x1.32xlarge";
-            return true;
-          case InstanceType::x1e_xlarge:
-            value = "x1e.xlarge";
-            return true;
-          case InstanceType::x1e_2xlarge:
-            value = "x1e.2xlarge";
-            return true;
-          case InstanceType::x1e_4xlarge:
-            value = "x1e.4xlarge";
-            return true;
-          case InstanceType::x1e_8xlarge:
-            value = "x1e.8xlarge";
-            return true;
-          case InstanceType::x1e_16xlarge:
-            value = "x1e.16xlarge";
-            return true;
-          case InstanceType::x1e_32xlarge:
-            value = "x1e.32xlarge";
-            return true;
-          case InstanceType::i2_xlarge:
-            value = "i2.xlarge";
-            return true;
-          case InstanceType::i2_2xlarge:
-            value = "i2.2xlarge";
-            return true;
-          case InstanceType::i2_4xlarge:
-            value = "i2.4xlarge";
-            return true;
-          case InstanceType::i2_8xlarge:
-            value = "i2.8xlarge";
-            return true;
-          case InstanceType::i3_large:
-            value = "i3.large";
-            return true;
-          case InstanceType::i3_xlarge:
-            value = "i3.xlarge";
-            return true;
-          case InstanceType::i3_2xlarge:
-            value = "i3.2xlarge";
-            return true;
-          case InstanceType::i3_4xlarge:
-            value = "i3.4xlarge";
-            return true;
-          case InstanceType::i3_8xlarge:
-            value = "i3.8xlarge";
-            return true;
-          case InstanceType::i3_16xlarge:
-            value = "i3.16xlarge";
-            return true;
-          case InstanceType::i3_metal:
-            value = "i3.metal";
-            return true;
-          case InstanceType::hi1_4xlarge:
-            value = "hi1.4xlarge";
-            return true;
-          case InstanceType::hs1_8xlarge:
-            value = "hs1.8xlarge";
-            return true;
-          case InstanceType::c1_medium:
-            value = "c1.medium";
-            return true;
-          case InstanceType::c1_xlarge:
-            value = "c1.xlarge";
-            return true;
-          case InstanceType::c3_large:
-            value = "c3.large";
-            return true;
-          case InstanceType::c3_xlarge:
-            value = "c3.xlarge";
-            return true;
-          case InstanceType::c3_2xlarge:
-            value = "c3.2xlarge";
-            return true;
-          case InstanceType::c3_4xlarge:
-            value = "c3.4xlarge";
-            return true;
-          case InstanceType::c3_8xlarge:
-            value = "c3.8xlarge";
-            return true;
-          case InstanceType::c4_large:
-            value = "c4.large";
-            return true;
-          case InstanceType::c4_xlarge:
-            value = "c4.xlarge";
-            return true;
-          case InstanceType::c4_2xlarge:
-            value = "c4.2xlarge";
-            return true;
-          case InstanceType::c4_4xlarge:
-            value = "c4.4xlarge";
-            return true;
-          case InstanceType::c4_8xlarge:
-            value = "c4.8xlarge";
-            return true;
-          case InstanceType::c5_large:
-            value = "c5.large";
-            return true;
-          case InstanceType::c5_xlarge:
-            value = "c5.xlarge";
-            return true;
-          case InstanceType::c5_2xlarge:
-            value = "c5.2xlarge";
-            return true;
-          case InstanceType::c5_4xlarge:
-            value = "c5.4xlarge";
-            return true;
-          case InstanceType::c5_9xlarge:
-            value = "c5.9xlarge";
-            return true;
-          case InstanceType::c5_18xlarge:
-            value = "c5.18xlarge";
-            return true;
-          case InstanceType::c5d_large:
-            value = "c5d.large";
-            return true;
-          case InstanceType::c5d_xlarge:
-            value = "c5d.xlarge";
-            return true;
-          case InstanceType::c5d_2xlarge:
-            value = "c5d.2xlarge";
-            return true;
-          case InstanceType::c5d_4xlarge:
-            value = "c5d.4xlarge";
-            return true;
-          case InstanceType::c5d_9xlarge:
-            value = "c5d.9xlarge";
-            return true;
-          case InstanceType::c5d_18xlarge:
-            value = "c5d.18xlarge";
-            return true;
-          case InstanceType::c5n_large:
-            value = "c5n.large";
-            return true;
-          case InstanceType::c5n_xlarge:
-            value = "c5n.xlarge";
-            return true;
-          case InstanceType::c5n_2xlarge:
-            value = "c5n.2xlarge";
-            return true;
-          case InstanceType::c5n_4xlarge:
-            value = "c5n.4xlarge";
-            return true;
-          case InstanceType::c5n_9xlarge:
-            value = "c5n.9xlarge";
-            return true;
-          case InstanceType::c5n_18xlarge:
-            value = "c5n.18xlarge";
-            return true;
-          case InstanceType::cc1_4xlarge:
-            value = "cc1.4xlarge";
-            return true;
-          case InstanceType::cc2_8xlarge:
-            value = "cc2.8xlarge";
-            return true;
-          case InstanceType::g2_2xlarge:
-            value = "g2.2xlarge";
-            return true;
-          default:
-            return false;
-          }
-        }
-        static bool GetNameForEnumHelper1(InstanceType enumValue, Aws::String& value)
-        {
-          switch(enumValue)
-          {
-          case InstanceType::g2_8xlarge:
-            value = "g2.8xlarge";
-            return true;
-          case InstanceType::g3_4xlarge:
-            value = "g3.4xlarge";
-            return true;
-          case InstanceType::g3_8xlarge:
-            value = "g3.8xlarge";
-            return true;
-          case InstanceType::g3_16xlarge:
-            value = "g3.16xlarge";
-            return true;
-          case InstanceType::g3s_xlarge:
-            value = "g3s.xlarge";
-            return true;
-          case InstanceType::cg1_4xlarge:
-            value = "cg1.4xlarge";
-            return true;
-          case InstanceType::p2_xlarge:
-            value = "p2.xlarge";
-            return true;
-          case InstanceType::p2_8xlarge:
-            value = "p2.8xlarge";
-            return true;
-          case InstanceType::p2_16xlarge:
-            value = "p2.16xlarge";
-            return true;
-          case InstanceType::p3_2xlarge:
-            value = "p3.2xlarge";
-            return true;
-          case InstanceType::p3_8xlarge:
-            value = "p3.8xlarge";
-            return true;
-          case InstanceType::p3_16xlarge:
-            value = "p3.16xlarge";
-            return true;
-          case InstanceType::p3dn_24xlarge:
-            value = "p3dn.24xlarge";
-            return true;
-          case InstanceType::d2_xlarge:
-            value = "d2.xlarge";
-            return true;
-          case InstanceType::d2_2xlarge:
-            value = "d2.2xlarge";
-            return true;
-          case InstanceType::d2_4xlarge:
-            value = "d2.4xlarge";
-            return true;
-          case InstanceType::d2_8xlarge:
-            value = "d2.8xlarge";
-            return true;
-          case InstanceType::f1_2xlarge:
-            value = "f1.2xlarge";
-            return true;
-          case InstanceType::f1_4xlarge:
-            value = "f1.4xlarge";
-            return true;
-          case InstanceType::f1_16xlarge:
-            value = "f1.16xlarge";
-            return true;
-          case InstanceType::m5_large:
-            value = "m5.large";
-            return true;
-          case InstanceType::m5_xlarge:
-            value = "m5.xlarge";
-            return true;
-          case InstanceType::m5_2xlarge:
-            value = "m5.2xlarge";
-            return true;
-          case InstanceType::m5_4xlarge:
-            value = "m5.4xlarge";
-            return true;
-          case InstanceType::m5_12xlarge:
-            value = "m5.12xlarge";
-            return true;
-          case InstanceType::m5_24xlarge:
-            value = "m5.24xlarge";
-            return true;
-          case InstanceType::m5a_large:
-            value = "m5a.large";
-            return true;
-          case InstanceType::m5a_xlarge:
-            value = "m5a.xlarge";
-            return true;
-          case InstanceType::m5a_2xlarge:
-            value = "m5a.2xlarge";
-            return true;
-          case InstanceType::m5a_4xlarge:
-            value = "m5a.4xlarge";
-            return true;
-          case InstanceType::m5a_12xlarge:
-            value = "m5a.12xlarge";
-            return true;
-          case InstanceType::m5a_24xlarge:
-            value = "m5a.24xlarge";
-            return true;
-          case InstanceType::m5d_large:
-            value = "m5d.large";
-            return true;
-          case InstanceType::m5d_xlarge:
-            value = "m5d.xlarge";
-            return true;
-          case InstanceType::m5d_2xlarge:
-            value = "m5d.2xlarge";
-            return true;
-          case InstanceType::m5d_4xlarge:
-            value = "m5d.4xlarge";
-            return true;
-          case InstanceType::m5d_12xlarge:
-            value = "m5d.12xlarge";
-            return true;
-          case InstanceType::m5d_24xlarge:
-            value = "m5d.24xlarge";
-            return true;
-          case InstanceType::h1_2xlarge:
-            value = "h1.2xlarge";
-            return true;
-          case InstanceType::h1_4xlarge:
-            value = "h1.4xlarge";
-            return true;
-          case InstanceType::h1_8xlarge:
-            value = "h1.8xlarge";
-            return true;
-          case InstanceType::h1_16xlarge:
-            value = "h1.16xlarge";
-            return true;
-          case InstanceType::z1d_large:
-            value = "z1d.large";
-            return true;
-          case InstanceType::z1d_xlarge:
-            value = "z1d.xlarge";
-            return true;
-          case InstanceType::z1d_2xlarge:
-            value = "z1d.2xlarge";
-            return true;
-          case InstanceType::z1d_3xlarge:
-            value = "z1d.3xlarge";
-            return true;
-          case InstanceType::z1d_6xlarge:
-            value = "z1d.6xlarge";
-            return true;
-          case InstanceType::z1d_12xlarge:
-            value = "z1d.12xlarge";
-            return true;
-          case InstanceType::u_6tb1_metal:
-            value = "u-6tb1.metal";
-            return true;
-          case InstanceType::u_9tb1_metal:
-            value = "u-9tb1.metal";
-            return true;
-          case InstanceType::u_12tb1_metal:
-            value = "u-12tb1.metal";
-            return true;
-          case InstanceType::a1_medium:
-            value = "a1.medium";
-            return true;
-          case InstanceType::a1_large:
-            value = "a1.large";
-            return true;
-          case InstanceType::a1_xlarge:
-            value = "a1.xlarge";
-            return true;
-          case InstanceType::a1_2xlarge:
-            value = "a1.2xlarge";
-            return true;
-          case InstanceType::a1_4xlarge:
-            value = "a1.4xlarge";
-            return true;
-          default:
-            return false;
-          }
-        }
+          "",
+          "t1.micro",
+          "t2.nano",
+          "t2.micro",
+          "t2.small",
+          "t2.medium",
+          "t2.large",
+          "t2.xlarge",
+          "t2.2xlarge",
+          "t3.nano",
+          "t3.micro",
+          "t3.small",
+          "t3.medium",
+          "t3.large",
+          "t3.xlarge",
+          "t3.2xlarge",
+          "m1.small",
+          "m1.medium",
+          "m1.large",
+          "m1.xlarge",
+          "m3.medium",
+          "m3.large",
+          "m3.xlarge",
+          "m3.2xlarge",
+          "m4.large",
+          "m4.xlarge",
+          "m4.2xlarge",
+          "m4.4xlarge",
+          "m4.10xlarge",
+          "m4.16xlarge",
+          "m2.xlarge",
+          "m2.2xlarge",
+          "m2.4xlarge",
+          "cr1.8xlarge",
+          "r3.large",
+          "r3.xlarge",
+          "r3.2xlarge",
+          "r3.4xlarge",
+          "r3.8xlarge",
+          "r4.large",
+          "r4.xlarge",
+          "r4.2xlarge",
+          "r4.4xlarge",
+          "r4.8xlarge",
+          "r4.16xlarge",
+          "r5.large",
+          "r5.xlarge",
+          "r5.2xlarge",
+          "r5.4xlarge",
+          "r5.8xlarge",
+          "r5.12xlarge",
+          "r5.16xlarge",
+          "r5.24xlarge",
+          "r5.metal",
+          "r5a.large",
+          "r5a.xlarge",
+          "r5a.2xlarge",
+          "r5a.4xlarge",
+          "r5a.12xlarge",
+          "r5a.24xlarge",
+          "r5d.large",
+          "r5d.xlarge",
+          "r5d.2xlarge",
+          "r5d.4xlarge",
+          "r5d.8xlarge",
+          "r5d.12xlarge",
+          "r5d.16xlarge",
+          "r5d.24xlarge",
+          "r5d.metal",
+          "x1.16xlarge",
+          "x1.32xlarge",
+          "x1e.xlarge",
+          "x1e.2xlarge",
+          "x1e.4xlarge",
+          "x1e.8xlarge",
+          "x1e.16xlarge",
+          "x1e.32xlarge",
+          "i2.xlarge",
+          "i2.2xlarge",
+          "i2.4xlarge",
+          "i2.8xlarge",
+          "i3.large",
+          "i3.xlarge",
+          "i3.2xlarge",
+          "i3.4xlarge",
+          "i3.8xlarge",
+          "i3.16xlarge",
+          "i3.metal",
+          "hi1.4xlarge",
+          "hs1.8xlarge",
+          "c1.medium",
+          "c1.xlarge",
+          "c3.large",
+          "c3.xlarge",
+          "c3.2xlarge",
+          "c3.4xlarge",
+          "c3.8xlarge",
+          "c4.large",
+          "c4.xlarge",
+          "c4.2xlarge",
+          "c4.4xlarge",
+          "c4.8xlarge",
+          "c5.large",
+          "c5.xlarge",
+          "c5.2xlarge",
+          "c5.4xlarge",
+          "c5.9xlarge",
+          "c5.18xlarge",
+          "c5d.large",
+          "c5d.xlarge",
+          "c5d.2xlarge",
+          "c5d.4xlarge",
+          "c5d.9xlarge",
+          "c5d.18xlarge",
+          "c5n.large",
+          "c5n.xlarge",
+          "c5n.2xlarge",
+          "c5n.4xlarge",
+          "c5n.9xlarge",
+          "c5n.18xlarge",
+          "cc1.4xlarge",
+          "cc2.8xlarge",
+          "g2.2xlarge",
+          "g2.8xlarge",
+          "g3.4xlarge",
+          "g3.8xlarge",
+          "g3.16xlarge",
+          "g3s.xlarge",
+          "cg1.4xlarge",
+          "p2.xlarge",
+          "p2.8xlarge",
+          "p2.16xlarge",
+          "p3.2xlarge",
+          "p3.8xlarge",
+          "p3.16xlarge",
+          "p3dn.24xlarge",
+          "d2.xlarge",
+          "d2.2xlarge",
+          "d2.4xlarge",
+          "d2.8xlarge",
+          "f1.2xlarge",
+          "f1.4xlarge",
+          "f1.16xlarge",
+          "m5.large",
+          "m5.xlarge",
+          "m5.2xlarge",
+          "m5.4xlarge",
+          "m5.12xlarge",
+          "m5.24xlarge",
+          "m5a.large",
+          "m5a.xlarge",
+          "m5a.2xlarge",
+          "m5a.4xlarge",
+          "m5a.12xlarge",
+          "m5a.24xlarge",
+          "m5d.large",
+          "m5d.xlarge",
+          "m5d.2xlarge",
+          "m5d.4xlarge",
+          "m5d.12xlarge",
+          "m5d.24xlarge",
+          "h1.2xlarge",
+          "h1.4xlarge",
+          "h1.8xlarge",
+          "h1.16xlarge",
+          "z1d.large",
+          "z1d.xlarge",
+          "z1d.2xlarge",
+          "z1d.3xlarge",
+          "z1d.6xlarge",
+          "z1d.12xlarge",
+          "u-6tb1.metal",
+          "u-9tb1.metal",
+          "u-12tb1.metal",
+          "a1.medium",
+          "a1.large",
+          "a1.xlarge",
+          "a1.2xlarge",
+          "a1.4xlarge",
+        };
 
         InstanceType GetInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          InstanceType enumValue;
-          if (GetEnumForNameHelper0(hashCode, enumValue))
-          {
-             return enumValue;
-          }
-          else if (GetEnumForNameHelper1(hashCode, enumValue))
-          {
-             return enumValue;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -2033592365:
+            if (name == "t1.micro")
+            {
+              return InstanceType::t1_micro;
+            }
+            break;
+          case 1348525156:
+            if (name == "t2.nano")
+            {
+              return InstanceType::t2_nano;
+            }
+            break;
+          case -1146088684:
+            if (name == "t2.micro")
+            {
+              return InstanceType::t2_micro;
+            }
+            break;
+          case -1140430505:
+            if (name == "t2.small")
+            {
+              return InstanceType::t2_small;
+            }
+            break;
+          case -1172683483:
+            if (name == "t2.medium")
+            {
+              return InstanceType::t2_medium;
+            }
+            break;
+          case -1147236469:
+            if (name == "t2.large")
+            {
+              return InstanceType::t2_large;
+            }
+            break;
+          case -851379341:
+            if (name == "t2.xlarge")
+            {
+              return InstanceType::t2_xlarge;
+            }
+            break;
+          case 2029508805:
+            if (name == "t2.2xlarge")
+            {
+              return InstanceType::t2_2xlarge;
+            }
+            break;
+          case 1377154307:
+            if (name == "t3.nano")
+            {
+              return InstanceType::t3_nano;
+            }
+            break;
+          case -258585003:
+            if (name == "t3.micro")
+            {
+              return InstanceType::t3_micro;
+            }
+            break;
+          case -252926824:
+            if (name == "t3.small")
+            {
+              return InstanceType::t3_small;
+            }
+            break;
+          case 570126852:
+            if (name == "t3.medium")
+            {
+              return InstanceType::t3_medium;
+            }
+            break;
+          case -259732788:
+            if (name == "t3.large")
+            {
+              return InstanceType::t3_large;
+            }
+            break;
+          case 891430994:
+            if (name == "t3.xlarge")
+            {
+              return InstanceType::t3_xlarge;
+            }
+            break;
+          case 222054342:
+            if (name == "t3.2xlarge")
+            {
+              return InstanceType::t3_2xlarge;
+            }
+            break;
+          case -1342704643:
+            if (name == "m1.small")
+            {
+              return InstanceType::m1_small;
+            }
+            break;
+          case 1146752831:
+            if (name == "m1.medium")
+            {
+              return InstanceType::m1_medium;
+            }
+            break;
+          case -1349510607:
+            if (name == "m1.large")
+            {
+              return InstanceType::m1_large;
+            }
+            break;
+          case 1468056973:
+            if (name == "m1.xlarge")
+            {
+              return InstanceType::m1_xlarge;
+            }
+            break;
+          case 337406205:
+            if (name == "m3.medium")
+            {
+              return InstanceType::m3_medium;
+            }
+            break;
+          case 425496755:
+            if (name == "m3.large")
+            {
+              return InstanceType::m3_large;
+            }
+            break;
+          case 658710347:
+            if (name == "m3.xlarge")
+            {
+              return InstanceType::m3_xlarge;
+            }
+            break;
+          case 1597648877:
+            if (name == "m3.2xlarge")
+            {
+              return InstanceType::m3_2xlarge;
+            }
+            break;
+          case 1313000436:
+            if (name == "m4.large")
+            {
+              return InstanceType::m4_large;
+            }
+            break;
+          case -1893446614:
+            if (name == "m4.xlarge")
+            {
+              return InstanceType::m4_xlarge;
+            }
+            break;
+          case -209805586:
+            if (name == "m4.2xlarge")
+            {
+              return InstanceType::m4_2xlarge;
+            }
+            break;
+          case 1565201776:
+            if (name == "m4.4xlarge")
+            {
+              return InstanceType::m4_4xlarge;
+            }
+            break;
+          case 1220608329:
+            if (name == "m4.10xlarge")
+            {
+              return InstanceType::m4_10xlarge;
+            }
+            break;
+          case -2044304177:
+            if (name == "m4.16xlarge")
+            {
+              return InstanceType::m4_16xlarge;
+            }
+            break;
+          case -1084099988:
+            if (name == "m2.xlarge")
+            {
+              return InstanceType::m2_xlarge;
+            }
+            break;
+          case -889863956:
+            if (name == "m2.2xlarge")
+            {
+              return InstanceType::m2_2xlarge;
+            }
+            break;
+          case 885143406:
+            if (name == "m2.4xlarge")
+            {
+              return InstanceType::m2_4xlarge;
+            }
+            break;
+          case -839447633:
+            if (name == "cr1.8xlarge")
+            {
+              return InstanceType::cr1_8xlarge;
+            }
+            break;
+          case 549613838:
+            if (name == "r3.large")
+            {
+              return InstanceType::r3_large;
+            }
+            break;
+          case 211372624:
+            if (name == "r3.xlarge")
+            {
+              return InstanceType::r3_xlarge;
+            }
+            break;
+          case 615081352:
+            if (name == "r3.2xlarge")
+            {
+              return InstanceType::r3_2xlarge;
+            }
+            break;
+          case -1904878582:
+            if (name == "r3.4xlarge")
+            {
+              return InstanceType::r3_4xlarge;
+            }
+            break;
+          case 1645136142:
+            if (name == "r3.8xlarge")
+            {
+              return InstanceType::r3_8xlarge;
+            }
+            break;
+          case 1437117519:
+            if (name == "r4.large")
+            {
+              return InstanceType::r4_large;
+            }
+            break;
+          case 1954182959:
+            if (name == "r4.xlarge")
+            {
+              return InstanceType::r4_xlarge;
+            }
+            break;
+          case -1192373111:
+            if (name == "r4.2xlarge")
+            {
+              return InstanceType::r4_2xlarge;
+            }
+            break;
+          case 582634251:
+            if (name == "r4.4xlarge")
+            {
+              return InstanceType::r4_4xlarge;
+            }
+            break;
+          case -162318321:
+            if (name == "r4.8xlarge")
+            {
+              return InstanceType::r4_8xlarge;
+            }
+            break;
+          case 1855840916:
+            if (name == "r4.16xlarge")
+            {
+              return InstanceType::r4_16xlarge;
+            }
+            break;
+          case -1970346096:
+            if (name == "r5.large")
+            {
+              return InstanceType::r5_large;
+            }
+            break;
+          case -597974002:
+            if (name == "r5.xlarge")
+            {
+              return InstanceType::r5_xlarge;
+            }
+            break;
+          case 1295139722:
+            if (name == "r5.2xlarge")
+            {
+              return InstanceType::r5_2xlarge;
+            }
+            break;
+          case -1224820212:
+            if (name == "r5.4xlarge")
+            {
+              return InstanceType::r5_4xlarge;
+            }
+            break;
+          case -1969772784:
+            if (name == "r5.8xlarge")
+            {
+              return InstanceType::r5_8xlarge;
+            }
+            break;
+          case -1890687313:
+            if (name == "r5.12xlarge")
+            {
+              return InstanceType::r5_12xlarge;
+            }
+            break;
+          case 1659327411:
+            if (name == "r5.16xlarge")
+            {
+              return InstanceType::r5_16xlarge;
+            }
+            break;
+          case 1627130384:
+            if (name == "r5.24xlarge")
+            {
+              return InstanceType::r5_24xlarge;
+            }
+            break;
+          case -1969301668:
+            if (name == "r5.metal")
+            {
+              return InstanceType::r5_metal;
+            }
+            break;
+          case -403516405:
+            if (name == "r5a.large")
+            {
+              return InstanceType::r5a_large;
+            }
+            break;
+          case 729106163:
+            if (name == "r5a.xlarge")
+            {
+              return InstanceType::r5a_xlarge;
+            }
+            break;
+          case -515048123:
+            if (name == "r5a.2xlarge")
+            {
+              return InstanceType::r5a_2xlarge;
+            }
+            break;
+          case 1259959239:
+            if (name == "r5a.4xlarge")
+            {
+              return InstanceType::r5a_4xlarge;
+            }
+            break;
+          case 2123031636:
+            if (name == "r5a.12xlarge")
+            {
+              return InstanceType::r5a_12xlarge;
+            }
+            break;
+          case 1345882037:
+            if (name == "r5a.24xlarge")
+            {
+              return InstanceType::r5a_24xlarge;
+            }
+            break;
+          case -2035972658:
+            if (name == "r5d.large")
+            {
+              return InstanceType::r5d_large;
+            }
+            break;
+          case 1662569872:
+            if (name == "r5d.xlarge")
+            {
+              return InstanceType::r5d_xlarge;
+            }
+            break;
+          case -1642444216:
+            if (name == "r5d.2xlarge")
+            {
+              return InstanceType::r5d_2xlarge;
+            }
+            break;
+          case 132563146:
+            if (name == "r5d.4xlarge")
+            {
+              return InstanceType::r5d_4xlarge;
+            }
+            break;
+          case -612389426:
+            if (name == "r5d.8xlarge")
+            {
+              return InstanceType::r5d_8xlarge;
+            }
+            break;
+          case 1533491121:
+            if (name == "r5d.12xlarge")
+            {
+              return InstanceType::r5d_12xlarge;
+            }
+            break;
+          case 788538549:
+            if (name == "r5d.16xlarge")
+            {
+              return InstanceType::r5d_16xlarge;
+            }
+            break;
+          case 756341522:
+            if (name == "r5d.24xlarge")
+            {
+              return InstanceType::r5d_24xlarge;
+            }
+            break;
+          case -2034928230:
+            if (name == "r5d.metal")
+            {
+              return InstanceType::r5d_metal;
+            }
+            break;
+          case 253607869:
+            if (name == "x1.16xlarge")
+            {
+              return InstanceType::x1_16xlarge;
+            }
+            break;
+          case 189213815:
+            if (name == "x1.32xlarge")
+            {
+              return InstanceType::x1_32xlarge;
+            }
+            break;
+          case 866182437:
+            if (name == "x1e.xlarge")
+            {
+              return InstanceType::x1e_xlarge;
+            }
+            break;
+          case -560650925:
+            if (name == "x1e.2xlarge")
+            {
+              return InstanceType::x1e_2xlarge;
+            }
+            break;
+          case 1214356437:
+            if (name == "x1e.4xlarge")
+            {
+              return InstanceType::x1e_4xlarge;
+            }
+            break;
+          case 469403865:
+            if (name == "x1e.8xlarge")
+            {
+              return InstanceType::x1e_8xlarge;
+            }
+            break;
+          case -35607798:
+            if (name == "x1e.16xlarge")
+            {
+              return InstanceType::x1e_16xlarge;
+            }
+            break;
+          case -100001852:
+            if (name == "x1e.32xlarge")
+            {
+              return InstanceType::x1e_32xlarge;
+            }
+            break;
+          case 1850750568:
+            if (name == "i2.xlarge")
+            {
+              return InstanceType::i2_xlarge;
+            }
+            break;
+          case -103809936:
+            if (name == "i2.2xlarge")
+            {
+              return InstanceType::i2_2xlarge;
+            }
+            break;
+          case 1671197426:
+            if (name == "i2.4xlarge")
+            {
+              return InstanceType::i2_4xlarge;
+            }
+            break;
+          case 926244854:
+            if (name == "i2.8xlarge")
+            {
+              return InstanceType::i2_8xlarge;
+            }
+            break;
+          case 2044190007:
+            if (name == "i3.large")
+            {
+              return InstanceType::i3_large;
+            }
+            break;
+          case -701406393:
+            if (name == "i3.xlarge")
+            {
+              return InstanceType::i3_xlarge;
+            }
+            break;
+          case -1911264399:
+            if (name == "i3.2xlarge")
+            {
+              return InstanceType::i3_2xlarge;
+            }
+            break;
+          case -136257037:
+            if (name == "i3.4xlarge")
+            {
+              return InstanceType::i3_4xlarge;
+            }
+            break;
+          case -881209609:
+            if (name == "i3.8xlarge")
+            {
+              return InstanceType::i3_8xlarge;
+            }
+            break;
+          case 1045047468:
+            if (name == "i3.16xlarge")
+            {
+              return InstanceType::i3_16xlarge;
+            }
+            break;
+          case 2045234435:
+            if (name == "i3.metal")
+            {
+              return InstanceType::i3_metal;
+            }
+            break;
+          case 1279304281:
+            if (name == "hi1.4xlarge")
+            {
+              return InstanceType::hi1_4xlarge;
+            }
+            break;
+          case -1430783341:
+            if (name == "hs1.8xlarge")
+            {
+              return InstanceType::hs1_8xlarge;
+            }
+            break;
+          case 2041428277:
+            if (name == "c1.medium")
+            {
+              return InstanceType::c1_medium;
+            }
+            break;
+          case -1932234877:
+            if (name == "c1.xlarge")
+            {
+              return InstanceType::c1_xlarge;
+            }
+            break;
+          case 177262589:
+            if (name == "c3.large")
+            {
+              return InstanceType::c3_large;
+            }
+            break;
+          case 1553385793:
+            if (name == "c3.xlarge")
+            {
+              return InstanceType::c3_xlarge;
+            }
+            break;
+          case -732183369:
+            if (name == "c3.2xlarge")
+            {
+              return InstanceType::c3_2xlarge;
+            }
+            break;
+          case 1042823993:
+            if (name == "c3.4xlarge")
+            {
+              return InstanceType::c3_4xlarge;
+            }
+            break;
+          case 297871421:
+            if (name == "c3.8xlarge")
+            {
+              return InstanceType::c3_8xlarge;
+            }
+            break;
+          case 1064766270:
+            if (name == "c4.large")
+            {
+              return InstanceType::c4_large;
+            }
+            break;
+          case -998771168:
+            if (name == "c4.xlarge")
+            {
+              return InstanceType::c4_xlarge;
+            }
+            break;
+          case 1755329464:
+            if (name == "c4.2xlarge")
+            {
+              return InstanceType::c4_2xlarge;
+            }
+            break;
+          case -764630470:
+            if (name == "c4.4xlarge")
+            {
+              return InstanceType::c4_4xlarge;
+            }
+            break;
+          case -1509583042:
+            if (name == "c4.8xlarge")
+            {
+              return InstanceType::c4_8xlarge;
+            }
+            break;
+          case 1952269951:
+            if (name == "c5.large")
+            {
+              return InstanceType::c5_large;
+            }
+            break;
+          case 744039167:
+            if (name == "c5.xlarge")
+            {
+              return InstanceType::c5_xlarge;
+            }
+            break;
+          case -52124999:
+            if (name == "c5.2xlarge")
+            {
+              return InstanceType::c5_2xlarge;
+            }
+            break;
+          case 1722882363:
+            if (name == "c5.4xlarge")
+            {
+              return InstanceType::c5_4xlarge;
+            }
+            break;
+          case 1865433472:
+            if (name == "c5.9xlarge")
+            {
+              return InstanceType::c5_9xlarge;
+            }
+            break;
+          case 323834086:
+            if (name == "c5.18xlarge")
+            {
+              return InstanceType::c5_18xlarge;
+            }
+            break;
+          case -693959489:
+            if (name == "c5d.large")
+            {
+              return InstanceType::c5d_large;
+            }
+            break;
+          case 315305151:
+            if (name == "c5d.xlarge")
+            {
+              return InstanceType::c5d_xlarge;
+            }
+            break;
+          case -457977607:
+            if (name == "c5d.2xlarge")
+            {
+              return InstanceType::c5d_2xlarge;
+            }
+            break;
+          case 1317029755:
+            if (name == "c5d.4xlarge")
+            {
+              return InstanceType::c5d_4xlarge;
+            }
+            break;
+          case 1459580864:
+            if (name == "c5d.9xlarge")
+            {
+              return InstanceType::c5d_9xlarge;
+            }
+            break;
+          case 627305126:
+            if (name == "c5d.18xlarge")
+            {
+              return InstanceType::c5d_18xlarge;
+            }
+            break;
+          case -408857271:
+            if (name == "c5n.large")
+            {
+              return InstanceType::c5n_large;
+            }
+            break;
+          case 563539317:
+            if (name == "c5n.xlarge")
+            {
+              return InstanceType::c5n_xlarge;
+            }
+            break;
+          case -1352653053:
+            if (name == "c5n.2xlarge")
+            {
+              return InstanceType::c5n_2xlarge;
+            }
+            break;
+          case 422354309:
+            if (name == "c5n.4xlarge")
+            {
+              return InstanceType::c5n_4xlarge;
+            }
+            break;
+          case 564905418:
+            if (name == "c5n.9xlarge")
+            {
+              return InstanceType::c5n_9xlarge;
+            }
+            break;
+          case -1337829924:
+            if (name == "c5n.18xlarge")
+            {
+              return InstanceType::c5n_18xlarge;
+            }
+            break;
+          case -1441759782:
+            if (name == "cc1.4xlarge")
+            {
+              return InstanceType::cc1_4xlarge;
+            }
+            break;
+          case 300800479:
+            if (name == "cc2.8xlarge")
+            {
+              return InstanceType::cc2_8xlarge;
+            }
+            break;
+          case 289217074:
+            if (name == "g2.2xlarge")
+            {
+              return InstanceType::g2_2xlarge;
+            }
+            break;
+          case 1319271864:
+            if (name == "g2.8xlarge")
+            {
+              return InstanceType::g2_8xlarge;
+            }
+            break;
+          case 256769973:
+            if (name == "g3.4xlarge")
+            {
+              return InstanceType::g3_4xlarge;
+            }
+            break;
+          case -488182599:
+            if (name == "g3.8xlarge")
+            {
+              return InstanceType::g3_8xlarge;
+            }
+            break;
+          case 343982890:
+            if (name == "g3.16xlarge")
+            {
+              return InstanceType::g3_16xlarge;
+            }
+            break;
+          case -778455990:
+            if (name == "g3s.xlarge")
+            {
+              return InstanceType::g3s_xlarge;
+            }
+            break;
+          case 2067153494:
+            if (name == "cg1.4xlarge")
+            {
+              return InstanceType::cg1_4xlarge;
+            }
+            break;
+          case 2083471215:
+            if (name == "p2.xlarge")
+            {
+              return InstanceType::p2_xlarge;
+            }
+            break;
+          case -449349681:
+            if (name == "p2.8xlarge")
+            {
+              return InstanceType::p2_8xlarge;
+            }
+            break;
+          case 1547803348:
+            if (name == "p2.16xlarge")
+            {
+              return InstanceType::p2_16xlarge;
+            }
+            break;
+          case 1008108362:
+            if (name == "p3.2xlarge")
+            {
+              return InstanceType::p3_2xlarge;
+            }
+            break;
+          case 2038163152:
+            if (name == "p3.8xlarge")
+            {
+              return InstanceType::p3_8xlarge;
+            }
+            break;
+          case 1351289843:
+            if (name == "p3.16xlarge")
+            {
+              return InstanceType::p3_16xlarge;
+            }
+            break;
+          case -2104803898:
+            if (name == "p3dn.24xlarge")
+            {
+              return InstanceType::p3dn_24xlarge;
+            }
+            break;
+          case -1996879005:
+            if (name == "d2.xlarge")
+            {
+              return InstanceType::d2_xlarge;
+            }
+            break;
+          case 878757589:
+            if (name == "d2.2xlarge")
+            {
+              return InstanceType::d2_2xlarge;
+            }
+            break;
+          case -1641202345:
+            if (name == "d2.4xlarge")
+            {
+              return InstanceType::d2_4xlarge;
+            }
+            break;
+          case 1908812379:
+            if (name == "d2.8xlarge")
+            {
+              return InstanceType::d2_8xlarge;
+            }
+            break;
+          case -2001782254:
+            if (name == "f1.2xlarge")
+            {
+              return InstanceType::f1_2xlarge;
+            }
+            break;
+          case -226774892:
+            if (name == "f1.4xlarge")
+            {
+              return InstanceType::f1_4xlarge;
+            }
+            break;
+          case -1761006037:
+            if (name == "f1.16xlarge")
+            {
+              return InstanceType::f1_16xlarge;
+            }
+            break;
+          case -2094463179:
+            if (name == "m5.large")
+            {
+              return InstanceType::m5_large;
+            }
+            break;
+          case -150636279:
+            if (name == "m5.xlarge")
+            {
+              return InstanceType::m5_xlarge;
+            }
+            break;
+          case -2017260049:
+            if (name == "m5.2xlarge")
+            {
+              return InstanceType::m5_2xlarge;
+            }
+            break;
+          case -242252687:
+            if (name == "m5.4xlarge")
+            {
+              return InstanceType::m5_4xlarge;
+            }
+            break;
+          case -1495865110:
+            if (name == "m5.12xlarge")
+            {
+              return InstanceType::m5_12xlarge;
+            }
+            break;
+          case 2021952587:
+            if (name == "m5.24xlarge")
+            {
+              return InstanceType::m5_24xlarge;
+            }
+            break;
+          case 43821318:
+            if (name == "m5a.large")
+            {
+              return InstanceType::m5a_large;
+            }
+            break;
+          case 1711673688:
+            if (name == "m5a.xlarge")
+            {
+              return InstanceType::m5a_xlarge;
+            }
+            break;
+          case -120225920:
+            if (name == "m5a.2xlarge")
+            {
+              return InstanceType::m5a_2xlarge;
+            }
+            break;
+          case 1654781442:
+            if (name == "m5a.4xlarge")
+            {
+              return InstanceType::m5a_4xlarge;
+            }
+            break;
+          case 1477618041:
+            if (name == "m5a.12xlarge")
+            {
+              return InstanceType::m5a_12xlarge;
+            }
+            break;
+          case 700468442:
+            if (name == "m5a.24xlarge")
+            {
+              return InstanceType::m5a_24xlarge;
+            }
+            break;
+          case -1588634935:
+            if (name == "m5d.large")
+            {
+              return InstanceType::m5d_large;
+            }
+            break;
+          case -1649829899:
+            if (name == "m5d.xlarge")
+            {
+              return InstanceType::m5d_xlarge;
+            }
+            break;
+          case -1247622013:
+            if (name == "m5d.2xlarge")
+            {
+              return InstanceType::m5d_2xlarge;
+            }
+            break;
+          case 527385349:
+            if (name == "m5d.4xlarge")
+            {
+              return InstanceType::m5d_4xlarge;
+            }
+            break;
+          case 888077526:
+            if (name == "m5d.12xlarge")
+            {
+              return InstanceType::m5d_12xlarge;
+            }
+            break;
+          case 110927927:
+            if (name == "m5d.24xlarge")
+            {
+              return InstanceType::m5d_24xlarge;
+            }
+            break;
+          case 1900158032:
+            if (name == "h1.2xlarge")
+            {
+              return InstanceType::h1_2xlarge;
+            }
+            break;
+          case -619801902:
+            if (name == "h1.4xlarge")
+            {
+              return InstanceType::h1_4xlarge;
+            }
+            break;
+          case -1364754474:
+            if (name == "h1.8xlarge")
+            {
+              return InstanceType::h1_8xlarge;
+            }
+            break;
+          case -1059941459:
+            if (name == "h1.16xlarge")
+            {
+              return InstanceType::h1_16xlarge;
+            }
+            break;
+          case -1992013222:
+            if (name == "z1d.large")
+            {
+              return InstanceType::z1d_large;
+            }
+            break;
+          case -1269654908:
+            if (name == "z1d.xlarge")
+            {
+              return InstanceType::z1d_xlarge;
+            }
+            break;
+          case 1947868116:
+            if (name == "z1d.2xlarge")
+            {
+              return InstanceType::z1d_2xlarge;
+            }
+            break;
+          case -1459595499:
+            if (name == "z1d.3xlarge")
+            {
+              return InstanceType::z1d_3xlarge;
+            }
+            break;
+          case 1202915544:
+            if (name == "z1d.6xlarge")
+            {
+              return InstanceType::z1d_6xlarge;
+            }
+            break;
+          case 1164023717:
+            if (name == "z1d.12xlarge")
+            {
+              return InstanceType::z1d_12xlarge;
+            }
+            break;
+          case -1613281858:
+            if (name == "u-6tb1.metal")
+            {
+              return InstanceType::u_6tb1_metal;
+            }
+            break;
+          case 2092144923:
+            if (name == "u-9tb1.metal")
+            {
+              return InstanceType::u_9tb1_metal;
+            }
+            break;
+          case -97533309:
+            if (name == "u-12tb1.metal")
+            {
+              return InstanceType::u_12tb1_metal;
+            }
+            break;
+          case 1361369907:
+            if (name == "a1.medium")
+            {
+              return InstanceType::a1_medium;
+            }
+            break;
+          case -788398147:
+            if (name == "a1.large")
+            {
+              return InstanceType::a1_large;
+            }
+            break;
+          case 1682674049:
+            if (name == "a1.xlarge")
+            {
+              return InstanceType::a1_xlarge;
+            }
+            break;
+          case -1019214729:
+            if (name == "a1.2xlarge")
+            {
+              return InstanceType::a1_2xlarge;
+            }
+            break;
+          case 755792633:
+            if (name == "a1.4xlarge")
+            {
+              return InstanceType::a1_4xlarge;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -1686,26 +1304,28 @@ namespace Aws
           return InstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceType(InstanceType enumValue)
+        const char* GetNameForInstanceTypeCStr(InstanceType enumValue)
         {
-          Aws::String value;
-          if (GetNameForEnumHelper0(enumValue, value))
-          {
-            return value;
-          }
-          else if (GetNameForEnumHelper1(enumValue, value))
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-            return value;
+            return NAMES[index];
           }
+
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
           {
-            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
 
           return "";
         }
 
+        Aws::String GetNameForInstanceType(InstanceType enumValue)
+        {
+          return GetNameForInstanceTypeCStr(enumValue);
+        }
+
       } // namespace InstanceTypeMapper
     } // namespace Model
   } // namespace EC2
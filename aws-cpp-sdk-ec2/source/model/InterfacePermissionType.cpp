@@ -30,20 +30,37 @@ namespace Aws
       namespace InterfacePermissionTypeMapper
       {
 
-        static const int INSTANCE_ATTACH_HASH = HashingUtils::HashString("INSTANCE-ATTACH");
-        static const int EIP_ASSOCIATE_HASH = HashingUtils::HashString("EIP-ASSOCIATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INSTANCE-ATTACH",
+          "EIP-ASSOCIATE",
+        };
 
         InterfacePermissionType GetInterfacePermissionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSTANCE_ATTACH_HASH)
-          {
-            return InterfacePermissionType::INSTANCE_ATTACH;
-          }
-          else if (hashCode == EIP_ASSOCIATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InterfacePermissionType::EIP_ASSOCIATE;
+          case 371222141:
+            if (name == "INSTANCE-ATTACH")
+            {
+              return InterfacePermissionType::INSTANCE_ATTACH;
+            }
+            break;
+          case -134101347:
+            if (name == "EIP-ASSOCIATE")
+            {
+              return InterfacePermissionType::EIP_ASSOCIATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InterfacePermissionType::NOT_SET;
         }
 
-        Aws::String GetNameForInterfacePermissionType(InterfacePermissionType enumValue)
+        const char* GetNameForInterfacePermissionTypeCStr(InterfacePermissionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InterfacePermissionType::INSTANCE_ATTACH:
-            return "INSTANCE-ATTACH";
-          case InterfacePermissionType::EIP_ASSOCIATE:
-            return "EIP-ASSOCIATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInterfacePermissionType(InterfacePermissionType enumValue)
+        {
+          return GetNameForInterfacePermissionTypeCStr(enumValue);
         }
 
       } // namespace InterfacePermissionTypeMapper
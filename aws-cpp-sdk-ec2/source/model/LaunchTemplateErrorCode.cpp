@@ -30,40 +30,65 @@ namespace Aws
       namespace LaunchTemplateErrorCodeMapper
       {
 
-        static const int launchTemplateIdDoesNotExist_HASH = HashingUtils::HashString("launchTemplateIdDoesNotExist");
-        static const int launchTemplateIdMalformed_HASH = HashingUtils::HashString("launchTemplateIdMalformed");
-        static const int launchTemplateNameDoesNotExist_HASH = HashingUtils::HashString("launchTemplateNameDoesNotExist");
-        static const int launchTemplateNameMalformed_HASH = HashingUtils::HashString("launchTemplateNameMalformed");
-        static const int launchTemplateVersionDoesNotExist_HASH = HashingUtils::HashString("launchTemplateVersionDoesNotExist");
-        static const int unexpectedError_HASH = HashingUtils::HashString("unexpectedError");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "launchTemplateIdDoesNotExist",
+          "launchTemplateIdMalformed",
+          "launchTemplateNameDoesNotExist",
+          "launchTemplateNameMalformed",
+          "launchTemplateVersionDoesNotExist",
+          "unexpectedError",
+        };
 
         LaunchTemplateErrorCode GetLaunchTemplateErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == launchTemplateIdDoesNotExist_HASH)
-          {
-            return LaunchTemplateErrorCode::launchTemplateIdDoesNotExist;
-          }
-          else if (hashCode == launchTemplateIdMalformed_HASH)
-          {
-            return LaunchTemplateErrorCode::launchTemplateIdMalformed;
-          }
-          else if (hashCode == launchTemplateNameDoesNotExist_HASH)
-          {
-            return LaunchTemplateErrorCode::launchTemplateNameDoesNotExist;
-          }
-          else if (hashCode == launchTemplateNameMalformed_HASH)
-          {
-            return LaunchTemplateErrorCode::launchTemplateNameMalformed;
-          }
-          else if (hashCode == launchTemplateVersionDoesNotExist_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LaunchTemplateErrorCode::launchTemplateVersionDoesNotExist;
-          }
-          else if (hashCode == unexpectedError_HASH)
-          {
-            return LaunchTemplateErrorCode::unexpectedError;
+          case -169992987:
+            if (name == "launchTemplateIdDoesNotExist")
+            {
+              return LaunchTemplateErrorCode::launchTemplateIdDoesNotExist;
+            }
+            break;
+          case 2012787027:
+            if (name == "launchTemplateIdMalformed")
+            {
+              return LaunchTemplateErrorCode::launchTemplateIdMalformed;
+            }
+            break;
+          case 1479994133:
+            if (name == "launchTemplateNameDoesNotExist")
+            {
+              return LaunchTemplateErrorCode::launchTemplateNameDoesNotExist;
+            }
+            break;
+          case -1391587037:
+            if (name == "launchTemplateNameMalformed")
+            {
+              return LaunchTemplateErrorCode::launchTemplateNameMalformed;
+            }
+            break;
+          case -353617944:
+            if (name == "launchTemplateVersionDoesNotExist")
+            {
+              return LaunchTemplateErrorCode::launchTemplateVersionDoesNotExist;
+            }
+            break;
+          case 1317945399:
+            if (name == "unexpectedError")
+            {
+              return LaunchTemplateErrorCode::unexpectedError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return LaunchTemplateErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForLaunchTemplateErrorCode(LaunchTemplateErrorCode enumValue)
+        const char* GetNameForLaunchTemplateErrorCodeCStr(LaunchTemplateErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LaunchTemplateErrorCode::launchTemplateIdDoesNotExist:
-            return "launchTemplateIdDoesNotExist";
-          case LaunchTemplateErrorCode::launchTemplateIdMalformed:
-            return "launchTemplateIdMalformed";
-          case LaunchTemplateErrorCode::launchTemplateNameDoesNotExist:
-            return "launchTemplateNameDoesNotExist";
-          case LaunchTemplateErrorCode::launchTemplateNameMalformed:
-            return "launchTemplateNameMalformed";
-          case LaunchTemplateErrorCode::launchTemplateVersionDoesNotExist:
-            return "launchTemplateVersionDoesNotExist";
-          case LaunchTemplateErrorCode::unexpectedError:
-            return "unexpectedError";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLaunchTemplateErrorCode(LaunchTemplateErrorCode enumValue)
+        {
+          return GetNameForLaunchTemplateErrorCodeCStr(enumValue);
         }
 
       } // namespace LaunchTemplateErrorCodeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ListingStateMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int sold_HASH = HashingUtils::HashString("sold");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "available",
+          "sold",
+          "cancelled",
+          "pending",
+        };
 
         ListingState GetListingStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
-          {
-            return ListingState::available;
-          }
-          else if (hashCode == sold_HASH)
-          {
-            return ListingState::sold;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return ListingState::cancelled;
-          }
-          else if (hashCode == pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ListingState::pending;
+          case -733902135:
+            if (name == "available")
+            {
+              return ListingState::available;
+            }
+            break;
+          case 3536084:
+            if (name == "sold")
+            {
+              return ListingState::sold;
+            }
+            break;
+          case 476588369:
+            if (name == "cancelled")
+            {
+              return ListingState::cancelled;
+            }
+            break;
+          case -682587753:
+            if (name == "pending")
+            {
+              return ListingState::pending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ListingState::NOT_SET;
         }
 
-        Aws::String GetNameForListingState(ListingState enumValue)
+        const char* GetNameForListingStateCStr(ListingState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ListingState::available:
-            return "available";
-          case ListingState::sold:
-            return "sold";
-          case ListingState::cancelled:
-            return "cancelled";
-          case ListingState::pending:
-            return "pending";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForListingState(ListingState enumValue)
+        {
+          return GetNameForListingStateCStr(enumValue);
         }
 
       } // namespace ListingStateMapper
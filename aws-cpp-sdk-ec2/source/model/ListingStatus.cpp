@@ -30,30 +30,51 @@ namespace Aws
       namespace ListingStatusMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int closed_HASH = HashingUtils::HashString("closed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "active",
+          "pending",
+          "cancelled",
+          "closed",
+        };
 
         ListingStatus GetListingStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
-          {
-            return ListingStatus::active;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return ListingStatus::pending;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return ListingStatus::cancelled;
-          }
-          else if (hashCode == closed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ListingStatus::closed;
+          case -1422950650:
+            if (name == "active")
+            {
+              return ListingStatus::active;
+            }
+            break;
+          case -682587753:
+            if (name == "pending")
+            {
+              return ListingStatus::pending;
+            }
+            break;
+          case 476588369:
+            if (name == "cancelled")
+            {
+              return ListingStatus::cancelled;
+            }
+            break;
+          case -1357520532:
+            if (name == "closed")
+            {
+              return ListingStatus::closed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ListingStatus::NOT_SET;
         }
 
-        Aws::String GetNameForListingStatus(ListingStatus enumValue)
+        const char* GetNameForListingStatusCStr(ListingStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ListingStatus::active:
-            return "active";
-          case ListingStatus::pending:
-            return "pending";
-          case ListingStatus::cancelled:
-            return "cancelled";
-          case ListingStatus::closed:
-            return "closed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForListingStatus(ListingStatus enumValue)
+        {
+          return GetNameForListingStatusCStr(enumValue);
         }
 
       } // namespace ListingStatusMapper
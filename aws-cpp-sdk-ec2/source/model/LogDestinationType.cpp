@@ -30,20 +30,37 @@ namespace Aws
       namespace LogDestinationTypeMapper
       {
 
-        static const int cloud_watch_logs_HASH = HashingUtils::HashString("cloud-watch-logs");
-        static const int s3_HASH = HashingUtils::HashString("s3");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "cloud-watch-logs",
+          "s3",
+        };
 
         LogDestinationType GetLogDestinationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cloud_watch_logs_HASH)
-          {
-            return LogDestinationType::cloud_watch_logs;
-          }
-          else if (hashCode == s3_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LogDestinationType::s3;
+          case 971363973:
+            if (name == "cloud-watch-logs")
+            {
+              return LogDestinationType::cloud_watch_logs;
+            }
+            break;
+          case 3616:
+            if (name == "s3")
+            {
+              return LogDestinationType::s3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LogDestinationType::NOT_SET;
         }
 
-        Aws::String GetNameForLogDestinationType(LogDestinationType enumValue)
+        const char* GetNameForLogDestinationTypeCStr(LogDestinationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LogDestinationType::cloud_watch_logs:
-            return "cloud-watch-logs";
-          case LogDestinationType::s3:
-            return "s3";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLogDestinationType(LogDestinationType enumValue)
+        {
+          return GetNameForLogDestinationTypeCStr(enumValue);
         }
 
       } // namespace LogDestinationTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace MarketTypeMapper
       {
 
-        static const int spot_HASH = HashingUtils::HashString("spot");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "spot",
+        };
 
         MarketType GetMarketTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == spot_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MarketType::spot;
+          case 3537154:
+            if (name == "spot")
+            {
+              return MarketType::spot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return MarketType::NOT_SET;
         }
 
-        Aws::String GetNameForMarketType(MarketType enumValue)
+        const char* GetNameForMarketTypeCStr(MarketType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MarketType::spot:
-            return "spot";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMarketType(MarketType enumValue)
+        {
+          return GetNameForMarketTypeCStr(enumValue);
         }
 
       } // namespace MarketTypeMapper
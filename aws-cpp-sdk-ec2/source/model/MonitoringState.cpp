@@ -30,30 +30,51 @@ namespace Aws
       namespace MonitoringStateMapper
       {
 
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
-        static const int disabling_HASH = HashingUtils::HashString("disabling");
-        static const int enabled_HASH = HashingUtils::HashString("enabled");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "disabled",
+          "disabling",
+          "enabled",
+          "pending",
+        };
 
         MonitoringState GetMonitoringStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == disabled_HASH)
-          {
-            return MonitoringState::disabled;
-          }
-          else if (hashCode == disabling_HASH)
-          {
-            return MonitoringState::disabling;
-          }
-          else if (hashCode == enabled_HASH)
-          {
-            return MonitoringState::enabled;
-          }
-          else if (hashCode == pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MonitoringState::pending;
+          case 270940796:
+            if (name == "disabled")
+            {
+              return MonitoringState::disabled;
+            }
+            break;
+          case -190765659:
+            if (name == "disabling")
+            {
+              return MonitoringState::disabling;
+            }
+            break;
+          case -1609594047:
+            if (name == "enabled")
+            {
+              return MonitoringState::enabled;
+            }
+            break;
+          case -682587753:
+            if (name == "pending")
+            {
+              return MonitoringState::pending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return MonitoringState::NOT_SET;
         }
 
-        Aws::String GetNameForMonitoringState(MonitoringState enumValue)
+        const char* GetNameForMonitoringStateCStr(MonitoringState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MonitoringState::disabled:
-            return "disabled";
-          case MonitoringState::disabling:
-            return "disabling";
-          case MonitoringState::enabled:
-            return "enabled";
-          case MonitoringState::pending:
-            return "pending";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMonitoringState(MonitoringState enumValue)
+        {
+          return GetNameForMonitoringStateCStr(enumValue);
         }
 
       } // namespace MonitoringStateMapper
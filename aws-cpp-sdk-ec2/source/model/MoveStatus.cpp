@@ -30,20 +30,37 @@ namespace Aws
       namespace MoveStatusMapper
       {
 
-        static const int movingToVpc_HASH = HashingUtils::HashString("movingToVpc");
-        static const int restoringToClassic_HASH = HashingUtils::HashString("restoringToClassic");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "movingToVpc",
+          "restoringToClassic",
+        };
 
         MoveStatus GetMoveStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == movingToVpc_HASH)
-          {
-            return MoveStatus::movingToVpc;
-          }
-          else if (hashCode == restoringToClassic_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MoveStatus::restoringToClassic;
+          case -1281174336:
+            if (name == "movingToVpc")
+            {
+              return MoveStatus::movingToVpc;
+            }
+            break;
+          case 1079001612:
+            if (name == "restoringToClassic")
+            {
+              return MoveStatus::restoringToClassic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MoveStatus::NOT_SET;
         }
 
-        Aws::String GetNameForMoveStatus(MoveStatus enumValue)
+        const char* GetNameForMoveStatusCStr(MoveStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MoveStatus::movingToVpc:
-            return "movingToVpc";
-          case MoveStatus::restoringToClassic:
-            return "restoringToClassic";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMoveStatus(MoveStatus enumValue)
+        {
+          return GetNameForMoveStatusCStr(enumValue);
         }
 
       } // namespace MoveStatusMapper
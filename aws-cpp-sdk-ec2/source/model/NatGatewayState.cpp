@@ -30,35 +30,58 @@ namespace Aws
       namespace NatGatewayStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "failed",
+          "available",
+          "deleting",
+          "deleted",
+        };
 
         NatGatewayState GetNatGatewayStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NatGatewayState::pending;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return NatGatewayState::failed;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return NatGatewayState::available;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return NatGatewayState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return NatGatewayState::deleted;
+          case -682587753:
+            if (name == "pending")
+            {
+              return NatGatewayState::pending;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return NatGatewayState::failed;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return NatGatewayState::available;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return NatGatewayState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return NatGatewayState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return NatGatewayState::NOT_SET;
         }
 
-        Aws::String GetNameForNatGatewayState(NatGatewayState enumValue)
+        const char* GetNameForNatGatewayStateCStr(NatGatewayState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NatGatewayState::pending:
-            return "pending";
-          case NatGatewayState::failed:
-            return "failed";
-          case NatGatewayState::available:
-            return "available";
-          case NatGatewayState::deleting:
-            return "deleting";
-          case NatGatewayState::deleted:
-            return "deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNatGatewayState(NatGatewayState enumValue)
+        {
+          return GetNameForNatGatewayStateCStr(enumValue);
         }
 
       } // namespace NatGatewayStateMapper
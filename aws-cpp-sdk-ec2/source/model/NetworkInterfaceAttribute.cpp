@@ -30,30 +30,51 @@ namespace Aws
       namespace NetworkInterfaceAttributeMapper
       {
 
-        static const int description_HASH = HashingUtils::HashString("description");
-        static const int groupSet_HASH = HashingUtils::HashString("groupSet");
-        static const int sourceDestCheck_HASH = HashingUtils::HashString("sourceDestCheck");
-        static const int attachment_HASH = HashingUtils::HashString("attachment");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "description",
+          "groupSet",
+          "sourceDestCheck",
+          "attachment",
+        };
 
         NetworkInterfaceAttribute GetNetworkInterfaceAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == description_HASH)
-          {
-            return NetworkInterfaceAttribute::description;
-          }
-          else if (hashCode == groupSet_HASH)
-          {
-            return NetworkInterfaceAttribute::groupSet;
-          }
-          else if (hashCode == sourceDestCheck_HASH)
-          {
-            return NetworkInterfaceAttribute::sourceDestCheck;
-          }
-          else if (hashCode == attachment_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NetworkInterfaceAttribute::attachment;
+          case -1724546052:
+            if (name == "description")
+            {
+              return NetworkInterfaceAttribute::description;
+            }
+            break;
+          case 506349923:
+            if (name == "groupSet")
+            {
+              return NetworkInterfaceAttribute::groupSet;
+            }
+            break;
+          case -1670942293:
+            if (name == "sourceDestCheck")
+            {
+              return NetworkInterfaceAttribute::sourceDestCheck;
+            }
+            break;
+          case -1963501277:
+            if (name == "attachment")
+            {
+              return NetworkInterfaceAttribute::attachment;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return NetworkInterfaceAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkInterfaceAttribute(NetworkInterfaceAttribute enumValue)
+        const char* GetNameForNetworkInterfaceAttributeCStr(NetworkInterfaceAttribute enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NetworkInterfaceAttribute::description:
-            return "description";
-          case NetworkInterfaceAttribute::groupSet:
-            return "groupSet";
-          case NetworkInterfaceAttribute::sourceDestCheck:
-            return "sourceDestCheck";
-          case NetworkInterfaceAttribute::attachment:
-            return "attachment";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNetworkInterfaceAttribute(NetworkInterfaceAttribute enumValue)
+        {
+          return GetNameForNetworkInterfaceAttributeCStr(enumValue);
         }
 
       } // namespace NetworkInterfaceAttributeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace NetworkInterfacePermissionStateCodeMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int granted_HASH = HashingUtils::HashString("granted");
-        static const int revoking_HASH = HashingUtils::HashString("revoking");
-        static const int revoked_HASH = HashingUtils::HashString("revoked");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "granted",
+          "revoking",
+          "revoked",
+        };
 
         NetworkInterfacePermissionStateCode GetNetworkInterfacePermissionStateCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return NetworkInterfacePermissionStateCode::pending;
-          }
-          else if (hashCode == granted_HASH)
-          {
-            return NetworkInterfacePermissionStateCode::granted;
-          }
-          else if (hashCode == revoking_HASH)
-          {
-            return NetworkInterfacePermissionStateCode::revoking;
-          }
-          else if (hashCode == revoked_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NetworkInterfacePermissionStateCode::revoked;
+          case -682587753:
+            if (name == "pending")
+            {
+              return NetworkInterfacePermissionStateCode::pending;
+            }
+            break;
+          case 280295099:
+            if (name == "granted")
+            {
+              return NetworkInterfacePermissionStateCode::granted;
+            }
+            break;
+          case -255483453:
+            if (name == "revoking")
+            {
+              return NetworkInterfacePermissionStateCode::revoking;
+            }
+            break;
+          case 1100137118:
+            if (name == "revoked")
+            {
+              return NetworkInterfacePermissionStateCode::revoked;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return NetworkInterfacePermissionStateCode::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkInterfacePermissionStateCode(NetworkInterfacePermissionStateCode enumValue)
+        const char* GetNameForNetworkInterfacePermissionStateCodeCStr(NetworkInterfacePermissionStateCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NetworkInterfacePermissionStateCode::pending:
-            return "pending";
-          case NetworkInterfacePermissionStateCode::granted:
-            return "granted";
-          case NetworkInterfacePermissionStateCode::revoking:
-            return "revoking";
-          case NetworkInterfacePermissionStateCode::revoked:
-            return "revoked";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNetworkInterfacePermissionStateCode(NetworkInterfacePermissionStateCode enumValue)
+        {
+          return GetNameForNetworkInterfacePermissionStateCodeCStr(enumValue);
         }
 
       } // namespace NetworkInterfacePermissionStateCodeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace NetworkInterfaceStatusMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int associated_HASH = HashingUtils::HashString("associated");
-        static const int attaching_HASH = HashingUtils::HashString("attaching");
-        static const int in_use_HASH = HashingUtils::HashString("in-use");
-        static const int detaching_HASH = HashingUtils::HashString("detaching");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "available",
+          "associated",
+          "attaching",
+          "in-use",
+          "detaching",
+        };
 
         NetworkInterfaceStatus GetNetworkInterfaceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NetworkInterfaceStatus::available;
-          }
-          else if (hashCode == associated_HASH)
-          {
-            return NetworkInterfaceStatus::associated;
-          }
-          else if (hashCode == attaching_HASH)
-          {
-            return NetworkInterfaceStatus::attaching;
-          }
-          else if (hashCode == in_use_HASH)
-          {
-            return NetworkInterfaceStatus::in_use;
-          }
-          else if (hashCode == detaching_HASH)
-          {
-            return NetworkInterfaceStatus::detaching;
+          case -733902135:
+            if (name == "available")
+            {
+              return NetworkInterfaceStatus::available;
+            }
+            break;
+          case 1936839942:
+            if (name == "associated")
+            {
+              return NetworkInterfaceStatus::associated;
+            }
+            break;
+          case -478984323:
+            if (name == "attaching")
+            {
+              return NetworkInterfaceStatus::attaching;
+            }
+            break;
+          case -1185862433:
+            if (name == "in-use")
+            {
+              return NetworkInterfaceStatus::in_use;
+            }
+            break;
+          case -1978731665:
+            if (name == "detaching")
+            {
+              return NetworkInterfaceStatus::detaching;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return NetworkInterfaceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkInterfaceStatus(NetworkInterfaceStatus enumValue)
+        const char* GetNameForNetworkInterfaceStatusCStr(NetworkInterfaceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NetworkInterfaceStatus::available:
-            return "available";
-          case NetworkInterfaceStatus::associated:
-            return "associated";
-          case NetworkInterfaceStatus::attaching:
-            return "attaching";
-          case NetworkInterfaceStatus::in_use:
-            return "in-use";
-          case NetworkInterfaceStatus::detaching:
-            return "detaching";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNetworkInterfaceStatus(NetworkInterfaceStatus enumValue)
+        {
+          return GetNameForNetworkInterfaceStatusCStr(enumValue);
         }
 
       } // namespace NetworkInterfaceStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace NetworkInterfaceTypeMapper
       {
 
-        static const int interface_HASH = HashingUtils::HashString("interface");
-        static const int natGateway_HASH = HashingUtils::HashString("natGateway");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "interface",
+          "natGateway",
+        };
 
         NetworkInterfaceType GetNetworkInterfaceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == interface_HASH)
-          {
-            return NetworkInterfaceType::interface;
-          }
-          else if (hashCode == natGateway_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NetworkInterfaceType::natGateway;
+          case 502623545:
+            if (name == "interface")
+            {
+              return NetworkInterfaceType::interface;
+            }
+            break;
+          case -1887969821:
+            if (name == "natGateway")
+            {
+              return NetworkInterfaceType::natGateway;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return NetworkInterfaceType::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkInterfaceType(NetworkInterfaceType enumValue)
+        const char* GetNameForNetworkInterfaceTypeCStr(NetworkInterfaceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NetworkInterfaceType::interface:
-            return "interface";
-          case NetworkInterfaceType::natGateway:
-            return "natGateway";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNetworkInterfaceType(NetworkInterfaceType enumValue)
+        {
+          return GetNameForNetworkInterfaceTypeCStr(enumValue);
         }
 
       } // namespace NetworkInterfaceTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace OfferingClassTypeMapper
       {
 
-        static const int standard_HASH = HashingUtils::HashString("standard");
-        static const int convertible_HASH = HashingUtils::HashString("convertible");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "standard",
+          "convertible",
+        };
 
         OfferingClassType GetOfferingClassTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == standard_HASH)
-          {
-            return OfferingClassType::standard;
-          }
-          else if (hashCode == convertible_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OfferingClassType::convertible;
+          case 1312628413:
+            if (name == "standard")
+            {
+              return OfferingClassType::standard;
+            }
+            break;
+          case -1083358075:
+            if (name == "convertible")
+            {
+              return OfferingClassType::convertible;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OfferingClassType::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingClassType(OfferingClassType enumValue)
+        const char* GetNameForOfferingClassTypeCStr(OfferingClassType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OfferingClassType::standard:
-            return "standard";
-          case OfferingClassType::convertible:
-            return "convertible";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOfferingClassType(OfferingClassType enumValue)
+        {
+          return GetNameForOfferingClassTypeCStr(enumValue);
         }
 
       } // namespace OfferingClassTypeMapper
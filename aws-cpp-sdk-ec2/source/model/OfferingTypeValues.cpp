@@ -30,40 +30,65 @@ namespace Aws
       namespace OfferingTypeValuesMapper
       {
 
-        static const int Heavy_Utilization_HASH = HashingUtils::HashString("Heavy Utilization");
-        static const int Medium_Utilization_HASH = HashingUtils::HashString("Medium Utilization");
-        static const int Light_Utilization_HASH = HashingUtils::HashString("Light Utilization");
-        static const int No_Upfront_HASH = HashingUtils::HashString("No Upfront");
-        static const int Partial_Upfront_HASH = HashingUtils::HashString("Partial Upfront");
-        static const int All_Upfront_HASH = HashingUtils::HashString("All Upfront");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Heavy Utilization",
+          "Medium Utilization",
+          "Light Utilization",
+          "No Upfront",
+          "Partial Upfront",
+          "All Upfront",
+        };
 
         OfferingTypeValues GetOfferingTypeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Heavy_Utilization_HASH)
-          {
-            return OfferingTypeValues::Heavy_Utilization;
-          }
-          else if (hashCode == Medium_Utilization_HASH)
-          {
-            return OfferingTypeValues::Medium_Utilization;
-          }
-          else if (hashCode == Light_Utilization_HASH)
-          {
-            return OfferingTypeValues::Light_Utilization;
-          }
-          else if (hashCode == No_Upfront_HASH)
-          {
-            return OfferingTypeValues::No_Upfront;
-          }
-          else if (hashCode == Partial_Upfront_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OfferingTypeValues::Partial_Upfront;
-          }
-          else if (hashCode == All_Upfront_HASH)
-          {
-            return OfferingTypeValues::All_Upfront;
+          case -716849143:
+            if (name == "Heavy Utilization")
+            {
+              return OfferingTypeValues::Heavy_Utilization;
+            }
+            break;
+          case -173259273:
+            if (name == "Medium Utilization")
+            {
+              return OfferingTypeValues::Medium_Utilization;
+            }
+            break;
+          case -1230436904:
+            if (name == "Light Utilization")
+            {
+              return OfferingTypeValues::Light_Utilization;
+            }
+            break;
+          case 160793871:
+            if (name == "No Upfront")
+            {
+              return OfferingTypeValues::No_Upfront;
+            }
+            break;
+          case -595895153:
+            if (name == "Partial Upfront")
+            {
+              return OfferingTypeValues::Partial_Upfront;
+            }
+            break;
+          case -1149969233:
+            if (name == "All Upfront")
+            {
+              return OfferingTypeValues::All_Upfront;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return OfferingTypeValues::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingTypeValues(OfferingTypeValues enumValue)
+        const char* GetNameForOfferingTypeValuesCStr(OfferingTypeValues enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OfferingTypeValues::Heavy_Utilization:
-            return "Heavy Utilization";
-          case OfferingTypeValues::Medium_Utilization:
-            return "Medium Utilization";
-          case OfferingTypeValues::Light_Utilization:
-            return "Light Utilization";
-          case OfferingTypeValues::No_Upfront:
-            return "No Upfront";
-          case OfferingTypeValues::Partial_Upfront:
-            return "Partial Upfront";
-          case OfferingTypeValues::All_Upfront:
-            return "All Upfront";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOfferingTypeValues(OfferingTypeValues enumValue)
+        {
+          return GetNameForOfferingTypeValuesCStr(enumValue);
         }
 
       } // namespace OfferingTypeValuesMapper
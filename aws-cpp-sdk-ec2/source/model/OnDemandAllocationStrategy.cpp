@@ -30,20 +30,37 @@ namespace Aws
       namespace OnDemandAllocationStrategyMapper
       {
 
-        static const int lowestPrice_HASH = HashingUtils::HashString("lowestPrice");
-        static const int prioritized_HASH = HashingUtils::HashString("prioritized");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "lowestPrice",
+          "prioritized",
+        };
 
         OnDemandAllocationStrategy GetOnDemandAllocationStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == lowestPrice_HASH)
-          {
-            return OnDemandAllocationStrategy::lowestPrice;
-          }
-          else if (hashCode == prioritized_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OnDemandAllocationStrategy::prioritized;
+          case 838159031:
+            if (name == "lowestPrice")
+            {
+              return OnDemandAllocationStrategy::lowestPrice;
+            }
+            break;
+          case 264111237:
+            if (name == "prioritized")
+            {
+              return OnDemandAllocationStrategy::prioritized;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OnDemandAllocationStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForOnDemandAllocationStrategy(OnDemandAllocationStrategy enumValue)
+        const char* GetNameForOnDemandAllocationStrategyCStr(OnDemandAllocationStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OnDemandAllocationStrategy::lowestPrice:
-            return "lowestPrice";
-          case OnDemandAllocationStrategy::prioritized:
-            return "prioritized";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOnDemandAllocationStrategy(OnDemandAllocationStrategy enumValue)
+        {
+          return GetNameForOnDemandAllocationStrategyCStr(enumValue);
         }
 
       } // namespace OnDemandAllocationStrategyMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int add_HASH = HashingUtils::HashString("add");
-        static const int remove_HASH = HashingUtils::HashString("remove");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "add",
+          "remove",
+        };
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == add_HASH)
-          {
-            return OperationType::add;
-          }
-          else if (hashCode == remove_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperationType::remove;
+          case 96417:
+            if (name == "add")
+            {
+              return OperationType::add;
+            }
+            break;
+          case -934610812:
+            if (name == "remove")
+            {
+              return OperationType::remove;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OperationType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationType(OperationType enumValue)
+        const char* GetNameForOperationTypeCStr(OperationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperationType::add:
-            return "add";
-          case OperationType::remove:
-            return "remove";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperationType(OperationType enumValue)
+        {
+          return GetNameForOperationTypeCStr(enumValue);
         }
 
       } // namespace OperationTypeMapper
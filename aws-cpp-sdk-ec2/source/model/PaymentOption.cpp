@@ -30,25 +30,44 @@ namespace Aws
       namespace PaymentOptionMapper
       {
 
-        static const int AllUpfront_HASH = HashingUtils::HashString("AllUpfront");
-        static const int PartialUpfront_HASH = HashingUtils::HashString("PartialUpfront");
-        static const int NoUpfront_HASH = HashingUtils::HashString("NoUpfront");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AllUpfront",
+          "PartialUpfront",
+          "NoUpfront",
+        };
 
         PaymentOption GetPaymentOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AllUpfront_HASH)
-          {
-            return PaymentOption::AllUpfront;
-          }
-          else if (hashCode == PartialUpfront_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PaymentOption::PartialUpfront;
-          }
-          else if (hashCode == NoUpfront_HASH)
-          {
-            return PaymentOption::NoUpfront;
+          case -1142502483:
+            if (name == "AllUpfront")
+            {
+              return PaymentOption::AllUpfront;
+            }
+            break;
+          case 1646317517:
+            if (name == "PartialUpfront")
+            {
+              return PaymentOption::PartialUpfront;
+            }
+            break;
+          case -1931503795:
+            if (name == "NoUpfront")
+            {
+              return PaymentOption::NoUpfront;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PaymentOption::NOT_SET;
         }
 
-        Aws::String GetNameForPaymentOption(PaymentOption enumValue)
+        const char* GetNameForPaymentOptionCStr(PaymentOption enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PaymentOption::AllUpfront:
-            return "AllUpfront";
-          case PaymentOption::PartialUpfront:
-            return "PartialUpfront";
-          case PaymentOption::NoUpfront:
-            return "NoUpfront";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPaymentOption(PaymentOption enumValue)
+        {
+          return GetNameForPaymentOptionCStr(enumValue);
         }
 
       } // namespace PaymentOptionMapper
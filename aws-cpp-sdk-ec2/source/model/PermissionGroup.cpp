@@ -30,15 +30,30 @@ namespace Aws
       namespace PermissionGroupMapper
       {
 
-        static const int all_HASH = HashingUtils::HashString("all");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "all",
+        };
 
         PermissionGroup GetPermissionGroupForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == all_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PermissionGroup::all;
+          case 96673:
+            if (name == "all")
+            {
+              return PermissionGroup::all;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return PermissionGroup::NOT_SET;
         }
 
-        Aws::String GetNameForPermissionGroup(PermissionGroup enumValue)
+        const char* GetNameForPermissionGroupCStr(PermissionGroup enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PermissionGroup::all:
-            return "all";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPermissionGroup(PermissionGroup enumValue)
+        {
+          return GetNameForPermissionGroupCStr(enumValue);
         }
 
       } // namespace PermissionGroupMapper
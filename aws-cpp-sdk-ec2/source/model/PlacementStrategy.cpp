@@ -30,25 +30,44 @@ namespace Aws
       namespace PlacementStrategyMapper
       {
 
-        static const int cluster_HASH = HashingUtils::HashString("cluster");
-        static const int spread_HASH = HashingUtils::HashString("spread");
-        static const int partition_HASH = HashingUtils::HashString("partition");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "cluster",
+          "spread",
+          "partition",
+        };
 
         PlacementStrategy GetPlacementStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cluster_HASH)
-          {
-            return PlacementStrategy::cluster;
-          }
-          else if (hashCode == spread_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlacementStrategy::spread;
-          }
-          else if (hashCode == partition_HASH)
-          {
-            return PlacementStrategy::partition;
+          case 872092154:
+            if (name == "cluster")
+            {
+              return PlacementStrategy::cluster;
+            }
+            break;
+          case -895684237:
+            if (name == "spread")
+            {
+              return PlacementStrategy::spread;
+            }
+            break;
+          case -1799810326:
+            if (name == "partition")
+            {
+              return PlacementStrategy::partition;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PlacementStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForPlacementStrategy(PlacementStrategy enumValue)
+        const char* GetNameForPlacementStrategyCStr(PlacementStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlacementStrategy::cluster:
-            return "cluster";
-          case PlacementStrategy::spread:
-            return "spread";
-          case PlacementStrategy::partition:
-            return "partition";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlacementStrategy(PlacementStrategy enumValue)
+        {
+          return GetNameForPlacementStrategyCStr(enumValue);
         }
 
       } // namespace PlacementStrategyMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace PlatformValuesMapper
       {
 
-        static const int Windows_HASH = HashingUtils::HashString("Windows");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Windows",
+        };
 
         PlatformValues GetPlatformValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Windows_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlatformValues::Windows;
+          case -1280820637:
+            if (name == "Windows")
+            {
+              return PlatformValues::Windows;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return PlatformValues::NOT_SET;
         }
 
-        Aws::String GetNameForPlatformValues(PlatformValues enumValue)
+        const char* GetNameForPlatformValuesCStr(PlatformValues enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlatformValues::Windows:
-            return "Windows";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlatformValues(PlatformValues enumValue)
+        {
+          return GetNameForPlatformValuesCStr(enumValue);
         }
 
       } // namespace PlatformValuesMapper
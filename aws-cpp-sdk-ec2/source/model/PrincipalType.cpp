@@ -30,40 +30,65 @@ namespace Aws
       namespace PrincipalTypeMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int Service_HASH = HashingUtils::HashString("Service");
-        static const int OrganizationUnit_HASH = HashingUtils::HashString("OrganizationUnit");
-        static const int Account_HASH = HashingUtils::HashString("Account");
-        static const int User_HASH = HashingUtils::HashString("User");
-        static const int Role_HASH = HashingUtils::HashString("Role");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "All",
+          "Service",
+          "OrganizationUnit",
+          "Account",
+          "User",
+          "Role",
+        };
 
         PrincipalType GetPrincipalTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
-          {
-            return PrincipalType::All;
-          }
-          else if (hashCode == Service_HASH)
-          {
-            return PrincipalType::Service;
-          }
-          else if (hashCode == OrganizationUnit_HASH)
-          {
-            return PrincipalType::OrganizationUnit;
-          }
-          else if (hashCode == Account_HASH)
-          {
-            return PrincipalType::Account;
-          }
-          else if (hashCode == User_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PrincipalType::User;
-          }
-          else if (hashCode == Role_HASH)
-          {
-            return PrincipalType::Role;
+          case 65921:
+            if (name == "All")
+            {
+              return PrincipalType::All;
+            }
+            break;
+          case -646160747:
+            if (name == "Service")
+            {
+              return PrincipalType::Service;
+            }
+            break;
+          case 1623305591:
+            if (name == "OrganizationUnit")
+            {
+              return PrincipalType::OrganizationUnit;
+            }
+            break;
+          case 487334413:
+            if (name == "Account")
+            {
+              return PrincipalType::Account;
+            }
+            break;
+          case 2645995:
+            if (name == "User")
+            {
+              return PrincipalType::User;
+            }
+            break;
+          case 2552982:
+            if (name == "Role")
+            {
+              return PrincipalType::Role;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return PrincipalType::NOT_SET;
         }
 
-        Aws::String GetNameForPrincipalType(PrincipalType enumValue)
+        const char* GetNameForPrincipalTypeCStr(PrincipalType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PrincipalType::All:
-            return "All";
-          case PrincipalType::Service:
-            return "Service";
-          case PrincipalType::OrganizationUnit:
-            return "OrganizationUnit";
-          case PrincipalType::Account:
-            return "Account";
-          case PrincipalType::User:
-            return "User";
-          case PrincipalType::Role:
-            return "Role";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPrincipalType(PrincipalType enumValue)
+        {
+          return GetNameForPrincipalTypeCStr(enumValue);
         }
 
       } // namespace PrincipalTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ProductCodeValuesMapper
       {
 
-        static const int devpay_HASH = HashingUtils::HashString("devpay");
-        static const int marketplace_HASH = HashingUtils::HashString("marketplace");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "devpay",
+          "marketplace",
+        };
 
         ProductCodeValues GetProductCodeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == devpay_HASH)
-          {
-            return ProductCodeValues::devpay;
-          }
-          else if (hashCode == marketplace_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProductCodeValues::marketplace;
+          case -1335150477:
+            if (name == "devpay")
+            {
+              return ProductCodeValues::devpay;
+            }
+            break;
+          case 300911179:
+            if (name == "marketplace")
+            {
+              return ProductCodeValues::marketplace;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ProductCodeValues::NOT_SET;
         }
 
-        Aws::String GetNameForProductCodeValues(ProductCodeValues enumValue)
+        const char* GetNameForProductCodeValuesCStr(ProductCodeValues enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProductCodeValues::devpay:
-            return "devpay";
-          case ProductCodeValues::marketplace:
-            return "marketplace";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProductCodeValues(ProductCodeValues enumValue)
+        {
+          return GetNameForProductCodeValuesCStr(enumValue);
         }
 
       } // namespace ProductCodeValuesMapper
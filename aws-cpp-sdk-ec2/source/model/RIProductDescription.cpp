@@ -30,30 +30,51 @@ namespace Aws
       namespace RIProductDescriptionMapper
       {
 
-        static const int Linux_UNIX_HASH = HashingUtils::HashString("Linux/UNIX");
-        static const int Linux_UNIX_Amazon_VPC_HASH = HashingUtils::HashString("Linux/UNIX (Amazon VPC)");
-        static const int Windows_HASH = HashingUtils::HashString("Windows");
-        static const int Windows_Amazon_VPC_HASH = HashingUtils::HashString("Windows (Amazon VPC)");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Linux/UNIX",
+          "Linux/UNIX (Amazon VPC)",
+          "Windows",
+          "Windows (Amazon VPC)",
+        };
 
         RIProductDescription GetRIProductDescriptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Linux_UNIX_HASH)
-          {
-            return RIProductDescription::Linux_UNIX;
-          }
-          else if (hashCode == Linux_UNIX_Amazon_VPC_HASH)
-          {
-            return RIProductDescription::Linux_UNIX_Amazon_VPC;
-          }
-          else if (hashCode == Windows_HASH)
-          {
-            return RIProductDescription::Windows;
-          }
-          else if (hashCode == Windows_Amazon_VPC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RIProductDescription::Windows_Amazon_VPC;
+          case -178444829:
+            if (name == "Linux/UNIX")
+            {
+              return RIProductDescription::Linux_UNIX;
+            }
+            break;
+          case -239375631:
+            if (name == "Linux/UNIX (Amazon VPC)")
+            {
+              return RIProductDescription::Linux_UNIX_Amazon_VPC;
+            }
+            break;
+          case -1280820637:
+            if (name == "Windows")
+            {
+              return RIProductDescription::Windows;
+            }
+            break;
+          case 1207281265:
+            if (name == "Windows (Amazon VPC)")
+            {
+              return RIProductDescription::Windows_Amazon_VPC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return RIProductDescription::NOT_SET;
         }
 
-        Aws::String GetNameForRIProductDescription(RIProductDescription enumValue)
+        const char* GetNameForRIProductDescriptionCStr(RIProductDescription enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RIProductDescription::Linux_UNIX:
-            return "Linux/UNIX";
-          case RIProductDescription::Linux_UNIX_Amazon_VPC:
-            return "Linux/UNIX (Amazon VPC)";
-          case RIProductDescription::Windows:
-            return "Windows";
-          case RIProductDescription::Windows_Amazon_VPC:
-            return "Windows (Amazon VPC)";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRIProductDescription(RIProductDescription enumValue)
+        {
+          return GetNameForRIProductDescriptionCStr(enumValue);
         }
 
       } // namespace RIProductDescriptionMapper
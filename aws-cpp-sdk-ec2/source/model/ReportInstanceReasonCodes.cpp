@@ -30,55 +30,86 @@ namespace Aws
       namespace ReportInstanceReasonCodesMapper
       {
 
-        static const int instance_stuck_in_state_HASH = HashingUtils::HashString("instance-stuck-in-state");
-        static const int unresponsive_HASH = HashingUtils::HashString("unresponsive");
-        static const int not_accepting_credentials_HASH = HashingUtils::HashString("not-accepting-credentials");
-        static const int password_not_available_HASH = HashingUtils::HashString("password-not-available");
-        static const int performance_network_HASH = HashingUtils::HashString("performance-network");
-        static const int performance_instance_store_HASH = HashingUtils::HashString("performance-instance-store");
-        static const int performance_ebs_volume_HASH = HashingUtils::HashString("performance-ebs-volume");
-        static const int performance_other_HASH = HashingUtils::HashString("performance-other");
-        static const int other_HASH = HashingUtils::HashString("other");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "instance-stuck-in-state",
+          "unresponsive",
+          "not-accepting-credentials",
+          "password-not-available",
+          "performance-network",
+          "performance-instance-store",
+          "performance-ebs-volume",
+          "performance-other",
+          "other",
+        };
 
         ReportInstanceReasonCodes GetReportInstanceReasonCodesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instance_stuck_in_state_HASH)
-          {
-            return ReportInstanceReasonCodes::instance_stuck_in_state;
-          }
-          else if (hashCode == unresponsive_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReportInstanceReasonCodes::unresponsive;
-          }
-          else if (hashCode == not_accepting_credentials_HASH)
-          {
-            return ReportInstanceReasonCodes::not_accepting_credentials;
-          }
-          else if (hashCode == password_not_available_HASH)
-          {
-            return ReportInstanceReasonCodes::password_not_available;
-          }
-          else if (hashCode == performance_network_HASH)
-          {
-            return ReportInstanceReasonCodes::performance_network;
-          }
-          else if (hashCode == performance_instance_store_HASH)
-          {
-            return ReportInstanceReasonCodes::performance_instance_store;
-          }
-          else if (hashCode == performance_ebs_volume_HASH)
-          {
-            return ReportInstanceReasonCodes::performance_ebs_volume;
-          }
-          else if (hashCode == performance_other_HASH)
-          {
-            return ReportInstanceReasonCodes::performance_other;
-          }
-          else if (hashCode == other_HASH)
-          {
-            return ReportInstanceReasonCodes::other;
+          case -1327466702:
+            if (name == "instance-stuck-in-state")
+            {
+              return ReportInstanceReasonCodes::instance_stuck_in_state;
+            }
+            break;
+          case 1488488717:
+            if (name == "unresponsive")
+            {
+              return ReportInstanceReasonCodes::unresponsive;
+            }
+            break;
+          case -1874465777:
+            if (name == "not-accepting-credentials")
+            {
+              return ReportInstanceReasonCodes::not_accepting_credentials;
+            }
+            break;
+          case -1158615907:
+            if (name == "password-not-available")
+            {
+              return ReportInstanceReasonCodes::password_not_available;
+            }
+            break;
+          case -117564015:
+            if (name == "performance-network")
+            {
+              return ReportInstanceReasonCodes::performance_network;
+            }
+            break;
+          case 1590908134:
+            if (name == "performance-instance-store")
+            {
+              return ReportInstanceReasonCodes::performance_instance_store;
+            }
+            break;
+          case -1851001074:
+            if (name == "performance-ebs-volume")
+            {
+              return ReportInstanceReasonCodes::performance_ebs_volume;
+            }
+            break;
+          case 729726771:
+            if (name == "performance-other")
+            {
+              return ReportInstanceReasonCodes::performance_other;
+            }
+            break;
+          case 106069776:
+            if (name == "other")
+            {
+              return ReportInstanceReasonCodes::other;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return ReportInstanceReasonCodes::NOT_SET;
         }
 
-        Aws::String GetNameForReportInstanceReasonCodes(ReportInstanceReasonCodes enumValue)
+        const char* GetNameForReportInstanceReasonCodesCStr(ReportInstanceReasonCodes enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReportInstanceReasonCodes::instance_stuck_in_state:
-            return "instance-stuck-in-state";
-          case ReportInstanceReasonCodes::unresponsive:
-            return "unresponsive";
-          case ReportInstanceReasonCodes::not_accepting_credentials:
-            return "not-accepting-credentials";
-          case ReportInstanceReasonCodes::password_not_available:
-            return "password-not-available";
-          case ReportInstanceReasonCodes::performance_network:
-            return "performance-network";
-          case ReportInstanceReasonCodes::performance_instance_store:
-            return "performance-instance-store";
-          case ReportInstanceReasonCodes::performance_ebs_volume:
-            return "performance-ebs-volume";
-          case ReportInstanceReasonCodes::performance_other:
-            return "performance-other";
-          case ReportInstanceReasonCodes::other:
-            return "other";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReportInstanceReasonCodes(ReportInstanceReasonCodes enumValue)
+        {
+          return GetNameForReportInstanceReasonCodesCStr(enumValue);
         }
 
       } // namespace ReportInstanceReasonCodesMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ReportStatusTypeMapper
       {
 
-        static const int ok_HASH = HashingUtils::HashString("ok");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ok",
+          "impaired",
+        };
 
         ReportStatusType GetReportStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ok_HASH)
-          {
-            return ReportStatusType::ok;
-          }
-          else if (hashCode == impaired_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReportStatusType::impaired;
+          case 3548:
+            if (name == "ok")
+            {
+              return ReportStatusType::ok;
+            }
+            break;
+          case -435567843:
+            if (name == "impaired")
+            {
+              return ReportStatusType::impaired;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReportStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForReportStatusType(ReportStatusType enumValue)
+        const char* GetNameForReportStatusTypeCStr(ReportStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReportStatusType::ok:
-            return "ok";
-          case ReportStatusType::impaired:
-            return "impaired";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReportStatusType(ReportStatusType enumValue)
+        {
+          return GetNameForReportStatusTypeCStr(enumValue);
         }
 
       } // namespace ReportStatusTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ReservedInstanceStateMapper
       {
 
-        static const int payment_pending_HASH = HashingUtils::HashString("payment-pending");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int payment_failed_HASH = HashingUtils::HashString("payment-failed");
-        static const int retired_HASH = HashingUtils::HashString("retired");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "payment-pending",
+          "active",
+          "payment-failed",
+          "retired",
+        };
 
         ReservedInstanceState GetReservedInstanceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == payment_pending_HASH)
-          {
-            return ReservedInstanceState::payment_pending;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return ReservedInstanceState::active;
-          }
-          else if (hashCode == payment_failed_HASH)
-          {
-            return ReservedInstanceState::payment_failed;
-          }
-          else if (hashCode == retired_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReservedInstanceState::retired;
+          case -431343408:
+            if (name == "payment-pending")
+            {
+              return ReservedInstanceState::payment_pending;
+            }
+            break;
+          case -1422950650:
+            if (name == "active")
+            {
+              return ReservedInstanceState::active;
+            }
+            break;
+          case 1635621348:
+            if (name == "payment-failed")
+            {
+              return ReservedInstanceState::payment_failed;
+            }
+            break;
+          case 1098118057:
+            if (name == "retired")
+            {
+              return ReservedInstanceState::retired;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ReservedInstanceState::NOT_SET;
         }
 
-        Aws::String GetNameForReservedInstanceState(ReservedInstanceState enumValue)
+        const char* GetNameForReservedInstanceStateCStr(ReservedInstanceState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReservedInstanceState::payment_pending:
-            return "payment-pending";
-          case ReservedInstanceState::active:
-            return "active";
-          case ReservedInstanceState::payment_failed:
-            return "payment-failed";
-          case ReservedInstanceState::retired:
-            return "retired";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReservedInstanceState(ReservedInstanceState enumValue)
+        {
+          return GetNameForReservedInstanceStateCStr(enumValue);
         }
 
       } // namespace ReservedInstanceStateMapper
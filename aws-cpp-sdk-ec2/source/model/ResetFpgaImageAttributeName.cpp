@@ -30,15 +30,30 @@ namespace Aws
       namespace ResetFpgaImageAttributeNameMapper
       {
 
-        static const int loadPermission_HASH = HashingUtils::HashString("loadPermission");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "loadPermission",
+        };
 
         ResetFpgaImageAttributeName GetResetFpgaImageAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == loadPermission_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResetFpgaImageAttributeName::loadPermission;
+          case 536739669:
+            if (name == "loadPermission")
+            {
+              return ResetFpgaImageAttributeName::loadPermission;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ResetFpgaImageAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForResetFpgaImageAttributeName(ResetFpgaImageAttributeName enumValue)
+        const char* GetNameForResetFpgaImageAttributeNameCStr(ResetFpgaImageAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResetFpgaImageAttributeName::loadPermission:
-            return "loadPermission";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResetFpgaImageAttributeName(ResetFpgaImageAttributeName enumValue)
+        {
+          return GetNameForResetFpgaImageAttributeNameCStr(enumValue);
         }
 
       } // namespace ResetFpgaImageAttributeNameMapper
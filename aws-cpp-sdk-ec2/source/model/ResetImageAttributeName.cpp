@@ -30,15 +30,30 @@ namespace Aws
       namespace ResetImageAttributeNameMapper
       {
 
-        static const int launchPermission_HASH = HashingUtils::HashString("launchPermission");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "launchPermission",
+        };
 
         ResetImageAttributeName GetResetImageAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == launchPermission_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResetImageAttributeName::launchPermission;
+          case -1159069214:
+            if (name == "launchPermission")
+            {
+              return ResetImageAttributeName::launchPermission;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ResetImageAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForResetImageAttributeName(ResetImageAttributeName enumValue)
+        const char* GetNameForResetImageAttributeNameCStr(ResetImageAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResetImageAttributeName::launchPermission:
-            return "launchPermission";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResetImageAttributeName(ResetImageAttributeName enumValue)
+        {
+          return GetNameForResetImageAttributeNameCStr(enumValue);
         }
 
       } // namespace ResetImageAttributeNameMapper
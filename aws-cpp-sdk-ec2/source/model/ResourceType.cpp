@@ -30,145 +30,212 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int customer_gateway_HASH = HashingUtils::HashString("customer-gateway");
-        static const int dedicated_host_HASH = HashingUtils::HashString("dedicated-host");
-        static const int dhcp_options_HASH = HashingUtils::HashString("dhcp-options");
-        static const int elastic_ip_HASH = HashingUtils::HashString("elastic-ip");
-        static const int fleet_HASH = HashingUtils::HashString("fleet");
-        static const int fpga_image_HASH = HashingUtils::HashString("fpga-image");
-        static const int image_HASH = HashingUtils::HashString("image");
-        static const int instance_HASH = HashingUtils::HashString("instance");
-        static const int internet_gateway_HASH = HashingUtils::HashString("internet-gateway");
-        static const int launch_template_HASH = HashingUtils::HashString("launch-template");
-        static const int natgateway_HASH = HashingUtils::HashString("natgateway");
-        static const int network_acl_HASH = HashingUtils::HashString("network-acl");
-        static const int network_interface_HASH = HashingUtils::HashString("network-interface");
-        static const int reserved_instances_HASH = HashingUtils::HashString("reserved-instances");
-        static const int route_table_HASH = HashingUtils::HashString("route-table");
-        static const int security_group_HASH = HashingUtils::HashString("security-group");
-        static const int snapshot_HASH = HashingUtils::HashString("snapshot");
-        static const int spot_instances_request_HASH = HashingUtils::HashString("spot-instances-request");
-        static const int subnet_HASH = HashingUtils::HashString("subnet");
-        static const int transit_gateway_HASH = HashingUtils::HashString("transit-gateway");
-        static const int transit_gateway_attachment_HASH = HashingUtils::HashString("transit-gateway-attachment");
-        static const int transit_gateway_route_table_HASH = HashingUtils::HashString("transit-gateway-route-table");
-        static const int volume_HASH = HashingUtils::HashString("volume");
-        static const int vpc_HASH = HashingUtils::HashString("vpc");
-        static const int vpc_peering_connection_HASH = HashingUtils::HashString("vpc-peering-connection");
-        static const int vpn_connection_HASH = HashingUtils::HashString("vpn-connection");
-        static const int vpn_gateway_HASH = HashingUtils::HashString("vpn-gateway");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "customer-gateway",
+          "dedicated-host",
+          "dhcp-options",
+          "elastic-ip",
+          "fleet",
+          "fpga-image",
+          "image",
+          "instance",
+          "internet-gateway",
+          "launch-template",
+          "natgateway",
+          "network-acl",
+          "network-interface",
+          "reserved-instances",
+          "route-table",
+          "security-group",
+          "snapshot",
+          "spot-instances-request",
+          "subnet",
+          "transit-gateway",
+          "transit-gateway-attachment",
+          "transit-gateway-route-table",
+          "volume",
+          "vpc",
+          "vpc-peering-connection",
+          "vpn-connection",
+          "vpn-gateway",
+        };
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == customer_gateway_HASH)
-          {
-            return ResourceType::customer_gateway;
-          }
-          else if (hashCode == dedicated_host_HASH)
-          {
-            return ResourceType::dedicated_host;
-          }
-          else if (hashCode == dhcp_options_HASH)
-          {
-            return ResourceType::dhcp_options;
-          }
-          else if (hashCode == elastic_ip_HASH)
-          {
-            return ResourceType::elastic_ip;
-          }
-          else if (hashCode == fleet_HASH)
-          {
-            return ResourceType::fleet;
-          }
-          else if (hashCode == fpga_image_HASH)
-          {
-            return ResourceType::fpga_image;
-          }
-          else if (hashCode == image_HASH)
-          {
-            return ResourceType::image;
-          }
-          else if (hashCode == instance_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceType::instance;
-          }
-          else if (hashCode == internet_gateway_HASH)
-          {
-            return ResourceType::internet_gateway;
-          }
-          else if (hashCode == launch_template_HASH)
-          {
-            return ResourceType::launch_template;
-          }
-          else if (hashCode == natgateway_HASH)
-          {
-            return ResourceType::natgateway;
-          }
-          else if (hashCode == network_acl_HASH)
-          {
-            return ResourceType::network_acl;
-          }
-          else if (hashCode == network_interface_HASH)
-          {
-            return ResourceType::network_interface;
-          }
-          else if (hashCode == reserved_instances_HASH)
-          {
-            return ResourceType::reserved_instances;
-          }
-          else if (hashCode == route_table_HASH)
-          {
-            return ResourceType::route_table;
-          }
-          else if (hashCode == security_group_HASH)
-          {
-            return ResourceType::security_group;
-          }
-          else if (hashCode == snapshot_HASH)
-          {
-            return ResourceType::snapshot;
-          }
-          else if (hashCode == spot_instances_request_HASH)
-          {
-            return ResourceType::spot_instances_request;
-          }
-          else if (hashCode == subnet_HASH)
-          {
-            return ResourceType::subnet;
-          }
-          else if (hashCode == transit_gateway_HASH)
-          {
-            return ResourceType::transit_gateway;
-          }
-          else if (hashCode == transit_gateway_attachment_HASH)
-          {
-            return ResourceType::transit_gateway_attachment;
-          }
-          else if (hashCode == transit_gateway_route_table_HASH)
-          {
-            return ResourceType::transit_gateway_route_table;
-          }
-          else if (hashCode == volume_HASH)
-          {
-            return ResourceType::volume;
-          }
-          else if (hashCode == vpc_HASH)
-          {
-            return ResourceType::vpc;
-          }
-          else if (hashCode == vpc_peering_connection_HASH)
-          {
-            return ResourceType::vpc_peering_connection;
-          }
-          else if (hashCode == vpn_connection_HASH)
-          {
-            return ResourceType::vpn_connection;
-          }
-          else if (hashCode == vpn_gateway_HASH)
-          {
-            return ResourceType::vpn_gateway;
+          case 819587925:
+            if (name == "customer-gateway")
+            {
+              return ResourceType::customer_gateway;
+            }
+            break;
+          case -1408731450:
+            if (name == "dedicated-host")
+            {
+              return ResourceType::dedicated_host;
+            }
+            break;
+          case -859836222:
+            if (name == "dhcp-options")
+            {
+              return ResourceType::dhcp_options;
+            }
+            break;
+          case -646015201:
+            if (name == "elastic-ip")
+            {
+              return ResourceType::elastic_ip;
+            }
+            break;
+          case 97516878:
+            if (name == "fleet")
+            {
+              return ResourceType::fleet;
+            }
+            break;
+          case 1556996466:
+            if (name == "fpga-image")
+            {
+              return ResourceType::fpga_image;
+            }
+            break;
+          case 100313435:
+            if (name == "image")
+            {
+              return ResourceType::image;
+            }
+            break;
+          case 555127957:
+            if (name == "instance")
+            {
+              return ResourceType::instance;
+            }
+            break;
+          case -1040703560:
+            if (name == "internet-gateway")
+            {
+              return ResourceType::internet_gateway;
+            }
+            break;
+          case 1633330516:
+            if (name == "launch-template")
+            {
+              return ResourceType::launch_template;
+            }
+            break;
+          case 742344195:
+            if (name == "natgateway")
+            {
+              return ResourceType::natgateway;
+            }
+            break;
+          case -1941798805:
+            if (name == "network-acl")
+            {
+              return ResourceType::network_acl;
+            }
+            break;
+          case 2137999450:
+            if (name == "network-interface")
+            {
+              return ResourceType::network_interface;
+            }
+            break;
+          case -833840615:
+            if (name == "reserved-instances")
+            {
+              return ResourceType::reserved_instances;
+            }
+            break;
+          case 1093560138:
+            if (name == "route-table")
+            {
+              return ResourceType::route_table;
+            }
+            break;
+          case -1797844558:
+            if (name == "security-group")
+            {
+              return ResourceType::security_group;
+            }
+            break;
+          case 284874180:
+            if (name == "snapshot")
+            {
+              return ResourceType::snapshot;
+            }
+            break;
+          case -1720470987:
+            if (name == "spot-instances-request")
+            {
+              return ResourceType::spot_instances_request;
+            }
+            break;
+          case -891534499:
+            if (name == "subnet")
+            {
+              return ResourceType::subnet;
+            }
+            break;
+          case 1968675914:
+            if (name == "transit-gateway")
+            {
+              return ResourceType::transit_gateway;
+            }
+            break;
+          case -812419450:
+            if (name == "transit-gateway-attachment")
+            {
+              return ResourceType::transit_gateway_attachment;
+            }
+            break;
+          case -1877608889:
+            if (name == "transit-gateway-route-table")
+            {
+              return ResourceType::transit_gateway_route_table;
+            }
+            break;
+          case -810883302:
+            if (name == "volume")
+            {
+              return ResourceType::volume;
+            }
+            break;
+          case 116969:
+            if (name == "vpc")
+            {
+              return ResourceType::vpc;
+            }
+            break;
+          case 1256706799:
+            if (name == "vpc-peering-connection")
+            {
+              return ResourceType::vpc_peering_connection;
+            }
+            break;
+          case -1042628265:
+            if (name == "vpn-connection")
+            {
+              return ResourceType::vpn_connection;
+            }
+            break;
+          case 1849867883:
+            if (name == "vpn-gateway")
+            {
+              return ResourceType::vpn_gateway;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -180,73 +247,26 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceTypeCStr(ResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceType::customer_gateway:
-            return "customer-gateway";
-          case ResourceType::dedicated_host:
-            return "dedicated-host";
-          case ResourceType::dhcp_options:
-            return "dhcp-options";
-          case ResourceType::elastic_ip:
-            return "elastic-ip";
-          case ResourceType::fleet:
-            return "fleet";
-          case ResourceType::fpga_image:
-            return "fpga-image";
-          case ResourceType::image:
-            return "image";
-          case ResourceType::instance:
-            return "instance";
-          case ResourceType::internet_gateway:
-            return "internet-gateway";
-          case ResourceType::launch_template:
-            return "launch-template";
-          case ResourceType::natgateway:
-            return "natgateway";
-          case ResourceType::network_acl:
-            return "network-acl";
-          case ResourceType::network_interface:
-            return "network-interface";
-          case ResourceType::reserved_instances:
-            return "reserved-instances";
-          case ResourceType::route_table:
-            return "route-table";
-          case ResourceType::security_group:
-            return "security-group";
-          case ResourceType::snapshot:
-            return "snapshot";
-          case ResourceType::spot_instances_request:
-            return "spot-instances-request";
-          case ResourceType::subnet:
-            return "subnet";
-          case ResourceType::transit_gateway:
-            return "transit-gateway";
-          case ResourceType::transit_gateway_attachment:
-            return "transit-gateway-attachment";
-          case ResourceType::transit_gateway_route_table:
-            return "transit-gateway-route-table";
-          case ResourceType::volume:
-            return "volume";
-          case ResourceType::vpc:
-            return "vpc";
-          case ResourceType::vpc_peering_connection:
-            return "vpc-peering-connection";
-          case ResourceType::vpn_connection:
-            return "vpn-connection";
-          case ResourceType::vpn_gateway:
-            return "vpn-gateway";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceType(ResourceType enumValue)
+        {
+          return GetNameForResourceTypeCStr(enumValue);
         }
 
       } // namespace ResourceTypeMapper
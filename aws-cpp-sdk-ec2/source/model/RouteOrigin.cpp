@@ -30,25 +30,44 @@ namespace Aws
       namespace RouteOriginMapper
       {
 
-        static const int CreateRouteTable_HASH = HashingUtils::HashString("CreateRouteTable");
-        static const int CreateRoute_HASH = HashingUtils::HashString("CreateRoute");
-        static const int EnableVgwRoutePropagation_HASH = HashingUtils::HashString("EnableVgwRoutePropagation");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CreateRouteTable",
+          "CreateRoute",
+          "EnableVgwRoutePropagation",
+        };
 
         RouteOrigin GetRouteOriginForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreateRouteTable_HASH)
-          {
-            return RouteOrigin::CreateRouteTable;
-          }
-          else if (hashCode == CreateRoute_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RouteOrigin::CreateRoute;
-          }
-          else if (hashCode == EnableVgwRoutePropagation_HASH)
-          {
-            return RouteOrigin::EnableVgwRoutePropagation;
+          case 1884771649:
+            if (name == "CreateRouteTable")
+            {
+              return RouteOrigin::CreateRouteTable;
+            }
+            break;
+          case 1162151565:
+            if (name == "CreateRoute")
+            {
+              return RouteOrigin::CreateRoute;
+            }
+            break;
+          case 1082794278:
+            if (name == "EnableVgwRoutePropagation")
+            {
+              return RouteOrigin::EnableVgwRoutePropagation;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RouteOrigin::NOT_SET;
         }
 
-        Aws::String GetNameForRouteOrigin(RouteOrigin enumValue)
+        const char* GetNameForRouteOriginCStr(RouteOrigin enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RouteOrigin::CreateRouteTable:
-            return "CreateRouteTable";
-          case RouteOrigin::CreateRoute:
-            return "CreateRoute";
-          case RouteOrigin::EnableVgwRoutePropagation:
-            return "EnableVgwRoutePropagation";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRouteOrigin(RouteOrigin enumValue)
+        {
+          return GetNameForRouteOriginCStr(enumValue);
         }
 
       } // namespace RouteOriginMapper
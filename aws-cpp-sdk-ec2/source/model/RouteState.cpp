@@ -30,20 +30,37 @@ namespace Aws
       namespace RouteStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int blackhole_HASH = HashingUtils::HashString("blackhole");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "active",
+          "blackhole",
+        };
 
         RouteState GetRouteStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
-          {
-            return RouteState::active;
-          }
-          else if (hashCode == blackhole_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RouteState::blackhole;
+          case -1422950650:
+            if (name == "active")
+            {
+              return RouteState::active;
+            }
+            break;
+          case 1332899135:
+            if (name == "blackhole")
+            {
+              return RouteState::blackhole;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RouteState::NOT_SET;
         }
 
-        Aws::String GetNameForRouteState(RouteState enumValue)
+        const char* GetNameForRouteStateCStr(RouteState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RouteState::active:
-            return "active";
-          case RouteState::blackhole:
-            return "blackhole";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRouteState(RouteState enumValue)
+        {
+          return GetNameForRouteStateCStr(enumValue);
         }
 
       } // namespace RouteStateMapper
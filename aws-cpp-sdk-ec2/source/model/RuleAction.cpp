@@ -30,20 +30,37 @@ namespace Aws
       namespace RuleActionMapper
       {
 
-        static const int allow_HASH = HashingUtils::HashString("allow");
-        static const int deny_HASH = HashingUtils::HashString("deny");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "allow",
+          "deny",
+        };
 
         RuleAction GetRuleActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == allow_HASH)
-          {
-            return RuleAction::allow;
-          }
-          else if (hashCode == deny_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RuleAction::deny;
+          case 92906313:
+            if (name == "allow")
+            {
+              return RuleAction::allow;
+            }
+            break;
+          case 3079692:
+            if (name == "deny")
+            {
+              return RuleAction::deny;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RuleAction::NOT_SET;
         }
 
-        Aws::String GetNameForRuleAction(RuleAction enumValue)
+        const char* GetNameForRuleActionCStr(RuleAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RuleAction::allow:
-            return "allow";
-          case RuleAction::deny:
-            return "deny";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRuleAction(RuleAction enumValue)
+        {
+          return GetNameForRuleActionCStr(enumValue);
         }
 
       } // namespace RuleActionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ScopeMapper
       {
 
-        static const int Availability_Zone_HASH = HashingUtils::HashString("Availability Zone");
-        static const int Region_HASH = HashingUtils::HashString("Region");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Availability Zone",
+          "Region",
+        };
 
         Scope GetScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Availability_Zone_HASH)
-          {
-            return Scope::Availability_Zone;
-          }
-          else if (hashCode == Region_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Scope::Region;
+          case -793783471:
+            if (name == "Availability Zone")
+            {
+              return Scope::Availability_Zone;
+            }
+            break;
+          case -1850928364:
+            if (name == "Region")
+            {
+              return Scope::Region;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Scope::NOT_SET;
         }
 
-        Aws::String GetNameForScope(Scope enumValue)
+        const char* GetNameForScopeCStr(Scope enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Scope::Availability_Zone:
-            return "Availability Zone";
-          case Scope::Region:
-            return "Region";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScope(Scope enumValue)
+        {
+          return GetNameForScopeCStr(enumValue);
         }
 
       } // namespace ScopeMapper
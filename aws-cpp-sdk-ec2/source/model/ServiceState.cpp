@@ -30,35 +30,58 @@ namespace Aws
       namespace ServiceStateMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Available_HASH = HashingUtils::HashString("Available");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "Available",
+          "Deleting",
+          "Deleted",
+          "Failed",
+        };
 
         ServiceState GetServiceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServiceState::Pending;
-          }
-          else if (hashCode == Available_HASH)
-          {
-            return ServiceState::Available;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return ServiceState::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return ServiceState::Deleted;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ServiceState::Failed;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return ServiceState::Pending;
+            }
+            break;
+          case 1270065833:
+            if (name == "Available")
+            {
+              return ServiceState::Available;
+            }
+            break;
+          case 884361160:
+            if (name == "Deleting")
+            {
+              return ServiceState::Deleting;
+            }
+            break;
+          case -1079851015:
+            if (name == "Deleted")
+            {
+              return ServiceState::Deleted;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return ServiceState::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ServiceState::NOT_SET;
         }
 
-        Aws::String GetNameForServiceState(ServiceState enumValue)
+        const char* GetNameForServiceStateCStr(ServiceState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServiceState::Pending:
-            return "Pending";
-          case ServiceState::Available:
-            return "Available";
-          case ServiceState::Deleting:
-            return "Deleting";
-          case ServiceState::Deleted:
-            return "Deleted";
-          case ServiceState::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServiceState(ServiceState enumValue)
+        {
+          return GetNameForServiceStateCStr(enumValue);
         }
 
       } // namespace ServiceStateMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ServiceTypeMapper
       {
 
-        static const int Interface_HASH = HashingUtils::HashString("Interface");
-        static const int Gateway_HASH = HashingUtils::HashString("Gateway");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Interface",
+          "Gateway",
+        };
 
         ServiceType GetServiceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Interface_HASH)
-          {
-            return ServiceType::Interface;
-          }
-          else if (hashCode == Gateway_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServiceType::Gateway;
+          case -1788375783:
+            if (name == "Interface")
+            {
+              return ServiceType::Interface;
+            }
+            break;
+          case 1475534372:
+            if (name == "Gateway")
+            {
+              return ServiceType::Gateway;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ServiceType::NOT_SET;
         }
 
-        Aws::String GetNameForServiceType(ServiceType enumValue)
+        const char* GetNameForServiceTypeCStr(ServiceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServiceType::Interface:
-            return "Interface";
-          case ServiceType::Gateway:
-            return "Gateway";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServiceType(ServiceType enumValue)
+        {
+          return GetNameForServiceTypeCStr(enumValue);
         }
 
       } // namespace ServiceTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ShutdownBehaviorMapper
       {
 
-        static const int stop_HASH = HashingUtils::HashString("stop");
-        static const int terminate_HASH = HashingUtils::HashString("terminate");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "stop",
+          "terminate",
+        };
 
         ShutdownBehavior GetShutdownBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == stop_HASH)
-          {
-            return ShutdownBehavior::stop;
-          }
-          else if (hashCode == terminate_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ShutdownBehavior::terminate;
+          case 3540994:
+            if (name == "stop")
+            {
+              return ShutdownBehavior::stop;
+            }
+            break;
+          case 2035990113:
+            if (name == "terminate")
+            {
+              return ShutdownBehavior::terminate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ShutdownBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForShutdownBehavior(ShutdownBehavior enumValue)
+        const char* GetNameForShutdownBehaviorCStr(ShutdownBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ShutdownBehavior::stop:
-            return "stop";
-          case ShutdownBehavior::terminate:
-            return "terminate";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForShutdownBehavior(ShutdownBehavior enumValue)
+        {
+          return GetNameForShutdownBehaviorCStr(enumValue);
         }
 
       } // namespace ShutdownBehaviorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SnapshotAttributeNameMapper
       {
 
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
-        static const int createVolumePermission_HASH = HashingUtils::HashString("createVolumePermission");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "productCodes",
+          "createVolumePermission",
+        };
 
         SnapshotAttributeName GetSnapshotAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == productCodes_HASH)
-          {
-            return SnapshotAttributeName::productCodes;
-          }
-          else if (hashCode == createVolumePermission_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SnapshotAttributeName::createVolumePermission;
+          case 988549239:
+            if (name == "productCodes")
+            {
+              return SnapshotAttributeName::productCodes;
+            }
+            break;
+          case 1019764133:
+            if (name == "createVolumePermission")
+            {
+              return SnapshotAttributeName::createVolumePermission;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SnapshotAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForSnapshotAttributeName(SnapshotAttributeName enumValue)
+        const char* GetNameForSnapshotAttributeNameCStr(SnapshotAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SnapshotAttributeName::productCodes:
-            return "productCodes";
-          case SnapshotAttributeName::createVolumePermission:
-            return "createVolumePermission";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSnapshotAttributeName(SnapshotAttributeName enumValue)
+        {
+          return GetNameForSnapshotAttributeNameCStr(enumValue);
         }
 
       } // namespace SnapshotAttributeNameMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace SnapshotStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int completed_HASH = HashingUtils::HashString("completed");
-        static const int error_HASH = HashingUtils::HashString("error");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "completed",
+          "error",
+        };
 
         SnapshotState GetSnapshotStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return SnapshotState::pending;
-          }
-          else if (hashCode == completed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SnapshotState::completed;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return SnapshotState::error;
+          case -682587753:
+            if (name == "pending")
+            {
+              return SnapshotState::pending;
+            }
+            break;
+          case -1402931637:
+            if (name == "completed")
+            {
+              return SnapshotState::completed;
+            }
+            break;
+          case 96784904:
+            if (name == "error")
+            {
+              return SnapshotState::error;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SnapshotState::NOT_SET;
         }
 
-        Aws::String GetNameForSnapshotState(SnapshotState enumValue)
+        const char* GetNameForSnapshotStateCStr(SnapshotState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SnapshotState::pending:
-            return "pending";
-          case SnapshotState::completed:
-            return "completed";
-          case SnapshotState::error:
-            return "error";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSnapshotState(SnapshotState enumValue)
+        {
+          return GetNameForSnapshotStateCStr(enumValue);
         }
 
       } // namespace SnapshotStateMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SpotAllocationStrategyMapper
       {
 
-        static const int lowest_price_HASH = HashingUtils::HashString("lowest-price");
-        static const int diversified_HASH = HashingUtils::HashString("diversified");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "lowest-price",
+          "diversified",
+        };
 
         SpotAllocationStrategy GetSpotAllocationStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == lowest_price_HASH)
-          {
-            return SpotAllocationStrategy::lowest_price;
-          }
-          else if (hashCode == diversified_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SpotAllocationStrategy::diversified;
+          case -790467218:
+            if (name == "lowest-price")
+            {
+              return SpotAllocationStrategy::lowest_price;
+            }
+            break;
+          case 127033974:
+            if (name == "diversified")
+            {
+              return SpotAllocationStrategy::diversified;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SpotAllocationStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForSpotAllocationStrategy(SpotAllocationStrategy enumValue)
+        const char* GetNameForSpotAllocationStrategyCStr(SpotAllocationStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SpotAllocationStrategy::lowest_price:
-            return "lowest-price";
-          case SpotAllocationStrategy::diversified:
-            return "diversified";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSpotAllocationStrategy(SpotAllocationStrategy enumValue)
+        {
+          return GetNameForSpotAllocationStrategyCStr(enumValue);
         }
 
       } // namespace SpotAllocationStrategyMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace SpotInstanceInterruptionBehaviorMapper
       {
 
-        static const int hibernate_HASH = HashingUtils::HashString("hibernate");
-        static const int stop_HASH = HashingUtils::HashString("stop");
-        static const int terminate_HASH = HashingUtils::HashString("terminate");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "hibernate",
+          "stop",
+          "terminate",
+        };
 
         SpotInstanceInterruptionBehavior GetSpotInstanceInterruptionBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == hibernate_HASH)
-          {
-            return SpotInstanceInterruptionBehavior::hibernate;
-          }
-          else if (hashCode == stop_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SpotInstanceInterruptionBehavior::stop;
-          }
-          else if (hashCode == terminate_HASH)
-          {
-            return SpotInstanceInterruptionBehavior::terminate;
+          case -903964590:
+            if (name == "hibernate")
+            {
+              return SpotInstanceInterruptionBehavior::hibernate;
+            }
+            break;
+          case 3540994:
+            if (name == "stop")
+            {
+              return SpotInstanceInterruptionBehavior::stop;
+            }
+            break;
+          case 2035990113:
+            if (name == "terminate")
+            {
+              return SpotInstanceInterruptionBehavior::terminate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SpotInstanceInterruptionBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForSpotInstanceInterruptionBehavior(SpotInstanceInterruptionBehavior enumValue)
+        const char* GetNameForSpotInstanceInterruptionBehaviorCStr(SpotInstanceInterruptionBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SpotInstanceInterruptionBehavior::hibernate:
-            return "hibernate";
-          case SpotInstanceInterruptionBehavior::stop:
-            return "stop";
-          case SpotInstanceInterruptionBehavior::terminate:
-            return "terminate";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSpotInstanceInterruptionBehavior(SpotInstanceInterruptionBehavior enumValue)
+        {
+          return GetNameForSpotInstanceInterruptionBehaviorCStr(enumValue);
         }
 
       } // namespace SpotInstanceInterruptionBehaviorMapper
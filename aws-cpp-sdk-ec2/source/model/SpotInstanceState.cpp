@@ -30,40 +30,65 @@ namespace Aws
       namespace SpotInstanceStateMapper
       {
 
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int closed_HASH = HashingUtils::HashString("closed");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "open",
+          "active",
+          "closed",
+          "cancelled",
+          "failed",
+          "disabled",
+        };
 
         SpotInstanceState GetSpotInstanceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == open_HASH)
-          {
-            return SpotInstanceState::open;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return SpotInstanceState::active;
-          }
-          else if (hashCode == closed_HASH)
-          {
-            return SpotInstanceState::closed;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return SpotInstanceState::cancelled;
-          }
-          else if (hashCode == failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SpotInstanceState::failed;
-          }
-          else if (hashCode == disabled_HASH)
-          {
-            return SpotInstanceState::disabled;
+          case 3417674:
+            if (name == "open")
+            {
+              return SpotInstanceState::open;
+            }
+            break;
+          case -1422950650:
+            if (name == "active")
+            {
+              return SpotInstanceState::active;
+            }
+            break;
+          case -1357520532:
+            if (name == "closed")
+            {
+              return SpotInstanceState::closed;
+            }
+            break;
+          case 476588369:
+            if (name == "cancelled")
+            {
+              return SpotInstanceState::cancelled;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return SpotInstanceState::failed;
+            }
+            break;
+          case 270940796:
+            if (name == "disabled")
+            {
+              return SpotInstanceState::disabled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return SpotInstanceState::NOT_SET;
         }
 
-        Aws::String GetNameForSpotInstanceState(SpotInstanceState enumValue)
+        const char* GetNameForSpotInstanceStateCStr(SpotInstanceState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SpotInstanceState::open:
-            return "open";
-          case SpotInstanceState::active:
-            return "active";
-          case SpotInstanceState::closed:
-            return "closed";
-          case SpotInstanceState::cancelled:
-            return "cancelled";
-          case SpotInstanceState::failed:
-            return "failed";
-          case SpotInstanceState::disabled:
-            return "disabled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSpotInstanceState(SpotInstanceState enumValue)
+        {
+          return GetNameForSpotInstanceStateCStr(enumValue);
         }
 
       } // namespace SpotInstanceStateMapper
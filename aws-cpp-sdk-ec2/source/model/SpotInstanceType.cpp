@@ -30,20 +30,37 @@ namespace Aws
       namespace SpotInstanceTypeMapper
       {
 
-        static const int one_time_HASH = HashingUtils::HashString("one-time");
-        static const int persistent_HASH = HashingUtils::HashString("persistent");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "one-time",
+          "persistent",
+        };
 
         SpotInstanceType GetSpotInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == one_time_HASH)
-          {
-            return SpotInstanceType::one_time;
-          }
-          else if (hashCode == persistent_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SpotInstanceType::persistent;
+          case 1956238804:
+            if (name == "one-time")
+            {
+              return SpotInstanceType::one_time;
+            }
+            break;
+          case 512462487:
+            if (name == "persistent")
+            {
+              return SpotInstanceType::persistent;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SpotInstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForSpotInstanceType(SpotInstanceType enumValue)
+        const char* GetNameForSpotInstanceTypeCStr(SpotInstanceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SpotInstanceType::one_time:
-            return "one-time";
-          case SpotInstanceType::persistent:
-            return "persistent";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSpotInstanceType(SpotInstanceType enumValue)
+        {
+          return GetNameForSpotInstanceTypeCStr(enumValue);
         }
 
       } // namespace SpotInstanceTypeMapper
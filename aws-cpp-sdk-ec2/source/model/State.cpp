@@ -30,50 +30,79 @@ namespace Aws
       namespace StateMapper
       {
 
-        static const int PendingAcceptance_HASH = HashingUtils::HashString("PendingAcceptance");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Available_HASH = HashingUtils::HashString("Available");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Rejected_HASH = HashingUtils::HashString("Rejected");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Expired_HASH = HashingUtils::HashString("Expired");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PendingAcceptance",
+          "Pending",
+          "Available",
+          "Deleting",
+          "Deleted",
+          "Rejected",
+          "Failed",
+          "Expired",
+        };
 
         State GetStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PendingAcceptance_HASH)
-          {
-            return State::PendingAcceptance;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return State::Pending;
-          }
-          else if (hashCode == Available_HASH)
-          {
-            return State::Available;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return State::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return State::Deleted;
-          }
-          else if (hashCode == Rejected_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return State::Rejected;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return State::Failed;
-          }
-          else if (hashCode == Expired_HASH)
-          {
-            return State::Expired;
+          case 1113098030:
+            if (name == "PendingAcceptance")
+            {
+              return State::PendingAcceptance;
+            }
+            break;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return State::Pending;
+            }
+            break;
+          case 1270065833:
+            if (name == "Available")
+            {
+              return State::Available;
+            }
+            break;
+          case 884361160:
+            if (name == "Deleting")
+            {
+              return State::Deleting;
+            }
+            break;
+          case -1079851015:
+            if (name == "Deleted")
+            {
+              return State::Deleted;
+            }
+            break;
+          case -543852386:
+            if (name == "Rejected")
+            {
+              return State::Rejected;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return State::Failed;
+            }
+            break;
+          case 355417861:
+            if (name == "Expired")
+            {
+              return State::Expired;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return State::NOT_SET;
         }
 
-        Aws::String GetNameForState(State enumValue)
+        const char* GetNameForStateCStr(State enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case State::PendingAcceptance:
-            return "PendingAcceptance";
-          case State::Pending:
-            return "Pending";
-          case State::Available:
-            return "Available";
-          case State::Deleting:
-            return "Deleting";
-          case State::Deleted:
-            return "Deleted";
-          case State::Rejected:
-            return "Rejected";
-          case State::Failed:
-            return "Failed";
-          case State::Expired:
-            return "Expired";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForState(State enumValue)
+        {
+          return GetNameForStateCStr(enumValue);
         }
 
       } // namespace StateMapper
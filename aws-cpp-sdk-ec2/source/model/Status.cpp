@@ -30,25 +30,44 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int MoveInProgress_HASH = HashingUtils::HashString("MoveInProgress");
-        static const int InVpc_HASH = HashingUtils::HashString("InVpc");
-        static const int InClassic_HASH = HashingUtils::HashString("InClassic");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MoveInProgress",
+          "InVpc",
+          "InClassic",
+        };
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MoveInProgress_HASH)
-          {
-            return Status::MoveInProgress;
-          }
-          else if (hashCode == InVpc_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Status::InVpc;
-          }
-          else if (hashCode == InClassic_HASH)
-          {
-            return Status::InClassic;
+          case -886419133:
+            if (name == "MoveInProgress")
+            {
+              return Status::MoveInProgress;
+            }
+            break;
+          case 70780260:
+            if (name == "InVpc")
+            {
+              return Status::InVpc;
+            }
+            break;
+          case -2141274227:
+            if (name == "InClassic")
+            {
+              return Status::InClassic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Status::NOT_SET;
         }
 
-        Aws::String GetNameForStatus(Status enumValue)
+        const char* GetNameForStatusCStr(Status enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Status::MoveInProgress:
-            return "MoveInProgress";
-          case Status::InVpc:
-            return "InVpc";
-          case Status::InClassic:
-            return "InClassic";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatus(Status enumValue)
+        {
+          return GetNameForStatusCStr(enumValue);
         }
 
       } // namespace StatusMapper
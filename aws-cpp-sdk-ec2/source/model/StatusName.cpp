@@ -30,15 +30,30 @@ namespace Aws
       namespace StatusNameMapper
       {
 
-        static const int reachability_HASH = HashingUtils::HashString("reachability");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "reachability",
+        };
 
         StatusName GetStatusNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == reachability_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StatusName::reachability;
+          case -41098153:
+            if (name == "reachability")
+            {
+              return StatusName::reachability;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return StatusName::NOT_SET;
         }
 
-        Aws::String GetNameForStatusName(StatusName enumValue)
+        const char* GetNameForStatusNameCStr(StatusName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StatusName::reachability:
-            return "reachability";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatusName(StatusName enumValue)
+        {
+          return GetNameForStatusNameCStr(enumValue);
         }
 
       } // namespace StatusNameMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace StatusTypeMapper
       {
 
-        static const int passed_HASH = HashingUtils::HashString("passed");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int insufficient_data_HASH = HashingUtils::HashString("insufficient-data");
-        static const int initializing_HASH = HashingUtils::HashString("initializing");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "passed",
+          "failed",
+          "insufficient-data",
+          "initializing",
+        };
 
         StatusType GetStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == passed_HASH)
-          {
-            return StatusType::passed;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return StatusType::failed;
-          }
-          else if (hashCode == insufficient_data_HASH)
-          {
-            return StatusType::insufficient_data;
-          }
-          else if (hashCode == initializing_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StatusType::initializing;
+          case -995381136:
+            if (name == "passed")
+            {
+              return StatusType::passed;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return StatusType::failed;
+            }
+            break;
+          case -1930904780:
+            if (name == "insufficient-data")
+            {
+              return StatusType::insufficient_data;
+            }
+            break;
+          case -400079795:
+            if (name == "initializing")
+            {
+              return StatusType::initializing;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return StatusType::NOT_SET;
         }
 
-        Aws::String GetNameForStatusType(StatusType enumValue)
+        const char* GetNameForStatusTypeCStr(StatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StatusType::passed:
-            return "passed";
-          case StatusType::failed:
-            return "failed";
-          case StatusType::insufficient_data:
-            return "insufficient-data";
-          case StatusType::initializing:
-            return "initializing";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatusType(StatusType enumValue)
+        {
+          return GetNameForStatusTypeCStr(enumValue);
         }
 
       } // namespace StatusTypeMapper
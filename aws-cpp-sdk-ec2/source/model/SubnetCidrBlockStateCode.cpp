@@ -30,40 +30,65 @@ namespace Aws
       namespace SubnetCidrBlockStateCodeMapper
       {
 
-        static const int associating_HASH = HashingUtils::HashString("associating");
-        static const int associated_HASH = HashingUtils::HashString("associated");
-        static const int disassociating_HASH = HashingUtils::HashString("disassociating");
-        static const int disassociated_HASH = HashingUtils::HashString("disassociated");
-        static const int failing_HASH = HashingUtils::HashString("failing");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "associating",
+          "associated",
+          "disassociating",
+          "disassociated",
+          "failing",
+          "failed",
+        };
 
         SubnetCidrBlockStateCode GetSubnetCidrBlockStateCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == associating_HASH)
-          {
-            return SubnetCidrBlockStateCode::associating;
-          }
-          else if (hashCode == associated_HASH)
-          {
-            return SubnetCidrBlockStateCode::associated;
-          }
-          else if (hashCode == disassociating_HASH)
-          {
-            return SubnetCidrBlockStateCode::disassociating;
-          }
-          else if (hashCode == disassociated_HASH)
-          {
-            return SubnetCidrBlockStateCode::disassociated;
-          }
-          else if (hashCode == failing_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SubnetCidrBlockStateCode::failing;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return SubnetCidrBlockStateCode::failed;
+          case -87499685:
+            if (name == "associating")
+            {
+              return SubnetCidrBlockStateCode::associating;
+            }
+            break;
+          case 1936839942:
+            if (name == "associated")
+            {
+              return SubnetCidrBlockStateCode::associated;
+            }
+            break;
+          case 2113311501:
+            if (name == "disassociating")
+            {
+              return SubnetCidrBlockStateCode::disassociating;
+            }
+            break;
+          case -1455849452:
+            if (name == "disassociated")
+            {
+              return SubnetCidrBlockStateCode::disassociated;
+            }
+            break;
+          case -1086585852:
+            if (name == "failing")
+            {
+              return SubnetCidrBlockStateCode::failing;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return SubnetCidrBlockStateCode::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return SubnetCidrBlockStateCode::NOT_SET;
         }
 
-        Aws::String GetNameForSubnetCidrBlockStateCode(SubnetCidrBlockStateCode enumValue)
+        const char* GetNameForSubnetCidrBlockStateCodeCStr(SubnetCidrBlockStateCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SubnetCidrBlockStateCode::associating:
-            return "associating";
-          case SubnetCidrBlockStateCode::associated:
-            return "associated";
-          case SubnetCidrBlockStateCode::disassociating:
-            return "disassociating";
-          case SubnetCidrBlockStateCode::disassociated:
-            return "disassociated";
-          case SubnetCidrBlockStateCode::failing:
-            return "failing";
-          case SubnetCidrBlockStateCode::failed:
-            return "failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSubnetCidrBlockStateCode(SubnetCidrBlockStateCode enumValue)
+        {
+          return GetNameForSubnetCidrBlockStateCodeCStr(enumValue);
         }
 
       } // namespace SubnetCidrBlockStateCodeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SubnetStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "available",
+        };
 
         SubnetState GetSubnetStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return SubnetState::pending;
-          }
-          else if (hashCode == available_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SubnetState::available;
+          case -682587753:
+            if (name == "pending")
+            {
+              return SubnetState::pending;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return SubnetState::available;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SubnetState::NOT_SET;
         }
 
-        Aws::String GetNameForSubnetState(SubnetState enumValue)
+        const char* GetNameForSubnetStateCStr(SubnetState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SubnetState::pending:
-            return "pending";
-          case SubnetState::available:
-            return "available";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSubnetState(SubnetState enumValue)
+        {
+          return GetNameForSubnetStateCStr(enumValue);
         }
 
       } // namespace SubnetStateMapper
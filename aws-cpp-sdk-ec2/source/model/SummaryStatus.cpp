@@ -30,35 +30,58 @@ namespace Aws
       namespace SummaryStatusMapper
       {
 
-        static const int ok_HASH = HashingUtils::HashString("ok");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
-        static const int insufficient_data_HASH = HashingUtils::HashString("insufficient-data");
-        static const int not_applicable_HASH = HashingUtils::HashString("not-applicable");
-        static const int initializing_HASH = HashingUtils::HashString("initializing");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ok",
+          "impaired",
+          "insufficient-data",
+          "not-applicable",
+          "initializing",
+        };
 
         SummaryStatus GetSummaryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ok_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SummaryStatus::ok;
-          }
-          else if (hashCode == impaired_HASH)
-          {
-            return SummaryStatus::impaired;
-          }
-          else if (hashCode == insufficient_data_HASH)
-          {
-            return SummaryStatus::insufficient_data;
-          }
-          else if (hashCode == not_applicable_HASH)
-          {
-            return SummaryStatus::not_applicable;
-          }
-          else if (hashCode == initializing_HASH)
-          {
-            return SummaryStatus::initializing;
+          case 3548:
+            if (name == "ok")
+            {
+              return SummaryStatus::ok;
+            }
+            break;
+          case -435567843:
+            if (name == "impaired")
+            {
+              return SummaryStatus::impaired;
+            }
+            break;
+          case -1930904780:
+            if (name == "insufficient-data")
+            {
+              return SummaryStatus::insufficient_data;
+            }
+            break;
+          case 184902361:
+            if (name == "not-applicable")
+            {
+              return SummaryStatus::not_applicable;
+            }
+            break;
+          case -400079795:
+            if (name == "initializing")
+            {
+              return SummaryStatus::initializing;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return SummaryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSummaryStatus(SummaryStatus enumValue)
+        const char* GetNameForSummaryStatusCStr(SummaryStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SummaryStatus::ok:
-            return "ok";
-          case SummaryStatus::impaired:
-            return "impaired";
-          case SummaryStatus::insufficient_data:
-            return "insufficient-data";
-          case SummaryStatus::not_applicable:
-            return "not-applicable";
-          case SummaryStatus::initializing:
-            return "initializing";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSummaryStatus(SummaryStatus enumValue)
+        {
+          return GetNameForSummaryStatusCStr(enumValue);
         }
 
       } // namespace SummaryStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TelemetryStatusMapper
       {
 
-        static const int UP_HASH = HashingUtils::HashString("UP");
-        static const int DOWN_HASH = HashingUtils::HashString("DOWN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UP",
+          "DOWN",
+        };
 
         TelemetryStatus GetTelemetryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UP_HASH)
-          {
-            return TelemetryStatus::UP;
-          }
-          else if (hashCode == DOWN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TelemetryStatus::DOWN;
+          case 2715:
+            if (name == "UP")
+            {
+              return TelemetryStatus::UP;
+            }
+            break;
+          case 2104482:
+            if (name == "DOWN")
+            {
+              return TelemetryStatus::DOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TelemetryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTelemetryStatus(TelemetryStatus enumValue)
+        const char* GetNameForTelemetryStatusCStr(TelemetryStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TelemetryStatus::UP:
-            return "UP";
-          case TelemetryStatus::DOWN:
-            return "DOWN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTelemetryStatus(TelemetryStatus enumValue)
+        {
+          return GetNameForTelemetryStatusCStr(enumValue);
         }
 
       } // namespace TelemetryStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TenancyMapper
       {
 
-        static const int default__HASH = HashingUtils::HashString("default");
-        static const int dedicated_HASH = HashingUtils::HashString("dedicated");
-        static const int host_HASH = HashingUtils::HashString("host");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "default",
+          "dedicated",
+          "host",
+        };
 
         Tenancy GetTenancyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == default__HASH)
-          {
-            return Tenancy::default_;
-          }
-          else if (hashCode == dedicated_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Tenancy::dedicated;
-          }
-          else if (hashCode == host_HASH)
-          {
-            return Tenancy::host;
+          case 1544803905:
+            if (name == "default")
+            {
+              return Tenancy::default_;
+            }
+            break;
+          case 1229913583:
+            if (name == "dedicated")
+            {
+              return Tenancy::dedicated;
+            }
+            break;
+          case 3208616:
+            if (name == "host")
+            {
+              return Tenancy::host;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Tenancy::NOT_SET;
         }
 
-        Aws::String GetNameForTenancy(Tenancy enumValue)
+        const char* GetNameForTenancyCStr(Tenancy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Tenancy::default_:
-            return "default";
-          case Tenancy::dedicated:
-            return "dedicated";
-          case Tenancy::host:
-            return "host";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTenancy(Tenancy enumValue)
+        {
+          return GetNameForTenancyCStr(enumValue);
         }
 
       } // namespace TenancyMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TrafficTypeMapper
       {
 
-        static const int ACCEPT_HASH = HashingUtils::HashString("ACCEPT");
-        static const int REJECT_HASH = HashingUtils::HashString("REJECT");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCEPT",
+          "REJECT",
+          "ALL",
+        };
 
         TrafficType GetTrafficTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCEPT_HASH)
-          {
-            return TrafficType::ACCEPT;
-          }
-          else if (hashCode == REJECT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TrafficType::REJECT;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return TrafficType::ALL;
+          case 1924835592:
+            if (name == "ACCEPT")
+            {
+              return TrafficType::ACCEPT;
+            }
+            break;
+          case -1881380961:
+            if (name == "REJECT")
+            {
+              return TrafficType::REJECT;
+            }
+            break;
+          case 64897:
+            if (name == "ALL")
+            {
+              return TrafficType::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TrafficType::NOT_SET;
         }
 
-        Aws::String GetNameForTrafficType(TrafficType enumValue)
+        const char* GetNameForTrafficTypeCStr(TrafficType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TrafficType::ACCEPT:
-            return "ACCEPT";
-          case TrafficType::REJECT:
-            return "REJECT";
-          case TrafficType::ALL:
-            return "ALL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTrafficType(TrafficType enumValue)
+        {
+          return GetNameForTrafficTypeCStr(enumValue);
         }
 
       } // namespace TrafficTypeMapper
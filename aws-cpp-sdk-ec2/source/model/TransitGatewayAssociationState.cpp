@@ -30,30 +30,51 @@ namespace Aws
       namespace TransitGatewayAssociationStateMapper
       {
 
-        static const int associating_HASH = HashingUtils::HashString("associating");
-        static const int associated_HASH = HashingUtils::HashString("associated");
-        static const int disassociating_HASH = HashingUtils::HashString("disassociating");
-        static const int disassociated_HASH = HashingUtils::HashString("disassociated");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "associating",
+          "associated",
+          "disassociating",
+          "disassociated",
+        };
 
         TransitGatewayAssociationState GetTransitGatewayAssociationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == associating_HASH)
-          {
-            return TransitGatewayAssociationState::associating;
-          }
-          else if (hashCode == associated_HASH)
-          {
-            return TransitGatewayAssociationState::associated;
-          }
-          else if (hashCode == disassociating_HASH)
-          {
-            return TransitGatewayAssociationState::disassociating;
-          }
-          else if (hashCode == disassociated_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TransitGatewayAssociationState::disassociated;
+          case -87499685:
+            if (name == "associating")
+            {
+              return TransitGatewayAssociationState::associating;
+            }
+            break;
+          case 1936839942:
+            if (name == "associated")
+            {
+              return TransitGatewayAssociationState::associated;
+            }
+            break;
+          case 2113311501:
+            if (name == "disassociating")
+            {
+              return TransitGatewayAssociationState::disassociating;
+            }
+            break;
+          case -1455849452:
+            if (name == "disassociated")
+            {
+              return TransitGatewayAssociationState::disassociated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return TransitGatewayAssociationState::NOT_SET;
         }
 
-        Aws::String GetNameForTransitGatewayAssociationState(TransitGatewayAssociationState enumValue)
+        const char* GetNameForTransitGatewayAssociationStateCStr(TransitGatewayAssociationState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TransitGatewayAssociationState::associating:
-            return "associating";
-          case TransitGatewayAssociationState::associated:
-            return "associated";
-          case TransitGatewayAssociationState::disassociating:
-            return "disassociating";
-          case TransitGatewayAssociationState::disassociated:
-            return "disassociated";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransitGatewayAssociationState(TransitGatewayAssociationState enumValue)
+        {
+          return GetNameForTransitGatewayAssociationStateCStr(enumValue);
         }
 
       } // namespace TransitGatewayAssociationStateMapper
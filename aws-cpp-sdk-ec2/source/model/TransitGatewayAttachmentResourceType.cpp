@@ -30,20 +30,37 @@ namespace Aws
       namespace TransitGatewayAttachmentResourceTypeMapper
       {
 
-        static const int vpc_HASH = HashingUtils::HashString("vpc");
-        static const int vpn_HASH = HashingUtils::HashString("vpn");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "vpc",
+          "vpn",
+        };
 
         TransitGatewayAttachmentResourceType GetTransitGatewayAttachmentResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == vpc_HASH)
-          {
-            return TransitGatewayAttachmentResourceType::vpc;
-          }
-          else if (hashCode == vpn_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TransitGatewayAttachmentResourceType::vpn;
+          case 116969:
+            if (name == "vpc")
+            {
+              return TransitGatewayAttachmentResourceType::vpc;
+            }
+            break;
+          case 116980:
+            if (name == "vpn")
+            {
+              return TransitGatewayAttachmentResourceType::vpn;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TransitGatewayAttachmentResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForTransitGatewayAttachmentResourceType(TransitGatewayAttachmentResourceType enumValue)
+        const char* GetNameForTransitGatewayAttachmentResourceTypeCStr(TransitGatewayAttachmentResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TransitGatewayAttachmentResourceType::vpc:
-            return "vpc";
-          case TransitGatewayAttachmentResourceType::vpn:
-            return "vpn";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransitGatewayAttachmentResourceType(TransitGatewayAttachmentResourceType enumValue)
+        {
+          return GetNameForTransitGatewayAttachmentResourceTypeCStr(enumValue);
         }
 
       } // namespace TransitGatewayAttachmentResourceTypeMapper
@@ -30,65 +30,100 @@ namespace Aws
       namespace TransitGatewayAttachmentStateMapper
       {
 
-        static const int pendingAcceptance_HASH = HashingUtils::HashString("pendingAcceptance");
-        static const int rollingBack_HASH = HashingUtils::HashString("rollingBack");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int modifying_HASH = HashingUtils::HashString("modifying");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int rejected_HASH = HashingUtils::HashString("rejected");
-        static const int rejecting_HASH = HashingUtils::HashString("rejecting");
-        static const int failing_HASH = HashingUtils::HashString("failing");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pendingAcceptance",
+          "rollingBack",
+          "pending",
+          "available",
+          "modifying",
+          "deleting",
+          "deleted",
+          "failed",
+          "rejected",
+          "rejecting",
+          "failing",
+        };
 
         TransitGatewayAttachmentState GetTransitGatewayAttachmentStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pendingAcceptance_HASH)
-          {
-            return TransitGatewayAttachmentState::pendingAcceptance;
-          }
-          else if (hashCode == rollingBack_HASH)
-          {
-            return TransitGatewayAttachmentState::rollingBack;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return TransitGatewayAttachmentState::pending;
-          }
-          else if (hashCode == available_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TransitGatewayAttachmentState::available;
-          }
-          else if (hashCode == modifying_HASH)
-          {
-            return TransitGatewayAttachmentState::modifying;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return TransitGatewayAttachmentState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return TransitGatewayAttachmentState::deleted;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return TransitGatewayAttachmentState::failed;
-          }
-          else if (hashCode == rejected_HASH)
-          {
-            return TransitGatewayAttachmentState::rejected;
-          }
-          else if (hashCode == rejecting_HASH)
-          {
-            return TransitGatewayAttachmentState::rejecting;
-          }
-          else if (hashCode == failing_HASH)
-          {
-            return TransitGatewayAttachmentState::failing;
+          case 1469335374:
+            if (name == "pendingAcceptance")
+            {
+              return TransitGatewayAttachmentState::pendingAcceptance;
+            }
+            break;
+          case 226212044:
+            if (name == "rollingBack")
+            {
+              return TransitGatewayAttachmentState::rollingBack;
+            }
+            break;
+          case -682587753:
+            if (name == "pending")
+            {
+              return TransitGatewayAttachmentState::pending;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return TransitGatewayAttachmentState::available;
+            }
+            break;
+          case -1900565272:
+            if (name == "modifying")
+            {
+              return TransitGatewayAttachmentState::modifying;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return TransitGatewayAttachmentState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return TransitGatewayAttachmentState::deleted;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return TransitGatewayAttachmentState::failed;
+            }
+            break;
+          case -608496514:
+            if (name == "rejected")
+            {
+              return TransitGatewayAttachmentState::rejected;
+            }
+            break;
+          case -1683518493:
+            if (name == "rejecting")
+            {
+              return TransitGatewayAttachmentState::rejecting;
+            }
+            break;
+          case -1086585852:
+            if (name == "failing")
+            {
+              return TransitGatewayAttachmentState::failing;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return TransitGatewayAttachmentState::NOT_SET;
         }
 
-        Aws::String GetNameForTransitGatewayAttachmentState(TransitGatewayAttachmentState enumValue)
+        const char* GetNameForTransitGatewayAttachmentStateCStr(TransitGatewayAttachmentState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TransitGatewayAttachmentState::pendingAcceptance:
-            return "pendingAcceptance";
-          case TransitGatewayAttachmentState::rollingBack:
-            return "rollingBack";
-          case TransitGatewayAttachmentState::pending:
-            return "pending";
-          case TransitGatewayAttachmentState::available:
-            return "available";
-          case TransitGatewayAttachmentState::modifying:
-            return "modifying";
-          case TransitGatewayAttachmentState::deleting:
-            return "deleting";
-          case TransitGatewayAttachmentState::deleted:
-            return "deleted";
-          case TransitGatewayAttachmentState::failed:
-            return "failed";
-          case TransitGatewayAttachmentState::rejected:
-            return "rejected";
-          case TransitGatewayAttachmentState::rejecting:
-            return "rejecting";
-          case TransitGatewayAttachmentState::failing:
-            return "failing";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransitGatewayAttachmentState(TransitGatewayAttachmentState enumValue)
+        {
+          return GetNameForTransitGatewayAttachmentStateCStr(enumValue);
         }
 
       } // namespace TransitGatewayAttachmentStateMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace TransitGatewayPropagationStateMapper
       {
 
-        static const int enabling_HASH = HashingUtils::HashString("enabling");
-        static const int enabled_HASH = HashingUtils::HashString("enabled");
-        static const int disabling_HASH = HashingUtils::HashString("disabling");
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "enabling",
+          "enabled",
+          "disabling",
+          "disabled",
+        };
 
         TransitGatewayPropagationState GetTransitGatewayPropagationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enabling_HASH)
-          {
-            return TransitGatewayPropagationState::enabling;
-          }
-          else if (hashCode == enabled_HASH)
-          {
-            return TransitGatewayPropagationState::enabled;
-          }
-          else if (hashCode == disabling_HASH)
-          {
-            return TransitGatewayPropagationState::disabling;
-          }
-          else if (hashCode == disabled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TransitGatewayPropagationState::disabled;
+          case 1642196352:
+            if (name == "enabling")
+            {
+              return TransitGatewayPropagationState::enabling;
+            }
+            break;
+          case -1609594047:
+            if (name == "enabled")
+            {
+              return TransitGatewayPropagationState::enabled;
+            }
+            break;
+          case -190765659:
+            if (name == "disabling")
+            {
+              return TransitGatewayPropagationState::disabling;
+            }
+            break;
+          case 270940796:
+            if (name == "disabled")
+            {
+              return TransitGatewayPropagationState::disabled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return TransitGatewayPropagationState::NOT_SET;
         }
 
-        Aws::String GetNameForTransitGatewayPropagationState(TransitGatewayPropagationState enumValue)
+        const char* GetNameForTransitGatewayPropagationStateCStr(TransitGatewayPropagationState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TransitGatewayPropagationState::enabling:
-            return "enabling";
-          case TransitGatewayPropagationState::enabled:
-            return "enabled";
-          case TransitGatewayPropagationState::disabling:
-            return "disabling";
-          case TransitGatewayPropagationState::disabled:
-            return "disabled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransitGatewayPropagationState(TransitGatewayPropagationState enumValue)
+        {
+          return GetNameForTransitGatewayPropagationStateCStr(enumValue);
         }
 
       } // namespace TransitGatewayPropagationStateMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace TransitGatewayRouteStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int blackhole_HASH = HashingUtils::HashString("blackhole");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "active",
+          "blackhole",
+          "deleting",
+          "deleted",
+        };
 
         TransitGatewayRouteState GetTransitGatewayRouteStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TransitGatewayRouteState::pending;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return TransitGatewayRouteState::active;
-          }
-          else if (hashCode == blackhole_HASH)
-          {
-            return TransitGatewayRouteState::blackhole;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return TransitGatewayRouteState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return TransitGatewayRouteState::deleted;
+          case -682587753:
+            if (name == "pending")
+            {
+              return TransitGatewayRouteState::pending;
+            }
+            break;
+          case -1422950650:
+            if (name == "active")
+            {
+              return TransitGatewayRouteState::active;
+            }
+            break;
+          case 1332899135:
+            if (name == "blackhole")
+            {
+              return TransitGatewayRouteState::blackhole;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return TransitGatewayRouteState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return TransitGatewayRouteState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return TransitGatewayRouteState::NOT_SET;
         }
 
-        Aws::String GetNameForTransitGatewayRouteState(TransitGatewayRouteState enumValue)
+        const char* GetNameForTransitGatewayRouteStateCStr(TransitGatewayRouteState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TransitGatewayRouteState::pending:
-            return "pending";
-          case TransitGatewayRouteState::active:
-            return "active";
-          case TransitGatewayRouteState::blackhole:
-            return "blackhole";
-          case TransitGatewayRouteState::deleting:
-            return "deleting";
-          case TransitGatewayRouteState::deleted:
-            return "deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransitGatewayRouteState(TransitGatewayRouteState enumValue)
+        {
+          return GetNameForTransitGatewayRouteStateCStr(enumValue);
         }
 
       } // namespace TransitGatewayRouteStateMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace TransitGatewayRouteTableStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "available",
+          "deleting",
+          "deleted",
+        };
 
         TransitGatewayRouteTableState GetTransitGatewayRouteTableStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return TransitGatewayRouteTableState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return TransitGatewayRouteTableState::available;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return TransitGatewayRouteTableState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TransitGatewayRouteTableState::deleted;
+          case -682587753:
+            if (name == "pending")
+            {
+              return TransitGatewayRouteTableState::pending;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return TransitGatewayRouteTableState::available;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return TransitGatewayRouteTableState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return TransitGatewayRouteTableState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return TransitGatewayRouteTableState::NOT_SET;
         }
 
-        Aws::String GetNameForTransitGatewayRouteTableState(TransitGatewayRouteTableState enumValue)
+        const char* GetNameForTransitGatewayRouteTableStateCStr(TransitGatewayRouteTableState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TransitGatewayRouteTableState::pending:
-            return "pending";
-          case TransitGatewayRouteTableState::available:
-            return "available";
-          case TransitGatewayRouteTableState::deleting:
-            return "deleting";
-          case TransitGatewayRouteTableState::deleted:
-            return "deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransitGatewayRouteTableState(TransitGatewayRouteTableState enumValue)
+        {
+          return GetNameForTransitGatewayRouteTableStateCStr(enumValue);
         }
 
       } // namespace TransitGatewayRouteTableStateMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TransitGatewayRouteTypeMapper
       {
 
-        static const int static__HASH = HashingUtils::HashString("static");
-        static const int propagated_HASH = HashingUtils::HashString("propagated");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "static",
+          "propagated",
+        };
 
         TransitGatewayRouteType GetTransitGatewayRouteTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == static__HASH)
-          {
-            return TransitGatewayRouteType::static_;
-          }
-          else if (hashCode == propagated_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TransitGatewayRouteType::propagated;
+          case -892481938:
+            if (name == "static")
+            {
+              return TransitGatewayRouteType::static_;
+            }
+            break;
+          case -1051283877:
+            if (name == "propagated")
+            {
+              return TransitGatewayRouteType::propagated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TransitGatewayRouteType::NOT_SET;
         }
 
-        Aws::String GetNameForTransitGatewayRouteType(TransitGatewayRouteType enumValue)
+        const char* GetNameForTransitGatewayRouteTypeCStr(TransitGatewayRouteType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TransitGatewayRouteType::static_:
-            return "static";
-          case TransitGatewayRouteType::propagated:
-            return "propagated";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransitGatewayRouteType(TransitGatewayRouteType enumValue)
+        {
+          return GetNameForTransitGatewayRouteTypeCStr(enumValue);
         }
 
       } // namespace TransitGatewayRouteTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace TransitGatewayStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int modifying_HASH = HashingUtils::HashString("modifying");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "available",
+          "modifying",
+          "deleting",
+          "deleted",
+        };
 
         TransitGatewayState GetTransitGatewayStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TransitGatewayState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return TransitGatewayState::available;
-          }
-          else if (hashCode == modifying_HASH)
-          {
-            return TransitGatewayState::modifying;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return TransitGatewayState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return TransitGatewayState::deleted;
+          case -682587753:
+            if (name == "pending")
+            {
+              return TransitGatewayState::pending;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return TransitGatewayState::available;
+            }
+            break;
+          case -1900565272:
+            if (name == "modifying")
+            {
+              return TransitGatewayState::modifying;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return TransitGatewayState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return TransitGatewayState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return TransitGatewayState::NOT_SET;
         }
 
-        Aws::String GetNameForTransitGatewayState(TransitGatewayState enumValue)
+        const char* GetNameForTransitGatewayStateCStr(TransitGatewayState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TransitGatewayState::pending:
-            return "pending";
-          case TransitGatewayState::available:
-            return "available";
-          case TransitGatewayState::modifying:
-            return "modifying";
-          case TransitGatewayState::deleting:
-            return "deleting";
-          case TransitGatewayState::deleted:
-            return "deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransitGatewayState(TransitGatewayState enumValue)
+        {
+          return GetNameForTransitGatewayStateCStr(enumValue);
         }
 
       } // namespace TransitGatewayStateMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TransportProtocolMapper
       {
 
-        static const int tcp_HASH = HashingUtils::HashString("tcp");
-        static const int udp_HASH = HashingUtils::HashString("udp");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "tcp",
+          "udp",
+        };
 
         TransportProtocol GetTransportProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == tcp_HASH)
-          {
-            return TransportProtocol::tcp;
-          }
-          else if (hashCode == udp_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TransportProtocol::udp;
+          case 114657:
+            if (name == "tcp")
+            {
+              return TransportProtocol::tcp;
+            }
+            break;
+          case 115649:
+            if (name == "udp")
+            {
+              return TransportProtocol::udp;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TransportProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForTransportProtocol(TransportProtocol enumValue)
+        const char* GetNameForTransportProtocolCStr(TransportProtocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TransportProtocol::tcp:
-            return "tcp";
-          case TransportProtocol::udp:
-            return "udp";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransportProtocol(TransportProtocol enumValue)
+        {
+          return GetNameForTransportProtocolCStr(enumValue);
         }
 
       } // namespace TransportProtocolMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace UnsuccessfulInstanceCreditSpecificationErrorCodeMapper
       {
 
-        static const int InvalidInstanceID_Malformed_HASH = HashingUtils::HashString("InvalidInstanceID.Malformed");
-        static const int InvalidInstanceID_NotFound_HASH = HashingUtils::HashString("InvalidInstanceID.NotFound");
-        static const int IncorrectInstanceState_HASH = HashingUtils::HashString("IncorrectInstanceState");
-        static const int InstanceCreditSpecification_NotSupported_HASH = HashingUtils::HashString("InstanceCreditSpecification.NotSupported");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InvalidInstanceID.Malformed",
+          "InvalidInstanceID.NotFound",
+          "IncorrectInstanceState",
+          "InstanceCreditSpecification.NotSupported",
+        };
 
         UnsuccessfulInstanceCreditSpecificationErrorCode GetUnsuccessfulInstanceCreditSpecificationErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvalidInstanceID_Malformed_HASH)
-          {
-            return UnsuccessfulInstanceCreditSpecificationErrorCode::InvalidInstanceID_Malformed;
-          }
-          else if (hashCode == InvalidInstanceID_NotFound_HASH)
-          {
-            return UnsuccessfulInstanceCreditSpecificationErrorCode::InvalidInstanceID_NotFound;
-          }
-          else if (hashCode == IncorrectInstanceState_HASH)
-          {
-            return UnsuccessfulInstanceCreditSpecificationErrorCode::IncorrectInstanceState;
-          }
-          else if (hashCode == InstanceCreditSpecification_NotSupported_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UnsuccessfulInstanceCreditSpecificationErrorCode::InstanceCreditSpecification_NotSupported;
+          case 1606622228:
+            if (name == "InvalidInstanceID.Malformed")
+            {
+              return UnsuccessfulInstanceCreditSpecificationErrorCode::InvalidInstanceID_Malformed;
+            }
+            break;
+          case 1257175286:
+            if (name == "InvalidInstanceID.NotFound")
+            {
+              return UnsuccessfulInstanceCreditSpecificationErrorCode::InvalidInstanceID_NotFound;
+            }
+            break;
+          case -295531145:
+            if (name == "IncorrectInstanceState")
+            {
+              return UnsuccessfulInstanceCreditSpecificationErrorCode::IncorrectInstanceState;
+            }
+            break;
+          case 973470964:
+            if (name == "InstanceCreditSpecification.NotSupported")
+            {
+              return UnsuccessfulInstanceCreditSpecificationErrorCode::InstanceCreditSpecification_NotSupported;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return UnsuccessfulInstanceCreditSpecificationErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForUnsuccessfulInstanceCreditSpecificationErrorCode(UnsuccessfulInstanceCreditSpecificationErrorCode enumValue)
+        const char* GetNameForUnsuccessfulInstanceCreditSpecificationErrorCodeCStr(UnsuccessfulInstanceCreditSpecificationErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UnsuccessfulInstanceCreditSpecificationErrorCode::InvalidInstanceID_Malformed:
-            return "InvalidInstanceID.Malformed";
-          case UnsuccessfulInstanceCreditSpecificationErrorCode::InvalidInstanceID_NotFound:
-            return "InvalidInstanceID.NotFound";
-          case UnsuccessfulInstanceCreditSpecificationErrorCode::IncorrectInstanceState:
-            return "IncorrectInstanceState";
-          case UnsuccessfulInstanceCreditSpecificationErrorCode::InstanceCreditSpecification_NotSupported:
-            return "InstanceCreditSpecification.NotSupported";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUnsuccessfulInstanceCreditSpecificationErrorCode(UnsuccessfulInstanceCreditSpecificationErrorCode enumValue)
+        {
+          return GetNameForUnsuccessfulInstanceCreditSpecificationErrorCodeCStr(enumValue);
         }
 
       } // namespace UnsuccessfulInstanceCreditSpecificationErrorCodeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace VolumeAttachmentStateMapper
       {
 
-        static const int attaching_HASH = HashingUtils::HashString("attaching");
-        static const int attached_HASH = HashingUtils::HashString("attached");
-        static const int detaching_HASH = HashingUtils::HashString("detaching");
-        static const int detached_HASH = HashingUtils::HashString("detached");
-        static const int busy_HASH = HashingUtils::HashString("busy");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "attaching",
+          "attached",
+          "detaching",
+          "detached",
+          "busy",
+        };
 
         VolumeAttachmentState GetVolumeAttachmentStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == attaching_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VolumeAttachmentState::attaching;
-          }
-          else if (hashCode == attached_HASH)
-          {
-            return VolumeAttachmentState::attached;
-          }
-          else if (hashCode == detaching_HASH)
-          {
-            return VolumeAttachmentState::detaching;
-          }
-          else if (hashCode == detached_HASH)
-          {
-            return VolumeAttachmentState::detached;
-          }
-          else if (hashCode == busy_HASH)
-          {
-            return VolumeAttachmentState::busy;
+          case -478984323:
+            if (name == "attaching")
+            {
+              return VolumeAttachmentState::attaching;
+            }
+            break;
+          case 538738084:
+            if (name == "attached")
+            {
+              return VolumeAttachmentState::attached;
+            }
+            break;
+          case -1978731665:
+            if (name == "detaching")
+            {
+              return VolumeAttachmentState::detaching;
+            }
+            break;
+          case 1044548466:
+            if (name == "detached")
+            {
+              return VolumeAttachmentState::detached;
+            }
+            break;
+          case 3035641:
+            if (name == "busy")
+            {
+              return VolumeAttachmentState::busy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return VolumeAttachmentState::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeAttachmentState(VolumeAttachmentState enumValue)
+        const char* GetNameForVolumeAttachmentStateCStr(VolumeAttachmentState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VolumeAttachmentState::attaching:
-            return "attaching";
-          case VolumeAttachmentState::attached:
-            return "attached";
-          case VolumeAttachmentState::detaching:
-            return "detaching";
-          case VolumeAttachmentState::detached:
-            return "detached";
-          case VolumeAttachmentState::busy:
-            return "busy";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVolumeAttachmentState(VolumeAttachmentState enumValue)
+        {
+          return GetNameForVolumeAttachmentStateCStr(enumValue);
         }
 
       } // namespace VolumeAttachmentStateMapper
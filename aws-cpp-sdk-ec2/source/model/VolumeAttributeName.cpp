@@ -30,20 +30,37 @@ namespace Aws
       namespace VolumeAttributeNameMapper
       {
 
-        static const int autoEnableIO_HASH = HashingUtils::HashString("autoEnableIO");
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "autoEnableIO",
+          "productCodes",
+        };
 
         VolumeAttributeName GetVolumeAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == autoEnableIO_HASH)
-          {
-            return VolumeAttributeName::autoEnableIO;
-          }
-          else if (hashCode == productCodes_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VolumeAttributeName::productCodes;
+          case 1468333240:
+            if (name == "autoEnableIO")
+            {
+              return VolumeAttributeName::autoEnableIO;
+            }
+            break;
+          case 988549239:
+            if (name == "productCodes")
+            {
+              return VolumeAttributeName::productCodes;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return VolumeAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeAttributeName(VolumeAttributeName enumValue)
+        const char* GetNameForVolumeAttributeNameCStr(VolumeAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VolumeAttributeName::autoEnableIO:
-            return "autoEnableIO";
-          case VolumeAttributeName::productCodes:
-            return "productCodes";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVolumeAttributeName(VolumeAttributeName enumValue)
+        {
+          return GetNameForVolumeAttributeNameCStr(enumValue);
         }
 
       } // namespace VolumeAttributeNameMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace VolumeModificationStateMapper
       {
 
-        static const int modifying_HASH = HashingUtils::HashString("modifying");
-        static const int optimizing_HASH = HashingUtils::HashString("optimizing");
-        static const int completed_HASH = HashingUtils::HashString("completed");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "modifying",
+          "optimizing",
+          "completed",
+          "failed",
+        };
 
         VolumeModificationState GetVolumeModificationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == modifying_HASH)
-          {
-            return VolumeModificationState::modifying;
-          }
-          else if (hashCode == optimizing_HASH)
-          {
-            return VolumeModificationState::optimizing;
-          }
-          else if (hashCode == completed_HASH)
-          {
-            return VolumeModificationState::completed;
-          }
-          else if (hashCode == failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VolumeModificationState::failed;
+          case -1900565272:
+            if (name == "modifying")
+            {
+              return VolumeModificationState::modifying;
+            }
+            break;
+          case 1312828506:
+            if (name == "optimizing")
+            {
+              return VolumeModificationState::optimizing;
+            }
+            break;
+          case -1402931637:
+            if (name == "completed")
+            {
+              return VolumeModificationState::completed;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return VolumeModificationState::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return VolumeModificationState::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeModificationState(VolumeModificationState enumValue)
+        const char* GetNameForVolumeModificationStateCStr(VolumeModificationState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VolumeModificationState::modifying:
-            return "modifying";
-          case VolumeModificationState::optimizing:
-            return "optimizing";
-          case VolumeModificationState::completed:
-            return "completed";
-          case VolumeModificationState::failed:
-            return "failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVolumeModificationState(VolumeModificationState enumValue)
+        {
+          return GetNameForVolumeModificationStateCStr(enumValue);
         }
 
       } // namespace VolumeModificationStateMapper
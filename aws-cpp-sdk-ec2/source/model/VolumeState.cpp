@@ -30,40 +30,65 @@ namespace Aws
       namespace VolumeStateMapper
       {
 
-        static const int creating_HASH = HashingUtils::HashString("creating");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int in_use_HASH = HashingUtils::HashString("in-use");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int error_HASH = HashingUtils::HashString("error");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "creating",
+          "available",
+          "in-use",
+          "deleting",
+          "deleted",
+          "error",
+        };
 
         VolumeState GetVolumeStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == creating_HASH)
-          {
-            return VolumeState::creating;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return VolumeState::available;
-          }
-          else if (hashCode == in_use_HASH)
-          {
-            return VolumeState::in_use;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return VolumeState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VolumeState::deleted;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return VolumeState::error;
+          case 1820421817:
+            if (name == "creating")
+            {
+              return VolumeState::creating;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return VolumeState::available;
+            }
+            break;
+          case -1185862433:
+            if (name == "in-use")
+            {
+              return VolumeState::in_use;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return VolumeState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return VolumeState::deleted;
+            }
+            break;
+          case 96784904:
+            if (name == "error")
+            {
+              return VolumeState::error;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return VolumeState::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeState(VolumeState enumValue)
+        const char* GetNameForVolumeStateCStr(VolumeState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VolumeState::creating:
-            return "creating";
-          case VolumeState::available:
-            return "available";
-          case VolumeState::in_use:
-            return "in-use";
-          case VolumeState::deleting:
-            return "deleting";
-          case VolumeState::deleted:
-            return "deleted";
-          case VolumeState::error:
-            return "error";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVolumeState(VolumeState enumValue)
+        {
+          return GetNameForVolumeStateCStr(enumValue);
         }
 
       } // namespace VolumeStateMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace VolumeStatusInfoStatusMapper
       {
 
-        static const int ok_HASH = HashingUtils::HashString("ok");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
-        static const int insufficient_data_HASH = HashingUtils::HashString("insufficient-data");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ok",
+          "impaired",
+          "insufficient-data",
+        };
 
         VolumeStatusInfoStatus GetVolumeStatusInfoStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ok_HASH)
-          {
-            return VolumeStatusInfoStatus::ok;
-          }
-          else if (hashCode == impaired_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VolumeStatusInfoStatus::impaired;
-          }
-          else if (hashCode == insufficient_data_HASH)
-          {
-            return VolumeStatusInfoStatus::insufficient_data;
+          case 3548:
+            if (name == "ok")
+            {
+              return VolumeStatusInfoStatus::ok;
+            }
+            break;
+          case -435567843:
+            if (name == "impaired")
+            {
+              return VolumeStatusInfoStatus::impaired;
+            }
+            break;
+          case -1930904780:
+            if (name == "insufficient-data")
+            {
+              return VolumeStatusInfoStatus::insufficient_data;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return VolumeStatusInfoStatus::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeStatusInfoStatus(VolumeStatusInfoStatus enumValue)
+        const char* GetNameForVolumeStatusInfoStatusCStr(VolumeStatusInfoStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VolumeStatusInfoStatus::ok:
-            return "ok";
-          case VolumeStatusInfoStatus::impaired:
-            return "impaired";
-          case VolumeStatusInfoStatus::insufficient_data:
-            return "insufficient-data";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVolumeStatusInfoStatus(VolumeStatusInfoStatus enumValue)
+        {
+          return GetNameForVolumeStatusInfoStatusCStr(enumValue);
         }
 
       } // namespace VolumeStatusInfoStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace VolumeStatusNameMapper
       {
 
-        static const int io_enabled_HASH = HashingUtils::HashString("io-enabled");
-        static const int io_performance_HASH = HashingUtils::HashString("io-performance");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "io-enabled",
+          "io-performance",
+        };
 
         VolumeStatusName GetVolumeStatusNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == io_enabled_HASH)
-          {
-            return VolumeStatusName::io_enabled;
-          }
-          else if (hashCode == io_performance_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VolumeStatusName::io_performance;
+          case 1584395674:
+            if (name == "io-enabled")
+            {
+              return VolumeStatusName::io_enabled;
+            }
+            break;
+          case 281323017:
+            if (name == "io-performance")
+            {
+              return VolumeStatusName::io_performance;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return VolumeStatusName::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeStatusName(VolumeStatusName enumValue)
+        const char* GetNameForVolumeStatusNameCStr(VolumeStatusName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VolumeStatusName::io_enabled:
-            return "io-enabled";
-          case VolumeStatusName::io_performance:
-            return "io-performance";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVolumeStatusName(VolumeStatusName enumValue)
+        {
+          return GetNameForVolumeStatusNameCStr(enumValue);
         }
 
       } // namespace VolumeStatusNameMapper
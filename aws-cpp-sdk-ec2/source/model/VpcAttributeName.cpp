@@ -30,20 +30,37 @@ namespace Aws
       namespace VpcAttributeNameMapper
       {
 
-        static const int enableDnsSupport_HASH = HashingUtils::HashString("enableDnsSupport");
-        static const int enableDnsHostnames_HASH = HashingUtils::HashString("enableDnsHostnames");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "enableDnsSupport",
+          "enableDnsHostnames",
+        };
 
         VpcAttributeName GetVpcAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enableDnsSupport_HASH)
-          {
-            return VpcAttributeName::enableDnsSupport;
-          }
-          else if (hashCode == enableDnsHostnames_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VpcAttributeName::enableDnsHostnames;
+          case -1293001655:
+            if (name == "enableDnsSupport")
+            {
+              return VpcAttributeName::enableDnsSupport;
+            }
+            break;
+          case -2013212518:
+            if (name == "enableDnsHostnames")
+            {
+              return VpcAttributeName::enableDnsHostnames;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return VpcAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForVpcAttributeName(VpcAttributeName enumValue)
+        const char* GetNameForVpcAttributeNameCStr(VpcAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VpcAttributeName::enableDnsSupport:
-            return "enableDnsSupport";
-          case VpcAttributeName::enableDnsHostnames:
-            return "enableDnsHostnames";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVpcAttributeName(VpcAttributeName enumValue)
+        {
+          return GetNameForVpcAttributeNameCStr(enumValue);
         }
 
       } // namespace VpcAttributeNameMapper
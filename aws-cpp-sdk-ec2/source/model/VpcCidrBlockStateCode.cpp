@@ -30,40 +30,65 @@ namespace Aws
       namespace VpcCidrBlockStateCodeMapper
       {
 
-        static const int associating_HASH = HashingUtils::HashString("associating");
-        static const int associated_HASH = HashingUtils::HashString("associated");
-        static const int disassociating_HASH = HashingUtils::HashString("disassociating");
-        static const int disassociated_HASH = HashingUtils::HashString("disassociated");
-        static const int failing_HASH = HashingUtils::HashString("failing");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "associating",
+          "associated",
+          "disassociating",
+          "disassociated",
+          "failing",
+          "failed",
+        };
 
         VpcCidrBlockStateCode GetVpcCidrBlockStateCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == associating_HASH)
-          {
-            return VpcCidrBlockStateCode::associating;
-          }
-          else if (hashCode == associated_HASH)
-          {
-            return VpcCidrBlockStateCode::associated;
-          }
-          else if (hashCode == disassociating_HASH)
-          {
-            return VpcCidrBlockStateCode::disassociating;
-          }
-          else if (hashCode == disassociated_HASH)
-          {
-            return VpcCidrBlockStateCode::disassociated;
-          }
-          else if (hashCode == failing_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VpcCidrBlockStateCode::failing;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return VpcCidrBlockStateCode::failed;
+          case -87499685:
+            if (name == "associating")
+            {
+              return VpcCidrBlockStateCode::associating;
+            }
+            break;
+          case 1936839942:
+            if (name == "associated")
+            {
+              return VpcCidrBlockStateCode::associated;
+            }
+            break;
+          case 2113311501:
+            if (name == "disassociating")
+            {
+              return VpcCidrBlockStateCode::disassociating;
+            }
+            break;
+          case -1455849452:
+            if (name == "disassociated")
+            {
+              return VpcCidrBlockStateCode::disassociated;
+            }
+            break;
+          case -1086585852:
+            if (name == "failing")
+            {
+              return VpcCidrBlockStateCode::failing;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return VpcCidrBlockStateCode::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return VpcCidrBlockStateCode::NOT_SET;
         }
 
-        Aws::String GetNameForVpcCidrBlockStateCode(VpcCidrBlockStateCode enumValue)
+        const char* GetNameForVpcCidrBlockStateCodeCStr(VpcCidrBlockStateCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VpcCidrBlockStateCode::associating:
-            return "associating";
-          case VpcCidrBlockStateCode::associated:
-            return "associated";
-          case VpcCidrBlockStateCode::disassociating:
-            return "disassociating";
-          case VpcCidrBlockStateCode::disassociated:
-            return "disassociated";
-          case VpcCidrBlockStateCode::failing:
-            return "failing";
-          case VpcCidrBlockStateCode::failed:
-            return "failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVpcCidrBlockStateCode(VpcCidrBlockStateCode enumValue)
+        {
+          return GetNameForVpcCidrBlockStateCodeCStr(enumValue);
         }
 
       } // namespace VpcCidrBlockStateCodeMapper
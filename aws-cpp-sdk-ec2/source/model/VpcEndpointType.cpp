@@ -30,20 +30,37 @@ namespace Aws
       namespace VpcEndpointTypeMapper
       {
 
-        static const int Interface_HASH = HashingUtils::HashString("Interface");
-        static const int Gateway_HASH = HashingUtils::HashString("Gateway");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Interface",
+          "Gateway",
+        };
 
         VpcEndpointType GetVpcEndpointTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Interface_HASH)
-          {
-            return VpcEndpointType::Interface;
-          }
-          else if (hashCode == Gateway_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VpcEndpointType::Gateway;
+          case -1788375783:
+            if (name == "Interface")
+            {
+              return VpcEndpointType::Interface;
+            }
+            break;
+          case 1475534372:
+            if (name == "Gateway")
+            {
+              return VpcEndpointType::Gateway;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return VpcEndpointType::NOT_SET;
         }
 
-        Aws::String GetNameForVpcEndpointType(VpcEndpointType enumValue)
+        const char* GetNameForVpcEndpointTypeCStr(VpcEndpointType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VpcEndpointType::Interface:
-            return "Interface";
-          case VpcEndpointType::Gateway:
-            return "Gateway";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVpcEndpointType(VpcEndpointType enumValue)
+        {
+          return GetNameForVpcEndpointTypeCStr(enumValue);
         }
 
       } // namespace VpcEndpointTypeMapper
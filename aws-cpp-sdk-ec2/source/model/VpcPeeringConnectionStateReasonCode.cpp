@@ -30,55 +30,86 @@ namespace Aws
       namespace VpcPeeringConnectionStateReasonCodeMapper
       {
 
-        static const int initiating_request_HASH = HashingUtils::HashString("initiating-request");
-        static const int pending_acceptance_HASH = HashingUtils::HashString("pending-acceptance");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int rejected_HASH = HashingUtils::HashString("rejected");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int expired_HASH = HashingUtils::HashString("expired");
-        static const int provisioning_HASH = HashingUtils::HashString("provisioning");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "initiating-request",
+          "pending-acceptance",
+          "active",
+          "deleted",
+          "rejected",
+          "failed",
+          "expired",
+          "provisioning",
+          "deleting",
+        };
 
         VpcPeeringConnectionStateReasonCode GetVpcPeeringConnectionStateReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == initiating_request_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::initiating_request;
-          }
-          else if (hashCode == pending_acceptance_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VpcPeeringConnectionStateReasonCode::pending_acceptance;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::active;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::deleted;
-          }
-          else if (hashCode == rejected_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::rejected;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::failed;
-          }
-          else if (hashCode == expired_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::expired;
-          }
-          else if (hashCode == provisioning_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::provisioning;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::deleting;
+          case 972541144:
+            if (name == "initiating-request")
+            {
+              return VpcPeeringConnectionStateReasonCode::initiating_request;
+            }
+            break;
+          case -183533491:
+            if (name == "pending-acceptance")
+            {
+              return VpcPeeringConnectionStateReasonCode::pending_acceptance;
+            }
+            break;
+          case -1422950650:
+            if (name == "active")
+            {
+              return VpcPeeringConnectionStateReasonCode::active;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return VpcPeeringConnectionStateReasonCode::deleted;
+            }
+            break;
+          case -608496514:
+            if (name == "rejected")
+            {
+              return VpcPeeringConnectionStateReasonCode::rejected;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return VpcPeeringConnectionStateReasonCode::failed;
+            }
+            break;
+          case -1309235419:
+            if (name == "expired")
+            {
+              return VpcPeeringConnectionStateReasonCode::expired;
+            }
+            break;
+          case 121098989:
+            if (name == "provisioning")
+            {
+              return VpcPeeringConnectionStateReasonCode::provisioning;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return VpcPeeringConnectionStateReasonCode::deleting;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return VpcPeeringConnectionStateReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForVpcPeeringConnectionStateReasonCode(VpcPeeringConnectionStateReasonCode enumValue)
+        const char* GetNameForVpcPeeringConnectionStateReasonCodeCStr(VpcPeeringConnectionStateReasonCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VpcPeeringConnectionStateReasonCode::initiating_request:
-            return "initiating-request";
-          case VpcPeeringConnectionStateReasonCode::pending_acceptance:
-            return "pending-acceptance";
-          case VpcPeeringConnectionStateReasonCode::active:
-            return "active";
-          case VpcPeeringConnectionStateReasonCode::deleted:
-            return "deleted";
-          case VpcPeeringConnectionStateReasonCode::rejected:
-            return "rejected";
-          case VpcPeeringConnectionStateReasonCode::failed:
-            return "failed";
-          case VpcPeeringConnectionStateReasonCode::expired:
-            return "expired";
-          case VpcPeeringConnectionStateReasonCode::provisioning:
-            return "provisioning";
-          case VpcPeeringConnectionStateReasonCode::deleting:
-            return "deleting";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVpcPeeringConnectionStateReasonCode(VpcPeeringConnectionStateReasonCode enumValue)
+        {
+          return GetNameForVpcPeeringConnectionStateReasonCodeCStr(enumValue);
         }
 
       } // namespace VpcPeeringConnectionStateReasonCodeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace VpcTenancyMapper
       {
 
-        static const int default__HASH = HashingUtils::HashString("default");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "default",
+        };
 
         VpcTenancy GetVpcTenancyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == default__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VpcTenancy::default_;
+          case 1544803905:
+            if (name == "default")
+            {
+              return VpcTenancy::default_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return VpcTenancy::NOT_SET;
         }
 
-        Aws::String GetNameForVpcTenancy(VpcTenancy enumValue)
+        const char* GetNameForVpcTenancyCStr(VpcTenancy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VpcTenancy::default_:
-            return "default";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVpcTenancy(VpcTenancy enumValue)
+        {
+          return GetNameForVpcTenancyCStr(enumValue);
         }
 
       } // namespace VpcTenancyMapper
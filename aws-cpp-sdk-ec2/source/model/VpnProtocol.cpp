@@ -30,15 +30,30 @@ namespace Aws
       namespace VpnProtocolMapper
       {
 
-        static const int openvpn_HASH = HashingUtils::HashString("openvpn");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "openvpn",
+        };
 
         VpnProtocol GetVpnProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == openvpn_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VpnProtocol::openvpn;
+          case -1263171990:
+            if (name == "openvpn")
+            {
+              return VpnProtocol::openvpn;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return VpnProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForVpnProtocol(VpnProtocol enumValue)
+        const char* GetNameForVpnProtocolCStr(VpnProtocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VpnProtocol::openvpn:
-            return "openvpn";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVpnProtocol(VpnProtocol enumValue)
+        {
+          return GetNameForVpnProtocolCStr(enumValue);
         }
 
       } // namespace VpnProtocolMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace VpnStaticRouteSourceMapper
       {
 
-        static const int Static_HASH = HashingUtils::HashString("Static");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Static",
+        };
 
         VpnStaticRouteSource GetVpnStaticRouteSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Static_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VpnStaticRouteSource::Static;
+          case -1808614770:
+            if (name == "Static")
+            {
+              return VpnStaticRouteSource::Static;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return VpnStaticRouteSource::NOT_SET;
         }
 
-        Aws::String GetNameForVpnStaticRouteSource(VpnStaticRouteSource enumValue)
+        const char* GetNameForVpnStaticRouteSourceCStr(VpnStaticRouteSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VpnStaticRouteSource::Static:
-            return "Static";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVpnStaticRouteSource(VpnStaticRouteSource enumValue)
+        {
+          return GetNameForVpnStaticRouteSourceCStr(enumValue);
         }
 
       } // namespace VpnStaticRouteSourceMapper
@@ -34,6 +34,11 @@ namespace ImageActionTypeMapper
 AWS_ECR_API ImageActionType GetImageActionTypeForName(const Aws::String& name);
 
 AWS_ECR_API Aws::String GetNameForImageActionType(ImageActionType value);
+
+/**
+ * Same as GetNameForImageActionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECR_API const char* GetNameForImageActionTypeCStr(ImageActionType value);
 } // namespace ImageActionTypeMapper
 } // namespace Model
 } // namespace ECR
@@ -38,6 +38,11 @@ namespace ImageFailureCodeMapper
 AWS_ECR_API ImageFailureCode GetImageFailureCodeForName(const Aws::String& name);
 
 AWS_ECR_API Aws::String GetNameForImageFailureCode(ImageFailureCode value);
+
+/**
+ * Same as GetNameForImageFailureCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECR_API const char* GetNameForImageFailureCodeCStr(ImageFailureCode value);
 } // namespace ImageFailureCodeMapper
 } // namespace Model
 } // namespace ECR
@@ -35,6 +35,11 @@ namespace LayerAvailabilityMapper
 AWS_ECR_API LayerAvailability GetLayerAvailabilityForName(const Aws::String& name);
 
 AWS_ECR_API Aws::String GetNameForLayerAvailability(LayerAvailability value);
+
+/**
+ * Same as GetNameForLayerAvailability(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECR_API const char* GetNameForLayerAvailabilityCStr(LayerAvailability value);
 } // namespace LayerAvailabilityMapper
 } // namespace Model
 } // namespace ECR
@@ -35,6 +35,11 @@ namespace LayerFailureCodeMapper
 AWS_ECR_API LayerFailureCode GetLayerFailureCodeForName(const Aws::String& name);
 
 AWS_ECR_API Aws::String GetNameForLayerFailureCode(LayerFailureCode value);
+
+/**
+ * Same as GetNameForLayerFailureCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECR_API const char* GetNameForLayerFailureCodeCStr(LayerFailureCode value);
 } // namespace LayerFailureCodeMapper
 } // namespace Model
 } // namespace ECR
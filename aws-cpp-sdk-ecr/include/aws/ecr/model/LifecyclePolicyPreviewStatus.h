@@ -37,6 +37,11 @@ namespace LifecyclePolicyPreviewStatusMapper
 AWS_ECR_API LifecyclePolicyPreviewStatus GetLifecyclePolicyPreviewStatusForName(const Aws::String& name);
 
 AWS_ECR_API Aws::String GetNameForLifecyclePolicyPreviewStatus(LifecyclePolicyPreviewStatus value);
+
+/**
+ * Same as GetNameForLifecyclePolicyPreviewStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECR_API const char* GetNameForLifecyclePolicyPreviewStatusCStr(LifecyclePolicyPreviewStatus value);
 } // namespace LifecyclePolicyPreviewStatusMapper
 } // namespace Model
 } // namespace ECR
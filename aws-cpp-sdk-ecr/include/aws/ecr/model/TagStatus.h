@@ -36,6 +36,11 @@ namespace TagStatusMapper
 AWS_ECR_API TagStatus GetTagStatusForName(const Aws::String& name);
 
 AWS_ECR_API Aws::String GetNameForTagStatus(TagStatus value);
+
+/**
+ * Same as GetNameForTagStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECR_API const char* GetNameForTagStatusCStr(TagStatus value);
 } // namespace TagStatusMapper
 } // namespace Model
 } // namespace ECR
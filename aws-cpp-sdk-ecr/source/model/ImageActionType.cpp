@@ -30,15 +30,30 @@ namespace Aws
       namespace ImageActionTypeMapper
       {
 
-        static const int EXPIRE_HASH = HashingUtils::HashString("EXPIRE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EXPIRE",
+        };
 
         ImageActionType GetImageActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXPIRE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ImageActionType::EXPIRE;
+          case 2059137311:
+            if (name == "EXPIRE")
+            {
+              return ImageActionType::EXPIRE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ImageActionType::NOT_SET;
         }
 
-        Aws::String GetNameForImageActionType(ImageActionType enumValue)
+        const char* GetNameForImageActionTypeCStr(ImageActionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ImageActionType::EXPIRE:
-            return "EXPIRE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForImageActionType(ImageActionType enumValue)
+        {
+          return GetNameForImageActionTypeCStr(enumValue);
         }
 
       } // namespace ImageActionTypeMapper
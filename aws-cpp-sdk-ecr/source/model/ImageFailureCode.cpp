@@ -30,35 +30,58 @@ namespace Aws
       namespace ImageFailureCodeMapper
       {
 
-        static const int InvalidImageDigest_HASH = HashingUtils::HashString("InvalidImageDigest");
-        static const int InvalidImageTag_HASH = HashingUtils::HashString("InvalidImageTag");
-        static const int ImageTagDoesNotMatchDigest_HASH = HashingUtils::HashString("ImageTagDoesNotMatchDigest");
-        static const int ImageNotFound_HASH = HashingUtils::HashString("ImageNotFound");
-        static const int MissingDigestAndTag_HASH = HashingUtils::HashString("MissingDigestAndTag");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InvalidImageDigest",
+          "InvalidImageTag",
+          "ImageTagDoesNotMatchDigest",
+          "ImageNotFound",
+          "MissingDigestAndTag",
+        };
 
         ImageFailureCode GetImageFailureCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvalidImageDigest_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ImageFailureCode::InvalidImageDigest;
-          }
-          else if (hashCode == InvalidImageTag_HASH)
-          {
-            return ImageFailureCode::InvalidImageTag;
-          }
-          else if (hashCode == ImageTagDoesNotMatchDigest_HASH)
-          {
-            return ImageFailureCode::ImageTagDoesNotMatchDigest;
-          }
-          else if (hashCode == ImageNotFound_HASH)
-          {
-            return ImageFailureCode::ImageNotFound;
-          }
-          else if (hashCode == MissingDigestAndTag_HASH)
-          {
-            return ImageFailureCode::MissingDigestAndTag;
+          case -1518082904:
+            if (name == "InvalidImageDigest")
+            {
+              return ImageFailureCode::InvalidImageDigest;
+            }
+            break;
+          case 1166443318:
+            if (name == "InvalidImageTag")
+            {
+              return ImageFailureCode::InvalidImageTag;
+            }
+            break;
+          case -812863314:
+            if (name == "ImageTagDoesNotMatchDigest")
+            {
+              return ImageFailureCode::ImageTagDoesNotMatchDigest;
+            }
+            break;
+          case -576423222:
+            if (name == "ImageNotFound")
+            {
+              return ImageFailureCode::ImageNotFound;
+            }
+            break;
+          case -384252531:
+            if (name == "MissingDigestAndTag")
+            {
+              return ImageFailureCode::MissingDigestAndTag;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ImageFailureCode::NOT_SET;
         }
 
-        Aws::String GetNameForImageFailureCode(ImageFailureCode enumValue)
+        const char* GetNameForImageFailureCodeCStr(ImageFailureCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ImageFailureCode::InvalidImageDigest:
-            return "InvalidImageDigest";
-          case ImageFailureCode::InvalidImageTag:
-            return "InvalidImageTag";
-          case ImageFailureCode::ImageTagDoesNotMatchDigest:
-            return "ImageTagDoesNotMatchDigest";
-          case ImageFailureCode::ImageNotFound:
-            return "ImageNotFound";
-          case ImageFailureCode::MissingDigestAndTag:
-            return "MissingDigestAndTag";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForImageFailureCode(ImageFailureCode enumValue)
+        {
+          return GetNameForImageFailureCodeCStr(enumValue);
         }
 
       } // namespace ImageFailureCodeMapper
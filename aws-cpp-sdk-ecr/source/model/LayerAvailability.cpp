@@ -30,20 +30,37 @@ namespace Aws
       namespace LayerAvailabilityMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int UNAVAILABLE_HASH = HashingUtils::HashString("UNAVAILABLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AVAILABLE",
+          "UNAVAILABLE",
+        };
 
         LayerAvailability GetLayerAvailabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
-          {
-            return LayerAvailability::AVAILABLE;
-          }
-          else if (hashCode == UNAVAILABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LayerAvailability::UNAVAILABLE;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return LayerAvailability::AVAILABLE;
+            }
+            break;
+          case 1487498288:
+            if (name == "UNAVAILABLE")
+            {
+              return LayerAvailability::UNAVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LayerAvailability::NOT_SET;
         }
 
-        Aws::String GetNameForLayerAvailability(LayerAvailability enumValue)
+        const char* GetNameForLayerAvailabilityCStr(LayerAvailability enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LayerAvailability::AVAILABLE:
-            return "AVAILABLE";
-          case LayerAvailability::UNAVAILABLE:
-            return "UNAVAILABLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLayerAvailability(LayerAvailability enumValue)
+        {
+          return GetNameForLayerAvailabilityCStr(enumValue);
         }
 
       } // namespace LayerAvailabilityMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace LayerFailureCodeMapper
       {
 
-        static const int InvalidLayerDigest_HASH = HashingUtils::HashString("InvalidLayerDigest");
-        static const int MissingLayerDigest_HASH = HashingUtils::HashString("MissingLayerDigest");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InvalidLayerDigest",
+          "MissingLayerDigest",
+        };
 
         LayerFailureCode GetLayerFailureCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvalidLayerDigest_HASH)
-          {
-            return LayerFailureCode::InvalidLayerDigest;
-          }
-          else if (hashCode == MissingLayerDigest_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LayerFailureCode::MissingLayerDigest;
+          case -1223049186:
+            if (name == "InvalidLayerDigest")
+            {
+              return LayerFailureCode::InvalidLayerDigest;
+            }
+            break;
+          case -53312177:
+            if (name == "MissingLayerDigest")
+            {
+              return LayerFailureCode::MissingLayerDigest;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LayerFailureCode::NOT_SET;
         }
 
-        Aws::String GetNameForLayerFailureCode(LayerFailureCode enumValue)
+        const char* GetNameForLayerFailureCodeCStr(LayerFailureCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LayerFailureCode::InvalidLayerDigest:
-            return "InvalidLayerDigest";
-          case LayerFailureCode::MissingLayerDigest:
-            return "MissingLayerDigest";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLayerFailureCode(LayerFailureCode enumValue)
+        {
+          return GetNameForLayerFailureCodeCStr(enumValue);
         }
 
       } // namespace LayerFailureCodeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace LifecyclePolicyPreviewStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETE_HASH = HashingUtils::HashString("COMPLETE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "COMPLETE",
+          "EXPIRED",
+          "FAILED",
+        };
 
         LifecyclePolicyPreviewStatus GetLifecyclePolicyPreviewStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return LifecyclePolicyPreviewStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETE_HASH)
-          {
-            return LifecyclePolicyPreviewStatus::COMPLETE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return LifecyclePolicyPreviewStatus::EXPIRED;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LifecyclePolicyPreviewStatus::FAILED;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return LifecyclePolicyPreviewStatus::IN_PROGRESS;
+            }
+            break;
+          case 183181625:
+            if (name == "COMPLETE")
+            {
+              return LifecyclePolicyPreviewStatus::COMPLETE;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return LifecyclePolicyPreviewStatus::EXPIRED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return LifecyclePolicyPreviewStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return LifecyclePolicyPreviewStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLifecyclePolicyPreviewStatus(LifecyclePolicyPreviewStatus enumValue)
+        const char* GetNameForLifecyclePolicyPreviewStatusCStr(LifecyclePolicyPreviewStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LifecyclePolicyPreviewStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case LifecyclePolicyPreviewStatus::COMPLETE:
-            return "COMPLETE";
-          case LifecyclePolicyPreviewStatus::EXPIRED:
-            return "EXPIRED";
-          case LifecyclePolicyPreviewStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLifecyclePolicyPreviewStatus(LifecyclePolicyPreviewStatus enumValue)
+        {
+          return GetNameForLifecyclePolicyPreviewStatusCStr(enumValue);
         }
 
       } // namespace LifecyclePolicyPreviewStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TagStatusMapper
       {
 
-        static const int TAGGED_HASH = HashingUtils::HashString("TAGGED");
-        static const int UNTAGGED_HASH = HashingUtils::HashString("UNTAGGED");
-        static const int ANY_HASH = HashingUtils::HashString("ANY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TAGGED",
+          "UNTAGGED",
+          "ANY",
+        };
 
         TagStatus GetTagStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TAGGED_HASH)
-          {
-            return TagStatus::TAGGED;
-          }
-          else if (hashCode == UNTAGGED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TagStatus::UNTAGGED;
-          }
-          else if (hashCode == ANY_HASH)
-          {
-            return TagStatus::ANY;
+          case -1827904148:
+            if (name == "TAGGED")
+            {
+              return TagStatus::TAGGED;
+            }
+            break;
+          case 787896645:
+            if (name == "UNTAGGED")
+            {
+              return TagStatus::UNTAGGED;
+            }
+            break;
+          case 64972:
+            if (name == "ANY")
+            {
+              return TagStatus::ANY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TagStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTagStatus(TagStatus enumValue)
+        const char* GetNameForTagStatusCStr(TagStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TagStatus::TAGGED:
-            return "TAGGED";
-          case TagStatus::UNTAGGED:
-            return "UNTAGGED";
-          case TagStatus::ANY:
-            return "ANY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTagStatus(TagStatus enumValue)
+        {
+          return GetNameForTagStatusCStr(enumValue);
         }
 
       } // namespace TagStatusMapper
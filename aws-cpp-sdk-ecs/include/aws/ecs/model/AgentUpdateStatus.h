@@ -39,6 +39,11 @@ namespace AgentUpdateStatusMapper
 AWS_ECS_API AgentUpdateStatus GetAgentUpdateStatusForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForAgentUpdateStatus(AgentUpdateStatus value);
+
+/**
+ * Same as GetNameForAgentUpdateStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForAgentUpdateStatusCStr(AgentUpdateStatus value);
 } // namespace AgentUpdateStatusMapper
 } // namespace Model
 } // namespace ECS
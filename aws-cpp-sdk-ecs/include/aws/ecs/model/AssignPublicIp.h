@@ -35,6 +35,11 @@ namespace AssignPublicIpMapper
 AWS_ECS_API AssignPublicIp GetAssignPublicIpForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForAssignPublicIp(AssignPublicIp value);
+
+/**
+ * Same as GetNameForAssignPublicIp(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForAssignPublicIpCStr(AssignPublicIp value);
 } // namespace AssignPublicIpMapper
 } // namespace Model
 } // namespace ECS
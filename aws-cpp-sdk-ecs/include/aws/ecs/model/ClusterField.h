@@ -35,6 +35,11 @@ namespace ClusterFieldMapper
 AWS_ECS_API ClusterField GetClusterFieldForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForClusterField(ClusterField value);
+
+/**
+ * Same as GetNameForClusterField(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForClusterFieldCStr(ClusterField value);
 } // namespace ClusterFieldMapper
 } // namespace Model
 } // namespace ECS
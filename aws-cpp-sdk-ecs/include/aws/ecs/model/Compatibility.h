@@ -35,6 +35,11 @@ namespace CompatibilityMapper
 AWS_ECS_API Compatibility GetCompatibilityForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForCompatibility(Compatibility value);
+
+/**
+ * Same as GetNameForCompatibility(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForCompatibilityCStr(Compatibility value);
 } // namespace CompatibilityMapper
 } // namespace Model
 } // namespace ECS
@@ -35,6 +35,11 @@ namespace ConnectivityMapper
 AWS_ECS_API Connectivity GetConnectivityForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForConnectivity(Connectivity value);
+
+/**
+ * Same as GetNameForConnectivity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForConnectivityCStr(Connectivity value);
 } // namespace ConnectivityMapper
 } // namespace Model
 } // namespace ECS
@@ -34,6 +34,11 @@ namespace ContainerInstanceFieldMapper
 AWS_ECS_API ContainerInstanceField GetContainerInstanceFieldForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForContainerInstanceField(ContainerInstanceField value);
+
+/**
+ * Same as GetNameForContainerInstanceField(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForContainerInstanceFieldCStr(ContainerInstanceField value);
 } // namespace ContainerInstanceFieldMapper
 } // namespace Model
 } // namespace ECS
@@ -35,6 +35,11 @@ namespace ContainerInstanceStatusMapper
 AWS_ECS_API ContainerInstanceStatus GetContainerInstanceStatusForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForContainerInstanceStatus(ContainerInstanceStatus value);
+
+/**
+ * Same as GetNameForContainerInstanceStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForContainerInstanceStatusCStr(ContainerInstanceStatus value);
 } // namespace ContainerInstanceStatusMapper
 } // namespace Model
 } // namespace ECS
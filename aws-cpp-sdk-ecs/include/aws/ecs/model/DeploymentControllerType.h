@@ -35,6 +35,11 @@ namespace DeploymentControllerTypeMapper
 AWS_ECS_API DeploymentControllerType GetDeploymentControllerTypeForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForDeploymentControllerType(DeploymentControllerType value);
+
+/**
+ * Same as GetNameForDeploymentControllerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForDeploymentControllerTypeCStr(DeploymentControllerType value);
 } // namespace DeploymentControllerTypeMapper
 } // namespace Model
 } // namespace ECS
@@ -36,6 +36,11 @@ namespace DesiredStatusMapper
 AWS_ECS_API DesiredStatus GetDesiredStatusForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForDesiredStatus(DesiredStatus value);
+
+/**
+ * Same as GetNameForDesiredStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForDesiredStatusCStr(DesiredStatus value);
 } // namespace DesiredStatusMapper
 } // namespace Model
 } // namespace ECS
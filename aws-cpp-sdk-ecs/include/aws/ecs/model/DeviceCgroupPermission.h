@@ -36,6 +36,11 @@ namespace DeviceCgroupPermissionMapper
 AWS_ECS_API DeviceCgroupPermission GetDeviceCgroupPermissionForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForDeviceCgroupPermission(DeviceCgroupPermission value);
+
+/**
+ * Same as GetNameForDeviceCgroupPermission(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForDeviceCgroupPermissionCStr(DeviceCgroupPermission value);
 } // namespace DeviceCgroupPermissionMapper
 } // namespace Model
 } // namespace ECS
@@ -36,6 +36,11 @@ namespace IpcModeMapper
 AWS_ECS_API IpcMode GetIpcModeForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForIpcMode(IpcMode value);
+
+/**
+ * Same as GetNameForIpcMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForIpcModeCStr(IpcMode value);
 } // namespace IpcModeMapper
 } // namespace Model
 } // namespace ECS
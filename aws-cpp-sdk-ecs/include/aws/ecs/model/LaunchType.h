@@ -35,6 +35,11 @@ namespace LaunchTypeMapper
 AWS_ECS_API LaunchType GetLaunchTypeForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForLaunchType(LaunchType value);
+
+/**
+ * Same as GetNameForLaunchType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForLaunchTypeCStr(LaunchType value);
 } // namespace LaunchTypeMapper
 } // namespace Model
 } // namespace ECS
@@ -40,6 +40,11 @@ namespace LogDriverMapper
 AWS_ECS_API LogDriver GetLogDriverForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForLogDriver(LogDriver value);
+
+/**
+ * Same as GetNameForLogDriver(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForLogDriverCStr(LogDriver value);
 } // namespace LogDriverMapper
 } // namespace Model
 } // namespace ECS
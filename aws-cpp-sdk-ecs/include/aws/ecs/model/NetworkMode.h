@@ -37,6 +37,11 @@ namespace NetworkModeMapper
 AWS_ECS_API NetworkMode GetNetworkModeForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForNetworkMode(NetworkMode value);
+
+/**
+ * Same as GetNameForNetworkMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForNetworkModeCStr(NetworkMode value);
 } // namespace NetworkModeMapper
 } // namespace Model
 } // namespace ECS
@@ -35,6 +35,11 @@ namespace PidModeMapper
 AWS_ECS_API PidMode GetPidModeForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForPidMode(PidMode value);
+
+/**
+ * Same as GetNameForPidMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForPidModeCStr(PidMode value);
 } // namespace PidModeMapper
 } // namespace Model
 } // namespace ECS
@@ -35,6 +35,11 @@ namespace PlacementConstraintTypeMapper
 AWS_ECS_API PlacementConstraintType GetPlacementConstraintTypeForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForPlacementConstraintType(PlacementConstraintType value);
+
+/**
+ * Same as GetNameForPlacementConstraintType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForPlacementConstraintTypeCStr(PlacementConstraintType value);
 } // namespace PlacementConstraintTypeMapper
 } // namespace Model
 } // namespace ECS
@@ -36,6 +36,11 @@ namespace PlacementStrategyTypeMapper
 AWS_ECS_API PlacementStrategyType GetPlacementStrategyTypeForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForPlacementStrategyType(PlacementStrategyType value);
+
+/**
+ * Same as GetNameForPlacementStrategyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForPlacementStrategyTypeCStr(PlacementStrategyType value);
 } // namespace PlacementStrategyTypeMapper
 } // namespace Model
 } // namespace ECS
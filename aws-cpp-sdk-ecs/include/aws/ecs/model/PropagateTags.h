@@ -35,6 +35,11 @@ namespace PropagateTagsMapper
 AWS_ECS_API PropagateTags GetPropagateTagsForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForPropagateTags(PropagateTags value);
+
+/**
+ * Same as GetNameForPropagateTags(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForPropagateTagsCStr(PropagateTags value);
 } // namespace PropagateTagsMapper
 } // namespace Model
 } // namespace ECS
@@ -34,6 +34,11 @@ namespace ScaleUnitMapper
 AWS_ECS_API ScaleUnit GetScaleUnitForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForScaleUnit(ScaleUnit value);
+
+/**
+ * Same as GetNameForScaleUnit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForScaleUnitCStr(ScaleUnit value);
 } // namespace ScaleUnitMapper
 } // namespace Model
 } // namespace ECS
@@ -35,6 +35,11 @@ namespace SchedulingStrategyMapper
 AWS_ECS_API SchedulingStrategy GetSchedulingStrategyForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForSchedulingStrategy(SchedulingStrategy value);
+
+/**
+ * Same as GetNameForSchedulingStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForSchedulingStrategyCStr(SchedulingStrategy value);
 } // namespace SchedulingStrategyMapper
 } // namespace Model
 } // namespace ECS
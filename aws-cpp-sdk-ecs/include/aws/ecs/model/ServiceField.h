@@ -34,6 +34,11 @@ namespace ServiceFieldMapper
 AWS_ECS_API ServiceField GetServiceFieldForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForServiceField(ServiceField value);
+
+/**
+ * Same as GetNameForServiceField(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForServiceFieldCStr(ServiceField value);
 } // namespace ServiceFieldMapper
 } // namespace Model
 } // namespace ECS
@@ -36,6 +36,11 @@ namespace SettingNameMapper
 AWS_ECS_API SettingName GetSettingNameForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForSettingName(SettingName value);
+
+/**
+ * Same as GetNameForSettingName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForSettingNameCStr(SettingName value);
 } // namespace SettingNameMapper
 } // namespace Model
 } // namespace ECS
@@ -35,6 +35,11 @@ namespace SortOrderMapper
 AWS_ECS_API SortOrder GetSortOrderForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForSortOrder(SortOrder value);
+
+/**
+ * Same as GetNameForSortOrder(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForSortOrderCStr(SortOrder value);
 } // namespace SortOrderMapper
 } // namespace Model
 } // namespace ECS
@@ -35,6 +35,11 @@ namespace StabilityStatusMapper
 AWS_ECS_API StabilityStatus GetStabilityStatusForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForStabilityStatus(StabilityStatus value);
+
+/**
+ * Same as GetNameForStabilityStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForStabilityStatusCStr(StabilityStatus value);
 } // namespace StabilityStatusMapper
 } // namespace Model
 } // namespace ECS
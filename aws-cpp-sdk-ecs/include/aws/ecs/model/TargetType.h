@@ -34,6 +34,11 @@ namespace TargetTypeMapper
 AWS_ECS_API TargetType GetTargetTypeForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForTargetType(TargetType value);
+
+/**
+ * Same as GetNameForTargetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForTargetTypeCStr(TargetType value);
 } // namespace TargetTypeMapper
 } // namespace Model
 } // namespace ECS
@@ -36,6 +36,11 @@ namespace TaskDefinitionFamilyStatusMapper
 AWS_ECS_API TaskDefinitionFamilyStatus GetTaskDefinitionFamilyStatusForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForTaskDefinitionFamilyStatus(TaskDefinitionFamilyStatus value);
+
+/**
+ * Same as GetNameForTaskDefinitionFamilyStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForTaskDefinitionFamilyStatusCStr(TaskDefinitionFamilyStatus value);
 } // namespace TaskDefinitionFamilyStatusMapper
 } // namespace Model
 } // namespace ECS
@@ -34,6 +34,11 @@ namespace TaskDefinitionFieldMapper
 AWS_ECS_API TaskDefinitionField GetTaskDefinitionFieldForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForTaskDefinitionField(TaskDefinitionField value);
+
+/**
+ * Same as GetNameForTaskDefinitionField(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForTaskDefinitionFieldCStr(TaskDefinitionField value);
 } // namespace TaskDefinitionFieldMapper
 } // namespace Model
 } // namespace ECS
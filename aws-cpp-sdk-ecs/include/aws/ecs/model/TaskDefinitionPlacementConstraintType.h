@@ -34,6 +34,11 @@ namespace TaskDefinitionPlacementConstraintTypeMapper
 AWS_ECS_API TaskDefinitionPlacementConstraintType GetTaskDefinitionPlacementConstraintTypeForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForTaskDefinitionPlacementConstraintType(TaskDefinitionPlacementConstraintType value);
+
+/**
+ * Same as GetNameForTaskDefinitionPlacementConstraintType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForTaskDefinitionPlacementConstraintTypeCStr(TaskDefinitionPlacementConstraintType value);
 } // namespace TaskDefinitionPlacementConstraintTypeMapper
 } // namespace Model
 } // namespace ECS
@@ -35,6 +35,11 @@ namespace TaskDefinitionStatusMapper
 AWS_ECS_API TaskDefinitionStatus GetTaskDefinitionStatusForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForTaskDefinitionStatus(TaskDefinitionStatus value);
+
+/**
+ * Same as GetNameForTaskDefinitionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForTaskDefinitionStatusCStr(TaskDefinitionStatus value);
 } // namespace TaskDefinitionStatusMapper
 } // namespace Model
 } // namespace ECS
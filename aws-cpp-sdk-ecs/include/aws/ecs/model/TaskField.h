@@ -34,6 +34,11 @@ namespace TaskFieldMapper
 AWS_ECS_API TaskField GetTaskFieldForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForTaskField(TaskField value);
+
+/**
+ * Same as GetNameForTaskField(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForTaskFieldCStr(TaskField value);
 } // namespace TaskFieldMapper
 } // namespace Model
 } // namespace ECS
@@ -36,6 +36,11 @@ namespace TaskStopCodeMapper
 AWS_ECS_API TaskStopCode GetTaskStopCodeForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForTaskStopCode(TaskStopCode value);
+
+/**
+ * Same as GetNameForTaskStopCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForTaskStopCodeCStr(TaskStopCode value);
 } // namespace TaskStopCodeMapper
 } // namespace Model
 } // namespace ECS
@@ -35,6 +35,11 @@ namespace TransportProtocolMapper
 AWS_ECS_API TransportProtocol GetTransportProtocolForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForTransportProtocol(TransportProtocol value);
+
+/**
+ * Same as GetNameForTransportProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForTransportProtocolCStr(TransportProtocol value);
 } // namespace TransportProtocolMapper
 } // namespace Model
 } // namespace ECS
@@ -48,6 +48,11 @@ namespace UlimitNameMapper
 AWS_ECS_API UlimitName GetUlimitNameForName(const Aws::String& name);
 
 AWS_ECS_API Aws::String GetNameForUlimitName(UlimitName value);
+
+/**
+ * Same as GetNameForUlimitName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ECS_API const char* GetNameForUlimitNameCStr(UlimitName value);
 } // namespace UlimitNameMapper
 } // namespace Model
 } // namespace ECS
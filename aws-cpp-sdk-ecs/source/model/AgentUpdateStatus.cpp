@@ -30,40 +30,65 @@ namespace Aws
       namespace AgentUpdateStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int STAGING_HASH = HashingUtils::HashString("STAGING");
-        static const int STAGED_HASH = HashingUtils::HashString("STAGED");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int UPDATED_HASH = HashingUtils::HashString("UPDATED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "STAGING",
+          "STAGED",
+          "UPDATING",
+          "UPDATED",
+          "FAILED",
+        };
 
         AgentUpdateStatus GetAgentUpdateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return AgentUpdateStatus::PENDING;
-          }
-          else if (hashCode == STAGING_HASH)
-          {
-            return AgentUpdateStatus::STAGING;
-          }
-          else if (hashCode == STAGED_HASH)
-          {
-            return AgentUpdateStatus::STAGED;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return AgentUpdateStatus::UPDATING;
-          }
-          else if (hashCode == UPDATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AgentUpdateStatus::UPDATED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AgentUpdateStatus::FAILED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return AgentUpdateStatus::PENDING;
+            }
+            break;
+          case -1179540453:
+            if (name == "STAGING")
+            {
+              return AgentUpdateStatus::STAGING;
+            }
+            break;
+          case -1839165146:
+            if (name == "STAGED")
+            {
+              return AgentUpdateStatus::STAGED;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return AgentUpdateStatus::UPDATING;
+            }
+            break;
+          case 483552411:
+            if (name == "UPDATED")
+            {
+              return AgentUpdateStatus::UPDATED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return AgentUpdateStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return AgentUpdateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAgentUpdateStatus(AgentUpdateStatus enumValue)
+        const char* GetNameForAgentUpdateStatusCStr(AgentUpdateStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AgentUpdateStatus::PENDING:
-            return "PENDING";
-          case AgentUpdateStatus::STAGING:
-            return "STAGING";
-          case AgentUpdateStatus::STAGED:
-            return "STAGED";
-          case AgentUpdateStatus::UPDATING:
-            return "UPDATING";
-          case AgentUpdateStatus::UPDATED:
-            return "UPDATED";
-          case AgentUpdateStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAgentUpdateStatus(AgentUpdateStatus enumValue)
+        {
+          return GetNameForAgentUpdateStatusCStr(enumValue);
         }
 
       } // namespace AgentUpdateStatusMapper
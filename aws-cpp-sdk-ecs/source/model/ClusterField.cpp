@@ -30,20 +30,37 @@ namespace Aws
       namespace ClusterFieldMapper
       {
 
-        static const int STATISTICS_HASH = HashingUtils::HashString("STATISTICS");
-        static const int TAGS_HASH = HashingUtils::HashString("TAGS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STATISTICS",
+          "TAGS",
+        };
 
         ClusterField GetClusterFieldForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STATISTICS_HASH)
-          {
-            return ClusterField::STATISTICS;
-          }
-          else if (hashCode == TAGS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClusterField::TAGS;
+          case 390503715:
+            if (name == "STATISTICS")
+            {
+              return ClusterField::STATISTICS;
+            }
+            break;
+          case 2567193:
+            if (name == "TAGS")
+            {
+              return ClusterField::TAGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ClusterField::NOT_SET;
         }
 
-        Aws::String GetNameForClusterField(ClusterField enumValue)
+        const char* GetNameForClusterFieldCStr(ClusterField enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClusterField::STATISTICS:
-            return "STATISTICS";
-          case ClusterField::TAGS:
-            return "TAGS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClusterField(ClusterField enumValue)
+        {
+          return GetNameForClusterFieldCStr(enumValue);
         }
 
       } // namespace ClusterFieldMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CompatibilityMapper
       {
 
-        static const int EC2_HASH = HashingUtils::HashString("EC2");
-        static const int FARGATE_HASH = HashingUtils::HashString("FARGATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EC2",
+          "FARGATE",
+        };
 
         Compatibility GetCompatibilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EC2_HASH)
-          {
-            return Compatibility::EC2;
-          }
-          else if (hashCode == FARGATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Compatibility::FARGATE;
+          case 68436:
+            if (name == "EC2")
+            {
+              return Compatibility::EC2;
+            }
+            break;
+          case -360447934:
+            if (name == "FARGATE")
+            {
+              return Compatibility::FARGATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Compatibility::NOT_SET;
         }
 
-        Aws::String GetNameForCompatibility(Compatibility enumValue)
+        const char* GetNameForCompatibilityCStr(Compatibility enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Compatibility::EC2:
-            return "EC2";
-          case Compatibility::FARGATE:
-            return "FARGATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCompatibility(Compatibility enumValue)
+        {
+          return GetNameForCompatibilityCStr(enumValue);
         }
 
       } // namespace CompatibilityMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ConnectivityMapper
       {
 
-        static const int CONNECTED_HASH = HashingUtils::HashString("CONNECTED");
-        static const int DISCONNECTED_HASH = HashingUtils::HashString("DISCONNECTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONNECTED",
+          "DISCONNECTED",
+        };
 
         Connectivity GetConnectivityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONNECTED_HASH)
-          {
-            return Connectivity::CONNECTED;
-          }
-          else if (hashCode == DISCONNECTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Connectivity::DISCONNECTED;
+          case -2087582999:
+            if (name == "CONNECTED")
+            {
+              return Connectivity::CONNECTED;
+            }
+            break;
+          case 935892539:
+            if (name == "DISCONNECTED")
+            {
+              return Connectivity::DISCONNECTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Connectivity::NOT_SET;
         }
 
-        Aws::String GetNameForConnectivity(Connectivity enumValue)
+        const char* GetNameForConnectivityCStr(Connectivity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Connectivity::CONNECTED:
-            return "CONNECTED";
-          case Connectivity::DISCONNECTED:
-            return "DISCONNECTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectivity(Connectivity enumValue)
+        {
+          return GetNameForConnectivityCStr(enumValue);
         }
 
       } // namespace ConnectivityMapper
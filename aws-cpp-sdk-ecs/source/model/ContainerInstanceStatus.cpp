@@ -30,20 +30,37 @@ namespace Aws
       namespace ContainerInstanceStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DRAINING_HASH = HashingUtils::HashString("DRAINING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "DRAINING",
+        };
 
         ContainerInstanceStatus GetContainerInstanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return ContainerInstanceStatus::ACTIVE;
-          }
-          else if (hashCode == DRAINING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContainerInstanceStatus::DRAINING;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ContainerInstanceStatus::ACTIVE;
+            }
+            break;
+          case -56415510:
+            if (name == "DRAINING")
+            {
+              return ContainerInstanceStatus::DRAINING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ContainerInstanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForContainerInstanceStatus(ContainerInstanceStatus enumValue)
+        const char* GetNameForContainerInstanceStatusCStr(ContainerInstanceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContainerInstanceStatus::ACTIVE:
-            return "ACTIVE";
-          case ContainerInstanceStatus::DRAINING:
-            return "DRAINING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContainerInstanceStatus(ContainerInstanceStatus enumValue)
+        {
+          return GetNameForContainerInstanceStatusCStr(enumValue);
         }
 
       } // namespace ContainerInstanceStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DeploymentControllerTypeMapper
       {
 
-        static const int ECS_HASH = HashingUtils::HashString("ECS");
-        static const int CODE_DEPLOY_HASH = HashingUtils::HashString("CODE_DEPLOY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ECS",
+          "CODE_DEPLOY",
+        };
 
         DeploymentControllerType GetDeploymentControllerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ECS_HASH)
-          {
-            return DeploymentControllerType::ECS;
-          }
-          else if (hashCode == CODE_DEPLOY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentControllerType::CODE_DEPLOY;
+          case 68469:
+            if (name == "ECS")
+            {
+              return DeploymentControllerType::ECS;
+            }
+            break;
+          case -707876999:
+            if (name == "CODE_DEPLOY")
+            {
+              return DeploymentControllerType::CODE_DEPLOY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeploymentControllerType::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentControllerType(DeploymentControllerType enumValue)
+        const char* GetNameForDeploymentControllerTypeCStr(DeploymentControllerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentControllerType::ECS:
-            return "ECS";
-          case DeploymentControllerType::CODE_DEPLOY:
-            return "CODE_DEPLOY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentControllerType(DeploymentControllerType enumValue)
+        {
+          return GetNameForDeploymentControllerTypeCStr(enumValue);
         }
 
       } // namespace DeploymentControllerTypeMapper
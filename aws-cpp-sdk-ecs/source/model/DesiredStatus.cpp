@@ -30,25 +30,44 @@ namespace Aws
       namespace DesiredStatusMapper
       {
 
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RUNNING",
+          "PENDING",
+          "STOPPED",
+        };
 
         DesiredStatus GetDesiredStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RUNNING_HASH)
-          {
-            return DesiredStatus::RUNNING;
-          }
-          else if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DesiredStatus::PENDING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return DesiredStatus::STOPPED;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return DesiredStatus::RUNNING;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return DesiredStatus::PENDING;
+            }
+            break;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return DesiredStatus::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DesiredStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDesiredStatus(DesiredStatus enumValue)
+        const char* GetNameForDesiredStatusCStr(DesiredStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DesiredStatus::RUNNING:
-            return "RUNNING";
-          case DesiredStatus::PENDING:
-            return "PENDING";
-          case DesiredStatus::STOPPED:
-            return "STOPPED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDesiredStatus(DesiredStatus enumValue)
+        {
+          return GetNameForDesiredStatusCStr(enumValue);
         }
 
       } // namespace DesiredStatusMapper
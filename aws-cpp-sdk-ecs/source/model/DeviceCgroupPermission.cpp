@@ -30,25 +30,44 @@ namespace Aws
       namespace DeviceCgroupPermissionMapper
       {
 
-        static const int read_HASH = HashingUtils::HashString("read");
-        static const int write_HASH = HashingUtils::HashString("write");
-        static const int mknod_HASH = HashingUtils::HashString("mknod");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "read",
+          "write",
+          "mknod",
+        };
 
         DeviceCgroupPermission GetDeviceCgroupPermissionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == read_HASH)
-          {
-            return DeviceCgroupPermission::read;
-          }
-          else if (hashCode == write_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeviceCgroupPermission::write;
-          }
-          else if (hashCode == mknod_HASH)
-          {
-            return DeviceCgroupPermission::mknod;
+          case 3496342:
+            if (name == "read")
+            {
+              return DeviceCgroupPermission::read;
+            }
+            break;
+          case 113399775:
+            if (name == "write")
+            {
+              return DeviceCgroupPermission::write;
+            }
+            break;
+          case 103960677:
+            if (name == "mknod")
+            {
+              return DeviceCgroupPermission::mknod;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DeviceCgroupPermission::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceCgroupPermission(DeviceCgroupPermission enumValue)
+        const char* GetNameForDeviceCgroupPermissionCStr(DeviceCgroupPermission enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeviceCgroupPermission::read:
-            return "read";
-          case DeviceCgroupPermission::write:
-            return "write";
-          case DeviceCgroupPermission::mknod:
-            return "mknod";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeviceCgroupPermission(DeviceCgroupPermission enumValue)
+        {
+          return GetNameForDeviceCgroupPermissionCStr(enumValue);
         }
 
       } // namespace DeviceCgroupPermissionMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace IpcModeMapper
       {
 
-        static const int host_HASH = HashingUtils::HashString("host");
-        static const int task_HASH = HashingUtils::HashString("task");
-        static const int none_HASH = HashingUtils::HashString("none");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "host",
+          "task",
+          "none",
+        };
 
         IpcMode GetIpcModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == host_HASH)
-          {
-            return IpcMode::host;
-          }
-          else if (hashCode == task_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IpcMode::task;
-          }
-          else if (hashCode == none_HASH)
-          {
-            return IpcMode::none;
+          case 3208616:
+            if (name == "host")
+            {
+              return IpcMode::host;
+            }
+            break;
+          case 3552645:
+            if (name == "task")
+            {
+              return IpcMode::task;
+            }
+            break;
+          case 3387192:
+            if (name == "none")
+            {
+              return IpcMode::none;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return IpcMode::NOT_SET;
         }
 
-        Aws::String GetNameForIpcMode(IpcMode enumValue)
+        const char* GetNameForIpcModeCStr(IpcMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IpcMode::host:
-            return "host";
-          case IpcMode::task:
-            return "task";
-          case IpcMode::none:
-            return "none";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIpcMode(IpcMode enumValue)
+        {
+          return GetNameForIpcModeCStr(enumValue);
         }
 
       } // namespace IpcModeMapper
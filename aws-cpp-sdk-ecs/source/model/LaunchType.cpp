@@ -30,20 +30,37 @@ namespace Aws
       namespace LaunchTypeMapper
       {
 
-        static const int EC2_HASH = HashingUtils::HashString("EC2");
-        static const int FARGATE_HASH = HashingUtils::HashString("FARGATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EC2",
+          "FARGATE",
+        };
 
         LaunchType GetLaunchTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EC2_HASH)
-          {
-            return LaunchType::EC2;
-          }
-          else if (hashCode == FARGATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LaunchType::FARGATE;
+          case 68436:
+            if (name == "EC2")
+            {
+              return LaunchType::EC2;
+            }
+            break;
+          case -360447934:
+            if (name == "FARGATE")
+            {
+              return LaunchType::FARGATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LaunchType::NOT_SET;
         }
 
-        Aws::String GetNameForLaunchType(LaunchType enumValue)
+        const char* GetNameForLaunchTypeCStr(LaunchType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LaunchType::EC2:
-            return "EC2";
-          case LaunchType::FARGATE:
-            return "FARGATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLaunchType(LaunchType enumValue)
+        {
+          return GetNameForLaunchTypeCStr(enumValue);
         }
 
       } // namespace LaunchTypeMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace LogDriverMapper
       {
 
-        static const int json_file_HASH = HashingUtils::HashString("json-file");
-        static const int syslog_HASH = HashingUtils::HashString("syslog");
-        static const int journald_HASH = HashingUtils::HashString("journald");
-        static const int gelf_HASH = HashingUtils::HashString("gelf");
-        static const int fluentd_HASH = HashingUtils::HashString("fluentd");
-        static const int awslogs_HASH = HashingUtils::HashString("awslogs");
-        static const int splunk_HASH = HashingUtils::HashString("splunk");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "json-file",
+          "syslog",
+          "journald",
+          "gelf",
+          "fluentd",
+          "awslogs",
+          "splunk",
+        };
 
         LogDriver GetLogDriverForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == json_file_HASH)
-          {
-            return LogDriver::json_file;
-          }
-          else if (hashCode == syslog_HASH)
-          {
-            return LogDriver::syslog;
-          }
-          else if (hashCode == journald_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LogDriver::journald;
-          }
-          else if (hashCode == gelf_HASH)
-          {
-            return LogDriver::gelf;
-          }
-          else if (hashCode == fluentd_HASH)
-          {
-            return LogDriver::fluentd;
-          }
-          else if (hashCode == awslogs_HASH)
-          {
-            return LogDriver::awslogs;
-          }
-          else if (hashCode == splunk_HASH)
-          {
-            return LogDriver::splunk;
+          case -1129317567:
+            if (name == "json-file")
+            {
+              return LogDriver::json_file;
+            }
+            break;
+          case -887335593:
+            if (name == "syslog")
+            {
+              return LogDriver::syslog;
+            }
+            break;
+          case -1053738995:
+            if (name == "journald")
+            {
+              return LogDriver::journald;
+            }
+            break;
+          case 3168984:
+            if (name == "gelf")
+            {
+              return LogDriver::gelf;
+            }
+            break;
+          case -760786488:
+            if (name == "fluentd")
+            {
+              return LogDriver::fluentd;
+            }
+            break;
+          case -590054868:
+            if (name == "awslogs")
+            {
+              return LogDriver::awslogs;
+            }
+            break;
+          case -895847197:
+            if (name == "splunk")
+            {
+              return LogDriver::splunk;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return LogDriver::NOT_SET;
         }
 
-        Aws::String GetNameForLogDriver(LogDriver enumValue)
+        const char* GetNameForLogDriverCStr(LogDriver enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LogDriver::json_file:
-            return "json-file";
-          case LogDriver::syslog:
-            return "syslog";
-          case LogDriver::journald:
-            return "journald";
-          case LogDriver::gelf:
-            return "gelf";
-          case LogDriver::fluentd:
-            return "fluentd";
-          case LogDriver::awslogs:
-            return "awslogs";
-          case LogDriver::splunk:
-            return "splunk";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLogDriver(LogDriver enumValue)
+        {
+          return GetNameForLogDriverCStr(enumValue);
         }
 
       } // namespace LogDriverMapper
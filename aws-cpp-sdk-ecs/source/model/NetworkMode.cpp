@@ -30,30 +30,51 @@ namespace Aws
       namespace NetworkModeMapper
       {
 
-        static const int bridge_HASH = HashingUtils::HashString("bridge");
-        static const int host_HASH = HashingUtils::HashString("host");
-        static const int awsvpc_HASH = HashingUtils::HashString("awsvpc");
-        static const int none_HASH = HashingUtils::HashString("none");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "bridge",
+          "host",
+          "awsvpc",
+          "none",
+        };
 
         NetworkMode GetNetworkModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == bridge_HASH)
-          {
-            return NetworkMode::bridge;
-          }
-          else if (hashCode == host_HASH)
-          {
-            return NetworkMode::host;
-          }
-          else if (hashCode == awsvpc_HASH)
-          {
-            return NetworkMode::awsvpc;
-          }
-          else if (hashCode == none_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NetworkMode::none;
+          case -1380801655:
+            if (name == "bridge")
+            {
+              return NetworkMode::bridge;
+            }
+            break;
+          case 3208616:
+            if (name == "host")
+            {
+              return NetworkMode::host;
+            }
+            break;
+          case -1404497716:
+            if (name == "awsvpc")
+            {
+              return NetworkMode::awsvpc;
+            }
+            break;
+          case 3387192:
+            if (name == "none")
+            {
+              return NetworkMode::none;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return NetworkMode::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkMode(NetworkMode enumValue)
+        const char* GetNameForNetworkModeCStr(NetworkMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NetworkMode::bridge:
-            return "bridge";
-          case NetworkMode::host:
-            return "host";
-          case NetworkMode::awsvpc:
-            return "awsvpc";
-          case NetworkMode::none:
-            return "none";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNetworkMode(NetworkMode enumValue)
+        {
+          return GetNameForNetworkModeCStr(enumValue);
         }
 
       } // namespace NetworkModeMapper
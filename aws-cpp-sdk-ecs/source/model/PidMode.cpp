@@ -30,20 +30,37 @@ namespace Aws
       namespace PidModeMapper
       {
 
-        static const int host_HASH = HashingUtils::HashString("host");
-        static const int task_HASH = HashingUtils::HashString("task");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "host",
+          "task",
+        };
 
         PidMode GetPidModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == host_HASH)
-          {
-            return PidMode::host;
-          }
-          else if (hashCode == task_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PidMode::task;
+          case 3208616:
+            if (name == "host")
+            {
+              return PidMode::host;
+            }
+            break;
+          case 3552645:
+            if (name == "task")
+            {
+              return PidMode::task;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PidMode::NOT_SET;
         }
 
-        Aws::String GetNameForPidMode(PidMode enumValue)
+        const char* GetNameForPidModeCStr(PidMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PidMode::host:
-            return "host";
-          case PidMode::task:
-            return "task";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPidMode(PidMode enumValue)
+        {
+          return GetNameForPidModeCStr(enumValue);
         }
 
       } // namespace PidModeMapper
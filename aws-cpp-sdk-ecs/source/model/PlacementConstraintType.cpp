@@ -30,20 +30,37 @@ namespace Aws
       namespace PlacementConstraintTypeMapper
       {
 
-        static const int distinctInstance_HASH = HashingUtils::HashString("distinctInstance");
-        static const int memberOf_HASH = HashingUtils::HashString("memberOf");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "distinctInstance",
+          "memberOf",
+        };
 
         PlacementConstraintType GetPlacementConstraintTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == distinctInstance_HASH)
-          {
-            return PlacementConstraintType::distinctInstance;
-          }
-          else if (hashCode == memberOf_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlacementConstraintType::memberOf;
+          case 1886743473:
+            if (name == "distinctInstance")
+            {
+              return PlacementConstraintType::distinctInstance;
+            }
+            break;
+          case -649439727:
+            if (name == "memberOf")
+            {
+              return PlacementConstraintType::memberOf;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PlacementConstraintType::NOT_SET;
         }
 
-        Aws::String GetNameForPlacementConstraintType(PlacementConstraintType enumValue)
+        const char* GetNameForPlacementConstraintTypeCStr(PlacementConstraintType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlacementConstraintType::distinctInstance:
-            return "distinctInstance";
-          case PlacementConstraintType::memberOf:
-            return "memberOf";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlacementConstraintType(PlacementConstraintType enumValue)
+        {
+          return GetNameForPlacementConstraintTypeCStr(enumValue);
         }
 
       } // namespace PlacementConstraintTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PlacementStrategyTypeMapper
       {
 
-        static const int random_HASH = HashingUtils::HashString("random");
-        static const int spread_HASH = HashingUtils::HashString("spread");
-        static const int binpack_HASH = HashingUtils::HashString("binpack");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "random",
+          "spread",
+          "binpack",
+        };
 
         PlacementStrategyType GetPlacementStrategyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == random_HASH)
-          {
-            return PlacementStrategyType::random;
-          }
-          else if (hashCode == spread_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlacementStrategyType::spread;
-          }
-          else if (hashCode == binpack_HASH)
-          {
-            return PlacementStrategyType::binpack;
+          case -938285885:
+            if (name == "random")
+            {
+              return PlacementStrategyType::random;
+            }
+            break;
+          case -895684237:
+            if (name == "spread")
+            {
+              return PlacementStrategyType::spread;
+            }
+            break;
+          case -107871328:
+            if (name == "binpack")
+            {
+              return PlacementStrategyType::binpack;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PlacementStrategyType::NOT_SET;
         }
 
-        Aws::String GetNameForPlacementStrategyType(PlacementStrategyType enumValue)
+        const char* GetNameForPlacementStrategyTypeCStr(PlacementStrategyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlacementStrategyType::random:
-            return "random";
-          case PlacementStrategyType::spread:
-            return "spread";
-          case PlacementStrategyType::binpack:
-            return "binpack";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlacementStrategyType(PlacementStrategyType enumValue)
+        {
+          return GetNameForPlacementStrategyTypeCStr(enumValue);
         }
 
       } // namespace PlacementStrategyTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PropagateTagsMapper
       {
 
-        static const int TASK_DEFINITION_HASH = HashingUtils::HashString("TASK_DEFINITION");
-        static const int SERVICE_HASH = HashingUtils::HashString("SERVICE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TASK_DEFINITION",
+          "SERVICE",
+        };
 
         PropagateTags GetPropagateTagsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TASK_DEFINITION_HASH)
-          {
-            return PropagateTags::TASK_DEFINITION;
-          }
-          else if (hashCode == SERVICE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PropagateTags::SERVICE;
+          case -1943595955:
+            if (name == "TASK_DEFINITION")
+            {
+              return PropagateTags::TASK_DEFINITION;
+            }
+            break;
+          case -1592831339:
+            if (name == "SERVICE")
+            {
+              return PropagateTags::SERVICE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PropagateTags::NOT_SET;
         }
 
-        Aws::String GetNameForPropagateTags(PropagateTags enumValue)
+        const char* GetNameForPropagateTagsCStr(PropagateTags enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PropagateTags::TASK_DEFINITION:
-            return "TASK_DEFINITION";
-          case PropagateTags::SERVICE:
-            return "SERVICE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPropagateTags(PropagateTags enumValue)
+        {
+          return GetNameForPropagateTagsCStr(enumValue);
         }
 
       } // namespace PropagateTagsMapper
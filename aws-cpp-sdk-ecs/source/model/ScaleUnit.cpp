@@ -30,15 +30,30 @@ namespace Aws
       namespace ScaleUnitMapper
       {
 
-        static const int PERCENT_HASH = HashingUtils::HashString("PERCENT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PERCENT",
+        };
 
         ScaleUnit GetScaleUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PERCENT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScaleUnit::PERCENT;
+          case 39055397:
+            if (name == "PERCENT")
+            {
+              return ScaleUnit::PERCENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ScaleUnit::NOT_SET;
         }
 
-        Aws::String GetNameForScaleUnit(ScaleUnit enumValue)
+        const char* GetNameForScaleUnitCStr(ScaleUnit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScaleUnit::PERCENT:
-            return "PERCENT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScaleUnit(ScaleUnit enumValue)
+        {
+          return GetNameForScaleUnitCStr(enumValue);
         }
 
       } // namespace ScaleUnitMapper
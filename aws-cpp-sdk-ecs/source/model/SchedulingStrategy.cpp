@@ -30,20 +30,37 @@ namespace Aws
       namespace SchedulingStrategyMapper
       {
 
-        static const int REPLICA_HASH = HashingUtils::HashString("REPLICA");
-        static const int DAEMON_HASH = HashingUtils::HashString("DAEMON");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REPLICA",
+          "DAEMON",
+        };
 
         SchedulingStrategy GetSchedulingStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REPLICA_HASH)
-          {
-            return SchedulingStrategy::REPLICA;
-          }
-          else if (hashCode == DAEMON_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SchedulingStrategy::DAEMON;
+          case 1812487320:
+            if (name == "REPLICA")
+            {
+              return SchedulingStrategy::REPLICA;
+            }
+            break;
+          case 2008943236:
+            if (name == "DAEMON")
+            {
+              return SchedulingStrategy::DAEMON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SchedulingStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForSchedulingStrategy(SchedulingStrategy enumValue)
+        const char* GetNameForSchedulingStrategyCStr(SchedulingStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SchedulingStrategy::REPLICA:
-            return "REPLICA";
-          case SchedulingStrategy::DAEMON:
-            return "DAEMON";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSchedulingStrategy(SchedulingStrategy enumValue)
+        {
+          return GetNameForSchedulingStrategyCStr(enumValue);
         }
 
       } // namespace SchedulingStrategyMapper
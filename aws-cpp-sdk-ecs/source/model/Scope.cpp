@@ -30,20 +30,37 @@ namespace Aws
       namespace ScopeMapper
       {
 
-        static const int task_HASH = HashingUtils::HashString("task");
-        static const int shared_HASH = HashingUtils::HashString("shared");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "task",
+          "shared",
+        };
 
         Scope GetScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == task_HASH)
-          {
-            return Scope::task;
-          }
-          else if (hashCode == shared_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Scope::shared;
+          case 3552645:
+            if (name == "task")
+            {
+              return Scope::task;
+            }
+            break;
+          case -903566235:
+            if (name == "shared")
+            {
+              return Scope::shared;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Scope::NOT_SET;
         }
 
-        Aws::String GetNameForScope(Scope enumValue)
+        const char* GetNameForScopeCStr(Scope enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Scope::task:
-            return "task";
-          case Scope::shared:
-            return "shared";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScope(Scope enumValue)
+        {
+          return GetNameForScopeCStr(enumValue);
         }
 
       } // namespace ScopeMapper
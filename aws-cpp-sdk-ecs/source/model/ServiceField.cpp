@@ -30,15 +30,30 @@ namespace Aws
       namespace ServiceFieldMapper
       {
 
-        static const int TAGS_HASH = HashingUtils::HashString("TAGS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TAGS",
+        };
 
         ServiceField GetServiceFieldForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TAGS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServiceField::TAGS;
+          case 2567193:
+            if (name == "TAGS")
+            {
+              return ServiceField::TAGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ServiceField::NOT_SET;
         }
 
-        Aws::String GetNameForServiceField(ServiceField enumValue)
+        const char* GetNameForServiceFieldCStr(ServiceField enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServiceField::TAGS:
-            return "TAGS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServiceField(ServiceField enumValue)
+        {
+          return GetNameForServiceFieldCStr(enumValue);
         }
 
       } // namespace ServiceFieldMapper
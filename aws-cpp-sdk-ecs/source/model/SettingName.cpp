@@ -30,25 +30,44 @@ namespace Aws
       namespace SettingNameMapper
       {
 
-        static const int serviceLongArnFormat_HASH = HashingUtils::HashString("serviceLongArnFormat");
-        static const int taskLongArnFormat_HASH = HashingUtils::HashString("taskLongArnFormat");
-        static const int containerInstanceLongArnFormat_HASH = HashingUtils::HashString("containerInstanceLongArnFormat");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "serviceLongArnFormat",
+          "taskLongArnFormat",
+          "containerInstanceLongArnFormat",
+        };
 
         SettingName GetSettingNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == serviceLongArnFormat_HASH)
-          {
-            return SettingName::serviceLongArnFormat;
-          }
-          else if (hashCode == taskLongArnFormat_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SettingName::taskLongArnFormat;
-          }
-          else if (hashCode == containerInstanceLongArnFormat_HASH)
-          {
-            return SettingName::containerInstanceLongArnFormat;
+          case -747372317:
+            if (name == "serviceLongArnFormat")
+            {
+              return SettingName::serviceLongArnFormat;
+            }
+            break;
+          case 1402479635:
+            if (name == "taskLongArnFormat")
+            {
+              return SettingName::taskLongArnFormat;
+            }
+            break;
+          case 1999719682:
+            if (name == "containerInstanceLongArnFormat")
+            {
+              return SettingName::containerInstanceLongArnFormat;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SettingName::NOT_SET;
         }
 
-        Aws::String GetNameForSettingName(SettingName enumValue)
+        const char* GetNameForSettingNameCStr(SettingName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SettingName::serviceLongArnFormat:
-            return "serviceLongArnFormat";
-          case SettingName::taskLongArnFormat:
-            return "taskLongArnFormat";
-          case SettingName::containerInstanceLongArnFormat:
-            return "containerInstanceLongArnFormat";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSettingName(SettingName enumValue)
+        {
+          return GetNameForSettingNameCStr(enumValue);
         }
 
       } // namespace SettingNameMapper
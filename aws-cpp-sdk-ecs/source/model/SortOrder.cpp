@@ -30,20 +30,37 @@ namespace Aws
       namespace SortOrderMapper
       {
 
-        static const int ASC_HASH = HashingUtils::HashString("ASC");
-        static const int DESC_HASH = HashingUtils::HashString("DESC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ASC",
+          "DESC",
+        };
 
         SortOrder GetSortOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASC_HASH)
-          {
-            return SortOrder::ASC;
-          }
-          else if (hashCode == DESC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SortOrder::DESC;
+          case 65105:
+            if (name == "ASC")
+            {
+              return SortOrder::ASC;
+            }
+            break;
+          case 2094737:
+            if (name == "DESC")
+            {
+              return SortOrder::DESC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SortOrder::NOT_SET;
         }
 
-        Aws::String GetNameForSortOrder(SortOrder enumValue)
+        const char* GetNameForSortOrderCStr(SortOrder enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SortOrder::ASC:
-            return "ASC";
-          case SortOrder::DESC:
-            return "DESC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSortOrder(SortOrder enumValue)
+        {
+          return GetNameForSortOrderCStr(enumValue);
         }
 
       } // namespace SortOrderMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace StabilityStatusMapper
       {
 
-        static const int STEADY_STATE_HASH = HashingUtils::HashString("STEADY_STATE");
-        static const int STABILIZING_HASH = HashingUtils::HashString("STABILIZING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STEADY_STATE",
+          "STABILIZING",
+        };
 
         StabilityStatus GetStabilityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STEADY_STATE_HASH)
-          {
-            return StabilityStatus::STEADY_STATE;
-          }
-          else if (hashCode == STABILIZING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StabilityStatus::STABILIZING;
+          case 2038343172:
+            if (name == "STEADY_STATE")
+            {
+              return StabilityStatus::STEADY_STATE;
+            }
+            break;
+          case 1999814956:
+            if (name == "STABILIZING")
+            {
+              return StabilityStatus::STABILIZING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return StabilityStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStabilityStatus(StabilityStatus enumValue)
+        const char* GetNameForStabilityStatusCStr(StabilityStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StabilityStatus::STEADY_STATE:
-            return "STEADY_STATE";
-          case StabilityStatus::STABILIZING:
-            return "STABILIZING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStabilityStatus(StabilityStatus enumValue)
+        {
+          return GetNameForStabilityStatusCStr(enumValue);
         }
 
       } // namespace StabilityStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace TargetTypeMapper
       {
 
-        static const int container_instance_HASH = HashingUtils::HashString("container-instance");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "container-instance",
+        };
 
         TargetType GetTargetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == container_instance_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TargetType::container_instance;
+          case 290737249:
+            if (name == "container-instance")
+            {
+              return TargetType::container_instance;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return TargetType::NOT_SET;
         }
 
-        Aws::String GetNameForTargetType(TargetType enumValue)
+        const char* GetNameForTargetTypeCStr(TargetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TargetType::container_instance:
-            return "container-instance";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTargetType(TargetType enumValue)
+        {
+          return GetNameForTargetTypeCStr(enumValue);
         }
 
       } // namespace TargetTypeMapper
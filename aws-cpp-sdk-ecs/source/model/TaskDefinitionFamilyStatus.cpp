@@ -30,25 +30,44 @@ namespace Aws
       namespace TaskDefinitionFamilyStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "INACTIVE",
+          "ALL",
+        };
 
         TaskDefinitionFamilyStatus GetTaskDefinitionFamilyStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return TaskDefinitionFamilyStatus::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TaskDefinitionFamilyStatus::INACTIVE;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return TaskDefinitionFamilyStatus::ALL;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return TaskDefinitionFamilyStatus::ACTIVE;
+            }
+            break;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return TaskDefinitionFamilyStatus::INACTIVE;
+            }
+            break;
+          case 64897:
+            if (name == "ALL")
+            {
+              return TaskDefinitionFamilyStatus::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TaskDefinitionFamilyStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTaskDefinitionFamilyStatus(TaskDefinitionFamilyStatus enumValue)
+        const char* GetNameForTaskDefinitionFamilyStatusCStr(TaskDefinitionFamilyStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TaskDefinitionFamilyStatus::ACTIVE:
-            return "ACTIVE";
-          case TaskDefinitionFamilyStatus::INACTIVE:
-            return "INACTIVE";
-          case TaskDefinitionFamilyStatus::ALL:
-            return "ALL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTaskDefinitionFamilyStatus(TaskDefinitionFamilyStatus enumValue)
+        {
+          return GetNameForTaskDefinitionFamilyStatusCStr(enumValue);
         }
 
       } // namespace TaskDefinitionFamilyStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace TaskDefinitionPlacementConstraintTypeMapper
       {
 
-        static const int memberOf_HASH = HashingUtils::HashString("memberOf");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "memberOf",
+        };
 
         TaskDefinitionPlacementConstraintType GetTaskDefinitionPlacementConstraintTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == memberOf_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TaskDefinitionPlacementConstraintType::memberOf;
+          case -649439727:
+            if (name == "memberOf")
+            {
+              return TaskDefinitionPlacementConstraintType::memberOf;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return TaskDefinitionPlacementConstraintType::NOT_SET;
         }
 
-        Aws::String GetNameForTaskDefinitionPlacementConstraintType(TaskDefinitionPlacementConstraintType enumValue)
+        const char* GetNameForTaskDefinitionPlacementConstraintTypeCStr(TaskDefinitionPlacementConstraintType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TaskDefinitionPlacementConstraintType::memberOf:
-            return "memberOf";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTaskDefinitionPlacementConstraintType(TaskDefinitionPlacementConstraintType enumValue)
+        {
+          return GetNameForTaskDefinitionPlacementConstraintTypeCStr(enumValue);
         }
 
       } // namespace TaskDefinitionPlacementConstraintTypeMapper
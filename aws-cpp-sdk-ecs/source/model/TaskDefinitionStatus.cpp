@@ -30,20 +30,37 @@ namespace Aws
       namespace TaskDefinitionStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "INACTIVE",
+        };
 
         TaskDefinitionStatus GetTaskDefinitionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return TaskDefinitionStatus::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TaskDefinitionStatus::INACTIVE;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return TaskDefinitionStatus::ACTIVE;
+            }
+            break;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return TaskDefinitionStatus::INACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TaskDefinitionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTaskDefinitionStatus(TaskDefinitionStatus enumValue)
+        const char* GetNameForTaskDefinitionStatusCStr(TaskDefinitionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TaskDefinitionStatus::ACTIVE:
-            return "ACTIVE";
-          case TaskDefinitionStatus::INACTIVE:
-            return "INACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTaskDefinitionStatus(TaskDefinitionStatus enumValue)
+        {
+          return GetNameForTaskDefinitionStatusCStr(enumValue);
         }
 
       } // namespace TaskDefinitionStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TaskStopCodeMapper
       {
 
-        static const int TaskFailedToStart_HASH = HashingUtils::HashString("TaskFailedToStart");
-        static const int EssentialContainerExited_HASH = HashingUtils::HashString("EssentialContainerExited");
-        static const int UserInitiated_HASH = HashingUtils::HashString("UserInitiated");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TaskFailedToStart",
+          "EssentialContainerExited",
+          "UserInitiated",
+        };
 
         TaskStopCode GetTaskStopCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TaskFailedToStart_HASH)
-          {
-            return TaskStopCode::TaskFailedToStart;
-          }
-          else if (hashCode == EssentialContainerExited_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TaskStopCode::EssentialContainerExited;
-          }
-          else if (hashCode == UserInitiated_HASH)
-          {
-            return TaskStopCode::UserInitiated;
+          case 686090757:
+            if (name == "TaskFailedToStart")
+            {
+              return TaskStopCode::TaskFailedToStart;
+            }
+            break;
+          case 2131995920:
+            if (name == "EssentialContainerExited")
+            {
+              return TaskStopCode::EssentialContainerExited;
+            }
+            break;
+          case -1780991680:
+            if (name == "UserInitiated")
+            {
+              return TaskStopCode::UserInitiated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TaskStopCode::NOT_SET;
         }
 
-        Aws::String GetNameForTaskStopCode(TaskStopCode enumValue)
+        const char* GetNameForTaskStopCodeCStr(TaskStopCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TaskStopCode::TaskFailedToStart:
-            return "TaskFailedToStart";
-          case TaskStopCode::EssentialContainerExited:
-            return "EssentialContainerExited";
-          case TaskStopCode::UserInitiated:
-            return "UserInitiated";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTaskStopCode(TaskStopCode enumValue)
+        {
+          return GetNameForTaskStopCodeCStr(enumValue);
         }
 
       } // namespace TaskStopCodeMapper
@@ -30,85 +30,128 @@ namespace Aws
       namespace UlimitNameMapper
       {
 
-        static const int core_HASH = HashingUtils::HashString("core");
-        static const int cpu_HASH = HashingUtils::HashString("cpu");
-        static const int data_HASH = HashingUtils::HashString("data");
-        static const int fsize_HASH = HashingUtils::HashString("fsize");
-        static const int locks_HASH = HashingUtils::HashString("locks");
-        static const int memlock_HASH = HashingUtils::HashString("memlock");
-        static const int msgqueue_HASH = HashingUtils::HashString("msgqueue");
-        static const int nice_HASH = HashingUtils::HashString("nice");
-        static const int nofile_HASH = HashingUtils::HashString("nofile");
-        static const int nproc_HASH = HashingUtils::HashString("nproc");
-        static const int rss_HASH = HashingUtils::HashString("rss");
-        static const int rtprio_HASH = HashingUtils::HashString("rtprio");
-        static const int rttime_HASH = HashingUtils::HashString("rttime");
-        static const int sigpending_HASH = HashingUtils::HashString("sigpending");
-        static const int stack_HASH = HashingUtils::HashString("stack");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "core",
+          "cpu",
+          "data",
+          "fsize",
+          "locks",
+          "memlock",
+          "msgqueue",
+          "nice",
+          "nofile",
+          "nproc",
+          "rss",
+          "rtprio",
+          "rttime",
+          "sigpending",
+          "stack",
+        };
 
         UlimitName GetUlimitNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == core_HASH)
-          {
-            return UlimitName::core;
-          }
-          else if (hashCode == cpu_HASH)
-          {
-            return UlimitName::cpu;
-          }
-          else if (hashCode == data_HASH)
-          {
-            return UlimitName::data;
-          }
-          else if (hashCode == fsize_HASH)
-          {
-            return UlimitName::fsize;
-          }
-          else if (hashCode == locks_HASH)
-          {
-            return UlimitName::locks;
-          }
-          else if (hashCode == memlock_HASH)
-          {
-            return UlimitName::memlock;
-          }
-          else if (hashCode == msgqueue_HASH)
-          {
-            return UlimitName::msgqueue;
-          }
-          else if (hashCode == nice_HASH)
-          {
-            return UlimitName::nice;
-          }
-          else if (hashCode == nofile_HASH)
-          {
-            return UlimitName::nofile;
-          }
-          else if (hashCode == nproc_HASH)
-          {
-            return UlimitName::nproc;
-          }
-          else if (hashCode == rss_HASH)
-          {
-            return UlimitName::rss;
-          }
-          else if (hashCode == rtprio_HASH)
-          {
-            return UlimitName::rtprio;
-          }
-          else if (hashCode == rttime_HASH)
-          {
-            return UlimitName::rttime;
-          }
-          else if (hashCode == sigpending_HASH)
-          {
-            return UlimitName::sigpending;
-          }
-          else if (hashCode == stack_HASH)
-          {
-            return UlimitName::stack;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 3059615:
+            if (name == "core")
+            {
+              return UlimitName::core;
+            }
+            break;
+          case 98728:
+            if (name == "cpu")
+            {
+              return UlimitName::cpu;
+            }
+            break;
+          case 3076010:
+            if (name == "data")
+            {
+              return UlimitName::data;
+            }
+            break;
+          case 97729895:
+            if (name == "fsize")
+            {
+              return UlimitName::fsize;
+            }
+            break;
+          case 103145640:
+            if (name == "locks")
+            {
+              return UlimitName::locks;
+            }
+            break;
+          case 949188736:
+            if (name == "memlock")
+            {
+              return UlimitName::memlock;
+            }
+            break;
+          case -1266746832:
+            if (name == "msgqueue")
+            {
+              return UlimitName::msgqueue;
+            }
+            break;
+          case 3381085:
+            if (name == "nice")
+            {
+              return UlimitName::nice;
+            }
+            break;
+          case -1040106819:
+            if (name == "nofile")
+            {
+              return UlimitName::nofile;
+            }
+            break;
+          case 105036996:
+            if (name == "nproc")
+            {
+              return UlimitName::nproc;
+            }
+            break;
+          case 113234:
+            if (name == "rss")
+            {
+              return UlimitName::rss;
+            }
+            break;
+          case -920666134:
+            if (name == "rtprio")
+            {
+              return UlimitName::rtprio;
+            }
+            break;
+          case -920555505:
+            if (name == "rttime")
+            {
+              return UlimitName::rttime;
+            }
+            break;
+          case 804843430:
+            if (name == "sigpending")
+            {
+              return UlimitName::sigpending;
+            }
+            break;
+          case 109757064:
+            if (name == "stack")
+            {
+              return UlimitName::stack;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -120,49 +163,26 @@ namespace Aws
           return UlimitName::NOT_SET;
         }
 
-        Aws::String GetNameForUlimitName(UlimitName enumValue)
+        const char* GetNameForUlimitNameCStr(UlimitName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UlimitName::core:
-            return "core";
-          case UlimitName::cpu:
-            return "cpu";
-          case UlimitName::data:
-            return "data";
-          case UlimitName::fsize:
-            return "fsize";
-          case UlimitName::locks:
-            return "locks";
-          case UlimitName::memlock:
-            return "memlock";
-          case UlimitName::msgqueue:
-            return "msgqueue";
-          case UlimitName::nice:
-            return "nice";
-          case UlimitName::nofile:
-            return "nofile";
-          case UlimitName::nproc:
-            return "nproc";
-          case UlimitName::rss:
-            return "rss";
-          case UlimitName::rtprio:
-            return "rtprio";
-          case UlimitName::rttime:
-            return "rttime";
-          case UlimitName::sigpending:
-            return "sigpending";
-          case UlimitName::stack:
-            return "stack";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUlimitName(UlimitName enumValue)
+        {
+          return GetNameForUlimitNameCStr(enumValue);
         }
 
       } // namespace UlimitNameMapper
@@ -37,6 +37,11 @@ namespace ClusterStatusMapper
 AWS_EKS_API ClusterStatus GetClusterStatusForName(const Aws::String& name);
 
 AWS_EKS_API Aws::String GetNameForClusterStatus(ClusterStatus value);
+
+/**
+ * Same as GetNameForClusterStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EKS_API const char* GetNameForClusterStatusCStr(ClusterStatus value);
 } // namespace ClusterStatusMapper
 } // namespace Model
 } // namespace EKS
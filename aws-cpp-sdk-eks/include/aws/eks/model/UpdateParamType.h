@@ -35,6 +35,11 @@ namespace UpdateParamTypeMapper
 AWS_EKS_API UpdateParamType GetUpdateParamTypeForName(const Aws::String& name);
 
 AWS_EKS_API Aws::String GetNameForUpdateParamType(UpdateParamType value);
+
+/**
+ * Same as GetNameForUpdateParamType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EKS_API const char* GetNameForUpdateParamTypeCStr(UpdateParamType value);
 } // namespace UpdateParamTypeMapper
 } // namespace Model
 } // namespace EKS
@@ -37,6 +37,11 @@ namespace UpdateStatusMapper
 AWS_EKS_API UpdateStatus GetUpdateStatusForName(const Aws::String& name);
 
 AWS_EKS_API Aws::String GetNameForUpdateStatus(UpdateStatus value);
+
+/**
+ * Same as GetNameForUpdateStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EKS_API const char* GetNameForUpdateStatusCStr(UpdateStatus value);
 } // namespace UpdateStatusMapper
 } // namespace Model
 } // namespace EKS
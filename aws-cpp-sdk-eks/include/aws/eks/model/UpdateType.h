@@ -34,6 +34,11 @@ namespace UpdateTypeMapper
 AWS_EKS_API UpdateType GetUpdateTypeForName(const Aws::String& name);
 
 AWS_EKS_API Aws::String GetNameForUpdateType(UpdateType value);
+
+/**
+ * Same as GetNameForUpdateType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EKS_API const char* GetNameForUpdateTypeCStr(UpdateType value);
 } // namespace UpdateTypeMapper
 } // namespace Model
 } // namespace EKS
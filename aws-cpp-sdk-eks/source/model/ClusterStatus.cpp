@@ -30,30 +30,51 @@ namespace Aws
       namespace ClusterStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "ACTIVE",
+          "DELETING",
+          "FAILED",
+        };
 
         ClusterStatus GetClusterStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return ClusterStatus::CREATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return ClusterStatus::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ClusterStatus::DELETING;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClusterStatus::FAILED;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return ClusterStatus::CREATING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ClusterStatus::ACTIVE;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ClusterStatus::DELETING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ClusterStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ClusterStatus::NOT_SET;
         }
 
-        Aws::String GetNameForClusterStatus(ClusterStatus enumValue)
+        const char* GetNameForClusterStatusCStr(ClusterStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClusterStatus::CREATING:
-            return "CREATING";
-          case ClusterStatus::ACTIVE:
-            return "ACTIVE";
-          case ClusterStatus::DELETING:
-            return "DELETING";
-          case ClusterStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClusterStatus(ClusterStatus enumValue)
+        {
+          return GetNameForClusterStatusCStr(enumValue);
         }
 
       } // namespace ClusterStatusMapper
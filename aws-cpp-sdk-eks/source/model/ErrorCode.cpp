@@ -30,50 +30,79 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int SubnetNotFound_HASH = HashingUtils::HashString("SubnetNotFound");
-        static const int SecurityGroupNotFound_HASH = HashingUtils::HashString("SecurityGroupNotFound");
-        static const int EniLimitReached_HASH = HashingUtils::HashString("EniLimitReached");
-        static const int IpNotAvailable_HASH = HashingUtils::HashString("IpNotAvailable");
-        static const int AccessDenied_HASH = HashingUtils::HashString("AccessDenied");
-        static const int OperationNotPermitted_HASH = HashingUtils::HashString("OperationNotPermitted");
-        static const int VpcIdNotFound_HASH = HashingUtils::HashString("VpcIdNotFound");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SubnetNotFound",
+          "SecurityGroupNotFound",
+          "EniLimitReached",
+          "IpNotAvailable",
+          "AccessDenied",
+          "OperationNotPermitted",
+          "VpcIdNotFound",
+          "Unknown",
+        };
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SubnetNotFound_HASH)
-          {
-            return ErrorCode::SubnetNotFound;
-          }
-          else if (hashCode == SecurityGroupNotFound_HASH)
-          {
-            return ErrorCode::SecurityGroupNotFound;
-          }
-          else if (hashCode == EniLimitReached_HASH)
-          {
-            return ErrorCode::EniLimitReached;
-          }
-          else if (hashCode == IpNotAvailable_HASH)
-          {
-            return ErrorCode::IpNotAvailable;
-          }
-          else if (hashCode == AccessDenied_HASH)
-          {
-            return ErrorCode::AccessDenied;
-          }
-          else if (hashCode == OperationNotPermitted_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ErrorCode::OperationNotPermitted;
-          }
-          else if (hashCode == VpcIdNotFound_HASH)
-          {
-            return ErrorCode::VpcIdNotFound;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return ErrorCode::Unknown;
+          case 427593484:
+            if (name == "SubnetNotFound")
+            {
+              return ErrorCode::SubnetNotFound;
+            }
+            break;
+          case -934804338:
+            if (name == "SecurityGroupNotFound")
+            {
+              return ErrorCode::SecurityGroupNotFound;
+            }
+            break;
+          case -55226889:
+            if (name == "EniLimitReached")
+            {
+              return ErrorCode::EniLimitReached;
+            }
+            break;
+          case -1512691683:
+            if (name == "IpNotAvailable")
+            {
+              return ErrorCode::IpNotAvailable;
+            }
+            break;
+          case 1733482047:
+            if (name == "AccessDenied")
+            {
+              return ErrorCode::AccessDenied;
+            }
+            break;
+          case 745245548:
+            if (name == "OperationNotPermitted")
+            {
+              return ErrorCode::OperationNotPermitted;
+            }
+            break;
+          case 105542739:
+            if (name == "VpcIdNotFound")
+            {
+              return ErrorCode::VpcIdNotFound;
+            }
+            break;
+          case 1379812394:
+            if (name == "Unknown")
+            {
+              return ErrorCode::Unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return ErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        const char* GetNameForErrorCodeCStr(ErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ErrorCode::SubnetNotFound:
-            return "SubnetNotFound";
-          case ErrorCode::SecurityGroupNotFound:
-            return "SecurityGroupNotFound";
-          case ErrorCode::EniLimitReached:
-            return "EniLimitReached";
-          case ErrorCode::IpNotAvailable:
-            return "IpNotAvailable";
-          case ErrorCode::AccessDenied:
-            return "AccessDenied";
-          case ErrorCode::OperationNotPermitted:
-            return "OperationNotPermitted";
-          case ErrorCode::VpcIdNotFound:
-            return "VpcIdNotFound";
-          case ErrorCode::Unknown:
-            return "Unknown";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        {
+          return GetNameForErrorCodeCStr(enumValue);
         }
 
       } // namespace ErrorCodeMapper
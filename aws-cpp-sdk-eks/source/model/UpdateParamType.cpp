@@ -30,20 +30,37 @@ namespace Aws
       namespace UpdateParamTypeMapper
       {
 
-        static const int Version_HASH = HashingUtils::HashString("Version");
-        static const int PlatformVersion_HASH = HashingUtils::HashString("PlatformVersion");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Version",
+          "PlatformVersion",
+        };
 
         UpdateParamType GetUpdateParamTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Version_HASH)
-          {
-            return UpdateParamType::Version;
-          }
-          else if (hashCode == PlatformVersion_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UpdateParamType::PlatformVersion;
+          case 2016261304:
+            if (name == "Version")
+            {
+              return UpdateParamType::Version;
+            }
+            break;
+          case 851782853:
+            if (name == "PlatformVersion")
+            {
+              return UpdateParamType::PlatformVersion;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return UpdateParamType::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateParamType(UpdateParamType enumValue)
+        const char* GetNameForUpdateParamTypeCStr(UpdateParamType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UpdateParamType::Version:
-            return "Version";
-          case UpdateParamType::PlatformVersion:
-            return "PlatformVersion";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUpdateParamType(UpdateParamType enumValue)
+        {
+          return GetNameForUpdateParamTypeCStr(enumValue);
         }
 
       } // namespace UpdateParamTypeMapper
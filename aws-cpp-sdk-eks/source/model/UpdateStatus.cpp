@@ -30,30 +30,51 @@ namespace Aws
       namespace UpdateStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Successful_HASH = HashingUtils::HashString("Successful");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InProgress",
+          "Failed",
+          "Cancelled",
+          "Successful",
+        };
 
         UpdateStatus GetUpdateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
-          {
-            return UpdateStatus::InProgress;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return UpdateStatus::Failed;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return UpdateStatus::Cancelled;
-          }
-          else if (hashCode == Successful_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UpdateStatus::Successful;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return UpdateStatus::InProgress;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return UpdateStatus::Failed;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return UpdateStatus::Cancelled;
+            }
+            break;
+          case 1259833018:
+            if (name == "Successful")
+            {
+              return UpdateStatus::Successful;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return UpdateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateStatus(UpdateStatus enumValue)
+        const char* GetNameForUpdateStatusCStr(UpdateStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UpdateStatus::InProgress:
-            return "InProgress";
-          case UpdateStatus::Failed:
-            return "Failed";
-          case UpdateStatus::Cancelled:
-            return "Cancelled";
-          case UpdateStatus::Successful:
-            return "Successful";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUpdateStatus(UpdateStatus enumValue)
+        {
+          return GetNameForUpdateStatusCStr(enumValue);
         }
 
       } // namespace UpdateStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace UpdateTypeMapper
       {
 
-        static const int VersionUpdate_HASH = HashingUtils::HashString("VersionUpdate");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VersionUpdate",
+        };
 
         UpdateType GetUpdateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VersionUpdate_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UpdateType::VersionUpdate;
+          case 1626763169:
+            if (name == "VersionUpdate")
+            {
+              return UpdateType::VersionUpdate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return UpdateType::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateType(UpdateType enumValue)
+        const char* GetNameForUpdateTypeCStr(UpdateType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UpdateType::VersionUpdate:
-            return "VersionUpdate";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUpdateType(UpdateType enumValue)
+        {
+          return GetNameForUpdateTypeCStr(enumValue);
         }
 
       } // namespace UpdateTypeMapper
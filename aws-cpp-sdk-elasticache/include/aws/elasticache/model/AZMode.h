@@ -35,6 +35,11 @@ namespace AZModeMapper
 AWS_ELASTICACHE_API AZMode GetAZModeForName(const Aws::String& name);
 
 AWS_ELASTICACHE_API Aws::String GetNameForAZMode(AZMode value);
+
+/**
+ * Same as GetNameForAZMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICACHE_API const char* GetNameForAZModeCStr(AZMode value);
 } // namespace AZModeMapper
 } // namespace Model
 } // namespace ElastiCache
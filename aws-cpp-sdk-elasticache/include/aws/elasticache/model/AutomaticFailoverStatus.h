@@ -37,6 +37,11 @@ namespace AutomaticFailoverStatusMapper
 AWS_ELASTICACHE_API AutomaticFailoverStatus GetAutomaticFailoverStatusForName(const Aws::String& name);
 
 AWS_ELASTICACHE_API Aws::String GetNameForAutomaticFailoverStatus(AutomaticFailoverStatus value);
+
+/**
+ * Same as GetNameForAutomaticFailoverStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICACHE_API const char* GetNameForAutomaticFailoverStatusCStr(AutomaticFailoverStatus value);
 } // namespace AutomaticFailoverStatusMapper
 } // namespace Model
 } // namespace ElastiCache
@@ -35,6 +35,11 @@ namespace PendingAutomaticFailoverStatusMapper
 AWS_ELASTICACHE_API PendingAutomaticFailoverStatus GetPendingAutomaticFailoverStatusForName(const Aws::String& name);
 
 AWS_ELASTICACHE_API Aws::String GetNameForPendingAutomaticFailoverStatus(PendingAutomaticFailoverStatus value);
+
+/**
+ * Same as GetNameForPendingAutomaticFailoverStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICACHE_API const char* GetNameForPendingAutomaticFailoverStatusCStr(PendingAutomaticFailoverStatus value);
 } // namespace PendingAutomaticFailoverStatusMapper
 } // namespace Model
 } // namespace ElastiCache
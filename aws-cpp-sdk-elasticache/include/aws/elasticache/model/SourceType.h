@@ -38,6 +38,11 @@ namespace SourceTypeMapper
 AWS_ELASTICACHE_API SourceType GetSourceTypeForName(const Aws::String& name);
 
 AWS_ELASTICACHE_API Aws::String GetNameForSourceType(SourceType value);
+
+/**
+ * Same as GetNameForSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICACHE_API const char* GetNameForSourceTypeCStr(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace ElastiCache
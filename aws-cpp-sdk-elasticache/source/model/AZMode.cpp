@@ -30,20 +30,37 @@ namespace Aws
       namespace AZModeMapper
       {
 
-        static const int single_az_HASH = HashingUtils::HashString("single-az");
-        static const int cross_az_HASH = HashingUtils::HashString("cross-az");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "single-az",
+          "cross-az",
+        };
 
         AZMode GetAZModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == single_az_HASH)
-          {
-            return AZMode::single_az;
-          }
-          else if (hashCode == cross_az_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AZMode::cross_az;
+          case -1494586402:
+            if (name == "single-az")
+            {
+              return AZMode::single_az;
+            }
+            break;
+          case 2123248870:
+            if (name == "cross-az")
+            {
+              return AZMode::cross_az;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AZMode::NOT_SET;
         }
 
-        Aws::String GetNameForAZMode(AZMode enumValue)
+        const char* GetNameForAZModeCStr(AZMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AZMode::single_az:
-            return "single-az";
-          case AZMode::cross_az:
-            return "cross-az";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAZMode(AZMode enumValue)
+        {
+          return GetNameForAZModeCStr(enumValue);
         }
 
       } // namespace AZModeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace AutomaticFailoverStatusMapper
       {
 
-        static const int enabled_HASH = HashingUtils::HashString("enabled");
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
-        static const int enabling_HASH = HashingUtils::HashString("enabling");
-        static const int disabling_HASH = HashingUtils::HashString("disabling");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "enabled",
+          "disabled",
+          "enabling",
+          "disabling",
+        };
 
         AutomaticFailoverStatus GetAutomaticFailoverStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enabled_HASH)
-          {
-            return AutomaticFailoverStatus::enabled;
-          }
-          else if (hashCode == disabled_HASH)
-          {
-            return AutomaticFailoverStatus::disabled;
-          }
-          else if (hashCode == enabling_HASH)
-          {
-            return AutomaticFailoverStatus::enabling;
-          }
-          else if (hashCode == disabling_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AutomaticFailoverStatus::disabling;
+          case -1609594047:
+            if (name == "enabled")
+            {
+              return AutomaticFailoverStatus::enabled;
+            }
+            break;
+          case 270940796:
+            if (name == "disabled")
+            {
+              return AutomaticFailoverStatus::disabled;
+            }
+            break;
+          case 1642196352:
+            if (name == "enabling")
+            {
+              return AutomaticFailoverStatus::enabling;
+            }
+            break;
+          case -190765659:
+            if (name == "disabling")
+            {
+              return AutomaticFailoverStatus::disabling;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AutomaticFailoverStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAutomaticFailoverStatus(AutomaticFailoverStatus enumValue)
+        const char* GetNameForAutomaticFailoverStatusCStr(AutomaticFailoverStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AutomaticFailoverStatus::enabled:
-            return "enabled";
-          case AutomaticFailoverStatus::disabled:
-            return "disabled";
-          case AutomaticFailoverStatus::enabling:
-            return "enabling";
-          case AutomaticFailoverStatus::disabling:
-            return "disabling";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAutomaticFailoverStatus(AutomaticFailoverStatus enumValue)
+        {
+          return GetNameForAutomaticFailoverStatusCStr(enumValue);
         }
 
       } // namespace AutomaticFailoverStatusMapper
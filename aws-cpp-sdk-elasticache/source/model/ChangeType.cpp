@@ -30,20 +30,37 @@ namespace Aws
       namespace ChangeTypeMapper
       {
 
-        static const int immediate_HASH = HashingUtils::HashString("immediate");
-        static const int requires_reboot_HASH = HashingUtils::HashString("requires-reboot");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "immediate",
+          "requires-reboot",
+        };
 
         ChangeType GetChangeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == immediate_HASH)
-          {
-            return ChangeType::immediate;
-          }
-          else if (hashCode == requires_reboot_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeType::requires_reboot;
+          case 1124382641:
+            if (name == "immediate")
+            {
+              return ChangeType::immediate;
+            }
+            break;
+          case 77813412:
+            if (name == "requires-reboot")
+            {
+              return ChangeType::requires_reboot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ChangeType::NOT_SET;
         }
 
-        Aws::String GetNameForChangeType(ChangeType enumValue)
+        const char* GetNameForChangeTypeCStr(ChangeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeType::immediate:
-            return "immediate";
-          case ChangeType::requires_reboot:
-            return "requires-reboot";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeType(ChangeType enumValue)
+        {
+          return GetNameForChangeTypeCStr(enumValue);
         }
 
       } // namespace ChangeTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PendingAutomaticFailoverStatusMapper
       {
 
-        static const int enabled_HASH = HashingUtils::HashString("enabled");
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "enabled",
+          "disabled",
+        };
 
         PendingAutomaticFailoverStatus GetPendingAutomaticFailoverStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enabled_HASH)
-          {
-            return PendingAutomaticFailoverStatus::enabled;
-          }
-          else if (hashCode == disabled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PendingAutomaticFailoverStatus::disabled;
+          case -1609594047:
+            if (name == "enabled")
+            {
+              return PendingAutomaticFailoverStatus::enabled;
+            }
+            break;
+          case 270940796:
+            if (name == "disabled")
+            {
+              return PendingAutomaticFailoverStatus::disabled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PendingAutomaticFailoverStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPendingAutomaticFailoverStatus(PendingAutomaticFailoverStatus enumValue)
+        const char* GetNameForPendingAutomaticFailoverStatusCStr(PendingAutomaticFailoverStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PendingAutomaticFailoverStatus::enabled:
-            return "enabled";
-          case PendingAutomaticFailoverStatus::disabled:
-            return "disabled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPendingAutomaticFailoverStatus(PendingAutomaticFailoverStatus enumValue)
+        {
+          return GetNameForPendingAutomaticFailoverStatusCStr(enumValue);
         }
 
       } // namespace PendingAutomaticFailoverStatusMapper
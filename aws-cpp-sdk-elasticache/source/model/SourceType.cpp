@@ -30,35 +30,58 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int cache_cluster_HASH = HashingUtils::HashString("cache-cluster");
-        static const int cache_parameter_group_HASH = HashingUtils::HashString("cache-parameter-group");
-        static const int cache_security_group_HASH = HashingUtils::HashString("cache-security-group");
-        static const int cache_subnet_group_HASH = HashingUtils::HashString("cache-subnet-group");
-        static const int replication_group_HASH = HashingUtils::HashString("replication-group");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "cache-cluster",
+          "cache-parameter-group",
+          "cache-security-group",
+          "cache-subnet-group",
+          "replication-group",
+        };
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cache_cluster_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SourceType::cache_cluster;
-          }
-          else if (hashCode == cache_parameter_group_HASH)
-          {
-            return SourceType::cache_parameter_group;
-          }
-          else if (hashCode == cache_security_group_HASH)
-          {
-            return SourceType::cache_security_group;
-          }
-          else if (hashCode == cache_subnet_group_HASH)
-          {
-            return SourceType::cache_subnet_group;
-          }
-          else if (hashCode == replication_group_HASH)
-          {
-            return SourceType::replication_group;
+          case -288226641:
+            if (name == "cache-cluster")
+            {
+              return SourceType::cache_cluster;
+            }
+            break;
+          case 1499334416:
+            if (name == "cache-parameter-group")
+            {
+              return SourceType::cache_parameter_group;
+            }
+            break;
+          case -1450779811:
+            if (name == "cache-security-group")
+            {
+              return SourceType::cache_security_group;
+            }
+            break;
+          case 1552469114:
+            if (name == "cache-subnet-group")
+            {
+              return SourceType::cache_subnet_group;
+            }
+            break;
+          case 1433209150:
+            if (name == "replication-group")
+            {
+              return SourceType::replication_group;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceTypeCStr(SourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SourceType::cache_cluster:
-            return "cache-cluster";
-          case SourceType::cache_parameter_group:
-            return "cache-parameter-group";
-          case SourceType::cache_security_group:
-            return "cache-security-group";
-          case SourceType::cache_subnet_group:
-            return "cache-subnet-group";
-          case SourceType::replication_group:
-            return "replication-group";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSourceType(SourceType enumValue)
+        {
+          return GetNameForSourceTypeCStr(enumValue);
         }
 
       } // namespace SourceTypeMapper
@@ -36,6 +36,11 @@ namespace ActionHistoryStatusMapper
 AWS_ELASTICBEANSTALK_API ActionHistoryStatus GetActionHistoryStatusForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForActionHistoryStatus(ActionHistoryStatus value);
+
+/**
+ * Same as GetNameForActionHistoryStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForActionHistoryStatusCStr(ActionHistoryStatus value);
 } // namespace ActionHistoryStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -37,6 +37,11 @@ namespace ActionStatusMapper
 AWS_ELASTICBEANSTALK_API ActionStatus GetActionStatusForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForActionStatus(ActionStatus value);
+
+/**
+ * Same as GetNameForActionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForActionStatusCStr(ActionStatus value);
 } // namespace ActionStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -36,6 +36,11 @@ namespace ActionTypeMapper
 AWS_ELASTICBEANSTALK_API ActionType GetActionTypeForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForActionType(ActionType value);
+
+/**
+ * Same as GetNameForActionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForActionTypeCStr(ActionType value);
 } // namespace ActionTypeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
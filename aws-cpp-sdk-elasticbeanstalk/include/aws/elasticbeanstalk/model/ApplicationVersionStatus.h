@@ -38,6 +38,11 @@ namespace ApplicationVersionStatusMapper
 AWS_ELASTICBEANSTALK_API ApplicationVersionStatus GetApplicationVersionStatusForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForApplicationVersionStatus(ApplicationVersionStatus value);
+
+/**
+ * Same as GetNameForApplicationVersionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForApplicationVersionStatusCStr(ApplicationVersionStatus value);
 } // namespace ApplicationVersionStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
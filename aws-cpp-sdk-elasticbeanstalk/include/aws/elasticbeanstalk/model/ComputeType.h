@@ -36,6 +36,11 @@ namespace ComputeTypeMapper
 AWS_ELASTICBEANSTALK_API ComputeType GetComputeTypeForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForComputeType(ComputeType value);
+
+/**
+ * Same as GetNameForComputeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForComputeTypeCStr(ComputeType value);
 } // namespace ComputeTypeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
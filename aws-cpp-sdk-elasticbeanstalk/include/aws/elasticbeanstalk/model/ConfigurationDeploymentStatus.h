@@ -36,6 +36,11 @@ namespace ConfigurationDeploymentStatusMapper
 AWS_ELASTICBEANSTALK_API ConfigurationDeploymentStatus GetConfigurationDeploymentStatusForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForConfigurationDeploymentStatus(ConfigurationDeploymentStatus value);
+
+/**
+ * Same as GetNameForConfigurationDeploymentStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForConfigurationDeploymentStatusCStr(ConfigurationDeploymentStatus value);
 } // namespace ConfigurationDeploymentStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -35,6 +35,11 @@ namespace ConfigurationOptionValueTypeMapper
 AWS_ELASTICBEANSTALK_API ConfigurationOptionValueType GetConfigurationOptionValueTypeForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForConfigurationOptionValueType(ConfigurationOptionValueType value);
+
+/**
+ * Same as GetNameForConfigurationOptionValueType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForConfigurationOptionValueTypeCStr(ConfigurationOptionValueType value);
 } // namespace ConfigurationOptionValueTypeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -37,6 +37,11 @@ namespace EnvironmentHealthMapper
 AWS_ELASTICBEANSTALK_API EnvironmentHealth GetEnvironmentHealthForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForEnvironmentHealth(EnvironmentHealth value);
+
+/**
+ * Same as GetNameForEnvironmentHealth(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForEnvironmentHealthCStr(EnvironmentHealth value);
 } // namespace EnvironmentHealthMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -41,6 +41,11 @@ namespace EnvironmentHealthAttributeMapper
 AWS_ELASTICBEANSTALK_API EnvironmentHealthAttribute GetEnvironmentHealthAttributeForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForEnvironmentHealthAttribute(EnvironmentHealthAttribute value);
+
+/**
+ * Same as GetNameForEnvironmentHealthAttribute(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForEnvironmentHealthAttributeCStr(EnvironmentHealthAttribute value);
 } // namespace EnvironmentHealthAttributeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -42,6 +42,11 @@ namespace EnvironmentHealthStatusMapper
 AWS_ELASTICBEANSTALK_API EnvironmentHealthStatus GetEnvironmentHealthStatusForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForEnvironmentHealthStatus(EnvironmentHealthStatus value);
+
+/**
+ * Same as GetNameForEnvironmentHealthStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForEnvironmentHealthStatusCStr(EnvironmentHealthStatus value);
 } // namespace EnvironmentHealthStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -35,6 +35,11 @@ namespace EnvironmentInfoTypeMapper
 AWS_ELASTICBEANSTALK_API EnvironmentInfoType GetEnvironmentInfoTypeForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForEnvironmentInfoType(EnvironmentInfoType value);
+
+/**
+ * Same as GetNameForEnvironmentInfoType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForEnvironmentInfoTypeCStr(EnvironmentInfoType value);
 } // namespace EnvironmentInfoTypeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
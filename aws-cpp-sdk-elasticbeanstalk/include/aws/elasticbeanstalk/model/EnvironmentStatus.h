@@ -38,6 +38,11 @@ namespace EnvironmentStatusMapper
 AWS_ELASTICBEANSTALK_API EnvironmentStatus GetEnvironmentStatusForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForEnvironmentStatus(EnvironmentStatus value);
+
+/**
+ * Same as GetNameForEnvironmentStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForEnvironmentStatusCStr(EnvironmentStatus value);
 } // namespace EnvironmentStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
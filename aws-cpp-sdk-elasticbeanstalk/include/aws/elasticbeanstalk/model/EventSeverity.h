@@ -39,6 +39,11 @@ namespace EventSeverityMapper
 AWS_ELASTICBEANSTALK_API EventSeverity GetEventSeverityForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForEventSeverity(EventSeverity value);
+
+/**
+ * Same as GetNameForEventSeverity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForEventSeverityCStr(EventSeverity value);
 } // namespace EventSeverityMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -40,6 +40,11 @@ namespace FailureTypeMapper
 AWS_ELASTICBEANSTALK_API FailureType GetFailureTypeForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForFailureType(FailureType value);
+
+/**
+ * Same as GetNameForFailureType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForFailureTypeCStr(FailureType value);
 } // namespace FailureTypeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
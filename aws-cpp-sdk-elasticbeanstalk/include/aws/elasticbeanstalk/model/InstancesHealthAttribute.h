@@ -44,6 +44,11 @@ namespace InstancesHealthAttributeMapper
 AWS_ELASTICBEANSTALK_API InstancesHealthAttribute GetInstancesHealthAttributeForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForInstancesHealthAttribute(InstancesHealthAttribute value);
+
+/**
+ * Same as GetNameForInstancesHealthAttribute(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForInstancesHealthAttributeCStr(InstancesHealthAttribute value);
 } // namespace InstancesHealthAttributeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -38,6 +38,11 @@ namespace PlatformStatusMapper
 AWS_ELASTICBEANSTALK_API PlatformStatus GetPlatformStatusForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForPlatformStatus(PlatformStatus value);
+
+/**
+ * Same as GetNameForPlatformStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForPlatformStatusCStr(PlatformStatus value);
 } // namespace PlatformStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -35,6 +35,11 @@ namespace SourceRepositoryMapper
 AWS_ELASTICBEANSTALK_API SourceRepository GetSourceRepositoryForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForSourceRepository(SourceRepository value);
+
+/**
+ * Same as GetNameForSourceRepository(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForSourceRepositoryCStr(SourceRepository value);
 } // namespace SourceRepositoryMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
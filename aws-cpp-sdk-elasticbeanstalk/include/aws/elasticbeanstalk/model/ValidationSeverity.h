@@ -35,6 +35,11 @@ namespace ValidationSeverityMapper
 AWS_ELASTICBEANSTALK_API ValidationSeverity GetValidationSeverityForName(const Aws::String& name);
 
 AWS_ELASTICBEANSTALK_API Aws::String GetNameForValidationSeverity(ValidationSeverity value);
+
+/**
+ * Same as GetNameForValidationSeverity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICBEANSTALK_API const char* GetNameForValidationSeverityCStr(ValidationSeverity value);
 } // namespace ValidationSeverityMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -30,25 +30,44 @@ namespace Aws
       namespace ActionHistoryStatusMapper
       {
 
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Completed",
+          "Failed",
+          "Unknown",
+        };
 
         ActionHistoryStatus GetActionHistoryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Completed_HASH)
-          {
-            return ActionHistoryStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionHistoryStatus::Failed;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return ActionHistoryStatus::Unknown;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return ActionHistoryStatus::Completed;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return ActionHistoryStatus::Failed;
+            }
+            break;
+          case 1379812394:
+            if (name == "Unknown")
+            {
+              return ActionHistoryStatus::Unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ActionHistoryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForActionHistoryStatus(ActionHistoryStatus enumValue)
+        const char* GetNameForActionHistoryStatusCStr(ActionHistoryStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionHistoryStatus::Completed:
-            return "Completed";
-          case ActionHistoryStatus::Failed:
-            return "Failed";
-          case ActionHistoryStatus::Unknown:
-            return "Unknown";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionHistoryStatus(ActionHistoryStatus enumValue)
+        {
+          return GetNameForActionHistoryStatusCStr(enumValue);
         }
 
       } // namespace ActionHistoryStatusMapper
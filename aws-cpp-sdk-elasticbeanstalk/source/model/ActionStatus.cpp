@@ -30,30 +30,51 @@ namespace Aws
       namespace ActionStatusMapper
       {
 
-        static const int Scheduled_HASH = HashingUtils::HashString("Scheduled");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Running_HASH = HashingUtils::HashString("Running");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Scheduled",
+          "Pending",
+          "Running",
+          "Unknown",
+        };
 
         ActionStatus GetActionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Scheduled_HASH)
-          {
-            return ActionStatus::Scheduled;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return ActionStatus::Pending;
-          }
-          else if (hashCode == Running_HASH)
-          {
-            return ActionStatus::Running;
-          }
-          else if (hashCode == Unknown_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionStatus::Unknown;
+          case 1843257485:
+            if (name == "Scheduled")
+            {
+              return ActionStatus::Scheduled;
+            }
+            break;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return ActionStatus::Pending;
+            }
+            break;
+          case -1079530081:
+            if (name == "Running")
+            {
+              return ActionStatus::Running;
+            }
+            break;
+          case 1379812394:
+            if (name == "Unknown")
+            {
+              return ActionStatus::Unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ActionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForActionStatus(ActionStatus enumValue)
+        const char* GetNameForActionStatusCStr(ActionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionStatus::Scheduled:
-            return "Scheduled";
-          case ActionStatus::Pending:
-            return "Pending";
-          case ActionStatus::Running:
-            return "Running";
-          case ActionStatus::Unknown:
-            return "Unknown";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionStatus(ActionStatus enumValue)
+        {
+          return GetNameForActionStatusCStr(enumValue);
         }
 
       } // namespace ActionStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ActionTypeMapper
       {
 
-        static const int InstanceRefresh_HASH = HashingUtils::HashString("InstanceRefresh");
-        static const int PlatformUpdate_HASH = HashingUtils::HashString("PlatformUpdate");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InstanceRefresh",
+          "PlatformUpdate",
+          "Unknown",
+        };
 
         ActionType GetActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InstanceRefresh_HASH)
-          {
-            return ActionType::InstanceRefresh;
-          }
-          else if (hashCode == PlatformUpdate_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionType::PlatformUpdate;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return ActionType::Unknown;
+          case -1498944410:
+            if (name == "InstanceRefresh")
+            {
+              return ActionType::InstanceRefresh;
+            }
+            break;
+          case -1792542916:
+            if (name == "PlatformUpdate")
+            {
+              return ActionType::PlatformUpdate;
+            }
+            break;
+          case 1379812394:
+            if (name == "Unknown")
+            {
+              return ActionType::Unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ActionType::NOT_SET;
         }
 
-        Aws::String GetNameForActionType(ActionType enumValue)
+        const char* GetNameForActionTypeCStr(ActionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionType::InstanceRefresh:
-            return "InstanceRefresh";
-          case ActionType::PlatformUpdate:
-            return "PlatformUpdate";
-          case ActionType::Unknown:
-            return "Unknown";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionType(ActionType enumValue)
+        {
+          return GetNameForActionTypeCStr(enumValue);
         }
 
       } // namespace ActionTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ApplicationVersionStatusMapper
       {
 
-        static const int Processed_HASH = HashingUtils::HashString("Processed");
-        static const int Unprocessed_HASH = HashingUtils::HashString("Unprocessed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Processing_HASH = HashingUtils::HashString("Processing");
-        static const int Building_HASH = HashingUtils::HashString("Building");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Processed",
+          "Unprocessed",
+          "Failed",
+          "Processing",
+          "Building",
+        };
 
         ApplicationVersionStatus GetApplicationVersionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Processed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ApplicationVersionStatus::Processed;
-          }
-          else if (hashCode == Unprocessed_HASH)
-          {
-            return ApplicationVersionStatus::Unprocessed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ApplicationVersionStatus::Failed;
-          }
-          else if (hashCode == Processing_HASH)
-          {
-            return ApplicationVersionStatus::Processing;
-          }
-          else if (hashCode == Building_HASH)
-          {
-            return ApplicationVersionStatus::Building;
+          case 909208366:
+            if (name == "Processed")
+            {
+              return ApplicationVersionStatus::Processed;
+            }
+            break;
+          case 641548469:
+            if (name == "Unprocessed")
+            {
+              return ApplicationVersionStatus::Unprocessed;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return ApplicationVersionStatus::Failed;
+            }
+            break;
+          case -1879307469:
+            if (name == "Processing")
+            {
+              return ApplicationVersionStatus::Processing;
+            }
+            break;
+          case -1366001964:
+            if (name == "Building")
+            {
+              return ApplicationVersionStatus::Building;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ApplicationVersionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForApplicationVersionStatus(ApplicationVersionStatus enumValue)
+        const char* GetNameForApplicationVersionStatusCStr(ApplicationVersionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ApplicationVersionStatus::Processed:
-            return "Processed";
-          case ApplicationVersionStatus::Unprocessed:
-            return "Unprocessed";
-          case ApplicationVersionStatus::Failed:
-            return "Failed";
-          case ApplicationVersionStatus::Processing:
-            return "Processing";
-          case ApplicationVersionStatus::Building:
-            return "Building";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForApplicationVersionStatus(ApplicationVersionStatus enumValue)
+        {
+          return GetNameForApplicationVersionStatusCStr(enumValue);
         }
 
       } // namespace ApplicationVersionStatusMapper
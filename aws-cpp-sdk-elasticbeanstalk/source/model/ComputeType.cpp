@@ -30,25 +30,44 @@ namespace Aws
       namespace ComputeTypeMapper
       {
 
-        static const int BUILD_GENERAL1_SMALL_HASH = HashingUtils::HashString("BUILD_GENERAL1_SMALL");
-        static const int BUILD_GENERAL1_MEDIUM_HASH = HashingUtils::HashString("BUILD_GENERAL1_MEDIUM");
-        static const int BUILD_GENERAL1_LARGE_HASH = HashingUtils::HashString("BUILD_GENERAL1_LARGE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BUILD_GENERAL1_SMALL",
+          "BUILD_GENERAL1_MEDIUM",
+          "BUILD_GENERAL1_LARGE",
+        };
 
         ComputeType GetComputeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BUILD_GENERAL1_SMALL_HASH)
-          {
-            return ComputeType::BUILD_GENERAL1_SMALL;
-          }
-          else if (hashCode == BUILD_GENERAL1_MEDIUM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComputeType::BUILD_GENERAL1_MEDIUM;
-          }
-          else if (hashCode == BUILD_GENERAL1_LARGE_HASH)
-          {
-            return ComputeType::BUILD_GENERAL1_LARGE;
+          case 783928226:
+            if (name == "BUILD_GENERAL1_SMALL")
+            {
+              return ComputeType::BUILD_GENERAL1_SMALL;
+            }
+            break;
+          case -1647104998:
+            if (name == "BUILD_GENERAL1_MEDIUM")
+            {
+              return ComputeType::BUILD_GENERAL1_MEDIUM;
+            }
+            break;
+          case 777122262:
+            if (name == "BUILD_GENERAL1_LARGE")
+            {
+              return ComputeType::BUILD_GENERAL1_LARGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ComputeType::NOT_SET;
         }
 
-        Aws::String GetNameForComputeType(ComputeType enumValue)
+        const char* GetNameForComputeTypeCStr(ComputeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComputeType::BUILD_GENERAL1_SMALL:
-            return "BUILD_GENERAL1_SMALL";
-          case ComputeType::BUILD_GENERAL1_MEDIUM:
-            return "BUILD_GENERAL1_MEDIUM";
-          case ComputeType::BUILD_GENERAL1_LARGE:
-            return "BUILD_GENERAL1_LARGE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComputeType(ComputeType enumValue)
+        {
+          return GetNameForComputeTypeCStr(enumValue);
         }
 
       } // namespace ComputeTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ConfigurationDeploymentStatusMapper
       {
 
-        static const int deployed_HASH = HashingUtils::HashString("deployed");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "deployed",
+          "pending",
+          "failed",
+        };
 
         ConfigurationDeploymentStatus GetConfigurationDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == deployed_HASH)
-          {
-            return ConfigurationDeploymentStatus::deployed;
-          }
-          else if (hashCode == pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConfigurationDeploymentStatus::pending;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return ConfigurationDeploymentStatus::failed;
+          case 940564422:
+            if (name == "deployed")
+            {
+              return ConfigurationDeploymentStatus::deployed;
+            }
+            break;
+          case -682587753:
+            if (name == "pending")
+            {
+              return ConfigurationDeploymentStatus::pending;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return ConfigurationDeploymentStatus::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ConfigurationDeploymentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForConfigurationDeploymentStatus(ConfigurationDeploymentStatus enumValue)
+        const char* GetNameForConfigurationDeploymentStatusCStr(ConfigurationDeploymentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConfigurationDeploymentStatus::deployed:
-            return "deployed";
-          case ConfigurationDeploymentStatus::pending:
-            return "pending";
-          case ConfigurationDeploymentStatus::failed:
-            return "failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConfigurationDeploymentStatus(ConfigurationDeploymentStatus enumValue)
+        {
+          return GetNameForConfigurationDeploymentStatusCStr(enumValue);
         }
 
       } // namespace ConfigurationDeploymentStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ConfigurationOptionValueTypeMapper
       {
 
-        static const int Scalar_HASH = HashingUtils::HashString("Scalar");
-        static const int List_HASH = HashingUtils::HashString("List");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Scalar",
+          "List",
+        };
 
         ConfigurationOptionValueType GetConfigurationOptionValueTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Scalar_HASH)
-          {
-            return ConfigurationOptionValueType::Scalar;
-          }
-          else if (hashCode == List_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConfigurationOptionValueType::List;
+          case -1824322548:
+            if (name == "Scalar")
+            {
+              return ConfigurationOptionValueType::Scalar;
+            }
+            break;
+          case 2368702:
+            if (name == "List")
+            {
+              return ConfigurationOptionValueType::List;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ConfigurationOptionValueType::NOT_SET;
         }
 
-        Aws::String GetNameForConfigurationOptionValueType(ConfigurationOptionValueType enumValue)
+        const char* GetNameForConfigurationOptionValueTypeCStr(ConfigurationOptionValueType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConfigurationOptionValueType::Scalar:
-            return "Scalar";
-          case ConfigurationOptionValueType::List:
-            return "List";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConfigurationOptionValueType(ConfigurationOptionValueType enumValue)
+        {
+          return GetNameForConfigurationOptionValueTypeCStr(enumValue);
         }
 
       } // namespace ConfigurationOptionValueTypeMapper
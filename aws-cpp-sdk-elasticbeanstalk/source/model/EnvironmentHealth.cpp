@@ -30,30 +30,51 @@ namespace Aws
       namespace EnvironmentHealthMapper
       {
 
-        static const int Green_HASH = HashingUtils::HashString("Green");
-        static const int Yellow_HASH = HashingUtils::HashString("Yellow");
-        static const int Red_HASH = HashingUtils::HashString("Red");
-        static const int Grey_HASH = HashingUtils::HashString("Grey");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Green",
+          "Yellow",
+          "Red",
+          "Grey",
+        };
 
         EnvironmentHealth GetEnvironmentHealthForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Green_HASH)
-          {
-            return EnvironmentHealth::Green;
-          }
-          else if (hashCode == Yellow_HASH)
-          {
-            return EnvironmentHealth::Yellow;
-          }
-          else if (hashCode == Red_HASH)
-          {
-            return EnvironmentHealth::Red;
-          }
-          else if (hashCode == Grey_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnvironmentHealth::Grey;
+          case 69066467:
+            if (name == "Green")
+            {
+              return EnvironmentHealth::Green;
+            }
+            break;
+          case -1650372460:
+            if (name == "Yellow")
+            {
+              return EnvironmentHealth::Yellow;
+            }
+            break;
+          case 82033:
+            if (name == "Red")
+            {
+              return EnvironmentHealth::Red;
+            }
+            break;
+          case 2227967:
+            if (name == "Grey")
+            {
+              return EnvironmentHealth::Grey;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return EnvironmentHealth::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentHealth(EnvironmentHealth enumValue)
+        const char* GetNameForEnvironmentHealthCStr(EnvironmentHealth enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnvironmentHealth::Green:
-            return "Green";
-          case EnvironmentHealth::Yellow:
-            return "Yellow";
-          case EnvironmentHealth::Red:
-            return "Red";
-          case EnvironmentHealth::Grey:
-            return "Grey";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnvironmentHealth(EnvironmentHealth enumValue)
+        {
+          return GetNameForEnvironmentHealthCStr(enumValue);
         }
 
       } // namespace EnvironmentHealthMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace EnvironmentHealthAttributeMapper
       {
 
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Color_HASH = HashingUtils::HashString("Color");
-        static const int Causes_HASH = HashingUtils::HashString("Causes");
-        static const int ApplicationMetrics_HASH = HashingUtils::HashString("ApplicationMetrics");
-        static const int InstancesHealth_HASH = HashingUtils::HashString("InstancesHealth");
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int HealthStatus_HASH = HashingUtils::HashString("HealthStatus");
-        static const int RefreshedAt_HASH = HashingUtils::HashString("RefreshedAt");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Status",
+          "Color",
+          "Causes",
+          "ApplicationMetrics",
+          "InstancesHealth",
+          "All",
+          "HealthStatus",
+          "RefreshedAt",
+        };
 
         EnvironmentHealthAttribute GetEnvironmentHealthAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Status_HASH)
-          {
-            return EnvironmentHealthAttribute::Status;
-          }
-          else if (hashCode == Color_HASH)
-          {
-            return EnvironmentHealthAttribute::Color;
-          }
-          else if (hashCode == Causes_HASH)
-          {
-            return EnvironmentHealthAttribute::Causes;
-          }
-          else if (hashCode == ApplicationMetrics_HASH)
-          {
-            return EnvironmentHealthAttribute::ApplicationMetrics;
-          }
-          else if (hashCode == InstancesHealth_HASH)
-          {
-            return EnvironmentHealthAttribute::InstancesHealth;
-          }
-          else if (hashCode == All_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnvironmentHealthAttribute::All;
-          }
-          else if (hashCode == HealthStatus_HASH)
-          {
-            return EnvironmentHealthAttribute::HealthStatus;
-          }
-          else if (hashCode == RefreshedAt_HASH)
-          {
-            return EnvironmentHealthAttribute::RefreshedAt;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return EnvironmentHealthAttribute::Status;
+            }
+            break;
+          case 65290051:
+            if (name == "Color")
+            {
+              return EnvironmentHealthAttribute::Color;
+            }
+            break;
+          case 2011333962:
+            if (name == "Causes")
+            {
+              return EnvironmentHealthAttribute::Causes;
+            }
+            break;
+          case -921733773:
+            if (name == "ApplicationMetrics")
+            {
+              return EnvironmentHealthAttribute::ApplicationMetrics;
+            }
+            break;
+          case 1187204698:
+            if (name == "InstancesHealth")
+            {
+              return EnvironmentHealthAttribute::InstancesHealth;
+            }
+            break;
+          case 65921:
+            if (name == "All")
+            {
+              return EnvironmentHealthAttribute::All;
+            }
+            break;
+          case 682024334:
+            if (name == "HealthStatus")
+            {
+              return EnvironmentHealthAttribute::HealthStatus;
+            }
+            break;
+          case 281067117:
+            if (name == "RefreshedAt")
+            {
+              return EnvironmentHealthAttribute::RefreshedAt;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return EnvironmentHealthAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentHealthAttribute(EnvironmentHealthAttribute enumValue)
+        const char* GetNameForEnvironmentHealthAttributeCStr(EnvironmentHealthAttribute enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnvironmentHealthAttribute::Status:
-            return "Status";
-          case EnvironmentHealthAttribute::Color:
-            return "Color";
-          case EnvironmentHealthAttribute::Causes:
-            return "Causes";
-          case EnvironmentHealthAttribute::ApplicationMetrics:
-            return "ApplicationMetrics";
-          case EnvironmentHealthAttribute::InstancesHealth:
-            return "InstancesHealth";
-          case EnvironmentHealthAttribute::All:
-            return "All";
-          case EnvironmentHealthAttribute::HealthStatus:
-            return "HealthStatus";
-          case EnvironmentHealthAttribute::RefreshedAt:
-            return "RefreshedAt";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnvironmentHealthAttribute(EnvironmentHealthAttribute enumValue)
+        {
+          return GetNameForEnvironmentHealthAttributeCStr(enumValue);
         }
 
       } // namespace EnvironmentHealthAttributeMapper
@@ -30,55 +30,86 @@ namespace Aws
       namespace EnvironmentHealthStatusMapper
       {
 
-        static const int NoData_HASH = HashingUtils::HashString("NoData");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Ok_HASH = HashingUtils::HashString("Ok");
-        static const int Info_HASH = HashingUtils::HashString("Info");
-        static const int Warning_HASH = HashingUtils::HashString("Warning");
-        static const int Degraded_HASH = HashingUtils::HashString("Degraded");
-        static const int Severe_HASH = HashingUtils::HashString("Severe");
-        static const int Suspended_HASH = HashingUtils::HashString("Suspended");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NoData",
+          "Unknown",
+          "Pending",
+          "Ok",
+          "Info",
+          "Warning",
+          "Degraded",
+          "Severe",
+          "Suspended",
+        };
 
         EnvironmentHealthStatus GetEnvironmentHealthStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoData_HASH)
-          {
-            return EnvironmentHealthStatus::NoData;
-          }
-          else if (hashCode == Unknown_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnvironmentHealthStatus::Unknown;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return EnvironmentHealthStatus::Pending;
-          }
-          else if (hashCode == Ok_HASH)
-          {
-            return EnvironmentHealthStatus::Ok;
-          }
-          else if (hashCode == Info_HASH)
-          {
-            return EnvironmentHealthStatus::Info;
-          }
-          else if (hashCode == Warning_HASH)
-          {
-            return EnvironmentHealthStatus::Warning;
-          }
-          else if (hashCode == Degraded_HASH)
-          {
-            return EnvironmentHealthStatus::Degraded;
-          }
-          else if (hashCode == Severe_HASH)
-          {
-            return EnvironmentHealthStatus::Severe;
-          }
-          else if (hashCode == Suspended_HASH)
-          {
-            return EnvironmentHealthStatus::Suspended;
+          case -1957259989:
+            if (name == "NoData")
+            {
+              return EnvironmentHealthStatus::NoData;
+            }
+            break;
+          case 1379812394:
+            if (name == "Unknown")
+            {
+              return EnvironmentHealthStatus::Unknown;
+            }
+            break;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return EnvironmentHealthStatus::Pending;
+            }
+            break;
+          case 2556:
+            if (name == "Ok")
+            {
+              return EnvironmentHealthStatus::Ok;
+            }
+            break;
+          case 2283726:
+            if (name == "Info")
+            {
+              return EnvironmentHealthStatus::Info;
+            }
+            break;
+          case -1505867908:
+            if (name == "Warning")
+            {
+              return EnvironmentHealthStatus::Warning;
+            }
+            break;
+          case 752650062:
+            if (name == "Degraded")
+            {
+              return EnvironmentHealthStatus::Degraded;
+            }
+            break;
+          case -1821856108:
+            if (name == "Severe")
+            {
+              return EnvironmentHealthStatus::Severe;
+            }
+            break;
+          case 342339003:
+            if (name == "Suspended")
+            {
+              return EnvironmentHealthStatus::Suspended;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return EnvironmentHealthStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentHealthStatus(EnvironmentHealthStatus enumValue)
+        const char* GetNameForEnvironmentHealthStatusCStr(EnvironmentHealthStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnvironmentHealthStatus::NoData:
-            return "NoData";
-          case EnvironmentHealthStatus::Unknown:
-            return "Unknown";
-          case EnvironmentHealthStatus::Pending:
-            return "Pending";
-          case EnvironmentHealthStatus::Ok:
-            return "Ok";
-          case EnvironmentHealthStatus::Info:
-            return "Info";
-          case EnvironmentHealthStatus::Warning:
-            return "Warning";
-          case EnvironmentHealthStatus::Degraded:
-            return "Degraded";
-          case EnvironmentHealthStatus::Severe:
-            return "Severe";
-          case EnvironmentHealthStatus::Suspended:
-            return "Suspended";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnvironmentHealthStatus(EnvironmentHealthStatus enumValue)
+        {
+          return GetNameForEnvironmentHealthStatusCStr(enumValue);
         }
 
       } // namespace EnvironmentHealthStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace EnvironmentInfoTypeMapper
       {
 
-        static const int tail_HASH = HashingUtils::HashString("tail");
-        static const int bundle_HASH = HashingUtils::HashString("bundle");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "tail",
+          "bundle",
+        };
 
         EnvironmentInfoType GetEnvironmentInfoTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == tail_HASH)
-          {
-            return EnvironmentInfoType::tail;
-          }
-          else if (hashCode == bundle_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnvironmentInfoType::bundle;
+          case 3552336:
+            if (name == "tail")
+            {
+              return EnvironmentInfoType::tail;
+            }
+            break;
+          case -1377881982:
+            if (name == "bundle")
+            {
+              return EnvironmentInfoType::bundle;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EnvironmentInfoType::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentInfoType(EnvironmentInfoType enumValue)
+        const char* GetNameForEnvironmentInfoTypeCStr(EnvironmentInfoType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnvironmentInfoType::tail:
-            return "tail";
-          case EnvironmentInfoType::bundle:
-            return "bundle";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnvironmentInfoType(EnvironmentInfoType enumValue)
+        {
+          return GetNameForEnvironmentInfoTypeCStr(enumValue);
         }
 
       } // namespace EnvironmentInfoTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace EnvironmentStatusMapper
       {
 
-        static const int Launching_HASH = HashingUtils::HashString("Launching");
-        static const int Updating_HASH = HashingUtils::HashString("Updating");
-        static const int Ready_HASH = HashingUtils::HashString("Ready");
-        static const int Terminating_HASH = HashingUtils::HashString("Terminating");
-        static const int Terminated_HASH = HashingUtils::HashString("Terminated");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Launching",
+          "Updating",
+          "Ready",
+          "Terminating",
+          "Terminated",
+        };
 
         EnvironmentStatus GetEnvironmentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Launching_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnvironmentStatus::Launching;
-          }
-          else if (hashCode == Updating_HASH)
-          {
-            return EnvironmentStatus::Updating;
-          }
-          else if (hashCode == Ready_HASH)
-          {
-            return EnvironmentStatus::Ready;
-          }
-          else if (hashCode == Terminating_HASH)
-          {
-            return EnvironmentStatus::Terminating;
-          }
-          else if (hashCode == Terminated_HASH)
-          {
-            return EnvironmentStatus::Terminated;
+          case 1328878383:
+            if (name == "Launching")
+            {
+              return EnvironmentStatus::Launching;
+            }
+            break;
+          case 1387244390:
+            if (name == "Updating")
+            {
+              return EnvironmentStatus::Updating;
+            }
+            break;
+          case 78834051:
+            if (name == "Ready")
+            {
+              return EnvironmentStatus::Ready;
+            }
+            break;
+          case -250712386:
+            if (name == "Terminating")
+            {
+              return EnvironmentStatus::Terminating;
+            }
+            break;
+          case 684649027:
+            if (name == "Terminated")
+            {
+              return EnvironmentStatus::Terminated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return EnvironmentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentStatus(EnvironmentStatus enumValue)
+        const char* GetNameForEnvironmentStatusCStr(EnvironmentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnvironmentStatus::Launching:
-            return "Launching";
-          case EnvironmentStatus::Updating:
-            return "Updating";
-          case EnvironmentStatus::Ready:
-            return "Ready";
-          case EnvironmentStatus::Terminating:
-            return "Terminating";
-          case EnvironmentStatus::Terminated:
-            return "Terminated";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnvironmentStatus(EnvironmentStatus enumValue)
+        {
+          return GetNameForEnvironmentStatusCStr(enumValue);
         }
 
       } // namespace EnvironmentStatusMapper
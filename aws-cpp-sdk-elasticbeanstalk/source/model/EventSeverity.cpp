@@ -30,40 +30,65 @@ namespace Aws
       namespace EventSeverityMapper
       {
 
-        static const int TRACE_HASH = HashingUtils::HashString("TRACE");
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int WARN_HASH = HashingUtils::HashString("WARN");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int FATAL_HASH = HashingUtils::HashString("FATAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TRACE",
+          "DEBUG",
+          "INFO",
+          "WARN",
+          "ERROR",
+          "FATAL",
+        };
 
         EventSeverity GetEventSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRACE_HASH)
-          {
-            return EventSeverity::TRACE;
-          }
-          else if (hashCode == DEBUG__HASH)
-          {
-            return EventSeverity::DEBUG_;
-          }
-          else if (hashCode == INFO_HASH)
-          {
-            return EventSeverity::INFO;
-          }
-          else if (hashCode == WARN_HASH)
-          {
-            return EventSeverity::WARN;
-          }
-          else if (hashCode == ERROR__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventSeverity::ERROR_;
-          }
-          else if (hashCode == FATAL_HASH)
-          {
-            return EventSeverity::FATAL;
+          case 80083237:
+            if (name == "TRACE")
+            {
+              return EventSeverity::TRACE;
+            }
+            break;
+          case 64921139:
+            if (name == "DEBUG")
+            {
+              return EventSeverity::DEBUG_;
+            }
+            break;
+          case 2251950:
+            if (name == "INFO")
+            {
+              return EventSeverity::INFO;
+            }
+            break;
+          case 2656902:
+            if (name == "WARN")
+            {
+              return EventSeverity::WARN;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return EventSeverity::ERROR_;
+            }
+            break;
+          case 66665700:
+            if (name == "FATAL")
+            {
+              return EventSeverity::FATAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return EventSeverity::NOT_SET;
         }
 
-        Aws::String GetNameForEventSeverity(EventSeverity enumValue)
+        const char* GetNameForEventSeverityCStr(EventSeverity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventSeverity::TRACE:
-            return "TRACE";
-          case EventSeverity::DEBUG_:
-            return "DEBUG";
-          case EventSeverity::INFO:
-            return "INFO";
-          case EventSeverity::WARN:
-            return "WARN";
-          case EventSeverity::ERROR_:
-            return "ERROR";
-          case EventSeverity::FATAL:
-            return "FATAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventSeverity(EventSeverity enumValue)
+        {
+          return GetNameForEventSeverityCStr(enumValue);
         }
 
       } // namespace EventSeverityMapper
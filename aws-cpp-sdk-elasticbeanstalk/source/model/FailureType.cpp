@@ -30,45 +30,72 @@ namespace Aws
       namespace FailureTypeMapper
       {
 
-        static const int UpdateCancelled_HASH = HashingUtils::HashString("UpdateCancelled");
-        static const int CancellationFailed_HASH = HashingUtils::HashString("CancellationFailed");
-        static const int RollbackFailed_HASH = HashingUtils::HashString("RollbackFailed");
-        static const int RollbackSuccessful_HASH = HashingUtils::HashString("RollbackSuccessful");
-        static const int InternalFailure_HASH = HashingUtils::HashString("InternalFailure");
-        static const int InvalidEnvironmentState_HASH = HashingUtils::HashString("InvalidEnvironmentState");
-        static const int PermissionsError_HASH = HashingUtils::HashString("PermissionsError");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UpdateCancelled",
+          "CancellationFailed",
+          "RollbackFailed",
+          "RollbackSuccessful",
+          "InternalFailure",
+          "InvalidEnvironmentState",
+          "PermissionsError",
+        };
 
         FailureType GetFailureTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UpdateCancelled_HASH)
-          {
-            return FailureType::UpdateCancelled;
-          }
-          else if (hashCode == CancellationFailed_HASH)
-          {
-            return FailureType::CancellationFailed;
-          }
-          else if (hashCode == RollbackFailed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FailureType::RollbackFailed;
-          }
-          else if (hashCode == RollbackSuccessful_HASH)
-          {
-            return FailureType::RollbackSuccessful;
-          }
-          else if (hashCode == InternalFailure_HASH)
-          {
-            return FailureType::InternalFailure;
-          }
-          else if (hashCode == InvalidEnvironmentState_HASH)
-          {
-            return FailureType::InvalidEnvironmentState;
-          }
-          else if (hashCode == PermissionsError_HASH)
-          {
-            return FailureType::PermissionsError;
+          case 685087336:
+            if (name == "UpdateCancelled")
+            {
+              return FailureType::UpdateCancelled;
+            }
+            break;
+          case -665340096:
+            if (name == "CancellationFailed")
+            {
+              return FailureType::CancellationFailed;
+            }
+            break;
+          case 1251840097:
+            if (name == "RollbackFailed")
+            {
+              return FailureType::RollbackFailed;
+            }
+            break;
+          case 1500116158:
+            if (name == "RollbackSuccessful")
+            {
+              return FailureType::RollbackSuccessful;
+            }
+            break;
+          case 840637421:
+            if (name == "InternalFailure")
+            {
+              return FailureType::InternalFailure;
+            }
+            break;
+          case 1569076789:
+            if (name == "InvalidEnvironmentState")
+            {
+              return FailureType::InvalidEnvironmentState;
+            }
+            break;
+          case 959144964:
+            if (name == "PermissionsError")
+            {
+              return FailureType::PermissionsError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return FailureType::NOT_SET;
         }
 
-        Aws::String GetNameForFailureType(FailureType enumValue)
+        const char* GetNameForFailureTypeCStr(FailureType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FailureType::UpdateCancelled:
-            return "UpdateCancelled";
-          case FailureType::CancellationFailed:
-            return "CancellationFailed";
-          case FailureType::RollbackFailed:
-            return "RollbackFailed";
-          case FailureType::RollbackSuccessful:
-            return "RollbackSuccessful";
-          case FailureType::InternalFailure:
-            return "InternalFailure";
-          case FailureType::InvalidEnvironmentState:
-            return "InvalidEnvironmentState";
-          case FailureType::PermissionsError:
-            return "PermissionsError";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFailureType(FailureType enumValue)
+        {
+          return GetNameForFailureTypeCStr(enumValue);
         }
 
       } // namespace FailureTypeMapper
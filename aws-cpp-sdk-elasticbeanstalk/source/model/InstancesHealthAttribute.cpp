@@ -30,65 +30,100 @@ namespace Aws
       namespace InstancesHealthAttributeMapper
       {
 
-        static const int HealthStatus_HASH = HashingUtils::HashString("HealthStatus");
-        static const int Color_HASH = HashingUtils::HashString("Color");
-        static const int Causes_HASH = HashingUtils::HashString("Causes");
-        static const int ApplicationMetrics_HASH = HashingUtils::HashString("ApplicationMetrics");
-        static const int RefreshedAt_HASH = HashingUtils::HashString("RefreshedAt");
-        static const int LaunchedAt_HASH = HashingUtils::HashString("LaunchedAt");
-        static const int System_HASH = HashingUtils::HashString("System");
-        static const int Deployment_HASH = HashingUtils::HashString("Deployment");
-        static const int AvailabilityZone_HASH = HashingUtils::HashString("AvailabilityZone");
-        static const int InstanceType_HASH = HashingUtils::HashString("InstanceType");
-        static const int All_HASH = HashingUtils::HashString("All");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HealthStatus",
+          "Color",
+          "Causes",
+          "ApplicationMetrics",
+          "RefreshedAt",
+          "LaunchedAt",
+          "System",
+          "Deployment",
+          "AvailabilityZone",
+          "InstanceType",
+          "All",
+        };
 
         InstancesHealthAttribute GetInstancesHealthAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HealthStatus_HASH)
-          {
-            return InstancesHealthAttribute::HealthStatus;
-          }
-          else if (hashCode == Color_HASH)
-          {
-            return InstancesHealthAttribute::Color;
-          }
-          else if (hashCode == Causes_HASH)
-          {
-            return InstancesHealthAttribute::Causes;
-          }
-          else if (hashCode == ApplicationMetrics_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstancesHealthAttribute::ApplicationMetrics;
-          }
-          else if (hashCode == RefreshedAt_HASH)
-          {
-            return InstancesHealthAttribute::RefreshedAt;
-          }
-          else if (hashCode == LaunchedAt_HASH)
-          {
-            return InstancesHealthAttribute::LaunchedAt;
-          }
-          else if (hashCode == System_HASH)
-          {
-            return InstancesHealthAttribute::System;
-          }
-          else if (hashCode == Deployment_HASH)
-          {
-            return InstancesHealthAttribute::Deployment;
-          }
-          else if (hashCode == AvailabilityZone_HASH)
-          {
-            return InstancesHealthAttribute::AvailabilityZone;
-          }
-          else if (hashCode == InstanceType_HASH)
-          {
-            return InstancesHealthAttribute::InstanceType;
-          }
-          else if (hashCode == All_HASH)
-          {
-            return InstancesHealthAttribute::All;
+          case 682024334:
+            if (name == "HealthStatus")
+            {
+              return InstancesHealthAttribute::HealthStatus;
+            }
+            break;
+          case 65290051:
+            if (name == "Color")
+            {
+              return InstancesHealthAttribute::Color;
+            }
+            break;
+          case 2011333962:
+            if (name == "Causes")
+            {
+              return InstancesHealthAttribute::Causes;
+            }
+            break;
+          case -921733773:
+            if (name == "ApplicationMetrics")
+            {
+              return InstancesHealthAttribute::ApplicationMetrics;
+            }
+            break;
+          case 281067117:
+            if (name == "RefreshedAt")
+            {
+              return InstancesHealthAttribute::RefreshedAt;
+            }
+            break;
+          case -1754572923:
+            if (name == "LaunchedAt")
+            {
+              return InstancesHealthAttribute::LaunchedAt;
+            }
+            break;
+          case -1803461041:
+            if (name == "System")
+            {
+              return InstancesHealthAttribute::System;
+            }
+            break;
+          case -361982235:
+            if (name == "Deployment")
+            {
+              return InstancesHealthAttribute::Deployment;
+            }
+            break;
+          case 1777257415:
+            if (name == "AvailabilityZone")
+            {
+              return InstancesHealthAttribute::AvailabilityZone;
+            }
+            break;
+          case -573335153:
+            if (name == "InstanceType")
+            {
+              return InstancesHealthAttribute::InstanceType;
+            }
+            break;
+          case 65921:
+            if (name == "All")
+            {
+              return InstancesHealthAttribute::All;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return InstancesHealthAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForInstancesHealthAttribute(InstancesHealthAttribute enumValue)
+        const char* GetNameForInstancesHealthAttributeCStr(InstancesHealthAttribute enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstancesHealthAttribute::HealthStatus:
-            return "HealthStatus";
-          case InstancesHealthAttribute::Color:
-            return "Color";
-          case InstancesHealthAttribute::Causes:
-            return "Causes";
-          case InstancesHealthAttribute::ApplicationMetrics:
-            return "ApplicationMetrics";
-          case InstancesHealthAttribute::RefreshedAt:
-            return "RefreshedAt";
-          case InstancesHealthAttribute::LaunchedAt:
-            return "LaunchedAt";
-          case InstancesHealthAttribute::System:
-            return "System";
-          case InstancesHealthAttribute::Deployment:
-            return "Deployment";
-          case InstancesHealthAttribute::AvailabilityZone:
-            return "AvailabilityZone";
-          case InstancesHealthAttribute::InstanceType:
-            return "InstanceType";
-          case InstancesHealthAttribute::All:
-            return "All";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstancesHealthAttribute(InstancesHealthAttribute enumValue)
+        {
+          return GetNameForInstancesHealthAttributeCStr(enumValue);
         }
 
       } // namespace InstancesHealthAttributeMapper
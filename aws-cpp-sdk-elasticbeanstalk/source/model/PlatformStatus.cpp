@@ -30,35 +30,58 @@ namespace Aws
       namespace PlatformStatusMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Ready_HASH = HashingUtils::HashString("Ready");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Creating",
+          "Failed",
+          "Ready",
+          "Deleting",
+          "Deleted",
+        };
 
         PlatformStatus GetPlatformStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlatformStatus::Creating;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return PlatformStatus::Failed;
-          }
-          else if (hashCode == Ready_HASH)
-          {
-            return PlatformStatus::Ready;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return PlatformStatus::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return PlatformStatus::Deleted;
+          case 1885065945:
+            if (name == "Creating")
+            {
+              return PlatformStatus::Creating;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return PlatformStatus::Failed;
+            }
+            break;
+          case 78834051:
+            if (name == "Ready")
+            {
+              return PlatformStatus::Ready;
+            }
+            break;
+          case 884361160:
+            if (name == "Deleting")
+            {
+              return PlatformStatus::Deleting;
+            }
+            break;
+          case -1079851015:
+            if (name == "Deleted")
+            {
+              return PlatformStatus::Deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return PlatformStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPlatformStatus(PlatformStatus enumValue)
+        const char* GetNameForPlatformStatusCStr(PlatformStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlatformStatus::Creating:
-            return "Creating";
-          case PlatformStatus::Failed:
-            return "Failed";
-          case PlatformStatus::Ready:
-            return "Ready";
-          case PlatformStatus::Deleting:
-            return "Deleting";
-          case PlatformStatus::Deleted:
-            return "Deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlatformStatus(PlatformStatus enumValue)
+        {
+          return GetNameForPlatformStatusCStr(enumValue);
         }
 
       } // namespace PlatformStatusMapper
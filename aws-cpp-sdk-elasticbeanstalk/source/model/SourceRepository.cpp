@@ -30,20 +30,37 @@ namespace Aws
       namespace SourceRepositoryMapper
       {
 
-        static const int CodeCommit_HASH = HashingUtils::HashString("CodeCommit");
-        static const int S3_HASH = HashingUtils::HashString("S3");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CodeCommit",
+          "S3",
+        };
 
         SourceRepository GetSourceRepositoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CodeCommit_HASH)
-          {
-            return SourceRepository::CodeCommit;
-          }
-          else if (hashCode == S3_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SourceRepository::S3;
+          case 609466788:
+            if (name == "CodeCommit")
+            {
+              return SourceRepository::CodeCommit;
+            }
+            break;
+          case 2624:
+            if (name == "S3")
+            {
+              return SourceRepository::S3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SourceRepository::NOT_SET;
         }
 
-        Aws::String GetNameForSourceRepository(SourceRepository enumValue)
+        const char* GetNameForSourceRepositoryCStr(SourceRepository enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SourceRepository::CodeCommit:
-            return "CodeCommit";
-          case SourceRepository::S3:
-            return "S3";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSourceRepository(SourceRepository enumValue)
+        {
+          return GetNameForSourceRepositoryCStr(enumValue);
         }
 
       } // namespace SourceRepositoryMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int Git_HASH = HashingUtils::HashString("Git");
-        static const int Zip_HASH = HashingUtils::HashString("Zip");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Git",
+          "Zip",
+        };
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Git_HASH)
-          {
-            return SourceType::Git;
-          }
-          else if (hashCode == Zip_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SourceType::Zip;
+          case 71602:
+            if (name == "Git")
+            {
+              return SourceType::Git;
+            }
+            break;
+          case 89857:
+            if (name == "Zip")
+            {
+              return SourceType::Zip;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceTypeCStr(SourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SourceType::Git:
-            return "Git";
-          case SourceType::Zip:
-            return "Zip";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSourceType(SourceType enumValue)
+        {
+          return GetNameForSourceTypeCStr(enumValue);
         }
 
       } // namespace SourceTypeMapper
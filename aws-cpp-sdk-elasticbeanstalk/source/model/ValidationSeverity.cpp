@@ -30,20 +30,37 @@ namespace Aws
       namespace ValidationSeverityMapper
       {
 
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int warning_HASH = HashingUtils::HashString("warning");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "error",
+          "warning",
+        };
 
         ValidationSeverity GetValidationSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == error_HASH)
-          {
-            return ValidationSeverity::error;
-          }
-          else if (hashCode == warning_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ValidationSeverity::warning;
+          case 96784904:
+            if (name == "error")
+            {
+              return ValidationSeverity::error;
+            }
+            break;
+          case 1124446108:
+            if (name == "warning")
+            {
+              return ValidationSeverity::warning;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ValidationSeverity::NOT_SET;
         }
 
-        Aws::String GetNameForValidationSeverity(ValidationSeverity enumValue)
+        const char* GetNameForValidationSeverityCStr(ValidationSeverity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ValidationSeverity::error:
-            return "error";
-          case ValidationSeverity::warning:
-            return "warning";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForValidationSeverity(ValidationSeverity enumValue)
+        {
+          return GetNameForValidationSeverityCStr(enumValue);
         }
 
       } // namespace ValidationSeverityMapper
@@ -38,6 +38,11 @@ namespace LifeCycleStateMapper
 AWS_EFS_API LifeCycleState GetLifeCycleStateForName(const Aws::String& name);
 
 AWS_EFS_API Aws::String GetNameForLifeCycleState(LifeCycleState value);
+
+/**
+ * Same as GetNameForLifeCycleState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EFS_API const char* GetNameForLifeCycleStateCStr(LifeCycleState value);
 } // namespace LifeCycleStateMapper
 } // namespace Model
 } // namespace EFS
@@ -35,6 +35,11 @@ namespace PerformanceModeMapper
 AWS_EFS_API PerformanceMode GetPerformanceModeForName(const Aws::String& name);
 
 AWS_EFS_API Aws::String GetNameForPerformanceMode(PerformanceMode value);
+
+/**
+ * Same as GetNameForPerformanceMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EFS_API const char* GetNameForPerformanceModeCStr(PerformanceMode value);
 } // namespace PerformanceModeMapper
 } // namespace Model
 } // namespace EFS
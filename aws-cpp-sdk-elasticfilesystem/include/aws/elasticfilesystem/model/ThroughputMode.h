@@ -35,6 +35,11 @@ namespace ThroughputModeMapper
 AWS_EFS_API ThroughputMode GetThroughputModeForName(const Aws::String& name);
 
 AWS_EFS_API Aws::String GetNameForThroughputMode(ThroughputMode value);
+
+/**
+ * Same as GetNameForThroughputMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EFS_API const char* GetNameForThroughputModeCStr(ThroughputMode value);
 } // namespace ThroughputModeMapper
 } // namespace Model
 } // namespace EFS
@@ -30,35 +30,58 @@ namespace Aws
       namespace LifeCycleStateMapper
       {
 
-        static const int creating_HASH = HashingUtils::HashString("creating");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int updating_HASH = HashingUtils::HashString("updating");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "creating",
+          "available",
+          "updating",
+          "deleting",
+          "deleted",
+        };
 
         LifeCycleState GetLifeCycleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == creating_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LifeCycleState::creating;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return LifeCycleState::available;
-          }
-          else if (hashCode == updating_HASH)
-          {
-            return LifeCycleState::updating;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return LifeCycleState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return LifeCycleState::deleted;
+          case 1820421817:
+            if (name == "creating")
+            {
+              return LifeCycleState::creating;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return LifeCycleState::available;
+            }
+            break;
+          case 1322600262:
+            if (name == "updating")
+            {
+              return LifeCycleState::updating;
+            }
+            break;
+          case 819717032:
+            if (name == "deleting")
+            {
+              return LifeCycleState::deleting;
+            }
+            break;
+          case 1550463001:
+            if (name == "deleted")
+            {
+              return LifeCycleState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return LifeCycleState::NOT_SET;
         }
 
-        Aws::String GetNameForLifeCycleState(LifeCycleState enumValue)
+        const char* GetNameForLifeCycleStateCStr(LifeCycleState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LifeCycleState::creating:
-            return "creating";
-          case LifeCycleState::available:
-            return "available";
-          case LifeCycleState::updating:
-            return "updating";
-          case LifeCycleState::deleting:
-            return "deleting";
-          case LifeCycleState::deleted:
-            return "deleted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLifeCycleState(LifeCycleState enumValue)
+        {
+          return GetNameForLifeCycleStateCStr(enumValue);
         }
 
       } // namespace LifeCycleStateMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PerformanceModeMapper
       {
 
-        static const int generalPurpose_HASH = HashingUtils::HashString("generalPurpose");
-        static const int maxIO_HASH = HashingUtils::HashString("maxIO");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "generalPurpose",
+          "maxIO",
+        };
 
         PerformanceMode GetPerformanceModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == generalPurpose_HASH)
-          {
-            return PerformanceMode::generalPurpose;
-          }
-          else if (hashCode == maxIO_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PerformanceMode::maxIO;
+          case 640890646:
+            if (name == "generalPurpose")
+            {
+              return PerformanceMode::generalPurpose;
+            }
+            break;
+          case 103671178:
+            if (name == "maxIO")
+            {
+              return PerformanceMode::maxIO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PerformanceMode::NOT_SET;
         }
 
-        Aws::String GetNameForPerformanceMode(PerformanceMode enumValue)
+        const char* GetNameForPerformanceModeCStr(PerformanceMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PerformanceMode::generalPurpose:
-            return "generalPurpose";
-          case PerformanceMode::maxIO:
-            return "maxIO";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPerformanceMode(PerformanceMode enumValue)
+        {
+          return GetNameForPerformanceModeCStr(enumValue);
         }
 
       } // namespace PerformanceModeMapper
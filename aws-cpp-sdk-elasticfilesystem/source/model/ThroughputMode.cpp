@@ -30,20 +30,37 @@ namespace Aws
       namespace ThroughputModeMapper
       {
 
-        static const int bursting_HASH = HashingUtils::HashString("bursting");
-        static const int provisioned_HASH = HashingUtils::HashString("provisioned");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "bursting",
+          "provisioned",
+        };
 
         ThroughputMode GetThroughputModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == bursting_HASH)
-          {
-            return ThroughputMode::bursting;
-          }
-          else if (hashCode == provisioned_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ThroughputMode::provisioned;
+          case -1166042430:
+            if (name == "bursting")
+            {
+              return ThroughputMode::bursting;
+            }
+            break;
+          case -1797209036:
+            if (name == "provisioned")
+            {
+              return ThroughputMode::provisioned;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ThroughputMode::NOT_SET;
         }
 
-        Aws::String GetNameForThroughputMode(ThroughputMode enumValue)
+        const char* GetNameForThroughputModeCStr(ThroughputMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ThroughputMode::bursting:
-            return "bursting";
-          case ThroughputMode::provisioned:
-            return "provisioned";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForThroughputMode(ThroughputMode enumValue)
+        {
+          return GetNameForThroughputModeCStr(enumValue);
         }
 
       } // namespace ThroughputModeMapper
@@ -38,6 +38,11 @@ namespace ActionTypeEnumMapper
 AWS_ELASTICLOADBALANCINGV2_API ActionTypeEnum GetActionTypeEnumForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForActionTypeEnum(ActionTypeEnum value);
+
+/**
+ * Same as GetNameForActionTypeEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForActionTypeEnumCStr(ActionTypeEnum value);
 } // namespace ActionTypeEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
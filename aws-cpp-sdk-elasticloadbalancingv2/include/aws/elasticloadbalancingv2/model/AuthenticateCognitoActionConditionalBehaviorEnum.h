@@ -36,6 +36,11 @@ namespace AuthenticateCognitoActionConditionalBehaviorEnumMapper
 AWS_ELASTICLOADBALANCINGV2_API AuthenticateCognitoActionConditionalBehaviorEnum GetAuthenticateCognitoActionConditionalBehaviorEnumForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForAuthenticateCognitoActionConditionalBehaviorEnum(AuthenticateCognitoActionConditionalBehaviorEnum value);
+
+/**
+ * Same as GetNameForAuthenticateCognitoActionConditionalBehaviorEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForAuthenticateCognitoActionConditionalBehaviorEnumCStr(AuthenticateCognitoActionConditionalBehaviorEnum value);
 } // namespace AuthenticateCognitoActionConditionalBehaviorEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
@@ -36,6 +36,11 @@ namespace AuthenticateOidcActionConditionalBehaviorEnumMapper
 AWS_ELASTICLOADBALANCINGV2_API AuthenticateOidcActionConditionalBehaviorEnum GetAuthenticateOidcActionConditionalBehaviorEnumForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForAuthenticateOidcActionConditionalBehaviorEnum(AuthenticateOidcActionConditionalBehaviorEnum value);
+
+/**
+ * Same as GetNameForAuthenticateOidcActionConditionalBehaviorEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForAuthenticateOidcActionConditionalBehaviorEnumCStr(AuthenticateOidcActionConditionalBehaviorEnum value);
 } // namespace AuthenticateOidcActionConditionalBehaviorEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
@@ -35,6 +35,11 @@ namespace IpAddressTypeMapper
 AWS_ELASTICLOADBALANCINGV2_API IpAddressType GetIpAddressTypeForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForIpAddressType(IpAddressType value);
+
+/**
+ * Same as GetNameForIpAddressType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForIpAddressTypeCStr(IpAddressType value);
 } // namespace IpAddressTypeMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
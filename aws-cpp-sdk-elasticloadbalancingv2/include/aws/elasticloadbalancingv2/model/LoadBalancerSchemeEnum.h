@@ -35,6 +35,11 @@ namespace LoadBalancerSchemeEnumMapper
 AWS_ELASTICLOADBALANCINGV2_API LoadBalancerSchemeEnum GetLoadBalancerSchemeEnumForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForLoadBalancerSchemeEnum(LoadBalancerSchemeEnum value);
+
+/**
+ * Same as GetNameForLoadBalancerSchemeEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForLoadBalancerSchemeEnumCStr(LoadBalancerSchemeEnum value);
 } // namespace LoadBalancerSchemeEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
@@ -37,6 +37,11 @@ namespace LoadBalancerStateEnumMapper
 AWS_ELASTICLOADBALANCINGV2_API LoadBalancerStateEnum GetLoadBalancerStateEnumForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForLoadBalancerStateEnum(LoadBalancerStateEnum value);
+
+/**
+ * Same as GetNameForLoadBalancerStateEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForLoadBalancerStateEnumCStr(LoadBalancerStateEnum value);
 } // namespace LoadBalancerStateEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
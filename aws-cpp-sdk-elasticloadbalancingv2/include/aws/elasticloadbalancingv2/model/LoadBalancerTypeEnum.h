@@ -35,6 +35,11 @@ namespace LoadBalancerTypeEnumMapper
 AWS_ELASTICLOADBALANCINGV2_API LoadBalancerTypeEnum GetLoadBalancerTypeEnumForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForLoadBalancerTypeEnum(LoadBalancerTypeEnum value);
+
+/**
+ * Same as GetNameForLoadBalancerTypeEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForLoadBalancerTypeEnumCStr(LoadBalancerTypeEnum value);
 } // namespace LoadBalancerTypeEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
@@ -36,6 +36,11 @@ namespace ProtocolEnumMapper
 AWS_ELASTICLOADBALANCINGV2_API ProtocolEnum GetProtocolEnumForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForProtocolEnum(ProtocolEnum value);
+
+/**
+ * Same as GetNameForProtocolEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForProtocolEnumCStr(ProtocolEnum value);
 } // namespace ProtocolEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
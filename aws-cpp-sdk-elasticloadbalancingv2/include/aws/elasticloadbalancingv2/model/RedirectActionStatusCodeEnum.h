@@ -35,6 +35,11 @@ namespace RedirectActionStatusCodeEnumMapper
 AWS_ELASTICLOADBALANCINGV2_API RedirectActionStatusCodeEnum GetRedirectActionStatusCodeEnumForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForRedirectActionStatusCodeEnum(RedirectActionStatusCodeEnum value);
+
+/**
+ * Same as GetNameForRedirectActionStatusCodeEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForRedirectActionStatusCodeEnumCStr(RedirectActionStatusCodeEnum value);
 } // namespace RedirectActionStatusCodeEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
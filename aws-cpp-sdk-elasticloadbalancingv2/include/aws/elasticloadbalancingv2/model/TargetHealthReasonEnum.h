@@ -45,6 +45,11 @@ namespace TargetHealthReasonEnumMapper
 AWS_ELASTICLOADBALANCINGV2_API TargetHealthReasonEnum GetTargetHealthReasonEnumForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForTargetHealthReasonEnum(TargetHealthReasonEnum value);
+
+/**
+ * Same as GetNameForTargetHealthReasonEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForTargetHealthReasonEnumCStr(TargetHealthReasonEnum value);
 } // namespace TargetHealthReasonEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
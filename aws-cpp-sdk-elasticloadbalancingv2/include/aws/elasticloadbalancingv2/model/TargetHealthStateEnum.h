@@ -39,6 +39,11 @@ namespace TargetHealthStateEnumMapper
 AWS_ELASTICLOADBALANCINGV2_API TargetHealthStateEnum GetTargetHealthStateEnumForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForTargetHealthStateEnum(TargetHealthStateEnum value);
+
+/**
+ * Same as GetNameForTargetHealthStateEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForTargetHealthStateEnumCStr(TargetHealthStateEnum value);
 } // namespace TargetHealthStateEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
@@ -36,6 +36,11 @@ namespace TargetTypeEnumMapper
 AWS_ELASTICLOADBALANCINGV2_API TargetTypeEnum GetTargetTypeEnumForName(const Aws::String& name);
 
 AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForTargetTypeEnum(TargetTypeEnum value);
+
+/**
+ * Same as GetNameForTargetTypeEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForTargetTypeEnumCStr(TargetTypeEnum value);
 } // namespace TargetTypeEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
@@ -30,35 +30,58 @@ namespace Aws
       namespace ActionTypeEnumMapper
       {
 
-        static const int forward_HASH = HashingUtils::HashString("forward");
-        static const int authenticate_oidc_HASH = HashingUtils::HashString("authenticate-oidc");
-        static const int authenticate_cognito_HASH = HashingUtils::HashString("authenticate-cognito");
-        static const int redirect_HASH = HashingUtils::HashString("redirect");
-        static const int fixed_response_HASH = HashingUtils::HashString("fixed-response");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "forward",
+          "authenticate-oidc",
+          "authenticate-cognito",
+          "redirect",
+          "fixed-response",
+        };
 
         ActionTypeEnum GetActionTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == forward_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionTypeEnum::forward;
-          }
-          else if (hashCode == authenticate_oidc_HASH)
-          {
-            return ActionTypeEnum::authenticate_oidc;
-          }
-          else if (hashCode == authenticate_cognito_HASH)
-          {
-            return ActionTypeEnum::authenticate_cognito;
-          }
-          else if (hashCode == redirect_HASH)
-          {
-            return ActionTypeEnum::redirect;
-          }
-          else if (hashCode == fixed_response_HASH)
-          {
-            return ActionTypeEnum::fixed_response;
+          case -677145915:
+            if (name == "forward")
+            {
+              return ActionTypeEnum::forward;
+            }
+            break;
+          case -1921514543:
+            if (name == "authenticate-oidc")
+            {
+              return ActionTypeEnum::authenticate_oidc;
+            }
+            break;
+          case 1894206073:
+            if (name == "authenticate-cognito")
+            {
+              return ActionTypeEnum::authenticate_cognito;
+            }
+            break;
+          case -776144932:
+            if (name == "redirect")
+            {
+              return ActionTypeEnum::redirect;
+            }
+            break;
+          case -1811230086:
+            if (name == "fixed-response")
+            {
+              return ActionTypeEnum::fixed_response;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ActionTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForActionTypeEnum(ActionTypeEnum enumValue)
+        const char* GetNameForActionTypeEnumCStr(ActionTypeEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionTypeEnum::forward:
-            return "forward";
-          case ActionTypeEnum::authenticate_oidc:
-            return "authenticate-oidc";
-          case ActionTypeEnum::authenticate_cognito:
-            return "authenticate-cognito";
-          case ActionTypeEnum::redirect:
-            return "redirect";
-          case ActionTypeEnum::fixed_response:
-            return "fixed-response";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionTypeEnum(ActionTypeEnum enumValue)
+        {
+          return GetNameForActionTypeEnumCStr(enumValue);
         }
 
       } // namespace ActionTypeEnumMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AuthenticateCognitoActionConditionalBehaviorEnumMapper
       {
 
-        static const int deny_HASH = HashingUtils::HashString("deny");
-        static const int allow_HASH = HashingUtils::HashString("allow");
-        static const int authenticate_HASH = HashingUtils::HashString("authenticate");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "deny",
+          "allow",
+          "authenticate",
+        };
 
         AuthenticateCognitoActionConditionalBehaviorEnum GetAuthenticateCognitoActionConditionalBehaviorEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == deny_HASH)
-          {
-            return AuthenticateCognitoActionConditionalBehaviorEnum::deny;
-          }
-          else if (hashCode == allow_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthenticateCognitoActionConditionalBehaviorEnum::allow;
-          }
-          else if (hashCode == authenticate_HASH)
-          {
-            return AuthenticateCognitoActionConditionalBehaviorEnum::authenticate;
+          case 3079692:
+            if (name == "deny")
+            {
+              return AuthenticateCognitoActionConditionalBehaviorEnum::deny;
+            }
+            break;
+          case 92906313:
+            if (name == "allow")
+            {
+              return AuthenticateCognitoActionConditionalBehaviorEnum::allow;
+            }
+            break;
+          case 1721116373:
+            if (name == "authenticate")
+            {
+              return AuthenticateCognitoActionConditionalBehaviorEnum::authenticate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AuthenticateCognitoActionConditionalBehaviorEnum::NOT_SET;
         }
 
-        Aws::String GetNameForAuthenticateCognitoActionConditionalBehaviorEnum(AuthenticateCognitoActionConditionalBehaviorEnum enumValue)
+        const char* GetNameForAuthenticateCognitoActionConditionalBehaviorEnumCStr(AuthenticateCognitoActionConditionalBehaviorEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthenticateCognitoActionConditionalBehaviorEnum::deny:
-            return "deny";
-          case AuthenticateCognitoActionConditionalBehaviorEnum::allow:
-            return "allow";
-          case AuthenticateCognitoActionConditionalBehaviorEnum::authenticate:
-            return "authenticate";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthenticateCognitoActionConditionalBehaviorEnum(AuthenticateCognitoActionConditionalBehaviorEnum enumValue)
+        {
+          return GetNameForAuthenticateCognitoActionConditionalBehaviorEnumCStr(enumValue);
         }
 
       } // namespace AuthenticateCognitoActionConditionalBehaviorEnumMapper
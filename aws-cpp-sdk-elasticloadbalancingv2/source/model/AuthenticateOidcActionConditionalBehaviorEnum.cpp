@@ -30,25 +30,44 @@ namespace Aws
       namespace AuthenticateOidcActionConditionalBehaviorEnumMapper
       {
 
-        static const int deny_HASH = HashingUtils::HashString("deny");
-        static const int allow_HASH = HashingUtils::HashString("allow");
-        static const int authenticate_HASH = HashingUtils::HashString("authenticate");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "deny",
+          "allow",
+          "authenticate",
+        };
 
         AuthenticateOidcActionConditionalBehaviorEnum GetAuthenticateOidcActionConditionalBehaviorEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == deny_HASH)
-          {
-            return AuthenticateOidcActionConditionalBehaviorEnum::deny;
-          }
-          else if (hashCode == allow_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthenticateOidcActionConditionalBehaviorEnum::allow;
-          }
-          else if (hashCode == authenticate_HASH)
-          {
-            return AuthenticateOidcActionConditionalBehaviorEnum::authenticate;
+          case 3079692:
+            if (name == "deny")
+            {
+              return AuthenticateOidcActionConditionalBehaviorEnum::deny;
+            }
+            break;
+          case 92906313:
+            if (name == "allow")
+            {
+              return AuthenticateOidcActionConditionalBehaviorEnum::allow;
+            }
+            break;
+          case 1721116373:
+            if (name == "authenticate")
+            {
+              return AuthenticateOidcActionConditionalBehaviorEnum::authenticate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AuthenticateOidcActionConditionalBehaviorEnum::NOT_SET;
         }
 
-        Aws::String GetNameForAuthenticateOidcActionConditionalBehaviorEnum(AuthenticateOidcActionConditionalBehaviorEnum enumValue)
+        const char* GetNameForAuthenticateOidcActionConditionalBehaviorEnumCStr(AuthenticateOidcActionConditionalBehaviorEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthenticateOidcActionConditionalBehaviorEnum::deny:
-            return "deny";
-          case AuthenticateOidcActionConditionalBehaviorEnum::allow:
-            return "allow";
-          case AuthenticateOidcActionConditionalBehaviorEnum::authenticate:
-            return "authenticate";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthenticateOidcActionConditionalBehaviorEnum(AuthenticateOidcActionConditionalBehaviorEnum enumValue)
+        {
+          return GetNameForAuthenticateOidcActionConditionalBehaviorEnumCStr(enumValue);
         }
 
       } // namespace AuthenticateOidcActionConditionalBehaviorEnumMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace IpAddressTypeMapper
       {
 
-        static const int ipv4_HASH = HashingUtils::HashString("ipv4");
-        static const int dualstack_HASH = HashingUtils::HashString("dualstack");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ipv4",
+          "dualstack",
+        };
 
         IpAddressType GetIpAddressTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ipv4_HASH)
-          {
-            return IpAddressType::ipv4;
-          }
-          else if (hashCode == dualstack_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IpAddressType::dualstack;
+          case 3239397:
+            if (name == "ipv4")
+            {
+              return IpAddressType::ipv4;
+            }
+            break;
+          case 783775628:
+            if (name == "dualstack")
+            {
+              return IpAddressType::dualstack;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return IpAddressType::NOT_SET;
         }
 
-        Aws::String GetNameForIpAddressType(IpAddressType enumValue)
+        const char* GetNameForIpAddressTypeCStr(IpAddressType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IpAddressType::ipv4:
-            return "ipv4";
-          case IpAddressType::dualstack:
-            return "dualstack";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIpAddressType(IpAddressType enumValue)
+        {
+          return GetNameForIpAddressTypeCStr(enumValue);
         }
 
       } // namespace IpAddressTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace LoadBalancerSchemeEnumMapper
       {
 
-        static const int internet_facing_HASH = HashingUtils::HashString("internet-facing");
-        static const int internal_HASH = HashingUtils::HashString("internal");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "internet-facing",
+          "internal",
+        };
 
         LoadBalancerSchemeEnum GetLoadBalancerSchemeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == internet_facing_HASH)
-          {
-            return LoadBalancerSchemeEnum::internet_facing;
-          }
-          else if (hashCode == internal_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerSchemeEnum::internal;
+          case -616892442:
+            if (name == "internet-facing")
+            {
+              return LoadBalancerSchemeEnum::internet_facing;
+            }
+            break;
+          case 570410685:
+            if (name == "internal")
+            {
+              return LoadBalancerSchemeEnum::internal;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LoadBalancerSchemeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerSchemeEnum(LoadBalancerSchemeEnum enumValue)
+        const char* GetNameForLoadBalancerSchemeEnumCStr(LoadBalancerSchemeEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerSchemeEnum::internet_facing:
-            return "internet-facing";
-          case LoadBalancerSchemeEnum::internal:
-            return "internal";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerSchemeEnum(LoadBalancerSchemeEnum enumValue)
+        {
+          return GetNameForLoadBalancerSchemeEnumCStr(enumValue);
         }
 
       } // namespace LoadBalancerSchemeEnumMapper
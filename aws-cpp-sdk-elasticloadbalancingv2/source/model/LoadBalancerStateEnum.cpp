@@ -30,30 +30,51 @@ namespace Aws
       namespace LoadBalancerStateEnumMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int provisioning_HASH = HashingUtils::HashString("provisioning");
-        static const int active_impaired_HASH = HashingUtils::HashString("active_impaired");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "active",
+          "provisioning",
+          "active_impaired",
+          "failed",
+        };
 
         LoadBalancerStateEnum GetLoadBalancerStateEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
-          {
-            return LoadBalancerStateEnum::active;
-          }
-          else if (hashCode == provisioning_HASH)
-          {
-            return LoadBalancerStateEnum::provisioning;
-          }
-          else if (hashCode == active_impaired_HASH)
-          {
-            return LoadBalancerStateEnum::active_impaired;
-          }
-          else if (hashCode == failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerStateEnum::failed;
+          case -1422950650:
+            if (name == "active")
+            {
+              return LoadBalancerStateEnum::active;
+            }
+            break;
+          case 121098989:
+            if (name == "provisioning")
+            {
+              return LoadBalancerStateEnum::provisioning;
+            }
+            break;
+          case -1913193418:
+            if (name == "active_impaired")
+            {
+              return LoadBalancerStateEnum::active_impaired;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return LoadBalancerStateEnum::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return LoadBalancerStateEnum::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerStateEnum(LoadBalancerStateEnum enumValue)
+        const char* GetNameForLoadBalancerStateEnumCStr(LoadBalancerStateEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerStateEnum::active:
-            return "active";
-          case LoadBalancerStateEnum::provisioning:
-            return "provisioning";
-          case LoadBalancerStateEnum::active_impaired:
-            return "active_impaired";
-          case LoadBalancerStateEnum::failed:
-            return "failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerStateEnum(LoadBalancerStateEnum enumValue)
+        {
+          return GetNameForLoadBalancerStateEnumCStr(enumValue);
         }
 
       } // namespace LoadBalancerStateEnumMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace LoadBalancerTypeEnumMapper
       {
 
-        static const int application_HASH = HashingUtils::HashString("application");
-        static const int network_HASH = HashingUtils::HashString("network");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "application",
+          "network",
+        };
 
         LoadBalancerTypeEnum GetLoadBalancerTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == application_HASH)
-          {
-            return LoadBalancerTypeEnum::application;
-          }
-          else if (hashCode == network_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerTypeEnum::network;
+          case 1554253136:
+            if (name == "application")
+            {
+              return LoadBalancerTypeEnum::application;
+            }
+            break;
+          case 1843485230:
+            if (name == "network")
+            {
+              return LoadBalancerTypeEnum::network;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LoadBalancerTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerTypeEnum(LoadBalancerTypeEnum enumValue)
+        const char* GetNameForLoadBalancerTypeEnumCStr(LoadBalancerTypeEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerTypeEnum::application:
-            return "application";
-          case LoadBalancerTypeEnum::network:
-            return "network";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerTypeEnum(LoadBalancerTypeEnum enumValue)
+        {
+          return GetNameForLoadBalancerTypeEnumCStr(enumValue);
         }
 
       } // namespace LoadBalancerTypeEnumMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ProtocolEnumMapper
       {
 
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-        static const int HTTPS_HASH = HashingUtils::HashString("HTTPS");
-        static const int TCP_HASH = HashingUtils::HashString("TCP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HTTP",
+          "HTTPS",
+          "TCP",
+        };
 
         ProtocolEnum GetProtocolEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_HASH)
-          {
-            return ProtocolEnum::HTTP;
-          }
-          else if (hashCode == HTTPS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProtocolEnum::HTTPS;
-          }
-          else if (hashCode == TCP_HASH)
-          {
-            return ProtocolEnum::TCP;
+          case 2228360:
+            if (name == "HTTP")
+            {
+              return ProtocolEnum::HTTP;
+            }
+            break;
+          case 69079243:
+            if (name == "HTTPS")
+            {
+              return ProtocolEnum::HTTPS;
+            }
+            break;
+          case 82881:
+            if (name == "TCP")
+            {
+              return ProtocolEnum::TCP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ProtocolEnum::NOT_SET;
         }
 
-        Aws::String GetNameForProtocolEnum(ProtocolEnum enumValue)
+        const char* GetNameForProtocolEnumCStr(ProtocolEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProtocolEnum::HTTP:
-            return "HTTP";
-          case ProtocolEnum::HTTPS:
-            return "HTTPS";
-          case ProtocolEnum::TCP:
-            return "TCP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProtocolEnum(ProtocolEnum enumValue)
+        {
+          return GetNameForProtocolEnumCStr(enumValue);
         }
 
       } // namespace ProtocolEnumMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace RedirectActionStatusCodeEnumMapper
       {
 
-        static const int HTTP_301_HASH = HashingUtils::HashString("HTTP_301");
-        static const int HTTP_302_HASH = HashingUtils::HashString("HTTP_302");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HTTP_301",
+          "HTTP_302",
+        };
 
         RedirectActionStatusCodeEnum GetRedirectActionStatusCodeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_301_HASH)
-          {
-            return RedirectActionStatusCodeEnum::HTTP_301;
-          }
-          else if (hashCode == HTTP_302_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RedirectActionStatusCodeEnum::HTTP_302;
+          case 650801469:
+            if (name == "HTTP_301")
+            {
+              return RedirectActionStatusCodeEnum::HTTP_301;
+            }
+            break;
+          case 650801470:
+            if (name == "HTTP_302")
+            {
+              return RedirectActionStatusCodeEnum::HTTP_302;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RedirectActionStatusCodeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForRedirectActionStatusCodeEnum(RedirectActionStatusCodeEnum enumValue)
+        const char* GetNameForRedirectActionStatusCodeEnumCStr(RedirectActionStatusCodeEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RedirectActionStatusCodeEnum::HTTP_301:
-            return "HTTP_301";
-          case RedirectActionStatusCodeEnum::HTTP_302:
-            return "HTTP_302";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRedirectActionStatusCodeEnum(RedirectActionStatusCodeEnum enumValue)
+        {
+          return GetNameForRedirectActionStatusCodeEnumCStr(enumValue);
         }
 
       } // namespace RedirectActionStatusCodeEnumMapper
@@ -30,70 +30,107 @@ namespace Aws
       namespace TargetHealthReasonEnumMapper
       {
 
-        static const int Elb_RegistrationInProgress_HASH = HashingUtils::HashString("Elb.RegistrationInProgress");
-        static const int Elb_InitialHealthChecking_HASH = HashingUtils::HashString("Elb.InitialHealthChecking");
-        static const int Target_ResponseCodeMismatch_HASH = HashingUtils::HashString("Target.ResponseCodeMismatch");
-        static const int Target_Timeout_HASH = HashingUtils::HashString("Target.Timeout");
-        static const int Target_FailedHealthChecks_HASH = HashingUtils::HashString("Target.FailedHealthChecks");
-        static const int Target_NotRegistered_HASH = HashingUtils::HashString("Target.NotRegistered");
-        static const int Target_NotInUse_HASH = HashingUtils::HashString("Target.NotInUse");
-        static const int Target_DeregistrationInProgress_HASH = HashingUtils::HashString("Target.DeregistrationInProgress");
-        static const int Target_InvalidState_HASH = HashingUtils::HashString("Target.InvalidState");
-        static const int Target_IpUnusable_HASH = HashingUtils::HashString("Target.IpUnusable");
-        static const int Target_HealthCheckDisabled_HASH = HashingUtils::HashString("Target.HealthCheckDisabled");
-        static const int Elb_InternalError_HASH = HashingUtils::HashString("Elb.InternalError");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Elb.RegistrationInProgress",
+          "Elb.InitialHealthChecking",
+          "Target.ResponseCodeMismatch",
+          "Target.Timeout",
+          "Target.FailedHealthChecks",
+          "Target.NotRegistered",
+          "Target.NotInUse",
+          "Target.DeregistrationInProgress",
+          "Target.InvalidState",
+          "Target.IpUnusable",
+          "Target.HealthCheckDisabled",
+          "Elb.InternalError",
+        };
 
         TargetHealthReasonEnum GetTargetHealthReasonEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Elb_RegistrationInProgress_HASH)
-          {
-            return TargetHealthReasonEnum::Elb_RegistrationInProgress;
-          }
-          else if (hashCode == Elb_InitialHealthChecking_HASH)
-          {
-            return TargetHealthReasonEnum::Elb_InitialHealthChecking;
-          }
-          else if (hashCode == Target_ResponseCodeMismatch_HASH)
-          {
-            return TargetHealthReasonEnum::Target_ResponseCodeMismatch;
-          }
-          else if (hashCode == Target_Timeout_HASH)
-          {
-            return TargetHealthReasonEnum::Target_Timeout;
-          }
-          else if (hashCode == Target_FailedHealthChecks_HASH)
-          {
-            return TargetHealthReasonEnum::Target_FailedHealthChecks;
-          }
-          else if (hashCode == Target_NotRegistered_HASH)
-          {
-            return TargetHealthReasonEnum::Target_NotRegistered;
-          }
-          else if (hashCode == Target_NotInUse_HASH)
-          {
-            return TargetHealthReasonEnum::Target_NotInUse;
-          }
-          else if (hashCode == Target_DeregistrationInProgress_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TargetHealthReasonEnum::Target_DeregistrationInProgress;
-          }
-          else if (hashCode == Target_InvalidState_HASH)
-          {
-            return TargetHealthReasonEnum::Target_InvalidState;
-          }
-          else if (hashCode == Target_IpUnusable_HASH)
-          {
-            return TargetHealthReasonEnum::Target_IpUnusable;
-          }
-          else if (hashCode == Target_HealthCheckDisabled_HASH)
-          {
-            return TargetHealthReasonEnum::Target_HealthCheckDisabled;
-          }
-          else if (hashCode == Elb_InternalError_HASH)
-          {
-            return TargetHealthReasonEnum::Elb_InternalError;
+          case -1437730050:
+            if (name == "Elb.RegistrationInProgress")
+            {
+              return TargetHealthReasonEnum::Elb_RegistrationInProgress;
+            }
+            break;
+          case 784279399:
+            if (name == "Elb.InitialHealthChecking")
+            {
+              return TargetHealthReasonEnum::Elb_InitialHealthChecking;
+            }
+            break;
+          case 1684640249:
+            if (name == "Target.ResponseCodeMismatch")
+            {
+              return TargetHealthReasonEnum::Target_ResponseCodeMismatch;
+            }
+            break;
+          case 551883268:
+            if (name == "Target.Timeout")
+            {
+              return TargetHealthReasonEnum::Target_Timeout;
+            }
+            break;
+          case -89722303:
+            if (name == "Target.FailedHealthChecks")
+            {
+              return TargetHealthReasonEnum::Target_FailedHealthChecks;
+            }
+            break;
+          case -1195640808:
+            if (name == "Target.NotRegistered")
+            {
+              return TargetHealthReasonEnum::Target_NotRegistered;
+            }
+            break;
+          case -733875508:
+            if (name == "Target.NotInUse")
+            {
+              return TargetHealthReasonEnum::Target_NotInUse;
+            }
+            break;
+          case 992619401:
+            if (name == "Target.DeregistrationInProgress")
+            {
+              return TargetHealthReasonEnum::Target_DeregistrationInProgress;
+            }
+            break;
+          case 1957572119:
+            if (name == "Target.InvalidState")
+            {
+              return TargetHealthReasonEnum::Target_InvalidState;
+            }
+            break;
+          case -1191687275:
+            if (name == "Target.IpUnusable")
+            {
+              return TargetHealthReasonEnum::Target_IpUnusable;
+            }
+            break;
+          case -1811822901:
+            if (name == "Target.HealthCheckDisabled")
+            {
+              return TargetHealthReasonEnum::Target_HealthCheckDisabled;
+            }
+            break;
+          case 2117882104:
+            if (name == "Elb.InternalError")
+            {
+              return TargetHealthReasonEnum::Elb_InternalError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return TargetHealthReasonEnum::NOT_SET;
         }
 
-        Aws::String GetNameForTargetHealthReasonEnum(TargetHealthReasonEnum enumValue)
+        const char* GetNameForTargetHealthReasonEnumCStr(TargetHealthReasonEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TargetHealthReasonEnum::Elb_RegistrationInProgress:
-            return "Elb.RegistrationInProgress";
-          case TargetHealthReasonEnum::Elb_InitialHealthChecking:
-            return "Elb.InitialHealthChecking";
-          case TargetHealthReasonEnum::Target_ResponseCodeMismatch:
-            return "Target.ResponseCodeMismatch";
-          case TargetHealthReasonEnum::Target_Timeout:
-            return "Target.Timeout";
-          case TargetHealthReasonEnum::Target_FailedHealthChecks:
-            return "Target.FailedHealthChecks";
-          case TargetHealthReasonEnum::Target_NotRegistered:
-            return "Target.NotRegistered";
-          case TargetHealthReasonEnum::Target_NotInUse:
-            return "Target.NotInUse";
-          case TargetHealthReasonEnum::Target_DeregistrationInProgress:
-            return "Target.DeregistrationInProgress";
-          case TargetHealthReasonEnum::Target_InvalidState:
-            return "Target.InvalidState";
-          case TargetHealthReasonEnum::Target_IpUnusable:
-            return "Target.IpUnusable";
-          case TargetHealthReasonEnum::Target_HealthCheckDisabled:
-            return "Target.HealthCheckDisabled";
-          case TargetHealthReasonEnum::Elb_InternalError:
-            return "Elb.InternalError";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTargetHealthReasonEnum(TargetHealthReasonEnum enumValue)
+        {
+          return GetNameForTargetHealthReasonEnumCStr(enumValue);
         }
 
       } // namespace TargetHealthReasonEnumMapper
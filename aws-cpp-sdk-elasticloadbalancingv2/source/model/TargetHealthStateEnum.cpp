@@ -30,40 +30,65 @@ namespace Aws
       namespace TargetHealthStateEnumMapper
       {
 
-        static const int initial_HASH = HashingUtils::HashString("initial");
-        static const int healthy_HASH = HashingUtils::HashString("healthy");
-        static const int unhealthy_HASH = HashingUtils::HashString("unhealthy");
-        static const int unused_HASH = HashingUtils::HashString("unused");
-        static const int draining_HASH = HashingUtils::HashString("draining");
-        static const int unavailable_HASH = HashingUtils::HashString("unavailable");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "initial",
+          "healthy",
+          "unhealthy",
+          "unused",
+          "draining",
+          "unavailable",
+        };
 
         TargetHealthStateEnum GetTargetHealthStateEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == initial_HASH)
-          {
-            return TargetHealthStateEnum::initial;
-          }
-          else if (hashCode == healthy_HASH)
-          {
-            return TargetHealthStateEnum::healthy;
-          }
-          else if (hashCode == unhealthy_HASH)
-          {
-            return TargetHealthStateEnum::unhealthy;
-          }
-          else if (hashCode == unused_HASH)
-          {
-            return TargetHealthStateEnum::unused;
-          }
-          else if (hashCode == draining_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TargetHealthStateEnum::draining;
-          }
-          else if (hashCode == unavailable_HASH)
-          {
-            return TargetHealthStateEnum::unavailable;
+          case 1948342084:
+            if (name == "initial")
+            {
+              return TargetHealthStateEnum::initial;
+            }
+            break;
+          case 795560349:
+            if (name == "healthy")
+            {
+              return TargetHealthStateEnum::healthy;
+            }
+            break;
+          case -1787605788:
+            if (name == "unhealthy")
+            {
+              return TargetHealthStateEnum::unhealthy;
+            }
+            break;
+          case -840170026:
+            if (name == "unused")
+            {
+              return TargetHealthStateEnum::unused;
+            }
+            break;
+          case -839042326:
+            if (name == "draining")
+            {
+              return TargetHealthStateEnum::draining;
+            }
+            break;
+          case -665462704:
+            if (name == "unavailable")
+            {
+              return TargetHealthStateEnum::unavailable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return TargetHealthStateEnum::NOT_SET;
         }
 
-        Aws::String GetNameForTargetHealthStateEnum(TargetHealthStateEnum enumValue)
+        const char* GetNameForTargetHealthStateEnumCStr(TargetHealthStateEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TargetHealthStateEnum::initial:
-            return "initial";
-          case TargetHealthStateEnum::healthy:
-            return "healthy";
-          case TargetHealthStateEnum::unhealthy:
-            return "unhealthy";
-          case TargetHealthStateEnum::unused:
-            return "unused";
-          case TargetHealthStateEnum::draining:
-            return "draining";
-          case TargetHealthStateEnum::unavailable:
-            return "unavailable";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTargetHealthStateEnum(TargetHealthStateEnum enumValue)
+        {
+          return GetNameForTargetHealthStateEnumCStr(enumValue);
         }
 
       } // namespace TargetHealthStateEnumMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TargetTypeEnumMapper
       {
 
-        static const int instance_HASH = HashingUtils::HashString("instance");
-        static const int ip_HASH = HashingUtils::HashString("ip");
-        static const int lambda_HASH = HashingUtils::HashString("lambda");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "instance",
+          "ip",
+          "lambda",
+        };
 
         TargetTypeEnum GetTargetTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instance_HASH)
-          {
-            return TargetTypeEnum::instance;
-          }
-          else if (hashCode == ip_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TargetTypeEnum::ip;
-          }
-          else if (hashCode == lambda_HASH)
-          {
-            return TargetTypeEnum::lambda;
+          case 555127957:
+            if (name == "instance")
+            {
+              return TargetTypeEnum::instance;
+            }
+            break;
+          case 3367:
+            if (name == "ip")
+            {
+              return TargetTypeEnum::ip;
+            }
+            break;
+          case -1110092857:
+            if (name == "lambda")
+            {
+              return TargetTypeEnum::lambda;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TargetTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForTargetTypeEnum(TargetTypeEnum enumValue)
+        const char* GetNameForTargetTypeEnumCStr(TargetTypeEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TargetTypeEnum::instance:
-            return "instance";
-          case TargetTypeEnum::ip:
-            return "ip";
-          case TargetTypeEnum::lambda:
-            return "lambda";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTargetTypeEnum(TargetTypeEnum enumValue)
+        {
+          return GetNameForTargetTypeEnumCStr(enumValue);
         }
 
       } // namespace TargetTypeEnumMapper
@@ -37,6 +37,11 @@ namespace ActionOnFailureMapper
 AWS_EMR_API ActionOnFailure GetActionOnFailureForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForActionOnFailure(ActionOnFailure value);
+
+/**
+ * Same as GetNameForActionOnFailure(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForActionOnFailureCStr(ActionOnFailure value);
 } // namespace ActionOnFailureMapper
 } // namespace Model
 } // namespace EMR
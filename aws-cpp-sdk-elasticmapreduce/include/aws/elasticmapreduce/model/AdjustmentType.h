@@ -36,6 +36,11 @@ namespace AdjustmentTypeMapper
 AWS_EMR_API AdjustmentType GetAdjustmentTypeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForAdjustmentType(AdjustmentType value);
+
+/**
+ * Same as GetNameForAdjustmentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForAdjustmentTypeCStr(AdjustmentType value);
 } // namespace AdjustmentTypeMapper
 } // namespace Model
 } // namespace EMR
@@ -39,6 +39,11 @@ namespace AutoScalingPolicyStateMapper
 AWS_EMR_API AutoScalingPolicyState GetAutoScalingPolicyStateForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForAutoScalingPolicyState(AutoScalingPolicyState value);
+
+/**
+ * Same as GetNameForAutoScalingPolicyState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForAutoScalingPolicyStateCStr(AutoScalingPolicyState value);
 } // namespace AutoScalingPolicyStateMapper
 } // namespace Model
 } // namespace EMR
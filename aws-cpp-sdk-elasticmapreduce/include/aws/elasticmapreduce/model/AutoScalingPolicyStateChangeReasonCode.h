@@ -36,6 +36,11 @@ namespace AutoScalingPolicyStateChangeReasonCodeMapper
 AWS_EMR_API AutoScalingPolicyStateChangeReasonCode GetAutoScalingPolicyStateChangeReasonCodeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForAutoScalingPolicyStateChangeReasonCode(AutoScalingPolicyStateChangeReasonCode value);
+
+/**
+ * Same as GetNameForAutoScalingPolicyStateChangeReasonCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForAutoScalingPolicyStateChangeReasonCodeCStr(AutoScalingPolicyStateChangeReasonCode value);
 } // namespace AutoScalingPolicyStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
@@ -35,6 +35,11 @@ namespace CancelStepsRequestStatusMapper
 AWS_EMR_API CancelStepsRequestStatus GetCancelStepsRequestStatusForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForCancelStepsRequestStatus(CancelStepsRequestStatus value);
+
+/**
+ * Same as GetNameForCancelStepsRequestStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForCancelStepsRequestStatusCStr(CancelStepsRequestStatus value);
 } // namespace CancelStepsRequestStatusMapper
 } // namespace Model
 } // namespace EMR
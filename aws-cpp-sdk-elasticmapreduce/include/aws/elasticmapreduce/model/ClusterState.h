@@ -40,6 +40,11 @@ namespace ClusterStateMapper
 AWS_EMR_API ClusterState GetClusterStateForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForClusterState(ClusterState value);
+
+/**
+ * Same as GetNameForClusterState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForClusterStateCStr(ClusterState value);
 } // namespace ClusterStateMapper
 } // namespace Model
 } // namespace EMR
@@ -41,6 +41,11 @@ namespace ClusterStateChangeReasonCodeMapper
 AWS_EMR_API ClusterStateChangeReasonCode GetClusterStateChangeReasonCodeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForClusterStateChangeReasonCode(ClusterStateChangeReasonCode value);
+
+/**
+ * Same as GetNameForClusterStateChangeReasonCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForClusterStateChangeReasonCodeCStr(ClusterStateChangeReasonCode value);
 } // namespace ClusterStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
@@ -35,6 +35,11 @@ namespace InstanceCollectionTypeMapper
 AWS_EMR_API InstanceCollectionType GetInstanceCollectionTypeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForInstanceCollectionType(InstanceCollectionType value);
+
+/**
+ * Same as GetNameForInstanceCollectionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForInstanceCollectionTypeCStr(InstanceCollectionType value);
 } // namespace InstanceCollectionTypeMapper
 } // namespace Model
 } // namespace EMR
@@ -40,6 +40,11 @@ namespace InstanceFleetStateMapper
 AWS_EMR_API InstanceFleetState GetInstanceFleetStateForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForInstanceFleetState(InstanceFleetState value);
+
+/**
+ * Same as GetNameForInstanceFleetState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForInstanceFleetStateCStr(InstanceFleetState value);
 } // namespace InstanceFleetStateMapper
 } // namespace Model
 } // namespace EMR
@@ -37,6 +37,11 @@ namespace InstanceFleetStateChangeReasonCodeMapper
 AWS_EMR_API InstanceFleetStateChangeReasonCode GetInstanceFleetStateChangeReasonCodeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForInstanceFleetStateChangeReasonCode(InstanceFleetStateChangeReasonCode value);
+
+/**
+ * Same as GetNameForInstanceFleetStateChangeReasonCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForInstanceFleetStateChangeReasonCodeCStr(InstanceFleetStateChangeReasonCode value);
 } // namespace InstanceFleetStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
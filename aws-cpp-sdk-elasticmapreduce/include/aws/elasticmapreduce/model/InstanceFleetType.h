@@ -36,6 +36,11 @@ namespace InstanceFleetTypeMapper
 AWS_EMR_API InstanceFleetType GetInstanceFleetTypeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForInstanceFleetType(InstanceFleetType value);
+
+/**
+ * Same as GetNameForInstanceFleetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForInstanceFleetTypeCStr(InstanceFleetType value);
 } // namespace InstanceFleetTypeMapper
 } // namespace Model
 } // namespace EMR
@@ -43,6 +43,11 @@ namespace InstanceGroupStateMapper
 AWS_EMR_API InstanceGroupState GetInstanceGroupStateForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForInstanceGroupState(InstanceGroupState value);
+
+/**
+ * Same as GetNameForInstanceGroupState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForInstanceGroupStateCStr(InstanceGroupState value);
 } // namespace InstanceGroupStateMapper
 } // namespace Model
 } // namespace EMR
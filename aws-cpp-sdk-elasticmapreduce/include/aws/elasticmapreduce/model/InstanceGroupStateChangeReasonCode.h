@@ -37,6 +37,11 @@ namespace InstanceGroupStateChangeReasonCodeMapper
 AWS_EMR_API InstanceGroupStateChangeReasonCode GetInstanceGroupStateChangeReasonCodeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForInstanceGroupStateChangeReasonCode(InstanceGroupStateChangeReasonCode value);
+
+/**
+ * Same as GetNameForInstanceGroupStateChangeReasonCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForInstanceGroupStateChangeReasonCodeCStr(InstanceGroupStateChangeReasonCode value);
 } // namespace InstanceGroupStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
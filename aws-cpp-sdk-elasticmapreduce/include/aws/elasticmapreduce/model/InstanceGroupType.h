@@ -36,6 +36,11 @@ namespace InstanceGroupTypeMapper
 AWS_EMR_API InstanceGroupType GetInstanceGroupTypeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForInstanceGroupType(InstanceGroupType value);
+
+/**
+ * Same as GetNameForInstanceGroupType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForInstanceGroupTypeCStr(InstanceGroupType value);
 } // namespace InstanceGroupTypeMapper
 } // namespace Model
 } // namespace EMR
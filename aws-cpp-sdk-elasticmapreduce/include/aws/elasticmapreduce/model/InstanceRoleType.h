@@ -36,6 +36,11 @@ namespace InstanceRoleTypeMapper
 AWS_EMR_API InstanceRoleType GetInstanceRoleTypeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForInstanceRoleType(InstanceRoleType value);
+
+/**
+ * Same as GetNameForInstanceRoleType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForInstanceRoleTypeCStr(InstanceRoleType value);
 } // namespace InstanceRoleTypeMapper
 } // namespace Model
 } // namespace EMR
@@ -38,6 +38,11 @@ namespace InstanceStateMapper
 AWS_EMR_API InstanceState GetInstanceStateForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForInstanceState(InstanceState value);
+
+/**
+ * Same as GetNameForInstanceState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForInstanceStateCStr(InstanceState value);
 } // namespace InstanceStateMapper
 } // namespace Model
 } // namespace EMR
@@ -38,6 +38,11 @@ namespace InstanceStateChangeReasonCodeMapper
 AWS_EMR_API InstanceStateChangeReasonCode GetInstanceStateChangeReasonCodeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForInstanceStateChangeReasonCode(InstanceStateChangeReasonCode value);
+
+/**
+ * Same as GetNameForInstanceStateChangeReasonCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForInstanceStateChangeReasonCodeCStr(InstanceStateChangeReasonCode value);
 } // namespace InstanceStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
@@ -41,6 +41,11 @@ namespace JobFlowExecutionStateMapper
 AWS_EMR_API JobFlowExecutionState GetJobFlowExecutionStateForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForJobFlowExecutionState(JobFlowExecutionState value);
+
+/**
+ * Same as GetNameForJobFlowExecutionState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForJobFlowExecutionStateCStr(JobFlowExecutionState value);
 } // namespace JobFlowExecutionStateMapper
 } // namespace Model
 } // namespace EMR
@@ -35,6 +35,11 @@ namespace MarketTypeMapper
 AWS_EMR_API MarketType GetMarketTypeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForMarketType(MarketType value);
+
+/**
+ * Same as GetNameForMarketType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForMarketTypeCStr(MarketType value);
 } // namespace MarketTypeMapper
 } // namespace Model
 } // namespace EMR
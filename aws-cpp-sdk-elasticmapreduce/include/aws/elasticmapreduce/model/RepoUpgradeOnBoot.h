@@ -35,6 +35,11 @@ namespace RepoUpgradeOnBootMapper
 AWS_EMR_API RepoUpgradeOnBoot GetRepoUpgradeOnBootForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForRepoUpgradeOnBoot(RepoUpgradeOnBoot value);
+
+/**
+ * Same as GetNameForRepoUpgradeOnBoot(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForRepoUpgradeOnBootCStr(RepoUpgradeOnBoot value);
 } // namespace RepoUpgradeOnBootMapper
 } // namespace Model
 } // namespace EMR
@@ -35,6 +35,11 @@ namespace ScaleDownBehaviorMapper
 AWS_EMR_API ScaleDownBehavior GetScaleDownBehaviorForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForScaleDownBehavior(ScaleDownBehavior value);
+
+/**
+ * Same as GetNameForScaleDownBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForScaleDownBehaviorCStr(ScaleDownBehavior value);
 } // namespace ScaleDownBehaviorMapper
 } // namespace Model
 } // namespace EMR
@@ -35,6 +35,11 @@ namespace SpotProvisioningTimeoutActionMapper
 AWS_EMR_API SpotProvisioningTimeoutAction GetSpotProvisioningTimeoutActionForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForSpotProvisioningTimeoutAction(SpotProvisioningTimeoutAction value);
+
+/**
+ * Same as GetNameForSpotProvisioningTimeoutAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForSpotProvisioningTimeoutActionCStr(SpotProvisioningTimeoutAction value);
 } // namespace SpotProvisioningTimeoutActionMapper
 } // namespace Model
 } // namespace EMR
@@ -38,6 +38,11 @@ namespace StatisticMapper
 AWS_EMR_API Statistic GetStatisticForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForStatistic(Statistic value);
+
+/**
+ * Same as GetNameForStatistic(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForStatisticCStr(Statistic value);
 } // namespace StatisticMapper
 } // namespace Model
 } // namespace EMR
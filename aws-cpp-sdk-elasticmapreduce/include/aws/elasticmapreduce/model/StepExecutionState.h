@@ -40,6 +40,11 @@ namespace StepExecutionStateMapper
 AWS_EMR_API StepExecutionState GetStepExecutionStateForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForStepExecutionState(StepExecutionState value);
+
+/**
+ * Same as GetNameForStepExecutionState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForStepExecutionStateCStr(StepExecutionState value);
 } // namespace StepExecutionStateMapper
 } // namespace Model
 } // namespace EMR
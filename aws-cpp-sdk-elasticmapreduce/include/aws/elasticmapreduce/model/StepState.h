@@ -40,6 +40,11 @@ namespace StepStateMapper
 AWS_EMR_API StepState GetStepStateForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForStepState(StepState value);
+
+/**
+ * Same as GetNameForStepState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForStepStateCStr(StepState value);
 } // namespace StepStateMapper
 } // namespace Model
 } // namespace EMR
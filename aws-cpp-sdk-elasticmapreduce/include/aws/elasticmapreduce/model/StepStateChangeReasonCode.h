@@ -34,6 +34,11 @@ namespace StepStateChangeReasonCodeMapper
 AWS_EMR_API StepStateChangeReasonCode GetStepStateChangeReasonCodeForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForStepStateChangeReasonCode(StepStateChangeReasonCode value);
+
+/**
+ * Same as GetNameForStepStateChangeReasonCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForStepStateChangeReasonCodeCStr(StepStateChangeReasonCode value);
 } // namespace StepStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
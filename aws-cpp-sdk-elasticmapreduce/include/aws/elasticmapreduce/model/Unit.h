@@ -60,6 +60,11 @@ namespace UnitMapper
 AWS_EMR_API Unit GetUnitForName(const Aws::String& name);
 
 AWS_EMR_API Aws::String GetNameForUnit(Unit value);
+
+/**
+ * Same as GetNameForUnit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_EMR_API const char* GetNameForUnitCStr(Unit value);
 } // namespace UnitMapper
 } // namespace Model
 } // namespace EMR
@@ -30,30 +30,51 @@ namespace Aws
       namespace ActionOnFailureMapper
       {
 
-        static const int TERMINATE_JOB_FLOW_HASH = HashingUtils::HashString("TERMINATE_JOB_FLOW");
-        static const int TERMINATE_CLUSTER_HASH = HashingUtils::HashString("TERMINATE_CLUSTER");
-        static const int CANCEL_AND_WAIT_HASH = HashingUtils::HashString("CANCEL_AND_WAIT");
-        static const int CONTINUE_HASH = HashingUtils::HashString("CONTINUE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TERMINATE_JOB_FLOW",
+          "TERMINATE_CLUSTER",
+          "CANCEL_AND_WAIT",
+          "CONTINUE",
+        };
 
         ActionOnFailure GetActionOnFailureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERMINATE_JOB_FLOW_HASH)
-          {
-            return ActionOnFailure::TERMINATE_JOB_FLOW;
-          }
-          else if (hashCode == TERMINATE_CLUSTER_HASH)
-          {
-            return ActionOnFailure::TERMINATE_CLUSTER;
-          }
-          else if (hashCode == CANCEL_AND_WAIT_HASH)
-          {
-            return ActionOnFailure::CANCEL_AND_WAIT;
-          }
-          else if (hashCode == CONTINUE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionOnFailure::CONTINUE;
+          case 369010894:
+            if (name == "TERMINATE_JOB_FLOW")
+            {
+              return ActionOnFailure::TERMINATE_JOB_FLOW;
+            }
+            break;
+          case 796606940:
+            if (name == "TERMINATE_CLUSTER")
+            {
+              return ActionOnFailure::TERMINATE_CLUSTER;
+            }
+            break;
+          case 834500386:
+            if (name == "CANCEL_AND_WAIT")
+            {
+              return ActionOnFailure::CANCEL_AND_WAIT;
+            }
+            break;
+          case 215424167:
+            if (name == "CONTINUE")
+            {
+              return ActionOnFailure::CONTINUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ActionOnFailure::NOT_SET;
         }
 
-        Aws::String GetNameForActionOnFailure(ActionOnFailure enumValue)
+        const char* GetNameForActionOnFailureCStr(ActionOnFailure enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionOnFailure::TERMINATE_JOB_FLOW:
-            return "TERMINATE_JOB_FLOW";
-          case ActionOnFailure::TERMINATE_CLUSTER:
-            return "TERMINATE_CLUSTER";
-          case ActionOnFailure::CANCEL_AND_WAIT:
-            return "CANCEL_AND_WAIT";
-          case ActionOnFailure::CONTINUE:
-            return "CONTINUE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionOnFailure(ActionOnFailure enumValue)
+        {
+          return GetNameForActionOnFailureCStr(enumValue);
         }
 
       } // namespace ActionOnFailureMapper
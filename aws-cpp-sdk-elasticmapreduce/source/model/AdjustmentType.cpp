@@ -30,25 +30,44 @@ namespace Aws
       namespace AdjustmentTypeMapper
       {
 
-        static const int CHANGE_IN_CAPACITY_HASH = HashingUtils::HashString("CHANGE_IN_CAPACITY");
-        static const int PERCENT_CHANGE_IN_CAPACITY_HASH = HashingUtils::HashString("PERCENT_CHANGE_IN_CAPACITY");
-        static const int EXACT_CAPACITY_HASH = HashingUtils::HashString("EXACT_CAPACITY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CHANGE_IN_CAPACITY",
+          "PERCENT_CHANGE_IN_CAPACITY",
+          "EXACT_CAPACITY",
+        };
 
         AdjustmentType GetAdjustmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHANGE_IN_CAPACITY_HASH)
-          {
-            return AdjustmentType::CHANGE_IN_CAPACITY;
-          }
-          else if (hashCode == PERCENT_CHANGE_IN_CAPACITY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AdjustmentType::PERCENT_CHANGE_IN_CAPACITY;
-          }
-          else if (hashCode == EXACT_CAPACITY_HASH)
-          {
-            return AdjustmentType::EXACT_CAPACITY;
+          case -1523579771:
+            if (name == "CHANGE_IN_CAPACITY")
+            {
+              return AdjustmentType::CHANGE_IN_CAPACITY;
+            }
+            break;
+          case 1771329247:
+            if (name == "PERCENT_CHANGE_IN_CAPACITY")
+            {
+              return AdjustmentType::PERCENT_CHANGE_IN_CAPACITY;
+            }
+            break;
+          case 568372762:
+            if (name == "EXACT_CAPACITY")
+            {
+              return AdjustmentType::EXACT_CAPACITY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AdjustmentType::NOT_SET;
         }
 
-        Aws::String GetNameForAdjustmentType(AdjustmentType enumValue)
+        const char* GetNameForAdjustmentTypeCStr(AdjustmentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AdjustmentType::CHANGE_IN_CAPACITY:
-            return "CHANGE_IN_CAPACITY";
-          case AdjustmentType::PERCENT_CHANGE_IN_CAPACITY:
-            return "PERCENT_CHANGE_IN_CAPACITY";
-          case AdjustmentType::EXACT_CAPACITY:
-            return "EXACT_CAPACITY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAdjustmentType(AdjustmentType enumValue)
+        {
+          return GetNameForAdjustmentTypeCStr(enumValue);
         }
 
       } // namespace AdjustmentTypeMapper
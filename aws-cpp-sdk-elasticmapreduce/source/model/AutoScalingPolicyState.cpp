@@ -30,40 +30,65 @@ namespace Aws
       namespace AutoScalingPolicyStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int ATTACHING_HASH = HashingUtils::HashString("ATTACHING");
-        static const int ATTACHED_HASH = HashingUtils::HashString("ATTACHED");
-        static const int DETACHING_HASH = HashingUtils::HashString("DETACHING");
-        static const int DETACHED_HASH = HashingUtils::HashString("DETACHED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "ATTACHING",
+          "ATTACHED",
+          "DETACHING",
+          "DETACHED",
+          "FAILED",
+        };
 
         AutoScalingPolicyState GetAutoScalingPolicyStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return AutoScalingPolicyState::PENDING;
-          }
-          else if (hashCode == ATTACHING_HASH)
-          {
-            return AutoScalingPolicyState::ATTACHING;
-          }
-          else if (hashCode == ATTACHED_HASH)
-          {
-            return AutoScalingPolicyState::ATTACHED;
-          }
-          else if (hashCode == DETACHING_HASH)
-          {
-            return AutoScalingPolicyState::DETACHING;
-          }
-          else if (hashCode == DETACHED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AutoScalingPolicyState::DETACHED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AutoScalingPolicyState::FAILED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return AutoScalingPolicyState::PENDING;
+            }
+            break;
+          case -1987356835:
+            if (name == "ATTACHING")
+            {
+              return AutoScalingPolicyState::ATTACHING;
+            }
+            break;
+          case 1321364900:
+            if (name == "ATTACHED")
+            {
+              return AutoScalingPolicyState::ATTACHED;
+            }
+            break;
+          case 807863119:
+            if (name == "DETACHING")
+            {
+              return AutoScalingPolicyState::DETACHING;
+            }
+            break;
+          case 1827175282:
+            if (name == "DETACHED")
+            {
+              return AutoScalingPolicyState::DETACHED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return AutoScalingPolicyState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return AutoScalingPolicyState::NOT_SET;
         }
 
-        Aws::String GetNameForAutoScalingPolicyState(AutoScalingPolicyState enumValue)
+        const char* GetNameForAutoScalingPolicyStateCStr(AutoScalingPolicyState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AutoScalingPolicyState::PENDING:
-            return "PENDING";
-          case AutoScalingPolicyState::ATTACHING:
-            return "ATTACHING";
-          case AutoScalingPolicyState::ATTACHED:
-            return "ATTACHED";
-          case AutoScalingPolicyState::DETACHING:
-            return "DETACHING";
-          case AutoScalingPolicyState::DETACHED:
-            return "DETACHED";
-          case AutoScalingPolicyState::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAutoScalingPolicyState(AutoScalingPolicyState enumValue)
+        {
+          return GetNameForAutoScalingPolicyStateCStr(enumValue);
         }
 
       } // namespace AutoScalingPolicyStateMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AutoScalingPolicyStateChangeReasonCodeMapper
       {
 
-        static const int USER_REQUEST_HASH = HashingUtils::HashString("USER_REQUEST");
-        static const int PROVISION_FAILURE_HASH = HashingUtils::HashString("PROVISION_FAILURE");
-        static const int CLEANUP_FAILURE_HASH = HashingUtils::HashString("CLEANUP_FAILURE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USER_REQUEST",
+          "PROVISION_FAILURE",
+          "CLEANUP_FAILURE",
+        };
 
         AutoScalingPolicyStateChangeReasonCode GetAutoScalingPolicyStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_REQUEST_HASH)
-          {
-            return AutoScalingPolicyStateChangeReasonCode::USER_REQUEST;
-          }
-          else if (hashCode == PROVISION_FAILURE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AutoScalingPolicyStateChangeReasonCode::PROVISION_FAILURE;
-          }
-          else if (hashCode == CLEANUP_FAILURE_HASH)
-          {
-            return AutoScalingPolicyStateChangeReasonCode::CLEANUP_FAILURE;
+          case 579014139:
+            if (name == "USER_REQUEST")
+            {
+              return AutoScalingPolicyStateChangeReasonCode::USER_REQUEST;
+            }
+            break;
+          case 239962080:
+            if (name == "PROVISION_FAILURE")
+            {
+              return AutoScalingPolicyStateChangeReasonCode::PROVISION_FAILURE;
+            }
+            break;
+          case 364610223:
+            if (name == "CLEANUP_FAILURE")
+            {
+              return AutoScalingPolicyStateChangeReasonCode::CLEANUP_FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AutoScalingPolicyStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForAutoScalingPolicyStateChangeReasonCode(AutoScalingPolicyStateChangeReasonCode enumValue)
+        const char* GetNameForAutoScalingPolicyStateChangeReasonCodeCStr(AutoScalingPolicyStateChangeReasonCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AutoScalingPolicyStateChangeReasonCode::USER_REQUEST:
-            return "USER_REQUEST";
-          case AutoScalingPolicyStateChangeReasonCode::PROVISION_FAILURE:
-            return "PROVISION_FAILURE";
-          case AutoScalingPolicyStateChangeReasonCode::CLEANUP_FAILURE:
-            return "CLEANUP_FAILURE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAutoScalingPolicyStateChangeReasonCode(AutoScalingPolicyStateChangeReasonCode enumValue)
+        {
+          return GetNameForAutoScalingPolicyStateChangeReasonCodeCStr(enumValue);
         }
 
       } // namespace AutoScalingPolicyStateChangeReasonCodeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CancelStepsRequestStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUBMITTED",
+          "FAILED",
+        };
 
         CancelStepsRequestStatus GetCancelStepsRequestStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
-          {
-            return CancelStepsRequestStatus::SUBMITTED;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CancelStepsRequestStatus::FAILED;
+          case -1159694117:
+            if (name == "SUBMITTED")
+            {
+              return CancelStepsRequestStatus::SUBMITTED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return CancelStepsRequestStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CancelStepsRequestStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCancelStepsRequestStatus(CancelStepsRequestStatus enumValue)
+        const char* GetNameForCancelStepsRequestStatusCStr(CancelStepsRequestStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CancelStepsRequestStatus::SUBMITTED:
-            return "SUBMITTED";
-          case CancelStepsRequestStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCancelStepsRequestStatus(CancelStepsRequestStatus enumValue)
+        {
+          return GetNameForCancelStepsRequestStatusCStr(enumValue);
         }
 
       } // namespace CancelStepsRequestStatusMapper
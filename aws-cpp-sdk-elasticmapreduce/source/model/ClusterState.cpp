@@ -30,45 +30,72 @@ namespace Aws
       namespace ClusterStateMapper
       {
 
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int WAITING_HASH = HashingUtils::HashString("WAITING");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int TERMINATED_WITH_ERRORS_HASH = HashingUtils::HashString("TERMINATED_WITH_ERRORS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STARTING",
+          "BOOTSTRAPPING",
+          "RUNNING",
+          "WAITING",
+          "TERMINATING",
+          "TERMINATED",
+          "TERMINATED_WITH_ERRORS",
+        };
 
         ClusterState GetClusterStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTING_HASH)
-          {
-            return ClusterState::STARTING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
-            return ClusterState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClusterState::RUNNING;
-          }
-          else if (hashCode == WAITING_HASH)
-          {
-            return ClusterState::WAITING;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return ClusterState::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return ClusterState::TERMINATED;
-          }
-          else if (hashCode == TERMINATED_WITH_ERRORS_HASH)
-          {
-            return ClusterState::TERMINATED_WITH_ERRORS;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return ClusterState::STARTING;
+            }
+            break;
+          case -2054192960:
+            if (name == "BOOTSTRAPPING")
+            {
+              return ClusterState::BOOTSTRAPPING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return ClusterState::RUNNING;
+            }
+            break;
+          case 1834295853:
+            if (name == "WAITING")
+            {
+              return ClusterState::WAITING;
+            }
+            break;
+          case 234379966:
+            if (name == "TERMINATING")
+            {
+              return ClusterState::TERMINATING;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return ClusterState::TERMINATED;
+            }
+            break;
+          case 1298245864:
+            if (name == "TERMINATED_WITH_ERRORS")
+            {
+              return ClusterState::TERMINATED_WITH_ERRORS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ClusterState::NOT_SET;
         }
 
-        Aws::String GetNameForClusterState(ClusterState enumValue)
+        const char* GetNameForClusterStateCStr(ClusterState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClusterState::STARTING:
-            return "STARTING";
-          case ClusterState::BOOTSTRAPPING:
-            return "BOOTSTRAPPING";
-          case ClusterState::RUNNING:
-            return "RUNNING";
-          case ClusterState::WAITING:
-            return "WAITING";
-          case ClusterState::TERMINATING:
-            return "TERMINATING";
-          case ClusterState::TERMINATED:
-            return "TERMINATED";
-          case ClusterState::TERMINATED_WITH_ERRORS:
-            return "TERMINATED_WITH_ERRORS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClusterState(ClusterState enumValue)
+        {
+          return GetNameForClusterStateCStr(enumValue);
         }
 
       } // namespace ClusterStateMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace ClusterStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int VALIDATION_ERROR_HASH = HashingUtils::HashString("VALIDATION_ERROR");
-        static const int INSTANCE_FAILURE_HASH = HashingUtils::HashString("INSTANCE_FAILURE");
-        static const int INSTANCE_FLEET_TIMEOUT_HASH = HashingUtils::HashString("INSTANCE_FLEET_TIMEOUT");
-        static const int BOOTSTRAP_FAILURE_HASH = HashingUtils::HashString("BOOTSTRAP_FAILURE");
-        static const int USER_REQUEST_HASH = HashingUtils::HashString("USER_REQUEST");
-        static const int STEP_FAILURE_HASH = HashingUtils::HashString("STEP_FAILURE");
-        static const int ALL_STEPS_COMPLETED_HASH = HashingUtils::HashString("ALL_STEPS_COMPLETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INTERNAL_ERROR",
+          "VALIDATION_ERROR",
+          "INSTANCE_FAILURE",
+          "INSTANCE_FLEET_TIMEOUT",
+          "BOOTSTRAP_FAILURE",
+          "USER_REQUEST",
+          "STEP_FAILURE",
+          "ALL_STEPS_COMPLETED",
+        };
 
         ClusterStateChangeReasonCode GetClusterStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
-          {
-            return ClusterStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == VALIDATION_ERROR_HASH)
-          {
-            return ClusterStateChangeReasonCode::VALIDATION_ERROR;
-          }
-          else if (hashCode == INSTANCE_FAILURE_HASH)
-          {
-            return ClusterStateChangeReasonCode::INSTANCE_FAILURE;
-          }
-          else if (hashCode == INSTANCE_FLEET_TIMEOUT_HASH)
-          {
-            return ClusterStateChangeReasonCode::INSTANCE_FLEET_TIMEOUT;
-          }
-          else if (hashCode == BOOTSTRAP_FAILURE_HASH)
-          {
-            return ClusterStateChangeReasonCode::BOOTSTRAP_FAILURE;
-          }
-          else if (hashCode == USER_REQUEST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClusterStateChangeReasonCode::USER_REQUEST;
-          }
-          else if (hashCode == STEP_FAILURE_HASH)
-          {
-            return ClusterStateChangeReasonCode::STEP_FAILURE;
-          }
-          else if (hashCode == ALL_STEPS_COMPLETED_HASH)
-          {
-            return ClusterStateChangeReasonCode::ALL_STEPS_COMPLETED;
+          case -485608986:
+            if (name == "INTERNAL_ERROR")
+            {
+              return ClusterStateChangeReasonCode::INTERNAL_ERROR;
+            }
+            break;
+          case -998542686:
+            if (name == "VALIDATION_ERROR")
+            {
+              return ClusterStateChangeReasonCode::VALIDATION_ERROR;
+            }
+            break;
+          case -547060800:
+            if (name == "INSTANCE_FAILURE")
+            {
+              return ClusterStateChangeReasonCode::INSTANCE_FAILURE;
+            }
+            break;
+          case -519592698:
+            if (name == "INSTANCE_FLEET_TIMEOUT")
+            {
+              return ClusterStateChangeReasonCode::INSTANCE_FLEET_TIMEOUT;
+            }
+            break;
+          case -1645144967:
+            if (name == "BOOTSTRAP_FAILURE")
+            {
+              return ClusterStateChangeReasonCode::BOOTSTRAP_FAILURE;
+            }
+            break;
+          case 579014139:
+            if (name == "USER_REQUEST")
+            {
+              return ClusterStateChangeReasonCode::USER_REQUEST;
+            }
+            break;
+          case -43460873:
+            if (name == "STEP_FAILURE")
+            {
+              return ClusterStateChangeReasonCode::STEP_FAILURE;
+            }
+            break;
+          case 1790914613:
+            if (name == "ALL_STEPS_COMPLETED")
+            {
+              return ClusterStateChangeReasonCode::ALL_STEPS_COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return ClusterStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForClusterStateChangeReasonCode(ClusterStateChangeReasonCode enumValue)
+        const char* GetNameForClusterStateChangeReasonCodeCStr(ClusterStateChangeReasonCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClusterStateChangeReasonCode::INTERNAL_ERROR:
-            return "INTERNAL_ERROR";
-          case ClusterStateChangeReasonCode::VALIDATION_ERROR:
-            return "VALIDATION_ERROR";
-          case ClusterStateChangeReasonCode::INSTANCE_FAILURE:
-            return "INSTANCE_FAILURE";
-          case ClusterStateChangeReasonCode::INSTANCE_FLEET_TIMEOUT:
-            return "INSTANCE_FLEET_TIMEOUT";
-          case ClusterStateChangeReasonCode::BOOTSTRAP_FAILURE:
-            return "BOOTSTRAP_FAILURE";
-          case ClusterStateChangeReasonCode::USER_REQUEST:
-            return "USER_REQUEST";
-          case ClusterStateChangeReasonCode::STEP_FAILURE:
-            return "STEP_FAILURE";
-          case ClusterStateChangeReasonCode::ALL_STEPS_COMPLETED:
-            return "ALL_STEPS_COMPLETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClusterStateChangeReasonCode(ClusterStateChangeReasonCode enumValue)
+        {
+          return GetNameForClusterStateChangeReasonCodeCStr(enumValue);
         }
 
       } // namespace ClusterStateChangeReasonCodeMapper
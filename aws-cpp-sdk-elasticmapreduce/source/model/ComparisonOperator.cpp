@@ -30,30 +30,51 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int GREATER_THAN_OR_EQUAL_HASH = HashingUtils::HashString("GREATER_THAN_OR_EQUAL");
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int LESS_THAN_OR_EQUAL_HASH = HashingUtils::HashString("LESS_THAN_OR_EQUAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GREATER_THAN_OR_EQUAL",
+          "GREATER_THAN",
+          "LESS_THAN",
+          "LESS_THAN_OR_EQUAL",
+        };
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GREATER_THAN_OR_EQUAL_HASH)
-          {
-            return ComparisonOperator::GREATER_THAN_OR_EQUAL;
-          }
-          else if (hashCode == GREATER_THAN_HASH)
-          {
-            return ComparisonOperator::GREATER_THAN;
-          }
-          else if (hashCode == LESS_THAN_HASH)
-          {
-            return ComparisonOperator::LESS_THAN;
-          }
-          else if (hashCode == LESS_THAN_OR_EQUAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComparisonOperator::LESS_THAN_OR_EQUAL;
+          case 989027057:
+            if (name == "GREATER_THAN_OR_EQUAL")
+            {
+              return ComparisonOperator::GREATER_THAN_OR_EQUAL;
+            }
+            break;
+          case 972152550:
+            if (name == "GREATER_THAN")
+            {
+              return ComparisonOperator::GREATER_THAN;
+            }
+            break;
+          case -1112834937:
+            if (name == "LESS_THAN")
+            {
+              return ComparisonOperator::LESS_THAN;
+            }
+            break;
+          case -2081783184:
+            if (name == "LESS_THAN_OR_EQUAL")
+            {
+              return ComparisonOperator::LESS_THAN_OR_EQUAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperatorCStr(ComparisonOperator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComparisonOperator::GREATER_THAN_OR_EQUAL:
-            return "GREATER_THAN_OR_EQUAL";
-          case ComparisonOperator::GREATER_THAN:
-            return "GREATER_THAN";
-          case ComparisonOperator::LESS_THAN:
-            return "LESS_THAN";
-          case ComparisonOperator::LESS_THAN_OR_EQUAL:
-            return "LESS_THAN_OR_EQUAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        {
+          return GetNameForComparisonOperatorCStr(enumValue);
         }
 
       } // namespace ComparisonOperatorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace InstanceCollectionTypeMapper
       {
 
-        static const int INSTANCE_FLEET_HASH = HashingUtils::HashString("INSTANCE_FLEET");
-        static const int INSTANCE_GROUP_HASH = HashingUtils::HashString("INSTANCE_GROUP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INSTANCE_FLEET",
+          "INSTANCE_GROUP",
+        };
 
         InstanceCollectionType GetInstanceCollectionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSTANCE_FLEET_HASH)
-          {
-            return InstanceCollectionType::INSTANCE_FLEET;
-          }
-          else if (hashCode == INSTANCE_GROUP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceCollectionType::INSTANCE_GROUP;
+          case -1184601852:
+            if (name == "INSTANCE_FLEET")
+            {
+              return InstanceCollectionType::INSTANCE_FLEET;
+            }
+            break;
+          case -1183489483:
+            if (name == "INSTANCE_GROUP")
+            {
+              return InstanceCollectionType::INSTANCE_GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InstanceCollectionType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceCollectionType(InstanceCollectionType enumValue)
+        const char* GetNameForInstanceCollectionTypeCStr(InstanceCollectionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceCollectionType::INSTANCE_FLEET:
-            return "INSTANCE_FLEET";
-          case InstanceCollectionType::INSTANCE_GROUP:
-            return "INSTANCE_GROUP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceCollectionType(InstanceCollectionType enumValue)
+        {
+          return GetNameForInstanceCollectionTypeCStr(enumValue);
         }
 
       } // namespace InstanceCollectionTypeMapper
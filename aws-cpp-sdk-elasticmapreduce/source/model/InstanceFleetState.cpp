@@ -30,45 +30,72 @@ namespace Aws
       namespace InstanceFleetStateMapper
       {
 
-        static const int PROVISIONING_HASH = HashingUtils::HashString("PROVISIONING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int RESIZING_HASH = HashingUtils::HashString("RESIZING");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PROVISIONING",
+          "BOOTSTRAPPING",
+          "RUNNING",
+          "RESIZING",
+          "SUSPENDED",
+          "TERMINATING",
+          "TERMINATED",
+        };
 
         InstanceFleetState GetInstanceFleetStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROVISIONING_HASH)
-          {
-            return InstanceFleetState::PROVISIONING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
-            return InstanceFleetState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceFleetState::RUNNING;
-          }
-          else if (hashCode == RESIZING_HASH)
-          {
-            return InstanceFleetState::RESIZING;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
-            return InstanceFleetState::SUSPENDED;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return InstanceFleetState::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return InstanceFleetState::TERMINATED;
+          case -1856587027:
+            if (name == "PROVISIONING")
+            {
+              return InstanceFleetState::PROVISIONING;
+            }
+            break;
+          case -2054192960:
+            if (name == "BOOTSTRAPPING")
+            {
+              return InstanceFleetState::BOOTSTRAPPING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return InstanceFleetState::RUNNING;
+            }
+            break;
+          case 436161649:
+            if (name == "RESIZING")
+            {
+              return InstanceFleetState::RESIZING;
+            }
+            break;
+          case 1124965819:
+            if (name == "SUSPENDED")
+            {
+              return InstanceFleetState::SUSPENDED;
+            }
+            break;
+          case 234379966:
+            if (name == "TERMINATING")
+            {
+              return InstanceFleetState::TERMINATING;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return InstanceFleetState::TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return InstanceFleetState::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceFleetState(InstanceFleetState enumValue)
+        const char* GetNameForInstanceFleetStateCStr(InstanceFleetState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceFleetState::PROVISIONING:
-            return "PROVISIONING";
-          case InstanceFleetState::BOOTSTRAPPING:
-            return "BOOTSTRAPPING";
-          case InstanceFleetState::RUNNING:
-            return "RUNNING";
-          case InstanceFleetState::RESIZING:
-            return "RESIZING";
-          case InstanceFleetState::SUSPENDED:
-            return "SUSPENDED";
-          case InstanceFleetState::TERMINATING:
-            return "TERMINATING";
-          case InstanceFleetState::TERMINATED:
-            return "TERMINATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceFleetState(InstanceFleetState enumValue)
+        {
+          return GetNameForInstanceFleetStateCStr(enumValue);
         }
 
       } // namespace InstanceFleetStateMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace InstanceFleetTypeMapper
       {
 
-        static const int MASTER_HASH = HashingUtils::HashString("MASTER");
-        static const int CORE_HASH = HashingUtils::HashString("CORE");
-        static const int TASK_HASH = HashingUtils::HashString("TASK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MASTER",
+          "CORE",
+          "TASK",
+        };
 
         InstanceFleetType GetInstanceFleetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MASTER_HASH)
-          {
-            return InstanceFleetType::MASTER;
-          }
-          else if (hashCode == CORE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceFleetType::CORE;
-          }
-          else if (hashCode == TASK_HASH)
-          {
-            return InstanceFleetType::TASK;
+          case -2027938206:
+            if (name == "MASTER")
+            {
+              return InstanceFleetType::MASTER;
+            }
+            break;
+          case 2074527:
+            if (name == "CORE")
+            {
+              return InstanceFleetType::CORE;
+            }
+            break;
+          case 2567557:
+            if (name == "TASK")
+            {
+              return InstanceFleetType::TASK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InstanceFleetType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceFleetType(InstanceFleetType enumValue)
+        const char* GetNameForInstanceFleetTypeCStr(InstanceFleetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceFleetType::MASTER:
-            return "MASTER";
-          case InstanceFleetType::CORE:
-            return "CORE";
-          case InstanceFleetType::TASK:
-            return "TASK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceFleetType(InstanceFleetType enumValue)
+        {
+          return GetNameForInstanceFleetTypeCStr(enumValue);
         }
 
       } // namespace InstanceFleetTypeMapper
@@ -30,60 +30,93 @@ namespace Aws
       namespace InstanceGroupStateMapper
       {
 
-        static const int PROVISIONING_HASH = HashingUtils::HashString("PROVISIONING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int RESIZING_HASH = HashingUtils::HashString("RESIZING");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int ARRESTED_HASH = HashingUtils::HashString("ARRESTED");
-        static const int SHUTTING_DOWN_HASH = HashingUtils::HashString("SHUTTING_DOWN");
-        static const int ENDED_HASH = HashingUtils::HashString("ENDED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PROVISIONING",
+          "BOOTSTRAPPING",
+          "RUNNING",
+          "RESIZING",
+          "SUSPENDED",
+          "TERMINATING",
+          "TERMINATED",
+          "ARRESTED",
+          "SHUTTING_DOWN",
+          "ENDED",
+        };
 
         InstanceGroupState GetInstanceGroupStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROVISIONING_HASH)
-          {
-            return InstanceGroupState::PROVISIONING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
-            return InstanceGroupState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return InstanceGroupState::RUNNING;
-          }
-          else if (hashCode == RESIZING_HASH)
-          {
-            return InstanceGroupState::RESIZING;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
-            return InstanceGroupState::SUSPENDED;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return InstanceGroupState::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceGroupState::TERMINATED;
-          }
-          else if (hashCode == ARRESTED_HASH)
-          {
-            return InstanceGroupState::ARRESTED;
-          }
-          else if (hashCode == SHUTTING_DOWN_HASH)
-          {
-            return InstanceGroupState::SHUTTING_DOWN;
-          }
-          else if (hashCode == ENDED_HASH)
-          {
-            return InstanceGroupState::ENDED;
+          case -1856587027:
+            if (name == "PROVISIONING")
+            {
+              return InstanceGroupState::PROVISIONING;
+            }
+            break;
+          case -2054192960:
+            if (name == "BOOTSTRAPPING")
+            {
+              return InstanceGroupState::BOOTSTRAPPING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return InstanceGroupState::RUNNING;
+            }
+            break;
+          case 436161649:
+            if (name == "RESIZING")
+            {
+              return InstanceGroupState::RESIZING;
+            }
+            break;
+          case 1124965819:
+            if (name == "SUSPENDED")
+            {
+              return InstanceGroupState::SUSPENDED;
+            }
+            break;
+          case 234379966:
+            if (name == "TERMINATING")
+            {
+              return InstanceGroupState::TERMINATING;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return InstanceGroupState::TERMINATED;
+            }
+            break;
+          case -506718492:
+            if (name == "ARRESTED")
+            {
+              return InstanceGroupState::ARRESTED;
+            }
+            break;
+          case -120764897:
+            if (name == "SHUTTING_DOWN")
+            {
+              return InstanceGroupState::SHUTTING_DOWN;
+            }
+            break;
+          case 66114202:
+            if (name == "ENDED")
+            {
+              return InstanceGroupState::ENDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return InstanceGroupState::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceGroupState(InstanceGroupState enumValue)
+        const char* GetNameForInstanceGroupStateCStr(InstanceGroupState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceGroupState::PROVISIONING:
-            return "PROVISIONING";
-          case InstanceGroupState::BOOTSTRAPPING:
-            return "BOOTSTRAPPING";
-          case InstanceGroupState::RUNNING:
-            return "RUNNING";
-          case InstanceGroupState::RESIZING:
-            return "RESIZING";
-          case InstanceGroupState::SUSPENDED:
-            return "SUSPENDED";
-          case InstanceGroupState::TERMINATING:
-            return "TERMINATING";
-          case InstanceGroupState::TERMINATED:
-            return "TERMINATED";
-          case InstanceGroupState::ARRESTED:
-            return "ARRESTED";
-          case InstanceGroupState::SHUTTING_DOWN:
-            return "SHUTTING_DOWN";
-          case InstanceGroupState::ENDED:
-            return "ENDED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceGroupState(InstanceGroupState enumValue)
+        {
+          return GetNameForInstanceGroupStateCStr(enumValue);
         }
 
       } // namespace InstanceGroupStateMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace InstanceGroupStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int VALIDATION_ERROR_HASH = HashingUtils::HashString("VALIDATION_ERROR");
-        static const int INSTANCE_FAILURE_HASH = HashingUtils::HashString("INSTANCE_FAILURE");
-        static const int CLUSTER_TERMINATED_HASH = HashingUtils::HashString("CLUSTER_TERMINATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INTERNAL_ERROR",
+          "VALIDATION_ERROR",
+          "INSTANCE_FAILURE",
+          "CLUSTER_TERMINATED",
+        };
 
         InstanceGroupStateChangeReasonCode GetInstanceGroupStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
-          {
-            return InstanceGroupStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == VALIDATION_ERROR_HASH)
-          {
-            return InstanceGroupStateChangeReasonCode::VALIDATION_ERROR;
-          }
-          else if (hashCode == INSTANCE_FAILURE_HASH)
-          {
-            return InstanceGroupStateChangeReasonCode::INSTANCE_FAILURE;
-          }
-          else if (hashCode == CLUSTER_TERMINATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceGroupStateChangeReasonCode::CLUSTER_TERMINATED;
+          case -485608986:
+            if (name == "INTERNAL_ERROR")
+            {
+              return InstanceGroupStateChangeReasonCode::INTERNAL_ERROR;
+            }
+            break;
+          case -998542686:
+            if (name == "VALIDATION_ERROR")
+            {
+              return InstanceGroupStateChangeReasonCode::VALIDATION_ERROR;
+            }
+            break;
+          case -547060800:
+            if (name == "INSTANCE_FAILURE")
+            {
+              return InstanceGroupStateChangeReasonCode::INSTANCE_FAILURE;
+            }
+            break;
+          case 1492215208:
+            if (name == "CLUSTER_TERMINATED")
+            {
+              return InstanceGroupStateChangeReasonCode::CLUSTER_TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return InstanceGroupStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceGroupStateChangeReasonCode(InstanceGroupStateChangeReasonCode enumValue)
+        const char* GetNameForInstanceGroupStateChangeReasonCodeCStr(InstanceGroupStateChangeReasonCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceGroupStateChangeReasonCode::INTERNAL_ERROR:
-            return "INTERNAL_ERROR";
-          case InstanceGroupStateChangeReasonCode::VALIDATION_ERROR:
-            return "VALIDATION_ERROR";
-          case InstanceGroupStateChangeReasonCode::INSTANCE_FAILURE:
-            return "INSTANCE_FAILURE";
-          case InstanceGroupStateChangeReasonCode::CLUSTER_TERMINATED:
-            return "CLUSTER_TERMINATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceGroupStateChangeReasonCode(InstanceGroupStateChangeReasonCode enumValue)
+        {
+          return GetNameForInstanceGroupStateChangeReasonCodeCStr(enumValue);
         }
 
       } // namespace InstanceGroupStateChangeReasonCodeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace InstanceGroupTypeMapper
       {
 
-        static const int MASTER_HASH = HashingUtils::HashString("MASTER");
-        static const int CORE_HASH = HashingUtils::HashString("CORE");
-        static const int TASK_HASH = HashingUtils::HashString("TASK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MASTER",
+          "CORE",
+          "TASK",
+        };
 
         InstanceGroupType GetInstanceGroupTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MASTER_HASH)
-          {
-            return InstanceGroupType::MASTER;
-          }
-          else if (hashCode == CORE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceGroupType::CORE;
-          }
-          else if (hashCode == TASK_HASH)
-          {
-            return InstanceGroupType::TASK;
+          case -2027938206:
+            if (name == "MASTER")
+            {
+              return InstanceGroupType::MASTER;
+            }
+            break;
+          case 2074527:
+            if (name == "CORE")
+            {
+              return InstanceGroupType::CORE;
+            }
+            break;
+          case 2567557:
+            if (name == "TASK")
+            {
+              return InstanceGroupType::TASK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InstanceGroupType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceGroupType(InstanceGroupType enumValue)
+        const char* GetNameForInstanceGroupTypeCStr(InstanceGroupType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceGroupType::MASTER:
-            return "MASTER";
-          case InstanceGroupType::CORE:
-            return "CORE";
-          case InstanceGroupType::TASK:
-            return "TASK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceGroupType(InstanceGroupType enumValue)
+        {
+          return GetNameForInstanceGroupTypeCStr(enumValue);
         }
 
       } // namespace InstanceGroupTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace InstanceRoleTypeMapper
       {
 
-        static const int MASTER_HASH = HashingUtils::HashString("MASTER");
-        static const int CORE_HASH = HashingUtils::HashString("CORE");
-        static const int TASK_HASH = HashingUtils::HashString("TASK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MASTER",
+          "CORE",
+          "TASK",
+        };
 
         InstanceRoleType GetInstanceRoleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MASTER_HASH)
-          {
-            return InstanceRoleType::MASTER;
-          }
-          else if (hashCode == CORE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceRoleType::CORE;
-          }
-          else if (hashCode == TASK_HASH)
-          {
-            return InstanceRoleType::TASK;
+          case -2027938206:
+            if (name == "MASTER")
+            {
+              return InstanceRoleType::MASTER;
+            }
+            break;
+          case 2074527:
+            if (name == "CORE")
+            {
+              return InstanceRoleType::CORE;
+            }
+            break;
+          case 2567557:
+            if (name == "TASK")
+            {
+              return InstanceRoleType::TASK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InstanceRoleType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceRoleType(InstanceRoleType enumValue)
+        const char* GetNameForInstanceRoleTypeCStr(InstanceRoleType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceRoleType::MASTER:
-            return "MASTER";
-          case InstanceRoleType::CORE:
-            return "CORE";
-          case InstanceRoleType::TASK:
-            return "TASK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceRoleType(InstanceRoleType enumValue)
+        {
+          return GetNameForInstanceRoleTypeCStr(enumValue);
         }
 
       } // namespace InstanceRoleTypeMapper
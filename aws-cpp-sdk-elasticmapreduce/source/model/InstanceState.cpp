@@ -30,35 +30,58 @@ namespace Aws
       namespace InstanceStateMapper
       {
 
-        static const int AWAITING_FULFILLMENT_HASH = HashingUtils::HashString("AWAITING_FULFILLMENT");
-        static const int PROVISIONING_HASH = HashingUtils::HashString("PROVISIONING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AWAITING_FULFILLMENT",
+          "PROVISIONING",
+          "BOOTSTRAPPING",
+          "RUNNING",
+          "TERMINATED",
+        };
 
         InstanceState GetInstanceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWAITING_FULFILLMENT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceState::AWAITING_FULFILLMENT;
-          }
-          else if (hashCode == PROVISIONING_HASH)
-          {
-            return InstanceState::PROVISIONING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
-            return InstanceState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return InstanceState::RUNNING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return InstanceState::TERMINATED;
+          case -281610037:
+            if (name == "AWAITING_FULFILLMENT")
+            {
+              return InstanceState::AWAITING_FULFILLMENT;
+            }
+            break;
+          case -1856587027:
+            if (name == "PROVISIONING")
+            {
+              return InstanceState::PROVISIONING;
+            }
+            break;
+          case -2054192960:
+            if (name == "BOOTSTRAPPING")
+            {
+              return InstanceState::BOOTSTRAPPING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return InstanceState::RUNNING;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return InstanceState::TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return InstanceState::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceState(InstanceState enumValue)
+        const char* GetNameForInstanceStateCStr(InstanceState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceState::AWAITING_FULFILLMENT:
-            return "AWAITING_FULFILLMENT";
-          case InstanceState::PROVISIONING:
-            return "PROVISIONING";
-          case InstanceState::BOOTSTRAPPING:
-            return "BOOTSTRAPPING";
-          case InstanceState::RUNNING:
-            return "RUNNING";
-          case InstanceState::TERMINATED:
-            return "TERMINATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceState(InstanceState enumValue)
+        {
+          return GetNameForInstanceStateCStr(enumValue);
         }
 
       } // namespace InstanceStateMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace InstanceStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int VALIDATION_ERROR_HASH = HashingUtils::HashString("VALIDATION_ERROR");
-        static const int INSTANCE_FAILURE_HASH = HashingUtils::HashString("INSTANCE_FAILURE");
-        static const int BOOTSTRAP_FAILURE_HASH = HashingUtils::HashString("BOOTSTRAP_FAILURE");
-        static const int CLUSTER_TERMINATED_HASH = HashingUtils::HashString("CLUSTER_TERMINATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INTERNAL_ERROR",
+          "VALIDATION_ERROR",
+          "INSTANCE_FAILURE",
+          "BOOTSTRAP_FAILURE",
+          "CLUSTER_TERMINATED",
+        };
 
         InstanceStateChangeReasonCode GetInstanceStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == VALIDATION_ERROR_HASH)
-          {
-            return InstanceStateChangeReasonCode::VALIDATION_ERROR;
-          }
-          else if (hashCode == INSTANCE_FAILURE_HASH)
-          {
-            return InstanceStateChangeReasonCode::INSTANCE_FAILURE;
-          }
-          else if (hashCode == BOOTSTRAP_FAILURE_HASH)
-          {
-            return InstanceStateChangeReasonCode::BOOTSTRAP_FAILURE;
-          }
-          else if (hashCode == CLUSTER_TERMINATED_HASH)
-          {
-            return InstanceStateChangeReasonCode::CLUSTER_TERMINATED;
+          case -485608986:
+            if (name == "INTERNAL_ERROR")
+            {
+              return InstanceStateChangeReasonCode::INTERNAL_ERROR;
+            }
+            break;
+          case -998542686:
+            if (name == "VALIDATION_ERROR")
+            {
+              return InstanceStateChangeReasonCode::VALIDATION_ERROR;
+            }
+            break;
+          case -547060800:
+            if (name == "INSTANCE_FAILURE")
+            {
+              return InstanceStateChangeReasonCode::INSTANCE_FAILURE;
+            }
+            break;
+          case -1645144967:
+            if (name == "BOOTSTRAP_FAILURE")
+            {
+              return InstanceStateChangeReasonCode::BOOTSTRAP_FAILURE;
+            }
+            break;
+          case 1492215208:
+            if (name == "CLUSTER_TERMINATED")
+            {
+              return InstanceStateChangeReasonCode::CLUSTER_TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return InstanceStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceStateChangeReasonCode(InstanceStateChangeReasonCode enumValue)
+        const char* GetNameForInstanceStateChangeReasonCodeCStr(InstanceStateChangeReasonCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceStateChangeReasonCode::INTERNAL_ERROR:
-            return "INTERNAL_ERROR";
-          case InstanceStateChangeReasonCode::VALIDATION_ERROR:
-            return "VALIDATION_ERROR";
-          case InstanceStateChangeReasonCode::INSTANCE_FAILURE:
-            return "INSTANCE_FAILURE";
-          case InstanceStateChangeReasonCode::BOOTSTRAP_FAILURE:
-            return "BOOTSTRAP_FAILURE";
-          case InstanceStateChangeReasonCode::CLUSTER_TERMINATED:
-            return "CLUSTER_TERMINATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceStateChangeReasonCode(InstanceStateChangeReasonCode enumValue)
+        {
+          return GetNameForInstanceStateChangeReasonCodeCStr(enumValue);
         }
 
       } // namespace InstanceStateChangeReasonCodeMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace JobFlowExecutionStateMapper
       {
 
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int WAITING_HASH = HashingUtils::HashString("WAITING");
-        static const int SHUTTING_DOWN_HASH = HashingUtils::HashString("SHUTTING_DOWN");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STARTING",
+          "BOOTSTRAPPING",
+          "RUNNING",
+          "WAITING",
+          "SHUTTING_DOWN",
+          "TERMINATED",
+          "COMPLETED",
+          "FAILED",
+        };
 
         JobFlowExecutionState GetJobFlowExecutionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTING_HASH)
-          {
-            return JobFlowExecutionState::STARTING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
-            return JobFlowExecutionState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return JobFlowExecutionState::RUNNING;
-          }
-          else if (hashCode == WAITING_HASH)
-          {
-            return JobFlowExecutionState::WAITING;
-          }
-          else if (hashCode == SHUTTING_DOWN_HASH)
-          {
-            return JobFlowExecutionState::SHUTTING_DOWN;
-          }
-          else if (hashCode == TERMINATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobFlowExecutionState::TERMINATED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return JobFlowExecutionState::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobFlowExecutionState::FAILED;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return JobFlowExecutionState::STARTING;
+            }
+            break;
+          case -2054192960:
+            if (name == "BOOTSTRAPPING")
+            {
+              return JobFlowExecutionState::BOOTSTRAPPING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return JobFlowExecutionState::RUNNING;
+            }
+            break;
+          case 1834295853:
+            if (name == "WAITING")
+            {
+              return JobFlowExecutionState::WAITING;
+            }
+            break;
+          case -120764897:
+            if (name == "SHUTTING_DOWN")
+            {
+              return JobFlowExecutionState::SHUTTING_DOWN;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return JobFlowExecutionState::TERMINATED;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return JobFlowExecutionState::COMPLETED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return JobFlowExecutionState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return JobFlowExecutionState::NOT_SET;
         }
 
-        Aws::String GetNameForJobFlowExecutionState(JobFlowExecutionState enumValue)
+        const char* GetNameForJobFlowExecutionStateCStr(JobFlowExecutionState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobFlowExecutionState::STARTING:
-            return "STARTING";
-          case JobFlowExecutionState::BOOTSTRAPPING:
-            return "BOOTSTRAPPING";
-          case JobFlowExecutionState::RUNNING:
-            return "RUNNING";
-          case JobFlowExecutionState::WAITING:
-            return "WAITING";
-          case JobFlowExecutionState::SHUTTING_DOWN:
-            return "SHUTTING_DOWN";
-          case JobFlowExecutionState::TERMINATED:
-            return "TERMINATED";
-          case JobFlowExecutionState::COMPLETED:
-            return "COMPLETED";
-          case JobFlowExecutionState::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobFlowExecutionState(JobFlowExecutionState enumValue)
+        {
+          return GetNameForJobFlowExecutionStateCStr(enumValue);
         }
 
       } // namespace JobFlowExecutionStateMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace MarketTypeMapper
       {
 
-        static const int ON_DEMAND_HASH = HashingUtils::HashString("ON_DEMAND");
-        static const int SPOT_HASH = HashingUtils::HashString("SPOT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ON_DEMAND",
+          "SPOT",
+        };
 
         MarketType GetMarketTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ON_DEMAND_HASH)
-          {
-            return MarketType::ON_DEMAND;
-          }
-          else if (hashCode == SPOT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MarketType::SPOT;
+          case -2128361301:
+            if (name == "ON_DEMAND")
+            {
+              return MarketType::ON_DEMAND;
+            }
+            break;
+          case 2552066:
+            if (name == "SPOT")
+            {
+              return MarketType::SPOT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MarketType::NOT_SET;
         }
 
-        Aws::String GetNameForMarketType(MarketType enumValue)
+        const char* GetNameForMarketTypeCStr(MarketType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MarketType::ON_DEMAND:
-            return "ON_DEMAND";
-          case MarketType::SPOT:
-            return "SPOT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMarketType(MarketType enumValue)
+        {
+          return GetNameForMarketTypeCStr(enumValue);
         }
 
       } // namespace MarketTypeMapper
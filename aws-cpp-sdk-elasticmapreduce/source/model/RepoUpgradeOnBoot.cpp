@@ -30,20 +30,37 @@ namespace Aws
       namespace RepoUpgradeOnBootMapper
       {
 
-        static const int SECURITY_HASH = HashingUtils::HashString("SECURITY");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SECURITY",
+          "NONE",
+        };
 
         RepoUpgradeOnBoot GetRepoUpgradeOnBootForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SECURITY_HASH)
-          {
-            return RepoUpgradeOnBoot::SECURITY;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RepoUpgradeOnBoot::NONE;
+          case 1731749696:
+            if (name == "SECURITY")
+            {
+              return RepoUpgradeOnBoot::SECURITY;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return RepoUpgradeOnBoot::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RepoUpgradeOnBoot::NOT_SET;
         }
 
-        Aws::String GetNameForRepoUpgradeOnBoot(RepoUpgradeOnBoot enumValue)
+        const char* GetNameForRepoUpgradeOnBootCStr(RepoUpgradeOnBoot enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RepoUpgradeOnBoot::SECURITY:
-            return "SECURITY";
-          case RepoUpgradeOnBoot::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRepoUpgradeOnBoot(RepoUpgradeOnBoot enumValue)
+        {
+          return GetNameForRepoUpgradeOnBootCStr(enumValue);
         }
 
       } // namespace RepoUpgradeOnBootMapper
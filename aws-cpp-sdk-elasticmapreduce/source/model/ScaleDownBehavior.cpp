@@ -30,20 +30,37 @@ namespace Aws
       namespace ScaleDownBehaviorMapper
       {
 
-        static const int TERMINATE_AT_INSTANCE_HOUR_HASH = HashingUtils::HashString("TERMINATE_AT_INSTANCE_HOUR");
-        static const int TERMINATE_AT_TASK_COMPLETION_HASH = HashingUtils::HashString("TERMINATE_AT_TASK_COMPLETION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TERMINATE_AT_INSTANCE_HOUR",
+          "TERMINATE_AT_TASK_COMPLETION",
+        };
 
         ScaleDownBehavior GetScaleDownBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERMINATE_AT_INSTANCE_HOUR_HASH)
-          {
-            return ScaleDownBehavior::TERMINATE_AT_INSTANCE_HOUR;
-          }
-          else if (hashCode == TERMINATE_AT_TASK_COMPLETION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScaleDownBehavior::TERMINATE_AT_TASK_COMPLETION;
+          case -1421772160:
+            if (name == "TERMINATE_AT_INSTANCE_HOUR")
+            {
+              return ScaleDownBehavior::TERMINATE_AT_INSTANCE_HOUR;
+            }
+            break;
+          case 308576648:
+            if (name == "TERMINATE_AT_TASK_COMPLETION")
+            {
+              return ScaleDownBehavior::TERMINATE_AT_TASK_COMPLETION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ScaleDownBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForScaleDownBehavior(ScaleDownBehavior enumValue)
+        const char* GetNameForScaleDownBehaviorCStr(ScaleDownBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScaleDownBehavior::TERMINATE_AT_INSTANCE_HOUR:
-            return "TERMINATE_AT_INSTANCE_HOUR";
-          case ScaleDownBehavior::TERMINATE_AT_TASK_COMPLETION:
-            return "TERMINATE_AT_TASK_COMPLETION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScaleDownBehavior(ScaleDownBehavior enumValue)
+        {
+          return GetNameForScaleDownBehaviorCStr(enumValue);
         }
 
       } // namespace ScaleDownBehaviorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SpotProvisioningTimeoutActionMapper
       {
 
-        static const int SWITCH_TO_ON_DEMAND_HASH = HashingUtils::HashString("SWITCH_TO_ON_DEMAND");
-        static const int TERMINATE_CLUSTER_HASH = HashingUtils::HashString("TERMINATE_CLUSTER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SWITCH_TO_ON_DEMAND",
+          "TERMINATE_CLUSTER",
+        };
 
         SpotProvisioningTimeoutAction GetSpotProvisioningTimeoutActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SWITCH_TO_ON_DEMAND_HASH)
-          {
-            return SpotProvisioningTimeoutAction::SWITCH_TO_ON_DEMAND;
-          }
-          else if (hashCode == TERMINATE_CLUSTER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SpotProvisioningTimeoutAction::TERMINATE_CLUSTER;
+          case -1362246894:
+            if (name == "SWITCH_TO_ON_DEMAND")
+            {
+              return SpotProvisioningTimeoutAction::SWITCH_TO_ON_DEMAND;
+            }
+            break;
+          case 796606940:
+            if (name == "TERMINATE_CLUSTER")
+            {
+              return SpotProvisioningTimeoutAction::TERMINATE_CLUSTER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SpotProvisioningTimeoutAction::NOT_SET;
         }
 
-        Aws::String GetNameForSpotProvisioningTimeoutAction(SpotProvisioningTimeoutAction enumValue)
+        const char* GetNameForSpotProvisioningTimeoutActionCStr(SpotProvisioningTimeoutAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SpotProvisioningTimeoutAction::SWITCH_TO_ON_DEMAND:
-            return "SWITCH_TO_ON_DEMAND";
-          case SpotProvisioningTimeoutAction::TERMINATE_CLUSTER:
-            return "TERMINATE_CLUSTER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSpotProvisioningTimeoutAction(SpotProvisioningTimeoutAction enumValue)
+        {
+          return GetNameForSpotProvisioningTimeoutActionCStr(enumValue);
         }
 
       } // namespace SpotProvisioningTimeoutActionMapper
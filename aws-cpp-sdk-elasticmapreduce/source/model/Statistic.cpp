@@ -30,35 +30,58 @@ namespace Aws
       namespace StatisticMapper
       {
 
-        static const int SAMPLE_COUNT_HASH = HashingUtils::HashString("SAMPLE_COUNT");
-        static const int AVERAGE_HASH = HashingUtils::HashString("AVERAGE");
-        static const int SUM_HASH = HashingUtils::HashString("SUM");
-        static const int MINIMUM_HASH = HashingUtils::HashString("MINIMUM");
-        static const int MAXIMUM_HASH = HashingUtils::HashString("MAXIMUM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SAMPLE_COUNT",
+          "AVERAGE",
+          "SUM",
+          "MINIMUM",
+          "MAXIMUM",
+        };
 
         Statistic GetStatisticForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SAMPLE_COUNT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Statistic::SAMPLE_COUNT;
-          }
-          else if (hashCode == AVERAGE_HASH)
-          {
-            return Statistic::AVERAGE;
-          }
-          else if (hashCode == SUM_HASH)
-          {
-            return Statistic::SUM;
-          }
-          else if (hashCode == MINIMUM_HASH)
-          {
-            return Statistic::MINIMUM;
-          }
-          else if (hashCode == MAXIMUM_HASH)
-          {
-            return Statistic::MAXIMUM;
+          case -620970470:
+            if (name == "SAMPLE_COUNT")
+            {
+              return Statistic::SAMPLE_COUNT;
+            }
+            break;
+          case 86534653:
+            if (name == "AVERAGE")
+            {
+              return Statistic::AVERAGE;
+            }
+            break;
+          case 82475:
+            if (name == "SUM")
+            {
+              return Statistic::SUM;
+            }
+            break;
+          case 1782520814:
+            if (name == "MINIMUM")
+            {
+              return Statistic::MINIMUM;
+            }
+            break;
+          case 1562722816:
+            if (name == "MAXIMUM")
+            {
+              return Statistic::MAXIMUM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return Statistic::NOT_SET;
         }
 
-        Aws::String GetNameForStatistic(Statistic enumValue)
+        const char* GetNameForStatisticCStr(Statistic enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Statistic::SAMPLE_COUNT:
-            return "SAMPLE_COUNT";
-          case Statistic::AVERAGE:
-            return "AVERAGE";
-          case Statistic::SUM:
-            return "SUM";
-          case Statistic::MINIMUM:
-            return "MINIMUM";
-          case Statistic::MAXIMUM:
-            return "MAXIMUM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatistic(Statistic enumValue)
+        {
+          return GetNameForStatisticCStr(enumValue);
         }
 
       } // namespace StatisticMapper
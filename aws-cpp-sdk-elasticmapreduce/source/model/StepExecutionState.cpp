@@ -30,45 +30,72 @@ namespace Aws
       namespace StepExecutionStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int CONTINUE_HASH = HashingUtils::HashString("CONTINUE");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int INTERRUPTED_HASH = HashingUtils::HashString("INTERRUPTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "RUNNING",
+          "CONTINUE",
+          "COMPLETED",
+          "CANCELLED",
+          "FAILED",
+          "INTERRUPTED",
+        };
 
         StepExecutionState GetStepExecutionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return StepExecutionState::PENDING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return StepExecutionState::RUNNING;
-          }
-          else if (hashCode == CONTINUE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StepExecutionState::CONTINUE;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return StepExecutionState::COMPLETED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return StepExecutionState::CANCELLED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StepExecutionState::FAILED;
-          }
-          else if (hashCode == INTERRUPTED_HASH)
-          {
-            return StepExecutionState::INTERRUPTED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return StepExecutionState::PENDING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return StepExecutionState::RUNNING;
+            }
+            break;
+          case 215424167:
+            if (name == "CONTINUE")
+            {
+              return StepExecutionState::CONTINUE;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return StepExecutionState::COMPLETED;
+            }
+            break;
+          case -1031784143:
+            if (name == "CANCELLED")
+            {
+              return StepExecutionState::CANCELLED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return StepExecutionState::FAILED;
+            }
+            break;
+          case 205308450:
+            if (name == "INTERRUPTED")
+            {
+              return StepExecutionState::INTERRUPTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return StepExecutionState::NOT_SET;
         }
 
-        Aws::String GetNameForStepExecutionState(StepExecutionState enumValue)
+        const char* GetNameForStepExecutionStateCStr(StepExecutionState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StepExecutionState::PENDING:
-            return "PENDING";
-          case StepExecutionState::RUNNING:
-            return "RUNNING";
-          case StepExecutionState::CONTINUE:
-            return "CONTINUE";
-          case StepExecutionState::COMPLETED:
-            return "COMPLETED";
-          case StepExecutionState::CANCELLED:
-            return "CANCELLED";
-          case StepExecutionState::FAILED:
-            return "FAILED";
-          case StepExecutionState::INTERRUPTED:
-            return "INTERRUPTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStepExecutionState(StepExecutionState enumValue)
+        {
+          return GetNameForStepExecutionStateCStr(enumValue);
         }
 
       } // namespace StepExecutionStateMapper
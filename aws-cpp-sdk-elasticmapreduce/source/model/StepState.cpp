@@ -30,45 +30,72 @@ namespace Aws
       namespace StepStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int CANCEL_PENDING_HASH = HashingUtils::HashString("CANCEL_PENDING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int INTERRUPTED_HASH = HashingUtils::HashString("INTERRUPTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "CANCEL_PENDING",
+          "RUNNING",
+          "COMPLETED",
+          "CANCELLED",
+          "FAILED",
+          "INTERRUPTED",
+        };
 
         StepState GetStepStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return StepState::PENDING;
-          }
-          else if (hashCode == CANCEL_PENDING_HASH)
-          {
-            return StepState::CANCEL_PENDING;
-          }
-          else if (hashCode == RUNNING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StepState::RUNNING;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return StepState::COMPLETED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return StepState::CANCELLED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StepState::FAILED;
-          }
-          else if (hashCode == INTERRUPTED_HASH)
-          {
-            return StepState::INTERRUPTED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return StepState::PENDING;
+            }
+            break;
+          case 1729348786:
+            if (name == "CANCEL_PENDING")
+            {
+              return StepState::CANCEL_PENDING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return StepState::RUNNING;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return StepState::COMPLETED;
+            }
+            break;
+          case -1031784143:
+            if (name == "CANCELLED")
+            {
+              return StepState::CANCELLED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return StepState::FAILED;
+            }
+            break;
+          case 205308450:
+            if (name == "INTERRUPTED")
+            {
+              return StepState::INTERRUPTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return StepState::NOT_SET;
         }
 
-        Aws::String GetNameForStepState(StepState enumValue)
+        const char* GetNameForStepStateCStr(StepState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StepState::PENDING:
-            return "PENDING";
-          case StepState::CANCEL_PENDING:
-            return "CANCEL_PENDING";
-          case StepState::RUNNING:
-            return "RUNNING";
-          case StepState::COMPLETED:
-            return "COMPLETED";
-          case StepState::CANCELLED:
-            return "CANCELLED";
-          case StepState::FAILED:
-            return "FAILED";
-          case StepState::INTERRUPTED:
-            return "INTERRUPTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStepState(StepState enumValue)
+        {
+          return GetNameForStepStateCStr(enumValue);
         }
 
       } // namespace StepStateMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace StepStateChangeReasonCodeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+        };
 
         StepStateChangeReasonCode GetStepStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StepStateChangeReasonCode::NONE;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return StepStateChangeReasonCode::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return StepStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForStepStateChangeReasonCode(StepStateChangeReasonCode enumValue)
+        const char* GetNameForStepStateChangeReasonCodeCStr(StepStateChangeReasonCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StepStateChangeReasonCode::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStepStateChangeReasonCode(StepStateChangeReasonCode enumValue)
+        {
+          return GetNameForStepStateChangeReasonCodeCStr(enumValue);
         }
 
       } // namespace StepStateChangeReasonCodeMapper
@@ -30,145 +30,212 @@ namespace Aws
       namespace UnitMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SECONDS_HASH = HashingUtils::HashString("SECONDS");
-        static const int MICRO_SECONDS_HASH = HashingUtils::HashString("MICRO_SECONDS");
-        static const int MILLI_SECONDS_HASH = HashingUtils::HashString("MILLI_SECONDS");
-        static const int BYTES_HASH = HashingUtils::HashString("BYTES");
-        static const int KILO_BYTES_HASH = HashingUtils::HashString("KILO_BYTES");
-        static const int MEGA_BYTES_HASH = HashingUtils::HashString("MEGA_BYTES");
-        static const int GIGA_BYTES_HASH = HashingUtils::HashString("GIGA_BYTES");
-        static const int TERA_BYTES_HASH = HashingUtils::HashString("TERA_BYTES");
-        static const int BITS_HASH = HashingUtils::HashString("BITS");
-        static const int KILO_BITS_HASH = HashingUtils::HashString("KILO_BITS");
-        static const int MEGA_BITS_HASH = HashingUtils::HashString("MEGA_BITS");
-        static const int GIGA_BITS_HASH = HashingUtils::HashString("GIGA_BITS");
-        static const int TERA_BITS_HASH = HashingUtils::HashString("TERA_BITS");
-        static const int PERCENT_HASH = HashingUtils::HashString("PERCENT");
-        static const int COUNT_HASH = HashingUtils::HashString("COUNT");
-        static const int BYTES_PER_SECOND_HASH = HashingUtils::HashString("BYTES_PER_SECOND");
-        static const int KILO_BYTES_PER_SECOND_HASH = HashingUtils::HashString("KILO_BYTES_PER_SECOND");
-        static const int MEGA_BYTES_PER_SECOND_HASH = HashingUtils::HashString("MEGA_BYTES_PER_SECOND");
-        static const int GIGA_BYTES_PER_SECOND_HASH = HashingUtils::HashString("GIGA_BYTES_PER_SECOND");
-        static const int TERA_BYTES_PER_SECOND_HASH = HashingUtils::HashString("TERA_BYTES_PER_SECOND");
-        static const int BITS_PER_SECOND_HASH = HashingUtils::HashString("BITS_PER_SECOND");
-        static const int KILO_BITS_PER_SECOND_HASH = HashingUtils::HashString("KILO_BITS_PER_SECOND");
-        static const int MEGA_BITS_PER_SECOND_HASH = HashingUtils::HashString("MEGA_BITS_PER_SECOND");
-        static const int GIGA_BITS_PER_SECOND_HASH = HashingUtils::HashString("GIGA_BITS_PER_SECOND");
-        static const int TERA_BITS_PER_SECOND_HASH = HashingUtils::HashString("TERA_BITS_PER_SECOND");
-        static const int COUNT_PER_SECOND_HASH = HashingUtils::HashString("COUNT_PER_SECOND");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "SECONDS",
+          "MICRO_SECONDS",
+          "MILLI_SECONDS",
+          "BYTES",
+          "KILO_BYTES",
+          "MEGA_BYTES",
+          "GIGA_BYTES",
+          "TERA_BYTES",
+          "BITS",
+          "KILO_BITS",
+          "MEGA_BITS",
+          "GIGA_BITS",
+          "TERA_BITS",
+          "PERCENT",
+          "COUNT",
+          "BYTES_PER_SECOND",
+          "KILO_BYTES_PER_SECOND",
+          "MEGA_BYTES_PER_SECOND",
+          "GIGA_BYTES_PER_SECOND",
+          "TERA_BYTES_PER_SECOND",
+          "BITS_PER_SECOND",
+          "KILO_BITS_PER_SECOND",
+          "MEGA_BITS_PER_SECOND",
+          "GIGA_BITS_PER_SECOND",
+          "TERA_BITS_PER_SECOND",
+          "COUNT_PER_SECOND",
+        };
 
         Unit GetUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return Unit::NONE;
-          }
-          else if (hashCode == SECONDS_HASH)
-          {
-            return Unit::SECONDS;
-          }
-          else if (hashCode == MICRO_SECONDS_HASH)
-          {
-            return Unit::MICRO_SECONDS;
-          }
-          else if (hashCode == MILLI_SECONDS_HASH)
-          {
-            return Unit::MILLI_SECONDS;
-          }
-          else if (hashCode == BYTES_HASH)
-          {
-            return Unit::BYTES;
-          }
-          else if (hashCode == KILO_BYTES_HASH)
-          {
-            return Unit::KILO_BYTES;
-          }
-          else if (hashCode == MEGA_BYTES_HASH)
-          {
-            return Unit::MEGA_BYTES;
-          }
-          else if (hashCode == GIGA_BYTES_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Unit::GIGA_BYTES;
-          }
-          else if (hashCode == TERA_BYTES_HASH)
-          {
-            return Unit::TERA_BYTES;
-          }
-          else if (hashCode == BITS_HASH)
-          {
-            return Unit::BITS;
-          }
-          else if (hashCode == KILO_BITS_HASH)
-          {
-            return Unit::KILO_BITS;
-          }
-          else if (hashCode == MEGA_BITS_HASH)
-          {
-            return Unit::MEGA_BITS;
-          }
-          else if (hashCode == GIGA_BITS_HASH)
-          {
-            return Unit::GIGA_BITS;
-          }
-          else if (hashCode == TERA_BITS_HASH)
-          {
-            return Unit::TERA_BITS;
-          }
-          else if (hashCode == PERCENT_HASH)
-          {
-            return Unit::PERCENT;
-          }
-          else if (hashCode == COUNT_HASH)
-          {
-            return Unit::COUNT;
-          }
-          else if (hashCode == BYTES_PER_SECOND_HASH)
-          {
-            return Unit::BYTES_PER_SECOND;
-          }
-          else if (hashCode == KILO_BYTES_PER_SECOND_HASH)
-          {
-            return Unit::KILO_BYTES_PER_SECOND;
-          }
-          else if (hashCode == MEGA_BYTES_PER_SECOND_HASH)
-          {
-            return Unit::MEGA_BYTES_PER_SECOND;
-          }
-          else if (hashCode == GIGA_BYTES_PER_SECOND_HASH)
-          {
-            return Unit::GIGA_BYTES_PER_SECOND;
-          }
-          else if (hashCode == TERA_BYTES_PER_SECOND_HASH)
-          {
-            return Unit::TERA_BYTES_PER_SECOND;
-          }
-          else if (hashCode == BITS_PER_SECOND_HASH)
-          {
-            return Unit::BITS_PER_SECOND;
-          }
-          else if (hashCode == KILO_BITS_PER_SECOND_HASH)
-          {
-            return Unit::KILO_BITS_PER_SECOND;
-          }
-          else if (hashCode == MEGA_BITS_PER_SECOND_HASH)
-          {
-            return Unit::MEGA_BITS_PER_SECOND;
-          }
-          else if (hashCode == GIGA_BITS_PER_SECOND_HASH)
-          {
-            return Unit::GIGA_BITS_PER_SECOND;
-          }
-          else if (hashCode == TERA_BITS_PER_SECOND_HASH)
-          {
-            return Unit::TERA_BITS_PER_SECOND;
-          }
-          else if (hashCode == COUNT_PER_SECOND_HASH)
-          {
-            return Unit::COUNT_PER_SECOND;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Unit::NONE;
+            }
+            break;
+          case -1606887841:
+            if (name == "SECONDS")
+            {
+              return Unit::SECONDS;
+            }
+            break;
+          case 341368772:
+            if (name == "MICRO_SECONDS")
+            {
+              return Unit::MICRO_SECONDS;
+            }
+            break;
+          case 487581645:
+            if (name == "MILLI_SECONDS")
+            {
+              return Unit::MILLI_SECONDS;
+            }
+            break;
+          case 63686731:
+            if (name == "BYTES")
+            {
+              return Unit::BYTES;
+            }
+            break;
+          case -1462398483:
+            if (name == "KILO_BYTES")
+            {
+              return Unit::KILO_BYTES;
+            }
+            break;
+          case 1415158334:
+            if (name == "MEGA_BYTES")
+            {
+              return Unit::MEGA_BYTES;
+            }
+            break;
+          case -340611192:
+            if (name == "GIGA_BYTES")
+            {
+              return Unit::GIGA_BYTES;
+            }
+            break;
+          case 2030608300:
+            if (name == "TERA_BYTES")
+            {
+              return Unit::TERA_BYTES;
+            }
+            break;
+          case 2039046:
+            if (name == "BITS")
+            {
+              return Unit::BITS;
+            }
+            break;
+          case 1338283812:
+            if (name == "KILO_BITS")
+            {
+              return Unit::KILO_BITS;
+            }
+            break;
+          case -1201291085:
+            if (name == "MEGA_BITS")
+            {
+              return Unit::MEGA_BITS;
+            }
+            break;
+          case -565192151:
+            if (name == "GIGA_BITS")
+            {
+              return Unit::GIGA_BITS;
+            }
+            break;
+          case 204035461:
+            if (name == "TERA_BITS")
+            {
+              return Unit::TERA_BITS;
+            }
+            break;
+          case 39055397:
+            if (name == "PERCENT")
+            {
+              return Unit::PERCENT;
+            }
+            break;
+          case 64313583:
+            if (name == "COUNT")
+            {
+              return Unit::COUNT;
+            }
+            break;
+          case 1358223978:
+            if (name == "BYTES_PER_SECOND")
+            {
+              return Unit::BYTES_PER_SECOND;
+            }
+            break;
+          case -1248979064:
+            if (name == "KILO_BYTES_PER_SECOND")
+            {
+              return Unit::KILO_BYTES_PER_SECOND;
+            }
+            break;
+          case 1810522775:
+            if (name == "MEGA_BYTES_PER_SECOND")
+            {
+              return Unit::MEGA_BYTES_PER_SECOND;
+            }
+            break;
+          case -1092879603:
+            if (name == "GIGA_BYTES_PER_SECOND")
+            {
+              return Unit::GIGA_BYTES_PER_SECOND;
+            }
+            break;
+          case -1704244119:
+            if (name == "TERA_BYTES_PER_SECOND")
+            {
+              return Unit::TERA_BYTES_PER_SECOND;
+            }
+            break;
+          case 1539887823:
+            if (name == "BITS_PER_SECOND")
+            {
+              return Unit::BITS_PER_SECOND;
+            }
+            break;
+          case -760972815:
+            if (name == "KILO_BITS_PER_SECOND")
+            {
+              return Unit::KILO_BITS_PER_SECOND;
+            }
+            break;
+          case 723194114:
+            if (name == "MEGA_BITS_PER_SECOND")
+            {
+              return Unit::MEGA_BITS_PER_SECOND;
+            }
+            break;
+          case -201748020:
+            if (name == "GIGA_BITS_PER_SECOND")
+            {
+              return Unit::GIGA_BITS_PER_SECOND;
+            }
+            break;
+          case -221469456:
+            if (name == "TERA_BITS_PER_SECOND")
+            {
+              return Unit::TERA_BITS_PER_SECOND;
+            }
+            break;
+          case -65062074:
+            if (name == "COUNT_PER_SECOND")
+            {
+              return Unit::COUNT_PER_SECOND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -180,73 +247,26 @@ namespace Aws
           return Unit::NOT_SET;
         }
 
-        Aws::String GetNameForUnit(Unit enumValue)
+        const char* GetNameForUnitCStr(Unit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Unit::NONE:
-            return "NONE";
-          case Unit::SECONDS:
-            return "SECONDS";
-          case Unit::MICRO_SECONDS:
-            return "MICRO_SECONDS";
-          case Unit::MILLI_SECONDS:
-            return "MILLI_SECONDS";
-          case Unit::BYTES:
-            return "BYTES";
-          case Unit::KILO_BYTES:
-            return "KILO_BYTES";
-          case Unit::MEGA_BYTES:
-            return "MEGA_BYTES";
-          case Unit::GIGA_BYTES:
-            return "GIGA_BYTES";
-          case Unit::TERA_BYTES:
-            return "TERA_BYTES";
-          case Unit::BITS:
-            return "BITS";
-          case Unit::KILO_BITS:
-            return "KILO_BITS";
-          case Unit::MEGA_BITS:
-            return "MEGA_BITS";
-          case Unit::GIGA_BITS:
-            return "GIGA_BITS";
-          case Unit::TERA_BITS:
-            return "TERA_BITS";
-          case Unit::PERCENT:
-            return "PERCENT";
-          case Unit::COUNT:
-            return "COUNT";
-          case Unit::BYTES_PER_SECOND:
-            return "BYTES_PER_SECOND";
-          case Unit::KILO_BYTES_PER_SECOND:
-            return "KILO_BYTES_PER_SECOND";
-          case Unit::MEGA_BYTES_PER_SECOND:
-            return "MEGA_BYTES_PER_SECOND";
-          case Unit::GIGA_BYTES_PER_SECOND:
-            return "GIGA_BYTES_PER_SECOND";
-          case Unit::TERA_BYTES_PER_SECOND:
-            return "TERA_BYTES_PER_SECOND";
-          case Unit::BITS_PER_SECOND:
-            return "BITS_PER_SECOND";
-          case Unit::KILO_BITS_PER_SECOND:
-            return "KILO_BITS_PER_SECOND";
-          case Unit::MEGA_BITS_PER_SECOND:
-            return "MEGA_BITS_PER_SECOND";
-          case Unit::GIGA_BITS_PER_SECOND:
-            return "GIGA_BITS_PER_SECOND";
-          case Unit::TERA_BITS_PER_SECOND:
-            return "TERA_BITS_PER_SECOND";
-          case Unit::COUNT_PER_SECOND:
-            return "COUNT_PER_SECOND";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUnit(Unit enumValue)
+        {
+          return GetNameForUnitCStr(enumValue);
         }
 
       } // namespace UnitMapper
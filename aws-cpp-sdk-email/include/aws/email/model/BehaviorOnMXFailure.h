@@ -35,6 +35,11 @@ namespace BehaviorOnMXFailureMapper
 AWS_SES_API BehaviorOnMXFailure GetBehaviorOnMXFailureForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForBehaviorOnMXFailure(BehaviorOnMXFailure value);
+
+/**
+ * Same as GetNameForBehaviorOnMXFailure(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForBehaviorOnMXFailureCStr(BehaviorOnMXFailure value);
 } // namespace BehaviorOnMXFailureMapper
 } // namespace Model
 } // namespace SES
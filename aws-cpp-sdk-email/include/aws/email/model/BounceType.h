@@ -39,6 +39,11 @@ namespace BounceTypeMapper
 AWS_SES_API BounceType GetBounceTypeForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForBounceType(BounceType value);
+
+/**
+ * Same as GetNameForBounceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForBounceTypeCStr(BounceType value);
 } // namespace BounceTypeMapper
 } // namespace Model
 } // namespace SES
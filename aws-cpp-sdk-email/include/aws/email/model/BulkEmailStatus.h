@@ -47,6 +47,11 @@ namespace BulkEmailStatusMapper
 AWS_SES_API BulkEmailStatus GetBulkEmailStatusForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForBulkEmailStatus(BulkEmailStatus value);
+
+/**
+ * Same as GetNameForBulkEmailStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForBulkEmailStatusCStr(BulkEmailStatus value);
 } // namespace BulkEmailStatusMapper
 } // namespace Model
 } // namespace SES
@@ -36,6 +36,11 @@ namespace ConfigurationSetAttributeMapper
 AWS_SES_API ConfigurationSetAttribute GetConfigurationSetAttributeForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForConfigurationSetAttribute(ConfigurationSetAttribute value);
+
+/**
+ * Same as GetNameForConfigurationSetAttribute(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForConfigurationSetAttributeCStr(ConfigurationSetAttribute value);
 } // namespace ConfigurationSetAttributeMapper
 } // namespace Model
 } // namespace SES
@@ -37,6 +37,11 @@ namespace CustomMailFromStatusMapper
 AWS_SES_API CustomMailFromStatus GetCustomMailFromStatusForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForCustomMailFromStatus(CustomMailFromStatus value);
+
+/**
+ * Same as GetNameForCustomMailFromStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForCustomMailFromStatusCStr(CustomMailFromStatus value);
 } // namespace CustomMailFromStatusMapper
 } // namespace Model
 } // namespace SES
@@ -38,6 +38,11 @@ namespace DsnActionMapper
 AWS_SES_API DsnAction GetDsnActionForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForDsnAction(DsnAction value);
+
+/**
+ * Same as GetNameForDsnAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForDsnActionCStr(DsnAction value);
 } // namespace DsnActionMapper
 } // namespace Model
 } // namespace SES
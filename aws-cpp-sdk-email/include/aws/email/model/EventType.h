@@ -41,6 +41,11 @@ namespace EventTypeMapper
 AWS_SES_API EventType GetEventTypeForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForEventType(EventType value);
+
+/**
+ * Same as GetNameForEventType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForEventTypeCStr(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace SES
@@ -35,6 +35,11 @@ namespace IdentityTypeMapper
 AWS_SES_API IdentityType GetIdentityTypeForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForIdentityType(IdentityType value);
+
+/**
+ * Same as GetNameForIdentityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForIdentityTypeCStr(IdentityType value);
 } // namespace IdentityTypeMapper
 } // namespace Model
 } // namespace SES
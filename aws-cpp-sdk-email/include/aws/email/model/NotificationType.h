@@ -36,6 +36,11 @@ namespace NotificationTypeMapper
 AWS_SES_API NotificationType GetNotificationTypeForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForNotificationType(NotificationType value);
+
+/**
+ * Same as GetNameForNotificationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForNotificationTypeCStr(NotificationType value);
 } // namespace NotificationTypeMapper
 } // namespace Model
 } // namespace SES
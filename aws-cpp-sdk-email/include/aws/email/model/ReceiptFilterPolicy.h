@@ -35,6 +35,11 @@ namespace ReceiptFilterPolicyMapper
 AWS_SES_API ReceiptFilterPolicy GetReceiptFilterPolicyForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForReceiptFilterPolicy(ReceiptFilterPolicy value);
+
+/**
+ * Same as GetNameForReceiptFilterPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForReceiptFilterPolicyCStr(ReceiptFilterPolicy value);
 } // namespace ReceiptFilterPolicyMapper
 } // namespace Model
 } // namespace SES
@@ -35,6 +35,11 @@ namespace SNSActionEncodingMapper
 AWS_SES_API SNSActionEncoding GetSNSActionEncodingForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForSNSActionEncoding(SNSActionEncoding value);
+
+/**
+ * Same as GetNameForSNSActionEncoding(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForSNSActionEncodingCStr(SNSActionEncoding value);
 } // namespace SNSActionEncodingMapper
 } // namespace Model
 } // namespace SES
@@ -34,6 +34,11 @@ namespace StopScopeMapper
 AWS_SES_API StopScope GetStopScopeForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForStopScope(StopScope value);
+
+/**
+ * Same as GetNameForStopScope(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForStopScopeCStr(StopScope value);
 } // namespace StopScopeMapper
 } // namespace Model
 } // namespace SES
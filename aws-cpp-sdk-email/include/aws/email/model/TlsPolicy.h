@@ -35,6 +35,11 @@ namespace TlsPolicyMapper
 AWS_SES_API TlsPolicy GetTlsPolicyForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForTlsPolicy(TlsPolicy value);
+
+/**
+ * Same as GetNameForTlsPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForTlsPolicyCStr(TlsPolicy value);
 } // namespace TlsPolicyMapper
 } // namespace Model
 } // namespace SES
@@ -38,6 +38,11 @@ namespace VerificationStatusMapper
 AWS_SES_API VerificationStatus GetVerificationStatusForName(const Aws::String& name);
 
 AWS_SES_API Aws::String GetNameForVerificationStatus(VerificationStatus value);
+
+/**
+ * Same as GetNameForVerificationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SES_API const char* GetNameForVerificationStatusCStr(VerificationStatus value);
 } // namespace VerificationStatusMapper
 } // namespace Model
 } // namespace SES
@@ -30,20 +30,37 @@ namespace Aws
       namespace BehaviorOnMXFailureMapper
       {
 
-        static const int UseDefaultValue_HASH = HashingUtils::HashString("UseDefaultValue");
-        static const int RejectMessage_HASH = HashingUtils::HashString("RejectMessage");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UseDefaultValue",
+          "RejectMessage",
+        };
 
         BehaviorOnMXFailure GetBehaviorOnMXFailureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UseDefaultValue_HASH)
-          {
-            return BehaviorOnMXFailure::UseDefaultValue;
-          }
-          else if (hashCode == RejectMessage_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BehaviorOnMXFailure::RejectMessage;
+          case 1219447479:
+            if (name == "UseDefaultValue")
+            {
+              return BehaviorOnMXFailure::UseDefaultValue;
+            }
+            break;
+          case 2069680968:
+            if (name == "RejectMessage")
+            {
+              return BehaviorOnMXFailure::RejectMessage;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BehaviorOnMXFailure::NOT_SET;
         }
 
-        Aws::String GetNameForBehaviorOnMXFailure(BehaviorOnMXFailure enumValue)
+        const char* GetNameForBehaviorOnMXFailureCStr(BehaviorOnMXFailure enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BehaviorOnMXFailure::UseDefaultValue:
-            return "UseDefaultValue";
-          case BehaviorOnMXFailure::RejectMessage:
-            return "RejectMessage";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBehaviorOnMXFailure(BehaviorOnMXFailure enumValue)
+        {
+          return GetNameForBehaviorOnMXFailureCStr(enumValue);
         }
 
       } // namespace BehaviorOnMXFailureMapper
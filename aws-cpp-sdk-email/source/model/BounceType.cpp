@@ -30,40 +30,65 @@ namespace Aws
       namespace BounceTypeMapper
       {
 
-        static const int DoesNotExist_HASH = HashingUtils::HashString("DoesNotExist");
-        static const int MessageTooLarge_HASH = HashingUtils::HashString("MessageTooLarge");
-        static const int ExceededQuota_HASH = HashingUtils::HashString("ExceededQuota");
-        static const int ContentRejected_HASH = HashingUtils::HashString("ContentRejected");
-        static const int Undefined_HASH = HashingUtils::HashString("Undefined");
-        static const int TemporaryFailure_HASH = HashingUtils::HashString("TemporaryFailure");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DoesNotExist",
+          "MessageTooLarge",
+          "ExceededQuota",
+          "ContentRejected",
+          "Undefined",
+          "TemporaryFailure",
+        };
 
         BounceType GetBounceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DoesNotExist_HASH)
-          {
-            return BounceType::DoesNotExist;
-          }
-          else if (hashCode == MessageTooLarge_HASH)
-          {
-            return BounceType::MessageTooLarge;
-          }
-          else if (hashCode == ExceededQuota_HASH)
-          {
-            return BounceType::ExceededQuota;
-          }
-          else if (hashCode == ContentRejected_HASH)
-          {
-            return BounceType::ContentRejected;
-          }
-          else if (hashCode == Undefined_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BounceType::Undefined;
-          }
-          else if (hashCode == TemporaryFailure_HASH)
-          {
-            return BounceType::TemporaryFailure;
+          case -159978083:
+            if (name == "DoesNotExist")
+            {
+              return BounceType::DoesNotExist;
+            }
+            break;
+          case -1210457266:
+            if (name == "MessageTooLarge")
+            {
+              return BounceType::MessageTooLarge;
+            }
+            break;
+          case 2065475269:
+            if (name == "ExceededQuota")
+            {
+              return BounceType::ExceededQuota;
+            }
+            break;
+          case 818142199:
+            if (name == "ContentRejected")
+            {
+              return BounceType::ContentRejected;
+            }
+            break;
+          case 965837104:
+            if (name == "Undefined")
+            {
+              return BounceType::Undefined;
+            }
+            break;
+          case 1916666393:
+            if (name == "TemporaryFailure")
+            {
+              return BounceType::TemporaryFailure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return BounceType::NOT_SET;
         }
 
-        Aws::String GetNameForBounceType(BounceType enumValue)
+        const char* GetNameForBounceTypeCStr(BounceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BounceType::DoesNotExist:
-            return "DoesNotExist";
-          case BounceType::MessageTooLarge:
-            return "MessageTooLarge";
-          case BounceType::ExceededQuota:
-            return "ExceededQuota";
-          case BounceType::ContentRejected:
-            return "ContentRejected";
-          case BounceType::Undefined:
-            return "Undefined";
-          case BounceType::TemporaryFailure:
-            return "TemporaryFailure";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBounceType(BounceType enumValue)
+        {
+          return GetNameForBounceTypeCStr(enumValue);
         }
 
       } // namespace BounceTypeMapper
@@ -30,80 +30,121 @@ namespace Aws
       namespace BulkEmailStatusMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int MessageRejected_HASH = HashingUtils::HashString("MessageRejected");
-        static const int MailFromDomainNotVerified_HASH = HashingUtils::HashString("MailFromDomainNotVerified");
-        static const int ConfigurationSetDoesNotExist_HASH = HashingUtils::HashString("ConfigurationSetDoesNotExist");
-        static const int TemplateDoesNotExist_HASH = HashingUtils::HashString("TemplateDoesNotExist");
-        static const int AccountSuspended_HASH = HashingUtils::HashString("AccountSuspended");
-        static const int AccountThrottled_HASH = HashingUtils::HashString("AccountThrottled");
-        static const int AccountDailyQuotaExceeded_HASH = HashingUtils::HashString("AccountDailyQuotaExceeded");
-        static const int InvalidSendingPoolName_HASH = HashingUtils::HashString("InvalidSendingPoolName");
-        static const int AccountSendingPaused_HASH = HashingUtils::HashString("AccountSendingPaused");
-        static const int ConfigurationSetSendingPaused_HASH = HashingUtils::HashString("ConfigurationSetSendingPaused");
-        static const int InvalidParameterValue_HASH = HashingUtils::HashString("InvalidParameterValue");
-        static const int TransientFailure_HASH = HashingUtils::HashString("TransientFailure");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Success",
+          "MessageRejected",
+          "MailFromDomainNotVerified",
+          "ConfigurationSetDoesNotExist",
+          "TemplateDoesNotExist",
+          "AccountSuspended",
+          "AccountThrottled",
+          "AccountDailyQuotaExceeded",
+          "InvalidSendingPoolName",
+          "AccountSendingPaused",
+          "ConfigurationSetSendingPaused",
+          "InvalidParameterValue",
+          "TransientFailure",
+          "Failed",
+        };
 
         BulkEmailStatus GetBulkEmailStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
-          {
-            return BulkEmailStatus::Success;
-          }
-          else if (hashCode == MessageRejected_HASH)
-          {
-            return BulkEmailStatus::MessageRejected;
-          }
-          else if (hashCode == MailFromDomainNotVerified_HASH)
-          {
-            return BulkEmailStatus::MailFromDomainNotVerified;
-          }
-          else if (hashCode == ConfigurationSetDoesNotExist_HASH)
-          {
-            return BulkEmailStatus::ConfigurationSetDoesNotExist;
-          }
-          else if (hashCode == TemplateDoesNotExist_HASH)
-          {
-            return BulkEmailStatus::TemplateDoesNotExist;
-          }
-          else if (hashCode == AccountSuspended_HASH)
-          {
-            return BulkEmailStatus::AccountSuspended;
-          }
-          else if (hashCode == AccountThrottled_HASH)
-          {
-            return BulkEmailStatus::AccountThrottled;
-          }
-          else if (hashCode == AccountDailyQuotaExceeded_HASH)
-          {
-            return BulkEmailStatus::AccountDailyQuotaExceeded;
-          }
-          else if (hashCode == InvalidSendingPoolName_HASH)
-          {
-            return BulkEmailStatus::InvalidSendingPoolName;
-          }
-          else if (hashCode == AccountSendingPaused_HASH)
-          {
-            return BulkEmailStatus::AccountSendingPaused;
-          }
-          else if (hashCode == ConfigurationSetSendingPaused_HASH)
-          {
-            return BulkEmailStatus::ConfigurationSetSendingPaused;
-          }
-          else if (hashCode == InvalidParameterValue_HASH)
-          {
-            return BulkEmailStatus::InvalidParameterValue;
-          }
-          else if (hashCode == TransientFailure_HASH)
-          {
-            return BulkEmailStatus::TransientFailure;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return BulkEmailStatus::Failed;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -202516509:
+            if (name == "Success")
+            {
+              return BulkEmailStatus::Success;
+            }
+            break;
+          case -806209147:
+            if (name == "MessageRejected")
+            {
+              return BulkEmailStatus::MessageRejected;
+            }
+            break;
+          case 523042614:
+            if (name == "MailFromDomainNotVerified")
+            {
+              return BulkEmailStatus::MailFromDomainNotVerified;
+            }
+            break;
+          case 1769616201:
+            if (name == "ConfigurationSetDoesNotExist")
+            {
+              return BulkEmailStatus::ConfigurationSetDoesNotExist;
+            }
+            break;
+          case -1072298185:
+            if (name == "TemplateDoesNotExist")
+            {
+              return BulkEmailStatus::TemplateDoesNotExist;
+            }
+            break;
+          case 228362830:
+            if (name == "AccountSuspended")
+            {
+              return BulkEmailStatus::AccountSuspended;
+            }
+            break;
+          case 632084205:
+            if (name == "AccountThrottled")
+            {
+              return BulkEmailStatus::AccountThrottled;
+            }
+            break;
+          case 1599386943:
+            if (name == "AccountDailyQuotaExceeded")
+            {
+              return BulkEmailStatus::AccountDailyQuotaExceeded;
+            }
+            break;
+          case 790766442:
+            if (name == "InvalidSendingPoolName")
+            {
+              return BulkEmailStatus::InvalidSendingPoolName;
+            }
+            break;
+          case 1904926747:
+            if (name == "AccountSendingPaused")
+            {
+              return BulkEmailStatus::AccountSendingPaused;
+            }
+            break;
+          case -76417828:
+            if (name == "ConfigurationSetSendingPaused")
+            {
+              return BulkEmailStatus::ConfigurationSetSendingPaused;
+            }
+            break;
+          case 343384319:
+            if (name == "InvalidParameterValue")
+            {
+              return BulkEmailStatus::InvalidParameterValue;
+            }
+            break;
+          case -362718272:
+            if (name == "TransientFailure")
+            {
+              return BulkEmailStatus::TransientFailure;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return BulkEmailStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -115,47 +156,26 @@ namespace Aws
           return BulkEmailStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBulkEmailStatus(BulkEmailStatus enumValue)
+        const char* GetNameForBulkEmailStatusCStr(BulkEmailStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BulkEmailStatus::Success:
-            return "Success";
-          case BulkEmailStatus::MessageRejected:
-            return "MessageRejected";
-          case BulkEmailStatus::MailFromDomainNotVerified:
-            return "MailFromDomainNotVerified";
-          case BulkEmailStatus::ConfigurationSetDoesNotExist:
-            return "ConfigurationSetDoesNotExist";
-          case BulkEmailStatus::TemplateDoesNotExist:
-            return "TemplateDoesNotExist";
-          case BulkEmailStatus::AccountSuspended:
-            return "AccountSuspended";
-          case BulkEmailStatus::AccountThrottled:
-            return "AccountThrottled";
-          case BulkEmailStatus::AccountDailyQuotaExceeded:
-            return "AccountDailyQuotaExceeded";
-          case BulkEmailStatus::InvalidSendingPoolName:
-            return "InvalidSendingPoolName";
-          case BulkEmailStatus::AccountSendingPaused:
-            return "AccountSendingPaused";
-          case BulkEmailStatus::ConfigurationSetSendingPaused:
-            return "ConfigurationSetSendingPaused";
-          case BulkEmailStatus::InvalidParameterValue:
-            return "InvalidParameterValue";
-          case BulkEmailStatus::TransientFailure:
-            return "TransientFailure";
-          case BulkEmailStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBulkEmailStatus(BulkEmailStatus enumValue)
+        {
+          return GetNameForBulkEmailStatusCStr(enumValue);
         }
 
       } // namespace BulkEmailStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ConfigurationSetAttributeMapper
       {
 
-        static const int eventDestinations_HASH = HashingUtils::HashString("eventDestinations");
-        static const int trackingOptions_HASH = HashingUtils::HashString("trackingOptions");
-        static const int reputationOptions_HASH = HashingUtils::HashString("reputationOptions");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "eventDestinations",
+          "trackingOptions",
+          "reputationOptions",
+        };
 
         ConfigurationSetAttribute GetConfigurationSetAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == eventDestinations_HASH)
-          {
-            return ConfigurationSetAttribute::eventDestinations;
-          }
-          else if (hashCode == trackingOptions_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConfigurationSetAttribute::trackingOptions;
-          }
-          else if (hashCode == reputationOptions_HASH)
-          {
-            return ConfigurationSetAttribute::reputationOptions;
+          case 407563743:
+            if (name == "eventDestinations")
+            {
+              return ConfigurationSetAttribute::eventDestinations;
+            }
+            break;
+          case -1392618521:
+            if (name == "trackingOptions")
+            {
+              return ConfigurationSetAttribute::trackingOptions;
+            }
+            break;
+          case 556306405:
+            if (name == "reputationOptions")
+            {
+              return ConfigurationSetAttribute::reputationOptions;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ConfigurationSetAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForConfigurationSetAttribute(ConfigurationSetAttribute enumValue)
+        const char* GetNameForConfigurationSetAttributeCStr(ConfigurationSetAttribute enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConfigurationSetAttribute::eventDestinations:
-            return "eventDestinations";
-          case ConfigurationSetAttribute::trackingOptions:
-            return "trackingOptions";
-          case ConfigurationSetAttribute::reputationOptions:
-            return "reputationOptions";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConfigurationSetAttribute(ConfigurationSetAttribute enumValue)
+        {
+          return GetNameForConfigurationSetAttributeCStr(enumValue);
         }
 
       } // namespace ConfigurationSetAttributeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace CustomMailFromStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int TemporaryFailure_HASH = HashingUtils::HashString("TemporaryFailure");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "Success",
+          "Failed",
+          "TemporaryFailure",
+        };
 
         CustomMailFromStatus GetCustomMailFromStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return CustomMailFromStatus::Pending;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return CustomMailFromStatus::Success;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return CustomMailFromStatus::Failed;
-          }
-          else if (hashCode == TemporaryFailure_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CustomMailFromStatus::TemporaryFailure;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return CustomMailFromStatus::Pending;
+            }
+            break;
+          case -202516509:
+            if (name == "Success")
+            {
+              return CustomMailFromStatus::Success;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return CustomMailFromStatus::Failed;
+            }
+            break;
+          case 1916666393:
+            if (name == "TemporaryFailure")
+            {
+              return CustomMailFromStatus::TemporaryFailure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return CustomMailFromStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCustomMailFromStatus(CustomMailFromStatus enumValue)
+        const char* GetNameForCustomMailFromStatusCStr(CustomMailFromStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CustomMailFromStatus::Pending:
-            return "Pending";
-          case CustomMailFromStatus::Success:
-            return "Success";
-          case CustomMailFromStatus::Failed:
-            return "Failed";
-          case CustomMailFromStatus::TemporaryFailure:
-            return "TemporaryFailure";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCustomMailFromStatus(CustomMailFromStatus enumValue)
+        {
+          return GetNameForCustomMailFromStatusCStr(enumValue);
         }
 
       } // namespace CustomMailFromStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DimensionValueSourceMapper
       {
 
-        static const int messageTag_HASH = HashingUtils::HashString("messageTag");
-        static const int emailHeader_HASH = HashingUtils::HashString("emailHeader");
-        static const int linkTag_HASH = HashingUtils::HashString("linkTag");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "messageTag",
+          "emailHeader",
+          "linkTag",
+        };
 
         DimensionValueSource GetDimensionValueSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == messageTag_HASH)
-          {
-            return DimensionValueSource::messageTag;
-          }
-          else if (hashCode == emailHeader_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DimensionValueSource::emailHeader;
-          }
-          else if (hashCode == linkTag_HASH)
-          {
-            return DimensionValueSource::linkTag;
+          case -1690733037:
+            if (name == "messageTag")
+            {
+              return DimensionValueSource::messageTag;
+            }
+            break;
+          case 1552151881:
+            if (name == "emailHeader")
+            {
+              return DimensionValueSource::emailHeader;
+            }
+            break;
+          case 177069376:
+            if (name == "linkTag")
+            {
+              return DimensionValueSource::linkTag;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DimensionValueSource::NOT_SET;
         }
 
-        Aws::String GetNameForDimensionValueSource(DimensionValueSource enumValue)
+        const char* GetNameForDimensionValueSourceCStr(DimensionValueSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DimensionValueSource::messageTag:
-            return "messageTag";
-          case DimensionValueSource::emailHeader:
-            return "emailHeader";
-          case DimensionValueSource::linkTag:
-            return "linkTag";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDimensionValueSource(DimensionValueSource enumValue)
+        {
+          return GetNameForDimensionValueSourceCStr(enumValue);
         }
 
       } // namespace DimensionValueSourceMapper
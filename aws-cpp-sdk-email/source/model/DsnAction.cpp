@@ -30,35 +30,58 @@ namespace Aws
       namespace DsnActionMapper
       {
 
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int delayed_HASH = HashingUtils::HashString("delayed");
-        static const int delivered_HASH = HashingUtils::HashString("delivered");
-        static const int relayed_HASH = HashingUtils::HashString("relayed");
-        static const int expanded_HASH = HashingUtils::HashString("expanded");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "failed",
+          "delayed",
+          "delivered",
+          "relayed",
+          "expanded",
+        };
 
         DsnAction GetDsnActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DsnAction::failed;
-          }
-          else if (hashCode == delayed_HASH)
-          {
-            return DsnAction::delayed;
-          }
-          else if (hashCode == delivered_HASH)
-          {
-            return DsnAction::delivered;
-          }
-          else if (hashCode == relayed_HASH)
-          {
-            return DsnAction::relayed;
-          }
-          else if (hashCode == expanded_HASH)
-          {
-            return DsnAction::expanded;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return DsnAction::failed;
+            }
+            break;
+          case 1550348642:
+            if (name == "delayed")
+            {
+              return DsnAction::delayed;
+            }
+            break;
+          case -242327420:
+            if (name == "delivered")
+            {
+              return DsnAction::delivered;
+            }
+            break;
+          case 1090498288:
+            if (name == "relayed")
+            {
+              return DsnAction::relayed;
+            }
+            break;
+          case -1939100487:
+            if (name == "expanded")
+            {
+              return DsnAction::expanded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return DsnAction::NOT_SET;
         }
 
-        Aws::String GetNameForDsnAction(DsnAction enumValue)
+        const char* GetNameForDsnActionCStr(DsnAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DsnAction::failed:
-            return "failed";
-          case DsnAction::delayed:
-            return "delayed";
-          case DsnAction::delivered:
-            return "delivered";
-          case DsnAction::relayed:
-            return "relayed";
-          case DsnAction::expanded:
-            return "expanded";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDsnAction(DsnAction enumValue)
+        {
+          return GetNameForDsnActionCStr(enumValue);
         }
 
       } // namespace DsnActionMapper
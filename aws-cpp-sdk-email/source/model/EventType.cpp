@@ -30,50 +30,79 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int send_HASH = HashingUtils::HashString("send");
-        static const int reject_HASH = HashingUtils::HashString("reject");
-        static const int bounce_HASH = HashingUtils::HashString("bounce");
-        static const int complaint_HASH = HashingUtils::HashString("complaint");
-        static const int delivery_HASH = HashingUtils::HashString("delivery");
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int click_HASH = HashingUtils::HashString("click");
-        static const int renderingFailure_HASH = HashingUtils::HashString("renderingFailure");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "send",
+          "reject",
+          "bounce",
+          "complaint",
+          "delivery",
+          "open",
+          "click",
+          "renderingFailure",
+        };
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == send_HASH)
-          {
-            return EventType::send;
-          }
-          else if (hashCode == reject_HASH)
-          {
-            return EventType::reject;
-          }
-          else if (hashCode == bounce_HASH)
-          {
-            return EventType::bounce;
-          }
-          else if (hashCode == complaint_HASH)
-          {
-            return EventType::complaint;
-          }
-          else if (hashCode == delivery_HASH)
-          {
-            return EventType::delivery;
-          }
-          else if (hashCode == open_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventType::open;
-          }
-          else if (hashCode == click_HASH)
-          {
-            return EventType::click;
-          }
-          else if (hashCode == renderingFailure_HASH)
-          {
-            return EventType::renderingFailure;
+          case 3526536:
+            if (name == "send")
+            {
+              return EventType::send;
+            }
+            break;
+          case -934710369:
+            if (name == "reject")
+            {
+              return EventType::reject;
+            }
+            break;
+          case -1383205240:
+            if (name == "bounce")
+            {
+              return EventType::bounce;
+            }
+            break;
+          case -1403061077:
+            if (name == "complaint")
+            {
+              return EventType::complaint;
+            }
+            break;
+          case 823466996:
+            if (name == "delivery")
+            {
+              return EventType::delivery;
+            }
+            break;
+          case 3417674:
+            if (name == "open")
+            {
+              return EventType::open;
+            }
+            break;
+          case 94750088:
+            if (name == "click")
+            {
+              return EventType::click;
+            }
+            break;
+          case 1266920798:
+            if (name == "renderingFailure")
+            {
+              return EventType::renderingFailure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventTypeCStr(EventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventType::send:
-            return "send";
-          case EventType::reject:
-            return "reject";
-          case EventType::bounce:
-            return "bounce";
-          case EventType::complaint:
-            return "complaint";
-          case EventType::delivery:
-            return "delivery";
-          case EventType::open:
-            return "open";
-          case EventType::click:
-            return "click";
-          case EventType::renderingFailure:
-            return "renderingFailure";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventType(EventType enumValue)
+        {
+          return GetNameForEventTypeCStr(enumValue);
         }
 
       } // namespace EventTypeMapper
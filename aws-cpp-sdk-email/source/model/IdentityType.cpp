@@ -30,20 +30,37 @@ namespace Aws
       namespace IdentityTypeMapper
       {
 
-        static const int EmailAddress_HASH = HashingUtils::HashString("EmailAddress");
-        static const int Domain_HASH = HashingUtils::HashString("Domain");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EmailAddress",
+          "Domain",
+        };
 
         IdentityType GetIdentityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EmailAddress_HASH)
-          {
-            return IdentityType::EmailAddress;
-          }
-          else if (hashCode == Domain_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IdentityType::Domain;
+          case -906611496:
+            if (name == "EmailAddress")
+            {
+              return IdentityType::EmailAddress;
+            }
+            break;
+          case 2052636900:
+            if (name == "Domain")
+            {
+              return IdentityType::Domain;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return IdentityType::NOT_SET;
         }
 
-        Aws::String GetNameForIdentityType(IdentityType enumValue)
+        const char* GetNameForIdentityTypeCStr(IdentityType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IdentityType::EmailAddress:
-            return "EmailAddress";
-          case IdentityType::Domain:
-            return "Domain";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIdentityType(IdentityType enumValue)
+        {
+          return GetNameForIdentityTypeCStr(enumValue);
         }
 
       } // namespace IdentityTypeMapper
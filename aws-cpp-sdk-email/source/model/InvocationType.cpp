@@ -30,20 +30,37 @@ namespace Aws
       namespace InvocationTypeMapper
       {
 
-        static const int Event_HASH = HashingUtils::HashString("Event");
-        static const int RequestResponse_HASH = HashingUtils::HashString("RequestResponse");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Event",
+          "RequestResponse",
+        };
 
         InvocationType GetInvocationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Event_HASH)
-          {
-            return InvocationType::Event;
-          }
-          else if (hashCode == RequestResponse_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InvocationType::RequestResponse;
+          case 67338874:
+            if (name == "Event")
+            {
+              return InvocationType::Event;
+            }
+            break;
+          case 1251681232:
+            if (name == "RequestResponse")
+            {
+              return InvocationType::RequestResponse;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InvocationType::NOT_SET;
         }
 
-        Aws::String GetNameForInvocationType(InvocationType enumValue)
+        const char* GetNameForInvocationTypeCStr(InvocationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InvocationType::Event:
-            return "Event";
-          case InvocationType::RequestResponse:
-            return "RequestResponse";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInvocationType(InvocationType enumValue)
+        {
+          return GetNameForInvocationTypeCStr(enumValue);
         }
 
       } // namespace InvocationTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace NotificationTypeMapper
       {
 
-        static const int Bounce_HASH = HashingUtils::HashString("Bounce");
-        static const int Complaint_HASH = HashingUtils::HashString("Complaint");
-        static const int Delivery_HASH = HashingUtils::HashString("Delivery");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Bounce",
+          "Complaint",
+          "Delivery",
+        };
 
         NotificationType GetNotificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Bounce_HASH)
-          {
-            return NotificationType::Bounce;
-          }
-          else if (hashCode == Complaint_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NotificationType::Complaint;
-          }
-          else if (hashCode == Delivery_HASH)
-          {
-            return NotificationType::Delivery;
+          case 1995629224:
+            if (name == "Bounce")
+            {
+              return NotificationType::Bounce;
+            }
+            break;
+          case 600906891:
+            if (name == "Complaint")
+            {
+              return NotificationType::Complaint;
+            }
+            break;
+          case 888111124:
+            if (name == "Delivery")
+            {
+              return NotificationType::Delivery;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return NotificationType::NOT_SET;
         }
 
-        Aws::String GetNameForNotificationType(NotificationType enumValue)
+        const char* GetNameForNotificationTypeCStr(NotificationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NotificationType::Bounce:
-            return "Bounce";
-          case NotificationType::Complaint:
-            return "Complaint";
-          case NotificationType::Delivery:
-            return "Delivery";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNotificationType(NotificationType enumValue)
+        {
+          return GetNameForNotificationTypeCStr(enumValue);
         }
 
       } // namespace NotificationTypeMapper
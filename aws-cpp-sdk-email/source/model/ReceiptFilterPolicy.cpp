@@ -30,20 +30,37 @@ namespace Aws
       namespace ReceiptFilterPolicyMapper
       {
 
-        static const int Block_HASH = HashingUtils::HashString("Block");
-        static const int Allow_HASH = HashingUtils::HashString("Allow");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Block",
+          "Allow",
+        };
 
         ReceiptFilterPolicy GetReceiptFilterPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Block_HASH)
-          {
-            return ReceiptFilterPolicy::Block;
-          }
-          else if (hashCode == Allow_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReceiptFilterPolicy::Allow;
+          case 64279661:
+            if (name == "Block")
+            {
+              return ReceiptFilterPolicy::Block;
+            }
+            break;
+          case 63353641:
+            if (name == "Allow")
+            {
+              return ReceiptFilterPolicy::Allow;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReceiptFilterPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForReceiptFilterPolicy(ReceiptFilterPolicy enumValue)
+        const char* GetNameForReceiptFilterPolicyCStr(ReceiptFilterPolicy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReceiptFilterPolicy::Block:
-            return "Block";
-          case ReceiptFilterPolicy::Allow:
-            return "Allow";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReceiptFilterPolicy(ReceiptFilterPolicy enumValue)
+        {
+          return GetNameForReceiptFilterPolicyCStr(enumValue);
         }
 
       } // namespace ReceiptFilterPolicyMapper
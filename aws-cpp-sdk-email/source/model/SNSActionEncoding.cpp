@@ -30,20 +30,37 @@ namespace Aws
       namespace SNSActionEncodingMapper
       {
 
-        static const int UTF_8_HASH = HashingUtils::HashString("UTF-8");
-        static const int Base64_HASH = HashingUtils::HashString("Base64");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UTF-8",
+          "Base64",
+        };
 
         SNSActionEncoding GetSNSActionEncodingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UTF_8_HASH)
-          {
-            return SNSActionEncoding::UTF_8;
-          }
-          else if (hashCode == Base64_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SNSActionEncoding::Base64;
+          case 81070450:
+            if (name == "UTF-8")
+            {
+              return SNSActionEncoding::UTF_8;
+            }
+            break;
+          case 1982630255:
+            if (name == "Base64")
+            {
+              return SNSActionEncoding::Base64;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SNSActionEncoding::NOT_SET;
         }
 
-        Aws::String GetNameForSNSActionEncoding(SNSActionEncoding enumValue)
+        const char* GetNameForSNSActionEncodingCStr(SNSActionEncoding enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SNSActionEncoding::UTF_8:
-            return "UTF-8";
-          case SNSActionEncoding::Base64:
-            return "Base64";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSNSActionEncoding(SNSActionEncoding enumValue)
+        {
+          return GetNameForSNSActionEncodingCStr(enumValue);
         }
 
       } // namespace SNSActionEncodingMapper
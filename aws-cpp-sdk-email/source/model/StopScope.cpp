@@ -30,15 +30,30 @@ namespace Aws
       namespace StopScopeMapper
       {
 
-        static const int RuleSet_HASH = HashingUtils::HashString("RuleSet");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RuleSet",
+        };
 
         StopScope GetStopScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RuleSet_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StopScope::RuleSet;
+          case -1081666650:
+            if (name == "RuleSet")
+            {
+              return StopScope::RuleSet;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return StopScope::NOT_SET;
         }
 
-        Aws::String GetNameForStopScope(StopScope enumValue)
+        const char* GetNameForStopScopeCStr(StopScope enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StopScope::RuleSet:
-            return "RuleSet";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStopScope(StopScope enumValue)
+        {
+          return GetNameForStopScopeCStr(enumValue);
         }
 
       } // namespace StopScopeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TlsPolicyMapper
       {
 
-        static const int Require_HASH = HashingUtils::HashString("Require");
-        static const int Optional_HASH = HashingUtils::HashString("Optional");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Require",
+          "Optional",
+        };
 
         TlsPolicy GetTlsPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Require_HASH)
-          {
-            return TlsPolicy::Require;
-          }
-          else if (hashCode == Optional_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TlsPolicy::Optional;
+          case -1534617275:
+            if (name == "Require")
+            {
+              return TlsPolicy::Require;
+            }
+            break;
+          case -14372992:
+            if (name == "Optional")
+            {
+              return TlsPolicy::Optional;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TlsPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForTlsPolicy(TlsPolicy enumValue)
+        const char* GetNameForTlsPolicyCStr(TlsPolicy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TlsPolicy::Require:
-            return "Require";
-          case TlsPolicy::Optional:
-            return "Optional";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTlsPolicy(TlsPolicy enumValue)
+        {
+          return GetNameForTlsPolicyCStr(enumValue);
         }
 
       } // namespace TlsPolicyMapper
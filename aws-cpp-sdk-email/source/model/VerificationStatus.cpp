@@ -30,35 +30,58 @@ namespace Aws
       namespace VerificationStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int TemporaryFailure_HASH = HashingUtils::HashString("TemporaryFailure");
-        static const int NotStarted_HASH = HashingUtils::HashString("NotStarted");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "Success",
+          "Failed",
+          "TemporaryFailure",
+          "NotStarted",
+        };
 
         VerificationStatus GetVerificationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VerificationStatus::Pending;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return VerificationStatus::Success;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return VerificationStatus::Failed;
-          }
-          else if (hashCode == TemporaryFailure_HASH)
-          {
-            return VerificationStatus::TemporaryFailure;
-          }
-          else if (hashCode == NotStarted_HASH)
-          {
-            return VerificationStatus::NotStarted;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return VerificationStatus::Pending;
+            }
+            break;
+          case -202516509:
+            if (name == "Success")
+            {
+              return VerificationStatus::Success;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return VerificationStatus::Failed;
+            }
+            break;
+          case 1916666393:
+            if (name == "TemporaryFailure")
+            {
+              return VerificationStatus::TemporaryFailure;
+            }
+            break;
+          case -1137129906:
+            if (name == "NotStarted")
+            {
+              return VerificationStatus::NotStarted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return VerificationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForVerificationStatus(VerificationStatus enumValue)
+        const char* GetNameForVerificationStatusCStr(VerificationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VerificationStatus::Pending:
-            return "Pending";
-          case VerificationStatus::Success:
-            return "Success";
-          case VerificationStatus::Failed:
-            return "Failed";
-          case VerificationStatus::TemporaryFailure:
-            return "TemporaryFailure";
-          case VerificationStatus::NotStarted:
-            return "NotStarted";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVerificationStatus(VerificationStatus enumValue)
+        {
+          return GetNameForVerificationStatusCStr(enumValue);
         }
 
       } // namespace VerificationStatusMapper
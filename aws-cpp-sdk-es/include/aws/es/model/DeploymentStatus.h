@@ -38,6 +38,11 @@ namespace DeploymentStatusMapper
 AWS_ELASTICSEARCHSERVICE_API DeploymentStatus GetDeploymentStatusForName(const Aws::String& name);
 
 AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForDeploymentStatus(DeploymentStatus value);
+
+/**
+ * Same as GetNameForDeploymentStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForDeploymentStatusCStr(DeploymentStatus value);
 } // namespace DeploymentStatusMapper
 } // namespace Model
 } // namespace ElasticsearchService
@@ -73,6 +73,11 @@ namespace ESPartitionInstanceTypeMapper
 AWS_ELASTICSEARCHSERVICE_API ESPartitionInstanceType GetESPartitionInstanceTypeForName(const Aws::String& name);
 
 AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForESPartitionInstanceType(ESPartitionInstanceType value);
+
+/**
+ * Same as GetNameForESPartitionInstanceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForESPartitionInstanceTypeCStr(ESPartitionInstanceType value);
 } // namespace ESPartitionInstanceTypeMapper
 } // namespace Model
 } // namespace ElasticsearchService
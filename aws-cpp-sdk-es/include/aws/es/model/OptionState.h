@@ -36,6 +36,11 @@ namespace OptionStateMapper
 AWS_ELASTICSEARCHSERVICE_API OptionState GetOptionStateForName(const Aws::String& name);
 
 AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForOptionState(OptionState value);
+
+/**
+ * Same as GetNameForOptionState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForOptionStateCStr(OptionState value);
 } // namespace OptionStateMapper
 } // namespace Model
 } // namespace ElasticsearchService
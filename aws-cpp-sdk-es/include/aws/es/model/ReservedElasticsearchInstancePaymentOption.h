@@ -36,6 +36,11 @@ namespace ReservedElasticsearchInstancePaymentOptionMapper
 AWS_ELASTICSEARCHSERVICE_API ReservedElasticsearchInstancePaymentOption GetReservedElasticsearchInstancePaymentOptionForName(const Aws::String& name);
 
 AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForReservedElasticsearchInstancePaymentOption(ReservedElasticsearchInstancePaymentOption value);
+
+/**
+ * Same as GetNameForReservedElasticsearchInstancePaymentOption(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForReservedElasticsearchInstancePaymentOptionCStr(ReservedElasticsearchInstancePaymentOption value);
 } // namespace ReservedElasticsearchInstancePaymentOptionMapper
 } // namespace Model
 } // namespace ElasticsearchService
@@ -37,6 +37,11 @@ namespace UpgradeStatusMapper
 AWS_ELASTICSEARCHSERVICE_API UpgradeStatus GetUpgradeStatusForName(const Aws::String& name);
 
 AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForUpgradeStatus(UpgradeStatus value);
+
+/**
+ * Same as GetNameForUpgradeStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForUpgradeStatusCStr(UpgradeStatus value);
 } // namespace UpgradeStatusMapper
 } // namespace Model
 } // namespace ElasticsearchService
@@ -36,6 +36,11 @@ namespace UpgradeStepMapper
 AWS_ELASTICSEARCHSERVICE_API UpgradeStep GetUpgradeStepForName(const Aws::String& name);
 
 AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForUpgradeStep(UpgradeStep value);
+
+/**
+ * Same as GetNameForUpgradeStep(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForUpgradeStepCStr(UpgradeStep value);
 } // namespace UpgradeStepMapper
 } // namespace Model
 } // namespace ElasticsearchService
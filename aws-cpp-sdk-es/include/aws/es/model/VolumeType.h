@@ -36,6 +36,11 @@ namespace VolumeTypeMapper
 AWS_ELASTICSEARCHSERVICE_API VolumeType GetVolumeTypeForName(const Aws::String& name);
 
 AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForVolumeType(VolumeType value);
+
+/**
+ * Same as GetNameForVolumeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForVolumeTypeCStr(VolumeType value);
 } // namespace VolumeTypeMapper
 } // namespace Model
 } // namespace ElasticsearchService
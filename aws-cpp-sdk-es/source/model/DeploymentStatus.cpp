@@ -30,35 +30,58 @@ namespace Aws
       namespace DeploymentStatusMapper
       {
 
-        static const int PENDING_UPDATE_HASH = HashingUtils::HashString("PENDING_UPDATE");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int NOT_ELIGIBLE_HASH = HashingUtils::HashString("NOT_ELIGIBLE");
-        static const int ELIGIBLE_HASH = HashingUtils::HashString("ELIGIBLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING_UPDATE",
+          "IN_PROGRESS",
+          "COMPLETED",
+          "NOT_ELIGIBLE",
+          "ELIGIBLE",
+        };
 
         DeploymentStatus GetDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_UPDATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentStatus::PENDING_UPDATE;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return DeploymentStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return DeploymentStatus::COMPLETED;
-          }
-          else if (hashCode == NOT_ELIGIBLE_HASH)
-          {
-            return DeploymentStatus::NOT_ELIGIBLE;
-          }
-          else if (hashCode == ELIGIBLE_HASH)
-          {
-            return DeploymentStatus::ELIGIBLE;
+          case -1614720879:
+            if (name == "PENDING_UPDATE")
+            {
+              return DeploymentStatus::PENDING_UPDATE;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return DeploymentStatus::IN_PROGRESS;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return DeploymentStatus::COMPLETED;
+            }
+            break;
+          case -1395063325:
+            if (name == "NOT_ELIGIBLE")
+            {
+              return DeploymentStatus::NOT_ELIGIBLE;
+            }
+            break;
+          case 883370455:
+            if (name == "ELIGIBLE")
+            {
+              return DeploymentStatus::ELIGIBLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return DeploymentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentStatus(DeploymentStatus enumValue)
+        const char* GetNameForDeploymentStatusCStr(DeploymentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentStatus::PENDING_UPDATE:
-            return "PENDING_UPDATE";
-          case DeploymentStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case DeploymentStatus::COMPLETED:
-            return "COMPLETED";
-          case DeploymentStatus::NOT_ELIGIBLE:
-            return "NOT_ELIGIBLE";
-          case DeploymentStatus::ELIGIBLE:
-            return "ELIGIBLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentStatus(DeploymentStatus enumValue)
+        {
+          return GetNameForDeploymentStatusCStr(enumValue);
         }
 
       } // namespace DeploymentStatusMapper
@@ -30,210 +30,303 @@ namespace Aws
       namespace ESPartitionInstanceTypeMapper
       {
 
-        static const int m3_medium_elasticsearch_HASH = HashingUtils::HashString("m3.medium.elasticsearch");
-        static const int m3_large_elasticsearch_HASH = HashingUtils::HashString("m3.large.elasticsearch");
-        static const int m3_xlarge_elasticsearch_HASH = HashingUtils::HashString("m3.xlarge.elasticsearch");
-        static const int m3_2xlarge_elasticsearch_HASH = HashingUtils::HashString("m3.2xlarge.elasticsearch");
-        static const int m4_large_elasticsearch_HASH = HashingUtils::HashString("m4.large.elasticsearch");
-        static const int m4_xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.xlarge.elasticsearch");
-        static const int m4_2xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.2xlarge.elasticsearch");
-        static const int m4_4xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.4xlarge.elasticsearch");
-        static const int m4_10xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.10xlarge.elasticsearch");
-        static const int t2_micro_elasticsearch_HASH = HashingUtils::HashString("t2.micro.elasticsearch");
-        static const int t2_small_elasticsearch_HASH = HashingUtils::HashString("t2.small.elasticsearch");
-        static const int t2_medium_elasticsearch_HASH = HashingUtils::HashString("t2.medium.elasticsearch");
-        static const int r3_large_elasticsearch_HASH = HashingUtils::HashString("r3.large.elasticsearch");
-        static const int r3_xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.xlarge.elasticsearch");
-        static const int r3_2xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.2xlarge.elasticsearch");
-        static const int r3_4xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.4xlarge.elasticsearch");
-        static const int r3_8xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.8xlarge.elasticsearch");
-        static const int i2_xlarge_elasticsearch_HASH = HashingUtils::HashString("i2.xlarge.elasticsearch");
-        static const int i2_2xlarge_elasticsearch_HASH = HashingUtils::HashString("i2.2xlarge.elasticsearch");
-        static const int d2_xlarge_elasticsearch_HASH = HashingUtils::HashString("d2.xlarge.elasticsearch");
-        static const int d2_2xlarge_elasticsearch_HASH = HashingUtils::HashString("d2.2xlarge.elasticsearch");
-        static const int d2_4xlarge_elasticsearch_HASH = HashingUtils::HashString("d2.4xlarge.elasticsearch");
-        static const int d2_8xlarge_elasticsearch_HASH = HashingUtils::HashString("d2.8xlarge.elasticsearch");
-        static const int c4_large_elasticsearch_HASH = HashingUtils::HashString("c4.large.elasticsearch");
-        static const int c4_xlarge_elasticsearch_HASH = HashingUtils::HashString("c4.xlarge.elasticsearch");
-        static const int c4_2xlarge_elasticsearch_HASH = HashingUtils::HashString("c4.2xlarge.elasticsearch");
-        static const int c4_4xlarge_elasticsearch_HASH = HashingUtils::HashString("c4.4xlarge.elasticsearch");
-        static const int c4_8xlarge_elasticsearch_HASH = HashingUtils::HashString("c4.8xlarge.elasticsearch");
-        static const int r4_large_elasticsearch_HASH = HashingUtils::HashString("r4.large.elasticsearch");
-        static const int r4_xlarge_elasticsearch_HASH = HashingUtils::HashString("r4.xlarge.elasticsearch");
-        static const int r4_2xlarge_elasticsearch_HASH = HashingUtils::HashString("r4.2xlarge.elasticsearch");
-        static const int r4_4xlarge_elasticsearch_HASH = HashingUtils::HashString("r4.4xlarge.elasticsearch");
-        static const int r4_8xlarge_elasticsearch_HASH = HashingUtils::HashString("r4.8xlarge.elasticsearch");
-        static const int r4_16xlarge_elasticsearch_HASH = HashingUtils::HashString("r4.16xlarge.elasticsearch");
-        static const int i3_large_elasticsearch_HASH = HashingUtils::HashString("i3.large.elasticsearch");
-        static const int i3_xlarge_elasticsearch_HASH = HashingUtils::HashString("i3.xlarge.elasticsearch");
-        static const int i3_2xlarge_elasticsearch_HASH = HashingUtils::HashString("i3.2xlarge.elasticsearch");
-        static const int i3_4xlarge_elasticsearch_HASH = HashingUtils::HashString("i3.4xlarge.elasticsearch");
-        static const int i3_8xlarge_elasticsearch_HASH = HashingUtils::HashString("i3.8xlarge.elasticsearch");
-        static const int i3_16xlarge_elasticsearch_HASH = HashingUtils::HashString("i3.16xlarge.elasticsearch");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "m3.medium.elasticsearch",
+          "m3.large.elasticsearch",
+          "m3.xlarge.elasticsearch",
+          "m3.2xlarge.elasticsearch",
+          "m4.large.elasticsearch",
+          "m4.xlarge.elasticsearch",
+          "m4.2xlarge.elasticsearch",
+          "m4.4xlarge.elasticsearch",
+          "m4.10xlarge.elasticsearch",
+          "t2.micro.elasticsearch",
+          "t2.small.elasticsearch",
+          "t2.medium.elasticsearch",
+          "r3.large.elasticsearch",
+          "r3.xlarge.elasticsearch",
+          "r3.2xlarge.elasticsearch",
+          "r3.4xlarge.elasticsearch",
+          "r3.8xlarge.elasticsearch",
+          "i2.xlarge.elasticsearch",
+          "i2.2xlarge.elasticsearch",
+          "d2.xlarge.elasticsearch",
+          "d2.2xlarge.elasticsearch",
+          "d2.4xlarge.elasticsearch",
+          "d2.8xlarge.elasticsearch",
+          "c4.large.elasticsearch",
+          "c4.xlarge.elasticsearch",
+          "c4.2xlarge.elasticsearch",
+          "c4.4xlarge.elasticsearch",
+          "c4.8xlarge.elasticsearch",
+          "r4.large.elasticsearch",
+          "r4.xlarge.elasticsearch",
+          "r4.2xlarge.elasticsearch",
+          "r4.4xlarge.elasticsearch",
+          "r4.8xlarge.elasticsearch",
+          "r4.16xlarge.elasticsearch",
+          "i3.large.elasticsearch",
+          "i3.xlarge.elasticsearch",
+          "i3.2xlarge.elasticsearch",
+          "i3.4xlarge.elasticsearch",
+          "i3.8xlarge.elasticsearch",
+          "i3.16xlarge.elasticsearch",
+        };
 
         ESPartitionInstanceType GetESPartitionInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == m3_medium_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m3_medium_elasticsearch;
-          }
-          else if (hashCode == m3_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m3_large_elasticsearch;
-          }
-          else if (hashCode == m3_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m3_xlarge_elasticsearch;
-          }
-          else if (hashCode == m3_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m3_2xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m4_large_elasticsearch;
-          }
-          else if (hashCode == m4_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m4_xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m4_2xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m4_4xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_10xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m4_10xlarge_elasticsearch;
-          }
-          else if (hashCode == t2_micro_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::t2_micro_elasticsearch;
-          }
-          else if (hashCode == t2_small_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::t2_small_elasticsearch;
-          }
-          else if (hashCode == t2_medium_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::t2_medium_elasticsearch;
-          }
-          else if (hashCode == r3_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r3_large_elasticsearch;
-          }
-          else if (hashCode == r3_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r3_xlarge_elasticsearch;
-          }
-          else if (hashCode == r3_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r3_2xlarge_elasticsearch;
-          }
-          else if (hashCode == r3_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r3_4xlarge_elasticsearch;
-          }
-          else if (hashCode == r3_8xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r3_8xlarge_elasticsearch;
-          }
-          else if (hashCode == i2_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i2_xlarge_elasticsearch;
-          }
-          else if (hashCode == i2_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i2_2xlarge_elasticsearch;
-          }
-          else if (hashCode == d2_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::d2_xlarge_elasticsearch;
-          }
-          else if (hashCode == d2_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::d2_2xlarge_elasticsearch;
-          }
-          else if (hashCode == d2_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::d2_4xlarge_elasticsearch;
-          }
-          else if (hashCode == d2_8xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::d2_8xlarge_elasticsearch;
-          }
-          else if (hashCode == c4_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::c4_large_elasticsearch;
-          }
-          else if (hashCode == c4_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::c4_xlarge_elasticsearch;
-          }
-          else if (hashCode == c4_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::c4_2xlarge_elasticsearch;
-          }
-          else if (hashCode == c4_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::c4_4xlarge_elasticsearch;
-          }
-          else if (hashCode == c4_8xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::c4_8xlarge_elasticsearch;
-          }
-          else if (hashCode == r4_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_large_elasticsearch;
-          }
-          else if (hashCode == r4_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_xlarge_elasticsearch;
-          }
-          else if (hashCode == r4_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_2xlarge_elasticsearch;
-          }
-          else if (hashCode == r4_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_4xlarge_elasticsearch;
-          }
-          else if (hashCode == r4_8xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_8xlarge_elasticsearch;
-          }
-          else if (hashCode == r4_16xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_16xlarge_elasticsearch;
-          }
-          else if (hashCode == i3_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_large_elasticsearch;
-          }
-          else if (hashCode == i3_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_xlarge_elasticsearch;
-          }
-          else if (hashCode == i3_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_2xlarge_elasticsearch;
-          }
-          else if (hashCode == i3_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_4xlarge_elasticsearch;
-          }
-          else if (hashCode == i3_8xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_8xlarge_elasticsearch;
-          }
-          else if (hashCode == i3_16xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_16xlarge_elasticsearch;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1012758132:
+            if (name == "m3.medium.elasticsearch")
+            {
+              return ESPartitionInstanceType::m3_medium_elasticsearch;
+            }
+            break;
+          case -401605950:
+            if (name == "m3.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::m3_large_elasticsearch;
+            }
+            break;
+          case -1163059366:
+            if (name == "m3.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m3_xlarge_elasticsearch;
+            }
+            break;
+          case -907973508:
+            if (name == "m3.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m3_2xlarge_elasticsearch;
+            }
+            break;
+          case -190255037:
+            if (name == "m4.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::m4_large_elasticsearch;
+            }
+            break;
+          case 1093851641:
+            if (name == "m4.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m4_xlarge_elasticsearch;
+            }
+            break;
+          case 336790973:
+            if (name == "m4.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m4_2xlarge_elasticsearch;
+            }
+            break;
+          case 759492799:
+            if (name == "m4.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m4_4xlarge_elasticsearch;
+            }
+            break;
+          case -41898792:
+            if (name == "m4.10xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m4_10xlarge_elasticsearch;
+            }
+            break;
+          case -180666525:
+            if (name == "t2.micro.elasticsearch")
+            {
+              return ESPartitionInstanceType::t2_micro_elasticsearch;
+            }
+            break;
+          case -516955034:
+            if (name == "t2.small.elasticsearch")
+            {
+              return ESPartitionInstanceType::t2_small_elasticsearch;
+            }
+            break;
+          case 1148714932:
+            if (name == "t2.medium.elasticsearch")
+            {
+              return ESPartitionInstanceType::t2_medium_elasticsearch;
+            }
+            break;
+          case -2001952803:
+            if (name == "r3.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::r3_large_elasticsearch;
+            }
+            break;
+          case 765795743:
+            if (name == "r3.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r3_xlarge_elasticsearch;
+            }
+            break;
+          case -1243007273:
+            if (name == "r3.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r3_2xlarge_elasticsearch;
+            }
+            break;
+          case -820305447:
+            if (name == "r3.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r3_4xlarge_elasticsearch;
+            }
+            break;
+          case 25098205:
+            if (name == "r3.8xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r3_8xlarge_elasticsearch;
+            }
+            break;
+          case 190906295:
+            if (name == "i2.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i2_xlarge_elasticsearch;
+            }
+            break;
+          case -1884710977:
+            if (name == "i2.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i2_2xlarge_elasticsearch;
+            }
+            break;
+          case -1737948814:
+            if (name == "d2.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::d2_xlarge_elasticsearch;
+            }
+            break;
+          case -1549677212:
+            if (name == "d2.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::d2_2xlarge_elasticsearch;
+            }
+            break;
+          case -1126975386:
+            if (name == "d2.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::d2_4xlarge_elasticsearch;
+            }
+            break;
+          case -281571734:
+            if (name == "d2.8xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::d2_8xlarge_elasticsearch;
+            }
+            break;
+          case -1284528627:
+            if (name == "c4.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::c4_large_elasticsearch;
+            }
+            break;
+          case 1531108719:
+            if (name == "c4.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::c4_xlarge_elasticsearch;
+            }
+            break;
+          case 1006858503:
+            if (name == "c4.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::c4_2xlarge_elasticsearch;
+            }
+            break;
+          case 1429560329:
+            if (name == "c4.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::c4_4xlarge_elasticsearch;
+            }
+            break;
+          case -2020003315:
+            if (name == "c4.8xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::c4_8xlarge_elasticsearch;
+            }
+            break;
+          case -1790601890:
+            if (name == "r4.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_large_elasticsearch;
+            }
+            break;
+          case -1272260546:
+            if (name == "r4.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_xlarge_elasticsearch;
+            }
+            break;
+          case 1757208:
+            if (name == "r4.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_2xlarge_elasticsearch;
+            }
+            break;
+          case 424459034:
+            if (name == "r4.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_4xlarge_elasticsearch;
+            }
+            break;
+          case 1269862686:
+            if (name == "r4.8xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_8xlarge_elasticsearch;
+            }
+            break;
+          case -569905437:
+            if (name == "r4.16xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_16xlarge_elasticsearch;
+            }
+            break;
+          case -839315386:
+            if (name == "i3.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_large_elasticsearch;
+            }
+            break;
+          case -1847149994:
+            if (name == "i3.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_xlarge_elasticsearch;
+            }
+            break;
+          case -639946496:
+            if (name == "i3.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_2xlarge_elasticsearch;
+            }
+            break;
+          case -217244670:
+            if (name == "i3.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_4xlarge_elasticsearch;
+            }
+            break;
+          case 628158982:
+            if (name == "i3.8xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_8xlarge_elasticsearch;
+            }
+            break;
+          case 1012116219:
+            if (name == "i3.16xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_16xlarge_elasticsearch;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -245,99 +338,26 @@ namespace Aws
           return ESPartitionInstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForESPartitionInstanceType(ESPartitionInstanceType enumValue)
+        const char* GetNameForESPartitionInstanceTypeCStr(ESPartitionInstanceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ESPartitionInstanceType::m3_medium_elasticsearch:
-            return "m3.medium.elasticsearch";
-          case ESPartitionInstanceType::m3_large_elasticsearch:
-            return "m3.large.elasticsearch";
-          case ESPartitionInstanceType::m3_xlarge_elasticsearch:
-            return "m3.xlarge.elasticsearch";
-          case ESPartitionInstanceType::m3_2xlarge_elasticsearch:
-            return "m3.2xlarge.elasticsearch";
-          case ESPartitionInstanceType::m4_large_elasticsearch:
-            return "m4.large.elasticsearch";
-          case ESPartitionInstanceType::m4_xlarge_elasticsearch:
-            return "m4.xlarge.elasticsearch";
-          case ESPartitionInstanceType::m4_2xlarge_elasticsearch:
-            return "m4.2xlarge.elasticsearch";
-          case ESPartitionInstanceType::m4_4xlarge_elasticsearch:
-            return "m4.4xlarge.elasticsearch";
-          case ESPartitionInstanceType::m4_10xlarge_elasticsearch:
-            return "m4.10xlarge.elasticsearch";
-          case ESPartitionInstanceType::t2_micro_elasticsearch:
-            return "t2.micro.elasticsearch";
-          case ESPartitionInstanceType::t2_small_elasticsearch:
-            return "t2.small.elasticsearch";
-          case ESPartitionInstanceType::t2_medium_elasticsearch:
-            return "t2.medium.elasticsearch";
-          case ESPartitionInstanceType::r3_large_elasticsearch:
-            return "r3.large.elasticsearch";
-          case ESPartitionInstanceType::r3_xlarge_elasticsearch:
-            return "r3.xlarge.elasticsearch";
-          case ESPartitionInstanceType::r3_2xlarge_elasticsearch:
-            return "r3.2xlarge.elasticsearch";
-          case ESPartitionInstanceType::r3_4xlarge_elasticsearch:
-            return "r3.4xlarge.elasticsearch";
-          case ESPartitionInstanceType::r3_8xlarge_elasticsearch:
-            return "r3.8xlarge.elasticsearch";
-          case ESPartitionInstanceType::i2_xlarge_elasticsearch:
-            return "i2.xlarge.elasticsearch";
-          case ESPartitionInstanceType::i2_2xlarge_elasticsearch:
-            return "i2.2xlarge.elasticsearch";
-          case ESPartitionInstanceType::d2_xlarge_elasticsearch:
-            return "d2.xlarge.elasticsearch";
-          case ESPartitionInstanceType::d2_2xlarge_elasticsearch:
-            return "d2.2xlarge.elasticsearch";
-          case ESPartitionInstanceType::d2_4xlarge_elasticsearch:
-            return "d2.4xlarge.elasticsearch";
-          case ESPartitionInstanceType::d2_8xlarge_elasticsearch:
-            return "d2.8xlarge.elasticsearch";
-          case ESPartitionInstanceType::c4_large_elasticsearch:
-            return "c4.large.elasticsearch";
-          case ESPartitionInstanceType::c4_xlarge_elasticsearch:
-            return "c4.xlarge.elasticsearch";
-          case ESPartitionInstanceType::c4_2xlarge_elasticsearch:
-            return "c4.2xlarge.elasticsearch";
-          case ESPartitionInstanceType::c4_4xlarge_elasticsearch:
-            return "c4.4xlarge.elasticsearch";
-          case ESPartitionInstanceType::c4_8xlarge_elasticsearch:
-            return "c4.8xlarge.elasticsearch";
-          case ESPartitionInstanceType::r4_large_elasticsearch:
-            return "r4.large.elasticsearch";
-          case ESPartitionInstanceType::r4_xlarge_elasticsearch:
-            return "r4.xlarge.elasticsearch";
-          case ESPartitionInstanceType::r4_2xlarge_elasticsearch:
-            return "r4.2xlarge.elasticsearch";
-          case ESPartitionInstanceType::r4_4xlarge_elasticsearch:
-            return "r4.4xlarge.elasticsearch";
-          case ESPartitionInstanceType::r4_8xlarge_elasticsearch:
-            return "r4.8xlarge.elasticsearch";
-          case ESPartitionInstanceType::r4_16xlarge_elasticsearch:
-            return "r4.16xlarge.elasticsearch";
-          case ESPartitionInstanceType::i3_large_elasticsearch:
-            return "i3.large.elasticsearch";
-          case ESPartitionInstanceType::i3_xlarge_elasticsearch:
-            return "i3.xlarge.elasticsearch";
-          case ESPartitionInstanceType::i3_2xlarge_elasticsearch:
-            return "i3.2xlarge.elasticsearch";
-          case ESPartitionInstanceType::i3_4xlarge_elasticsearch:
-            return "i3.4xlarge.elasticsearch";
-          case ESPartitionInstanceType::i3_8xlarge_elasticsearch:
-            return "i3.8xlarge.elasticsearch";
-          case ESPartitionInstanceType::i3_16xlarge_elasticsearch:
-            return "i3.16xlarge.elasticsearch";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForESPartitionInstanceType(ESPartitionInstanceType enumValue)
+        {
+          return GetNameForESPartitionInstanceTypeCStr(enumValue);
         }
 
       } // namespace ESPartitionInstanceTypeMapper
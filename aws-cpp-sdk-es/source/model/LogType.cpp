@@ -30,25 +30,44 @@ namespace Aws
       namespace LogTypeMapper
       {
 
-        static const int INDEX_SLOW_LOGS_HASH = HashingUtils::HashString("INDEX_SLOW_LOGS");
-        static const int SEARCH_SLOW_LOGS_HASH = HashingUtils::HashString("SEARCH_SLOW_LOGS");
-        static const int ES_APPLICATION_LOGS_HASH = HashingUtils::HashString("ES_APPLICATION_LOGS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INDEX_SLOW_LOGS",
+          "SEARCH_SLOW_LOGS",
+          "ES_APPLICATION_LOGS",
+        };
 
         LogType GetLogTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INDEX_SLOW_LOGS_HASH)
-          {
-            return LogType::INDEX_SLOW_LOGS;
-          }
-          else if (hashCode == SEARCH_SLOW_LOGS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LogType::SEARCH_SLOW_LOGS;
-          }
-          else if (hashCode == ES_APPLICATION_LOGS_HASH)
-          {
-            return LogType::ES_APPLICATION_LOGS;
+          case -1969479200:
+            if (name == "INDEX_SLOW_LOGS")
+            {
+              return LogType::INDEX_SLOW_LOGS;
+            }
+            break;
+          case 2058489686:
+            if (name == "SEARCH_SLOW_LOGS")
+            {
+              return LogType::SEARCH_SLOW_LOGS;
+            }
+            break;
+          case 728311503:
+            if (name == "ES_APPLICATION_LOGS")
+            {
+              return LogType::ES_APPLICATION_LOGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return LogType::NOT_SET;
         }
 
-        Aws::String GetNameForLogType(LogType enumValue)
+        const char* GetNameForLogTypeCStr(LogType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LogType::INDEX_SLOW_LOGS:
-            return "INDEX_SLOW_LOGS";
-          case LogType::SEARCH_SLOW_LOGS:
-            return "SEARCH_SLOW_LOGS";
-          case LogType::ES_APPLICATION_LOGS:
-            return "ES_APPLICATION_LOGS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLogType(LogType enumValue)
+        {
+          return GetNameForLogTypeCStr(enumValue);
         }
 
       } // namespace LogTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ReservedElasticsearchInstancePaymentOptionMapper
       {
 
-        static const int ALL_UPFRONT_HASH = HashingUtils::HashString("ALL_UPFRONT");
-        static const int PARTIAL_UPFRONT_HASH = HashingUtils::HashString("PARTIAL_UPFRONT");
-        static const int NO_UPFRONT_HASH = HashingUtils::HashString("NO_UPFRONT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALL_UPFRONT",
+          "PARTIAL_UPFRONT",
+          "NO_UPFRONT",
+        };
 
         ReservedElasticsearchInstancePaymentOption GetReservedElasticsearchInstancePaymentOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_UPFRONT_HASH)
-          {
-            return ReservedElasticsearchInstancePaymentOption::ALL_UPFRONT;
-          }
-          else if (hashCode == PARTIAL_UPFRONT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReservedElasticsearchInstancePaymentOption::PARTIAL_UPFRONT;
-          }
-          else if (hashCode == NO_UPFRONT_HASH)
-          {
-            return ReservedElasticsearchInstancePaymentOption::NO_UPFRONT;
+          case 28694416:
+            if (name == "ALL_UPFRONT")
+            {
+              return ReservedElasticsearchInstancePaymentOption::ALL_UPFRONT;
+            }
+            break;
+          case -2083041424:
+            if (name == "PARTIAL_UPFRONT")
+            {
+              return ReservedElasticsearchInstancePaymentOption::PARTIAL_UPFRONT;
+            }
+            break;
+          case -654007344:
+            if (name == "NO_UPFRONT")
+            {
+              return ReservedElasticsearchInstancePaymentOption::NO_UPFRONT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ReservedElasticsearchInstancePaymentOption::NOT_SET;
         }
 
-        Aws::String GetNameForReservedElasticsearchInstancePaymentOption(ReservedElasticsearchInstancePaymentOption enumValue)
+        const char* GetNameForReservedElasticsearchInstancePaymentOptionCStr(ReservedElasticsearchInstancePaymentOption enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReservedElasticsearchInstancePaymentOption::ALL_UPFRONT:
-            return "ALL_UPFRONT";
-          case ReservedElasticsearchInstancePaymentOption::PARTIAL_UPFRONT:
-            return "PARTIAL_UPFRONT";
-          case ReservedElasticsearchInstancePaymentOption::NO_UPFRONT:
-            return "NO_UPFRONT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReservedElasticsearchInstancePaymentOption(ReservedElasticsearchInstancePaymentOption enumValue)
+        {
+          return GetNameForReservedElasticsearchInstancePaymentOptionCStr(enumValue);
         }
 
       } // namespace ReservedElasticsearchInstancePaymentOptionMapper
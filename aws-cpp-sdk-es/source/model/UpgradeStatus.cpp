@@ -30,30 +30,51 @@ namespace Aws
       namespace UpgradeStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int SUCCEEDED_WITH_ISSUES_HASH = HashingUtils::HashString("SUCCEEDED_WITH_ISSUES");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "SUCCEEDED",
+          "SUCCEEDED_WITH_ISSUES",
+          "FAILED",
+        };
 
         UpgradeStatus GetUpgradeStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return UpgradeStatus::IN_PROGRESS;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return UpgradeStatus::SUCCEEDED;
-          }
-          else if (hashCode == SUCCEEDED_WITH_ISSUES_HASH)
-          {
-            return UpgradeStatus::SUCCEEDED_WITH_ISSUES;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UpgradeStatus::FAILED;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return UpgradeStatus::IN_PROGRESS;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return UpgradeStatus::SUCCEEDED;
+            }
+            break;
+          case 103434069:
+            if (name == "SUCCEEDED_WITH_ISSUES")
+            {
+              return UpgradeStatus::SUCCEEDED_WITH_ISSUES;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return UpgradeStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return UpgradeStatus::NOT_SET;
         }
 
-        Aws::String GetNameForUpgradeStatus(UpgradeStatus enumValue)
+        const char* GetNameForUpgradeStatusCStr(UpgradeStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UpgradeStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case UpgradeStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case UpgradeStatus::SUCCEEDED_WITH_ISSUES:
-            return "SUCCEEDED_WITH_ISSUES";
-          case UpgradeStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUpgradeStatus(UpgradeStatus enumValue)
+        {
+          return GetNameForUpgradeStatusCStr(enumValue);
         }
 
       } // namespace UpgradeStatusMapper
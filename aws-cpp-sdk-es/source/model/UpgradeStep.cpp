@@ -30,25 +30,44 @@ namespace Aws
       namespace UpgradeStepMapper
       {
 
-        static const int PRE_UPGRADE_CHECK_HASH = HashingUtils::HashString("PRE_UPGRADE_CHECK");
-        static const int SNAPSHOT_HASH = HashingUtils::HashString("SNAPSHOT");
-        static const int UPGRADE_HASH = HashingUtils::HashString("UPGRADE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PRE_UPGRADE_CHECK",
+          "SNAPSHOT",
+          "UPGRADE",
+        };
 
         UpgradeStep GetUpgradeStepForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRE_UPGRADE_CHECK_HASH)
-          {
-            return UpgradeStep::PRE_UPGRADE_CHECK;
-          }
-          else if (hashCode == SNAPSHOT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UpgradeStep::SNAPSHOT;
-          }
-          else if (hashCode == UPGRADE_HASH)
-          {
-            return UpgradeStep::UPGRADE;
+          case -932909015:
+            if (name == "PRE_UPGRADE_CHECK")
+            {
+              return UpgradeStep::PRE_UPGRADE_CHECK;
+            }
+            break;
+          case 1067500996:
+            if (name == "SNAPSHOT")
+            {
+              return UpgradeStep::SNAPSHOT;
+            }
+            break;
+          case 486811132:
+            if (name == "UPGRADE")
+            {
+              return UpgradeStep::UPGRADE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return UpgradeStep::NOT_SET;
         }
 
-        Aws::String GetNameForUpgradeStep(UpgradeStep enumValue)
+        const char* GetNameForUpgradeStepCStr(UpgradeStep enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UpgradeStep::PRE_UPGRADE_CHECK:
-            return "PRE_UPGRADE_CHECK";
-          case UpgradeStep::SNAPSHOT:
-            return "SNAPSHOT";
-          case UpgradeStep::UPGRADE:
-            return "UPGRADE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUpgradeStep(UpgradeStep enumValue)
+        {
+          return GetNameForUpgradeStepCStr(enumValue);
         }
 
       } // namespace UpgradeStepMapper
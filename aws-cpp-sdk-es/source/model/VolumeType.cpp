@@ -30,25 +30,44 @@ namespace Aws
       namespace VolumeTypeMapper
       {
 
-        static const int standard_HASH = HashingUtils::HashString("standard");
-        static const int gp2_HASH = HashingUtils::HashString("gp2");
-        static const int io1_HASH = HashingUtils::HashString("io1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "standard",
+          "gp2",
+          "io1",
+        };
 
         VolumeType GetVolumeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == standard_HASH)
-          {
-            return VolumeType::standard;
-          }
-          else if (hashCode == gp2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VolumeType::gp2;
-          }
-          else if (hashCode == io1_HASH)
-          {
-            return VolumeType::io1;
+          case 1312628413:
+            if (name == "standard")
+            {
+              return VolumeType::standard;
+            }
+            break;
+          case 102505:
+            if (name == "gp2")
+            {
+              return VolumeType::gp2;
+            }
+            break;
+          case 104395:
+            if (name == "io1")
+            {
+              return VolumeType::io1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return VolumeType::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeType(VolumeType enumValue)
+        const char* GetNameForVolumeTypeCStr(VolumeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VolumeType::standard:
-            return "standard";
-          case VolumeType::gp2:
-            return "gp2";
-          case VolumeType::io1:
-            return "io1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVolumeType(VolumeType enumValue)
+        {
+          return GetNameForVolumeTypeCStr(enumValue);
         }
 
       } // namespace VolumeTypeMapper
@@ -35,6 +35,11 @@ namespace AssignPublicIpMapper
 AWS_CLOUDWATCHEVENTS_API AssignPublicIp GetAssignPublicIpForName(const Aws::String& name);
 
 AWS_CLOUDWATCHEVENTS_API Aws::String GetNameForAssignPublicIp(AssignPublicIp value);
+
+/**
+ * Same as GetNameForAssignPublicIp(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCHEVENTS_API const char* GetNameForAssignPublicIpCStr(AssignPublicIp value);
 } // namespace AssignPublicIpMapper
 } // namespace Model
 } // namespace CloudWatchEvents
@@ -35,6 +35,11 @@ namespace LaunchTypeMapper
 AWS_CLOUDWATCHEVENTS_API LaunchType GetLaunchTypeForName(const Aws::String& name);
 
 AWS_CLOUDWATCHEVENTS_API Aws::String GetNameForLaunchType(LaunchType value);
+
+/**
+ * Same as GetNameForLaunchType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCHEVENTS_API const char* GetNameForLaunchTypeCStr(LaunchType value);
 } // namespace LaunchTypeMapper
 } // namespace Model
 } // namespace CloudWatchEvents
@@ -35,6 +35,11 @@ namespace RuleStateMapper
 AWS_CLOUDWATCHEVENTS_API RuleState GetRuleStateForName(const Aws::String& name);
 
 AWS_CLOUDWATCHEVENTS_API Aws::String GetNameForRuleState(RuleState value);
+
+/**
+ * Same as GetNameForRuleState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCHEVENTS_API const char* GetNameForRuleStateCStr(RuleState value);
 } // namespace RuleStateMapper
 } // namespace Model
 } // namespace CloudWatchEvents
@@ -37,6 +37,11 @@ namespace CompressionFormatMapper
 AWS_FIREHOSE_API CompressionFormat GetCompressionFormatForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForCompressionFormat(CompressionFormat value);
+
+/**
+ * Same as GetNameForCompressionFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForCompressionFormatCStr(CompressionFormat value);
 } // namespace CompressionFormatMapper
 } // namespace Model
 } // namespace Firehose
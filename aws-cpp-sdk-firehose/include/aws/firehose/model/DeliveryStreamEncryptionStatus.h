@@ -37,6 +37,11 @@ namespace DeliveryStreamEncryptionStatusMapper
 AWS_FIREHOSE_API DeliveryStreamEncryptionStatus GetDeliveryStreamEncryptionStatusForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForDeliveryStreamEncryptionStatus(DeliveryStreamEncryptionStatus value);
+
+/**
+ * Same as GetNameForDeliveryStreamEncryptionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForDeliveryStreamEncryptionStatusCStr(DeliveryStreamEncryptionStatus value);
 } // namespace DeliveryStreamEncryptionStatusMapper
 } // namespace Model
 } // namespace Firehose
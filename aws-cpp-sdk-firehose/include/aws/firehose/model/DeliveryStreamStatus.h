@@ -36,6 +36,11 @@ namespace DeliveryStreamStatusMapper
 AWS_FIREHOSE_API DeliveryStreamStatus GetDeliveryStreamStatusForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForDeliveryStreamStatus(DeliveryStreamStatus value);
+
+/**
+ * Same as GetNameForDeliveryStreamStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForDeliveryStreamStatusCStr(DeliveryStreamStatus value);
 } // namespace DeliveryStreamStatusMapper
 } // namespace Model
 } // namespace Firehose
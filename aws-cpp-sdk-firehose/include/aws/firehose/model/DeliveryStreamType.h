@@ -35,6 +35,11 @@ namespace DeliveryStreamTypeMapper
 AWS_FIREHOSE_API DeliveryStreamType GetDeliveryStreamTypeForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForDeliveryStreamType(DeliveryStreamType value);
+
+/**
+ * Same as GetNameForDeliveryStreamType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForDeliveryStreamTypeCStr(DeliveryStreamType value);
 } // namespace DeliveryStreamTypeMapper
 } // namespace Model
 } // namespace Firehose
@@ -38,6 +38,11 @@ namespace ElasticsearchIndexRotationPeriodMapper
 AWS_FIREHOSE_API ElasticsearchIndexRotationPeriod GetElasticsearchIndexRotationPeriodForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForElasticsearchIndexRotationPeriod(ElasticsearchIndexRotationPeriod value);
+
+/**
+ * Same as GetNameForElasticsearchIndexRotationPeriod(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForElasticsearchIndexRotationPeriodCStr(ElasticsearchIndexRotationPeriod value);
 } // namespace ElasticsearchIndexRotationPeriodMapper
 } // namespace Model
 } // namespace Firehose
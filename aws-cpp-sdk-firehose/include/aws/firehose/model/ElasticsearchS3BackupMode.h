@@ -35,6 +35,11 @@ namespace ElasticsearchS3BackupModeMapper
 AWS_FIREHOSE_API ElasticsearchS3BackupMode GetElasticsearchS3BackupModeForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForElasticsearchS3BackupMode(ElasticsearchS3BackupMode value);
+
+/**
+ * Same as GetNameForElasticsearchS3BackupMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForElasticsearchS3BackupModeCStr(ElasticsearchS3BackupMode value);
 } // namespace ElasticsearchS3BackupModeMapper
 } // namespace Model
 } // namespace Firehose
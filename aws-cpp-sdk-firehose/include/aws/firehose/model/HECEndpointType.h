@@ -35,6 +35,11 @@ namespace HECEndpointTypeMapper
 AWS_FIREHOSE_API HECEndpointType GetHECEndpointTypeForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForHECEndpointType(HECEndpointType value);
+
+/**
+ * Same as GetNameForHECEndpointType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForHECEndpointTypeCStr(HECEndpointType value);
 } // namespace HECEndpointTypeMapper
 } // namespace Model
 } // namespace Firehose
@@ -34,6 +34,11 @@ namespace NoEncryptionConfigMapper
 AWS_FIREHOSE_API NoEncryptionConfig GetNoEncryptionConfigForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForNoEncryptionConfig(NoEncryptionConfig value);
+
+/**
+ * Same as GetNameForNoEncryptionConfig(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForNoEncryptionConfigCStr(NoEncryptionConfig value);
 } // namespace NoEncryptionConfigMapper
 } // namespace Model
 } // namespace Firehose
@@ -36,6 +36,11 @@ namespace OrcCompressionMapper
 AWS_FIREHOSE_API OrcCompression GetOrcCompressionForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForOrcCompression(OrcCompression value);
+
+/**
+ * Same as GetNameForOrcCompression(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForOrcCompressionCStr(OrcCompression value);
 } // namespace OrcCompressionMapper
 } // namespace Model
 } // namespace Firehose
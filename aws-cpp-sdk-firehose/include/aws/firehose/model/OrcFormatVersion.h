@@ -35,6 +35,11 @@ namespace OrcFormatVersionMapper
 AWS_FIREHOSE_API OrcFormatVersion GetOrcFormatVersionForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForOrcFormatVersion(OrcFormatVersion value);
+
+/**
+ * Same as GetNameForOrcFormatVersion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForOrcFormatVersionCStr(OrcFormatVersion value);
 } // namespace OrcFormatVersionMapper
 } // namespace Model
 } // namespace Firehose
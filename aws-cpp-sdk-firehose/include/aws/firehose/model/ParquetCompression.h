@@ -36,6 +36,11 @@ namespace ParquetCompressionMapper
 AWS_FIREHOSE_API ParquetCompression GetParquetCompressionForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForParquetCompression(ParquetCompression value);
+
+/**
+ * Same as GetNameForParquetCompression(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForParquetCompressionCStr(ParquetCompression value);
 } // namespace ParquetCompressionMapper
 } // namespace Model
 } // namespace Firehose
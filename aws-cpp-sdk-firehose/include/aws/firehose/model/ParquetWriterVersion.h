@@ -35,6 +35,11 @@ namespace ParquetWriterVersionMapper
 AWS_FIREHOSE_API ParquetWriterVersion GetParquetWriterVersionForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForParquetWriterVersion(ParquetWriterVersion value);
+
+/**
+ * Same as GetNameForParquetWriterVersion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForParquetWriterVersionCStr(ParquetWriterVersion value);
 } // namespace ParquetWriterVersionMapper
 } // namespace Model
 } // namespace Firehose
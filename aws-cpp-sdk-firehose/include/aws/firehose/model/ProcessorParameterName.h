@@ -38,6 +38,11 @@ namespace ProcessorParameterNameMapper
 AWS_FIREHOSE_API ProcessorParameterName GetProcessorParameterNameForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForProcessorParameterName(ProcessorParameterName value);
+
+/**
+ * Same as GetNameForProcessorParameterName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForProcessorParameterNameCStr(ProcessorParameterName value);
 } // namespace ProcessorParameterNameMapper
 } // namespace Model
 } // namespace Firehose
@@ -34,6 +34,11 @@ namespace ProcessorTypeMapper
 AWS_FIREHOSE_API ProcessorType GetProcessorTypeForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForProcessorType(ProcessorType value);
+
+/**
+ * Same as GetNameForProcessorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForProcessorTypeCStr(ProcessorType value);
 } // namespace ProcessorTypeMapper
 } // namespace Model
 } // namespace Firehose
@@ -35,6 +35,11 @@ namespace RedshiftS3BackupModeMapper
 AWS_FIREHOSE_API RedshiftS3BackupMode GetRedshiftS3BackupModeForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForRedshiftS3BackupMode(RedshiftS3BackupMode value);
+
+/**
+ * Same as GetNameForRedshiftS3BackupMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForRedshiftS3BackupModeCStr(RedshiftS3BackupMode value);
 } // namespace RedshiftS3BackupModeMapper
 } // namespace Model
 } // namespace Firehose
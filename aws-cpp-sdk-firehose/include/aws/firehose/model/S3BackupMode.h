@@ -35,6 +35,11 @@ namespace S3BackupModeMapper
 AWS_FIREHOSE_API S3BackupMode GetS3BackupModeForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForS3BackupMode(S3BackupMode value);
+
+/**
+ * Same as GetNameForS3BackupMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForS3BackupModeCStr(S3BackupMode value);
 } // namespace S3BackupModeMapper
 } // namespace Model
 } // namespace Firehose
@@ -35,6 +35,11 @@ namespace SplunkS3BackupModeMapper
 AWS_FIREHOSE_API SplunkS3BackupMode GetSplunkS3BackupModeForName(const Aws::String& name);
 
 AWS_FIREHOSE_API Aws::String GetNameForSplunkS3BackupMode(SplunkS3BackupMode value);
+
+/**
+ * Same as GetNameForSplunkS3BackupMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FIREHOSE_API const char* GetNameForSplunkS3BackupModeCStr(SplunkS3BackupMode value);
 } // namespace SplunkS3BackupModeMapper
 } // namespace Model
 } // namespace Firehose
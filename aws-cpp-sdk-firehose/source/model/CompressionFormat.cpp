@@ -30,30 +30,51 @@ namespace Aws
       namespace CompressionFormatMapper
       {
 
-        static const int UNCOMPRESSED_HASH = HashingUtils::HashString("UNCOMPRESSED");
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
-        static const int ZIP_HASH = HashingUtils::HashString("ZIP");
-        static const int Snappy_HASH = HashingUtils::HashString("Snappy");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNCOMPRESSED",
+          "GZIP",
+          "ZIP",
+          "Snappy",
+        };
 
         CompressionFormat GetCompressionFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNCOMPRESSED_HASH)
-          {
-            return CompressionFormat::UNCOMPRESSED;
-          }
-          else if (hashCode == GZIP_HASH)
-          {
-            return CompressionFormat::GZIP;
-          }
-          else if (hashCode == ZIP_HASH)
-          {
-            return CompressionFormat::ZIP;
-          }
-          else if (hashCode == Snappy_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CompressionFormat::Snappy;
+          case -225512742:
+            if (name == "UNCOMPRESSED")
+            {
+              return CompressionFormat::UNCOMPRESSED;
+            }
+            break;
+          case 2203994:
+            if (name == "GZIP")
+            {
+              return CompressionFormat::GZIP;
+            }
+            break;
+          case 88833:
+            if (name == "ZIP")
+            {
+              return CompressionFormat::ZIP;
+            }
+            break;
+          case -1814159501:
+            if (name == "Snappy")
+            {
+              return CompressionFormat::Snappy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return CompressionFormat::NOT_SET;
         }
 
-        Aws::String GetNameForCompressionFormat(CompressionFormat enumValue)
+        const char* GetNameForCompressionFormatCStr(CompressionFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CompressionFormat::UNCOMPRESSED:
-            return "UNCOMPRESSED";
-          case CompressionFormat::GZIP:
-            return "GZIP";
-          case CompressionFormat::ZIP:
-            return "ZIP";
-          case CompressionFormat::Snappy:
-            return "Snappy";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCompressionFormat(CompressionFormat enumValue)
+        {
+          return GetNameForCompressionFormatCStr(enumValue);
         }
 
       } // namespace CompressionFormatMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace DeliveryStreamEncryptionStatusMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int ENABLING_HASH = HashingUtils::HashString("ENABLING");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int DISABLING_HASH = HashingUtils::HashString("DISABLING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLED",
+          "ENABLING",
+          "DISABLED",
+          "DISABLING",
+        };
 
         DeliveryStreamEncryptionStatus GetDeliveryStreamEncryptionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
-          {
-            return DeliveryStreamEncryptionStatus::ENABLED;
-          }
-          else if (hashCode == ENABLING_HASH)
-          {
-            return DeliveryStreamEncryptionStatus::ENABLING;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return DeliveryStreamEncryptionStatus::DISABLED;
-          }
-          else if (hashCode == DISABLING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeliveryStreamEncryptionStatus::DISABLING;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return DeliveryStreamEncryptionStatus::ENABLED;
+            }
+            break;
+          case -1870144128:
+            if (name == "ENABLING")
+            {
+              return DeliveryStreamEncryptionStatus::ENABLING;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return DeliveryStreamEncryptionStatus::DISABLED;
+            }
+            break;
+          case -1699138171:
+            if (name == "DISABLING")
+            {
+              return DeliveryStreamEncryptionStatus::DISABLING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DeliveryStreamEncryptionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeliveryStreamEncryptionStatus(DeliveryStreamEncryptionStatus enumValue)
+        const char* GetNameForDeliveryStreamEncryptionStatusCStr(DeliveryStreamEncryptionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeliveryStreamEncryptionStatus::ENABLED:
-            return "ENABLED";
-          case DeliveryStreamEncryptionStatus::ENABLING:
-            return "ENABLING";
-          case DeliveryStreamEncryptionStatus::DISABLED:
-            return "DISABLED";
-          case DeliveryStreamEncryptionStatus::DISABLING:
-            return "DISABLING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeliveryStreamEncryptionStatus(DeliveryStreamEncryptionStatus enumValue)
+        {
+          return GetNameForDeliveryStreamEncryptionStatusCStr(enumValue);
         }
 
       } // namespace DeliveryStreamEncryptionStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DeliveryStreamStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "DELETING",
+          "ACTIVE",
+        };
 
         DeliveryStreamStatus GetDeliveryStreamStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return DeliveryStreamStatus::CREATING;
-          }
-          else if (hashCode == DELETING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeliveryStreamStatus::DELETING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return DeliveryStreamStatus::ACTIVE;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return DeliveryStreamStatus::CREATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return DeliveryStreamStatus::DELETING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return DeliveryStreamStatus::ACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DeliveryStreamStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeliveryStreamStatus(DeliveryStreamStatus enumValue)
+        const char* GetNameForDeliveryStreamStatusCStr(DeliveryStreamStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeliveryStreamStatus::CREATING:
-            return "CREATING";
-          case DeliveryStreamStatus::DELETING:
-            return "DELETING";
-          case DeliveryStreamStatus::ACTIVE:
-            return "ACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeliveryStreamStatus(DeliveryStreamStatus enumValue)
+        {
+          return GetNameForDeliveryStreamStatusCStr(enumValue);
         }
 
       } // namespace DeliveryStreamStatusMapper
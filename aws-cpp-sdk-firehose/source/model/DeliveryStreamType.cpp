@@ -30,20 +30,37 @@ namespace Aws
       namespace DeliveryStreamTypeMapper
       {
 
-        static const int DirectPut_HASH = HashingUtils::HashString("DirectPut");
-        static const int KinesisStreamAsSource_HASH = HashingUtils::HashString("KinesisStreamAsSource");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DirectPut",
+          "KinesisStreamAsSource",
+        };
 
         DeliveryStreamType GetDeliveryStreamTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DirectPut_HASH)
-          {
-            return DeliveryStreamType::DirectPut;
-          }
-          else if (hashCode == KinesisStreamAsSource_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeliveryStreamType::KinesisStreamAsSource;
+          case 1041353286:
+            if (name == "DirectPut")
+            {
+              return DeliveryStreamType::DirectPut;
+            }
+            break;
+          case -1614054987:
+            if (name == "KinesisStreamAsSource")
+            {
+              return DeliveryStreamType::KinesisStreamAsSource;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeliveryStreamType::NOT_SET;
         }
 
-        Aws::String GetNameForDeliveryStreamType(DeliveryStreamType enumValue)
+        const char* GetNameForDeliveryStreamTypeCStr(DeliveryStreamType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeliveryStreamType::DirectPut:
-            return "DirectPut";
-          case DeliveryStreamType::KinesisStreamAsSource:
-            return "KinesisStreamAsSource";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeliveryStreamType(DeliveryStreamType enumValue)
+        {
+          return GetNameForDeliveryStreamTypeCStr(enumValue);
         }
 
       } // namespace DeliveryStreamTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ElasticsearchIndexRotationPeriodMapper
       {
 
-        static const int NoRotation_HASH = HashingUtils::HashString("NoRotation");
-        static const int OneHour_HASH = HashingUtils::HashString("OneHour");
-        static const int OneDay_HASH = HashingUtils::HashString("OneDay");
-        static const int OneWeek_HASH = HashingUtils::HashString("OneWeek");
-        static const int OneMonth_HASH = HashingUtils::HashString("OneMonth");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NoRotation",
+          "OneHour",
+          "OneDay",
+          "OneWeek",
+          "OneMonth",
+        };
 
         ElasticsearchIndexRotationPeriod GetElasticsearchIndexRotationPeriodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoRotation_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ElasticsearchIndexRotationPeriod::NoRotation;
-          }
-          else if (hashCode == OneHour_HASH)
-          {
-            return ElasticsearchIndexRotationPeriod::OneHour;
-          }
-          else if (hashCode == OneDay_HASH)
-          {
-            return ElasticsearchIndexRotationPeriod::OneDay;
-          }
-          else if (hashCode == OneWeek_HASH)
-          {
-            return ElasticsearchIndexRotationPeriod::OneWeek;
-          }
-          else if (hashCode == OneMonth_HASH)
-          {
-            return ElasticsearchIndexRotationPeriod::OneMonth;
+          case -1182790529:
+            if (name == "NoRotation")
+            {
+              return ElasticsearchIndexRotationPeriod::NoRotation;
+            }
+            break;
+          case 343084362:
+            if (name == "OneHour")
+            {
+              return ElasticsearchIndexRotationPeriod::OneHour;
+            }
+            break;
+          case -1928599690:
+            if (name == "OneDay")
+            {
+              return ElasticsearchIndexRotationPeriod::OneDay;
+            }
+            break;
+          case 343521114:
+            if (name == "OneWeek")
+            {
+              return ElasticsearchIndexRotationPeriod::OneWeek;
+            }
+            break;
+          case 2050291674:
+            if (name == "OneMonth")
+            {
+              return ElasticsearchIndexRotationPeriod::OneMonth;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ElasticsearchIndexRotationPeriod::NOT_SET;
         }
 
-        Aws::String GetNameForElasticsearchIndexRotationPeriod(ElasticsearchIndexRotationPeriod enumValue)
+        const char* GetNameForElasticsearchIndexRotationPeriodCStr(ElasticsearchIndexRotationPeriod enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ElasticsearchIndexRotationPeriod::NoRotation:
-            return "NoRotation";
-          case ElasticsearchIndexRotationPeriod::OneHour:
-            return "OneHour";
-          case ElasticsearchIndexRotationPeriod::OneDay:
-            return "OneDay";
-          case ElasticsearchIndexRotationPeriod::OneWeek:
-            return "OneWeek";
-          case ElasticsearchIndexRotationPeriod::OneMonth:
-            return "OneMonth";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForElasticsearchIndexRotationPeriod(ElasticsearchIndexRotationPeriod enumValue)
+        {
+          return GetNameForElasticsearchIndexRotationPeriodCStr(enumValue);
         }
 
       } // namespace ElasticsearchIndexRotationPeriodMapper
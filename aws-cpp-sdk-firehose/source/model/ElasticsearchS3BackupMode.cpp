@@ -30,20 +30,37 @@ namespace Aws
       namespace ElasticsearchS3BackupModeMapper
       {
 
-        static const int FailedDocumentsOnly_HASH = HashingUtils::HashString("FailedDocumentsOnly");
-        static const int AllDocuments_HASH = HashingUtils::HashString("AllDocuments");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FailedDocumentsOnly",
+          "AllDocuments",
+        };
 
         ElasticsearchS3BackupMode GetElasticsearchS3BackupModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FailedDocumentsOnly_HASH)
-          {
-            return ElasticsearchS3BackupMode::FailedDocumentsOnly;
-          }
-          else if (hashCode == AllDocuments_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ElasticsearchS3BackupMode::AllDocuments;
+          case 879802663:
+            if (name == "FailedDocumentsOnly")
+            {
+              return ElasticsearchS3BackupMode::FailedDocumentsOnly;
+            }
+            break;
+          case -2092854729:
+            if (name == "AllDocuments")
+            {
+              return ElasticsearchS3BackupMode::AllDocuments;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ElasticsearchS3BackupMode::NOT_SET;
         }
 
-        Aws::String GetNameForElasticsearchS3BackupMode(ElasticsearchS3BackupMode enumValue)
+        const char* GetNameForElasticsearchS3BackupModeCStr(ElasticsearchS3BackupMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ElasticsearchS3BackupMode::FailedDocumentsOnly:
-            return "FailedDocumentsOnly";
-          case ElasticsearchS3BackupMode::AllDocuments:
-            return "AllDocuments";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForElasticsearchS3BackupMode(ElasticsearchS3BackupMode enumValue)
+        {
+          return GetNameForElasticsearchS3BackupModeCStr(enumValue);
         }
 
       } // namespace ElasticsearchS3BackupModeMapper
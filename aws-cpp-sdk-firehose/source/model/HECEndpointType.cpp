@@ -30,20 +30,37 @@ namespace Aws
       namespace HECEndpointTypeMapper
       {
 
-        static const int Raw_HASH = HashingUtils::HashString("Raw");
-        static const int Event_HASH = HashingUtils::HashString("Event");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Raw",
+          "Event",
+        };
 
         HECEndpointType GetHECEndpointTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Raw_HASH)
-          {
-            return HECEndpointType::Raw;
-          }
-          else if (hashCode == Event_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HECEndpointType::Event;
+          case 81928:
+            if (name == "Raw")
+            {
+              return HECEndpointType::Raw;
+            }
+            break;
+          case 67338874:
+            if (name == "Event")
+            {
+              return HECEndpointType::Event;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HECEndpointType::NOT_SET;
         }
 
-        Aws::String GetNameForHECEndpointType(HECEndpointType enumValue)
+        const char* GetNameForHECEndpointTypeCStr(HECEndpointType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HECEndpointType::Raw:
-            return "Raw";
-          case HECEndpointType::Event:
-            return "Event";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHECEndpointType(HECEndpointType enumValue)
+        {
+          return GetNameForHECEndpointTypeCStr(enumValue);
         }
 
       } // namespace HECEndpointTypeMapper
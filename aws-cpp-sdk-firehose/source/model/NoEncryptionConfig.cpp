@@ -30,15 +30,30 @@ namespace Aws
       namespace NoEncryptionConfigMapper
       {
 
-        static const int NoEncryption_HASH = HashingUtils::HashString("NoEncryption");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NoEncryption",
+        };
 
         NoEncryptionConfig GetNoEncryptionConfigForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoEncryption_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NoEncryptionConfig::NoEncryption;
+          case 66244676:
+            if (name == "NoEncryption")
+            {
+              return NoEncryptionConfig::NoEncryption;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return NoEncryptionConfig::NOT_SET;
         }
 
-        Aws::String GetNameForNoEncryptionConfig(NoEncryptionConfig enumValue)
+        const char* GetNameForNoEncryptionConfigCStr(NoEncryptionConfig enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NoEncryptionConfig::NoEncryption:
-            return "NoEncryption";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNoEncryptionConfig(NoEncryptionConfig enumValue)
+        {
+          return GetNameForNoEncryptionConfigCStr(enumValue);
         }
 
       } // namespace NoEncryptionConfigMapper
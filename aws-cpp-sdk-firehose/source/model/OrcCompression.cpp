@@ -30,25 +30,44 @@ namespace Aws
       namespace OrcCompressionMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int ZLIB_HASH = HashingUtils::HashString("ZLIB");
-        static const int SNAPPY_HASH = HashingUtils::HashString("SNAPPY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "ZLIB",
+          "SNAPPY",
+        };
 
         OrcCompression GetOrcCompressionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return OrcCompression::NONE;
-          }
-          else if (hashCode == ZLIB_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OrcCompression::ZLIB;
-          }
-          else if (hashCode == SNAPPY_HASH)
-          {
-            return OrcCompression::SNAPPY;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return OrcCompression::NONE;
+            }
+            break;
+          case 2756555:
+            if (name == "ZLIB")
+            {
+              return OrcCompression::ZLIB;
+            }
+            break;
+          case -1844697261:
+            if (name == "SNAPPY")
+            {
+              return OrcCompression::SNAPPY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return OrcCompression::NOT_SET;
         }
 
-        Aws::String GetNameForOrcCompression(OrcCompression enumValue)
+        const char* GetNameForOrcCompressionCStr(OrcCompression enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OrcCompression::NONE:
-            return "NONE";
-          case OrcCompression::ZLIB:
-            return "ZLIB";
-          case OrcCompression::SNAPPY:
-            return "SNAPPY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOrcCompression(OrcCompression enumValue)
+        {
+          return GetNameForOrcCompressionCStr(enumValue);
         }
 
       } // namespace OrcCompressionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace OrcFormatVersionMapper
       {
 
-        static const int V0_11_HASH = HashingUtils::HashString("V0_11");
-        static const int V0_12_HASH = HashingUtils::HashString("V0_12");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "V0_11",
+          "V0_12",
+        };
 
         OrcFormatVersion GetOrcFormatVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == V0_11_HASH)
-          {
-            return OrcFormatVersion::V0_11;
-          }
-          else if (hashCode == V0_12_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OrcFormatVersion::V0_12;
+          case 80945637:
+            if (name == "V0_11")
+            {
+              return OrcFormatVersion::V0_11;
+            }
+            break;
+          case 80945638:
+            if (name == "V0_12")
+            {
+              return OrcFormatVersion::V0_12;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OrcFormatVersion::NOT_SET;
         }
 
-        Aws::String GetNameForOrcFormatVersion(OrcFormatVersion enumValue)
+        const char* GetNameForOrcFormatVersionCStr(OrcFormatVersion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OrcFormatVersion::V0_11:
-            return "V0_11";
-          case OrcFormatVersion::V0_12:
-            return "V0_12";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOrcFormatVersion(OrcFormatVersion enumValue)
+        {
+          return GetNameForOrcFormatVersionCStr(enumValue);
         }
 
       } // namespace OrcFormatVersionMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ParquetCompressionMapper
       {
 
-        static const int UNCOMPRESSED_HASH = HashingUtils::HashString("UNCOMPRESSED");
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
-        static const int SNAPPY_HASH = HashingUtils::HashString("SNAPPY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNCOMPRESSED",
+          "GZIP",
+          "SNAPPY",
+        };
 
         ParquetCompression GetParquetCompressionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNCOMPRESSED_HASH)
-          {
-            return ParquetCompression::UNCOMPRESSED;
-          }
-          else if (hashCode == GZIP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ParquetCompression::GZIP;
-          }
-          else if (hashCode == SNAPPY_HASH)
-          {
-            return ParquetCompression::SNAPPY;
+          case -225512742:
+            if (name == "UNCOMPRESSED")
+            {
+              return ParquetCompression::UNCOMPRESSED;
+            }
+            break;
+          case 2203994:
+            if (name == "GZIP")
+            {
+              return ParquetCompression::GZIP;
+            }
+            break;
+          case -1844697261:
+            if (name == "SNAPPY")
+            {
+              return ParquetCompression::SNAPPY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ParquetCompression::NOT_SET;
         }
 
-        Aws::String GetNameForParquetCompression(ParquetCompression enumValue)
+        const char* GetNameForParquetCompressionCStr(ParquetCompression enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ParquetCompression::UNCOMPRESSED:
-            return "UNCOMPRESSED";
-          case ParquetCompression::GZIP:
-            return "GZIP";
-          case ParquetCompression::SNAPPY:
-            return "SNAPPY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForParquetCompression(ParquetCompression enumValue)
+        {
+          return GetNameForParquetCompressionCStr(enumValue);
         }
 
       } // namespace ParquetCompressionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ParquetWriterVersionMapper
       {
 
-        static const int V1_HASH = HashingUtils::HashString("V1");
-        static const int V2_HASH = HashingUtils::HashString("V2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "V1",
+          "V2",
+        };
 
         ParquetWriterVersion GetParquetWriterVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == V1_HASH)
-          {
-            return ParquetWriterVersion::V1;
-          }
-          else if (hashCode == V2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ParquetWriterVersion::V2;
+          case 2715:
+            if (name == "V1")
+            {
+              return ParquetWriterVersion::V1;
+            }
+            break;
+          case 2716:
+            if (name == "V2")
+            {
+              return ParquetWriterVersion::V2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ParquetWriterVersion::NOT_SET;
         }
 
-        Aws::String GetNameForParquetWriterVersion(ParquetWriterVersion enumValue)
+        const char* GetNameForParquetWriterVersionCStr(ParquetWriterVersion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ParquetWriterVersion::V1:
-            return "V1";
-          case ParquetWriterVersion::V2:
-            return "V2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForParquetWriterVersion(ParquetWriterVersion enumValue)
+        {
+          return GetNameForParquetWriterVersionCStr(enumValue);
         }
 
       } // namespace ParquetWriterVersionMapper
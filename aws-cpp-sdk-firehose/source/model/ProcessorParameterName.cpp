@@ -30,35 +30,58 @@ namespace Aws
       namespace ProcessorParameterNameMapper
       {
 
-        static const int LambdaArn_HASH = HashingUtils::HashString("LambdaArn");
-        static const int NumberOfRetries_HASH = HashingUtils::HashString("NumberOfRetries");
-        static const int RoleArn_HASH = HashingUtils::HashString("RoleArn");
-        static const int BufferSizeInMBs_HASH = HashingUtils::HashString("BufferSizeInMBs");
-        static const int BufferIntervalInSeconds_HASH = HashingUtils::HashString("BufferIntervalInSeconds");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LambdaArn",
+          "NumberOfRetries",
+          "RoleArn",
+          "BufferSizeInMBs",
+          "BufferIntervalInSeconds",
+        };
 
         ProcessorParameterName GetProcessorParameterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LambdaArn_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProcessorParameterName::LambdaArn;
-          }
-          else if (hashCode == NumberOfRetries_HASH)
-          {
-            return ProcessorParameterName::NumberOfRetries;
-          }
-          else if (hashCode == RoleArn_HASH)
-          {
-            return ProcessorParameterName::RoleArn;
-          }
-          else if (hashCode == BufferSizeInMBs_HASH)
-          {
-            return ProcessorParameterName::BufferSizeInMBs;
-          }
-          else if (hashCode == BufferIntervalInSeconds_HASH)
-          {
-            return ProcessorParameterName::BufferIntervalInSeconds;
+          case -1819056906:
+            if (name == "LambdaArn")
+            {
+              return ProcessorParameterName::LambdaArn;
+            }
+            break;
+          case 1803035142:
+            if (name == "NumberOfRetries")
+            {
+              return ProcessorParameterName::NumberOfRetries;
+            }
+            break;
+          case -1253458457:
+            if (name == "RoleArn")
+            {
+              return ProcessorParameterName::RoleArn;
+            }
+            break;
+          case -1733369288:
+            if (name == "BufferSizeInMBs")
+            {
+              return ProcessorParameterName::BufferSizeInMBs;
+            }
+            break;
+          case 1482163669:
+            if (name == "BufferIntervalInSeconds")
+            {
+              return ProcessorParameterName::BufferIntervalInSeconds;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ProcessorParameterName::NOT_SET;
         }
 
-        Aws::String GetNameForProcessorParameterName(ProcessorParameterName enumValue)
+        const char* GetNameForProcessorParameterNameCStr(ProcessorParameterName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProcessorParameterName::LambdaArn:
-            return "LambdaArn";
-          case ProcessorParameterName::NumberOfRetries:
-            return "NumberOfRetries";
-          case ProcessorParameterName::RoleArn:
-            return "RoleArn";
-          case ProcessorParameterName::BufferSizeInMBs:
-            return "BufferSizeInMBs";
-          case ProcessorParameterName::BufferIntervalInSeconds:
-            return "BufferIntervalInSeconds";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProcessorParameterName(ProcessorParameterName enumValue)
+        {
+          return GetNameForProcessorParameterNameCStr(enumValue);
         }
 
       } // namespace ProcessorParameterNameMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ProcessorTypeMapper
       {
 
-        static const int Lambda_HASH = HashingUtils::HashString("Lambda");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Lambda",
+        };
 
         ProcessorType GetProcessorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Lambda_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProcessorType::Lambda;
+          case -2026225689:
+            if (name == "Lambda")
+            {
+              return ProcessorType::Lambda;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ProcessorType::NOT_SET;
         }
 
-        Aws::String GetNameForProcessorType(ProcessorType enumValue)
+        const char* GetNameForProcessorTypeCStr(ProcessorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProcessorType::Lambda:
-            return "Lambda";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProcessorType(ProcessorType enumValue)
+        {
+          return GetNameForProcessorTypeCStr(enumValue);
         }
 
       } // namespace ProcessorTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace S3BackupModeMapper
       {
 
-        static const int Disabled_HASH = HashingUtils::HashString("Disabled");
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Disabled",
+          "Enabled",
+        };
 
         S3BackupMode GetS3BackupModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Disabled_HASH)
-          {
-            return S3BackupMode::Disabled;
-          }
-          else if (hashCode == Enabled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return S3BackupMode::Enabled;
+          case 335584924:
+            if (name == "Disabled")
+            {
+              return S3BackupMode::Disabled;
+            }
+            break;
+          case 55059233:
+            if (name == "Enabled")
+            {
+              return S3BackupMode::Enabled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return S3BackupMode::NOT_SET;
         }
 
-        Aws::String GetNameForS3BackupMode(S3BackupMode enumValue)
+        const char* GetNameForS3BackupModeCStr(S3BackupMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case S3BackupMode::Disabled:
-            return "Disabled";
-          case S3BackupMode::Enabled:
-            return "Enabled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForS3BackupMode(S3BackupMode enumValue)
+        {
+          return GetNameForS3BackupModeCStr(enumValue);
         }
 
       } // namespace S3BackupModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SplunkS3BackupModeMapper
       {
 
-        static const int FailedEventsOnly_HASH = HashingUtils::HashString("FailedEventsOnly");
-        static const int AllEvents_HASH = HashingUtils::HashString("AllEvents");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FailedEventsOnly",
+          "AllEvents",
+        };
 
         SplunkS3BackupMode GetSplunkS3BackupModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FailedEventsOnly_HASH)
-          {
-            return SplunkS3BackupMode::FailedEventsOnly;
-          }
-          else if (hashCode == AllEvents_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SplunkS3BackupMode::AllEvents;
+          case -499675998:
+            if (name == "FailedEventsOnly")
+            {
+              return SplunkS3BackupMode::FailedEventsOnly;
+            }
+            break;
+          case 1173154298:
+            if (name == "AllEvents")
+            {
+              return SplunkS3BackupMode::AllEvents;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SplunkS3BackupMode::NOT_SET;
         }
 
-        Aws::String GetNameForSplunkS3BackupMode(SplunkS3BackupMode enumValue)
+        const char* GetNameForSplunkS3BackupModeCStr(SplunkS3BackupMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SplunkS3BackupMode::FailedEventsOnly:
-            return "FailedEventsOnly";
-          case SplunkS3BackupMode::AllEvents:
-            return "AllEvents";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSplunkS3BackupMode(SplunkS3BackupMode enumValue)
+        {
+          return GetNameForSplunkS3BackupModeCStr(enumValue);
         }
 
       } // namespace SplunkS3BackupModeMapper
@@ -38,6 +38,11 @@ namespace AccountRoleStatusMapper
 AWS_FMS_API AccountRoleStatus GetAccountRoleStatusForName(const Aws::String& name);
 
 AWS_FMS_API Aws::String GetNameForAccountRoleStatus(AccountRoleStatus value);
+
+/**
+ * Same as GetNameForAccountRoleStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FMS_API const char* GetNameForAccountRoleStatusCStr(AccountRoleStatus value);
 } // namespace AccountRoleStatusMapper
 } // namespace Model
 } // namespace FMS
@@ -34,6 +34,11 @@ namespace CustomerPolicyScopeIdTypeMapper
 AWS_FMS_API CustomerPolicyScopeIdType GetCustomerPolicyScopeIdTypeForName(const Aws::String& name);
 
 AWS_FMS_API Aws::String GetNameForCustomerPolicyScopeIdType(CustomerPolicyScopeIdType value);
+
+/**
+ * Same as GetNameForCustomerPolicyScopeIdType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FMS_API const char* GetNameForCustomerPolicyScopeIdTypeCStr(CustomerPolicyScopeIdType value);
 } // namespace CustomerPolicyScopeIdTypeMapper
 } // namespace Model
 } // namespace FMS
@@ -35,6 +35,11 @@ namespace DependentServiceNameMapper
 AWS_FMS_API DependentServiceName GetDependentServiceNameForName(const Aws::String& name);
 
 AWS_FMS_API Aws::String GetNameForDependentServiceName(DependentServiceName value);
+
+/**
+ * Same as GetNameForDependentServiceName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FMS_API const char* GetNameForDependentServiceNameCStr(DependentServiceName value);
 } // namespace DependentServiceNameMapper
 } // namespace Model
 } // namespace FMS
@@ -35,6 +35,11 @@ namespace PolicyComplianceStatusTypeMapper
 AWS_FMS_API PolicyComplianceStatusType GetPolicyComplianceStatusTypeForName(const Aws::String& name);
 
 AWS_FMS_API Aws::String GetNameForPolicyComplianceStatusType(PolicyComplianceStatusType value);
+
+/**
+ * Same as GetNameForPolicyComplianceStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FMS_API const char* GetNameForPolicyComplianceStatusTypeCStr(PolicyComplianceStatusType value);
 } // namespace PolicyComplianceStatusTypeMapper
 } // namespace Model
 } // namespace FMS
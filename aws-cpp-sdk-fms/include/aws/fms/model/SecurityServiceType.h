@@ -34,6 +34,11 @@ namespace SecurityServiceTypeMapper
 AWS_FMS_API SecurityServiceType GetSecurityServiceTypeForName(const Aws::String& name);
 
 AWS_FMS_API Aws::String GetNameForSecurityServiceType(SecurityServiceType value);
+
+/**
+ * Same as GetNameForSecurityServiceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FMS_API const char* GetNameForSecurityServiceTypeCStr(SecurityServiceType value);
 } // namespace SecurityServiceTypeMapper
 } // namespace Model
 } // namespace FMS
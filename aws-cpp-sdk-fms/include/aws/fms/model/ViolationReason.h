@@ -36,6 +36,11 @@ namespace ViolationReasonMapper
 AWS_FMS_API ViolationReason GetViolationReasonForName(const Aws::String& name);
 
 AWS_FMS_API Aws::String GetNameForViolationReason(ViolationReason value);
+
+/**
+ * Same as GetNameForViolationReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FMS_API const char* GetNameForViolationReasonCStr(ViolationReason value);
 } // namespace ViolationReasonMapper
 } // namespace Model
 } // namespace FMS
@@ -30,35 +30,58 @@ namespace Aws
       namespace AccountRoleStatusMapper
       {
 
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int PENDING_DELETION_HASH = HashingUtils::HashString("PENDING_DELETION");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "READY",
+          "CREATING",
+          "PENDING_DELETION",
+          "DELETING",
+          "DELETED",
+        };
 
         AccountRoleStatus GetAccountRoleStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == READY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccountRoleStatus::READY;
-          }
-          else if (hashCode == CREATING_HASH)
-          {
-            return AccountRoleStatus::CREATING;
-          }
-          else if (hashCode == PENDING_DELETION_HASH)
-          {
-            return AccountRoleStatus::PENDING_DELETION;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return AccountRoleStatus::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return AccountRoleStatus::DELETED;
+          case 77848963:
+            if (name == "READY")
+            {
+              return AccountRoleStatus::READY;
+            }
+            break;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return AccountRoleStatus::CREATING;
+            }
+            break;
+          case -1766447722:
+            if (name == "PENDING_DELETION")
+            {
+              return AccountRoleStatus::PENDING_DELETION;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return AccountRoleStatus::DELETING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return AccountRoleStatus::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return AccountRoleStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAccountRoleStatus(AccountRoleStatus enumValue)
+        const char* GetNameForAccountRoleStatusCStr(AccountRoleStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccountRoleStatus::READY:
-            return "READY";
-          case AccountRoleStatus::CREATING:
-            return "CREATING";
-          case AccountRoleStatus::PENDING_DELETION:
-            return "PENDING_DELETION";
-          case AccountRoleStatus::DELETING:
-            return "DELETING";
-          case AccountRoleStatus::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccountRoleStatus(AccountRoleStatus enumValue)
+        {
+          return GetNameForAccountRoleStatusCStr(enumValue);
         }
 
       } // namespace AccountRoleStatusMapper
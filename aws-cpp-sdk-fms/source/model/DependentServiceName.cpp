@@ -30,20 +30,37 @@ namespace Aws
       namespace DependentServiceNameMapper
       {
 
-        static const int AWSCONFIG_HASH = HashingUtils::HashString("AWSCONFIG");
-        static const int AWSWAF_HASH = HashingUtils::HashString("AWSWAF");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AWSCONFIG",
+          "AWSWAF",
+        };
 
         DependentServiceName GetDependentServiceNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWSCONFIG_HASH)
-          {
-            return DependentServiceName::AWSCONFIG;
-          }
-          else if (hashCode == AWSWAF_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DependentServiceName::AWSWAF;
+          case -1872880545:
+            if (name == "AWSCONFIG")
+            {
+              return DependentServiceName::AWSCONFIG;
+            }
+            break;
+          case 1943799487:
+            if (name == "AWSWAF")
+            {
+              return DependentServiceName::AWSWAF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DependentServiceName::NOT_SET;
         }
 
-        Aws::String GetNameForDependentServiceName(DependentServiceName enumValue)
+        const char* GetNameForDependentServiceNameCStr(DependentServiceName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DependentServiceName::AWSCONFIG:
-            return "AWSCONFIG";
-          case DependentServiceName::AWSWAF:
-            return "AWSWAF";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDependentServiceName(DependentServiceName enumValue)
+        {
+          return GetNameForDependentServiceNameCStr(enumValue);
         }
 
       } // namespace DependentServiceNameMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace SecurityServiceTypeMapper
       {
 
-        static const int WAF_HASH = HashingUtils::HashString("WAF");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WAF",
+        };
 
         SecurityServiceType GetSecurityServiceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WAF_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SecurityServiceType::WAF;
+          case 85692:
+            if (name == "WAF")
+            {
+              return SecurityServiceType::WAF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return SecurityServiceType::NOT_SET;
         }
 
-        Aws::String GetNameForSecurityServiceType(SecurityServiceType enumValue)
+        const char* GetNameForSecurityServiceTypeCStr(SecurityServiceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SecurityServiceType::WAF:
-            return "WAF";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSecurityServiceType(SecurityServiceType enumValue)
+        {
+          return GetNameForSecurityServiceTypeCStr(enumValue);
         }
 
       } // namespace SecurityServiceTypeMapper
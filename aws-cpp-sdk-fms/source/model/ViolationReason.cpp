@@ -30,25 +30,44 @@ namespace Aws
       namespace ViolationReasonMapper
       {
 
-        static const int WEB_ACL_MISSING_RULE_GROUP_HASH = HashingUtils::HashString("WEB_ACL_MISSING_RULE_GROUP");
-        static const int RESOURCE_MISSING_WEB_ACL_HASH = HashingUtils::HashString("RESOURCE_MISSING_WEB_ACL");
-        static const int RESOURCE_INCORRECT_WEB_ACL_HASH = HashingUtils::HashString("RESOURCE_INCORRECT_WEB_ACL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WEB_ACL_MISSING_RULE_GROUP",
+          "RESOURCE_MISSING_WEB_ACL",
+          "RESOURCE_INCORRECT_WEB_ACL",
+        };
 
         ViolationReason GetViolationReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WEB_ACL_MISSING_RULE_GROUP_HASH)
-          {
-            return ViolationReason::WEB_ACL_MISSING_RULE_GROUP;
-          }
-          else if (hashCode == RESOURCE_MISSING_WEB_ACL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ViolationReason::RESOURCE_MISSING_WEB_ACL;
-          }
-          else if (hashCode == RESOURCE_INCORRECT_WEB_ACL_HASH)
-          {
-            return ViolationReason::RESOURCE_INCORRECT_WEB_ACL;
+          case 1649436501:
+            if (name == "WEB_ACL_MISSING_RULE_GROUP")
+            {
+              return ViolationReason::WEB_ACL_MISSING_RULE_GROUP;
+            }
+            break;
+          case 739441845:
+            if (name == "RESOURCE_MISSING_WEB_ACL")
+            {
+              return ViolationReason::RESOURCE_MISSING_WEB_ACL;
+            }
+            break;
+          case 227250228:
+            if (name == "RESOURCE_INCORRECT_WEB_ACL")
+            {
+              return ViolationReason::RESOURCE_INCORRECT_WEB_ACL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ViolationReason::NOT_SET;
         }
 
-        Aws::String GetNameForViolationReason(ViolationReason enumValue)
+        const char* GetNameForViolationReasonCStr(ViolationReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ViolationReason::WEB_ACL_MISSING_RULE_GROUP:
-            return "WEB_ACL_MISSING_RULE_GROUP";
-          case ViolationReason::RESOURCE_MISSING_WEB_ACL:
-            return "RESOURCE_MISSING_WEB_ACL";
-          case ViolationReason::RESOURCE_INCORRECT_WEB_ACL:
-            return "RESOURCE_INCORRECT_WEB_ACL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForViolationReason(ViolationReason enumValue)
+        {
+          return GetNameForViolationReasonCStr(enumValue);
         }
 
       } // namespace ViolationReasonMapper
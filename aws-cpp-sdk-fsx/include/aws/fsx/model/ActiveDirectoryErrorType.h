@@ -37,6 +37,11 @@ namespace ActiveDirectoryErrorTypeMapper
 AWS_FSX_API ActiveDirectoryErrorType GetActiveDirectoryErrorTypeForName(const Aws::String& name);
 
 AWS_FSX_API Aws::String GetNameForActiveDirectoryErrorType(ActiveDirectoryErrorType value);
+
+/**
+ * Same as GetNameForActiveDirectoryErrorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FSX_API const char* GetNameForActiveDirectoryErrorTypeCStr(ActiveDirectoryErrorType value);
 } // namespace ActiveDirectoryErrorTypeMapper
 } // namespace Model
 } // namespace FSx
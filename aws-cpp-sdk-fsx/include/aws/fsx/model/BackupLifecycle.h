@@ -37,6 +37,11 @@ namespace BackupLifecycleMapper
 AWS_FSX_API BackupLifecycle GetBackupLifecycleForName(const Aws::String& name);
 
 AWS_FSX_API Aws::String GetNameForBackupLifecycle(BackupLifecycle value);
+
+/**
+ * Same as GetNameForBackupLifecycle(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FSX_API const char* GetNameForBackupLifecycleCStr(BackupLifecycle value);
 } // namespace BackupLifecycleMapper
 } // namespace Model
 } // namespace FSx
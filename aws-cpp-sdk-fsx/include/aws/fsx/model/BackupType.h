@@ -35,6 +35,11 @@ namespace BackupTypeMapper
 AWS_FSX_API BackupType GetBackupTypeForName(const Aws::String& name);
 
 AWS_FSX_API Aws::String GetNameForBackupType(BackupType value);
+
+/**
+ * Same as GetNameForBackupType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FSX_API const char* GetNameForBackupTypeCStr(BackupType value);
 } // namespace BackupTypeMapper
 } // namespace Model
 } // namespace FSx
@@ -37,6 +37,11 @@ namespace FileSystemLifecycleMapper
 AWS_FSX_API FileSystemLifecycle GetFileSystemLifecycleForName(const Aws::String& name);
 
 AWS_FSX_API Aws::String GetNameForFileSystemLifecycle(FileSystemLifecycle value);
+
+/**
+ * Same as GetNameForFileSystemLifecycle(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FSX_API const char* GetNameForFileSystemLifecycleCStr(FileSystemLifecycle value);
 } // namespace FileSystemLifecycleMapper
 } // namespace Model
 } // namespace FSx
@@ -35,6 +35,11 @@ namespace FileSystemMaintenanceOperationMapper
 AWS_FSX_API FileSystemMaintenanceOperation GetFileSystemMaintenanceOperationForName(const Aws::String& name);
 
 AWS_FSX_API Aws::String GetNameForFileSystemMaintenanceOperation(FileSystemMaintenanceOperation value);
+
+/**
+ * Same as GetNameForFileSystemMaintenanceOperation(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FSX_API const char* GetNameForFileSystemMaintenanceOperationCStr(FileSystemMaintenanceOperation value);
 } // namespace FileSystemMaintenanceOperationMapper
 } // namespace Model
 } // namespace FSx
@@ -35,6 +35,11 @@ namespace FileSystemTypeMapper
 AWS_FSX_API FileSystemType GetFileSystemTypeForName(const Aws::String& name);
 
 AWS_FSX_API Aws::String GetNameForFileSystemType(FileSystemType value);
+
+/**
+ * Same as GetNameForFileSystemType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FSX_API const char* GetNameForFileSystemTypeCStr(FileSystemType value);
 } // namespace FileSystemTypeMapper
 } // namespace Model
 } // namespace FSx
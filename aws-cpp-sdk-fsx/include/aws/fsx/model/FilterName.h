@@ -35,6 +35,11 @@ namespace FilterNameMapper
 AWS_FSX_API FilterName GetFilterNameForName(const Aws::String& name);
 
 AWS_FSX_API Aws::String GetNameForFilterName(FilterName value);
+
+/**
+ * Same as GetNameForFilterName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FSX_API const char* GetNameForFilterNameCStr(FilterName value);
 } // namespace FilterNameMapper
 } // namespace Model
 } // namespace FSx
@@ -37,6 +37,11 @@ namespace ServiceLimitMapper
 AWS_FSX_API ServiceLimit GetServiceLimitForName(const Aws::String& name);
 
 AWS_FSX_API Aws::String GetNameForServiceLimit(ServiceLimit value);
+
+/**
+ * Same as GetNameForServiceLimit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_FSX_API const char* GetNameForServiceLimitCStr(ServiceLimit value);
 } // namespace ServiceLimitMapper
 } // namespace Model
 } // namespace FSx
@@ -30,30 +30,51 @@ namespace Aws
       namespace ActiveDirectoryErrorTypeMapper
       {
 
-        static const int DOMAIN_NOT_FOUND_HASH = HashingUtils::HashString("DOMAIN_NOT_FOUND");
-        static const int INCOMPATIBLE_DOMAIN_MODE_HASH = HashingUtils::HashString("INCOMPATIBLE_DOMAIN_MODE");
-        static const int WRONG_VPC_HASH = HashingUtils::HashString("WRONG_VPC");
-        static const int INVALID_DOMAIN_STAGE_HASH = HashingUtils::HashString("INVALID_DOMAIN_STAGE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DOMAIN_NOT_FOUND",
+          "INCOMPATIBLE_DOMAIN_MODE",
+          "WRONG_VPC",
+          "INVALID_DOMAIN_STAGE",
+        };
 
         ActiveDirectoryErrorType GetActiveDirectoryErrorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DOMAIN_NOT_FOUND_HASH)
-          {
-            return ActiveDirectoryErrorType::DOMAIN_NOT_FOUND;
-          }
-          else if (hashCode == INCOMPATIBLE_DOMAIN_MODE_HASH)
-          {
-            return ActiveDirectoryErrorType::INCOMPATIBLE_DOMAIN_MODE;
-          }
-          else if (hashCode == WRONG_VPC_HASH)
-          {
-            return ActiveDirectoryErrorType::WRONG_VPC;
-          }
-          else if (hashCode == INVALID_DOMAIN_STAGE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActiveDirectoryErrorType::INVALID_DOMAIN_STAGE;
+          case -1744519909:
+            if (name == "DOMAIN_NOT_FOUND")
+            {
+              return ActiveDirectoryErrorType::DOMAIN_NOT_FOUND;
+            }
+            break;
+          case 419361464:
+            if (name == "INCOMPATIBLE_DOMAIN_MODE")
+            {
+              return ActiveDirectoryErrorType::INCOMPATIBLE_DOMAIN_MODE;
+            }
+            break;
+          case -2053283049:
+            if (name == "WRONG_VPC")
+            {
+              return ActiveDirectoryErrorType::WRONG_VPC;
+            }
+            break;
+          case -720980725:
+            if (name == "INVALID_DOMAIN_STAGE")
+            {
+              return ActiveDirectoryErrorType::INVALID_DOMAIN_STAGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ActiveDirectoryErrorType::NOT_SET;
         }
 
-        Aws::String GetNameForActiveDirectoryErrorType(ActiveDirectoryErrorType enumValue)
+        const char* GetNameForActiveDirectoryErrorTypeCStr(ActiveDirectoryErrorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActiveDirectoryErrorType::DOMAIN_NOT_FOUND:
-            return "DOMAIN_NOT_FOUND";
-          case ActiveDirectoryErrorType::INCOMPATIBLE_DOMAIN_MODE:
-            return "INCOMPATIBLE_DOMAIN_MODE";
-          case ActiveDirectoryErrorType::WRONG_VPC:
-            return "WRONG_VPC";
-          case ActiveDirectoryErrorType::INVALID_DOMAIN_STAGE:
-            return "INVALID_DOMAIN_STAGE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActiveDirectoryErrorType(ActiveDirectoryErrorType enumValue)
+        {
+          return GetNameForActiveDirectoryErrorTypeCStr(enumValue);
         }
 
       } // namespace ActiveDirectoryErrorTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace BackupLifecycleMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AVAILABLE",
+          "CREATING",
+          "DELETED",
+          "FAILED",
+        };
 
         BackupLifecycle GetBackupLifecycleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
-          {
-            return BackupLifecycle::AVAILABLE;
-          }
-          else if (hashCode == CREATING_HASH)
-          {
-            return BackupLifecycle::CREATING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return BackupLifecycle::DELETED;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BackupLifecycle::FAILED;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return BackupLifecycle::AVAILABLE;
+            }
+            break;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return BackupLifecycle::CREATING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return BackupLifecycle::DELETED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return BackupLifecycle::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return BackupLifecycle::NOT_SET;
         }
 
-        Aws::String GetNameForBackupLifecycle(BackupLifecycle enumValue)
+        const char* GetNameForBackupLifecycleCStr(BackupLifecycle enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BackupLifecycle::AVAILABLE:
-            return "AVAILABLE";
-          case BackupLifecycle::CREATING:
-            return "CREATING";
-          case BackupLifecycle::DELETED:
-            return "DELETED";
-          case BackupLifecycle::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBackupLifecycle(BackupLifecycle enumValue)
+        {
+          return GetNameForBackupLifecycleCStr(enumValue);
         }
 
       } // namespace BackupLifecycleMapper
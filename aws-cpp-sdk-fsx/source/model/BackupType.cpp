@@ -30,20 +30,37 @@ namespace Aws
       namespace BackupTypeMapper
       {
 
-        static const int AUTOMATIC_HASH = HashingUtils::HashString("AUTOMATIC");
-        static const int USER_INITIATED_HASH = HashingUtils::HashString("USER_INITIATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTOMATIC",
+          "USER_INITIATED",
+        };
 
         BackupType GetBackupTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTOMATIC_HASH)
-          {
-            return BackupType::AUTOMATIC;
-          }
-          else if (hashCode == USER_INITIATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BackupType::USER_INITIATED;
+          case 165298699:
+            if (name == "AUTOMATIC")
+            {
+              return BackupType::AUTOMATIC;
+            }
+            break;
+          case 1438887255:
+            if (name == "USER_INITIATED")
+            {
+              return BackupType::USER_INITIATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BackupType::NOT_SET;
         }
 
-        Aws::String GetNameForBackupType(BackupType enumValue)
+        const char* GetNameForBackupTypeCStr(BackupType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BackupType::AUTOMATIC:
-            return "AUTOMATIC";
-          case BackupType::USER_INITIATED:
-            return "USER_INITIATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBackupType(BackupType enumValue)
+        {
+          return GetNameForBackupTypeCStr(enumValue);
         }
 
       } // namespace BackupTypeMapper
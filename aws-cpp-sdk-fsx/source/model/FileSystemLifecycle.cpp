@@ -30,30 +30,51 @@ namespace Aws
       namespace FileSystemLifecycleMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AVAILABLE",
+          "CREATING",
+          "FAILED",
+          "DELETING",
+        };
 
         FileSystemLifecycle GetFileSystemLifecycleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
-          {
-            return FileSystemLifecycle::AVAILABLE;
-          }
-          else if (hashCode == CREATING_HASH)
-          {
-            return FileSystemLifecycle::CREATING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return FileSystemLifecycle::FAILED;
-          }
-          else if (hashCode == DELETING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FileSystemLifecycle::DELETING;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return FileSystemLifecycle::AVAILABLE;
+            }
+            break;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return FileSystemLifecycle::CREATING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return FileSystemLifecycle::FAILED;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return FileSystemLifecycle::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return FileSystemLifecycle::NOT_SET;
         }
 
-        Aws::String GetNameForFileSystemLifecycle(FileSystemLifecycle enumValue)
+        const char* GetNameForFileSystemLifecycleCStr(FileSystemLifecycle enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FileSystemLifecycle::AVAILABLE:
-            return "AVAILABLE";
-          case FileSystemLifecycle::CREATING:
-            return "CREATING";
-          case FileSystemLifecycle::FAILED:
-            return "FAILED";
-          case FileSystemLifecycle::DELETING:
-            return "DELETING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFileSystemLifecycle(FileSystemLifecycle enumValue)
+        {
+          return GetNameForFileSystemLifecycleCStr(enumValue);
         }
 
       } // namespace FileSystemLifecycleMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FileSystemMaintenanceOperationMapper
       {
 
-        static const int PATCHING_HASH = HashingUtils::HashString("PATCHING");
-        static const int BACKING_UP_HASH = HashingUtils::HashString("BACKING_UP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PATCHING",
+          "BACKING_UP",
+        };
 
         FileSystemMaintenanceOperation GetFileSystemMaintenanceOperationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PATCHING_HASH)
-          {
-            return FileSystemMaintenanceOperation::PATCHING;
-          }
-          else if (hashCode == BACKING_UP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FileSystemMaintenanceOperation::BACKING_UP;
+          case 2013012634:
+            if (name == "PATCHING")
+            {
+              return FileSystemMaintenanceOperation::PATCHING;
+            }
+            break;
+          case -793765921:
+            if (name == "BACKING_UP")
+            {
+              return FileSystemMaintenanceOperation::BACKING_UP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FileSystemMaintenanceOperation::NOT_SET;
         }
 
-        Aws::String GetNameForFileSystemMaintenanceOperation(FileSystemMaintenanceOperation enumValue)
+        const char* GetNameForFileSystemMaintenanceOperationCStr(FileSystemMaintenanceOperation enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FileSystemMaintenanceOperation::PATCHING:
-            return "PATCHING";
-          case FileSystemMaintenanceOperation::BACKING_UP:
-            return "BACKING_UP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFileSystemMaintenanceOperation(FileSystemMaintenanceOperation enumValue)
+        {
+          return GetNameForFileSystemMaintenanceOperationCStr(enumValue);
         }
 
       } // namespace FileSystemMaintenanceOperationMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FileSystemTypeMapper
       {
 
-        static const int WINDOWS_HASH = HashingUtils::HashString("WINDOWS");
-        static const int LUSTRE_HASH = HashingUtils::HashString("LUSTRE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WINDOWS",
+          "LUSTRE",
+        };
 
         FileSystemType GetFileSystemTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WINDOWS_HASH)
-          {
-            return FileSystemType::WINDOWS;
-          }
-          else if (hashCode == LUSTRE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FileSystemType::LUSTRE;
+          case 2067476067:
+            if (name == "WINDOWS")
+            {
+              return FileSystemType::WINDOWS;
+            }
+            break;
+          case -2038096547:
+            if (name == "LUSTRE")
+            {
+              return FileSystemType::LUSTRE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FileSystemType::NOT_SET;
         }
 
-        Aws::String GetNameForFileSystemType(FileSystemType enumValue)
+        const char* GetNameForFileSystemTypeCStr(FileSystemType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FileSystemType::WINDOWS:
-            return "WINDOWS";
-          case FileSystemType::LUSTRE:
-            return "LUSTRE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFileSystemType(FileSystemType enumValue)
+        {
+          return GetNameForFileSystemTypeCStr(enumValue);
         }
 
       } // namespace FileSystemTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FilterNameMapper
       {
 
-        static const int file_system_id_HASH = HashingUtils::HashString("file-system-id");
-        static const int backup_type_HASH = HashingUtils::HashString("backup-type");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "file-system-id",
+          "backup-type",
+        };
 
         FilterName GetFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == file_system_id_HASH)
-          {
-            return FilterName::file_system_id;
-          }
-          else if (hashCode == backup_type_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FilterName::backup_type;
+          case 58560104:
+            if (name == "file-system-id")
+            {
+              return FilterName::file_system_id;
+            }
+            break;
+          case 1073579109:
+            if (name == "backup-type")
+            {
+              return FilterName::backup_type;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FilterName::NOT_SET;
         }
 
-        Aws::String GetNameForFilterName(FilterName enumValue)
+        const char* GetNameForFilterNameCStr(FilterName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FilterName::file_system_id:
-            return "file-system-id";
-          case FilterName::backup_type:
-            return "backup-type";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFilterName(FilterName enumValue)
+        {
+          return GetNameForFilterNameCStr(enumValue);
         }
 
       } // namespace FilterNameMapper
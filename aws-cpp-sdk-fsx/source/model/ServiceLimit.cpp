@@ -30,30 +30,51 @@ namespace Aws
       namespace ServiceLimitMapper
       {
 
-        static const int FILE_SYSTEM_COUNT_HASH = HashingUtils::HashString("FILE_SYSTEM_COUNT");
-        static const int TOTAL_THROUGHPUT_CAPACITY_HASH = HashingUtils::HashString("TOTAL_THROUGHPUT_CAPACITY");
-        static const int TOTAL_STORAGE_HASH = HashingUtils::HashString("TOTAL_STORAGE");
-        static const int TOTAL_USER_INITIATED_BACKUPS_HASH = HashingUtils::HashString("TOTAL_USER_INITIATED_BACKUPS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FILE_SYSTEM_COUNT",
+          "TOTAL_THROUGHPUT_CAPACITY",
+          "TOTAL_STORAGE",
+          "TOTAL_USER_INITIATED_BACKUPS",
+        };
 
         ServiceLimit GetServiceLimitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FILE_SYSTEM_COUNT_HASH)
-          {
-            return ServiceLimit::FILE_SYSTEM_COUNT;
-          }
-          else if (hashCode == TOTAL_THROUGHPUT_CAPACITY_HASH)
-          {
-            return ServiceLimit::TOTAL_THROUGHPUT_CAPACITY;
-          }
-          else if (hashCode == TOTAL_STORAGE_HASH)
-          {
-            return ServiceLimit::TOTAL_STORAGE;
-          }
-          else if (hashCode == TOTAL_USER_INITIATED_BACKUPS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServiceLimit::TOTAL_USER_INITIATED_BACKUPS;
+          case 483838146:
+            if (name == "FILE_SYSTEM_COUNT")
+            {
+              return ServiceLimit::FILE_SYSTEM_COUNT;
+            }
+            break;
+          case 1294342548:
+            if (name == "TOTAL_THROUGHPUT_CAPACITY")
+            {
+              return ServiceLimit::TOTAL_THROUGHPUT_CAPACITY;
+            }
+            break;
+          case -807603136:
+            if (name == "TOTAL_STORAGE")
+            {
+              return ServiceLimit::TOTAL_STORAGE;
+            }
+            break;
+          case 1623035748:
+            if (name == "TOTAL_USER_INITIATED_BACKUPS")
+            {
+              return ServiceLimit::TOTAL_USER_INITIATED_BACKUPS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ServiceLimit::NOT_SET;
         }
 
-        Aws::String GetNameForServiceLimit(ServiceLimit enumValue)
+        const char* GetNameForServiceLimitCStr(ServiceLimit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServiceLimit::FILE_SYSTEM_COUNT:
-            return "FILE_SYSTEM_COUNT";
-          case ServiceLimit::TOTAL_THROUGHPUT_CAPACITY:
-            return "TOTAL_THROUGHPUT_CAPACITY";
-          case ServiceLimit::TOTAL_STORAGE:
-            return "TOTAL_STORAGE";
-          case ServiceLimit::TOTAL_USER_INITIATED_BACKUPS:
-            return "TOTAL_USER_INITIATED_BACKUPS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServiceLimit(ServiceLimit enumValue)
+        {
+          return GetNameForServiceLimitCStr(enumValue);
         }
 
       } // namespace ServiceLimitMapper
@@ -35,6 +35,11 @@ namespace AcceptanceTypeMapper
 AWS_GAMELIFT_API AcceptanceType GetAcceptanceTypeForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForAcceptanceType(AcceptanceType value);
+
+/**
+ * Same as GetNameForAcceptanceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForAcceptanceTypeCStr(AcceptanceType value);
 } // namespace AcceptanceTypeMapper
 } // namespace Model
 } // namespace GameLift
@@ -36,6 +36,11 @@ namespace BuildStatusMapper
 AWS_GAMELIFT_API BuildStatus GetBuildStatusForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForBuildStatus(BuildStatus value);
+
+/**
+ * Same as GetNameForBuildStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForBuildStatusCStr(BuildStatus value);
 } // namespace BuildStatusMapper
 } // namespace Model
 } // namespace GameLift
@@ -37,6 +37,11 @@ namespace ComparisonOperatorTypeMapper
 AWS_GAMELIFT_API ComparisonOperatorType GetComparisonOperatorTypeForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForComparisonOperatorType(ComparisonOperatorType value);
+
+/**
+ * Same as GetNameForComparisonOperatorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForComparisonOperatorTypeCStr(ComparisonOperatorType value);
 } // namespace ComparisonOperatorTypeMapper
 } // namespace Model
 } // namespace GameLift
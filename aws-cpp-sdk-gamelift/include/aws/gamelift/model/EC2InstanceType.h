@@ -67,6 +67,11 @@ namespace EC2InstanceTypeMapper
 AWS_GAMELIFT_API EC2InstanceType GetEC2InstanceTypeForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForEC2InstanceType(EC2InstanceType value);
+
+/**
+ * Same as GetNameForEC2InstanceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForEC2InstanceTypeCStr(EC2InstanceType value);
 } // namespace EC2InstanceTypeMapper
 } // namespace Model
 } // namespace GameLift
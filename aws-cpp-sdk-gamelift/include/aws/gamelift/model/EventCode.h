@@ -66,6 +66,11 @@ namespace EventCodeMapper
 AWS_GAMELIFT_API EventCode GetEventCodeForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForEventCode(EventCode value);
+
+/**
+ * Same as GetNameForEventCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForEventCodeCStr(EventCode value);
 } // namespace EventCodeMapper
 } // namespace Model
 } // namespace GameLift
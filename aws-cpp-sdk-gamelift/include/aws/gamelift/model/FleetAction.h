@@ -34,6 +34,11 @@ namespace FleetActionMapper
 AWS_GAMELIFT_API FleetAction GetFleetActionForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForFleetAction(FleetAction value);
+
+/**
+ * Same as GetNameForFleetAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForFleetActionCStr(FleetAction value);
 } // namespace FleetActionMapper
 } // namespace Model
 } // namespace GameLift
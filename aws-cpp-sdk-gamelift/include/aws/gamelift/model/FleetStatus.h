@@ -42,6 +42,11 @@ namespace FleetStatusMapper
 AWS_GAMELIFT_API FleetStatus GetFleetStatusForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForFleetStatus(FleetStatus value);
+
+/**
+ * Same as GetNameForFleetStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForFleetStatusCStr(FleetStatus value);
 } // namespace FleetStatusMapper
 } // namespace Model
 } // namespace GameLift
@@ -37,6 +37,11 @@ namespace GameSessionPlacementStateMapper
 AWS_GAMELIFT_API GameSessionPlacementState GetGameSessionPlacementStateForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForGameSessionPlacementState(GameSessionPlacementState value);
+
+/**
+ * Same as GetNameForGameSessionPlacementState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForGameSessionPlacementStateCStr(GameSessionPlacementState value);
 } // namespace GameSessionPlacementStateMapper
 } // namespace Model
 } // namespace GameLift
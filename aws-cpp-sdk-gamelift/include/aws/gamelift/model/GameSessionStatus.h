@@ -38,6 +38,11 @@ namespace GameSessionStatusMapper
 AWS_GAMELIFT_API GameSessionStatus GetGameSessionStatusForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForGameSessionStatus(GameSessionStatus value);
+
+/**
+ * Same as GetNameForGameSessionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForGameSessionStatusCStr(GameSessionStatus value);
 } // namespace GameSessionStatusMapper
 } // namespace Model
 } // namespace GameLift
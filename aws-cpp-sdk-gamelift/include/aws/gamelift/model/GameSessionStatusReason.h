@@ -34,6 +34,11 @@ namespace GameSessionStatusReasonMapper
 AWS_GAMELIFT_API GameSessionStatusReason GetGameSessionStatusReasonForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForGameSessionStatusReason(GameSessionStatusReason value);
+
+/**
+ * Same as GetNameForGameSessionStatusReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForGameSessionStatusReasonCStr(GameSessionStatusReason value);
 } // namespace GameSessionStatusReasonMapper
 } // namespace Model
 } // namespace GameLift
@@ -35,6 +35,11 @@ namespace IpProtocolMapper
 AWS_GAMELIFT_API IpProtocol GetIpProtocolForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForIpProtocol(IpProtocol value);
+
+/**
+ * Same as GetNameForIpProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForIpProtocolCStr(IpProtocol value);
 } // namespace IpProtocolMapper
 } // namespace Model
 } // namespace GameLift
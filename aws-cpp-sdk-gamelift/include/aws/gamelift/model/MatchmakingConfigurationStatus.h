@@ -41,6 +41,11 @@ namespace MatchmakingConfigurationStatusMapper
 AWS_GAMELIFT_API MatchmakingConfigurationStatus GetMatchmakingConfigurationStatusForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForMatchmakingConfigurationStatus(MatchmakingConfigurationStatus value);
+
+/**
+ * Same as GetNameForMatchmakingConfigurationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForMatchmakingConfigurationStatusCStr(MatchmakingConfigurationStatus value);
 } // namespace MatchmakingConfigurationStatusMapper
 } // namespace Model
 } // namespace GameLift
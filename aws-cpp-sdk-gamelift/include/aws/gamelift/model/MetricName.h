@@ -44,6 +44,11 @@ namespace MetricNameMapper
 AWS_GAMELIFT_API MetricName GetMetricNameForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForMetricName(MetricName value);
+
+/**
+ * Same as GetNameForMetricName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForMetricNameCStr(MetricName value);
 } // namespace MetricNameMapper
 } // namespace Model
 } // namespace GameLift
@@ -35,6 +35,11 @@ namespace PlayerSessionCreationPolicyMapper
 AWS_GAMELIFT_API PlayerSessionCreationPolicy GetPlayerSessionCreationPolicyForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForPlayerSessionCreationPolicy(PlayerSessionCreationPolicy value);
+
+/**
+ * Same as GetNameForPlayerSessionCreationPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForPlayerSessionCreationPolicyCStr(PlayerSessionCreationPolicy value);
 } // namespace PlayerSessionCreationPolicyMapper
 } // namespace Model
 } // namespace GameLift
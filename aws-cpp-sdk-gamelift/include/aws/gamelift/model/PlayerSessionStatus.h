@@ -37,6 +37,11 @@ namespace PlayerSessionStatusMapper
 AWS_GAMELIFT_API PlayerSessionStatus GetPlayerSessionStatusForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForPlayerSessionStatus(PlayerSessionStatus value);
+
+/**
+ * Same as GetNameForPlayerSessionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForPlayerSessionStatusCStr(PlayerSessionStatus value);
 } // namespace PlayerSessionStatusMapper
 } // namespace Model
 } // namespace GameLift
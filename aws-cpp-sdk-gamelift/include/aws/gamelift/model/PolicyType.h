@@ -35,6 +35,11 @@ namespace PolicyTypeMapper
 AWS_GAMELIFT_API PolicyType GetPolicyTypeForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForPolicyType(PolicyType value);
+
+/**
+ * Same as GetNameForPolicyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForPolicyTypeCStr(PolicyType value);
 } // namespace PolicyTypeMapper
 } // namespace Model
 } // namespace GameLift
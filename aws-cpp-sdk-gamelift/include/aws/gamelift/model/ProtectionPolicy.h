@@ -35,6 +35,11 @@ namespace ProtectionPolicyMapper
 AWS_GAMELIFT_API ProtectionPolicy GetProtectionPolicyForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForProtectionPolicy(ProtectionPolicy value);
+
+/**
+ * Same as GetNameForProtectionPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForProtectionPolicyCStr(ProtectionPolicy value);
 } // namespace ProtectionPolicyMapper
 } // namespace Model
 } // namespace GameLift
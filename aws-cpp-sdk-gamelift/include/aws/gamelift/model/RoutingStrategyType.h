@@ -35,6 +35,11 @@ namespace RoutingStrategyTypeMapper
 AWS_GAMELIFT_API RoutingStrategyType GetRoutingStrategyTypeForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForRoutingStrategyType(RoutingStrategyType value);
+
+/**
+ * Same as GetNameForRoutingStrategyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForRoutingStrategyTypeCStr(RoutingStrategyType value);
 } // namespace RoutingStrategyTypeMapper
 } // namespace Model
 } // namespace GameLift
@@ -36,6 +36,11 @@ namespace ScalingAdjustmentTypeMapper
 AWS_GAMELIFT_API ScalingAdjustmentType GetScalingAdjustmentTypeForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForScalingAdjustmentType(ScalingAdjustmentType value);
+
+/**
+ * Same as GetNameForScalingAdjustmentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForScalingAdjustmentTypeCStr(ScalingAdjustmentType value);
 } // namespace ScalingAdjustmentTypeMapper
 } // namespace Model
 } // namespace GameLift
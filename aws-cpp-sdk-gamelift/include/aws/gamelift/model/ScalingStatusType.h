@@ -40,6 +40,11 @@ namespace ScalingStatusTypeMapper
 AWS_GAMELIFT_API ScalingStatusType GetScalingStatusTypeForName(const Aws::String& name);
 
 AWS_GAMELIFT_API Aws::String GetNameForScalingStatusType(ScalingStatusType value);
+
+/**
+ * Same as GetNameForScalingStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GAMELIFT_API const char* GetNameForScalingStatusTypeCStr(ScalingStatusType value);
 } // namespace ScalingStatusTypeMapper
 } // namespace Model
 } // namespace GameLift
@@ -30,20 +30,37 @@ namespace Aws
       namespace AcceptanceTypeMapper
       {
 
-        static const int ACCEPT_HASH = HashingUtils::HashString("ACCEPT");
-        static const int REJECT_HASH = HashingUtils::HashString("REJECT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCEPT",
+          "REJECT",
+        };
 
         AcceptanceType GetAcceptanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCEPT_HASH)
-          {
-            return AcceptanceType::ACCEPT;
-          }
-          else if (hashCode == REJECT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AcceptanceType::REJECT;
+          case 1924835592:
+            if (name == "ACCEPT")
+            {
+              return AcceptanceType::ACCEPT;
+            }
+            break;
+          case -1881380961:
+            if (name == "REJECT")
+            {
+              return AcceptanceType::REJECT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AcceptanceType::NOT_SET;
         }
 
-        Aws::String GetNameForAcceptanceType(AcceptanceType enumValue)
+        const char* GetNameForAcceptanceTypeCStr(AcceptanceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AcceptanceType::ACCEPT:
-            return "ACCEPT";
-          case AcceptanceType::REJECT:
-            return "REJECT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAcceptanceType(AcceptanceType enumValue)
+        {
+          return GetNameForAcceptanceTypeCStr(enumValue);
         }
 
       } // namespace AcceptanceTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace BuildStatusMapper
       {
 
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INITIALIZED",
+          "READY",
+          "FAILED",
+        };
 
         BuildStatus GetBuildStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZED_HASH)
-          {
-            return BuildStatus::INITIALIZED;
-          }
-          else if (hashCode == READY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BuildStatus::READY;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return BuildStatus::FAILED;
+          case -907986252:
+            if (name == "INITIALIZED")
+            {
+              return BuildStatus::INITIALIZED;
+            }
+            break;
+          case 77848963:
+            if (name == "READY")
+            {
+              return BuildStatus::READY;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return BuildStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return BuildStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBuildStatus(BuildStatus enumValue)
+        const char* GetNameForBuildStatusCStr(BuildStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BuildStatus::INITIALIZED:
-            return "INITIALIZED";
-          case BuildStatus::READY:
-            return "READY";
-          case BuildStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBuildStatus(BuildStatus enumValue)
+        {
+          return GetNameForBuildStatusCStr(enumValue);
         }
 
       } // namespace BuildStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ComparisonOperatorTypeMapper
       {
 
-        static const int GreaterThanOrEqualToThreshold_HASH = HashingUtils::HashString("GreaterThanOrEqualToThreshold");
-        static const int GreaterThanThreshold_HASH = HashingUtils::HashString("GreaterThanThreshold");
-        static const int LessThanThreshold_HASH = HashingUtils::HashString("LessThanThreshold");
-        static const int LessThanOrEqualToThreshold_HASH = HashingUtils::HashString("LessThanOrEqualToThreshold");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GreaterThanOrEqualToThreshold",
+          "GreaterThanThreshold",
+          "LessThanThreshold",
+          "LessThanOrEqualToThreshold",
+        };
 
         ComparisonOperatorType GetComparisonOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GreaterThanOrEqualToThreshold_HASH)
-          {
-            return ComparisonOperatorType::GreaterThanOrEqualToThreshold;
-          }
-          else if (hashCode == GreaterThanThreshold_HASH)
-          {
-            return ComparisonOperatorType::GreaterThanThreshold;
-          }
-          else if (hashCode == LessThanThreshold_HASH)
-          {
-            return ComparisonOperatorType::LessThanThreshold;
-          }
-          else if (hashCode == LessThanOrEqualToThreshold_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComparisonOperatorType::LessThanOrEqualToThreshold;
+          case -1967855526:
+            if (name == "GreaterThanOrEqualToThreshold")
+            {
+              return ComparisonOperatorType::GreaterThanOrEqualToThreshold;
+            }
+            break;
+          case 281950736:
+            if (name == "GreaterThanThreshold")
+            {
+              return ComparisonOperatorType::GreaterThanThreshold;
+            }
+            break;
+          case -1512019311:
+            if (name == "LessThanThreshold")
+            {
+              return ComparisonOperatorType::LessThanThreshold;
+            }
+            break;
+          case 1746581753:
+            if (name == "LessThanOrEqualToThreshold")
+            {
+              return ComparisonOperatorType::LessThanOrEqualToThreshold;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ComparisonOperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperatorType(ComparisonOperatorType enumValue)
+        const char* GetNameForComparisonOperatorTypeCStr(ComparisonOperatorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComparisonOperatorType::GreaterThanOrEqualToThreshold:
-            return "GreaterThanOrEqualToThreshold";
-          case ComparisonOperatorType::GreaterThanThreshold:
-            return "GreaterThanThreshold";
-          case ComparisonOperatorType::LessThanThreshold:
-            return "LessThanThreshold";
-          case ComparisonOperatorType::LessThanOrEqualToThreshold:
-            return "LessThanOrEqualToThreshold";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComparisonOperatorType(ComparisonOperatorType enumValue)
+        {
+          return GetNameForComparisonOperatorTypeCStr(enumValue);
         }
 
       } // namespace ComparisonOperatorTypeMapper
@@ -30,180 +30,261 @@ namespace Aws
       namespace EC2InstanceTypeMapper
       {
 
-        static const int t2_micro_HASH = HashingUtils::HashString("t2.micro");
-        static const int t2_small_HASH = HashingUtils::HashString("t2.small");
-        static const int t2_medium_HASH = HashingUtils::HashString("t2.medium");
-        static const int t2_large_HASH = HashingUtils::HashString("t2.large");
-        static const int c3_large_HASH = HashingUtils::HashString("c3.large");
-        static const int c3_xlarge_HASH = HashingUtils::HashString("c3.xlarge");
-        static const int c3_2xlarge_HASH = HashingUtils::HashString("c3.2xlarge");
-        static const int c3_4xlarge_HASH = HashingUtils::HashString("c3.4xlarge");
-        static const int c3_8xlarge_HASH = HashingUtils::HashString("c3.8xlarge");
-        static const int c4_large_HASH = HashingUtils::HashString("c4.large");
-        static const int c4_xlarge_HASH = HashingUtils::HashString("c4.xlarge");
-        static const int c4_2xlarge_HASH = HashingUtils::HashString("c4.2xlarge");
-        static const int c4_4xlarge_HASH = HashingUtils::HashString("c4.4xlarge");
-        static const int c4_8xlarge_HASH = HashingUtils::HashString("c4.8xlarge");
-        static const int r3_large_HASH = HashingUtils::HashString("r3.large");
-        static const int r3_xlarge_HASH = HashingUtils::HashString("r3.xlarge");
-        static const int r3_2xlarge_HASH = HashingUtils::HashString("r3.2xlarge");
-        static const int r3_4xlarge_HASH = HashingUtils::HashString("r3.4xlarge");
-        static const int r3_8xlarge_HASH = HashingUtils::HashString("r3.8xlarge");
-        static const int r4_large_HASH = HashingUtils::HashString("r4.large");
-        static const int r4_xlarge_HASH = HashingUtils::HashString("r4.xlarge");
-        static const int r4_2xlarge_HASH = HashingUtils::HashString("r4.2xlarge");
-        static const int r4_4xlarge_HASH = HashingUtils::HashString("r4.4xlarge");
-        static const int r4_8xlarge_HASH = HashingUtils::HashString("r4.8xlarge");
-        static const int r4_16xlarge_HASH = HashingUtils::HashString("r4.16xlarge");
-        static const int m3_medium_HASH = HashingUtils::HashString("m3.medium");
-        static const int m3_large_HASH = HashingUtils::HashString("m3.large");
-        static const int m3_xlarge_HASH = HashingUtils::HashString("m3.xlarge");
-        static const int m3_2xlarge_HASH = HashingUtils::HashString("m3.2xlarge");
-        static const int m4_large_HASH = HashingUtils::HashString("m4.large");
-        static const int m4_xlarge_HASH = HashingUtils::HashString("m4.xlarge");
-        static const int m4_2xlarge_HASH = HashingUtils::HashString("m4.2xlarge");
-        static const int m4_4xlarge_HASH = HashingUtils::HashString("m4.4xlarge");
-        static const int m4_10xlarge_HASH = HashingUtils::HashString("m4.10xlarge");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "t2.micro",
+          "t2.small",
+          "t2.medium",
+          "t2.large",
+          "c3.large",
+          "c3.xlarge",
+          "c3.2xlarge",
+          "c3.4xlarge",
+          "c3.8xlarge",
+          "c4.large",
+          "c4.xlarge",
+          "c4.2xlarge",
+          "c4.4xlarge",
+          "c4.8xlarge",
+          "r3.large",
+          "r3.xlarge",
+          "r3.2xlarge",
+          "r3.4xlarge",
+          "r3.8xlarge",
+          "r4.large",
+          "r4.xlarge",
+          "r4.2xlarge",
+          "r4.4xlarge",
+          "r4.8xlarge",
+          "r4.16xlarge",
+          "m3.medium",
+          "m3.large",
+          "m3.xlarge",
+          "m3.2xlarge",
+          "m4.large",
+          "m4.xlarge",
+          "m4.2xlarge",
+          "m4.4xlarge",
+          "m4.10xlarge",
+        };
 
         EC2InstanceType GetEC2InstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == t2_micro_HASH)
-          {
-            return EC2InstanceType::t2_micro;
-          }
-          else if (hashCode == t2_small_HASH)
-          {
-            return EC2InstanceType::t2_small;
-          }
-          else if (hashCode == t2_medium_HASH)
-          {
-            return EC2InstanceType::t2_medium;
-          }
-          else if (hashCode == t2_large_HASH)
-          {
-            return EC2InstanceType::t2_large;
-          }
-          else if (hashCode == c3_large_HASH)
-          {
-            return EC2InstanceType::c3_large;
-          }
-          else if (hashCode == c3_xlarge_HASH)
-          {
-            return EC2InstanceType::c3_xlarge;
-          }
-          else if (hashCode == c3_2xlarge_HASH)
-          {
-            return EC2InstanceType::c3_2xlarge;
-          }
-          else if (hashCode == c3_4xlarge_HASH)
-          {
-            return EC2InstanceType::c3_4xlarge;
-          }
-          else if (hashCode == c3_8xlarge_HASH)
-          {
-            return EC2InstanceType::c3_8xlarge;
-          }
-          else if (hashCode == c4_large_HASH)
-          {
-            return EC2InstanceType::c4_large;
-          }
-          else if (hashCode == c4_xlarge_HASH)
-          {
-            return EC2InstanceType::c4_xlarge;
-          }
-          else if (hashCode == c4_2xlarge_HASH)
-          {
-            return EC2InstanceType::c4_2xlarge;
-          }
-          else if (hashCode == c4_4xlarge_HASH)
-          {
-            return EC2InstanceType::c4_4xlarge;
-          }
-          else if (hashCode == c4_8xlarge_HASH)
-          {
-            return EC2InstanceType::c4_8xlarge;
-          }
-          else if (hashCode == r3_large_HASH)
-          {
-            return EC2InstanceType::r3_large;
-          }
-          else if (hashCode == r3_xlarge_HASH)
-          {
-            return EC2InstanceType::r3_xlarge;
-          }
-          else if (hashCode == r3_2xlarge_HASH)
-          {
-            return EC2InstanceType::r3_2xlarge;
-          }
-          else if (hashCode == r3_4xlarge_HASH)
-          {
-            return EC2InstanceType::r3_4xlarge;
-          }
-          else if (hashCode == r3_8xlarge_HASH)
-          {
-            return EC2InstanceType::r3_8xlarge;
-          }
-          else if (hashCode == r4_large_HASH)
-          {
-            return EC2InstanceType::r4_large;
-          }
-          else if (hashCode == r4_xlarge_HASH)
-          {
-            return EC2InstanceType::r4_xlarge;
-          }
-          else if (hashCode == r4_2xlarge_HASH)
-          {
-            return EC2InstanceType::r4_2xlarge;
-          }
-          else if (hashCode == r4_4xlarge_HASH)
-          {
-            return EC2InstanceType::r4_4xlarge;
-          }
-          else if (hashCode == r4_8xlarge_HASH)
-          {
-            return EC2InstanceType::r4_8xlarge;
-          }
-          else if (hashCode == r4_16xlarge_HASH)
-          {
-            return EC2InstanceType::r4_16xlarge;
-          }
-          else if (hashCode == m3_medium_HASH)
-          {
-            return EC2InstanceType::m3_medium;
-          }
-          else if (hashCode == m3_large_HASH)
-          {
-            return EC2InstanceType::m3_large;
-          }
-          else if (hashCode == m3_xlarge_HASH)
-          {
-            return EC2InstanceType::m3_xlarge;
-          }
-          else if (hashCode == m3_2xlarge_HASH)
-          {
-            return EC2InstanceType::m3_2xlarge;
-          }
-          else if (hashCode == m4_large_HASH)
-          {
-            return EC2InstanceType::m4_large;
-          }
-          else if (hashCode == m4_xlarge_HASH)
-          {
-            return EC2InstanceType::m4_xlarge;
-          }
-          else if (hashCode == m4_2xlarge_HASH)
-          {
-            return EC2InstanceType::m4_2xlarge;
-          }
-          else if (hashCode == m4_4xlarge_HASH)
-          {
-            return EC2InstanceType::m4_4xlarge;
-          }
-          else if (hashCode == m4_10xlarge_HASH)
-          {
-            return EC2InstanceType::m4_10xlarge;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1146088684:
+            if (name == "t2.micro")
+            {
+              return EC2InstanceType::t2_micro;
+            }
+            break;
+          case -1140430505:
+            if (name == "t2.small")
+            {
+              return EC2InstanceType::t2_small;
+            }
+            break;
+          case -1172683483:
+            if (name == "t2.medium")
+            {
+              return EC2InstanceType::t2_medium;
+            }
+            break;
+          case -1147236469:
+            if (name == "t2.large")
+            {
+              return EC2InstanceType::t2_large;
+            }
+            break;
+          case 177262589:
+            if (name == "c3.large")
+            {
+              return EC2InstanceType::c3_large;
+            }
+            break;
+          case 1553385793:
+            if (name == "c3.xlarge")
+            {
+              return EC2InstanceType::c3_xlarge;
+            }
+            break;
+          case -732183369:
+            if (name == "c3.2xlarge")
+            {
+              return EC2InstanceType::c3_2xlarge;
+            }
+            break;
+          case 1042823993:
+            if (name == "c3.4xlarge")
+            {
+              return EC2InstanceType::c3_4xlarge;
+            }
+            break;
+          case 297871421:
+            if (name == "c3.8xlarge")
+            {
+              return EC2InstanceType::c3_8xlarge;
+            }
+            break;
+          case 1064766270:
+            if (name == "c4.large")
+            {
+              return EC2InstanceType::c4_large;
+            }
+            break;
+          case -998771168:
+            if (name == "c4.xlarge")
+            {
+              return EC2InstanceType::c4_xlarge;
+            }
+            break;
+          case 1755329464:
+            if (name == "c4.2xlarge")
+            {
+              return EC2InstanceType::c4_2xlarge;
+            }
+            break;
+          case -764630470:
+            if (name == "c4.4xlarge")
+            {
+              return EC2InstanceType::c4_4xlarge;
+            }
+            break;
+          case -1509583042:
+            if (name == "c4.8xlarge")
+            {
+              return EC2InstanceType::c4_8xlarge;
+            }
+            break;
+          case 549613838:
+            if (name == "r3.large")
+            {
+              return EC2InstanceType::r3_large;
+            }
+            break;
+          case 211372624:
+            if (name == "r3.xlarge")
+            {
+              return EC2InstanceType::r3_xlarge;
+            }
+            break;
+          case 615081352:
+            if (name == "r3.2xlarge")
+            {
+              return EC2InstanceType::r3_2xlarge;
+            }
+            break;
+          case -1904878582:
+            if (name == "r3.4xlarge")
+            {
+              return EC2InstanceType::r3_4xlarge;
+            }
+            break;
+          case 1645136142:
+            if (name == "r3.8xlarge")
+            {
+              return EC2InstanceType::r3_8xlarge;
+            }
+            break;
+          case 1437117519:
+            if (name == "r4.large")
+            {
+              return EC2InstanceType::r4_large;
+            }
+            break;
+          case 1954182959:
+            if (name == "r4.xlarge")
+            {
+              return EC2InstanceType::r4_xlarge;
+            }
+            break;
+          case -1192373111:
+            if (name == "r4.2xlarge")
+            {
+              return EC2InstanceType::r4_2xlarge;
+            }
+            break;
+          case 582634251:
+            if (name == "r4.4xlarge")
+            {
+              return EC2InstanceType::r4_4xlarge;
+            }
+            break;
+          case -162318321:
+            if (name == "r4.8xlarge")
+            {
+              return EC2InstanceType::r4_8xlarge;
+            }
+            break;
+          case 1855840916:
+            if (name == "r4.16xlarge")
+            {
+              return EC2InstanceType::r4_16xlarge;
+            }
+            break;
+          case 337406205:
+            if (name == "m3.medium")
+            {
+              return EC2InstanceType::m3_medium;
+            }
+            break;
+          case 425496755:
+            if (name == "m3.large")
+            {
+              return EC2InstanceType::m3_large;
+            }
+            break;
+          case 658710347:
+            if (name == "m3.xlarge")
+            {
+              return EC2InstanceType::m3_xlarge;
+            }
+            break;
+          case 1597648877:
+            if (name == "m3.2xlarge")
+            {
+              return EC2InstanceType::m3_2xlarge;
+            }
+            break;
+          case 1313000436:
+            if (name == "m4.large")
+            {
+              return EC2InstanceType::m4_large;
+            }
+            break;
+          case -1893446614:
+            if (name == "m4.xlarge")
+            {
+              return EC2InstanceType::m4_xlarge;
+            }
+            break;
+          case -209805586:
+            if (name == "m4.2xlarge")
+            {
+              return EC2InstanceType::m4_2xlarge;
+            }
+            break;
+          case 1565201776:
+            if (name == "m4.4xlarge")
+            {
+              return EC2InstanceType::m4_4xlarge;
+            }
+            break;
+          case 1220608329:
+            if (name == "m4.10xlarge")
+            {
+              return EC2InstanceType::m4_10xlarge;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -215,87 +296,26 @@ namespace Aws
           return EC2InstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForEC2InstanceType(EC2InstanceType enumValue)
+        const char* GetNameForEC2InstanceTypeCStr(EC2InstanceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EC2InstanceType::t2_micro:
-            return "t2.micro";
-          case EC2InstanceType::t2_small:
-            return "t2.small";
-          case EC2InstanceType::t2_medium:
-            return "t2.medium";
-          case EC2InstanceType::t2_large:
-            return "t2.large";
-          case EC2InstanceType::c3_large:
-            return "c3.large";
-          case EC2InstanceType::c3_xlarge:
-            return "c3.xlarge";
-          case EC2InstanceType::c3_2xlarge:
-            return "c3.2xlarge";
-          case EC2InstanceType::c3_4xlarge:
-            return "c3.4xlarge";
-          case EC2InstanceType::c3_8xlarge:
-            return "c3.8xlarge";
-          case EC2InstanceType::c4_large:
-            return "c4.large";
-          case EC2InstanceType::c4_xlarge:
-            return "c4.xlarge";
-          case EC2InstanceType::c4_2xlarge:
-            return "c4.2xlarge";
-          case EC2InstanceType::c4_4xlarge:
-            return "c4.4xlarge";
-          case EC2InstanceType::c4_8xlarge:
-            return "c4.8xlarge";
-          case EC2InstanceType::r3_large:
-            return "r3.large";
-          case EC2InstanceType::r3_xlarge:
-            return "r3.xlarge";
-          case EC2InstanceType::r3_2xlarge:
-            return "r3.2xlarge";
-          case EC2InstanceType::r3_4xlarge:
-            return "r3.4xlarge";
-          case EC2InstanceType::r3_8xlarge:
-            return "r3.8xlarge";
-          case EC2InstanceType::r4_large:
-            return "r4.large";
-          case EC2InstanceType::r4_xlarge:
-            return "r4.xlarge";
-          case EC2InstanceType::r4_2xlarge:
-            return "r4.2xlarge";
-          case EC2InstanceType::r4_4xlarge:
-            return "r4.4xlarge";
-          case EC2InstanceType::r4_8xlarge:
-            return "r4.8xlarge";
-          case EC2InstanceType::r4_16xlarge:
-            return "r4.16xlarge";
-          case EC2InstanceType::m3_medium:
-            return "m3.medium";
-          case EC2InstanceType::m3_large:
-            return "m3.large";
-          case EC2InstanceType::m3_xlarge:
-            return "m3.xlarge";
-          case EC2InstanceType::m3_2xlarge:
-            return "m3.2xlarge";
-          case EC2InstanceType::m4_large:
-            return "m4.large";
-          case EC2InstanceType::m4_xlarge:
-            return "m4.xlarge";
-          case EC2InstanceType::m4_2xlarge:
-            return "m4.2xlarge";
-          case EC2InstanceType::m4_4xlarge:
-            return "m4.4xlarge";
-          case EC2InstanceType::m4_10xlarge:
-            return "m4.10xlarge";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEC2InstanceType(EC2InstanceType enumValue)
+        {
+          return GetNameForEC2InstanceTypeCStr(enumValue);
         }
 
       } // namespace EC2InstanceTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace FleetActionMapper
       {
 
-        static const int AUTO_SCALING_HASH = HashingUtils::HashString("AUTO_SCALING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTO_SCALING",
+        };
 
         FleetAction GetFleetActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_SCALING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetAction::AUTO_SCALING;
+          case 1988289751:
+            if (name == "AUTO_SCALING")
+            {
+              return FleetAction::AUTO_SCALING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return FleetAction::NOT_SET;
         }
 
-        Aws::String GetNameForFleetAction(FleetAction enumValue)
+        const char* GetNameForFleetActionCStr(FleetAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetAction::AUTO_SCALING:
-            return "AUTO_SCALING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetAction(FleetAction enumValue)
+        {
+          return GetNameForFleetActionCStr(enumValue);
         }
 
       } // namespace FleetActionMapper
@@ -30,55 +30,86 @@ namespace Aws
       namespace FleetStatusMapper
       {
 
-        static const int NEW__HASH = HashingUtils::HashString("NEW");
-        static const int DOWNLOADING_HASH = HashingUtils::HashString("DOWNLOADING");
-        static const int VALIDATING_HASH = HashingUtils::HashString("VALIDATING");
-        static const int BUILDING_HASH = HashingUtils::HashString("BUILDING");
-        static const int ACTIVATING_HASH = HashingUtils::HashString("ACTIVATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NEW",
+          "DOWNLOADING",
+          "VALIDATING",
+          "BUILDING",
+          "ACTIVATING",
+          "ACTIVE",
+          "DELETING",
+          "ERROR",
+          "TERMINATED",
+        };
 
         FleetStatus GetFleetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NEW__HASH)
-          {
-            return FleetStatus::NEW_;
-          }
-          else if (hashCode == DOWNLOADING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FleetStatus::DOWNLOADING;
-          }
-          else if (hashCode == VALIDATING_HASH)
-          {
-            return FleetStatus::VALIDATING;
-          }
-          else if (hashCode == BUILDING_HASH)
-          {
-            return FleetStatus::BUILDING;
-          }
-          else if (hashCode == ACTIVATING_HASH)
-          {
-            return FleetStatus::ACTIVATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return FleetStatus::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return FleetStatus::DELETING;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return FleetStatus::ERROR_;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return FleetStatus::TERMINATED;
+          case 77184:
+            if (name == "NEW")
+            {
+              return FleetStatus::NEW_;
+            }
+            break;
+          case 941831738:
+            if (name == "DOWNLOADING")
+            {
+              return FleetStatus::DOWNLOADING;
+            }
+            break;
+          case 441529427:
+            if (name == "VALIDATING")
+            {
+              return FleetStatus::VALIDATING;
+            }
+            break;
+          case -648019276:
+            if (name == "BUILDING")
+            {
+              return FleetStatus::BUILDING;
+            }
+            break;
+          case -1768657680:
+            if (name == "ACTIVATING")
+            {
+              return FleetStatus::ACTIVATING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return FleetStatus::ACTIVE;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return FleetStatus::DELETING;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return FleetStatus::ERROR_;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return FleetStatus::TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return FleetStatus::NOT_SET;
         }
 
-        Aws::String GetNameForFleetStatus(FleetStatus enumValue)
+        const char* GetNameForFleetStatusCStr(FleetStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FleetStatus::NEW_:
-            return "NEW";
-          case FleetStatus::DOWNLOADING:
-            return "DOWNLOADING";
-          case FleetStatus::VALIDATING:
-            return "VALIDATING";
-          case FleetStatus::BUILDING:
-            return "BUILDING";
-          case FleetStatus::ACTIVATING:
-            return "ACTIVATING";
-          case FleetStatus::ACTIVE:
-            return "ACTIVE";
-          case FleetStatus::DELETING:
-            return "DELETING";
-          case FleetStatus::ERROR_:
-            return "ERROR";
-          case FleetStatus::TERMINATED:
-            return "TERMINATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFleetStatus(FleetStatus enumValue)
+        {
+          return GetNameForFleetStatusCStr(enumValue);
         }
 
       } // namespace FleetStatusMapper
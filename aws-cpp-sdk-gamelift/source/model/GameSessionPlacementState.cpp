@@ -30,30 +30,51 @@ namespace Aws
       namespace GameSessionPlacementStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int FULFILLED_HASH = HashingUtils::HashString("FULFILLED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "FULFILLED",
+          "CANCELLED",
+          "TIMED_OUT",
+        };
 
         GameSessionPlacementState GetGameSessionPlacementStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return GameSessionPlacementState::PENDING;
-          }
-          else if (hashCode == FULFILLED_HASH)
-          {
-            return GameSessionPlacementState::FULFILLED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return GameSessionPlacementState::CANCELLED;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GameSessionPlacementState::TIMED_OUT;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return GameSessionPlacementState::PENDING;
+            }
+            break;
+          case 946829567:
+            if (name == "FULFILLED")
+            {
+              return GameSessionPlacementState::FULFILLED;
+            }
+            break;
+          case -1031784143:
+            if (name == "CANCELLED")
+            {
+              return GameSessionPlacementState::CANCELLED;
+            }
+            break;
+          case -1466757626:
+            if (name == "TIMED_OUT")
+            {
+              return GameSessionPlacementState::TIMED_OUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return GameSessionPlacementState::NOT_SET;
         }
 
-        Aws::String GetNameForGameSessionPlacementState(GameSessionPlacementState enumValue)
+        const char* GetNameForGameSessionPlacementStateCStr(GameSessionPlacementState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GameSessionPlacementState::PENDING:
-            return "PENDING";
-          case GameSessionPlacementState::FULFILLED:
-            return "FULFILLED";
-          case GameSessionPlacementState::CANCELLED:
-            return "CANCELLED";
-          case GameSessionPlacementState::TIMED_OUT:
-            return "TIMED_OUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGameSessionPlacementState(GameSessionPlacementState enumValue)
+        {
+          return GetNameForGameSessionPlacementStateCStr(enumValue);
         }
 
       } // namespace GameSessionPlacementStateMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace GameSessionStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int ACTIVATING_HASH = HashingUtils::HashString("ACTIVATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "ACTIVATING",
+          "TERMINATED",
+          "TERMINATING",
+          "ERROR",
+        };
 
         GameSessionStatus GetGameSessionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GameSessionStatus::ACTIVE;
-          }
-          else if (hashCode == ACTIVATING_HASH)
-          {
-            return GameSessionStatus::ACTIVATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return GameSessionStatus::TERMINATED;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return GameSessionStatus::TERMINATING;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return GameSessionStatus::ERROR_;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return GameSessionStatus::ACTIVE;
+            }
+            break;
+          case -1768657680:
+            if (name == "ACTIVATING")
+            {
+              return GameSessionStatus::ACTIVATING;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return GameSessionStatus::TERMINATED;
+            }
+            break;
+          case 234379966:
+            if (name == "TERMINATING")
+            {
+              return GameSessionStatus::TERMINATING;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return GameSessionStatus::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return GameSessionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForGameSessionStatus(GameSessionStatus enumValue)
+        const char* GetNameForGameSessionStatusCStr(GameSessionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GameSessionStatus::ACTIVE:
-            return "ACTIVE";
-          case GameSessionStatus::ACTIVATING:
-            return "ACTIVATING";
-          case GameSessionStatus::TERMINATED:
-            return "TERMINATED";
-          case GameSessionStatus::TERMINATING:
-            return "TERMINATING";
-          case GameSessionStatus::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGameSessionStatus(GameSessionStatus enumValue)
+        {
+          return GetNameForGameSessionStatusCStr(enumValue);
         }
 
       } // namespace GameSessionStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace GameSessionStatusReasonMapper
       {
 
-        static const int INTERRUPTED_HASH = HashingUtils::HashString("INTERRUPTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INTERRUPTED",
+        };
 
         GameSessionStatusReason GetGameSessionStatusReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERRUPTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GameSessionStatusReason::INTERRUPTED;
+          case 205308450:
+            if (name == "INTERRUPTED")
+            {
+              return GameSessionStatusReason::INTERRUPTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return GameSessionStatusReason::NOT_SET;
         }
 
-        Aws::String GetNameForGameSessionStatusReason(GameSessionStatusReason enumValue)
+        const char* GetNameForGameSessionStatusReasonCStr(GameSessionStatusReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GameSessionStatusReason::INTERRUPTED:
-            return "INTERRUPTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGameSessionStatusReason(GameSessionStatusReason enumValue)
+        {
+          return GetNameForGameSessionStatusReasonCStr(enumValue);
         }
 
       } // namespace GameSessionStatusReasonMapper
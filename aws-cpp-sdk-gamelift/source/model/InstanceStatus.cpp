@@ -30,25 +30,44 @@ namespace Aws
       namespace InstanceStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "ACTIVE",
+          "TERMINATING",
+        };
 
         InstanceStatus GetInstanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return InstanceStatus::PENDING;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceStatus::ACTIVE;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return InstanceStatus::TERMINATING;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return InstanceStatus::PENDING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return InstanceStatus::ACTIVE;
+            }
+            break;
+          case 234379966:
+            if (name == "TERMINATING")
+            {
+              return InstanceStatus::TERMINATING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InstanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceStatus(InstanceStatus enumValue)
+        const char* GetNameForInstanceStatusCStr(InstanceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceStatus::PENDING:
-            return "PENDING";
-          case InstanceStatus::ACTIVE:
-            return "ACTIVE";
-          case InstanceStatus::TERMINATING:
-            return "TERMINATING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceStatus(InstanceStatus enumValue)
+        {
+          return GetNameForInstanceStatusCStr(enumValue);
         }
 
       } // namespace InstanceStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace IpProtocolMapper
       {
 
-        static const int TCP_HASH = HashingUtils::HashString("TCP");
-        static const int UDP_HASH = HashingUtils::HashString("UDP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TCP",
+          "UDP",
+        };
 
         IpProtocol GetIpProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TCP_HASH)
-          {
-            return IpProtocol::TCP;
-          }
-          else if (hashCode == UDP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IpProtocol::UDP;
+          case 82881:
+            if (name == "TCP")
+            {
+              return IpProtocol::TCP;
+            }
+            break;
+          case 83873:
+            if (name == "UDP")
+            {
+              return IpProtocol::UDP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return IpProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForIpProtocol(IpProtocol enumValue)
+        const char* GetNameForIpProtocolCStr(IpProtocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IpProtocol::TCP:
-            return "TCP";
-          case IpProtocol::UDP:
-            return "UDP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIpProtocol(IpProtocol enumValue)
+        {
+          return GetNameForIpProtocolCStr(enumValue);
         }
 
       } // namespace IpProtocolMapper
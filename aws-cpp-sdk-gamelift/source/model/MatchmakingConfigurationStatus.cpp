@@ -30,50 +30,79 @@ namespace Aws
       namespace MatchmakingConfigurationStatusMapper
       {
 
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int PLACING_HASH = HashingUtils::HashString("PLACING");
-        static const int QUEUED_HASH = HashingUtils::HashString("QUEUED");
-        static const int REQUIRES_ACCEPTANCE_HASH = HashingUtils::HashString("REQUIRES_ACCEPTANCE");
-        static const int SEARCHING_HASH = HashingUtils::HashString("SEARCHING");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CANCELLED",
+          "COMPLETED",
+          "FAILED",
+          "PLACING",
+          "QUEUED",
+          "REQUIRES_ACCEPTANCE",
+          "SEARCHING",
+          "TIMED_OUT",
+        };
 
         MatchmakingConfigurationStatus GetMatchmakingConfigurationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CANCELLED_HASH)
-          {
-            return MatchmakingConfigurationStatus::CANCELLED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return MatchmakingConfigurationStatus::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return MatchmakingConfigurationStatus::FAILED;
-          }
-          else if (hashCode == PLACING_HASH)
-          {
-            return MatchmakingConfigurationStatus::PLACING;
-          }
-          else if (hashCode == QUEUED_HASH)
-          {
-            return MatchmakingConfigurationStatus::QUEUED;
-          }
-          else if (hashCode == REQUIRES_ACCEPTANCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MatchmakingConfigurationStatus::REQUIRES_ACCEPTANCE;
-          }
-          else if (hashCode == SEARCHING_HASH)
-          {
-            return MatchmakingConfigurationStatus::SEARCHING;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return MatchmakingConfigurationStatus::TIMED_OUT;
+          case -1031784143:
+            if (name == "CANCELLED")
+            {
+              return MatchmakingConfigurationStatus::CANCELLED;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return MatchmakingConfigurationStatus::COMPLETED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return MatchmakingConfigurationStatus::FAILED;
+            }
+            break;
+          case 223763428:
+            if (name == "PLACING")
+            {
+              return MatchmakingConfigurationStatus::PLACING;
+            }
+            break;
+          case -1895367309:
+            if (name == "QUEUED")
+            {
+              return MatchmakingConfigurationStatus::QUEUED;
+            }
+            break;
+          case 474242952:
+            if (name == "REQUIRES_ACCEPTANCE")
+            {
+              return MatchmakingConfigurationStatus::REQUIRES_ACCEPTANCE;
+            }
+            break;
+          case 269844762:
+            if (name == "SEARCHING")
+            {
+              return MatchmakingConfigurationStatus::SEARCHING;
+            }
+            break;
+          case -1466757626:
+            if (name == "TIMED_OUT")
+            {
+              return MatchmakingConfigurationStatus::TIMED_OUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return MatchmakingConfigurationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForMatchmakingConfigurationStatus(MatchmakingConfigurationStatus enumValue)
+        const char* GetNameForMatchmakingConfigurationStatusCStr(MatchmakingConfigurationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MatchmakingConfigurationStatus::CANCELLED:
-            return "CANCELLED";
-          case MatchmakingConfigurationStatus::COMPLETED:
-            return "COMPLETED";
-          case MatchmakingConfigurationStatus::FAILED:
-            return "FAILED";
-          case MatchmakingConfigurationStatus::PLACING:
-            return "PLACING";
-          case MatchmakingConfigurationStatus::QUEUED:
-            return "QUEUED";
-          case MatchmakingConfigurationStatus::REQUIRES_ACCEPTANCE:
-            return "REQUIRES_ACCEPTANCE";
-          case MatchmakingConfigurationStatus::SEARCHING:
-            return "SEARCHING";
-          case MatchmakingConfigurationStatus::TIMED_OUT:
-            return "TIMED_OUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMatchmakingConfigurationStatus(MatchmakingConfigurationStatus enumValue)
+        {
+          return GetNameForMatchmakingConfigurationStatusCStr(enumValue);
         }
 
       } // namespace MatchmakingConfigurationStatusMapper
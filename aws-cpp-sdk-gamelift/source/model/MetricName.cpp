@@ -30,65 +30,100 @@ namespace Aws
       namespace MetricNameMapper
       {
 
-        static const int ActivatingGameSessions_HASH = HashingUtils::HashString("ActivatingGameSessions");
-        static const int ActiveGameSessions_HASH = HashingUtils::HashString("ActiveGameSessions");
-        static const int ActiveInstances_HASH = HashingUtils::HashString("ActiveInstances");
-        static const int AvailableGameSessions_HASH = HashingUtils::HashString("AvailableGameSessions");
-        static const int AvailablePlayerSessions_HASH = HashingUtils::HashString("AvailablePlayerSessions");
-        static const int CurrentPlayerSessions_HASH = HashingUtils::HashString("CurrentPlayerSessions");
-        static const int IdleInstances_HASH = HashingUtils::HashString("IdleInstances");
-        static const int PercentAvailableGameSessions_HASH = HashingUtils::HashString("PercentAvailableGameSessions");
-        static const int PercentIdleInstances_HASH = HashingUtils::HashString("PercentIdleInstances");
-        static const int QueueDepth_HASH = HashingUtils::HashString("QueueDepth");
-        static const int WaitTime_HASH = HashingUtils::HashString("WaitTime");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ActivatingGameSessions",
+          "ActiveGameSessions",
+          "ActiveInstances",
+          "AvailableGameSessions",
+          "AvailablePlayerSessions",
+          "CurrentPlayerSessions",
+          "IdleInstances",
+          "PercentAvailableGameSessions",
+          "PercentIdleInstances",
+          "QueueDepth",
+          "WaitTime",
+        };
 
         MetricName GetMetricNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ActivatingGameSessions_HASH)
-          {
-            return MetricName::ActivatingGameSessions;
-          }
-          else if (hashCode == ActiveGameSessions_HASH)
-          {
-            return MetricName::ActiveGameSessions;
-          }
-          else if (hashCode == ActiveInstances_HASH)
-          {
-            return MetricName::ActiveInstances;
-          }
-          else if (hashCode == AvailableGameSessions_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MetricName::AvailableGameSessions;
-          }
-          else if (hashCode == AvailablePlayerSessions_HASH)
-          {
-            return MetricName::AvailablePlayerSessions;
-          }
-          else if (hashCode == CurrentPlayerSessions_HASH)
-          {
-            return MetricName::CurrentPlayerSessions;
-          }
-          else if (hashCode == IdleInstances_HASH)
-          {
-            return MetricName::IdleInstances;
-          }
-          else if (hashCode == PercentAvailableGameSessions_HASH)
-          {
-            return MetricName::PercentAvailableGameSessions;
-          }
-          else if (hashCode == PercentIdleInstances_HASH)
-          {
-            return MetricName::PercentIdleInstances;
-          }
-          else if (hashCode == QueueDepth_HASH)
-          {
-            return MetricName::QueueDepth;
-          }
-          else if (hashCode == WaitTime_HASH)
-          {
-            return MetricName::WaitTime;
+          case -19593249:
+            if (name == "ActivatingGameSessions")
+            {
+              return MetricName::ActivatingGameSessions;
+            }
+            break;
+          case -930437899:
+            if (name == "ActiveGameSessions")
+            {
+              return MetricName::ActiveGameSessions;
+            }
+            break;
+          case -532095496:
+            if (name == "ActiveInstances")
+            {
+              return MetricName::ActiveInstances;
+            }
+            break;
+          case 886028280:
+            if (name == "AvailableGameSessions")
+            {
+              return MetricName::AvailableGameSessions;
+            }
+            break;
+          case -1696171609:
+            if (name == "AvailablePlayerSessions")
+            {
+              return MetricName::AvailablePlayerSessions;
+            }
+            break;
+          case -50417577:
+            if (name == "CurrentPlayerSessions")
+            {
+              return MetricName::CurrentPlayerSessions;
+            }
+            break;
+          case -1352360726:
+            if (name == "IdleInstances")
+            {
+              return MetricName::IdleInstances;
+            }
+            break;
+          case 1192768755:
+            if (name == "PercentAvailableGameSessions")
+            {
+              return MetricName::PercentAvailableGameSessions;
+            }
+            break;
+          case -466926363:
+            if (name == "PercentIdleInstances")
+            {
+              return MetricName::PercentIdleInstances;
+            }
+            break;
+          case -405102510:
+            if (name == "QueueDepth")
+            {
+              return MetricName::QueueDepth;
+            }
+            break;
+          case 309983746:
+            if (name == "WaitTime")
+            {
+              return MetricName::WaitTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return MetricName::NOT_SET;
         }
 
-        Aws::String GetNameForMetricName(MetricName enumValue)
+        const char* GetNameForMetricNameCStr(MetricName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MetricName::ActivatingGameSessions:
-            return "ActivatingGameSessions";
-          case MetricName::ActiveGameSessions:
-            return "ActiveGameSessions";
-          case MetricName::ActiveInstances:
-            return "ActiveInstances";
-          case MetricName::AvailableGameSessions:
-            return "AvailableGameSessions";
-          case MetricName::AvailablePlayerSessions:
-            return "AvailablePlayerSessions";
-          case MetricName::CurrentPlayerSessions:
-            return "CurrentPlayerSessions";
-          case MetricName::IdleInstances:
-            return "IdleInstances";
-          case MetricName::PercentAvailableGameSessions:
-            return "PercentAvailableGameSessions";
-          case MetricName::PercentIdleInstances:
-            return "PercentIdleInstances";
-          case MetricName::QueueDepth:
-            return "QueueDepth";
-          case MetricName::WaitTime:
-            return "WaitTime";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMetricName(MetricName enumValue)
+        {
+          return GetNameForMetricNameCStr(enumValue);
         }
 
       } // namespace MetricNameMapper
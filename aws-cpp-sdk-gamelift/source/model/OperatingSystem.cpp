@@ -30,20 +30,37 @@ namespace Aws
       namespace OperatingSystemMapper
       {
 
-        static const int WINDOWS_2012_HASH = HashingUtils::HashString("WINDOWS_2012");
-        static const int AMAZON_LINUX_HASH = HashingUtils::HashString("AMAZON_LINUX");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WINDOWS_2012",
+          "AMAZON_LINUX",
+        };
 
         OperatingSystem GetOperatingSystemForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WINDOWS_2012_HASH)
-          {
-            return OperatingSystem::WINDOWS_2012;
-          }
-          else if (hashCode == AMAZON_LINUX_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperatingSystem::AMAZON_LINUX;
+          case 2127791419:
+            if (name == "WINDOWS_2012")
+            {
+              return OperatingSystem::WINDOWS_2012;
+            }
+            break;
+          case -1230363943:
+            if (name == "AMAZON_LINUX")
+            {
+              return OperatingSystem::AMAZON_LINUX;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OperatingSystem::NOT_SET;
         }
 
-        Aws::String GetNameForOperatingSystem(OperatingSystem enumValue)
+        const char* GetNameForOperatingSystemCStr(OperatingSystem enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperatingSystem::WINDOWS_2012:
-            return "WINDOWS_2012";
-          case OperatingSystem::AMAZON_LINUX:
-            return "AMAZON_LINUX";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperatingSystem(OperatingSystem enumValue)
+        {
+          return GetNameForOperatingSystemCStr(enumValue);
         }
 
       } // namespace OperatingSystemMapper
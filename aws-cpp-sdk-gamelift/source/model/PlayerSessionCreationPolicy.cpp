@@ -30,20 +30,37 @@ namespace Aws
       namespace PlayerSessionCreationPolicyMapper
       {
 
-        static const int ACCEPT_ALL_HASH = HashingUtils::HashString("ACCEPT_ALL");
-        static const int DENY_ALL_HASH = HashingUtils::HashString("DENY_ALL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCEPT_ALL",
+          "DENY_ALL",
+        };
 
         PlayerSessionCreationPolicy GetPlayerSessionCreationPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCEPT_ALL_HASH)
-          {
-            return PlayerSessionCreationPolicy::ACCEPT_ALL;
-          }
-          else if (hashCode == DENY_ALL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlayerSessionCreationPolicy::DENY_ALL;
+          case -740617782:
+            if (name == "ACCEPT_ALL")
+            {
+              return PlayerSessionCreationPolicy::ACCEPT_ALL;
+            }
+            break;
+          case 1678392526:
+            if (name == "DENY_ALL")
+            {
+              return PlayerSessionCreationPolicy::DENY_ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PlayerSessionCreationPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForPlayerSessionCreationPolicy(PlayerSessionCreationPolicy enumValue)
+        const char* GetNameForPlayerSessionCreationPolicyCStr(PlayerSessionCreationPolicy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlayerSessionCreationPolicy::ACCEPT_ALL:
-            return "ACCEPT_ALL";
-          case PlayerSessionCreationPolicy::DENY_ALL:
-            return "DENY_ALL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlayerSessionCreationPolicy(PlayerSessionCreationPolicy enumValue)
+        {
+          return GetNameForPlayerSessionCreationPolicyCStr(enumValue);
         }
 
       } // namespace PlayerSessionCreationPolicyMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace PlayerSessionStatusMapper
       {
 
-        static const int RESERVED_HASH = HashingUtils::HashString("RESERVED");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int TIMEDOUT_HASH = HashingUtils::HashString("TIMEDOUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RESERVED",
+          "ACTIVE",
+          "COMPLETED",
+          "TIMEDOUT",
+        };
 
         PlayerSessionStatus GetPlayerSessionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RESERVED_HASH)
-          {
-            return PlayerSessionStatus::RESERVED;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return PlayerSessionStatus::ACTIVE;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return PlayerSessionStatus::COMPLETED;
-          }
-          else if (hashCode == TIMEDOUT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlayerSessionStatus::TIMEDOUT;
+          case 432241448:
+            if (name == "RESERVED")
+            {
+              return PlayerSessionStatus::RESERVED;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return PlayerSessionStatus::ACTIVE;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return PlayerSessionStatus::COMPLETED;
+            }
+            break;
+          case -1294255945:
+            if (name == "TIMEDOUT")
+            {
+              return PlayerSessionStatus::TIMEDOUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return PlayerSessionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPlayerSessionStatus(PlayerSessionStatus enumValue)
+        const char* GetNameForPlayerSessionStatusCStr(PlayerSessionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlayerSessionStatus::RESERVED:
-            return "RESERVED";
-          case PlayerSessionStatus::ACTIVE:
-            return "ACTIVE";
-          case PlayerSessionStatus::COMPLETED:
-            return "COMPLETED";
-          case PlayerSessionStatus::TIMEDOUT:
-            return "TIMEDOUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlayerSessionStatus(PlayerSessionStatus enumValue)
+        {
+          return GetNameForPlayerSessionStatusCStr(enumValue);
         }
 
       } // namespace PlayerSessionStatusMapper
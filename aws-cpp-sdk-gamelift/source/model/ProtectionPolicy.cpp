@@ -30,20 +30,37 @@ namespace Aws
       namespace ProtectionPolicyMapper
       {
 
-        static const int NoProtection_HASH = HashingUtils::HashString("NoProtection");
-        static const int FullProtection_HASH = HashingUtils::HashString("FullProtection");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NoProtection",
+          "FullProtection",
+        };
 
         ProtectionPolicy GetProtectionPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoProtection_HASH)
-          {
-            return ProtectionPolicy::NoProtection;
-          }
-          else if (hashCode == FullProtection_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProtectionPolicy::FullProtection;
+          case -105981030:
+            if (name == "NoProtection")
+            {
+              return ProtectionPolicy::NoProtection;
+            }
+            break;
+          case -430358808:
+            if (name == "FullProtection")
+            {
+              return ProtectionPolicy::FullProtection;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ProtectionPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForProtectionPolicy(ProtectionPolicy enumValue)
+        const char* GetNameForProtectionPolicyCStr(ProtectionPolicy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProtectionPolicy::NoProtection:
-            return "NoProtection";
-          case ProtectionPolicy::FullProtection:
-            return "FullProtection";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProtectionPolicy(ProtectionPolicy enumValue)
+        {
+          return GetNameForProtectionPolicyCStr(enumValue);
         }
 
       } // namespace ProtectionPolicyMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace RoutingStrategyTypeMapper
       {
 
-        static const int SIMPLE_HASH = HashingUtils::HashString("SIMPLE");
-        static const int TERMINAL_HASH = HashingUtils::HashString("TERMINAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SIMPLE",
+          "TERMINAL",
+        };
 
         RoutingStrategyType GetRoutingStrategyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIMPLE_HASH)
-          {
-            return RoutingStrategyType::SIMPLE;
-          }
-          else if (hashCode == TERMINAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RoutingStrategyType::TERMINAL;
+          case -1848957518:
+            if (name == "SIMPLE")
+            {
+              return RoutingStrategyType::SIMPLE;
+            }
+            break;
+          case -398622084:
+            if (name == "TERMINAL")
+            {
+              return RoutingStrategyType::TERMINAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RoutingStrategyType::NOT_SET;
         }
 
-        Aws::String GetNameForRoutingStrategyType(RoutingStrategyType enumValue)
+        const char* GetNameForRoutingStrategyTypeCStr(RoutingStrategyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RoutingStrategyType::SIMPLE:
-            return "SIMPLE";
-          case RoutingStrategyType::TERMINAL:
-            return "TERMINAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRoutingStrategyType(RoutingStrategyType enumValue)
+        {
+          return GetNameForRoutingStrategyTypeCStr(enumValue);
         }
 
       } // namespace RoutingStrategyTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ScalingAdjustmentTypeMapper
       {
 
-        static const int ChangeInCapacity_HASH = HashingUtils::HashString("ChangeInCapacity");
-        static const int ExactCapacity_HASH = HashingUtils::HashString("ExactCapacity");
-        static const int PercentChangeInCapacity_HASH = HashingUtils::HashString("PercentChangeInCapacity");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ChangeInCapacity",
+          "ExactCapacity",
+          "PercentChangeInCapacity",
+        };
 
         ScalingAdjustmentType GetScalingAdjustmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ChangeInCapacity_HASH)
-          {
-            return ScalingAdjustmentType::ChangeInCapacity;
-          }
-          else if (hashCode == ExactCapacity_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalingAdjustmentType::ExactCapacity;
-          }
-          else if (hashCode == PercentChangeInCapacity_HASH)
-          {
-            return ScalingAdjustmentType::PercentChangeInCapacity;
+          case -796727057:
+            if (name == "ChangeInCapacity")
+            {
+              return ScalingAdjustmentType::ChangeInCapacity;
+            }
+            break;
+          case -160004935:
+            if (name == "ExactCapacity")
+            {
+              return ScalingAdjustmentType::ExactCapacity;
+            }
+            break;
+          case 1784216340:
+            if (name == "PercentChangeInCapacity")
+            {
+              return ScalingAdjustmentType::PercentChangeInCapacity;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ScalingAdjustmentType::NOT_SET;
         }
 
-        Aws::String GetNameForScalingAdjustmentType(ScalingAdjustmentType enumValue)
+        const char* GetNameForScalingAdjustmentTypeCStr(ScalingAdjustmentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalingAdjustmentType::ChangeInCapacity:
-            return "ChangeInCapacity";
-          case ScalingAdjustmentType::ExactCapacity:
-            return "ExactCapacity";
-          case ScalingAdjustmentType::PercentChangeInCapacity:
-            return "PercentChangeInCapacity";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalingAdjustmentType(ScalingAdjustmentType enumValue)
+        {
+          return GetNameForScalingAdjustmentTypeCStr(enumValue);
         }
 
       } // namespace ScalingAdjustmentTypeMapper
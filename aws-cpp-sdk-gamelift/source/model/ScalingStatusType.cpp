@@ -30,45 +30,72 @@ namespace Aws
       namespace ScalingStatusTypeMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int UPDATE_REQUESTED_HASH = HashingUtils::HashString("UPDATE_REQUESTED");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETE_REQUESTED_HASH = HashingUtils::HashString("DELETE_REQUESTED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "UPDATE_REQUESTED",
+          "UPDATING",
+          "DELETE_REQUESTED",
+          "DELETING",
+          "DELETED",
+          "ERROR",
+        };
 
         ScalingStatusType GetScalingStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return ScalingStatusType::ACTIVE;
-          }
-          else if (hashCode == UPDATE_REQUESTED_HASH)
-          {
-            return ScalingStatusType::UPDATE_REQUESTED;
-          }
-          else if (hashCode == UPDATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalingStatusType::UPDATING;
-          }
-          else if (hashCode == DELETE_REQUESTED_HASH)
-          {
-            return ScalingStatusType::DELETE_REQUESTED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ScalingStatusType::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ScalingStatusType::DELETED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return ScalingStatusType::ERROR_;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ScalingStatusType::ACTIVE;
+            }
+            break;
+          case -1496176808:
+            if (name == "UPDATE_REQUESTED")
+            {
+              return ScalingStatusType::UPDATE_REQUESTED;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return ScalingStatusType::UPDATING;
+            }
+            break;
+          case -1733344838:
+            if (name == "DELETE_REQUESTED")
+            {
+              return ScalingStatusType::DELETE_REQUESTED;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ScalingStatusType::DELETING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return ScalingStatusType::DELETED;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return ScalingStatusType::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ScalingStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForScalingStatusType(ScalingStatusType enumValue)
+        const char* GetNameForScalingStatusTypeCStr(ScalingStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalingStatusType::ACTIVE:
-            return "ACTIVE";
-          case ScalingStatusType::UPDATE_REQUESTED:
-            return "UPDATE_REQUESTED";
-          case ScalingStatusType::UPDATING:
-            return "UPDATING";
-          case ScalingStatusType::DELETE_REQUESTED:
-            return "DELETE_REQUESTED";
-          case ScalingStatusType::DELETING:
-            return "DELETING";
-          case ScalingStatusType::DELETED:
-            return "DELETED";
-          case ScalingStatusType::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalingStatusType(ScalingStatusType enumValue)
+        {
+          return GetNameForScalingStatusTypeCStr(enumValue);
         }
 
       } // namespace ScalingStatusTypeMapper
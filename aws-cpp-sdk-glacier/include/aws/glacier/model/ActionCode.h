@@ -36,6 +36,11 @@ namespace ActionCodeMapper
 AWS_GLACIER_API ActionCode GetActionCodeForName(const Aws::String& name);
 
 AWS_GLACIER_API Aws::String GetNameForActionCode(ActionCode value);
+
+/**
+ * Same as GetNameForActionCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLACIER_API const char* GetNameForActionCodeCStr(ActionCode value);
 } // namespace ActionCodeMapper
 } // namespace Model
 } // namespace Glacier
@@ -40,6 +40,11 @@ namespace CannedACLMapper
 AWS_GLACIER_API CannedACL GetCannedACLForName(const Aws::String& name);
 
 AWS_GLACIER_API Aws::String GetNameForCannedACL(CannedACL value);
+
+/**
+ * Same as GetNameForCannedACL(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLACIER_API const char* GetNameForCannedACLCStr(CannedACL value);
 } // namespace CannedACLMapper
 } // namespace Model
 } // namespace Glacier
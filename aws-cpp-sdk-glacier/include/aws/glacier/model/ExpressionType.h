@@ -34,6 +34,11 @@ namespace ExpressionTypeMapper
 AWS_GLACIER_API ExpressionType GetExpressionTypeForName(const Aws::String& name);
 
 AWS_GLACIER_API Aws::String GetNameForExpressionType(ExpressionType value);
+
+/**
+ * Same as GetNameForExpressionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLACIER_API const char* GetNameForExpressionTypeCStr(ExpressionType value);
 } // namespace ExpressionTypeMapper
 } // namespace Model
 } // namespace Glacier
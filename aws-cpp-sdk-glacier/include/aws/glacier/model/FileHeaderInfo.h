@@ -36,6 +36,11 @@ namespace FileHeaderInfoMapper
 AWS_GLACIER_API FileHeaderInfo GetFileHeaderInfoForName(const Aws::String& name);
 
 AWS_GLACIER_API Aws::String GetNameForFileHeaderInfo(FileHeaderInfo value);
+
+/**
+ * Same as GetNameForFileHeaderInfo(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLACIER_API const char* GetNameForFileHeaderInfoCStr(FileHeaderInfo value);
 } // namespace FileHeaderInfoMapper
 } // namespace Model
 } // namespace Glacier
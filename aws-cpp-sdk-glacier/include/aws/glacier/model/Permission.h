@@ -38,6 +38,11 @@ namespace PermissionMapper
 AWS_GLACIER_API Permission GetPermissionForName(const Aws::String& name);
 
 AWS_GLACIER_API Aws::String GetNameForPermission(Permission value);
+
+/**
+ * Same as GetNameForPermission(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLACIER_API const char* GetNameForPermissionCStr(Permission value);
 } // namespace PermissionMapper
 } // namespace Model
 } // namespace Glacier
@@ -35,6 +35,11 @@ namespace QuoteFieldsMapper
 AWS_GLACIER_API QuoteFields GetQuoteFieldsForName(const Aws::String& name);
 
 AWS_GLACIER_API Aws::String GetNameForQuoteFields(QuoteFields value);
+
+/**
+ * Same as GetNameForQuoteFields(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLACIER_API const char* GetNameForQuoteFieldsCStr(QuoteFields value);
 } // namespace QuoteFieldsMapper
 } // namespace Model
 } // namespace Glacier
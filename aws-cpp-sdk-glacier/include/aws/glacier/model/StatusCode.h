@@ -36,6 +36,11 @@ namespace StatusCodeMapper
 AWS_GLACIER_API StatusCode GetStatusCodeForName(const Aws::String& name);
 
 AWS_GLACIER_API Aws::String GetNameForStatusCode(StatusCode value);
+
+/**
+ * Same as GetNameForStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLACIER_API const char* GetNameForStatusCodeCStr(StatusCode value);
 } // namespace StatusCodeMapper
 } // namespace Model
 } // namespace Glacier
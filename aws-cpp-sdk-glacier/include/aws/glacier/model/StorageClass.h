@@ -36,6 +36,11 @@ namespace StorageClassMapper
 AWS_GLACIER_API StorageClass GetStorageClassForName(const Aws::String& name);
 
 AWS_GLACIER_API Aws::String GetNameForStorageClass(StorageClass value);
+
+/**
+ * Same as GetNameForStorageClass(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLACIER_API const char* GetNameForStorageClassCStr(StorageClass value);
 } // namespace StorageClassMapper
 } // namespace Model
 } // namespace Glacier
@@ -30,25 +30,44 @@ namespace Aws
       namespace ActionCodeMapper
       {
 
-        static const int ArchiveRetrieval_HASH = HashingUtils::HashString("ArchiveRetrieval");
-        static const int InventoryRetrieval_HASH = HashingUtils::HashString("InventoryRetrieval");
-        static const int Select_HASH = HashingUtils::HashString("Select");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ArchiveRetrieval",
+          "InventoryRetrieval",
+          "Select",
+        };
 
         ActionCode GetActionCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ArchiveRetrieval_HASH)
-          {
-            return ActionCode::ArchiveRetrieval;
-          }
-          else if (hashCode == InventoryRetrieval_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionCode::InventoryRetrieval;
-          }
-          else if (hashCode == Select_HASH)
-          {
-            return ActionCode::Select;
+          case -325843790:
+            if (name == "ArchiveRetrieval")
+            {
+              return ActionCode::ArchiveRetrieval;
+            }
+            break;
+          case -1724296872:
+            if (name == "InventoryRetrieval")
+            {
+              return ActionCode::InventoryRetrieval;
+            }
+            break;
+          case -1822154468:
+            if (name == "Select")
+            {
+              return ActionCode::Select;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ActionCode::NOT_SET;
         }
 
-        Aws::String GetNameForActionCode(ActionCode enumValue)
+        const char* GetNameForActionCodeCStr(ActionCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionCode::ArchiveRetrieval:
-            return "ArchiveRetrieval";
-          case ActionCode::InventoryRetrieval:
-            return "InventoryRetrieval";
-          case ActionCode::Select:
-            return "Select";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionCode(ActionCode enumValue)
+        {
+          return GetNameForActionCodeCStr(enumValue);
         }
 
       } // namespace ActionCodeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace EncryptionTypeMapper
       {
 
-        static const int aws_kms_HASH = HashingUtils::HashString("aws:kms");
-        static const int AES256_HASH = HashingUtils::HashString("AES256");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "aws:kms",
+          "AES256",
+        };
 
         EncryptionType GetEncryptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_kms_HASH)
-          {
-            return EncryptionType::aws_kms;
-          }
-          else if (hashCode == AES256_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EncryptionType::AES256;
+          case -591548076:
+            if (name == "aws:kms")
+            {
+              return EncryptionType::aws_kms;
+            }
+            break;
+          case 1927140164:
+            if (name == "AES256")
+            {
+              return EncryptionType::AES256;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EncryptionType::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionType(EncryptionType enumValue)
+        const char* GetNameForEncryptionTypeCStr(EncryptionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EncryptionType::aws_kms:
-            return "aws:kms";
-          case EncryptionType::AES256:
-            return "AES256";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEncryptionType(EncryptionType enumValue)
+        {
+          return GetNameForEncryptionTypeCStr(enumValue);
         }
 
       } // namespace EncryptionTypeMapper
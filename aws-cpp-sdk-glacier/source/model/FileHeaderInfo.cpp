@@ -30,25 +30,44 @@ namespace Aws
       namespace FileHeaderInfoMapper
       {
 
-        static const int USE_HASH = HashingUtils::HashString("USE");
-        static const int IGNORE_HASH = HashingUtils::HashString("IGNORE");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USE",
+          "IGNORE",
+          "NONE",
+        };
 
         FileHeaderInfo GetFileHeaderInfoForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USE_HASH)
-          {
-            return FileHeaderInfo::USE;
-          }
-          else if (hashCode == IGNORE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FileHeaderInfo::IGNORE;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return FileHeaderInfo::NONE;
+          case 84327:
+            if (name == "USE")
+            {
+              return FileHeaderInfo::USE;
+            }
+            break;
+          case -2137067054:
+            if (name == "IGNORE")
+            {
+              return FileHeaderInfo::IGNORE;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return FileHeaderInfo::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FileHeaderInfo::NOT_SET;
         }
 
-        Aws::String GetNameForFileHeaderInfo(FileHeaderInfo enumValue)
+        const char* GetNameForFileHeaderInfoCStr(FileHeaderInfo enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FileHeaderInfo::USE:
-            return "USE";
-          case FileHeaderInfo::IGNORE:
-            return "IGNORE";
-          case FileHeaderInfo::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFileHeaderInfo(FileHeaderInfo enumValue)
+        {
+          return GetNameForFileHeaderInfoCStr(enumValue);
         }
 
       } // namespace FileHeaderInfoMapper
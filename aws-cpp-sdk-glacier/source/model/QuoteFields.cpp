@@ -30,20 +30,37 @@ namespace Aws
       namespace QuoteFieldsMapper
       {
 
-        static const int ALWAYS_HASH = HashingUtils::HashString("ALWAYS");
-        static const int ASNEEDED_HASH = HashingUtils::HashString("ASNEEDED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALWAYS",
+          "ASNEEDED",
+        };
 
         QuoteFields GetQuoteFieldsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALWAYS_HASH)
-          {
-            return QuoteFields::ALWAYS;
-          }
-          else if (hashCode == ASNEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return QuoteFields::ASNEEDED;
+          case 1933739535:
+            if (name == "ALWAYS")
+            {
+              return QuoteFields::ALWAYS;
+            }
+            break;
+          case 265836135:
+            if (name == "ASNEEDED")
+            {
+              return QuoteFields::ASNEEDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return QuoteFields::NOT_SET;
         }
 
-        Aws::String GetNameForQuoteFields(QuoteFields enumValue)
+        const char* GetNameForQuoteFieldsCStr(QuoteFields enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QuoteFields::ALWAYS:
-            return "ALWAYS";
-          case QuoteFields::ASNEEDED:
-            return "ASNEEDED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQuoteFields(QuoteFields enumValue)
+        {
+          return GetNameForQuoteFieldsCStr(enumValue);
         }
 
       } // namespace QuoteFieldsMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace StorageClassMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int REDUCED_REDUNDANCY_HASH = HashingUtils::HashString("REDUCED_REDUNDANCY");
-        static const int STANDARD_IA_HASH = HashingUtils::HashString("STANDARD_IA");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STANDARD",
+          "REDUCED_REDUNDANCY",
+          "STANDARD_IA",
+        };
 
         StorageClass GetStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
-          {
-            return StorageClass::STANDARD;
-          }
-          else if (hashCode == REDUCED_REDUNDANCY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StorageClass::REDUCED_REDUNDANCY;
-          }
-          else if (hashCode == STANDARD_IA_HASH)
-          {
-            return StorageClass::STANDARD_IA;
+          case 2095255229:
+            if (name == "STANDARD")
+            {
+              return StorageClass::STANDARD;
+            }
+            break;
+          case 246938206:
+            if (name == "REDUCED_REDUNDANCY")
+            {
+              return StorageClass::REDUCED_REDUNDANCY;
+            }
+            break;
+          case 988907994:
+            if (name == "STANDARD_IA")
+            {
+              return StorageClass::STANDARD_IA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StorageClass::NOT_SET;
         }
 
-        Aws::String GetNameForStorageClass(StorageClass enumValue)
+        const char* GetNameForStorageClassCStr(StorageClass enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StorageClass::STANDARD:
-            return "STANDARD";
-          case StorageClass::REDUCED_REDUNDANCY:
-            return "REDUCED_REDUNDANCY";
-          case StorageClass::STANDARD_IA:
-            return "STANDARD_IA";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStorageClass(StorageClass enumValue)
+        {
+          return GetNameForStorageClassCStr(enumValue);
         }
 
       } // namespace StorageClassMapper
@@ -35,6 +35,11 @@ namespace AcceleratorStatusMapper
 AWS_GLOBALACCELERATOR_API AcceleratorStatus GetAcceleratorStatusForName(const Aws::String& name);
 
 AWS_GLOBALACCELERATOR_API Aws::String GetNameForAcceleratorStatus(AcceleratorStatus value);
+
+/**
+ * Same as GetNameForAcceleratorStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLOBALACCELERATOR_API const char* GetNameForAcceleratorStatusCStr(AcceleratorStatus value);
 } // namespace AcceleratorStatusMapper
 } // namespace Model
 } // namespace GlobalAccelerator
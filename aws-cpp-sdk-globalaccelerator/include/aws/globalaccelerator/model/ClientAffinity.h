@@ -35,6 +35,11 @@ namespace ClientAffinityMapper
 AWS_GLOBALACCELERATOR_API ClientAffinity GetClientAffinityForName(const Aws::String& name);
 
 AWS_GLOBALACCELERATOR_API Aws::String GetNameForClientAffinity(ClientAffinity value);
+
+/**
+ * Same as GetNameForClientAffinity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLOBALACCELERATOR_API const char* GetNameForClientAffinityCStr(ClientAffinity value);
 } // namespace ClientAffinityMapper
 } // namespace Model
 } // namespace GlobalAccelerator
@@ -36,6 +36,11 @@ namespace HealthCheckProtocolMapper
 AWS_GLOBALACCELERATOR_API HealthCheckProtocol GetHealthCheckProtocolForName(const Aws::String& name);
 
 AWS_GLOBALACCELERATOR_API Aws::String GetNameForHealthCheckProtocol(HealthCheckProtocol value);
+
+/**
+ * Same as GetNameForHealthCheckProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLOBALACCELERATOR_API const char* GetNameForHealthCheckProtocolCStr(HealthCheckProtocol value);
 } // namespace HealthCheckProtocolMapper
 } // namespace Model
 } // namespace GlobalAccelerator
@@ -36,6 +36,11 @@ namespace HealthStateMapper
 AWS_GLOBALACCELERATOR_API HealthState GetHealthStateForName(const Aws::String& name);
 
 AWS_GLOBALACCELERATOR_API Aws::String GetNameForHealthState(HealthState value);
+
+/**
+ * Same as GetNameForHealthState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLOBALACCELERATOR_API const char* GetNameForHealthStateCStr(HealthState value);
 } // namespace HealthStateMapper
 } // namespace Model
 } // namespace GlobalAccelerator
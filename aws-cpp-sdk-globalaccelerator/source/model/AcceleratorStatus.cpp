@@ -30,20 +30,37 @@ namespace Aws
       namespace AcceleratorStatusMapper
       {
 
-        static const int DEPLOYED_HASH = HashingUtils::HashString("DEPLOYED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEPLOYED",
+          "IN_PROGRESS",
+        };
 
         AcceleratorStatus GetAcceleratorStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEPLOYED_HASH)
-          {
-            return AcceleratorStatus::DEPLOYED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AcceleratorStatus::IN_PROGRESS;
+          case 1723191238:
+            if (name == "DEPLOYED")
+            {
+              return AcceleratorStatus::DEPLOYED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return AcceleratorStatus::IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AcceleratorStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAcceleratorStatus(AcceleratorStatus enumValue)
+        const char* GetNameForAcceleratorStatusCStr(AcceleratorStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AcceleratorStatus::DEPLOYED:
-            return "DEPLOYED";
-          case AcceleratorStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAcceleratorStatus(AcceleratorStatus enumValue)
+        {
+          return GetNameForAcceleratorStatusCStr(enumValue);
         }
 
       } // namespace AcceleratorStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ClientAffinityMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SOURCE_IP_HASH = HashingUtils::HashString("SOURCE_IP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "SOURCE_IP",
+        };
 
         ClientAffinity GetClientAffinityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return ClientAffinity::NONE;
-          }
-          else if (hashCode == SOURCE_IP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClientAffinity::SOURCE_IP;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return ClientAffinity::NONE;
+            }
+            break;
+          case 1088214987:
+            if (name == "SOURCE_IP")
+            {
+              return ClientAffinity::SOURCE_IP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ClientAffinity::NOT_SET;
         }
 
-        Aws::String GetNameForClientAffinity(ClientAffinity enumValue)
+        const char* GetNameForClientAffinityCStr(ClientAffinity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClientAffinity::NONE:
-            return "NONE";
-          case ClientAffinity::SOURCE_IP:
-            return "SOURCE_IP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClientAffinity(ClientAffinity enumValue)
+        {
+          return GetNameForClientAffinityCStr(enumValue);
         }
 
       } // namespace ClientAffinityMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace HealthCheckProtocolMapper
       {
 
-        static const int TCP_HASH = HashingUtils::HashString("TCP");
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-        static const int HTTPS_HASH = HashingUtils::HashString("HTTPS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TCP",
+          "HTTP",
+          "HTTPS",
+        };
 
         HealthCheckProtocol GetHealthCheckProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TCP_HASH)
-          {
-            return HealthCheckProtocol::TCP;
-          }
-          else if (hashCode == HTTP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HealthCheckProtocol::HTTP;
-          }
-          else if (hashCode == HTTPS_HASH)
-          {
-            return HealthCheckProtocol::HTTPS;
+          case 82881:
+            if (name == "TCP")
+            {
+              return HealthCheckProtocol::TCP;
+            }
+            break;
+          case 2228360:
+            if (name == "HTTP")
+            {
+              return HealthCheckProtocol::HTTP;
+            }
+            break;
+          case 69079243:
+            if (name == "HTTPS")
+            {
+              return HealthCheckProtocol::HTTPS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return HealthCheckProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForHealthCheckProtocol(HealthCheckProtocol enumValue)
+        const char* GetNameForHealthCheckProtocolCStr(HealthCheckProtocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HealthCheckProtocol::TCP:
-            return "TCP";
-          case HealthCheckProtocol::HTTP:
-            return "HTTP";
-          case HealthCheckProtocol::HTTPS:
-            return "HTTPS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHealthCheckProtocol(HealthCheckProtocol enumValue)
+        {
+          return GetNameForHealthCheckProtocolCStr(enumValue);
         }
 
       } // namespace HealthCheckProtocolMapper
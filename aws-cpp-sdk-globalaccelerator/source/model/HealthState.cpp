@@ -30,25 +30,44 @@ namespace Aws
       namespace HealthStateMapper
       {
 
-        static const int INITIAL_HASH = HashingUtils::HashString("INITIAL");
-        static const int HEALTHY_HASH = HashingUtils::HashString("HEALTHY");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INITIAL",
+          "HEALTHY",
+          "UNHEALTHY",
+        };
 
         HealthState GetHealthStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIAL_HASH)
-          {
-            return HealthState::INITIAL;
-          }
-          else if (hashCode == HEALTHY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HealthState::HEALTHY;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
-            return HealthState::UNHEALTHY;
+          case -1628642524:
+            if (name == "INITIAL")
+            {
+              return HealthState::INITIAL;
+            }
+            break;
+          case 1513543037:
+            if (name == "HEALTHY")
+            {
+              return HealthState::HEALTHY;
+            }
+            break;
+          case 998988996:
+            if (name == "UNHEALTHY")
+            {
+              return HealthState::UNHEALTHY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return HealthState::NOT_SET;
         }
 
-        Aws::String GetNameForHealthState(HealthState enumValue)
+        const char* GetNameForHealthStateCStr(HealthState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HealthState::INITIAL:
-            return "INITIAL";
-          case HealthState::HEALTHY:
-            return "HEALTHY";
-          case HealthState::UNHEALTHY:
-            return "UNHEALTHY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHealthState(HealthState enumValue)
+        {
+          return GetNameForHealthStateCStr(enumValue);
         }
 
       } // namespace HealthStateMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace IpAddressTypeMapper
       {
 
-        static const int IPV4_HASH = HashingUtils::HashString("IPV4");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IPV4",
+        };
 
         IpAddressType GetIpAddressTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IPV4_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IpAddressType::IPV4;
+          case 2254341:
+            if (name == "IPV4")
+            {
+              return IpAddressType::IPV4;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return IpAddressType::NOT_SET;
         }
 
-        Aws::String GetNameForIpAddressType(IpAddressType enumValue)
+        const char* GetNameForIpAddressTypeCStr(IpAddressType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IpAddressType::IPV4:
-            return "IPV4";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIpAddressType(IpAddressType enumValue)
+        {
+          return GetNameForIpAddressTypeCStr(enumValue);
         }
 
       } // namespace IpAddressTypeMapper
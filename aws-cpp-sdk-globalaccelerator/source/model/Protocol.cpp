@@ -30,20 +30,37 @@ namespace Aws
       namespace ProtocolMapper
       {
 
-        static const int TCP_HASH = HashingUtils::HashString("TCP");
-        static const int UDP_HASH = HashingUtils::HashString("UDP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TCP",
+          "UDP",
+        };
 
         Protocol GetProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TCP_HASH)
-          {
-            return Protocol::TCP;
-          }
-          else if (hashCode == UDP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Protocol::UDP;
+          case 82881:
+            if (name == "TCP")
+            {
+              return Protocol::TCP;
+            }
+            break;
+          case 83873:
+            if (name == "UDP")
+            {
+              return Protocol::UDP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Protocol::NOT_SET;
         }
 
-        Aws::String GetNameForProtocol(Protocol enumValue)
+        const char* GetNameForProtocolCStr(Protocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Protocol::TCP:
-            return "TCP";
-          case Protocol::UDP:
-            return "UDP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProtocol(Protocol enumValue)
+        {
+          return GetNameForProtocolCStr(enumValue);
         }
 
       } // namespace ProtocolMapper
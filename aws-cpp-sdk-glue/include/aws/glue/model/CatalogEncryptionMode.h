@@ -35,6 +35,11 @@ namespace CatalogEncryptionModeMapper
 AWS_GLUE_API CatalogEncryptionMode GetCatalogEncryptionModeForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForCatalogEncryptionMode(CatalogEncryptionMode value);
+
+/**
+ * Same as GetNameForCatalogEncryptionMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForCatalogEncryptionModeCStr(CatalogEncryptionMode value);
 } // namespace CatalogEncryptionModeMapper
 } // namespace Model
 } // namespace Glue
@@ -35,6 +35,11 @@ namespace CloudWatchEncryptionModeMapper
 AWS_GLUE_API CloudWatchEncryptionMode GetCloudWatchEncryptionModeForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForCloudWatchEncryptionMode(CloudWatchEncryptionMode value);
+
+/**
+ * Same as GetNameForCloudWatchEncryptionMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForCloudWatchEncryptionModeCStr(CloudWatchEncryptionMode value);
 } // namespace CloudWatchEncryptionModeMapper
 } // namespace Model
 } // namespace Glue
@@ -46,6 +46,11 @@ namespace ConnectionPropertyKeyMapper
 AWS_GLUE_API ConnectionPropertyKey GetConnectionPropertyKeyForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForConnectionPropertyKey(ConnectionPropertyKey value);
+
+/**
+ * Same as GetNameForConnectionPropertyKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForConnectionPropertyKeyCStr(ConnectionPropertyKey value);
 } // namespace ConnectionPropertyKeyMapper
 } // namespace Model
 } // namespace Glue
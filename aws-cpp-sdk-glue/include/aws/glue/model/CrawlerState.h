@@ -36,6 +36,11 @@ namespace CrawlerStateMapper
 AWS_GLUE_API CrawlerState GetCrawlerStateForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForCrawlerState(CrawlerState value);
+
+/**
+ * Same as GetNameForCrawlerState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForCrawlerStateCStr(CrawlerState value);
 } // namespace CrawlerStateMapper
 } // namespace Model
 } // namespace Glue
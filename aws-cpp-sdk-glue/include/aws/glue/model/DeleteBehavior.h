@@ -36,6 +36,11 @@ namespace DeleteBehaviorMapper
 AWS_GLUE_API DeleteBehavior GetDeleteBehaviorForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForDeleteBehavior(DeleteBehavior value);
+
+/**
+ * Same as GetNameForDeleteBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForDeleteBehaviorCStr(DeleteBehavior value);
 } // namespace DeleteBehaviorMapper
 } // namespace Model
 } // namespace Glue
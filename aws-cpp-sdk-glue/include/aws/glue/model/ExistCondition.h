@@ -36,6 +36,11 @@ namespace ExistConditionMapper
 AWS_GLUE_API ExistCondition GetExistConditionForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForExistCondition(ExistCondition value);
+
+/**
+ * Same as GetNameForExistCondition(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForExistConditionCStr(ExistCondition value);
 } // namespace ExistConditionMapper
 } // namespace Model
 } // namespace Glue
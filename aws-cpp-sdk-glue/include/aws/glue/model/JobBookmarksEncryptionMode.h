@@ -35,6 +35,11 @@ namespace JobBookmarksEncryptionModeMapper
 AWS_GLUE_API JobBookmarksEncryptionMode GetJobBookmarksEncryptionModeForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForJobBookmarksEncryptionMode(JobBookmarksEncryptionMode value);
+
+/**
+ * Same as GetNameForJobBookmarksEncryptionMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForJobBookmarksEncryptionModeCStr(JobBookmarksEncryptionMode value);
 } // namespace JobBookmarksEncryptionModeMapper
 } // namespace Model
 } // namespace Glue
@@ -40,6 +40,11 @@ namespace JobRunStateMapper
 AWS_GLUE_API JobRunState GetJobRunStateForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForJobRunState(JobRunState value);
+
+/**
+ * Same as GetNameForJobRunState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForJobRunStateCStr(JobRunState value);
 } // namespace JobRunStateMapper
 } // namespace Model
 } // namespace Glue
@@ -35,6 +35,11 @@ namespace LanguageMapper
 AWS_GLUE_API Language GetLanguageForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForLanguage(Language value);
+
+/**
+ * Same as GetNameForLanguage(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForLanguageCStr(Language value);
 } // namespace LanguageMapper
 } // namespace Model
 } // namespace Glue
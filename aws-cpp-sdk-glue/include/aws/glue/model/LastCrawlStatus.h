@@ -36,6 +36,11 @@ namespace LastCrawlStatusMapper
 AWS_GLUE_API LastCrawlStatus GetLastCrawlStatusForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForLastCrawlStatus(LastCrawlStatus value);
+
+/**
+ * Same as GetNameForLastCrawlStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForLastCrawlStatusCStr(LastCrawlStatus value);
 } // namespace LastCrawlStatusMapper
 } // namespace Model
 } // namespace Glue
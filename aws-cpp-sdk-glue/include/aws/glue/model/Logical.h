@@ -35,6 +35,11 @@ namespace LogicalMapper
 AWS_GLUE_API Logical GetLogicalForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForLogical(Logical value);
+
+/**
+ * Same as GetNameForLogical(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForLogicalCStr(Logical value);
 } // namespace LogicalMapper
 } // namespace Model
 } // namespace Glue
@@ -34,6 +34,11 @@ namespace LogicalOperatorMapper
 AWS_GLUE_API LogicalOperator GetLogicalOperatorForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForLogicalOperator(LogicalOperator value);
+
+/**
+ * Same as GetNameForLogicalOperator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForLogicalOperatorCStr(LogicalOperator value);
 } // namespace LogicalOperatorMapper
 } // namespace Model
 } // namespace Glue
@@ -36,6 +36,11 @@ namespace S3EncryptionModeMapper
 AWS_GLUE_API S3EncryptionMode GetS3EncryptionModeForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForS3EncryptionMode(S3EncryptionMode value);
+
+/**
+ * Same as GetNameForS3EncryptionMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForS3EncryptionModeCStr(S3EncryptionMode value);
 } // namespace S3EncryptionModeMapper
 } // namespace Model
 } // namespace Glue
@@ -36,6 +36,11 @@ namespace ScheduleStateMapper
 AWS_GLUE_API ScheduleState GetScheduleStateForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForScheduleState(ScheduleState value);
+
+/**
+ * Same as GetNameForScheduleState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForScheduleStateCStr(ScheduleState value);
 } // namespace ScheduleStateMapper
 } // namespace Model
 } // namespace Glue
@@ -41,6 +41,11 @@ namespace TriggerStateMapper
 AWS_GLUE_API TriggerState GetTriggerStateForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForTriggerState(TriggerState value);
+
+/**
+ * Same as GetNameForTriggerState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForTriggerStateCStr(TriggerState value);
 } // namespace TriggerStateMapper
 } // namespace Model
 } // namespace Glue
@@ -36,6 +36,11 @@ namespace TriggerTypeMapper
 AWS_GLUE_API TriggerType GetTriggerTypeForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForTriggerType(TriggerType value);
+
+/**
+ * Same as GetNameForTriggerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForTriggerTypeCStr(TriggerType value);
 } // namespace TriggerTypeMapper
 } // namespace Model
 } // namespace Glue
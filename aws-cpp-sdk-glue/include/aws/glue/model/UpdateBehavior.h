@@ -35,6 +35,11 @@ namespace UpdateBehaviorMapper
 AWS_GLUE_API UpdateBehavior GetUpdateBehaviorForName(const Aws::String& name);
 
 AWS_GLUE_API Aws::String GetNameForUpdateBehavior(UpdateBehavior value);
+
+/**
+ * Same as GetNameForUpdateBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GLUE_API const char* GetNameForUpdateBehaviorCStr(UpdateBehavior value);
 } // namespace UpdateBehaviorMapper
 } // namespace Model
 } // namespace Glue
@@ -30,20 +30,37 @@ namespace Aws
       namespace CloudWatchEncryptionModeMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int SSE_KMS_HASH = HashingUtils::HashString("SSE-KMS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "SSE-KMS",
+        };
 
         CloudWatchEncryptionMode GetCloudWatchEncryptionModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return CloudWatchEncryptionMode::DISABLED;
-          }
-          else if (hashCode == SSE_KMS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CloudWatchEncryptionMode::SSE_KMS;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return CloudWatchEncryptionMode::DISABLED;
+            }
+            break;
+          case -1205248183:
+            if (name == "SSE-KMS")
+            {
+              return CloudWatchEncryptionMode::SSE_KMS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CloudWatchEncryptionMode::NOT_SET;
         }
 
-        Aws::String GetNameForCloudWatchEncryptionMode(CloudWatchEncryptionMode enumValue)
+        const char* GetNameForCloudWatchEncryptionModeCStr(CloudWatchEncryptionMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CloudWatchEncryptionMode::DISABLED:
-            return "DISABLED";
-          case CloudWatchEncryptionMode::SSE_KMS:
-            return "SSE-KMS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCloudWatchEncryptionMode(CloudWatchEncryptionMode enumValue)
+        {
+          return GetNameForCloudWatchEncryptionModeCStr(enumValue);
         }
 
       } // namespace CloudWatchEncryptionModeMapper
@@ -30,75 +30,114 @@ namespace Aws
       namespace ConnectionPropertyKeyMapper
       {
 
-        static const int HOST_HASH = HashingUtils::HashString("HOST");
-        static const int PORT_HASH = HashingUtils::HashString("PORT");
-        static const int USERNAME_HASH = HashingUtils::HashString("USERNAME");
-        static const int PASSWORD_HASH = HashingUtils::HashString("PASSWORD");
-        static const int ENCRYPTED_PASSWORD_HASH = HashingUtils::HashString("ENCRYPTED_PASSWORD");
-        static const int JDBC_DRIVER_JAR_URI_HASH = HashingUtils::HashString("JDBC_DRIVER_JAR_URI");
-        static const int JDBC_DRIVER_CLASS_NAME_HASH = HashingUtils::HashString("JDBC_DRIVER_CLASS_NAME");
-        static const int JDBC_ENGINE_HASH = HashingUtils::HashString("JDBC_ENGINE");
-        static const int JDBC_ENGINE_VERSION_HASH = HashingUtils::HashString("JDBC_ENGINE_VERSION");
-        static const int CONFIG_FILES_HASH = HashingUtils::HashString("CONFIG_FILES");
-        static const int INSTANCE_ID_HASH = HashingUtils::HashString("INSTANCE_ID");
-        static const int JDBC_CONNECTION_URL_HASH = HashingUtils::HashString("JDBC_CONNECTION_URL");
-        static const int JDBC_ENFORCE_SSL_HASH = HashingUtils::HashString("JDBC_ENFORCE_SSL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HOST",
+          "PORT",
+          "USERNAME",
+          "PASSWORD",
+          "ENCRYPTED_PASSWORD",
+          "JDBC_DRIVER_JAR_URI",
+          "JDBC_DRIVER_CLASS_NAME",
+          "JDBC_ENGINE",
+          "JDBC_ENGINE_VERSION",
+          "CONFIG_FILES",
+          "INSTANCE_ID",
+          "JDBC_CONNECTION_URL",
+          "JDBC_ENFORCE_SSL",
+        };
 
         ConnectionPropertyKey GetConnectionPropertyKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HOST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectionPropertyKey::HOST;
-          }
-          else if (hashCode == PORT_HASH)
-          {
-            return ConnectionPropertyKey::PORT;
-          }
-          else if (hashCode == USERNAME_HASH)
-          {
-            return ConnectionPropertyKey::USERNAME;
-          }
-          else if (hashCode == PASSWORD_HASH)
-          {
-            return ConnectionPropertyKey::PASSWORD;
-          }
-          else if (hashCode == ENCRYPTED_PASSWORD_HASH)
-          {
-            return ConnectionPropertyKey::ENCRYPTED_PASSWORD;
-          }
-          else if (hashCode == JDBC_DRIVER_JAR_URI_HASH)
-          {
-            return ConnectionPropertyKey::JDBC_DRIVER_JAR_URI;
-          }
-          else if (hashCode == JDBC_DRIVER_CLASS_NAME_HASH)
-          {
-            return ConnectionPropertyKey::JDBC_DRIVER_CLASS_NAME;
-          }
-          else if (hashCode == JDBC_ENGINE_HASH)
-          {
-            return ConnectionPropertyKey::JDBC_ENGINE;
-          }
-          else if (hashCode == JDBC_ENGINE_VERSION_HASH)
-          {
-            return ConnectionPropertyKey::JDBC_ENGINE_VERSION;
-          }
-          else if (hashCode == CONFIG_FILES_HASH)
-          {
-            return ConnectionPropertyKey::CONFIG_FILES;
-          }
-          else if (hashCode == INSTANCE_ID_HASH)
-          {
-            return ConnectionPropertyKey::INSTANCE_ID;
-          }
-          else if (hashCode == JDBC_CONNECTION_URL_HASH)
-          {
-            return ConnectionPropertyKey::JDBC_CONNECTION_URL;
-          }
-          else if (hashCode == JDBC_ENFORCE_SSL_HASH)
-          {
-            return ConnectionPropertyKey::JDBC_ENFORCE_SSL;
+          case 2223528:
+            if (name == "HOST")
+            {
+              return ConnectionPropertyKey::HOST;
+            }
+            break;
+          case 2461825:
+            if (name == "PORT")
+            {
+              return ConnectionPropertyKey::PORT;
+            }
+            break;
+          case 516913366:
+            if (name == "USERNAME")
+            {
+              return ConnectionPropertyKey::USERNAME;
+            }
+            break;
+          case 1999612571:
+            if (name == "PASSWORD")
+            {
+              return ConnectionPropertyKey::PASSWORD;
+            }
+            break;
+          case 2006657750:
+            if (name == "ENCRYPTED_PASSWORD")
+            {
+              return ConnectionPropertyKey::ENCRYPTED_PASSWORD;
+            }
+            break;
+          case 322025909:
+            if (name == "JDBC_DRIVER_JAR_URI")
+            {
+              return ConnectionPropertyKey::JDBC_DRIVER_JAR_URI;
+            }
+            break;
+          case -182805179:
+            if (name == "JDBC_DRIVER_CLASS_NAME")
+            {
+              return ConnectionPropertyKey::JDBC_DRIVER_CLASS_NAME;
+            }
+            break;
+          case 1925971974:
+            if (name == "JDBC_ENGINE")
+            {
+              return ConnectionPropertyKey::JDBC_ENGINE;
+            }
+            break;
+          case 750184831:
+            if (name == "JDBC_ENGINE_VERSION")
+            {
+              return ConnectionPropertyKey::JDBC_ENGINE_VERSION;
+            }
+            break;
+          case -531520742:
+            if (name == "CONFIG_FILES")
+            {
+              return ConnectionPropertyKey::CONFIG_FILES;
+            }
+            break;
+          case 50996485:
+            if (name == "INSTANCE_ID")
+            {
+              return ConnectionPropertyKey::INSTANCE_ID;
+            }
+            break;
+          case -1590472142:
+            if (name == "JDBC_CONNECTION_URL")
+            {
+              return ConnectionPropertyKey::JDBC_CONNECTION_URL;
+            }
+            break;
+          case 639349931:
+            if (name == "JDBC_ENFORCE_SSL")
+            {
+              return ConnectionPropertyKey::JDBC_ENFORCE_SSL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,45 +149,26 @@ namespace Aws
           return ConnectionPropertyKey::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionPropertyKey(ConnectionPropertyKey enumValue)
+        const char* GetNameForConnectionPropertyKeyCStr(ConnectionPropertyKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectionPropertyKey::HOST:
-            return "HOST";
-          case ConnectionPropertyKey::PORT:
-            return "PORT";
-          case ConnectionPropertyKey::USERNAME:
-            return "USERNAME";
-          case ConnectionPropertyKey::PASSWORD:
-            return "PASSWORD";
-          case ConnectionPropertyKey::ENCRYPTED_PASSWORD:
-            return "ENCRYPTED_PASSWORD";
-          case ConnectionPropertyKey::JDBC_DRIVER_JAR_URI:
-            return "JDBC_DRIVER_JAR_URI";
-          case ConnectionPropertyKey::JDBC_DRIVER_CLASS_NAME:
-            return "JDBC_DRIVER_CLASS_NAME";
-          case ConnectionPropertyKey::JDBC_ENGINE:
-            return "JDBC_ENGINE";
-          case ConnectionPropertyKey::JDBC_ENGINE_VERSION:
-            return "JDBC_ENGINE_VERSION";
-          case ConnectionPropertyKey::CONFIG_FILES:
-            return "CONFIG_FILES";
-          case ConnectionPropertyKey::INSTANCE_ID:
-            return "INSTANCE_ID";
-          case ConnectionPropertyKey::JDBC_CONNECTION_URL:
-            return "JDBC_CONNECTION_URL";
-          case ConnectionPropertyKey::JDBC_ENFORCE_SSL:
-            return "JDBC_ENFORCE_SSL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectionPropertyKey(ConnectionPropertyKey enumValue)
+        {
+          return GetNameForConnectionPropertyKeyCStr(enumValue);
         }
 
       } // namespace ConnectionPropertyKeyMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ConnectionTypeMapper
       {
 
-        static const int JDBC_HASH = HashingUtils::HashString("JDBC");
-        static const int SFTP_HASH = HashingUtils::HashString("SFTP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "JDBC",
+          "SFTP",
+        };
 
         ConnectionType GetConnectionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JDBC_HASH)
-          {
-            return ConnectionType::JDBC;
-          }
-          else if (hashCode == SFTP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectionType::SFTP;
+          case 2271995:
+            if (name == "JDBC")
+            {
+              return ConnectionType::JDBC;
+            }
+            break;
+          case 2542607:
+            if (name == "SFTP")
+            {
+              return ConnectionType::SFTP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ConnectionType::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionType(ConnectionType enumValue)
+        const char* GetNameForConnectionTypeCStr(ConnectionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectionType::JDBC:
-            return "JDBC";
-          case ConnectionType::SFTP:
-            return "SFTP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectionType(ConnectionType enumValue)
+        {
+          return GetNameForConnectionTypeCStr(enumValue);
         }
 
       } // namespace ConnectionTypeMapper
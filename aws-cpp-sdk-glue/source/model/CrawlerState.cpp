@@ -30,25 +30,44 @@ namespace Aws
       namespace CrawlerStateMapper
       {
 
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "READY",
+          "RUNNING",
+          "STOPPING",
+        };
 
         CrawlerState GetCrawlerStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == READY_HASH)
-          {
-            return CrawlerState::READY;
-          }
-          else if (hashCode == RUNNING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CrawlerState::RUNNING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return CrawlerState::STOPPING;
+          case 77848963:
+            if (name == "READY")
+            {
+              return CrawlerState::READY;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return CrawlerState::RUNNING;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return CrawlerState::STOPPING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return CrawlerState::NOT_SET;
         }
 
-        Aws::String GetNameForCrawlerState(CrawlerState enumValue)
+        const char* GetNameForCrawlerStateCStr(CrawlerState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CrawlerState::READY:
-            return "READY";
-          case CrawlerState::RUNNING:
-            return "RUNNING";
-          case CrawlerState::STOPPING:
-            return "STOPPING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCrawlerState(CrawlerState enumValue)
+        {
+          return GetNameForCrawlerStateCStr(enumValue);
         }
 
       } // namespace CrawlerStateMapper
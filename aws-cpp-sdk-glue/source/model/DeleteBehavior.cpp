@@ -30,25 +30,44 @@ namespace Aws
       namespace DeleteBehaviorMapper
       {
 
-        static const int LOG_HASH = HashingUtils::HashString("LOG");
-        static const int DELETE_FROM_DATABASE_HASH = HashingUtils::HashString("DELETE_FROM_DATABASE");
-        static const int DEPRECATE_IN_DATABASE_HASH = HashingUtils::HashString("DEPRECATE_IN_DATABASE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LOG",
+          "DELETE_FROM_DATABASE",
+          "DEPRECATE_IN_DATABASE",
+        };
 
         DeleteBehavior GetDeleteBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LOG_HASH)
-          {
-            return DeleteBehavior::LOG;
-          }
-          else if (hashCode == DELETE_FROM_DATABASE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeleteBehavior::DELETE_FROM_DATABASE;
-          }
-          else if (hashCode == DEPRECATE_IN_DATABASE_HASH)
-          {
-            return DeleteBehavior::DEPRECATE_IN_DATABASE;
+          case 75556:
+            if (name == "LOG")
+            {
+              return DeleteBehavior::LOG;
+            }
+            break;
+          case -697784612:
+            if (name == "DELETE_FROM_DATABASE")
+            {
+              return DeleteBehavior::DELETE_FROM_DATABASE;
+            }
+            break;
+          case 1580451015:
+            if (name == "DEPRECATE_IN_DATABASE")
+            {
+              return DeleteBehavior::DEPRECATE_IN_DATABASE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DeleteBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForDeleteBehavior(DeleteBehavior enumValue)
+        const char* GetNameForDeleteBehaviorCStr(DeleteBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeleteBehavior::LOG:
-            return "LOG";
-          case DeleteBehavior::DELETE_FROM_DATABASE:
-            return "DELETE_FROM_DATABASE";
-          case DeleteBehavior::DEPRECATE_IN_DATABASE:
-            return "DEPRECATE_IN_DATABASE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeleteBehavior(DeleteBehavior enumValue)
+        {
+          return GetNameForDeleteBehaviorCStr(enumValue);
         }
 
       } // namespace DeleteBehaviorMapper
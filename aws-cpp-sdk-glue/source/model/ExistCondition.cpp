@@ -30,25 +30,44 @@ namespace Aws
       namespace ExistConditionMapper
       {
 
-        static const int MUST_EXIST_HASH = HashingUtils::HashString("MUST_EXIST");
-        static const int NOT_EXIST_HASH = HashingUtils::HashString("NOT_EXIST");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MUST_EXIST",
+          "NOT_EXIST",
+          "NONE",
+        };
 
         ExistCondition GetExistConditionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MUST_EXIST_HASH)
-          {
-            return ExistCondition::MUST_EXIST;
-          }
-          else if (hashCode == NOT_EXIST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExistCondition::NOT_EXIST;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return ExistCondition::NONE;
+          case 1684976929:
+            if (name == "MUST_EXIST")
+            {
+              return ExistCondition::MUST_EXIST;
+            }
+            break;
+          case 1022620235:
+            if (name == "NOT_EXIST")
+            {
+              return ExistCondition::NOT_EXIST;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return ExistCondition::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ExistCondition::NOT_SET;
         }
 
-        Aws::String GetNameForExistCondition(ExistCondition enumValue)
+        const char* GetNameForExistConditionCStr(ExistCondition enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExistCondition::MUST_EXIST:
-            return "MUST_EXIST";
-          case ExistCondition::NOT_EXIST:
-            return "NOT_EXIST";
-          case ExistCondition::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExistCondition(ExistCondition enumValue)
+        {
+          return GetNameForExistConditionCStr(enumValue);
         }
 
       } // namespace ExistConditionMapper
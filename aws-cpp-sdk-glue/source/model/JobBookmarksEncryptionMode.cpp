@@ -30,20 +30,37 @@ namespace Aws
       namespace JobBookmarksEncryptionModeMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int CSE_KMS_HASH = HashingUtils::HashString("CSE-KMS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "CSE-KMS",
+        };
 
         JobBookmarksEncryptionMode GetJobBookmarksEncryptionModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return JobBookmarksEncryptionMode::DISABLED;
-          }
-          else if (hashCode == CSE_KMS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobBookmarksEncryptionMode::CSE_KMS;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return JobBookmarksEncryptionMode::DISABLED;
+            }
+            break;
+          case 1774562105:
+            if (name == "CSE-KMS")
+            {
+              return JobBookmarksEncryptionMode::CSE_KMS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return JobBookmarksEncryptionMode::NOT_SET;
         }
 
-        Aws::String GetNameForJobBookmarksEncryptionMode(JobBookmarksEncryptionMode enumValue)
+        const char* GetNameForJobBookmarksEncryptionModeCStr(JobBookmarksEncryptionMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobBookmarksEncryptionMode::DISABLED:
-            return "DISABLED";
-          case JobBookmarksEncryptionMode::CSE_KMS:
-            return "CSE-KMS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobBookmarksEncryptionMode(JobBookmarksEncryptionMode enumValue)
+        {
+          return GetNameForJobBookmarksEncryptionModeCStr(enumValue);
         }
 
       } // namespace JobBookmarksEncryptionModeMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace JobRunStateMapper
       {
 
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int TIMEOUT_HASH = HashingUtils::HashString("TIMEOUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STARTING",
+          "RUNNING",
+          "STOPPING",
+          "STOPPED",
+          "SUCCEEDED",
+          "FAILED",
+          "TIMEOUT",
+        };
 
         JobRunState GetJobRunStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTING_HASH)
-          {
-            return JobRunState::STARTING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return JobRunState::RUNNING;
-          }
-          else if (hashCode == STOPPING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobRunState::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return JobRunState::STOPPED;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return JobRunState::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobRunState::FAILED;
-          }
-          else if (hashCode == TIMEOUT_HASH)
-          {
-            return JobRunState::TIMEOUT;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return JobRunState::STARTING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return JobRunState::RUNNING;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return JobRunState::STOPPING;
+            }
+            break;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return JobRunState::STOPPED;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return JobRunState::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return JobRunState::FAILED;
+            }
+            break;
+          case -595928767:
+            if (name == "TIMEOUT")
+            {
+              return JobRunState::TIMEOUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return JobRunState::NOT_SET;
         }
 
-        Aws::String GetNameForJobRunState(JobRunState enumValue)
+        const char* GetNameForJobRunStateCStr(JobRunState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobRunState::STARTING:
-            return "STARTING";
-          case JobRunState::RUNNING:
-            return "RUNNING";
-          case JobRunState::STOPPING:
-            return "STOPPING";
-          case JobRunState::STOPPED:
-            return "STOPPED";
-          case JobRunState::SUCCEEDED:
-            return "SUCCEEDED";
-          case JobRunState::FAILED:
-            return "FAILED";
-          case JobRunState::TIMEOUT:
-            return "TIMEOUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobRunState(JobRunState enumValue)
+        {
+          return GetNameForJobRunStateCStr(enumValue);
         }
 
       } // namespace JobRunStateMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace LanguageMapper
       {
 
-        static const int PYTHON_HASH = HashingUtils::HashString("PYTHON");
-        static const int SCALA_HASH = HashingUtils::HashString("SCALA");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PYTHON",
+          "SCALA",
+        };
 
         Language GetLanguageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PYTHON_HASH)
-          {
-            return Language::PYTHON;
-          }
-          else if (hashCode == SCALA_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Language::SCALA;
+          case -1919867684:
+            if (name == "PYTHON")
+            {
+              return Language::PYTHON;
+            }
+            break;
+          case 78713126:
+            if (name == "SCALA")
+            {
+              return Language::SCALA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Language::NOT_SET;
         }
 
-        Aws::String GetNameForLanguage(Language enumValue)
+        const char* GetNameForLanguageCStr(Language enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Language::PYTHON:
-            return "PYTHON";
-          case Language::SCALA:
-            return "SCALA";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLanguage(Language enumValue)
+        {
+          return GetNameForLanguageCStr(enumValue);
         }
 
       } // namespace LanguageMapper
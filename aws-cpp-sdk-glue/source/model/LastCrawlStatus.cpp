@@ -30,25 +30,44 @@ namespace Aws
       namespace LastCrawlStatusMapper
       {
 
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCEEDED",
+          "CANCELLED",
+          "FAILED",
+        };
 
         LastCrawlStatus GetLastCrawlStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCEEDED_HASH)
-          {
-            return LastCrawlStatus::SUCCEEDED;
-          }
-          else if (hashCode == CANCELLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LastCrawlStatus::CANCELLED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return LastCrawlStatus::FAILED;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return LastCrawlStatus::SUCCEEDED;
+            }
+            break;
+          case -1031784143:
+            if (name == "CANCELLED")
+            {
+              return LastCrawlStatus::CANCELLED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return LastCrawlStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return LastCrawlStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLastCrawlStatus(LastCrawlStatus enumValue)
+        const char* GetNameForLastCrawlStatusCStr(LastCrawlStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LastCrawlStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case LastCrawlStatus::CANCELLED:
-            return "CANCELLED";
-          case LastCrawlStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLastCrawlStatus(LastCrawlStatus enumValue)
+        {
+          return GetNameForLastCrawlStatusCStr(enumValue);
         }
 
       } // namespace LastCrawlStatusMapper
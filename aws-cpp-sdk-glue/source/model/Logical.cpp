@@ -30,20 +30,37 @@ namespace Aws
       namespace LogicalMapper
       {
 
-        static const int AND_HASH = HashingUtils::HashString("AND");
-        static const int ANY_HASH = HashingUtils::HashString("ANY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AND",
+          "ANY",
+        };
 
         Logical GetLogicalForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AND_HASH)
-          {
-            return Logical::AND;
-          }
-          else if (hashCode == ANY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Logical::ANY;
+          case 64951:
+            if (name == "AND")
+            {
+              return Logical::AND;
+            }
+            break;
+          case 64972:
+            if (name == "ANY")
+            {
+              return Logical::ANY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Logical::NOT_SET;
         }
 
-        Aws::String GetNameForLogical(Logical enumValue)
+        const char* GetNameForLogicalCStr(Logical enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Logical::AND:
-            return "AND";
-          case Logical::ANY:
-            return "ANY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLogical(Logical enumValue)
+        {
+          return GetNameForLogicalCStr(enumValue);
         }
 
       } // namespace LogicalMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PrincipalTypeMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int ROLE_HASH = HashingUtils::HashString("ROLE");
-        static const int GROUP_HASH = HashingUtils::HashString("GROUP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USER",
+          "ROLE",
+          "GROUP",
+        };
 
         PrincipalType GetPrincipalTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
-          {
-            return PrincipalType::USER;
-          }
-          else if (hashCode == ROLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PrincipalType::ROLE;
-          }
-          else if (hashCode == GROUP_HASH)
-          {
-            return PrincipalType::GROUP;
+          case 2614219:
+            if (name == "USER")
+            {
+              return PrincipalType::USER;
+            }
+            break;
+          case 2521206:
+            if (name == "ROLE")
+            {
+              return PrincipalType::ROLE;
+            }
+            break;
+          case 68091487:
+            if (name == "GROUP")
+            {
+              return PrincipalType::GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PrincipalType::NOT_SET;
         }
 
-        Aws::String GetNameForPrincipalType(PrincipalType enumValue)
+        const char* GetNameForPrincipalTypeCStr(PrincipalType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PrincipalType::USER:
-            return "USER";
-          case PrincipalType::ROLE:
-            return "ROLE";
-          case PrincipalType::GROUP:
-            return "GROUP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPrincipalType(PrincipalType enumValue)
+        {
+          return GetNameForPrincipalTypeCStr(enumValue);
         }
 
       } // namespace PrincipalTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int JAR_HASH = HashingUtils::HashString("JAR");
-        static const int FILE_HASH = HashingUtils::HashString("FILE");
-        static const int ARCHIVE_HASH = HashingUtils::HashString("ARCHIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "JAR",
+          "FILE",
+          "ARCHIVE",
+        };
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JAR_HASH)
-          {
-            return ResourceType::JAR;
-          }
-          else if (hashCode == FILE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceType::FILE;
-          }
-          else if (hashCode == ARCHIVE_HASH)
-          {
-            return ResourceType::ARCHIVE;
+          case 73211:
+            if (name == "JAR")
+            {
+              return ResourceType::JAR;
+            }
+            break;
+          case 2157948:
+            if (name == "FILE")
+            {
+              return ResourceType::FILE;
+            }
+            break;
+          case -30118750:
+            if (name == "ARCHIVE")
+            {
+              return ResourceType::ARCHIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceTypeCStr(ResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceType::JAR:
-            return "JAR";
-          case ResourceType::FILE:
-            return "FILE";
-          case ResourceType::ARCHIVE:
-            return "ARCHIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceType(ResourceType enumValue)
+        {
+          return GetNameForResourceTypeCStr(enumValue);
         }
 
       } // namespace ResourceTypeMapper
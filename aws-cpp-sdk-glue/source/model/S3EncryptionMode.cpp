@@ -30,25 +30,44 @@ namespace Aws
       namespace S3EncryptionModeMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int SSE_KMS_HASH = HashingUtils::HashString("SSE-KMS");
-        static const int SSE_S3_HASH = HashingUtils::HashString("SSE-S3");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "SSE-KMS",
+          "SSE-S3",
+        };
 
         S3EncryptionMode GetS3EncryptionModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return S3EncryptionMode::DISABLED;
-          }
-          else if (hashCode == SSE_KMS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return S3EncryptionMode::SSE_KMS;
-          }
-          else if (hashCode == SSE_S3_HASH)
-          {
-            return S3EncryptionMode::SSE_S3;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return S3EncryptionMode::DISABLED;
+            }
+            break;
+          case -1205248183:
+            if (name == "SSE-KMS")
+            {
+              return S3EncryptionMode::SSE_KMS;
+            }
+            break;
+          case -1839994072:
+            if (name == "SSE-S3")
+            {
+              return S3EncryptionMode::SSE_S3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return S3EncryptionMode::NOT_SET;
         }
 
-        Aws::String GetNameForS3EncryptionMode(S3EncryptionMode enumValue)
+        const char* GetNameForS3EncryptionModeCStr(S3EncryptionMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case S3EncryptionMode::DISABLED:
-            return "DISABLED";
-          case S3EncryptionMode::SSE_KMS:
-            return "SSE-KMS";
-          case S3EncryptionMode::SSE_S3:
-            return "SSE-S3";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForS3EncryptionMode(S3EncryptionMode enumValue)
+        {
+          return GetNameForS3EncryptionModeCStr(enumValue);
         }
 
       } // namespace S3EncryptionModeMapper
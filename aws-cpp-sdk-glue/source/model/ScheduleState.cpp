@@ -30,25 +30,44 @@ namespace Aws
       namespace ScheduleStateMapper
       {
 
-        static const int SCHEDULED_HASH = HashingUtils::HashString("SCHEDULED");
-        static const int NOT_SCHEDULED_HASH = HashingUtils::HashString("NOT_SCHEDULED");
-        static const int TRANSITIONING_HASH = HashingUtils::HashString("TRANSITIONING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SCHEDULED",
+          "NOT_SCHEDULED",
+          "TRANSITIONING",
+        };
 
         ScheduleState GetScheduleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SCHEDULED_HASH)
-          {
-            return ScheduleState::SCHEDULED;
-          }
-          else if (hashCode == NOT_SCHEDULED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScheduleState::NOT_SCHEDULED;
-          }
-          else if (hashCode == TRANSITIONING_HASH)
-          {
-            return ScheduleState::TRANSITIONING;
+          case -1669082995:
+            if (name == "SCHEDULED")
+            {
+              return ScheduleState::SCHEDULED;
+            }
+            break;
+          case 713913857:
+            if (name == "NOT_SCHEDULED")
+            {
+              return ScheduleState::NOT_SCHEDULED;
+            }
+            break;
+          case -2074622387:
+            if (name == "TRANSITIONING")
+            {
+              return ScheduleState::TRANSITIONING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ScheduleState::NOT_SET;
         }
 
-        Aws::String GetNameForScheduleState(ScheduleState enumValue)
+        const char* GetNameForScheduleStateCStr(ScheduleState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScheduleState::SCHEDULED:
-            return "SCHEDULED";
-          case ScheduleState::NOT_SCHEDULED:
-            return "NOT_SCHEDULED";
-          case ScheduleState::TRANSITIONING:
-            return "TRANSITIONING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScheduleState(ScheduleState enumValue)
+        {
+          return GetNameForScheduleStateCStr(enumValue);
         }
 
       } // namespace ScheduleStateMapper
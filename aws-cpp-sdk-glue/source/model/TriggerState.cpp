@@ -30,50 +30,79 @@ namespace Aws
       namespace TriggerStateMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
-        static const int ACTIVATING_HASH = HashingUtils::HashString("ACTIVATING");
-        static const int ACTIVATED_HASH = HashingUtils::HashString("ACTIVATED");
-        static const int DEACTIVATING_HASH = HashingUtils::HashString("DEACTIVATING");
-        static const int DEACTIVATED_HASH = HashingUtils::HashString("DEACTIVATED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "CREATED",
+          "ACTIVATING",
+          "ACTIVATED",
+          "DEACTIVATING",
+          "DEACTIVATED",
+          "DELETING",
+          "UPDATING",
+        };
 
         TriggerState GetTriggerStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return TriggerState::CREATING;
-          }
-          else if (hashCode == CREATED_HASH)
-          {
-            return TriggerState::CREATED;
-          }
-          else if (hashCode == ACTIVATING_HASH)
-          {
-            return TriggerState::ACTIVATING;
-          }
-          else if (hashCode == ACTIVATED_HASH)
-          {
-            return TriggerState::ACTIVATED;
-          }
-          else if (hashCode == DEACTIVATING_HASH)
-          {
-            return TriggerState::DEACTIVATING;
-          }
-          else if (hashCode == DEACTIVATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TriggerState::DEACTIVATED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return TriggerState::DELETING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return TriggerState::UPDATING;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return TriggerState::CREATING;
+            }
+            break;
+          case 1746537160:
+            if (name == "CREATED")
+            {
+              return TriggerState::CREATED;
+            }
+            break;
+          case -1768657680:
+            if (name == "ACTIVATING")
+            {
+              return TriggerState::ACTIVATING;
+            }
+            break;
+          case -1303979599:
+            if (name == "ACTIVATED")
+            {
+              return TriggerState::ACTIVATED;
+            }
+            break;
+          case -1016559567:
+            if (name == "DEACTIVATING")
+            {
+              return TriggerState::DEACTIVATING;
+            }
+            break;
+          case 382849616:
+            if (name == "DEACTIVATED")
+            {
+              return TriggerState::DEACTIVATED;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return TriggerState::DELETING;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return TriggerState::UPDATING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return TriggerState::NOT_SET;
         }
 
-        Aws::String GetNameForTriggerState(TriggerState enumValue)
+        const char* GetNameForTriggerStateCStr(TriggerState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TriggerState::CREATING:
-            return "CREATING";
-          case TriggerState::CREATED:
-            return "CREATED";
-          case TriggerState::ACTIVATING:
-            return "ACTIVATING";
-          case TriggerState::ACTIVATED:
-            return "ACTIVATED";
-          case TriggerState::DEACTIVATING:
-            return "DEACTIVATING";
-          case TriggerState::DEACTIVATED:
-            return "DEACTIVATED";
-          case TriggerState::DELETING:
-            return "DELETING";
-          case TriggerState::UPDATING:
-            return "UPDATING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTriggerState(TriggerState enumValue)
+        {
+          return GetNameForTriggerStateCStr(enumValue);
         }
 
       } // namespace TriggerStateMapper
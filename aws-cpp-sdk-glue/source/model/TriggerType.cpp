@@ -30,25 +30,44 @@ namespace Aws
       namespace TriggerTypeMapper
       {
 
-        static const int SCHEDULED_HASH = HashingUtils::HashString("SCHEDULED");
-        static const int CONDITIONAL_HASH = HashingUtils::HashString("CONDITIONAL");
-        static const int ON_DEMAND_HASH = HashingUtils::HashString("ON_DEMAND");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SCHEDULED",
+          "CONDITIONAL",
+          "ON_DEMAND",
+        };
 
         TriggerType GetTriggerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SCHEDULED_HASH)
-          {
-            return TriggerType::SCHEDULED;
-          }
-          else if (hashCode == CONDITIONAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TriggerType::CONDITIONAL;
-          }
-          else if (hashCode == ON_DEMAND_HASH)
-          {
-            return TriggerType::ON_DEMAND;
+          case -1669082995:
+            if (name == "SCHEDULED")
+            {
+              return TriggerType::SCHEDULED;
+            }
+            break;
+          case -933875098:
+            if (name == "CONDITIONAL")
+            {
+              return TriggerType::CONDITIONAL;
+            }
+            break;
+          case -2128361301:
+            if (name == "ON_DEMAND")
+            {
+              return TriggerType::ON_DEMAND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TriggerType::NOT_SET;
         }
 
-        Aws::String GetNameForTriggerType(TriggerType enumValue)
+        const char* GetNameForTriggerTypeCStr(TriggerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TriggerType::SCHEDULED:
-            return "SCHEDULED";
-          case TriggerType::CONDITIONAL:
-            return "CONDITIONAL";
-          case TriggerType::ON_DEMAND:
-            return "ON_DEMAND";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTriggerType(TriggerType enumValue)
+        {
+          return GetNameForTriggerTypeCStr(enumValue);
         }
 
       } // namespace TriggerTypeMapper
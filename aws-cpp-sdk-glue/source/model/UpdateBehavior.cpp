@@ -30,20 +30,37 @@ namespace Aws
       namespace UpdateBehaviorMapper
       {
 
-        static const int LOG_HASH = HashingUtils::HashString("LOG");
-        static const int UPDATE_IN_DATABASE_HASH = HashingUtils::HashString("UPDATE_IN_DATABASE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LOG",
+          "UPDATE_IN_DATABASE",
+        };
 
         UpdateBehavior GetUpdateBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LOG_HASH)
-          {
-            return UpdateBehavior::LOG;
-          }
-          else if (hashCode == UPDATE_IN_DATABASE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UpdateBehavior::UPDATE_IN_DATABASE;
+          case 75556:
+            if (name == "LOG")
+            {
+              return UpdateBehavior::LOG;
+            }
+            break;
+          case -129414945:
+            if (name == "UPDATE_IN_DATABASE")
+            {
+              return UpdateBehavior::UPDATE_IN_DATABASE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return UpdateBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateBehavior(UpdateBehavior enumValue)
+        const char* GetNameForUpdateBehaviorCStr(UpdateBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UpdateBehavior::LOG:
-            return "LOG";
-          case UpdateBehavior::UPDATE_IN_DATABASE:
-            return "UPDATE_IN_DATABASE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUpdateBehavior(UpdateBehavior enumValue)
+        {
+          return GetNameForUpdateBehaviorCStr(enumValue);
         }
 
       } // namespace UpdateBehaviorMapper
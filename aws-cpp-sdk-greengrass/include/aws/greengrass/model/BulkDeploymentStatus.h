@@ -39,6 +39,11 @@ namespace BulkDeploymentStatusMapper
 AWS_GREENGRASS_API BulkDeploymentStatus GetBulkDeploymentStatusForName(const Aws::String& name);
 
 AWS_GREENGRASS_API Aws::String GetNameForBulkDeploymentStatus(BulkDeploymentStatus value);
+
+/**
+ * Same as GetNameForBulkDeploymentStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GREENGRASS_API const char* GetNameForBulkDeploymentStatusCStr(BulkDeploymentStatus value);
 } // namespace BulkDeploymentStatusMapper
 } // namespace Model
 } // namespace Greengrass
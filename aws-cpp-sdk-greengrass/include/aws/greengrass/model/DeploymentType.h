@@ -37,6 +37,11 @@ namespace DeploymentTypeMapper
 AWS_GREENGRASS_API DeploymentType GetDeploymentTypeForName(const Aws::String& name);
 
 AWS_GREENGRASS_API Aws::String GetNameForDeploymentType(DeploymentType value);
+
+/**
+ * Same as GetNameForDeploymentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GREENGRASS_API const char* GetNameForDeploymentTypeCStr(DeploymentType value);
 } // namespace DeploymentTypeMapper
 } // namespace Model
 } // namespace Greengrass
@@ -35,6 +35,11 @@ namespace FunctionIsolationModeMapper
 AWS_GREENGRASS_API FunctionIsolationMode GetFunctionIsolationModeForName(const Aws::String& name);
 
 AWS_GREENGRASS_API Aws::String GetNameForFunctionIsolationMode(FunctionIsolationMode value);
+
+/**
+ * Same as GetNameForFunctionIsolationMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GREENGRASS_API const char* GetNameForFunctionIsolationModeCStr(FunctionIsolationMode value);
 } // namespace FunctionIsolationModeMapper
 } // namespace Model
 } // namespace Greengrass
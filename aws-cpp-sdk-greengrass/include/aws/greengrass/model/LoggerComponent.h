@@ -35,6 +35,11 @@ namespace LoggerComponentMapper
 AWS_GREENGRASS_API LoggerComponent GetLoggerComponentForName(const Aws::String& name);
 
 AWS_GREENGRASS_API Aws::String GetNameForLoggerComponent(LoggerComponent value);
+
+/**
+ * Same as GetNameForLoggerComponent(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GREENGRASS_API const char* GetNameForLoggerComponentCStr(LoggerComponent value);
 } // namespace LoggerComponentMapper
 } // namespace Model
 } // namespace Greengrass
@@ -38,6 +38,11 @@ namespace LoggerLevelMapper
 AWS_GREENGRASS_API LoggerLevel GetLoggerLevelForName(const Aws::String& name);
 
 AWS_GREENGRASS_API Aws::String GetNameForLoggerLevel(LoggerLevel value);
+
+/**
+ * Same as GetNameForLoggerLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GREENGRASS_API const char* GetNameForLoggerLevelCStr(LoggerLevel value);
 } // namespace LoggerLevelMapper
 } // namespace Model
 } // namespace Greengrass
@@ -35,6 +35,11 @@ namespace LoggerTypeMapper
 AWS_GREENGRASS_API LoggerType GetLoggerTypeForName(const Aws::String& name);
 
 AWS_GREENGRASS_API Aws::String GetNameForLoggerType(LoggerType value);
+
+/**
+ * Same as GetNameForLoggerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GREENGRASS_API const char* GetNameForLoggerTypeCStr(LoggerType value);
 } // namespace LoggerTypeMapper
 } // namespace Model
 } // namespace Greengrass
@@ -35,6 +35,11 @@ namespace PermissionMapper
 AWS_GREENGRASS_API Permission GetPermissionForName(const Aws::String& name);
 
 AWS_GREENGRASS_API Aws::String GetNameForPermission(Permission value);
+
+/**
+ * Same as GetNameForPermission(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GREENGRASS_API const char* GetNameForPermissionCStr(Permission value);
 } // namespace PermissionMapper
 } // namespace Model
 } // namespace Greengrass
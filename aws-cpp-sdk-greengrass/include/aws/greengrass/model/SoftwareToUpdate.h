@@ -35,6 +35,11 @@ namespace SoftwareToUpdateMapper
 AWS_GREENGRASS_API SoftwareToUpdate GetSoftwareToUpdateForName(const Aws::String& name);
 
 AWS_GREENGRASS_API Aws::String GetNameForSoftwareToUpdate(SoftwareToUpdate value);
+
+/**
+ * Same as GetNameForSoftwareToUpdate(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GREENGRASS_API const char* GetNameForSoftwareToUpdateCStr(SoftwareToUpdate value);
 } // namespace SoftwareToUpdateMapper
 } // namespace Model
 } // namespace Greengrass
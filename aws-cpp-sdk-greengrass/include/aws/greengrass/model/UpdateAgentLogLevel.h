@@ -41,6 +41,11 @@ namespace UpdateAgentLogLevelMapper
 AWS_GREENGRASS_API UpdateAgentLogLevel GetUpdateAgentLogLevelForName(const Aws::String& name);
 
 AWS_GREENGRASS_API Aws::String GetNameForUpdateAgentLogLevel(UpdateAgentLogLevel value);
+
+/**
+ * Same as GetNameForUpdateAgentLogLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GREENGRASS_API const char* GetNameForUpdateAgentLogLevelCStr(UpdateAgentLogLevel value);
 } // namespace UpdateAgentLogLevelMapper
 } // namespace Model
 } // namespace Greengrass
@@ -36,6 +36,11 @@ namespace UpdateTargetsArchitectureMapper
 AWS_GREENGRASS_API UpdateTargetsArchitecture GetUpdateTargetsArchitectureForName(const Aws::String& name);
 
 AWS_GREENGRASS_API Aws::String GetNameForUpdateTargetsArchitecture(UpdateTargetsArchitecture value);
+
+/**
+ * Same as GetNameForUpdateTargetsArchitecture(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GREENGRASS_API const char* GetNameForUpdateTargetsArchitectureCStr(UpdateTargetsArchitecture value);
 } // namespace UpdateTargetsArchitectureMapper
 } // namespace Model
 } // namespace Greengrass
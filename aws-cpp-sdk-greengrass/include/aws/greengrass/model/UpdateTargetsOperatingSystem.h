@@ -36,6 +36,11 @@ namespace UpdateTargetsOperatingSystemMapper
 AWS_GREENGRASS_API UpdateTargetsOperatingSystem GetUpdateTargetsOperatingSystemForName(const Aws::String& name);
 
 AWS_GREENGRASS_API Aws::String GetNameForUpdateTargetsOperatingSystem(UpdateTargetsOperatingSystem value);
+
+/**
+ * Same as GetNameForUpdateTargetsOperatingSystem(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GREENGRASS_API const char* GetNameForUpdateTargetsOperatingSystemCStr(UpdateTargetsOperatingSystem value);
 } // namespace UpdateTargetsOperatingSystemMapper
 } // namespace Model
 } // namespace Greengrass
@@ -30,40 +30,65 @@ namespace Aws
       namespace BulkDeploymentStatusMapper
       {
 
-        static const int Initializing_HASH = HashingUtils::HashString("Initializing");
-        static const int Running_HASH = HashingUtils::HashString("Running");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Initializing",
+          "Running",
+          "Completed",
+          "Stopping",
+          "Stopped",
+          "Failed",
+        };
 
         BulkDeploymentStatus GetBulkDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Initializing_HASH)
-          {
-            return BulkDeploymentStatus::Initializing;
-          }
-          else if (hashCode == Running_HASH)
-          {
-            return BulkDeploymentStatus::Running;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return BulkDeploymentStatus::Completed;
-          }
-          else if (hashCode == Stopping_HASH)
-          {
-            return BulkDeploymentStatus::Stopping;
-          }
-          else if (hashCode == Stopped_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BulkDeploymentStatus::Stopped;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return BulkDeploymentStatus::Failed;
+          case -235759507:
+            if (name == "Initializing")
+            {
+              return BulkDeploymentStatus::Initializing;
+            }
+            break;
+          case -1079530081:
+            if (name == "Running")
+            {
+              return BulkDeploymentStatus::Running;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return BulkDeploymentStatus::Completed;
+            }
+            break;
+          case 1780292756:
+            if (name == "Stopping")
+            {
+              return BulkDeploymentStatus::Stopping;
+            }
+            break;
+          case -219666003:
+            if (name == "Stopped")
+            {
+              return BulkDeploymentStatus::Stopped;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return BulkDeploymentStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return BulkDeploymentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBulkDeploymentStatus(BulkDeploymentStatus enumValue)
+        const char* GetNameForBulkDeploymentStatusCStr(BulkDeploymentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BulkDeploymentStatus::Initializing:
-            return "Initializing";
-          case BulkDeploymentStatus::Running:
-            return "Running";
-          case BulkDeploymentStatus::Completed:
-            return "Completed";
-          case BulkDeploymentStatus::Stopping:
-            return "Stopping";
-          case BulkDeploymentStatus::Stopped:
-            return "Stopped";
-          case BulkDeploymentStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBulkDeploymentStatus(BulkDeploymentStatus enumValue)
+        {
+          return GetNameForBulkDeploymentStatusCStr(enumValue);
         }
 
       } // namespace BulkDeploymentStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace DeploymentTypeMapper
       {
 
-        static const int NewDeployment_HASH = HashingUtils::HashString("NewDeployment");
-        static const int Redeployment_HASH = HashingUtils::HashString("Redeployment");
-        static const int ResetDeployment_HASH = HashingUtils::HashString("ResetDeployment");
-        static const int ForceResetDeployment_HASH = HashingUtils::HashString("ForceResetDeployment");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NewDeployment",
+          "Redeployment",
+          "ResetDeployment",
+          "ForceResetDeployment",
+        };
 
         DeploymentType GetDeploymentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NewDeployment_HASH)
-          {
-            return DeploymentType::NewDeployment;
-          }
-          else if (hashCode == Redeployment_HASH)
-          {
-            return DeploymentType::Redeployment;
-          }
-          else if (hashCode == ResetDeployment_HASH)
-          {
-            return DeploymentType::ResetDeployment;
-          }
-          else if (hashCode == ForceResetDeployment_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentType::ForceResetDeployment;
+          case -708974491:
+            if (name == "NewDeployment")
+            {
+              return DeploymentType::NewDeployment;
+            }
+            break;
+          case -1464059560:
+            if (name == "Redeployment")
+            {
+              return DeploymentType::Redeployment;
+            }
+            break;
+          case 1959286100:
+            if (name == "ResetDeployment")
+            {
+              return DeploymentType::ResetDeployment;
+            }
+            break;
+          case -1323472087:
+            if (name == "ForceResetDeployment")
+            {
+              return DeploymentType::ForceResetDeployment;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DeploymentType::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentType(DeploymentType enumValue)
+        const char* GetNameForDeploymentTypeCStr(DeploymentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentType::NewDeployment:
-            return "NewDeployment";
-          case DeploymentType::Redeployment:
-            return "Redeployment";
-          case DeploymentType::ResetDeployment:
-            return "ResetDeployment";
-          case DeploymentType::ForceResetDeployment:
-            return "ForceResetDeployment";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentType(DeploymentType enumValue)
+        {
+          return GetNameForDeploymentTypeCStr(enumValue);
         }
 
       } // namespace DeploymentTypeMapper
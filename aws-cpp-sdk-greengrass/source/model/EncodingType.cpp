@@ -30,20 +30,37 @@ namespace Aws
       namespace EncodingTypeMapper
       {
 
-        static const int binary_HASH = HashingUtils::HashString("binary");
-        static const int json_HASH = HashingUtils::HashString("json");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "binary",
+          "json",
+        };
 
         EncodingType GetEncodingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == binary_HASH)
-          {
-            return EncodingType::binary;
-          }
-          else if (hashCode == json_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EncodingType::json;
+          case -1388966911:
+            if (name == "binary")
+            {
+              return EncodingType::binary;
+            }
+            break;
+          case 3271912:
+            if (name == "json")
+            {
+              return EncodingType::json;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EncodingType::NOT_SET;
         }
 
-        Aws::String GetNameForEncodingType(EncodingType enumValue)
+        const char* GetNameForEncodingTypeCStr(EncodingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EncodingType::binary:
-            return "binary";
-          case EncodingType::json:
-            return "json";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEncodingType(EncodingType enumValue)
+        {
+          return GetNameForEncodingTypeCStr(enumValue);
         }
 
       } // namespace EncodingTypeMapper
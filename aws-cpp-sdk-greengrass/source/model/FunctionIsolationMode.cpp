@@ -30,20 +30,37 @@ namespace Aws
       namespace FunctionIsolationModeMapper
       {
 
-        static const int GreengrassContainer_HASH = HashingUtils::HashString("GreengrassContainer");
-        static const int NoContainer_HASH = HashingUtils::HashString("NoContainer");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GreengrassContainer",
+          "NoContainer",
+        };
 
         FunctionIsolationMode GetFunctionIsolationModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GreengrassContainer_HASH)
-          {
-            return FunctionIsolationMode::GreengrassContainer;
-          }
-          else if (hashCode == NoContainer_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FunctionIsolationMode::NoContainer;
+          case 10669326:
+            if (name == "GreengrassContainer")
+            {
+              return FunctionIsolationMode::GreengrassContainer;
+            }
+            break;
+          case -1468403808:
+            if (name == "NoContainer")
+            {
+              return FunctionIsolationMode::NoContainer;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FunctionIsolationMode::NOT_SET;
         }
 
-        Aws::String GetNameForFunctionIsolationMode(FunctionIsolationMode enumValue)
+        const char* GetNameForFunctionIsolationModeCStr(FunctionIsolationMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FunctionIsolationMode::GreengrassContainer:
-            return "GreengrassContainer";
-          case FunctionIsolationMode::NoContainer:
-            return "NoContainer";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFunctionIsolationMode(FunctionIsolationMode enumValue)
+        {
+          return GetNameForFunctionIsolationModeCStr(enumValue);
         }
 
       } // namespace FunctionIsolationModeMapper
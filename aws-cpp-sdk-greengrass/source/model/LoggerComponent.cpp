@@ -30,20 +30,37 @@ namespace Aws
       namespace LoggerComponentMapper
       {
 
-        static const int GreengrassSystem_HASH = HashingUtils::HashString("GreengrassSystem");
-        static const int Lambda_HASH = HashingUtils::HashString("Lambda");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GreengrassSystem",
+          "Lambda",
+        };
 
         LoggerComponent GetLoggerComponentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GreengrassSystem_HASH)
-          {
-            return LoggerComponent::GreengrassSystem;
-          }
-          else if (hashCode == Lambda_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoggerComponent::Lambda;
+          case -127105854:
+            if (name == "GreengrassSystem")
+            {
+              return LoggerComponent::GreengrassSystem;
+            }
+            break;
+          case -2026225689:
+            if (name == "Lambda")
+            {
+              return LoggerComponent::Lambda;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LoggerComponent::NOT_SET;
         }
 
-        Aws::String GetNameForLoggerComponent(LoggerComponent enumValue)
+        const char* GetNameForLoggerComponentCStr(LoggerComponent enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoggerComponent::GreengrassSystem:
-            return "GreengrassSystem";
-          case LoggerComponent::Lambda:
-            return "Lambda";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoggerComponent(LoggerComponent enumValue)
+        {
+          return GetNameForLoggerComponentCStr(enumValue);
         }
 
       } // namespace LoggerComponentMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace LoggerLevelMapper
       {
 
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int WARN_HASH = HashingUtils::HashString("WARN");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int FATAL_HASH = HashingUtils::HashString("FATAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEBUG",
+          "INFO",
+          "WARN",
+          "ERROR",
+          "FATAL",
+        };
 
         LoggerLevel GetLoggerLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEBUG__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoggerLevel::DEBUG_;
-          }
-          else if (hashCode == INFO_HASH)
-          {
-            return LoggerLevel::INFO;
-          }
-          else if (hashCode == WARN_HASH)
-          {
-            return LoggerLevel::WARN;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return LoggerLevel::ERROR_;
-          }
-          else if (hashCode == FATAL_HASH)
-          {
-            return LoggerLevel::FATAL;
+          case 64921139:
+            if (name == "DEBUG")
+            {
+              return LoggerLevel::DEBUG_;
+            }
+            break;
+          case 2251950:
+            if (name == "INFO")
+            {
+              return LoggerLevel::INFO;
+            }
+            break;
+          case 2656902:
+            if (name == "WARN")
+            {
+              return LoggerLevel::WARN;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return LoggerLevel::ERROR_;
+            }
+            break;
+          case 66665700:
+            if (name == "FATAL")
+            {
+              return LoggerLevel::FATAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return LoggerLevel::NOT_SET;
         }
 
-        Aws::String GetNameForLoggerLevel(LoggerLevel enumValue)
+        const char* GetNameForLoggerLevelCStr(LoggerLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoggerLevel::DEBUG_:
-            return "DEBUG";
-          case LoggerLevel::INFO:
-            return "INFO";
-          case LoggerLevel::WARN:
-            return "WARN";
-          case LoggerLevel::ERROR_:
-            return "ERROR";
-          case LoggerLevel::FATAL:
-            return "FATAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoggerLevel(LoggerLevel enumValue)
+        {
+          return GetNameForLoggerLevelCStr(enumValue);
         }
 
       } // namespace LoggerLevelMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace LoggerTypeMapper
       {
 
-        static const int FileSystem_HASH = HashingUtils::HashString("FileSystem");
-        static const int AWSCloudWatch_HASH = HashingUtils::HashString("AWSCloudWatch");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FileSystem",
+          "AWSCloudWatch",
+        };
 
         LoggerType GetLoggerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FileSystem_HASH)
-          {
-            return LoggerType::FileSystem;
-          }
-          else if (hashCode == AWSCloudWatch_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoggerType::AWSCloudWatch;
+          case -495181077:
+            if (name == "FileSystem")
+            {
+              return LoggerType::FileSystem;
+            }
+            break;
+          case -698795433:
+            if (name == "AWSCloudWatch")
+            {
+              return LoggerType::AWSCloudWatch;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LoggerType::NOT_SET;
         }
 
-        Aws::String GetNameForLoggerType(LoggerType enumValue)
+        const char* GetNameForLoggerTypeCStr(LoggerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoggerType::FileSystem:
-            return "FileSystem";
-          case LoggerType::AWSCloudWatch:
-            return "AWSCloudWatch";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoggerType(LoggerType enumValue)
+        {
+          return GetNameForLoggerTypeCStr(enumValue);
         }
 
       } // namespace LoggerTypeMapper
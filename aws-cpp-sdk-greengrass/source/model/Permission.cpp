@@ -30,20 +30,37 @@ namespace Aws
       namespace PermissionMapper
       {
 
-        static const int ro_HASH = HashingUtils::HashString("ro");
-        static const int rw_HASH = HashingUtils::HashString("rw");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ro",
+          "rw",
+        };
 
         Permission GetPermissionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ro_HASH)
-          {
-            return Permission::ro;
-          }
-          else if (hashCode == rw_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Permission::rw;
+          case 3645:
+            if (name == "ro")
+            {
+              return Permission::ro;
+            }
+            break;
+          case 3653:
+            if (name == "rw")
+            {
+              return Permission::rw;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Permission::NOT_SET;
         }
 
-        Aws::String GetNameForPermission(Permission enumValue)
+        const char* GetNameForPermissionCStr(Permission enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Permission::ro:
-            return "ro";
-          case Permission::rw:
-            return "rw";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPermission(Permission enumValue)
+        {
+          return GetNameForPermissionCStr(enumValue);
         }
 
       } // namespace PermissionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SoftwareToUpdateMapper
       {
 
-        static const int core_HASH = HashingUtils::HashString("core");
-        static const int ota_agent_HASH = HashingUtils::HashString("ota_agent");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "core",
+          "ota_agent",
+        };
 
         SoftwareToUpdate GetSoftwareToUpdateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == core_HASH)
-          {
-            return SoftwareToUpdate::core;
-          }
-          else if (hashCode == ota_agent_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SoftwareToUpdate::ota_agent;
+          case 3059615:
+            if (name == "core")
+            {
+              return SoftwareToUpdate::core;
+            }
+            break;
+          case 244617250:
+            if (name == "ota_agent")
+            {
+              return SoftwareToUpdate::ota_agent;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SoftwareToUpdate::NOT_SET;
         }
 
-        Aws::String GetNameForSoftwareToUpdate(SoftwareToUpdate enumValue)
+        const char* GetNameForSoftwareToUpdateCStr(SoftwareToUpdate enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SoftwareToUpdate::core:
-            return "core";
-          case SoftwareToUpdate::ota_agent:
-            return "ota_agent";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSoftwareToUpdate(SoftwareToUpdate enumValue)
+        {
+          return GetNameForSoftwareToUpdateCStr(enumValue);
         }
 
       } // namespace SoftwareToUpdateMapper
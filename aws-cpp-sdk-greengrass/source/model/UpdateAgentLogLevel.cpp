@@ -30,50 +30,79 @@ namespace Aws
       namespace UpdateAgentLogLevelMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int TRACE_HASH = HashingUtils::HashString("TRACE");
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int VERBOSE_HASH = HashingUtils::HashString("VERBOSE");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int WARN_HASH = HashingUtils::HashString("WARN");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int FATAL_HASH = HashingUtils::HashString("FATAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "TRACE",
+          "DEBUG",
+          "VERBOSE",
+          "INFO",
+          "WARN",
+          "ERROR",
+          "FATAL",
+        };
 
         UpdateAgentLogLevel GetUpdateAgentLogLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return UpdateAgentLogLevel::NONE;
-          }
-          else if (hashCode == TRACE_HASH)
-          {
-            return UpdateAgentLogLevel::TRACE;
-          }
-          else if (hashCode == DEBUG__HASH)
-          {
-            return UpdateAgentLogLevel::DEBUG_;
-          }
-          else if (hashCode == VERBOSE_HASH)
-          {
-            return UpdateAgentLogLevel::VERBOSE;
-          }
-          else if (hashCode == INFO_HASH)
-          {
-            return UpdateAgentLogLevel::INFO;
-          }
-          else if (hashCode == WARN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UpdateAgentLogLevel::WARN;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return UpdateAgentLogLevel::ERROR_;
-          }
-          else if (hashCode == FATAL_HASH)
-          {
-            return UpdateAgentLogLevel::FATAL;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return UpdateAgentLogLevel::NONE;
+            }
+            break;
+          case 80083237:
+            if (name == "TRACE")
+            {
+              return UpdateAgentLogLevel::TRACE;
+            }
+            break;
+          case 64921139:
+            if (name == "DEBUG")
+            {
+              return UpdateAgentLogLevel::DEBUG_;
+            }
+            break;
+          case 1069090146:
+            if (name == "VERBOSE")
+            {
+              return UpdateAgentLogLevel::VERBOSE;
+            }
+            break;
+          case 2251950:
+            if (name == "INFO")
+            {
+              return UpdateAgentLogLevel::INFO;
+            }
+            break;
+          case 2656902:
+            if (name == "WARN")
+            {
+              return UpdateAgentLogLevel::WARN;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return UpdateAgentLogLevel::ERROR_;
+            }
+            break;
+          case 66665700:
+            if (name == "FATAL")
+            {
+              return UpdateAgentLogLevel::FATAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return UpdateAgentLogLevel::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateAgentLogLevel(UpdateAgentLogLevel enumValue)
+        const char* GetNameForUpdateAgentLogLevelCStr(UpdateAgentLogLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UpdateAgentLogLevel::NONE:
-            return "NONE";
-          case UpdateAgentLogLevel::TRACE:
-            return "TRACE";
-          case UpdateAgentLogLevel::DEBUG_:
-            return "DEBUG";
-          case UpdateAgentLogLevel::VERBOSE:
-            return "VERBOSE";
-          case UpdateAgentLogLevel::INFO:
-            return "INFO";
-          case UpdateAgentLogLevel::WARN:
-            return "WARN";
-          case UpdateAgentLogLevel::ERROR_:
-            return "ERROR";
-          case UpdateAgentLogLevel::FATAL:
-            return "FATAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUpdateAgentLogLevel(UpdateAgentLogLevel enumValue)
+        {
+          return GetNameForUpdateAgentLogLevelCStr(enumValue);
         }
 
       } // namespace UpdateAgentLogLevelMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace UpdateTargetsArchitectureMapper
       {
 
-        static const int armv7l_HASH = HashingUtils::HashString("armv7l");
-        static const int x86_64_HASH = HashingUtils::HashString("x86_64");
-        static const int aarch64_HASH = HashingUtils::HashString("aarch64");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "armv7l",
+          "x86_64",
+          "aarch64",
+        };
 
         UpdateTargetsArchitecture GetUpdateTargetsArchitectureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == armv7l_HASH)
-          {
-            return UpdateTargetsArchitecture::armv7l;
-          }
-          else if (hashCode == x86_64_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UpdateTargetsArchitecture::x86_64;
-          }
-          else if (hashCode == aarch64_HASH)
-          {
-            return UpdateTargetsArchitecture::aarch64;
+          case -1409295825:
+            if (name == "armv7l")
+            {
+              return UpdateTargetsArchitecture::armv7l;
+            }
+            break;
+          case -806050265:
+            if (name == "x86_64")
+            {
+              return UpdateTargetsArchitecture::x86_64;
+            }
+            break;
+          case -1221096139:
+            if (name == "aarch64")
+            {
+              return UpdateTargetsArchitecture::aarch64;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return UpdateTargetsArchitecture::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateTargetsArchitecture(UpdateTargetsArchitecture enumValue)
+        const char* GetNameForUpdateTargetsArchitectureCStr(UpdateTargetsArchitecture enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UpdateTargetsArchitecture::armv7l:
-            return "armv7l";
-          case UpdateTargetsArchitecture::x86_64:
-            return "x86_64";
-          case UpdateTargetsArchitecture::aarch64:
-            return "aarch64";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUpdateTargetsArchitecture(UpdateTargetsArchitecture enumValue)
+        {
+          return GetNameForUpdateTargetsArchitectureCStr(enumValue);
         }
 
       } // namespace UpdateTargetsArchitectureMapper
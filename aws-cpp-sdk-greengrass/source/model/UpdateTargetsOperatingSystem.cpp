@@ -30,25 +30,44 @@ namespace Aws
       namespace UpdateTargetsOperatingSystemMapper
       {
 
-        static const int ubuntu_HASH = HashingUtils::HashString("ubuntu");
-        static const int raspbian_HASH = HashingUtils::HashString("raspbian");
-        static const int amazon_linux_HASH = HashingUtils::HashString("amazon_linux");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ubuntu",
+          "raspbian",
+          "amazon_linux",
+        };
 
         UpdateTargetsOperatingSystem GetUpdateTargetsOperatingSystemForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ubuntu_HASH)
-          {
-            return UpdateTargetsOperatingSystem::ubuntu;
-          }
-          else if (hashCode == raspbian_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UpdateTargetsOperatingSystem::raspbian;
-          }
-          else if (hashCode == amazon_linux_HASH)
-          {
-            return UpdateTargetsOperatingSystem::amazon_linux;
+          case -851256601:
+            if (name == "ubuntu")
+            {
+              return UpdateTargetsOperatingSystem::ubuntu;
+            }
+            break;
+          case 404236672:
+            if (name == "raspbian")
+            {
+              return UpdateTargetsOperatingSystem::raspbian;
+            }
+            break;
+          case -168810759:
+            if (name == "amazon_linux")
+            {
+              return UpdateTargetsOperatingSystem::amazon_linux;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return UpdateTargetsOperatingSystem::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateTargetsOperatingSystem(UpdateTargetsOperatingSystem enumValue)
+        const char* GetNameForUpdateTargetsOperatingSystemCStr(UpdateTargetsOperatingSystem enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UpdateTargetsOperatingSystem::ubuntu:
-            return "ubuntu";
-          case UpdateTargetsOperatingSystem::raspbian:
-            return "raspbian";
-          case UpdateTargetsOperatingSystem::amazon_linux:
-            return "amazon_linux";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUpdateTargetsOperatingSystem(UpdateTargetsOperatingSystem enumValue)
+        {
+          return GetNameForUpdateTargetsOperatingSystemCStr(enumValue);
         }
 
       } // namespace UpdateTargetsOperatingSystemMapper
@@ -35,6 +35,11 @@ namespace DetectorStatusMapper
 AWS_GUARDDUTY_API DetectorStatus GetDetectorStatusForName(const Aws::String& name);
 
 AWS_GUARDDUTY_API Aws::String GetNameForDetectorStatus(DetectorStatus value);
+
+/**
+ * Same as GetNameForDetectorStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GUARDDUTY_API const char* GetNameForDetectorStatusCStr(DetectorStatus value);
 } // namespace DetectorStatusMapper
 } // namespace Model
 } // namespace GuardDuty
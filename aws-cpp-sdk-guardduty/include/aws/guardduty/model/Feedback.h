@@ -35,6 +35,11 @@ namespace FeedbackMapper
 AWS_GUARDDUTY_API Feedback GetFeedbackForName(const Aws::String& name);
 
 AWS_GUARDDUTY_API Aws::String GetNameForFeedback(Feedback value);
+
+/**
+ * Same as GetNameForFeedback(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GUARDDUTY_API const char* GetNameForFeedbackCStr(Feedback value);
 } // namespace FeedbackMapper
 } // namespace Model
 } // namespace GuardDuty
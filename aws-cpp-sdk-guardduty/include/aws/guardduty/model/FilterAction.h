@@ -35,6 +35,11 @@ namespace FilterActionMapper
 AWS_GUARDDUTY_API FilterAction GetFilterActionForName(const Aws::String& name);
 
 AWS_GUARDDUTY_API Aws::String GetNameForFilterAction(FilterAction value);
+
+/**
+ * Same as GetNameForFilterAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GUARDDUTY_API const char* GetNameForFilterActionCStr(FilterAction value);
 } // namespace FilterActionMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -36,6 +36,11 @@ namespace FindingPublishingFrequencyMapper
 AWS_GUARDDUTY_API FindingPublishingFrequency GetFindingPublishingFrequencyForName(const Aws::String& name);
 
 AWS_GUARDDUTY_API Aws::String GetNameForFindingPublishingFrequency(FindingPublishingFrequency value);
+
+/**
+ * Same as GetNameForFindingPublishingFrequency(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GUARDDUTY_API const char* GetNameForFindingPublishingFrequencyCStr(FindingPublishingFrequency value);
 } // namespace FindingPublishingFrequencyMapper
 } // namespace Model
 } // namespace GuardDuty
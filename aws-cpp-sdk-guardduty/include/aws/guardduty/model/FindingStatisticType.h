@@ -34,6 +34,11 @@ namespace FindingStatisticTypeMapper
 AWS_GUARDDUTY_API FindingStatisticType GetFindingStatisticTypeForName(const Aws::String& name);
 
 AWS_GUARDDUTY_API Aws::String GetNameForFindingStatisticType(FindingStatisticType value);
+
+/**
+ * Same as GetNameForFindingStatisticType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GUARDDUTY_API const char* GetNameForFindingStatisticTypeCStr(FindingStatisticType value);
 } // namespace FindingStatisticTypeMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -39,6 +39,11 @@ namespace IpSetFormatMapper
 AWS_GUARDDUTY_API IpSetFormat GetIpSetFormatForName(const Aws::String& name);
 
 AWS_GUARDDUTY_API Aws::String GetNameForIpSetFormat(IpSetFormat value);
+
+/**
+ * Same as GetNameForIpSetFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GUARDDUTY_API const char* GetNameForIpSetFormatCStr(IpSetFormat value);
 } // namespace IpSetFormatMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -40,6 +40,11 @@ namespace IpSetStatusMapper
 AWS_GUARDDUTY_API IpSetStatus GetIpSetStatusForName(const Aws::String& name);
 
 AWS_GUARDDUTY_API Aws::String GetNameForIpSetStatus(IpSetStatus value);
+
+/**
+ * Same as GetNameForIpSetStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GUARDDUTY_API const char* GetNameForIpSetStatusCStr(IpSetStatus value);
 } // namespace IpSetStatusMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -35,6 +35,11 @@ namespace OrderByMapper
 AWS_GUARDDUTY_API OrderBy GetOrderByForName(const Aws::String& name);
 
 AWS_GUARDDUTY_API Aws::String GetNameForOrderBy(OrderBy value);
+
+/**
+ * Same as GetNameForOrderBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GUARDDUTY_API const char* GetNameForOrderByCStr(OrderBy value);
 } // namespace OrderByMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -39,6 +39,11 @@ namespace ThreatIntelSetFormatMapper
 AWS_GUARDDUTY_API ThreatIntelSetFormat GetThreatIntelSetFormatForName(const Aws::String& name);
 
 AWS_GUARDDUTY_API Aws::String GetNameForThreatIntelSetFormat(ThreatIntelSetFormat value);
+
+/**
+ * Same as GetNameForThreatIntelSetFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GUARDDUTY_API const char* GetNameForThreatIntelSetFormatCStr(ThreatIntelSetFormat value);
 } // namespace ThreatIntelSetFormatMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -40,6 +40,11 @@ namespace ThreatIntelSetStatusMapper
 AWS_GUARDDUTY_API ThreatIntelSetStatus GetThreatIntelSetStatusForName(const Aws::String& name);
 
 AWS_GUARDDUTY_API Aws::String GetNameForThreatIntelSetStatus(ThreatIntelSetStatus value);
+
+/**
+ * Same as GetNameForThreatIntelSetStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_GUARDDUTY_API const char* GetNameForThreatIntelSetStatusCStr(ThreatIntelSetStatus value);
 } // namespace ThreatIntelSetStatusMapper
 } // namespace Model
 } // namespace GuardDuty
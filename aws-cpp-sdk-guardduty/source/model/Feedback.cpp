@@ -30,20 +30,37 @@ namespace Aws
       namespace FeedbackMapper
       {
 
-        static const int USEFUL_HASH = HashingUtils::HashString("USEFUL");
-        static const int NOT_USEFUL_HASH = HashingUtils::HashString("NOT_USEFUL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USEFUL",
+          "NOT_USEFUL",
+        };
 
         Feedback GetFeedbackForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USEFUL_HASH)
-          {
-            return Feedback::USEFUL;
-          }
-          else if (hashCode == NOT_USEFUL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Feedback::NOT_USEFUL;
+          case -1782711658:
+            if (name == "USEFUL")
+            {
+              return Feedback::USEFUL;
+            }
+            break;
+          case 2089773474:
+            if (name == "NOT_USEFUL")
+            {
+              return Feedback::NOT_USEFUL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Feedback::NOT_SET;
         }
 
-        Aws::String GetNameForFeedback(Feedback enumValue)
+        const char* GetNameForFeedbackCStr(Feedback enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Feedback::USEFUL:
-            return "USEFUL";
-          case Feedback::NOT_USEFUL:
-            return "NOT_USEFUL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFeedback(Feedback enumValue)
+        {
+          return GetNameForFeedbackCStr(enumValue);
         }
 
       } // namespace FeedbackMapper
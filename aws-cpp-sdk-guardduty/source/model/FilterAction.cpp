@@ -30,20 +30,37 @@ namespace Aws
       namespace FilterActionMapper
       {
 
-        static const int NOOP_HASH = HashingUtils::HashString("NOOP");
-        static const int ARCHIVE_HASH = HashingUtils::HashString("ARCHIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NOOP",
+          "ARCHIVE",
+        };
 
         FilterAction GetFilterActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOOP_HASH)
-          {
-            return FilterAction::NOOP;
-          }
-          else if (hashCode == ARCHIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FilterAction::ARCHIVE;
+          case 2402146:
+            if (name == "NOOP")
+            {
+              return FilterAction::NOOP;
+            }
+            break;
+          case -30118750:
+            if (name == "ARCHIVE")
+            {
+              return FilterAction::ARCHIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FilterAction::NOT_SET;
         }
 
-        Aws::String GetNameForFilterAction(FilterAction enumValue)
+        const char* GetNameForFilterActionCStr(FilterAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FilterAction::NOOP:
-            return "NOOP";
-          case FilterAction::ARCHIVE:
-            return "ARCHIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFilterAction(FilterAction enumValue)
+        {
+          return GetNameForFilterActionCStr(enumValue);
         }
 
       } // namespace FilterActionMapper
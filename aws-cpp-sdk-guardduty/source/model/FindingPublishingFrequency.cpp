@@ -30,25 +30,44 @@ namespace Aws
       namespace FindingPublishingFrequencyMapper
       {
 
-        static const int FIFTEEN_MINUTES_HASH = HashingUtils::HashString("FIFTEEN_MINUTES");
-        static const int ONE_HOUR_HASH = HashingUtils::HashString("ONE_HOUR");
-        static const int SIX_HOURS_HASH = HashingUtils::HashString("SIX_HOURS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FIFTEEN_MINUTES",
+          "ONE_HOUR",
+          "SIX_HOURS",
+        };
 
         FindingPublishingFrequency GetFindingPublishingFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FIFTEEN_MINUTES_HASH)
-          {
-            return FindingPublishingFrequency::FIFTEEN_MINUTES;
-          }
-          else if (hashCode == ONE_HOUR_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FindingPublishingFrequency::ONE_HOUR;
-          }
-          else if (hashCode == SIX_HOURS_HASH)
-          {
-            return FindingPublishingFrequency::SIX_HOURS;
+          case -713464899:
+            if (name == "FIFTEEN_MINUTES")
+            {
+              return FindingPublishingFrequency::FIFTEEN_MINUTES;
+            }
+            break;
+          case -1480724419:
+            if (name == "ONE_HOUR")
+            {
+              return FindingPublishingFrequency::ONE_HOUR;
+            }
+            break;
+          case -2034083534:
+            if (name == "SIX_HOURS")
+            {
+              return FindingPublishingFrequency::SIX_HOURS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FindingPublishingFrequency::NOT_SET;
         }
 
-        Aws::String GetNameForFindingPublishingFrequency(FindingPublishingFrequency enumValue)
+        const char* GetNameForFindingPublishingFrequencyCStr(FindingPublishingFrequency enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FindingPublishingFrequency::FIFTEEN_MINUTES:
-            return "FIFTEEN_MINUTES";
-          case FindingPublishingFrequency::ONE_HOUR:
-            return "ONE_HOUR";
-          case FindingPublishingFrequency::SIX_HOURS:
-            return "SIX_HOURS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFindingPublishingFrequency(FindingPublishingFrequency enumValue)
+        {
+          return GetNameForFindingPublishingFrequencyCStr(enumValue);
         }
 
       } // namespace FindingPublishingFrequencyMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace FindingStatisticTypeMapper
       {
 
-        static const int COUNT_BY_SEVERITY_HASH = HashingUtils::HashString("COUNT_BY_SEVERITY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COUNT_BY_SEVERITY",
+        };
 
         FindingStatisticType GetFindingStatisticTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COUNT_BY_SEVERITY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FindingStatisticType::COUNT_BY_SEVERITY;
+          case 1517774485:
+            if (name == "COUNT_BY_SEVERITY")
+            {
+              return FindingStatisticType::COUNT_BY_SEVERITY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return FindingStatisticType::NOT_SET;
         }
 
-        Aws::String GetNameForFindingStatisticType(FindingStatisticType enumValue)
+        const char* GetNameForFindingStatisticTypeCStr(FindingStatisticType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FindingStatisticType::COUNT_BY_SEVERITY:
-            return "COUNT_BY_SEVERITY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFindingStatisticType(FindingStatisticType enumValue)
+        {
+          return GetNameForFindingStatisticTypeCStr(enumValue);
         }
 
       } // namespace FindingStatisticTypeMapper
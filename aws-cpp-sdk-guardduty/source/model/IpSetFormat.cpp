@@ -30,40 +30,65 @@ namespace Aws
       namespace IpSetFormatMapper
       {
 
-        static const int TXT_HASH = HashingUtils::HashString("TXT");
-        static const int STIX_HASH = HashingUtils::HashString("STIX");
-        static const int OTX_CSV_HASH = HashingUtils::HashString("OTX_CSV");
-        static const int ALIEN_VAULT_HASH = HashingUtils::HashString("ALIEN_VAULT");
-        static const int PROOF_POINT_HASH = HashingUtils::HashString("PROOF_POINT");
-        static const int FIRE_EYE_HASH = HashingUtils::HashString("FIRE_EYE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TXT",
+          "STIX",
+          "OTX_CSV",
+          "ALIEN_VAULT",
+          "PROOF_POINT",
+          "FIRE_EYE",
+        };
 
         IpSetFormat GetIpSetFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TXT_HASH)
-          {
-            return IpSetFormat::TXT;
-          }
-          else if (hashCode == STIX_HASH)
-          {
-            return IpSetFormat::STIX;
-          }
-          else if (hashCode == OTX_CSV_HASH)
-          {
-            return IpSetFormat::OTX_CSV;
-          }
-          else if (hashCode == ALIEN_VAULT_HASH)
-          {
-            return IpSetFormat::ALIEN_VAULT;
-          }
-          else if (hashCode == PROOF_POINT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IpSetFormat::PROOF_POINT;
-          }
-          else if (hashCode == FIRE_EYE_HASH)
-          {
-            return IpSetFormat::FIRE_EYE;
+          case 83536:
+            if (name == "TXT")
+            {
+              return IpSetFormat::TXT;
+            }
+            break;
+          case 2555728:
+            if (name == "STIX")
+            {
+              return IpSetFormat::STIX;
+            }
+            break;
+          case -412637510:
+            if (name == "OTX_CSV")
+            {
+              return IpSetFormat::OTX_CSV;
+            }
+            break;
+          case 1613816442:
+            if (name == "ALIEN_VAULT")
+            {
+              return IpSetFormat::ALIEN_VAULT;
+            }
+            break;
+          case -1271519595:
+            if (name == "PROOF_POINT")
+            {
+              return IpSetFormat::PROOF_POINT;
+            }
+            break;
+          case 220143752:
+            if (name == "FIRE_EYE")
+            {
+              return IpSetFormat::FIRE_EYE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return IpSetFormat::NOT_SET;
         }
 
-        Aws::String GetNameForIpSetFormat(IpSetFormat enumValue)
+        const char* GetNameForIpSetFormatCStr(IpSetFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IpSetFormat::TXT:
-            return "TXT";
-          case IpSetFormat::STIX:
-            return "STIX";
-          case IpSetFormat::OTX_CSV:
-            return "OTX_CSV";
-          case IpSetFormat::ALIEN_VAULT:
-            return "ALIEN_VAULT";
-          case IpSetFormat::PROOF_POINT:
-            return "PROOF_POINT";
-          case IpSetFormat::FIRE_EYE:
-            return "FIRE_EYE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIpSetFormat(IpSetFormat enumValue)
+        {
+          return GetNameForIpSetFormatCStr(enumValue);
         }
 
       } // namespace IpSetFormatMapper
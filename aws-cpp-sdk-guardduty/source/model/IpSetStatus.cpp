@@ -30,45 +30,72 @@ namespace Aws
       namespace IpSetStatusMapper
       {
 
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int ACTIVATING_HASH = HashingUtils::HashString("ACTIVATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DEACTIVATING_HASH = HashingUtils::HashString("DEACTIVATING");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int DELETE_PENDING_HASH = HashingUtils::HashString("DELETE_PENDING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INACTIVE",
+          "ACTIVATING",
+          "ACTIVE",
+          "DEACTIVATING",
+          "ERROR",
+          "DELETE_PENDING",
+          "DELETED",
+        };
 
         IpSetStatus GetIpSetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INACTIVE_HASH)
-          {
-            return IpSetStatus::INACTIVE;
-          }
-          else if (hashCode == ACTIVATING_HASH)
-          {
-            return IpSetStatus::ACTIVATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IpSetStatus::ACTIVE;
-          }
-          else if (hashCode == DEACTIVATING_HASH)
-          {
-            return IpSetStatus::DEACTIVATING;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return IpSetStatus::ERROR_;
-          }
-          else if (hashCode == DELETE_PENDING_HASH)
-          {
-            return IpSetStatus::DELETE_PENDING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return IpSetStatus::DELETED;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return IpSetStatus::INACTIVE;
+            }
+            break;
+          case -1768657680:
+            if (name == "ACTIVATING")
+            {
+              return IpSetStatus::ACTIVATING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return IpSetStatus::ACTIVE;
+            }
+            break;
+          case -1016559567:
+            if (name == "DEACTIVATING")
+            {
+              return IpSetStatus::DEACTIVATING;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return IpSetStatus::ERROR_;
+            }
+            break;
+          case 1607621347:
+            if (name == "DELETE_PENDING")
+            {
+              return IpSetStatus::DELETE_PENDING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return IpSetStatus::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return IpSetStatus::NOT_SET;
         }
 
-        Aws::String GetNameForIpSetStatus(IpSetStatus enumValue)
+        const char* GetNameForIpSetStatusCStr(IpSetStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IpSetStatus::INACTIVE:
-            return "INACTIVE";
-          case IpSetStatus::ACTIVATING:
-            return "ACTIVATING";
-          case IpSetStatus::ACTIVE:
-            return "ACTIVE";
-          case IpSetStatus::DEACTIVATING:
-            return "DEACTIVATING";
-          case IpSetStatus::ERROR_:
-            return "ERROR";
-          case IpSetStatus::DELETE_PENDING:
-            return "DELETE_PENDING";
-          case IpSetStatus::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIpSetStatus(IpSetStatus enumValue)
+        {
+          return GetNameForIpSetStatusCStr(enumValue);
         }
 
       } // namespace IpSetStatusMapper
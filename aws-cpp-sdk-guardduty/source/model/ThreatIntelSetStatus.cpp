@@ -30,45 +30,72 @@ namespace Aws
       namespace ThreatIntelSetStatusMapper
       {
 
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int ACTIVATING_HASH = HashingUtils::HashString("ACTIVATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DEACTIVATING_HASH = HashingUtils::HashString("DEACTIVATING");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int DELETE_PENDING_HASH = HashingUtils::HashString("DELETE_PENDING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INACTIVE",
+          "ACTIVATING",
+          "ACTIVE",
+          "DEACTIVATING",
+          "ERROR",
+          "DELETE_PENDING",
+          "DELETED",
+        };
 
         ThreatIntelSetStatus GetThreatIntelSetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INACTIVE_HASH)
-          {
-            return ThreatIntelSetStatus::INACTIVE;
-          }
-          else if (hashCode == ACTIVATING_HASH)
-          {
-            return ThreatIntelSetStatus::ACTIVATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ThreatIntelSetStatus::ACTIVE;
-          }
-          else if (hashCode == DEACTIVATING_HASH)
-          {
-            return ThreatIntelSetStatus::DEACTIVATING;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return ThreatIntelSetStatus::ERROR_;
-          }
-          else if (hashCode == DELETE_PENDING_HASH)
-          {
-            return ThreatIntelSetStatus::DELETE_PENDING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ThreatIntelSetStatus::DELETED;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return ThreatIntelSetStatus::INACTIVE;
+            }
+            break;
+          case -1768657680:
+            if (name == "ACTIVATING")
+            {
+              return ThreatIntelSetStatus::ACTIVATING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ThreatIntelSetStatus::ACTIVE;
+            }
+            break;
+          case -1016559567:
+            if (name == "DEACTIVATING")
+            {
+              return ThreatIntelSetStatus::DEACTIVATING;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return ThreatIntelSetStatus::ERROR_;
+            }
+            break;
+          case 1607621347:
+            if (name == "DELETE_PENDING")
+            {
+              return ThreatIntelSetStatus::DELETE_PENDING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return ThreatIntelSetStatus::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ThreatIntelSetStatus::NOT_SET;
         }
 
-        Aws::String GetNameForThreatIntelSetStatus(ThreatIntelSetStatus enumValue)
+        const char* GetNameForThreatIntelSetStatusCStr(ThreatIntelSetStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ThreatIntelSetStatus::INACTIVE:
-            return "INACTIVE";
-          case ThreatIntelSetStatus::ACTIVATING:
-            return "ACTIVATING";
-          case ThreatIntelSetStatus::ACTIVE:
-            return "ACTIVE";
-          case ThreatIntelSetStatus::DEACTIVATING:
-            return "DEACTIVATING";
-          case ThreatIntelSetStatus::ERROR_:
-            return "ERROR";
-          case ThreatIntelSetStatus::DELETE_PENDING:
-            return "DELETE_PENDING";
-          case ThreatIntelSetStatus::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForThreatIntelSetStatus(ThreatIntelSetStatus enumValue)
+        {
+          return GetNameForThreatIntelSetStatusCStr(enumValue);
         }
 
       } // namespace ThreatIntelSetStatusMapper
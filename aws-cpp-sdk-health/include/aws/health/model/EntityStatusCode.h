@@ -36,6 +36,11 @@ namespace EntityStatusCodeMapper
 AWS_HEALTH_API EntityStatusCode GetEntityStatusCodeForName(const Aws::String& name);
 
 AWS_HEALTH_API Aws::String GetNameForEntityStatusCode(EntityStatusCode value);
+
+/**
+ * Same as GetNameForEntityStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_HEALTH_API const char* GetNameForEntityStatusCodeCStr(EntityStatusCode value);
 } // namespace EntityStatusCodeMapper
 } // namespace Model
 } // namespace Health
@@ -34,6 +34,11 @@ namespace EventAggregateFieldMapper
 AWS_HEALTH_API EventAggregateField GetEventAggregateFieldForName(const Aws::String& name);
 
 AWS_HEALTH_API Aws::String GetNameForEventAggregateField(EventAggregateField value);
+
+/**
+ * Same as GetNameForEventAggregateField(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_HEALTH_API const char* GetNameForEventAggregateFieldCStr(EventAggregateField value);
 } // namespace EventAggregateFieldMapper
 } // namespace Model
 } // namespace Health
@@ -36,6 +36,11 @@ namespace EventStatusCodeMapper
 AWS_HEALTH_API EventStatusCode GetEventStatusCodeForName(const Aws::String& name);
 
 AWS_HEALTH_API Aws::String GetNameForEventStatusCode(EventStatusCode value);
+
+/**
+ * Same as GetNameForEventStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_HEALTH_API const char* GetNameForEventStatusCodeCStr(EventStatusCode value);
 } // namespace EventStatusCodeMapper
 } // namespace Model
 } // namespace Health
@@ -36,6 +36,11 @@ namespace EventTypeCategoryMapper
 AWS_HEALTH_API EventTypeCategory GetEventTypeCategoryForName(const Aws::String& name);
 
 AWS_HEALTH_API Aws::String GetNameForEventTypeCategory(EventTypeCategory value);
+
+/**
+ * Same as GetNameForEventTypeCategory(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_HEALTH_API const char* GetNameForEventTypeCategoryCStr(EventTypeCategory value);
 } // namespace EventTypeCategoryMapper
 } // namespace Model
 } // namespace Health
@@ -30,25 +30,44 @@ namespace Aws
       namespace EntityStatusCodeMapper
       {
 
-        static const int IMPAIRED_HASH = HashingUtils::HashString("IMPAIRED");
-        static const int UNIMPAIRED_HASH = HashingUtils::HashString("UNIMPAIRED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IMPAIRED",
+          "UNIMPAIRED",
+          "UNKNOWN",
+        };
 
         EntityStatusCode GetEntityStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IMPAIRED_HASH)
-          {
-            return EntityStatusCode::IMPAIRED;
-          }
-          else if (hashCode == UNIMPAIRED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EntityStatusCode::UNIMPAIRED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return EntityStatusCode::UNKNOWN;
+          case 347058973:
+            if (name == "IMPAIRED")
+            {
+              return EntityStatusCode::IMPAIRED;
+            }
+            break;
+          case 1575752886:
+            if (name == "UNIMPAIRED")
+            {
+              return EntityStatusCode::UNIMPAIRED;
+            }
+            break;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return EntityStatusCode::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EntityStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForEntityStatusCode(EntityStatusCode enumValue)
+        const char* GetNameForEntityStatusCodeCStr(EntityStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EntityStatusCode::IMPAIRED:
-            return "IMPAIRED";
-          case EntityStatusCode::UNIMPAIRED:
-            return "UNIMPAIRED";
-          case EntityStatusCode::UNKNOWN:
-            return "UNKNOWN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEntityStatusCode(EntityStatusCode enumValue)
+        {
+          return GetNameForEntityStatusCodeCStr(enumValue);
         }
 
       } // namespace EntityStatusCodeMapper
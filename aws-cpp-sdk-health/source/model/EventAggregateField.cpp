@@ -30,15 +30,30 @@ namespace Aws
       namespace EventAggregateFieldMapper
       {
 
-        static const int eventTypeCategory_HASH = HashingUtils::HashString("eventTypeCategory");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "eventTypeCategory",
+        };
 
         EventAggregateField GetEventAggregateFieldForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == eventTypeCategory_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventAggregateField::eventTypeCategory;
+          case -1394702830:
+            if (name == "eventTypeCategory")
+            {
+              return EventAggregateField::eventTypeCategory;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return EventAggregateField::NOT_SET;
         }
 
-        Aws::String GetNameForEventAggregateField(EventAggregateField enumValue)
+        const char* GetNameForEventAggregateFieldCStr(EventAggregateField enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventAggregateField::eventTypeCategory:
-            return "eventTypeCategory";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventAggregateField(EventAggregateField enumValue)
+        {
+          return GetNameForEventAggregateFieldCStr(enumValue);
         }
 
       } // namespace EventAggregateFieldMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace EventStatusCodeMapper
       {
 
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int closed_HASH = HashingUtils::HashString("closed");
-        static const int upcoming_HASH = HashingUtils::HashString("upcoming");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "open",
+          "closed",
+          "upcoming",
+        };
 
         EventStatusCode GetEventStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == open_HASH)
-          {
-            return EventStatusCode::open;
-          }
-          else if (hashCode == closed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventStatusCode::closed;
-          }
-          else if (hashCode == upcoming_HASH)
-          {
-            return EventStatusCode::upcoming;
+          case 3417674:
+            if (name == "open")
+            {
+              return EventStatusCode::open;
+            }
+            break;
+          case -1357520532:
+            if (name == "closed")
+            {
+              return EventStatusCode::closed;
+            }
+            break;
+          case 1306691868:
+            if (name == "upcoming")
+            {
+              return EventStatusCode::upcoming;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EventStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForEventStatusCode(EventStatusCode enumValue)
+        const char* GetNameForEventStatusCodeCStr(EventStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventStatusCode::open:
-            return "open";
-          case EventStatusCode::closed:
-            return "closed";
-          case EventStatusCode::upcoming:
-            return "upcoming";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventStatusCode(EventStatusCode enumValue)
+        {
+          return GetNameForEventStatusCodeCStr(enumValue);
         }
 
       } // namespace EventStatusCodeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace EventTypeCategoryMapper
       {
 
-        static const int issue_HASH = HashingUtils::HashString("issue");
-        static const int accountNotification_HASH = HashingUtils::HashString("accountNotification");
-        static const int scheduledChange_HASH = HashingUtils::HashString("scheduledChange");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "issue",
+          "accountNotification",
+          "scheduledChange",
+        };
 
         EventTypeCategory GetEventTypeCategoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == issue_HASH)
-          {
-            return EventTypeCategory::issue;
-          }
-          else if (hashCode == accountNotification_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventTypeCategory::accountNotification;
-          }
-          else if (hashCode == scheduledChange_HASH)
-          {
-            return EventTypeCategory::scheduledChange;
+          case 100509913:
+            if (name == "issue")
+            {
+              return EventTypeCategory::issue;
+            }
+            break;
+          case 1361218488:
+            if (name == "accountNotification")
+            {
+              return EventTypeCategory::accountNotification;
+            }
+            break;
+          case 510511805:
+            if (name == "scheduledChange")
+            {
+              return EventTypeCategory::scheduledChange;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EventTypeCategory::NOT_SET;
         }
 
-        Aws::String GetNameForEventTypeCategory(EventTypeCategory enumValue)
+        const char* GetNameForEventTypeCategoryCStr(EventTypeCategory enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventTypeCategory::issue:
-            return "issue";
-          case EventTypeCategory::accountNotification:
-            return "accountNotification";
-          case EventTypeCategory::scheduledChange:
-            return "scheduledChange";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventTypeCategory(EventTypeCategory enumValue)
+        {
+          return GetNameForEventTypeCategoryCStr(enumValue);
         }
 
       } // namespace EventTypeCategoryMapper
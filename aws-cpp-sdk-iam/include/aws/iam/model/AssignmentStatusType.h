@@ -36,6 +36,11 @@ namespace AssignmentStatusTypeMapper
 AWS_IAM_API AssignmentStatusType GetAssignmentStatusTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForAssignmentStatusType(AssignmentStatusType value);
+
+/**
+ * Same as GetNameForAssignmentStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForAssignmentStatusTypeCStr(AssignmentStatusType value);
 } // namespace AssignmentStatusTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -45,6 +45,11 @@ namespace ContextKeyTypeEnumMapper
 AWS_IAM_API ContextKeyTypeEnum GetContextKeyTypeEnumForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForContextKeyTypeEnum(ContextKeyTypeEnum value);
+
+/**
+ * Same as GetNameForContextKeyTypeEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForContextKeyTypeEnumCStr(ContextKeyTypeEnum value);
 } // namespace ContextKeyTypeEnumMapper
 } // namespace Model
 } // namespace IAM
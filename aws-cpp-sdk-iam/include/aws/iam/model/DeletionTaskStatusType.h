@@ -37,6 +37,11 @@ namespace DeletionTaskStatusTypeMapper
 AWS_IAM_API DeletionTaskStatusType GetDeletionTaskStatusTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForDeletionTaskStatusType(DeletionTaskStatusType value);
+
+/**
+ * Same as GetNameForDeletionTaskStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForDeletionTaskStatusTypeCStr(DeletionTaskStatusType value);
 } // namespace DeletionTaskStatusTypeMapper
 } // namespace Model
 } // namespace IAM
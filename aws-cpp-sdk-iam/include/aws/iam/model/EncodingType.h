@@ -35,6 +35,11 @@ namespace EncodingTypeMapper
 AWS_IAM_API EncodingType GetEncodingTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForEncodingType(EncodingType value);
+
+/**
+ * Same as GetNameForEncodingType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForEncodingTypeCStr(EncodingType value);
 } // namespace EncodingTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -38,6 +38,11 @@ namespace EntityTypeMapper
 AWS_IAM_API EntityType GetEntityTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForEntityType(EntityType value);
+
+/**
+ * Same as GetNameForEntityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForEntityTypeCStr(EntityType value);
 } // namespace EntityTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -36,6 +36,11 @@ namespace JobStatusTypeMapper
 AWS_IAM_API JobStatusType GetJobStatusTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForJobStatusType(JobStatusType value);
+
+/**
+ * Same as GetNameForJobStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForJobStatusTypeCStr(JobStatusType value);
 } // namespace JobStatusTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -34,6 +34,11 @@ namespace PermissionsBoundaryAttachmentTypeMapper
 AWS_IAM_API PermissionsBoundaryAttachmentType GetPermissionsBoundaryAttachmentTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForPermissionsBoundaryAttachmentType(PermissionsBoundaryAttachmentType value);
+
+/**
+ * Same as GetNameForPermissionsBoundaryAttachmentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForPermissionsBoundaryAttachmentTypeCStr(PermissionsBoundaryAttachmentType value);
 } // namespace PermissionsBoundaryAttachmentTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -36,6 +36,11 @@ namespace PolicyEvaluationDecisionTypeMapper
 AWS_IAM_API PolicyEvaluationDecisionType GetPolicyEvaluationDecisionTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForPolicyEvaluationDecisionType(PolicyEvaluationDecisionType value);
+
+/**
+ * Same as GetNameForPolicyEvaluationDecisionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForPolicyEvaluationDecisionTypeCStr(PolicyEvaluationDecisionType value);
 } // namespace PolicyEvaluationDecisionTypeMapper
 } // namespace Model
 } // namespace IAM
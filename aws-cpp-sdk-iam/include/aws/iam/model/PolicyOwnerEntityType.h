@@ -36,6 +36,11 @@ namespace PolicyOwnerEntityTypeMapper
 AWS_IAM_API PolicyOwnerEntityType GetPolicyOwnerEntityTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForPolicyOwnerEntityType(PolicyOwnerEntityType value);
+
+/**
+ * Same as GetNameForPolicyOwnerEntityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForPolicyOwnerEntityTypeCStr(PolicyOwnerEntityType value);
 } // namespace PolicyOwnerEntityTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -36,6 +36,11 @@ namespace PolicyScopeTypeMapper
 AWS_IAM_API PolicyScopeType GetPolicyScopeTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForPolicyScopeType(PolicyScopeType value);
+
+/**
+ * Same as GetNameForPolicyScopeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForPolicyScopeTypeCStr(PolicyScopeType value);
 } // namespace PolicyScopeTypeMapper
 } // namespace Model
 } // namespace IAM
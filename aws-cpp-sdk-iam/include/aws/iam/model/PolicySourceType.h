@@ -40,6 +40,11 @@ namespace PolicySourceTypeMapper
 AWS_IAM_API PolicySourceType GetPolicySourceTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForPolicySourceType(PolicySourceType value);
+
+/**
+ * Same as GetNameForPolicySourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForPolicySourceTypeCStr(PolicySourceType value);
 } // namespace PolicySourceTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -35,6 +35,11 @@ namespace PolicyUsageTypeMapper
 AWS_IAM_API PolicyUsageType GetPolicyUsageTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForPolicyUsageType(PolicyUsageType value);
+
+/**
+ * Same as GetNameForPolicyUsageType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForPolicyUsageTypeCStr(PolicyUsageType value);
 } // namespace PolicyUsageTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -34,6 +34,11 @@ namespace ReportFormatTypeMapper
 AWS_IAM_API ReportFormatType GetReportFormatTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForReportFormatType(ReportFormatType value);
+
+/**
+ * Same as GetNameForReportFormatType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForReportFormatTypeCStr(ReportFormatType value);
 } // namespace ReportFormatTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -36,6 +36,11 @@ namespace ReportStateTypeMapper
 AWS_IAM_API ReportStateType GetReportStateTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForReportStateType(ReportStateType value);
+
+/**
+ * Same as GetNameForReportStateType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForReportStateTypeCStr(ReportStateType value);
 } // namespace ReportStateTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -35,6 +35,11 @@ namespace StatusTypeMapper
 AWS_IAM_API StatusType GetStatusTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForStatusType(StatusType value);
+
+/**
+ * Same as GetNameForStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForStatusTypeCStr(StatusType value);
 } // namespace StatusTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -58,6 +58,11 @@ namespace SummaryKeyTypeMapper
 AWS_IAM_API SummaryKeyType GetSummaryKeyTypeForName(const Aws::String& name);
 
 AWS_IAM_API Aws::String GetNameForSummaryKeyType(SummaryKeyType value);
+
+/**
+ * Same as GetNameForSummaryKeyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IAM_API const char* GetNameForSummaryKeyTypeCStr(SummaryKeyType value);
 } // namespace SummaryKeyTypeMapper
 } // namespace Model
 } // namespace IAM
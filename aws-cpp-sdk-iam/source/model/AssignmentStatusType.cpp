@@ -30,25 +30,44 @@ namespace Aws
       namespace AssignmentStatusTypeMapper
       {
 
-        static const int Assigned_HASH = HashingUtils::HashString("Assigned");
-        static const int Unassigned_HASH = HashingUtils::HashString("Unassigned");
-        static const int Any_HASH = HashingUtils::HashString("Any");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Assigned",
+          "Unassigned",
+          "Any",
+        };
 
         AssignmentStatusType GetAssignmentStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Assigned_HASH)
-          {
-            return AssignmentStatusType::Assigned;
-          }
-          else if (hashCode == Unassigned_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssignmentStatusType::Unassigned;
-          }
-          else if (hashCode == Any_HASH)
-          {
-            return AssignmentStatusType::Any;
+          case -305237522:
+            if (name == "Assigned")
+            {
+              return AssignmentStatusType::Assigned;
+            }
+            break;
+          case -1145155705:
+            if (name == "Unassigned")
+            {
+              return AssignmentStatusType::Unassigned;
+            }
+            break;
+          case 65996:
+            if (name == "Any")
+            {
+              return AssignmentStatusType::Any;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AssignmentStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForAssignmentStatusType(AssignmentStatusType enumValue)
+        const char* GetNameForAssignmentStatusTypeCStr(AssignmentStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssignmentStatusType::Assigned:
-            return "Assigned";
-          case AssignmentStatusType::Unassigned:
-            return "Unassigned";
-          case AssignmentStatusType::Any:
-            return "Any";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssignmentStatusType(AssignmentStatusType enumValue)
+        {
+          return GetNameForAssignmentStatusTypeCStr(enumValue);
         }
 
       } // namespace AssignmentStatusTypeMapper
@@ -30,70 +30,107 @@ namespace Aws
       namespace ContextKeyTypeEnumMapper
       {
 
-        static const int string_HASH = HashingUtils::HashString("string");
-        static const int stringList_HASH = HashingUtils::HashString("stringList");
-        static const int numeric_HASH = HashingUtils::HashString("numeric");
-        static const int numericList_HASH = HashingUtils::HashString("numericList");
-        static const int boolean_HASH = HashingUtils::HashString("boolean");
-        static const int booleanList_HASH = HashingUtils::HashString("booleanList");
-        static const int ip_HASH = HashingUtils::HashString("ip");
-        static const int ipList_HASH = HashingUtils::HashString("ipList");
-        static const int binary_HASH = HashingUtils::HashString("binary");
-        static const int binaryList_HASH = HashingUtils::HashString("binaryList");
-        static const int date_HASH = HashingUtils::HashString("date");
-        static const int dateList_HASH = HashingUtils::HashString("dateList");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "string",
+          "stringList",
+          "numeric",
+          "numericList",
+          "boolean",
+          "booleanList",
+          "ip",
+          "ipList",
+          "binary",
+          "binaryList",
+          "date",
+          "dateList",
+        };
 
         ContextKeyTypeEnum GetContextKeyTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == string_HASH)
-          {
-            return ContextKeyTypeEnum::string;
-          }
-          else if (hashCode == stringList_HASH)
-          {
-            return ContextKeyTypeEnum::stringList;
-          }
-          else if (hashCode == numeric_HASH)
-          {
-            return ContextKeyTypeEnum::numeric;
-          }
-          else if (hashCode == numericList_HASH)
-          {
-            return ContextKeyTypeEnum::numericList;
-          }
-          else if (hashCode == boolean_HASH)
-          {
-            return ContextKeyTypeEnum::boolean;
-          }
-          else if (hashCode == booleanList_HASH)
-          {
-            return ContextKeyTypeEnum::booleanList;
-          }
-          else if (hashCode == ip_HASH)
-          {
-            return ContextKeyTypeEnum::ip;
-          }
-          else if (hashCode == ipList_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContextKeyTypeEnum::ipList;
-          }
-          else if (hashCode == binary_HASH)
-          {
-            return ContextKeyTypeEnum::binary;
-          }
-          else if (hashCode == binaryList_HASH)
-          {
-            return ContextKeyTypeEnum::binaryList;
-          }
-          else if (hashCode == date_HASH)
-          {
-            return ContextKeyTypeEnum::date;
-          }
-          else if (hashCode == dateList_HASH)
-          {
-            return ContextKeyTypeEnum::dateList;
+          case -891985903:
+            if (name == "string")
+            {
+              return ContextKeyTypeEnum::string;
+            }
+            break;
+          case -1573317553:
+            if (name == "stringList")
+            {
+              return ContextKeyTypeEnum::stringList;
+            }
+            break;
+          case -2000413939:
+            if (name == "numeric")
+            {
+              return ContextKeyTypeEnum::numeric;
+            }
+            break;
+          case 68809035:
+            if (name == "numericList")
+            {
+              return ContextKeyTypeEnum::numericList;
+            }
+            break;
+          case 64711720:
+            if (name == "boolean")
+            {
+              return ContextKeyTypeEnum::boolean;
+            }
+            break;
+          case -1835189018:
+            if (name == "booleanList")
+            {
+              return ContextKeyTypeEnum::booleanList;
+            }
+            break;
+          case 3367:
+            if (name == "ip")
+            {
+              return ContextKeyTypeEnum::ip;
+            }
+            break;
+          case -1183103387:
+            if (name == "ipList")
+            {
+              return ContextKeyTypeEnum::ipList;
+            }
+            break;
+          case -1388966911:
+            if (name == "binary")
+            {
+              return ContextKeyTypeEnum::binary;
+            }
+            break;
+          case -880654273:
+            if (name == "binaryList")
+            {
+              return ContextKeyTypeEnum::binaryList;
+            }
+            break;
+          case 3076014:
+            if (name == "date")
+            {
+              return ContextKeyTypeEnum::date;
+            }
+            break;
+          case 1792511340:
+            if (name == "dateList")
+            {
+              return ContextKeyTypeEnum::dateList;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return ContextKeyTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForContextKeyTypeEnum(ContextKeyTypeEnum enumValue)
+        const char* GetNameForContextKeyTypeEnumCStr(ContextKeyTypeEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContextKeyTypeEnum::string:
-            return "string";
-          case ContextKeyTypeEnum::stringList:
-            return "stringList";
-          case ContextKeyTypeEnum::numeric:
-            return "numeric";
-          case ContextKeyTypeEnum::numericList:
-            return "numericList";
-          case ContextKeyTypeEnum::boolean:
-            return "boolean";
-          case ContextKeyTypeEnum::booleanList:
-            return "booleanList";
-          case ContextKeyTypeEnum::ip:
-            return "ip";
-          case ContextKeyTypeEnum::ipList:
-            return "ipList";
-          case ContextKeyTypeEnum::binary:
-            return "binary";
-          case ContextKeyTypeEnum::binaryList:
-            return "binaryList";
-          case ContextKeyTypeEnum::date:
-            return "date";
-          case ContextKeyTypeEnum::dateList:
-            return "dateList";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContextKeyTypeEnum(ContextKeyTypeEnum enumValue)
+        {
+          return GetNameForContextKeyTypeEnumCStr(enumValue);
         }
 
       } // namespace ContextKeyTypeEnumMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace DeletionTaskStatusTypeMapper
       {
 
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int NOT_STARTED_HASH = HashingUtils::HashString("NOT_STARTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCEEDED",
+          "IN_PROGRESS",
+          "FAILED",
+          "NOT_STARTED",
+        };
 
         DeletionTaskStatusType GetDeletionTaskStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCEEDED_HASH)
-          {
-            return DeletionTaskStatusType::SUCCEEDED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return DeletionTaskStatusType::IN_PROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return DeletionTaskStatusType::FAILED;
-          }
-          else if (hashCode == NOT_STARTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeletionTaskStatusType::NOT_STARTED;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return DeletionTaskStatusType::SUCCEEDED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return DeletionTaskStatusType::IN_PROGRESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return DeletionTaskStatusType::FAILED;
+            }
+            break;
+          case -1391247659:
+            if (name == "NOT_STARTED")
+            {
+              return DeletionTaskStatusType::NOT_STARTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DeletionTaskStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForDeletionTaskStatusType(DeletionTaskStatusType enumValue)
+        const char* GetNameForDeletionTaskStatusTypeCStr(DeletionTaskStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeletionTaskStatusType::SUCCEEDED:
-            return "SUCCEEDED";
-          case DeletionTaskStatusType::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case DeletionTaskStatusType::FAILED:
-            return "FAILED";
-          case DeletionTaskStatusType::NOT_STARTED:
-            return "NOT_STARTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeletionTaskStatusType(DeletionTaskStatusType enumValue)
+        {
+          return GetNameForDeletionTaskStatusTypeCStr(enumValue);
         }
 
       } // namespace DeletionTaskStatusTypeMapper
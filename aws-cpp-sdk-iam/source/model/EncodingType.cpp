@@ -30,20 +30,37 @@ namespace Aws
       namespace EncodingTypeMapper
       {
 
-        static const int SSH_HASH = HashingUtils::HashString("SSH");
-        static const int PEM_HASH = HashingUtils::HashString("PEM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SSH",
+          "PEM",
+        };
 
         EncodingType GetEncodingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSH_HASH)
-          {
-            return EncodingType::SSH;
-          }
-          else if (hashCode == PEM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EncodingType::PEM;
+          case 82408:
+            if (name == "SSH")
+            {
+              return EncodingType::SSH;
+            }
+            break;
+          case 79096:
+            if (name == "PEM")
+            {
+              return EncodingType::PEM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EncodingType::NOT_SET;
         }
 
-        Aws::String GetNameForEncodingType(EncodingType enumValue)
+        const char* GetNameForEncodingTypeCStr(EncodingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EncodingType::SSH:
-            return "SSH";
-          case EncodingType::PEM:
-            return "PEM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEncodingType(EncodingType enumValue)
+        {
+          return GetNameForEncodingTypeCStr(enumValue);
         }
 
       } // namespace EncodingTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace EntityTypeMapper
       {
 
-        static const int User_HASH = HashingUtils::HashString("User");
-        static const int Role_HASH = HashingUtils::HashString("Role");
-        static const int Group_HASH = HashingUtils::HashString("Group");
-        static const int LocalManagedPolicy_HASH = HashingUtils::HashString("LocalManagedPolicy");
-        static const int AWSManagedPolicy_HASH = HashingUtils::HashString("AWSManagedPolicy");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "User",
+          "Role",
+          "Group",
+          "LocalManagedPolicy",
+          "AWSManagedPolicy",
+        };
 
         EntityType GetEntityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == User_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EntityType::User;
-          }
-          else if (hashCode == Role_HASH)
-          {
-            return EntityType::Role;
-          }
-          else if (hashCode == Group_HASH)
-          {
-            return EntityType::Group;
-          }
-          else if (hashCode == LocalManagedPolicy_HASH)
-          {
-            return EntityType::LocalManagedPolicy;
-          }
-          else if (hashCode == AWSManagedPolicy_HASH)
-          {
-            return EntityType::AWSManagedPolicy;
+          case 2645995:
+            if (name == "User")
+            {
+              return EntityType::User;
+            }
+            break;
+          case 2552982:
+            if (name == "Role")
+            {
+              return EntityType::Role;
+            }
+            break;
+          case 69076575:
+            if (name == "Group")
+            {
+              return EntityType::Group;
+            }
+            break;
+          case -200941530:
+            if (name == "LocalManagedPolicy")
+            {
+              return EntityType::LocalManagedPolicy;
+            }
+            break;
+          case 410332628:
+            if (name == "AWSManagedPolicy")
+            {
+              return EntityType::AWSManagedPolicy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return EntityType::NOT_SET;
         }
 
-        Aws::String GetNameForEntityType(EntityType enumValue)
+        const char* GetNameForEntityTypeCStr(EntityType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EntityType::User:
-            return "User";
-          case EntityType::Role:
-            return "Role";
-          case EntityType::Group:
-            return "Group";
-          case EntityType::LocalManagedPolicy:
-            return "LocalManagedPolicy";
-          case EntityType::AWSManagedPolicy:
-            return "AWSManagedPolicy";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEntityType(EntityType enumValue)
+        {
+          return GetNameForEntityTypeCStr(enumValue);
         }
 
       } // namespace EntityTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace JobStatusTypeMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "COMPLETED",
+          "FAILED",
+        };
 
         JobStatusType GetJobStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return JobStatusType::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobStatusType::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobStatusType::FAILED;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return JobStatusType::IN_PROGRESS;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return JobStatusType::COMPLETED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return JobStatusType::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return JobStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatusType(JobStatusType enumValue)
+        const char* GetNameForJobStatusTypeCStr(JobStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobStatusType::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case JobStatusType::COMPLETED:
-            return "COMPLETED";
-          case JobStatusType::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobStatusType(JobStatusType enumValue)
+        {
+          return GetNameForJobStatusTypeCStr(enumValue);
         }
 
       } // namespace JobStatusTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace PermissionsBoundaryAttachmentTypeMapper
       {
 
-        static const int PermissionsBoundaryPolicy_HASH = HashingUtils::HashString("PermissionsBoundaryPolicy");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PermissionsBoundaryPolicy",
+        };
 
         PermissionsBoundaryAttachmentType GetPermissionsBoundaryAttachmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PermissionsBoundaryPolicy_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PermissionsBoundaryAttachmentType::PermissionsBoundaryPolicy;
+          case 493689728:
+            if (name == "PermissionsBoundaryPolicy")
+            {
+              return PermissionsBoundaryAttachmentType::PermissionsBoundaryPolicy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return PermissionsBoundaryAttachmentType::NOT_SET;
         }
 
-        Aws::String GetNameForPermissionsBoundaryAttachmentType(PermissionsBoundaryAttachmentType enumValue)
+        const char* GetNameForPermissionsBoundaryAttachmentTypeCStr(PermissionsBoundaryAttachmentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PermissionsBoundaryAttachmentType::PermissionsBoundaryPolicy:
-            return "PermissionsBoundaryPolicy";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPermissionsBoundaryAttachmentType(PermissionsBoundaryAttachmentType enumValue)
+        {
+          return GetNameForPermissionsBoundaryAttachmentTypeCStr(enumValue);
         }
 
       } // namespace PermissionsBoundaryAttachmentTypeMapper
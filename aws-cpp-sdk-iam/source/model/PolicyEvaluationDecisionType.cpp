@@ -30,25 +30,44 @@ namespace Aws
       namespace PolicyEvaluationDecisionTypeMapper
       {
 
-        static const int allowed_HASH = HashingUtils::HashString("allowed");
-        static const int explicitDeny_HASH = HashingUtils::HashString("explicitDeny");
-        static const int implicitDeny_HASH = HashingUtils::HashString("implicitDeny");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "allowed",
+          "explicitDeny",
+          "implicitDeny",
+        };
 
         PolicyEvaluationDecisionType GetPolicyEvaluationDecisionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == allowed_HASH)
-          {
-            return PolicyEvaluationDecisionType::allowed;
-          }
-          else if (hashCode == explicitDeny_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PolicyEvaluationDecisionType::explicitDeny;
-          }
-          else if (hashCode == implicitDeny_HASH)
-          {
-            return PolicyEvaluationDecisionType::implicitDeny;
+          case -911343192:
+            if (name == "allowed")
+            {
+              return PolicyEvaluationDecisionType::allowed;
+            }
+            break;
+          case 190750304:
+            if (name == "explicitDeny")
+            {
+              return PolicyEvaluationDecisionType::explicitDeny;
+            }
+            break;
+          case -1001290351:
+            if (name == "implicitDeny")
+            {
+              return PolicyEvaluationDecisionType::implicitDeny;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PolicyEvaluationDecisionType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyEvaluationDecisionType(PolicyEvaluationDecisionType enumValue)
+        const char* GetNameForPolicyEvaluationDecisionTypeCStr(PolicyEvaluationDecisionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PolicyEvaluationDecisionType::allowed:
-            return "allowed";
-          case PolicyEvaluationDecisionType::explicitDeny:
-            return "explicitDeny";
-          case PolicyEvaluationDecisionType::implicitDeny:
-            return "implicitDeny";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPolicyEvaluationDecisionType(PolicyEvaluationDecisionType enumValue)
+        {
+          return GetNameForPolicyEvaluationDecisionTypeCStr(enumValue);
         }
 
       } // namespace PolicyEvaluationDecisionTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PolicyScopeTypeMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int Local_HASH = HashingUtils::HashString("Local");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "All",
+          "AWS",
+          "Local",
+        };
 
         PolicyScopeType GetPolicyScopeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
-          {
-            return PolicyScopeType::All;
-          }
-          else if (hashCode == AWS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PolicyScopeType::AWS;
-          }
-          else if (hashCode == Local_HASH)
-          {
-            return PolicyScopeType::Local;
+          case 65921:
+            if (name == "All")
+            {
+              return PolicyScopeType::All;
+            }
+            break;
+          case 65245:
+            if (name == "AWS")
+            {
+              return PolicyScopeType::AWS;
+            }
+            break;
+          case 73592651:
+            if (name == "Local")
+            {
+              return PolicyScopeType::Local;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PolicyScopeType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyScopeType(PolicyScopeType enumValue)
+        const char* GetNameForPolicyScopeTypeCStr(PolicyScopeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PolicyScopeType::All:
-            return "All";
-          case PolicyScopeType::AWS:
-            return "AWS";
-          case PolicyScopeType::Local:
-            return "Local";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPolicyScopeType(PolicyScopeType enumValue)
+        {
+          return GetNameForPolicyScopeTypeCStr(enumValue);
         }
 
       } // namespace PolicyScopeTypeMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace PolicySourceTypeMapper
       {
 
-        static const int user_HASH = HashingUtils::HashString("user");
-        static const int group_HASH = HashingUtils::HashString("group");
-        static const int role_HASH = HashingUtils::HashString("role");
-        static const int aws_managed_HASH = HashingUtils::HashString("aws-managed");
-        static const int user_managed_HASH = HashingUtils::HashString("user-managed");
-        static const int resource_HASH = HashingUtils::HashString("resource");
-        static const int none_HASH = HashingUtils::HashString("none");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "user",
+          "group",
+          "role",
+          "aws-managed",
+          "user-managed",
+          "resource",
+          "none",
+        };
 
         PolicySourceType GetPolicySourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == user_HASH)
-          {
-            return PolicySourceType::user;
-          }
-          else if (hashCode == group_HASH)
-          {
-            return PolicySourceType::group;
-          }
-          else if (hashCode == role_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PolicySourceType::role;
-          }
-          else if (hashCode == aws_managed_HASH)
-          {
-            return PolicySourceType::aws_managed;
-          }
-          else if (hashCode == user_managed_HASH)
-          {
-            return PolicySourceType::user_managed;
-          }
-          else if (hashCode == resource_HASH)
-          {
-            return PolicySourceType::resource;
-          }
-          else if (hashCode == none_HASH)
-          {
-            return PolicySourceType::none;
+          case 3599307:
+            if (name == "user")
+            {
+              return PolicySourceType::user;
+            }
+            break;
+          case 98629247:
+            if (name == "group")
+            {
+              return PolicySourceType::group;
+            }
+            break;
+          case 3506294:
+            if (name == "role")
+            {
+              return PolicySourceType::role;
+            }
+            break;
+          case 132587727:
+            if (name == "aws-managed")
+            {
+              return PolicySourceType::aws_managed;
+            }
+            break;
+          case 1119740829:
+            if (name == "user-managed")
+            {
+              return PolicySourceType::user_managed;
+            }
+            break;
+          case -341064690:
+            if (name == "resource")
+            {
+              return PolicySourceType::resource;
+            }
+            break;
+          case 3387192:
+            if (name == "none")
+            {
+              return PolicySourceType::none;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return PolicySourceType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicySourceType(PolicySourceType enumValue)
+        const char* GetNameForPolicySourceTypeCStr(PolicySourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PolicySourceType::user:
-            return "user";
-          case PolicySourceType::group:
-            return "group";
-          case PolicySourceType::role:
-            return "role";
-          case PolicySourceType::aws_managed:
-            return "aws-managed";
-          case PolicySourceType::user_managed:
-            return "user-managed";
-          case PolicySourceType::resource:
-            return "resource";
-          case PolicySourceType::none:
-            return "none";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPolicySourceType(PolicySourceType enumValue)
+        {
+          return GetNameForPolicySourceTypeCStr(enumValue);
         }
 
       } // namespace PolicySourceTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PolicyTypeMapper
       {
 
-        static const int INLINE_HASH = HashingUtils::HashString("INLINE");
-        static const int MANAGED_HASH = HashingUtils::HashString("MANAGED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INLINE",
+          "MANAGED",
+        };
 
         PolicyType GetPolicyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INLINE_HASH)
-          {
-            return PolicyType::INLINE;
-          }
-          else if (hashCode == MANAGED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PolicyType::MANAGED;
+          case -2130667879:
+            if (name == "INLINE")
+            {
+              return PolicyType::INLINE;
+            }
+            break;
+          case 1553243007:
+            if (name == "MANAGED")
+            {
+              return PolicyType::MANAGED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PolicyType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyType(PolicyType enumValue)
+        const char* GetNameForPolicyTypeCStr(PolicyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PolicyType::INLINE:
-            return "INLINE";
-          case PolicyType::MANAGED:
-            return "MANAGED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPolicyType(PolicyType enumValue)
+        {
+          return GetNameForPolicyTypeCStr(enumValue);
         }
 
       } // namespace PolicyTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PolicyUsageTypeMapper
       {
 
-        static const int PermissionsPolicy_HASH = HashingUtils::HashString("PermissionsPolicy");
-        static const int PermissionsBoundary_HASH = HashingUtils::HashString("PermissionsBoundary");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PermissionsPolicy",
+          "PermissionsBoundary",
+        };
 
         PolicyUsageType GetPolicyUsageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PermissionsPolicy_HASH)
-          {
-            return PolicyUsageType::PermissionsPolicy;
-          }
-          else if (hashCode == PermissionsBoundary_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PolicyUsageType::PermissionsBoundary;
+          case -19311946:
+            if (name == "PermissionsPolicy")
+            {
+              return PolicyUsageType::PermissionsPolicy;
+            }
+            break;
+          case 253838510:
+            if (name == "PermissionsBoundary")
+            {
+              return PolicyUsageType::PermissionsBoundary;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PolicyUsageType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyUsageType(PolicyUsageType enumValue)
+        const char* GetNameForPolicyUsageTypeCStr(PolicyUsageType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PolicyUsageType::PermissionsPolicy:
-            return "PermissionsPolicy";
-          case PolicyUsageType::PermissionsBoundary:
-            return "PermissionsBoundary";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPolicyUsageType(PolicyUsageType enumValue)
+        {
+          return GetNameForPolicyUsageTypeCStr(enumValue);
         }
 
       } // namespace PolicyUsageTypeMapper
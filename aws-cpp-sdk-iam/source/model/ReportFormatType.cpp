@@ -30,15 +30,30 @@ namespace Aws
       namespace ReportFormatTypeMapper
       {
 
-        static const int text_csv_HASH = HashingUtils::HashString("text/csv");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "text/csv",
+        };
 
         ReportFormatType GetReportFormatTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == text_csv_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReportFormatType::text_csv;
+          case -1004747228:
+            if (name == "text/csv")
+            {
+              return ReportFormatType::text_csv;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ReportFormatType::NOT_SET;
         }
 
-        Aws::String GetNameForReportFormatType(ReportFormatType enumValue)
+        const char* GetNameForReportFormatTypeCStr(ReportFormatType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReportFormatType::text_csv:
-            return "text/csv";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReportFormatType(ReportFormatType enumValue)
+        {
+          return GetNameForReportFormatTypeCStr(enumValue);
         }
 
       } // namespace ReportFormatTypeMapper
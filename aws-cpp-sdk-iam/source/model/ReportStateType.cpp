@@ -30,25 +30,44 @@ namespace Aws
       namespace ReportStateTypeMapper
       {
 
-        static const int STARTED_HASH = HashingUtils::HashString("STARTED");
-        static const int INPROGRESS_HASH = HashingUtils::HashString("INPROGRESS");
-        static const int COMPLETE_HASH = HashingUtils::HashString("COMPLETE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STARTED",
+          "INPROGRESS",
+          "COMPLETE",
+        };
 
         ReportStateType GetReportStateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTED_HASH)
-          {
-            return ReportStateType::STARTED;
-          }
-          else if (hashCode == INPROGRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReportStateType::INPROGRESS;
-          }
-          else if (hashCode == COMPLETE_HASH)
-          {
-            return ReportStateType::COMPLETE;
+          case -1179202463:
+            if (name == "STARTED")
+            {
+              return ReportStateType::STARTED;
+            }
+            break;
+          case -926562734:
+            if (name == "INPROGRESS")
+            {
+              return ReportStateType::INPROGRESS;
+            }
+            break;
+          case 183181625:
+            if (name == "COMPLETE")
+            {
+              return ReportStateType::COMPLETE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ReportStateType::NOT_SET;
         }
 
-        Aws::String GetNameForReportStateType(ReportStateType enumValue)
+        const char* GetNameForReportStateTypeCStr(ReportStateType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReportStateType::STARTED:
-            return "STARTED";
-          case ReportStateType::INPROGRESS:
-            return "INPROGRESS";
-          case ReportStateType::COMPLETE:
-            return "COMPLETE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReportStateType(ReportStateType enumValue)
+        {
+          return GetNameForReportStateTypeCStr(enumValue);
         }
 
       } // namespace ReportStateTypeMapper
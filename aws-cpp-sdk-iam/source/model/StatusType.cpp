@@ -30,20 +30,37 @@ namespace Aws
       namespace StatusTypeMapper
       {
 
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Inactive_HASH = HashingUtils::HashString("Inactive");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Active",
+          "Inactive",
+        };
 
         StatusType GetStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Active_HASH)
-          {
-            return StatusType::Active;
-          }
-          else if (hashCode == Inactive_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StatusType::Inactive;
+          case 1955883814:
+            if (name == "Active")
+            {
+              return StatusType::Active;
+            }
+            break;
+          case 89309323:
+            if (name == "Inactive")
+            {
+              return StatusType::Inactive;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return StatusType::NOT_SET;
         }
 
-        Aws::String GetNameForStatusType(StatusType enumValue)
+        const char* GetNameForStatusTypeCStr(StatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StatusType::Active:
-            return "Active";
-          case StatusType::Inactive:
-            return "Inactive";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatusType(StatusType enumValue)
+        {
+          return GetNameForStatusTypeCStr(enumValue);
         }
 
       } // namespace StatusTypeMapper
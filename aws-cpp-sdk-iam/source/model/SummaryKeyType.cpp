@@ -30,135 +30,198 @@ namespace Aws
       namespace SummaryKeyTypeMapper
       {
 
-        static const int Users_HASH = HashingUtils::HashString("Users");
-        static const int UsersQuota_HASH = HashingUtils::HashString("UsersQuota");
-        static const int Groups_HASH = HashingUtils::HashString("Groups");
-        static const int GroupsQuota_HASH = HashingUtils::HashString("GroupsQuota");
-        static const int ServerCertificates_HASH = HashingUtils::HashString("ServerCertificates");
-        static const int ServerCertificatesQuota_HASH = HashingUtils::HashString("ServerCertificatesQuota");
-        static const int UserPolicySizeQuota_HASH = HashingUtils::HashString("UserPolicySizeQuota");
-        static const int GroupPolicySizeQuota_HASH = HashingUtils::HashString("GroupPolicySizeQuota");
-        static const int GroupsPerUserQuota_HASH = HashingUtils::HashString("GroupsPerUserQuota");
-        static const int SigningCertificatesPerUserQuota_HASH = HashingUtils::HashString("SigningCertificatesPerUserQuota");
-        static const int AccessKeysPerUserQuota_HASH = HashingUtils::HashString("AccessKeysPerUserQuota");
-        static const int MFADevices_HASH = HashingUtils::HashString("MFADevices");
-        static const int MFADevicesInUse_HASH = HashingUtils::HashString("MFADevicesInUse");
-        static const int AccountMFAEnabled_HASH = HashingUtils::HashString("AccountMFAEnabled");
-        static const int AccountAccessKeysPresent_HASH = HashingUtils::HashString("AccountAccessKeysPresent");
-        static const int AccountSigningCertificatesPresent_HASH = HashingUtils::HashString("AccountSigningCertificatesPresent");
-        static const int AttachedPoliciesPerGroupQuota_HASH = HashingUtils::HashString("AttachedPoliciesPerGroupQuota");
-        static const int AttachedPoliciesPerRoleQuota_HASH = HashingUtils::HashString("AttachedPoliciesPerRoleQuota");
-        static const int AttachedPoliciesPerUserQuota_HASH = HashingUtils::HashString("AttachedPoliciesPerUserQuota");
-        static const int Policies_HASH = HashingUtils::HashString("Policies");
-        static const int PoliciesQuota_HASH = HashingUtils::HashString("PoliciesQuota");
-        static const int PolicySizeQuota_HASH = HashingUtils::HashString("PolicySizeQuota");
-        static const int PolicyVersionsInUse_HASH = HashingUtils::HashString("PolicyVersionsInUse");
-        static const int PolicyVersionsInUseQuota_HASH = HashingUtils::HashString("PolicyVersionsInUseQuota");
-        static const int VersionsPerPolicyQuota_HASH = HashingUtils::HashString("VersionsPerPolicyQuota");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Users",
+          "UsersQuota",
+          "Groups",
+          "GroupsQuota",
+          "ServerCertificates",
+          "ServerCertificatesQuota",
+          "UserPolicySizeQuota",
+          "GroupPolicySizeQuota",
+          "GroupsPerUserQuota",
+          "SigningCertificatesPerUserQuota",
+          "AccessKeysPerUserQuota",
+          "MFADevices",
+          "MFADevicesInUse",
+          "AccountMFAEnabled",
+          "AccountAccessKeysPresent",
+          "AccountSigningCertificatesPresent",
+          "AttachedPoliciesPerGroupQuota",
+          "AttachedPoliciesPerRoleQuota",
+          "AttachedPoliciesPerUserQuota",
+          "Policies",
+          "PoliciesQuota",
+          "PolicySizeQuota",
+          "PolicyVersionsInUse",
+          "PolicyVersionsInUseQuota",
+          "VersionsPerPolicyQuota",
+        };
 
         SummaryKeyType GetSummaryKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Users_HASH)
-          {
-            return SummaryKeyType::Users;
-          }
-          else if (hashCode == UsersQuota_HASH)
-          {
-            return SummaryKeyType::UsersQuota;
-          }
-          else if (hashCode == Groups_HASH)
-          {
-            return SummaryKeyType::Groups;
-          }
-          else if (hashCode == GroupsQuota_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SummaryKeyType::GroupsQuota;
-          }
-          else if (hashCode == ServerCertificates_HASH)
-          {
-            return SummaryKeyType::ServerCertificates;
-          }
-          else if (hashCode == ServerCertificatesQuota_HASH)
-          {
-            return SummaryKeyType::ServerCertificatesQuota;
-          }
-          else if (hashCode == UserPolicySizeQuota_HASH)
-          {
-            return SummaryKeyType::UserPolicySizeQuota;
-          }
-          else if (hashCode == GroupPolicySizeQuota_HASH)
-          {
-            return SummaryKeyType::GroupPolicySizeQuota;
-          }
-          else if (hashCode == GroupsPerUserQuota_HASH)
-          {
-            return SummaryKeyType::GroupsPerUserQuota;
-          }
-          else if (hashCode == SigningCertificatesPerUserQuota_HASH)
-          {
-            return SummaryKeyType::SigningCertificatesPerUserQuota;
-          }
-          else if (hashCode == AccessKeysPerUserQuota_HASH)
-          {
-            return SummaryKeyType::AccessKeysPerUserQuota;
-          }
-          else if (hashCode == MFADevices_HASH)
-          {
-            return SummaryKeyType::MFADevices;
-          }
-          else if (hashCode == MFADevicesInUse_HASH)
-          {
-            return SummaryKeyType::MFADevicesInUse;
-          }
-          else if (hashCode == AccountMFAEnabled_HASH)
-          {
-            return SummaryKeyType::AccountMFAEnabled;
-          }
-          else if (hashCode == AccountAccessKeysPresent_HASH)
-          {
-            return SummaryKeyType::AccountAccessKeysPresent;
-          }
-          else if (hashCode == AccountSigningCertificatesPresent_HASH)
-          {
-            return SummaryKeyType::AccountSigningCertificatesPresent;
-          }
-          else if (hashCode == AttachedPoliciesPerGroupQuota_HASH)
-          {
-            return SummaryKeyType::AttachedPoliciesPerGroupQuota;
-          }
-          else if (hashCode == AttachedPoliciesPerRoleQuota_HASH)
-          {
-            return SummaryKeyType::AttachedPoliciesPerRoleQuota;
-          }
-          else if (hashCode == AttachedPoliciesPerUserQuota_HASH)
-          {
-            return SummaryKeyType::AttachedPoliciesPerUserQuota;
-          }
-          else if (hashCode == Policies_HASH)
-          {
-            return SummaryKeyType::Policies;
-          }
-          else if (hashCode == PoliciesQuota_HASH)
-          {
-            return SummaryKeyType::PoliciesQuota;
-          }
-          else if (hashCode == PolicySizeQuota_HASH)
-          {
-            return SummaryKeyType::PolicySizeQuota;
-          }
-          else if (hashCode == PolicyVersionsInUse_HASH)
-          {
-            return SummaryKeyType::PolicyVersionsInUse;
-          }
-          else if (hashCode == PolicyVersionsInUseQuota_HASH)
-          {
-            return SummaryKeyType::PolicyVersionsInUseQuota;
-          }
-          else if (hashCode == VersionsPerPolicyQuota_HASH)
-          {
-            return SummaryKeyType::VersionsPerPolicyQuota;
+          case 82025960:
+            if (name == "Users")
+            {
+              return SummaryKeyType::Users;
+            }
+            break;
+          case 174530928:
+            if (name == "UsersQuota")
+            {
+              return SummaryKeyType::UsersQuota;
+            }
+            break;
+          case 2141373940:
+            if (name == "Groups")
+            {
+              return SummaryKeyType::Groups;
+            }
+            break;
+          case -983883548:
+            if (name == "GroupsQuota")
+            {
+              return SummaryKeyType::GroupsQuota;
+            }
+            break;
+          case -527014721:
+            if (name == "ServerCertificates")
+            {
+              return SummaryKeyType::ServerCertificates;
+            }
+            break;
+          case -60684039:
+            if (name == "ServerCertificatesQuota")
+            {
+              return SummaryKeyType::ServerCertificatesQuota;
+            }
+            break;
+          case 1197776506:
+            if (name == "UserPolicySizeQuota")
+            {
+              return SummaryKeyType::UserPolicySizeQuota;
+            }
+            break;
+          case 113688966:
+            if (name == "GroupPolicySizeQuota")
+            {
+              return SummaryKeyType::GroupPolicySizeQuota;
+            }
+            break;
+          case -1092471580:
+            if (name == "GroupsPerUserQuota")
+            {
+              return SummaryKeyType::GroupsPerUserQuota;
+            }
+            break;
+          case 710743729:
+            if (name == "SigningCertificatesPerUserQuota")
+            {
+              return SummaryKeyType::SigningCertificatesPerUserQuota;
+            }
+            break;
+          case 840628872:
+            if (name == "AccessKeysPerUserQuota")
+            {
+              return SummaryKeyType::AccessKeysPerUserQuota;
+            }
+            break;
+          case 623577589:
+            if (name == "MFADevices")
+            {
+              return SummaryKeyType::MFADevices;
+            }
+            break;
+          case 1604184365:
+            if (name == "MFADevicesInUse")
+            {
+              return SummaryKeyType::MFADevicesInUse;
+            }
+            break;
+          case -1784111578:
+            if (name == "AccountMFAEnabled")
+            {
+              return SummaryKeyType::AccountMFAEnabled;
+            }
+            break;
+          case -1288942186:
+            if (name == "AccountAccessKeysPresent")
+            {
+              return SummaryKeyType::AccountAccessKeysPresent;
+            }
+            break;
+          case -229614073:
+            if (name == "AccountSigningCertificatesPresent")
+            {
+              return SummaryKeyType::AccountSigningCertificatesPresent;
+            }
+            break;
+          case -1627919006:
+            if (name == "AttachedPoliciesPerGroupQuota")
+            {
+              return SummaryKeyType::AttachedPoliciesPerGroupQuota;
+            }
+            break;
+          case 91119705:
+            if (name == "AttachedPoliciesPerRoleQuota")
+            {
+              return SummaryKeyType::AttachedPoliciesPerRoleQuota;
+            }
+            break;
+          case 94618148:
+            if (name == "AttachedPoliciesPerUserQuota")
+            {
+              return SummaryKeyType::AttachedPoliciesPerUserQuota;
+            }
+            break;
+          case 611538288:
+            if (name == "Policies")
+            {
+              return SummaryKeyType::Policies;
+            }
+            break;
+          case 2066013928:
+            if (name == "PoliciesQuota")
+            {
+              return SummaryKeyType::PoliciesQuota;
+            }
+            break;
+          case 1783640517:
+            if (name == "PolicySizeQuota")
+            {
+              return SummaryKeyType::PolicySizeQuota;
+            }
+            break;
+          case 548552725:
+            if (name == "PolicyVersionsInUse")
+            {
+              return SummaryKeyType::PolicyVersionsInUse;
+            }
+            break;
+          case -583543965:
+            if (name == "PolicyVersionsInUseQuota")
+            {
+              return SummaryKeyType::PolicyVersionsInUseQuota;
+            }
+            break;
+          case -1770916188:
+            if (name == "VersionsPerPolicyQuota")
+            {
+              return SummaryKeyType::VersionsPerPolicyQuota;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -170,69 +233,26 @@ namespace Aws
           return SummaryKeyType::NOT_SET;
         }
 
-        Aws::String GetNameForSummaryKeyType(SummaryKeyType enumValue)
+        const char* GetNameForSummaryKeyTypeCStr(SummaryKeyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SummaryKeyType::Users:
-            return "Users";
-          case SummaryKeyType::UsersQuota:
-            return "UsersQuota";
-          case SummaryKeyType::Groups:
-            return "Groups";
-          case SummaryKeyType::GroupsQuota:
-            return "GroupsQuota";
-          case SummaryKeyType::ServerCertificates:
-            return "ServerCertificates";
-          case SummaryKeyType::ServerCertificatesQuota:
-            return "ServerCertificatesQuota";
-          case SummaryKeyType::UserPolicySizeQuota:
-            return "UserPolicySizeQuota";
-          case SummaryKeyType::GroupPolicySizeQuota:
-            return "GroupPolicySizeQuota";
-          case SummaryKeyType::GroupsPerUserQuota:
-            return "GroupsPerUserQuota";
-          case SummaryKeyType::SigningCertificatesPerUserQuota:
-            return "SigningCertificatesPerUserQuota";
-          case SummaryKeyType::AccessKeysPerUserQuota:
-            return "AccessKeysPerUserQuota";
-          case SummaryKeyType::MFADevices:
-            return "MFADevices";
-          case SummaryKeyType::MFADevicesInUse:
-            return "MFADevicesInUse";
-          case SummaryKeyType::AccountMFAEnabled:
-            return "AccountMFAEnabled";
-          case SummaryKeyType::AccountAccessKeysPresent:
-            return "AccountAccessKeysPresent";
-          case SummaryKeyType::AccountSigningCertificatesPresent:
-            return "AccountSigningCertificatesPresent";
-          case SummaryKeyType::AttachedPoliciesPerGroupQuota:
-            return "AttachedPoliciesPerGroupQuota";
-          case SummaryKeyType::AttachedPoliciesPerRoleQuota:
-            return "AttachedPoliciesPerRoleQuota";
-          case SummaryKeyType::AttachedPoliciesPerUserQuota:
-            return "AttachedPoliciesPerUserQuota";
-          case SummaryKeyType::Policies:
-            return "Policies";
-          case SummaryKeyType::PoliciesQuota:
-            return "PoliciesQuota";
-          case SummaryKeyType::PolicySizeQuota:
-            return "PolicySizeQuota";
-          case SummaryKeyType::PolicyVersionsInUse:
-            return "PolicyVersionsInUse";
-          case SummaryKeyType::PolicyVersionsInUseQuota:
-            return "PolicyVersionsInUseQuota";
-          case SummaryKeyType::VersionsPerPolicyQuota:
-            return "VersionsPerPolicyQuota";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSummaryKeyType(SummaryKeyType enumValue)
+        {
+          return GetNameForSummaryKeyTypeCStr(enumValue);
         }
 
       } // namespace SummaryKeyTypeMapper
@@ -35,6 +35,11 @@ namespace JobTypeMapper
 AWS_IMPORTEXPORT_API JobType GetJobTypeForName(const Aws::String& name);
 
 AWS_IMPORTEXPORT_API Aws::String GetNameForJobType(JobType value);
+
+/**
+ * Same as GetNameForJobType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IMPORTEXPORT_API const char* GetNameForJobTypeCStr(JobType value);
 } // namespace JobTypeMapper
 } // namespace Model
 } // namespace ImportExport
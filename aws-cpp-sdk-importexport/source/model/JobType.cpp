@@ -30,20 +30,37 @@ namespace Aws
       namespace JobTypeMapper
       {
 
-        static const int Import_HASH = HashingUtils::HashString("Import");
-        static const int Export_HASH = HashingUtils::HashString("Export");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Import",
+          "Export",
+        };
 
         JobType GetJobTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Import_HASH)
-          {
-            return JobType::Import;
-          }
-          else if (hashCode == Export_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobType::Export;
+          case -2100928571:
+            if (name == "Import")
+            {
+              return JobType::Import;
+            }
+            break;
+          case 2089680852:
+            if (name == "Export")
+            {
+              return JobType::Export;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return JobType::NOT_SET;
         }
 
-        Aws::String GetNameForJobType(JobType enumValue)
+        const char* GetNameForJobTypeCStr(JobType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobType::Import:
-            return "Import";
-          case JobType::Export:
-            return "Export";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobType(JobType enumValue)
+        {
+          return GetNameForJobTypeCStr(enumValue);
         }
 
       } // namespace JobTypeMapper
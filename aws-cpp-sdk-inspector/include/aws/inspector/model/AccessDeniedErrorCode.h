@@ -41,6 +41,11 @@ namespace AccessDeniedErrorCodeMapper
 AWS_INSPECTOR_API AccessDeniedErrorCode GetAccessDeniedErrorCodeForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForAccessDeniedErrorCode(AccessDeniedErrorCode value);
+
+/**
+ * Same as GetNameForAccessDeniedErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForAccessDeniedErrorCodeCStr(AccessDeniedErrorCode value);
 } // namespace AccessDeniedErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
@@ -36,6 +36,11 @@ namespace AgentHealthMapper
 AWS_INSPECTOR_API AgentHealth GetAgentHealthForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForAgentHealth(AgentHealth value);
+
+/**
+ * Same as GetNameForAgentHealth(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForAgentHealthCStr(AgentHealth value);
 } // namespace AgentHealthMapper
 } // namespace Model
 } // namespace Inspector
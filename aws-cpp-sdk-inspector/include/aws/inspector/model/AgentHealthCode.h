@@ -39,6 +39,11 @@ namespace AgentHealthCodeMapper
 AWS_INSPECTOR_API AgentHealthCode GetAgentHealthCodeForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForAgentHealthCode(AgentHealthCode value);
+
+/**
+ * Same as GetNameForAgentHealthCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForAgentHealthCodeCStr(AgentHealthCode value);
 } // namespace AgentHealthCodeMapper
 } // namespace Model
 } // namespace Inspector
@@ -37,6 +37,11 @@ namespace AssessmentRunNotificationSnsStatusCodeMapper
 AWS_INSPECTOR_API AssessmentRunNotificationSnsStatusCode GetAssessmentRunNotificationSnsStatusCodeForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForAssessmentRunNotificationSnsStatusCode(AssessmentRunNotificationSnsStatusCode value);
+
+/**
+ * Same as GetNameForAssessmentRunNotificationSnsStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForAssessmentRunNotificationSnsStatusCodeCStr(AssessmentRunNotificationSnsStatusCode value);
 } // namespace AssessmentRunNotificationSnsStatusCodeMapper
 } // namespace Model
 } // namespace Inspector
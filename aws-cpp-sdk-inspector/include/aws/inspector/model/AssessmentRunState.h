@@ -46,6 +46,11 @@ namespace AssessmentRunStateMapper
 AWS_INSPECTOR_API AssessmentRunState GetAssessmentRunStateForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForAssessmentRunState(AssessmentRunState value);
+
+/**
+ * Same as GetNameForAssessmentRunState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForAssessmentRunStateCStr(AssessmentRunState value);
 } // namespace AssessmentRunStateMapper
 } // namespace Model
 } // namespace Inspector
@@ -34,6 +34,11 @@ namespace AssetTypeMapper
 AWS_INSPECTOR_API AssetType GetAssetTypeForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForAssetType(AssetType value);
+
+/**
+ * Same as GetNameForAssetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForAssetTypeCStr(AssetType value);
 } // namespace AssetTypeMapper
 } // namespace Model
 } // namespace Inspector
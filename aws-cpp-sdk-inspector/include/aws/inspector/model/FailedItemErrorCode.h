@@ -39,6 +39,11 @@ namespace FailedItemErrorCodeMapper
 AWS_INSPECTOR_API FailedItemErrorCode GetFailedItemErrorCodeForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForFailedItemErrorCode(FailedItemErrorCode value);
+
+/**
+ * Same as GetNameForFailedItemErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForFailedItemErrorCodeCStr(FailedItemErrorCode value);
 } // namespace FailedItemErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
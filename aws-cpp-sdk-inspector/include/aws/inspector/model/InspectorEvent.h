@@ -38,6 +38,11 @@ namespace InspectorEventMapper
 AWS_INSPECTOR_API InspectorEvent GetInspectorEventForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForInspectorEvent(InspectorEvent value);
+
+/**
+ * Same as GetNameForInspectorEvent(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForInspectorEventCStr(InspectorEvent value);
 } // namespace InspectorEventMapper
 } // namespace Model
 } // namespace Inspector
@@ -35,6 +35,11 @@ namespace InvalidCrossAccountRoleErrorCodeMapper
 AWS_INSPECTOR_API InvalidCrossAccountRoleErrorCode GetInvalidCrossAccountRoleErrorCodeForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForInvalidCrossAccountRoleErrorCode(InvalidCrossAccountRoleErrorCode value);
+
+/**
+ * Same as GetNameForInvalidCrossAccountRoleErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForInvalidCrossAccountRoleErrorCodeCStr(InvalidCrossAccountRoleErrorCode value);
 } // namespace InvalidCrossAccountRoleErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
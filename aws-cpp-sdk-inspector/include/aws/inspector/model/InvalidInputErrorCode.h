@@ -87,6 +87,11 @@ namespace InvalidInputErrorCodeMapper
 AWS_INSPECTOR_API InvalidInputErrorCode GetInvalidInputErrorCodeForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForInvalidInputErrorCode(InvalidInputErrorCode value);
+
+/**
+ * Same as GetNameForInvalidInputErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForInvalidInputErrorCodeCStr(InvalidInputErrorCode value);
 } // namespace InvalidInputErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
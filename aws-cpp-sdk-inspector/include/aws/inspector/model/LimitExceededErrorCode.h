@@ -38,6 +38,11 @@ namespace LimitExceededErrorCodeMapper
 AWS_INSPECTOR_API LimitExceededErrorCode GetLimitExceededErrorCodeForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForLimitExceededErrorCode(LimitExceededErrorCode value);
+
+/**
+ * Same as GetNameForLimitExceededErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForLimitExceededErrorCodeCStr(LimitExceededErrorCode value);
 } // namespace LimitExceededErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
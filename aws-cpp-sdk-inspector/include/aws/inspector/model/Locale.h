@@ -34,6 +34,11 @@ namespace LocaleMapper
 AWS_INSPECTOR_API Locale GetLocaleForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForLocale(Locale value);
+
+/**
+ * Same as GetNameForLocale(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForLocaleCStr(Locale value);
 } // namespace LocaleMapper
 } // namespace Model
 } // namespace Inspector
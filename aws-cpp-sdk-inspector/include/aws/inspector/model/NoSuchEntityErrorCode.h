@@ -41,6 +41,11 @@ namespace NoSuchEntityErrorCodeMapper
 AWS_INSPECTOR_API NoSuchEntityErrorCode GetNoSuchEntityErrorCodeForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForNoSuchEntityErrorCode(NoSuchEntityErrorCode value);
+
+/**
+ * Same as GetNameForNoSuchEntityErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForNoSuchEntityErrorCodeCStr(NoSuchEntityErrorCode value);
 } // namespace NoSuchEntityErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
@@ -35,6 +35,11 @@ namespace PreviewStatusMapper
 AWS_INSPECTOR_API PreviewStatus GetPreviewStatusForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForPreviewStatus(PreviewStatus value);
+
+/**
+ * Same as GetNameForPreviewStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForPreviewStatusCStr(PreviewStatus value);
 } // namespace PreviewStatusMapper
 } // namespace Model
 } // namespace Inspector
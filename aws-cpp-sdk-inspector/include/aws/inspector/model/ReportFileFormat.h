@@ -35,6 +35,11 @@ namespace ReportFileFormatMapper
 AWS_INSPECTOR_API ReportFileFormat GetReportFileFormatForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForReportFileFormat(ReportFileFormat value);
+
+/**
+ * Same as GetNameForReportFileFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForReportFileFormatCStr(ReportFileFormat value);
 } // namespace ReportFileFormatMapper
 } // namespace Model
 } // namespace Inspector
@@ -36,6 +36,11 @@ namespace ReportStatusMapper
 AWS_INSPECTOR_API ReportStatus GetReportStatusForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForReportStatus(ReportStatus value);
+
+/**
+ * Same as GetNameForReportStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForReportStatusCStr(ReportStatus value);
 } // namespace ReportStatusMapper
 } // namespace Model
 } // namespace Inspector
@@ -35,6 +35,11 @@ namespace ScopeTypeMapper
 AWS_INSPECTOR_API ScopeType GetScopeTypeForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForScopeType(ScopeType value);
+
+/**
+ * Same as GetNameForScopeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForScopeTypeCStr(ScopeType value);
 } // namespace ScopeTypeMapper
 } // namespace Model
 } // namespace Inspector
@@ -38,6 +38,11 @@ namespace SeverityMapper
 AWS_INSPECTOR_API Severity GetSeverityForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForSeverity(Severity value);
+
+/**
+ * Same as GetNameForSeverity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForSeverityCStr(Severity value);
 } // namespace SeverityMapper
 } // namespace Model
 } // namespace Inspector
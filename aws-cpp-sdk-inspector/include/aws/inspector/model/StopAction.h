@@ -35,6 +35,11 @@ namespace StopActionMapper
 AWS_INSPECTOR_API StopAction GetStopActionForName(const Aws::String& name);
 
 AWS_INSPECTOR_API Aws::String GetNameForStopAction(StopAction value);
+
+/**
+ * Same as GetNameForStopAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_INSPECTOR_API const char* GetNameForStopActionCStr(StopAction value);
 } // namespace StopActionMapper
 } // namespace Model
 } // namespace Inspector
@@ -30,50 +30,79 @@ namespace Aws
       namespace AccessDeniedErrorCodeMapper
       {
 
-        static const int ACCESS_DENIED_TO_ASSESSMENT_TARGET_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_ASSESSMENT_TARGET");
-        static const int ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE");
-        static const int ACCESS_DENIED_TO_ASSESSMENT_RUN_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_ASSESSMENT_RUN");
-        static const int ACCESS_DENIED_TO_FINDING_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_FINDING");
-        static const int ACCESS_DENIED_TO_RESOURCE_GROUP_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_RESOURCE_GROUP");
-        static const int ACCESS_DENIED_TO_RULES_PACKAGE_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_RULES_PACKAGE");
-        static const int ACCESS_DENIED_TO_SNS_TOPIC_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_SNS_TOPIC");
-        static const int ACCESS_DENIED_TO_IAM_ROLE_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_IAM_ROLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCESS_DENIED_TO_ASSESSMENT_TARGET",
+          "ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE",
+          "ACCESS_DENIED_TO_ASSESSMENT_RUN",
+          "ACCESS_DENIED_TO_FINDING",
+          "ACCESS_DENIED_TO_RESOURCE_GROUP",
+          "ACCESS_DENIED_TO_RULES_PACKAGE",
+          "ACCESS_DENIED_TO_SNS_TOPIC",
+          "ACCESS_DENIED_TO_IAM_ROLE",
+        };
 
         AccessDeniedErrorCode GetAccessDeniedErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCESS_DENIED_TO_ASSESSMENT_TARGET_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_TARGET;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_ASSESSMENT_RUN_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_RUN;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_FINDING_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_FINDING;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_RESOURCE_GROUP_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_RESOURCE_GROUP;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_RULES_PACKAGE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_RULES_PACKAGE;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_SNS_TOPIC_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_SNS_TOPIC;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_IAM_ROLE_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_IAM_ROLE;
+          case -262824269:
+            if (name == "ACCESS_DENIED_TO_ASSESSMENT_TARGET")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_TARGET;
+            }
+            break;
+          case -50645732:
+            if (name == "ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE;
+            }
+            break;
+          case 37906569:
+            if (name == "ACCESS_DENIED_TO_ASSESSMENT_RUN")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_RUN;
+            }
+            break;
+          case -1055697234:
+            if (name == "ACCESS_DENIED_TO_FINDING")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_FINDING;
+            }
+            break;
+          case 696867849:
+            if (name == "ACCESS_DENIED_TO_RESOURCE_GROUP")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_RESOURCE_GROUP;
+            }
+            break;
+          case 128309315:
+            if (name == "ACCESS_DENIED_TO_RULES_PACKAGE")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_RULES_PACKAGE;
+            }
+            break;
+          case -1884976787:
+            if (name == "ACCESS_DENIED_TO_SNS_TOPIC")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_SNS_TOPIC;
+            }
+            break;
+          case -241899109:
+            if (name == "ACCESS_DENIED_TO_IAM_ROLE")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_IAM_ROLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return AccessDeniedErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForAccessDeniedErrorCode(AccessDeniedErrorCode enumValue)
+        const char* GetNameForAccessDeniedErrorCodeCStr(AccessDeniedErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_TARGET:
-            return "ACCESS_DENIED_TO_ASSESSMENT_TARGET";
-          case AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE:
-            return "ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE";
-          case AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_RUN:
-            return "ACCESS_DENIED_TO_ASSESSMENT_RUN";
-          case AccessDeniedErrorCode::ACCESS_DENIED_TO_FINDING:
-            return "ACCESS_DENIED_TO_FINDING";
-          case AccessDeniedErrorCode::ACCESS_DENIED_TO_RESOURCE_GROUP:
-            return "ACCESS_DENIED_TO_RESOURCE_GROUP";
-          case AccessDeniedErrorCode::ACCESS_DENIED_TO_RULES_PACKAGE:
-            return "ACCESS_DENIED_TO_RULES_PACKAGE";
-          case AccessDeniedErrorCode::ACCESS_DENIED_TO_SNS_TOPIC:
-            return "ACCESS_DENIED_TO_SNS_TOPIC";
-          case AccessDeniedErrorCode::ACCESS_DENIED_TO_IAM_ROLE:
-            return "ACCESS_DENIED_TO_IAM_ROLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccessDeniedErrorCode(AccessDeniedErrorCode enumValue)
+        {
+          return GetNameForAccessDeniedErrorCodeCStr(enumValue);
         }
 
       } // namespace AccessDeniedErrorCodeMapper
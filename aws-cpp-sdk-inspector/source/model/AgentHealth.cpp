@@ -30,25 +30,44 @@ namespace Aws
       namespace AgentHealthMapper
       {
 
-        static const int HEALTHY_HASH = HashingUtils::HashString("HEALTHY");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HEALTHY",
+          "UNHEALTHY",
+          "UNKNOWN",
+        };
 
         AgentHealth GetAgentHealthForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HEALTHY_HASH)
-          {
-            return AgentHealth::HEALTHY;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AgentHealth::UNHEALTHY;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return AgentHealth::UNKNOWN;
+          case 1513543037:
+            if (name == "HEALTHY")
+            {
+              return AgentHealth::HEALTHY;
+            }
+            break;
+          case 998988996:
+            if (name == "UNHEALTHY")
+            {
+              return AgentHealth::UNHEALTHY;
+            }
+            break;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return AgentHealth::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AgentHealth::NOT_SET;
         }
 
-        Aws::String GetNameForAgentHealth(AgentHealth enumValue)
+        const char* GetNameForAgentHealthCStr(AgentHealth enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AgentHealth::HEALTHY:
-            return "HEALTHY";
-          case AgentHealth::UNHEALTHY:
-            return "UNHEALTHY";
-          case AgentHealth::UNKNOWN:
-            return "UNKNOWN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAgentHealth(AgentHealth enumValue)
+        {
+          return GetNameForAgentHealthCStr(enumValue);
         }
 
       } // namespace AgentHealthMapper
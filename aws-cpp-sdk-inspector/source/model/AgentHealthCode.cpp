@@ -30,40 +30,65 @@ namespace Aws
       namespace AgentHealthCodeMapper
       {
 
-        static const int IDLE_HASH = HashingUtils::HashString("IDLE");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SHUTDOWN_HASH = HashingUtils::HashString("SHUTDOWN");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int THROTTLED_HASH = HashingUtils::HashString("THROTTLED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IDLE",
+          "RUNNING",
+          "SHUTDOWN",
+          "UNHEALTHY",
+          "THROTTLED",
+          "UNKNOWN",
+        };
 
         AgentHealthCode GetAgentHealthCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IDLE_HASH)
-          {
-            return AgentHealthCode::IDLE;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return AgentHealthCode::RUNNING;
-          }
-          else if (hashCode == SHUTDOWN_HASH)
-          {
-            return AgentHealthCode::SHUTDOWN;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
-            return AgentHealthCode::UNHEALTHY;
-          }
-          else if (hashCode == THROTTLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AgentHealthCode::THROTTLED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return AgentHealthCode::UNKNOWN;
+          case 2242516:
+            if (name == "IDLE")
+            {
+              return AgentHealthCode::IDLE;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return AgentHealthCode::RUNNING;
+            }
+            break;
+          case 613283414:
+            if (name == "SHUTDOWN")
+            {
+              return AgentHealthCode::SHUTDOWN;
+            }
+            break;
+          case 998988996:
+            if (name == "UNHEALTHY")
+            {
+              return AgentHealthCode::UNHEALTHY;
+            }
+            break;
+          case 1528687194:
+            if (name == "THROTTLED")
+            {
+              return AgentHealthCode::THROTTLED;
+            }
+            break;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return AgentHealthCode::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return AgentHealthCode::NOT_SET;
         }
 
-        Aws::String GetNameForAgentHealthCode(AgentHealthCode enumValue)
+        const char* GetNameForAgentHealthCodeCStr(AgentHealthCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AgentHealthCode::IDLE:
-            return "IDLE";
-          case AgentHealthCode::RUNNING:
-            return "RUNNING";
-          case AgentHealthCode::SHUTDOWN:
-            return "SHUTDOWN";
-          case AgentHealthCode::UNHEALTHY:
-            return "UNHEALTHY";
-          case AgentHealthCode::THROTTLED:
-            return "THROTTLED";
-          case AgentHealthCode::UNKNOWN:
-            return "UNKNOWN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAgentHealthCode(AgentHealthCode enumValue)
+        {
+          return GetNameForAgentHealthCodeCStr(enumValue);
         }
 
       } // namespace AgentHealthCodeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace AssessmentRunNotificationSnsStatusCodeMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int TOPIC_DOES_NOT_EXIST_HASH = HashingUtils::HashString("TOPIC_DOES_NOT_EXIST");
-        static const int ACCESS_DENIED_HASH = HashingUtils::HashString("ACCESS_DENIED");
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCESS",
+          "TOPIC_DOES_NOT_EXIST",
+          "ACCESS_DENIED",
+          "INTERNAL_ERROR",
+        };
 
         AssessmentRunNotificationSnsStatusCode GetAssessmentRunNotificationSnsStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
-          {
-            return AssessmentRunNotificationSnsStatusCode::SUCCESS;
-          }
-          else if (hashCode == TOPIC_DOES_NOT_EXIST_HASH)
-          {
-            return AssessmentRunNotificationSnsStatusCode::TOPIC_DOES_NOT_EXIST;
-          }
-          else if (hashCode == ACCESS_DENIED_HASH)
-          {
-            return AssessmentRunNotificationSnsStatusCode::ACCESS_DENIED;
-          }
-          else if (hashCode == INTERNAL_ERROR_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssessmentRunNotificationSnsStatusCode::INTERNAL_ERROR;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return AssessmentRunNotificationSnsStatusCode::SUCCESS;
+            }
+            break;
+          case 518257973:
+            if (name == "TOPIC_DOES_NOT_EXIST")
+            {
+              return AssessmentRunNotificationSnsStatusCode::TOPIC_DOES_NOT_EXIST;
+            }
+            break;
+          case 1006971606:
+            if (name == "ACCESS_DENIED")
+            {
+              return AssessmentRunNotificationSnsStatusCode::ACCESS_DENIED;
+            }
+            break;
+          case -485608986:
+            if (name == "INTERNAL_ERROR")
+            {
+              return AssessmentRunNotificationSnsStatusCode::INTERNAL_ERROR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AssessmentRunNotificationSnsStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForAssessmentRunNotificationSnsStatusCode(AssessmentRunNotificationSnsStatusCode enumValue)
+        const char* GetNameForAssessmentRunNotificationSnsStatusCodeCStr(AssessmentRunNotificationSnsStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssessmentRunNotificationSnsStatusCode::SUCCESS:
-            return "SUCCESS";
-          case AssessmentRunNotificationSnsStatusCode::TOPIC_DOES_NOT_EXIST:
-            return "TOPIC_DOES_NOT_EXIST";
-          case AssessmentRunNotificationSnsStatusCode::ACCESS_DENIED:
-            return "ACCESS_DENIED";
-          case AssessmentRunNotificationSnsStatusCode::INTERNAL_ERROR:
-            return "INTERNAL_ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssessmentRunNotificationSnsStatusCode(AssessmentRunNotificationSnsStatusCode enumValue)
+        {
+          return GetNameForAssessmentRunNotificationSnsStatusCodeCStr(enumValue);
         }
 
       } // namespace AssessmentRunNotificationSnsStatusCodeMapper
@@ -30,75 +30,114 @@ namespace Aws
       namespace AssessmentRunStateMapper
       {
 
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
-        static const int START_DATA_COLLECTION_PENDING_HASH = HashingUtils::HashString("START_DATA_COLLECTION_PENDING");
-        static const int START_DATA_COLLECTION_IN_PROGRESS_HASH = HashingUtils::HashString("START_DATA_COLLECTION_IN_PROGRESS");
-        static const int COLLECTING_DATA_HASH = HashingUtils::HashString("COLLECTING_DATA");
-        static const int STOP_DATA_COLLECTION_PENDING_HASH = HashingUtils::HashString("STOP_DATA_COLLECTION_PENDING");
-        static const int DATA_COLLECTED_HASH = HashingUtils::HashString("DATA_COLLECTED");
-        static const int START_EVALUATING_RULES_PENDING_HASH = HashingUtils::HashString("START_EVALUATING_RULES_PENDING");
-        static const int EVALUATING_RULES_HASH = HashingUtils::HashString("EVALUATING_RULES");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int COMPLETED_WITH_ERRORS_HASH = HashingUtils::HashString("COMPLETED_WITH_ERRORS");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATED",
+          "START_DATA_COLLECTION_PENDING",
+          "START_DATA_COLLECTION_IN_PROGRESS",
+          "COLLECTING_DATA",
+          "STOP_DATA_COLLECTION_PENDING",
+          "DATA_COLLECTED",
+          "START_EVALUATING_RULES_PENDING",
+          "EVALUATING_RULES",
+          "FAILED",
+          "ERROR",
+          "COMPLETED",
+          "COMPLETED_WITH_ERRORS",
+          "CANCELED",
+        };
 
         AssessmentRunState GetAssessmentRunStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssessmentRunState::CREATED;
-          }
-          else if (hashCode == START_DATA_COLLECTION_PENDING_HASH)
-          {
-            return AssessmentRunState::START_DATA_COLLECTION_PENDING;
-          }
-          else if (hashCode == START_DATA_COLLECTION_IN_PROGRESS_HASH)
-          {
-            return AssessmentRunState::START_DATA_COLLECTION_IN_PROGRESS;
-          }
-          else if (hashCode == COLLECTING_DATA_HASH)
-          {
-            return AssessmentRunState::COLLECTING_DATA;
-          }
-          else if (hashCode == STOP_DATA_COLLECTION_PENDING_HASH)
-          {
-            return AssessmentRunState::STOP_DATA_COLLECTION_PENDING;
-          }
-          else if (hashCode == DATA_COLLECTED_HASH)
-          {
-            return AssessmentRunState::DATA_COLLECTED;
-          }
-          else if (hashCode == START_EVALUATING_RULES_PENDING_HASH)
-          {
-            return AssessmentRunState::START_EVALUATING_RULES_PENDING;
-          }
-          else if (hashCode == EVALUATING_RULES_HASH)
-          {
-            return AssessmentRunState::EVALUATING_RULES;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AssessmentRunState::FAILED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return AssessmentRunState::ERROR_;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return AssessmentRunState::COMPLETED;
-          }
-          else if (hashCode == COMPLETED_WITH_ERRORS_HASH)
-          {
-            return AssessmentRunState::COMPLETED_WITH_ERRORS;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return AssessmentRunState::CANCELED;
+          case 1746537160:
+            if (name == "CREATED")
+            {
+              return AssessmentRunState::CREATED;
+            }
+            break;
+          case -158474610:
+            if (name == "START_DATA_COLLECTION_PENDING")
+            {
+              return AssessmentRunState::START_DATA_COLLECTION_PENDING;
+            }
+            break;
+          case 1101052318:
+            if (name == "START_DATA_COLLECTION_IN_PROGRESS")
+            {
+              return AssessmentRunState::START_DATA_COLLECTION_IN_PROGRESS;
+            }
+            break;
+          case 1118884113:
+            if (name == "COLLECTING_DATA")
+            {
+              return AssessmentRunState::COLLECTING_DATA;
+            }
+            break;
+          case -879963570:
+            if (name == "STOP_DATA_COLLECTION_PENDING")
+            {
+              return AssessmentRunState::STOP_DATA_COLLECTION_PENDING;
+            }
+            break;
+          case -1608077100:
+            if (name == "DATA_COLLECTED")
+            {
+              return AssessmentRunState::DATA_COLLECTED;
+            }
+            break;
+          case 1750245891:
+            if (name == "START_EVALUATING_RULES_PENDING")
+            {
+              return AssessmentRunState::START_EVALUATING_RULES_PENDING;
+            }
+            break;
+          case -383484306:
+            if (name == "EVALUATING_RULES")
+            {
+              return AssessmentRunState::EVALUATING_RULES;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return AssessmentRunState::FAILED;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return AssessmentRunState::ERROR_;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return AssessmentRunState::COMPLETED;
+            }
+            break;
+          case -1638274832:
+            if (name == "COMPLETED_WITH_ERRORS")
+            {
+              return AssessmentRunState::COMPLETED_WITH_ERRORS;
+            }
+            break;
+          case 659453081:
+            if (name == "CANCELED")
+            {
+              return AssessmentRunState::CANCELED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,45 +149,26 @@ namespace Aws
           return AssessmentRunState::NOT_SET;
         }
 
-        Aws::String GetNameForAssessmentRunState(AssessmentRunState enumValue)
+        const char* GetNameForAssessmentRunStateCStr(AssessmentRunState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssessmentRunState::CREATED:
-            return "CREATED";
-          case AssessmentRunState::START_DATA_COLLECTION_PENDING:
-            return "START_DATA_COLLECTION_PENDING";
-          case AssessmentRunState::START_DATA_COLLECTION_IN_PROGRESS:
-            return "START_DATA_COLLECTION_IN_PROGRESS";
-          case AssessmentRunState::COLLECTING_DATA:
-            return "COLLECTING_DATA";
-          case AssessmentRunState::STOP_DATA_COLLECTION_PENDING:
-            return "STOP_DATA_COLLECTION_PENDING";
-          case AssessmentRunState::DATA_COLLECTED:
-            return "DATA_COLLECTED";
-          case AssessmentRunState::START_EVALUATING_RULES_PENDING:
-            return "START_EVALUATING_RULES_PENDING";
-          case AssessmentRunState::EVALUATING_RULES:
-            return "EVALUATING_RULES";
-          case AssessmentRunState::FAILED:
-            return "FAILED";
-          case AssessmentRunState::ERROR_:
-            return "ERROR";
-          case AssessmentRunState::COMPLETED:
-            return "COMPLETED";
-          case AssessmentRunState::COMPLETED_WITH_ERRORS:
-            return "COMPLETED_WITH_ERRORS";
-          case AssessmentRunState::CANCELED:
-            return "CANCELED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssessmentRunState(AssessmentRunState enumValue)
+        {
+          return GetNameForAssessmentRunStateCStr(enumValue);
         }
 
       } // namespace AssessmentRunStateMapper
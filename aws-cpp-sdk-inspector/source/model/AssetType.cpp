@@ -30,15 +30,30 @@ namespace Aws
       namespace AssetTypeMapper
       {
 
-        static const int ec2_instance_HASH = HashingUtils::HashString("ec2-instance");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ec2-instance",
+        };
 
         AssetType GetAssetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ec2_instance_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssetType::ec2_instance;
+          case -2063757586:
+            if (name == "ec2-instance")
+            {
+              return AssetType::ec2_instance;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return AssetType::NOT_SET;
         }
 
-        Aws::String GetNameForAssetType(AssetType enumValue)
+        const char* GetNameForAssetTypeCStr(AssetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssetType::ec2_instance:
-            return "ec2-instance";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssetType(AssetType enumValue)
+        {
+          return GetNameForAssetTypeCStr(enumValue);
         }
 
       } // namespace AssetTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace FailedItemErrorCodeMapper
       {
 
-        static const int INVALID_ARN_HASH = HashingUtils::HashString("INVALID_ARN");
-        static const int DUPLICATE_ARN_HASH = HashingUtils::HashString("DUPLICATE_ARN");
-        static const int ITEM_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ITEM_DOES_NOT_EXIST");
-        static const int ACCESS_DENIED_HASH = HashingUtils::HashString("ACCESS_DENIED");
-        static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LIMIT_EXCEEDED");
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INVALID_ARN",
+          "DUPLICATE_ARN",
+          "ITEM_DOES_NOT_EXIST",
+          "ACCESS_DENIED",
+          "LIMIT_EXCEEDED",
+          "INTERNAL_ERROR",
+        };
 
         FailedItemErrorCode GetFailedItemErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVALID_ARN_HASH)
-          {
-            return FailedItemErrorCode::INVALID_ARN;
-          }
-          else if (hashCode == DUPLICATE_ARN_HASH)
-          {
-            return FailedItemErrorCode::DUPLICATE_ARN;
-          }
-          else if (hashCode == ITEM_DOES_NOT_EXIST_HASH)
-          {
-            return FailedItemErrorCode::ITEM_DOES_NOT_EXIST;
-          }
-          else if (hashCode == ACCESS_DENIED_HASH)
-          {
-            return FailedItemErrorCode::ACCESS_DENIED;
-          }
-          else if (hashCode == LIMIT_EXCEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FailedItemErrorCode::LIMIT_EXCEEDED;
-          }
-          else if (hashCode == INTERNAL_ERROR_HASH)
-          {
-            return FailedItemErrorCode::INTERNAL_ERROR;
+          case 1201072085:
+            if (name == "INVALID_ARN")
+            {
+              return FailedItemErrorCode::INVALID_ARN;
+            }
+            break;
+          case 1866865897:
+            if (name == "DUPLICATE_ARN")
+            {
+              return FailedItemErrorCode::DUPLICATE_ARN;
+            }
+            break;
+          case -350349647:
+            if (name == "ITEM_DOES_NOT_EXIST")
+            {
+              return FailedItemErrorCode::ITEM_DOES_NOT_EXIST;
+            }
+            break;
+          case 1006971606:
+            if (name == "ACCESS_DENIED")
+            {
+              return FailedItemErrorCode::ACCESS_DENIED;
+            }
+            break;
+          case -1452302473:
+            if (name == "LIMIT_EXCEEDED")
+            {
+              return FailedItemErrorCode::LIMIT_EXCEEDED;
+            }
+            break;
+          case -485608986:
+            if (name == "INTERNAL_ERROR")
+            {
+              return FailedItemErrorCode::INTERNAL_ERROR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return FailedItemErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForFailedItemErrorCode(FailedItemErrorCode enumValue)
+        const char* GetNameForFailedItemErrorCodeCStr(FailedItemErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FailedItemErrorCode::INVALID_ARN:
-            return "INVALID_ARN";
-          case FailedItemErrorCode::DUPLICATE_ARN:
-            return "DUPLICATE_ARN";
-          case FailedItemErrorCode::ITEM_DOES_NOT_EXIST:
-            return "ITEM_DOES_NOT_EXIST";
-          case FailedItemErrorCode::ACCESS_DENIED:
-            return "ACCESS_DENIED";
-          case FailedItemErrorCode::LIMIT_EXCEEDED:
-            return "LIMIT_EXCEEDED";
-          case FailedItemErrorCode::INTERNAL_ERROR:
-            return "INTERNAL_ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFailedItemErrorCode(FailedItemErrorCode enumValue)
+        {
+          return GetNameForFailedItemErrorCodeCStr(enumValue);
         }
 
       } // namespace FailedItemErrorCodeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace InspectorEventMapper
       {
 
-        static const int ASSESSMENT_RUN_STARTED_HASH = HashingUtils::HashString("ASSESSMENT_RUN_STARTED");
-        static const int ASSESSMENT_RUN_COMPLETED_HASH = HashingUtils::HashString("ASSESSMENT_RUN_COMPLETED");
-        static const int ASSESSMENT_RUN_STATE_CHANGED_HASH = HashingUtils::HashString("ASSESSMENT_RUN_STATE_CHANGED");
-        static const int FINDING_REPORTED_HASH = HashingUtils::HashString("FINDING_REPORTED");
-        static const int OTHER_HASH = HashingUtils::HashString("OTHER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ASSESSMENT_RUN_STARTED",
+          "ASSESSMENT_RUN_COMPLETED",
+          "ASSESSMENT_RUN_STATE_CHANGED",
+          "FINDING_REPORTED",
+          "OTHER",
+        };
 
         InspectorEvent GetInspectorEventForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASSESSMENT_RUN_STARTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InspectorEvent::ASSESSMENT_RUN_STARTED;
-          }
-          else if (hashCode == ASSESSMENT_RUN_COMPLETED_HASH)
-          {
-            return InspectorEvent::ASSESSMENT_RUN_COMPLETED;
-          }
-          else if (hashCode == ASSESSMENT_RUN_STATE_CHANGED_HASH)
-          {
-            return InspectorEvent::ASSESSMENT_RUN_STATE_CHANGED;
-          }
-          else if (hashCode == FINDING_REPORTED_HASH)
-          {
-            return InspectorEvent::FINDING_REPORTED;
-          }
-          else if (hashCode == OTHER_HASH)
-          {
-            return InspectorEvent::OTHER;
+          case -376077168:
+            if (name == "ASSESSMENT_RUN_STARTED")
+            {
+              return InspectorEvent::ASSESSMENT_RUN_STARTED;
+            }
+            break;
+          case 92958362:
+            if (name == "ASSESSMENT_RUN_COMPLETED")
+            {
+              return InspectorEvent::ASSESSMENT_RUN_COMPLETED;
+            }
+            break;
+          case 755104181:
+            if (name == "ASSESSMENT_RUN_STATE_CHANGED")
+            {
+              return InspectorEvent::ASSESSMENT_RUN_STATE_CHANGED;
+            }
+            break;
+          case -467589911:
+            if (name == "FINDING_REPORTED")
+            {
+              return InspectorEvent::FINDING_REPORTED;
+            }
+            break;
+          case 75532016:
+            if (name == "OTHER")
+            {
+              return InspectorEvent::OTHER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return InspectorEvent::NOT_SET;
         }
 
-        Aws::String GetNameForInspectorEvent(InspectorEvent enumValue)
+        const char* GetNameForInspectorEventCStr(InspectorEvent enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InspectorEvent::ASSESSMENT_RUN_STARTED:
-            return "ASSESSMENT_RUN_STARTED";
-          case InspectorEvent::ASSESSMENT_RUN_COMPLETED:
-            return "ASSESSMENT_RUN_COMPLETED";
-          case InspectorEvent::ASSESSMENT_RUN_STATE_CHANGED:
-            return "ASSESSMENT_RUN_STATE_CHANGED";
-          case InspectorEvent::FINDING_REPORTED:
-            return "FINDING_REPORTED";
-          case InspectorEvent::OTHER:
-            return "OTHER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInspectorEvent(InspectorEvent enumValue)
+        {
+          return GetNameForInspectorEventCStr(enumValue);
         }
 
       } // namespace InspectorEventMapper
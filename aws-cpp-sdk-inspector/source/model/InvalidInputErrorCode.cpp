@@ -30,280 +30,401 @@ namespace Aws
       namespace InvalidInputErrorCodeMapper
       {
 
-        static const int INVALID_ASSESSMENT_TARGET_ARN_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TARGET_ARN");
-        static const int INVALID_ASSESSMENT_TEMPLATE_ARN_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TEMPLATE_ARN");
-        static const int INVALID_ASSESSMENT_RUN_ARN_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_ARN");
-        static const int INVALID_FINDING_ARN_HASH = HashingUtils::HashString("INVALID_FINDING_ARN");
-        static const int INVALID_RESOURCE_GROUP_ARN_HASH = HashingUtils::HashString("INVALID_RESOURCE_GROUP_ARN");
-        static const int INVALID_RULES_PACKAGE_ARN_HASH = HashingUtils::HashString("INVALID_RULES_PACKAGE_ARN");
-        static const int INVALID_RESOURCE_ARN_HASH = HashingUtils::HashString("INVALID_RESOURCE_ARN");
-        static const int INVALID_SNS_TOPIC_ARN_HASH = HashingUtils::HashString("INVALID_SNS_TOPIC_ARN");
-        static const int INVALID_IAM_ROLE_ARN_HASH = HashingUtils::HashString("INVALID_IAM_ROLE_ARN");
-        static const int INVALID_ASSESSMENT_TARGET_NAME_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TARGET_NAME");
-        static const int INVALID_ASSESSMENT_TARGET_NAME_PATTERN_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TARGET_NAME_PATTERN");
-        static const int INVALID_ASSESSMENT_TEMPLATE_NAME_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TEMPLATE_NAME");
-        static const int INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN");
-        static const int INVALID_ASSESSMENT_TEMPLATE_DURATION_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TEMPLATE_DURATION");
-        static const int INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE");
-        static const int INVALID_ASSESSMENT_RUN_DURATION_RANGE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_DURATION_RANGE");
-        static const int INVALID_ASSESSMENT_RUN_START_TIME_RANGE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_START_TIME_RANGE");
-        static const int INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE");
-        static const int INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE");
-        static const int INVALID_ASSESSMENT_RUN_STATE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_STATE");
-        static const int INVALID_TAG_HASH = HashingUtils::HashString("INVALID_TAG");
-        static const int INVALID_TAG_KEY_HASH = HashingUtils::HashString("INVALID_TAG_KEY");
-        static const int INVALID_TAG_VALUE_HASH = HashingUtils::HashString("INVALID_TAG_VALUE");
-        static const int INVALID_RESOURCE_GROUP_TAG_KEY_HASH = HashingUtils::HashString("INVALID_RESOURCE_GROUP_TAG_KEY");
-        static const int INVALID_RESOURCE_GROUP_TAG_VALUE_HASH = HashingUtils::HashString("INVALID_RESOURCE_GROUP_TAG_VALUE");
-        static const int INVALID_ATTRIBUTE_HASH = HashingUtils::HashString("INVALID_ATTRIBUTE");
-        static const int INVALID_USER_ATTRIBUTE_HASH = HashingUtils::HashString("INVALID_USER_ATTRIBUTE");
-        static const int INVALID_USER_ATTRIBUTE_KEY_HASH = HashingUtils::HashString("INVALID_USER_ATTRIBUTE_KEY");
-        static const int INVALID_USER_ATTRIBUTE_VALUE_HASH = HashingUtils::HashString("INVALID_USER_ATTRIBUTE_VALUE");
-        static const int INVALID_PAGINATION_TOKEN_HASH = HashingUtils::HashString("INVALID_PAGINATION_TOKEN");
-        static const int INVALID_MAX_RESULTS_HASH = HashingUtils::HashString("INVALID_MAX_RESULTS");
-        static const int INVALID_AGENT_ID_HASH = HashingUtils::HashString("INVALID_AGENT_ID");
-        static const int INVALID_AUTO_SCALING_GROUP_HASH = HashingUtils::HashString("INVALID_AUTO_SCALING_GROUP");
-        static const int INVALID_RULE_NAME_HASH = HashingUtils::HashString("INVALID_RULE_NAME");
-        static const int INVALID_SEVERITY_HASH = HashingUtils::HashString("INVALID_SEVERITY");
-        static const int INVALID_LOCALE_HASH = HashingUtils::HashString("INVALID_LOCALE");
-        static const int INVALID_EVENT_HASH = HashingUtils::HashString("INVALID_EVENT");
-        static const int ASSESSMENT_TARGET_NAME_ALREADY_TAKEN_HASH = HashingUtils::HashString("ASSESSMENT_TARGET_NAME_ALREADY_TAKEN");
-        static const int ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN_HASH = HashingUtils::HashString("ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN");
-        static const int INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS");
-        static const int INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS");
-        static const int INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS");
-        static const int INVALID_NUMBER_OF_FINDING_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_FINDING_ARNS");
-        static const int INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS");
-        static const int INVALID_NUMBER_OF_RULES_PACKAGE_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_RULES_PACKAGE_ARNS");
-        static const int INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES");
-        static const int INVALID_NUMBER_OF_TAGS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_TAGS");
-        static const int INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS");
-        static const int INVALID_NUMBER_OF_ATTRIBUTES_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_ATTRIBUTES");
-        static const int INVALID_NUMBER_OF_USER_ATTRIBUTES_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_USER_ATTRIBUTES");
-        static const int INVALID_NUMBER_OF_AGENT_IDS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_AGENT_IDS");
-        static const int INVALID_NUMBER_OF_AUTO_SCALING_GROUPS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_AUTO_SCALING_GROUPS");
-        static const int INVALID_NUMBER_OF_RULE_NAMES_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_RULE_NAMES");
-        static const int INVALID_NUMBER_OF_SEVERITIES_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_SEVERITIES");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INVALID_ASSESSMENT_TARGET_ARN",
+          "INVALID_ASSESSMENT_TEMPLATE_ARN",
+          "INVALID_ASSESSMENT_RUN_ARN",
+          "INVALID_FINDING_ARN",
+          "INVALID_RESOURCE_GROUP_ARN",
+          "INVALID_RULES_PACKAGE_ARN",
+          "INVALID_RESOURCE_ARN",
+          "INVALID_SNS_TOPIC_ARN",
+          "INVALID_IAM_ROLE_ARN",
+          "INVALID_ASSESSMENT_TARGET_NAME",
+          "INVALID_ASSESSMENT_TARGET_NAME_PATTERN",
+          "INVALID_ASSESSMENT_TEMPLATE_NAME",
+          "INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN",
+          "INVALID_ASSESSMENT_TEMPLATE_DURATION",
+          "INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE",
+          "INVALID_ASSESSMENT_RUN_DURATION_RANGE",
+          "INVALID_ASSESSMENT_RUN_START_TIME_RANGE",
+          "INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE",
+          "INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE",
+          "INVALID_ASSESSMENT_RUN_STATE",
+          "INVALID_TAG",
+          "INVALID_TAG_KEY",
+          "INVALID_TAG_VALUE",
+          "INVALID_RESOURCE_GROUP_TAG_KEY",
+          "INVALID_RESOURCE_GROUP_TAG_VALUE",
+          "INVALID_ATTRIBUTE",
+          "INVALID_USER_ATTRIBUTE",
+          "INVALID_USER_ATTRIBUTE_KEY",
+          "INVALID_USER_ATTRIBUTE_VALUE",
+          "INVALID_PAGINATION_TOKEN",
+          "INVALID_MAX_RESULTS",
+          "INVALID_AGENT_ID",
+          "INVALID_AUTO_SCALING_GROUP",
+          "INVALID_RULE_NAME",
+          "INVALID_SEVERITY",
+          "INVALID_LOCALE",
+          "INVALID_EVENT",
+          "ASSESSMENT_TARGET_NAME_ALREADY_TAKEN",
+          "ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN",
+          "INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS",
+          "INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS",
+          "INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS",
+          "INVALID_NUMBER_OF_FINDING_ARNS",
+          "INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS",
+          "INVALID_NUMBER_OF_RULES_PACKAGE_ARNS",
+          "INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES",
+          "INVALID_NUMBER_OF_TAGS",
+          "INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS",
+          "INVALID_NUMBER_OF_ATTRIBUTES",
+          "INVALID_NUMBER_OF_USER_ATTRIBUTES",
+          "INVALID_NUMBER_OF_AGENT_IDS",
+          "INVALID_NUMBER_OF_AUTO_SCALING_GROUPS",
+          "INVALID_NUMBER_OF_RULE_NAMES",
+          "INVALID_NUMBER_OF_SEVERITIES",
+        };
 
         InvalidInputErrorCode GetInvalidInputErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVALID_ASSESSMENT_TARGET_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_ARN;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TEMPLATE_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_ARN;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_ARN;
-          }
-          else if (hashCode == INVALID_FINDING_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_FINDING_ARN;
-          }
-          else if (hashCode == INVALID_RESOURCE_GROUP_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_ARN;
-          }
-          else if (hashCode == INVALID_RULES_PACKAGE_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RULES_PACKAGE_ARN;
-          }
-          else if (hashCode == INVALID_RESOURCE_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RESOURCE_ARN;
-          }
-          else if (hashCode == INVALID_SNS_TOPIC_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_SNS_TOPIC_ARN;
-          }
-          else if (hashCode == INVALID_IAM_ROLE_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_IAM_ROLE_ARN;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TARGET_NAME_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_NAME;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TARGET_NAME_PATTERN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_NAME_PATTERN;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TEMPLATE_NAME_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_NAME;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TEMPLATE_DURATION_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_DURATION;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_DURATION_RANGE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_DURATION_RANGE;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_START_TIME_RANGE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_START_TIME_RANGE;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_STATE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_STATE;
-          }
-          else if (hashCode == INVALID_TAG_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_TAG;
-          }
-          else if (hashCode == INVALID_TAG_KEY_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_TAG_KEY;
-          }
-          else if (hashCode == INVALID_TAG_VALUE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_TAG_VALUE;
-          }
-          else if (hashCode == INVALID_RESOURCE_GROUP_TAG_KEY_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_TAG_KEY;
-          }
-          else if (hashCode == INVALID_RESOURCE_GROUP_TAG_VALUE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_TAG_VALUE;
-          }
-          else if (hashCode == INVALID_ATTRIBUTE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ATTRIBUTE;
-          }
-          else if (hashCode == INVALID_USER_ATTRIBUTE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE;
-          }
-          else if (hashCode == INVALID_USER_ATTRIBUTE_KEY_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE_KEY;
-          }
-          else if (hashCode == INVALID_USER_ATTRIBUTE_VALUE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE_VALUE;
-          }
-          else if (hashCode == INVALID_PAGINATION_TOKEN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_PAGINATION_TOKEN;
-          }
-          else if (hashCode == INVALID_MAX_RESULTS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_MAX_RESULTS;
-          }
-          else if (hashCode == INVALID_AGENT_ID_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_AGENT_ID;
-          }
-          else if (hashCode == INVALID_AUTO_SCALING_GROUP_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_AUTO_SCALING_GROUP;
-          }
-          else if (hashCode == INVALID_RULE_NAME_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RULE_NAME;
-          }
-          else if (hashCode == INVALID_SEVERITY_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_SEVERITY;
-          }
-          else if (hashCode == INVALID_LOCALE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_LOCALE;
-          }
-          else if (hashCode == INVALID_EVENT_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_EVENT;
-          }
-          else if (hashCode == ASSESSMENT_TARGET_NAME_ALREADY_TAKEN_HASH)
-          {
-            return InvalidInputErrorCode::ASSESSMENT_TARGET_NAME_ALREADY_TAKEN;
-          }
-          else if (hashCode == ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN_HASH)
-          {
-            return InvalidInputErrorCode::ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_FINDING_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_FINDING_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_RULES_PACKAGE_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_RULES_PACKAGE_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_TAGS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_TAGS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_ATTRIBUTES_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_ATTRIBUTES;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_USER_ATTRIBUTES_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_USER_ATTRIBUTES;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_AGENT_IDS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_AGENT_IDS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_AUTO_SCALING_GROUPS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_AUTO_SCALING_GROUPS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_RULE_NAMES_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_RULE_NAMES;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_SEVERITIES_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_SEVERITIES;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 1888312260:
+            if (name == "INVALID_ASSESSMENT_TARGET_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_ARN;
+            }
+            break;
+          case 515611885:
+            if (name == "INVALID_ASSESSMENT_TEMPLATE_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_ARN;
+            }
+            break;
+          case 1107286356:
+            if (name == "INVALID_ASSESSMENT_RUN_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_ARN;
+            }
+            break;
+          case -147305985:
+            if (name == "INVALID_FINDING_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_FINDING_ARN;
+            }
+            break;
+          case -1113518892:
+            if (name == "INVALID_RESOURCE_GROUP_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_ARN;
+            }
+            break;
+          case 479186644:
+            if (name == "INVALID_RULES_PACKAGE_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_RULES_PACKAGE_ARN;
+            }
+            break;
+          case -958100492:
+            if (name == "INVALID_RESOURCE_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_RESOURCE_ARN;
+            }
+            break;
+          case 1998920830:
+            if (name == "INVALID_SNS_TOPIC_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_SNS_TOPIC_ARN;
+            }
+            break;
+          case -240738522:
+            if (name == "INVALID_IAM_ROLE_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_IAM_ROLE_ARN;
+            }
+            break;
+          case -1591491100:
+            if (name == "INVALID_ASSESSMENT_TARGET_NAME")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_NAME;
+            }
+            break;
+          case 213237781:
+            if (name == "INVALID_ASSESSMENT_TARGET_NAME_PATTERN")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_NAME_PATTERN;
+            }
+            break;
+          case -1195529765:
+            if (name == "INVALID_ASSESSMENT_TEMPLATE_NAME")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_NAME;
+            }
+            break;
+          case 935574796:
+            if (name == "INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN;
+            }
+            break;
+          case -2022224668:
+            if (name == "INVALID_ASSESSMENT_TEMPLATE_DURATION")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_DURATION;
+            }
+            break;
+          case -275139070:
+            if (name == "INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE;
+            }
+            break;
+          case -1794014405:
+            if (name == "INVALID_ASSESSMENT_RUN_DURATION_RANGE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_DURATION_RANGE;
+            }
+            break;
+          case 755543953:
+            if (name == "INVALID_ASSESSMENT_RUN_START_TIME_RANGE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_START_TIME_RANGE;
+            }
+            break;
+          case -1194719035:
+            if (name == "INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE;
+            }
+            break;
+          case 1521927779:
+            if (name == "INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE;
+            }
+            break;
+          case -1033028152:
+            if (name == "INVALID_ASSESSMENT_RUN_STATE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_STATE;
+            }
+            break;
+          case 1201089810:
+            if (name == "INVALID_TAG")
+            {
+              return InvalidInputErrorCode::INVALID_TAG;
+            }
+            break;
+          case 526558610:
+            if (name == "INVALID_TAG_KEY")
+            {
+              return InvalidInputErrorCode::INVALID_TAG_KEY;
+            }
+            break;
+          case -773286940:
+            if (name == "INVALID_TAG_VALUE")
+            {
+              return InvalidInputErrorCode::INVALID_TAG_VALUE;
+            }
+            break;
+          case -1983630575:
+            if (name == "INVALID_RESOURCE_GROUP_TAG_KEY")
+            {
+              return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_TAG_KEY;
+            }
+            break;
+          case 706526627:
+            if (name == "INVALID_RESOURCE_GROUP_TAG_VALUE")
+            {
+              return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_TAG_VALUE;
+            }
+            break;
+          case 525734420:
+            if (name == "INVALID_ATTRIBUTE")
+            {
+              return InvalidInputErrorCode::INVALID_ATTRIBUTE;
+            }
+            break;
+          case 1068187248:
+            if (name == "INVALID_USER_ATTRIBUTE")
+            {
+              return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE;
+            }
+            break;
+          case -499984400:
+            if (name == "INVALID_USER_ATTRIBUTE_KEY")
+            {
+              return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE_KEY;
+            }
+            break;
+          case 561358530:
+            if (name == "INVALID_USER_ATTRIBUTE_VALUE")
+            {
+              return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE_VALUE;
+            }
+            break;
+          case -902161828:
+            if (name == "INVALID_PAGINATION_TOKEN")
+            {
+              return InvalidInputErrorCode::INVALID_PAGINATION_TOKEN;
+            }
+            break;
+          case -201661069:
+            if (name == "INVALID_MAX_RESULTS")
+            {
+              return InvalidInputErrorCode::INVALID_MAX_RESULTS;
+            }
+            break;
+          case 1347179037:
+            if (name == "INVALID_AGENT_ID")
+            {
+              return InvalidInputErrorCode::INVALID_AGENT_ID;
+            }
+            break;
+          case -626672545:
+            if (name == "INVALID_AUTO_SCALING_GROUP")
+            {
+              return InvalidInputErrorCode::INVALID_AUTO_SCALING_GROUP;
+            }
+            break;
+          case -1549995642:
+            if (name == "INVALID_RULE_NAME")
+            {
+              return InvalidInputErrorCode::INVALID_RULE_NAME;
+            }
+            break;
+          case 1356290149:
+            if (name == "INVALID_SEVERITY")
+            {
+              return InvalidInputErrorCode::INVALID_SEVERITY;
+            }
+            break;
+          case 77828546:
+            if (name == "INVALID_LOCALE")
+            {
+              return InvalidInputErrorCode::INVALID_LOCALE;
+            }
+            break;
+          case -1112121838:
+            if (name == "INVALID_EVENT")
+            {
+              return InvalidInputErrorCode::INVALID_EVENT;
+            }
+            break;
+          case -820262563:
+            if (name == "ASSESSMENT_TARGET_NAME_ALREADY_TAKEN")
+            {
+              return InvalidInputErrorCode::ASSESSMENT_TARGET_NAME_ALREADY_TAKEN;
+            }
+            break;
+          case -1541100780:
+            if (name == "ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN")
+            {
+              return InvalidInputErrorCode::ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN;
+            }
+            break;
+          case -1273275135:
+            if (name == "INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS;
+            }
+            break;
+          case 23399544:
+            if (name == "INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS;
+            }
+            break;
+          case 661481165:
+            if (name == "INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS;
+            }
+            break;
+          case -223470426:
+            if (name == "INVALID_NUMBER_OF_FINDING_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_FINDING_ARNS;
+            }
+            break;
+          case 535995213:
+            if (name == "INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS;
+            }
+            break;
+          case -640084751:
+            if (name == "INVALID_NUMBER_OF_RULES_PACKAGE_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_RULES_PACKAGE_ARNS;
+            }
+            break;
+          case 545027417:
+            if (name == "INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES;
+            }
+            break;
+          case 1122643443:
+            if (name == "INVALID_NUMBER_OF_TAGS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_TAGS;
+            }
+            break;
+          case 536544688:
+            if (name == "INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS;
+            }
+            break;
+          case 199510961:
+            if (name == "INVALID_NUMBER_OF_ATTRIBUTES")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_ATTRIBUTES;
+            }
+            break;
+          case -80118735:
+            if (name == "INVALID_NUMBER_OF_USER_ATTRIBUTES")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_USER_ATTRIBUTES;
+            }
+            break;
+          case 1757261988:
+            if (name == "INVALID_NUMBER_OF_AGENT_IDS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_AGENT_IDS;
+            }
+            break;
+          case -1551637214:
+            if (name == "INVALID_NUMBER_OF_AUTO_SCALING_GROUPS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_AUTO_SCALING_GROUPS;
+            }
+            break;
+          case 276388479:
+            if (name == "INVALID_NUMBER_OF_RULE_NAMES")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_RULE_NAMES;
+            }
+            break;
+          case -1193624907:
+            if (name == "INVALID_NUMBER_OF_SEVERITIES")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_SEVERITIES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -315,127 +436,26 @@ namespace Aws
           return InvalidInputErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForInvalidInputErrorCode(InvalidInputErrorCode enumValue)
+        const char* GetNameForInvalidInputErrorCodeCStr(InvalidInputErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_ARN:
-            return "INVALID_ASSESSMENT_TARGET_ARN";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_ARN:
-            return "INVALID_ASSESSMENT_TEMPLATE_ARN";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_ARN:
-            return "INVALID_ASSESSMENT_RUN_ARN";
-          case InvalidInputErrorCode::INVALID_FINDING_ARN:
-            return "INVALID_FINDING_ARN";
-          case InvalidInputErrorCode::INVALID_RESOURCE_GROUP_ARN:
-            return "INVALID_RESOURCE_GROUP_ARN";
-          case InvalidInputErrorCode::INVALID_RULES_PACKAGE_ARN:
-            return "INVALID_RULES_PACKAGE_ARN";
-          case InvalidInputErrorCode::INVALID_RESOURCE_ARN:
-            return "INVALID_RESOURCE_ARN";
-          case InvalidInputErrorCode::INVALID_SNS_TOPIC_ARN:
-            return "INVALID_SNS_TOPIC_ARN";
-          case InvalidInputErrorCode::INVALID_IAM_ROLE_ARN:
-            return "INVALID_IAM_ROLE_ARN";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_NAME:
-            return "INVALID_ASSESSMENT_TARGET_NAME";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_NAME_PATTERN:
-            return "INVALID_ASSESSMENT_TARGET_NAME_PATTERN";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_NAME:
-            return "INVALID_ASSESSMENT_TEMPLATE_NAME";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN:
-            return "INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_DURATION:
-            return "INVALID_ASSESSMENT_TEMPLATE_DURATION";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE:
-            return "INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_DURATION_RANGE:
-            return "INVALID_ASSESSMENT_RUN_DURATION_RANGE";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_START_TIME_RANGE:
-            return "INVALID_ASSESSMENT_RUN_START_TIME_RANGE";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE:
-            return "INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE:
-            return "INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE";
-          case InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_STATE:
-            return "INVALID_ASSESSMENT_RUN_STATE";
-          case InvalidInputErrorCode::INVALID_TAG:
-            return "INVALID_TAG";
-          case InvalidInputErrorCode::INVALID_TAG_KEY:
-            return "INVALID_TAG_KEY";
-          case InvalidInputErrorCode::INVALID_TAG_VALUE:
-            return "INVALID_TAG_VALUE";
-          case InvalidInputErrorCode::INVALID_RESOURCE_GROUP_TAG_KEY:
-            return "INVALID_RESOURCE_GROUP_TAG_KEY";
-          case InvalidInputErrorCode::INVALID_RESOURCE_GROUP_TAG_VALUE:
-            return "INVALID_RESOURCE_GROUP_TAG_VALUE";
-          case InvalidInputErrorCode::INVALID_ATTRIBUTE:
-            return "INVALID_ATTRIBUTE";
-          case InvalidInputErrorCode::INVALID_USER_ATTRIBUTE:
-            return "INVALID_USER_ATTRIBUTE";
-          case InvalidInputErrorCode::INVALID_USER_ATTRIBUTE_KEY:
-            return "INVALID_USER_ATTRIBUTE_KEY";
-          case InvalidInputErrorCode::INVALID_USER_ATTRIBUTE_VALUE:
-            return "INVALID_USER_ATTRIBUTE_VALUE";
-          case InvalidInputErrorCode::INVALID_PAGINATION_TOKEN:
-            return "INVALID_PAGINATION_TOKEN";
-          case InvalidInputErrorCode::INVALID_MAX_RESULTS:
-            return "INVALID_MAX_RESULTS";
-          case InvalidInputErrorCode::INVALID_AGENT_ID:
-            return "INVALID_AGENT_ID";
-          case InvalidInputErrorCode::INVALID_AUTO_SCALING_GROUP:
-            return "INVALID_AUTO_SCALING_GROUP";
-          case InvalidInputErrorCode::INVALID_RULE_NAME:
-            return "INVALID_RULE_NAME";
-          case InvalidInputErrorCode::INVALID_SEVERITY:
-            return "INVALID_SEVERITY";
-          case InvalidInputErrorCode::INVALID_LOCALE:
-            return "INVALID_LOCALE";
-          case InvalidInputErrorCode::INVALID_EVENT:
-            return "INVALID_EVENT";
-          case InvalidInputErrorCode::ASSESSMENT_TARGET_NAME_ALREADY_TAKEN:
-            return "ASSESSMENT_TARGET_NAME_ALREADY_TAKEN";
-          case InvalidInputErrorCode::ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN:
-            return "ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS:
-            return "INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS:
-            return "INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS:
-            return "INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_FINDING_ARNS:
-            return "INVALID_NUMBER_OF_FINDING_ARNS";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS:
-            return "INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_RULES_PACKAGE_ARNS:
-            return "INVALID_NUMBER_OF_RULES_PACKAGE_ARNS";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES:
-            return "INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_TAGS:
-            return "INVALID_NUMBER_OF_TAGS";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS:
-            return "INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_ATTRIBUTES:
-            return "INVALID_NUMBER_OF_ATTRIBUTES";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_USER_ATTRIBUTES:
-            return "INVALID_NUMBER_OF_USER_ATTRIBUTES";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_AGENT_IDS:
-            return "INVALID_NUMBER_OF_AGENT_IDS";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_AUTO_SCALING_GROUPS:
-            return "INVALID_NUMBER_OF_AUTO_SCALING_GROUPS";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_RULE_NAMES:
-            return "INVALID_NUMBER_OF_RULE_NAMES";
-          case InvalidInputErrorCode::INVALID_NUMBER_OF_SEVERITIES:
-            return "INVALID_NUMBER_OF_SEVERITIES";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInvalidInputErrorCode(InvalidInputErrorCode enumValue)
+        {
+          return GetNameForInvalidInputErrorCodeCStr(enumValue);
         }
 
       } // namespace InvalidInputErrorCodeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace LimitExceededErrorCodeMapper
       {
 
-        static const int ASSESSMENT_TARGET_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ASSESSMENT_TARGET_LIMIT_EXCEEDED");
-        static const int ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED");
-        static const int ASSESSMENT_RUN_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ASSESSMENT_RUN_LIMIT_EXCEEDED");
-        static const int RESOURCE_GROUP_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("RESOURCE_GROUP_LIMIT_EXCEEDED");
-        static const int EVENT_SUBSCRIPTION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("EVENT_SUBSCRIPTION_LIMIT_EXCEEDED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ASSESSMENT_TARGET_LIMIT_EXCEEDED",
+          "ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED",
+          "ASSESSMENT_RUN_LIMIT_EXCEEDED",
+          "RESOURCE_GROUP_LIMIT_EXCEEDED",
+          "EVENT_SUBSCRIPTION_LIMIT_EXCEEDED",
+        };
 
         LimitExceededErrorCode GetLimitExceededErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASSESSMENT_TARGET_LIMIT_EXCEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LimitExceededErrorCode::ASSESSMENT_TARGET_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED_HASH)
-          {
-            return LimitExceededErrorCode::ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == ASSESSMENT_RUN_LIMIT_EXCEEDED_HASH)
-          {
-            return LimitExceededErrorCode::ASSESSMENT_RUN_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == RESOURCE_GROUP_LIMIT_EXCEEDED_HASH)
-          {
-            return LimitExceededErrorCode::RESOURCE_GROUP_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == EVENT_SUBSCRIPTION_LIMIT_EXCEEDED_HASH)
-          {
-            return LimitExceededErrorCode::EVENT_SUBSCRIPTION_LIMIT_EXCEEDED;
+          case -1243563480:
+            if (name == "ASSESSMENT_TARGET_LIMIT_EXCEEDED")
+            {
+              return LimitExceededErrorCode::ASSESSMENT_TARGET_LIMIT_EXCEEDED;
+            }
+            break;
+          case 336924511:
+            if (name == "ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED")
+            {
+              return LimitExceededErrorCode::ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED;
+            }
+            break;
+          case 1852384360:
+            if (name == "ASSESSMENT_RUN_LIMIT_EXCEEDED")
+            {
+              return LimitExceededErrorCode::ASSESSMENT_RUN_LIMIT_EXCEEDED;
+            }
+            break;
+          case 1357693160:
+            if (name == "RESOURCE_GROUP_LIMIT_EXCEEDED")
+            {
+              return LimitExceededErrorCode::RESOURCE_GROUP_LIMIT_EXCEEDED;
+            }
+            break;
+          case 270592660:
+            if (name == "EVENT_SUBSCRIPTION_LIMIT_EXCEEDED")
+            {
+              return LimitExceededErrorCode::EVENT_SUBSCRIPTION_LIMIT_EXCEEDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return LimitExceededErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForLimitExceededErrorCode(LimitExceededErrorCode enumValue)
+        const char* GetNameForLimitExceededErrorCodeCStr(LimitExceededErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LimitExceededErrorCode::ASSESSMENT_TARGET_LIMIT_EXCEEDED:
-            return "ASSESSMENT_TARGET_LIMIT_EXCEEDED";
-          case LimitExceededErrorCode::ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED:
-            return "ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED";
-          case LimitExceededErrorCode::ASSESSMENT_RUN_LIMIT_EXCEEDED:
-            return "ASSESSMENT_RUN_LIMIT_EXCEEDED";
-          case LimitExceededErrorCode::RESOURCE_GROUP_LIMIT_EXCEEDED:
-            return "RESOURCE_GROUP_LIMIT_EXCEEDED";
-          case LimitExceededErrorCode::EVENT_SUBSCRIPTION_LIMIT_EXCEEDED:
-            return "EVENT_SUBSCRIPTION_LIMIT_EXCEEDED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLimitExceededErrorCode(LimitExceededErrorCode enumValue)
+        {
+          return GetNameForLimitExceededErrorCodeCStr(enumValue);
         }
 
       } // namespace LimitExceededErrorCodeMapper
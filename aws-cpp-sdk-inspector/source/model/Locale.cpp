@@ -30,15 +30,30 @@ namespace Aws
       namespace LocaleMapper
       {
 
-        static const int EN_US_HASH = HashingUtils::HashString("EN_US");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EN_US",
+        };
 
         Locale GetLocaleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EN_US_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Locale::EN_US;
+          case 66140660:
+            if (name == "EN_US")
+            {
+              return Locale::EN_US;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return Locale::NOT_SET;
         }
 
-        Aws::String GetNameForLocale(Locale enumValue)
+        const char* GetNameForLocaleCStr(Locale enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Locale::EN_US:
-            return "EN_US";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLocale(Locale enumValue)
+        {
+          return GetNameForLocaleCStr(enumValue);
         }
 
       } // namespace LocaleMapper
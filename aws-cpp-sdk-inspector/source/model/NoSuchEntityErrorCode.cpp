@@ -30,50 +30,79 @@ namespace Aws
       namespace NoSuchEntityErrorCodeMapper
       {
 
-        static const int ASSESSMENT_TARGET_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ASSESSMENT_TARGET_DOES_NOT_EXIST");
-        static const int ASSESSMENT_TEMPLATE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ASSESSMENT_TEMPLATE_DOES_NOT_EXIST");
-        static const int ASSESSMENT_RUN_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ASSESSMENT_RUN_DOES_NOT_EXIST");
-        static const int FINDING_DOES_NOT_EXIST_HASH = HashingUtils::HashString("FINDING_DOES_NOT_EXIST");
-        static const int RESOURCE_GROUP_DOES_NOT_EXIST_HASH = HashingUtils::HashString("RESOURCE_GROUP_DOES_NOT_EXIST");
-        static const int RULES_PACKAGE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("RULES_PACKAGE_DOES_NOT_EXIST");
-        static const int SNS_TOPIC_DOES_NOT_EXIST_HASH = HashingUtils::HashString("SNS_TOPIC_DOES_NOT_EXIST");
-        static const int IAM_ROLE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("IAM_ROLE_DOES_NOT_EXIST");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ASSESSMENT_TARGET_DOES_NOT_EXIST",
+          "ASSESSMENT_TEMPLATE_DOES_NOT_EXIST",
+          "ASSESSMENT_RUN_DOES_NOT_EXIST",
+          "FINDING_DOES_NOT_EXIST",
+          "RESOURCE_GROUP_DOES_NOT_EXIST",
+          "RULES_PACKAGE_DOES_NOT_EXIST",
+          "SNS_TOPIC_DOES_NOT_EXIST",
+          "IAM_ROLE_DOES_NOT_EXIST",
+        };
 
         NoSuchEntityErrorCode GetNoSuchEntityErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASSESSMENT_TARGET_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::ASSESSMENT_TARGET_DOES_NOT_EXIST;
-          }
-          else if (hashCode == ASSESSMENT_TEMPLATE_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::ASSESSMENT_TEMPLATE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == ASSESSMENT_RUN_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::ASSESSMENT_RUN_DOES_NOT_EXIST;
-          }
-          else if (hashCode == FINDING_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::FINDING_DOES_NOT_EXIST;
-          }
-          else if (hashCode == RESOURCE_GROUP_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::RESOURCE_GROUP_DOES_NOT_EXIST;
-          }
-          else if (hashCode == RULES_PACKAGE_DOES_NOT_EXIST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NoSuchEntityErrorCode::RULES_PACKAGE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == SNS_TOPIC_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::SNS_TOPIC_DOES_NOT_EXIST;
-          }
-          else if (hashCode == IAM_ROLE_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::IAM_ROLE_DOES_NOT_EXIST;
+          case -486138186:
+            if (name == "ASSESSMENT_TARGET_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::ASSESSMENT_TARGET_DOES_NOT_EXIST;
+            }
+            break;
+          case 1094349805:
+            if (name == "ASSESSMENT_TEMPLATE_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::ASSESSMENT_TEMPLATE_DOES_NOT_EXIST;
+            }
+            break;
+          case -1685157642:
+            if (name == "ASSESSMENT_RUN_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::ASSESSMENT_RUN_DOES_NOT_EXIST;
+            }
+            break;
+          case -191796325:
+            if (name == "FINDING_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::FINDING_DOES_NOT_EXIST;
+            }
+            break;
+          case 2115118454:
+            if (name == "RESOURCE_GROUP_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::RESOURCE_GROUP_DOES_NOT_EXIST;
+            }
+            break;
+          case -172937818:
+            if (name == "RULES_PACKAGE_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::RULES_PACKAGE_DOES_NOT_EXIST;
+            }
+            break;
+          case -1197433412:
+            if (name == "SNS_TOPIC_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::SNS_TOPIC_DOES_NOT_EXIST;
+            }
+            break;
+          case -2038318620:
+            if (name == "IAM_ROLE_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::IAM_ROLE_DOES_NOT_EXIST;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return NoSuchEntityErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForNoSuchEntityErrorCode(NoSuchEntityErrorCode enumValue)
+        const char* GetNameForNoSuchEntityErrorCodeCStr(NoSuchEntityErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NoSuchEntityErrorCode::ASSESSMENT_TARGET_DOES_NOT_EXIST:
-            return "ASSESSMENT_TARGET_DOES_NOT_EXIST";
-          case NoSuchEntityErrorCode::ASSESSMENT_TEMPLATE_DOES_NOT_EXIST:
-            return "ASSESSMENT_TEMPLATE_DOES_NOT_EXIST";
-          case NoSuchEntityErrorCode::ASSESSMENT_RUN_DOES_NOT_EXIST:
-            return "ASSESSMENT_RUN_DOES_NOT_EXIST";
-          case NoSuchEntityErrorCode::FINDING_DOES_NOT_EXIST:
-            return "FINDING_DOES_NOT_EXIST";
-          case NoSuchEntityErrorCode::RESOURCE_GROUP_DOES_NOT_EXIST:
-            return "RESOURCE_GROUP_DOES_NOT_EXIST";
-          case NoSuchEntityErrorCode::RULES_PACKAGE_DOES_NOT_EXIST:
-            return "RULES_PACKAGE_DOES_NOT_EXIST";
-          case NoSuchEntityErrorCode::SNS_TOPIC_DOES_NOT_EXIST:
-            return "SNS_TOPIC_DOES_NOT_EXIST";
-          case NoSuchEntityErrorCode::IAM_ROLE_DOES_NOT_EXIST:
-            return "IAM_ROLE_DOES_NOT_EXIST";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNoSuchEntityErrorCode(NoSuchEntityErrorCode enumValue)
+        {
+          return GetNameForNoSuchEntityErrorCodeCStr(enumValue);
         }
 
       } // namespace NoSuchEntityErrorCodeMapper
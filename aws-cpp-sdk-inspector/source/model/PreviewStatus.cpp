@@ -30,20 +30,37 @@ namespace Aws
       namespace PreviewStatusMapper
       {
 
-        static const int WORK_IN_PROGRESS_HASH = HashingUtils::HashString("WORK_IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WORK_IN_PROGRESS",
+          "COMPLETED",
+        };
 
         PreviewStatus GetPreviewStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WORK_IN_PROGRESS_HASH)
-          {
-            return PreviewStatus::WORK_IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PreviewStatus::COMPLETED;
+          case 1402560473:
+            if (name == "WORK_IN_PROGRESS")
+            {
+              return PreviewStatus::WORK_IN_PROGRESS;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return PreviewStatus::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PreviewStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPreviewStatus(PreviewStatus enumValue)
+        const char* GetNameForPreviewStatusCStr(PreviewStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PreviewStatus::WORK_IN_PROGRESS:
-            return "WORK_IN_PROGRESS";
-          case PreviewStatus::COMPLETED:
-            return "COMPLETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPreviewStatus(PreviewStatus enumValue)
+        {
+          return GetNameForPreviewStatusCStr(enumValue);
         }
 
       } // namespace PreviewStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ReportFileFormatMapper
       {
 
-        static const int HTML_HASH = HashingUtils::HashString("HTML");
-        static const int PDF_HASH = HashingUtils::HashString("PDF");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HTML",
+          "PDF",
+        };
 
         ReportFileFormat GetReportFileFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTML_HASH)
-          {
-            return ReportFileFormat::HTML;
-          }
-          else if (hashCode == PDF_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReportFileFormat::PDF;
+          case 2228139:
+            if (name == "HTML")
+            {
+              return ReportFileFormat::HTML;
+            }
+            break;
+          case 79058:
+            if (name == "PDF")
+            {
+              return ReportFileFormat::PDF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReportFileFormat::NOT_SET;
         }
 
-        Aws::String GetNameForReportFileFormat(ReportFileFormat enumValue)
+        const char* GetNameForReportFileFormatCStr(ReportFileFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReportFileFormat::HTML:
-            return "HTML";
-          case ReportFileFormat::PDF:
-            return "PDF";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReportFileFormat(ReportFileFormat enumValue)
+        {
+          return GetNameForReportFileFormatCStr(enumValue);
         }
 
       } // namespace ReportFileFormatMapper
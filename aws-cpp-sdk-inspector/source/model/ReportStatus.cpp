@@ -30,25 +30,44 @@ namespace Aws
       namespace ReportStatusMapper
       {
 
-        static const int WORK_IN_PROGRESS_HASH = HashingUtils::HashString("WORK_IN_PROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WORK_IN_PROGRESS",
+          "FAILED",
+          "COMPLETED",
+        };
 
         ReportStatus GetReportStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WORK_IN_PROGRESS_HASH)
-          {
-            return ReportStatus::WORK_IN_PROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReportStatus::FAILED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return ReportStatus::COMPLETED;
+          case 1402560473:
+            if (name == "WORK_IN_PROGRESS")
+            {
+              return ReportStatus::WORK_IN_PROGRESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ReportStatus::FAILED;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return ReportStatus::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ReportStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReportStatus(ReportStatus enumValue)
+        const char* GetNameForReportStatusCStr(ReportStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReportStatus::WORK_IN_PROGRESS:
-            return "WORK_IN_PROGRESS";
-          case ReportStatus::FAILED:
-            return "FAILED";
-          case ReportStatus::COMPLETED:
-            return "COMPLETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReportStatus(ReportStatus enumValue)
+        {
+          return GetNameForReportStatusCStr(enumValue);
         }
 
       } // namespace ReportStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ReportTypeMapper
       {
 
-        static const int FINDING_HASH = HashingUtils::HashString("FINDING");
-        static const int FULL_HASH = HashingUtils::HashString("FULL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FINDING",
+          "FULL",
+        };
 
         ReportType GetReportTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FINDING_HASH)
-          {
-            return ReportType::FINDING;
-          }
-          else if (hashCode == FULL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReportType::FULL;
+          case -135190679:
+            if (name == "FINDING")
+            {
+              return ReportType::FINDING;
+            }
+            break;
+          case 2169487:
+            if (name == "FULL")
+            {
+              return ReportType::FULL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReportType::NOT_SET;
         }
 
-        Aws::String GetNameForReportType(ReportType enumValue)
+        const char* GetNameForReportTypeCStr(ReportType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReportType::FINDING:
-            return "FINDING";
-          case ReportType::FULL:
-            return "FULL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReportType(ReportType enumValue)
+        {
+          return GetNameForReportTypeCStr(enumValue);
         }
 
       } // namespace ReportTypeMapper
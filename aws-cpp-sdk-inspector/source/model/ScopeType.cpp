@@ -30,20 +30,37 @@ namespace Aws
       namespace ScopeTypeMapper
       {
 
-        static const int INSTANCE_ID_HASH = HashingUtils::HashString("INSTANCE_ID");
-        static const int RULES_PACKAGE_ARN_HASH = HashingUtils::HashString("RULES_PACKAGE_ARN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INSTANCE_ID",
+          "RULES_PACKAGE_ARN",
+        };
 
         ScopeType GetScopeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSTANCE_ID_HASH)
-          {
-            return ScopeType::INSTANCE_ID;
-          }
-          else if (hashCode == RULES_PACKAGE_ARN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScopeType::RULES_PACKAGE_ARN;
+          case 50996485:
+            if (name == "INSTANCE_ID")
+            {
+              return ScopeType::INSTANCE_ID;
+            }
+            break;
+          case 801017660:
+            if (name == "RULES_PACKAGE_ARN")
+            {
+              return ScopeType::RULES_PACKAGE_ARN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ScopeType::NOT_SET;
         }
 
-        Aws::String GetNameForScopeType(ScopeType enumValue)
+        const char* GetNameForScopeTypeCStr(ScopeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScopeType::INSTANCE_ID:
-            return "INSTANCE_ID";
-          case ScopeType::RULES_PACKAGE_ARN:
-            return "RULES_PACKAGE_ARN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScopeType(ScopeType enumValue)
+        {
+          return GetNameForScopeTypeCStr(enumValue);
         }
 
       } // namespace ScopeTypeMapper
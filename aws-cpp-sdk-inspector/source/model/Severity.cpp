@@ -30,35 +30,58 @@ namespace Aws
       namespace SeverityMapper
       {
 
-        static const int Low_HASH = HashingUtils::HashString("Low");
-        static const int Medium_HASH = HashingUtils::HashString("Medium");
-        static const int High_HASH = HashingUtils::HashString("High");
-        static const int Informational_HASH = HashingUtils::HashString("Informational");
-        static const int Undefined_HASH = HashingUtils::HashString("Undefined");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Low",
+          "Medium",
+          "High",
+          "Informational",
+          "Undefined",
+        };
 
         Severity GetSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Low_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Severity::Low;
-          }
-          else if (hashCode == Medium_HASH)
-          {
-            return Severity::Medium;
-          }
-          else if (hashCode == High_HASH)
-          {
-            return Severity::High;
-          }
-          else if (hashCode == Informational_HASH)
-          {
-            return Severity::Informational;
-          }
-          else if (hashCode == Undefined_HASH)
-          {
-            return Severity::Undefined;
+          case 76596:
+            if (name == "Low")
+            {
+              return Severity::Low;
+            }
+            break;
+          case -1994163307:
+            if (name == "Medium")
+            {
+              return Severity::Medium;
+            }
+            break;
+          case 2249154:
+            if (name == "High")
+            {
+              return Severity::High;
+            }
+            break;
+          case -1456662985:
+            if (name == "Informational")
+            {
+              return Severity::Informational;
+            }
+            break;
+          case 965837104:
+            if (name == "Undefined")
+            {
+              return Severity::Undefined;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return Severity::NOT_SET;
         }
 
-        Aws::String GetNameForSeverity(Severity enumValue)
+        const char* GetNameForSeverityCStr(Severity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Severity::Low:
-            return "Low";
-          case Severity::Medium:
-            return "Medium";
-          case Severity::High:
-            return "High";
-          case Severity::Informational:
-            return "Informational";
-          case Severity::Undefined:
-            return "Undefined";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSeverity(Severity enumValue)
+        {
+          return GetNameForSeverityCStr(enumValue);
         }
 
       } // namespace SeverityMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace StopActionMapper
       {
 
-        static const int START_EVALUATION_HASH = HashingUtils::HashString("START_EVALUATION");
-        static const int SKIP_EVALUATION_HASH = HashingUtils::HashString("SKIP_EVALUATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "START_EVALUATION",
+          "SKIP_EVALUATION",
+        };
 
         StopAction GetStopActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == START_EVALUATION_HASH)
-          {
-            return StopAction::START_EVALUATION;
-          }
-          else if (hashCode == SKIP_EVALUATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StopAction::SKIP_EVALUATION;
+          case 1959829337:
+            if (name == "START_EVALUATION")
+            {
+              return StopAction::START_EVALUATION;
+            }
+            break;
+          case 1240618492:
+            if (name == "SKIP_EVALUATION")
+            {
+              return StopAction::SKIP_EVALUATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return StopAction::NOT_SET;
         }
 
-        Aws::String GetNameForStopAction(StopAction enumValue)
+        const char* GetNameForStopActionCStr(StopAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StopAction::START_EVALUATION:
-            return "START_EVALUATION";
-          case StopAction::SKIP_EVALUATION:
-            return "SKIP_EVALUATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStopAction(StopAction enumValue)
+        {
+          return GetNameForStopActionCStr(enumValue);
         }
 
       } // namespace StopActionMapper
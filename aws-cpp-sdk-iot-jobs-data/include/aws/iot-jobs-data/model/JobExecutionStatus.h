@@ -41,6 +41,11 @@ namespace JobExecutionStatusMapper
 AWS_IOTJOBSDATAPLANE_API JobExecutionStatus GetJobExecutionStatusForName(const Aws::String& name);
 
 AWS_IOTJOBSDATAPLANE_API Aws::String GetNameForJobExecutionStatus(JobExecutionStatus value);
+
+/**
+ * Same as GetNameForJobExecutionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOTJOBSDATAPLANE_API const char* GetNameForJobExecutionStatusCStr(JobExecutionStatus value);
 } // namespace JobExecutionStatusMapper
 } // namespace Model
 } // namespace IoTJobsDataPlane
@@ -34,6 +34,11 @@ namespace AbortActionMapper
 AWS_IOT_API AbortAction GetAbortActionForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForAbortAction(AbortAction value);
+
+/**
+ * Same as GetNameForAbortAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForAbortActionCStr(AbortAction value);
 } // namespace AbortActionMapper
 } // namespace Model
 } // namespace IoT
@@ -37,6 +37,11 @@ namespace ActionTypeMapper
 AWS_IOT_API ActionType GetActionTypeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForActionType(ActionType value);
+
+/**
+ * Same as GetNameForActionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForActionTypeCStr(ActionType value);
 } // namespace ActionTypeMapper
 } // namespace Model
 } // namespace IoT
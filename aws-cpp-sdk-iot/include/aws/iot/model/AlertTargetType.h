@@ -34,6 +34,11 @@ namespace AlertTargetTypeMapper
 AWS_IOT_API AlertTargetType GetAlertTargetTypeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForAlertTargetType(AlertTargetType value);
+
+/**
+ * Same as GetNameForAlertTargetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForAlertTargetTypeCStr(AlertTargetType value);
 } // namespace AlertTargetTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -39,6 +39,11 @@ namespace AuditCheckRunStatusMapper
 AWS_IOT_API AuditCheckRunStatus GetAuditCheckRunStatusForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForAuditCheckRunStatus(AuditCheckRunStatus value);
+
+/**
+ * Same as GetNameForAuditCheckRunStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForAuditCheckRunStatusCStr(AuditCheckRunStatus value);
 } // namespace AuditCheckRunStatusMapper
 } // namespace Model
 } // namespace IoT
@@ -37,6 +37,11 @@ namespace AuditFindingSeverityMapper
 AWS_IOT_API AuditFindingSeverity GetAuditFindingSeverityForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForAuditFindingSeverity(AuditFindingSeverity value);
+
+/**
+ * Same as GetNameForAuditFindingSeverity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForAuditFindingSeverityCStr(AuditFindingSeverity value);
 } // namespace AuditFindingSeverityMapper
 } // namespace Model
 } // namespace IoT
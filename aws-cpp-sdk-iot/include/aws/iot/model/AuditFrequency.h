@@ -37,6 +37,11 @@ namespace AuditFrequencyMapper
 AWS_IOT_API AuditFrequency GetAuditFrequencyForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForAuditFrequency(AuditFrequency value);
+
+/**
+ * Same as GetNameForAuditFrequency(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForAuditFrequencyCStr(AuditFrequency value);
 } // namespace AuditFrequencyMapper
 } // namespace Model
 } // namespace IoT
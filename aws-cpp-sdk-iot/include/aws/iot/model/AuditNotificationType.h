@@ -34,6 +34,11 @@ namespace AuditNotificationTypeMapper
 AWS_IOT_API AuditNotificationType GetAuditNotificationTypeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForAuditNotificationType(AuditNotificationType value);
+
+/**
+ * Same as GetNameForAuditNotificationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForAuditNotificationTypeCStr(AuditNotificationType value);
 } // namespace AuditNotificationTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -37,6 +37,11 @@ namespace AuditTaskStatusMapper
 AWS_IOT_API AuditTaskStatus GetAuditTaskStatusForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForAuditTaskStatus(AuditTaskStatus value);
+
+/**
+ * Same as GetNameForAuditTaskStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForAuditTaskStatusCStr(AuditTaskStatus value);
 } // namespace AuditTaskStatusMapper
 } // namespace Model
 } // namespace IoT
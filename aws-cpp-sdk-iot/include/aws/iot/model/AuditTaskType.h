@@ -35,6 +35,11 @@ namespace AuditTaskTypeMapper
 AWS_IOT_API AuditTaskType GetAuditTaskTypeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForAuditTaskType(AuditTaskType value);
+
+/**
+ * Same as GetNameForAuditTaskType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForAuditTaskTypeCStr(AuditTaskType value);
 } // namespace AuditTaskTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -36,6 +36,11 @@ namespace AuthDecisionMapper
 AWS_IOT_API AuthDecision GetAuthDecisionForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForAuthDecision(AuthDecision value);
+
+/**
+ * Same as GetNameForAuthDecision(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForAuthDecisionCStr(AuthDecision value);
 } // namespace AuthDecisionMapper
 } // namespace Model
 } // namespace IoT
@@ -35,6 +35,11 @@ namespace AuthorizerStatusMapper
 AWS_IOT_API AuthorizerStatus GetAuthorizerStatusForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForAuthorizerStatus(AuthorizerStatus value);
+
+/**
+ * Same as GetNameForAuthorizerStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForAuthorizerStatusCStr(AuthorizerStatus value);
 } // namespace AuthorizerStatusMapper
 } // namespace Model
 } // namespace IoT
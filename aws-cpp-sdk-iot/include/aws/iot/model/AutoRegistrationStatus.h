@@ -35,6 +35,11 @@ namespace AutoRegistrationStatusMapper
 AWS_IOT_API AutoRegistrationStatus GetAutoRegistrationStatusForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForAutoRegistrationStatus(AutoRegistrationStatus value);
+
+/**
+ * Same as GetNameForAutoRegistrationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForAutoRegistrationStatusCStr(AutoRegistrationStatus value);
 } // namespace AutoRegistrationStatusMapper
 } // namespace Model
 } // namespace IoT
@@ -35,6 +35,11 @@ namespace CACertificateStatusMapper
 AWS_IOT_API CACertificateStatus GetCACertificateStatusForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForCACertificateStatus(CACertificateStatus value);
+
+/**
+ * Same as GetNameForCACertificateStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForCACertificateStatusCStr(CACertificateStatus value);
 } // namespace CACertificateStatusMapper
 } // namespace Model
 } // namespace IoT
@@ -41,6 +41,11 @@ namespace CannedAccessControlListMapper
 AWS_IOT_API CannedAccessControlList GetCannedAccessControlListForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForCannedAccessControlList(CannedAccessControlList value);
+
+/**
+ * Same as GetNameForCannedAccessControlList(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForCannedAccessControlListCStr(CannedAccessControlList value);
 } // namespace CannedAccessControlListMapper
 } // namespace Model
 } // namespace IoT
@@ -39,6 +39,11 @@ namespace CertificateStatusMapper
 AWS_IOT_API CertificateStatus GetCertificateStatusForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForCertificateStatus(CertificateStatus value);
+
+/**
+ * Same as GetNameForCertificateStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForCertificateStatusCStr(CertificateStatus value);
 } // namespace CertificateStatusMapper
 } // namespace Model
 } // namespace IoT
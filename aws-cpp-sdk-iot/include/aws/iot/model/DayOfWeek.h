@@ -40,6 +40,11 @@ namespace DayOfWeekMapper
 AWS_IOT_API DayOfWeek GetDayOfWeekForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForDayOfWeek(DayOfWeek value);
+
+/**
+ * Same as GetNameForDayOfWeek(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForDayOfWeekCStr(DayOfWeek value);
 } // namespace DayOfWeekMapper
 } // namespace Model
 } // namespace IoT
@@ -36,6 +36,11 @@ namespace DynamicGroupStatusMapper
 AWS_IOT_API DynamicGroupStatus GetDynamicGroupStatusForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForDynamicGroupStatus(DynamicGroupStatus value);
+
+/**
+ * Same as GetNameForDynamicGroupStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForDynamicGroupStatusCStr(DynamicGroupStatus value);
 } // namespace DynamicGroupStatusMapper
 } // namespace Model
 } // namespace IoT
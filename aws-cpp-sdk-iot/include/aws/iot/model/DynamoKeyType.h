@@ -35,6 +35,11 @@ namespace DynamoKeyTypeMapper
 AWS_IOT_API DynamoKeyType GetDynamoKeyTypeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForDynamoKeyType(DynamoKeyType value);
+
+/**
+ * Same as GetNameForDynamoKeyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForDynamoKeyTypeCStr(DynamoKeyType value);
 } // namespace DynamoKeyTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -37,6 +37,11 @@ namespace JobExecutionFailureTypeMapper
 AWS_IOT_API JobExecutionFailureType GetJobExecutionFailureTypeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForJobExecutionFailureType(JobExecutionFailureType value);
+
+/**
+ * Same as GetNameForJobExecutionFailureType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForJobExecutionFailureTypeCStr(JobExecutionFailureType value);
 } // namespace JobExecutionFailureTypeMapper
 } // namespace Model
 } // namespace IoT
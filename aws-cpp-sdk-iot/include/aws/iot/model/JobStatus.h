@@ -37,6 +37,11 @@ namespace JobStatusMapper
 AWS_IOT_API JobStatus GetJobStatusForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForJobStatus(JobStatus value);
+
+/**
+ * Same as GetNameForJobStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForJobStatusCStr(JobStatus value);
 } // namespace JobStatusMapper
 } // namespace Model
 } // namespace IoT
@@ -38,6 +38,11 @@ namespace LogLevelMapper
 AWS_IOT_API LogLevel GetLogLevelForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForLogLevel(LogLevel value);
+
+/**
+ * Same as GetNameForLogLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForLogLevelCStr(LogLevel value);
 } // namespace LogLevelMapper
 } // namespace Model
 } // namespace IoT
@@ -35,6 +35,11 @@ namespace LogTargetTypeMapper
 AWS_IOT_API LogTargetType GetLogTargetTypeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForLogTargetType(LogTargetType value);
+
+/**
+ * Same as GetNameForLogTargetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForLogTargetTypeCStr(LogTargetType value);
 } // namespace LogTargetTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -35,6 +35,11 @@ namespace MessageFormatMapper
 AWS_IOT_API MessageFormat GetMessageFormatForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForMessageFormat(MessageFormat value);
+
+/**
+ * Same as GetNameForMessageFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForMessageFormatCStr(MessageFormat value);
 } // namespace MessageFormatMapper
 } // namespace Model
 } // namespace IoT
@@ -37,6 +37,11 @@ namespace OTAUpdateStatusMapper
 AWS_IOT_API OTAUpdateStatus GetOTAUpdateStatusForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForOTAUpdateStatus(OTAUpdateStatus value);
+
+/**
+ * Same as GetNameForOTAUpdateStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForOTAUpdateStatusCStr(OTAUpdateStatus value);
 } // namespace OTAUpdateStatusMapper
 } // namespace Model
 } // namespace IoT
@@ -35,6 +35,11 @@ namespace ReportTypeMapper
 AWS_IOT_API ReportType GetReportTypeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForReportType(ReportType value);
+
+/**
+ * Same as GetNameForReportType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForReportTypeCStr(ReportType value);
 } // namespace ReportTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -35,6 +35,11 @@ namespace TargetSelectionMapper
 AWS_IOT_API TargetSelection GetTargetSelectionForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForTargetSelection(TargetSelection value);
+
+/**
+ * Same as GetNameForTargetSelection(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForTargetSelectionCStr(TargetSelection value);
 } // namespace TargetSelectionMapper
 } // namespace Model
 } // namespace IoT
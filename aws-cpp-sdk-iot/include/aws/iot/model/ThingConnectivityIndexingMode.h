@@ -35,6 +35,11 @@ namespace ThingConnectivityIndexingModeMapper
 AWS_IOT_API ThingConnectivityIndexingMode GetThingConnectivityIndexingModeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForThingConnectivityIndexingMode(ThingConnectivityIndexingMode value);
+
+/**
+ * Same as GetNameForThingConnectivityIndexingMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForThingConnectivityIndexingModeCStr(ThingConnectivityIndexingMode value);
 } // namespace ThingConnectivityIndexingModeMapper
 } // namespace Model
 } // namespace IoT
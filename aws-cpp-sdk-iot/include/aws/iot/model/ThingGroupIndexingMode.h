@@ -35,6 +35,11 @@ namespace ThingGroupIndexingModeMapper
 AWS_IOT_API ThingGroupIndexingMode GetThingGroupIndexingModeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForThingGroupIndexingMode(ThingGroupIndexingMode value);
+
+/**
+ * Same as GetNameForThingGroupIndexingMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForThingGroupIndexingModeCStr(ThingGroupIndexingMode value);
 } // namespace ThingGroupIndexingModeMapper
 } // namespace Model
 } // namespace IoT
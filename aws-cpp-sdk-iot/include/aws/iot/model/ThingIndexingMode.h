@@ -36,6 +36,11 @@ namespace ThingIndexingModeMapper
 AWS_IOT_API ThingIndexingMode GetThingIndexingModeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForThingIndexingMode(ThingIndexingMode value);
+
+/**
+ * Same as GetNameForThingIndexingMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForThingIndexingModeCStr(ThingIndexingMode value);
 } // namespace ThingIndexingModeMapper
 } // namespace Model
 } // namespace IoT
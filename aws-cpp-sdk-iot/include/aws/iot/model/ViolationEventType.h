@@ -36,6 +36,11 @@ namespace ViolationEventTypeMapper
 AWS_IOT_API ViolationEventType GetViolationEventTypeForName(const Aws::String& name);
 
 AWS_IOT_API Aws::String GetNameForViolationEventType(ViolationEventType value);
+
+/**
+ * Same as GetNameForViolationEventType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOT_API const char* GetNameForViolationEventTypeCStr(ViolationEventType value);
 } // namespace ViolationEventTypeMapper
 } // namespace Model
 } // namespace IoT
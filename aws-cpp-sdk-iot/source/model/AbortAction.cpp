@@ -30,15 +30,30 @@ namespace Aws
       namespace AbortActionMapper
       {
 
-        static const int CANCEL_HASH = HashingUtils::HashString("CANCEL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CANCEL",
+        };
 
         AbortAction GetAbortActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CANCEL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AbortAction::CANCEL;
+          case 1980572282:
+            if (name == "CANCEL")
+            {
+              return AbortAction::CANCEL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return AbortAction::NOT_SET;
         }
 
-        Aws::String GetNameForAbortAction(AbortAction enumValue)
+        const char* GetNameForAbortActionCStr(AbortAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AbortAction::CANCEL:
-            return "CANCEL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAbortAction(AbortAction enumValue)
+        {
+          return GetNameForAbortActionCStr(enumValue);
         }
 
       } // namespace AbortActionMapper
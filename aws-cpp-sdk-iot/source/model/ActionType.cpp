@@ -30,30 +30,51 @@ namespace Aws
       namespace ActionTypeMapper
       {
 
-        static const int PUBLISH_HASH = HashingUtils::HashString("PUBLISH");
-        static const int SUBSCRIBE_HASH = HashingUtils::HashString("SUBSCRIBE");
-        static const int RECEIVE_HASH = HashingUtils::HashString("RECEIVE");
-        static const int CONNECT_HASH = HashingUtils::HashString("CONNECT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PUBLISH",
+          "SUBSCRIBE",
+          "RECEIVE",
+          "CONNECT",
+        };
 
         ActionType GetActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PUBLISH_HASH)
-          {
-            return ActionType::PUBLISH;
-          }
-          else if (hashCode == SUBSCRIBE_HASH)
-          {
-            return ActionType::SUBSCRIBE;
-          }
-          else if (hashCode == RECEIVE_HASH)
-          {
-            return ActionType::RECEIVE;
-          }
-          else if (hashCode == CONNECT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionType::CONNECT;
+          case 482617583:
+            if (name == "PUBLISH")
+            {
+              return ActionType::PUBLISH;
+            }
+            break;
+          case -993530582:
+            if (name == "SUBSCRIBE")
+            {
+              return ActionType::SUBSCRIBE;
+            }
+            break;
+          case 1800273603:
+            if (name == "RECEIVE")
+            {
+              return ActionType::RECEIVE;
+            }
+            break;
+          case 1669334218:
+            if (name == "CONNECT")
+            {
+              return ActionType::CONNECT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ActionType::NOT_SET;
         }
 
-        Aws::String GetNameForActionType(ActionType enumValue)
+        const char* GetNameForActionTypeCStr(ActionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionType::PUBLISH:
-            return "PUBLISH";
-          case ActionType::SUBSCRIBE:
-            return "SUBSCRIBE";
-          case ActionType::RECEIVE:
-            return "RECEIVE";
-          case ActionType::CONNECT:
-            return "CONNECT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionType(ActionType enumValue)
+        {
+          return GetNameForActionTypeCStr(enumValue);
         }
 
       } // namespace ActionTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace AlertTargetTypeMapper
       {
 
-        static const int SNS_HASH = HashingUtils::HashString("SNS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SNS",
+        };
 
         AlertTargetType GetAlertTargetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SNS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AlertTargetType::SNS;
+          case 82264:
+            if (name == "SNS")
+            {
+              return AlertTargetType::SNS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return AlertTargetType::NOT_SET;
         }
 
-        Aws::String GetNameForAlertTargetType(AlertTargetType enumValue)
+        const char* GetNameForAlertTargetTypeCStr(AlertTargetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AlertTargetType::SNS:
-            return "SNS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAlertTargetType(AlertTargetType enumValue)
+        {
+          return GetNameForAlertTargetTypeCStr(enumValue);
         }
 
       } // namespace AlertTargetTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace AuditCheckRunStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int WAITING_FOR_DATA_COLLECTION_HASH = HashingUtils::HashString("WAITING_FOR_DATA_COLLECTION");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int COMPLETED_COMPLIANT_HASH = HashingUtils::HashString("COMPLETED_COMPLIANT");
-        static const int COMPLETED_NON_COMPLIANT_HASH = HashingUtils::HashString("COMPLETED_NON_COMPLIANT");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "WAITING_FOR_DATA_COLLECTION",
+          "CANCELED",
+          "COMPLETED_COMPLIANT",
+          "COMPLETED_NON_COMPLIANT",
+          "FAILED",
+        };
 
         AuditCheckRunStatus GetAuditCheckRunStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return AuditCheckRunStatus::IN_PROGRESS;
-          }
-          else if (hashCode == WAITING_FOR_DATA_COLLECTION_HASH)
-          {
-            return AuditCheckRunStatus::WAITING_FOR_DATA_COLLECTION;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return AuditCheckRunStatus::CANCELED;
-          }
-          else if (hashCode == COMPLETED_COMPLIANT_HASH)
-          {
-            return AuditCheckRunStatus::COMPLETED_COMPLIANT;
-          }
-          else if (hashCode == COMPLETED_NON_COMPLIANT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuditCheckRunStatus::COMPLETED_NON_COMPLIANT;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AuditCheckRunStatus::FAILED;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return AuditCheckRunStatus::IN_PROGRESS;
+            }
+            break;
+          case -1019787861:
+            if (name == "WAITING_FOR_DATA_COLLECTION")
+            {
+              return AuditCheckRunStatus::WAITING_FOR_DATA_COLLECTION;
+            }
+            break;
+          case 659453081:
+            if (name == "CANCELED")
+            {
+              return AuditCheckRunStatus::CANCELED;
+            }
+            break;
+          case -1483794329:
+            if (name == "COMPLETED_COMPLIANT")
+            {
+              return AuditCheckRunStatus::COMPLETED_COMPLIANT;
+            }
+            break;
+          case 2072459093:
+            if (name == "COMPLETED_NON_COMPLIANT")
+            {
+              return AuditCheckRunStatus::COMPLETED_NON_COMPLIANT;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return AuditCheckRunStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return AuditCheckRunStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAuditCheckRunStatus(AuditCheckRunStatus enumValue)
+        const char* GetNameForAuditCheckRunStatusCStr(AuditCheckRunStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuditCheckRunStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case AuditCheckRunStatus::WAITING_FOR_DATA_COLLECTION:
-            return "WAITING_FOR_DATA_COLLECTION";
-          case AuditCheckRunStatus::CANCELED:
-            return "CANCELED";
-          case AuditCheckRunStatus::COMPLETED_COMPLIANT:
-            return "COMPLETED_COMPLIANT";
-          case AuditCheckRunStatus::COMPLETED_NON_COMPLIANT:
-            return "COMPLETED_NON_COMPLIANT";
-          case AuditCheckRunStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuditCheckRunStatus(AuditCheckRunStatus enumValue)
+        {
+          return GetNameForAuditCheckRunStatusCStr(enumValue);
         }
 
       } // namespace AuditCheckRunStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace AuditFindingSeverityMapper
       {
 
-        static const int CRITICAL_HASH = HashingUtils::HashString("CRITICAL");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CRITICAL",
+          "HIGH",
+          "MEDIUM",
+          "LOW",
+        };
 
         AuditFindingSeverity GetAuditFindingSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CRITICAL_HASH)
-          {
-            return AuditFindingSeverity::CRITICAL;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return AuditFindingSeverity::HIGH;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return AuditFindingSeverity::MEDIUM;
-          }
-          else if (hashCode == LOW_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuditFindingSeverity::LOW;
+          case -1560189025:
+            if (name == "CRITICAL")
+            {
+              return AuditFindingSeverity::CRITICAL;
+            }
+            break;
+          case 2217378:
+            if (name == "HIGH")
+            {
+              return AuditFindingSeverity::HIGH;
+            }
+            break;
+          case -2024701067:
+            if (name == "MEDIUM")
+            {
+              return AuditFindingSeverity::MEDIUM;
+            }
+            break;
+          case 75572:
+            if (name == "LOW")
+            {
+              return AuditFindingSeverity::LOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AuditFindingSeverity::NOT_SET;
         }
 
-        Aws::String GetNameForAuditFindingSeverity(AuditFindingSeverity enumValue)
+        const char* GetNameForAuditFindingSeverityCStr(AuditFindingSeverity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuditFindingSeverity::CRITICAL:
-            return "CRITICAL";
-          case AuditFindingSeverity::HIGH:
-            return "HIGH";
-          case AuditFindingSeverity::MEDIUM:
-            return "MEDIUM";
-          case AuditFindingSeverity::LOW:
-            return "LOW";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuditFindingSeverity(AuditFindingSeverity enumValue)
+        {
+          return GetNameForAuditFindingSeverityCStr(enumValue);
         }
 
       } // namespace AuditFindingSeverityMapper
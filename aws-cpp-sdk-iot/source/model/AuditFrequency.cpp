@@ -30,30 +30,51 @@ namespace Aws
       namespace AuditFrequencyMapper
       {
 
-        static const int DAILY_HASH = HashingUtils::HashString("DAILY");
-        static const int WEEKLY_HASH = HashingUtils::HashString("WEEKLY");
-        static const int BIWEEKLY_HASH = HashingUtils::HashString("BIWEEKLY");
-        static const int MONTHLY_HASH = HashingUtils::HashString("MONTHLY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DAILY",
+          "WEEKLY",
+          "BIWEEKLY",
+          "MONTHLY",
+        };
 
         AuditFrequency GetAuditFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DAILY_HASH)
-          {
-            return AuditFrequency::DAILY;
-          }
-          else if (hashCode == WEEKLY_HASH)
-          {
-            return AuditFrequency::WEEKLY;
-          }
-          else if (hashCode == BIWEEKLY_HASH)
-          {
-            return AuditFrequency::BIWEEKLY;
-          }
-          else if (hashCode == MONTHLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuditFrequency::MONTHLY;
+          case 64808441:
+            if (name == "DAILY")
+            {
+              return AuditFrequency::DAILY;
+            }
+            break;
+          case -1738378111:
+            if (name == "WEEKLY")
+            {
+              return AuditFrequency::WEEKLY;
+            }
+            break;
+          case 1981213576:
+            if (name == "BIWEEKLY")
+            {
+              return AuditFrequency::BIWEEKLY;
+            }
+            break;
+          case 1954618349:
+            if (name == "MONTHLY")
+            {
+              return AuditFrequency::MONTHLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AuditFrequency::NOT_SET;
         }
 
-        Aws::String GetNameForAuditFrequency(AuditFrequency enumValue)
+        const char* GetNameForAuditFrequencyCStr(AuditFrequency enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuditFrequency::DAILY:
-            return "DAILY";
-          case AuditFrequency::WEEKLY:
-            return "WEEKLY";
-          case AuditFrequency::BIWEEKLY:
-            return "BIWEEKLY";
-          case AuditFrequency::MONTHLY:
-            return "MONTHLY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuditFrequency(AuditFrequency enumValue)
+        {
+          return GetNameForAuditFrequencyCStr(enumValue);
         }
 
       } // namespace AuditFrequencyMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace AuditTaskStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "COMPLETED",
+          "FAILED",
+          "CANCELED",
+        };
 
         AuditTaskStatus GetAuditTaskStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return AuditTaskStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return AuditTaskStatus::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AuditTaskStatus::FAILED;
-          }
-          else if (hashCode == CANCELED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuditTaskStatus::CANCELED;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return AuditTaskStatus::IN_PROGRESS;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return AuditTaskStatus::COMPLETED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return AuditTaskStatus::FAILED;
+            }
+            break;
+          case 659453081:
+            if (name == "CANCELED")
+            {
+              return AuditTaskStatus::CANCELED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AuditTaskStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAuditTaskStatus(AuditTaskStatus enumValue)
+        const char* GetNameForAuditTaskStatusCStr(AuditTaskStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuditTaskStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case AuditTaskStatus::COMPLETED:
-            return "COMPLETED";
-          case AuditTaskStatus::FAILED:
-            return "FAILED";
-          case AuditTaskStatus::CANCELED:
-            return "CANCELED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuditTaskStatus(AuditTaskStatus enumValue)
+        {
+          return GetNameForAuditTaskStatusCStr(enumValue);
         }
 
       } // namespace AuditTaskStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace AuditTaskTypeMapper
       {
 
-        static const int ON_DEMAND_AUDIT_TASK_HASH = HashingUtils::HashString("ON_DEMAND_AUDIT_TASK");
-        static const int SCHEDULED_AUDIT_TASK_HASH = HashingUtils::HashString("SCHEDULED_AUDIT_TASK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ON_DEMAND_AUDIT_TASK",
+          "SCHEDULED_AUDIT_TASK",
+        };
 
         AuditTaskType GetAuditTaskTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ON_DEMAND_AUDIT_TASK_HASH)
-          {
-            return AuditTaskType::ON_DEMAND_AUDIT_TASK;
-          }
-          else if (hashCode == SCHEDULED_AUDIT_TASK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuditTaskType::SCHEDULED_AUDIT_TASK;
+          case 742744989:
+            if (name == "ON_DEMAND_AUDIT_TASK")
+            {
+              return AuditTaskType::ON_DEMAND_AUDIT_TASK;
+            }
+            break;
+          case -616629637:
+            if (name == "SCHEDULED_AUDIT_TASK")
+            {
+              return AuditTaskType::SCHEDULED_AUDIT_TASK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AuditTaskType::NOT_SET;
         }
 
-        Aws::String GetNameForAuditTaskType(AuditTaskType enumValue)
+        const char* GetNameForAuditTaskTypeCStr(AuditTaskType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuditTaskType::ON_DEMAND_AUDIT_TASK:
-            return "ON_DEMAND_AUDIT_TASK";
-          case AuditTaskType::SCHEDULED_AUDIT_TASK:
-            return "SCHEDULED_AUDIT_TASK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuditTaskType(AuditTaskType enumValue)
+        {
+          return GetNameForAuditTaskTypeCStr(enumValue);
         }
 
       } // namespace AuditTaskTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AuthDecisionMapper
       {
 
-        static const int ALLOWED_HASH = HashingUtils::HashString("ALLOWED");
-        static const int EXPLICIT_DENY_HASH = HashingUtils::HashString("EXPLICIT_DENY");
-        static const int IMPLICIT_DENY_HASH = HashingUtils::HashString("IMPLICIT_DENY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALLOWED",
+          "EXPLICIT_DENY",
+          "IMPLICIT_DENY",
+        };
 
         AuthDecision GetAuthDecisionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALLOWED_HASH)
-          {
-            return AuthDecision::ALLOWED;
-          }
-          else if (hashCode == EXPLICIT_DENY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthDecision::EXPLICIT_DENY;
-          }
-          else if (hashCode == IMPLICIT_DENY_HASH)
-          {
-            return AuthDecision::IMPLICIT_DENY;
+          case -193360504:
+            if (name == "ALLOWED")
+            {
+              return AuthDecision::ALLOWED;
+            }
+            break;
+          case 494016823:
+            if (name == "EXPLICIT_DENY")
+            {
+              return AuthDecision::EXPLICIT_DENY;
+            }
+            break;
+          case -2099505114:
+            if (name == "IMPLICIT_DENY")
+            {
+              return AuthDecision::IMPLICIT_DENY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AuthDecision::NOT_SET;
         }
 
-        Aws::String GetNameForAuthDecision(AuthDecision enumValue)
+        const char* GetNameForAuthDecisionCStr(AuthDecision enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthDecision::ALLOWED:
-            return "ALLOWED";
-          case AuthDecision::EXPLICIT_DENY:
-            return "EXPLICIT_DENY";
-          case AuthDecision::IMPLICIT_DENY:
-            return "IMPLICIT_DENY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthDecision(AuthDecision enumValue)
+        {
+          return GetNameForAuthDecisionCStr(enumValue);
         }
 
       } // namespace AuthDecisionMapper
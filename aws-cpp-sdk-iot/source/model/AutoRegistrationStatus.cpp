@@ -30,20 +30,37 @@ namespace Aws
       namespace AutoRegistrationStatusMapper
       {
 
-        static const int ENABLE_HASH = HashingUtils::HashString("ENABLE");
-        static const int DISABLE_HASH = HashingUtils::HashString("DISABLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLE",
+          "DISABLE",
+        };
 
         AutoRegistrationStatus GetAutoRegistrationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLE_HASH)
-          {
-            return AutoRegistrationStatus::ENABLE;
-          }
-          else if (hashCode == DISABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AutoRegistrationStatus::DISABLE;
+          case 2049448323:
+            if (name == "ENABLE")
+            {
+              return AutoRegistrationStatus::ENABLE;
+            }
+            break;
+          case -1905676600:
+            if (name == "DISABLE")
+            {
+              return AutoRegistrationStatus::DISABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AutoRegistrationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAutoRegistrationStatus(AutoRegistrationStatus enumValue)
+        const char* GetNameForAutoRegistrationStatusCStr(AutoRegistrationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AutoRegistrationStatus::ENABLE:
-            return "ENABLE";
-          case AutoRegistrationStatus::DISABLE:
-            return "DISABLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAutoRegistrationStatus(AutoRegistrationStatus enumValue)
+        {
+          return GetNameForAutoRegistrationStatusCStr(enumValue);
         }
 
       } // namespace AutoRegistrationStatusMapper
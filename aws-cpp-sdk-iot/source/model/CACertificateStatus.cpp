@@ -30,20 +30,37 @@ namespace Aws
       namespace CACertificateStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "INACTIVE",
+        };
 
         CACertificateStatus GetCACertificateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return CACertificateStatus::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CACertificateStatus::INACTIVE;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return CACertificateStatus::ACTIVE;
+            }
+            break;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return CACertificateStatus::INACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CACertificateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCACertificateStatus(CACertificateStatus enumValue)
+        const char* GetNameForCACertificateStatusCStr(CACertificateStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CACertificateStatus::ACTIVE:
-            return "ACTIVE";
-          case CACertificateStatus::INACTIVE:
-            return "INACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCACertificateStatus(CACertificateStatus enumValue)
+        {
+          return GetNameForCACertificateStatusCStr(enumValue);
         }
 
       } // namespace CACertificateStatusMapper
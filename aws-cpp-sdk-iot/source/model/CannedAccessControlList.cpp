@@ -30,50 +30,79 @@ namespace Aws
       namespace CannedAccessControlListMapper
       {
 
-        static const int private__HASH = HashingUtils::HashString("private");
-        static const int public_read_HASH = HashingUtils::HashString("public-read");
-        static const int public_read_write_HASH = HashingUtils::HashString("public-read-write");
-        static const int aws_exec_read_HASH = HashingUtils::HashString("aws-exec-read");
-        static const int authenticated_read_HASH = HashingUtils::HashString("authenticated-read");
-        static const int bucket_owner_read_HASH = HashingUtils::HashString("bucket-owner-read");
-        static const int bucket_owner_full_control_HASH = HashingUtils::HashString("bucket-owner-full-control");
-        static const int log_delivery_write_HASH = HashingUtils::HashString("log-delivery-write");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "private",
+          "public-read",
+          "public-read-write",
+          "aws-exec-read",
+          "authenticated-read",
+          "bucket-owner-read",
+          "bucket-owner-full-control",
+          "log-delivery-write",
+        };
 
         CannedAccessControlList GetCannedAccessControlListForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == private__HASH)
-          {
-            return CannedAccessControlList::private_;
-          }
-          else if (hashCode == public_read_HASH)
-          {
-            return CannedAccessControlList::public_read;
-          }
-          else if (hashCode == public_read_write_HASH)
-          {
-            return CannedAccessControlList::public_read_write;
-          }
-          else if (hashCode == aws_exec_read_HASH)
-          {
-            return CannedAccessControlList::aws_exec_read;
-          }
-          else if (hashCode == authenticated_read_HASH)
-          {
-            return CannedAccessControlList::authenticated_read;
-          }
-          else if (hashCode == bucket_owner_read_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CannedAccessControlList::bucket_owner_read;
-          }
-          else if (hashCode == bucket_owner_full_control_HASH)
-          {
-            return CannedAccessControlList::bucket_owner_full_control;
-          }
-          else if (hashCode == log_delivery_write_HASH)
-          {
-            return CannedAccessControlList::log_delivery_write;
+          case -314497661:
+            if (name == "private")
+            {
+              return CannedAccessControlList::private_;
+            }
+            break;
+          case -1126309254:
+            if (name == "public-read")
+            {
+              return CannedAccessControlList::public_read;
+            }
+            break;
+          case -1397683508:
+            if (name == "public-read-write")
+            {
+              return CannedAccessControlList::public_read_write;
+            }
+            break;
+          case -2116027774:
+            if (name == "aws-exec-read")
+            {
+              return CannedAccessControlList::aws_exec_read;
+            }
+            break;
+          case 2076511348:
+            if (name == "authenticated-read")
+            {
+              return CannedAccessControlList::authenticated_read;
+            }
+            break;
+          case 18410547:
+            if (name == "bucket-owner-read")
+            {
+              return CannedAccessControlList::bucket_owner_read;
+            }
+            break;
+          case -1751248452:
+            if (name == "bucket-owner-full-control")
+            {
+              return CannedAccessControlList::bucket_owner_full_control;
+            }
+            break;
+          case -922330513:
+            if (name == "log-delivery-write")
+            {
+              return CannedAccessControlList::log_delivery_write;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return CannedAccessControlList::NOT_SET;
         }
 
-        Aws::String GetNameForCannedAccessControlList(CannedAccessControlList enumValue)
+        const char* GetNameForCannedAccessControlListCStr(CannedAccessControlList enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CannedAccessControlList::private_:
-            return "private";
-          case CannedAccessControlList::public_read:
-            return "public-read";
-          case CannedAccessControlList::public_read_write:
-            return "public-read-write";
-          case CannedAccessControlList::aws_exec_read:
-            return "aws-exec-read";
-          case CannedAccessControlList::authenticated_read:
-            return "authenticated-read";
-          case CannedAccessControlList::bucket_owner_read:
-            return "bucket-owner-read";
-          case CannedAccessControlList::bucket_owner_full_control:
-            return "bucket-owner-full-control";
-          case CannedAccessControlList::log_delivery_write:
-            return "log-delivery-write";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCannedAccessControlList(CannedAccessControlList enumValue)
+        {
+          return GetNameForCannedAccessControlListCStr(enumValue);
         }
 
       } // namespace CannedAccessControlListMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace CertificateStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int REVOKED_HASH = HashingUtils::HashString("REVOKED");
-        static const int PENDING_TRANSFER_HASH = HashingUtils::HashString("PENDING_TRANSFER");
-        static const int REGISTER_INACTIVE_HASH = HashingUtils::HashString("REGISTER_INACTIVE");
-        static const int PENDING_ACTIVATION_HASH = HashingUtils::HashString("PENDING_ACTIVATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "INACTIVE",
+          "REVOKED",
+          "PENDING_TRANSFER",
+          "REGISTER_INACTIVE",
+          "PENDING_ACTIVATION",
+        };
 
         CertificateStatus GetCertificateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return CertificateStatus::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return CertificateStatus::INACTIVE;
-          }
-          else if (hashCode == REVOKED_HASH)
-          {
-            return CertificateStatus::REVOKED;
-          }
-          else if (hashCode == PENDING_TRANSFER_HASH)
-          {
-            return CertificateStatus::PENDING_TRANSFER;
-          }
-          else if (hashCode == REGISTER_INACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CertificateStatus::REGISTER_INACTIVE;
-          }
-          else if (hashCode == PENDING_ACTIVATION_HASH)
-          {
-            return CertificateStatus::PENDING_ACTIVATION;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return CertificateStatus::ACTIVE;
+            }
+            break;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return CertificateStatus::INACTIVE;
+            }
+            break;
+          case 1818119806:
+            if (name == "REVOKED")
+            {
+              return CertificateStatus::REVOKED;
+            }
+            break;
+          case -1305282125:
+            if (name == "PENDING_TRANSFER")
+            {
+              return CertificateStatus::PENDING_TRANSFER;
+            }
+            break;
+          case 1749427847:
+            if (name == "REGISTER_INACTIVE")
+            {
+              return CertificateStatus::REGISTER_INACTIVE;
+            }
+            break;
+          case -772051746:
+            if (name == "PENDING_ACTIVATION")
+            {
+              return CertificateStatus::PENDING_ACTIVATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return CertificateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCertificateStatus(CertificateStatus enumValue)
+        const char* GetNameForCertificateStatusCStr(CertificateStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CertificateStatus::ACTIVE:
-            return "ACTIVE";
-          case CertificateStatus::INACTIVE:
-            return "INACTIVE";
-          case CertificateStatus::REVOKED:
-            return "REVOKED";
-          case CertificateStatus::PENDING_TRANSFER:
-            return "PENDING_TRANSFER";
-          case CertificateStatus::REGISTER_INACTIVE:
-            return "REGISTER_INACTIVE";
-          case CertificateStatus::PENDING_ACTIVATION:
-            return "PENDING_ACTIVATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCertificateStatus(CertificateStatus enumValue)
+        {
+          return GetNameForCertificateStatusCStr(enumValue);
         }
 
       } // namespace CertificateStatusMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int less_than_HASH = HashingUtils::HashString("less-than");
-        static const int less_than_equals_HASH = HashingUtils::HashString("less-than-equals");
-        static const int greater_than_HASH = HashingUtils::HashString("greater-than");
-        static const int greater_than_equals_HASH = HashingUtils::HashString("greater-than-equals");
-        static const int in_cidr_set_HASH = HashingUtils::HashString("in-cidr-set");
-        static const int not_in_cidr_set_HASH = HashingUtils::HashString("not-in-cidr-set");
-        static const int in_port_set_HASH = HashingUtils::HashString("in-port-set");
-        static const int not_in_port_set_HASH = HashingUtils::HashString("not-in-port-set");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "less-than",
+          "less-than-equals",
+          "greater-than",
+          "greater-than-equals",
+          "in-cidr-set",
+          "not-in-cidr-set",
+          "in-port-set",
+          "not-in-port-set",
+        };
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == less_than_HASH)
-          {
-            return ComparisonOperator::less_than;
-          }
-          else if (hashCode == less_than_equals_HASH)
-          {
-            return ComparisonOperator::less_than_equals;
-          }
-          else if (hashCode == greater_than_HASH)
-          {
-            return ComparisonOperator::greater_than;
-          }
-          else if (hashCode == greater_than_equals_HASH)
-          {
-            return ComparisonOperator::greater_than_equals;
-          }
-          else if (hashCode == in_cidr_set_HASH)
-          {
-            return ComparisonOperator::in_cidr_set;
-          }
-          else if (hashCode == not_in_cidr_set_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComparisonOperator::not_in_cidr_set;
-          }
-          else if (hashCode == in_port_set_HASH)
-          {
-            return ComparisonOperator::in_port_set;
-          }
-          else if (hashCode == not_in_port_set_HASH)
-          {
-            return ComparisonOperator::not_in_port_set;
+          case 319808853:
+            if (name == "less-than")
+            {
+              return ComparisonOperator::less_than;
+            }
+            break;
+          case 406407991:
+            if (name == "less-than-equals")
+            {
+              return ComparisonOperator::less_than_equals;
+            }
+            break;
+          case -1420857452:
+            if (name == "greater-than")
+            {
+              return ComparisonOperator::greater_than;
+            }
+            break;
+          case 2108984344:
+            if (name == "greater-than-equals")
+            {
+              return ComparisonOperator::greater_than_equals;
+            }
+            break;
+          case -1461232079:
+            if (name == "in-cidr-set")
+            {
+              return ComparisonOperator::in_cidr_set;
+            }
+            break;
+          case -1577945545:
+            if (name == "not-in-cidr-set")
+            {
+              return ComparisonOperator::not_in_cidr_set;
+            }
+            break;
+          case 1153175742:
+            if (name == "in-port-set")
+            {
+              return ComparisonOperator::in_port_set;
+            }
+            break;
+          case 1036462276:
+            if (name == "not-in-port-set")
+            {
+              return ComparisonOperator::not_in_port_set;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperatorCStr(ComparisonOperator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComparisonOperator::less_than:
-            return "less-than";
-          case ComparisonOperator::less_than_equals:
-            return "less-than-equals";
-          case ComparisonOperator::greater_than:
-            return "greater-than";
-          case ComparisonOperator::greater_than_equals:
-            return "greater-than-equals";
-          case ComparisonOperator::in_cidr_set:
-            return "in-cidr-set";
-          case ComparisonOperator::not_in_cidr_set:
-            return "not-in-cidr-set";
-          case ComparisonOperator::in_port_set:
-            return "in-port-set";
-          case ComparisonOperator::not_in_port_set:
-            return "not-in-port-set";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        {
+          return GetNameForComparisonOperatorCStr(enumValue);
         }
 
       } // namespace ComparisonOperatorMapper
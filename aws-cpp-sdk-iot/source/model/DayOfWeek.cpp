@@ -30,45 +30,72 @@ namespace Aws
       namespace DayOfWeekMapper
       {
 
-        static const int SUN_HASH = HashingUtils::HashString("SUN");
-        static const int MON_HASH = HashingUtils::HashString("MON");
-        static const int TUE_HASH = HashingUtils::HashString("TUE");
-        static const int WED_HASH = HashingUtils::HashString("WED");
-        static const int THU_HASH = HashingUtils::HashString("THU");
-        static const int FRI_HASH = HashingUtils::HashString("FRI");
-        static const int SAT_HASH = HashingUtils::HashString("SAT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUN",
+          "MON",
+          "TUE",
+          "WED",
+          "THU",
+          "FRI",
+          "SAT",
+        };
 
         DayOfWeek GetDayOfWeekForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUN_HASH)
-          {
-            return DayOfWeek::SUN;
-          }
-          else if (hashCode == MON_HASH)
-          {
-            return DayOfWeek::MON;
-          }
-          else if (hashCode == TUE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DayOfWeek::TUE;
-          }
-          else if (hashCode == WED_HASH)
-          {
-            return DayOfWeek::WED;
-          }
-          else if (hashCode == THU_HASH)
-          {
-            return DayOfWeek::THU;
-          }
-          else if (hashCode == FRI_HASH)
-          {
-            return DayOfWeek::FRI;
-          }
-          else if (hashCode == SAT_HASH)
-          {
-            return DayOfWeek::SAT;
+          case 82476:
+            if (name == "SUN")
+            {
+              return DayOfWeek::SUN;
+            }
+            break;
+          case 76524:
+            if (name == "MON")
+            {
+              return DayOfWeek::MON;
+            }
+            break;
+          case 83428:
+            if (name == "TUE")
+            {
+              return DayOfWeek::TUE;
+            }
+            break;
+          case 85814:
+            if (name == "WED")
+            {
+              return DayOfWeek::WED;
+            }
+            break;
+          case 83041:
+            if (name == "THU")
+            {
+              return DayOfWeek::THU;
+            }
+            break;
+          case 69885:
+            if (name == "FRI")
+            {
+              return DayOfWeek::FRI;
+            }
+            break;
+          case 81862:
+            if (name == "SAT")
+            {
+              return DayOfWeek::SAT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return DayOfWeek::NOT_SET;
         }
 
-        Aws::String GetNameForDayOfWeek(DayOfWeek enumValue)
+        const char* GetNameForDayOfWeekCStr(DayOfWeek enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DayOfWeek::SUN:
-            return "SUN";
-          case DayOfWeek::MON:
-            return "MON";
-          case DayOfWeek::TUE:
-            return "TUE";
-          case DayOfWeek::WED:
-            return "WED";
-          case DayOfWeek::THU:
-            return "THU";
-          case DayOfWeek::FRI:
-            return "FRI";
-          case DayOfWeek::SAT:
-            return "SAT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDayOfWeek(DayOfWeek enumValue)
+        {
+          return GetNameForDayOfWeekCStr(enumValue);
         }
 
       } // namespace DayOfWeekMapper
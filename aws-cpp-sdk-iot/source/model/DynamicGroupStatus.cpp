@@ -30,25 +30,44 @@ namespace Aws
       namespace DynamicGroupStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int BUILDING_HASH = HashingUtils::HashString("BUILDING");
-        static const int REBUILDING_HASH = HashingUtils::HashString("REBUILDING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "BUILDING",
+          "REBUILDING",
+        };
 
         DynamicGroupStatus GetDynamicGroupStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return DynamicGroupStatus::ACTIVE;
-          }
-          else if (hashCode == BUILDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DynamicGroupStatus::BUILDING;
-          }
-          else if (hashCode == REBUILDING_HASH)
-          {
-            return DynamicGroupStatus::REBUILDING;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return DynamicGroupStatus::ACTIVE;
+            }
+            break;
+          case -648019276:
+            if (name == "BUILDING")
+            {
+              return DynamicGroupStatus::BUILDING;
+            }
+            break;
+          case 257436135:
+            if (name == "REBUILDING")
+            {
+              return DynamicGroupStatus::REBUILDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DynamicGroupStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDynamicGroupStatus(DynamicGroupStatus enumValue)
+        const char* GetNameForDynamicGroupStatusCStr(DynamicGroupStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DynamicGroupStatus::ACTIVE:
-            return "ACTIVE";
-          case DynamicGroupStatus::BUILDING:
-            return "BUILDING";
-          case DynamicGroupStatus::REBUILDING:
-            return "REBUILDING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDynamicGroupStatus(DynamicGroupStatus enumValue)
+        {
+          return GetNameForDynamicGroupStatusCStr(enumValue);
         }
 
       } // namespace DynamicGroupStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DynamoKeyTypeMapper
       {
 
-        static const int STRING_HASH = HashingUtils::HashString("STRING");
-        static const int NUMBER_HASH = HashingUtils::HashString("NUMBER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STRING",
+          "NUMBER",
+        };
 
         DynamoKeyType GetDynamoKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STRING_HASH)
-          {
-            return DynamoKeyType::STRING;
-          }
-          else if (hashCode == NUMBER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DynamoKeyType::NUMBER;
+          case -1838656495:
+            if (name == "STRING")
+            {
+              return DynamoKeyType::STRING;
+            }
+            break;
+          case -1981034679:
+            if (name == "NUMBER")
+            {
+              return DynamoKeyType::NUMBER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DynamoKeyType::NOT_SET;
         }
 
-        Aws::String GetNameForDynamoKeyType(DynamoKeyType enumValue)
+        const char* GetNameForDynamoKeyTypeCStr(DynamoKeyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DynamoKeyType::STRING:
-            return "STRING";
-          case DynamoKeyType::NUMBER:
-            return "NUMBER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDynamoKeyType(DynamoKeyType enumValue)
+        {
+          return GetNameForDynamoKeyTypeCStr(enumValue);
         }
 
       } // namespace DynamoKeyTypeMapper
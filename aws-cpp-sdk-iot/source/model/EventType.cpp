@@ -30,65 +30,100 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int THING_HASH = HashingUtils::HashString("THING");
-        static const int THING_GROUP_HASH = HashingUtils::HashString("THING_GROUP");
-        static const int THING_TYPE_HASH = HashingUtils::HashString("THING_TYPE");
-        static const int THING_GROUP_MEMBERSHIP_HASH = HashingUtils::HashString("THING_GROUP_MEMBERSHIP");
-        static const int THING_GROUP_HIERARCHY_HASH = HashingUtils::HashString("THING_GROUP_HIERARCHY");
-        static const int THING_TYPE_ASSOCIATION_HASH = HashingUtils::HashString("THING_TYPE_ASSOCIATION");
-        static const int JOB_HASH = HashingUtils::HashString("JOB");
-        static const int JOB_EXECUTION_HASH = HashingUtils::HashString("JOB_EXECUTION");
-        static const int POLICY_HASH = HashingUtils::HashString("POLICY");
-        static const int CERTIFICATE_HASH = HashingUtils::HashString("CERTIFICATE");
-        static const int CA_CERTIFICATE_HASH = HashingUtils::HashString("CA_CERTIFICATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "THING",
+          "THING_GROUP",
+          "THING_TYPE",
+          "THING_GROUP_MEMBERSHIP",
+          "THING_GROUP_HIERARCHY",
+          "THING_TYPE_ASSOCIATION",
+          "JOB",
+          "JOB_EXECUTION",
+          "POLICY",
+          "CERTIFICATE",
+          "CA_CERTIFICATE",
+        };
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == THING_HASH)
-          {
-            return EventType::THING;
-          }
-          else if (hashCode == THING_GROUP_HASH)
-          {
-            return EventType::THING_GROUP;
-          }
-          else if (hashCode == THING_TYPE_HASH)
-          {
-            return EventType::THING_TYPE;
-          }
-          else if (hashCode == THING_GROUP_MEMBERSHIP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventType::THING_GROUP_MEMBERSHIP;
-          }
-          else if (hashCode == THING_GROUP_HIERARCHY_HASH)
-          {
-            return EventType::THING_GROUP_HIERARCHY;
-          }
-          else if (hashCode == THING_TYPE_ASSOCIATION_HASH)
-          {
-            return EventType::THING_TYPE_ASSOCIATION;
-          }
-          else if (hashCode == JOB_HASH)
-          {
-            return EventType::JOB;
-          }
-          else if (hashCode == JOB_EXECUTION_HASH)
-          {
-            return EventType::JOB_EXECUTION;
-          }
-          else if (hashCode == POLICY_HASH)
-          {
-            return EventType::POLICY;
-          }
-          else if (hashCode == CERTIFICATE_HASH)
-          {
-            return EventType::CERTIFICATE;
-          }
-          else if (hashCode == CA_CERTIFICATE_HASH)
-          {
-            return EventType::CA_CERTIFICATE;
+          case 79793358:
+            if (name == "THING")
+            {
+              return EventType::THING;
+            }
+            break;
+          case -807953490:
+            if (name == "THING_GROUP")
+            {
+              return EventType::THING_GROUP;
+            }
+            break;
+          case 389973003:
+            if (name == "THING_TYPE")
+            {
+              return EventType::THING_TYPE;
+            }
+            break;
+          case -1953647353:
+            if (name == "THING_GROUP_MEMBERSHIP")
+            {
+              return EventType::THING_GROUP_MEMBERSHIP;
+            }
+            break;
+          case -1506871612:
+            if (name == "THING_GROUP_HIERARCHY")
+            {
+              return EventType::THING_GROUP_HIERARCHY;
+            }
+            break;
+          case 1329764909:
+            if (name == "THING_TYPE_ASSOCIATION")
+            {
+              return EventType::THING_TYPE_ASSOCIATION;
+            }
+            break;
+          case 73629:
+            if (name == "JOB")
+            {
+              return EventType::JOB;
+            }
+            break;
+          case -1057352490:
+            if (name == "JOB_EXECUTION")
+            {
+              return EventType::JOB_EXECUTION;
+            }
+            break;
+          case -1929340622:
+            if (name == "POLICY")
+            {
+              return EventType::POLICY;
+            }
+            break;
+          case -189606537:
+            if (name == "CERTIFICATE")
+            {
+              return EventType::CERTIFICATE;
+            }
+            break;
+          case 2079301398:
+            if (name == "CA_CERTIFICATE")
+            {
+              return EventType::CA_CERTIFICATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventTypeCStr(EventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventType::THING:
-            return "THING";
-          case EventType::THING_GROUP:
-            return "THING_GROUP";
-          case EventType::THING_TYPE:
-            return "THING_TYPE";
-          case EventType::THING_GROUP_MEMBERSHIP:
-            return "THING_GROUP_MEMBERSHIP";
-          case EventType::THING_GROUP_HIERARCHY:
-            return "THING_GROUP_HIERARCHY";
-          case EventType::THING_TYPE_ASSOCIATION:
-            return "THING_TYPE_ASSOCIATION";
-          case EventType::JOB:
-            return "JOB";
-          case EventType::JOB_EXECUTION:
-            return "JOB_EXECUTION";
-          case EventType::POLICY:
-            return "POLICY";
-          case EventType::CERTIFICATE:
-            return "CERTIFICATE";
-          case EventType::CA_CERTIFICATE:
-            return "CA_CERTIFICATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventType(EventType enumValue)
+        {
+          return GetNameForEventTypeCStr(enumValue);
         }
 
       } // namespace EventTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace IndexStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int BUILDING_HASH = HashingUtils::HashString("BUILDING");
-        static const int REBUILDING_HASH = HashingUtils::HashString("REBUILDING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "BUILDING",
+          "REBUILDING",
+        };
 
         IndexStatus GetIndexStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return IndexStatus::ACTIVE;
-          }
-          else if (hashCode == BUILDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IndexStatus::BUILDING;
-          }
-          else if (hashCode == REBUILDING_HASH)
-          {
-            return IndexStatus::REBUILDING;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return IndexStatus::ACTIVE;
+            }
+            break;
+          case -648019276:
+            if (name == "BUILDING")
+            {
+              return IndexStatus::BUILDING;
+            }
+            break;
+          case 257436135:
+            if (name == "REBUILDING")
+            {
+              return IndexStatus::REBUILDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return IndexStatus::NOT_SET;
         }
 
-        Aws::String GetNameForIndexStatus(IndexStatus enumValue)
+        const char* GetNameForIndexStatusCStr(IndexStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IndexStatus::ACTIVE:
-            return "ACTIVE";
-          case IndexStatus::BUILDING:
-            return "BUILDING";
-          case IndexStatus::REBUILDING:
-            return "REBUILDING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIndexStatus(IndexStatus enumValue)
+        {
+          return GetNameForIndexStatusCStr(enumValue);
         }
 
       } // namespace IndexStatusMapper
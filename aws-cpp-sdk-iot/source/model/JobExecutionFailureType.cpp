@@ -30,30 +30,51 @@ namespace Aws
       namespace JobExecutionFailureTypeMapper
       {
 
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int REJECTED_HASH = HashingUtils::HashString("REJECTED");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FAILED",
+          "REJECTED",
+          "TIMED_OUT",
+          "ALL",
+        };
 
         JobExecutionFailureType GetJobExecutionFailureTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAILED_HASH)
-          {
-            return JobExecutionFailureType::FAILED;
-          }
-          else if (hashCode == REJECTED_HASH)
-          {
-            return JobExecutionFailureType::REJECTED;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return JobExecutionFailureType::TIMED_OUT;
-          }
-          else if (hashCode == ALL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobExecutionFailureType::ALL;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return JobExecutionFailureType::FAILED;
+            }
+            break;
+          case 174130302:
+            if (name == "REJECTED")
+            {
+              return JobExecutionFailureType::REJECTED;
+            }
+            break;
+          case -1466757626:
+            if (name == "TIMED_OUT")
+            {
+              return JobExecutionFailureType::TIMED_OUT;
+            }
+            break;
+          case 64897:
+            if (name == "ALL")
+            {
+              return JobExecutionFailureType::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return JobExecutionFailureType::NOT_SET;
         }
 
-        Aws::String GetNameForJobExecutionFailureType(JobExecutionFailureType enumValue)
+        const char* GetNameForJobExecutionFailureTypeCStr(JobExecutionFailureType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobExecutionFailureType::FAILED:
-            return "FAILED";
-          case JobExecutionFailureType::REJECTED:
-            return "REJECTED";
-          case JobExecutionFailureType::TIMED_OUT:
-            return "TIMED_OUT";
-          case JobExecutionFailureType::ALL:
-            return "ALL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobExecutionFailureType(JobExecutionFailureType enumValue)
+        {
+          return GetNameForJobExecutionFailureTypeCStr(enumValue);
         }
 
       } // namespace JobExecutionFailureTypeMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace JobExecutionStatusMapper
       {
 
-        static const int QUEUED_HASH = HashingUtils::HashString("QUEUED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
-        static const int REJECTED_HASH = HashingUtils::HashString("REJECTED");
-        static const int REMOVED_HASH = HashingUtils::HashString("REMOVED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "QUEUED",
+          "IN_PROGRESS",
+          "SUCCEEDED",
+          "FAILED",
+          "TIMED_OUT",
+          "REJECTED",
+          "REMOVED",
+          "CANCELED",
+        };
 
         JobExecutionStatus GetJobExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == QUEUED_HASH)
-          {
-            return JobExecutionStatus::QUEUED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return JobExecutionStatus::IN_PROGRESS;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return JobExecutionStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobExecutionStatus::FAILED;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return JobExecutionStatus::TIMED_OUT;
-          }
-          else if (hashCode == REJECTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobExecutionStatus::REJECTED;
-          }
-          else if (hashCode == REMOVED_HASH)
-          {
-            return JobExecutionStatus::REMOVED;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return JobExecutionStatus::CANCELED;
+          case -1895367309:
+            if (name == "QUEUED")
+            {
+              return JobExecutionStatus::QUEUED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return JobExecutionStatus::IN_PROGRESS;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return JobExecutionStatus::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return JobExecutionStatus::FAILED;
+            }
+            break;
+          case -1466757626:
+            if (name == "TIMED_OUT")
+            {
+              return JobExecutionStatus::TIMED_OUT;
+            }
+            break;
+          case 174130302:
+            if (name == "REJECTED")
+            {
+              return JobExecutionStatus::REJECTED;
+            }
+            break;
+          case 1809818688:
+            if (name == "REMOVED")
+            {
+              return JobExecutionStatus::REMOVED;
+            }
+            break;
+          case 659453081:
+            if (name == "CANCELED")
+            {
+              return JobExecutionStatus::CANCELED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return JobExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobExecutionStatus(JobExecutionStatus enumValue)
+        const char* GetNameForJobExecutionStatusCStr(JobExecutionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobExecutionStatus::QUEUED:
-            return "QUEUED";
-          case JobExecutionStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case JobExecutionStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case JobExecutionStatus::FAILED:
-            return "FAILED";
-          case JobExecutionStatus::TIMED_OUT:
-            return "TIMED_OUT";
-          case JobExecutionStatus::REJECTED:
-            return "REJECTED";
-          case JobExecutionStatus::REMOVED:
-            return "REMOVED";
-          case JobExecutionStatus::CANCELED:
-            return "CANCELED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobExecutionStatus(JobExecutionStatus enumValue)
+        {
+          return GetNameForJobExecutionStatusCStr(enumValue);
         }
 
       } // namespace JobExecutionStatusMapper
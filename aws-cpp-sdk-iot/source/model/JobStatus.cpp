@@ -30,30 +30,51 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int DELETION_IN_PROGRESS_HASH = HashingUtils::HashString("DELETION_IN_PROGRESS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "CANCELED",
+          "COMPLETED",
+          "DELETION_IN_PROGRESS",
+        };
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return JobStatus::IN_PROGRESS;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return JobStatus::CANCELED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return JobStatus::COMPLETED;
-          }
-          else if (hashCode == DELETION_IN_PROGRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobStatus::DELETION_IN_PROGRESS;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return JobStatus::IN_PROGRESS;
+            }
+            break;
+          case 659453081:
+            if (name == "CANCELED")
+            {
+              return JobStatus::CANCELED;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return JobStatus::COMPLETED;
+            }
+            break;
+          case -927973098:
+            if (name == "DELETION_IN_PROGRESS")
+            {
+              return JobStatus::DELETION_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatusCStr(JobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case JobStatus::CANCELED:
-            return "CANCELED";
-          case JobStatus::COMPLETED:
-            return "COMPLETED";
-          case JobStatus::DELETION_IN_PROGRESS:
-            return "DELETION_IN_PROGRESS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        {
+          return GetNameForJobStatusCStr(enumValue);
         }
 
       } // namespace JobStatusMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace LogLevelMapper
       {
 
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int WARN_HASH = HashingUtils::HashString("WARN");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEBUG",
+          "INFO",
+          "ERROR",
+          "WARN",
+          "DISABLED",
+        };
 
         LogLevel GetLogLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEBUG__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LogLevel::DEBUG_;
-          }
-          else if (hashCode == INFO_HASH)
-          {
-            return LogLevel::INFO;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return LogLevel::ERROR_;
-          }
-          else if (hashCode == WARN_HASH)
-          {
-            return LogLevel::WARN;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return LogLevel::DISABLED;
+          case 64921139:
+            if (name == "DEBUG")
+            {
+              return LogLevel::DEBUG_;
+            }
+            break;
+          case 2251950:
+            if (name == "INFO")
+            {
+              return LogLevel::INFO;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return LogLevel::ERROR_;
+            }
+            break;
+          case 2656902:
+            if (name == "WARN")
+            {
+              return LogLevel::WARN;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return LogLevel::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return LogLevel::NOT_SET;
         }
 
-        Aws::String GetNameForLogLevel(LogLevel enumValue)
+        const char* GetNameForLogLevelCStr(LogLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LogLevel::DEBUG_:
-            return "DEBUG";
-          case LogLevel::INFO:
-            return "INFO";
-          case LogLevel::ERROR_:
-            return "ERROR";
-          case LogLevel::WARN:
-            return "WARN";
-          case LogLevel::DISABLED:
-            return "DISABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLogLevel(LogLevel enumValue)
+        {
+          return GetNameForLogLevelCStr(enumValue);
         }
 
       } // namespace LogLevelMapper
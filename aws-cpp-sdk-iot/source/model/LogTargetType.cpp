@@ -30,20 +30,37 @@ namespace Aws
       namespace LogTargetTypeMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int THING_GROUP_HASH = HashingUtils::HashString("THING_GROUP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "THING_GROUP",
+        };
 
         LogTargetType GetLogTargetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return LogTargetType::DEFAULT;
-          }
-          else if (hashCode == THING_GROUP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LogTargetType::THING_GROUP;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return LogTargetType::DEFAULT;
+            }
+            break;
+          case -807953490:
+            if (name == "THING_GROUP")
+            {
+              return LogTargetType::THING_GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LogTargetType::NOT_SET;
         }
 
-        Aws::String GetNameForLogTargetType(LogTargetType enumValue)
+        const char* GetNameForLogTargetTypeCStr(LogTargetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LogTargetType::DEFAULT:
-            return "DEFAULT";
-          case LogTargetType::THING_GROUP:
-            return "THING_GROUP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLogTargetType(LogTargetType enumValue)
+        {
+          return GetNameForLogTargetTypeCStr(enumValue);
         }
 
       } // namespace LogTargetTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace MessageFormatMapper
       {
 
-        static const int RAW_HASH = HashingUtils::HashString("RAW");
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RAW",
+          "JSON",
+        };
 
         MessageFormat GetMessageFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RAW_HASH)
-          {
-            return MessageFormat::RAW;
-          }
-          else if (hashCode == JSON_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MessageFormat::JSON;
+          case 80904:
+            if (name == "RAW")
+            {
+              return MessageFormat::RAW;
+            }
+            break;
+          case 2286824:
+            if (name == "JSON")
+            {
+              return MessageFormat::JSON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MessageFormat::NOT_SET;
         }
 
-        Aws::String GetNameForMessageFormat(MessageFormat enumValue)
+        const char* GetNameForMessageFormatCStr(MessageFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MessageFormat::RAW:
-            return "RAW";
-          case MessageFormat::JSON:
-            return "JSON";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMessageFormat(MessageFormat enumValue)
+        {
+          return GetNameForMessageFormatCStr(enumValue);
         }
 
       } // namespace MessageFormatMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace OTAUpdateStatusMapper
       {
 
-        static const int CREATE_PENDING_HASH = HashingUtils::HashString("CREATE_PENDING");
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_COMPLETE_HASH = HashingUtils::HashString("CREATE_COMPLETE");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE_PENDING",
+          "CREATE_IN_PROGRESS",
+          "CREATE_COMPLETE",
+          "CREATE_FAILED",
+        };
 
         OTAUpdateStatus GetOTAUpdateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_PENDING_HASH)
-          {
-            return OTAUpdateStatus::CREATE_PENDING;
-          }
-          else if (hashCode == CREATE_IN_PROGRESS_HASH)
-          {
-            return OTAUpdateStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_COMPLETE_HASH)
-          {
-            return OTAUpdateStatus::CREATE_COMPLETE;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OTAUpdateStatus::CREATE_FAILED;
+          case 288199988:
+            if (name == "CREATE_PENDING")
+            {
+              return OTAUpdateStatus::CREATE_PENDING;
+            }
+            break;
+          case 43560260:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return OTAUpdateStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case -569796324:
+            if (name == "CREATE_COMPLETE")
+            {
+              return OTAUpdateStatus::CREATE_COMPLETE;
+            }
+            break;
+          case -835019552:
+            if (name == "CREATE_FAILED")
+            {
+              return OTAUpdateStatus::CREATE_FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return OTAUpdateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForOTAUpdateStatus(OTAUpdateStatus enumValue)
+        const char* GetNameForOTAUpdateStatusCStr(OTAUpdateStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OTAUpdateStatus::CREATE_PENDING:
-            return "CREATE_PENDING";
-          case OTAUpdateStatus::CREATE_IN_PROGRESS:
-            return "CREATE_IN_PROGRESS";
-          case OTAUpdateStatus::CREATE_COMPLETE:
-            return "CREATE_COMPLETE";
-          case OTAUpdateStatus::CREATE_FAILED:
-            return "CREATE_FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOTAUpdateStatus(OTAUpdateStatus enumValue)
+        {
+          return GetNameForOTAUpdateStatusCStr(enumValue);
         }
 
       } // namespace OTAUpdateStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ReportTypeMapper
       {
 
-        static const int ERRORS_HASH = HashingUtils::HashString("ERRORS");
-        static const int RESULTS_HASH = HashingUtils::HashString("RESULTS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ERRORS",
+          "RESULTS",
+        };
 
         ReportType GetReportTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ERRORS_HASH)
-          {
-            return ReportType::ERRORS;
-          }
-          else if (hashCode == RESULTS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReportType::RESULTS;
+          case 2053661547:
+            if (name == "ERRORS")
+            {
+              return ReportType::ERRORS;
+            }
+            break;
+          case 1815529430:
+            if (name == "RESULTS")
+            {
+              return ReportType::RESULTS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReportType::NOT_SET;
         }
 
-        Aws::String GetNameForReportType(ReportType enumValue)
+        const char* GetNameForReportTypeCStr(ReportType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReportType::ERRORS:
-            return "ERRORS";
-          case ReportType::RESULTS:
-            return "RESULTS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReportType(ReportType enumValue)
+        {
+          return GetNameForReportTypeCStr(enumValue);
         }
 
       } // namespace ReportTypeMapper
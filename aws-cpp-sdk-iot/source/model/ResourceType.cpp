@@ -30,40 +30,65 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int DEVICE_CERTIFICATE_HASH = HashingUtils::HashString("DEVICE_CERTIFICATE");
-        static const int CA_CERTIFICATE_HASH = HashingUtils::HashString("CA_CERTIFICATE");
-        static const int IOT_POLICY_HASH = HashingUtils::HashString("IOT_POLICY");
-        static const int COGNITO_IDENTITY_POOL_HASH = HashingUtils::HashString("COGNITO_IDENTITY_POOL");
-        static const int CLIENT_ID_HASH = HashingUtils::HashString("CLIENT_ID");
-        static const int ACCOUNT_SETTINGS_HASH = HashingUtils::HashString("ACCOUNT_SETTINGS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEVICE_CERTIFICATE",
+          "CA_CERTIFICATE",
+          "IOT_POLICY",
+          "COGNITO_IDENTITY_POOL",
+          "CLIENT_ID",
+          "ACCOUNT_SETTINGS",
+        };
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEVICE_CERTIFICATE_HASH)
-          {
-            return ResourceType::DEVICE_CERTIFICATE;
-          }
-          else if (hashCode == CA_CERTIFICATE_HASH)
-          {
-            return ResourceType::CA_CERTIFICATE;
-          }
-          else if (hashCode == IOT_POLICY_HASH)
-          {
-            return ResourceType::IOT_POLICY;
-          }
-          else if (hashCode == COGNITO_IDENTITY_POOL_HASH)
-          {
-            return ResourceType::COGNITO_IDENTITY_POOL;
-          }
-          else if (hashCode == CLIENT_ID_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceType::CLIENT_ID;
-          }
-          else if (hashCode == ACCOUNT_SETTINGS_HASH)
-          {
-            return ResourceType::ACCOUNT_SETTINGS;
+          case -1860799218:
+            if (name == "DEVICE_CERTIFICATE")
+            {
+              return ResourceType::DEVICE_CERTIFICATE;
+            }
+            break;
+          case 2079301398:
+            if (name == "CA_CERTIFICATE")
+            {
+              return ResourceType::CA_CERTIFICATE;
+            }
+            break;
+          case -1369255261:
+            if (name == "IOT_POLICY")
+            {
+              return ResourceType::IOT_POLICY;
+            }
+            break;
+          case 587518095:
+            if (name == "COGNITO_IDENTITY_POOL")
+            {
+              return ResourceType::COGNITO_IDENTITY_POOL;
+            }
+            break;
+          case 882535951:
+            if (name == "CLIENT_ID")
+            {
+              return ResourceType::CLIENT_ID;
+            }
+            break;
+          case 524437013:
+            if (name == "ACCOUNT_SETTINGS")
+            {
+              return ResourceType::ACCOUNT_SETTINGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceTypeCStr(ResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceType::DEVICE_CERTIFICATE:
-            return "DEVICE_CERTIFICATE";
-          case ResourceType::CA_CERTIFICATE:
-            return "CA_CERTIFICATE";
-          case ResourceType::IOT_POLICY:
-            return "IOT_POLICY";
-          case ResourceType::COGNITO_IDENTITY_POOL:
-            return "COGNITO_IDENTITY_POOL";
-          case ResourceType::CLIENT_ID:
-            return "CLIENT_ID";
-          case ResourceType::ACCOUNT_SETTINGS:
-            return "ACCOUNT_SETTINGS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceType(ResourceType enumValue)
+        {
+          return GetNameForResourceTypeCStr(enumValue);
         }
 
       } // namespace ResourceTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Cancelling_HASH = HashingUtils::HashString("Cancelling");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InProgress",
+          "Completed",
+          "Failed",
+          "Cancelled",
+          "Cancelling",
+        };
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Status::InProgress;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return Status::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return Status::Failed;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return Status::Cancelled;
-          }
-          else if (hashCode == Cancelling_HASH)
-          {
-            return Status::Cancelling;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return Status::InProgress;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return Status::Completed;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return Status::Failed;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return Status::Cancelled;
+            }
+            break;
+          case -412160624:
+            if (name == "Cancelling")
+            {
+              return Status::Cancelling;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return Status::NOT_SET;
         }
 
-        Aws::String GetNameForStatus(Status enumValue)
+        const char* GetNameForStatusCStr(Status enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Status::InProgress:
-            return "InProgress";
-          case Status::Completed:
-            return "Completed";
-          case Status::Failed:
-            return "Failed";
-          case Status::Cancelled:
-            return "Cancelled";
-          case Status::Cancelling:
-            return "Cancelling";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatus(Status enumValue)
+        {
+          return GetNameForStatusCStr(enumValue);
         }
 
       } // namespace StatusMapper
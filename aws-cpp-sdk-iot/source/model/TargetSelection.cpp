@@ -30,20 +30,37 @@ namespace Aws
       namespace TargetSelectionMapper
       {
 
-        static const int CONTINUOUS_HASH = HashingUtils::HashString("CONTINUOUS");
-        static const int SNAPSHOT_HASH = HashingUtils::HashString("SNAPSHOT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONTINUOUS",
+          "SNAPSHOT",
+        };
 
         TargetSelection GetTargetSelectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONTINUOUS_HASH)
-          {
-            return TargetSelection::CONTINUOUS;
-          }
-          else if (hashCode == SNAPSHOT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TargetSelection::SNAPSHOT;
+          case 864206607:
+            if (name == "CONTINUOUS")
+            {
+              return TargetSelection::CONTINUOUS;
+            }
+            break;
+          case 1067500996:
+            if (name == "SNAPSHOT")
+            {
+              return TargetSelection::SNAPSHOT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TargetSelection::NOT_SET;
         }
 
-        Aws::String GetNameForTargetSelection(TargetSelection enumValue)
+        const char* GetNameForTargetSelectionCStr(TargetSelection enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TargetSelection::CONTINUOUS:
-            return "CONTINUOUS";
-          case TargetSelection::SNAPSHOT:
-            return "SNAPSHOT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTargetSelection(TargetSelection enumValue)
+        {
+          return GetNameForTargetSelectionCStr(enumValue);
         }
 
       } // namespace TargetSelectionMapper
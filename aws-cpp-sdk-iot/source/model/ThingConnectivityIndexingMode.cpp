@@ -30,20 +30,37 @@ namespace Aws
       namespace ThingConnectivityIndexingModeMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int STATUS_HASH = HashingUtils::HashString("STATUS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OFF",
+          "STATUS",
+        };
 
         ThingConnectivityIndexingMode GetThingConnectivityIndexingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
-          {
-            return ThingConnectivityIndexingMode::OFF;
-          }
-          else if (hashCode == STATUS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ThingConnectivityIndexingMode::STATUS;
+          case 78159:
+            if (name == "OFF")
+            {
+              return ThingConnectivityIndexingMode::OFF;
+            }
+            break;
+          case -1839152142:
+            if (name == "STATUS")
+            {
+              return ThingConnectivityIndexingMode::STATUS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ThingConnectivityIndexingMode::NOT_SET;
         }
 
-        Aws::String GetNameForThingConnectivityIndexingMode(ThingConnectivityIndexingMode enumValue)
+        const char* GetNameForThingConnectivityIndexingModeCStr(ThingConnectivityIndexingMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ThingConnectivityIndexingMode::OFF:
-            return "OFF";
-          case ThingConnectivityIndexingMode::STATUS:
-            return "STATUS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForThingConnectivityIndexingMode(ThingConnectivityIndexingMode enumValue)
+        {
+          return GetNameForThingConnectivityIndexingModeCStr(enumValue);
         }
 
       } // namespace ThingConnectivityIndexingModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ThingGroupIndexingModeMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int ON_HASH = HashingUtils::HashString("ON");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OFF",
+          "ON",
+        };
 
         ThingGroupIndexingMode GetThingGroupIndexingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
-          {
-            return ThingGroupIndexingMode::OFF;
-          }
-          else if (hashCode == ON_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ThingGroupIndexingMode::ON;
+          case 78159:
+            if (name == "OFF")
+            {
+              return ThingGroupIndexingMode::OFF;
+            }
+            break;
+          case 2527:
+            if (name == "ON")
+            {
+              return ThingGroupIndexingMode::ON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ThingGroupIndexingMode::NOT_SET;
         }
 
-        Aws::String GetNameForThingGroupIndexingMode(ThingGroupIndexingMode enumValue)
+        const char* GetNameForThingGroupIndexingModeCStr(ThingGroupIndexingMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ThingGroupIndexingMode::OFF:
-            return "OFF";
-          case ThingGroupIndexingMode::ON:
-            return "ON";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForThingGroupIndexingMode(ThingGroupIndexingMode enumValue)
+        {
+          return GetNameForThingGroupIndexingModeCStr(enumValue);
         }
 
       } // namespace ThingGroupIndexingModeMapper
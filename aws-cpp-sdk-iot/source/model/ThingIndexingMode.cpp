@@ -30,25 +30,44 @@ namespace Aws
       namespace ThingIndexingModeMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int REGISTRY_HASH = HashingUtils::HashString("REGISTRY");
-        static const int REGISTRY_AND_SHADOW_HASH = HashingUtils::HashString("REGISTRY_AND_SHADOW");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OFF",
+          "REGISTRY",
+          "REGISTRY_AND_SHADOW",
+        };
 
         ThingIndexingMode GetThingIndexingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
-          {
-            return ThingIndexingMode::OFF;
-          }
-          else if (hashCode == REGISTRY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ThingIndexingMode::REGISTRY;
-          }
-          else if (hashCode == REGISTRY_AND_SHADOW_HASH)
-          {
-            return ThingIndexingMode::REGISTRY_AND_SHADOW;
+          case 78159:
+            if (name == "OFF")
+            {
+              return ThingIndexingMode::OFF;
+            }
+            break;
+          case 92414013:
+            if (name == "REGISTRY")
+            {
+              return ThingIndexingMode::REGISTRY;
+            }
+            break;
+          case 512982506:
+            if (name == "REGISTRY_AND_SHADOW")
+            {
+              return ThingIndexingMode::REGISTRY_AND_SHADOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ThingIndexingMode::NOT_SET;
         }
 
-        Aws::String GetNameForThingIndexingMode(ThingIndexingMode enumValue)
+        const char* GetNameForThingIndexingModeCStr(ThingIndexingMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ThingIndexingMode::OFF:
-            return "OFF";
-          case ThingIndexingMode::REGISTRY:
-            return "REGISTRY";
-          case ThingIndexingMode::REGISTRY_AND_SHADOW:
-            return "REGISTRY_AND_SHADOW";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForThingIndexingMode(ThingIndexingMode enumValue)
+        {
+          return GetNameForThingIndexingModeCStr(enumValue);
         }
 
       } // namespace ThingIndexingModeMapper
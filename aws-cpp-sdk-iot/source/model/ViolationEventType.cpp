@@ -30,25 +30,44 @@ namespace Aws
       namespace ViolationEventTypeMapper
       {
 
-        static const int in_alarm_HASH = HashingUtils::HashString("in-alarm");
-        static const int alarm_cleared_HASH = HashingUtils::HashString("alarm-cleared");
-        static const int alarm_invalidated_HASH = HashingUtils::HashString("alarm-invalidated");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "in-alarm",
+          "alarm-cleared",
+          "alarm-invalidated",
+        };
 
         ViolationEventType GetViolationEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == in_alarm_HASH)
-          {
-            return ViolationEventType::in_alarm;
-          }
-          else if (hashCode == alarm_cleared_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ViolationEventType::alarm_cleared;
-          }
-          else if (hashCode == alarm_invalidated_HASH)
-          {
-            return ViolationEventType::alarm_invalidated;
+          case -1466143831:
+            if (name == "in-alarm")
+            {
+              return ViolationEventType::in_alarm;
+            }
+            break;
+          case 1757208624:
+            if (name == "alarm-cleared")
+            {
+              return ViolationEventType::alarm_cleared;
+            }
+            break;
+          case 168268045:
+            if (name == "alarm-invalidated")
+            {
+              return ViolationEventType::alarm_invalidated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ViolationEventType::NOT_SET;
         }
 
-        Aws::String GetNameForViolationEventType(ViolationEventType enumValue)
+        const char* GetNameForViolationEventTypeCStr(ViolationEventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ViolationEventType::in_alarm:
-            return "in-alarm";
-          case ViolationEventType::alarm_cleared:
-            return "alarm-cleared";
-          case ViolationEventType::alarm_invalidated:
-            return "alarm-invalidated";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForViolationEventType(ViolationEventType enumValue)
+        {
+          return GetNameForViolationEventTypeCStr(enumValue);
         }
 
       } // namespace ViolationEventTypeMapper
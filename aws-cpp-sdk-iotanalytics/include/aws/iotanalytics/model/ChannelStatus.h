@@ -36,6 +36,11 @@ namespace ChannelStatusMapper
 AWS_IOTANALYTICS_API ChannelStatus GetChannelStatusForName(const Aws::String& name);
 
 AWS_IOTANALYTICS_API Aws::String GetNameForChannelStatus(ChannelStatus value);
+
+/**
+ * Same as GetNameForChannelStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOTANALYTICS_API const char* GetNameForChannelStatusCStr(ChannelStatus value);
 } // namespace ChannelStatusMapper
 } // namespace Model
 } // namespace IoTAnalytics
@@ -35,6 +35,11 @@ namespace ComputeTypeMapper
 AWS_IOTANALYTICS_API ComputeType GetComputeTypeForName(const Aws::String& name);
 
 AWS_IOTANALYTICS_API Aws::String GetNameForComputeType(ComputeType value);
+
+/**
+ * Same as GetNameForComputeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOTANALYTICS_API const char* GetNameForComputeTypeCStr(ComputeType value);
 } // namespace ComputeTypeMapper
 } // namespace Model
 } // namespace IoTAnalytics
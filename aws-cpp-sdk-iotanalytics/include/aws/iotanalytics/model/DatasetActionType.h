@@ -35,6 +35,11 @@ namespace DatasetActionTypeMapper
 AWS_IOTANALYTICS_API DatasetActionType GetDatasetActionTypeForName(const Aws::String& name);
 
 AWS_IOTANALYTICS_API Aws::String GetNameForDatasetActionType(DatasetActionType value);
+
+/**
+ * Same as GetNameForDatasetActionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOTANALYTICS_API const char* GetNameForDatasetActionTypeCStr(DatasetActionType value);
 } // namespace DatasetActionTypeMapper
 } // namespace Model
 } // namespace IoTAnalytics
@@ -36,6 +36,11 @@ namespace DatasetContentStateMapper
 AWS_IOTANALYTICS_API DatasetContentState GetDatasetContentStateForName(const Aws::String& name);
 
 AWS_IOTANALYTICS_API Aws::String GetNameForDatasetContentState(DatasetContentState value);
+
+/**
+ * Same as GetNameForDatasetContentState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOTANALYTICS_API const char* GetNameForDatasetContentStateCStr(DatasetContentState value);
 } // namespace DatasetContentStateMapper
 } // namespace Model
 } // namespace IoTAnalytics
@@ -36,6 +36,11 @@ namespace DatasetStatusMapper
 AWS_IOTANALYTICS_API DatasetStatus GetDatasetStatusForName(const Aws::String& name);
 
 AWS_IOTANALYTICS_API Aws::String GetNameForDatasetStatus(DatasetStatus value);
+
+/**
+ * Same as GetNameForDatasetStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOTANALYTICS_API const char* GetNameForDatasetStatusCStr(DatasetStatus value);
 } // namespace DatasetStatusMapper
 } // namespace Model
 } // namespace IoTAnalytics
@@ -36,6 +36,11 @@ namespace DatastoreStatusMapper
 AWS_IOTANALYTICS_API DatastoreStatus GetDatastoreStatusForName(const Aws::String& name);
 
 AWS_IOTANALYTICS_API Aws::String GetNameForDatastoreStatus(DatastoreStatus value);
+
+/**
+ * Same as GetNameForDatastoreStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOTANALYTICS_API const char* GetNameForDatastoreStatusCStr(DatastoreStatus value);
 } // namespace DatastoreStatusMapper
 } // namespace Model
 } // namespace IoTAnalytics
@@ -34,6 +34,11 @@ namespace LoggingLevelMapper
 AWS_IOTANALYTICS_API LoggingLevel GetLoggingLevelForName(const Aws::String& name);
 
 AWS_IOTANALYTICS_API Aws::String GetNameForLoggingLevel(LoggingLevel value);
+
+/**
+ * Same as GetNameForLoggingLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOTANALYTICS_API const char* GetNameForLoggingLevelCStr(LoggingLevel value);
 } // namespace LoggingLevelMapper
 } // namespace Model
 } // namespace IoTAnalytics
@@ -37,6 +37,11 @@ namespace ReprocessingStatusMapper
 AWS_IOTANALYTICS_API ReprocessingStatus GetReprocessingStatusForName(const Aws::String& name);
 
 AWS_IOTANALYTICS_API Aws::String GetNameForReprocessingStatus(ReprocessingStatus value);
+
+/**
+ * Same as GetNameForReprocessingStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_IOTANALYTICS_API const char* GetNameForReprocessingStatusCStr(ReprocessingStatus value);
 } // namespace ReprocessingStatusMapper
 } // namespace Model
 } // namespace IoTAnalytics
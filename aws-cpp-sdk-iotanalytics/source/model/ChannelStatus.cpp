@@ -30,25 +30,44 @@ namespace Aws
       namespace ChannelStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "ACTIVE",
+          "DELETING",
+        };
 
         ChannelStatus GetChannelStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return ChannelStatus::CREATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChannelStatus::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ChannelStatus::DELETING;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return ChannelStatus::CREATING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ChannelStatus::ACTIVE;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ChannelStatus::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ChannelStatus::NOT_SET;
         }
 
-        Aws::String GetNameForChannelStatus(ChannelStatus enumValue)
+        const char* GetNameForChannelStatusCStr(ChannelStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChannelStatus::CREATING:
-            return "CREATING";
-          case ChannelStatus::ACTIVE:
-            return "ACTIVE";
-          case ChannelStatus::DELETING:
-            return "DELETING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChannelStatus(ChannelStatus enumValue)
+        {
+          return GetNameForChannelStatusCStr(enumValue);
         }
 
       } // namespace ChannelStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ComputeTypeMapper
       {
 
-        static const int ACU_1_HASH = HashingUtils::HashString("ACU_1");
-        static const int ACU_2_HASH = HashingUtils::HashString("ACU_2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACU_1",
+          "ACU_2",
+        };
 
         ComputeType GetComputeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACU_1_HASH)
-          {
-            return ComputeType::ACU_1;
-          }
-          else if (hashCode == ACU_2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComputeType::ACU_2;
+          case 62109541:
+            if (name == "ACU_1")
+            {
+              return ComputeType::ACU_1;
+            }
+            break;
+          case 62109542:
+            if (name == "ACU_2")
+            {
+              return ComputeType::ACU_2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ComputeType::NOT_SET;
         }
 
-        Aws::String GetNameForComputeType(ComputeType enumValue)
+        const char* GetNameForComputeTypeCStr(ComputeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComputeType::ACU_1:
-            return "ACU_1";
-          case ComputeType::ACU_2:
-            return "ACU_2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComputeType(ComputeType enumValue)
+        {
+          return GetNameForComputeTypeCStr(enumValue);
         }
 
       } // namespace ComputeTypeMapper
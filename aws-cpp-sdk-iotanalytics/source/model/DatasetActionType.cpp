@@ -30,20 +30,37 @@ namespace Aws
       namespace DatasetActionTypeMapper
       {
 
-        static const int QUERY_HASH = HashingUtils::HashString("QUERY");
-        static const int CONTAINER_HASH = HashingUtils::HashString("CONTAINER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "QUERY",
+          "CONTAINER",
+        };
 
         DatasetActionType GetDatasetActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == QUERY_HASH)
-          {
-            return DatasetActionType::QUERY;
-          }
-          else if (hashCode == CONTAINER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DatasetActionType::CONTAINER;
+          case 77406376:
+            if (name == "QUERY")
+            {
+              return DatasetActionType::QUERY;
+            }
+            break;
+          case -1919329183:
+            if (name == "CONTAINER")
+            {
+              return DatasetActionType::CONTAINER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DatasetActionType::NOT_SET;
         }
 
-        Aws::String GetNameForDatasetActionType(DatasetActionType enumValue)
+        const char* GetNameForDatasetActionTypeCStr(DatasetActionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DatasetActionType::QUERY:
-            return "QUERY";
-          case DatasetActionType::CONTAINER:
-            return "CONTAINER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDatasetActionType(DatasetActionType enumValue)
+        {
+          return GetNameForDatasetActionTypeCStr(enumValue);
         }
 
       } // namespace DatasetActionTypeMapper
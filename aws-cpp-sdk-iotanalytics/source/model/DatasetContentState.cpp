@@ -30,25 +30,44 @@ namespace Aws
       namespace DatasetContentStateMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "SUCCEEDED",
+          "FAILED",
+        };
 
         DatasetContentState GetDatasetContentStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return DatasetContentState::CREATING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DatasetContentState::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return DatasetContentState::FAILED;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return DatasetContentState::CREATING;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return DatasetContentState::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return DatasetContentState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DatasetContentState::NOT_SET;
         }
 
-        Aws::String GetNameForDatasetContentState(DatasetContentState enumValue)
+        const char* GetNameForDatasetContentStateCStr(DatasetContentState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DatasetContentState::CREATING:
-            return "CREATING";
-          case DatasetContentState::SUCCEEDED:
-            return "SUCCEEDED";
-          case DatasetContentState::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDatasetContentState(DatasetContentState enumValue)
+        {
+          return GetNameForDatasetContentStateCStr(enumValue);
         }
 
       } // namespace DatasetContentStateMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DatastoreStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "ACTIVE",
+          "DELETING",
+        };
 
         DatastoreStatus GetDatastoreStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return DatastoreStatus::CREATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DatastoreStatus::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return DatastoreStatus::DELETING;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return DatastoreStatus::CREATING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return DatastoreStatus::ACTIVE;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return DatastoreStatus::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DatastoreStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDatastoreStatus(DatastoreStatus enumValue)
+        const char* GetNameForDatastoreStatusCStr(DatastoreStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DatastoreStatus::CREATING:
-            return "CREATING";
-          case DatastoreStatus::ACTIVE:
-            return "ACTIVE";
-          case DatastoreStatus::DELETING:
-            return "DELETING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDatastoreStatus(DatastoreStatus enumValue)
+        {
+          return GetNameForDatastoreStatusCStr(enumValue);
         }
 
       } // namespace DatastoreStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ReprocessingStatusMapper
       {
 
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RUNNING",
+          "SUCCEEDED",
+          "CANCELLED",
+          "FAILED",
+        };
 
         ReprocessingStatus GetReprocessingStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RUNNING_HASH)
-          {
-            return ReprocessingStatus::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return ReprocessingStatus::SUCCEEDED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return ReprocessingStatus::CANCELLED;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReprocessingStatus::FAILED;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return ReprocessingStatus::RUNNING;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return ReprocessingStatus::SUCCEEDED;
+            }
+            break;
+          case -1031784143:
+            if (name == "CANCELLED")
+            {
+              return ReprocessingStatus::CANCELLED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ReprocessingStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ReprocessingStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReprocessingStatus(ReprocessingStatus enumValue)
+        const char* GetNameForReprocessingStatusCStr(ReprocessingStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReprocessingStatus::RUNNING:
-            return "RUNNING";
-          case ReprocessingStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case ReprocessingStatus::CANCELLED:
-            return "CANCELLED";
-          case ReprocessingStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReprocessingStatus(ReprocessingStatus enumValue)
+        {
+          return GetNameForReprocessingStatusCStr(enumValue);
         }
 
       } // namespace ReprocessingStatusMapper
@@ -34,6 +34,11 @@ namespace BrokerAZDistributionMapper
 AWS_KAFKA_API BrokerAZDistribution GetBrokerAZDistributionForName(const Aws::String& name);
 
 AWS_KAFKA_API Aws::String GetNameForBrokerAZDistribution(BrokerAZDistribution value);
+
+/**
+ * Same as GetNameForBrokerAZDistribution(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KAFKA_API const char* GetNameForBrokerAZDistributionCStr(BrokerAZDistribution value);
 } // namespace BrokerAZDistributionMapper
 } // namespace Model
 } // namespace Kafka
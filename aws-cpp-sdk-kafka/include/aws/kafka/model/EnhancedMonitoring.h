@@ -36,6 +36,11 @@ namespace EnhancedMonitoringMapper
 AWS_KAFKA_API EnhancedMonitoring GetEnhancedMonitoringForName(const Aws::String& name);
 
 AWS_KAFKA_API Aws::String GetNameForEnhancedMonitoring(EnhancedMonitoring value);
+
+/**
+ * Same as GetNameForEnhancedMonitoring(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KAFKA_API const char* GetNameForEnhancedMonitoringCStr(EnhancedMonitoring value);
 } // namespace EnhancedMonitoringMapper
 } // namespace Model
 } // namespace Kafka
@@ -34,6 +34,11 @@ namespace NodeTypeMapper
 AWS_KAFKA_API NodeType GetNodeTypeForName(const Aws::String& name);
 
 AWS_KAFKA_API Aws::String GetNameForNodeType(NodeType value);
+
+/**
+ * Same as GetNameForNodeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KAFKA_API const char* GetNameForNodeTypeCStr(NodeType value);
 } // namespace NodeTypeMapper
 } // namespace Model
 } // namespace Kafka
@@ -30,15 +30,30 @@ namespace Aws
       namespace BrokerAZDistributionMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+        };
 
         BrokerAZDistribution GetBrokerAZDistributionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BrokerAZDistribution::DEFAULT;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return BrokerAZDistribution::DEFAULT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return BrokerAZDistribution::NOT_SET;
         }
 
-        Aws::String GetNameForBrokerAZDistribution(BrokerAZDistribution enumValue)
+        const char* GetNameForBrokerAZDistributionCStr(BrokerAZDistribution enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BrokerAZDistribution::DEFAULT:
-            return "DEFAULT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBrokerAZDistribution(BrokerAZDistribution enumValue)
+        {
+          return GetNameForBrokerAZDistributionCStr(enumValue);
         }
 
       } // namespace BrokerAZDistributionMapper
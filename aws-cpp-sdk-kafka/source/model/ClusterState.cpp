@@ -30,30 +30,51 @@ namespace Aws
       namespace ClusterStateMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "CREATING",
+          "DELETING",
+          "FAILED",
+        };
 
         ClusterState GetClusterStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return ClusterState::ACTIVE;
-          }
-          else if (hashCode == CREATING_HASH)
-          {
-            return ClusterState::CREATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ClusterState::DELETING;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClusterState::FAILED;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ClusterState::ACTIVE;
+            }
+            break;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return ClusterState::CREATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ClusterState::DELETING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ClusterState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ClusterState::NOT_SET;
         }
 
-        Aws::String GetNameForClusterState(ClusterState enumValue)
+        const char* GetNameForClusterStateCStr(ClusterState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClusterState::ACTIVE:
-            return "ACTIVE";
-          case ClusterState::CREATING:
-            return "CREATING";
-          case ClusterState::DELETING:
-            return "DELETING";
-          case ClusterState::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClusterState(ClusterState enumValue)
+        {
+          return GetNameForClusterStateCStr(enumValue);
         }
 
       } // namespace ClusterStateMapper
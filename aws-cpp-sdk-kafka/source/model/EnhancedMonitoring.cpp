@@ -30,25 +30,44 @@ namespace Aws
       namespace EnhancedMonitoringMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int PER_BROKER_HASH = HashingUtils::HashString("PER_BROKER");
-        static const int PER_TOPIC_PER_BROKER_HASH = HashingUtils::HashString("PER_TOPIC_PER_BROKER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "PER_BROKER",
+          "PER_TOPIC_PER_BROKER",
+        };
 
         EnhancedMonitoring GetEnhancedMonitoringForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return EnhancedMonitoring::DEFAULT;
-          }
-          else if (hashCode == PER_BROKER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EnhancedMonitoring::PER_BROKER;
-          }
-          else if (hashCode == PER_TOPIC_PER_BROKER_HASH)
-          {
-            return EnhancedMonitoring::PER_TOPIC_PER_BROKER;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return EnhancedMonitoring::DEFAULT;
+            }
+            break;
+          case -1438773925:
+            if (name == "PER_BROKER")
+            {
+              return EnhancedMonitoring::PER_BROKER;
+            }
+            break;
+          case -48478835:
+            if (name == "PER_TOPIC_PER_BROKER")
+            {
+              return EnhancedMonitoring::PER_TOPIC_PER_BROKER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EnhancedMonitoring::NOT_SET;
         }
 
-        Aws::String GetNameForEnhancedMonitoring(EnhancedMonitoring enumValue)
+        const char* GetNameForEnhancedMonitoringCStr(EnhancedMonitoring enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EnhancedMonitoring::DEFAULT:
-            return "DEFAULT";
-          case EnhancedMonitoring::PER_BROKER:
-            return "PER_BROKER";
-          case EnhancedMonitoring::PER_TOPIC_PER_BROKER:
-            return "PER_TOPIC_PER_BROKER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEnhancedMonitoring(EnhancedMonitoring enumValue)
+        {
+          return GetNameForEnhancedMonitoringCStr(enumValue);
         }
 
       } // namespace EnhancedMonitoringMapper
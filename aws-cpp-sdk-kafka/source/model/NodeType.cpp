@@ -30,15 +30,30 @@ namespace Aws
       namespace NodeTypeMapper
       {
 
-        static const int BROKER_HASH = HashingUtils::HashString("BROKER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BROKER",
+        };
 
         NodeType GetNodeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BROKER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NodeType::BROKER;
+          case 1967680473:
+            if (name == "BROKER")
+            {
+              return NodeType::BROKER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return NodeType::NOT_SET;
         }
 
-        Aws::String GetNameForNodeType(NodeType enumValue)
+        const char* GetNameForNodeTypeCStr(NodeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NodeType::BROKER:
-            return "BROKER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNodeType(NodeType enumValue)
+        {
+          return GetNameForNodeTypeCStr(enumValue);
         }
 
       } // namespace NodeTypeMapper
@@ -35,6 +35,11 @@ namespace DiscontinuityModeMapper
 AWS_KINESISVIDEOARCHIVEDMEDIA_API DiscontinuityMode GetDiscontinuityModeForName(const Aws::String& name);
 
 AWS_KINESISVIDEOARCHIVEDMEDIA_API Aws::String GetNameForDiscontinuityMode(DiscontinuityMode value);
+
+/**
+ * Same as GetNameForDiscontinuityMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISVIDEOARCHIVEDMEDIA_API const char* GetNameForDiscontinuityModeCStr(DiscontinuityMode value);
 } // namespace DiscontinuityModeMapper
 } // namespace Model
 } // namespace KinesisVideoArchivedMedia
@@ -35,6 +35,11 @@ namespace FragmentSelectorTypeMapper
 AWS_KINESISVIDEOARCHIVEDMEDIA_API FragmentSelectorType GetFragmentSelectorTypeForName(const Aws::String& name);
 
 AWS_KINESISVIDEOARCHIVEDMEDIA_API Aws::String GetNameForFragmentSelectorType(FragmentSelectorType value);
+
+/**
+ * Same as GetNameForFragmentSelectorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISVIDEOARCHIVEDMEDIA_API const char* GetNameForFragmentSelectorTypeCStr(FragmentSelectorType value);
 } // namespace FragmentSelectorTypeMapper
 } // namespace Model
 } // namespace KinesisVideoArchivedMedia
@@ -35,6 +35,11 @@ namespace HLSFragmentSelectorTypeMapper
 AWS_KINESISVIDEOARCHIVEDMEDIA_API HLSFragmentSelectorType GetHLSFragmentSelectorTypeForName(const Aws::String& name);
 
 AWS_KINESISVIDEOARCHIVEDMEDIA_API Aws::String GetNameForHLSFragmentSelectorType(HLSFragmentSelectorType value);
+
+/**
+ * Same as GetNameForHLSFragmentSelectorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISVIDEOARCHIVEDMEDIA_API const char* GetNameForHLSFragmentSelectorTypeCStr(HLSFragmentSelectorType value);
 } // namespace HLSFragmentSelectorTypeMapper
 } // namespace Model
 } // namespace KinesisVideoArchivedMedia
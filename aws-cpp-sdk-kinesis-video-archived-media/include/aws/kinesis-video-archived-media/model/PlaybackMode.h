@@ -35,6 +35,11 @@ namespace PlaybackModeMapper
 AWS_KINESISVIDEOARCHIVEDMEDIA_API PlaybackMode GetPlaybackModeForName(const Aws::String& name);
 
 AWS_KINESISVIDEOARCHIVEDMEDIA_API Aws::String GetNameForPlaybackMode(PlaybackMode value);
+
+/**
+ * Same as GetNameForPlaybackMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISVIDEOARCHIVEDMEDIA_API const char* GetNameForPlaybackModeCStr(PlaybackMode value);
 } // namespace PlaybackModeMapper
 } // namespace Model
 } // namespace KinesisVideoArchivedMedia
@@ -30,20 +30,37 @@ namespace Aws
       namespace DiscontinuityModeMapper
       {
 
-        static const int ALWAYS_HASH = HashingUtils::HashString("ALWAYS");
-        static const int NEVER_HASH = HashingUtils::HashString("NEVER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALWAYS",
+          "NEVER",
+        };
 
         DiscontinuityMode GetDiscontinuityModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALWAYS_HASH)
-          {
-            return DiscontinuityMode::ALWAYS;
-          }
-          else if (hashCode == NEVER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DiscontinuityMode::NEVER;
+          case 1933739535:
+            if (name == "ALWAYS")
+            {
+              return DiscontinuityMode::ALWAYS;
+            }
+            break;
+          case 74175084:
+            if (name == "NEVER")
+            {
+              return DiscontinuityMode::NEVER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DiscontinuityMode::NOT_SET;
         }
 
-        Aws::String GetNameForDiscontinuityMode(DiscontinuityMode enumValue)
+        const char* GetNameForDiscontinuityModeCStr(DiscontinuityMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DiscontinuityMode::ALWAYS:
-            return "ALWAYS";
-          case DiscontinuityMode::NEVER:
-            return "NEVER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDiscontinuityMode(DiscontinuityMode enumValue)
+        {
+          return GetNameForDiscontinuityModeCStr(enumValue);
         }
 
       } // namespace DiscontinuityModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FragmentSelectorTypeMapper
       {
 
-        static const int PRODUCER_TIMESTAMP_HASH = HashingUtils::HashString("PRODUCER_TIMESTAMP");
-        static const int SERVER_TIMESTAMP_HASH = HashingUtils::HashString("SERVER_TIMESTAMP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PRODUCER_TIMESTAMP",
+          "SERVER_TIMESTAMP",
+        };
 
         FragmentSelectorType GetFragmentSelectorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRODUCER_TIMESTAMP_HASH)
-          {
-            return FragmentSelectorType::PRODUCER_TIMESTAMP;
-          }
-          else if (hashCode == SERVER_TIMESTAMP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FragmentSelectorType::SERVER_TIMESTAMP;
+          case 1040131209:
+            if (name == "PRODUCER_TIMESTAMP")
+            {
+              return FragmentSelectorType::PRODUCER_TIMESTAMP;
+            }
+            break;
+          case -398303494:
+            if (name == "SERVER_TIMESTAMP")
+            {
+              return FragmentSelectorType::SERVER_TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FragmentSelectorType::NOT_SET;
         }
 
-        Aws::String GetNameForFragmentSelectorType(FragmentSelectorType enumValue)
+        const char* GetNameForFragmentSelectorTypeCStr(FragmentSelectorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FragmentSelectorType::PRODUCER_TIMESTAMP:
-            return "PRODUCER_TIMESTAMP";
-          case FragmentSelectorType::SERVER_TIMESTAMP:
-            return "SERVER_TIMESTAMP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFragmentSelectorType(FragmentSelectorType enumValue)
+        {
+          return GetNameForFragmentSelectorTypeCStr(enumValue);
         }
 
       } // namespace FragmentSelectorTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace HLSFragmentSelectorTypeMapper
       {
 
-        static const int PRODUCER_TIMESTAMP_HASH = HashingUtils::HashString("PRODUCER_TIMESTAMP");
-        static const int SERVER_TIMESTAMP_HASH = HashingUtils::HashString("SERVER_TIMESTAMP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PRODUCER_TIMESTAMP",
+          "SERVER_TIMESTAMP",
+        };
 
         HLSFragmentSelectorType GetHLSFragmentSelectorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRODUCER_TIMESTAMP_HASH)
-          {
-            return HLSFragmentSelectorType::PRODUCER_TIMESTAMP;
-          }
-          else if (hashCode == SERVER_TIMESTAMP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HLSFragmentSelectorType::SERVER_TIMESTAMP;
+          case 1040131209:
+            if (name == "PRODUCER_TIMESTAMP")
+            {
+              return HLSFragmentSelectorType::PRODUCER_TIMESTAMP;
+            }
+            break;
+          case -398303494:
+            if (name == "SERVER_TIMESTAMP")
+            {
+              return HLSFragmentSelectorType::SERVER_TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HLSFragmentSelectorType::NOT_SET;
         }
 
-        Aws::String GetNameForHLSFragmentSelectorType(HLSFragmentSelectorType enumValue)
+        const char* GetNameForHLSFragmentSelectorTypeCStr(HLSFragmentSelectorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HLSFragmentSelectorType::PRODUCER_TIMESTAMP:
-            return "PRODUCER_TIMESTAMP";
-          case HLSFragmentSelectorType::SERVER_TIMESTAMP:
-            return "SERVER_TIMESTAMP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHLSFragmentSelectorType(HLSFragmentSelectorType enumValue)
+        {
+          return GetNameForHLSFragmentSelectorTypeCStr(enumValue);
         }
 
       } // namespace HLSFragmentSelectorTypeMapper
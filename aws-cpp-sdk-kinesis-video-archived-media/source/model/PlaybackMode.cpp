@@ -30,20 +30,37 @@ namespace Aws
       namespace PlaybackModeMapper
       {
 
-        static const int LIVE_HASH = HashingUtils::HashString("LIVE");
-        static const int ON_DEMAND_HASH = HashingUtils::HashString("ON_DEMAND");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LIVE",
+          "ON_DEMAND",
+        };
 
         PlaybackMode GetPlaybackModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LIVE_HASH)
-          {
-            return PlaybackMode::LIVE;
-          }
-          else if (hashCode == ON_DEMAND_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlaybackMode::ON_DEMAND;
+          case 2337004:
+            if (name == "LIVE")
+            {
+              return PlaybackMode::LIVE;
+            }
+            break;
+          case -2128361301:
+            if (name == "ON_DEMAND")
+            {
+              return PlaybackMode::ON_DEMAND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PlaybackMode::NOT_SET;
         }
 
-        Aws::String GetNameForPlaybackMode(PlaybackMode enumValue)
+        const char* GetNameForPlaybackModeCStr(PlaybackMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlaybackMode::LIVE:
-            return "LIVE";
-          case PlaybackMode::ON_DEMAND:
-            return "ON_DEMAND";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlaybackMode(PlaybackMode enumValue)
+        {
+          return GetNameForPlaybackModeCStr(enumValue);
         }
 
       } // namespace PlaybackModeMapper
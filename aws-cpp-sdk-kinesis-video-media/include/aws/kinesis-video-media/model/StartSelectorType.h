@@ -39,6 +39,11 @@ namespace StartSelectorTypeMapper
 AWS_KINESISVIDEOMEDIA_API StartSelectorType GetStartSelectorTypeForName(const Aws::String& name);
 
 AWS_KINESISVIDEOMEDIA_API Aws::String GetNameForStartSelectorType(StartSelectorType value);
+
+/**
+ * Same as GetNameForStartSelectorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISVIDEOMEDIA_API const char* GetNameForStartSelectorTypeCStr(StartSelectorType value);
 } // namespace StartSelectorTypeMapper
 } // namespace Model
 } // namespace KinesisVideoMedia
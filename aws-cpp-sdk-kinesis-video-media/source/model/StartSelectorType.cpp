@@ -30,40 +30,65 @@ namespace Aws
       namespace StartSelectorTypeMapper
       {
 
-        static const int FRAGMENT_NUMBER_HASH = HashingUtils::HashString("FRAGMENT_NUMBER");
-        static const int SERVER_TIMESTAMP_HASH = HashingUtils::HashString("SERVER_TIMESTAMP");
-        static const int PRODUCER_TIMESTAMP_HASH = HashingUtils::HashString("PRODUCER_TIMESTAMP");
-        static const int NOW_HASH = HashingUtils::HashString("NOW");
-        static const int EARLIEST_HASH = HashingUtils::HashString("EARLIEST");
-        static const int CONTINUATION_TOKEN_HASH = HashingUtils::HashString("CONTINUATION_TOKEN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FRAGMENT_NUMBER",
+          "SERVER_TIMESTAMP",
+          "PRODUCER_TIMESTAMP",
+          "NOW",
+          "EARLIEST",
+          "CONTINUATION_TOKEN",
+        };
 
         StartSelectorType GetStartSelectorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FRAGMENT_NUMBER_HASH)
-          {
-            return StartSelectorType::FRAGMENT_NUMBER;
-          }
-          else if (hashCode == SERVER_TIMESTAMP_HASH)
-          {
-            return StartSelectorType::SERVER_TIMESTAMP;
-          }
-          else if (hashCode == PRODUCER_TIMESTAMP_HASH)
-          {
-            return StartSelectorType::PRODUCER_TIMESTAMP;
-          }
-          else if (hashCode == NOW_HASH)
-          {
-            return StartSelectorType::NOW;
-          }
-          else if (hashCode == EARLIEST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StartSelectorType::EARLIEST;
-          }
-          else if (hashCode == CONTINUATION_TOKEN_HASH)
-          {
-            return StartSelectorType::CONTINUATION_TOKEN;
+          case -1421819880:
+            if (name == "FRAGMENT_NUMBER")
+            {
+              return StartSelectorType::FRAGMENT_NUMBER;
+            }
+            break;
+          case -398303494:
+            if (name == "SERVER_TIMESTAMP")
+            {
+              return StartSelectorType::SERVER_TIMESTAMP;
+            }
+            break;
+          case 1040131209:
+            if (name == "PRODUCER_TIMESTAMP")
+            {
+              return StartSelectorType::PRODUCER_TIMESTAMP;
+            }
+            break;
+          case 77494:
+            if (name == "NOW")
+            {
+              return StartSelectorType::NOW;
+            }
+            break;
+          case -26952365:
+            if (name == "EARLIEST")
+            {
+              return StartSelectorType::EARLIEST;
+            }
+            break;
+          case 1080212945:
+            if (name == "CONTINUATION_TOKEN")
+            {
+              return StartSelectorType::CONTINUATION_TOKEN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return StartSelectorType::NOT_SET;
         }
 
-        Aws::String GetNameForStartSelectorType(StartSelectorType enumValue)
+        const char* GetNameForStartSelectorTypeCStr(StartSelectorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StartSelectorType::FRAGMENT_NUMBER:
-            return "FRAGMENT_NUMBER";
-          case StartSelectorType::SERVER_TIMESTAMP:
-            return "SERVER_TIMESTAMP";
-          case StartSelectorType::PRODUCER_TIMESTAMP:
-            return "PRODUCER_TIMESTAMP";
-          case StartSelectorType::NOW:
-            return "NOW";
-          case StartSelectorType::EARLIEST:
-            return "EARLIEST";
-          case StartSelectorType::CONTINUATION_TOKEN:
-            return "CONTINUATION_TOKEN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStartSelectorType(StartSelectorType enumValue)
+        {
+          return GetNameForStartSelectorTypeCStr(enumValue);
         }
 
       } // namespace StartSelectorTypeMapper
@@ -36,6 +36,11 @@ namespace ConsumerStatusMapper
 AWS_KINESIS_API ConsumerStatus GetConsumerStatusForName(const Aws::String& name);
 
 AWS_KINESIS_API Aws::String GetNameForConsumerStatus(ConsumerStatus value);
+
+/**
+ * Same as GetNameForConsumerStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESIS_API const char* GetNameForConsumerStatusCStr(ConsumerStatus value);
 } // namespace ConsumerStatusMapper
 } // namespace Model
 } // namespace Kinesis
@@ -35,6 +35,11 @@ namespace EncryptionTypeMapper
 AWS_KINESIS_API EncryptionType GetEncryptionTypeForName(const Aws::String& name);
 
 AWS_KINESIS_API Aws::String GetNameForEncryptionType(EncryptionType value);
+
+/**
+ * Same as GetNameForEncryptionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESIS_API const char* GetNameForEncryptionTypeCStr(EncryptionType value);
 } // namespace EncryptionTypeMapper
 } // namespace Model
 } // namespace Kinesis
@@ -41,6 +41,11 @@ namespace MetricsNameMapper
 AWS_KINESIS_API MetricsName GetMetricsNameForName(const Aws::String& name);
 
 AWS_KINESIS_API Aws::String GetNameForMetricsName(MetricsName value);
+
+/**
+ * Same as GetNameForMetricsName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESIS_API const char* GetNameForMetricsNameCStr(MetricsName value);
 } // namespace MetricsNameMapper
 } // namespace Model
 } // namespace Kinesis
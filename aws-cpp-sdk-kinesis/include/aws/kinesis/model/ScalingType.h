@@ -34,6 +34,11 @@ namespace ScalingTypeMapper
 AWS_KINESIS_API ScalingType GetScalingTypeForName(const Aws::String& name);
 
 AWS_KINESIS_API Aws::String GetNameForScalingType(ScalingType value);
+
+/**
+ * Same as GetNameForScalingType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESIS_API const char* GetNameForScalingTypeCStr(ScalingType value);
 } // namespace ScalingTypeMapper
 } // namespace Model
 } // namespace Kinesis
@@ -38,6 +38,11 @@ namespace ShardIteratorTypeMapper
 AWS_KINESIS_API ShardIteratorType GetShardIteratorTypeForName(const Aws::String& name);
 
 AWS_KINESIS_API Aws::String GetNameForShardIteratorType(ShardIteratorType value);
+
+/**
+ * Same as GetNameForShardIteratorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESIS_API const char* GetNameForShardIteratorTypeCStr(ShardIteratorType value);
 } // namespace ShardIteratorTypeMapper
 } // namespace Model
 } // namespace Kinesis
@@ -30,25 +30,44 @@ namespace Aws
       namespace ConsumerStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "DELETING",
+          "ACTIVE",
+        };
 
         ConsumerStatus GetConsumerStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return ConsumerStatus::CREATING;
-          }
-          else if (hashCode == DELETING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConsumerStatus::DELETING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return ConsumerStatus::ACTIVE;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return ConsumerStatus::CREATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ConsumerStatus::DELETING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ConsumerStatus::ACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ConsumerStatus::NOT_SET;
         }
 
-        Aws::String GetNameForConsumerStatus(ConsumerStatus enumValue)
+        const char* GetNameForConsumerStatusCStr(ConsumerStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConsumerStatus::CREATING:
-            return "CREATING";
-          case ConsumerStatus::DELETING:
-            return "DELETING";
-          case ConsumerStatus::ACTIVE:
-            return "ACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConsumerStatus(ConsumerStatus enumValue)
+        {
+          return GetNameForConsumerStatusCStr(enumValue);
         }
 
       } // namespace ConsumerStatusMapper
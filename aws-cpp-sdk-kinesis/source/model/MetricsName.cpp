@@ -30,50 +30,79 @@ namespace Aws
       namespace MetricsNameMapper
       {
 
-        static const int IncomingBytes_HASH = HashingUtils::HashString("IncomingBytes");
-        static const int IncomingRecords_HASH = HashingUtils::HashString("IncomingRecords");
-        static const int OutgoingBytes_HASH = HashingUtils::HashString("OutgoingBytes");
-        static const int OutgoingRecords_HASH = HashingUtils::HashString("OutgoingRecords");
-        static const int WriteProvisionedThroughputExceeded_HASH = HashingUtils::HashString("WriteProvisionedThroughputExceeded");
-        static const int ReadProvisionedThroughputExceeded_HASH = HashingUtils::HashString("ReadProvisionedThroughputExceeded");
-        static const int IteratorAgeMilliseconds_HASH = HashingUtils::HashString("IteratorAgeMilliseconds");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IncomingBytes",
+          "IncomingRecords",
+          "OutgoingBytes",
+          "OutgoingRecords",
+          "WriteProvisionedThroughputExceeded",
+          "ReadProvisionedThroughputExceeded",
+          "IteratorAgeMilliseconds",
+          "ALL",
+        };
 
         MetricsName GetMetricsNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IncomingBytes_HASH)
-          {
-            return MetricsName::IncomingBytes;
-          }
-          else if (hashCode == IncomingRecords_HASH)
-          {
-            return MetricsName::IncomingRecords;
-          }
-          else if (hashCode == OutgoingBytes_HASH)
-          {
-            return MetricsName::OutgoingBytes;
-          }
-          else if (hashCode == OutgoingRecords_HASH)
-          {
-            return MetricsName::OutgoingRecords;
-          }
-          else if (hashCode == WriteProvisionedThroughputExceeded_HASH)
-          {
-            return MetricsName::WriteProvisionedThroughputExceeded;
-          }
-          else if (hashCode == ReadProvisionedThroughputExceeded_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MetricsName::ReadProvisionedThroughputExceeded;
-          }
-          else if (hashCode == IteratorAgeMilliseconds_HASH)
-          {
-            return MetricsName::IteratorAgeMilliseconds;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return MetricsName::ALL;
+          case -49991739:
+            if (name == "IncomingBytes")
+            {
+              return MetricsName::IncomingBytes;
+            }
+            break;
+          case -70246628:
+            if (name == "IncomingRecords")
+            {
+              return MetricsName::IncomingRecords;
+            }
+            break;
+          case 861933631:
+            if (name == "OutgoingBytes")
+            {
+              return MetricsName::OutgoingBytes;
+            }
+            break;
+          case 116705558:
+            if (name == "OutgoingRecords")
+            {
+              return MetricsName::OutgoingRecords;
+            }
+            break;
+          case 129880946:
+            if (name == "WriteProvisionedThroughputExceeded")
+            {
+              return MetricsName::WriteProvisionedThroughputExceeded;
+            }
+            break;
+          case -666491685:
+            if (name == "ReadProvisionedThroughputExceeded")
+            {
+              return MetricsName::ReadProvisionedThroughputExceeded;
+            }
+            break;
+          case -2131747261:
+            if (name == "IteratorAgeMilliseconds")
+            {
+              return MetricsName::IteratorAgeMilliseconds;
+            }
+            break;
+          case 64897:
+            if (name == "ALL")
+            {
+              return MetricsName::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return MetricsName::NOT_SET;
         }
 
-        Aws::String GetNameForMetricsName(MetricsName enumValue)
+        const char* GetNameForMetricsNameCStr(MetricsName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MetricsName::IncomingBytes:
-            return "IncomingBytes";
-          case MetricsName::IncomingRecords:
-            return "IncomingRecords";
-          case MetricsName::OutgoingBytes:
-            return "OutgoingBytes";
-          case MetricsName::OutgoingRecords:
-            return "OutgoingRecords";
-          case MetricsName::WriteProvisionedThroughputExceeded:
-            return "WriteProvisionedThroughputExceeded";
-          case MetricsName::ReadProvisionedThroughputExceeded:
-            return "ReadProvisionedThroughputExceeded";
-          case MetricsName::IteratorAgeMilliseconds:
-            return "IteratorAgeMilliseconds";
-          case MetricsName::ALL:
-            return "ALL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMetricsName(MetricsName enumValue)
+        {
+          return GetNameForMetricsNameCStr(enumValue);
         }
 
       } // namespace MetricsNameMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ScalingTypeMapper
       {
 
-        static const int UNIFORM_SCALING_HASH = HashingUtils::HashString("UNIFORM_SCALING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNIFORM_SCALING",
+        };
 
         ScalingType GetScalingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNIFORM_SCALING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalingType::UNIFORM_SCALING;
+          case -1186086980:
+            if (name == "UNIFORM_SCALING")
+            {
+              return ScalingType::UNIFORM_SCALING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ScalingType::NOT_SET;
         }
 
-        Aws::String GetNameForScalingType(ScalingType enumValue)
+        const char* GetNameForScalingTypeCStr(ScalingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalingType::UNIFORM_SCALING:
-            return "UNIFORM_SCALING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalingType(ScalingType enumValue)
+        {
+          return GetNameForScalingTypeCStr(enumValue);
         }
 
       } // namespace ScalingTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace StreamStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "DELETING",
+          "ACTIVE",
+          "UPDATING",
+        };
 
         StreamStatus GetStreamStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return StreamStatus::CREATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return StreamStatus::DELETING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return StreamStatus::ACTIVE;
-          }
-          else if (hashCode == UPDATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StreamStatus::UPDATING;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return StreamStatus::CREATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return StreamStatus::DELETING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return StreamStatus::ACTIVE;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return StreamStatus::UPDATING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return StreamStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStreamStatus(StreamStatus enumValue)
+        const char* GetNameForStreamStatusCStr(StreamStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StreamStatus::CREATING:
-            return "CREATING";
-          case StreamStatus::DELETING:
-            return "DELETING";
-          case StreamStatus::ACTIVE:
-            return "ACTIVE";
-          case StreamStatus::UPDATING:
-            return "UPDATING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStreamStatus(StreamStatus enumValue)
+        {
+          return GetNameForStreamStatusCStr(enumValue);
         }
 
       } // namespace StreamStatusMapper
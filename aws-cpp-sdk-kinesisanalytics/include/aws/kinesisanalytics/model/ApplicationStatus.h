@@ -39,6 +39,11 @@ namespace ApplicationStatusMapper
 AWS_KINESISANALYTICS_API ApplicationStatus GetApplicationStatusForName(const Aws::String& name);
 
 AWS_KINESISANALYTICS_API Aws::String GetNameForApplicationStatus(ApplicationStatus value);
+
+/**
+ * Same as GetNameForApplicationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICS_API const char* GetNameForApplicationStatusCStr(ApplicationStatus value);
 } // namespace ApplicationStatusMapper
 } // namespace Model
 } // namespace KinesisAnalytics
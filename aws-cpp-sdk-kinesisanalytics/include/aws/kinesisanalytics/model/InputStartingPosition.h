@@ -36,6 +36,11 @@ namespace InputStartingPositionMapper
 AWS_KINESISANALYTICS_API InputStartingPosition GetInputStartingPositionForName(const Aws::String& name);
 
 AWS_KINESISANALYTICS_API Aws::String GetNameForInputStartingPosition(InputStartingPosition value);
+
+/**
+ * Same as GetNameForInputStartingPosition(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICS_API const char* GetNameForInputStartingPositionCStr(InputStartingPosition value);
 } // namespace InputStartingPositionMapper
 } // namespace Model
 } // namespace KinesisAnalytics
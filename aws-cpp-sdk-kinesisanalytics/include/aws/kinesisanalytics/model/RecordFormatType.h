@@ -35,6 +35,11 @@ namespace RecordFormatTypeMapper
 AWS_KINESISANALYTICS_API RecordFormatType GetRecordFormatTypeForName(const Aws::String& name);
 
 AWS_KINESISANALYTICS_API Aws::String GetNameForRecordFormatType(RecordFormatType value);
+
+/**
+ * Same as GetNameForRecordFormatType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICS_API const char* GetNameForRecordFormatTypeCStr(RecordFormatType value);
 } // namespace RecordFormatTypeMapper
 } // namespace Model
 } // namespace KinesisAnalytics
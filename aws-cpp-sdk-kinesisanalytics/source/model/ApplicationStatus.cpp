@@ -30,40 +30,65 @@ namespace Aws
       namespace ApplicationStatusMapper
       {
 
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DELETING",
+          "STARTING",
+          "STOPPING",
+          "READY",
+          "RUNNING",
+          "UPDATING",
+        };
 
         ApplicationStatus GetApplicationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DELETING_HASH)
-          {
-            return ApplicationStatus::DELETING;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return ApplicationStatus::STARTING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return ApplicationStatus::STOPPING;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return ApplicationStatus::READY;
-          }
-          else if (hashCode == RUNNING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ApplicationStatus::RUNNING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return ApplicationStatus::UPDATING;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ApplicationStatus::DELETING;
+            }
+            break;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return ApplicationStatus::STARTING;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return ApplicationStatus::STOPPING;
+            }
+            break;
+          case 77848963:
+            if (name == "READY")
+            {
+              return ApplicationStatus::READY;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return ApplicationStatus::RUNNING;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return ApplicationStatus::UPDATING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ApplicationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForApplicationStatus(ApplicationStatus enumValue)
+        const char* GetNameForApplicationStatusCStr(ApplicationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ApplicationStatus::DELETING:
-            return "DELETING";
-          case ApplicationStatus::STARTING:
-            return "STARTING";
-          case ApplicationStatus::STOPPING:
-            return "STOPPING";
-          case ApplicationStatus::READY:
-            return "READY";
-          case ApplicationStatus::RUNNING:
-            return "RUNNING";
-          case ApplicationStatus::UPDATING:
-            return "UPDATING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForApplicationStatus(ApplicationStatus enumValue)
+        {
+          return GetNameForApplicationStatusCStr(enumValue);
         }
 
       } // namespace ApplicationStatusMapper
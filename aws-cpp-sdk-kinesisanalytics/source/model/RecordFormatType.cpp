@@ -30,20 +30,37 @@ namespace Aws
       namespace RecordFormatTypeMapper
       {
 
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "JSON",
+          "CSV",
+        };
 
         RecordFormatType GetRecordFormatTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JSON_HASH)
-          {
-            return RecordFormatType::JSON;
-          }
-          else if (hashCode == CSV_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RecordFormatType::CSV;
+          case 2286824:
+            if (name == "JSON")
+            {
+              return RecordFormatType::JSON;
+            }
+            break;
+          case 67046:
+            if (name == "CSV")
+            {
+              return RecordFormatType::CSV;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RecordFormatType::NOT_SET;
         }
 
-        Aws::String GetNameForRecordFormatType(RecordFormatType enumValue)
+        const char* GetNameForRecordFormatTypeCStr(RecordFormatType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RecordFormatType::JSON:
-            return "JSON";
-          case RecordFormatType::CSV:
-            return "CSV";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRecordFormatType(RecordFormatType enumValue)
+        {
+          return GetNameForRecordFormatTypeCStr(enumValue);
         }
 
       } // namespace RecordFormatTypeMapper
@@ -36,6 +36,11 @@ namespace ApplicationRestoreTypeMapper
 AWS_KINESISANALYTICSV2_API ApplicationRestoreType GetApplicationRestoreTypeForName(const Aws::String& name);
 
 AWS_KINESISANALYTICSV2_API Aws::String GetNameForApplicationRestoreType(ApplicationRestoreType value);
+
+/**
+ * Same as GetNameForApplicationRestoreType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICSV2_API const char* GetNameForApplicationRestoreTypeCStr(ApplicationRestoreType value);
 } // namespace ApplicationRestoreTypeMapper
 } // namespace Model
 } // namespace KinesisAnalyticsV2
@@ -35,6 +35,11 @@ namespace CodeContentTypeMapper
 AWS_KINESISANALYTICSV2_API CodeContentType GetCodeContentTypeForName(const Aws::String& name);
 
 AWS_KINESISANALYTICSV2_API Aws::String GetNameForCodeContentType(CodeContentType value);
+
+/**
+ * Same as GetNameForCodeContentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICSV2_API const char* GetNameForCodeContentTypeCStr(CodeContentType value);
 } // namespace CodeContentTypeMapper
 } // namespace Model
 } // namespace KinesisAnalyticsV2
@@ -35,6 +35,11 @@ namespace ConfigurationTypeMapper
 AWS_KINESISANALYTICSV2_API ConfigurationType GetConfigurationTypeForName(const Aws::String& name);
 
 AWS_KINESISANALYTICSV2_API Aws::String GetNameForConfigurationType(ConfigurationType value);
+
+/**
+ * Same as GetNameForConfigurationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICSV2_API const char* GetNameForConfigurationTypeCStr(ConfigurationType value);
 } // namespace ConfigurationTypeMapper
 } // namespace Model
 } // namespace KinesisAnalyticsV2
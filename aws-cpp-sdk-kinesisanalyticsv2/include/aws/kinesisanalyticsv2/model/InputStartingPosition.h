@@ -36,6 +36,11 @@ namespace InputStartingPositionMapper
 AWS_KINESISANALYTICSV2_API InputStartingPosition GetInputStartingPositionForName(const Aws::String& name);
 
 AWS_KINESISANALYTICSV2_API Aws::String GetNameForInputStartingPosition(InputStartingPosition value);
+
+/**
+ * Same as GetNameForInputStartingPosition(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICSV2_API const char* GetNameForInputStartingPositionCStr(InputStartingPosition value);
 } // namespace InputStartingPositionMapper
 } // namespace Model
 } // namespace KinesisAnalyticsV2
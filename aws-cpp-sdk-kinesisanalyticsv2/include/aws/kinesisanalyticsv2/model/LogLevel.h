@@ -37,6 +37,11 @@ namespace LogLevelMapper
 AWS_KINESISANALYTICSV2_API LogLevel GetLogLevelForName(const Aws::String& name);
 
 AWS_KINESISANALYTICSV2_API Aws::String GetNameForLogLevel(LogLevel value);
+
+/**
+ * Same as GetNameForLogLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICSV2_API const char* GetNameForLogLevelCStr(LogLevel value);
 } // namespace LogLevelMapper
 } // namespace Model
 } // namespace KinesisAnalyticsV2
@@ -37,6 +37,11 @@ namespace MetricsLevelMapper
 AWS_KINESISANALYTICSV2_API MetricsLevel GetMetricsLevelForName(const Aws::String& name);
 
 AWS_KINESISANALYTICSV2_API Aws::String GetNameForMetricsLevel(MetricsLevel value);
+
+/**
+ * Same as GetNameForMetricsLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICSV2_API const char* GetNameForMetricsLevelCStr(MetricsLevel value);
 } // namespace MetricsLevelMapper
 } // namespace Model
 } // namespace KinesisAnalyticsV2
@@ -35,6 +35,11 @@ namespace RecordFormatTypeMapper
 AWS_KINESISANALYTICSV2_API RecordFormatType GetRecordFormatTypeForName(const Aws::String& name);
 
 AWS_KINESISANALYTICSV2_API Aws::String GetNameForRecordFormatType(RecordFormatType value);
+
+/**
+ * Same as GetNameForRecordFormatType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICSV2_API const char* GetNameForRecordFormatTypeCStr(RecordFormatType value);
 } // namespace RecordFormatTypeMapper
 } // namespace Model
 } // namespace KinesisAnalyticsV2
@@ -35,6 +35,11 @@ namespace RuntimeEnvironmentMapper
 AWS_KINESISANALYTICSV2_API RuntimeEnvironment GetRuntimeEnvironmentForName(const Aws::String& name);
 
 AWS_KINESISANALYTICSV2_API Aws::String GetNameForRuntimeEnvironment(RuntimeEnvironment value);
+
+/**
+ * Same as GetNameForRuntimeEnvironment(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICSV2_API const char* GetNameForRuntimeEnvironmentCStr(RuntimeEnvironment value);
 } // namespace RuntimeEnvironmentMapper
 } // namespace Model
 } // namespace KinesisAnalyticsV2
@@ -37,6 +37,11 @@ namespace SnapshotStatusMapper
 AWS_KINESISANALYTICSV2_API SnapshotStatus GetSnapshotStatusForName(const Aws::String& name);
 
 AWS_KINESISANALYTICSV2_API Aws::String GetNameForSnapshotStatus(SnapshotStatus value);
+
+/**
+ * Same as GetNameForSnapshotStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISANALYTICSV2_API const char* GetNameForSnapshotStatusCStr(SnapshotStatus value);
 } // namespace SnapshotStatusMapper
 } // namespace Model
 } // namespace KinesisAnalyticsV2
@@ -30,25 +30,44 @@ namespace Aws
       namespace ApplicationRestoreTypeMapper
       {
 
-        static const int SKIP_RESTORE_FROM_SNAPSHOT_HASH = HashingUtils::HashString("SKIP_RESTORE_FROM_SNAPSHOT");
-        static const int RESTORE_FROM_LATEST_SNAPSHOT_HASH = HashingUtils::HashString("RESTORE_FROM_LATEST_SNAPSHOT");
-        static const int RESTORE_FROM_CUSTOM_SNAPSHOT_HASH = HashingUtils::HashString("RESTORE_FROM_CUSTOM_SNAPSHOT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SKIP_RESTORE_FROM_SNAPSHOT",
+          "RESTORE_FROM_LATEST_SNAPSHOT",
+          "RESTORE_FROM_CUSTOM_SNAPSHOT",
+        };
 
         ApplicationRestoreType GetApplicationRestoreTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SKIP_RESTORE_FROM_SNAPSHOT_HASH)
-          {
-            return ApplicationRestoreType::SKIP_RESTORE_FROM_SNAPSHOT;
-          }
-          else if (hashCode == RESTORE_FROM_LATEST_SNAPSHOT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ApplicationRestoreType::RESTORE_FROM_LATEST_SNAPSHOT;
-          }
-          else if (hashCode == RESTORE_FROM_CUSTOM_SNAPSHOT_HASH)
-          {
-            return ApplicationRestoreType::RESTORE_FROM_CUSTOM_SNAPSHOT;
+          case 2145952744:
+            if (name == "SKIP_RESTORE_FROM_SNAPSHOT")
+            {
+              return ApplicationRestoreType::SKIP_RESTORE_FROM_SNAPSHOT;
+            }
+            break;
+          case -302777832:
+            if (name == "RESTORE_FROM_LATEST_SNAPSHOT")
+            {
+              return ApplicationRestoreType::RESTORE_FROM_LATEST_SNAPSHOT;
+            }
+            break;
+          case -303970962:
+            if (name == "RESTORE_FROM_CUSTOM_SNAPSHOT")
+            {
+              return ApplicationRestoreType::RESTORE_FROM_CUSTOM_SNAPSHOT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ApplicationRestoreType::NOT_SET;
         }
 
-        Aws::String GetNameForApplicationRestoreType(ApplicationRestoreType enumValue)
+        const char* GetNameForApplicationRestoreTypeCStr(ApplicationRestoreType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ApplicationRestoreType::SKIP_RESTORE_FROM_SNAPSHOT:
-            return "SKIP_RESTORE_FROM_SNAPSHOT";
-          case ApplicationRestoreType::RESTORE_FROM_LATEST_SNAPSHOT:
-            return "RESTORE_FROM_LATEST_SNAPSHOT";
-          case ApplicationRestoreType::RESTORE_FROM_CUSTOM_SNAPSHOT:
-            return "RESTORE_FROM_CUSTOM_SNAPSHOT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForApplicationRestoreType(ApplicationRestoreType enumValue)
+        {
+          return GetNameForApplicationRestoreTypeCStr(enumValue);
         }
 
       } // namespace ApplicationRestoreTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CodeContentTypeMapper
       {
 
-        static const int PLAINTEXT_HASH = HashingUtils::HashString("PLAINTEXT");
-        static const int ZIPFILE_HASH = HashingUtils::HashString("ZIPFILE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PLAINTEXT",
+          "ZIPFILE",
+        };
 
         CodeContentType GetCodeContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PLAINTEXT_HASH)
-          {
-            return CodeContentType::PLAINTEXT;
-          }
-          else if (hashCode == ZIPFILE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CodeContentType::ZIPFILE;
+          case 464861655:
+            if (name == "PLAINTEXT")
+            {
+              return CodeContentType::PLAINTEXT;
+            }
+            break;
+          case 436920317:
+            if (name == "ZIPFILE")
+            {
+              return CodeContentType::ZIPFILE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CodeContentType::NOT_SET;
         }
 
-        Aws::String GetNameForCodeContentType(CodeContentType enumValue)
+        const char* GetNameForCodeContentTypeCStr(CodeContentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CodeContentType::PLAINTEXT:
-            return "PLAINTEXT";
-          case CodeContentType::ZIPFILE:
-            return "ZIPFILE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCodeContentType(CodeContentType enumValue)
+        {
+          return GetNameForCodeContentTypeCStr(enumValue);
         }
 
       } // namespace CodeContentTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ConfigurationTypeMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int CUSTOM_HASH = HashingUtils::HashString("CUSTOM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "CUSTOM",
+        };
 
         ConfigurationType GetConfigurationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return ConfigurationType::DEFAULT;
-          }
-          else if (hashCode == CUSTOM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConfigurationType::CUSTOM;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return ConfigurationType::DEFAULT;
+            }
+            break;
+          case 1999208305:
+            if (name == "CUSTOM")
+            {
+              return ConfigurationType::CUSTOM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ConfigurationType::NOT_SET;
         }
 
-        Aws::String GetNameForConfigurationType(ConfigurationType enumValue)
+        const char* GetNameForConfigurationTypeCStr(ConfigurationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConfigurationType::DEFAULT:
-            return "DEFAULT";
-          case ConfigurationType::CUSTOM:
-            return "CUSTOM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConfigurationType(ConfigurationType enumValue)
+        {
+          return GetNameForConfigurationTypeCStr(enumValue);
         }
 
       } // namespace ConfigurationTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace InputStartingPositionMapper
       {
 
-        static const int NOW_HASH = HashingUtils::HashString("NOW");
-        static const int TRIM_HORIZON_HASH = HashingUtils::HashString("TRIM_HORIZON");
-        static const int LAST_STOPPED_POINT_HASH = HashingUtils::HashString("LAST_STOPPED_POINT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NOW",
+          "TRIM_HORIZON",
+          "LAST_STOPPED_POINT",
+        };
 
         InputStartingPosition GetInputStartingPositionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOW_HASH)
-          {
-            return InputStartingPosition::NOW;
-          }
-          else if (hashCode == TRIM_HORIZON_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputStartingPosition::TRIM_HORIZON;
-          }
-          else if (hashCode == LAST_STOPPED_POINT_HASH)
-          {
-            return InputStartingPosition::LAST_STOPPED_POINT;
+          case 77494:
+            if (name == "NOW")
+            {
+              return InputStartingPosition::NOW;
+            }
+            break;
+          case 1909941854:
+            if (name == "TRIM_HORIZON")
+            {
+              return InputStartingPosition::TRIM_HORIZON;
+            }
+            break;
+          case 1933067893:
+            if (name == "LAST_STOPPED_POINT")
+            {
+              return InputStartingPosition::LAST_STOPPED_POINT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InputStartingPosition::NOT_SET;
         }
 
-        Aws::String GetNameForInputStartingPosition(InputStartingPosition enumValue)
+        const char* GetNameForInputStartingPositionCStr(InputStartingPosition enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputStartingPosition::NOW:
-            return "NOW";
-          case InputStartingPosition::TRIM_HORIZON:
-            return "TRIM_HORIZON";
-          case InputStartingPosition::LAST_STOPPED_POINT:
-            return "LAST_STOPPED_POINT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputStartingPosition(InputStartingPosition enumValue)
+        {
+          return GetNameForInputStartingPositionCStr(enumValue);
         }
 
       } // namespace InputStartingPositionMapper
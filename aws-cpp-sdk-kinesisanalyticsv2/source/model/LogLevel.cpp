@@ -30,30 +30,51 @@ namespace Aws
       namespace LogLevelMapper
       {
 
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int WARN_HASH = HashingUtils::HashString("WARN");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INFO",
+          "WARN",
+          "ERROR",
+          "DEBUG",
+        };
 
         LogLevel GetLogLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INFO_HASH)
-          {
-            return LogLevel::INFO;
-          }
-          else if (hashCode == WARN_HASH)
-          {
-            return LogLevel::WARN;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return LogLevel::ERROR_;
-          }
-          else if (hashCode == DEBUG__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LogLevel::DEBUG_;
+          case 2251950:
+            if (name == "INFO")
+            {
+              return LogLevel::INFO;
+            }
+            break;
+          case 2656902:
+            if (name == "WARN")
+            {
+              return LogLevel::WARN;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return LogLevel::ERROR_;
+            }
+            break;
+          case 64921139:
+            if (name == "DEBUG")
+            {
+              return LogLevel::DEBUG_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return LogLevel::NOT_SET;
         }
 
-        Aws::String GetNameForLogLevel(LogLevel enumValue)
+        const char* GetNameForLogLevelCStr(LogLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LogLevel::INFO:
-            return "INFO";
-          case LogLevel::WARN:
-            return "WARN";
-          case LogLevel::ERROR_:
-            return "ERROR";
-          case LogLevel::DEBUG_:
-            return "DEBUG";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLogLevel(LogLevel enumValue)
+        {
+          return GetNameForLogLevelCStr(enumValue);
         }
 
       } // namespace LogLevelMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace MetricsLevelMapper
       {
 
-        static const int APPLICATION_HASH = HashingUtils::HashString("APPLICATION");
-        static const int TASK_HASH = HashingUtils::HashString("TASK");
-        static const int OPERATOR_HASH = HashingUtils::HashString("OPERATOR");
-        static const int PARALLELISM_HASH = HashingUtils::HashString("PARALLELISM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "APPLICATION",
+          "TASK",
+          "OPERATOR",
+          "PARALLELISM",
+        };
 
         MetricsLevel GetMetricsLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == APPLICATION_HASH)
-          {
-            return MetricsLevel::APPLICATION;
-          }
-          else if (hashCode == TASK_HASH)
-          {
-            return MetricsLevel::TASK;
-          }
-          else if (hashCode == OPERATOR_HASH)
-          {
-            return MetricsLevel::OPERATOR;
-          }
-          else if (hashCode == PARALLELISM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MetricsLevel::PARALLELISM;
+          case -587753168:
+            if (name == "APPLICATION")
+            {
+              return MetricsLevel::APPLICATION;
+            }
+            break;
+          case 2567557:
+            if (name == "TASK")
+            {
+              return MetricsLevel::TASK;
+            }
+            break;
+          case 282073252:
+            if (name == "OPERATOR")
+            {
+              return MetricsLevel::OPERATOR;
+            }
+            break;
+          case -1506841348:
+            if (name == "PARALLELISM")
+            {
+              return MetricsLevel::PARALLELISM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return MetricsLevel::NOT_SET;
         }
 
-        Aws::String GetNameForMetricsLevel(MetricsLevel enumValue)
+        const char* GetNameForMetricsLevelCStr(MetricsLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MetricsLevel::APPLICATION:
-            return "APPLICATION";
-          case MetricsLevel::TASK:
-            return "TASK";
-          case MetricsLevel::OPERATOR:
-            return "OPERATOR";
-          case MetricsLevel::PARALLELISM:
-            return "PARALLELISM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMetricsLevel(MetricsLevel enumValue)
+        {
+          return GetNameForMetricsLevelCStr(enumValue);
         }
 
       } // namespace MetricsLevelMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace RuntimeEnvironmentMapper
       {
 
-        static const int SQL_1_0_HASH = HashingUtils::HashString("SQL-1_0");
-        static const int FLINK_1_6_HASH = HashingUtils::HashString("FLINK-1_6");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SQL-1_0",
+          "FLINK-1_6",
+        };
 
         RuntimeEnvironment GetRuntimeEnvironmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SQL_1_0_HASH)
-          {
-            return RuntimeEnvironment::SQL_1_0;
-          }
-          else if (hashCode == FLINK_1_6_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RuntimeEnvironment::FLINK_1_6;
+          case -1256066301:
+            if (name == "SQL-1_0")
+            {
+              return RuntimeEnvironment::SQL_1_0;
+            }
+            break;
+          case 8826267:
+            if (name == "FLINK-1_6")
+            {
+              return RuntimeEnvironment::FLINK_1_6;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RuntimeEnvironment::NOT_SET;
         }
 
-        Aws::String GetNameForRuntimeEnvironment(RuntimeEnvironment enumValue)
+        const char* GetNameForRuntimeEnvironmentCStr(RuntimeEnvironment enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RuntimeEnvironment::SQL_1_0:
-            return "SQL-1_0";
-          case RuntimeEnvironment::FLINK_1_6:
-            return "FLINK-1_6";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRuntimeEnvironment(RuntimeEnvironment enumValue)
+        {
+          return GetNameForRuntimeEnvironmentCStr(enumValue);
         }
 
       } // namespace RuntimeEnvironmentMapper
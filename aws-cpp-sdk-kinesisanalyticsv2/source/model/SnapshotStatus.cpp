@@ -30,30 +30,51 @@ namespace Aws
       namespace SnapshotStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "READY",
+          "DELETING",
+          "FAILED",
+        };
 
         SnapshotStatus GetSnapshotStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return SnapshotStatus::CREATING;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return SnapshotStatus::READY;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return SnapshotStatus::DELETING;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SnapshotStatus::FAILED;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return SnapshotStatus::CREATING;
+            }
+            break;
+          case 77848963:
+            if (name == "READY")
+            {
+              return SnapshotStatus::READY;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return SnapshotStatus::DELETING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return SnapshotStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return SnapshotStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSnapshotStatus(SnapshotStatus enumValue)
+        const char* GetNameForSnapshotStatusCStr(SnapshotStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SnapshotStatus::CREATING:
-            return "CREATING";
-          case SnapshotStatus::READY:
-            return "READY";
-          case SnapshotStatus::DELETING:
-            return "DELETING";
-          case SnapshotStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSnapshotStatus(SnapshotStatus enumValue)
+        {
+          return GetNameForSnapshotStatusCStr(enumValue);
         }
 
       } // namespace SnapshotStatusMapper
@@ -38,6 +38,11 @@ namespace APINameMapper
 AWS_KINESISVIDEO_API APIName GetAPINameForName(const Aws::String& name);
 
 AWS_KINESISVIDEO_API Aws::String GetNameForAPIName(APIName value);
+
+/**
+ * Same as GetNameForAPIName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISVIDEO_API const char* GetNameForAPINameCStr(APIName value);
 } // namespace APINameMapper
 } // namespace Model
 } // namespace KinesisVideo
@@ -34,6 +34,11 @@ namespace ComparisonOperatorMapper
 AWS_KINESISVIDEO_API ComparisonOperator GetComparisonOperatorForName(const Aws::String& name);
 
 AWS_KINESISVIDEO_API Aws::String GetNameForComparisonOperator(ComparisonOperator value);
+
+/**
+ * Same as GetNameForComparisonOperator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISVIDEO_API const char* GetNameForComparisonOperatorCStr(ComparisonOperator value);
 } // namespace ComparisonOperatorMapper
 } // namespace Model
 } // namespace KinesisVideo
@@ -35,6 +35,11 @@ namespace UpdateDataRetentionOperationMapper
 AWS_KINESISVIDEO_API UpdateDataRetentionOperation GetUpdateDataRetentionOperationForName(const Aws::String& name);
 
 AWS_KINESISVIDEO_API Aws::String GetNameForUpdateDataRetentionOperation(UpdateDataRetentionOperation value);
+
+/**
+ * Same as GetNameForUpdateDataRetentionOperation(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KINESISVIDEO_API const char* GetNameForUpdateDataRetentionOperationCStr(UpdateDataRetentionOperation value);
 } // namespace UpdateDataRetentionOperationMapper
 } // namespace Model
 } // namespace KinesisVideo
@@ -30,35 +30,58 @@ namespace Aws
       namespace APINameMapper
       {
 
-        static const int PUT_MEDIA_HASH = HashingUtils::HashString("PUT_MEDIA");
-        static const int GET_MEDIA_HASH = HashingUtils::HashString("GET_MEDIA");
-        static const int LIST_FRAGMENTS_HASH = HashingUtils::HashString("LIST_FRAGMENTS");
-        static const int GET_MEDIA_FOR_FRAGMENT_LIST_HASH = HashingUtils::HashString("GET_MEDIA_FOR_FRAGMENT_LIST");
-        static const int GET_HLS_STREAMING_SESSION_URL_HASH = HashingUtils::HashString("GET_HLS_STREAMING_SESSION_URL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PUT_MEDIA",
+          "GET_MEDIA",
+          "LIST_FRAGMENTS",
+          "GET_MEDIA_FOR_FRAGMENT_LIST",
+          "GET_HLS_STREAMING_SESSION_URL",
+        };
 
         APIName GetAPINameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PUT_MEDIA_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return APIName::PUT_MEDIA;
-          }
-          else if (hashCode == GET_MEDIA_HASH)
-          {
-            return APIName::GET_MEDIA;
-          }
-          else if (hashCode == LIST_FRAGMENTS_HASH)
-          {
-            return APIName::LIST_FRAGMENTS;
-          }
-          else if (hashCode == GET_MEDIA_FOR_FRAGMENT_LIST_HASH)
-          {
-            return APIName::GET_MEDIA_FOR_FRAGMENT_LIST;
-          }
-          else if (hashCode == GET_HLS_STREAMING_SESSION_URL_HASH)
-          {
-            return APIName::GET_HLS_STREAMING_SESSION_URL;
+          case -718544268:
+            if (name == "PUT_MEDIA")
+            {
+              return APIName::PUT_MEDIA;
+            }
+            break;
+          case 548482427:
+            if (name == "GET_MEDIA")
+            {
+              return APIName::GET_MEDIA;
+            }
+            break;
+          case -823497310:
+            if (name == "LIST_FRAGMENTS")
+            {
+              return APIName::LIST_FRAGMENTS;
+            }
+            break;
+          case 955799123:
+            if (name == "GET_MEDIA_FOR_FRAGMENT_LIST")
+            {
+              return APIName::GET_MEDIA_FOR_FRAGMENT_LIST;
+            }
+            break;
+          case 194004816:
+            if (name == "GET_HLS_STREAMING_SESSION_URL")
+            {
+              return APIName::GET_HLS_STREAMING_SESSION_URL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return APIName::NOT_SET;
         }
 
-        Aws::String GetNameForAPIName(APIName enumValue)
+        const char* GetNameForAPINameCStr(APIName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case APIName::PUT_MEDIA:
-            return "PUT_MEDIA";
-          case APIName::GET_MEDIA:
-            return "GET_MEDIA";
-          case APIName::LIST_FRAGMENTS:
-            return "LIST_FRAGMENTS";
-          case APIName::GET_MEDIA_FOR_FRAGMENT_LIST:
-            return "GET_MEDIA_FOR_FRAGMENT_LIST";
-          case APIName::GET_HLS_STREAMING_SESSION_URL:
-            return "GET_HLS_STREAMING_SESSION_URL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAPIName(APIName enumValue)
+        {
+          return GetNameForAPINameCStr(enumValue);
         }
 
       } // namespace APINameMapper
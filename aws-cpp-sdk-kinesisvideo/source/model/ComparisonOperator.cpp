@@ -30,15 +30,30 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int BEGINS_WITH_HASH = HashingUtils::HashString("BEGINS_WITH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BEGINS_WITH",
+        };
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BEGINS_WITH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComparisonOperator::BEGINS_WITH;
+          case -1440886021:
+            if (name == "BEGINS_WITH")
+            {
+              return ComparisonOperator::BEGINS_WITH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperatorCStr(ComparisonOperator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComparisonOperator::BEGINS_WITH:
-            return "BEGINS_WITH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        {
+          return GetNameForComparisonOperatorCStr(enumValue);
         }
 
       } // namespace ComparisonOperatorMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "ACTIVE",
+          "UPDATING",
+          "DELETING",
+        };
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return Status::CREATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return Status::ACTIVE;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return Status::UPDATING;
-          }
-          else if (hashCode == DELETING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Status::DELETING;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return Status::CREATING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return Status::ACTIVE;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return Status::UPDATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return Status::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Status::NOT_SET;
         }
 
-        Aws::String GetNameForStatus(Status enumValue)
+        const char* GetNameForStatusCStr(Status enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Status::CREATING:
-            return "CREATING";
-          case Status::ACTIVE:
-            return "ACTIVE";
-          case Status::UPDATING:
-            return "UPDATING";
-          case Status::DELETING:
-            return "DELETING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatus(Status enumValue)
+        {
+          return GetNameForStatusCStr(enumValue);
         }
 
       } // namespace StatusMapper
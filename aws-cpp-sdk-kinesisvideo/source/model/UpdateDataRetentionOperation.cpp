@@ -30,20 +30,37 @@ namespace Aws
       namespace UpdateDataRetentionOperationMapper
       {
 
-        static const int INCREASE_DATA_RETENTION_HASH = HashingUtils::HashString("INCREASE_DATA_RETENTION");
-        static const int DECREASE_DATA_RETENTION_HASH = HashingUtils::HashString("DECREASE_DATA_RETENTION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INCREASE_DATA_RETENTION",
+          "DECREASE_DATA_RETENTION",
+        };
 
         UpdateDataRetentionOperation GetUpdateDataRetentionOperationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INCREASE_DATA_RETENTION_HASH)
-          {
-            return UpdateDataRetentionOperation::INCREASE_DATA_RETENTION;
-          }
-          else if (hashCode == DECREASE_DATA_RETENTION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UpdateDataRetentionOperation::DECREASE_DATA_RETENTION;
+          case 598554694:
+            if (name == "INCREASE_DATA_RETENTION")
+            {
+              return UpdateDataRetentionOperation::INCREASE_DATA_RETENTION;
+            }
+            break;
+          case -167662998:
+            if (name == "DECREASE_DATA_RETENTION")
+            {
+              return UpdateDataRetentionOperation::DECREASE_DATA_RETENTION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return UpdateDataRetentionOperation::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateDataRetentionOperation(UpdateDataRetentionOperation enumValue)
+        const char* GetNameForUpdateDataRetentionOperationCStr(UpdateDataRetentionOperation enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UpdateDataRetentionOperation::INCREASE_DATA_RETENTION:
-            return "INCREASE_DATA_RETENTION";
-          case UpdateDataRetentionOperation::DECREASE_DATA_RETENTION:
-            return "DECREASE_DATA_RETENTION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUpdateDataRetentionOperation(UpdateDataRetentionOperation enumValue)
+        {
+          return GetNameForUpdateDataRetentionOperationCStr(enumValue);
         }
 
       } // namespace UpdateDataRetentionOperationMapper
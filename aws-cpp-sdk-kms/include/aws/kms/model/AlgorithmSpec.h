@@ -36,6 +36,11 @@ namespace AlgorithmSpecMapper
 AWS_KMS_API AlgorithmSpec GetAlgorithmSpecForName(const Aws::String& name);
 
 AWS_KMS_API Aws::String GetNameForAlgorithmSpec(AlgorithmSpec value);
+
+/**
+ * Same as GetNameForAlgorithmSpec(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KMS_API const char* GetNameForAlgorithmSpecCStr(AlgorithmSpec value);
 } // namespace AlgorithmSpecMapper
 } // namespace Model
 } // namespace KMS
@@ -38,6 +38,11 @@ namespace ConnectionErrorCodeTypeMapper
 AWS_KMS_API ConnectionErrorCodeType GetConnectionErrorCodeTypeForName(const Aws::String& name);
 
 AWS_KMS_API Aws::String GetNameForConnectionErrorCodeType(ConnectionErrorCodeType value);
+
+/**
+ * Same as GetNameForConnectionErrorCodeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KMS_API const char* GetNameForConnectionErrorCodeTypeCStr(ConnectionErrorCodeType value);
 } // namespace ConnectionErrorCodeTypeMapper
 } // namespace Model
 } // namespace KMS
@@ -38,6 +38,11 @@ namespace ConnectionStateTypeMapper
 AWS_KMS_API ConnectionStateType GetConnectionStateTypeForName(const Aws::String& name);
 
 AWS_KMS_API Aws::String GetNameForConnectionStateType(ConnectionStateType value);
+
+/**
+ * Same as GetNameForConnectionStateType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KMS_API const char* GetNameForConnectionStateTypeCStr(ConnectionStateType value);
 } // namespace ConnectionStateTypeMapper
 } // namespace Model
 } // namespace KMS
@@ -35,6 +35,11 @@ namespace DataKeySpecMapper
 AWS_KMS_API DataKeySpec GetDataKeySpecForName(const Aws::String& name);
 
 AWS_KMS_API Aws::String GetNameForDataKeySpec(DataKeySpec value);
+
+/**
+ * Same as GetNameForDataKeySpec(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KMS_API const char* GetNameForDataKeySpecCStr(DataKeySpec value);
 } // namespace DataKeySpecMapper
 } // namespace Model
 } // namespace KMS
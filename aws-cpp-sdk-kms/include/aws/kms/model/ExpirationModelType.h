@@ -35,6 +35,11 @@ namespace ExpirationModelTypeMapper
 AWS_KMS_API ExpirationModelType GetExpirationModelTypeForName(const Aws::String& name);
 
 AWS_KMS_API Aws::String GetNameForExpirationModelType(ExpirationModelType value);
+
+/**
+ * Same as GetNameForExpirationModelType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KMS_API const char* GetNameForExpirationModelTypeCStr(ExpirationModelType value);
 } // namespace ExpirationModelTypeMapper
 } // namespace Model
 } // namespace KMS
@@ -42,6 +42,11 @@ namespace GrantOperationMapper
 AWS_KMS_API GrantOperation GetGrantOperationForName(const Aws::String& name);
 
 AWS_KMS_API Aws::String GetNameForGrantOperation(GrantOperation value);
+
+/**
+ * Same as GetNameForGrantOperation(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KMS_API const char* GetNameForGrantOperationCStr(GrantOperation value);
 } // namespace GrantOperationMapper
 } // namespace Model
 } // namespace KMS
@@ -35,6 +35,11 @@ namespace KeyManagerTypeMapper
 AWS_KMS_API KeyManagerType GetKeyManagerTypeForName(const Aws::String& name);
 
 AWS_KMS_API Aws::String GetNameForKeyManagerType(KeyManagerType value);
+
+/**
+ * Same as GetNameForKeyManagerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KMS_API const char* GetNameForKeyManagerTypeCStr(KeyManagerType value);
 } // namespace KeyManagerTypeMapper
 } // namespace Model
 } // namespace KMS
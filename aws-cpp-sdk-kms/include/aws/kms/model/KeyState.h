@@ -38,6 +38,11 @@ namespace KeyStateMapper
 AWS_KMS_API KeyState GetKeyStateForName(const Aws::String& name);
 
 AWS_KMS_API Aws::String GetNameForKeyState(KeyState value);
+
+/**
+ * Same as GetNameForKeyState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KMS_API const char* GetNameForKeyStateCStr(KeyState value);
 } // namespace KeyStateMapper
 } // namespace Model
 } // namespace KMS
@@ -34,6 +34,11 @@ namespace KeyUsageTypeMapper
 AWS_KMS_API KeyUsageType GetKeyUsageTypeForName(const Aws::String& name);
 
 AWS_KMS_API Aws::String GetNameForKeyUsageType(KeyUsageType value);
+
+/**
+ * Same as GetNameForKeyUsageType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KMS_API const char* GetNameForKeyUsageTypeCStr(KeyUsageType value);
 } // namespace KeyUsageTypeMapper
 } // namespace Model
 } // namespace KMS
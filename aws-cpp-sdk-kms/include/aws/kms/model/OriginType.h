@@ -36,6 +36,11 @@ namespace OriginTypeMapper
 AWS_KMS_API OriginType GetOriginTypeForName(const Aws::String& name);
 
 AWS_KMS_API Aws::String GetNameForOriginType(OriginType value);
+
+/**
+ * Same as GetNameForOriginType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KMS_API const char* GetNameForOriginTypeCStr(OriginType value);
 } // namespace OriginTypeMapper
 } // namespace Model
 } // namespace KMS
@@ -34,6 +34,11 @@ namespace WrappingKeySpecMapper
 AWS_KMS_API WrappingKeySpec GetWrappingKeySpecForName(const Aws::String& name);
 
 AWS_KMS_API Aws::String GetNameForWrappingKeySpec(WrappingKeySpec value);
+
+/**
+ * Same as GetNameForWrappingKeySpec(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_KMS_API const char* GetNameForWrappingKeySpecCStr(WrappingKeySpec value);
 } // namespace WrappingKeySpecMapper
 } // namespace Model
 } // namespace KMS
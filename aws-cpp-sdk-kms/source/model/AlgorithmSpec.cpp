@@ -30,25 +30,44 @@ namespace Aws
       namespace AlgorithmSpecMapper
       {
 
-        static const int RSAES_PKCS1_V1_5_HASH = HashingUtils::HashString("RSAES_PKCS1_V1_5");
-        static const int RSAES_OAEP_SHA_1_HASH = HashingUtils::HashString("RSAES_OAEP_SHA_1");
-        static const int RSAES_OAEP_SHA_256_HASH = HashingUtils::HashString("RSAES_OAEP_SHA_256");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RSAES_PKCS1_V1_5",
+          "RSAES_OAEP_SHA_1",
+          "RSAES_OAEP_SHA_256",
+        };
 
         AlgorithmSpec GetAlgorithmSpecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RSAES_PKCS1_V1_5_HASH)
-          {
-            return AlgorithmSpec::RSAES_PKCS1_V1_5;
-          }
-          else if (hashCode == RSAES_OAEP_SHA_1_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AlgorithmSpec::RSAES_OAEP_SHA_1;
-          }
-          else if (hashCode == RSAES_OAEP_SHA_256_HASH)
-          {
-            return AlgorithmSpec::RSAES_OAEP_SHA_256;
+          case 998787163:
+            if (name == "RSAES_PKCS1_V1_5")
+            {
+              return AlgorithmSpec::RSAES_PKCS1_V1_5;
+            }
+            break;
+          case -76424563:
+            if (name == "RSAES_OAEP_SHA_1")
+            {
+              return AlgorithmSpec::RSAES_OAEP_SHA_1;
+            }
+            break;
+          case -429558353:
+            if (name == "RSAES_OAEP_SHA_256")
+            {
+              return AlgorithmSpec::RSAES_OAEP_SHA_256;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AlgorithmSpec::NOT_SET;
         }
 
-        Aws::String GetNameForAlgorithmSpec(AlgorithmSpec enumValue)
+        const char* GetNameForAlgorithmSpecCStr(AlgorithmSpec enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AlgorithmSpec::RSAES_PKCS1_V1_5:
-            return "RSAES_PKCS1_V1_5";
-          case AlgorithmSpec::RSAES_OAEP_SHA_1:
-            return "RSAES_OAEP_SHA_1";
-          case AlgorithmSpec::RSAES_OAEP_SHA_256:
-            return "RSAES_OAEP_SHA_256";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAlgorithmSpec(AlgorithmSpec enumValue)
+        {
+          return GetNameForAlgorithmSpecCStr(enumValue);
         }
 
       } // namespace AlgorithmSpecMapper
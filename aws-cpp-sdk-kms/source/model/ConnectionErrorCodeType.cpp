@@ -30,35 +30,58 @@ namespace Aws
       namespace ConnectionErrorCodeTypeMapper
       {
 
-        static const int INVALID_CREDENTIALS_HASH = HashingUtils::HashString("INVALID_CREDENTIALS");
-        static const int CLUSTER_NOT_FOUND_HASH = HashingUtils::HashString("CLUSTER_NOT_FOUND");
-        static const int NETWORK_ERRORS_HASH = HashingUtils::HashString("NETWORK_ERRORS");
-        static const int INSUFFICIENT_CLOUDHSM_HSMS_HASH = HashingUtils::HashString("INSUFFICIENT_CLOUDHSM_HSMS");
-        static const int USER_LOCKED_OUT_HASH = HashingUtils::HashString("USER_LOCKED_OUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INVALID_CREDENTIALS",
+          "CLUSTER_NOT_FOUND",
+          "NETWORK_ERRORS",
+          "INSUFFICIENT_CLOUDHSM_HSMS",
+          "USER_LOCKED_OUT",
+        };
 
         ConnectionErrorCodeType GetConnectionErrorCodeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVALID_CREDENTIALS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectionErrorCodeType::INVALID_CREDENTIALS;
-          }
-          else if (hashCode == CLUSTER_NOT_FOUND_HASH)
-          {
-            return ConnectionErrorCodeType::CLUSTER_NOT_FOUND;
-          }
-          else if (hashCode == NETWORK_ERRORS_HASH)
-          {
-            return ConnectionErrorCodeType::NETWORK_ERRORS;
-          }
-          else if (hashCode == INSUFFICIENT_CLOUDHSM_HSMS_HASH)
-          {
-            return ConnectionErrorCodeType::INSUFFICIENT_CLOUDHSM_HSMS;
-          }
-          else if (hashCode == USER_LOCKED_OUT_HASH)
-          {
-            return ConnectionErrorCodeType::USER_LOCKED_OUT;
+          case -976517004:
+            if (name == "INVALID_CREDENTIALS")
+            {
+              return ConnectionErrorCodeType::INVALID_CREDENTIALS;
+            }
+            break;
+          case 266710705:
+            if (name == "CLUSTER_NOT_FOUND")
+            {
+              return ConnectionErrorCodeType::CLUSTER_NOT_FOUND;
+            }
+            break;
+          case -1504891204:
+            if (name == "NETWORK_ERRORS")
+            {
+              return ConnectionErrorCodeType::NETWORK_ERRORS;
+            }
+            break;
+          case 533891911:
+            if (name == "INSUFFICIENT_CLOUDHSM_HSMS")
+            {
+              return ConnectionErrorCodeType::INSUFFICIENT_CLOUDHSM_HSMS;
+            }
+            break;
+          case -2117097107:
+            if (name == "USER_LOCKED_OUT")
+            {
+              return ConnectionErrorCodeType::USER_LOCKED_OUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ConnectionErrorCodeType::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionErrorCodeType(ConnectionErrorCodeType enumValue)
+        const char* GetNameForConnectionErrorCodeTypeCStr(ConnectionErrorCodeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectionErrorCodeType::INVALID_CREDENTIALS:
-            return "INVALID_CREDENTIALS";
-          case ConnectionErrorCodeType::CLUSTER_NOT_FOUND:
-            return "CLUSTER_NOT_FOUND";
-          case ConnectionErrorCodeType::NETWORK_ERRORS:
-            return "NETWORK_ERRORS";
-          case ConnectionErrorCodeType::INSUFFICIENT_CLOUDHSM_HSMS:
-            return "INSUFFICIENT_CLOUDHSM_HSMS";
-          case ConnectionErrorCodeType::USER_LOCKED_OUT:
-            return "USER_LOCKED_OUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectionErrorCodeType(ConnectionErrorCodeType enumValue)
+        {
+          return GetNameForConnectionErrorCodeTypeCStr(enumValue);
         }
 
       } // namespace ConnectionErrorCodeTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ConnectionStateTypeMapper
       {
 
-        static const int CONNECTED_HASH = HashingUtils::HashString("CONNECTED");
-        static const int CONNECTING_HASH = HashingUtils::HashString("CONNECTING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int DISCONNECTED_HASH = HashingUtils::HashString("DISCONNECTED");
-        static const int DISCONNECTING_HASH = HashingUtils::HashString("DISCONNECTING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONNECTED",
+          "CONNECTING",
+          "FAILED",
+          "DISCONNECTED",
+          "DISCONNECTING",
+        };
 
         ConnectionStateType GetConnectionStateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONNECTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectionStateType::CONNECTED;
-          }
-          else if (hashCode == CONNECTING_HASH)
-          {
-            return ConnectionStateType::CONNECTING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ConnectionStateType::FAILED;
-          }
-          else if (hashCode == DISCONNECTED_HASH)
-          {
-            return ConnectionStateType::DISCONNECTED;
-          }
-          else if (hashCode == DISCONNECTING_HASH)
-          {
-            return ConnectionStateType::DISCONNECTING;
+          case -2087582999:
+            if (name == "CONNECTED")
+            {
+              return ConnectionStateType::CONNECTED;
+            }
+            break;
+          case -290559304:
+            if (name == "CONNECTING")
+            {
+              return ConnectionStateType::CONNECTING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ConnectionStateType::FAILED;
+            }
+            break;
+          case 935892539:
+            if (name == "DISCONNECTED")
+            {
+              return ConnectionStateType::DISCONNECTED;
+            }
+            break;
+          case -1052098138:
+            if (name == "DISCONNECTING")
+            {
+              return ConnectionStateType::DISCONNECTING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ConnectionStateType::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionStateType(ConnectionStateType enumValue)
+        const char* GetNameForConnectionStateTypeCStr(ConnectionStateType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectionStateType::CONNECTED:
-            return "CONNECTED";
-          case ConnectionStateType::CONNECTING:
-            return "CONNECTING";
-          case ConnectionStateType::FAILED:
-            return "FAILED";
-          case ConnectionStateType::DISCONNECTED:
-            return "DISCONNECTED";
-          case ConnectionStateType::DISCONNECTING:
-            return "DISCONNECTING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectionStateType(ConnectionStateType enumValue)
+        {
+          return GetNameForConnectionStateTypeCStr(enumValue);
         }
 
       } // namespace ConnectionStateTypeMapper
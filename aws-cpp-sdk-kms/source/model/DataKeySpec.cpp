@@ -30,20 +30,37 @@ namespace Aws
       namespace DataKeySpecMapper
       {
 
-        static const int AES_256_HASH = HashingUtils::HashString("AES_256");
-        static const int AES_128_HASH = HashingUtils::HashString("AES_128");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AES_256",
+          "AES_128",
+        };
 
         DataKeySpec GetDataKeySpecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES_256_HASH)
-          {
-            return DataKeySpec::AES_256;
-          }
-          else if (hashCode == AES_128_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DataKeySpec::AES_128;
+          case -386859325:
+            if (name == "AES_256")
+            {
+              return DataKeySpec::AES_256;
+            }
+            break;
+          case -386860377:
+            if (name == "AES_128")
+            {
+              return DataKeySpec::AES_128;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DataKeySpec::NOT_SET;
         }
 
-        Aws::String GetNameForDataKeySpec(DataKeySpec enumValue)
+        const char* GetNameForDataKeySpecCStr(DataKeySpec enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DataKeySpec::AES_256:
-            return "AES_256";
-          case DataKeySpec::AES_128:
-            return "AES_128";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDataKeySpec(DataKeySpec enumValue)
+        {
+          return GetNameForDataKeySpecCStr(enumValue);
         }
 
       } // namespace DataKeySpecMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ExpirationModelTypeMapper
       {
 
-        static const int KEY_MATERIAL_EXPIRES_HASH = HashingUtils::HashString("KEY_MATERIAL_EXPIRES");
-        static const int KEY_MATERIAL_DOES_NOT_EXPIRE_HASH = HashingUtils::HashString("KEY_MATERIAL_DOES_NOT_EXPIRE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "KEY_MATERIAL_EXPIRES",
+          "KEY_MATERIAL_DOES_NOT_EXPIRE",
+        };
 
         ExpirationModelType GetExpirationModelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == KEY_MATERIAL_EXPIRES_HASH)
-          {
-            return ExpirationModelType::KEY_MATERIAL_EXPIRES;
-          }
-          else if (hashCode == KEY_MATERIAL_DOES_NOT_EXPIRE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExpirationModelType::KEY_MATERIAL_DOES_NOT_EXPIRE;
+          case 19545596:
+            if (name == "KEY_MATERIAL_EXPIRES")
+            {
+              return ExpirationModelType::KEY_MATERIAL_EXPIRES;
+            }
+            break;
+          case 1121003673:
+            if (name == "KEY_MATERIAL_DOES_NOT_EXPIRE")
+            {
+              return ExpirationModelType::KEY_MATERIAL_DOES_NOT_EXPIRE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ExpirationModelType::NOT_SET;
         }
 
-        Aws::String GetNameForExpirationModelType(ExpirationModelType enumValue)
+        const char* GetNameForExpirationModelTypeCStr(ExpirationModelType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExpirationModelType::KEY_MATERIAL_EXPIRES:
-            return "KEY_MATERIAL_EXPIRES";
-          case ExpirationModelType::KEY_MATERIAL_DOES_NOT_EXPIRE:
-            return "KEY_MATERIAL_DOES_NOT_EXPIRE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExpirationModelType(ExpirationModelType enumValue)
+        {
+          return GetNameForExpirationModelTypeCStr(enumValue);
         }
 
       } // namespace ExpirationModelTypeMapper
@@ -30,55 +30,86 @@ namespace Aws
       namespace GrantOperationMapper
       {
 
-        static const int Decrypt_HASH = HashingUtils::HashString("Decrypt");
-        static const int Encrypt_HASH = HashingUtils::HashString("Encrypt");
-        static const int GenerateDataKey_HASH = HashingUtils::HashString("GenerateDataKey");
-        static const int GenerateDataKeyWithoutPlaintext_HASH = HashingUtils::HashString("GenerateDataKeyWithoutPlaintext");
-        static const int ReEncryptFrom_HASH = HashingUtils::HashString("ReEncryptFrom");
-        static const int ReEncryptTo_HASH = HashingUtils::HashString("ReEncryptTo");
-        static const int CreateGrant_HASH = HashingUtils::HashString("CreateGrant");
-        static const int RetireGrant_HASH = HashingUtils::HashString("RetireGrant");
-        static const int DescribeKey_HASH = HashingUtils::HashString("DescribeKey");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Decrypt",
+          "Encrypt",
+          "GenerateDataKey",
+          "GenerateDataKeyWithoutPlaintext",
+          "ReEncryptFrom",
+          "ReEncryptTo",
+          "CreateGrant",
+          "RetireGrant",
+          "DescribeKey",
+        };
 
         GrantOperation GetGrantOperationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Decrypt_HASH)
-          {
-            return GrantOperation::Decrypt;
-          }
-          else if (hashCode == Encrypt_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GrantOperation::Encrypt;
-          }
-          else if (hashCode == GenerateDataKey_HASH)
-          {
-            return GrantOperation::GenerateDataKey;
-          }
-          else if (hashCode == GenerateDataKeyWithoutPlaintext_HASH)
-          {
-            return GrantOperation::GenerateDataKeyWithoutPlaintext;
-          }
-          else if (hashCode == ReEncryptFrom_HASH)
-          {
-            return GrantOperation::ReEncryptFrom;
-          }
-          else if (hashCode == ReEncryptTo_HASH)
-          {
-            return GrantOperation::ReEncryptTo;
-          }
-          else if (hashCode == CreateGrant_HASH)
-          {
-            return GrantOperation::CreateGrant;
-          }
-          else if (hashCode == RetireGrant_HASH)
-          {
-            return GrantOperation::RetireGrant;
-          }
-          else if (hashCode == DescribeKey_HASH)
-          {
-            return GrantOperation::DescribeKey;
+          case -1087770259:
+            if (name == "Decrypt")
+            {
+              return GrantOperation::Decrypt;
+            }
+            break;
+          case 57395781:
+            if (name == "Encrypt")
+            {
+              return GrantOperation::Encrypt;
+            }
+            break;
+          case 1333803776:
+            if (name == "GenerateDataKey")
+            {
+              return GrantOperation::GenerateDataKey;
+            }
+            break;
+          case 936913199:
+            if (name == "GenerateDataKeyWithoutPlaintext")
+            {
+              return GrantOperation::GenerateDataKeyWithoutPlaintext;
+            }
+            break;
+          case -411893924:
+            if (name == "ReEncryptFrom")
+            {
+              return GrantOperation::ReEncryptFrom;
+            }
+            break;
+          case -371377491:
+            if (name == "ReEncryptTo")
+            {
+              return GrantOperation::ReEncryptTo;
+            }
+            break;
+          case 1152062816:
+            if (name == "CreateGrant")
+            {
+              return GrantOperation::CreateGrant;
+            }
+            break;
+          case 462832033:
+            if (name == "RetireGrant")
+            {
+              return GrantOperation::RetireGrant;
+            }
+            break;
+          case -70082700:
+            if (name == "DescribeKey")
+            {
+              return GrantOperation::DescribeKey;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return GrantOperation::NOT_SET;
         }
 
-        Aws::String GetNameForGrantOperation(GrantOperation enumValue)
+        const char* GetNameForGrantOperationCStr(GrantOperation enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GrantOperation::Decrypt:
-            return "Decrypt";
-          case GrantOperation::Encrypt:
-            return "Encrypt";
-          case GrantOperation::GenerateDataKey:
-            return "GenerateDataKey";
-          case GrantOperation::GenerateDataKeyWithoutPlaintext:
-            return "GenerateDataKeyWithoutPlaintext";
-          case GrantOperation::ReEncryptFrom:
-            return "ReEncryptFrom";
-          case GrantOperation::ReEncryptTo:
-            return "ReEncryptTo";
-          case GrantOperation::CreateGrant:
-            return "CreateGrant";
-          case GrantOperation::RetireGrant:
-            return "RetireGrant";
-          case GrantOperation::DescribeKey:
-            return "DescribeKey";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGrantOperation(GrantOperation enumValue)
+        {
+          return GetNameForGrantOperationCStr(enumValue);
         }
 
       } // namespace GrantOperationMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace KeyManagerTypeMapper
       {
 
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int CUSTOMER_HASH = HashingUtils::HashString("CUSTOMER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AWS",
+          "CUSTOMER",
+        };
 
         KeyManagerType GetKeyManagerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_HASH)
-          {
-            return KeyManagerType::AWS;
-          }
-          else if (hashCode == CUSTOMER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return KeyManagerType::CUSTOMER;
+          case 65245:
+            if (name == "AWS")
+            {
+              return KeyManagerType::AWS;
+            }
+            break;
+          case 1388802014:
+            if (name == "CUSTOMER")
+            {
+              return KeyManagerType::CUSTOMER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return KeyManagerType::NOT_SET;
         }
 
-        Aws::String GetNameForKeyManagerType(KeyManagerType enumValue)
+        const char* GetNameForKeyManagerTypeCStr(KeyManagerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case KeyManagerType::AWS:
-            return "AWS";
-          case KeyManagerType::CUSTOMER:
-            return "CUSTOMER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForKeyManagerType(KeyManagerType enumValue)
+        {
+          return GetNameForKeyManagerTypeCStr(enumValue);
         }
 
       } // namespace KeyManagerTypeMapper
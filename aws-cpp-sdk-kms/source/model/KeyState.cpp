@@ -30,35 +30,58 @@ namespace Aws
       namespace KeyStateMapper
       {
 
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-        static const int Disabled_HASH = HashingUtils::HashString("Disabled");
-        static const int PendingDeletion_HASH = HashingUtils::HashString("PendingDeletion");
-        static const int PendingImport_HASH = HashingUtils::HashString("PendingImport");
-        static const int Unavailable_HASH = HashingUtils::HashString("Unavailable");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Enabled",
+          "Disabled",
+          "PendingDeletion",
+          "PendingImport",
+          "Unavailable",
+        };
 
         KeyState GetKeyStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enabled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return KeyState::Enabled;
-          }
-          else if (hashCode == Disabled_HASH)
-          {
-            return KeyState::Disabled;
-          }
-          else if (hashCode == PendingDeletion_HASH)
-          {
-            return KeyState::PendingDeletion;
-          }
-          else if (hashCode == PendingImport_HASH)
-          {
-            return KeyState::PendingImport;
-          }
-          else if (hashCode == Unavailable_HASH)
-          {
-            return KeyState::Unavailable;
+          case 55059233:
+            if (name == "Enabled")
+            {
+              return KeyState::Enabled;
+            }
+            break;
+          case 335584924:
+            if (name == "Disabled")
+            {
+              return KeyState::Disabled;
+            }
+            break;
+          case -1805778331:
+            if (name == "PendingDeletion")
+            {
+              return KeyState::PendingDeletion;
+            }
+            break;
+          case 926436348:
+            if (name == "PendingImport")
+            {
+              return KeyState::PendingImport;
+            }
+            break;
+          case 1002405936:
+            if (name == "Unavailable")
+            {
+              return KeyState::Unavailable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return KeyState::NOT_SET;
         }
 
-        Aws::String GetNameForKeyState(KeyState enumValue)
+        const char* GetNameForKeyStateCStr(KeyState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case KeyState::Enabled:
-            return "Enabled";
-          case KeyState::Disabled:
-            return "Disabled";
-          case KeyState::PendingDeletion:
-            return "PendingDeletion";
-          case KeyState::PendingImport:
-            return "PendingImport";
-          case KeyState::Unavailable:
-            return "Unavailable";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForKeyState(KeyState enumValue)
+        {
+          return GetNameForKeyStateCStr(enumValue);
         }
 
       } // namespace KeyStateMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace KeyUsageTypeMapper
       {
 
-        static const int ENCRYPT_DECRYPT_HASH = HashingUtils::HashString("ENCRYPT_DECRYPT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENCRYPT_DECRYPT",
+        };
 
         KeyUsageType GetKeyUsageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENCRYPT_DECRYPT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return KeyUsageType::ENCRYPT_DECRYPT;
+          case -1054919309:
+            if (name == "ENCRYPT_DECRYPT")
+            {
+              return KeyUsageType::ENCRYPT_DECRYPT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return KeyUsageType::NOT_SET;
         }
 
-        Aws::String GetNameForKeyUsageType(KeyUsageType enumValue)
+        const char* GetNameForKeyUsageTypeCStr(KeyUsageType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case KeyUsageType::ENCRYPT_DECRYPT:
-            return "ENCRYPT_DECRYPT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForKeyUsageType(KeyUsageType enumValue)
+        {
+          return GetNameForKeyUsageTypeCStr(enumValue);
         }
 
       } // namespace KeyUsageTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace OriginTypeMapper
       {
 
-        static const int AWS_KMS_HASH = HashingUtils::HashString("AWS_KMS");
-        static const int EXTERNAL_HASH = HashingUtils::HashString("EXTERNAL");
-        static const int AWS_CLOUDHSM_HASH = HashingUtils::HashString("AWS_CLOUDHSM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AWS_KMS",
+          "EXTERNAL",
+          "AWS_CLOUDHSM",
+        };
 
         OriginType GetOriginTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_KMS_HASH)
-          {
-            return OriginType::AWS_KMS;
-          }
-          else if (hashCode == EXTERNAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OriginType::EXTERNAL;
-          }
-          else if (hashCode == AWS_CLOUDHSM_HASH)
-          {
-            return OriginType::AWS_CLOUDHSM;
+          case 128490191:
+            if (name == "AWS_KMS")
+            {
+              return OriginType::AWS_KMS;
+            }
+            break;
+          case -1038134325:
+            if (name == "EXTERNAL")
+            {
+              return OriginType::EXTERNAL;
+            }
+            break;
+          case 921541007:
+            if (name == "AWS_CLOUDHSM")
+            {
+              return OriginType::AWS_CLOUDHSM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return OriginType::NOT_SET;
         }
 
-        Aws::String GetNameForOriginType(OriginType enumValue)
+        const char* GetNameForOriginTypeCStr(OriginType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OriginType::AWS_KMS:
-            return "AWS_KMS";
-          case OriginType::EXTERNAL:
-            return "EXTERNAL";
-          case OriginType::AWS_CLOUDHSM:
-            return "AWS_CLOUDHSM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOriginType(OriginType enumValue)
+        {
+          return GetNameForOriginTypeCStr(enumValue);
         }
 
       } // namespace OriginTypeMapper
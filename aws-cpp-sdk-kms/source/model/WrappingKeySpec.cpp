@@ -30,15 +30,30 @@ namespace Aws
       namespace WrappingKeySpecMapper
       {
 
-        static const int RSA_2048_HASH = HashingUtils::HashString("RSA_2048");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RSA_2048",
+        };
 
         WrappingKeySpec GetWrappingKeySpecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RSA_2048_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WrappingKeySpec::RSA_2048;
+          case -519912447:
+            if (name == "RSA_2048")
+            {
+              return WrappingKeySpec::RSA_2048;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return WrappingKeySpec::NOT_SET;
         }
 
-        Aws::String GetNameForWrappingKeySpec(WrappingKeySpec enumValue)
+        const char* GetNameForWrappingKeySpecCStr(WrappingKeySpec enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WrappingKeySpec::RSA_2048:
-            return "RSA_2048";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWrappingKeySpec(WrappingKeySpec enumValue)
+        {
+          return GetNameForWrappingKeySpecCStr(enumValue);
         }
 
       } // namespace WrappingKeySpecMapper
@@ -36,6 +36,11 @@ namespace EventSourcePositionMapper
 AWS_LAMBDA_API EventSourcePosition GetEventSourcePositionForName(const Aws::String& name);
 
 AWS_LAMBDA_API Aws::String GetNameForEventSourcePosition(EventSourcePosition value);
+
+/**
+ * Same as GetNameForEventSourcePosition(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LAMBDA_API const char* GetNameForEventSourcePositionCStr(EventSourcePosition value);
 } // namespace EventSourcePositionMapper
 } // namespace Model
 } // namespace Lambda
@@ -34,6 +34,11 @@ namespace FunctionVersionMapper
 AWS_LAMBDA_API FunctionVersion GetFunctionVersionForName(const Aws::String& name);
 
 AWS_LAMBDA_API Aws::String GetNameForFunctionVersion(FunctionVersion value);
+
+/**
+ * Same as GetNameForFunctionVersion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LAMBDA_API const char* GetNameForFunctionVersionCStr(FunctionVersion value);
 } // namespace FunctionVersionMapper
 } // namespace Model
 } // namespace Lambda
@@ -36,6 +36,11 @@ namespace InvocationTypeMapper
 AWS_LAMBDA_API InvocationType GetInvocationTypeForName(const Aws::String& name);
 
 AWS_LAMBDA_API Aws::String GetNameForInvocationType(InvocationType value);
+
+/**
+ * Same as GetNameForInvocationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LAMBDA_API const char* GetNameForInvocationTypeCStr(InvocationType value);
 } // namespace InvocationTypeMapper
 } // namespace Model
 } // namespace Lambda
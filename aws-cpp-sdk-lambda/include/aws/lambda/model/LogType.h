@@ -35,6 +35,11 @@ namespace LogTypeMapper
 AWS_LAMBDA_API LogType GetLogTypeForName(const Aws::String& name);
 
 AWS_LAMBDA_API Aws::String GetNameForLogType(LogType value);
+
+/**
+ * Same as GetNameForLogType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LAMBDA_API const char* GetNameForLogTypeCStr(LogType value);
 } // namespace LogTypeMapper
 } // namespace Model
 } // namespace Lambda
@@ -48,6 +48,11 @@ namespace RuntimeMapper
 AWS_LAMBDA_API Runtime GetRuntimeForName(const Aws::String& name);
 
 AWS_LAMBDA_API Aws::String GetNameForRuntime(Runtime value);
+
+/**
+ * Same as GetNameForRuntime(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LAMBDA_API const char* GetNameForRuntimeCStr(Runtime value);
 } // namespace RuntimeMapper
 } // namespace Model
 } // namespace Lambda
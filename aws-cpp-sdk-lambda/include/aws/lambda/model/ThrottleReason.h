@@ -38,6 +38,11 @@ namespace ThrottleReasonMapper
 AWS_LAMBDA_API ThrottleReason GetThrottleReasonForName(const Aws::String& name);
 
 AWS_LAMBDA_API Aws::String GetNameForThrottleReason(ThrottleReason value);
+
+/**
+ * Same as GetNameForThrottleReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LAMBDA_API const char* GetNameForThrottleReasonCStr(ThrottleReason value);
 } // namespace ThrottleReasonMapper
 } // namespace Model
 } // namespace Lambda
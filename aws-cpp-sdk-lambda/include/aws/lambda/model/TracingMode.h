@@ -35,6 +35,11 @@ namespace TracingModeMapper
 AWS_LAMBDA_API TracingMode GetTracingModeForName(const Aws::String& name);
 
 AWS_LAMBDA_API Aws::String GetNameForTracingMode(TracingMode value);
+
+/**
+ * Same as GetNameForTracingMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LAMBDA_API const char* GetNameForTracingModeCStr(TracingMode value);
 } // namespace TracingModeMapper
 } // namespace Model
 } // namespace Lambda
@@ -30,25 +30,44 @@ namespace Aws
       namespace EventSourcePositionMapper
       {
 
-        static const int TRIM_HORIZON_HASH = HashingUtils::HashString("TRIM_HORIZON");
-        static const int LATEST_HASH = HashingUtils::HashString("LATEST");
-        static const int AT_TIMESTAMP_HASH = HashingUtils::HashString("AT_TIMESTAMP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TRIM_HORIZON",
+          "LATEST",
+          "AT_TIMESTAMP",
+        };
 
         EventSourcePosition GetEventSourcePositionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRIM_HORIZON_HASH)
-          {
-            return EventSourcePosition::TRIM_HORIZON;
-          }
-          else if (hashCode == LATEST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventSourcePosition::LATEST;
-          }
-          else if (hashCode == AT_TIMESTAMP_HASH)
-          {
-            return EventSourcePosition::AT_TIMESTAMP;
+          case 1909941854:
+            if (name == "TRIM_HORIZON")
+            {
+              return EventSourcePosition::TRIM_HORIZON;
+            }
+            break;
+          case -2056551545:
+            if (name == "LATEST")
+            {
+              return EventSourcePosition::LATEST;
+            }
+            break;
+          case 533190634:
+            if (name == "AT_TIMESTAMP")
+            {
+              return EventSourcePosition::AT_TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EventSourcePosition::NOT_SET;
         }
 
-        Aws::String GetNameForEventSourcePosition(EventSourcePosition enumValue)
+        const char* GetNameForEventSourcePositionCStr(EventSourcePosition enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventSourcePosition::TRIM_HORIZON:
-            return "TRIM_HORIZON";
-          case EventSourcePosition::LATEST:
-            return "LATEST";
-          case EventSourcePosition::AT_TIMESTAMP:
-            return "AT_TIMESTAMP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventSourcePosition(EventSourcePosition enumValue)
+        {
+          return GetNameForEventSourcePositionCStr(enumValue);
         }
 
       } // namespace EventSourcePositionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace LogTypeMapper
       {
 
-        static const int None_HASH = HashingUtils::HashString("None");
-        static const int Tail_HASH = HashingUtils::HashString("Tail");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "None",
+          "Tail",
+        };
 
         LogType GetLogTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == None_HASH)
-          {
-            return LogType::None;
-          }
-          else if (hashCode == Tail_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LogType::Tail;
+          case 2433880:
+            if (name == "None")
+            {
+              return LogType::None;
+            }
+            break;
+          case 2599024:
+            if (name == "Tail")
+            {
+              return LogType::Tail;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LogType::NOT_SET;
         }
 
-        Aws::String GetNameForLogType(LogType enumValue)
+        const char* GetNameForLogTypeCStr(LogType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LogType::None:
-            return "None";
-          case LogType::Tail:
-            return "Tail";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLogType(LogType enumValue)
+        {
+          return GetNameForLogTypeCStr(enumValue);
         }
 
       } // namespace LogTypeMapper
@@ -30,85 +30,128 @@ namespace Aws
       namespace RuntimeMapper
       {
 
-        static const int nodejs_HASH = HashingUtils::HashString("nodejs");
-        static const int nodejs4_3_HASH = HashingUtils::HashString("nodejs4.3");
-        static const int nodejs6_10_HASH = HashingUtils::HashString("nodejs6.10");
-        static const int nodejs8_10_HASH = HashingUtils::HashString("nodejs8.10");
-        static const int java8_HASH = HashingUtils::HashString("java8");
-        static const int python2_7_HASH = HashingUtils::HashString("python2.7");
-        static const int python3_6_HASH = HashingUtils::HashString("python3.6");
-        static const int python3_7_HASH = HashingUtils::HashString("python3.7");
-        static const int dotnetcore1_0_HASH = HashingUtils::HashString("dotnetcore1.0");
-        static const int dotnetcore2_0_HASH = HashingUtils::HashString("dotnetcore2.0");
-        static const int dotnetcore2_1_HASH = HashingUtils::HashString("dotnetcore2.1");
-        static const int nodejs4_3_edge_HASH = HashingUtils::HashString("nodejs4.3-edge");
-        static const int go1_x_HASH = HashingUtils::HashString("go1.x");
-        static const int ruby2_5_HASH = HashingUtils::HashString("ruby2.5");
-        static const int provided_HASH = HashingUtils::HashString("provided");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "nodejs",
+          "nodejs4.3",
+          "nodejs6.10",
+          "nodejs8.10",
+          "java8",
+          "python2.7",
+          "python3.6",
+          "python3.7",
+          "dotnetcore1.0",
+          "dotnetcore2.0",
+          "dotnetcore2.1",
+          "nodejs4.3-edge",
+          "go1.x",
+          "ruby2.5",
+          "provided",
+        };
 
         Runtime GetRuntimeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == nodejs_HASH)
-          {
-            return Runtime::nodejs;
-          }
-          else if (hashCode == nodejs4_3_HASH)
-          {
-            return Runtime::nodejs4_3;
-          }
-          else if (hashCode == nodejs6_10_HASH)
-          {
-            return Runtime::nodejs6_10;
-          }
-          else if (hashCode == nodejs8_10_HASH)
-          {
-            return Runtime::nodejs8_10;
-          }
-          else if (hashCode == java8_HASH)
-          {
-            return Runtime::java8;
-          }
-          else if (hashCode == python2_7_HASH)
-          {
-            return Runtime::python2_7;
-          }
-          else if (hashCode == python3_6_HASH)
-          {
-            return Runtime::python3_6;
-          }
-          else if (hashCode == python3_7_HASH)
-          {
-            return Runtime::python3_7;
-          }
-          else if (hashCode == dotnetcore1_0_HASH)
-          {
-            return Runtime::dotnetcore1_0;
-          }
-          else if (hashCode == dotnetcore2_0_HASH)
-          {
-            return Runtime::dotnetcore2_0;
-          }
-          else if (hashCode == dotnetcore2_1_HASH)
-          {
-            return Runtime::dotnetcore2_1;
-          }
-          else if (hashCode == nodejs4_3_edge_HASH)
-          {
-            return Runtime::nodejs4_3_edge;
-          }
-          else if (hashCode == go1_x_HASH)
-          {
-            return Runtime::go1_x;
-          }
-          else if (hashCode == ruby2_5_HASH)
-          {
-            return Runtime::ruby2_5;
-          }
-          else if (hashCode == provided_HASH)
-          {
-            return Runtime::provided;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1040170293:
+            if (name == "nodejs")
+            {
+              return Runtime::nodejs;
+            }
+            break;
+          case 475893326:
+            if (name == "nodejs4.3")
+            {
+              return Runtime::nodejs4_3;
+            }
+            break;
+          case 1867850786:
+            if (name == "nodejs6.10")
+            {
+              return Runtime::nodejs6_10;
+            }
+            break;
+          case 1867910368:
+            if (name == "nodejs8.10")
+            {
+              return Runtime::nodejs8_10;
+            }
+            break;
+          case 100899414:
+            if (name == "java8")
+            {
+              return Runtime::java8;
+            }
+            break;
+          case -1485270241:
+            if (name == "python2.7")
+            {
+              return Runtime::python2_7;
+            }
+            break;
+          case -1485269281:
+            if (name == "python3.6")
+            {
+              return Runtime::python3_6;
+            }
+            break;
+          case -1485269280:
+            if (name == "python3.7")
+            {
+              return Runtime::python3_7;
+            }
+            break;
+          case -1168838784:
+            if (name == "dotnetcore1.0")
+            {
+              return Runtime::dotnetcore1_0;
+            }
+            break;
+          case -1168837823:
+            if (name == "dotnetcore2.0")
+            {
+              return Runtime::dotnetcore2_0;
+            }
+            break;
+          case -1168837822:
+            if (name == "dotnetcore2.1")
+            {
+              return Runtime::dotnetcore2_1;
+            }
+            break;
+          case -307314212:
+            if (name == "nodejs4.3-edge")
+            {
+              return Runtime::nodejs4_3_edge;
+            }
+            break;
+          case 98478099:
+            if (name == "go1.x")
+            {
+              return Runtime::go1_x;
+            }
+            break;
+          case 1539974495:
+            if (name == "ruby2.5")
+            {
+              return Runtime::ruby2_5;
+            }
+            break;
+          case -987494941:
+            if (name == "provided")
+            {
+              return Runtime::provided;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -120,49 +163,26 @@ namespace Aws
           return Runtime::NOT_SET;
         }
 
-        Aws::String GetNameForRuntime(Runtime enumValue)
+        const char* GetNameForRuntimeCStr(Runtime enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Runtime::nodejs:
-            return "nodejs";
-          case Runtime::nodejs4_3:
-            return "nodejs4.3";
-          case Runtime::nodejs6_10:
-            return "nodejs6.10";
-          case Runtime::nodejs8_10:
-            return "nodejs8.10";
-          case Runtime::java8:
-            return "java8";
-          case Runtime::python2_7:
-            return "python2.7";
-          case Runtime::python3_6:
-            return "python3.6";
-          case Runtime::python3_7:
-            return "python3.7";
-          case Runtime::dotnetcore1_0:
-            return "dotnetcore1.0";
-          case Runtime::dotnetcore2_0:
-            return "dotnetcore2.0";
-          case Runtime::dotnetcore2_1:
-            return "dotnetcore2.1";
-          case Runtime::nodejs4_3_edge:
-            return "nodejs4.3-edge";
-          case Runtime::go1_x:
-            return "go1.x";
-          case Runtime::ruby2_5:
-            return "ruby2.5";
-          case Runtime::provided:
-            return "provided";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRuntime(Runtime enumValue)
+        {
+          return GetNameForRuntimeCStr(enumValue);
         }
 
       } // namespace RuntimeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ThrottleReasonMapper
       {
 
-        static const int ConcurrentInvocationLimitExceeded_HASH = HashingUtils::HashString("ConcurrentInvocationLimitExceeded");
-        static const int FunctionInvocationRateLimitExceeded_HASH = HashingUtils::HashString("FunctionInvocationRateLimitExceeded");
-        static const int ReservedFunctionConcurrentInvocationLimitExceeded_HASH = HashingUtils::HashString("ReservedFunctionConcurrentInvocationLimitExceeded");
-        static const int ReservedFunctionInvocationRateLimitExceeded_HASH = HashingUtils::HashString("ReservedFunctionInvocationRateLimitExceeded");
-        static const int CallerRateLimitExceeded_HASH = HashingUtils::HashString("CallerRateLimitExceeded");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ConcurrentInvocationLimitExceeded",
+          "FunctionInvocationRateLimitExceeded",
+          "ReservedFunctionConcurrentInvocationLimitExceeded",
+          "ReservedFunctionInvocationRateLimitExceeded",
+          "CallerRateLimitExceeded",
+        };
 
         ThrottleReason GetThrottleReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ConcurrentInvocationLimitExceeded_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ThrottleReason::ConcurrentInvocationLimitExceeded;
-          }
-          else if (hashCode == FunctionInvocationRateLimitExceeded_HASH)
-          {
-            return ThrottleReason::FunctionInvocationRateLimitExceeded;
-          }
-          else if (hashCode == ReservedFunctionConcurrentInvocationLimitExceeded_HASH)
-          {
-            return ThrottleReason::ReservedFunctionConcurrentInvocationLimitExceeded;
-          }
-          else if (hashCode == ReservedFunctionInvocationRateLimitExceeded_HASH)
-          {
-            return ThrottleReason::ReservedFunctionInvocationRateLimitExceeded;
-          }
-          else if (hashCode == CallerRateLimitExceeded_HASH)
-          {
-            return ThrottleReason::CallerRateLimitExceeded;
+          case 475188647:
+            if (name == "ConcurrentInvocationLimitExceeded")
+            {
+              return ThrottleReason::ConcurrentInvocationLimitExceeded;
+            }
+            break;
+          case -1533323930:
+            if (name == "FunctionInvocationRateLimitExceeded")
+            {
+              return ThrottleReason::FunctionInvocationRateLimitExceeded;
+            }
+            break;
+          case 2008921703:
+            if (name == "ReservedFunctionConcurrentInvocationLimitExceeded")
+            {
+              return ThrottleReason::ReservedFunctionConcurrentInvocationLimitExceeded;
+            }
+            break;
+          case 296542494:
+            if (name == "ReservedFunctionInvocationRateLimitExceeded")
+            {
+              return ThrottleReason::ReservedFunctionInvocationRateLimitExceeded;
+            }
+            break;
+          case 1942937283:
+            if (name == "CallerRateLimitExceeded")
+            {
+              return ThrottleReason::CallerRateLimitExceeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ThrottleReason::NOT_SET;
         }
 
-        Aws::String GetNameForThrottleReason(ThrottleReason enumValue)
+        const char* GetNameForThrottleReasonCStr(ThrottleReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ThrottleReason::ConcurrentInvocationLimitExceeded:
-            return "ConcurrentInvocationLimitExceeded";
-          case ThrottleReason::FunctionInvocationRateLimitExceeded:
-            return "FunctionInvocationRateLimitExceeded";
-          case ThrottleReason::ReservedFunctionConcurrentInvocationLimitExceeded:
-            return "ReservedFunctionConcurrentInvocationLimitExceeded";
-          case ThrottleReason::ReservedFunctionInvocationRateLimitExceeded:
-            return "ReservedFunctionInvocationRateLimitExceeded";
-          case ThrottleReason::CallerRateLimitExceeded:
-            return "CallerRateLimitExceeded";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForThrottleReason(ThrottleReason enumValue)
+        {
+          return GetNameForThrottleReasonCStr(enumValue);
         }
 
       } // namespace ThrottleReasonMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TracingModeMapper
       {
 
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int PassThrough_HASH = HashingUtils::HashString("PassThrough");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Active",
+          "PassThrough",
+        };
 
         TracingMode GetTracingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Active_HASH)
-          {
-            return TracingMode::Active;
-          }
-          else if (hashCode == PassThrough_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TracingMode::PassThrough;
+          case 1955883814:
+            if (name == "Active")
+            {
+              return TracingMode::Active;
+            }
+            break;
+          case 1873731924:
+            if (name == "PassThrough")
+            {
+              return TracingMode::PassThrough;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TracingMode::NOT_SET;
         }
 
-        Aws::String GetNameForTracingMode(TracingMode enumValue)
+        const char* GetNameForTracingModeCStr(TracingMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TracingMode::Active:
-            return "Active";
-          case TracingMode::PassThrough:
-            return "PassThrough";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTracingMode(TracingMode enumValue)
+        {
+          return GetNameForTracingModeCStr(enumValue);
         }
 
       } // namespace TracingModeMapper
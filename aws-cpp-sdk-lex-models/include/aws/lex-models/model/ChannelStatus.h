@@ -36,6 +36,11 @@ namespace ChannelStatusMapper
 AWS_LEXMODELBUILDINGSERVICE_API ChannelStatus GetChannelStatusForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForChannelStatus(ChannelStatus value);
+
+/**
+ * Same as GetNameForChannelStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForChannelStatusCStr(ChannelStatus value);
 } // namespace ChannelStatusMapper
 } // namespace Model
 } // namespace LexModelBuildingService
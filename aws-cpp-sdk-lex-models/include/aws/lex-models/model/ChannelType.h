@@ -37,6 +37,11 @@ namespace ChannelTypeMapper
 AWS_LEXMODELBUILDINGSERVICE_API ChannelType GetChannelTypeForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForChannelType(ChannelType value);
+
+/**
+ * Same as GetNameForChannelType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForChannelTypeCStr(ChannelType value);
 } // namespace ChannelTypeMapper
 } // namespace Model
 } // namespace LexModelBuildingService
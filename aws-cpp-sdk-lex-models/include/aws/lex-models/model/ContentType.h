@@ -36,6 +36,11 @@ namespace ContentTypeMapper
 AWS_LEXMODELBUILDINGSERVICE_API ContentType GetContentTypeForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForContentType(ContentType value);
+
+/**
+ * Same as GetNameForContentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForContentTypeCStr(ContentType value);
 } // namespace ContentTypeMapper
 } // namespace Model
 } // namespace LexModelBuildingService
@@ -36,6 +36,11 @@ namespace ExportStatusMapper
 AWS_LEXMODELBUILDINGSERVICE_API ExportStatus GetExportStatusForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForExportStatus(ExportStatus value);
+
+/**
+ * Same as GetNameForExportStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForExportStatusCStr(ExportStatus value);
 } // namespace ExportStatusMapper
 } // namespace Model
 } // namespace LexModelBuildingService
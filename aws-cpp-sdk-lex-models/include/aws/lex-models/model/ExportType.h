@@ -35,6 +35,11 @@ namespace ExportTypeMapper
 AWS_LEXMODELBUILDINGSERVICE_API ExportType GetExportTypeForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForExportType(ExportType value);
+
+/**
+ * Same as GetNameForExportType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForExportTypeCStr(ExportType value);
 } // namespace ExportTypeMapper
 } // namespace Model
 } // namespace LexModelBuildingService
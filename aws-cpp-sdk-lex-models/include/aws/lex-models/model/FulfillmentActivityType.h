@@ -35,6 +35,11 @@ namespace FulfillmentActivityTypeMapper
 AWS_LEXMODELBUILDINGSERVICE_API FulfillmentActivityType GetFulfillmentActivityTypeForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForFulfillmentActivityType(FulfillmentActivityType value);
+
+/**
+ * Same as GetNameForFulfillmentActivityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForFulfillmentActivityTypeCStr(FulfillmentActivityType value);
 } // namespace FulfillmentActivityTypeMapper
 } // namespace Model
 } // namespace LexModelBuildingService
@@ -36,6 +36,11 @@ namespace ImportStatusMapper
 AWS_LEXMODELBUILDINGSERVICE_API ImportStatus GetImportStatusForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForImportStatus(ImportStatus value);
+
+/**
+ * Same as GetNameForImportStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForImportStatusCStr(ImportStatus value);
 } // namespace ImportStatusMapper
 } // namespace Model
 } // namespace LexModelBuildingService
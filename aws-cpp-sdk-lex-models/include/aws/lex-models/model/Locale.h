@@ -36,6 +36,11 @@ namespace LocaleMapper
 AWS_LEXMODELBUILDINGSERVICE_API Locale GetLocaleForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForLocale(Locale value);
+
+/**
+ * Same as GetNameForLocale(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForLocaleCStr(Locale value);
 } // namespace LocaleMapper
 } // namespace Model
 } // namespace LexModelBuildingService
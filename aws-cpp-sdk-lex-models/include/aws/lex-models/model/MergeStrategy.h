@@ -35,6 +35,11 @@ namespace MergeStrategyMapper
 AWS_LEXMODELBUILDINGSERVICE_API MergeStrategy GetMergeStrategyForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForMergeStrategy(MergeStrategy value);
+
+/**
+ * Same as GetNameForMergeStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForMergeStrategyCStr(MergeStrategy value);
 } // namespace MergeStrategyMapper
 } // namespace Model
 } // namespace LexModelBuildingService
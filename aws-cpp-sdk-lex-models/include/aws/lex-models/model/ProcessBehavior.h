@@ -35,6 +35,11 @@ namespace ProcessBehaviorMapper
 AWS_LEXMODELBUILDINGSERVICE_API ProcessBehavior GetProcessBehaviorForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForProcessBehavior(ProcessBehavior value);
+
+/**
+ * Same as GetNameForProcessBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForProcessBehaviorCStr(ProcessBehavior value);
 } // namespace ProcessBehaviorMapper
 } // namespace Model
 } // namespace LexModelBuildingService
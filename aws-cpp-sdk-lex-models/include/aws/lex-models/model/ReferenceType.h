@@ -37,6 +37,11 @@ namespace ReferenceTypeMapper
 AWS_LEXMODELBUILDINGSERVICE_API ReferenceType GetReferenceTypeForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForReferenceType(ReferenceType value);
+
+/**
+ * Same as GetNameForReferenceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForReferenceTypeCStr(ReferenceType value);
 } // namespace ReferenceTypeMapper
 } // namespace Model
 } // namespace LexModelBuildingService
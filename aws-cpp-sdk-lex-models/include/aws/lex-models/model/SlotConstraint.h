@@ -35,6 +35,11 @@ namespace SlotConstraintMapper
 AWS_LEXMODELBUILDINGSERVICE_API SlotConstraint GetSlotConstraintForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForSlotConstraint(SlotConstraint value);
+
+/**
+ * Same as GetNameForSlotConstraint(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForSlotConstraintCStr(SlotConstraint value);
 } // namespace SlotConstraintMapper
 } // namespace Model
 } // namespace LexModelBuildingService
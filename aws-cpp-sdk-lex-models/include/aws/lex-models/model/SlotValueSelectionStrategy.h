@@ -35,6 +35,11 @@ namespace SlotValueSelectionStrategyMapper
 AWS_LEXMODELBUILDINGSERVICE_API SlotValueSelectionStrategy GetSlotValueSelectionStrategyForName(const Aws::String& name);
 
 AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForSlotValueSelectionStrategy(SlotValueSelectionStrategy value);
+
+/**
+ * Same as GetNameForSlotValueSelectionStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForSlotValueSelectionStrategyCStr(SlotValueSelectionStrategy value);
 } // namespace SlotValueSelectionStrategyMapper
 } // namespace Model
 } // namespace LexModelBuildingService
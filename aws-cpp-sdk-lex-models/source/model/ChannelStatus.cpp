@@ -30,25 +30,44 @@ namespace Aws
       namespace ChannelStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "CREATED",
+          "FAILED",
+        };
 
         ChannelStatus GetChannelStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return ChannelStatus::IN_PROGRESS;
-          }
-          else if (hashCode == CREATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChannelStatus::CREATED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ChannelStatus::FAILED;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return ChannelStatus::IN_PROGRESS;
+            }
+            break;
+          case 1746537160:
+            if (name == "CREATED")
+            {
+              return ChannelStatus::CREATED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ChannelStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ChannelStatus::NOT_SET;
         }
 
-        Aws::String GetNameForChannelStatus(ChannelStatus enumValue)
+        const char* GetNameForChannelStatusCStr(ChannelStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChannelStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case ChannelStatus::CREATED:
-            return "CREATED";
-          case ChannelStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChannelStatus(ChannelStatus enumValue)
+        {
+          return GetNameForChannelStatusCStr(enumValue);
         }
 
       } // namespace ChannelStatusMapper
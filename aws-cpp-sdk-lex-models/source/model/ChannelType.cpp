@@ -30,30 +30,51 @@ namespace Aws
       namespace ChannelTypeMapper
       {
 
-        static const int Facebook_HASH = HashingUtils::HashString("Facebook");
-        static const int Slack_HASH = HashingUtils::HashString("Slack");
-        static const int Twilio_Sms_HASH = HashingUtils::HashString("Twilio-Sms");
-        static const int Kik_HASH = HashingUtils::HashString("Kik");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Facebook",
+          "Slack",
+          "Twilio-Sms",
+          "Kik",
+        };
 
         ChannelType GetChannelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Facebook_HASH)
-          {
-            return ChannelType::Facebook;
-          }
-          else if (hashCode == Slack_HASH)
-          {
-            return ChannelType::Slack;
-          }
-          else if (hashCode == Twilio_Sms_HASH)
-          {
-            return ChannelType::Twilio_Sms;
-          }
-          else if (hashCode == Kik_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChannelType::Kik;
+          case 561774310:
+            if (name == "Facebook")
+            {
+              return ChannelType::Facebook;
+            }
+            break;
+          case 79966064:
+            if (name == "Slack")
+            {
+              return ChannelType::Slack;
+            }
+            break;
+          case -1178344808:
+            if (name == "Twilio-Sms")
+            {
+              return ChannelType::Twilio_Sms;
+            }
+            break;
+          case 75437:
+            if (name == "Kik")
+            {
+              return ChannelType::Kik;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ChannelType::NOT_SET;
         }
 
-        Aws::String GetNameForChannelType(ChannelType enumValue)
+        const char* GetNameForChannelTypeCStr(ChannelType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChannelType::Facebook:
-            return "Facebook";
-          case ChannelType::Slack:
-            return "Slack";
-          case ChannelType::Twilio_Sms:
-            return "Twilio-Sms";
-          case ChannelType::Kik:
-            return "Kik";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChannelType(ChannelType enumValue)
+        {
+          return GetNameForChannelTypeCStr(enumValue);
         }
 
       } // namespace ChannelTypeMapper
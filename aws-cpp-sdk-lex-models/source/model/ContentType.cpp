@@ -30,25 +30,44 @@ namespace Aws
       namespace ContentTypeMapper
       {
 
-        static const int PlainText_HASH = HashingUtils::HashString("PlainText");
-        static const int SSML_HASH = HashingUtils::HashString("SSML");
-        static const int CustomPayload_HASH = HashingUtils::HashString("CustomPayload");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PlainText",
+          "SSML",
+          "CustomPayload",
+        };
 
         ContentType GetContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PlainText_HASH)
-          {
-            return ContentType::PlainText;
-          }
-          else if (hashCode == SSML_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContentType::SSML;
-          }
-          else if (hashCode == CustomPayload_HASH)
-          {
-            return ContentType::CustomPayload;
+          case -318718473:
+            if (name == "PlainText")
+            {
+              return ContentType::PlainText;
+            }
+            break;
+          case 2554879:
+            if (name == "SSML")
+            {
+              return ContentType::SSML;
+            }
+            break;
+          case 1029672125:
+            if (name == "CustomPayload")
+            {
+              return ContentType::CustomPayload;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ContentType::NOT_SET;
         }
 
-        Aws::String GetNameForContentType(ContentType enumValue)
+        const char* GetNameForContentTypeCStr(ContentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContentType::PlainText:
-            return "PlainText";
-          case ContentType::SSML:
-            return "SSML";
-          case ContentType::CustomPayload:
-            return "CustomPayload";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContentType(ContentType enumValue)
+        {
+          return GetNameForContentTypeCStr(enumValue);
         }
 
       } // namespace ContentTypeMapper
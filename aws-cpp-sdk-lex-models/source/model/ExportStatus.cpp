@@ -30,25 +30,44 @@ namespace Aws
       namespace ExportStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "READY",
+          "FAILED",
+        };
 
         ExportStatus GetExportStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return ExportStatus::IN_PROGRESS;
-          }
-          else if (hashCode == READY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExportStatus::READY;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ExportStatus::FAILED;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return ExportStatus::IN_PROGRESS;
+            }
+            break;
+          case 77848963:
+            if (name == "READY")
+            {
+              return ExportStatus::READY;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ExportStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ExportStatus::NOT_SET;
         }
 
-        Aws::String GetNameForExportStatus(ExportStatus enumValue)
+        const char* GetNameForExportStatusCStr(ExportStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExportStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case ExportStatus::READY:
-            return "READY";
-          case ExportStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExportStatus(ExportStatus enumValue)
+        {
+          return GetNameForExportStatusCStr(enumValue);
         }
 
       } // namespace ExportStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ExportTypeMapper
       {
 
-        static const int ALEXA_SKILLS_KIT_HASH = HashingUtils::HashString("ALEXA_SKILLS_KIT");
-        static const int LEX_HASH = HashingUtils::HashString("LEX");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALEXA_SKILLS_KIT",
+          "LEX",
+        };
 
         ExportType GetExportTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALEXA_SKILLS_KIT_HASH)
-          {
-            return ExportType::ALEXA_SKILLS_KIT;
-          }
-          else if (hashCode == LEX_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExportType::LEX;
+          case -2083414763:
+            if (name == "ALEXA_SKILLS_KIT")
+            {
+              return ExportType::ALEXA_SKILLS_KIT;
+            }
+            break;
+          case 75263:
+            if (name == "LEX")
+            {
+              return ExportType::LEX;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ExportType::NOT_SET;
         }
 
-        Aws::String GetNameForExportType(ExportType enumValue)
+        const char* GetNameForExportTypeCStr(ExportType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExportType::ALEXA_SKILLS_KIT:
-            return "ALEXA_SKILLS_KIT";
-          case ExportType::LEX:
-            return "LEX";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExportType(ExportType enumValue)
+        {
+          return GetNameForExportTypeCStr(enumValue);
         }
 
       } // namespace ExportTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FulfillmentActivityTypeMapper
       {
 
-        static const int ReturnIntent_HASH = HashingUtils::HashString("ReturnIntent");
-        static const int CodeHook_HASH = HashingUtils::HashString("CodeHook");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ReturnIntent",
+          "CodeHook",
+        };
 
         FulfillmentActivityType GetFulfillmentActivityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ReturnIntent_HASH)
-          {
-            return FulfillmentActivityType::ReturnIntent;
-          }
-          else if (hashCode == CodeHook_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FulfillmentActivityType::CodeHook;
+          case 699994124:
+            if (name == "ReturnIntent")
+            {
+              return FulfillmentActivityType::ReturnIntent;
+            }
+            break;
+          case -803685168:
+            if (name == "CodeHook")
+            {
+              return FulfillmentActivityType::CodeHook;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FulfillmentActivityType::NOT_SET;
         }
 
-        Aws::String GetNameForFulfillmentActivityType(FulfillmentActivityType enumValue)
+        const char* GetNameForFulfillmentActivityTypeCStr(FulfillmentActivityType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FulfillmentActivityType::ReturnIntent:
-            return "ReturnIntent";
-          case FulfillmentActivityType::CodeHook:
-            return "CodeHook";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFulfillmentActivityType(FulfillmentActivityType enumValue)
+        {
+          return GetNameForFulfillmentActivityTypeCStr(enumValue);
         }
 
       } // namespace FulfillmentActivityTypeMapper
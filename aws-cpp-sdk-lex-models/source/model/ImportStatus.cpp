@@ -30,25 +30,44 @@ namespace Aws
       namespace ImportStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETE_HASH = HashingUtils::HashString("COMPLETE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "COMPLETE",
+          "FAILED",
+        };
 
         ImportStatus GetImportStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return ImportStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ImportStatus::COMPLETE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ImportStatus::FAILED;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return ImportStatus::IN_PROGRESS;
+            }
+            break;
+          case 183181625:
+            if (name == "COMPLETE")
+            {
+              return ImportStatus::COMPLETE;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ImportStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ImportStatus::NOT_SET;
         }
 
-        Aws::String GetNameForImportStatus(ImportStatus enumValue)
+        const char* GetNameForImportStatusCStr(ImportStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ImportStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case ImportStatus::COMPLETE:
-            return "COMPLETE";
-          case ImportStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForImportStatus(ImportStatus enumValue)
+        {
+          return GetNameForImportStatusCStr(enumValue);
         }
 
       } // namespace ImportStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace LocaleMapper
       {
 
-        static const int en_US_HASH = HashingUtils::HashString("en-US");
-        static const int en_GB_HASH = HashingUtils::HashString("en-GB");
-        static const int de_DE_HASH = HashingUtils::HashString("de-DE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "en-US",
+          "en-GB",
+          "de-DE",
+        };
 
         Locale GetLocaleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == en_US_HASH)
-          {
-            return Locale::en_US;
-          }
-          else if (hashCode == en_GB_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Locale::en_GB;
-          }
-          else if (hashCode == de_DE_HASH)
-          {
-            return Locale::de_DE;
+          case 96598594:
+            if (name == "en-US")
+            {
+              return Locale::en_US;
+            }
+            break;
+          case 96598143:
+            if (name == "en-GB")
+            {
+              return Locale::en_GB;
+            }
+            break;
+          case 95406413:
+            if (name == "de-DE")
+            {
+              return Locale::de_DE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Locale::NOT_SET;
         }
 
-        Aws::String GetNameForLocale(Locale enumValue)
+        const char* GetNameForLocaleCStr(Locale enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Locale::en_US:
-            return "en-US";
-          case Locale::en_GB:
-            return "en-GB";
-          case Locale::de_DE:
-            return "de-DE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLocale(Locale enumValue)
+        {
+          return GetNameForLocaleCStr(enumValue);
         }
 
       } // namespace LocaleMapper
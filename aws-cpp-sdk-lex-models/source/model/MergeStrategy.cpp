@@ -30,20 +30,37 @@ namespace Aws
       namespace MergeStrategyMapper
       {
 
-        static const int OVERWRITE_LATEST_HASH = HashingUtils::HashString("OVERWRITE_LATEST");
-        static const int FAIL_ON_CONFLICT_HASH = HashingUtils::HashString("FAIL_ON_CONFLICT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OVERWRITE_LATEST",
+          "FAIL_ON_CONFLICT",
+        };
 
         MergeStrategy GetMergeStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OVERWRITE_LATEST_HASH)
-          {
-            return MergeStrategy::OVERWRITE_LATEST;
-          }
-          else if (hashCode == FAIL_ON_CONFLICT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MergeStrategy::FAIL_ON_CONFLICT;
+          case -687123749:
+            if (name == "OVERWRITE_LATEST")
+            {
+              return MergeStrategy::OVERWRITE_LATEST;
+            }
+            break;
+          case 51732113:
+            if (name == "FAIL_ON_CONFLICT")
+            {
+              return MergeStrategy::FAIL_ON_CONFLICT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MergeStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForMergeStrategy(MergeStrategy enumValue)
+        const char* GetNameForMergeStrategyCStr(MergeStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MergeStrategy::OVERWRITE_LATEST:
-            return "OVERWRITE_LATEST";
-          case MergeStrategy::FAIL_ON_CONFLICT:
-            return "FAIL_ON_CONFLICT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMergeStrategy(MergeStrategy enumValue)
+        {
+          return GetNameForMergeStrategyCStr(enumValue);
         }
 
       } // namespace MergeStrategyMapper
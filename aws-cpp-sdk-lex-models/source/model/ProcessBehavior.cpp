@@ -30,20 +30,37 @@ namespace Aws
       namespace ProcessBehaviorMapper
       {
 
-        static const int SAVE_HASH = HashingUtils::HashString("SAVE");
-        static const int BUILD_HASH = HashingUtils::HashString("BUILD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SAVE",
+          "BUILD",
+        };
 
         ProcessBehavior GetProcessBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SAVE_HASH)
-          {
-            return ProcessBehavior::SAVE;
-          }
-          else if (hashCode == BUILD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProcessBehavior::BUILD;
+          case 2537853:
+            if (name == "SAVE")
+            {
+              return ProcessBehavior::SAVE;
+            }
+            break;
+          case 63557198:
+            if (name == "BUILD")
+            {
+              return ProcessBehavior::BUILD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ProcessBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForProcessBehavior(ProcessBehavior enumValue)
+        const char* GetNameForProcessBehaviorCStr(ProcessBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProcessBehavior::SAVE:
-            return "SAVE";
-          case ProcessBehavior::BUILD:
-            return "BUILD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProcessBehavior(ProcessBehavior enumValue)
+        {
+          return GetNameForProcessBehaviorCStr(enumValue);
         }
 
       } // namespace ProcessBehaviorMapper
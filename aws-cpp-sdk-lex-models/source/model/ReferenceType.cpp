@@ -30,30 +30,51 @@ namespace Aws
       namespace ReferenceTypeMapper
       {
 
-        static const int Intent_HASH = HashingUtils::HashString("Intent");
-        static const int Bot_HASH = HashingUtils::HashString("Bot");
-        static const int BotAlias_HASH = HashingUtils::HashString("BotAlias");
-        static const int BotChannel_HASH = HashingUtils::HashString("BotChannel");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Intent",
+          "Bot",
+          "BotAlias",
+          "BotChannel",
+        };
 
         ReferenceType GetReferenceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Intent_HASH)
-          {
-            return ReferenceType::Intent;
-          }
-          else if (hashCode == Bot_HASH)
-          {
-            return ReferenceType::Bot;
-          }
-          else if (hashCode == BotAlias_HASH)
-          {
-            return ReferenceType::BotAlias;
-          }
-          else if (hashCode == BotChannel_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReferenceType::BotChannel;
+          case -2099895620:
+            if (name == "Intent")
+            {
+              return ReferenceType::Intent;
+            }
+            break;
+          case 66983:
+            if (name == "Bot")
+            {
+              return ReferenceType::Bot;
+            }
+            break;
+          case -2120609559:
+            if (name == "BotAlias")
+            {
+              return ReferenceType::BotAlias;
+            }
+            break;
+          case -437799588:
+            if (name == "BotChannel")
+            {
+              return ReferenceType::BotChannel;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ReferenceType::NOT_SET;
         }
 
-        Aws::String GetNameForReferenceType(ReferenceType enumValue)
+        const char* GetNameForReferenceTypeCStr(ReferenceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReferenceType::Intent:
-            return "Intent";
-          case ReferenceType::Bot:
-            return "Bot";
-          case ReferenceType::BotAlias:
-            return "BotAlias";
-          case ReferenceType::BotChannel:
-            return "BotChannel";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReferenceType(ReferenceType enumValue)
+        {
+          return GetNameForReferenceTypeCStr(enumValue);
         }
 
       } // namespace ReferenceTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int BOT_HASH = HashingUtils::HashString("BOT");
-        static const int INTENT_HASH = HashingUtils::HashString("INTENT");
-        static const int SLOT_TYPE_HASH = HashingUtils::HashString("SLOT_TYPE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BOT",
+          "INTENT",
+          "SLOT_TYPE",
+        };
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BOT_HASH)
-          {
-            return ResourceType::BOT;
-          }
-          else if (hashCode == INTENT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceType::INTENT;
-          }
-          else if (hashCode == SLOT_TYPE_HASH)
-          {
-            return ResourceType::SLOT_TYPE;
+          case 65959:
+            if (name == "BOT")
+            {
+              return ResourceType::BOT;
+            }
+            break;
+          case -2130433380:
+            if (name == "INTENT")
+            {
+              return ResourceType::INTENT;
+            }
+            break;
+          case -791745317:
+            if (name == "SLOT_TYPE")
+            {
+              return ResourceType::SLOT_TYPE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceTypeCStr(ResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceType::BOT:
-            return "BOT";
-          case ResourceType::INTENT:
-            return "INTENT";
-          case ResourceType::SLOT_TYPE:
-            return "SLOT_TYPE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceType(ResourceType enumValue)
+        {
+          return GetNameForResourceTypeCStr(enumValue);
         }
 
       } // namespace ResourceTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SlotConstraintMapper
       {
 
-        static const int Required_HASH = HashingUtils::HashString("Required");
-        static const int Optional_HASH = HashingUtils::HashString("Optional");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Required",
+          "Optional",
+        };
 
         SlotConstraint GetSlotConstraintForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Required_HASH)
-          {
-            return SlotConstraint::Required;
-          }
-          else if (hashCode == Optional_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SlotConstraint::Optional;
+          case -328495169:
+            if (name == "Required")
+            {
+              return SlotConstraint::Required;
+            }
+            break;
+          case -14372992:
+            if (name == "Optional")
+            {
+              return SlotConstraint::Optional;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SlotConstraint::NOT_SET;
         }
 
-        Aws::String GetNameForSlotConstraint(SlotConstraint enumValue)
+        const char* GetNameForSlotConstraintCStr(SlotConstraint enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SlotConstraint::Required:
-            return "Required";
-          case SlotConstraint::Optional:
-            return "Optional";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSlotConstraint(SlotConstraint enumValue)
+        {
+          return GetNameForSlotConstraintCStr(enumValue);
         }
 
       } // namespace SlotConstraintMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SlotValueSelectionStrategyMapper
       {
 
-        static const int ORIGINAL_VALUE_HASH = HashingUtils::HashString("ORIGINAL_VALUE");
-        static const int TOP_RESOLUTION_HASH = HashingUtils::HashString("TOP_RESOLUTION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ORIGINAL_VALUE",
+          "TOP_RESOLUTION",
+        };
 
         SlotValueSelectionStrategy GetSlotValueSelectionStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ORIGINAL_VALUE_HASH)
-          {
-            return SlotValueSelectionStrategy::ORIGINAL_VALUE;
-          }
-          else if (hashCode == TOP_RESOLUTION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SlotValueSelectionStrategy::TOP_RESOLUTION;
+          case 667358563:
+            if (name == "ORIGINAL_VALUE")
+            {
+              return SlotValueSelectionStrategy::ORIGINAL_VALUE;
+            }
+            break;
+          case 488804854:
+            if (name == "TOP_RESOLUTION")
+            {
+              return SlotValueSelectionStrategy::TOP_RESOLUTION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SlotValueSelectionStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForSlotValueSelectionStrategy(SlotValueSelectionStrategy enumValue)
+        const char* GetNameForSlotValueSelectionStrategyCStr(SlotValueSelectionStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SlotValueSelectionStrategy::ORIGINAL_VALUE:
-            return "ORIGINAL_VALUE";
-          case SlotValueSelectionStrategy::TOP_RESOLUTION:
-            return "TOP_RESOLUTION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSlotValueSelectionStrategy(SlotValueSelectionStrategy enumValue)
+        {
+          return GetNameForSlotValueSelectionStrategyCStr(enumValue);
         }
 
       } // namespace SlotValueSelectionStrategyMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int BUILDING_HASH = HashingUtils::HashString("BUILDING");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int READY_BASIC_TESTING_HASH = HashingUtils::HashString("READY_BASIC_TESTING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int NOT_BUILT_HASH = HashingUtils::HashString("NOT_BUILT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BUILDING",
+          "READY",
+          "READY_BASIC_TESTING",
+          "FAILED",
+          "NOT_BUILT",
+        };
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BUILDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Status::BUILDING;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return Status::READY;
-          }
-          else if (hashCode == READY_BASIC_TESTING_HASH)
-          {
-            return Status::READY_BASIC_TESTING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return Status::FAILED;
-          }
-          else if (hashCode == NOT_BUILT_HASH)
-          {
-            return Status::NOT_BUILT;
+          case -648019276:
+            if (name == "BUILDING")
+            {
+              return Status::BUILDING;
+            }
+            break;
+          case 77848963:
+            if (name == "READY")
+            {
+              return Status::READY;
+            }
+            break;
+          case -506419965:
+            if (name == "READY_BASIC_TESTING")
+            {
+              return Status::READY_BASIC_TESTING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return Status::FAILED;
+            }
+            break;
+          case 1019760082:
+            if (name == "NOT_BUILT")
+            {
+              return Status::NOT_BUILT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return Status::NOT_SET;
         }
 
-        Aws::String GetNameForStatus(Status enumValue)
+        const char* GetNameForStatusCStr(Status enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Status::BUILDING:
-            return "BUILDING";
-          case Status::READY:
-            return "READY";
-          case Status::READY_BASIC_TESTING:
-            return "READY_BASIC_TESTING";
-          case Status::FAILED:
-            return "FAILED";
-          case Status::NOT_BUILT:
-            return "NOT_BUILT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatus(Status enumValue)
+        {
+          return GetNameForStatusCStr(enumValue);
         }
 
       } // namespace StatusMapper
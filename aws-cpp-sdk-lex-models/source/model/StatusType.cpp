@@ -30,20 +30,37 @@ namespace Aws
       namespace StatusTypeMapper
       {
 
-        static const int Detected_HASH = HashingUtils::HashString("Detected");
-        static const int Missed_HASH = HashingUtils::HashString("Missed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Detected",
+          "Missed",
+        };
 
         StatusType GetStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Detected_HASH)
-          {
-            return StatusType::Detected;
-          }
-          else if (hashCode == Missed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StatusType::Missed;
+          case 1112898210:
+            if (name == "Detected")
+            {
+              return StatusType::Detected;
+            }
+            break;
+          case -1990013253:
+            if (name == "Missed")
+            {
+              return StatusType::Missed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return StatusType::NOT_SET;
         }
 
-        Aws::String GetNameForStatusType(StatusType enumValue)
+        const char* GetNameForStatusTypeCStr(StatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StatusType::Detected:
-            return "Detected";
-          case StatusType::Missed:
-            return "Missed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatusType(StatusType enumValue)
+        {
+          return GetNameForStatusTypeCStr(enumValue);
         }
 
       } // namespace StatusTypeMapper
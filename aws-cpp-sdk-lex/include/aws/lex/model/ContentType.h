@@ -34,6 +34,11 @@ namespace ContentTypeMapper
 AWS_LEXRUNTIMESERVICE_API ContentType GetContentTypeForName(const Aws::String& name);
 
 AWS_LEXRUNTIMESERVICE_API Aws::String GetNameForContentType(ContentType value);
+
+/**
+ * Same as GetNameForContentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXRUNTIMESERVICE_API const char* GetNameForContentTypeCStr(ContentType value);
 } // namespace ContentTypeMapper
 } // namespace Model
 } // namespace LexRuntimeService
@@ -39,6 +39,11 @@ namespace DialogStateMapper
 AWS_LEXRUNTIMESERVICE_API DialogState GetDialogStateForName(const Aws::String& name);
 
 AWS_LEXRUNTIMESERVICE_API Aws::String GetNameForDialogState(DialogState value);
+
+/**
+ * Same as GetNameForDialogState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXRUNTIMESERVICE_API const char* GetNameForDialogStateCStr(DialogState value);
 } // namespace DialogStateMapper
 } // namespace Model
 } // namespace LexRuntimeService
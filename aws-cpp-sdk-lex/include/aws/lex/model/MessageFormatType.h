@@ -37,6 +37,11 @@ namespace MessageFormatTypeMapper
 AWS_LEXRUNTIMESERVICE_API MessageFormatType GetMessageFormatTypeForName(const Aws::String& name);
 
 AWS_LEXRUNTIMESERVICE_API Aws::String GetNameForMessageFormatType(MessageFormatType value);
+
+/**
+ * Same as GetNameForMessageFormatType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LEXRUNTIMESERVICE_API const char* GetNameForMessageFormatTypeCStr(MessageFormatType value);
 } // namespace MessageFormatTypeMapper
 } // namespace Model
 } // namespace LexRuntimeService
@@ -30,15 +30,30 @@ namespace Aws
       namespace ContentTypeMapper
       {
 
-        static const int application_vnd_amazonaws_card_generic_HASH = HashingUtils::HashString("application/vnd.amazonaws.card.generic");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "application/vnd.amazonaws.card.generic",
+        };
 
         ContentType GetContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == application_vnd_amazonaws_card_generic_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContentType::application_vnd_amazonaws_card_generic;
+          case 1948332527:
+            if (name == "application/vnd.amazonaws.card.generic")
+            {
+              return ContentType::application_vnd_amazonaws_card_generic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ContentType::NOT_SET;
         }
 
-        Aws::String GetNameForContentType(ContentType enumValue)
+        const char* GetNameForContentTypeCStr(ContentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContentType::application_vnd_amazonaws_card_generic:
-            return "application/vnd.amazonaws.card.generic";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContentType(ContentType enumValue)
+        {
+          return GetNameForContentTypeCStr(enumValue);
         }
 
       } // namespace ContentTypeMapper
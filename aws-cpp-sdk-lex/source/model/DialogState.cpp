@@ -30,40 +30,65 @@ namespace Aws
       namespace DialogStateMapper
       {
 
-        static const int ElicitIntent_HASH = HashingUtils::HashString("ElicitIntent");
-        static const int ConfirmIntent_HASH = HashingUtils::HashString("ConfirmIntent");
-        static const int ElicitSlot_HASH = HashingUtils::HashString("ElicitSlot");
-        static const int Fulfilled_HASH = HashingUtils::HashString("Fulfilled");
-        static const int ReadyForFulfillment_HASH = HashingUtils::HashString("ReadyForFulfillment");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ElicitIntent",
+          "ConfirmIntent",
+          "ElicitSlot",
+          "Fulfilled",
+          "ReadyForFulfillment",
+          "Failed",
+        };
 
         DialogState GetDialogStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ElicitIntent_HASH)
-          {
-            return DialogState::ElicitIntent;
-          }
-          else if (hashCode == ConfirmIntent_HASH)
-          {
-            return DialogState::ConfirmIntent;
-          }
-          else if (hashCode == ElicitSlot_HASH)
-          {
-            return DialogState::ElicitSlot;
-          }
-          else if (hashCode == Fulfilled_HASH)
-          {
-            return DialogState::Fulfilled;
-          }
-          else if (hashCode == ReadyForFulfillment_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DialogState::ReadyForFulfillment;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return DialogState::Failed;
+          case -2106084664:
+            if (name == "ElicitIntent")
+            {
+              return DialogState::ElicitIntent;
+            }
+            break;
+          case 755902812:
+            if (name == "ConfirmIntent")
+            {
+              return DialogState::ConfirmIntent;
+            }
+            break;
+          case 784695594:
+            if (name == "ElicitSlot")
+            {
+              return DialogState::ElicitSlot;
+            }
+            break;
+          case 164202751:
+            if (name == "Fulfilled")
+            {
+              return DialogState::Fulfilled;
+            }
+            break;
+          case -330425928:
+            if (name == "ReadyForFulfillment")
+            {
+              return DialogState::ReadyForFulfillment;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return DialogState::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return DialogState::NOT_SET;
         }
 
-        Aws::String GetNameForDialogState(DialogState enumValue)
+        const char* GetNameForDialogStateCStr(DialogState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DialogState::ElicitIntent:
-            return "ElicitIntent";
-          case DialogState::ConfirmIntent:
-            return "ConfirmIntent";
-          case DialogState::ElicitSlot:
-            return "ElicitSlot";
-          case DialogState::Fulfilled:
-            return "Fulfilled";
-          case DialogState::ReadyForFulfillment:
-            return "ReadyForFulfillment";
-          case DialogState::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDialogState(DialogState enumValue)
+        {
+          return GetNameForDialogStateCStr(enumValue);
         }
 
       } // namespace DialogStateMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace MessageFormatTypeMapper
       {
 
-        static const int PlainText_HASH = HashingUtils::HashString("PlainText");
-        static const int CustomPayload_HASH = HashingUtils::HashString("CustomPayload");
-        static const int SSML_HASH = HashingUtils::HashString("SSML");
-        static const int Composite_HASH = HashingUtils::HashString("Composite");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PlainText",
+          "CustomPayload",
+          "SSML",
+          "Composite",
+        };
 
         MessageFormatType GetMessageFormatTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PlainText_HASH)
-          {
-            return MessageFormatType::PlainText;
-          }
-          else if (hashCode == CustomPayload_HASH)
-          {
-            return MessageFormatType::CustomPayload;
-          }
-          else if (hashCode == SSML_HASH)
-          {
-            return MessageFormatType::SSML;
-          }
-          else if (hashCode == Composite_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MessageFormatType::Composite;
+          case -318718473:
+            if (name == "PlainText")
+            {
+              return MessageFormatType::PlainText;
+            }
+            break;
+          case 1029672125:
+            if (name == "CustomPayload")
+            {
+              return MessageFormatType::CustomPayload;
+            }
+            break;
+          case 2554879:
+            if (name == "SSML")
+            {
+              return MessageFormatType::SSML;
+            }
+            break;
+          case 604213863:
+            if (name == "Composite")
+            {
+              return MessageFormatType::Composite;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return MessageFormatType::NOT_SET;
         }
 
-        Aws::String GetNameForMessageFormatType(MessageFormatType enumValue)
+        const char* GetNameForMessageFormatTypeCStr(MessageFormatType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MessageFormatType::PlainText:
-            return "PlainText";
-          case MessageFormatType::CustomPayload:
-            return "CustomPayload";
-          case MessageFormatType::SSML:
-            return "SSML";
-          case MessageFormatType::Composite:
-            return "Composite";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMessageFormatType(MessageFormatType enumValue)
+        {
+          return GetNameForMessageFormatTypeCStr(enumValue);
         }
 
       } // namespace MessageFormatTypeMapper
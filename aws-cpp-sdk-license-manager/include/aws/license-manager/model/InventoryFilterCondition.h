@@ -37,6 +37,11 @@ namespace InventoryFilterConditionMapper
 AWS_LICENSEMANAGER_API InventoryFilterCondition GetInventoryFilterConditionForName(const Aws::String& name);
 
 AWS_LICENSEMANAGER_API Aws::String GetNameForInventoryFilterCondition(InventoryFilterCondition value);
+
+/**
+ * Same as GetNameForInventoryFilterCondition(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LICENSEMANAGER_API const char* GetNameForInventoryFilterConditionCStr(InventoryFilterCondition value);
 } // namespace InventoryFilterConditionMapper
 } // namespace Model
 } // namespace LicenseManager
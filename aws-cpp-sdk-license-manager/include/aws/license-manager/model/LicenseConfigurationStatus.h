@@ -35,6 +35,11 @@ namespace LicenseConfigurationStatusMapper
 AWS_LICENSEMANAGER_API LicenseConfigurationStatus GetLicenseConfigurationStatusForName(const Aws::String& name);
 
 AWS_LICENSEMANAGER_API Aws::String GetNameForLicenseConfigurationStatus(LicenseConfigurationStatus value);
+
+/**
+ * Same as GetNameForLicenseConfigurationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LICENSEMANAGER_API const char* GetNameForLicenseConfigurationStatusCStr(LicenseConfigurationStatus value);
 } // namespace LicenseConfigurationStatusMapper
 } // namespace Model
 } // namespace LicenseManager
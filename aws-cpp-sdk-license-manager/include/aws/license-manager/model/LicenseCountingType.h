@@ -37,6 +37,11 @@ namespace LicenseCountingTypeMapper
 AWS_LICENSEMANAGER_API LicenseCountingType GetLicenseCountingTypeForName(const Aws::String& name);
 
 AWS_LICENSEMANAGER_API Aws::String GetNameForLicenseCountingType(LicenseCountingType value);
+
+/**
+ * Same as GetNameForLicenseCountingType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LICENSEMANAGER_API const char* GetNameForLicenseCountingTypeCStr(LicenseCountingType value);
 } // namespace LicenseCountingTypeMapper
 } // namespace Model
 } // namespace LicenseManager
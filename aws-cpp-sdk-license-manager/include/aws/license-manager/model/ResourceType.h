@@ -36,6 +36,11 @@ namespace ResourceTypeMapper
 AWS_LICENSEMANAGER_API ResourceType GetResourceTypeForName(const Aws::String& name);
 
 AWS_LICENSEMANAGER_API Aws::String GetNameForResourceType(ResourceType value);
+
+/**
+ * Same as GetNameForResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LICENSEMANAGER_API const char* GetNameForResourceTypeCStr(ResourceType value);
 } // namespace ResourceTypeMapper
 } // namespace Model
 } // namespace LicenseManager
@@ -30,30 +30,51 @@ namespace Aws
       namespace InventoryFilterConditionMapper
       {
 
-        static const int EQUALS_HASH = HashingUtils::HashString("EQUALS");
-        static const int NOT_EQUALS_HASH = HashingUtils::HashString("NOT_EQUALS");
-        static const int BEGINS_WITH_HASH = HashingUtils::HashString("BEGINS_WITH");
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EQUALS",
+          "NOT_EQUALS",
+          "BEGINS_WITH",
+          "CONTAINS",
+        };
 
         InventoryFilterCondition GetInventoryFilterConditionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQUALS_HASH)
-          {
-            return InventoryFilterCondition::EQUALS;
-          }
-          else if (hashCode == NOT_EQUALS_HASH)
-          {
-            return InventoryFilterCondition::NOT_EQUALS;
-          }
-          else if (hashCode == BEGINS_WITH_HASH)
-          {
-            return InventoryFilterCondition::BEGINS_WITH;
-          }
-          else if (hashCode == CONTAINS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InventoryFilterCondition::CONTAINS;
+          case 2052813759:
+            if (name == "EQUALS")
+            {
+              return InventoryFilterCondition::EQUALS;
+            }
+            break;
+          case 1630331595:
+            if (name == "NOT_EQUALS")
+            {
+              return InventoryFilterCondition::NOT_EQUALS;
+            }
+            break;
+          case -1440886021:
+            if (name == "BEGINS_WITH")
+            {
+              return InventoryFilterCondition::BEGINS_WITH;
+            }
+            break;
+          case 215180831:
+            if (name == "CONTAINS")
+            {
+              return InventoryFilterCondition::CONTAINS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return InventoryFilterCondition::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryFilterCondition(InventoryFilterCondition enumValue)
+        const char* GetNameForInventoryFilterConditionCStr(InventoryFilterCondition enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InventoryFilterCondition::EQUALS:
-            return "EQUALS";
-          case InventoryFilterCondition::NOT_EQUALS:
-            return "NOT_EQUALS";
-          case InventoryFilterCondition::BEGINS_WITH:
-            return "BEGINS_WITH";
-          case InventoryFilterCondition::CONTAINS:
-            return "CONTAINS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInventoryFilterCondition(InventoryFilterCondition enumValue)
+        {
+          return GetNameForInventoryFilterConditionCStr(enumValue);
         }
 
       } // namespace InventoryFilterConditionMapper
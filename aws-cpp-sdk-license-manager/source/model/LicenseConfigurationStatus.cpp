@@ -30,20 +30,37 @@ namespace Aws
       namespace LicenseConfigurationStatusMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AVAILABLE",
+          "DISABLED",
+        };
 
         LicenseConfigurationStatus GetLicenseConfigurationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
-          {
-            return LicenseConfigurationStatus::AVAILABLE;
-          }
-          else if (hashCode == DISABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LicenseConfigurationStatus::DISABLED;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return LicenseConfigurationStatus::AVAILABLE;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return LicenseConfigurationStatus::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LicenseConfigurationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLicenseConfigurationStatus(LicenseConfigurationStatus enumValue)
+        const char* GetNameForLicenseConfigurationStatusCStr(LicenseConfigurationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LicenseConfigurationStatus::AVAILABLE:
-            return "AVAILABLE";
-          case LicenseConfigurationStatus::DISABLED:
-            return "DISABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLicenseConfigurationStatus(LicenseConfigurationStatus enumValue)
+        {
+          return GetNameForLicenseConfigurationStatusCStr(enumValue);
         }
 
       } // namespace LicenseConfigurationStatusMapper
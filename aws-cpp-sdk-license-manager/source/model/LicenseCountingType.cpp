@@ -30,30 +30,51 @@ namespace Aws
       namespace LicenseCountingTypeMapper
       {
 
-        static const int vCPU_HASH = HashingUtils::HashString("vCPU");
-        static const int Instance_HASH = HashingUtils::HashString("Instance");
-        static const int Core_HASH = HashingUtils::HashString("Core");
-        static const int Socket_HASH = HashingUtils::HashString("Socket");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "vCPU",
+          "Instance",
+          "Core",
+          "Socket",
+        };
 
         LicenseCountingType GetLicenseCountingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == vCPU_HASH)
-          {
-            return LicenseCountingType::vCPU;
-          }
-          else if (hashCode == Instance_HASH)
-          {
-            return LicenseCountingType::Instance;
-          }
-          else if (hashCode == Core_HASH)
-          {
-            return LicenseCountingType::Core;
-          }
-          else if (hashCode == Socket_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LicenseCountingType::Socket;
+          case 3582290:
+            if (name == "vCPU")
+            {
+              return LicenseCountingType::vCPU;
+            }
+            break;
+          case 619772085:
+            if (name == "Instance")
+            {
+              return LicenseCountingType::Instance;
+            }
+            break;
+          case 2106303:
+            if (name == "Core")
+            {
+              return LicenseCountingType::Core;
+            }
+            break;
+          case -1813181549:
+            if (name == "Socket")
+            {
+              return LicenseCountingType::Socket;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return LicenseCountingType::NOT_SET;
         }
 
-        Aws::String GetNameForLicenseCountingType(LicenseCountingType enumValue)
+        const char* GetNameForLicenseCountingTypeCStr(LicenseCountingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LicenseCountingType::vCPU:
-            return "vCPU";
-          case LicenseCountingType::Instance:
-            return "Instance";
-          case LicenseCountingType::Core:
-            return "Core";
-          case LicenseCountingType::Socket:
-            return "Socket";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLicenseCountingType(LicenseCountingType enumValue)
+        {
+          return GetNameForLicenseCountingTypeCStr(enumValue);
         }
 
       } // namespace LicenseCountingTypeMapper
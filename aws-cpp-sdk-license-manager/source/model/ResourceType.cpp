@@ -30,25 +30,44 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int EC2_INSTANCE_HASH = HashingUtils::HashString("EC2_INSTANCE");
-        static const int EC2_HOST_HASH = HashingUtils::HashString("EC2_HOST");
-        static const int EC2_AMI_HASH = HashingUtils::HashString("EC2_AMI");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EC2_INSTANCE",
+          "EC2_HOST",
+          "EC2_AMI",
+        };
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EC2_INSTANCE_HASH)
-          {
-            return ResourceType::EC2_INSTANCE;
-          }
-          else if (hashCode == EC2_HOST_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceType::EC2_HOST;
-          }
-          else if (hashCode == EC2_AMI_HASH)
-          {
-            return ResourceType::EC2_AMI;
+          case 372648224:
+            if (name == "EC2_INSTANCE")
+            {
+              return ResourceType::EC2_INSTANCE;
+            }
+            break;
+          case 849448883:
+            if (name == "EC2_HOST")
+            {
+              return ResourceType::EC2_HOST;
+            }
+            break;
+          case -1219531214:
+            if (name == "EC2_AMI")
+            {
+              return ResourceType::EC2_AMI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceTypeCStr(ResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceType::EC2_INSTANCE:
-            return "EC2_INSTANCE";
-          case ResourceType::EC2_HOST:
-            return "EC2_HOST";
-          case ResourceType::EC2_AMI:
-            return "EC2_AMI";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceType(ResourceType enumValue)
+        {
+          return GetNameForResourceTypeCStr(enumValue);
         }
 
       } // namespace ResourceTypeMapper
@@ -35,6 +35,11 @@ namespace AccessDirectionMapper
 AWS_LIGHTSAIL_API AccessDirection GetAccessDirectionForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForAccessDirection(AccessDirection value);
+
+/**
+ * Same as GetNameForAccessDirection(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForAccessDirectionCStr(AccessDirection value);
 } // namespace AccessDirectionMapper
 } // namespace Model
 } // namespace Lightsail
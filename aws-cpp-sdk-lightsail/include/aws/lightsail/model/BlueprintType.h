@@ -35,6 +35,11 @@ namespace BlueprintTypeMapper
 AWS_LIGHTSAIL_API BlueprintType GetBlueprintTypeForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForBlueprintType(BlueprintType value);
+
+/**
+ * Same as GetNameForBlueprintType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForBlueprintTypeCStr(BlueprintType value);
 } // namespace BlueprintTypeMapper
 } // namespace Model
 } // namespace Lightsail
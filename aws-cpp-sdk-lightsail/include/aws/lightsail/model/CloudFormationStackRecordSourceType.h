@@ -34,6 +34,11 @@ namespace CloudFormationStackRecordSourceTypeMapper
 AWS_LIGHTSAIL_API CloudFormationStackRecordSourceType GetCloudFormationStackRecordSourceTypeForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForCloudFormationStackRecordSourceType(CloudFormationStackRecordSourceType value);
+
+/**
+ * Same as GetNameForCloudFormationStackRecordSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForCloudFormationStackRecordSourceTypeCStr(CloudFormationStackRecordSourceType value);
 } // namespace CloudFormationStackRecordSourceTypeMapper
 } // namespace Model
 } // namespace Lightsail
@@ -37,6 +37,11 @@ namespace DiskSnapshotStateMapper
 AWS_LIGHTSAIL_API DiskSnapshotState GetDiskSnapshotStateForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForDiskSnapshotState(DiskSnapshotState value);
+
+/**
+ * Same as GetNameForDiskSnapshotState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForDiskSnapshotStateCStr(DiskSnapshotState value);
 } // namespace DiskSnapshotStateMapper
 } // namespace Model
 } // namespace Lightsail
@@ -38,6 +38,11 @@ namespace DiskStateMapper
 AWS_LIGHTSAIL_API DiskState GetDiskStateForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForDiskState(DiskState value);
+
+/**
+ * Same as GetNameForDiskState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForDiskStateCStr(DiskState value);
 } // namespace DiskStateMapper
 } // namespace Model
 } // namespace Lightsail
@@ -35,6 +35,11 @@ namespace ExportSnapshotRecordSourceTypeMapper
 AWS_LIGHTSAIL_API ExportSnapshotRecordSourceType GetExportSnapshotRecordSourceTypeForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForExportSnapshotRecordSourceType(ExportSnapshotRecordSourceType value);
+
+/**
+ * Same as GetNameForExportSnapshotRecordSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForExportSnapshotRecordSourceTypeCStr(ExportSnapshotRecordSourceType value);
 } // namespace ExportSnapshotRecordSourceTypeMapper
 } // namespace Model
 } // namespace Lightsail
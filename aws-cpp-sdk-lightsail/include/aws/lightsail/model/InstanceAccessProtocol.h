@@ -35,6 +35,11 @@ namespace InstanceAccessProtocolMapper
 AWS_LIGHTSAIL_API InstanceAccessProtocol GetInstanceAccessProtocolForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForInstanceAccessProtocol(InstanceAccessProtocol value);
+
+/**
+ * Same as GetNameForInstanceAccessProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForInstanceAccessProtocolCStr(InstanceAccessProtocol value);
 } // namespace InstanceAccessProtocolMapper
 } // namespace Model
 } // namespace Lightsail
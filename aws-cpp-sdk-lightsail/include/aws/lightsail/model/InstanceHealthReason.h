@@ -44,6 +44,11 @@ namespace InstanceHealthReasonMapper
 AWS_LIGHTSAIL_API InstanceHealthReason GetInstanceHealthReasonForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForInstanceHealthReason(InstanceHealthReason value);
+
+/**
+ * Same as GetNameForInstanceHealthReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForInstanceHealthReasonCStr(InstanceHealthReason value);
 } // namespace InstanceHealthReasonMapper
 } // namespace Model
 } // namespace Lightsail
@@ -39,6 +39,11 @@ namespace InstanceHealthStateMapper
 AWS_LIGHTSAIL_API InstanceHealthState GetInstanceHealthStateForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForInstanceHealthState(InstanceHealthState value);
+
+/**
+ * Same as GetNameForInstanceHealthState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForInstanceHealthStateCStr(InstanceHealthState value);
 } // namespace InstanceHealthStateMapper
 } // namespace Model
 } // namespace Lightsail
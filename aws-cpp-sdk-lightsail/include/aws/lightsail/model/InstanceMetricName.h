@@ -39,6 +39,11 @@ namespace InstanceMetricNameMapper
 AWS_LIGHTSAIL_API InstanceMetricName GetInstanceMetricNameForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForInstanceMetricName(InstanceMetricName value);
+
+/**
+ * Same as GetNameForInstanceMetricName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForInstanceMetricNameCStr(InstanceMetricName value);
 } // namespace InstanceMetricNameMapper
 } // namespace Model
 } // namespace Lightsail
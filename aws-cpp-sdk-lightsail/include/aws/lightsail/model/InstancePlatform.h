@@ -35,6 +35,11 @@ namespace InstancePlatformMapper
 AWS_LIGHTSAIL_API InstancePlatform GetInstancePlatformForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForInstancePlatform(InstancePlatform value);
+
+/**
+ * Same as GetNameForInstancePlatform(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForInstancePlatformCStr(InstancePlatform value);
 } // namespace InstancePlatformMapper
 } // namespace Model
 } // namespace Lightsail
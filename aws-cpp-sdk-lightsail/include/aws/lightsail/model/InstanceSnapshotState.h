@@ -36,6 +36,11 @@ namespace InstanceSnapshotStateMapper
 AWS_LIGHTSAIL_API InstanceSnapshotState GetInstanceSnapshotStateForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForInstanceSnapshotState(InstanceSnapshotState value);
+
+/**
+ * Same as GetNameForInstanceSnapshotState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForInstanceSnapshotStateCStr(InstanceSnapshotState value);
 } // namespace InstanceSnapshotStateMapper
 } // namespace Model
 } // namespace Lightsail
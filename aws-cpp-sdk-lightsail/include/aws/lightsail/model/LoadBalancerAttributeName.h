@@ -36,6 +36,11 @@ namespace LoadBalancerAttributeNameMapper
 AWS_LIGHTSAIL_API LoadBalancerAttributeName GetLoadBalancerAttributeNameForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerAttributeName(LoadBalancerAttributeName value);
+
+/**
+ * Same as GetNameForLoadBalancerAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerAttributeNameCStr(LoadBalancerAttributeName value);
 } // namespace LoadBalancerAttributeNameMapper
 } // namespace Model
 } // namespace Lightsail
@@ -45,6 +45,11 @@ namespace LoadBalancerMetricNameMapper
 AWS_LIGHTSAIL_API LoadBalancerMetricName GetLoadBalancerMetricNameForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerMetricName(LoadBalancerMetricName value);
+
+/**
+ * Same as GetNameForLoadBalancerMetricName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerMetricNameCStr(LoadBalancerMetricName value);
 } // namespace LoadBalancerMetricNameMapper
 } // namespace Model
 } // namespace Lightsail
@@ -35,6 +35,11 @@ namespace LoadBalancerProtocolMapper
 AWS_LIGHTSAIL_API LoadBalancerProtocol GetLoadBalancerProtocolForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerProtocol(LoadBalancerProtocol value);
+
+/**
+ * Same as GetNameForLoadBalancerProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerProtocolCStr(LoadBalancerProtocol value);
 } // namespace LoadBalancerProtocolMapper
 } // namespace Model
 } // namespace Lightsail
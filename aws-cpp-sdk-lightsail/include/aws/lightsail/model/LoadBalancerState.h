@@ -38,6 +38,11 @@ namespace LoadBalancerStateMapper
 AWS_LIGHTSAIL_API LoadBalancerState GetLoadBalancerStateForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerState(LoadBalancerState value);
+
+/**
+ * Same as GetNameForLoadBalancerState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerStateCStr(LoadBalancerState value);
 } // namespace LoadBalancerStateMapper
 } // namespace Model
 } // namespace Lightsail
@@ -36,6 +36,11 @@ namespace LoadBalancerTlsCertificateDomainStatusMapper
 AWS_LIGHTSAIL_API LoadBalancerTlsCertificateDomainStatus GetLoadBalancerTlsCertificateDomainStatusForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerTlsCertificateDomainStatus(LoadBalancerTlsCertificateDomainStatus value);
+
+/**
+ * Same as GetNameForLoadBalancerTlsCertificateDomainStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerTlsCertificateDomainStatusCStr(LoadBalancerTlsCertificateDomainStatus value);
 } // namespace LoadBalancerTlsCertificateDomainStatusMapper
 } // namespace Model
 } // namespace Lightsail
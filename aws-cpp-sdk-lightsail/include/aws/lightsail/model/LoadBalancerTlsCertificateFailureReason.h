@@ -38,6 +38,11 @@ namespace LoadBalancerTlsCertificateFailureReasonMapper
 AWS_LIGHTSAIL_API LoadBalancerTlsCertificateFailureReason GetLoadBalancerTlsCertificateFailureReasonForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerTlsCertificateFailureReason(LoadBalancerTlsCertificateFailureReason value);
+
+/**
+ * Same as GetNameForLoadBalancerTlsCertificateFailureReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerTlsCertificateFailureReasonCStr(LoadBalancerTlsCertificateFailureReason value);
 } // namespace LoadBalancerTlsCertificateFailureReasonMapper
 } // namespace Model
 } // namespace Lightsail
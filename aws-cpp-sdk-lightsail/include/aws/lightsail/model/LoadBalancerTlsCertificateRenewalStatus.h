@@ -37,6 +37,11 @@ namespace LoadBalancerTlsCertificateRenewalStatusMapper
 AWS_LIGHTSAIL_API LoadBalancerTlsCertificateRenewalStatus GetLoadBalancerTlsCertificateRenewalStatusForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerTlsCertificateRenewalStatus(LoadBalancerTlsCertificateRenewalStatus value);
+
+/**
+ * Same as GetNameForLoadBalancerTlsCertificateRenewalStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerTlsCertificateRenewalStatusCStr(LoadBalancerTlsCertificateRenewalStatus value);
 } // namespace LoadBalancerTlsCertificateRenewalStatusMapper
 } // namespace Model
 } // namespace Lightsail
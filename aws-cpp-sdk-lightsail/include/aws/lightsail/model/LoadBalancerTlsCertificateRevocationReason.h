@@ -43,6 +43,11 @@ namespace LoadBalancerTlsCertificateRevocationReasonMapper
 AWS_LIGHTSAIL_API LoadBalancerTlsCertificateRevocationReason GetLoadBalancerTlsCertificateRevocationReasonForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerTlsCertificateRevocationReason(LoadBalancerTlsCertificateRevocationReason value);
+
+/**
+ * Same as GetNameForLoadBalancerTlsCertificateRevocationReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerTlsCertificateRevocationReasonCStr(LoadBalancerTlsCertificateRevocationReason value);
 } // namespace LoadBalancerTlsCertificateRevocationReasonMapper
 } // namespace Model
 } // namespace Lightsail
@@ -41,6 +41,11 @@ namespace LoadBalancerTlsCertificateStatusMapper
 AWS_LIGHTSAIL_API LoadBalancerTlsCertificateStatus GetLoadBalancerTlsCertificateStatusForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerTlsCertificateStatus(LoadBalancerTlsCertificateStatus value);
+
+/**
+ * Same as GetNameForLoadBalancerTlsCertificateStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerTlsCertificateStatusCStr(LoadBalancerTlsCertificateStatus value);
 } // namespace LoadBalancerTlsCertificateStatusMapper
 } // namespace Model
 } // namespace Lightsail
@@ -38,6 +38,11 @@ namespace MetricStatisticMapper
 AWS_LIGHTSAIL_API MetricStatistic GetMetricStatisticForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForMetricStatistic(MetricStatistic value);
+
+/**
+ * Same as GetNameForMetricStatistic(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForMetricStatisticCStr(MetricStatistic value);
 } // namespace MetricStatisticMapper
 } // namespace Model
 } // namespace Lightsail
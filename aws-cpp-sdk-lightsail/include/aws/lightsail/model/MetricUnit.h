@@ -60,6 +60,11 @@ namespace MetricUnitMapper
 AWS_LIGHTSAIL_API MetricUnit GetMetricUnitForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForMetricUnit(MetricUnit value);
+
+/**
+ * Same as GetNameForMetricUnit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForMetricUnitCStr(MetricUnit value);
 } // namespace MetricUnitMapper
 } // namespace Model
 } // namespace Lightsail
@@ -36,6 +36,11 @@ namespace NetworkProtocolMapper
 AWS_LIGHTSAIL_API NetworkProtocol GetNetworkProtocolForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForNetworkProtocol(NetworkProtocol value);
+
+/**
+ * Same as GetNameForNetworkProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForNetworkProtocolCStr(NetworkProtocol value);
 } // namespace NetworkProtocolMapper
 } // namespace Model
 } // namespace Lightsail
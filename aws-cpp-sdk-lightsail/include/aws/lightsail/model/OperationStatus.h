@@ -38,6 +38,11 @@ namespace OperationStatusMapper
 AWS_LIGHTSAIL_API OperationStatus GetOperationStatusForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForOperationStatus(OperationStatus value);
+
+/**
+ * Same as GetNameForOperationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForOperationStatusCStr(OperationStatus value);
 } // namespace OperationStatusMapper
 } // namespace Model
 } // namespace Lightsail
@@ -77,6 +77,11 @@ namespace OperationTypeMapper
 AWS_LIGHTSAIL_API OperationType GetOperationTypeForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForOperationType(OperationType value);
+
+/**
+ * Same as GetNameForOperationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForOperationTypeCStr(OperationType value);
 } // namespace OperationTypeMapper
 } // namespace Model
 } // namespace Lightsail
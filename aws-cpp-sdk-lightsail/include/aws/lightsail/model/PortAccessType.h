@@ -35,6 +35,11 @@ namespace PortAccessTypeMapper
 AWS_LIGHTSAIL_API PortAccessType GetPortAccessTypeForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForPortAccessType(PortAccessType value);
+
+/**
+ * Same as GetNameForPortAccessType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForPortAccessTypeCStr(PortAccessType value);
 } // namespace PortAccessTypeMapper
 } // namespace Model
 } // namespace Lightsail
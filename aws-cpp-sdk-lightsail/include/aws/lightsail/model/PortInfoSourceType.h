@@ -36,6 +36,11 @@ namespace PortInfoSourceTypeMapper
 AWS_LIGHTSAIL_API PortInfoSourceType GetPortInfoSourceTypeForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForPortInfoSourceType(PortInfoSourceType value);
+
+/**
+ * Same as GetNameForPortInfoSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForPortInfoSourceTypeCStr(PortInfoSourceType value);
 } // namespace PortInfoSourceTypeMapper
 } // namespace Model
 } // namespace Lightsail
@@ -35,6 +35,11 @@ namespace PortStateMapper
 AWS_LIGHTSAIL_API PortState GetPortStateForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForPortState(PortState value);
+
+/**
+ * Same as GetNameForPortState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForPortStateCStr(PortState value);
 } // namespace PortStateMapper
 } // namespace Model
 } // namespace Lightsail
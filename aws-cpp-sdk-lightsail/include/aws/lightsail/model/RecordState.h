@@ -36,6 +36,11 @@ namespace RecordStateMapper
 AWS_LIGHTSAIL_API RecordState GetRecordStateForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForRecordState(RecordState value);
+
+/**
+ * Same as GetNameForRecordState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForRecordStateCStr(RecordState value);
 } // namespace RecordStateMapper
 } // namespace Model
 } // namespace Lightsail
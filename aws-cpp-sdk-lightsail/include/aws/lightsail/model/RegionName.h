@@ -47,6 +47,11 @@ namespace RegionNameMapper
 AWS_LIGHTSAIL_API RegionName GetRegionNameForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForRegionName(RegionName value);
+
+/**
+ * Same as GetNameForRegionName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForRegionNameCStr(RegionName value);
 } // namespace RegionNameMapper
 } // namespace Model
 } // namespace Lightsail
@@ -34,6 +34,11 @@ namespace RelationalDatabaseEngineMapper
 AWS_LIGHTSAIL_API RelationalDatabaseEngine GetRelationalDatabaseEngineForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForRelationalDatabaseEngine(RelationalDatabaseEngine value);
+
+/**
+ * Same as GetNameForRelationalDatabaseEngine(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForRelationalDatabaseEngineCStr(RelationalDatabaseEngine value);
 } // namespace RelationalDatabaseEngineMapper
 } // namespace Model
 } // namespace Lightsail
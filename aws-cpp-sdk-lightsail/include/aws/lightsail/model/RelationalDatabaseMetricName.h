@@ -39,6 +39,11 @@ namespace RelationalDatabaseMetricNameMapper
 AWS_LIGHTSAIL_API RelationalDatabaseMetricName GetRelationalDatabaseMetricNameForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForRelationalDatabaseMetricName(RelationalDatabaseMetricName value);
+
+/**
+ * Same as GetNameForRelationalDatabaseMetricName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForRelationalDatabaseMetricNameCStr(RelationalDatabaseMetricName value);
 } // namespace RelationalDatabaseMetricNameMapper
 } // namespace Model
 } // namespace Lightsail
@@ -36,6 +36,11 @@ namespace RelationalDatabasePasswordVersionMapper
 AWS_LIGHTSAIL_API RelationalDatabasePasswordVersion GetRelationalDatabasePasswordVersionForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForRelationalDatabasePasswordVersion(RelationalDatabasePasswordVersion value);
+
+/**
+ * Same as GetNameForRelationalDatabasePasswordVersion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForRelationalDatabasePasswordVersionCStr(RelationalDatabasePasswordVersion value);
 } // namespace RelationalDatabasePasswordVersionMapper
 } // namespace Model
 } // namespace Lightsail
@@ -47,6 +47,11 @@ namespace ResourceTypeMapper
 AWS_LIGHTSAIL_API ResourceType GetResourceTypeForName(const Aws::String& name);
 
 AWS_LIGHTSAIL_API Aws::String GetNameForResourceType(ResourceType value);
+
+/**
+ * Same as GetNameForResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_LIGHTSAIL_API const char* GetNameForResourceTypeCStr(ResourceType value);
 } // namespace ResourceTypeMapper
 } // namespace Model
 } // namespace Lightsail
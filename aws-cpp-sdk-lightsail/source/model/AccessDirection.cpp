@@ -30,20 +30,37 @@ namespace Aws
       namespace AccessDirectionMapper
       {
 
-        static const int inbound_HASH = HashingUtils::HashString("inbound");
-        static const int outbound_HASH = HashingUtils::HashString("outbound");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "inbound",
+          "outbound",
+        };
 
         AccessDirection GetAccessDirectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == inbound_HASH)
-          {
-            return AccessDirection::inbound;
-          }
-          else if (hashCode == outbound_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccessDirection::outbound;
+          case 1941740409:
+            if (name == "inbound")
+            {
+              return AccessDirection::inbound;
+            }
+            break;
+          case 57076464:
+            if (name == "outbound")
+            {
+              return AccessDirection::outbound;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AccessDirection::NOT_SET;
         }
 
-        Aws::String GetNameForAccessDirection(AccessDirection enumValue)
+        const char* GetNameForAccessDirectionCStr(AccessDirection enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccessDirection::inbound:
-            return "inbound";
-          case AccessDirection::outbound:
-            return "outbound";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccessDirection(AccessDirection enumValue)
+        {
+          return GetNameForAccessDirectionCStr(enumValue);
         }
 
       } // namespace AccessDirectionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace BlueprintTypeMapper
       {
 
-        static const int os_HASH = HashingUtils::HashString("os");
-        static const int app_HASH = HashingUtils::HashString("app");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "os",
+          "app",
+        };
 
         BlueprintType GetBlueprintTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == os_HASH)
-          {
-            return BlueprintType::os;
-          }
-          else if (hashCode == app_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BlueprintType::app;
+          case 3556:
+            if (name == "os")
+            {
+              return BlueprintType::os;
+            }
+            break;
+          case 96801:
+            if (name == "app")
+            {
+              return BlueprintType::app;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BlueprintType::NOT_SET;
         }
 
-        Aws::String GetNameForBlueprintType(BlueprintType enumValue)
+        const char* GetNameForBlueprintTypeCStr(BlueprintType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BlueprintType::os:
-            return "os";
-          case BlueprintType::app:
-            return "app";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBlueprintType(BlueprintType enumValue)
+        {
+          return GetNameForBlueprintTypeCStr(enumValue);
         }
 
       } // namespace BlueprintTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace CloudFormationStackRecordSourceTypeMapper
       {
 
-        static const int ExportSnapshotRecord_HASH = HashingUtils::HashString("ExportSnapshotRecord");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ExportSnapshotRecord",
+        };
 
         CloudFormationStackRecordSourceType GetCloudFormationStackRecordSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ExportSnapshotRecord_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CloudFormationStackRecordSourceType::ExportSnapshotRecord;
+          case 1297503273:
+            if (name == "ExportSnapshotRecord")
+            {
+              return CloudFormationStackRecordSourceType::ExportSnapshotRecord;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return CloudFormationStackRecordSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForCloudFormationStackRecordSourceType(CloudFormationStackRecordSourceType enumValue)
+        const char* GetNameForCloudFormationStackRecordSourceTypeCStr(CloudFormationStackRecordSourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CloudFormationStackRecordSourceType::ExportSnapshotRecord:
-            return "ExportSnapshotRecord";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCloudFormationStackRecordSourceType(CloudFormationStackRecordSourceType enumValue)
+        {
+          return GetNameForCloudFormationStackRecordSourceTypeCStr(enumValue);
         }
 
       } // namespace CloudFormationStackRecordSourceTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace DiskSnapshotStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int completed_HASH = HashingUtils::HashString("completed");
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int unknown_HASH = HashingUtils::HashString("unknown");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "completed",
+          "error",
+          "unknown",
+        };
 
         DiskSnapshotState GetDiskSnapshotStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return DiskSnapshotState::pending;
-          }
-          else if (hashCode == completed_HASH)
-          {
-            return DiskSnapshotState::completed;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return DiskSnapshotState::error;
-          }
-          else if (hashCode == unknown_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DiskSnapshotState::unknown;
+          case -682587753:
+            if (name == "pending")
+            {
+              return DiskSnapshotState::pending;
+            }
+            break;
+          case -1402931637:
+            if (name == "completed")
+            {
+              return DiskSnapshotState::completed;
+            }
+            break;
+          case 96784904:
+            if (name == "error")
+            {
+              return DiskSnapshotState::error;
+            }
+            break;
+          case -284840886:
+            if (name == "unknown")
+            {
+              return DiskSnapshotState::unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DiskSnapshotState::NOT_SET;
         }
 
-        Aws::String GetNameForDiskSnapshotState(DiskSnapshotState enumValue)
+        const char* GetNameForDiskSnapshotStateCStr(DiskSnapshotState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DiskSnapshotState::pending:
-            return "pending";
-          case DiskSnapshotState::completed:
-            return "completed";
-          case DiskSnapshotState::error:
-            return "error";
-          case DiskSnapshotState::unknown:
-            return "unknown";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDiskSnapshotState(DiskSnapshotState enumValue)
+        {
+          return GetNameForDiskSnapshotStateCStr(enumValue);
         }
 
       } // namespace DiskSnapshotStateMapper
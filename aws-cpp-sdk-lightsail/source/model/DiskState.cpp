@@ -30,35 +30,58 @@ namespace Aws
       namespace DiskStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int in_use_HASH = HashingUtils::HashString("in-use");
-        static const int unknown_HASH = HashingUtils::HashString("unknown");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "error",
+          "available",
+          "in-use",
+          "unknown",
+        };
 
         DiskState GetDiskStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DiskState::pending;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return DiskState::error;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return DiskState::available;
-          }
-          else if (hashCode == in_use_HASH)
-          {
-            return DiskState::in_use;
-          }
-          else if (hashCode == unknown_HASH)
-          {
-            return DiskState::unknown;
+          case -682587753:
+            if (name == "pending")
+            {
+              return DiskState::pending;
+            }
+            break;
+          case 96784904:
+            if (name == "error")
+            {
+              return DiskState::error;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return DiskState::available;
+            }
+            break;
+          case -1185862433:
+            if (name == "in-use")
+            {
+              return DiskState::in_use;
+            }
+            break;
+          case -284840886:
+            if (name == "unknown")
+            {
+              return DiskState::unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return DiskState::NOT_SET;
         }
 
-        Aws::String GetNameForDiskState(DiskState enumValue)
+        const char* GetNameForDiskStateCStr(DiskState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DiskState::pending:
-            return "pending";
-          case DiskState::error:
-            return "error";
-          case DiskState::available:
-            return "available";
-          case DiskState::in_use:
-            return "in-use";
-          case DiskState::unknown:
-            return "unknown";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDiskState(DiskState enumValue)
+        {
+          return GetNameForDiskStateCStr(enumValue);
         }
 
       } // namespace DiskStateMapper
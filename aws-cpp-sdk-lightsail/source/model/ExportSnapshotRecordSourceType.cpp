@@ -30,20 +30,37 @@ namespace Aws
       namespace ExportSnapshotRecordSourceTypeMapper
       {
 
-        static const int InstanceSnapshot_HASH = HashingUtils::HashString("InstanceSnapshot");
-        static const int DiskSnapshot_HASH = HashingUtils::HashString("DiskSnapshot");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InstanceSnapshot",
+          "DiskSnapshot",
+        };
 
         ExportSnapshotRecordSourceType GetExportSnapshotRecordSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InstanceSnapshot_HASH)
-          {
-            return ExportSnapshotRecordSourceType::InstanceSnapshot;
-          }
-          else if (hashCode == DiskSnapshot_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExportSnapshotRecordSourceType::DiskSnapshot;
+          case 1773186457:
+            if (name == "InstanceSnapshot")
+            {
+              return ExportSnapshotRecordSourceType::InstanceSnapshot;
+            }
+            break;
+          case -412438879:
+            if (name == "DiskSnapshot")
+            {
+              return ExportSnapshotRecordSourceType::DiskSnapshot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ExportSnapshotRecordSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForExportSnapshotRecordSourceType(ExportSnapshotRecordSourceType enumValue)
+        const char* GetNameForExportSnapshotRecordSourceTypeCStr(ExportSnapshotRecordSourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExportSnapshotRecordSourceType::InstanceSnapshot:
-            return "InstanceSnapshot";
-          case ExportSnapshotRecordSourceType::DiskSnapshot:
-            return "DiskSnapshot";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExportSnapshotRecordSourceType(ExportSnapshotRecordSourceType enumValue)
+        {
+          return GetNameForExportSnapshotRecordSourceTypeCStr(enumValue);
         }
 
       } // namespace ExportSnapshotRecordSourceTypeMapper
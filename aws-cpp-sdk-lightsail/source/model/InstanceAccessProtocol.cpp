@@ -30,20 +30,37 @@ namespace Aws
       namespace InstanceAccessProtocolMapper
       {
 
-        static const int ssh_HASH = HashingUtils::HashString("ssh");
-        static const int rdp_HASH = HashingUtils::HashString("rdp");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ssh",
+          "rdp",
+        };
 
         InstanceAccessProtocol GetInstanceAccessProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ssh_HASH)
-          {
-            return InstanceAccessProtocol::ssh;
-          }
-          else if (hashCode == rdp_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceAccessProtocol::rdp;
+          case 114184:
+            if (name == "ssh")
+            {
+              return InstanceAccessProtocol::ssh;
+            }
+            break;
+          case 112766:
+            if (name == "rdp")
+            {
+              return InstanceAccessProtocol::rdp;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InstanceAccessProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceAccessProtocol(InstanceAccessProtocol enumValue)
+        const char* GetNameForInstanceAccessProtocolCStr(InstanceAccessProtocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceAccessProtocol::ssh:
-            return "ssh";
-          case InstanceAccessProtocol::rdp:
-            return "rdp";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceAccessProtocol(InstanceAccessProtocol enumValue)
+        {
+          return GetNameForInstanceAccessProtocolCStr(enumValue);
         }
 
       } // namespace InstanceAccessProtocolMapper
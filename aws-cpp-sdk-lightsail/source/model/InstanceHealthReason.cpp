@@ -30,65 +30,100 @@ namespace Aws
       namespace InstanceHealthReasonMapper
       {
 
-        static const int Lb_RegistrationInProgress_HASH = HashingUtils::HashString("Lb.RegistrationInProgress");
-        static const int Lb_InitialHealthChecking_HASH = HashingUtils::HashString("Lb.InitialHealthChecking");
-        static const int Lb_InternalError_HASH = HashingUtils::HashString("Lb.InternalError");
-        static const int Instance_ResponseCodeMismatch_HASH = HashingUtils::HashString("Instance.ResponseCodeMismatch");
-        static const int Instance_Timeout_HASH = HashingUtils::HashString("Instance.Timeout");
-        static const int Instance_FailedHealthChecks_HASH = HashingUtils::HashString("Instance.FailedHealthChecks");
-        static const int Instance_NotRegistered_HASH = HashingUtils::HashString("Instance.NotRegistered");
-        static const int Instance_NotInUse_HASH = HashingUtils::HashString("Instance.NotInUse");
-        static const int Instance_DeregistrationInProgress_HASH = HashingUtils::HashString("Instance.DeregistrationInProgress");
-        static const int Instance_InvalidState_HASH = HashingUtils::HashString("Instance.InvalidState");
-        static const int Instance_IpUnusable_HASH = HashingUtils::HashString("Instance.IpUnusable");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Lb.RegistrationInProgress",
+          "Lb.InitialHealthChecking",
+          "Lb.InternalError",
+          "Instance.ResponseCodeMismatch",
+          "Instance.Timeout",
+          "Instance.FailedHealthChecks",
+          "Instance.NotRegistered",
+          "Instance.NotInUse",
+          "Instance.DeregistrationInProgress",
+          "Instance.InvalidState",
+          "Instance.IpUnusable",
+        };
 
         InstanceHealthReason GetInstanceHealthReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Lb_RegistrationInProgress_HASH)
-          {
-            return InstanceHealthReason::Lb_RegistrationInProgress;
-          }
-          else if (hashCode == Lb_InitialHealthChecking_HASH)
-          {
-            return InstanceHealthReason::Lb_InitialHealthChecking;
-          }
-          else if (hashCode == Lb_InternalError_HASH)
-          {
-            return InstanceHealthReason::Lb_InternalError;
-          }
-          else if (hashCode == Instance_ResponseCodeMismatch_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceHealthReason::Instance_ResponseCodeMismatch;
-          }
-          else if (hashCode == Instance_Timeout_HASH)
-          {
-            return InstanceHealthReason::Instance_Timeout;
-          }
-          else if (hashCode == Instance_FailedHealthChecks_HASH)
-          {
-            return InstanceHealthReason::Instance_FailedHealthChecks;
-          }
-          else if (hashCode == Instance_NotRegistered_HASH)
-          {
-            return InstanceHealthReason::Instance_NotRegistered;
-          }
-          else if (hashCode == Instance_NotInUse_HASH)
-          {
-            return InstanceHealthReason::Instance_NotInUse;
-          }
-          else if (hashCode == Instance_DeregistrationInProgress_HASH)
-          {
-            return InstanceHealthReason::Instance_DeregistrationInProgress;
-          }
-          else if (hashCode == Instance_InvalidState_HASH)
-          {
-            return InstanceHealthReason::Instance_InvalidState;
-          }
-          else if (hashCode == Instance_IpUnusable_HASH)
-          {
-            return InstanceHealthReason::Instance_IpUnusable;
+          case -1531907197:
+            if (name == "Lb.RegistrationInProgress")
+            {
+              return InstanceHealthReason::Lb_RegistrationInProgress;
+            }
+            break;
+          case 227052098:
+            if (name == "Lb.InitialHealthChecking")
+            {
+              return InstanceHealthReason::Lb_InitialHealthChecking;
+            }
+            break;
+          case -1908949293:
+            if (name == "Lb.InternalError")
+            {
+              return InstanceHealthReason::Lb_InternalError;
+            }
+            break;
+          case 1620164981:
+            if (name == "Instance.ResponseCodeMismatch")
+            {
+              return InstanceHealthReason::Instance_ResponseCodeMismatch;
+            }
+            break;
+          case 339306760:
+            if (name == "Instance.Timeout")
+            {
+              return InstanceHealthReason::Instance_Timeout;
+            }
+            break;
+          case -389230403:
+            if (name == "Instance.FailedHealthChecks")
+            {
+              return InstanceHealthReason::Instance_FailedHealthChecks;
+            }
+            break;
+          case -288621540:
+            if (name == "Instance.NotRegistered")
+            {
+              return InstanceHealthReason::Instance_NotRegistered;
+            }
+            break;
+          case 1266187336:
+            if (name == "Instance.NotInUse")
+            {
+              return InstanceHealthReason::Instance_NotInUse;
+            }
+            break;
+          case -2139734779:
+            if (name == "Instance.DeregistrationInProgress")
+            {
+              return InstanceHealthReason::Instance_DeregistrationInProgress;
+            }
+            break;
+          case -229926509:
+            if (name == "Instance.InvalidState")
+            {
+              return InstanceHealthReason::Instance_InvalidState;
+            }
+            break;
+          case 1018324497:
+            if (name == "Instance.IpUnusable")
+            {
+              return InstanceHealthReason::Instance_IpUnusable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return InstanceHealthReason::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceHealthReason(InstanceHealthReason enumValue)
+        const char* GetNameForInstanceHealthReasonCStr(InstanceHealthReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceHealthReason::Lb_RegistrationInProgress:
-            return "Lb.RegistrationInProgress";
-          case InstanceHealthReason::Lb_InitialHealthChecking:
-            return "Lb.InitialHealthChecking";
-          case InstanceHealthReason::Lb_InternalError:
-            return "Lb.InternalError";
-          case InstanceHealthReason::Instance_ResponseCodeMismatch:
-            return "Instance.ResponseCodeMismatch";
-          case InstanceHealthReason::Instance_Timeout:
-            return "Instance.Timeout";
-          case InstanceHealthReason::Instance_FailedHealthChecks:
-            return "Instance.FailedHealthChecks";
-          case InstanceHealthReason::Instance_NotRegistered:
-            return "Instance.NotRegistered";
-          case InstanceHealthReason::Instance_NotInUse:
-            return "Instance.NotInUse";
-          case InstanceHealthReason::Instance_DeregistrationInProgress:
-            return "Instance.DeregistrationInProgress";
-          case InstanceHealthReason::Instance_InvalidState:
-            return "Instance.InvalidState";
-          case InstanceHealthReason::Instance_IpUnusable:
-            return "Instance.IpUnusable";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceHealthReason(InstanceHealthReason enumValue)
+        {
+          return GetNameForInstanceHealthReasonCStr(enumValue);
         }
 
       } // namespace InstanceHealthReasonMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace InstanceHealthStateMapper
       {
 
-        static const int initial_HASH = HashingUtils::HashString("initial");
-        static const int healthy_HASH = HashingUtils::HashString("healthy");
-        static const int unhealthy_HASH = HashingUtils::HashString("unhealthy");
-        static const int unused_HASH = HashingUtils::HashString("unused");
-        static const int draining_HASH = HashingUtils::HashString("draining");
-        static const int unavailable_HASH = HashingUtils::HashString("unavailable");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "initial",
+          "healthy",
+          "unhealthy",
+          "unused",
+          "draining",
+          "unavailable",
+        };
 
         InstanceHealthState GetInstanceHealthStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == initial_HASH)
-          {
-            return InstanceHealthState::initial;
-          }
-          else if (hashCode == healthy_HASH)
-          {
-            return InstanceHealthState::healthy;
-          }
-          else if (hashCode == unhealthy_HASH)
-          {
-            return InstanceHealthState::unhealthy;
-          }
-          else if (hashCode == unused_HASH)
-          {
-            return InstanceHealthState::unused;
-          }
-          else if (hashCode == draining_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceHealthState::draining;
-          }
-          else if (hashCode == unavailable_HASH)
-          {
-            return InstanceHealthState::unavailable;
+          case 1948342084:
+            if (name == "initial")
+            {
+              return InstanceHealthState::initial;
+            }
+            break;
+          case 795560349:
+            if (name == "healthy")
+            {
+              return InstanceHealthState::healthy;
+            }
+            break;
+          case -1787605788:
+            if (name == "unhealthy")
+            {
+              return InstanceHealthState::unhealthy;
+            }
+            break;
+          case -840170026:
+            if (name == "unused")
+            {
+              return InstanceHealthState::unused;
+            }
+            break;
+          case -839042326:
+            if (name == "draining")
+            {
+              return InstanceHealthState::draining;
+            }
+            break;
+          case -665462704:
+            if (name == "unavailable")
+            {
+              return InstanceHealthState::unavailable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return InstanceHealthState::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceHealthState(InstanceHealthState enumValue)
+        const char* GetNameForInstanceHealthStateCStr(InstanceHealthState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceHealthState::initial:
-            return "initial";
-          case InstanceHealthState::healthy:
-            return "healthy";
-          case InstanceHealthState::unhealthy:
-            return "unhealthy";
-          case InstanceHealthState::unused:
-            return "unused";
-          case InstanceHealthState::draining:
-            return "draining";
-          case InstanceHealthState::unavailable:
-            return "unavailable";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceHealthState(InstanceHealthState enumValue)
+        {
+          return GetNameForInstanceHealthStateCStr(enumValue);
         }
 
       } // namespace InstanceHealthStateMapper
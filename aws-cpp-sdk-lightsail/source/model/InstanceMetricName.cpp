@@ -30,40 +30,65 @@ namespace Aws
       namespace InstanceMetricNameMapper
       {
 
-        static const int CPUUtilization_HASH = HashingUtils::HashString("CPUUtilization");
-        static const int NetworkIn_HASH = HashingUtils::HashString("NetworkIn");
-        static const int NetworkOut_HASH = HashingUtils::HashString("NetworkOut");
-        static const int StatusCheckFailed_HASH = HashingUtils::HashString("StatusCheckFailed");
-        static const int StatusCheckFailed_Instance_HASH = HashingUtils::HashString("StatusCheckFailed_Instance");
-        static const int StatusCheckFailed_System_HASH = HashingUtils::HashString("StatusCheckFailed_System");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CPUUtilization",
+          "NetworkIn",
+          "NetworkOut",
+          "StatusCheckFailed",
+          "StatusCheckFailed_Instance",
+          "StatusCheckFailed_System",
+        };
 
         InstanceMetricName GetInstanceMetricNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CPUUtilization_HASH)
-          {
-            return InstanceMetricName::CPUUtilization;
-          }
-          else if (hashCode == NetworkIn_HASH)
-          {
-            return InstanceMetricName::NetworkIn;
-          }
-          else if (hashCode == NetworkOut_HASH)
-          {
-            return InstanceMetricName::NetworkOut;
-          }
-          else if (hashCode == StatusCheckFailed_HASH)
-          {
-            return InstanceMetricName::StatusCheckFailed;
-          }
-          else if (hashCode == StatusCheckFailed_Instance_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceMetricName::StatusCheckFailed_Instance;
-          }
-          else if (hashCode == StatusCheckFailed_System_HASH)
-          {
-            return InstanceMetricName::StatusCheckFailed_System;
+          case -2140435590:
+            if (name == "CPUUtilization")
+            {
+              return InstanceMetricName::CPUUtilization;
+            }
+            break;
+          case -228216877:
+            if (name == "NetworkIn")
+            {
+              return InstanceMetricName::NetworkIn;
+            }
+            break;
+          case 1515217504:
+            if (name == "NetworkOut")
+            {
+              return InstanceMetricName::NetworkOut;
+            }
+            break;
+          case -1300722701:
+            if (name == "StatusCheckFailed")
+            {
+              return InstanceMetricName::StatusCheckFailed;
+            }
+            break;
+          case -2130681983:
+            if (name == "StatusCheckFailed_Instance")
+            {
+              return InstanceMetricName::StatusCheckFailed_Instance;
+            }
+            break;
+          case 714344475:
+            if (name == "StatusCheckFailed_System")
+            {
+              return InstanceMetricName::StatusCheckFailed_System;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return InstanceMetricName::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceMetricName(InstanceMetricName enumValue)
+        const char* GetNameForInstanceMetricNameCStr(InstanceMetricName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceMetricName::CPUUtilization:
-            return "CPUUtilization";
-          case InstanceMetricName::NetworkIn:
-            return "NetworkIn";
-          case InstanceMetricName::NetworkOut:
-            return "NetworkOut";
-          case InstanceMetricName::StatusCheckFailed:
-            return "StatusCheckFailed";
-          case InstanceMetricName::StatusCheckFailed_Instance:
-            return "StatusCheckFailed_Instance";
-          case InstanceMetricName::StatusCheckFailed_System:
-            return "StatusCheckFailed_System";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceMetricName(InstanceMetricName enumValue)
+        {
+          return GetNameForInstanceMetricNameCStr(enumValue);
         }
 
       } // namespace InstanceMetricNameMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace InstancePlatformMapper
       {
 
-        static const int LINUX_UNIX_HASH = HashingUtils::HashString("LINUX_UNIX");
-        static const int WINDOWS_HASH = HashingUtils::HashString("WINDOWS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LINUX_UNIX",
+          "WINDOWS",
+        };
 
         InstancePlatform GetInstancePlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LINUX_UNIX_HASH)
-          {
-            return InstancePlatform::LINUX_UNIX;
-          }
-          else if (hashCode == WINDOWS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstancePlatform::WINDOWS;
+          case -1611950573:
+            if (name == "LINUX_UNIX")
+            {
+              return InstancePlatform::LINUX_UNIX;
+            }
+            break;
+          case 2067476067:
+            if (name == "WINDOWS")
+            {
+              return InstancePlatform::WINDOWS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InstancePlatform::NOT_SET;
         }
 
-        Aws::String GetNameForInstancePlatform(InstancePlatform enumValue)
+        const char* GetNameForInstancePlatformCStr(InstancePlatform enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstancePlatform::LINUX_UNIX:
-            return "LINUX_UNIX";
-          case InstancePlatform::WINDOWS:
-            return "WINDOWS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstancePlatform(InstancePlatform enumValue)
+        {
+          return GetNameForInstancePlatformCStr(enumValue);
         }
 
       } // namespace InstancePlatformMapper
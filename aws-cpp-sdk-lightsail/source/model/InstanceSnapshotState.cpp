@@ -30,25 +30,44 @@ namespace Aws
       namespace InstanceSnapshotStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int available_HASH = HashingUtils::HashString("available");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "pending",
+          "error",
+          "available",
+        };
 
         InstanceSnapshotState GetInstanceSnapshotStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
-          {
-            return InstanceSnapshotState::pending;
-          }
-          else if (hashCode == error_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceSnapshotState::error;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return InstanceSnapshotState::available;
+          case -682587753:
+            if (name == "pending")
+            {
+              return InstanceSnapshotState::pending;
+            }
+            break;
+          case 96784904:
+            if (name == "error")
+            {
+              return InstanceSnapshotState::error;
+            }
+            break;
+          case -733902135:
+            if (name == "available")
+            {
+              return InstanceSnapshotState::available;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InstanceSnapshotState::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceSnapshotState(InstanceSnapshotState enumValue)
+        const char* GetNameForInstanceSnapshotStateCStr(InstanceSnapshotState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceSnapshotState::pending:
-            return "pending";
-          case InstanceSnapshotState::error:
-            return "error";
-          case InstanceSnapshotState::available:
-            return "available";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceSnapshotState(InstanceSnapshotState enumValue)
+        {
+          return GetNameForInstanceSnapshotStateCStr(enumValue);
         }
 
       } // namespace InstanceSnapshotStateMapper
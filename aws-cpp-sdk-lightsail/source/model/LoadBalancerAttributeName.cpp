@@ -30,25 +30,44 @@ namespace Aws
       namespace LoadBalancerAttributeNameMapper
       {
 
-        static const int HealthCheckPath_HASH = HashingUtils::HashString("HealthCheckPath");
-        static const int SessionStickinessEnabled_HASH = HashingUtils::HashString("SessionStickinessEnabled");
-        static const int SessionStickiness_LB_CookieDurationSeconds_HASH = HashingUtils::HashString("SessionStickiness_LB_CookieDurationSeconds");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HealthCheckPath",
+          "SessionStickinessEnabled",
+          "SessionStickiness_LB_CookieDurationSeconds",
+        };
 
         LoadBalancerAttributeName GetLoadBalancerAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HealthCheckPath_HASH)
-          {
-            return LoadBalancerAttributeName::HealthCheckPath;
-          }
-          else if (hashCode == SessionStickinessEnabled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerAttributeName::SessionStickinessEnabled;
-          }
-          else if (hashCode == SessionStickiness_LB_CookieDurationSeconds_HASH)
-          {
-            return LoadBalancerAttributeName::SessionStickiness_LB_CookieDurationSeconds;
+          case 1165407793:
+            if (name == "HealthCheckPath")
+            {
+              return LoadBalancerAttributeName::HealthCheckPath;
+            }
+            break;
+          case -1027107429:
+            if (name == "SessionStickinessEnabled")
+            {
+              return LoadBalancerAttributeName::SessionStickinessEnabled;
+            }
+            break;
+          case 414095479:
+            if (name == "SessionStickiness_LB_CookieDurationSeconds")
+            {
+              return LoadBalancerAttributeName::SessionStickiness_LB_CookieDurationSeconds;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return LoadBalancerAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerAttributeName(LoadBalancerAttributeName enumValue)
+        const char* GetNameForLoadBalancerAttributeNameCStr(LoadBalancerAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerAttributeName::HealthCheckPath:
-            return "HealthCheckPath";
-          case LoadBalancerAttributeName::SessionStickinessEnabled:
-            return "SessionStickinessEnabled";
-          case LoadBalancerAttributeName::SessionStickiness_LB_CookieDurationSeconds:
-            return "SessionStickiness_LB_CookieDurationSeconds";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerAttributeName(LoadBalancerAttributeName enumValue)
+        {
+          return GetNameForLoadBalancerAttributeNameCStr(enumValue);
         }
 
       } // namespace LoadBalancerAttributeNameMapper
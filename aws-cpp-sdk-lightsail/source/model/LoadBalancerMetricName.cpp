@@ -30,70 +30,107 @@ namespace Aws
       namespace LoadBalancerMetricNameMapper
       {
 
-        static const int ClientTLSNegotiationErrorCount_HASH = HashingUtils::HashString("ClientTLSNegotiationErrorCount");
-        static const int HealthyHostCount_HASH = HashingUtils::HashString("HealthyHostCount");
-        static const int UnhealthyHostCount_HASH = HashingUtils::HashString("UnhealthyHostCount");
-        static const int HTTPCode_LB_4XX_Count_HASH = HashingUtils::HashString("HTTPCode_LB_4XX_Count");
-        static const int HTTPCode_LB_5XX_Count_HASH = HashingUtils::HashString("HTTPCode_LB_5XX_Count");
-        static const int HTTPCode_Instance_2XX_Count_HASH = HashingUtils::HashString("HTTPCode_Instance_2XX_Count");
-        static const int HTTPCode_Instance_3XX_Count_HASH = HashingUtils::HashString("HTTPCode_Instance_3XX_Count");
-        static const int HTTPCode_Instance_4XX_Count_HASH = HashingUtils::HashString("HTTPCode_Instance_4XX_Count");
-        static const int HTTPCode_Instance_5XX_Count_HASH = HashingUtils::HashString("HTTPCode_Instance_5XX_Count");
-        static const int InstanceResponseTime_HASH = HashingUtils::HashString("InstanceResponseTime");
-        static const int RejectedConnectionCount_HASH = HashingUtils::HashString("RejectedConnectionCount");
-        static const int RequestCount_HASH = HashingUtils::HashString("RequestCount");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ClientTLSNegotiationErrorCount",
+          "HealthyHostCount",
+          "UnhealthyHostCount",
+          "HTTPCode_LB_4XX_Count",
+          "HTTPCode_LB_5XX_Count",
+          "HTTPCode_Instance_2XX_Count",
+          "HTTPCode_Instance_3XX_Count",
+          "HTTPCode_Instance_4XX_Count",
+          "HTTPCode_Instance_5XX_Count",
+          "InstanceResponseTime",
+          "RejectedConnectionCount",
+          "RequestCount",
+        };
 
         LoadBalancerMetricName GetLoadBalancerMetricNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ClientTLSNegotiationErrorCount_HASH)
-          {
-            return LoadBalancerMetricName::ClientTLSNegotiationErrorCount;
-          }
-          else if (hashCode == HealthyHostCount_HASH)
-          {
-            return LoadBalancerMetricName::HealthyHostCount;
-          }
-          else if (hashCode == UnhealthyHostCount_HASH)
-          {
-            return LoadBalancerMetricName::UnhealthyHostCount;
-          }
-          else if (hashCode == HTTPCode_LB_4XX_Count_HASH)
-          {
-            return LoadBalancerMetricName::HTTPCode_LB_4XX_Count;
-          }
-          else if (hashCode == HTTPCode_LB_5XX_Count_HASH)
-          {
-            return LoadBalancerMetricName::HTTPCode_LB_5XX_Count;
-          }
-          else if (hashCode == HTTPCode_Instance_2XX_Count_HASH)
-          {
-            return LoadBalancerMetricName::HTTPCode_Instance_2XX_Count;
-          }
-          else if (hashCode == HTTPCode_Instance_3XX_Count_HASH)
-          {
-            return LoadBalancerMetricName::HTTPCode_Instance_3XX_Count;
-          }
-          else if (hashCode == HTTPCode_Instance_4XX_Count_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerMetricName::HTTPCode_Instance_4XX_Count;
-          }
-          else if (hashCode == HTTPCode_Instance_5XX_Count_HASH)
-          {
-            return LoadBalancerMetricName::HTTPCode_Instance_5XX_Count;
-          }
-          else if (hashCode == InstanceResponseTime_HASH)
-          {
-            return LoadBalancerMetricName::InstanceResponseTime;
-          }
-          else if (hashCode == RejectedConnectionCount_HASH)
-          {
-            return LoadBalancerMetricName::RejectedConnectionCount;
-          }
-          else if (hashCode == RequestCount_HASH)
-          {
-            return LoadBalancerMetricName::RequestCount;
+          case -1459615880:
+            if (name == "ClientTLSNegotiationErrorCount")
+            {
+              return LoadBalancerMetricName::ClientTLSNegotiationErrorCount;
+            }
+            break;
+          case -735424694:
+            if (name == "HealthyHostCount")
+            {
+              return LoadBalancerMetricName::HealthyHostCount;
+            }
+            break;
+          case -204241949:
+            if (name == "UnhealthyHostCount")
+            {
+              return LoadBalancerMetricName::UnhealthyHostCount;
+            }
+            break;
+          case 344926469:
+            if (name == "HTTPCode_LB_4XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_LB_4XX_Count;
+            }
+            break;
+          case -1462527994:
+            if (name == "HTTPCode_LB_5XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_LB_5XX_Count;
+            }
+            break;
+          case -315277310:
+            if (name == "HTTPCode_Instance_2XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_Instance_2XX_Count;
+            }
+            break;
+          case -2122731773:
+            if (name == "HTTPCode_Instance_3XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_Instance_3XX_Count;
+            }
+            break;
+          case 364781060:
+            if (name == "HTTPCode_Instance_4XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_Instance_4XX_Count;
+            }
+            break;
+          case -1442673403:
+            if (name == "HTTPCode_Instance_5XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_Instance_5XX_Count;
+            }
+            break;
+          case 762624003:
+            if (name == "InstanceResponseTime")
+            {
+              return LoadBalancerMetricName::InstanceResponseTime;
+            }
+            break;
+          case -361255853:
+            if (name == "RejectedConnectionCount")
+            {
+              return LoadBalancerMetricName::RejectedConnectionCount;
+            }
+            break;
+          case 1441596384:
+            if (name == "RequestCount")
+            {
+              return LoadBalancerMetricName::RequestCount;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return LoadBalancerMetricName::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerMetricName(LoadBalancerMetricName enumValue)
+        const char* GetNameForLoadBalancerMetricNameCStr(LoadBalancerMetricName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerMetricName::ClientTLSNegotiationErrorCount:
-            return "ClientTLSNegotiationErrorCount";
-          case LoadBalancerMetricName::HealthyHostCount:
-            return "HealthyHostCount";
-          case LoadBalancerMetricName::UnhealthyHostCount:
-            return "UnhealthyHostCount";
-          case LoadBalancerMetricName::HTTPCode_LB_4XX_Count:
-            return "HTTPCode_LB_4XX_Count";
-          case LoadBalancerMetricName::HTTPCode_LB_5XX_Count:
-            return "HTTPCode_LB_5XX_Count";
-          case LoadBalancerMetricName::HTTPCode_Instance_2XX_Count:
-            return "HTTPCode_Instance_2XX_Count";
-          case LoadBalancerMetricName::HTTPCode_Instance_3XX_Count:
-            return "HTTPCode_Instance_3XX_Count";
-          case LoadBalancerMetricName::HTTPCode_Instance_4XX_Count:
-            return "HTTPCode_Instance_4XX_Count";
-          case LoadBalancerMetricName::HTTPCode_Instance_5XX_Count:
-            return "HTTPCode_Instance_5XX_Count";
-          case LoadBalancerMetricName::InstanceResponseTime:
-            return "InstanceResponseTime";
-          case LoadBalancerMetricName::RejectedConnectionCount:
-            return "RejectedConnectionCount";
-          case LoadBalancerMetricName::RequestCount:
-            return "RequestCount";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerMetricName(LoadBalancerMetricName enumValue)
+        {
+          return GetNameForLoadBalancerMetricNameCStr(enumValue);
         }
 
       } // namespace LoadBalancerMetricNameMapper
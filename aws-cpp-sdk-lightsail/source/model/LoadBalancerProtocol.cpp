@@ -30,20 +30,37 @@ namespace Aws
       namespace LoadBalancerProtocolMapper
       {
 
-        static const int HTTP_HTTPS_HASH = HashingUtils::HashString("HTTP_HTTPS");
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HTTP_HTTPS",
+          "HTTP",
+        };
 
         LoadBalancerProtocol GetLoadBalancerProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_HTTPS_HASH)
-          {
-            return LoadBalancerProtocol::HTTP_HTTPS;
-          }
-          else if (hashCode == HTTP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerProtocol::HTTP;
+          case -1624510892:
+            if (name == "HTTP_HTTPS")
+            {
+              return LoadBalancerProtocol::HTTP_HTTPS;
+            }
+            break;
+          case 2228360:
+            if (name == "HTTP")
+            {
+              return LoadBalancerProtocol::HTTP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LoadBalancerProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerProtocol(LoadBalancerProtocol enumValue)
+        const char* GetNameForLoadBalancerProtocolCStr(LoadBalancerProtocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerProtocol::HTTP_HTTPS:
-            return "HTTP_HTTPS";
-          case LoadBalancerProtocol::HTTP:
-            return "HTTP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerProtocol(LoadBalancerProtocol enumValue)
+        {
+          return GetNameForLoadBalancerProtocolCStr(enumValue);
         }
 
       } // namespace LoadBalancerProtocolMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace LoadBalancerStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int provisioning_HASH = HashingUtils::HashString("provisioning");
-        static const int active_impaired_HASH = HashingUtils::HashString("active_impaired");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int unknown_HASH = HashingUtils::HashString("unknown");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "active",
+          "provisioning",
+          "active_impaired",
+          "failed",
+          "unknown",
+        };
 
         LoadBalancerState GetLoadBalancerStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerState::active;
-          }
-          else if (hashCode == provisioning_HASH)
-          {
-            return LoadBalancerState::provisioning;
-          }
-          else if (hashCode == active_impaired_HASH)
-          {
-            return LoadBalancerState::active_impaired;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return LoadBalancerState::failed;
-          }
-          else if (hashCode == unknown_HASH)
-          {
-            return LoadBalancerState::unknown;
+          case -1422950650:
+            if (name == "active")
+            {
+              return LoadBalancerState::active;
+            }
+            break;
+          case 121098989:
+            if (name == "provisioning")
+            {
+              return LoadBalancerState::provisioning;
+            }
+            break;
+          case -1913193418:
+            if (name == "active_impaired")
+            {
+              return LoadBalancerState::active_impaired;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return LoadBalancerState::failed;
+            }
+            break;
+          case -284840886:
+            if (name == "unknown")
+            {
+              return LoadBalancerState::unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return LoadBalancerState::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerState(LoadBalancerState enumValue)
+        const char* GetNameForLoadBalancerStateCStr(LoadBalancerState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerState::active:
-            return "active";
-          case LoadBalancerState::provisioning:
-            return "provisioning";
-          case LoadBalancerState::active_impaired:
-            return "active_impaired";
-          case LoadBalancerState::failed:
-            return "failed";
-          case LoadBalancerState::unknown:
-            return "unknown";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerState(LoadBalancerState enumValue)
+        {
+          return GetNameForLoadBalancerStateCStr(enumValue);
         }
 
       } // namespace LoadBalancerStateMapper
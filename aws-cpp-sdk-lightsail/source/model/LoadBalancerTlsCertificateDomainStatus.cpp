@@ -30,25 +30,44 @@ namespace Aws
       namespace LoadBalancerTlsCertificateDomainStatusMapper
       {
 
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING_VALIDATION",
+          "FAILED",
+          "SUCCESS",
+        };
 
         LoadBalancerTlsCertificateDomainStatus GetLoadBalancerTlsCertificateDomainStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_VALIDATION_HASH)
-          {
-            return LoadBalancerTlsCertificateDomainStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerTlsCertificateDomainStatus::FAILED;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return LoadBalancerTlsCertificateDomainStatus::SUCCESS;
+          case 1438135361:
+            if (name == "PENDING_VALIDATION")
+            {
+              return LoadBalancerTlsCertificateDomainStatus::PENDING_VALIDATION;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return LoadBalancerTlsCertificateDomainStatus::FAILED;
+            }
+            break;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return LoadBalancerTlsCertificateDomainStatus::SUCCESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return LoadBalancerTlsCertificateDomainStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerTlsCertificateDomainStatus(LoadBalancerTlsCertificateDomainStatus enumValue)
+        const char* GetNameForLoadBalancerTlsCertificateDomainStatusCStr(LoadBalancerTlsCertificateDomainStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerTlsCertificateDomainStatus::PENDING_VALIDATION:
-            return "PENDING_VALIDATION";
-          case LoadBalancerTlsCertificateDomainStatus::FAILED:
-            return "FAILED";
-          case LoadBalancerTlsCertificateDomainStatus::SUCCESS:
-            return "SUCCESS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerTlsCertificateDomainStatus(LoadBalancerTlsCertificateDomainStatus enumValue)
+        {
+          return GetNameForLoadBalancerTlsCertificateDomainStatusCStr(enumValue);
         }
 
       } // namespace LoadBalancerTlsCertificateDomainStatusMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace LoadBalancerTlsCertificateFailureReasonMapper
       {
 
-        static const int NO_AVAILABLE_CONTACTS_HASH = HashingUtils::HashString("NO_AVAILABLE_CONTACTS");
-        static const int ADDITIONAL_VERIFICATION_REQUIRED_HASH = HashingUtils::HashString("ADDITIONAL_VERIFICATION_REQUIRED");
-        static const int DOMAIN_NOT_ALLOWED_HASH = HashingUtils::HashString("DOMAIN_NOT_ALLOWED");
-        static const int INVALID_PUBLIC_DOMAIN_HASH = HashingUtils::HashString("INVALID_PUBLIC_DOMAIN");
-        static const int OTHER_HASH = HashingUtils::HashString("OTHER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NO_AVAILABLE_CONTACTS",
+          "ADDITIONAL_VERIFICATION_REQUIRED",
+          "DOMAIN_NOT_ALLOWED",
+          "INVALID_PUBLIC_DOMAIN",
+          "OTHER",
+        };
 
         LoadBalancerTlsCertificateFailureReason GetLoadBalancerTlsCertificateFailureReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_AVAILABLE_CONTACTS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerTlsCertificateFailureReason::NO_AVAILABLE_CONTACTS;
-          }
-          else if (hashCode == ADDITIONAL_VERIFICATION_REQUIRED_HASH)
-          {
-            return LoadBalancerTlsCertificateFailureReason::ADDITIONAL_VERIFICATION_REQUIRED;
-          }
-          else if (hashCode == DOMAIN_NOT_ALLOWED_HASH)
-          {
-            return LoadBalancerTlsCertificateFailureReason::DOMAIN_NOT_ALLOWED;
-          }
-          else if (hashCode == INVALID_PUBLIC_DOMAIN_HASH)
-          {
-            return LoadBalancerTlsCertificateFailureReason::INVALID_PUBLIC_DOMAIN;
-          }
-          else if (hashCode == OTHER_HASH)
-          {
-            return LoadBalancerTlsCertificateFailureReason::OTHER;
+          case 1112412263:
+            if (name == "NO_AVAILABLE_CONTACTS")
+            {
+              return LoadBalancerTlsCertificateFailureReason::NO_AVAILABLE_CONTACTS;
+            }
+            break;
+          case 86162219:
+            if (name == "ADDITIONAL_VERIFICATION_REQUIRED")
+            {
+              return LoadBalancerTlsCertificateFailureReason::ADDITIONAL_VERIFICATION_REQUIRED;
+            }
+            break;
+          case -1683087103:
+            if (name == "DOMAIN_NOT_ALLOWED")
+            {
+              return LoadBalancerTlsCertificateFailureReason::DOMAIN_NOT_ALLOWED;
+            }
+            break;
+          case -1326738702:
+            if (name == "INVALID_PUBLIC_DOMAIN")
+            {
+              return LoadBalancerTlsCertificateFailureReason::INVALID_PUBLIC_DOMAIN;
+            }
+            break;
+          case 75532016:
+            if (name == "OTHER")
+            {
+              return LoadBalancerTlsCertificateFailureReason::OTHER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return LoadBalancerTlsCertificateFailureReason::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerTlsCertificateFailureReason(LoadBalancerTlsCertificateFailureReason enumValue)
+        const char* GetNameForLoadBalancerTlsCertificateFailureReasonCStr(LoadBalancerTlsCertificateFailureReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerTlsCertificateFailureReason::NO_AVAILABLE_CONTACTS:
-            return "NO_AVAILABLE_CONTACTS";
-          case LoadBalancerTlsCertificateFailureReason::ADDITIONAL_VERIFICATION_REQUIRED:
-            return "ADDITIONAL_VERIFICATION_REQUIRED";
-          case LoadBalancerTlsCertificateFailureReason::DOMAIN_NOT_ALLOWED:
-            return "DOMAIN_NOT_ALLOWED";
-          case LoadBalancerTlsCertificateFailureReason::INVALID_PUBLIC_DOMAIN:
-            return "INVALID_PUBLIC_DOMAIN";
-          case LoadBalancerTlsCertificateFailureReason::OTHER:
-            return "OTHER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerTlsCertificateFailureReason(LoadBalancerTlsCertificateFailureReason enumValue)
+        {
+          return GetNameForLoadBalancerTlsCertificateFailureReasonCStr(enumValue);
         }
 
       } // namespace LoadBalancerTlsCertificateFailureReasonMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace LoadBalancerTlsCertificateRenewalStatusMapper
       {
 
-        static const int PENDING_AUTO_RENEWAL_HASH = HashingUtils::HashString("PENDING_AUTO_RENEWAL");
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING_AUTO_RENEWAL",
+          "PENDING_VALIDATION",
+          "SUCCESS",
+          "FAILED",
+        };
 
         LoadBalancerTlsCertificateRenewalStatus GetLoadBalancerTlsCertificateRenewalStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_AUTO_RENEWAL_HASH)
-          {
-            return LoadBalancerTlsCertificateRenewalStatus::PENDING_AUTO_RENEWAL;
-          }
-          else if (hashCode == PENDING_VALIDATION_HASH)
-          {
-            return LoadBalancerTlsCertificateRenewalStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return LoadBalancerTlsCertificateRenewalStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerTlsCertificateRenewalStatus::FAILED;
+          case 1130413712:
+            if (name == "PENDING_AUTO_RENEWAL")
+            {
+              return LoadBalancerTlsCertificateRenewalStatus::PENDING_AUTO_RENEWAL;
+            }
+            break;
+          case 1438135361:
+            if (name == "PENDING_VALIDATION")
+            {
+              return LoadBalancerTlsCertificateRenewalStatus::PENDING_VALIDATION;
+            }
+            break;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return LoadBalancerTlsCertificateRenewalStatus::SUCCESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return LoadBalancerTlsCertificateRenewalStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return LoadBalancerTlsCertificateRenewalStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerTlsCertificateRenewalStatus(LoadBalancerTlsCertificateRenewalStatus enumValue)
+        const char* GetNameForLoadBalancerTlsCertificateRenewalStatusCStr(LoadBalancerTlsCertificateRenewalStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerTlsCertificateRenewalStatus::PENDING_AUTO_RENEWAL:
-            return "PENDING_AUTO_RENEWAL";
-          case LoadBalancerTlsCertificateRenewalStatus::PENDING_VALIDATION:
-            return "PENDING_VALIDATION";
-          case LoadBalancerTlsCertificateRenewalStatus::SUCCESS:
-            return "SUCCESS";
-          case LoadBalancerTlsCertificateRenewalStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerTlsCertificateRenewalStatus(LoadBalancerTlsCertificateRenewalStatus enumValue)
+        {
+          return GetNameForLoadBalancerTlsCertificateRenewalStatusCStr(enumValue);
         }
 
       } // namespace LoadBalancerTlsCertificateRenewalStatusMapper
@@ -30,60 +30,93 @@ namespace Aws
       namespace LoadBalancerTlsCertificateRevocationReasonMapper
       {
 
-        static const int UNSPECIFIED_HASH = HashingUtils::HashString("UNSPECIFIED");
-        static const int KEY_COMPROMISE_HASH = HashingUtils::HashString("KEY_COMPROMISE");
-        static const int CA_COMPROMISE_HASH = HashingUtils::HashString("CA_COMPROMISE");
-        static const int AFFILIATION_CHANGED_HASH = HashingUtils::HashString("AFFILIATION_CHANGED");
-        static const int SUPERCEDED_HASH = HashingUtils::HashString("SUPERCEDED");
-        static const int CESSATION_OF_OPERATION_HASH = HashingUtils::HashString("CESSATION_OF_OPERATION");
-        static const int CERTIFICATE_HOLD_HASH = HashingUtils::HashString("CERTIFICATE_HOLD");
-        static const int REMOVE_FROM_CRL_HASH = HashingUtils::HashString("REMOVE_FROM_CRL");
-        static const int PRIVILEGE_WITHDRAWN_HASH = HashingUtils::HashString("PRIVILEGE_WITHDRAWN");
-        static const int A_A_COMPROMISE_HASH = HashingUtils::HashString("A_A_COMPROMISE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNSPECIFIED",
+          "KEY_COMPROMISE",
+          "CA_COMPROMISE",
+          "AFFILIATION_CHANGED",
+          "SUPERCEDED",
+          "CESSATION_OF_OPERATION",
+          "CERTIFICATE_HOLD",
+          "REMOVE_FROM_CRL",
+          "PRIVILEGE_WITHDRAWN",
+          "A_A_COMPROMISE",
+        };
 
         LoadBalancerTlsCertificateRevocationReason GetLoadBalancerTlsCertificateRevocationReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNSPECIFIED_HASH)
-          {
-            return LoadBalancerTlsCertificateRevocationReason::UNSPECIFIED;
-          }
-          else if (hashCode == KEY_COMPROMISE_HASH)
-          {
-            return LoadBalancerTlsCertificateRevocationReason::KEY_COMPROMISE;
-          }
-          else if (hashCode == CA_COMPROMISE_HASH)
-          {
-            return LoadBalancerTlsCertificateRevocationReason::CA_COMPROMISE;
-          }
-          else if (hashCode == AFFILIATION_CHANGED_HASH)
-          {
-            return LoadBalancerTlsCertificateRevocationReason::AFFILIATION_CHANGED;
-          }
-          else if (hashCode == SUPERCEDED_HASH)
-          {
-            return LoadBalancerTlsCertificateRevocationReason::SUPERCEDED;
-          }
-          else if (hashCode == CESSATION_OF_OPERATION_HASH)
-          {
-            return LoadBalancerTlsCertificateRevocationReason::CESSATION_OF_OPERATION;
-          }
-          else if (hashCode == CERTIFICATE_HOLD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerTlsCertificateRevocationReason::CERTIFICATE_HOLD;
-          }
-          else if (hashCode == REMOVE_FROM_CRL_HASH)
-          {
-            return LoadBalancerTlsCertificateRevocationReason::REMOVE_FROM_CRL;
-          }
-          else if (hashCode == PRIVILEGE_WITHDRAWN_HASH)
-          {
-            return LoadBalancerTlsCertificateRevocationReason::PRIVILEGE_WITHDRAWN;
-          }
-          else if (hashCode == A_A_COMPROMISE_HASH)
-          {
-            return LoadBalancerTlsCertificateRevocationReason::A_A_COMPROMISE;
+          case 526786327:
+            if (name == "UNSPECIFIED")
+            {
+              return LoadBalancerTlsCertificateRevocationReason::UNSPECIFIED;
+            }
+            break;
+          case 1784301178:
+            if (name == "KEY_COMPROMISE")
+            {
+              return LoadBalancerTlsCertificateRevocationReason::KEY_COMPROMISE;
+            }
+            break;
+          case -1464686853:
+            if (name == "CA_COMPROMISE")
+            {
+              return LoadBalancerTlsCertificateRevocationReason::CA_COMPROMISE;
+            }
+            break;
+          case 1816386597:
+            if (name == "AFFILIATION_CHANGED")
+            {
+              return LoadBalancerTlsCertificateRevocationReason::AFFILIATION_CHANGED;
+            }
+            break;
+          case -1229818426:
+            if (name == "SUPERCEDED")
+            {
+              return LoadBalancerTlsCertificateRevocationReason::SUPERCEDED;
+            }
+            break;
+          case -351852597:
+            if (name == "CESSATION_OF_OPERATION")
+            {
+              return LoadBalancerTlsCertificateRevocationReason::CESSATION_OF_OPERATION;
+            }
+            break;
+          case 1933025927:
+            if (name == "CERTIFICATE_HOLD")
+            {
+              return LoadBalancerTlsCertificateRevocationReason::CERTIFICATE_HOLD;
+            }
+            break;
+          case -1931970301:
+            if (name == "REMOVE_FROM_CRL")
+            {
+              return LoadBalancerTlsCertificateRevocationReason::REMOVE_FROM_CRL;
+            }
+            break;
+          case -1038997930:
+            if (name == "PRIVILEGE_WITHDRAWN")
+            {
+              return LoadBalancerTlsCertificateRevocationReason::PRIVILEGE_WITHDRAWN;
+            }
+            break;
+          case 408391286:
+            if (name == "A_A_COMPROMISE")
+            {
+              return LoadBalancerTlsCertificateRevocationReason::A_A_COMPROMISE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return LoadBalancerTlsCertificateRevocationReason::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerTlsCertificateRevocationReason(LoadBalancerTlsCertificateRevocationReason enumValue)
+        const char* GetNameForLoadBalancerTlsCertificateRevocationReasonCStr(LoadBalancerTlsCertificateRevocationReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerTlsCertificateRevocationReason::UNSPECIFIED:
-            return "UNSPECIFIED";
-          case LoadBalancerTlsCertificateRevocationReason::KEY_COMPROMISE:
-            return "KEY_COMPROMISE";
-          case LoadBalancerTlsCertificateRevocationReason::CA_COMPROMISE:
-            return "CA_COMPROMISE";
-          case LoadBalancerTlsCertificateRevocationReason::AFFILIATION_CHANGED:
-            return "AFFILIATION_CHANGED";
-          case LoadBalancerTlsCertificateRevocationReason::SUPERCEDED:
-            return "SUPERCEDED";
-          case LoadBalancerTlsCertificateRevocationReason::CESSATION_OF_OPERATION:
-            return "CESSATION_OF_OPERATION";
-          case LoadBalancerTlsCertificateRevocationReason::CERTIFICATE_HOLD:
-            return "CERTIFICATE_HOLD";
-          case LoadBalancerTlsCertificateRevocationReason::REMOVE_FROM_CRL:
-            return "REMOVE_FROM_CRL";
-          case LoadBalancerTlsCertificateRevocationReason::PRIVILEGE_WITHDRAWN:
-            return "PRIVILEGE_WITHDRAWN";
-          case LoadBalancerTlsCertificateRevocationReason::A_A_COMPROMISE:
-            return "A_A_COMPROMISE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerTlsCertificateRevocationReason(LoadBalancerTlsCertificateRevocationReason enumValue)
+        {
+          return GetNameForLoadBalancerTlsCertificateRevocationReasonCStr(enumValue);
         }
 
       } // namespace LoadBalancerTlsCertificateRevocationReasonMapper
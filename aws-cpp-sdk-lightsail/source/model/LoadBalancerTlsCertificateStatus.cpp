@@ -30,50 +30,79 @@ namespace Aws
       namespace LoadBalancerTlsCertificateStatusMapper
       {
 
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int ISSUED_HASH = HashingUtils::HashString("ISSUED");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-        static const int VALIDATION_TIMED_OUT_HASH = HashingUtils::HashString("VALIDATION_TIMED_OUT");
-        static const int REVOKED_HASH = HashingUtils::HashString("REVOKED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING_VALIDATION",
+          "ISSUED",
+          "INACTIVE",
+          "EXPIRED",
+          "VALIDATION_TIMED_OUT",
+          "REVOKED",
+          "FAILED",
+          "UNKNOWN",
+        };
 
         LoadBalancerTlsCertificateStatus GetLoadBalancerTlsCertificateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_VALIDATION_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == ISSUED_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::ISSUED;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::INACTIVE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::EXPIRED;
-          }
-          else if (hashCode == VALIDATION_TIMED_OUT_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::VALIDATION_TIMED_OUT;
-          }
-          else if (hashCode == REVOKED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LoadBalancerTlsCertificateStatus::REVOKED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::FAILED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::UNKNOWN;
+          case 1438135361:
+            if (name == "PENDING_VALIDATION")
+            {
+              return LoadBalancerTlsCertificateStatus::PENDING_VALIDATION;
+            }
+            break;
+          case -2125830485:
+            if (name == "ISSUED")
+            {
+              return LoadBalancerTlsCertificateStatus::ISSUED;
+            }
+            break;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return LoadBalancerTlsCertificateStatus::INACTIVE;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return LoadBalancerTlsCertificateStatus::EXPIRED;
+            }
+            break;
+          case 1296873920:
+            if (name == "VALIDATION_TIMED_OUT")
+            {
+              return LoadBalancerTlsCertificateStatus::VALIDATION_TIMED_OUT;
+            }
+            break;
+          case 1818119806:
+            if (name == "REVOKED")
+            {
+              return LoadBalancerTlsCertificateStatus::REVOKED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return LoadBalancerTlsCertificateStatus::FAILED;
+            }
+            break;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return LoadBalancerTlsCertificateStatus::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return LoadBalancerTlsCertificateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerTlsCertificateStatus(LoadBalancerTlsCertificateStatus enumValue)
+        const char* GetNameForLoadBalancerTlsCertificateStatusCStr(LoadBalancerTlsCertificateStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LoadBalancerTlsCertificateStatus::PENDING_VALIDATION:
-            return "PENDING_VALIDATION";
-          case LoadBalancerTlsCertificateStatus::ISSUED:
-            return "ISSUED";
-          case LoadBalancerTlsCertificateStatus::INACTIVE:
-            return "INACTIVE";
-          case LoadBalancerTlsCertificateStatus::EXPIRED:
-            return "EXPIRED";
-          case LoadBalancerTlsCertificateStatus::VALIDATION_TIMED_OUT:
-            return "VALIDATION_TIMED_OUT";
-          case LoadBalancerTlsCertificateStatus::REVOKED:
-            return "REVOKED";
-          case LoadBalancerTlsCertificateStatus::FAILED:
-            return "FAILED";
-          case LoadBalancerTlsCertificateStatus::UNKNOWN:
-            return "UNKNOWN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLoadBalancerTlsCertificateStatus(LoadBalancerTlsCertificateStatus enumValue)
+        {
+          return GetNameForLoadBalancerTlsCertificateStatusCStr(enumValue);
         }
 
       } // namespace LoadBalancerTlsCertificateStatusMapper
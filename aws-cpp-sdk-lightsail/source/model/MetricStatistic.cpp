@@ -30,35 +30,58 @@ namespace Aws
       namespace MetricStatisticMapper
       {
 
-        static const int Minimum_HASH = HashingUtils::HashString("Minimum");
-        static const int Maximum_HASH = HashingUtils::HashString("Maximum");
-        static const int Sum_HASH = HashingUtils::HashString("Sum");
-        static const int Average_HASH = HashingUtils::HashString("Average");
-        static const int SampleCount_HASH = HashingUtils::HashString("SampleCount");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Minimum",
+          "Maximum",
+          "Sum",
+          "Average",
+          "SampleCount",
+        };
 
         MetricStatistic GetMetricStatisticForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Minimum_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MetricStatistic::Minimum;
-          }
-          else if (hashCode == Maximum_HASH)
-          {
-            return MetricStatistic::Maximum;
-          }
-          else if (hashCode == Sum_HASH)
-          {
-            return MetricStatistic::Sum;
-          }
-          else if (hashCode == Average_HASH)
-          {
-            return MetricStatistic::Average;
-          }
-          else if (hashCode == SampleCount_HASH)
-          {
-            return MetricStatistic::SampleCount;
+          case -1565775890:
+            if (name == "Minimum")
+            {
+              return MetricStatistic::Minimum;
+            }
+            break;
+          case -1785573888:
+            if (name == "Maximum")
+            {
+              return MetricStatistic::Maximum;
+            }
+            break;
+          case 83499:
+            if (name == "Sum")
+            {
+              return MetricStatistic::Sum;
+            }
+            break;
+          case 1033205245:
+            if (name == "Average")
+            {
+              return MetricStatistic::Average;
+            }
+            break;
+          case 1795132773:
+            if (name == "SampleCount")
+            {
+              return MetricStatistic::SampleCount;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return MetricStatistic::NOT_SET;
         }
 
-        Aws::String GetNameForMetricStatistic(MetricStatistic enumValue)
+        const char* GetNameForMetricStatisticCStr(MetricStatistic enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MetricStatistic::Minimum:
-            return "Minimum";
-          case MetricStatistic::Maximum:
-            return "Maximum";
-          case MetricStatistic::Sum:
-            return "Sum";
-          case MetricStatistic::Average:
-            return "Average";
-          case MetricStatistic::SampleCount:
-            return "SampleCount";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMetricStatistic(MetricStatistic enumValue)
+        {
+          return GetNameForMetricStatisticCStr(enumValue);
         }
 
       } // namespace MetricStatisticMapper
@@ -30,145 +30,212 @@ namespace Aws
       namespace MetricUnitMapper
       {
 
-        static const int Seconds_HASH = HashingUtils::HashString("Seconds");
-        static const int Microseconds_HASH = HashingUtils::HashString("Microseconds");
-        static const int Milliseconds_HASH = HashingUtils::HashString("Milliseconds");
-        static const int Bytes_HASH = HashingUtils::HashString("Bytes");
-        static const int Kilobytes_HASH = HashingUtils::HashString("Kilobytes");
-        static const int Megabytes_HASH = HashingUtils::HashString("Megabytes");
-        static const int Gigabytes_HASH = HashingUtils::HashString("Gigabytes");
-        static const int Terabytes_HASH = HashingUtils::HashString("Terabytes");
-        static const int Bits_HASH = HashingUtils::HashString("Bits");
-        static const int Kilobits_HASH = HashingUtils::HashString("Kilobits");
-        static const int Megabits_HASH = HashingUtils::HashString("Megabits");
-        static const int Gigabits_HASH = HashingUtils::HashString("Gigabits");
-        static const int Terabits_HASH = HashingUtils::HashString("Terabits");
-        static const int Percent_HASH = HashingUtils::HashString("Percent");
-        static const int Count_HASH = HashingUtils::HashString("Count");
-        static const int Bytes_Second_HASH = HashingUtils::HashString("Bytes/Second");
-        static const int Kilobytes_Second_HASH = HashingUtils::HashString("Kilobytes/Second");
-        static const int Megabytes_Second_HASH = HashingUtils::HashString("Megabytes/Second");
-        static const int Gigabytes_Second_HASH = HashingUtils::HashString("Gigabytes/Second");
-        static const int Terabytes_Second_HASH = HashingUtils::HashString("Terabytes/Second");
-        static const int Bits_Second_HASH = HashingUtils::HashString("Bits/Second");
-        static const int Kilobits_Second_HASH = HashingUtils::HashString("Kilobits/Second");
-        static const int Megabits_Second_HASH = HashingUtils::HashString("Megabits/Second");
-        static const int Gigabits_Second_HASH = HashingUtils::HashString("Gigabits/Second");
-        static const int Terabits_Second_HASH = HashingUtils::HashString("Terabits/Second");
-        static const int Count_Second_HASH = HashingUtils::HashString("Count/Second");
-        static const int None_HASH = HashingUtils::HashString("None");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Seconds",
+          "Microseconds",
+          "Milliseconds",
+          "Bytes",
+          "Kilobytes",
+          "Megabytes",
+          "Gigabytes",
+          "Terabytes",
+          "Bits",
+          "Kilobits",
+          "Megabits",
+          "Gigabits",
+          "Terabits",
+          "Percent",
+          "Count",
+          "Bytes/Second",
+          "Kilobytes/Second",
+          "Megabytes/Second",
+          "Gigabytes/Second",
+          "Terabytes/Second",
+          "Bits/Second",
+          "Kilobits/Second",
+          "Megabits/Second",
+          "Gigabits/Second",
+          "Terabits/Second",
+          "Count/Second",
+          "None",
+        };
 
         MetricUnit GetMetricUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Seconds_HASH)
-          {
-            return MetricUnit::Seconds;
-          }
-          else if (hashCode == Microseconds_HASH)
-          {
-            return MetricUnit::Microseconds;
-          }
-          else if (hashCode == Milliseconds_HASH)
-          {
-            return MetricUnit::Milliseconds;
-          }
-          else if (hashCode == Bytes_HASH)
-          {
-            return MetricUnit::Bytes;
-          }
-          else if (hashCode == Kilobytes_HASH)
-          {
-            return MetricUnit::Kilobytes;
-          }
-          else if (hashCode == Megabytes_HASH)
-          {
-            return MetricUnit::Megabytes;
-          }
-          else if (hashCode == Gigabytes_HASH)
-          {
-            return MetricUnit::Gigabytes;
-          }
-          else if (hashCode == Terabytes_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MetricUnit::Terabytes;
-          }
-          else if (hashCode == Bits_HASH)
-          {
-            return MetricUnit::Bits;
-          }
-          else if (hashCode == Kilobits_HASH)
-          {
-            return MetricUnit::Kilobits;
-          }
-          else if (hashCode == Megabits_HASH)
-          {
-            return MetricUnit::Megabits;
-          }
-          else if (hashCode == Gigabits_HASH)
-          {
-            return MetricUnit::Gigabits;
-          }
-          else if (hashCode == Terabits_HASH)
-          {
-            return MetricUnit::Terabits;
-          }
-          else if (hashCode == Percent_HASH)
-          {
-            return MetricUnit::Percent;
-          }
-          else if (hashCode == Count_HASH)
-          {
-            return MetricUnit::Count;
-          }
-          else if (hashCode == Bytes_Second_HASH)
-          {
-            return MetricUnit::Bytes_Second;
-          }
-          else if (hashCode == Kilobytes_Second_HASH)
-          {
-            return MetricUnit::Kilobytes_Second;
-          }
-          else if (hashCode == Megabytes_Second_HASH)
-          {
-            return MetricUnit::Megabytes_Second;
-          }
-          else if (hashCode == Gigabytes_Second_HASH)
-          {
-            return MetricUnit::Gigabytes_Second;
-          }
-          else if (hashCode == Terabytes_Second_HASH)
-          {
-            return MetricUnit::Terabytes_Second;
-          }
-          else if (hashCode == Bits_Second_HASH)
-          {
-            return MetricUnit::Bits_Second;
-          }
-          else if (hashCode == Kilobits_Second_HASH)
-          {
-            return MetricUnit::Kilobits_Second;
-          }
-          else if (hashCode == Megabits_Second_HASH)
-          {
-            return MetricUnit::Megabits_Second;
-          }
-          else if (hashCode == Gigabits_Second_HASH)
-          {
-            return MetricUnit::Gigabits_Second;
-          }
-          else if (hashCode == Terabits_Second_HASH)
-          {
-            return MetricUnit::Terabits_Second;
-          }
-          else if (hashCode == Count_Second_HASH)
-          {
-            return MetricUnit::Count_Second;
-          }
-          else if (hashCode == None_HASH)
-          {
-            return MetricUnit::None;
+          case -660217249:
+            if (name == "Seconds")
+            {
+              return MetricUnit::Seconds;
+            }
+            break;
+          case 1630272347:
+            if (name == "Microseconds")
+            {
+              return MetricUnit::Microseconds;
+            }
+            break;
+          case 249515570:
+            if (name == "Milliseconds")
+            {
+              return MetricUnit::Milliseconds;
+            }
+            break;
+          case 64671819:
+            if (name == "Bytes")
+            {
+              return MetricUnit::Bytes;
+            }
+            break;
+          case 529570186:
+            if (name == "Kilobytes")
+            {
+              return MetricUnit::Kilobytes;
+            }
+            break;
+          case -2010004711:
+            if (name == "Megabytes")
+            {
+              return MetricUnit::Megabytes;
+            }
+            break;
+          case -1373905777:
+            if (name == "Gigabytes")
+            {
+              return MetricUnit::Gigabytes;
+            }
+            break;
+          case -604678165:
+            if (name == "Terabytes")
+            {
+              return MetricUnit::Terabytes;
+            }
+            break;
+          case 2070822:
+            if (name == "Bits")
+            {
+              return MetricUnit::Bits;
+            }
+            break;
+          case -537121785:
+            if (name == "Kilobits")
+            {
+              return MetricUnit::Kilobits;
+            }
+            break;
+          case -757590888:
+            if (name == "Megabits")
+            {
+              return MetricUnit::Megabits;
+            }
+            break;
+          case 925496418:
+            if (name == "Gigabits")
+            {
+              return MetricUnit::Gigabits;
+            }
+            break;
+          case -1127899770:
+            if (name == "Terabits")
+            {
+              return MetricUnit::Terabits;
+            }
+            break;
+          case 985725989:
+            if (name == "Percent")
+            {
+              return MetricUnit::Percent;
+            }
+            break;
+          case 65298671:
+            if (name == "Count")
+            {
+              return MetricUnit::Count;
+            }
+            break;
+          case 2146985688:
+            if (name == "Bytes/Second")
+            {
+              return MetricUnit::Bytes_Second;
+            }
+            break;
+          case 457738425:
+            if (name == "Kilobytes/Second")
+            {
+              return MetricUnit::Kilobytes_Second;
+            }
+            break;
+          case 41898058:
+            if (name == "Megabytes/Second")
+            {
+              return MetricUnit::Megabytes_Second;
+            }
+            break;
+          case 545375764:
+            if (name == "Gigabytes/Second")
+            {
+              return MetricUnit::Gigabytes_Second;
+            }
+            break;
+          case -503051464:
+            if (name == "Terabytes/Second")
+            {
+              return MetricUnit::Terabytes_Second;
+            }
+            break;
+          case -1209794147:
+            if (name == "Bits/Second")
+            {
+              return MetricUnit::Bits_Second;
+            }
+            break;
+          case 1091018652:
+            if (name == "Kilobits/Second")
+            {
+              return MetricUnit::Kilobits_Second;
+            }
+            break;
+          case 1493246443:
+            if (name == "Megabits/Second")
+            {
+              return MetricUnit::Megabits_Second;
+            }
+            break;
+          case -984364319:
+            if (name == "Gigabits/Second")
+            {
+              return MetricUnit::Gigabits_Second;
+            }
+            break;
+          case 228741437:
+            if (name == "Terabits/Second")
+            {
+              return MetricUnit::Terabits_Second;
+            }
+            break;
+          case 1229821364:
+            if (name == "Count/Second")
+            {
+              return MetricUnit::Count_Second;
+            }
+            break;
+          case 2433880:
+            if (name == "None")
+            {
+              return MetricUnit::None;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -180,73 +247,26 @@ namespace Aws
           return MetricUnit::NOT_SET;
         }
 
-        Aws::String GetNameForMetricUnit(MetricUnit enumValue)
+        const char* GetNameForMetricUnitCStr(MetricUnit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MetricUnit::Seconds:
-            return "Seconds";
-          case MetricUnit::Microseconds:
-            return "Microseconds";
-          case MetricUnit::Milliseconds:
-            return "Milliseconds";
-          case MetricUnit::Bytes:
-            return "Bytes";
-          case MetricUnit::Kilobytes:
-            return "Kilobytes";
-          case MetricUnit::Megabytes:
-            return "Megabytes";
-          case MetricUnit::Gigabytes:
-            return "Gigabytes";
-          case MetricUnit::Terabytes:
-            return "Terabytes";
-          case MetricUnit::Bits:
-            return "Bits";
-          case MetricUnit::Kilobits:
-            return "Kilobits";
-          case MetricUnit::Megabits:
-            return "Megabits";
-          case MetricUnit::Gigabits:
-            return "Gigabits";
-          case MetricUnit::Terabits:
-            return "Terabits";
-          case MetricUnit::Percent:
-            return "Percent";
-          case MetricUnit::Count:
-            return "Count";
-          case MetricUnit::Bytes_Second:
-            return "Bytes/Second";
-          case MetricUnit::Kilobytes_Second:
-            return "Kilobytes/Second";
-          case MetricUnit::Megabytes_Second:
-            return "Megabytes/Second";
-          case MetricUnit::Gigabytes_Second:
-            return "Gigabytes/Second";
-          case MetricUnit::Terabytes_Second:
-            return "Terabytes/Second";
-          case MetricUnit::Bits_Second:
-            return "Bits/Second";
-          case MetricUnit::Kilobits_Second:
-            return "Kilobits/Second";
-          case MetricUnit::Megabits_Second:
-            return "Megabits/Second";
-          case MetricUnit::Gigabits_Second:
-            return "Gigabits/Second";
-          case MetricUnit::Terabits_Second:
-            return "Terabits/Second";
-          case MetricUnit::Count_Second:
-            return "Count/Second";
-          case MetricUnit::None:
-            return "None";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMetricUnit(MetricUnit enumValue)
+        {
+          return GetNameForMetricUnitCStr(enumValue);
         }
 
       } // namespace MetricUnitMapper
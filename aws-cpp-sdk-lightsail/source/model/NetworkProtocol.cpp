@@ -30,25 +30,44 @@ namespace Aws
       namespace NetworkProtocolMapper
       {
 
-        static const int tcp_HASH = HashingUtils::HashString("tcp");
-        static const int all_HASH = HashingUtils::HashString("all");
-        static const int udp_HASH = HashingUtils::HashString("udp");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "tcp",
+          "all",
+          "udp",
+        };
 
         NetworkProtocol GetNetworkProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == tcp_HASH)
-          {
-            return NetworkProtocol::tcp;
-          }
-          else if (hashCode == all_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NetworkProtocol::all;
-          }
-          else if (hashCode == udp_HASH)
-          {
-            return NetworkProtocol::udp;
+          case 114657:
+            if (name == "tcp")
+            {
+              return NetworkProtocol::tcp;
+            }
+            break;
+          case 96673:
+            if (name == "all")
+            {
+              return NetworkProtocol::all;
+            }
+            break;
+          case 115649:
+            if (name == "udp")
+            {
+              return NetworkProtocol::udp;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return NetworkProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkProtocol(NetworkProtocol enumValue)
+        const char* GetNameForNetworkProtocolCStr(NetworkProtocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NetworkProtocol::tcp:
-            return "tcp";
-          case NetworkProtocol::all:
-            return "all";
-          case NetworkProtocol::udp:
-            return "udp";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNetworkProtocol(NetworkProtocol enumValue)
+        {
+          return GetNameForNetworkProtocolCStr(enumValue);
         }
 
       } // namespace NetworkProtocolMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace OperationStatusMapper
       {
 
-        static const int NotStarted_HASH = HashingUtils::HashString("NotStarted");
-        static const int Started_HASH = HashingUtils::HashString("Started");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NotStarted",
+          "Started",
+          "Failed",
+          "Completed",
+          "Succeeded",
+        };
 
         OperationStatus GetOperationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NotStarted_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperationStatus::NotStarted;
-          }
-          else if (hashCode == Started_HASH)
-          {
-            return OperationStatus::Started;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return OperationStatus::Failed;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return OperationStatus::Completed;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return OperationStatus::Succeeded;
+          case -1137129906:
+            if (name == "NotStarted")
+            {
+              return OperationStatus::NotStarted;
+            }
+            break;
+          case -232531871:
+            if (name == "Started")
+            {
+              return OperationStatus::Started;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return OperationStatus::Failed;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return OperationStatus::Completed;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return OperationStatus::Succeeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return OperationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForOperationStatus(OperationStatus enumValue)
+        const char* GetNameForOperationStatusCStr(OperationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperationStatus::NotStarted:
-            return "NotStarted";
-          case OperationStatus::Started:
-            return "Started";
-          case OperationStatus::Failed:
-            return "Failed";
-          case OperationStatus::Completed:
-            return "Completed";
-          case OperationStatus::Succeeded:
-            return "Succeeded";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperationStatus(OperationStatus enumValue)
+        {
+          return GetNameForOperationStatusCStr(enumValue);
         }
 
       } // namespace OperationStatusMapper
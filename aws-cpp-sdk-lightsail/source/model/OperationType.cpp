@@ -30,230 +30,331 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int DeleteInstance_HASH = HashingUtils::HashString("DeleteInstance");
-        static const int CreateInstance_HASH = HashingUtils::HashString("CreateInstance");
-        static const int StopInstance_HASH = HashingUtils::HashString("StopInstance");
-        static const int StartInstance_HASH = HashingUtils::HashString("StartInstance");
-        static const int RebootInstance_HASH = HashingUtils::HashString("RebootInstance");
-        static const int OpenInstancePublicPorts_HASH = HashingUtils::HashString("OpenInstancePublicPorts");
-        static const int PutInstancePublicPorts_HASH = HashingUtils::HashString("PutInstancePublicPorts");
-        static const int CloseInstancePublicPorts_HASH = HashingUtils::HashString("CloseInstancePublicPorts");
-        static const int AllocateStaticIp_HASH = HashingUtils::HashString("AllocateStaticIp");
-        static const int ReleaseStaticIp_HASH = HashingUtils::HashString("ReleaseStaticIp");
-        static const int AttachStaticIp_HASH = HashingUtils::HashString("AttachStaticIp");
-        static const int DetachStaticIp_HASH = HashingUtils::HashString("DetachStaticIp");
-        static const int UpdateDomainEntry_HASH = HashingUtils::HashString("UpdateDomainEntry");
-        static const int DeleteDomainEntry_HASH = HashingUtils::HashString("DeleteDomainEntry");
-        static const int CreateDomain_HASH = HashingUtils::HashString("CreateDomain");
-        static const int DeleteDomain_HASH = HashingUtils::HashString("DeleteDomain");
-        static const int CreateInstanceSnapshot_HASH = HashingUtils::HashString("CreateInstanceSnapshot");
-        static const int DeleteInstanceSnapshot_HASH = HashingUtils::HashString("DeleteInstanceSnapshot");
-        static const int CreateInstancesFromSnapshot_HASH = HashingUtils::HashString("CreateInstancesFromSnapshot");
-        static const int CreateLoadBalancer_HASH = HashingUtils::HashString("CreateLoadBalancer");
-        static const int DeleteLoadBalancer_HASH = HashingUtils::HashString("DeleteLoadBalancer");
-        static const int AttachInstancesToLoadBalancer_HASH = HashingUtils::HashString("AttachInstancesToLoadBalancer");
-        static const int DetachInstancesFromLoadBalancer_HASH = HashingUtils::HashString("DetachInstancesFromLoadBalancer");
-        static const int UpdateLoadBalancerAttribute_HASH = HashingUtils::HashString("UpdateLoadBalancerAttribute");
-        static const int CreateLoadBalancerTlsCertificate_HASH = HashingUtils::HashString("CreateLoadBalancerTlsCertificate");
-        static const int DeleteLoadBalancerTlsCertificate_HASH = HashingUtils::HashString("DeleteLoadBalancerTlsCertificate");
-        static const int AttachLoadBalancerTlsCertificate_HASH = HashingUtils::HashString("AttachLoadBalancerTlsCertificate");
-        static const int CreateDisk_HASH = HashingUtils::HashString("CreateDisk");
-        static const int DeleteDisk_HASH = HashingUtils::HashString("DeleteDisk");
-        static const int AttachDisk_HASH = HashingUtils::HashString("AttachDisk");
-        static const int DetachDisk_HASH = HashingUtils::HashString("DetachDisk");
-        static const int CreateDiskSnapshot_HASH = HashingUtils::HashString("CreateDiskSnapshot");
-        static const int DeleteDiskSnapshot_HASH = HashingUtils::HashString("DeleteDiskSnapshot");
-        static const int CreateDiskFromSnapshot_HASH = HashingUtils::HashString("CreateDiskFromSnapshot");
-        static const int CreateRelationalDatabase_HASH = HashingUtils::HashString("CreateRelationalDatabase");
-        static const int UpdateRelationalDatabase_HASH = HashingUtils::HashString("UpdateRelationalDatabase");
-        static const int DeleteRelationalDatabase_HASH = HashingUtils::HashString("DeleteRelationalDatabase");
-        static const int CreateRelationalDatabaseFromSnapshot_HASH = HashingUtils::HashString("CreateRelationalDatabaseFromSnapshot");
-        static const int CreateRelationalDatabaseSnapshot_HASH = HashingUtils::HashString("CreateRelationalDatabaseSnapshot");
-        static const int DeleteRelationalDatabaseSnapshot_HASH = HashingUtils::HashString("DeleteRelationalDatabaseSnapshot");
-        static const int UpdateRelationalDatabaseParameters_HASH = HashingUtils::HashString("UpdateRelationalDatabaseParameters");
-        static const int StartRelationalDatabase_HASH = HashingUtils::HashString("StartRelationalDatabase");
-        static const int RebootRelationalDatabase_HASH = HashingUtils::HashString("RebootRelationalDatabase");
-        static const int StopRelationalDatabase_HASH = HashingUtils::HashString("StopRelationalDatabase");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DeleteInstance",
+          "CreateInstance",
+          "StopInstance",
+          "StartInstance",
+          "RebootInstance",
+          "OpenInstancePublicPorts",
+          "PutInstancePublicPorts",
+          "CloseInstancePublicPorts",
+          "AllocateStaticIp",
+          "ReleaseStaticIp",
+          "AttachStaticIp",
+          "DetachStaticIp",
+          "UpdateDomainEntry",
+          "DeleteDomainEntry",
+          "CreateDomain",
+          "DeleteDomain",
+          "CreateInstanceSnapshot",
+          "DeleteInstanceSnapshot",
+          "CreateInstancesFromSnapshot",
+          "CreateLoadBalancer",
+          "DeleteLoadBalancer",
+          "AttachInstancesToLoadBalancer",
+          "DetachInstancesFromLoadBalancer",
+          "UpdateLoadBalancerAttribute",
+          "CreateLoadBalancerTlsCertificate",
+          "DeleteLoadBalancerTlsCertificate",
+          "AttachLoadBalancerTlsCertificate",
+          "CreateDisk",
+          "DeleteDisk",
+          "AttachDisk",
+          "DetachDisk",
+          "CreateDiskSnapshot",
+          "DeleteDiskSnapshot",
+          "CreateDiskFromSnapshot",
+          "CreateRelationalDatabase",
+          "UpdateRelationalDatabase",
+          "DeleteRelationalDatabase",
+          "CreateRelationalDatabaseFromSnapshot",
+          "CreateRelationalDatabaseSnapshot",
+          "DeleteRelationalDatabaseSnapshot",
+          "UpdateRelationalDatabaseParameters",
+          "StartRelationalDatabase",
+          "RebootRelationalDatabase",
+          "StopRelationalDatabase",
+        };
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DeleteInstance_HASH)
-          {
-            return OperationType::DeleteInstance;
-          }
-          else if (hashCode == CreateInstance_HASH)
-          {
-            return OperationType::CreateInstance;
-          }
-          else if (hashCode == StopInstance_HASH)
-          {
-            return OperationType::StopInstance;
-          }
-          else if (hashCode == StartInstance_HASH)
-          {
-            return OperationType::StartInstance;
-          }
-          else if (hashCode == RebootInstance_HASH)
-          {
-            return OperationType::RebootInstance;
-          }
-          else if (hashCode == OpenInstancePublicPorts_HASH)
-          {
-            return OperationType::OpenInstancePublicPorts;
-          }
-          else if (hashCode == PutInstancePublicPorts_HASH)
-          {
-            return OperationType::PutInstancePublicPorts;
-          }
-          else if (hashCode == CloseInstancePublicPorts_HASH)
-          {
-            return OperationType::CloseInstancePublicPorts;
-          }
-          else if (hashCode == AllocateStaticIp_HASH)
-          {
-            return OperationType::AllocateStaticIp;
-          }
-          else if (hashCode == ReleaseStaticIp_HASH)
-          {
-            return OperationType::ReleaseStaticIp;
-          }
-          else if (hashCode == AttachStaticIp_HASH)
-          {
-            return OperationType::AttachStaticIp;
-          }
-          else if (hashCode == DetachStaticIp_HASH)
-          {
-            return OperationType::DetachStaticIp;
-          }
-          else if (hashCode == UpdateDomainEntry_HASH)
-          {
-            return OperationType::UpdateDomainEntry;
-          }
-          else if (hashCode == DeleteDomainEntry_HASH)
-          {
-            return OperationType::DeleteDomainEntry;
-          }
-          else if (hashCode == CreateDomain_HASH)
-          {
-            return OperationType::CreateDomain;
-          }
-          else if (hashCode == DeleteDomain_HASH)
-          {
-            return OperationType::DeleteDomain;
-          }
-          else if (hashCode == CreateInstanceSnapshot_HASH)
-          {
-            return OperationType::CreateInstanceSnapshot;
-          }
-          else if (hashCode == DeleteInstanceSnapshot_HASH)
-          {
-            return OperationType::DeleteInstanceSnapshot;
-          }
-          else if (hashCode == CreateInstancesFromSnapshot_HASH)
-          {
-            return OperationType::CreateInstancesFromSnapshot;
-          }
-          else if (hashCode == CreateLoadBalancer_HASH)
-          {
-            return OperationType::CreateLoadBalancer;
-          }
-          else if (hashCode == DeleteLoadBalancer_HASH)
-          {
-            return OperationType::DeleteLoadBalancer;
-          }
-          else if (hashCode == AttachInstancesToLoadBalancer_HASH)
-          {
-            return OperationType::AttachInstancesToLoadBalancer;
-          }
-          else if (hashCode == DetachInstancesFromLoadBalancer_HASH)
-          {
-            return OperationType::DetachInstancesFromLoadBalancer;
-          }
-          else if (hashCode == UpdateLoadBalancerAttribute_HASH)
-          {
-            return OperationType::UpdateLoadBalancerAttribute;
-          }
-          else if (hashCode == CreateLoadBalancerTlsCertificate_HASH)
-          {
-            return OperationType::CreateLoadBalancerTlsCertificate;
-          }
-          else if (hashCode == DeleteLoadBalancerTlsCertificate_HASH)
-          {
-            return OperationType::DeleteLoadBalancerTlsCertificate;
-          }
-          else if (hashCode == AttachLoadBalancerTlsCertificate_HASH)
-          {
-            return OperationType::AttachLoadBalancerTlsCertificate;
-          }
-          else if (hashCode == CreateDisk_HASH)
-          {
-            return OperationType::CreateDisk;
-          }
-          else if (hashCode == DeleteDisk_HASH)
-          {
-            return OperationType::DeleteDisk;
-          }
-          else if (hashCode == AttachDisk_HASH)
-          {
-            return OperationType::AttachDisk;
-          }
-          else if (hashCode == DetachDisk_HASH)
-          {
-            return OperationType::DetachDisk;
-          }
-          else if (hashCode == CreateDiskSnapshot_HASH)
-          {
-            return OperationType::CreateDiskSnapshot;
-          }
-          else if (hashCode == DeleteDiskSnapshot_HASH)
-          {
-            return OperationType::DeleteDiskSnapshot;
-          }
-          else if (hashCode == CreateDiskFromSnapshot_HASH)
-          {
-            return OperationType::CreateDiskFromSnapshot;
-          }
-          else if (hashCode == CreateRelationalDatabase_HASH)
-          {
-            return OperationType::CreateRelationalDatabase;
-          }
-          else if (hashCode == UpdateRelationalDatabase_HASH)
-          {
-            return OperationType::UpdateRelationalDatabase;
-          }
-          else if (hashCode == DeleteRelationalDatabase_HASH)
-          {
-            return OperationType::DeleteRelationalDatabase;
-          }
-          else if (hashCode == CreateRelationalDatabaseFromSnapshot_HASH)
-          {
-            return OperationType::CreateRelationalDatabaseFromSnapshot;
-          }
-          else if (hashCode == CreateRelationalDatabaseSnapshot_HASH)
-          {
-            return OperationType::CreateRelationalDatabaseSnapshot;
-          }
-          else if (hashCode == DeleteRelationalDatabaseSnapshot_HASH)
-          {
-            return OperationType::DeleteRelationalDatabaseSnapshot;
-          }
-          else if (hashCode == UpdateRelationalDatabaseParameters_HASH)
-          {
-            return OperationType::UpdateRelationalDatabaseParameters;
-          }
-          else if (hashCode == StartRelationalDatabase_HASH)
-          {
-            return OperationType::StartRelationalDatabase;
-          }
-          else if (hashCode == RebootRelationalDatabase_HASH)
-          {
-            return OperationType::RebootRelationalDatabase;
-          }
-          else if (hashCode == StopRelationalDatabase_HASH)
-          {
-            return OperationType::StopRelationalDatabase;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 1795125120:
+            if (name == "DeleteInstance")
+            {
+              return OperationType::DeleteInstance;
+            }
+            break;
+          case 475703761:
+            if (name == "CreateInstance")
+            {
+              return OperationType::CreateInstance;
+            }
+            break;
+          case -453823785:
+            if (name == "StopInstance")
+            {
+              return OperationType::StopInstance;
+            }
+            break;
+          case 1481206519:
+            if (name == "StartInstance")
+            {
+              return OperationType::StartInstance;
+            }
+            break;
+          case 867321722:
+            if (name == "RebootInstance")
+            {
+              return OperationType::RebootInstance;
+            }
+            break;
+          case 1338274954:
+            if (name == "OpenInstancePublicPorts")
+            {
+              return OperationType::OpenInstancePublicPorts;
+            }
+            break;
+          case -786877467:
+            if (name == "PutInstancePublicPorts")
+            {
+              return OperationType::PutInstancePublicPorts;
+            }
+            break;
+          case -1326293412:
+            if (name == "CloseInstancePublicPorts")
+            {
+              return OperationType::CloseInstancePublicPorts;
+            }
+            break;
+          case -905240910:
+            if (name == "AllocateStaticIp")
+            {
+              return OperationType::AllocateStaticIp;
+            }
+            break;
+          case -2043068100:
+            if (name == "ReleaseStaticIp")
+            {
+              return OperationType::ReleaseStaticIp;
+            }
+            break;
+          case 1517813178:
+            if (name == "AttachStaticIp")
+            {
+              return OperationType::AttachStaticIp;
+            }
+            break;
+          case 107215112:
+            if (name == "DetachStaticIp")
+            {
+              return OperationType::DetachStaticIp;
+            }
+            break;
+          case -1415830171:
+            if (name == "UpdateDomainEntry")
+            {
+              return OperationType::UpdateDomainEntry;
+            }
+            break;
+          case -178104509:
+            if (name == "DeleteDomainEntry")
+            {
+              return OperationType::DeleteDomainEntry;
+            }
+            break;
+          case 1265895680:
+            if (name == "CreateDomain")
+            {
+              return OperationType::CreateDomain;
+            }
+            break;
+          case -1029935505:
+            if (name == "DeleteDomain")
+            {
+              return OperationType::DeleteDomain;
+            }
+            break;
+          case 1884652213:
+            if (name == "CreateInstanceSnapshot")
+            {
+              return OperationType::CreateInstanceSnapshot;
+            }
+            break;
+          case -550688412:
+            if (name == "DeleteInstanceSnapshot")
+            {
+              return OperationType::DeleteInstanceSnapshot;
+            }
+            break;
+          case -987178640:
+            if (name == "CreateInstancesFromSnapshot")
+            {
+              return OperationType::CreateInstancesFromSnapshot;
+            }
+            break;
+          case -1102485672:
+            if (name == "CreateLoadBalancer")
+            {
+              return OperationType::CreateLoadBalancer;
+            }
+            break;
+          case -56246905:
+            if (name == "DeleteLoadBalancer")
+            {
+              return OperationType::DeleteLoadBalancer;
+            }
+            break;
+          case -1203600336:
+            if (name == "AttachInstancesToLoadBalancer")
+            {
+              return OperationType::AttachInstancesToLoadBalancer;
+            }
+            break;
+          case -1447891183:
+            if (name == "DetachInstancesFromLoadBalancer")
+            {
+              return OperationType::DetachInstancesFromLoadBalancer;
+            }
+            break;
+          case -1046257545:
+            if (name == "UpdateLoadBalancerAttribute")
+            {
+              return OperationType::UpdateLoadBalancerAttribute;
+            }
+            break;
+          case -1101478124:
+            if (name == "CreateLoadBalancerTlsCertificate")
+            {
+              return OperationType::CreateLoadBalancerTlsCertificate;
+            }
+            break;
+          case -525394173:
+            if (name == "DeleteLoadBalancerTlsCertificate")
+            {
+              return OperationType::DeleteLoadBalancerTlsCertificate;
+            }
+            break;
+          case -1879467235:
+            if (name == "AttachLoadBalancerTlsCertificate")
+            {
+              return OperationType::AttachLoadBalancerTlsCertificate;
+            }
+            break;
+          case -932765479:
+            if (name == "CreateDisk")
+            {
+              return OperationType::CreateDisk;
+            }
+            break;
+          case -537389560:
+            if (name == "DeleteDisk")
+            {
+              return OperationType::DeleteDisk;
+            }
+            break;
+          case 28746146:
+            if (name == "AttachDisk")
+            {
+              return OperationType::AttachDisk;
+            }
+            break;
+          case 781218800:
+            if (name == "DetachDisk")
+            {
+              return OperationType::DetachDisk;
+            }
+            break;
+          case -1038192195:
+            if (name == "CreateDiskSnapshot")
+            {
+              return OperationType::CreateDiskSnapshot;
+            }
+            break;
+          case 8046572:
+            if (name == "DeleteDiskSnapshot")
+            {
+              return OperationType::DeleteDiskSnapshot;
+            }
+            break;
+          case 2114125575:
+            if (name == "CreateDiskFromSnapshot")
+            {
+              return OperationType::CreateDiskFromSnapshot;
+            }
+            break;
+          case -135360514:
+            if (name == "CreateRelationalDatabase")
+            {
+              return OperationType::CreateRelationalDatabase;
+            }
+            break;
+          case -1792954741:
+            if (name == "UpdateRelationalDatabase")
+            {
+              return OperationType::UpdateRelationalDatabase;
+            }
+            break;
+          case 259475181:
+            if (name == "DeleteRelationalDatabase")
+            {
+              return OperationType::DeleteRelationalDatabase;
+            }
+            break;
+          case -473178452:
+            if (name == "CreateRelationalDatabaseFromSnapshot")
+            {
+              return OperationType::CreateRelationalDatabaseFromSnapshot;
+            }
+            break;
+          case -1800737822:
+            if (name == "CreateRelationalDatabaseSnapshot")
+            {
+              return OperationType::CreateRelationalDatabaseSnapshot;
+            }
+            break;
+          case -1224653871:
+            if (name == "DeleteRelationalDatabaseSnapshot")
+            {
+              return OperationType::DeleteRelationalDatabaseSnapshot;
+            }
+            break;
+          case 1001839317:
+            if (name == "UpdateRelationalDatabaseParameters")
+            {
+              return OperationType::UpdateRelationalDatabaseParameters;
+            }
+            break;
+          case 655530404:
+            if (name == "StartRelationalDatabase")
+            {
+              return OperationType::StartRelationalDatabase;
+            }
+            break;
+          case -1692406169:
+            if (name == "RebootRelationalDatabase")
+            {
+              return OperationType::RebootRelationalDatabase;
+            }
+            break;
+          case -1014232700:
+            if (name == "StopRelationalDatabase")
+            {
+              return OperationType::StopRelationalDatabase;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -265,107 +366,26 @@ namespace Aws
           return OperationType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationType(OperationType enumValue)
+        const char* GetNameForOperationTypeCStr(OperationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperationType::DeleteInstance:
-            return "DeleteInstance";
-          case OperationType::CreateInstance:
-            return "CreateInstance";
-          case OperationType::StopInstance:
-            return "StopInstance";
-          case OperationType::StartInstance:
-            return "StartInstance";
-          case OperationType::RebootInstance:
-            return "RebootInstance";
-          case OperationType::OpenInstancePublicPorts:
-            return "OpenInstancePublicPorts";
-          case OperationType::PutInstancePublicPorts:
-            return "PutInstancePublicPorts";
-          case OperationType::CloseInstancePublicPorts:
-            return "CloseInstancePublicPorts";
-          case OperationType::AllocateStaticIp:
-            return "AllocateStaticIp";
-          case OperationType::ReleaseStaticIp:
-            return "ReleaseStaticIp";
-          case OperationType::AttachStaticIp:
-            return "AttachStaticIp";
-          case OperationType::DetachStaticIp:
-            return "DetachStaticIp";
-          case OperationType::UpdateDomainEntry:
-            return "UpdateDomainEntry";
-          case OperationType::DeleteDomainEntry:
-            return "DeleteDomainEntry";
-          case OperationType::CreateDomain:
-            return "CreateDomain";
-          case OperationType::DeleteDomain:
-            return "DeleteDomain";
-          case OperationType::CreateInstanceSnapshot:
-            return "CreateInstanceSnapshot";
-          case OperationType::DeleteInstanceSnapshot:
-            return "DeleteInstanceSnapshot";
-          case OperationType::CreateInstancesFromSnapshot:
-            return "CreateInstancesFromSnapshot";
-          case OperationType::CreateLoadBalancer:
-            return "CreateLoadBalancer";
-          case OperationType::DeleteLoadBalancer:
-            return "DeleteLoadBalancer";
-          case OperationType::AttachInstancesToLoadBalancer:
-            return "AttachInstancesToLoadBalancer";
-          case OperationType::DetachInstancesFromLoadBalancer:
-            return "DetachInstancesFromLoadBalancer";
-          case OperationType::UpdateLoadBalancerAttribute:
-            return "UpdateLoadBalancerAttribute";
-          case OperationType::CreateLoadBalancerTlsCertificate:
-            return "CreateLoadBalancerTlsCertificate";
-          case OperationType::DeleteLoadBalancerTlsCertificate:
-            return "DeleteLoadBalancerTlsCertificate";
-          case OperationType::AttachLoadBalancerTlsCertificate:
-            return "AttachLoadBalancerTlsCertificate";
-          case OperationType::CreateDisk:
-            return "CreateDisk";
-          case OperationType::DeleteDisk:
-            return "DeleteDisk";
-          case OperationType::AttachDisk:
-            return "AttachDisk";
-          case OperationType::DetachDisk:
-            return "DetachDisk";
-          case OperationType::CreateDiskSnapshot:
-            return "CreateDiskSnapshot";
-          case OperationType::DeleteDiskSnapshot:
-            return "DeleteDiskSnapshot";
-          case OperationType::CreateDiskFromSnapshot:
-            return "CreateDiskFromSnapshot";
-          case OperationType::CreateRelationalDatabase:
-            return "CreateRelationalDatabase";
-          case OperationType::UpdateRelationalDatabase:
-            return "UpdateRelationalDatabase";
-          case OperationType::DeleteRelationalDatabase:
-            return "DeleteRelationalDatabase";
-          case OperationType::CreateRelationalDatabaseFromSnapshot:
-            return "CreateRelationalDatabaseFromSnapshot";
-          case OperationType::CreateRelationalDatabaseSnapshot:
-            return "CreateRelationalDatabaseSnapshot";
-          case OperationType::DeleteRelationalDatabaseSnapshot:
-            return "DeleteRelationalDatabaseSnapshot";
-          case OperationType::UpdateRelationalDatabaseParameters:
-            return "UpdateRelationalDatabaseParameters";
-          case OperationType::StartRelationalDatabase:
-            return "StartRelationalDatabase";
-          case OperationType::RebootRelationalDatabase:
-            return "RebootRelationalDatabase";
-          case OperationType::StopRelationalDatabase:
-            return "StopRelationalDatabase";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperationType(OperationType enumValue)
+        {
+          return GetNameForOperationTypeCStr(enumValue);
         }
 
       } // namespace OperationTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PortAccessTypeMapper
       {
 
-        static const int Public_HASH = HashingUtils::HashString("Public");
-        static const int Private_HASH = HashingUtils::HashString("Private");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Public",
+          "Private",
+        };
 
         PortAccessType GetPortAccessTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Public_HASH)
-          {
-            return PortAccessType::Public;
-          }
-          else if (hashCode == Private_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PortAccessType::Private;
+          case -1893556599:
+            if (name == "Public")
+            {
+              return PortAccessType::Public;
+            }
+            break;
+          case 1350155619:
+            if (name == "Private")
+            {
+              return PortAccessType::Private;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PortAccessType::NOT_SET;
         }
 
-        Aws::String GetNameForPortAccessType(PortAccessType enumValue)
+        const char* GetNameForPortAccessTypeCStr(PortAccessType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PortAccessType::Public:
-            return "Public";
-          case PortAccessType::Private:
-            return "Private";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPortAccessType(PortAccessType enumValue)
+        {
+          return GetNameForPortAccessTypeCStr(enumValue);
         }
 
       } // namespace PortAccessTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PortInfoSourceTypeMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int INSTANCE_HASH = HashingUtils::HashString("INSTANCE");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "INSTANCE",
+          "NONE",
+        };
 
         PortInfoSourceType GetPortInfoSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return PortInfoSourceType::DEFAULT;
-          }
-          else if (hashCode == INSTANCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PortInfoSourceType::INSTANCE;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return PortInfoSourceType::NONE;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return PortInfoSourceType::DEFAULT;
+            }
+            break;
+          case 1337754773:
+            if (name == "INSTANCE")
+            {
+              return PortInfoSourceType::INSTANCE;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return PortInfoSourceType::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PortInfoSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForPortInfoSourceType(PortInfoSourceType enumValue)
+        const char* GetNameForPortInfoSourceTypeCStr(PortInfoSourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PortInfoSourceType::DEFAULT:
-            return "DEFAULT";
-          case PortInfoSourceType::INSTANCE:
-            return "INSTANCE";
-          case PortInfoSourceType::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPortInfoSourceType(PortInfoSourceType enumValue)
+        {
+          return GetNameForPortInfoSourceTypeCStr(enumValue);
         }
 
       } // namespace PortInfoSourceTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PortStateMapper
       {
 
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int closed_HASH = HashingUtils::HashString("closed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "open",
+          "closed",
+        };
 
         PortState GetPortStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == open_HASH)
-          {
-            return PortState::open;
-          }
-          else if (hashCode == closed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PortState::closed;
+          case 3417674:
+            if (name == "open")
+            {
+              return PortState::open;
+            }
+            break;
+          case -1357520532:
+            if (name == "closed")
+            {
+              return PortState::closed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PortState::NOT_SET;
         }
 
-        Aws::String GetNameForPortState(PortState enumValue)
+        const char* GetNameForPortStateCStr(PortState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PortState::open:
-            return "open";
-          case PortState::closed:
-            return "closed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPortState(PortState enumValue)
+        {
+          return GetNameForPortStateCStr(enumValue);
         }
 
       } // namespace PortStateMapper
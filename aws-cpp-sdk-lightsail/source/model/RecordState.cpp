@@ -30,25 +30,44 @@ namespace Aws
       namespace RecordStateMapper
       {
 
-        static const int Started_HASH = HashingUtils::HashString("Started");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Started",
+          "Succeeded",
+          "Failed",
+        };
 
         RecordState GetRecordStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Started_HASH)
-          {
-            return RecordState::Started;
-          }
-          else if (hashCode == Succeeded_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RecordState::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return RecordState::Failed;
+          case -232531871:
+            if (name == "Started")
+            {
+              return RecordState::Started;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return RecordState::Succeeded;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return RecordState::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RecordState::NOT_SET;
         }
 
-        Aws::String GetNameForRecordState(RecordState enumValue)
+        const char* GetNameForRecordStateCStr(RecordState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RecordState::Started:
-            return "Started";
-          case RecordState::Succeeded:
-            return "Succeeded";
-          case RecordState::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRecordState(RecordState enumValue)
+        {
+          return GetNameForRecordStateCStr(enumValue);
         }
 
       } // namespace RecordStateMapper
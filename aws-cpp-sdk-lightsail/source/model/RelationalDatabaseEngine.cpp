@@ -30,15 +30,30 @@ namespace Aws
       namespace RelationalDatabaseEngineMapper
       {
 
-        static const int mysql_HASH = HashingUtils::HashString("mysql");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "mysql",
+        };
 
         RelationalDatabaseEngine GetRelationalDatabaseEngineForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == mysql_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RelationalDatabaseEngine::mysql;
+          case 104382626:
+            if (name == "mysql")
+            {
+              return RelationalDatabaseEngine::mysql;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return RelationalDatabaseEngine::NOT_SET;
         }
 
-        Aws::String GetNameForRelationalDatabaseEngine(RelationalDatabaseEngine enumValue)
+        const char* GetNameForRelationalDatabaseEngineCStr(RelationalDatabaseEngine enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RelationalDatabaseEngine::mysql:
-            return "mysql";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRelationalDatabaseEngine(RelationalDatabaseEngine enumValue)
+        {
+          return GetNameForRelationalDatabaseEngineCStr(enumValue);
         }
 
       } // namespace RelationalDatabaseEngineMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace RelationalDatabaseMetricNameMapper
       {
 
-        static const int CPUUtilization_HASH = HashingUtils::HashString("CPUUtilization");
-        static const int DatabaseConnections_HASH = HashingUtils::HashString("DatabaseConnections");
-        static const int DiskQueueDepth_HASH = HashingUtils::HashString("DiskQueueDepth");
-        static const int FreeStorageSpace_HASH = HashingUtils::HashString("FreeStorageSpace");
-        static const int NetworkReceiveThroughput_HASH = HashingUtils::HashString("NetworkReceiveThroughput");
-        static const int NetworkTransmitThroughput_HASH = HashingUtils::HashString("NetworkTransmitThroughput");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CPUUtilization",
+          "DatabaseConnections",
+          "DiskQueueDepth",
+          "FreeStorageSpace",
+          "NetworkReceiveThroughput",
+          "NetworkTransmitThroughput",
+        };
 
         RelationalDatabaseMetricName GetRelationalDatabaseMetricNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CPUUtilization_HASH)
-          {
-            return RelationalDatabaseMetricName::CPUUtilization;
-          }
-          else if (hashCode == DatabaseConnections_HASH)
-          {
-            return RelationalDatabaseMetricName::DatabaseConnections;
-          }
-          else if (hashCode == DiskQueueDepth_HASH)
-          {
-            return RelationalDatabaseMetricName::DiskQueueDepth;
-          }
-          else if (hashCode == FreeStorageSpace_HASH)
-          {
-            return RelationalDatabaseMetricName::FreeStorageSpace;
-          }
-          else if (hashCode == NetworkReceiveThroughput_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RelationalDatabaseMetricName::NetworkReceiveThroughput;
-          }
-          else if (hashCode == NetworkTransmitThroughput_HASH)
-          {
-            return RelationalDatabaseMetricName::NetworkTransmitThroughput;
+          case -2140435590:
+            if (name == "CPUUtilization")
+            {
+              return RelationalDatabaseMetricName::CPUUtilization;
+            }
+            break;
+          case 351637690:
+            if (name == "DatabaseConnections")
+            {
+              return RelationalDatabaseMetricName::DatabaseConnections;
+            }
+            break;
+          case 1793448399:
+            if (name == "DiskQueueDepth")
+            {
+              return RelationalDatabaseMetricName::DiskQueueDepth;
+            }
+            break;
+          case 644382711:
+            if (name == "FreeStorageSpace")
+            {
+              return RelationalDatabaseMetricName::FreeStorageSpace;
+            }
+            break;
+          case 1047572735:
+            if (name == "NetworkReceiveThroughput")
+            {
+              return RelationalDatabaseMetricName::NetworkReceiveThroughput;
+            }
+            break;
+          case -200339544:
+            if (name == "NetworkTransmitThroughput")
+            {
+              return RelationalDatabaseMetricName::NetworkTransmitThroughput;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return RelationalDatabaseMetricName::NOT_SET;
         }
 
-        Aws::String GetNameForRelationalDatabaseMetricName(RelationalDatabaseMetricName enumValue)
+        const char* GetNameForRelationalDatabaseMetricNameCStr(RelationalDatabaseMetricName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RelationalDatabaseMetricName::CPUUtilization:
-            return "CPUUtilization";
-          case RelationalDatabaseMetricName::DatabaseConnections:
-            return "DatabaseConnections";
-          case RelationalDatabaseMetricName::DiskQueueDepth:
-            return "DiskQueueDepth";
-          case RelationalDatabaseMetricName::FreeStorageSpace:
-            return "FreeStorageSpace";
-          case RelationalDatabaseMetricName::NetworkReceiveThroughput:
-            return "NetworkReceiveThroughput";
-          case RelationalDatabaseMetricName::NetworkTransmitThroughput:
-            return "NetworkTransmitThroughput";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRelationalDatabaseMetricName(RelationalDatabaseMetricName enumValue)
+        {
+          return GetNameForRelationalDatabaseMetricNameCStr(enumValue);
         }
 
       } // namespace RelationalDatabaseMetricNameMapper
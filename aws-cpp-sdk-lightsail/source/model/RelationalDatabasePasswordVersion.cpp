@@ -30,25 +30,44 @@ namespace Aws
       namespace RelationalDatabasePasswordVersionMapper
       {
 
-        static const int CURRENT_HASH = HashingUtils::HashString("CURRENT");
-        static const int PREVIOUS_HASH = HashingUtils::HashString("PREVIOUS");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CURRENT",
+          "PREVIOUS",
+          "PENDING",
+        };
 
         RelationalDatabasePasswordVersion GetRelationalDatabasePasswordVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CURRENT_HASH)
-          {
-            return RelationalDatabasePasswordVersion::CURRENT;
-          }
-          else if (hashCode == PREVIOUS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RelationalDatabasePasswordVersion::PREVIOUS;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return RelationalDatabasePasswordVersion::PENDING;
+          case 1844922713:
+            if (name == "CURRENT")
+            {
+              return RelationalDatabasePasswordVersion::CURRENT;
+            }
+            break;
+          case -491148553:
+            if (name == "PREVIOUS")
+            {
+              return RelationalDatabasePasswordVersion::PREVIOUS;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return RelationalDatabasePasswordVersion::PENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RelationalDatabasePasswordVersion::NOT_SET;
         }
 
-        Aws::String GetNameForRelationalDatabasePasswordVersion(RelationalDatabasePasswordVersion enumValue)
+        const char* GetNameForRelationalDatabasePasswordVersionCStr(RelationalDatabasePasswordVersion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RelationalDatabasePasswordVersion::CURRENT:
-            return "CURRENT";
-          case RelationalDatabasePasswordVersion::PREVIOUS:
-            return "PREVIOUS";
-          case RelationalDatabasePasswordVersion::PENDING:
-            return "PENDING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRelationalDatabasePasswordVersion(RelationalDatabasePasswordVersion enumValue)
+        {
+          return GetNameForRelationalDatabasePasswordVersionCStr(enumValue);
         }
 
       } // namespace RelationalDatabasePasswordVersionMapper
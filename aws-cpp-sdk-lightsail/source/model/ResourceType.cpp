@@ -30,80 +30,121 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int Instance_HASH = HashingUtils::HashString("Instance");
-        static const int StaticIp_HASH = HashingUtils::HashString("StaticIp");
-        static const int KeyPair_HASH = HashingUtils::HashString("KeyPair");
-        static const int InstanceSnapshot_HASH = HashingUtils::HashString("InstanceSnapshot");
-        static const int Domain_HASH = HashingUtils::HashString("Domain");
-        static const int PeeredVpc_HASH = HashingUtils::HashString("PeeredVpc");
-        static const int LoadBalancer_HASH = HashingUtils::HashString("LoadBalancer");
-        static const int LoadBalancerTlsCertificate_HASH = HashingUtils::HashString("LoadBalancerTlsCertificate");
-        static const int Disk_HASH = HashingUtils::HashString("Disk");
-        static const int DiskSnapshot_HASH = HashingUtils::HashString("DiskSnapshot");
-        static const int RelationalDatabase_HASH = HashingUtils::HashString("RelationalDatabase");
-        static const int RelationalDatabaseSnapshot_HASH = HashingUtils::HashString("RelationalDatabaseSnapshot");
-        static const int ExportSnapshotRecord_HASH = HashingUtils::HashString("ExportSnapshotRecord");
-        static const int CloudFormationStackRecord_HASH = HashingUtils::HashString("CloudFormationStackRecord");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Instance",
+          "StaticIp",
+          "KeyPair",
+          "InstanceSnapshot",
+          "Domain",
+          "PeeredVpc",
+          "LoadBalancer",
+          "LoadBalancerTlsCertificate",
+          "Disk",
+          "DiskSnapshot",
+          "RelationalDatabase",
+          "RelationalDatabaseSnapshot",
+          "ExportSnapshotRecord",
+          "CloudFormationStackRecord",
+        };
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Instance_HASH)
-          {
-            return ResourceType::Instance;
-          }
-          else if (hashCode == StaticIp_HASH)
-          {
-            return ResourceType::StaticIp;
-          }
-          else if (hashCode == KeyPair_HASH)
-          {
-            return ResourceType::KeyPair;
-          }
-          else if (hashCode == InstanceSnapshot_HASH)
-          {
-            return ResourceType::InstanceSnapshot;
-          }
-          else if (hashCode == Domain_HASH)
-          {
-            return ResourceType::Domain;
-          }
-          else if (hashCode == PeeredVpc_HASH)
-          {
-            return ResourceType::PeeredVpc;
-          }
-          else if (hashCode == LoadBalancer_HASH)
-          {
-            return ResourceType::LoadBalancer;
-          }
-          else if (hashCode == LoadBalancerTlsCertificate_HASH)
-          {
-            return ResourceType::LoadBalancerTlsCertificate;
-          }
-          else if (hashCode == Disk_HASH)
-          {
-            return ResourceType::Disk;
-          }
-          else if (hashCode == DiskSnapshot_HASH)
-          {
-            return ResourceType::DiskSnapshot;
-          }
-          else if (hashCode == RelationalDatabase_HASH)
-          {
-            return ResourceType::RelationalDatabase;
-          }
-          else if (hashCode == RelationalDatabaseSnapshot_HASH)
-          {
-            return ResourceType::RelationalDatabaseSnapshot;
-          }
-          else if (hashCode == ExportSnapshotRecord_HASH)
-          {
-            return ResourceType::ExportSnapshotRecord;
-          }
-          else if (hashCode == CloudFormationStackRecord_HASH)
-          {
-            return ResourceType::CloudFormationStackRecord;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 619772085:
+            if (name == "Instance")
+            {
+              return ResourceType::Instance;
+            }
+            break;
+          case 1382963285:
+            if (name == "StaticIp")
+            {
+              return ResourceType::StaticIp;
+            }
+            break;
+          case 849069497:
+            if (name == "KeyPair")
+            {
+              return ResourceType::KeyPair;
+            }
+            break;
+          case 1773186457:
+            if (name == "InstanceSnapshot")
+            {
+              return ResourceType::InstanceSnapshot;
+            }
+            break;
+          case 2052636900:
+            if (name == "Domain")
+            {
+              return ResourceType::Domain;
+            }
+            break;
+          case -128628856:
+            if (name == "PeeredVpc")
+            {
+              return ResourceType::PeeredVpc;
+            }
+            break;
+          case -476732356:
+            if (name == "LoadBalancer")
+            {
+              return ResourceType::LoadBalancer;
+            }
+            break;
+          case 586589432:
+            if (name == "LoadBalancerTlsCertificate")
+            {
+              return ResourceType::LoadBalancerTlsCertificate;
+            }
+            break;
+          case 2130365:
+            if (name == "Disk")
+            {
+              return ResourceType::Disk;
+            }
+            break;
+          case -412438879:
+            if (name == "DiskSnapshot")
+            {
+              return ResourceType::DiskSnapshot;
+            }
+            break;
+          case 120230370:
+            if (name == "RelationalDatabase")
+            {
+              return ResourceType::RelationalDatabase;
+            }
+            break;
+          case -112670266:
+            if (name == "RelationalDatabaseSnapshot")
+            {
+              return ResourceType::RelationalDatabaseSnapshot;
+            }
+            break;
+          case 1297503273:
+            if (name == "ExportSnapshotRecord")
+            {
+              return ResourceType::ExportSnapshotRecord;
+            }
+            break;
+          case 1815793981:
+            if (name == "CloudFormationStackRecord")
+            {
+              return ResourceType::CloudFormationStackRecord;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -115,47 +156,26 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceTypeCStr(ResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceType::Instance:
-            return "Instance";
-          case ResourceType::StaticIp:
-            return "StaticIp";
-          case ResourceType::KeyPair:
-            return "KeyPair";
-          case ResourceType::InstanceSnapshot:
-            return "InstanceSnapshot";
-          case ResourceType::Domain:
-            return "Domain";
-          case ResourceType::PeeredVpc:
-            return "PeeredVpc";
-          case ResourceType::LoadBalancer:
-            return "LoadBalancer";
-          case ResourceType::LoadBalancerTlsCertificate:
-            return "LoadBalancerTlsCertificate";
-          case ResourceType::Disk:
-            return "Disk";
-          case ResourceType::DiskSnapshot:
-            return "DiskSnapshot";
-          case ResourceType::RelationalDatabase:
-            return "RelationalDatabase";
-          case ResourceType::RelationalDatabaseSnapshot:
-            return "RelationalDatabaseSnapshot";
-          case ResourceType::ExportSnapshotRecord:
-            return "ExportSnapshotRecord";
-          case ResourceType::CloudFormationStackRecord:
-            return "CloudFormationStackRecord";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceType(ResourceType enumValue)
+        {
+          return GetNameForResourceTypeCStr(enumValue);
         }
 
       } // namespace ResourceTypeMapper
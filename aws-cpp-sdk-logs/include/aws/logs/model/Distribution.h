@@ -35,6 +35,11 @@ namespace DistributionMapper
 AWS_CLOUDWATCHLOGS_API Distribution GetDistributionForName(const Aws::String& name);
 
 AWS_CLOUDWATCHLOGS_API Aws::String GetNameForDistribution(Distribution value);
+
+/**
+ * Same as GetNameForDistribution(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCHLOGS_API const char* GetNameForDistributionCStr(Distribution value);
 } // namespace DistributionMapper
 } // namespace Model
 } // namespace CloudWatchLogs
@@ -39,6 +39,11 @@ namespace ExportTaskStatusCodeMapper
 AWS_CLOUDWATCHLOGS_API ExportTaskStatusCode GetExportTaskStatusCodeForName(const Aws::String& name);
 
 AWS_CLOUDWATCHLOGS_API Aws::String GetNameForExportTaskStatusCode(ExportTaskStatusCode value);
+
+/**
+ * Same as GetNameForExportTaskStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCHLOGS_API const char* GetNameForExportTaskStatusCodeCStr(ExportTaskStatusCode value);
 } // namespace ExportTaskStatusCodeMapper
 } // namespace Model
 } // namespace CloudWatchLogs
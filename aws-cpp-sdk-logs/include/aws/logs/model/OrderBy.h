@@ -35,6 +35,11 @@ namespace OrderByMapper
 AWS_CLOUDWATCHLOGS_API OrderBy GetOrderByForName(const Aws::String& name);
 
 AWS_CLOUDWATCHLOGS_API Aws::String GetNameForOrderBy(OrderBy value);
+
+/**
+ * Same as GetNameForOrderBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCHLOGS_API const char* GetNameForOrderByCStr(OrderBy value);
 } // namespace OrderByMapper
 } // namespace Model
 } // namespace CloudWatchLogs
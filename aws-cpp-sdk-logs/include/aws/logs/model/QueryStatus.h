@@ -38,6 +38,11 @@ namespace QueryStatusMapper
 AWS_CLOUDWATCHLOGS_API QueryStatus GetQueryStatusForName(const Aws::String& name);
 
 AWS_CLOUDWATCHLOGS_API Aws::String GetNameForQueryStatus(QueryStatus value);
+
+/**
+ * Same as GetNameForQueryStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCHLOGS_API const char* GetNameForQueryStatusCStr(QueryStatus value);
 } // namespace QueryStatusMapper
 } // namespace Model
 } // namespace CloudWatchLogs
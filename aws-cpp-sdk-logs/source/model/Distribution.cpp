@@ -30,20 +30,37 @@ namespace Aws
       namespace DistributionMapper
       {
 
-        static const int Random_HASH = HashingUtils::HashString("Random");
-        static const int ByLogStream_HASH = HashingUtils::HashString("ByLogStream");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Random",
+          "ByLogStream",
+        };
 
         Distribution GetDistributionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Random_HASH)
-          {
-            return Distribution::Random;
-          }
-          else if (hashCode == ByLogStream_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Distribution::ByLogStream;
+          case -1854418717:
+            if (name == "Random")
+            {
+              return Distribution::Random;
+            }
+            break;
+          case -981726931:
+            if (name == "ByLogStream")
+            {
+              return Distribution::ByLogStream;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Distribution::NOT_SET;
         }
 
-        Aws::String GetNameForDistribution(Distribution enumValue)
+        const char* GetNameForDistributionCStr(Distribution enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Distribution::Random:
-            return "Random";
-          case Distribution::ByLogStream:
-            return "ByLogStream";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDistribution(Distribution enumValue)
+        {
+          return GetNameForDistributionCStr(enumValue);
         }
 
       } // namespace DistributionMapper
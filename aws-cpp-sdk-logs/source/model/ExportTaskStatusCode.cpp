@@ -30,40 +30,65 @@ namespace Aws
       namespace ExportTaskStatusCodeMapper
       {
 
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int PENDING_CANCEL_HASH = HashingUtils::HashString("PENDING_CANCEL");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CANCELLED",
+          "COMPLETED",
+          "FAILED",
+          "PENDING",
+          "PENDING_CANCEL",
+          "RUNNING",
+        };
 
         ExportTaskStatusCode GetExportTaskStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CANCELLED_HASH)
-          {
-            return ExportTaskStatusCode::CANCELLED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return ExportTaskStatusCode::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ExportTaskStatusCode::FAILED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return ExportTaskStatusCode::PENDING;
-          }
-          else if (hashCode == PENDING_CANCEL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExportTaskStatusCode::PENDING_CANCEL;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ExportTaskStatusCode::RUNNING;
+          case -1031784143:
+            if (name == "CANCELLED")
+            {
+              return ExportTaskStatusCode::CANCELLED;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return ExportTaskStatusCode::COMPLETED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ExportTaskStatusCode::FAILED;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ExportTaskStatusCode::PENDING;
+            }
+            break;
+          case -2143599038:
+            if (name == "PENDING_CANCEL")
+            {
+              return ExportTaskStatusCode::PENDING_CANCEL;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return ExportTaskStatusCode::RUNNING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ExportTaskStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForExportTaskStatusCode(ExportTaskStatusCode enumValue)
+        const char* GetNameForExportTaskStatusCodeCStr(ExportTaskStatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExportTaskStatusCode::CANCELLED:
-            return "CANCELLED";
-          case ExportTaskStatusCode::COMPLETED:
-            return "COMPLETED";
-          case ExportTaskStatusCode::FAILED:
-            return "FAILED";
-          case ExportTaskStatusCode::PENDING:
-            return "PENDING";
-          case ExportTaskStatusCode::PENDING_CANCEL:
-            return "PENDING_CANCEL";
-          case ExportTaskStatusCode::RUNNING:
-            return "RUNNING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExportTaskStatusCode(ExportTaskStatusCode enumValue)
+        {
+          return GetNameForExportTaskStatusCodeCStr(enumValue);
         }
 
       } // namespace ExportTaskStatusCodeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace OrderByMapper
       {
 
-        static const int LogStreamName_HASH = HashingUtils::HashString("LogStreamName");
-        static const int LastEventTime_HASH = HashingUtils::HashString("LastEventTime");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LogStreamName",
+          "LastEventTime",
+        };
 
         OrderBy GetOrderByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LogStreamName_HASH)
-          {
-            return OrderBy::LogStreamName;
-          }
-          else if (hashCode == LastEventTime_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OrderBy::LastEventTime;
+          case 1015605359:
+            if (name == "LogStreamName")
+            {
+              return OrderBy::LogStreamName;
+            }
+            break;
+          case -963992975:
+            if (name == "LastEventTime")
+            {
+              return OrderBy::LastEventTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OrderBy::NOT_SET;
         }
 
-        Aws::String GetNameForOrderBy(OrderBy enumValue)
+        const char* GetNameForOrderByCStr(OrderBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OrderBy::LogStreamName:
-            return "LogStreamName";
-          case OrderBy::LastEventTime:
-            return "LastEventTime";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOrderBy(OrderBy enumValue)
+        {
+          return GetNameForOrderByCStr(enumValue);
         }
 
       } // namespace OrderByMapper
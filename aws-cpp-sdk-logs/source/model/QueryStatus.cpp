@@ -30,35 +30,58 @@ namespace Aws
       namespace QueryStatusMapper
       {
 
-        static const int Scheduled_HASH = HashingUtils::HashString("Scheduled");
-        static const int Running_HASH = HashingUtils::HashString("Running");
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Scheduled",
+          "Running",
+          "Complete",
+          "Failed",
+          "Cancelled",
+        };
 
         QueryStatus GetQueryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Scheduled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return QueryStatus::Scheduled;
-          }
-          else if (hashCode == Running_HASH)
-          {
-            return QueryStatus::Running;
-          }
-          else if (hashCode == Complete_HASH)
-          {
-            return QueryStatus::Complete;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return QueryStatus::Failed;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return QueryStatus::Cancelled;
+          case 1843257485:
+            if (name == "Scheduled")
+            {
+              return QueryStatus::Scheduled;
+            }
+            break;
+          case -1079530081:
+            if (name == "Running")
+            {
+              return QueryStatus::Running;
+            }
+            break;
+          case -534801063:
+            if (name == "Complete")
+            {
+              return QueryStatus::Complete;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return QueryStatus::Failed;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return QueryStatus::Cancelled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return QueryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForQueryStatus(QueryStatus enumValue)
+        const char* GetNameForQueryStatusCStr(QueryStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QueryStatus::Scheduled:
-            return "Scheduled";
-          case QueryStatus::Running:
-            return "Running";
-          case QueryStatus::Complete:
-            return "Complete";
-          case QueryStatus::Failed:
-            return "Failed";
-          case QueryStatus::Cancelled:
-            return "Cancelled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQueryStatus(QueryStatus enumValue)
+        {
+          return GetNameForQueryStatusCStr(enumValue);
         }
 
       } // namespace QueryStatusMapper
@@ -34,6 +34,11 @@ namespace AlgorithmMapper
 AWS_MACHINELEARNING_API Algorithm GetAlgorithmForName(const Aws::String& name);
 
 AWS_MACHINELEARNING_API Aws::String GetNameForAlgorithm(Algorithm value);
+
+/**
+ * Same as GetNameForAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACHINELEARNING_API const char* GetNameForAlgorithmCStr(Algorithm value);
 } // namespace AlgorithmMapper
 } // namespace Model
 } // namespace MachineLearning
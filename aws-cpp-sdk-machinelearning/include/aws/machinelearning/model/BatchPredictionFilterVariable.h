@@ -41,6 +41,11 @@ namespace BatchPredictionFilterVariableMapper
 AWS_MACHINELEARNING_API BatchPredictionFilterVariable GetBatchPredictionFilterVariableForName(const Aws::String& name);
 
 AWS_MACHINELEARNING_API Aws::String GetNameForBatchPredictionFilterVariable(BatchPredictionFilterVariable value);
+
+/**
+ * Same as GetNameForBatchPredictionFilterVariable(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACHINELEARNING_API const char* GetNameForBatchPredictionFilterVariableCStr(BatchPredictionFilterVariable value);
 } // namespace BatchPredictionFilterVariableMapper
 } // namespace Model
 } // namespace MachineLearning
@@ -39,6 +39,11 @@ namespace DataSourceFilterVariableMapper
 AWS_MACHINELEARNING_API DataSourceFilterVariable GetDataSourceFilterVariableForName(const Aws::String& name);
 
 AWS_MACHINELEARNING_API Aws::String GetNameForDataSourceFilterVariable(DataSourceFilterVariable value);
+
+/**
+ * Same as GetNameForDataSourceFilterVariable(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACHINELEARNING_API const char* GetNameForDataSourceFilterVariableCStr(DataSourceFilterVariable value);
 } // namespace DataSourceFilterVariableMapper
 } // namespace Model
 } // namespace MachineLearning
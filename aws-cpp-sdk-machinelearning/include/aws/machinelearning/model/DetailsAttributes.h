@@ -35,6 +35,11 @@ namespace DetailsAttributesMapper
 AWS_MACHINELEARNING_API DetailsAttributes GetDetailsAttributesForName(const Aws::String& name);
 
 AWS_MACHINELEARNING_API Aws::String GetNameForDetailsAttributes(DetailsAttributes value);
+
+/**
+ * Same as GetNameForDetailsAttributes(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACHINELEARNING_API const char* GetNameForDetailsAttributesCStr(DetailsAttributes value);
 } // namespace DetailsAttributesMapper
 } // namespace Model
 } // namespace MachineLearning
@@ -38,6 +38,11 @@ namespace EntityStatusMapper
 AWS_MACHINELEARNING_API EntityStatus GetEntityStatusForName(const Aws::String& name);
 
 AWS_MACHINELEARNING_API Aws::String GetNameForEntityStatus(EntityStatus value);
+
+/**
+ * Same as GetNameForEntityStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACHINELEARNING_API const char* GetNameForEntityStatusCStr(EntityStatus value);
 } // namespace EntityStatusMapper
 } // namespace Model
 } // namespace MachineLearning
@@ -41,6 +41,11 @@ namespace EvaluationFilterVariableMapper
 AWS_MACHINELEARNING_API EvaluationFilterVariable GetEvaluationFilterVariableForName(const Aws::String& name);
 
 AWS_MACHINELEARNING_API Aws::String GetNameForEvaluationFilterVariable(EvaluationFilterVariable value);
+
+/**
+ * Same as GetNameForEvaluationFilterVariable(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACHINELEARNING_API const char* GetNameForEvaluationFilterVariableCStr(EvaluationFilterVariable value);
 } // namespace EvaluationFilterVariableMapper
 } // namespace Model
 } // namespace MachineLearning
@@ -43,6 +43,11 @@ namespace MLModelFilterVariableMapper
 AWS_MACHINELEARNING_API MLModelFilterVariable GetMLModelFilterVariableForName(const Aws::String& name);
 
 AWS_MACHINELEARNING_API Aws::String GetNameForMLModelFilterVariable(MLModelFilterVariable value);
+
+/**
+ * Same as GetNameForMLModelFilterVariable(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACHINELEARNING_API const char* GetNameForMLModelFilterVariableCStr(MLModelFilterVariable value);
 } // namespace MLModelFilterVariableMapper
 } // namespace Model
 } // namespace MachineLearning
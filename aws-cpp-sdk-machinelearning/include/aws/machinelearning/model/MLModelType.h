@@ -36,6 +36,11 @@ namespace MLModelTypeMapper
 AWS_MACHINELEARNING_API MLModelType GetMLModelTypeForName(const Aws::String& name);
 
 AWS_MACHINELEARNING_API Aws::String GetNameForMLModelType(MLModelType value);
+
+/**
+ * Same as GetNameForMLModelType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACHINELEARNING_API const char* GetNameForMLModelTypeCStr(MLModelType value);
 } // namespace MLModelTypeMapper
 } // namespace Model
 } // namespace MachineLearning
@@ -37,6 +37,11 @@ namespace RealtimeEndpointStatusMapper
 AWS_MACHINELEARNING_API RealtimeEndpointStatus GetRealtimeEndpointStatusForName(const Aws::String& name);
 
 AWS_MACHINELEARNING_API Aws::String GetNameForRealtimeEndpointStatus(RealtimeEndpointStatus value);
+
+/**
+ * Same as GetNameForRealtimeEndpointStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACHINELEARNING_API const char* GetNameForRealtimeEndpointStatusCStr(RealtimeEndpointStatus value);
 } // namespace RealtimeEndpointStatusMapper
 } // namespace Model
 } // namespace MachineLearning
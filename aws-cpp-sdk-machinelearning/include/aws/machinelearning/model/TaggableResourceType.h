@@ -37,6 +37,11 @@ namespace TaggableResourceTypeMapper
 AWS_MACHINELEARNING_API TaggableResourceType GetTaggableResourceTypeForName(const Aws::String& name);
 
 AWS_MACHINELEARNING_API Aws::String GetNameForTaggableResourceType(TaggableResourceType value);
+
+/**
+ * Same as GetNameForTaggableResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACHINELEARNING_API const char* GetNameForTaggableResourceTypeCStr(TaggableResourceType value);
 } // namespace TaggableResourceTypeMapper
 } // namespace Model
 } // namespace MachineLearning
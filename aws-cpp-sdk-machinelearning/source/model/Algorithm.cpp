@@ -30,15 +30,30 @@ namespace Aws
       namespace AlgorithmMapper
       {
 
-        static const int sgd_HASH = HashingUtils::HashString("sgd");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "sgd",
+        };
 
         Algorithm GetAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == sgd_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Algorithm::sgd;
+          case 113808:
+            if (name == "sgd")
+            {
+              return Algorithm::sgd;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return Algorithm::NOT_SET;
         }
 
-        Aws::String GetNameForAlgorithm(Algorithm enumValue)
+        const char* GetNameForAlgorithmCStr(Algorithm enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Algorithm::sgd:
-            return "sgd";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAlgorithm(Algorithm enumValue)
+        {
+          return GetNameForAlgorithmCStr(enumValue);
         }
 
       } // namespace AlgorithmMapper
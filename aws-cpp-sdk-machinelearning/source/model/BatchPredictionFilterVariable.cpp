@@ -30,50 +30,79 @@ namespace Aws
       namespace BatchPredictionFilterVariableMapper
       {
 
-        static const int CreatedAt_HASH = HashingUtils::HashString("CreatedAt");
-        static const int LastUpdatedAt_HASH = HashingUtils::HashString("LastUpdatedAt");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int IAMUser_HASH = HashingUtils::HashString("IAMUser");
-        static const int MLModelId_HASH = HashingUtils::HashString("MLModelId");
-        static const int DataSourceId_HASH = HashingUtils::HashString("DataSourceId");
-        static const int DataURI_HASH = HashingUtils::HashString("DataURI");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CreatedAt",
+          "LastUpdatedAt",
+          "Status",
+          "Name",
+          "IAMUser",
+          "MLModelId",
+          "DataSourceId",
+          "DataURI",
+        };
 
         BatchPredictionFilterVariable GetBatchPredictionFilterVariableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreatedAt_HASH)
-          {
-            return BatchPredictionFilterVariable::CreatedAt;
-          }
-          else if (hashCode == LastUpdatedAt_HASH)
-          {
-            return BatchPredictionFilterVariable::LastUpdatedAt;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return BatchPredictionFilterVariable::Status;
-          }
-          else if (hashCode == Name_HASH)
-          {
-            return BatchPredictionFilterVariable::Name;
-          }
-          else if (hashCode == IAMUser_HASH)
-          {
-            return BatchPredictionFilterVariable::IAMUser;
-          }
-          else if (hashCode == MLModelId_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BatchPredictionFilterVariable::MLModelId;
-          }
-          else if (hashCode == DataSourceId_HASH)
-          {
-            return BatchPredictionFilterVariable::DataSourceId;
-          }
-          else if (hashCode == DataURI_HASH)
-          {
-            return BatchPredictionFilterVariable::DataURI;
+          case -1692627685:
+            if (name == "CreatedAt")
+            {
+              return BatchPredictionFilterVariable::CreatedAt;
+            }
+            break;
+          case 1350364216:
+            if (name == "LastUpdatedAt")
+            {
+              return BatchPredictionFilterVariable::LastUpdatedAt;
+            }
+            break;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return BatchPredictionFilterVariable::Status;
+            }
+            break;
+          case 2420395:
+            if (name == "Name")
+            {
+              return BatchPredictionFilterVariable::Name;
+            }
+            break;
+          case -1997056096:
+            if (name == "IAMUser")
+            {
+              return BatchPredictionFilterVariable::IAMUser;
+            }
+            break;
+          case 466168709:
+            if (name == "MLModelId")
+            {
+              return BatchPredictionFilterVariable::MLModelId;
+            }
+            break;
+          case -1057082240:
+            if (name == "DataSourceId")
+            {
+              return BatchPredictionFilterVariable::DataSourceId;
+            }
+            break;
+          case -1187129022:
+            if (name == "DataURI")
+            {
+              return BatchPredictionFilterVariable::DataURI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return BatchPredictionFilterVariable::NOT_SET;
         }
 
-        Aws::String GetNameForBatchPredictionFilterVariable(BatchPredictionFilterVariable enumValue)
+        const char* GetNameForBatchPredictionFilterVariableCStr(BatchPredictionFilterVariable enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BatchPredictionFilterVariable::CreatedAt:
-            return "CreatedAt";
-          case BatchPredictionFilterVariable::LastUpdatedAt:
-            return "LastUpdatedAt";
-          case BatchPredictionFilterVariable::Status:
-            return "Status";
-          case BatchPredictionFilterVariable::Name:
-            return "Name";
-          case BatchPredictionFilterVariable::IAMUser:
-            return "IAMUser";
-          case BatchPredictionFilterVariable::MLModelId:
-            return "MLModelId";
-          case BatchPredictionFilterVariable::DataSourceId:
-            return "DataSourceId";
-          case BatchPredictionFilterVariable::DataURI:
-            return "DataURI";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBatchPredictionFilterVariable(BatchPredictionFilterVariable enumValue)
+        {
+          return GetNameForBatchPredictionFilterVariableCStr(enumValue);
         }
 
       } // namespace BatchPredictionFilterVariableMapper
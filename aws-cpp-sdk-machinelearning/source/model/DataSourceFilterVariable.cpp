@@ -30,40 +30,65 @@ namespace Aws
       namespace DataSourceFilterVariableMapper
       {
 
-        static const int CreatedAt_HASH = HashingUtils::HashString("CreatedAt");
-        static const int LastUpdatedAt_HASH = HashingUtils::HashString("LastUpdatedAt");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int DataLocationS3_HASH = HashingUtils::HashString("DataLocationS3");
-        static const int IAMUser_HASH = HashingUtils::HashString("IAMUser");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CreatedAt",
+          "LastUpdatedAt",
+          "Status",
+          "Name",
+          "DataLocationS3",
+          "IAMUser",
+        };
 
         DataSourceFilterVariable GetDataSourceFilterVariableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreatedAt_HASH)
-          {
-            return DataSourceFilterVariable::CreatedAt;
-          }
-          else if (hashCode == LastUpdatedAt_HASH)
-          {
-            return DataSourceFilterVariable::LastUpdatedAt;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return DataSourceFilterVariable::Status;
-          }
-          else if (hashCode == Name_HASH)
-          {
-            return DataSourceFilterVariable::Name;
-          }
-          else if (hashCode == DataLocationS3_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DataSourceFilterVariable::DataLocationS3;
-          }
-          else if (hashCode == IAMUser_HASH)
-          {
-            return DataSourceFilterVariable::IAMUser;
+          case -1692627685:
+            if (name == "CreatedAt")
+            {
+              return DataSourceFilterVariable::CreatedAt;
+            }
+            break;
+          case 1350364216:
+            if (name == "LastUpdatedAt")
+            {
+              return DataSourceFilterVariable::LastUpdatedAt;
+            }
+            break;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return DataSourceFilterVariable::Status;
+            }
+            break;
+          case 2420395:
+            if (name == "Name")
+            {
+              return DataSourceFilterVariable::Name;
+            }
+            break;
+          case 409869343:
+            if (name == "DataLocationS3")
+            {
+              return DataSourceFilterVariable::DataLocationS3;
+            }
+            break;
+          case -1997056096:
+            if (name == "IAMUser")
+            {
+              return DataSourceFilterVariable::IAMUser;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return DataSourceFilterVariable::NOT_SET;
         }
 
-        Aws::String GetNameForDataSourceFilterVariable(DataSourceFilterVariable enumValue)
+        const char* GetNameForDataSourceFilterVariableCStr(DataSourceFilterVariable enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DataSourceFilterVariable::CreatedAt:
-            return "CreatedAt";
-          case DataSourceFilterVariable::LastUpdatedAt:
-            return "LastUpdatedAt";
-          case DataSourceFilterVariable::Status:
-            return "Status";
-          case DataSourceFilterVariable::Name:
-            return "Name";
-          case DataSourceFilterVariable::DataLocationS3:
-            return "DataLocationS3";
-          case DataSourceFilterVariable::IAMUser:
-            return "IAMUser";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDataSourceFilterVariable(DataSourceFilterVariable enumValue)
+        {
+          return GetNameForDataSourceFilterVariableCStr(enumValue);
         }
 
       } // namespace DataSourceFilterVariableMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DetailsAttributesMapper
       {
 
-        static const int PredictiveModelType_HASH = HashingUtils::HashString("PredictiveModelType");
-        static const int Algorithm_HASH = HashingUtils::HashString("Algorithm");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PredictiveModelType",
+          "Algorithm",
+        };
 
         DetailsAttributes GetDetailsAttributesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PredictiveModelType_HASH)
-          {
-            return DetailsAttributes::PredictiveModelType;
-          }
-          else if (hashCode == Algorithm_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DetailsAttributes::Algorithm;
+          case 791821124:
+            if (name == "PredictiveModelType")
+            {
+              return DetailsAttributes::PredictiveModelType;
+            }
+            break;
+          case -2065509297:
+            if (name == "Algorithm")
+            {
+              return DetailsAttributes::Algorithm;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DetailsAttributes::NOT_SET;
         }
 
-        Aws::String GetNameForDetailsAttributes(DetailsAttributes enumValue)
+        const char* GetNameForDetailsAttributesCStr(DetailsAttributes enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DetailsAttributes::PredictiveModelType:
-            return "PredictiveModelType";
-          case DetailsAttributes::Algorithm:
-            return "Algorithm";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDetailsAttributes(DetailsAttributes enumValue)
+        {
+          return GetNameForDetailsAttributesCStr(enumValue);
         }
 
       } // namespace DetailsAttributesMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace EntityStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int INPROGRESS_HASH = HashingUtils::HashString("INPROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "INPROGRESS",
+          "FAILED",
+          "COMPLETED",
+          "DELETED",
+        };
 
         EntityStatus GetEntityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EntityStatus::PENDING;
-          }
-          else if (hashCode == INPROGRESS_HASH)
-          {
-            return EntityStatus::INPROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return EntityStatus::FAILED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return EntityStatus::COMPLETED;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return EntityStatus::DELETED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return EntityStatus::PENDING;
+            }
+            break;
+          case -926562734:
+            if (name == "INPROGRESS")
+            {
+              return EntityStatus::INPROGRESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return EntityStatus::FAILED;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return EntityStatus::COMPLETED;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return EntityStatus::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return EntityStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEntityStatus(EntityStatus enumValue)
+        const char* GetNameForEntityStatusCStr(EntityStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EntityStatus::PENDING:
-            return "PENDING";
-          case EntityStatus::INPROGRESS:
-            return "INPROGRESS";
-          case EntityStatus::FAILED:
-            return "FAILED";
-          case EntityStatus::COMPLETED:
-            return "COMPLETED";
-          case EntityStatus::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEntityStatus(EntityStatus enumValue)
+        {
+          return GetNameForEntityStatusCStr(enumValue);
         }
 
       } // namespace EntityStatusMapper
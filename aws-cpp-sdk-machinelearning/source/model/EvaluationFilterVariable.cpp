@@ -30,50 +30,79 @@ namespace Aws
       namespace EvaluationFilterVariableMapper
       {
 
-        static const int CreatedAt_HASH = HashingUtils::HashString("CreatedAt");
-        static const int LastUpdatedAt_HASH = HashingUtils::HashString("LastUpdatedAt");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int IAMUser_HASH = HashingUtils::HashString("IAMUser");
-        static const int MLModelId_HASH = HashingUtils::HashString("MLModelId");
-        static const int DataSourceId_HASH = HashingUtils::HashString("DataSourceId");
-        static const int DataURI_HASH = HashingUtils::HashString("DataURI");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CreatedAt",
+          "LastUpdatedAt",
+          "Status",
+          "Name",
+          "IAMUser",
+          "MLModelId",
+          "DataSourceId",
+          "DataURI",
+        };
 
         EvaluationFilterVariable GetEvaluationFilterVariableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreatedAt_HASH)
-          {
-            return EvaluationFilterVariable::CreatedAt;
-          }
-          else if (hashCode == LastUpdatedAt_HASH)
-          {
-            return EvaluationFilterVariable::LastUpdatedAt;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return EvaluationFilterVariable::Status;
-          }
-          else if (hashCode == Name_HASH)
-          {
-            return EvaluationFilterVariable::Name;
-          }
-          else if (hashCode == IAMUser_HASH)
-          {
-            return EvaluationFilterVariable::IAMUser;
-          }
-          else if (hashCode == MLModelId_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EvaluationFilterVariable::MLModelId;
-          }
-          else if (hashCode == DataSourceId_HASH)
-          {
-            return EvaluationFilterVariable::DataSourceId;
-          }
-          else if (hashCode == DataURI_HASH)
-          {
-            return EvaluationFilterVariable::DataURI;
+          case -1692627685:
+            if (name == "CreatedAt")
+            {
+              return EvaluationFilterVariable::CreatedAt;
+            }
+            break;
+          case 1350364216:
+            if (name == "LastUpdatedAt")
+            {
+              return EvaluationFilterVariable::LastUpdatedAt;
+            }
+            break;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return EvaluationFilterVariable::Status;
+            }
+            break;
+          case 2420395:
+            if (name == "Name")
+            {
+              return EvaluationFilterVariable::Name;
+            }
+            break;
+          case -1997056096:
+            if (name == "IAMUser")
+            {
+              return EvaluationFilterVariable::IAMUser;
+            }
+            break;
+          case 466168709:
+            if (name == "MLModelId")
+            {
+              return EvaluationFilterVariable::MLModelId;
+            }
+            break;
+          case -1057082240:
+            if (name == "DataSourceId")
+            {
+              return EvaluationFilterVariable::DataSourceId;
+            }
+            break;
+          case -1187129022:
+            if (name == "DataURI")
+            {
+              return EvaluationFilterVariable::DataURI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return EvaluationFilterVariable::NOT_SET;
         }
 
-        Aws::String GetNameForEvaluationFilterVariable(EvaluationFilterVariable enumValue)
+        const char* GetNameForEvaluationFilterVariableCStr(EvaluationFilterVariable enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EvaluationFilterVariable::CreatedAt:
-            return "CreatedAt";
-          case EvaluationFilterVariable::LastUpdatedAt:
-            return "LastUpdatedAt";
-          case EvaluationFilterVariable::Status:
-            return "Status";
-          case EvaluationFilterVariable::Name:
-            return "Name";
-          case EvaluationFilterVariable::IAMUser:
-            return "IAMUser";
-          case EvaluationFilterVariable::MLModelId:
-            return "MLModelId";
-          case EvaluationFilterVariable::DataSourceId:
-            return "DataSourceId";
-          case EvaluationFilterVariable::DataURI:
-            return "DataURI";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEvaluationFilterVariable(EvaluationFilterVariable enumValue)
+        {
+          return GetNameForEvaluationFilterVariableCStr(enumValue);
         }
 
       } // namespace EvaluationFilterVariableMapper
@@ -30,60 +30,93 @@ namespace Aws
       namespace MLModelFilterVariableMapper
       {
 
-        static const int CreatedAt_HASH = HashingUtils::HashString("CreatedAt");
-        static const int LastUpdatedAt_HASH = HashingUtils::HashString("LastUpdatedAt");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int IAMUser_HASH = HashingUtils::HashString("IAMUser");
-        static const int TrainingDataSourceId_HASH = HashingUtils::HashString("TrainingDataSourceId");
-        static const int RealtimeEndpointStatus_HASH = HashingUtils::HashString("RealtimeEndpointStatus");
-        static const int MLModelType_HASH = HashingUtils::HashString("MLModelType");
-        static const int Algorithm_HASH = HashingUtils::HashString("Algorithm");
-        static const int TrainingDataURI_HASH = HashingUtils::HashString("TrainingDataURI");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CreatedAt",
+          "LastUpdatedAt",
+          "Status",
+          "Name",
+          "IAMUser",
+          "TrainingDataSourceId",
+          "RealtimeEndpointStatus",
+          "MLModelType",
+          "Algorithm",
+          "TrainingDataURI",
+        };
 
         MLModelFilterVariable GetMLModelFilterVariableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreatedAt_HASH)
-          {
-            return MLModelFilterVariable::CreatedAt;
-          }
-          else if (hashCode == LastUpdatedAt_HASH)
-          {
-            return MLModelFilterVariable::LastUpdatedAt;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return MLModelFilterVariable::Status;
-          }
-          else if (hashCode == Name_HASH)
-          {
-            return MLModelFilterVariable::Name;
-          }
-          else if (hashCode == IAMUser_HASH)
-          {
-            return MLModelFilterVariable::IAMUser;
-          }
-          else if (hashCode == TrainingDataSourceId_HASH)
-          {
-            return MLModelFilterVariable::TrainingDataSourceId;
-          }
-          else if (hashCode == RealtimeEndpointStatus_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MLModelFilterVariable::RealtimeEndpointStatus;
-          }
-          else if (hashCode == MLModelType_HASH)
-          {
-            return MLModelFilterVariable::MLModelType;
-          }
-          else if (hashCode == Algorithm_HASH)
-          {
-            return MLModelFilterVariable::Algorithm;
-          }
-          else if (hashCode == TrainingDataURI_HASH)
-          {
-            return MLModelFilterVariable::TrainingDataURI;
+          case -1692627685:
+            if (name == "CreatedAt")
+            {
+              return MLModelFilterVariable::CreatedAt;
+            }
+            break;
+          case 1350364216:
+            if (name == "LastUpdatedAt")
+            {
+              return MLModelFilterVariable::LastUpdatedAt;
+            }
+            break;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return MLModelFilterVariable::Status;
+            }
+            break;
+          case 2420395:
+            if (name == "Name")
+            {
+              return MLModelFilterVariable::Name;
+            }
+            break;
+          case -1997056096:
+            if (name == "IAMUser")
+            {
+              return MLModelFilterVariable::IAMUser;
+            }
+            break;
+          case -1264911750:
+            if (name == "TrainingDataSourceId")
+            {
+              return MLModelFilterVariable::TrainingDataSourceId;
+            }
+            break;
+          case -1416862638:
+            if (name == "RealtimeEndpointStatus")
+            {
+              return MLModelFilterVariable::RealtimeEndpointStatus;
+            }
+            break;
+          case 1311882020:
+            if (name == "MLModelType")
+            {
+              return MLModelFilterVariable::MLModelType;
+            }
+            break;
+          case -2065509297:
+            if (name == "Algorithm")
+            {
+              return MLModelFilterVariable::Algorithm;
+            }
+            break;
+          case -18366712:
+            if (name == "TrainingDataURI")
+            {
+              return MLModelFilterVariable::TrainingDataURI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return MLModelFilterVariable::NOT_SET;
         }
 
-        Aws::String GetNameForMLModelFilterVariable(MLModelFilterVariable enumValue)
+        const char* GetNameForMLModelFilterVariableCStr(MLModelFilterVariable enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MLModelFilterVariable::CreatedAt:
-            return "CreatedAt";
-          case MLModelFilterVariable::LastUpdatedAt:
-            return "LastUpdatedAt";
-          case MLModelFilterVariable::Status:
-            return "Status";
-          case MLModelFilterVariable::Name:
-            return "Name";
-          case MLModelFilterVariable::IAMUser:
-            return "IAMUser";
-          case MLModelFilterVariable::TrainingDataSourceId:
-            return "TrainingDataSourceId";
-          case MLModelFilterVariable::RealtimeEndpointStatus:
-            return "RealtimeEndpointStatus";
-          case MLModelFilterVariable::MLModelType:
-            return "MLModelType";
-          case MLModelFilterVariable::Algorithm:
-            return "Algorithm";
-          case MLModelFilterVariable::TrainingDataURI:
-            return "TrainingDataURI";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMLModelFilterVariable(MLModelFilterVariable enumValue)
+        {
+          return GetNameForMLModelFilterVariableCStr(enumValue);
         }
 
       } // namespace MLModelFilterVariableMapper
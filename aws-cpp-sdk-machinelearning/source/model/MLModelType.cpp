@@ -30,25 +30,44 @@ namespace Aws
       namespace MLModelTypeMapper
       {
 
-        static const int REGRESSION_HASH = HashingUtils::HashString("REGRESSION");
-        static const int BINARY_HASH = HashingUtils::HashString("BINARY");
-        static const int MULTICLASS_HASH = HashingUtils::HashString("MULTICLASS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REGRESSION",
+          "BINARY",
+          "MULTICLASS",
+        };
 
         MLModelType GetMLModelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGRESSION_HASH)
-          {
-            return MLModelType::REGRESSION;
-          }
-          else if (hashCode == BINARY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MLModelType::BINARY;
-          }
-          else if (hashCode == MULTICLASS_HASH)
-          {
-            return MLModelType::MULTICLASS;
+          case 1906404417:
+            if (name == "REGRESSION")
+            {
+              return MLModelType::REGRESSION;
+            }
+            break;
+          case 1959329793:
+            if (name == "BINARY")
+            {
+              return MLModelType::BINARY;
+            }
+            break;
+          case 1738152927:
+            if (name == "MULTICLASS")
+            {
+              return MLModelType::MULTICLASS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return MLModelType::NOT_SET;
         }
 
-        Aws::String GetNameForMLModelType(MLModelType enumValue)
+        const char* GetNameForMLModelTypeCStr(MLModelType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MLModelType::REGRESSION:
-            return "REGRESSION";
-          case MLModelType::BINARY:
-            return "BINARY";
-          case MLModelType::MULTICLASS:
-            return "MULTICLASS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMLModelType(MLModelType enumValue)
+        {
+          return GetNameForMLModelTypeCStr(enumValue);
         }
 
       } // namespace MLModelTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace RealtimeEndpointStatusMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "READY",
+          "UPDATING",
+          "FAILED",
+        };
 
         RealtimeEndpointStatus GetRealtimeEndpointStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return RealtimeEndpointStatus::NONE;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return RealtimeEndpointStatus::READY;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return RealtimeEndpointStatus::UPDATING;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RealtimeEndpointStatus::FAILED;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return RealtimeEndpointStatus::NONE;
+            }
+            break;
+          case 77848963:
+            if (name == "READY")
+            {
+              return RealtimeEndpointStatus::READY;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return RealtimeEndpointStatus::UPDATING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return RealtimeEndpointStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return RealtimeEndpointStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRealtimeEndpointStatus(RealtimeEndpointStatus enumValue)
+        const char* GetNameForRealtimeEndpointStatusCStr(RealtimeEndpointStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RealtimeEndpointStatus::NONE:
-            return "NONE";
-          case RealtimeEndpointStatus::READY:
-            return "READY";
-          case RealtimeEndpointStatus::UPDATING:
-            return "UPDATING";
-          case RealtimeEndpointStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRealtimeEndpointStatus(RealtimeEndpointStatus enumValue)
+        {
+          return GetNameForRealtimeEndpointStatusCStr(enumValue);
         }
 
       } // namespace RealtimeEndpointStatusMapper
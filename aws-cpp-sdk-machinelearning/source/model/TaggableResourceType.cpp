@@ -30,30 +30,51 @@ namespace Aws
       namespace TaggableResourceTypeMapper
       {
 
-        static const int BatchPrediction_HASH = HashingUtils::HashString("BatchPrediction");
-        static const int DataSource_HASH = HashingUtils::HashString("DataSource");
-        static const int Evaluation_HASH = HashingUtils::HashString("Evaluation");
-        static const int MLModel_HASH = HashingUtils::HashString("MLModel");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BatchPrediction",
+          "DataSource",
+          "Evaluation",
+          "MLModel",
+        };
 
         TaggableResourceType GetTaggableResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BatchPrediction_HASH)
-          {
-            return TaggableResourceType::BatchPrediction;
-          }
-          else if (hashCode == DataSource_HASH)
-          {
-            return TaggableResourceType::DataSource;
-          }
-          else if (hashCode == Evaluation_HASH)
-          {
-            return TaggableResourceType::Evaluation;
-          }
-          else if (hashCode == MLModel_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TaggableResourceType::MLModel;
+          case 94253897:
+            if (name == "BatchPrediction")
+            {
+              return TaggableResourceType::BatchPrediction;
+            }
+            break;
+          case -1029031803:
+            if (name == "DataSource")
+            {
+              return TaggableResourceType::DataSource;
+            }
+            break;
+          case -1442978980:
+            if (name == "Evaluation")
+            {
+              return TaggableResourceType::Evaluation;
+            }
+            break;
+          case 1868639434:
+            if (name == "MLModel")
+            {
+              return TaggableResourceType::MLModel;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return TaggableResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForTaggableResourceType(TaggableResourceType enumValue)
+        const char* GetNameForTaggableResourceTypeCStr(TaggableResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TaggableResourceType::BatchPrediction:
-            return "BatchPrediction";
-          case TaggableResourceType::DataSource:
-            return "DataSource";
-          case TaggableResourceType::Evaluation:
-            return "Evaluation";
-          case TaggableResourceType::MLModel:
-            return "MLModel";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTaggableResourceType(TaggableResourceType enumValue)
+        {
+          return GetNameForTaggableResourceTypeCStr(enumValue);
         }
 
       } // namespace TaggableResourceTypeMapper
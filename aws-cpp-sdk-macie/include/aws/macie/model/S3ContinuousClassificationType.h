@@ -34,6 +34,11 @@ namespace S3ContinuousClassificationTypeMapper
 AWS_MACIE_API S3ContinuousClassificationType GetS3ContinuousClassificationTypeForName(const Aws::String& name);
 
 AWS_MACIE_API Aws::String GetNameForS3ContinuousClassificationType(S3ContinuousClassificationType value);
+
+/**
+ * Same as GetNameForS3ContinuousClassificationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACIE_API const char* GetNameForS3ContinuousClassificationTypeCStr(S3ContinuousClassificationType value);
 } // namespace S3ContinuousClassificationTypeMapper
 } // namespace Model
 } // namespace Macie
@@ -35,6 +35,11 @@ namespace S3OneTimeClassificationTypeMapper
 AWS_MACIE_API S3OneTimeClassificationType GetS3OneTimeClassificationTypeForName(const Aws::String& name);
 
 AWS_MACIE_API Aws::String GetNameForS3OneTimeClassificationType(S3OneTimeClassificationType value);
+
+/**
+ * Same as GetNameForS3OneTimeClassificationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MACIE_API const char* GetNameForS3OneTimeClassificationTypeCStr(S3OneTimeClassificationType value);
 } // namespace S3OneTimeClassificationTypeMapper
 } // namespace Model
 } // namespace Macie
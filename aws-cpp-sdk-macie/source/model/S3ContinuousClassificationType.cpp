@@ -30,15 +30,30 @@ namespace Aws
       namespace S3ContinuousClassificationTypeMapper
       {
 
-        static const int FULL_HASH = HashingUtils::HashString("FULL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FULL",
+        };
 
         S3ContinuousClassificationType GetS3ContinuousClassificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return S3ContinuousClassificationType::FULL;
+          case 2169487:
+            if (name == "FULL")
+            {
+              return S3ContinuousClassificationType::FULL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return S3ContinuousClassificationType::NOT_SET;
         }
 
-        Aws::String GetNameForS3ContinuousClassificationType(S3ContinuousClassificationType enumValue)
+        const char* GetNameForS3ContinuousClassificationTypeCStr(S3ContinuousClassificationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case S3ContinuousClassificationType::FULL:
-            return "FULL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForS3ContinuousClassificationType(S3ContinuousClassificationType enumValue)
+        {
+          return GetNameForS3ContinuousClassificationTypeCStr(enumValue);
         }
 
       } // namespace S3ContinuousClassificationTypeMapper
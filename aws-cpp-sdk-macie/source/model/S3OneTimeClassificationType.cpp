@@ -30,20 +30,37 @@ namespace Aws
       namespace S3OneTimeClassificationTypeMapper
       {
 
-        static const int FULL_HASH = HashingUtils::HashString("FULL");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FULL",
+          "NONE",
+        };
 
         S3OneTimeClassificationType GetS3OneTimeClassificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_HASH)
-          {
-            return S3OneTimeClassificationType::FULL;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return S3OneTimeClassificationType::NONE;
+          case 2169487:
+            if (name == "FULL")
+            {
+              return S3OneTimeClassificationType::FULL;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return S3OneTimeClassificationType::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return S3OneTimeClassificationType::NOT_SET;
         }
 
-        Aws::String GetNameForS3OneTimeClassificationType(S3OneTimeClassificationType enumValue)
+        const char* GetNameForS3OneTimeClassificationTypeCStr(S3OneTimeClassificationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case S3OneTimeClassificationType::FULL:
-            return "FULL";
-          case S3OneTimeClassificationType::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForS3OneTimeClassificationType(S3OneTimeClassificationType enumValue)
+        {
+          return GetNameForS3OneTimeClassificationTypeCStr(enumValue);
         }
 
       } // namespace S3OneTimeClassificationTypeMapper
@@ -35,6 +35,11 @@ namespace GetEntitlementFilterNameMapper
 AWS_MARKETPLACEENTITLEMENTSERVICE_API GetEntitlementFilterName GetGetEntitlementFilterNameForName(const Aws::String& name);
 
 AWS_MARKETPLACEENTITLEMENTSERVICE_API Aws::String GetNameForGetEntitlementFilterName(GetEntitlementFilterName value);
+
+/**
+ * Same as GetNameForGetEntitlementFilterName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MARKETPLACEENTITLEMENTSERVICE_API const char* GetNameForGetEntitlementFilterNameCStr(GetEntitlementFilterName value);
 } // namespace GetEntitlementFilterNameMapper
 } // namespace Model
 } // namespace MarketplaceEntitlementService
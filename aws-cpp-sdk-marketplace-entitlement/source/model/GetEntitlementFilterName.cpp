@@ -30,20 +30,37 @@ namespace Aws
       namespace GetEntitlementFilterNameMapper
       {
 
-        static const int CUSTOMER_IDENTIFIER_HASH = HashingUtils::HashString("CUSTOMER_IDENTIFIER");
-        static const int DIMENSION_HASH = HashingUtils::HashString("DIMENSION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CUSTOMER_IDENTIFIER",
+          "DIMENSION",
+        };
 
         GetEntitlementFilterName GetGetEntitlementFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CUSTOMER_IDENTIFIER_HASH)
-          {
-            return GetEntitlementFilterName::CUSTOMER_IDENTIFIER;
-          }
-          else if (hashCode == DIMENSION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GetEntitlementFilterName::DIMENSION;
+          case -1427404886:
+            if (name == "CUSTOMER_IDENTIFIER")
+            {
+              return GetEntitlementFilterName::CUSTOMER_IDENTIFIER;
+            }
+            break;
+          case 1691581766:
+            if (name == "DIMENSION")
+            {
+              return GetEntitlementFilterName::DIMENSION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return GetEntitlementFilterName::NOT_SET;
         }
 
-        Aws::String GetNameForGetEntitlementFilterName(GetEntitlementFilterName enumValue)
+        const char* GetNameForGetEntitlementFilterNameCStr(GetEntitlementFilterName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GetEntitlementFilterName::CUSTOMER_IDENTIFIER:
-            return "CUSTOMER_IDENTIFIER";
-          case GetEntitlementFilterName::DIMENSION:
-            return "DIMENSION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGetEntitlementFilterName(GetEntitlementFilterName enumValue)
+        {
+          return GetNameForGetEntitlementFilterNameCStr(enumValue);
         }
 
       } // namespace GetEntitlementFilterNameMapper
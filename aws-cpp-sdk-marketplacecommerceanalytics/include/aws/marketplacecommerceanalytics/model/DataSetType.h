@@ -54,6 +54,11 @@ namespace DataSetTypeMapper
 AWS_MARKETPLACECOMMERCEANALYTICS_API DataSetType GetDataSetTypeForName(const Aws::String& name);
 
 AWS_MARKETPLACECOMMERCEANALYTICS_API Aws::String GetNameForDataSetType(DataSetType value);
+
+/**
+ * Same as GetNameForDataSetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MARKETPLACECOMMERCEANALYTICS_API const char* GetNameForDataSetTypeCStr(DataSetType value);
 } // namespace DataSetTypeMapper
 } // namespace Model
 } // namespace MarketplaceCommerceAnalytics
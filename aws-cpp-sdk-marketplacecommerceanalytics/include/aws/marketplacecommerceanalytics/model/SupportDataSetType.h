@@ -35,6 +35,11 @@ namespace SupportDataSetTypeMapper
 AWS_MARKETPLACECOMMERCEANALYTICS_API SupportDataSetType GetSupportDataSetTypeForName(const Aws::String& name);
 
 AWS_MARKETPLACECOMMERCEANALYTICS_API Aws::String GetNameForSupportDataSetType(SupportDataSetType value);
+
+/**
+ * Same as GetNameForSupportDataSetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MARKETPLACECOMMERCEANALYTICS_API const char* GetNameForSupportDataSetTypeCStr(SupportDataSetType value);
 } // namespace SupportDataSetTypeMapper
 } // namespace Model
 } // namespace MarketplaceCommerceAnalytics
@@ -30,115 +30,170 @@ namespace Aws
       namespace DataSetTypeMapper
       {
 
-        static const int customer_subscriber_hourly_monthly_subscriptions_HASH = HashingUtils::HashString("customer_subscriber_hourly_monthly_subscriptions");
-        static const int customer_subscriber_annual_subscriptions_HASH = HashingUtils::HashString("customer_subscriber_annual_subscriptions");
-        static const int daily_business_usage_by_instance_type_HASH = HashingUtils::HashString("daily_business_usage_by_instance_type");
-        static const int daily_business_fees_HASH = HashingUtils::HashString("daily_business_fees");
-        static const int daily_business_free_trial_conversions_HASH = HashingUtils::HashString("daily_business_free_trial_conversions");
-        static const int daily_business_new_instances_HASH = HashingUtils::HashString("daily_business_new_instances");
-        static const int daily_business_new_product_subscribers_HASH = HashingUtils::HashString("daily_business_new_product_subscribers");
-        static const int daily_business_canceled_product_subscribers_HASH = HashingUtils::HashString("daily_business_canceled_product_subscribers");
-        static const int monthly_revenue_billing_and_revenue_data_HASH = HashingUtils::HashString("monthly_revenue_billing_and_revenue_data");
-        static const int monthly_revenue_annual_subscriptions_HASH = HashingUtils::HashString("monthly_revenue_annual_subscriptions");
-        static const int disbursed_amount_by_product_HASH = HashingUtils::HashString("disbursed_amount_by_product");
-        static const int disbursed_amount_by_product_with_uncollected_funds_HASH = HashingUtils::HashString("disbursed_amount_by_product_with_uncollected_funds");
-        static const int disbursed_amount_by_instance_hours_HASH = HashingUtils::HashString("disbursed_amount_by_instance_hours");
-        static const int disbursed_amount_by_customer_geo_HASH = HashingUtils::HashString("disbursed_amount_by_customer_geo");
-        static const int disbursed_amount_by_age_of_uncollected_funds_HASH = HashingUtils::HashString("disbursed_amount_by_age_of_uncollected_funds");
-        static const int disbursed_amount_by_age_of_disbursed_funds_HASH = HashingUtils::HashString("disbursed_amount_by_age_of_disbursed_funds");
-        static const int customer_profile_by_industry_HASH = HashingUtils::HashString("customer_profile_by_industry");
-        static const int customer_profile_by_revenue_HASH = HashingUtils::HashString("customer_profile_by_revenue");
-        static const int customer_profile_by_geography_HASH = HashingUtils::HashString("customer_profile_by_geography");
-        static const int sales_compensation_billed_revenue_HASH = HashingUtils::HashString("sales_compensation_billed_revenue");
-        static const int us_sales_and_use_tax_records_HASH = HashingUtils::HashString("us_sales_and_use_tax_records");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "customer_subscriber_hourly_monthly_subscriptions",
+          "customer_subscriber_annual_subscriptions",
+          "daily_business_usage_by_instance_type",
+          "daily_business_fees",
+          "daily_business_free_trial_conversions",
+          "daily_business_new_instances",
+          "daily_business_new_product_subscribers",
+          "daily_business_canceled_product_subscribers",
+          "monthly_revenue_billing_and_revenue_data",
+          "monthly_revenue_annual_subscriptions",
+          "disbursed_amount_by_product",
+          "disbursed_amount_by_product_with_uncollected_funds",
+          "disbursed_amount_by_instance_hours",
+          "disbursed_amount_by_customer_geo",
+          "disbursed_amount_by_age_of_uncollected_funds",
+          "disbursed_amount_by_age_of_disbursed_funds",
+          "customer_profile_by_industry",
+          "customer_profile_by_revenue",
+          "customer_profile_by_geography",
+          "sales_compensation_billed_revenue",
+          "us_sales_and_use_tax_records",
+        };
 
         DataSetType GetDataSetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == customer_subscriber_hourly_monthly_subscriptions_HASH)
-          {
-            return DataSetType::customer_subscriber_hourly_monthly_subscriptions;
-          }
-          else if (hashCode == customer_subscriber_annual_subscriptions_HASH)
-          {
-            return DataSetType::customer_subscriber_annual_subscriptions;
-          }
-          else if (hashCode == daily_business_usage_by_instance_type_HASH)
-          {
-            return DataSetType::daily_business_usage_by_instance_type;
-          }
-          else if (hashCode == daily_business_fees_HASH)
-          {
-            return DataSetType::daily_business_fees;
-          }
-          else if (hashCode == daily_business_free_trial_conversions_HASH)
-          {
-            return DataSetType::daily_business_free_trial_conversions;
-          }
-          else if (hashCode == daily_business_new_instances_HASH)
-          {
-            return DataSetType::daily_business_new_instances;
-          }
-          else if (hashCode == daily_business_new_product_subscribers_HASH)
-          {
-            return DataSetType::daily_business_new_product_subscribers;
-          }
-          else if (hashCode == daily_business_canceled_product_subscribers_HASH)
-          {
-            return DataSetType::daily_business_canceled_product_subscribers;
-          }
-          else if (hashCode == monthly_revenue_billing_and_revenue_data_HASH)
-          {
-            return DataSetType::monthly_revenue_billing_and_revenue_data;
-          }
-          else if (hashCode == monthly_revenue_annual_subscriptions_HASH)
-          {
-            return DataSetType::monthly_revenue_annual_subscriptions;
-          }
-          else if (hashCode == disbursed_amount_by_product_HASH)
-          {
-            return DataSetType::disbursed_amount_by_product;
-          }
-          else if (hashCode == disbursed_amount_by_product_with_uncollected_funds_HASH)
-          {
-            return DataSetType::disbursed_amount_by_product_with_uncollected_funds;
-          }
-          else if (hashCode == disbursed_amount_by_instance_hours_HASH)
-          {
-            return DataSetType::disbursed_amount_by_instance_hours;
-          }
-          else if (hashCode == disbursed_amount_by_customer_geo_HASH)
-          {
-            return DataSetType::disbursed_amount_by_customer_geo;
-          }
-          else if (hashCode == disbursed_amount_by_age_of_uncollected_funds_HASH)
-          {
-            return DataSetType::disbursed_amount_by_age_of_uncollected_funds;
-          }
-          else if (hashCode == disbursed_amount_by_age_of_disbursed_funds_HASH)
-          {
-            return DataSetType::disbursed_amount_by_age_of_disbursed_funds;
-          }
-          else if (hashCode == customer_profile_by_industry_HASH)
-          {
-            return DataSetType::customer_profile_by_industry;
-          }
-          else if (hashCode == customer_profile_by_revenue_HASH)
-          {
-            return DataSetType::customer_profile_by_revenue;
-          }
-          else if (hashCode == customer_profile_by_geography_HASH)
-          {
-            return DataSetType::customer_profile_by_geography;
-          }
-          else if (hashCode == sales_compensation_billed_revenue_HASH)
-          {
-            return DataSetType::sales_compensation_billed_revenue;
-          }
-          else if (hashCode == us_sales_and_use_tax_records_HASH)
-          {
-            return DataSetType::us_sales_and_use_tax_records;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 786200588:
+            if (name == "customer_subscriber_hourly_monthly_subscriptions")
+            {
+              return DataSetType::customer_subscriber_hourly_monthly_subscriptions;
+            }
+            break;
+          case 1798780844:
+            if (name == "customer_subscriber_annual_subscriptions")
+            {
+              return DataSetType::customer_subscriber_annual_subscriptions;
+            }
+            break;
+          case 1266045651:
+            if (name == "daily_business_usage_by_instance_type")
+            {
+              return DataSetType::daily_business_usage_by_instance_type;
+            }
+            break;
+          case -2137700570:
+            if (name == "daily_business_fees")
+            {
+              return DataSetType::daily_business_fees;
+            }
+            break;
+          case 769256602:
+            if (name == "daily_business_free_trial_conversions")
+            {
+              return DataSetType::daily_business_free_trial_conversions;
+            }
+            break;
+          case -797093562:
+            if (name == "daily_business_new_instances")
+            {
+              return DataSetType::daily_business_new_instances;
+            }
+            break;
+          case -904431997:
+            if (name == "daily_business_new_product_subscribers")
+            {
+              return DataSetType::daily_business_new_product_subscribers;
+            }
+            break;
+          case 1036488590:
+            if (name == "daily_business_canceled_product_subscribers")
+            {
+              return DataSetType::daily_business_canceled_product_subscribers;
+            }
+            break;
+          case 416395598:
+            if (name == "monthly_revenue_billing_and_revenue_data")
+            {
+              return DataSetType::monthly_revenue_billing_and_revenue_data;
+            }
+            break;
+          case 418975691:
+            if (name == "monthly_revenue_annual_subscriptions")
+            {
+              return DataSetType::monthly_revenue_annual_subscriptions;
+            }
+            break;
+          case 1019747856:
+            if (name == "disbursed_amount_by_product")
+            {
+              return DataSetType::disbursed_amount_by_product;
+            }
+            break;
+          case -1946945035:
+            if (name == "disbursed_amount_by_product_with_uncollected_funds")
+            {
+              return DataSetType::disbursed_amount_by_product_with_uncollected_funds;
+            }
+            break;
+          case -1549692252:
+            if (name == "disbursed_amount_by_instance_hours")
+            {
+              return DataSetType::disbursed_amount_by_instance_hours;
+            }
+            break;
+          case -879797521:
+            if (name == "disbursed_amount_by_customer_geo")
+            {
+              return DataSetType::disbursed_amount_by_customer_geo;
+            }
+            break;
+          case -1081466378:
+            if (name == "disbursed_amount_by_age_of_uncollected_funds")
+            {
+              return DataSetType::disbursed_amount_by_age_of_uncollected_funds;
+            }
+            break;
+          case -1239734873:
+            if (name == "disbursed_amount_by_age_of_disbursed_funds")
+            {
+              return DataSetType::disbursed_amount_by_age_of_disbursed_funds;
+            }
+            break;
+          case -2033156785:
+            if (name == "customer_profile_by_industry")
+            {
+              return DataSetType::customer_profile_by_industry;
+            }
+            break;
+          case -216770933:
+            if (name == "customer_profile_by_revenue")
+            {
+              return DataSetType::customer_profile_by_revenue;
+            }
+            break;
+          case -1313494485:
+            if (name == "customer_profile_by_geography")
+            {
+              return DataSetType::customer_profile_by_geography;
+            }
+            break;
+          case -1450232427:
+            if (name == "sales_compensation_billed_revenue")
+            {
+              return DataSetType::sales_compensation_billed_revenue;
+            }
+            break;
+          case -952659334:
+            if (name == "us_sales_and_use_tax_records")
+            {
+              return DataSetType::us_sales_and_use_tax_records;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -150,61 +205,26 @@ namespace Aws
           return DataSetType::NOT_SET;
         }
 
-        Aws::String GetNameForDataSetType(DataSetType enumValue)
+        const char* GetNameForDataSetTypeCStr(DataSetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DataSetType::customer_subscriber_hourly_monthly_subscriptions:
-            return "customer_subscriber_hourly_monthly_subscriptions";
-          case DataSetType::customer_subscriber_annual_subscriptions:
-            return "customer_subscriber_annual_subscriptions";
-          case DataSetType::daily_business_usage_by_instance_type:
-            return "daily_business_usage_by_instance_type";
-          case DataSetType::daily_business_fees:
-            return "daily_business_fees";
-          case DataSetType::daily_business_free_trial_conversions:
-            return "daily_business_free_trial_conversions";
-          case DataSetType::daily_business_new_instances:
-            return "daily_business_new_instances";
-          case DataSetType::daily_business_new_product_subscribers:
-            return "daily_business_new_product_subscribers";
-          case DataSetType::daily_business_canceled_product_subscribers:
-            return "daily_business_canceled_product_subscribers";
-          case DataSetType::monthly_revenue_billing_and_revenue_data:
-            return "monthly_revenue_billing_and_revenue_data";
-          case DataSetType::monthly_revenue_annual_subscriptions:
-            return "monthly_revenue_annual_subscriptions";
-          case DataSetType::disbursed_amount_by_product:
-            return "disbursed_amount_by_product";
-          case DataSetType::disbursed_amount_by_product_with_uncollected_funds:
-            return "disbursed_amount_by_product_with_uncollected_funds";
-          case DataSetType::disbursed_amount_by_instance_hours:
-            return "disbursed_amount_by_instance_hours";
-          case DataSetType::disbursed_amount_by_customer_geo:
-            return "disbursed_amount_by_customer_geo";
-          case DataSetType::disbursed_amount_by_age_of_uncollected_funds:
-            return "disbursed_amount_by_age_of_uncollected_funds";
-          case DataSetType::disbursed_amount_by_age_of_disbursed_funds:
-            return "disbursed_amount_by_age_of_disbursed_funds";
-          case DataSetType::customer_profile_by_industry:
-            return "customer_profile_by_industry";
-          case DataSetType::customer_profile_by_revenue:
-            return "customer_profile_by_revenue";
-          case DataSetType::customer_profile_by_geography:
-            return "customer_profile_by_geography";
-          case DataSetType::sales_compensation_billed_revenue:
-            return "sales_compensation_billed_revenue";
-          case DataSetType::us_sales_and_use_tax_records:
-            return "us_sales_and_use_tax_records";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDataSetType(DataSetType enumValue)
+        {
+          return GetNameForDataSetTypeCStr(enumValue);
         }
 
       } // namespace DataSetTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SupportDataSetTypeMapper
       {
 
-        static const int customer_support_contacts_data_HASH = HashingUtils::HashString("customer_support_contacts_data");
-        static const int test_customer_support_contacts_data_HASH = HashingUtils::HashString("test_customer_support_contacts_data");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "customer_support_contacts_data",
+          "test_customer_support_contacts_data",
+        };
 
         SupportDataSetType GetSupportDataSetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == customer_support_contacts_data_HASH)
-          {
-            return SupportDataSetType::customer_support_contacts_data;
-          }
-          else if (hashCode == test_customer_support_contacts_data_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SupportDataSetType::test_customer_support_contacts_data;
+          case -1834555899:
+            if (name == "customer_support_contacts_data")
+            {
+              return SupportDataSetType::customer_support_contacts_data;
+            }
+            break;
+          case 1250877266:
+            if (name == "test_customer_support_contacts_data")
+            {
+              return SupportDataSetType::test_customer_support_contacts_data;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SupportDataSetType::NOT_SET;
         }
 
-        Aws::String GetNameForSupportDataSetType(SupportDataSetType enumValue)
+        const char* GetNameForSupportDataSetTypeCStr(SupportDataSetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SupportDataSetType::customer_support_contacts_data:
-            return "customer_support_contacts_data";
-          case SupportDataSetType::test_customer_support_contacts_data:
-            return "test_customer_support_contacts_data";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSupportDataSetType(SupportDataSetType enumValue)
+        {
+          return GetNameForSupportDataSetTypeCStr(enumValue);
         }
 
       } // namespace SupportDataSetTypeMapper
@@ -36,6 +36,11 @@ namespace AlgorithmMapper
 AWS_MEDIACONNECT_API Algorithm GetAlgorithmForName(const Aws::String& name);
 
 AWS_MEDIACONNECT_API Aws::String GetNameForAlgorithm(Algorithm value);
+
+/**
+ * Same as GetNameForAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONNECT_API const char* GetNameForAlgorithmCStr(Algorithm value);
 } // namespace AlgorithmMapper
 } // namespace Model
 } // namespace MediaConnect
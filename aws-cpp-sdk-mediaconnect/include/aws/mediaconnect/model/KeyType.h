@@ -34,6 +34,11 @@ namespace KeyTypeMapper
 AWS_MEDIACONNECT_API KeyType GetKeyTypeForName(const Aws::String& name);
 
 AWS_MEDIACONNECT_API Aws::String GetNameForKeyType(KeyType value);
+
+/**
+ * Same as GetNameForKeyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONNECT_API const char* GetNameForKeyTypeCStr(KeyType value);
 } // namespace KeyTypeMapper
 } // namespace Model
 } // namespace MediaConnect
@@ -36,6 +36,11 @@ namespace ProtocolMapper
 AWS_MEDIACONNECT_API Protocol GetProtocolForName(const Aws::String& name);
 
 AWS_MEDIACONNECT_API Aws::String GetNameForProtocol(Protocol value);
+
+/**
+ * Same as GetNameForProtocol(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONNECT_API const char* GetNameForProtocolCStr(Protocol value);
 } // namespace ProtocolMapper
 } // namespace Model
 } // namespace MediaConnect
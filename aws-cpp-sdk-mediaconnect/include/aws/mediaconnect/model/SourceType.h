@@ -35,6 +35,11 @@ namespace SourceTypeMapper
 AWS_MEDIACONNECT_API SourceType GetSourceTypeForName(const Aws::String& name);
 
 AWS_MEDIACONNECT_API Aws::String GetNameForSourceType(SourceType value);
+
+/**
+ * Same as GetNameForSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONNECT_API const char* GetNameForSourceTypeCStr(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace MediaConnect
@@ -40,6 +40,11 @@ namespace StatusMapper
 AWS_MEDIACONNECT_API Status GetStatusForName(const Aws::String& name);
 
 AWS_MEDIACONNECT_API Aws::String GetNameForStatus(Status value);
+
+/**
+ * Same as GetNameForStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONNECT_API const char* GetNameForStatusCStr(Status value);
 } // namespace StatusMapper
 } // namespace Model
 } // namespace MediaConnect
@@ -30,25 +30,44 @@ namespace Aws
       namespace AlgorithmMapper
       {
 
-        static const int aes128_HASH = HashingUtils::HashString("aes128");
-        static const int aes192_HASH = HashingUtils::HashString("aes192");
-        static const int aes256_HASH = HashingUtils::HashString("aes256");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "aes128",
+          "aes192",
+          "aes256",
+        };
 
         Algorithm GetAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aes128_HASH)
-          {
-            return Algorithm::aes128;
-          }
-          else if (hashCode == aes192_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Algorithm::aes192;
-          }
-          else if (hashCode == aes256_HASH)
-          {
-            return Algorithm::aes256;
+          case -1421189368:
+            if (name == "aes128")
+            {
+              return Algorithm::aes128;
+            }
+            break;
+          case -1421189157:
+            if (name == "aes192")
+            {
+              return Algorithm::aes192;
+            }
+            break;
+          case -1421188316:
+            if (name == "aes256")
+            {
+              return Algorithm::aes256;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Algorithm::NOT_SET;
         }
 
-        Aws::String GetNameForAlgorithm(Algorithm enumValue)
+        const char* GetNameForAlgorithmCStr(Algorithm enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Algorithm::aes128:
-            return "aes128";
-          case Algorithm::aes192:
-            return "aes192";
-          case Algorithm::aes256:
-            return "aes256";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAlgorithm(Algorithm enumValue)
+        {
+          return GetNameForAlgorithmCStr(enumValue);
         }
 
       } // namespace AlgorithmMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ProtocolMapper
       {
 
-        static const int zixi_push_HASH = HashingUtils::HashString("zixi-push");
-        static const int rtp_fec_HASH = HashingUtils::HashString("rtp-fec");
-        static const int rtp_HASH = HashingUtils::HashString("rtp");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "zixi-push",
+          "rtp-fec",
+          "rtp",
+        };
 
         Protocol GetProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == zixi_push_HASH)
-          {
-            return Protocol::zixi_push;
-          }
-          else if (hashCode == rtp_fec_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Protocol::rtp_fec;
-          }
-          else if (hashCode == rtp_HASH)
-          {
-            return Protocol::rtp;
+          case -977289625:
+            if (name == "zixi-push")
+            {
+              return Protocol::zixi_push;
+            }
+            break;
+          case 1522062245:
+            if (name == "rtp-fec")
+            {
+              return Protocol::rtp_fec;
+            }
+            break;
+          case 113262:
+            if (name == "rtp")
+            {
+              return Protocol::rtp;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Protocol::NOT_SET;
         }
 
-        Aws::String GetNameForProtocol(Protocol enumValue)
+        const char* GetNameForProtocolCStr(Protocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Protocol::zixi_push:
-            return "zixi-push";
-          case Protocol::rtp_fec:
-            return "rtp-fec";
-          case Protocol::rtp:
-            return "rtp";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProtocol(Protocol enumValue)
+        {
+          return GetNameForProtocolCStr(enumValue);
         }
 
       } // namespace ProtocolMapper
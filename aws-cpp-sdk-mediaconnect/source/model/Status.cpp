@@ -30,45 +30,72 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int STANDBY_HASH = HashingUtils::HashString("STANDBY");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STANDBY",
+          "ACTIVE",
+          "UPDATING",
+          "DELETING",
+          "STARTING",
+          "STOPPING",
+          "ERROR",
+        };
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDBY_HASH)
-          {
-            return Status::STANDBY;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return Status::ACTIVE;
-          }
-          else if (hashCode == UPDATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Status::UPDATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return Status::DELETING;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return Status::STARTING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return Status::STOPPING;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return Status::ERROR_;
+          case -1179337075:
+            if (name == "STANDBY")
+            {
+              return Status::STANDBY;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return Status::ACTIVE;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return Status::UPDATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return Status::DELETING;
+            }
+            break;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return Status::STARTING;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return Status::STOPPING;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return Status::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return Status::NOT_SET;
         }
 
-        Aws::String GetNameForStatus(Status enumValue)
+        const char* GetNameForStatusCStr(Status enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Status::STANDBY:
-            return "STANDBY";
-          case Status::ACTIVE:
-            return "ACTIVE";
-          case Status::UPDATING:
-            return "UPDATING";
-          case Status::DELETING:
-            return "DELETING";
-          case Status::STARTING:
-            return "STARTING";
-          case Status::STOPPING:
-            return "STOPPING";
-          case Status::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatus(Status enumValue)
+        {
+          return GetNameForStatusCStr(enumValue);
         }
 
       } // namespace StatusMapper
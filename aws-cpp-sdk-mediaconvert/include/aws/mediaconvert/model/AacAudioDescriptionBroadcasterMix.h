@@ -35,6 +35,11 @@ namespace AacAudioDescriptionBroadcasterMixMapper
 AWS_MEDIACONVERT_API AacAudioDescriptionBroadcasterMix GetAacAudioDescriptionBroadcasterMixForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAacAudioDescriptionBroadcasterMix(AacAudioDescriptionBroadcasterMix value);
+
+/**
+ * Same as GetNameForAacAudioDescriptionBroadcasterMix(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAacAudioDescriptionBroadcasterMixCStr(AacAudioDescriptionBroadcasterMix value);
 } // namespace AacAudioDescriptionBroadcasterMixMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace AacCodecProfileMapper
 AWS_MEDIACONVERT_API AacCodecProfile GetAacCodecProfileForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAacCodecProfile(AacCodecProfile value);
+
+/**
+ * Same as GetNameForAacCodecProfile(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAacCodecProfileCStr(AacCodecProfile value);
 } // namespace AacCodecProfileMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -38,6 +38,11 @@ namespace AacCodingModeMapper
 AWS_MEDIACONVERT_API AacCodingMode GetAacCodingModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAacCodingMode(AacCodingMode value);
+
+/**
+ * Same as GetNameForAacCodingMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAacCodingModeCStr(AacCodingMode value);
 } // namespace AacCodingModeMapper
 } // namespace Model
 } // namespace MediaConvert
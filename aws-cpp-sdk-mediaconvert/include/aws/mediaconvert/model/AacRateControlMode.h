@@ -35,6 +35,11 @@ namespace AacRateControlModeMapper
 AWS_MEDIACONVERT_API AacRateControlMode GetAacRateControlModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAacRateControlMode(AacRateControlMode value);
+
+/**
+ * Same as GetNameForAacRateControlMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAacRateControlModeCStr(AacRateControlMode value);
 } // namespace AacRateControlModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace AacSpecificationMapper
 AWS_MEDIACONVERT_API AacSpecification GetAacSpecificationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAacSpecification(AacSpecification value);
+
+/**
+ * Same as GetNameForAacSpecification(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAacSpecificationCStr(AacSpecification value);
 } // namespace AacSpecificationMapper
 } // namespace Model
 } // namespace MediaConvert
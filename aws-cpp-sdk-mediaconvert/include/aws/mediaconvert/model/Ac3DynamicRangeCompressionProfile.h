@@ -35,6 +35,11 @@ namespace Ac3DynamicRangeCompressionProfileMapper
 AWS_MEDIACONVERT_API Ac3DynamicRangeCompressionProfile GetAc3DynamicRangeCompressionProfileForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAc3DynamicRangeCompressionProfile(Ac3DynamicRangeCompressionProfile value);
+
+/**
+ * Same as GetNameForAc3DynamicRangeCompressionProfile(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAc3DynamicRangeCompressionProfileCStr(Ac3DynamicRangeCompressionProfile value);
 } // namespace Ac3DynamicRangeCompressionProfileMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace Ac3MetadataControlMapper
 AWS_MEDIACONVERT_API Ac3MetadataControl GetAc3MetadataControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAc3MetadataControl(Ac3MetadataControl value);
+
+/**
+ * Same as GetNameForAc3MetadataControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAc3MetadataControlCStr(Ac3MetadataControl value);
 } // namespace Ac3MetadataControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace AfdSignalingMapper
 AWS_MEDIACONVERT_API AfdSignaling GetAfdSignalingForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAfdSignaling(AfdSignaling value);
+
+/**
+ * Same as GetNameForAfdSignaling(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAfdSignalingCStr(AfdSignaling value);
 } // namespace AfdSignalingMapper
 } // namespace Model
 } // namespace MediaConvert
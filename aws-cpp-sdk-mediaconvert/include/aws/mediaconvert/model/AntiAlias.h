@@ -35,6 +35,11 @@ namespace AntiAliasMapper
 AWS_MEDIACONVERT_API AntiAlias GetAntiAliasForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAntiAlias(AntiAlias value);
+
+/**
+ * Same as GetNameForAntiAlias(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAntiAliasCStr(AntiAlias value);
 } // namespace AntiAliasMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -40,6 +40,11 @@ namespace AudioCodecMapper
 AWS_MEDIACONVERT_API AudioCodec GetAudioCodecForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAudioCodec(AudioCodec value);
+
+/**
+ * Same as GetNameForAudioCodec(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAudioCodecCStr(AudioCodec value);
 } // namespace AudioCodecMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace AudioDefaultSelectionMapper
 AWS_MEDIACONVERT_API AudioDefaultSelection GetAudioDefaultSelectionForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAudioDefaultSelection(AudioDefaultSelection value);
+
+/**
+ * Same as GetNameForAudioDefaultSelection(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAudioDefaultSelectionCStr(AudioDefaultSelection value);
 } // namespace AudioDefaultSelectionMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace AudioLanguageCodeControlMapper
 AWS_MEDIACONVERT_API AudioLanguageCodeControl GetAudioLanguageCodeControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAudioLanguageCodeControl(AudioLanguageCodeControl value);
+
+/**
+ * Same as GetNameForAudioLanguageCodeControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAudioLanguageCodeControlCStr(AudioLanguageCodeControl value);
 } // namespace AudioLanguageCodeControlMapper
 } // namespace Model
 } // namespace MediaConvert
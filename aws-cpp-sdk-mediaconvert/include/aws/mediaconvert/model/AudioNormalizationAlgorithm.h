@@ -35,6 +35,11 @@ namespace AudioNormalizationAlgorithmMapper
 AWS_MEDIACONVERT_API AudioNormalizationAlgorithm GetAudioNormalizationAlgorithmForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAudioNormalizationAlgorithm(AudioNormalizationAlgorithm value);
+
+/**
+ * Same as GetNameForAudioNormalizationAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAudioNormalizationAlgorithmCStr(AudioNormalizationAlgorithm value);
 } // namespace AudioNormalizationAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace AudioNormalizationLoudnessLoggingMapper
 AWS_MEDIACONVERT_API AudioNormalizationLoudnessLogging GetAudioNormalizationLoudnessLoggingForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAudioNormalizationLoudnessLogging(AudioNormalizationLoudnessLogging value);
+
+/**
+ * Same as GetNameForAudioNormalizationLoudnessLogging(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAudioNormalizationLoudnessLoggingCStr(AudioNormalizationLoudnessLogging value);
 } // namespace AudioNormalizationLoudnessLoggingMapper
 } // namespace Model
 } // namespace MediaConvert
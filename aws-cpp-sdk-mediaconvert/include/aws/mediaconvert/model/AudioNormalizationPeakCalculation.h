@@ -35,6 +35,11 @@ namespace AudioNormalizationPeakCalculationMapper
 AWS_MEDIACONVERT_API AudioNormalizationPeakCalculation GetAudioNormalizationPeakCalculationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAudioNormalizationPeakCalculation(AudioNormalizationPeakCalculation value);
+
+/**
+ * Same as GetNameForAudioNormalizationPeakCalculation(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAudioNormalizationPeakCalculationCStr(AudioNormalizationPeakCalculation value);
 } // namespace AudioNormalizationPeakCalculationMapper
 } // namespace Model
 } // namespace MediaConvert
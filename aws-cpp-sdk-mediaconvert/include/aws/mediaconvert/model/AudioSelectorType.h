@@ -36,6 +36,11 @@ namespace AudioSelectorTypeMapper
 AWS_MEDIACONVERT_API AudioSelectorType GetAudioSelectorTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAudioSelectorType(AudioSelectorType value);
+
+/**
+ * Same as GetNameForAudioSelectorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAudioSelectorTypeCStr(AudioSelectorType value);
 } // namespace AudioSelectorTypeMapper
 } // namespace Model
 } // namespace MediaConvert
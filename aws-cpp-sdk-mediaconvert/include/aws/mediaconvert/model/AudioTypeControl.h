@@ -35,6 +35,11 @@ namespace AudioTypeControlMapper
 AWS_MEDIACONVERT_API AudioTypeControl GetAudioTypeControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForAudioTypeControl(AudioTypeControl value);
+
+/**
+ * Same as GetNameForAudioTypeControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForAudioTypeControlCStr(AudioTypeControl value);
 } // namespace AudioTypeControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace BillingTagsSourceMapper
 AWS_MEDIACONVERT_API BillingTagsSource GetBillingTagsSourceForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForBillingTagsSource(BillingTagsSource value);
+
+/**
+ * Same as GetNameForBillingTagsSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForBillingTagsSourceCStr(BillingTagsSource value);
 } // namespace BillingTagsSourceMapper
 } // namespace Model
 } // namespace MediaConvert
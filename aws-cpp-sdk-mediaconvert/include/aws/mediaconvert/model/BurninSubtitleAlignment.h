@@ -35,6 +35,11 @@ namespace BurninSubtitleAlignmentMapper
 AWS_MEDIACONVERT_API BurninSubtitleAlignment GetBurninSubtitleAlignmentForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleAlignment(BurninSubtitleAlignment value);
+
+/**
+ * Same as GetNameForBurninSubtitleAlignment(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleAlignmentCStr(BurninSubtitleAlignment value);
 } // namespace BurninSubtitleAlignmentMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace BurninSubtitleBackgroundColorMapper
 AWS_MEDIACONVERT_API BurninSubtitleBackgroundColor GetBurninSubtitleBackgroundColorForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleBackgroundColor(BurninSubtitleBackgroundColor value);
+
+/**
+ * Same as GetNameForBurninSubtitleBackgroundColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleBackgroundColorCStr(BurninSubtitleBackgroundColor value);
 } // namespace BurninSubtitleBackgroundColorMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -39,6 +39,11 @@ namespace BurninSubtitleFontColorMapper
 AWS_MEDIACONVERT_API BurninSubtitleFontColor GetBurninSubtitleFontColorForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleFontColor(BurninSubtitleFontColor value);
+
+/**
+ * Same as GetNameForBurninSubtitleFontColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleFontColorCStr(BurninSubtitleFontColor value);
 } // namespace BurninSubtitleFontColorMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -39,6 +39,11 @@ namespace BurninSubtitleOutlineColorMapper
 AWS_MEDIACONVERT_API BurninSubtitleOutlineColor GetBurninSubtitleOutlineColorForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleOutlineColor(BurninSubtitleOutlineColor value);
+
+/**
+ * Same as GetNameForBurninSubtitleOutlineColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleOutlineColorCStr(BurninSubtitleOutlineColor value);
 } // namespace BurninSubtitleOutlineColorMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace BurninSubtitleShadowColorMapper
 AWS_MEDIACONVERT_API BurninSubtitleShadowColor GetBurninSubtitleShadowColorForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleShadowColor(BurninSubtitleShadowColor value);
+
+/**
+ * Same as GetNameForBurninSubtitleShadowColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleShadowColorCStr(BurninSubtitleShadowColor value);
 } // namespace BurninSubtitleShadowColorMapper
 } // namespace Model
 } // namespace MediaConvert
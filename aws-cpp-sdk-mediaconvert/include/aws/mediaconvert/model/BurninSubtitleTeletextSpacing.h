@@ -35,6 +35,11 @@ namespace BurninSubtitleTeletextSpacingMapper
 AWS_MEDIACONVERT_API BurninSubtitleTeletextSpacing GetBurninSubtitleTeletextSpacingForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleTeletextSpacing(BurninSubtitleTeletextSpacing value);
+
+/**
+ * Same as GetNameForBurninSubtitleTeletextSpacing(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleTeletextSpacingCStr(BurninSubtitleTeletextSpacing value);
 } // namespace BurninSubtitleTeletextSpacingMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -44,6 +44,11 @@ namespace CaptionDestinationTypeMapper
 AWS_MEDIACONVERT_API CaptionDestinationType GetCaptionDestinationTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCaptionDestinationType(CaptionDestinationType value);
+
+/**
+ * Same as GetNameForCaptionDestinationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCaptionDestinationTypeCStr(CaptionDestinationType value);
 } // namespace CaptionDestinationTypeMapper
 } // namespace Model
 } // namespace MediaConvert
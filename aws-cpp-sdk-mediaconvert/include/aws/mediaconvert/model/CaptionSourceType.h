@@ -44,6 +44,11 @@ namespace CaptionSourceTypeMapper
 AWS_MEDIACONVERT_API CaptionSourceType GetCaptionSourceTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCaptionSourceType(CaptionSourceType value);
+
+/**
+ * Same as GetNameForCaptionSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCaptionSourceTypeCStr(CaptionSourceType value);
 } // namespace CaptionSourceTypeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace CmafClientCacheMapper
 AWS_MEDIACONVERT_API CmafClientCache GetCmafClientCacheForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCmafClientCache(CmafClientCache value);
+
+/**
+ * Same as GetNameForCmafClientCache(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCmafClientCacheCStr(CmafClientCache value);
 } // namespace CmafClientCacheMapper
 } // namespace Model
 } // namespace MediaConvert
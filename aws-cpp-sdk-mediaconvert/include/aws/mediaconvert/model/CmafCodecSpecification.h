@@ -35,6 +35,11 @@ namespace CmafCodecSpecificationMapper
 AWS_MEDIACONVERT_API CmafCodecSpecification GetCmafCodecSpecificationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCmafCodecSpecification(CmafCodecSpecification value);
+
+/**
+ * Same as GetNameForCmafCodecSpecification(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCmafCodecSpecificationCStr(CmafCodecSpecification value);
 } // namespace CmafCodecSpecificationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,6 +34,11 @@ namespace CmafEncryptionTypeMapper
 AWS_MEDIACONVERT_API CmafEncryptionType GetCmafEncryptionTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCmafEncryptionType(CmafEncryptionType value);
+
+/**
+ * Same as GetNameForCmafEncryptionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCmafEncryptionTypeCStr(CmafEncryptionType value);
 } // namespace CmafEncryptionTypeMapper
 } // namespace Model
 } // namespace MediaConvert
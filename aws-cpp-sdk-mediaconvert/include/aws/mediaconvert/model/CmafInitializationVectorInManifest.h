@@ -35,6 +35,11 @@ namespace CmafInitializationVectorInManifestMapper
 AWS_MEDIACONVERT_API CmafInitializationVectorInManifest GetCmafInitializationVectorInManifestForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCmafInitializationVectorInManifest(CmafInitializationVectorInManifest value);
+
+/**
+ * Same as GetNameForCmafInitializationVectorInManifest(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCmafInitializationVectorInManifestCStr(CmafInitializationVectorInManifest value);
 } // namespace CmafInitializationVectorInManifestMapper
 } // namespace Model
 } // namespace MediaConvert
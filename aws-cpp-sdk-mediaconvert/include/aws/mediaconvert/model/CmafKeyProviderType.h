@@ -34,6 +34,11 @@ namespace CmafKeyProviderTypeMapper
 AWS_MEDIACONVERT_API CmafKeyProviderType GetCmafKeyProviderTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCmafKeyProviderType(CmafKeyProviderType value);
+
+/**
+ * Same as GetNameForCmafKeyProviderType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCmafKeyProviderTypeCStr(CmafKeyProviderType value);
 } // namespace CmafKeyProviderTypeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace CmafManifestCompressionMapper
 AWS_MEDIACONVERT_API CmafManifestCompression GetCmafManifestCompressionForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCmafManifestCompression(CmafManifestCompression value);
+
+/**
+ * Same as GetNameForCmafManifestCompression(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCmafManifestCompressionCStr(CmafManifestCompression value);
 } // namespace CmafManifestCompressionMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace CmafManifestDurationFormatMapper
 AWS_MEDIACONVERT_API CmafManifestDurationFormat GetCmafManifestDurationFormatForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCmafManifestDurationFormat(CmafManifestDurationFormat value);
+
+/**
+ * Same as GetNameForCmafManifestDurationFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCmafManifestDurationFormatCStr(CmafManifestDurationFormat value);
 } // namespace CmafManifestDurationFormatMapper
 } // namespace Model
 } // namespace MediaConvert
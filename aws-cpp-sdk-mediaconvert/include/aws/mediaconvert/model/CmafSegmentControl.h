@@ -35,6 +35,11 @@ namespace CmafSegmentControlMapper
 AWS_MEDIACONVERT_API CmafSegmentControl GetCmafSegmentControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCmafSegmentControl(CmafSegmentControl value);
+
+/**
+ * Same as GetNameForCmafSegmentControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCmafSegmentControlCStr(CmafSegmentControl value);
 } // namespace CmafSegmentControlMapper
 } // namespace Model
 } // namespace MediaConvert
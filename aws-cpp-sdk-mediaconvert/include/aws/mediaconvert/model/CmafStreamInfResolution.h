@@ -35,6 +35,11 @@ namespace CmafStreamInfResolutionMapper
 AWS_MEDIACONVERT_API CmafStreamInfResolution GetCmafStreamInfResolutionForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCmafStreamInfResolution(CmafStreamInfResolution value);
+
+/**
+ * Same as GetNameForCmafStreamInfResolution(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCmafStreamInfResolutionCStr(CmafStreamInfResolution value);
 } // namespace CmafStreamInfResolutionMapper
 } // namespace Model
 } // namespace MediaConvert
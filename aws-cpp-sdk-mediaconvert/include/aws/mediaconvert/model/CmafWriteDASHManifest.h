@@ -35,6 +35,11 @@ namespace CmafWriteDASHManifestMapper
 AWS_MEDIACONVERT_API CmafWriteDASHManifest GetCmafWriteDASHManifestForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCmafWriteDASHManifest(CmafWriteDASHManifest value);
+
+/**
+ * Same as GetNameForCmafWriteDASHManifest(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCmafWriteDASHManifestCStr(CmafWriteDASHManifest value);
 } // namespace CmafWriteDASHManifestMapper
 } // namespace Model
 } // namespace MediaConvert
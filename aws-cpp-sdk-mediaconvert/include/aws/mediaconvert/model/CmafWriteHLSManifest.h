@@ -35,6 +35,11 @@ namespace CmafWriteHLSManifestMapper
 AWS_MEDIACONVERT_API CmafWriteHLSManifest GetCmafWriteHLSManifestForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCmafWriteHLSManifest(CmafWriteHLSManifest value);
+
+/**
+ * Same as GetNameForCmafWriteHLSManifest(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCmafWriteHLSManifestCStr(CmafWriteHLSManifest value);
 } // namespace CmafWriteHLSManifestMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace ColorMetadataMapper
 AWS_MEDIACONVERT_API ColorMetadata GetColorMetadataForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForColorMetadata(ColorMetadata value);
+
+/**
+ * Same as GetNameForColorMetadata(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForColorMetadataCStr(ColorMetadata value);
 } // namespace ColorMetadataMapper
 } // namespace Model
 } // namespace MediaConvert
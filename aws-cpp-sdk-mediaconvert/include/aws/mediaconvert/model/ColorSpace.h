@@ -38,6 +38,11 @@ namespace ColorSpaceMapper
 AWS_MEDIACONVERT_API ColorSpace GetColorSpaceForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForColorSpace(ColorSpace value);
+
+/**
+ * Same as GetNameForColorSpace(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForColorSpaceCStr(ColorSpace value);
 } // namespace ColorSpaceMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -38,6 +38,11 @@ namespace ColorSpaceConversionMapper
 AWS_MEDIACONVERT_API ColorSpaceConversion GetColorSpaceConversionForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForColorSpaceConversion(ColorSpaceConversion value);
+
+/**
+ * Same as GetNameForColorSpaceConversion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForColorSpaceConversionCStr(ColorSpaceConversion value);
 } // namespace ColorSpaceConversionMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace ColorSpaceUsageMapper
 AWS_MEDIACONVERT_API ColorSpaceUsage GetColorSpaceUsageForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForColorSpaceUsage(ColorSpaceUsage value);
+
+/**
+ * Same as GetNameForColorSpaceUsage(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForColorSpaceUsageCStr(ColorSpaceUsage value);
 } // namespace ColorSpaceUsageMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,6 +34,11 @@ namespace CommitmentMapper
 AWS_MEDIACONVERT_API Commitment GetCommitmentForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForCommitment(Commitment value);
+
+/**
+ * Same as GetNameForCommitment(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForCommitmentCStr(Commitment value);
 } // namespace CommitmentMapper
 } // namespace Model
 } // namespace MediaConvert
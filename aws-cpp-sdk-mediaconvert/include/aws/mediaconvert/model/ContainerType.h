@@ -43,6 +43,11 @@ namespace ContainerTypeMapper
 AWS_MEDIACONVERT_API ContainerType GetContainerTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForContainerType(ContainerType value);
+
+/**
+ * Same as GetNameForContainerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForContainerTypeCStr(ContainerType value);
 } // namespace ContainerTypeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace DashIsoHbbtvComplianceMapper
 AWS_MEDIACONVERT_API DashIsoHbbtvCompliance GetDashIsoHbbtvComplianceForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDashIsoHbbtvCompliance(DashIsoHbbtvCompliance value);
+
+/**
+ * Same as GetNameForDashIsoHbbtvCompliance(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDashIsoHbbtvComplianceCStr(DashIsoHbbtvCompliance value);
 } // namespace DashIsoHbbtvComplianceMapper
 } // namespace Model
 } // namespace MediaConvert
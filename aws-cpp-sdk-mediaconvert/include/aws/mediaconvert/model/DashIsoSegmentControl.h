@@ -35,6 +35,11 @@ namespace DashIsoSegmentControlMapper
 AWS_MEDIACONVERT_API DashIsoSegmentControl GetDashIsoSegmentControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDashIsoSegmentControl(DashIsoSegmentControl value);
+
+/**
+ * Same as GetNameForDashIsoSegmentControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDashIsoSegmentControlCStr(DashIsoSegmentControl value);
 } // namespace DashIsoSegmentControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace DashIsoWriteSegmentTimelineInRepresentationMapper
 AWS_MEDIACONVERT_API DashIsoWriteSegmentTimelineInRepresentation GetDashIsoWriteSegmentTimelineInRepresentationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDashIsoWriteSegmentTimelineInRepresentation(DashIsoWriteSegmentTimelineInRepresentation value);
+
+/**
+ * Same as GetNameForDashIsoWriteSegmentTimelineInRepresentation(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDashIsoWriteSegmentTimelineInRepresentationCStr(DashIsoWriteSegmentTimelineInRepresentation value);
 } // namespace DashIsoWriteSegmentTimelineInRepresentationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace DecryptionModeMapper
 AWS_MEDIACONVERT_API DecryptionMode GetDecryptionModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDecryptionMode(DecryptionMode value);
+
+/**
+ * Same as GetNameForDecryptionMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDecryptionModeCStr(DecryptionMode value);
 } // namespace DecryptionModeMapper
 } // namespace Model
 } // namespace MediaConvert
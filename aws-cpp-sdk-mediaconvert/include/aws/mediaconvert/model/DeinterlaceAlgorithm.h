@@ -37,6 +37,11 @@ namespace DeinterlaceAlgorithmMapper
 AWS_MEDIACONVERT_API DeinterlaceAlgorithm GetDeinterlaceAlgorithmForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDeinterlaceAlgorithm(DeinterlaceAlgorithm value);
+
+/**
+ * Same as GetNameForDeinterlaceAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDeinterlaceAlgorithmCStr(DeinterlaceAlgorithm value);
 } // namespace DeinterlaceAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
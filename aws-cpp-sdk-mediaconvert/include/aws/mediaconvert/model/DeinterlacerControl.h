@@ -35,6 +35,11 @@ namespace DeinterlacerControlMapper
 AWS_MEDIACONVERT_API DeinterlacerControl GetDeinterlacerControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDeinterlacerControl(DeinterlacerControl value);
+
+/**
+ * Same as GetNameForDeinterlacerControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDeinterlacerControlCStr(DeinterlacerControl value);
 } // namespace DeinterlacerControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace DeinterlacerModeMapper
 AWS_MEDIACONVERT_API DeinterlacerMode GetDeinterlacerModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDeinterlacerMode(DeinterlacerMode value);
+
+/**
+ * Same as GetNameForDeinterlacerMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDeinterlacerModeCStr(DeinterlacerMode value);
 } // namespace DeinterlacerModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace DescribeEndpointsModeMapper
 AWS_MEDIACONVERT_API DescribeEndpointsMode GetDescribeEndpointsModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDescribeEndpointsMode(DescribeEndpointsMode value);
+
+/**
+ * Same as GetNameForDescribeEndpointsMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDescribeEndpointsModeCStr(DescribeEndpointsMode value);
 } // namespace DescribeEndpointsModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace DropFrameTimecodeMapper
 AWS_MEDIACONVERT_API DropFrameTimecode GetDropFrameTimecodeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDropFrameTimecode(DropFrameTimecode value);
+
+/**
+ * Same as GetNameForDropFrameTimecode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDropFrameTimecodeCStr(DropFrameTimecode value);
 } // namespace DropFrameTimecodeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace DvbSubtitleAlignmentMapper
 AWS_MEDIACONVERT_API DvbSubtitleAlignment GetDvbSubtitleAlignmentForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleAlignment(DvbSubtitleAlignment value);
+
+/**
+ * Same as GetNameForDvbSubtitleAlignment(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleAlignmentCStr(DvbSubtitleAlignment value);
 } // namespace DvbSubtitleAlignmentMapper
 } // namespace Model
 } // namespace MediaConvert
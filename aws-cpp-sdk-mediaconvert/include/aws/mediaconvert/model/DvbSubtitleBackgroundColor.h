@@ -36,6 +36,11 @@ namespace DvbSubtitleBackgroundColorMapper
 AWS_MEDIACONVERT_API DvbSubtitleBackgroundColor GetDvbSubtitleBackgroundColorForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleBackgroundColor(DvbSubtitleBackgroundColor value);
+
+/**
+ * Same as GetNameForDvbSubtitleBackgroundColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleBackgroundColorCStr(DvbSubtitleBackgroundColor value);
 } // namespace DvbSubtitleBackgroundColorMapper
 } // namespace Model
 } // namespace MediaConvert
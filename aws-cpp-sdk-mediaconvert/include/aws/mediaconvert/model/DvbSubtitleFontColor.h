@@ -39,6 +39,11 @@ namespace DvbSubtitleFontColorMapper
 AWS_MEDIACONVERT_API DvbSubtitleFontColor GetDvbSubtitleFontColorForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleFontColor(DvbSubtitleFontColor value);
+
+/**
+ * Same as GetNameForDvbSubtitleFontColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleFontColorCStr(DvbSubtitleFontColor value);
 } // namespace DvbSubtitleFontColorMapper
 } // namespace Model
 } // namespace MediaConvert
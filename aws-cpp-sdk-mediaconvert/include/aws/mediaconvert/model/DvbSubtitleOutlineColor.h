@@ -39,6 +39,11 @@ namespace DvbSubtitleOutlineColorMapper
 AWS_MEDIACONVERT_API DvbSubtitleOutlineColor GetDvbSubtitleOutlineColorForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleOutlineColor(DvbSubtitleOutlineColor value);
+
+/**
+ * Same as GetNameForDvbSubtitleOutlineColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleOutlineColorCStr(DvbSubtitleOutlineColor value);
 } // namespace DvbSubtitleOutlineColorMapper
 } // namespace Model
 } // namespace MediaConvert
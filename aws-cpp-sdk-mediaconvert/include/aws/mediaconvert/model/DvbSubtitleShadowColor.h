@@ -36,6 +36,11 @@ namespace DvbSubtitleShadowColorMapper
 AWS_MEDIACONVERT_API DvbSubtitleShadowColor GetDvbSubtitleShadowColorForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleShadowColor(DvbSubtitleShadowColor value);
+
+/**
+ * Same as GetNameForDvbSubtitleShadowColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleShadowColorCStr(DvbSubtitleShadowColor value);
 } // namespace DvbSubtitleShadowColorMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace DvbSubtitleTeletextSpacingMapper
 AWS_MEDIACONVERT_API DvbSubtitleTeletextSpacing GetDvbSubtitleTeletextSpacingForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleTeletextSpacing(DvbSubtitleTeletextSpacing value);
+
+/**
+ * Same as GetNameForDvbSubtitleTeletextSpacing(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleTeletextSpacingCStr(DvbSubtitleTeletextSpacing value);
 } // namespace DvbSubtitleTeletextSpacingMapper
 } // namespace Model
 } // namespace MediaConvert
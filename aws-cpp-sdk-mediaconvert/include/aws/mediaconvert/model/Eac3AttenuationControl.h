@@ -35,6 +35,11 @@ namespace Eac3AttenuationControlMapper
 AWS_MEDIACONVERT_API Eac3AttenuationControl GetEac3AttenuationControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForEac3AttenuationControl(Eac3AttenuationControl value);
+
+/**
+ * Same as GetNameForEac3AttenuationControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForEac3AttenuationControlCStr(Eac3AttenuationControl value);
 } // namespace Eac3AttenuationControlMapper
 } // namespace Model
 } // namespace MediaConvert
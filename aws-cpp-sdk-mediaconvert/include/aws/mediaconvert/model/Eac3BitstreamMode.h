@@ -38,6 +38,11 @@ namespace Eac3BitstreamModeMapper
 AWS_MEDIACONVERT_API Eac3BitstreamMode GetEac3BitstreamModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForEac3BitstreamMode(Eac3BitstreamMode value);
+
+/**
+ * Same as GetNameForEac3BitstreamMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForEac3BitstreamModeCStr(Eac3BitstreamMode value);
 } // namespace Eac3BitstreamModeMapper
 } // namespace Model
 } // namespace MediaConvert
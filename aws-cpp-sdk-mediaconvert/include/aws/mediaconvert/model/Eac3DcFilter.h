@@ -35,6 +35,11 @@ namespace Eac3DcFilterMapper
 AWS_MEDIACONVERT_API Eac3DcFilter GetEac3DcFilterForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForEac3DcFilter(Eac3DcFilter value);
+
+/**
+ * Same as GetNameForEac3DcFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForEac3DcFilterCStr(Eac3DcFilter value);
 } // namespace Eac3DcFilterMapper
 } // namespace Model
 } // namespace MediaConvert
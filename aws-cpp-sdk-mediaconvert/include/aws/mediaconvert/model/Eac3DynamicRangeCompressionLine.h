@@ -39,6 +39,11 @@ namespace Eac3DynamicRangeCompressionLineMapper
 AWS_MEDIACONVERT_API Eac3DynamicRangeCompressionLine GetEac3DynamicRangeCompressionLineForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForEac3DynamicRangeCompressionLine(Eac3DynamicRangeCompressionLine value);
+
+/**
+ * Same as GetNameForEac3DynamicRangeCompressionLine(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForEac3DynamicRangeCompressionLineCStr(Eac3DynamicRangeCompressionLine value);
 } // namespace Eac3DynamicRangeCompressionLineMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -39,6 +39,11 @@ namespace Eac3DynamicRangeCompressionRfMapper
 AWS_MEDIACONVERT_API Eac3DynamicRangeCompressionRf GetEac3DynamicRangeCompressionRfForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForEac3DynamicRangeCompressionRf(Eac3DynamicRangeCompressionRf value);
+
+/**
+ * Same as GetNameForEac3DynamicRangeCompressionRf(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForEac3DynamicRangeCompressionRfCStr(Eac3DynamicRangeCompressionRf value);
 } // namespace Eac3DynamicRangeCompressionRfMapper
 } // namespace Model
 } // namespace MediaConvert
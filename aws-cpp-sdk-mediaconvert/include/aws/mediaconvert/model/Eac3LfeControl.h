@@ -35,6 +35,11 @@ namespace Eac3LfeControlMapper
 AWS_MEDIACONVERT_API Eac3LfeControl GetEac3LfeControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForEac3LfeControl(Eac3LfeControl value);
+
+/**
+ * Same as GetNameForEac3LfeControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForEac3LfeControlCStr(Eac3LfeControl value);
 } // namespace Eac3LfeControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace Eac3LfeFilterMapper
 AWS_MEDIACONVERT_API Eac3LfeFilter GetEac3LfeFilterForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForEac3LfeFilter(Eac3LfeFilter value);
+
+/**
+ * Same as GetNameForEac3LfeFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForEac3LfeFilterCStr(Eac3LfeFilter value);
 } // namespace Eac3LfeFilterMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace Eac3PassthroughControlMapper
 AWS_MEDIACONVERT_API Eac3PassthroughControl GetEac3PassthroughControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForEac3PassthroughControl(Eac3PassthroughControl value);
+
+/**
+ * Same as GetNameForEac3PassthroughControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForEac3PassthroughControlCStr(Eac3PassthroughControl value);
 } // namespace Eac3PassthroughControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace Eac3PhaseControlMapper
 AWS_MEDIACONVERT_API Eac3PhaseControl GetEac3PhaseControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForEac3PhaseControl(Eac3PhaseControl value);
+
+/**
+ * Same as GetNameForEac3PhaseControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForEac3PhaseControlCStr(Eac3PhaseControl value);
 } // namespace Eac3PhaseControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -37,6 +37,11 @@ namespace Eac3StereoDownmixMapper
 AWS_MEDIACONVERT_API Eac3StereoDownmix GetEac3StereoDownmixForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForEac3StereoDownmix(Eac3StereoDownmix value);
+
+/**
+ * Same as GetNameForEac3StereoDownmix(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForEac3StereoDownmixCStr(Eac3StereoDownmix value);
 } // namespace Eac3StereoDownmixMapper
 } // namespace Model
 } // namespace MediaConvert
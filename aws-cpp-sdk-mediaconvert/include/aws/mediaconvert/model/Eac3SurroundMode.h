@@ -36,6 +36,11 @@ namespace Eac3SurroundModeMapper
 AWS_MEDIACONVERT_API Eac3SurroundMode GetEac3SurroundModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForEac3SurroundMode(Eac3SurroundMode value);
+
+/**
+ * Same as GetNameForEac3SurroundMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForEac3SurroundModeCStr(Eac3SurroundMode value);
 } // namespace Eac3SurroundModeMapper
 } // namespace Model
 } // namespace MediaConvert
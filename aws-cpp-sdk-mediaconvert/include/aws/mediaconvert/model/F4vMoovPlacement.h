@@ -35,6 +35,11 @@ namespace F4vMoovPlacementMapper
 AWS_MEDIACONVERT_API F4vMoovPlacement GetF4vMoovPlacementForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForF4vMoovPlacement(F4vMoovPlacement value);
+
+/**
+ * Same as GetNameForF4vMoovPlacement(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForF4vMoovPlacementCStr(F4vMoovPlacement value);
 } // namespace F4vMoovPlacementMapper
 } // namespace Model
 } // namespace MediaConvert
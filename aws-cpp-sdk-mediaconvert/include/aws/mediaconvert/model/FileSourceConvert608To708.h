@@ -35,6 +35,11 @@ namespace FileSourceConvert608To708Mapper
 AWS_MEDIACONVERT_API FileSourceConvert608To708 GetFileSourceConvert608To708ForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForFileSourceConvert608To708(FileSourceConvert608To708 value);
+
+/**
+ * Same as GetNameForFileSourceConvert608To708(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForFileSourceConvert608To708CStr(FileSourceConvert608To708 value);
 } // namespace FileSourceConvert608To708Mapper
 } // namespace Model
 } // namespace MediaConvert
@@ -50,6 +50,11 @@ namespace H264CodecLevelMapper
 AWS_MEDIACONVERT_API H264CodecLevel GetH264CodecLevelForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264CodecLevel(H264CodecLevel value);
+
+/**
+ * Same as GetNameForH264CodecLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264CodecLevelCStr(H264CodecLevel value);
 } // namespace H264CodecLevelMapper
 } // namespace Model
 } // namespace MediaConvert
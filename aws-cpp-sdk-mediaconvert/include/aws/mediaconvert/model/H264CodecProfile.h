@@ -39,6 +39,11 @@ namespace H264CodecProfileMapper
 AWS_MEDIACONVERT_API H264CodecProfile GetH264CodecProfileForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264CodecProfile(H264CodecProfile value);
+
+/**
+ * Same as GetNameForH264CodecProfile(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264CodecProfileCStr(H264CodecProfile value);
 } // namespace H264CodecProfileMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H264DynamicSubGopMapper
 AWS_MEDIACONVERT_API H264DynamicSubGop GetH264DynamicSubGopForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264DynamicSubGop(H264DynamicSubGop value);
+
+/**
+ * Same as GetNameForH264DynamicSubGop(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264DynamicSubGopCStr(H264DynamicSubGop value);
 } // namespace H264DynamicSubGopMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H264FieldEncodingMapper
 AWS_MEDIACONVERT_API H264FieldEncoding GetH264FieldEncodingForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264FieldEncoding(H264FieldEncoding value);
+
+/**
+ * Same as GetNameForH264FieldEncoding(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264FieldEncodingCStr(H264FieldEncoding value);
 } // namespace H264FieldEncodingMapper
 } // namespace Model
 } // namespace MediaConvert
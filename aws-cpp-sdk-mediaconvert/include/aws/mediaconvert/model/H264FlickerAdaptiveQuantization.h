@@ -35,6 +35,11 @@ namespace H264FlickerAdaptiveQuantizationMapper
 AWS_MEDIACONVERT_API H264FlickerAdaptiveQuantization GetH264FlickerAdaptiveQuantizationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264FlickerAdaptiveQuantization(H264FlickerAdaptiveQuantization value);
+
+/**
+ * Same as GetNameForH264FlickerAdaptiveQuantization(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264FlickerAdaptiveQuantizationCStr(H264FlickerAdaptiveQuantization value);
 } // namespace H264FlickerAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
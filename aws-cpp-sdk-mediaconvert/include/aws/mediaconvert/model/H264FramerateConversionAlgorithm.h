@@ -35,6 +35,11 @@ namespace H264FramerateConversionAlgorithmMapper
 AWS_MEDIACONVERT_API H264FramerateConversionAlgorithm GetH264FramerateConversionAlgorithmForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264FramerateConversionAlgorithm(H264FramerateConversionAlgorithm value);
+
+/**
+ * Same as GetNameForH264FramerateConversionAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264FramerateConversionAlgorithmCStr(H264FramerateConversionAlgorithm value);
 } // namespace H264FramerateConversionAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
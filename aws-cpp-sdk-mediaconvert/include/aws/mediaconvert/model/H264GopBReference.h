@@ -35,6 +35,11 @@ namespace H264GopBReferenceMapper
 AWS_MEDIACONVERT_API H264GopBReference GetH264GopBReferenceForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264GopBReference(H264GopBReference value);
+
+/**
+ * Same as GetNameForH264GopBReference(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264GopBReferenceCStr(H264GopBReference value);
 } // namespace H264GopBReferenceMapper
 } // namespace Model
 } // namespace MediaConvert
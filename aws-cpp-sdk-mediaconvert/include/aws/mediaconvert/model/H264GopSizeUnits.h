@@ -35,6 +35,11 @@ namespace H264GopSizeUnitsMapper
 AWS_MEDIACONVERT_API H264GopSizeUnits GetH264GopSizeUnitsForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264GopSizeUnits(H264GopSizeUnits value);
+
+/**
+ * Same as GetNameForH264GopSizeUnits(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264GopSizeUnitsCStr(H264GopSizeUnits value);
 } // namespace H264GopSizeUnitsMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -38,6 +38,11 @@ namespace H264InterlaceModeMapper
 AWS_MEDIACONVERT_API H264InterlaceMode GetH264InterlaceModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264InterlaceMode(H264InterlaceMode value);
+
+/**
+ * Same as GetNameForH264InterlaceMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264InterlaceModeCStr(H264InterlaceMode value);
 } // namespace H264InterlaceModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H264ParControlMapper
 AWS_MEDIACONVERT_API H264ParControl GetH264ParControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264ParControl(H264ParControl value);
+
+/**
+ * Same as GetNameForH264ParControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264ParControlCStr(H264ParControl value);
 } // namespace H264ParControlMapper
 } // namespace Model
 } // namespace MediaConvert
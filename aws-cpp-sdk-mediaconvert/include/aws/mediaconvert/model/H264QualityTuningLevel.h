@@ -36,6 +36,11 @@ namespace H264QualityTuningLevelMapper
 AWS_MEDIACONVERT_API H264QualityTuningLevel GetH264QualityTuningLevelForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264QualityTuningLevel(H264QualityTuningLevel value);
+
+/**
+ * Same as GetNameForH264QualityTuningLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264QualityTuningLevelCStr(H264QualityTuningLevel value);
 } // namespace H264QualityTuningLevelMapper
 } // namespace Model
 } // namespace MediaConvert
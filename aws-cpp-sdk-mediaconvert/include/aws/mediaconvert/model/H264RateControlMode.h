@@ -36,6 +36,11 @@ namespace H264RateControlModeMapper
 AWS_MEDIACONVERT_API H264RateControlMode GetH264RateControlModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264RateControlMode(H264RateControlMode value);
+
+/**
+ * Same as GetNameForH264RateControlMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264RateControlModeCStr(H264RateControlMode value);
 } // namespace H264RateControlModeMapper
 } // namespace Model
 } // namespace MediaConvert
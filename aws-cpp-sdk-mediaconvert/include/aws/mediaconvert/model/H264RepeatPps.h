@@ -35,6 +35,11 @@ namespace H264RepeatPpsMapper
 AWS_MEDIACONVERT_API H264RepeatPps GetH264RepeatPpsForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264RepeatPps(H264RepeatPps value);
+
+/**
+ * Same as GetNameForH264RepeatPps(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264RepeatPpsCStr(H264RepeatPps value);
 } // namespace H264RepeatPpsMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H264SceneChangeDetectMapper
 AWS_MEDIACONVERT_API H264SceneChangeDetect GetH264SceneChangeDetectForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264SceneChangeDetect(H264SceneChangeDetect value);
+
+/**
+ * Same as GetNameForH264SceneChangeDetect(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264SceneChangeDetectCStr(H264SceneChangeDetect value);
 } // namespace H264SceneChangeDetectMapper
 } // namespace Model
 } // namespace MediaConvert
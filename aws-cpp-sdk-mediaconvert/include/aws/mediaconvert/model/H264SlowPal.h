@@ -35,6 +35,11 @@ namespace H264SlowPalMapper
 AWS_MEDIACONVERT_API H264SlowPal GetH264SlowPalForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264SlowPal(H264SlowPal value);
+
+/**
+ * Same as GetNameForH264SlowPal(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264SlowPalCStr(H264SlowPal value);
 } // namespace H264SlowPalMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H264SpatialAdaptiveQuantizationMapper
 AWS_MEDIACONVERT_API H264SpatialAdaptiveQuantization GetH264SpatialAdaptiveQuantizationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264SpatialAdaptiveQuantization(H264SpatialAdaptiveQuantization value);
+
+/**
+ * Same as GetNameForH264SpatialAdaptiveQuantization(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264SpatialAdaptiveQuantizationCStr(H264SpatialAdaptiveQuantization value);
 } // namespace H264SpatialAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H264SyntaxMapper
 AWS_MEDIACONVERT_API H264Syntax GetH264SyntaxForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264Syntax(H264Syntax value);
+
+/**
+ * Same as GetNameForH264Syntax(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264SyntaxCStr(H264Syntax value);
 } // namespace H264SyntaxMapper
 } // namespace Model
 } // namespace MediaConvert
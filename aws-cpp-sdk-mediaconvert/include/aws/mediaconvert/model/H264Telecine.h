@@ -36,6 +36,11 @@ namespace H264TelecineMapper
 AWS_MEDIACONVERT_API H264Telecine GetH264TelecineForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264Telecine(H264Telecine value);
+
+/**
+ * Same as GetNameForH264Telecine(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264TelecineCStr(H264Telecine value);
 } // namespace H264TelecineMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H264TemporalAdaptiveQuantizationMapper
 AWS_MEDIACONVERT_API H264TemporalAdaptiveQuantization GetH264TemporalAdaptiveQuantizationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264TemporalAdaptiveQuantization(H264TemporalAdaptiveQuantization value);
+
+/**
+ * Same as GetNameForH264TemporalAdaptiveQuantization(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264TemporalAdaptiveQuantizationCStr(H264TemporalAdaptiveQuantization value);
 } // namespace H264TemporalAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H264UnregisteredSeiTimecodeMapper
 AWS_MEDIACONVERT_API H264UnregisteredSeiTimecode GetH264UnregisteredSeiTimecodeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH264UnregisteredSeiTimecode(H264UnregisteredSeiTimecode value);
+
+/**
+ * Same as GetNameForH264UnregisteredSeiTimecode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH264UnregisteredSeiTimecodeCStr(H264UnregisteredSeiTimecode value);
 } // namespace H264UnregisteredSeiTimecodeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -39,6 +39,11 @@ namespace H265AdaptiveQuantizationMapper
 AWS_MEDIACONVERT_API H265AdaptiveQuantization GetH265AdaptiveQuantizationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265AdaptiveQuantization(H265AdaptiveQuantization value);
+
+/**
+ * Same as GetNameForH265AdaptiveQuantization(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265AdaptiveQuantizationCStr(H265AdaptiveQuantization value);
 } // namespace H265AdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H265AlternateTransferFunctionSeiMapper
 AWS_MEDIACONVERT_API H265AlternateTransferFunctionSei GetH265AlternateTransferFunctionSeiForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265AlternateTransferFunctionSei(H265AlternateTransferFunctionSei value);
+
+/**
+ * Same as GetNameForH265AlternateTransferFunctionSei(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265AlternateTransferFunctionSeiCStr(H265AlternateTransferFunctionSei value);
 } // namespace H265AlternateTransferFunctionSeiMapper
 } // namespace Model
 } // namespace MediaConvert
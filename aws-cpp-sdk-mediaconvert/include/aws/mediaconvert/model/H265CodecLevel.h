@@ -47,6 +47,11 @@ namespace H265CodecLevelMapper
 AWS_MEDIACONVERT_API H265CodecLevel GetH265CodecLevelForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265CodecLevel(H265CodecLevel value);
+
+/**
+ * Same as GetNameForH265CodecLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265CodecLevelCStr(H265CodecLevel value);
 } // namespace H265CodecLevelMapper
 } // namespace Model
 } // namespace MediaConvert
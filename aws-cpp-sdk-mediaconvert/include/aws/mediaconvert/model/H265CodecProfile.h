@@ -41,6 +41,11 @@ namespace H265CodecProfileMapper
 AWS_MEDIACONVERT_API H265CodecProfile GetH265CodecProfileForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265CodecProfile(H265CodecProfile value);
+
+/**
+ * Same as GetNameForH265CodecProfile(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265CodecProfileCStr(H265CodecProfile value);
 } // namespace H265CodecProfileMapper
 } // namespace Model
 } // namespace MediaConvert
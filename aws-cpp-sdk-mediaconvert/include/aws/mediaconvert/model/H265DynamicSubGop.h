@@ -35,6 +35,11 @@ namespace H265DynamicSubGopMapper
 AWS_MEDIACONVERT_API H265DynamicSubGop GetH265DynamicSubGopForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265DynamicSubGop(H265DynamicSubGop value);
+
+/**
+ * Same as GetNameForH265DynamicSubGop(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265DynamicSubGopCStr(H265DynamicSubGop value);
 } // namespace H265DynamicSubGopMapper
 } // namespace Model
 } // namespace MediaConvert
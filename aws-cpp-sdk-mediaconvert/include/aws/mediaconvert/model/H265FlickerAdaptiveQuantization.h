@@ -35,6 +35,11 @@ namespace H265FlickerAdaptiveQuantizationMapper
 AWS_MEDIACONVERT_API H265FlickerAdaptiveQuantization GetH265FlickerAdaptiveQuantizationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265FlickerAdaptiveQuantization(H265FlickerAdaptiveQuantization value);
+
+/**
+ * Same as GetNameForH265FlickerAdaptiveQuantization(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265FlickerAdaptiveQuantizationCStr(H265FlickerAdaptiveQuantization value);
 } // namespace H265FlickerAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H265FramerateControlMapper
 AWS_MEDIACONVERT_API H265FramerateControl GetH265FramerateControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265FramerateControl(H265FramerateControl value);
+
+/**
+ * Same as GetNameForH265FramerateControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265FramerateControlCStr(H265FramerateControl value);
 } // namespace H265FramerateControlMapper
 } // namespace Model
 } // namespace MediaConvert
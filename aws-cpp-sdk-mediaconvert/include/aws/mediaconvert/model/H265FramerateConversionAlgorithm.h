@@ -35,6 +35,11 @@ namespace H265FramerateConversionAlgorithmMapper
 AWS_MEDIACONVERT_API H265FramerateConversionAlgorithm GetH265FramerateConversionAlgorithmForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265FramerateConversionAlgorithm(H265FramerateConversionAlgorithm value);
+
+/**
+ * Same as GetNameForH265FramerateConversionAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265FramerateConversionAlgorithmCStr(H265FramerateConversionAlgorithm value);
 } // namespace H265FramerateConversionAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
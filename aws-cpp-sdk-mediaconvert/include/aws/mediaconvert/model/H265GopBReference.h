@@ -35,6 +35,11 @@ namespace H265GopBReferenceMapper
 AWS_MEDIACONVERT_API H265GopBReference GetH265GopBReferenceForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265GopBReference(H265GopBReference value);
+
+/**
+ * Same as GetNameForH265GopBReference(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265GopBReferenceCStr(H265GopBReference value);
 } // namespace H265GopBReferenceMapper
 } // namespace Model
 } // namespace MediaConvert
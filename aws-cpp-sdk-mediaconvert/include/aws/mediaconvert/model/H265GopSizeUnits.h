@@ -35,6 +35,11 @@ namespace H265GopSizeUnitsMapper
 AWS_MEDIACONVERT_API H265GopSizeUnits GetH265GopSizeUnitsForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265GopSizeUnits(H265GopSizeUnits value);
+
+/**
+ * Same as GetNameForH265GopSizeUnits(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265GopSizeUnitsCStr(H265GopSizeUnits value);
 } // namespace H265GopSizeUnitsMapper
 } // namespace Model
 } // namespace MediaConvert
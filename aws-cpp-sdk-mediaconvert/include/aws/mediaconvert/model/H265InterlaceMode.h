@@ -38,6 +38,11 @@ namespace H265InterlaceModeMapper
 AWS_MEDIACONVERT_API H265InterlaceMode GetH265InterlaceModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265InterlaceMode(H265InterlaceMode value);
+
+/**
+ * Same as GetNameForH265InterlaceMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265InterlaceModeCStr(H265InterlaceMode value);
 } // namespace H265InterlaceModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H265ParControlMapper
 AWS_MEDIACONVERT_API H265ParControl GetH265ParControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265ParControl(H265ParControl value);
+
+/**
+ * Same as GetNameForH265ParControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265ParControlCStr(H265ParControl value);
 } // namespace H265ParControlMapper
 } // namespace Model
 } // namespace MediaConvert
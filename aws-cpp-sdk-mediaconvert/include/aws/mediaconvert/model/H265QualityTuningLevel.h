@@ -36,6 +36,11 @@ namespace H265QualityTuningLevelMapper
 AWS_MEDIACONVERT_API H265QualityTuningLevel GetH265QualityTuningLevelForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265QualityTuningLevel(H265QualityTuningLevel value);
+
+/**
+ * Same as GetNameForH265QualityTuningLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265QualityTuningLevelCStr(H265QualityTuningLevel value);
 } // namespace H265QualityTuningLevelMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace H265RateControlModeMapper
 AWS_MEDIACONVERT_API H265RateControlMode GetH265RateControlModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265RateControlMode(H265RateControlMode value);
+
+/**
+ * Same as GetNameForH265RateControlMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265RateControlModeCStr(H265RateControlMode value);
 } // namespace H265RateControlModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace H265SampleAdaptiveOffsetFilterModeMapper
 AWS_MEDIACONVERT_API H265SampleAdaptiveOffsetFilterMode GetH265SampleAdaptiveOffsetFilterModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265SampleAdaptiveOffsetFilterMode(H265SampleAdaptiveOffsetFilterMode value);
+
+/**
+ * Same as GetNameForH265SampleAdaptiveOffsetFilterMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265SampleAdaptiveOffsetFilterModeCStr(H265SampleAdaptiveOffsetFilterMode value);
 } // namespace H265SampleAdaptiveOffsetFilterModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H265SceneChangeDetectMapper
 AWS_MEDIACONVERT_API H265SceneChangeDetect GetH265SceneChangeDetectForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265SceneChangeDetect(H265SceneChangeDetect value);
+
+/**
+ * Same as GetNameForH265SceneChangeDetect(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265SceneChangeDetectCStr(H265SceneChangeDetect value);
 } // namespace H265SceneChangeDetectMapper
 } // namespace Model
 } // namespace MediaConvert
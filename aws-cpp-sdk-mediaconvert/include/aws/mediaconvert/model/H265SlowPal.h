@@ -35,6 +35,11 @@ namespace H265SlowPalMapper
 AWS_MEDIACONVERT_API H265SlowPal GetH265SlowPalForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265SlowPal(H265SlowPal value);
+
+/**
+ * Same as GetNameForH265SlowPal(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265SlowPalCStr(H265SlowPal value);
 } // namespace H265SlowPalMapper
 } // namespace Model
 } // namespace MediaConvert
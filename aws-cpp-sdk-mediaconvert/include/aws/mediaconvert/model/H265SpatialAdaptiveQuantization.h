@@ -35,6 +35,11 @@ namespace H265SpatialAdaptiveQuantizationMapper
 AWS_MEDIACONVERT_API H265SpatialAdaptiveQuantization GetH265SpatialAdaptiveQuantizationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265SpatialAdaptiveQuantization(H265SpatialAdaptiveQuantization value);
+
+/**
+ * Same as GetNameForH265SpatialAdaptiveQuantization(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265SpatialAdaptiveQuantizationCStr(H265SpatialAdaptiveQuantization value);
 } // namespace H265SpatialAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
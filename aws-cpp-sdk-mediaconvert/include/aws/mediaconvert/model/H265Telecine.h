@@ -36,6 +36,11 @@ namespace H265TelecineMapper
 AWS_MEDIACONVERT_API H265Telecine GetH265TelecineForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265Telecine(H265Telecine value);
+
+/**
+ * Same as GetNameForH265Telecine(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265TelecineCStr(H265Telecine value);
 } // namespace H265TelecineMapper
 } // namespace Model
 } // namespace MediaConvert
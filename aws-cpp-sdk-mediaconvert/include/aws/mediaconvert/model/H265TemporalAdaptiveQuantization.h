@@ -35,6 +35,11 @@ namespace H265TemporalAdaptiveQuantizationMapper
 AWS_MEDIACONVERT_API H265TemporalAdaptiveQuantization GetH265TemporalAdaptiveQuantizationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265TemporalAdaptiveQuantization(H265TemporalAdaptiveQuantization value);
+
+/**
+ * Same as GetNameForH265TemporalAdaptiveQuantization(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265TemporalAdaptiveQuantizationCStr(H265TemporalAdaptiveQuantization value);
 } // namespace H265TemporalAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H265TemporalIdsMapper
 AWS_MEDIACONVERT_API H265TemporalIds GetH265TemporalIdsForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265TemporalIds(H265TemporalIds value);
+
+/**
+ * Same as GetNameForH265TemporalIds(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265TemporalIdsCStr(H265TemporalIds value);
 } // namespace H265TemporalIdsMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H265TilesMapper
 AWS_MEDIACONVERT_API H265Tiles GetH265TilesForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265Tiles(H265Tiles value);
+
+/**
+ * Same as GetNameForH265Tiles(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265TilesCStr(H265Tiles value);
 } // namespace H265TilesMapper
 } // namespace Model
 } // namespace MediaConvert
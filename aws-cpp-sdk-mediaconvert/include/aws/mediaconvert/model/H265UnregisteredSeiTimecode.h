@@ -35,6 +35,11 @@ namespace H265UnregisteredSeiTimecodeMapper
 AWS_MEDIACONVERT_API H265UnregisteredSeiTimecode GetH265UnregisteredSeiTimecodeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265UnregisteredSeiTimecode(H265UnregisteredSeiTimecode value);
+
+/**
+ * Same as GetNameForH265UnregisteredSeiTimecode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265UnregisteredSeiTimecodeCStr(H265UnregisteredSeiTimecode value);
 } // namespace H265UnregisteredSeiTimecodeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace H265WriteMp4PackagingTypeMapper
 AWS_MEDIACONVERT_API H265WriteMp4PackagingType GetH265WriteMp4PackagingTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForH265WriteMp4PackagingType(H265WriteMp4PackagingType value);
+
+/**
+ * Same as GetNameForH265WriteMp4PackagingType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForH265WriteMp4PackagingTypeCStr(H265WriteMp4PackagingType value);
 } // namespace H265WriteMp4PackagingTypeMapper
 } // namespace Model
 } // namespace MediaConvert
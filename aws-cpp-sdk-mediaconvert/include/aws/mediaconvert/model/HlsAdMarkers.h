@@ -35,6 +35,11 @@ namespace HlsAdMarkersMapper
 AWS_MEDIACONVERT_API HlsAdMarkers GetHlsAdMarkersForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForHlsAdMarkers(HlsAdMarkers value);
+
+/**
+ * Same as GetNameForHlsAdMarkers(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForHlsAdMarkersCStr(HlsAdMarkers value);
 } // namespace HlsAdMarkersMapper
 } // namespace Model
 } // namespace MediaConvert
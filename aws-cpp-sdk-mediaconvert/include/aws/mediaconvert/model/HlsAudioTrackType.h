@@ -37,6 +37,11 @@ namespace HlsAudioTrackTypeMapper
 AWS_MEDIACONVERT_API HlsAudioTrackType GetHlsAudioTrackTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForHlsAudioTrackType(HlsAudioTrackType value);
+
+/**
+ * Same as GetNameForHlsAudioTrackType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForHlsAudioTrackTypeCStr(HlsAudioTrackType value);
 } // namespace HlsAudioTrackTypeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace HlsEncryptionTypeMapper
 AWS_MEDIACONVERT_API HlsEncryptionType GetHlsEncryptionTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForHlsEncryptionType(HlsEncryptionType value);
+
+/**
+ * Same as GetNameForHlsEncryptionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForHlsEncryptionTypeCStr(HlsEncryptionType value);
 } // namespace HlsEncryptionTypeMapper
 } // namespace Model
 } // namespace MediaConvert
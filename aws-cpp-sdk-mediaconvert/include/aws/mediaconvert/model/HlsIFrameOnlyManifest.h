@@ -35,6 +35,11 @@ namespace HlsIFrameOnlyManifestMapper
 AWS_MEDIACONVERT_API HlsIFrameOnlyManifest GetHlsIFrameOnlyManifestForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForHlsIFrameOnlyManifest(HlsIFrameOnlyManifest value);
+
+/**
+ * Same as GetNameForHlsIFrameOnlyManifest(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForHlsIFrameOnlyManifestCStr(HlsIFrameOnlyManifest value);
 } // namespace HlsIFrameOnlyManifestMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace HlsInitializationVectorInManifestMapper
 AWS_MEDIACONVERT_API HlsInitializationVectorInManifest GetHlsInitializationVectorInManifestForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForHlsInitializationVectorInManifest(HlsInitializationVectorInManifest value);
+
+/**
+ * Same as GetNameForHlsInitializationVectorInManifest(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForHlsInitializationVectorInManifestCStr(HlsInitializationVectorInManifest value);
 } // namespace HlsInitializationVectorInManifestMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace HlsKeyProviderTypeMapper
 AWS_MEDIACONVERT_API HlsKeyProviderType GetHlsKeyProviderTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForHlsKeyProviderType(HlsKeyProviderType value);
+
+/**
+ * Same as GetNameForHlsKeyProviderType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForHlsKeyProviderTypeCStr(HlsKeyProviderType value);
 } // namespace HlsKeyProviderTypeMapper
 } // namespace Model
 } // namespace MediaConvert
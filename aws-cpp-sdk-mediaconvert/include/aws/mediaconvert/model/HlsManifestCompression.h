@@ -35,6 +35,11 @@ namespace HlsManifestCompressionMapper
 AWS_MEDIACONVERT_API HlsManifestCompression GetHlsManifestCompressionForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForHlsManifestCompression(HlsManifestCompression value);
+
+/**
+ * Same as GetNameForHlsManifestCompression(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForHlsManifestCompressionCStr(HlsManifestCompression value);
 } // namespace HlsManifestCompressionMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace HlsProgramDateTimeMapper
 AWS_MEDIACONVERT_API HlsProgramDateTime GetHlsProgramDateTimeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForHlsProgramDateTime(HlsProgramDateTime value);
+
+/**
+ * Same as GetNameForHlsProgramDateTime(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForHlsProgramDateTimeCStr(HlsProgramDateTime value);
 } // namespace HlsProgramDateTimeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace HlsSegmentControlMapper
 AWS_MEDIACONVERT_API HlsSegmentControl GetHlsSegmentControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForHlsSegmentControl(HlsSegmentControl value);
+
+/**
+ * Same as GetNameForHlsSegmentControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForHlsSegmentControlCStr(HlsSegmentControl value);
 } // namespace HlsSegmentControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace HlsStreamInfResolutionMapper
 AWS_MEDIACONVERT_API HlsStreamInfResolution GetHlsStreamInfResolutionForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForHlsStreamInfResolution(HlsStreamInfResolution value);
+
+/**
+ * Same as GetNameForHlsStreamInfResolution(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForHlsStreamInfResolutionCStr(HlsStreamInfResolution value);
 } // namespace HlsStreamInfResolutionMapper
 } // namespace Model
 } // namespace MediaConvert
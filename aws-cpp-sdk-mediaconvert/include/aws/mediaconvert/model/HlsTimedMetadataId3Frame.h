@@ -36,6 +36,11 @@ namespace HlsTimedMetadataId3FrameMapper
 AWS_MEDIACONVERT_API HlsTimedMetadataId3Frame GetHlsTimedMetadataId3FrameForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForHlsTimedMetadataId3Frame(HlsTimedMetadataId3Frame value);
+
+/**
+ * Same as GetNameForHlsTimedMetadataId3Frame(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForHlsTimedMetadataId3FrameCStr(HlsTimedMetadataId3Frame value);
 } // namespace HlsTimedMetadataId3FrameMapper
 } // namespace Model
 } // namespace MediaConvert
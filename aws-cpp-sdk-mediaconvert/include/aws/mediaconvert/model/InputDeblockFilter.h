@@ -35,6 +35,11 @@ namespace InputDeblockFilterMapper
 AWS_MEDIACONVERT_API InputDeblockFilter GetInputDeblockFilterForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForInputDeblockFilter(InputDeblockFilter value);
+
+/**
+ * Same as GetNameForInputDeblockFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForInputDeblockFilterCStr(InputDeblockFilter value);
 } // namespace InputDeblockFilterMapper
 } // namespace Model
 } // namespace MediaConvert
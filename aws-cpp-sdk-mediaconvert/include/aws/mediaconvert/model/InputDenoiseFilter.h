@@ -35,6 +35,11 @@ namespace InputDenoiseFilterMapper
 AWS_MEDIACONVERT_API InputDenoiseFilter GetInputDenoiseFilterForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForInputDenoiseFilter(InputDenoiseFilter value);
+
+/**
+ * Same as GetNameForInputDenoiseFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForInputDenoiseFilterCStr(InputDenoiseFilter value);
 } // namespace InputDenoiseFilterMapper
 } // namespace Model
 } // namespace MediaConvert
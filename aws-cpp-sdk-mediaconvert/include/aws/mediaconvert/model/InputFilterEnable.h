@@ -36,6 +36,11 @@ namespace InputFilterEnableMapper
 AWS_MEDIACONVERT_API InputFilterEnable GetInputFilterEnableForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForInputFilterEnable(InputFilterEnable value);
+
+/**
+ * Same as GetNameForInputFilterEnable(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForInputFilterEnableCStr(InputFilterEnable value);
 } // namespace InputFilterEnableMapper
 } // namespace Model
 } // namespace MediaConvert
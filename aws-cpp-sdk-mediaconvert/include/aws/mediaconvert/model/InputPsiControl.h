@@ -35,6 +35,11 @@ namespace InputPsiControlMapper
 AWS_MEDIACONVERT_API InputPsiControl GetInputPsiControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForInputPsiControl(InputPsiControl value);
+
+/**
+ * Same as GetNameForInputPsiControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForInputPsiControlCStr(InputPsiControl value);
 } // namespace InputPsiControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace InputTimecodeSourceMapper
 AWS_MEDIACONVERT_API InputTimecodeSource GetInputTimecodeSourceForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForInputTimecodeSource(InputTimecodeSource value);
+
+/**
+ * Same as GetNameForInputTimecodeSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForInputTimecodeSourceCStr(InputTimecodeSource value);
 } // namespace InputTimecodeSourceMapper
 } // namespace Model
 } // namespace MediaConvert
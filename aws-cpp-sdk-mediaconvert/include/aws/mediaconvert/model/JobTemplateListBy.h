@@ -36,6 +36,11 @@ namespace JobTemplateListByMapper
 AWS_MEDIACONVERT_API JobTemplateListBy GetJobTemplateListByForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForJobTemplateListBy(JobTemplateListBy value);
+
+/**
+ * Same as GetNameForJobTemplateListBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForJobTemplateListByCStr(JobTemplateListBy value);
 } // namespace JobTemplateListByMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -224,6 +224,11 @@ namespace LanguageCodeMapper
 AWS_MEDIACONVERT_API LanguageCode GetLanguageCodeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForLanguageCode(LanguageCode value);
+
+/**
+ * Same as GetNameForLanguageCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForLanguageCodeCStr(LanguageCode value);
 } // namespace LanguageCodeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace M2tsAudioBufferModelMapper
 AWS_MEDIACONVERT_API M2tsAudioBufferModel GetM2tsAudioBufferModelForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForM2tsAudioBufferModel(M2tsAudioBufferModel value);
+
+/**
+ * Same as GetNameForM2tsAudioBufferModel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForM2tsAudioBufferModelCStr(M2tsAudioBufferModel value);
 } // namespace M2tsAudioBufferModelMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace M2tsBufferModelMapper
 AWS_MEDIACONVERT_API M2tsBufferModel GetM2tsBufferModelForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForM2tsBufferModel(M2tsBufferModel value);
+
+/**
+ * Same as GetNameForM2tsBufferModel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForM2tsBufferModelCStr(M2tsBufferModel value);
 } // namespace M2tsBufferModelMapper
 } // namespace Model
 } // namespace MediaConvert
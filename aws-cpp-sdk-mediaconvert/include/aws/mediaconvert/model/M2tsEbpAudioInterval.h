@@ -35,6 +35,11 @@ namespace M2tsEbpAudioIntervalMapper
 AWS_MEDIACONVERT_API M2tsEbpAudioInterval GetM2tsEbpAudioIntervalForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForM2tsEbpAudioInterval(M2tsEbpAudioInterval value);
+
+/**
+ * Same as GetNameForM2tsEbpAudioInterval(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForM2tsEbpAudioIntervalCStr(M2tsEbpAudioInterval value);
 } // namespace M2tsEbpAudioIntervalMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace M2tsEbpPlacementMapper
 AWS_MEDIACONVERT_API M2tsEbpPlacement GetM2tsEbpPlacementForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForM2tsEbpPlacement(M2tsEbpPlacement value);
+
+/**
+ * Same as GetNameForM2tsEbpPlacement(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForM2tsEbpPlacementCStr(M2tsEbpPlacement value);
 } // namespace M2tsEbpPlacementMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace M2tsNielsenId3Mapper
 AWS_MEDIACONVERT_API M2tsNielsenId3 GetM2tsNielsenId3ForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForM2tsNielsenId3(M2tsNielsenId3 value);
+
+/**
+ * Same as GetNameForM2tsNielsenId3(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForM2tsNielsenId3CStr(M2tsNielsenId3 value);
 } // namespace M2tsNielsenId3Mapper
 } // namespace Model
 } // namespace MediaConvert
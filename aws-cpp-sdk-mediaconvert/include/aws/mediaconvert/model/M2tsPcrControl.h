@@ -35,6 +35,11 @@ namespace M2tsPcrControlMapper
 AWS_MEDIACONVERT_API M2tsPcrControl GetM2tsPcrControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForM2tsPcrControl(M2tsPcrControl value);
+
+/**
+ * Same as GetNameForM2tsPcrControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForM2tsPcrControlCStr(M2tsPcrControl value);
 } // namespace M2tsPcrControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace M2tsScte35SourceMapper
 AWS_MEDIACONVERT_API M2tsScte35Source GetM2tsScte35SourceForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForM2tsScte35Source(M2tsScte35Source value);
+
+/**
+ * Same as GetNameForM2tsScte35Source(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForM2tsScte35SourceCStr(M2tsScte35Source value);
 } // namespace M2tsScte35SourceMapper
 } // namespace Model
 } // namespace MediaConvert
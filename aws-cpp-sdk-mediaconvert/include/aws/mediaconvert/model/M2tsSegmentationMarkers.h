@@ -39,6 +39,11 @@ namespace M2tsSegmentationMarkersMapper
 AWS_MEDIACONVERT_API M2tsSegmentationMarkers GetM2tsSegmentationMarkersForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForM2tsSegmentationMarkers(M2tsSegmentationMarkers value);
+
+/**
+ * Same as GetNameForM2tsSegmentationMarkers(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForM2tsSegmentationMarkersCStr(M2tsSegmentationMarkers value);
 } // namespace M2tsSegmentationMarkersMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace M3u8NielsenId3Mapper
 AWS_MEDIACONVERT_API M3u8NielsenId3 GetM3u8NielsenId3ForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForM3u8NielsenId3(M3u8NielsenId3 value);
+
+/**
+ * Same as GetNameForM3u8NielsenId3(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForM3u8NielsenId3CStr(M3u8NielsenId3 value);
 } // namespace M3u8NielsenId3Mapper
 } // namespace Model
 } // namespace MediaConvert
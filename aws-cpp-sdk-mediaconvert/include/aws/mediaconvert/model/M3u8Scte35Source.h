@@ -35,6 +35,11 @@ namespace M3u8Scte35SourceMapper
 AWS_MEDIACONVERT_API M3u8Scte35Source GetM3u8Scte35SourceForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForM3u8Scte35Source(M3u8Scte35Source value);
+
+/**
+ * Same as GetNameForM3u8Scte35Source(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForM3u8Scte35SourceCStr(M3u8Scte35Source value);
 } // namespace M3u8Scte35SourceMapper
 } // namespace Model
 } // namespace MediaConvert
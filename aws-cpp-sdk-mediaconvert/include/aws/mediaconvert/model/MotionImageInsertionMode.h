@@ -35,6 +35,11 @@ namespace MotionImageInsertionModeMapper
 AWS_MEDIACONVERT_API MotionImageInsertionMode GetMotionImageInsertionModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMotionImageInsertionMode(MotionImageInsertionMode value);
+
+/**
+ * Same as GetNameForMotionImageInsertionMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMotionImageInsertionModeCStr(MotionImageInsertionMode value);
 } // namespace MotionImageInsertionModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace MotionImagePlaybackMapper
 AWS_MEDIACONVERT_API MotionImagePlayback GetMotionImagePlaybackForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMotionImagePlayback(MotionImagePlayback value);
+
+/**
+ * Same as GetNameForMotionImagePlayback(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMotionImagePlaybackCStr(MotionImagePlayback value);
 } // namespace MotionImagePlaybackMapper
 } // namespace Model
 } // namespace MediaConvert
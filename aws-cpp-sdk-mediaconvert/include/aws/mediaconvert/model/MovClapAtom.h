@@ -35,6 +35,11 @@ namespace MovClapAtomMapper
 AWS_MEDIACONVERT_API MovClapAtom GetMovClapAtomForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMovClapAtom(MovClapAtom value);
+
+/**
+ * Same as GetNameForMovClapAtom(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMovClapAtomCStr(MovClapAtom value);
 } // namespace MovClapAtomMapper
 } // namespace Model
 } // namespace MediaConvert
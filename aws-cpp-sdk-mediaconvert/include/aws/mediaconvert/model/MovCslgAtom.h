@@ -35,6 +35,11 @@ namespace MovCslgAtomMapper
 AWS_MEDIACONVERT_API MovCslgAtom GetMovCslgAtomForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMovCslgAtom(MovCslgAtom value);
+
+/**
+ * Same as GetNameForMovCslgAtom(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMovCslgAtomCStr(MovCslgAtom value);
 } // namespace MovCslgAtomMapper
 } // namespace Model
 } // namespace MediaConvert
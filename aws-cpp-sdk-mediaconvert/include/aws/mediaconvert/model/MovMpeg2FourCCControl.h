@@ -35,6 +35,11 @@ namespace MovMpeg2FourCCControlMapper
 AWS_MEDIACONVERT_API MovMpeg2FourCCControl GetMovMpeg2FourCCControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMovMpeg2FourCCControl(MovMpeg2FourCCControl value);
+
+/**
+ * Same as GetNameForMovMpeg2FourCCControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMovMpeg2FourCCControlCStr(MovMpeg2FourCCControl value);
 } // namespace MovMpeg2FourCCControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace MovPaddingControlMapper
 AWS_MEDIACONVERT_API MovPaddingControl GetMovPaddingControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMovPaddingControl(MovPaddingControl value);
+
+/**
+ * Same as GetNameForMovPaddingControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMovPaddingControlCStr(MovPaddingControl value);
 } // namespace MovPaddingControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace MovReferenceMapper
 AWS_MEDIACONVERT_API MovReference GetMovReferenceForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMovReference(MovReference value);
+
+/**
+ * Same as GetNameForMovReference(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMovReferenceCStr(MovReference value);
 } // namespace MovReferenceMapper
 } // namespace Model
 } // namespace MediaConvert
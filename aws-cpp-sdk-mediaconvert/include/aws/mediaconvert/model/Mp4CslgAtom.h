@@ -35,6 +35,11 @@ namespace Mp4CslgAtomMapper
 AWS_MEDIACONVERT_API Mp4CslgAtom GetMp4CslgAtomForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMp4CslgAtom(Mp4CslgAtom value);
+
+/**
+ * Same as GetNameForMp4CslgAtom(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMp4CslgAtomCStr(Mp4CslgAtom value);
 } // namespace Mp4CslgAtomMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace Mp4FreeSpaceBoxMapper
 AWS_MEDIACONVERT_API Mp4FreeSpaceBox GetMp4FreeSpaceBoxForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMp4FreeSpaceBox(Mp4FreeSpaceBox value);
+
+/**
+ * Same as GetNameForMp4FreeSpaceBox(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMp4FreeSpaceBoxCStr(Mp4FreeSpaceBox value);
 } // namespace Mp4FreeSpaceBoxMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace Mp4MoovPlacementMapper
 AWS_MEDIACONVERT_API Mp4MoovPlacement GetMp4MoovPlacementForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMp4MoovPlacement(Mp4MoovPlacement value);
+
+/**
+ * Same as GetNameForMp4MoovPlacement(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMp4MoovPlacementCStr(Mp4MoovPlacement value);
 } // namespace Mp4MoovPlacementMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -37,6 +37,11 @@ namespace Mpeg2AdaptiveQuantizationMapper
 AWS_MEDIACONVERT_API Mpeg2AdaptiveQuantization GetMpeg2AdaptiveQuantizationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2AdaptiveQuantization(Mpeg2AdaptiveQuantization value);
+
+/**
+ * Same as GetNameForMpeg2AdaptiveQuantization(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2AdaptiveQuantizationCStr(Mpeg2AdaptiveQuantization value);
 } // namespace Mpeg2AdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -38,6 +38,11 @@ namespace Mpeg2CodecLevelMapper
 AWS_MEDIACONVERT_API Mpeg2CodecLevel GetMpeg2CodecLevelForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2CodecLevel(Mpeg2CodecLevel value);
+
+/**
+ * Same as GetNameForMpeg2CodecLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2CodecLevelCStr(Mpeg2CodecLevel value);
 } // namespace Mpeg2CodecLevelMapper
 } // namespace Model
 } // namespace MediaConvert
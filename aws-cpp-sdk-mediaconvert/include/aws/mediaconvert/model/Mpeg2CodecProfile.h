@@ -35,6 +35,11 @@ namespace Mpeg2CodecProfileMapper
 AWS_MEDIACONVERT_API Mpeg2CodecProfile GetMpeg2CodecProfileForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2CodecProfile(Mpeg2CodecProfile value);
+
+/**
+ * Same as GetNameForMpeg2CodecProfile(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2CodecProfileCStr(Mpeg2CodecProfile value);
 } // namespace Mpeg2CodecProfileMapper
 } // namespace Model
 } // namespace MediaConvert
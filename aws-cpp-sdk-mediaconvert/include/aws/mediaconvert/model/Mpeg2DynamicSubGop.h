@@ -35,6 +35,11 @@ namespace Mpeg2DynamicSubGopMapper
 AWS_MEDIACONVERT_API Mpeg2DynamicSubGop GetMpeg2DynamicSubGopForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2DynamicSubGop(Mpeg2DynamicSubGop value);
+
+/**
+ * Same as GetNameForMpeg2DynamicSubGop(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2DynamicSubGopCStr(Mpeg2DynamicSubGop value);
 } // namespace Mpeg2DynamicSubGopMapper
 } // namespace Model
 } // namespace MediaConvert
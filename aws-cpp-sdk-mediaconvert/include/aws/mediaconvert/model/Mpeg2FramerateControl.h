@@ -35,6 +35,11 @@ namespace Mpeg2FramerateControlMapper
 AWS_MEDIACONVERT_API Mpeg2FramerateControl GetMpeg2FramerateControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2FramerateControl(Mpeg2FramerateControl value);
+
+/**
+ * Same as GetNameForMpeg2FramerateControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2FramerateControlCStr(Mpeg2FramerateControl value);
 } // namespace Mpeg2FramerateControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace Mpeg2FramerateConversionAlgorithmMapper
 AWS_MEDIACONVERT_API Mpeg2FramerateConversionAlgorithm GetMpeg2FramerateConversionAlgorithmForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2FramerateConversionAlgorithm(Mpeg2FramerateConversionAlgorithm value);
+
+/**
+ * Same as GetNameForMpeg2FramerateConversionAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2FramerateConversionAlgorithmCStr(Mpeg2FramerateConversionAlgorithm value);
 } // namespace Mpeg2FramerateConversionAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace Mpeg2GopSizeUnitsMapper
 AWS_MEDIACONVERT_API Mpeg2GopSizeUnits GetMpeg2GopSizeUnitsForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2GopSizeUnits(Mpeg2GopSizeUnits value);
+
+/**
+ * Same as GetNameForMpeg2GopSizeUnits(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2GopSizeUnitsCStr(Mpeg2GopSizeUnits value);
 } // namespace Mpeg2GopSizeUnitsMapper
 } // namespace Model
 } // namespace MediaConvert
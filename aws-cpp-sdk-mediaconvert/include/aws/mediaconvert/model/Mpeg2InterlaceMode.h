@@ -38,6 +38,11 @@ namespace Mpeg2InterlaceModeMapper
 AWS_MEDIACONVERT_API Mpeg2InterlaceMode GetMpeg2InterlaceModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2InterlaceMode(Mpeg2InterlaceMode value);
+
+/**
+ * Same as GetNameForMpeg2InterlaceMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2InterlaceModeCStr(Mpeg2InterlaceMode value);
 } // namespace Mpeg2InterlaceModeMapper
 } // namespace Model
 } // namespace MediaConvert
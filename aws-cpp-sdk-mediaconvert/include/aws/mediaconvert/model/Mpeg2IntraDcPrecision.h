@@ -38,6 +38,11 @@ namespace Mpeg2IntraDcPrecisionMapper
 AWS_MEDIACONVERT_API Mpeg2IntraDcPrecision GetMpeg2IntraDcPrecisionForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2IntraDcPrecision(Mpeg2IntraDcPrecision value);
+
+/**
+ * Same as GetNameForMpeg2IntraDcPrecision(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2IntraDcPrecisionCStr(Mpeg2IntraDcPrecision value);
 } // namespace Mpeg2IntraDcPrecisionMapper
 } // namespace Model
 } // namespace MediaConvert
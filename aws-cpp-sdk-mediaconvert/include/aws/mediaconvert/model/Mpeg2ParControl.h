@@ -35,6 +35,11 @@ namespace Mpeg2ParControlMapper
 AWS_MEDIACONVERT_API Mpeg2ParControl GetMpeg2ParControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2ParControl(Mpeg2ParControl value);
+
+/**
+ * Same as GetNameForMpeg2ParControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2ParControlCStr(Mpeg2ParControl value);
 } // namespace Mpeg2ParControlMapper
 } // namespace Model
 } // namespace MediaConvert
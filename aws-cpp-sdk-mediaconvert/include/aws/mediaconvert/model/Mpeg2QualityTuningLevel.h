@@ -35,6 +35,11 @@ namespace Mpeg2QualityTuningLevelMapper
 AWS_MEDIACONVERT_API Mpeg2QualityTuningLevel GetMpeg2QualityTuningLevelForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2QualityTuningLevel(Mpeg2QualityTuningLevel value);
+
+/**
+ * Same as GetNameForMpeg2QualityTuningLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2QualityTuningLevelCStr(Mpeg2QualityTuningLevel value);
 } // namespace Mpeg2QualityTuningLevelMapper
 } // namespace Model
 } // namespace MediaConvert
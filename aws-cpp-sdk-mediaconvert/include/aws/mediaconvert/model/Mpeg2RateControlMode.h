@@ -35,6 +35,11 @@ namespace Mpeg2RateControlModeMapper
 AWS_MEDIACONVERT_API Mpeg2RateControlMode GetMpeg2RateControlModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2RateControlMode(Mpeg2RateControlMode value);
+
+/**
+ * Same as GetNameForMpeg2RateControlMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2RateControlModeCStr(Mpeg2RateControlMode value);
 } // namespace Mpeg2RateControlModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace Mpeg2SceneChangeDetectMapper
 AWS_MEDIACONVERT_API Mpeg2SceneChangeDetect GetMpeg2SceneChangeDetectForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2SceneChangeDetect(Mpeg2SceneChangeDetect value);
+
+/**
+ * Same as GetNameForMpeg2SceneChangeDetect(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2SceneChangeDetectCStr(Mpeg2SceneChangeDetect value);
 } // namespace Mpeg2SceneChangeDetectMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace Mpeg2SlowPalMapper
 AWS_MEDIACONVERT_API Mpeg2SlowPal GetMpeg2SlowPalForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2SlowPal(Mpeg2SlowPal value);
+
+/**
+ * Same as GetNameForMpeg2SlowPal(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2SlowPalCStr(Mpeg2SlowPal value);
 } // namespace Mpeg2SlowPalMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace Mpeg2SpatialAdaptiveQuantizationMapper
 AWS_MEDIACONVERT_API Mpeg2SpatialAdaptiveQuantization GetMpeg2SpatialAdaptiveQuantizationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2SpatialAdaptiveQuantization(Mpeg2SpatialAdaptiveQuantization value);
+
+/**
+ * Same as GetNameForMpeg2SpatialAdaptiveQuantization(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2SpatialAdaptiveQuantizationCStr(Mpeg2SpatialAdaptiveQuantization value);
 } // namespace Mpeg2SpatialAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
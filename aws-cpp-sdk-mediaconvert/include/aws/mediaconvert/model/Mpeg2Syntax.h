@@ -35,6 +35,11 @@ namespace Mpeg2SyntaxMapper
 AWS_MEDIACONVERT_API Mpeg2Syntax GetMpeg2SyntaxForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2Syntax(Mpeg2Syntax value);
+
+/**
+ * Same as GetNameForMpeg2Syntax(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2SyntaxCStr(Mpeg2Syntax value);
 } // namespace Mpeg2SyntaxMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace Mpeg2TelecineMapper
 AWS_MEDIACONVERT_API Mpeg2Telecine GetMpeg2TelecineForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2Telecine(Mpeg2Telecine value);
+
+/**
+ * Same as GetNameForMpeg2Telecine(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2TelecineCStr(Mpeg2Telecine value);
 } // namespace Mpeg2TelecineMapper
 } // namespace Model
 } // namespace MediaConvert
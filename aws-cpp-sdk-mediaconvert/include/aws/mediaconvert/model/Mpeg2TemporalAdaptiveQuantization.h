@@ -35,6 +35,11 @@ namespace Mpeg2TemporalAdaptiveQuantizationMapper
 AWS_MEDIACONVERT_API Mpeg2TemporalAdaptiveQuantization GetMpeg2TemporalAdaptiveQuantizationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2TemporalAdaptiveQuantization(Mpeg2TemporalAdaptiveQuantization value);
+
+/**
+ * Same as GetNameForMpeg2TemporalAdaptiveQuantization(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2TemporalAdaptiveQuantizationCStr(Mpeg2TemporalAdaptiveQuantization value);
 } // namespace Mpeg2TemporalAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
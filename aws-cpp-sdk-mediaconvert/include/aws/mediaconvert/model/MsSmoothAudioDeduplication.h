@@ -35,6 +35,11 @@ namespace MsSmoothAudioDeduplicationMapper
 AWS_MEDIACONVERT_API MsSmoothAudioDeduplication GetMsSmoothAudioDeduplicationForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMsSmoothAudioDeduplication(MsSmoothAudioDeduplication value);
+
+/**
+ * Same as GetNameForMsSmoothAudioDeduplication(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMsSmoothAudioDeduplicationCStr(MsSmoothAudioDeduplication value);
 } // namespace MsSmoothAudioDeduplicationMapper
 } // namespace Model
 } // namespace MediaConvert
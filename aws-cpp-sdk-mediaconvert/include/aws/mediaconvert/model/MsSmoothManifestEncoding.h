@@ -35,6 +35,11 @@ namespace MsSmoothManifestEncodingMapper
 AWS_MEDIACONVERT_API MsSmoothManifestEncoding GetMsSmoothManifestEncodingForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForMsSmoothManifestEncoding(MsSmoothManifestEncoding value);
+
+/**
+ * Same as GetNameForMsSmoothManifestEncoding(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForMsSmoothManifestEncodingCStr(MsSmoothManifestEncoding value);
 } // namespace MsSmoothManifestEncodingMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -40,6 +40,11 @@ namespace NoiseReducerFilterMapper
 AWS_MEDIACONVERT_API NoiseReducerFilter GetNoiseReducerFilterForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForNoiseReducerFilter(NoiseReducerFilter value);
+
+/**
+ * Same as GetNameForNoiseReducerFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForNoiseReducerFilterCStr(NoiseReducerFilter value);
 } // namespace NoiseReducerFilterMapper
 } // namespace Model
 } // namespace MediaConvert
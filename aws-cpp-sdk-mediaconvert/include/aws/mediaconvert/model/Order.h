@@ -35,6 +35,11 @@ namespace OrderMapper
 AWS_MEDIACONVERT_API Order GetOrderForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForOrder(Order value);
+
+/**
+ * Same as GetNameForOrder(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForOrderCStr(Order value);
 } // namespace OrderMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -38,6 +38,11 @@ namespace OutputGroupTypeMapper
 AWS_MEDIACONVERT_API OutputGroupType GetOutputGroupTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForOutputGroupType(OutputGroupType value);
+
+/**
+ * Same as GetNameForOutputGroupType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForOutputGroupTypeCStr(OutputGroupType value);
 } // namespace OutputGroupTypeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -37,6 +37,11 @@ namespace OutputSdtMapper
 AWS_MEDIACONVERT_API OutputSdt GetOutputSdtForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForOutputSdt(OutputSdt value);
+
+/**
+ * Same as GetNameForOutputSdt(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForOutputSdtCStr(OutputSdt value);
 } // namespace OutputSdtMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace PresetListByMapper
 AWS_MEDIACONVERT_API PresetListBy GetPresetListByForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForPresetListBy(PresetListBy value);
+
+/**
+ * Same as GetNameForPresetListBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForPresetListByCStr(PresetListBy value);
 } // namespace PresetListByMapper
 } // namespace Model
 } // namespace MediaConvert
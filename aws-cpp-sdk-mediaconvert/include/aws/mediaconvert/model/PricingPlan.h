@@ -35,6 +35,11 @@ namespace PricingPlanMapper
 AWS_MEDIACONVERT_API PricingPlan GetPricingPlanForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForPricingPlan(PricingPlan value);
+
+/**
+ * Same as GetNameForPricingPlan(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForPricingPlanCStr(PricingPlan value);
 } // namespace PricingPlanMapper
 } // namespace Model
 } // namespace MediaConvert
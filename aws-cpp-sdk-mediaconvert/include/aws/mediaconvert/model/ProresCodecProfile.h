@@ -37,6 +37,11 @@ namespace ProresCodecProfileMapper
 AWS_MEDIACONVERT_API ProresCodecProfile GetProresCodecProfileForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForProresCodecProfile(ProresCodecProfile value);
+
+/**
+ * Same as GetNameForProresCodecProfile(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForProresCodecProfileCStr(ProresCodecProfile value);
 } // namespace ProresCodecProfileMapper
 } // namespace Model
 } // namespace MediaConvert
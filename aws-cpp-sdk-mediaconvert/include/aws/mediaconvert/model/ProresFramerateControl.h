@@ -35,6 +35,11 @@ namespace ProresFramerateControlMapper
 AWS_MEDIACONVERT_API ProresFramerateControl GetProresFramerateControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForProresFramerateControl(ProresFramerateControl value);
+
+/**
+ * Same as GetNameForProresFramerateControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForProresFramerateControlCStr(ProresFramerateControl value);
 } // namespace ProresFramerateControlMapper
 } // namespace Model
 } // namespace MediaConvert
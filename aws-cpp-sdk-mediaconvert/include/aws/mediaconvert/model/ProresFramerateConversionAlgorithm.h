@@ -35,6 +35,11 @@ namespace ProresFramerateConversionAlgorithmMapper
 AWS_MEDIACONVERT_API ProresFramerateConversionAlgorithm GetProresFramerateConversionAlgorithmForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForProresFramerateConversionAlgorithm(ProresFramerateConversionAlgorithm value);
+
+/**
+ * Same as GetNameForProresFramerateConversionAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForProresFramerateConversionAlgorithmCStr(ProresFramerateConversionAlgorithm value);
 } // namespace ProresFramerateConversionAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
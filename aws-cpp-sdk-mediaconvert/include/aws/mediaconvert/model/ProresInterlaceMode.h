@@ -38,6 +38,11 @@ namespace ProresInterlaceModeMapper
 AWS_MEDIACONVERT_API ProresInterlaceMode GetProresInterlaceModeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForProresInterlaceMode(ProresInterlaceMode value);
+
+/**
+ * Same as GetNameForProresInterlaceMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForProresInterlaceModeCStr(ProresInterlaceMode value);
 } // namespace ProresInterlaceModeMapper
 } // namespace Model
 } // namespace MediaConvert
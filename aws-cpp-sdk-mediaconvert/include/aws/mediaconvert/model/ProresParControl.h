@@ -35,6 +35,11 @@ namespace ProresParControlMapper
 AWS_MEDIACONVERT_API ProresParControl GetProresParControlForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForProresParControl(ProresParControl value);
+
+/**
+ * Same as GetNameForProresParControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForProresParControlCStr(ProresParControl value);
 } // namespace ProresParControlMapper
 } // namespace Model
 } // namespace MediaConvert
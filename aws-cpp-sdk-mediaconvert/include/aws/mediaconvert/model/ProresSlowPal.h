@@ -35,6 +35,11 @@ namespace ProresSlowPalMapper
 AWS_MEDIACONVERT_API ProresSlowPal GetProresSlowPalForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForProresSlowPal(ProresSlowPal value);
+
+/**
+ * Same as GetNameForProresSlowPal(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForProresSlowPalCStr(ProresSlowPal value);
 } // namespace ProresSlowPalMapper
 } // namespace Model
 } // namespace MediaConvert
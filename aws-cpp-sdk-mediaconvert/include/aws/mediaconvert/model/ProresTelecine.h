@@ -35,6 +35,11 @@ namespace ProresTelecineMapper
 AWS_MEDIACONVERT_API ProresTelecine GetProresTelecineForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForProresTelecine(ProresTelecine value);
+
+/**
+ * Same as GetNameForProresTelecine(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForProresTelecineCStr(ProresTelecine value);
 } // namespace ProresTelecineMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace QueueListByMapper
 AWS_MEDIACONVERT_API QueueListBy GetQueueListByForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForQueueListBy(QueueListBy value);
+
+/**
+ * Same as GetNameForQueueListBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForQueueListByCStr(QueueListBy value);
 } // namespace QueueListByMapper
 } // namespace Model
 } // namespace MediaConvert
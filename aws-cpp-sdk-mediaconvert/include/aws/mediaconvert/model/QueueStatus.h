@@ -35,6 +35,11 @@ namespace QueueStatusMapper
 AWS_MEDIACONVERT_API QueueStatus GetQueueStatusForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForQueueStatus(QueueStatus value);
+
+/**
+ * Same as GetNameForQueueStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForQueueStatusCStr(QueueStatus value);
 } // namespace QueueStatusMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace RenewalTypeMapper
 AWS_MEDIACONVERT_API RenewalType GetRenewalTypeForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForRenewalType(RenewalType value);
+
+/**
+ * Same as GetNameForRenewalType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForRenewalTypeCStr(RenewalType value);
 } // namespace RenewalTypeMapper
 } // namespace Model
 } // namespace MediaConvert
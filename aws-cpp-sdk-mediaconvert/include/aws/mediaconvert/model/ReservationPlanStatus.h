@@ -35,6 +35,11 @@ namespace ReservationPlanStatusMapper
 AWS_MEDIACONVERT_API ReservationPlanStatus GetReservationPlanStatusForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForReservationPlanStatus(ReservationPlanStatus value);
+
+/**
+ * Same as GetNameForReservationPlanStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForReservationPlanStatusCStr(ReservationPlanStatus value);
 } // namespace ReservationPlanStatusMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace RespondToAfdMapper
 AWS_MEDIACONVERT_API RespondToAfd GetRespondToAfdForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForRespondToAfd(RespondToAfd value);
+
+/**
+ * Same as GetNameForRespondToAfd(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForRespondToAfdCStr(RespondToAfd value);
 } // namespace RespondToAfdMapper
 } // namespace Model
 } // namespace MediaConvert
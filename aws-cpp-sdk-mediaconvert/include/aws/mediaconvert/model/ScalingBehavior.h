@@ -35,6 +35,11 @@ namespace ScalingBehaviorMapper
 AWS_MEDIACONVERT_API ScalingBehavior GetScalingBehaviorForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForScalingBehavior(ScalingBehavior value);
+
+/**
+ * Same as GetNameForScalingBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForScalingBehaviorCStr(ScalingBehavior value);
 } // namespace ScalingBehaviorMapper
 } // namespace Model
 } // namespace MediaConvert
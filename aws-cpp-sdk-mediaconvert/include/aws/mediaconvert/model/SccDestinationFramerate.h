@@ -37,6 +37,11 @@ namespace SccDestinationFramerateMapper
 AWS_MEDIACONVERT_API SccDestinationFramerate GetSccDestinationFramerateForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForSccDestinationFramerate(SccDestinationFramerate value);
+
+/**
+ * Same as GetNameForSccDestinationFramerate(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForSccDestinationFramerateCStr(SccDestinationFramerate value);
 } // namespace SccDestinationFramerateMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -42,6 +42,11 @@ namespace TimecodeBurninPositionMapper
 AWS_MEDIACONVERT_API TimecodeBurninPosition GetTimecodeBurninPositionForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForTimecodeBurninPosition(TimecodeBurninPosition value);
+
+/**
+ * Same as GetNameForTimecodeBurninPosition(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForTimecodeBurninPositionCStr(TimecodeBurninPosition value);
 } // namespace TimecodeBurninPositionMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,6 +36,11 @@ namespace TimecodeSourceMapper
 AWS_MEDIACONVERT_API TimecodeSource GetTimecodeSourceForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForTimecodeSource(TimecodeSource value);
+
+/**
+ * Same as GetNameForTimecodeSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForTimecodeSourceCStr(TimecodeSource value);
 } // namespace TimecodeSourceMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace TimedMetadataMapper
 AWS_MEDIACONVERT_API TimedMetadata GetTimedMetadataForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForTimedMetadata(TimedMetadata value);
+
+/**
+ * Same as GetNameForTimedMetadata(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForTimedMetadataCStr(TimedMetadata value);
 } // namespace TimedMetadataMapper
 } // namespace Model
 } // namespace MediaConvert
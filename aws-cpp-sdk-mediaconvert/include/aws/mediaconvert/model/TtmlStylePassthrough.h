@@ -35,6 +35,11 @@ namespace TtmlStylePassthroughMapper
 AWS_MEDIACONVERT_API TtmlStylePassthrough GetTtmlStylePassthroughForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForTtmlStylePassthrough(TtmlStylePassthrough value);
+
+/**
+ * Same as GetNameForTtmlStylePassthrough(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForTtmlStylePassthroughCStr(TtmlStylePassthrough value);
 } // namespace TtmlStylePassthroughMapper
 } // namespace Model
 } // namespace MediaConvert
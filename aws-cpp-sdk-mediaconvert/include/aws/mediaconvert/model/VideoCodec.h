@@ -38,6 +38,11 @@ namespace VideoCodecMapper
 AWS_MEDIACONVERT_API VideoCodec GetVideoCodecForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForVideoCodec(VideoCodec value);
+
+/**
+ * Same as GetNameForVideoCodec(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForVideoCodecCStr(VideoCodec value);
 } // namespace VideoCodecMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace VideoTimecodeInsertionMapper
 AWS_MEDIACONVERT_API VideoTimecodeInsertion GetVideoTimecodeInsertionForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForVideoTimecodeInsertion(VideoTimecodeInsertion value);
+
+/**
+ * Same as GetNameForVideoTimecodeInsertion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForVideoTimecodeInsertionCStr(VideoTimecodeInsertion value);
 } // namespace VideoTimecodeInsertionMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,6 +35,11 @@ namespace WavFormatMapper
 AWS_MEDIACONVERT_API WavFormat GetWavFormatForName(const Aws::String& name);
 
 AWS_MEDIACONVERT_API Aws::String GetNameForWavFormat(WavFormat value);
+
+/**
+ * Same as GetNameForWavFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIACONVERT_API const char* GetNameForWavFormatCStr(WavFormat value);
 } // namespace WavFormatMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -30,20 +30,37 @@ namespace Aws
       namespace AacAudioDescriptionBroadcasterMixMapper
       {
 
-        static const int BROADCASTER_MIXED_AD_HASH = HashingUtils::HashString("BROADCASTER_MIXED_AD");
-        static const int NORMAL_HASH = HashingUtils::HashString("NORMAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BROADCASTER_MIXED_AD",
+          "NORMAL",
+        };
 
         AacAudioDescriptionBroadcasterMix GetAacAudioDescriptionBroadcasterMixForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BROADCASTER_MIXED_AD_HASH)
-          {
-            return AacAudioDescriptionBroadcasterMix::BROADCASTER_MIXED_AD;
-          }
-          else if (hashCode == NORMAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AacAudioDescriptionBroadcasterMix::NORMAL;
+          case -1262736616:
+            if (name == "BROADCASTER_MIXED_AD")
+            {
+              return AacAudioDescriptionBroadcasterMix::BROADCASTER_MIXED_AD;
+            }
+            break;
+          case -1986416409:
+            if (name == "NORMAL")
+            {
+              return AacAudioDescriptionBroadcasterMix::NORMAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AacAudioDescriptionBroadcasterMix::NOT_SET;
         }
 
-        Aws::String GetNameForAacAudioDescriptionBroadcasterMix(AacAudioDescriptionBroadcasterMix enumValue)
+        const char* GetNameForAacAudioDescriptionBroadcasterMixCStr(AacAudioDescriptionBroadcasterMix enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AacAudioDescriptionBroadcasterMix::BROADCASTER_MIXED_AD:
-            return "BROADCASTER_MIXED_AD";
-          case AacAudioDescriptionBroadcasterMix::NORMAL:
-            return "NORMAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAacAudioDescriptionBroadcasterMix(AacAudioDescriptionBroadcasterMix enumValue)
+        {
+          return GetNameForAacAudioDescriptionBroadcasterMixCStr(enumValue);
         }
 
       } // namespace AacAudioDescriptionBroadcasterMixMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AacCodecProfileMapper
       {
 
-        static const int LC_HASH = HashingUtils::HashString("LC");
-        static const int HEV1_HASH = HashingUtils::HashString("HEV1");
-        static const int HEV2_HASH = HashingUtils::HashString("HEV2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LC",
+          "HEV1",
+          "HEV2",
+        };
 
         AacCodecProfile GetAacCodecProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LC_HASH)
-          {
-            return AacCodecProfile::LC;
-          }
-          else if (hashCode == HEV1_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AacCodecProfile::HEV1;
-          }
-          else if (hashCode == HEV2_HASH)
-          {
-            return AacCodecProfile::HEV2;
+          case 2423:
+            if (name == "LC")
+            {
+              return AacCodecProfile::LC;
+            }
+            break;
+          case 2213976:
+            if (name == "HEV1")
+            {
+              return AacCodecProfile::HEV1;
+            }
+            break;
+          case 2213977:
+            if (name == "HEV2")
+            {
+              return AacCodecProfile::HEV2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AacCodecProfile::NOT_SET;
         }
 
-        Aws::String GetNameForAacCodecProfile(AacCodecProfile enumValue)
+        const char* GetNameForAacCodecProfileCStr(AacCodecProfile enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AacCodecProfile::LC:
-            return "LC";
-          case AacCodecProfile::HEV1:
-            return "HEV1";
-          case AacCodecProfile::HEV2:
-            return "HEV2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAacCodecProfile(AacCodecProfile enumValue)
+        {
+          return GetNameForAacCodecProfileCStr(enumValue);
         }
 
       } // namespace AacCodecProfileMapper
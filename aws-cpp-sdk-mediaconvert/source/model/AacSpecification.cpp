@@ -30,20 +30,37 @@ namespace Aws
       namespace AacSpecificationMapper
       {
 
-        static const int MPEG2_HASH = HashingUtils::HashString("MPEG2");
-        static const int MPEG4_HASH = HashingUtils::HashString("MPEG4");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MPEG2",
+          "MPEG4",
+        };
 
         AacSpecification GetAacSpecificationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MPEG2_HASH)
-          {
-            return AacSpecification::MPEG2;
-          }
-          else if (hashCode == MPEG4_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AacSpecification::MPEG4;
+          case 73562957:
+            if (name == "MPEG2")
+            {
+              return AacSpecification::MPEG2;
+            }
+            break;
+          case 73562959:
+            if (name == "MPEG4")
+            {
+              return AacSpecification::MPEG4;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AacSpecification::NOT_SET;
         }
 
-        Aws::String GetNameForAacSpecification(AacSpecification enumValue)
+        const char* GetNameForAacSpecificationCStr(AacSpecification enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AacSpecification::MPEG2:
-            return "MPEG2";
-          case AacSpecification::MPEG4:
-            return "MPEG4";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAacSpecification(AacSpecification enumValue)
+        {
+          return GetNameForAacSpecificationCStr(enumValue);
         }
 
       } // namespace AacSpecificationMapper
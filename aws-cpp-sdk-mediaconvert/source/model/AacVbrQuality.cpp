@@ -30,30 +30,51 @@ namespace Aws
       namespace AacVbrQualityMapper
       {
 
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int MEDIUM_LOW_HASH = HashingUtils::HashString("MEDIUM_LOW");
-        static const int MEDIUM_HIGH_HASH = HashingUtils::HashString("MEDIUM_HIGH");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LOW",
+          "MEDIUM_LOW",
+          "MEDIUM_HIGH",
+          "HIGH",
+        };
 
         AacVbrQuality GetAacVbrQualityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LOW_HASH)
-          {
-            return AacVbrQuality::LOW;
-          }
-          else if (hashCode == MEDIUM_LOW_HASH)
-          {
-            return AacVbrQuality::MEDIUM_LOW;
-          }
-          else if (hashCode == MEDIUM_HIGH_HASH)
-          {
-            return AacVbrQuality::MEDIUM_HIGH;
-          }
-          else if (hashCode == HIGH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AacVbrQuality::HIGH;
+          case 75572:
+            if (name == "LOW")
+            {
+              return AacVbrQuality::LOW;
+            }
+            break;
+          case -1284171926:
+            if (name == "MEDIUM_LOW")
+            {
+              return AacVbrQuality::MEDIUM_LOW;
+            }
+            break;
+          case -1154749396:
+            if (name == "MEDIUM_HIGH")
+            {
+              return AacVbrQuality::MEDIUM_HIGH;
+            }
+            break;
+          case 2217378:
+            if (name == "HIGH")
+            {
+              return AacVbrQuality::HIGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AacVbrQuality::NOT_SET;
         }
 
-        Aws::String GetNameForAacVbrQuality(AacVbrQuality enumValue)
+        const char* GetNameForAacVbrQualityCStr(AacVbrQuality enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AacVbrQuality::LOW:
-            return "LOW";
-          case AacVbrQuality::MEDIUM_LOW:
-            return "MEDIUM_LOW";
-          case AacVbrQuality::MEDIUM_HIGH:
-            return "MEDIUM_HIGH";
-          case AacVbrQuality::HIGH:
-            return "HIGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAacVbrQuality(AacVbrQuality enumValue)
+        {
+          return GetNameForAacVbrQualityCStr(enumValue);
         }
 
       } // namespace AacVbrQualityMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace Ac3BitstreamModeMapper
       {
 
-        static const int COMPLETE_MAIN_HASH = HashingUtils::HashString("COMPLETE_MAIN");
-        static const int COMMENTARY_HASH = HashingUtils::HashString("COMMENTARY");
-        static const int DIALOGUE_HASH = HashingUtils::HashString("DIALOGUE");
-        static const int EMERGENCY_HASH = HashingUtils::HashString("EMERGENCY");
-        static const int HEARING_IMPAIRED_HASH = HashingUtils::HashString("HEARING_IMPAIRED");
-        static const int MUSIC_AND_EFFECTS_HASH = HashingUtils::HashString("MUSIC_AND_EFFECTS");
-        static const int VISUALLY_IMPAIRED_HASH = HashingUtils::HashString("VISUALLY_IMPAIRED");
-        static const int VOICE_OVER_HASH = HashingUtils::HashString("VOICE_OVER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COMPLETE_MAIN",
+          "COMMENTARY",
+          "DIALOGUE",
+          "EMERGENCY",
+          "HEARING_IMPAIRED",
+          "MUSIC_AND_EFFECTS",
+          "VISUALLY_IMPAIRED",
+          "VOICE_OVER",
+        };
 
         Ac3BitstreamMode GetAc3BitstreamModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLETE_MAIN_HASH)
-          {
-            return Ac3BitstreamMode::COMPLETE_MAIN;
-          }
-          else if (hashCode == COMMENTARY_HASH)
-          {
-            return Ac3BitstreamMode::COMMENTARY;
-          }
-          else if (hashCode == DIALOGUE_HASH)
-          {
-            return Ac3BitstreamMode::DIALOGUE;
-          }
-          else if (hashCode == EMERGENCY_HASH)
-          {
-            return Ac3BitstreamMode::EMERGENCY;
-          }
-          else if (hashCode == HEARING_IMPAIRED_HASH)
-          {
-            return Ac3BitstreamMode::HEARING_IMPAIRED;
-          }
-          else if (hashCode == MUSIC_AND_EFFECTS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Ac3BitstreamMode::MUSIC_AND_EFFECTS;
-          }
-          else if (hashCode == VISUALLY_IMPAIRED_HASH)
-          {
-            return Ac3BitstreamMode::VISUALLY_IMPAIRED;
-          }
-          else if (hashCode == VOICE_OVER_HASH)
-          {
-            return Ac3BitstreamMode::VOICE_OVER;
+          case -964398849:
+            if (name == "COMPLETE_MAIN")
+            {
+              return Ac3BitstreamMode::COMPLETE_MAIN;
+            }
+            break;
+          case 1384245161:
+            if (name == "COMMENTARY")
+            {
+              return Ac3BitstreamMode::COMMENTARY;
+            }
+            break;
+          case 548784600:
+            if (name == "DIALOGUE")
+            {
+              return Ac3BitstreamMode::DIALOGUE;
+            }
+            break;
+          case 120640881:
+            if (name == "EMERGENCY")
+            {
+              return Ac3BitstreamMode::EMERGENCY;
+            }
+            break;
+          case -767806488:
+            if (name == "HEARING_IMPAIRED")
+            {
+              return Ac3BitstreamMode::HEARING_IMPAIRED;
+            }
+            break;
+          case -490047712:
+            if (name == "MUSIC_AND_EFFECTS")
+            {
+              return Ac3BitstreamMode::MUSIC_AND_EFFECTS;
+            }
+            break;
+          case -1611381169:
+            if (name == "VISUALLY_IMPAIRED")
+            {
+              return Ac3BitstreamMode::VISUALLY_IMPAIRED;
+            }
+            break;
+          case -1000349727:
+            if (name == "VOICE_OVER")
+            {
+              return Ac3BitstreamMode::VOICE_OVER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return Ac3BitstreamMode::NOT_SET;
         }
 
-        Aws::String GetNameForAc3BitstreamMode(Ac3BitstreamMode enumValue)
+        const char* GetNameForAc3BitstreamModeCStr(Ac3BitstreamMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Ac3BitstreamMode::COMPLETE_MAIN:
-            return "COMPLETE_MAIN";
-          case Ac3BitstreamMode::COMMENTARY:
-            return "COMMENTARY";
-          case Ac3BitstreamMode::DIALOGUE:
-            return "DIALOGUE";
-          case Ac3BitstreamMode::EMERGENCY:
-            return "EMERGENCY";
-          case Ac3BitstreamMode::HEARING_IMPAIRED:
-            return "HEARING_IMPAIRED";
-          case Ac3BitstreamMode::MUSIC_AND_EFFECTS:
-            return "MUSIC_AND_EFFECTS";
-          case Ac3BitstreamMode::VISUALLY_IMPAIRED:
-            return "VISUALLY_IMPAIRED";
-          case Ac3BitstreamMode::VOICE_OVER:
-            return "VOICE_OVER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAc3BitstreamMode(Ac3BitstreamMode enumValue)
+        {
+          return GetNameForAc3BitstreamModeCStr(enumValue);
         }
 
       } // namespace Ac3BitstreamModeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace Ac3CodingModeMapper
       {
 
-        static const int CODING_MODE_1_0_HASH = HashingUtils::HashString("CODING_MODE_1_0");
-        static const int CODING_MODE_1_1_HASH = HashingUtils::HashString("CODING_MODE_1_1");
-        static const int CODING_MODE_2_0_HASH = HashingUtils::HashString("CODING_MODE_2_0");
-        static const int CODING_MODE_3_2_LFE_HASH = HashingUtils::HashString("CODING_MODE_3_2_LFE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CODING_MODE_1_0",
+          "CODING_MODE_1_1",
+          "CODING_MODE_2_0",
+          "CODING_MODE_3_2_LFE",
+        };
 
         Ac3CodingMode GetAc3CodingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CODING_MODE_1_0_HASH)
-          {
-            return Ac3CodingMode::CODING_MODE_1_0;
-          }
-          else if (hashCode == CODING_MODE_1_1_HASH)
-          {
-            return Ac3CodingMode::CODING_MODE_1_1;
-          }
-          else if (hashCode == CODING_MODE_2_0_HASH)
-          {
-            return Ac3CodingMode::CODING_MODE_2_0;
-          }
-          else if (hashCode == CODING_MODE_3_2_LFE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Ac3CodingMode::CODING_MODE_3_2_LFE;
+          case -242316229:
+            if (name == "CODING_MODE_1_0")
+            {
+              return Ac3CodingMode::CODING_MODE_1_0;
+            }
+            break;
+          case -242316228:
+            if (name == "CODING_MODE_1_1")
+            {
+              return Ac3CodingMode::CODING_MODE_1_1;
+            }
+            break;
+          case -242315268:
+            if (name == "CODING_MODE_2_0")
+            {
+              return Ac3CodingMode::CODING_MODE_2_0;
+            }
+            break;
+          case -1665338997:
+            if (name == "CODING_MODE_3_2_LFE")
+            {
+              return Ac3CodingMode::CODING_MODE_3_2_LFE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Ac3CodingMode::NOT_SET;
         }
 
-        Aws::String GetNameForAc3CodingMode(Ac3CodingMode enumValue)
+        const char* GetNameForAc3CodingModeCStr(Ac3CodingMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Ac3CodingMode::CODING_MODE_1_0:
-            return "CODING_MODE_1_0";
-          case Ac3CodingMode::CODING_MODE_1_1:
-            return "CODING_MODE_1_1";
-          case Ac3CodingMode::CODING_MODE_2_0:
-            return "CODING_MODE_2_0";
-          case Ac3CodingMode::CODING_MODE_3_2_LFE:
-            return "CODING_MODE_3_2_LFE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAc3CodingMode(Ac3CodingMode enumValue)
+        {
+          return GetNameForAc3CodingModeCStr(enumValue);
         }
 
       } // namespace Ac3CodingModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace Ac3DynamicRangeCompressionProfileMapper
       {
 
-        static const int FILM_STANDARD_HASH = HashingUtils::HashString("FILM_STANDARD");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FILM_STANDARD",
+          "NONE",
+        };
 
         Ac3DynamicRangeCompressionProfile GetAc3DynamicRangeCompressionProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FILM_STANDARD_HASH)
-          {
-            return Ac3DynamicRangeCompressionProfile::FILM_STANDARD;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Ac3DynamicRangeCompressionProfile::NONE;
+          case -1715452136:
+            if (name == "FILM_STANDARD")
+            {
+              return Ac3DynamicRangeCompressionProfile::FILM_STANDARD;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Ac3DynamicRangeCompressionProfile::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Ac3DynamicRangeCompressionProfile::NOT_SET;
         }
 
-        Aws::String GetNameForAc3DynamicRangeCompressionProfile(Ac3DynamicRangeCompressionProfile enumValue)
+        const char* GetNameForAc3DynamicRangeCompressionProfileCStr(Ac3DynamicRangeCompressionProfile enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Ac3DynamicRangeCompressionProfile::FILM_STANDARD:
-            return "FILM_STANDARD";
-          case Ac3DynamicRangeCompressionProfile::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAc3DynamicRangeCompressionProfile(Ac3DynamicRangeCompressionProfile enumValue)
+        {
+          return GetNameForAc3DynamicRangeCompressionProfileCStr(enumValue);
         }
 
       } // namespace Ac3DynamicRangeCompressionProfileMapper
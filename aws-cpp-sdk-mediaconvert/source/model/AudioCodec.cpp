@@ -30,45 +30,72 @@ namespace Aws
       namespace AudioCodecMapper
       {
 
-        static const int AAC_HASH = HashingUtils::HashString("AAC");
-        static const int MP2_HASH = HashingUtils::HashString("MP2");
-        static const int WAV_HASH = HashingUtils::HashString("WAV");
-        static const int AIFF_HASH = HashingUtils::HashString("AIFF");
-        static const int AC3_HASH = HashingUtils::HashString("AC3");
-        static const int EAC3_HASH = HashingUtils::HashString("EAC3");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AAC",
+          "MP2",
+          "WAV",
+          "AIFF",
+          "AC3",
+          "EAC3",
+          "PASSTHROUGH",
+        };
 
         AudioCodec GetAudioCodecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AAC_HASH)
-          {
-            return AudioCodec::AAC;
-          }
-          else if (hashCode == MP2_HASH)
-          {
-            return AudioCodec::MP2;
-          }
-          else if (hashCode == WAV_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AudioCodec::WAV;
-          }
-          else if (hashCode == AIFF_HASH)
-          {
-            return AudioCodec::AIFF;
-          }
-          else if (hashCode == AC3_HASH)
-          {
-            return AudioCodec::AC3;
-          }
-          else if (hashCode == EAC3_HASH)
-          {
-            return AudioCodec::EAC3;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
-          {
-            return AudioCodec::PASSTHROUGH;
+          case 64547:
+            if (name == "AAC")
+            {
+              return AudioCodec::AAC;
+            }
+            break;
+          case 76527:
+            if (name == "MP2")
+            {
+              return AudioCodec::MP2;
+            }
+            break;
+          case 85708:
+            if (name == "WAV")
+            {
+              return AudioCodec::WAV;
+            }
+            break;
+          case 2008808:
+            if (name == "AIFF")
+            {
+              return AudioCodec::AIFF;
+            }
+            break;
+          case 64593:
+            if (name == "AC3")
+            {
+              return AudioCodec::AC3;
+            }
+            break;
+          case 2120172:
+            if (name == "EAC3")
+            {
+              return AudioCodec::EAC3;
+            }
+            break;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return AudioCodec::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return AudioCodec::NOT_SET;
         }
 
-        Aws::String GetNameForAudioCodec(AudioCodec enumValue)
+        const char* GetNameForAudioCodecCStr(AudioCodec enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AudioCodec::AAC:
-            return "AAC";
-          case AudioCodec::MP2:
-            return "MP2";
-          case AudioCodec::WAV:
-            return "WAV";
-          case AudioCodec::AIFF:
-            return "AIFF";
-          case AudioCodec::AC3:
-            return "AC3";
-          case AudioCodec::EAC3:
-            return "EAC3";
-          case AudioCodec::PASSTHROUGH:
-            return "PASSTHROUGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAudioCodec(AudioCodec enumValue)
+        {
+          return GetNameForAudioCodecCStr(enumValue);
         }
 
       } // namespace AudioCodecMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace AudioDefaultSelectionMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int NOT_DEFAULT_HASH = HashingUtils::HashString("NOT_DEFAULT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "NOT_DEFAULT",
+        };
 
         AudioDefaultSelection GetAudioDefaultSelectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return AudioDefaultSelection::DEFAULT;
-          }
-          else if (hashCode == NOT_DEFAULT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AudioDefaultSelection::NOT_DEFAULT;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return AudioDefaultSelection::DEFAULT;
+            }
+            break;
+          case 2050741397:
+            if (name == "NOT_DEFAULT")
+            {
+              return AudioDefaultSelection::NOT_DEFAULT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AudioDefaultSelection::NOT_SET;
         }
 
-        Aws::String GetNameForAudioDefaultSelection(AudioDefaultSelection enumValue)
+        const char* GetNameForAudioDefaultSelectionCStr(AudioDefaultSelection enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AudioDefaultSelection::DEFAULT:
-            return "DEFAULT";
-          case AudioDefaultSelection::NOT_DEFAULT:
-            return "NOT_DEFAULT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAudioDefaultSelection(AudioDefaultSelection enumValue)
+        {
+          return GetNameForAudioDefaultSelectionCStr(enumValue);
         }
 
       } // namespace AudioDefaultSelectionMapper
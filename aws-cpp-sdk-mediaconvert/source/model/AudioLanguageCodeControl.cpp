@@ -30,20 +30,37 @@ namespace Aws
       namespace AudioLanguageCodeControlMapper
       {
 
-        static const int FOLLOW_INPUT_HASH = HashingUtils::HashString("FOLLOW_INPUT");
-        static const int USE_CONFIGURED_HASH = HashingUtils::HashString("USE_CONFIGURED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FOLLOW_INPUT",
+          "USE_CONFIGURED",
+        };
 
         AudioLanguageCodeControl GetAudioLanguageCodeControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_INPUT_HASH)
-          {
-            return AudioLanguageCodeControl::FOLLOW_INPUT;
-          }
-          else if (hashCode == USE_CONFIGURED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AudioLanguageCodeControl::USE_CONFIGURED;
+          case 1178970524:
+            if (name == "FOLLOW_INPUT")
+            {
+              return AudioLanguageCodeControl::FOLLOW_INPUT;
+            }
+            break;
+          case -177742826:
+            if (name == "USE_CONFIGURED")
+            {
+              return AudioLanguageCodeControl::USE_CONFIGURED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AudioLanguageCodeControl::NOT_SET;
         }
 
-        Aws::String GetNameForAudioLanguageCodeControl(AudioLanguageCodeControl enumValue)
+        const char* GetNameForAudioLanguageCodeControlCStr(AudioLanguageCodeControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AudioLanguageCodeControl::FOLLOW_INPUT:
-            return "FOLLOW_INPUT";
-          case AudioLanguageCodeControl::USE_CONFIGURED:
-            return "USE_CONFIGURED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAudioLanguageCodeControl(AudioLanguageCodeControl enumValue)
+        {
+          return GetNameForAudioLanguageCodeControlCStr(enumValue);
         }
 
       } // namespace AudioLanguageCodeControlMapper
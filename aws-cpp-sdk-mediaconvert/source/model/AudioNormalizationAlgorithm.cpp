@@ -30,20 +30,37 @@ namespace Aws
       namespace AudioNormalizationAlgorithmMapper
       {
 
-        static const int ITU_BS_1770_1_HASH = HashingUtils::HashString("ITU_BS_1770_1");
-        static const int ITU_BS_1770_2_HASH = HashingUtils::HashString("ITU_BS_1770_2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ITU_BS_1770_1",
+          "ITU_BS_1770_2",
+        };
 
         AudioNormalizationAlgorithm GetAudioNormalizationAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ITU_BS_1770_1_HASH)
-          {
-            return AudioNormalizationAlgorithm::ITU_BS_1770_1;
-          }
-          else if (hashCode == ITU_BS_1770_2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AudioNormalizationAlgorithm::ITU_BS_1770_2;
+          case -2136220246:
+            if (name == "ITU_BS_1770_1")
+            {
+              return AudioNormalizationAlgorithm::ITU_BS_1770_1;
+            }
+            break;
+          case -2136220245:
+            if (name == "ITU_BS_1770_2")
+            {
+              return AudioNormalizationAlgorithm::ITU_BS_1770_2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AudioNormalizationAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForAudioNormalizationAlgorithm(AudioNormalizationAlgorithm enumValue)
+        const char* GetNameForAudioNormalizationAlgorithmCStr(AudioNormalizationAlgorithm enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AudioNormalizationAlgorithm::ITU_BS_1770_1:
-            return "ITU_BS_1770_1";
-          case AudioNormalizationAlgorithm::ITU_BS_1770_2:
-            return "ITU_BS_1770_2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAudioNormalizationAlgorithm(AudioNormalizationAlgorithm enumValue)
+        {
+          return GetNameForAudioNormalizationAlgorithmCStr(enumValue);
         }
 
       } // namespace AudioNormalizationAlgorithmMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace AudioNormalizationAlgorithmControlMapper
       {
 
-        static const int CORRECT_AUDIO_HASH = HashingUtils::HashString("CORRECT_AUDIO");
-        static const int MEASURE_ONLY_HASH = HashingUtils::HashString("MEASURE_ONLY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CORRECT_AUDIO",
+          "MEASURE_ONLY",
+        };
 
         AudioNormalizationAlgorithmControl GetAudioNormalizationAlgorithmControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CORRECT_AUDIO_HASH)
-          {
-            return AudioNormalizationAlgorithmControl::CORRECT_AUDIO;
-          }
-          else if (hashCode == MEASURE_ONLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AudioNormalizationAlgorithmControl::MEASURE_ONLY;
+          case -458728575:
+            if (name == "CORRECT_AUDIO")
+            {
+              return AudioNormalizationAlgorithmControl::CORRECT_AUDIO;
+            }
+            break;
+          case 1971959309:
+            if (name == "MEASURE_ONLY")
+            {
+              return AudioNormalizationAlgorithmControl::MEASURE_ONLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AudioNormalizationAlgorithmControl::NOT_SET;
         }
 
-        Aws::String GetNameForAudioNormalizationAlgorithmControl(AudioNormalizationAlgorithmControl enumValue)
+        const char* GetNameForAudioNormalizationAlgorithmControlCStr(AudioNormalizationAlgorithmControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AudioNormalizationAlgorithmControl::CORRECT_AUDIO:
-            return "CORRECT_AUDIO";
-          case AudioNormalizationAlgorithmControl::MEASURE_ONLY:
-            return "MEASURE_ONLY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAudioNormalizationAlgorithmControl(AudioNormalizationAlgorithmControl enumValue)
+        {
+          return GetNameForAudioNormalizationAlgorithmControlCStr(enumValue);
         }
 
       } // namespace AudioNormalizationAlgorithmControlMapper
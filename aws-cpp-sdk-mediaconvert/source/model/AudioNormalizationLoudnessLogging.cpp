@@ -30,20 +30,37 @@ namespace Aws
       namespace AudioNormalizationLoudnessLoggingMapper
       {
 
-        static const int LOG_HASH = HashingUtils::HashString("LOG");
-        static const int DONT_LOG_HASH = HashingUtils::HashString("DONT_LOG");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LOG",
+          "DONT_LOG",
+        };
 
         AudioNormalizationLoudnessLogging GetAudioNormalizationLoudnessLoggingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LOG_HASH)
-          {
-            return AudioNormalizationLoudnessLogging::LOG;
-          }
-          else if (hashCode == DONT_LOG_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AudioNormalizationLoudnessLogging::DONT_LOG;
+          case 75556:
+            if (name == "LOG")
+            {
+              return AudioNormalizationLoudnessLogging::LOG;
+            }
+            break;
+          case 1958887798:
+            if (name == "DONT_LOG")
+            {
+              return AudioNormalizationLoudnessLogging::DONT_LOG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AudioNormalizationLoudnessLogging::NOT_SET;
         }
 
-        Aws::String GetNameForAudioNormalizationLoudnessLogging(AudioNormalizationLoudnessLogging enumValue)
+        const char* GetNameForAudioNormalizationLoudnessLoggingCStr(AudioNormalizationLoudnessLogging enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AudioNormalizationLoudnessLogging::LOG:
-            return "LOG";
-          case AudioNormalizationLoudnessLogging::DONT_LOG:
-            return "DONT_LOG";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAudioNormalizationLoudnessLogging(AudioNormalizationLoudnessLogging enumValue)
+        {
+          return GetNameForAudioNormalizationLoudnessLoggingCStr(enumValue);
         }
 
       } // namespace AudioNormalizationLoudnessLoggingMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace AudioNormalizationPeakCalculationMapper
       {
 
-        static const int TRUE_PEAK_HASH = HashingUtils::HashString("TRUE_PEAK");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TRUE_PEAK",
+          "NONE",
+        };
 
         AudioNormalizationPeakCalculation GetAudioNormalizationPeakCalculationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRUE_PEAK_HASH)
-          {
-            return AudioNormalizationPeakCalculation::TRUE_PEAK;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AudioNormalizationPeakCalculation::NONE;
+          case -131793680:
+            if (name == "TRUE_PEAK")
+            {
+              return AudioNormalizationPeakCalculation::TRUE_PEAK;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return AudioNormalizationPeakCalculation::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AudioNormalizationPeakCalculation::NOT_SET;
         }
 
-        Aws::String GetNameForAudioNormalizationPeakCalculation(AudioNormalizationPeakCalculation enumValue)
+        const char* GetNameForAudioNormalizationPeakCalculationCStr(AudioNormalizationPeakCalculation enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AudioNormalizationPeakCalculation::TRUE_PEAK:
-            return "TRUE_PEAK";
-          case AudioNormalizationPeakCalculation::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAudioNormalizationPeakCalculation(AudioNormalizationPeakCalculation enumValue)
+        {
+          return GetNameForAudioNormalizationPeakCalculationCStr(enumValue);
         }
 
       } // namespace AudioNormalizationPeakCalculationMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AudioSelectorTypeMapper
       {
 
-        static const int PID_HASH = HashingUtils::HashString("PID");
-        static const int TRACK_HASH = HashingUtils::HashString("TRACK");
-        static const int LANGUAGE_CODE_HASH = HashingUtils::HashString("LANGUAGE_CODE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PID",
+          "TRACK",
+          "LANGUAGE_CODE",
+        };
 
         AudioSelectorType GetAudioSelectorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PID_HASH)
-          {
-            return AudioSelectorType::PID;
-          }
-          else if (hashCode == TRACK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AudioSelectorType::TRACK;
-          }
-          else if (hashCode == LANGUAGE_CODE_HASH)
-          {
-            return AudioSelectorType::LANGUAGE_CODE;
+          case 79211:
+            if (name == "PID")
+            {
+              return AudioSelectorType::PID;
+            }
+            break;
+          case 80083243:
+            if (name == "TRACK")
+            {
+              return AudioSelectorType::TRACK;
+            }
+            break;
+          case -1561972108:
+            if (name == "LANGUAGE_CODE")
+            {
+              return AudioSelectorType::LANGUAGE_CODE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AudioSelectorType::NOT_SET;
         }
 
-        Aws::String GetNameForAudioSelectorType(AudioSelectorType enumValue)
+        const char* GetNameForAudioSelectorTypeCStr(AudioSelectorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AudioSelectorType::PID:
-            return "PID";
-          case AudioSelectorType::TRACK:
-            return "TRACK";
-          case AudioSelectorType::LANGUAGE_CODE:
-            return "LANGUAGE_CODE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAudioSelectorType(AudioSelectorType enumValue)
+        {
+          return GetNameForAudioSelectorTypeCStr(enumValue);
         }
 
       } // namespace AudioSelectorTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace BillingTagsSourceMapper
       {
 
-        static const int QUEUE_HASH = HashingUtils::HashString("QUEUE");
-        static const int PRESET_HASH = HashingUtils::HashString("PRESET");
-        static const int JOB_TEMPLATE_HASH = HashingUtils::HashString("JOB_TEMPLATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "QUEUE",
+          "PRESET",
+          "JOB_TEMPLATE",
+        };
 
         BillingTagsSource GetBillingTagsSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == QUEUE_HASH)
-          {
-            return BillingTagsSource::QUEUE;
-          }
-          else if (hashCode == PRESET_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BillingTagsSource::PRESET;
-          }
-          else if (hashCode == JOB_TEMPLATE_HASH)
-          {
-            return BillingTagsSource::JOB_TEMPLATE;
+          case 77406449:
+            if (name == "QUEUE")
+            {
+              return BillingTagsSource::QUEUE;
+            }
+            break;
+          case -1926768929:
+            if (name == "PRESET")
+            {
+              return BillingTagsSource::PRESET;
+            }
+            break;
+          case 203558620:
+            if (name == "JOB_TEMPLATE")
+            {
+              return BillingTagsSource::JOB_TEMPLATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return BillingTagsSource::NOT_SET;
         }
 
-        Aws::String GetNameForBillingTagsSource(BillingTagsSource enumValue)
+        const char* GetNameForBillingTagsSourceCStr(BillingTagsSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BillingTagsSource::QUEUE:
-            return "QUEUE";
-          case BillingTagsSource::PRESET:
-            return "PRESET";
-          case BillingTagsSource::JOB_TEMPLATE:
-            return "JOB_TEMPLATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBillingTagsSource(BillingTagsSource enumValue)
+        {
+          return GetNameForBillingTagsSourceCStr(enumValue);
         }
 
       } // namespace BillingTagsSourceMapper
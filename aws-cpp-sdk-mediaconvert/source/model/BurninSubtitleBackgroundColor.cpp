@@ -30,25 +30,44 @@ namespace Aws
       namespace BurninSubtitleBackgroundColorMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "BLACK",
+          "WHITE",
+        };
 
         BurninSubtitleBackgroundColor GetBurninSubtitleBackgroundColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return BurninSubtitleBackgroundColor::NONE;
-          }
-          else if (hashCode == BLACK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BurninSubtitleBackgroundColor::BLACK;
-          }
-          else if (hashCode == WHITE_HASH)
-          {
-            return BurninSubtitleBackgroundColor::WHITE;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return BurninSubtitleBackgroundColor::NONE;
+            }
+            break;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return BurninSubtitleBackgroundColor::BLACK;
+            }
+            break;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return BurninSubtitleBackgroundColor::WHITE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return BurninSubtitleBackgroundColor::NOT_SET;
         }
 
-        Aws::String GetNameForBurninSubtitleBackgroundColor(BurninSubtitleBackgroundColor enumValue)
+        const char* GetNameForBurninSubtitleBackgroundColorCStr(BurninSubtitleBackgroundColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BurninSubtitleBackgroundColor::NONE:
-            return "NONE";
-          case BurninSubtitleBackgroundColor::BLACK:
-            return "BLACK";
-          case BurninSubtitleBackgroundColor::WHITE:
-            return "WHITE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBurninSubtitleBackgroundColor(BurninSubtitleBackgroundColor enumValue)
+        {
+          return GetNameForBurninSubtitleBackgroundColorCStr(enumValue);
         }
 
       } // namespace BurninSubtitleBackgroundColorMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace BurninSubtitleFontColorMapper
       {
 
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int YELLOW_HASH = HashingUtils::HashString("YELLOW");
-        static const int RED_HASH = HashingUtils::HashString("RED");
-        static const int GREEN_HASH = HashingUtils::HashString("GREEN");
-        static const int BLUE_HASH = HashingUtils::HashString("BLUE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WHITE",
+          "BLACK",
+          "YELLOW",
+          "RED",
+          "GREEN",
+          "BLUE",
+        };
 
         BurninSubtitleFontColor GetBurninSubtitleFontColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WHITE_HASH)
-          {
-            return BurninSubtitleFontColor::WHITE;
-          }
-          else if (hashCode == BLACK_HASH)
-          {
-            return BurninSubtitleFontColor::BLACK;
-          }
-          else if (hashCode == YELLOW_HASH)
-          {
-            return BurninSubtitleFontColor::YELLOW;
-          }
-          else if (hashCode == RED_HASH)
-          {
-            return BurninSubtitleFontColor::RED;
-          }
-          else if (hashCode == GREEN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BurninSubtitleFontColor::GREEN;
-          }
-          else if (hashCode == BLUE_HASH)
-          {
-            return BurninSubtitleFontColor::BLUE;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return BurninSubtitleFontColor::WHITE;
+            }
+            break;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return BurninSubtitleFontColor::BLACK;
+            }
+            break;
+          case -1680910220:
+            if (name == "YELLOW")
+            {
+              return BurninSubtitleFontColor::YELLOW;
+            }
+            break;
+          case 81009:
+            if (name == "RED")
+            {
+              return BurninSubtitleFontColor::RED;
+            }
+            break;
+          case 68081379:
+            if (name == "GREEN")
+            {
+              return BurninSubtitleFontColor::GREEN;
+            }
+            break;
+          case 2041946:
+            if (name == "BLUE")
+            {
+              return BurninSubtitleFontColor::BLUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return BurninSubtitleFontColor::NOT_SET;
         }
 
-        Aws::String GetNameForBurninSubtitleFontColor(BurninSubtitleFontColor enumValue)
+        const char* GetNameForBurninSubtitleFontColorCStr(BurninSubtitleFontColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BurninSubtitleFontColor::WHITE:
-            return "WHITE";
-          case BurninSubtitleFontColor::BLACK:
-            return "BLACK";
-          case BurninSubtitleFontColor::YELLOW:
-            return "YELLOW";
-          case BurninSubtitleFontColor::RED:
-            return "RED";
-          case BurninSubtitleFontColor::GREEN:
-            return "GREEN";
-          case BurninSubtitleFontColor::BLUE:
-            return "BLUE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBurninSubtitleFontColor(BurninSubtitleFontColor enumValue)
+        {
+          return GetNameForBurninSubtitleFontColorCStr(enumValue);
         }
 
       } // namespace BurninSubtitleFontColorMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace BurninSubtitleOutlineColorMapper
       {
 
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-        static const int YELLOW_HASH = HashingUtils::HashString("YELLOW");
-        static const int RED_HASH = HashingUtils::HashString("RED");
-        static const int GREEN_HASH = HashingUtils::HashString("GREEN");
-        static const int BLUE_HASH = HashingUtils::HashString("BLUE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLACK",
+          "WHITE",
+          "YELLOW",
+          "RED",
+          "GREEN",
+          "BLUE",
+        };
 
         BurninSubtitleOutlineColor GetBurninSubtitleOutlineColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLACK_HASH)
-          {
-            return BurninSubtitleOutlineColor::BLACK;
-          }
-          else if (hashCode == WHITE_HASH)
-          {
-            return BurninSubtitleOutlineColor::WHITE;
-          }
-          else if (hashCode == YELLOW_HASH)
-          {
-            return BurninSubtitleOutlineColor::YELLOW;
-          }
-          else if (hashCode == RED_HASH)
-          {
-            return BurninSubtitleOutlineColor::RED;
-          }
-          else if (hashCode == GREEN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BurninSubtitleOutlineColor::GREEN;
-          }
-          else if (hashCode == BLUE_HASH)
-          {
-            return BurninSubtitleOutlineColor::BLUE;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return BurninSubtitleOutlineColor::BLACK;
+            }
+            break;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return BurninSubtitleOutlineColor::WHITE;
+            }
+            break;
+          case -1680910220:
+            if (name == "YELLOW")
+            {
+              return BurninSubtitleOutlineColor::YELLOW;
+            }
+            break;
+          case 81009:
+            if (name == "RED")
+            {
+              return BurninSubtitleOutlineColor::RED;
+            }
+            break;
+          case 68081379:
+            if (name == "GREEN")
+            {
+              return BurninSubtitleOutlineColor::GREEN;
+            }
+            break;
+          case 2041946:
+            if (name == "BLUE")
+            {
+              return BurninSubtitleOutlineColor::BLUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return BurninSubtitleOutlineColor::NOT_SET;
         }
 
-        Aws::String GetNameForBurninSubtitleOutlineColor(BurninSubtitleOutlineColor enumValue)
+        const char* GetNameForBurninSubtitleOutlineColorCStr(BurninSubtitleOutlineColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BurninSubtitleOutlineColor::BLACK:
-            return "BLACK";
-          case BurninSubtitleOutlineColor::WHITE:
-            return "WHITE";
-          case BurninSubtitleOutlineColor::YELLOW:
-            return "YELLOW";
-          case BurninSubtitleOutlineColor::RED:
-            return "RED";
-          case BurninSubtitleOutlineColor::GREEN:
-            return "GREEN";
-          case BurninSubtitleOutlineColor::BLUE:
-            return "BLUE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBurninSubtitleOutlineColor(BurninSubtitleOutlineColor enumValue)
+        {
+          return GetNameForBurninSubtitleOutlineColorCStr(enumValue);
         }
 
       } // namespace BurninSubtitleOutlineColorMapper
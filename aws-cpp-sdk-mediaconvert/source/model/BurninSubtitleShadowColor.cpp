@@ -30,25 +30,44 @@ namespace Aws
       namespace BurninSubtitleShadowColorMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "BLACK",
+          "WHITE",
+        };
 
         BurninSubtitleShadowColor GetBurninSubtitleShadowColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return BurninSubtitleShadowColor::NONE;
-          }
-          else if (hashCode == BLACK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BurninSubtitleShadowColor::BLACK;
-          }
-          else if (hashCode == WHITE_HASH)
-          {
-            return BurninSubtitleShadowColor::WHITE;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return BurninSubtitleShadowColor::NONE;
+            }
+            break;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return BurninSubtitleShadowColor::BLACK;
+            }
+            break;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return BurninSubtitleShadowColor::WHITE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return BurninSubtitleShadowColor::NOT_SET;
         }
 
-        Aws::String GetNameForBurninSubtitleShadowColor(BurninSubtitleShadowColor enumValue)
+        const char* GetNameForBurninSubtitleShadowColorCStr(BurninSubtitleShadowColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BurninSubtitleShadowColor::NONE:
-            return "NONE";
-          case BurninSubtitleShadowColor::BLACK:
-            return "BLACK";
-          case BurninSubtitleShadowColor::WHITE:
-            return "WHITE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBurninSubtitleShadowColor(BurninSubtitleShadowColor enumValue)
+        {
+          return GetNameForBurninSubtitleShadowColorCStr(enumValue);
         }
 
       } // namespace BurninSubtitleShadowColorMapper
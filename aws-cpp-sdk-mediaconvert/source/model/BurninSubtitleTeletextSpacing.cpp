@@ -30,20 +30,37 @@ namespace Aws
       namespace BurninSubtitleTeletextSpacingMapper
       {
 
-        static const int FIXED_GRID_HASH = HashingUtils::HashString("FIXED_GRID");
-        static const int PROPORTIONAL_HASH = HashingUtils::HashString("PROPORTIONAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FIXED_GRID",
+          "PROPORTIONAL",
+        };
 
         BurninSubtitleTeletextSpacing GetBurninSubtitleTeletextSpacingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FIXED_GRID_HASH)
-          {
-            return BurninSubtitleTeletextSpacing::FIXED_GRID;
-          }
-          else if (hashCode == PROPORTIONAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BurninSubtitleTeletextSpacing::PROPORTIONAL;
+          case -2072788655:
+            if (name == "FIXED_GRID")
+            {
+              return BurninSubtitleTeletextSpacing::FIXED_GRID;
+            }
+            break;
+          case 1687042629:
+            if (name == "PROPORTIONAL")
+            {
+              return BurninSubtitleTeletextSpacing::PROPORTIONAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BurninSubtitleTeletextSpacing::NOT_SET;
         }
 
-        Aws::String GetNameForBurninSubtitleTeletextSpacing(BurninSubtitleTeletextSpacing enumValue)
+        const char* GetNameForBurninSubtitleTeletextSpacingCStr(BurninSubtitleTeletextSpacing enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BurninSubtitleTeletextSpacing::FIXED_GRID:
-            return "FIXED_GRID";
-          case BurninSubtitleTeletextSpacing::PROPORTIONAL:
-            return "PROPORTIONAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBurninSubtitleTeletextSpacing(BurninSubtitleTeletextSpacing enumValue)
+        {
+          return GetNameForBurninSubtitleTeletextSpacingCStr(enumValue);
         }
 
       } // namespace BurninSubtitleTeletextSpacingMapper
@@ -30,65 +30,100 @@ namespace Aws
       namespace CaptionDestinationTypeMapper
       {
 
-        static const int BURN_IN_HASH = HashingUtils::HashString("BURN_IN");
-        static const int DVB_SUB_HASH = HashingUtils::HashString("DVB_SUB");
-        static const int EMBEDDED_HASH = HashingUtils::HashString("EMBEDDED");
-        static const int EMBEDDED_PLUS_SCTE20_HASH = HashingUtils::HashString("EMBEDDED_PLUS_SCTE20");
-        static const int SCTE20_PLUS_EMBEDDED_HASH = HashingUtils::HashString("SCTE20_PLUS_EMBEDDED");
-        static const int SCC_HASH = HashingUtils::HashString("SCC");
-        static const int SRT_HASH = HashingUtils::HashString("SRT");
-        static const int SMI_HASH = HashingUtils::HashString("SMI");
-        static const int TELETEXT_HASH = HashingUtils::HashString("TELETEXT");
-        static const int TTML_HASH = HashingUtils::HashString("TTML");
-        static const int WEBVTT_HASH = HashingUtils::HashString("WEBVTT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BURN_IN",
+          "DVB_SUB",
+          "EMBEDDED",
+          "EMBEDDED_PLUS_SCTE20",
+          "SCTE20_PLUS_EMBEDDED",
+          "SCC",
+          "SRT",
+          "SMI",
+          "TELETEXT",
+          "TTML",
+          "WEBVTT",
+        };
 
         CaptionDestinationType GetCaptionDestinationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BURN_IN_HASH)
-          {
-            return CaptionDestinationType::BURN_IN;
-          }
-          else if (hashCode == DVB_SUB_HASH)
-          {
-            return CaptionDestinationType::DVB_SUB;
-          }
-          else if (hashCode == EMBEDDED_HASH)
-          {
-            return CaptionDestinationType::EMBEDDED;
-          }
-          else if (hashCode == EMBEDDED_PLUS_SCTE20_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CaptionDestinationType::EMBEDDED_PLUS_SCTE20;
-          }
-          else if (hashCode == SCTE20_PLUS_EMBEDDED_HASH)
-          {
-            return CaptionDestinationType::SCTE20_PLUS_EMBEDDED;
-          }
-          else if (hashCode == SCC_HASH)
-          {
-            return CaptionDestinationType::SCC;
-          }
-          else if (hashCode == SRT_HASH)
-          {
-            return CaptionDestinationType::SRT;
-          }
-          else if (hashCode == SMI_HASH)
-          {
-            return CaptionDestinationType::SMI;
-          }
-          else if (hashCode == TELETEXT_HASH)
-          {
-            return CaptionDestinationType::TELETEXT;
-          }
-          else if (hashCode == TTML_HASH)
-          {
-            return CaptionDestinationType::TTML;
-          }
-          else if (hashCode == WEBVTT_HASH)
-          {
-            return CaptionDestinationType::WEBVTT;
+          case 957324693:
+            if (name == "BURN_IN")
+            {
+              return CaptionDestinationType::BURN_IN;
+            }
+            break;
+          case -1548287151:
+            if (name == "DVB_SUB")
+            {
+              return CaptionDestinationType::DVB_SUB;
+            }
+            break;
+          case 1568475786:
+            if (name == "EMBEDDED")
+            {
+              return CaptionDestinationType::EMBEDDED;
+            }
+            break;
+          case -1095410993:
+            if (name == "EMBEDDED_PLUS_SCTE20")
+            {
+              return CaptionDestinationType::EMBEDDED_PLUS_SCTE20;
+            }
+            break;
+          case -1141467633:
+            if (name == "SCTE20_PLUS_EMBEDDED")
+            {
+              return CaptionDestinationType::SCTE20_PLUS_EMBEDDED;
+            }
+            break;
+          case 81907:
+            if (name == "SCC")
+            {
+              return CaptionDestinationType::SCC;
+            }
+            break;
+          case 82389:
+            if (name == "SRT")
+            {
+              return CaptionDestinationType::SRT;
+            }
+            break;
+          case 82223:
+            if (name == "SMI")
+            {
+              return CaptionDestinationType::SMI;
+            }
+            break;
+          case -577465385:
+            if (name == "TELETEXT")
+            {
+              return CaptionDestinationType::TELETEXT;
+            }
+            break;
+          case 2585631:
+            if (name == "TTML")
+            {
+              return CaptionDestinationType::TTML;
+            }
+            break;
+          case -1738456670:
+            if (name == "WEBVTT")
+            {
+              return CaptionDestinationType::WEBVTT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return CaptionDestinationType::NOT_SET;
         }
 
-        Aws::String GetNameForCaptionDestinationType(CaptionDestinationType enumValue)
+        const char* GetNameForCaptionDestinationTypeCStr(CaptionDestinationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CaptionDestinationType::BURN_IN:
-            return "BURN_IN";
-          case CaptionDestinationType::DVB_SUB:
-            return "DVB_SUB";
-          case CaptionDestinationType::EMBEDDED:
-            return "EMBEDDED";
-          case CaptionDestinationType::EMBEDDED_PLUS_SCTE20:
-            return "EMBEDDED_PLUS_SCTE20";
-          case CaptionDestinationType::SCTE20_PLUS_EMBEDDED:
-            return "SCTE20_PLUS_EMBEDDED";
-          case CaptionDestinationType::SCC:
-            return "SCC";
-          case CaptionDestinationType::SRT:
-            return "SRT";
-          case CaptionDestinationType::SMI:
-            return "SMI";
-          case CaptionDestinationType::TELETEXT:
-            return "TELETEXT";
-          case CaptionDestinationType::TTML:
-            return "TTML";
-          case CaptionDestinationType::WEBVTT:
-            return "WEBVTT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCaptionDestinationType(CaptionDestinationType enumValue)
+        {
+          return GetNameForCaptionDestinationTypeCStr(enumValue);
         }
 
       } // namespace CaptionDestinationTypeMapper
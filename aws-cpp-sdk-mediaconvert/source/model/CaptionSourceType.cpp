@@ -30,65 +30,100 @@ namespace Aws
       namespace CaptionSourceTypeMapper
       {
 
-        static const int ANCILLARY_HASH = HashingUtils::HashString("ANCILLARY");
-        static const int DVB_SUB_HASH = HashingUtils::HashString("DVB_SUB");
-        static const int EMBEDDED_HASH = HashingUtils::HashString("EMBEDDED");
-        static const int SCTE20_HASH = HashingUtils::HashString("SCTE20");
-        static const int SCC_HASH = HashingUtils::HashString("SCC");
-        static const int TTML_HASH = HashingUtils::HashString("TTML");
-        static const int STL_HASH = HashingUtils::HashString("STL");
-        static const int SRT_HASH = HashingUtils::HashString("SRT");
-        static const int SMI_HASH = HashingUtils::HashString("SMI");
-        static const int TELETEXT_HASH = HashingUtils::HashString("TELETEXT");
-        static const int NULL_SOURCE_HASH = HashingUtils::HashString("NULL_SOURCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ANCILLARY",
+          "DVB_SUB",
+          "EMBEDDED",
+          "SCTE20",
+          "SCC",
+          "TTML",
+          "STL",
+          "SRT",
+          "SMI",
+          "TELETEXT",
+          "NULL_SOURCE",
+        };
 
         CaptionSourceType GetCaptionSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ANCILLARY_HASH)
-          {
-            return CaptionSourceType::ANCILLARY;
-          }
-          else if (hashCode == DVB_SUB_HASH)
-          {
-            return CaptionSourceType::DVB_SUB;
-          }
-          else if (hashCode == EMBEDDED_HASH)
-          {
-            return CaptionSourceType::EMBEDDED;
-          }
-          else if (hashCode == SCTE20_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CaptionSourceType::SCTE20;
-          }
-          else if (hashCode == SCC_HASH)
-          {
-            return CaptionSourceType::SCC;
-          }
-          else if (hashCode == TTML_HASH)
-          {
-            return CaptionSourceType::TTML;
-          }
-          else if (hashCode == STL_HASH)
-          {
-            return CaptionSourceType::STL;
-          }
-          else if (hashCode == SRT_HASH)
-          {
-            return CaptionSourceType::SRT;
-          }
-          else if (hashCode == SMI_HASH)
-          {
-            return CaptionSourceType::SMI;
-          }
-          else if (hashCode == TELETEXT_HASH)
-          {
-            return CaptionSourceType::TELETEXT;
-          }
-          else if (hashCode == NULL_SOURCE_HASH)
-          {
-            return CaptionSourceType::NULL_SOURCE;
+          case -1524521131:
+            if (name == "ANCILLARY")
+            {
+              return CaptionSourceType::ANCILLARY;
+            }
+            break;
+          case -1548287151:
+            if (name == "DVB_SUB")
+            {
+              return CaptionSourceType::DVB_SUB;
+            }
+            break;
+          case 1568475786:
+            if (name == "EMBEDDED")
+            {
+              return CaptionSourceType::EMBEDDED;
+            }
+            break;
+          case -1854301505:
+            if (name == "SCTE20")
+            {
+              return CaptionSourceType::SCTE20;
+            }
+            break;
+          case 81907:
+            if (name == "SCC")
+            {
+              return CaptionSourceType::SCC;
+            }
+            break;
+          case 2585631:
+            if (name == "TTML")
+            {
+              return CaptionSourceType::TTML;
+            }
+            break;
+          case 82443:
+            if (name == "STL")
+            {
+              return CaptionSourceType::STL;
+            }
+            break;
+          case 82389:
+            if (name == "SRT")
+            {
+              return CaptionSourceType::SRT;
+            }
+            break;
+          case 82223:
+            if (name == "SMI")
+            {
+              return CaptionSourceType::SMI;
+            }
+            break;
+          case -577465385:
+            if (name == "TELETEXT")
+            {
+              return CaptionSourceType::TELETEXT;
+            }
+            break;
+          case -1999723053:
+            if (name == "NULL_SOURCE")
+            {
+              return CaptionSourceType::NULL_SOURCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return CaptionSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForCaptionSourceType(CaptionSourceType enumValue)
+        const char* GetNameForCaptionSourceTypeCStr(CaptionSourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CaptionSourceType::ANCILLARY:
-            return "ANCILLARY";
-          case CaptionSourceType::DVB_SUB:
-            return "DVB_SUB";
-          case CaptionSourceType::EMBEDDED:
-            return "EMBEDDED";
-          case CaptionSourceType::SCTE20:
-            return "SCTE20";
-          case CaptionSourceType::SCC:
-            return "SCC";
-          case CaptionSourceType::TTML:
-            return "TTML";
-          case CaptionSourceType::STL:
-            return "STL";
-          case CaptionSourceType::SRT:
-            return "SRT";
-          case CaptionSourceType::SMI:
-            return "SMI";
-          case CaptionSourceType::TELETEXT:
-            return "TELETEXT";
-          case CaptionSourceType::NULL_SOURCE:
-            return "NULL_SOURCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCaptionSourceType(CaptionSourceType enumValue)
+        {
+          return GetNameForCaptionSourceTypeCStr(enumValue);
         }
 
       } // namespace CaptionSourceTypeMapper
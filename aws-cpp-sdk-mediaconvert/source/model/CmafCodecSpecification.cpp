@@ -30,20 +30,37 @@ namespace Aws
       namespace CmafCodecSpecificationMapper
       {
 
-        static const int RFC_6381_HASH = HashingUtils::HashString("RFC_6381");
-        static const int RFC_4281_HASH = HashingUtils::HashString("RFC_4281");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RFC_6381",
+          "RFC_4281",
+        };
 
         CmafCodecSpecification GetCmafCodecSpecificationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RFC_6381_HASH)
-          {
-            return CmafCodecSpecification::RFC_6381;
-          }
-          else if (hashCode == RFC_4281_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CmafCodecSpecification::RFC_4281;
+          case 884822054:
+            if (name == "RFC_6381")
+            {
+              return CmafCodecSpecification::RFC_6381;
+            }
+            break;
+          case 884761511:
+            if (name == "RFC_4281")
+            {
+              return CmafCodecSpecification::RFC_4281;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CmafCodecSpecification::NOT_SET;
         }
 
-        Aws::String GetNameForCmafCodecSpecification(CmafCodecSpecification enumValue)
+        const char* GetNameForCmafCodecSpecificationCStr(CmafCodecSpecification enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CmafCodecSpecification::RFC_6381:
-            return "RFC_6381";
-          case CmafCodecSpecification::RFC_4281:
-            return "RFC_4281";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCmafCodecSpecification(CmafCodecSpecification enumValue)
+        {
+          return GetNameForCmafCodecSpecificationCStr(enumValue);
         }
 
       } // namespace CmafCodecSpecificationMapper
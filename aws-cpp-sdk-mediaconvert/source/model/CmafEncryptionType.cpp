@@ -30,15 +30,30 @@ namespace Aws
       namespace CmafEncryptionTypeMapper
       {
 
-        static const int SAMPLE_AES_HASH = HashingUtils::HashString("SAMPLE_AES");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SAMPLE_AES",
+        };
 
         CmafEncryptionType GetCmafEncryptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SAMPLE_AES_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CmafEncryptionType::SAMPLE_AES;
+          case 629518490:
+            if (name == "SAMPLE_AES")
+            {
+              return CmafEncryptionType::SAMPLE_AES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return CmafEncryptionType::NOT_SET;
         }
 
-        Aws::String GetNameForCmafEncryptionType(CmafEncryptionType enumValue)
+        const char* GetNameForCmafEncryptionTypeCStr(CmafEncryptionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CmafEncryptionType::SAMPLE_AES:
-            return "SAMPLE_AES";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCmafEncryptionType(CmafEncryptionType enumValue)
+        {
+          return GetNameForCmafEncryptionTypeCStr(enumValue);
         }
 
       } // namespace CmafEncryptionTypeMapper
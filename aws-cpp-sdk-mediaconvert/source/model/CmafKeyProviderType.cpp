@@ -30,15 +30,30 @@ namespace Aws
       namespace CmafKeyProviderTypeMapper
       {
 
-        static const int STATIC_KEY_HASH = HashingUtils::HashString("STATIC_KEY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STATIC_KEY",
+        };
 
         CmafKeyProviderType GetCmafKeyProviderTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STATIC_KEY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CmafKeyProviderType::STATIC_KEY;
+          case 376057070:
+            if (name == "STATIC_KEY")
+            {
+              return CmafKeyProviderType::STATIC_KEY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return CmafKeyProviderType::NOT_SET;
         }
 
-        Aws::String GetNameForCmafKeyProviderType(CmafKeyProviderType enumValue)
+        const char* GetNameForCmafKeyProviderTypeCStr(CmafKeyProviderType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CmafKeyProviderType::STATIC_KEY:
-            return "STATIC_KEY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCmafKeyProviderType(CmafKeyProviderType enumValue)
+        {
+          return GetNameForCmafKeyProviderTypeCStr(enumValue);
         }
 
       } // namespace CmafKeyProviderTypeMapper
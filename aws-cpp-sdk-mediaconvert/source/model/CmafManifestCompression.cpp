@@ -30,20 +30,37 @@ namespace Aws
       namespace CmafManifestCompressionMapper
       {
 
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GZIP",
+          "NONE",
+        };
 
         CmafManifestCompression GetCmafManifestCompressionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GZIP_HASH)
-          {
-            return CmafManifestCompression::GZIP;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CmafManifestCompression::NONE;
+          case 2203994:
+            if (name == "GZIP")
+            {
+              return CmafManifestCompression::GZIP;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return CmafManifestCompression::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CmafManifestCompression::NOT_SET;
         }
 
-        Aws::String GetNameForCmafManifestCompression(CmafManifestCompression enumValue)
+        const char* GetNameForCmafManifestCompressionCStr(CmafManifestCompression enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CmafManifestCompression::GZIP:
-            return "GZIP";
-          case CmafManifestCompression::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCmafManifestCompression(CmafManifestCompression enumValue)
+        {
+          return GetNameForCmafManifestCompressionCStr(enumValue);
         }
 
       } // namespace CmafManifestCompressionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CmafManifestDurationFormatMapper
       {
 
-        static const int FLOATING_POINT_HASH = HashingUtils::HashString("FLOATING_POINT");
-        static const int INTEGER_HASH = HashingUtils::HashString("INTEGER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FLOATING_POINT",
+          "INTEGER",
+        };
 
         CmafManifestDurationFormat GetCmafManifestDurationFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FLOATING_POINT_HASH)
-          {
-            return CmafManifestDurationFormat::FLOATING_POINT;
-          }
-          else if (hashCode == INTEGER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CmafManifestDurationFormat::INTEGER;
+          case 673848311:
+            if (name == "FLOATING_POINT")
+            {
+              return CmafManifestDurationFormat::FLOATING_POINT;
+            }
+            break;
+          case -1618932450:
+            if (name == "INTEGER")
+            {
+              return CmafManifestDurationFormat::INTEGER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CmafManifestDurationFormat::NOT_SET;
         }
 
-        Aws::String GetNameForCmafManifestDurationFormat(CmafManifestDurationFormat enumValue)
+        const char* GetNameForCmafManifestDurationFormatCStr(CmafManifestDurationFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CmafManifestDurationFormat::FLOATING_POINT:
-            return "FLOATING_POINT";
-          case CmafManifestDurationFormat::INTEGER:
-            return "INTEGER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCmafManifestDurationFormat(CmafManifestDurationFormat enumValue)
+        {
+          return GetNameForCmafManifestDurationFormatCStr(enumValue);
         }
 
       } // namespace CmafManifestDurationFormatMapper
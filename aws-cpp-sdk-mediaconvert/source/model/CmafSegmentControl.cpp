@@ -30,20 +30,37 @@ namespace Aws
       namespace CmafSegmentControlMapper
       {
 
-        static const int SINGLE_FILE_HASH = HashingUtils::HashString("SINGLE_FILE");
-        static const int SEGMENTED_FILES_HASH = HashingUtils::HashString("SEGMENTED_FILES");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SINGLE_FILE",
+          "SEGMENTED_FILES",
+        };
 
         CmafSegmentControl GetCmafSegmentControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SINGLE_FILE_HASH)
-          {
-            return CmafSegmentControl::SINGLE_FILE;
-          }
-          else if (hashCode == SEGMENTED_FILES_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CmafSegmentControl::SEGMENTED_FILES;
+          case 450370323:
+            if (name == "SINGLE_FILE")
+            {
+              return CmafSegmentControl::SINGLE_FILE;
+            }
+            break;
+          case 1662739146:
+            if (name == "SEGMENTED_FILES")
+            {
+              return CmafSegmentControl::SEGMENTED_FILES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CmafSegmentControl::NOT_SET;
         }
 
-        Aws::String GetNameForCmafSegmentControl(CmafSegmentControl enumValue)
+        const char* GetNameForCmafSegmentControlCStr(CmafSegmentControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CmafSegmentControl::SINGLE_FILE:
-            return "SINGLE_FILE";
-          case CmafSegmentControl::SEGMENTED_FILES:
-            return "SEGMENTED_FILES";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCmafSegmentControl(CmafSegmentControl enumValue)
+        {
+          return GetNameForCmafSegmentControlCStr(enumValue);
         }
 
       } // namespace CmafSegmentControlMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CmafWriteHLSManifestMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "ENABLED",
+        };
 
         CmafWriteHLSManifest GetCmafWriteHLSManifestForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return CmafWriteHLSManifest::DISABLED;
-          }
-          else if (hashCode == ENABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CmafWriteHLSManifest::ENABLED;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return CmafWriteHLSManifest::DISABLED;
+            }
+            break;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return CmafWriteHLSManifest::ENABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CmafWriteHLSManifest::NOT_SET;
         }
 
-        Aws::String GetNameForCmafWriteHLSManifest(CmafWriteHLSManifest enumValue)
+        const char* GetNameForCmafWriteHLSManifestCStr(CmafWriteHLSManifest enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CmafWriteHLSManifest::DISABLED:
-            return "DISABLED";
-          case CmafWriteHLSManifest::ENABLED:
-            return "ENABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCmafWriteHLSManifest(CmafWriteHLSManifest enumValue)
+        {
+          return GetNameForCmafWriteHLSManifestCStr(enumValue);
         }
 
       } // namespace CmafWriteHLSManifestMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ColorMetadataMapper
       {
 
-        static const int IGNORE_HASH = HashingUtils::HashString("IGNORE");
-        static const int INSERT_HASH = HashingUtils::HashString("INSERT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IGNORE",
+          "INSERT",
+        };
 
         ColorMetadata GetColorMetadataForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IGNORE_HASH)
-          {
-            return ColorMetadata::IGNORE;
-          }
-          else if (hashCode == INSERT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ColorMetadata::INSERT;
+          case -2137067054:
+            if (name == "IGNORE")
+            {
+              return ColorMetadata::IGNORE;
+            }
+            break;
+          case -2130463047:
+            if (name == "INSERT")
+            {
+              return ColorMetadata::INSERT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ColorMetadata::NOT_SET;
         }
 
-        Aws::String GetNameForColorMetadata(ColorMetadata enumValue)
+        const char* GetNameForColorMetadataCStr(ColorMetadata enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ColorMetadata::IGNORE:
-            return "IGNORE";
-          case ColorMetadata::INSERT:
-            return "INSERT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForColorMetadata(ColorMetadata enumValue)
+        {
+          return GetNameForColorMetadataCStr(enumValue);
         }
 
       } // namespace ColorMetadataMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ColorSpaceMapper
       {
 
-        static const int FOLLOW_HASH = HashingUtils::HashString("FOLLOW");
-        static const int REC_601_HASH = HashingUtils::HashString("REC_601");
-        static const int REC_709_HASH = HashingUtils::HashString("REC_709");
-        static const int HDR10_HASH = HashingUtils::HashString("HDR10");
-        static const int HLG_2020_HASH = HashingUtils::HashString("HLG_2020");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FOLLOW",
+          "REC_601",
+          "REC_709",
+          "HDR10",
+          "HLG_2020",
+        };
 
         ColorSpace GetColorSpaceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ColorSpace::FOLLOW;
-          }
-          else if (hashCode == REC_601_HASH)
-          {
-            return ColorSpace::REC_601;
-          }
-          else if (hashCode == REC_709_HASH)
-          {
-            return ColorSpace::REC_709;
-          }
-          else if (hashCode == HDR10_HASH)
-          {
-            return ColorSpace::HDR10;
-          }
-          else if (hashCode == HLG_2020_HASH)
-          {
-            return ColorSpace::HLG_2020;
+          case 2079338417:
+            if (name == "FOLLOW")
+            {
+              return ColorSpace::FOLLOW;
+            }
+            break;
+          case 1801028712:
+            if (name == "REC_601")
+            {
+              return ColorSpace::REC_601;
+            }
+            break;
+          case 1801029681:
+            if (name == "REC_709")
+            {
+              return ColorSpace::REC_709;
+            }
+            break;
+          case 68599669:
+            if (name == "HDR10")
+            {
+              return ColorSpace::HDR10;
+            }
+            break;
+          case 1781037048:
+            if (name == "HLG_2020")
+            {
+              return ColorSpace::HLG_2020;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ColorSpace::NOT_SET;
         }
 
-        Aws::String GetNameForColorSpace(ColorSpace enumValue)
+        const char* GetNameForColorSpaceCStr(ColorSpace enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ColorSpace::FOLLOW:
-            return "FOLLOW";
-          case ColorSpace::REC_601:
-            return "REC_601";
-          case ColorSpace::REC_709:
-            return "REC_709";
-          case ColorSpace::HDR10:
-            return "HDR10";
-          case ColorSpace::HLG_2020:
-            return "HLG_2020";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForColorSpace(ColorSpace enumValue)
+        {
+          return GetNameForColorSpaceCStr(enumValue);
         }
 
       } // namespace ColorSpaceMapper
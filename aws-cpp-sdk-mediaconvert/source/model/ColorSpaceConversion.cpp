@@ -30,35 +30,58 @@ namespace Aws
       namespace ColorSpaceConversionMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int FORCE_601_HASH = HashingUtils::HashString("FORCE_601");
-        static const int FORCE_709_HASH = HashingUtils::HashString("FORCE_709");
-        static const int FORCE_HDR10_HASH = HashingUtils::HashString("FORCE_HDR10");
-        static const int FORCE_HLG_2020_HASH = HashingUtils::HashString("FORCE_HLG_2020");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "FORCE_601",
+          "FORCE_709",
+          "FORCE_HDR10",
+          "FORCE_HLG_2020",
+        };
 
         ColorSpaceConversion GetColorSpaceConversionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ColorSpaceConversion::NONE;
-          }
-          else if (hashCode == FORCE_601_HASH)
-          {
-            return ColorSpaceConversion::FORCE_601;
-          }
-          else if (hashCode == FORCE_709_HASH)
-          {
-            return ColorSpaceConversion::FORCE_709;
-          }
-          else if (hashCode == FORCE_HDR10_HASH)
-          {
-            return ColorSpaceConversion::FORCE_HDR10;
-          }
-          else if (hashCode == FORCE_HLG_2020_HASH)
-          {
-            return ColorSpaceConversion::FORCE_HLG_2020;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return ColorSpaceConversion::NONE;
+            }
+            break;
+          case 20919619:
+            if (name == "FORCE_601")
+            {
+              return ColorSpaceConversion::FORCE_601;
+            }
+            break;
+          case 20920588:
+            if (name == "FORCE_709")
+            {
+              return ColorSpaceConversion::FORCE_709;
+            }
+            break;
+          case -1353830143:
+            if (name == "FORCE_HDR10")
+            {
+              return ColorSpaceConversion::FORCE_HDR10;
+            }
+            break;
+          case 321850092:
+            if (name == "FORCE_HLG_2020")
+            {
+              return ColorSpaceConversion::FORCE_HLG_2020;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ColorSpaceConversion::NOT_SET;
         }
 
-        Aws::String GetNameForColorSpaceConversion(ColorSpaceConversion enumValue)
+        const char* GetNameForColorSpaceConversionCStr(ColorSpaceConversion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ColorSpaceConversion::NONE:
-            return "NONE";
-          case ColorSpaceConversion::FORCE_601:
-            return "FORCE_601";
-          case ColorSpaceConversion::FORCE_709:
-            return "FORCE_709";
-          case ColorSpaceConversion::FORCE_HDR10:
-            return "FORCE_HDR10";
-          case ColorSpaceConversion::FORCE_HLG_2020:
-            return "FORCE_HLG_2020";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForColorSpaceConversion(ColorSpaceConversion enumValue)
+        {
+          return GetNameForColorSpaceConversionCStr(enumValue);
         }
 
       } // namespace ColorSpaceConversionMapper
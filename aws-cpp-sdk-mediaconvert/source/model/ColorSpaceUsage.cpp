@@ -30,20 +30,37 @@ namespace Aws
       namespace ColorSpaceUsageMapper
       {
 
-        static const int FORCE_HASH = HashingUtils::HashString("FORCE");
-        static const int FALLBACK_HASH = HashingUtils::HashString("FALLBACK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FORCE",
+          "FALLBACK",
+        };
 
         ColorSpaceUsage GetColorSpaceUsageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FORCE_HASH)
-          {
-            return ColorSpaceUsage::FORCE;
-          }
-          else if (hashCode == FALLBACK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ColorSpaceUsage::FALLBACK;
+          case 67080907:
+            if (name == "FORCE")
+            {
+              return ColorSpaceUsage::FORCE;
+            }
+            break;
+          case 1543870178:
+            if (name == "FALLBACK")
+            {
+              return ColorSpaceUsage::FALLBACK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ColorSpaceUsage::NOT_SET;
         }
 
-        Aws::String GetNameForColorSpaceUsage(ColorSpaceUsage enumValue)
+        const char* GetNameForColorSpaceUsageCStr(ColorSpaceUsage enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ColorSpaceUsage::FORCE:
-            return "FORCE";
-          case ColorSpaceUsage::FALLBACK:
-            return "FALLBACK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForColorSpaceUsage(ColorSpaceUsage enumValue)
+        {
+          return GetNameForColorSpaceUsageCStr(enumValue);
         }
 
       } // namespace ColorSpaceUsageMapper
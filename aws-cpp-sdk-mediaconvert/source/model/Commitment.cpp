@@ -30,15 +30,30 @@ namespace Aws
       namespace CommitmentMapper
       {
 
-        static const int ONE_YEAR_HASH = HashingUtils::HashString("ONE_YEAR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ONE_YEAR",
+        };
 
         Commitment GetCommitmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONE_YEAR_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Commitment::ONE_YEAR;
+          case -1480228202:
+            if (name == "ONE_YEAR")
+            {
+              return Commitment::ONE_YEAR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return Commitment::NOT_SET;
         }
 
-        Aws::String GetNameForCommitment(Commitment enumValue)
+        const char* GetNameForCommitmentCStr(Commitment enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Commitment::ONE_YEAR:
-            return "ONE_YEAR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCommitment(Commitment enumValue)
+        {
+          return GetNameForCommitmentCStr(enumValue);
         }
 
       } // namespace CommitmentMapper
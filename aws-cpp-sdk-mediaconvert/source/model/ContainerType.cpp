@@ -30,60 +30,93 @@ namespace Aws
       namespace ContainerTypeMapper
       {
 
-        static const int F4V_HASH = HashingUtils::HashString("F4V");
-        static const int ISMV_HASH = HashingUtils::HashString("ISMV");
-        static const int M2TS_HASH = HashingUtils::HashString("M2TS");
-        static const int M3U8_HASH = HashingUtils::HashString("M3U8");
-        static const int CMFC_HASH = HashingUtils::HashString("CMFC");
-        static const int MOV_HASH = HashingUtils::HashString("MOV");
-        static const int MP4_HASH = HashingUtils::HashString("MP4");
-        static const int MPD_HASH = HashingUtils::HashString("MPD");
-        static const int MXF_HASH = HashingUtils::HashString("MXF");
-        static const int RAW_HASH = HashingUtils::HashString("RAW");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "F4V",
+          "ISMV",
+          "M2TS",
+          "M3U8",
+          "CMFC",
+          "MOV",
+          "MP4",
+          "MPD",
+          "MXF",
+          "RAW",
+        };
 
         ContainerType GetContainerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == F4V_HASH)
-          {
-            return ContainerType::F4V;
-          }
-          else if (hashCode == ISMV_HASH)
-          {
-            return ContainerType::ISMV;
-          }
-          else if (hashCode == M2TS_HASH)
-          {
-            return ContainerType::M2TS;
-          }
-          else if (hashCode == M3U8_HASH)
-          {
-            return ContainerType::M3U8;
-          }
-          else if (hashCode == CMFC_HASH)
-          {
-            return ContainerType::CMFC;
-          }
-          else if (hashCode == MOV_HASH)
-          {
-            return ContainerType::MOV;
-          }
-          else if (hashCode == MP4_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContainerType::MP4;
-          }
-          else if (hashCode == MPD_HASH)
-          {
-            return ContainerType::MPD;
-          }
-          else if (hashCode == MXF_HASH)
-          {
-            return ContainerType::MXF;
-          }
-          else if (hashCode == RAW_HASH)
-          {
-            return ContainerType::RAW;
+          case 68968:
+            if (name == "F4V")
+            {
+              return ContainerType::F4V;
+            }
+            break;
+          case 2256979:
+            if (name == "ISMV")
+            {
+              return ContainerType::ISMV;
+            }
+            break;
+          case 2344644:
+            if (name == "M2TS")
+            {
+              return ContainerType::M2TS;
+            }
+            break;
+          case 2345609:
+            if (name == "M3U8")
+            {
+              return ContainerType::M3U8;
+            }
+            break;
+          case 2072231:
+            if (name == "CMFC")
+            {
+              return ContainerType::CMFC;
+            }
+            break;
+          case 76532:
+            if (name == "MOV")
+            {
+              return ContainerType::MOV;
+            }
+            break;
+          case 76529:
+            if (name == "MP4")
+            {
+              return ContainerType::MP4;
+            }
+            break;
+          case 76545:
+            if (name == "MPD")
+            {
+              return ContainerType::MPD;
+            }
+            break;
+          case 76795:
+            if (name == "MXF")
+            {
+              return ContainerType::MXF;
+            }
+            break;
+          case 80904:
+            if (name == "RAW")
+            {
+              return ContainerType::RAW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return ContainerType::NOT_SET;
         }
 
-        Aws::String GetNameForContainerType(ContainerType enumValue)
+        const char* GetNameForContainerTypeCStr(ContainerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContainerType::F4V:
-            return "F4V";
-          case ContainerType::ISMV:
-            return "ISMV";
-          case ContainerType::M2TS:
-            return "M2TS";
-          case ContainerType::M3U8:
-            return "M3U8";
-          case ContainerType::CMFC:
-            return "CMFC";
-          case ContainerType::MOV:
-            return "MOV";
-          case ContainerType::MP4:
-            return "MP4";
-          case ContainerType::MPD:
-            return "MPD";
-          case ContainerType::MXF:
-            return "MXF";
-          case ContainerType::RAW:
-            return "RAW";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContainerType(ContainerType enumValue)
+        {
+          return GetNameForContainerTypeCStr(enumValue);
         }
 
       } // namespace ContainerTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DashIsoHbbtvComplianceMapper
       {
 
-        static const int HBBTV_1_5_HASH = HashingUtils::HashString("HBBTV_1_5");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HBBTV_1_5",
+          "NONE",
+        };
 
         DashIsoHbbtvCompliance GetDashIsoHbbtvComplianceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HBBTV_1_5_HASH)
-          {
-            return DashIsoHbbtvCompliance::HBBTV_1_5;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DashIsoHbbtvCompliance::NONE;
+          case -1293484814:
+            if (name == "HBBTV_1_5")
+            {
+              return DashIsoHbbtvCompliance::HBBTV_1_5;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return DashIsoHbbtvCompliance::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DashIsoHbbtvCompliance::NOT_SET;
         }
 
-        Aws::String GetNameForDashIsoHbbtvCompliance(DashIsoHbbtvCompliance enumValue)
+        const char* GetNameForDashIsoHbbtvComplianceCStr(DashIsoHbbtvCompliance enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DashIsoHbbtvCompliance::HBBTV_1_5:
-            return "HBBTV_1_5";
-          case DashIsoHbbtvCompliance::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDashIsoHbbtvCompliance(DashIsoHbbtvCompliance enumValue)
+        {
+          return GetNameForDashIsoHbbtvComplianceCStr(enumValue);
         }
 
       } // namespace DashIsoHbbtvComplianceMapper
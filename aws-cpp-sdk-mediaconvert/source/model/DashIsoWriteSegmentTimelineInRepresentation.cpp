@@ -30,20 +30,37 @@ namespace Aws
       namespace DashIsoWriteSegmentTimelineInRepresentationMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLED",
+          "DISABLED",
+        };
 
         DashIsoWriteSegmentTimelineInRepresentation GetDashIsoWriteSegmentTimelineInRepresentationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
-          {
-            return DashIsoWriteSegmentTimelineInRepresentation::ENABLED;
-          }
-          else if (hashCode == DISABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DashIsoWriteSegmentTimelineInRepresentation::DISABLED;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return DashIsoWriteSegmentTimelineInRepresentation::ENABLED;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return DashIsoWriteSegmentTimelineInRepresentation::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DashIsoWriteSegmentTimelineInRepresentation::NOT_SET;
         }
 
-        Aws::String GetNameForDashIsoWriteSegmentTimelineInRepresentation(DashIsoWriteSegmentTimelineInRepresentation enumValue)
+        const char* GetNameForDashIsoWriteSegmentTimelineInRepresentationCStr(DashIsoWriteSegmentTimelineInRepresentation enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DashIsoWriteSegmentTimelineInRepresentation::ENABLED:
-            return "ENABLED";
-          case DashIsoWriteSegmentTimelineInRepresentation::DISABLED:
-            return "DISABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDashIsoWriteSegmentTimelineInRepresentation(DashIsoWriteSegmentTimelineInRepresentation enumValue)
+        {
+          return GetNameForDashIsoWriteSegmentTimelineInRepresentationCStr(enumValue);
         }
 
       } // namespace DashIsoWriteSegmentTimelineInRepresentationMapper
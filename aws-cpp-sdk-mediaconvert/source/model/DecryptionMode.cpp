@@ -30,25 +30,44 @@ namespace Aws
       namespace DecryptionModeMapper
       {
 
-        static const int AES_CTR_HASH = HashingUtils::HashString("AES_CTR");
-        static const int AES_CBC_HASH = HashingUtils::HashString("AES_CBC");
-        static const int AES_GCM_HASH = HashingUtils::HashString("AES_GCM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AES_CTR",
+          "AES_CBC",
+          "AES_GCM",
+        };
 
         DecryptionMode GetDecryptionModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES_CTR_HASH)
-          {
-            return DecryptionMode::AES_CTR;
-          }
-          else if (hashCode == AES_CBC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DecryptionMode::AES_CBC;
-          }
-          else if (hashCode == AES_GCM_HASH)
-          {
-            return DecryptionMode::AES_GCM;
+          case -386841999:
+            if (name == "AES_CTR")
+            {
+              return DecryptionMode::AES_CTR;
+            }
+            break;
+          case -386842572:
+            if (name == "AES_CBC")
+            {
+              return DecryptionMode::AES_CBC;
+            }
+            break;
+          case -386838687:
+            if (name == "AES_GCM")
+            {
+              return DecryptionMode::AES_GCM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DecryptionMode::NOT_SET;
         }
 
-        Aws::String GetNameForDecryptionMode(DecryptionMode enumValue)
+        const char* GetNameForDecryptionModeCStr(DecryptionMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DecryptionMode::AES_CTR:
-            return "AES_CTR";
-          case DecryptionMode::AES_CBC:
-            return "AES_CBC";
-          case DecryptionMode::AES_GCM:
-            return "AES_GCM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDecryptionMode(DecryptionMode enumValue)
+        {
+          return GetNameForDecryptionModeCStr(enumValue);
         }
 
       } // namespace DecryptionModeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace DeinterlaceAlgorithmMapper
       {
 
-        static const int INTERPOLATE_HASH = HashingUtils::HashString("INTERPOLATE");
-        static const int INTERPOLATE_TICKER_HASH = HashingUtils::HashString("INTERPOLATE_TICKER");
-        static const int BLEND_HASH = HashingUtils::HashString("BLEND");
-        static const int BLEND_TICKER_HASH = HashingUtils::HashString("BLEND_TICKER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INTERPOLATE",
+          "INTERPOLATE_TICKER",
+          "BLEND",
+          "BLEND_TICKER",
+        };
 
         DeinterlaceAlgorithm GetDeinterlaceAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERPOLATE_HASH)
-          {
-            return DeinterlaceAlgorithm::INTERPOLATE;
-          }
-          else if (hashCode == INTERPOLATE_TICKER_HASH)
-          {
-            return DeinterlaceAlgorithm::INTERPOLATE_TICKER;
-          }
-          else if (hashCode == BLEND_HASH)
-          {
-            return DeinterlaceAlgorithm::BLEND;
-          }
-          else if (hashCode == BLEND_TICKER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeinterlaceAlgorithm::BLEND_TICKER;
+          case 142372065:
+            if (name == "INTERPOLATE")
+            {
+              return DeinterlaceAlgorithm::INTERPOLATE;
+            }
+            break;
+          case 885383208:
+            if (name == "INTERPOLATE_TICKER")
+            {
+              return DeinterlaceAlgorithm::INTERPOLATE_TICKER;
+            }
+            break;
+          case 63285297:
+            if (name == "BLEND")
+            {
+              return DeinterlaceAlgorithm::BLEND;
+            }
+            break;
+          case 17976024:
+            if (name == "BLEND_TICKER")
+            {
+              return DeinterlaceAlgorithm::BLEND_TICKER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DeinterlaceAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForDeinterlaceAlgorithm(DeinterlaceAlgorithm enumValue)
+        const char* GetNameForDeinterlaceAlgorithmCStr(DeinterlaceAlgorithm enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeinterlaceAlgorithm::INTERPOLATE:
-            return "INTERPOLATE";
-          case DeinterlaceAlgorithm::INTERPOLATE_TICKER:
-            return "INTERPOLATE_TICKER";
-          case DeinterlaceAlgorithm::BLEND:
-            return "BLEND";
-          case DeinterlaceAlgorithm::BLEND_TICKER:
-            return "BLEND_TICKER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeinterlaceAlgorithm(DeinterlaceAlgorithm enumValue)
+        {
+          return GetNameForDeinterlaceAlgorithmCStr(enumValue);
         }
 
       } // namespace DeinterlaceAlgorithmMapper
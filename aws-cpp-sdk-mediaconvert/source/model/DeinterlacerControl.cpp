@@ -30,20 +30,37 @@ namespace Aws
       namespace DeinterlacerControlMapper
       {
 
-        static const int FORCE_ALL_FRAMES_HASH = HashingUtils::HashString("FORCE_ALL_FRAMES");
-        static const int NORMAL_HASH = HashingUtils::HashString("NORMAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FORCE_ALL_FRAMES",
+          "NORMAL",
+        };
 
         DeinterlacerControl GetDeinterlacerControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FORCE_ALL_FRAMES_HASH)
-          {
-            return DeinterlacerControl::FORCE_ALL_FRAMES;
-          }
-          else if (hashCode == NORMAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeinterlacerControl::NORMAL;
+          case -2130502888:
+            if (name == "FORCE_ALL_FRAMES")
+            {
+              return DeinterlacerControl::FORCE_ALL_FRAMES;
+            }
+            break;
+          case -1986416409:
+            if (name == "NORMAL")
+            {
+              return DeinterlacerControl::NORMAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeinterlacerControl::NOT_SET;
         }
 
-        Aws::String GetNameForDeinterlacerControl(DeinterlacerControl enumValue)
+        const char* GetNameForDeinterlacerControlCStr(DeinterlacerControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeinterlacerControl::FORCE_ALL_FRAMES:
-            return "FORCE_ALL_FRAMES";
-          case DeinterlacerControl::NORMAL:
-            return "NORMAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeinterlacerControl(DeinterlacerControl enumValue)
+        {
+          return GetNameForDeinterlacerControlCStr(enumValue);
         }
 
       } // namespace DeinterlacerControlMapper
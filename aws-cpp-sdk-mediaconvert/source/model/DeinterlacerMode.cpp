@@ -30,25 +30,44 @@ namespace Aws
       namespace DeinterlacerModeMapper
       {
 
-        static const int DEINTERLACE_HASH = HashingUtils::HashString("DEINTERLACE");
-        static const int INVERSE_TELECINE_HASH = HashingUtils::HashString("INVERSE_TELECINE");
-        static const int ADAPTIVE_HASH = HashingUtils::HashString("ADAPTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEINTERLACE",
+          "INVERSE_TELECINE",
+          "ADAPTIVE",
+        };
 
         DeinterlacerMode GetDeinterlacerModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEINTERLACE_HASH)
-          {
-            return DeinterlacerMode::DEINTERLACE;
-          }
-          else if (hashCode == INVERSE_TELECINE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeinterlacerMode::INVERSE_TELECINE;
-          }
-          else if (hashCode == ADAPTIVE_HASH)
-          {
-            return DeinterlacerMode::ADAPTIVE;
+          case 681258994:
+            if (name == "DEINTERLACE")
+            {
+              return DeinterlacerMode::DEINTERLACE;
+            }
+            break;
+          case 1427088278:
+            if (name == "INVERSE_TELECINE")
+            {
+              return DeinterlacerMode::INVERSE_TELECINE;
+            }
+            break;
+          case -523385226:
+            if (name == "ADAPTIVE")
+            {
+              return DeinterlacerMode::ADAPTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DeinterlacerMode::NOT_SET;
         }
 
-        Aws::String GetNameForDeinterlacerMode(DeinterlacerMode enumValue)
+        const char* GetNameForDeinterlacerModeCStr(DeinterlacerMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeinterlacerMode::DEINTERLACE:
-            return "DEINTERLACE";
-          case DeinterlacerMode::INVERSE_TELECINE:
-            return "INVERSE_TELECINE";
-          case DeinterlacerMode::ADAPTIVE:
-            return "ADAPTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeinterlacerMode(DeinterlacerMode enumValue)
+        {
+          return GetNameForDeinterlacerModeCStr(enumValue);
         }
 
       } // namespace DeinterlacerModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DescribeEndpointsModeMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int GET_ONLY_HASH = HashingUtils::HashString("GET_ONLY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "GET_ONLY",
+        };
 
         DescribeEndpointsMode GetDescribeEndpointsModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return DescribeEndpointsMode::DEFAULT;
-          }
-          else if (hashCode == GET_ONLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DescribeEndpointsMode::GET_ONLY;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return DescribeEndpointsMode::DEFAULT;
+            }
+            break;
+          case -1506259179:
+            if (name == "GET_ONLY")
+            {
+              return DescribeEndpointsMode::GET_ONLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DescribeEndpointsMode::NOT_SET;
         }
 
-        Aws::String GetNameForDescribeEndpointsMode(DescribeEndpointsMode enumValue)
+        const char* GetNameForDescribeEndpointsModeCStr(DescribeEndpointsMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DescribeEndpointsMode::DEFAULT:
-            return "DEFAULT";
-          case DescribeEndpointsMode::GET_ONLY:
-            return "GET_ONLY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDescribeEndpointsMode(DescribeEndpointsMode enumValue)
+        {
+          return GetNameForDescribeEndpointsModeCStr(enumValue);
         }
 
       } // namespace DescribeEndpointsModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DvbSubtitleAlignmentMapper
       {
 
-        static const int CENTERED_HASH = HashingUtils::HashString("CENTERED");
-        static const int LEFT_HASH = HashingUtils::HashString("LEFT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CENTERED",
+          "LEFT",
+        };
 
         DvbSubtitleAlignment GetDvbSubtitleAlignmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CENTERED_HASH)
-          {
-            return DvbSubtitleAlignment::CENTERED;
-          }
-          else if (hashCode == LEFT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DvbSubtitleAlignment::LEFT;
+          case -69793868:
+            if (name == "CENTERED")
+            {
+              return DvbSubtitleAlignment::CENTERED;
+            }
+            break;
+          case 2332679:
+            if (name == "LEFT")
+            {
+              return DvbSubtitleAlignment::LEFT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DvbSubtitleAlignment::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubtitleAlignment(DvbSubtitleAlignment enumValue)
+        const char* GetNameForDvbSubtitleAlignmentCStr(DvbSubtitleAlignment enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DvbSubtitleAlignment::CENTERED:
-            return "CENTERED";
-          case DvbSubtitleAlignment::LEFT:
-            return "LEFT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDvbSubtitleAlignment(DvbSubtitleAlignment enumValue)
+        {
+          return GetNameForDvbSubtitleAlignmentCStr(enumValue);
         }
 
       } // namespace DvbSubtitleAlignmentMapper
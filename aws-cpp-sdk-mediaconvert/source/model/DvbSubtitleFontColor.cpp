@@ -30,40 +30,65 @@ namespace Aws
       namespace DvbSubtitleFontColorMapper
       {
 
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int YELLOW_HASH = HashingUtils::HashString("YELLOW");
-        static const int RED_HASH = HashingUtils::HashString("RED");
-        static const int GREEN_HASH = HashingUtils::HashString("GREEN");
-        static const int BLUE_HASH = HashingUtils::HashString("BLUE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WHITE",
+          "BLACK",
+          "YELLOW",
+          "RED",
+          "GREEN",
+          "BLUE",
+        };
 
         DvbSubtitleFontColor GetDvbSubtitleFontColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WHITE_HASH)
-          {
-            return DvbSubtitleFontColor::WHITE;
-          }
-          else if (hashCode == BLACK_HASH)
-          {
-            return DvbSubtitleFontColor::BLACK;
-          }
-          else if (hashCode == YELLOW_HASH)
-          {
-            return DvbSubtitleFontColor::YELLOW;
-          }
-          else if (hashCode == RED_HASH)
-          {
-            return DvbSubtitleFontColor::RED;
-          }
-          else if (hashCode == GREEN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DvbSubtitleFontColor::GREEN;
-          }
-          else if (hashCode == BLUE_HASH)
-          {
-            return DvbSubtitleFontColor::BLUE;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return DvbSubtitleFontColor::WHITE;
+            }
+            break;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return DvbSubtitleFontColor::BLACK;
+            }
+            break;
+          case -1680910220:
+            if (name == "YELLOW")
+            {
+              return DvbSubtitleFontColor::YELLOW;
+            }
+            break;
+          case 81009:
+            if (name == "RED")
+            {
+              return DvbSubtitleFontColor::RED;
+            }
+            break;
+          case 68081379:
+            if (name == "GREEN")
+            {
+              return DvbSubtitleFontColor::GREEN;
+            }
+            break;
+          case 2041946:
+            if (name == "BLUE")
+            {
+              return DvbSubtitleFontColor::BLUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return DvbSubtitleFontColor::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubtitleFontColor(DvbSubtitleFontColor enumValue)
+        const char* GetNameForDvbSubtitleFontColorCStr(DvbSubtitleFontColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DvbSubtitleFontColor::WHITE:
-            return "WHITE";
-          case DvbSubtitleFontColor::BLACK:
-            return "BLACK";
-          case DvbSubtitleFontColor::YELLOW:
-            return "YELLOW";
-          case DvbSubtitleFontColor::RED:
-            return "RED";
-          case DvbSubtitleFontColor::GREEN:
-            return "GREEN";
-          case DvbSubtitleFontColor::BLUE:
-            return "BLUE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDvbSubtitleFontColor(DvbSubtitleFontColor enumValue)
+        {
+          return GetNameForDvbSubtitleFontColorCStr(enumValue);
         }
 
       } // namespace DvbSubtitleFontColorMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace DvbSubtitleOutlineColorMapper
       {
 
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-        static const int YELLOW_HASH = HashingUtils::HashString("YELLOW");
-        static const int RED_HASH = HashingUtils::HashString("RED");
-        static const int GREEN_HASH = HashingUtils::HashString("GREEN");
-        static const int BLUE_HASH = HashingUtils::HashString("BLUE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLACK",
+          "WHITE",
+          "YELLOW",
+          "RED",
+          "GREEN",
+          "BLUE",
+        };
 
         DvbSubtitleOutlineColor GetDvbSubtitleOutlineColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLACK_HASH)
-          {
-            return DvbSubtitleOutlineColor::BLACK;
-          }
-          else if (hashCode == WHITE_HASH)
-          {
-            return DvbSubtitleOutlineColor::WHITE;
-          }
-          else if (hashCode == YELLOW_HASH)
-          {
-            return DvbSubtitleOutlineColor::YELLOW;
-          }
-          else if (hashCode == RED_HASH)
-          {
-            return DvbSubtitleOutlineColor::RED;
-          }
-          else if (hashCode == GREEN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DvbSubtitleOutlineColor::GREEN;
-          }
-          else if (hashCode == BLUE_HASH)
-          {
-            return DvbSubtitleOutlineColor::BLUE;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return DvbSubtitleOutlineColor::BLACK;
+            }
+            break;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return DvbSubtitleOutlineColor::WHITE;
+            }
+            break;
+          case -1680910220:
+            if (name == "YELLOW")
+            {
+              return DvbSubtitleOutlineColor::YELLOW;
+            }
+            break;
+          case 81009:
+            if (name == "RED")
+            {
+              return DvbSubtitleOutlineColor::RED;
+            }
+            break;
+          case 68081379:
+            if (name == "GREEN")
+            {
+              return DvbSubtitleOutlineColor::GREEN;
+            }
+            break;
+          case 2041946:
+            if (name == "BLUE")
+            {
+              return DvbSubtitleOutlineColor::BLUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return DvbSubtitleOutlineColor::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubtitleOutlineColor(DvbSubtitleOutlineColor enumValue)
+        const char* GetNameForDvbSubtitleOutlineColorCStr(DvbSubtitleOutlineColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DvbSubtitleOutlineColor::BLACK:
-            return "BLACK";
-          case DvbSubtitleOutlineColor::WHITE:
-            return "WHITE";
-          case DvbSubtitleOutlineColor::YELLOW:
-            return "YELLOW";
-          case DvbSubtitleOutlineColor::RED:
-            return "RED";
-          case DvbSubtitleOutlineColor::GREEN:
-            return "GREEN";
-          case DvbSubtitleOutlineColor::BLUE:
-            return "BLUE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDvbSubtitleOutlineColor(DvbSubtitleOutlineColor enumValue)
+        {
+          return GetNameForDvbSubtitleOutlineColorCStr(enumValue);
         }
 
       } // namespace DvbSubtitleOutlineColorMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DvbSubtitleShadowColorMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "BLACK",
+          "WHITE",
+        };
 
         DvbSubtitleShadowColor GetDvbSubtitleShadowColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return DvbSubtitleShadowColor::NONE;
-          }
-          else if (hashCode == BLACK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DvbSubtitleShadowColor::BLACK;
-          }
-          else if (hashCode == WHITE_HASH)
-          {
-            return DvbSubtitleShadowColor::WHITE;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return DvbSubtitleShadowColor::NONE;
+            }
+            break;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return DvbSubtitleShadowColor::BLACK;
+            }
+            break;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return DvbSubtitleShadowColor::WHITE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DvbSubtitleShadowColor::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubtitleShadowColor(DvbSubtitleShadowColor enumValue)
+        const char* GetNameForDvbSubtitleShadowColorCStr(DvbSubtitleShadowColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DvbSubtitleShadowColor::NONE:
-            return "NONE";
-          case DvbSubtitleShadowColor::BLACK:
-            return "BLACK";
-          case DvbSubtitleShadowColor::WHITE:
-            return "WHITE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDvbSubtitleShadowColor(DvbSubtitleShadowColor enumValue)
+        {
+          return GetNameForDvbSubtitleShadowColorCStr(enumValue);
         }
 
       } // namespace DvbSubtitleShadowColorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace Eac3AttenuationControlMapper
       {
 
-        static const int ATTENUATE_3_DB_HASH = HashingUtils::HashString("ATTENUATE_3_DB");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ATTENUATE_3_DB",
+          "NONE",
+        };
 
         Eac3AttenuationControl GetEac3AttenuationControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ATTENUATE_3_DB_HASH)
-          {
-            return Eac3AttenuationControl::ATTENUATE_3_DB;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Eac3AttenuationControl::NONE;
+          case 606053730:
+            if (name == "ATTENUATE_3_DB")
+            {
+              return Eac3AttenuationControl::ATTENUATE_3_DB;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Eac3AttenuationControl::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Eac3AttenuationControl::NOT_SET;
         }
 
-        Aws::String GetNameForEac3AttenuationControl(Eac3AttenuationControl enumValue)
+        const char* GetNameForEac3AttenuationControlCStr(Eac3AttenuationControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Eac3AttenuationControl::ATTENUATE_3_DB:
-            return "ATTENUATE_3_DB";
-          case Eac3AttenuationControl::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEac3AttenuationControl(Eac3AttenuationControl enumValue)
+        {
+          return GetNameForEac3AttenuationControlCStr(enumValue);
         }
 
       } // namespace Eac3AttenuationControlMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace Eac3BitstreamModeMapper
       {
 
-        static const int COMPLETE_MAIN_HASH = HashingUtils::HashString("COMPLETE_MAIN");
-        static const int COMMENTARY_HASH = HashingUtils::HashString("COMMENTARY");
-        static const int EMERGENCY_HASH = HashingUtils::HashString("EMERGENCY");
-        static const int HEARING_IMPAIRED_HASH = HashingUtils::HashString("HEARING_IMPAIRED");
-        static const int VISUALLY_IMPAIRED_HASH = HashingUtils::HashString("VISUALLY_IMPAIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COMPLETE_MAIN",
+          "COMMENTARY",
+          "EMERGENCY",
+          "HEARING_IMPAIRED",
+          "VISUALLY_IMPAIRED",
+        };
 
         Eac3BitstreamMode GetEac3BitstreamModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLETE_MAIN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Eac3BitstreamMode::COMPLETE_MAIN;
-          }
-          else if (hashCode == COMMENTARY_HASH)
-          {
-            return Eac3BitstreamMode::COMMENTARY;
-          }
-          else if (hashCode == EMERGENCY_HASH)
-          {
-            return Eac3BitstreamMode::EMERGENCY;
-          }
-          else if (hashCode == HEARING_IMPAIRED_HASH)
-          {
-            return Eac3BitstreamMode::HEARING_IMPAIRED;
-          }
-          else if (hashCode == VISUALLY_IMPAIRED_HASH)
-          {
-            return Eac3BitstreamMode::VISUALLY_IMPAIRED;
+          case -964398849:
+            if (name == "COMPLETE_MAIN")
+            {
+              return Eac3BitstreamMode::COMPLETE_MAIN;
+            }
+            break;
+          case 1384245161:
+            if (name == "COMMENTARY")
+            {
+              return Eac3BitstreamMode::COMMENTARY;
+            }
+            break;
+          case 120640881:
+            if (name == "EMERGENCY")
+            {
+              return Eac3BitstreamMode::EMERGENCY;
+            }
+            break;
+          case -767806488:
+            if (name == "HEARING_IMPAIRED")
+            {
+              return Eac3BitstreamMode::HEARING_IMPAIRED;
+            }
+            break;
+          case -1611381169:
+            if (name == "VISUALLY_IMPAIRED")
+            {
+              return Eac3BitstreamMode::VISUALLY_IMPAIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return Eac3BitstreamMode::NOT_SET;
         }
 
-        Aws::String GetNameForEac3BitstreamMode(Eac3BitstreamMode enumValue)
+        const char* GetNameForEac3BitstreamModeCStr(Eac3BitstreamMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Eac3BitstreamMode::COMPLETE_MAIN:
-            return "COMPLETE_MAIN";
-          case Eac3BitstreamMode::COMMENTARY:
-            return "COMMENTARY";
-          case Eac3BitstreamMode::EMERGENCY:
-            return "EMERGENCY";
-          case Eac3BitstreamMode::HEARING_IMPAIRED:
-            return "HEARING_IMPAIRED";
-          case Eac3BitstreamMode::VISUALLY_IMPAIRED:
-            return "VISUALLY_IMPAIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEac3BitstreamMode(Eac3BitstreamMode enumValue)
+        {
+          return GetNameForEac3BitstreamModeCStr(enumValue);
         }
 
       } // namespace Eac3BitstreamModeMapper
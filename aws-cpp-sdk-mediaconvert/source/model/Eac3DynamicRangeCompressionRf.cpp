@@ -30,40 +30,65 @@ namespace Aws
       namespace Eac3DynamicRangeCompressionRfMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int FILM_STANDARD_HASH = HashingUtils::HashString("FILM_STANDARD");
-        static const int FILM_LIGHT_HASH = HashingUtils::HashString("FILM_LIGHT");
-        static const int MUSIC_STANDARD_HASH = HashingUtils::HashString("MUSIC_STANDARD");
-        static const int MUSIC_LIGHT_HASH = HashingUtils::HashString("MUSIC_LIGHT");
-        static const int SPEECH_HASH = HashingUtils::HashString("SPEECH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "FILM_STANDARD",
+          "FILM_LIGHT",
+          "MUSIC_STANDARD",
+          "MUSIC_LIGHT",
+          "SPEECH",
+        };
 
         Eac3DynamicRangeCompressionRf GetEac3DynamicRangeCompressionRfForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return Eac3DynamicRangeCompressionRf::NONE;
-          }
-          else if (hashCode == FILM_STANDARD_HASH)
-          {
-            return Eac3DynamicRangeCompressionRf::FILM_STANDARD;
-          }
-          else if (hashCode == FILM_LIGHT_HASH)
-          {
-            return Eac3DynamicRangeCompressionRf::FILM_LIGHT;
-          }
-          else if (hashCode == MUSIC_STANDARD_HASH)
-          {
-            return Eac3DynamicRangeCompressionRf::MUSIC_STANDARD;
-          }
-          else if (hashCode == MUSIC_LIGHT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Eac3DynamicRangeCompressionRf::MUSIC_LIGHT;
-          }
-          else if (hashCode == SPEECH_HASH)
-          {
-            return Eac3DynamicRangeCompressionRf::SPEECH;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Eac3DynamicRangeCompressionRf::NONE;
+            }
+            break;
+          case -1715452136:
+            if (name == "FILM_STANDARD")
+            {
+              return Eac3DynamicRangeCompressionRf::FILM_STANDARD;
+            }
+            break;
+          case 2048875131:
+            if (name == "FILM_LIGHT")
+            {
+              return Eac3DynamicRangeCompressionRf::FILM_LIGHT;
+            }
+            break;
+          case -2037956681:
+            if (name == "MUSIC_STANDARD")
+            {
+              return Eac3DynamicRangeCompressionRf::MUSIC_STANDARD;
+            }
+            break;
+          case 356597308:
+            if (name == "MUSIC_LIGHT")
+            {
+              return Eac3DynamicRangeCompressionRf::MUSIC_LIGHT;
+            }
+            break;
+          case -1842742046:
+            if (name == "SPEECH")
+            {
+              return Eac3DynamicRangeCompressionRf::SPEECH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return Eac3DynamicRangeCompressionRf::NOT_SET;
         }
 
-        Aws::String GetNameForEac3DynamicRangeCompressionRf(Eac3DynamicRangeCompressionRf enumValue)
+        const char* GetNameForEac3DynamicRangeCompressionRfCStr(Eac3DynamicRangeCompressionRf enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Eac3DynamicRangeCompressionRf::NONE:
-            return "NONE";
-          case Eac3DynamicRangeCompressionRf::FILM_STANDARD:
-            return "FILM_STANDARD";
-          case Eac3DynamicRangeCompressionRf::FILM_LIGHT:
-            return "FILM_LIGHT";
-          case Eac3DynamicRangeCompressionRf::MUSIC_STANDARD:
-            return "MUSIC_STANDARD";
-          case Eac3DynamicRangeCompressionRf::MUSIC_LIGHT:
-            return "MUSIC_LIGHT";
-          case Eac3DynamicRangeCompressionRf::SPEECH:
-            return "SPEECH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEac3DynamicRangeCompressionRf(Eac3DynamicRangeCompressionRf enumValue)
+        {
+          return GetNameForEac3DynamicRangeCompressionRfCStr(enumValue);
         }
 
       } // namespace Eac3DynamicRangeCompressionRfMapper
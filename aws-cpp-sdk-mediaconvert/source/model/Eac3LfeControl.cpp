@@ -30,20 +30,37 @@ namespace Aws
       namespace Eac3LfeControlMapper
       {
 
-        static const int LFE_HASH = HashingUtils::HashString("LFE");
-        static const int NO_LFE_HASH = HashingUtils::HashString("NO_LFE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LFE",
+          "NO_LFE",
+        };
 
         Eac3LfeControl GetEac3LfeControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LFE_HASH)
-          {
-            return Eac3LfeControl::LFE;
-          }
-          else if (hashCode == NO_LFE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Eac3LfeControl::NO_LFE;
+          case 75275:
+            if (name == "LFE")
+            {
+              return Eac3LfeControl::LFE;
+            }
+            break;
+          case -1986029939:
+            if (name == "NO_LFE")
+            {
+              return Eac3LfeControl::NO_LFE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Eac3LfeControl::NOT_SET;
         }
 
-        Aws::String GetNameForEac3LfeControl(Eac3LfeControl enumValue)
+        const char* GetNameForEac3LfeControlCStr(Eac3LfeControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Eac3LfeControl::LFE:
-            return "LFE";
-          case Eac3LfeControl::NO_LFE:
-            return "NO_LFE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEac3LfeControl(Eac3LfeControl enumValue)
+        {
+          return GetNameForEac3LfeControlCStr(enumValue);
         }
 
       } // namespace Eac3LfeControlMapper
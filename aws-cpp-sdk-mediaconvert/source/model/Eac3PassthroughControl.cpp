@@ -30,20 +30,37 @@ namespace Aws
       namespace Eac3PassthroughControlMapper
       {
 
-        static const int WHEN_POSSIBLE_HASH = HashingUtils::HashString("WHEN_POSSIBLE");
-        static const int NO_PASSTHROUGH_HASH = HashingUtils::HashString("NO_PASSTHROUGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WHEN_POSSIBLE",
+          "NO_PASSTHROUGH",
+        };
 
         Eac3PassthroughControl GetEac3PassthroughControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WHEN_POSSIBLE_HASH)
-          {
-            return Eac3PassthroughControl::WHEN_POSSIBLE;
-          }
-          else if (hashCode == NO_PASSTHROUGH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Eac3PassthroughControl::NO_PASSTHROUGH;
+          case 698869974:
+            if (name == "WHEN_POSSIBLE")
+            {
+              return Eac3PassthroughControl::WHEN_POSSIBLE;
+            }
+            break;
+          case 1884226550:
+            if (name == "NO_PASSTHROUGH")
+            {
+              return Eac3PassthroughControl::NO_PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Eac3PassthroughControl::NOT_SET;
         }
 
-        Aws::String GetNameForEac3PassthroughControl(Eac3PassthroughControl enumValue)
+        const char* GetNameForEac3PassthroughControlCStr(Eac3PassthroughControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Eac3PassthroughControl::WHEN_POSSIBLE:
-            return "WHEN_POSSIBLE";
-          case Eac3PassthroughControl::NO_PASSTHROUGH:
-            return "NO_PASSTHROUGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEac3PassthroughControl(Eac3PassthroughControl enumValue)
+        {
+          return GetNameForEac3PassthroughControlCStr(enumValue);
         }
 
       } // namespace Eac3PassthroughControlMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace Eac3PhaseControlMapper
       {
 
-        static const int SHIFT_90_DEGREES_HASH = HashingUtils::HashString("SHIFT_90_DEGREES");
-        static const int NO_SHIFT_HASH = HashingUtils::HashString("NO_SHIFT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SHIFT_90_DEGREES",
+          "NO_SHIFT",
+        };
 
         Eac3PhaseControl GetEac3PhaseControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SHIFT_90_DEGREES_HASH)
-          {
-            return Eac3PhaseControl::SHIFT_90_DEGREES;
-          }
-          else if (hashCode == NO_SHIFT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Eac3PhaseControl::NO_SHIFT;
+          case 334450140:
+            if (name == "SHIFT_90_DEGREES")
+            {
+              return Eac3PhaseControl::SHIFT_90_DEGREES;
+            }
+            break;
+          case -1602761628:
+            if (name == "NO_SHIFT")
+            {
+              return Eac3PhaseControl::NO_SHIFT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Eac3PhaseControl::NOT_SET;
         }
 
-        Aws::String GetNameForEac3PhaseControl(Eac3PhaseControl enumValue)
+        const char* GetNameForEac3PhaseControlCStr(Eac3PhaseControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Eac3PhaseControl::SHIFT_90_DEGREES:
-            return "SHIFT_90_DEGREES";
-          case Eac3PhaseControl::NO_SHIFT:
-            return "NO_SHIFT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEac3PhaseControl(Eac3PhaseControl enumValue)
+        {
+          return GetNameForEac3PhaseControlCStr(enumValue);
         }
 
       } // namespace Eac3PhaseControlMapper
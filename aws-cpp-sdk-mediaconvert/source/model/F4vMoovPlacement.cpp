@@ -30,20 +30,37 @@ namespace Aws
       namespace F4vMoovPlacementMapper
       {
 
-        static const int PROGRESSIVE_DOWNLOAD_HASH = HashingUtils::HashString("PROGRESSIVE_DOWNLOAD");
-        static const int NORMAL_HASH = HashingUtils::HashString("NORMAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PROGRESSIVE_DOWNLOAD",
+          "NORMAL",
+        };
 
         F4vMoovPlacement GetF4vMoovPlacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROGRESSIVE_DOWNLOAD_HASH)
-          {
-            return F4vMoovPlacement::PROGRESSIVE_DOWNLOAD;
-          }
-          else if (hashCode == NORMAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return F4vMoovPlacement::NORMAL;
+          case -353013028:
+            if (name == "PROGRESSIVE_DOWNLOAD")
+            {
+              return F4vMoovPlacement::PROGRESSIVE_DOWNLOAD;
+            }
+            break;
+          case -1986416409:
+            if (name == "NORMAL")
+            {
+              return F4vMoovPlacement::NORMAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return F4vMoovPlacement::NOT_SET;
         }
 
-        Aws::String GetNameForF4vMoovPlacement(F4vMoovPlacement enumValue)
+        const char* GetNameForF4vMoovPlacementCStr(F4vMoovPlacement enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case F4vMoovPlacement::PROGRESSIVE_DOWNLOAD:
-            return "PROGRESSIVE_DOWNLOAD";
-          case F4vMoovPlacement::NORMAL:
-            return "NORMAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForF4vMoovPlacement(F4vMoovPlacement enumValue)
+        {
+          return GetNameForF4vMoovPlacementCStr(enumValue);
         }
 
       } // namespace F4vMoovPlacementMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FileSourceConvert608To708Mapper
       {
 
-        static const int UPCONVERT_HASH = HashingUtils::HashString("UPCONVERT");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UPCONVERT",
+          "DISABLED",
+        };
 
         FileSourceConvert608To708 GetFileSourceConvert608To708ForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UPCONVERT_HASH)
-          {
-            return FileSourceConvert608To708::UPCONVERT;
-          }
-          else if (hashCode == DISABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FileSourceConvert608To708::DISABLED;
+          case 345672344:
+            if (name == "UPCONVERT")
+            {
+              return FileSourceConvert608To708::UPCONVERT;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return FileSourceConvert608To708::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FileSourceConvert608To708::NOT_SET;
         }
 
-        Aws::String GetNameForFileSourceConvert608To708(FileSourceConvert608To708 enumValue)
+        const char* GetNameForFileSourceConvert608To708CStr(FileSourceConvert608To708 enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FileSourceConvert608To708::UPCONVERT:
-            return "UPCONVERT";
-          case FileSourceConvert608To708::DISABLED:
-            return "DISABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFileSourceConvert608To708(FileSourceConvert608To708 enumValue)
+        {
+          return GetNameForFileSourceConvert608To708CStr(enumValue);
         }
 
       } // namespace FileSourceConvert608To708Mapper
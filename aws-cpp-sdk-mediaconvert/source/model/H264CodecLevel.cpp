@@ -30,95 +30,142 @@ namespace Aws
       namespace H264CodecLevelMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int LEVEL_1_HASH = HashingUtils::HashString("LEVEL_1");
-        static const int LEVEL_1_1_HASH = HashingUtils::HashString("LEVEL_1_1");
-        static const int LEVEL_1_2_HASH = HashingUtils::HashString("LEVEL_1_2");
-        static const int LEVEL_1_3_HASH = HashingUtils::HashString("LEVEL_1_3");
-        static const int LEVEL_2_HASH = HashingUtils::HashString("LEVEL_2");
-        static const int LEVEL_2_1_HASH = HashingUtils::HashString("LEVEL_2_1");
-        static const int LEVEL_2_2_HASH = HashingUtils::HashString("LEVEL_2_2");
-        static const int LEVEL_3_HASH = HashingUtils::HashString("LEVEL_3");
-        static const int LEVEL_3_1_HASH = HashingUtils::HashString("LEVEL_3_1");
-        static const int LEVEL_3_2_HASH = HashingUtils::HashString("LEVEL_3_2");
-        static const int LEVEL_4_HASH = HashingUtils::HashString("LEVEL_4");
-        static const int LEVEL_4_1_HASH = HashingUtils::HashString("LEVEL_4_1");
-        static const int LEVEL_4_2_HASH = HashingUtils::HashString("LEVEL_4_2");
-        static const int LEVEL_5_HASH = HashingUtils::HashString("LEVEL_5");
-        static const int LEVEL_5_1_HASH = HashingUtils::HashString("LEVEL_5_1");
-        static const int LEVEL_5_2_HASH = HashingUtils::HashString("LEVEL_5_2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTO",
+          "LEVEL_1",
+          "LEVEL_1_1",
+          "LEVEL_1_2",
+          "LEVEL_1_3",
+          "LEVEL_2",
+          "LEVEL_2_1",
+          "LEVEL_2_2",
+          "LEVEL_3",
+          "LEVEL_3_1",
+          "LEVEL_3_2",
+          "LEVEL_4",
+          "LEVEL_4_1",
+          "LEVEL_4_2",
+          "LEVEL_5",
+          "LEVEL_5_1",
+          "LEVEL_5_2",
+        };
 
         H264CodecLevel GetH264CodecLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
-          {
-            return H264CodecLevel::AUTO;
-          }
-          else if (hashCode == LEVEL_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_1;
-          }
-          else if (hashCode == LEVEL_1_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_1_1;
-          }
-          else if (hashCode == LEVEL_1_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_1_2;
-          }
-          else if (hashCode == LEVEL_1_3_HASH)
-          {
-            return H264CodecLevel::LEVEL_1_3;
-          }
-          else if (hashCode == LEVEL_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_2;
-          }
-          else if (hashCode == LEVEL_2_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_2_1;
-          }
-          else if (hashCode == LEVEL_2_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_2_2;
-          }
-          else if (hashCode == LEVEL_3_HASH)
-          {
-            return H264CodecLevel::LEVEL_3;
-          }
-          else if (hashCode == LEVEL_3_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_3_1;
-          }
-          else if (hashCode == LEVEL_3_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_3_2;
-          }
-          else if (hashCode == LEVEL_4_HASH)
-          {
-            return H264CodecLevel::LEVEL_4;
-          }
-          else if (hashCode == LEVEL_4_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_4_1;
-          }
-          else if (hashCode == LEVEL_4_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_4_2;
-          }
-          else if (hashCode == LEVEL_5_HASH)
-          {
-            return H264CodecLevel::LEVEL_5;
-          }
-          else if (hashCode == LEVEL_5_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_5_1;
-          }
-          else if (hashCode == LEVEL_5_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_5_2;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 2020783:
+            if (name == "AUTO")
+            {
+              return H264CodecLevel::AUTO;
+            }
+            break;
+          case 787768854:
+            if (name == "LEVEL_1")
+            {
+              return H264CodecLevel::LEVEL_1;
+            }
+            break;
+          case 1131627592:
+            if (name == "LEVEL_1_1")
+            {
+              return H264CodecLevel::LEVEL_1_1;
+            }
+            break;
+          case 1131627593:
+            if (name == "LEVEL_1_2")
+            {
+              return H264CodecLevel::LEVEL_1_2;
+            }
+            break;
+          case 1131627594:
+            if (name == "LEVEL_1_3")
+            {
+              return H264CodecLevel::LEVEL_1_3;
+            }
+            break;
+          case 787768855:
+            if (name == "LEVEL_2")
+            {
+              return H264CodecLevel::LEVEL_2;
+            }
+            break;
+          case 1131628553:
+            if (name == "LEVEL_2_1")
+            {
+              return H264CodecLevel::LEVEL_2_1;
+            }
+            break;
+          case 1131628554:
+            if (name == "LEVEL_2_2")
+            {
+              return H264CodecLevel::LEVEL_2_2;
+            }
+            break;
+          case 787768856:
+            if (name == "LEVEL_3")
+            {
+              return H264CodecLevel::LEVEL_3;
+            }
+            break;
+          case 1131629514:
+            if (name == "LEVEL_3_1")
+            {
+              return H264CodecLevel::LEVEL_3_1;
+            }
+            break;
+          case 1131629515:
+            if (name == "LEVEL_3_2")
+            {
+              return H264CodecLevel::LEVEL_3_2;
+            }
+            break;
+          case 787768857:
+            if (name == "LEVEL_4")
+            {
+              return H264CodecLevel::LEVEL_4;
+            }
+            break;
+          case 1131630475:
+            if (name == "LEVEL_4_1")
+            {
+              return H264CodecLevel::LEVEL_4_1;
+            }
+            break;
+          case 1131630476:
+            if (name == "LEVEL_4_2")
+            {
+              return H264CodecLevel::LEVEL_4_2;
+            }
+            break;
+          case 787768858:
+            if (name == "LEVEL_5")
+            {
+              return H264CodecLevel::LEVEL_5;
+            }
+            break;
+          case 1131631436:
+            if (name == "LEVEL_5_1")
+            {
+              return H264CodecLevel::LEVEL_5_1;
+            }
+            break;
+          case 1131631437:
+            if (name == "LEVEL_5_2")
+            {
+              return H264CodecLevel::LEVEL_5_2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,53 +177,26 @@ namespace Aws
           return H264CodecLevel::NOT_SET;
         }
 
-        Aws::String GetNameForH264CodecLevel(H264CodecLevel enumValue)
+        const char* GetNameForH264CodecLevelCStr(H264CodecLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264CodecLevel::AUTO:
-            return "AUTO";
-          case H264CodecLevel::LEVEL_1:
-            return "LEVEL_1";
-          case H264CodecLevel::LEVEL_1_1:
-            return "LEVEL_1_1";
-          case H264CodecLevel::LEVEL_1_2:
-            return "LEVEL_1_2";
-          case H264CodecLevel::LEVEL_1_3:
-            return "LEVEL_1_3";
-          case H264CodecLevel::LEVEL_2:
-            return "LEVEL_2";
-          case H264CodecLevel::LEVEL_2_1:
-            return "LEVEL_2_1";
-          case H264CodecLevel::LEVEL_2_2:
-            return "LEVEL_2_2";
-          case H264CodecLevel::LEVEL_3:
-            return "LEVEL_3";
-          case H264CodecLevel::LEVEL_3_1:
-            return "LEVEL_3_1";
-          case H264CodecLevel::LEVEL_3_2:
-            return "LEVEL_3_2";
-          case H264CodecLevel::LEVEL_4:
-            return "LEVEL_4";
-          case H264CodecLevel::LEVEL_4_1:
-            return "LEVEL_4_1";
-          case H264CodecLevel::LEVEL_4_2:
-            return "LEVEL_4_2";
-          case H264CodecLevel::LEVEL_5:
-            return "LEVEL_5";
-          case H264CodecLevel::LEVEL_5_1:
-            return "LEVEL_5_1";
-          case H264CodecLevel::LEVEL_5_2:
-            return "LEVEL_5_2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264CodecLevel(H264CodecLevel enumValue)
+        {
+          return GetNameForH264CodecLevelCStr(enumValue);
         }
 
       } // namespace H264CodecLevelMapper
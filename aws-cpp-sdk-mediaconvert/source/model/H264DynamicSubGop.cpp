@@ -30,20 +30,37 @@ namespace Aws
       namespace H264DynamicSubGopMapper
       {
 
-        static const int ADAPTIVE_HASH = HashingUtils::HashString("ADAPTIVE");
-        static const int STATIC__HASH = HashingUtils::HashString("STATIC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADAPTIVE",
+          "STATIC",
+        };
 
         H264DynamicSubGop GetH264DynamicSubGopForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADAPTIVE_HASH)
-          {
-            return H264DynamicSubGop::ADAPTIVE;
-          }
-          else if (hashCode == STATIC__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264DynamicSubGop::STATIC_;
+          case -523385226:
+            if (name == "ADAPTIVE")
+            {
+              return H264DynamicSubGop::ADAPTIVE;
+            }
+            break;
+          case -1839152530:
+            if (name == "STATIC")
+            {
+              return H264DynamicSubGop::STATIC_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264DynamicSubGop::NOT_SET;
         }
 
-        Aws::String GetNameForH264DynamicSubGop(H264DynamicSubGop enumValue)
+        const char* GetNameForH264DynamicSubGopCStr(H264DynamicSubGop enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264DynamicSubGop::ADAPTIVE:
-            return "ADAPTIVE";
-          case H264DynamicSubGop::STATIC_:
-            return "STATIC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264DynamicSubGop(H264DynamicSubGop enumValue)
+        {
+          return GetNameForH264DynamicSubGopCStr(enumValue);
         }
 
       } // namespace H264DynamicSubGopMapper
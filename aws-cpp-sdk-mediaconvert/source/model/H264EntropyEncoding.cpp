@@ -30,20 +30,37 @@ namespace Aws
       namespace H264EntropyEncodingMapper
       {
 
-        static const int CABAC_HASH = HashingUtils::HashString("CABAC");
-        static const int CAVLC_HASH = HashingUtils::HashString("CAVLC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CABAC",
+          "CAVLC",
+        };
 
         H264EntropyEncoding GetH264EntropyEncodingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CABAC_HASH)
-          {
-            return H264EntropyEncoding::CABAC;
-          }
-          else if (hashCode == CAVLC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264EntropyEncoding::CAVLC;
+          case 63877830:
+            if (name == "CABAC")
+            {
+              return H264EntropyEncoding::CABAC;
+            }
+            break;
+          case 63897391:
+            if (name == "CAVLC")
+            {
+              return H264EntropyEncoding::CAVLC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264EntropyEncoding::NOT_SET;
         }
 
-        Aws::String GetNameForH264EntropyEncoding(H264EntropyEncoding enumValue)
+        const char* GetNameForH264EntropyEncodingCStr(H264EntropyEncoding enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264EntropyEncoding::CABAC:
-            return "CABAC";
-          case H264EntropyEncoding::CAVLC:
-            return "CAVLC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264EntropyEncoding(H264EntropyEncoding enumValue)
+        {
+          return GetNameForH264EntropyEncodingCStr(enumValue);
         }
 
       } // namespace H264EntropyEncodingMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace H264FieldEncodingMapper
       {
 
-        static const int PAFF_HASH = HashingUtils::HashString("PAFF");
-        static const int FORCE_FIELD_HASH = HashingUtils::HashString("FORCE_FIELD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PAFF",
+          "FORCE_FIELD",
+        };
 
         H264FieldEncoding GetH264FieldEncodingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PAFF_HASH)
-          {
-            return H264FieldEncoding::PAFF;
-          }
-          else if (hashCode == FORCE_FIELD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264FieldEncoding::FORCE_FIELD;
+          case 2447985:
+            if (name == "PAFF")
+            {
+              return H264FieldEncoding::PAFF;
+            }
+            break;
+          case -1355539866:
+            if (name == "FORCE_FIELD")
+            {
+              return H264FieldEncoding::FORCE_FIELD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264FieldEncoding::NOT_SET;
         }
 
-        Aws::String GetNameForH264FieldEncoding(H264FieldEncoding enumValue)
+        const char* GetNameForH264FieldEncodingCStr(H264FieldEncoding enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264FieldEncoding::PAFF:
-            return "PAFF";
-          case H264FieldEncoding::FORCE_FIELD:
-            return "FORCE_FIELD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264FieldEncoding(H264FieldEncoding enumValue)
+        {
+          return GetNameForH264FieldEncodingCStr(enumValue);
         }
 
       } // namespace H264FieldEncodingMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace H264FlickerAdaptiveQuantizationMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "ENABLED",
+        };
 
         H264FlickerAdaptiveQuantization GetH264FlickerAdaptiveQuantizationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return H264FlickerAdaptiveQuantization::DISABLED;
-          }
-          else if (hashCode == ENABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264FlickerAdaptiveQuantization::ENABLED;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return H264FlickerAdaptiveQuantization::DISABLED;
+            }
+            break;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return H264FlickerAdaptiveQuantization::ENABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264FlickerAdaptiveQuantization::NOT_SET;
         }
 
-        Aws::String GetNameForH264FlickerAdaptiveQuantization(H264FlickerAdaptiveQuantization enumValue)
+        const char* GetNameForH264FlickerAdaptiveQuantizationCStr(H264FlickerAdaptiveQuantization enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264FlickerAdaptiveQuantization::DISABLED:
-            return "DISABLED";
-          case H264FlickerAdaptiveQuantization::ENABLED:
-            return "ENABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264FlickerAdaptiveQuantization(H264FlickerAdaptiveQuantization enumValue)
+        {
+          return GetNameForH264FlickerAdaptiveQuantizationCStr(enumValue);
         }
 
       } // namespace H264FlickerAdaptiveQuantizationMapper
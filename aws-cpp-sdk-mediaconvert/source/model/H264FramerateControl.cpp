@@ -30,20 +30,37 @@ namespace Aws
       namespace H264FramerateControlMapper
       {
 
-        static const int INITIALIZE_FROM_SOURCE_HASH = HashingUtils::HashString("INITIALIZE_FROM_SOURCE");
-        static const int SPECIFIED_HASH = HashingUtils::HashString("SPECIFIED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INITIALIZE_FROM_SOURCE",
+          "SPECIFIED",
+        };
 
         H264FramerateControl GetH264FramerateControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZE_FROM_SOURCE_HASH)
-          {
-            return H264FramerateControl::INITIALIZE_FROM_SOURCE;
-          }
-          else if (hashCode == SPECIFIED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264FramerateControl::SPECIFIED;
+          case -1860799455:
+            if (name == "INITIALIZE_FROM_SOURCE")
+            {
+              return H264FramerateControl::INITIALIZE_FROM_SOURCE;
+            }
+            break;
+          case 1091980688:
+            if (name == "SPECIFIED")
+            {
+              return H264FramerateControl::SPECIFIED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264FramerateControl::NOT_SET;
         }
 
-        Aws::String GetNameForH264FramerateControl(H264FramerateControl enumValue)
+        const char* GetNameForH264FramerateControlCStr(H264FramerateControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264FramerateControl::INITIALIZE_FROM_SOURCE:
-            return "INITIALIZE_FROM_SOURCE";
-          case H264FramerateControl::SPECIFIED:
-            return "SPECIFIED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264FramerateControl(H264FramerateControl enumValue)
+        {
+          return GetNameForH264FramerateControlCStr(enumValue);
         }
 
       } // namespace H264FramerateControlMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace H264GopSizeUnitsMapper
       {
 
-        static const int FRAMES_HASH = HashingUtils::HashString("FRAMES");
-        static const int SECONDS_HASH = HashingUtils::HashString("SECONDS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FRAMES",
+          "SECONDS",
+        };
 
         H264GopSizeUnits GetH264GopSizeUnitsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FRAMES_HASH)
-          {
-            return H264GopSizeUnits::FRAMES;
-          }
-          else if (hashCode == SECONDS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264GopSizeUnits::SECONDS;
+          case 2081781926:
+            if (name == "FRAMES")
+            {
+              return H264GopSizeUnits::FRAMES;
+            }
+            break;
+          case -1606887841:
+            if (name == "SECONDS")
+            {
+              return H264GopSizeUnits::SECONDS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264GopSizeUnits::NOT_SET;
         }
 
-        Aws::String GetNameForH264GopSizeUnits(H264GopSizeUnits enumValue)
+        const char* GetNameForH264GopSizeUnitsCStr(H264GopSizeUnits enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264GopSizeUnits::FRAMES:
-            return "FRAMES";
-          case H264GopSizeUnits::SECONDS:
-            return "SECONDS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264GopSizeUnits(H264GopSizeUnits enumValue)
+        {
+          return GetNameForH264GopSizeUnitsCStr(enumValue);
         }
 
       } // namespace H264GopSizeUnitsMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace H264InterlaceModeMapper
       {
 
-        static const int PROGRESSIVE_HASH = HashingUtils::HashString("PROGRESSIVE");
-        static const int TOP_FIELD_HASH = HashingUtils::HashString("TOP_FIELD");
-        static const int BOTTOM_FIELD_HASH = HashingUtils::HashString("BOTTOM_FIELD");
-        static const int FOLLOW_TOP_FIELD_HASH = HashingUtils::HashString("FOLLOW_TOP_FIELD");
-        static const int FOLLOW_BOTTOM_FIELD_HASH = HashingUtils::HashString("FOLLOW_BOTTOM_FIELD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PROGRESSIVE",
+          "TOP_FIELD",
+          "BOTTOM_FIELD",
+          "FOLLOW_TOP_FIELD",
+          "FOLLOW_BOTTOM_FIELD",
+        };
 
         H264InterlaceMode GetH264InterlaceModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROGRESSIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264InterlaceMode::PROGRESSIVE;
-          }
-          else if (hashCode == TOP_FIELD_HASH)
-          {
-            return H264InterlaceMode::TOP_FIELD;
-          }
-          else if (hashCode == BOTTOM_FIELD_HASH)
-          {
-            return H264InterlaceMode::BOTTOM_FIELD;
-          }
-          else if (hashCode == FOLLOW_TOP_FIELD_HASH)
-          {
-            return H264InterlaceMode::FOLLOW_TOP_FIELD;
-          }
-          else if (hashCode == FOLLOW_BOTTOM_FIELD_HASH)
-          {
-            return H264InterlaceMode::FOLLOW_BOTTOM_FIELD;
+          case -1010458773:
+            if (name == "PROGRESSIVE")
+            {
+              return H264InterlaceMode::PROGRESSIVE;
+            }
+            break;
+          case -486746800:
+            if (name == "TOP_FIELD")
+            {
+              return H264InterlaceMode::TOP_FIELD;
+            }
+            break;
+          case 1522732486:
+            if (name == "BOTTOM_FIELD")
+            {
+              return H264InterlaceMode::BOTTOM_FIELD;
+            }
+            break;
+          case -920725950:
+            if (name == "FOLLOW_TOP_FIELD")
+            {
+              return H264InterlaceMode::FOLLOW_TOP_FIELD;
+            }
+            break;
+          case 701435796:
+            if (name == "FOLLOW_BOTTOM_FIELD")
+            {
+              return H264InterlaceMode::FOLLOW_BOTTOM_FIELD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return H264InterlaceMode::NOT_SET;
         }
 
-        Aws::String GetNameForH264InterlaceMode(H264InterlaceMode enumValue)
+        const char* GetNameForH264InterlaceModeCStr(H264InterlaceMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264InterlaceMode::PROGRESSIVE:
-            return "PROGRESSIVE";
-          case H264InterlaceMode::TOP_FIELD:
-            return "TOP_FIELD";
-          case H264InterlaceMode::BOTTOM_FIELD:
-            return "BOTTOM_FIELD";
-          case H264InterlaceMode::FOLLOW_TOP_FIELD:
-            return "FOLLOW_TOP_FIELD";
-          case H264InterlaceMode::FOLLOW_BOTTOM_FIELD:
-            return "FOLLOW_BOTTOM_FIELD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264InterlaceMode(H264InterlaceMode enumValue)
+        {
+          return GetNameForH264InterlaceModeCStr(enumValue);
         }
 
       } // namespace H264InterlaceModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace H264SyntaxMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int RP2027_HASH = HashingUtils::HashString("RP2027");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "RP2027",
+        };
 
         H264Syntax GetH264SyntaxForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return H264Syntax::DEFAULT;
-          }
-          else if (hashCode == RP2027_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264Syntax::RP2027;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return H264Syntax::DEFAULT;
+            }
+            break;
+          case -1871957951:
+            if (name == "RP2027")
+            {
+              return H264Syntax::RP2027;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264Syntax::NOT_SET;
         }
 
-        Aws::String GetNameForH264Syntax(H264Syntax enumValue)
+        const char* GetNameForH264SyntaxCStr(H264Syntax enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264Syntax::DEFAULT:
-            return "DEFAULT";
-          case H264Syntax::RP2027:
-            return "RP2027";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264Syntax(H264Syntax enumValue)
+        {
+          return GetNameForH264SyntaxCStr(enumValue);
         }
 
       } // namespace H264SyntaxMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace H264TemporalAdaptiveQuantizationMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "ENABLED",
+        };
 
         H264TemporalAdaptiveQuantization GetH264TemporalAdaptiveQuantizationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return H264TemporalAdaptiveQuantization::DISABLED;
-          }
-          else if (hashCode == ENABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264TemporalAdaptiveQuantization::ENABLED;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return H264TemporalAdaptiveQuantization::DISABLED;
+            }
+            break;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return H264TemporalAdaptiveQuantization::ENABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264TemporalAdaptiveQuantization::NOT_SET;
         }
 
-        Aws::String GetNameForH264TemporalAdaptiveQuantization(H264TemporalAdaptiveQuantization enumValue)
+        const char* GetNameForH264TemporalAdaptiveQuantizationCStr(H264TemporalAdaptiveQuantization enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264TemporalAdaptiveQuantization::DISABLED:
-            return "DISABLED";
-          case H264TemporalAdaptiveQuantization::ENABLED:
-            return "ENABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264TemporalAdaptiveQuantization(H264TemporalAdaptiveQuantization enumValue)
+        {
+          return GetNameForH264TemporalAdaptiveQuantizationCStr(enumValue);
         }
 
       } // namespace H264TemporalAdaptiveQuantizationMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace H264UnregisteredSeiTimecodeMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "ENABLED",
+        };
 
         H264UnregisteredSeiTimecode GetH264UnregisteredSeiTimecodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return H264UnregisteredSeiTimecode::DISABLED;
-          }
-          else if (hashCode == ENABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264UnregisteredSeiTimecode::ENABLED;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return H264UnregisteredSeiTimecode::DISABLED;
+            }
+            break;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return H264UnregisteredSeiTimecode::ENABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264UnregisteredSeiTimecode::NOT_SET;
         }
 
-        Aws::String GetNameForH264UnregisteredSeiTimecode(H264UnregisteredSeiTimecode enumValue)
+        const char* GetNameForH264UnregisteredSeiTimecodeCStr(H264UnregisteredSeiTimecode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264UnregisteredSeiTimecode::DISABLED:
-            return "DISABLED";
-          case H264UnregisteredSeiTimecode::ENABLED:
-            return "ENABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264UnregisteredSeiTimecode(H264UnregisteredSeiTimecode enumValue)
+        {
+          return GetNameForH264UnregisteredSeiTimecodeCStr(enumValue);
         }
 
       } // namespace H264UnregisteredSeiTimecodeMapper
@@ -30,80 +30,121 @@ namespace Aws
       namespace H265CodecLevelMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int LEVEL_1_HASH = HashingUtils::HashString("LEVEL_1");
-        static const int LEVEL_2_HASH = HashingUtils::HashString("LEVEL_2");
-        static const int LEVEL_2_1_HASH = HashingUtils::HashString("LEVEL_2_1");
-        static const int LEVEL_3_HASH = HashingUtils::HashString("LEVEL_3");
-        static const int LEVEL_3_1_HASH = HashingUtils::HashString("LEVEL_3_1");
-        static const int LEVEL_4_HASH = HashingUtils::HashString("LEVEL_4");
-        static const int LEVEL_4_1_HASH = HashingUtils::HashString("LEVEL_4_1");
-        static const int LEVEL_5_HASH = HashingUtils::HashString("LEVEL_5");
-        static const int LEVEL_5_1_HASH = HashingUtils::HashString("LEVEL_5_1");
-        static const int LEVEL_5_2_HASH = HashingUtils::HashString("LEVEL_5_2");
-        static const int LEVEL_6_HASH = HashingUtils::HashString("LEVEL_6");
-        static const int LEVEL_6_1_HASH = HashingUtils::HashString("LEVEL_6_1");
-        static const int LEVEL_6_2_HASH = HashingUtils::HashString("LEVEL_6_2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTO",
+          "LEVEL_1",
+          "LEVEL_2",
+          "LEVEL_2_1",
+          "LEVEL_3",
+          "LEVEL_3_1",
+          "LEVEL_4",
+          "LEVEL_4_1",
+          "LEVEL_5",
+          "LEVEL_5_1",
+          "LEVEL_5_2",
+          "LEVEL_6",
+          "LEVEL_6_1",
+          "LEVEL_6_2",
+        };
 
         H265CodecLevel GetH265CodecLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
-          {
-            return H265CodecLevel::AUTO;
-          }
-          else if (hashCode == LEVEL_1_HASH)
-          {
-            return H265CodecLevel::LEVEL_1;
-          }
-          else if (hashCode == LEVEL_2_HASH)
-          {
-            return H265CodecLevel::LEVEL_2;
-          }
-          else if (hashCode == LEVEL_2_1_HASH)
-          {
-            return H265CodecLevel::LEVEL_2_1;
-          }
-          else if (hashCode == LEVEL_3_HASH)
-          {
-            return H265CodecLevel::LEVEL_3;
-          }
-          else if (hashCode == LEVEL_3_1_HASH)
-          {
-            return H265CodecLevel::LEVEL_3_1;
-          }
-          else if (hashCode == LEVEL_4_HASH)
-          {
-            return H265CodecLevel::LEVEL_4;
-          }
-          else if (hashCode == LEVEL_4_1_HASH)
-          {
-            return H265CodecLevel::LEVEL_4_1;
-          }
-          else if (hashCode == LEVEL_5_HASH)
-          {
-            return H265CodecLevel::LEVEL_5;
-          }
-          else if (hashCode == LEVEL_5_1_HASH)
-          {
-            return H265CodecLevel::LEVEL_5_1;
-          }
-          else if (hashCode == LEVEL_5_2_HASH)
-          {
-            return H265CodecLevel::LEVEL_5_2;
-          }
-          else if (hashCode == LEVEL_6_HASH)
-          {
-            return H265CodecLevel::LEVEL_6;
-          }
-          else if (hashCode == LEVEL_6_1_HASH)
-          {
-            return H265CodecLevel::LEVEL_6_1;
-          }
-          else if (hashCode == LEVEL_6_2_HASH)
-          {
-            return H265CodecLevel::LEVEL_6_2;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 2020783:
+            if (name == "AUTO")
+            {
+              return H265CodecLevel::AUTO;
+            }
+            break;
+          case 787768854:
+            if (name == "LEVEL_1")
+            {
+              return H265CodecLevel::LEVEL_1;
+            }
+            break;
+          case 787768855:
+            if (name == "LEVEL_2")
+            {
+              return H265CodecLevel::LEVEL_2;
+            }
+            break;
+          case 1131628553:
+            if (name == "LEVEL_2_1")
+            {
+              return H265CodecLevel::LEVEL_2_1;
+            }
+            break;
+          case 787768856:
+            if (name == "LEVEL_3")
+            {
+              return H265CodecLevel::LEVEL_3;
+            }
+            break;
+          case 1131629514:
+            if (name == "LEVEL_3_1")
+            {
+              return H265CodecLevel::LEVEL_3_1;
+            }
+            break;
+          case 787768857:
+            if (name == "LEVEL_4")
+            {
+              return H265CodecLevel::LEVEL_4;
+            }
+            break;
+          case 1131630475:
+            if (name == "LEVEL_4_1")
+            {
+              return H265CodecLevel::LEVEL_4_1;
+            }
+            break;
+          case 787768858:
+            if (name == "LEVEL_5")
+            {
+              return H265CodecLevel::LEVEL_5;
+            }
+            break;
+          case 1131631436:
+            if (name == "LEVEL_5_1")
+            {
+              return H265CodecLevel::LEVEL_5_1;
+            }
+            break;
+          case 1131631437:
+            if (name == "LEVEL_5_2")
+            {
+              return H265CodecLevel::LEVEL_5_2;
+            }
+            break;
+          case 787768859:
+            if (name == "LEVEL_6")
+            {
+              return H265CodecLevel::LEVEL_6;
+            }
+            break;
+          case 1131632397:
+            if (name == "LEVEL_6_1")
+            {
+              return H265CodecLevel::LEVEL_6_1;
+            }
+            break;
+          case 1131632398:
+            if (name == "LEVEL_6_2")
+            {
+              return H265CodecLevel::LEVEL_6_2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -115,47 +156,26 @@ namespace Aws
           return H265CodecLevel::NOT_SET;
         }
 
-        Aws::String GetNameForH265CodecLevel(H265CodecLevel enumValue)
+        const char* GetNameForH265CodecLevelCStr(H265CodecLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H265CodecLevel::AUTO:
-            return "AUTO";
-          case H265CodecLevel::LEVEL_1:
-            return "LEVEL_1";
-          case H265CodecLevel::LEVEL_2:
-            return "LEVEL_2";
-          case H265CodecLevel::LEVEL_2_1:
-            return "LEVEL_2_1";
-          case H265CodecLevel::LEVEL_3:
-            return "LEVEL_3";
-          case H265CodecLevel::LEVEL_3_1:
-            return "LEVEL_3_1";
-          case H265CodecLevel::LEVEL_4:
-            return "LEVEL_4";
-          case H265CodecLevel::LEVEL_4_1:
-            return "LEVEL_4_1";
-          case H265CodecLevel::LEVEL_5:
-            return "LEVEL_5";
-          case H265CodecLevel::LEVEL_5_1:
-            return "LEVEL_5_1";
-          case H265CodecLevel::LEVEL_5_2:
-            return "LEVEL_5_2";
-          case H265CodecLevel::LEVEL_6:
-            return "LEVEL_6";
-          case H265CodecLevel::LEVEL_6_1:
-            return "LEVEL_6_1";
-          case H265CodecLevel::LEVEL_6_2:
-            return "LEVEL_6_2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH265CodecLevel(H265CodecLevel enumValue)
+        {
+          return GetNameForH265CodecLevelCStr(enumValue);
         }
 
       } // namespace H265CodecLevelMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace H265CodecProfileMapper
       {
 
-        static const int MAIN_MAIN_HASH = HashingUtils::HashString("MAIN_MAIN");
-        static const int MAIN_HIGH_HASH = HashingUtils::HashString("MAIN_HIGH");
-        static const int MAIN10_MAIN_HASH = HashingUtils::HashString("MAIN10_MAIN");
-        static const int MAIN10_HIGH_HASH = HashingUtils::HashString("MAIN10_HIGH");
-        static const int MAIN_422_8BIT_MAIN_HASH = HashingUtils::HashString("MAIN_422_8BIT_MAIN");
-        static const int MAIN_422_8BIT_HIGH_HASH = HashingUtils::HashString("MAIN_422_8BIT_HIGH");
-        static const int MAIN_422_10BIT_MAIN_HASH = HashingUtils::HashString("MAIN_422_10BIT_MAIN");
-        static const int MAIN_422_10BIT_HIGH_HASH = HashingUtils::HashString("MAIN_422_10BIT_HIGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MAIN_MAIN",
+          "MAIN_HIGH",
+          "MAIN10_MAIN",
+          "MAIN10_HIGH",
+          "MAIN_422_8BIT_MAIN",
+          "MAIN_422_8BIT_HIGH",
+          "MAIN_422_10BIT_MAIN",
+          "MAIN_422_10BIT_HIGH",
+        };
 
         H265CodecProfile GetH265CodecProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAIN_MAIN_HASH)
-          {
-            return H265CodecProfile::MAIN_MAIN;
-          }
-          else if (hashCode == MAIN_HIGH_HASH)
-          {
-            return H265CodecProfile::MAIN_HIGH;
-          }
-          else if (hashCode == MAIN10_MAIN_HASH)
-          {
-            return H265CodecProfile::MAIN10_MAIN;
-          }
-          else if (hashCode == MAIN10_HIGH_HASH)
-          {
-            return H265CodecProfile::MAIN10_HIGH;
-          }
-          else if (hashCode == MAIN_422_8BIT_MAIN_HASH)
-          {
-            return H265CodecProfile::MAIN_422_8BIT_MAIN;
-          }
-          else if (hashCode == MAIN_422_8BIT_HIGH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H265CodecProfile::MAIN_422_8BIT_HIGH;
-          }
-          else if (hashCode == MAIN_422_10BIT_MAIN_HASH)
-          {
-            return H265CodecProfile::MAIN_422_10BIT_MAIN;
-          }
-          else if (hashCode == MAIN_422_10BIT_HIGH_HASH)
-          {
-            return H265CodecProfile::MAIN_422_10BIT_HIGH;
+          case -1730059137:
+            if (name == "MAIN_MAIN")
+            {
+              return H265CodecProfile::MAIN_MAIN;
+            }
+            break;
+          case -1730200472:
+            if (name == "MAIN_HIGH")
+            {
+              return H265CodecProfile::MAIN_HIGH;
+            }
+            break;
+          case 887585792:
+            if (name == "MAIN10_MAIN")
+            {
+              return H265CodecProfile::MAIN10_MAIN;
+            }
+            break;
+          case 887444457:
+            if (name == "MAIN10_HIGH")
+            {
+              return H265CodecProfile::MAIN10_HIGH;
+            }
+            break;
+          case -1335827214:
+            if (name == "MAIN_422_8BIT_MAIN")
+            {
+              return H265CodecProfile::MAIN_422_8BIT_MAIN;
+            }
+            break;
+          case -1335968549:
+            if (name == "MAIN_422_8BIT_HIGH")
+            {
+              return H265CodecProfile::MAIN_422_8BIT_HIGH;
+            }
+            break;
+          case 303741915:
+            if (name == "MAIN_422_10BIT_MAIN")
+            {
+              return H265CodecProfile::MAIN_422_10BIT_MAIN;
+            }
+            break;
+          case 303600580:
+            if (name == "MAIN_422_10BIT_HIGH")
+            {
+              return H265CodecProfile::MAIN_422_10BIT_HIGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return H265CodecProfile::NOT_SET;
         }
 
-        Aws::String GetNameForH265CodecProfile(H265CodecProfile enumValue)
+        const char* GetNameForH265CodecProfileCStr(H265CodecProfile enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H265CodecProfile::MAIN_MAIN:
-            return "MAIN_MAIN";
-          case H265CodecProfile::MAIN_HIGH:
-            return "MAIN_HIGH";
-          case H265CodecProfile::MAIN10_MAIN:
-            return "MAIN10_MAIN";
-          case H265CodecProfile::MAIN10_HIGH:
-            return "MAIN10_HIGH";
-          case H265CodecProfile::MAIN_422_8BIT_MAIN:
-            return "MAIN_422_8BIT_MAIN";
-          case H265CodecProfile::MAIN_422_8BIT_HIGH:
-            return "MAIN_422_8BIT_HIGH";
-          case H265CodecProfile::MAIN_422_10BIT_MAIN:
-            return "MAIN_422_10BIT_MAIN";
-          case H265CodecProfile::MAIN_422_10BIT_HIGH:
-            return "MAIN_422_10BIT_HIGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH265CodecProfile(H265CodecProfile enumValue)
+        {
+          return GetNameForH265CodecProfileCStr(enumValue);
         }
 
       } // namespace H265CodecProfileMapper
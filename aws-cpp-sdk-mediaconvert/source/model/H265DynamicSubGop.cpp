@@ -30,20 +30,37 @@ namespace Aws
       namespace H265DynamicSubGopMapper
       {
 
-        static const int ADAPTIVE_HASH = HashingUtils::HashString("ADAPTIVE");
-        static const int STATIC__HASH = HashingUtils::HashString("STATIC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADAPTIVE",
+          "STATIC",
+        };
 
         H265DynamicSubGop GetH265DynamicSubGopForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADAPTIVE_HASH)
-          {
-            return H265DynamicSubGop::ADAPTIVE;
-          }
-          else if (hashCode == STATIC__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H265DynamicSubGop::STATIC_;
+          case -523385226:
+            if (name == "ADAPTIVE")
+            {
+              return H265DynamicSubGop::ADAPTIVE;
+            }
+            break;
+          case -1839152530:
+            if (name == "STATIC")
+            {
+              return H265DynamicSubGop::STATIC_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H265DynamicSubGop::NOT_SET;
         }
 
-        Aws::String GetNameForH265DynamicSubGop(H265DynamicSubGop enumValue)
+        const char* GetNameForH265DynamicSubGopCStr(H265DynamicSubGop enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H265DynamicSubGop::ADAPTIVE:
-            return "ADAPTIVE";
-          case H265DynamicSubGop::STATIC_:
-            return "STATIC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH265DynamicSubGop(H265DynamicSubGop enumValue)
+        {
+          return GetNameForH265DynamicSubGopCStr(enumValue);
         }
 
       } // namespace H265DynamicSubGopMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace H265FlickerAdaptiveQuantizationMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "ENABLED",
+        };
 
         H265FlickerAdaptiveQuantization GetH265FlickerAdaptiveQuantizationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return H265FlickerAdaptiveQuantization::DISABLED;
-          }
-          else if (hashCode == ENABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H265FlickerAdaptiveQuantization::ENABLED;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return H265FlickerAdaptiveQuantization::DISABLED;
+            }
+            break;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return H265FlickerAdaptiveQuantization::ENABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H265FlickerAdaptiveQuantization::NOT_SET;
         }
 
-        Aws::String GetNameForH265FlickerAdaptiveQuantization(H265FlickerAdaptiveQuantization enumValue)
+        const char* GetNameForH265FlickerAdaptiveQuantizationCStr(H265FlickerAdaptiveQuantization enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H265FlickerAdaptiveQuantization::DISABLED:
-            return "DISABLED";
-          case H265FlickerAdaptiveQuantization::ENABLED:
-            return "ENABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH265FlickerAdaptiveQuantization(H265FlickerAdaptiveQuantization enumValue)
+        {
+          return GetNameForH265FlickerAdaptiveQuantizationCStr(enumValue);
         }
 
       } // namespace H265FlickerAdaptiveQuantizationMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace H265GopSizeUnitsMapper
       {
 
-        static const int FRAMES_HASH = HashingUtils::HashString("FRAMES");
-        static const int SECONDS_HASH = HashingUtils::HashString("SECONDS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FRAMES",
+          "SECONDS",
+        };
 
         H265GopSizeUnits GetH265GopSizeUnitsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FRAMES_HASH)
-          {
-            return H265GopSizeUnits::FRAMES;
-          }
-          else if (hashCode == SECONDS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H265GopSizeUnits::SECONDS;
+          case 2081781926:
+            if (name == "FRAMES")
+            {
+              return H265GopSizeUnits::FRAMES;
+            }
+            break;
+          case -1606887841:
+            if (name == "SECONDS")
+            {
+              return H265GopSizeUnits::SECONDS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H265GopSizeUnits::NOT_SET;
         }
 
-        Aws::String GetNameForH265GopSizeUnits(H265GopSizeUnits enumValue)
+        const char* GetNameForH265GopSizeUnitsCStr(H265GopSizeUnits enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H265GopSizeUnits::FRAMES:
-            return "FRAMES";
-          case H265GopSizeUnits::SECONDS:
-            return "SECONDS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH265GopSizeUnits(H265GopSizeUnits enumValue)
+        {
+          return GetNameForH265GopSizeUnitsCStr(enumValue);
         }
 
       } // namespace H265GopSizeUnitsMapper
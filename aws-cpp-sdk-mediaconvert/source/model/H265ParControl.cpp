@@ -30,20 +30,37 @@ namespace Aws
       namespace H265ParControlMapper
       {
 
-        static const int INITIALIZE_FROM_SOURCE_HASH = HashingUtils::HashString("INITIALIZE_FROM_SOURCE");
-        static const int SPECIFIED_HASH = HashingUtils::HashString("SPECIFIED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INITIALIZE_FROM_SOURCE",
+          "SPECIFIED",
+        };
 
         H265ParControl GetH265ParControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZE_FROM_SOURCE_HASH)
-          {
-            return H265ParControl::INITIALIZE_FROM_SOURCE;
-          }
-          else if (hashCode == SPECIFIED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H265ParControl::SPECIFIED;
+          case -1860799455:
+            if (name == "INITIALIZE_FROM_SOURCE")
+            {
+              return H265ParControl::INITIALIZE_FROM_SOURCE;
+            }
+            break;
+          case 1091980688:
+            if (name == "SPECIFIED")
+            {
+              return H265ParControl::SPECIFIED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H265ParControl::NOT_SET;
         }
 
-        Aws::String GetNameForH265ParControl(H265ParControl enumValue)
+        const char* GetNameForH265ParControlCStr(H265ParControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H265ParControl::INITIALIZE_FROM_SOURCE:
-            return "INITIALIZE_FROM_SOURCE";
-          case H265ParControl::SPECIFIED:
-            return "SPECIFIED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH265ParControl(H265ParControl enumValue)
+        {
+          return GetNameForH265ParControlCStr(enumValue);
         }
 
       } // namespace H265ParControlMapper
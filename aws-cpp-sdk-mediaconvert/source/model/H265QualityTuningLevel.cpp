@@ -30,25 +30,44 @@ namespace Aws
       namespace H265QualityTuningLevelMapper
       {
 
-        static const int SINGLE_PASS_HASH = HashingUtils::HashString("SINGLE_PASS");
-        static const int SINGLE_PASS_HQ_HASH = HashingUtils::HashString("SINGLE_PASS_HQ");
-        static const int MULTI_PASS_HQ_HASH = HashingUtils::HashString("MULTI_PASS_HQ");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SINGLE_PASS",
+          "SINGLE_PASS_HQ",
+          "MULTI_PASS_HQ",
+        };
 
         H265QualityTuningLevel GetH265QualityTuningLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SINGLE_PASS_HASH)
-          {
-            return H265QualityTuningLevel::SINGLE_PASS;
-          }
-          else if (hashCode == SINGLE_PASS_HQ_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H265QualityTuningLevel::SINGLE_PASS_HQ;
-          }
-          else if (hashCode == MULTI_PASS_HQ_HASH)
-          {
-            return H265QualityTuningLevel::MULTI_PASS_HQ;
+          case 450660776:
+            if (name == "SINGLE_PASS")
+            {
+              return H265QualityTuningLevel::SINGLE_PASS;
+            }
+            break;
+          case -432495872:
+            if (name == "SINGLE_PASS_HQ")
+            {
+              return H265QualityTuningLevel::SINGLE_PASS_HQ;
+            }
+            break;
+          case 1997317841:
+            if (name == "MULTI_PASS_HQ")
+            {
+              return H265QualityTuningLevel::MULTI_PASS_HQ;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return H265QualityTuningLevel::NOT_SET;
         }
 
-        Aws::String GetNameForH265QualityTuningLevel(H265QualityTuningLevel enumValue)
+        const char* GetNameForH265QualityTuningLevelCStr(H265QualityTuningLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H265QualityTuningLevel::SINGLE_PASS:
-            return "SINGLE_PASS";
-          case H265QualityTuningLevel::SINGLE_PASS_HQ:
-            return "SINGLE_PASS_HQ";
-          case H265QualityTuningLevel::MULTI_PASS_HQ:
-            return "MULTI_PASS_HQ";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH265QualityTuningLevel(H265QualityTuningLevel enumValue)
+        {
+          return GetNameForH265QualityTuningLevelCStr(enumValue);
         }
 
       } // namespace H265QualityTuningLevelMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace H265SampleAdaptiveOffsetFilterModeMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int ADAPTIVE_HASH = HashingUtils::HashString("ADAPTIVE");
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "ADAPTIVE",
+          "OFF",
+        };
 
         H265SampleAdaptiveOffsetFilterMode GetH265SampleAdaptiveOffsetFilterModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return H265SampleAdaptiveOffsetFilterMode::DEFAULT;
-          }
-          else if (hashCode == ADAPTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H265SampleAdaptiveOffsetFilterMode::ADAPTIVE;
-          }
-          else if (hashCode == OFF_HASH)
-          {
-            return H265SampleAdaptiveOffsetFilterMode::OFF;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return H265SampleAdaptiveOffsetFilterMode::DEFAULT;
+            }
+            break;
+          case -523385226:
+            if (name == "ADAPTIVE")
+            {
+              return H265SampleAdaptiveOffsetFilterMode::ADAPTIVE;
+            }
+            break;
+          case 78159:
+            if (name == "OFF")
+            {
+              return H265SampleAdaptiveOffsetFilterMode::OFF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return H265SampleAdaptiveOffsetFilterMode::NOT_SET;
         }
 
-        Aws::String GetNameForH265SampleAdaptiveOffsetFilterMode(H265SampleAdaptiveOffsetFilterMode enumValue)
+        const char* GetNameForH265SampleAdaptiveOffsetFilterModeCStr(H265SampleAdaptiveOffsetFilterMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H265SampleAdaptiveOffsetFilterMode::DEFAULT:
-            return "DEFAULT";
-          case H265SampleAdaptiveOffsetFilterMode::ADAPTIVE:
-            return "ADAPTIVE";
-          case H265SampleAdaptiveOffsetFilterMode::OFF:
-            return "OFF";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH265SampleAdaptiveOffsetFilterMode(H265SampleAdaptiveOffsetFilterMode enumValue)
+        {
+          return GetNameForH265SampleAdaptiveOffsetFilterModeCStr(enumValue);
         }
 
       } // namespace H265SampleAdaptiveOffsetFilterModeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace H265TelecineMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SOFT_HASH = HashingUtils::HashString("SOFT");
-        static const int HARD_HASH = HashingUtils::HashString("HARD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "SOFT",
+          "HARD",
+        };
 
         H265Telecine GetH265TelecineForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return H265Telecine::NONE;
-          }
-          else if (hashCode == SOFT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H265Telecine::SOFT;
-          }
-          else if (hashCode == HARD_HASH)
-          {
-            return H265Telecine::HARD;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return H265Telecine::NONE;
+            }
+            break;
+          case 2550826:
+            if (name == "SOFT")
+            {
+              return H265Telecine::SOFT;
+            }
+            break;
+          case 2210027:
+            if (name == "HARD")
+            {
+              return H265Telecine::HARD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return H265Telecine::NOT_SET;
         }
 
-        Aws::String GetNameForH265Telecine(H265Telecine enumValue)
+        const char* GetNameForH265TelecineCStr(H265Telecine enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H265Telecine::NONE:
-            return "NONE";
-          case H265Telecine::SOFT:
-            return "SOFT";
-          case H265Telecine::HARD:
-            return "HARD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH265Telecine(H265Telecine enumValue)
+        {
+          return GetNameForH265TelecineCStr(enumValue);
         }
 
       } // namespace H265TelecineMapper
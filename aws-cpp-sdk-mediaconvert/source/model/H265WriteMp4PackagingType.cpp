@@ -30,20 +30,37 @@ namespace Aws
       namespace H265WriteMp4PackagingTypeMapper
       {
 
-        static const int HVC1_HASH = HashingUtils::HashString("HVC1");
-        static const int HEV1_HASH = HashingUtils::HashString("HEV1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HVC1",
+          "HEV1",
+        };
 
         H265WriteMp4PackagingType GetH265WriteMp4PackagingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HVC1_HASH)
-          {
-            return H265WriteMp4PackagingType::HVC1;
-          }
-          else if (hashCode == HEV1_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H265WriteMp4PackagingType::HEV1;
+          case 2229724:
+            if (name == "HVC1")
+            {
+              return H265WriteMp4PackagingType::HVC1;
+            }
+            break;
+          case 2213976:
+            if (name == "HEV1")
+            {
+              return H265WriteMp4PackagingType::HEV1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H265WriteMp4PackagingType::NOT_SET;
         }
 
-        Aws::String GetNameForH265WriteMp4PackagingType(H265WriteMp4PackagingType enumValue)
+        const char* GetNameForH265WriteMp4PackagingTypeCStr(H265WriteMp4PackagingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H265WriteMp4PackagingType::HVC1:
-            return "HVC1";
-          case H265WriteMp4PackagingType::HEV1:
-            return "HEV1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH265WriteMp4PackagingType(H265WriteMp4PackagingType enumValue)
+        {
+          return GetNameForH265WriteMp4PackagingTypeCStr(enumValue);
         }
 
       } // namespace H265WriteMp4PackagingTypeMapper
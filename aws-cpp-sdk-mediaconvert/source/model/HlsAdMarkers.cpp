@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsAdMarkersMapper
       {
 
-        static const int ELEMENTAL_HASH = HashingUtils::HashString("ELEMENTAL");
-        static const int ELEMENTAL_SCTE35_HASH = HashingUtils::HashString("ELEMENTAL_SCTE35");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ELEMENTAL",
+          "ELEMENTAL_SCTE35",
+        };
 
         HlsAdMarkers GetHlsAdMarkersForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ELEMENTAL_HASH)
-          {
-            return HlsAdMarkers::ELEMENTAL;
-          }
-          else if (hashCode == ELEMENTAL_SCTE35_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsAdMarkers::ELEMENTAL_SCTE35;
+          case -1766888441:
+            if (name == "ELEMENTAL")
+            {
+              return HlsAdMarkers::ELEMENTAL;
+            }
+            break;
+          case 1601234459:
+            if (name == "ELEMENTAL_SCTE35")
+            {
+              return HlsAdMarkers::ELEMENTAL_SCTE35;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsAdMarkers::NOT_SET;
         }
 
-        Aws::String GetNameForHlsAdMarkers(HlsAdMarkers enumValue)
+        const char* GetNameForHlsAdMarkersCStr(HlsAdMarkers enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsAdMarkers::ELEMENTAL:
-            return "ELEMENTAL";
-          case HlsAdMarkers::ELEMENTAL_SCTE35:
-            return "ELEMENTAL_SCTE35";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsAdMarkers(HlsAdMarkers enumValue)
+        {
+          return GetNameForHlsAdMarkersCStr(enumValue);
         }
 
       } // namespace HlsAdMarkersMapper
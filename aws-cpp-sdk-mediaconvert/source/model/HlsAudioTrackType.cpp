@@ -30,30 +30,51 @@ namespace Aws
       namespace HlsAudioTrackTypeMapper
       {
 
-        static const int ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT_HASH = HashingUtils::HashString("ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT");
-        static const int ALTERNATE_AUDIO_AUTO_SELECT_HASH = HashingUtils::HashString("ALTERNATE_AUDIO_AUTO_SELECT");
-        static const int ALTERNATE_AUDIO_NOT_AUTO_SELECT_HASH = HashingUtils::HashString("ALTERNATE_AUDIO_NOT_AUTO_SELECT");
-        static const int AUDIO_ONLY_VARIANT_STREAM_HASH = HashingUtils::HashString("AUDIO_ONLY_VARIANT_STREAM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT",
+          "ALTERNATE_AUDIO_AUTO_SELECT",
+          "ALTERNATE_AUDIO_NOT_AUTO_SELECT",
+          "AUDIO_ONLY_VARIANT_STREAM",
+        };
 
         HlsAudioTrackType GetHlsAudioTrackTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT_HASH)
-          {
-            return HlsAudioTrackType::ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT;
-          }
-          else if (hashCode == ALTERNATE_AUDIO_AUTO_SELECT_HASH)
-          {
-            return HlsAudioTrackType::ALTERNATE_AUDIO_AUTO_SELECT;
-          }
-          else if (hashCode == ALTERNATE_AUDIO_NOT_AUTO_SELECT_HASH)
-          {
-            return HlsAudioTrackType::ALTERNATE_AUDIO_NOT_AUTO_SELECT;
-          }
-          else if (hashCode == AUDIO_ONLY_VARIANT_STREAM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsAudioTrackType::AUDIO_ONLY_VARIANT_STREAM;
+          case 1958502592:
+            if (name == "ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT")
+            {
+              return HlsAudioTrackType::ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT;
+            }
+            break;
+          case -1428548130:
+            if (name == "ALTERNATE_AUDIO_AUTO_SELECT")
+            {
+              return HlsAudioTrackType::ALTERNATE_AUDIO_AUTO_SELECT;
+            }
+            break;
+          case 2037888338:
+            if (name == "ALTERNATE_AUDIO_NOT_AUTO_SELECT")
+            {
+              return HlsAudioTrackType::ALTERNATE_AUDIO_NOT_AUTO_SELECT;
+            }
+            break;
+          case 303012740:
+            if (name == "AUDIO_ONLY_VARIANT_STREAM")
+            {
+              return HlsAudioTrackType::AUDIO_ONLY_VARIANT_STREAM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return HlsAudioTrackType::NOT_SET;
         }
 
-        Aws::String GetNameForHlsAudioTrackType(HlsAudioTrackType enumValue)
+        const char* GetNameForHlsAudioTrackTypeCStr(HlsAudioTrackType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsAudioTrackType::ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT:
-            return "ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT";
-          case HlsAudioTrackType::ALTERNATE_AUDIO_AUTO_SELECT:
-            return "ALTERNATE_AUDIO_AUTO_SELECT";
-          case HlsAudioTrackType::ALTERNATE_AUDIO_NOT_AUTO_SELECT:
-            return "ALTERNATE_AUDIO_NOT_AUTO_SELECT";
-          case HlsAudioTrackType::AUDIO_ONLY_VARIANT_STREAM:
-            return "AUDIO_ONLY_VARIANT_STREAM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsAudioTrackType(HlsAudioTrackType enumValue)
+        {
+          return GetNameForHlsAudioTrackTypeCStr(enumValue);
         }
 
       } // namespace HlsAudioTrackTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsDirectoryStructureMapper
       {
 
-        static const int SINGLE_DIRECTORY_HASH = HashingUtils::HashString("SINGLE_DIRECTORY");
-        static const int SUBDIRECTORY_PER_STREAM_HASH = HashingUtils::HashString("SUBDIRECTORY_PER_STREAM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SINGLE_DIRECTORY",
+          "SUBDIRECTORY_PER_STREAM",
+        };
 
         HlsDirectoryStructure GetHlsDirectoryStructureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SINGLE_DIRECTORY_HASH)
-          {
-            return HlsDirectoryStructure::SINGLE_DIRECTORY;
-          }
-          else if (hashCode == SUBDIRECTORY_PER_STREAM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsDirectoryStructure::SUBDIRECTORY_PER_STREAM;
+          case 941680406:
+            if (name == "SINGLE_DIRECTORY")
+            {
+              return HlsDirectoryStructure::SINGLE_DIRECTORY;
+            }
+            break;
+          case 747961428:
+            if (name == "SUBDIRECTORY_PER_STREAM")
+            {
+              return HlsDirectoryStructure::SUBDIRECTORY_PER_STREAM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsDirectoryStructure::NOT_SET;
         }
 
-        Aws::String GetNameForHlsDirectoryStructure(HlsDirectoryStructure enumValue)
+        const char* GetNameForHlsDirectoryStructureCStr(HlsDirectoryStructure enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsDirectoryStructure::SINGLE_DIRECTORY:
-            return "SINGLE_DIRECTORY";
-          case HlsDirectoryStructure::SUBDIRECTORY_PER_STREAM:
-            return "SUBDIRECTORY_PER_STREAM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsDirectoryStructure(HlsDirectoryStructure enumValue)
+        {
+          return GetNameForHlsDirectoryStructureCStr(enumValue);
         }
 
       } // namespace HlsDirectoryStructureMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsEncryptionTypeMapper
       {
 
-        static const int AES128_HASH = HashingUtils::HashString("AES128");
-        static const int SAMPLE_AES_HASH = HashingUtils::HashString("SAMPLE_AES");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AES128",
+          "SAMPLE_AES",
+        };
 
         HlsEncryptionType GetHlsEncryptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES128_HASH)
-          {
-            return HlsEncryptionType::AES128;
-          }
-          else if (hashCode == SAMPLE_AES_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsEncryptionType::SAMPLE_AES;
+          case 1927139112:
+            if (name == "AES128")
+            {
+              return HlsEncryptionType::AES128;
+            }
+            break;
+          case 629518490:
+            if (name == "SAMPLE_AES")
+            {
+              return HlsEncryptionType::SAMPLE_AES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsEncryptionType::NOT_SET;
         }
 
-        Aws::String GetNameForHlsEncryptionType(HlsEncryptionType enumValue)
+        const char* GetNameForHlsEncryptionTypeCStr(HlsEncryptionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsEncryptionType::AES128:
-            return "AES128";
-          case HlsEncryptionType::SAMPLE_AES:
-            return "SAMPLE_AES";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsEncryptionType(HlsEncryptionType enumValue)
+        {
+          return GetNameForHlsEncryptionTypeCStr(enumValue);
         }
 
       } // namespace HlsEncryptionTypeMapper
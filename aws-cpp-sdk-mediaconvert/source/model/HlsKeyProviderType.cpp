@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsKeyProviderTypeMapper
       {
 
-        static const int SPEKE_HASH = HashingUtils::HashString("SPEKE");
-        static const int STATIC_KEY_HASH = HashingUtils::HashString("STATIC_KEY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SPEKE",
+          "STATIC_KEY",
+        };
 
         HlsKeyProviderType GetHlsKeyProviderTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SPEKE_HASH)
-          {
-            return HlsKeyProviderType::SPEKE;
-          }
-          else if (hashCode == STATIC_KEY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsKeyProviderType::STATIC_KEY;
+          case 79104226:
+            if (name == "SPEKE")
+            {
+              return HlsKeyProviderType::SPEKE;
+            }
+            break;
+          case 376057070:
+            if (name == "STATIC_KEY")
+            {
+              return HlsKeyProviderType::STATIC_KEY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsKeyProviderType::NOT_SET;
         }
 
-        Aws::String GetNameForHlsKeyProviderType(HlsKeyProviderType enumValue)
+        const char* GetNameForHlsKeyProviderTypeCStr(HlsKeyProviderType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsKeyProviderType::SPEKE:
-            return "SPEKE";
-          case HlsKeyProviderType::STATIC_KEY:
-            return "STATIC_KEY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsKeyProviderType(HlsKeyProviderType enumValue)
+        {
+          return GetNameForHlsKeyProviderTypeCStr(enumValue);
         }
 
       } // namespace HlsKeyProviderTypeMapper
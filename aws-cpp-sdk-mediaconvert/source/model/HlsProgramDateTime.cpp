@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsProgramDateTimeMapper
       {
 
-        static const int INCLUDE_HASH = HashingUtils::HashString("INCLUDE");
-        static const int EXCLUDE_HASH = HashingUtils::HashString("EXCLUDE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INCLUDE",
+          "EXCLUDE",
+        };
 
         HlsProgramDateTime GetHlsProgramDateTimeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INCLUDE_HASH)
-          {
-            return HlsProgramDateTime::INCLUDE;
-          }
-          else if (hashCode == EXCLUDE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsProgramDateTime::EXCLUDE;
+          case -1634410360:
+            if (name == "INCLUDE")
+            {
+              return HlsProgramDateTime::INCLUDE;
+            }
+            break;
+          case -603166278:
+            if (name == "EXCLUDE")
+            {
+              return HlsProgramDateTime::EXCLUDE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsProgramDateTime::NOT_SET;
         }
 
-        Aws::String GetNameForHlsProgramDateTime(HlsProgramDateTime enumValue)
+        const char* GetNameForHlsProgramDateTimeCStr(HlsProgramDateTime enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsProgramDateTime::INCLUDE:
-            return "INCLUDE";
-          case HlsProgramDateTime::EXCLUDE:
-            return "EXCLUDE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsProgramDateTime(HlsProgramDateTime enumValue)
+        {
+          return GetNameForHlsProgramDateTimeCStr(enumValue);
         }
 
       } // namespace HlsProgramDateTimeMapper
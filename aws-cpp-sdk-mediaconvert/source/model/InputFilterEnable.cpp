@@ -30,25 +30,44 @@ namespace Aws
       namespace InputFilterEnableMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int DISABLE_HASH = HashingUtils::HashString("DISABLE");
-        static const int FORCE_HASH = HashingUtils::HashString("FORCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTO",
+          "DISABLE",
+          "FORCE",
+        };
 
         InputFilterEnable GetInputFilterEnableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
-          {
-            return InputFilterEnable::AUTO;
-          }
-          else if (hashCode == DISABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputFilterEnable::DISABLE;
-          }
-          else if (hashCode == FORCE_HASH)
-          {
-            return InputFilterEnable::FORCE;
+          case 2020783:
+            if (name == "AUTO")
+            {
+              return InputFilterEnable::AUTO;
+            }
+            break;
+          case -1905676600:
+            if (name == "DISABLE")
+            {
+              return InputFilterEnable::DISABLE;
+            }
+            break;
+          case 67080907:
+            if (name == "FORCE")
+            {
+              return InputFilterEnable::FORCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InputFilterEnable::NOT_SET;
         }
 
-        Aws::String GetNameForInputFilterEnable(InputFilterEnable enumValue)
+        const char* GetNameForInputFilterEnableCStr(InputFilterEnable enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputFilterEnable::AUTO:
-            return "AUTO";
-          case InputFilterEnable::DISABLE:
-            return "DISABLE";
-          case InputFilterEnable::FORCE:
-            return "FORCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputFilterEnable(InputFilterEnable enumValue)
+        {
+          return GetNameForInputFilterEnableCStr(enumValue);
         }
 
       } // namespace InputFilterEnableMapper
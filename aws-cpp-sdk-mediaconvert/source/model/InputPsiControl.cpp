@@ -30,20 +30,37 @@ namespace Aws
       namespace InputPsiControlMapper
       {
 
-        static const int IGNORE_PSI_HASH = HashingUtils::HashString("IGNORE_PSI");
-        static const int USE_PSI_HASH = HashingUtils::HashString("USE_PSI");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IGNORE_PSI",
+          "USE_PSI",
+        };
 
         InputPsiControl GetInputPsiControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IGNORE_PSI_HASH)
-          {
-            return InputPsiControl::IGNORE_PSI;
-          }
-          else if (hashCode == USE_PSI_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputPsiControl::USE_PSI;
+          case 1366957753:
+            if (name == "IGNORE_PSI")
+            {
+              return InputPsiControl::IGNORE_PSI;
+            }
+            break;
+          case 571253710:
+            if (name == "USE_PSI")
+            {
+              return InputPsiControl::USE_PSI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InputPsiControl::NOT_SET;
         }
 
-        Aws::String GetNameForInputPsiControl(InputPsiControl enumValue)
+        const char* GetNameForInputPsiControlCStr(InputPsiControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputPsiControl::IGNORE_PSI:
-            return "IGNORE_PSI";
-          case InputPsiControl::USE_PSI:
-            return "USE_PSI";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputPsiControl(InputPsiControl enumValue)
+        {
+          return GetNameForInputPsiControlCStr(enumValue);
         }
 
       } // namespace InputPsiControlMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace InputTimecodeSourceMapper
       {
 
-        static const int EMBEDDED_HASH = HashingUtils::HashString("EMBEDDED");
-        static const int ZEROBASED_HASH = HashingUtils::HashString("ZEROBASED");
-        static const int SPECIFIEDSTART_HASH = HashingUtils::HashString("SPECIFIEDSTART");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EMBEDDED",
+          "ZEROBASED",
+          "SPECIFIEDSTART",
+        };
 
         InputTimecodeSource GetInputTimecodeSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EMBEDDED_HASH)
-          {
-            return InputTimecodeSource::EMBEDDED;
-          }
-          else if (hashCode == ZEROBASED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputTimecodeSource::ZEROBASED;
-          }
-          else if (hashCode == SPECIFIEDSTART_HASH)
-          {
-            return InputTimecodeSource::SPECIFIEDSTART;
+          case 1568475786:
+            if (name == "EMBEDDED")
+            {
+              return InputTimecodeSource::EMBEDDED;
+            }
+            break;
+          case -1676751381:
+            if (name == "ZEROBASED")
+            {
+              return InputTimecodeSource::ZEROBASED;
+            }
+            break;
+          case 1547991218:
+            if (name == "SPECIFIEDSTART")
+            {
+              return InputTimecodeSource::SPECIFIEDSTART;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InputTimecodeSource::NOT_SET;
         }
 
-        Aws::String GetNameForInputTimecodeSource(InputTimecodeSource enumValue)
+        const char* GetNameForInputTimecodeSourceCStr(InputTimecodeSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputTimecodeSource::EMBEDDED:
-            return "EMBEDDED";
-          case InputTimecodeSource::ZEROBASED:
-            return "ZEROBASED";
-          case InputTimecodeSource::SPECIFIEDSTART:
-            return "SPECIFIEDSTART";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputTimecodeSource(InputTimecodeSource enumValue)
+        {
+          return GetNameForInputTimecodeSourceCStr(enumValue);
         }
 
       } // namespace InputTimecodeSourceMapper
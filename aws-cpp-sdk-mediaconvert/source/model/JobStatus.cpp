@@ -30,35 +30,58 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int PROGRESSING_HASH = HashingUtils::HashString("PROGRESSING");
-        static const int COMPLETE_HASH = HashingUtils::HashString("COMPLETE");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUBMITTED",
+          "PROGRESSING",
+          "COMPLETE",
+          "CANCELED",
+          "ERROR",
+        };
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobStatus::SUBMITTED;
-          }
-          else if (hashCode == PROGRESSING_HASH)
-          {
-            return JobStatus::PROGRESSING;
-          }
-          else if (hashCode == COMPLETE_HASH)
-          {
-            return JobStatus::COMPLETE;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return JobStatus::CANCELED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return JobStatus::ERROR_;
+          case -1159694117:
+            if (name == "SUBMITTED")
+            {
+              return JobStatus::SUBMITTED;
+            }
+            break;
+          case -1010459019:
+            if (name == "PROGRESSING")
+            {
+              return JobStatus::PROGRESSING;
+            }
+            break;
+          case 183181625:
+            if (name == "COMPLETE")
+            {
+              return JobStatus::COMPLETE;
+            }
+            break;
+          case 659453081:
+            if (name == "CANCELED")
+            {
+              return JobStatus::CANCELED;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return JobStatus::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatusCStr(JobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobStatus::SUBMITTED:
-            return "SUBMITTED";
-          case JobStatus::PROGRESSING:
-            return "PROGRESSING";
-          case JobStatus::COMPLETE:
-            return "COMPLETE";
-          case JobStatus::CANCELED:
-            return "CANCELED";
-          case JobStatus::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        {
+          return GetNameForJobStatusCStr(enumValue);
         }
 
       } // namespace JobStatusMapper
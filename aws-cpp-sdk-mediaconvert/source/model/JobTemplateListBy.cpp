@@ -30,25 +30,44 @@ namespace Aws
       namespace JobTemplateListByMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int CREATION_DATE_HASH = HashingUtils::HashString("CREATION_DATE");
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NAME",
+          "CREATION_DATE",
+          "SYSTEM",
+        };
 
         JobTemplateListBy GetJobTemplateListByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
-          {
-            return JobTemplateListBy::NAME;
-          }
-          else if (hashCode == CREATION_DATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobTemplateListBy::CREATION_DATE;
-          }
-          else if (hashCode == SYSTEM_HASH)
-          {
-            return JobTemplateListBy::SYSTEM;
+          case 2388619:
+            if (name == "NAME")
+            {
+              return JobTemplateListBy::NAME;
+            }
+            break;
+          case 782677262:
+            if (name == "CREATION_DATE")
+            {
+              return JobTemplateListBy::CREATION_DATE;
+            }
+            break;
+          case -1833998801:
+            if (name == "SYSTEM")
+            {
+              return JobTemplateListBy::SYSTEM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return JobTemplateListBy::NOT_SET;
         }
 
-        Aws::String GetNameForJobTemplateListBy(JobTemplateListBy enumValue)
+        const char* GetNameForJobTemplateListByCStr(JobTemplateListBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobTemplateListBy::NAME:
-            return "NAME";
-          case JobTemplateListBy::CREATION_DATE:
-            return "CREATION_DATE";
-          case JobTemplateListBy::SYSTEM:
-            return "SYSTEM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobTemplateListBy(JobTemplateListBy enumValue)
+        {
+          return GetNameForJobTemplateListByCStr(enumValue);
         }
 
       } // namespace JobTemplateListByMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsAudioBufferModelMapper
       {
 
-        static const int DVB_HASH = HashingUtils::HashString("DVB");
-        static const int ATSC_HASH = HashingUtils::HashString("ATSC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DVB",
+          "ATSC",
+        };
 
         M2tsAudioBufferModel GetM2tsAudioBufferModelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DVB_HASH)
-          {
-            return M2tsAudioBufferModel::DVB;
-          }
-          else if (hashCode == ATSC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsAudioBufferModel::ATSC;
+          case 68080:
+            if (name == "DVB")
+            {
+              return M2tsAudioBufferModel::DVB;
+            }
+            break;
+          case 2019779:
+            if (name == "ATSC")
+            {
+              return M2tsAudioBufferModel::ATSC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsAudioBufferModel::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsAudioBufferModel(M2tsAudioBufferModel enumValue)
+        const char* GetNameForM2tsAudioBufferModelCStr(M2tsAudioBufferModel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsAudioBufferModel::DVB:
-            return "DVB";
-          case M2tsAudioBufferModel::ATSC:
-            return "ATSC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsAudioBufferModel(M2tsAudioBufferModel enumValue)
+        {
+          return GetNameForM2tsAudioBufferModelCStr(enumValue);
         }
 
       } // namespace M2tsAudioBufferModelMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsEbpAudioIntervalMapper
       {
 
-        static const int VIDEO_AND_FIXED_INTERVALS_HASH = HashingUtils::HashString("VIDEO_AND_FIXED_INTERVALS");
-        static const int VIDEO_INTERVAL_HASH = HashingUtils::HashString("VIDEO_INTERVAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VIDEO_AND_FIXED_INTERVALS",
+          "VIDEO_INTERVAL",
+        };
 
         M2tsEbpAudioInterval GetM2tsEbpAudioIntervalForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VIDEO_AND_FIXED_INTERVALS_HASH)
-          {
-            return M2tsEbpAudioInterval::VIDEO_AND_FIXED_INTERVALS;
-          }
-          else if (hashCode == VIDEO_INTERVAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsEbpAudioInterval::VIDEO_INTERVAL;
+          case 1431996567:
+            if (name == "VIDEO_AND_FIXED_INTERVALS")
+            {
+              return M2tsEbpAudioInterval::VIDEO_AND_FIXED_INTERVALS;
+            }
+            break;
+          case -915955671:
+            if (name == "VIDEO_INTERVAL")
+            {
+              return M2tsEbpAudioInterval::VIDEO_INTERVAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsEbpAudioInterval::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsEbpAudioInterval(M2tsEbpAudioInterval enumValue)
+        const char* GetNameForM2tsEbpAudioIntervalCStr(M2tsEbpAudioInterval enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsEbpAudioInterval::VIDEO_AND_FIXED_INTERVALS:
-            return "VIDEO_AND_FIXED_INTERVALS";
-          case M2tsEbpAudioInterval::VIDEO_INTERVAL:
-            return "VIDEO_INTERVAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsEbpAudioInterval(M2tsEbpAudioInterval enumValue)
+        {
+          return GetNameForM2tsEbpAudioIntervalCStr(enumValue);
         }
 
       } // namespace M2tsEbpAudioIntervalMapper
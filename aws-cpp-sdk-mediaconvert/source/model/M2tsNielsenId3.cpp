@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsNielsenId3Mapper
       {
 
-        static const int INSERT_HASH = HashingUtils::HashString("INSERT");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INSERT",
+          "NONE",
+        };
 
         M2tsNielsenId3 GetM2tsNielsenId3ForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSERT_HASH)
-          {
-            return M2tsNielsenId3::INSERT;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsNielsenId3::NONE;
+          case -2130463047:
+            if (name == "INSERT")
+            {
+              return M2tsNielsenId3::INSERT;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return M2tsNielsenId3::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsNielsenId3::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsNielsenId3(M2tsNielsenId3 enumValue)
+        const char* GetNameForM2tsNielsenId3CStr(M2tsNielsenId3 enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsNielsenId3::INSERT:
-            return "INSERT";
-          case M2tsNielsenId3::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsNielsenId3(M2tsNielsenId3 enumValue)
+        {
+          return GetNameForM2tsNielsenId3CStr(enumValue);
         }
 
       } // namespace M2tsNielsenId3Mapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsPcrControlMapper
       {
 
-        static const int PCR_EVERY_PES_PACKET_HASH = HashingUtils::HashString("PCR_EVERY_PES_PACKET");
-        static const int CONFIGURED_PCR_PERIOD_HASH = HashingUtils::HashString("CONFIGURED_PCR_PERIOD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PCR_EVERY_PES_PACKET",
+          "CONFIGURED_PCR_PERIOD",
+        };
 
         M2tsPcrControl GetM2tsPcrControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PCR_EVERY_PES_PACKET_HASH)
-          {
-            return M2tsPcrControl::PCR_EVERY_PES_PACKET;
-          }
-          else if (hashCode == CONFIGURED_PCR_PERIOD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsPcrControl::CONFIGURED_PCR_PERIOD;
+          case 1969435181:
+            if (name == "PCR_EVERY_PES_PACKET")
+            {
+              return M2tsPcrControl::PCR_EVERY_PES_PACKET;
+            }
+            break;
+          case 500361698:
+            if (name == "CONFIGURED_PCR_PERIOD")
+            {
+              return M2tsPcrControl::CONFIGURED_PCR_PERIOD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsPcrControl::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsPcrControl(M2tsPcrControl enumValue)
+        const char* GetNameForM2tsPcrControlCStr(M2tsPcrControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsPcrControl::PCR_EVERY_PES_PACKET:
-            return "PCR_EVERY_PES_PACKET";
-          case M2tsPcrControl::CONFIGURED_PCR_PERIOD:
-            return "CONFIGURED_PCR_PERIOD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsPcrControl(M2tsPcrControl enumValue)
+        {
+          return GetNameForM2tsPcrControlCStr(enumValue);
         }
 
       } // namespace M2tsPcrControlMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace M2tsSegmentationMarkersMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int RAI_SEGSTART_HASH = HashingUtils::HashString("RAI_SEGSTART");
-        static const int RAI_ADAPT_HASH = HashingUtils::HashString("RAI_ADAPT");
-        static const int PSI_SEGSTART_HASH = HashingUtils::HashString("PSI_SEGSTART");
-        static const int EBP_HASH = HashingUtils::HashString("EBP");
-        static const int EBP_LEGACY_HASH = HashingUtils::HashString("EBP_LEGACY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "RAI_SEGSTART",
+          "RAI_ADAPT",
+          "PSI_SEGSTART",
+          "EBP",
+          "EBP_LEGACY",
+        };
 
         M2tsSegmentationMarkers GetM2tsSegmentationMarkersForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return M2tsSegmentationMarkers::NONE;
-          }
-          else if (hashCode == RAI_SEGSTART_HASH)
-          {
-            return M2tsSegmentationMarkers::RAI_SEGSTART;
-          }
-          else if (hashCode == RAI_ADAPT_HASH)
-          {
-            return M2tsSegmentationMarkers::RAI_ADAPT;
-          }
-          else if (hashCode == PSI_SEGSTART_HASH)
-          {
-            return M2tsSegmentationMarkers::PSI_SEGSTART;
-          }
-          else if (hashCode == EBP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsSegmentationMarkers::EBP;
-          }
-          else if (hashCode == EBP_LEGACY_HASH)
-          {
-            return M2tsSegmentationMarkers::EBP_LEGACY;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return M2tsSegmentationMarkers::NONE;
+            }
+            break;
+          case 1631531986:
+            if (name == "RAI_SEGSTART")
+            {
+              return M2tsSegmentationMarkers::RAI_SEGSTART;
+            }
+            break;
+          case -1718674819:
+            if (name == "RAI_ADAPT")
+            {
+              return M2tsSegmentationMarkers::RAI_ADAPT;
+            }
+            break;
+          case -906986842:
+            if (name == "PSI_SEGSTART")
+            {
+              return M2tsSegmentationMarkers::PSI_SEGSTART;
+            }
+            break;
+          case 68435:
+            if (name == "EBP")
+            {
+              return M2tsSegmentationMarkers::EBP;
+            }
+            break;
+          case -1361312203:
+            if (name == "EBP_LEGACY")
+            {
+              return M2tsSegmentationMarkers::EBP_LEGACY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return M2tsSegmentationMarkers::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsSegmentationMarkers(M2tsSegmentationMarkers enumValue)
+        const char* GetNameForM2tsSegmentationMarkersCStr(M2tsSegmentationMarkers enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsSegmentationMarkers::NONE:
-            return "NONE";
-          case M2tsSegmentationMarkers::RAI_SEGSTART:
-            return "RAI_SEGSTART";
-          case M2tsSegmentationMarkers::RAI_ADAPT:
-            return "RAI_ADAPT";
-          case M2tsSegmentationMarkers::PSI_SEGSTART:
-            return "PSI_SEGSTART";
-          case M2tsSegmentationMarkers::EBP:
-            return "EBP";
-          case M2tsSegmentationMarkers::EBP_LEGACY:
-            return "EBP_LEGACY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsSegmentationMarkers(M2tsSegmentationMarkers enumValue)
+        {
+          return GetNameForM2tsSegmentationMarkersCStr(enumValue);
         }
 
       } // namespace M2tsSegmentationMarkersMapper
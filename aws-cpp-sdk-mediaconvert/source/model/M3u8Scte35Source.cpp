@@ -30,20 +30,37 @@ namespace Aws
       namespace M3u8Scte35SourceMapper
       {
 
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PASSTHROUGH",
+          "NONE",
+        };
 
         M3u8Scte35Source GetM3u8Scte35SourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PASSTHROUGH_HASH)
-          {
-            return M3u8Scte35Source::PASSTHROUGH;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M3u8Scte35Source::NONE;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return M3u8Scte35Source::PASSTHROUGH;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return M3u8Scte35Source::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M3u8Scte35Source::NOT_SET;
         }
 
-        Aws::String GetNameForM3u8Scte35Source(M3u8Scte35Source enumValue)
+        const char* GetNameForM3u8Scte35SourceCStr(M3u8Scte35Source enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M3u8Scte35Source::PASSTHROUGH:
-            return "PASSTHROUGH";
-          case M3u8Scte35Source::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM3u8Scte35Source(M3u8Scte35Source enumValue)
+        {
+          return GetNameForM3u8Scte35SourceCStr(enumValue);
         }
 
       } // namespace M3u8Scte35SourceMapper
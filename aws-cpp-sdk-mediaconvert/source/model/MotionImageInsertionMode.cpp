@@ -30,20 +30,37 @@ namespace Aws
       namespace MotionImageInsertionModeMapper
       {
 
-        static const int MOV_HASH = HashingUtils::HashString("MOV");
-        static const int PNG_HASH = HashingUtils::HashString("PNG");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MOV",
+          "PNG",
+        };
 
         MotionImageInsertionMode GetMotionImageInsertionModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MOV_HASH)
-          {
-            return MotionImageInsertionMode::MOV;
-          }
-          else if (hashCode == PNG_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MotionImageInsertionMode::PNG;
+          case 76532:
+            if (name == "MOV")
+            {
+              return MotionImageInsertionMode::MOV;
+            }
+            break;
+          case 79369:
+            if (name == "PNG")
+            {
+              return MotionImageInsertionMode::PNG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MotionImageInsertionMode::NOT_SET;
         }
 
-        Aws::String GetNameForMotionImageInsertionMode(MotionImageInsertionMode enumValue)
+        const char* GetNameForMotionImageInsertionModeCStr(MotionImageInsertionMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MotionImageInsertionMode::MOV:
-            return "MOV";
-          case MotionImageInsertionMode::PNG:
-            return "PNG";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMotionImageInsertionMode(MotionImageInsertionMode enumValue)
+        {
+          return GetNameForMotionImageInsertionModeCStr(enumValue);
         }
 
       } // namespace MotionImageInsertionModeMapper
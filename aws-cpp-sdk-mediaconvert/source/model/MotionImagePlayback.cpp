@@ -30,20 +30,37 @@ namespace Aws
       namespace MotionImagePlaybackMapper
       {
 
-        static const int ONCE_HASH = HashingUtils::HashString("ONCE");
-        static const int REPEAT_HASH = HashingUtils::HashString("REPEAT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ONCE",
+          "REPEAT",
+        };
 
         MotionImagePlayback GetMotionImagePlaybackForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONCE_HASH)
-          {
-            return MotionImagePlayback::ONCE;
-          }
-          else if (hashCode == REPEAT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MotionImagePlayback::REPEAT;
+          case 2430593:
+            if (name == "ONCE")
+            {
+              return MotionImagePlayback::ONCE;
+            }
+            break;
+          case -1881202277:
+            if (name == "REPEAT")
+            {
+              return MotionImagePlayback::REPEAT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MotionImagePlayback::NOT_SET;
         }
 
-        Aws::String GetNameForMotionImagePlayback(MotionImagePlayback enumValue)
+        const char* GetNameForMotionImagePlaybackCStr(MotionImagePlayback enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MotionImagePlayback::ONCE:
-            return "ONCE";
-          case MotionImagePlayback::REPEAT:
-            return "REPEAT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMotionImagePlayback(MotionImagePlayback enumValue)
+        {
+          return GetNameForMotionImagePlaybackCStr(enumValue);
         }
 
       } // namespace MotionImagePlaybackMapper
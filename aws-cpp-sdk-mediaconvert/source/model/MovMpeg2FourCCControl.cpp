@@ -30,20 +30,37 @@ namespace Aws
       namespace MovMpeg2FourCCControlMapper
       {
 
-        static const int XDCAM_HASH = HashingUtils::HashString("XDCAM");
-        static const int MPEG_HASH = HashingUtils::HashString("MPEG");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "XDCAM",
+          "MPEG",
+        };
 
         MovMpeg2FourCCControl GetMovMpeg2FourCCControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == XDCAM_HASH)
-          {
-            return MovMpeg2FourCCControl::XDCAM;
-          }
-          else if (hashCode == MPEG_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MovMpeg2FourCCControl::MPEG;
+          case 83362115:
+            if (name == "XDCAM")
+            {
+              return MovMpeg2FourCCControl::XDCAM;
+            }
+            break;
+          case 2372997:
+            if (name == "MPEG")
+            {
+              return MovMpeg2FourCCControl::MPEG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MovMpeg2FourCCControl::NOT_SET;
         }
 
-        Aws::String GetNameForMovMpeg2FourCCControl(MovMpeg2FourCCControl enumValue)
+        const char* GetNameForMovMpeg2FourCCControlCStr(MovMpeg2FourCCControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MovMpeg2FourCCControl::XDCAM:
-            return "XDCAM";
-          case MovMpeg2FourCCControl::MPEG:
-            return "MPEG";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMovMpeg2FourCCControl(MovMpeg2FourCCControl enumValue)
+        {
+          return GetNameForMovMpeg2FourCCControlCStr(enumValue);
         }
 
       } // namespace MovMpeg2FourCCControlMapper
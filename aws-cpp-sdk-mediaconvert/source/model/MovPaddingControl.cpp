@@ -30,20 +30,37 @@ namespace Aws
       namespace MovPaddingControlMapper
       {
 
-        static const int OMNEON_HASH = HashingUtils::HashString("OMNEON");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OMNEON",
+          "NONE",
+        };
 
         MovPaddingControl GetMovPaddingControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OMNEON_HASH)
-          {
-            return MovPaddingControl::OMNEON;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MovPaddingControl::NONE;
+          case -1959760716:
+            if (name == "OMNEON")
+            {
+              return MovPaddingControl::OMNEON;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return MovPaddingControl::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MovPaddingControl::NOT_SET;
         }
 
-        Aws::String GetNameForMovPaddingControl(MovPaddingControl enumValue)
+        const char* GetNameForMovPaddingControlCStr(MovPaddingControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MovPaddingControl::OMNEON:
-            return "OMNEON";
-          case MovPaddingControl::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMovPaddingControl(MovPaddingControl enumValue)
+        {
+          return GetNameForMovPaddingControlCStr(enumValue);
         }
 
       } // namespace MovPaddingControlMapper
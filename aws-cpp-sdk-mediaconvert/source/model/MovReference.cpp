@@ -30,20 +30,37 @@ namespace Aws
       namespace MovReferenceMapper
       {
 
-        static const int SELF_CONTAINED_HASH = HashingUtils::HashString("SELF_CONTAINED");
-        static const int EXTERNAL_HASH = HashingUtils::HashString("EXTERNAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SELF_CONTAINED",
+          "EXTERNAL",
+        };
 
         MovReference GetMovReferenceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SELF_CONTAINED_HASH)
-          {
-            return MovReference::SELF_CONTAINED;
-          }
-          else if (hashCode == EXTERNAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MovReference::EXTERNAL;
+          case -1202098400:
+            if (name == "SELF_CONTAINED")
+            {
+              return MovReference::SELF_CONTAINED;
+            }
+            break;
+          case -1038134325:
+            if (name == "EXTERNAL")
+            {
+              return MovReference::EXTERNAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MovReference::NOT_SET;
         }
 
-        Aws::String GetNameForMovReference(MovReference enumValue)
+        const char* GetNameForMovReferenceCStr(MovReference enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MovReference::SELF_CONTAINED:
-            return "SELF_CONTAINED";
-          case MovReference::EXTERNAL:
-            return "EXTERNAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMovReference(MovReference enumValue)
+        {
+          return GetNameForMovReferenceCStr(enumValue);
         }
 
       } // namespace MovReferenceMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace Mp4FreeSpaceBoxMapper
       {
 
-        static const int INCLUDE_HASH = HashingUtils::HashString("INCLUDE");
-        static const int EXCLUDE_HASH = HashingUtils::HashString("EXCLUDE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INCLUDE",
+          "EXCLUDE",
+        };
 
         Mp4FreeSpaceBox GetMp4FreeSpaceBoxForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INCLUDE_HASH)
-          {
-            return Mp4FreeSpaceBox::INCLUDE;
-          }
-          else if (hashCode == EXCLUDE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mp4FreeSpaceBox::EXCLUDE;
+          case -1634410360:
+            if (name == "INCLUDE")
+            {
+              return Mp4FreeSpaceBox::INCLUDE;
+            }
+            break;
+          case -603166278:
+            if (name == "EXCLUDE")
+            {
+              return Mp4FreeSpaceBox::EXCLUDE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Mp4FreeSpaceBox::NOT_SET;
         }
 
-        Aws::String GetNameForMp4FreeSpaceBox(Mp4FreeSpaceBox enumValue)
+        const char* GetNameForMp4FreeSpaceBoxCStr(Mp4FreeSpaceBox enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mp4FreeSpaceBox::INCLUDE:
-            return "INCLUDE";
-          case Mp4FreeSpaceBox::EXCLUDE:
-            return "EXCLUDE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMp4FreeSpaceBox(Mp4FreeSpaceBox enumValue)
+        {
+          return GetNameForMp4FreeSpaceBoxCStr(enumValue);
         }
 
       } // namespace Mp4FreeSpaceBoxMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace Mp4MoovPlacementMapper
       {
 
-        static const int PROGRESSIVE_DOWNLOAD_HASH = HashingUtils::HashString("PROGRESSIVE_DOWNLOAD");
-        static const int NORMAL_HASH = HashingUtils::HashString("NORMAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PROGRESSIVE_DOWNLOAD",
+          "NORMAL",
+        };
 
         Mp4MoovPlacement GetMp4MoovPlacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROGRESSIVE_DOWNLOAD_HASH)
-          {
-            return Mp4MoovPlacement::PROGRESSIVE_DOWNLOAD;
-          }
-          else if (hashCode == NORMAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mp4MoovPlacement::NORMAL;
+          case -353013028:
+            if (name == "PROGRESSIVE_DOWNLOAD")
+            {
+              return Mp4MoovPlacement::PROGRESSIVE_DOWNLOAD;
+            }
+            break;
+          case -1986416409:
+            if (name == "NORMAL")
+            {
+              return Mp4MoovPlacement::NORMAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Mp4MoovPlacement::NOT_SET;
         }
 
-        Aws::String GetNameForMp4MoovPlacement(Mp4MoovPlacement enumValue)
+        const char* GetNameForMp4MoovPlacementCStr(Mp4MoovPlacement enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mp4MoovPlacement::PROGRESSIVE_DOWNLOAD:
-            return "PROGRESSIVE_DOWNLOAD";
-          case Mp4MoovPlacement::NORMAL:
-            return "NORMAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMp4MoovPlacement(Mp4MoovPlacement enumValue)
+        {
+          return GetNameForMp4MoovPlacementCStr(enumValue);
         }
 
       } // namespace Mp4MoovPlacementMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace Mpeg2AdaptiveQuantizationMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OFF",
+          "LOW",
+          "MEDIUM",
+          "HIGH",
+        };
 
         Mpeg2AdaptiveQuantization GetMpeg2AdaptiveQuantizationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
-          {
-            return Mpeg2AdaptiveQuantization::OFF;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return Mpeg2AdaptiveQuantization::LOW;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return Mpeg2AdaptiveQuantization::MEDIUM;
-          }
-          else if (hashCode == HIGH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mpeg2AdaptiveQuantization::HIGH;
+          case 78159:
+            if (name == "OFF")
+            {
+              return Mpeg2AdaptiveQuantization::OFF;
+            }
+            break;
+          case 75572:
+            if (name == "LOW")
+            {
+              return Mpeg2AdaptiveQuantization::LOW;
+            }
+            break;
+          case -2024701067:
+            if (name == "MEDIUM")
+            {
+              return Mpeg2AdaptiveQuantization::MEDIUM;
+            }
+            break;
+          case 2217378:
+            if (name == "HIGH")
+            {
+              return Mpeg2AdaptiveQuantization::HIGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Mpeg2AdaptiveQuantization::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2AdaptiveQuantization(Mpeg2AdaptiveQuantization enumValue)
+        const char* GetNameForMpeg2AdaptiveQuantizationCStr(Mpeg2AdaptiveQuantization enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mpeg2AdaptiveQuantization::OFF:
-            return "OFF";
-          case Mpeg2AdaptiveQuantization::LOW:
-            return "LOW";
-          case Mpeg2AdaptiveQuantization::MEDIUM:
-            return "MEDIUM";
-          case Mpeg2AdaptiveQuantization::HIGH:
-            return "HIGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMpeg2AdaptiveQuantization(Mpeg2AdaptiveQuantization enumValue)
+        {
+          return GetNameForMpeg2AdaptiveQuantizationCStr(enumValue);
         }
 
       } // namespace Mpeg2AdaptiveQuantizationMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace Mpeg2CodecLevelMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int MAIN_HASH = HashingUtils::HashString("MAIN");
-        static const int HIGH1440_HASH = HashingUtils::HashString("HIGH1440");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTO",
+          "LOW",
+          "MAIN",
+          "HIGH1440",
+          "HIGH",
+        };
 
         Mpeg2CodecLevel GetMpeg2CodecLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mpeg2CodecLevel::AUTO;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return Mpeg2CodecLevel::LOW;
-          }
-          else if (hashCode == MAIN_HASH)
-          {
-            return Mpeg2CodecLevel::MAIN;
-          }
-          else if (hashCode == HIGH1440_HASH)
-          {
-            return Mpeg2CodecLevel::HIGH1440;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return Mpeg2CodecLevel::HIGH;
+          case 2020783:
+            if (name == "AUTO")
+            {
+              return Mpeg2CodecLevel::AUTO;
+            }
+            break;
+          case 75572:
+            if (name == "LOW")
+            {
+              return Mpeg2CodecLevel::LOW;
+            }
+            break;
+          case 2358713:
+            if (name == "MAIN")
+            {
+              return Mpeg2CodecLevel::MAIN;
+            }
+            break;
+          case -902740863:
+            if (name == "HIGH1440")
+            {
+              return Mpeg2CodecLevel::HIGH1440;
+            }
+            break;
+          case 2217378:
+            if (name == "HIGH")
+            {
+              return Mpeg2CodecLevel::HIGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return Mpeg2CodecLevel::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2CodecLevel(Mpeg2CodecLevel enumValue)
+        const char* GetNameForMpeg2CodecLevelCStr(Mpeg2CodecLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mpeg2CodecLevel::AUTO:
-            return "AUTO";
-          case Mpeg2CodecLevel::LOW:
-            return "LOW";
-          case Mpeg2CodecLevel::MAIN:
-            return "MAIN";
-          case Mpeg2CodecLevel::HIGH1440:
-            return "HIGH1440";
-          case Mpeg2CodecLevel::HIGH:
-            return "HIGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMpeg2CodecLevel(Mpeg2CodecLevel enumValue)
+        {
+          return GetNameForMpeg2CodecLevelCStr(enumValue);
         }
 
       } // namespace Mpeg2CodecLevelMapper
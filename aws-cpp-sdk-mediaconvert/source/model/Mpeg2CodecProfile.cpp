@@ -30,20 +30,37 @@ namespace Aws
       namespace Mpeg2CodecProfileMapper
       {
 
-        static const int MAIN_HASH = HashingUtils::HashString("MAIN");
-        static const int PROFILE_422_HASH = HashingUtils::HashString("PROFILE_422");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MAIN",
+          "PROFILE_422",
+        };
 
         Mpeg2CodecProfile GetMpeg2CodecProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAIN_HASH)
-          {
-            return Mpeg2CodecProfile::MAIN;
-          }
-          else if (hashCode == PROFILE_422_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mpeg2CodecProfile::PROFILE_422;
+          case 2358713:
+            if (name == "MAIN")
+            {
+              return Mpeg2CodecProfile::MAIN;
+            }
+            break;
+          case -1963056706:
+            if (name == "PROFILE_422")
+            {
+              return Mpeg2CodecProfile::PROFILE_422;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Mpeg2CodecProfile::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2CodecProfile(Mpeg2CodecProfile enumValue)
+        const char* GetNameForMpeg2CodecProfileCStr(Mpeg2CodecProfile enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mpeg2CodecProfile::MAIN:
-            return "MAIN";
-          case Mpeg2CodecProfile::PROFILE_422:
-            return "PROFILE_422";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMpeg2CodecProfile(Mpeg2CodecProfile enumValue)
+        {
+          return GetNameForMpeg2CodecProfileCStr(enumValue);
         }
 
       } // namespace Mpeg2CodecProfileMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace Mpeg2DynamicSubGopMapper
       {
 
-        static const int ADAPTIVE_HASH = HashingUtils::HashString("ADAPTIVE");
-        static const int STATIC__HASH = HashingUtils::HashString("STATIC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADAPTIVE",
+          "STATIC",
+        };
 
         Mpeg2DynamicSubGop GetMpeg2DynamicSubGopForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADAPTIVE_HASH)
-          {
-            return Mpeg2DynamicSubGop::ADAPTIVE;
-          }
-          else if (hashCode == STATIC__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mpeg2DynamicSubGop::STATIC_;
+          case -523385226:
+            if (name == "ADAPTIVE")
+            {
+              return Mpeg2DynamicSubGop::ADAPTIVE;
+            }
+            break;
+          case -1839152530:
+            if (name == "STATIC")
+            {
+              return Mpeg2DynamicSubGop::STATIC_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Mpeg2DynamicSubGop::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2DynamicSubGop(Mpeg2DynamicSubGop enumValue)
+        const char* GetNameForMpeg2DynamicSubGopCStr(Mpeg2DynamicSubGop enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mpeg2DynamicSubGop::ADAPTIVE:
-            return "ADAPTIVE";
-          case Mpeg2DynamicSubGop::STATIC_:
-            return "STATIC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMpeg2DynamicSubGop(Mpeg2DynamicSubGop enumValue)
+        {
+          return GetNameForMpeg2DynamicSubGopCStr(enumValue);
         }
 
       } // namespace Mpeg2DynamicSubGopMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace Mpeg2IntraDcPrecisionMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int INTRA_DC_PRECISION_8_HASH = HashingUtils::HashString("INTRA_DC_PRECISION_8");
-        static const int INTRA_DC_PRECISION_9_HASH = HashingUtils::HashString("INTRA_DC_PRECISION_9");
-        static const int INTRA_DC_PRECISION_10_HASH = HashingUtils::HashString("INTRA_DC_PRECISION_10");
-        static const int INTRA_DC_PRECISION_11_HASH = HashingUtils::HashString("INTRA_DC_PRECISION_11");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTO",
+          "INTRA_DC_PRECISION_8",
+          "INTRA_DC_PRECISION_9",
+          "INTRA_DC_PRECISION_10",
+          "INTRA_DC_PRECISION_11",
+        };
 
         Mpeg2IntraDcPrecision GetMpeg2IntraDcPrecisionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mpeg2IntraDcPrecision::AUTO;
-          }
-          else if (hashCode == INTRA_DC_PRECISION_8_HASH)
-          {
-            return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_8;
-          }
-          else if (hashCode == INTRA_DC_PRECISION_9_HASH)
-          {
-            return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_9;
-          }
-          else if (hashCode == INTRA_DC_PRECISION_10_HASH)
-          {
-            return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_10;
-          }
-          else if (hashCode == INTRA_DC_PRECISION_11_HASH)
-          {
-            return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_11;
+          case 2020783:
+            if (name == "AUTO")
+            {
+              return Mpeg2IntraDcPrecision::AUTO;
+            }
+            break;
+          case -2034283272:
+            if (name == "INTRA_DC_PRECISION_8")
+            {
+              return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_8;
+            }
+            break;
+          case -2034283271:
+            if (name == "INTRA_DC_PRECISION_9")
+            {
+              return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_9;
+            }
+            break;
+          case 1361727839:
+            if (name == "INTRA_DC_PRECISION_10")
+            {
+              return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_10;
+            }
+            break;
+          case 1361727840:
+            if (name == "INTRA_DC_PRECISION_11")
+            {
+              return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_11;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return Mpeg2IntraDcPrecision::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2IntraDcPrecision(Mpeg2IntraDcPrecision enumValue)
+        const char* GetNameForMpeg2IntraDcPrecisionCStr(Mpeg2IntraDcPrecision enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mpeg2IntraDcPrecision::AUTO:
-            return "AUTO";
-          case Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_8:
-            return "INTRA_DC_PRECISION_8";
-          case Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_9:
-            return "INTRA_DC_PRECISION_9";
-          case Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_10:
-            return "INTRA_DC_PRECISION_10";
-          case Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_11:
-            return "INTRA_DC_PRECISION_11";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMpeg2IntraDcPrecision(Mpeg2IntraDcPrecision enumValue)
+        {
+          return GetNameForMpeg2IntraDcPrecisionCStr(enumValue);
         }
 
       } // namespace Mpeg2IntraDcPrecisionMapper
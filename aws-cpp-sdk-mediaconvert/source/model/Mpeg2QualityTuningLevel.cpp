@@ -30,20 +30,37 @@ namespace Aws
       namespace Mpeg2QualityTuningLevelMapper
       {
 
-        static const int SINGLE_PASS_HASH = HashingUtils::HashString("SINGLE_PASS");
-        static const int MULTI_PASS_HASH = HashingUtils::HashString("MULTI_PASS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SINGLE_PASS",
+          "MULTI_PASS",
+        };
 
         Mpeg2QualityTuningLevel GetMpeg2QualityTuningLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SINGLE_PASS_HASH)
-          {
-            return Mpeg2QualityTuningLevel::SINGLE_PASS;
-          }
-          else if (hashCode == MULTI_PASS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mpeg2QualityTuningLevel::MULTI_PASS;
+          case 450660776:
+            if (name == "SINGLE_PASS")
+            {
+              return Mpeg2QualityTuningLevel::SINGLE_PASS;
+            }
+            break;
+          case 1764130679:
+            if (name == "MULTI_PASS")
+            {
+              return Mpeg2QualityTuningLevel::MULTI_PASS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Mpeg2QualityTuningLevel::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2QualityTuningLevel(Mpeg2QualityTuningLevel enumValue)
+        const char* GetNameForMpeg2QualityTuningLevelCStr(Mpeg2QualityTuningLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mpeg2QualityTuningLevel::SINGLE_PASS:
-            return "SINGLE_PASS";
-          case Mpeg2QualityTuningLevel::MULTI_PASS:
-            return "MULTI_PASS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMpeg2QualityTuningLevel(Mpeg2QualityTuningLevel enumValue)
+        {
+          return GetNameForMpeg2QualityTuningLevelCStr(enumValue);
         }
 
       } // namespace Mpeg2QualityTuningLevelMapper
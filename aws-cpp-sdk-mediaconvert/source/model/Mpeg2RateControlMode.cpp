@@ -30,20 +30,37 @@ namespace Aws
       namespace Mpeg2RateControlModeMapper
       {
 
-        static const int VBR_HASH = HashingUtils::HashString("VBR");
-        static const int CBR_HASH = HashingUtils::HashString("CBR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VBR",
+          "CBR",
+        };
 
         Mpeg2RateControlMode GetMpeg2RateControlModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VBR_HASH)
-          {
-            return Mpeg2RateControlMode::VBR;
-          }
-          else if (hashCode == CBR_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mpeg2RateControlMode::CBR;
+          case 84774:
+            if (name == "VBR")
+            {
+              return Mpeg2RateControlMode::VBR;
+            }
+            break;
+          case 66515:
+            if (name == "CBR")
+            {
+              return Mpeg2RateControlMode::CBR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Mpeg2RateControlMode::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2RateControlMode(Mpeg2RateControlMode enumValue)
+        const char* GetNameForMpeg2RateControlModeCStr(Mpeg2RateControlMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mpeg2RateControlMode::VBR:
-            return "VBR";
-          case Mpeg2RateControlMode::CBR:
-            return "CBR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMpeg2RateControlMode(Mpeg2RateControlMode enumValue)
+        {
+          return GetNameForMpeg2RateControlModeCStr(enumValue);
         }
 
       } // namespace Mpeg2RateControlModeMapper
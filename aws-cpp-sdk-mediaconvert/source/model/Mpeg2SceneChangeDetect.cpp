@@ -30,20 +30,37 @@ namespace Aws
       namespace Mpeg2SceneChangeDetectMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "ENABLED",
+        };
 
         Mpeg2SceneChangeDetect GetMpeg2SceneChangeDetectForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return Mpeg2SceneChangeDetect::DISABLED;
-          }
-          else if (hashCode == ENABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mpeg2SceneChangeDetect::ENABLED;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return Mpeg2SceneChangeDetect::DISABLED;
+            }
+            break;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return Mpeg2SceneChangeDetect::ENABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Mpeg2SceneChangeDetect::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2SceneChangeDetect(Mpeg2SceneChangeDetect enumValue)
+        const char* GetNameForMpeg2SceneChangeDetectCStr(Mpeg2SceneChangeDetect enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mpeg2SceneChangeDetect::DISABLED:
-            return "DISABLED";
-          case Mpeg2SceneChangeDetect::ENABLED:
-            return "ENABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMpeg2SceneChangeDetect(Mpeg2SceneChangeDetect enumValue)
+        {
+          return GetNameForMpeg2SceneChangeDetectCStr(enumValue);
         }
 
       } // namespace Mpeg2SceneChangeDetectMapper
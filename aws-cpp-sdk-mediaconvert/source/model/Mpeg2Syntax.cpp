@@ -30,20 +30,37 @@ namespace Aws
       namespace Mpeg2SyntaxMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int D_10_HASH = HashingUtils::HashString("D_10");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "D_10",
+        };
 
         Mpeg2Syntax GetMpeg2SyntaxForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return Mpeg2Syntax::DEFAULT;
-          }
-          else if (hashCode == D_10_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mpeg2Syntax::D_10;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return Mpeg2Syntax::DEFAULT;
+            }
+            break;
+          case 2118650:
+            if (name == "D_10")
+            {
+              return Mpeg2Syntax::D_10;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Mpeg2Syntax::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2Syntax(Mpeg2Syntax enumValue)
+        const char* GetNameForMpeg2SyntaxCStr(Mpeg2Syntax enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mpeg2Syntax::DEFAULT:
-            return "DEFAULT";
-          case Mpeg2Syntax::D_10:
-            return "D_10";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMpeg2Syntax(Mpeg2Syntax enumValue)
+        {
+          return GetNameForMpeg2SyntaxCStr(enumValue);
         }
 
       } // namespace Mpeg2SyntaxMapper
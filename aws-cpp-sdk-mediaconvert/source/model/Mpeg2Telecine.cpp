@@ -30,25 +30,44 @@ namespace Aws
       namespace Mpeg2TelecineMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SOFT_HASH = HashingUtils::HashString("SOFT");
-        static const int HARD_HASH = HashingUtils::HashString("HARD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "SOFT",
+          "HARD",
+        };
 
         Mpeg2Telecine GetMpeg2TelecineForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return Mpeg2Telecine::NONE;
-          }
-          else if (hashCode == SOFT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mpeg2Telecine::SOFT;
-          }
-          else if (hashCode == HARD_HASH)
-          {
-            return Mpeg2Telecine::HARD;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Mpeg2Telecine::NONE;
+            }
+            break;
+          case 2550826:
+            if (name == "SOFT")
+            {
+              return Mpeg2Telecine::SOFT;
+            }
+            break;
+          case 2210027:
+            if (name == "HARD")
+            {
+              return Mpeg2Telecine::HARD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Mpeg2Telecine::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2Telecine(Mpeg2Telecine enumValue)
+        const char* GetNameForMpeg2TelecineCStr(Mpeg2Telecine enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mpeg2Telecine::NONE:
-            return "NONE";
-          case Mpeg2Telecine::SOFT:
-            return "SOFT";
-          case Mpeg2Telecine::HARD:
-            return "HARD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMpeg2Telecine(Mpeg2Telecine enumValue)
+        {
+          return GetNameForMpeg2TelecineCStr(enumValue);
         }
 
       } // namespace Mpeg2TelecineMapper
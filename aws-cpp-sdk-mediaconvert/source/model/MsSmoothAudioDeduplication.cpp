@@ -30,20 +30,37 @@ namespace Aws
       namespace MsSmoothAudioDeduplicationMapper
       {
 
-        static const int COMBINE_DUPLICATE_STREAMS_HASH = HashingUtils::HashString("COMBINE_DUPLICATE_STREAMS");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COMBINE_DUPLICATE_STREAMS",
+          "NONE",
+        };
 
         MsSmoothAudioDeduplication GetMsSmoothAudioDeduplicationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMBINE_DUPLICATE_STREAMS_HASH)
-          {
-            return MsSmoothAudioDeduplication::COMBINE_DUPLICATE_STREAMS;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MsSmoothAudioDeduplication::NONE;
+          case -1742791073:
+            if (name == "COMBINE_DUPLICATE_STREAMS")
+            {
+              return MsSmoothAudioDeduplication::COMBINE_DUPLICATE_STREAMS;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return MsSmoothAudioDeduplication::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MsSmoothAudioDeduplication::NOT_SET;
         }
 
-        Aws::String GetNameForMsSmoothAudioDeduplication(MsSmoothAudioDeduplication enumValue)
+        const char* GetNameForMsSmoothAudioDeduplicationCStr(MsSmoothAudioDeduplication enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MsSmoothAudioDeduplication::COMBINE_DUPLICATE_STREAMS:
-            return "COMBINE_DUPLICATE_STREAMS";
-          case MsSmoothAudioDeduplication::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMsSmoothAudioDeduplication(MsSmoothAudioDeduplication enumValue)
+        {
+          return GetNameForMsSmoothAudioDeduplicationCStr(enumValue);
         }
 
       } // namespace MsSmoothAudioDeduplicationMapper
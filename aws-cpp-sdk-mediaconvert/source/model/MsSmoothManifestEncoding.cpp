@@ -30,20 +30,37 @@ namespace Aws
       namespace MsSmoothManifestEncodingMapper
       {
 
-        static const int UTF8_HASH = HashingUtils::HashString("UTF8");
-        static const int UTF16_HASH = HashingUtils::HashString("UTF16");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UTF8",
+          "UTF16",
+        };
 
         MsSmoothManifestEncoding GetMsSmoothManifestEncodingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UTF8_HASH)
-          {
-            return MsSmoothManifestEncoding::UTF8;
-          }
-          else if (hashCode == UTF16_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MsSmoothManifestEncoding::UTF16;
+          case 2615185:
+            if (name == "UTF8")
+            {
+              return MsSmoothManifestEncoding::UTF8;
+            }
+            break;
+          case 81070572:
+            if (name == "UTF16")
+            {
+              return MsSmoothManifestEncoding::UTF16;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MsSmoothManifestEncoding::NOT_SET;
         }
 
-        Aws::String GetNameForMsSmoothManifestEncoding(MsSmoothManifestEncoding enumValue)
+        const char* GetNameForMsSmoothManifestEncodingCStr(MsSmoothManifestEncoding enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MsSmoothManifestEncoding::UTF8:
-            return "UTF8";
-          case MsSmoothManifestEncoding::UTF16:
-            return "UTF16";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMsSmoothManifestEncoding(MsSmoothManifestEncoding enumValue)
+        {
+          return GetNameForMsSmoothManifestEncodingCStr(enumValue);
         }
 
       } // namespace MsSmoothManifestEncodingMapper
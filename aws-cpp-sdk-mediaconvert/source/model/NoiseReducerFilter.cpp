@@ -30,45 +30,72 @@ namespace Aws
       namespace NoiseReducerFilterMapper
       {
 
-        static const int BILATERAL_HASH = HashingUtils::HashString("BILATERAL");
-        static const int MEAN_HASH = HashingUtils::HashString("MEAN");
-        static const int GAUSSIAN_HASH = HashingUtils::HashString("GAUSSIAN");
-        static const int LANCZOS_HASH = HashingUtils::HashString("LANCZOS");
-        static const int SHARPEN_HASH = HashingUtils::HashString("SHARPEN");
-        static const int CONSERVE_HASH = HashingUtils::HashString("CONSERVE");
-        static const int SPATIAL_HASH = HashingUtils::HashString("SPATIAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BILATERAL",
+          "MEAN",
+          "GAUSSIAN",
+          "LANCZOS",
+          "SHARPEN",
+          "CONSERVE",
+          "SPATIAL",
+        };
 
         NoiseReducerFilter GetNoiseReducerFilterForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BILATERAL_HASH)
-          {
-            return NoiseReducerFilter::BILATERAL;
-          }
-          else if (hashCode == MEAN_HASH)
-          {
-            return NoiseReducerFilter::MEAN;
-          }
-          else if (hashCode == GAUSSIAN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NoiseReducerFilter::GAUSSIAN;
-          }
-          else if (hashCode == LANCZOS_HASH)
-          {
-            return NoiseReducerFilter::LANCZOS;
-          }
-          else if (hashCode == SHARPEN_HASH)
-          {
-            return NoiseReducerFilter::SHARPEN;
-          }
-          else if (hashCode == CONSERVE_HASH)
-          {
-            return NoiseReducerFilter::CONSERVE;
-          }
-          else if (hashCode == SPATIAL_HASH)
-          {
-            return NoiseReducerFilter::SPATIAL;
+          case 14635376:
+            if (name == "BILATERAL")
+            {
+              return NoiseReducerFilter::BILATERAL;
+            }
+            break;
+          case 2362309:
+            if (name == "MEAN")
+            {
+              return NoiseReducerFilter::MEAN;
+            }
+            break;
+          case -743645701:
+            if (name == "GAUSSIAN")
+            {
+              return NoiseReducerFilter::GAUSSIAN;
+            }
+            break;
+          case 665817492:
+            if (name == "LANCZOS")
+            {
+              return NoiseReducerFilter::LANCZOS;
+            }
+            break;
+          case -1522756109:
+            if (name == "SHARPEN")
+            {
+              return NoiseReducerFilter::SHARPEN;
+            }
+            break;
+          case 214385357:
+            if (name == "CONSERVE")
+            {
+              return NoiseReducerFilter::CONSERVE;
+            }
+            break;
+          case -1293670172:
+            if (name == "SPATIAL")
+            {
+              return NoiseReducerFilter::SPATIAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return NoiseReducerFilter::NOT_SET;
         }
 
-        Aws::String GetNameForNoiseReducerFilter(NoiseReducerFilter enumValue)
+        const char* GetNameForNoiseReducerFilterCStr(NoiseReducerFilter enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NoiseReducerFilter::BILATERAL:
-            return "BILATERAL";
-          case NoiseReducerFilter::MEAN:
-            return "MEAN";
-          case NoiseReducerFilter::GAUSSIAN:
-            return "GAUSSIAN";
-          case NoiseReducerFilter::LANCZOS:
-            return "LANCZOS";
-          case NoiseReducerFilter::SHARPEN:
-            return "SHARPEN";
-          case NoiseReducerFilter::CONSERVE:
-            return "CONSERVE";
-          case NoiseReducerFilter::SPATIAL:
-            return "SPATIAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNoiseReducerFilter(NoiseReducerFilter enumValue)
+        {
+          return GetNameForNoiseReducerFilterCStr(enumValue);
         }
 
       } // namespace NoiseReducerFilterMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace OrderMapper
       {
 
-        static const int ASCENDING_HASH = HashingUtils::HashString("ASCENDING");
-        static const int DESCENDING_HASH = HashingUtils::HashString("DESCENDING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ASCENDING",
+          "DESCENDING",
+        };
 
         Order GetOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASCENDING_HASH)
-          {
-            return Order::ASCENDING;
-          }
-          else if (hashCode == DESCENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Order::DESCENDING;
+          case -1513304392:
+            if (name == "ASCENDING")
+            {
+              return Order::ASCENDING;
+            }
+            break;
+          case -631204104:
+            if (name == "DESCENDING")
+            {
+              return Order::DESCENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Order::NOT_SET;
         }
 
-        Aws::String GetNameForOrder(Order enumValue)
+        const char* GetNameForOrderCStr(Order enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Order::ASCENDING:
-            return "ASCENDING";
-          case Order::DESCENDING:
-            return "DESCENDING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOrder(Order enumValue)
+        {
+          return GetNameForOrderCStr(enumValue);
         }
 
       } // namespace OrderMapper
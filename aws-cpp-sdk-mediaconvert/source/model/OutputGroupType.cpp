@@ -30,35 +30,58 @@ namespace Aws
       namespace OutputGroupTypeMapper
       {
 
-        static const int HLS_GROUP_SETTINGS_HASH = HashingUtils::HashString("HLS_GROUP_SETTINGS");
-        static const int DASH_ISO_GROUP_SETTINGS_HASH = HashingUtils::HashString("DASH_ISO_GROUP_SETTINGS");
-        static const int FILE_GROUP_SETTINGS_HASH = HashingUtils::HashString("FILE_GROUP_SETTINGS");
-        static const int MS_SMOOTH_GROUP_SETTINGS_HASH = HashingUtils::HashString("MS_SMOOTH_GROUP_SETTINGS");
-        static const int CMAF_GROUP_SETTINGS_HASH = HashingUtils::HashString("CMAF_GROUP_SETTINGS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HLS_GROUP_SETTINGS",
+          "DASH_ISO_GROUP_SETTINGS",
+          "FILE_GROUP_SETTINGS",
+          "MS_SMOOTH_GROUP_SETTINGS",
+          "CMAF_GROUP_SETTINGS",
+        };
 
         OutputGroupType GetOutputGroupTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HLS_GROUP_SETTINGS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OutputGroupType::HLS_GROUP_SETTINGS;
-          }
-          else if (hashCode == DASH_ISO_GROUP_SETTINGS_HASH)
-          {
-            return OutputGroupType::DASH_ISO_GROUP_SETTINGS;
-          }
-          else if (hashCode == FILE_GROUP_SETTINGS_HASH)
-          {
-            return OutputGroupType::FILE_GROUP_SETTINGS;
-          }
-          else if (hashCode == MS_SMOOTH_GROUP_SETTINGS_HASH)
-          {
-            return OutputGroupType::MS_SMOOTH_GROUP_SETTINGS;
-          }
-          else if (hashCode == CMAF_GROUP_SETTINGS_HASH)
-          {
-            return OutputGroupType::CMAF_GROUP_SETTINGS;
+          case 1894414451:
+            if (name == "HLS_GROUP_SETTINGS")
+            {
+              return OutputGroupType::HLS_GROUP_SETTINGS;
+            }
+            break;
+          case 1313945322:
+            if (name == "DASH_ISO_GROUP_SETTINGS")
+            {
+              return OutputGroupType::DASH_ISO_GROUP_SETTINGS;
+            }
+            break;
+          case 471397158:
+            if (name == "FILE_GROUP_SETTINGS")
+            {
+              return OutputGroupType::FILE_GROUP_SETTINGS;
+            }
+            break;
+          case -1544014117:
+            if (name == "MS_SMOOTH_GROUP_SETTINGS")
+            {
+              return OutputGroupType::MS_SMOOTH_GROUP_SETTINGS;
+            }
+            break;
+          case 799451699:
+            if (name == "CMAF_GROUP_SETTINGS")
+            {
+              return OutputGroupType::CMAF_GROUP_SETTINGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return OutputGroupType::NOT_SET;
         }
 
-        Aws::String GetNameForOutputGroupType(OutputGroupType enumValue)
+        const char* GetNameForOutputGroupTypeCStr(OutputGroupType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OutputGroupType::HLS_GROUP_SETTINGS:
-            return "HLS_GROUP_SETTINGS";
-          case OutputGroupType::DASH_ISO_GROUP_SETTINGS:
-            return "DASH_ISO_GROUP_SETTINGS";
-          case OutputGroupType::FILE_GROUP_SETTINGS:
-            return "FILE_GROUP_SETTINGS";
-          case OutputGroupType::MS_SMOOTH_GROUP_SETTINGS:
-            return "MS_SMOOTH_GROUP_SETTINGS";
-          case OutputGroupType::CMAF_GROUP_SETTINGS:
-            return "CMAF_GROUP_SETTINGS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOutputGroupType(OutputGroupType enumValue)
+        {
+          return GetNameForOutputGroupTypeCStr(enumValue);
         }
 
       } // namespace OutputGroupTypeMapper
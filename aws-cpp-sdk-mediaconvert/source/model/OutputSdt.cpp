@@ -30,30 +30,51 @@ namespace Aws
       namespace OutputSdtMapper
       {
 
-        static const int SDT_FOLLOW_HASH = HashingUtils::HashString("SDT_FOLLOW");
-        static const int SDT_FOLLOW_IF_PRESENT_HASH = HashingUtils::HashString("SDT_FOLLOW_IF_PRESENT");
-        static const int SDT_MANUAL_HASH = HashingUtils::HashString("SDT_MANUAL");
-        static const int SDT_NONE_HASH = HashingUtils::HashString("SDT_NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SDT_FOLLOW",
+          "SDT_FOLLOW_IF_PRESENT",
+          "SDT_MANUAL",
+          "SDT_NONE",
+        };
 
         OutputSdt GetOutputSdtForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SDT_FOLLOW_HASH)
-          {
-            return OutputSdt::SDT_FOLLOW;
-          }
-          else if (hashCode == SDT_FOLLOW_IF_PRESENT_HASH)
-          {
-            return OutputSdt::SDT_FOLLOW_IF_PRESENT;
-          }
-          else if (hashCode == SDT_MANUAL_HASH)
-          {
-            return OutputSdt::SDT_MANUAL;
-          }
-          else if (hashCode == SDT_NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OutputSdt::SDT_NONE;
+          case -918548659:
+            if (name == "SDT_FOLLOW")
+            {
+              return OutputSdt::SDT_FOLLOW;
+            }
+            break;
+          case -1060639829:
+            if (name == "SDT_FOLLOW_IF_PRESENT")
+            {
+              return OutputSdt::SDT_FOLLOW_IF_PRESENT;
+            }
+            break;
+          case -731006110:
+            if (name == "SDT_MANUAL")
+            {
+              return OutputSdt::SDT_MANUAL;
+            }
+            break;
+          case 1340063188:
+            if (name == "SDT_NONE")
+            {
+              return OutputSdt::SDT_NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return OutputSdt::NOT_SET;
         }
 
-        Aws::String GetNameForOutputSdt(OutputSdt enumValue)
+        const char* GetNameForOutputSdtCStr(OutputSdt enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OutputSdt::SDT_FOLLOW:
-            return "SDT_FOLLOW";
-          case OutputSdt::SDT_FOLLOW_IF_PRESENT:
-            return "SDT_FOLLOW_IF_PRESENT";
-          case OutputSdt::SDT_MANUAL:
-            return "SDT_MANUAL";
-          case OutputSdt::SDT_NONE:
-            return "SDT_NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOutputSdt(OutputSdt enumValue)
+        {
+          return GetNameForOutputSdtCStr(enumValue);
         }
 
       } // namespace OutputSdtMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PresetListByMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int CREATION_DATE_HASH = HashingUtils::HashString("CREATION_DATE");
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NAME",
+          "CREATION_DATE",
+          "SYSTEM",
+        };
 
         PresetListBy GetPresetListByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
-          {
-            return PresetListBy::NAME;
-          }
-          else if (hashCode == CREATION_DATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PresetListBy::CREATION_DATE;
-          }
-          else if (hashCode == SYSTEM_HASH)
-          {
-            return PresetListBy::SYSTEM;
+          case 2388619:
+            if (name == "NAME")
+            {
+              return PresetListBy::NAME;
+            }
+            break;
+          case 782677262:
+            if (name == "CREATION_DATE")
+            {
+              return PresetListBy::CREATION_DATE;
+            }
+            break;
+          case -1833998801:
+            if (name == "SYSTEM")
+            {
+              return PresetListBy::SYSTEM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PresetListBy::NOT_SET;
         }
 
-        Aws::String GetNameForPresetListBy(PresetListBy enumValue)
+        const char* GetNameForPresetListByCStr(PresetListBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PresetListBy::NAME:
-            return "NAME";
-          case PresetListBy::CREATION_DATE:
-            return "CREATION_DATE";
-          case PresetListBy::SYSTEM:
-            return "SYSTEM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPresetListBy(PresetListBy enumValue)
+        {
+          return GetNameForPresetListByCStr(enumValue);
         }
 
       } // namespace PresetListByMapper
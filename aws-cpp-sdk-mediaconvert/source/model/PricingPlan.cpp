@@ -30,20 +30,37 @@ namespace Aws
       namespace PricingPlanMapper
       {
 
-        static const int ON_DEMAND_HASH = HashingUtils::HashString("ON_DEMAND");
-        static const int RESERVED_HASH = HashingUtils::HashString("RESERVED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ON_DEMAND",
+          "RESERVED",
+        };
 
         PricingPlan GetPricingPlanForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ON_DEMAND_HASH)
-          {
-            return PricingPlan::ON_DEMAND;
-          }
-          else if (hashCode == RESERVED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PricingPlan::RESERVED;
+          case -2128361301:
+            if (name == "ON_DEMAND")
+            {
+              return PricingPlan::ON_DEMAND;
+            }
+            break;
+          case 432241448:
+            if (name == "RESERVED")
+            {
+              return PricingPlan::RESERVED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PricingPlan::NOT_SET;
         }
 
-        Aws::String GetNameForPricingPlan(PricingPlan enumValue)
+        const char* GetNameForPricingPlanCStr(PricingPlan enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PricingPlan::ON_DEMAND:
-            return "ON_DEMAND";
-          case PricingPlan::RESERVED:
-            return "RESERVED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPricingPlan(PricingPlan enumValue)
+        {
+          return GetNameForPricingPlanCStr(enumValue);
         }
 
       } // namespace PricingPlanMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ProresCodecProfileMapper
       {
 
-        static const int APPLE_PRORES_422_HASH = HashingUtils::HashString("APPLE_PRORES_422");
-        static const int APPLE_PRORES_422_HQ_HASH = HashingUtils::HashString("APPLE_PRORES_422_HQ");
-        static const int APPLE_PRORES_422_LT_HASH = HashingUtils::HashString("APPLE_PRORES_422_LT");
-        static const int APPLE_PRORES_422_PROXY_HASH = HashingUtils::HashString("APPLE_PRORES_422_PROXY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "APPLE_PRORES_422",
+          "APPLE_PRORES_422_HQ",
+          "APPLE_PRORES_422_LT",
+          "APPLE_PRORES_422_PROXY",
+        };
 
         ProresCodecProfile GetProresCodecProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == APPLE_PRORES_422_HASH)
-          {
-            return ProresCodecProfile::APPLE_PRORES_422;
-          }
-          else if (hashCode == APPLE_PRORES_422_HQ_HASH)
-          {
-            return ProresCodecProfile::APPLE_PRORES_422_HQ;
-          }
-          else if (hashCode == APPLE_PRORES_422_LT_HASH)
-          {
-            return ProresCodecProfile::APPLE_PRORES_422_LT;
-          }
-          else if (hashCode == APPLE_PRORES_422_PROXY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProresCodecProfile::APPLE_PRORES_422_PROXY;
+          case 1646663725:
+            if (name == "APPLE_PRORES_422")
+            {
+              return ProresCodecProfile::APPLE_PRORES_422;
+            }
+            break;
+          case -1357329829:
+            if (name == "APPLE_PRORES_422_HQ")
+            {
+              return ProresCodecProfile::APPLE_PRORES_422_HQ;
+            }
+            break;
+          case -1357329702:
+            if (name == "APPLE_PRORES_422_LT")
+            {
+              return ProresCodecProfile::APPLE_PRORES_422_LT;
+            }
+            break;
+          case 911652796:
+            if (name == "APPLE_PRORES_422_PROXY")
+            {
+              return ProresCodecProfile::APPLE_PRORES_422_PROXY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ProresCodecProfile::NOT_SET;
         }
 
-        Aws::String GetNameForProresCodecProfile(ProresCodecProfile enumValue)
+        const char* GetNameForProresCodecProfileCStr(ProresCodecProfile enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProresCodecProfile::APPLE_PRORES_422:
-            return "APPLE_PRORES_422";
-          case ProresCodecProfile::APPLE_PRORES_422_HQ:
-            return "APPLE_PRORES_422_HQ";
-          case ProresCodecProfile::APPLE_PRORES_422_LT:
-            return "APPLE_PRORES_422_LT";
-          case ProresCodecProfile::APPLE_PRORES_422_PROXY:
-            return "APPLE_PRORES_422_PROXY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProresCodecProfile(ProresCodecProfile enumValue)
+        {
+          return GetNameForProresCodecProfileCStr(enumValue);
         }
 
       } // namespace ProresCodecProfileMapper
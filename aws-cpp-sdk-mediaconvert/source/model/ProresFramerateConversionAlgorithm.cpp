@@ -30,20 +30,37 @@ namespace Aws
       namespace ProresFramerateConversionAlgorithmMapper
       {
 
-        static const int DUPLICATE_DROP_HASH = HashingUtils::HashString("DUPLICATE_DROP");
-        static const int INTERPOLATE_HASH = HashingUtils::HashString("INTERPOLATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DUPLICATE_DROP",
+          "INTERPOLATE",
+        };
 
         ProresFramerateConversionAlgorithm GetProresFramerateConversionAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DUPLICATE_DROP_HASH)
-          {
-            return ProresFramerateConversionAlgorithm::DUPLICATE_DROP;
-          }
-          else if (hashCode == INTERPOLATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProresFramerateConversionAlgorithm::INTERPOLATE;
+          case 2038357443:
+            if (name == "DUPLICATE_DROP")
+            {
+              return ProresFramerateConversionAlgorithm::DUPLICATE_DROP;
+            }
+            break;
+          case 142372065:
+            if (name == "INTERPOLATE")
+            {
+              return ProresFramerateConversionAlgorithm::INTERPOLATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ProresFramerateConversionAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForProresFramerateConversionAlgorithm(ProresFramerateConversionAlgorithm enumValue)
+        const char* GetNameForProresFramerateConversionAlgorithmCStr(ProresFramerateConversionAlgorithm enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProresFramerateConversionAlgorithm::DUPLICATE_DROP:
-            return "DUPLICATE_DROP";
-          case ProresFramerateConversionAlgorithm::INTERPOLATE:
-            return "INTERPOLATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProresFramerateConversionAlgorithm(ProresFramerateConversionAlgorithm enumValue)
+        {
+          return GetNameForProresFramerateConversionAlgorithmCStr(enumValue);
         }
 
       } // namespace ProresFramerateConversionAlgorithmMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ProresTelecineMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int HARD_HASH = HashingUtils::HashString("HARD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "HARD",
+        };
 
         ProresTelecine GetProresTelecineForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return ProresTelecine::NONE;
-          }
-          else if (hashCode == HARD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProresTelecine::HARD;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return ProresTelecine::NONE;
+            }
+            break;
+          case 2210027:
+            if (name == "HARD")
+            {
+              return ProresTelecine::HARD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ProresTelecine::NOT_SET;
         }
 
-        Aws::String GetNameForProresTelecine(ProresTelecine enumValue)
+        const char* GetNameForProresTelecineCStr(ProresTelecine enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProresTelecine::NONE:
-            return "NONE";
-          case ProresTelecine::HARD:
-            return "HARD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProresTelecine(ProresTelecine enumValue)
+        {
+          return GetNameForProresTelecineCStr(enumValue);
         }
 
       } // namespace ProresTelecineMapper
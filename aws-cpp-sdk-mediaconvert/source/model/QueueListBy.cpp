@@ -30,20 +30,37 @@ namespace Aws
       namespace QueueListByMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int CREATION_DATE_HASH = HashingUtils::HashString("CREATION_DATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NAME",
+          "CREATION_DATE",
+        };
 
         QueueListBy GetQueueListByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
-          {
-            return QueueListBy::NAME;
-          }
-          else if (hashCode == CREATION_DATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return QueueListBy::CREATION_DATE;
+          case 2388619:
+            if (name == "NAME")
+            {
+              return QueueListBy::NAME;
+            }
+            break;
+          case 782677262:
+            if (name == "CREATION_DATE")
+            {
+              return QueueListBy::CREATION_DATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return QueueListBy::NOT_SET;
         }
 
-        Aws::String GetNameForQueueListBy(QueueListBy enumValue)
+        const char* GetNameForQueueListByCStr(QueueListBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QueueListBy::NAME:
-            return "NAME";
-          case QueueListBy::CREATION_DATE:
-            return "CREATION_DATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQueueListBy(QueueListBy enumValue)
+        {
+          return GetNameForQueueListByCStr(enumValue);
         }
 
       } // namespace QueueListByMapper
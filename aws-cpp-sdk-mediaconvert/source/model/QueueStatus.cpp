@@ -30,20 +30,37 @@ namespace Aws
       namespace QueueStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int PAUSED_HASH = HashingUtils::HashString("PAUSED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "PAUSED",
+        };
 
         QueueStatus GetQueueStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return QueueStatus::ACTIVE;
-          }
-          else if (hashCode == PAUSED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return QueueStatus::PAUSED;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return QueueStatus::ACTIVE;
+            }
+            break;
+          case -1941992146:
+            if (name == "PAUSED")
+            {
+              return QueueStatus::PAUSED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return QueueStatus::NOT_SET;
         }
 
-        Aws::String GetNameForQueueStatus(QueueStatus enumValue)
+        const char* GetNameForQueueStatusCStr(QueueStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QueueStatus::ACTIVE:
-            return "ACTIVE";
-          case QueueStatus::PAUSED:
-            return "PAUSED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQueueStatus(QueueStatus enumValue)
+        {
+          return GetNameForQueueStatusCStr(enumValue);
         }
 
       } // namespace QueueStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace RenewalTypeMapper
       {
 
-        static const int AUTO_RENEW_HASH = HashingUtils::HashString("AUTO_RENEW");
-        static const int EXPIRE_HASH = HashingUtils::HashString("EXPIRE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTO_RENEW",
+          "EXPIRE",
+        };
 
         RenewalType GetRenewalTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_RENEW_HASH)
-          {
-            return RenewalType::AUTO_RENEW;
-          }
-          else if (hashCode == EXPIRE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RenewalType::EXPIRE;
+          case 1359875037:
+            if (name == "AUTO_RENEW")
+            {
+              return RenewalType::AUTO_RENEW;
+            }
+            break;
+          case 2059137311:
+            if (name == "EXPIRE")
+            {
+              return RenewalType::EXPIRE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RenewalType::NOT_SET;
         }
 
-        Aws::String GetNameForRenewalType(RenewalType enumValue)
+        const char* GetNameForRenewalTypeCStr(RenewalType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RenewalType::AUTO_RENEW:
-            return "AUTO_RENEW";
-          case RenewalType::EXPIRE:
-            return "EXPIRE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRenewalType(RenewalType enumValue)
+        {
+          return GetNameForRenewalTypeCStr(enumValue);
         }
 
       } // namespace RenewalTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ReservationPlanStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "EXPIRED",
+        };
 
         ReservationPlanStatus GetReservationPlanStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return ReservationPlanStatus::ACTIVE;
-          }
-          else if (hashCode == EXPIRED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReservationPlanStatus::EXPIRED;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ReservationPlanStatus::ACTIVE;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return ReservationPlanStatus::EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReservationPlanStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReservationPlanStatus(ReservationPlanStatus enumValue)
+        const char* GetNameForReservationPlanStatusCStr(ReservationPlanStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReservationPlanStatus::ACTIVE:
-            return "ACTIVE";
-          case ReservationPlanStatus::EXPIRED:
-            return "EXPIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReservationPlanStatus(ReservationPlanStatus enumValue)
+        {
+          return GetNameForReservationPlanStatusCStr(enumValue);
         }
 
       } // namespace ReservationPlanStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace RespondToAfdMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int RESPOND_HASH = HashingUtils::HashString("RESPOND");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "RESPOND",
+          "PASSTHROUGH",
+        };
 
         RespondToAfd GetRespondToAfdForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return RespondToAfd::NONE;
-          }
-          else if (hashCode == RESPOND_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RespondToAfd::RESPOND;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
-          {
-            return RespondToAfd::PASSTHROUGH;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return RespondToAfd::NONE;
+            }
+            break;
+          case 1815383157:
+            if (name == "RESPOND")
+            {
+              return RespondToAfd::RESPOND;
+            }
+            break;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return RespondToAfd::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RespondToAfd::NOT_SET;
         }
 
-        Aws::String GetNameForRespondToAfd(RespondToAfd enumValue)
+        const char* GetNameForRespondToAfdCStr(RespondToAfd enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RespondToAfd::NONE:
-            return "NONE";
-          case RespondToAfd::RESPOND:
-            return "RESPOND";
-          case RespondToAfd::PASSTHROUGH:
-            return "PASSTHROUGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRespondToAfd(RespondToAfd enumValue)
+        {
+          return GetNameForRespondToAfdCStr(enumValue);
         }
 
       } // namespace RespondToAfdMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ScalingBehaviorMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int STRETCH_TO_OUTPUT_HASH = HashingUtils::HashString("STRETCH_TO_OUTPUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "STRETCH_TO_OUTPUT",
+        };
 
         ScalingBehavior GetScalingBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return ScalingBehavior::DEFAULT;
-          }
-          else if (hashCode == STRETCH_TO_OUTPUT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScalingBehavior::STRETCH_TO_OUTPUT;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return ScalingBehavior::DEFAULT;
+            }
+            break;
+          case -2079055253:
+            if (name == "STRETCH_TO_OUTPUT")
+            {
+              return ScalingBehavior::STRETCH_TO_OUTPUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ScalingBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForScalingBehavior(ScalingBehavior enumValue)
+        const char* GetNameForScalingBehaviorCStr(ScalingBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScalingBehavior::DEFAULT:
-            return "DEFAULT";
-          case ScalingBehavior::STRETCH_TO_OUTPUT:
-            return "STRETCH_TO_OUTPUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScalingBehavior(ScalingBehavior enumValue)
+        {
+          return GetNameForScalingBehaviorCStr(enumValue);
         }
 
       } // namespace ScalingBehaviorMapper
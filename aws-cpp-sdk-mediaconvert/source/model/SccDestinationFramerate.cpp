@@ -30,30 +30,51 @@ namespace Aws
       namespace SccDestinationFramerateMapper
       {
 
-        static const int FRAMERATE_23_97_HASH = HashingUtils::HashString("FRAMERATE_23_97");
-        static const int FRAMERATE_24_HASH = HashingUtils::HashString("FRAMERATE_24");
-        static const int FRAMERATE_29_97_DROPFRAME_HASH = HashingUtils::HashString("FRAMERATE_29_97_DROPFRAME");
-        static const int FRAMERATE_29_97_NON_DROPFRAME_HASH = HashingUtils::HashString("FRAMERATE_29_97_NON_DROPFRAME");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FRAMERATE_23_97",
+          "FRAMERATE_24",
+          "FRAMERATE_29_97_DROPFRAME",
+          "FRAMERATE_29_97_NON_DROPFRAME",
+        };
 
         SccDestinationFramerate GetSccDestinationFramerateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FRAMERATE_23_97_HASH)
-          {
-            return SccDestinationFramerate::FRAMERATE_23_97;
-          }
-          else if (hashCode == FRAMERATE_24_HASH)
-          {
-            return SccDestinationFramerate::FRAMERATE_24;
-          }
-          else if (hashCode == FRAMERATE_29_97_DROPFRAME_HASH)
-          {
-            return SccDestinationFramerate::FRAMERATE_29_97_DROPFRAME;
-          }
-          else if (hashCode == FRAMERATE_29_97_NON_DROPFRAME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SccDestinationFramerate::FRAMERATE_29_97_NON_DROPFRAME;
+          case -835852598:
+            if (name == "FRAMERATE_23_97")
+            {
+              return SccDestinationFramerate::FRAMERATE_23_97;
+            }
+            break;
+          case -802478060:
+            if (name == "FRAMERATE_24")
+            {
+              return SccDestinationFramerate::FRAMERATE_24;
+            }
+            break;
+          case 692956739:
+            if (name == "FRAMERATE_29_97_DROPFRAME")
+            {
+              return SccDestinationFramerate::FRAMERATE_29_97_DROPFRAME;
+            }
+            break;
+          case 155867313:
+            if (name == "FRAMERATE_29_97_NON_DROPFRAME")
+            {
+              return SccDestinationFramerate::FRAMERATE_29_97_NON_DROPFRAME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return SccDestinationFramerate::NOT_SET;
         }
 
-        Aws::String GetNameForSccDestinationFramerate(SccDestinationFramerate enumValue)
+        const char* GetNameForSccDestinationFramerateCStr(SccDestinationFramerate enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SccDestinationFramerate::FRAMERATE_23_97:
-            return "FRAMERATE_23_97";
-          case SccDestinationFramerate::FRAMERATE_24:
-            return "FRAMERATE_24";
-          case SccDestinationFramerate::FRAMERATE_29_97_DROPFRAME:
-            return "FRAMERATE_29_97_DROPFRAME";
-          case SccDestinationFramerate::FRAMERATE_29_97_NON_DROPFRAME:
-            return "FRAMERATE_29_97_NON_DROPFRAME";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSccDestinationFramerate(SccDestinationFramerate enumValue)
+        {
+          return GetNameForSccDestinationFramerateCStr(enumValue);
         }
 
       } // namespace SccDestinationFramerateMapper
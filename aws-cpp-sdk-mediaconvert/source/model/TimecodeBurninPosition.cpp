@@ -30,55 +30,86 @@ namespace Aws
       namespace TimecodeBurninPositionMapper
       {
 
-        static const int TOP_CENTER_HASH = HashingUtils::HashString("TOP_CENTER");
-        static const int TOP_LEFT_HASH = HashingUtils::HashString("TOP_LEFT");
-        static const int TOP_RIGHT_HASH = HashingUtils::HashString("TOP_RIGHT");
-        static const int MIDDLE_LEFT_HASH = HashingUtils::HashString("MIDDLE_LEFT");
-        static const int MIDDLE_CENTER_HASH = HashingUtils::HashString("MIDDLE_CENTER");
-        static const int MIDDLE_RIGHT_HASH = HashingUtils::HashString("MIDDLE_RIGHT");
-        static const int BOTTOM_LEFT_HASH = HashingUtils::HashString("BOTTOM_LEFT");
-        static const int BOTTOM_CENTER_HASH = HashingUtils::HashString("BOTTOM_CENTER");
-        static const int BOTTOM_RIGHT_HASH = HashingUtils::HashString("BOTTOM_RIGHT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TOP_CENTER",
+          "TOP_LEFT",
+          "TOP_RIGHT",
+          "MIDDLE_LEFT",
+          "MIDDLE_CENTER",
+          "MIDDLE_RIGHT",
+          "BOTTOM_LEFT",
+          "BOTTOM_CENTER",
+          "BOTTOM_RIGHT",
+        };
 
         TimecodeBurninPosition GetTimecodeBurninPositionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TOP_CENTER_HASH)
-          {
-            return TimecodeBurninPosition::TOP_CENTER;
-          }
-          else if (hashCode == TOP_LEFT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TimecodeBurninPosition::TOP_LEFT;
-          }
-          else if (hashCode == TOP_RIGHT_HASH)
-          {
-            return TimecodeBurninPosition::TOP_RIGHT;
-          }
-          else if (hashCode == MIDDLE_LEFT_HASH)
-          {
-            return TimecodeBurninPosition::MIDDLE_LEFT;
-          }
-          else if (hashCode == MIDDLE_CENTER_HASH)
-          {
-            return TimecodeBurninPosition::MIDDLE_CENTER;
-          }
-          else if (hashCode == MIDDLE_RIGHT_HASH)
-          {
-            return TimecodeBurninPosition::MIDDLE_RIGHT;
-          }
-          else if (hashCode == BOTTOM_LEFT_HASH)
-          {
-            return TimecodeBurninPosition::BOTTOM_LEFT;
-          }
-          else if (hashCode == BOTTOM_CENTER_HASH)
-          {
-            return TimecodeBurninPosition::BOTTOM_CENTER;
-          }
-          else if (hashCode == BOTTOM_RIGHT_HASH)
-          {
-            return TimecodeBurninPosition::BOTTOM_RIGHT;
+          case 2001412767:
+            if (name == "TOP_CENTER")
+            {
+              return TimecodeBurninPosition::TOP_CENTER;
+            }
+            break;
+          case -154073903:
+            if (name == "TOP_LEFT")
+            {
+              return TimecodeBurninPosition::TOP_LEFT;
+            }
+            break;
+          case -475662734:
+            if (name == "TOP_RIGHT")
+            {
+              return TimecodeBurninPosition::TOP_RIGHT;
+            }
+            break;
+          case -1691436943:
+            if (name == "MIDDLE_LEFT")
+            {
+              return TimecodeBurninPosition::MIDDLE_LEFT;
+            }
+            break;
+          case 2064281151:
+            if (name == "MIDDLE_CENTER")
+            {
+              return TimecodeBurninPosition::MIDDLE_CENTER;
+            }
+            break;
+          case -889276718:
+            if (name == "MIDDLE_RIGHT")
+            {
+              return TimecodeBurninPosition::MIDDLE_RIGHT;
+            }
+            break;
+          case 1573315995:
+            if (name == "BOTTOM_LEFT")
+            {
+              return TimecodeBurninPosition::BOTTOM_LEFT;
+            }
+            break;
+          case -129238807:
+            if (name == "BOTTOM_CENTER")
+            {
+              return TimecodeBurninPosition::BOTTOM_CENTER;
+            }
+            break;
+          case 1533816552:
+            if (name == "BOTTOM_RIGHT")
+            {
+              return TimecodeBurninPosition::BOTTOM_RIGHT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return TimecodeBurninPosition::NOT_SET;
         }
 
-        Aws::String GetNameForTimecodeBurninPosition(TimecodeBurninPosition enumValue)
+        const char* GetNameForTimecodeBurninPositionCStr(TimecodeBurninPosition enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TimecodeBurninPosition::TOP_CENTER:
-            return "TOP_CENTER";
-          case TimecodeBurninPosition::TOP_LEFT:
-            return "TOP_LEFT";
-          case TimecodeBurninPosition::TOP_RIGHT:
-            return "TOP_RIGHT";
-          case TimecodeBurninPosition::MIDDLE_LEFT:
-            return "MIDDLE_LEFT";
-          case TimecodeBurninPosition::MIDDLE_CENTER:
-            return "MIDDLE_CENTER";
-          case TimecodeBurninPosition::MIDDLE_RIGHT:
-            return "MIDDLE_RIGHT";
-          case TimecodeBurninPosition::BOTTOM_LEFT:
-            return "BOTTOM_LEFT";
-          case TimecodeBurninPosition::BOTTOM_CENTER:
-            return "BOTTOM_CENTER";
-          case TimecodeBurninPosition::BOTTOM_RIGHT:
-            return "BOTTOM_RIGHT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTimecodeBurninPosition(TimecodeBurninPosition enumValue)
+        {
+          return GetNameForTimecodeBurninPositionCStr(enumValue);
         }
 
       } // namespace TimecodeBurninPositionMapper
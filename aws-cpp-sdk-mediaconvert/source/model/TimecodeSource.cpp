@@ -30,25 +30,44 @@ namespace Aws
       namespace TimecodeSourceMapper
       {
 
-        static const int EMBEDDED_HASH = HashingUtils::HashString("EMBEDDED");
-        static const int ZEROBASED_HASH = HashingUtils::HashString("ZEROBASED");
-        static const int SPECIFIEDSTART_HASH = HashingUtils::HashString("SPECIFIEDSTART");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EMBEDDED",
+          "ZEROBASED",
+          "SPECIFIEDSTART",
+        };
 
         TimecodeSource GetTimecodeSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EMBEDDED_HASH)
-          {
-            return TimecodeSource::EMBEDDED;
-          }
-          else if (hashCode == ZEROBASED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TimecodeSource::ZEROBASED;
-          }
-          else if (hashCode == SPECIFIEDSTART_HASH)
-          {
-            return TimecodeSource::SPECIFIEDSTART;
+          case 1568475786:
+            if (name == "EMBEDDED")
+            {
+              return TimecodeSource::EMBEDDED;
+            }
+            break;
+          case -1676751381:
+            if (name == "ZEROBASED")
+            {
+              return TimecodeSource::ZEROBASED;
+            }
+            break;
+          case 1547991218:
+            if (name == "SPECIFIEDSTART")
+            {
+              return TimecodeSource::SPECIFIEDSTART;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TimecodeSource::NOT_SET;
         }
 
-        Aws::String GetNameForTimecodeSource(TimecodeSource enumValue)
+        const char* GetNameForTimecodeSourceCStr(TimecodeSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TimecodeSource::EMBEDDED:
-            return "EMBEDDED";
-          case TimecodeSource::ZEROBASED:
-            return "ZEROBASED";
-          case TimecodeSource::SPECIFIEDSTART:
-            return "SPECIFIEDSTART";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTimecodeSource(TimecodeSource enumValue)
+        {
+          return GetNameForTimecodeSourceCStr(enumValue);
         }
 
       } // namespace TimecodeSourceMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TypeMapper
       {
 
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
-        static const int CUSTOM_HASH = HashingUtils::HashString("CUSTOM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SYSTEM",
+          "CUSTOM",
+        };
 
         Type GetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SYSTEM_HASH)
-          {
-            return Type::SYSTEM;
-          }
-          else if (hashCode == CUSTOM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Type::CUSTOM;
+          case -1833998801:
+            if (name == "SYSTEM")
+            {
+              return Type::SYSTEM;
+            }
+            break;
+          case 1999208305:
+            if (name == "CUSTOM")
+            {
+              return Type::CUSTOM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Type::NOT_SET;
         }
 
-        Aws::String GetNameForType(Type enumValue)
+        const char* GetNameForTypeCStr(Type enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Type::SYSTEM:
-            return "SYSTEM";
-          case Type::CUSTOM:
-            return "CUSTOM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForType(Type enumValue)
+        {
+          return GetNameForTypeCStr(enumValue);
         }
 
       } // namespace TypeMapper
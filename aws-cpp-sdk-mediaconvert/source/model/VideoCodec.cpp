@@ -30,35 +30,58 @@ namespace Aws
       namespace VideoCodecMapper
       {
 
-        static const int FRAME_CAPTURE_HASH = HashingUtils::HashString("FRAME_CAPTURE");
-        static const int H_264_HASH = HashingUtils::HashString("H_264");
-        static const int H_265_HASH = HashingUtils::HashString("H_265");
-        static const int MPEG2_HASH = HashingUtils::HashString("MPEG2");
-        static const int PRORES_HASH = HashingUtils::HashString("PRORES");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FRAME_CAPTURE",
+          "H_264",
+          "H_265",
+          "MPEG2",
+          "PRORES",
+        };
 
         VideoCodec GetVideoCodecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FRAME_CAPTURE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VideoCodec::FRAME_CAPTURE;
-          }
-          else if (hashCode == H_264_HASH)
-          {
-            return VideoCodec::H_264;
-          }
-          else if (hashCode == H_265_HASH)
-          {
-            return VideoCodec::H_265;
-          }
-          else if (hashCode == MPEG2_HASH)
-          {
-            return VideoCodec::MPEG2;
-          }
-          else if (hashCode == PRORES_HASH)
-          {
-            return VideoCodec::PRORES;
+          case -979366348:
+            if (name == "FRAME_CAPTURE")
+            {
+              return VideoCodec::FRAME_CAPTURE;
+            }
+            break;
+          case 69373433:
+            if (name == "H_264")
+            {
+              return VideoCodec::H_264;
+            }
+            break;
+          case 69373434:
+            if (name == "H_265")
+            {
+              return VideoCodec::H_265;
+            }
+            break;
+          case 73562957:
+            if (name == "MPEG2")
+            {
+              return VideoCodec::MPEG2;
+            }
+            break;
+          case -1926471981:
+            if (name == "PRORES")
+            {
+              return VideoCodec::PRORES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return VideoCodec::NOT_SET;
         }
 
-        Aws::String GetNameForVideoCodec(VideoCodec enumValue)
+        const char* GetNameForVideoCodecCStr(VideoCodec enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VideoCodec::FRAME_CAPTURE:
-            return "FRAME_CAPTURE";
-          case VideoCodec::H_264:
-            return "H_264";
-          case VideoCodec::H_265:
-            return "H_265";
-          case VideoCodec::MPEG2:
-            return "MPEG2";
-          case VideoCodec::PRORES:
-            return "PRORES";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVideoCodec(VideoCodec enumValue)
+        {
+          return GetNameForVideoCodecCStr(enumValue);
         }
 
       } // namespace VideoCodecMapper
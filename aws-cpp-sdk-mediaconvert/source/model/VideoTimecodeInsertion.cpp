@@ -30,20 +30,37 @@ namespace Aws
       namespace VideoTimecodeInsertionMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int PIC_TIMING_SEI_HASH = HashingUtils::HashString("PIC_TIMING_SEI");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "PIC_TIMING_SEI",
+        };
 
         VideoTimecodeInsertion GetVideoTimecodeInsertionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return VideoTimecodeInsertion::DISABLED;
-          }
-          else if (hashCode == PIC_TIMING_SEI_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VideoTimecodeInsertion::PIC_TIMING_SEI;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return VideoTimecodeInsertion::DISABLED;
+            }
+            break;
+          case 708155575:
+            if (name == "PIC_TIMING_SEI")
+            {
+              return VideoTimecodeInsertion::PIC_TIMING_SEI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return VideoTimecodeInsertion::NOT_SET;
         }
 
-        Aws::String GetNameForVideoTimecodeInsertion(VideoTimecodeInsertion enumValue)
+        const char* GetNameForVideoTimecodeInsertionCStr(VideoTimecodeInsertion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VideoTimecodeInsertion::DISABLED:
-            return "DISABLED";
-          case VideoTimecodeInsertion::PIC_TIMING_SEI:
-            return "PIC_TIMING_SEI";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVideoTimecodeInsertion(VideoTimecodeInsertion enumValue)
+        {
+          return GetNameForVideoTimecodeInsertionCStr(enumValue);
         }
 
       } // namespace VideoTimecodeInsertionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace WavFormatMapper
       {
 
-        static const int RIFF_HASH = HashingUtils::HashString("RIFF");
-        static const int RF64_HASH = HashingUtils::HashString("RF64");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RIFF",
+          "RF64",
+        };
 
         WavFormat GetWavFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RIFF_HASH)
-          {
-            return WavFormat::RIFF;
-          }
-          else if (hashCode == RF64_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WavFormat::RF64;
+          case 2515255:
+            if (name == "RIFF")
+            {
+              return WavFormat::RIFF;
+            }
+            break;
+          case 2511858:
+            if (name == "RF64")
+            {
+              return WavFormat::RF64;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return WavFormat::NOT_SET;
         }
 
-        Aws::String GetNameForWavFormat(WavFormat enumValue)
+        const char* GetNameForWavFormatCStr(WavFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WavFormat::RIFF:
-            return "RIFF";
-          case WavFormat::RF64:
-            return "RF64";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWavFormat(WavFormat enumValue)
+        {
+          return GetNameForWavFormatCStr(enumValue);
         }
 
       } // namespace WavFormatMapper
@@ -35,6 +35,11 @@ namespace AacInputTypeMapper
 AWS_MEDIALIVE_API AacInputType GetAacInputTypeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAacInputType(AacInputType value);
+
+/**
+ * Same as GetNameForAacInputType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAacInputTypeCStr(AacInputType value);
 } // namespace AacInputTypeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace AacProfileMapper
 AWS_MEDIALIVE_API AacProfile GetAacProfileForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAacProfile(AacProfile value);
+
+/**
+ * Same as GetNameForAacProfile(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAacProfileCStr(AacProfile value);
 } // namespace AacProfileMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace AacRawFormatMapper
 AWS_MEDIALIVE_API AacRawFormat GetAacRawFormatForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAacRawFormat(AacRawFormat value);
+
+/**
+ * Same as GetNameForAacRawFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAacRawFormatCStr(AacRawFormat value);
 } // namespace AacRawFormatMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace AacSpecMapper
 AWS_MEDIALIVE_API AacSpec GetAacSpecForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAacSpec(AacSpec value);
+
+/**
+ * Same as GetNameForAacSpec(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAacSpecCStr(AacSpec value);
 } // namespace AacSpecMapper
 } // namespace Model
 } // namespace MediaLive
@@ -37,6 +37,11 @@ namespace AacVbrQualityMapper
 AWS_MEDIALIVE_API AacVbrQuality GetAacVbrQualityForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAacVbrQuality(AacVbrQuality value);
+
+/**
+ * Same as GetNameForAacVbrQuality(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAacVbrQualityCStr(AacVbrQuality value);
 } // namespace AacVbrQualityMapper
 } // namespace Model
 } // namespace MediaLive
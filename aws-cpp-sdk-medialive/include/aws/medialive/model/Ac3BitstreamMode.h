@@ -41,6 +41,11 @@ namespace Ac3BitstreamModeMapper
 AWS_MEDIALIVE_API Ac3BitstreamMode GetAc3BitstreamModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAc3BitstreamMode(Ac3BitstreamMode value);
+
+/**
+ * Same as GetNameForAc3BitstreamMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAc3BitstreamModeCStr(Ac3BitstreamMode value);
 } // namespace Ac3BitstreamModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -37,6 +37,11 @@ namespace Ac3CodingModeMapper
 AWS_MEDIALIVE_API Ac3CodingMode GetAc3CodingModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAc3CodingMode(Ac3CodingMode value);
+
+/**
+ * Same as GetNameForAc3CodingMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAc3CodingModeCStr(Ac3CodingMode value);
 } // namespace Ac3CodingModeMapper
 } // namespace Model
 } // namespace MediaLive
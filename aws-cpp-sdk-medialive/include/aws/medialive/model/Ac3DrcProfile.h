@@ -35,6 +35,11 @@ namespace Ac3DrcProfileMapper
 AWS_MEDIALIVE_API Ac3DrcProfile GetAc3DrcProfileForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAc3DrcProfile(Ac3DrcProfile value);
+
+/**
+ * Same as GetNameForAc3DrcProfile(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAc3DrcProfileCStr(Ac3DrcProfile value);
 } // namespace Ac3DrcProfileMapper
 } // namespace Model
 } // namespace MediaLive
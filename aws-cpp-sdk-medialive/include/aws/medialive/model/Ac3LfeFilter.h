@@ -35,6 +35,11 @@ namespace Ac3LfeFilterMapper
 AWS_MEDIALIVE_API Ac3LfeFilter GetAc3LfeFilterForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAc3LfeFilter(Ac3LfeFilter value);
+
+/**
+ * Same as GetNameForAc3LfeFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAc3LfeFilterCStr(Ac3LfeFilter value);
 } // namespace Ac3LfeFilterMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace AfdSignalingMapper
 AWS_MEDIALIVE_API AfdSignaling GetAfdSignalingForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAfdSignaling(AfdSignaling value);
+
+/**
+ * Same as GetNameForAfdSignaling(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAfdSignalingCStr(AfdSignaling value);
 } // namespace AfdSignalingMapper
 } // namespace Model
 } // namespace MediaLive
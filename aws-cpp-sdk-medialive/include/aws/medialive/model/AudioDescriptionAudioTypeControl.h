@@ -35,6 +35,11 @@ namespace AudioDescriptionAudioTypeControlMapper
 AWS_MEDIALIVE_API AudioDescriptionAudioTypeControl GetAudioDescriptionAudioTypeControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAudioDescriptionAudioTypeControl(AudioDescriptionAudioTypeControl value);
+
+/**
+ * Same as GetNameForAudioDescriptionAudioTypeControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAudioDescriptionAudioTypeControlCStr(AudioDescriptionAudioTypeControl value);
 } // namespace AudioDescriptionAudioTypeControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace AudioDescriptionLanguageCodeControlMapper
 AWS_MEDIALIVE_API AudioDescriptionLanguageCodeControl GetAudioDescriptionLanguageCodeControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAudioDescriptionLanguageCodeControl(AudioDescriptionLanguageCodeControl value);
+
+/**
+ * Same as GetNameForAudioDescriptionLanguageCodeControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAudioDescriptionLanguageCodeControlCStr(AudioDescriptionLanguageCodeControl value);
 } // namespace AudioDescriptionLanguageCodeControlMapper
 } // namespace Model
 } // namespace MediaLive
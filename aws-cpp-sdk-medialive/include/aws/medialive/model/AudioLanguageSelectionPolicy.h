@@ -35,6 +35,11 @@ namespace AudioLanguageSelectionPolicyMapper
 AWS_MEDIALIVE_API AudioLanguageSelectionPolicy GetAudioLanguageSelectionPolicyForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAudioLanguageSelectionPolicy(AudioLanguageSelectionPolicy value);
+
+/**
+ * Same as GetNameForAudioLanguageSelectionPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAudioLanguageSelectionPolicyCStr(AudioLanguageSelectionPolicy value);
 } // namespace AudioLanguageSelectionPolicyMapper
 } // namespace Model
 } // namespace MediaLive
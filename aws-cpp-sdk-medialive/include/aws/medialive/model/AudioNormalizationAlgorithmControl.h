@@ -34,6 +34,11 @@ namespace AudioNormalizationAlgorithmControlMapper
 AWS_MEDIALIVE_API AudioNormalizationAlgorithmControl GetAudioNormalizationAlgorithmControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAudioNormalizationAlgorithmControl(AudioNormalizationAlgorithmControl value);
+
+/**
+ * Same as GetNameForAudioNormalizationAlgorithmControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAudioNormalizationAlgorithmControlCStr(AudioNormalizationAlgorithmControl value);
 } // namespace AudioNormalizationAlgorithmControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -37,6 +37,11 @@ namespace AudioOnlyHlsTrackTypeMapper
 AWS_MEDIALIVE_API AudioOnlyHlsTrackType GetAudioOnlyHlsTrackTypeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAudioOnlyHlsTrackType(AudioOnlyHlsTrackType value);
+
+/**
+ * Same as GetNameForAudioOnlyHlsTrackType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAudioOnlyHlsTrackTypeCStr(AudioOnlyHlsTrackType value);
 } // namespace AudioOnlyHlsTrackTypeMapper
 } // namespace Model
 } // namespace MediaLive
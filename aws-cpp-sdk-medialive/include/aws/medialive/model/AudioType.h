@@ -37,6 +37,11 @@ namespace AudioTypeMapper
 AWS_MEDIALIVE_API AudioType GetAudioTypeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAudioType(AudioType value);
+
+/**
+ * Same as GetNameForAudioType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAudioTypeCStr(AudioType value);
 } // namespace AudioTypeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace AuthenticationSchemeMapper
 AWS_MEDIALIVE_API AuthenticationScheme GetAuthenticationSchemeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAuthenticationScheme(AuthenticationScheme value);
+
+/**
+ * Same as GetNameForAuthenticationScheme(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAuthenticationSchemeCStr(AuthenticationScheme value);
 } // namespace AuthenticationSchemeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace AvailBlankingStateMapper
 AWS_MEDIALIVE_API AvailBlankingState GetAvailBlankingStateForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForAvailBlankingState(AvailBlankingState value);
+
+/**
+ * Same as GetNameForAvailBlankingState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForAvailBlankingStateCStr(AvailBlankingState value);
 } // namespace AvailBlankingStateMapper
 } // namespace Model
 } // namespace MediaLive
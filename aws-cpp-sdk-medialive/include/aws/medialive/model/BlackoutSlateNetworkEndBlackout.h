@@ -35,6 +35,11 @@ namespace BlackoutSlateNetworkEndBlackoutMapper
 AWS_MEDIALIVE_API BlackoutSlateNetworkEndBlackout GetBlackoutSlateNetworkEndBlackoutForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForBlackoutSlateNetworkEndBlackout(BlackoutSlateNetworkEndBlackout value);
+
+/**
+ * Same as GetNameForBlackoutSlateNetworkEndBlackout(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForBlackoutSlateNetworkEndBlackoutCStr(BlackoutSlateNetworkEndBlackout value);
 } // namespace BlackoutSlateNetworkEndBlackoutMapper
 } // namespace Model
 } // namespace MediaLive
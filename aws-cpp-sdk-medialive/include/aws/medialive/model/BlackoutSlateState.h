@@ -35,6 +35,11 @@ namespace BlackoutSlateStateMapper
 AWS_MEDIALIVE_API BlackoutSlateState GetBlackoutSlateStateForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForBlackoutSlateState(BlackoutSlateState value);
+
+/**
+ * Same as GetNameForBlackoutSlateState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForBlackoutSlateStateCStr(BlackoutSlateState value);
 } // namespace BlackoutSlateStateMapper
 } // namespace Model
 } // namespace MediaLive
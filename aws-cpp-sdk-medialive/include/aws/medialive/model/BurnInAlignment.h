@@ -36,6 +36,11 @@ namespace BurnInAlignmentMapper
 AWS_MEDIALIVE_API BurnInAlignment GetBurnInAlignmentForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForBurnInAlignment(BurnInAlignment value);
+
+/**
+ * Same as GetNameForBurnInAlignment(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForBurnInAlignmentCStr(BurnInAlignment value);
 } // namespace BurnInAlignmentMapper
 } // namespace Model
 } // namespace MediaLive
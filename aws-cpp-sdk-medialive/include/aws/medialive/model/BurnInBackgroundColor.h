@@ -36,6 +36,11 @@ namespace BurnInBackgroundColorMapper
 AWS_MEDIALIVE_API BurnInBackgroundColor GetBurnInBackgroundColorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForBurnInBackgroundColor(BurnInBackgroundColor value);
+
+/**
+ * Same as GetNameForBurnInBackgroundColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForBurnInBackgroundColorCStr(BurnInBackgroundColor value);
 } // namespace BurnInBackgroundColorMapper
 } // namespace Model
 } // namespace MediaLive
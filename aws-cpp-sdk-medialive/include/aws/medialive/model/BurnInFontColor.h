@@ -39,6 +39,11 @@ namespace BurnInFontColorMapper
 AWS_MEDIALIVE_API BurnInFontColor GetBurnInFontColorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForBurnInFontColor(BurnInFontColor value);
+
+/**
+ * Same as GetNameForBurnInFontColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForBurnInFontColorCStr(BurnInFontColor value);
 } // namespace BurnInFontColorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -39,6 +39,11 @@ namespace BurnInOutlineColorMapper
 AWS_MEDIALIVE_API BurnInOutlineColor GetBurnInOutlineColorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForBurnInOutlineColor(BurnInOutlineColor value);
+
+/**
+ * Same as GetNameForBurnInOutlineColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForBurnInOutlineColorCStr(BurnInOutlineColor value);
 } // namespace BurnInOutlineColorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace BurnInShadowColorMapper
 AWS_MEDIALIVE_API BurnInShadowColor GetBurnInShadowColorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForBurnInShadowColor(BurnInShadowColor value);
+
+/**
+ * Same as GetNameForBurnInShadowColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForBurnInShadowColorCStr(BurnInShadowColor value);
 } // namespace BurnInShadowColorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace BurnInTeletextGridControlMapper
 AWS_MEDIALIVE_API BurnInTeletextGridControl GetBurnInTeletextGridControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForBurnInTeletextGridControl(BurnInTeletextGridControl value);
+
+/**
+ * Same as GetNameForBurnInTeletextGridControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForBurnInTeletextGridControlCStr(BurnInTeletextGridControl value);
 } // namespace BurnInTeletextGridControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -42,6 +42,11 @@ namespace ChannelStateMapper
 AWS_MEDIALIVE_API ChannelState GetChannelStateForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForChannelState(ChannelState value);
+
+/**
+ * Same as GetNameForChannelState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForChannelStateCStr(ChannelState value);
 } // namespace ChannelStateMapper
 } // namespace Model
 } // namespace MediaLive
@@ -37,6 +37,11 @@ namespace DvbSdtOutputSdtMapper
 AWS_MEDIALIVE_API DvbSdtOutputSdt GetDvbSdtOutputSdtForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForDvbSdtOutputSdt(DvbSdtOutputSdt value);
+
+/**
+ * Same as GetNameForDvbSdtOutputSdt(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForDvbSdtOutputSdtCStr(DvbSdtOutputSdt value);
 } // namespace DvbSdtOutputSdtMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace DvbSubDestinationAlignmentMapper
 AWS_MEDIALIVE_API DvbSubDestinationAlignment GetDvbSubDestinationAlignmentForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationAlignment(DvbSubDestinationAlignment value);
+
+/**
+ * Same as GetNameForDvbSubDestinationAlignment(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationAlignmentCStr(DvbSubDestinationAlignment value);
 } // namespace DvbSubDestinationAlignmentMapper
 } // namespace Model
 } // namespace MediaLive
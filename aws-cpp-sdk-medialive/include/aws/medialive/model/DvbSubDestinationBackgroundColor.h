@@ -36,6 +36,11 @@ namespace DvbSubDestinationBackgroundColorMapper
 AWS_MEDIALIVE_API DvbSubDestinationBackgroundColor GetDvbSubDestinationBackgroundColorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationBackgroundColor(DvbSubDestinationBackgroundColor value);
+
+/**
+ * Same as GetNameForDvbSubDestinationBackgroundColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationBackgroundColorCStr(DvbSubDestinationBackgroundColor value);
 } // namespace DvbSubDestinationBackgroundColorMapper
 } // namespace Model
 } // namespace MediaLive
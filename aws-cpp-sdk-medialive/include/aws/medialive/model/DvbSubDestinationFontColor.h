@@ -39,6 +39,11 @@ namespace DvbSubDestinationFontColorMapper
 AWS_MEDIALIVE_API DvbSubDestinationFontColor GetDvbSubDestinationFontColorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationFontColor(DvbSubDestinationFontColor value);
+
+/**
+ * Same as GetNameForDvbSubDestinationFontColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationFontColorCStr(DvbSubDestinationFontColor value);
 } // namespace DvbSubDestinationFontColorMapper
 } // namespace Model
 } // namespace MediaLive
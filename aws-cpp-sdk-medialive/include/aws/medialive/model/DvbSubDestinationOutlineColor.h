@@ -39,6 +39,11 @@ namespace DvbSubDestinationOutlineColorMapper
 AWS_MEDIALIVE_API DvbSubDestinationOutlineColor GetDvbSubDestinationOutlineColorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationOutlineColor(DvbSubDestinationOutlineColor value);
+
+/**
+ * Same as GetNameForDvbSubDestinationOutlineColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationOutlineColorCStr(DvbSubDestinationOutlineColor value);
 } // namespace DvbSubDestinationOutlineColorMapper
 } // namespace Model
 } // namespace MediaLive
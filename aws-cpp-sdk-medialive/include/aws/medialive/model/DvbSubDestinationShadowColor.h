@@ -36,6 +36,11 @@ namespace DvbSubDestinationShadowColorMapper
 AWS_MEDIALIVE_API DvbSubDestinationShadowColor GetDvbSubDestinationShadowColorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationShadowColor(DvbSubDestinationShadowColor value);
+
+/**
+ * Same as GetNameForDvbSubDestinationShadowColor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationShadowColorCStr(DvbSubDestinationShadowColor value);
 } // namespace DvbSubDestinationShadowColorMapper
 } // namespace Model
 } // namespace MediaLive
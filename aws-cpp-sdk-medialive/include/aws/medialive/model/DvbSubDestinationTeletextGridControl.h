@@ -35,6 +35,11 @@ namespace DvbSubDestinationTeletextGridControlMapper
 AWS_MEDIALIVE_API DvbSubDestinationTeletextGridControl GetDvbSubDestinationTeletextGridControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationTeletextGridControl(DvbSubDestinationTeletextGridControl value);
+
+/**
+ * Same as GetNameForDvbSubDestinationTeletextGridControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationTeletextGridControlCStr(DvbSubDestinationTeletextGridControl value);
 } // namespace DvbSubDestinationTeletextGridControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace Eac3CodingModeMapper
 AWS_MEDIALIVE_API Eac3CodingMode GetEac3CodingModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForEac3CodingMode(Eac3CodingMode value);
+
+/**
+ * Same as GetNameForEac3CodingMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForEac3CodingModeCStr(Eac3CodingMode value);
 } // namespace Eac3CodingModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -39,6 +39,11 @@ namespace Eac3DrcLineMapper
 AWS_MEDIALIVE_API Eac3DrcLine GetEac3DrcLineForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForEac3DrcLine(Eac3DrcLine value);
+
+/**
+ * Same as GetNameForEac3DrcLine(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForEac3DrcLineCStr(Eac3DrcLine value);
 } // namespace Eac3DrcLineMapper
 } // namespace Model
 } // namespace MediaLive
@@ -39,6 +39,11 @@ namespace Eac3DrcRfMapper
 AWS_MEDIALIVE_API Eac3DrcRf GetEac3DrcRfForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForEac3DrcRf(Eac3DrcRf value);
+
+/**
+ * Same as GetNameForEac3DrcRf(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForEac3DrcRfCStr(Eac3DrcRf value);
 } // namespace Eac3DrcRfMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace Eac3LfeFilterMapper
 AWS_MEDIALIVE_API Eac3LfeFilter GetEac3LfeFilterForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForEac3LfeFilter(Eac3LfeFilter value);
+
+/**
+ * Same as GetNameForEac3LfeFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForEac3LfeFilterCStr(Eac3LfeFilter value);
 } // namespace Eac3LfeFilterMapper
 } // namespace Model
 } // namespace MediaLive
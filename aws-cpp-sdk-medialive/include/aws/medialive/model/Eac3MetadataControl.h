@@ -35,6 +35,11 @@ namespace Eac3MetadataControlMapper
 AWS_MEDIALIVE_API Eac3MetadataControl GetEac3MetadataControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForEac3MetadataControl(Eac3MetadataControl value);
+
+/**
+ * Same as GetNameForEac3MetadataControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForEac3MetadataControlCStr(Eac3MetadataControl value);
 } // namespace Eac3MetadataControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace Eac3SurroundExModeMapper
 AWS_MEDIALIVE_API Eac3SurroundExMode GetEac3SurroundExModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForEac3SurroundExMode(Eac3SurroundExMode value);
+
+/**
+ * Same as GetNameForEac3SurroundExMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForEac3SurroundExModeCStr(Eac3SurroundExMode value);
 } // namespace Eac3SurroundExModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace EmbeddedConvert608To708Mapper
 AWS_MEDIALIVE_API EmbeddedConvert608To708 GetEmbeddedConvert608To708ForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForEmbeddedConvert608To708(EmbeddedConvert608To708 value);
+
+/**
+ * Same as GetNameForEmbeddedConvert608To708(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForEmbeddedConvert608To708CStr(EmbeddedConvert608To708 value);
 } // namespace EmbeddedConvert608To708Mapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace EmbeddedScte20DetectionMapper
 AWS_MEDIALIVE_API EmbeddedScte20Detection GetEmbeddedScte20DetectionForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForEmbeddedScte20Detection(EmbeddedScte20Detection value);
+
+/**
+ * Same as GetNameForEmbeddedScte20Detection(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForEmbeddedScte20DetectionCStr(EmbeddedScte20Detection value);
 } // namespace EmbeddedScte20DetectionMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace FecOutputIncludeFecMapper
 AWS_MEDIALIVE_API FecOutputIncludeFec GetFecOutputIncludeFecForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForFecOutputIncludeFec(FecOutputIncludeFec value);
+
+/**
+ * Same as GetNameForFecOutputIncludeFec(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForFecOutputIncludeFecCStr(FecOutputIncludeFec value);
 } // namespace FecOutputIncludeFecMapper
 } // namespace Model
 } // namespace MediaLive
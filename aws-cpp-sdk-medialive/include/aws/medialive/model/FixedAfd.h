@@ -44,6 +44,11 @@ namespace FixedAfdMapper
 AWS_MEDIALIVE_API FixedAfd GetFixedAfdForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForFixedAfd(FixedAfd value);
+
+/**
+ * Same as GetNameForFixedAfd(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForFixedAfdCStr(FixedAfd value);
 } // namespace FixedAfdMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace FollowPointMapper
 AWS_MEDIALIVE_API FollowPoint GetFollowPointForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForFollowPoint(FollowPoint value);
+
+/**
+ * Same as GetNameForFollowPoint(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForFollowPointCStr(FollowPoint value);
 } // namespace FollowPointMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace GlobalConfigurationInputEndActionMapper
 AWS_MEDIALIVE_API GlobalConfigurationInputEndAction GetGlobalConfigurationInputEndActionForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForGlobalConfigurationInputEndAction(GlobalConfigurationInputEndAction value);
+
+/**
+ * Same as GetNameForGlobalConfigurationInputEndAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForGlobalConfigurationInputEndActionCStr(GlobalConfigurationInputEndAction value);
 } // namespace GlobalConfigurationInputEndActionMapper
 } // namespace Model
 } // namespace MediaLive
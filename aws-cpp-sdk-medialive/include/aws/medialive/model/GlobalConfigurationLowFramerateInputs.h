@@ -35,6 +35,11 @@ namespace GlobalConfigurationLowFramerateInputsMapper
 AWS_MEDIALIVE_API GlobalConfigurationLowFramerateInputs GetGlobalConfigurationLowFramerateInputsForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForGlobalConfigurationLowFramerateInputs(GlobalConfigurationLowFramerateInputs value);
+
+/**
+ * Same as GetNameForGlobalConfigurationLowFramerateInputs(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForGlobalConfigurationLowFramerateInputsCStr(GlobalConfigurationLowFramerateInputs value);
 } // namespace GlobalConfigurationLowFramerateInputsMapper
 } // namespace Model
 } // namespace MediaLive
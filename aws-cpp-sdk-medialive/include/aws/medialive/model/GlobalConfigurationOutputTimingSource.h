@@ -35,6 +35,11 @@ namespace GlobalConfigurationOutputTimingSourceMapper
 AWS_MEDIALIVE_API GlobalConfigurationOutputTimingSource GetGlobalConfigurationOutputTimingSourceForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForGlobalConfigurationOutputTimingSource(GlobalConfigurationOutputTimingSource value);
+
+/**
+ * Same as GetNameForGlobalConfigurationOutputTimingSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForGlobalConfigurationOutputTimingSourceCStr(GlobalConfigurationOutputTimingSource value);
 } // namespace GlobalConfigurationOutputTimingSourceMapper
 } // namespace Model
 } // namespace MediaLive
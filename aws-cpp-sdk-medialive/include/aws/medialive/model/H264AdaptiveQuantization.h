@@ -39,6 +39,11 @@ namespace H264AdaptiveQuantizationMapper
 AWS_MEDIALIVE_API H264AdaptiveQuantization GetH264AdaptiveQuantizationForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264AdaptiveQuantization(H264AdaptiveQuantization value);
+
+/**
+ * Same as GetNameForH264AdaptiveQuantization(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264AdaptiveQuantizationCStr(H264AdaptiveQuantization value);
 } // namespace H264AdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace H264ColorMetadataMapper
 AWS_MEDIALIVE_API H264ColorMetadata GetH264ColorMetadataForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264ColorMetadata(H264ColorMetadata value);
+
+/**
+ * Same as GetNameForH264ColorMetadata(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264ColorMetadataCStr(H264ColorMetadata value);
 } // namespace H264ColorMetadataMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace H264EntropyEncodingMapper
 AWS_MEDIALIVE_API H264EntropyEncoding GetH264EntropyEncodingForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264EntropyEncoding(H264EntropyEncoding value);
+
+/**
+ * Same as GetNameForH264EntropyEncoding(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264EntropyEncodingCStr(H264EntropyEncoding value);
 } // namespace H264EntropyEncodingMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace H264FlickerAqMapper
 AWS_MEDIALIVE_API H264FlickerAq GetH264FlickerAqForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264FlickerAq(H264FlickerAq value);
+
+/**
+ * Same as GetNameForH264FlickerAq(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264FlickerAqCStr(H264FlickerAq value);
 } // namespace H264FlickerAqMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace H264FramerateControlMapper
 AWS_MEDIALIVE_API H264FramerateControl GetH264FramerateControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264FramerateControl(H264FramerateControl value);
+
+/**
+ * Same as GetNameForH264FramerateControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264FramerateControlCStr(H264FramerateControl value);
 } // namespace H264FramerateControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -50,6 +50,11 @@ namespace H264LevelMapper
 AWS_MEDIALIVE_API H264Level GetH264LevelForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264Level(H264Level value);
+
+/**
+ * Same as GetNameForH264Level(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264LevelCStr(H264Level value);
 } // namespace H264LevelMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace H264LookAheadRateControlMapper
 AWS_MEDIALIVE_API H264LookAheadRateControl GetH264LookAheadRateControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264LookAheadRateControl(H264LookAheadRateControl value);
+
+/**
+ * Same as GetNameForH264LookAheadRateControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264LookAheadRateControlCStr(H264LookAheadRateControl value);
 } // namespace H264LookAheadRateControlMapper
 } // namespace Model
 } // namespace MediaLive
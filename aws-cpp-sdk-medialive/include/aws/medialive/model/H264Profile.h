@@ -39,6 +39,11 @@ namespace H264ProfileMapper
 AWS_MEDIALIVE_API H264Profile GetH264ProfileForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264Profile(H264Profile value);
+
+/**
+ * Same as GetNameForH264Profile(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264ProfileCStr(H264Profile value);
 } // namespace H264ProfileMapper
 } // namespace Model
 } // namespace MediaLive
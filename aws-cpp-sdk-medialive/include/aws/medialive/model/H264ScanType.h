@@ -35,6 +35,11 @@ namespace H264ScanTypeMapper
 AWS_MEDIALIVE_API H264ScanType GetH264ScanTypeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264ScanType(H264ScanType value);
+
+/**
+ * Same as GetNameForH264ScanType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264ScanTypeCStr(H264ScanType value);
 } // namespace H264ScanTypeMapper
 } // namespace Model
 } // namespace MediaLive
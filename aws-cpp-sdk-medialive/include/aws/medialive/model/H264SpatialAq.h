@@ -35,6 +35,11 @@ namespace H264SpatialAqMapper
 AWS_MEDIALIVE_API H264SpatialAq GetH264SpatialAqForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264SpatialAq(H264SpatialAq value);
+
+/**
+ * Same as GetNameForH264SpatialAq(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264SpatialAqCStr(H264SpatialAq value);
 } // namespace H264SpatialAqMapper
 } // namespace Model
 } // namespace MediaLive
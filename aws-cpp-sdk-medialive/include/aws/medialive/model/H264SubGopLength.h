@@ -35,6 +35,11 @@ namespace H264SubGopLengthMapper
 AWS_MEDIALIVE_API H264SubGopLength GetH264SubGopLengthForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264SubGopLength(H264SubGopLength value);
+
+/**
+ * Same as GetNameForH264SubGopLength(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264SubGopLengthCStr(H264SubGopLength value);
 } // namespace H264SubGopLengthMapper
 } // namespace Model
 } // namespace MediaLive
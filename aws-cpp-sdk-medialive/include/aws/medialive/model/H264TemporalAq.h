@@ -35,6 +35,11 @@ namespace H264TemporalAqMapper
 AWS_MEDIALIVE_API H264TemporalAq GetH264TemporalAqForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264TemporalAq(H264TemporalAq value);
+
+/**
+ * Same as GetNameForH264TemporalAq(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264TemporalAqCStr(H264TemporalAq value);
 } // namespace H264TemporalAqMapper
 } // namespace Model
 } // namespace MediaLive
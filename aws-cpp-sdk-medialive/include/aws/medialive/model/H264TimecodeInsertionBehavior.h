@@ -35,6 +35,11 @@ namespace H264TimecodeInsertionBehaviorMapper
 AWS_MEDIALIVE_API H264TimecodeInsertionBehavior GetH264TimecodeInsertionBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForH264TimecodeInsertionBehavior(H264TimecodeInsertionBehavior value);
+
+/**
+ * Same as GetNameForH264TimecodeInsertionBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForH264TimecodeInsertionBehaviorCStr(H264TimecodeInsertionBehavior value);
 } // namespace H264TimecodeInsertionBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
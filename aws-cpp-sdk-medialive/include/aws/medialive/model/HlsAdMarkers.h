@@ -36,6 +36,11 @@ namespace HlsAdMarkersMapper
 AWS_MEDIALIVE_API HlsAdMarkers GetHlsAdMarkersForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsAdMarkers(HlsAdMarkers value);
+
+/**
+ * Same as GetNameForHlsAdMarkers(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsAdMarkersCStr(HlsAdMarkers value);
 } // namespace HlsAdMarkersMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace HlsAkamaiHttpTransferModeMapper
 AWS_MEDIALIVE_API HlsAkamaiHttpTransferMode GetHlsAkamaiHttpTransferModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsAkamaiHttpTransferMode(HlsAkamaiHttpTransferMode value);
+
+/**
+ * Same as GetNameForHlsAkamaiHttpTransferMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsAkamaiHttpTransferModeCStr(HlsAkamaiHttpTransferMode value);
 } // namespace HlsAkamaiHttpTransferModeMapper
 } // namespace Model
 } // namespace MediaLive
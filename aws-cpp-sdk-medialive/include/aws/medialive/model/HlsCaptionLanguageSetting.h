@@ -36,6 +36,11 @@ namespace HlsCaptionLanguageSettingMapper
 AWS_MEDIALIVE_API HlsCaptionLanguageSetting GetHlsCaptionLanguageSettingForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsCaptionLanguageSetting(HlsCaptionLanguageSetting value);
+
+/**
+ * Same as GetNameForHlsCaptionLanguageSetting(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsCaptionLanguageSettingCStr(HlsCaptionLanguageSetting value);
 } // namespace HlsCaptionLanguageSettingMapper
 } // namespace Model
 } // namespace MediaLive
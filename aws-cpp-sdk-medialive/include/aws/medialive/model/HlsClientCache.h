@@ -35,6 +35,11 @@ namespace HlsClientCacheMapper
 AWS_MEDIALIVE_API HlsClientCache GetHlsClientCacheForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsClientCache(HlsClientCache value);
+
+/**
+ * Same as GetNameForHlsClientCache(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsClientCacheCStr(HlsClientCache value);
 } // namespace HlsClientCacheMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace HlsCodecSpecificationMapper
 AWS_MEDIALIVE_API HlsCodecSpecification GetHlsCodecSpecificationForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsCodecSpecification(HlsCodecSpecification value);
+
+/**
+ * Same as GetNameForHlsCodecSpecification(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsCodecSpecificationCStr(HlsCodecSpecification value);
 } // namespace HlsCodecSpecificationMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace HlsDirectoryStructureMapper
 AWS_MEDIALIVE_API HlsDirectoryStructure GetHlsDirectoryStructureForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsDirectoryStructure(HlsDirectoryStructure value);
+
+/**
+ * Same as GetNameForHlsDirectoryStructure(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsDirectoryStructureCStr(HlsDirectoryStructure value);
 } // namespace HlsDirectoryStructureMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace HlsIvInManifestMapper
 AWS_MEDIALIVE_API HlsIvInManifest GetHlsIvInManifestForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsIvInManifest(HlsIvInManifest value);
+
+/**
+ * Same as GetNameForHlsIvInManifest(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsIvInManifestCStr(HlsIvInManifest value);
 } // namespace HlsIvInManifestMapper
 } // namespace Model
 } // namespace MediaLive
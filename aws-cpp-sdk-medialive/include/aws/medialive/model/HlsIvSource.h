@@ -35,6 +35,11 @@ namespace HlsIvSourceMapper
 AWS_MEDIALIVE_API HlsIvSource GetHlsIvSourceForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsIvSource(HlsIvSource value);
+
+/**
+ * Same as GetNameForHlsIvSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsIvSourceCStr(HlsIvSource value);
 } // namespace HlsIvSourceMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace HlsManifestDurationFormatMapper
 AWS_MEDIALIVE_API HlsManifestDurationFormat GetHlsManifestDurationFormatForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsManifestDurationFormat(HlsManifestDurationFormat value);
+
+/**
+ * Same as GetNameForHlsManifestDurationFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsManifestDurationFormatCStr(HlsManifestDurationFormat value);
 } // namespace HlsManifestDurationFormatMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,6 +34,11 @@ namespace HlsMediaStoreStorageClassMapper
 AWS_MEDIALIVE_API HlsMediaStoreStorageClass GetHlsMediaStoreStorageClassForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsMediaStoreStorageClass(HlsMediaStoreStorageClass value);
+
+/**
+ * Same as GetNameForHlsMediaStoreStorageClass(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsMediaStoreStorageClassCStr(HlsMediaStoreStorageClass value);
 } // namespace HlsMediaStoreStorageClassMapper
 } // namespace Model
 } // namespace MediaLive
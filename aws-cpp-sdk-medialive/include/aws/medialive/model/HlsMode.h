@@ -35,6 +35,11 @@ namespace HlsModeMapper
 AWS_MEDIALIVE_API HlsMode GetHlsModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsMode(HlsMode value);
+
+/**
+ * Same as GetNameForHlsMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsModeCStr(HlsMode value);
 } // namespace HlsModeMapper
 } // namespace Model
 } // namespace MediaLive
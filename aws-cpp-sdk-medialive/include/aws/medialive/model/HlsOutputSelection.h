@@ -35,6 +35,11 @@ namespace HlsOutputSelectionMapper
 AWS_MEDIALIVE_API HlsOutputSelection GetHlsOutputSelectionForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsOutputSelection(HlsOutputSelection value);
+
+/**
+ * Same as GetNameForHlsOutputSelection(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsOutputSelectionCStr(HlsOutputSelection value);
 } // namespace HlsOutputSelectionMapper
 } // namespace Model
 } // namespace MediaLive
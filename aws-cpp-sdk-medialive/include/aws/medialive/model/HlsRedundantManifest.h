@@ -35,6 +35,11 @@ namespace HlsRedundantManifestMapper
 AWS_MEDIALIVE_API HlsRedundantManifest GetHlsRedundantManifestForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsRedundantManifest(HlsRedundantManifest value);
+
+/**
+ * Same as GetNameForHlsRedundantManifest(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsRedundantManifestCStr(HlsRedundantManifest value);
 } // namespace HlsRedundantManifestMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace HlsSegmentationModeMapper
 AWS_MEDIALIVE_API HlsSegmentationMode GetHlsSegmentationModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsSegmentationMode(HlsSegmentationMode value);
+
+/**
+ * Same as GetNameForHlsSegmentationMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsSegmentationModeCStr(HlsSegmentationMode value);
 } // namespace HlsSegmentationModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace HlsTsFileModeMapper
 AWS_MEDIALIVE_API HlsTsFileMode GetHlsTsFileModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsTsFileMode(HlsTsFileMode value);
+
+/**
+ * Same as GetNameForHlsTsFileMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsTsFileModeCStr(HlsTsFileMode value);
 } // namespace HlsTsFileModeMapper
 } // namespace Model
 } // namespace MediaLive
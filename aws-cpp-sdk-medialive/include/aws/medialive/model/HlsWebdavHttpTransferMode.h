@@ -35,6 +35,11 @@ namespace HlsWebdavHttpTransferModeMapper
 AWS_MEDIALIVE_API HlsWebdavHttpTransferMode GetHlsWebdavHttpTransferModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForHlsWebdavHttpTransferMode(HlsWebdavHttpTransferMode value);
+
+/**
+ * Same as GetNameForHlsWebdavHttpTransferMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForHlsWebdavHttpTransferModeCStr(HlsWebdavHttpTransferMode value);
 } // namespace HlsWebdavHttpTransferModeMapper
 } // namespace Model
 } // namespace MediaLive
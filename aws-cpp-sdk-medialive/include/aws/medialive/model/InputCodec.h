@@ -36,6 +36,11 @@ namespace InputCodecMapper
 AWS_MEDIALIVE_API InputCodec GetInputCodecForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputCodec(InputCodec value);
+
+/**
+ * Same as GetNameForInputCodec(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputCodecCStr(InputCodec value);
 } // namespace InputCodecMapper
 } // namespace Model
 } // namespace MediaLive
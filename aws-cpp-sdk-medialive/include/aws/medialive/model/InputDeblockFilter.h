@@ -35,6 +35,11 @@ namespace InputDeblockFilterMapper
 AWS_MEDIALIVE_API InputDeblockFilter GetInputDeblockFilterForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputDeblockFilter(InputDeblockFilter value);
+
+/**
+ * Same as GetNameForInputDeblockFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputDeblockFilterCStr(InputDeblockFilter value);
 } // namespace InputDeblockFilterMapper
 } // namespace Model
 } // namespace MediaLive
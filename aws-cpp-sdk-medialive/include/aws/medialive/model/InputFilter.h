@@ -36,6 +36,11 @@ namespace InputFilterMapper
 AWS_MEDIALIVE_API InputFilter GetInputFilterForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputFilter(InputFilter value);
+
+/**
+ * Same as GetNameForInputFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputFilterCStr(InputFilter value);
 } // namespace InputFilterMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace InputLossActionForHlsOutMapper
 AWS_MEDIALIVE_API InputLossActionForHlsOut GetInputLossActionForHlsOutForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputLossActionForHlsOut(InputLossActionForHlsOut value);
+
+/**
+ * Same as GetNameForInputLossActionForHlsOut(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputLossActionForHlsOutCStr(InputLossActionForHlsOut value);
 } // namespace InputLossActionForHlsOutMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace InputLossActionForMsSmoothOutMapper
 AWS_MEDIALIVE_API InputLossActionForMsSmoothOut GetInputLossActionForMsSmoothOutForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputLossActionForMsSmoothOut(InputLossActionForMsSmoothOut value);
+
+/**
+ * Same as GetNameForInputLossActionForMsSmoothOut(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputLossActionForMsSmoothOutCStr(InputLossActionForMsSmoothOut value);
 } // namespace InputLossActionForMsSmoothOutMapper
 } // namespace Model
 } // namespace MediaLive
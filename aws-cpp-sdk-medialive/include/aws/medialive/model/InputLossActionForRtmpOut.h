@@ -35,6 +35,11 @@ namespace InputLossActionForRtmpOutMapper
 AWS_MEDIALIVE_API InputLossActionForRtmpOut GetInputLossActionForRtmpOutForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputLossActionForRtmpOut(InputLossActionForRtmpOut value);
+
+/**
+ * Same as GetNameForInputLossActionForRtmpOut(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputLossActionForRtmpOutCStr(InputLossActionForRtmpOut value);
 } // namespace InputLossActionForRtmpOutMapper
 } // namespace Model
 } // namespace MediaLive
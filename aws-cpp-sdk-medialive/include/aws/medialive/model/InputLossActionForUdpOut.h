@@ -36,6 +36,11 @@ namespace InputLossActionForUdpOutMapper
 AWS_MEDIALIVE_API InputLossActionForUdpOut GetInputLossActionForUdpOutForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputLossActionForUdpOut(InputLossActionForUdpOut value);
+
+/**
+ * Same as GetNameForInputLossActionForUdpOut(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputLossActionForUdpOutCStr(InputLossActionForUdpOut value);
 } // namespace InputLossActionForUdpOutMapper
 } // namespace Model
 } // namespace MediaLive
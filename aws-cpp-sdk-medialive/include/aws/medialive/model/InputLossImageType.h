@@ -35,6 +35,11 @@ namespace InputLossImageTypeMapper
 AWS_MEDIALIVE_API InputLossImageType GetInputLossImageTypeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputLossImageType(InputLossImageType value);
+
+/**
+ * Same as GetNameForInputLossImageType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputLossImageTypeCStr(InputLossImageType value);
 } // namespace InputLossImageTypeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace InputMaximumBitrateMapper
 AWS_MEDIALIVE_API InputMaximumBitrate GetInputMaximumBitrateForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputMaximumBitrate(InputMaximumBitrate value);
+
+/**
+ * Same as GetNameForInputMaximumBitrate(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputMaximumBitrateCStr(InputMaximumBitrate value);
 } // namespace InputMaximumBitrateMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace InputResolutionMapper
 AWS_MEDIALIVE_API InputResolution GetInputResolutionForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputResolution(InputResolution value);
+
+/**
+ * Same as GetNameForInputResolution(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputResolutionCStr(InputResolution value);
 } // namespace InputResolutionMapper
 } // namespace Model
 } // namespace MediaLive
@@ -37,6 +37,11 @@ namespace InputSecurityGroupStateMapper
 AWS_MEDIALIVE_API InputSecurityGroupState GetInputSecurityGroupStateForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputSecurityGroupState(InputSecurityGroupState value);
+
+/**
+ * Same as GetNameForInputSecurityGroupState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputSecurityGroupStateCStr(InputSecurityGroupState value);
 } // namespace InputSecurityGroupStateMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace InputSourceEndBehaviorMapper
 AWS_MEDIALIVE_API InputSourceEndBehavior GetInputSourceEndBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputSourceEndBehavior(InputSourceEndBehavior value);
+
+/**
+ * Same as GetNameForInputSourceEndBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputSourceEndBehaviorCStr(InputSourceEndBehavior value);
 } // namespace InputSourceEndBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
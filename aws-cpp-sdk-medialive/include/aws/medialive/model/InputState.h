@@ -38,6 +38,11 @@ namespace InputStateMapper
 AWS_MEDIALIVE_API InputState GetInputStateForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputState(InputState value);
+
+/**
+ * Same as GetNameForInputState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputStateCStr(InputState value);
 } // namespace InputStateMapper
 } // namespace Model
 } // namespace MediaLive
@@ -40,6 +40,11 @@ namespace InputTypeMapper
 AWS_MEDIALIVE_API InputType GetInputTypeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForInputType(InputType value);
+
+/**
+ * Same as GetNameForInputType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForInputTypeCStr(InputType value);
 } // namespace InputTypeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace M2tsAbsentInputAudioBehaviorMapper
 AWS_MEDIALIVE_API M2tsAbsentInputAudioBehavior GetM2tsAbsentInputAudioBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsAbsentInputAudioBehavior(M2tsAbsentInputAudioBehavior value);
+
+/**
+ * Same as GetNameForM2tsAbsentInputAudioBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsAbsentInputAudioBehaviorCStr(M2tsAbsentInputAudioBehavior value);
 } // namespace M2tsAbsentInputAudioBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace M2tsAribMapper
 AWS_MEDIALIVE_API M2tsArib GetM2tsAribForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsArib(M2tsArib value);
+
+/**
+ * Same as GetNameForM2tsArib(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsAribCStr(M2tsArib value);
 } // namespace M2tsAribMapper
 } // namespace Model
 } // namespace MediaLive
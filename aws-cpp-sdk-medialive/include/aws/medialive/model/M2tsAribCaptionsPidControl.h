@@ -35,6 +35,11 @@ namespace M2tsAribCaptionsPidControlMapper
 AWS_MEDIALIVE_API M2tsAribCaptionsPidControl GetM2tsAribCaptionsPidControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsAribCaptionsPidControl(M2tsAribCaptionsPidControl value);
+
+/**
+ * Same as GetNameForM2tsAribCaptionsPidControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsAribCaptionsPidControlCStr(M2tsAribCaptionsPidControl value);
 } // namespace M2tsAribCaptionsPidControlMapper
 } // namespace Model
 } // namespace MediaLive
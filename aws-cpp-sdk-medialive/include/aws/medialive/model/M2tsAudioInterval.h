@@ -35,6 +35,11 @@ namespace M2tsAudioIntervalMapper
 AWS_MEDIALIVE_API M2tsAudioInterval GetM2tsAudioIntervalForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsAudioInterval(M2tsAudioInterval value);
+
+/**
+ * Same as GetNameForM2tsAudioInterval(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsAudioIntervalCStr(M2tsAudioInterval value);
 } // namespace M2tsAudioIntervalMapper
 } // namespace Model
 } // namespace MediaLive
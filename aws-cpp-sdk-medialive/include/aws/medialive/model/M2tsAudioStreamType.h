@@ -35,6 +35,11 @@ namespace M2tsAudioStreamTypeMapper
 AWS_MEDIALIVE_API M2tsAudioStreamType GetM2tsAudioStreamTypeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsAudioStreamType(M2tsAudioStreamType value);
+
+/**
+ * Same as GetNameForM2tsAudioStreamType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsAudioStreamTypeCStr(M2tsAudioStreamType value);
 } // namespace M2tsAudioStreamTypeMapper
 } // namespace Model
 } // namespace MediaLive
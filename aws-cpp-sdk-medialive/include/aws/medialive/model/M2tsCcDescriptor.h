@@ -35,6 +35,11 @@ namespace M2tsCcDescriptorMapper
 AWS_MEDIALIVE_API M2tsCcDescriptor GetM2tsCcDescriptorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsCcDescriptor(M2tsCcDescriptor value);
+
+/**
+ * Same as GetNameForM2tsCcDescriptor(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsCcDescriptorCStr(M2tsCcDescriptor value);
 } // namespace M2tsCcDescriptorMapper
 } // namespace Model
 } // namespace MediaLive
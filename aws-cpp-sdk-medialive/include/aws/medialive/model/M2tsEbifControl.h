@@ -35,6 +35,11 @@ namespace M2tsEbifControlMapper
 AWS_MEDIALIVE_API M2tsEbifControl GetM2tsEbifControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsEbifControl(M2tsEbifControl value);
+
+/**
+ * Same as GetNameForM2tsEbifControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsEbifControlCStr(M2tsEbifControl value);
 } // namespace M2tsEbifControlMapper
 } // namespace Model
 } // namespace MediaLive
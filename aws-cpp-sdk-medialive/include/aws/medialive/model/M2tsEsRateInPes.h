@@ -35,6 +35,11 @@ namespace M2tsEsRateInPesMapper
 AWS_MEDIALIVE_API M2tsEsRateInPes GetM2tsEsRateInPesForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsEsRateInPes(M2tsEsRateInPes value);
+
+/**
+ * Same as GetNameForM2tsEsRateInPes(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsEsRateInPesCStr(M2tsEsRateInPes value);
 } // namespace M2tsEsRateInPesMapper
 } // namespace Model
 } // namespace MediaLive
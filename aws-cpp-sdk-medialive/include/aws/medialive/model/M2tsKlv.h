@@ -35,6 +35,11 @@ namespace M2tsKlvMapper
 AWS_MEDIALIVE_API M2tsKlv GetM2tsKlvForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsKlv(M2tsKlv value);
+
+/**
+ * Same as GetNameForM2tsKlv(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsKlvCStr(M2tsKlv value);
 } // namespace M2tsKlvMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace M2tsRateModeMapper
 AWS_MEDIALIVE_API M2tsRateMode GetM2tsRateModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsRateMode(M2tsRateMode value);
+
+/**
+ * Same as GetNameForM2tsRateMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsRateModeCStr(M2tsRateMode value);
 } // namespace M2tsRateModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace M2tsScte35ControlMapper
 AWS_MEDIALIVE_API M2tsScte35Control GetM2tsScte35ControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsScte35Control(M2tsScte35Control value);
+
+/**
+ * Same as GetNameForM2tsScte35Control(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsScte35ControlCStr(M2tsScte35Control value);
 } // namespace M2tsScte35ControlMapper
 } // namespace Model
 } // namespace MediaLive
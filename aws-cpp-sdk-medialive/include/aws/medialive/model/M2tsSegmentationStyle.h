@@ -35,6 +35,11 @@ namespace M2tsSegmentationStyleMapper
 AWS_MEDIALIVE_API M2tsSegmentationStyle GetM2tsSegmentationStyleForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsSegmentationStyle(M2tsSegmentationStyle value);
+
+/**
+ * Same as GetNameForM2tsSegmentationStyle(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsSegmentationStyleCStr(M2tsSegmentationStyle value);
 } // namespace M2tsSegmentationStyleMapper
 } // namespace Model
 } // namespace MediaLive
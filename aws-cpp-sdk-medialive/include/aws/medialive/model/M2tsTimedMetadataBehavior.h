@@ -35,6 +35,11 @@ namespace M2tsTimedMetadataBehaviorMapper
 AWS_MEDIALIVE_API M2tsTimedMetadataBehavior GetM2tsTimedMetadataBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM2tsTimedMetadataBehavior(M2tsTimedMetadataBehavior value);
+
+/**
+ * Same as GetNameForM2tsTimedMetadataBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM2tsTimedMetadataBehaviorCStr(M2tsTimedMetadataBehavior value);
 } // namespace M2tsTimedMetadataBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
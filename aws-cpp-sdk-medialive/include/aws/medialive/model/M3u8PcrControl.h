@@ -35,6 +35,11 @@ namespace M3u8PcrControlMapper
 AWS_MEDIALIVE_API M3u8PcrControl GetM3u8PcrControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM3u8PcrControl(M3u8PcrControl value);
+
+/**
+ * Same as GetNameForM3u8PcrControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM3u8PcrControlCStr(M3u8PcrControl value);
 } // namespace M3u8PcrControlMapper
 } // namespace Model
 } // namespace MediaLive
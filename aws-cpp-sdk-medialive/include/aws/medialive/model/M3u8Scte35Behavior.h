@@ -35,6 +35,11 @@ namespace M3u8Scte35BehaviorMapper
 AWS_MEDIALIVE_API M3u8Scte35Behavior GetM3u8Scte35BehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM3u8Scte35Behavior(M3u8Scte35Behavior value);
+
+/**
+ * Same as GetNameForM3u8Scte35Behavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM3u8Scte35BehaviorCStr(M3u8Scte35Behavior value);
 } // namespace M3u8Scte35BehaviorMapper
 } // namespace Model
 } // namespace MediaLive
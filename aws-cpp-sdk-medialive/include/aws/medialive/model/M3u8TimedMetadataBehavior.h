@@ -35,6 +35,11 @@ namespace M3u8TimedMetadataBehaviorMapper
 AWS_MEDIALIVE_API M3u8TimedMetadataBehavior GetM3u8TimedMetadataBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForM3u8TimedMetadataBehavior(M3u8TimedMetadataBehavior value);
+
+/**
+ * Same as GetNameForM3u8TimedMetadataBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForM3u8TimedMetadataBehaviorCStr(M3u8TimedMetadataBehavior value);
 } // namespace M3u8TimedMetadataBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace Mp2CodingModeMapper
 AWS_MEDIALIVE_API Mp2CodingMode GetMp2CodingModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForMp2CodingMode(Mp2CodingMode value);
+
+/**
+ * Same as GetNameForMp2CodingMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForMp2CodingModeCStr(Mp2CodingMode value);
 } // namespace Mp2CodingModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace NetworkInputServerValidationMapper
 AWS_MEDIALIVE_API NetworkInputServerValidation GetNetworkInputServerValidationForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForNetworkInputServerValidation(NetworkInputServerValidation value);
+
+/**
+ * Same as GetNameForNetworkInputServerValidation(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForNetworkInputServerValidationCStr(NetworkInputServerValidation value);
 } // namespace NetworkInputServerValidationMapper
 } // namespace Model
 } // namespace MediaLive
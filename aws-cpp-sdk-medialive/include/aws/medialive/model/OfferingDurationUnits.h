@@ -34,6 +34,11 @@ namespace OfferingDurationUnitsMapper
 AWS_MEDIALIVE_API OfferingDurationUnits GetOfferingDurationUnitsForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForOfferingDurationUnits(OfferingDurationUnits value);
+
+/**
+ * Same as GetNameForOfferingDurationUnits(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForOfferingDurationUnitsCStr(OfferingDurationUnits value);
 } // namespace OfferingDurationUnitsMapper
 } // namespace Model
 } // namespace MediaLive
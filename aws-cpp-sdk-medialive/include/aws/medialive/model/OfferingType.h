@@ -34,6 +34,11 @@ namespace OfferingTypeMapper
 AWS_MEDIALIVE_API OfferingType GetOfferingTypeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForOfferingType(OfferingType value);
+
+/**
+ * Same as GetNameForOfferingType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForOfferingTypeCStr(OfferingType value);
 } // namespace OfferingTypeMapper
 } // namespace Model
 } // namespace MediaLive
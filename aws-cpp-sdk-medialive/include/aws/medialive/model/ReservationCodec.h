@@ -37,6 +37,11 @@ namespace ReservationCodecMapper
 AWS_MEDIALIVE_API ReservationCodec GetReservationCodecForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForReservationCodec(ReservationCodec value);
+
+/**
+ * Same as GetNameForReservationCodec(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForReservationCodecCStr(ReservationCodec value);
 } // namespace ReservationCodecMapper
 } // namespace Model
 } // namespace MediaLive
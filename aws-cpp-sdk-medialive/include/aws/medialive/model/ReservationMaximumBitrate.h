@@ -36,6 +36,11 @@ namespace ReservationMaximumBitrateMapper
 AWS_MEDIALIVE_API ReservationMaximumBitrate GetReservationMaximumBitrateForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForReservationMaximumBitrate(ReservationMaximumBitrate value);
+
+/**
+ * Same as GetNameForReservationMaximumBitrate(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForReservationMaximumBitrateCStr(ReservationMaximumBitrate value);
 } // namespace ReservationMaximumBitrateMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace ReservationMaximumFramerateMapper
 AWS_MEDIALIVE_API ReservationMaximumFramerate GetReservationMaximumFramerateForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForReservationMaximumFramerate(ReservationMaximumFramerate value);
+
+/**
+ * Same as GetNameForReservationMaximumFramerate(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForReservationMaximumFramerateCStr(ReservationMaximumFramerate value);
 } // namespace ReservationMaximumFramerateMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace ReservationResolutionMapper
 AWS_MEDIALIVE_API ReservationResolution GetReservationResolutionForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForReservationResolution(ReservationResolution value);
+
+/**
+ * Same as GetNameForReservationResolution(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForReservationResolutionCStr(ReservationResolution value);
 } // namespace ReservationResolutionMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace ReservationResourceTypeMapper
 AWS_MEDIALIVE_API ReservationResourceType GetReservationResourceTypeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForReservationResourceType(ReservationResourceType value);
+
+/**
+ * Same as GetNameForReservationResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForReservationResourceTypeCStr(ReservationResourceType value);
 } // namespace ReservationResourceTypeMapper
 } // namespace Model
 } // namespace MediaLive
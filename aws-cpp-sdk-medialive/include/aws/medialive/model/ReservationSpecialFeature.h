@@ -35,6 +35,11 @@ namespace ReservationSpecialFeatureMapper
 AWS_MEDIALIVE_API ReservationSpecialFeature GetReservationSpecialFeatureForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForReservationSpecialFeature(ReservationSpecialFeature value);
+
+/**
+ * Same as GetNameForReservationSpecialFeature(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForReservationSpecialFeatureCStr(ReservationSpecialFeature value);
 } // namespace ReservationSpecialFeatureMapper
 } // namespace Model
 } // namespace MediaLive
@@ -37,6 +37,11 @@ namespace ReservationStateMapper
 AWS_MEDIALIVE_API ReservationState GetReservationStateForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForReservationState(ReservationState value);
+
+/**
+ * Same as GetNameForReservationState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForReservationStateCStr(ReservationState value);
 } // namespace ReservationStateMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace ReservationVideoQualityMapper
 AWS_MEDIALIVE_API ReservationVideoQuality GetReservationVideoQualityForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForReservationVideoQuality(ReservationVideoQuality value);
+
+/**
+ * Same as GetNameForReservationVideoQuality(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForReservationVideoQualityCStr(ReservationVideoQuality value);
 } // namespace ReservationVideoQualityMapper
 } // namespace Model
 } // namespace MediaLive
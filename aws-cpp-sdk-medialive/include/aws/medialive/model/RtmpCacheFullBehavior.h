@@ -35,6 +35,11 @@ namespace RtmpCacheFullBehaviorMapper
 AWS_MEDIALIVE_API RtmpCacheFullBehavior GetRtmpCacheFullBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForRtmpCacheFullBehavior(RtmpCacheFullBehavior value);
+
+/**
+ * Same as GetNameForRtmpCacheFullBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForRtmpCacheFullBehaviorCStr(RtmpCacheFullBehavior value);
 } // namespace RtmpCacheFullBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace RtmpCaptionDataMapper
 AWS_MEDIALIVE_API RtmpCaptionData GetRtmpCaptionDataForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForRtmpCaptionData(RtmpCaptionData value);
+
+/**
+ * Same as GetNameForRtmpCaptionData(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForRtmpCaptionDataCStr(RtmpCaptionData value);
 } // namespace RtmpCaptionDataMapper
 } // namespace Model
 } // namespace MediaLive
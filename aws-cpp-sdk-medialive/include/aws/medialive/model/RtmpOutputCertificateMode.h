@@ -35,6 +35,11 @@ namespace RtmpOutputCertificateModeMapper
 AWS_MEDIALIVE_API RtmpOutputCertificateMode GetRtmpOutputCertificateModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForRtmpOutputCertificateMode(RtmpOutputCertificateMode value);
+
+/**
+ * Same as GetNameForRtmpOutputCertificateMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForRtmpOutputCertificateModeCStr(RtmpOutputCertificateMode value);
 } // namespace RtmpOutputCertificateModeMapper
 } // namespace Model
 } // namespace MediaLive
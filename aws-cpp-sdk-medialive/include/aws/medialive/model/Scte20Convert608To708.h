@@ -35,6 +35,11 @@ namespace Scte20Convert608To708Mapper
 AWS_MEDIALIVE_API Scte20Convert608To708 GetScte20Convert608To708ForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForScte20Convert608To708(Scte20Convert608To708 value);
+
+/**
+ * Same as GetNameForScte20Convert608To708(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForScte20Convert608To708CStr(Scte20Convert608To708 value);
 } // namespace Scte20Convert608To708Mapper
 } // namespace Model
 } // namespace MediaLive
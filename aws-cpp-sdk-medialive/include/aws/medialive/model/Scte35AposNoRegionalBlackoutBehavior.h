@@ -35,6 +35,11 @@ namespace Scte35AposNoRegionalBlackoutBehaviorMapper
 AWS_MEDIALIVE_API Scte35AposNoRegionalBlackoutBehavior GetScte35AposNoRegionalBlackoutBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForScte35AposNoRegionalBlackoutBehavior(Scte35AposNoRegionalBlackoutBehavior value);
+
+/**
+ * Same as GetNameForScte35AposNoRegionalBlackoutBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForScte35AposNoRegionalBlackoutBehaviorCStr(Scte35AposNoRegionalBlackoutBehavior value);
 } // namespace Scte35AposNoRegionalBlackoutBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace Scte35AposWebDeliveryAllowedBehaviorMapper
 AWS_MEDIALIVE_API Scte35AposWebDeliveryAllowedBehavior GetScte35AposWebDeliveryAllowedBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForScte35AposWebDeliveryAllowedBehavior(Scte35AposWebDeliveryAllowedBehavior value);
+
+/**
+ * Same as GetNameForScte35AposWebDeliveryAllowedBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForScte35AposWebDeliveryAllowedBehaviorCStr(Scte35AposWebDeliveryAllowedBehavior value);
 } // namespace Scte35AposWebDeliveryAllowedBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace Scte35ArchiveAllowedFlagMapper
 AWS_MEDIALIVE_API Scte35ArchiveAllowedFlag GetScte35ArchiveAllowedFlagForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForScte35ArchiveAllowedFlag(Scte35ArchiveAllowedFlag value);
+
+/**
+ * Same as GetNameForScte35ArchiveAllowedFlag(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForScte35ArchiveAllowedFlagCStr(Scte35ArchiveAllowedFlag value);
 } // namespace Scte35ArchiveAllowedFlagMapper
 } // namespace Model
 } // namespace MediaLive
@@ -37,6 +37,11 @@ namespace Scte35DeviceRestrictionsMapper
 AWS_MEDIALIVE_API Scte35DeviceRestrictions GetScte35DeviceRestrictionsForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForScte35DeviceRestrictions(Scte35DeviceRestrictions value);
+
+/**
+ * Same as GetNameForScte35DeviceRestrictions(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForScte35DeviceRestrictionsCStr(Scte35DeviceRestrictions value);
 } // namespace Scte35DeviceRestrictionsMapper
 } // namespace Model
 } // namespace MediaLive
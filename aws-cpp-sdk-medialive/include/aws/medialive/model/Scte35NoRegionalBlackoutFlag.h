@@ -35,6 +35,11 @@ namespace Scte35NoRegionalBlackoutFlagMapper
 AWS_MEDIALIVE_API Scte35NoRegionalBlackoutFlag GetScte35NoRegionalBlackoutFlagForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForScte35NoRegionalBlackoutFlag(Scte35NoRegionalBlackoutFlag value);
+
+/**
+ * Same as GetNameForScte35NoRegionalBlackoutFlag(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForScte35NoRegionalBlackoutFlagCStr(Scte35NoRegionalBlackoutFlag value);
 } // namespace Scte35NoRegionalBlackoutFlagMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace Scte35SegmentationCancelIndicatorMapper
 AWS_MEDIALIVE_API Scte35SegmentationCancelIndicator GetScte35SegmentationCancelIndicatorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForScte35SegmentationCancelIndicator(Scte35SegmentationCancelIndicator value);
+
+/**
+ * Same as GetNameForScte35SegmentationCancelIndicator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForScte35SegmentationCancelIndicatorCStr(Scte35SegmentationCancelIndicator value);
 } // namespace Scte35SegmentationCancelIndicatorMapper
 } // namespace Model
 } // namespace MediaLive
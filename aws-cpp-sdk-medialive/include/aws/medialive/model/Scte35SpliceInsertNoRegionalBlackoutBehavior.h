@@ -35,6 +35,11 @@ namespace Scte35SpliceInsertNoRegionalBlackoutBehaviorMapper
 AWS_MEDIALIVE_API Scte35SpliceInsertNoRegionalBlackoutBehavior GetScte35SpliceInsertNoRegionalBlackoutBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForScte35SpliceInsertNoRegionalBlackoutBehavior(Scte35SpliceInsertNoRegionalBlackoutBehavior value);
+
+/**
+ * Same as GetNameForScte35SpliceInsertNoRegionalBlackoutBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForScte35SpliceInsertNoRegionalBlackoutBehaviorCStr(Scte35SpliceInsertNoRegionalBlackoutBehavior value);
 } // namespace Scte35SpliceInsertNoRegionalBlackoutBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace Scte35SpliceInsertWebDeliveryAllowedBehaviorMapper
 AWS_MEDIALIVE_API Scte35SpliceInsertWebDeliveryAllowedBehavior GetScte35SpliceInsertWebDeliveryAllowedBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForScte35SpliceInsertWebDeliveryAllowedBehavior(Scte35SpliceInsertWebDeliveryAllowedBehavior value);
+
+/**
+ * Same as GetNameForScte35SpliceInsertWebDeliveryAllowedBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForScte35SpliceInsertWebDeliveryAllowedBehaviorCStr(Scte35SpliceInsertWebDeliveryAllowedBehavior value);
 } // namespace Scte35SpliceInsertWebDeliveryAllowedBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
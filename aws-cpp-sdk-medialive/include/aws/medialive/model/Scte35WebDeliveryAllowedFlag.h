@@ -35,6 +35,11 @@ namespace Scte35WebDeliveryAllowedFlagMapper
 AWS_MEDIALIVE_API Scte35WebDeliveryAllowedFlag GetScte35WebDeliveryAllowedFlagForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForScte35WebDeliveryAllowedFlag(Scte35WebDeliveryAllowedFlag value);
+
+/**
+ * Same as GetNameForScte35WebDeliveryAllowedFlag(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForScte35WebDeliveryAllowedFlagCStr(Scte35WebDeliveryAllowedFlag value);
 } // namespace Scte35WebDeliveryAllowedFlagMapper
 } // namespace Model
 } // namespace MediaLive
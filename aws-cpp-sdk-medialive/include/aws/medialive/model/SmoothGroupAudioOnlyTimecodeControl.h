@@ -35,6 +35,11 @@ namespace SmoothGroupAudioOnlyTimecodeControlMapper
 AWS_MEDIALIVE_API SmoothGroupAudioOnlyTimecodeControl GetSmoothGroupAudioOnlyTimecodeControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupAudioOnlyTimecodeControl(SmoothGroupAudioOnlyTimecodeControl value);
+
+/**
+ * Same as GetNameForSmoothGroupAudioOnlyTimecodeControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupAudioOnlyTimecodeControlCStr(SmoothGroupAudioOnlyTimecodeControl value);
 } // namespace SmoothGroupAudioOnlyTimecodeControlMapper
 } // namespace Model
 } // namespace MediaLive
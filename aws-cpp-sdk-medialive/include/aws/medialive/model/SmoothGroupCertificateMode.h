@@ -35,6 +35,11 @@ namespace SmoothGroupCertificateModeMapper
 AWS_MEDIALIVE_API SmoothGroupCertificateMode GetSmoothGroupCertificateModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupCertificateMode(SmoothGroupCertificateMode value);
+
+/**
+ * Same as GetNameForSmoothGroupCertificateMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupCertificateModeCStr(SmoothGroupCertificateMode value);
 } // namespace SmoothGroupCertificateModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace SmoothGroupEventIdModeMapper
 AWS_MEDIALIVE_API SmoothGroupEventIdMode GetSmoothGroupEventIdModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupEventIdMode(SmoothGroupEventIdMode value);
+
+/**
+ * Same as GetNameForSmoothGroupEventIdMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupEventIdModeCStr(SmoothGroupEventIdMode value);
 } // namespace SmoothGroupEventIdModeMapper
 } // namespace Model
 } // namespace MediaLive
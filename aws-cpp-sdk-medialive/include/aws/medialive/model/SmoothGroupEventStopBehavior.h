@@ -35,6 +35,11 @@ namespace SmoothGroupEventStopBehaviorMapper
 AWS_MEDIALIVE_API SmoothGroupEventStopBehavior GetSmoothGroupEventStopBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupEventStopBehavior(SmoothGroupEventStopBehavior value);
+
+/**
+ * Same as GetNameForSmoothGroupEventStopBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupEventStopBehaviorCStr(SmoothGroupEventStopBehavior value);
 } // namespace SmoothGroupEventStopBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace SmoothGroupSegmentationModeMapper
 AWS_MEDIALIVE_API SmoothGroupSegmentationMode GetSmoothGroupSegmentationModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupSegmentationMode(SmoothGroupSegmentationMode value);
+
+/**
+ * Same as GetNameForSmoothGroupSegmentationMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupSegmentationModeCStr(SmoothGroupSegmentationMode value);
 } // namespace SmoothGroupSegmentationModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace SmoothGroupSparseTrackTypeMapper
 AWS_MEDIALIVE_API SmoothGroupSparseTrackType GetSmoothGroupSparseTrackTypeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupSparseTrackType(SmoothGroupSparseTrackType value);
+
+/**
+ * Same as GetNameForSmoothGroupSparseTrackType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupSparseTrackTypeCStr(SmoothGroupSparseTrackType value);
 } // namespace SmoothGroupSparseTrackTypeMapper
 } // namespace Model
 } // namespace MediaLive
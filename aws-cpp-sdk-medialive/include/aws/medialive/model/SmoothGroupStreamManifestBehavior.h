@@ -35,6 +35,11 @@ namespace SmoothGroupStreamManifestBehaviorMapper
 AWS_MEDIALIVE_API SmoothGroupStreamManifestBehavior GetSmoothGroupStreamManifestBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupStreamManifestBehavior(SmoothGroupStreamManifestBehavior value);
+
+/**
+ * Same as GetNameForSmoothGroupStreamManifestBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupStreamManifestBehaviorCStr(SmoothGroupStreamManifestBehavior value);
 } // namespace SmoothGroupStreamManifestBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace SmoothGroupTimestampOffsetModeMapper
 AWS_MEDIALIVE_API SmoothGroupTimestampOffsetMode GetSmoothGroupTimestampOffsetModeForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupTimestampOffsetMode(SmoothGroupTimestampOffsetMode value);
+
+/**
+ * Same as GetNameForSmoothGroupTimestampOffsetMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupTimestampOffsetModeCStr(SmoothGroupTimestampOffsetMode value);
 } // namespace SmoothGroupTimestampOffsetModeMapper
 } // namespace Model
 } // namespace MediaLive
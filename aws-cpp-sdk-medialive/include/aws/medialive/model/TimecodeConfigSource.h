@@ -36,6 +36,11 @@ namespace TimecodeConfigSourceMapper
 AWS_MEDIALIVE_API TimecodeConfigSource GetTimecodeConfigSourceForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForTimecodeConfigSource(TimecodeConfigSource value);
+
+/**
+ * Same as GetNameForTimecodeConfigSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForTimecodeConfigSourceCStr(TimecodeConfigSource value);
 } // namespace TimecodeConfigSourceMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,6 +35,11 @@ namespace TtmlDestinationStyleControlMapper
 AWS_MEDIALIVE_API TtmlDestinationStyleControl GetTtmlDestinationStyleControlForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForTtmlDestinationStyleControl(TtmlDestinationStyleControl value);
+
+/**
+ * Same as GetNameForTtmlDestinationStyleControl(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForTtmlDestinationStyleControlCStr(TtmlDestinationStyleControl value);
 } // namespace TtmlDestinationStyleControlMapper
 } // namespace Model
 } // namespace MediaLive
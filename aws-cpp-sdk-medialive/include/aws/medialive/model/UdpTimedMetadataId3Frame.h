@@ -36,6 +36,11 @@ namespace UdpTimedMetadataId3FrameMapper
 AWS_MEDIALIVE_API UdpTimedMetadataId3Frame GetUdpTimedMetadataId3FrameForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForUdpTimedMetadataId3Frame(UdpTimedMetadataId3Frame value);
+
+/**
+ * Same as GetNameForUdpTimedMetadataId3Frame(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForUdpTimedMetadataId3FrameCStr(UdpTimedMetadataId3Frame value);
 } // namespace UdpTimedMetadataId3FrameMapper
 } // namespace Model
 } // namespace MediaLive
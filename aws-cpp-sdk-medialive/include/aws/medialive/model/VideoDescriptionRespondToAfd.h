@@ -36,6 +36,11 @@ namespace VideoDescriptionRespondToAfdMapper
 AWS_MEDIALIVE_API VideoDescriptionRespondToAfd GetVideoDescriptionRespondToAfdForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForVideoDescriptionRespondToAfd(VideoDescriptionRespondToAfd value);
+
+/**
+ * Same as GetNameForVideoDescriptionRespondToAfd(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForVideoDescriptionRespondToAfdCStr(VideoDescriptionRespondToAfd value);
 } // namespace VideoDescriptionRespondToAfdMapper
 } // namespace Model
 } // namespace MediaLive
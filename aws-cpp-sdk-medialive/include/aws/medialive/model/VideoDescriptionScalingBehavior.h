@@ -35,6 +35,11 @@ namespace VideoDescriptionScalingBehaviorMapper
 AWS_MEDIALIVE_API VideoDescriptionScalingBehavior GetVideoDescriptionScalingBehaviorForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForVideoDescriptionScalingBehavior(VideoDescriptionScalingBehavior value);
+
+/**
+ * Same as GetNameForVideoDescriptionScalingBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForVideoDescriptionScalingBehaviorCStr(VideoDescriptionScalingBehavior value);
 } // namespace VideoDescriptionScalingBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,6 +36,11 @@ namespace VideoSelectorColorSpaceMapper
 AWS_MEDIALIVE_API VideoSelectorColorSpace GetVideoSelectorColorSpaceForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForVideoSelectorColorSpace(VideoSelectorColorSpace value);
+
+/**
+ * Same as GetNameForVideoSelectorColorSpace(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForVideoSelectorColorSpaceCStr(VideoSelectorColorSpace value);
 } // namespace VideoSelectorColorSpaceMapper
 } // namespace Model
 } // namespace MediaLive
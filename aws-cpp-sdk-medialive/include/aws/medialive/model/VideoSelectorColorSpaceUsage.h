@@ -35,6 +35,11 @@ namespace VideoSelectorColorSpaceUsageMapper
 AWS_MEDIALIVE_API VideoSelectorColorSpaceUsage GetVideoSelectorColorSpaceUsageForName(const Aws::String& name);
 
 AWS_MEDIALIVE_API Aws::String GetNameForVideoSelectorColorSpaceUsage(VideoSelectorColorSpaceUsage value);
+
+/**
+ * Same as GetNameForVideoSelectorColorSpaceUsage(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIALIVE_API const char* GetNameForVideoSelectorColorSpaceUsageCStr(VideoSelectorColorSpaceUsage value);
 } // namespace VideoSelectorColorSpaceUsageMapper
 } // namespace Model
 } // namespace MediaLive
@@ -30,35 +30,58 @@ namespace Aws
       namespace AacCodingModeMapper
       {
 
-        static const int AD_RECEIVER_MIX_HASH = HashingUtils::HashString("AD_RECEIVER_MIX");
-        static const int CODING_MODE_1_0_HASH = HashingUtils::HashString("CODING_MODE_1_0");
-        static const int CODING_MODE_1_1_HASH = HashingUtils::HashString("CODING_MODE_1_1");
-        static const int CODING_MODE_2_0_HASH = HashingUtils::HashString("CODING_MODE_2_0");
-        static const int CODING_MODE_5_1_HASH = HashingUtils::HashString("CODING_MODE_5_1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AD_RECEIVER_MIX",
+          "CODING_MODE_1_0",
+          "CODING_MODE_1_1",
+          "CODING_MODE_2_0",
+          "CODING_MODE_5_1",
+        };
 
         AacCodingMode GetAacCodingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AD_RECEIVER_MIX_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AacCodingMode::AD_RECEIVER_MIX;
-          }
-          else if (hashCode == CODING_MODE_1_0_HASH)
-          {
-            return AacCodingMode::CODING_MODE_1_0;
-          }
-          else if (hashCode == CODING_MODE_1_1_HASH)
-          {
-            return AacCodingMode::CODING_MODE_1_1;
-          }
-          else if (hashCode == CODING_MODE_2_0_HASH)
-          {
-            return AacCodingMode::CODING_MODE_2_0;
-          }
-          else if (hashCode == CODING_MODE_5_1_HASH)
-          {
-            return AacCodingMode::CODING_MODE_5_1;
+          case -1351575928:
+            if (name == "AD_RECEIVER_MIX")
+            {
+              return AacCodingMode::AD_RECEIVER_MIX;
+            }
+            break;
+          case -242316229:
+            if (name == "CODING_MODE_1_0")
+            {
+              return AacCodingMode::CODING_MODE_1_0;
+            }
+            break;
+          case -242316228:
+            if (name == "CODING_MODE_1_1")
+            {
+              return AacCodingMode::CODING_MODE_1_1;
+            }
+            break;
+          case -242315268:
+            if (name == "CODING_MODE_2_0")
+            {
+              return AacCodingMode::CODING_MODE_2_0;
+            }
+            break;
+          case -242312384:
+            if (name == "CODING_MODE_5_1")
+            {
+              return AacCodingMode::CODING_MODE_5_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return AacCodingMode::NOT_SET;
         }
 
-        Aws::String GetNameForAacCodingMode(AacCodingMode enumValue)
+        const char* GetNameForAacCodingModeCStr(AacCodingMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AacCodingMode::AD_RECEIVER_MIX:
-            return "AD_RECEIVER_MIX";
-          case AacCodingMode::CODING_MODE_1_0:
-            return "CODING_MODE_1_0";
-          case AacCodingMode::CODING_MODE_1_1:
-            return "CODING_MODE_1_1";
-          case AacCodingMode::CODING_MODE_2_0:
-            return "CODING_MODE_2_0";
-          case AacCodingMode::CODING_MODE_5_1:
-            return "CODING_MODE_5_1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAacCodingMode(AacCodingMode enumValue)
+        {
+          return GetNameForAacCodingModeCStr(enumValue);
         }
 
       } // namespace AacCodingModeMapper
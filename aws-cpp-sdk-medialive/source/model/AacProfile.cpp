@@ -30,25 +30,44 @@ namespace Aws
       namespace AacProfileMapper
       {
 
-        static const int HEV1_HASH = HashingUtils::HashString("HEV1");
-        static const int HEV2_HASH = HashingUtils::HashString("HEV2");
-        static const int LC_HASH = HashingUtils::HashString("LC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HEV1",
+          "HEV2",
+          "LC",
+        };
 
         AacProfile GetAacProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HEV1_HASH)
-          {
-            return AacProfile::HEV1;
-          }
-          else if (hashCode == HEV2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AacProfile::HEV2;
-          }
-          else if (hashCode == LC_HASH)
-          {
-            return AacProfile::LC;
+          case 2213976:
+            if (name == "HEV1")
+            {
+              return AacProfile::HEV1;
+            }
+            break;
+          case 2213977:
+            if (name == "HEV2")
+            {
+              return AacProfile::HEV2;
+            }
+            break;
+          case 2423:
+            if (name == "LC")
+            {
+              return AacProfile::LC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AacProfile::NOT_SET;
         }
 
-        Aws::String GetNameForAacProfile(AacProfile enumValue)
+        const char* GetNameForAacProfileCStr(AacProfile enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AacProfile::HEV1:
-            return "HEV1";
-          case AacProfile::HEV2:
-            return "HEV2";
-          case AacProfile::LC:
-            return "LC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAacProfile(AacProfile enumValue)
+        {
+          return GetNameForAacProfileCStr(enumValue);
         }
 
       } // namespace AacProfileMapper
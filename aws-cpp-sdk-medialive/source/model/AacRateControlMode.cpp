@@ -30,20 +30,37 @@ namespace Aws
       namespace AacRateControlModeMapper
       {
 
-        static const int CBR_HASH = HashingUtils::HashString("CBR");
-        static const int VBR_HASH = HashingUtils::HashString("VBR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CBR",
+          "VBR",
+        };
 
         AacRateControlMode GetAacRateControlModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CBR_HASH)
-          {
-            return AacRateControlMode::CBR;
-          }
-          else if (hashCode == VBR_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AacRateControlMode::VBR;
+          case 66515:
+            if (name == "CBR")
+            {
+              return AacRateControlMode::CBR;
+            }
+            break;
+          case 84774:
+            if (name == "VBR")
+            {
+              return AacRateControlMode::VBR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AacRateControlMode::NOT_SET;
         }
 
-        Aws::String GetNameForAacRateControlMode(AacRateControlMode enumValue)
+        const char* GetNameForAacRateControlModeCStr(AacRateControlMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AacRateControlMode::CBR:
-            return "CBR";
-          case AacRateControlMode::VBR:
-            return "VBR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAacRateControlMode(AacRateControlMode enumValue)
+        {
+          return GetNameForAacRateControlModeCStr(enumValue);
         }
 
       } // namespace AacRateControlModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace AacRawFormatMapper
       {
 
-        static const int LATM_LOAS_HASH = HashingUtils::HashString("LATM_LOAS");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LATM_LOAS",
+          "NONE",
+        };
 
         AacRawFormat GetAacRawFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LATM_LOAS_HASH)
-          {
-            return AacRawFormat::LATM_LOAS;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AacRawFormat::NONE;
+          case 1221355494:
+            if (name == "LATM_LOAS")
+            {
+              return AacRawFormat::LATM_LOAS;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return AacRawFormat::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AacRawFormat::NOT_SET;
         }
 
-        Aws::String GetNameForAacRawFormat(AacRawFormat enumValue)
+        const char* GetNameForAacRawFormatCStr(AacRawFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AacRawFormat::LATM_LOAS:
-            return "LATM_LOAS";
-          case AacRawFormat::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAacRawFormat(AacRawFormat enumValue)
+        {
+          return GetNameForAacRawFormatCStr(enumValue);
         }
 
       } // namespace AacRawFormatMapper
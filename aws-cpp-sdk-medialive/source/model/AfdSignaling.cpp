@@ -30,25 +30,44 @@ namespace Aws
       namespace AfdSignalingMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int FIXED_HASH = HashingUtils::HashString("FIXED");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTO",
+          "FIXED",
+          "NONE",
+        };
 
         AfdSignaling GetAfdSignalingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
-          {
-            return AfdSignaling::AUTO;
-          }
-          else if (hashCode == FIXED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AfdSignaling::FIXED;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return AfdSignaling::NONE;
+          case 2020783:
+            if (name == "AUTO")
+            {
+              return AfdSignaling::AUTO;
+            }
+            break;
+          case 66907988:
+            if (name == "FIXED")
+            {
+              return AfdSignaling::FIXED;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return AfdSignaling::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AfdSignaling::NOT_SET;
         }
 
-        Aws::String GetNameForAfdSignaling(AfdSignaling enumValue)
+        const char* GetNameForAfdSignalingCStr(AfdSignaling enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AfdSignaling::AUTO:
-            return "AUTO";
-          case AfdSignaling::FIXED:
-            return "FIXED";
-          case AfdSignaling::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAfdSignaling(AfdSignaling enumValue)
+        {
+          return GetNameForAfdSignalingCStr(enumValue);
         }
 
       } // namespace AfdSignalingMapper
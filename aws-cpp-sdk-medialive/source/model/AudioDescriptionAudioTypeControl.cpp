@@ -30,20 +30,37 @@ namespace Aws
       namespace AudioDescriptionAudioTypeControlMapper
       {
 
-        static const int FOLLOW_INPUT_HASH = HashingUtils::HashString("FOLLOW_INPUT");
-        static const int USE_CONFIGURED_HASH = HashingUtils::HashString("USE_CONFIGURED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FOLLOW_INPUT",
+          "USE_CONFIGURED",
+        };
 
         AudioDescriptionAudioTypeControl GetAudioDescriptionAudioTypeControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_INPUT_HASH)
-          {
-            return AudioDescriptionAudioTypeControl::FOLLOW_INPUT;
-          }
-          else if (hashCode == USE_CONFIGURED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AudioDescriptionAudioTypeControl::USE_CONFIGURED;
+          case 1178970524:
+            if (name == "FOLLOW_INPUT")
+            {
+              return AudioDescriptionAudioTypeControl::FOLLOW_INPUT;
+            }
+            break;
+          case -177742826:
+            if (name == "USE_CONFIGURED")
+            {
+              return AudioDescriptionAudioTypeControl::USE_CONFIGURED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AudioDescriptionAudioTypeControl::NOT_SET;
         }
 
-        Aws::String GetNameForAudioDescriptionAudioTypeControl(AudioDescriptionAudioTypeControl enumValue)
+        const char* GetNameForAudioDescriptionAudioTypeControlCStr(AudioDescriptionAudioTypeControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AudioDescriptionAudioTypeControl::FOLLOW_INPUT:
-            return "FOLLOW_INPUT";
-          case AudioDescriptionAudioTypeControl::USE_CONFIGURED:
-            return "USE_CONFIGURED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAudioDescriptionAudioTypeControl(AudioDescriptionAudioTypeControl enumValue)
+        {
+          return GetNameForAudioDescriptionAudioTypeControlCStr(enumValue);
         }
 
       } // namespace AudioDescriptionAudioTypeControlMapper
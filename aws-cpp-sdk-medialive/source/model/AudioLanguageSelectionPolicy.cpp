@@ -30,20 +30,37 @@ namespace Aws
       namespace AudioLanguageSelectionPolicyMapper
       {
 
-        static const int LOOSE_HASH = HashingUtils::HashString("LOOSE");
-        static const int STRICT_HASH = HashingUtils::HashString("STRICT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LOOSE",
+          "STRICT",
+        };
 
         AudioLanguageSelectionPolicy GetAudioLanguageSelectionPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LOOSE_HASH)
-          {
-            return AudioLanguageSelectionPolicy::LOOSE;
-          }
-          else if (hashCode == STRICT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AudioLanguageSelectionPolicy::STRICT;
+          case 72619646:
+            if (name == "LOOSE")
+            {
+              return AudioLanguageSelectionPolicy::LOOSE;
+            }
+            break;
+          case -1838656823:
+            if (name == "STRICT")
+            {
+              return AudioLanguageSelectionPolicy::STRICT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AudioLanguageSelectionPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForAudioLanguageSelectionPolicy(AudioLanguageSelectionPolicy enumValue)
+        const char* GetNameForAudioLanguageSelectionPolicyCStr(AudioLanguageSelectionPolicy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AudioLanguageSelectionPolicy::LOOSE:
-            return "LOOSE";
-          case AudioLanguageSelectionPolicy::STRICT:
-            return "STRICT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAudioLanguageSelectionPolicy(AudioLanguageSelectionPolicy enumValue)
+        {
+          return GetNameForAudioLanguageSelectionPolicyCStr(enumValue);
         }
 
       } // namespace AudioLanguageSelectionPolicyMapper
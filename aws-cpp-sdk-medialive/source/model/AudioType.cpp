@@ -30,30 +30,51 @@ namespace Aws
       namespace AudioTypeMapper
       {
 
-        static const int CLEAN_EFFECTS_HASH = HashingUtils::HashString("CLEAN_EFFECTS");
-        static const int HEARING_IMPAIRED_HASH = HashingUtils::HashString("HEARING_IMPAIRED");
-        static const int UNDEFINED_HASH = HashingUtils::HashString("UNDEFINED");
-        static const int VISUAL_IMPAIRED_COMMENTARY_HASH = HashingUtils::HashString("VISUAL_IMPAIRED_COMMENTARY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CLEAN_EFFECTS",
+          "HEARING_IMPAIRED",
+          "UNDEFINED",
+          "VISUAL_IMPAIRED_COMMENTARY",
+        };
 
         AudioType GetAudioTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLEAN_EFFECTS_HASH)
-          {
-            return AudioType::CLEAN_EFFECTS;
-          }
-          else if (hashCode == HEARING_IMPAIRED_HASH)
-          {
-            return AudioType::HEARING_IMPAIRED;
-          }
-          else if (hashCode == UNDEFINED_HASH)
-          {
-            return AudioType::UNDEFINED;
-          }
-          else if (hashCode == VISUAL_IMPAIRED_COMMENTARY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AudioType::VISUAL_IMPAIRED_COMMENTARY;
+          case 1412903116:
+            if (name == "CLEAN_EFFECTS")
+            {
+              return AudioType::CLEAN_EFFECTS;
+            }
+            break;
+          case -767806488:
+            if (name == "HEARING_IMPAIRED")
+            {
+              return AudioType::HEARING_IMPAIRED;
+            }
+            break;
+          case 1748463920:
+            if (name == "UNDEFINED")
+            {
+              return AudioType::UNDEFINED;
+            }
+            break;
+          case -1556132212:
+            if (name == "VISUAL_IMPAIRED_COMMENTARY")
+            {
+              return AudioType::VISUAL_IMPAIRED_COMMENTARY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AudioType::NOT_SET;
         }
 
-        Aws::String GetNameForAudioType(AudioType enumValue)
+        const char* GetNameForAudioTypeCStr(AudioType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AudioType::CLEAN_EFFECTS:
-            return "CLEAN_EFFECTS";
-          case AudioType::HEARING_IMPAIRED:
-            return "HEARING_IMPAIRED";
-          case AudioType::UNDEFINED:
-            return "UNDEFINED";
-          case AudioType::VISUAL_IMPAIRED_COMMENTARY:
-            return "VISUAL_IMPAIRED_COMMENTARY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAudioType(AudioType enumValue)
+        {
+          return GetNameForAudioTypeCStr(enumValue);
         }
 
       } // namespace AudioTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace AuthenticationSchemeMapper
       {
 
-        static const int AKAMAI_HASH = HashingUtils::HashString("AKAMAI");
-        static const int COMMON_HASH = HashingUtils::HashString("COMMON");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AKAMAI",
+          "COMMON",
+        };
 
         AuthenticationScheme GetAuthenticationSchemeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AKAMAI_HASH)
-          {
-            return AuthenticationScheme::AKAMAI;
-          }
-          else if (hashCode == COMMON_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AuthenticationScheme::COMMON;
+          case 1932171390:
+            if (name == "AKAMAI")
+            {
+              return AuthenticationScheme::AKAMAI;
+            }
+            break;
+          case 1993481707:
+            if (name == "COMMON")
+            {
+              return AuthenticationScheme::COMMON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AuthenticationScheme::NOT_SET;
         }
 
-        Aws::String GetNameForAuthenticationScheme(AuthenticationScheme enumValue)
+        const char* GetNameForAuthenticationSchemeCStr(AuthenticationScheme enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AuthenticationScheme::AKAMAI:
-            return "AKAMAI";
-          case AuthenticationScheme::COMMON:
-            return "COMMON";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAuthenticationScheme(AuthenticationScheme enumValue)
+        {
+          return GetNameForAuthenticationSchemeCStr(enumValue);
         }
 
       } // namespace AuthenticationSchemeMapper
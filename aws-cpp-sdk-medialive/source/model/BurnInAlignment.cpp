@@ -30,25 +30,44 @@ namespace Aws
       namespace BurnInAlignmentMapper
       {
 
-        static const int CENTERED_HASH = HashingUtils::HashString("CENTERED");
-        static const int LEFT_HASH = HashingUtils::HashString("LEFT");
-        static const int SMART_HASH = HashingUtils::HashString("SMART");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CENTERED",
+          "LEFT",
+          "SMART",
+        };
 
         BurnInAlignment GetBurnInAlignmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CENTERED_HASH)
-          {
-            return BurnInAlignment::CENTERED;
-          }
-          else if (hashCode == LEFT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BurnInAlignment::LEFT;
-          }
-          else if (hashCode == SMART_HASH)
-          {
-            return BurnInAlignment::SMART;
+          case -69793868:
+            if (name == "CENTERED")
+            {
+              return BurnInAlignment::CENTERED;
+            }
+            break;
+          case 2332679:
+            if (name == "LEFT")
+            {
+              return BurnInAlignment::LEFT;
+            }
+            break;
+          case 79011241:
+            if (name == "SMART")
+            {
+              return BurnInAlignment::SMART;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return BurnInAlignment::NOT_SET;
         }
 
-        Aws::String GetNameForBurnInAlignment(BurnInAlignment enumValue)
+        const char* GetNameForBurnInAlignmentCStr(BurnInAlignment enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BurnInAlignment::CENTERED:
-            return "CENTERED";
-          case BurnInAlignment::LEFT:
-            return "LEFT";
-          case BurnInAlignment::SMART:
-            return "SMART";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBurnInAlignment(BurnInAlignment enumValue)
+        {
+          return GetNameForBurnInAlignmentCStr(enumValue);
         }
 
       } // namespace BurnInAlignmentMapper
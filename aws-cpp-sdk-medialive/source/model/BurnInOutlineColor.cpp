@@ -30,40 +30,65 @@ namespace Aws
       namespace BurnInOutlineColorMapper
       {
 
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int BLUE_HASH = HashingUtils::HashString("BLUE");
-        static const int GREEN_HASH = HashingUtils::HashString("GREEN");
-        static const int RED_HASH = HashingUtils::HashString("RED");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-        static const int YELLOW_HASH = HashingUtils::HashString("YELLOW");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLACK",
+          "BLUE",
+          "GREEN",
+          "RED",
+          "WHITE",
+          "YELLOW",
+        };
 
         BurnInOutlineColor GetBurnInOutlineColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLACK_HASH)
-          {
-            return BurnInOutlineColor::BLACK;
-          }
-          else if (hashCode == BLUE_HASH)
-          {
-            return BurnInOutlineColor::BLUE;
-          }
-          else if (hashCode == GREEN_HASH)
-          {
-            return BurnInOutlineColor::GREEN;
-          }
-          else if (hashCode == RED_HASH)
-          {
-            return BurnInOutlineColor::RED;
-          }
-          else if (hashCode == WHITE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BurnInOutlineColor::WHITE;
-          }
-          else if (hashCode == YELLOW_HASH)
-          {
-            return BurnInOutlineColor::YELLOW;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return BurnInOutlineColor::BLACK;
+            }
+            break;
+          case 2041946:
+            if (name == "BLUE")
+            {
+              return BurnInOutlineColor::BLUE;
+            }
+            break;
+          case 68081379:
+            if (name == "GREEN")
+            {
+              return BurnInOutlineColor::GREEN;
+            }
+            break;
+          case 81009:
+            if (name == "RED")
+            {
+              return BurnInOutlineColor::RED;
+            }
+            break;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return BurnInOutlineColor::WHITE;
+            }
+            break;
+          case -1680910220:
+            if (name == "YELLOW")
+            {
+              return BurnInOutlineColor::YELLOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return BurnInOutlineColor::NOT_SET;
         }
 
-        Aws::String GetNameForBurnInOutlineColor(BurnInOutlineColor enumValue)
+        const char* GetNameForBurnInOutlineColorCStr(BurnInOutlineColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BurnInOutlineColor::BLACK:
-            return "BLACK";
-          case BurnInOutlineColor::BLUE:
-            return "BLUE";
-          case BurnInOutlineColor::GREEN:
-            return "GREEN";
-          case BurnInOutlineColor::RED:
-            return "RED";
-          case BurnInOutlineColor::WHITE:
-            return "WHITE";
-          case BurnInOutlineColor::YELLOW:
-            return "YELLOW";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBurnInOutlineColor(BurnInOutlineColor enumValue)
+        {
+          return GetNameForBurnInOutlineColorCStr(enumValue);
         }
 
       } // namespace BurnInOutlineColorMapper
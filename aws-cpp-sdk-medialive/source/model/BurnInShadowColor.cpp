@@ -30,25 +30,44 @@ namespace Aws
       namespace BurnInShadowColorMapper
       {
 
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLACK",
+          "NONE",
+          "WHITE",
+        };
 
         BurnInShadowColor GetBurnInShadowColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLACK_HASH)
-          {
-            return BurnInShadowColor::BLACK;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BurnInShadowColor::NONE;
-          }
-          else if (hashCode == WHITE_HASH)
-          {
-            return BurnInShadowColor::WHITE;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return BurnInShadowColor::BLACK;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return BurnInShadowColor::NONE;
+            }
+            break;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return BurnInShadowColor::WHITE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return BurnInShadowColor::NOT_SET;
         }
 
-        Aws::String GetNameForBurnInShadowColor(BurnInShadowColor enumValue)
+        const char* GetNameForBurnInShadowColorCStr(BurnInShadowColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BurnInShadowColor::BLACK:
-            return "BLACK";
-          case BurnInShadowColor::NONE:
-            return "NONE";
-          case BurnInShadowColor::WHITE:
-            return "WHITE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBurnInShadowColor(BurnInShadowColor enumValue)
+        {
+          return GetNameForBurnInShadowColorCStr(enumValue);
         }
 
       } // namespace BurnInShadowColorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace BurnInTeletextGridControlMapper
       {
 
-        static const int FIXED_HASH = HashingUtils::HashString("FIXED");
-        static const int SCALED_HASH = HashingUtils::HashString("SCALED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FIXED",
+          "SCALED",
+        };
 
         BurnInTeletextGridControl GetBurnInTeletextGridControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FIXED_HASH)
-          {
-            return BurnInTeletextGridControl::FIXED;
-          }
-          else if (hashCode == SCALED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BurnInTeletextGridControl::SCALED;
+          case 66907988:
+            if (name == "FIXED")
+            {
+              return BurnInTeletextGridControl::FIXED;
+            }
+            break;
+          case -1854860198:
+            if (name == "SCALED")
+            {
+              return BurnInTeletextGridControl::SCALED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BurnInTeletextGridControl::NOT_SET;
         }
 
-        Aws::String GetNameForBurnInTeletextGridControl(BurnInTeletextGridControl enumValue)
+        const char* GetNameForBurnInTeletextGridControlCStr(BurnInTeletextGridControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BurnInTeletextGridControl::FIXED:
-            return "FIXED";
-          case BurnInTeletextGridControl::SCALED:
-            return "SCALED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBurnInTeletextGridControl(BurnInTeletextGridControl enumValue)
+        {
+          return GetNameForBurnInTeletextGridControlCStr(enumValue);
         }
 
       } // namespace BurnInTeletextGridControlMapper
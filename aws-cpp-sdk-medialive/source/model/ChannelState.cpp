@@ -30,55 +30,86 @@ namespace Aws
       namespace ChannelStateMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
-        static const int IDLE_HASH = HashingUtils::HashString("IDLE");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int RECOVERING_HASH = HashingUtils::HashString("RECOVERING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "CREATE_FAILED",
+          "IDLE",
+          "STARTING",
+          "RUNNING",
+          "RECOVERING",
+          "STOPPING",
+          "DELETING",
+          "DELETED",
+        };
 
         ChannelState GetChannelStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return ChannelState::CREATING;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChannelState::CREATE_FAILED;
-          }
-          else if (hashCode == IDLE_HASH)
-          {
-            return ChannelState::IDLE;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return ChannelState::STARTING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ChannelState::RUNNING;
-          }
-          else if (hashCode == RECOVERING_HASH)
-          {
-            return ChannelState::RECOVERING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return ChannelState::STOPPING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ChannelState::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ChannelState::DELETED;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return ChannelState::CREATING;
+            }
+            break;
+          case -835019552:
+            if (name == "CREATE_FAILED")
+            {
+              return ChannelState::CREATE_FAILED;
+            }
+            break;
+          case 2242516:
+            if (name == "IDLE")
+            {
+              return ChannelState::IDLE;
+            }
+            break;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return ChannelState::STARTING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return ChannelState::RUNNING;
+            }
+            break;
+          case 1336323070:
+            if (name == "RECOVERING")
+            {
+              return ChannelState::RECOVERING;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return ChannelState::STOPPING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ChannelState::DELETING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return ChannelState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return ChannelState::NOT_SET;
         }
 
-        Aws::String GetNameForChannelState(ChannelState enumValue)
+        const char* GetNameForChannelStateCStr(ChannelState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChannelState::CREATING:
-            return "CREATING";
-          case ChannelState::CREATE_FAILED:
-            return "CREATE_FAILED";
-          case ChannelState::IDLE:
-            return "IDLE";
-          case ChannelState::STARTING:
-            return "STARTING";
-          case ChannelState::RUNNING:
-            return "RUNNING";
-          case ChannelState::RECOVERING:
-            return "RECOVERING";
-          case ChannelState::STOPPING:
-            return "STOPPING";
-          case ChannelState::DELETING:
-            return "DELETING";
-          case ChannelState::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChannelState(ChannelState enumValue)
+        {
+          return GetNameForChannelStateCStr(enumValue);
         }
 
       } // namespace ChannelStateMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DvbSubDestinationAlignmentMapper
       {
 
-        static const int CENTERED_HASH = HashingUtils::HashString("CENTERED");
-        static const int LEFT_HASH = HashingUtils::HashString("LEFT");
-        static const int SMART_HASH = HashingUtils::HashString("SMART");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CENTERED",
+          "LEFT",
+          "SMART",
+        };
 
         DvbSubDestinationAlignment GetDvbSubDestinationAlignmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CENTERED_HASH)
-          {
-            return DvbSubDestinationAlignment::CENTERED;
-          }
-          else if (hashCode == LEFT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DvbSubDestinationAlignment::LEFT;
-          }
-          else if (hashCode == SMART_HASH)
-          {
-            return DvbSubDestinationAlignment::SMART;
+          case -69793868:
+            if (name == "CENTERED")
+            {
+              return DvbSubDestinationAlignment::CENTERED;
+            }
+            break;
+          case 2332679:
+            if (name == "LEFT")
+            {
+              return DvbSubDestinationAlignment::LEFT;
+            }
+            break;
+          case 79011241:
+            if (name == "SMART")
+            {
+              return DvbSubDestinationAlignment::SMART;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DvbSubDestinationAlignment::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubDestinationAlignment(DvbSubDestinationAlignment enumValue)
+        const char* GetNameForDvbSubDestinationAlignmentCStr(DvbSubDestinationAlignment enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DvbSubDestinationAlignment::CENTERED:
-            return "CENTERED";
-          case DvbSubDestinationAlignment::LEFT:
-            return "LEFT";
-          case DvbSubDestinationAlignment::SMART:
-            return "SMART";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDvbSubDestinationAlignment(DvbSubDestinationAlignment enumValue)
+        {
+          return GetNameForDvbSubDestinationAlignmentCStr(enumValue);
         }
 
       } // namespace DvbSubDestinationAlignmentMapper
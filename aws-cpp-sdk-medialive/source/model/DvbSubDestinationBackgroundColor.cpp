@@ -30,25 +30,44 @@ namespace Aws
       namespace DvbSubDestinationBackgroundColorMapper
       {
 
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLACK",
+          "NONE",
+          "WHITE",
+        };
 
         DvbSubDestinationBackgroundColor GetDvbSubDestinationBackgroundColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLACK_HASH)
-          {
-            return DvbSubDestinationBackgroundColor::BLACK;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DvbSubDestinationBackgroundColor::NONE;
-          }
-          else if (hashCode == WHITE_HASH)
-          {
-            return DvbSubDestinationBackgroundColor::WHITE;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return DvbSubDestinationBackgroundColor::BLACK;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return DvbSubDestinationBackgroundColor::NONE;
+            }
+            break;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return DvbSubDestinationBackgroundColor::WHITE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DvbSubDestinationBackgroundColor::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubDestinationBackgroundColor(DvbSubDestinationBackgroundColor enumValue)
+        const char* GetNameForDvbSubDestinationBackgroundColorCStr(DvbSubDestinationBackgroundColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DvbSubDestinationBackgroundColor::BLACK:
-            return "BLACK";
-          case DvbSubDestinationBackgroundColor::NONE:
-            return "NONE";
-          case DvbSubDestinationBackgroundColor::WHITE:
-            return "WHITE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDvbSubDestinationBackgroundColor(DvbSubDestinationBackgroundColor enumValue)
+        {
+          return GetNameForDvbSubDestinationBackgroundColorCStr(enumValue);
         }
 
       } // namespace DvbSubDestinationBackgroundColorMapper
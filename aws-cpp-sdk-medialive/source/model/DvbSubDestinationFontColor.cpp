@@ -30,40 +30,65 @@ namespace Aws
       namespace DvbSubDestinationFontColorMapper
       {
 
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int BLUE_HASH = HashingUtils::HashString("BLUE");
-        static const int GREEN_HASH = HashingUtils::HashString("GREEN");
-        static const int RED_HASH = HashingUtils::HashString("RED");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-        static const int YELLOW_HASH = HashingUtils::HashString("YELLOW");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLACK",
+          "BLUE",
+          "GREEN",
+          "RED",
+          "WHITE",
+          "YELLOW",
+        };
 
         DvbSubDestinationFontColor GetDvbSubDestinationFontColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLACK_HASH)
-          {
-            return DvbSubDestinationFontColor::BLACK;
-          }
-          else if (hashCode == BLUE_HASH)
-          {
-            return DvbSubDestinationFontColor::BLUE;
-          }
-          else if (hashCode == GREEN_HASH)
-          {
-            return DvbSubDestinationFontColor::GREEN;
-          }
-          else if (hashCode == RED_HASH)
-          {
-            return DvbSubDestinationFontColor::RED;
-          }
-          else if (hashCode == WHITE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DvbSubDestinationFontColor::WHITE;
-          }
-          else if (hashCode == YELLOW_HASH)
-          {
-            return DvbSubDestinationFontColor::YELLOW;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return DvbSubDestinationFontColor::BLACK;
+            }
+            break;
+          case 2041946:
+            if (name == "BLUE")
+            {
+              return DvbSubDestinationFontColor::BLUE;
+            }
+            break;
+          case 68081379:
+            if (name == "GREEN")
+            {
+              return DvbSubDestinationFontColor::GREEN;
+            }
+            break;
+          case 81009:
+            if (name == "RED")
+            {
+              return DvbSubDestinationFontColor::RED;
+            }
+            break;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return DvbSubDestinationFontColor::WHITE;
+            }
+            break;
+          case -1680910220:
+            if (name == "YELLOW")
+            {
+              return DvbSubDestinationFontColor::YELLOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return DvbSubDestinationFontColor::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubDestinationFontColor(DvbSubDestinationFontColor enumValue)
+        const char* GetNameForDvbSubDestinationFontColorCStr(DvbSubDestinationFontColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DvbSubDestinationFontColor::BLACK:
-            return "BLACK";
-          case DvbSubDestinationFontColor::BLUE:
-            return "BLUE";
-          case DvbSubDestinationFontColor::GREEN:
-            return "GREEN";
-          case DvbSubDestinationFontColor::RED:
-            return "RED";
-          case DvbSubDestinationFontColor::WHITE:
-            return "WHITE";
-          case DvbSubDestinationFontColor::YELLOW:
-            return "YELLOW";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDvbSubDestinationFontColor(DvbSubDestinationFontColor enumValue)
+        {
+          return GetNameForDvbSubDestinationFontColorCStr(enumValue);
         }
 
       } // namespace DvbSubDestinationFontColorMapper
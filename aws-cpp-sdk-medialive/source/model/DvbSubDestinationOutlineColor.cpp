@@ -30,40 +30,65 @@ namespace Aws
       namespace DvbSubDestinationOutlineColorMapper
       {
 
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int BLUE_HASH = HashingUtils::HashString("BLUE");
-        static const int GREEN_HASH = HashingUtils::HashString("GREEN");
-        static const int RED_HASH = HashingUtils::HashString("RED");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-        static const int YELLOW_HASH = HashingUtils::HashString("YELLOW");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLACK",
+          "BLUE",
+          "GREEN",
+          "RED",
+          "WHITE",
+          "YELLOW",
+        };
 
         DvbSubDestinationOutlineColor GetDvbSubDestinationOutlineColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLACK_HASH)
-          {
-            return DvbSubDestinationOutlineColor::BLACK;
-          }
-          else if (hashCode == BLUE_HASH)
-          {
-            return DvbSubDestinationOutlineColor::BLUE;
-          }
-          else if (hashCode == GREEN_HASH)
-          {
-            return DvbSubDestinationOutlineColor::GREEN;
-          }
-          else if (hashCode == RED_HASH)
-          {
-            return DvbSubDestinationOutlineColor::RED;
-          }
-          else if (hashCode == WHITE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DvbSubDestinationOutlineColor::WHITE;
-          }
-          else if (hashCode == YELLOW_HASH)
-          {
-            return DvbSubDestinationOutlineColor::YELLOW;
+          case 63281119:
+            if (name == "BLACK")
+            {
+              return DvbSubDestinationOutlineColor::BLACK;
+            }
+            break;
+          case 2041946:
+            if (name == "BLUE")
+            {
+              return DvbSubDestinationOutlineColor::BLUE;
+            }
+            break;
+          case 68081379:
+            if (name == "GREEN")
+            {
+              return DvbSubDestinationOutlineColor::GREEN;
+            }
+            break;
+          case 81009:
+            if (name == "RED")
+            {
+              return DvbSubDestinationOutlineColor::RED;
+            }
+            break;
+          case 82564105:
+            if (name == "WHITE")
+            {
+              return DvbSubDestinationOutlineColor::WHITE;
+            }
+            break;
+          case -1680910220:
+            if (name == "YELLOW")
+            {
+              return DvbSubDestinationOutlineColor::YELLOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return DvbSubDestinationOutlineColor::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubDestinationOutlineColor(DvbSubDestinationOutlineColor enumValue)
+        const char* GetNameForDvbSubDestinationOutlineColorCStr(DvbSubDestinationOutlineColor enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DvbSubDestinationOutlineColor::BLACK:
-            return "BLACK";
-          case DvbSubDestinationOutlineColor::BLUE:
-            return "BLUE";
-          case DvbSubDestinationOutlineColor::GREEN:
-            return "GREEN";
-          case DvbSubDestinationOutlineColor::RED:
-            return "RED";
-          case DvbSubDestinationOutlineColor::WHITE:
-            return "WHITE";
-          case DvbSubDestinationOutlineColor::YELLOW:
-            return "YELLOW";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDvbSubDestinationOutlineColor(DvbSubDestinationOutlineColor enumValue)
+        {
+          return GetNameForDvbSubDestinationOutlineColorCStr(enumValue);
         }
 
       } // namespace DvbSubDestinationOutlineColorMapper
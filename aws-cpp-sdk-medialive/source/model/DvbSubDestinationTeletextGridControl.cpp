@@ -30,20 +30,37 @@ namespace Aws
       namespace DvbSubDestinationTeletextGridControlMapper
       {
 
-        static const int FIXED_HASH = HashingUtils::HashString("FIXED");
-        static const int SCALED_HASH = HashingUtils::HashString("SCALED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FIXED",
+          "SCALED",
+        };
 
         DvbSubDestinationTeletextGridControl GetDvbSubDestinationTeletextGridControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FIXED_HASH)
-          {
-            return DvbSubDestinationTeletextGridControl::FIXED;
-          }
-          else if (hashCode == SCALED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DvbSubDestinationTeletextGridControl::SCALED;
+          case 66907988:
+            if (name == "FIXED")
+            {
+              return DvbSubDestinationTeletextGridControl::FIXED;
+            }
+            break;
+          case -1854860198:
+            if (name == "SCALED")
+            {
+              return DvbSubDestinationTeletextGridControl::SCALED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DvbSubDestinationTeletextGridControl::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubDestinationTeletextGridControl(DvbSubDestinationTeletextGridControl enumValue)
+        const char* GetNameForDvbSubDestinationTeletextGridControlCStr(DvbSubDestinationTeletextGridControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DvbSubDestinationTeletextGridControl::FIXED:
-            return "FIXED";
-          case DvbSubDestinationTeletextGridControl::SCALED:
-            return "SCALED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDvbSubDestinationTeletextGridControl(DvbSubDestinationTeletextGridControl enumValue)
+        {
+          return GetNameForDvbSubDestinationTeletextGridControlCStr(enumValue);
         }
 
       } // namespace DvbSubDestinationTeletextGridControlMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace Eac3CodingModeMapper
       {
 
-        static const int CODING_MODE_1_0_HASH = HashingUtils::HashString("CODING_MODE_1_0");
-        static const int CODING_MODE_2_0_HASH = HashingUtils::HashString("CODING_MODE_2_0");
-        static const int CODING_MODE_3_2_HASH = HashingUtils::HashString("CODING_MODE_3_2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CODING_MODE_1_0",
+          "CODING_MODE_2_0",
+          "CODING_MODE_3_2",
+        };
 
         Eac3CodingMode GetEac3CodingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CODING_MODE_1_0_HASH)
-          {
-            return Eac3CodingMode::CODING_MODE_1_0;
-          }
-          else if (hashCode == CODING_MODE_2_0_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Eac3CodingMode::CODING_MODE_2_0;
-          }
-          else if (hashCode == CODING_MODE_3_2_HASH)
-          {
-            return Eac3CodingMode::CODING_MODE_3_2;
+          case -242316229:
+            if (name == "CODING_MODE_1_0")
+            {
+              return Eac3CodingMode::CODING_MODE_1_0;
+            }
+            break;
+          case -242315268:
+            if (name == "CODING_MODE_2_0")
+            {
+              return Eac3CodingMode::CODING_MODE_2_0;
+            }
+            break;
+          case -242314305:
+            if (name == "CODING_MODE_3_2")
+            {
+              return Eac3CodingMode::CODING_MODE_3_2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Eac3CodingMode::NOT_SET;
         }
 
-        Aws::String GetNameForEac3CodingMode(Eac3CodingMode enumValue)
+        const char* GetNameForEac3CodingModeCStr(Eac3CodingMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Eac3CodingMode::CODING_MODE_1_0:
-            return "CODING_MODE_1_0";
-          case Eac3CodingMode::CODING_MODE_2_0:
-            return "CODING_MODE_2_0";
-          case Eac3CodingMode::CODING_MODE_3_2:
-            return "CODING_MODE_3_2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEac3CodingMode(Eac3CodingMode enumValue)
+        {
+          return GetNameForEac3CodingModeCStr(enumValue);
         }
 
       } // namespace Eac3CodingModeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace Eac3DrcRfMapper
       {
 
-        static const int FILM_LIGHT_HASH = HashingUtils::HashString("FILM_LIGHT");
-        static const int FILM_STANDARD_HASH = HashingUtils::HashString("FILM_STANDARD");
-        static const int MUSIC_LIGHT_HASH = HashingUtils::HashString("MUSIC_LIGHT");
-        static const int MUSIC_STANDARD_HASH = HashingUtils::HashString("MUSIC_STANDARD");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SPEECH_HASH = HashingUtils::HashString("SPEECH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FILM_LIGHT",
+          "FILM_STANDARD",
+          "MUSIC_LIGHT",
+          "MUSIC_STANDARD",
+          "NONE",
+          "SPEECH",
+        };
 
         Eac3DrcRf GetEac3DrcRfForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FILM_LIGHT_HASH)
-          {
-            return Eac3DrcRf::FILM_LIGHT;
-          }
-          else if (hashCode == FILM_STANDARD_HASH)
-          {
-            return Eac3DrcRf::FILM_STANDARD;
-          }
-          else if (hashCode == MUSIC_LIGHT_HASH)
-          {
-            return Eac3DrcRf::MUSIC_LIGHT;
-          }
-          else if (hashCode == MUSIC_STANDARD_HASH)
-          {
-            return Eac3DrcRf::MUSIC_STANDARD;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Eac3DrcRf::NONE;
-          }
-          else if (hashCode == SPEECH_HASH)
-          {
-            return Eac3DrcRf::SPEECH;
+          case 2048875131:
+            if (name == "FILM_LIGHT")
+            {
+              return Eac3DrcRf::FILM_LIGHT;
+            }
+            break;
+          case -1715452136:
+            if (name == "FILM_STANDARD")
+            {
+              return Eac3DrcRf::FILM_STANDARD;
+            }
+            break;
+          case 356597308:
+            if (name == "MUSIC_LIGHT")
+            {
+              return Eac3DrcRf::MUSIC_LIGHT;
+            }
+            break;
+          case -2037956681:
+            if (name == "MUSIC_STANDARD")
+            {
+              return Eac3DrcRf::MUSIC_STANDARD;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Eac3DrcRf::NONE;
+            }
+            break;
+          case -1842742046:
+            if (name == "SPEECH")
+            {
+              return Eac3DrcRf::SPEECH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return Eac3DrcRf::NOT_SET;
         }
 
-        Aws::String GetNameForEac3DrcRf(Eac3DrcRf enumValue)
+        const char* GetNameForEac3DrcRfCStr(Eac3DrcRf enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Eac3DrcRf::FILM_LIGHT:
-            return "FILM_LIGHT";
-          case Eac3DrcRf::FILM_STANDARD:
-            return "FILM_STANDARD";
-          case Eac3DrcRf::MUSIC_LIGHT:
-            return "MUSIC_LIGHT";
-          case Eac3DrcRf::MUSIC_STANDARD:
-            return "MUSIC_STANDARD";
-          case Eac3DrcRf::NONE:
-            return "NONE";
-          case Eac3DrcRf::SPEECH:
-            return "SPEECH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEac3DrcRf(Eac3DrcRf enumValue)
+        {
+          return GetNameForEac3DrcRfCStr(enumValue);
         }
 
       } // namespace Eac3DrcRfMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace Eac3StereoDownmixMapper
       {
 
-        static const int DPL2_HASH = HashingUtils::HashString("DPL2");
-        static const int LO_RO_HASH = HashingUtils::HashString("LO_RO");
-        static const int LT_RT_HASH = HashingUtils::HashString("LT_RT");
-        static const int NOT_INDICATED_HASH = HashingUtils::HashString("NOT_INDICATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DPL2",
+          "LO_RO",
+          "LT_RT",
+          "NOT_INDICATED",
+        };
 
         Eac3StereoDownmix GetEac3StereoDownmixForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DPL2_HASH)
-          {
-            return Eac3StereoDownmix::DPL2;
-          }
-          else if (hashCode == LO_RO_HASH)
-          {
-            return Eac3StereoDownmix::LO_RO;
-          }
-          else if (hashCode == LT_RT_HASH)
-          {
-            return Eac3StereoDownmix::LT_RT;
-          }
-          else if (hashCode == NOT_INDICATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Eac3StereoDownmix::NOT_INDICATED;
+          case 2105074:
+            if (name == "DPL2")
+            {
+              return Eac3StereoDownmix::DPL2;
+            }
+            break;
+          case 72635001:
+            if (name == "LO_RO")
+            {
+              return Eac3StereoDownmix::LO_RO;
+            }
+            break;
+          case 72783961:
+            if (name == "LT_RT")
+            {
+              return Eac3StereoDownmix::LT_RT;
+            }
+            break;
+          case 162624031:
+            if (name == "NOT_INDICATED")
+            {
+              return Eac3StereoDownmix::NOT_INDICATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Eac3StereoDownmix::NOT_SET;
         }
 
-        Aws::String GetNameForEac3StereoDownmix(Eac3StereoDownmix enumValue)
+        const char* GetNameForEac3StereoDownmixCStr(Eac3StereoDownmix enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Eac3StereoDownmix::DPL2:
-            return "DPL2";
-          case Eac3StereoDownmix::LO_RO:
-            return "LO_RO";
-          case Eac3StereoDownmix::LT_RT:
-            return "LT_RT";
-          case Eac3StereoDownmix::NOT_INDICATED:
-            return "NOT_INDICATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEac3StereoDownmix(Eac3StereoDownmix enumValue)
+        {
+          return GetNameForEac3StereoDownmixCStr(enumValue);
         }
 
       } // namespace Eac3StereoDownmixMapper
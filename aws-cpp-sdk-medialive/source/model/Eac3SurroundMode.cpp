@@ -30,25 +30,44 @@ namespace Aws
       namespace Eac3SurroundModeMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int NOT_INDICATED_HASH = HashingUtils::HashString("NOT_INDICATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "ENABLED",
+          "NOT_INDICATED",
+        };
 
         Eac3SurroundMode GetEac3SurroundModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return Eac3SurroundMode::DISABLED;
-          }
-          else if (hashCode == ENABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Eac3SurroundMode::ENABLED;
-          }
-          else if (hashCode == NOT_INDICATED_HASH)
-          {
-            return Eac3SurroundMode::NOT_INDICATED;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return Eac3SurroundMode::DISABLED;
+            }
+            break;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return Eac3SurroundMode::ENABLED;
+            }
+            break;
+          case 162624031:
+            if (name == "NOT_INDICATED")
+            {
+              return Eac3SurroundMode::NOT_INDICATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Eac3SurroundMode::NOT_SET;
         }
 
-        Aws::String GetNameForEac3SurroundMode(Eac3SurroundMode enumValue)
+        const char* GetNameForEac3SurroundModeCStr(Eac3SurroundMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Eac3SurroundMode::DISABLED:
-            return "DISABLED";
-          case Eac3SurroundMode::ENABLED:
-            return "ENABLED";
-          case Eac3SurroundMode::NOT_INDICATED:
-            return "NOT_INDICATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEac3SurroundMode(Eac3SurroundMode enumValue)
+        {
+          return GetNameForEac3SurroundModeCStr(enumValue);
         }
 
       } // namespace Eac3SurroundModeMapper
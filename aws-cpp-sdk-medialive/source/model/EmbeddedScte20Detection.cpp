@@ -30,20 +30,37 @@ namespace Aws
       namespace EmbeddedScte20DetectionMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTO",
+          "OFF",
+        };
 
         EmbeddedScte20Detection GetEmbeddedScte20DetectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
-          {
-            return EmbeddedScte20Detection::AUTO;
-          }
-          else if (hashCode == OFF_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EmbeddedScte20Detection::OFF;
+          case 2020783:
+            if (name == "AUTO")
+            {
+              return EmbeddedScte20Detection::AUTO;
+            }
+            break;
+          case 78159:
+            if (name == "OFF")
+            {
+              return EmbeddedScte20Detection::OFF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EmbeddedScte20Detection::NOT_SET;
         }
 
-        Aws::String GetNameForEmbeddedScte20Detection(EmbeddedScte20Detection enumValue)
+        const char* GetNameForEmbeddedScte20DetectionCStr(EmbeddedScte20Detection enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EmbeddedScte20Detection::AUTO:
-            return "AUTO";
-          case EmbeddedScte20Detection::OFF:
-            return "OFF";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEmbeddedScte20Detection(EmbeddedScte20Detection enumValue)
+        {
+          return GetNameForEmbeddedScte20DetectionCStr(enumValue);
         }
 
       } // namespace EmbeddedScte20DetectionMapper
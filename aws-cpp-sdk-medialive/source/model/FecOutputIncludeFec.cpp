@@ -30,20 +30,37 @@ namespace Aws
       namespace FecOutputIncludeFecMapper
       {
 
-        static const int COLUMN_HASH = HashingUtils::HashString("COLUMN");
-        static const int COLUMN_AND_ROW_HASH = HashingUtils::HashString("COLUMN_AND_ROW");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COLUMN",
+          "COLUMN_AND_ROW",
+        };
 
         FecOutputIncludeFec GetFecOutputIncludeFecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COLUMN_HASH)
-          {
-            return FecOutputIncludeFec::COLUMN;
-          }
-          else if (hashCode == COLUMN_AND_ROW_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FecOutputIncludeFec::COLUMN_AND_ROW;
+          case 1993459542:
+            if (name == "COLUMN")
+            {
+              return FecOutputIncludeFec::COLUMN;
+            }
+            break;
+          case -1692307639:
+            if (name == "COLUMN_AND_ROW")
+            {
+              return FecOutputIncludeFec::COLUMN_AND_ROW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FecOutputIncludeFec::NOT_SET;
         }
 
-        Aws::String GetNameForFecOutputIncludeFec(FecOutputIncludeFec enumValue)
+        const char* GetNameForFecOutputIncludeFecCStr(FecOutputIncludeFec enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FecOutputIncludeFec::COLUMN:
-            return "COLUMN";
-          case FecOutputIncludeFec::COLUMN_AND_ROW:
-            return "COLUMN_AND_ROW";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFecOutputIncludeFec(FecOutputIncludeFec enumValue)
+        {
+          return GetNameForFecOutputIncludeFecCStr(enumValue);
         }
 
       } // namespace FecOutputIncludeFecMapper
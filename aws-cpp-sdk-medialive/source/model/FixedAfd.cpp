@@ -30,65 +30,100 @@ namespace Aws
       namespace FixedAfdMapper
       {
 
-        static const int AFD_0000_HASH = HashingUtils::HashString("AFD_0000");
-        static const int AFD_0010_HASH = HashingUtils::HashString("AFD_0010");
-        static const int AFD_0011_HASH = HashingUtils::HashString("AFD_0011");
-        static const int AFD_0100_HASH = HashingUtils::HashString("AFD_0100");
-        static const int AFD_1000_HASH = HashingUtils::HashString("AFD_1000");
-        static const int AFD_1001_HASH = HashingUtils::HashString("AFD_1001");
-        static const int AFD_1010_HASH = HashingUtils::HashString("AFD_1010");
-        static const int AFD_1011_HASH = HashingUtils::HashString("AFD_1011");
-        static const int AFD_1101_HASH = HashingUtils::HashString("AFD_1101");
-        static const int AFD_1110_HASH = HashingUtils::HashString("AFD_1110");
-        static const int AFD_1111_HASH = HashingUtils::HashString("AFD_1111");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AFD_0000",
+          "AFD_0010",
+          "AFD_0011",
+          "AFD_0100",
+          "AFD_1000",
+          "AFD_1001",
+          "AFD_1010",
+          "AFD_1011",
+          "AFD_1101",
+          "AFD_1110",
+          "AFD_1111",
+        };
 
         FixedAfd GetFixedAfdForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AFD_0000_HASH)
-          {
-            return FixedAfd::AFD_0000;
-          }
-          else if (hashCode == AFD_0010_HASH)
-          {
-            return FixedAfd::AFD_0010;
-          }
-          else if (hashCode == AFD_0011_HASH)
-          {
-            return FixedAfd::AFD_0011;
-          }
-          else if (hashCode == AFD_0100_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FixedAfd::AFD_0100;
-          }
-          else if (hashCode == AFD_1000_HASH)
-          {
-            return FixedAfd::AFD_1000;
-          }
-          else if (hashCode == AFD_1001_HASH)
-          {
-            return FixedAfd::AFD_1001;
-          }
-          else if (hashCode == AFD_1010_HASH)
-          {
-            return FixedAfd::AFD_1010;
-          }
-          else if (hashCode == AFD_1011_HASH)
-          {
-            return FixedAfd::AFD_1011;
-          }
-          else if (hashCode == AFD_1101_HASH)
-          {
-            return FixedAfd::AFD_1101;
-          }
-          else if (hashCode == AFD_1110_HASH)
-          {
-            return FixedAfd::AFD_1110;
-          }
-          else if (hashCode == AFD_1111_HASH)
-          {
-            return FixedAfd::AFD_1111;
+          case 1350264704:
+            if (name == "AFD_0000")
+            {
+              return FixedAfd::AFD_0000;
+            }
+            break;
+          case 1350264735:
+            if (name == "AFD_0010")
+            {
+              return FixedAfd::AFD_0010;
+            }
+            break;
+          case 1350264736:
+            if (name == "AFD_0011")
+            {
+              return FixedAfd::AFD_0011;
+            }
+            break;
+          case 1350265665:
+            if (name == "AFD_0100")
+            {
+              return FixedAfd::AFD_0100;
+            }
+            break;
+          case 1350294495:
+            if (name == "AFD_1000")
+            {
+              return FixedAfd::AFD_1000;
+            }
+            break;
+          case 1350294496:
+            if (name == "AFD_1001")
+            {
+              return FixedAfd::AFD_1001;
+            }
+            break;
+          case 1350294526:
+            if (name == "AFD_1010")
+            {
+              return FixedAfd::AFD_1010;
+            }
+            break;
+          case 1350294527:
+            if (name == "AFD_1011")
+            {
+              return FixedAfd::AFD_1011;
+            }
+            break;
+          case 1350295457:
+            if (name == "AFD_1101")
+            {
+              return FixedAfd::AFD_1101;
+            }
+            break;
+          case 1350295487:
+            if (name == "AFD_1110")
+            {
+              return FixedAfd::AFD_1110;
+            }
+            break;
+          case 1350295488:
+            if (name == "AFD_1111")
+            {
+              return FixedAfd::AFD_1111;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return FixedAfd::NOT_SET;
         }
 
-        Aws::String GetNameForFixedAfd(FixedAfd enumValue)
+        const char* GetNameForFixedAfdCStr(FixedAfd enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FixedAfd::AFD_0000:
-            return "AFD_0000";
-          case FixedAfd::AFD_0010:
-            return "AFD_0010";
-          case FixedAfd::AFD_0011:
-            return "AFD_0011";
-          case FixedAfd::AFD_0100:
-            return "AFD_0100";
-          case FixedAfd::AFD_1000:
-            return "AFD_1000";
-          case FixedAfd::AFD_1001:
-            return "AFD_1001";
-          case FixedAfd::AFD_1010:
-            return "AFD_1010";
-          case FixedAfd::AFD_1011:
-            return "AFD_1011";
-          case FixedAfd::AFD_1101:
-            return "AFD_1101";
-          case FixedAfd::AFD_1110:
-            return "AFD_1110";
-          case FixedAfd::AFD_1111:
-            return "AFD_1111";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFixedAfd(FixedAfd enumValue)
+        {
+          return GetNameForFixedAfdCStr(enumValue);
         }
 
       } // namespace FixedAfdMapper
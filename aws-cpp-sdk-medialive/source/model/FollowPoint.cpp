@@ -30,20 +30,37 @@ namespace Aws
       namespace FollowPointMapper
       {
 
-        static const int END_HASH = HashingUtils::HashString("END");
-        static const int START_HASH = HashingUtils::HashString("START");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "END",
+          "START",
+        };
 
         FollowPoint GetFollowPointForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == END_HASH)
-          {
-            return FollowPoint::END;
-          }
-          else if (hashCode == START_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FollowPoint::START;
+          case 68795:
+            if (name == "END")
+            {
+              return FollowPoint::END;
+            }
+            break;
+          case 79219778:
+            if (name == "START")
+            {
+              return FollowPoint::START;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FollowPoint::NOT_SET;
         }
 
-        Aws::String GetNameForFollowPoint(FollowPoint enumValue)
+        const char* GetNameForFollowPointCStr(FollowPoint enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FollowPoint::END:
-            return "END";
-          case FollowPoint::START:
-            return "START";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFollowPoint(FollowPoint enumValue)
+        {
+          return GetNameForFollowPointCStr(enumValue);
         }
 
       } // namespace FollowPointMapper
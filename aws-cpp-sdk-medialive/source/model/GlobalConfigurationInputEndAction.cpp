@@ -30,20 +30,37 @@ namespace Aws
       namespace GlobalConfigurationInputEndActionMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SWITCH_AND_LOOP_INPUTS_HASH = HashingUtils::HashString("SWITCH_AND_LOOP_INPUTS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "SWITCH_AND_LOOP_INPUTS",
+        };
 
         GlobalConfigurationInputEndAction GetGlobalConfigurationInputEndActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return GlobalConfigurationInputEndAction::NONE;
-          }
-          else if (hashCode == SWITCH_AND_LOOP_INPUTS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GlobalConfigurationInputEndAction::SWITCH_AND_LOOP_INPUTS;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return GlobalConfigurationInputEndAction::NONE;
+            }
+            break;
+          case 234647121:
+            if (name == "SWITCH_AND_LOOP_INPUTS")
+            {
+              return GlobalConfigurationInputEndAction::SWITCH_AND_LOOP_INPUTS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return GlobalConfigurationInputEndAction::NOT_SET;
         }
 
-        Aws::String GetNameForGlobalConfigurationInputEndAction(GlobalConfigurationInputEndAction enumValue)
+        const char* GetNameForGlobalConfigurationInputEndActionCStr(GlobalConfigurationInputEndAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GlobalConfigurationInputEndAction::NONE:
-            return "NONE";
-          case GlobalConfigurationInputEndAction::SWITCH_AND_LOOP_INPUTS:
-            return "SWITCH_AND_LOOP_INPUTS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGlobalConfigurationInputEndAction(GlobalConfigurationInputEndAction enumValue)
+        {
+          return GetNameForGlobalConfigurationInputEndActionCStr(enumValue);
         }
 
       } // namespace GlobalConfigurationInputEndActionMapper
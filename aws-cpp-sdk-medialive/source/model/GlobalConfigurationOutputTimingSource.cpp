@@ -30,20 +30,37 @@ namespace Aws
       namespace GlobalConfigurationOutputTimingSourceMapper
       {
 
-        static const int INPUT_CLOCK_HASH = HashingUtils::HashString("INPUT_CLOCK");
-        static const int SYSTEM_CLOCK_HASH = HashingUtils::HashString("SYSTEM_CLOCK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INPUT_CLOCK",
+          "SYSTEM_CLOCK",
+        };
 
         GlobalConfigurationOutputTimingSource GetGlobalConfigurationOutputTimingSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INPUT_CLOCK_HASH)
-          {
-            return GlobalConfigurationOutputTimingSource::INPUT_CLOCK;
-          }
-          else if (hashCode == SYSTEM_CLOCK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GlobalConfigurationOutputTimingSource::SYSTEM_CLOCK;
+          case -1204175079:
+            if (name == "INPUT_CLOCK")
+            {
+              return GlobalConfigurationOutputTimingSource::INPUT_CLOCK;
+            }
+            break;
+          case -1421865506:
+            if (name == "SYSTEM_CLOCK")
+            {
+              return GlobalConfigurationOutputTimingSource::SYSTEM_CLOCK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return GlobalConfigurationOutputTimingSource::NOT_SET;
         }
 
-        Aws::String GetNameForGlobalConfigurationOutputTimingSource(GlobalConfigurationOutputTimingSource enumValue)
+        const char* GetNameForGlobalConfigurationOutputTimingSourceCStr(GlobalConfigurationOutputTimingSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GlobalConfigurationOutputTimingSource::INPUT_CLOCK:
-            return "INPUT_CLOCK";
-          case GlobalConfigurationOutputTimingSource::SYSTEM_CLOCK:
-            return "SYSTEM_CLOCK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGlobalConfigurationOutputTimingSource(GlobalConfigurationOutputTimingSource enumValue)
+        {
+          return GetNameForGlobalConfigurationOutputTimingSourceCStr(enumValue);
         }
 
       } // namespace GlobalConfigurationOutputTimingSourceMapper
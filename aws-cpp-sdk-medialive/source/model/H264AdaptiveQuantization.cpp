@@ -30,40 +30,65 @@ namespace Aws
       namespace H264AdaptiveQuantizationMapper
       {
 
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int HIGHER_HASH = HashingUtils::HashString("HIGHER");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int MAX_HASH = HashingUtils::HashString("MAX");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HIGH",
+          "HIGHER",
+          "LOW",
+          "MAX",
+          "MEDIUM",
+          "OFF",
+        };
 
         H264AdaptiveQuantization GetH264AdaptiveQuantizationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HIGH_HASH)
-          {
-            return H264AdaptiveQuantization::HIGH;
-          }
-          else if (hashCode == HIGHER_HASH)
-          {
-            return H264AdaptiveQuantization::HIGHER;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return H264AdaptiveQuantization::LOW;
-          }
-          else if (hashCode == MAX_HASH)
-          {
-            return H264AdaptiveQuantization::MAX;
-          }
-          else if (hashCode == MEDIUM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264AdaptiveQuantization::MEDIUM;
-          }
-          else if (hashCode == OFF_HASH)
-          {
-            return H264AdaptiveQuantization::OFF;
+          case 2217378:
+            if (name == "HIGH")
+            {
+              return H264AdaptiveQuantization::HIGH;
+            }
+            break;
+          case 2130902479:
+            if (name == "HIGHER")
+            {
+              return H264AdaptiveQuantization::HIGHER;
+            }
+            break;
+          case 75572:
+            if (name == "LOW")
+            {
+              return H264AdaptiveQuantization::LOW;
+            }
+            break;
+          case 76100:
+            if (name == "MAX")
+            {
+              return H264AdaptiveQuantization::MAX;
+            }
+            break;
+          case -2024701067:
+            if (name == "MEDIUM")
+            {
+              return H264AdaptiveQuantization::MEDIUM;
+            }
+            break;
+          case 78159:
+            if (name == "OFF")
+            {
+              return H264AdaptiveQuantization::OFF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return H264AdaptiveQuantization::NOT_SET;
         }
 
-        Aws::String GetNameForH264AdaptiveQuantization(H264AdaptiveQuantization enumValue)
+        const char* GetNameForH264AdaptiveQuantizationCStr(H264AdaptiveQuantization enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264AdaptiveQuantization::HIGH:
-            return "HIGH";
-          case H264AdaptiveQuantization::HIGHER:
-            return "HIGHER";
-          case H264AdaptiveQuantization::LOW:
-            return "LOW";
-          case H264AdaptiveQuantization::MAX:
-            return "MAX";
-          case H264AdaptiveQuantization::MEDIUM:
-            return "MEDIUM";
-          case H264AdaptiveQuantization::OFF:
-            return "OFF";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264AdaptiveQuantization(H264AdaptiveQuantization enumValue)
+        {
+          return GetNameForH264AdaptiveQuantizationCStr(enumValue);
         }
 
       } // namespace H264AdaptiveQuantizationMapper
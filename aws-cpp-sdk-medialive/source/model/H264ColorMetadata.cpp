@@ -30,20 +30,37 @@ namespace Aws
       namespace H264ColorMetadataMapper
       {
 
-        static const int IGNORE_HASH = HashingUtils::HashString("IGNORE");
-        static const int INSERT_HASH = HashingUtils::HashString("INSERT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IGNORE",
+          "INSERT",
+        };
 
         H264ColorMetadata GetH264ColorMetadataForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IGNORE_HASH)
-          {
-            return H264ColorMetadata::IGNORE;
-          }
-          else if (hashCode == INSERT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264ColorMetadata::INSERT;
+          case -2137067054:
+            if (name == "IGNORE")
+            {
+              return H264ColorMetadata::IGNORE;
+            }
+            break;
+          case -2130463047:
+            if (name == "INSERT")
+            {
+              return H264ColorMetadata::INSERT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264ColorMetadata::NOT_SET;
         }
 
-        Aws::String GetNameForH264ColorMetadata(H264ColorMetadata enumValue)
+        const char* GetNameForH264ColorMetadataCStr(H264ColorMetadata enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264ColorMetadata::IGNORE:
-            return "IGNORE";
-          case H264ColorMetadata::INSERT:
-            return "INSERT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264ColorMetadata(H264ColorMetadata enumValue)
+        {
+          return GetNameForH264ColorMetadataCStr(enumValue);
         }
 
       } // namespace H264ColorMetadataMapper
@@ -30,95 +30,142 @@ namespace Aws
       namespace H264LevelMapper
       {
 
-        static const int H264_LEVEL_1_HASH = HashingUtils::HashString("H264_LEVEL_1");
-        static const int H264_LEVEL_1_1_HASH = HashingUtils::HashString("H264_LEVEL_1_1");
-        static const int H264_LEVEL_1_2_HASH = HashingUtils::HashString("H264_LEVEL_1_2");
-        static const int H264_LEVEL_1_3_HASH = HashingUtils::HashString("H264_LEVEL_1_3");
-        static const int H264_LEVEL_2_HASH = HashingUtils::HashString("H264_LEVEL_2");
-        static const int H264_LEVEL_2_1_HASH = HashingUtils::HashString("H264_LEVEL_2_1");
-        static const int H264_LEVEL_2_2_HASH = HashingUtils::HashString("H264_LEVEL_2_2");
-        static const int H264_LEVEL_3_HASH = HashingUtils::HashString("H264_LEVEL_3");
-        static const int H264_LEVEL_3_1_HASH = HashingUtils::HashString("H264_LEVEL_3_1");
-        static const int H264_LEVEL_3_2_HASH = HashingUtils::HashString("H264_LEVEL_3_2");
-        static const int H264_LEVEL_4_HASH = HashingUtils::HashString("H264_LEVEL_4");
-        static const int H264_LEVEL_4_1_HASH = HashingUtils::HashString("H264_LEVEL_4_1");
-        static const int H264_LEVEL_4_2_HASH = HashingUtils::HashString("H264_LEVEL_4_2");
-        static const int H264_LEVEL_5_HASH = HashingUtils::HashString("H264_LEVEL_5");
-        static const int H264_LEVEL_5_1_HASH = HashingUtils::HashString("H264_LEVEL_5_1");
-        static const int H264_LEVEL_5_2_HASH = HashingUtils::HashString("H264_LEVEL_5_2");
-        static const int H264_LEVEL_AUTO_HASH = HashingUtils::HashString("H264_LEVEL_AUTO");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "H264_LEVEL_1",
+          "H264_LEVEL_1_1",
+          "H264_LEVEL_1_2",
+          "H264_LEVEL_1_3",
+          "H264_LEVEL_2",
+          "H264_LEVEL_2_1",
+          "H264_LEVEL_2_2",
+          "H264_LEVEL_3",
+          "H264_LEVEL_3_1",
+          "H264_LEVEL_3_2",
+          "H264_LEVEL_4",
+          "H264_LEVEL_4_1",
+          "H264_LEVEL_4_2",
+          "H264_LEVEL_5",
+          "H264_LEVEL_5_1",
+          "H264_LEVEL_5_2",
+          "H264_LEVEL_AUTO",
+        };
 
         H264Level GetH264LevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == H264_LEVEL_1_HASH)
-          {
-            return H264Level::H264_LEVEL_1;
-          }
-          else if (hashCode == H264_LEVEL_1_1_HASH)
-          {
-            return H264Level::H264_LEVEL_1_1;
-          }
-          else if (hashCode == H264_LEVEL_1_2_HASH)
-          {
-            return H264Level::H264_LEVEL_1_2;
-          }
-          else if (hashCode == H264_LEVEL_1_3_HASH)
-          {
-            return H264Level::H264_LEVEL_1_3;
-          }
-          else if (hashCode == H264_LEVEL_2_HASH)
-          {
-            return H264Level::H264_LEVEL_2;
-          }
-          else if (hashCode == H264_LEVEL_2_1_HASH)
-          {
-            return H264Level::H264_LEVEL_2_1;
-          }
-          else if (hashCode == H264_LEVEL_2_2_HASH)
-          {
-            return H264Level::H264_LEVEL_2_2;
-          }
-          else if (hashCode == H264_LEVEL_3_HASH)
-          {
-            return H264Level::H264_LEVEL_3;
-          }
-          else if (hashCode == H264_LEVEL_3_1_HASH)
-          {
-            return H264Level::H264_LEVEL_3_1;
-          }
-          else if (hashCode == H264_LEVEL_3_2_HASH)
-          {
-            return H264Level::H264_LEVEL_3_2;
-          }
-          else if (hashCode == H264_LEVEL_4_HASH)
-          {
-            return H264Level::H264_LEVEL_4;
-          }
-          else if (hashCode == H264_LEVEL_4_1_HASH)
-          {
-            return H264Level::H264_LEVEL_4_1;
-          }
-          else if (hashCode == H264_LEVEL_4_2_HASH)
-          {
-            return H264Level::H264_LEVEL_4_2;
-          }
-          else if (hashCode == H264_LEVEL_5_HASH)
-          {
-            return H264Level::H264_LEVEL_5;
-          }
-          else if (hashCode == H264_LEVEL_5_1_HASH)
-          {
-            return H264Level::H264_LEVEL_5_1;
-          }
-          else if (hashCode == H264_LEVEL_5_2_HASH)
-          {
-            return H264Level::H264_LEVEL_5_2;
-          }
-          else if (hashCode == H264_LEVEL_AUTO_HASH)
-          {
-            return H264Level::H264_LEVEL_AUTO;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1618353665:
+            if (name == "H264_LEVEL_1")
+            {
+              return H264Level::H264_LEVEL_1;
+            }
+            break;
+          case -459707919:
+            if (name == "H264_LEVEL_1_1")
+            {
+              return H264Level::H264_LEVEL_1_1;
+            }
+            break;
+          case -459707918:
+            if (name == "H264_LEVEL_1_2")
+            {
+              return H264Level::H264_LEVEL_1_2;
+            }
+            break;
+          case -459707917:
+            if (name == "H264_LEVEL_1_3")
+            {
+              return H264Level::H264_LEVEL_1_3;
+            }
+            break;
+          case -1618353664:
+            if (name == "H264_LEVEL_2")
+            {
+              return H264Level::H264_LEVEL_2;
+            }
+            break;
+          case -459706958:
+            if (name == "H264_LEVEL_2_1")
+            {
+              return H264Level::H264_LEVEL_2_1;
+            }
+            break;
+          case -459706957:
+            if (name == "H264_LEVEL_2_2")
+            {
+              return H264Level::H264_LEVEL_2_2;
+            }
+            break;
+          case -1618353663:
+            if (name == "H264_LEVEL_3")
+            {
+              return H264Level::H264_LEVEL_3;
+            }
+            break;
+          case -459705997:
+            if (name == "H264_LEVEL_3_1")
+            {
+              return H264Level::H264_LEVEL_3_1;
+            }
+            break;
+          case -459705996:
+            if (name == "H264_LEVEL_3_2")
+            {
+              return H264Level::H264_LEVEL_3_2;
+            }
+            break;
+          case -1618353662:
+            if (name == "H264_LEVEL_4")
+            {
+              return H264Level::H264_LEVEL_4;
+            }
+            break;
+          case -459705036:
+            if (name == "H264_LEVEL_4_1")
+            {
+              return H264Level::H264_LEVEL_4_1;
+            }
+            break;
+          case -459705035:
+            if (name == "H264_LEVEL_4_2")
+            {
+              return H264Level::H264_LEVEL_4_2;
+            }
+            break;
+          case -1618353661:
+            if (name == "H264_LEVEL_5")
+            {
+              return H264Level::H264_LEVEL_5;
+            }
+            break;
+          case -459704075:
+            if (name == "H264_LEVEL_5_1")
+            {
+              return H264Level::H264_LEVEL_5_1;
+            }
+            break;
+          case -459704074:
+            if (name == "H264_LEVEL_5_2")
+            {
+              return H264Level::H264_LEVEL_5_2;
+            }
+            break;
+          case -1365575391:
+            if (name == "H264_LEVEL_AUTO")
+            {
+              return H264Level::H264_LEVEL_AUTO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,53 +177,26 @@ namespace Aws
           return H264Level::NOT_SET;
         }
 
-        Aws::String GetNameForH264Level(H264Level enumValue)
+        const char* GetNameForH264LevelCStr(H264Level enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264Level::H264_LEVEL_1:
-            return "H264_LEVEL_1";
-          case H264Level::H264_LEVEL_1_1:
-            return "H264_LEVEL_1_1";
-          case H264Level::H264_LEVEL_1_2:
-            return "H264_LEVEL_1_2";
-          case H264Level::H264_LEVEL_1_3:
-            return "H264_LEVEL_1_3";
-          case H264Level::H264_LEVEL_2:
-            return "H264_LEVEL_2";
-          case H264Level::H264_LEVEL_2_1:
-            return "H264_LEVEL_2_1";
-          case H264Level::H264_LEVEL_2_2:
-            return "H264_LEVEL_2_2";
-          case H264Level::H264_LEVEL_3:
-            return "H264_LEVEL_3";
-          case H264Level::H264_LEVEL_3_1:
-            return "H264_LEVEL_3_1";
-          case H264Level::H264_LEVEL_3_2:
-            return "H264_LEVEL_3_2";
-          case H264Level::H264_LEVEL_4:
-            return "H264_LEVEL_4";
-          case H264Level::H264_LEVEL_4_1:
-            return "H264_LEVEL_4_1";
-          case H264Level::H264_LEVEL_4_2:
-            return "H264_LEVEL_4_2";
-          case H264Level::H264_LEVEL_5:
-            return "H264_LEVEL_5";
-          case H264Level::H264_LEVEL_5_1:
-            return "H264_LEVEL_5_1";
-          case H264Level::H264_LEVEL_5_2:
-            return "H264_LEVEL_5_2";
-          case H264Level::H264_LEVEL_AUTO:
-            return "H264_LEVEL_AUTO";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264Level(H264Level enumValue)
+        {
+          return GetNameForH264LevelCStr(enumValue);
         }
 
       } // namespace H264LevelMapper
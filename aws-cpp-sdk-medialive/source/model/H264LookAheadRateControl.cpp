@@ -30,25 +30,44 @@ namespace Aws
       namespace H264LookAheadRateControlMapper
       {
 
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HIGH",
+          "LOW",
+          "MEDIUM",
+        };
 
         H264LookAheadRateControl GetH264LookAheadRateControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HIGH_HASH)
-          {
-            return H264LookAheadRateControl::HIGH;
-          }
-          else if (hashCode == LOW_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264LookAheadRateControl::LOW;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return H264LookAheadRateControl::MEDIUM;
+          case 2217378:
+            if (name == "HIGH")
+            {
+              return H264LookAheadRateControl::HIGH;
+            }
+            break;
+          case 75572:
+            if (name == "LOW")
+            {
+              return H264LookAheadRateControl::LOW;
+            }
+            break;
+          case -2024701067:
+            if (name == "MEDIUM")
+            {
+              return H264LookAheadRateControl::MEDIUM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return H264LookAheadRateControl::NOT_SET;
         }
 
-        Aws::String GetNameForH264LookAheadRateControl(H264LookAheadRateControl enumValue)
+        const char* GetNameForH264LookAheadRateControlCStr(H264LookAheadRateControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264LookAheadRateControl::HIGH:
-            return "HIGH";
-          case H264LookAheadRateControl::LOW:
-            return "LOW";
-          case H264LookAheadRateControl::MEDIUM:
-            return "MEDIUM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264LookAheadRateControl(H264LookAheadRateControl enumValue)
+        {
+          return GetNameForH264LookAheadRateControlCStr(enumValue);
         }
 
       } // namespace H264LookAheadRateControlMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace H264ProfileMapper
       {
 
-        static const int BASELINE_HASH = HashingUtils::HashString("BASELINE");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int HIGH_10BIT_HASH = HashingUtils::HashString("HIGH_10BIT");
-        static const int HIGH_422_HASH = HashingUtils::HashString("HIGH_422");
-        static const int HIGH_422_10BIT_HASH = HashingUtils::HashString("HIGH_422_10BIT");
-        static const int MAIN_HASH = HashingUtils::HashString("MAIN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BASELINE",
+          "HIGH",
+          "HIGH_10BIT",
+          "HIGH_422",
+          "HIGH_422_10BIT",
+          "MAIN",
+        };
 
         H264Profile GetH264ProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BASELINE_HASH)
-          {
-            return H264Profile::BASELINE;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return H264Profile::HIGH;
-          }
-          else if (hashCode == HIGH_10BIT_HASH)
-          {
-            return H264Profile::HIGH_10BIT;
-          }
-          else if (hashCode == HIGH_422_HASH)
-          {
-            return H264Profile::HIGH_422;
-          }
-          else if (hashCode == HIGH_422_10BIT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264Profile::HIGH_422_10BIT;
-          }
-          else if (hashCode == MAIN_HASH)
-          {
-            return H264Profile::MAIN;
+          case -938158523:
+            if (name == "BASELINE")
+            {
+              return H264Profile::BASELINE;
+            }
+            break;
+          case 2217378:
+            if (name == "HIGH")
+            {
+              return H264Profile::HIGH;
+            }
+            break;
+          case 1363495313:
+            if (name == "HIGH_10BIT")
+            {
+              return H264Profile::HIGH_10BIT;
+            }
+            break;
+          case -901370537:
+            if (name == "HIGH_422")
+            {
+              return H264Profile::HIGH_422;
+            }
+            break;
+          case -1789639290:
+            if (name == "HIGH_422_10BIT")
+            {
+              return H264Profile::HIGH_422_10BIT;
+            }
+            break;
+          case 2358713:
+            if (name == "MAIN")
+            {
+              return H264Profile::MAIN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return H264Profile::NOT_SET;
         }
 
-        Aws::String GetNameForH264Profile(H264Profile enumValue)
+        const char* GetNameForH264ProfileCStr(H264Profile enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264Profile::BASELINE:
-            return "BASELINE";
-          case H264Profile::HIGH:
-            return "HIGH";
-          case H264Profile::HIGH_10BIT:
-            return "HIGH_10BIT";
-          case H264Profile::HIGH_422:
-            return "HIGH_422";
-          case H264Profile::HIGH_422_10BIT:
-            return "HIGH_422_10BIT";
-          case H264Profile::MAIN:
-            return "MAIN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264Profile(H264Profile enumValue)
+        {
+          return GetNameForH264ProfileCStr(enumValue);
         }
 
       } // namespace H264ProfileMapper
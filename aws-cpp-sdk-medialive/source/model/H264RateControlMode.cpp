@@ -30,25 +30,44 @@ namespace Aws
       namespace H264RateControlModeMapper
       {
 
-        static const int CBR_HASH = HashingUtils::HashString("CBR");
-        static const int QVBR_HASH = HashingUtils::HashString("QVBR");
-        static const int VBR_HASH = HashingUtils::HashString("VBR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CBR",
+          "QVBR",
+          "VBR",
+        };
 
         H264RateControlMode GetH264RateControlModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CBR_HASH)
-          {
-            return H264RateControlMode::CBR;
-          }
-          else if (hashCode == QVBR_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264RateControlMode::QVBR;
-          }
-          else if (hashCode == VBR_HASH)
-          {
-            return H264RateControlMode::VBR;
+          case 66515:
+            if (name == "CBR")
+            {
+              return H264RateControlMode::CBR;
+            }
+            break;
+          case 2497845:
+            if (name == "QVBR")
+            {
+              return H264RateControlMode::QVBR;
+            }
+            break;
+          case 84774:
+            if (name == "VBR")
+            {
+              return H264RateControlMode::VBR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return H264RateControlMode::NOT_SET;
         }
 
-        Aws::String GetNameForH264RateControlMode(H264RateControlMode enumValue)
+        const char* GetNameForH264RateControlModeCStr(H264RateControlMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264RateControlMode::CBR:
-            return "CBR";
-          case H264RateControlMode::QVBR:
-            return "QVBR";
-          case H264RateControlMode::VBR:
-            return "VBR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264RateControlMode(H264RateControlMode enumValue)
+        {
+          return GetNameForH264RateControlModeCStr(enumValue);
         }
 
       } // namespace H264RateControlModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace H264ScanTypeMapper
       {
 
-        static const int INTERLACED_HASH = HashingUtils::HashString("INTERLACED");
-        static const int PROGRESSIVE_HASH = HashingUtils::HashString("PROGRESSIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INTERLACED",
+          "PROGRESSIVE",
+        };
 
         H264ScanType GetH264ScanTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERLACED_HASH)
-          {
-            return H264ScanType::INTERLACED;
-          }
-          else if (hashCode == PROGRESSIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264ScanType::PROGRESSIVE;
+          case -1107905711:
+            if (name == "INTERLACED")
+            {
+              return H264ScanType::INTERLACED;
+            }
+            break;
+          case -1010458773:
+            if (name == "PROGRESSIVE")
+            {
+              return H264ScanType::PROGRESSIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264ScanType::NOT_SET;
         }
 
-        Aws::String GetNameForH264ScanType(H264ScanType enumValue)
+        const char* GetNameForH264ScanTypeCStr(H264ScanType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264ScanType::INTERLACED:
-            return "INTERLACED";
-          case H264ScanType::PROGRESSIVE:
-            return "PROGRESSIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264ScanType(H264ScanType enumValue)
+        {
+          return GetNameForH264ScanTypeCStr(enumValue);
         }
 
       } // namespace H264ScanTypeMapper
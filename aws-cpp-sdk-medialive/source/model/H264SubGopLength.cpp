@@ -30,20 +30,37 @@ namespace Aws
       namespace H264SubGopLengthMapper
       {
 
-        static const int DYNAMIC_HASH = HashingUtils::HashString("DYNAMIC");
-        static const int FIXED_HASH = HashingUtils::HashString("FIXED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DYNAMIC",
+          "FIXED",
+        };
 
         H264SubGopLength GetH264SubGopLengthForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DYNAMIC_HASH)
-          {
-            return H264SubGopLength::DYNAMIC;
-          }
-          else if (hashCode == FIXED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264SubGopLength::FIXED;
+          case -1452217313:
+            if (name == "DYNAMIC")
+            {
+              return H264SubGopLength::DYNAMIC;
+            }
+            break;
+          case 66907988:
+            if (name == "FIXED")
+            {
+              return H264SubGopLength::FIXED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264SubGopLength::NOT_SET;
         }
 
-        Aws::String GetNameForH264SubGopLength(H264SubGopLength enumValue)
+        const char* GetNameForH264SubGopLengthCStr(H264SubGopLength enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264SubGopLength::DYNAMIC:
-            return "DYNAMIC";
-          case H264SubGopLength::FIXED:
-            return "FIXED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264SubGopLength(H264SubGopLength enumValue)
+        {
+          return GetNameForH264SubGopLengthCStr(enumValue);
         }
 
       } // namespace H264SubGopLengthMapper
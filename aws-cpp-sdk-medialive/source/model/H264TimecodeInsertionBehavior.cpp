@@ -30,20 +30,37 @@ namespace Aws
       namespace H264TimecodeInsertionBehaviorMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int PIC_TIMING_SEI_HASH = HashingUtils::HashString("PIC_TIMING_SEI");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "PIC_TIMING_SEI",
+        };
 
         H264TimecodeInsertionBehavior GetH264TimecodeInsertionBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return H264TimecodeInsertionBehavior::DISABLED;
-          }
-          else if (hashCode == PIC_TIMING_SEI_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return H264TimecodeInsertionBehavior::PIC_TIMING_SEI;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return H264TimecodeInsertionBehavior::DISABLED;
+            }
+            break;
+          case 708155575:
+            if (name == "PIC_TIMING_SEI")
+            {
+              return H264TimecodeInsertionBehavior::PIC_TIMING_SEI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return H264TimecodeInsertionBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForH264TimecodeInsertionBehavior(H264TimecodeInsertionBehavior enumValue)
+        const char* GetNameForH264TimecodeInsertionBehaviorCStr(H264TimecodeInsertionBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case H264TimecodeInsertionBehavior::DISABLED:
-            return "DISABLED";
-          case H264TimecodeInsertionBehavior::PIC_TIMING_SEI:
-            return "PIC_TIMING_SEI";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForH264TimecodeInsertionBehavior(H264TimecodeInsertionBehavior enumValue)
+        {
+          return GetNameForH264TimecodeInsertionBehaviorCStr(enumValue);
         }
 
       } // namespace H264TimecodeInsertionBehaviorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsAkamaiHttpTransferModeMapper
       {
 
-        static const int CHUNKED_HASH = HashingUtils::HashString("CHUNKED");
-        static const int NON_CHUNKED_HASH = HashingUtils::HashString("NON_CHUNKED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CHUNKED",
+          "NON_CHUNKED",
+        };
 
         HlsAkamaiHttpTransferMode GetHlsAkamaiHttpTransferModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHUNKED_HASH)
-          {
-            return HlsAkamaiHttpTransferMode::CHUNKED;
-          }
-          else if (hashCode == NON_CHUNKED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsAkamaiHttpTransferMode::NON_CHUNKED;
+          case 1475400620:
+            if (name == "CHUNKED")
+            {
+              return HlsAkamaiHttpTransferMode::CHUNKED;
+            }
+            break;
+          case -776819686:
+            if (name == "NON_CHUNKED")
+            {
+              return HlsAkamaiHttpTransferMode::NON_CHUNKED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsAkamaiHttpTransferMode::NOT_SET;
         }
 
-        Aws::String GetNameForHlsAkamaiHttpTransferMode(HlsAkamaiHttpTransferMode enumValue)
+        const char* GetNameForHlsAkamaiHttpTransferModeCStr(HlsAkamaiHttpTransferMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsAkamaiHttpTransferMode::CHUNKED:
-            return "CHUNKED";
-          case HlsAkamaiHttpTransferMode::NON_CHUNKED:
-            return "NON_CHUNKED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsAkamaiHttpTransferMode(HlsAkamaiHttpTransferMode enumValue)
+        {
+          return GetNameForHlsAkamaiHttpTransferModeCStr(enumValue);
         }
 
       } // namespace HlsAkamaiHttpTransferModeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace HlsCaptionLanguageSettingMapper
       {
 
-        static const int INSERT_HASH = HashingUtils::HashString("INSERT");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int OMIT_HASH = HashingUtils::HashString("OMIT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INSERT",
+          "NONE",
+          "OMIT",
+        };
 
         HlsCaptionLanguageSetting GetHlsCaptionLanguageSettingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSERT_HASH)
-          {
-            return HlsCaptionLanguageSetting::INSERT;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsCaptionLanguageSetting::NONE;
-          }
-          else if (hashCode == OMIT_HASH)
-          {
-            return HlsCaptionLanguageSetting::OMIT;
+          case -2130463047:
+            if (name == "INSERT")
+            {
+              return HlsCaptionLanguageSetting::INSERT;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return HlsCaptionLanguageSetting::NONE;
+            }
+            break;
+          case 2429833:
+            if (name == "OMIT")
+            {
+              return HlsCaptionLanguageSetting::OMIT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return HlsCaptionLanguageSetting::NOT_SET;
         }
 
-        Aws::String GetNameForHlsCaptionLanguageSetting(HlsCaptionLanguageSetting enumValue)
+        const char* GetNameForHlsCaptionLanguageSettingCStr(HlsCaptionLanguageSetting enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsCaptionLanguageSetting::INSERT:
-            return "INSERT";
-          case HlsCaptionLanguageSetting::NONE:
-            return "NONE";
-          case HlsCaptionLanguageSetting::OMIT:
-            return "OMIT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsCaptionLanguageSetting(HlsCaptionLanguageSetting enumValue)
+        {
+          return GetNameForHlsCaptionLanguageSettingCStr(enumValue);
         }
 
       } // namespace HlsCaptionLanguageSettingMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsCodecSpecificationMapper
       {
 
-        static const int RFC_4281_HASH = HashingUtils::HashString("RFC_4281");
-        static const int RFC_6381_HASH = HashingUtils::HashString("RFC_6381");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RFC_4281",
+          "RFC_6381",
+        };
 
         HlsCodecSpecification GetHlsCodecSpecificationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RFC_4281_HASH)
-          {
-            return HlsCodecSpecification::RFC_4281;
-          }
-          else if (hashCode == RFC_6381_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsCodecSpecification::RFC_6381;
+          case 884761511:
+            if (name == "RFC_4281")
+            {
+              return HlsCodecSpecification::RFC_4281;
+            }
+            break;
+          case 884822054:
+            if (name == "RFC_6381")
+            {
+              return HlsCodecSpecification::RFC_6381;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsCodecSpecification::NOT_SET;
         }
 
-        Aws::String GetNameForHlsCodecSpecification(HlsCodecSpecification enumValue)
+        const char* GetNameForHlsCodecSpecificationCStr(HlsCodecSpecification enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsCodecSpecification::RFC_4281:
-            return "RFC_4281";
-          case HlsCodecSpecification::RFC_6381:
-            return "RFC_6381";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsCodecSpecification(HlsCodecSpecification enumValue)
+        {
+          return GetNameForHlsCodecSpecificationCStr(enumValue);
         }
 
       } // namespace HlsCodecSpecificationMapper
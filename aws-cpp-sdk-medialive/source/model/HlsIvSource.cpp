@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsIvSourceMapper
       {
 
-        static const int EXPLICIT_HASH = HashingUtils::HashString("EXPLICIT");
-        static const int FOLLOWS_SEGMENT_NUMBER_HASH = HashingUtils::HashString("FOLLOWS_SEGMENT_NUMBER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EXPLICIT",
+          "FOLLOWS_SEGMENT_NUMBER",
+        };
 
         HlsIvSource GetHlsIvSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXPLICIT_HASH)
-          {
-            return HlsIvSource::EXPLICIT;
-          }
-          else if (hashCode == FOLLOWS_SEGMENT_NUMBER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsIvSource::FOLLOWS_SEGMENT_NUMBER;
+          case -1146464716:
+            if (name == "EXPLICIT")
+            {
+              return HlsIvSource::EXPLICIT;
+            }
+            break;
+          case -1056464622:
+            if (name == "FOLLOWS_SEGMENT_NUMBER")
+            {
+              return HlsIvSource::FOLLOWS_SEGMENT_NUMBER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsIvSource::NOT_SET;
         }
 
-        Aws::String GetNameForHlsIvSource(HlsIvSource enumValue)
+        const char* GetNameForHlsIvSourceCStr(HlsIvSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsIvSource::EXPLICIT:
-            return "EXPLICIT";
-          case HlsIvSource::FOLLOWS_SEGMENT_NUMBER:
-            return "FOLLOWS_SEGMENT_NUMBER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsIvSource(HlsIvSource enumValue)
+        {
+          return GetNameForHlsIvSourceCStr(enumValue);
         }
 
       } // namespace HlsIvSourceMapper
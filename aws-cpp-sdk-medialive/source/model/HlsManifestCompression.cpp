@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsManifestCompressionMapper
       {
 
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GZIP",
+          "NONE",
+        };
 
         HlsManifestCompression GetHlsManifestCompressionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GZIP_HASH)
-          {
-            return HlsManifestCompression::GZIP;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsManifestCompression::NONE;
+          case 2203994:
+            if (name == "GZIP")
+            {
+              return HlsManifestCompression::GZIP;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return HlsManifestCompression::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsManifestCompression::NOT_SET;
         }
 
-        Aws::String GetNameForHlsManifestCompression(HlsManifestCompression enumValue)
+        const char* GetNameForHlsManifestCompressionCStr(HlsManifestCompression enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsManifestCompression::GZIP:
-            return "GZIP";
-          case HlsManifestCompression::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsManifestCompression(HlsManifestCompression enumValue)
+        {
+          return GetNameForHlsManifestCompressionCStr(enumValue);
         }
 
       } // namespace HlsManifestCompressionMapper
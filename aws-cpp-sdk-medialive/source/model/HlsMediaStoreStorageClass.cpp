@@ -30,15 +30,30 @@ namespace Aws
       namespace HlsMediaStoreStorageClassMapper
       {
 
-        static const int TEMPORAL_HASH = HashingUtils::HashString("TEMPORAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TEMPORAL",
+        };
 
         HlsMediaStoreStorageClass GetHlsMediaStoreStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TEMPORAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsMediaStoreStorageClass::TEMPORAL;
+          case -538814686:
+            if (name == "TEMPORAL")
+            {
+              return HlsMediaStoreStorageClass::TEMPORAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return HlsMediaStoreStorageClass::NOT_SET;
         }
 
-        Aws::String GetNameForHlsMediaStoreStorageClass(HlsMediaStoreStorageClass enumValue)
+        const char* GetNameForHlsMediaStoreStorageClassCStr(HlsMediaStoreStorageClass enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsMediaStoreStorageClass::TEMPORAL:
-            return "TEMPORAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsMediaStoreStorageClass(HlsMediaStoreStorageClass enumValue)
+        {
+          return GetNameForHlsMediaStoreStorageClassCStr(enumValue);
         }
 
       } // namespace HlsMediaStoreStorageClassMapper
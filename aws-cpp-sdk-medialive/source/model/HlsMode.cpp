@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsModeMapper
       {
 
-        static const int LIVE_HASH = HashingUtils::HashString("LIVE");
-        static const int VOD_HASH = HashingUtils::HashString("VOD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LIVE",
+          "VOD",
+        };
 
         HlsMode GetHlsModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LIVE_HASH)
-          {
-            return HlsMode::LIVE;
-          }
-          else if (hashCode == VOD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsMode::VOD;
+          case 2337004:
+            if (name == "LIVE")
+            {
+              return HlsMode::LIVE;
+            }
+            break;
+          case 85163:
+            if (name == "VOD")
+            {
+              return HlsMode::VOD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsMode::NOT_SET;
         }
 
-        Aws::String GetNameForHlsMode(HlsMode enumValue)
+        const char* GetNameForHlsModeCStr(HlsMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsMode::LIVE:
-            return "LIVE";
-          case HlsMode::VOD:
-            return "VOD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsMode(HlsMode enumValue)
+        {
+          return GetNameForHlsModeCStr(enumValue);
         }
 
       } // namespace HlsModeMapper
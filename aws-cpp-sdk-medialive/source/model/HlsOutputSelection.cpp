@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsOutputSelectionMapper
       {
 
-        static const int MANIFESTS_AND_SEGMENTS_HASH = HashingUtils::HashString("MANIFESTS_AND_SEGMENTS");
-        static const int SEGMENTS_ONLY_HASH = HashingUtils::HashString("SEGMENTS_ONLY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MANIFESTS_AND_SEGMENTS",
+          "SEGMENTS_ONLY",
+        };
 
         HlsOutputSelection GetHlsOutputSelectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MANIFESTS_AND_SEGMENTS_HASH)
-          {
-            return HlsOutputSelection::MANIFESTS_AND_SEGMENTS;
-          }
-          else if (hashCode == SEGMENTS_ONLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsOutputSelection::SEGMENTS_ONLY;
+          case 1673056643:
+            if (name == "MANIFESTS_AND_SEGMENTS")
+            {
+              return HlsOutputSelection::MANIFESTS_AND_SEGMENTS;
+            }
+            break;
+          case -1199809301:
+            if (name == "SEGMENTS_ONLY")
+            {
+              return HlsOutputSelection::SEGMENTS_ONLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsOutputSelection::NOT_SET;
         }
 
-        Aws::String GetNameForHlsOutputSelection(HlsOutputSelection enumValue)
+        const char* GetNameForHlsOutputSelectionCStr(HlsOutputSelection enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsOutputSelection::MANIFESTS_AND_SEGMENTS:
-            return "MANIFESTS_AND_SEGMENTS";
-          case HlsOutputSelection::SEGMENTS_ONLY:
-            return "SEGMENTS_ONLY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsOutputSelection(HlsOutputSelection enumValue)
+        {
+          return GetNameForHlsOutputSelectionCStr(enumValue);
         }
 
       } // namespace HlsOutputSelectionMapper
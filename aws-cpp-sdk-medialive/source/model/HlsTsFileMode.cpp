@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsTsFileModeMapper
       {
 
-        static const int SEGMENTED_FILES_HASH = HashingUtils::HashString("SEGMENTED_FILES");
-        static const int SINGLE_FILE_HASH = HashingUtils::HashString("SINGLE_FILE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SEGMENTED_FILES",
+          "SINGLE_FILE",
+        };
 
         HlsTsFileMode GetHlsTsFileModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SEGMENTED_FILES_HASH)
-          {
-            return HlsTsFileMode::SEGMENTED_FILES;
-          }
-          else if (hashCode == SINGLE_FILE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsTsFileMode::SINGLE_FILE;
+          case 1662739146:
+            if (name == "SEGMENTED_FILES")
+            {
+              return HlsTsFileMode::SEGMENTED_FILES;
+            }
+            break;
+          case 450370323:
+            if (name == "SINGLE_FILE")
+            {
+              return HlsTsFileMode::SINGLE_FILE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsTsFileMode::NOT_SET;
         }
 
-        Aws::String GetNameForHlsTsFileMode(HlsTsFileMode enumValue)
+        const char* GetNameForHlsTsFileModeCStr(HlsTsFileMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsTsFileMode::SEGMENTED_FILES:
-            return "SEGMENTED_FILES";
-          case HlsTsFileMode::SINGLE_FILE:
-            return "SINGLE_FILE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsTsFileMode(HlsTsFileMode enumValue)
+        {
+          return GetNameForHlsTsFileModeCStr(enumValue);
         }
 
       } // namespace HlsTsFileModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace HlsWebdavHttpTransferModeMapper
       {
 
-        static const int CHUNKED_HASH = HashingUtils::HashString("CHUNKED");
-        static const int NON_CHUNKED_HASH = HashingUtils::HashString("NON_CHUNKED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CHUNKED",
+          "NON_CHUNKED",
+        };
 
         HlsWebdavHttpTransferMode GetHlsWebdavHttpTransferModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHUNKED_HASH)
-          {
-            return HlsWebdavHttpTransferMode::CHUNKED;
-          }
-          else if (hashCode == NON_CHUNKED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HlsWebdavHttpTransferMode::NON_CHUNKED;
+          case 1475400620:
+            if (name == "CHUNKED")
+            {
+              return HlsWebdavHttpTransferMode::CHUNKED;
+            }
+            break;
+          case -776819686:
+            if (name == "NON_CHUNKED")
+            {
+              return HlsWebdavHttpTransferMode::NON_CHUNKED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HlsWebdavHttpTransferMode::NOT_SET;
         }
 
-        Aws::String GetNameForHlsWebdavHttpTransferMode(HlsWebdavHttpTransferMode enumValue)
+        const char* GetNameForHlsWebdavHttpTransferModeCStr(HlsWebdavHttpTransferMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HlsWebdavHttpTransferMode::CHUNKED:
-            return "CHUNKED";
-          case HlsWebdavHttpTransferMode::NON_CHUNKED:
-            return "NON_CHUNKED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHlsWebdavHttpTransferMode(HlsWebdavHttpTransferMode enumValue)
+        {
+          return GetNameForHlsWebdavHttpTransferModeCStr(enumValue);
         }
 
       } // namespace HlsWebdavHttpTransferModeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace InputCodecMapper
       {
 
-        static const int MPEG2_HASH = HashingUtils::HashString("MPEG2");
-        static const int AVC_HASH = HashingUtils::HashString("AVC");
-        static const int HEVC_HASH = HashingUtils::HashString("HEVC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MPEG2",
+          "AVC",
+          "HEVC",
+        };
 
         InputCodec GetInputCodecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MPEG2_HASH)
-          {
-            return InputCodec::MPEG2;
-          }
-          else if (hashCode == AVC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputCodec::AVC;
-          }
-          else if (hashCode == HEVC_HASH)
-          {
-            return InputCodec::HEVC;
+          case 73562957:
+            if (name == "MPEG2")
+            {
+              return InputCodec::MPEG2;
+            }
+            break;
+          case 65198:
+            if (name == "AVC")
+            {
+              return InputCodec::AVC;
+            }
+            break;
+          case 2213994:
+            if (name == "HEVC")
+            {
+              return InputCodec::HEVC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InputCodec::NOT_SET;
         }
 
-        Aws::String GetNameForInputCodec(InputCodec enumValue)
+        const char* GetNameForInputCodecCStr(InputCodec enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputCodec::MPEG2:
-            return "MPEG2";
-          case InputCodec::AVC:
-            return "AVC";
-          case InputCodec::HEVC:
-            return "HEVC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputCodec(InputCodec enumValue)
+        {
+          return GetNameForInputCodecCStr(enumValue);
         }
 
       } // namespace InputCodecMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace InputFilterMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int FORCED_HASH = HashingUtils::HashString("FORCED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTO",
+          "DISABLED",
+          "FORCED",
+        };
 
         InputFilter GetInputFilterForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
-          {
-            return InputFilter::AUTO;
-          }
-          else if (hashCode == DISABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputFilter::DISABLED;
-          }
-          else if (hashCode == FORCED_HASH)
-          {
-            return InputFilter::FORCED;
+          case 2020783:
+            if (name == "AUTO")
+            {
+              return InputFilter::AUTO;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return InputFilter::DISABLED;
+            }
+            break;
+          case 2079508185:
+            if (name == "FORCED")
+            {
+              return InputFilter::FORCED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InputFilter::NOT_SET;
         }
 
-        Aws::String GetNameForInputFilter(InputFilter enumValue)
+        const char* GetNameForInputFilterCStr(InputFilter enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputFilter::AUTO:
-            return "AUTO";
-          case InputFilter::DISABLED:
-            return "DISABLED";
-          case InputFilter::FORCED:
-            return "FORCED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputFilter(InputFilter enumValue)
+        {
+          return GetNameForInputFilterCStr(enumValue);
         }
 
       } // namespace InputFilterMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace InputLossActionForHlsOutMapper
       {
 
-        static const int EMIT_OUTPUT_HASH = HashingUtils::HashString("EMIT_OUTPUT");
-        static const int PAUSE_OUTPUT_HASH = HashingUtils::HashString("PAUSE_OUTPUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EMIT_OUTPUT",
+          "PAUSE_OUTPUT",
+        };
 
         InputLossActionForHlsOut GetInputLossActionForHlsOutForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EMIT_OUTPUT_HASH)
-          {
-            return InputLossActionForHlsOut::EMIT_OUTPUT;
-          }
-          else if (hashCode == PAUSE_OUTPUT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputLossActionForHlsOut::PAUSE_OUTPUT;
+          case 641048301:
+            if (name == "EMIT_OUTPUT")
+            {
+              return InputLossActionForHlsOut::EMIT_OUTPUT;
+            }
+            break;
+          case -1863532662:
+            if (name == "PAUSE_OUTPUT")
+            {
+              return InputLossActionForHlsOut::PAUSE_OUTPUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InputLossActionForHlsOut::NOT_SET;
         }
 
-        Aws::String GetNameForInputLossActionForHlsOut(InputLossActionForHlsOut enumValue)
+        const char* GetNameForInputLossActionForHlsOutCStr(InputLossActionForHlsOut enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputLossActionForHlsOut::EMIT_OUTPUT:
-            return "EMIT_OUTPUT";
-          case InputLossActionForHlsOut::PAUSE_OUTPUT:
-            return "PAUSE_OUTPUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputLossActionForHlsOut(InputLossActionForHlsOut enumValue)
+        {
+          return GetNameForInputLossActionForHlsOutCStr(enumValue);
         }
 
       } // namespace InputLossActionForHlsOutMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace InputLossActionForUdpOutMapper
       {
 
-        static const int DROP_PROGRAM_HASH = HashingUtils::HashString("DROP_PROGRAM");
-        static const int DROP_TS_HASH = HashingUtils::HashString("DROP_TS");
-        static const int EMIT_PROGRAM_HASH = HashingUtils::HashString("EMIT_PROGRAM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DROP_PROGRAM",
+          "DROP_TS",
+          "EMIT_PROGRAM",
+        };
 
         InputLossActionForUdpOut GetInputLossActionForUdpOutForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DROP_PROGRAM_HASH)
-          {
-            return InputLossActionForUdpOut::DROP_PROGRAM;
-          }
-          else if (hashCode == DROP_TS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputLossActionForUdpOut::DROP_TS;
-          }
-          else if (hashCode == EMIT_PROGRAM_HASH)
-          {
-            return InputLossActionForUdpOut::EMIT_PROGRAM;
+          case 426252564:
+            if (name == "DROP_PROGRAM")
+            {
+              return InputLossActionForUdpOut::DROP_PROGRAM;
+            }
+            break;
+          case -1651233329:
+            if (name == "DROP_TS")
+            {
+              return InputLossActionForUdpOut::DROP_TS;
+            }
+            break;
+          case -805612040:
+            if (name == "EMIT_PROGRAM")
+            {
+              return InputLossActionForUdpOut::EMIT_PROGRAM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InputLossActionForUdpOut::NOT_SET;
         }
 
-        Aws::String GetNameForInputLossActionForUdpOut(InputLossActionForUdpOut enumValue)
+        const char* GetNameForInputLossActionForUdpOutCStr(InputLossActionForUdpOut enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputLossActionForUdpOut::DROP_PROGRAM:
-            return "DROP_PROGRAM";
-          case InputLossActionForUdpOut::DROP_TS:
-            return "DROP_TS";
-          case InputLossActionForUdpOut::EMIT_PROGRAM:
-            return "EMIT_PROGRAM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputLossActionForUdpOut(InputLossActionForUdpOut enumValue)
+        {
+          return GetNameForInputLossActionForUdpOutCStr(enumValue);
         }
 
       } // namespace InputLossActionForUdpOutMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace InputLossImageTypeMapper
       {
 
-        static const int COLOR_HASH = HashingUtils::HashString("COLOR");
-        static const int SLATE_HASH = HashingUtils::HashString("SLATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COLOR",
+          "SLATE",
+        };
 
         InputLossImageType GetInputLossImageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COLOR_HASH)
-          {
-            return InputLossImageType::COLOR;
-          }
-          else if (hashCode == SLATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputLossImageType::SLATE;
+          case 64304963:
+            if (name == "COLOR")
+            {
+              return InputLossImageType::COLOR;
+            }
+            break;
+          case 78981497:
+            if (name == "SLATE")
+            {
+              return InputLossImageType::SLATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InputLossImageType::NOT_SET;
         }
 
-        Aws::String GetNameForInputLossImageType(InputLossImageType enumValue)
+        const char* GetNameForInputLossImageTypeCStr(InputLossImageType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputLossImageType::COLOR:
-            return "COLOR";
-          case InputLossImageType::SLATE:
-            return "SLATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputLossImageType(InputLossImageType enumValue)
+        {
+          return GetNameForInputLossImageTypeCStr(enumValue);
         }
 
       } // namespace InputLossImageTypeMapper
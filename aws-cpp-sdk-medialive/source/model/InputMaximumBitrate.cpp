@@ -30,25 +30,44 @@ namespace Aws
       namespace InputMaximumBitrateMapper
       {
 
-        static const int MAX_10_MBPS_HASH = HashingUtils::HashString("MAX_10_MBPS");
-        static const int MAX_20_MBPS_HASH = HashingUtils::HashString("MAX_20_MBPS");
-        static const int MAX_50_MBPS_HASH = HashingUtils::HashString("MAX_50_MBPS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MAX_10_MBPS",
+          "MAX_20_MBPS",
+          "MAX_50_MBPS",
+        };
 
         InputMaximumBitrate GetInputMaximumBitrateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAX_10_MBPS_HASH)
-          {
-            return InputMaximumBitrate::MAX_10_MBPS;
-          }
-          else if (hashCode == MAX_20_MBPS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputMaximumBitrate::MAX_20_MBPS;
-          }
-          else if (hashCode == MAX_50_MBPS_HASH)
-          {
-            return InputMaximumBitrate::MAX_50_MBPS;
+          case -891421571:
+            if (name == "MAX_10_MBPS")
+            {
+              return InputMaximumBitrate::MAX_10_MBPS;
+            }
+            break;
+          case -3917890:
+            if (name == "MAX_20_MBPS")
+            {
+              return InputMaximumBitrate::MAX_20_MBPS;
+            }
+            break;
+          case -1636374143:
+            if (name == "MAX_50_MBPS")
+            {
+              return InputMaximumBitrate::MAX_50_MBPS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InputMaximumBitrate::NOT_SET;
         }
 
-        Aws::String GetNameForInputMaximumBitrate(InputMaximumBitrate enumValue)
+        const char* GetNameForInputMaximumBitrateCStr(InputMaximumBitrate enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputMaximumBitrate::MAX_10_MBPS:
-            return "MAX_10_MBPS";
-          case InputMaximumBitrate::MAX_20_MBPS:
-            return "MAX_20_MBPS";
-          case InputMaximumBitrate::MAX_50_MBPS:
-            return "MAX_50_MBPS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputMaximumBitrate(InputMaximumBitrate enumValue)
+        {
+          return GetNameForInputMaximumBitrateCStr(enumValue);
         }
 
       } // namespace InputMaximumBitrateMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace InputResolutionMapper
       {
 
-        static const int SD_HASH = HashingUtils::HashString("SD");
-        static const int HD_HASH = HashingUtils::HashString("HD");
-        static const int UHD_HASH = HashingUtils::HashString("UHD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SD",
+          "HD",
+          "UHD",
+        };
 
         InputResolution GetInputResolutionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SD_HASH)
-          {
-            return InputResolution::SD;
-          }
-          else if (hashCode == HD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputResolution::HD;
-          }
-          else if (hashCode == UHD_HASH)
-          {
-            return InputResolution::UHD;
+          case 2641:
+            if (name == "SD")
+            {
+              return InputResolution::SD;
+            }
+            break;
+          case 2300:
+            if (name == "HD")
+            {
+              return InputResolution::HD;
+            }
+            break;
+          case 83985:
+            if (name == "UHD")
+            {
+              return InputResolution::UHD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InputResolution::NOT_SET;
         }
 
-        Aws::String GetNameForInputResolution(InputResolution enumValue)
+        const char* GetNameForInputResolutionCStr(InputResolution enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputResolution::SD:
-            return "SD";
-          case InputResolution::HD:
-            return "HD";
-          case InputResolution::UHD:
-            return "UHD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputResolution(InputResolution enumValue)
+        {
+          return GetNameForInputResolutionCStr(enumValue);
         }
 
       } // namespace InputResolutionMapper
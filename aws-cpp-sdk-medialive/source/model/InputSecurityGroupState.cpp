@@ -30,30 +30,51 @@ namespace Aws
       namespace InputSecurityGroupStateMapper
       {
 
-        static const int IDLE_HASH = HashingUtils::HashString("IDLE");
-        static const int IN_USE_HASH = HashingUtils::HashString("IN_USE");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IDLE",
+          "IN_USE",
+          "UPDATING",
+          "DELETED",
+        };
 
         InputSecurityGroupState GetInputSecurityGroupStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IDLE_HASH)
-          {
-            return InputSecurityGroupState::IDLE;
-          }
-          else if (hashCode == IN_USE_HASH)
-          {
-            return InputSecurityGroupState::IN_USE;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return InputSecurityGroupState::UPDATING;
-          }
-          else if (hashCode == DELETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputSecurityGroupState::DELETED;
+          case 2242516:
+            if (name == "IDLE")
+            {
+              return InputSecurityGroupState::IDLE;
+            }
+            break;
+          case -2130090163:
+            if (name == "IN_USE")
+            {
+              return InputSecurityGroupState::IN_USE;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return InputSecurityGroupState::UPDATING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return InputSecurityGroupState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return InputSecurityGroupState::NOT_SET;
         }
 
-        Aws::String GetNameForInputSecurityGroupState(InputSecurityGroupState enumValue)
+        const char* GetNameForInputSecurityGroupStateCStr(InputSecurityGroupState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputSecurityGroupState::IDLE:
-            return "IDLE";
-          case InputSecurityGroupState::IN_USE:
-            return "IN_USE";
-          case InputSecurityGroupState::UPDATING:
-            return "UPDATING";
-          case InputSecurityGroupState::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputSecurityGroupState(InputSecurityGroupState enumValue)
+        {
+          return GetNameForInputSecurityGroupStateCStr(enumValue);
         }
 
       } // namespace InputSecurityGroupStateMapper
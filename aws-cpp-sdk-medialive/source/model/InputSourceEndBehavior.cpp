@@ -30,20 +30,37 @@ namespace Aws
       namespace InputSourceEndBehaviorMapper
       {
 
-        static const int CONTINUE_HASH = HashingUtils::HashString("CONTINUE");
-        static const int LOOP_HASH = HashingUtils::HashString("LOOP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONTINUE",
+          "LOOP",
+        };
 
         InputSourceEndBehavior GetInputSourceEndBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONTINUE_HASH)
-          {
-            return InputSourceEndBehavior::CONTINUE;
-          }
-          else if (hashCode == LOOP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputSourceEndBehavior::LOOP;
+          case 215424167:
+            if (name == "CONTINUE")
+            {
+              return InputSourceEndBehavior::CONTINUE;
+            }
+            break;
+          case 2342564:
+            if (name == "LOOP")
+            {
+              return InputSourceEndBehavior::LOOP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InputSourceEndBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForInputSourceEndBehavior(InputSourceEndBehavior enumValue)
+        const char* GetNameForInputSourceEndBehaviorCStr(InputSourceEndBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputSourceEndBehavior::CONTINUE:
-            return "CONTINUE";
-          case InputSourceEndBehavior::LOOP:
-            return "LOOP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputSourceEndBehavior(InputSourceEndBehavior enumValue)
+        {
+          return GetNameForInputSourceEndBehaviorCStr(enumValue);
         }
 
       } // namespace InputSourceEndBehaviorMapper
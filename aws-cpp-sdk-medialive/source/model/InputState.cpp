@@ -30,35 +30,58 @@ namespace Aws
       namespace InputStateMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DETACHED_HASH = HashingUtils::HashString("DETACHED");
-        static const int ATTACHED_HASH = HashingUtils::HashString("ATTACHED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "DETACHED",
+          "ATTACHED",
+          "DELETING",
+          "DELETED",
+        };
 
         InputState GetInputStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputState::CREATING;
-          }
-          else if (hashCode == DETACHED_HASH)
-          {
-            return InputState::DETACHED;
-          }
-          else if (hashCode == ATTACHED_HASH)
-          {
-            return InputState::ATTACHED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return InputState::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return InputState::DELETED;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return InputState::CREATING;
+            }
+            break;
+          case 1827175282:
+            if (name == "DETACHED")
+            {
+              return InputState::DETACHED;
+            }
+            break;
+          case 1321364900:
+            if (name == "ATTACHED")
+            {
+              return InputState::ATTACHED;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return InputState::DELETING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return InputState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return InputState::NOT_SET;
         }
 
-        Aws::String GetNameForInputState(InputState enumValue)
+        const char* GetNameForInputStateCStr(InputState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputState::CREATING:
-            return "CREATING";
-          case InputState::DETACHED:
-            return "DETACHED";
-          case InputState::ATTACHED:
-            return "ATTACHED";
-          case InputState::DELETING:
-            return "DELETING";
-          case InputState::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputState(InputState enumValue)
+        {
+          return GetNameForInputStateCStr(enumValue);
         }
 
       } // namespace InputStateMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace InputTypeMapper
       {
 
-        static const int UDP_PUSH_HASH = HashingUtils::HashString("UDP_PUSH");
-        static const int RTP_PUSH_HASH = HashingUtils::HashString("RTP_PUSH");
-        static const int RTMP_PUSH_HASH = HashingUtils::HashString("RTMP_PUSH");
-        static const int RTMP_PULL_HASH = HashingUtils::HashString("RTMP_PULL");
-        static const int URL_PULL_HASH = HashingUtils::HashString("URL_PULL");
-        static const int MP4_FILE_HASH = HashingUtils::HashString("MP4_FILE");
-        static const int MEDIACONNECT_HASH = HashingUtils::HashString("MEDIACONNECT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UDP_PUSH",
+          "RTP_PUSH",
+          "RTMP_PUSH",
+          "RTMP_PULL",
+          "URL_PULL",
+          "MP4_FILE",
+          "MEDIACONNECT",
+        };
 
         InputType GetInputTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UDP_PUSH_HASH)
-          {
-            return InputType::UDP_PUSH;
-          }
-          else if (hashCode == RTP_PUSH_HASH)
-          {
-            return InputType::RTP_PUSH;
-          }
-          else if (hashCode == RTMP_PUSH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InputType::RTMP_PUSH;
-          }
-          else if (hashCode == RTMP_PULL_HASH)
-          {
-            return InputType::RTMP_PULL;
-          }
-          else if (hashCode == URL_PULL_HASH)
-          {
-            return InputType::URL_PULL;
-          }
-          else if (hashCode == MP4_FILE_HASH)
-          {
-            return InputType::MP4_FILE;
-          }
-          else if (hashCode == MEDIACONNECT_HASH)
-          {
-            return InputType::MEDIACONNECT;
+          case 416265464:
+            if (name == "UDP_PUSH")
+            {
+              return InputType::UDP_PUSH;
+            }
+            break;
+          case 797958763:
+            if (name == "RTP_PUSH")
+            {
+              return InputType::RTP_PUSH;
+            }
+            break;
+          case 183643060:
+            if (name == "RTMP_PUSH")
+            {
+              return InputType::RTMP_PUSH;
+            }
+            break;
+          case 183642847:
+            if (name == "RTMP_PULL")
+            {
+              return InputType::RTMP_PULL;
+            }
+            break;
+          case -158101707:
+            if (name == "URL_PULL")
+            {
+              return InputType::URL_PULL;
+            }
+            break;
+          case 616868362:
+            if (name == "MP4_FILE")
+            {
+              return InputType::MP4_FILE;
+            }
+            break;
+          case 1623525510:
+            if (name == "MEDIACONNECT")
+            {
+              return InputType::MEDIACONNECT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return InputType::NOT_SET;
         }
 
-        Aws::String GetNameForInputType(InputType enumValue)
+        const char* GetNameForInputTypeCStr(InputType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InputType::UDP_PUSH:
-            return "UDP_PUSH";
-          case InputType::RTP_PUSH:
-            return "RTP_PUSH";
-          case InputType::RTMP_PUSH:
-            return "RTMP_PUSH";
-          case InputType::RTMP_PULL:
-            return "RTMP_PULL";
-          case InputType::URL_PULL:
-            return "URL_PULL";
-          case InputType::MP4_FILE:
-            return "MP4_FILE";
-          case InputType::MEDIACONNECT:
-            return "MEDIACONNECT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInputType(InputType enumValue)
+        {
+          return GetNameForInputTypeCStr(enumValue);
         }
 
       } // namespace InputTypeMapper
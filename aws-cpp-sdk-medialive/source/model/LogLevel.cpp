@@ -30,35 +30,58 @@ namespace Aws
       namespace LogLevelMapper
       {
 
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int WARNING_HASH = HashingUtils::HashString("WARNING");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ERROR",
+          "WARNING",
+          "INFO",
+          "DEBUG",
+          "DISABLED",
+        };
 
         LogLevel GetLogLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ERROR__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LogLevel::ERROR_;
-          }
-          else if (hashCode == WARNING_HASH)
-          {
-            return LogLevel::WARNING;
-          }
-          else if (hashCode == INFO_HASH)
-          {
-            return LogLevel::INFO;
-          }
-          else if (hashCode == DEBUG__HASH)
-          {
-            return LogLevel::DEBUG_;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return LogLevel::DISABLED;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return LogLevel::ERROR_;
+            }
+            break;
+          case 1842428796:
+            if (name == "WARNING")
+            {
+              return LogLevel::WARNING;
+            }
+            break;
+          case 2251950:
+            if (name == "INFO")
+            {
+              return LogLevel::INFO;
+            }
+            break;
+          case 64921139:
+            if (name == "DEBUG")
+            {
+              return LogLevel::DEBUG_;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return LogLevel::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return LogLevel::NOT_SET;
         }
 
-        Aws::String GetNameForLogLevel(LogLevel enumValue)
+        const char* GetNameForLogLevelCStr(LogLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LogLevel::ERROR_:
-            return "ERROR";
-          case LogLevel::WARNING:
-            return "WARNING";
-          case LogLevel::INFO:
-            return "INFO";
-          case LogLevel::DEBUG_:
-            return "DEBUG";
-          case LogLevel::DISABLED:
-            return "DISABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLogLevel(LogLevel enumValue)
+        {
+          return GetNameForLogLevelCStr(enumValue);
         }
 
       } // namespace LogLevelMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsAbsentInputAudioBehaviorMapper
       {
 
-        static const int DROP_HASH = HashingUtils::HashString("DROP");
-        static const int ENCODE_SILENCE_HASH = HashingUtils::HashString("ENCODE_SILENCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DROP",
+          "ENCODE_SILENCE",
+        };
 
         M2tsAbsentInputAudioBehavior GetM2tsAbsentInputAudioBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DROP_HASH)
-          {
-            return M2tsAbsentInputAudioBehavior::DROP;
-          }
-          else if (hashCode == ENCODE_SILENCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsAbsentInputAudioBehavior::ENCODE_SILENCE;
+          case 2107119:
+            if (name == "DROP")
+            {
+              return M2tsAbsentInputAudioBehavior::DROP;
+            }
+            break;
+          case -1865489576:
+            if (name == "ENCODE_SILENCE")
+            {
+              return M2tsAbsentInputAudioBehavior::ENCODE_SILENCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsAbsentInputAudioBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsAbsentInputAudioBehavior(M2tsAbsentInputAudioBehavior enumValue)
+        const char* GetNameForM2tsAbsentInputAudioBehaviorCStr(M2tsAbsentInputAudioBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsAbsentInputAudioBehavior::DROP:
-            return "DROP";
-          case M2tsAbsentInputAudioBehavior::ENCODE_SILENCE:
-            return "ENCODE_SILENCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsAbsentInputAudioBehavior(M2tsAbsentInputAudioBehavior enumValue)
+        {
+          return GetNameForM2tsAbsentInputAudioBehaviorCStr(enumValue);
         }
 
       } // namespace M2tsAbsentInputAudioBehaviorMapper
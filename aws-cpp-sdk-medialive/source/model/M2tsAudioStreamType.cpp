@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsAudioStreamTypeMapper
       {
 
-        static const int ATSC_HASH = HashingUtils::HashString("ATSC");
-        static const int DVB_HASH = HashingUtils::HashString("DVB");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ATSC",
+          "DVB",
+        };
 
         M2tsAudioStreamType GetM2tsAudioStreamTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ATSC_HASH)
-          {
-            return M2tsAudioStreamType::ATSC;
-          }
-          else if (hashCode == DVB_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsAudioStreamType::DVB;
+          case 2019779:
+            if (name == "ATSC")
+            {
+              return M2tsAudioStreamType::ATSC;
+            }
+            break;
+          case 68080:
+            if (name == "DVB")
+            {
+              return M2tsAudioStreamType::DVB;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsAudioStreamType::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsAudioStreamType(M2tsAudioStreamType enumValue)
+        const char* GetNameForM2tsAudioStreamTypeCStr(M2tsAudioStreamType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsAudioStreamType::ATSC:
-            return "ATSC";
-          case M2tsAudioStreamType::DVB:
-            return "DVB";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsAudioStreamType(M2tsAudioStreamType enumValue)
+        {
+          return GetNameForM2tsAudioStreamTypeCStr(enumValue);
         }
 
       } // namespace M2tsAudioStreamTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsBufferModelMapper
       {
 
-        static const int MULTIPLEX_HASH = HashingUtils::HashString("MULTIPLEX");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MULTIPLEX",
+          "NONE",
+        };
 
         M2tsBufferModel GetM2tsBufferModelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MULTIPLEX_HASH)
-          {
-            return M2tsBufferModel::MULTIPLEX;
-          }
-          else if (hashCode == NONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsBufferModel::NONE;
+          case 1580477512:
+            if (name == "MULTIPLEX")
+            {
+              return M2tsBufferModel::MULTIPLEX;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return M2tsBufferModel::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsBufferModel::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsBufferModel(M2tsBufferModel enumValue)
+        const char* GetNameForM2tsBufferModelCStr(M2tsBufferModel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsBufferModel::MULTIPLEX:
-            return "MULTIPLEX";
-          case M2tsBufferModel::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsBufferModel(M2tsBufferModel enumValue)
+        {
+          return GetNameForM2tsBufferModelCStr(enumValue);
         }
 
       } // namespace M2tsBufferModelMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsEbifControlMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "PASSTHROUGH",
+        };
 
         M2tsEbifControl GetM2tsEbifControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return M2tsEbifControl::NONE;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsEbifControl::PASSTHROUGH;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return M2tsEbifControl::NONE;
+            }
+            break;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return M2tsEbifControl::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsEbifControl::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsEbifControl(M2tsEbifControl enumValue)
+        const char* GetNameForM2tsEbifControlCStr(M2tsEbifControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsEbifControl::NONE:
-            return "NONE";
-          case M2tsEbifControl::PASSTHROUGH:
-            return "PASSTHROUGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsEbifControl(M2tsEbifControl enumValue)
+        {
+          return GetNameForM2tsEbifControlCStr(enumValue);
         }
 
       } // namespace M2tsEbifControlMapper
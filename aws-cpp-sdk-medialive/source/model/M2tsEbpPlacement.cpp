@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsEbpPlacementMapper
       {
 
-        static const int VIDEO_AND_AUDIO_PIDS_HASH = HashingUtils::HashString("VIDEO_AND_AUDIO_PIDS");
-        static const int VIDEO_PID_HASH = HashingUtils::HashString("VIDEO_PID");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VIDEO_AND_AUDIO_PIDS",
+          "VIDEO_PID",
+        };
 
         M2tsEbpPlacement GetM2tsEbpPlacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VIDEO_AND_AUDIO_PIDS_HASH)
-          {
-            return M2tsEbpPlacement::VIDEO_AND_AUDIO_PIDS;
-          }
-          else if (hashCode == VIDEO_PID_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsEbpPlacement::VIDEO_PID;
+          case 725323549:
+            if (name == "VIDEO_AND_AUDIO_PIDS")
+            {
+              return M2tsEbpPlacement::VIDEO_AND_AUDIO_PIDS;
+            }
+            break;
+          case -174138489:
+            if (name == "VIDEO_PID")
+            {
+              return M2tsEbpPlacement::VIDEO_PID;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsEbpPlacement::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsEbpPlacement(M2tsEbpPlacement enumValue)
+        const char* GetNameForM2tsEbpPlacementCStr(M2tsEbpPlacement enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsEbpPlacement::VIDEO_AND_AUDIO_PIDS:
-            return "VIDEO_AND_AUDIO_PIDS";
-          case M2tsEbpPlacement::VIDEO_PID:
-            return "VIDEO_PID";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsEbpPlacement(M2tsEbpPlacement enumValue)
+        {
+          return GetNameForM2tsEbpPlacementCStr(enumValue);
         }
 
       } // namespace M2tsEbpPlacementMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsKlvMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "PASSTHROUGH",
+        };
 
         M2tsKlv GetM2tsKlvForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return M2tsKlv::NONE;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsKlv::PASSTHROUGH;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return M2tsKlv::NONE;
+            }
+            break;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return M2tsKlv::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsKlv::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsKlv(M2tsKlv enumValue)
+        const char* GetNameForM2tsKlvCStr(M2tsKlv enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsKlv::NONE:
-            return "NONE";
-          case M2tsKlv::PASSTHROUGH:
-            return "PASSTHROUGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsKlv(M2tsKlv enumValue)
+        {
+          return GetNameForM2tsKlvCStr(enumValue);
         }
 
       } // namespace M2tsKlvMapper
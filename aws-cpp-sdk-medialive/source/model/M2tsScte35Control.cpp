@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsScte35ControlMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "PASSTHROUGH",
+        };
 
         M2tsScte35Control GetM2tsScte35ControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return M2tsScte35Control::NONE;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsScte35Control::PASSTHROUGH;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return M2tsScte35Control::NONE;
+            }
+            break;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return M2tsScte35Control::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsScte35Control::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsScte35Control(M2tsScte35Control enumValue)
+        const char* GetNameForM2tsScte35ControlCStr(M2tsScte35Control enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsScte35Control::NONE:
-            return "NONE";
-          case M2tsScte35Control::PASSTHROUGH:
-            return "PASSTHROUGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsScte35Control(M2tsScte35Control enumValue)
+        {
+          return GetNameForM2tsScte35ControlCStr(enumValue);
         }
 
       } // namespace M2tsScte35ControlMapper
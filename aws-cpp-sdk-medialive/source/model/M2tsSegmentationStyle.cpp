@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsSegmentationStyleMapper
       {
 
-        static const int MAINTAIN_CADENCE_HASH = HashingUtils::HashString("MAINTAIN_CADENCE");
-        static const int RESET_CADENCE_HASH = HashingUtils::HashString("RESET_CADENCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MAINTAIN_CADENCE",
+          "RESET_CADENCE",
+        };
 
         M2tsSegmentationStyle GetM2tsSegmentationStyleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAINTAIN_CADENCE_HASH)
-          {
-            return M2tsSegmentationStyle::MAINTAIN_CADENCE;
-          }
-          else if (hashCode == RESET_CADENCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsSegmentationStyle::RESET_CADENCE;
+          case -1082008387:
+            if (name == "MAINTAIN_CADENCE")
+            {
+              return M2tsSegmentationStyle::MAINTAIN_CADENCE;
+            }
+            break;
+          case 349861985:
+            if (name == "RESET_CADENCE")
+            {
+              return M2tsSegmentationStyle::RESET_CADENCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsSegmentationStyle::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsSegmentationStyle(M2tsSegmentationStyle enumValue)
+        const char* GetNameForM2tsSegmentationStyleCStr(M2tsSegmentationStyle enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsSegmentationStyle::MAINTAIN_CADENCE:
-            return "MAINTAIN_CADENCE";
-          case M2tsSegmentationStyle::RESET_CADENCE:
-            return "RESET_CADENCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsSegmentationStyle(M2tsSegmentationStyle enumValue)
+        {
+          return GetNameForM2tsSegmentationStyleCStr(enumValue);
         }
 
       } // namespace M2tsSegmentationStyleMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace M2tsTimedMetadataBehaviorMapper
       {
 
-        static const int NO_PASSTHROUGH_HASH = HashingUtils::HashString("NO_PASSTHROUGH");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NO_PASSTHROUGH",
+          "PASSTHROUGH",
+        };
 
         M2tsTimedMetadataBehavior GetM2tsTimedMetadataBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_PASSTHROUGH_HASH)
-          {
-            return M2tsTimedMetadataBehavior::NO_PASSTHROUGH;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M2tsTimedMetadataBehavior::PASSTHROUGH;
+          case 1884226550:
+            if (name == "NO_PASSTHROUGH")
+            {
+              return M2tsTimedMetadataBehavior::NO_PASSTHROUGH;
+            }
+            break;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return M2tsTimedMetadataBehavior::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M2tsTimedMetadataBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsTimedMetadataBehavior(M2tsTimedMetadataBehavior enumValue)
+        const char* GetNameForM2tsTimedMetadataBehaviorCStr(M2tsTimedMetadataBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M2tsTimedMetadataBehavior::NO_PASSTHROUGH:
-            return "NO_PASSTHROUGH";
-          case M2tsTimedMetadataBehavior::PASSTHROUGH:
-            return "PASSTHROUGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM2tsTimedMetadataBehavior(M2tsTimedMetadataBehavior enumValue)
+        {
+          return GetNameForM2tsTimedMetadataBehaviorCStr(enumValue);
         }
 
       } // namespace M2tsTimedMetadataBehaviorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace M3u8TimedMetadataBehaviorMapper
       {
 
-        static const int NO_PASSTHROUGH_HASH = HashingUtils::HashString("NO_PASSTHROUGH");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NO_PASSTHROUGH",
+          "PASSTHROUGH",
+        };
 
         M3u8TimedMetadataBehavior GetM3u8TimedMetadataBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_PASSTHROUGH_HASH)
-          {
-            return M3u8TimedMetadataBehavior::NO_PASSTHROUGH;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return M3u8TimedMetadataBehavior::PASSTHROUGH;
+          case 1884226550:
+            if (name == "NO_PASSTHROUGH")
+            {
+              return M3u8TimedMetadataBehavior::NO_PASSTHROUGH;
+            }
+            break;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return M3u8TimedMetadataBehavior::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return M3u8TimedMetadataBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForM3u8TimedMetadataBehavior(M3u8TimedMetadataBehavior enumValue)
+        const char* GetNameForM3u8TimedMetadataBehaviorCStr(M3u8TimedMetadataBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case M3u8TimedMetadataBehavior::NO_PASSTHROUGH:
-            return "NO_PASSTHROUGH";
-          case M3u8TimedMetadataBehavior::PASSTHROUGH:
-            return "PASSTHROUGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForM3u8TimedMetadataBehavior(M3u8TimedMetadataBehavior enumValue)
+        {
+          return GetNameForM3u8TimedMetadataBehaviorCStr(enumValue);
         }
 
       } // namespace M3u8TimedMetadataBehaviorMapper
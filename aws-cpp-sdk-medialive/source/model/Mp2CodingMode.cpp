@@ -30,20 +30,37 @@ namespace Aws
       namespace Mp2CodingModeMapper
       {
 
-        static const int CODING_MODE_1_0_HASH = HashingUtils::HashString("CODING_MODE_1_0");
-        static const int CODING_MODE_2_0_HASH = HashingUtils::HashString("CODING_MODE_2_0");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CODING_MODE_1_0",
+          "CODING_MODE_2_0",
+        };
 
         Mp2CodingMode GetMp2CodingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CODING_MODE_1_0_HASH)
-          {
-            return Mp2CodingMode::CODING_MODE_1_0;
-          }
-          else if (hashCode == CODING_MODE_2_0_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mp2CodingMode::CODING_MODE_2_0;
+          case -242316229:
+            if (name == "CODING_MODE_1_0")
+            {
+              return Mp2CodingMode::CODING_MODE_1_0;
+            }
+            break;
+          case -242315268:
+            if (name == "CODING_MODE_2_0")
+            {
+              return Mp2CodingMode::CODING_MODE_2_0;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Mp2CodingMode::NOT_SET;
         }
 
-        Aws::String GetNameForMp2CodingMode(Mp2CodingMode enumValue)
+        const char* GetNameForMp2CodingModeCStr(Mp2CodingMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mp2CodingMode::CODING_MODE_1_0:
-            return "CODING_MODE_1_0";
-          case Mp2CodingMode::CODING_MODE_2_0:
-            return "CODING_MODE_2_0";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMp2CodingMode(Mp2CodingMode enumValue)
+        {
+          return GetNameForMp2CodingModeCStr(enumValue);
         }
 
       } // namespace Mp2CodingModeMapper
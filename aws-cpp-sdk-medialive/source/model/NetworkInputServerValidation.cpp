@@ -30,20 +30,37 @@ namespace Aws
       namespace NetworkInputServerValidationMapper
       {
 
-        static const int CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME_HASH = HashingUtils::HashString("CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME");
-        static const int CHECK_CRYPTOGRAPHY_ONLY_HASH = HashingUtils::HashString("CHECK_CRYPTOGRAPHY_ONLY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME",
+          "CHECK_CRYPTOGRAPHY_ONLY",
+        };
 
         NetworkInputServerValidation GetNetworkInputServerValidationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME_HASH)
-          {
-            return NetworkInputServerValidation::CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME;
-          }
-          else if (hashCode == CHECK_CRYPTOGRAPHY_ONLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NetworkInputServerValidation::CHECK_CRYPTOGRAPHY_ONLY;
+          case -1557914320:
+            if (name == "CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME")
+            {
+              return NetworkInputServerValidation::CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME;
+            }
+            break;
+          case 1870758792:
+            if (name == "CHECK_CRYPTOGRAPHY_ONLY")
+            {
+              return NetworkInputServerValidation::CHECK_CRYPTOGRAPHY_ONLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return NetworkInputServerValidation::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkInputServerValidation(NetworkInputServerValidation enumValue)
+        const char* GetNameForNetworkInputServerValidationCStr(NetworkInputServerValidation enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NetworkInputServerValidation::CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME:
-            return "CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME";
-          case NetworkInputServerValidation::CHECK_CRYPTOGRAPHY_ONLY:
-            return "CHECK_CRYPTOGRAPHY_ONLY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNetworkInputServerValidation(NetworkInputServerValidation enumValue)
+        {
+          return GetNameForNetworkInputServerValidationCStr(enumValue);
         }
 
       } // namespace NetworkInputServerValidationMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace OfferingDurationUnitsMapper
       {
 
-        static const int MONTHS_HASH = HashingUtils::HashString("MONTHS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MONTHS",
+        };
 
         OfferingDurationUnits GetOfferingDurationUnitsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MONTHS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OfferingDurationUnits::MONTHS;
+          case -2015157773:
+            if (name == "MONTHS")
+            {
+              return OfferingDurationUnits::MONTHS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return OfferingDurationUnits::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingDurationUnits(OfferingDurationUnits enumValue)
+        const char* GetNameForOfferingDurationUnitsCStr(OfferingDurationUnits enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OfferingDurationUnits::MONTHS:
-            return "MONTHS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOfferingDurationUnits(OfferingDurationUnits enumValue)
+        {
+          return GetNameForOfferingDurationUnitsCStr(enumValue);
         }
 
       } // namespace OfferingDurationUnitsMapper
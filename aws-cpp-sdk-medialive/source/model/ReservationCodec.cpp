@@ -30,30 +30,51 @@ namespace Aws
       namespace ReservationCodecMapper
       {
 
-        static const int MPEG2_HASH = HashingUtils::HashString("MPEG2");
-        static const int AVC_HASH = HashingUtils::HashString("AVC");
-        static const int HEVC_HASH = HashingUtils::HashString("HEVC");
-        static const int AUDIO_HASH = HashingUtils::HashString("AUDIO");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MPEG2",
+          "AVC",
+          "HEVC",
+          "AUDIO",
+        };
 
         ReservationCodec GetReservationCodecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MPEG2_HASH)
-          {
-            return ReservationCodec::MPEG2;
-          }
-          else if (hashCode == AVC_HASH)
-          {
-            return ReservationCodec::AVC;
-          }
-          else if (hashCode == HEVC_HASH)
-          {
-            return ReservationCodec::HEVC;
-          }
-          else if (hashCode == AUDIO_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReservationCodec::AUDIO;
+          case 73562957:
+            if (name == "MPEG2")
+            {
+              return ReservationCodec::MPEG2;
+            }
+            break;
+          case 65198:
+            if (name == "AVC")
+            {
+              return ReservationCodec::AVC;
+            }
+            break;
+          case 2213994:
+            if (name == "HEVC")
+            {
+              return ReservationCodec::HEVC;
+            }
+            break;
+          case 62628790:
+            if (name == "AUDIO")
+            {
+              return ReservationCodec::AUDIO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ReservationCodec::NOT_SET;
         }
 
-        Aws::String GetNameForReservationCodec(ReservationCodec enumValue)
+        const char* GetNameForReservationCodecCStr(ReservationCodec enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReservationCodec::MPEG2:
-            return "MPEG2";
-          case ReservationCodec::AVC:
-            return "AVC";
-          case ReservationCodec::HEVC:
-            return "HEVC";
-          case ReservationCodec::AUDIO:
-            return "AUDIO";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReservationCodec(ReservationCodec enumValue)
+        {
+          return GetNameForReservationCodecCStr(enumValue);
         }
 
       } // namespace ReservationCodecMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ReservationMaximumFramerateMapper
       {
 
-        static const int MAX_30_FPS_HASH = HashingUtils::HashString("MAX_30_FPS");
-        static const int MAX_60_FPS_HASH = HashingUtils::HashString("MAX_60_FPS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MAX_30_FPS",
+          "MAX_60_FPS",
+        };
 
         ReservationMaximumFramerate GetReservationMaximumFramerateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAX_30_FPS_HASH)
-          {
-            return ReservationMaximumFramerate::MAX_30_FPS;
-          }
-          else if (hashCode == MAX_60_FPS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReservationMaximumFramerate::MAX_60_FPS;
+          case -802787518:
+            if (name == "MAX_30_FPS")
+            {
+              return ReservationMaximumFramerate::MAX_30_FPS;
+            }
+            break;
+          case -716900065:
+            if (name == "MAX_60_FPS")
+            {
+              return ReservationMaximumFramerate::MAX_60_FPS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReservationMaximumFramerate::NOT_SET;
         }
 
-        Aws::String GetNameForReservationMaximumFramerate(ReservationMaximumFramerate enumValue)
+        const char* GetNameForReservationMaximumFramerateCStr(ReservationMaximumFramerate enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReservationMaximumFramerate::MAX_30_FPS:
-            return "MAX_30_FPS";
-          case ReservationMaximumFramerate::MAX_60_FPS:
-            return "MAX_60_FPS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReservationMaximumFramerate(ReservationMaximumFramerate enumValue)
+        {
+          return GetNameForReservationMaximumFramerateCStr(enumValue);
         }
 
       } // namespace ReservationMaximumFramerateMapper
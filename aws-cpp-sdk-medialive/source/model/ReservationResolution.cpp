@@ -30,25 +30,44 @@ namespace Aws
       namespace ReservationResolutionMapper
       {
 
-        static const int SD_HASH = HashingUtils::HashString("SD");
-        static const int HD_HASH = HashingUtils::HashString("HD");
-        static const int UHD_HASH = HashingUtils::HashString("UHD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SD",
+          "HD",
+          "UHD",
+        };
 
         ReservationResolution GetReservationResolutionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SD_HASH)
-          {
-            return ReservationResolution::SD;
-          }
-          else if (hashCode == HD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReservationResolution::HD;
-          }
-          else if (hashCode == UHD_HASH)
-          {
-            return ReservationResolution::UHD;
+          case 2641:
+            if (name == "SD")
+            {
+              return ReservationResolution::SD;
+            }
+            break;
+          case 2300:
+            if (name == "HD")
+            {
+              return ReservationResolution::HD;
+            }
+            break;
+          case 83985:
+            if (name == "UHD")
+            {
+              return ReservationResolution::UHD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ReservationResolution::NOT_SET;
         }
 
-        Aws::String GetNameForReservationResolution(ReservationResolution enumValue)
+        const char* GetNameForReservationResolutionCStr(ReservationResolution enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReservationResolution::SD:
-            return "SD";
-          case ReservationResolution::HD:
-            return "HD";
-          case ReservationResolution::UHD:
-            return "UHD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReservationResolution(ReservationResolution enumValue)
+        {
+          return GetNameForReservationResolutionCStr(enumValue);
         }
 
       } // namespace ReservationResolutionMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ReservationResourceTypeMapper
       {
 
-        static const int INPUT_HASH = HashingUtils::HashString("INPUT");
-        static const int OUTPUT_HASH = HashingUtils::HashString("OUTPUT");
-        static const int CHANNEL_HASH = HashingUtils::HashString("CHANNEL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INPUT",
+          "OUTPUT",
+          "CHANNEL",
+        };
 
         ReservationResourceType GetReservationResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INPUT_HASH)
-          {
-            return ReservationResourceType::INPUT;
-          }
-          else if (hashCode == OUTPUT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReservationResourceType::OUTPUT;
-          }
-          else if (hashCode == CHANNEL_HASH)
-          {
-            return ReservationResourceType::CHANNEL;
+          case 69820330:
+            if (name == "INPUT")
+            {
+              return ReservationResourceType::INPUT;
+            }
+            break;
+          case -1952183039:
+            if (name == "OUTPUT")
+            {
+              return ReservationResourceType::OUTPUT;
+            }
+            break;
+          case 1456933091:
+            if (name == "CHANNEL")
+            {
+              return ReservationResourceType::CHANNEL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ReservationResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForReservationResourceType(ReservationResourceType enumValue)
+        const char* GetNameForReservationResourceTypeCStr(ReservationResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReservationResourceType::INPUT:
-            return "INPUT";
-          case ReservationResourceType::OUTPUT:
-            return "OUTPUT";
-          case ReservationResourceType::CHANNEL:
-            return "CHANNEL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReservationResourceType(ReservationResourceType enumValue)
+        {
+          return GetNameForReservationResourceTypeCStr(enumValue);
         }
 
       } // namespace ReservationResourceTypeMapper
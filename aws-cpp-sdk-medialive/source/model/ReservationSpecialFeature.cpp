@@ -30,20 +30,37 @@ namespace Aws
       namespace ReservationSpecialFeatureMapper
       {
 
-        static const int ADVANCED_AUDIO_HASH = HashingUtils::HashString("ADVANCED_AUDIO");
-        static const int AUDIO_NORMALIZATION_HASH = HashingUtils::HashString("AUDIO_NORMALIZATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADVANCED_AUDIO",
+          "AUDIO_NORMALIZATION",
+        };
 
         ReservationSpecialFeature GetReservationSpecialFeatureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADVANCED_AUDIO_HASH)
-          {
-            return ReservationSpecialFeature::ADVANCED_AUDIO;
-          }
-          else if (hashCode == AUDIO_NORMALIZATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReservationSpecialFeature::AUDIO_NORMALIZATION;
+          case 114769241:
+            if (name == "ADVANCED_AUDIO")
+            {
+              return ReservationSpecialFeature::ADVANCED_AUDIO;
+            }
+            break;
+          case 783539380:
+            if (name == "AUDIO_NORMALIZATION")
+            {
+              return ReservationSpecialFeature::AUDIO_NORMALIZATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReservationSpecialFeature::NOT_SET;
         }
 
-        Aws::String GetNameForReservationSpecialFeature(ReservationSpecialFeature enumValue)
+        const char* GetNameForReservationSpecialFeatureCStr(ReservationSpecialFeature enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReservationSpecialFeature::ADVANCED_AUDIO:
-            return "ADVANCED_AUDIO";
-          case ReservationSpecialFeature::AUDIO_NORMALIZATION:
-            return "AUDIO_NORMALIZATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReservationSpecialFeature(ReservationSpecialFeature enumValue)
+        {
+          return GetNameForReservationSpecialFeatureCStr(enumValue);
         }
 
       } // namespace ReservationSpecialFeatureMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ReservationStateMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "EXPIRED",
+          "CANCELED",
+          "DELETED",
+        };
 
         ReservationState GetReservationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return ReservationState::ACTIVE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return ReservationState::EXPIRED;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return ReservationState::CANCELED;
-          }
-          else if (hashCode == DELETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReservationState::DELETED;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ReservationState::ACTIVE;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return ReservationState::EXPIRED;
+            }
+            break;
+          case 659453081:
+            if (name == "CANCELED")
+            {
+              return ReservationState::CANCELED;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return ReservationState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ReservationState::NOT_SET;
         }
 
-        Aws::String GetNameForReservationState(ReservationState enumValue)
+        const char* GetNameForReservationStateCStr(ReservationState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReservationState::ACTIVE:
-            return "ACTIVE";
-          case ReservationState::EXPIRED:
-            return "EXPIRED";
-          case ReservationState::CANCELED:
-            return "CANCELED";
-          case ReservationState::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReservationState(ReservationState enumValue)
+        {
+          return GetNameForReservationStateCStr(enumValue);
         }
 
       } // namespace ReservationStateMapper
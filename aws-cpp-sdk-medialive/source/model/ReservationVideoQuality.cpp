@@ -30,25 +30,44 @@ namespace Aws
       namespace ReservationVideoQualityMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int ENHANCED_HASH = HashingUtils::HashString("ENHANCED");
-        static const int PREMIUM_HASH = HashingUtils::HashString("PREMIUM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STANDARD",
+          "ENHANCED",
+          "PREMIUM",
+        };
 
         ReservationVideoQuality GetReservationVideoQualityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
-          {
-            return ReservationVideoQuality::STANDARD;
-          }
-          else if (hashCode == ENHANCED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReservationVideoQuality::ENHANCED;
-          }
-          else if (hashCode == PREMIUM_HASH)
-          {
-            return ReservationVideoQuality::PREMIUM;
+          case 2095255229:
+            if (name == "STANDARD")
+            {
+              return ReservationVideoQuality::STANDARD;
+            }
+            break;
+          case -1670610058:
+            if (name == "ENHANCED")
+            {
+              return ReservationVideoQuality::ENHANCED;
+            }
+            break;
+          case 399530551:
+            if (name == "PREMIUM")
+            {
+              return ReservationVideoQuality::PREMIUM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ReservationVideoQuality::NOT_SET;
         }
 
-        Aws::String GetNameForReservationVideoQuality(ReservationVideoQuality enumValue)
+        const char* GetNameForReservationVideoQualityCStr(ReservationVideoQuality enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReservationVideoQuality::STANDARD:
-            return "STANDARD";
-          case ReservationVideoQuality::ENHANCED:
-            return "ENHANCED";
-          case ReservationVideoQuality::PREMIUM:
-            return "PREMIUM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReservationVideoQuality(ReservationVideoQuality enumValue)
+        {
+          return GetNameForReservationVideoQualityCStr(enumValue);
         }
 
       } // namespace ReservationVideoQualityMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace RtmpCacheFullBehaviorMapper
       {
 
-        static const int DISCONNECT_IMMEDIATELY_HASH = HashingUtils::HashString("DISCONNECT_IMMEDIATELY");
-        static const int WAIT_FOR_SERVER_HASH = HashingUtils::HashString("WAIT_FOR_SERVER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISCONNECT_IMMEDIATELY",
+          "WAIT_FOR_SERVER",
+        };
 
         RtmpCacheFullBehavior GetRtmpCacheFullBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISCONNECT_IMMEDIATELY_HASH)
-          {
-            return RtmpCacheFullBehavior::DISCONNECT_IMMEDIATELY;
-          }
-          else if (hashCode == WAIT_FOR_SERVER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RtmpCacheFullBehavior::WAIT_FOR_SERVER;
+          case -1081161285:
+            if (name == "DISCONNECT_IMMEDIATELY")
+            {
+              return RtmpCacheFullBehavior::DISCONNECT_IMMEDIATELY;
+            }
+            break;
+          case -1279299421:
+            if (name == "WAIT_FOR_SERVER")
+            {
+              return RtmpCacheFullBehavior::WAIT_FOR_SERVER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RtmpCacheFullBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForRtmpCacheFullBehavior(RtmpCacheFullBehavior enumValue)
+        const char* GetNameForRtmpCacheFullBehaviorCStr(RtmpCacheFullBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RtmpCacheFullBehavior::DISCONNECT_IMMEDIATELY:
-            return "DISCONNECT_IMMEDIATELY";
-          case RtmpCacheFullBehavior::WAIT_FOR_SERVER:
-            return "WAIT_FOR_SERVER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRtmpCacheFullBehavior(RtmpCacheFullBehavior enumValue)
+        {
+          return GetNameForRtmpCacheFullBehaviorCStr(enumValue);
         }
 
       } // namespace RtmpCacheFullBehaviorMapper
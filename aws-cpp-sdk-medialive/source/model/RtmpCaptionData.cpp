@@ -30,25 +30,44 @@ namespace Aws
       namespace RtmpCaptionDataMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int FIELD1_608_HASH = HashingUtils::HashString("FIELD1_608");
-        static const int FIELD1_AND_FIELD2_608_HASH = HashingUtils::HashString("FIELD1_AND_FIELD2_608");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALL",
+          "FIELD1_608",
+          "FIELD1_AND_FIELD2_608",
+        };
 
         RtmpCaptionData GetRtmpCaptionDataForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
-          {
-            return RtmpCaptionData::ALL;
-          }
-          else if (hashCode == FIELD1_608_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RtmpCaptionData::FIELD1_608;
-          }
-          else if (hashCode == FIELD1_AND_FIELD2_608_HASH)
-          {
-            return RtmpCaptionData::FIELD1_AND_FIELD2_608;
+          case 64897:
+            if (name == "ALL")
+            {
+              return RtmpCaptionData::ALL;
+            }
+            break;
+          case 1049317142:
+            if (name == "FIELD1_608")
+            {
+              return RtmpCaptionData::FIELD1_608;
+            }
+            break;
+          case -879791929:
+            if (name == "FIELD1_AND_FIELD2_608")
+            {
+              return RtmpCaptionData::FIELD1_AND_FIELD2_608;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RtmpCaptionData::NOT_SET;
         }
 
-        Aws::String GetNameForRtmpCaptionData(RtmpCaptionData enumValue)
+        const char* GetNameForRtmpCaptionDataCStr(RtmpCaptionData enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RtmpCaptionData::ALL:
-            return "ALL";
-          case RtmpCaptionData::FIELD1_608:
-            return "FIELD1_608";
-          case RtmpCaptionData::FIELD1_AND_FIELD2_608:
-            return "FIELD1_AND_FIELD2_608";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRtmpCaptionData(RtmpCaptionData enumValue)
+        {
+          return GetNameForRtmpCaptionDataCStr(enumValue);
         }
 
       } // namespace RtmpCaptionDataMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace RtmpOutputCertificateModeMapper
       {
 
-        static const int SELF_SIGNED_HASH = HashingUtils::HashString("SELF_SIGNED");
-        static const int VERIFY_AUTHENTICITY_HASH = HashingUtils::HashString("VERIFY_AUTHENTICITY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SELF_SIGNED",
+          "VERIFY_AUTHENTICITY",
+        };
 
         RtmpOutputCertificateMode GetRtmpOutputCertificateModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SELF_SIGNED_HASH)
-          {
-            return RtmpOutputCertificateMode::SELF_SIGNED;
-          }
-          else if (hashCode == VERIFY_AUTHENTICITY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RtmpOutputCertificateMode::VERIFY_AUTHENTICITY;
+          case -1123218577:
+            if (name == "SELF_SIGNED")
+            {
+              return RtmpOutputCertificateMode::SELF_SIGNED;
+            }
+            break;
+          case -956373257:
+            if (name == "VERIFY_AUTHENTICITY")
+            {
+              return RtmpOutputCertificateMode::VERIFY_AUTHENTICITY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RtmpOutputCertificateMode::NOT_SET;
         }
 
-        Aws::String GetNameForRtmpOutputCertificateMode(RtmpOutputCertificateMode enumValue)
+        const char* GetNameForRtmpOutputCertificateModeCStr(RtmpOutputCertificateMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RtmpOutputCertificateMode::SELF_SIGNED:
-            return "SELF_SIGNED";
-          case RtmpOutputCertificateMode::VERIFY_AUTHENTICITY:
-            return "VERIFY_AUTHENTICITY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRtmpOutputCertificateMode(RtmpOutputCertificateMode enumValue)
+        {
+          return GetNameForRtmpOutputCertificateModeCStr(enumValue);
         }
 
       } // namespace RtmpOutputCertificateModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace Scte20Convert608To708Mapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int UPCONVERT_HASH = HashingUtils::HashString("UPCONVERT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISABLED",
+          "UPCONVERT",
+        };
 
         Scte20Convert608To708 GetScte20Convert608To708ForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
-          {
-            return Scte20Convert608To708::DISABLED;
-          }
-          else if (hashCode == UPCONVERT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Scte20Convert608To708::UPCONVERT;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return Scte20Convert608To708::DISABLED;
+            }
+            break;
+          case 345672344:
+            if (name == "UPCONVERT")
+            {
+              return Scte20Convert608To708::UPCONVERT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Scte20Convert608To708::NOT_SET;
         }
 
-        Aws::String GetNameForScte20Convert608To708(Scte20Convert608To708 enumValue)
+        const char* GetNameForScte20Convert608To708CStr(Scte20Convert608To708 enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Scte20Convert608To708::DISABLED:
-            return "DISABLED";
-          case Scte20Convert608To708::UPCONVERT:
-            return "UPCONVERT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScte20Convert608To708(Scte20Convert608To708 enumValue)
+        {
+          return GetNameForScte20Convert608To708CStr(enumValue);
         }
 
       } // namespace Scte20Convert608To708Mapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace Scte35AposWebDeliveryAllowedBehaviorMapper
       {
 
-        static const int FOLLOW_HASH = HashingUtils::HashString("FOLLOW");
-        static const int IGNORE_HASH = HashingUtils::HashString("IGNORE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FOLLOW",
+          "IGNORE",
+        };
 
         Scte35AposWebDeliveryAllowedBehavior GetScte35AposWebDeliveryAllowedBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_HASH)
-          {
-            return Scte35AposWebDeliveryAllowedBehavior::FOLLOW;
-          }
-          else if (hashCode == IGNORE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Scte35AposWebDeliveryAllowedBehavior::IGNORE;
+          case 2079338417:
+            if (name == "FOLLOW")
+            {
+              return Scte35AposWebDeliveryAllowedBehavior::FOLLOW;
+            }
+            break;
+          case -2137067054:
+            if (name == "IGNORE")
+            {
+              return Scte35AposWebDeliveryAllowedBehavior::IGNORE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Scte35AposWebDeliveryAllowedBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForScte35AposWebDeliveryAllowedBehavior(Scte35AposWebDeliveryAllowedBehavior enumValue)
+        const char* GetNameForScte35AposWebDeliveryAllowedBehaviorCStr(Scte35AposWebDeliveryAllowedBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Scte35AposWebDeliveryAllowedBehavior::FOLLOW:
-            return "FOLLOW";
-          case Scte35AposWebDeliveryAllowedBehavior::IGNORE:
-            return "IGNORE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScte35AposWebDeliveryAllowedBehavior(Scte35AposWebDeliveryAllowedBehavior enumValue)
+        {
+          return GetNameForScte35AposWebDeliveryAllowedBehaviorCStr(enumValue);
         }
 
       } // namespace Scte35AposWebDeliveryAllowedBehaviorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace Scte35ArchiveAllowedFlagMapper
       {
 
-        static const int ARCHIVE_NOT_ALLOWED_HASH = HashingUtils::HashString("ARCHIVE_NOT_ALLOWED");
-        static const int ARCHIVE_ALLOWED_HASH = HashingUtils::HashString("ARCHIVE_ALLOWED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ARCHIVE_NOT_ALLOWED",
+          "ARCHIVE_ALLOWED",
+        };
 
         Scte35ArchiveAllowedFlag GetScte35ArchiveAllowedFlagForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ARCHIVE_NOT_ALLOWED_HASH)
-          {
-            return Scte35ArchiveAllowedFlag::ARCHIVE_NOT_ALLOWED;
-          }
-          else if (hashCode == ARCHIVE_ALLOWED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Scte35ArchiveAllowedFlag::ARCHIVE_ALLOWED;
+          case 1218373599:
+            if (name == "ARCHIVE_NOT_ALLOWED")
+            {
+              return Scte35ArchiveAllowedFlag::ARCHIVE_NOT_ALLOWED;
+            }
+            break;
+          case -1117790485:
+            if (name == "ARCHIVE_ALLOWED")
+            {
+              return Scte35ArchiveAllowedFlag::ARCHIVE_ALLOWED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Scte35ArchiveAllowedFlag::NOT_SET;
         }
 
-        Aws::String GetNameForScte35ArchiveAllowedFlag(Scte35ArchiveAllowedFlag enumValue)
+        const char* GetNameForScte35ArchiveAllowedFlagCStr(Scte35ArchiveAllowedFlag enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Scte35ArchiveAllowedFlag::ARCHIVE_NOT_ALLOWED:
-            return "ARCHIVE_NOT_ALLOWED";
-          case Scte35ArchiveAllowedFlag::ARCHIVE_ALLOWED:
-            return "ARCHIVE_ALLOWED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScte35ArchiveAllowedFlag(Scte35ArchiveAllowedFlag enumValue)
+        {
+          return GetNameForScte35ArchiveAllowedFlagCStr(enumValue);
         }
 
       } // namespace Scte35ArchiveAllowedFlagMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace Scte35DeviceRestrictionsMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int RESTRICT_GROUP0_HASH = HashingUtils::HashString("RESTRICT_GROUP0");
-        static const int RESTRICT_GROUP1_HASH = HashingUtils::HashString("RESTRICT_GROUP1");
-        static const int RESTRICT_GROUP2_HASH = HashingUtils::HashString("RESTRICT_GROUP2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "RESTRICT_GROUP0",
+          "RESTRICT_GROUP1",
+          "RESTRICT_GROUP2",
+        };
 
         Scte35DeviceRestrictions GetScte35DeviceRestrictionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return Scte35DeviceRestrictions::NONE;
-          }
-          else if (hashCode == RESTRICT_GROUP0_HASH)
-          {
-            return Scte35DeviceRestrictions::RESTRICT_GROUP0;
-          }
-          else if (hashCode == RESTRICT_GROUP1_HASH)
-          {
-            return Scte35DeviceRestrictions::RESTRICT_GROUP1;
-          }
-          else if (hashCode == RESTRICT_GROUP2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Scte35DeviceRestrictions::RESTRICT_GROUP2;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Scte35DeviceRestrictions::NONE;
+            }
+            break;
+          case -518794092:
+            if (name == "RESTRICT_GROUP0")
+            {
+              return Scte35DeviceRestrictions::RESTRICT_GROUP0;
+            }
+            break;
+          case -518794091:
+            if (name == "RESTRICT_GROUP1")
+            {
+              return Scte35DeviceRestrictions::RESTRICT_GROUP1;
+            }
+            break;
+          case -518794090:
+            if (name == "RESTRICT_GROUP2")
+            {
+              return Scte35DeviceRestrictions::RESTRICT_GROUP2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Scte35DeviceRestrictions::NOT_SET;
         }
 
-        Aws::String GetNameForScte35DeviceRestrictions(Scte35DeviceRestrictions enumValue)
+        const char* GetNameForScte35DeviceRestrictionsCStr(Scte35DeviceRestrictions enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Scte35DeviceRestrictions::NONE:
-            return "NONE";
-          case Scte35DeviceRestrictions::RESTRICT_GROUP0:
-            return "RESTRICT_GROUP0";
-          case Scte35DeviceRestrictions::RESTRICT_GROUP1:
-            return "RESTRICT_GROUP1";
-          case Scte35DeviceRestrictions::RESTRICT_GROUP2:
-            return "RESTRICT_GROUP2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScte35DeviceRestrictions(Scte35DeviceRestrictions enumValue)
+        {
+          return GetNameForScte35DeviceRestrictionsCStr(enumValue);
         }
 
       } // namespace Scte35DeviceRestrictionsMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace Scte35NoRegionalBlackoutFlagMapper
       {
 
-        static const int REGIONAL_BLACKOUT_HASH = HashingUtils::HashString("REGIONAL_BLACKOUT");
-        static const int NO_REGIONAL_BLACKOUT_HASH = HashingUtils::HashString("NO_REGIONAL_BLACKOUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REGIONAL_BLACKOUT",
+          "NO_REGIONAL_BLACKOUT",
+        };
 
         Scte35NoRegionalBlackoutFlag GetScte35NoRegionalBlackoutFlagForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGIONAL_BLACKOUT_HASH)
-          {
-            return Scte35NoRegionalBlackoutFlag::REGIONAL_BLACKOUT;
-          }
-          else if (hashCode == NO_REGIONAL_BLACKOUT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Scte35NoRegionalBlackoutFlag::NO_REGIONAL_BLACKOUT;
+          case 835455247:
+            if (name == "REGIONAL_BLACKOUT")
+            {
+              return Scte35NoRegionalBlackoutFlag::REGIONAL_BLACKOUT;
+            }
+            break;
+          case 785542673:
+            if (name == "NO_REGIONAL_BLACKOUT")
+            {
+              return Scte35NoRegionalBlackoutFlag::NO_REGIONAL_BLACKOUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Scte35NoRegionalBlackoutFlag::NOT_SET;
         }
 
-        Aws::String GetNameForScte35NoRegionalBlackoutFlag(Scte35NoRegionalBlackoutFlag enumValue)
+        const char* GetNameForScte35NoRegionalBlackoutFlagCStr(Scte35NoRegionalBlackoutFlag enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Scte35NoRegionalBlackoutFlag::REGIONAL_BLACKOUT:
-            return "REGIONAL_BLACKOUT";
-          case Scte35NoRegionalBlackoutFlag::NO_REGIONAL_BLACKOUT:
-            return "NO_REGIONAL_BLACKOUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScte35NoRegionalBlackoutFlag(Scte35NoRegionalBlackoutFlag enumValue)
+        {
+          return GetNameForScte35NoRegionalBlackoutFlagCStr(enumValue);
         }
 
       } // namespace Scte35NoRegionalBlackoutFlagMapper
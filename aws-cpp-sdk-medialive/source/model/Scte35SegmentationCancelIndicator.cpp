@@ -30,20 +30,37 @@ namespace Aws
       namespace Scte35SegmentationCancelIndicatorMapper
       {
 
-        static const int SEGMENTATION_EVENT_NOT_CANCELED_HASH = HashingUtils::HashString("SEGMENTATION_EVENT_NOT_CANCELED");
-        static const int SEGMENTATION_EVENT_CANCELED_HASH = HashingUtils::HashString("SEGMENTATION_EVENT_CANCELED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SEGMENTATION_EVENT_NOT_CANCELED",
+          "SEGMENTATION_EVENT_CANCELED",
+        };
 
         Scte35SegmentationCancelIndicator GetScte35SegmentationCancelIndicatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SEGMENTATION_EVENT_NOT_CANCELED_HASH)
-          {
-            return Scte35SegmentationCancelIndicator::SEGMENTATION_EVENT_NOT_CANCELED;
-          }
-          else if (hashCode == SEGMENTATION_EVENT_CANCELED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Scte35SegmentationCancelIndicator::SEGMENTATION_EVENT_CANCELED;
+          case 921934343:
+            if (name == "SEGMENTATION_EVENT_NOT_CANCELED")
+            {
+              return Scte35SegmentationCancelIndicator::SEGMENTATION_EVENT_NOT_CANCELED;
+            }
+            break;
+          case -1072578821:
+            if (name == "SEGMENTATION_EVENT_CANCELED")
+            {
+              return Scte35SegmentationCancelIndicator::SEGMENTATION_EVENT_CANCELED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Scte35SegmentationCancelIndicator::NOT_SET;
         }
 
-        Aws::String GetNameForScte35SegmentationCancelIndicator(Scte35SegmentationCancelIndicator enumValue)
+        const char* GetNameForScte35SegmentationCancelIndicatorCStr(Scte35SegmentationCancelIndicator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Scte35SegmentationCancelIndicator::SEGMENTATION_EVENT_NOT_CANCELED:
-            return "SEGMENTATION_EVENT_NOT_CANCELED";
-          case Scte35SegmentationCancelIndicator::SEGMENTATION_EVENT_CANCELED:
-            return "SEGMENTATION_EVENT_CANCELED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScte35SegmentationCancelIndicator(Scte35SegmentationCancelIndicator enumValue)
+        {
+          return GetNameForScte35SegmentationCancelIndicatorCStr(enumValue);
         }
 
       } // namespace Scte35SegmentationCancelIndicatorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace Scte35SpliceInsertNoRegionalBlackoutBehaviorMapper
       {
 
-        static const int FOLLOW_HASH = HashingUtils::HashString("FOLLOW");
-        static const int IGNORE_HASH = HashingUtils::HashString("IGNORE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FOLLOW",
+          "IGNORE",
+        };
 
         Scte35SpliceInsertNoRegionalBlackoutBehavior GetScte35SpliceInsertNoRegionalBlackoutBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_HASH)
-          {
-            return Scte35SpliceInsertNoRegionalBlackoutBehavior::FOLLOW;
-          }
-          else if (hashCode == IGNORE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Scte35SpliceInsertNoRegionalBlackoutBehavior::IGNORE;
+          case 2079338417:
+            if (name == "FOLLOW")
+            {
+              return Scte35SpliceInsertNoRegionalBlackoutBehavior::FOLLOW;
+            }
+            break;
+          case -2137067054:
+            if (name == "IGNORE")
+            {
+              return Scte35SpliceInsertNoRegionalBlackoutBehavior::IGNORE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Scte35SpliceInsertNoRegionalBlackoutBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForScte35SpliceInsertNoRegionalBlackoutBehavior(Scte35SpliceInsertNoRegionalBlackoutBehavior enumValue)
+        const char* GetNameForScte35SpliceInsertNoRegionalBlackoutBehaviorCStr(Scte35SpliceInsertNoRegionalBlackoutBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Scte35SpliceInsertNoRegionalBlackoutBehavior::FOLLOW:
-            return "FOLLOW";
-          case Scte35SpliceInsertNoRegionalBlackoutBehavior::IGNORE:
-            return "IGNORE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScte35SpliceInsertNoRegionalBlackoutBehavior(Scte35SpliceInsertNoRegionalBlackoutBehavior enumValue)
+        {
+          return GetNameForScte35SpliceInsertNoRegionalBlackoutBehaviorCStr(enumValue);
         }
 
       } // namespace Scte35SpliceInsertNoRegionalBlackoutBehaviorMapper
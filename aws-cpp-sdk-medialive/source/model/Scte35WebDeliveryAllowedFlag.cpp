@@ -30,20 +30,37 @@ namespace Aws
       namespace Scte35WebDeliveryAllowedFlagMapper
       {
 
-        static const int WEB_DELIVERY_NOT_ALLOWED_HASH = HashingUtils::HashString("WEB_DELIVERY_NOT_ALLOWED");
-        static const int WEB_DELIVERY_ALLOWED_HASH = HashingUtils::HashString("WEB_DELIVERY_ALLOWED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WEB_DELIVERY_NOT_ALLOWED",
+          "WEB_DELIVERY_ALLOWED",
+        };
 
         Scte35WebDeliveryAllowedFlag GetScte35WebDeliveryAllowedFlagForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WEB_DELIVERY_NOT_ALLOWED_HASH)
-          {
-            return Scte35WebDeliveryAllowedFlag::WEB_DELIVERY_NOT_ALLOWED;
-          }
-          else if (hashCode == WEB_DELIVERY_ALLOWED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Scte35WebDeliveryAllowedFlag::WEB_DELIVERY_ALLOWED;
+          case 1464479836:
+            if (name == "WEB_DELIVERY_NOT_ALLOWED")
+            {
+              return Scte35WebDeliveryAllowedFlag::WEB_DELIVERY_NOT_ALLOWED;
+            }
+            break;
+          case -78320152:
+            if (name == "WEB_DELIVERY_ALLOWED")
+            {
+              return Scte35WebDeliveryAllowedFlag::WEB_DELIVERY_ALLOWED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Scte35WebDeliveryAllowedFlag::NOT_SET;
         }
 
-        Aws::String GetNameForScte35WebDeliveryAllowedFlag(Scte35WebDeliveryAllowedFlag enumValue)
+        const char* GetNameForScte35WebDeliveryAllowedFlagCStr(Scte35WebDeliveryAllowedFlag enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Scte35WebDeliveryAllowedFlag::WEB_DELIVERY_NOT_ALLOWED:
-            return "WEB_DELIVERY_NOT_ALLOWED";
-          case Scte35WebDeliveryAllowedFlag::WEB_DELIVERY_ALLOWED:
-            return "WEB_DELIVERY_ALLOWED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScte35WebDeliveryAllowedFlag(Scte35WebDeliveryAllowedFlag enumValue)
+        {
+          return GetNameForScte35WebDeliveryAllowedFlagCStr(enumValue);
         }
 
       } // namespace Scte35WebDeliveryAllowedFlagMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SmoothGroupAudioOnlyTimecodeControlMapper
       {
 
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-        static const int USE_CONFIGURED_CLOCK_HASH = HashingUtils::HashString("USE_CONFIGURED_CLOCK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PASSTHROUGH",
+          "USE_CONFIGURED_CLOCK",
+        };
 
         SmoothGroupAudioOnlyTimecodeControl GetSmoothGroupAudioOnlyTimecodeControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PASSTHROUGH_HASH)
-          {
-            return SmoothGroupAudioOnlyTimecodeControl::PASSTHROUGH;
-          }
-          else if (hashCode == USE_CONFIGURED_CLOCK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SmoothGroupAudioOnlyTimecodeControl::USE_CONFIGURED_CLOCK;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return SmoothGroupAudioOnlyTimecodeControl::PASSTHROUGH;
+            }
+            break;
+          case 416037509:
+            if (name == "USE_CONFIGURED_CLOCK")
+            {
+              return SmoothGroupAudioOnlyTimecodeControl::USE_CONFIGURED_CLOCK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SmoothGroupAudioOnlyTimecodeControl::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupAudioOnlyTimecodeControl(SmoothGroupAudioOnlyTimecodeControl enumValue)
+        const char* GetNameForSmoothGroupAudioOnlyTimecodeControlCStr(SmoothGroupAudioOnlyTimecodeControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SmoothGroupAudioOnlyTimecodeControl::PASSTHROUGH:
-            return "PASSTHROUGH";
-          case SmoothGroupAudioOnlyTimecodeControl::USE_CONFIGURED_CLOCK:
-            return "USE_CONFIGURED_CLOCK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSmoothGroupAudioOnlyTimecodeControl(SmoothGroupAudioOnlyTimecodeControl enumValue)
+        {
+          return GetNameForSmoothGroupAudioOnlyTimecodeControlCStr(enumValue);
         }
 
       } // namespace SmoothGroupAudioOnlyTimecodeControlMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace SmoothGroupEventIdModeMapper
       {
 
-        static const int NO_EVENT_ID_HASH = HashingUtils::HashString("NO_EVENT_ID");
-        static const int USE_CONFIGURED_HASH = HashingUtils::HashString("USE_CONFIGURED");
-        static const int USE_TIMESTAMP_HASH = HashingUtils::HashString("USE_TIMESTAMP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NO_EVENT_ID",
+          "USE_CONFIGURED",
+          "USE_TIMESTAMP",
+        };
 
         SmoothGroupEventIdMode GetSmoothGroupEventIdModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_EVENT_ID_HASH)
-          {
-            return SmoothGroupEventIdMode::NO_EVENT_ID;
-          }
-          else if (hashCode == USE_CONFIGURED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SmoothGroupEventIdMode::USE_CONFIGURED;
-          }
-          else if (hashCode == USE_TIMESTAMP_HASH)
-          {
-            return SmoothGroupEventIdMode::USE_TIMESTAMP;
+          case 83343806:
+            if (name == "NO_EVENT_ID")
+            {
+              return SmoothGroupEventIdMode::NO_EVENT_ID;
+            }
+            break;
+          case -177742826:
+            if (name == "USE_CONFIGURED")
+            {
+              return SmoothGroupEventIdMode::USE_CONFIGURED;
+            }
+            break;
+          case 576727070:
+            if (name == "USE_TIMESTAMP")
+            {
+              return SmoothGroupEventIdMode::USE_TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SmoothGroupEventIdMode::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupEventIdMode(SmoothGroupEventIdMode enumValue)
+        const char* GetNameForSmoothGroupEventIdModeCStr(SmoothGroupEventIdMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SmoothGroupEventIdMode::NO_EVENT_ID:
-            return "NO_EVENT_ID";
-          case SmoothGroupEventIdMode::USE_CONFIGURED:
-            return "USE_CONFIGURED";
-          case SmoothGroupEventIdMode::USE_TIMESTAMP:
-            return "USE_TIMESTAMP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSmoothGroupEventIdMode(SmoothGroupEventIdMode enumValue)
+        {
+          return GetNameForSmoothGroupEventIdModeCStr(enumValue);
         }
 
       } // namespace SmoothGroupEventIdModeMapper
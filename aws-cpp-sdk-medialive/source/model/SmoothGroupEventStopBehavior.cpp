@@ -30,20 +30,37 @@ namespace Aws
       namespace SmoothGroupEventStopBehaviorMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SEND_EOS_HASH = HashingUtils::HashString("SEND_EOS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "SEND_EOS",
+        };
 
         SmoothGroupEventStopBehavior GetSmoothGroupEventStopBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return SmoothGroupEventStopBehavior::NONE;
-          }
-          else if (hashCode == SEND_EOS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SmoothGroupEventStopBehavior::SEND_EOS;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return SmoothGroupEventStopBehavior::NONE;
+            }
+            break;
+          case 2031353778:
+            if (name == "SEND_EOS")
+            {
+              return SmoothGroupEventStopBehavior::SEND_EOS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SmoothGroupEventStopBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupEventStopBehavior(SmoothGroupEventStopBehavior enumValue)
+        const char* GetNameForSmoothGroupEventStopBehaviorCStr(SmoothGroupEventStopBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SmoothGroupEventStopBehavior::NONE:
-            return "NONE";
-          case SmoothGroupEventStopBehavior::SEND_EOS:
-            return "SEND_EOS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSmoothGroupEventStopBehavior(SmoothGroupEventStopBehavior enumValue)
+        {
+          return GetNameForSmoothGroupEventStopBehaviorCStr(enumValue);
         }
 
       } // namespace SmoothGroupEventStopBehaviorMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SmoothGroupSegmentationModeMapper
       {
 
-        static const int USE_INPUT_SEGMENTATION_HASH = HashingUtils::HashString("USE_INPUT_SEGMENTATION");
-        static const int USE_SEGMENT_DURATION_HASH = HashingUtils::HashString("USE_SEGMENT_DURATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USE_INPUT_SEGMENTATION",
+          "USE_SEGMENT_DURATION",
+        };
 
         SmoothGroupSegmentationMode GetSmoothGroupSegmentationModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USE_INPUT_SEGMENTATION_HASH)
-          {
-            return SmoothGroupSegmentationMode::USE_INPUT_SEGMENTATION;
-          }
-          else if (hashCode == USE_SEGMENT_DURATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SmoothGroupSegmentationMode::USE_SEGMENT_DURATION;
+          case -1088292881:
+            if (name == "USE_INPUT_SEGMENTATION")
+            {
+              return SmoothGroupSegmentationMode::USE_INPUT_SEGMENTATION;
+            }
+            break;
+          case -1817690856:
+            if (name == "USE_SEGMENT_DURATION")
+            {
+              return SmoothGroupSegmentationMode::USE_SEGMENT_DURATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SmoothGroupSegmentationMode::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupSegmentationMode(SmoothGroupSegmentationMode enumValue)
+        const char* GetNameForSmoothGroupSegmentationModeCStr(SmoothGroupSegmentationMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SmoothGroupSegmentationMode::USE_INPUT_SEGMENTATION:
-            return "USE_INPUT_SEGMENTATION";
-          case SmoothGroupSegmentationMode::USE_SEGMENT_DURATION:
-            return "USE_SEGMENT_DURATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSmoothGroupSegmentationMode(SmoothGroupSegmentationMode enumValue)
+        {
+          return GetNameForSmoothGroupSegmentationModeCStr(enumValue);
         }
 
       } // namespace SmoothGroupSegmentationModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SmoothGroupSparseTrackTypeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SCTE_35_HASH = HashingUtils::HashString("SCTE_35");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "SCTE_35",
+        };
 
         SmoothGroupSparseTrackType GetSmoothGroupSparseTrackTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return SmoothGroupSparseTrackType::NONE;
-          }
-          else if (hashCode == SCTE_35_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SmoothGroupSparseTrackType::SCTE_35;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return SmoothGroupSparseTrackType::NONE;
+            }
+            break;
+          case -1648728416:
+            if (name == "SCTE_35")
+            {
+              return SmoothGroupSparseTrackType::SCTE_35;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SmoothGroupSparseTrackType::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupSparseTrackType(SmoothGroupSparseTrackType enumValue)
+        const char* GetNameForSmoothGroupSparseTrackTypeCStr(SmoothGroupSparseTrackType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SmoothGroupSparseTrackType::NONE:
-            return "NONE";
-          case SmoothGroupSparseTrackType::SCTE_35:
-            return "SCTE_35";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSmoothGroupSparseTrackType(SmoothGroupSparseTrackType enumValue)
+        {
+          return GetNameForSmoothGroupSparseTrackTypeCStr(enumValue);
         }
 
       } // namespace SmoothGroupSparseTrackTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SmoothGroupStreamManifestBehaviorMapper
       {
 
-        static const int DO_NOT_SEND_HASH = HashingUtils::HashString("DO_NOT_SEND");
-        static const int SEND_HASH = HashingUtils::HashString("SEND");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DO_NOT_SEND",
+          "SEND",
+        };
 
         SmoothGroupStreamManifestBehavior GetSmoothGroupStreamManifestBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DO_NOT_SEND_HASH)
-          {
-            return SmoothGroupStreamManifestBehavior::DO_NOT_SEND;
-          }
-          else if (hashCode == SEND_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SmoothGroupStreamManifestBehavior::SEND;
+          case -2094063928:
+            if (name == "DO_NOT_SEND")
+            {
+              return SmoothGroupStreamManifestBehavior::DO_NOT_SEND;
+            }
+            break;
+          case 2541448:
+            if (name == "SEND")
+            {
+              return SmoothGroupStreamManifestBehavior::SEND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SmoothGroupStreamManifestBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupStreamManifestBehavior(SmoothGroupStreamManifestBehavior enumValue)
+        const char* GetNameForSmoothGroupStreamManifestBehaviorCStr(SmoothGroupStreamManifestBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SmoothGroupStreamManifestBehavior::DO_NOT_SEND:
-            return "DO_NOT_SEND";
-          case SmoothGroupStreamManifestBehavior::SEND:
-            return "SEND";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSmoothGroupStreamManifestBehavior(SmoothGroupStreamManifestBehavior enumValue)
+        {
+          return GetNameForSmoothGroupStreamManifestBehaviorCStr(enumValue);
         }
 
       } // namespace SmoothGroupStreamManifestBehaviorMapper
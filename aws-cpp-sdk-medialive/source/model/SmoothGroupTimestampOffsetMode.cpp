@@ -30,20 +30,37 @@ namespace Aws
       namespace SmoothGroupTimestampOffsetModeMapper
       {
 
-        static const int USE_CONFIGURED_OFFSET_HASH = HashingUtils::HashString("USE_CONFIGURED_OFFSET");
-        static const int USE_EVENT_START_DATE_HASH = HashingUtils::HashString("USE_EVENT_START_DATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USE_CONFIGURED_OFFSET",
+          "USE_EVENT_START_DATE",
+        };
 
         SmoothGroupTimestampOffsetMode GetSmoothGroupTimestampOffsetModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USE_CONFIGURED_OFFSET_HASH)
-          {
-            return SmoothGroupTimestampOffsetMode::USE_CONFIGURED_OFFSET;
-          }
-          else if (hashCode == USE_EVENT_START_DATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SmoothGroupTimestampOffsetMode::USE_EVENT_START_DATE;
+          case 350016732:
+            if (name == "USE_CONFIGURED_OFFSET")
+            {
+              return SmoothGroupTimestampOffsetMode::USE_CONFIGURED_OFFSET;
+            }
+            break;
+          case -1843868600:
+            if (name == "USE_EVENT_START_DATE")
+            {
+              return SmoothGroupTimestampOffsetMode::USE_EVENT_START_DATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SmoothGroupTimestampOffsetMode::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupTimestampOffsetMode(SmoothGroupTimestampOffsetMode enumValue)
+        const char* GetNameForSmoothGroupTimestampOffsetModeCStr(SmoothGroupTimestampOffsetMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SmoothGroupTimestampOffsetMode::USE_CONFIGURED_OFFSET:
-            return "USE_CONFIGURED_OFFSET";
-          case SmoothGroupTimestampOffsetMode::USE_EVENT_START_DATE:
-            return "USE_EVENT_START_DATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSmoothGroupTimestampOffsetMode(SmoothGroupTimestampOffsetMode enumValue)
+        {
+          return GetNameForSmoothGroupTimestampOffsetModeCStr(enumValue);
         }
 
       } // namespace SmoothGroupTimestampOffsetModeMapper
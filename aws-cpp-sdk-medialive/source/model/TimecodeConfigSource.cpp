@@ -30,25 +30,44 @@ namespace Aws
       namespace TimecodeConfigSourceMapper
       {
 
-        static const int EMBEDDED_HASH = HashingUtils::HashString("EMBEDDED");
-        static const int SYSTEMCLOCK_HASH = HashingUtils::HashString("SYSTEMCLOCK");
-        static const int ZEROBASED_HASH = HashingUtils::HashString("ZEROBASED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EMBEDDED",
+          "SYSTEMCLOCK",
+          "ZEROBASED",
+        };
 
         TimecodeConfigSource GetTimecodeConfigSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EMBEDDED_HASH)
-          {
-            return TimecodeConfigSource::EMBEDDED;
-          }
-          else if (hashCode == SYSTEMCLOCK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TimecodeConfigSource::SYSTEMCLOCK;
-          }
-          else if (hashCode == ZEROBASED_HASH)
-          {
-            return TimecodeConfigSource::ZEROBASED;
+          case 1568475786:
+            if (name == "EMBEDDED")
+            {
+              return TimecodeConfigSource::EMBEDDED;
+            }
+            break;
+          case 621282079:
+            if (name == "SYSTEMCLOCK")
+            {
+              return TimecodeConfigSource::SYSTEMCLOCK;
+            }
+            break;
+          case -1676751381:
+            if (name == "ZEROBASED")
+            {
+              return TimecodeConfigSource::ZEROBASED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TimecodeConfigSource::NOT_SET;
         }
 
-        Aws::String GetNameForTimecodeConfigSource(TimecodeConfigSource enumValue)
+        const char* GetNameForTimecodeConfigSourceCStr(TimecodeConfigSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TimecodeConfigSource::EMBEDDED:
-            return "EMBEDDED";
-          case TimecodeConfigSource::SYSTEMCLOCK:
-            return "SYSTEMCLOCK";
-          case TimecodeConfigSource::ZEROBASED:
-            return "ZEROBASED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTimecodeConfigSource(TimecodeConfigSource enumValue)
+        {
+          return GetNameForTimecodeConfigSourceCStr(enumValue);
         }
 
       } // namespace TimecodeConfigSourceMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TtmlDestinationStyleControlMapper
       {
 
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-        static const int USE_CONFIGURED_HASH = HashingUtils::HashString("USE_CONFIGURED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PASSTHROUGH",
+          "USE_CONFIGURED",
+        };
 
         TtmlDestinationStyleControl GetTtmlDestinationStyleControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PASSTHROUGH_HASH)
-          {
-            return TtmlDestinationStyleControl::PASSTHROUGH;
-          }
-          else if (hashCode == USE_CONFIGURED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TtmlDestinationStyleControl::USE_CONFIGURED;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return TtmlDestinationStyleControl::PASSTHROUGH;
+            }
+            break;
+          case -177742826:
+            if (name == "USE_CONFIGURED")
+            {
+              return TtmlDestinationStyleControl::USE_CONFIGURED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TtmlDestinationStyleControl::NOT_SET;
         }
 
-        Aws::String GetNameForTtmlDestinationStyleControl(TtmlDestinationStyleControl enumValue)
+        const char* GetNameForTtmlDestinationStyleControlCStr(TtmlDestinationStyleControl enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TtmlDestinationStyleControl::PASSTHROUGH:
-            return "PASSTHROUGH";
-          case TtmlDestinationStyleControl::USE_CONFIGURED:
-            return "USE_CONFIGURED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTtmlDestinationStyleControl(TtmlDestinationStyleControl enumValue)
+        {
+          return GetNameForTtmlDestinationStyleControlCStr(enumValue);
         }
 
       } // namespace TtmlDestinationStyleControlMapper
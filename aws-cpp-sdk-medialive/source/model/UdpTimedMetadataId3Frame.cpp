@@ -30,25 +30,44 @@ namespace Aws
       namespace UdpTimedMetadataId3FrameMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PRIV_HASH = HashingUtils::HashString("PRIV");
-        static const int TDRL_HASH = HashingUtils::HashString("TDRL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "PRIV",
+          "TDRL",
+        };
 
         UdpTimedMetadataId3Frame GetUdpTimedMetadataId3FrameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return UdpTimedMetadataId3Frame::NONE;
-          }
-          else if (hashCode == PRIV_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UdpTimedMetadataId3Frame::PRIV;
-          }
-          else if (hashCode == TDRL_HASH)
-          {
-            return UdpTimedMetadataId3Frame::TDRL;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return UdpTimedMetadataId3Frame::NONE;
+            }
+            break;
+          case 2464431:
+            if (name == "PRIV")
+            {
+              return UdpTimedMetadataId3Frame::PRIV;
+            }
+            break;
+          case 2570410:
+            if (name == "TDRL")
+            {
+              return UdpTimedMetadataId3Frame::TDRL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return UdpTimedMetadataId3Frame::NOT_SET;
         }
 
-        Aws::String GetNameForUdpTimedMetadataId3Frame(UdpTimedMetadataId3Frame enumValue)
+        const char* GetNameForUdpTimedMetadataId3FrameCStr(UdpTimedMetadataId3Frame enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UdpTimedMetadataId3Frame::NONE:
-            return "NONE";
-          case UdpTimedMetadataId3Frame::PRIV:
-            return "PRIV";
-          case UdpTimedMetadataId3Frame::TDRL:
-            return "TDRL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUdpTimedMetadataId3Frame(UdpTimedMetadataId3Frame enumValue)
+        {
+          return GetNameForUdpTimedMetadataId3FrameCStr(enumValue);
         }
 
       } // namespace UdpTimedMetadataId3FrameMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace VideoDescriptionRespondToAfdMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-        static const int RESPOND_HASH = HashingUtils::HashString("RESPOND");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "PASSTHROUGH",
+          "RESPOND",
+        };
 
         VideoDescriptionRespondToAfd GetVideoDescriptionRespondToAfdForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return VideoDescriptionRespondToAfd::NONE;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VideoDescriptionRespondToAfd::PASSTHROUGH;
-          }
-          else if (hashCode == RESPOND_HASH)
-          {
-            return VideoDescriptionRespondToAfd::RESPOND;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return VideoDescriptionRespondToAfd::NONE;
+            }
+            break;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return VideoDescriptionRespondToAfd::PASSTHROUGH;
+            }
+            break;
+          case 1815383157:
+            if (name == "RESPOND")
+            {
+              return VideoDescriptionRespondToAfd::RESPOND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return VideoDescriptionRespondToAfd::NOT_SET;
         }
 
-        Aws::String GetNameForVideoDescriptionRespondToAfd(VideoDescriptionRespondToAfd enumValue)
+        const char* GetNameForVideoDescriptionRespondToAfdCStr(VideoDescriptionRespondToAfd enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VideoDescriptionRespondToAfd::NONE:
-            return "NONE";
-          case VideoDescriptionRespondToAfd::PASSTHROUGH:
-            return "PASSTHROUGH";
-          case VideoDescriptionRespondToAfd::RESPOND:
-            return "RESPOND";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVideoDescriptionRespondToAfd(VideoDescriptionRespondToAfd enumValue)
+        {
+          return GetNameForVideoDescriptionRespondToAfdCStr(enumValue);
         }
 
       } // namespace VideoDescriptionRespondToAfdMapper
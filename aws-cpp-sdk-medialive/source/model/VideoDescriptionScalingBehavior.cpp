@@ -30,20 +30,37 @@ namespace Aws
       namespace VideoDescriptionScalingBehaviorMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int STRETCH_TO_OUTPUT_HASH = HashingUtils::HashString("STRETCH_TO_OUTPUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "STRETCH_TO_OUTPUT",
+        };
 
         VideoDescriptionScalingBehavior GetVideoDescriptionScalingBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return VideoDescriptionScalingBehavior::DEFAULT;
-          }
-          else if (hashCode == STRETCH_TO_OUTPUT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VideoDescriptionScalingBehavior::STRETCH_TO_OUTPUT;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return VideoDescriptionScalingBehavior::DEFAULT;
+            }
+            break;
+          case -2079055253:
+            if (name == "STRETCH_TO_OUTPUT")
+            {
+              return VideoDescriptionScalingBehavior::STRETCH_TO_OUTPUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return VideoDescriptionScalingBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForVideoDescriptionScalingBehavior(VideoDescriptionScalingBehavior enumValue)
+        const char* GetNameForVideoDescriptionScalingBehaviorCStr(VideoDescriptionScalingBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VideoDescriptionScalingBehavior::DEFAULT:
-            return "DEFAULT";
-          case VideoDescriptionScalingBehavior::STRETCH_TO_OUTPUT:
-            return "STRETCH_TO_OUTPUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVideoDescriptionScalingBehavior(VideoDescriptionScalingBehavior enumValue)
+        {
+          return GetNameForVideoDescriptionScalingBehaviorCStr(enumValue);
         }
 
       } // namespace VideoDescriptionScalingBehaviorMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace VideoSelectorColorSpaceMapper
       {
 
-        static const int FOLLOW_HASH = HashingUtils::HashString("FOLLOW");
-        static const int REC_601_HASH = HashingUtils::HashString("REC_601");
-        static const int REC_709_HASH = HashingUtils::HashString("REC_709");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FOLLOW",
+          "REC_601",
+          "REC_709",
+        };
 
         VideoSelectorColorSpace GetVideoSelectorColorSpaceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_HASH)
-          {
-            return VideoSelectorColorSpace::FOLLOW;
-          }
-          else if (hashCode == REC_601_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VideoSelectorColorSpace::REC_601;
-          }
-          else if (hashCode == REC_709_HASH)
-          {
-            return VideoSelectorColorSpace::REC_709;
+          case 2079338417:
+            if (name == "FOLLOW")
+            {
+              return VideoSelectorColorSpace::FOLLOW;
+            }
+            break;
+          case 1801028712:
+            if (name == "REC_601")
+            {
+              return VideoSelectorColorSpace::REC_601;
+            }
+            break;
+          case 1801029681:
+            if (name == "REC_709")
+            {
+              return VideoSelectorColorSpace::REC_709;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return VideoSelectorColorSpace::NOT_SET;
         }
 
-        Aws::String GetNameForVideoSelectorColorSpace(VideoSelectorColorSpace enumValue)
+        const char* GetNameForVideoSelectorColorSpaceCStr(VideoSelectorColorSpace enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VideoSelectorColorSpace::FOLLOW:
-            return "FOLLOW";
-          case VideoSelectorColorSpace::REC_601:
-            return "REC_601";
-          case VideoSelectorColorSpace::REC_709:
-            return "REC_709";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVideoSelectorColorSpace(VideoSelectorColorSpace enumValue)
+        {
+          return GetNameForVideoSelectorColorSpaceCStr(enumValue);
         }
 
       } // namespace VideoSelectorColorSpaceMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace VideoSelectorColorSpaceUsageMapper
       {
 
-        static const int FALLBACK_HASH = HashingUtils::HashString("FALLBACK");
-        static const int FORCE_HASH = HashingUtils::HashString("FORCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FALLBACK",
+          "FORCE",
+        };
 
         VideoSelectorColorSpaceUsage GetVideoSelectorColorSpaceUsageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FALLBACK_HASH)
-          {
-            return VideoSelectorColorSpaceUsage::FALLBACK;
-          }
-          else if (hashCode == FORCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VideoSelectorColorSpaceUsage::FORCE;
+          case 1543870178:
+            if (name == "FALLBACK")
+            {
+              return VideoSelectorColorSpaceUsage::FALLBACK;
+            }
+            break;
+          case 67080907:
+            if (name == "FORCE")
+            {
+              return VideoSelectorColorSpaceUsage::FORCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return VideoSelectorColorSpaceUsage::NOT_SET;
         }
 
-        Aws::String GetNameForVideoSelectorColorSpaceUsage(VideoSelectorColorSpaceUsage enumValue)
+        const char* GetNameForVideoSelectorColorSpaceUsageCStr(VideoSelectorColorSpaceUsage enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VideoSelectorColorSpaceUsage::FALLBACK:
-            return "FALLBACK";
-          case VideoSelectorColorSpaceUsage::FORCE:
-            return "FORCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVideoSelectorColorSpaceUsage(VideoSelectorColorSpaceUsage enumValue)
+        {
+          return GetNameForVideoSelectorColorSpaceUsageCStr(enumValue);
         }
 
       } // namespace VideoSelectorColorSpaceUsageMapper
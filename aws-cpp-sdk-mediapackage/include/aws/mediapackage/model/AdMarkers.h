@@ -36,6 +36,11 @@ namespace AdMarkersMapper
 AWS_MEDIAPACKAGE_API AdMarkers GetAdMarkersForName(const Aws::String& name);
 
 AWS_MEDIAPACKAGE_API Aws::String GetNameForAdMarkers(AdMarkers value);
+
+/**
+ * Same as GetNameForAdMarkers(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIAPACKAGE_API const char* GetNameForAdMarkersCStr(AdMarkers value);
 } // namespace AdMarkersMapper
 } // namespace Model
 } // namespace MediaPackage
@@ -35,6 +35,11 @@ namespace EncryptionMethodMapper
 AWS_MEDIAPACKAGE_API EncryptionMethod GetEncryptionMethodForName(const Aws::String& name);
 
 AWS_MEDIAPACKAGE_API Aws::String GetNameForEncryptionMethod(EncryptionMethod value);
+
+/**
+ * Same as GetNameForEncryptionMethod(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIAPACKAGE_API const char* GetNameForEncryptionMethodCStr(EncryptionMethod value);
 } // namespace EncryptionMethodMapper
 } // namespace Model
 } // namespace MediaPackage
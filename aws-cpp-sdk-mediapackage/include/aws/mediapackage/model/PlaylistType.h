@@ -36,6 +36,11 @@ namespace PlaylistTypeMapper
 AWS_MEDIAPACKAGE_API PlaylistType GetPlaylistTypeForName(const Aws::String& name);
 
 AWS_MEDIAPACKAGE_API Aws::String GetNameForPlaylistType(PlaylistType value);
+
+/**
+ * Same as GetNameForPlaylistType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIAPACKAGE_API const char* GetNameForPlaylistTypeCStr(PlaylistType value);
 } // namespace PlaylistTypeMapper
 } // namespace Model
 } // namespace MediaPackage
@@ -35,6 +35,11 @@ namespace ProfileMapper
 AWS_MEDIAPACKAGE_API Profile GetProfileForName(const Aws::String& name);
 
 AWS_MEDIAPACKAGE_API Aws::String GetNameForProfile(Profile value);
+
+/**
+ * Same as GetNameForProfile(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIAPACKAGE_API const char* GetNameForProfileCStr(Profile value);
 } // namespace ProfileMapper
 } // namespace Model
 } // namespace MediaPackage
@@ -36,6 +36,11 @@ namespace StreamOrderMapper
 AWS_MEDIAPACKAGE_API StreamOrder GetStreamOrderForName(const Aws::String& name);
 
 AWS_MEDIAPACKAGE_API Aws::String GetNameForStreamOrder(StreamOrder value);
+
+/**
+ * Same as GetNameForStreamOrder(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIAPACKAGE_API const char* GetNameForStreamOrderCStr(StreamOrder value);
 } // namespace StreamOrderMapper
 } // namespace Model
 } // namespace MediaPackage
@@ -34,6 +34,11 @@ namespace __PeriodTriggersElementMapper
 AWS_MEDIAPACKAGE_API __PeriodTriggersElement Get__PeriodTriggersElementForName(const Aws::String& name);
 
 AWS_MEDIAPACKAGE_API Aws::String GetNameFor__PeriodTriggersElement(__PeriodTriggersElement value);
+
+/**
+ * Same as GetNameFor__PeriodTriggersElement(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIAPACKAGE_API const char* GetNameFor__PeriodTriggersElementCStr(__PeriodTriggersElement value);
 } // namespace __PeriodTriggersElementMapper
 } // namespace Model
 } // namespace MediaPackage
@@ -30,25 +30,44 @@ namespace Aws
       namespace AdMarkersMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SCTE35_ENHANCED_HASH = HashingUtils::HashString("SCTE35_ENHANCED");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "SCTE35_ENHANCED",
+          "PASSTHROUGH",
+        };
 
         AdMarkers GetAdMarkersForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return AdMarkers::NONE;
-          }
-          else if (hashCode == SCTE35_ENHANCED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AdMarkers::SCTE35_ENHANCED;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
-          {
-            return AdMarkers::PASSTHROUGH;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return AdMarkers::NONE;
+            }
+            break;
+          case 1940171090:
+            if (name == "SCTE35_ENHANCED")
+            {
+              return AdMarkers::SCTE35_ENHANCED;
+            }
+            break;
+          case 694170996:
+            if (name == "PASSTHROUGH")
+            {
+              return AdMarkers::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AdMarkers::NOT_SET;
         }
 
-        Aws::String GetNameForAdMarkers(AdMarkers enumValue)
+        const char* GetNameForAdMarkersCStr(AdMarkers enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AdMarkers::NONE:
-            return "NONE";
-          case AdMarkers::SCTE35_ENHANCED:
-            return "SCTE35_ENHANCED";
-          case AdMarkers::PASSTHROUGH:
-            return "PASSTHROUGH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAdMarkers(AdMarkers enumValue)
+        {
+          return GetNameForAdMarkersCStr(enumValue);
         }
 
       } // namespace AdMarkersMapper
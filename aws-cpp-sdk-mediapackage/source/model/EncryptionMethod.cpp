@@ -30,20 +30,37 @@ namespace Aws
       namespace EncryptionMethodMapper
       {
 
-        static const int AES_128_HASH = HashingUtils::HashString("AES_128");
-        static const int SAMPLE_AES_HASH = HashingUtils::HashString("SAMPLE_AES");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AES_128",
+          "SAMPLE_AES",
+        };
 
         EncryptionMethod GetEncryptionMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES_128_HASH)
-          {
-            return EncryptionMethod::AES_128;
-          }
-          else if (hashCode == SAMPLE_AES_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EncryptionMethod::SAMPLE_AES;
+          case -386860377:
+            if (name == "AES_128")
+            {
+              return EncryptionMethod::AES_128;
+            }
+            break;
+          case 629518490:
+            if (name == "SAMPLE_AES")
+            {
+              return EncryptionMethod::SAMPLE_AES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EncryptionMethod::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionMethod(EncryptionMethod enumValue)
+        const char* GetNameForEncryptionMethodCStr(EncryptionMethod enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EncryptionMethod::AES_128:
-            return "AES_128";
-          case EncryptionMethod::SAMPLE_AES:
-            return "SAMPLE_AES";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEncryptionMethod(EncryptionMethod enumValue)
+        {
+          return GetNameForEncryptionMethodCStr(enumValue);
         }
 
       } // namespace EncryptionMethodMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PlaylistTypeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int EVENT_HASH = HashingUtils::HashString("EVENT");
-        static const int VOD_HASH = HashingUtils::HashString("VOD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "EVENT",
+          "VOD",
+        };
 
         PlaylistType GetPlaylistTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return PlaylistType::NONE;
-          }
-          else if (hashCode == EVENT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlaylistType::EVENT;
-          }
-          else if (hashCode == VOD_HASH)
-          {
-            return PlaylistType::VOD;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return PlaylistType::NONE;
+            }
+            break;
+          case 66353786:
+            if (name == "EVENT")
+            {
+              return PlaylistType::EVENT;
+            }
+            break;
+          case 85163:
+            if (name == "VOD")
+            {
+              return PlaylistType::VOD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PlaylistType::NOT_SET;
         }
 
-        Aws::String GetNameForPlaylistType(PlaylistType enumValue)
+        const char* GetNameForPlaylistTypeCStr(PlaylistType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlaylistType::NONE:
-            return "NONE";
-          case PlaylistType::EVENT:
-            return "EVENT";
-          case PlaylistType::VOD:
-            return "VOD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlaylistType(PlaylistType enumValue)
+        {
+          return GetNameForPlaylistTypeCStr(enumValue);
         }
 
       } // namespace PlaylistTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ProfileMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int HBBTV_1_5_HASH = HashingUtils::HashString("HBBTV_1_5");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "HBBTV_1_5",
+        };
 
         Profile GetProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return Profile::NONE;
-          }
-          else if (hashCode == HBBTV_1_5_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Profile::HBBTV_1_5;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Profile::NONE;
+            }
+            break;
+          case -1293484814:
+            if (name == "HBBTV_1_5")
+            {
+              return Profile::HBBTV_1_5;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Profile::NOT_SET;
         }
 
-        Aws::String GetNameForProfile(Profile enumValue)
+        const char* GetNameForProfileCStr(Profile enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Profile::NONE:
-            return "NONE";
-          case Profile::HBBTV_1_5:
-            return "HBBTV_1_5";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProfile(Profile enumValue)
+        {
+          return GetNameForProfileCStr(enumValue);
         }
 
       } // namespace ProfileMapper
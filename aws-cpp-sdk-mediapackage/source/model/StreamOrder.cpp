@@ -30,25 +30,44 @@ namespace Aws
       namespace StreamOrderMapper
       {
 
-        static const int ORIGINAL_HASH = HashingUtils::HashString("ORIGINAL");
-        static const int VIDEO_BITRATE_ASCENDING_HASH = HashingUtils::HashString("VIDEO_BITRATE_ASCENDING");
-        static const int VIDEO_BITRATE_DESCENDING_HASH = HashingUtils::HashString("VIDEO_BITRATE_DESCENDING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ORIGINAL",
+          "VIDEO_BITRATE_ASCENDING",
+          "VIDEO_BITRATE_DESCENDING",
+        };
 
         StreamOrder GetStreamOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ORIGINAL_HASH)
-          {
-            return StreamOrder::ORIGINAL;
-          }
-          else if (hashCode == VIDEO_BITRATE_ASCENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StreamOrder::VIDEO_BITRATE_ASCENDING;
-          }
-          else if (hashCode == VIDEO_BITRATE_DESCENDING_HASH)
-          {
-            return StreamOrder::VIDEO_BITRATE_DESCENDING;
+          case -2133296687:
+            if (name == "ORIGINAL")
+            {
+              return StreamOrder::ORIGINAL;
+            }
+            break;
+          case -244278942:
+            if (name == "VIDEO_BITRATE_ASCENDING")
+            {
+              return StreamOrder::VIDEO_BITRATE_ASCENDING;
+            }
+            break;
+          case 53879182:
+            if (name == "VIDEO_BITRATE_DESCENDING")
+            {
+              return StreamOrder::VIDEO_BITRATE_DESCENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StreamOrder::NOT_SET;
         }
 
-        Aws::String GetNameForStreamOrder(StreamOrder enumValue)
+        const char* GetNameForStreamOrderCStr(StreamOrder enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StreamOrder::ORIGINAL:
-            return "ORIGINAL";
-          case StreamOrder::VIDEO_BITRATE_ASCENDING:
-            return "VIDEO_BITRATE_ASCENDING";
-          case StreamOrder::VIDEO_BITRATE_DESCENDING:
-            return "VIDEO_BITRATE_DESCENDING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStreamOrder(StreamOrder enumValue)
+        {
+          return GetNameForStreamOrderCStr(enumValue);
         }
 
       } // namespace StreamOrderMapper
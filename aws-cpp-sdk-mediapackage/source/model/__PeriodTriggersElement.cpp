@@ -30,15 +30,30 @@ namespace Aws
       namespace __PeriodTriggersElementMapper
       {
 
-        static const int ADS_HASH = HashingUtils::HashString("ADS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADS",
+        };
 
         __PeriodTriggersElement Get__PeriodTriggersElementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return __PeriodTriggersElement::ADS;
+          case 64656:
+            if (name == "ADS")
+            {
+              return __PeriodTriggersElement::ADS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return __PeriodTriggersElement::NOT_SET;
         }
 
-        Aws::String GetNameFor__PeriodTriggersElement(__PeriodTriggersElement enumValue)
+        const char* GetNameFor__PeriodTriggersElementCStr(__PeriodTriggersElement enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case __PeriodTriggersElement::ADS:
-            return "ADS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameFor__PeriodTriggersElement(__PeriodTriggersElement enumValue)
+        {
+          return GetNameFor__PeriodTriggersElementCStr(enumValue);
         }
 
       } // namespace __PeriodTriggersElementMapper
@@ -35,6 +35,11 @@ namespace ItemTypeMapper
 AWS_MEDIASTOREDATA_API ItemType GetItemTypeForName(const Aws::String& name);
 
 AWS_MEDIASTOREDATA_API Aws::String GetNameForItemType(ItemType value);
+
+/**
+ * Same as GetNameForItemType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIASTOREDATA_API const char* GetNameForItemTypeCStr(ItemType value);
 } // namespace ItemTypeMapper
 } // namespace Model
 } // namespace MediaStoreData
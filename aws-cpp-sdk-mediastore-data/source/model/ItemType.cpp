@@ -30,20 +30,37 @@ namespace Aws
       namespace ItemTypeMapper
       {
 
-        static const int OBJECT_HASH = HashingUtils::HashString("OBJECT");
-        static const int FOLDER_HASH = HashingUtils::HashString("FOLDER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OBJECT",
+          "FOLDER",
+        };
 
         ItemType GetItemTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OBJECT_HASH)
-          {
-            return ItemType::OBJECT;
-          }
-          else if (hashCode == FOLDER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ItemType::FOLDER;
+          case -1970038977:
+            if (name == "OBJECT")
+            {
+              return ItemType::OBJECT;
+            }
+            break;
+          case 2079330414:
+            if (name == "FOLDER")
+            {
+              return ItemType::FOLDER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ItemType::NOT_SET;
         }
 
-        Aws::String GetNameForItemType(ItemType enumValue)
+        const char* GetNameForItemTypeCStr(ItemType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ItemType::OBJECT:
-            return "OBJECT";
-          case ItemType::FOLDER:
-            return "FOLDER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForItemType(ItemType enumValue)
+        {
+          return GetNameForItemTypeCStr(enumValue);
         }
 
       } // namespace ItemTypeMapper
@@ -36,6 +36,11 @@ namespace ContainerStatusMapper
 AWS_MEDIASTORE_API ContainerStatus GetContainerStatusForName(const Aws::String& name);
 
 AWS_MEDIASTORE_API Aws::String GetNameForContainerStatus(ContainerStatus value);
+
+/**
+ * Same as GetNameForContainerStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIASTORE_API const char* GetNameForContainerStatusCStr(ContainerStatus value);
 } // namespace ContainerStatusMapper
 } // namespace Model
 } // namespace MediaStore
@@ -37,6 +37,11 @@ namespace MethodNameMapper
 AWS_MEDIASTORE_API MethodName GetMethodNameForName(const Aws::String& name);
 
 AWS_MEDIASTORE_API Aws::String GetNameForMethodName(MethodName value);
+
+/**
+ * Same as GetNameForMethodName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MEDIASTORE_API const char* GetNameForMethodNameCStr(MethodName value);
 } // namespace MethodNameMapper
 } // namespace Model
 } // namespace MediaStore
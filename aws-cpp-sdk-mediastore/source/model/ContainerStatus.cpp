@@ -30,25 +30,44 @@ namespace Aws
       namespace ContainerStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "CREATING",
+          "DELETING",
+        };
 
         ContainerStatus GetContainerStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return ContainerStatus::ACTIVE;
-          }
-          else if (hashCode == CREATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContainerStatus::CREATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ContainerStatus::DELETING;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ContainerStatus::ACTIVE;
+            }
+            break;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return ContainerStatus::CREATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ContainerStatus::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ContainerStatus::NOT_SET;
         }
 
-        Aws::String GetNameForContainerStatus(ContainerStatus enumValue)
+        const char* GetNameForContainerStatusCStr(ContainerStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContainerStatus::ACTIVE:
-            return "ACTIVE";
-          case ContainerStatus::CREATING:
-            return "CREATING";
-          case ContainerStatus::DELETING:
-            return "DELETING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContainerStatus(ContainerStatus enumValue)
+        {
+          return GetNameForContainerStatusCStr(enumValue);
         }
 
       } // namespace ContainerStatusMapper
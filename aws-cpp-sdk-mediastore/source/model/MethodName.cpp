@@ -30,30 +30,51 @@ namespace Aws
       namespace MethodNameMapper
       {
 
-        static const int PUT_HASH = HashingUtils::HashString("PUT");
-        static const int GET__HASH = HashingUtils::HashString("GET");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
-        static const int HEAD_HASH = HashingUtils::HashString("HEAD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PUT",
+          "GET",
+          "DELETE",
+          "HEAD",
+        };
 
         MethodName GetMethodNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PUT_HASH)
-          {
-            return MethodName::PUT;
-          }
-          else if (hashCode == GET__HASH)
-          {
-            return MethodName::GET_;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return MethodName::DELETE_;
-          }
-          else if (hashCode == HEAD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MethodName::HEAD;
+          case 79599:
+            if (name == "PUT")
+            {
+              return MethodName::PUT;
+            }
+            break;
+          case 70454:
+            if (name == "GET")
+            {
+              return MethodName::GET_;
+            }
+            break;
+          case 2012838315:
+            if (name == "DELETE")
+            {
+              return MethodName::DELETE_;
+            }
+            break;
+          case 2213344:
+            if (name == "HEAD")
+            {
+              return MethodName::HEAD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return MethodName::NOT_SET;
         }
 
-        Aws::String GetNameForMethodName(MethodName enumValue)
+        const char* GetNameForMethodNameCStr(MethodName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MethodName::PUT:
-            return "PUT";
-          case MethodName::GET_:
-            return "GET";
-          case MethodName::DELETE_:
-            return "DELETE";
-          case MethodName::HEAD:
-            return "HEAD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMethodName(MethodName enumValue)
+        {
+          return GetNameForMethodNameCStr(enumValue);
         }
 
       } // namespace MethodNameMapper
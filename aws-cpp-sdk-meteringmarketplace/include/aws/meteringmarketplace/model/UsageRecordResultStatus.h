@@ -36,6 +36,11 @@ namespace UsageRecordResultStatusMapper
 AWS_MARKETPLACEMETERING_API UsageRecordResultStatus GetUsageRecordResultStatusForName(const Aws::String& name);
 
 AWS_MARKETPLACEMETERING_API Aws::String GetNameForUsageRecordResultStatus(UsageRecordResultStatus value);
+
+/**
+ * Same as GetNameForUsageRecordResultStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MARKETPLACEMETERING_API const char* GetNameForUsageRecordResultStatusCStr(UsageRecordResultStatus value);
 } // namespace UsageRecordResultStatusMapper
 } // namespace Model
 } // namespace MarketplaceMetering
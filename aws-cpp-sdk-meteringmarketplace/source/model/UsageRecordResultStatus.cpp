@@ -30,25 +30,44 @@ namespace Aws
       namespace UsageRecordResultStatusMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int CustomerNotSubscribed_HASH = HashingUtils::HashString("CustomerNotSubscribed");
-        static const int DuplicateRecord_HASH = HashingUtils::HashString("DuplicateRecord");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Success",
+          "CustomerNotSubscribed",
+          "DuplicateRecord",
+        };
 
         UsageRecordResultStatus GetUsageRecordResultStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
-          {
-            return UsageRecordResultStatus::Success;
-          }
-          else if (hashCode == CustomerNotSubscribed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UsageRecordResultStatus::CustomerNotSubscribed;
-          }
-          else if (hashCode == DuplicateRecord_HASH)
-          {
-            return UsageRecordResultStatus::DuplicateRecord;
+          case -202516509:
+            if (name == "Success")
+            {
+              return UsageRecordResultStatus::Success;
+            }
+            break;
+          case 1399611439:
+            if (name == "CustomerNotSubscribed")
+            {
+              return UsageRecordResultStatus::CustomerNotSubscribed;
+            }
+            break;
+          case -342546148:
+            if (name == "DuplicateRecord")
+            {
+              return UsageRecordResultStatus::DuplicateRecord;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return UsageRecordResultStatus::NOT_SET;
         }
 
-        Aws::String GetNameForUsageRecordResultStatus(UsageRecordResultStatus enumValue)
+        const char* GetNameForUsageRecordResultStatusCStr(UsageRecordResultStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UsageRecordResultStatus::Success:
-            return "Success";
-          case UsageRecordResultStatus::CustomerNotSubscribed:
-            return "CustomerNotSubscribed";
-          case UsageRecordResultStatus::DuplicateRecord:
-            return "DuplicateRecord";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUsageRecordResultStatus(UsageRecordResultStatus enumValue)
+        {
+          return GetNameForUsageRecordResultStatusCStr(enumValue);
         }
 
       } // namespace UsageRecordResultStatusMapper
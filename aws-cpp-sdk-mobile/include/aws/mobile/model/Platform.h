@@ -40,6 +40,11 @@ namespace PlatformMapper
 AWS_MOBILE_API Platform GetPlatformForName(const Aws::String& name);
 
 AWS_MOBILE_API Aws::String GetNameForPlatform(Platform value);
+
+/**
+ * Same as GetNameForPlatform(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MOBILE_API const char* GetNameForPlatformCStr(Platform value);
 } // namespace PlatformMapper
 } // namespace Model
 } // namespace Mobile
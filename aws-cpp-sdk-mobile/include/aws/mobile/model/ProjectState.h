@@ -36,6 +36,11 @@ namespace ProjectStateMapper
 AWS_MOBILE_API ProjectState GetProjectStateForName(const Aws::String& name);
 
 AWS_MOBILE_API Aws::String GetNameForProjectState(ProjectState value);
+
+/**
+ * Same as GetNameForProjectState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MOBILE_API const char* GetNameForProjectStateCStr(ProjectState value);
 } // namespace ProjectStateMapper
 } // namespace Model
 } // namespace Mobile
@@ -30,45 +30,72 @@ namespace Aws
       namespace PlatformMapper
       {
 
-        static const int OSX_HASH = HashingUtils::HashString("OSX");
-        static const int WINDOWS_HASH = HashingUtils::HashString("WINDOWS");
-        static const int LINUX_HASH = HashingUtils::HashString("LINUX");
-        static const int OBJC_HASH = HashingUtils::HashString("OBJC");
-        static const int SWIFT_HASH = HashingUtils::HashString("SWIFT");
-        static const int ANDROID__HASH = HashingUtils::HashString("ANDROID");
-        static const int JAVASCRIPT_HASH = HashingUtils::HashString("JAVASCRIPT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OSX",
+          "WINDOWS",
+          "LINUX",
+          "OBJC",
+          "SWIFT",
+          "ANDROID",
+          "JAVASCRIPT",
+        };
 
         Platform GetPlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OSX_HASH)
-          {
-            return Platform::OSX;
-          }
-          else if (hashCode == WINDOWS_HASH)
-          {
-            return Platform::WINDOWS;
-          }
-          else if (hashCode == LINUX_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Platform::LINUX;
-          }
-          else if (hashCode == OBJC_HASH)
-          {
-            return Platform::OBJC;
-          }
-          else if (hashCode == SWIFT_HASH)
-          {
-            return Platform::SWIFT;
-          }
-          else if (hashCode == ANDROID__HASH)
-          {
-            return Platform::ANDROID_;
-          }
-          else if (hashCode == JAVASCRIPT_HASH)
-          {
-            return Platform::JAVASCRIPT;
+          case 78580:
+            if (name == "OSX")
+            {
+              return Platform::OSX;
+            }
+            break;
+          case 2067476067:
+            if (name == "WINDOWS")
+            {
+              return Platform::WINDOWS;
+            }
+            break;
+          case 72440020:
+            if (name == "LINUX")
+            {
+              return Platform::LINUX;
+            }
+            break;
+          case 2419276:
+            if (name == "OBJC")
+            {
+              return Platform::OBJC;
+            }
+            break;
+          case 79316467:
+            if (name == "SWIFT")
+            {
+              return Platform::SWIFT;
+            }
+            break;
+          case -143408561:
+            if (name == "ANDROID")
+            {
+              return Platform::ANDROID_;
+            }
+            break;
+          case 674088301:
+            if (name == "JAVASCRIPT")
+            {
+              return Platform::JAVASCRIPT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return Platform::NOT_SET;
         }
 
-        Aws::String GetNameForPlatform(Platform enumValue)
+        const char* GetNameForPlatformCStr(Platform enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Platform::OSX:
-            return "OSX";
-          case Platform::WINDOWS:
-            return "WINDOWS";
-          case Platform::LINUX:
-            return "LINUX";
-          case Platform::OBJC:
-            return "OBJC";
-          case Platform::SWIFT:
-            return "SWIFT";
-          case Platform::ANDROID_:
-            return "ANDROID";
-          case Platform::JAVASCRIPT:
-            return "JAVASCRIPT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlatform(Platform enumValue)
+        {
+          return GetNameForPlatformCStr(enumValue);
         }
 
       } // namespace PlatformMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ProjectStateMapper
       {
 
-        static const int NORMAL_HASH = HashingUtils::HashString("NORMAL");
-        static const int SYNCING_HASH = HashingUtils::HashString("SYNCING");
-        static const int IMPORTING_HASH = HashingUtils::HashString("IMPORTING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NORMAL",
+          "SYNCING",
+          "IMPORTING",
+        };
 
         ProjectState GetProjectStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NORMAL_HASH)
-          {
-            return ProjectState::NORMAL;
-          }
-          else if (hashCode == SYNCING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProjectState::SYNCING;
-          }
-          else if (hashCode == IMPORTING_HASH)
-          {
-            return ProjectState::IMPORTING;
+          case -1986416409:
+            if (name == "NORMAL")
+            {
+              return ProjectState::NORMAL;
+            }
+            break;
+          case -1024508089:
+            if (name == "SYNCING")
+            {
+              return ProjectState::SYNCING;
+            }
+            break;
+          case -1716890115:
+            if (name == "IMPORTING")
+            {
+              return ProjectState::IMPORTING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ProjectState::NOT_SET;
         }
 
-        Aws::String GetNameForProjectState(ProjectState enumValue)
+        const char* GetNameForProjectStateCStr(ProjectState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProjectState::NORMAL:
-            return "NORMAL";
-          case ProjectState::SYNCING:
-            return "SYNCING";
-          case ProjectState::IMPORTING:
-            return "IMPORTING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProjectState(ProjectState enumValue)
+        {
+          return GetNameForProjectStateCStr(enumValue);
         }
 
       } // namespace ProjectStateMapper
@@ -36,6 +36,11 @@ namespace HistoryItemTypeMapper
 AWS_CLOUDWATCH_API HistoryItemType GetHistoryItemTypeForName(const Aws::String& name);
 
 AWS_CLOUDWATCH_API Aws::String GetNameForHistoryItemType(HistoryItemType value);
+
+/**
+ * Same as GetNameForHistoryItemType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCH_API const char* GetNameForHistoryItemTypeCStr(HistoryItemType value);
 } // namespace HistoryItemTypeMapper
 } // namespace Model
 } // namespace CloudWatch
@@ -35,6 +35,11 @@ namespace ScanByMapper
 AWS_CLOUDWATCH_API ScanBy GetScanByForName(const Aws::String& name);
 
 AWS_CLOUDWATCH_API Aws::String GetNameForScanBy(ScanBy value);
+
+/**
+ * Same as GetNameForScanBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCH_API const char* GetNameForScanByCStr(ScanBy value);
 } // namespace ScanByMapper
 } // namespace Model
 } // namespace CloudWatch
@@ -60,6 +60,11 @@ namespace StandardUnitMapper
 AWS_CLOUDWATCH_API StandardUnit GetStandardUnitForName(const Aws::String& name);
 
 AWS_CLOUDWATCH_API Aws::String GetNameForStandardUnit(StandardUnit value);
+
+/**
+ * Same as GetNameForStandardUnit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCH_API const char* GetNameForStandardUnitCStr(StandardUnit value);
 } // namespace StandardUnitMapper
 } // namespace Model
 } // namespace CloudWatch
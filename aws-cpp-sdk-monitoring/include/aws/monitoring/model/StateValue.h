@@ -36,6 +36,11 @@ namespace StateValueMapper
 AWS_CLOUDWATCH_API StateValue GetStateValueForName(const Aws::String& name);
 
 AWS_CLOUDWATCH_API Aws::String GetNameForStateValue(StateValue value);
+
+/**
+ * Same as GetNameForStateValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCH_API const char* GetNameForStateValueCStr(StateValue value);
 } // namespace StateValueMapper
 } // namespace Model
 } // namespace CloudWatch
@@ -38,6 +38,11 @@ namespace StatisticMapper
 AWS_CLOUDWATCH_API Statistic GetStatisticForName(const Aws::String& name);
 
 AWS_CLOUDWATCH_API Aws::String GetNameForStatistic(Statistic value);
+
+/**
+ * Same as GetNameForStatistic(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCH_API const char* GetNameForStatisticCStr(Statistic value);
 } // namespace StatisticMapper
 } // namespace Model
 } // namespace CloudWatch
@@ -36,6 +36,11 @@ namespace StatusCodeMapper
 AWS_CLOUDWATCH_API StatusCode GetStatusCodeForName(const Aws::String& name);
 
 AWS_CLOUDWATCH_API Aws::String GetNameForStatusCode(StatusCode value);
+
+/**
+ * Same as GetNameForStatusCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_CLOUDWATCH_API const char* GetNameForStatusCodeCStr(StatusCode value);
 } // namespace StatusCodeMapper
 } // namespace Model
 } // namespace CloudWatch
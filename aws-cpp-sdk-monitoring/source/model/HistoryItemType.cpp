@@ -30,25 +30,44 @@ namespace Aws
       namespace HistoryItemTypeMapper
       {
 
-        static const int ConfigurationUpdate_HASH = HashingUtils::HashString("ConfigurationUpdate");
-        static const int StateUpdate_HASH = HashingUtils::HashString("StateUpdate");
-        static const int Action_HASH = HashingUtils::HashString("Action");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ConfigurationUpdate",
+          "StateUpdate",
+          "Action",
+        };
 
         HistoryItemType GetHistoryItemTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ConfigurationUpdate_HASH)
-          {
-            return HistoryItemType::ConfigurationUpdate;
-          }
-          else if (hashCode == StateUpdate_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HistoryItemType::StateUpdate;
-          }
-          else if (hashCode == Action_HASH)
-          {
-            return HistoryItemType::Action;
+          case 186798399:
+            if (name == "ConfigurationUpdate")
+            {
+              return HistoryItemType::ConfigurationUpdate;
+            }
+            break;
+          case -1382145894:
+            if (name == "StateUpdate")
+            {
+              return HistoryItemType::StateUpdate;
+            }
+            break;
+          case 1955883606:
+            if (name == "Action")
+            {
+              return HistoryItemType::Action;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return HistoryItemType::NOT_SET;
         }
 
-        Aws::String GetNameForHistoryItemType(HistoryItemType enumValue)
+        const char* GetNameForHistoryItemTypeCStr(HistoryItemType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HistoryItemType::ConfigurationUpdate:
-            return "ConfigurationUpdate";
-          case HistoryItemType::StateUpdate:
-            return "StateUpdate";
-          case HistoryItemType::Action:
-            return "Action";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHistoryItemType(HistoryItemType enumValue)
+        {
+          return GetNameForHistoryItemTypeCStr(enumValue);
         }
 
       } // namespace HistoryItemTypeMapper
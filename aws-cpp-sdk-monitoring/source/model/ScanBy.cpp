@@ -30,20 +30,37 @@ namespace Aws
       namespace ScanByMapper
       {
 
-        static const int TimestampDescending_HASH = HashingUtils::HashString("TimestampDescending");
-        static const int TimestampAscending_HASH = HashingUtils::HashString("TimestampAscending");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TimestampDescending",
+          "TimestampAscending",
+        };
 
         ScanBy GetScanByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TimestampDescending_HASH)
-          {
-            return ScanBy::TimestampDescending;
-          }
-          else if (hashCode == TimestampAscending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScanBy::TimestampAscending;
+          case 659395726:
+            if (name == "TimestampDescending")
+            {
+              return ScanBy::TimestampDescending;
+            }
+            break;
+          case 1160727170:
+            if (name == "TimestampAscending")
+            {
+              return ScanBy::TimestampAscending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ScanBy::NOT_SET;
         }
 
-        Aws::String GetNameForScanBy(ScanBy enumValue)
+        const char* GetNameForScanByCStr(ScanBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScanBy::TimestampDescending:
-            return "TimestampDescending";
-          case ScanBy::TimestampAscending:
-            return "TimestampAscending";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScanBy(ScanBy enumValue)
+        {
+          return GetNameForScanByCStr(enumValue);
         }
 
       } // namespace ScanByMapper
@@ -30,145 +30,212 @@ namespace Aws
       namespace StandardUnitMapper
       {
 
-        static const int Seconds_HASH = HashingUtils::HashString("Seconds");
-        static const int Microseconds_HASH = HashingUtils::HashString("Microseconds");
-        static const int Milliseconds_HASH = HashingUtils::HashString("Milliseconds");
-        static const int Bytes_HASH = HashingUtils::HashString("Bytes");
-        static const int Kilobytes_HASH = HashingUtils::HashString("Kilobytes");
-        static const int Megabytes_HASH = HashingUtils::HashString("Megabytes");
-        static const int Gigabytes_HASH = HashingUtils::HashString("Gigabytes");
-        static const int Terabytes_HASH = HashingUtils::HashString("Terabytes");
-        static const int Bits_HASH = HashingUtils::HashString("Bits");
-        static const int Kilobits_HASH = HashingUtils::HashString("Kilobits");
-        static const int Megabits_HASH = HashingUtils::HashString("Megabits");
-        static const int Gigabits_HASH = HashingUtils::HashString("Gigabits");
-        static const int Terabits_HASH = HashingUtils::HashString("Terabits");
-        static const int Percent_HASH = HashingUtils::HashString("Percent");
-        static const int Count_HASH = HashingUtils::HashString("Count");
-        static const int Bytes_Second_HASH = HashingUtils::HashString("Bytes/Second");
-        static const int Kilobytes_Second_HASH = HashingUtils::HashString("Kilobytes/Second");
-        static const int Megabytes_Second_HASH = HashingUtils::HashString("Megabytes/Second");
-        static const int Gigabytes_Second_HASH = HashingUtils::HashString("Gigabytes/Second");
-        static const int Terabytes_Second_HASH = HashingUtils::HashString("Terabytes/Second");
-        static const int Bits_Second_HASH = HashingUtils::HashString("Bits/Second");
-        static const int Kilobits_Second_HASH = HashingUtils::HashString("Kilobits/Second");
-        static const int Megabits_Second_HASH = HashingUtils::HashString("Megabits/Second");
-        static const int Gigabits_Second_HASH = HashingUtils::HashString("Gigabits/Second");
-        static const int Terabits_Second_HASH = HashingUtils::HashString("Terabits/Second");
-        static const int Count_Second_HASH = HashingUtils::HashString("Count/Second");
-        static const int None_HASH = HashingUtils::HashString("None");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Seconds",
+          "Microseconds",
+          "Milliseconds",
+          "Bytes",
+          "Kilobytes",
+          "Megabytes",
+          "Gigabytes",
+          "Terabytes",
+          "Bits",
+          "Kilobits",
+          "Megabits",
+          "Gigabits",
+          "Terabits",
+          "Percent",
+          "Count",
+          "Bytes/Second",
+          "Kilobytes/Second",
+          "Megabytes/Second",
+          "Gigabytes/Second",
+          "Terabytes/Second",
+          "Bits/Second",
+          "Kilobits/Second",
+          "Megabits/Second",
+          "Gigabits/Second",
+          "Terabits/Second",
+          "Count/Second",
+          "None",
+        };
 
         StandardUnit GetStandardUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Seconds_HASH)
-          {
-            return StandardUnit::Seconds;
-          }
-          else if (hashCode == Microseconds_HASH)
-          {
-            return StandardUnit::Microseconds;
-          }
-          else if (hashCode == Milliseconds_HASH)
-          {
-            return StandardUnit::Milliseconds;
-          }
-          else if (hashCode == Bytes_HASH)
-          {
-            return StandardUnit::Bytes;
-          }
-          else if (hashCode == Kilobytes_HASH)
-          {
-            return StandardUnit::Kilobytes;
-          }
-          else if (hashCode == Megabytes_HASH)
-          {
-            return StandardUnit::Megabytes;
-          }
-          else if (hashCode == Gigabytes_HASH)
-          {
-            return StandardUnit::Gigabytes;
-          }
-          else if (hashCode == Terabytes_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StandardUnit::Terabytes;
-          }
-          else if (hashCode == Bits_HASH)
-          {
-            return StandardUnit::Bits;
-          }
-          else if (hashCode == Kilobits_HASH)
-          {
-            return StandardUnit::Kilobits;
-          }
-          else if (hashCode == Megabits_HASH)
-          {
-            return StandardUnit::Megabits;
-          }
-          else if (hashCode == Gigabits_HASH)
-          {
-            return StandardUnit::Gigabits;
-          }
-          else if (hashCode == Terabits_HASH)
-          {
-            return StandardUnit::Terabits;
-          }
-          else if (hashCode == Percent_HASH)
-          {
-            return StandardUnit::Percent;
-          }
-          else if (hashCode == Count_HASH)
-          {
-            return StandardUnit::Count;
-          }
-          else if (hashCode == Bytes_Second_HASH)
-          {
-            return StandardUnit::Bytes_Second;
-          }
-          else if (hashCode == Kilobytes_Second_HASH)
-          {
-            return StandardUnit::Kilobytes_Second;
-          }
-          else if (hashCode == Megabytes_Second_HASH)
-          {
-            return StandardUnit::Megabytes_Second;
-          }
-          else if (hashCode == Gigabytes_Second_HASH)
-          {
-            return StandardUnit::Gigabytes_Second;
-          }
-          else if (hashCode == Terabytes_Second_HASH)
-          {
-            return StandardUnit::Terabytes_Second;
-          }
-          else if (hashCode == Bits_Second_HASH)
-          {
-            return StandardUnit::Bits_Second;
-          }
-          else if (hashCode == Kilobits_Second_HASH)
-          {
-            return StandardUnit::Kilobits_Second;
-          }
-          else if (hashCode == Megabits_Second_HASH)
-          {
-            return StandardUnit::Megabits_Second;
-          }
-          else if (hashCode == Gigabits_Second_HASH)
-          {
-            return StandardUnit::Gigabits_Second;
-          }
-          else if (hashCode == Terabits_Second_HASH)
-          {
-            return StandardUnit::Terabits_Second;
-          }
-          else if (hashCode == Count_Second_HASH)
-          {
-            return StandardUnit::Count_Second;
-          }
-          else if (hashCode == None_HASH)
-          {
-            return StandardUnit::None;
+          case -660217249:
+            if (name == "Seconds")
+            {
+              return StandardUnit::Seconds;
+            }
+            break;
+          case 1630272347:
+            if (name == "Microseconds")
+            {
+              return StandardUnit::Microseconds;
+            }
+            break;
+          case 249515570:
+            if (name == "Milliseconds")
+            {
+              return StandardUnit::Milliseconds;
+            }
+            break;
+          case 64671819:
+            if (name == "Bytes")
+            {
+              return StandardUnit::Bytes;
+            }
+            break;
+          case 529570186:
+            if (name == "Kilobytes")
+            {
+              return StandardUnit::Kilobytes;
+            }
+            break;
+          case -2010004711:
+            if (name == "Megabytes")
+            {
+              return StandardUnit::Megabytes;
+            }
+            break;
+          case -1373905777:
+            if (name == "Gigabytes")
+            {
+              return StandardUnit::Gigabytes;
+            }
+            break;
+          case -604678165:
+            if (name == "Terabytes")
+            {
+              return StandardUnit::Terabytes;
+            }
+            break;
+          case 2070822:
+            if (name == "Bits")
+            {
+              return StandardUnit::Bits;
+            }
+            break;
+          case -537121785:
+            if (name == "Kilobits")
+            {
+              return StandardUnit::Kilobits;
+            }
+            break;
+          case -757590888:
+            if (name == "Megabits")
+            {
+              return StandardUnit::Megabits;
+            }
+            break;
+          case 925496418:
+            if (name == "Gigabits")
+            {
+              return StandardUnit::Gigabits;
+            }
+            break;
+          case -1127899770:
+            if (name == "Terabits")
+            {
+              return StandardUnit::Terabits;
+            }
+            break;
+          case 985725989:
+            if (name == "Percent")
+            {
+              return StandardUnit::Percent;
+            }
+            break;
+          case 65298671:
+            if (name == "Count")
+            {
+              return StandardUnit::Count;
+            }
+            break;
+          case 2146985688:
+            if (name == "Bytes/Second")
+            {
+              return StandardUnit::Bytes_Second;
+            }
+            break;
+          case 457738425:
+            if (name == "Kilobytes/Second")
+            {
+              return StandardUnit::Kilobytes_Second;
+            }
+            break;
+          case 41898058:
+            if (name == "Megabytes/Second")
+            {
+              return StandardUnit::Megabytes_Second;
+            }
+            break;
+          case 545375764:
+            if (name == "Gigabytes/Second")
+            {
+              return StandardUnit::Gigabytes_Second;
+            }
+            break;
+          case -503051464:
+            if (name == "Terabytes/Second")
+            {
+              return StandardUnit::Terabytes_Second;
+            }
+            break;
+          case -1209794147:
+            if (name == "Bits/Second")
+            {
+              return StandardUnit::Bits_Second;
+            }
+            break;
+          case 1091018652:
+            if (name == "Kilobits/Second")
+            {
+              return StandardUnit::Kilobits_Second;
+            }
+            break;
+          case 1493246443:
+            if (name == "Megabits/Second")
+            {
+              return StandardUnit::Megabits_Second;
+            }
+            break;
+          case -984364319:
+            if (name == "Gigabits/Second")
+            {
+              return StandardUnit::Gigabits_Second;
+            }
+            break;
+          case 228741437:
+            if (name == "Terabits/Second")
+            {
+              return StandardUnit::Terabits_Second;
+            }
+            break;
+          case 1229821364:
+            if (name == "Count/Second")
+            {
+              return StandardUnit::Count_Second;
+            }
+            break;
+          case 2433880:
+            if (name == "None")
+            {
+              return StandardUnit::None;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -180,73 +247,26 @@ namespace Aws
           return StandardUnit::NOT_SET;
         }
 
-        Aws::String GetNameForStandardUnit(StandardUnit enumValue)
+        const char* GetNameForStandardUnitCStr(StandardUnit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StandardUnit::Seconds:
-            return "Seconds";
-          case StandardUnit::Microseconds:
-            return "Microseconds";
-          case StandardUnit::Milliseconds:
-            return "Milliseconds";
-          case StandardUnit::Bytes:
-            return "Bytes";
-          case StandardUnit::Kilobytes:
-            return "Kilobytes";
-          case StandardUnit::Megabytes:
-            return "Megabytes";
-          case StandardUnit::Gigabytes:
-            return "Gigabytes";
-          case StandardUnit::Terabytes:
-            return "Terabytes";
-          case StandardUnit::Bits:
-            return "Bits";
-          case StandardUnit::Kilobits:
-            return "Kilobits";
-          case StandardUnit::Megabits:
-            return "Megabits";
-          case StandardUnit::Gigabits:
-            return "Gigabits";
-          case StandardUnit::Terabits:
-            return "Terabits";
-          case StandardUnit::Percent:
-            return "Percent";
-          case StandardUnit::Count:
-            return "Count";
-          case StandardUnit::Bytes_Second:
-            return "Bytes/Second";
-          case StandardUnit::Kilobytes_Second:
-            return "Kilobytes/Second";
-          case StandardUnit::Megabytes_Second:
-            return "Megabytes/Second";
-          case StandardUnit::Gigabytes_Second:
-            return "Gigabytes/Second";
-          case StandardUnit::Terabytes_Second:
-            return "Terabytes/Second";
-          case StandardUnit::Bits_Second:
-            return "Bits/Second";
-          case StandardUnit::Kilobits_Second:
-            return "Kilobits/Second";
-          case StandardUnit::Megabits_Second:
-            return "Megabits/Second";
-          case StandardUnit::Gigabits_Second:
-            return "Gigabits/Second";
-          case StandardUnit::Terabits_Second:
-            return "Terabits/Second";
-          case StandardUnit::Count_Second:
-            return "Count/Second";
-          case StandardUnit::None:
-            return "None";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStandardUnit(StandardUnit enumValue)
+        {
+          return GetNameForStandardUnitCStr(enumValue);
         }
 
       } // namespace StandardUnitMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace StateValueMapper
       {
 
-        static const int OK_HASH = HashingUtils::HashString("OK");
-        static const int ALARM_HASH = HashingUtils::HashString("ALARM");
-        static const int INSUFFICIENT_DATA_HASH = HashingUtils::HashString("INSUFFICIENT_DATA");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OK",
+          "ALARM",
+          "INSUFFICIENT_DATA",
+        };
 
         StateValue GetStateValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OK_HASH)
-          {
-            return StateValue::OK;
-          }
-          else if (hashCode == ALARM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StateValue::ALARM;
-          }
-          else if (hashCode == INSUFFICIENT_DATA_HASH)
-          {
-            return StateValue::INSUFFICIENT_DATA;
+          case 2524:
+            if (name == "OK")
+            {
+              return StateValue::OK;
+            }
+            break;
+          case 62358065:
+            if (name == "ALARM")
+            {
+              return StateValue::ALARM;
+            }
+            break;
+          case -1936956826:
+            if (name == "INSUFFICIENT_DATA")
+            {
+              return StateValue::INSUFFICIENT_DATA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StateValue::NOT_SET;
         }
 
-        Aws::String GetNameForStateValue(StateValue enumValue)
+        const char* GetNameForStateValueCStr(StateValue enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StateValue::OK:
-            return "OK";
-          case StateValue::ALARM:
-            return "ALARM";
-          case StateValue::INSUFFICIENT_DATA:
-            return "INSUFFICIENT_DATA";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStateValue(StateValue enumValue)
+        {
+          return GetNameForStateValueCStr(enumValue);
         }
 
       } // namespace StateValueMapper
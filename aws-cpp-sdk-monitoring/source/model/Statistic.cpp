@@ -30,35 +30,58 @@ namespace Aws
       namespace StatisticMapper
       {
 
-        static const int SampleCount_HASH = HashingUtils::HashString("SampleCount");
-        static const int Average_HASH = HashingUtils::HashString("Average");
-        static const int Sum_HASH = HashingUtils::HashString("Sum");
-        static const int Minimum_HASH = HashingUtils::HashString("Minimum");
-        static const int Maximum_HASH = HashingUtils::HashString("Maximum");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SampleCount",
+          "Average",
+          "Sum",
+          "Minimum",
+          "Maximum",
+        };
 
         Statistic GetStatisticForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SampleCount_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Statistic::SampleCount;
-          }
-          else if (hashCode == Average_HASH)
-          {
-            return Statistic::Average;
-          }
-          else if (hashCode == Sum_HASH)
-          {
-            return Statistic::Sum;
-          }
-          else if (hashCode == Minimum_HASH)
-          {
-            return Statistic::Minimum;
-          }
-          else if (hashCode == Maximum_HASH)
-          {
-            return Statistic::Maximum;
+          case 1795132773:
+            if (name == "SampleCount")
+            {
+              return Statistic::SampleCount;
+            }
+            break;
+          case 1033205245:
+            if (name == "Average")
+            {
+              return Statistic::Average;
+            }
+            break;
+          case 83499:
+            if (name == "Sum")
+            {
+              return Statistic::Sum;
+            }
+            break;
+          case -1565775890:
+            if (name == "Minimum")
+            {
+              return Statistic::Minimum;
+            }
+            break;
+          case -1785573888:
+            if (name == "Maximum")
+            {
+              return Statistic::Maximum;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return Statistic::NOT_SET;
         }
 
-        Aws::String GetNameForStatistic(Statistic enumValue)
+        const char* GetNameForStatisticCStr(Statistic enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Statistic::SampleCount:
-            return "SampleCount";
-          case Statistic::Average:
-            return "Average";
-          case Statistic::Sum:
-            return "Sum";
-          case Statistic::Minimum:
-            return "Minimum";
-          case Statistic::Maximum:
-            return "Maximum";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatistic(Statistic enumValue)
+        {
+          return GetNameForStatisticCStr(enumValue);
         }
 
       } // namespace StatisticMapper
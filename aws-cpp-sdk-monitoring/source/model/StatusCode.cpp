@@ -30,25 +30,44 @@ namespace Aws
       namespace StatusCodeMapper
       {
 
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
-        static const int InternalError_HASH = HashingUtils::HashString("InternalError");
-        static const int PartialData_HASH = HashingUtils::HashString("PartialData");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Complete",
+          "InternalError",
+          "PartialData",
+        };
 
         StatusCode GetStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Complete_HASH)
-          {
-            return StatusCode::Complete;
-          }
-          else if (hashCode == InternalError_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StatusCode::InternalError;
-          }
-          else if (hashCode == PartialData_HASH)
-          {
-            return StatusCode::PartialData;
+          case -534801063:
+            if (name == "Complete")
+            {
+              return StatusCode::Complete;
+            }
+            break;
+          case -1693386453:
+            if (name == "InternalError")
+            {
+              return StatusCode::InternalError;
+            }
+            break;
+          case -1915474773:
+            if (name == "PartialData")
+            {
+              return StatusCode::PartialData;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForStatusCode(StatusCode enumValue)
+        const char* GetNameForStatusCodeCStr(StatusCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StatusCode::Complete:
-            return "Complete";
-          case StatusCode::InternalError:
-            return "InternalError";
-          case StatusCode::PartialData:
-            return "PartialData";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatusCode(StatusCode enumValue)
+        {
+          return GetNameForStatusCodeCStr(enumValue);
         }
 
       } // namespace StatusCodeMapper
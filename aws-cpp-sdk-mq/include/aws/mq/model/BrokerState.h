@@ -38,6 +38,11 @@ namespace BrokerStateMapper
 AWS_MQ_API BrokerState GetBrokerStateForName(const Aws::String& name);
 
 AWS_MQ_API Aws::String GetNameForBrokerState(BrokerState value);
+
+/**
+ * Same as GetNameForBrokerState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MQ_API const char* GetNameForBrokerStateCStr(BrokerState value);
 } // namespace BrokerStateMapper
 } // namespace Model
 } // namespace MQ
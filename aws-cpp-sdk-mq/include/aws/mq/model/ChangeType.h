@@ -36,6 +36,11 @@ namespace ChangeTypeMapper
 AWS_MQ_API ChangeType GetChangeTypeForName(const Aws::String& name);
 
 AWS_MQ_API Aws::String GetNameForChangeType(ChangeType value);
+
+/**
+ * Same as GetNameForChangeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MQ_API const char* GetNameForChangeTypeCStr(ChangeType value);
 } // namespace ChangeTypeMapper
 } // namespace Model
 } // namespace MQ
@@ -35,6 +35,11 @@ namespace DeploymentModeMapper
 AWS_MQ_API DeploymentMode GetDeploymentModeForName(const Aws::String& name);
 
 AWS_MQ_API Aws::String GetNameForDeploymentMode(DeploymentMode value);
+
+/**
+ * Same as GetNameForDeploymentMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MQ_API const char* GetNameForDeploymentModeCStr(DeploymentMode value);
 } // namespace DeploymentModeMapper
 } // namespace Model
 } // namespace MQ
@@ -34,6 +34,11 @@ namespace EngineTypeMapper
 AWS_MQ_API EngineType GetEngineTypeForName(const Aws::String& name);
 
 AWS_MQ_API Aws::String GetNameForEngineType(EngineType value);
+
+/**
+ * Same as GetNameForEngineType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MQ_API const char* GetNameForEngineTypeCStr(EngineType value);
 } // namespace EngineTypeMapper
 } // namespace Model
 } // namespace MQ
@@ -36,6 +36,11 @@ namespace SanitizationWarningReasonMapper
 AWS_MQ_API SanitizationWarningReason GetSanitizationWarningReasonForName(const Aws::String& name);
 
 AWS_MQ_API Aws::String GetNameForSanitizationWarningReason(SanitizationWarningReason value);
+
+/**
+ * Same as GetNameForSanitizationWarningReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MQ_API const char* GetNameForSanitizationWarningReasonCStr(SanitizationWarningReason value);
 } // namespace SanitizationWarningReasonMapper
 } // namespace Model
 } // namespace MQ
@@ -30,35 +30,58 @@ namespace Aws
       namespace BrokerStateMapper
       {
 
-        static const int CREATION_IN_PROGRESS_HASH = HashingUtils::HashString("CREATION_IN_PROGRESS");
-        static const int CREATION_FAILED_HASH = HashingUtils::HashString("CREATION_FAILED");
-        static const int DELETION_IN_PROGRESS_HASH = HashingUtils::HashString("DELETION_IN_PROGRESS");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int REBOOT_IN_PROGRESS_HASH = HashingUtils::HashString("REBOOT_IN_PROGRESS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATION_IN_PROGRESS",
+          "CREATION_FAILED",
+          "DELETION_IN_PROGRESS",
+          "RUNNING",
+          "REBOOT_IN_PROGRESS",
+        };
 
         BrokerState GetBrokerStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATION_IN_PROGRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BrokerState::CREATION_IN_PROGRESS;
-          }
-          else if (hashCode == CREATION_FAILED_HASH)
-          {
-            return BrokerState::CREATION_FAILED;
-          }
-          else if (hashCode == DELETION_IN_PROGRESS_HASH)
-          {
-            return BrokerState::DELETION_IN_PROGRESS;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return BrokerState::RUNNING;
-          }
-          else if (hashCode == REBOOT_IN_PROGRESS_HASH)
-          {
-            return BrokerState::REBOOT_IN_PROGRESS;
+          case -1341080921:
+            if (name == "CREATION_IN_PROGRESS")
+            {
+              return BrokerState::CREATION_IN_PROGRESS;
+            }
+            break;
+          case 590511517:
+            if (name == "CREATION_FAILED")
+            {
+              return BrokerState::CREATION_FAILED;
+            }
+            break;
+          case -927973098:
+            if (name == "DELETION_IN_PROGRESS")
+            {
+              return BrokerState::DELETION_IN_PROGRESS;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return BrokerState::RUNNING;
+            }
+            break;
+          case 1143426669:
+            if (name == "REBOOT_IN_PROGRESS")
+            {
+              return BrokerState::REBOOT_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return BrokerState::NOT_SET;
         }
 
-        Aws::String GetNameForBrokerState(BrokerState enumValue)
+        const char* GetNameForBrokerStateCStr(BrokerState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BrokerState::CREATION_IN_PROGRESS:
-            return "CREATION_IN_PROGRESS";
-          case BrokerState::CREATION_FAILED:
-            return "CREATION_FAILED";
-          case BrokerState::DELETION_IN_PROGRESS:
-            return "DELETION_IN_PROGRESS";
-          case BrokerState::RUNNING:
-            return "RUNNING";
-          case BrokerState::REBOOT_IN_PROGRESS:
-            return "REBOOT_IN_PROGRESS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBrokerState(BrokerState enumValue)
+        {
+          return GetNameForBrokerStateCStr(enumValue);
         }
 
       } // namespace BrokerStateMapper
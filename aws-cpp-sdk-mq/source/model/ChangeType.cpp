@@ -30,25 +30,44 @@ namespace Aws
       namespace ChangeTypeMapper
       {
 
-        static const int CREATE_HASH = HashingUtils::HashString("CREATE");
-        static const int UPDATE_HASH = HashingUtils::HashString("UPDATE");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE",
+          "UPDATE",
+          "DELETE",
+        };
 
         ChangeType GetChangeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_HASH)
-          {
-            return ChangeType::CREATE;
-          }
-          else if (hashCode == UPDATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeType::UPDATE;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return ChangeType::DELETE_;
+          case 1996002556:
+            if (name == "CREATE")
+            {
+              return ChangeType::CREATE;
+            }
+            break;
+          case -1785516855:
+            if (name == "UPDATE")
+            {
+              return ChangeType::UPDATE;
+            }
+            break;
+          case 2012838315:
+            if (name == "DELETE")
+            {
+              return ChangeType::DELETE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ChangeType::NOT_SET;
         }
 
-        Aws::String GetNameForChangeType(ChangeType enumValue)
+        const char* GetNameForChangeTypeCStr(ChangeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeType::CREATE:
-            return "CREATE";
-          case ChangeType::UPDATE:
-            return "UPDATE";
-          case ChangeType::DELETE_:
-            return "DELETE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeType(ChangeType enumValue)
+        {
+          return GetNameForChangeTypeCStr(enumValue);
         }
 
       } // namespace ChangeTypeMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace DayOfWeekMapper
       {
 
-        static const int MONDAY_HASH = HashingUtils::HashString("MONDAY");
-        static const int TUESDAY_HASH = HashingUtils::HashString("TUESDAY");
-        static const int WEDNESDAY_HASH = HashingUtils::HashString("WEDNESDAY");
-        static const int THURSDAY_HASH = HashingUtils::HashString("THURSDAY");
-        static const int FRIDAY_HASH = HashingUtils::HashString("FRIDAY");
-        static const int SATURDAY_HASH = HashingUtils::HashString("SATURDAY");
-        static const int SUNDAY_HASH = HashingUtils::HashString("SUNDAY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MONDAY",
+          "TUESDAY",
+          "WEDNESDAY",
+          "THURSDAY",
+          "FRIDAY",
+          "SATURDAY",
+          "SUNDAY",
+        };
 
         DayOfWeek GetDayOfWeekForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MONDAY_HASH)
-          {
-            return DayOfWeek::MONDAY;
-          }
-          else if (hashCode == TUESDAY_HASH)
-          {
-            return DayOfWeek::TUESDAY;
-          }
-          else if (hashCode == WEDNESDAY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DayOfWeek::WEDNESDAY;
-          }
-          else if (hashCode == THURSDAY_HASH)
-          {
-            return DayOfWeek::THURSDAY;
-          }
-          else if (hashCode == FRIDAY_HASH)
-          {
-            return DayOfWeek::FRIDAY;
-          }
-          else if (hashCode == SATURDAY_HASH)
-          {
-            return DayOfWeek::SATURDAY;
-          }
-          else if (hashCode == SUNDAY_HASH)
-          {
-            return DayOfWeek::SUNDAY;
+          case -2015173360:
+            if (name == "MONDAY")
+            {
+              return DayOfWeek::MONDAY;
+            }
+            break;
+          case -259361235:
+            if (name == "TUESDAY")
+            {
+              return DayOfWeek::TUESDAY;
+            }
+            break;
+          case -114841802:
+            if (name == "WEDNESDAY")
+            {
+              return DayOfWeek::WEDNESDAY;
+            }
+            break;
+          case -1940284966:
+            if (name == "THURSDAY")
+            {
+              return DayOfWeek::THURSDAY;
+            }
+            break;
+          case 2082011487:
+            if (name == "FRIDAY")
+            {
+              return DayOfWeek::FRIDAY;
+            }
+            break;
+          case -1331574855:
+            if (name == "SATURDAY")
+            {
+              return DayOfWeek::SATURDAY;
+            }
+            break;
+          case -1837857328:
+            if (name == "SUNDAY")
+            {
+              return DayOfWeek::SUNDAY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return DayOfWeek::NOT_SET;
         }
 
-        Aws::String GetNameForDayOfWeek(DayOfWeek enumValue)
+        const char* GetNameForDayOfWeekCStr(DayOfWeek enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DayOfWeek::MONDAY:
-            return "MONDAY";
-          case DayOfWeek::TUESDAY:
-            return "TUESDAY";
-          case DayOfWeek::WEDNESDAY:
-            return "WEDNESDAY";
-          case DayOfWeek::THURSDAY:
-            return "THURSDAY";
-          case DayOfWeek::FRIDAY:
-            return "FRIDAY";
-          case DayOfWeek::SATURDAY:
-            return "SATURDAY";
-          case DayOfWeek::SUNDAY:
-            return "SUNDAY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDayOfWeek(DayOfWeek enumValue)
+        {
+          return GetNameForDayOfWeekCStr(enumValue);
         }
 
       } // namespace DayOfWeekMapper
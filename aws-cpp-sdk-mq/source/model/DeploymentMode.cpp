@@ -30,20 +30,37 @@ namespace Aws
       namespace DeploymentModeMapper
       {
 
-        static const int SINGLE_INSTANCE_HASH = HashingUtils::HashString("SINGLE_INSTANCE");
-        static const int ACTIVE_STANDBY_MULTI_AZ_HASH = HashingUtils::HashString("ACTIVE_STANDBY_MULTI_AZ");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SINGLE_INSTANCE",
+          "ACTIVE_STANDBY_MULTI_AZ",
+        };
 
         DeploymentMode GetDeploymentModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SINGLE_INSTANCE_HASH)
-          {
-            return DeploymentMode::SINGLE_INSTANCE;
-          }
-          else if (hashCode == ACTIVE_STANDBY_MULTI_AZ_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentMode::ACTIVE_STANDBY_MULTI_AZ;
+          case -1184559444:
+            if (name == "SINGLE_INSTANCE")
+            {
+              return DeploymentMode::SINGLE_INSTANCE;
+            }
+            break;
+          case -1765872982:
+            if (name == "ACTIVE_STANDBY_MULTI_AZ")
+            {
+              return DeploymentMode::ACTIVE_STANDBY_MULTI_AZ;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeploymentMode::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentMode(DeploymentMode enumValue)
+        const char* GetNameForDeploymentModeCStr(DeploymentMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentMode::SINGLE_INSTANCE:
-            return "SINGLE_INSTANCE";
-          case DeploymentMode::ACTIVE_STANDBY_MULTI_AZ:
-            return "ACTIVE_STANDBY_MULTI_AZ";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentMode(DeploymentMode enumValue)
+        {
+          return GetNameForDeploymentModeCStr(enumValue);
         }
 
       } // namespace DeploymentModeMapper
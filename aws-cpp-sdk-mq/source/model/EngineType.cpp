@@ -30,15 +30,30 @@ namespace Aws
       namespace EngineTypeMapper
       {
 
-        static const int ACTIVEMQ_HASH = HashingUtils::HashString("ACTIVEMQ");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVEMQ",
+        };
 
         EngineType GetEngineTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVEMQ_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EngineType::ACTIVEMQ;
+          case -873344214:
+            if (name == "ACTIVEMQ")
+            {
+              return EngineType::ACTIVEMQ;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return EngineType::NOT_SET;
         }
 
-        Aws::String GetNameForEngineType(EngineType enumValue)
+        const char* GetNameForEngineTypeCStr(EngineType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EngineType::ACTIVEMQ:
-            return "ACTIVEMQ";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEngineType(EngineType enumValue)
+        {
+          return GetNameForEngineTypeCStr(enumValue);
         }
 
       } // namespace EngineTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace SanitizationWarningReasonMapper
       {
 
-        static const int DISALLOWED_ELEMENT_REMOVED_HASH = HashingUtils::HashString("DISALLOWED_ELEMENT_REMOVED");
-        static const int DISALLOWED_ATTRIBUTE_REMOVED_HASH = HashingUtils::HashString("DISALLOWED_ATTRIBUTE_REMOVED");
-        static const int INVALID_ATTRIBUTE_VALUE_REMOVED_HASH = HashingUtils::HashString("INVALID_ATTRIBUTE_VALUE_REMOVED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DISALLOWED_ELEMENT_REMOVED",
+          "DISALLOWED_ATTRIBUTE_REMOVED",
+          "INVALID_ATTRIBUTE_VALUE_REMOVED",
+        };
 
         SanitizationWarningReason GetSanitizationWarningReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISALLOWED_ELEMENT_REMOVED_HASH)
-          {
-            return SanitizationWarningReason::DISALLOWED_ELEMENT_REMOVED;
-          }
-          else if (hashCode == DISALLOWED_ATTRIBUTE_REMOVED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SanitizationWarningReason::DISALLOWED_ATTRIBUTE_REMOVED;
-          }
-          else if (hashCode == INVALID_ATTRIBUTE_VALUE_REMOVED_HASH)
-          {
-            return SanitizationWarningReason::INVALID_ATTRIBUTE_VALUE_REMOVED;
+          case -205289224:
+            if (name == "DISALLOWED_ELEMENT_REMOVED")
+            {
+              return SanitizationWarningReason::DISALLOWED_ELEMENT_REMOVED;
+            }
+            break;
+          case -135553576:
+            if (name == "DISALLOWED_ATTRIBUTE_REMOVED")
+            {
+              return SanitizationWarningReason::DISALLOWED_ATTRIBUTE_REMOVED;
+            }
+            break;
+          case 671659111:
+            if (name == "INVALID_ATTRIBUTE_VALUE_REMOVED")
+            {
+              return SanitizationWarningReason::INVALID_ATTRIBUTE_VALUE_REMOVED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SanitizationWarningReason::NOT_SET;
         }
 
-        Aws::String GetNameForSanitizationWarningReason(SanitizationWarningReason enumValue)
+        const char* GetNameForSanitizationWarningReasonCStr(SanitizationWarningReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SanitizationWarningReason::DISALLOWED_ELEMENT_REMOVED:
-            return "DISALLOWED_ELEMENT_REMOVED";
-          case SanitizationWarningReason::DISALLOWED_ATTRIBUTE_REMOVED:
-            return "DISALLOWED_ATTRIBUTE_REMOVED";
-          case SanitizationWarningReason::INVALID_ATTRIBUTE_VALUE_REMOVED:
-            return "INVALID_ATTRIBUTE_VALUE_REMOVED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSanitizationWarningReason(SanitizationWarningReason enumValue)
+        {
+          return GetNameForSanitizationWarningReasonCStr(enumValue);
         }
 
       } // namespace SanitizationWarningReasonMapper
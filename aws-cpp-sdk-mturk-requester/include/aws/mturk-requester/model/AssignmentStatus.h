@@ -36,6 +36,11 @@ namespace AssignmentStatusMapper
 AWS_MTURK_API AssignmentStatus GetAssignmentStatusForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForAssignmentStatus(AssignmentStatus value);
+
+/**
+ * Same as GetNameForAssignmentStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForAssignmentStatusCStr(AssignmentStatus value);
 } // namespace AssignmentStatusMapper
 } // namespace Model
 } // namespace MTurk
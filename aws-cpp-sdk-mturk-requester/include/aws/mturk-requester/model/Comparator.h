@@ -43,6 +43,11 @@ namespace ComparatorMapper
 AWS_MTURK_API Comparator GetComparatorForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForComparator(Comparator value);
+
+/**
+ * Same as GetNameForComparator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForComparatorCStr(Comparator value);
 } // namespace ComparatorMapper
 } // namespace Model
 } // namespace MTurk
@@ -45,6 +45,11 @@ namespace EventTypeMapper
 AWS_MTURK_API EventType GetEventTypeForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForEventType(EventType value);
+
+/**
+ * Same as GetNameForEventType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForEventTypeCStr(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace MTurk
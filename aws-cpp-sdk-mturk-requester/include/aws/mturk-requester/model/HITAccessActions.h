@@ -36,6 +36,11 @@ namespace HITAccessActionsMapper
 AWS_MTURK_API HITAccessActions GetHITAccessActionsForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForHITAccessActions(HITAccessActions value);
+
+/**
+ * Same as GetNameForHITAccessActions(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForHITAccessActionsCStr(HITAccessActions value);
 } // namespace HITAccessActionsMapper
 } // namespace Model
 } // namespace MTurk
@@ -37,6 +37,11 @@ namespace HITReviewStatusMapper
 AWS_MTURK_API HITReviewStatus GetHITReviewStatusForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForHITReviewStatus(HITReviewStatus value);
+
+/**
+ * Same as GetNameForHITReviewStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForHITReviewStatusCStr(HITReviewStatus value);
 } // namespace HITReviewStatusMapper
 } // namespace Model
 } // namespace MTurk
@@ -38,6 +38,11 @@ namespace HITStatusMapper
 AWS_MTURK_API HITStatus GetHITStatusForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForHITStatus(HITStatus value);
+
+/**
+ * Same as GetNameForHITStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForHITStatusCStr(HITStatus value);
 } // namespace HITStatusMapper
 } // namespace Model
 } // namespace MTurk
@@ -36,6 +36,11 @@ namespace NotificationTransportMapper
 AWS_MTURK_API NotificationTransport GetNotificationTransportForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForNotificationTransport(NotificationTransport value);
+
+/**
+ * Same as GetNameForNotificationTransport(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForNotificationTransportCStr(NotificationTransport value);
 } // namespace NotificationTransportMapper
 } // namespace Model
 } // namespace MTurk
@@ -35,6 +35,11 @@ namespace NotifyWorkersFailureCodeMapper
 AWS_MTURK_API NotifyWorkersFailureCode GetNotifyWorkersFailureCodeForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForNotifyWorkersFailureCode(NotifyWorkersFailureCode value);
+
+/**
+ * Same as GetNameForNotifyWorkersFailureCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForNotifyWorkersFailureCodeCStr(NotifyWorkersFailureCode value);
 } // namespace NotifyWorkersFailureCodeMapper
 } // namespace Model
 } // namespace MTurk
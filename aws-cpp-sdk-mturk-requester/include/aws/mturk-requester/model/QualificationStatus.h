@@ -35,6 +35,11 @@ namespace QualificationStatusMapper
 AWS_MTURK_API QualificationStatus GetQualificationStatusForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForQualificationStatus(QualificationStatus value);
+
+/**
+ * Same as GetNameForQualificationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForQualificationStatusCStr(QualificationStatus value);
 } // namespace QualificationStatusMapper
 } // namespace Model
 } // namespace MTurk
@@ -35,6 +35,11 @@ namespace QualificationTypeStatusMapper
 AWS_MTURK_API QualificationTypeStatus GetQualificationTypeStatusForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForQualificationTypeStatus(QualificationTypeStatus value);
+
+/**
+ * Same as GetNameForQualificationTypeStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForQualificationTypeStatusCStr(QualificationTypeStatus value);
 } // namespace QualificationTypeStatusMapper
 } // namespace Model
 } // namespace MTurk
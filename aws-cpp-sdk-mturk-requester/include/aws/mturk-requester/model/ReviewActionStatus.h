@@ -37,6 +37,11 @@ namespace ReviewActionStatusMapper
 AWS_MTURK_API ReviewActionStatus GetReviewActionStatusForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForReviewActionStatus(ReviewActionStatus value);
+
+/**
+ * Same as GetNameForReviewActionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForReviewActionStatusCStr(ReviewActionStatus value);
 } // namespace ReviewActionStatusMapper
 } // namespace Model
 } // namespace MTurk
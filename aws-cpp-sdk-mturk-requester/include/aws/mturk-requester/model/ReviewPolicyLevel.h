@@ -35,6 +35,11 @@ namespace ReviewPolicyLevelMapper
 AWS_MTURK_API ReviewPolicyLevel GetReviewPolicyLevelForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForReviewPolicyLevel(ReviewPolicyLevel value);
+
+/**
+ * Same as GetNameForReviewPolicyLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForReviewPolicyLevelCStr(ReviewPolicyLevel value);
 } // namespace ReviewPolicyLevelMapper
 } // namespace Model
 } // namespace MTurk
@@ -35,6 +35,11 @@ namespace ReviewableHITStatusMapper
 AWS_MTURK_API ReviewableHITStatus GetReviewableHITStatusForName(const Aws::String& name);
 
 AWS_MTURK_API Aws::String GetNameForReviewableHITStatus(ReviewableHITStatus value);
+
+/**
+ * Same as GetNameForReviewableHITStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_MTURK_API const char* GetNameForReviewableHITStatusCStr(ReviewableHITStatus value);
 } // namespace ReviewableHITStatusMapper
 } // namespace Model
 } // namespace MTurk
@@ -30,25 +30,44 @@ namespace Aws
       namespace AssignmentStatusMapper
       {
 
-        static const int Submitted_HASH = HashingUtils::HashString("Submitted");
-        static const int Approved_HASH = HashingUtils::HashString("Approved");
-        static const int Rejected_HASH = HashingUtils::HashString("Rejected");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Submitted",
+          "Approved",
+          "Rejected",
+        };
 
         AssignmentStatus GetAssignmentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Submitted_HASH)
-          {
-            return AssignmentStatus::Submitted;
-          }
-          else if (hashCode == Approved_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssignmentStatus::Approved;
-          }
-          else if (hashCode == Rejected_HASH)
-          {
-            return AssignmentStatus::Rejected;
+          case -1942320933:
+            if (name == "Submitted")
+            {
+              return AssignmentStatus::Submitted;
+            }
+            break;
+          case 1249888983:
+            if (name == "Approved")
+            {
+              return AssignmentStatus::Approved;
+            }
+            break;
+          case -543852386:
+            if (name == "Rejected")
+            {
+              return AssignmentStatus::Rejected;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AssignmentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAssignmentStatus(AssignmentStatus enumValue)
+        const char* GetNameForAssignmentStatusCStr(AssignmentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssignmentStatus::Submitted:
-            return "Submitted";
-          case AssignmentStatus::Approved:
-            return "Approved";
-          case AssignmentStatus::Rejected:
-            return "Rejected";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssignmentStatus(AssignmentStatus enumValue)
+        {
+          return GetNameForAssignmentStatusCStr(enumValue);
         }
 
       } // namespace AssignmentStatusMapper
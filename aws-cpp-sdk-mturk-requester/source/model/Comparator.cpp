@@ -30,60 +30,93 @@ namespace Aws
       namespace ComparatorMapper
       {
 
-        static const int LessThan_HASH = HashingUtils::HashString("LessThan");
-        static const int LessThanOrEqualTo_HASH = HashingUtils::HashString("LessThanOrEqualTo");
-        static const int GreaterThan_HASH = HashingUtils::HashString("GreaterThan");
-        static const int GreaterThanOrEqualTo_HASH = HashingUtils::HashString("GreaterThanOrEqualTo");
-        static const int EqualTo_HASH = HashingUtils::HashString("EqualTo");
-        static const int NotEqualTo_HASH = HashingUtils::HashString("NotEqualTo");
-        static const int Exists_HASH = HashingUtils::HashString("Exists");
-        static const int DoesNotExist_HASH = HashingUtils::HashString("DoesNotExist");
-        static const int In_HASH = HashingUtils::HashString("In");
-        static const int NotIn_HASH = HashingUtils::HashString("NotIn");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LessThan",
+          "LessThanOrEqualTo",
+          "GreaterThan",
+          "GreaterThanOrEqualTo",
+          "EqualTo",
+          "NotEqualTo",
+          "Exists",
+          "DoesNotExist",
+          "In",
+          "NotIn",
+        };
 
         Comparator GetComparatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LessThan_HASH)
-          {
-            return Comparator::LessThan;
-          }
-          else if (hashCode == LessThanOrEqualTo_HASH)
-          {
-            return Comparator::LessThanOrEqualTo;
-          }
-          else if (hashCode == GreaterThan_HASH)
-          {
-            return Comparator::GreaterThan;
-          }
-          else if (hashCode == GreaterThanOrEqualTo_HASH)
-          {
-            return Comparator::GreaterThanOrEqualTo;
-          }
-          else if (hashCode == EqualTo_HASH)
-          {
-            return Comparator::EqualTo;
-          }
-          else if (hashCode == NotEqualTo_HASH)
-          {
-            return Comparator::NotEqualTo;
-          }
-          else if (hashCode == Exists_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Comparator::Exists;
-          }
-          else if (hashCode == DoesNotExist_HASH)
-          {
-            return Comparator::DoesNotExist;
-          }
-          else if (hashCode == In_HASH)
-          {
-            return Comparator::In;
-          }
-          else if (hashCode == NotIn_HASH)
-          {
-            return Comparator::NotIn;
+          case -2140646662:
+            if (name == "LessThan")
+            {
+              return Comparator::LessThan;
+            }
+            break;
+          case -1754222702:
+            if (name == "LessThanOrEqualTo")
+            {
+              return Comparator::LessThanOrEqualTo;
+            }
+            break;
+          case -1701951333:
+            if (name == "GreaterThan")
+            {
+              return Comparator::GreaterThan;
+            }
+            break;
+          case 39747345:
+            if (name == "GreaterThanOrEqualTo")
+            {
+              return Comparator::GreaterThanOrEqualTo;
+            }
+            break;
+          case 159386799:
+            if (name == "EqualTo")
+            {
+              return Comparator::EqualTo;
+            }
+            break;
+          case -745211236:
+            if (name == "NotEqualTo")
+            {
+              return Comparator::NotEqualTo;
+            }
+            break;
+          case 2089476220:
+            if (name == "Exists")
+            {
+              return Comparator::Exists;
+            }
+            break;
+          case -159978083:
+            if (name == "DoesNotExist")
+            {
+              return Comparator::DoesNotExist;
+            }
+            break;
+          case 2373:
+            if (name == "In")
+            {
+              return Comparator::In;
+            }
+            break;
+          case 75455288:
+            if (name == "NotIn")
+            {
+              return Comparator::NotIn;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return Comparator::NOT_SET;
         }
 
-        Aws::String GetNameForComparator(Comparator enumValue)
+        const char* GetNameForComparatorCStr(Comparator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Comparator::LessThan:
-            return "LessThan";
-          case Comparator::LessThanOrEqualTo:
-            return "LessThanOrEqualTo";
-          case Comparator::GreaterThan:
-            return "GreaterThan";
-          case Comparator::GreaterThanOrEqualTo:
-            return "GreaterThanOrEqualTo";
-          case Comparator::EqualTo:
-            return "EqualTo";
-          case Comparator::NotEqualTo:
-            return "NotEqualTo";
-          case Comparator::Exists:
-            return "Exists";
-          case Comparator::DoesNotExist:
-            return "DoesNotExist";
-          case Comparator::In:
-            return "In";
-          case Comparator::NotIn:
-            return "NotIn";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComparator(Comparator enumValue)
+        {
+          return GetNameForComparatorCStr(enumValue);
         }
 
       } // namespace ComparatorMapper
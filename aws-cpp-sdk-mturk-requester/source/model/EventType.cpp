@@ -30,70 +30,107 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int AssignmentAccepted_HASH = HashingUtils::HashString("AssignmentAccepted");
-        static const int AssignmentAbandoned_HASH = HashingUtils::HashString("AssignmentAbandoned");
-        static const int AssignmentReturned_HASH = HashingUtils::HashString("AssignmentReturned");
-        static const int AssignmentSubmitted_HASH = HashingUtils::HashString("AssignmentSubmitted");
-        static const int AssignmentRejected_HASH = HashingUtils::HashString("AssignmentRejected");
-        static const int AssignmentApproved_HASH = HashingUtils::HashString("AssignmentApproved");
-        static const int HITCreated_HASH = HashingUtils::HashString("HITCreated");
-        static const int HITExpired_HASH = HashingUtils::HashString("HITExpired");
-        static const int HITReviewable_HASH = HashingUtils::HashString("HITReviewable");
-        static const int HITExtended_HASH = HashingUtils::HashString("HITExtended");
-        static const int HITDisposed_HASH = HashingUtils::HashString("HITDisposed");
-        static const int Ping_HASH = HashingUtils::HashString("Ping");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AssignmentAccepted",
+          "AssignmentAbandoned",
+          "AssignmentReturned",
+          "AssignmentSubmitted",
+          "AssignmentRejected",
+          "AssignmentApproved",
+          "HITCreated",
+          "HITExpired",
+          "HITReviewable",
+          "HITExtended",
+          "HITDisposed",
+          "Ping",
+        };
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AssignmentAccepted_HASH)
-          {
-            return EventType::AssignmentAccepted;
-          }
-          else if (hashCode == AssignmentAbandoned_HASH)
-          {
-            return EventType::AssignmentAbandoned;
-          }
-          else if (hashCode == AssignmentReturned_HASH)
-          {
-            return EventType::AssignmentReturned;
-          }
-          else if (hashCode == AssignmentSubmitted_HASH)
-          {
-            return EventType::AssignmentSubmitted;
-          }
-          else if (hashCode == AssignmentRejected_HASH)
-          {
-            return EventType::AssignmentRejected;
-          }
-          else if (hashCode == AssignmentApproved_HASH)
-          {
-            return EventType::AssignmentApproved;
-          }
-          else if (hashCode == HITCreated_HASH)
-          {
-            return EventType::HITCreated;
-          }
-          else if (hashCode == HITExpired_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventType::HITExpired;
-          }
-          else if (hashCode == HITReviewable_HASH)
-          {
-            return EventType::HITReviewable;
-          }
-          else if (hashCode == HITExtended_HASH)
-          {
-            return EventType::HITExtended;
-          }
-          else if (hashCode == HITDisposed_HASH)
-          {
-            return EventType::HITDisposed;
-          }
-          else if (hashCode == Ping_HASH)
-          {
-            return EventType::Ping;
+          case 1623140788:
+            if (name == "AssignmentAccepted")
+            {
+              return EventType::AssignmentAccepted;
+            }
+            break;
+          case -198653593:
+            if (name == "AssignmentAbandoned")
+            {
+              return EventType::AssignmentAbandoned;
+            }
+            break;
+          case -832288804:
+            if (name == "AssignmentReturned")
+            {
+              return EventType::AssignmentReturned;
+            }
+            break;
+          case 1244209294:
+            if (name == "AssignmentSubmitted")
+            {
+              return EventType::AssignmentSubmitted;
+            }
+            break;
+          case -1133797749:
+            if (name == "AssignmentRejected")
+            {
+              return EventType::AssignmentRejected;
+            }
+            break;
+          case 659943620:
+            if (name == "AssignmentApproved")
+            {
+              return EventType::AssignmentApproved;
+            }
+            break;
+          case -1298839563:
+            if (name == "HITCreated")
+            {
+              return EventType::HITCreated;
+            }
+            break;
+          case 658337842:
+            if (name == "HITExpired")
+            {
+              return EventType::HITExpired;
+            }
+            break;
+          case 660578437:
+            if (name == "HITReviewable")
+            {
+              return EventType::HITReviewable;
+            }
+            break;
+          case -955660852:
+            if (name == "HITExtended")
+            {
+              return EventType::HITExtended;
+            }
+            break;
+          case 1150416568:
+            if (name == "HITDisposed")
+            {
+              return EventType::HITDisposed;
+            }
+            break;
+          case 2487698:
+            if (name == "Ping")
+            {
+              return EventType::Ping;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventTypeCStr(EventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventType::AssignmentAccepted:
-            return "AssignmentAccepted";
-          case EventType::AssignmentAbandoned:
-            return "AssignmentAbandoned";
-          case EventType::AssignmentReturned:
-            return "AssignmentReturned";
-          case EventType::AssignmentSubmitted:
-            return "AssignmentSubmitted";
-          case EventType::AssignmentRejected:
-            return "AssignmentRejected";
-          case EventType::AssignmentApproved:
-            return "AssignmentApproved";
-          case EventType::HITCreated:
-            return "HITCreated";
-          case EventType::HITExpired:
-            return "HITExpired";
-          case EventType::HITReviewable:
-            return "HITReviewable";
-          case EventType::HITExtended:
-            return "HITExtended";
-          case EventType::HITDisposed:
-            return "HITDisposed";
-          case EventType::Ping:
-            return "Ping";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventType(EventType enumValue)
+        {
+          return GetNameForEventTypeCStr(enumValue);
         }
 
       } // namespace EventTypeMapper
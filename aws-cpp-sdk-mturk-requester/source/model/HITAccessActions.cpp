@@ -30,25 +30,44 @@ namespace Aws
       namespace HITAccessActionsMapper
       {
 
-        static const int Accept_HASH = HashingUtils::HashString("Accept");
-        static const int PreviewAndAccept_HASH = HashingUtils::HashString("PreviewAndAccept");
-        static const int DiscoverPreviewAndAccept_HASH = HashingUtils::HashString("DiscoverPreviewAndAccept");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Accept",
+          "PreviewAndAccept",
+          "DiscoverPreviewAndAccept",
+        };
 
         HITAccessActions GetHITAccessActionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Accept_HASH)
-          {
-            return HITAccessActions::Accept;
-          }
-          else if (hashCode == PreviewAndAccept_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HITAccessActions::PreviewAndAccept;
-          }
-          else if (hashCode == DiscoverPreviewAndAccept_HASH)
-          {
-            return HITAccessActions::DiscoverPreviewAndAccept;
+          case 1955373352:
+            if (name == "Accept")
+            {
+              return HITAccessActions::Accept;
+            }
+            break;
+          case 1762156279:
+            if (name == "PreviewAndAccept")
+            {
+              return HITAccessActions::PreviewAndAccept;
+            }
+            break;
+          case -907278080:
+            if (name == "DiscoverPreviewAndAccept")
+            {
+              return HITAccessActions::DiscoverPreviewAndAccept;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return HITAccessActions::NOT_SET;
         }
 
-        Aws::String GetNameForHITAccessActions(HITAccessActions enumValue)
+        const char* GetNameForHITAccessActionsCStr(HITAccessActions enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HITAccessActions::Accept:
-            return "Accept";
-          case HITAccessActions::PreviewAndAccept:
-            return "PreviewAndAccept";
-          case HITAccessActions::DiscoverPreviewAndAccept:
-            return "DiscoverPreviewAndAccept";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHITAccessActions(HITAccessActions enumValue)
+        {
+          return GetNameForHITAccessActionsCStr(enumValue);
         }
 
       } // namespace HITAccessActionsMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace HITReviewStatusMapper
       {
 
-        static const int NotReviewed_HASH = HashingUtils::HashString("NotReviewed");
-        static const int MarkedForReview_HASH = HashingUtils::HashString("MarkedForReview");
-        static const int ReviewedAppropriate_HASH = HashingUtils::HashString("ReviewedAppropriate");
-        static const int ReviewedInappropriate_HASH = HashingUtils::HashString("ReviewedInappropriate");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NotReviewed",
+          "MarkedForReview",
+          "ReviewedAppropriate",
+          "ReviewedInappropriate",
+        };
 
         HITReviewStatus GetHITReviewStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NotReviewed_HASH)
-          {
-            return HITReviewStatus::NotReviewed;
-          }
-          else if (hashCode == MarkedForReview_HASH)
-          {
-            return HITReviewStatus::MarkedForReview;
-          }
-          else if (hashCode == ReviewedAppropriate_HASH)
-          {
-            return HITReviewStatus::ReviewedAppropriate;
-          }
-          else if (hashCode == ReviewedInappropriate_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HITReviewStatus::ReviewedInappropriate;
+          case 1825685962:
+            if (name == "NotReviewed")
+            {
+              return HITReviewStatus::NotReviewed;
+            }
+            break;
+          case -367056235:
+            if (name == "MarkedForReview")
+            {
+              return HITReviewStatus::MarkedForReview;
+            }
+            break;
+          case 836057490:
+            if (name == "ReviewedAppropriate")
+            {
+              return HITReviewStatus::ReviewedAppropriate;
+            }
+            break;
+          case -1504101107:
+            if (name == "ReviewedInappropriate")
+            {
+              return HITReviewStatus::ReviewedInappropriate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return HITReviewStatus::NOT_SET;
         }
 
-        Aws::String GetNameForHITReviewStatus(HITReviewStatus enumValue)
+        const char* GetNameForHITReviewStatusCStr(HITReviewStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HITReviewStatus::NotReviewed:
-            return "NotReviewed";
-          case HITReviewStatus::MarkedForReview:
-            return "MarkedForReview";
-          case HITReviewStatus::ReviewedAppropriate:
-            return "ReviewedAppropriate";
-          case HITReviewStatus::ReviewedInappropriate:
-            return "ReviewedInappropriate";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHITReviewStatus(HITReviewStatus enumValue)
+        {
+          return GetNameForHITReviewStatusCStr(enumValue);
         }
 
       } // namespace HITReviewStatusMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace HITStatusMapper
       {
 
-        static const int Assignable_HASH = HashingUtils::HashString("Assignable");
-        static const int Unassignable_HASH = HashingUtils::HashString("Unassignable");
-        static const int Reviewable_HASH = HashingUtils::HashString("Reviewable");
-        static const int Reviewing_HASH = HashingUtils::HashString("Reviewing");
-        static const int Disposed_HASH = HashingUtils::HashString("Disposed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Assignable",
+          "Unassignable",
+          "Reviewable",
+          "Reviewing",
+          "Disposed",
+        };
 
         HITStatus GetHITStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Assignable_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HITStatus::Assignable;
-          }
-          else if (hashCode == Unassignable_HASH)
-          {
-            return HITStatus::Unassignable;
-          }
-          else if (hashCode == Reviewable_HASH)
-          {
-            return HITStatus::Reviewable;
-          }
-          else if (hashCode == Reviewing_HASH)
-          {
-            return HITStatus::Reviewing;
-          }
-          else if (hashCode == Disposed_HASH)
-          {
-            return HITStatus::Disposed;
+          case -1275600151:
+            if (name == "Assignable")
+            {
+              return HITStatus::Assignable;
+            }
+            break;
+          case -983122366:
+            if (name == "Unassignable")
+            {
+              return HITStatus::Unassignable;
+            }
+            break;
+          case 97713362:
+            if (name == "Reviewable")
+            {
+              return HITStatus::Reviewable;
+            }
+            break;
+          case -1797955222:
+            if (name == "Reviewing")
+            {
+              return HITStatus::Reviewing;
+            }
+            break;
+          case 349831749:
+            if (name == "Disposed")
+            {
+              return HITStatus::Disposed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return HITStatus::NOT_SET;
         }
 
-        Aws::String GetNameForHITStatus(HITStatus enumValue)
+        const char* GetNameForHITStatusCStr(HITStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HITStatus::Assignable:
-            return "Assignable";
-          case HITStatus::Unassignable:
-            return "Unassignable";
-          case HITStatus::Reviewable:
-            return "Reviewable";
-          case HITStatus::Reviewing:
-            return "Reviewing";
-          case HITStatus::Disposed:
-            return "Disposed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHITStatus(HITStatus enumValue)
+        {
+          return GetNameForHITStatusCStr(enumValue);
         }
 
       } // namespace HITStatusMapper
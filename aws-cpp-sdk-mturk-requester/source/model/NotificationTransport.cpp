@@ -30,25 +30,44 @@ namespace Aws
       namespace NotificationTransportMapper
       {
 
-        static const int Email_HASH = HashingUtils::HashString("Email");
-        static const int SQS_HASH = HashingUtils::HashString("SQS");
-        static const int SNS_HASH = HashingUtils::HashString("SNS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Email",
+          "SQS",
+          "SNS",
+        };
 
         NotificationTransport GetNotificationTransportForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Email_HASH)
-          {
-            return NotificationTransport::Email;
-          }
-          else if (hashCode == SQS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NotificationTransport::SQS;
-          }
-          else if (hashCode == SNS_HASH)
-          {
-            return NotificationTransport::SNS;
+          case 67066748:
+            if (name == "Email")
+            {
+              return NotificationTransport::Email;
+            }
+            break;
+          case 82357:
+            if (name == "SQS")
+            {
+              return NotificationTransport::SQS;
+            }
+            break;
+          case 82264:
+            if (name == "SNS")
+            {
+              return NotificationTransport::SNS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return NotificationTransport::NOT_SET;
         }
 
-        Aws::String GetNameForNotificationTransport(NotificationTransport enumValue)
+        const char* GetNameForNotificationTransportCStr(NotificationTransport enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NotificationTransport::Email:
-            return "Email";
-          case NotificationTransport::SQS:
-            return "SQS";
-          case NotificationTransport::SNS:
-            return "SNS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNotificationTransport(NotificationTransport enumValue)
+        {
+          return GetNameForNotificationTransportCStr(enumValue);
         }
 
       } // namespace NotificationTransportMapper
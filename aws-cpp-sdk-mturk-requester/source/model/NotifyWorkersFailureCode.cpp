@@ -30,20 +30,37 @@ namespace Aws
       namespace NotifyWorkersFailureCodeMapper
       {
 
-        static const int SoftFailure_HASH = HashingUtils::HashString("SoftFailure");
-        static const int HardFailure_HASH = HashingUtils::HashString("HardFailure");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SoftFailure",
+          "HardFailure",
+        };
 
         NotifyWorkersFailureCode GetNotifyWorkersFailureCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SoftFailure_HASH)
-          {
-            return NotifyWorkersFailureCode::SoftFailure;
-          }
-          else if (hashCode == HardFailure_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NotifyWorkersFailureCode::HardFailure;
+          case 2042583520:
+            if (name == "SoftFailure")
+            {
+              return NotifyWorkersFailureCode::SoftFailure;
+            }
+            break;
+          case 755622399:
+            if (name == "HardFailure")
+            {
+              return NotifyWorkersFailureCode::HardFailure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return NotifyWorkersFailureCode::NOT_SET;
         }
 
-        Aws::String GetNameForNotifyWorkersFailureCode(NotifyWorkersFailureCode enumValue)
+        const char* GetNameForNotifyWorkersFailureCodeCStr(NotifyWorkersFailureCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NotifyWorkersFailureCode::SoftFailure:
-            return "SoftFailure";
-          case NotifyWorkersFailureCode::HardFailure:
-            return "HardFailure";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNotifyWorkersFailureCode(NotifyWorkersFailureCode enumValue)
+        {
+          return GetNameForNotifyWorkersFailureCodeCStr(enumValue);
         }
 
       } // namespace NotifyWorkersFailureCodeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace QualificationStatusMapper
       {
 
-        static const int Granted_HASH = HashingUtils::HashString("Granted");
-        static const int Revoked_HASH = HashingUtils::HashString("Revoked");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Granted",
+          "Revoked",
+        };
 
         QualificationStatus GetQualificationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Granted_HASH)
-          {
-            return QualificationStatus::Granted;
-          }
-          else if (hashCode == Revoked_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return QualificationStatus::Revoked;
+          case 1944948379:
+            if (name == "Granted")
+            {
+              return QualificationStatus::Granted;
+            }
+            break;
+          case -1530176898:
+            if (name == "Revoked")
+            {
+              return QualificationStatus::Revoked;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return QualificationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForQualificationStatus(QualificationStatus enumValue)
+        const char* GetNameForQualificationStatusCStr(QualificationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QualificationStatus::Granted:
-            return "Granted";
-          case QualificationStatus::Revoked:
-            return "Revoked";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQualificationStatus(QualificationStatus enumValue)
+        {
+          return GetNameForQualificationStatusCStr(enumValue);
         }
 
       } // namespace QualificationStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ReviewActionStatusMapper
       {
 
-        static const int Intended_HASH = HashingUtils::HashString("Intended");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Intended",
+          "Succeeded",
+          "Failed",
+          "Cancelled",
+        };
 
         ReviewActionStatus GetReviewActionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Intended_HASH)
-          {
-            return ReviewActionStatus::Intended;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return ReviewActionStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ReviewActionStatus::Failed;
-          }
-          else if (hashCode == Cancelled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReviewActionStatus::Cancelled;
+          case 634926155:
+            if (name == "Intended")
+            {
+              return ReviewActionStatus::Intended;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return ReviewActionStatus::Succeeded;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return ReviewActionStatus::Failed;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return ReviewActionStatus::Cancelled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ReviewActionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReviewActionStatus(ReviewActionStatus enumValue)
+        const char* GetNameForReviewActionStatusCStr(ReviewActionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReviewActionStatus::Intended:
-            return "Intended";
-          case ReviewActionStatus::Succeeded:
-            return "Succeeded";
-          case ReviewActionStatus::Failed:
-            return "Failed";
-          case ReviewActionStatus::Cancelled:
-            return "Cancelled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReviewActionStatus(ReviewActionStatus enumValue)
+        {
+          return GetNameForReviewActionStatusCStr(enumValue);
         }
 
       } // namespace ReviewActionStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ReviewPolicyLevelMapper
       {
 
-        static const int Assignment_HASH = HashingUtils::HashString("Assignment");
-        static const int HIT_HASH = HashingUtils::HashString("HIT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Assignment",
+          "HIT",
+        };
 
         ReviewPolicyLevel GetReviewPolicyLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Assignment_HASH)
-          {
-            return ReviewPolicyLevel::Assignment;
-          }
-          else if (hashCode == HIT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReviewPolicyLevel::HIT;
+          case -1275239699:
+            if (name == "Assignment")
+            {
+              return ReviewPolicyLevel::Assignment;
+            }
+            break;
+          case 71539:
+            if (name == "HIT")
+            {
+              return ReviewPolicyLevel::HIT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReviewPolicyLevel::NOT_SET;
         }
 
-        Aws::String GetNameForReviewPolicyLevel(ReviewPolicyLevel enumValue)
+        const char* GetNameForReviewPolicyLevelCStr(ReviewPolicyLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReviewPolicyLevel::Assignment:
-            return "Assignment";
-          case ReviewPolicyLevel::HIT:
-            return "HIT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReviewPolicyLevel(ReviewPolicyLevel enumValue)
+        {
+          return GetNameForReviewPolicyLevelCStr(enumValue);
         }
 
       } // namespace ReviewPolicyLevelMapper
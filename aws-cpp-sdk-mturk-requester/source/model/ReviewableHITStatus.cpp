@@ -30,20 +30,37 @@ namespace Aws
       namespace ReviewableHITStatusMapper
       {
 
-        static const int Reviewable_HASH = HashingUtils::HashString("Reviewable");
-        static const int Reviewing_HASH = HashingUtils::HashString("Reviewing");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Reviewable",
+          "Reviewing",
+        };
 
         ReviewableHITStatus GetReviewableHITStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Reviewable_HASH)
-          {
-            return ReviewableHITStatus::Reviewable;
-          }
-          else if (hashCode == Reviewing_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReviewableHITStatus::Reviewing;
+          case 97713362:
+            if (name == "Reviewable")
+            {
+              return ReviewableHITStatus::Reviewable;
+            }
+            break;
+          case -1797955222:
+            if (name == "Reviewing")
+            {
+              return ReviewableHITStatus::Reviewing;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReviewableHITStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReviewableHITStatus(ReviewableHITStatus enumValue)
+        const char* GetNameForReviewableHITStatusCStr(ReviewableHITStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReviewableHITStatus::Reviewable:
-            return "Reviewable";
-          case ReviewableHITStatus::Reviewing:
-            return "Reviewing";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReviewableHITStatus(ReviewableHITStatus enumValue)
+        {
+          return GetNameForReviewableHITStatusCStr(enumValue);
         }
 
       } // namespace ReviewableHITStatusMapper
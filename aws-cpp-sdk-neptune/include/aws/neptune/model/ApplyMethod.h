@@ -35,6 +35,11 @@ namespace ApplyMethodMapper
 AWS_NEPTUNE_API ApplyMethod GetApplyMethodForName(const Aws::String& name);
 
 AWS_NEPTUNE_API Aws::String GetNameForApplyMethod(ApplyMethod value);
+
+/**
+ * Same as GetNameForApplyMethod(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_NEPTUNE_API const char* GetNameForApplyMethodCStr(ApplyMethod value);
 } // namespace ApplyMethodMapper
 } // namespace Model
 } // namespace Neptune
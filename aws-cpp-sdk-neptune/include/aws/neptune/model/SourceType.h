@@ -39,6 +39,11 @@ namespace SourceTypeMapper
 AWS_NEPTUNE_API SourceType GetSourceTypeForName(const Aws::String& name);
 
 AWS_NEPTUNE_API Aws::String GetNameForSourceType(SourceType value);
+
+/**
+ * Same as GetNameForSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_NEPTUNE_API const char* GetNameForSourceTypeCStr(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace Neptune
@@ -30,40 +30,65 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int db_instance_HASH = HashingUtils::HashString("db-instance");
-        static const int db_parameter_group_HASH = HashingUtils::HashString("db-parameter-group");
-        static const int db_security_group_HASH = HashingUtils::HashString("db-security-group");
-        static const int db_snapshot_HASH = HashingUtils::HashString("db-snapshot");
-        static const int db_cluster_HASH = HashingUtils::HashString("db-cluster");
-        static const int db_cluster_snapshot_HASH = HashingUtils::HashString("db-cluster-snapshot");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "db-instance",
+          "db-parameter-group",
+          "db-security-group",
+          "db-snapshot",
+          "db-cluster",
+          "db-cluster-snapshot",
+        };
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == db_instance_HASH)
-          {
-            return SourceType::db_instance;
-          }
-          else if (hashCode == db_parameter_group_HASH)
-          {
-            return SourceType::db_parameter_group;
-          }
-          else if (hashCode == db_security_group_HASH)
-          {
-            return SourceType::db_security_group;
-          }
-          else if (hashCode == db_snapshot_HASH)
-          {
-            return SourceType::db_snapshot;
-          }
-          else if (hashCode == db_cluster_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SourceType::db_cluster;
-          }
-          else if (hashCode == db_cluster_snapshot_HASH)
-          {
-            return SourceType::db_cluster_snapshot;
+          case -560908028:
+            if (name == "db-instance")
+            {
+              return SourceType::db_instance;
+            }
+            break;
+          case 683404300:
+            if (name == "db-parameter-group")
+            {
+              return SourceType::db_parameter_group;
+            }
+            break;
+          case 1016751841:
+            if (name == "db-security-group")
+            {
+              return SourceType::db_security_group;
+            }
+            break;
+          case -831161805:
+            if (name == "db-snapshot")
+            {
+              return SourceType::db_snapshot;
+            }
+            break;
+          case -1519213653:
+            if (name == "db-cluster")
+            {
+              return SourceType::db_cluster;
+            }
+            break;
+          case 1810212262:
+            if (name == "db-cluster-snapshot")
+            {
+              return SourceType::db_cluster_snapshot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceTypeCStr(SourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SourceType::db_instance:
-            return "db-instance";
-          case SourceType::db_parameter_group:
-            return "db-parameter-group";
-          case SourceType::db_security_group:
-            return "db-security-group";
-          case SourceType::db_snapshot:
-            return "db-snapshot";
-          case SourceType::db_cluster:
-            return "db-cluster";
-          case SourceType::db_cluster_snapshot:
-            return "db-cluster-snapshot";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSourceType(SourceType enumValue)
+        {
+          return GetNameForSourceTypeCStr(enumValue);
         }
 
       } // namespace SourceTypeMapper
@@ -37,6 +37,11 @@ namespace AppAttributesKeysMapper
 AWS_OPSWORKS_API AppAttributesKeys GetAppAttributesKeysForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForAppAttributesKeys(AppAttributesKeys value);
+
+/**
+ * Same as GetNameForAppAttributesKeys(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForAppAttributesKeysCStr(AppAttributesKeys value);
 } // namespace AppAttributesKeysMapper
 } // namespace Model
 } // namespace OpsWorks
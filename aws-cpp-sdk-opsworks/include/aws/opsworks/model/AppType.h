@@ -40,6 +40,11 @@ namespace AppTypeMapper
 AWS_OPSWORKS_API AppType GetAppTypeForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForAppType(AppType value);
+
+/**
+ * Same as GetNameForAppType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForAppTypeCStr(AppType value);
 } // namespace AppTypeMapper
 } // namespace Model
 } // namespace OpsWorks
@@ -35,6 +35,11 @@ namespace AutoScalingTypeMapper
 AWS_OPSWORKS_API AutoScalingType GetAutoScalingTypeForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForAutoScalingType(AutoScalingType value);
+
+/**
+ * Same as GetNameForAutoScalingType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForAutoScalingTypeCStr(AutoScalingType value);
 } // namespace AutoScalingTypeMapper
 } // namespace Model
 } // namespace OpsWorks
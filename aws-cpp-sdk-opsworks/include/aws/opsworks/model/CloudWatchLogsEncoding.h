@@ -125,6 +125,11 @@ namespace CloudWatchLogsEncodingMapper
 AWS_OPSWORKS_API CloudWatchLogsEncoding GetCloudWatchLogsEncodingForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForCloudWatchLogsEncoding(CloudWatchLogsEncoding value);
+
+/**
+ * Same as GetNameForCloudWatchLogsEncoding(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForCloudWatchLogsEncodingCStr(CloudWatchLogsEncoding value);
 } // namespace CloudWatchLogsEncodingMapper
 } // namespace Model
 } // namespace OpsWorks
@@ -35,6 +35,11 @@ namespace CloudWatchLogsInitialPositionMapper
 AWS_OPSWORKS_API CloudWatchLogsInitialPosition GetCloudWatchLogsInitialPositionForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForCloudWatchLogsInitialPosition(CloudWatchLogsInitialPosition value);
+
+/**
+ * Same as GetNameForCloudWatchLogsInitialPosition(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForCloudWatchLogsInitialPositionCStr(CloudWatchLogsInitialPosition value);
 } // namespace CloudWatchLogsInitialPositionMapper
 } // namespace Model
 } // namespace OpsWorks
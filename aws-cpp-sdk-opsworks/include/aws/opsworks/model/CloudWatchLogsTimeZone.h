@@ -35,6 +35,11 @@ namespace CloudWatchLogsTimeZoneMapper
 AWS_OPSWORKS_API CloudWatchLogsTimeZone GetCloudWatchLogsTimeZoneForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForCloudWatchLogsTimeZone(CloudWatchLogsTimeZone value);
+
+/**
+ * Same as GetNameForCloudWatchLogsTimeZone(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForCloudWatchLogsTimeZoneCStr(CloudWatchLogsTimeZone value);
 } // namespace CloudWatchLogsTimeZoneMapper
 } // namespace Model
 } // namespace OpsWorks
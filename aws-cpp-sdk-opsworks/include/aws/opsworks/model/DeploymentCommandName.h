@@ -45,6 +45,11 @@ namespace DeploymentCommandNameMapper
 AWS_OPSWORKS_API DeploymentCommandName GetDeploymentCommandNameForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForDeploymentCommandName(DeploymentCommandName value);
+
+/**
+ * Same as GetNameForDeploymentCommandName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForDeploymentCommandNameCStr(DeploymentCommandName value);
 } // namespace DeploymentCommandNameMapper
 } // namespace Model
 } // namespace OpsWorks
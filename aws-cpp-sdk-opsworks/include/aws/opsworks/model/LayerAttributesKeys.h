@@ -58,6 +58,11 @@ namespace LayerAttributesKeysMapper
 AWS_OPSWORKS_API LayerAttributesKeys GetLayerAttributesKeysForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForLayerAttributesKeys(LayerAttributesKeys value);
+
+/**
+ * Same as GetNameForLayerAttributesKeys(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForLayerAttributesKeysCStr(LayerAttributesKeys value);
 } // namespace LayerAttributesKeysMapper
 } // namespace Model
 } // namespace OpsWorks
@@ -45,6 +45,11 @@ namespace LayerTypeMapper
 AWS_OPSWORKS_API LayerType GetLayerTypeForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForLayerType(LayerType value);
+
+/**
+ * Same as GetNameForLayerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForLayerTypeCStr(LayerType value);
 } // namespace LayerTypeMapper
 } // namespace Model
 } // namespace OpsWorks
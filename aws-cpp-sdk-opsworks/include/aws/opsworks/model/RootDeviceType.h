@@ -35,6 +35,11 @@ namespace RootDeviceTypeMapper
 AWS_OPSWORKS_API RootDeviceType GetRootDeviceTypeForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForRootDeviceType(RootDeviceType value);
+
+/**
+ * Same as GetNameForRootDeviceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForRootDeviceTypeCStr(RootDeviceType value);
 } // namespace RootDeviceTypeMapper
 } // namespace Model
 } // namespace OpsWorks
@@ -34,6 +34,11 @@ namespace StackAttributesKeysMapper
 AWS_OPSWORKS_API StackAttributesKeys GetStackAttributesKeysForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForStackAttributesKeys(StackAttributesKeys value);
+
+/**
+ * Same as GetNameForStackAttributesKeys(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForStackAttributesKeysCStr(StackAttributesKeys value);
 } // namespace StackAttributesKeysMapper
 } // namespace Model
 } // namespace OpsWorks
@@ -35,6 +35,11 @@ namespace VirtualizationTypeMapper
 AWS_OPSWORKS_API VirtualizationType GetVirtualizationTypeForName(const Aws::String& name);
 
 AWS_OPSWORKS_API Aws::String GetNameForVirtualizationType(VirtualizationType value);
+
+/**
+ * Same as GetNameForVirtualizationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKS_API const char* GetNameForVirtualizationTypeCStr(VirtualizationType value);
 } // namespace VirtualizationTypeMapper
 } // namespace Model
 } // namespace OpsWorks
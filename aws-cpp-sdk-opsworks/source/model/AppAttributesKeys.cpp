@@ -30,30 +30,51 @@ namespace Aws
       namespace AppAttributesKeysMapper
       {
 
-        static const int DocumentRoot_HASH = HashingUtils::HashString("DocumentRoot");
-        static const int RailsEnv_HASH = HashingUtils::HashString("RailsEnv");
-        static const int AutoBundleOnDeploy_HASH = HashingUtils::HashString("AutoBundleOnDeploy");
-        static const int AwsFlowRubySettings_HASH = HashingUtils::HashString("AwsFlowRubySettings");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DocumentRoot",
+          "RailsEnv",
+          "AutoBundleOnDeploy",
+          "AwsFlowRubySettings",
+        };
 
         AppAttributesKeys GetAppAttributesKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DocumentRoot_HASH)
-          {
-            return AppAttributesKeys::DocumentRoot;
-          }
-          else if (hashCode == RailsEnv_HASH)
-          {
-            return AppAttributesKeys::RailsEnv;
-          }
-          else if (hashCode == AutoBundleOnDeploy_HASH)
-          {
-            return AppAttributesKeys::AutoBundleOnDeploy;
-          }
-          else if (hashCode == AwsFlowRubySettings_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AppAttributesKeys::AwsFlowRubySettings;
+          case -1308945219:
+            if (name == "DocumentRoot")
+            {
+              return AppAttributesKeys::DocumentRoot;
+            }
+            break;
+          case 179367468:
+            if (name == "RailsEnv")
+            {
+              return AppAttributesKeys::RailsEnv;
+            }
+            break;
+          case 2027323895:
+            if (name == "AutoBundleOnDeploy")
+            {
+              return AppAttributesKeys::AutoBundleOnDeploy;
+            }
+            break;
+          case -1373165208:
+            if (name == "AwsFlowRubySettings")
+            {
+              return AppAttributesKeys::AwsFlowRubySettings;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return AppAttributesKeys::NOT_SET;
         }
 
-        Aws::String GetNameForAppAttributesKeys(AppAttributesKeys enumValue)
+        const char* GetNameForAppAttributesKeysCStr(AppAttributesKeys enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AppAttributesKeys::DocumentRoot:
-            return "DocumentRoot";
-          case AppAttributesKeys::RailsEnv:
-            return "RailsEnv";
-          case AppAttributesKeys::AutoBundleOnDeploy:
-            return "AutoBundleOnDeploy";
-          case AppAttributesKeys::AwsFlowRubySettings:
-            return "AwsFlowRubySettings";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAppAttributesKeys(AppAttributesKeys enumValue)
+        {
+          return GetNameForAppAttributesKeysCStr(enumValue);
         }
 
       } // namespace AppAttributesKeysMapper
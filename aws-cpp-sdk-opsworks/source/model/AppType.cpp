@@ -30,45 +30,72 @@ namespace Aws
       namespace AppTypeMapper
       {
 
-        static const int aws_flow_ruby_HASH = HashingUtils::HashString("aws-flow-ruby");
-        static const int java_HASH = HashingUtils::HashString("java");
-        static const int rails_HASH = HashingUtils::HashString("rails");
-        static const int php_HASH = HashingUtils::HashString("php");
-        static const int nodejs_HASH = HashingUtils::HashString("nodejs");
-        static const int static__HASH = HashingUtils::HashString("static");
-        static const int other_HASH = HashingUtils::HashString("other");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "aws-flow-ruby",
+          "java",
+          "rails",
+          "php",
+          "nodejs",
+          "static",
+          "other",
+        };
 
         AppType GetAppTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_flow_ruby_HASH)
-          {
-            return AppType::aws_flow_ruby;
-          }
-          else if (hashCode == java_HASH)
-          {
-            return AppType::java;
-          }
-          else if (hashCode == rails_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AppType::rails;
-          }
-          else if (hashCode == php_HASH)
-          {
-            return AppType::php;
-          }
-          else if (hashCode == nodejs_HASH)
-          {
-            return AppType::nodejs;
-          }
-          else if (hashCode == static__HASH)
-          {
-            return AppType::static_;
-          }
-          else if (hashCode == other_HASH)
-          {
-            return AppType::other;
+          case 1790298185:
+            if (name == "aws-flow-ruby")
+            {
+              return AppType::aws_flow_ruby;
+            }
+            break;
+          case 3254818:
+            if (name == "java")
+            {
+              return AppType::java;
+            }
+            break;
+          case 108275489:
+            if (name == "rails")
+            {
+              return AppType::rails;
+            }
+            break;
+          case 110968:
+            if (name == "php")
+            {
+              return AppType::php;
+            }
+            break;
+          case -1040170293:
+            if (name == "nodejs")
+            {
+              return AppType::nodejs;
+            }
+            break;
+          case -892481938:
+            if (name == "static")
+            {
+              return AppType::static_;
+            }
+            break;
+          case 106069776:
+            if (name == "other")
+            {
+              return AppType::other;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return AppType::NOT_SET;
         }
 
-        Aws::String GetNameForAppType(AppType enumValue)
+        const char* GetNameForAppTypeCStr(AppType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AppType::aws_flow_ruby:
-            return "aws-flow-ruby";
-          case AppType::java:
-            return "java";
-          case AppType::rails:
-            return "rails";
-          case AppType::php:
-            return "php";
-          case AppType::nodejs:
-            return "nodejs";
-          case AppType::static_:
-            return "static";
-          case AppType::other:
-            return "other";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAppType(AppType enumValue)
+        {
+          return GetNameForAppTypeCStr(enumValue);
         }
 
       } // namespace AppTypeMapper
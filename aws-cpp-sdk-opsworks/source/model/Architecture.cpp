@@ -30,20 +30,37 @@ namespace Aws
       namespace ArchitectureMapper
       {
 
-        static const int x86_64_HASH = HashingUtils::HashString("x86_64");
-        static const int i386_HASH = HashingUtils::HashString("i386");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "x86_64",
+          "i386",
+        };
 
         Architecture GetArchitectureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == x86_64_HASH)
-          {
-            return Architecture::x86_64;
-          }
-          else if (hashCode == i386_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Architecture::i386;
+          case -806050265:
+            if (name == "x86_64")
+            {
+              return Architecture::x86_64;
+            }
+            break;
+          case 3178856:
+            if (name == "i386")
+            {
+              return Architecture::i386;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Architecture::NOT_SET;
         }
 
-        Aws::String GetNameForArchitecture(Architecture enumValue)
+        const char* GetNameForArchitectureCStr(Architecture enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Architecture::x86_64:
-            return "x86_64";
-          case Architecture::i386:
-            return "i386";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForArchitecture(Architecture enumValue)
+        {
+          return GetNameForArchitectureCStr(enumValue);
         }
 
       } // namespace ArchitectureMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace AutoScalingTypeMapper
       {
 
-        static const int load_HASH = HashingUtils::HashString("load");
-        static const int timer_HASH = HashingUtils::HashString("timer");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "load",
+          "timer",
+        };
 
         AutoScalingType GetAutoScalingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == load_HASH)
-          {
-            return AutoScalingType::load;
-          }
-          else if (hashCode == timer_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AutoScalingType::timer;
+          case 3327206:
+            if (name == "load")
+            {
+              return AutoScalingType::load;
+            }
+            break;
+          case 110364485:
+            if (name == "timer")
+            {
+              return AutoScalingType::timer;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AutoScalingType::NOT_SET;
         }
 
-        Aws::String GetNameForAutoScalingType(AutoScalingType enumValue)
+        const char* GetNameForAutoScalingTypeCStr(AutoScalingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AutoScalingType::load:
-            return "load";
-          case AutoScalingType::timer:
-            return "timer";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAutoScalingType(AutoScalingType enumValue)
+        {
+          return GetNameForAutoScalingTypeCStr(enumValue);
         }
 
       } // namespace AutoScalingTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CloudWatchLogsInitialPositionMapper
       {
 
-        static const int start_of_file_HASH = HashingUtils::HashString("start_of_file");
-        static const int end_of_file_HASH = HashingUtils::HashString("end_of_file");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "start_of_file",
+          "end_of_file",
+        };
 
         CloudWatchLogsInitialPosition GetCloudWatchLogsInitialPositionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == start_of_file_HASH)
-          {
-            return CloudWatchLogsInitialPosition::start_of_file;
-          }
-          else if (hashCode == end_of_file_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CloudWatchLogsInitialPosition::end_of_file;
+          case 865441799:
+            if (name == "start_of_file")
+            {
+              return CloudWatchLogsInitialPosition::start_of_file;
+            }
+            break;
+          case -798960768:
+            if (name == "end_of_file")
+            {
+              return CloudWatchLogsInitialPosition::end_of_file;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CloudWatchLogsInitialPosition::NOT_SET;
         }
 
-        Aws::String GetNameForCloudWatchLogsInitialPosition(CloudWatchLogsInitialPosition enumValue)
+        const char* GetNameForCloudWatchLogsInitialPositionCStr(CloudWatchLogsInitialPosition enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CloudWatchLogsInitialPosition::start_of_file:
-            return "start_of_file";
-          case CloudWatchLogsInitialPosition::end_of_file:
-            return "end_of_file";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCloudWatchLogsInitialPosition(CloudWatchLogsInitialPosition enumValue)
+        {
+          return GetNameForCloudWatchLogsInitialPositionCStr(enumValue);
         }
 
       } // namespace CloudWatchLogsInitialPositionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CloudWatchLogsTimeZoneMapper
       {
 
-        static const int LOCAL_HASH = HashingUtils::HashString("LOCAL");
-        static const int UTC_HASH = HashingUtils::HashString("UTC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LOCAL",
+          "UTC",
+        };
 
         CloudWatchLogsTimeZone GetCloudWatchLogsTimeZoneForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LOCAL_HASH)
-          {
-            return CloudWatchLogsTimeZone::LOCAL;
-          }
-          else if (hashCode == UTC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CloudWatchLogsTimeZone::UTC;
+          case 72607563:
+            if (name == "LOCAL")
+            {
+              return CloudWatchLogsTimeZone::LOCAL;
+            }
+            break;
+          case 84356:
+            if (name == "UTC")
+            {
+              return CloudWatchLogsTimeZone::UTC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CloudWatchLogsTimeZone::NOT_SET;
         }
 
-        Aws::String GetNameForCloudWatchLogsTimeZone(CloudWatchLogsTimeZone enumValue)
+        const char* GetNameForCloudWatchLogsTimeZoneCStr(CloudWatchLogsTimeZone enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CloudWatchLogsTimeZone::LOCAL:
-            return "LOCAL";
-          case CloudWatchLogsTimeZone::UTC:
-            return "UTC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCloudWatchLogsTimeZone(CloudWatchLogsTimeZone enumValue)
+        {
+          return GetNameForCloudWatchLogsTimeZoneCStr(enumValue);
         }
 
       } // namespace CloudWatchLogsTimeZoneMapper
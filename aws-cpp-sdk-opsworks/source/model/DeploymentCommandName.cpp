@@ -30,70 +30,107 @@ namespace Aws
       namespace DeploymentCommandNameMapper
       {
 
-        static const int install_dependencies_HASH = HashingUtils::HashString("install_dependencies");
-        static const int update_dependencies_HASH = HashingUtils::HashString("update_dependencies");
-        static const int update_custom_cookbooks_HASH = HashingUtils::HashString("update_custom_cookbooks");
-        static const int execute_recipes_HASH = HashingUtils::HashString("execute_recipes");
-        static const int configure_HASH = HashingUtils::HashString("configure");
-        static const int setup_HASH = HashingUtils::HashString("setup");
-        static const int deploy_HASH = HashingUtils::HashString("deploy");
-        static const int rollback_HASH = HashingUtils::HashString("rollback");
-        static const int start_HASH = HashingUtils::HashString("start");
-        static const int stop_HASH = HashingUtils::HashString("stop");
-        static const int restart_HASH = HashingUtils::HashString("restart");
-        static const int undeploy_HASH = HashingUtils::HashString("undeploy");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "install_dependencies",
+          "update_dependencies",
+          "update_custom_cookbooks",
+          "execute_recipes",
+          "configure",
+          "setup",
+          "deploy",
+          "rollback",
+          "start",
+          "stop",
+          "restart",
+          "undeploy",
+        };
 
         DeploymentCommandName GetDeploymentCommandNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == install_dependencies_HASH)
-          {
-            return DeploymentCommandName::install_dependencies;
-          }
-          else if (hashCode == update_dependencies_HASH)
-          {
-            return DeploymentCommandName::update_dependencies;
-          }
-          else if (hashCode == update_custom_cookbooks_HASH)
-          {
-            return DeploymentCommandName::update_custom_cookbooks;
-          }
-          else if (hashCode == execute_recipes_HASH)
-          {
-            return DeploymentCommandName::execute_recipes;
-          }
-          else if (hashCode == configure_HASH)
-          {
-            return DeploymentCommandName::configure;
-          }
-          else if (hashCode == setup_HASH)
-          {
-            return DeploymentCommandName::setup;
-          }
-          else if (hashCode == deploy_HASH)
-          {
-            return DeploymentCommandName::deploy;
-          }
-          else if (hashCode == rollback_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentCommandName::rollback;
-          }
-          else if (hashCode == start_HASH)
-          {
-            return DeploymentCommandName::start;
-          }
-          else if (hashCode == stop_HASH)
-          {
-            return DeploymentCommandName::stop;
-          }
-          else if (hashCode == restart_HASH)
-          {
-            return DeploymentCommandName::restart;
-          }
-          else if (hashCode == undeploy_HASH)
-          {
-            return DeploymentCommandName::undeploy;
+          case -2044365491:
+            if (name == "install_dependencies")
+            {
+              return DeploymentCommandName::install_dependencies;
+            }
+            break;
+          case 1843690719:
+            if (name == "update_dependencies")
+            {
+              return DeploymentCommandName::update_dependencies;
+            }
+            break;
+          case 1736450506:
+            if (name == "update_custom_cookbooks")
+            {
+              return DeploymentCommandName::update_custom_cookbooks;
+            }
+            break;
+          case 1892464091:
+            if (name == "execute_recipes")
+            {
+              return DeploymentCommandName::execute_recipes;
+            }
+            break;
+          case -804429082:
+            if (name == "configure")
+            {
+              return DeploymentCommandName::configure;
+            }
+            break;
+          case 109329021:
+            if (name == "setup")
+            {
+              return DeploymentCommandName::setup;
+            }
+            break;
+          case -1335332633:
+            if (name == "deploy")
+            {
+              return DeploymentCommandName::deploy;
+            }
+            break;
+          case -259719452:
+            if (name == "rollback")
+            {
+              return DeploymentCommandName::rollback;
+            }
+            break;
+          case 109757538:
+            if (name == "start")
+            {
+              return DeploymentCommandName::start;
+            }
+            break;
+          case 3540994:
+            if (name == "stop")
+            {
+              return DeploymentCommandName::stop;
+            }
+            break;
+          case 1097506319:
+            if (name == "restart")
+            {
+              return DeploymentCommandName::restart;
+            }
+            break;
+          case -448829248:
+            if (name == "undeploy")
+            {
+              return DeploymentCommandName::undeploy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return DeploymentCommandName::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentCommandName(DeploymentCommandName enumValue)
+        const char* GetNameForDeploymentCommandNameCStr(DeploymentCommandName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentCommandName::install_dependencies:
-            return "install_dependencies";
-          case DeploymentCommandName::update_dependencies:
-            return "update_dependencies";
-          case DeploymentCommandName::update_custom_cookbooks:
-            return "update_custom_cookbooks";
-          case DeploymentCommandName::execute_recipes:
-            return "execute_recipes";
-          case DeploymentCommandName::configure:
-            return "configure";
-          case DeploymentCommandName::setup:
-            return "setup";
-          case DeploymentCommandName::deploy:
-            return "deploy";
-          case DeploymentCommandName::rollback:
-            return "rollback";
-          case DeploymentCommandName::start:
-            return "start";
-          case DeploymentCommandName::stop:
-            return "stop";
-          case DeploymentCommandName::restart:
-            return "restart";
-          case DeploymentCommandName::undeploy:
-            return "undeploy";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentCommandName(DeploymentCommandName enumValue)
+        {
+          return GetNameForDeploymentCommandNameCStr(enumValue);
         }
 
       } // namespace DeploymentCommandNameMapper
@@ -30,135 +30,198 @@ namespace Aws
       namespace LayerAttributesKeysMapper
       {
 
-        static const int EcsClusterArn_HASH = HashingUtils::HashString("EcsClusterArn");
-        static const int EnableHaproxyStats_HASH = HashingUtils::HashString("EnableHaproxyStats");
-        static const int HaproxyStatsUrl_HASH = HashingUtils::HashString("HaproxyStatsUrl");
-        static const int HaproxyStatsUser_HASH = HashingUtils::HashString("HaproxyStatsUser");
-        static const int HaproxyStatsPassword_HASH = HashingUtils::HashString("HaproxyStatsPassword");
-        static const int HaproxyHealthCheckUrl_HASH = HashingUtils::HashString("HaproxyHealthCheckUrl");
-        static const int HaproxyHealthCheckMethod_HASH = HashingUtils::HashString("HaproxyHealthCheckMethod");
-        static const int MysqlRootPassword_HASH = HashingUtils::HashString("MysqlRootPassword");
-        static const int MysqlRootPasswordUbiquitous_HASH = HashingUtils::HashString("MysqlRootPasswordUbiquitous");
-        static const int GangliaUrl_HASH = HashingUtils::HashString("GangliaUrl");
-        static const int GangliaUser_HASH = HashingUtils::HashString("GangliaUser");
-        static const int GangliaPassword_HASH = HashingUtils::HashString("GangliaPassword");
-        static const int MemcachedMemory_HASH = HashingUtils::HashString("MemcachedMemory");
-        static const int NodejsVersion_HASH = HashingUtils::HashString("NodejsVersion");
-        static const int RubyVersion_HASH = HashingUtils::HashString("RubyVersion");
-        static const int RubygemsVersion_HASH = HashingUtils::HashString("RubygemsVersion");
-        static const int ManageBundler_HASH = HashingUtils::HashString("ManageBundler");
-        static const int BundlerVersion_HASH = HashingUtils::HashString("BundlerVersion");
-        static const int RailsStack_HASH = HashingUtils::HashString("RailsStack");
-        static const int PassengerVersion_HASH = HashingUtils::HashString("PassengerVersion");
-        static const int Jvm_HASH = HashingUtils::HashString("Jvm");
-        static const int JvmVersion_HASH = HashingUtils::HashString("JvmVersion");
-        static const int JvmOptions_HASH = HashingUtils::HashString("JvmOptions");
-        static const int JavaAppServer_HASH = HashingUtils::HashString("JavaAppServer");
-        static const int JavaAppServerVersion_HASH = HashingUtils::HashString("JavaAppServerVersion");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EcsClusterArn",
+          "EnableHaproxyStats",
+          "HaproxyStatsUrl",
+          "HaproxyStatsUser",
+          "HaproxyStatsPassword",
+          "HaproxyHealthCheckUrl",
+          "HaproxyHealthCheckMethod",
+          "MysqlRootPassword",
+          "MysqlRootPasswordUbiquitous",
+          "GangliaUrl",
+          "GangliaUser",
+          "GangliaPassword",
+          "MemcachedMemory",
+          "NodejsVersion",
+          "RubyVersion",
+          "RubygemsVersion",
+          "ManageBundler",
+          "BundlerVersion",
+          "RailsStack",
+          "PassengerVersion",
+          "Jvm",
+          "JvmVersion",
+          "JvmOptions",
+          "JavaAppServer",
+          "JavaAppServerVersion",
+        };
 
         LayerAttributesKeys GetLayerAttributesKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EcsClusterArn_HASH)
-          {
-            return LayerAttributesKeys::EcsClusterArn;
-          }
-          else if (hashCode == EnableHaproxyStats_HASH)
-          {
-            return LayerAttributesKeys::EnableHaproxyStats;
-          }
-          else if (hashCode == HaproxyStatsUrl_HASH)
-          {
-            return LayerAttributesKeys::HaproxyStatsUrl;
-          }
-          else if (hashCode == HaproxyStatsUser_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LayerAttributesKeys::HaproxyStatsUser;
-          }
-          else if (hashCode == HaproxyStatsPassword_HASH)
-          {
-            return LayerAttributesKeys::HaproxyStatsPassword;
-          }
-          else if (hashCode == HaproxyHealthCheckUrl_HASH)
-          {
-            return LayerAttributesKeys::HaproxyHealthCheckUrl;
-          }
-          else if (hashCode == HaproxyHealthCheckMethod_HASH)
-          {
-            return LayerAttributesKeys::HaproxyHealthCheckMethod;
-          }
-          else if (hashCode == MysqlRootPassword_HASH)
-          {
-            return LayerAttributesKeys::MysqlRootPassword;
-          }
-          else if (hashCode == MysqlRootPasswordUbiquitous_HASH)
-          {
-            return LayerAttributesKeys::MysqlRootPasswordUbiquitous;
-          }
-          else if (hashCode == GangliaUrl_HASH)
-          {
-            return LayerAttributesKeys::GangliaUrl;
-          }
-          else if (hashCode == GangliaUser_HASH)
-          {
-            return LayerAttributesKeys::GangliaUser;
-          }
-          else if (hashCode == GangliaPassword_HASH)
-          {
-            return LayerAttributesKeys::GangliaPassword;
-          }
-          else if (hashCode == MemcachedMemory_HASH)
-          {
-            return LayerAttributesKeys::MemcachedMemory;
-          }
-          else if (hashCode == NodejsVersion_HASH)
-          {
-            return LayerAttributesKeys::NodejsVersion;
-          }
-          else if (hashCode == RubyVersion_HASH)
-          {
-            return LayerAttributesKeys::RubyVersion;
-          }
-          else if (hashCode == RubygemsVersion_HASH)
-          {
-            return LayerAttributesKeys::RubygemsVersion;
-          }
-          else if (hashCode == ManageBundler_HASH)
-          {
-            return LayerAttributesKeys::ManageBundler;
-          }
-          else if (hashCode == BundlerVersion_HASH)
-          {
-            return LayerAttributesKeys::BundlerVersion;
-          }
-          else if (hashCode == RailsStack_HASH)
-          {
-            return LayerAttributesKeys::RailsStack;
-          }
-          else if (hashCode == PassengerVersion_HASH)
-          {
-            return LayerAttributesKeys::PassengerVersion;
-          }
-          else if (hashCode == Jvm_HASH)
-          {
-            return LayerAttributesKeys::Jvm;
-          }
-          else if (hashCode == JvmVersion_HASH)
-          {
-            return LayerAttributesKeys::JvmVersion;
-          }
-          else if (hashCode == JvmOptions_HASH)
-          {
-            return LayerAttributesKeys::JvmOptions;
-          }
-          else if (hashCode == JavaAppServer_HASH)
-          {
-            return LayerAttributesKeys::JavaAppServer;
-          }
-          else if (hashCode == JavaAppServerVersion_HASH)
-          {
-            return LayerAttributesKeys::JavaAppServerVersion;
+          case -1427909800:
+            if (name == "EcsClusterArn")
+            {
+              return LayerAttributesKeys::EcsClusterArn;
+            }
+            break;
+          case 182407629:
+            if (name == "EnableHaproxyStats")
+            {
+              return LayerAttributesKeys::EnableHaproxyStats;
+            }
+            break;
+          case 428832869:
+            if (name == "HaproxyStatsUrl")
+            {
+              return LayerAttributesKeys::HaproxyStatsUrl;
+            }
+            break;
+          case 408917909:
+            if (name == "HaproxyStatsUser")
+            {
+              return LayerAttributesKeys::HaproxyStatsUser;
+            }
+            break;
+          case -2122092187:
+            if (name == "HaproxyStatsPassword")
+            {
+              return LayerAttributesKeys::HaproxyStatsPassword;
+            }
+            break;
+          case -1459865064:
+            if (name == "HaproxyHealthCheckUrl")
+            {
+              return LayerAttributesKeys::HaproxyHealthCheckUrl;
+            }
+            break;
+          case -241979496:
+            if (name == "HaproxyHealthCheckMethod")
+            {
+              return LayerAttributesKeys::HaproxyHealthCheckMethod;
+            }
+            break;
+          case -32108737:
+            if (name == "MysqlRootPassword")
+            {
+              return LayerAttributesKeys::MysqlRootPassword;
+            }
+            break;
+          case -2037581759:
+            if (name == "MysqlRootPasswordUbiquitous")
+            {
+              return LayerAttributesKeys::MysqlRootPasswordUbiquitous;
+            }
+            break;
+          case -1745880514:
+            if (name == "GangliaUrl")
+            {
+              return LayerAttributesKeys::GangliaUrl;
+            }
+            break;
+          case 1712279772:
+            if (name == "GangliaUser")
+            {
+              return LayerAttributesKeys::GangliaUser;
+            }
+            break;
+          case -1835585748:
+            if (name == "GangliaPassword")
+            {
+              return LayerAttributesKeys::GangliaPassword;
+            }
+            break;
+          case -121286920:
+            if (name == "MemcachedMemory")
+            {
+              return LayerAttributesKeys::MemcachedMemory;
+            }
+            break;
+          case 317519725:
+            if (name == "NodejsVersion")
+            {
+              return LayerAttributesKeys::NodejsVersion;
+            }
+            break;
+          case -1432330882:
+            if (name == "RubyVersion")
+            {
+              return LayerAttributesKeys::RubyVersion;
+            }
+            break;
+          case -2143649030:
+            if (name == "RubygemsVersion")
+            {
+              return LayerAttributesKeys::RubygemsVersion;
+            }
+            break;
+          case 1181753067:
+            if (name == "ManageBundler")
+            {
+              return LayerAttributesKeys::ManageBundler;
+            }
+            break;
+          case -47576408:
+            if (name == "BundlerVersion")
+            {
+              return LayerAttributesKeys::BundlerVersion;
+            }
+            break;
+          case 586535943:
+            if (name == "RailsStack")
+            {
+              return LayerAttributesKeys::RailsStack;
+            }
+            break;
+          case -1416551682:
+            if (name == "PassengerVersion")
+            {
+              return LayerAttributesKeys::PassengerVersion;
+            }
+            break;
+          case 74881:
+            if (name == "Jvm")
+            {
+              return LayerAttributesKeys::Jvm;
+            }
+            break;
+          case -1479299817:
+            if (name == "JvmVersion")
+            {
+              return LayerAttributesKeys::JvmVersion;
+            }
+            break;
+          case 1214584541:
+            if (name == "JvmOptions")
+            {
+              return LayerAttributesKeys::JvmOptions;
+            }
+            break;
+          case -579689310:
+            if (name == "JavaAppServer")
+            {
+              return LayerAttributesKeys::JavaAppServer;
+            }
+            break;
+          case -205982250:
+            if (name == "JavaAppServerVersion")
+            {
+              return LayerAttributesKeys::JavaAppServerVersion;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -170,69 +233,26 @@ namespace Aws
           return LayerAttributesKeys::NOT_SET;
         }
 
-        Aws::String GetNameForLayerAttributesKeys(LayerAttributesKeys enumValue)
+        const char* GetNameForLayerAttributesKeysCStr(LayerAttributesKeys enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LayerAttributesKeys::EcsClusterArn:
-            return "EcsClusterArn";
-          case LayerAttributesKeys::EnableHaproxyStats:
-            return "EnableHaproxyStats";
-          case LayerAttributesKeys::HaproxyStatsUrl:
-            return "HaproxyStatsUrl";
-          case LayerAttributesKeys::HaproxyStatsUser:
-            return "HaproxyStatsUser";
-          case LayerAttributesKeys::HaproxyStatsPassword:
-            return "HaproxyStatsPassword";
-          case LayerAttributesKeys::HaproxyHealthCheckUrl:
-            return "HaproxyHealthCheckUrl";
-          case LayerAttributesKeys::HaproxyHealthCheckMethod:
-            return "HaproxyHealthCheckMethod";
-          case LayerAttributesKeys::MysqlRootPassword:
-            return "MysqlRootPassword";
-          case LayerAttributesKeys::MysqlRootPasswordUbiquitous:
-            return "MysqlRootPasswordUbiquitous";
-          case LayerAttributesKeys::GangliaUrl:
-            return "GangliaUrl";
-          case LayerAttributesKeys::GangliaUser:
-            return "GangliaUser";
-          case LayerAttributesKeys::GangliaPassword:
-            return "GangliaPassword";
-          case LayerAttributesKeys::MemcachedMemory:
-            return "MemcachedMemory";
-          case LayerAttributesKeys::NodejsVersion:
-            return "NodejsVersion";
-          case LayerAttributesKeys::RubyVersion:
-            return "RubyVersion";
-          case LayerAttributesKeys::RubygemsVersion:
-            return "RubygemsVersion";
-          case LayerAttributesKeys::ManageBundler:
-            return "ManageBundler";
-          case LayerAttributesKeys::BundlerVersion:
-            return "BundlerVersion";
-          case LayerAttributesKeys::RailsStack:
-            return "RailsStack";
-          case LayerAttributesKeys::PassengerVersion:
-            return "PassengerVersion";
-          case LayerAttributesKeys::Jvm:
-            return "Jvm";
-          case LayerAttributesKeys::JvmVersion:
-            return "JvmVersion";
-          case LayerAttributesKeys::JvmOptions:
-            return "JvmOptions";
-          case LayerAttributesKeys::JavaAppServer:
-            return "JavaAppServer";
-          case LayerAttributesKeys::JavaAppServerVersion:
-            return "JavaAppServerVersion";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLayerAttributesKeys(LayerAttributesKeys enumValue)
+        {
+          return GetNameForLayerAttributesKeysCStr(enumValue);
         }
 
       } // namespace LayerAttributesKeysMapper
@@ -30,70 +30,107 @@ namespace Aws
       namespace LayerTypeMapper
       {
 
-        static const int aws_flow_ruby_HASH = HashingUtils::HashString("aws-flow-ruby");
-        static const int ecs_cluster_HASH = HashingUtils::HashString("ecs-cluster");
-        static const int java_app_HASH = HashingUtils::HashString("java-app");
-        static const int lb_HASH = HashingUtils::HashString("lb");
-        static const int web_HASH = HashingUtils::HashString("web");
-        static const int php_app_HASH = HashingUtils::HashString("php-app");
-        static const int rails_app_HASH = HashingUtils::HashString("rails-app");
-        static const int nodejs_app_HASH = HashingUtils::HashString("nodejs-app");
-        static const int memcached_HASH = HashingUtils::HashString("memcached");
-        static const int db_master_HASH = HashingUtils::HashString("db-master");
-        static const int monitoring_master_HASH = HashingUtils::HashString("monitoring-master");
-        static const int custom_HASH = HashingUtils::HashString("custom");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "aws-flow-ruby",
+          "ecs-cluster",
+          "java-app",
+          "lb",
+          "web",
+          "php-app",
+          "rails-app",
+          "nodejs-app",
+          "memcached",
+          "db-master",
+          "monitoring-master",
+          "custom",
+        };
 
         LayerType GetLayerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_flow_ruby_HASH)
-          {
-            return LayerType::aws_flow_ruby;
-          }
-          else if (hashCode == ecs_cluster_HASH)
-          {
-            return LayerType::ecs_cluster;
-          }
-          else if (hashCode == java_app_HASH)
-          {
-            return LayerType::java_app;
-          }
-          else if (hashCode == lb_HASH)
-          {
-            return LayerType::lb;
-          }
-          else if (hashCode == web_HASH)
-          {
-            return LayerType::web;
-          }
-          else if (hashCode == php_app_HASH)
-          {
-            return LayerType::php_app;
-          }
-          else if (hashCode == rails_app_HASH)
-          {
-            return LayerType::rails_app;
-          }
-          else if (hashCode == nodejs_app_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LayerType::nodejs_app;
-          }
-          else if (hashCode == memcached_HASH)
-          {
-            return LayerType::memcached;
-          }
-          else if (hashCode == db_master_HASH)
-          {
-            return LayerType::db_master;
-          }
-          else if (hashCode == monitoring_master_HASH)
-          {
-            return LayerType::monitoring_master;
-          }
-          else if (hashCode == custom_HASH)
-          {
-            return LayerType::custom;
+          case 1790298185:
+            if (name == "aws-flow-ruby")
+            {
+              return LayerType::aws_flow_ruby;
+            }
+            break;
+          case 1206851522:
+            if (name == "ecs-cluster")
+            {
+              return LayerType::ecs_cluster;
+            }
+            break;
+          case -582895626:
+            if (name == "java-app")
+            {
+              return LayerType::java_app;
+            }
+            break;
+          case 3446:
+            if (name == "lb")
+            {
+              return LayerType::lb;
+            }
+            break;
+          case 117588:
+            if (name == "web")
+            {
+              return LayerType::web;
+            }
+            break;
+          case -596499380:
+            if (name == "php-app")
+            {
+              return LayerType::php_app;
+            }
+            break;
+          case -739271307:
+            if (name == "rails-app")
+            {
+              return LayerType::rails_app;
+            }
+            break;
+          case 1867633695:
+            if (name == "nodejs-app")
+            {
+              return LayerType::nodejs_app;
+            }
+            break;
+          case 1366717239:
+            if (name == "memcached")
+            {
+              return LayerType::memcached;
+            }
+            break;
+          case -1158406511:
+            if (name == "db-master")
+            {
+              return LayerType::db_master;
+            }
+            break;
+          case -583725177:
+            if (name == "monitoring-master")
+            {
+              return LayerType::monitoring_master;
+            }
+            break;
+          case -1349088399:
+            if (name == "custom")
+            {
+              return LayerType::custom;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return LayerType::NOT_SET;
         }
 
-        Aws::String GetNameForLayerType(LayerType enumValue)
+        const char* GetNameForLayerTypeCStr(LayerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LayerType::aws_flow_ruby:
-            return "aws-flow-ruby";
-          case LayerType::ecs_cluster:
-            return "ecs-cluster";
-          case LayerType::java_app:
-            return "java-app";
-          case LayerType::lb:
-            return "lb";
-          case LayerType::web:
-            return "web";
-          case LayerType::php_app:
-            return "php-app";
-          case LayerType::rails_app:
-            return "rails-app";
-          case LayerType::nodejs_app:
-            return "nodejs-app";
-          case LayerType::memcached:
-            return "memcached";
-          case LayerType::db_master:
-            return "db-master";
-          case LayerType::monitoring_master:
-            return "monitoring-master";
-          case LayerType::custom:
-            return "custom";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLayerType(LayerType enumValue)
+        {
+          return GetNameForLayerTypeCStr(enumValue);
         }
 
       } // namespace LayerTypeMapper
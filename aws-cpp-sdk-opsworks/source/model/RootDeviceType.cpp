@@ -30,20 +30,37 @@ namespace Aws
       namespace RootDeviceTypeMapper
       {
 
-        static const int ebs_HASH = HashingUtils::HashString("ebs");
-        static const int instance_store_HASH = HashingUtils::HashString("instance-store");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ebs",
+          "instance-store",
+        };
 
         RootDeviceType GetRootDeviceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ebs_HASH)
-          {
-            return RootDeviceType::ebs;
-          }
-          else if (hashCode == instance_store_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RootDeviceType::instance_store;
+          case 100214:
+            if (name == "ebs")
+            {
+              return RootDeviceType::ebs;
+            }
+            break;
+          case -1339220567:
+            if (name == "instance-store")
+            {
+              return RootDeviceType::instance_store;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RootDeviceType::NOT_SET;
         }
 
-        Aws::String GetNameForRootDeviceType(RootDeviceType enumValue)
+        const char* GetNameForRootDeviceTypeCStr(RootDeviceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RootDeviceType::ebs:
-            return "ebs";
-          case RootDeviceType::instance_store:
-            return "instance-store";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRootDeviceType(RootDeviceType enumValue)
+        {
+          return GetNameForRootDeviceTypeCStr(enumValue);
         }
 
       } // namespace RootDeviceTypeMapper
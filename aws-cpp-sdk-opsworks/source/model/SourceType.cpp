@@ -30,30 +30,51 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int git_HASH = HashingUtils::HashString("git");
-        static const int svn_HASH = HashingUtils::HashString("svn");
-        static const int archive_HASH = HashingUtils::HashString("archive");
-        static const int s3_HASH = HashingUtils::HashString("s3");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "git",
+          "svn",
+          "archive",
+          "s3",
+        };
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == git_HASH)
-          {
-            return SourceType::git;
-          }
-          else if (hashCode == svn_HASH)
-          {
-            return SourceType::svn;
-          }
-          else if (hashCode == archive_HASH)
-          {
-            return SourceType::archive;
-          }
-          else if (hashCode == s3_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SourceType::s3;
+          case 102354:
+            if (name == "git")
+            {
+              return SourceType::git;
+            }
+            break;
+          case 114283:
+            if (name == "svn")
+            {
+              return SourceType::svn;
+            }
+            break;
+          case -748101438:
+            if (name == "archive")
+            {
+              return SourceType::archive;
+            }
+            break;
+          case 3616:
+            if (name == "s3")
+            {
+              return SourceType::s3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceTypeCStr(SourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SourceType::git:
-            return "git";
-          case SourceType::svn:
-            return "svn";
-          case SourceType::archive:
-            return "archive";
-          case SourceType::s3:
-            return "s3";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSourceType(SourceType enumValue)
+        {
+          return GetNameForSourceTypeCStr(enumValue);
         }
 
       } // namespace SourceTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace StackAttributesKeysMapper
       {
 
-        static const int Color_HASH = HashingUtils::HashString("Color");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Color",
+        };
 
         StackAttributesKeys GetStackAttributesKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Color_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StackAttributesKeys::Color;
+          case 65290051:
+            if (name == "Color")
+            {
+              return StackAttributesKeys::Color;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return StackAttributesKeys::NOT_SET;
         }
 
-        Aws::String GetNameForStackAttributesKeys(StackAttributesKeys enumValue)
+        const char* GetNameForStackAttributesKeysCStr(StackAttributesKeys enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StackAttributesKeys::Color:
-            return "Color";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStackAttributesKeys(StackAttributesKeys enumValue)
+        {
+          return GetNameForStackAttributesKeysCStr(enumValue);
         }
 
       } // namespace StackAttributesKeysMapper
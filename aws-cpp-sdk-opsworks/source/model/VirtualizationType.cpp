@@ -30,20 +30,37 @@ namespace Aws
       namespace VirtualizationTypeMapper
       {
 
-        static const int paravirtual_HASH = HashingUtils::HashString("paravirtual");
-        static const int hvm_HASH = HashingUtils::HashString("hvm");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "paravirtual",
+          "hvm",
+        };
 
         VirtualizationType GetVirtualizationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == paravirtual_HASH)
-          {
-            return VirtualizationType::paravirtual;
-          }
-          else if (hashCode == hvm_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VirtualizationType::hvm;
+          case 846634795:
+            if (name == "paravirtual")
+            {
+              return VirtualizationType::paravirtual;
+            }
+            break;
+          case 103711:
+            if (name == "hvm")
+            {
+              return VirtualizationType::hvm;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return VirtualizationType::NOT_SET;
         }
 
-        Aws::String GetNameForVirtualizationType(VirtualizationType enumValue)
+        const char* GetNameForVirtualizationTypeCStr(VirtualizationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VirtualizationType::paravirtual:
-            return "paravirtual";
-          case VirtualizationType::hvm:
-            return "hvm";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVirtualizationType(VirtualizationType enumValue)
+        {
+          return GetNameForVirtualizationTypeCStr(enumValue);
         }
 
       } // namespace VirtualizationTypeMapper
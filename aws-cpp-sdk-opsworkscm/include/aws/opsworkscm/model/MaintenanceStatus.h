@@ -35,6 +35,11 @@ namespace MaintenanceStatusMapper
 AWS_OPSWORKSCM_API MaintenanceStatus GetMaintenanceStatusForName(const Aws::String& name);
 
 AWS_OPSWORKSCM_API Aws::String GetNameForMaintenanceStatus(MaintenanceStatus value);
+
+/**
+ * Same as GetNameForMaintenanceStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKSCM_API const char* GetNameForMaintenanceStatusCStr(MaintenanceStatus value);
 } // namespace MaintenanceStatusMapper
 } // namespace Model
 } // namespace OpsWorksCM
@@ -36,6 +36,11 @@ namespace NodeAssociationStatusMapper
 AWS_OPSWORKSCM_API NodeAssociationStatus GetNodeAssociationStatusForName(const Aws::String& name);
 
 AWS_OPSWORKSCM_API Aws::String GetNameForNodeAssociationStatus(NodeAssociationStatus value);
+
+/**
+ * Same as GetNameForNodeAssociationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKSCM_API const char* GetNameForNodeAssociationStatusCStr(NodeAssociationStatus value);
 } // namespace NodeAssociationStatusMapper
 } // namespace Model
 } // namespace OpsWorksCM
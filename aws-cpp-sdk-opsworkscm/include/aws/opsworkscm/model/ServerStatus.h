@@ -46,6 +46,11 @@ namespace ServerStatusMapper
 AWS_OPSWORKSCM_API ServerStatus GetServerStatusForName(const Aws::String& name);
 
 AWS_OPSWORKSCM_API Aws::String GetNameForServerStatus(ServerStatus value);
+
+/**
+ * Same as GetNameForServerStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_OPSWORKSCM_API const char* GetNameForServerStatusCStr(ServerStatus value);
 } // namespace ServerStatusMapper
 } // namespace Model
 } // namespace OpsWorksCM
@@ -30,30 +30,51 @@ namespace Aws
       namespace BackupStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int OK_HASH = HashingUtils::HashString("OK");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "OK",
+          "FAILED",
+          "DELETING",
+        };
 
         BackupStatus GetBackupStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return BackupStatus::IN_PROGRESS;
-          }
-          else if (hashCode == OK_HASH)
-          {
-            return BackupStatus::OK;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return BackupStatus::FAILED;
-          }
-          else if (hashCode == DELETING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BackupStatus::DELETING;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return BackupStatus::IN_PROGRESS;
+            }
+            break;
+          case 2524:
+            if (name == "OK")
+            {
+              return BackupStatus::OK;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return BackupStatus::FAILED;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return BackupStatus::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return BackupStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBackupStatus(BackupStatus enumValue)
+        const char* GetNameForBackupStatusCStr(BackupStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BackupStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case BackupStatus::OK:
-            return "OK";
-          case BackupStatus::FAILED:
-            return "FAILED";
-          case BackupStatus::DELETING:
-            return "DELETING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBackupStatus(BackupStatus enumValue)
+        {
+          return GetNameForBackupStatusCStr(enumValue);
         }
 
       } // namespace BackupStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace BackupTypeMapper
       {
 
-        static const int AUTOMATED_HASH = HashingUtils::HashString("AUTOMATED");
-        static const int MANUAL_HASH = HashingUtils::HashString("MANUAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTOMATED",
+          "MANUAL",
+        };
 
         BackupType GetBackupTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTOMATED_HASH)
-          {
-            return BackupType::AUTOMATED;
-          }
-          else if (hashCode == MANUAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BackupType::MANUAL;
+          case 165298576:
+            if (name == "AUTOMATED")
+            {
+              return BackupType::AUTOMATED;
+            }
+            break;
+          case -2028086330:
+            if (name == "MANUAL")
+            {
+              return BackupType::MANUAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BackupType::NOT_SET;
         }
 
-        Aws::String GetNameForBackupType(BackupType enumValue)
+        const char* GetNameForBackupTypeCStr(BackupType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BackupType::AUTOMATED:
-            return "AUTOMATED";
-          case BackupType::MANUAL:
-            return "MANUAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBackupType(BackupType enumValue)
+        {
+          return GetNameForBackupTypeCStr(enumValue);
         }
 
       } // namespace BackupTypeMapper
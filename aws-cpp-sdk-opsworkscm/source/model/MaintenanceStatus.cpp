@@ -30,20 +30,37 @@ namespace Aws
       namespace MaintenanceStatusMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCESS",
+          "FAILED",
+        };
 
         MaintenanceStatus GetMaintenanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
-          {
-            return MaintenanceStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MaintenanceStatus::FAILED;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return MaintenanceStatus::SUCCESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return MaintenanceStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MaintenanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForMaintenanceStatus(MaintenanceStatus enumValue)
+        const char* GetNameForMaintenanceStatusCStr(MaintenanceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MaintenanceStatus::SUCCESS:
-            return "SUCCESS";
-          case MaintenanceStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMaintenanceStatus(MaintenanceStatus enumValue)
+        {
+          return GetNameForMaintenanceStatusCStr(enumValue);
         }
 
       } // namespace MaintenanceStatusMapper
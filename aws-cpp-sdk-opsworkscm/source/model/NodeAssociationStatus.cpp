@@ -30,25 +30,44 @@ namespace Aws
       namespace NodeAssociationStatusMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCESS",
+          "FAILED",
+          "IN_PROGRESS",
+        };
 
         NodeAssociationStatus GetNodeAssociationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
-          {
-            return NodeAssociationStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NodeAssociationStatus::FAILED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return NodeAssociationStatus::IN_PROGRESS;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return NodeAssociationStatus::SUCCESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return NodeAssociationStatus::FAILED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return NodeAssociationStatus::IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return NodeAssociationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForNodeAssociationStatus(NodeAssociationStatus enumValue)
+        const char* GetNameForNodeAssociationStatusCStr(NodeAssociationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NodeAssociationStatus::SUCCESS:
-            return "SUCCESS";
-          case NodeAssociationStatus::FAILED:
-            return "FAILED";
-          case NodeAssociationStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNodeAssociationStatus(NodeAssociationStatus enumValue)
+        {
+          return GetNameForNodeAssociationStatusCStr(enumValue);
         }
 
       } // namespace NodeAssociationStatusMapper
@@ -30,75 +30,114 @@ namespace Aws
       namespace ServerStatusMapper
       {
 
-        static const int BACKING_UP_HASH = HashingUtils::HashString("BACKING_UP");
-        static const int CONNECTION_LOST_HASH = HashingUtils::HashString("CONNECTION_LOST");
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int MODIFYING_HASH = HashingUtils::HashString("MODIFYING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int HEALTHY_HASH = HashingUtils::HashString("HEALTHY");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int RESTORING_HASH = HashingUtils::HashString("RESTORING");
-        static const int SETUP_HASH = HashingUtils::HashString("SETUP");
-        static const int UNDER_MAINTENANCE_HASH = HashingUtils::HashString("UNDER_MAINTENANCE");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BACKING_UP",
+          "CONNECTION_LOST",
+          "CREATING",
+          "DELETING",
+          "MODIFYING",
+          "FAILED",
+          "HEALTHY",
+          "RUNNING",
+          "RESTORING",
+          "SETUP",
+          "UNDER_MAINTENANCE",
+          "UNHEALTHY",
+          "TERMINATED",
+        };
 
         ServerStatus GetServerStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BACKING_UP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServerStatus::BACKING_UP;
-          }
-          else if (hashCode == CONNECTION_LOST_HASH)
-          {
-            return ServerStatus::CONNECTION_LOST;
-          }
-          else if (hashCode == CREATING_HASH)
-          {
-            return ServerStatus::CREATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ServerStatus::DELETING;
-          }
-          else if (hashCode == MODIFYING_HASH)
-          {
-            return ServerStatus::MODIFYING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ServerStatus::FAILED;
-          }
-          else if (hashCode == HEALTHY_HASH)
-          {
-            return ServerStatus::HEALTHY;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ServerStatus::RUNNING;
-          }
-          else if (hashCode == RESTORING_HASH)
-          {
-            return ServerStatus::RESTORING;
-          }
-          else if (hashCode == SETUP_HASH)
-          {
-            return ServerStatus::SETUP;
-          }
-          else if (hashCode == UNDER_MAINTENANCE_HASH)
-          {
-            return ServerStatus::UNDER_MAINTENANCE;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
-            return ServerStatus::UNHEALTHY;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return ServerStatus::TERMINATED;
+          case -793765921:
+            if (name == "BACKING_UP")
+            {
+              return ServerStatus::BACKING_UP;
+            }
+            break;
+          case 1878403045:
+            if (name == "CONNECTION_LOST")
+            {
+              return ServerStatus::CONNECTION_LOST;
+            }
+            break;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return ServerStatus::CREATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ServerStatus::DELETING;
+            }
+            break;
+          case 886029512:
+            if (name == "MODIFYING")
+            {
+              return ServerStatus::MODIFYING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ServerStatus::FAILED;
+            }
+            break;
+          case 1513543037:
+            if (name == "HEALTHY")
+            {
+              return ServerStatus::HEALTHY;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return ServerStatus::RUNNING;
+            }
+            break;
+          case 941134763:
+            if (name == "RESTORING")
+            {
+              return ServerStatus::RESTORING;
+            }
+            break;
+          case 78791261:
+            if (name == "SETUP")
+            {
+              return ServerStatus::SETUP;
+            }
+            break;
+          case 370072556:
+            if (name == "UNDER_MAINTENANCE")
+            {
+              return ServerStatus::UNDER_MAINTENANCE;
+            }
+            break;
+          case 998988996:
+            if (name == "UNHEALTHY")
+            {
+              return ServerStatus::UNHEALTHY;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return ServerStatus::TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,45 +149,26 @@ namespace Aws
           return ServerStatus::NOT_SET;
         }
 
-        Aws::String GetNameForServerStatus(ServerStatus enumValue)
+        const char* GetNameForServerStatusCStr(ServerStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServerStatus::BACKING_UP:
-            return "BACKING_UP";
-          case ServerStatus::CONNECTION_LOST:
-            return "CONNECTION_LOST";
-          case ServerStatus::CREATING:
-            return "CREATING";
-          case ServerStatus::DELETING:
-            return "DELETING";
-          case ServerStatus::MODIFYING:
-            return "MODIFYING";
-          case ServerStatus::FAILED:
-            return "FAILED";
-          case ServerStatus::HEALTHY:
-            return "HEALTHY";
-          case ServerStatus::RUNNING:
-            return "RUNNING";
-          case ServerStatus::RESTORING:
-            return "RESTORING";
-          case ServerStatus::SETUP:
-            return "SETUP";
-          case ServerStatus::UNDER_MAINTENANCE:
-            return "UNDER_MAINTENANCE";
-          case ServerStatus::UNHEALTHY:
-            return "UNHEALTHY";
-          case ServerStatus::TERMINATED:
-            return "TERMINATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServerStatus(ServerStatus enumValue)
+        {
+          return GetNameForServerStatusCStr(enumValue);
         }
 
       } // namespace ServerStatusMapper
@@ -34,6 +34,11 @@ namespace AccessDeniedForDependencyExceptionReasonMapper
 AWS_ORGANIZATIONS_API AccessDeniedForDependencyExceptionReason GetAccessDeniedForDependencyExceptionReasonForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForAccessDeniedForDependencyExceptionReason(AccessDeniedForDependencyExceptionReason value);
+
+/**
+ * Same as GetNameForAccessDeniedForDependencyExceptionReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForAccessDeniedForDependencyExceptionReasonCStr(AccessDeniedForDependencyExceptionReason value);
 } // namespace AccessDeniedForDependencyExceptionReasonMapper
 } // namespace Model
 } // namespace Organizations
@@ -35,6 +35,11 @@ namespace AccountJoinedMethodMapper
 AWS_ORGANIZATIONS_API AccountJoinedMethod GetAccountJoinedMethodForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForAccountJoinedMethod(AccountJoinedMethod value);
+
+/**
+ * Same as GetNameForAccountJoinedMethod(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForAccountJoinedMethodCStr(AccountJoinedMethod value);
 } // namespace AccountJoinedMethodMapper
 } // namespace Model
 } // namespace Organizations
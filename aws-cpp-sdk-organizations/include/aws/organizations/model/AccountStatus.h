@@ -35,6 +35,11 @@ namespace AccountStatusMapper
 AWS_ORGANIZATIONS_API AccountStatus GetAccountStatusForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForAccountStatus(AccountStatus value);
+
+/**
+ * Same as GetNameForAccountStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForAccountStatusCStr(AccountStatus value);
 } // namespace AccountStatusMapper
 } // namespace Model
 } // namespace Organizations
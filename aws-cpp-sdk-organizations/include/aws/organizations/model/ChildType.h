@@ -35,6 +35,11 @@ namespace ChildTypeMapper
 AWS_ORGANIZATIONS_API ChildType GetChildTypeForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForChildType(ChildType value);
+
+/**
+ * Same as GetNameForChildType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForChildTypeCStr(ChildType value);
 } // namespace ChildTypeMapper
 } // namespace Model
 } // namespace Organizations
@@ -51,6 +51,11 @@ namespace ConstraintViolationExceptionReasonMapper
 AWS_ORGANIZATIONS_API ConstraintViolationExceptionReason GetConstraintViolationExceptionReasonForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForConstraintViolationExceptionReason(ConstraintViolationExceptionReason value);
+
+/**
+ * Same as GetNameForConstraintViolationExceptionReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForConstraintViolationExceptionReasonCStr(ConstraintViolationExceptionReason value);
 } // namespace ConstraintViolationExceptionReasonMapper
 } // namespace Model
 } // namespace Organizations
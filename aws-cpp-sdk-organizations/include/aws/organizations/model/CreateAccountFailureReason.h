@@ -39,6 +39,11 @@ namespace CreateAccountFailureReasonMapper
 AWS_ORGANIZATIONS_API CreateAccountFailureReason GetCreateAccountFailureReasonForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForCreateAccountFailureReason(CreateAccountFailureReason value);
+
+/**
+ * Same as GetNameForCreateAccountFailureReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForCreateAccountFailureReasonCStr(CreateAccountFailureReason value);
 } // namespace CreateAccountFailureReasonMapper
 } // namespace Model
 } // namespace Organizations
@@ -36,6 +36,11 @@ namespace CreateAccountStateMapper
 AWS_ORGANIZATIONS_API CreateAccountState GetCreateAccountStateForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForCreateAccountState(CreateAccountState value);
+
+/**
+ * Same as GetNameForCreateAccountState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForCreateAccountStateCStr(CreateAccountState value);
 } // namespace CreateAccountStateMapper
 } // namespace Model
 } // namespace Organizations
@@ -41,6 +41,11 @@ namespace HandshakeConstraintViolationExceptionReasonMapper
 AWS_ORGANIZATIONS_API HandshakeConstraintViolationExceptionReason GetHandshakeConstraintViolationExceptionReasonForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForHandshakeConstraintViolationExceptionReason(HandshakeConstraintViolationExceptionReason value);
+
+/**
+ * Same as GetNameForHandshakeConstraintViolationExceptionReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForHandshakeConstraintViolationExceptionReasonCStr(HandshakeConstraintViolationExceptionReason value);
 } // namespace HandshakeConstraintViolationExceptionReasonMapper
 } // namespace Model
 } // namespace Organizations
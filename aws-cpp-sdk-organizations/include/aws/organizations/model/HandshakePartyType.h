@@ -36,6 +36,11 @@ namespace HandshakePartyTypeMapper
 AWS_ORGANIZATIONS_API HandshakePartyType GetHandshakePartyTypeForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForHandshakePartyType(HandshakePartyType value);
+
+/**
+ * Same as GetNameForHandshakePartyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForHandshakePartyTypeCStr(HandshakePartyType value);
 } // namespace HandshakePartyTypeMapper
 } // namespace Model
 } // namespace Organizations
@@ -41,6 +41,11 @@ namespace HandshakeResourceTypeMapper
 AWS_ORGANIZATIONS_API HandshakeResourceType GetHandshakeResourceTypeForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForHandshakeResourceType(HandshakeResourceType value);
+
+/**
+ * Same as GetNameForHandshakeResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForHandshakeResourceTypeCStr(HandshakeResourceType value);
 } // namespace HandshakeResourceTypeMapper
 } // namespace Model
 } // namespace Organizations
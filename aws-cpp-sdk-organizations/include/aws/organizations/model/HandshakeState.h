@@ -39,6 +39,11 @@ namespace HandshakeStateMapper
 AWS_ORGANIZATIONS_API HandshakeState GetHandshakeStateForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForHandshakeState(HandshakeState value);
+
+/**
+ * Same as GetNameForHandshakeState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForHandshakeStateCStr(HandshakeState value);
 } // namespace HandshakeStateMapper
 } // namespace Model
 } // namespace Organizations
@@ -35,6 +35,11 @@ namespace IAMUserAccessToBillingMapper
 AWS_ORGANIZATIONS_API IAMUserAccessToBilling GetIAMUserAccessToBillingForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForIAMUserAccessToBilling(IAMUserAccessToBilling value);
+
+/**
+ * Same as GetNameForIAMUserAccessToBilling(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForIAMUserAccessToBillingCStr(IAMUserAccessToBilling value);
 } // namespace IAMUserAccessToBillingMapper
 } // namespace Model
 } // namespace Organizations
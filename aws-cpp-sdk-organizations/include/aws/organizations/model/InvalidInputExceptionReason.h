@@ -52,6 +52,11 @@ namespace InvalidInputExceptionReasonMapper
 AWS_ORGANIZATIONS_API InvalidInputExceptionReason GetInvalidInputExceptionReasonForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForInvalidInputExceptionReason(InvalidInputExceptionReason value);
+
+/**
+ * Same as GetNameForInvalidInputExceptionReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForInvalidInputExceptionReasonCStr(InvalidInputExceptionReason value);
 } // namespace InvalidInputExceptionReasonMapper
 } // namespace Model
 } // namespace Organizations
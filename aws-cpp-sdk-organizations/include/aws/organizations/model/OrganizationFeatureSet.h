@@ -35,6 +35,11 @@ namespace OrganizationFeatureSetMapper
 AWS_ORGANIZATIONS_API OrganizationFeatureSet GetOrganizationFeatureSetForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForOrganizationFeatureSet(OrganizationFeatureSet value);
+
+/**
+ * Same as GetNameForOrganizationFeatureSet(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForOrganizationFeatureSetCStr(OrganizationFeatureSet value);
 } // namespace OrganizationFeatureSetMapper
 } // namespace Model
 } // namespace Organizations
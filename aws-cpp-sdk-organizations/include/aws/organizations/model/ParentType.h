@@ -35,6 +35,11 @@ namespace ParentTypeMapper
 AWS_ORGANIZATIONS_API ParentType GetParentTypeForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForParentType(ParentType value);
+
+/**
+ * Same as GetNameForParentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForParentTypeCStr(ParentType value);
 } // namespace ParentTypeMapper
 } // namespace Model
 } // namespace Organizations
@@ -36,6 +36,11 @@ namespace PolicyTypeStatusMapper
 AWS_ORGANIZATIONS_API PolicyTypeStatus GetPolicyTypeStatusForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForPolicyTypeStatus(PolicyTypeStatus value);
+
+/**
+ * Same as GetNameForPolicyTypeStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForPolicyTypeStatusCStr(PolicyTypeStatus value);
 } // namespace PolicyTypeStatusMapper
 } // namespace Model
 } // namespace Organizations
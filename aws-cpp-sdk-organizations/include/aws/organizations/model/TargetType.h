@@ -36,6 +36,11 @@ namespace TargetTypeMapper
 AWS_ORGANIZATIONS_API TargetType GetTargetTypeForName(const Aws::String& name);
 
 AWS_ORGANIZATIONS_API Aws::String GetNameForTargetType(TargetType value);
+
+/**
+ * Same as GetNameForTargetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ORGANIZATIONS_API const char* GetNameForTargetTypeCStr(TargetType value);
 } // namespace TargetTypeMapper
 } // namespace Model
 } // namespace Organizations
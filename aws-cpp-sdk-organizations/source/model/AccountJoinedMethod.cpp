@@ -30,20 +30,37 @@ namespace Aws
       namespace AccountJoinedMethodMapper
       {
 
-        static const int INVITED_HASH = HashingUtils::HashString("INVITED");
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INVITED",
+          "CREATED",
+        };
 
         AccountJoinedMethod GetAccountJoinedMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVITED_HASH)
-          {
-            return AccountJoinedMethod::INVITED;
-          }
-          else if (hashCode == CREATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccountJoinedMethod::CREATED;
+          case -1616953765:
+            if (name == "INVITED")
+            {
+              return AccountJoinedMethod::INVITED;
+            }
+            break;
+          case 1746537160:
+            if (name == "CREATED")
+            {
+              return AccountJoinedMethod::CREATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AccountJoinedMethod::NOT_SET;
         }
 
-        Aws::String GetNameForAccountJoinedMethod(AccountJoinedMethod enumValue)
+        const char* GetNameForAccountJoinedMethodCStr(AccountJoinedMethod enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccountJoinedMethod::INVITED:
-            return "INVITED";
-          case AccountJoinedMethod::CREATED:
-            return "CREATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccountJoinedMethod(AccountJoinedMethod enumValue)
+        {
+          return GetNameForAccountJoinedMethodCStr(enumValue);
         }
 
       } // namespace AccountJoinedMethodMapper
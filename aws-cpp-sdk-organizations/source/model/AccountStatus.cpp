@@ -30,20 +30,37 @@ namespace Aws
       namespace AccountStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "SUSPENDED",
+        };
 
         AccountStatus GetAccountStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return AccountStatus::ACTIVE;
-          }
-          else if (hashCode == SUSPENDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccountStatus::SUSPENDED;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return AccountStatus::ACTIVE;
+            }
+            break;
+          case 1124965819:
+            if (name == "SUSPENDED")
+            {
+              return AccountStatus::SUSPENDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AccountStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAccountStatus(AccountStatus enumValue)
+        const char* GetNameForAccountStatusCStr(AccountStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccountStatus::ACTIVE:
-            return "ACTIVE";
-          case AccountStatus::SUSPENDED:
-            return "SUSPENDED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccountStatus(AccountStatus enumValue)
+        {
+          return GetNameForAccountStatusCStr(enumValue);
         }
 
       } // namespace AccountStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ActionTypeMapper
       {
 
-        static const int INVITE_HASH = HashingUtils::HashString("INVITE");
-        static const int ENABLE_ALL_FEATURES_HASH = HashingUtils::HashString("ENABLE_ALL_FEATURES");
-        static const int APPROVE_ALL_FEATURES_HASH = HashingUtils::HashString("APPROVE_ALL_FEATURES");
-        static const int ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE_HASH = HashingUtils::HashString("ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INVITE",
+          "ENABLE_ALL_FEATURES",
+          "APPROVE_ALL_FEATURES",
+          "ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE",
+        };
 
         ActionType GetActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVITE_HASH)
-          {
-            return ActionType::INVITE;
-          }
-          else if (hashCode == ENABLE_ALL_FEATURES_HASH)
-          {
-            return ActionType::ENABLE_ALL_FEATURES;
-          }
-          else if (hashCode == APPROVE_ALL_FEATURES_HASH)
-          {
-            return ActionType::APPROVE_ALL_FEATURES;
-          }
-          else if (hashCode == ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActionType::ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE;
+          case -2130369783:
+            if (name == "INVITE")
+            {
+              return ActionType::INVITE;
+            }
+            break;
+          case -684997001:
+            if (name == "ENABLE_ALL_FEATURES")
+            {
+              return ActionType::ENABLE_ALL_FEATURES;
+            }
+            break;
+          case 1492866317:
+            if (name == "APPROVE_ALL_FEATURES")
+            {
+              return ActionType::APPROVE_ALL_FEATURES;
+            }
+            break;
+          case -1312392523:
+            if (name == "ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE")
+            {
+              return ActionType::ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ActionType::NOT_SET;
         }
 
-        Aws::String GetNameForActionType(ActionType enumValue)
+        const char* GetNameForActionTypeCStr(ActionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActionType::INVITE:
-            return "INVITE";
-          case ActionType::ENABLE_ALL_FEATURES:
-            return "ENABLE_ALL_FEATURES";
-          case ActionType::APPROVE_ALL_FEATURES:
-            return "APPROVE_ALL_FEATURES";
-          case ActionType::ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE:
-            return "ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActionType(ActionType enumValue)
+        {
+          return GetNameForActionTypeCStr(enumValue);
         }
 
       } // namespace ActionTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ChildTypeMapper
       {
 
-        static const int ACCOUNT_HASH = HashingUtils::HashString("ACCOUNT");
-        static const int ORGANIZATIONAL_UNIT_HASH = HashingUtils::HashString("ORGANIZATIONAL_UNIT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCOUNT",
+          "ORGANIZATIONAL_UNIT",
+        };
 
         ChildType GetChildTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_HASH)
-          {
-            return ChildType::ACCOUNT;
-          }
-          else if (hashCode == ORGANIZATIONAL_UNIT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChildType::ORGANIZATIONAL_UNIT;
+          case -459336179:
+            if (name == "ACCOUNT")
+            {
+              return ChildType::ACCOUNT;
+            }
+            break;
+          case -1946787707:
+            if (name == "ORGANIZATIONAL_UNIT")
+            {
+              return ChildType::ORGANIZATIONAL_UNIT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ChildType::NOT_SET;
         }
 
-        Aws::String GetNameForChildType(ChildType enumValue)
+        const char* GetNameForChildTypeCStr(ChildType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChildType::ACCOUNT:
-            return "ACCOUNT";
-          case ChildType::ORGANIZATIONAL_UNIT:
-            return "ORGANIZATIONAL_UNIT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChildType(ChildType enumValue)
+        {
+          return GetNameForChildTypeCStr(enumValue);
         }
 
       } // namespace ChildTypeMapper
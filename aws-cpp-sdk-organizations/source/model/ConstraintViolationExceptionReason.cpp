@@ -30,100 +30,149 @@ namespace Aws
       namespace ConstraintViolationExceptionReasonMapper
       {
 
-        static const int ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ACCOUNT_NUMBER_LIMIT_EXCEEDED");
-        static const int HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("HANDSHAKE_RATE_LIMIT_EXCEEDED");
-        static const int OU_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OU_NUMBER_LIMIT_EXCEEDED");
-        static const int OU_DEPTH_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OU_DEPTH_LIMIT_EXCEEDED");
-        static const int POLICY_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("POLICY_NUMBER_LIMIT_EXCEEDED");
-        static const int MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED");
-        static const int MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED");
-        static const int ACCOUNT_CANNOT_LEAVE_ORGANIZATION_HASH = HashingUtils::HashString("ACCOUNT_CANNOT_LEAVE_ORGANIZATION");
-        static const int ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA_HASH = HashingUtils::HashString("ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA");
-        static const int ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION_HASH = HashingUtils::HashString("ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION");
-        static const int MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH = HashingUtils::HashString("MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED");
-        static const int MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH = HashingUtils::HashString("MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED");
-        static const int ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED");
-        static const int MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE_HASH = HashingUtils::HashString("MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE");
-        static const int MASTER_ACCOUNT_MISSING_CONTACT_INFO_HASH = HashingUtils::HashString("MASTER_ACCOUNT_MISSING_CONTACT_INFO");
-        static const int ORGANIZATION_NOT_IN_ALL_FEATURES_MODE_HASH = HashingUtils::HashString("ORGANIZATION_NOT_IN_ALL_FEATURES_MODE");
-        static const int EMAIL_VERIFICATION_CODE_EXPIRED_HASH = HashingUtils::HashString("EMAIL_VERIFICATION_CODE_EXPIRED");
-        static const int WAIT_PERIOD_ACTIVE_HASH = HashingUtils::HashString("WAIT_PERIOD_ACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCOUNT_NUMBER_LIMIT_EXCEEDED",
+          "HANDSHAKE_RATE_LIMIT_EXCEEDED",
+          "OU_NUMBER_LIMIT_EXCEEDED",
+          "OU_DEPTH_LIMIT_EXCEEDED",
+          "POLICY_NUMBER_LIMIT_EXCEEDED",
+          "MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED",
+          "MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED",
+          "ACCOUNT_CANNOT_LEAVE_ORGANIZATION",
+          "ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA",
+          "ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION",
+          "MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED",
+          "MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED",
+          "ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED",
+          "MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE",
+          "MASTER_ACCOUNT_MISSING_CONTACT_INFO",
+          "ORGANIZATION_NOT_IN_ALL_FEATURES_MODE",
+          "EMAIL_VERIFICATION_CODE_EXPIRED",
+          "WAIT_PERIOD_ACTIVE",
+        };
 
         ConstraintViolationExceptionReason GetConstraintViolationExceptionReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::ACCOUNT_NUMBER_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::HANDSHAKE_RATE_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == OU_NUMBER_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::OU_NUMBER_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == OU_DEPTH_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::OU_DEPTH_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == POLICY_NUMBER_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::POLICY_NUMBER_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == ACCOUNT_CANNOT_LEAVE_ORGANIZATION_HASH)
-          {
-            return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_ORGANIZATION;
-          }
-          else if (hashCode == ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA_HASH)
-          {
-            return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA;
-          }
-          else if (hashCode == ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION_HASH)
-          {
-            return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION;
-          }
-          else if (hashCode == MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH)
-          {
-            return ConstraintViolationExceptionReason::MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED;
-          }
-          else if (hashCode == MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH)
-          {
-            return ConstraintViolationExceptionReason::MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED;
-          }
-          else if (hashCode == ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE_HASH)
-          {
-            return ConstraintViolationExceptionReason::MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE;
-          }
-          else if (hashCode == MASTER_ACCOUNT_MISSING_CONTACT_INFO_HASH)
-          {
-            return ConstraintViolationExceptionReason::MASTER_ACCOUNT_MISSING_CONTACT_INFO;
-          }
-          else if (hashCode == ORGANIZATION_NOT_IN_ALL_FEATURES_MODE_HASH)
-          {
-            return ConstraintViolationExceptionReason::ORGANIZATION_NOT_IN_ALL_FEATURES_MODE;
-          }
-          else if (hashCode == EMAIL_VERIFICATION_CODE_EXPIRED_HASH)
-          {
-            return ConstraintViolationExceptionReason::EMAIL_VERIFICATION_CODE_EXPIRED;
-          }
-          else if (hashCode == WAIT_PERIOD_ACTIVE_HASH)
-          {
-            return ConstraintViolationExceptionReason::WAIT_PERIOD_ACTIVE;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 1346388603:
+            if (name == "ACCOUNT_NUMBER_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::ACCOUNT_NUMBER_LIMIT_EXCEEDED;
+            }
+            break;
+          case 497497166:
+            if (name == "HANDSHAKE_RATE_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::HANDSHAKE_RATE_LIMIT_EXCEEDED;
+            }
+            break;
+          case -1675371116:
+            if (name == "OU_NUMBER_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::OU_NUMBER_LIMIT_EXCEEDED;
+            }
+            break;
+          case -1969775284:
+            if (name == "OU_DEPTH_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::OU_DEPTH_LIMIT_EXCEEDED;
+            }
+            break;
+          case 611888096:
+            if (name == "POLICY_NUMBER_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::POLICY_NUMBER_LIMIT_EXCEEDED;
+            }
+            break;
+          case 1117335360:
+            if (name == "MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED;
+            }
+            break;
+          case 561974702:
+            if (name == "MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED;
+            }
+            break;
+          case 35797733:
+            if (name == "ACCOUNT_CANNOT_LEAVE_ORGANIZATION")
+            {
+              return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_ORGANIZATION;
+            }
+            break;
+          case 1397612814:
+            if (name == "ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA")
+            {
+              return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA;
+            }
+            break;
+          case -294002539:
+            if (name == "ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION")
+            {
+              return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION;
+            }
+            break;
+          case 347454095:
+            if (name == "MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED")
+            {
+              return ConstraintViolationExceptionReason::MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED;
+            }
+            break;
+          case 443637447:
+            if (name == "MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED")
+            {
+              return ConstraintViolationExceptionReason::MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED;
+            }
+            break;
+          case 294346824:
+            if (name == "ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED;
+            }
+            break;
+          case 454678393:
+            if (name == "MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE")
+            {
+              return ConstraintViolationExceptionReason::MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE;
+            }
+            break;
+          case -1974180971:
+            if (name == "MASTER_ACCOUNT_MISSING_CONTACT_INFO")
+            {
+              return ConstraintViolationExceptionReason::MASTER_ACCOUNT_MISSING_CONTACT_INFO;
+            }
+            break;
+          case 1118157093:
+            if (name == "ORGANIZATION_NOT_IN_ALL_FEATURES_MODE")
+            {
+              return ConstraintViolationExceptionReason::ORGANIZATION_NOT_IN_ALL_FEATURES_MODE;
+            }
+            break;
+          case 1982036820:
+            if (name == "EMAIL_VERIFICATION_CODE_EXPIRED")
+            {
+              return ConstraintViolationExceptionReason::EMAIL_VERIFICATION_CODE_EXPIRED;
+            }
+            break;
+          case 1270932986:
+            if (name == "WAIT_PERIOD_ACTIVE")
+            {
+              return ConstraintViolationExceptionReason::WAIT_PERIOD_ACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -135,55 +184,26 @@ namespace Aws
           return ConstraintViolationExceptionReason::NOT_SET;
         }
 
-        Aws::String GetNameForConstraintViolationExceptionReason(ConstraintViolationExceptionReason enumValue)
+        const char* GetNameForConstraintViolationExceptionReasonCStr(ConstraintViolationExceptionReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConstraintViolationExceptionReason::ACCOUNT_NUMBER_LIMIT_EXCEEDED:
-            return "ACCOUNT_NUMBER_LIMIT_EXCEEDED";
-          case ConstraintViolationExceptionReason::HANDSHAKE_RATE_LIMIT_EXCEEDED:
-            return "HANDSHAKE_RATE_LIMIT_EXCEEDED";
-          case ConstraintViolationExceptionReason::OU_NUMBER_LIMIT_EXCEEDED:
-            return "OU_NUMBER_LIMIT_EXCEEDED";
-          case ConstraintViolationExceptionReason::OU_DEPTH_LIMIT_EXCEEDED:
-            return "OU_DEPTH_LIMIT_EXCEEDED";
-          case ConstraintViolationExceptionReason::POLICY_NUMBER_LIMIT_EXCEEDED:
-            return "POLICY_NUMBER_LIMIT_EXCEEDED";
-          case ConstraintViolationExceptionReason::MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED:
-            return "MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED";
-          case ConstraintViolationExceptionReason::MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED:
-            return "MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED";
-          case ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_ORGANIZATION:
-            return "ACCOUNT_CANNOT_LEAVE_ORGANIZATION";
-          case ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA:
-            return "ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA";
-          case ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION:
-            return "ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION";
-          case ConstraintViolationExceptionReason::MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED:
-            return "MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED";
-          case ConstraintViolationExceptionReason::MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED:
-            return "MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED";
-          case ConstraintViolationExceptionReason::ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED:
-            return "ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED";
-          case ConstraintViolationExceptionReason::MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE:
-            return "MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE";
-          case ConstraintViolationExceptionReason::MASTER_ACCOUNT_MISSING_CONTACT_INFO:
-            return "MASTER_ACCOUNT_MISSING_CONTACT_INFO";
-          case ConstraintViolationExceptionReason::ORGANIZATION_NOT_IN_ALL_FEATURES_MODE:
-            return "ORGANIZATION_NOT_IN_ALL_FEATURES_MODE";
-          case ConstraintViolationExceptionReason::EMAIL_VERIFICATION_CODE_EXPIRED:
-            return "EMAIL_VERIFICATION_CODE_EXPIRED";
-          case ConstraintViolationExceptionReason::WAIT_PERIOD_ACTIVE:
-            return "WAIT_PERIOD_ACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConstraintViolationExceptionReason(ConstraintViolationExceptionReason enumValue)
+        {
+          return GetNameForConstraintViolationExceptionReasonCStr(enumValue);
         }
 
       } // namespace ConstraintViolationExceptionReasonMapper
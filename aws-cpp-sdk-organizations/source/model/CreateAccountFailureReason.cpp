@@ -30,40 +30,65 @@ namespace Aws
       namespace CreateAccountFailureReasonMapper
       {
 
-        static const int ACCOUNT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ACCOUNT_LIMIT_EXCEEDED");
-        static const int EMAIL_ALREADY_EXISTS_HASH = HashingUtils::HashString("EMAIL_ALREADY_EXISTS");
-        static const int INVALID_ADDRESS_HASH = HashingUtils::HashString("INVALID_ADDRESS");
-        static const int INVALID_EMAIL_HASH = HashingUtils::HashString("INVALID_EMAIL");
-        static const int CONCURRENT_ACCOUNT_MODIFICATION_HASH = HashingUtils::HashString("CONCURRENT_ACCOUNT_MODIFICATION");
-        static const int INTERNAL_FAILURE_HASH = HashingUtils::HashString("INTERNAL_FAILURE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCOUNT_LIMIT_EXCEEDED",
+          "EMAIL_ALREADY_EXISTS",
+          "INVALID_ADDRESS",
+          "INVALID_EMAIL",
+          "CONCURRENT_ACCOUNT_MODIFICATION",
+          "INTERNAL_FAILURE",
+        };
 
         CreateAccountFailureReason GetCreateAccountFailureReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_LIMIT_EXCEEDED_HASH)
-          {
-            return CreateAccountFailureReason::ACCOUNT_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == EMAIL_ALREADY_EXISTS_HASH)
-          {
-            return CreateAccountFailureReason::EMAIL_ALREADY_EXISTS;
-          }
-          else if (hashCode == INVALID_ADDRESS_HASH)
-          {
-            return CreateAccountFailureReason::INVALID_ADDRESS;
-          }
-          else if (hashCode == INVALID_EMAIL_HASH)
-          {
-            return CreateAccountFailureReason::INVALID_EMAIL;
-          }
-          else if (hashCode == CONCURRENT_ACCOUNT_MODIFICATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CreateAccountFailureReason::CONCURRENT_ACCOUNT_MODIFICATION;
-          }
-          else if (hashCode == INTERNAL_FAILURE_HASH)
-          {
-            return CreateAccountFailureReason::INTERNAL_FAILURE;
+          case 1758886889:
+            if (name == "ACCOUNT_LIMIT_EXCEEDED")
+            {
+              return CreateAccountFailureReason::ACCOUNT_LIMIT_EXCEEDED;
+            }
+            break;
+          case -417780378:
+            if (name == "EMAIL_ALREADY_EXISTS")
+            {
+              return CreateAccountFailureReason::EMAIL_ALREADY_EXISTS;
+            }
+            break;
+          case 926582124:
+            if (name == "INVALID_ADDRESS")
+            {
+              return CreateAccountFailureReason::INVALID_ADDRESS;
+            }
+            break;
+          case -1112393964:
+            if (name == "INVALID_EMAIL")
+            {
+              return CreateAccountFailureReason::INVALID_EMAIL;
+            }
+            break;
+          case -608805866:
+            if (name == "CONCURRENT_ACCOUNT_MODIFICATION")
+            {
+              return CreateAccountFailureReason::CONCURRENT_ACCOUNT_MODIFICATION;
+            }
+            break;
+          case 1873612264:
+            if (name == "INTERNAL_FAILURE")
+            {
+              return CreateAccountFailureReason::INTERNAL_FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return CreateAccountFailureReason::NOT_SET;
         }
 
-        Aws::String GetNameForCreateAccountFailureReason(CreateAccountFailureReason enumValue)
+        const char* GetNameForCreateAccountFailureReasonCStr(CreateAccountFailureReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CreateAccountFailureReason::ACCOUNT_LIMIT_EXCEEDED:
-            return "ACCOUNT_LIMIT_EXCEEDED";
-          case CreateAccountFailureReason::EMAIL_ALREADY_EXISTS:
-            return "EMAIL_ALREADY_EXISTS";
-          case CreateAccountFailureReason::INVALID_ADDRESS:
-            return "INVALID_ADDRESS";
-          case CreateAccountFailureReason::INVALID_EMAIL:
-            return "INVALID_EMAIL";
-          case CreateAccountFailureReason::CONCURRENT_ACCOUNT_MODIFICATION:
-            return "CONCURRENT_ACCOUNT_MODIFICATION";
-          case CreateAccountFailureReason::INTERNAL_FAILURE:
-            return "INTERNAL_FAILURE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCreateAccountFailureReason(CreateAccountFailureReason enumValue)
+        {
+          return GetNameForCreateAccountFailureReasonCStr(enumValue);
         }
 
       } // namespace CreateAccountFailureReasonMapper
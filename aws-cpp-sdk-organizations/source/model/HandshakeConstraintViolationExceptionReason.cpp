@@ -30,50 +30,79 @@ namespace Aws
       namespace HandshakeConstraintViolationExceptionReasonMapper
       {
 
-        static const int ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ACCOUNT_NUMBER_LIMIT_EXCEEDED");
-        static const int HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("HANDSHAKE_RATE_LIMIT_EXCEEDED");
-        static const int ALREADY_IN_AN_ORGANIZATION_HASH = HashingUtils::HashString("ALREADY_IN_AN_ORGANIZATION");
-        static const int ORGANIZATION_ALREADY_HAS_ALL_FEATURES_HASH = HashingUtils::HashString("ORGANIZATION_ALREADY_HAS_ALL_FEATURES");
-        static const int INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES_HASH = HashingUtils::HashString("INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES");
-        static const int PAYMENT_INSTRUMENT_REQUIRED_HASH = HashingUtils::HashString("PAYMENT_INSTRUMENT_REQUIRED");
-        static const int ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD_HASH = HashingUtils::HashString("ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD");
-        static const int ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCOUNT_NUMBER_LIMIT_EXCEEDED",
+          "HANDSHAKE_RATE_LIMIT_EXCEEDED",
+          "ALREADY_IN_AN_ORGANIZATION",
+          "ORGANIZATION_ALREADY_HAS_ALL_FEATURES",
+          "INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES",
+          "PAYMENT_INSTRUMENT_REQUIRED",
+          "ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD",
+          "ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED",
+        };
 
         HandshakeConstraintViolationExceptionReason GetHandshakeConstraintViolationExceptionReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::ACCOUNT_NUMBER_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::HANDSHAKE_RATE_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == ALREADY_IN_AN_ORGANIZATION_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::ALREADY_IN_AN_ORGANIZATION;
-          }
-          else if (hashCode == ORGANIZATION_ALREADY_HAS_ALL_FEATURES_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::ORGANIZATION_ALREADY_HAS_ALL_FEATURES;
-          }
-          else if (hashCode == INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES;
-          }
-          else if (hashCode == PAYMENT_INSTRUMENT_REQUIRED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HandshakeConstraintViolationExceptionReason::PAYMENT_INSTRUMENT_REQUIRED;
-          }
-          else if (hashCode == ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD;
-          }
-          else if (hashCode == ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED;
+          case 1346388603:
+            if (name == "ACCOUNT_NUMBER_LIMIT_EXCEEDED")
+            {
+              return HandshakeConstraintViolationExceptionReason::ACCOUNT_NUMBER_LIMIT_EXCEEDED;
+            }
+            break;
+          case 497497166:
+            if (name == "HANDSHAKE_RATE_LIMIT_EXCEEDED")
+            {
+              return HandshakeConstraintViolationExceptionReason::HANDSHAKE_RATE_LIMIT_EXCEEDED;
+            }
+            break;
+          case 339709010:
+            if (name == "ALREADY_IN_AN_ORGANIZATION")
+            {
+              return HandshakeConstraintViolationExceptionReason::ALREADY_IN_AN_ORGANIZATION;
+            }
+            break;
+          case -1720656493:
+            if (name == "ORGANIZATION_ALREADY_HAS_ALL_FEATURES")
+            {
+              return HandshakeConstraintViolationExceptionReason::ORGANIZATION_ALREADY_HAS_ALL_FEATURES;
+            }
+            break;
+          case -1982349082:
+            if (name == "INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES")
+            {
+              return HandshakeConstraintViolationExceptionReason::INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES;
+            }
+            break;
+          case 615861534:
+            if (name == "PAYMENT_INSTRUMENT_REQUIRED")
+            {
+              return HandshakeConstraintViolationExceptionReason::PAYMENT_INSTRUMENT_REQUIRED;
+            }
+            break;
+          case 851759368:
+            if (name == "ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD")
+            {
+              return HandshakeConstraintViolationExceptionReason::ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD;
+            }
+            break;
+          case 525258148:
+            if (name == "ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED")
+            {
+              return HandshakeConstraintViolationExceptionReason::ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return HandshakeConstraintViolationExceptionReason::NOT_SET;
         }
 
-        Aws::String GetNameForHandshakeConstraintViolationExceptionReason(HandshakeConstraintViolationExceptionReason enumValue)
+        const char* GetNameForHandshakeConstraintViolationExceptionReasonCStr(HandshakeConstraintViolationExceptionReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HandshakeConstraintViolationExceptionReason::ACCOUNT_NUMBER_LIMIT_EXCEEDED:
-            return "ACCOUNT_NUMBER_LIMIT_EXCEEDED";
-          case HandshakeConstraintViolationExceptionReason::HANDSHAKE_RATE_LIMIT_EXCEEDED:
-            return "HANDSHAKE_RATE_LIMIT_EXCEEDED";
-          case HandshakeConstraintViolationExceptionReason::ALREADY_IN_AN_ORGANIZATION:
-            return "ALREADY_IN_AN_ORGANIZATION";
-          case HandshakeConstraintViolationExceptionReason::ORGANIZATION_ALREADY_HAS_ALL_FEATURES:
-            return "ORGANIZATION_ALREADY_HAS_ALL_FEATURES";
-          case HandshakeConstraintViolationExceptionReason::INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES:
-            return "INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES";
-          case HandshakeConstraintViolationExceptionReason::PAYMENT_INSTRUMENT_REQUIRED:
-            return "PAYMENT_INSTRUMENT_REQUIRED";
-          case HandshakeConstraintViolationExceptionReason::ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD:
-            return "ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD";
-          case HandshakeConstraintViolationExceptionReason::ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED:
-            return "ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHandshakeConstraintViolationExceptionReason(HandshakeConstraintViolationExceptionReason enumValue)
+        {
+          return GetNameForHandshakeConstraintViolationExceptionReasonCStr(enumValue);
         }
 
       } // namespace HandshakeConstraintViolationExceptionReasonMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace HandshakePartyTypeMapper
       {
 
-        static const int ACCOUNT_HASH = HashingUtils::HashString("ACCOUNT");
-        static const int ORGANIZATION_HASH = HashingUtils::HashString("ORGANIZATION");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCOUNT",
+          "ORGANIZATION",
+          "EMAIL",
+        };
 
         HandshakePartyType GetHandshakePartyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_HASH)
-          {
-            return HandshakePartyType::ACCOUNT;
-          }
-          else if (hashCode == ORGANIZATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HandshakePartyType::ORGANIZATION;
-          }
-          else if (hashCode == EMAIL_HASH)
-          {
-            return HandshakePartyType::EMAIL;
+          case -459336179:
+            if (name == "ACCOUNT")
+            {
+              return HandshakePartyType::ACCOUNT;
+            }
+            break;
+          case -798763725:
+            if (name == "ORGANIZATION")
+            {
+              return HandshakePartyType::ORGANIZATION;
+            }
+            break;
+          case 66081660:
+            if (name == "EMAIL")
+            {
+              return HandshakePartyType::EMAIL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return HandshakePartyType::NOT_SET;
         }
 
-        Aws::String GetNameForHandshakePartyType(HandshakePartyType enumValue)
+        const char* GetNameForHandshakePartyTypeCStr(HandshakePartyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HandshakePartyType::ACCOUNT:
-            return "ACCOUNT";
-          case HandshakePartyType::ORGANIZATION:
-            return "ORGANIZATION";
-          case HandshakePartyType::EMAIL:
-            return "EMAIL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHandshakePartyType(HandshakePartyType enumValue)
+        {
+          return GetNameForHandshakePartyTypeCStr(enumValue);
         }
 
       } // namespace HandshakePartyTypeMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace HandshakeResourceTypeMapper
       {
 
-        static const int ACCOUNT_HASH = HashingUtils::HashString("ACCOUNT");
-        static const int ORGANIZATION_HASH = HashingUtils::HashString("ORGANIZATION");
-        static const int ORGANIZATION_FEATURE_SET_HASH = HashingUtils::HashString("ORGANIZATION_FEATURE_SET");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
-        static const int MASTER_EMAIL_HASH = HashingUtils::HashString("MASTER_EMAIL");
-        static const int MASTER_NAME_HASH = HashingUtils::HashString("MASTER_NAME");
-        static const int NOTES_HASH = HashingUtils::HashString("NOTES");
-        static const int PARENT_HANDSHAKE_HASH = HashingUtils::HashString("PARENT_HANDSHAKE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCOUNT",
+          "ORGANIZATION",
+          "ORGANIZATION_FEATURE_SET",
+          "EMAIL",
+          "MASTER_EMAIL",
+          "MASTER_NAME",
+          "NOTES",
+          "PARENT_HANDSHAKE",
+        };
 
         HandshakeResourceType GetHandshakeResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_HASH)
-          {
-            return HandshakeResourceType::ACCOUNT;
-          }
-          else if (hashCode == ORGANIZATION_HASH)
-          {
-            return HandshakeResourceType::ORGANIZATION;
-          }
-          else if (hashCode == ORGANIZATION_FEATURE_SET_HASH)
-          {
-            return HandshakeResourceType::ORGANIZATION_FEATURE_SET;
-          }
-          else if (hashCode == EMAIL_HASH)
-          {
-            return HandshakeResourceType::EMAIL;
-          }
-          else if (hashCode == MASTER_EMAIL_HASH)
-          {
-            return HandshakeResourceType::MASTER_EMAIL;
-          }
-          else if (hashCode == MASTER_NAME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HandshakeResourceType::MASTER_NAME;
-          }
-          else if (hashCode == NOTES_HASH)
-          {
-            return HandshakeResourceType::NOTES;
-          }
-          else if (hashCode == PARENT_HANDSHAKE_HASH)
-          {
-            return HandshakeResourceType::PARENT_HANDSHAKE;
+          case -459336179:
+            if (name == "ACCOUNT")
+            {
+              return HandshakeResourceType::ACCOUNT;
+            }
+            break;
+          case -798763725:
+            if (name == "ORGANIZATION")
+            {
+              return HandshakeResourceType::ORGANIZATION;
+            }
+            break;
+          case 557980237:
+            if (name == "ORGANIZATION_FEATURE_SET")
+            {
+              return HandshakeResourceType::ORGANIZATION_FEATURE_SET;
+            }
+            break;
+          case 66081660:
+            if (name == "EMAIL")
+            {
+              return HandshakeResourceType::EMAIL;
+            }
+            break;
+          case -1874787489:
+            if (name == "MASTER_EMAIL")
+            {
+              return HandshakeResourceType::MASTER_EMAIL;
+            }
+            break;
+          case -891504056:
+            if (name == "MASTER_NAME")
+            {
+              return HandshakeResourceType::MASTER_NAME;
+            }
+            break;
+          case 74471073:
+            if (name == "NOTES")
+            {
+              return HandshakeResourceType::NOTES;
+            }
+            break;
+          case 1969305218:
+            if (name == "PARENT_HANDSHAKE")
+            {
+              return HandshakeResourceType::PARENT_HANDSHAKE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return HandshakeResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForHandshakeResourceType(HandshakeResourceType enumValue)
+        const char* GetNameForHandshakeResourceTypeCStr(HandshakeResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HandshakeResourceType::ACCOUNT:
-            return "ACCOUNT";
-          case HandshakeResourceType::ORGANIZATION:
-            return "ORGANIZATION";
-          case HandshakeResourceType::ORGANIZATION_FEATURE_SET:
-            return "ORGANIZATION_FEATURE_SET";
-          case HandshakeResourceType::EMAIL:
-            return "EMAIL";
-          case HandshakeResourceType::MASTER_EMAIL:
-            return "MASTER_EMAIL";
-          case HandshakeResourceType::MASTER_NAME:
-            return "MASTER_NAME";
-          case HandshakeResourceType::NOTES:
-            return "NOTES";
-          case HandshakeResourceType::PARENT_HANDSHAKE:
-            return "PARENT_HANDSHAKE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHandshakeResourceType(HandshakeResourceType enumValue)
+        {
+          return GetNameForHandshakeResourceTypeCStr(enumValue);
         }
 
       } // namespace HandshakeResourceTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace HandshakeStateMapper
       {
 
-        static const int REQUESTED_HASH = HashingUtils::HashString("REQUESTED");
-        static const int OPEN_HASH = HashingUtils::HashString("OPEN");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int ACCEPTED_HASH = HashingUtils::HashString("ACCEPTED");
-        static const int DECLINED_HASH = HashingUtils::HashString("DECLINED");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REQUESTED",
+          "OPEN",
+          "CANCELED",
+          "ACCEPTED",
+          "DECLINED",
+          "EXPIRED",
+        };
 
         HandshakeState GetHandshakeStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REQUESTED_HASH)
-          {
-            return HandshakeState::REQUESTED;
-          }
-          else if (hashCode == OPEN_HASH)
-          {
-            return HandshakeState::OPEN;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return HandshakeState::CANCELED;
-          }
-          else if (hashCode == ACCEPTED_HASH)
-          {
-            return HandshakeState::ACCEPTED;
-          }
-          else if (hashCode == DECLINED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HandshakeState::DECLINED;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return HandshakeState::EXPIRED;
+          case -814438578:
+            if (name == "REQUESTED")
+            {
+              return HandshakeState::REQUESTED;
+            }
+            break;
+          case 2432586:
+            if (name == "OPEN")
+            {
+              return HandshakeState::OPEN;
+            }
+            break;
+          case 659453081:
+            if (name == "CANCELED")
+            {
+              return HandshakeState::CANCELED;
+            }
+            break;
+          case -1363898457:
+            if (name == "ACCEPTED")
+            {
+              return HandshakeState::ACCEPTED;
+            }
+            break;
+          case 1350822958:
+            if (name == "DECLINED")
+            {
+              return HandshakeState::DECLINED;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return HandshakeState::EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return HandshakeState::NOT_SET;
         }
 
-        Aws::String GetNameForHandshakeState(HandshakeState enumValue)
+        const char* GetNameForHandshakeStateCStr(HandshakeState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HandshakeState::REQUESTED:
-            return "REQUESTED";
-          case HandshakeState::OPEN:
-            return "OPEN";
-          case HandshakeState::CANCELED:
-            return "CANCELED";
-          case HandshakeState::ACCEPTED:
-            return "ACCEPTED";
-          case HandshakeState::DECLINED:
-            return "DECLINED";
-          case HandshakeState::EXPIRED:
-            return "EXPIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHandshakeState(HandshakeState enumValue)
+        {
+          return GetNameForHandshakeStateCStr(enumValue);
         }
 
       } // namespace HandshakeStateMapper
@@ -30,105 +30,156 @@ namespace Aws
       namespace InvalidInputExceptionReasonMapper
       {
 
-        static const int INVALID_PARTY_TYPE_TARGET_HASH = HashingUtils::HashString("INVALID_PARTY_TYPE_TARGET");
-        static const int INVALID_SYNTAX_ORGANIZATION_ARN_HASH = HashingUtils::HashString("INVALID_SYNTAX_ORGANIZATION_ARN");
-        static const int INVALID_SYNTAX_POLICY_ID_HASH = HashingUtils::HashString("INVALID_SYNTAX_POLICY_ID");
-        static const int INVALID_ENUM_HASH = HashingUtils::HashString("INVALID_ENUM");
-        static const int INVALID_LIST_MEMBER_HASH = HashingUtils::HashString("INVALID_LIST_MEMBER");
-        static const int MAX_LENGTH_EXCEEDED_HASH = HashingUtils::HashString("MAX_LENGTH_EXCEEDED");
-        static const int MAX_VALUE_EXCEEDED_HASH = HashingUtils::HashString("MAX_VALUE_EXCEEDED");
-        static const int MIN_LENGTH_EXCEEDED_HASH = HashingUtils::HashString("MIN_LENGTH_EXCEEDED");
-        static const int MIN_VALUE_EXCEEDED_HASH = HashingUtils::HashString("MIN_VALUE_EXCEEDED");
-        static const int IMMUTABLE_POLICY_HASH = HashingUtils::HashString("IMMUTABLE_POLICY");
-        static const int INVALID_PATTERN_HASH = HashingUtils::HashString("INVALID_PATTERN");
-        static const int INVALID_PATTERN_TARGET_ID_HASH = HashingUtils::HashString("INVALID_PATTERN_TARGET_ID");
-        static const int INPUT_REQUIRED_HASH = HashingUtils::HashString("INPUT_REQUIRED");
-        static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("INVALID_NEXT_TOKEN");
-        static const int MAX_LIMIT_EXCEEDED_FILTER_HASH = HashingUtils::HashString("MAX_LIMIT_EXCEEDED_FILTER");
-        static const int MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS_HASH = HashingUtils::HashString("MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS");
-        static const int INVALID_FULL_NAME_TARGET_HASH = HashingUtils::HashString("INVALID_FULL_NAME_TARGET");
-        static const int UNRECOGNIZED_SERVICE_PRINCIPAL_HASH = HashingUtils::HashString("UNRECOGNIZED_SERVICE_PRINCIPAL");
-        static const int INVALID_ROLE_NAME_HASH = HashingUtils::HashString("INVALID_ROLE_NAME");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INVALID_PARTY_TYPE_TARGET",
+          "INVALID_SYNTAX_ORGANIZATION_ARN",
+          "INVALID_SYNTAX_POLICY_ID",
+          "INVALID_ENUM",
+          "INVALID_LIST_MEMBER",
+          "MAX_LENGTH_EXCEEDED",
+          "MAX_VALUE_EXCEEDED",
+          "MIN_LENGTH_EXCEEDED",
+          "MIN_VALUE_EXCEEDED",
+          "IMMUTABLE_POLICY",
+          "INVALID_PATTERN",
+          "INVALID_PATTERN_TARGET_ID",
+          "INPUT_REQUIRED",
+          "INVALID_NEXT_TOKEN",
+          "MAX_LIMIT_EXCEEDED_FILTER",
+          "MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS",
+          "INVALID_FULL_NAME_TARGET",
+          "UNRECOGNIZED_SERVICE_PRINCIPAL",
+          "INVALID_ROLE_NAME",
+        };
 
         InvalidInputExceptionReason GetInvalidInputExceptionReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVALID_PARTY_TYPE_TARGET_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_PARTY_TYPE_TARGET;
-          }
-          else if (hashCode == INVALID_SYNTAX_ORGANIZATION_ARN_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_SYNTAX_ORGANIZATION_ARN;
-          }
-          else if (hashCode == INVALID_SYNTAX_POLICY_ID_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_SYNTAX_POLICY_ID;
-          }
-          else if (hashCode == INVALID_ENUM_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_ENUM;
-          }
-          else if (hashCode == INVALID_LIST_MEMBER_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_LIST_MEMBER;
-          }
-          else if (hashCode == MAX_LENGTH_EXCEEDED_HASH)
-          {
-            return InvalidInputExceptionReason::MAX_LENGTH_EXCEEDED;
-          }
-          else if (hashCode == MAX_VALUE_EXCEEDED_HASH)
-          {
-            return InvalidInputExceptionReason::MAX_VALUE_EXCEEDED;
-          }
-          else if (hashCode == MIN_LENGTH_EXCEEDED_HASH)
-          {
-            return InvalidInputExceptionReason::MIN_LENGTH_EXCEEDED;
-          }
-          else if (hashCode == MIN_VALUE_EXCEEDED_HASH)
-          {
-            return InvalidInputExceptionReason::MIN_VALUE_EXCEEDED;
-          }
-          else if (hashCode == IMMUTABLE_POLICY_HASH)
-          {
-            return InvalidInputExceptionReason::IMMUTABLE_POLICY;
-          }
-          else if (hashCode == INVALID_PATTERN_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_PATTERN;
-          }
-          else if (hashCode == INVALID_PATTERN_TARGET_ID_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_PATTERN_TARGET_ID;
-          }
-          else if (hashCode == INPUT_REQUIRED_HASH)
-          {
-            return InvalidInputExceptionReason::INPUT_REQUIRED;
-          }
-          else if (hashCode == INVALID_NEXT_TOKEN_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_NEXT_TOKEN;
-          }
-          else if (hashCode == MAX_LIMIT_EXCEEDED_FILTER_HASH)
-          {
-            return InvalidInputExceptionReason::MAX_LIMIT_EXCEEDED_FILTER;
-          }
-          else if (hashCode == MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS_HASH)
-          {
-            return InvalidInputExceptionReason::MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS;
-          }
-          else if (hashCode == INVALID_FULL_NAME_TARGET_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_FULL_NAME_TARGET;
-          }
-          else if (hashCode == UNRECOGNIZED_SERVICE_PRINCIPAL_HASH)
-          {
-            return InvalidInputExceptionReason::UNRECOGNIZED_SERVICE_PRINCIPAL;
-          }
-          else if (hashCode == INVALID_ROLE_NAME_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_ROLE_NAME;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 1704979925:
+            if (name == "INVALID_PARTY_TYPE_TARGET")
+            {
+              return InvalidInputExceptionReason::INVALID_PARTY_TYPE_TARGET;
+            }
+            break;
+          case 1686045605:
+            if (name == "INVALID_SYNTAX_ORGANIZATION_ARN")
+            {
+              return InvalidInputExceptionReason::INVALID_SYNTAX_ORGANIZATION_ARN;
+            }
+            break;
+          case 1098856276:
+            if (name == "INVALID_SYNTAX_POLICY_ID")
+            {
+              return InvalidInputExceptionReason::INVALID_SYNTAX_POLICY_ID;
+            }
+            break;
+          case -1421355415:
+            if (name == "INVALID_ENUM")
+            {
+              return InvalidInputExceptionReason::INVALID_ENUM;
+            }
+            break;
+          case 1642944243:
+            if (name == "INVALID_LIST_MEMBER")
+            {
+              return InvalidInputExceptionReason::INVALID_LIST_MEMBER;
+            }
+            break;
+          case -887505007:
+            if (name == "MAX_LENGTH_EXCEEDED")
+            {
+              return InvalidInputExceptionReason::MAX_LENGTH_EXCEEDED;
+            }
+            break;
+          case 676166364:
+            if (name == "MAX_VALUE_EXCEEDED")
+            {
+              return InvalidInputExceptionReason::MAX_VALUE_EXCEEDED;
+            }
+            break;
+          case -922344321:
+            if (name == "MIN_LENGTH_EXCEEDED")
+            {
+              return InvalidInputExceptionReason::MIN_LENGTH_EXCEEDED;
+            }
+            break;
+          case -571883474:
+            if (name == "MIN_VALUE_EXCEEDED")
+            {
+              return InvalidInputExceptionReason::MIN_VALUE_EXCEEDED;
+            }
+            break;
+          case -57967953:
+            if (name == "IMMUTABLE_POLICY")
+            {
+              return InvalidInputExceptionReason::IMMUTABLE_POLICY;
+            }
+            break;
+          case 1283183880:
+            if (name == "INVALID_PATTERN")
+            {
+              return InvalidInputExceptionReason::INVALID_PATTERN;
+            }
+            break;
+          case 995620882:
+            if (name == "INVALID_PATTERN_TARGET_ID")
+            {
+              return InvalidInputExceptionReason::INVALID_PATTERN_TARGET_ID;
+            }
+            break;
+          case 810740884:
+            if (name == "INPUT_REQUIRED")
+            {
+              return InvalidInputExceptionReason::INPUT_REQUIRED;
+            }
+            break;
+          case -1292173067:
+            if (name == "INVALID_NEXT_TOKEN")
+            {
+              return InvalidInputExceptionReason::INVALID_NEXT_TOKEN;
+            }
+            break;
+          case 417364101:
+            if (name == "MAX_LIMIT_EXCEEDED_FILTER")
+            {
+              return InvalidInputExceptionReason::MAX_LIMIT_EXCEEDED_FILTER;
+            }
+            break;
+          case 1794853265:
+            if (name == "MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS")
+            {
+              return InvalidInputExceptionReason::MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS;
+            }
+            break;
+          case -683698819:
+            if (name == "INVALID_FULL_NAME_TARGET")
+            {
+              return InvalidInputExceptionReason::INVALID_FULL_NAME_TARGET;
+            }
+            break;
+          case -1648437356:
+            if (name == "UNRECOGNIZED_SERVICE_PRINCIPAL")
+            {
+              return InvalidInputExceptionReason::UNRECOGNIZED_SERVICE_PRINCIPAL;
+            }
+            break;
+          case 878044236:
+            if (name == "INVALID_ROLE_NAME")
+            {
+              return InvalidInputExceptionReason::INVALID_ROLE_NAME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -140,57 +191,26 @@ namespace Aws
           return InvalidInputExceptionReason::NOT_SET;
         }
 
-        Aws::String GetNameForInvalidInputExceptionReason(InvalidInputExceptionReason enumValue)
+        const char* GetNameForInvalidInputExceptionReasonCStr(InvalidInputExceptionReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InvalidInputExceptionReason::INVALID_PARTY_TYPE_TARGET:
-            return "INVALID_PARTY_TYPE_TARGET";
-          case InvalidInputExceptionReason::INVALID_SYNTAX_ORGANIZATION_ARN:
-            return "INVALID_SYNTAX_ORGANIZATION_ARN";
-          case InvalidInputExceptionReason::INVALID_SYNTAX_POLICY_ID:
-            return "INVALID_SYNTAX_POLICY_ID";
-          case InvalidInputExceptionReason::INVALID_ENUM:
-            return "INVALID_ENUM";
-          case InvalidInputExceptionReason::INVALID_LIST_MEMBER:
-            return "INVALID_LIST_MEMBER";
-          case InvalidInputExceptionReason::MAX_LENGTH_EXCEEDED:
-            return "MAX_LENGTH_EXCEEDED";
-          case InvalidInputExceptionReason::MAX_VALUE_EXCEEDED:
-            return "MAX_VALUE_EXCEEDED";
-          case InvalidInputExceptionReason::MIN_LENGTH_EXCEEDED:
-            return "MIN_LENGTH_EXCEEDED";
-          case InvalidInputExceptionReason::MIN_VALUE_EXCEEDED:
-            return "MIN_VALUE_EXCEEDED";
-          case InvalidInputExceptionReason::IMMUTABLE_POLICY:
-            return "IMMUTABLE_POLICY";
-          case InvalidInputExceptionReason::INVALID_PATTERN:
-            return "INVALID_PATTERN";
-          case InvalidInputExceptionReason::INVALID_PATTERN_TARGET_ID:
-            return "INVALID_PATTERN_TARGET_ID";
-          case InvalidInputExceptionReason::INPUT_REQUIRED:
-            return "INPUT_REQUIRED";
-          case InvalidInputExceptionReason::INVALID_NEXT_TOKEN:
-            return "INVALID_NEXT_TOKEN";
-          case InvalidInputExceptionReason::MAX_LIMIT_EXCEEDED_FILTER:
-            return "MAX_LIMIT_EXCEEDED_FILTER";
-          case InvalidInputExceptionReason::MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS:
-            return "MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS";
-          case InvalidInputExceptionReason::INVALID_FULL_NAME_TARGET:
-            return "INVALID_FULL_NAME_TARGET";
-          case InvalidInputExceptionReason::UNRECOGNIZED_SERVICE_PRINCIPAL:
-            return "UNRECOGNIZED_SERVICE_PRINCIPAL";
-          case InvalidInputExceptionReason::INVALID_ROLE_NAME:
-            return "INVALID_ROLE_NAME";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInvalidInputExceptionReason(InvalidInputExceptionReason enumValue)
+        {
+          return GetNameForInvalidInputExceptionReasonCStr(enumValue);
         }
 
       } // namespace InvalidInputExceptionReasonMapper
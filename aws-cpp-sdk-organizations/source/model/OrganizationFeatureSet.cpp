@@ -30,20 +30,37 @@ namespace Aws
       namespace OrganizationFeatureSetMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int CONSOLIDATED_BILLING_HASH = HashingUtils::HashString("CONSOLIDATED_BILLING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALL",
+          "CONSOLIDATED_BILLING",
+        };
 
         OrganizationFeatureSet GetOrganizationFeatureSetForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
-          {
-            return OrganizationFeatureSet::ALL;
-          }
-          else if (hashCode == CONSOLIDATED_BILLING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OrganizationFeatureSet::CONSOLIDATED_BILLING;
+          case 64897:
+            if (name == "ALL")
+            {
+              return OrganizationFeatureSet::ALL;
+            }
+            break;
+          case -392801257:
+            if (name == "CONSOLIDATED_BILLING")
+            {
+              return OrganizationFeatureSet::CONSOLIDATED_BILLING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OrganizationFeatureSet::NOT_SET;
         }
 
-        Aws::String GetNameForOrganizationFeatureSet(OrganizationFeatureSet enumValue)
+        const char* GetNameForOrganizationFeatureSetCStr(OrganizationFeatureSet enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OrganizationFeatureSet::ALL:
-            return "ALL";
-          case OrganizationFeatureSet::CONSOLIDATED_BILLING:
-            return "CONSOLIDATED_BILLING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOrganizationFeatureSet(OrganizationFeatureSet enumValue)
+        {
+          return GetNameForOrganizationFeatureSetCStr(enumValue);
         }
 
       } // namespace OrganizationFeatureSetMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ParentTypeMapper
       {
 
-        static const int ROOT_HASH = HashingUtils::HashString("ROOT");
-        static const int ORGANIZATIONAL_UNIT_HASH = HashingUtils::HashString("ORGANIZATIONAL_UNIT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ROOT",
+          "ORGANIZATIONAL_UNIT",
+        };
 
         ParentType GetParentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ROOT_HASH)
-          {
-            return ParentType::ROOT;
-          }
-          else if (hashCode == ORGANIZATIONAL_UNIT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ParentType::ORGANIZATIONAL_UNIT;
+          case 2521314:
+            if (name == "ROOT")
+            {
+              return ParentType::ROOT;
+            }
+            break;
+          case -1946787707:
+            if (name == "ORGANIZATIONAL_UNIT")
+            {
+              return ParentType::ORGANIZATIONAL_UNIT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ParentType::NOT_SET;
         }
 
-        Aws::String GetNameForParentType(ParentType enumValue)
+        const char* GetNameForParentTypeCStr(ParentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ParentType::ROOT:
-            return "ROOT";
-          case ParentType::ORGANIZATIONAL_UNIT:
-            return "ORGANIZATIONAL_UNIT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForParentType(ParentType enumValue)
+        {
+          return GetNameForParentTypeCStr(enumValue);
         }
 
       } // namespace ParentTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PolicyTypeStatusMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int PENDING_ENABLE_HASH = HashingUtils::HashString("PENDING_ENABLE");
-        static const int PENDING_DISABLE_HASH = HashingUtils::HashString("PENDING_DISABLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLED",
+          "PENDING_ENABLE",
+          "PENDING_DISABLE",
+        };
 
         PolicyTypeStatus GetPolicyTypeStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
-          {
-            return PolicyTypeStatus::ENABLED;
-          }
-          else if (hashCode == PENDING_ENABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PolicyTypeStatus::PENDING_ENABLE;
-          }
-          else if (hashCode == PENDING_DISABLE_HASH)
-          {
-            return PolicyTypeStatus::PENDING_DISABLE;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return PolicyTypeStatus::ENABLED;
+            }
+            break;
+          case -2074722997:
+            if (name == "PENDING_ENABLE")
+            {
+              return PolicyTypeStatus::PENDING_ENABLE;
+            }
+            break;
+          case -905968640:
+            if (name == "PENDING_DISABLE")
+            {
+              return PolicyTypeStatus::PENDING_DISABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PolicyTypeStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyTypeStatus(PolicyTypeStatus enumValue)
+        const char* GetNameForPolicyTypeStatusCStr(PolicyTypeStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PolicyTypeStatus::ENABLED:
-            return "ENABLED";
-          case PolicyTypeStatus::PENDING_ENABLE:
-            return "PENDING_ENABLE";
-          case PolicyTypeStatus::PENDING_DISABLE:
-            return "PENDING_DISABLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPolicyTypeStatus(PolicyTypeStatus enumValue)
+        {
+          return GetNameForPolicyTypeStatusCStr(enumValue);
         }
 
       } // namespace PolicyTypeStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TargetTypeMapper
       {
 
-        static const int ACCOUNT_HASH = HashingUtils::HashString("ACCOUNT");
-        static const int ORGANIZATIONAL_UNIT_HASH = HashingUtils::HashString("ORGANIZATIONAL_UNIT");
-        static const int ROOT_HASH = HashingUtils::HashString("ROOT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACCOUNT",
+          "ORGANIZATIONAL_UNIT",
+          "ROOT",
+        };
 
         TargetType GetTargetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_HASH)
-          {
-            return TargetType::ACCOUNT;
-          }
-          else if (hashCode == ORGANIZATIONAL_UNIT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TargetType::ORGANIZATIONAL_UNIT;
-          }
-          else if (hashCode == ROOT_HASH)
-          {
-            return TargetType::ROOT;
+          case -459336179:
+            if (name == "ACCOUNT")
+            {
+              return TargetType::ACCOUNT;
+            }
+            break;
+          case -1946787707:
+            if (name == "ORGANIZATIONAL_UNIT")
+            {
+              return TargetType::ORGANIZATIONAL_UNIT;
+            }
+            break;
+          case 2521314:
+            if (name == "ROOT")
+            {
+              return TargetType::ROOT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TargetType::NOT_SET;
         }
 
-        Aws::String GetNameForTargetType(TargetType enumValue)
+        const char* GetNameForTargetTypeCStr(TargetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TargetType::ACCOUNT:
-            return "ACCOUNT";
-          case TargetType::ORGANIZATIONAL_UNIT:
-            return "ORGANIZATIONAL_UNIT";
-          case TargetType::ROOT:
-            return "ROOT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTargetType(TargetType enumValue)
+        {
+          return GetNameForTargetTypeCStr(enumValue);
         }
 
       } // namespace TargetTypeMapper
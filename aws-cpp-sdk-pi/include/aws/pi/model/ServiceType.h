@@ -34,6 +34,11 @@ namespace ServiceTypeMapper
 AWS_PI_API ServiceType GetServiceTypeForName(const Aws::String& name);
 
 AWS_PI_API Aws::String GetNameForServiceType(ServiceType value);
+
+/**
+ * Same as GetNameForServiceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PI_API const char* GetNameForServiceTypeCStr(ServiceType value);
 } // namespace ServiceTypeMapper
 } // namespace Model
 } // namespace PI
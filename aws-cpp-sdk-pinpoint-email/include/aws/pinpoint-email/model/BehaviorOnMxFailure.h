@@ -35,6 +35,11 @@ namespace BehaviorOnMxFailureMapper
 AWS_PINPOINTEMAIL_API BehaviorOnMxFailure GetBehaviorOnMxFailureForName(const Aws::String& name);
 
 AWS_PINPOINTEMAIL_API Aws::String GetNameForBehaviorOnMxFailure(BehaviorOnMxFailure value);
+
+/**
+ * Same as GetNameForBehaviorOnMxFailure(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINTEMAIL_API const char* GetNameForBehaviorOnMxFailureCStr(BehaviorOnMxFailure value);
 } // namespace BehaviorOnMxFailureMapper
 } // namespace Model
 } // namespace PinpointEmail
@@ -35,6 +35,11 @@ namespace DeliverabilityTestStatusMapper
 AWS_PINPOINTEMAIL_API DeliverabilityTestStatus GetDeliverabilityTestStatusForName(const Aws::String& name);
 
 AWS_PINPOINTEMAIL_API Aws::String GetNameForDeliverabilityTestStatus(DeliverabilityTestStatus value);
+
+/**
+ * Same as GetNameForDeliverabilityTestStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINTEMAIL_API const char* GetNameForDeliverabilityTestStatusCStr(DeliverabilityTestStatus value);
 } // namespace DeliverabilityTestStatusMapper
 } // namespace Model
 } // namespace PinpointEmail
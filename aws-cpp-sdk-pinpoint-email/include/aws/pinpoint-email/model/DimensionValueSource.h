@@ -36,6 +36,11 @@ namespace DimensionValueSourceMapper
 AWS_PINPOINTEMAIL_API DimensionValueSource GetDimensionValueSourceForName(const Aws::String& name);
 
 AWS_PINPOINTEMAIL_API Aws::String GetNameForDimensionValueSource(DimensionValueSource value);
+
+/**
+ * Same as GetNameForDimensionValueSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINTEMAIL_API const char* GetNameForDimensionValueSourceCStr(DimensionValueSource value);
 } // namespace DimensionValueSourceMapper
 } // namespace Model
 } // namespace PinpointEmail
@@ -38,6 +38,11 @@ namespace DkimStatusMapper
 AWS_PINPOINTEMAIL_API DkimStatus GetDkimStatusForName(const Aws::String& name);
 
 AWS_PINPOINTEMAIL_API Aws::String GetNameForDkimStatus(DkimStatus value);
+
+/**
+ * Same as GetNameForDkimStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINTEMAIL_API const char* GetNameForDkimStatusCStr(DkimStatus value);
 } // namespace DkimStatusMapper
 } // namespace Model
 } // namespace PinpointEmail
@@ -37,6 +37,11 @@ namespace MailFromDomainStatusMapper
 AWS_PINPOINTEMAIL_API MailFromDomainStatus GetMailFromDomainStatusForName(const Aws::String& name);
 
 AWS_PINPOINTEMAIL_API Aws::String GetNameForMailFromDomainStatus(MailFromDomainStatus value);
+
+/**
+ * Same as GetNameForMailFromDomainStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINTEMAIL_API const char* GetNameForMailFromDomainStatusCStr(MailFromDomainStatus value);
 } // namespace MailFromDomainStatusMapper
 } // namespace Model
 } // namespace PinpointEmail
@@ -35,6 +35,11 @@ namespace WarmupStatusMapper
 AWS_PINPOINTEMAIL_API WarmupStatus GetWarmupStatusForName(const Aws::String& name);
 
 AWS_PINPOINTEMAIL_API Aws::String GetNameForWarmupStatus(WarmupStatus value);
+
+/**
+ * Same as GetNameForWarmupStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINTEMAIL_API const char* GetNameForWarmupStatusCStr(WarmupStatus value);
 } // namespace WarmupStatusMapper
 } // namespace Model
 } // namespace PinpointEmail
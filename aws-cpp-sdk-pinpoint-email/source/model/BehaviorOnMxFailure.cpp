@@ -30,20 +30,37 @@ namespace Aws
       namespace BehaviorOnMxFailureMapper
       {
 
-        static const int USE_DEFAULT_VALUE_HASH = HashingUtils::HashString("USE_DEFAULT_VALUE");
-        static const int REJECT_MESSAGE_HASH = HashingUtils::HashString("REJECT_MESSAGE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USE_DEFAULT_VALUE",
+          "REJECT_MESSAGE",
+        };
 
         BehaviorOnMxFailure GetBehaviorOnMxFailureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USE_DEFAULT_VALUE_HASH)
-          {
-            return BehaviorOnMxFailure::USE_DEFAULT_VALUE;
-          }
-          else if (hashCode == REJECT_MESSAGE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BehaviorOnMxFailure::REJECT_MESSAGE;
+          case 857054427:
+            if (name == "USE_DEFAULT_VALUE")
+            {
+              return BehaviorOnMxFailure::USE_DEFAULT_VALUE;
+            }
+            break;
+          case -2092135609:
+            if (name == "REJECT_MESSAGE")
+            {
+              return BehaviorOnMxFailure::REJECT_MESSAGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BehaviorOnMxFailure::NOT_SET;
         }
 
-        Aws::String GetNameForBehaviorOnMxFailure(BehaviorOnMxFailure enumValue)
+        const char* GetNameForBehaviorOnMxFailureCStr(BehaviorOnMxFailure enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BehaviorOnMxFailure::USE_DEFAULT_VALUE:
-            return "USE_DEFAULT_VALUE";
-          case BehaviorOnMxFailure::REJECT_MESSAGE:
-            return "REJECT_MESSAGE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBehaviorOnMxFailure(BehaviorOnMxFailure enumValue)
+        {
+          return GetNameForBehaviorOnMxFailureCStr(enumValue);
         }
 
       } // namespace BehaviorOnMxFailureMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DeliverabilityTestStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "COMPLETED",
+        };
 
         DeliverabilityTestStatus GetDeliverabilityTestStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return DeliverabilityTestStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeliverabilityTestStatus::COMPLETED;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return DeliverabilityTestStatus::IN_PROGRESS;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return DeliverabilityTestStatus::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DeliverabilityTestStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeliverabilityTestStatus(DeliverabilityTestStatus enumValue)
+        const char* GetNameForDeliverabilityTestStatusCStr(DeliverabilityTestStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeliverabilityTestStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case DeliverabilityTestStatus::COMPLETED:
-            return "COMPLETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeliverabilityTestStatus(DeliverabilityTestStatus enumValue)
+        {
+          return GetNameForDeliverabilityTestStatusCStr(enumValue);
         }
 
       } // namespace DeliverabilityTestStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DimensionValueSourceMapper
       {
 
-        static const int MESSAGE_TAG_HASH = HashingUtils::HashString("MESSAGE_TAG");
-        static const int EMAIL_HEADER_HASH = HashingUtils::HashString("EMAIL_HEADER");
-        static const int LINK_TAG_HASH = HashingUtils::HashString("LINK_TAG");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MESSAGE_TAG",
+          "EMAIL_HEADER",
+          "LINK_TAG",
+        };
 
         DimensionValueSource GetDimensionValueSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MESSAGE_TAG_HASH)
-          {
-            return DimensionValueSource::MESSAGE_TAG;
-          }
-          else if (hashCode == EMAIL_HEADER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DimensionValueSource::EMAIL_HEADER;
-          }
-          else if (hashCode == LINK_TAG_HASH)
-          {
-            return DimensionValueSource::LINK_TAG;
+          case 1281143586:
+            if (name == "MESSAGE_TAG")
+            {
+              return DimensionValueSource::MESSAGE_TAG;
+            }
+            break;
+          case 551935152:
+            if (name == "EMAIL_HEADER")
+            {
+              return DimensionValueSource::EMAIL_HEADER;
+            }
+            break;
+          case 1978109365:
+            if (name == "LINK_TAG")
+            {
+              return DimensionValueSource::LINK_TAG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DimensionValueSource::NOT_SET;
         }
 
-        Aws::String GetNameForDimensionValueSource(DimensionValueSource enumValue)
+        const char* GetNameForDimensionValueSourceCStr(DimensionValueSource enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DimensionValueSource::MESSAGE_TAG:
-            return "MESSAGE_TAG";
-          case DimensionValueSource::EMAIL_HEADER:
-            return "EMAIL_HEADER";
-          case DimensionValueSource::LINK_TAG:
-            return "LINK_TAG";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDimensionValueSource(DimensionValueSource enumValue)
+        {
+          return GetNameForDimensionValueSourceCStr(enumValue);
         }
 
       } // namespace DimensionValueSourceMapper
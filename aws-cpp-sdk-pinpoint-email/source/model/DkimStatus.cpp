@@ -30,35 +30,58 @@ namespace Aws
       namespace DkimStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int TEMPORARY_FAILURE_HASH = HashingUtils::HashString("TEMPORARY_FAILURE");
-        static const int NOT_STARTED_HASH = HashingUtils::HashString("NOT_STARTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "SUCCESS",
+          "FAILED",
+          "TEMPORARY_FAILURE",
+          "NOT_STARTED",
+        };
 
         DkimStatus GetDkimStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DkimStatus::PENDING;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return DkimStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return DkimStatus::FAILED;
-          }
-          else if (hashCode == TEMPORARY_FAILURE_HASH)
-          {
-            return DkimStatus::TEMPORARY_FAILURE;
-          }
-          else if (hashCode == NOT_STARTED_HASH)
-          {
-            return DkimStatus::NOT_STARTED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return DkimStatus::PENDING;
+            }
+            break;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return DkimStatus::SUCCESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return DkimStatus::FAILED;
+            }
+            break;
+          case 27996508:
+            if (name == "TEMPORARY_FAILURE")
+            {
+              return DkimStatus::TEMPORARY_FAILURE;
+            }
+            break;
+          case -1391247659:
+            if (name == "NOT_STARTED")
+            {
+              return DkimStatus::NOT_STARTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return DkimStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDkimStatus(DkimStatus enumValue)
+        const char* GetNameForDkimStatusCStr(DkimStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DkimStatus::PENDING:
-            return "PENDING";
-          case DkimStatus::SUCCESS:
-            return "SUCCESS";
-          case DkimStatus::FAILED:
-            return "FAILED";
-          case DkimStatus::TEMPORARY_FAILURE:
-            return "TEMPORARY_FAILURE";
-          case DkimStatus::NOT_STARTED:
-            return "NOT_STARTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDkimStatus(DkimStatus enumValue)
+        {
+          return GetNameForDkimStatusCStr(enumValue);
         }
 
       } // namespace DkimStatusMapper
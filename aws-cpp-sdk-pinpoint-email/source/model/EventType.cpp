@@ -30,50 +30,79 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int SEND_HASH = HashingUtils::HashString("SEND");
-        static const int REJECT_HASH = HashingUtils::HashString("REJECT");
-        static const int BOUNCE_HASH = HashingUtils::HashString("BOUNCE");
-        static const int COMPLAINT_HASH = HashingUtils::HashString("COMPLAINT");
-        static const int DELIVERY_HASH = HashingUtils::HashString("DELIVERY");
-        static const int OPEN_HASH = HashingUtils::HashString("OPEN");
-        static const int CLICK_HASH = HashingUtils::HashString("CLICK");
-        static const int RENDERING_FAILURE_HASH = HashingUtils::HashString("RENDERING_FAILURE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SEND",
+          "REJECT",
+          "BOUNCE",
+          "COMPLAINT",
+          "DELIVERY",
+          "OPEN",
+          "CLICK",
+          "RENDERING_FAILURE",
+        };
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SEND_HASH)
-          {
-            return EventType::SEND;
-          }
-          else if (hashCode == REJECT_HASH)
-          {
-            return EventType::REJECT;
-          }
-          else if (hashCode == BOUNCE_HASH)
-          {
-            return EventType::BOUNCE;
-          }
-          else if (hashCode == COMPLAINT_HASH)
-          {
-            return EventType::COMPLAINT;
-          }
-          else if (hashCode == DELIVERY_HASH)
-          {
-            return EventType::DELIVERY;
-          }
-          else if (hashCode == OPEN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventType::OPEN;
-          }
-          else if (hashCode == CLICK_HASH)
-          {
-            return EventType::CLICK;
-          }
-          else if (hashCode == RENDERING_FAILURE_HASH)
-          {
-            return EventType::RENDERING_FAILURE;
+          case 2541448:
+            if (name == "SEND")
+            {
+              return EventType::SEND;
+            }
+            break;
+          case -1881380961:
+            if (name == "REJECT")
+            {
+              return EventType::REJECT;
+            }
+            break;
+          case 1965091464:
+            if (name == "BOUNCE")
+            {
+              return EventType::BOUNCE;
+            }
+            break;
+          case 1383533707:
+            if (name == "COMPLAINT")
+            {
+              return EventType::COMPLAINT;
+            }
+            break;
+          case 1606093812:
+            if (name == "DELIVERY")
+            {
+              return EventType::DELIVERY;
+            }
+            break;
+          case 2432586:
+            if (name == "OPEN")
+            {
+              return EventType::OPEN;
+            }
+            break;
+          case 64212328:
+            if (name == "CLICK")
+            {
+              return EventType::CLICK;
+            }
+            break;
+          case 1004482199:
+            if (name == "RENDERING_FAILURE")
+            {
+              return EventType::RENDERING_FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventTypeCStr(EventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventType::SEND:
-            return "SEND";
-          case EventType::REJECT:
-            return "REJECT";
-          case EventType::BOUNCE:
-            return "BOUNCE";
-          case EventType::COMPLAINT:
-            return "COMPLAINT";
-          case EventType::DELIVERY:
-            return "DELIVERY";
-          case EventType::OPEN:
-            return "OPEN";
-          case EventType::CLICK:
-            return "CLICK";
-          case EventType::RENDERING_FAILURE:
-            return "RENDERING_FAILURE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventType(EventType enumValue)
+        {
+          return GetNameForEventTypeCStr(enumValue);
         }
 
       } // namespace EventTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace IdentityTypeMapper
       {
 
-        static const int EMAIL_ADDRESS_HASH = HashingUtils::HashString("EMAIL_ADDRESS");
-        static const int DOMAIN__HASH = HashingUtils::HashString("DOMAIN");
-        static const int MANAGED_DOMAIN_HASH = HashingUtils::HashString("MANAGED_DOMAIN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EMAIL_ADDRESS",
+          "DOMAIN",
+          "MANAGED_DOMAIN",
+        };
 
         IdentityType GetIdentityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EMAIL_ADDRESS_HASH)
-          {
-            return IdentityType::EMAIL_ADDRESS;
-          }
-          else if (hashCode == DOMAIN__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IdentityType::DOMAIN_;
-          }
-          else if (hashCode == MANAGED_DOMAIN_HASH)
-          {
-            return IdentityType::MANAGED_DOMAIN;
+          case -2012879343:
+            if (name == "EMAIL_ADDRESS")
+            {
+              return IdentityType::EMAIL_ADDRESS;
+            }
+            break;
+          case 2022099140:
+            if (name == "DOMAIN")
+            {
+              return IdentityType::DOMAIN_;
+            }
+            break;
+          case 230886788:
+            if (name == "MANAGED_DOMAIN")
+            {
+              return IdentityType::MANAGED_DOMAIN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return IdentityType::NOT_SET;
         }
 
-        Aws::String GetNameForIdentityType(IdentityType enumValue)
+        const char* GetNameForIdentityTypeCStr(IdentityType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IdentityType::EMAIL_ADDRESS:
-            return "EMAIL_ADDRESS";
-          case IdentityType::DOMAIN_:
-            return "DOMAIN";
-          case IdentityType::MANAGED_DOMAIN:
-            return "MANAGED_DOMAIN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIdentityType(IdentityType enumValue)
+        {
+          return GetNameForIdentityTypeCStr(enumValue);
         }
 
       } // namespace IdentityTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace MailFromDomainStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int TEMPORARY_FAILURE_HASH = HashingUtils::HashString("TEMPORARY_FAILURE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "SUCCESS",
+          "FAILED",
+          "TEMPORARY_FAILURE",
+        };
 
         MailFromDomainStatus GetMailFromDomainStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return MailFromDomainStatus::PENDING;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return MailFromDomainStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return MailFromDomainStatus::FAILED;
-          }
-          else if (hashCode == TEMPORARY_FAILURE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MailFromDomainStatus::TEMPORARY_FAILURE;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return MailFromDomainStatus::PENDING;
+            }
+            break;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return MailFromDomainStatus::SUCCESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return MailFromDomainStatus::FAILED;
+            }
+            break;
+          case 27996508:
+            if (name == "TEMPORARY_FAILURE")
+            {
+              return MailFromDomainStatus::TEMPORARY_FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return MailFromDomainStatus::NOT_SET;
         }
 
-        Aws::String GetNameForMailFromDomainStatus(MailFromDomainStatus enumValue)
+        const char* GetNameForMailFromDomainStatusCStr(MailFromDomainStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MailFromDomainStatus::PENDING:
-            return "PENDING";
-          case MailFromDomainStatus::SUCCESS:
-            return "SUCCESS";
-          case MailFromDomainStatus::FAILED:
-            return "FAILED";
-          case MailFromDomainStatus::TEMPORARY_FAILURE:
-            return "TEMPORARY_FAILURE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMailFromDomainStatus(MailFromDomainStatus enumValue)
+        {
+          return GetNameForMailFromDomainStatusCStr(enumValue);
         }
 
       } // namespace MailFromDomainStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace WarmupStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int DONE_HASH = HashingUtils::HashString("DONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "DONE",
+        };
 
         WarmupStatus GetWarmupStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return WarmupStatus::IN_PROGRESS;
-          }
-          else if (hashCode == DONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WarmupStatus::DONE;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return WarmupStatus::IN_PROGRESS;
+            }
+            break;
+          case 2104194:
+            if (name == "DONE")
+            {
+              return WarmupStatus::DONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return WarmupStatus::NOT_SET;
         }
 
-        Aws::String GetNameForWarmupStatus(WarmupStatus enumValue)
+        const char* GetNameForWarmupStatusCStr(WarmupStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WarmupStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case WarmupStatus::DONE:
-            return "DONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWarmupStatus(WarmupStatus enumValue)
+        {
+          return GetNameForWarmupStatusCStr(enumValue);
         }
 
       } // namespace WarmupStatusMapper
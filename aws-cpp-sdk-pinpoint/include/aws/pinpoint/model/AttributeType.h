@@ -35,6 +35,11 @@ namespace AttributeTypeMapper
 AWS_PINPOINT_API AttributeType GetAttributeTypeForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForAttributeType(AttributeType value);
+
+/**
+ * Same as GetNameForAttributeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForAttributeTypeCStr(AttributeType value);
 } // namespace AttributeTypeMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -39,6 +39,11 @@ namespace CampaignStatusMapper
 AWS_PINPOINT_API CampaignStatus GetCampaignStatusForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForCampaignStatus(CampaignStatus value);
+
+/**
+ * Same as GetNameForCampaignStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForCampaignStatusCStr(CampaignStatus value);
 } // namespace CampaignStatusMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -35,6 +35,11 @@ namespace DimensionTypeMapper
 AWS_PINPOINT_API DimensionType GetDimensionTypeForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForDimensionType(DimensionType value);
+
+/**
+ * Same as GetNameForDimensionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForDimensionTypeCStr(DimensionType value);
 } // namespace DimensionTypeMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -37,6 +37,11 @@ namespace DurationMapper
 AWS_PINPOINT_API Duration GetDurationForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForDuration(Duration value);
+
+/**
+ * Same as GetNameForDuration(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForDurationCStr(Duration value);
 } // namespace DurationMapper
 } // namespace Model
 } // namespace Pinpoint
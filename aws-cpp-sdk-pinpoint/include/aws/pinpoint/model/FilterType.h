@@ -35,6 +35,11 @@ namespace FilterTypeMapper
 AWS_PINPOINT_API FilterType GetFilterTypeForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForFilterType(FilterType value);
+
+/**
+ * Same as GetNameForFilterType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForFilterTypeCStr(FilterType value);
 } // namespace FilterTypeMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -35,6 +35,11 @@ namespace FormatMapper
 AWS_PINPOINT_API Format GetFormatForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForFormat(Format value);
+
+/**
+ * Same as GetNameForFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForFormatCStr(Format value);
 } // namespace FormatMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -39,6 +39,11 @@ namespace FrequencyMapper
 AWS_PINPOINT_API Frequency GetFrequencyForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForFrequency(Frequency value);
+
+/**
+ * Same as GetNameForFrequency(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForFrequencyCStr(Frequency value);
 } // namespace FrequencyMapper
 } // namespace Model
 } // namespace Pinpoint
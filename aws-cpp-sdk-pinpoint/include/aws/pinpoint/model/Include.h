@@ -36,6 +36,11 @@ namespace IncludeMapper
 AWS_PINPOINT_API Include GetIncludeForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForInclude(Include value);
+
+/**
+ * Same as GetNameForInclude(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForIncludeCStr(Include value);
 } // namespace IncludeMapper
 } // namespace Model
 } // namespace Pinpoint
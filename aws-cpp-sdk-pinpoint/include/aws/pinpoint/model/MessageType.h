@@ -35,6 +35,11 @@ namespace MessageTypeMapper
 AWS_PINPOINT_API MessageType GetMessageTypeForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForMessageType(MessageType value);
+
+/**
+ * Same as GetNameForMessageType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForMessageTypeCStr(MessageType value);
 } // namespace MessageTypeMapper
 } // namespace Model
 } // namespace Pinpoint
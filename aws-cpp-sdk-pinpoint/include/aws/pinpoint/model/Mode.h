@@ -35,6 +35,11 @@ namespace ModeMapper
 AWS_PINPOINT_API Mode GetModeForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForMode(Mode value);
+
+/**
+ * Same as GetNameForMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForModeCStr(Mode value);
 } // namespace ModeMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -35,6 +35,11 @@ namespace RecencyTypeMapper
 AWS_PINPOINT_API RecencyType GetRecencyTypeForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForRecencyType(RecencyType value);
+
+/**
+ * Same as GetNameForRecencyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForRecencyTypeCStr(RecencyType value);
 } // namespace RecencyTypeMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -35,6 +35,11 @@ namespace SegmentTypeMapper
 AWS_PINPOINT_API SegmentType GetSegmentTypeForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForSegmentType(SegmentType value);
+
+/**
+ * Same as GetNameForSegmentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForSegmentTypeCStr(SegmentType value);
 } // namespace SegmentTypeMapper
 } // namespace Model
 } // namespace Pinpoint
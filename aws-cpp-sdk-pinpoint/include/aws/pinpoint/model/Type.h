@@ -36,6 +36,11 @@ namespace TypeMapper
 AWS_PINPOINT_API Type GetTypeForName(const Aws::String& name);
 
 AWS_PINPOINT_API Aws::String GetNameForType(Type value);
+
+/**
+ * Same as GetNameForType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINT_API const char* GetNameForTypeCStr(Type value);
 } // namespace TypeMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -30,25 +30,44 @@ namespace Aws
       namespace ActionMapper
       {
 
-        static const int OPEN_APP_HASH = HashingUtils::HashString("OPEN_APP");
-        static const int DEEP_LINK_HASH = HashingUtils::HashString("DEEP_LINK");
-        static const int URL_HASH = HashingUtils::HashString("URL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OPEN_APP",
+          "DEEP_LINK",
+          "URL",
+        };
 
         Action GetActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OPEN_APP_HASH)
-          {
-            return Action::OPEN_APP;
-          }
-          else if (hashCode == DEEP_LINK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Action::DEEP_LINK;
-          }
-          else if (hashCode == URL_HASH)
-          {
-            return Action::URL;
+          case 279254668:
+            if (name == "OPEN_APP")
+            {
+              return Action::OPEN_APP;
+            }
+            break;
+          case 835624813:
+            if (name == "DEEP_LINK")
+            {
+              return Action::DEEP_LINK;
+            }
+            break;
+          case 84303:
+            if (name == "URL")
+            {
+              return Action::URL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Action::NOT_SET;
         }
 
-        Aws::String GetNameForAction(Action enumValue)
+        const char* GetNameForActionCStr(Action enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Action::OPEN_APP:
-            return "OPEN_APP";
-          case Action::DEEP_LINK:
-            return "DEEP_LINK";
-          case Action::URL:
-            return "URL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAction(Action enumValue)
+        {
+          return GetNameForActionCStr(enumValue);
         }
 
       } // namespace ActionMapper
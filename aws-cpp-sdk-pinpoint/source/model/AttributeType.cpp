@@ -30,20 +30,37 @@ namespace Aws
       namespace AttributeTypeMapper
       {
 
-        static const int INCLUSIVE_HASH = HashingUtils::HashString("INCLUSIVE");
-        static const int EXCLUSIVE_HASH = HashingUtils::HashString("EXCLUSIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INCLUSIVE",
+          "EXCLUSIVE",
+        };
 
         AttributeType GetAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INCLUSIVE_HASH)
-          {
-            return AttributeType::INCLUSIVE;
-          }
-          else if (hashCode == EXCLUSIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AttributeType::EXCLUSIVE;
+          case 1290127820:
+            if (name == "INCLUSIVE")
+            {
+              return AttributeType::INCLUSIVE;
+            }
+            break;
+          case 178245246:
+            if (name == "EXCLUSIVE")
+            {
+              return AttributeType::EXCLUSIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForAttributeType(AttributeType enumValue)
+        const char* GetNameForAttributeTypeCStr(AttributeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AttributeType::INCLUSIVE:
-            return "INCLUSIVE";
-          case AttributeType::EXCLUSIVE:
-            return "EXCLUSIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAttributeType(AttributeType enumValue)
+        {
+          return GetNameForAttributeTypeCStr(enumValue);
         }
 
       } // namespace AttributeTypeMapper
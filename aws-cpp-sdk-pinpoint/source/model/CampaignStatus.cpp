@@ -30,40 +30,65 @@ namespace Aws
       namespace CampaignStatusMapper
       {
 
-        static const int SCHEDULED_HASH = HashingUtils::HashString("SCHEDULED");
-        static const int EXECUTING_HASH = HashingUtils::HashString("EXECUTING");
-        static const int PENDING_NEXT_RUN_HASH = HashingUtils::HashString("PENDING_NEXT_RUN");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int PAUSED_HASH = HashingUtils::HashString("PAUSED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SCHEDULED",
+          "EXECUTING",
+          "PENDING_NEXT_RUN",
+          "COMPLETED",
+          "PAUSED",
+          "DELETED",
+        };
 
         CampaignStatus GetCampaignStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SCHEDULED_HASH)
-          {
-            return CampaignStatus::SCHEDULED;
-          }
-          else if (hashCode == EXECUTING_HASH)
-          {
-            return CampaignStatus::EXECUTING;
-          }
-          else if (hashCode == PENDING_NEXT_RUN_HASH)
-          {
-            return CampaignStatus::PENDING_NEXT_RUN;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return CampaignStatus::COMPLETED;
-          }
-          else if (hashCode == PAUSED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CampaignStatus::PAUSED;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return CampaignStatus::DELETED;
+          case -1669082995:
+            if (name == "SCHEDULED")
+            {
+              return CampaignStatus::SCHEDULED;
+            }
+            break;
+          case 1695619794:
+            if (name == "EXECUTING")
+            {
+              return CampaignStatus::EXECUTING;
+            }
+            break;
+          case -1160474393:
+            if (name == "PENDING_NEXT_RUN")
+            {
+              return CampaignStatus::PENDING_NEXT_RUN;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return CampaignStatus::COMPLETED;
+            }
+            break;
+          case -1941992146:
+            if (name == "PAUSED")
+            {
+              return CampaignStatus::PAUSED;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return CampaignStatus::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return CampaignStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCampaignStatus(CampaignStatus enumValue)
+        const char* GetNameForCampaignStatusCStr(CampaignStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CampaignStatus::SCHEDULED:
-            return "SCHEDULED";
-          case CampaignStatus::EXECUTING:
-            return "EXECUTING";
-          case CampaignStatus::PENDING_NEXT_RUN:
-            return "PENDING_NEXT_RUN";
-          case CampaignStatus::COMPLETED:
-            return "COMPLETED";
-          case CampaignStatus::PAUSED:
-            return "PAUSED";
-          case CampaignStatus::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCampaignStatus(CampaignStatus enumValue)
+        {
+          return GetNameForCampaignStatusCStr(enumValue);
         }
 
       } // namespace CampaignStatusMapper
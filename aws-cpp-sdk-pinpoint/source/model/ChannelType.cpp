@@ -30,65 +30,100 @@ namespace Aws
       namespace ChannelTypeMapper
       {
 
-        static const int GCM_HASH = HashingUtils::HashString("GCM");
-        static const int APNS_HASH = HashingUtils::HashString("APNS");
-        static const int APNS_SANDBOX_HASH = HashingUtils::HashString("APNS_SANDBOX");
-        static const int APNS_VOIP_HASH = HashingUtils::HashString("APNS_VOIP");
-        static const int APNS_VOIP_SANDBOX_HASH = HashingUtils::HashString("APNS_VOIP_SANDBOX");
-        static const int ADM_HASH = HashingUtils::HashString("ADM");
-        static const int SMS_HASH = HashingUtils::HashString("SMS");
-        static const int VOICE_HASH = HashingUtils::HashString("VOICE");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
-        static const int BAIDU_HASH = HashingUtils::HashString("BAIDU");
-        static const int CUSTOM_HASH = HashingUtils::HashString("CUSTOM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GCM",
+          "APNS",
+          "APNS_SANDBOX",
+          "APNS_VOIP",
+          "APNS_VOIP_SANDBOX",
+          "ADM",
+          "SMS",
+          "VOICE",
+          "EMAIL",
+          "BAIDU",
+          "CUSTOM",
+        };
 
         ChannelType GetChannelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GCM_HASH)
-          {
-            return ChannelType::GCM;
-          }
-          else if (hashCode == APNS_HASH)
-          {
-            return ChannelType::APNS;
-          }
-          else if (hashCode == APNS_SANDBOX_HASH)
-          {
-            return ChannelType::APNS_SANDBOX;
-          }
-          else if (hashCode == APNS_VOIP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChannelType::APNS_VOIP;
-          }
-          else if (hashCode == APNS_VOIP_SANDBOX_HASH)
-          {
-            return ChannelType::APNS_VOIP_SANDBOX;
-          }
-          else if (hashCode == ADM_HASH)
-          {
-            return ChannelType::ADM;
-          }
-          else if (hashCode == SMS_HASH)
-          {
-            return ChannelType::SMS;
-          }
-          else if (hashCode == VOICE_HASH)
-          {
-            return ChannelType::VOICE;
-          }
-          else if (hashCode == EMAIL_HASH)
-          {
-            return ChannelType::EMAIL;
-          }
-          else if (hashCode == BAIDU_HASH)
-          {
-            return ChannelType::BAIDU;
-          }
-          else if (hashCode == CUSTOM_HASH)
-          {
-            return ChannelType::CUSTOM;
+          case 70385:
+            if (name == "GCM")
+            {
+              return ChannelType::GCM;
+            }
+            break;
+          case 2015796:
+            if (name == "APNS")
+            {
+              return ChannelType::APNS;
+            }
+            break;
+          case 581844892:
+            if (name == "APNS_SANDBOX")
+            {
+              return ChannelType::APNS_SANDBOX;
+            }
+            break;
+          case -857112373:
+            if (name == "APNS_VOIP")
+            {
+              return ChannelType::APNS_VOIP;
+            }
+            break;
+          case -1002932429:
+            if (name == "APNS_VOIP_SANDBOX")
+            {
+              return ChannelType::APNS_VOIP_SANDBOX;
+            }
+            break;
+          case 64650:
+            if (name == "ADM")
+            {
+              return ChannelType::ADM;
+            }
+            break;
+          case 82233:
+            if (name == "SMS")
+            {
+              return ChannelType::SMS;
+            }
+            break;
+          case 81848594:
+            if (name == "VOICE")
+            {
+              return ChannelType::VOICE;
+            }
+            break;
+          case 66081660:
+            if (name == "EMAIL")
+            {
+              return ChannelType::EMAIL;
+            }
+            break;
+          case 62961147:
+            if (name == "BAIDU")
+            {
+              return ChannelType::BAIDU;
+            }
+            break;
+          case 1999208305:
+            if (name == "CUSTOM")
+            {
+              return ChannelType::CUSTOM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return ChannelType::NOT_SET;
         }
 
-        Aws::String GetNameForChannelType(ChannelType enumValue)
+        const char* GetNameForChannelTypeCStr(ChannelType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChannelType::GCM:
-            return "GCM";
-          case ChannelType::APNS:
-            return "APNS";
-          case ChannelType::APNS_SANDBOX:
-            return "APNS_SANDBOX";
-          case ChannelType::APNS_VOIP:
-            return "APNS_VOIP";
-          case ChannelType::APNS_VOIP_SANDBOX:
-            return "APNS_VOIP_SANDBOX";
-          case ChannelType::ADM:
-            return "ADM";
-          case ChannelType::SMS:
-            return "SMS";
-          case ChannelType::VOICE:
-            return "VOICE";
-          case ChannelType::EMAIL:
-            return "EMAIL";
-          case ChannelType::BAIDU:
-            return "BAIDU";
-          case ChannelType::CUSTOM:
-            return "CUSTOM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChannelType(ChannelType enumValue)
+        {
+          return GetNameForChannelTypeCStr(enumValue);
         }
 
       } // namespace ChannelTypeMapper
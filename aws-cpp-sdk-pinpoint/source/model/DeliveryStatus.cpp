@@ -30,45 +30,72 @@ namespace Aws
       namespace DeliveryStatusMapper
       {
 
-        static const int SUCCESSFUL_HASH = HashingUtils::HashString("SUCCESSFUL");
-        static const int THROTTLED_HASH = HashingUtils::HashString("THROTTLED");
-        static const int TEMPORARY_FAILURE_HASH = HashingUtils::HashString("TEMPORARY_FAILURE");
-        static const int PERMANENT_FAILURE_HASH = HashingUtils::HashString("PERMANENT_FAILURE");
-        static const int UNKNOWN_FAILURE_HASH = HashingUtils::HashString("UNKNOWN_FAILURE");
-        static const int OPT_OUT_HASH = HashingUtils::HashString("OPT_OUT");
-        static const int DUPLICATE_HASH = HashingUtils::HashString("DUPLICATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCESSFUL",
+          "THROTTLED",
+          "TEMPORARY_FAILURE",
+          "PERMANENT_FAILURE",
+          "UNKNOWN_FAILURE",
+          "OPT_OUT",
+          "DUPLICATE",
+        };
 
         DeliveryStatus GetDeliveryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESSFUL_HASH)
-          {
-            return DeliveryStatus::SUCCESSFUL;
-          }
-          else if (hashCode == THROTTLED_HASH)
-          {
-            return DeliveryStatus::THROTTLED;
-          }
-          else if (hashCode == TEMPORARY_FAILURE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeliveryStatus::TEMPORARY_FAILURE;
-          }
-          else if (hashCode == PERMANENT_FAILURE_HASH)
-          {
-            return DeliveryStatus::PERMANENT_FAILURE;
-          }
-          else if (hashCode == UNKNOWN_FAILURE_HASH)
-          {
-            return DeliveryStatus::UNKNOWN_FAILURE;
-          }
-          else if (hashCode == OPT_OUT_HASH)
-          {
-            return DeliveryStatus::OPT_OUT;
-          }
-          else if (hashCode == DUPLICATE_HASH)
-          {
-            return DeliveryStatus::DUPLICATE;
+          case -248539494:
+            if (name == "SUCCESSFUL")
+            {
+              return DeliveryStatus::SUCCESSFUL;
+            }
+            break;
+          case 1528687194:
+            if (name == "THROTTLED")
+            {
+              return DeliveryStatus::THROTTLED;
+            }
+            break;
+          case 27996508:
+            if (name == "TEMPORARY_FAILURE")
+            {
+              return DeliveryStatus::TEMPORARY_FAILURE;
+            }
+            break;
+          case 1306090169:
+            if (name == "PERMANENT_FAILURE")
+            {
+              return DeliveryStatus::PERMANENT_FAILURE;
+            }
+            break;
+          case 2062209621:
+            if (name == "UNKNOWN_FAILURE")
+            {
+              return DeliveryStatus::UNKNOWN_FAILURE;
+            }
+            break;
+          case -530836606:
+            if (name == "OPT_OUT")
+            {
+              return DeliveryStatus::OPT_OUT;
+            }
+            break;
+          case -306684693:
+            if (name == "DUPLICATE")
+            {
+              return DeliveryStatus::DUPLICATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return DeliveryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeliveryStatus(DeliveryStatus enumValue)
+        const char* GetNameForDeliveryStatusCStr(DeliveryStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeliveryStatus::SUCCESSFUL:
-            return "SUCCESSFUL";
-          case DeliveryStatus::THROTTLED:
-            return "THROTTLED";
-          case DeliveryStatus::TEMPORARY_FAILURE:
-            return "TEMPORARY_FAILURE";
-          case DeliveryStatus::PERMANENT_FAILURE:
-            return "PERMANENT_FAILURE";
-          case DeliveryStatus::UNKNOWN_FAILURE:
-            return "UNKNOWN_FAILURE";
-          case DeliveryStatus::OPT_OUT:
-            return "OPT_OUT";
-          case DeliveryStatus::DUPLICATE:
-            return "DUPLICATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeliveryStatus(DeliveryStatus enumValue)
+        {
+          return GetNameForDeliveryStatusCStr(enumValue);
         }
 
       } // namespace DeliveryStatusMapper
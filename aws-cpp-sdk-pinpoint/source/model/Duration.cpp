@@ -30,30 +30,51 @@ namespace Aws
       namespace DurationMapper
       {
 
-        static const int HR_24_HASH = HashingUtils::HashString("HR_24");
-        static const int DAY_7_HASH = HashingUtils::HashString("DAY_7");
-        static const int DAY_14_HASH = HashingUtils::HashString("DAY_14");
-        static const int DAY_30_HASH = HashingUtils::HashString("DAY_30");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HR_24",
+          "DAY_7",
+          "DAY_14",
+          "DAY_30",
+        };
 
         Duration GetDurationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HR_24_HASH)
-          {
-            return Duration::HR_24;
-          }
-          else if (hashCode == DAY_7_HASH)
-          {
-            return Duration::DAY_7;
-          }
-          else if (hashCode == DAY_14_HASH)
-          {
-            return Duration::DAY_14;
-          }
-          else if (hashCode == DAY_30_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Duration::DAY_30;
+          case 69029271:
+            if (name == "HR_24")
+            {
+              return Duration::HR_24;
+            }
+            break;
+          case 64824372:
+            if (name == "DAY_7")
+            {
+              return Duration::DAY_7;
+            }
+            break;
+          case 2009555398:
+            if (name == "DAY_14")
+            {
+              return Duration::DAY_14;
+            }
+            break;
+          case 2009555456:
+            if (name == "DAY_30")
+            {
+              return Duration::DAY_30;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Duration::NOT_SET;
         }
 
-        Aws::String GetNameForDuration(Duration enumValue)
+        const char* GetNameForDurationCStr(Duration enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Duration::HR_24:
-            return "HR_24";
-          case Duration::DAY_7:
-            return "DAY_7";
-          case Duration::DAY_14:
-            return "DAY_14";
-          case Duration::DAY_30:
-            return "DAY_30";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDuration(Duration enumValue)
+        {
+          return GetNameForDurationCStr(enumValue);
         }
 
       } // namespace DurationMapper
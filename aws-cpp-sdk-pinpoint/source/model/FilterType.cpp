@@ -30,20 +30,37 @@ namespace Aws
       namespace FilterTypeMapper
       {
 
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
-        static const int ENDPOINT_HASH = HashingUtils::HashString("ENDPOINT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SYSTEM",
+          "ENDPOINT",
+        };
 
         FilterType GetFilterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SYSTEM_HASH)
-          {
-            return FilterType::SYSTEM;
-          }
-          else if (hashCode == ENDPOINT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FilterType::ENDPOINT;
+          case -1833998801:
+            if (name == "SYSTEM")
+            {
+              return FilterType::SYSTEM;
+            }
+            break;
+          case -1771237995:
+            if (name == "ENDPOINT")
+            {
+              return FilterType::ENDPOINT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FilterType::NOT_SET;
         }
 
-        Aws::String GetNameForFilterType(FilterType enumValue)
+        const char* GetNameForFilterTypeCStr(FilterType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FilterType::SYSTEM:
-            return "SYSTEM";
-          case FilterType::ENDPOINT:
-            return "ENDPOINT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFilterType(FilterType enumValue)
+        {
+          return GetNameForFilterTypeCStr(enumValue);
         }
 
       } // namespace FilterTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace FrequencyMapper
       {
 
-        static const int ONCE_HASH = HashingUtils::HashString("ONCE");
-        static const int HOURLY_HASH = HashingUtils::HashString("HOURLY");
-        static const int DAILY_HASH = HashingUtils::HashString("DAILY");
-        static const int WEEKLY_HASH = HashingUtils::HashString("WEEKLY");
-        static const int MONTHLY_HASH = HashingUtils::HashString("MONTHLY");
-        static const int EVENT_HASH = HashingUtils::HashString("EVENT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ONCE",
+          "HOURLY",
+          "DAILY",
+          "WEEKLY",
+          "MONTHLY",
+          "EVENT",
+        };
 
         Frequency GetFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONCE_HASH)
-          {
-            return Frequency::ONCE;
-          }
-          else if (hashCode == HOURLY_HASH)
-          {
-            return Frequency::HOURLY;
-          }
-          else if (hashCode == DAILY_HASH)
-          {
-            return Frequency::DAILY;
-          }
-          else if (hashCode == WEEKLY_HASH)
-          {
-            return Frequency::WEEKLY;
-          }
-          else if (hashCode == MONTHLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Frequency::MONTHLY;
-          }
-          else if (hashCode == EVENT_HASH)
-          {
-            return Frequency::EVENT;
+          case 2430593:
+            if (name == "ONCE")
+            {
+              return Frequency::ONCE;
+            }
+            break;
+          case 2136870513:
+            if (name == "HOURLY")
+            {
+              return Frequency::HOURLY;
+            }
+            break;
+          case 64808441:
+            if (name == "DAILY")
+            {
+              return Frequency::DAILY;
+            }
+            break;
+          case -1738378111:
+            if (name == "WEEKLY")
+            {
+              return Frequency::WEEKLY;
+            }
+            break;
+          case 1954618349:
+            if (name == "MONTHLY")
+            {
+              return Frequency::MONTHLY;
+            }
+            break;
+          case 66353786:
+            if (name == "EVENT")
+            {
+              return Frequency::EVENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return Frequency::NOT_SET;
         }
 
-        Aws::String GetNameForFrequency(Frequency enumValue)
+        const char* GetNameForFrequencyCStr(Frequency enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Frequency::ONCE:
-            return "ONCE";
-          case Frequency::HOURLY:
-            return "HOURLY";
-          case Frequency::DAILY:
-            return "DAILY";
-          case Frequency::WEEKLY:
-            return "WEEKLY";
-          case Frequency::MONTHLY:
-            return "MONTHLY";
-          case Frequency::EVENT:
-            return "EVENT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFrequency(Frequency enumValue)
+        {
+          return GetNameForFrequencyCStr(enumValue);
         }
 
       } // namespace FrequencyMapper
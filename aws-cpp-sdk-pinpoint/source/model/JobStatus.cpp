@@ -30,45 +30,72 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
-        static const int INITIALIZING_HASH = HashingUtils::HashString("INITIALIZING");
-        static const int PROCESSING_HASH = HashingUtils::HashString("PROCESSING");
-        static const int COMPLETING_HASH = HashingUtils::HashString("COMPLETING");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILING_HASH = HashingUtils::HashString("FAILING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATED",
+          "INITIALIZING",
+          "PROCESSING",
+          "COMPLETING",
+          "COMPLETED",
+          "FAILING",
+          "FAILED",
+        };
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATED_HASH)
-          {
-            return JobStatus::CREATED;
-          }
-          else if (hashCode == INITIALIZING_HASH)
-          {
-            return JobStatus::INITIALIZING;
-          }
-          else if (hashCode == PROCESSING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobStatus::PROCESSING;
-          }
-          else if (hashCode == COMPLETING_HASH)
-          {
-            return JobStatus::COMPLETING;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return JobStatus::COMPLETED;
-          }
-          else if (hashCode == FAILING_HASH)
-          {
-            return JobStatus::FAILING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobStatus::FAILED;
+          case 1746537160:
+            if (name == "CREATED")
+            {
+              return JobStatus::CREATED;
+            }
+            break;
+          case 1917201485:
+            if (name == "INITIALIZING")
+            {
+              return JobStatus::INITIALIZING;
+            }
+            break;
+          case 907287315:
+            if (name == "PROCESSING")
+            {
+              return JobStatus::PROCESSING;
+            }
+            break;
+          case -56111178:
+            if (name == "COMPLETING")
+            {
+              return JobStatus::COMPLETING;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return JobStatus::COMPLETED;
+            }
+            break;
+          case -368603164:
+            if (name == "FAILING")
+            {
+              return JobStatus::FAILING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return JobStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatusCStr(JobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobStatus::CREATED:
-            return "CREATED";
-          case JobStatus::INITIALIZING:
-            return "INITIALIZING";
-          case JobStatus::PROCESSING:
-            return "PROCESSING";
-          case JobStatus::COMPLETING:
-            return "COMPLETING";
-          case JobStatus::COMPLETED:
-            return "COMPLETED";
-          case JobStatus::FAILING:
-            return "FAILING";
-          case JobStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        {
+          return GetNameForJobStatusCStr(enumValue);
         }
 
       } // namespace JobStatusMapper
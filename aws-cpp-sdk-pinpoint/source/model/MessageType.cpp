@@ -30,20 +30,37 @@ namespace Aws
       namespace MessageTypeMapper
       {
 
-        static const int TRANSACTIONAL_HASH = HashingUtils::HashString("TRANSACTIONAL");
-        static const int PROMOTIONAL_HASH = HashingUtils::HashString("PROMOTIONAL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TRANSACTIONAL",
+          "PROMOTIONAL",
+        };
 
         MessageType GetMessageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRANSACTIONAL_HASH)
-          {
-            return MessageType::TRANSACTIONAL;
-          }
-          else if (hashCode == PROMOTIONAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MessageType::PROMOTIONAL;
+          case -730482839:
+            if (name == "TRANSACTIONAL")
+            {
+              return MessageType::TRANSACTIONAL;
+            }
+            break;
+          case -1385955346:
+            if (name == "PROMOTIONAL")
+            {
+              return MessageType::PROMOTIONAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MessageType::NOT_SET;
         }
 
-        Aws::String GetNameForMessageType(MessageType enumValue)
+        const char* GetNameForMessageTypeCStr(MessageType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MessageType::TRANSACTIONAL:
-            return "TRANSACTIONAL";
-          case MessageType::PROMOTIONAL:
-            return "PROMOTIONAL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMessageType(MessageType enumValue)
+        {
+          return GetNameForMessageTypeCStr(enumValue);
         }
 
       } // namespace MessageTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ModeMapper
       {
 
-        static const int DELIVERY_HASH = HashingUtils::HashString("DELIVERY");
-        static const int FILTER_HASH = HashingUtils::HashString("FILTER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DELIVERY",
+          "FILTER",
+        };
 
         Mode GetModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DELIVERY_HASH)
-          {
-            return Mode::DELIVERY;
-          }
-          else if (hashCode == FILTER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Mode::FILTER;
+          case 1606093812:
+            if (name == "DELIVERY")
+            {
+              return Mode::DELIVERY;
+            }
+            break;
+          case 2073804664:
+            if (name == "FILTER")
+            {
+              return Mode::FILTER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Mode::NOT_SET;
         }
 
-        Aws::String GetNameForMode(Mode enumValue)
+        const char* GetNameForModeCStr(Mode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Mode::DELIVERY:
-            return "DELIVERY";
-          case Mode::FILTER:
-            return "FILTER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMode(Mode enumValue)
+        {
+          return GetNameForModeCStr(enumValue);
         }
 
       } // namespace ModeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SegmentTypeMapper
       {
 
-        static const int DIMENSIONAL_HASH = HashingUtils::HashString("DIMENSIONAL");
-        static const int IMPORT_HASH = HashingUtils::HashString("IMPORT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DIMENSIONAL",
+          "IMPORT",
+        };
 
         SegmentType GetSegmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DIMENSIONAL_HASH)
-          {
-            return SegmentType::DIMENSIONAL;
-          }
-          else if (hashCode == IMPORT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SegmentType::IMPORT;
+          case 2112441329:
+            if (name == "DIMENSIONAL")
+            {
+              return SegmentType::DIMENSIONAL;
+            }
+            break;
+          case -2131466331:
+            if (name == "IMPORT")
+            {
+              return SegmentType::IMPORT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SegmentType::NOT_SET;
         }
 
-        Aws::String GetNameForSegmentType(SegmentType enumValue)
+        const char* GetNameForSegmentTypeCStr(SegmentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SegmentType::DIMENSIONAL:
-            return "DIMENSIONAL";
-          case SegmentType::IMPORT:
-            return "IMPORT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSegmentType(SegmentType enumValue)
+        {
+          return GetNameForSegmentTypeCStr(enumValue);
         }
 
       } // namespace SegmentTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TypeMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int ANY_HASH = HashingUtils::HashString("ANY");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALL",
+          "ANY",
+          "NONE",
+        };
 
         Type GetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
-          {
-            return Type::ALL;
-          }
-          else if (hashCode == ANY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Type::ANY;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return Type::NONE;
+          case 64897:
+            if (name == "ALL")
+            {
+              return Type::ALL;
+            }
+            break;
+          case 64972:
+            if (name == "ANY")
+            {
+              return Type::ANY;
+            }
+            break;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return Type::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Type::NOT_SET;
         }
 
-        Aws::String GetNameForType(Type enumValue)
+        const char* GetNameForTypeCStr(Type enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Type::ALL:
-            return "ALL";
-          case Type::ANY:
-            return "ANY";
-          case Type::NONE:
-            return "NONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForType(Type enumValue)
+        {
+          return GetNameForTypeCStr(enumValue);
         }
 
       } // namespace TypeMapper
@@ -35,6 +35,11 @@ namespace GenderMapper
 AWS_POLLY_API Gender GetGenderForName(const Aws::String& name);
 
 AWS_POLLY_API Aws::String GetNameForGender(Gender value);
+
+/**
+ * Same as GetNameForGender(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_POLLY_API const char* GetNameForGenderCStr(Gender value);
 } // namespace GenderMapper
 } // namespace Model
 } // namespace Polly
@@ -37,6 +37,11 @@ namespace OutputFormatMapper
 AWS_POLLY_API OutputFormat GetOutputFormatForName(const Aws::String& name);
 
 AWS_POLLY_API Aws::String GetNameForOutputFormat(OutputFormat value);
+
+/**
+ * Same as GetNameForOutputFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_POLLY_API const char* GetNameForOutputFormatCStr(OutputFormat value);
 } // namespace OutputFormatMapper
 } // namespace Model
 } // namespace Polly
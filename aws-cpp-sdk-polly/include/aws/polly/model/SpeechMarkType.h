@@ -37,6 +37,11 @@ namespace SpeechMarkTypeMapper
 AWS_POLLY_API SpeechMarkType GetSpeechMarkTypeForName(const Aws::String& name);
 
 AWS_POLLY_API Aws::String GetNameForSpeechMarkType(SpeechMarkType value);
+
+/**
+ * Same as GetNameForSpeechMarkType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_POLLY_API const char* GetNameForSpeechMarkTypeCStr(SpeechMarkType value);
 } // namespace SpeechMarkTypeMapper
 } // namespace Model
 } // namespace Polly
@@ -35,6 +35,11 @@ namespace TextTypeMapper
 AWS_POLLY_API TextType GetTextTypeForName(const Aws::String& name);
 
 AWS_POLLY_API Aws::String GetNameForTextType(TextType value);
+
+/**
+ * Same as GetNameForTextType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_POLLY_API const char* GetNameForTextTypeCStr(TextType value);
 } // namespace TextTypeMapper
 } // namespace Model
 } // namespace Polly
@@ -90,6 +90,11 @@ namespace VoiceIdMapper
 AWS_POLLY_API VoiceId GetVoiceIdForName(const Aws::String& name);
 
 AWS_POLLY_API Aws::String GetNameForVoiceId(VoiceId value);
+
+/**
+ * Same as GetNameForVoiceId(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_POLLY_API const char* GetNameForVoiceIdCStr(VoiceId value);
 } // namespace VoiceIdMapper
 } // namespace Model
 } // namespace Polly
@@ -30,20 +30,37 @@ namespace Aws
       namespace GenderMapper
       {
 
-        static const int Female_HASH = HashingUtils::HashString("Female");
-        static const int Male_HASH = HashingUtils::HashString("Male");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Female",
+          "Male",
+        };
 
         Gender GetGenderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Female_HASH)
-          {
-            return Gender::Female;
-          }
-          else if (hashCode == Male_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Gender::Male;
+          case 2100660076:
+            if (name == "Female")
+            {
+              return Gender::Female;
+            }
+            break;
+          case 2390573:
+            if (name == "Male")
+            {
+              return Gender::Male;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Gender::NOT_SET;
         }
 
-        Aws::String GetNameForGender(Gender enumValue)
+        const char* GetNameForGenderCStr(Gender enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Gender::Female:
-            return "Female";
-          case Gender::Male:
-            return "Male";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGender(Gender enumValue)
+        {
+          return GetNameForGenderCStr(enumValue);
         }
 
       } // namespace GenderMapper
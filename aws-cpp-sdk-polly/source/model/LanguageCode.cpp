@@ -30,150 +30,219 @@ namespace Aws
       namespace LanguageCodeMapper
       {
 
-        static const int cmn_CN_HASH = HashingUtils::HashString("cmn-CN");
-        static const int cy_GB_HASH = HashingUtils::HashString("cy-GB");
-        static const int da_DK_HASH = HashingUtils::HashString("da-DK");
-        static const int de_DE_HASH = HashingUtils::HashString("de-DE");
-        static const int en_AU_HASH = HashingUtils::HashString("en-AU");
-        static const int en_GB_HASH = HashingUtils::HashString("en-GB");
-        static const int en_GB_WLS_HASH = HashingUtils::HashString("en-GB-WLS");
-        static const int en_IN_HASH = HashingUtils::HashString("en-IN");
-        static const int en_US_HASH = HashingUtils::HashString("en-US");
-        static const int es_ES_HASH = HashingUtils::HashString("es-ES");
-        static const int es_MX_HASH = HashingUtils::HashString("es-MX");
-        static const int es_US_HASH = HashingUtils::HashString("es-US");
-        static const int fr_CA_HASH = HashingUtils::HashString("fr-CA");
-        static const int fr_FR_HASH = HashingUtils::HashString("fr-FR");
-        static const int is_IS_HASH = HashingUtils::HashString("is-IS");
-        static const int it_IT_HASH = HashingUtils::HashString("it-IT");
-        static const int ja_JP_HASH = HashingUtils::HashString("ja-JP");
-        static const int hi_IN_HASH = HashingUtils::HashString("hi-IN");
-        static const int ko_KR_HASH = HashingUtils::HashString("ko-KR");
-        static const int nb_NO_HASH = HashingUtils::HashString("nb-NO");
-        static const int nl_NL_HASH = HashingUtils::HashString("nl-NL");
-        static const int pl_PL_HASH = HashingUtils::HashString("pl-PL");
-        static const int pt_BR_HASH = HashingUtils::HashString("pt-BR");
-        static const int pt_PT_HASH = HashingUtils::HashString("pt-PT");
-        static const int ro_RO_HASH = HashingUtils::HashString("ro-RO");
-        static const int ru_RU_HASH = HashingUtils::HashString("ru-RU");
-        static const int sv_SE_HASH = HashingUtils::HashString("sv-SE");
-        static const int tr_TR_HASH = HashingUtils::HashString("tr-TR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "cmn-CN",
+          "cy-GB",
+          "da-DK",
+          "de-DE",
+          "en-AU",
+          "en-GB",
+          "en-GB-WLS",
+          "en-IN",
+          "en-US",
+          "es-ES",
+          "es-MX",
+          "es-US",
+          "fr-CA",
+          "fr-FR",
+          "is-IS",
+          "it-IT",
+          "ja-JP",
+          "hi-IN",
+          "ko-KR",
+          "nb-NO",
+          "nl-NL",
+          "pl-PL",
+          "pt-BR",
+          "pt-PT",
+          "ro-RO",
+          "ru-RU",
+          "sv-SE",
+          "tr-TR",
+        };
 
         LanguageCode GetLanguageCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cmn_CN_HASH)
-          {
-            return LanguageCode::cmn_CN;
-          }
-          else if (hashCode == cy_GB_HASH)
-          {
-            return LanguageCode::cy_GB;
-          }
-          else if (hashCode == da_DK_HASH)
-          {
-            return LanguageCode::da_DK;
-          }
-          else if (hashCode == de_DE_HASH)
-          {
-            return LanguageCode::de_DE;
-          }
-          else if (hashCode == en_AU_HASH)
-          {
-            return LanguageCode::en_AU;
-          }
-          else if (hashCode == en_GB_HASH)
-          {
-            return LanguageCode::en_GB;
-          }
-          else if (hashCode == en_GB_WLS_HASH)
-          {
-            return LanguageCode::en_GB_WLS;
-          }
-          else if (hashCode == en_IN_HASH)
-          {
-            return LanguageCode::en_IN;
-          }
-          else if (hashCode == en_US_HASH)
-          {
-            return LanguageCode::en_US;
-          }
-          else if (hashCode == es_ES_HASH)
-          {
-            return LanguageCode::es_ES;
-          }
-          else if (hashCode == es_MX_HASH)
-          {
-            return LanguageCode::es_MX;
-          }
-          else if (hashCode == es_US_HASH)
-          {
-            return LanguageCode::es_US;
-          }
-          else if (hashCode == fr_CA_HASH)
-          {
-            return LanguageCode::fr_CA;
-          }
-          else if (hashCode == fr_FR_HASH)
-          {
-            return LanguageCode::fr_FR;
-          }
-          else if (hashCode == is_IS_HASH)
-          {
-            return LanguageCode::is_IS;
-          }
-          else if (hashCode == it_IT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LanguageCode::it_IT;
-          }
-          else if (hashCode == ja_JP_HASH)
-          {
-            return LanguageCode::ja_JP;
-          }
-          else if (hashCode == hi_IN_HASH)
-          {
-            return LanguageCode::hi_IN;
-          }
-          else if (hashCode == ko_KR_HASH)
-          {
-            return LanguageCode::ko_KR;
-          }
-          else if (hashCode == nb_NO_HASH)
-          {
-            return LanguageCode::nb_NO;
-          }
-          else if (hashCode == nl_NL_HASH)
-          {
-            return LanguageCode::nl_NL;
-          }
-          else if (hashCode == pl_PL_HASH)
-          {
-            return LanguageCode::pl_PL;
-          }
-          else if (hashCode == pt_BR_HASH)
-          {
-            return LanguageCode::pt_BR;
-          }
-          else if (hashCode == pt_PT_HASH)
-          {
-            return LanguageCode::pt_PT;
-          }
-          else if (hashCode == ro_RO_HASH)
-          {
-            return LanguageCode::ro_RO;
-          }
-          else if (hashCode == ru_RU_HASH)
-          {
-            return LanguageCode::ru_RU;
-          }
-          else if (hashCode == sv_SE_HASH)
-          {
-            return LanguageCode::sv_SE;
-          }
-          else if (hashCode == tr_TR_HASH)
-          {
-            return LanguageCode::tr_TR;
+          case -1356695148:
+            if (name == "cmn-CN")
+            {
+              return LanguageCode::cmn_CN;
+            }
+            break;
+          case 95078802:
+            if (name == "cy-GB")
+            {
+              return LanguageCode::cy_GB;
+            }
+            break;
+          case 95287255:
+            if (name == "da-DK")
+            {
+              return LanguageCode::da_DK;
+            }
+            break;
+          case 95406413:
+            if (name == "de-DE")
+            {
+              return LanguageCode::de_DE;
+            }
+            break;
+          case 96597976:
+            if (name == "en-AU")
+            {
+              return LanguageCode::en_AU;
+            }
+            break;
+          case 96598143:
+            if (name == "en-GB")
+            {
+              return LanguageCode::en_GB;
+            }
+            break;
+          case -350657072:
+            if (name == "en-GB-WLS")
+            {
+              return LanguageCode::en_GB_WLS;
+            }
+            break;
+          case 96598217:
+            if (name == "en-IN")
+            {
+              return LanguageCode::en_IN;
+            }
+            break;
+          case 96598594:
+            if (name == "en-US")
+            {
+              return LanguageCode::en_US;
+            }
+            break;
+          case 96747053:
+            if (name == "es-ES")
+            {
+              return LanguageCode::es_ES;
+            }
+            break;
+          case 96747306:
+            if (name == "es-MX")
+            {
+              return LanguageCode::es_MX;
+            }
+            break;
+          case 96747549:
+            if (name == "es-US")
+            {
+              return LanguageCode::es_US;
+            }
+            break;
+          case 97640703:
+            if (name == "fr-CA")
+            {
+              return LanguageCode::fr_CA;
+            }
+            break;
+          case 97640813:
+            if (name == "fr-FR")
+            {
+              return LanguageCode::fr_FR;
+            }
+            break;
+          case 100441261:
+            if (name == "is-IS")
+            {
+              return LanguageCode::is_IS;
+            }
+            break;
+          case 100471053:
+            if (name == "it-IT")
+            {
+              return LanguageCode::it_IT;
+            }
+            break;
+          case 100828572:
+            if (name == "ja-JP")
+            {
+              return LanguageCode::ja_JP;
+            }
+            break;
+          case 99219825:
+            if (name == "hi-IN")
+            {
+              return LanguageCode::hi_IN;
+            }
+            break;
+          case 102169200:
+            if (name == "ko-KR")
+            {
+              return LanguageCode::ko_KR;
+            }
+            break;
+          case 104552570:
+            if (name == "nb-NO")
+            {
+              return LanguageCode::nb_NO;
+            }
+            break;
+          case 104850477:
+            if (name == "nl-NL")
+            {
+              return LanguageCode::nl_NL;
+            }
+            break;
+          case 106697581:
+            if (name == "pl-PL")
+            {
+              return LanguageCode::pl_PL;
+            }
+            break;
+          case 106935481:
+            if (name == "pt-BR")
+            {
+              return LanguageCode::pt_BR;
+            }
+            break;
+          case 106935917:
+            if (name == "pt-PT")
+            {
+              return LanguageCode::pt_PT;
+            }
+            break;
+          case 108634061:
+            if (name == "ro-RO")
+            {
+              return LanguageCode::ro_RO;
+            }
+            break;
+          case 108812813:
+            if (name == "ru-RU")
+            {
+              return LanguageCode::ru_RU;
+            }
+            break;
+          case 109766140:
+            if (name == "sv-SE")
+            {
+              return LanguageCode::sv_SE;
+            }
+            break;
+          case 110570541:
+            if (name == "tr-TR")
+            {
+              return LanguageCode::tr_TR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -185,75 +254,26 @@ namespace Aws
           return LanguageCode::NOT_SET;
         }
 
-        Aws::String GetNameForLanguageCode(LanguageCode enumValue)
+        const char* GetNameForLanguageCodeCStr(LanguageCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LanguageCode::cmn_CN:
-            return "cmn-CN";
-          case LanguageCode::cy_GB:
-            return "cy-GB";
-          case LanguageCode::da_DK:
-            return "da-DK";
-          case LanguageCode::de_DE:
-            return "de-DE";
-          case LanguageCode::en_AU:
-            return "en-AU";
-          case LanguageCode::en_GB:
-            return "en-GB";
-          case LanguageCode::en_GB_WLS:
-            return "en-GB-WLS";
-          case LanguageCode::en_IN:
-            return "en-IN";
-          case LanguageCode::en_US:
-            return "en-US";
-          case LanguageCode::es_ES:
-            return "es-ES";
-          case LanguageCode::es_MX:
-            return "es-MX";
-          case LanguageCode::es_US:
-            return "es-US";
-          case LanguageCode::fr_CA:
-            return "fr-CA";
-          case LanguageCode::fr_FR:
-            return "fr-FR";
-          case LanguageCode::is_IS:
-            return "is-IS";
-          case LanguageCode::it_IT:
-            return "it-IT";
-          case LanguageCode::ja_JP:
-            return "ja-JP";
-          case LanguageCode::hi_IN:
-            return "hi-IN";
-          case LanguageCode::ko_KR:
-            return "ko-KR";
-          case LanguageCode::nb_NO:
-            return "nb-NO";
-          case LanguageCode::nl_NL:
-            return "nl-NL";
-          case LanguageCode::pl_PL:
-            return "pl-PL";
-          case LanguageCode::pt_BR:
-            return "pt-BR";
-          case LanguageCode::pt_PT:
-            return "pt-PT";
-          case LanguageCode::ro_RO:
-            return "ro-RO";
-          case LanguageCode::ru_RU:
-            return "ru-RU";
-          case LanguageCode::sv_SE:
-            return "sv-SE";
-          case LanguageCode::tr_TR:
-            return "tr-TR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLanguageCode(LanguageCode enumValue)
+        {
+          return GetNameForLanguageCodeCStr(enumValue);
         }
 
       } // namespace LanguageCodeMapper
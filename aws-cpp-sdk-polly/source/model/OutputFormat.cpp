@@ -30,30 +30,51 @@ namespace Aws
       namespace OutputFormatMapper
       {
 
-        static const int json_HASH = HashingUtils::HashString("json");
-        static const int mp3_HASH = HashingUtils::HashString("mp3");
-        static const int ogg_vorbis_HASH = HashingUtils::HashString("ogg_vorbis");
-        static const int pcm_HASH = HashingUtils::HashString("pcm");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "json",
+          "mp3",
+          "ogg_vorbis",
+          "pcm",
+        };
 
         OutputFormat GetOutputFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == json_HASH)
-          {
-            return OutputFormat::json;
-          }
-          else if (hashCode == mp3_HASH)
-          {
-            return OutputFormat::mp3;
-          }
-          else if (hashCode == ogg_vorbis_HASH)
-          {
-            return OutputFormat::ogg_vorbis;
-          }
-          else if (hashCode == pcm_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OutputFormat::pcm;
+          case 3271912:
+            if (name == "json")
+            {
+              return OutputFormat::json;
+            }
+            break;
+          case 108272:
+            if (name == "mp3")
+            {
+              return OutputFormat::mp3;
+            }
+            break;
+          case -803792317:
+            if (name == "ogg_vorbis")
+            {
+              return OutputFormat::ogg_vorbis;
+            }
+            break;
+          case 110810:
+            if (name == "pcm")
+            {
+              return OutputFormat::pcm;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return OutputFormat::NOT_SET;
         }
 
-        Aws::String GetNameForOutputFormat(OutputFormat enumValue)
+        const char* GetNameForOutputFormatCStr(OutputFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OutputFormat::json:
-            return "json";
-          case OutputFormat::mp3:
-            return "mp3";
-          case OutputFormat::ogg_vorbis:
-            return "ogg_vorbis";
-          case OutputFormat::pcm:
-            return "pcm";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOutputFormat(OutputFormat enumValue)
+        {
+          return GetNameForOutputFormatCStr(enumValue);
         }
 
       } // namespace OutputFormatMapper
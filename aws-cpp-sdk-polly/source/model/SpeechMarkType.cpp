@@ -30,30 +30,51 @@ namespace Aws
       namespace SpeechMarkTypeMapper
       {
 
-        static const int sentence_HASH = HashingUtils::HashString("sentence");
-        static const int ssml_HASH = HashingUtils::HashString("ssml");
-        static const int viseme_HASH = HashingUtils::HashString("viseme");
-        static const int word_HASH = HashingUtils::HashString("word");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "sentence",
+          "ssml",
+          "viseme",
+          "word",
+        };
 
         SpeechMarkType GetSpeechMarkTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == sentence_HASH)
-          {
-            return SpeechMarkType::sentence;
-          }
-          else if (hashCode == ssml_HASH)
-          {
-            return SpeechMarkType::ssml;
-          }
-          else if (hashCode == viseme_HASH)
-          {
-            return SpeechMarkType::viseme;
-          }
-          else if (hashCode == word_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SpeechMarkType::word;
+          case 1262736995:
+            if (name == "sentence")
+            {
+              return SpeechMarkType::sentence;
+            }
+            break;
+          case 3539967:
+            if (name == "ssml")
+            {
+              return SpeechMarkType::ssml;
+            }
+            break;
+          case -816231267:
+            if (name == "viseme")
+            {
+              return SpeechMarkType::viseme;
+            }
+            break;
+          case 3655434:
+            if (name == "word")
+            {
+              return SpeechMarkType::word;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return SpeechMarkType::NOT_SET;
         }
 
-        Aws::String GetNameForSpeechMarkType(SpeechMarkType enumValue)
+        const char* GetNameForSpeechMarkTypeCStr(SpeechMarkType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SpeechMarkType::sentence:
-            return "sentence";
-          case SpeechMarkType::ssml:
-            return "ssml";
-          case SpeechMarkType::viseme:
-            return "viseme";
-          case SpeechMarkType::word:
-            return "word";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSpeechMarkType(SpeechMarkType enumValue)
+        {
+          return GetNameForSpeechMarkTypeCStr(enumValue);
         }
 
       } // namespace SpeechMarkTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace TaskStatusMapper
       {
 
-        static const int scheduled_HASH = HashingUtils::HashString("scheduled");
-        static const int inProgress_HASH = HashingUtils::HashString("inProgress");
-        static const int completed_HASH = HashingUtils::HashString("completed");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "scheduled",
+          "inProgress",
+          "completed",
+          "failed",
+        };
 
         TaskStatus GetTaskStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == scheduled_HASH)
-          {
-            return TaskStatus::scheduled;
-          }
-          else if (hashCode == inProgress_HASH)
-          {
-            return TaskStatus::inProgress;
-          }
-          else if (hashCode == completed_HASH)
-          {
-            return TaskStatus::completed;
-          }
-          else if (hashCode == failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TaskStatus::failed;
+          case -160710483:
+            if (name == "scheduled")
+            {
+              return TaskStatus::scheduled;
+            }
+            break;
+          case -1347010958:
+            if (name == "inProgress")
+            {
+              return TaskStatus::inProgress;
+            }
+            break;
+          case -1402931637:
+            if (name == "completed")
+            {
+              return TaskStatus::completed;
+            }
+            break;
+          case -1281977283:
+            if (name == "failed")
+            {
+              return TaskStatus::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return TaskStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTaskStatus(TaskStatus enumValue)
+        const char* GetNameForTaskStatusCStr(TaskStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TaskStatus::scheduled:
-            return "scheduled";
-          case TaskStatus::inProgress:
-            return "inProgress";
-          case TaskStatus::completed:
-            return "completed";
-          case TaskStatus::failed:
-            return "failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTaskStatus(TaskStatus enumValue)
+        {
+          return GetNameForTaskStatusCStr(enumValue);
         }
 
       } // namespace TaskStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TextTypeMapper
       {
 
-        static const int ssml_HASH = HashingUtils::HashString("ssml");
-        static const int text_HASH = HashingUtils::HashString("text");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ssml",
+          "text",
+        };
 
         TextType GetTextTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ssml_HASH)
-          {
-            return TextType::ssml;
-          }
-          else if (hashCode == text_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TextType::text;
+          case 3539967:
+            if (name == "ssml")
+            {
+              return TextType::ssml;
+            }
+            break;
+          case 3556653:
+            if (name == "text")
+            {
+              return TextType::text;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TextType::NOT_SET;
         }
 
-        Aws::String GetNameForTextType(TextType enumValue)
+        const char* GetNameForTextTypeCStr(TextType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TextType::ssml:
-            return "ssml";
-          case TextType::text:
-            return "text";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTextType(TextType enumValue)
+        {
+          return GetNameForTextTypeCStr(enumValue);
         }
 
       } // namespace TextTypeMapper
@@ -30,295 +30,422 @@ namespace Aws
       namespace VoiceIdMapper
       {
 
-        static const int Geraint_HASH = HashingUtils::HashString("Geraint");
-        static const int Gwyneth_HASH = HashingUtils::HashString("Gwyneth");
-        static const int Mads_HASH = HashingUtils::HashString("Mads");
-        static const int Naja_HASH = HashingUtils::HashString("Naja");
-        static const int Hans_HASH = HashingUtils::HashString("Hans");
-        static const int Marlene_HASH = HashingUtils::HashString("Marlene");
-        static const int Nicole_HASH = HashingUtils::HashString("Nicole");
-        static const int Russell_HASH = HashingUtils::HashString("Russell");
-        static const int Amy_HASH = HashingUtils::HashString("Amy");
-        static const int Brian_HASH = HashingUtils::HashString("Brian");
-        static const int Emma_HASH = HashingUtils::HashString("Emma");
-        static const int Raveena_HASH = HashingUtils::HashString("Raveena");
-        static const int Ivy_HASH = HashingUtils::HashString("Ivy");
-        static const int Joanna_HASH = HashingUtils::HashString("Joanna");
-        static const int Joey_HASH = HashingUtils::HashString("Joey");
-        static const int Justin_HASH = HashingUtils::HashString("Justin");
-        static const int Kendra_HASH = HashingUtils::HashString("Kendra");
-        static const int Kimberly_HASH = HashingUtils::HashString("Kimberly");
-        static const int Matthew_HASH = HashingUtils::HashString("Matthew");
-        static const int Salli_HASH = HashingUtils::HashString("Salli");
-        static const int Conchita_HASH = HashingUtils::HashString("Conchita");
-        static const int Enrique_HASH = HashingUtils::HashString("Enrique");
-        static const int Miguel_HASH = HashingUtils::HashString("Miguel");
-        static const int Penelope_HASH = HashingUtils::HashString("Penelope");
-        static const int Chantal_HASH = HashingUtils::HashString("Chantal");
-        static const int Celine_HASH = HashingUtils::HashString("Celine");
-        static const int Lea_HASH = HashingUtils::HashString("Lea");
-        static const int Mathieu_HASH = HashingUtils::HashString("Mathieu");
-        static const int Dora_HASH = HashingUtils::HashString("Dora");
-        static const int Karl_HASH = HashingUtils::HashString("Karl");
-        static const int Carla_HASH = HashingUtils::HashString("Carla");
-        static const int Giorgio_HASH = HashingUtils::HashString("Giorgio");
-        static const int Mizuki_HASH = HashingUtils::HashString("Mizuki");
-        static const int Liv_HASH = HashingUtils::HashString("Liv");
-        static const int Lotte_HASH = HashingUtils::HashString("Lotte");
-        static const int Ruben_HASH = HashingUtils::HashString("Ruben");
-        static const int Ewa_HASH = HashingUtils::HashString("Ewa");
-        static const int Jacek_HASH = HashingUtils::HashString("Jacek");
-        static const int Jan_HASH = HashingUtils::HashString("Jan");
-        static const int Maja_HASH = HashingUtils::HashString("Maja");
-        static const int Ricardo_HASH = HashingUtils::HashString("Ricardo");
-        static const int Vitoria_HASH = HashingUtils::HashString("Vitoria");
-        static const int Cristiano_HASH = HashingUtils::HashString("Cristiano");
-        static const int Ines_HASH = HashingUtils::HashString("Ines");
-        static const int Carmen_HASH = HashingUtils::HashString("Carmen");
-        static const int Maxim_HASH = HashingUtils::HashString("Maxim");
-        static const int Tatyana_HASH = HashingUtils::HashString("Tatyana");
-        static const int Astrid_HASH = HashingUtils::HashString("Astrid");
-        static const int Filiz_HASH = HashingUtils::HashString("Filiz");
-        static const int Vicki_HASH = HashingUtils::HashString("Vicki");
-        static const int Takumi_HASH = HashingUtils::HashString("Takumi");
-        static const int Seoyeon_HASH = HashingUtils::HashString("Seoyeon");
-        static const int Aditi_HASH = HashingUtils::HashString("Aditi");
-        static const int Zhiyu_HASH = HashingUtils::HashString("Zhiyu");
-        static const int Bianca_HASH = HashingUtils::HashString("Bianca");
-        static const int Lucia_HASH = HashingUtils::HashString("Lucia");
-        static const int Mia_HASH = HashingUtils::HashString("Mia");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Geraint",
+          "Gwyneth",
+          "Mads",
+          "Naja",
+          "Hans",
+          "Marlene",
+          "Nicole",
+          "Russell",
+          "Amy",
+          "Brian",
+          "Emma",
+          "Raveena",
+          "Ivy",
+          "Joanna",
+          "Joey",
+          "Justin",
+          "Kendra",
+          "Kimberly",
+          "Matthew",
+          "Salli",
+          "Conchita",
+          "Enrique",
+          "Miguel",
+          "Penelope",
+          "Chantal",
+          "Celine",
+          "Lea",
+          "Mathieu",
+          "Dora",
+          "Karl",
+          "Carla",
+          "Giorgio",
+          "Mizuki",
+          "Liv",
+          "Lotte",
+          "Ruben",
+          "Ewa",
+          "Jacek",
+          "Jan",
+          "Maja",
+          "Ricardo",
+          "Vitoria",
+          "Cristiano",
+          "Ines",
+          "Carmen",
+          "Maxim",
+          "Tatyana",
+          "Astrid",
+          "Filiz",
+          "Vicki",
+          "Takumi",
+          "Seoyeon",
+          "Aditi",
+          "Zhiyu",
+          "Bianca",
+          "Lucia",
+          "Mia",
+        };
 
         VoiceId GetVoiceIdForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Geraint_HASH)
-          {
-            return VoiceId::Geraint;
-          }
-          else if (hashCode == Gwyneth_HASH)
-          {
-            return VoiceId::Gwyneth;
-          }
-          else if (hashCode == Mads_HASH)
-          {
-            return VoiceId::Mads;
-          }
-          else if (hashCode == Naja_HASH)
-          {
-            return VoiceId::Naja;
-          }
-          else if (hashCode == Hans_HASH)
-          {
-            return VoiceId::Hans;
-          }
-          else if (hashCode == Marlene_HASH)
-          {
-            return VoiceId::Marlene;
-          }
-          else if (hashCode == Nicole_HASH)
-          {
-            return VoiceId::Nicole;
-          }
-          else if (hashCode == Russell_HASH)
-          {
-            return VoiceId::Russell;
-          }
-          else if (hashCode == Amy_HASH)
-          {
-            return VoiceId::Amy;
-          }
-          else if (hashCode == Brian_HASH)
-          {
-            return VoiceId::Brian;
-          }
-          else if (hashCode == Emma_HASH)
-          {
-            return VoiceId::Emma;
-          }
-          else if (hashCode == Raveena_HASH)
-          {
-            return VoiceId::Raveena;
-          }
-          else if (hashCode == Ivy_HASH)
-          {
-            return VoiceId::Ivy;
-          }
-          else if (hashCode == Joanna_HASH)
-          {
-            return VoiceId::Joanna;
-          }
-          else if (hashCode == Joey_HASH)
-          {
-            return VoiceId::Joey;
-          }
-          else if (hashCode == Justin_HASH)
-          {
-            return VoiceId::Justin;
-          }
-          else if (hashCode == Kendra_HASH)
-          {
-            return VoiceId::Kendra;
-          }
-          else if (hashCode == Kimberly_HASH)
-          {
-            return VoiceId::Kimberly;
-          }
-          else if (hashCode == Matthew_HASH)
-          {
-            return VoiceId::Matthew;
-          }
-          else if (hashCode == Salli_HASH)
-          {
-            return VoiceId::Salli;
-          }
-          else if (hashCode == Conchita_HASH)
-          {
-            return VoiceId::Conchita;
-          }
-          else if (hashCode == Enrique_HASH)
-          {
-            return VoiceId::Enrique;
-          }
-          else if (hashCode == Miguel_HASH)
-          {
-            return VoiceId::Miguel;
-          }
-          else if (hashCode == Penelope_HASH)
-          {
-            return VoiceId::Penelope;
-          }
-          else if (hashCode == Chantal_HASH)
-          {
-            return VoiceId::Chantal;
-          }
-          else if (hashCode == Celine_HASH)
-          {
-            return VoiceId::Celine;
-          }
-          else if (hashCode == Lea_HASH)
-          {
-            return VoiceId::Lea;
-          }
-          else if (hashCode == Mathieu_HASH)
-          {
-            return VoiceId::Mathieu;
-          }
-          else if (hashCode == Dora_HASH)
-          {
-            return VoiceId::Dora;
-          }
-          else if (hashCode == Karl_HASH)
-          {
-            return VoiceId::Karl;
-          }
-          else if (hashCode == Carla_HASH)
-          {
-            return VoiceId::Carla;
-          }
-          else if (hashCode == Giorgio_HASH)
-          {
-            return VoiceId::Giorgio;
-          }
-          else if (hashCode == Mizuki_HASH)
-          {
-            return VoiceId::Mizuki;
-          }
-          else if (hashCode == Liv_HASH)
-          {
-            return VoiceId::Liv;
-          }
-          else if (hashCode == Lotte_HASH)
-          {
-            return VoiceId::Lotte;
-          }
-          else if (hashCode == Ruben_HASH)
-          {
-            return VoiceId::Ruben;
-          }
-          else if (hashCode == Ewa_HASH)
-          {
-            return VoiceId::Ewa;
-          }
-          else if (hashCode == Jacek_HASH)
-          {
-            return VoiceId::Jacek;
-          }
-          else if (hashCode == Jan_HASH)
-          {
-            return VoiceId::Jan;
-          }
-          else if (hashCode == Maja_HASH)
-          {
-            return VoiceId::Maja;
-          }
-          else if (hashCode == Ricardo_HASH)
-          {
-            return VoiceId::Ricardo;
-          }
-          else if (hashCode == Vitoria_HASH)
-          {
-            return VoiceId::Vitoria;
-          }
-          else if (hashCode == Cristiano_HASH)
-          {
-            return VoiceId::Cristiano;
-          }
-          else if (hashCode == Ines_HASH)
-          {
-            return VoiceId::Ines;
-          }
-          else if (hashCode == Carmen_HASH)
-          {
-            return VoiceId::Carmen;
-          }
-          else if (hashCode == Maxim_HASH)
-          {
-            return VoiceId::Maxim;
-          }
-          else if (hashCode == Tatyana_HASH)
-          {
-            return VoiceId::Tatyana;
-          }
-          else if (hashCode == Astrid_HASH)
-          {
-            return VoiceId::Astrid;
-          }
-          else if (hashCode == Filiz_HASH)
-          {
-            return VoiceId::Filiz;
-          }
-          else if (hashCode == Vicki_HASH)
-          {
-            return VoiceId::Vicki;
-          }
-          else if (hashCode == Takumi_HASH)
-          {
-            return VoiceId::Takumi;
-          }
-          else if (hashCode == Seoyeon_HASH)
-          {
-            return VoiceId::Seoyeon;
-          }
-          else if (hashCode == Aditi_HASH)
-          {
-            return VoiceId::Aditi;
-          }
-          else if (hashCode == Zhiyu_HASH)
-          {
-            return VoiceId::Zhiyu;
-          }
-          else if (hashCode == Bianca_HASH)
-          {
-            return VoiceId::Bianca;
-          }
-          else if (hashCode == Lucia_HASH)
-          {
-            return VoiceId::Lucia;
-          }
-          else if (hashCode == Mia_HASH)
-          {
-            return VoiceId::Mia;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 1588071714:
+            if (name == "Geraint")
+            {
+              return VoiceId::Geraint;
+            }
+            break;
+          case 2110244692:
+            if (name == "Gwyneth")
+            {
+              return VoiceId::Gwyneth;
+            }
+            break;
+          case 2390339:
+            if (name == "Mads")
+            {
+              return VoiceId::Mads;
+            }
+            break;
+          case 2420298:
+            if (name == "Naja")
+            {
+              return VoiceId::Naja;
+            }
+            break;
+          case 2241694:
+            if (name == "Hans")
+            {
+              return VoiceId::Hans;
+            }
+            break;
+          case -1791033554:
+            if (name == "Marlene")
+            {
+              return VoiceId::Marlene;
+            }
+            break;
+          case -1961864384:
+            if (name == "Nicole")
+            {
+              return VoiceId::Nicole;
+            }
+            break;
+          case -1074767422:
+            if (name == "Russell")
+            {
+              return VoiceId::Russell;
+            }
+            break;
+          case 65965:
+            if (name == "Amy")
+            {
+              return VoiceId::Amy;
+            }
+            break;
+          case 64452582:
+            if (name == "Brian")
+            {
+              return VoiceId::Brian;
+            }
+            break;
+          case 2163804:
+            if (name == "Emma")
+            {
+              return VoiceId::Emma;
+            }
+            break;
+          case -1644996902:
+            if (name == "Raveena")
+            {
+              return VoiceId::Raveena;
+            }
+            break;
+          case 73932:
+            if (name == "Ivy")
+            {
+              return VoiceId::Ivy;
+            }
+            break;
+          case -2070900347:
+            if (name == "Joanna")
+            {
+              return VoiceId::Joanna;
+            }
+            break;
+          case 2314457:
+            if (name == "Joey")
+            {
+              return VoiceId::Joey;
+            }
+            break;
+          case -2064817359:
+            if (name == "Justin")
+            {
+              return VoiceId::Justin;
+            }
+            break;
+          case -2051128609:
+            if (name == "Kendra")
+            {
+              return VoiceId::Kendra;
+            }
+            break;
+          case -520400627:
+            if (name == "Kimberly")
+            {
+              return VoiceId::Kimberly;
+            }
+            break;
+          case -1788945562:
+            if (name == "Matthew")
+            {
+              return VoiceId::Matthew;
+            }
+            break;
+          case 79649211:
+            if (name == "Salli")
+            {
+              return VoiceId::Salli;
+            }
+            break;
+          case -518293009:
+            if (name == "Conchita")
+            {
+              return VoiceId::Conchita;
+            }
+            break;
+          case 70972929:
+            if (name == "Enrique")
+            {
+              return VoiceId::Enrique;
+            }
+            break;
+          case -1990368815:
+            if (name == "Miguel")
+            {
+              return VoiceId::Miguel;
+            }
+            break;
+          case 380274500:
+            if (name == "Penelope")
+            {
+              return VoiceId::Penelope;
+            }
+            break;
+          case -1891357971:
+            if (name == "Chantal")
+            {
+              return VoiceId::Chantal;
+            }
+            break;
+          case 2014750582:
+            if (name == "Celine")
+            {
+              return VoiceId::Celine;
+            }
+            break;
+          case 76264:
+            if (name == "Lea")
+            {
+              return VoiceId::Lea;
+            }
+            break;
+          case -1789302095:
+            if (name == "Mathieu")
+            {
+              return VoiceId::Mathieu;
+            }
+            break;
+          case 2136090:
+            if (name == "Dora")
+            {
+              return VoiceId::Dora;
+            }
+            break;
+          case 2331184:
+            if (name == "Karl")
+            {
+              return VoiceId::Karl;
+            }
+            break;
+          case 64878633:
+            if (name == "Carla")
+            {
+              return VoiceId::Carla;
+            }
+            break;
+          case 1700322120:
+            if (name == "Giorgio")
+            {
+              return VoiceId::Giorgio;
+            }
+            break;
+          case -1989802603:
+            if (name == "Mizuki")
+            {
+              return VoiceId::Mizuki;
+            }
+            break;
+          case 76409:
+            if (name == "Liv")
+            {
+              return VoiceId::Liv;
+            }
+            break;
+          case 73609570:
+            if (name == "Lotte")
+            {
+              return VoiceId::Lotte;
+            }
+            break;
+          case 79311688:
+            if (name == "Ruben")
+            {
+              return VoiceId::Ruben;
+            }
+            break;
+          case 70095:
+            if (name == "Ewa")
+            {
+              return VoiceId::Ewa;
+            }
+            break;
+          case 71328658:
+            if (name == "Jacek")
+            {
+              return VoiceId::Jacek;
+            }
+            break;
+          case 74231:
+            if (name == "Jan")
+            {
+              return VoiceId::Jan;
+            }
+            break;
+          case 2390507:
+            if (name == "Maja")
+            {
+              return VoiceId::Maja;
+            }
+            break;
+          case -1433617560:
+            if (name == "Ricardo")
+            {
+              return VoiceId::Ricardo;
+            }
+            break;
+          case 2132514236:
+            if (name == "Vitoria")
+            {
+              return VoiceId::Vitoria;
+            }
+            break;
+          case -1922137868:
+            if (name == "Cristiano")
+            {
+              return VoiceId::Cristiano;
+            }
+            break;
+          case 2283699:
+            if (name == "Ines")
+            {
+              return VoiceId::Ines;
+            }
+            break;
+          case 2011238818:
+            if (name == "Carmen")
+            {
+              return VoiceId::Carmen;
+            }
+            break;
+          case 74119528:
+            if (name == "Maxim")
+            {
+              return VoiceId::Maxim;
+            }
+            break;
+          case 128755394:
+            if (name == "Tatyana")
+            {
+              return VoiceId::Tatyana;
+            }
+            break;
+          case 1970668395:
+            if (name == "Astrid")
+            {
+              return VoiceId::Astrid;
+            }
+            break;
+          case 67881690:
+            if (name == "Filiz")
+            {
+              return VoiceId::Filiz;
+            }
+            break;
+          case 82649422:
+            if (name == "Vicki")
+            {
+              return VoiceId::Vicki;
+            }
+            break;
+          case -1797233517:
+            if (name == "Takumi")
+            {
+              return VoiceId::Takumi;
+            }
+            break;
+          case -648845400:
+            if (name == "Seoyeon")
+            {
+              return VoiceId::Seoyeon;
+            }
+            break;
+          case 63112571:
+            if (name == "Aditi")
+            {
+              return VoiceId::Aditi;
+            }
+            break;
+          case 86319927:
+            if (name == "Zhiyu")
+            {
+              return VoiceId::Zhiyu;
+            }
+            break;
+          case 1989492274:
+            if (name == "Bianca")
+            {
+              return VoiceId::Bianca;
+            }
+            break;
+          case 73771634:
+            if (name == "Lucia")
+            {
+              return VoiceId::Lucia;
+            }
+            break;
+          case 77349:
+            if (name == "Mia")
+            {
+              return VoiceId::Mia;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -330,133 +457,26 @@ namespace Aws
           return VoiceId::NOT_SET;
         }
 
-        Aws::String GetNameForVoiceId(VoiceId enumValue)
+        const char* GetNameForVoiceIdCStr(VoiceId enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VoiceId::Geraint:
-            return "Geraint";
-          case VoiceId::Gwyneth:
-            return "Gwyneth";
-          case VoiceId::Mads:
-            return "Mads";
-          case VoiceId::Naja:
-            return "Naja";
-          case VoiceId::Hans:
-            return "Hans";
-          case VoiceId::Marlene:
-            return "Marlene";
-          case VoiceId::Nicole:
-            return "Nicole";
-          case VoiceId::Russell:
-            return "Russell";
-          case VoiceId::Amy:
-            return "Amy";
-          case VoiceId::Brian:
-            return "Brian";
-          case VoiceId::Emma:
-            return "Emma";
-          case VoiceId::Raveena:
-            return "Raveena";
-          case VoiceId::Ivy:
-            return "Ivy";
-          case VoiceId::Joanna:
-            return "Joanna";
-          case VoiceId::Joey:
-            return "Joey";
-          case VoiceId::Justin:
-            return "Justin";
-          case VoiceId::Kendra:
-            return "Kendra";
-          case VoiceId::Kimberly:
-            return "Kimberly";
-          case VoiceId::Matthew:
-            return "Matthew";
-          case VoiceId::Salli:
-            return "Salli";
-          case VoiceId::Conchita:
-            return "Conchita";
-          case VoiceId::Enrique:
-            return "Enrique";
-          case VoiceId::Miguel:
-            return "Miguel";
-          case VoiceId::Penelope:
-            return "Penelope";
-          case VoiceId::Chantal:
-            return "Chantal";
-          case VoiceId::Celine:
-            return "Celine";
-          case VoiceId::Lea:
-            return "Lea";
-          case VoiceId::Mathieu:
-            return "Mathieu";
-          case VoiceId::Dora:
-            return "Dora";
-          case VoiceId::Karl:
-            return "Karl";
-          case VoiceId::Carla:
-            return "Carla";
-          case VoiceId::Giorgio:
-            return "Giorgio";
-          case VoiceId::Mizuki:
-            return "Mizuki";
-          case VoiceId::Liv:
-            return "Liv";
-          case VoiceId::Lotte:
-            return "Lotte";
-          case VoiceId::Ruben:
-            return "Ruben";
-          case VoiceId::Ewa:
-            return "Ewa";
-          case VoiceId::Jacek:
-            return "Jacek";
-          case VoiceId::Jan:
-            return "Jan";
-          case VoiceId::Maja:
-            return "Maja";
-          case VoiceId::Ricardo:
-            return "Ricardo";
-          case VoiceId::Vitoria:
-            return "Vitoria";
-          case VoiceId::Cristiano:
-            return "Cristiano";
-          case VoiceId::Ines:
-            return "Ines";
-          case VoiceId::Carmen:
-            return "Carmen";
-          case VoiceId::Maxim:
-            return "Maxim";
-          case VoiceId::Tatyana:
-            return "Tatyana";
-          case VoiceId::Astrid:
-            return "Astrid";
-          case VoiceId::Filiz:
-            return "Filiz";
-          case VoiceId::Vicki:
-            return "Vicki";
-          case VoiceId::Takumi:
-            return "Takumi";
-          case VoiceId::Seoyeon:
-            return "Seoyeon";
-          case VoiceId::Aditi:
-            return "Aditi";
-          case VoiceId::Zhiyu:
-            return "Zhiyu";
-          case VoiceId::Bianca:
-            return "Bianca";
-          case VoiceId::Lucia:
-            return "Lucia";
-          case VoiceId::Mia:
-            return "Mia";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVoiceId(VoiceId enumValue)
+        {
+          return GetNameForVoiceIdCStr(enumValue);
         }
 
       } // namespace VoiceIdMapper
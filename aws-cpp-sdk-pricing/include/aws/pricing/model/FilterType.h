@@ -34,6 +34,11 @@ namespace FilterTypeMapper
 AWS_PRICING_API FilterType GetFilterTypeForName(const Aws::String& name);
 
 AWS_PRICING_API Aws::String GetNameForFilterType(FilterType value);
+
+/**
+ * Same as GetNameForFilterType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PRICING_API const char* GetNameForFilterTypeCStr(FilterType value);
 } // namespace FilterTypeMapper
 } // namespace Model
 } // namespace Pricing
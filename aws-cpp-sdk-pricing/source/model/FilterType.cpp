@@ -30,15 +30,30 @@ namespace Aws
       namespace FilterTypeMapper
       {
 
-        static const int TERM_MATCH_HASH = HashingUtils::HashString("TERM_MATCH");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TERM_MATCH",
+        };
 
         FilterType GetFilterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERM_MATCH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FilterType::TERM_MATCH;
+          case -194805742:
+            if (name == "TERM_MATCH")
+            {
+              return FilterType::TERM_MATCH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return FilterType::NOT_SET;
         }
 
-        Aws::String GetNameForFilterType(FilterType enumValue)
+        const char* GetNameForFilterTypeCStr(FilterType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FilterType::TERM_MATCH:
-            return "TERM_MATCH";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFilterType(FilterType enumValue)
+        {
+          return GetNameForFilterTypeCStr(enumValue);
         }
 
       } // namespace FilterTypeMapper
@@ -0,0 +1,382 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/queues/sqs/SQSBatchingBuffer.h>
+#include <aws/sqs/SQSClient.h>
+#include <aws/sqs/model/SendMessageBatchRequest.h>
+#include <aws/sqs/model/DeleteMessageBatchRequest.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Queues::Sqs;
+using namespace Aws::SQS;
+using namespace Aws::SQS::Model;
+using namespace Aws::Client;
+
+static const char* ALLOCATION_TAG = "SQSBatchingBufferTest";
+static const char* QUEUE_URL = "https://sqs.us-east-1.amazonaws.com/123456789012/batching-test";
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    struct SentBatch
+    {
+        // message bodies of a SendMessageBatch, receipt handles of a DeleteMessageBatch.
+        Aws::Vector<Aws::String> entries;
+        Clock::time_point sentAt;
+    };
+
+    /**
+    * SQSClient answering SendMessageBatch and DeleteMessageBatch from memory. A sent message gets "id-" followed by its body
+    * as message id.
+    */
+    class FakeSQSClient : public SQSClient
+    {
+    public:
+        FakeSQSClient() : SQSClient(Aws::Auth::AWSCredentials("akid", "secret")), m_failBatchCalls(false), m_holdBatches(false)
+        {
+        }
+
+        void SendMessageBatchAsync(const SendMessageBatchRequest& request, const SendMessageBatchResponseReceivedHandler& handler,
+                                   const std::shared_ptr<const AsyncCallerContext>& context = nullptr) const override
+        {
+            SentBatch batch;
+            batch.sentAt = Clock::now();
+            SendMessageBatchResult result;
+            std::unique_lock<std::mutex> locker(m_lock);
+            for (const auto& entry : request.GetEntries())
+            {
+                batch.entries.push_back(entry.GetMessageBody());
+                if (m_failingEntries.find(entry.GetMessageBody()) != m_failingEntries.end())
+                {
+                    result.AddFailed(BatchResultErrorEntry().WithId(entry.GetId()).WithCode("InvalidMessageContents")
+                        .WithMessage("rejected").WithSenderFault(true));
+                }
+                else
+                {
+                    result.AddSuccessful(SendMessageBatchResultEntry().WithId(entry.GetId()).WithMessageId("id-" + entry.GetMessageBody()));
+                }
+            }
+            m_sendBatches.push_back(batch);
+
+            SendMessageBatchOutcome outcome = m_failBatchCalls ? SendMessageBatchOutcome(BatchCallError()) : SendMessageBatchOutcome(result);
+            Complete(locker, [this, request, handler, context, outcome]() { handler(this, request, outcome, context); });
+        }
+
+        void DeleteMessageBatchAsync(const DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler,
+                                     const std::shared_ptr<const AsyncCallerContext>& context = nullptr) const override
+        {
+            SentBatch batch;
+            batch.sentAt = Clock::now();
+            DeleteMessageBatchResult result;
+            std::unique_lock<std::mutex> locker(m_lock);
+            for (const auto& entry : request.GetEntries())
+            {
+                batch.entries.push_back(entry.GetReceiptHandle());
+                if (m_failingEntries.find(entry.GetReceiptHandle()) != m_failingEntries.end())
+                {
+                    result.AddFailed(BatchResultErrorEntry().WithId(entry.GetId()).WithCode("ReceiptHandleIsInvalid")
+                        .WithMessage("rejected").WithSenderFault(true));
+                }
+                else
+                {
+                    result.AddSuccessful(DeleteMessageBatchResultEntry().WithId(entry.GetId()));
+                }
+            }
+            m_deleteBatches.push_back(batch);
+
+            DeleteMessageBatchOutcome outcome = m_failBatchCalls ? DeleteMessageBatchOutcome(BatchCallError()) : DeleteMessageBatchOutcome(result);
+            Complete(locker, [this, request, handler, context, outcome]() { handler(this, request, outcome, context); });
+        }
+
+        /**
+        * Entries with this body or receipt handle fail on their own.
+        */
+        void FailEntry(const Aws::String& entry)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_failingEntries.insert(entry);
+        }
+
+        void FailBatchCalls()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_failBatchCalls = true;
+        }
+
+        void HoldBatches()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_holdBatches = true;
+        }
+
+        void CompleteHeldBatches()
+        {
+            Aws::Vector<std::function<void()>> completions;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                completions.swap(m_heldCompletions);
+            }
+            for (const auto& completion : completions)
+            {
+                completion();
+            }
+        }
+
+        bool WaitForSendBatches(size_t count)
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            return m_signal.wait_for(locker, std::chrono::seconds(10), [&] { return m_sendBatches.size() >= count; });
+        }
+
+        Aws::Vector<SentBatch> GetSendBatches() const { std::lock_guard<std::mutex> locker(m_lock); return m_sendBatches; }
+        Aws::Vector<SentBatch> GetDeleteBatches() const { std::lock_guard<std::mutex> locker(m_lock); return m_deleteBatches; }
+
+    private:
+        static AWSError<SQSErrors> BatchCallError()
+        {
+            return AWSError<SQSErrors>(SQSErrors::SERVICE_UNAVAILABLE, "ServiceUnavailable", "try again later", true);
+        }
+
+        void Complete(std::unique_lock<std::mutex>& locker, const std::function<void()>& completion) const
+        {
+            m_signal.notify_all();
+            if (m_holdBatches)
+            {
+                m_heldCompletions.push_back(completion);
+                return;
+            }
+            locker.unlock();
+            completion();
+        }
+
+        mutable std::mutex m_lock;
+        mutable std::condition_variable m_signal;
+        Aws::Set<Aws::String> m_failingEntries;
+        bool m_failBatchCalls;
+        bool m_holdBatches;
+        mutable Aws::Vector<std::function<void()>> m_heldCompletions;
+        mutable Aws::Vector<SentBatch> m_sendBatches;
+        mutable Aws::Vector<SentBatch> m_deleteBatches;
+    };
+
+    SendMessageRequest MakeSendRequest(const Aws::String& body)
+    {
+        return SendMessageRequest().WithQueueUrl(QUEUE_URL).WithMessageBody(body);
+    }
+
+    DeleteMessageRequest MakeDeleteRequest(const Aws::String& receiptHandle)
+    {
+        return DeleteMessageRequest().WithQueueUrl(QUEUE_URL).WithReceiptHandle(receiptHandle);
+    }
+
+    void IgnoreSendOutcome(const SQSClient*, const SendMessageRequest&, const SendMessageOutcome&, const std::shared_ptr<const AsyncCallerContext>&)
+    {
+    }
+
+    Aws::String MessageBody(size_t index)
+    {
+        return "message-" + Aws::Utils::StringUtils::to_string(index);
+    }
+
+    class SQSBatchingBufferTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_client = Aws::MakeShared<FakeSQSClient>(ALLOCATION_TAG);
+            // long enough that only the test cases about lingering see batches sent for it.
+            m_configuration.lingerMs = 60000;
+        }
+
+        std::shared_ptr<FakeSQSClient> m_client;
+        SQSBatchingConfiguration m_configuration;
+    };
+}
+
+TEST_F(SQSBatchingBufferTest, TestBatchIsSentAtTenEntries)
+{
+    SQSBatchingBuffer buffer(m_client, m_configuration);
+    Aws::Vector<SendMessageOutcomeCallable> outcomes;
+    for (size_t i = 0; i < 11; ++i)
+    {
+        outcomes.push_back(buffer.SendMessageCallable(MakeSendRequest(MessageBody(i))));
+    }
+
+    auto batches = m_client->GetSendBatches();
+    ASSERT_EQ(1u, batches.size());
+    ASSERT_EQ(10u, batches[0].entries.size());
+    for (size_t i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(MessageBody(i), batches[0].entries[i]);
+        auto outcome = outcomes[i].get();
+        ASSERT_TRUE(outcome.IsSuccess());
+        ASSERT_EQ("id-" + MessageBody(i), outcome.GetResult().GetMessageId());
+    }
+    ASSERT_EQ(std::future_status::timeout, outcomes[10].wait_for(std::chrono::milliseconds(0)));
+}
+
+TEST_F(SQSBatchingBufferTest, TestBatchIsSentAtMaxBytes)
+{
+    const size_t maxBytes = m_configuration.maxBatchBytes;
+    Aws::String quarter(maxBytes / 4, 'q');
+    Aws::String half(maxBytes / 2, 'h');
+
+    SQSBatchingBuffer buffer(m_client, m_configuration);
+    buffer.SendMessageAsync(MakeSendRequest(half + "1"), IgnoreSendOutcome);
+    buffer.SendMessageAsync(MakeSendRequest(quarter + "2"), IgnoreSendOutcome);
+    ASSERT_TRUE(m_client->GetSendBatches().empty());
+
+    // would take the batch over maxBatchBytes, so the batch is sent without it and it starts the next one.
+    buffer.SendMessageAsync(MakeSendRequest(half + "3"), IgnoreSendOutcome);
+    ASSERT_EQ(1u, m_client->GetSendBatches().size());
+
+    // brings the batch to exactly maxBatchBytes.
+    buffer.SendMessageAsync(MakeSendRequest(half.substr(1)), IgnoreSendOutcome);
+
+    auto batches = m_client->GetSendBatches();
+    ASSERT_EQ(2u, batches.size());
+    ASSERT_EQ(2u, batches[0].entries.size());
+    ASSERT_EQ(half + "1", batches[0].entries[0]);
+    ASSERT_EQ(quarter + "2", batches[0].entries[1]);
+    ASSERT_EQ(2u, batches[1].entries.size());
+    ASSERT_EQ(half + "3", batches[1].entries[0]);
+    ASSERT_EQ(maxBytes, batches[1].entries[0].size() + batches[1].entries[1].size());
+}
+
+TEST_F(SQSBatchingBufferTest, TestBatchIsSentAfterLinger)
+{
+    m_configuration.lingerMs = 200;
+    SQSBatchingBuffer buffer(m_client, m_configuration);
+
+    auto firstAddedAt = Clock::now();
+    for (size_t i = 0; i < 3; ++i)
+    {
+        buffer.SendMessageAsync(MakeSendRequest(MessageBody(i)), IgnoreSendOutcome);
+    }
+    ASSERT_TRUE(m_client->GetSendBatches().empty());
+
+    ASSERT_TRUE(m_client->WaitForSendBatches(1));
+    auto batches = m_client->GetSendBatches();
+    ASSERT_EQ(1u, batches.size());
+    ASSERT_EQ(3u, batches[0].entries.size());
+    ASSERT_GE(batches[0].sentAt - firstAddedAt, std::chrono::milliseconds(m_configuration.lingerMs));
+}
+
+TEST_F(SQSBatchingBufferTest, TestFailedEntriesReachTheirCaller)
+{
+    m_client->FailEntry(MessageBody(2));
+    m_client->FailEntry("receipt-1");
+
+    SQSBatchingBuffer buffer(m_client, m_configuration);
+    Aws::Vector<SendMessageOutcomeCallable> sends;
+    Aws::Vector<DeleteMessageOutcomeCallable> deletes;
+    for (size_t i = 0; i < 5; ++i)
+    {
+        sends.push_back(buffer.SendMessageCallable(MakeSendRequest(MessageBody(i))));
+        deletes.push_back(buffer.DeleteMessageCallable(MakeDeleteRequest("receipt-" + Aws::Utils::StringUtils::to_string(i))));
+    }
+    buffer.Flush();
+
+    ASSERT_EQ(1u, m_client->GetSendBatches().size());
+    ASSERT_EQ(1u, m_client->GetDeleteBatches().size());
+    for (size_t i = 0; i < 5; ++i)
+    {
+        auto send = sends[i].get();
+        auto remove = deletes[i].get();
+        if (i == 2)
+        {
+            ASSERT_FALSE(send.IsSuccess());
+            ASSERT_EQ("InvalidMessageContents", send.GetError().GetExceptionName());
+            ASSERT_EQ(SQSErrors::INVALID_MESSAGE_CONTENTS, send.GetError().GetErrorType());
+            ASSERT_FALSE(send.GetError().ShouldRetry());
+        }
+        else
+        {
+            ASSERT_TRUE(send.IsSuccess());
+            ASSERT_EQ("id-" + MessageBody(i), send.GetResult().GetMessageId());
+        }
+
+        if (i == 1)
+        {
+            ASSERT_FALSE(remove.IsSuccess());
+            ASSERT_EQ("ReceiptHandleIsInvalid", remove.GetError().GetExceptionName());
+        }
+        else
+        {
+            ASSERT_TRUE(remove.IsSuccess());
+        }
+    }
+}
+
+TEST_F(SQSBatchingBufferTest, TestFailedBatchCallFailsEveryEntry)
+{
+    m_client->FailBatchCalls();
+
+    SQSBatchingBuffer buffer(m_client, m_configuration);
+    Aws::Vector<SendMessageOutcomeCallable> sends;
+    Aws::Vector<DeleteMessageOutcomeCallable> deletes;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        sends.push_back(buffer.SendMessageCallable(MakeSendRequest(MessageBody(i))));
+        deletes.push_back(buffer.DeleteMessageCallable(MakeDeleteRequest("receipt-" + Aws::Utils::StringUtils::to_string(i))));
+    }
+    buffer.Flush();
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        auto send = sends[i].get();
+        ASSERT_FALSE(send.IsSuccess());
+        ASSERT_EQ(SQSErrors::SERVICE_UNAVAILABLE, send.GetError().GetErrorType());
+        ASSERT_TRUE(send.GetError().ShouldRetry());
+
+        auto remove = deletes[i].get();
+        ASSERT_FALSE(remove.IsSuccess());
+        ASSERT_EQ(SQSErrors::SERVICE_UNAVAILABLE, remove.GetError().GetErrorType());
+    }
+}
+
+TEST_F(SQSBatchingBufferTest, TestDestructorSendsPendingEntriesAndWaitsForThem)
+{
+    m_client->HoldBatches();
+    auto buffer = Aws::MakeUnique<SQSBatchingBuffer>(ALLOCATION_TAG, m_client, m_configuration);
+    Aws::Vector<SendMessageOutcomeCallable> outcomes;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        outcomes.push_back(buffer->SendMessageCallable(MakeSendRequest(MessageBody(i))));
+    }
+    ASSERT_TRUE(m_client->GetSendBatches().empty());
+
+    auto destroyed = std::async(std::launch::async, [&] { buffer = nullptr; });
+    ASSERT_TRUE(m_client->WaitForSendBatches(1));
+    ASSERT_EQ(3u, m_client->GetSendBatches()[0].entries.size());
+    ASSERT_EQ(std::future_status::timeout, destroyed.wait_for(std::chrono::milliseconds(200)));
+
+    m_client->CompleteHeldBatches();
+    ASSERT_EQ(std::future_status::ready, destroyed.wait_for(std::chrono::seconds(10)));
+    for (auto& outcome : outcomes)
+    {
+        ASSERT_EQ(std::future_status::ready, outcome.wait_for(std::chrono::milliseconds(0)));
+        ASSERT_TRUE(outcome.get().IsSuccess());
+    }
+}
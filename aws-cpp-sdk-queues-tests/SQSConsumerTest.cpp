@@ -0,0 +1,450 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/queues/sqs/SQSConsumer.h>
+#include <aws/sqs/SQSClient.h>
+#include <aws/sqs/model/ReceiveMessageRequest.h>
+#include <aws/sqs/model/DeleteMessageBatchRequest.h>
+#include <aws/sqs/model/ChangeMessageVisibilityBatchRequest.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Queues::Sqs;
+using namespace Aws::SQS;
+using namespace Aws::SQS::Model;
+
+static const char* ALLOCATION_TAG = "SQSConsumerTest";
+static const char* QUEUE_URL = "https://sqs.us-east-1.amazonaws.com/123456789012/consumer-test";
+
+namespace
+{
+    typedef std::chrono::steady_clock Clock;
+
+    struct DeleteBatch
+    {
+        Aws::Vector<Aws::String> receiptHandles;
+        Clock::time_point sentAt;
+    };
+
+    /**
+    * SQSClient serving the messages queued with AddMessages, and answering the batch calls from memory.
+    * Messages are identified by their body, which is also their receipt handle.
+    */
+    class FakeSQSClient : public SQSClient
+    {
+    public:
+        FakeSQSClient() : SQSClient(Aws::Auth::AWSCredentials("akid", "secret")), m_receivedCount(0), m_holdDeleteBatches(false),
+            m_outstandingMessages(0), m_maxOutstandingMessages(0)
+        {
+        }
+
+        void AddMessages(size_t count)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            for (size_t i = 0; i < count; ++i)
+            {
+                Aws::String body = "message-" + Aws::Utils::StringUtils::to_string(m_available.size() + m_receivedCount);
+                m_available.push_back(Message().WithMessageId(body).WithReceiptHandle(body).WithBody(body));
+            }
+            m_signal.notify_all();
+        }
+
+        ReceiveMessageOutcome ReceiveMessage(const ReceiveMessageRequest& request) const override
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            auto keepPolling = request.GetContinueRequestHandler();
+            while (m_available.empty() && (!keepPolling || keepPolling(nullptr)))
+            {
+                m_signal.wait_for(locker, std::chrono::milliseconds(10));
+            }
+
+            ReceiveMessageResult result;
+            size_t count = (std::min)(m_available.size(), static_cast<size_t>(request.GetMaxNumberOfMessages()));
+            for (size_t i = 0; i < count; ++i)
+            {
+                result.AddMessages(m_available.front());
+                m_available.pop_front();
+            }
+            m_receivedCount += count;
+            m_outstandingMessages += count;
+            m_maxOutstandingMessages = (std::max)(m_maxOutstandingMessages, m_outstandingMessages);
+            m_signal.notify_all();
+            return result;
+        }
+
+        void DeleteMessageBatchAsync(const DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler,
+                                     const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+        {
+            DeleteMessageBatchResult result;
+            DeleteBatch batch;
+            batch.sentAt = Clock::now();
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                for (const auto& entry : request.GetEntries())
+                {
+                    batch.receiptHandles.push_back(entry.GetReceiptHandle());
+                    if (m_failingDeletes.find(entry.GetReceiptHandle()) != m_failingDeletes.end())
+                    {
+                        result.AddFailed(BatchResultErrorEntry().WithId(entry.GetId()).WithCode("ReceiptHandleIsInvalid").WithSenderFault(true));
+                    }
+                    else
+                    {
+                        result.AddSuccessful(DeleteMessageBatchResultEntry().WithId(entry.GetId()));
+                        --m_outstandingMessages;
+                    }
+                }
+                m_deleteBatches.push_back(batch);
+                m_signal.notify_all();
+            }
+
+            auto completion = [this, request, handler, context, result]() { handler(this, request, DeleteMessageBatchOutcome(result), context); };
+            std::unique_lock<std::mutex> locker(m_lock);
+            if (m_holdDeleteBatches)
+            {
+                m_heldCompletions.push_back(completion);
+                m_signal.notify_all();
+                return;
+            }
+            locker.unlock();
+            completion();
+        }
+
+        void ChangeMessageVisibilityBatchAsync(const ChangeMessageVisibilityBatchRequest& request,
+                                               const ChangeMessageVisibilityBatchResponseReceivedHandler& handler,
+                                               const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+        {
+            ChangeMessageVisibilityBatchResult result;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                for (const auto& entry : request.GetEntries())
+                {
+                    m_visibilityExtensions.push_back(entry.GetReceiptHandle());
+                    result.AddSuccessful(ChangeMessageVisibilityBatchResultEntry().WithId(entry.GetId()));
+                }
+            }
+            handler(this, request, ChangeMessageVisibilityBatchOutcome(result), context);
+        }
+
+        void FailDeletesOf(const Aws::String& receiptHandle)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_failingDeletes.insert(receiptHandle);
+        }
+
+        void HoldDeleteBatches(bool hold)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_holdDeleteBatches = hold;
+        }
+
+        bool WaitForDeleteEntries(size_t count)
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            return m_signal.wait_for(locker, std::chrono::seconds(10), [&] {
+                size_t entries = 0;
+                for (const auto& batch : m_deleteBatches)
+                {
+                    entries += batch.receiptHandles.size();
+                }
+                return entries >= count;
+            });
+        }
+
+        void CompleteHeldDeleteBatches()
+        {
+            Aws::Vector<std::function<void()>> completions;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                completions.swap(m_heldCompletions);
+            }
+            for (const auto& completion : completions)
+            {
+                completion();
+            }
+        }
+
+        bool WaitForReceived(size_t count)
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            return m_signal.wait_for(locker, std::chrono::seconds(10), [&] { return m_receivedCount >= count; });
+        }
+
+        size_t GetReceivedCount() const { std::lock_guard<std::mutex> locker(m_lock); return m_receivedCount; }
+        size_t GetMaxOutstandingMessages() const { std::lock_guard<std::mutex> locker(m_lock); return m_maxOutstandingMessages; }
+        Aws::Vector<DeleteBatch> GetDeleteBatches() const { std::lock_guard<std::mutex> locker(m_lock); return m_deleteBatches; }
+        Aws::Vector<Aws::String> GetVisibilityExtensions() const { std::lock_guard<std::mutex> locker(m_lock); return m_visibilityExtensions; }
+
+    private:
+        mutable std::mutex m_lock;
+        mutable std::condition_variable m_signal;
+        mutable Aws::Deque<Message> m_available;
+        mutable size_t m_receivedCount;
+        Aws::Set<Aws::String> m_failingDeletes;
+        bool m_holdDeleteBatches;
+        mutable Aws::Vector<std::function<void()>> m_heldCompletions;
+        mutable Aws::Vector<DeleteBatch> m_deleteBatches;
+        mutable Aws::Vector<Aws::String> m_visibilityExtensions;
+        mutable size_t m_outstandingMessages;
+        mutable size_t m_maxOutstandingMessages;
+    };
+
+    /**
+    * Collects what the handlers of an SQSConsumer were called with.
+    */
+    class ConsumerEvents
+    {
+    public:
+        void Handled(const Aws::String& body)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_handledAt[body] = Clock::now();
+            m_signal.notify_all();
+        }
+
+        void Deleted(const Aws::String& body, bool succeeded)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            (succeeded ? m_deleted : m_failedDeletes).insert(body);
+            m_signal.notify_all();
+        }
+
+        bool WaitForDeleteOutcomes(size_t count)
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            return m_signal.wait_for(locker, std::chrono::seconds(10), [&] { return m_deleted.size() + m_failedDeletes.size() >= count; });
+        }
+
+        size_t GetHandledCount() const { std::lock_guard<std::mutex> locker(m_lock); return m_handledAt.size(); }
+        Clock::time_point HandledAt(const Aws::String& body) const { std::lock_guard<std::mutex> locker(m_lock); return m_handledAt.at(body); }
+        Aws::Set<Aws::String> GetDeleted() const { std::lock_guard<std::mutex> locker(m_lock); return m_deleted; }
+        Aws::Set<Aws::String> GetFailedDeletes() const { std::lock_guard<std::mutex> locker(m_lock); return m_failedDeletes; }
+
+        void Attach(SQSConsumer& consumer)
+        {
+            consumer.SetMessageDeleteSuccessEventHandler([this](const SQSConsumer*, const Message& message) { Deleted(message.GetBody(), true); });
+            consumer.SetMessageDeleteFailedEventHandler([this](const SQSConsumer*, const Message& message) { Deleted(message.GetBody(), false); });
+        }
+
+    private:
+        mutable std::mutex m_lock;
+        std::condition_variable m_signal;
+        Aws::Map<Aws::String, Clock::time_point> m_handledAt;
+        Aws::Set<Aws::String> m_deleted;
+        Aws::Set<Aws::String> m_failedDeletes;
+    };
+
+    /**
+    * Lets handlers through once opened.
+    */
+    class Gate
+    {
+    public:
+        Gate() : m_open(false) {}
+
+        void Open()
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_open = true;
+            m_signal.notify_all();
+        }
+
+        void Pass()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_signal.wait(locker, [this] { return m_open; });
+        }
+
+    private:
+        std::mutex m_lock;
+        std::condition_variable m_signal;
+        bool m_open;
+    };
+
+    class SQSConsumerTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_client = Aws::MakeShared<FakeSQSClient>(ALLOCATION_TAG);
+            m_configuration.receiverThreads = 2;
+            m_configuration.handlerThreads = 4;
+            m_configuration.waitTimeSeconds = 1;
+        }
+
+        std::shared_ptr<FakeSQSClient> m_client;
+        SQSConsumerConfiguration m_configuration;
+        ConsumerEvents m_events;
+    };
+}
+
+TEST_F(SQSConsumerTest, TestReceiversWaitForRoomInFlight)
+{
+    m_configuration.maxMessagesInFlight = 10;
+    m_configuration.deleteLingerMs = 10;
+    m_client->AddMessages(30);
+
+    Gate gate;
+    SQSConsumer consumer(m_client, QUEUE_URL, m_configuration);
+    m_events.Attach(consumer);
+    consumer.SetMessageReceivedEventHandler([&](const SQSConsumer*, const Message& message, bool& deleteMessage)
+    {
+        gate.Pass();
+        m_events.Handled(message.GetBody());
+        deleteMessage = true;
+    });
+    consumer.Start();
+
+    ASSERT_TRUE(m_client->WaitForReceived(10));
+    // the handlers hold on to the first 10 messages, so no receiver may poll for more.
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    ASSERT_EQ(10u, m_client->GetReceivedCount());
+
+    gate.Open();
+    ASSERT_TRUE(m_events.WaitForDeleteOutcomes(30));
+    consumer.Stop();
+
+    ASSERT_EQ(30u, m_events.GetDeleted().size());
+    ASSERT_EQ(10u, m_client->GetMaxOutstandingMessages());
+}
+
+TEST_F(SQSConsumerTest, TestDeleteBatchesOfTenAndAfterLinger)
+{
+    const long lingerMs = 500;
+    m_configuration.receiverThreads = 1;
+    m_configuration.deleteLingerMs = lingerMs;
+    m_client->AddMessages(13);
+
+    SQSConsumer consumer(m_client, QUEUE_URL, m_configuration);
+    m_events.Attach(consumer);
+    consumer.SetMessageReceivedEventHandler([&](const SQSConsumer*, const Message& message, bool& deleteMessage)
+    {
+        m_events.Handled(message.GetBody());
+        deleteMessage = true;
+    });
+    consumer.Start();
+
+    ASSERT_TRUE(m_events.WaitForDeleteOutcomes(13));
+    auto batches = m_client->GetDeleteBatches();
+    ASSERT_EQ(2u, batches.size());
+    ASSERT_EQ(10u, batches[0].receiptHandles.size());
+    ASSERT_EQ(3u, batches[1].receiptHandles.size());
+
+    // the full batch goes out as soon as its last message is handled, the remainder once the oldest of it has waited lingerMs.
+    Clock::time_point lastHandled;
+    for (const auto& receiptHandle : batches[0].receiptHandles)
+    {
+        lastHandled = (std::max)(lastHandled, m_events.HandledAt(receiptHandle));
+    }
+    ASSERT_LT(batches[0].sentAt - lastHandled, std::chrono::milliseconds(lingerMs));
+
+    Clock::time_point firstHandled = Clock::time_point::max();
+    for (const auto& receiptHandle : batches[1].receiptHandles)
+    {
+        firstHandled = (std::min)(firstHandled, m_events.HandledAt(receiptHandle));
+    }
+    ASSERT_GE(batches[1].sentAt - firstHandled, std::chrono::milliseconds(lingerMs));
+    consumer.Stop();
+}
+
+TEST_F(SQSConsumerTest, TestPartialDeleteBatchFailuresReachTheirMessages)
+{
+    m_configuration.deleteLingerMs = 60000;
+    m_client->AddMessages(10);
+    m_client->FailDeletesOf("message-3");
+    m_client->FailDeletesOf("message-7");
+
+    SQSConsumer consumer(m_client, QUEUE_URL, m_configuration);
+    m_events.Attach(consumer);
+    consumer.SetMessageReceivedEventHandler([](const SQSConsumer*, const Message&, bool& deleteMessage) { deleteMessage = true; });
+    consumer.Start();
+
+    ASSERT_TRUE(m_events.WaitForDeleteOutcomes(10));
+    consumer.Stop();
+
+    ASSERT_EQ(1u, m_client->GetDeleteBatches().size());
+    Aws::Set<Aws::String> expectedFailures = { "message-3", "message-7" };
+    ASSERT_EQ(expectedFailures, m_events.GetFailedDeletes());
+    auto deleted = m_events.GetDeleted();
+    ASSERT_EQ(8u, deleted.size());
+    ASSERT_EQ(0u, deleted.count("message-3"));
+    ASSERT_EQ(0u, deleted.count("message-7"));
+}
+
+TEST_F(SQSConsumerTest, TestVisibilityOfSlowMessagesIsExtended)
+{
+    m_configuration.visibilityTimeoutSeconds = 1;
+    m_configuration.deleteLingerMs = 10;
+    m_client->AddMessages(2);
+
+    SQSConsumer consumer(m_client, QUEUE_URL, m_configuration);
+    m_events.Attach(consumer);
+    consumer.SetMessageReceivedEventHandler([&](const SQSConsumer*, const Message& message, bool& deleteMessage)
+    {
+        if (message.GetBody() == "message-0")
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+        }
+        m_events.Handled(message.GetBody());
+        deleteMessage = true;
+    });
+    consumer.Start();
+
+    ASSERT_TRUE(m_events.WaitForDeleteOutcomes(2));
+    consumer.Stop();
+
+    auto extensions = m_client->GetVisibilityExtensions();
+    ASSERT_GE(std::count(extensions.begin(), extensions.end(), "message-0"), 1);
+    ASSERT_EQ(0, std::count(extensions.begin(), extensions.end(), "message-1"));
+    ASSERT_EQ(2u, m_events.GetDeleted().size());
+}
+
+TEST_F(SQSConsumerTest, TestStopDrainsInFlightMessagesAndBatches)
+{
+    m_configuration.handlerThreads = 5;
+    m_configuration.deleteLingerMs = 60000;
+    m_client->AddMessages(5);
+    m_client->HoldDeleteBatches(true);
+
+    SQSConsumer consumer(m_client, QUEUE_URL, m_configuration);
+    m_events.Attach(consumer);
+    consumer.SetMessageReceivedEventHandler([&](const SQSConsumer*, const Message& message, bool& deleteMessage)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        m_events.Handled(message.GetBody());
+        deleteMessage = true;
+    });
+    consumer.Start();
+    ASSERT_TRUE(m_client->WaitForReceived(5));
+
+    auto stopped = std::async(std::launch::async, [&] { consumer.Stop(); });
+    // Stop() doesn't wait out the linger time, but it waits for the handlers and for the outcome of the delete batches.
+    ASSERT_TRUE(m_client->WaitForDeleteEntries(5));
+    ASSERT_EQ(5u, m_events.GetHandledCount());
+    ASSERT_EQ(std::future_status::timeout, stopped.wait_for(std::chrono::milliseconds(300)));
+    ASSERT_TRUE(m_events.GetDeleted().empty());
+
+    m_client->CompleteHeldDeleteBatches();
+    ASSERT_EQ(std::future_status::ready, stopped.wait_for(std::chrono::seconds(10)));
+    ASSERT_EQ(5u, m_events.GetDeleted().size());
+}
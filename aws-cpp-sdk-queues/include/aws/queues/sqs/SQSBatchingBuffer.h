@@ -0,0 +1,151 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+#pragma once
+
+#include <aws/queues/Queues_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/sqs/SQSClient.h>
+#include <aws/sqs/model/SendMessageRequest.h>
+#include <aws/sqs/model/DeleteMessageRequest.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Queues
+    {
+        namespace Sqs
+        {
+            /**
+             * Limits of the batches an SQSBatchingBuffer sends.
+             */
+            struct AWS_QUEUES_API SQSBatchingConfiguration
+            {
+                SQSBatchingConfiguration();
+
+                /**
+                 * Most entries in a batch, up to the 10 SQS accepts. Default 10.
+                 */
+                size_t maxBatchSize;
+
+                /**
+                 * Most bytes of message bodies and attributes in a SendMessageBatch, up to the 256KB SQS accepts. Default 256KB.
+                 */
+                size_t maxBatchBytes;
+
+                /**
+                 * Longest time in milliseconds the first entry of a batch waits for others before the batch is sent. Default 20.
+                 */
+                long lingerMs;
+            };
+
+            /**
+             * Sends individual SendMessage and DeleteMessage calls as SendMessageBatch and DeleteMessageBatch calls, one per queue
+             * url, to save the per request overhead at high rates. Entries wait for up to lingerMs, and a batch is sent as soon as
+             * it is full. Each call is completed from its own entry of the batch result, so a partially failed batch only fails
+             * the calls whose entries failed; when the whole batch call fails all its calls get its error.
+             *
+             * The Async and Callable methods mirror those of SQSClient, and the handlers are called from the client's executor.
+             * SendMessageRequest only keeps a DelaySeconds above 0, to let the queue's default delay apply otherwise.
+             * Destroying the buffer sends the entries pending and waits for all the batches to complete.
+             */
+            class AWS_QUEUES_API SQSBatchingBuffer
+            {
+            public:
+                SQSBatchingBuffer(const std::shared_ptr<Aws::SQS::SQSClient>& client,
+                                  const SQSBatchingConfiguration& configuration = SQSBatchingConfiguration());
+
+                ~SQSBatchingBuffer();
+
+                SQSBatchingBuffer(const SQSBatchingBuffer&) = delete;
+                SQSBatchingBuffer& operator=(const SQSBatchingBuffer&) = delete;
+
+                void SendMessageAsync(const Aws::SQS::Model::SendMessageRequest& request, const Aws::SQS::SendMessageResponseReceivedHandler& handler,
+                                      const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr);
+
+                Aws::SQS::Model::SendMessageOutcomeCallable SendMessageCallable(const Aws::SQS::Model::SendMessageRequest& request);
+
+                void DeleteMessageAsync(const Aws::SQS::Model::DeleteMessageRequest& request, const Aws::SQS::DeleteMessageResponseReceivedHandler& handler,
+                                        const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr);
+
+                Aws::SQS::Model::DeleteMessageOutcomeCallable DeleteMessageCallable(const Aws::SQS::Model::DeleteMessageRequest& request);
+
+                /**
+                 * Sends the entries pending without waiting for their linger time.
+                 */
+                void Flush();
+
+                inline const SQSBatchingConfiguration& GetConfiguration() const { return m_configuration; }
+
+            private:
+                struct PendingSend
+                {
+                    Aws::SQS::Model::SendMessageRequest request;
+                    Aws::SQS::SendMessageResponseReceivedHandler handler;
+                    std::shared_ptr<const Aws::Client::AsyncCallerContext> context;
+                };
+
+                struct PendingDelete
+                {
+                    Aws::SQS::Model::DeleteMessageRequest request;
+                    Aws::SQS::DeleteMessageResponseReceivedHandler handler;
+                    std::shared_ptr<const Aws::Client::AsyncCallerContext> context;
+                };
+
+                template<typename ENTRY>
+                struct PendingBatch
+                {
+                    PendingBatch() : bytes(0) {}
+
+                    Aws::Vector<ENTRY> entries;
+                    size_t bytes;
+                    std::chrono::steady_clock::time_point sendAt;
+                };
+
+                // Batches ready to send, by queue url.
+                template<typename ENTRY>
+                using ReadyBatches = Aws::Vector<std::pair<Aws::String, Aws::Vector<ENTRY>>>;
+
+                template<typename ENTRY>
+                void AddEntry(Aws::Map<Aws::String, PendingBatch<ENTRY>>& batches, const Aws::String& queueUrl, const ENTRY& entry,
+                              size_t bytes, ReadyBatches<ENTRY>& ready);
+                template<typename ENTRY>
+                void TakeBatches(Aws::Map<Aws::String, PendingBatch<ENTRY>>& batches, const std::chrono::steady_clock::time_point& sendBefore,
+                                 ReadyBatches<ENTRY>& ready, std::chrono::steady_clock::time_point& nextSendAt);
+                void SendBatches(const ReadyBatches<PendingSend>& sends, const ReadyBatches<PendingDelete>& deletes);
+                void SendBatch(const Aws::String& queueUrl, const Aws::Vector<PendingSend>& entries);
+                void SendBatch(const Aws::String& queueUrl, const Aws::Vector<PendingDelete>& entries);
+                void OnBatchComplete();
+                void FlushLoop();
+
+                std::shared_ptr<Aws::SQS::SQSClient> m_client;
+                SQSBatchingConfiguration m_configuration;
+
+                std::mutex m_batchesLock;
+                std::condition_variable m_batchesSignal;
+                Aws::Map<Aws::String, PendingBatch<PendingSend>> m_sendBatches;
+                Aws::Map<Aws::String, PendingBatch<PendingDelete>> m_deleteBatches;
+                size_t m_outstandingBatches;
+                bool m_running;
+                std::thread m_flushThread;
+            };
+        }
+    }
+}
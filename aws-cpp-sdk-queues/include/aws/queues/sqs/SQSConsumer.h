@@ -0,0 +1,215 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+#pragma once
+
+#include <aws/queues/Queues_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/sqs/SQSClient.h>
+#include <aws/sqs/model/Message.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Aws
+{
+    namespace Queues
+    {
+        namespace Sqs
+        {
+            /**
+             * Settings of an SQSConsumer.
+             */
+            struct AWS_QUEUES_API SQSConsumerConfiguration
+            {
+                SQSConsumerConfiguration();
+
+                /**
+                 * Number of threads long polling the queue, each for up to 10 messages at a time. Default 4.
+                 */
+                size_t receiverThreads;
+
+                /**
+                 * Number of threads running the message handler. Default 16.
+                 */
+                size_t handlerThreads;
+
+                /**
+                 * Most messages received and not yet deleted or given up on at any time; receivers wait for room before polling.
+                 * Default 200.
+                 */
+                size_t maxMessagesInFlight;
+
+                /**
+                 * Long poll wait time of the receive calls, in seconds, up to 20. Default 20.
+                 */
+                int waitTimeSeconds;
+
+                /**
+                 * Visibility timeout of the messages received, in seconds. Messages still being handled when half of it is left
+                 * get it extended by as much again. Default 30.
+                 */
+                int visibilityTimeoutSeconds;
+
+                /**
+                 * Longest time in milliseconds a handled message waits for 9 others to be deleted in the same batch. Default 100.
+                 */
+                long deleteLingerMs;
+
+                /**
+                 * Period in milliseconds of the statistics reported. Default 1000.
+                 */
+                long statisticsIntervalMs;
+            };
+
+            /**
+             * What an SQSConsumer did over the last statistics interval.
+             */
+            struct AWS_QUEUES_API SQSConsumerStatistics
+            {
+                SQSConsumerStatistics() : receivedPerSecond(0), handledPerSecond(0), deletedPerSecond(0), failedDeletes(0),
+                    visibilityExtensions(0), messagesInFlight(0), maxLagMs(0) {}
+
+                double receivedPerSecond;
+                double handledPerSecond;
+                double deletedPerSecond;
+                size_t failedDeletes;
+                size_t visibilityExtensions;
+                size_t messagesInFlight;
+                /**
+                 * Longest time between a message being sent and being received, among the messages received during the interval.
+                 */
+                long long maxLagMs;
+            };
+
+            /**
+             * High throughput consumer of an SQS queue. Receiver threads long poll the queue for batches of up to 10 messages and
+             * hand them to a pool of handler threads, up to maxMessagesInFlight at a time. The messages the handler asks to delete
+             * are deleted with DeleteMessageBatch, in batches of 10 or after deleteLingerMs, and the visibility timeout of messages
+             * still being handled is extended with ChangeMessageVisibilityBatch so that slow handlers don't see them received
+             * again elsewhere. Throughput and queue lag are reported every statisticsIntervalMs.
+             *
+             * The handlers are called from the handler threads, and the batch outcomes from the client's executor.
+             */
+            class AWS_QUEUES_API SQSConsumer
+            {
+                typedef std::function<void(const SQSConsumer*, const Aws::SQS::Model::Message&, bool&)> MessageReceivedEventHandler;
+                typedef std::function<void(const SQSConsumer*, const Aws::SQS::Model::Message&)> MessageDeleteFailedEventHandler;
+                typedef std::function<void(const SQSConsumer*, const Aws::SQS::Model::Message&)> MessageDeleteSuccessEventHandler;
+                typedef std::function<void(const SQSConsumer*, const SQSConsumerStatistics&)> StatisticsEventHandler;
+
+            public:
+                /**
+                 * Consumes the queue at queueUrl; see SQSQueue::GetQueueUrl to get it from a queue name. Call Start() to start
+                 * consuming.
+                 */
+                SQSConsumer(const std::shared_ptr<Aws::SQS::SQSClient>& client, const Aws::String& queueUrl,
+                            const SQSConsumerConfiguration& configuration = SQSConsumerConfiguration());
+
+                ~SQSConsumer();
+
+                SQSConsumer(const SQSConsumer&) = delete;
+                SQSConsumer& operator=(const SQSConsumer&) = delete;
+
+                /**
+                 * Starts the receiver, handler and maintenance threads. Can be called again after Stop() to resume consuming.
+                 */
+                void Start();
+
+                /**
+                 * Stops receiving, aborting the long polls in progress, then waits for the messages received to be handled and
+                 * deleted before stopping the threads. Called by the destructor.
+                 */
+                void Stop();
+
+                /**
+                 * Statistics of the last complete interval.
+                 */
+                SQSConsumerStatistics GetStatistics() const;
+
+                /**
+                 * Called with each message received, from a handler thread. Set the bool to true to have the message deleted;
+                 * left false, the message is received again once its visibility timeout expires.
+                 */
+                inline void SetMessageReceivedEventHandler(const MessageReceivedEventHandler& messageHandler) { m_messageReceivedHandler = messageHandler; }
+                inline void SetMessageDeleteFailedEventHandler(const MessageDeleteFailedEventHandler& messageHandler) { m_messageDeleteFailedHandler = messageHandler; }
+                inline void SetMessageDeleteSuccessEventHandler(const MessageDeleteSuccessEventHandler& messageHandler) { m_messageDeleteSuccessHandler = messageHandler; }
+                inline void SetStatisticsEventHandler(const StatisticsEventHandler& statisticsHandler) { m_statisticsHandler = statisticsHandler; }
+
+                inline const MessageReceivedEventHandler& GetMessageReceivedEventHandler() const { return m_messageReceivedHandler; }
+                inline const MessageDeleteFailedEventHandler& GetMessageDeleteFailedEventHandler() const { return m_messageDeleteFailedHandler; }
+                inline const MessageDeleteSuccessEventHandler& GetMessageDeleteSuccessEventHandler() const { return m_messageDeleteSuccessHandler; }
+                inline const StatisticsEventHandler& GetStatisticsEventHandler() const { return m_statisticsHandler; }
+
+                inline const Aws::String& GetQueueUrl() const { return m_queueUrl; }
+
+            private:
+                struct InFlightMessage
+                {
+                    Aws::SQS::Model::Message message;
+                    std::chrono::steady_clock::time_point visibleUntil;
+                    bool handled;
+                    bool extendingVisibility;
+                };
+                typedef std::shared_ptr<InFlightMessage> InFlightMessagePtr;
+
+                void ReceiveLoop();
+                void HandleMessage(const InFlightMessagePtr& inFlightMessage);
+                void MaintenanceLoop();
+                // Callers count the batch in m_outstandingBatches, and must not hold m_inFlightLock.
+                void SendDeleteBatch(const Aws::Vector<InFlightMessagePtr>& messages);
+                void SendVisibilityBatch(const Aws::Vector<InFlightMessagePtr>& messages);
+
+                std::shared_ptr<Aws::SQS::SQSClient> m_client;
+                Aws::String m_queueUrl;
+                SQSConsumerConfiguration m_configuration;
+
+                std::atomic<bool> m_receiving;
+                Aws::Vector<std::thread> m_receiverThreads;
+                std::thread m_maintenanceThread;
+                bool m_maintaining;
+                Aws::UniquePtr<Aws::Utils::Threading::PooledThreadExecutor> m_handlerExecutor;
+
+                // messages received and neither deleted nor given up on, by receipt handle.
+                mutable std::mutex m_inFlightLock;
+                std::condition_variable m_inFlightSignal;
+                Aws::Map<Aws::String, InFlightMessagePtr> m_inFlight;
+                size_t m_reservedSlots;
+                Aws::Vector<InFlightMessagePtr> m_pendingDeletes;
+                std::chrono::steady_clock::time_point m_oldestPendingDelete;
+                size_t m_outstandingBatches;
+
+                std::atomic<size_t> m_received;
+                std::atomic<size_t> m_handled;
+                std::atomic<size_t> m_deleted;
+                std::atomic<size_t> m_failedDeletes;
+                std::atomic<size_t> m_visibilityExtensions;
+                std::atomic<long long> m_maxLagMs;
+                SQSConsumerStatistics m_statistics;
+
+                MessageReceivedEventHandler m_messageReceivedHandler;
+                MessageDeleteFailedEventHandler m_messageDeleteFailedHandler;
+                MessageDeleteSuccessEventHandler m_messageDeleteSuccessHandler;
+                StatisticsEventHandler m_statisticsHandler;
+            };
+        }
+    }
+}
@@ -17,6 +17,7 @@
 #include <aws/queues/Queue.h>
 #include <aws/sqs/model/Message.h>
 #include <aws/queues/Queues_EXPORTS.h>
+#include <aws/queues/sqs/SQSBatchingBuffer.h>
 #include <memory>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/sqs/SQSClient.h>
@@ -111,6 +112,12 @@ namespace Aws
                  */
                 void EnsureQueueIsInitialized();
 
+                /**
+                 * Sends the messages pushed and deleted from now on through batchingBuffer, which can be shared with other queues
+                 * of the same client. Pass nullptr to send each message with its own call again.
+                 */
+                inline void SetBatchingBuffer(const std::shared_ptr<SQSBatchingBuffer>& batchingBuffer) { m_batchingBuffer = batchingBuffer; }
+
                 inline bool IsInitialized() const { return !m_queueUrl.empty(); }
                 inline const Aws::String& GetQueueUrl() const { return m_queueUrl; }
 
@@ -119,6 +126,7 @@ namespace Aws
                 Aws::String m_queueUrl;
                 Aws::String m_queueName;
                 unsigned m_visibilityTimeout;
+                std::shared_ptr<SQSBatchingBuffer> m_batchingBuffer;
 
                 void OnMessageDeletedOutcomeReceived(const SQS::SQSClient*, const SQS::Model::DeleteMessageRequest&,
                                                      const SQS::Model::DeleteMessageOutcome& deleteMessageOutcome, const std::shared_ptr<const Client::AsyncCallerContext>&);
@@ -0,0 +1,376 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/queues/sqs/SQSBatchingBuffer.h>
+#include <aws/sqs/model/SendMessageBatchRequest.h>
+#include <aws/sqs/model/DeleteMessageBatchRequest.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <future>
+
+using namespace Aws::SQS;
+using namespace Aws::SQS::Model;
+using namespace Aws::Queues::Sqs;
+using namespace Aws::Client;
+using namespace Aws::Utils;
+
+static const char* BATCHING_CLASS_TAG = "Aws::Queues::Sqs::SQSBatchingBuffer";
+static const size_t SQS_MAX_BATCH_ENTRIES = 10;
+static const size_t SQS_MAX_BATCH_BYTES = 256 * 1024;
+
+// Size SQS counts against the batch payload limit: the body, and the name, type and value of each attribute.
+static size_t GetPayloadSize(const SendMessageRequest& request)
+{
+    size_t bytes = request.GetMessageBody().size();
+    for (const auto& attribute : request.GetMessageAttributes())
+    {
+        bytes += attribute.first.size() + attribute.second.GetDataType().size() + attribute.second.GetStringValue().size()
+            + attribute.second.GetBinaryValue().GetLength();
+    }
+    return bytes;
+}
+
+// Error of one entry of a batch, from the entry's error or from the whole batch call's error.
+template<typename BATCH_OUTCOME>
+static AWSError<SQSErrors> GetBatchEntryError(const BATCH_OUTCOME& outcome, const Aws::String& id)
+{
+    if (!outcome.IsSuccess())
+    {
+        return outcome.GetError();
+    }
+
+    for (const auto& failed : outcome.GetResult().GetFailed())
+    {
+        if (failed.GetId() == id)
+        {
+            return AWSError<SQSErrors>(static_cast<SQSErrors>(SQSErrorMapper::GetErrorForName(failed.GetCode().c_str()).GetErrorType()),
+                                       failed.GetCode(), failed.GetMessage(), !failed.GetSenderFault());
+        }
+    }
+    return AWSError<SQSErrors>(SQSErrors::INTERNAL_FAILURE, "MissingBatchEntry", "The batch result has no entry with id " + id, true);
+}
+
+SQSBatchingConfiguration::SQSBatchingConfiguration() :
+    maxBatchSize(SQS_MAX_BATCH_ENTRIES),
+    maxBatchBytes(SQS_MAX_BATCH_BYTES),
+    lingerMs(20)
+{
+}
+
+SQSBatchingBuffer::SQSBatchingBuffer(const std::shared_ptr<SQSClient>& client, const SQSBatchingConfiguration& configuration) :
+    m_client(client),
+    m_configuration(configuration),
+    m_outstandingBatches(0),
+    m_running(true)
+{
+    m_configuration.maxBatchSize = (std::max)(static_cast<size_t>(1), (std::min)(m_configuration.maxBatchSize, SQS_MAX_BATCH_ENTRIES));
+    m_configuration.maxBatchBytes = (std::max)(static_cast<size_t>(1), (std::min)(m_configuration.maxBatchBytes, SQS_MAX_BATCH_BYTES));
+    m_configuration.lingerMs = (std::max)(m_configuration.lingerMs, 0L);
+    m_flushThread = std::thread(&SQSBatchingBuffer::FlushLoop, this);
+}
+
+SQSBatchingBuffer::~SQSBatchingBuffer()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_batchesLock);
+        m_running = false;
+        m_batchesSignal.notify_all();
+    }
+    m_flushThread.join();
+
+    Flush();
+    std::unique_lock<std::mutex> locker(m_batchesLock);
+    m_batchesSignal.wait(locker, [this] { return m_outstandingBatches == 0; });
+}
+
+void SQSBatchingBuffer::SendMessageAsync(const SendMessageRequest& request, const SendMessageResponseReceivedHandler& handler,
+                                         const std::shared_ptr<const AsyncCallerContext>& context)
+{
+    PendingSend entry;
+    entry.request = request;
+    entry.handler = handler;
+    entry.context = context;
+
+    ReadyBatches<PendingSend> ready;
+    {
+        std::lock_guard<std::mutex> locker(m_batchesLock);
+        AddEntry(m_sendBatches, request.GetQueueUrl(), entry, GetPayloadSize(request), ready);
+    }
+    SendBatches(ready, ReadyBatches<PendingDelete>());
+}
+
+SendMessageOutcomeCallable SQSBatchingBuffer::SendMessageCallable(const SendMessageRequest& request)
+{
+    auto promise = Aws::MakeShared<std::promise<SendMessageOutcome>>(BATCHING_CLASS_TAG);
+    SendMessageAsync(request, [promise](const SQSClient*, const SendMessageRequest&, const SendMessageOutcome& outcome,
+                                        const std::shared_ptr<const AsyncCallerContext>&) { promise->set_value(outcome); });
+    return promise->get_future();
+}
+
+void SQSBatchingBuffer::DeleteMessageAsync(const DeleteMessageRequest& request, const DeleteMessageResponseReceivedHandler& handler,
+                                           const std::shared_ptr<const AsyncCallerContext>& context)
+{
+    PendingDelete entry;
+    entry.request = request;
+    entry.handler = handler;
+    entry.context = context;
+
+    ReadyBatches<PendingDelete> ready;
+    {
+        std::lock_guard<std::mutex> locker(m_batchesLock);
+        AddEntry(m_deleteBatches, request.GetQueueUrl(), entry, 0, ready);
+    }
+    SendBatches(ReadyBatches<PendingSend>(), ready);
+}
+
+DeleteMessageOutcomeCallable SQSBatchingBuffer::DeleteMessageCallable(const DeleteMessageRequest& request)
+{
+    auto promise = Aws::MakeShared<std::promise<DeleteMessageOutcome>>(BATCHING_CLASS_TAG);
+    DeleteMessageAsync(request, [promise](const SQSClient*, const DeleteMessageRequest&, const DeleteMessageOutcome& outcome,
+                                          const std::shared_ptr<const AsyncCallerContext>&) { promise->set_value(outcome); });
+    return promise->get_future();
+}
+
+void SQSBatchingBuffer::Flush()
+{
+    ReadyBatches<PendingSend> sends;
+    ReadyBatches<PendingDelete> deletes;
+    {
+        std::lock_guard<std::mutex> locker(m_batchesLock);
+        auto nextSendAt = std::chrono::steady_clock::time_point::max();
+        TakeBatches(m_sendBatches, std::chrono::steady_clock::time_point::max(), sends, nextSendAt);
+        TakeBatches(m_deleteBatches, std::chrono::steady_clock::time_point::max(), deletes, nextSendAt);
+    }
+    SendBatches(sends, deletes);
+}
+
+template<typename ENTRY>
+void SQSBatchingBuffer::AddEntry(Aws::Map<Aws::String, PendingBatch<ENTRY>>& batches, const Aws::String& queueUrl, const ENTRY& entry,
+                                 size_t bytes, ReadyBatches<ENTRY>& ready)
+{
+    auto& batch = batches[queueUrl];
+    if (!batch.entries.empty() && batch.bytes + bytes > m_configuration.maxBatchBytes)
+    {
+        ready.emplace_back(queueUrl, std::move(batch.entries));
+        batch.entries.clear();
+        batch.bytes = 0;
+        ++m_outstandingBatches;
+    }
+
+    if (batch.entries.empty())
+    {
+        batch.sendAt = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_configuration.lingerMs);
+        // Later than any other batch's, so only a flush thread with nothing to wait for needs to know.
+        m_batchesSignal.notify_all();
+    }
+    batch.entries.push_back(entry);
+    batch.bytes += bytes;
+
+    if (batch.entries.size() >= m_configuration.maxBatchSize || batch.bytes >= m_configuration.maxBatchBytes)
+    {
+        ready.emplace_back(queueUrl, std::move(batch.entries));
+        batch.entries.clear();
+        batch.bytes = 0;
+        ++m_outstandingBatches;
+    }
+}
+
+template<typename ENTRY>
+void SQSBatchingBuffer::TakeBatches(Aws::Map<Aws::String, PendingBatch<ENTRY>>& batches, const std::chrono::steady_clock::time_point& sendBefore,
+                                    ReadyBatches<ENTRY>& ready, std::chrono::steady_clock::time_point& nextSendAt)
+{
+    for (auto batch = batches.begin(); batch != batches.end();)
+    {
+        if (batch->second.entries.empty())
+        {
+            batch = batches.erase(batch);
+        }
+        else if (batch->second.sendAt <= sendBefore)
+        {
+            ready.emplace_back(batch->first, std::move(batch->second.entries));
+            ++m_outstandingBatches;
+            batch = batches.erase(batch);
+        }
+        else
+        {
+            nextSendAt = (std::min)(nextSendAt, batch->second.sendAt);
+            ++batch;
+        }
+    }
+}
+
+void SQSBatchingBuffer::SendBatches(const ReadyBatches<PendingSend>& sends, const ReadyBatches<PendingDelete>& deletes)
+{
+    for (const auto& batch : sends)
+    {
+        SendBatch(batch.first, batch.second);
+    }
+    for (const auto& batch : deletes)
+    {
+        SendBatch(batch.first, batch.second);
+    }
+}
+
+void SQSBatchingBuffer::SendBatch(const Aws::String& queueUrl, const Aws::Vector<PendingSend>& entries)
+{
+    AWS_LOGSTREAM_TRACE(BATCHING_CLASS_TAG, "Sending a batch of " << entries.size() << " messages to " << queueUrl);
+    SendMessageBatchRequest request;
+    request.SetQueueUrl(queueUrl);
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        const auto& message = entries[i].request;
+        SendMessageBatchRequestEntry entry;
+        entry.SetId(StringUtils::to_string(i));
+        entry.SetMessageBody(message.GetMessageBody());
+        if (message.GetDelaySeconds() > 0)
+        {
+            entry.SetDelaySeconds(message.GetDelaySeconds());
+        }
+        if (!message.GetMessageAttributes().empty())
+        {
+            entry.SetMessageAttributes(message.GetMessageAttributes());
+        }
+        if (!message.GetMessageDeduplicationId().empty())
+        {
+            entry.SetMessageDeduplicationId(message.GetMessageDeduplicationId());
+        }
+        if (!message.GetMessageGroupId().empty())
+        {
+            entry.SetMessageGroupId(message.GetMessageGroupId());
+        }
+        request.AddEntries(entry);
+    }
+
+    m_client->SendMessageBatchAsync(request,
+        [this, entries](const SQSClient* client, const SendMessageBatchRequest&, const SendMessageBatchOutcome& outcome,
+                        const std::shared_ptr<const AsyncCallerContext>&)
+        {
+            if (!outcome.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(BATCHING_CLASS_TAG, "Send message batch failed with error: " << outcome.GetError().GetExceptionName()
+                    << " and message: " << outcome.GetError().GetMessage());
+            }
+
+            for (size_t i = 0; i < entries.size(); ++i)
+            {
+                auto id = StringUtils::to_string(i);
+                const SendMessageBatchResultEntry* succeeded = nullptr;
+                if (outcome.IsSuccess())
+                {
+                    for (const auto& successful : outcome.GetResult().GetSuccessful())
+                    {
+                        if (successful.GetId() == id)
+                        {
+                            succeeded = &successful;
+                            break;
+                        }
+                    }
+                }
+
+                if (succeeded)
+                {
+                    SendMessageResult result;
+                    result.SetMessageId(succeeded->GetMessageId());
+                    result.SetMD5OfMessageBody(succeeded->GetMD5OfMessageBody());
+                    result.SetMD5OfMessageAttributes(succeeded->GetMD5OfMessageAttributes());
+                    result.SetSequenceNumber(succeeded->GetSequenceNumber());
+                    entries[i].handler(client, entries[i].request, SendMessageOutcome(result), entries[i].context);
+                }
+                else
+                {
+                    entries[i].handler(client, entries[i].request, SendMessageOutcome(GetBatchEntryError(outcome, id)), entries[i].context);
+                }
+            }
+            OnBatchComplete();
+        });
+}
+
+void SQSBatchingBuffer::SendBatch(const Aws::String& queueUrl, const Aws::Vector<PendingDelete>& entries)
+{
+    AWS_LOGSTREAM_TRACE(BATCHING_CLASS_TAG, "Deleting a batch of " << entries.size() << " messages from " << queueUrl);
+    DeleteMessageBatchRequest request;
+    request.SetQueueUrl(queueUrl);
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        request.AddEntries(DeleteMessageBatchRequestEntry().WithId(StringUtils::to_string(i))
+            .WithReceiptHandle(entries[i].request.GetReceiptHandle()));
+    }
+
+    m_client->DeleteMessageBatchAsync(request,
+        [this, entries](const SQSClient* client, const DeleteMessageBatchRequest&, const DeleteMessageBatchOutcome& outcome,
+                        const std::shared_ptr<const AsyncCallerContext>&)
+        {
+            if (!outcome.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(BATCHING_CLASS_TAG, "Delete message batch failed with error: " << outcome.GetError().GetExceptionName()
+                    << " and message: " << outcome.GetError().GetMessage());
+            }
+
+            for (size_t i = 0; i < entries.size(); ++i)
+            {
+                auto id = StringUtils::to_string(i);
+                bool succeeded = outcome.IsSuccess() && std::any_of(outcome.GetResult().GetSuccessful().begin(), outcome.GetResult().GetSuccessful().end(),
+                    [&id](const DeleteMessageBatchResultEntry& successful) { return successful.GetId() == id; });
+
+                if (succeeded)
+                {
+                    entries[i].handler(client, entries[i].request, DeleteMessageOutcome(NoResult()), entries[i].context);
+                }
+                else
+                {
+                    entries[i].handler(client, entries[i].request, DeleteMessageOutcome(GetBatchEntryError(outcome, id)), entries[i].context);
+                }
+            }
+            OnBatchComplete();
+        });
+}
+
+void SQSBatchingBuffer::OnBatchComplete()
+{
+    std::lock_guard<std::mutex> locker(m_batchesLock);
+    --m_outstandingBatches;
+    m_batchesSignal.notify_all();
+}
+
+void SQSBatchingBuffer::FlushLoop()
+{
+    std::unique_lock<std::mutex> locker(m_batchesLock);
+    while (m_running)
+    {
+        ReadyBatches<PendingSend> sends;
+        ReadyBatches<PendingDelete> deletes;
+        auto now = std::chrono::steady_clock::now();
+        auto nextSendAt = std::chrono::steady_clock::time_point::max();
+        TakeBatches(m_sendBatches, now, sends, nextSendAt);
+        TakeBatches(m_deleteBatches, now, deletes, nextSendAt);
+
+        if (!sends.empty() || !deletes.empty())
+        {
+            locker.unlock();
+            SendBatches(sends, deletes);
+            locker.lock();
+        }
+        else if (nextSendAt == std::chrono::steady_clock::time_point::max())
+        {
+            m_batchesSignal.wait(locker);
+        }
+        else
+        {
+            m_batchesSignal.wait_until(locker, nextSendAt);
+        }
+    }
+}
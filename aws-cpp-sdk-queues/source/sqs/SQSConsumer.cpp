@@ -0,0 +1,438 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/queues/sqs/SQSConsumer.h>
+#include <aws/sqs/model/ReceiveMessageRequest.h>
+#include <aws/sqs/model/DeleteMessageBatchRequest.h>
+#include <aws/sqs/model/ChangeMessageVisibilityBatchRequest.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+
+using namespace Aws::SQS;
+using namespace Aws::SQS::Model;
+using namespace Aws::Queues::Sqs;
+using namespace Aws::Utils;
+
+static const char* CONSUMER_CLASS_TAG = "Aws::Queues::Sqs::SQSConsumer";
+// most entries SQS accepts in a receive or batch call.
+static const size_t SQS_MAX_BATCH_SIZE = 10;
+static const long MAX_MAINTENANCE_INTERVAL_MS = 1000;
+static const long RECEIVE_ERROR_BACKOFF_MS = 1000;
+
+SQSConsumerConfiguration::SQSConsumerConfiguration() :
+    receiverThreads(4),
+    handlerThreads(16),
+    maxMessagesInFlight(200),
+    waitTimeSeconds(20),
+    visibilityTimeoutSeconds(30),
+    deleteLingerMs(100),
+    statisticsIntervalMs(1000)
+{
+}
+
+SQSConsumer::SQSConsumer(const std::shared_ptr<SQSClient>& client, const Aws::String& queueUrl,
+                         const SQSConsumerConfiguration& configuration) :
+    m_client(client),
+    m_queueUrl(queueUrl),
+    m_configuration(configuration),
+    m_receiving(false),
+    m_maintaining(false),
+    m_reservedSlots(0),
+    m_outstandingBatches(0),
+    m_received(0),
+    m_handled(0),
+    m_deleted(0),
+    m_failedDeletes(0),
+    m_visibilityExtensions(0),
+    m_maxLagMs(0)
+{
+    m_configuration.receiverThreads = (std::max)(m_configuration.receiverThreads, static_cast<size_t>(1));
+    m_configuration.handlerThreads = (std::max)(m_configuration.handlerThreads, static_cast<size_t>(1));
+    m_configuration.maxMessagesInFlight = (std::max)(m_configuration.maxMessagesInFlight, static_cast<size_t>(1));
+    m_configuration.visibilityTimeoutSeconds = (std::max)(m_configuration.visibilityTimeoutSeconds, 1);
+    m_configuration.deleteLingerMs = (std::max)(m_configuration.deleteLingerMs, 0L);
+    m_configuration.statisticsIntervalMs = (std::max)(m_configuration.statisticsIntervalMs, 1L);
+}
+
+SQSConsumer::~SQSConsumer()
+{
+    Stop();
+}
+
+void SQSConsumer::Start()
+{
+    if (!m_receiverThreads.empty())
+    {
+        return;
+    }
+
+    AWS_LOGSTREAM_INFO(CONSUMER_CLASS_TAG, "Starting to consume queue " << m_queueUrl << " with " << m_configuration.receiverThreads
+        << " receivers and " << m_configuration.handlerThreads << " handler threads.");
+    m_handlerExecutor = Aws::MakeUnique<Aws::Utils::Threading::PooledThreadExecutor>(CONSUMER_CLASS_TAG, m_configuration.handlerThreads);
+    m_receiving = true;
+    m_maintaining = true;
+    m_maintenanceThread = std::thread(&SQSConsumer::MaintenanceLoop, this);
+    for (size_t i = 0; i < m_configuration.receiverThreads; ++i)
+    {
+        m_receiverThreads.emplace_back(&SQSConsumer::ReceiveLoop, this);
+    }
+}
+
+void SQSConsumer::Stop()
+{
+    if (m_receiverThreads.empty())
+    {
+        return;
+    }
+
+    AWS_LOGSTREAM_INFO(CONSUMER_CLASS_TAG, "Stopping to consume queue " << m_queueUrl);
+    m_receiving = false;
+    {
+        std::lock_guard<std::mutex> locker(m_inFlightLock);
+        m_inFlightSignal.notify_all();
+    }
+    for (auto& receiverThread : m_receiverThreads)
+    {
+        receiverThread.join();
+    }
+    m_receiverThreads.clear();
+
+    // The maintenance thread keeps deleting the messages handled and extending the visibility of the others meanwhile.
+    {
+        std::unique_lock<std::mutex> locker(m_inFlightLock);
+        m_inFlightSignal.wait(locker, [this] { return m_inFlight.empty() && m_outstandingBatches == 0; });
+        m_maintaining = false;
+        m_inFlightSignal.notify_all();
+    }
+    m_maintenanceThread.join();
+    m_handlerExecutor = nullptr;
+    AWS_LOGSTREAM_INFO(CONSUMER_CLASS_TAG, "Stopped consuming queue " << m_queueUrl);
+}
+
+SQSConsumerStatistics SQSConsumer::GetStatistics() const
+{
+    std::lock_guard<std::mutex> locker(m_inFlightLock);
+    return m_statistics;
+}
+
+void SQSConsumer::ReceiveLoop()
+{
+    const size_t batchSize = (std::min)(SQS_MAX_BATCH_SIZE, m_configuration.maxMessagesInFlight);
+
+    ReceiveMessageRequest request;
+    request.SetQueueUrl(m_queueUrl);
+    request.SetMaxNumberOfMessages(static_cast<int>(batchSize));
+    request.SetWaitTimeSeconds(m_configuration.waitTimeSeconds);
+    request.SetVisibilityTimeout(m_configuration.visibilityTimeoutSeconds);
+    request.AddAttributeNames(QueueAttributeName::SentTimestamp);
+    // Aborts the long poll in progress as soon as Stop() is called.
+    request.SetContinueRequestHandler([this](const Aws::Http::HttpRequest*) { return m_receiving.load(); });
+
+    while (m_receiving)
+    {
+        {
+            std::unique_lock<std::mutex> locker(m_inFlightLock);
+            m_inFlightSignal.wait(locker, [&] {
+                return !m_receiving || m_inFlight.size() + m_reservedSlots + batchSize <= m_configuration.maxMessagesInFlight;
+            });
+            if (!m_receiving)
+            {
+                break;
+            }
+            m_reservedSlots += batchSize;
+        }
+
+        auto receivedAt = std::chrono::steady_clock::now();
+        auto outcome = m_client->ReceiveMessage(request);
+
+        Aws::Vector<InFlightMessagePtr> received;
+        if (outcome.IsSuccess())
+        {
+            auto nowMs = DateTime::CurrentTimeMillis();
+            for (const auto& message : outcome.GetResult().GetMessages())
+            {
+                auto inFlightMessage = Aws::MakeShared<InFlightMessage>(CONSUMER_CLASS_TAG);
+                inFlightMessage->message = message;
+                inFlightMessage->visibleUntil = receivedAt + std::chrono::seconds(m_configuration.visibilityTimeoutSeconds);
+                inFlightMessage->handled = false;
+                inFlightMessage->extendingVisibility = false;
+                received.push_back(inFlightMessage);
+
+                auto sentTimestamp = message.GetAttributes().find(MessageSystemAttributeName::SentTimestamp);
+                if (sentTimestamp != message.GetAttributes().end())
+                {
+                    long long lagMs = nowMs - StringUtils::ConvertToInt64(sentTimestamp->second.c_str());
+                    long long maxLagMs = m_maxLagMs.load();
+                    while (lagMs > maxLagMs && !m_maxLagMs.compare_exchange_weak(maxLagMs, lagMs)) {}
+                }
+            }
+            m_received += received.size();
+        }
+
+        {
+            std::unique_lock<std::mutex> locker(m_inFlightLock);
+            m_reservedSlots -= batchSize;
+            for (const auto& inFlightMessage : received)
+            {
+                m_inFlight[inFlightMessage->message.GetReceiptHandle()] = inFlightMessage;
+            }
+            m_inFlightSignal.notify_all();
+
+            if (!outcome.IsSuccess() && m_receiving)
+            {
+                AWS_LOGSTREAM_ERROR(CONSUMER_CLASS_TAG, "Error receiving messages from queue " << m_queueUrl << ": "
+                    << outcome.GetError().GetExceptionName() << " " << outcome.GetError().GetMessage());
+                m_inFlightSignal.wait_for(locker, std::chrono::milliseconds(RECEIVE_ERROR_BACKOFF_MS), [this] { return !m_receiving; });
+            }
+        }
+
+        for (const auto& inFlightMessage : received)
+        {
+            m_handlerExecutor->Submit(&SQSConsumer::HandleMessage, this, inFlightMessage);
+        }
+    }
+}
+
+void SQSConsumer::HandleMessage(const InFlightMessagePtr& inFlightMessage)
+{
+    bool deleteMessage = false;
+    if (m_messageReceivedHandler)
+    {
+        m_messageReceivedHandler(this, inFlightMessage->message, deleteMessage);
+    }
+    ++m_handled;
+
+    Aws::Vector<InFlightMessagePtr> deleteBatch;
+    {
+        std::lock_guard<std::mutex> locker(m_inFlightLock);
+        inFlightMessage->handled = true;
+        if (deleteMessage)
+        {
+            if (m_pendingDeletes.empty())
+            {
+                m_oldestPendingDelete = std::chrono::steady_clock::now();
+            }
+            m_pendingDeletes.push_back(inFlightMessage);
+            if (m_pendingDeletes.size() >= SQS_MAX_BATCH_SIZE)
+            {
+                deleteBatch.swap(m_pendingDeletes);
+                ++m_outstandingBatches;
+            }
+        }
+        else
+        {
+            m_inFlight.erase(inFlightMessage->message.GetReceiptHandle());
+            m_inFlightSignal.notify_all();
+        }
+    }
+
+    if (!deleteBatch.empty())
+    {
+        SendDeleteBatch(deleteBatch);
+    }
+}
+
+void SQSConsumer::SendDeleteBatch(const Aws::Vector<InFlightMessagePtr>& messages)
+{
+    DeleteMessageBatchRequest request;
+    request.SetQueueUrl(m_queueUrl);
+    for (size_t i = 0; i < messages.size(); ++i)
+    {
+        request.AddEntries(DeleteMessageBatchRequestEntry().WithId(StringUtils::to_string(i))
+            .WithReceiptHandle(messages[i]->message.GetReceiptHandle()));
+    }
+
+    m_client->DeleteMessageBatchAsync(request,
+        [this, messages](const SQSClient*, const DeleteMessageBatchRequest&, const DeleteMessageBatchOutcome& outcome,
+                         const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+        {
+            Aws::Set<Aws::String> failedIds;
+            if (outcome.IsSuccess())
+            {
+                for (const auto& failed : outcome.GetResult().GetFailed())
+                {
+                    AWS_LOGSTREAM_ERROR(CONSUMER_CLASS_TAG, "Failed to delete message from queue " << m_queueUrl << ": "
+                        << failed.GetCode() << " " << failed.GetMessage());
+                    failedIds.insert(failed.GetId());
+                }
+            }
+            else
+            {
+                AWS_LOGSTREAM_ERROR(CONSUMER_CLASS_TAG, "Failed to delete " << messages.size() << " messages from queue " << m_queueUrl
+                    << ": " << outcome.GetError().GetExceptionName() << " " << outcome.GetError().GetMessage());
+            }
+
+            for (size_t i = 0; i < messages.size(); ++i)
+            {
+                if (outcome.IsSuccess() && failedIds.find(StringUtils::to_string(i)) == failedIds.end())
+                {
+                    ++m_deleted;
+                    if (m_messageDeleteSuccessHandler)
+                    {
+                        m_messageDeleteSuccessHandler(this, messages[i]->message);
+                    }
+                }
+                else
+                {
+                    ++m_failedDeletes;
+                    if (m_messageDeleteFailedHandler)
+                    {
+                        m_messageDeleteFailedHandler(this, messages[i]->message);
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> locker(m_inFlightLock);
+            for (const auto& message : messages)
+            {
+                m_inFlight.erase(message->message.GetReceiptHandle());
+            }
+            --m_outstandingBatches;
+            m_inFlightSignal.notify_all();
+        });
+}
+
+void SQSConsumer::SendVisibilityBatch(const Aws::Vector<InFlightMessagePtr>& messages)
+{
+    ChangeMessageVisibilityBatchRequest request;
+    request.SetQueueUrl(m_queueUrl);
+    for (size_t i = 0; i < messages.size(); ++i)
+    {
+        request.AddEntries(ChangeMessageVisibilityBatchRequestEntry().WithId(StringUtils::to_string(i))
+            .WithReceiptHandle(messages[i]->message.GetReceiptHandle())
+            .WithVisibilityTimeout(m_configuration.visibilityTimeoutSeconds));
+    }
+
+    auto requestedAt = std::chrono::steady_clock::now();
+    m_client->ChangeMessageVisibilityBatchAsync(request,
+        [this, messages, requestedAt](const SQSClient*, const ChangeMessageVisibilityBatchRequest&,
+                                      const ChangeMessageVisibilityBatchOutcome& outcome,
+                                      const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+        {
+            Aws::Set<Aws::String> failedIds;
+            if (outcome.IsSuccess())
+            {
+                for (const auto& failed : outcome.GetResult().GetFailed())
+                {
+                    AWS_LOGSTREAM_WARN(CONSUMER_CLASS_TAG, "Failed to extend the visibility timeout of a message from queue "
+                        << m_queueUrl << ": " << failed.GetCode() << " " << failed.GetMessage());
+                    failedIds.insert(failed.GetId());
+                }
+            }
+            else
+            {
+                AWS_LOGSTREAM_WARN(CONSUMER_CLASS_TAG, "Failed to extend the visibility timeout of " << messages.size()
+                    << " messages from queue " << m_queueUrl << ": " << outcome.GetError().GetExceptionName() << " "
+                    << outcome.GetError().GetMessage());
+            }
+
+            std::lock_guard<std::mutex> locker(m_inFlightLock);
+            for (size_t i = 0; i < messages.size(); ++i)
+            {
+                // A failed message is tried again on the next pass, until its visibility timeout expires.
+                if (outcome.IsSuccess() && failedIds.find(StringUtils::to_string(i)) == failedIds.end())
+                {
+                    messages[i]->visibleUntil = requestedAt + std::chrono::seconds(m_configuration.visibilityTimeoutSeconds);
+                    ++m_visibilityExtensions;
+                }
+                messages[i]->extendingVisibility = false;
+            }
+            --m_outstandingBatches;
+            m_inFlightSignal.notify_all();
+        });
+}
+
+void SQSConsumer::MaintenanceLoop()
+{
+    const long tickMs = (std::max)(1L, (std::min)(m_configuration.deleteLingerMs, MAX_MAINTENANCE_INTERVAL_MS));
+    const auto linger = std::chrono::milliseconds(m_configuration.deleteLingerMs);
+    const auto extendBefore = std::chrono::milliseconds(m_configuration.visibilityTimeoutSeconds * 500LL);
+    auto statisticsStart = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> locker(m_inFlightLock);
+    while (m_maintaining)
+    {
+        m_inFlightSignal.wait_for(locker, std::chrono::milliseconds(tickMs), [this] { return !m_maintaining; });
+        auto now = std::chrono::steady_clock::now();
+
+        // Once Stop() is called no more messages come to fill the batch, so there is no point in lingering.
+        Aws::Vector<Aws::Vector<InFlightMessagePtr>> deleteBatches;
+        if (!m_pendingDeletes.empty() && (!m_receiving || now - m_oldestPendingDelete >= linger))
+        {
+            for (size_t i = 0; i < m_pendingDeletes.size(); i += SQS_MAX_BATCH_SIZE)
+            {
+                auto end = m_pendingDeletes.begin() + (std::min)(i + SQS_MAX_BATCH_SIZE, m_pendingDeletes.size());
+                deleteBatches.emplace_back(m_pendingDeletes.begin() + i, end);
+            }
+            m_pendingDeletes.clear();
+        }
+
+        Aws::Vector<Aws::Vector<InFlightMessagePtr>> visibilityBatches;
+        for (const auto& inFlight : m_inFlight)
+        {
+            const auto& inFlightMessage = inFlight.second;
+            if (!inFlightMessage->handled && !inFlightMessage->extendingVisibility && inFlightMessage->visibleUntil - now <= extendBefore)
+            {
+                if (visibilityBatches.empty() || visibilityBatches.back().size() == SQS_MAX_BATCH_SIZE)
+                {
+                    visibilityBatches.emplace_back();
+                }
+                visibilityBatches.back().push_back(inFlightMessage);
+                inFlightMessage->extendingVisibility = true;
+            }
+        }
+        m_outstandingBatches += deleteBatches.size() + visibilityBatches.size();
+
+        bool reportStatistics = now - statisticsStart >= std::chrono::milliseconds(m_configuration.statisticsIntervalMs);
+        if (reportStatistics)
+        {
+            double seconds = std::chrono::duration<double>(now - statisticsStart).count();
+            statisticsStart = now;
+            m_statistics.receivedPerSecond = m_received.exchange(0) / seconds;
+            m_statistics.handledPerSecond = m_handled.exchange(0) / seconds;
+            m_statistics.deletedPerSecond = m_deleted.exchange(0) / seconds;
+            m_statistics.failedDeletes = m_failedDeletes.exchange(0);
+            m_statistics.visibilityExtensions = m_visibilityExtensions.exchange(0);
+            m_statistics.messagesInFlight = m_inFlight.size();
+            m_statistics.maxLagMs = m_maxLagMs.exchange(0);
+        }
+        SQSConsumerStatistics statistics = m_statistics;
+
+        locker.unlock();
+        for (const auto& batch : deleteBatches)
+        {
+            SendDeleteBatch(batch);
+        }
+        for (const auto& batch : visibilityBatches)
+        {
+            SendVisibilityBatch(batch);
+        }
+        if (reportStatistics)
+        {
+            AWS_LOGSTREAM_DEBUG(CONSUMER_CLASS_TAG, "Queue " << m_queueUrl << ": received " << statistics.receivedPerSecond
+                << "/s, handled " << statistics.handledPerSecond << "/s, deleted " << statistics.deletedPerSecond << "/s, "
+                << statistics.messagesInFlight << " in flight, max lag " << statistics.maxLagMs << "ms");
+            if (m_statisticsHandler)
+            {
+                m_statisticsHandler(this, statistics);
+            }
+        }
+        locker.lock();
+    }
+}
@@ -100,8 +100,16 @@ void SQSQueue::Delete(const Message& message)
         deleteMessageRequest.SetReceiptHandle(message.GetReceiptHandle());
 
 	std::shared_ptr<AsyncCallerContext> deleteMessageContext = Aws::MakeShared<QueueMessageContext>(CLASS_TAG, message);
-        m_client->DeleteMessageAsync(deleteMessageRequest, std::bind(&SQSQueue::OnMessageDeletedOutcomeReceived, this, std::placeholders::_1,
-                                                                     std::placeholders::_2, std::placeholders::_3, std::placeholders::_4), deleteMessageContext);
+        auto onDeleted = std::bind(&SQSQueue::OnMessageDeletedOutcomeReceived, this, std::placeholders::_1,
+                                   std::placeholders::_2, std::placeholders::_3, std::placeholders::_4);
+        if (m_batchingBuffer)
+        {
+            m_batchingBuffer->DeleteMessageAsync(deleteMessageRequest, onDeleted, deleteMessageContext);
+        }
+        else
+        {
+            m_client->DeleteMessageAsync(deleteMessageRequest, onDeleted, deleteMessageContext);
+        }
     }
     else
     {
@@ -121,8 +129,16 @@ void SQSQueue::Push(const Message& message)
 
        std::shared_ptr<AsyncCallerContext> sendMessageContext = Aws::MakeShared<QueueMessageContext>(CLASS_TAG, message);
 
-       m_client->SendMessageAsync(sendMessageRequest, std::bind(&SQSQueue::OnMessageSentOutcomeReceived, this, std::placeholders::_1,
-                                                                std::placeholders::_2, std::placeholders::_3, std::placeholders::_4), sendMessageContext);
+       auto onSent = std::bind(&SQSQueue::OnMessageSentOutcomeReceived, this, std::placeholders::_1,
+                               std::placeholders::_2, std::placeholders::_3, std::placeholders::_4);
+       if (m_batchingBuffer)
+       {
+           m_batchingBuffer->SendMessageAsync(sendMessageRequest, onSent, sendMessageContext);
+       }
+       else
+       {
+           m_client->SendMessageAsync(sendMessageRequest, onSent, sendMessageContext);
+       }
    }
     else
    {
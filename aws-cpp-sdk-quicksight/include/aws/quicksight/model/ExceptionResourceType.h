@@ -40,6 +40,11 @@ namespace ExceptionResourceTypeMapper
 AWS_QUICKSIGHT_API ExceptionResourceType GetExceptionResourceTypeForName(const Aws::String& name);
 
 AWS_QUICKSIGHT_API Aws::String GetNameForExceptionResourceType(ExceptionResourceType value);
+
+/**
+ * Same as GetNameForExceptionResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_QUICKSIGHT_API const char* GetNameForExceptionResourceTypeCStr(ExceptionResourceType value);
 } // namespace ExceptionResourceTypeMapper
 } // namespace Model
 } // namespace QuickSight
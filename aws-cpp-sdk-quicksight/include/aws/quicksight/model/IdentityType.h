@@ -35,6 +35,11 @@ namespace IdentityTypeMapper
 AWS_QUICKSIGHT_API IdentityType GetIdentityTypeForName(const Aws::String& name);
 
 AWS_QUICKSIGHT_API Aws::String GetNameForIdentityType(IdentityType value);
+
+/**
+ * Same as GetNameForIdentityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_QUICKSIGHT_API const char* GetNameForIdentityTypeCStr(IdentityType value);
 } // namespace IdentityTypeMapper
 } // namespace Model
 } // namespace QuickSight
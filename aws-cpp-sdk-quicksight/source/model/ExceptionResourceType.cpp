@@ -30,45 +30,72 @@ namespace Aws
       namespace ExceptionResourceTypeMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int GROUP_HASH = HashingUtils::HashString("GROUP");
-        static const int NAMESPACE_HASH = HashingUtils::HashString("NAMESPACE");
-        static const int DATA_SOURCE_HASH = HashingUtils::HashString("DATA_SOURCE");
-        static const int DATA_SET_HASH = HashingUtils::HashString("DATA_SET");
-        static const int VPC_CONNECTION_HASH = HashingUtils::HashString("VPC_CONNECTION");
-        static const int INGESTION_HASH = HashingUtils::HashString("INGESTION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USER",
+          "GROUP",
+          "NAMESPACE",
+          "DATA_SOURCE",
+          "DATA_SET",
+          "VPC_CONNECTION",
+          "INGESTION",
+        };
 
         ExceptionResourceType GetExceptionResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
-          {
-            return ExceptionResourceType::USER;
-          }
-          else if (hashCode == GROUP_HASH)
-          {
-            return ExceptionResourceType::GROUP;
-          }
-          else if (hashCode == NAMESPACE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExceptionResourceType::NAMESPACE;
-          }
-          else if (hashCode == DATA_SOURCE_HASH)
-          {
-            return ExceptionResourceType::DATA_SOURCE;
-          }
-          else if (hashCode == DATA_SET_HASH)
-          {
-            return ExceptionResourceType::DATA_SET;
-          }
-          else if (hashCode == VPC_CONNECTION_HASH)
-          {
-            return ExceptionResourceType::VPC_CONNECTION;
-          }
-          else if (hashCode == INGESTION_HASH)
-          {
-            return ExceptionResourceType::INGESTION;
+          case 2614219:
+            if (name == "USER")
+            {
+              return ExceptionResourceType::USER;
+            }
+            break;
+          case 68091487:
+            if (name == "GROUP")
+            {
+              return ExceptionResourceType::GROUP;
+            }
+            break;
+          case -256154309:
+            if (name == "NAMESPACE")
+            {
+              return ExceptionResourceType::NAMESPACE;
+            }
+            break;
+          case -845586864:
+            if (name == "DATA_SOURCE")
+            {
+              return ExceptionResourceType::DATA_SOURCE;
+            }
+            break;
+          case -1721994707:
+            if (name == "DATA_SET")
+            {
+              return ExceptionResourceType::DATA_SET;
+            }
+            break;
+          case -1669411820:
+            if (name == "VPC_CONNECTION")
+            {
+              return ExceptionResourceType::VPC_CONNECTION;
+            }
+            break;
+          case 342953732:
+            if (name == "INGESTION")
+            {
+              return ExceptionResourceType::INGESTION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ExceptionResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForExceptionResourceType(ExceptionResourceType enumValue)
+        const char* GetNameForExceptionResourceTypeCStr(ExceptionResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExceptionResourceType::USER:
-            return "USER";
-          case ExceptionResourceType::GROUP:
-            return "GROUP";
-          case ExceptionResourceType::NAMESPACE:
-            return "NAMESPACE";
-          case ExceptionResourceType::DATA_SOURCE:
-            return "DATA_SOURCE";
-          case ExceptionResourceType::DATA_SET:
-            return "DATA_SET";
-          case ExceptionResourceType::VPC_CONNECTION:
-            return "VPC_CONNECTION";
-          case ExceptionResourceType::INGESTION:
-            return "INGESTION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExceptionResourceType(ExceptionResourceType enumValue)
+        {
+          return GetNameForExceptionResourceTypeCStr(enumValue);
         }
 
       } // namespace ExceptionResourceTypeMapper
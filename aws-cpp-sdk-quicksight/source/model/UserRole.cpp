@@ -30,35 +30,58 @@ namespace Aws
       namespace UserRoleMapper
       {
 
-        static const int ADMIN_HASH = HashingUtils::HashString("ADMIN");
-        static const int AUTHOR_HASH = HashingUtils::HashString("AUTHOR");
-        static const int READER_HASH = HashingUtils::HashString("READER");
-        static const int RESTRICTED_AUTHOR_HASH = HashingUtils::HashString("RESTRICTED_AUTHOR");
-        static const int RESTRICTED_READER_HASH = HashingUtils::HashString("RESTRICTED_READER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADMIN",
+          "AUTHOR",
+          "READER",
+          "RESTRICTED_AUTHOR",
+          "RESTRICTED_READER",
+        };
 
         UserRole GetUserRoleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADMIN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UserRole::ADMIN;
-          }
-          else if (hashCode == AUTHOR_HASH)
-          {
-            return UserRole::AUTHOR;
-          }
-          else if (hashCode == READER_HASH)
-          {
-            return UserRole::READER;
-          }
-          else if (hashCode == RESTRICTED_AUTHOR_HASH)
-          {
-            return UserRole::RESTRICTED_AUTHOR;
-          }
-          else if (hashCode == RESTRICTED_READER_HASH)
-          {
-            return UserRole::RESTRICTED_READER;
+          case 62130991:
+            if (name == "ADMIN")
+            {
+              return UserRole::ADMIN;
+            }
+            break;
+          case 1941968267:
+            if (name == "AUTHOR")
+            {
+              return UserRole::AUTHOR;
+            }
+            break;
+          case -1881649981:
+            if (name == "READER")
+            {
+              return UserRole::READER;
+            }
+            break;
+          case 1017745903:
+            if (name == "RESTRICTED_AUTHOR")
+            {
+              return UserRole::RESTRICTED_AUTHOR;
+            }
+            break;
+          case 1489094951:
+            if (name == "RESTRICTED_READER")
+            {
+              return UserRole::RESTRICTED_READER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return UserRole::NOT_SET;
         }
 
-        Aws::String GetNameForUserRole(UserRole enumValue)
+        const char* GetNameForUserRoleCStr(UserRole enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UserRole::ADMIN:
-            return "ADMIN";
-          case UserRole::AUTHOR:
-            return "AUTHOR";
-          case UserRole::READER:
-            return "READER";
-          case UserRole::RESTRICTED_AUTHOR:
-            return "RESTRICTED_AUTHOR";
-          case UserRole::RESTRICTED_READER:
-            return "RESTRICTED_READER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUserRole(UserRole enumValue)
+        {
+          return GetNameForUserRoleCStr(enumValue);
         }
 
       } // namespace UserRoleMapper
@@ -35,6 +35,11 @@ namespace ResourceOwnerMapper
 AWS_RAM_API ResourceOwner GetResourceOwnerForName(const Aws::String& name);
 
 AWS_RAM_API Aws::String GetNameForResourceOwner(ResourceOwner value);
+
+/**
+ * Same as GetNameForResourceOwner(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_RAM_API const char* GetNameForResourceOwnerCStr(ResourceOwner value);
 } // namespace ResourceOwnerMapper
 } // namespace Model
 } // namespace RAM
@@ -38,6 +38,11 @@ namespace ResourceShareAssociationStatusMapper
 AWS_RAM_API ResourceShareAssociationStatus GetResourceShareAssociationStatusForName(const Aws::String& name);
 
 AWS_RAM_API Aws::String GetNameForResourceShareAssociationStatus(ResourceShareAssociationStatus value);
+
+/**
+ * Same as GetNameForResourceShareAssociationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_RAM_API const char* GetNameForResourceShareAssociationStatusCStr(ResourceShareAssociationStatus value);
 } // namespace ResourceShareAssociationStatusMapper
 } // namespace Model
 } // namespace RAM
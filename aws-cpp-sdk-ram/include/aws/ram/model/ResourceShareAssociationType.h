@@ -35,6 +35,11 @@ namespace ResourceShareAssociationTypeMapper
 AWS_RAM_API ResourceShareAssociationType GetResourceShareAssociationTypeForName(const Aws::String& name);
 
 AWS_RAM_API Aws::String GetNameForResourceShareAssociationType(ResourceShareAssociationType value);
+
+/**
+ * Same as GetNameForResourceShareAssociationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_RAM_API const char* GetNameForResourceShareAssociationTypeCStr(ResourceShareAssociationType value);
 } // namespace ResourceShareAssociationTypeMapper
 } // namespace Model
 } // namespace RAM
@@ -37,6 +37,11 @@ namespace ResourceShareInvitationStatusMapper
 AWS_RAM_API ResourceShareInvitationStatus GetResourceShareInvitationStatusForName(const Aws::String& name);
 
 AWS_RAM_API Aws::String GetNameForResourceShareInvitationStatus(ResourceShareInvitationStatus value);
+
+/**
+ * Same as GetNameForResourceShareInvitationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_RAM_API const char* GetNameForResourceShareInvitationStatusCStr(ResourceShareInvitationStatus value);
 } // namespace ResourceShareInvitationStatusMapper
 } // namespace Model
 } // namespace RAM
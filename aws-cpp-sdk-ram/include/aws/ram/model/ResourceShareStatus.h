@@ -38,6 +38,11 @@ namespace ResourceShareStatusMapper
 AWS_RAM_API ResourceShareStatus GetResourceShareStatusForName(const Aws::String& name);
 
 AWS_RAM_API Aws::String GetNameForResourceShareStatus(ResourceShareStatus value);
+
+/**
+ * Same as GetNameForResourceShareStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_RAM_API const char* GetNameForResourceShareStatusCStr(ResourceShareStatus value);
 } // namespace ResourceShareStatusMapper
 } // namespace Model
 } // namespace RAM
@@ -30,20 +30,37 @@ namespace Aws
       namespace ResourceOwnerMapper
       {
 
-        static const int SELF_HASH = HashingUtils::HashString("SELF");
-        static const int OTHER_ACCOUNTS_HASH = HashingUtils::HashString("OTHER-ACCOUNTS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SELF",
+          "OTHER-ACCOUNTS",
+        };
 
         ResourceOwner GetResourceOwnerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SELF_HASH)
-          {
-            return ResourceOwner::SELF;
-          }
-          else if (hashCode == OTHER_ACCOUNTS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceOwner::OTHER_ACCOUNTS;
+          case 2541388:
+            if (name == "SELF")
+            {
+              return ResourceOwner::SELF;
+            }
+            break;
+          case 1088124451:
+            if (name == "OTHER-ACCOUNTS")
+            {
+              return ResourceOwner::OTHER_ACCOUNTS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ResourceOwner::NOT_SET;
         }
 
-        Aws::String GetNameForResourceOwner(ResourceOwner enumValue)
+        const char* GetNameForResourceOwnerCStr(ResourceOwner enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceOwner::SELF:
-            return "SELF";
-          case ResourceOwner::OTHER_ACCOUNTS:
-            return "OTHER-ACCOUNTS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceOwner(ResourceOwner enumValue)
+        {
+          return GetNameForResourceOwnerCStr(enumValue);
         }
 
       } // namespace ResourceOwnerMapper
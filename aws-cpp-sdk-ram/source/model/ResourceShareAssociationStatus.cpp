@@ -30,35 +30,58 @@ namespace Aws
       namespace ResourceShareAssociationStatusMapper
       {
 
-        static const int ASSOCIATING_HASH = HashingUtils::HashString("ASSOCIATING");
-        static const int ASSOCIATED_HASH = HashingUtils::HashString("ASSOCIATED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int DISASSOCIATING_HASH = HashingUtils::HashString("DISASSOCIATING");
-        static const int DISASSOCIATED_HASH = HashingUtils::HashString("DISASSOCIATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ASSOCIATING",
+          "ASSOCIATED",
+          "FAILED",
+          "DISASSOCIATING",
+          "DISASSOCIATED",
+        };
 
         ResourceShareAssociationStatus GetResourceShareAssociationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASSOCIATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceShareAssociationStatus::ASSOCIATING;
-          }
-          else if (hashCode == ASSOCIATED_HASH)
-          {
-            return ResourceShareAssociationStatus::ASSOCIATED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ResourceShareAssociationStatus::FAILED;
-          }
-          else if (hashCode == DISASSOCIATING_HASH)
-          {
-            return ResourceShareAssociationStatus::DISASSOCIATING;
-          }
-          else if (hashCode == DISASSOCIATED_HASH)
-          {
-            return ResourceShareAssociationStatus::DISASSOCIATED;
+          case 2065461307:
+            if (name == "ASSOCIATING")
+            {
+              return ResourceShareAssociationStatus::ASSOCIATING;
+            }
+            break;
+          case -1873035002:
+            if (name == "ASSOCIATED")
+            {
+              return ResourceShareAssociationStatus::ASSOCIATED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ResourceShareAssociationStatus::FAILED;
+            }
+            break;
+          case -67406067:
+            if (name == "DISASSOCIATING")
+            {
+              return ResourceShareAssociationStatus::DISASSOCIATING;
+            }
+            break;
+          case 1660393460:
+            if (name == "DISASSOCIATED")
+            {
+              return ResourceShareAssociationStatus::DISASSOCIATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ResourceShareAssociationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForResourceShareAssociationStatus(ResourceShareAssociationStatus enumValue)
+        const char* GetNameForResourceShareAssociationStatusCStr(ResourceShareAssociationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceShareAssociationStatus::ASSOCIATING:
-            return "ASSOCIATING";
-          case ResourceShareAssociationStatus::ASSOCIATED:
-            return "ASSOCIATED";
-          case ResourceShareAssociationStatus::FAILED:
-            return "FAILED";
-          case ResourceShareAssociationStatus::DISASSOCIATING:
-            return "DISASSOCIATING";
-          case ResourceShareAssociationStatus::DISASSOCIATED:
-            return "DISASSOCIATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceShareAssociationStatus(ResourceShareAssociationStatus enumValue)
+        {
+          return GetNameForResourceShareAssociationStatusCStr(enumValue);
         }
 
       } // namespace ResourceShareAssociationStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ResourceShareAssociationTypeMapper
       {
 
-        static const int PRINCIPAL_HASH = HashingUtils::HashString("PRINCIPAL");
-        static const int RESOURCE_HASH = HashingUtils::HashString("RESOURCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PRINCIPAL",
+          "RESOURCE",
+        };
 
         ResourceShareAssociationType GetResourceShareAssociationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRINCIPAL_HASH)
-          {
-            return ResourceShareAssociationType::PRINCIPAL;
-          }
-          else if (hashCode == RESOURCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceShareAssociationType::RESOURCE;
+          case 974553102:
+            if (name == "PRINCIPAL")
+            {
+              return ResourceShareAssociationType::PRINCIPAL;
+            }
+            break;
+          case 441562126:
+            if (name == "RESOURCE")
+            {
+              return ResourceShareAssociationType::RESOURCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ResourceShareAssociationType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceShareAssociationType(ResourceShareAssociationType enumValue)
+        const char* GetNameForResourceShareAssociationTypeCStr(ResourceShareAssociationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceShareAssociationType::PRINCIPAL:
-            return "PRINCIPAL";
-          case ResourceShareAssociationType::RESOURCE:
-            return "RESOURCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceShareAssociationType(ResourceShareAssociationType enumValue)
+        {
+          return GetNameForResourceShareAssociationTypeCStr(enumValue);
         }
 
       } // namespace ResourceShareAssociationTypeMapper
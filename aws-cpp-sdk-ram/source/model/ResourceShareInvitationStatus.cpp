@@ -30,30 +30,51 @@ namespace Aws
       namespace ResourceShareInvitationStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int ACCEPTED_HASH = HashingUtils::HashString("ACCEPTED");
-        static const int REJECTED_HASH = HashingUtils::HashString("REJECTED");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "ACCEPTED",
+          "REJECTED",
+          "EXPIRED",
+        };
 
         ResourceShareInvitationStatus GetResourceShareInvitationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return ResourceShareInvitationStatus::PENDING;
-          }
-          else if (hashCode == ACCEPTED_HASH)
-          {
-            return ResourceShareInvitationStatus::ACCEPTED;
-          }
-          else if (hashCode == REJECTED_HASH)
-          {
-            return ResourceShareInvitationStatus::REJECTED;
-          }
-          else if (hashCode == EXPIRED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceShareInvitationStatus::EXPIRED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ResourceShareInvitationStatus::PENDING;
+            }
+            break;
+          case -1363898457:
+            if (name == "ACCEPTED")
+            {
+              return ResourceShareInvitationStatus::ACCEPTED;
+            }
+            break;
+          case 174130302:
+            if (name == "REJECTED")
+            {
+              return ResourceShareInvitationStatus::REJECTED;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return ResourceShareInvitationStatus::EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ResourceShareInvitationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForResourceShareInvitationStatus(ResourceShareInvitationStatus enumValue)
+        const char* GetNameForResourceShareInvitationStatusCStr(ResourceShareInvitationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceShareInvitationStatus::PENDING:
-            return "PENDING";
-          case ResourceShareInvitationStatus::ACCEPTED:
-            return "ACCEPTED";
-          case ResourceShareInvitationStatus::REJECTED:
-            return "REJECTED";
-          case ResourceShareInvitationStatus::EXPIRED:
-            return "EXPIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceShareInvitationStatus(ResourceShareInvitationStatus enumValue)
+        {
+          return GetNameForResourceShareInvitationStatusCStr(enumValue);
         }
 
       } // namespace ResourceShareInvitationStatusMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ResourceShareStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "ACTIVE",
+          "FAILED",
+          "DELETING",
+          "DELETED",
+        };
 
         ResourceShareStatus GetResourceShareStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceShareStatus::PENDING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return ResourceShareStatus::ACTIVE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ResourceShareStatus::FAILED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ResourceShareStatus::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ResourceShareStatus::DELETED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ResourceShareStatus::PENDING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ResourceShareStatus::ACTIVE;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ResourceShareStatus::FAILED;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ResourceShareStatus::DELETING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return ResourceShareStatus::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ResourceShareStatus::NOT_SET;
         }
 
-        Aws::String GetNameForResourceShareStatus(ResourceShareStatus enumValue)
+        const char* GetNameForResourceShareStatusCStr(ResourceShareStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceShareStatus::PENDING:
-            return "PENDING";
-          case ResourceShareStatus::ACTIVE:
-            return "ACTIVE";
-          case ResourceShareStatus::FAILED:
-            return "FAILED";
-          case ResourceShareStatus::DELETING:
-            return "DELETING";
-          case ResourceShareStatus::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceShareStatus(ResourceShareStatus enumValue)
+        {
+          return GetNameForResourceShareStatusCStr(enumValue);
         }
 
       } // namespace ResourceShareStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ResourceStatusMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int ZONAL_RESOURCE_INACCESSIBLE_HASH = HashingUtils::HashString("ZONAL_RESOURCE_INACCESSIBLE");
-        static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LIMIT_EXCEEDED");
-        static const int UNAVAILABLE_HASH = HashingUtils::HashString("UNAVAILABLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AVAILABLE",
+          "ZONAL_RESOURCE_INACCESSIBLE",
+          "LIMIT_EXCEEDED",
+          "UNAVAILABLE",
+        };
 
         ResourceStatus GetResourceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
-          {
-            return ResourceStatus::AVAILABLE;
-          }
-          else if (hashCode == ZONAL_RESOURCE_INACCESSIBLE_HASH)
-          {
-            return ResourceStatus::ZONAL_RESOURCE_INACCESSIBLE;
-          }
-          else if (hashCode == LIMIT_EXCEEDED_HASH)
-          {
-            return ResourceStatus::LIMIT_EXCEEDED;
-          }
-          else if (hashCode == UNAVAILABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceStatus::UNAVAILABLE;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return ResourceStatus::AVAILABLE;
+            }
+            break;
+          case 370305745:
+            if (name == "ZONAL_RESOURCE_INACCESSIBLE")
+            {
+              return ResourceStatus::ZONAL_RESOURCE_INACCESSIBLE;
+            }
+            break;
+          case -1452302473:
+            if (name == "LIMIT_EXCEEDED")
+            {
+              return ResourceStatus::LIMIT_EXCEEDED;
+            }
+            break;
+          case 1487498288:
+            if (name == "UNAVAILABLE")
+            {
+              return ResourceStatus::UNAVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ResourceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForResourceStatus(ResourceStatus enumValue)
+        const char* GetNameForResourceStatusCStr(ResourceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceStatus::AVAILABLE:
-            return "AVAILABLE";
-          case ResourceStatus::ZONAL_RESOURCE_INACCESSIBLE:
-            return "ZONAL_RESOURCE_INACCESSIBLE";
-          case ResourceStatus::LIMIT_EXCEEDED:
-            return "LIMIT_EXCEEDED";
-          case ResourceStatus::UNAVAILABLE:
-            return "UNAVAILABLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceStatus(ResourceStatus enumValue)
+        {
+          return GetNameForResourceStatusCStr(enumValue);
         }
 
       } // namespace ResourceStatusMapper
@@ -35,6 +35,11 @@ namespace ApplyMethodMapper
 AWS_RDS_API ApplyMethod GetApplyMethodForName(const Aws::String& name);
 
 AWS_RDS_API Aws::String GetNameForApplyMethod(ApplyMethod value);
+
+/**
+ * Same as GetNameForApplyMethod(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_RDS_API const char* GetNameForApplyMethodCStr(ApplyMethod value);
 } // namespace ApplyMethodMapper
 } // namespace Model
 } // namespace RDS
@@ -30,20 +30,37 @@ namespace Aws
       namespace ApplyMethodMapper
       {
 
-        static const int immediate_HASH = HashingUtils::HashString("immediate");
-        static const int pending_reboot_HASH = HashingUtils::HashString("pending-reboot");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "immediate",
+          "pending-reboot",
+        };
 
         ApplyMethod GetApplyMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == immediate_HASH)
-          {
-            return ApplyMethod::immediate;
-          }
-          else if (hashCode == pending_reboot_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ApplyMethod::pending_reboot;
+          case 1124382641:
+            if (name == "immediate")
+            {
+              return ApplyMethod::immediate;
+            }
+            break;
+          case 709046427:
+            if (name == "pending-reboot")
+            {
+              return ApplyMethod::pending_reboot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ApplyMethod::NOT_SET;
         }
 
-        Aws::String GetNameForApplyMethod(ApplyMethod enumValue)
+        const char* GetNameForApplyMethodCStr(ApplyMethod enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ApplyMethod::immediate:
-            return "immediate";
-          case ApplyMethod::pending_reboot:
-            return "pending-reboot";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForApplyMethod(ApplyMethod enumValue)
+        {
+          return GetNameForApplyMethodCStr(enumValue);
         }
 
       } // namespace ApplyMethodMapper
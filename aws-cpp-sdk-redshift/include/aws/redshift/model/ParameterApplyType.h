@@ -35,6 +35,11 @@ namespace ParameterApplyTypeMapper
 AWS_REDSHIFT_API ParameterApplyType GetParameterApplyTypeForName(const Aws::String& name);
 
 AWS_REDSHIFT_API Aws::String GetNameForParameterApplyType(ParameterApplyType value);
+
+/**
+ * Same as GetNameForParameterApplyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REDSHIFT_API const char* GetNameForParameterApplyTypeCStr(ParameterApplyType value);
 } // namespace ParameterApplyTypeMapper
 } // namespace Model
 } // namespace Redshift
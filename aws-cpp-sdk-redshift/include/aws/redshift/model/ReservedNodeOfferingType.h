@@ -35,6 +35,11 @@ namespace ReservedNodeOfferingTypeMapper
 AWS_REDSHIFT_API ReservedNodeOfferingType GetReservedNodeOfferingTypeForName(const Aws::String& name);
 
 AWS_REDSHIFT_API Aws::String GetNameForReservedNodeOfferingType(ReservedNodeOfferingType value);
+
+/**
+ * Same as GetNameForReservedNodeOfferingType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REDSHIFT_API const char* GetNameForReservedNodeOfferingTypeCStr(ReservedNodeOfferingType value);
 } // namespace ReservedNodeOfferingTypeMapper
 } // namespace Model
 } // namespace Redshift
@@ -36,6 +36,11 @@ namespace SnapshotAttributeToSortByMapper
 AWS_REDSHIFT_API SnapshotAttributeToSortBy GetSnapshotAttributeToSortByForName(const Aws::String& name);
 
 AWS_REDSHIFT_API Aws::String GetNameForSnapshotAttributeToSortBy(SnapshotAttributeToSortBy value);
+
+/**
+ * Same as GetNameForSnapshotAttributeToSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REDSHIFT_API const char* GetNameForSnapshotAttributeToSortByCStr(SnapshotAttributeToSortBy value);
 } // namespace SnapshotAttributeToSortByMapper
 } // namespace Model
 } // namespace Redshift
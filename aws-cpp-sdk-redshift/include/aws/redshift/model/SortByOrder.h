@@ -35,6 +35,11 @@ namespace SortByOrderMapper
 AWS_REDSHIFT_API SortByOrder GetSortByOrderForName(const Aws::String& name);
 
 AWS_REDSHIFT_API Aws::String GetNameForSortByOrder(SortByOrder value);
+
+/**
+ * Same as GetNameForSortByOrder(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REDSHIFT_API const char* GetNameForSortByOrderCStr(SortByOrder value);
 } // namespace SortByOrderMapper
 } // namespace Model
 } // namespace Redshift
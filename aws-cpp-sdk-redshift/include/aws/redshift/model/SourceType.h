@@ -37,6 +37,11 @@ namespace SourceTypeMapper
 AWS_REDSHIFT_API SourceType GetSourceTypeForName(const Aws::String& name);
 
 AWS_REDSHIFT_API Aws::String GetNameForSourceType(SourceType value);
+
+/**
+ * Same as GetNameForSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REDSHIFT_API const char* GetNameForSourceTypeCStr(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace Redshift
@@ -38,6 +38,11 @@ namespace TableRestoreStatusTypeMapper
 AWS_REDSHIFT_API TableRestoreStatusType GetTableRestoreStatusTypeForName(const Aws::String& name);
 
 AWS_REDSHIFT_API Aws::String GetNameForTableRestoreStatusType(TableRestoreStatusType value);
+
+/**
+ * Same as GetNameForTableRestoreStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REDSHIFT_API const char* GetNameForTableRestoreStatusTypeCStr(TableRestoreStatusType value);
 } // namespace TableRestoreStatusTypeMapper
 } // namespace Model
 } // namespace Redshift
@@ -30,20 +30,37 @@ namespace Aws
       namespace ParameterApplyTypeMapper
       {
 
-        static const int static__HASH = HashingUtils::HashString("static");
-        static const int dynamic_HASH = HashingUtils::HashString("dynamic");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "static",
+          "dynamic",
+        };
 
         ParameterApplyType GetParameterApplyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == static__HASH)
-          {
-            return ParameterApplyType::static_;
-          }
-          else if (hashCode == dynamic_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ParameterApplyType::dynamic;
+          case -892481938:
+            if (name == "static")
+            {
+              return ParameterApplyType::static_;
+            }
+            break;
+          case 2124767295:
+            if (name == "dynamic")
+            {
+              return ParameterApplyType::dynamic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ParameterApplyType::NOT_SET;
         }
 
-        Aws::String GetNameForParameterApplyType(ParameterApplyType enumValue)
+        const char* GetNameForParameterApplyTypeCStr(ParameterApplyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ParameterApplyType::static_:
-            return "static";
-          case ParameterApplyType::dynamic:
-            return "dynamic";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForParameterApplyType(ParameterApplyType enumValue)
+        {
+          return GetNameForParameterApplyTypeCStr(enumValue);
         }
 
       } // namespace ParameterApplyTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ReservedNodeOfferingTypeMapper
       {
 
-        static const int Regular_HASH = HashingUtils::HashString("Regular");
-        static const int Upgradable_HASH = HashingUtils::HashString("Upgradable");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Regular",
+          "Upgradable",
+        };
 
         ReservedNodeOfferingType GetReservedNodeOfferingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Regular_HASH)
-          {
-            return ReservedNodeOfferingType::Regular;
-          }
-          else if (hashCode == Upgradable_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReservedNodeOfferingType::Upgradable;
+          case -1543850116:
+            if (name == "Regular")
+            {
+              return ReservedNodeOfferingType::Regular;
+            }
+            break;
+          case -5805981:
+            if (name == "Upgradable")
+            {
+              return ReservedNodeOfferingType::Upgradable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReservedNodeOfferingType::NOT_SET;
         }
 
-        Aws::String GetNameForReservedNodeOfferingType(ReservedNodeOfferingType enumValue)
+        const char* GetNameForReservedNodeOfferingTypeCStr(ReservedNodeOfferingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReservedNodeOfferingType::Regular:
-            return "Regular";
-          case ReservedNodeOfferingType::Upgradable:
-            return "Upgradable";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReservedNodeOfferingType(ReservedNodeOfferingType enumValue)
+        {
+          return GetNameForReservedNodeOfferingTypeCStr(enumValue);
         }
 
       } // namespace ReservedNodeOfferingTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ScheduleStateMapper
       {
 
-        static const int MODIFYING_HASH = HashingUtils::HashString("MODIFYING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MODIFYING",
+          "ACTIVE",
+          "FAILED",
+        };
 
         ScheduleState GetScheduleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MODIFYING_HASH)
-          {
-            return ScheduleState::MODIFYING;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScheduleState::ACTIVE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ScheduleState::FAILED;
+          case 886029512:
+            if (name == "MODIFYING")
+            {
+              return ScheduleState::MODIFYING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ScheduleState::ACTIVE;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ScheduleState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ScheduleState::NOT_SET;
         }
 
-        Aws::String GetNameForScheduleState(ScheduleState enumValue)
+        const char* GetNameForScheduleStateCStr(ScheduleState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScheduleState::MODIFYING:
-            return "MODIFYING";
-          case ScheduleState::ACTIVE:
-            return "ACTIVE";
-          case ScheduleState::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScheduleState(ScheduleState enumValue)
+        {
+          return GetNameForScheduleStateCStr(enumValue);
         }
 
       } // namespace ScheduleStateMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace SnapshotAttributeToSortByMapper
       {
 
-        static const int SOURCE_TYPE_HASH = HashingUtils::HashString("SOURCE_TYPE");
-        static const int TOTAL_SIZE_HASH = HashingUtils::HashString("TOTAL_SIZE");
-        static const int CREATE_TIME_HASH = HashingUtils::HashString("CREATE_TIME");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SOURCE_TYPE",
+          "TOTAL_SIZE",
+          "CREATE_TIME",
+        };
 
         SnapshotAttributeToSortBy GetSnapshotAttributeToSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SOURCE_TYPE_HASH)
-          {
-            return SnapshotAttributeToSortBy::SOURCE_TYPE;
-          }
-          else if (hashCode == TOTAL_SIZE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SnapshotAttributeToSortBy::TOTAL_SIZE;
-          }
-          else if (hashCode == CREATE_TIME_HASH)
-          {
-            return SnapshotAttributeToSortBy::CREATE_TIME;
+          case 2097888478:
+            if (name == "SOURCE_TYPE")
+            {
+              return SnapshotAttributeToSortBy::SOURCE_TYPE;
+            }
+            break;
+          case -190774212:
+            if (name == "TOTAL_SIZE")
+            {
+              return SnapshotAttributeToSortBy::TOTAL_SIZE;
+            }
+            break;
+          case 1688939568:
+            if (name == "CREATE_TIME")
+            {
+              return SnapshotAttributeToSortBy::CREATE_TIME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SnapshotAttributeToSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForSnapshotAttributeToSortBy(SnapshotAttributeToSortBy enumValue)
+        const char* GetNameForSnapshotAttributeToSortByCStr(SnapshotAttributeToSortBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SnapshotAttributeToSortBy::SOURCE_TYPE:
-            return "SOURCE_TYPE";
-          case SnapshotAttributeToSortBy::TOTAL_SIZE:
-            return "TOTAL_SIZE";
-          case SnapshotAttributeToSortBy::CREATE_TIME:
-            return "CREATE_TIME";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSnapshotAttributeToSortBy(SnapshotAttributeToSortBy enumValue)
+        {
+          return GetNameForSnapshotAttributeToSortByCStr(enumValue);
         }
 
       } // namespace SnapshotAttributeToSortByMapper
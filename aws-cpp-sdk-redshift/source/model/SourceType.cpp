@@ -30,30 +30,51 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int cluster_HASH = HashingUtils::HashString("cluster");
-        static const int cluster_parameter_group_HASH = HashingUtils::HashString("cluster-parameter-group");
-        static const int cluster_security_group_HASH = HashingUtils::HashString("cluster-security-group");
-        static const int cluster_snapshot_HASH = HashingUtils::HashString("cluster-snapshot");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "cluster",
+          "cluster-parameter-group",
+          "cluster-security-group",
+          "cluster-snapshot",
+        };
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cluster_HASH)
-          {
-            return SourceType::cluster;
-          }
-          else if (hashCode == cluster_parameter_group_HASH)
-          {
-            return SourceType::cluster_parameter_group;
-          }
-          else if (hashCode == cluster_security_group_HASH)
-          {
-            return SourceType::cluster_security_group;
-          }
-          else if (hashCode == cluster_snapshot_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SourceType::cluster_snapshot;
+          case 872092154:
+            if (name == "cluster")
+            {
+              return SourceType::cluster;
+            }
+            break;
+          case 1783921032:
+            if (name == "cluster-parameter-group")
+            {
+              return SourceType::cluster_parameter_group;
+            }
+            break;
+          case 1329347045:
+            if (name == "cluster-security-group")
+            {
+              return SourceType::cluster_security_group;
+            }
+            break;
+          case -1482497993:
+            if (name == "cluster-snapshot")
+            {
+              return SourceType::cluster_snapshot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceTypeCStr(SourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SourceType::cluster:
-            return "cluster";
-          case SourceType::cluster_parameter_group:
-            return "cluster-parameter-group";
-          case SourceType::cluster_security_group:
-            return "cluster-security-group";
-          case SourceType::cluster_snapshot:
-            return "cluster-snapshot";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSourceType(SourceType enumValue)
+        {
+          return GetNameForSourceTypeCStr(enumValue);
         }
 
       } // namespace SourceTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace TableRestoreStatusTypeMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "IN_PROGRESS",
+          "SUCCEEDED",
+          "FAILED",
+          "CANCELED",
+        };
 
         TableRestoreStatusType GetTableRestoreStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TableRestoreStatusType::PENDING;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return TableRestoreStatusType::IN_PROGRESS;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return TableRestoreStatusType::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return TableRestoreStatusType::FAILED;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return TableRestoreStatusType::CANCELED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return TableRestoreStatusType::PENDING;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return TableRestoreStatusType::IN_PROGRESS;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return TableRestoreStatusType::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return TableRestoreStatusType::FAILED;
+            }
+            break;
+          case 659453081:
+            if (name == "CANCELED")
+            {
+              return TableRestoreStatusType::CANCELED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return TableRestoreStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForTableRestoreStatusType(TableRestoreStatusType enumValue)
+        const char* GetNameForTableRestoreStatusTypeCStr(TableRestoreStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TableRestoreStatusType::PENDING:
-            return "PENDING";
-          case TableRestoreStatusType::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case TableRestoreStatusType::SUCCEEDED:
-            return "SUCCEEDED";
-          case TableRestoreStatusType::FAILED:
-            return "FAILED";
-          case TableRestoreStatusType::CANCELED:
-            return "CANCELED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTableRestoreStatusType(TableRestoreStatusType enumValue)
+        {
+          return GetNameForTableRestoreStatusTypeCStr(enumValue);
         }
 
       } // namespace TableRestoreStatusTypeMapper
@@ -35,6 +35,11 @@ namespace AttributeMapper
 AWS_REKOGNITION_API Attribute GetAttributeForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForAttribute(Attribute value);
+
+/**
+ * Same as GetNameForAttribute(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForAttributeCStr(Attribute value);
 } // namespace AttributeMapper
 } // namespace Model
 } // namespace Rekognition
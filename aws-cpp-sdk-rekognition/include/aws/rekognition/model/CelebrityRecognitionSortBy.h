@@ -35,6 +35,11 @@ namespace CelebrityRecognitionSortByMapper
 AWS_REKOGNITION_API CelebrityRecognitionSortBy GetCelebrityRecognitionSortByForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForCelebrityRecognitionSortBy(CelebrityRecognitionSortBy value);
+
+/**
+ * Same as GetNameForCelebrityRecognitionSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForCelebrityRecognitionSortByCStr(CelebrityRecognitionSortBy value);
 } // namespace CelebrityRecognitionSortByMapper
 } // namespace Model
 } // namespace Rekognition
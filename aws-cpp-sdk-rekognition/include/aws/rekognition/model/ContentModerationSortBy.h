@@ -35,6 +35,11 @@ namespace ContentModerationSortByMapper
 AWS_REKOGNITION_API ContentModerationSortBy GetContentModerationSortByForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForContentModerationSortBy(ContentModerationSortBy value);
+
+/**
+ * Same as GetNameForContentModerationSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForContentModerationSortByCStr(ContentModerationSortBy value);
 } // namespace ContentModerationSortByMapper
 } // namespace Model
 } // namespace Rekognition
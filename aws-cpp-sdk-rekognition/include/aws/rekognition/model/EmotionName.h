@@ -41,6 +41,11 @@ namespace EmotionNameMapper
 AWS_REKOGNITION_API EmotionName GetEmotionNameForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForEmotionName(EmotionName value);
+
+/**
+ * Same as GetNameForEmotionName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForEmotionNameCStr(EmotionName value);
 } // namespace EmotionNameMapper
 } // namespace Model
 } // namespace Rekognition
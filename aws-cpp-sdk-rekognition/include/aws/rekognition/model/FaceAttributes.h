@@ -35,6 +35,11 @@ namespace FaceAttributesMapper
 AWS_REKOGNITION_API FaceAttributes GetFaceAttributesForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForFaceAttributes(FaceAttributes value);
+
+/**
+ * Same as GetNameForFaceAttributes(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForFaceAttributesCStr(FaceAttributes value);
 } // namespace FaceAttributesMapper
 } // namespace Model
 } // namespace Rekognition
@@ -35,6 +35,11 @@ namespace FaceSearchSortByMapper
 AWS_REKOGNITION_API FaceSearchSortBy GetFaceSearchSortByForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForFaceSearchSortBy(FaceSearchSortBy value);
+
+/**
+ * Same as GetNameForFaceSearchSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForFaceSearchSortByCStr(FaceSearchSortBy value);
 } // namespace FaceSearchSortByMapper
 } // namespace Model
 } // namespace Rekognition
@@ -35,6 +35,11 @@ namespace GenderTypeMapper
 AWS_REKOGNITION_API GenderType GetGenderTypeForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForGenderType(GenderType value);
+
+/**
+ * Same as GetNameForGenderType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForGenderTypeCStr(GenderType value);
 } // namespace GenderTypeMapper
 } // namespace Model
 } // namespace Rekognition
@@ -35,6 +35,11 @@ namespace LabelDetectionSortByMapper
 AWS_REKOGNITION_API LabelDetectionSortBy GetLabelDetectionSortByForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForLabelDetectionSortBy(LabelDetectionSortBy value);
+
+/**
+ * Same as GetNameForLabelDetectionSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForLabelDetectionSortByCStr(LabelDetectionSortBy value);
 } // namespace LabelDetectionSortByMapper
 } // namespace Model
 } // namespace Rekognition
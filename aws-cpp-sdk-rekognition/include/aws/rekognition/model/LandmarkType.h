@@ -63,6 +63,11 @@ namespace LandmarkTypeMapper
 AWS_REKOGNITION_API LandmarkType GetLandmarkTypeForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForLandmarkType(LandmarkType value);
+
+/**
+ * Same as GetNameForLandmarkType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForLandmarkTypeCStr(LandmarkType value);
 } // namespace LandmarkTypeMapper
 } // namespace Model
 } // namespace Rekognition
@@ -37,6 +37,11 @@ namespace OrientationCorrectionMapper
 AWS_REKOGNITION_API OrientationCorrection GetOrientationCorrectionForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForOrientationCorrection(OrientationCorrection value);
+
+/**
+ * Same as GetNameForOrientationCorrection(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForOrientationCorrectionCStr(OrientationCorrection value);
 } // namespace OrientationCorrectionMapper
 } // namespace Model
 } // namespace Rekognition
@@ -35,6 +35,11 @@ namespace PersonTrackingSortByMapper
 AWS_REKOGNITION_API PersonTrackingSortBy GetPersonTrackingSortByForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForPersonTrackingSortBy(PersonTrackingSortBy value);
+
+/**
+ * Same as GetNameForPersonTrackingSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForPersonTrackingSortByCStr(PersonTrackingSortBy value);
 } // namespace PersonTrackingSortByMapper
 } // namespace Model
 } // namespace Rekognition
@@ -35,6 +35,11 @@ namespace QualityFilterMapper
 AWS_REKOGNITION_API QualityFilter GetQualityFilterForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForQualityFilter(QualityFilter value);
+
+/**
+ * Same as GetNameForQualityFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForQualityFilterCStr(QualityFilter value);
 } // namespace QualityFilterMapper
 } // namespace Model
 } // namespace Rekognition
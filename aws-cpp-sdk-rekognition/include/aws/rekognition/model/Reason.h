@@ -39,6 +39,11 @@ namespace ReasonMapper
 AWS_REKOGNITION_API Reason GetReasonForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForReason(Reason value);
+
+/**
+ * Same as GetNameForReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForReasonCStr(Reason value);
 } // namespace ReasonMapper
 } // namespace Model
 } // namespace Rekognition
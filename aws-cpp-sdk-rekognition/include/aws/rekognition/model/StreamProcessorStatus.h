@@ -38,6 +38,11 @@ namespace StreamProcessorStatusMapper
 AWS_REKOGNITION_API StreamProcessorStatus GetStreamProcessorStatusForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForStreamProcessorStatus(StreamProcessorStatus value);
+
+/**
+ * Same as GetNameForStreamProcessorStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForStreamProcessorStatusCStr(StreamProcessorStatus value);
 } // namespace StreamProcessorStatusMapper
 } // namespace Model
 } // namespace Rekognition
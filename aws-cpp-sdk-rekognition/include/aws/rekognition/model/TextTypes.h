@@ -35,6 +35,11 @@ namespace TextTypesMapper
 AWS_REKOGNITION_API TextTypes GetTextTypesForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForTextTypes(TextTypes value);
+
+/**
+ * Same as GetNameForTextTypes(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForTextTypesCStr(TextTypes value);
 } // namespace TextTypesMapper
 } // namespace Model
 } // namespace Rekognition
@@ -36,6 +36,11 @@ namespace VideoJobStatusMapper
 AWS_REKOGNITION_API VideoJobStatus GetVideoJobStatusForName(const Aws::String& name);
 
 AWS_REKOGNITION_API Aws::String GetNameForVideoJobStatus(VideoJobStatus value);
+
+/**
+ * Same as GetNameForVideoJobStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_REKOGNITION_API const char* GetNameForVideoJobStatusCStr(VideoJobStatus value);
 } // namespace VideoJobStatusMapper
 } // namespace Model
 } // namespace Rekognition
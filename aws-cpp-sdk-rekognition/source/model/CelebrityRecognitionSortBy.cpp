@@ -30,20 +30,37 @@ namespace Aws
       namespace CelebrityRecognitionSortByMapper
       {
 
-        static const int ID_HASH = HashingUtils::HashString("ID");
-        static const int TIMESTAMP_HASH = HashingUtils::HashString("TIMESTAMP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ID",
+          "TIMESTAMP",
+        };
 
         CelebrityRecognitionSortBy GetCelebrityRecognitionSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ID_HASH)
-          {
-            return CelebrityRecognitionSortBy::ID;
-          }
-          else if (hashCode == TIMESTAMP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CelebrityRecognitionSortBy::TIMESTAMP;
+          case 2331:
+            if (name == "ID")
+            {
+              return CelebrityRecognitionSortBy::ID;
+            }
+            break;
+          case -1453246218:
+            if (name == "TIMESTAMP")
+            {
+              return CelebrityRecognitionSortBy::TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CelebrityRecognitionSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForCelebrityRecognitionSortBy(CelebrityRecognitionSortBy enumValue)
+        const char* GetNameForCelebrityRecognitionSortByCStr(CelebrityRecognitionSortBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CelebrityRecognitionSortBy::ID:
-            return "ID";
-          case CelebrityRecognitionSortBy::TIMESTAMP:
-            return "TIMESTAMP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCelebrityRecognitionSortBy(CelebrityRecognitionSortBy enumValue)
+        {
+          return GetNameForCelebrityRecognitionSortByCStr(enumValue);
         }
 
       } // namespace CelebrityRecognitionSortByMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ContentModerationSortByMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int TIMESTAMP_HASH = HashingUtils::HashString("TIMESTAMP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NAME",
+          "TIMESTAMP",
+        };
 
         ContentModerationSortBy GetContentModerationSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
-          {
-            return ContentModerationSortBy::NAME;
-          }
-          else if (hashCode == TIMESTAMP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContentModerationSortBy::TIMESTAMP;
+          case 2388619:
+            if (name == "NAME")
+            {
+              return ContentModerationSortBy::NAME;
+            }
+            break;
+          case -1453246218:
+            if (name == "TIMESTAMP")
+            {
+              return ContentModerationSortBy::TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ContentModerationSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForContentModerationSortBy(ContentModerationSortBy enumValue)
+        const char* GetNameForContentModerationSortByCStr(ContentModerationSortBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContentModerationSortBy::NAME:
-            return "NAME";
-          case ContentModerationSortBy::TIMESTAMP:
-            return "TIMESTAMP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContentModerationSortBy(ContentModerationSortBy enumValue)
+        {
+          return GetNameForContentModerationSortByCStr(enumValue);
         }
 
       } // namespace ContentModerationSortByMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace EmotionNameMapper
       {
 
-        static const int HAPPY_HASH = HashingUtils::HashString("HAPPY");
-        static const int SAD_HASH = HashingUtils::HashString("SAD");
-        static const int ANGRY_HASH = HashingUtils::HashString("ANGRY");
-        static const int CONFUSED_HASH = HashingUtils::HashString("CONFUSED");
-        static const int DISGUSTED_HASH = HashingUtils::HashString("DISGUSTED");
-        static const int SURPRISED_HASH = HashingUtils::HashString("SURPRISED");
-        static const int CALM_HASH = HashingUtils::HashString("CALM");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HAPPY",
+          "SAD",
+          "ANGRY",
+          "CONFUSED",
+          "DISGUSTED",
+          "SURPRISED",
+          "CALM",
+          "UNKNOWN",
+        };
 
         EmotionName GetEmotionNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HAPPY_HASH)
-          {
-            return EmotionName::HAPPY;
-          }
-          else if (hashCode == SAD_HASH)
-          {
-            return EmotionName::SAD;
-          }
-          else if (hashCode == ANGRY_HASH)
-          {
-            return EmotionName::ANGRY;
-          }
-          else if (hashCode == CONFUSED_HASH)
-          {
-            return EmotionName::CONFUSED;
-          }
-          else if (hashCode == DISGUSTED_HASH)
-          {
-            return EmotionName::DISGUSTED;
-          }
-          else if (hashCode == SURPRISED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EmotionName::SURPRISED;
-          }
-          else if (hashCode == CALM_HASH)
-          {
-            return EmotionName::CALM;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return EmotionName::UNKNOWN;
+          case 68509376:
+            if (name == "HAPPY")
+            {
+              return EmotionName::HAPPY;
+            }
+            break;
+          case 81846:
+            if (name == "SAD")
+            {
+              return EmotionName::SAD;
+            }
+            break;
+          case 62423425:
+            if (name == "ANGRY")
+            {
+              return EmotionName::ANGRY;
+            }
+            break;
+          case 202856673:
+            if (name == "CONFUSED")
+            {
+              return EmotionName::CONFUSED;
+            }
+            break;
+          case -1509597540:
+            if (name == "DISGUSTED")
+            {
+              return EmotionName::DISGUSTED;
+            }
+            break;
+          case 249333371:
+            if (name == "SURPRISED")
+            {
+              return EmotionName::SURPRISED;
+            }
+            break;
+          case 2060895:
+            if (name == "CALM")
+            {
+              return EmotionName::CALM;
+            }
+            break;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return EmotionName::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return EmotionName::NOT_SET;
         }
 
-        Aws::String GetNameForEmotionName(EmotionName enumValue)
+        const char* GetNameForEmotionNameCStr(EmotionName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EmotionName::HAPPY:
-            return "HAPPY";
-          case EmotionName::SAD:
-            return "SAD";
-          case EmotionName::ANGRY:
-            return "ANGRY";
-          case EmotionName::CONFUSED:
-            return "CONFUSED";
-          case EmotionName::DISGUSTED:
-            return "DISGUSTED";
-          case EmotionName::SURPRISED:
-            return "SURPRISED";
-          case EmotionName::CALM:
-            return "CALM";
-          case EmotionName::UNKNOWN:
-            return "UNKNOWN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEmotionName(EmotionName enumValue)
+        {
+          return GetNameForEmotionNameCStr(enumValue);
         }
 
       } // namespace EmotionNameMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FaceAttributesMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "ALL",
+        };
 
         FaceAttributes GetFaceAttributesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return FaceAttributes::DEFAULT;
-          }
-          else if (hashCode == ALL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FaceAttributes::ALL;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return FaceAttributes::DEFAULT;
+            }
+            break;
+          case 64897:
+            if (name == "ALL")
+            {
+              return FaceAttributes::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FaceAttributes::NOT_SET;
         }
 
-        Aws::String GetNameForFaceAttributes(FaceAttributes enumValue)
+        const char* GetNameForFaceAttributesCStr(FaceAttributes enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FaceAttributes::DEFAULT:
-            return "DEFAULT";
-          case FaceAttributes::ALL:
-            return "ALL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFaceAttributes(FaceAttributes enumValue)
+        {
+          return GetNameForFaceAttributesCStr(enumValue);
         }
 
       } // namespace FaceAttributesMapper
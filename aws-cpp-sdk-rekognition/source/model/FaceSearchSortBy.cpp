@@ -30,20 +30,37 @@ namespace Aws
       namespace FaceSearchSortByMapper
       {
 
-        static const int INDEX_HASH = HashingUtils::HashString("INDEX");
-        static const int TIMESTAMP_HASH = HashingUtils::HashString("TIMESTAMP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INDEX",
+          "TIMESTAMP",
+        };
 
         FaceSearchSortBy GetFaceSearchSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INDEX_HASH)
-          {
-            return FaceSearchSortBy::INDEX;
-          }
-          else if (hashCode == TIMESTAMP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FaceSearchSortBy::TIMESTAMP;
+          case 69808306:
+            if (name == "INDEX")
+            {
+              return FaceSearchSortBy::INDEX;
+            }
+            break;
+          case -1453246218:
+            if (name == "TIMESTAMP")
+            {
+              return FaceSearchSortBy::TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FaceSearchSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForFaceSearchSortBy(FaceSearchSortBy enumValue)
+        const char* GetNameForFaceSearchSortByCStr(FaceSearchSortBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FaceSearchSortBy::INDEX:
-            return "INDEX";
-          case FaceSearchSortBy::TIMESTAMP:
-            return "TIMESTAMP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFaceSearchSortBy(FaceSearchSortBy enumValue)
+        {
+          return GetNameForFaceSearchSortByCStr(enumValue);
         }
 
       } // namespace FaceSearchSortByMapper
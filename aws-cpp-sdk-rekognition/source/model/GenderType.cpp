@@ -30,20 +30,37 @@ namespace Aws
       namespace GenderTypeMapper
       {
 
-        static const int Male_HASH = HashingUtils::HashString("Male");
-        static const int Female_HASH = HashingUtils::HashString("Female");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Male",
+          "Female",
+        };
 
         GenderType GetGenderTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Male_HASH)
-          {
-            return GenderType::Male;
-          }
-          else if (hashCode == Female_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GenderType::Female;
+          case 2390573:
+            if (name == "Male")
+            {
+              return GenderType::Male;
+            }
+            break;
+          case 2100660076:
+            if (name == "Female")
+            {
+              return GenderType::Female;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return GenderType::NOT_SET;
         }
 
-        Aws::String GetNameForGenderType(GenderType enumValue)
+        const char* GetNameForGenderTypeCStr(GenderType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GenderType::Male:
-            return "Male";
-          case GenderType::Female:
-            return "Female";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGenderType(GenderType enumValue)
+        {
+          return GetNameForGenderTypeCStr(enumValue);
         }
 
       } // namespace GenderTypeMapper
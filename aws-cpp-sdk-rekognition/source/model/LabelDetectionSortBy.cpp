@@ -30,20 +30,37 @@ namespace Aws
       namespace LabelDetectionSortByMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int TIMESTAMP_HASH = HashingUtils::HashString("TIMESTAMP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NAME",
+          "TIMESTAMP",
+        };
 
         LabelDetectionSortBy GetLabelDetectionSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
-          {
-            return LabelDetectionSortBy::NAME;
-          }
-          else if (hashCode == TIMESTAMP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LabelDetectionSortBy::TIMESTAMP;
+          case 2388619:
+            if (name == "NAME")
+            {
+              return LabelDetectionSortBy::NAME;
+            }
+            break;
+          case -1453246218:
+            if (name == "TIMESTAMP")
+            {
+              return LabelDetectionSortBy::TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LabelDetectionSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForLabelDetectionSortBy(LabelDetectionSortBy enumValue)
+        const char* GetNameForLabelDetectionSortByCStr(LabelDetectionSortBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LabelDetectionSortBy::NAME:
-            return "NAME";
-          case LabelDetectionSortBy::TIMESTAMP:
-            return "TIMESTAMP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLabelDetectionSortBy(LabelDetectionSortBy enumValue)
+        {
+          return GetNameForLabelDetectionSortByCStr(enumValue);
         }
 
       } // namespace LabelDetectionSortByMapper
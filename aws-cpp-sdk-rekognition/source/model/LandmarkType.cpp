@@ -30,160 +30,233 @@ namespace Aws
       namespace LandmarkTypeMapper
       {
 
-        static const int eyeLeft_HASH = HashingUtils::HashString("eyeLeft");
-        static const int eyeRight_HASH = HashingUtils::HashString("eyeRight");
-        static const int nose_HASH = HashingUtils::HashString("nose");
-        static const int mouthLeft_HASH = HashingUtils::HashString("mouthLeft");
-        static const int mouthRight_HASH = HashingUtils::HashString("mouthRight");
-        static const int leftEyeBrowLeft_HASH = HashingUtils::HashString("leftEyeBrowLeft");
-        static const int leftEyeBrowRight_HASH = HashingUtils::HashString("leftEyeBrowRight");
-        static const int leftEyeBrowUp_HASH = HashingUtils::HashString("leftEyeBrowUp");
-        static const int rightEyeBrowLeft_HASH = HashingUtils::HashString("rightEyeBrowLeft");
-        static const int rightEyeBrowRight_HASH = HashingUtils::HashString("rightEyeBrowRight");
-        static const int rightEyeBrowUp_HASH = HashingUtils::HashString("rightEyeBrowUp");
-        static const int leftEyeLeft_HASH = HashingUtils::HashString("leftEyeLeft");
-        static const int leftEyeRight_HASH = HashingUtils::HashString("leftEyeRight");
-        static const int leftEyeUp_HASH = HashingUtils::HashString("leftEyeUp");
-        static const int leftEyeDown_HASH = HashingUtils::HashString("leftEyeDown");
-        static const int rightEyeLeft_HASH = HashingUtils::HashString("rightEyeLeft");
-        static const int rightEyeRight_HASH = HashingUtils::HashString("rightEyeRight");
-        static const int rightEyeUp_HASH = HashingUtils::HashString("rightEyeUp");
-        static const int rightEyeDown_HASH = HashingUtils::HashString("rightEyeDown");
-        static const int noseLeft_HASH = HashingUtils::HashString("noseLeft");
-        static const int noseRight_HASH = HashingUtils::HashString("noseRight");
-        static const int mouthUp_HASH = HashingUtils::HashString("mouthUp");
-        static const int mouthDown_HASH = HashingUtils::HashString("mouthDown");
-        static const int leftPupil_HASH = HashingUtils::HashString("leftPupil");
-        static const int rightPupil_HASH = HashingUtils::HashString("rightPupil");
-        static const int upperJawlineLeft_HASH = HashingUtils::HashString("upperJawlineLeft");
-        static const int midJawlineLeft_HASH = HashingUtils::HashString("midJawlineLeft");
-        static const int chinBottom_HASH = HashingUtils::HashString("chinBottom");
-        static const int midJawlineRight_HASH = HashingUtils::HashString("midJawlineRight");
-        static const int upperJawlineRight_HASH = HashingUtils::HashString("upperJawlineRight");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "eyeLeft",
+          "eyeRight",
+          "nose",
+          "mouthLeft",
+          "mouthRight",
+          "leftEyeBrowLeft",
+          "leftEyeBrowRight",
+          "leftEyeBrowUp",
+          "rightEyeBrowLeft",
+          "rightEyeBrowRight",
+          "rightEyeBrowUp",
+          "leftEyeLeft",
+          "leftEyeRight",
+          "leftEyeUp",
+          "leftEyeDown",
+          "rightEyeLeft",
+          "rightEyeRight",
+          "rightEyeUp",
+          "rightEyeDown",
+          "noseLeft",
+          "noseRight",
+          "mouthUp",
+          "mouthDown",
+          "leftPupil",
+          "rightPupil",
+          "upperJawlineLeft",
+          "midJawlineLeft",
+          "chinBottom",
+          "midJawlineRight",
+          "upperJawlineRight",
+        };
 
         LandmarkType GetLandmarkTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == eyeLeft_HASH)
-          {
-            return LandmarkType::eyeLeft;
-          }
-          else if (hashCode == eyeRight_HASH)
-          {
-            return LandmarkType::eyeRight;
-          }
-          else if (hashCode == nose_HASH)
-          {
-            return LandmarkType::nose;
-          }
-          else if (hashCode == mouthLeft_HASH)
-          {
-            return LandmarkType::mouthLeft;
-          }
-          else if (hashCode == mouthRight_HASH)
-          {
-            return LandmarkType::mouthRight;
-          }
-          else if (hashCode == leftEyeBrowLeft_HASH)
-          {
-            return LandmarkType::leftEyeBrowLeft;
-          }
-          else if (hashCode == leftEyeBrowRight_HASH)
-          {
-            return LandmarkType::leftEyeBrowRight;
-          }
-          else if (hashCode == leftEyeBrowUp_HASH)
-          {
-            return LandmarkType::leftEyeBrowUp;
-          }
-          else if (hashCode == rightEyeBrowLeft_HASH)
-          {
-            return LandmarkType::rightEyeBrowLeft;
-          }
-          else if (hashCode == rightEyeBrowRight_HASH)
-          {
-            return LandmarkType::rightEyeBrowRight;
-          }
-          else if (hashCode == rightEyeBrowUp_HASH)
-          {
-            return LandmarkType::rightEyeBrowUp;
-          }
-          else if (hashCode == leftEyeLeft_HASH)
-          {
-            return LandmarkType::leftEyeLeft;
-          }
-          else if (hashCode == leftEyeRight_HASH)
-          {
-            return LandmarkType::leftEyeRight;
-          }
-          else if (hashCode == leftEyeUp_HASH)
-          {
-            return LandmarkType::leftEyeUp;
-          }
-          else if (hashCode == leftEyeDown_HASH)
-          {
-            return LandmarkType::leftEyeDown;
-          }
-          else if (hashCode == rightEyeLeft_HASH)
-          {
-            return LandmarkType::rightEyeLeft;
-          }
-          else if (hashCode == rightEyeRight_HASH)
-          {
-            return LandmarkType::rightEyeRight;
-          }
-          else if (hashCode == rightEyeUp_HASH)
-          {
-            return LandmarkType::rightEyeUp;
-          }
-          else if (hashCode == rightEyeDown_HASH)
-          {
-            return LandmarkType::rightEyeDown;
-          }
-          else if (hashCode == noseLeft_HASH)
-          {
-            return LandmarkType::noseLeft;
-          }
-          else if (hashCode == noseRight_HASH)
-          {
-            return LandmarkType::noseRight;
-          }
-          else if (hashCode == mouthUp_HASH)
-          {
-            return LandmarkType::mouthUp;
-          }
-          else if (hashCode == mouthDown_HASH)
-          {
-            return LandmarkType::mouthDown;
-          }
-          else if (hashCode == leftPupil_HASH)
-          {
-            return LandmarkType::leftPupil;
-          }
-          else if (hashCode == rightPupil_HASH)
-          {
-            return LandmarkType::rightPupil;
-          }
-          else if (hashCode == upperJawlineLeft_HASH)
-          {
-            return LandmarkType::upperJawlineLeft;
-          }
-          else if (hashCode == midJawlineLeft_HASH)
-          {
-            return LandmarkType::midJawlineLeft;
-          }
-          else if (hashCode == chinBottom_HASH)
-          {
-            return LandmarkType::chinBottom;
-          }
-          else if (hashCode == midJawlineRight_HASH)
-          {
-            return LandmarkType::midJawlineRight;
-          }
-          else if (hashCode == upperJawlineRight_HASH)
-          {
-            return LandmarkType::upperJawlineRight;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1291641384:
+            if (name == "eyeLeft")
+            {
+              return LandmarkType::eyeLeft;
+            }
+            break;
+          case -1380516245:
+            if (name == "eyeRight")
+            {
+              return LandmarkType::eyeRight;
+            }
+            break;
+          case 3387347:
+            if (name == "nose")
+            {
+              return LandmarkType::nose;
+            }
+            break;
+          case 617518446:
+            if (name == "mouthLeft")
+            {
+              return LandmarkType::mouthLeft;
+            }
+            break;
+          case 1968863637:
+            if (name == "mouthRight")
+            {
+              return LandmarkType::mouthRight;
+            }
+            break;
+          case -1144112855:
+            if (name == "leftEyeBrowLeft")
+            {
+              return LandmarkType::leftEyeBrowLeft;
+            }
+            break;
+          case -1102099142:
+            if (name == "leftEyeBrowRight")
+            {
+              return LandmarkType::leftEyeBrowRight;
+            }
+            break;
+          case 311658557:
+            if (name == "leftEyeBrowUp")
+            {
+              return LandmarkType::leftEyeBrowUp;
+            }
+            break;
+          case -1041078284:
+            if (name == "rightEyeBrowLeft")
+            {
+              return LandmarkType::rightEyeBrowLeft;
+            }
+            break;
+          case 2091972559:
+            if (name == "rightEyeBrowRight")
+            {
+              return LandmarkType::rightEyeBrowRight;
+            }
+            break;
+          case 351989192:
+            if (name == "rightEyeBrowUp")
+            {
+              return LandmarkType::rightEyeBrowUp;
+            }
+            break;
+          case 1828540369:
+            if (name == "leftEyeLeft")
+            {
+              return LandmarkType::leftEyeLeft;
+            }
+            break;
+          case 855837586:
+            if (name == "leftEyeRight")
+            {
+              return LandmarkType::leftEyeRight;
+            }
+            break;
+          case 1718102245:
+            if (name == "leftEyeUp")
+            {
+              return LandmarkType::leftEyeUp;
+            }
+            break;
+          case 1828312172:
+            if (name == "leftEyeDown")
+            {
+              return LandmarkType::leftEyeDown;
+            }
+            break;
+          case 747019292:
+            if (name == "rightEyeLeft")
+            {
+              return LandmarkType::rightEyeLeft;
+            }
+            break;
+          case 1688422567:
+            if (name == "rightEyeRight")
+            {
+              return LandmarkType::rightEyeRight;
+            }
+            break;
+          case -1411511312:
+            if (name == "rightEyeUp")
+            {
+              return LandmarkType::rightEyeUp;
+            }
+            break;
+          case 746791095:
+            if (name == "rightEyeDown")
+            {
+              return LandmarkType::rightEyeDown;
+            }
+            break;
+          case 1552261754:
+            if (name == "noseLeft")
+            {
+              return LandmarkType::noseLeft;
+            }
+            break;
+          case 881135113:
+            if (name == "noseRight")
+            {
+              return LandmarkType::noseRight;
+            }
+            break;
+          case 1243099586:
+            if (name == "mouthUp")
+            {
+              return LandmarkType::mouthUp;
+            }
+            break;
+          case 617290249:
+            if (name == "mouthDown")
+            {
+              return LandmarkType::mouthDown;
+            }
+            break;
+          case 1728152999:
+            if (name == "leftPupil")
+            {
+              return LandmarkType::leftPupil;
+            }
+            break;
+          case -1401460558:
+            if (name == "rightPupil")
+            {
+              return LandmarkType::rightPupil;
+            }
+            break;
+          case -1944905159:
+            if (name == "upperJawlineLeft")
+            {
+              return LandmarkType::upperJawlineLeft;
+            }
+            break;
+          case -853153581:
+            if (name == "midJawlineLeft")
+            {
+              return LandmarkType::midJawlineLeft;
+            }
+            break;
+          case -2123416811:
+            if (name == "chinBottom")
+            {
+              return LandmarkType::chinBottom;
+            }
+            break;
+          case -672296240:
+            if (name == "midJawlineRight")
+            {
+              return LandmarkType::midJawlineRight;
+            }
+            break;
+          case -156856790:
+            if (name == "upperJawlineRight")
+            {
+              return LandmarkType::upperJawlineRight;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -195,79 +268,26 @@ namespace Aws
           return LandmarkType::NOT_SET;
         }
 
-        Aws::String GetNameForLandmarkType(LandmarkType enumValue)
+        const char* GetNameForLandmarkTypeCStr(LandmarkType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LandmarkType::eyeLeft:
-            return "eyeLeft";
-          case LandmarkType::eyeRight:
-            return "eyeRight";
-          case LandmarkType::nose:
-            return "nose";
-          case LandmarkType::mouthLeft:
-            return "mouthLeft";
-          case LandmarkType::mouthRight:
-            return "mouthRight";
-          case LandmarkType::leftEyeBrowLeft:
-            return "leftEyeBrowLeft";
-          case LandmarkType::leftEyeBrowRight:
-            return "leftEyeBrowRight";
-          case LandmarkType::leftEyeBrowUp:
-            return "leftEyeBrowUp";
-          case LandmarkType::rightEyeBrowLeft:
-            return "rightEyeBrowLeft";
-          case LandmarkType::rightEyeBrowRight:
-            return "rightEyeBrowRight";
-          case LandmarkType::rightEyeBrowUp:
-            return "rightEyeBrowUp";
-          case LandmarkType::leftEyeLeft:
-            return "leftEyeLeft";
-          case LandmarkType::leftEyeRight:
-            return "leftEyeRight";
-          case LandmarkType::leftEyeUp:
-            return "leftEyeUp";
-          case LandmarkType::leftEyeDown:
-            return "leftEyeDown";
-          case LandmarkType::rightEyeLeft:
-            return "rightEyeLeft";
-          case LandmarkType::rightEyeRight:
-            return "rightEyeRight";
-          case LandmarkType::rightEyeUp:
-            return "rightEyeUp";
-          case LandmarkType::rightEyeDown:
-            return "rightEyeDown";
-          case LandmarkType::noseLeft:
-            return "noseLeft";
-          case LandmarkType::noseRight:
-            return "noseRight";
-          case LandmarkType::mouthUp:
-            return "mouthUp";
-          case LandmarkType::mouthDown:
-            return "mouthDown";
-          case LandmarkType::leftPupil:
-            return "leftPupil";
-          case LandmarkType::rightPupil:
-            return "rightPupil";
-          case LandmarkType::upperJawlineLeft:
-            return "upperJawlineLeft";
-          case LandmarkType::midJawlineLeft:
-            return "midJawlineLeft";
-          case LandmarkType::chinBottom:
-            return "chinBottom";
-          case LandmarkType::midJawlineRight:
-            return "midJawlineRight";
-          case LandmarkType::upperJawlineRight:
-            return "upperJawlineRight";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLandmarkType(LandmarkType enumValue)
+        {
+          return GetNameForLandmarkTypeCStr(enumValue);
         }
 
       } // namespace LandmarkTypeMapper
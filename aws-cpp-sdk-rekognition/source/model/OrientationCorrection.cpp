@@ -30,30 +30,51 @@ namespace Aws
       namespace OrientationCorrectionMapper
       {
 
-        static const int ROTATE_0_HASH = HashingUtils::HashString("ROTATE_0");
-        static const int ROTATE_90_HASH = HashingUtils::HashString("ROTATE_90");
-        static const int ROTATE_180_HASH = HashingUtils::HashString("ROTATE_180");
-        static const int ROTATE_270_HASH = HashingUtils::HashString("ROTATE_270");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ROTATE_0",
+          "ROTATE_90",
+          "ROTATE_180",
+          "ROTATE_270",
+        };
 
         OrientationCorrection GetOrientationCorrectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ROTATE_0_HASH)
-          {
-            return OrientationCorrection::ROTATE_0;
-          }
-          else if (hashCode == ROTATE_90_HASH)
-          {
-            return OrientationCorrection::ROTATE_90;
-          }
-          else if (hashCode == ROTATE_180_HASH)
-          {
-            return OrientationCorrection::ROTATE_180;
-          }
-          else if (hashCode == ROTATE_270_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OrientationCorrection::ROTATE_270;
+          case 742322764:
+            if (name == "ROTATE_0")
+            {
+              return OrientationCorrection::ROTATE_0;
+            }
+            break;
+          case 1537169531:
+            if (name == "ROTATE_90")
+            {
+              return OrientationCorrection::ROTATE_90;
+            }
+            break;
+          case 407607813:
+            if (name == "ROTATE_180")
+            {
+              return OrientationCorrection::ROTATE_180;
+            }
+            break;
+          case 407608743:
+            if (name == "ROTATE_270")
+            {
+              return OrientationCorrection::ROTATE_270;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return OrientationCorrection::NOT_SET;
         }
 
-        Aws::String GetNameForOrientationCorrection(OrientationCorrection enumValue)
+        const char* GetNameForOrientationCorrectionCStr(OrientationCorrection enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OrientationCorrection::ROTATE_0:
-            return "ROTATE_0";
-          case OrientationCorrection::ROTATE_90:
-            return "ROTATE_90";
-          case OrientationCorrection::ROTATE_180:
-            return "ROTATE_180";
-          case OrientationCorrection::ROTATE_270:
-            return "ROTATE_270";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOrientationCorrection(OrientationCorrection enumValue)
+        {
+          return GetNameForOrientationCorrectionCStr(enumValue);
         }
 
       } // namespace OrientationCorrectionMapper
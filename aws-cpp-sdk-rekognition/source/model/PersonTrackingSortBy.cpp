@@ -30,20 +30,37 @@ namespace Aws
       namespace PersonTrackingSortByMapper
       {
 
-        static const int INDEX_HASH = HashingUtils::HashString("INDEX");
-        static const int TIMESTAMP_HASH = HashingUtils::HashString("TIMESTAMP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INDEX",
+          "TIMESTAMP",
+        };
 
         PersonTrackingSortBy GetPersonTrackingSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INDEX_HASH)
-          {
-            return PersonTrackingSortBy::INDEX;
-          }
-          else if (hashCode == TIMESTAMP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PersonTrackingSortBy::TIMESTAMP;
+          case 69808306:
+            if (name == "INDEX")
+            {
+              return PersonTrackingSortBy::INDEX;
+            }
+            break;
+          case -1453246218:
+            if (name == "TIMESTAMP")
+            {
+              return PersonTrackingSortBy::TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PersonTrackingSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForPersonTrackingSortBy(PersonTrackingSortBy enumValue)
+        const char* GetNameForPersonTrackingSortByCStr(PersonTrackingSortBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PersonTrackingSortBy::INDEX:
-            return "INDEX";
-          case PersonTrackingSortBy::TIMESTAMP:
-            return "TIMESTAMP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPersonTrackingSortBy(PersonTrackingSortBy enumValue)
+        {
+          return GetNameForPersonTrackingSortByCStr(enumValue);
         }
 
       } // namespace PersonTrackingSortByMapper
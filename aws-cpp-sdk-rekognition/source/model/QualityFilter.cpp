@@ -30,20 +30,37 @@ namespace Aws
       namespace QualityFilterMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "AUTO",
+        };
 
         QualityFilter GetQualityFilterForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return QualityFilter::NONE;
-          }
-          else if (hashCode == AUTO_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return QualityFilter::AUTO;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return QualityFilter::NONE;
+            }
+            break;
+          case 2020783:
+            if (name == "AUTO")
+            {
+              return QualityFilter::AUTO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return QualityFilter::NOT_SET;
         }
 
-        Aws::String GetNameForQualityFilter(QualityFilter enumValue)
+        const char* GetNameForQualityFilterCStr(QualityFilter enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QualityFilter::NONE:
-            return "NONE";
-          case QualityFilter::AUTO:
-            return "AUTO";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQualityFilter(QualityFilter enumValue)
+        {
+          return GetNameForQualityFilterCStr(enumValue);
         }
 
       } // namespace QualityFilterMapper
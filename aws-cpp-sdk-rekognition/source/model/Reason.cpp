@@ -30,40 +30,65 @@ namespace Aws
       namespace ReasonMapper
       {
 
-        static const int EXCEEDS_MAX_FACES_HASH = HashingUtils::HashString("EXCEEDS_MAX_FACES");
-        static const int EXTREME_POSE_HASH = HashingUtils::HashString("EXTREME_POSE");
-        static const int LOW_BRIGHTNESS_HASH = HashingUtils::HashString("LOW_BRIGHTNESS");
-        static const int LOW_SHARPNESS_HASH = HashingUtils::HashString("LOW_SHARPNESS");
-        static const int LOW_CONFIDENCE_HASH = HashingUtils::HashString("LOW_CONFIDENCE");
-        static const int SMALL_BOUNDING_BOX_HASH = HashingUtils::HashString("SMALL_BOUNDING_BOX");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EXCEEDS_MAX_FACES",
+          "EXTREME_POSE",
+          "LOW_BRIGHTNESS",
+          "LOW_SHARPNESS",
+          "LOW_CONFIDENCE",
+          "SMALL_BOUNDING_BOX",
+        };
 
         Reason GetReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXCEEDS_MAX_FACES_HASH)
-          {
-            return Reason::EXCEEDS_MAX_FACES;
-          }
-          else if (hashCode == EXTREME_POSE_HASH)
-          {
-            return Reason::EXTREME_POSE;
-          }
-          else if (hashCode == LOW_BRIGHTNESS_HASH)
-          {
-            return Reason::LOW_BRIGHTNESS;
-          }
-          else if (hashCode == LOW_SHARPNESS_HASH)
-          {
-            return Reason::LOW_SHARPNESS;
-          }
-          else if (hashCode == LOW_CONFIDENCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Reason::LOW_CONFIDENCE;
-          }
-          else if (hashCode == SMALL_BOUNDING_BOX_HASH)
-          {
-            return Reason::SMALL_BOUNDING_BOX;
+          case -1123785285:
+            if (name == "EXCEEDS_MAX_FACES")
+            {
+              return Reason::EXCEEDS_MAX_FACES;
+            }
+            break;
+          case 1267943524:
+            if (name == "EXTREME_POSE")
+            {
+              return Reason::EXTREME_POSE;
+            }
+            break;
+          case -904888772:
+            if (name == "LOW_BRIGHTNESS")
+            {
+              return Reason::LOW_BRIGHTNESS;
+            }
+            break;
+          case -1205561898:
+            if (name == "LOW_SHARPNESS")
+            {
+              return Reason::LOW_SHARPNESS;
+            }
+            break;
+          case -723799947:
+            if (name == "LOW_CONFIDENCE")
+            {
+              return Reason::LOW_CONFIDENCE;
+            }
+            break;
+          case -263589656:
+            if (name == "SMALL_BOUNDING_BOX")
+            {
+              return Reason::SMALL_BOUNDING_BOX;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return Reason::NOT_SET;
         }
 
-        Aws::String GetNameForReason(Reason enumValue)
+        const char* GetNameForReasonCStr(Reason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Reason::EXCEEDS_MAX_FACES:
-            return "EXCEEDS_MAX_FACES";
-          case Reason::EXTREME_POSE:
-            return "EXTREME_POSE";
-          case Reason::LOW_BRIGHTNESS:
-            return "LOW_BRIGHTNESS";
-          case Reason::LOW_SHARPNESS:
-            return "LOW_SHARPNESS";
-          case Reason::LOW_CONFIDENCE:
-            return "LOW_CONFIDENCE";
-          case Reason::SMALL_BOUNDING_BOX:
-            return "SMALL_BOUNDING_BOX";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReason(Reason enumValue)
+        {
+          return GetNameForReasonCStr(enumValue);
         }
 
       } // namespace ReasonMapper
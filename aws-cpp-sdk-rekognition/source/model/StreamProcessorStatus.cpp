@@ -30,35 +30,58 @@ namespace Aws
       namespace StreamProcessorStatusMapper
       {
 
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STOPPED",
+          "STARTING",
+          "RUNNING",
+          "FAILED",
+          "STOPPING",
+        };
 
         StreamProcessorStatus GetStreamProcessorStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STOPPED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StreamProcessorStatus::STOPPED;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return StreamProcessorStatus::STARTING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return StreamProcessorStatus::RUNNING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StreamProcessorStatus::FAILED;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return StreamProcessorStatus::STOPPING;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return StreamProcessorStatus::STOPPED;
+            }
+            break;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return StreamProcessorStatus::STARTING;
+            }
+            break;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return StreamProcessorStatus::RUNNING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return StreamProcessorStatus::FAILED;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return StreamProcessorStatus::STOPPING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return StreamProcessorStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStreamProcessorStatus(StreamProcessorStatus enumValue)
+        const char* GetNameForStreamProcessorStatusCStr(StreamProcessorStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StreamProcessorStatus::STOPPED:
-            return "STOPPED";
-          case StreamProcessorStatus::STARTING:
-            return "STARTING";
-          case StreamProcessorStatus::RUNNING:
-            return "RUNNING";
-          case StreamProcessorStatus::FAILED:
-            return "FAILED";
-          case StreamProcessorStatus::STOPPING:
-            return "STOPPING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStreamProcessorStatus(StreamProcessorStatus enumValue)
+        {
+          return GetNameForStreamProcessorStatusCStr(enumValue);
         }
 
       } // namespace StreamProcessorStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TextTypesMapper
       {
 
-        static const int LINE_HASH = HashingUtils::HashString("LINE");
-        static const int WORD_HASH = HashingUtils::HashString("WORD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "LINE",
+          "WORD",
+        };
 
         TextTypes GetTextTypesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LINE_HASH)
-          {
-            return TextTypes::LINE;
-          }
-          else if (hashCode == WORD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TextTypes::WORD;
+          case 2336756:
+            if (name == "LINE")
+            {
+              return TextTypes::LINE;
+            }
+            break;
+          case 2670346:
+            if (name == "WORD")
+            {
+              return TextTypes::WORD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TextTypes::NOT_SET;
         }
 
-        Aws::String GetNameForTextTypes(TextTypes enumValue)
+        const char* GetNameForTextTypesCStr(TextTypes enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TextTypes::LINE:
-            return "LINE";
-          case TextTypes::WORD:
-            return "WORD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTextTypes(TextTypes enumValue)
+        {
+          return GetNameForTextTypesCStr(enumValue);
         }
 
       } // namespace TextTypesMapper
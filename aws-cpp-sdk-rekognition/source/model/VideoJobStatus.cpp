@@ -30,25 +30,44 @@ namespace Aws
       namespace VideoJobStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "SUCCEEDED",
+          "FAILED",
+        };
 
         VideoJobStatus GetVideoJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return VideoJobStatus::IN_PROGRESS;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VideoJobStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return VideoJobStatus::FAILED;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return VideoJobStatus::IN_PROGRESS;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return VideoJobStatus::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return VideoJobStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return VideoJobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForVideoJobStatus(VideoJobStatus enumValue)
+        const char* GetNameForVideoJobStatusCStr(VideoJobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VideoJobStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case VideoJobStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case VideoJobStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVideoJobStatus(VideoJobStatus enumValue)
+        {
+          return GetNameForVideoJobStatusCStr(enumValue);
         }
 
       } // namespace VideoJobStatusMapper
@@ -34,6 +34,11 @@ namespace GroupFilterNameMapper
 AWS_RESOURCEGROUPS_API GroupFilterName GetGroupFilterNameForName(const Aws::String& name);
 
 AWS_RESOURCEGROUPS_API Aws::String GetNameForGroupFilterName(GroupFilterName value);
+
+/**
+ * Same as GetNameForGroupFilterName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_RESOURCEGROUPS_API const char* GetNameForGroupFilterNameCStr(GroupFilterName value);
 } // namespace GroupFilterNameMapper
 } // namespace Model
 } // namespace ResourceGroups
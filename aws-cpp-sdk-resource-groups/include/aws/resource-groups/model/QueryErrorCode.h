@@ -35,6 +35,11 @@ namespace QueryErrorCodeMapper
 AWS_RESOURCEGROUPS_API QueryErrorCode GetQueryErrorCodeForName(const Aws::String& name);
 
 AWS_RESOURCEGROUPS_API Aws::String GetNameForQueryErrorCode(QueryErrorCode value);
+
+/**
+ * Same as GetNameForQueryErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_RESOURCEGROUPS_API const char* GetNameForQueryErrorCodeCStr(QueryErrorCode value);
 } // namespace QueryErrorCodeMapper
 } // namespace Model
 } // namespace ResourceGroups
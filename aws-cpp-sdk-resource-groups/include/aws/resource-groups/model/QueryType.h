@@ -35,6 +35,11 @@ namespace QueryTypeMapper
 AWS_RESOURCEGROUPS_API QueryType GetQueryTypeForName(const Aws::String& name);
 
 AWS_RESOURCEGROUPS_API Aws::String GetNameForQueryType(QueryType value);
+
+/**
+ * Same as GetNameForQueryType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_RESOURCEGROUPS_API const char* GetNameForQueryTypeCStr(QueryType value);
 } // namespace QueryTypeMapper
 } // namespace Model
 } // namespace ResourceGroups
@@ -34,6 +34,11 @@ namespace ResourceFilterNameMapper
 AWS_RESOURCEGROUPS_API ResourceFilterName GetResourceFilterNameForName(const Aws::String& name);
 
 AWS_RESOURCEGROUPS_API Aws::String GetNameForResourceFilterName(ResourceFilterName value);
+
+/**
+ * Same as GetNameForResourceFilterName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_RESOURCEGROUPS_API const char* GetNameForResourceFilterNameCStr(ResourceFilterName value);
 } // namespace ResourceFilterNameMapper
 } // namespace Model
 } // namespace ResourceGroups
@@ -30,15 +30,30 @@ namespace Aws
       namespace GroupFilterNameMapper
       {
 
-        static const int resource_type_HASH = HashingUtils::HashString("resource-type");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "resource-type",
+        };
 
         GroupFilterName GetGroupFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == resource_type_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GroupFilterName::resource_type;
+          case 933447065:
+            if (name == "resource-type")
+            {
+              return GroupFilterName::resource_type;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return GroupFilterName::NOT_SET;
         }
 
-        Aws::String GetNameForGroupFilterName(GroupFilterName enumValue)
+        const char* GetNameForGroupFilterNameCStr(GroupFilterName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GroupFilterName::resource_type:
-            return "resource-type";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGroupFilterName(GroupFilterName enumValue)
+        {
+          return GetNameForGroupFilterNameCStr(enumValue);
         }
 
       } // namespace GroupFilterNameMapper
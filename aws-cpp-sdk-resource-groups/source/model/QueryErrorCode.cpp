@@ -30,20 +30,37 @@ namespace Aws
       namespace QueryErrorCodeMapper
       {
 
-        static const int CLOUDFORMATION_STACK_INACTIVE_HASH = HashingUtils::HashString("CLOUDFORMATION_STACK_INACTIVE");
-        static const int CLOUDFORMATION_STACK_NOT_EXISTING_HASH = HashingUtils::HashString("CLOUDFORMATION_STACK_NOT_EXISTING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CLOUDFORMATION_STACK_INACTIVE",
+          "CLOUDFORMATION_STACK_NOT_EXISTING",
+        };
 
         QueryErrorCode GetQueryErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLOUDFORMATION_STACK_INACTIVE_HASH)
-          {
-            return QueryErrorCode::CLOUDFORMATION_STACK_INACTIVE;
-          }
-          else if (hashCode == CLOUDFORMATION_STACK_NOT_EXISTING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return QueryErrorCode::CLOUDFORMATION_STACK_NOT_EXISTING;
+          case -397303579:
+            if (name == "CLOUDFORMATION_STACK_INACTIVE")
+            {
+              return QueryErrorCode::CLOUDFORMATION_STACK_INACTIVE;
+            }
+            break;
+          case 896698641:
+            if (name == "CLOUDFORMATION_STACK_NOT_EXISTING")
+            {
+              return QueryErrorCode::CLOUDFORMATION_STACK_NOT_EXISTING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return QueryErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForQueryErrorCode(QueryErrorCode enumValue)
+        const char* GetNameForQueryErrorCodeCStr(QueryErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QueryErrorCode::CLOUDFORMATION_STACK_INACTIVE:
-            return "CLOUDFORMATION_STACK_INACTIVE";
-          case QueryErrorCode::CLOUDFORMATION_STACK_NOT_EXISTING:
-            return "CLOUDFORMATION_STACK_NOT_EXISTING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQueryErrorCode(QueryErrorCode enumValue)
+        {
+          return GetNameForQueryErrorCodeCStr(enumValue);
         }
 
       } // namespace QueryErrorCodeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace QueryTypeMapper
       {
 
-        static const int TAG_FILTERS_1_0_HASH = HashingUtils::HashString("TAG_FILTERS_1_0");
-        static const int CLOUDFORMATION_STACK_1_0_HASH = HashingUtils::HashString("CLOUDFORMATION_STACK_1_0");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TAG_FILTERS_1_0",
+          "CLOUDFORMATION_STACK_1_0",
+        };
 
         QueryType GetQueryTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TAG_FILTERS_1_0_HASH)
-          {
-            return QueryType::TAG_FILTERS_1_0;
-          }
-          else if (hashCode == CLOUDFORMATION_STACK_1_0_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return QueryType::CLOUDFORMATION_STACK_1_0;
+          case 586741753:
+            if (name == "TAG_FILTERS_1_0")
+            {
+              return QueryType::TAG_FILTERS_1_0;
+            }
+            break;
+          case 735382248:
+            if (name == "CLOUDFORMATION_STACK_1_0")
+            {
+              return QueryType::CLOUDFORMATION_STACK_1_0;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return QueryType::NOT_SET;
         }
 
-        Aws::String GetNameForQueryType(QueryType enumValue)
+        const char* GetNameForQueryTypeCStr(QueryType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QueryType::TAG_FILTERS_1_0:
-            return "TAG_FILTERS_1_0";
-          case QueryType::CLOUDFORMATION_STACK_1_0:
-            return "CLOUDFORMATION_STACK_1_0";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQueryType(QueryType enumValue)
+        {
+          return GetNameForQueryTypeCStr(enumValue);
         }
 
       } // namespace QueryTypeMapper
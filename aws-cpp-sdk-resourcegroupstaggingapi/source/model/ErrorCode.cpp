@@ -30,20 +30,37 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int InternalServiceException_HASH = HashingUtils::HashString("InternalServiceException");
-        static const int InvalidParameterException_HASH = HashingUtils::HashString("InvalidParameterException");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InternalServiceException",
+          "InvalidParameterException",
+        };
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InternalServiceException_HASH)
-          {
-            return ErrorCode::InternalServiceException;
-          }
-          else if (hashCode == InvalidParameterException_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ErrorCode::InvalidParameterException;
+          case -1158088169:
+            if (name == "InternalServiceException")
+            {
+              return ErrorCode::InternalServiceException;
+            }
+            break;
+          case 1674340573:
+            if (name == "InvalidParameterException")
+            {
+              return ErrorCode::InvalidParameterException;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        const char* GetNameForErrorCodeCStr(ErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ErrorCode::InternalServiceException:
-            return "InternalServiceException";
-          case ErrorCode::InvalidParameterException:
-            return "InvalidParameterException";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        {
+          return GetNameForErrorCodeCStr(enumValue);
         }
 
       } // namespace ErrorCodeMapper
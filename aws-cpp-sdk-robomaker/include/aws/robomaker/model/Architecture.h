@@ -36,6 +36,11 @@ namespace ArchitectureMapper
 AWS_ROBOMAKER_API Architecture GetArchitectureForName(const Aws::String& name);
 
 AWS_ROBOMAKER_API Aws::String GetNameForArchitecture(Architecture value);
+
+/**
+ * Same as GetNameForArchitecture(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROBOMAKER_API const char* GetNameForArchitectureCStr(Architecture value);
 } // namespace ArchitectureMapper
 } // namespace Model
 } // namespace RoboMaker
@@ -46,6 +46,11 @@ namespace DeploymentJobErrorCodeMapper
 AWS_ROBOMAKER_API DeploymentJobErrorCode GetDeploymentJobErrorCodeForName(const Aws::String& name);
 
 AWS_ROBOMAKER_API Aws::String GetNameForDeploymentJobErrorCode(DeploymentJobErrorCode value);
+
+/**
+ * Same as GetNameForDeploymentJobErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROBOMAKER_API const char* GetNameForDeploymentJobErrorCodeCStr(DeploymentJobErrorCode value);
 } // namespace DeploymentJobErrorCodeMapper
 } // namespace Model
 } // namespace RoboMaker
@@ -35,6 +35,11 @@ namespace FailureBehaviorMapper
 AWS_ROBOMAKER_API FailureBehavior GetFailureBehaviorForName(const Aws::String& name);
 
 AWS_ROBOMAKER_API Aws::String GetNameForFailureBehavior(FailureBehavior value);
+
+/**
+ * Same as GetNameForFailureBehavior(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROBOMAKER_API const char* GetNameForFailureBehaviorCStr(FailureBehavior value);
 } // namespace FailureBehaviorMapper
 } // namespace Model
 } // namespace RoboMaker
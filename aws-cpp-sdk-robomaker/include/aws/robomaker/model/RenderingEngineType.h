@@ -34,6 +34,11 @@ namespace RenderingEngineTypeMapper
 AWS_ROBOMAKER_API RenderingEngineType GetRenderingEngineTypeForName(const Aws::String& name);
 
 AWS_ROBOMAKER_API Aws::String GetNameForRenderingEngineType(RenderingEngineType value);
+
+/**
+ * Same as GetNameForRenderingEngineType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROBOMAKER_API const char* GetNameForRenderingEngineTypeCStr(RenderingEngineType value);
 } // namespace RenderingEngineTypeMapper
 } // namespace Model
 } // namespace RoboMaker
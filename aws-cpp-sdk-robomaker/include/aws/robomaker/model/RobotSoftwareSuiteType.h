@@ -34,6 +34,11 @@ namespace RobotSoftwareSuiteTypeMapper
 AWS_ROBOMAKER_API RobotSoftwareSuiteType GetRobotSoftwareSuiteTypeForName(const Aws::String& name);
 
 AWS_ROBOMAKER_API Aws::String GetNameForRobotSoftwareSuiteType(RobotSoftwareSuiteType value);
+
+/**
+ * Same as GetNameForRobotSoftwareSuiteType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROBOMAKER_API const char* GetNameForRobotSoftwareSuiteTypeCStr(RobotSoftwareSuiteType value);
 } // namespace RobotSoftwareSuiteTypeMapper
 } // namespace Model
 } // namespace RoboMaker
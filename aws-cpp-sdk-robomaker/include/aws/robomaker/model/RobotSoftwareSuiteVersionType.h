@@ -34,6 +34,11 @@ namespace RobotSoftwareSuiteVersionTypeMapper
 AWS_ROBOMAKER_API RobotSoftwareSuiteVersionType GetRobotSoftwareSuiteVersionTypeForName(const Aws::String& name);
 
 AWS_ROBOMAKER_API Aws::String GetNameForRobotSoftwareSuiteVersionType(RobotSoftwareSuiteVersionType value);
+
+/**
+ * Same as GetNameForRobotSoftwareSuiteVersionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROBOMAKER_API const char* GetNameForRobotSoftwareSuiteVersionTypeCStr(RobotSoftwareSuiteVersionType value);
 } // namespace RobotSoftwareSuiteVersionTypeMapper
 } // namespace Model
 } // namespace RoboMaker
@@ -40,6 +40,11 @@ namespace RobotStatusMapper
 AWS_ROBOMAKER_API RobotStatus GetRobotStatusForName(const Aws::String& name);
 
 AWS_ROBOMAKER_API Aws::String GetNameForRobotStatus(RobotStatus value);
+
+/**
+ * Same as GetNameForRobotStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROBOMAKER_API const char* GetNameForRobotStatusCStr(RobotStatus value);
 } // namespace RobotStatusMapper
 } // namespace Model
 } // namespace RoboMaker
@@ -47,6 +47,11 @@ namespace SimulationJobErrorCodeMapper
 AWS_ROBOMAKER_API SimulationJobErrorCode GetSimulationJobErrorCodeForName(const Aws::String& name);
 
 AWS_ROBOMAKER_API Aws::String GetNameForSimulationJobErrorCode(SimulationJobErrorCode value);
+
+/**
+ * Same as GetNameForSimulationJobErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROBOMAKER_API const char* GetNameForSimulationJobErrorCodeCStr(SimulationJobErrorCode value);
 } // namespace SimulationJobErrorCodeMapper
 } // namespace Model
 } // namespace RoboMaker
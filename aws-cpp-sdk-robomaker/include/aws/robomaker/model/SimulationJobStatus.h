@@ -43,6 +43,11 @@ namespace SimulationJobStatusMapper
 AWS_ROBOMAKER_API SimulationJobStatus GetSimulationJobStatusForName(const Aws::String& name);
 
 AWS_ROBOMAKER_API Aws::String GetNameForSimulationJobStatus(SimulationJobStatus value);
+
+/**
+ * Same as GetNameForSimulationJobStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROBOMAKER_API const char* GetNameForSimulationJobStatusCStr(SimulationJobStatus value);
 } // namespace SimulationJobStatusMapper
 } // namespace Model
 } // namespace RoboMaker
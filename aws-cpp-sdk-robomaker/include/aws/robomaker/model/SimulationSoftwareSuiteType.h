@@ -34,6 +34,11 @@ namespace SimulationSoftwareSuiteTypeMapper
 AWS_ROBOMAKER_API SimulationSoftwareSuiteType GetSimulationSoftwareSuiteTypeForName(const Aws::String& name);
 
 AWS_ROBOMAKER_API Aws::String GetNameForSimulationSoftwareSuiteType(SimulationSoftwareSuiteType value);
+
+/**
+ * Same as GetNameForSimulationSoftwareSuiteType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROBOMAKER_API const char* GetNameForSimulationSoftwareSuiteTypeCStr(SimulationSoftwareSuiteType value);
 } // namespace SimulationSoftwareSuiteTypeMapper
 } // namespace Model
 } // namespace RoboMaker
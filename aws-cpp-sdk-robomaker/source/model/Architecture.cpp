@@ -30,25 +30,44 @@ namespace Aws
       namespace ArchitectureMapper
       {
 
-        static const int X86_64_HASH = HashingUtils::HashString("X86_64");
-        static const int ARM64_HASH = HashingUtils::HashString("ARM64");
-        static const int ARMHF_HASH = HashingUtils::HashString("ARMHF");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "X86_64",
+          "ARM64",
+          "ARMHF",
+        };
 
         Architecture GetArchitectureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == X86_64_HASH)
-          {
-            return Architecture::X86_64;
-          }
-          else if (hashCode == ARM64_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Architecture::ARM64;
-          }
-          else if (hashCode == ARMHF_HASH)
-          {
-            return Architecture::ARMHF;
+          case -1722183097:
+            if (name == "X86_64")
+            {
+              return Architecture::X86_64;
+            }
+            break;
+          case 62547450:
+            if (name == "ARM64")
+            {
+              return Architecture::ARM64;
+            }
+            break;
+          case 62548026:
+            if (name == "ARMHF")
+            {
+              return Architecture::ARMHF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Architecture::NOT_SET;
         }
 
-        Aws::String GetNameForArchitecture(Architecture enumValue)
+        const char* GetNameForArchitectureCStr(Architecture enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Architecture::X86_64:
-            return "X86_64";
-          case Architecture::ARM64:
-            return "ARM64";
-          case Architecture::ARMHF:
-            return "ARMHF";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForArchitecture(Architecture enumValue)
+        {
+          return GetNameForArchitectureCStr(enumValue);
         }
 
       } // namespace ArchitectureMapper
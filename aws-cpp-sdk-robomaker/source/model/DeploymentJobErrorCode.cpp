@@ -30,75 +30,114 @@ namespace Aws
       namespace DeploymentJobErrorCodeMapper
       {
 
-        static const int ResourceNotFound_HASH = HashingUtils::HashString("ResourceNotFound");
-        static const int FailureThresholdBreached_HASH = HashingUtils::HashString("FailureThresholdBreached");
-        static const int RobotDeploymentNoResponse_HASH = HashingUtils::HashString("RobotDeploymentNoResponse");
-        static const int GreengrassDeploymentFailed_HASH = HashingUtils::HashString("GreengrassDeploymentFailed");
-        static const int MissingRobotArchitecture_HASH = HashingUtils::HashString("MissingRobotArchitecture");
-        static const int MissingRobotApplicationArchitecture_HASH = HashingUtils::HashString("MissingRobotApplicationArchitecture");
-        static const int MissingRobotDeploymentResource_HASH = HashingUtils::HashString("MissingRobotDeploymentResource");
-        static const int GreengrassGroupVersionDoesNotExist_HASH = HashingUtils::HashString("GreengrassGroupVersionDoesNotExist");
-        static const int ExtractingBundleFailure_HASH = HashingUtils::HashString("ExtractingBundleFailure");
-        static const int PreLaunchFileFailure_HASH = HashingUtils::HashString("PreLaunchFileFailure");
-        static const int PostLaunchFileFailure_HASH = HashingUtils::HashString("PostLaunchFileFailure");
-        static const int BadPermissionError_HASH = HashingUtils::HashString("BadPermissionError");
-        static const int InternalServerError_HASH = HashingUtils::HashString("InternalServerError");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ResourceNotFound",
+          "FailureThresholdBreached",
+          "RobotDeploymentNoResponse",
+          "GreengrassDeploymentFailed",
+          "MissingRobotArchitecture",
+          "MissingRobotApplicationArchitecture",
+          "MissingRobotDeploymentResource",
+          "GreengrassGroupVersionDoesNotExist",
+          "ExtractingBundleFailure",
+          "PreLaunchFileFailure",
+          "PostLaunchFileFailure",
+          "BadPermissionError",
+          "InternalServerError",
+        };
 
         DeploymentJobErrorCode GetDeploymentJobErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ResourceNotFound_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentJobErrorCode::ResourceNotFound;
-          }
-          else if (hashCode == FailureThresholdBreached_HASH)
-          {
-            return DeploymentJobErrorCode::FailureThresholdBreached;
-          }
-          else if (hashCode == RobotDeploymentNoResponse_HASH)
-          {
-            return DeploymentJobErrorCode::RobotDeploymentNoResponse;
-          }
-          else if (hashCode == GreengrassDeploymentFailed_HASH)
-          {
-            return DeploymentJobErrorCode::GreengrassDeploymentFailed;
-          }
-          else if (hashCode == MissingRobotArchitecture_HASH)
-          {
-            return DeploymentJobErrorCode::MissingRobotArchitecture;
-          }
-          else if (hashCode == MissingRobotApplicationArchitecture_HASH)
-          {
-            return DeploymentJobErrorCode::MissingRobotApplicationArchitecture;
-          }
-          else if (hashCode == MissingRobotDeploymentResource_HASH)
-          {
-            return DeploymentJobErrorCode::MissingRobotDeploymentResource;
-          }
-          else if (hashCode == GreengrassGroupVersionDoesNotExist_HASH)
-          {
-            return DeploymentJobErrorCode::GreengrassGroupVersionDoesNotExist;
-          }
-          else if (hashCode == ExtractingBundleFailure_HASH)
-          {
-            return DeploymentJobErrorCode::ExtractingBundleFailure;
-          }
-          else if (hashCode == PreLaunchFileFailure_HASH)
-          {
-            return DeploymentJobErrorCode::PreLaunchFileFailure;
-          }
-          else if (hashCode == PostLaunchFileFailure_HASH)
-          {
-            return DeploymentJobErrorCode::PostLaunchFileFailure;
-          }
-          else if (hashCode == BadPermissionError_HASH)
-          {
-            return DeploymentJobErrorCode::BadPermissionError;
-          }
-          else if (hashCode == InternalServerError_HASH)
-          {
-            return DeploymentJobErrorCode::InternalServerError;
+          case -1080408387:
+            if (name == "ResourceNotFound")
+            {
+              return DeploymentJobErrorCode::ResourceNotFound;
+            }
+            break;
+          case -1802672143:
+            if (name == "FailureThresholdBreached")
+            {
+              return DeploymentJobErrorCode::FailureThresholdBreached;
+            }
+            break;
+          case -1194819791:
+            if (name == "RobotDeploymentNoResponse")
+            {
+              return DeploymentJobErrorCode::RobotDeploymentNoResponse;
+            }
+            break;
+          case -1367176651:
+            if (name == "GreengrassDeploymentFailed")
+            {
+              return DeploymentJobErrorCode::GreengrassDeploymentFailed;
+            }
+            break;
+          case 300545079:
+            if (name == "MissingRobotArchitecture")
+            {
+              return DeploymentJobErrorCode::MissingRobotArchitecture;
+            }
+            break;
+          case -68302497:
+            if (name == "MissingRobotApplicationArchitecture")
+            {
+              return DeploymentJobErrorCode::MissingRobotApplicationArchitecture;
+            }
+            break;
+          case -108323369:
+            if (name == "MissingRobotDeploymentResource")
+            {
+              return DeploymentJobErrorCode::MissingRobotDeploymentResource;
+            }
+            break;
+          case -1974360759:
+            if (name == "GreengrassGroupVersionDoesNotExist")
+            {
+              return DeploymentJobErrorCode::GreengrassGroupVersionDoesNotExist;
+            }
+            break;
+          case 2110778439:
+            if (name == "ExtractingBundleFailure")
+            {
+              return DeploymentJobErrorCode::ExtractingBundleFailure;
+            }
+            break;
+          case -970120:
+            if (name == "PreLaunchFileFailure")
+            {
+              return DeploymentJobErrorCode::PreLaunchFileFailure;
+            }
+            break;
+          case 1317896667:
+            if (name == "PostLaunchFileFailure")
+            {
+              return DeploymentJobErrorCode::PostLaunchFileFailure;
+            }
+            break;
+          case -1116654892:
+            if (name == "BadPermissionError")
+            {
+              return DeploymentJobErrorCode::BadPermissionError;
+            }
+            break;
+          case -1943616152:
+            if (name == "InternalServerError")
+            {
+              return DeploymentJobErrorCode::InternalServerError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,45 +149,26 @@ namespace Aws
           return DeploymentJobErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentJobErrorCode(DeploymentJobErrorCode enumValue)
+        const char* GetNameForDeploymentJobErrorCodeCStr(DeploymentJobErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentJobErrorCode::ResourceNotFound:
-            return "ResourceNotFound";
-          case DeploymentJobErrorCode::FailureThresholdBreached:
-            return "FailureThresholdBreached";
-          case DeploymentJobErrorCode::RobotDeploymentNoResponse:
-            return "RobotDeploymentNoResponse";
-          case DeploymentJobErrorCode::GreengrassDeploymentFailed:
-            return "GreengrassDeploymentFailed";
-          case DeploymentJobErrorCode::MissingRobotArchitecture:
-            return "MissingRobotArchitecture";
-          case DeploymentJobErrorCode::MissingRobotApplicationArchitecture:
-            return "MissingRobotApplicationArchitecture";
-          case DeploymentJobErrorCode::MissingRobotDeploymentResource:
-            return "MissingRobotDeploymentResource";
-          case DeploymentJobErrorCode::GreengrassGroupVersionDoesNotExist:
-            return "GreengrassGroupVersionDoesNotExist";
-          case DeploymentJobErrorCode::ExtractingBundleFailure:
-            return "ExtractingBundleFailure";
-          case DeploymentJobErrorCode::PreLaunchFileFailure:
-            return "PreLaunchFileFailure";
-          case DeploymentJobErrorCode::PostLaunchFileFailure:
-            return "PostLaunchFileFailure";
-          case DeploymentJobErrorCode::BadPermissionError:
-            return "BadPermissionError";
-          case DeploymentJobErrorCode::InternalServerError:
-            return "InternalServerError";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentJobErrorCode(DeploymentJobErrorCode enumValue)
+        {
+          return GetNameForDeploymentJobErrorCodeCStr(enumValue);
         }
 
       } // namespace DeploymentJobErrorCodeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace DeploymentStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Preparing_HASH = HashingUtils::HashString("Preparing");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "Preparing",
+          "InProgress",
+          "Failed",
+          "Succeeded",
+        };
 
         DeploymentStatus GetDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DeploymentStatus::Pending;
-          }
-          else if (hashCode == Preparing_HASH)
-          {
-            return DeploymentStatus::Preparing;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return DeploymentStatus::InProgress;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return DeploymentStatus::Failed;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return DeploymentStatus::Succeeded;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return DeploymentStatus::Pending;
+            }
+            break;
+          case 992551908:
+            if (name == "Preparing")
+            {
+              return DeploymentStatus::Preparing;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return DeploymentStatus::InProgress;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return DeploymentStatus::Failed;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return DeploymentStatus::Succeeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return DeploymentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentStatus(DeploymentStatus enumValue)
+        const char* GetNameForDeploymentStatusCStr(DeploymentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DeploymentStatus::Pending:
-            return "Pending";
-          case DeploymentStatus::Preparing:
-            return "Preparing";
-          case DeploymentStatus::InProgress:
-            return "InProgress";
-          case DeploymentStatus::Failed:
-            return "Failed";
-          case DeploymentStatus::Succeeded:
-            return "Succeeded";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDeploymentStatus(DeploymentStatus enumValue)
+        {
+          return GetNameForDeploymentStatusCStr(enumValue);
         }
 
       } // namespace DeploymentStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FailureBehaviorMapper
       {
 
-        static const int Fail_HASH = HashingUtils::HashString("Fail");
-        static const int Continue_HASH = HashingUtils::HashString("Continue");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Fail",
+          "Continue",
+        };
 
         FailureBehavior GetFailureBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Fail_HASH)
-          {
-            return FailureBehavior::Fail;
-          }
-          else if (hashCode == Continue_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FailureBehavior::Continue;
+          case 2181950:
+            if (name == "Fail")
+            {
+              return FailureBehavior::Fail;
+            }
+            break;
+          case -502558521:
+            if (name == "Continue")
+            {
+              return FailureBehavior::Continue;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FailureBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForFailureBehavior(FailureBehavior enumValue)
+        const char* GetNameForFailureBehaviorCStr(FailureBehavior enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FailureBehavior::Fail:
-            return "Fail";
-          case FailureBehavior::Continue:
-            return "Continue";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFailureBehavior(FailureBehavior enumValue)
+        {
+          return GetNameForFailureBehaviorCStr(enumValue);
         }
 
       } // namespace FailureBehaviorMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace RenderingEngineTypeMapper
       {
 
-        static const int OGRE_HASH = HashingUtils::HashString("OGRE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OGRE",
+        };
 
         RenderingEngineType GetRenderingEngineTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OGRE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RenderingEngineType::OGRE;
+          case 2424331:
+            if (name == "OGRE")
+            {
+              return RenderingEngineType::OGRE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return RenderingEngineType::NOT_SET;
         }
 
-        Aws::String GetNameForRenderingEngineType(RenderingEngineType enumValue)
+        const char* GetNameForRenderingEngineTypeCStr(RenderingEngineType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RenderingEngineType::OGRE:
-            return "OGRE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRenderingEngineType(RenderingEngineType enumValue)
+        {
+          return GetNameForRenderingEngineTypeCStr(enumValue);
         }
 
       } // namespace RenderingEngineTypeMapper
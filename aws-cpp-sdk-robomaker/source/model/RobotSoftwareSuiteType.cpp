@@ -30,15 +30,30 @@ namespace Aws
       namespace RobotSoftwareSuiteTypeMapper
       {
 
-        static const int ROS_HASH = HashingUtils::HashString("ROS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ROS",
+        };
 
         RobotSoftwareSuiteType GetRobotSoftwareSuiteTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ROS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RobotSoftwareSuiteType::ROS;
+          case 81334:
+            if (name == "ROS")
+            {
+              return RobotSoftwareSuiteType::ROS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return RobotSoftwareSuiteType::NOT_SET;
         }
 
-        Aws::String GetNameForRobotSoftwareSuiteType(RobotSoftwareSuiteType enumValue)
+        const char* GetNameForRobotSoftwareSuiteTypeCStr(RobotSoftwareSuiteType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RobotSoftwareSuiteType::ROS:
-            return "ROS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRobotSoftwareSuiteType(RobotSoftwareSuiteType enumValue)
+        {
+          return GetNameForRobotSoftwareSuiteTypeCStr(enumValue);
         }
 
       } // namespace RobotSoftwareSuiteTypeMapper
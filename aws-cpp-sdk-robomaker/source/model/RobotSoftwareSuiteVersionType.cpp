@@ -30,15 +30,30 @@ namespace Aws
       namespace RobotSoftwareSuiteVersionTypeMapper
       {
 
-        static const int Kinetic_HASH = HashingUtils::HashString("Kinetic");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Kinetic",
+        };
 
         RobotSoftwareSuiteVersionType GetRobotSoftwareSuiteVersionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Kinetic_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RobotSoftwareSuiteVersionType::Kinetic;
+          case 954071225:
+            if (name == "Kinetic")
+            {
+              return RobotSoftwareSuiteVersionType::Kinetic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return RobotSoftwareSuiteVersionType::NOT_SET;
         }
 
-        Aws::String GetNameForRobotSoftwareSuiteVersionType(RobotSoftwareSuiteVersionType enumValue)
+        const char* GetNameForRobotSoftwareSuiteVersionTypeCStr(RobotSoftwareSuiteVersionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RobotSoftwareSuiteVersionType::Kinetic:
-            return "Kinetic";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRobotSoftwareSuiteVersionType(RobotSoftwareSuiteVersionType enumValue)
+        {
+          return GetNameForRobotSoftwareSuiteVersionTypeCStr(enumValue);
         }
 
       } // namespace RobotSoftwareSuiteVersionTypeMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace RobotStatusMapper
       {
 
-        static const int Available_HASH = HashingUtils::HashString("Available");
-        static const int Registered_HASH = HashingUtils::HashString("Registered");
-        static const int PendingNewDeployment_HASH = HashingUtils::HashString("PendingNewDeployment");
-        static const int Deploying_HASH = HashingUtils::HashString("Deploying");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int InSync_HASH = HashingUtils::HashString("InSync");
-        static const int NoResponse_HASH = HashingUtils::HashString("NoResponse");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Available",
+          "Registered",
+          "PendingNewDeployment",
+          "Deploying",
+          "Failed",
+          "InSync",
+          "NoResponse",
+        };
 
         RobotStatus GetRobotStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Available_HASH)
-          {
-            return RobotStatus::Available;
-          }
-          else if (hashCode == Registered_HASH)
-          {
-            return RobotStatus::Registered;
-          }
-          else if (hashCode == PendingNewDeployment_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RobotStatus::PendingNewDeployment;
-          }
-          else if (hashCode == Deploying_HASH)
-          {
-            return RobotStatus::Deploying;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return RobotStatus::Failed;
-          }
-          else if (hashCode == InSync_HASH)
-          {
-            return RobotStatus::InSync;
-          }
-          else if (hashCode == NoResponse_HASH)
-          {
-            return RobotStatus::NoResponse;
+          case 1270065833:
+            if (name == "Available")
+            {
+              return RobotStatus::Available;
+            }
+            break;
+          case 123533986:
+            if (name == "Registered")
+            {
+              return RobotStatus::Registered;
+            }
+            break;
+          case 1458249806:
+            if (name == "PendingNewDeployment")
+            {
+              return RobotStatus::PendingNewDeployment;
+            }
+            break;
+          case 1096698235:
+            if (name == "Deploying")
+            {
+              return RobotStatus::Deploying;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return RobotStatus::Failed;
+            }
+            break;
+          case -2100859520:
+            if (name == "InSync")
+            {
+              return RobotStatus::InSync;
+            }
+            break;
+          case -1482813118:
+            if (name == "NoResponse")
+            {
+              return RobotStatus::NoResponse;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return RobotStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRobotStatus(RobotStatus enumValue)
+        const char* GetNameForRobotStatusCStr(RobotStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RobotStatus::Available:
-            return "Available";
-          case RobotStatus::Registered:
-            return "Registered";
-          case RobotStatus::PendingNewDeployment:
-            return "PendingNewDeployment";
-          case RobotStatus::Deploying:
-            return "Deploying";
-          case RobotStatus::Failed:
-            return "Failed";
-          case RobotStatus::InSync:
-            return "InSync";
-          case RobotStatus::NoResponse:
-            return "NoResponse";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRobotStatus(RobotStatus enumValue)
+        {
+          return GetNameForRobotStatusCStr(enumValue);
         }
 
       } // namespace RobotStatusMapper
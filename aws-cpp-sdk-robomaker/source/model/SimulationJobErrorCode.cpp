@@ -30,80 +30,121 @@ namespace Aws
       namespace SimulationJobErrorCodeMapper
       {
 
-        static const int InternalServiceError_HASH = HashingUtils::HashString("InternalServiceError");
-        static const int RobotApplicationCrash_HASH = HashingUtils::HashString("RobotApplicationCrash");
-        static const int SimulationApplicationCrash_HASH = HashingUtils::HashString("SimulationApplicationCrash");
-        static const int BadPermissionsRobotApplication_HASH = HashingUtils::HashString("BadPermissionsRobotApplication");
-        static const int BadPermissionsSimulationApplication_HASH = HashingUtils::HashString("BadPermissionsSimulationApplication");
-        static const int BadPermissionsS3Output_HASH = HashingUtils::HashString("BadPermissionsS3Output");
-        static const int BadPermissionsCloudwatchLogs_HASH = HashingUtils::HashString("BadPermissionsCloudwatchLogs");
-        static const int SubnetIpLimitExceeded_HASH = HashingUtils::HashString("SubnetIpLimitExceeded");
-        static const int ENILimitExceeded_HASH = HashingUtils::HashString("ENILimitExceeded");
-        static const int BadPermissionsUserCredentials_HASH = HashingUtils::HashString("BadPermissionsUserCredentials");
-        static const int InvalidBundleRobotApplication_HASH = HashingUtils::HashString("InvalidBundleRobotApplication");
-        static const int InvalidBundleSimulationApplication_HASH = HashingUtils::HashString("InvalidBundleSimulationApplication");
-        static const int RobotApplicationVersionMismatchedEtag_HASH = HashingUtils::HashString("RobotApplicationVersionMismatchedEtag");
-        static const int SimulationApplicationVersionMismatchedEtag_HASH = HashingUtils::HashString("SimulationApplicationVersionMismatchedEtag");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InternalServiceError",
+          "RobotApplicationCrash",
+          "SimulationApplicationCrash",
+          "BadPermissionsRobotApplication",
+          "BadPermissionsSimulationApplication",
+          "BadPermissionsS3Output",
+          "BadPermissionsCloudwatchLogs",
+          "SubnetIpLimitExceeded",
+          "ENILimitExceeded",
+          "BadPermissionsUserCredentials",
+          "InvalidBundleRobotApplication",
+          "InvalidBundleSimulationApplication",
+          "RobotApplicationVersionMismatchedEtag",
+          "SimulationApplicationVersionMismatchedEtag",
+        };
 
         SimulationJobErrorCode GetSimulationJobErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InternalServiceError_HASH)
-          {
-            return SimulationJobErrorCode::InternalServiceError;
-          }
-          else if (hashCode == RobotApplicationCrash_HASH)
-          {
-            return SimulationJobErrorCode::RobotApplicationCrash;
-          }
-          else if (hashCode == SimulationApplicationCrash_HASH)
-          {
-            return SimulationJobErrorCode::SimulationApplicationCrash;
-          }
-          else if (hashCode == BadPermissionsRobotApplication_HASH)
-          {
-            return SimulationJobErrorCode::BadPermissionsRobotApplication;
-          }
-          else if (hashCode == BadPermissionsSimulationApplication_HASH)
-          {
-            return SimulationJobErrorCode::BadPermissionsSimulationApplication;
-          }
-          else if (hashCode == BadPermissionsS3Output_HASH)
-          {
-            return SimulationJobErrorCode::BadPermissionsS3Output;
-          }
-          else if (hashCode == BadPermissionsCloudwatchLogs_HASH)
-          {
-            return SimulationJobErrorCode::BadPermissionsCloudwatchLogs;
-          }
-          else if (hashCode == SubnetIpLimitExceeded_HASH)
-          {
-            return SimulationJobErrorCode::SubnetIpLimitExceeded;
-          }
-          else if (hashCode == ENILimitExceeded_HASH)
-          {
-            return SimulationJobErrorCode::ENILimitExceeded;
-          }
-          else if (hashCode == BadPermissionsUserCredentials_HASH)
-          {
-            return SimulationJobErrorCode::BadPermissionsUserCredentials;
-          }
-          else if (hashCode == InvalidBundleRobotApplication_HASH)
-          {
-            return SimulationJobErrorCode::InvalidBundleRobotApplication;
-          }
-          else if (hashCode == InvalidBundleSimulationApplication_HASH)
-          {
-            return SimulationJobErrorCode::InvalidBundleSimulationApplication;
-          }
-          else if (hashCode == RobotApplicationVersionMismatchedEtag_HASH)
-          {
-            return SimulationJobErrorCode::RobotApplicationVersionMismatchedEtag;
-          }
-          else if (hashCode == SimulationApplicationVersionMismatchedEtag_HASH)
-          {
-            return SimulationJobErrorCode::SimulationApplicationVersionMismatchedEtag;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1294327856:
+            if (name == "InternalServiceError")
+            {
+              return SimulationJobErrorCode::InternalServiceError;
+            }
+            break;
+          case -941479263:
+            if (name == "RobotApplicationCrash")
+            {
+              return SimulationJobErrorCode::RobotApplicationCrash;
+            }
+            break;
+          case -1917560706:
+            if (name == "SimulationApplicationCrash")
+            {
+              return SimulationJobErrorCode::SimulationApplicationCrash;
+            }
+            break;
+          case 1865402885:
+            if (name == "BadPermissionsRobotApplication")
+            {
+              return SimulationJobErrorCode::BadPermissionsRobotApplication;
+            }
+            break;
+          case -2124441942:
+            if (name == "BadPermissionsSimulationApplication")
+            {
+              return SimulationJobErrorCode::BadPermissionsSimulationApplication;
+            }
+            break;
+          case 1045968832:
+            if (name == "BadPermissionsS3Output")
+            {
+              return SimulationJobErrorCode::BadPermissionsS3Output;
+            }
+            break;
+          case -1916670520:
+            if (name == "BadPermissionsCloudwatchLogs")
+            {
+              return SimulationJobErrorCode::BadPermissionsCloudwatchLogs;
+            }
+            break;
+          case -708988662:
+            if (name == "SubnetIpLimitExceeded")
+            {
+              return SimulationJobErrorCode::SubnetIpLimitExceeded;
+            }
+            break;
+          case -856059058:
+            if (name == "ENILimitExceeded")
+            {
+              return SimulationJobErrorCode::ENILimitExceeded;
+            }
+            break;
+          case -1827297070:
+            if (name == "BadPermissionsUserCredentials")
+            {
+              return SimulationJobErrorCode::BadPermissionsUserCredentials;
+            }
+            break;
+          case -522332193:
+            if (name == "InvalidBundleRobotApplication")
+            {
+              return SimulationJobErrorCode::InvalidBundleRobotApplication;
+            }
+            break;
+          case -1888345840:
+            if (name == "InvalidBundleSimulationApplication")
+            {
+              return SimulationJobErrorCode::InvalidBundleSimulationApplication;
+            }
+            break;
+          case -1529519212:
+            if (name == "RobotApplicationVersionMismatchedEtag")
+            {
+              return SimulationJobErrorCode::RobotApplicationVersionMismatchedEtag;
+            }
+            break;
+          case 89274225:
+            if (name == "SimulationApplicationVersionMismatchedEtag")
+            {
+              return SimulationJobErrorCode::SimulationApplicationVersionMismatchedEtag;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -115,47 +156,26 @@ namespace Aws
           return SimulationJobErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForSimulationJobErrorCode(SimulationJobErrorCode enumValue)
+        const char* GetNameForSimulationJobErrorCodeCStr(SimulationJobErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SimulationJobErrorCode::InternalServiceError:
-            return "InternalServiceError";
-          case SimulationJobErrorCode::RobotApplicationCrash:
-            return "RobotApplicationCrash";
-          case SimulationJobErrorCode::SimulationApplicationCrash:
-            return "SimulationApplicationCrash";
-          case SimulationJobErrorCode::BadPermissionsRobotApplication:
-            return "BadPermissionsRobotApplication";
-          case SimulationJobErrorCode::BadPermissionsSimulationApplication:
-            return "BadPermissionsSimulationApplication";
-          case SimulationJobErrorCode::BadPermissionsS3Output:
-            return "BadPermissionsS3Output";
-          case SimulationJobErrorCode::BadPermissionsCloudwatchLogs:
-            return "BadPermissionsCloudwatchLogs";
-          case SimulationJobErrorCode::SubnetIpLimitExceeded:
-            return "SubnetIpLimitExceeded";
-          case SimulationJobErrorCode::ENILimitExceeded:
-            return "ENILimitExceeded";
-          case SimulationJobErrorCode::BadPermissionsUserCredentials:
-            return "BadPermissionsUserCredentials";
-          case SimulationJobErrorCode::InvalidBundleRobotApplication:
-            return "InvalidBundleRobotApplication";
-          case SimulationJobErrorCode::InvalidBundleSimulationApplication:
-            return "InvalidBundleSimulationApplication";
-          case SimulationJobErrorCode::RobotApplicationVersionMismatchedEtag:
-            return "RobotApplicationVersionMismatchedEtag";
-          case SimulationJobErrorCode::SimulationApplicationVersionMismatchedEtag:
-            return "SimulationApplicationVersionMismatchedEtag";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSimulationJobErrorCode(SimulationJobErrorCode enumValue)
+        {
+          return GetNameForSimulationJobErrorCodeCStr(enumValue);
         }
 
       } // namespace SimulationJobErrorCodeMapper
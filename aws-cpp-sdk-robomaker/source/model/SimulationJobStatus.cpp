@@ -30,60 +30,93 @@ namespace Aws
       namespace SimulationJobStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Preparing_HASH = HashingUtils::HashString("Preparing");
-        static const int Running_HASH = HashingUtils::HashString("Running");
-        static const int Restarting_HASH = HashingUtils::HashString("Restarting");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int RunningFailed_HASH = HashingUtils::HashString("RunningFailed");
-        static const int Terminating_HASH = HashingUtils::HashString("Terminating");
-        static const int Terminated_HASH = HashingUtils::HashString("Terminated");
-        static const int Canceled_HASH = HashingUtils::HashString("Canceled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "Preparing",
+          "Running",
+          "Restarting",
+          "Completed",
+          "Failed",
+          "RunningFailed",
+          "Terminating",
+          "Terminated",
+          "Canceled",
+        };
 
         SimulationJobStatus GetSimulationJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return SimulationJobStatus::Pending;
-          }
-          else if (hashCode == Preparing_HASH)
-          {
-            return SimulationJobStatus::Preparing;
-          }
-          else if (hashCode == Running_HASH)
-          {
-            return SimulationJobStatus::Running;
-          }
-          else if (hashCode == Restarting_HASH)
-          {
-            return SimulationJobStatus::Restarting;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return SimulationJobStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return SimulationJobStatus::Failed;
-          }
-          else if (hashCode == RunningFailed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SimulationJobStatus::RunningFailed;
-          }
-          else if (hashCode == Terminating_HASH)
-          {
-            return SimulationJobStatus::Terminating;
-          }
-          else if (hashCode == Terminated_HASH)
-          {
-            return SimulationJobStatus::Terminated;
-          }
-          else if (hashCode == Canceled_HASH)
-          {
-            return SimulationJobStatus::Canceled;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return SimulationJobStatus::Pending;
+            }
+            break;
+          case 992551908:
+            if (name == "Preparing")
+            {
+              return SimulationJobStatus::Preparing;
+            }
+            break;
+          case -1079530081:
+            if (name == "Running")
+            {
+              return SimulationJobStatus::Running;
+            }
+            break;
+          case 218294163:
+            if (name == "Restarting")
+            {
+              return SimulationJobStatus::Restarting;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return SimulationJobStatus::Completed;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return SimulationJobStatus::Failed;
+            }
+            break;
+          case 342637244:
+            if (name == "RunningFailed")
+            {
+              return SimulationJobStatus::RunningFailed;
+            }
+            break;
+          case -250712386:
+            if (name == "Terminating")
+            {
+              return SimulationJobStatus::Terminating;
+            }
+            break;
+          case 684649027:
+            if (name == "Terminated")
+            {
+              return SimulationJobStatus::Terminated;
+            }
+            break;
+          case -58529607:
+            if (name == "Canceled")
+            {
+              return SimulationJobStatus::Canceled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return SimulationJobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSimulationJobStatus(SimulationJobStatus enumValue)
+        const char* GetNameForSimulationJobStatusCStr(SimulationJobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SimulationJobStatus::Pending:
-            return "Pending";
-          case SimulationJobStatus::Preparing:
-            return "Preparing";
-          case SimulationJobStatus::Running:
-            return "Running";
-          case SimulationJobStatus::Restarting:
-            return "Restarting";
-          case SimulationJobStatus::Completed:
-            return "Completed";
-          case SimulationJobStatus::Failed:
-            return "Failed";
-          case SimulationJobStatus::RunningFailed:
-            return "RunningFailed";
-          case SimulationJobStatus::Terminating:
-            return "Terminating";
-          case SimulationJobStatus::Terminated:
-            return "Terminated";
-          case SimulationJobStatus::Canceled:
-            return "Canceled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSimulationJobStatus(SimulationJobStatus enumValue)
+        {
+          return GetNameForSimulationJobStatusCStr(enumValue);
         }
 
       } // namespace SimulationJobStatusMapper
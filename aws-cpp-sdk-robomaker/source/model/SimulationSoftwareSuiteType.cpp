@@ -30,15 +30,30 @@ namespace Aws
       namespace SimulationSoftwareSuiteTypeMapper
       {
 
-        static const int Gazebo_HASH = HashingUtils::HashString("Gazebo");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Gazebo",
+        };
 
         SimulationSoftwareSuiteType GetSimulationSoftwareSuiteTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Gazebo_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SimulationSoftwareSuiteType::Gazebo;
+          case 2125985970:
+            if (name == "Gazebo")
+            {
+              return SimulationSoftwareSuiteType::Gazebo;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return SimulationSoftwareSuiteType::NOT_SET;
         }
 
-        Aws::String GetNameForSimulationSoftwareSuiteType(SimulationSoftwareSuiteType enumValue)
+        const char* GetNameForSimulationSoftwareSuiteTypeCStr(SimulationSoftwareSuiteType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SimulationSoftwareSuiteType::Gazebo:
-            return "Gazebo";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSimulationSoftwareSuiteType(SimulationSoftwareSuiteType enumValue)
+        {
+          return GetNameForSimulationSoftwareSuiteTypeCStr(enumValue);
         }
 
       } // namespace SimulationSoftwareSuiteTypeMapper
@@ -38,6 +38,11 @@ namespace AccountLimitTypeMapper
 AWS_ROUTE53_API AccountLimitType GetAccountLimitTypeForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForAccountLimitType(AccountLimitType value);
+
+/**
+ * Same as GetNameForAccountLimitType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForAccountLimitTypeCStr(AccountLimitType value);
 } // namespace AccountLimitTypeMapper
 } // namespace Model
 } // namespace Route53
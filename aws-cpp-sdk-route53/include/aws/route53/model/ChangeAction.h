@@ -36,6 +36,11 @@ namespace ChangeActionMapper
 AWS_ROUTE53_API ChangeAction GetChangeActionForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForChangeAction(ChangeAction value);
+
+/**
+ * Same as GetNameForChangeAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForChangeActionCStr(ChangeAction value);
 } // namespace ChangeActionMapper
 } // namespace Model
 } // namespace Route53
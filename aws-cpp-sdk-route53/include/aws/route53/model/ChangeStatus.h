@@ -35,6 +35,11 @@ namespace ChangeStatusMapper
 AWS_ROUTE53_API ChangeStatus GetChangeStatusForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForChangeStatus(ChangeStatus value);
+
+/**
+ * Same as GetNameForChangeStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForChangeStatusCStr(ChangeStatus value);
 } // namespace ChangeStatusMapper
 } // namespace Model
 } // namespace Route53
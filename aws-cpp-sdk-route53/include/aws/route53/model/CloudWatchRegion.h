@@ -50,6 +50,11 @@ namespace CloudWatchRegionMapper
 AWS_ROUTE53_API CloudWatchRegion GetCloudWatchRegionForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForCloudWatchRegion(CloudWatchRegion value);
+
+/**
+ * Same as GetNameForCloudWatchRegion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForCloudWatchRegionCStr(CloudWatchRegion value);
 } // namespace CloudWatchRegionMapper
 } // namespace Model
 } // namespace Route53
@@ -37,6 +37,11 @@ namespace ComparisonOperatorMapper
 AWS_ROUTE53_API ComparisonOperator GetComparisonOperatorForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForComparisonOperator(ComparisonOperator value);
+
+/**
+ * Same as GetNameForComparisonOperator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForComparisonOperatorCStr(ComparisonOperator value);
 } // namespace ComparisonOperatorMapper
 } // namespace Model
 } // namespace Route53
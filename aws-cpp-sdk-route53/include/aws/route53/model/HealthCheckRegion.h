@@ -41,6 +41,11 @@ namespace HealthCheckRegionMapper
 AWS_ROUTE53_API HealthCheckRegion GetHealthCheckRegionForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForHealthCheckRegion(HealthCheckRegion value);
+
+/**
+ * Same as GetNameForHealthCheckRegion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForHealthCheckRegionCStr(HealthCheckRegion value);
 } // namespace HealthCheckRegionMapper
 } // namespace Model
 } // namespace Route53
@@ -40,6 +40,11 @@ namespace HealthCheckTypeMapper
 AWS_ROUTE53_API HealthCheckType GetHealthCheckTypeForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForHealthCheckType(HealthCheckType value);
+
+/**
+ * Same as GetNameForHealthCheckType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForHealthCheckTypeCStr(HealthCheckType value);
 } // namespace HealthCheckTypeMapper
 } // namespace Model
 } // namespace Route53
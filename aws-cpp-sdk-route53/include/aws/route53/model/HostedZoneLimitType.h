@@ -35,6 +35,11 @@ namespace HostedZoneLimitTypeMapper
 AWS_ROUTE53_API HostedZoneLimitType GetHostedZoneLimitTypeForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForHostedZoneLimitType(HostedZoneLimitType value);
+
+/**
+ * Same as GetNameForHostedZoneLimitType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForHostedZoneLimitTypeCStr(HostedZoneLimitType value);
 } // namespace HostedZoneLimitTypeMapper
 } // namespace Model
 } // namespace Route53
@@ -36,6 +36,11 @@ namespace InsufficientDataHealthStatusMapper
 AWS_ROUTE53_API InsufficientDataHealthStatus GetInsufficientDataHealthStatusForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForInsufficientDataHealthStatus(InsufficientDataHealthStatus value);
+
+/**
+ * Same as GetNameForInsufficientDataHealthStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForInsufficientDataHealthStatusCStr(InsufficientDataHealthStatus value);
 } // namespace InsufficientDataHealthStatusMapper
 } // namespace Model
 } // namespace Route53
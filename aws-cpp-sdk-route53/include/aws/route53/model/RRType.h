@@ -45,6 +45,11 @@ namespace RRTypeMapper
 AWS_ROUTE53_API RRType GetRRTypeForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForRRType(RRType value);
+
+/**
+ * Same as GetNameForRRType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForRRTypeCStr(RRType value);
 } // namespace RRTypeMapper
 } // namespace Model
 } // namespace Route53
@@ -37,6 +37,11 @@ namespace ResettableElementNameMapper
 AWS_ROUTE53_API ResettableElementName GetResettableElementNameForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForResettableElementName(ResettableElementName value);
+
+/**
+ * Same as GetNameForResettableElementName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForResettableElementNameCStr(ResettableElementName value);
 } // namespace ResettableElementNameMapper
 } // namespace Model
 } // namespace Route53
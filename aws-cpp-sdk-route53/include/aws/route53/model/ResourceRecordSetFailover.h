@@ -35,6 +35,11 @@ namespace ResourceRecordSetFailoverMapper
 AWS_ROUTE53_API ResourceRecordSetFailover GetResourceRecordSetFailoverForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForResourceRecordSetFailover(ResourceRecordSetFailover value);
+
+/**
+ * Same as GetNameForResourceRecordSetFailover(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForResourceRecordSetFailoverCStr(ResourceRecordSetFailover value);
 } // namespace ResourceRecordSetFailoverMapper
 } // namespace Model
 } // namespace Route53
@@ -52,6 +52,11 @@ namespace ResourceRecordSetRegionMapper
 AWS_ROUTE53_API ResourceRecordSetRegion GetResourceRecordSetRegionForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForResourceRecordSetRegion(ResourceRecordSetRegion value);
+
+/**
+ * Same as GetNameForResourceRecordSetRegion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForResourceRecordSetRegionCStr(ResourceRecordSetRegion value);
 } // namespace ResourceRecordSetRegionMapper
 } // namespace Model
 } // namespace Route53
@@ -34,6 +34,11 @@ namespace ReusableDelegationSetLimitTypeMapper
 AWS_ROUTE53_API ReusableDelegationSetLimitType GetReusableDelegationSetLimitTypeForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForReusableDelegationSetLimitType(ReusableDelegationSetLimitType value);
+
+/**
+ * Same as GetNameForReusableDelegationSetLimitType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForReusableDelegationSetLimitTypeCStr(ReusableDelegationSetLimitType value);
 } // namespace ReusableDelegationSetLimitTypeMapper
 } // namespace Model
 } // namespace Route53
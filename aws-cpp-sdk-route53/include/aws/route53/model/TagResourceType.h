@@ -35,6 +35,11 @@ namespace TagResourceTypeMapper
 AWS_ROUTE53_API TagResourceType GetTagResourceTypeForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForTagResourceType(TagResourceType value);
+
+/**
+ * Same as GetNameForTagResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForTagResourceTypeCStr(TagResourceType value);
 } // namespace TagResourceTypeMapper
 } // namespace Model
 } // namespace Route53
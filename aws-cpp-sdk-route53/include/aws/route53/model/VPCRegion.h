@@ -51,6 +51,11 @@ namespace VPCRegionMapper
 AWS_ROUTE53_API VPCRegion GetVPCRegionForName(const Aws::String& name);
 
 AWS_ROUTE53_API Aws::String GetNameForVPCRegion(VPCRegion value);
+
+/**
+ * Same as GetNameForVPCRegion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53_API const char* GetNameForVPCRegionCStr(VPCRegion value);
 } // namespace VPCRegionMapper
 } // namespace Model
 } // namespace Route53
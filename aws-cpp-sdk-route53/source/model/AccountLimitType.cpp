@@ -30,35 +30,58 @@ namespace Aws
       namespace AccountLimitTypeMapper
       {
 
-        static const int MAX_HEALTH_CHECKS_BY_OWNER_HASH = HashingUtils::HashString("MAX_HEALTH_CHECKS_BY_OWNER");
-        static const int MAX_HOSTED_ZONES_BY_OWNER_HASH = HashingUtils::HashString("MAX_HOSTED_ZONES_BY_OWNER");
-        static const int MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER_HASH = HashingUtils::HashString("MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER");
-        static const int MAX_REUSABLE_DELEGATION_SETS_BY_OWNER_HASH = HashingUtils::HashString("MAX_REUSABLE_DELEGATION_SETS_BY_OWNER");
-        static const int MAX_TRAFFIC_POLICIES_BY_OWNER_HASH = HashingUtils::HashString("MAX_TRAFFIC_POLICIES_BY_OWNER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MAX_HEALTH_CHECKS_BY_OWNER",
+          "MAX_HOSTED_ZONES_BY_OWNER",
+          "MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER",
+          "MAX_REUSABLE_DELEGATION_SETS_BY_OWNER",
+          "MAX_TRAFFIC_POLICIES_BY_OWNER",
+        };
 
         AccountLimitType GetAccountLimitTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAX_HEALTH_CHECKS_BY_OWNER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccountLimitType::MAX_HEALTH_CHECKS_BY_OWNER;
-          }
-          else if (hashCode == MAX_HOSTED_ZONES_BY_OWNER_HASH)
-          {
-            return AccountLimitType::MAX_HOSTED_ZONES_BY_OWNER;
-          }
-          else if (hashCode == MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER_HASH)
-          {
-            return AccountLimitType::MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER;
-          }
-          else if (hashCode == MAX_REUSABLE_DELEGATION_SETS_BY_OWNER_HASH)
-          {
-            return AccountLimitType::MAX_REUSABLE_DELEGATION_SETS_BY_OWNER;
-          }
-          else if (hashCode == MAX_TRAFFIC_POLICIES_BY_OWNER_HASH)
-          {
-            return AccountLimitType::MAX_TRAFFIC_POLICIES_BY_OWNER;
+          case 1214508919:
+            if (name == "MAX_HEALTH_CHECKS_BY_OWNER")
+            {
+              return AccountLimitType::MAX_HEALTH_CHECKS_BY_OWNER;
+            }
+            break;
+          case -390625792:
+            if (name == "MAX_HOSTED_ZONES_BY_OWNER")
+            {
+              return AccountLimitType::MAX_HOSTED_ZONES_BY_OWNER;
+            }
+            break;
+          case -1734853252:
+            if (name == "MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER")
+            {
+              return AccountLimitType::MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER;
+            }
+            break;
+          case 547033755:
+            if (name == "MAX_REUSABLE_DELEGATION_SETS_BY_OWNER")
+            {
+              return AccountLimitType::MAX_REUSABLE_DELEGATION_SETS_BY_OWNER;
+            }
+            break;
+          case -1546567267:
+            if (name == "MAX_TRAFFIC_POLICIES_BY_OWNER")
+            {
+              return AccountLimitType::MAX_TRAFFIC_POLICIES_BY_OWNER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return AccountLimitType::NOT_SET;
         }
 
-        Aws::String GetNameForAccountLimitType(AccountLimitType enumValue)
+        const char* GetNameForAccountLimitTypeCStr(AccountLimitType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccountLimitType::MAX_HEALTH_CHECKS_BY_OWNER:
-            return "MAX_HEALTH_CHECKS_BY_OWNER";
-          case AccountLimitType::MAX_HOSTED_ZONES_BY_OWNER:
-            return "MAX_HOSTED_ZONES_BY_OWNER";
-          case AccountLimitType::MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER:
-            return "MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER";
-          case AccountLimitType::MAX_REUSABLE_DELEGATION_SETS_BY_OWNER:
-            return "MAX_REUSABLE_DELEGATION_SETS_BY_OWNER";
-          case AccountLimitType::MAX_TRAFFIC_POLICIES_BY_OWNER:
-            return "MAX_TRAFFIC_POLICIES_BY_OWNER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccountLimitType(AccountLimitType enumValue)
+        {
+          return GetNameForAccountLimitTypeCStr(enumValue);
         }
 
       } // namespace AccountLimitTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ChangeActionMapper
       {
 
-        static const int CREATE_HASH = HashingUtils::HashString("CREATE");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
-        static const int UPSERT_HASH = HashingUtils::HashString("UPSERT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE",
+          "DELETE",
+          "UPSERT",
+        };
 
         ChangeAction GetChangeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_HASH)
-          {
-            return ChangeAction::CREATE;
-          }
-          else if (hashCode == DELETE__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeAction::DELETE_;
-          }
-          else if (hashCode == UPSERT_HASH)
-          {
-            return ChangeAction::UPSERT;
+          case 1996002556:
+            if (name == "CREATE")
+            {
+              return ChangeAction::CREATE;
+            }
+            break;
+          case 2012838315:
+            if (name == "DELETE")
+            {
+              return ChangeAction::DELETE_;
+            }
+            break;
+          case -1785066193:
+            if (name == "UPSERT")
+            {
+              return ChangeAction::UPSERT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ChangeAction::NOT_SET;
         }
 
-        Aws::String GetNameForChangeAction(ChangeAction enumValue)
+        const char* GetNameForChangeActionCStr(ChangeAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeAction::CREATE:
-            return "CREATE";
-          case ChangeAction::DELETE_:
-            return "DELETE";
-          case ChangeAction::UPSERT:
-            return "UPSERT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeAction(ChangeAction enumValue)
+        {
+          return GetNameForChangeActionCStr(enumValue);
         }
 
       } // namespace ChangeActionMapper
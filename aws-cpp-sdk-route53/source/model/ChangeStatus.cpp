@@ -30,20 +30,37 @@ namespace Aws
       namespace ChangeStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int INSYNC_HASH = HashingUtils::HashString("INSYNC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "INSYNC",
+        };
 
         ChangeStatus GetChangeStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return ChangeStatus::PENDING;
-          }
-          else if (hashCode == INSYNC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeStatus::INSYNC;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ChangeStatus::PENDING;
+            }
+            break;
+          case -2130443968:
+            if (name == "INSYNC")
+            {
+              return ChangeStatus::INSYNC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ChangeStatus::NOT_SET;
         }
 
-        Aws::String GetNameForChangeStatus(ChangeStatus enumValue)
+        const char* GetNameForChangeStatusCStr(ChangeStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeStatus::PENDING:
-            return "PENDING";
-          case ChangeStatus::INSYNC:
-            return "INSYNC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeStatus(ChangeStatus enumValue)
+        {
+          return GetNameForChangeStatusCStr(enumValue);
         }
 
       } // namespace ChangeStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int GreaterThanOrEqualToThreshold_HASH = HashingUtils::HashString("GreaterThanOrEqualToThreshold");
-        static const int GreaterThanThreshold_HASH = HashingUtils::HashString("GreaterThanThreshold");
-        static const int LessThanThreshold_HASH = HashingUtils::HashString("LessThanThreshold");
-        static const int LessThanOrEqualToThreshold_HASH = HashingUtils::HashString("LessThanOrEqualToThreshold");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GreaterThanOrEqualToThreshold",
+          "GreaterThanThreshold",
+          "LessThanThreshold",
+          "LessThanOrEqualToThreshold",
+        };
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GreaterThanOrEqualToThreshold_HASH)
-          {
-            return ComparisonOperator::GreaterThanOrEqualToThreshold;
-          }
-          else if (hashCode == GreaterThanThreshold_HASH)
-          {
-            return ComparisonOperator::GreaterThanThreshold;
-          }
-          else if (hashCode == LessThanThreshold_HASH)
-          {
-            return ComparisonOperator::LessThanThreshold;
-          }
-          else if (hashCode == LessThanOrEqualToThreshold_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComparisonOperator::LessThanOrEqualToThreshold;
+          case -1967855526:
+            if (name == "GreaterThanOrEqualToThreshold")
+            {
+              return ComparisonOperator::GreaterThanOrEqualToThreshold;
+            }
+            break;
+          case 281950736:
+            if (name == "GreaterThanThreshold")
+            {
+              return ComparisonOperator::GreaterThanThreshold;
+            }
+            break;
+          case -1512019311:
+            if (name == "LessThanThreshold")
+            {
+              return ComparisonOperator::LessThanThreshold;
+            }
+            break;
+          case 1746581753:
+            if (name == "LessThanOrEqualToThreshold")
+            {
+              return ComparisonOperator::LessThanOrEqualToThreshold;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperatorCStr(ComparisonOperator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComparisonOperator::GreaterThanOrEqualToThreshold:
-            return "GreaterThanOrEqualToThreshold";
-          case ComparisonOperator::GreaterThanThreshold:
-            return "GreaterThanThreshold";
-          case ComparisonOperator::LessThanThreshold:
-            return "LessThanThreshold";
-          case ComparisonOperator::LessThanOrEqualToThreshold:
-            return "LessThanOrEqualToThreshold";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        {
+          return GetNameForComparisonOperatorCStr(enumValue);
         }
 
       } // namespace ComparisonOperatorMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace HealthCheckRegionMapper
       {
 
-        static const int us_east_1_HASH = HashingUtils::HashString("us-east-1");
-        static const int us_west_1_HASH = HashingUtils::HashString("us-west-1");
-        static const int us_west_2_HASH = HashingUtils::HashString("us-west-2");
-        static const int eu_west_1_HASH = HashingUtils::HashString("eu-west-1");
-        static const int ap_southeast_1_HASH = HashingUtils::HashString("ap-southeast-1");
-        static const int ap_southeast_2_HASH = HashingUtils::HashString("ap-southeast-2");
-        static const int ap_northeast_1_HASH = HashingUtils::HashString("ap-northeast-1");
-        static const int sa_east_1_HASH = HashingUtils::HashString("sa-east-1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "us-east-1",
+          "us-west-1",
+          "us-west-2",
+          "eu-west-1",
+          "ap-southeast-1",
+          "ap-southeast-2",
+          "ap-northeast-1",
+          "sa-east-1",
+        };
 
         HealthCheckRegion GetHealthCheckRegionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == us_east_1_HASH)
-          {
-            return HealthCheckRegion::us_east_1;
-          }
-          else if (hashCode == us_west_1_HASH)
-          {
-            return HealthCheckRegion::us_west_1;
-          }
-          else if (hashCode == us_west_2_HASH)
-          {
-            return HealthCheckRegion::us_west_2;
-          }
-          else if (hashCode == eu_west_1_HASH)
-          {
-            return HealthCheckRegion::eu_west_1;
-          }
-          else if (hashCode == ap_southeast_1_HASH)
-          {
-            return HealthCheckRegion::ap_southeast_1;
-          }
-          else if (hashCode == ap_southeast_2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HealthCheckRegion::ap_southeast_2;
-          }
-          else if (hashCode == ap_northeast_1_HASH)
-          {
-            return HealthCheckRegion::ap_northeast_1;
-          }
-          else if (hashCode == sa_east_1_HASH)
-          {
-            return HealthCheckRegion::sa_east_1;
+          case 1808575600:
+            if (name == "us-east-1")
+            {
+              return HealthCheckRegion::us_east_1;
+            }
+            break;
+          case -1967372894:
+            if (name == "us-west-1")
+            {
+              return HealthCheckRegion::us_west_1;
+            }
+            break;
+          case -1967372893:
+            if (name == "us-west-2")
+            {
+              return HealthCheckRegion::us_west_2;
+            }
+            break;
+          case 372748112:
+            if (name == "eu-west-1")
+            {
+              return HealthCheckRegion::eu_west_1;
+            }
+            break;
+          case 468199888:
+            if (name == "ap-southeast-1")
+            {
+              return HealthCheckRegion::ap_southeast_1;
+            }
+            break;
+          case 468199889:
+            if (name == "ap-southeast-2")
+            {
+              return HealthCheckRegion::ap_southeast_2;
+            }
+            break;
+          case 1990418184:
+            if (name == "ap-northeast-1")
+            {
+              return HealthCheckRegion::ap_northeast_1;
+            }
+            break;
+          case -177297728:
+            if (name == "sa-east-1")
+            {
+              return HealthCheckRegion::sa_east_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return HealthCheckRegion::NOT_SET;
         }
 
-        Aws::String GetNameForHealthCheckRegion(HealthCheckRegion enumValue)
+        const char* GetNameForHealthCheckRegionCStr(HealthCheckRegion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HealthCheckRegion::us_east_1:
-            return "us-east-1";
-          case HealthCheckRegion::us_west_1:
-            return "us-west-1";
-          case HealthCheckRegion::us_west_2:
-            return "us-west-2";
-          case HealthCheckRegion::eu_west_1:
-            return "eu-west-1";
-          case HealthCheckRegion::ap_southeast_1:
-            return "ap-southeast-1";
-          case HealthCheckRegion::ap_southeast_2:
-            return "ap-southeast-2";
-          case HealthCheckRegion::ap_northeast_1:
-            return "ap-northeast-1";
-          case HealthCheckRegion::sa_east_1:
-            return "sa-east-1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHealthCheckRegion(HealthCheckRegion enumValue)
+        {
+          return GetNameForHealthCheckRegionCStr(enumValue);
         }
 
       } // namespace HealthCheckRegionMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace HealthCheckTypeMapper
       {
 
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-        static const int HTTPS_HASH = HashingUtils::HashString("HTTPS");
-        static const int HTTP_STR_MATCH_HASH = HashingUtils::HashString("HTTP_STR_MATCH");
-        static const int HTTPS_STR_MATCH_HASH = HashingUtils::HashString("HTTPS_STR_MATCH");
-        static const int TCP_HASH = HashingUtils::HashString("TCP");
-        static const int CALCULATED_HASH = HashingUtils::HashString("CALCULATED");
-        static const int CLOUDWATCH_METRIC_HASH = HashingUtils::HashString("CLOUDWATCH_METRIC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HTTP",
+          "HTTPS",
+          "HTTP_STR_MATCH",
+          "HTTPS_STR_MATCH",
+          "TCP",
+          "CALCULATED",
+          "CLOUDWATCH_METRIC",
+        };
 
         HealthCheckType GetHealthCheckTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_HASH)
-          {
-            return HealthCheckType::HTTP;
-          }
-          else if (hashCode == HTTPS_HASH)
-          {
-            return HealthCheckType::HTTPS;
-          }
-          else if (hashCode == HTTP_STR_MATCH_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HealthCheckType::HTTP_STR_MATCH;
-          }
-          else if (hashCode == HTTPS_STR_MATCH_HASH)
-          {
-            return HealthCheckType::HTTPS_STR_MATCH;
-          }
-          else if (hashCode == TCP_HASH)
-          {
-            return HealthCheckType::TCP;
-          }
-          else if (hashCode == CALCULATED_HASH)
-          {
-            return HealthCheckType::CALCULATED;
-          }
-          else if (hashCode == CLOUDWATCH_METRIC_HASH)
-          {
-            return HealthCheckType::CLOUDWATCH_METRIC;
+          case 2228360:
+            if (name == "HTTP")
+            {
+              return HealthCheckType::HTTP;
+            }
+            break;
+          case 69079243:
+            if (name == "HTTPS")
+            {
+              return HealthCheckType::HTTPS;
+            }
+            break;
+          case 1051453184:
+            if (name == "HTTP_STR_MATCH")
+            {
+              return HealthCheckType::HTTP_STR_MATCH;
+            }
+            break;
+          case -1162952829:
+            if (name == "HTTPS_STR_MATCH")
+            {
+              return HealthCheckType::HTTPS_STR_MATCH;
+            }
+            break;
+          case 82881:
+            if (name == "TCP")
+            {
+              return HealthCheckType::TCP;
+            }
+            break;
+          case -653437506:
+            if (name == "CALCULATED")
+            {
+              return HealthCheckType::CALCULATED;
+            }
+            break;
+          case -377834027:
+            if (name == "CLOUDWATCH_METRIC")
+            {
+              return HealthCheckType::CLOUDWATCH_METRIC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return HealthCheckType::NOT_SET;
         }
 
-        Aws::String GetNameForHealthCheckType(HealthCheckType enumValue)
+        const char* GetNameForHealthCheckTypeCStr(HealthCheckType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HealthCheckType::HTTP:
-            return "HTTP";
-          case HealthCheckType::HTTPS:
-            return "HTTPS";
-          case HealthCheckType::HTTP_STR_MATCH:
-            return "HTTP_STR_MATCH";
-          case HealthCheckType::HTTPS_STR_MATCH:
-            return "HTTPS_STR_MATCH";
-          case HealthCheckType::TCP:
-            return "TCP";
-          case HealthCheckType::CALCULATED:
-            return "CALCULATED";
-          case HealthCheckType::CLOUDWATCH_METRIC:
-            return "CLOUDWATCH_METRIC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHealthCheckType(HealthCheckType enumValue)
+        {
+          return GetNameForHealthCheckTypeCStr(enumValue);
         }
 
       } // namespace HealthCheckTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace HostedZoneLimitTypeMapper
       {
 
-        static const int MAX_RRSETS_BY_ZONE_HASH = HashingUtils::HashString("MAX_RRSETS_BY_ZONE");
-        static const int MAX_VPCS_ASSOCIATED_BY_ZONE_HASH = HashingUtils::HashString("MAX_VPCS_ASSOCIATED_BY_ZONE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MAX_RRSETS_BY_ZONE",
+          "MAX_VPCS_ASSOCIATED_BY_ZONE",
+        };
 
         HostedZoneLimitType GetHostedZoneLimitTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAX_RRSETS_BY_ZONE_HASH)
-          {
-            return HostedZoneLimitType::MAX_RRSETS_BY_ZONE;
-          }
-          else if (hashCode == MAX_VPCS_ASSOCIATED_BY_ZONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HostedZoneLimitType::MAX_VPCS_ASSOCIATED_BY_ZONE;
+          case -464865471:
+            if (name == "MAX_RRSETS_BY_ZONE")
+            {
+              return HostedZoneLimitType::MAX_RRSETS_BY_ZONE;
+            }
+            break;
+          case 1019339797:
+            if (name == "MAX_VPCS_ASSOCIATED_BY_ZONE")
+            {
+              return HostedZoneLimitType::MAX_VPCS_ASSOCIATED_BY_ZONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HostedZoneLimitType::NOT_SET;
         }
 
-        Aws::String GetNameForHostedZoneLimitType(HostedZoneLimitType enumValue)
+        const char* GetNameForHostedZoneLimitTypeCStr(HostedZoneLimitType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HostedZoneLimitType::MAX_RRSETS_BY_ZONE:
-            return "MAX_RRSETS_BY_ZONE";
-          case HostedZoneLimitType::MAX_VPCS_ASSOCIATED_BY_ZONE:
-            return "MAX_VPCS_ASSOCIATED_BY_ZONE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHostedZoneLimitType(HostedZoneLimitType enumValue)
+        {
+          return GetNameForHostedZoneLimitTypeCStr(enumValue);
         }
 
       } // namespace HostedZoneLimitTypeMapper
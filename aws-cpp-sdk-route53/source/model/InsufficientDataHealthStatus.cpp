@@ -30,25 +30,44 @@ namespace Aws
       namespace InsufficientDataHealthStatusMapper
       {
 
-        static const int Healthy_HASH = HashingUtils::HashString("Healthy");
-        static const int Unhealthy_HASH = HashingUtils::HashString("Unhealthy");
-        static const int LastKnownStatus_HASH = HashingUtils::HashString("LastKnownStatus");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Healthy",
+          "Unhealthy",
+          "LastKnownStatus",
+        };
 
         InsufficientDataHealthStatus GetInsufficientDataHealthStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Healthy_HASH)
-          {
-            return InsufficientDataHealthStatus::Healthy;
-          }
-          else if (hashCode == Unhealthy_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InsufficientDataHealthStatus::Unhealthy;
-          }
-          else if (hashCode == LastKnownStatus_HASH)
-          {
-            return InsufficientDataHealthStatus::LastKnownStatus;
+          case -1834753667:
+            if (name == "Healthy")
+            {
+              return InsufficientDataHealthStatus::Healthy;
+            }
+            break;
+          case 216362180:
+            if (name == "Unhealthy")
+            {
+              return InsufficientDataHealthStatus::Unhealthy;
+            }
+            break;
+          case 1552872575:
+            if (name == "LastKnownStatus")
+            {
+              return InsufficientDataHealthStatus::LastKnownStatus;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InsufficientDataHealthStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInsufficientDataHealthStatus(InsufficientDataHealthStatus enumValue)
+        const char* GetNameForInsufficientDataHealthStatusCStr(InsufficientDataHealthStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InsufficientDataHealthStatus::Healthy:
-            return "Healthy";
-          case InsufficientDataHealthStatus::Unhealthy:
-            return "Unhealthy";
-          case InsufficientDataHealthStatus::LastKnownStatus:
-            return "LastKnownStatus";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInsufficientDataHealthStatus(InsufficientDataHealthStatus enumValue)
+        {
+          return GetNameForInsufficientDataHealthStatusCStr(enumValue);
         }
 
       } // namespace InsufficientDataHealthStatusMapper
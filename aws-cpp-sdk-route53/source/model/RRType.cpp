@@ -30,70 +30,107 @@ namespace Aws
       namespace RRTypeMapper
       {
 
-        static const int SOA_HASH = HashingUtils::HashString("SOA");
-        static const int A_HASH = HashingUtils::HashString("A");
-        static const int TXT_HASH = HashingUtils::HashString("TXT");
-        static const int NS_HASH = HashingUtils::HashString("NS");
-        static const int CNAME_HASH = HashingUtils::HashString("CNAME");
-        static const int MX_HASH = HashingUtils::HashString("MX");
-        static const int NAPTR_HASH = HashingUtils::HashString("NAPTR");
-        static const int PTR_HASH = HashingUtils::HashString("PTR");
-        static const int SRV_HASH = HashingUtils::HashString("SRV");
-        static const int SPF_HASH = HashingUtils::HashString("SPF");
-        static const int AAAA_HASH = HashingUtils::HashString("AAAA");
-        static const int CAA_HASH = HashingUtils::HashString("CAA");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SOA",
+          "A",
+          "TXT",
+          "NS",
+          "CNAME",
+          "MX",
+          "NAPTR",
+          "PTR",
+          "SRV",
+          "SPF",
+          "AAAA",
+          "CAA",
+        };
 
         RRType GetRRTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SOA_HASH)
-          {
-            return RRType::SOA;
-          }
-          else if (hashCode == A_HASH)
-          {
-            return RRType::A;
-          }
-          else if (hashCode == TXT_HASH)
-          {
-            return RRType::TXT;
-          }
-          else if (hashCode == NS_HASH)
-          {
-            return RRType::NS;
-          }
-          else if (hashCode == CNAME_HASH)
-          {
-            return RRType::CNAME;
-          }
-          else if (hashCode == MX_HASH)
-          {
-            return RRType::MX;
-          }
-          else if (hashCode == NAPTR_HASH)
-          {
-            return RRType::NAPTR;
-          }
-          else if (hashCode == PTR_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RRType::PTR;
-          }
-          else if (hashCode == SRV_HASH)
-          {
-            return RRType::SRV;
-          }
-          else if (hashCode == SPF_HASH)
-          {
-            return RRType::SPF;
-          }
-          else if (hashCode == AAAA_HASH)
-          {
-            return RRType::AAAA;
-          }
-          else if (hashCode == CAA_HASH)
-          {
-            return RRType::CAA;
+          case 82277:
+            if (name == "SOA")
+            {
+              return RRType::SOA;
+            }
+            break;
+          case 65:
+            if (name == "A")
+            {
+              return RRType::A;
+            }
+            break;
+          case 83536:
+            if (name == "TXT")
+            {
+              return RRType::TXT;
+            }
+            break;
+          case 2501:
+            if (name == "NS")
+            {
+              return RRType::NS;
+            }
+            break;
+          case 64264526:
+            if (name == "CNAME")
+            {
+              return RRType::CNAME;
+            }
+            break;
+          case 2475:
+            if (name == "MX")
+            {
+              return RRType::MX;
+            }
+            break;
+          case 74050619:
+            if (name == "NAPTR")
+            {
+              return RRType::NAPTR;
+            }
+            break;
+          case 79566:
+            if (name == "PTR")
+            {
+              return RRType::PTR;
+            }
+            break;
+          case 82391:
+            if (name == "SRV")
+            {
+              return RRType::SRV;
+            }
+            break;
+          case 82313:
+            if (name == "SPF")
+            {
+              return RRType::SPF;
+            }
+            break;
+          case 2000960:
+            if (name == "AAAA")
+            {
+              return RRType::AAAA;
+            }
+            break;
+          case 66467:
+            if (name == "CAA")
+            {
+              return RRType::CAA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return RRType::NOT_SET;
         }
 
-        Aws::String GetNameForRRType(RRType enumValue)
+        const char* GetNameForRRTypeCStr(RRType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RRType::SOA:
-            return "SOA";
-          case RRType::A:
-            return "A";
-          case RRType::TXT:
-            return "TXT";
-          case RRType::NS:
-            return "NS";
-          case RRType::CNAME:
-            return "CNAME";
-          case RRType::MX:
-            return "MX";
-          case RRType::NAPTR:
-            return "NAPTR";
-          case RRType::PTR:
-            return "PTR";
-          case RRType::SRV:
-            return "SRV";
-          case RRType::SPF:
-            return "SPF";
-          case RRType::AAAA:
-            return "AAAA";
-          case RRType::CAA:
-            return "CAA";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRRType(RRType enumValue)
+        {
+          return GetNameForRRTypeCStr(enumValue);
         }
 
       } // namespace RRTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ResettableElementNameMapper
       {
 
-        static const int FullyQualifiedDomainName_HASH = HashingUtils::HashString("FullyQualifiedDomainName");
-        static const int Regions_HASH = HashingUtils::HashString("Regions");
-        static const int ResourcePath_HASH = HashingUtils::HashString("ResourcePath");
-        static const int ChildHealthChecks_HASH = HashingUtils::HashString("ChildHealthChecks");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FullyQualifiedDomainName",
+          "Regions",
+          "ResourcePath",
+          "ChildHealthChecks",
+        };
 
         ResettableElementName GetResettableElementNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FullyQualifiedDomainName_HASH)
-          {
-            return ResettableElementName::FullyQualifiedDomainName;
-          }
-          else if (hashCode == Regions_HASH)
-          {
-            return ResettableElementName::Regions;
-          }
-          else if (hashCode == ResourcePath_HASH)
-          {
-            return ResettableElementName::ResourcePath;
-          }
-          else if (hashCode == ChildHealthChecks_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResettableElementName::ChildHealthChecks;
+          case 221642529:
+            if (name == "FullyQualifiedDomainName")
+            {
+              return ResettableElementName::FullyQualifiedDomainName;
+            }
+            break;
+          case -1544204321:
+            if (name == "Regions")
+            {
+              return ResettableElementName::Regions;
+            }
+            break;
+          case -220186253:
+            if (name == "ResourcePath")
+            {
+              return ResettableElementName::ResourcePath;
+            }
+            break;
+          case 472331523:
+            if (name == "ChildHealthChecks")
+            {
+              return ResettableElementName::ChildHealthChecks;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ResettableElementName::NOT_SET;
         }
 
-        Aws::String GetNameForResettableElementName(ResettableElementName enumValue)
+        const char* GetNameForResettableElementNameCStr(ResettableElementName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResettableElementName::FullyQualifiedDomainName:
-            return "FullyQualifiedDomainName";
-          case ResettableElementName::Regions:
-            return "Regions";
-          case ResettableElementName::ResourcePath:
-            return "ResourcePath";
-          case ResettableElementName::ChildHealthChecks:
-            return "ChildHealthChecks";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResettableElementName(ResettableElementName enumValue)
+        {
+          return GetNameForResettableElementNameCStr(enumValue);
         }
 
       } // namespace ResettableElementNameMapper
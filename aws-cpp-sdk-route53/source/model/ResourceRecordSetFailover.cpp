@@ -30,20 +30,37 @@ namespace Aws
       namespace ResourceRecordSetFailoverMapper
       {
 
-        static const int PRIMARY_HASH = HashingUtils::HashString("PRIMARY");
-        static const int SECONDARY_HASH = HashingUtils::HashString("SECONDARY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PRIMARY",
+          "SECONDARY",
+        };
 
         ResourceRecordSetFailover GetResourceRecordSetFailoverForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRIMARY_HASH)
-          {
-            return ResourceRecordSetFailover::PRIMARY;
-          }
-          else if (hashCode == SECONDARY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceRecordSetFailover::SECONDARY;
+          case 403216866:
+            if (name == "PRIMARY")
+            {
+              return ResourceRecordSetFailover::PRIMARY;
+            }
+            break;
+          case 1968996692:
+            if (name == "SECONDARY")
+            {
+              return ResourceRecordSetFailover::SECONDARY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ResourceRecordSetFailover::NOT_SET;
         }
 
-        Aws::String GetNameForResourceRecordSetFailover(ResourceRecordSetFailover enumValue)
+        const char* GetNameForResourceRecordSetFailoverCStr(ResourceRecordSetFailover enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceRecordSetFailover::PRIMARY:
-            return "PRIMARY";
-          case ResourceRecordSetFailover::SECONDARY:
-            return "SECONDARY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceRecordSetFailover(ResourceRecordSetFailover enumValue)
+        {
+          return GetNameForResourceRecordSetFailoverCStr(enumValue);
         }
 
       } // namespace ResourceRecordSetFailoverMapper
@@ -30,105 +30,156 @@ namespace Aws
       namespace ResourceRecordSetRegionMapper
       {
 
-        static const int us_east_1_HASH = HashingUtils::HashString("us-east-1");
-        static const int us_east_2_HASH = HashingUtils::HashString("us-east-2");
-        static const int us_west_1_HASH = HashingUtils::HashString("us-west-1");
-        static const int us_west_2_HASH = HashingUtils::HashString("us-west-2");
-        static const int ca_central_1_HASH = HashingUtils::HashString("ca-central-1");
-        static const int eu_west_1_HASH = HashingUtils::HashString("eu-west-1");
-        static const int eu_west_2_HASH = HashingUtils::HashString("eu-west-2");
-        static const int eu_west_3_HASH = HashingUtils::HashString("eu-west-3");
-        static const int eu_central_1_HASH = HashingUtils::HashString("eu-central-1");
-        static const int ap_southeast_1_HASH = HashingUtils::HashString("ap-southeast-1");
-        static const int ap_southeast_2_HASH = HashingUtils::HashString("ap-southeast-2");
-        static const int ap_northeast_1_HASH = HashingUtils::HashString("ap-northeast-1");
-        static const int ap_northeast_2_HASH = HashingUtils::HashString("ap-northeast-2");
-        static const int ap_northeast_3_HASH = HashingUtils::HashString("ap-northeast-3");
-        static const int eu_north_1_HASH = HashingUtils::HashString("eu-north-1");
-        static const int sa_east_1_HASH = HashingUtils::HashString("sa-east-1");
-        static const int cn_north_1_HASH = HashingUtils::HashString("cn-north-1");
-        static const int cn_northwest_1_HASH = HashingUtils::HashString("cn-northwest-1");
-        static const int ap_south_1_HASH = HashingUtils::HashString("ap-south-1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "us-east-1",
+          "us-east-2",
+          "us-west-1",
+          "us-west-2",
+          "ca-central-1",
+          "eu-west-1",
+          "eu-west-2",
+          "eu-west-3",
+          "eu-central-1",
+          "ap-southeast-1",
+          "ap-southeast-2",
+          "ap-northeast-1",
+          "ap-northeast-2",
+          "ap-northeast-3",
+          "eu-north-1",
+          "sa-east-1",
+          "cn-north-1",
+          "cn-northwest-1",
+          "ap-south-1",
+        };
 
         ResourceRecordSetRegion GetResourceRecordSetRegionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == us_east_1_HASH)
-          {
-            return ResourceRecordSetRegion::us_east_1;
-          }
-          else if (hashCode == us_east_2_HASH)
-          {
-            return ResourceRecordSetRegion::us_east_2;
-          }
-          else if (hashCode == us_west_1_HASH)
-          {
-            return ResourceRecordSetRegion::us_west_1;
-          }
-          else if (hashCode == us_west_2_HASH)
-          {
-            return ResourceRecordSetRegion::us_west_2;
-          }
-          else if (hashCode == ca_central_1_HASH)
-          {
-            return ResourceRecordSetRegion::ca_central_1;
-          }
-          else if (hashCode == eu_west_1_HASH)
-          {
-            return ResourceRecordSetRegion::eu_west_1;
-          }
-          else if (hashCode == eu_west_2_HASH)
-          {
-            return ResourceRecordSetRegion::eu_west_2;
-          }
-          else if (hashCode == eu_west_3_HASH)
-          {
-            return ResourceRecordSetRegion::eu_west_3;
-          }
-          else if (hashCode == eu_central_1_HASH)
-          {
-            return ResourceRecordSetRegion::eu_central_1;
-          }
-          else if (hashCode == ap_southeast_1_HASH)
-          {
-            return ResourceRecordSetRegion::ap_southeast_1;
-          }
-          else if (hashCode == ap_southeast_2_HASH)
-          {
-            return ResourceRecordSetRegion::ap_southeast_2;
-          }
-          else if (hashCode == ap_northeast_1_HASH)
-          {
-            return ResourceRecordSetRegion::ap_northeast_1;
-          }
-          else if (hashCode == ap_northeast_2_HASH)
-          {
-            return ResourceRecordSetRegion::ap_northeast_2;
-          }
-          else if (hashCode == ap_northeast_3_HASH)
-          {
-            return ResourceRecordSetRegion::ap_northeast_3;
-          }
-          else if (hashCode == eu_north_1_HASH)
-          {
-            return ResourceRecordSetRegion::eu_north_1;
-          }
-          else if (hashCode == sa_east_1_HASH)
-          {
-            return ResourceRecordSetRegion::sa_east_1;
-          }
-          else if (hashCode == cn_north_1_HASH)
-          {
-            return ResourceRecordSetRegion::cn_north_1;
-          }
-          else if (hashCode == cn_northwest_1_HASH)
-          {
-            return ResourceRecordSetRegion::cn_northwest_1;
-          }
-          else if (hashCode == ap_south_1_HASH)
-          {
-            return ResourceRecordSetRegion::ap_south_1;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 1808575600:
+            if (name == "us-east-1")
+            {
+              return ResourceRecordSetRegion::us_east_1;
+            }
+            break;
+          case 1808575601:
+            if (name == "us-east-2")
+            {
+              return ResourceRecordSetRegion::us_east_2;
+            }
+            break;
+          case -1967372894:
+            if (name == "us-west-1")
+            {
+              return ResourceRecordSetRegion::us_west_1;
+            }
+            break;
+          case -1967372893:
+            if (name == "us-west-2")
+            {
+              return ResourceRecordSetRegion::us_west_2;
+            }
+            break;
+          case 786758442:
+            if (name == "ca-central-1")
+            {
+              return ResourceRecordSetRegion::ca_central_1;
+            }
+            break;
+          case 372748112:
+            if (name == "eu-west-1")
+            {
+              return ResourceRecordSetRegion::eu_west_1;
+            }
+            break;
+          case 372748113:
+            if (name == "eu-west-2")
+            {
+              return ResourceRecordSetRegion::eu_west_2;
+            }
+            break;
+          case 372748114:
+            if (name == "eu-west-3")
+            {
+              return ResourceRecordSetRegion::eu_west_3;
+            }
+            break;
+          case -534364932:
+            if (name == "eu-central-1")
+            {
+              return ResourceRecordSetRegion::eu_central_1;
+            }
+            break;
+          case 468199888:
+            if (name == "ap-southeast-1")
+            {
+              return ResourceRecordSetRegion::ap_southeast_1;
+            }
+            break;
+          case 468199889:
+            if (name == "ap-southeast-2")
+            {
+              return ResourceRecordSetRegion::ap_southeast_2;
+            }
+            break;
+          case 1990418184:
+            if (name == "ap-northeast-1")
+            {
+              return ResourceRecordSetRegion::ap_northeast_1;
+            }
+            break;
+          case 1990418185:
+            if (name == "ap-northeast-2")
+            {
+              return ResourceRecordSetRegion::ap_northeast_2;
+            }
+            break;
+          case 1990418186:
+            if (name == "ap-northeast-3")
+            {
+              return ResourceRecordSetRegion::ap_northeast_3;
+            }
+            break;
+          case -441884340:
+            if (name == "eu-north-1")
+            {
+              return ResourceRecordSetRegion::eu_north_1;
+            }
+            break;
+          case -177297728:
+            if (name == "sa-east-1")
+            {
+              return ResourceRecordSetRegion::sa_east_1;
+            }
+            break;
+          case -281577977:
+            if (name == "cn-north-1")
+            {
+              return ResourceRecordSetRegion::cn_north_1;
+            }
+            break;
+          case 2085125750:
+            if (name == "cn-northwest-1")
+            {
+              return ResourceRecordSetRegion::cn_northwest_1;
+            }
+            break;
+          case 936829075:
+            if (name == "ap-south-1")
+            {
+              return ResourceRecordSetRegion::ap_south_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -140,57 +191,26 @@ namespace Aws
           return ResourceRecordSetRegion::NOT_SET;
         }
 
-        Aws::String GetNameForResourceRecordSetRegion(ResourceRecordSetRegion enumValue)
+        const char* GetNameForResourceRecordSetRegionCStr(ResourceRecordSetRegion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceRecordSetRegion::us_east_1:
-            return "us-east-1";
-          case ResourceRecordSetRegion::us_east_2:
-            return "us-east-2";
-          case ResourceRecordSetRegion::us_west_1:
-            return "us-west-1";
-          case ResourceRecordSetRegion::us_west_2:
-            return "us-west-2";
-          case ResourceRecordSetRegion::ca_central_1:
-            return "ca-central-1";
-          case ResourceRecordSetRegion::eu_west_1:
-            return "eu-west-1";
-          case ResourceRecordSetRegion::eu_west_2:
-            return "eu-west-2";
-          case ResourceRecordSetRegion::eu_west_3:
-            return "eu-west-3";
-          case ResourceRecordSetRegion::eu_central_1:
-            return "eu-central-1";
-          case ResourceRecordSetRegion::ap_southeast_1:
-            return "ap-southeast-1";
-          case ResourceRecordSetRegion::ap_southeast_2:
-            return "ap-southeast-2";
-          case ResourceRecordSetRegion::ap_northeast_1:
-            return "ap-northeast-1";
-          case ResourceRecordSetRegion::ap_northeast_2:
-            return "ap-northeast-2";
-          case ResourceRecordSetRegion::ap_northeast_3:
-            return "ap-northeast-3";
-          case ResourceRecordSetRegion::eu_north_1:
-            return "eu-north-1";
-          case ResourceRecordSetRegion::sa_east_1:
-            return "sa-east-1";
-          case ResourceRecordSetRegion::cn_north_1:
-            return "cn-north-1";
-          case ResourceRecordSetRegion::cn_northwest_1:
-            return "cn-northwest-1";
-          case ResourceRecordSetRegion::ap_south_1:
-            return "ap-south-1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceRecordSetRegion(ResourceRecordSetRegion enumValue)
+        {
+          return GetNameForResourceRecordSetRegionCStr(enumValue);
         }
 
       } // namespace ResourceRecordSetRegionMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ReusableDelegationSetLimitTypeMapper
       {
 
-        static const int MAX_ZONES_BY_REUSABLE_DELEGATION_SET_HASH = HashingUtils::HashString("MAX_ZONES_BY_REUSABLE_DELEGATION_SET");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MAX_ZONES_BY_REUSABLE_DELEGATION_SET",
+        };
 
         ReusableDelegationSetLimitType GetReusableDelegationSetLimitTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAX_ZONES_BY_REUSABLE_DELEGATION_SET_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReusableDelegationSetLimitType::MAX_ZONES_BY_REUSABLE_DELEGATION_SET;
+          case -593647798:
+            if (name == "MAX_ZONES_BY_REUSABLE_DELEGATION_SET")
+            {
+              return ReusableDelegationSetLimitType::MAX_ZONES_BY_REUSABLE_DELEGATION_SET;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ReusableDelegationSetLimitType::NOT_SET;
         }
 
-        Aws::String GetNameForReusableDelegationSetLimitType(ReusableDelegationSetLimitType enumValue)
+        const char* GetNameForReusableDelegationSetLimitTypeCStr(ReusableDelegationSetLimitType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReusableDelegationSetLimitType::MAX_ZONES_BY_REUSABLE_DELEGATION_SET:
-            return "MAX_ZONES_BY_REUSABLE_DELEGATION_SET";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReusableDelegationSetLimitType(ReusableDelegationSetLimitType enumValue)
+        {
+          return GetNameForReusableDelegationSetLimitTypeCStr(enumValue);
         }
 
       } // namespace ReusableDelegationSetLimitTypeMapper
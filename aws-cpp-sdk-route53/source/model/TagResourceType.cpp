@@ -30,20 +30,37 @@ namespace Aws
       namespace TagResourceTypeMapper
       {
 
-        static const int healthcheck_HASH = HashingUtils::HashString("healthcheck");
-        static const int hostedzone_HASH = HashingUtils::HashString("hostedzone");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "healthcheck",
+          "hostedzone",
+        };
 
         TagResourceType GetTagResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == healthcheck_HASH)
-          {
-            return TagResourceType::healthcheck;
-          }
-          else if (hashCode == hostedzone_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TagResourceType::hostedzone;
+          case -1908540372:
+            if (name == "healthcheck")
+            {
+              return TagResourceType::healthcheck;
+            }
+            break;
+          case -602939277:
+            if (name == "hostedzone")
+            {
+              return TagResourceType::hostedzone;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TagResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForTagResourceType(TagResourceType enumValue)
+        const char* GetNameForTagResourceTypeCStr(TagResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TagResourceType::healthcheck:
-            return "healthcheck";
-          case TagResourceType::hostedzone:
-            return "hostedzone";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTagResourceType(TagResourceType enumValue)
+        {
+          return GetNameForTagResourceTypeCStr(enumValue);
         }
 
       } // namespace TagResourceTypeMapper
@@ -38,6 +38,11 @@ namespace ContactTypeMapper
 AWS_ROUTE53DOMAINS_API ContactType GetContactTypeForName(const Aws::String& name);
 
 AWS_ROUTE53DOMAINS_API Aws::String GetNameForContactType(ContactType value);
+
+/**
+ * Same as GetNameForContactType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53DOMAINS_API const char* GetNameForContactTypeCStr(ContactType value);
 } // namespace ContactTypeMapper
 } // namespace Model
 } // namespace Route53Domains
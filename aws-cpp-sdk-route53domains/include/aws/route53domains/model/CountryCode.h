@@ -262,6 +262,11 @@ namespace CountryCodeMapper
 AWS_ROUTE53DOMAINS_API CountryCode GetCountryCodeForName(const Aws::String& name);
 
 AWS_ROUTE53DOMAINS_API Aws::String GetNameForCountryCode(CountryCode value);
+
+/**
+ * Same as GetNameForCountryCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53DOMAINS_API const char* GetNameForCountryCodeCStr(CountryCode value);
 } // namespace CountryCodeMapper
 } // namespace Model
 } // namespace Route53Domains
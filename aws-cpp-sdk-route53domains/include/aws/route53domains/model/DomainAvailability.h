@@ -41,6 +41,11 @@ namespace DomainAvailabilityMapper
 AWS_ROUTE53DOMAINS_API DomainAvailability GetDomainAvailabilityForName(const Aws::String& name);
 
 AWS_ROUTE53DOMAINS_API Aws::String GetNameForDomainAvailability(DomainAvailability value);
+
+/**
+ * Same as GetNameForDomainAvailability(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53DOMAINS_API const char* GetNameForDomainAvailabilityCStr(DomainAvailability value);
 } // namespace DomainAvailabilityMapper
 } // namespace Model
 } // namespace Route53Domains
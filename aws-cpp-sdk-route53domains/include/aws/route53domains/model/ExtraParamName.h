@@ -59,6 +59,11 @@ namespace ExtraParamNameMapper
 AWS_ROUTE53DOMAINS_API ExtraParamName GetExtraParamNameForName(const Aws::String& name);
 
 AWS_ROUTE53DOMAINS_API Aws::String GetNameForExtraParamName(ExtraParamName value);
+
+/**
+ * Same as GetNameForExtraParamName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53DOMAINS_API const char* GetNameForExtraParamNameCStr(ExtraParamName value);
 } // namespace ExtraParamNameMapper
 } // namespace Model
 } // namespace Route53Domains
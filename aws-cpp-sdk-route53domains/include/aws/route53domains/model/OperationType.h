@@ -49,6 +49,11 @@ namespace OperationTypeMapper
 AWS_ROUTE53DOMAINS_API OperationType GetOperationTypeForName(const Aws::String& name);
 
 AWS_ROUTE53DOMAINS_API Aws::String GetNameForOperationType(OperationType value);
+
+/**
+ * Same as GetNameForOperationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53DOMAINS_API const char* GetNameForOperationTypeCStr(OperationType value);
 } // namespace OperationTypeMapper
 } // namespace Model
 } // namespace Route53Domains
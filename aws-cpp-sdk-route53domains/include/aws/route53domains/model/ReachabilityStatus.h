@@ -36,6 +36,11 @@ namespace ReachabilityStatusMapper
 AWS_ROUTE53DOMAINS_API ReachabilityStatus GetReachabilityStatusForName(const Aws::String& name);
 
 AWS_ROUTE53DOMAINS_API Aws::String GetNameForReachabilityStatus(ReachabilityStatus value);
+
+/**
+ * Same as GetNameForReachabilityStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53DOMAINS_API const char* GetNameForReachabilityStatusCStr(ReachabilityStatus value);
 } // namespace ReachabilityStatusMapper
 } // namespace Model
 } // namespace Route53Domains
@@ -36,6 +36,11 @@ namespace TransferableMapper
 AWS_ROUTE53DOMAINS_API Transferable GetTransferableForName(const Aws::String& name);
 
 AWS_ROUTE53DOMAINS_API Aws::String GetNameForTransferable(Transferable value);
+
+/**
+ * Same as GetNameForTransferable(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53DOMAINS_API const char* GetNameForTransferableCStr(Transferable value);
 } // namespace TransferableMapper
 } // namespace Model
 } // namespace Route53Domains
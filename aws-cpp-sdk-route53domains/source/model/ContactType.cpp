@@ -30,35 +30,58 @@ namespace Aws
       namespace ContactTypeMapper
       {
 
-        static const int PERSON_HASH = HashingUtils::HashString("PERSON");
-        static const int COMPANY_HASH = HashingUtils::HashString("COMPANY");
-        static const int ASSOCIATION_HASH = HashingUtils::HashString("ASSOCIATION");
-        static const int PUBLIC_BODY_HASH = HashingUtils::HashString("PUBLIC_BODY");
-        static const int RESELLER_HASH = HashingUtils::HashString("RESELLER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PERSON",
+          "COMPANY",
+          "ASSOCIATION",
+          "PUBLIC_BODY",
+          "RESELLER",
+        };
 
         ContactType GetContactTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PERSON_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContactType::PERSON;
-          }
-          else if (hashCode == COMPANY_HASH)
-          {
-            return ContactType::COMPANY;
-          }
-          else if (hashCode == ASSOCIATION_HASH)
-          {
-            return ContactType::ASSOCIATION;
-          }
-          else if (hashCode == PUBLIC_BODY_HASH)
-          {
-            return ContactType::PUBLIC_BODY;
-          }
-          else if (hashCode == RESELLER_HASH)
-          {
-            return ContactType::RESELLER;
+          case -1938387115:
+            if (name == "PERSON")
+            {
+              return ContactType::PERSON;
+            }
+            break;
+          case 1668466781:
+            if (name == "COMPANY")
+            {
+              return ContactType::COMPANY;
+            }
+            break;
+          case 2065461345:
+            if (name == "ASSOCIATION")
+            {
+              return ContactType::ASSOCIATION;
+            }
+            break;
+          case 1101913528:
+            if (name == "PUBLIC_BODY")
+            {
+              return ContactType::PUBLIC_BODY;
+            }
+            break;
+          case 432053106:
+            if (name == "RESELLER")
+            {
+              return ContactType::RESELLER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ContactType::NOT_SET;
         }
 
-        Aws::String GetNameForContactType(ContactType enumValue)
+        const char* GetNameForContactTypeCStr(ContactType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContactType::PERSON:
-            return "PERSON";
-          case ContactType::COMPANY:
-            return "COMPANY";
-          case ContactType::ASSOCIATION:
-            return "ASSOCIATION";
-          case ContactType::PUBLIC_BODY:
-            return "PUBLIC_BODY";
-          case ContactType::RESELLER:
-            return "RESELLER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContactType(ContactType enumValue)
+        {
+          return GetNameForContactTypeCStr(enumValue);
         }
 
       } // namespace ContactTypeMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace DomainAvailabilityMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int AVAILABLE_RESERVED_HASH = HashingUtils::HashString("AVAILABLE_RESERVED");
-        static const int AVAILABLE_PREORDER_HASH = HashingUtils::HashString("AVAILABLE_PREORDER");
-        static const int UNAVAILABLE_HASH = HashingUtils::HashString("UNAVAILABLE");
-        static const int UNAVAILABLE_PREMIUM_HASH = HashingUtils::HashString("UNAVAILABLE_PREMIUM");
-        static const int UNAVAILABLE_RESTRICTED_HASH = HashingUtils::HashString("UNAVAILABLE_RESTRICTED");
-        static const int RESERVED_HASH = HashingUtils::HashString("RESERVED");
-        static const int DONT_KNOW_HASH = HashingUtils::HashString("DONT_KNOW");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AVAILABLE",
+          "AVAILABLE_RESERVED",
+          "AVAILABLE_PREORDER",
+          "UNAVAILABLE",
+          "UNAVAILABLE_PREMIUM",
+          "UNAVAILABLE_RESTRICTED",
+          "RESERVED",
+          "DONT_KNOW",
+        };
 
         DomainAvailability GetDomainAvailabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
-          {
-            return DomainAvailability::AVAILABLE;
-          }
-          else if (hashCode == AVAILABLE_RESERVED_HASH)
-          {
-            return DomainAvailability::AVAILABLE_RESERVED;
-          }
-          else if (hashCode == AVAILABLE_PREORDER_HASH)
-          {
-            return DomainAvailability::AVAILABLE_PREORDER;
-          }
-          else if (hashCode == UNAVAILABLE_HASH)
-          {
-            return DomainAvailability::UNAVAILABLE;
-          }
-          else if (hashCode == UNAVAILABLE_PREMIUM_HASH)
-          {
-            return DomainAvailability::UNAVAILABLE_PREMIUM;
-          }
-          else if (hashCode == UNAVAILABLE_RESTRICTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DomainAvailability::UNAVAILABLE_RESTRICTED;
-          }
-          else if (hashCode == RESERVED_HASH)
-          {
-            return DomainAvailability::RESERVED;
-          }
-          else if (hashCode == DONT_KNOW_HASH)
-          {
-            return DomainAvailability::DONT_KNOW;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return DomainAvailability::AVAILABLE;
+            }
+            break;
+          case -1418199042:
+            if (name == "AVAILABLE_RESERVED")
+            {
+              return DomainAvailability::AVAILABLE_RESERVED;
+            }
+            break;
+          case 1947170657:
+            if (name == "AVAILABLE_PREORDER")
+            {
+              return DomainAvailability::AVAILABLE_PREORDER;
+            }
+            break;
+          case 1487498288:
+            if (name == "UNAVAILABLE")
+            {
+              return DomainAvailability::UNAVAILABLE;
+            }
+            break;
+          case -273531608:
+            if (name == "UNAVAILABLE_PREMIUM")
+            {
+              return DomainAvailability::UNAVAILABLE_PREMIUM;
+            }
+            break;
+          case 1195335626:
+            if (name == "UNAVAILABLE_RESTRICTED")
+            {
+              return DomainAvailability::UNAVAILABLE_RESTRICTED;
+            }
+            break;
+          case 432241448:
+            if (name == "RESERVED")
+            {
+              return DomainAvailability::RESERVED;
+            }
+            break;
+          case 595949177:
+            if (name == "DONT_KNOW")
+            {
+              return DomainAvailability::DONT_KNOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return DomainAvailability::NOT_SET;
         }
 
-        Aws::String GetNameForDomainAvailability(DomainAvailability enumValue)
+        const char* GetNameForDomainAvailabilityCStr(DomainAvailability enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DomainAvailability::AVAILABLE:
-            return "AVAILABLE";
-          case DomainAvailability::AVAILABLE_RESERVED:
-            return "AVAILABLE_RESERVED";
-          case DomainAvailability::AVAILABLE_PREORDER:
-            return "AVAILABLE_PREORDER";
-          case DomainAvailability::UNAVAILABLE:
-            return "UNAVAILABLE";
-          case DomainAvailability::UNAVAILABLE_PREMIUM:
-            return "UNAVAILABLE_PREMIUM";
-          case DomainAvailability::UNAVAILABLE_RESTRICTED:
-            return "UNAVAILABLE_RESTRICTED";
-          case DomainAvailability::RESERVED:
-            return "RESERVED";
-          case DomainAvailability::DONT_KNOW:
-            return "DONT_KNOW";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDomainAvailability(DomainAvailability enumValue)
+        {
+          return GetNameForDomainAvailabilityCStr(enumValue);
         }
 
       } // namespace DomainAvailabilityMapper
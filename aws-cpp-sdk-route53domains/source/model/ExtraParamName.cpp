@@ -30,140 +30,205 @@ namespace Aws
       namespace ExtraParamNameMapper
       {
 
-        static const int DUNS_NUMBER_HASH = HashingUtils::HashString("DUNS_NUMBER");
-        static const int BRAND_NUMBER_HASH = HashingUtils::HashString("BRAND_NUMBER");
-        static const int BIRTH_DEPARTMENT_HASH = HashingUtils::HashString("BIRTH_DEPARTMENT");
-        static const int BIRTH_DATE_IN_YYYY_MM_DD_HASH = HashingUtils::HashString("BIRTH_DATE_IN_YYYY_MM_DD");
-        static const int BIRTH_COUNTRY_HASH = HashingUtils::HashString("BIRTH_COUNTRY");
-        static const int BIRTH_CITY_HASH = HashingUtils::HashString("BIRTH_CITY");
-        static const int DOCUMENT_NUMBER_HASH = HashingUtils::HashString("DOCUMENT_NUMBER");
-        static const int AU_ID_NUMBER_HASH = HashingUtils::HashString("AU_ID_NUMBER");
-        static const int AU_ID_TYPE_HASH = HashingUtils::HashString("AU_ID_TYPE");
-        static const int CA_LEGAL_TYPE_HASH = HashingUtils::HashString("CA_LEGAL_TYPE");
-        static const int CA_BUSINESS_ENTITY_TYPE_HASH = HashingUtils::HashString("CA_BUSINESS_ENTITY_TYPE");
-        static const int ES_IDENTIFICATION_HASH = HashingUtils::HashString("ES_IDENTIFICATION");
-        static const int ES_IDENTIFICATION_TYPE_HASH = HashingUtils::HashString("ES_IDENTIFICATION_TYPE");
-        static const int ES_LEGAL_FORM_HASH = HashingUtils::HashString("ES_LEGAL_FORM");
-        static const int FI_BUSINESS_NUMBER_HASH = HashingUtils::HashString("FI_BUSINESS_NUMBER");
-        static const int FI_ID_NUMBER_HASH = HashingUtils::HashString("FI_ID_NUMBER");
-        static const int FI_NATIONALITY_HASH = HashingUtils::HashString("FI_NATIONALITY");
-        static const int FI_ORGANIZATION_TYPE_HASH = HashingUtils::HashString("FI_ORGANIZATION_TYPE");
-        static const int IT_PIN_HASH = HashingUtils::HashString("IT_PIN");
-        static const int IT_REGISTRANT_ENTITY_TYPE_HASH = HashingUtils::HashString("IT_REGISTRANT_ENTITY_TYPE");
-        static const int RU_PASSPORT_DATA_HASH = HashingUtils::HashString("RU_PASSPORT_DATA");
-        static const int SE_ID_NUMBER_HASH = HashingUtils::HashString("SE_ID_NUMBER");
-        static const int SG_ID_NUMBER_HASH = HashingUtils::HashString("SG_ID_NUMBER");
-        static const int VAT_NUMBER_HASH = HashingUtils::HashString("VAT_NUMBER");
-        static const int UK_CONTACT_TYPE_HASH = HashingUtils::HashString("UK_CONTACT_TYPE");
-        static const int UK_COMPANY_NUMBER_HASH = HashingUtils::HashString("UK_COMPANY_NUMBER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DUNS_NUMBER",
+          "BRAND_NUMBER",
+          "BIRTH_DEPARTMENT",
+          "BIRTH_DATE_IN_YYYY_MM_DD",
+          "BIRTH_COUNTRY",
+          "BIRTH_CITY",
+          "DOCUMENT_NUMBER",
+          "AU_ID_NUMBER",
+          "AU_ID_TYPE",
+          "CA_LEGAL_TYPE",
+          "CA_BUSINESS_ENTITY_TYPE",
+          "ES_IDENTIFICATION",
+          "ES_IDENTIFICATION_TYPE",
+          "ES_LEGAL_FORM",
+          "FI_BUSINESS_NUMBER",
+          "FI_ID_NUMBER",
+          "FI_NATIONALITY",
+          "FI_ORGANIZATION_TYPE",
+          "IT_PIN",
+          "IT_REGISTRANT_ENTITY_TYPE",
+          "RU_PASSPORT_DATA",
+          "SE_ID_NUMBER",
+          "SG_ID_NUMBER",
+          "VAT_NUMBER",
+          "UK_CONTACT_TYPE",
+          "UK_COMPANY_NUMBER",
+        };
 
         ExtraParamName GetExtraParamNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DUNS_NUMBER_HASH)
-          {
-            return ExtraParamName::DUNS_NUMBER;
-          }
-          else if (hashCode == BRAND_NUMBER_HASH)
-          {
-            return ExtraParamName::BRAND_NUMBER;
-          }
-          else if (hashCode == BIRTH_DEPARTMENT_HASH)
-          {
-            return ExtraParamName::BIRTH_DEPARTMENT;
-          }
-          else if (hashCode == BIRTH_DATE_IN_YYYY_MM_DD_HASH)
-          {
-            return ExtraParamName::BIRTH_DATE_IN_YYYY_MM_DD;
-          }
-          else if (hashCode == BIRTH_COUNTRY_HASH)
-          {
-            return ExtraParamName::BIRTH_COUNTRY;
-          }
-          else if (hashCode == BIRTH_CITY_HASH)
-          {
-            return ExtraParamName::BIRTH_CITY;
-          }
-          else if (hashCode == DOCUMENT_NUMBER_HASH)
-          {
-            return ExtraParamName::DOCUMENT_NUMBER;
-          }
-          else if (hashCode == AU_ID_NUMBER_HASH)
-          {
-            return ExtraParamName::AU_ID_NUMBER;
-          }
-          else if (hashCode == AU_ID_TYPE_HASH)
-          {
-            return ExtraParamName::AU_ID_TYPE;
-          }
-          else if (hashCode == CA_LEGAL_TYPE_HASH)
-          {
-            return ExtraParamName::CA_LEGAL_TYPE;
-          }
-          else if (hashCode == CA_BUSINESS_ENTITY_TYPE_HASH)
-          {
-            return ExtraParamName::CA_BUSINESS_ENTITY_TYPE;
-          }
-          else if (hashCode == ES_IDENTIFICATION_HASH)
-          {
-            return ExtraParamName::ES_IDENTIFICATION;
-          }
-          else if (hashCode == ES_IDENTIFICATION_TYPE_HASH)
-          {
-            return ExtraParamName::ES_IDENTIFICATION_TYPE;
-          }
-          else if (hashCode == ES_LEGAL_FORM_HASH)
-          {
-            return ExtraParamName::ES_LEGAL_FORM;
-          }
-          else if (hashCode == FI_BUSINESS_NUMBER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExtraParamName::FI_BUSINESS_NUMBER;
-          }
-          else if (hashCode == FI_ID_NUMBER_HASH)
-          {
-            return ExtraParamName::FI_ID_NUMBER;
-          }
-          else if (hashCode == FI_NATIONALITY_HASH)
-          {
-            return ExtraParamName::FI_NATIONALITY;
-          }
-          else if (hashCode == FI_ORGANIZATION_TYPE_HASH)
-          {
-            return ExtraParamName::FI_ORGANIZATION_TYPE;
-          }
-          else if (hashCode == IT_PIN_HASH)
-          {
-            return ExtraParamName::IT_PIN;
-          }
-          else if (hashCode == IT_REGISTRANT_ENTITY_TYPE_HASH)
-          {
-            return ExtraParamName::IT_REGISTRANT_ENTITY_TYPE;
-          }
-          else if (hashCode == RU_PASSPORT_DATA_HASH)
-          {
-            return ExtraParamName::RU_PASSPORT_DATA;
-          }
-          else if (hashCode == SE_ID_NUMBER_HASH)
-          {
-            return ExtraParamName::SE_ID_NUMBER;
-          }
-          else if (hashCode == SG_ID_NUMBER_HASH)
-          {
-            return ExtraParamName::SG_ID_NUMBER;
-          }
-          else if (hashCode == VAT_NUMBER_HASH)
-          {
-            return ExtraParamName::VAT_NUMBER;
-          }
-          else if (hashCode == UK_CONTACT_TYPE_HASH)
-          {
-            return ExtraParamName::UK_CONTACT_TYPE;
-          }
-          else if (hashCode == UK_COMPANY_NUMBER_HASH)
-          {
-            return ExtraParamName::UK_COMPANY_NUMBER;
+          case -1353108078:
+            if (name == "DUNS_NUMBER")
+            {
+              return ExtraParamName::DUNS_NUMBER;
+            }
+            break;
+          case -1548146911:
+            if (name == "BRAND_NUMBER")
+            {
+              return ExtraParamName::BRAND_NUMBER;
+            }
+            break;
+          case 495075058:
+            if (name == "BIRTH_DEPARTMENT")
+            {
+              return ExtraParamName::BIRTH_DEPARTMENT;
+            }
+            break;
+          case -838880023:
+            if (name == "BIRTH_DATE_IN_YYYY_MM_DD")
+            {
+              return ExtraParamName::BIRTH_DATE_IN_YYYY_MM_DD;
+            }
+            break;
+          case 746321878:
+            if (name == "BIRTH_COUNTRY")
+            {
+              return ExtraParamName::BIRTH_COUNTRY;
+            }
+            break;
+          case 1683347723:
+            if (name == "BIRTH_CITY")
+            {
+              return ExtraParamName::BIRTH_CITY;
+            }
+            break;
+          case -1699895571:
+            if (name == "DOCUMENT_NUMBER")
+            {
+              return ExtraParamName::DOCUMENT_NUMBER;
+            }
+            break;
+          case 368750754:
+            if (name == "AU_ID_NUMBER")
+            {
+              return ExtraParamName::AU_ID_NUMBER;
+            }
+            break;
+          case 1560341203:
+            if (name == "AU_ID_TYPE")
+            {
+              return ExtraParamName::AU_ID_TYPE;
+            }
+            break;
+          case -495021151:
+            if (name == "CA_LEGAL_TYPE")
+            {
+              return ExtraParamName::CA_LEGAL_TYPE;
+            }
+            break;
+          case 672916824:
+            if (name == "CA_BUSINESS_ENTITY_TYPE")
+            {
+              return ExtraParamName::CA_BUSINESS_ENTITY_TYPE;
+            }
+            break;
+          case -821929441:
+            if (name == "ES_IDENTIFICATION")
+            {
+              return ExtraParamName::ES_IDENTIFICATION;
+            }
+            break;
+          case 279863642:
+            if (name == "ES_IDENTIFICATION_TYPE")
+            {
+              return ExtraParamName::ES_IDENTIFICATION_TYPE;
+            }
+            break;
+          case 1241235163:
+            if (name == "ES_LEGAL_FORM")
+            {
+              return ExtraParamName::ES_LEGAL_FORM;
+            }
+            break;
+          case 1171610924:
+            if (name == "FI_BUSINESS_NUMBER")
+            {
+              return ExtraParamName::FI_BUSINESS_NUMBER;
+            }
+            break;
+          case 1102744177:
+            if (name == "FI_ID_NUMBER")
+            {
+              return ExtraParamName::FI_ID_NUMBER;
+            }
+            break;
+          case 650816544:
+            if (name == "FI_NATIONALITY")
+            {
+              return ExtraParamName::FI_NATIONALITY;
+            }
+            break;
+          case -1206117814:
+            if (name == "FI_ORGANIZATION_TYPE")
+            {
+              return ExtraParamName::FI_ORGANIZATION_TYPE;
+            }
+            break;
+          case -2124554143:
+            if (name == "IT_PIN")
+            {
+              return ExtraParamName::IT_PIN;
+            }
+            break;
+          case 1286274582:
+            if (name == "IT_REGISTRANT_ENTITY_TYPE")
+            {
+              return ExtraParamName::IT_REGISTRANT_ENTITY_TYPE;
+            }
+            break;
+          case -919336261:
+            if (name == "RU_PASSPORT_DATA")
+            {
+              return ExtraParamName::RU_PASSPORT_DATA;
+            }
+            break;
+          case 1378690368:
+            if (name == "SE_ID_NUMBER")
+            {
+              return ExtraParamName::SE_ID_NUMBER;
+            }
+            break;
+          case 2079754946:
+            if (name == "SG_ID_NUMBER")
+            {
+              return ExtraParamName::SG_ID_NUMBER;
+            }
+            break;
+          case -146098881:
+            if (name == "VAT_NUMBER")
+            {
+              return ExtraParamName::VAT_NUMBER;
+            }
+            break;
+          case 1551979298:
+            if (name == "UK_CONTACT_TYPE")
+            {
+              return ExtraParamName::UK_CONTACT_TYPE;
+            }
+            break;
+          case 1108637236:
+            if (name == "UK_COMPANY_NUMBER")
+            {
+              return ExtraParamName::UK_COMPANY_NUMBER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -175,71 +240,26 @@ namespace Aws
           return ExtraParamName::NOT_SET;
         }
 
-        Aws::String GetNameForExtraParamName(ExtraParamName enumValue)
+        const char* GetNameForExtraParamNameCStr(ExtraParamName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExtraParamName::DUNS_NUMBER:
-            return "DUNS_NUMBER";
-          case ExtraParamName::BRAND_NUMBER:
-            return "BRAND_NUMBER";
-          case ExtraParamName::BIRTH_DEPARTMENT:
-            return "BIRTH_DEPARTMENT";
-          case ExtraParamName::BIRTH_DATE_IN_YYYY_MM_DD:
-            return "BIRTH_DATE_IN_YYYY_MM_DD";
-          case ExtraParamName::BIRTH_COUNTRY:
-            return "BIRTH_COUNTRY";
-          case ExtraParamName::BIRTH_CITY:
-            return "BIRTH_CITY";
-          case ExtraParamName::DOCUMENT_NUMBER:
-            return "DOCUMENT_NUMBER";
-          case ExtraParamName::AU_ID_NUMBER:
-            return "AU_ID_NUMBER";
-          case ExtraParamName::AU_ID_TYPE:
-            return "AU_ID_TYPE";
-          case ExtraParamName::CA_LEGAL_TYPE:
-            return "CA_LEGAL_TYPE";
-          case ExtraParamName::CA_BUSINESS_ENTITY_TYPE:
-            return "CA_BUSINESS_ENTITY_TYPE";
-          case ExtraParamName::ES_IDENTIFICATION:
-            return "ES_IDENTIFICATION";
-          case ExtraParamName::ES_IDENTIFICATION_TYPE:
-            return "ES_IDENTIFICATION_TYPE";
-          case ExtraParamName::ES_LEGAL_FORM:
-            return "ES_LEGAL_FORM";
-          case ExtraParamName::FI_BUSINESS_NUMBER:
-            return "FI_BUSINESS_NUMBER";
-          case ExtraParamName::FI_ID_NUMBER:
-            return "FI_ID_NUMBER";
-          case ExtraParamName::FI_NATIONALITY:
-            return "FI_NATIONALITY";
-          case ExtraParamName::FI_ORGANIZATION_TYPE:
-            return "FI_ORGANIZATION_TYPE";
-          case ExtraParamName::IT_PIN:
-            return "IT_PIN";
-          case ExtraParamName::IT_REGISTRANT_ENTITY_TYPE:
-            return "IT_REGISTRANT_ENTITY_TYPE";
-          case ExtraParamName::RU_PASSPORT_DATA:
-            return "RU_PASSPORT_DATA";
-          case ExtraParamName::SE_ID_NUMBER:
-            return "SE_ID_NUMBER";
-          case ExtraParamName::SG_ID_NUMBER:
-            return "SG_ID_NUMBER";
-          case ExtraParamName::VAT_NUMBER:
-            return "VAT_NUMBER";
-          case ExtraParamName::UK_CONTACT_TYPE:
-            return "UK_CONTACT_TYPE";
-          case ExtraParamName::UK_COMPANY_NUMBER:
-            return "UK_COMPANY_NUMBER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExtraParamName(ExtraParamName enumValue)
+        {
+          return GetNameForExtraParamNameCStr(enumValue);
         }
 
       } // namespace ExtraParamNameMapper
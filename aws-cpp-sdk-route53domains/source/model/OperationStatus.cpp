@@ -30,35 +30,58 @@ namespace Aws
       namespace OperationStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int SUCCESSFUL_HASH = HashingUtils::HashString("SUCCESSFUL");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUBMITTED",
+          "IN_PROGRESS",
+          "ERROR",
+          "SUCCESSFUL",
+          "FAILED",
+        };
 
         OperationStatus GetOperationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperationStatus::SUBMITTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return OperationStatus::IN_PROGRESS;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return OperationStatus::ERROR_;
-          }
-          else if (hashCode == SUCCESSFUL_HASH)
-          {
-            return OperationStatus::SUCCESSFUL;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return OperationStatus::FAILED;
+          case -1159694117:
+            if (name == "SUBMITTED")
+            {
+              return OperationStatus::SUBMITTED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return OperationStatus::IN_PROGRESS;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return OperationStatus::ERROR_;
+            }
+            break;
+          case -248539494:
+            if (name == "SUCCESSFUL")
+            {
+              return OperationStatus::SUCCESSFUL;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return OperationStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return OperationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForOperationStatus(OperationStatus enumValue)
+        const char* GetNameForOperationStatusCStr(OperationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperationStatus::SUBMITTED:
-            return "SUBMITTED";
-          case OperationStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case OperationStatus::ERROR_:
-            return "ERROR";
-          case OperationStatus::SUCCESSFUL:
-            return "SUCCESSFUL";
-          case OperationStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperationStatus(OperationStatus enumValue)
+        {
+          return GetNameForOperationStatusCStr(enumValue);
         }
 
       } // namespace OperationStatusMapper
@@ -30,90 +30,135 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int REGISTER_DOMAIN_HASH = HashingUtils::HashString("REGISTER_DOMAIN");
-        static const int DELETE_DOMAIN_HASH = HashingUtils::HashString("DELETE_DOMAIN");
-        static const int TRANSFER_IN_DOMAIN_HASH = HashingUtils::HashString("TRANSFER_IN_DOMAIN");
-        static const int UPDATE_DOMAIN_CONTACT_HASH = HashingUtils::HashString("UPDATE_DOMAIN_CONTACT");
-        static const int UPDATE_NAMESERVER_HASH = HashingUtils::HashString("UPDATE_NAMESERVER");
-        static const int CHANGE_PRIVACY_PROTECTION_HASH = HashingUtils::HashString("CHANGE_PRIVACY_PROTECTION");
-        static const int DOMAIN_LOCK_HASH = HashingUtils::HashString("DOMAIN_LOCK");
-        static const int ENABLE_AUTORENEW_HASH = HashingUtils::HashString("ENABLE_AUTORENEW");
-        static const int DISABLE_AUTORENEW_HASH = HashingUtils::HashString("DISABLE_AUTORENEW");
-        static const int ADD_DNSSEC_HASH = HashingUtils::HashString("ADD_DNSSEC");
-        static const int REMOVE_DNSSEC_HASH = HashingUtils::HashString("REMOVE_DNSSEC");
-        static const int EXPIRE_DOMAIN_HASH = HashingUtils::HashString("EXPIRE_DOMAIN");
-        static const int TRANSFER_OUT_DOMAIN_HASH = HashingUtils::HashString("TRANSFER_OUT_DOMAIN");
-        static const int CHANGE_DOMAIN_OWNER_HASH = HashingUtils::HashString("CHANGE_DOMAIN_OWNER");
-        static const int RENEW_DOMAIN_HASH = HashingUtils::HashString("RENEW_DOMAIN");
-        static const int PUSH_DOMAIN_HASH = HashingUtils::HashString("PUSH_DOMAIN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REGISTER_DOMAIN",
+          "DELETE_DOMAIN",
+          "TRANSFER_IN_DOMAIN",
+          "UPDATE_DOMAIN_CONTACT",
+          "UPDATE_NAMESERVER",
+          "CHANGE_PRIVACY_PROTECTION",
+          "DOMAIN_LOCK",
+          "ENABLE_AUTORENEW",
+          "DISABLE_AUTORENEW",
+          "ADD_DNSSEC",
+          "REMOVE_DNSSEC",
+          "EXPIRE_DOMAIN",
+          "TRANSFER_OUT_DOMAIN",
+          "CHANGE_DOMAIN_OWNER",
+          "RENEW_DOMAIN",
+          "PUSH_DOMAIN",
+        };
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGISTER_DOMAIN_HASH)
-          {
-            return OperationType::REGISTER_DOMAIN;
-          }
-          else if (hashCode == DELETE_DOMAIN_HASH)
-          {
-            return OperationType::DELETE_DOMAIN;
-          }
-          else if (hashCode == TRANSFER_IN_DOMAIN_HASH)
-          {
-            return OperationType::TRANSFER_IN_DOMAIN;
-          }
-          else if (hashCode == UPDATE_DOMAIN_CONTACT_HASH)
-          {
-            return OperationType::UPDATE_DOMAIN_CONTACT;
-          }
-          else if (hashCode == UPDATE_NAMESERVER_HASH)
-          {
-            return OperationType::UPDATE_NAMESERVER;
-          }
-          else if (hashCode == CHANGE_PRIVACY_PROTECTION_HASH)
-          {
-            return OperationType::CHANGE_PRIVACY_PROTECTION;
-          }
-          else if (hashCode == DOMAIN_LOCK_HASH)
-          {
-            return OperationType::DOMAIN_LOCK;
-          }
-          else if (hashCode == ENABLE_AUTORENEW_HASH)
-          {
-            return OperationType::ENABLE_AUTORENEW;
-          }
-          else if (hashCode == DISABLE_AUTORENEW_HASH)
-          {
-            return OperationType::DISABLE_AUTORENEW;
-          }
-          else if (hashCode == ADD_DNSSEC_HASH)
-          {
-            return OperationType::ADD_DNSSEC;
-          }
-          else if (hashCode == REMOVE_DNSSEC_HASH)
-          {
-            return OperationType::REMOVE_DNSSEC;
-          }
-          else if (hashCode == EXPIRE_DOMAIN_HASH)
-          {
-            return OperationType::EXPIRE_DOMAIN;
-          }
-          else if (hashCode == TRANSFER_OUT_DOMAIN_HASH)
-          {
-            return OperationType::TRANSFER_OUT_DOMAIN;
-          }
-          else if (hashCode == CHANGE_DOMAIN_OWNER_HASH)
-          {
-            return OperationType::CHANGE_DOMAIN_OWNER;
-          }
-          else if (hashCode == RENEW_DOMAIN_HASH)
-          {
-            return OperationType::RENEW_DOMAIN;
-          }
-          else if (hashCode == PUSH_DOMAIN_HASH)
-          {
-            return OperationType::PUSH_DOMAIN;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -975799840:
+            if (name == "REGISTER_DOMAIN")
+            {
+              return OperationType::REGISTER_DOMAIN;
+            }
+            break;
+          case 964437464:
+            if (name == "DELETE_DOMAIN")
+            {
+              return OperationType::DELETE_DOMAIN;
+            }
+            break;
+          case -480177718:
+            if (name == "TRANSFER_IN_DOMAIN")
+            {
+              return OperationType::TRANSFER_IN_DOMAIN;
+            }
+            break;
+          case 903418299:
+            if (name == "UPDATE_DOMAIN_CONTACT")
+            {
+              return OperationType::UPDATE_DOMAIN_CONTACT;
+            }
+            break;
+          case 980468420:
+            if (name == "UPDATE_NAMESERVER")
+            {
+              return OperationType::UPDATE_NAMESERVER;
+            }
+            break;
+          case -1112097537:
+            if (name == "CHANGE_PRIVACY_PROTECTION")
+            {
+              return OperationType::CHANGE_PRIVACY_PROTECTION;
+            }
+            break;
+          case -2008381498:
+            if (name == "DOMAIN_LOCK")
+            {
+              return OperationType::DOMAIN_LOCK;
+            }
+            break;
+          case 537378402:
+            if (name == "ENABLE_AUTORENEW")
+            {
+              return OperationType::ENABLE_AUTORENEW;
+            }
+            break;
+          case -726187673:
+            if (name == "DISABLE_AUTORENEW")
+            {
+              return OperationType::DISABLE_AUTORENEW;
+            }
+            break;
+          case 445565958:
+            if (name == "ADD_DNSSEC")
+            {
+              return OperationType::ADD_DNSSEC;
+            }
+            break;
+          case -1930992989:
+            if (name == "REMOVE_DNSSEC")
+            {
+              return OperationType::REMOVE_DNSSEC;
+            }
+            break;
+          case -1235344412:
+            if (name == "EXPIRE_DOMAIN")
+            {
+              return OperationType::EXPIRE_DOMAIN;
+            }
+            break;
+          case 1531994057:
+            if (name == "TRANSFER_OUT_DOMAIN")
+            {
+              return OperationType::TRANSFER_OUT_DOMAIN;
+            }
+            break;
+          case 581428103:
+            if (name == "CHANGE_DOMAIN_OWNER")
+            {
+              return OperationType::CHANGE_DOMAIN_OWNER;
+            }
+            break;
+          case 1692045014:
+            if (name == "RENEW_DOMAIN")
+            {
+              return OperationType::RENEW_DOMAIN;
+            }
+            break;
+          case 123063689:
+            if (name == "PUSH_DOMAIN")
+            {
+              return OperationType::PUSH_DOMAIN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -125,51 +170,26 @@ namespace Aws
           return OperationType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationType(OperationType enumValue)
+        const char* GetNameForOperationTypeCStr(OperationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperationType::REGISTER_DOMAIN:
-            return "REGISTER_DOMAIN";
-          case OperationType::DELETE_DOMAIN:
-            return "DELETE_DOMAIN";
-          case OperationType::TRANSFER_IN_DOMAIN:
-            return "TRANSFER_IN_DOMAIN";
-          case OperationType::UPDATE_DOMAIN_CONTACT:
-            return "UPDATE_DOMAIN_CONTACT";
-          case OperationType::UPDATE_NAMESERVER:
-            return "UPDATE_NAMESERVER";
-          case OperationType::CHANGE_PRIVACY_PROTECTION:
-            return "CHANGE_PRIVACY_PROTECTION";
-          case OperationType::DOMAIN_LOCK:
-            return "DOMAIN_LOCK";
-          case OperationType::ENABLE_AUTORENEW:
-            return "ENABLE_AUTORENEW";
-          case OperationType::DISABLE_AUTORENEW:
-            return "DISABLE_AUTORENEW";
-          case OperationType::ADD_DNSSEC:
-            return "ADD_DNSSEC";
-          case OperationType::REMOVE_DNSSEC:
-            return "REMOVE_DNSSEC";
-          case OperationType::EXPIRE_DOMAIN:
-            return "EXPIRE_DOMAIN";
-          case OperationType::TRANSFER_OUT_DOMAIN:
-            return "TRANSFER_OUT_DOMAIN";
-          case OperationType::CHANGE_DOMAIN_OWNER:
-            return "CHANGE_DOMAIN_OWNER";
-          case OperationType::RENEW_DOMAIN:
-            return "RENEW_DOMAIN";
-          case OperationType::PUSH_DOMAIN:
-            return "PUSH_DOMAIN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperationType(OperationType enumValue)
+        {
+          return GetNameForOperationTypeCStr(enumValue);
         }
 
       } // namespace OperationTypeMapper
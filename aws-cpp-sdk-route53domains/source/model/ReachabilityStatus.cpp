@@ -30,25 +30,44 @@ namespace Aws
       namespace ReachabilityStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int DONE_HASH = HashingUtils::HashString("DONE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "DONE",
+          "EXPIRED",
+        };
 
         ReachabilityStatus GetReachabilityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return ReachabilityStatus::PENDING;
-          }
-          else if (hashCode == DONE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReachabilityStatus::DONE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return ReachabilityStatus::EXPIRED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ReachabilityStatus::PENDING;
+            }
+            break;
+          case 2104194:
+            if (name == "DONE")
+            {
+              return ReachabilityStatus::DONE;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return ReachabilityStatus::EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ReachabilityStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReachabilityStatus(ReachabilityStatus enumValue)
+        const char* GetNameForReachabilityStatusCStr(ReachabilityStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReachabilityStatus::PENDING:
-            return "PENDING";
-          case ReachabilityStatus::DONE:
-            return "DONE";
-          case ReachabilityStatus::EXPIRED:
-            return "EXPIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReachabilityStatus(ReachabilityStatus enumValue)
+        {
+          return GetNameForReachabilityStatusCStr(enumValue);
         }
 
       } // namespace ReachabilityStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TransferableMapper
       {
 
-        static const int TRANSFERABLE_HASH = HashingUtils::HashString("TRANSFERABLE");
-        static const int UNTRANSFERABLE_HASH = HashingUtils::HashString("UNTRANSFERABLE");
-        static const int DONT_KNOW_HASH = HashingUtils::HashString("DONT_KNOW");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TRANSFERABLE",
+          "UNTRANSFERABLE",
+          "DONT_KNOW",
+        };
 
         Transferable GetTransferableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRANSFERABLE_HASH)
-          {
-            return Transferable::TRANSFERABLE;
-          }
-          else if (hashCode == UNTRANSFERABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Transferable::UNTRANSFERABLE;
-          }
-          else if (hashCode == DONT_KNOW_HASH)
-          {
-            return Transferable::DONT_KNOW;
+          case 174147525:
+            if (name == "TRANSFERABLE")
+            {
+              return Transferable::TRANSFERABLE;
+            }
+            break;
+          case -1259260706:
+            if (name == "UNTRANSFERABLE")
+            {
+              return Transferable::UNTRANSFERABLE;
+            }
+            break;
+          case 595949177:
+            if (name == "DONT_KNOW")
+            {
+              return Transferable::DONT_KNOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Transferable::NOT_SET;
         }
 
-        Aws::String GetNameForTransferable(Transferable enumValue)
+        const char* GetNameForTransferableCStr(Transferable enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Transferable::TRANSFERABLE:
-            return "TRANSFERABLE";
-          case Transferable::UNTRANSFERABLE:
-            return "UNTRANSFERABLE";
-          case Transferable::DONT_KNOW:
-            return "DONT_KNOW";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransferable(Transferable enumValue)
+        {
+          return GetNameForTransferableCStr(enumValue);
         }
 
       } // namespace TransferableMapper
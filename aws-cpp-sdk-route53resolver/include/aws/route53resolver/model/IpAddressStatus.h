@@ -43,6 +43,11 @@ namespace IpAddressStatusMapper
 AWS_ROUTE53RESOLVER_API IpAddressStatus GetIpAddressStatusForName(const Aws::String& name);
 
 AWS_ROUTE53RESOLVER_API Aws::String GetNameForIpAddressStatus(IpAddressStatus value);
+
+/**
+ * Same as GetNameForIpAddressStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53RESOLVER_API const char* GetNameForIpAddressStatusCStr(IpAddressStatus value);
 } // namespace IpAddressStatusMapper
 } // namespace Model
 } // namespace Route53Resolver
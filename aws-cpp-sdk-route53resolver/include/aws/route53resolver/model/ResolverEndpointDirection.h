@@ -35,6 +35,11 @@ namespace ResolverEndpointDirectionMapper
 AWS_ROUTE53RESOLVER_API ResolverEndpointDirection GetResolverEndpointDirectionForName(const Aws::String& name);
 
 AWS_ROUTE53RESOLVER_API Aws::String GetNameForResolverEndpointDirection(ResolverEndpointDirection value);
+
+/**
+ * Same as GetNameForResolverEndpointDirection(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53RESOLVER_API const char* GetNameForResolverEndpointDirectionCStr(ResolverEndpointDirection value);
 } // namespace ResolverEndpointDirectionMapper
 } // namespace Model
 } // namespace Route53Resolver
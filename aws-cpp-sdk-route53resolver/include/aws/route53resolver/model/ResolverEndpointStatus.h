@@ -39,6 +39,11 @@ namespace ResolverEndpointStatusMapper
 AWS_ROUTE53RESOLVER_API ResolverEndpointStatus GetResolverEndpointStatusForName(const Aws::String& name);
 
 AWS_ROUTE53RESOLVER_API Aws::String GetNameForResolverEndpointStatus(ResolverEndpointStatus value);
+
+/**
+ * Same as GetNameForResolverEndpointStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53RESOLVER_API const char* GetNameForResolverEndpointStatusCStr(ResolverEndpointStatus value);
 } // namespace ResolverEndpointStatusMapper
 } // namespace Model
 } // namespace Route53Resolver
@@ -38,6 +38,11 @@ namespace ResolverRuleAssociationStatusMapper
 AWS_ROUTE53RESOLVER_API ResolverRuleAssociationStatus GetResolverRuleAssociationStatusForName(const Aws::String& name);
 
 AWS_ROUTE53RESOLVER_API Aws::String GetNameForResolverRuleAssociationStatus(ResolverRuleAssociationStatus value);
+
+/**
+ * Same as GetNameForResolverRuleAssociationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53RESOLVER_API const char* GetNameForResolverRuleAssociationStatusCStr(ResolverRuleAssociationStatus value);
 } // namespace ResolverRuleAssociationStatusMapper
 } // namespace Model
 } // namespace Route53Resolver
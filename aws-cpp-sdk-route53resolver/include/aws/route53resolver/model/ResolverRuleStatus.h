@@ -37,6 +37,11 @@ namespace ResolverRuleStatusMapper
 AWS_ROUTE53RESOLVER_API ResolverRuleStatus GetResolverRuleStatusForName(const Aws::String& name);
 
 AWS_ROUTE53RESOLVER_API Aws::String GetNameForResolverRuleStatus(ResolverRuleStatus value);
+
+/**
+ * Same as GetNameForResolverRuleStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53RESOLVER_API const char* GetNameForResolverRuleStatusCStr(ResolverRuleStatus value);
 } // namespace ResolverRuleStatusMapper
 } // namespace Model
 } // namespace Route53Resolver
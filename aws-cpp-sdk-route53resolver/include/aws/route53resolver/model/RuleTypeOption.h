@@ -36,6 +36,11 @@ namespace RuleTypeOptionMapper
 AWS_ROUTE53RESOLVER_API RuleTypeOption GetRuleTypeOptionForName(const Aws::String& name);
 
 AWS_ROUTE53RESOLVER_API Aws::String GetNameForRuleTypeOption(RuleTypeOption value);
+
+/**
+ * Same as GetNameForRuleTypeOption(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53RESOLVER_API const char* GetNameForRuleTypeOptionCStr(RuleTypeOption value);
 } // namespace RuleTypeOptionMapper
 } // namespace Model
 } // namespace Route53Resolver
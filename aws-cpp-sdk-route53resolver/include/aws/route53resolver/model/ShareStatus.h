@@ -36,6 +36,11 @@ namespace ShareStatusMapper
 AWS_ROUTE53RESOLVER_API ShareStatus GetShareStatusForName(const Aws::String& name);
 
 AWS_ROUTE53RESOLVER_API Aws::String GetNameForShareStatus(ShareStatus value);
+
+/**
+ * Same as GetNameForShareStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_ROUTE53RESOLVER_API const char* GetNameForShareStatusCStr(ShareStatus value);
 } // namespace ShareStatusMapper
 } // namespace Model
 } // namespace Route53Resolver
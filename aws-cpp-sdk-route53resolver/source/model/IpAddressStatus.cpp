@@ -30,60 +30,93 @@ namespace Aws
       namespace IpAddressStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int FAILED_CREATION_HASH = HashingUtils::HashString("FAILED_CREATION");
-        static const int ATTACHING_HASH = HashingUtils::HashString("ATTACHING");
-        static const int ATTACHED_HASH = HashingUtils::HashString("ATTACHED");
-        static const int REMAP_DETACHING_HASH = HashingUtils::HashString("REMAP_DETACHING");
-        static const int REMAP_ATTACHING_HASH = HashingUtils::HashString("REMAP_ATTACHING");
-        static const int DETACHING_HASH = HashingUtils::HashString("DETACHING");
-        static const int FAILED_RESOURCE_GONE_HASH = HashingUtils::HashString("FAILED_RESOURCE_GONE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETE_FAILED_FAS_EXPIRED_HASH = HashingUtils::HashString("DELETE_FAILED_FAS_EXPIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "FAILED_CREATION",
+          "ATTACHING",
+          "ATTACHED",
+          "REMAP_DETACHING",
+          "REMAP_ATTACHING",
+          "DETACHING",
+          "FAILED_RESOURCE_GONE",
+          "DELETING",
+          "DELETE_FAILED_FAS_EXPIRED",
+        };
 
         IpAddressStatus GetIpAddressStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return IpAddressStatus::CREATING;
-          }
-          else if (hashCode == FAILED_CREATION_HASH)
-          {
-            return IpAddressStatus::FAILED_CREATION;
-          }
-          else if (hashCode == ATTACHING_HASH)
-          {
-            return IpAddressStatus::ATTACHING;
-          }
-          else if (hashCode == ATTACHED_HASH)
-          {
-            return IpAddressStatus::ATTACHED;
-          }
-          else if (hashCode == REMAP_DETACHING_HASH)
-          {
-            return IpAddressStatus::REMAP_DETACHING;
-          }
-          else if (hashCode == REMAP_ATTACHING_HASH)
-          {
-            return IpAddressStatus::REMAP_ATTACHING;
-          }
-          else if (hashCode == DETACHING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IpAddressStatus::DETACHING;
-          }
-          else if (hashCode == FAILED_RESOURCE_GONE_HASH)
-          {
-            return IpAddressStatus::FAILED_RESOURCE_GONE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return IpAddressStatus::DELETING;
-          }
-          else if (hashCode == DELETE_FAILED_FAS_EXPIRED_HASH)
-          {
-            return IpAddressStatus::DELETE_FAILED_FAS_EXPIRED;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return IpAddressStatus::CREATING;
+            }
+            break;
+          case -585368415:
+            if (name == "FAILED_CREATION")
+            {
+              return IpAddressStatus::FAILED_CREATION;
+            }
+            break;
+          case -1987356835:
+            if (name == "ATTACHING")
+            {
+              return IpAddressStatus::ATTACHING;
+            }
+            break;
+          case 1321364900:
+            if (name == "ATTACHED")
+            {
+              return IpAddressStatus::ATTACHED;
+            }
+            break;
+          case -1183634247:
+            if (name == "REMAP_DETACHING")
+            {
+              return IpAddressStatus::REMAP_DETACHING;
+            }
+            break;
+          case 316113095:
+            if (name == "REMAP_ATTACHING")
+            {
+              return IpAddressStatus::REMAP_ATTACHING;
+            }
+            break;
+          case 807863119:
+            if (name == "DETACHING")
+            {
+              return IpAddressStatus::DETACHING;
+            }
+            break;
+          case 5276078:
+            if (name == "FAILED_RESOURCE_GONE")
+            {
+              return IpAddressStatus::FAILED_RESOURCE_GONE;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return IpAddressStatus::DELETING;
+            }
+            break;
+          case -1090436400:
+            if (name == "DELETE_FAILED_FAS_EXPIRED")
+            {
+              return IpAddressStatus::DELETE_FAILED_FAS_EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return IpAddressStatus::NOT_SET;
         }
 
-        Aws::String GetNameForIpAddressStatus(IpAddressStatus enumValue)
+        const char* GetNameForIpAddressStatusCStr(IpAddressStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IpAddressStatus::CREATING:
-            return "CREATING";
-          case IpAddressStatus::FAILED_CREATION:
-            return "FAILED_CREATION";
-          case IpAddressStatus::ATTACHING:
-            return "ATTACHING";
-          case IpAddressStatus::ATTACHED:
-            return "ATTACHED";
-          case IpAddressStatus::REMAP_DETACHING:
-            return "REMAP_DETACHING";
-          case IpAddressStatus::REMAP_ATTACHING:
-            return "REMAP_ATTACHING";
-          case IpAddressStatus::DETACHING:
-            return "DETACHING";
-          case IpAddressStatus::FAILED_RESOURCE_GONE:
-            return "FAILED_RESOURCE_GONE";
-          case IpAddressStatus::DELETING:
-            return "DELETING";
-          case IpAddressStatus::DELETE_FAILED_FAS_EXPIRED:
-            return "DELETE_FAILED_FAS_EXPIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIpAddressStatus(IpAddressStatus enumValue)
+        {
+          return GetNameForIpAddressStatusCStr(enumValue);
         }
 
       } // namespace IpAddressStatusMapper
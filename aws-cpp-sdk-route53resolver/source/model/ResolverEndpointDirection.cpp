@@ -30,20 +30,37 @@ namespace Aws
       namespace ResolverEndpointDirectionMapper
       {
 
-        static const int INBOUND_HASH = HashingUtils::HashString("INBOUND");
-        static const int OUTBOUND_HASH = HashingUtils::HashString("OUTBOUND");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INBOUND",
+          "OUTBOUND",
+        };
 
         ResolverEndpointDirection GetResolverEndpointDirectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INBOUND_HASH)
-          {
-            return ResolverEndpointDirection::INBOUND;
-          }
-          else if (hashCode == OUTBOUND_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResolverEndpointDirection::OUTBOUND;
+          case -1635244199:
+            if (name == "INBOUND")
+            {
+              return ResolverEndpointDirection::INBOUND;
+            }
+            break;
+          case 839703280:
+            if (name == "OUTBOUND")
+            {
+              return ResolverEndpointDirection::OUTBOUND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ResolverEndpointDirection::NOT_SET;
         }
 
-        Aws::String GetNameForResolverEndpointDirection(ResolverEndpointDirection enumValue)
+        const char* GetNameForResolverEndpointDirectionCStr(ResolverEndpointDirection enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResolverEndpointDirection::INBOUND:
-            return "INBOUND";
-          case ResolverEndpointDirection::OUTBOUND:
-            return "OUTBOUND";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResolverEndpointDirection(ResolverEndpointDirection enumValue)
+        {
+          return GetNameForResolverEndpointDirectionCStr(enumValue);
         }
 
       } // namespace ResolverEndpointDirectionMapper
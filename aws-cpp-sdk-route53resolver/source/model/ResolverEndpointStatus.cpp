@@ -30,40 +30,65 @@ namespace Aws
       namespace ResolverEndpointStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int OPERATIONAL_HASH = HashingUtils::HashString("OPERATIONAL");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int AUTO_RECOVERING_HASH = HashingUtils::HashString("AUTO_RECOVERING");
-        static const int ACTION_NEEDED_HASH = HashingUtils::HashString("ACTION_NEEDED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "OPERATIONAL",
+          "UPDATING",
+          "AUTO_RECOVERING",
+          "ACTION_NEEDED",
+          "DELETING",
+        };
 
         ResolverEndpointStatus GetResolverEndpointStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return ResolverEndpointStatus::CREATING;
-          }
-          else if (hashCode == OPERATIONAL_HASH)
-          {
-            return ResolverEndpointStatus::OPERATIONAL;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return ResolverEndpointStatus::UPDATING;
-          }
-          else if (hashCode == AUTO_RECOVERING_HASH)
-          {
-            return ResolverEndpointStatus::AUTO_RECOVERING;
-          }
-          else if (hashCode == ACTION_NEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResolverEndpointStatus::ACTION_NEEDED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ResolverEndpointStatus::DELETING;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return ResolverEndpointStatus::CREATING;
+            }
+            break;
+          case -2012301390:
+            if (name == "OPERATIONAL")
+            {
+              return ResolverEndpointStatus::OPERATIONAL;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return ResolverEndpointStatus::UPDATING;
+            }
+            break;
+          case 45029518:
+            if (name == "AUTO_RECOVERING")
+            {
+              return ResolverEndpointStatus::AUTO_RECOVERING;
+            }
+            break;
+          case -1460699682:
+            if (name == "ACTION_NEEDED")
+            {
+              return ResolverEndpointStatus::ACTION_NEEDED;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ResolverEndpointStatus::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ResolverEndpointStatus::NOT_SET;
         }
 
-        Aws::String GetNameForResolverEndpointStatus(ResolverEndpointStatus enumValue)
+        const char* GetNameForResolverEndpointStatusCStr(ResolverEndpointStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResolverEndpointStatus::CREATING:
-            return "CREATING";
-          case ResolverEndpointStatus::OPERATIONAL:
-            return "OPERATIONAL";
-          case ResolverEndpointStatus::UPDATING:
-            return "UPDATING";
-          case ResolverEndpointStatus::AUTO_RECOVERING:
-            return "AUTO_RECOVERING";
-          case ResolverEndpointStatus::ACTION_NEEDED:
-            return "ACTION_NEEDED";
-          case ResolverEndpointStatus::DELETING:
-            return "DELETING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResolverEndpointStatus(ResolverEndpointStatus enumValue)
+        {
+          return GetNameForResolverEndpointStatusCStr(enumValue);
         }
 
       } // namespace ResolverEndpointStatusMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ResolverRuleAssociationStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int COMPLETE_HASH = HashingUtils::HashString("COMPLETE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int OVERRIDDEN_HASH = HashingUtils::HashString("OVERRIDDEN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "COMPLETE",
+          "DELETING",
+          "FAILED",
+          "OVERRIDDEN",
+        };
 
         ResolverRuleAssociationStatus GetResolverRuleAssociationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResolverRuleAssociationStatus::CREATING;
-          }
-          else if (hashCode == COMPLETE_HASH)
-          {
-            return ResolverRuleAssociationStatus::COMPLETE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ResolverRuleAssociationStatus::DELETING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ResolverRuleAssociationStatus::FAILED;
-          }
-          else if (hashCode == OVERRIDDEN_HASH)
-          {
-            return ResolverRuleAssociationStatus::OVERRIDDEN;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return ResolverRuleAssociationStatus::CREATING;
+            }
+            break;
+          case 183181625:
+            if (name == "COMPLETE")
+            {
+              return ResolverRuleAssociationStatus::COMPLETE;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ResolverRuleAssociationStatus::DELETING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ResolverRuleAssociationStatus::FAILED;
+            }
+            break;
+          case -1289138764:
+            if (name == "OVERRIDDEN")
+            {
+              return ResolverRuleAssociationStatus::OVERRIDDEN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ResolverRuleAssociationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForResolverRuleAssociationStatus(ResolverRuleAssociationStatus enumValue)
+        const char* GetNameForResolverRuleAssociationStatusCStr(ResolverRuleAssociationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResolverRuleAssociationStatus::CREATING:
-            return "CREATING";
-          case ResolverRuleAssociationStatus::COMPLETE:
-            return "COMPLETE";
-          case ResolverRuleAssociationStatus::DELETING:
-            return "DELETING";
-          case ResolverRuleAssociationStatus::FAILED:
-            return "FAILED";
-          case ResolverRuleAssociationStatus::OVERRIDDEN:
-            return "OVERRIDDEN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResolverRuleAssociationStatus(ResolverRuleAssociationStatus enumValue)
+        {
+          return GetNameForResolverRuleAssociationStatusCStr(enumValue);
         }
 
       } // namespace ResolverRuleAssociationStatusMapper
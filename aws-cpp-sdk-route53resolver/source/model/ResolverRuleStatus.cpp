@@ -30,30 +30,51 @@ namespace Aws
       namespace ResolverRuleStatusMapper
       {
 
-        static const int COMPLETE_HASH = HashingUtils::HashString("COMPLETE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COMPLETE",
+          "DELETING",
+          "UPDATING",
+          "FAILED",
+        };
 
         ResolverRuleStatus GetResolverRuleStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLETE_HASH)
-          {
-            return ResolverRuleStatus::COMPLETE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ResolverRuleStatus::DELETING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return ResolverRuleStatus::UPDATING;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResolverRuleStatus::FAILED;
+          case 183181625:
+            if (name == "COMPLETE")
+            {
+              return ResolverRuleStatus::COMPLETE;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ResolverRuleStatus::DELETING;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return ResolverRuleStatus::UPDATING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ResolverRuleStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ResolverRuleStatus::NOT_SET;
         }
 
-        Aws::String GetNameForResolverRuleStatus(ResolverRuleStatus enumValue)
+        const char* GetNameForResolverRuleStatusCStr(ResolverRuleStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResolverRuleStatus::COMPLETE:
-            return "COMPLETE";
-          case ResolverRuleStatus::DELETING:
-            return "DELETING";
-          case ResolverRuleStatus::UPDATING:
-            return "UPDATING";
-          case ResolverRuleStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResolverRuleStatus(ResolverRuleStatus enumValue)
+        {
+          return GetNameForResolverRuleStatusCStr(enumValue);
         }
 
       } // namespace ResolverRuleStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace RuleTypeOptionMapper
       {
 
-        static const int FORWARD_HASH = HashingUtils::HashString("FORWARD");
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
-        static const int RECURSIVE_HASH = HashingUtils::HashString("RECURSIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FORWARD",
+          "SYSTEM",
+          "RECURSIVE",
+        };
 
         RuleTypeOption GetRuleTypeOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FORWARD_HASH)
-          {
-            return RuleTypeOption::FORWARD;
-          }
-          else if (hashCode == SYSTEM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RuleTypeOption::SYSTEM;
-          }
-          else if (hashCode == RECURSIVE_HASH)
-          {
-            return RuleTypeOption::RECURSIVE;
+          case 40836773:
+            if (name == "FORWARD")
+            {
+              return RuleTypeOption::FORWARD;
+            }
+            break;
+          case -1833998801:
+            if (name == "SYSTEM")
+            {
+              return RuleTypeOption::SYSTEM;
+            }
+            break;
+          case -342592494:
+            if (name == "RECURSIVE")
+            {
+              return RuleTypeOption::RECURSIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RuleTypeOption::NOT_SET;
         }
 
-        Aws::String GetNameForRuleTypeOption(RuleTypeOption enumValue)
+        const char* GetNameForRuleTypeOptionCStr(RuleTypeOption enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RuleTypeOption::FORWARD:
-            return "FORWARD";
-          case RuleTypeOption::SYSTEM:
-            return "SYSTEM";
-          case RuleTypeOption::RECURSIVE:
-            return "RECURSIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRuleTypeOption(RuleTypeOption enumValue)
+        {
+          return GetNameForRuleTypeOptionCStr(enumValue);
         }
 
       } // namespace RuleTypeOptionMapper
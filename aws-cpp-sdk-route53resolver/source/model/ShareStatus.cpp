@@ -30,25 +30,44 @@ namespace Aws
       namespace ShareStatusMapper
       {
 
-        static const int NOT_SHARED_HASH = HashingUtils::HashString("NOT_SHARED");
-        static const int SHARED_WITH_ME_HASH = HashingUtils::HashString("SHARED_WITH_ME");
-        static const int SHARED_BY_ME_HASH = HashingUtils::HashString("SHARED_BY_ME");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NOT_SHARED",
+          "SHARED_WITH_ME",
+          "SHARED_BY_ME",
+        };
 
         ShareStatus GetShareStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_SHARED_HASH)
-          {
-            return ShareStatus::NOT_SHARED;
-          }
-          else if (hashCode == SHARED_WITH_ME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ShareStatus::SHARED_WITH_ME;
-          }
-          else if (hashCode == SHARED_BY_ME_HASH)
-          {
-            return ShareStatus::SHARED_BY_ME;
+          case 2022248305:
+            if (name == "NOT_SHARED")
+            {
+              return ShareStatus::NOT_SHARED;
+            }
+            break;
+          case 926472663:
+            if (name == "SHARED_WITH_ME")
+            {
+              return ShareStatus::SHARED_WITH_ME;
+            }
+            break;
+          case -1774365146:
+            if (name == "SHARED_BY_ME")
+            {
+              return ShareStatus::SHARED_BY_ME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ShareStatus::NOT_SET;
         }
 
-        Aws::String GetNameForShareStatus(ShareStatus enumValue)
+        const char* GetNameForShareStatusCStr(ShareStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ShareStatus::NOT_SHARED:
-            return "NOT_SHARED";
-          case ShareStatus::SHARED_WITH_ME:
-            return "SHARED_WITH_ME";
-          case ShareStatus::SHARED_BY_ME:
-            return "SHARED_BY_ME";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForShareStatus(ShareStatus enumValue)
+        {
+          return GetNameForShareStatusCStr(enumValue);
         }
 
       } // namespace ShareStatusMapper
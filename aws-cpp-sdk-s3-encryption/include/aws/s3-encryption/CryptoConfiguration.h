@@ -16,8 +16,18 @@
 
 #include <aws/s3-encryption/s3Encryption_EXPORTS.h>
 
+#include <cstddef>
+
 namespace Aws
 {
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        }
+    }
+
     namespace S3Encryption
     {
         enum class StorageMethod
@@ -88,9 +98,120 @@ namespace Aws
                 m_cryptoMode = cryptoMode;
             }
 
+            /**
+            * Gets the size of the blocks object bodies are encrypted and decrypted in.
+            */
+            inline size_t GetCryptoBufferSize() const
+            {
+                return m_cryptoBufferSize;
+            }
+
+            /**
+            * Sets the size of the blocks object bodies are encrypted and decrypted in, 64KB by default.
+            * Larger blocks mean fewer calls into the cipher per object, at the cost of two such buffers per request in flight.
+            */
+            inline void SetCryptoBufferSize(size_t cryptoBufferSize)
+            {
+                m_cryptoBufferSize = cryptoBufferSize;
+            }
+
+            /**
+            * Gets the executor ranged gets are decrypted on, null by default.
+            */
+            inline Aws::Utils::Threading::Executor* GetDecryptionExecutor() const
+            {
+                return m_decryptionExecutor;
+            }
+
+            /**
+            * Sets an executor to decrypt range gets of authenticated encryption objects on. Those are decrypted with AES-CTR, so each block
+            * of the body is split in parts that are decrypted in parallel, each part starting at its own counter. Gets of whole objects are still
+            * decrypted and authenticated as a single AES-GCM stream. Parts are at least 64KB, so the crypto buffer size should be a multiple
+            * of that for this to pay off. Not owned, it must outlive the clients using this configuration.
+            */
+            inline void SetDecryptionExecutor(Aws::Utils::Threading::Executor* decryptionExecutor)
+            {
+                m_decryptionExecutor = decryptionExecutor;
+            }
+
+            /**
+            * Gets how many threads at most decrypt the parts of a block, 0 meaning the number of cpu cores.
+            */
+            inline size_t GetDecryptionParallelism() const
+            {
+                return m_decryptionParallelism;
+            }
+
+            /**
+            * Sets how many threads at most decrypt the parts of a block on the decryption executor, including the calling one.
+            * 0, the default, is the number of cpu cores.
+            */
+            inline void SetDecryptionParallelism(size_t decryptionParallelism)
+            {
+                m_decryptionParallelism = decryptionParallelism;
+            }
+
+            /**
+            * Gets the executor parts of multipart puts are uploaded on, null by default.
+            */
+            inline Aws::Utils::Threading::Executor* GetUploadExecutor() const
+            {
+                return m_uploadExecutor;
+            }
+
+            /**
+            * Sets an executor to upload the parts of encrypted puts on. Puts of bodies larger than the upload part size then go to S3 as
+            * multipart uploads. AES-CBC and AES-GCM both chain through the whole object, so the body is still encrypted in order on the calling
+            * thread, but each part uploads on the executor while the next one is encrypted. Not owned, it must outlive the clients using this configuration.
+            */
+            inline void SetUploadExecutor(Aws::Utils::Threading::Executor* uploadExecutor)
+            {
+                m_uploadExecutor = uploadExecutor;
+            }
+
+            /**
+            * Gets the size of the parts of multipart puts.
+            */
+            inline size_t GetUploadPartSize() const
+            {
+                return m_uploadPartSize;
+            }
+
+            /**
+            * Sets the size of the parts of multipart puts, 8MB by default. S3 takes parts of 5MB or more, so smaller sizes are raised to that,
+            * and sizes are rounded up to whole AES blocks.
+            */
+            inline void SetUploadPartSize(size_t uploadPartSize)
+            {
+                m_uploadPartSize = uploadPartSize;
+            }
+
+            /**
+            * Gets how many encrypted parts of a multipart put are uploading at most at once.
+            */
+            inline size_t GetMaxUploadPartsInFlight() const
+            {
+                return m_maxUploadPartsInFlight;
+            }
+
+            /**
+            * Sets how many encrypted parts of a multipart put are uploading at most at once, 4 by default. Each of them holds a part sized buffer,
+            * and encryption waits for one to finish once there are that many.
+            */
+            inline void SetMaxUploadPartsInFlight(size_t maxUploadPartsInFlight)
+            {
+                m_maxUploadPartsInFlight = maxUploadPartsInFlight;
+            }
+
         private:
             StorageMethod m_storageMethod;
             CryptoMode m_cryptoMode;
+            size_t m_cryptoBufferSize;
+            Aws::Utils::Threading::Executor* m_decryptionExecutor;
+            size_t m_decryptionParallelism;
+            Aws::Utils::Threading::Executor* m_uploadExecutor;
+            size_t m_uploadPartSize;
+            size_t m_maxUploadPartsInFlight;
         };
     }
 }
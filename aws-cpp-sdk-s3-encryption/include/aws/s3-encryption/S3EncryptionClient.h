@@ -85,7 +85,8 @@ namespace Aws
             S3EncryptionClient& operator=(const S3EncryptionClient&) = delete;
 
             /*
-            * Function to put an object encrypted to S3.
+            * Function to put an object encrypted to S3. With an upload executor in the crypto configuration, bodies larger than its upload part size
+            * are put as multipart uploads, their parts uploading on the executor while the following ones are encrypted.
             */
             S3EncryptionPutObjectOutcome PutObject(const Aws::S3::Model::PutObjectRequest& request) const;
 
@@ -30,6 +30,10 @@
 #include <aws/s3/model/GetObjectResult.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/HeadObjectRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
 
 namespace Aws
 {
@@ -39,6 +43,10 @@ namespace Aws
         {
             typedef std::function <Aws::S3::Model::PutObjectOutcome(const Aws::S3::Model::PutObjectRequest&)> PutObjectFunction;
             typedef std::function <Aws::S3::Model::GetObjectOutcome(const Aws::S3::Model::GetObjectRequest&)> GetObjectFunction;
+            typedef std::function <Aws::S3::Model::CreateMultipartUploadOutcome(const Aws::S3::Model::CreateMultipartUploadRequest&)> CreateMultipartUploadFunction;
+            typedef std::function <Aws::S3::Model::UploadPartOutcome(const Aws::S3::Model::UploadPartRequest&)> UploadPartFunction;
+            typedef std::function <Aws::S3::Model::CompleteMultipartUploadOutcome(const Aws::S3::Model::CompleteMultipartUploadRequest&)> CompleteMultipartUploadFunction;
+            typedef std::function <Aws::S3::Model::AbortMultipartUploadOutcome(const Aws::S3::Model::AbortMultipartUploadRequest&)> AbortMultipartUploadFunction;
 
             class AWS_S3ENCRYPTION_API CryptoModule
             {
@@ -59,6 +67,16 @@ namespace Aws
                 */
                 S3EncryptionPutObjectOutcome PutObjectSecurely(const Aws::S3::Model::PutObjectRequest& request, const PutObjectFunction& putObjectFunction);
 
+                /*
+                * Function to put an encrypted object to S3 as a multipart upload, in parts of the upload part size of the crypto configuration.
+                * The body is encrypted in order on the calling thread, and each encrypted part is uploaded on the upload executor of the crypto configuration,
+                * or on the calling thread if there is none. The object stored is the same as the one PutObjectSecurely() stores, so it is read back the same way.
+                * The upload is aborted if any part fails. putObjectFunction is only used for the instruction file.
+                */
+                S3EncryptionPutObjectOutcome PutObjectSecurelyMultipart(const Aws::S3::Model::PutObjectRequest& request, const PutObjectFunction& putObjectFunction,
+                    const CreateMultipartUploadFunction& createMultipartUploadFunction, const UploadPartFunction& uploadPartFunction,
+                    const CompleteMultipartUploadFunction& completeMultipartUploadFunction, const AbortMultipartUploadFunction& abortMultipartUploadFunction);
+
                 /*
                 * Function to get an encrypted object from S3. This function takes a headObjectResult as well to collect metadata.
                 */
@@ -71,6 +89,11 @@ namespace Aws
                 static std::pair<int64_t, int64_t> ParseGetObjectRequestRange(const Aws::String& range, int64_t contentLength);
 
             private:
+                /*
+                * This function encrypts the content encryption key and stores the content crypto material in the metadata of the request or in an instruction file.
+                */
+                S3EncryptionPutObjectOutcome StoreContentCryptoMaterial(Aws::S3::Model::PutObjectRequest& request, const PutObjectFunction& putObjectFunction);
+
                 /*
                 * This function is used to encrypt the given S3 PutObjectRequest.
                 */
@@ -300,6 +323,45 @@ namespace Aws
                 std::shared_ptr<Aws::Utils::Crypto::SymmetricCipher> m_cipher;
             };
 
+            /**
+             * AES-CTR cipher that splits each buffer given to it in parts and transforms them in parallel on an executor, each part with its own
+             * cipher starting at the counter for its offset in the stream. Encryption and decryption are the same operation in CTR mode.
+             * Used to decrypt range gets of objects encrypted with AES-GCM, which is CTR mode from the counter after the one of the tag.
+             */
+            class AWS_S3ENCRYPTION_API AES_CTR_Parallel : public Aws::Utils::Crypto::SymmetricCipher
+            {
+            public:
+                /**
+                 * key, the content encryption key.
+                 * initialCounter, the counter block of the first byte of the stream.
+                 * executor, what the parts of a buffer are transformed on besides the calling thread, if not null. Not owned.
+                 * parallelism, how many threads at most transform the parts of a buffer, including the calling one. 0 is the number of cpu cores.
+                 */
+                AES_CTR_Parallel(const Aws::Utils::CryptoBuffer& key, const Aws::Utils::CryptoBuffer& initialCounter,
+                    Aws::Utils::Threading::Executor* executor, size_t parallelism = 0);
+                Aws::Utils::CryptoBuffer EncryptBuffer(const Aws::Utils::CryptoBuffer& unEncryptedData) override;
+                /**
+                 * Nothing is buffered in CTR mode, returns an empty buffer.
+                 */
+                Aws::Utils::CryptoBuffer FinalizeEncryption() override;
+                Aws::Utils::CryptoBuffer DecryptBuffer(const Aws::Utils::CryptoBuffer& encryptedData) override;
+                /**
+                 * Nothing is buffered in CTR mode, returns an empty buffer.
+                 */
+                Aws::Utils::CryptoBuffer FinalizeDecryption() override;
+                /**
+                 * Goes back to the start of the stream.
+                 */
+                void Reset() override;
+
+            private:
+                Aws::Utils::CryptoBuffer Transform(const Aws::Utils::CryptoBuffer& data);
+
+                Aws::Utils::Threading::Executor* m_executor;
+                size_t m_parallelism;
+                uint64_t m_streamOffset;
+            };
+
         }
     }
 }
@@ -18,24 +18,35 @@ namespace Aws
 {
     namespace S3Encryption
     {
+        static const size_t DEFAULT_CRYPTO_BUFFER_SIZE = 64 * 1024;
+        static const size_t DEFAULT_UPLOAD_PART_SIZE = 8 * 1024 * 1024;
+        static const size_t DEFAULT_MAX_UPLOAD_PARTS_IN_FLIGHT = 4;
 
         CryptoConfiguration::CryptoConfiguration() :
-            m_storageMethod(StorageMethod::METADATA), m_cryptoMode(CryptoMode::AUTHENTICATED_ENCRYPTION)
+            m_storageMethod(StorageMethod::METADATA), m_cryptoMode(CryptoMode::AUTHENTICATED_ENCRYPTION), m_cryptoBufferSize(DEFAULT_CRYPTO_BUFFER_SIZE),
+            m_decryptionExecutor(nullptr), m_decryptionParallelism(0), m_uploadExecutor(nullptr), m_uploadPartSize(DEFAULT_UPLOAD_PART_SIZE),
+            m_maxUploadPartsInFlight(DEFAULT_MAX_UPLOAD_PARTS_IN_FLIGHT)
         {
         }
 
         CryptoConfiguration::CryptoConfiguration(StorageMethod storageMethod) :
-            m_storageMethod(storageMethod), m_cryptoMode(CryptoMode::AUTHENTICATED_ENCRYPTION)
+            m_storageMethod(storageMethod), m_cryptoMode(CryptoMode::AUTHENTICATED_ENCRYPTION), m_cryptoBufferSize(DEFAULT_CRYPTO_BUFFER_SIZE),
+            m_decryptionExecutor(nullptr), m_decryptionParallelism(0), m_uploadExecutor(nullptr), m_uploadPartSize(DEFAULT_UPLOAD_PART_SIZE),
+            m_maxUploadPartsInFlight(DEFAULT_MAX_UPLOAD_PARTS_IN_FLIGHT)
         {
         }
 
         CryptoConfiguration::CryptoConfiguration(CryptoMode cryptoMode) :
-            m_storageMethod(StorageMethod::METADATA), m_cryptoMode(cryptoMode)
+            m_storageMethod(StorageMethod::METADATA), m_cryptoMode(cryptoMode), m_cryptoBufferSize(DEFAULT_CRYPTO_BUFFER_SIZE),
+            m_decryptionExecutor(nullptr), m_decryptionParallelism(0), m_uploadExecutor(nullptr), m_uploadPartSize(DEFAULT_UPLOAD_PART_SIZE),
+            m_maxUploadPartsInFlight(DEFAULT_MAX_UPLOAD_PARTS_IN_FLIGHT)
         {
         }
 
         CryptoConfiguration::CryptoConfiguration(StorageMethod storageMode, CryptoMode cryptoMode) :
-            m_storageMethod(storageMode), m_cryptoMode(cryptoMode)
+            m_storageMethod(storageMode), m_cryptoMode(cryptoMode), m_cryptoBufferSize(DEFAULT_CRYPTO_BUFFER_SIZE),
+            m_decryptionExecutor(nullptr), m_decryptionParallelism(0), m_uploadExecutor(nullptr), m_uploadPartSize(DEFAULT_UPLOAD_PART_SIZE),
+            m_maxUploadPartsInFlight(DEFAULT_MAX_UPLOAD_PARTS_IN_FLIGHT)
         {
         }
 
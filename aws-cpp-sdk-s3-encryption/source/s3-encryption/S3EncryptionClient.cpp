@@ -27,6 +27,14 @@ namespace Aws
         using namespace Aws::S3;
         using namespace Aws::S3::Model;
 
+        static uint64_t GetBodyLength(Aws::IOStream& body)
+        {
+            body.seekg(0, std::ios_base::end);
+            uint64_t bodyLength = static_cast<uint64_t>(body.tellg());
+            body.seekg(0, std::ios_base::beg);
+            return bodyLength;
+        }
+
         S3EncryptionClient::S3EncryptionClient(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const Aws::S3Encryption::CryptoConfiguration& cryptoConfig,
             const Client::ClientConfiguration& clientConfiguration) :
             m_s3Client(Aws::MakeUnique<S3Client>(ALLOCATION_TAG, clientConfiguration)), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
@@ -49,6 +57,14 @@ namespace Aws
         {
             auto module = m_cryptoModuleFactory.FetchCryptoModule(m_encryptionMaterials, m_cryptoConfig);
             auto putObjectFunction = [this](const Aws::S3::Model::PutObjectRequest& putRequest) { return m_s3Client->PutObject(putRequest); };
+            if (m_cryptoConfig.GetUploadExecutor() && request.GetBody() && GetBodyLength(*request.GetBody()) > m_cryptoConfig.GetUploadPartSize())
+            {
+                return module->PutObjectSecurelyMultipart(request, putObjectFunction,
+                    [this](const CreateMultipartUploadRequest& createRequest) { return m_s3Client->CreateMultipartUpload(createRequest); },
+                    [this](const UploadPartRequest& partRequest) { return m_s3Client->UploadPart(partRequest); },
+                    [this](const CompleteMultipartUploadRequest& completeRequest) { return m_s3Client->CompleteMultipartUpload(completeRequest); },
+                    [this](const AbortMultipartUploadRequest& abortRequest) { return m_s3Client->AbortMultipartUpload(abortRequest); });
+            }
             return module->PutObjectSecurely(request, putObjectFunction);
         }
 
@@ -16,10 +16,19 @@
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/crypto/CryptoStream.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/threading/Executor.h>
 #include <aws/core/client/AWSError.h>
 #include <aws/s3-encryption/S3EncryptionClient.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
 using namespace Aws::S3::Model;
 using namespace Aws::Utils;
 using namespace Aws::Utils::Crypto;
@@ -38,30 +47,319 @@ namespace Aws
             static const size_t TAG_SIZE_BYTES = 16u;
             static const size_t AES_BLOCK_SIZE = 16u;
             static const size_t BITS_IN_BYTE = 8u;
+            static const size_t MIN_CTR_PART_SIZE = 64u * 1024u;
+            static const size_t MIN_UPLOAD_PART_SIZE = 5u * 1024u * 1024u;
 
             CryptoModule::CryptoModule(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const CryptoConfiguration & cryptoConfig) :
                 m_encryptionMaterials(encryptionMaterials), m_contentCryptoMaterial(ContentCryptoMaterial()), m_cryptoConfig(cryptoConfig), m_cipher(nullptr)
             {
             }
 
+            namespace
+            {
+                /**
+                 * State shared between a multipart put and the uploads of its parts on the upload executor.
+                 */
+                struct MultipartPutJob
+                {
+                    MultipartPutJob(const UploadPartFunction& uploadPart, size_t maxParts) :
+                        uploadPartFunction(uploadPart), maxPartsInFlight(maxParts), partsInFlight(0), failed(false)
+                    {
+                    }
+
+                    //waits until fewer than maxPartsInFlight parts are uploading, false once the put failed.
+                    bool AcquirePartSlot()
+                    {
+                        std::unique_lock<std::mutex> locker(mutex);
+                        partDone.wait(locker, [this]() { return failed || partsInFlight < maxPartsInFlight; });
+                        if (failed)
+                        {
+                            return false;
+                        }
+                        ++partsInFlight;
+                        return true;
+                    }
+
+                    void UploadPart(const UploadPartRequest& partRequest)
+                    {
+                        auto outcome = uploadPartFunction(partRequest);
+                        std::lock_guard<std::mutex> locker(mutex);
+                        if (outcome.IsSuccess())
+                        {
+                            CompletedPart completedPart;
+                            completedPart.SetPartNumber(partRequest.GetPartNumber());
+                            completedPart.SetETag(outcome.GetResult().GetETag());
+                            completedParts[partRequest.GetPartNumber()] = completedPart;
+                        }
+                        else
+                        {
+                            AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Upload of part " << partRequest.GetPartNumber() << " not successful: "
+                                << outcome.GetError().GetExceptionName() << " : " << outcome.GetError().GetMessage());
+                            FailLocked(outcome.GetError());
+                        }
+                        --partsInFlight;
+                        partDone.notify_all();
+                    }
+
+                    void Fail(const AWSError<S3::S3Errors>& partError)
+                    {
+                        std::lock_guard<std::mutex> locker(mutex);
+                        FailLocked(partError);
+                        partDone.notify_all();
+                    }
+
+                    void WaitForParts()
+                    {
+                        std::unique_lock<std::mutex> locker(mutex);
+                        partDone.wait(locker, [this]() { return partsInFlight == 0; });
+                    }
+
+                    //keeps the first error, the one the put is reported to have failed with.
+                    void FailLocked(const AWSError<S3::S3Errors>& partError)
+                    {
+                        if (!failed)
+                        {
+                            failed = true;
+                            error = partError;
+                        }
+                    }
+
+                    UploadPartFunction uploadPartFunction;
+                    size_t maxPartsInFlight;
+                    size_t partsInFlight;
+                    bool failed;
+                    AWSError<S3::S3Errors> error;
+                    Aws::Map<int, CompletedPart> completedParts;
+                    std::mutex mutex;
+                    std::condition_variable partDone;
+                };
+
+                /**
+                 * Carries everything a put sets besides the body over to the multipart upload of the same object.
+                 */
+                CreateMultipartUploadRequest MakeCreateMultipartUploadRequest(const PutObjectRequest& request)
+                {
+                    CreateMultipartUploadRequest createRequest;
+                    createRequest.SetBucket(request.GetBucket());
+                    createRequest.SetKey(request.GetKey());
+                    createRequest.SetMetadata(request.GetMetadata());
+                    createRequest.SetCustomizedAccessLogTag(request.GetCustomizedAccessLogTag());
+                    if (request.GetACL() != ObjectCannedACL::NOT_SET) createRequest.SetACL(request.GetACL());
+                    if (!request.GetCacheControl().empty()) createRequest.SetCacheControl(request.GetCacheControl());
+                    if (!request.GetContentDisposition().empty()) createRequest.SetContentDisposition(request.GetContentDisposition());
+                    if (!request.GetContentEncoding().empty()) createRequest.SetContentEncoding(request.GetContentEncoding());
+                    if (!request.GetContentLanguage().empty()) createRequest.SetContentLanguage(request.GetContentLanguage());
+                    if (!request.GetContentType().empty()) createRequest.SetContentType(request.GetContentType());
+                    if (request.GetExpires().UnderlyingTimestamp() != std::chrono::system_clock::time_point()) createRequest.SetExpires(request.GetExpires());
+                    if (!request.GetGrantFullControl().empty()) createRequest.SetGrantFullControl(request.GetGrantFullControl());
+                    if (!request.GetGrantRead().empty()) createRequest.SetGrantRead(request.GetGrantRead());
+                    if (!request.GetGrantReadACP().empty()) createRequest.SetGrantReadACP(request.GetGrantReadACP());
+                    if (!request.GetGrantWriteACP().empty()) createRequest.SetGrantWriteACP(request.GetGrantWriteACP());
+                    if (request.GetServerSideEncryption() != ServerSideEncryption::NOT_SET) createRequest.SetServerSideEncryption(request.GetServerSideEncryption());
+                    if (request.GetStorageClass() != StorageClass::NOT_SET) createRequest.SetStorageClass(request.GetStorageClass());
+                    if (!request.GetWebsiteRedirectLocation().empty()) createRequest.SetWebsiteRedirectLocation(request.GetWebsiteRedirectLocation());
+                    if (!request.GetSSECustomerAlgorithm().empty()) createRequest.SetSSECustomerAlgorithm(request.GetSSECustomerAlgorithm());
+                    if (!request.GetSSECustomerKey().empty()) createRequest.SetSSECustomerKey(request.GetSSECustomerKey());
+                    if (!request.GetSSECustomerKeyMD5().empty()) createRequest.SetSSECustomerKeyMD5(request.GetSSECustomerKeyMD5());
+                    if (!request.GetSSEKMSKeyId().empty()) createRequest.SetSSEKMSKeyId(request.GetSSEKMSKeyId());
+                    if (request.GetRequestPayer() != RequestPayer::NOT_SET) createRequest.SetRequestPayer(request.GetRequestPayer());
+                    if (!request.GetTagging().empty()) createRequest.SetTagging(request.GetTagging());
+                    if (request.GetObjectLockMode() != ObjectLockMode::NOT_SET) createRequest.SetObjectLockMode(request.GetObjectLockMode());
+                    if (request.GetObjectLockRetainUntilDate().UnderlyingTimestamp() != std::chrono::system_clock::time_point())
+                    {
+                        createRequest.SetObjectLockRetainUntilDate(request.GetObjectLockRetainUntilDate());
+                    }
+                    if (request.GetObjectLockLegalHoldStatus() != ObjectLockLegalHoldStatus::NOT_SET)
+                    {
+                        createRequest.SetObjectLockLegalHoldStatus(request.GetObjectLockLegalHoldStatus());
+                    }
+                    return createRequest;
+                }
+            }
+
             S3EncryptionPutObjectOutcome CryptoModule::PutObjectSecurely(const Aws::S3::Model::PutObjectRequest& request, const PutObjectFunction& putObjectFunction)
             {
                 PutObjectRequest copyRequest(request);
                 PopulateCryptoContentMaterial();
                 InitEncryptionCipher();
                 SetContentLength(copyRequest);
+                auto storeOutcome = StoreContentCryptoMaterial(copyRequest, putObjectFunction);
+                if (!storeOutcome.IsSuccess())
+                {
+                    return storeOutcome;
+                }
+                return WrapAndMakeRequestWithCipher(copyRequest, putObjectFunction);
+            }
+
+            S3EncryptionPutObjectOutcome CryptoModule::PutObjectSecurelyMultipart(const Aws::S3::Model::PutObjectRequest& request, const PutObjectFunction& putObjectFunction,
+                const CreateMultipartUploadFunction& createMultipartUploadFunction, const UploadPartFunction& uploadPartFunction,
+                const CompleteMultipartUploadFunction& completeMultipartUploadFunction, const AbortMultipartUploadFunction& abortMultipartUploadFunction)
+            {
+                PutObjectRequest copyRequest(request);
+                PopulateCryptoContentMaterial();
+                InitEncryptionCipher();
+                auto storeOutcome = StoreContentCryptoMaterial(copyRequest, putObjectFunction);
+                if (!storeOutcome.IsSuccess())
+                {
+                    return storeOutcome;
+                }
+
+                CreateMultipartUploadOutcome createOutcome = createMultipartUploadFunction(MakeCreateMultipartUploadRequest(copyRequest));
+                if (!createOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 create multipart upload operation not successful: "
+                        << createOutcome.GetError().GetExceptionName() << " : "
+                        << createOutcome.GetError().GetMessage());
+                    return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(createOutcome.GetError()));
+                }
+                const Aws::String uploadId = createOutcome.GetResult().GetUploadId();
+
+                std::shared_ptr<Aws::IOStream> body = copyRequest.GetBody();
+                body->seekg(0, std::ios_base::end);
+                uint64_t bodyLength = static_cast<uint64_t>(body->tellg());
+                body->seekg(0, std::ios_base::beg);
+                //every part but the last one ends on an AES block, so the cipher hands back all of it.
+                size_t partSize = (std::max)(m_cryptoConfig.GetUploadPartSize(), MIN_UPLOAD_PART_SIZE);
+                partSize = (partSize + AES_BLOCK_SIZE - 1) / AES_BLOCK_SIZE * AES_BLOCK_SIZE;
+
+                auto job = Aws::MakeShared<MultipartPutJob>(ALLOCATION_TAG, uploadPartFunction, (std::max)(size_t(1), m_cryptoConfig.GetMaxUploadPartsInFlight()));
+                auto executor = m_cryptoConfig.GetUploadExecutor();
+                //parts go through the cipher in blocks of the crypto buffer size, which stay in cache, rather than whole.
+                size_t blockSize = (std::max)(AES_BLOCK_SIZE, m_cryptoConfig.GetCryptoBufferSize() / AES_BLOCK_SIZE * AES_BLOCK_SIZE);
+                CryptoBuffer plaintext(blockSize);
+                uint64_t bytesEncrypted = 0;
+                //the next part is encrypted while the ones before it upload, then waits for a slot.
+                for (int partNumber = 1; ; ++partNumber)
+                {
+                    size_t length = static_cast<size_t>((std::min)(static_cast<uint64_t>(partSize), bodyLength - bytesEncrypted));
+                    bool lastPart = bytesEncrypted + length == bodyLength;
+                    //room for the padding or the tag the last part ends with.
+                    auto ciphertext = Aws::MakeShared<CryptoBuffer>(ALLOCATION_TAG, length + 2 * AES_BLOCK_SIZE);
+                    size_t ciphertextLength = 0;
+                    auto append = [&ciphertext, &ciphertextLength](const CryptoBuffer& encrypted)
+                    {
+                        if (ciphertextLength + encrypted.GetLength() > ciphertext->GetLength())
+                        {
+                            return false;
+                        }
+                        if (encrypted.GetLength() == 0)
+                        {
+                            return true;
+                        }
+                        memcpy(ciphertext->GetUnderlyingData() + ciphertextLength, encrypted.GetUnderlyingData(), encrypted.GetLength());
+                        ciphertextLength += encrypted.GetLength();
+                        return true;
+                    };
+
+                    bool encrypted = true;
+                    for (size_t partOffset = 0; encrypted && partOffset < length; partOffset += blockSize)
+                    {
+                        size_t blockLength = (std::min)(blockSize, length - partOffset);
+                        body->read(reinterpret_cast<char*>(plaintext.GetUnderlyingData()), blockLength);
+                        encrypted = static_cast<size_t>(body->gcount()) == blockLength &&
+                            append(blockLength == blockSize ? m_cipher->EncryptBuffer(plaintext) : m_cipher->EncryptBuffer(CryptoBuffer(plaintext.GetUnderlyingData(), blockLength)));
+                    }
+                    if (encrypted && lastPart)
+                    {
+                        encrypted = append(m_cipher->FinalizeEncryption());
+                    }
+                    bytesEncrypted += length;
+                    if (!encrypted || !*m_cipher)
+                    {
+                        job->Fail(AWSError<S3::S3Errors>(S3::S3Errors::INTERNAL_FAILURE, "EncryptPartFailed",
+                            "Failed to read and encrypt part " + StringUtils::to_string(partNumber) + " of the body", false));
+                        break;
+                    }
+                    if (!job->AcquirePartSlot())
+                    {
+                        break;
+                    }
+
+                    UploadPartRequest partRequest;
+                    partRequest.WithBucket(copyRequest.GetBucket())
+                        .WithKey(copyRequest.GetKey())
+                        .WithUploadId(uploadId)
+                        .WithPartNumber(partNumber)
+                        .WithContentLength(static_cast<long long>(ciphertextLength));
+                    partRequest.SetCustomizedAccessLogTag(copyRequest.GetCustomizedAccessLogTag());
+                    if (!copyRequest.GetSSECustomerAlgorithm().empty()) partRequest.SetSSECustomerAlgorithm(copyRequest.GetSSECustomerAlgorithm());
+                    if (!copyRequest.GetSSECustomerKey().empty()) partRequest.SetSSECustomerKey(copyRequest.GetSSECustomerKey());
+                    if (!copyRequest.GetSSECustomerKeyMD5().empty()) partRequest.SetSSECustomerKeyMD5(copyRequest.GetSSECustomerKeyMD5());
+                    if (copyRequest.GetRequestPayer() != RequestPayer::NOT_SET) partRequest.SetRequestPayer(copyRequest.GetRequestPayer());
+                    auto streamBuf = Aws::MakeShared<Aws::Utils::Stream::PreallocatedStreamBuf>(ALLOCATION_TAG, ciphertext.get(), ciphertextLength);
+                    partRequest.SetBody(Aws::MakeShared<Aws::IOStream>(ALLOCATION_TAG, streamBuf.get()));
+
+                    //the part request streams straight out of ciphertext, which lives as long as the task.
+                    auto uploadPart = [job, partRequest, ciphertext, streamBuf]() { job->UploadPart(partRequest); };
+                    if (!executor || !executor->Submit(uploadPart))
+                    {
+                        uploadPart();
+                    }
+                    if (lastPart)
+                    {
+                        break;
+                    }
+                }
+                job->WaitForParts();
+
+                if (job->failed)
+                {
+                    AbortMultipartUploadRequest abortRequest;
+                    abortRequest.WithBucket(copyRequest.GetBucket()).WithKey(copyRequest.GetKey()).WithUploadId(uploadId);
+                    if (copyRequest.GetRequestPayer() != RequestPayer::NOT_SET) abortRequest.SetRequestPayer(copyRequest.GetRequestPayer());
+                    AbortMultipartUploadOutcome abortOutcome = abortMultipartUploadFunction(abortRequest);
+                    if (!abortOutcome.IsSuccess())
+                    {
+                        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 abort multipart upload operation not successful for upload " << uploadId << ": "
+                            << abortOutcome.GetError().GetExceptionName() << " : "
+                            << abortOutcome.GetError().GetMessage());
+                    }
+                    return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(job->error));
+                }
+
+                CompletedMultipartUpload completedUpload;
+                for (const auto& completedPart : job->completedParts)
+                {
+                    completedUpload.AddParts(completedPart.second);
+                }
+                CompleteMultipartUploadRequest completeRequest;
+                completeRequest.WithBucket(copyRequest.GetBucket()).WithKey(copyRequest.GetKey()).WithUploadId(uploadId).WithMultipartUpload(completedUpload);
+                completeRequest.SetCustomizedAccessLogTag(copyRequest.GetCustomizedAccessLogTag());
+                if (copyRequest.GetRequestPayer() != RequestPayer::NOT_SET) completeRequest.SetRequestPayer(copyRequest.GetRequestPayer());
+                CompleteMultipartUploadOutcome completeOutcome = completeMultipartUploadFunction(completeRequest);
+                if (!completeOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 complete multipart upload operation not successful: "
+                        << completeOutcome.GetError().GetExceptionName() << " : "
+                        << completeOutcome.GetError().GetMessage());
+                    return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(completeOutcome.GetError()));
+                }
+
+                const CompleteMultipartUploadResult& completeResult = completeOutcome.GetResult();
+                PutObjectResult putResult;
+                putResult.SetETag(completeResult.GetETag());
+                putResult.SetExpiration(completeResult.GetExpiration());
+                putResult.SetVersionId(completeResult.GetVersionId());
+                putResult.SetServerSideEncryption(completeResult.GetServerSideEncryption());
+                putResult.SetSSEKMSKeyId(completeResult.GetSSEKMSKeyId());
+                putResult.SetRequestCharged(completeResult.GetRequestCharged());
+                return S3EncryptionPutObjectOutcome(std::move(putResult));
+            }
+
+            S3EncryptionPutObjectOutcome CryptoModule::StoreContentCryptoMaterial(Aws::S3::Model::PutObjectRequest& request, const PutObjectFunction& putObjectFunction)
+            {
                 auto encryptOutcome = m_encryptionMaterials->EncryptCEK(m_contentCryptoMaterial);
                 if (!encryptOutcome.IsSuccess())
                 {
                     return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(encryptOutcome.GetError()));
                 }
-                
+
                 if (m_cryptoConfig.GetStorageMethod() == StorageMethod::INSTRUCTION_FILE)
                 {
                     Handlers::InstructionFileHandler handler;
                     PutObjectRequest instructionFileRequest;
-                    instructionFileRequest.WithBucket(copyRequest.GetBucket());
-                    instructionFileRequest.WithKey(copyRequest.GetKey());
+                    instructionFileRequest.WithBucket(request.GetBucket());
+                    instructionFileRequest.WithKey(request.GetKey());
                     handler.PopulateRequest(instructionFileRequest, m_contentCryptoMaterial);
                     PutObjectOutcome instructionOutcome = putObjectFunction(instructionFileRequest);
                     if (!instructionOutcome.IsSuccess())
@@ -75,9 +373,9 @@ namespace Aws
                 else
                 {
                     Handlers::MetadataHandler handler;
-                    handler.PopulateRequest(copyRequest, m_contentCryptoMaterial);
+                    handler.PopulateRequest(request, m_contentCryptoMaterial);
                 }
-                return WrapAndMakeRequestWithCipher(copyRequest, putObjectFunction);
+                return S3EncryptionPutObjectOutcome(PutObjectResult());
             }
 
             S3EncryptionGetObjectOutcome CryptoModule::GetObjectSecurely(const Aws::S3::Model::GetObjectRequest& request,
@@ -120,7 +418,8 @@ namespace Aws
             S3EncryptionPutObjectOutcome CryptoModule::WrapAndMakeRequestWithCipher(Aws::S3::Model::PutObjectRequest & request, const PutObjectFunction& putObjectFunction)
             {
                 std::shared_ptr<Aws::IOStream> iostream = request.GetBody();
-                request.SetBody(Aws::MakeShared<Aws::Utils::Crypto::SymmetricCryptoStream>(ALLOCATION_TAG, (Aws::IStream&)*iostream, CipherMode::Encrypt, (*m_cipher)));
+                request.SetBody(Aws::MakeShared<Aws::Utils::Crypto::SymmetricCryptoStream>(ALLOCATION_TAG, (Aws::IStream&)*iostream, CipherMode::Encrypt, (*m_cipher),
+                    m_cryptoConfig.GetCryptoBufferSize()));
                 iostream->clear();
                 iostream->seekg(0, std::ios_base::beg);
 
@@ -142,7 +441,7 @@ namespace Aws
                 auto userSuppliedStream = userSuppliedStreamFactory();
 
                 request.SetResponseStreamFactory(
-                    [&] { return Aws::New<SymmetricCryptoStream>(ALLOCATION_TAG, (Aws::OStream&)*userSuppliedStream, CipherMode::Decrypt, *m_cipher, DEFAULT_BUF_SIZE, firstBlockOffset); }
+                    [&] { return Aws::New<SymmetricCryptoStream>(ALLOCATION_TAG, (Aws::OStream&)*userSuppliedStream, CipherMode::Decrypt, *m_cipher, m_cryptoConfig.GetCryptoBufferSize(), firstBlockOffset); }
                 );
                 GetObjectOutcome outcome = getObjectFunction(request);
                 if (!outcome.IsSuccess())
@@ -300,8 +599,16 @@ namespace Aws
                     //start at 0x01, but that is for the Hash, this message should begin at 0x02
                     counter[3] = 0x02;
                     CryptoBuffer gcmToCtrIv({ (ByteBuffer*)&m_contentCryptoMaterial.GetIV(), (ByteBuffer*)&counter });
-                    m_cipher = CreateAES_CTRImplementation(m_contentCryptoMaterial.GetContentEncryptionKey(),
-                        IncrementCTRCounter(gcmToCtrIv, static_cast<int32_t>(rangeStart / static_cast<int64_t>(AES_BLOCK_SIZE))));
+                    CryptoBuffer rangeStartCounter = IncrementCTRCounter(gcmToCtrIv, static_cast<int32_t>(rangeStart / static_cast<int64_t>(AES_BLOCK_SIZE)));
+                    if (m_cryptoConfig.GetDecryptionExecutor())
+                    {
+                        m_cipher = Aws::MakeShared<AES_CTR_Parallel>(ALLOCATION_TAG, m_contentCryptoMaterial.GetContentEncryptionKey(), rangeStartCounter,
+                            m_cryptoConfig.GetDecryptionExecutor(), m_cryptoConfig.GetDecryptionParallelism());
+                    }
+                    else
+                    {
+                        m_cipher = CreateAES_CTRImplementation(m_contentCryptoMaterial.GetContentEncryptionKey(), rangeStartCounter);
+                    }
                 }
                 else
                 {
@@ -507,6 +814,148 @@ namespace Aws
                 m_failure = false;
             }
 
+            namespace
+            {
+                /**
+                 * The parts of one buffer given to AES_CTR_Parallel. Shared with the executor tasks, a task that only starts once all the parts
+                 * are taken finds nothing to do, so the caller only waits for parts and the buffers aren't touched once Transform() returns.
+                 */
+                struct CTRPartsJob
+                {
+                    CTRPartsJob(const CryptoBuffer& cipherKey, const CryptoBuffer& counter, uint64_t offset, const CryptoBuffer& inputData,
+                        CryptoBuffer& outputData, size_t partLength) :
+                        key(cipherKey), initialCounter(counter), streamOffset(offset), input(inputData), output(outputData),
+                        partSize(partLength), partCount((inputData.GetLength() + partLength - 1) / partLength), nextPart(0), finishedParts(0), failed(false)
+                    {
+                    }
+
+                    void TransformParts()
+                    {
+                        size_t part;
+                        while ((part = nextPart.fetch_add(1)) < partCount)
+                        {
+                            size_t partOffset = part * partSize;
+                            bool partFailed = !TransformPart(partOffset, (std::min)(partSize, input.GetLength() - partOffset));
+
+                            std::lock_guard<std::mutex> locker(mutex);
+                            failed = failed || partFailed;
+                            if (++finishedParts == partCount)
+                            {
+                                done.notify_all();
+                            }
+                        }
+                    }
+
+                    bool TransformPart(size_t partOffset, size_t length)
+                    {
+                        uint64_t offset = streamOffset + partOffset;
+                        auto cipher = CreateAES_CTRImplementation(key, IncrementCTRCounter(initialCounter, static_cast<uint32_t>(offset / AES_BLOCK_SIZE)));
+                        if (!cipher)
+                        {
+                            return false;
+                        }
+                        //a part starting mid block discards the key stream of the block that comes before it.
+                        size_t blockOffset = static_cast<size_t>(offset % AES_BLOCK_SIZE);
+                        if (blockOffset > 0)
+                        {
+                            cipher->EncryptBuffer(CryptoBuffer(blockOffset));
+                        }
+
+                        auto partOutput = cipher->EncryptBuffer(CryptoBuffer(input.GetUnderlyingData() + partOffset, length));
+                        if (!*cipher || partOutput.GetLength() != length)
+                        {
+                            return false;
+                        }
+                        memcpy(output.GetUnderlyingData() + partOffset, partOutput.GetUnderlyingData(), length);
+                        return true;
+                    }
+
+                    CryptoBuffer key;
+                    CryptoBuffer initialCounter;
+                    uint64_t streamOffset;
+                    const CryptoBuffer& input;
+                    CryptoBuffer& output;
+                    size_t partSize;
+                    size_t partCount;
+                    std::atomic<size_t> nextPart;
+                    size_t finishedParts;
+                    bool failed;
+                    std::mutex mutex;
+                    std::condition_variable done;
+                };
+            }
+
+            AES_CTR_Parallel::AES_CTR_Parallel(const CryptoBuffer& key, const CryptoBuffer& initialCounter, Aws::Utils::Threading::Executor* executor,
+                size_t parallelism) : Aws::Utils::Crypto::SymmetricCipher(), m_executor(executor),
+                m_parallelism(parallelism > 0 ? parallelism : (std::max)(1u, std::thread::hardware_concurrency())), m_streamOffset(0)
+            {
+                m_key = key;
+                m_initializationVector = initialCounter;
+            }
+
+            CryptoBuffer AES_CTR_Parallel::EncryptBuffer(const CryptoBuffer& unEncryptedData)
+            {
+                return Transform(unEncryptedData);
+            }
+
+            CryptoBuffer AES_CTR_Parallel::FinalizeEncryption()
+            {
+                return CryptoBuffer();
+            }
+
+            CryptoBuffer AES_CTR_Parallel::DecryptBuffer(const CryptoBuffer& encryptedData)
+            {
+                return Transform(encryptedData);
+            }
+
+            CryptoBuffer AES_CTR_Parallel::FinalizeDecryption()
+            {
+                return CryptoBuffer();
+            }
+
+            void AES_CTR_Parallel::Reset()
+            {
+                m_streamOffset = 0;
+                m_failure = false;
+            }
+
+            CryptoBuffer AES_CTR_Parallel::Transform(const CryptoBuffer& data)
+            {
+                if (m_failure || data.GetLength() == 0)
+                {
+                    return CryptoBuffer();
+                }
+
+                //parts are whole blocks, and large enough for setting up their cipher to be noise.
+                size_t partCount = m_executor ? (std::max)(size_t(1), (std::min)(m_parallelism, data.GetLength() / MIN_CTR_PART_SIZE)) : 1;
+                size_t partSize = (data.GetLength() + partCount - 1) / partCount;
+                partSize = (partSize + AES_BLOCK_SIZE - 1) / AES_BLOCK_SIZE * AES_BLOCK_SIZE;
+
+                CryptoBuffer output(data.GetLength());
+                auto job = Aws::MakeShared<CTRPartsJob>(ALLOCATION_TAG, m_key, m_initializationVector, m_streamOffset, data, output, partSize);
+                for (size_t i = 1; i < job->partCount; ++i)
+                {
+                    if (!m_executor->Submit([job]() { job->TransformParts(); }))
+                    {
+                        break;
+                    }
+                }
+
+                //the calling thread transforms parts too, so this makes progress even if the executor is busy.
+                job->TransformParts();
+                std::unique_lock<std::mutex> locker(job->mutex);
+                job->done.wait(locker, [&job]() { return job->finishedParts == job->partCount; });
+                if (job->failed)
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Failed to transform " << data.GetLength() << " bytes at offset " << m_streamOffset << " with AES-CTR");
+                    m_failure = true;
+                    return CryptoBuffer();
+                }
+
+                m_streamOffset += data.GetLength();
+                return output;
+            }
+
         }
     }
 }
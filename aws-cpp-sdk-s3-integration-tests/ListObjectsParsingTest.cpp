@@ -0,0 +1,120 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/s3/S3Client.h>
+#include <aws/s3/model/ListObjectsRequest.h>
+#include <aws/s3/model/ListObjectsV2Request.h>
+#include <aws/testing/mocks/http/MockHttpClient.h>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::S3;
+using namespace Aws::S3::Model;
+
+namespace
+{
+    static const char* ALLOCATION_TAG = "ListObjectsParsingTest";
+    static const char* LIST_OBJECTS_RESPONSE = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\"><Name>bucket</Name><Prefix></Prefix>"
+        "<IsTruncated>false</IsTruncated><Contents><Key>first</Key><Size>1</Size></Contents>"
+        "<Contents><Key>second</Key><Size>2</Size></Contents></ListBucketResult>";
+
+    class ListObjectsParsingTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            ClientConfiguration config;
+            config.scheme = Scheme::HTTP;
+            config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(ALLOCATION_TAG, 0);
+
+            mockHttpClient = Aws::MakeShared<MockHttpClient>(ALLOCATION_TAG);
+            mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(ALLOCATION_TAG);
+            mockHttpClientFactory->SetClient(mockHttpClient);
+            SetHttpClientFactory(mockHttpClientFactory);
+            s3Client = Aws::MakeShared<S3Client>(ALLOCATION_TAG,
+                                                 Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "akid", "secret"),
+                                                 config);
+        }
+
+        void TearDown() override
+        {
+            s3Client = nullptr;
+            mockHttpClient = nullptr;
+            mockHttpClientFactory = nullptr;
+
+            // We override the global http factory in SetUp(), so reset back to the default state as we leave this test suite.
+            CleanupHttp();
+            InitHttp();
+        }
+
+        void AddResponseToReturn(const Aws::String& body)
+        {
+            std::shared_ptr<HttpRequest> request =
+                mockHttpClientFactory->CreateHttpRequest(URI("www.uri.com"), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            std::shared_ptr<StandardHttpResponse> response = Aws::MakeShared<StandardHttpResponse>(ALLOCATION_TAG, *request);
+            response->SetResponseCode(HttpResponseCode::OK);
+            response->GetResponseBody() << body;
+            mockHttpClient->AddResponseToReturn(response);
+        }
+
+        std::shared_ptr<S3Client> s3Client;
+        std::shared_ptr<MockHttpClient> mockHttpClient;
+        std::shared_ptr<MockHttpClientFactory> mockHttpClientFactory;
+    };
+
+    TEST_F(ListObjectsParsingTest, TestListObjectsReadsContentsFromResponseStream)
+    {
+        AddResponseToReturn(LIST_OBJECTS_RESPONSE);
+
+        auto outcome = s3Client->ListObjects(ListObjectsRequest().WithBucket("bucket"));
+
+        ASSERT_TRUE(outcome.IsSuccess());
+        ASSERT_EQ(2u, outcome.GetResult().GetContents().size());
+        ASSERT_EQ("second", outcome.GetResult().GetContents()[1].GetKey());
+        ASSERT_EQ(2, outcome.GetResult().GetContents()[1].GetSize());
+    }
+
+    TEST_F(ListObjectsParsingTest, TestTruncatedListObjectsResponseIsParseError)
+    {
+        Aws::String truncated(LIST_OBJECTS_RESPONSE);
+        AddResponseToReturn(truncated.substr(0, truncated.size() / 2));
+
+        auto outcome = s3Client->ListObjects(ListObjectsRequest().WithBucket("bucket"));
+
+        ASSERT_FALSE(outcome.IsSuccess());
+        ASSERT_EQ(S3Errors::UNKNOWN, outcome.GetError().GetErrorType());
+        ASSERT_EQ("Xml Parse Error", outcome.GetError().GetExceptionName());
+        ASSERT_FALSE(outcome.GetError().GetMessage().empty());
+        ASSERT_FALSE(outcome.GetError().ShouldRetry());
+    }
+
+    TEST_F(ListObjectsParsingTest, TestMalformedListObjectsV2ResponseIsParseError)
+    {
+        AddResponseToReturn("<ListBucketResult><Contents><Key>first</Size></Contents></ListBucketResult>");
+
+        auto outcome = s3Client->ListObjectsV2(ListObjectsV2Request().WithBucket("bucket"));
+
+        ASSERT_FALSE(outcome.IsSuccess());
+        ASSERT_EQ("Xml Parse Error", outcome.GetError().GetExceptionName());
+    }
+}
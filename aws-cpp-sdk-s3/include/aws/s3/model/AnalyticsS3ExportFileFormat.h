@@ -34,6 +34,11 @@ namespace AnalyticsS3ExportFileFormatMapper
 AWS_S3_API AnalyticsS3ExportFileFormat GetAnalyticsS3ExportFileFormatForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForAnalyticsS3ExportFileFormat(AnalyticsS3ExportFileFormat value);
+
+/**
+ * Same as GetNameForAnalyticsS3ExportFileFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForAnalyticsS3ExportFileFormatCStr(AnalyticsS3ExportFileFormat value);
 } // namespace AnalyticsS3ExportFileFormatMapper
 } // namespace Model
 } // namespace S3
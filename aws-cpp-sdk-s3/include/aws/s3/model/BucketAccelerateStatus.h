@@ -35,6 +35,11 @@ namespace BucketAccelerateStatusMapper
 AWS_S3_API BucketAccelerateStatus GetBucketAccelerateStatusForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForBucketAccelerateStatus(BucketAccelerateStatus value);
+
+/**
+ * Same as GetNameForBucketAccelerateStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForBucketAccelerateStatusCStr(BucketAccelerateStatus value);
 } // namespace BucketAccelerateStatusMapper
 } // namespace Model
 } // namespace S3
@@ -37,6 +37,11 @@ namespace BucketCannedACLMapper
 AWS_S3_API BucketCannedACL GetBucketCannedACLForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForBucketCannedACL(BucketCannedACL value);
+
+/**
+ * Same as GetNameForBucketCannedACL(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForBucketCannedACLCStr(BucketCannedACL value);
 } // namespace BucketCannedACLMapper
 } // namespace Model
 } // namespace S3
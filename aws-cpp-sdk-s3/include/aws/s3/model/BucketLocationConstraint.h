@@ -52,6 +52,11 @@ namespace BucketLocationConstraintMapper
 AWS_S3_API BucketLocationConstraint GetBucketLocationConstraintForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForBucketLocationConstraint(BucketLocationConstraint value);
+
+/**
+ * Same as GetNameForBucketLocationConstraint(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForBucketLocationConstraintCStr(BucketLocationConstraint value);
 } // namespace BucketLocationConstraintMapper
 } // namespace Model
 } // namespace S3
@@ -36,6 +36,11 @@ namespace BucketLogsPermissionMapper
 AWS_S3_API BucketLogsPermission GetBucketLogsPermissionForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForBucketLogsPermission(BucketLogsPermission value);
+
+/**
+ * Same as GetNameForBucketLogsPermission(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForBucketLogsPermissionCStr(BucketLogsPermission value);
 } // namespace BucketLogsPermissionMapper
 } // namespace Model
 } // namespace S3
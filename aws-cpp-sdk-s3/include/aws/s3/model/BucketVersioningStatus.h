@@ -35,6 +35,11 @@ namespace BucketVersioningStatusMapper
 AWS_S3_API BucketVersioningStatus GetBucketVersioningStatusForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForBucketVersioningStatus(BucketVersioningStatus value);
+
+/**
+ * Same as GetNameForBucketVersioningStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForBucketVersioningStatusCStr(BucketVersioningStatus value);
 } // namespace BucketVersioningStatusMapper
 } // namespace Model
 } // namespace S3
@@ -36,6 +36,11 @@ namespace CompressionTypeMapper
 AWS_S3_API CompressionType GetCompressionTypeForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForCompressionType(CompressionType value);
+
+/**
+ * Same as GetNameForCompressionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForCompressionTypeCStr(CompressionType value);
 } // namespace CompressionTypeMapper
 } // namespace Model
 } // namespace S3
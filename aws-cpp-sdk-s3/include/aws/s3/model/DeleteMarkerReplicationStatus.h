@@ -35,6 +35,11 @@ namespace DeleteMarkerReplicationStatusMapper
 AWS_S3_API DeleteMarkerReplicationStatus GetDeleteMarkerReplicationStatusForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForDeleteMarkerReplicationStatus(DeleteMarkerReplicationStatus value);
+
+/**
+ * Same as GetNameForDeleteMarkerReplicationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForDeleteMarkerReplicationStatusCStr(DeleteMarkerReplicationStatus value);
 } // namespace DeleteMarkerReplicationStatusMapper
 } // namespace Model
 } // namespace S3
@@ -34,6 +34,11 @@ namespace EncodingTypeMapper
 AWS_S3_API EncodingType GetEncodingTypeForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForEncodingType(EncodingType value);
+
+/**
+ * Same as GetNameForEncodingType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForEncodingTypeCStr(EncodingType value);
 } // namespace EncodingTypeMapper
 } // namespace Model
 } // namespace S3
@@ -44,6 +44,11 @@ namespace EventMapper
 AWS_S3_API Event GetEventForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForEvent(Event value);
+
+/**
+ * Same as GetNameForEvent(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForEventCStr(Event value);
 } // namespace EventMapper
 } // namespace Model
 } // namespace S3
@@ -35,6 +35,11 @@ namespace ExpirationStatusMapper
 AWS_S3_API ExpirationStatus GetExpirationStatusForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForExpirationStatus(ExpirationStatus value);
+
+/**
+ * Same as GetNameForExpirationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForExpirationStatusCStr(ExpirationStatus value);
 } // namespace ExpirationStatusMapper
 } // namespace Model
 } // namespace S3
@@ -35,6 +35,11 @@ namespace FilterRuleNameMapper
 AWS_S3_API FilterRuleName GetFilterRuleNameForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForFilterRuleName(FilterRuleName value);
+
+/**
+ * Same as GetNameForFilterRuleName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForFilterRuleNameCStr(FilterRuleName value);
 } // namespace FilterRuleNameMapper
 } // namespace Model
 } // namespace S3
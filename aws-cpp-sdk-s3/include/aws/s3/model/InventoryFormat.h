@@ -36,6 +36,11 @@ namespace InventoryFormatMapper
 AWS_S3_API InventoryFormat GetInventoryFormatForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForInventoryFormat(InventoryFormat value);
+
+/**
+ * Same as GetNameForInventoryFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForInventoryFormatCStr(InventoryFormat value);
 } // namespace InventoryFormatMapper
 } // namespace Model
 } // namespace S3
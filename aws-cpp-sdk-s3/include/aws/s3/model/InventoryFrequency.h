@@ -35,6 +35,11 @@ namespace InventoryFrequencyMapper
 AWS_S3_API InventoryFrequency GetInventoryFrequencyForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForInventoryFrequency(InventoryFrequency value);
+
+/**
+ * Same as GetNameForInventoryFrequency(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForInventoryFrequencyCStr(InventoryFrequency value);
 } // namespace InventoryFrequencyMapper
 } // namespace Model
 } // namespace S3
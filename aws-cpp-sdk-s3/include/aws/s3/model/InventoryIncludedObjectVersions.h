@@ -35,6 +35,11 @@ namespace InventoryIncludedObjectVersionsMapper
 AWS_S3_API InventoryIncludedObjectVersions GetInventoryIncludedObjectVersionsForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForInventoryIncludedObjectVersions(InventoryIncludedObjectVersions value);
+
+/**
+ * Same as GetNameForInventoryIncludedObjectVersions(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForInventoryIncludedObjectVersionsCStr(InventoryIncludedObjectVersions value);
 } // namespace InventoryIncludedObjectVersionsMapper
 } // namespace Model
 } // namespace S3
@@ -43,6 +43,11 @@ namespace InventoryOptionalFieldMapper
 AWS_S3_API InventoryOptionalField GetInventoryOptionalFieldForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForInventoryOptionalField(InventoryOptionalField value);
+
+/**
+ * Same as GetNameForInventoryOptionalField(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForInventoryOptionalFieldCStr(InventoryOptionalField value);
 } // namespace InventoryOptionalFieldMapper
 } // namespace Model
 } // namespace S3
@@ -35,6 +35,11 @@ namespace JSONTypeMapper
 AWS_S3_API JSONType GetJSONTypeForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForJSONType(JSONType value);
+
+/**
+ * Same as GetNameForJSONType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForJSONTypeCStr(JSONType value);
 } // namespace JSONTypeMapper
 } // namespace Model
 } // namespace S3
@@ -33,6 +33,10 @@ namespace Xml
 {
   class XmlDocument;
 } // namespace Xml
+namespace Stream
+{
+  class ResponseStream;
+} // namespace Stream
 } // namespace Utils
 namespace S3
 {
@@ -44,6 +48,18 @@ namespace Model
     ListObjectsResult();
     ListObjectsResult(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
     ListObjectsResult& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
+    ListObjectsResult(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+    ListObjectsResult& operator=(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+
+    /**
+     * Whether the response body this result was read from is well formed XML.
+     */
+    inline bool WasParseSuccessful() const { return m_parseErrorMessage.empty(); }
+
+    /**
+     * What was wrong with the response body, if WasParseSuccessful() is false.
+     */
+    inline const Aws::String& GetParseErrorMessage() const { return m_parseErrorMessage; }
 
 
     /**
@@ -331,6 +347,8 @@ namespace Model
     Aws::Vector<CommonPrefix> m_commonPrefixes;
 
     EncodingType m_encodingType;
+
+    Aws::String m_parseErrorMessage;
   };
 
 } // namespace Model
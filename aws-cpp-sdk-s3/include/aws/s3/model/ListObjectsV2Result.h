@@ -33,6 +33,10 @@ namespace Xml
 {
   class XmlDocument;
 } // namespace Xml
+namespace Stream
+{
+  class ResponseStream;
+} // namespace Stream
 } // namespace Utils
 namespace S3
 {
@@ -44,6 +48,18 @@ namespace Model
     ListObjectsV2Result();
     ListObjectsV2Result(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
     ListObjectsV2Result& operator=(const Aws::AmazonWebServiceResult<Aws::Utils::Xml::XmlDocument>& result);
+    ListObjectsV2Result(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+    ListObjectsV2Result& operator=(Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream>&& result);
+
+    /**
+     * Whether the response body this result was read from is well formed XML.
+     */
+    inline bool WasParseSuccessful() const { return m_parseErrorMessage.empty(); }
+
+    /**
+     * What was wrong with the response body, if WasParseSuccessful() is false.
+     */
+    inline const Aws::String& GetParseErrorMessage() const { return m_parseErrorMessage; }
 
 
     /**
@@ -500,6 +516,8 @@ namespace Model
     Aws::String m_nextContinuationToken;
 
     Aws::String m_startAfter;
+
+    Aws::String m_parseErrorMessage;
   };
 
 } // namespace Model
@@ -35,6 +35,11 @@ namespace MFADeleteMapper
 AWS_S3_API MFADelete GetMFADeleteForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForMFADelete(MFADelete value);
+
+/**
+ * Same as GetNameForMFADelete(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForMFADeleteCStr(MFADelete value);
 } // namespace MFADeleteMapper
 } // namespace Model
 } // namespace S3
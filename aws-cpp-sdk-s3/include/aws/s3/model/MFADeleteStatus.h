@@ -35,6 +35,11 @@ namespace MFADeleteStatusMapper
 AWS_S3_API MFADeleteStatus GetMFADeleteStatusForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForMFADeleteStatus(MFADeleteStatus value);
+
+/**
+ * Same as GetNameForMFADeleteStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForMFADeleteStatusCStr(MFADeleteStatus value);
 } // namespace MFADeleteStatusMapper
 } // namespace Model
 } // namespace S3
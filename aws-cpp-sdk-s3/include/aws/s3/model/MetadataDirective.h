@@ -35,6 +35,11 @@ namespace MetadataDirectiveMapper
 AWS_S3_API MetadataDirective GetMetadataDirectiveForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForMetadataDirective(MetadataDirective value);
+
+/**
+ * Same as GetNameForMetadataDirective(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForMetadataDirectiveCStr(MetadataDirective value);
 } // namespace MetadataDirectiveMapper
 } // namespace Model
 } // namespace S3
@@ -40,6 +40,11 @@ namespace ObjectCannedACLMapper
 AWS_S3_API ObjectCannedACL GetObjectCannedACLForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForObjectCannedACL(ObjectCannedACL value);
+
+/**
+ * Same as GetNameForObjectCannedACL(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForObjectCannedACLCStr(ObjectCannedACL value);
 } // namespace ObjectCannedACLMapper
 } // namespace Model
 } // namespace S3
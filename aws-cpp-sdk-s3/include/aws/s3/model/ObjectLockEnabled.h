@@ -34,6 +34,11 @@ namespace ObjectLockEnabledMapper
 AWS_S3_API ObjectLockEnabled GetObjectLockEnabledForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForObjectLockEnabled(ObjectLockEnabled value);
+
+/**
+ * Same as GetNameForObjectLockEnabled(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForObjectLockEnabledCStr(ObjectLockEnabled value);
 } // namespace ObjectLockEnabledMapper
 } // namespace Model
 } // namespace S3
@@ -35,6 +35,11 @@ namespace ObjectLockLegalHoldStatusMapper
 AWS_S3_API ObjectLockLegalHoldStatus GetObjectLockLegalHoldStatusForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForObjectLockLegalHoldStatus(ObjectLockLegalHoldStatus value);
+
+/**
+ * Same as GetNameForObjectLockLegalHoldStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForObjectLockLegalHoldStatusCStr(ObjectLockLegalHoldStatus value);
 } // namespace ObjectLockLegalHoldStatusMapper
 } // namespace Model
 } // namespace S3
@@ -35,6 +35,11 @@ namespace ObjectLockModeMapper
 AWS_S3_API ObjectLockMode GetObjectLockModeForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForObjectLockMode(ObjectLockMode value);
+
+/**
+ * Same as GetNameForObjectLockMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForObjectLockModeCStr(ObjectLockMode value);
 } // namespace ObjectLockModeMapper
 } // namespace Model
 } // namespace S3
@@ -35,6 +35,11 @@ namespace ObjectLockRetentionModeMapper
 AWS_S3_API ObjectLockRetentionMode GetObjectLockRetentionModeForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForObjectLockRetentionMode(ObjectLockRetentionMode value);
+
+/**
+ * Same as GetNameForObjectLockRetentionMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForObjectLockRetentionModeCStr(ObjectLockRetentionMode value);
 } // namespace ObjectLockRetentionModeMapper
 } // namespace Model
 } // namespace S3
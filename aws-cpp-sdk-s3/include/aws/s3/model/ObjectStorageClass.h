@@ -39,6 +39,11 @@ namespace ObjectStorageClassMapper
 AWS_S3_API ObjectStorageClass GetObjectStorageClassForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForObjectStorageClass(ObjectStorageClass value);
+
+/**
+ * Same as GetNameForObjectStorageClass(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForObjectStorageClassCStr(ObjectStorageClass value);
 } // namespace ObjectStorageClassMapper
 } // namespace Model
 } // namespace S3
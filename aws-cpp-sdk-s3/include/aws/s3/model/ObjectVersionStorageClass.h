@@ -34,6 +34,11 @@ namespace ObjectVersionStorageClassMapper
 AWS_S3_API ObjectVersionStorageClass GetObjectVersionStorageClassForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForObjectVersionStorageClass(ObjectVersionStorageClass value);
+
+/**
+ * Same as GetNameForObjectVersionStorageClass(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForObjectVersionStorageClassCStr(ObjectVersionStorageClass value);
 } // namespace ObjectVersionStorageClassMapper
 } // namespace Model
 } // namespace S3
@@ -34,6 +34,11 @@ namespace OwnerOverrideMapper
 AWS_S3_API OwnerOverride GetOwnerOverrideForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForOwnerOverride(OwnerOverride value);
+
+/**
+ * Same as GetNameForOwnerOverride(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForOwnerOverrideCStr(OwnerOverride value);
 } // namespace OwnerOverrideMapper
 } // namespace Model
 } // namespace S3
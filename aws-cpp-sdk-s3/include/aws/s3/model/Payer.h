@@ -35,6 +35,11 @@ namespace PayerMapper
 AWS_S3_API Payer GetPayerForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForPayer(Payer value);
+
+/**
+ * Same as GetNameForPayer(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForPayerCStr(Payer value);
 } // namespace PayerMapper
 } // namespace Model
 } // namespace S3
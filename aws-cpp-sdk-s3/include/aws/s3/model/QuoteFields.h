@@ -35,6 +35,11 @@ namespace QuoteFieldsMapper
 AWS_S3_API QuoteFields GetQuoteFieldsForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForQuoteFields(QuoteFields value);
+
+/**
+ * Same as GetNameForQuoteFields(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForQuoteFieldsCStr(QuoteFields value);
 } // namespace QuoteFieldsMapper
 } // namespace Model
 } // namespace S3
@@ -35,6 +35,11 @@ namespace ReplicationRuleStatusMapper
 AWS_S3_API ReplicationRuleStatus GetReplicationRuleStatusForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForReplicationRuleStatus(ReplicationRuleStatus value);
+
+/**
+ * Same as GetNameForReplicationRuleStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForReplicationRuleStatusCStr(ReplicationRuleStatus value);
 } // namespace ReplicationRuleStatusMapper
 } // namespace Model
 } // namespace S3
@@ -37,6 +37,11 @@ namespace ReplicationStatusMapper
 AWS_S3_API ReplicationStatus GetReplicationStatusForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForReplicationStatus(ReplicationStatus value);
+
+/**
+ * Same as GetNameForReplicationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForReplicationStatusCStr(ReplicationStatus value);
 } // namespace ReplicationStatusMapper
 } // namespace Model
 } // namespace S3
@@ -34,6 +34,11 @@ namespace RequestChargedMapper
 AWS_S3_API RequestCharged GetRequestChargedForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForRequestCharged(RequestCharged value);
+
+/**
+ * Same as GetNameForRequestCharged(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForRequestChargedCStr(RequestCharged value);
 } // namespace RequestChargedMapper
 } // namespace Model
 } // namespace S3
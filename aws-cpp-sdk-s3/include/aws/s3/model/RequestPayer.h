@@ -34,6 +34,11 @@ namespace RequestPayerMapper
 AWS_S3_API RequestPayer GetRequestPayerForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForRequestPayer(RequestPayer value);
+
+/**
+ * Same as GetNameForRequestPayer(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForRequestPayerCStr(RequestPayer value);
 } // namespace RequestPayerMapper
 } // namespace Model
 } // namespace S3
@@ -34,6 +34,11 @@ namespace RestoreRequestTypeMapper
 AWS_S3_API RestoreRequestType GetRestoreRequestTypeForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForRestoreRequestType(RestoreRequestType value);
+
+/**
+ * Same as GetNameForRestoreRequestType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForRestoreRequestTypeCStr(RestoreRequestType value);
 } // namespace RestoreRequestTypeMapper
 } // namespace Model
 } // namespace S3
@@ -35,6 +35,11 @@ namespace ServerSideEncryptionMapper
 AWS_S3_API ServerSideEncryption GetServerSideEncryptionForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForServerSideEncryption(ServerSideEncryption value);
+
+/**
+ * Same as GetNameForServerSideEncryption(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForServerSideEncryptionCStr(ServerSideEncryption value);
 } // namespace ServerSideEncryptionMapper
 } // namespace Model
 } // namespace S3
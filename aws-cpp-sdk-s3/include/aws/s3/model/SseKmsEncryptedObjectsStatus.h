@@ -35,6 +35,11 @@ namespace SseKmsEncryptedObjectsStatusMapper
 AWS_S3_API SseKmsEncryptedObjectsStatus GetSseKmsEncryptedObjectsStatusForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForSseKmsEncryptedObjectsStatus(SseKmsEncryptedObjectsStatus value);
+
+/**
+ * Same as GetNameForSseKmsEncryptedObjectsStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForSseKmsEncryptedObjectsStatusCStr(SseKmsEncryptedObjectsStatus value);
 } // namespace SseKmsEncryptedObjectsStatusMapper
 } // namespace Model
 } // namespace S3
@@ -34,6 +34,11 @@ namespace StorageClassAnalysisSchemaVersionMapper
 AWS_S3_API StorageClassAnalysisSchemaVersion GetStorageClassAnalysisSchemaVersionForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForStorageClassAnalysisSchemaVersion(StorageClassAnalysisSchemaVersion value);
+
+/**
+ * Same as GetNameForStorageClassAnalysisSchemaVersion(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForStorageClassAnalysisSchemaVersionCStr(StorageClassAnalysisSchemaVersion value);
 } // namespace StorageClassAnalysisSchemaVersionMapper
 } // namespace Model
 } // namespace S3
@@ -35,6 +35,11 @@ namespace TaggingDirectiveMapper
 AWS_S3_API TaggingDirective GetTaggingDirectiveForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForTaggingDirective(TaggingDirective value);
+
+/**
+ * Same as GetNameForTaggingDirective(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForTaggingDirectiveCStr(TaggingDirective value);
 } // namespace TaggingDirectiveMapper
 } // namespace Model
 } // namespace S3
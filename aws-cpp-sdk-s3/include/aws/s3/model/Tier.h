@@ -36,6 +36,11 @@ namespace TierMapper
 AWS_S3_API Tier GetTierForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForTier(Tier value);
+
+/**
+ * Same as GetNameForTier(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForTierCStr(Tier value);
 } // namespace TierMapper
 } // namespace Model
 } // namespace S3
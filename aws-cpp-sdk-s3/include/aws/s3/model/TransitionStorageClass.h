@@ -37,6 +37,11 @@ namespace TransitionStorageClassMapper
 AWS_S3_API TransitionStorageClass GetTransitionStorageClassForName(const Aws::String& name);
 
 AWS_S3_API Aws::String GetNameForTransitionStorageClass(TransitionStorageClass value);
+
+/**
+ * Same as GetNameForTransitionStorageClass(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_S3_API const char* GetNameForTransitionStorageClassCStr(TransitionStorageClass value);
 } // namespace TransitionStorageClassMapper
 } // namespace Model
 } // namespace S3
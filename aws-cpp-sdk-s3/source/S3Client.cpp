@@ -2114,10 +2114,15 @@ ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) cons
   Aws::Http::URI uri = ComputeEndpointString(request.GetBucket());
   Aws::StringStream ss;
   uri.SetPath(uri.GetPath() + ss.str());
-  XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(uri, request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
-    return ListObjectsOutcome(ListObjectsResult(outcome.GetResult()));
+    ListObjectsResult result(outcome.GetResultWithOwnership());
+    if(!result.WasParseSuccessful())
+    {
+      return ListObjectsOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Xml Parse Error", result.GetParseErrorMessage(), false));
+    }
+    return ListObjectsOutcome(std::move(result));
   }
   else
   {
@@ -2149,10 +2154,15 @@ ListObjectsV2Outcome S3Client::ListObjectsV2(const ListObjectsV2Request& request
   Aws::StringStream ss;
   ss.str("?list-type=2");
   uri.SetQueryString(ss.str());
-  XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(uri, request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
-    return ListObjectsV2Outcome(ListObjectsV2Result(outcome.GetResult()));
+    ListObjectsV2Result result(outcome.GetResultWithOwnership());
+    if(!result.WasParseSuccessful())
+    {
+      return ListObjectsV2Outcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Xml Parse Error", result.GetParseErrorMessage(), false));
+    }
+    return ListObjectsV2Outcome(std::move(result));
   }
   else
   {
@@ -30,15 +30,30 @@ namespace Aws
       namespace AnalyticsS3ExportFileFormatMapper
       {
 
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CSV",
+        };
 
         AnalyticsS3ExportFileFormat GetAnalyticsS3ExportFileFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CSV_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AnalyticsS3ExportFileFormat::CSV;
+          case 67046:
+            if (name == "CSV")
+            {
+              return AnalyticsS3ExportFileFormat::CSV;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return AnalyticsS3ExportFileFormat::NOT_SET;
         }
 
-        Aws::String GetNameForAnalyticsS3ExportFileFormat(AnalyticsS3ExportFileFormat enumValue)
+        const char* GetNameForAnalyticsS3ExportFileFormatCStr(AnalyticsS3ExportFileFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AnalyticsS3ExportFileFormat::CSV:
-            return "CSV";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAnalyticsS3ExportFileFormat(AnalyticsS3ExportFileFormat enumValue)
+        {
+          return GetNameForAnalyticsS3ExportFileFormatCStr(enumValue);
         }
 
       } // namespace AnalyticsS3ExportFileFormatMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace BucketAccelerateStatusMapper
       {
 
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-        static const int Suspended_HASH = HashingUtils::HashString("Suspended");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Enabled",
+          "Suspended",
+        };
 
         BucketAccelerateStatus GetBucketAccelerateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enabled_HASH)
-          {
-            return BucketAccelerateStatus::Enabled;
-          }
-          else if (hashCode == Suspended_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BucketAccelerateStatus::Suspended;
+          case 55059233:
+            if (name == "Enabled")
+            {
+              return BucketAccelerateStatus::Enabled;
+            }
+            break;
+          case 342339003:
+            if (name == "Suspended")
+            {
+              return BucketAccelerateStatus::Suspended;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BucketAccelerateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBucketAccelerateStatus(BucketAccelerateStatus enumValue)
+        const char* GetNameForBucketAccelerateStatusCStr(BucketAccelerateStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BucketAccelerateStatus::Enabled:
-            return "Enabled";
-          case BucketAccelerateStatus::Suspended:
-            return "Suspended";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBucketAccelerateStatus(BucketAccelerateStatus enumValue)
+        {
+          return GetNameForBucketAccelerateStatusCStr(enumValue);
         }
 
       } // namespace BucketAccelerateStatusMapper
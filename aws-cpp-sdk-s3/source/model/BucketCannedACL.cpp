@@ -30,30 +30,51 @@ namespace Aws
       namespace BucketCannedACLMapper
       {
 
-        static const int private__HASH = HashingUtils::HashString("private");
-        static const int public_read_HASH = HashingUtils::HashString("public-read");
-        static const int public_read_write_HASH = HashingUtils::HashString("public-read-write");
-        static const int authenticated_read_HASH = HashingUtils::HashString("authenticated-read");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "private",
+          "public-read",
+          "public-read-write",
+          "authenticated-read",
+        };
 
         BucketCannedACL GetBucketCannedACLForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == private__HASH)
-          {
-            return BucketCannedACL::private_;
-          }
-          else if (hashCode == public_read_HASH)
-          {
-            return BucketCannedACL::public_read;
-          }
-          else if (hashCode == public_read_write_HASH)
-          {
-            return BucketCannedACL::public_read_write;
-          }
-          else if (hashCode == authenticated_read_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BucketCannedACL::authenticated_read;
+          case -314497661:
+            if (name == "private")
+            {
+              return BucketCannedACL::private_;
+            }
+            break;
+          case -1126309254:
+            if (name == "public-read")
+            {
+              return BucketCannedACL::public_read;
+            }
+            break;
+          case -1397683508:
+            if (name == "public-read-write")
+            {
+              return BucketCannedACL::public_read_write;
+            }
+            break;
+          case 2076511348:
+            if (name == "authenticated-read")
+            {
+              return BucketCannedACL::authenticated_read;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return BucketCannedACL::NOT_SET;
         }
 
-        Aws::String GetNameForBucketCannedACL(BucketCannedACL enumValue)
+        const char* GetNameForBucketCannedACLCStr(BucketCannedACL enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BucketCannedACL::private_:
-            return "private";
-          case BucketCannedACL::public_read:
-            return "public-read";
-          case BucketCannedACL::public_read_write:
-            return "public-read-write";
-          case BucketCannedACL::authenticated_read:
-            return "authenticated-read";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBucketCannedACL(BucketCannedACL enumValue)
+        {
+          return GetNameForBucketCannedACLCStr(enumValue);
         }
 
       } // namespace BucketCannedACLMapper
@@ -30,105 +30,156 @@ namespace Aws
       namespace BucketLocationConstraintMapper
       {
 
-        static const int EU_HASH = HashingUtils::HashString("EU");
-        static const int eu_west_1_HASH = HashingUtils::HashString("eu-west-1");
-        static const int us_west_1_HASH = HashingUtils::HashString("us-west-1");
-        static const int us_west_2_HASH = HashingUtils::HashString("us-west-2");
-        static const int ap_south_1_HASH = HashingUtils::HashString("ap-south-1");
-        static const int ap_southeast_1_HASH = HashingUtils::HashString("ap-southeast-1");
-        static const int ap_southeast_2_HASH = HashingUtils::HashString("ap-southeast-2");
-        static const int ap_northeast_1_HASH = HashingUtils::HashString("ap-northeast-1");
-        static const int sa_east_1_HASH = HashingUtils::HashString("sa-east-1");
-        static const int cn_north_1_HASH = HashingUtils::HashString("cn-north-1");
-        static const int eu_central_1_HASH = HashingUtils::HashString("eu-central-1");
-        static const int eu_west_3_HASH = HashingUtils::HashString("eu-west-3");
-        static const int eu_west_2_HASH = HashingUtils::HashString("eu-west-2");
-        static const int ap_northeast_2_HASH = HashingUtils::HashString("ap-northeast-2");
-        static const int ca_central_1_HASH = HashingUtils::HashString("ca-central-1");
-        static const int us_gov_west_1_HASH = HashingUtils::HashString("us-gov-west-1");
-        static const int us_east_1_HASH = HashingUtils::HashString("us-east-1");
-        static const int us_east_2_HASH = HashingUtils::HashString("us-east-2");
-        static const int cn_northwest_1_HASH = HashingUtils::HashString("cn-northwest-1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EU",
+          "eu-west-1",
+          "us-west-1",
+          "us-west-2",
+          "ap-south-1",
+          "ap-southeast-1",
+          "ap-southeast-2",
+          "ap-northeast-1",
+          "sa-east-1",
+          "cn-north-1",
+          "eu-central-1",
+          "eu-west-3",
+          "eu-west-2",
+          "ap-northeast-2",
+          "ca-central-1",
+          "us-gov-west-1",
+          "us-east-1",
+          "us-east-2",
+          "cn-northwest-1",
+        };
 
         BucketLocationConstraint GetBucketLocationConstraintForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EU_HASH)
-          {
-            return BucketLocationConstraint::EU;
-          }
-          else if (hashCode == eu_west_1_HASH)
-          {
-            return BucketLocationConstraint::eu_west_1;
-          }
-          else if (hashCode == us_west_1_HASH)
-          {
-            return BucketLocationConstraint::us_west_1;
-          }
-          else if (hashCode == us_west_2_HASH)
-          {
-            return BucketLocationConstraint::us_west_2;
-          }
-          else if (hashCode == ap_south_1_HASH)
-          {
-            return BucketLocationConstraint::ap_south_1;
-          }
-          else if (hashCode == ap_southeast_1_HASH)
-          {
-            return BucketLocationConstraint::ap_southeast_1;
-          }
-          else if (hashCode == ap_southeast_2_HASH)
-          {
-            return BucketLocationConstraint::ap_southeast_2;
-          }
-          else if (hashCode == ap_northeast_1_HASH)
-          {
-            return BucketLocationConstraint::ap_northeast_1;
-          }
-          else if (hashCode == sa_east_1_HASH)
-          {
-            return BucketLocationConstraint::sa_east_1;
-          }
-          else if (hashCode == cn_north_1_HASH)
-          {
-            return BucketLocationConstraint::cn_north_1;
-          }
-          else if (hashCode == eu_central_1_HASH)
-          {
-            return BucketLocationConstraint::eu_central_1;
-          }
-          else if (hashCode == eu_west_3_HASH)
-          {
-            return BucketLocationConstraint::eu_west_3;
-          }
-          else if (hashCode == eu_west_2_HASH)
-          {
-            return BucketLocationConstraint::eu_west_2;
-          }
-          else if (hashCode == ap_northeast_2_HASH)
-          {
-            return BucketLocationConstraint::ap_northeast_2;
-          }
-          else if (hashCode == ca_central_1_HASH)
-          {
-            return BucketLocationConstraint::ca_central_1;
-          }
-          else if (hashCode == us_gov_west_1_HASH)
-          {
-            return BucketLocationConstraint::us_gov_west_1;
-          }
-          else if (hashCode == us_east_1_HASH)
-          {
-            return BucketLocationConstraint::us_east_1;
-          }
-          else if (hashCode == us_east_2_HASH)
-          {
-            return BucketLocationConstraint::us_east_2;
-          }
-          else if (hashCode == cn_northwest_1_HASH)
-          {
-            return BucketLocationConstraint::cn_northwest_1;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 2224:
+            if (name == "EU")
+            {
+              return BucketLocationConstraint::EU;
+            }
+            break;
+          case 372748112:
+            if (name == "eu-west-1")
+            {
+              return BucketLocationConstraint::eu_west_1;
+            }
+            break;
+          case -1967372894:
+            if (name == "us-west-1")
+            {
+              return BucketLocationConstraint::us_west_1;
+            }
+            break;
+          case -1967372893:
+            if (name == "us-west-2")
+            {
+              return BucketLocationConstraint::us_west_2;
+            }
+            break;
+          case 936829075:
+            if (name == "ap-south-1")
+            {
+              return BucketLocationConstraint::ap_south_1;
+            }
+            break;
+          case 468199888:
+            if (name == "ap-southeast-1")
+            {
+              return BucketLocationConstraint::ap_southeast_1;
+            }
+            break;
+          case 468199889:
+            if (name == "ap-southeast-2")
+            {
+              return BucketLocationConstraint::ap_southeast_2;
+            }
+            break;
+          case 1990418184:
+            if (name == "ap-northeast-1")
+            {
+              return BucketLocationConstraint::ap_northeast_1;
+            }
+            break;
+          case -177297728:
+            if (name == "sa-east-1")
+            {
+              return BucketLocationConstraint::sa_east_1;
+            }
+            break;
+          case -281577977:
+            if (name == "cn-north-1")
+            {
+              return BucketLocationConstraint::cn_north_1;
+            }
+            break;
+          case -534364932:
+            if (name == "eu-central-1")
+            {
+              return BucketLocationConstraint::eu_central_1;
+            }
+            break;
+          case 372748114:
+            if (name == "eu-west-3")
+            {
+              return BucketLocationConstraint::eu_west_3;
+            }
+            break;
+          case 372748113:
+            if (name == "eu-west-2")
+            {
+              return BucketLocationConstraint::eu_west_2;
+            }
+            break;
+          case 1990418185:
+            if (name == "ap-northeast-2")
+            {
+              return BucketLocationConstraint::ap_northeast_2;
+            }
+            break;
+          case 786758442:
+            if (name == "ca-central-1")
+            {
+              return BucketLocationConstraint::ca_central_1;
+            }
+            break;
+          case 892625985:
+            if (name == "us-gov-west-1")
+            {
+              return BucketLocationConstraint::us_gov_west_1;
+            }
+            break;
+          case 1808575600:
+            if (name == "us-east-1")
+            {
+              return BucketLocationConstraint::us_east_1;
+            }
+            break;
+          case 1808575601:
+            if (name == "us-east-2")
+            {
+              return BucketLocationConstraint::us_east_2;
+            }
+            break;
+          case 2085125750:
+            if (name == "cn-northwest-1")
+            {
+              return BucketLocationConstraint::cn_northwest_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -140,57 +191,26 @@ namespace Aws
           return BucketLocationConstraint::NOT_SET;
         }
 
-        Aws::String GetNameForBucketLocationConstraint(BucketLocationConstraint enumValue)
+        const char* GetNameForBucketLocationConstraintCStr(BucketLocationConstraint enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BucketLocationConstraint::EU:
-            return "EU";
-          case BucketLocationConstraint::eu_west_1:
-            return "eu-west-1";
-          case BucketLocationConstraint::us_west_1:
-            return "us-west-1";
-          case BucketLocationConstraint::us_west_2:
-            return "us-west-2";
-          case BucketLocationConstraint::ap_south_1:
-            return "ap-south-1";
-          case BucketLocationConstraint::ap_southeast_1:
-            return "ap-southeast-1";
-          case BucketLocationConstraint::ap_southeast_2:
-            return "ap-southeast-2";
-          case BucketLocationConstraint::ap_northeast_1:
-            return "ap-northeast-1";
-          case BucketLocationConstraint::sa_east_1:
-            return "sa-east-1";
-          case BucketLocationConstraint::cn_north_1:
-            return "cn-north-1";
-          case BucketLocationConstraint::eu_central_1:
-            return "eu-central-1";
-          case BucketLocationConstraint::eu_west_3:
-            return "eu-west-3";
-          case BucketLocationConstraint::eu_west_2:
-            return "eu-west-2";
-          case BucketLocationConstraint::ap_northeast_2:
-            return "ap-northeast-2";
-          case BucketLocationConstraint::ca_central_1:
-            return "ca-central-1";
-          case BucketLocationConstraint::us_gov_west_1:
-            return "us-gov-west-1";
-          case BucketLocationConstraint::us_east_1:
-            return "us-east-1";
-          case BucketLocationConstraint::us_east_2:
-            return "us-east-2";
-          case BucketLocationConstraint::cn_northwest_1:
-            return "cn-northwest-1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBucketLocationConstraint(BucketLocationConstraint enumValue)
+        {
+          return GetNameForBucketLocationConstraintCStr(enumValue);
         }
 
       } // namespace BucketLocationConstraintMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace BucketLogsPermissionMapper
       {
 
-        static const int FULL_CONTROL_HASH = HashingUtils::HashString("FULL_CONTROL");
-        static const int READ_HASH = HashingUtils::HashString("READ");
-        static const int WRITE_HASH = HashingUtils::HashString("WRITE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FULL_CONTROL",
+          "READ",
+          "WRITE",
+        };
 
         BucketLogsPermission GetBucketLogsPermissionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_CONTROL_HASH)
-          {
-            return BucketLogsPermission::FULL_CONTROL;
-          }
-          else if (hashCode == READ_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BucketLogsPermission::READ;
-          }
-          else if (hashCode == WRITE_HASH)
-          {
-            return BucketLogsPermission::WRITE;
+          case 78885773:
+            if (name == "FULL_CONTROL")
+            {
+              return BucketLogsPermission::FULL_CONTROL;
+            }
+            break;
+          case 2511254:
+            if (name == "READ")
+            {
+              return BucketLogsPermission::READ;
+            }
+            break;
+          case 82862015:
+            if (name == "WRITE")
+            {
+              return BucketLogsPermission::WRITE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return BucketLogsPermission::NOT_SET;
         }
 
-        Aws::String GetNameForBucketLogsPermission(BucketLogsPermission enumValue)
+        const char* GetNameForBucketLogsPermissionCStr(BucketLogsPermission enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BucketLogsPermission::FULL_CONTROL:
-            return "FULL_CONTROL";
-          case BucketLogsPermission::READ:
-            return "READ";
-          case BucketLogsPermission::WRITE:
-            return "WRITE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBucketLogsPermission(BucketLogsPermission enumValue)
+        {
+          return GetNameForBucketLogsPermissionCStr(enumValue);
         }
 
       } // namespace BucketLogsPermissionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace BucketVersioningStatusMapper
       {
 
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-        static const int Suspended_HASH = HashingUtils::HashString("Suspended");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Enabled",
+          "Suspended",
+        };
 
         BucketVersioningStatus GetBucketVersioningStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enabled_HASH)
-          {
-            return BucketVersioningStatus::Enabled;
-          }
-          else if (hashCode == Suspended_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BucketVersioningStatus::Suspended;
+          case 55059233:
+            if (name == "Enabled")
+            {
+              return BucketVersioningStatus::Enabled;
+            }
+            break;
+          case 342339003:
+            if (name == "Suspended")
+            {
+              return BucketVersioningStatus::Suspended;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BucketVersioningStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBucketVersioningStatus(BucketVersioningStatus enumValue)
+        const char* GetNameForBucketVersioningStatusCStr(BucketVersioningStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BucketVersioningStatus::Enabled:
-            return "Enabled";
-          case BucketVersioningStatus::Suspended:
-            return "Suspended";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBucketVersioningStatus(BucketVersioningStatus enumValue)
+        {
+          return GetNameForBucketVersioningStatusCStr(enumValue);
         }
 
       } // namespace BucketVersioningStatusMapper
@@ -15,6 +15,7 @@
 
 #include <aws/s3/model/CommonPrefix.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -58,6 +59,29 @@ CommonPrefix& CommonPrefix::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+CommonPrefix::CommonPrefix(XmlReader& xmlReader) : 
+    m_prefixHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+CommonPrefix& CommonPrefix::operator =(XmlReader& xmlReader)
+{
+  while(xmlReader.NextChild())
+  {
+    if(xmlReader.IsName("Prefix"))
+    {
+      m_prefix = xmlReader.ReadTrimmedText();
+      m_prefixHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+  return *this;
+}
+
 void CommonPrefix::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -30,25 +30,44 @@ namespace Aws
       namespace CompressionTypeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
-        static const int BZIP2_HASH = HashingUtils::HashString("BZIP2");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "GZIP",
+          "BZIP2",
+        };
 
         CompressionType GetCompressionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return CompressionType::NONE;
-          }
-          else if (hashCode == GZIP_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CompressionType::GZIP;
-          }
-          else if (hashCode == BZIP2_HASH)
-          {
-            return CompressionType::BZIP2;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return CompressionType::NONE;
+            }
+            break;
+          case 2203994:
+            if (name == "GZIP")
+            {
+              return CompressionType::GZIP;
+            }
+            break;
+          case 63706259:
+            if (name == "BZIP2")
+            {
+              return CompressionType::BZIP2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return CompressionType::NOT_SET;
         }
 
-        Aws::String GetNameForCompressionType(CompressionType enumValue)
+        const char* GetNameForCompressionTypeCStr(CompressionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CompressionType::NONE:
-            return "NONE";
-          case CompressionType::GZIP:
-            return "GZIP";
-          case CompressionType::BZIP2:
-            return "BZIP2";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCompressionType(CompressionType enumValue)
+        {
+          return GetNameForCompressionTypeCStr(enumValue);
         }
 
       } // namespace CompressionTypeMapper
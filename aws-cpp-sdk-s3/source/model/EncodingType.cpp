@@ -30,15 +30,30 @@ namespace Aws
       namespace EncodingTypeMapper
       {
 
-        static const int url_HASH = HashingUtils::HashString("url");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "url",
+        };
 
         EncodingType GetEncodingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == url_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EncodingType::url;
+          case 116079:
+            if (name == "url")
+            {
+              return EncodingType::url;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return EncodingType::NOT_SET;
         }
 
-        Aws::String GetNameForEncodingType(EncodingType enumValue)
+        const char* GetNameForEncodingTypeCStr(EncodingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EncodingType::url:
-            return "url";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEncodingType(EncodingType enumValue)
+        {
+          return GetNameForEncodingTypeCStr(enumValue);
         }
 
       } // namespace EncodingTypeMapper
@@ -30,65 +30,100 @@ namespace Aws
       namespace EventMapper
       {
 
-        static const int s3_ReducedRedundancyLostObject_HASH = HashingUtils::HashString("s3:ReducedRedundancyLostObject");
-        static const int s3_ObjectCreated_HASH = HashingUtils::HashString("s3:ObjectCreated:*");
-        static const int s3_ObjectCreated_Put_HASH = HashingUtils::HashString("s3:ObjectCreated:Put");
-        static const int s3_ObjectCreated_Post_HASH = HashingUtils::HashString("s3:ObjectCreated:Post");
-        static const int s3_ObjectCreated_Copy_HASH = HashingUtils::HashString("s3:ObjectCreated:Copy");
-        static const int s3_ObjectCreated_CompleteMultipartUpload_HASH = HashingUtils::HashString("s3:ObjectCreated:CompleteMultipartUpload");
-        static const int s3_ObjectRemoved_HASH = HashingUtils::HashString("s3:ObjectRemoved:*");
-        static const int s3_ObjectRemoved_Delete_HASH = HashingUtils::HashString("s3:ObjectRemoved:Delete");
-        static const int s3_ObjectRemoved_DeleteMarkerCreated_HASH = HashingUtils::HashString("s3:ObjectRemoved:DeleteMarkerCreated");
-        static const int s3_ObjectRestore_Post_HASH = HashingUtils::HashString("s3:ObjectRestore:Post");
-        static const int s3_ObjectRestore_Completed_HASH = HashingUtils::HashString("s3:ObjectRestore:Completed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "s3:ReducedRedundancyLostObject",
+          "s3:ObjectCreated:*",
+          "s3:ObjectCreated:Put",
+          "s3:ObjectCreated:Post",
+          "s3:ObjectCreated:Copy",
+          "s3:ObjectCreated:CompleteMultipartUpload",
+          "s3:ObjectRemoved:*",
+          "s3:ObjectRemoved:Delete",
+          "s3:ObjectRemoved:DeleteMarkerCreated",
+          "s3:ObjectRestore:Post",
+          "s3:ObjectRestore:Completed",
+        };
 
         Event GetEventForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == s3_ReducedRedundancyLostObject_HASH)
-          {
-            return Event::s3_ReducedRedundancyLostObject;
-          }
-          else if (hashCode == s3_ObjectCreated_HASH)
-          {
-            return Event::s3_ObjectCreated;
-          }
-          else if (hashCode == s3_ObjectCreated_Put_HASH)
-          {
-            return Event::s3_ObjectCreated_Put;
-          }
-          else if (hashCode == s3_ObjectCreated_Post_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Event::s3_ObjectCreated_Post;
-          }
-          else if (hashCode == s3_ObjectCreated_Copy_HASH)
-          {
-            return Event::s3_ObjectCreated_Copy;
-          }
-          else if (hashCode == s3_ObjectCreated_CompleteMultipartUpload_HASH)
-          {
-            return Event::s3_ObjectCreated_CompleteMultipartUpload;
-          }
-          else if (hashCode == s3_ObjectRemoved_HASH)
-          {
-            return Event::s3_ObjectRemoved;
-          }
-          else if (hashCode == s3_ObjectRemoved_Delete_HASH)
-          {
-            return Event::s3_ObjectRemoved_Delete;
-          }
-          else if (hashCode == s3_ObjectRemoved_DeleteMarkerCreated_HASH)
-          {
-            return Event::s3_ObjectRemoved_DeleteMarkerCreated;
-          }
-          else if (hashCode == s3_ObjectRestore_Post_HASH)
-          {
-            return Event::s3_ObjectRestore_Post;
-          }
-          else if (hashCode == s3_ObjectRestore_Completed_HASH)
-          {
-            return Event::s3_ObjectRestore_Completed;
+          case 442328292:
+            if (name == "s3:ReducedRedundancyLostObject")
+            {
+              return Event::s3_ReducedRedundancyLostObject;
+            }
+            break;
+          case 1479862815:
+            if (name == "s3:ObjectCreated:*")
+            {
+              return Event::s3_ObjectCreated;
+            }
+            break;
+          case 514030500:
+            if (name == "s3:ObjectCreated:Put")
+            {
+              return Event::s3_ObjectCreated_Put;
+            }
+            break;
+          case -1244929365:
+            if (name == "s3:ObjectCreated:Post")
+            {
+              return Event::s3_ObjectCreated_Post;
+            }
+            break;
+          case -1245316736:
+            if (name == "s3:ObjectCreated:Copy")
+            {
+              return Event::s3_ObjectCreated_Copy;
+            }
+            break;
+          case 1040332649:
+            if (name == "s3:ObjectCreated:CompleteMultipartUpload")
+            {
+              return Event::s3_ObjectCreated_CompleteMultipartUpload;
+            }
+            break;
+          case -2131098217:
+            if (name == "s3:ObjectRemoved:*")
+            {
+              return Event::s3_ObjectRemoved;
+            }
+            break;
+          case -951269250:
+            if (name == "s3:ObjectRemoved:Delete")
+            {
+              return Event::s3_ObjectRemoved_Delete;
+            }
+            break;
+          case 1458622832:
+            if (name == "s3:ObjectRemoved:DeleteMarkerCreated")
+            {
+              return Event::s3_ObjectRemoved_DeleteMarkerCreated;
+            }
+            break;
+          case -1599084859:
+            if (name == "s3:ObjectRestore:Post")
+            {
+              return Event::s3_ObjectRestore_Post;
+            }
+            break;
+          case 2045359942:
+            if (name == "s3:ObjectRestore:Completed")
+            {
+              return Event::s3_ObjectRestore_Completed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return Event::NOT_SET;
         }
 
-        Aws::String GetNameForEvent(Event enumValue)
+        const char* GetNameForEventCStr(Event enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Event::s3_ReducedRedundancyLostObject:
-            return "s3:ReducedRedundancyLostObject";
-          case Event::s3_ObjectCreated:
-            return "s3:ObjectCreated:*";
-          case Event::s3_ObjectCreated_Put:
-            return "s3:ObjectCreated:Put";
-          case Event::s3_ObjectCreated_Post:
-            return "s3:ObjectCreated:Post";
-          case Event::s3_ObjectCreated_Copy:
-            return "s3:ObjectCreated:Copy";
-          case Event::s3_ObjectCreated_CompleteMultipartUpload:
-            return "s3:ObjectCreated:CompleteMultipartUpload";
-          case Event::s3_ObjectRemoved:
-            return "s3:ObjectRemoved:*";
-          case Event::s3_ObjectRemoved_Delete:
-            return "s3:ObjectRemoved:Delete";
-          case Event::s3_ObjectRemoved_DeleteMarkerCreated:
-            return "s3:ObjectRemoved:DeleteMarkerCreated";
-          case Event::s3_ObjectRestore_Post:
-            return "s3:ObjectRestore:Post";
-          case Event::s3_ObjectRestore_Completed:
-            return "s3:ObjectRestore:Completed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEvent(Event enumValue)
+        {
+          return GetNameForEventCStr(enumValue);
         }
 
       } // namespace EventMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ExpressionTypeMapper
       {
 
-        static const int SQL_HASH = HashingUtils::HashString("SQL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SQL",
+        };
 
         ExpressionType GetExpressionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SQL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExpressionType::SQL;
+          case 82350:
+            if (name == "SQL")
+            {
+              return ExpressionType::SQL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ExpressionType::NOT_SET;
         }
 
-        Aws::String GetNameForExpressionType(ExpressionType enumValue)
+        const char* GetNameForExpressionTypeCStr(ExpressionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExpressionType::SQL:
-            return "SQL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExpressionType(ExpressionType enumValue)
+        {
+          return GetNameForExpressionTypeCStr(enumValue);
         }
 
       } // namespace ExpressionTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace FilterRuleNameMapper
       {
 
-        static const int prefix_HASH = HashingUtils::HashString("prefix");
-        static const int suffix_HASH = HashingUtils::HashString("suffix");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "prefix",
+          "suffix",
+        };
 
         FilterRuleName GetFilterRuleNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == prefix_HASH)
-          {
-            return FilterRuleName::prefix;
-          }
-          else if (hashCode == suffix_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FilterRuleName::suffix;
+          case -980110702:
+            if (name == "prefix")
+            {
+              return FilterRuleName::prefix;
+            }
+            break;
+          case -891422895:
+            if (name == "suffix")
+            {
+              return FilterRuleName::suffix;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FilterRuleName::NOT_SET;
         }
 
-        Aws::String GetNameForFilterRuleName(FilterRuleName enumValue)
+        const char* GetNameForFilterRuleNameCStr(FilterRuleName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FilterRuleName::prefix:
-            return "prefix";
-          case FilterRuleName::suffix:
-            return "suffix";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFilterRuleName(FilterRuleName enumValue)
+        {
+          return GetNameForFilterRuleNameCStr(enumValue);
         }
 
       } // namespace FilterRuleNameMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace InventoryFormatMapper
       {
 
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
-        static const int ORC_HASH = HashingUtils::HashString("ORC");
-        static const int Parquet_HASH = HashingUtils::HashString("Parquet");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CSV",
+          "ORC",
+          "Parquet",
+        };
 
         InventoryFormat GetInventoryFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CSV_HASH)
-          {
-            return InventoryFormat::CSV;
-          }
-          else if (hashCode == ORC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InventoryFormat::ORC;
-          }
-          else if (hashCode == Parquet_HASH)
-          {
-            return InventoryFormat::Parquet;
+          case 67046:
+            if (name == "CSV")
+            {
+              return InventoryFormat::CSV;
+            }
+            break;
+          case 78528:
+            if (name == "ORC")
+            {
+              return InventoryFormat::ORC;
+            }
+            break;
+          case 871641556:
+            if (name == "Parquet")
+            {
+              return InventoryFormat::Parquet;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return InventoryFormat::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryFormat(InventoryFormat enumValue)
+        const char* GetNameForInventoryFormatCStr(InventoryFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InventoryFormat::CSV:
-            return "CSV";
-          case InventoryFormat::ORC:
-            return "ORC";
-          case InventoryFormat::Parquet:
-            return "Parquet";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInventoryFormat(InventoryFormat enumValue)
+        {
+          return GetNameForInventoryFormatCStr(enumValue);
         }
 
       } // namespace InventoryFormatMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace InventoryFrequencyMapper
       {
 
-        static const int Daily_HASH = HashingUtils::HashString("Daily");
-        static const int Weekly_HASH = HashingUtils::HashString("Weekly");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Daily",
+          "Weekly",
+        };
 
         InventoryFrequency GetInventoryFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Daily_HASH)
-          {
-            return InventoryFrequency::Daily;
-          }
-          else if (hashCode == Weekly_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InventoryFrequency::Weekly;
+          case 65793529:
+            if (name == "Daily")
+            {
+              return InventoryFrequency::Daily;
+            }
+            break;
+          case -1707840351:
+            if (name == "Weekly")
+            {
+              return InventoryFrequency::Weekly;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InventoryFrequency::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryFrequency(InventoryFrequency enumValue)
+        const char* GetNameForInventoryFrequencyCStr(InventoryFrequency enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InventoryFrequency::Daily:
-            return "Daily";
-          case InventoryFrequency::Weekly:
-            return "Weekly";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInventoryFrequency(InventoryFrequency enumValue)
+        {
+          return GetNameForInventoryFrequencyCStr(enumValue);
         }
 
       } // namespace InventoryFrequencyMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace InventoryIncludedObjectVersionsMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int Current_HASH = HashingUtils::HashString("Current");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "All",
+          "Current",
+        };
 
         InventoryIncludedObjectVersions GetInventoryIncludedObjectVersionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
-          {
-            return InventoryIncludedObjectVersions::All;
-          }
-          else if (hashCode == Current_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InventoryIncludedObjectVersions::Current;
+          case 65921:
+            if (name == "All")
+            {
+              return InventoryIncludedObjectVersions::All;
+            }
+            break;
+          case -1503373991:
+            if (name == "Current")
+            {
+              return InventoryIncludedObjectVersions::Current;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InventoryIncludedObjectVersions::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryIncludedObjectVersions(InventoryIncludedObjectVersions enumValue)
+        const char* GetNameForInventoryIncludedObjectVersionsCStr(InventoryIncludedObjectVersions enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InventoryIncludedObjectVersions::All:
-            return "All";
-          case InventoryIncludedObjectVersions::Current:
-            return "Current";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInventoryIncludedObjectVersions(InventoryIncludedObjectVersions enumValue)
+        {
+          return GetNameForInventoryIncludedObjectVersionsCStr(enumValue);
         }
 
       } // namespace InventoryIncludedObjectVersionsMapper
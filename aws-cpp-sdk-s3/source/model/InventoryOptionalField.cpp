@@ -30,60 +30,93 @@ namespace Aws
       namespace InventoryOptionalFieldMapper
       {
 
-        static const int Size_HASH = HashingUtils::HashString("Size");
-        static const int LastModifiedDate_HASH = HashingUtils::HashString("LastModifiedDate");
-        static const int StorageClass_HASH = HashingUtils::HashString("StorageClass");
-        static const int ETag_HASH = HashingUtils::HashString("ETag");
-        static const int IsMultipartUploaded_HASH = HashingUtils::HashString("IsMultipartUploaded");
-        static const int ReplicationStatus_HASH = HashingUtils::HashString("ReplicationStatus");
-        static const int EncryptionStatus_HASH = HashingUtils::HashString("EncryptionStatus");
-        static const int ObjectLockRetainUntilDate_HASH = HashingUtils::HashString("ObjectLockRetainUntilDate");
-        static const int ObjectLockMode_HASH = HashingUtils::HashString("ObjectLockMode");
-        static const int ObjectLockLegalHoldStatus_HASH = HashingUtils::HashString("ObjectLockLegalHoldStatus");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Size",
+          "LastModifiedDate",
+          "StorageClass",
+          "ETag",
+          "IsMultipartUploaded",
+          "ReplicationStatus",
+          "EncryptionStatus",
+          "ObjectLockRetainUntilDate",
+          "ObjectLockMode",
+          "ObjectLockLegalHoldStatus",
+        };
 
         InventoryOptionalField GetInventoryOptionalFieldForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Size_HASH)
-          {
-            return InventoryOptionalField::Size;
-          }
-          else if (hashCode == LastModifiedDate_HASH)
-          {
-            return InventoryOptionalField::LastModifiedDate;
-          }
-          else if (hashCode == StorageClass_HASH)
-          {
-            return InventoryOptionalField::StorageClass;
-          }
-          else if (hashCode == ETag_HASH)
-          {
-            return InventoryOptionalField::ETag;
-          }
-          else if (hashCode == IsMultipartUploaded_HASH)
-          {
-            return InventoryOptionalField::IsMultipartUploaded;
-          }
-          else if (hashCode == ReplicationStatus_HASH)
-          {
-            return InventoryOptionalField::ReplicationStatus;
-          }
-          else if (hashCode == EncryptionStatus_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InventoryOptionalField::EncryptionStatus;
-          }
-          else if (hashCode == ObjectLockRetainUntilDate_HASH)
-          {
-            return InventoryOptionalField::ObjectLockRetainUntilDate;
-          }
-          else if (hashCode == ObjectLockMode_HASH)
-          {
-            return InventoryOptionalField::ObjectLockMode;
-          }
-          else if (hashCode == ObjectLockLegalHoldStatus_HASH)
-          {
-            return InventoryOptionalField::ObjectLockLegalHoldStatus;
+          case 2577441:
+            if (name == "Size")
+            {
+              return InventoryOptionalField::Size;
+            }
+            break;
+          case 1911346157:
+            if (name == "LastModifiedDate")
+            {
+              return InventoryOptionalField::LastModifiedDate;
+            }
+            break;
+          case 1035673565:
+            if (name == "StorageClass")
+            {
+              return InventoryOptionalField::StorageClass;
+            }
+            break;
+          case 2139413:
+            if (name == "ETag")
+            {
+              return InventoryOptionalField::ETag;
+            }
+            break;
+          case -2082980094:
+            if (name == "IsMultipartUploaded")
+            {
+              return InventoryOptionalField::IsMultipartUploaded;
+            }
+            break;
+          case -2118583618:
+            if (name == "ReplicationStatus")
+            {
+              return InventoryOptionalField::ReplicationStatus;
+            }
+            break;
+          case -1713954443:
+            if (name == "EncryptionStatus")
+            {
+              return InventoryOptionalField::EncryptionStatus;
+            }
+            break;
+          case 564561437:
+            if (name == "ObjectLockRetainUntilDate")
+            {
+              return InventoryOptionalField::ObjectLockRetainUntilDate;
+            }
+            break;
+          case 208734701:
+            if (name == "ObjectLockMode")
+            {
+              return InventoryOptionalField::ObjectLockMode;
+            }
+            break;
+          case 828559008:
+            if (name == "ObjectLockLegalHoldStatus")
+            {
+              return InventoryOptionalField::ObjectLockLegalHoldStatus;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return InventoryOptionalField::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryOptionalField(InventoryOptionalField enumValue)
+        const char* GetNameForInventoryOptionalFieldCStr(InventoryOptionalField enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InventoryOptionalField::Size:
-            return "Size";
-          case InventoryOptionalField::LastModifiedDate:
-            return "LastModifiedDate";
-          case InventoryOptionalField::StorageClass:
-            return "StorageClass";
-          case InventoryOptionalField::ETag:
-            return "ETag";
-          case InventoryOptionalField::IsMultipartUploaded:
-            return "IsMultipartUploaded";
-          case InventoryOptionalField::ReplicationStatus:
-            return "ReplicationStatus";
-          case InventoryOptionalField::EncryptionStatus:
-            return "EncryptionStatus";
-          case InventoryOptionalField::ObjectLockRetainUntilDate:
-            return "ObjectLockRetainUntilDate";
-          case InventoryOptionalField::ObjectLockMode:
-            return "ObjectLockMode";
-          case InventoryOptionalField::ObjectLockLegalHoldStatus:
-            return "ObjectLockLegalHoldStatus";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInventoryOptionalField(InventoryOptionalField enumValue)
+        {
+          return GetNameForInventoryOptionalFieldCStr(enumValue);
         }
 
       } // namespace InventoryOptionalFieldMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace JSONTypeMapper
       {
 
-        static const int DOCUMENT_HASH = HashingUtils::HashString("DOCUMENT");
-        static const int LINES_HASH = HashingUtils::HashString("LINES");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DOCUMENT",
+          "LINES",
+        };
 
         JSONType GetJSONTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DOCUMENT_HASH)
-          {
-            return JSONType::DOCUMENT;
-          }
-          else if (hashCode == LINES_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JSONType::LINES;
+          case 1644347675:
+            if (name == "DOCUMENT")
+            {
+              return JSONType::DOCUMENT;
+            }
+            break;
+          case 72439519:
+            if (name == "LINES")
+            {
+              return JSONType::LINES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return JSONType::NOT_SET;
         }
 
-        Aws::String GetNameForJSONType(JSONType enumValue)
+        const char* GetNameForJSONTypeCStr(JSONType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JSONType::DOCUMENT:
-            return "DOCUMENT";
-          case JSONType::LINES:
-            return "LINES";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJSONType(JSONType enumValue)
+        {
+          return GetNameForJSONTypeCStr(enumValue);
         }
 
       } // namespace JSONTypeMapper
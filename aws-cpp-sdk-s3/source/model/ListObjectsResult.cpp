@@ -17,11 +17,14 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 
 #include <utility>
 
 using namespace Aws::S3::Model;
 using namespace Aws::Utils::Xml;
+using namespace Aws::Utils::Stream;
 using namespace Aws::Utils;
 using namespace Aws;
 
@@ -113,3 +116,71 @@ ListObjectsResult& ListObjectsResult::operator =(const Aws::AmazonWebServiceResu
 
   return *this;
 }
+
+ListObjectsResult::ListObjectsResult(Aws::AmazonWebServiceResult<ResponseStream>&& result) : 
+    m_isTruncated(false),
+    m_maxKeys(0),
+    m_encodingType(EncodingType::NOT_SET)
+{
+  *this = std::move(result);
+}
+
+ListObjectsResult& ListObjectsResult::operator =(Aws::AmazonWebServiceResult<ResponseStream>&& result)
+{
+  XmlReader xmlReader(result.GetPayload().GetUnderlyingStream());
+
+  if(xmlReader.StartRootElement())
+  {
+    while(xmlReader.NextChild())
+    {
+      if(xmlReader.IsName("IsTruncated"))
+      {
+        m_isTruncated = StringUtils::ConvertToBool(xmlReader.ReadTrimmedText().c_str());
+      }
+      else if(xmlReader.IsName("Marker"))
+      {
+        m_marker = xmlReader.ReadTrimmedText();
+      }
+      else if(xmlReader.IsName("NextMarker"))
+      {
+        m_nextMarker = xmlReader.ReadTrimmedText();
+      }
+      else if(xmlReader.IsName("Contents"))
+      {
+        m_contents.push_back(xmlReader);
+      }
+      else if(xmlReader.IsName("Name"))
+      {
+        m_name = xmlReader.ReadTrimmedText();
+      }
+      else if(xmlReader.IsName("Prefix"))
+      {
+        m_prefix = xmlReader.ReadTrimmedText();
+      }
+      else if(xmlReader.IsName("Delimiter"))
+      {
+        m_delimiter = xmlReader.ReadTrimmedText();
+      }
+      else if(xmlReader.IsName("MaxKeys"))
+      {
+        m_maxKeys = StringUtils::ConvertToInt32(xmlReader.ReadTrimmedText().c_str());
+      }
+      else if(xmlReader.IsName("CommonPrefixes"))
+      {
+        m_commonPrefixes.push_back(xmlReader);
+      }
+      else if(xmlReader.IsName("EncodingType"))
+      {
+        m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(xmlReader.ReadTrimmedText());
+      }
+      else
+      {
+        xmlReader.SkipElement();
+      }
+    }
+  }
+
+  m_parseErrorMessage = xmlReader.WasParseSuccessful() ? "" : xmlReader.GetErrorMessage();
+
+  return *this;
+}
@@ -17,11 +17,14 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/AmazonWebServiceResult.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/xml/XmlReader.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 
 #include <utility>
 
 using namespace Aws::S3::Model;
 using namespace Aws::Utils::Xml;
+using namespace Aws::Utils::Stream;
 using namespace Aws::Utils;
 using namespace Aws;
 
@@ -125,3 +128,80 @@ ListObjectsV2Result& ListObjectsV2Result::operator =(const Aws::AmazonWebService
 
   return *this;
 }
+
+ListObjectsV2Result::ListObjectsV2Result(Aws::AmazonWebServiceResult<ResponseStream>&& result) : 
+    m_isTruncated(false),
+    m_maxKeys(0),
+    m_encodingType(EncodingType::NOT_SET),
+    m_keyCount(0)
+{
+  *this = std::move(result);
+}
+
+ListObjectsV2Result& ListObjectsV2Result::operator =(Aws::AmazonWebServiceResult<ResponseStream>&& result)
+{
+  XmlReader xmlReader(result.GetPayload().GetUnderlyingStream());
+
+  if(xmlReader.StartRootElement())
+  {
+    while(xmlReader.NextChild())
+    {
+      if(xmlReader.IsName("IsTruncated"))
+      {
+        m_isTruncated = StringUtils::ConvertToBool(xmlReader.ReadTrimmedText().c_str());
+      }
+      else if(xmlReader.IsName("Contents"))
+      {
+        m_contents.push_back(xmlReader);
+      }
+      else if(xmlReader.IsName("Name"))
+      {
+        m_name = xmlReader.ReadTrimmedText();
+      }
+      else if(xmlReader.IsName("Prefix"))
+      {
+        m_prefix = xmlReader.ReadTrimmedText();
+      }
+      else if(xmlReader.IsName("Delimiter"))
+      {
+        m_delimiter = xmlReader.ReadTrimmedText();
+      }
+      else if(xmlReader.IsName("MaxKeys"))
+      {
+        m_maxKeys = StringUtils::ConvertToInt32(xmlReader.ReadTrimmedText().c_str());
+      }
+      else if(xmlReader.IsName("CommonPrefixes"))
+      {
+        m_commonPrefixes.push_back(xmlReader);
+      }
+      else if(xmlReader.IsName("EncodingType"))
+      {
+        m_encodingType = EncodingTypeMapper::GetEncodingTypeForName(xmlReader.ReadTrimmedText());
+      }
+      else if(xmlReader.IsName("KeyCount"))
+      {
+        m_keyCount = StringUtils::ConvertToInt32(xmlReader.ReadTrimmedText().c_str());
+      }
+      else if(xmlReader.IsName("ContinuationToken"))
+      {
+        m_continuationToken = xmlReader.ReadTrimmedText();
+      }
+      else if(xmlReader.IsName("NextContinuationToken"))
+      {
+        m_nextContinuationToken = xmlReader.ReadTrimmedText();
+      }
+      else if(xmlReader.IsName("StartAfter"))
+      {
+        m_startAfter = xmlReader.ReadTrimmedText();
+      }
+      else
+      {
+        xmlReader.SkipElement();
+      }
+    }
+  }
+
+  m_parseErrorMessage = xmlReader.WasParseSuccessful() ? "" : xmlReader.GetErrorMessage();
+
+  return *this;
+}
@@ -30,20 +30,37 @@ namespace Aws
       namespace MetadataDirectiveMapper
       {
 
-        static const int COPY_HASH = HashingUtils::HashString("COPY");
-        static const int REPLACE_HASH = HashingUtils::HashString("REPLACE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COPY",
+          "REPLACE",
+        };
 
         MetadataDirective GetMetadataDirectiveForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COPY_HASH)
-          {
-            return MetadataDirective::COPY;
-          }
-          else if (hashCode == REPLACE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MetadataDirective::REPLACE;
+          case 2074485:
+            if (name == "COPY")
+            {
+              return MetadataDirective::COPY;
+            }
+            break;
+          case 1812479636:
+            if (name == "REPLACE")
+            {
+              return MetadataDirective::REPLACE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MetadataDirective::NOT_SET;
         }
 
-        Aws::String GetNameForMetadataDirective(MetadataDirective enumValue)
+        const char* GetNameForMetadataDirectiveCStr(MetadataDirective enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MetadataDirective::COPY:
-            return "COPY";
-          case MetadataDirective::REPLACE:
-            return "REPLACE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMetadataDirective(MetadataDirective enumValue)
+        {
+          return GetNameForMetadataDirectiveCStr(enumValue);
         }
 
       } // namespace MetadataDirectiveMapper
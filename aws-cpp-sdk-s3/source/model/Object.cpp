@@ -15,6 +15,7 @@
 
 #include <aws/s3/model/Object.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -102,6 +103,61 @@ Object& Object::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Object::Object(XmlReader& xmlReader) : 
+    m_keyHasBeenSet(false),
+    m_lastModifiedHasBeenSet(false),
+    m_eTagHasBeenSet(false),
+    m_size(0),
+    m_sizeHasBeenSet(false),
+    m_storageClass(ObjectStorageClass::NOT_SET),
+    m_storageClassHasBeenSet(false),
+    m_ownerHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+Object& Object::operator =(XmlReader& xmlReader)
+{
+  while(xmlReader.NextChild())
+  {
+    if(xmlReader.IsName("Key"))
+    {
+      m_key = xmlReader.ReadTrimmedText();
+      m_keyHasBeenSet = true;
+    }
+    else if(xmlReader.IsName("LastModified"))
+    {
+      m_lastModified = DateTime(xmlReader.ReadTrimmedText(), DateFormat::ISO_8601);
+      m_lastModifiedHasBeenSet = true;
+    }
+    else if(xmlReader.IsName("ETag"))
+    {
+      m_eTag = xmlReader.ReadTrimmedText();
+      m_eTagHasBeenSet = true;
+    }
+    else if(xmlReader.IsName("Size"))
+    {
+      m_size = StringUtils::ConvertToInt64(xmlReader.ReadTrimmedText().c_str());
+      m_sizeHasBeenSet = true;
+    }
+    else if(xmlReader.IsName("StorageClass"))
+    {
+      m_storageClass = ObjectStorageClassMapper::GetObjectStorageClassForName(xmlReader.ReadTrimmedText());
+      m_storageClassHasBeenSet = true;
+    }
+    else if(xmlReader.IsName("Owner"))
+    {
+      m_owner = xmlReader;
+      m_ownerHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+  return *this;
+}
+
 void Object::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -30,45 +30,72 @@ namespace Aws
       namespace ObjectCannedACLMapper
       {
 
-        static const int private__HASH = HashingUtils::HashString("private");
-        static const int public_read_HASH = HashingUtils::HashString("public-read");
-        static const int public_read_write_HASH = HashingUtils::HashString("public-read-write");
-        static const int authenticated_read_HASH = HashingUtils::HashString("authenticated-read");
-        static const int aws_exec_read_HASH = HashingUtils::HashString("aws-exec-read");
-        static const int bucket_owner_read_HASH = HashingUtils::HashString("bucket-owner-read");
-        static const int bucket_owner_full_control_HASH = HashingUtils::HashString("bucket-owner-full-control");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "private",
+          "public-read",
+          "public-read-write",
+          "authenticated-read",
+          "aws-exec-read",
+          "bucket-owner-read",
+          "bucket-owner-full-control",
+        };
 
         ObjectCannedACL GetObjectCannedACLForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == private__HASH)
-          {
-            return ObjectCannedACL::private_;
-          }
-          else if (hashCode == public_read_HASH)
-          {
-            return ObjectCannedACL::public_read;
-          }
-          else if (hashCode == public_read_write_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ObjectCannedACL::public_read_write;
-          }
-          else if (hashCode == authenticated_read_HASH)
-          {
-            return ObjectCannedACL::authenticated_read;
-          }
-          else if (hashCode == aws_exec_read_HASH)
-          {
-            return ObjectCannedACL::aws_exec_read;
-          }
-          else if (hashCode == bucket_owner_read_HASH)
-          {
-            return ObjectCannedACL::bucket_owner_read;
-          }
-          else if (hashCode == bucket_owner_full_control_HASH)
-          {
-            return ObjectCannedACL::bucket_owner_full_control;
+          case -314497661:
+            if (name == "private")
+            {
+              return ObjectCannedACL::private_;
+            }
+            break;
+          case -1126309254:
+            if (name == "public-read")
+            {
+              return ObjectCannedACL::public_read;
+            }
+            break;
+          case -1397683508:
+            if (name == "public-read-write")
+            {
+              return ObjectCannedACL::public_read_write;
+            }
+            break;
+          case 2076511348:
+            if (name == "authenticated-read")
+            {
+              return ObjectCannedACL::authenticated_read;
+            }
+            break;
+          case -2116027774:
+            if (name == "aws-exec-read")
+            {
+              return ObjectCannedACL::aws_exec_read;
+            }
+            break;
+          case 18410547:
+            if (name == "bucket-owner-read")
+            {
+              return ObjectCannedACL::bucket_owner_read;
+            }
+            break;
+          case -1751248452:
+            if (name == "bucket-owner-full-control")
+            {
+              return ObjectCannedACL::bucket_owner_full_control;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ObjectCannedACL::NOT_SET;
         }
 
-        Aws::String GetNameForObjectCannedACL(ObjectCannedACL enumValue)
+        const char* GetNameForObjectCannedACLCStr(ObjectCannedACL enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ObjectCannedACL::private_:
-            return "private";
-          case ObjectCannedACL::public_read:
-            return "public-read";
-          case ObjectCannedACL::public_read_write:
-            return "public-read-write";
-          case ObjectCannedACL::authenticated_read:
-            return "authenticated-read";
-          case ObjectCannedACL::aws_exec_read:
-            return "aws-exec-read";
-          case ObjectCannedACL::bucket_owner_read:
-            return "bucket-owner-read";
-          case ObjectCannedACL::bucket_owner_full_control:
-            return "bucket-owner-full-control";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForObjectCannedACL(ObjectCannedACL enumValue)
+        {
+          return GetNameForObjectCannedACLCStr(enumValue);
         }
 
       } // namespace ObjectCannedACLMapper
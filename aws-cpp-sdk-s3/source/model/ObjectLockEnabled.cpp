@@ -30,15 +30,30 @@ namespace Aws
       namespace ObjectLockEnabledMapper
       {
 
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Enabled",
+        };
 
         ObjectLockEnabled GetObjectLockEnabledForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enabled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ObjectLockEnabled::Enabled;
+          case 55059233:
+            if (name == "Enabled")
+            {
+              return ObjectLockEnabled::Enabled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ObjectLockEnabled::NOT_SET;
         }
 
-        Aws::String GetNameForObjectLockEnabled(ObjectLockEnabled enumValue)
+        const char* GetNameForObjectLockEnabledCStr(ObjectLockEnabled enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ObjectLockEnabled::Enabled:
-            return "Enabled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForObjectLockEnabled(ObjectLockEnabled enumValue)
+        {
+          return GetNameForObjectLockEnabledCStr(enumValue);
         }
 
       } // namespace ObjectLockEnabledMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ObjectLockLegalHoldStatusMapper
       {
 
-        static const int ON_HASH = HashingUtils::HashString("ON");
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ON",
+          "OFF",
+        };
 
         ObjectLockLegalHoldStatus GetObjectLockLegalHoldStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ON_HASH)
-          {
-            return ObjectLockLegalHoldStatus::ON;
-          }
-          else if (hashCode == OFF_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ObjectLockLegalHoldStatus::OFF;
+          case 2527:
+            if (name == "ON")
+            {
+              return ObjectLockLegalHoldStatus::ON;
+            }
+            break;
+          case 78159:
+            if (name == "OFF")
+            {
+              return ObjectLockLegalHoldStatus::OFF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ObjectLockLegalHoldStatus::NOT_SET;
         }
 
-        Aws::String GetNameForObjectLockLegalHoldStatus(ObjectLockLegalHoldStatus enumValue)
+        const char* GetNameForObjectLockLegalHoldStatusCStr(ObjectLockLegalHoldStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ObjectLockLegalHoldStatus::ON:
-            return "ON";
-          case ObjectLockLegalHoldStatus::OFF:
-            return "OFF";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForObjectLockLegalHoldStatus(ObjectLockLegalHoldStatus enumValue)
+        {
+          return GetNameForObjectLockLegalHoldStatusCStr(enumValue);
         }
 
       } // namespace ObjectLockLegalHoldStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ObjectLockModeMapper
       {
 
-        static const int GOVERNANCE_HASH = HashingUtils::HashString("GOVERNANCE");
-        static const int COMPLIANCE_HASH = HashingUtils::HashString("COMPLIANCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GOVERNANCE",
+          "COMPLIANCE",
+        };
 
         ObjectLockMode GetObjectLockModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GOVERNANCE_HASH)
-          {
-            return ObjectLockMode::GOVERNANCE;
-          }
-          else if (hashCode == COMPLIANCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ObjectLockMode::COMPLIANCE;
+          case 965145058:
+            if (name == "GOVERNANCE")
+            {
+              return ObjectLockMode::GOVERNANCE;
+            }
+            break;
+          case -52978661:
+            if (name == "COMPLIANCE")
+            {
+              return ObjectLockMode::COMPLIANCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ObjectLockMode::NOT_SET;
         }
 
-        Aws::String GetNameForObjectLockMode(ObjectLockMode enumValue)
+        const char* GetNameForObjectLockModeCStr(ObjectLockMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ObjectLockMode::GOVERNANCE:
-            return "GOVERNANCE";
-          case ObjectLockMode::COMPLIANCE:
-            return "COMPLIANCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForObjectLockMode(ObjectLockMode enumValue)
+        {
+          return GetNameForObjectLockModeCStr(enumValue);
         }
 
       } // namespace ObjectLockModeMapper
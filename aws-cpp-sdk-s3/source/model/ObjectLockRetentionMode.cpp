@@ -30,20 +30,37 @@ namespace Aws
       namespace ObjectLockRetentionModeMapper
       {
 
-        static const int GOVERNANCE_HASH = HashingUtils::HashString("GOVERNANCE");
-        static const int COMPLIANCE_HASH = HashingUtils::HashString("COMPLIANCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GOVERNANCE",
+          "COMPLIANCE",
+        };
 
         ObjectLockRetentionMode GetObjectLockRetentionModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GOVERNANCE_HASH)
-          {
-            return ObjectLockRetentionMode::GOVERNANCE;
-          }
-          else if (hashCode == COMPLIANCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ObjectLockRetentionMode::COMPLIANCE;
+          case 965145058:
+            if (name == "GOVERNANCE")
+            {
+              return ObjectLockRetentionMode::GOVERNANCE;
+            }
+            break;
+          case -52978661:
+            if (name == "COMPLIANCE")
+            {
+              return ObjectLockRetentionMode::COMPLIANCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ObjectLockRetentionMode::NOT_SET;
         }
 
-        Aws::String GetNameForObjectLockRetentionMode(ObjectLockRetentionMode enumValue)
+        const char* GetNameForObjectLockRetentionModeCStr(ObjectLockRetentionMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ObjectLockRetentionMode::GOVERNANCE:
-            return "GOVERNANCE";
-          case ObjectLockRetentionMode::COMPLIANCE:
-            return "COMPLIANCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForObjectLockRetentionMode(ObjectLockRetentionMode enumValue)
+        {
+          return GetNameForObjectLockRetentionModeCStr(enumValue);
         }
 
       } // namespace ObjectLockRetentionModeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace ObjectStorageClassMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int REDUCED_REDUNDANCY_HASH = HashingUtils::HashString("REDUCED_REDUNDANCY");
-        static const int GLACIER_HASH = HashingUtils::HashString("GLACIER");
-        static const int STANDARD_IA_HASH = HashingUtils::HashString("STANDARD_IA");
-        static const int ONEZONE_IA_HASH = HashingUtils::HashString("ONEZONE_IA");
-        static const int INTELLIGENT_TIERING_HASH = HashingUtils::HashString("INTELLIGENT_TIERING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STANDARD",
+          "REDUCED_REDUNDANCY",
+          "GLACIER",
+          "STANDARD_IA",
+          "ONEZONE_IA",
+          "INTELLIGENT_TIERING",
+        };
 
         ObjectStorageClass GetObjectStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
-          {
-            return ObjectStorageClass::STANDARD;
-          }
-          else if (hashCode == REDUCED_REDUNDANCY_HASH)
-          {
-            return ObjectStorageClass::REDUCED_REDUNDANCY;
-          }
-          else if (hashCode == GLACIER_HASH)
-          {
-            return ObjectStorageClass::GLACIER;
-          }
-          else if (hashCode == STANDARD_IA_HASH)
-          {
-            return ObjectStorageClass::STANDARD_IA;
-          }
-          else if (hashCode == ONEZONE_IA_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ObjectStorageClass::ONEZONE_IA;
-          }
-          else if (hashCode == INTELLIGENT_TIERING_HASH)
-          {
-            return ObjectStorageClass::INTELLIGENT_TIERING;
+          case 2095255229:
+            if (name == "STANDARD")
+            {
+              return ObjectStorageClass::STANDARD;
+            }
+            break;
+          case 246938206:
+            if (name == "REDUCED_REDUNDANCY")
+            {
+              return ObjectStorageClass::REDUCED_REDUNDANCY;
+            }
+            break;
+          case 826164623:
+            if (name == "GLACIER")
+            {
+              return ObjectStorageClass::GLACIER;
+            }
+            break;
+          case 988907994:
+            if (name == "STANDARD_IA")
+            {
+              return ObjectStorageClass::STANDARD_IA;
+            }
+            break;
+          case -1285524091:
+            if (name == "ONEZONE_IA")
+            {
+              return ObjectStorageClass::ONEZONE_IA;
+            }
+            break;
+          case 1305227448:
+            if (name == "INTELLIGENT_TIERING")
+            {
+              return ObjectStorageClass::INTELLIGENT_TIERING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ObjectStorageClass::NOT_SET;
         }
 
-        Aws::String GetNameForObjectStorageClass(ObjectStorageClass enumValue)
+        const char* GetNameForObjectStorageClassCStr(ObjectStorageClass enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ObjectStorageClass::STANDARD:
-            return "STANDARD";
-          case ObjectStorageClass::REDUCED_REDUNDANCY:
-            return "REDUCED_REDUNDANCY";
-          case ObjectStorageClass::GLACIER:
-            return "GLACIER";
-          case ObjectStorageClass::STANDARD_IA:
-            return "STANDARD_IA";
-          case ObjectStorageClass::ONEZONE_IA:
-            return "ONEZONE_IA";
-          case ObjectStorageClass::INTELLIGENT_TIERING:
-            return "INTELLIGENT_TIERING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForObjectStorageClass(ObjectStorageClass enumValue)
+        {
+          return GetNameForObjectStorageClassCStr(enumValue);
         }
 
       } // namespace ObjectStorageClassMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ObjectVersionStorageClassMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STANDARD",
+        };
 
         ObjectVersionStorageClass GetObjectVersionStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ObjectVersionStorageClass::STANDARD;
+          case 2095255229:
+            if (name == "STANDARD")
+            {
+              return ObjectVersionStorageClass::STANDARD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ObjectVersionStorageClass::NOT_SET;
         }
 
-        Aws::String GetNameForObjectVersionStorageClass(ObjectVersionStorageClass enumValue)
+        const char* GetNameForObjectVersionStorageClassCStr(ObjectVersionStorageClass enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ObjectVersionStorageClass::STANDARD:
-            return "STANDARD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForObjectVersionStorageClass(ObjectVersionStorageClass enumValue)
+        {
+          return GetNameForObjectVersionStorageClassCStr(enumValue);
         }
 
       } // namespace ObjectVersionStorageClassMapper
@@ -15,6 +15,7 @@
 
 #include <aws/s3/model/Owner.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/xml/XmlReader.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
@@ -66,6 +67,35 @@ Owner& Owner::operator =(const XmlNode& xmlNode)
   return *this;
 }
 
+Owner::Owner(XmlReader& xmlReader) : 
+    m_displayNameHasBeenSet(false),
+    m_iDHasBeenSet(false)
+{
+  *this = xmlReader;
+}
+
+Owner& Owner::operator =(XmlReader& xmlReader)
+{
+  while(xmlReader.NextChild())
+  {
+    if(xmlReader.IsName("DisplayName"))
+    {
+      m_displayName = xmlReader.ReadTrimmedText();
+      m_displayNameHasBeenSet = true;
+    }
+    else if(xmlReader.IsName("ID"))
+    {
+      m_iD = xmlReader.ReadTrimmedText();
+      m_iDHasBeenSet = true;
+    }
+    else
+    {
+      xmlReader.SkipElement();
+    }
+  }
+  return *this;
+}
+
 void Owner::AddToNode(XmlNode& parentNode) const
 {
   Aws::StringStream ss;
@@ -30,15 +30,30 @@ namespace Aws
       namespace OwnerOverrideMapper
       {
 
-        static const int Destination_HASH = HashingUtils::HashString("Destination");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Destination",
+        };
 
         OwnerOverride GetOwnerOverrideForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Destination_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OwnerOverride::Destination;
+          case 238021614:
+            if (name == "Destination")
+            {
+              return OwnerOverride::Destination;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return OwnerOverride::NOT_SET;
         }
 
-        Aws::String GetNameForOwnerOverride(OwnerOverride enumValue)
+        const char* GetNameForOwnerOverrideCStr(OwnerOverride enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OwnerOverride::Destination:
-            return "Destination";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOwnerOverride(OwnerOverride enumValue)
+        {
+          return GetNameForOwnerOverrideCStr(enumValue);
         }
 
       } // namespace OwnerOverrideMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PayerMapper
       {
 
-        static const int Requester_HASH = HashingUtils::HashString("Requester");
-        static const int BucketOwner_HASH = HashingUtils::HashString("BucketOwner");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Requester",
+          "BucketOwner",
+        };
 
         Payer GetPayerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Requester_HASH)
-          {
-            return Payer::Requester;
-          }
-          else if (hashCode == BucketOwner_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Payer::BucketOwner;
+          case -1597065380:
+            if (name == "Requester")
+            {
+              return Payer::Requester;
+            }
+            break;
+          case 1936982729:
+            if (name == "BucketOwner")
+            {
+              return Payer::BucketOwner;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Payer::NOT_SET;
         }
 
-        Aws::String GetNameForPayer(Payer enumValue)
+        const char* GetNameForPayerCStr(Payer enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Payer::Requester:
-            return "Requester";
-          case Payer::BucketOwner:
-            return "BucketOwner";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPayer(Payer enumValue)
+        {
+          return GetNameForPayerCStr(enumValue);
         }
 
       } // namespace PayerMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace PermissionMapper
       {
 
-        static const int FULL_CONTROL_HASH = HashingUtils::HashString("FULL_CONTROL");
-        static const int WRITE_HASH = HashingUtils::HashString("WRITE");
-        static const int WRITE_ACP_HASH = HashingUtils::HashString("WRITE_ACP");
-        static const int READ_HASH = HashingUtils::HashString("READ");
-        static const int READ_ACP_HASH = HashingUtils::HashString("READ_ACP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FULL_CONTROL",
+          "WRITE",
+          "WRITE_ACP",
+          "READ",
+          "READ_ACP",
+        };
 
         Permission GetPermissionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_CONTROL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Permission::FULL_CONTROL;
-          }
-          else if (hashCode == WRITE_HASH)
-          {
-            return Permission::WRITE;
-          }
-          else if (hashCode == WRITE_ACP_HASH)
-          {
-            return Permission::WRITE_ACP;
-          }
-          else if (hashCode == READ_HASH)
-          {
-            return Permission::READ;
-          }
-          else if (hashCode == READ_ACP_HASH)
-          {
-            return Permission::READ_ACP;
+          case 78885773:
+            if (name == "FULL_CONTROL")
+            {
+              return Permission::FULL_CONTROL;
+            }
+            break;
+          case 82862015:
+            if (name == "WRITE")
+            {
+              return Permission::WRITE;
+            }
+            break;
+          case 1381536750:
+            if (name == "WRITE_ACP")
+            {
+              return Permission::WRITE_ACP;
+            }
+            break;
+          case 2511254:
+            if (name == "READ")
+            {
+              return Permission::READ;
+            }
+            break;
+          case -83639739:
+            if (name == "READ_ACP")
+            {
+              return Permission::READ_ACP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return Permission::NOT_SET;
         }
 
-        Aws::String GetNameForPermission(Permission enumValue)
+        const char* GetNameForPermissionCStr(Permission enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Permission::FULL_CONTROL:
-            return "FULL_CONTROL";
-          case Permission::WRITE:
-            return "WRITE";
-          case Permission::WRITE_ACP:
-            return "WRITE_ACP";
-          case Permission::READ:
-            return "READ";
-          case Permission::READ_ACP:
-            return "READ_ACP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPermission(Permission enumValue)
+        {
+          return GetNameForPermissionCStr(enumValue);
         }
 
       } // namespace PermissionMapper
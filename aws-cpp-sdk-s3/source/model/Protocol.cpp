@@ -30,20 +30,37 @@ namespace Aws
       namespace ProtocolMapper
       {
 
-        static const int http_HASH = HashingUtils::HashString("http");
-        static const int https_HASH = HashingUtils::HashString("https");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "http",
+          "https",
+        };
 
         Protocol GetProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == http_HASH)
-          {
-            return Protocol::http;
-          }
-          else if (hashCode == https_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Protocol::https;
+          case 3213448:
+            if (name == "http")
+            {
+              return Protocol::http;
+            }
+            break;
+          case 99617003:
+            if (name == "https")
+            {
+              return Protocol::https;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return Protocol::NOT_SET;
         }
 
-        Aws::String GetNameForProtocol(Protocol enumValue)
+        const char* GetNameForProtocolCStr(Protocol enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Protocol::http:
-            return "http";
-          case Protocol::https:
-            return "https";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProtocol(Protocol enumValue)
+        {
+          return GetNameForProtocolCStr(enumValue);
         }
 
       } // namespace ProtocolMapper
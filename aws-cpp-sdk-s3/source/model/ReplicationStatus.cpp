@@ -30,30 +30,51 @@ namespace Aws
       namespace ReplicationStatusMapper
       {
 
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int REPLICA_HASH = HashingUtils::HashString("REPLICA");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COMPLETED",
+          "PENDING",
+          "FAILED",
+          "REPLICA",
+        };
 
         ReplicationStatus GetReplicationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLETED_HASH)
-          {
-            return ReplicationStatus::COMPLETED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return ReplicationStatus::PENDING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ReplicationStatus::FAILED;
-          }
-          else if (hashCode == REPLICA_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReplicationStatus::REPLICA;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return ReplicationStatus::COMPLETED;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ReplicationStatus::PENDING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ReplicationStatus::FAILED;
+            }
+            break;
+          case 1812487320:
+            if (name == "REPLICA")
+            {
+              return ReplicationStatus::REPLICA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ReplicationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReplicationStatus(ReplicationStatus enumValue)
+        const char* GetNameForReplicationStatusCStr(ReplicationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReplicationStatus::COMPLETED:
-            return "COMPLETED";
-          case ReplicationStatus::PENDING:
-            return "PENDING";
-          case ReplicationStatus::FAILED:
-            return "FAILED";
-          case ReplicationStatus::REPLICA:
-            return "REPLICA";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReplicationStatus(ReplicationStatus enumValue)
+        {
+          return GetNameForReplicationStatusCStr(enumValue);
         }
 
       } // namespace ReplicationStatusMapper
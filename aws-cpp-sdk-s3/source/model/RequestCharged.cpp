@@ -30,15 +30,30 @@ namespace Aws
       namespace RequestChargedMapper
       {
 
-        static const int requester_HASH = HashingUtils::HashString("requester");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "requester",
+        };
 
         RequestCharged GetRequestChargedForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == requester_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RequestCharged::requester;
+          case 693933948:
+            if (name == "requester")
+            {
+              return RequestCharged::requester;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return RequestCharged::NOT_SET;
         }
 
-        Aws::String GetNameForRequestCharged(RequestCharged enumValue)
+        const char* GetNameForRequestChargedCStr(RequestCharged enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RequestCharged::requester:
-            return "requester";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRequestCharged(RequestCharged enumValue)
+        {
+          return GetNameForRequestChargedCStr(enumValue);
         }
 
       } // namespace RequestChargedMapper
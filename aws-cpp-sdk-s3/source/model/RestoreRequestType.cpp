@@ -30,15 +30,30 @@ namespace Aws
       namespace RestoreRequestTypeMapper
       {
 
-        static const int SELECT_HASH = HashingUtils::HashString("SELECT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SELECT",
+        };
 
         RestoreRequestType GetRestoreRequestTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SELECT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RestoreRequestType::SELECT;
+          case -1852692228:
+            if (name == "SELECT")
+            {
+              return RestoreRequestType::SELECT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return RestoreRequestType::NOT_SET;
         }
 
-        Aws::String GetNameForRestoreRequestType(RestoreRequestType enumValue)
+        const char* GetNameForRestoreRequestTypeCStr(RestoreRequestType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RestoreRequestType::SELECT:
-            return "SELECT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRestoreRequestType(RestoreRequestType enumValue)
+        {
+          return GetNameForRestoreRequestTypeCStr(enumValue);
         }
 
       } // namespace RestoreRequestTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ServerSideEncryptionMapper
       {
 
-        static const int AES256_HASH = HashingUtils::HashString("AES256");
-        static const int aws_kms_HASH = HashingUtils::HashString("aws:kms");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AES256",
+          "aws:kms",
+        };
 
         ServerSideEncryption GetServerSideEncryptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES256_HASH)
-          {
-            return ServerSideEncryption::AES256;
-          }
-          else if (hashCode == aws_kms_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServerSideEncryption::aws_kms;
+          case 1927140164:
+            if (name == "AES256")
+            {
+              return ServerSideEncryption::AES256;
+            }
+            break;
+          case -591548076:
+            if (name == "aws:kms")
+            {
+              return ServerSideEncryption::aws_kms;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ServerSideEncryption::NOT_SET;
         }
 
-        Aws::String GetNameForServerSideEncryption(ServerSideEncryption enumValue)
+        const char* GetNameForServerSideEncryptionCStr(ServerSideEncryption enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServerSideEncryption::AES256:
-            return "AES256";
-          case ServerSideEncryption::aws_kms:
-            return "aws:kms";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServerSideEncryption(ServerSideEncryption enumValue)
+        {
+          return GetNameForServerSideEncryptionCStr(enumValue);
         }
 
       } // namespace ServerSideEncryptionMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace StorageClassAnalysisSchemaVersionMapper
       {
 
-        static const int V_1_HASH = HashingUtils::HashString("V_1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "V_1",
+        };
 
         StorageClassAnalysisSchemaVersion GetStorageClassAnalysisSchemaVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == V_1_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StorageClassAnalysisSchemaVersion::V_1;
+          case 85640:
+            if (name == "V_1")
+            {
+              return StorageClassAnalysisSchemaVersion::V_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return StorageClassAnalysisSchemaVersion::NOT_SET;
         }
 
-        Aws::String GetNameForStorageClassAnalysisSchemaVersion(StorageClassAnalysisSchemaVersion enumValue)
+        const char* GetNameForStorageClassAnalysisSchemaVersionCStr(StorageClassAnalysisSchemaVersion enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StorageClassAnalysisSchemaVersion::V_1:
-            return "V_1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStorageClassAnalysisSchemaVersion(StorageClassAnalysisSchemaVersion enumValue)
+        {
+          return GetNameForStorageClassAnalysisSchemaVersionCStr(enumValue);
         }
 
       } // namespace StorageClassAnalysisSchemaVersionMapper
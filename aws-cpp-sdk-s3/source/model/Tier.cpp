@@ -30,25 +30,44 @@ namespace Aws
       namespace TierMapper
       {
 
-        static const int Standard_HASH = HashingUtils::HashString("Standard");
-        static const int Bulk_HASH = HashingUtils::HashString("Bulk");
-        static const int Expedited_HASH = HashingUtils::HashString("Expedited");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Standard",
+          "Bulk",
+          "Expedited",
+        };
 
         Tier GetTierForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Standard_HASH)
-          {
-            return Tier::Standard;
-          }
-          else if (hashCode == Bulk_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Tier::Bulk;
-          }
-          else if (hashCode == Expedited_HASH)
-          {
-            return Tier::Expedited;
+          case 1377272541:
+            if (name == "Standard")
+            {
+              return Tier::Standard;
+            }
+            break;
+          case 2082098:
+            if (name == "Bulk")
+            {
+              return Tier::Bulk;
+            }
+            break;
+          case 2126839910:
+            if (name == "Expedited")
+            {
+              return Tier::Expedited;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Tier::NOT_SET;
         }
 
-        Aws::String GetNameForTier(Tier enumValue)
+        const char* GetNameForTierCStr(Tier enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Tier::Standard:
-            return "Standard";
-          case Tier::Bulk:
-            return "Bulk";
-          case Tier::Expedited:
-            return "Expedited";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTier(Tier enumValue)
+        {
+          return GetNameForTierCStr(enumValue);
         }
 
       } // namespace TierMapper
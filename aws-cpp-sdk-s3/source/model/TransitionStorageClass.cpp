@@ -30,30 +30,51 @@ namespace Aws
       namespace TransitionStorageClassMapper
       {
 
-        static const int GLACIER_HASH = HashingUtils::HashString("GLACIER");
-        static const int STANDARD_IA_HASH = HashingUtils::HashString("STANDARD_IA");
-        static const int ONEZONE_IA_HASH = HashingUtils::HashString("ONEZONE_IA");
-        static const int INTELLIGENT_TIERING_HASH = HashingUtils::HashString("INTELLIGENT_TIERING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GLACIER",
+          "STANDARD_IA",
+          "ONEZONE_IA",
+          "INTELLIGENT_TIERING",
+        };
 
         TransitionStorageClass GetTransitionStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GLACIER_HASH)
-          {
-            return TransitionStorageClass::GLACIER;
-          }
-          else if (hashCode == STANDARD_IA_HASH)
-          {
-            return TransitionStorageClass::STANDARD_IA;
-          }
-          else if (hashCode == ONEZONE_IA_HASH)
-          {
-            return TransitionStorageClass::ONEZONE_IA;
-          }
-          else if (hashCode == INTELLIGENT_TIERING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TransitionStorageClass::INTELLIGENT_TIERING;
+          case 826164623:
+            if (name == "GLACIER")
+            {
+              return TransitionStorageClass::GLACIER;
+            }
+            break;
+          case 988907994:
+            if (name == "STANDARD_IA")
+            {
+              return TransitionStorageClass::STANDARD_IA;
+            }
+            break;
+          case -1285524091:
+            if (name == "ONEZONE_IA")
+            {
+              return TransitionStorageClass::ONEZONE_IA;
+            }
+            break;
+          case 1305227448:
+            if (name == "INTELLIGENT_TIERING")
+            {
+              return TransitionStorageClass::INTELLIGENT_TIERING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return TransitionStorageClass::NOT_SET;
         }
 
-        Aws::String GetNameForTransitionStorageClass(TransitionStorageClass enumValue)
+        const char* GetNameForTransitionStorageClassCStr(TransitionStorageClass enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TransitionStorageClass::GLACIER:
-            return "GLACIER";
-          case TransitionStorageClass::STANDARD_IA:
-            return "STANDARD_IA";
-          case TransitionStorageClass::ONEZONE_IA:
-            return "ONEZONE_IA";
-          case TransitionStorageClass::INTELLIGENT_TIERING:
-            return "INTELLIGENT_TIERING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransitionStorageClass(TransitionStorageClass enumValue)
+        {
+          return GetNameForTransitionStorageClassCStr(enumValue);
         }
 
       } // namespace TransitionStorageClassMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TypeMapper
       {
 
-        static const int CanonicalUser_HASH = HashingUtils::HashString("CanonicalUser");
-        static const int AmazonCustomerByEmail_HASH = HashingUtils::HashString("AmazonCustomerByEmail");
-        static const int Group_HASH = HashingUtils::HashString("Group");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CanonicalUser",
+          "AmazonCustomerByEmail",
+          "Group",
+        };
 
         Type GetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CanonicalUser_HASH)
-          {
-            return Type::CanonicalUser;
-          }
-          else if (hashCode == AmazonCustomerByEmail_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Type::AmazonCustomerByEmail;
-          }
-          else if (hashCode == Group_HASH)
-          {
-            return Type::Group;
+          case -1373398337:
+            if (name == "CanonicalUser")
+            {
+              return Type::CanonicalUser;
+            }
+            break;
+          case 2111195395:
+            if (name == "AmazonCustomerByEmail")
+            {
+              return Type::AmazonCustomerByEmail;
+            }
+            break;
+          case 69076575:
+            if (name == "Group")
+            {
+              return Type::Group;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Type::NOT_SET;
         }
 
-        Aws::String GetNameForType(Type enumValue)
+        const char* GetNameForTypeCStr(Type enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Type::CanonicalUser:
-            return "CanonicalUser";
-          case Type::AmazonCustomerByEmail:
-            return "AmazonCustomerByEmail";
-          case Type::Group:
-            return "Group";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForType(Type enumValue)
+        {
+          return GetNameForTypeCStr(enumValue);
         }
 
       } // namespace TypeMapper
@@ -35,6 +35,11 @@ namespace AlgorithmSortByMapper
 AWS_SAGEMAKER_API AlgorithmSortBy GetAlgorithmSortByForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForAlgorithmSortBy(AlgorithmSortBy value);
+
+/**
+ * Same as GetNameForAlgorithmSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForAlgorithmSortByCStr(AlgorithmSortBy value);
 } // namespace AlgorithmSortByMapper
 } // namespace Model
 } // namespace SageMaker
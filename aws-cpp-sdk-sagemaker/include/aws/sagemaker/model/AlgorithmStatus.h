@@ -38,6 +38,11 @@ namespace AlgorithmStatusMapper
 AWS_SAGEMAKER_API AlgorithmStatus GetAlgorithmStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForAlgorithmStatus(AlgorithmStatus value);
+
+/**
+ * Same as GetNameForAlgorithmStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForAlgorithmStatusCStr(AlgorithmStatus value);
 } // namespace AlgorithmStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace AssemblyTypeMapper
 AWS_SAGEMAKER_API AssemblyType GetAssemblyTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForAssemblyType(AssemblyType value);
+
+/**
+ * Same as GetNameForAssemblyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForAssemblyTypeCStr(AssemblyType value);
 } // namespace AssemblyTypeMapper
 } // namespace Model
 } // namespace SageMaker
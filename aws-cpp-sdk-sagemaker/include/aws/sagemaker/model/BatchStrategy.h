@@ -35,6 +35,11 @@ namespace BatchStrategyMapper
 AWS_SAGEMAKER_API BatchStrategy GetBatchStrategyForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForBatchStrategy(BatchStrategy value);
+
+/**
+ * Same as GetNameForBatchStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForBatchStrategyCStr(BatchStrategy value);
 } // namespace BatchStrategyMapper
 } // namespace Model
 } // namespace SageMaker
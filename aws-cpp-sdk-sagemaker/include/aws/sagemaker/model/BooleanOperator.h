@@ -35,6 +35,11 @@ namespace BooleanOperatorMapper
 AWS_SAGEMAKER_API BooleanOperator GetBooleanOperatorForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForBooleanOperator(BooleanOperator value);
+
+/**
+ * Same as GetNameForBooleanOperator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForBooleanOperatorCStr(BooleanOperator value);
 } // namespace BooleanOperatorMapper
 } // namespace Model
 } // namespace SageMaker
@@ -36,6 +36,11 @@ namespace CodeRepositorySortByMapper
 AWS_SAGEMAKER_API CodeRepositorySortBy GetCodeRepositorySortByForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForCodeRepositorySortBy(CodeRepositorySortBy value);
+
+/**
+ * Same as GetNameForCodeRepositorySortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForCodeRepositorySortByCStr(CodeRepositorySortBy value);
 } // namespace CodeRepositorySortByMapper
 } // namespace Model
 } // namespace SageMaker
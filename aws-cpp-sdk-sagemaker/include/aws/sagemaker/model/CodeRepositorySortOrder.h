@@ -35,6 +35,11 @@ namespace CodeRepositorySortOrderMapper
 AWS_SAGEMAKER_API CodeRepositorySortOrder GetCodeRepositorySortOrderForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForCodeRepositorySortOrder(CodeRepositorySortOrder value);
+
+/**
+ * Same as GetNameForCodeRepositorySortOrder(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForCodeRepositorySortOrderCStr(CodeRepositorySortOrder value);
 } // namespace CodeRepositorySortOrderMapper
 } // namespace Model
 } // namespace SageMaker
@@ -39,6 +39,11 @@ namespace CompilationJobStatusMapper
 AWS_SAGEMAKER_API CompilationJobStatus GetCompilationJobStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForCompilationJobStatus(CompilationJobStatus value);
+
+/**
+ * Same as GetNameForCompilationJobStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForCompilationJobStatusCStr(CompilationJobStatus value);
 } // namespace CompilationJobStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace CompressionTypeMapper
 AWS_SAGEMAKER_API CompressionType GetCompressionTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForCompressionType(CompressionType value);
+
+/**
+ * Same as GetNameForCompressionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForCompressionTypeCStr(CompressionType value);
 } // namespace CompressionTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace ContentClassifierMapper
 AWS_SAGEMAKER_API ContentClassifier GetContentClassifierForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForContentClassifier(ContentClassifier value);
+
+/**
+ * Same as GetNameForContentClassifier(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForContentClassifierCStr(ContentClassifier value);
 } // namespace ContentClassifierMapper
 } // namespace Model
 } // namespace SageMaker
@@ -37,6 +37,11 @@ namespace DetailedAlgorithmStatusMapper
 AWS_SAGEMAKER_API DetailedAlgorithmStatus GetDetailedAlgorithmStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForDetailedAlgorithmStatus(DetailedAlgorithmStatus value);
+
+/**
+ * Same as GetNameForDetailedAlgorithmStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForDetailedAlgorithmStatusCStr(DetailedAlgorithmStatus value);
 } // namespace DetailedAlgorithmStatusMapper
 } // namespace Model
 } // namespace SageMaker
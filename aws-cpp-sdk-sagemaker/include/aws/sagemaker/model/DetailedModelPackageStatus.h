@@ -37,6 +37,11 @@ namespace DetailedModelPackageStatusMapper
 AWS_SAGEMAKER_API DetailedModelPackageStatus GetDetailedModelPackageStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForDetailedModelPackageStatus(DetailedModelPackageStatus value);
+
+/**
+ * Same as GetNameForDetailedModelPackageStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForDetailedModelPackageStatusCStr(DetailedModelPackageStatus value);
 } // namespace DetailedModelPackageStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace DirectInternetAccessMapper
 AWS_SAGEMAKER_API DirectInternetAccess GetDirectInternetAccessForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForDirectInternetAccess(DirectInternetAccess value);
+
+/**
+ * Same as GetNameForDirectInternetAccess(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForDirectInternetAccessCStr(DirectInternetAccess value);
 } // namespace DirectInternetAccessMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace EndpointConfigSortKeyMapper
 AWS_SAGEMAKER_API EndpointConfigSortKey GetEndpointConfigSortKeyForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForEndpointConfigSortKey(EndpointConfigSortKey value);
+
+/**
+ * Same as GetNameForEndpointConfigSortKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForEndpointConfigSortKeyCStr(EndpointConfigSortKey value);
 } // namespace EndpointConfigSortKeyMapper
 } // namespace Model
 } // namespace SageMaker
@@ -36,6 +36,11 @@ namespace EndpointSortKeyMapper
 AWS_SAGEMAKER_API EndpointSortKey GetEndpointSortKeyForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForEndpointSortKey(EndpointSortKey value);
+
+/**
+ * Same as GetNameForEndpointSortKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForEndpointSortKeyCStr(EndpointSortKey value);
 } // namespace EndpointSortKeyMapper
 } // namespace Model
 } // namespace SageMaker
@@ -41,6 +41,11 @@ namespace EndpointStatusMapper
 AWS_SAGEMAKER_API EndpointStatus GetEndpointStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForEndpointStatus(EndpointStatus value);
+
+/**
+ * Same as GetNameForEndpointStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForEndpointStatusCStr(EndpointStatus value);
 } // namespace EndpointStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -38,6 +38,11 @@ namespace FrameworkMapper
 AWS_SAGEMAKER_API Framework GetFrameworkForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForFramework(Framework value);
+
+/**
+ * Same as GetNameForFramework(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForFrameworkCStr(Framework value);
 } // namespace FrameworkMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace HyperParameterTuningJobObjectiveTypeMapper
 AWS_SAGEMAKER_API HyperParameterTuningJobObjectiveType GetHyperParameterTuningJobObjectiveTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForHyperParameterTuningJobObjectiveType(HyperParameterTuningJobObjectiveType value);
+
+/**
+ * Same as GetNameForHyperParameterTuningJobObjectiveType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForHyperParameterTuningJobObjectiveTypeCStr(HyperParameterTuningJobObjectiveType value);
 } // namespace HyperParameterTuningJobObjectiveTypeMapper
 } // namespace Model
 } // namespace SageMaker
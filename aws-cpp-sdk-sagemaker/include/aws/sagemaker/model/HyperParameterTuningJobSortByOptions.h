@@ -36,6 +36,11 @@ namespace HyperParameterTuningJobSortByOptionsMapper
 AWS_SAGEMAKER_API HyperParameterTuningJobSortByOptions GetHyperParameterTuningJobSortByOptionsForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForHyperParameterTuningJobSortByOptions(HyperParameterTuningJobSortByOptions value);
+
+/**
+ * Same as GetNameForHyperParameterTuningJobSortByOptions(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForHyperParameterTuningJobSortByOptionsCStr(HyperParameterTuningJobSortByOptions value);
 } // namespace HyperParameterTuningJobSortByOptionsMapper
 } // namespace Model
 } // namespace SageMaker
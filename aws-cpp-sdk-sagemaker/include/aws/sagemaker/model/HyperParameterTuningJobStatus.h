@@ -38,6 +38,11 @@ namespace HyperParameterTuningJobStatusMapper
 AWS_SAGEMAKER_API HyperParameterTuningJobStatus GetHyperParameterTuningJobStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForHyperParameterTuningJobStatus(HyperParameterTuningJobStatus value);
+
+/**
+ * Same as GetNameForHyperParameterTuningJobStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForHyperParameterTuningJobStatusCStr(HyperParameterTuningJobStatus value);
 } // namespace HyperParameterTuningJobStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -34,6 +34,11 @@ namespace HyperParameterTuningJobStrategyTypeMapper
 AWS_SAGEMAKER_API HyperParameterTuningJobStrategyType GetHyperParameterTuningJobStrategyTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForHyperParameterTuningJobStrategyType(HyperParameterTuningJobStrategyType value);
+
+/**
+ * Same as GetNameForHyperParameterTuningJobStrategyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForHyperParameterTuningJobStrategyTypeCStr(HyperParameterTuningJobStrategyType value);
 } // namespace HyperParameterTuningJobStrategyTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace HyperParameterTuningJobWarmStartTypeMapper
 AWS_SAGEMAKER_API HyperParameterTuningJobWarmStartType GetHyperParameterTuningJobWarmStartTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForHyperParameterTuningJobWarmStartType(HyperParameterTuningJobWarmStartType value);
+
+/**
+ * Same as GetNameForHyperParameterTuningJobWarmStartType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForHyperParameterTuningJobWarmStartTypeCStr(HyperParameterTuningJobWarmStartType value);
 } // namespace HyperParameterTuningJobWarmStartTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -71,6 +71,11 @@ namespace InstanceTypeMapper
 AWS_SAGEMAKER_API InstanceType GetInstanceTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForInstanceType(InstanceType value);
+
+/**
+ * Same as GetNameForInstanceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForInstanceTypeCStr(InstanceType value);
 } // namespace InstanceTypeMapper
 } // namespace Model
 } // namespace SageMaker
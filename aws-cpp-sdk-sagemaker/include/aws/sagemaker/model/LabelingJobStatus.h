@@ -38,6 +38,11 @@ namespace LabelingJobStatusMapper
 AWS_SAGEMAKER_API LabelingJobStatus GetLabelingJobStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForLabelingJobStatus(LabelingJobStatus value);
+
+/**
+ * Same as GetNameForLabelingJobStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForLabelingJobStatusCStr(LabelingJobStatus value);
 } // namespace LabelingJobStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -36,6 +36,11 @@ namespace ListCompilationJobsSortByMapper
 AWS_SAGEMAKER_API ListCompilationJobsSortBy GetListCompilationJobsSortByForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForListCompilationJobsSortBy(ListCompilationJobsSortBy value);
+
+/**
+ * Same as GetNameForListCompilationJobsSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForListCompilationJobsSortByCStr(ListCompilationJobsSortBy value);
 } // namespace ListCompilationJobsSortByMapper
 } // namespace Model
 } // namespace SageMaker
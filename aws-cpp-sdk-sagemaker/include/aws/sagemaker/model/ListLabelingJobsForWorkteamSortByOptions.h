@@ -34,6 +34,11 @@ namespace ListLabelingJobsForWorkteamSortByOptionsMapper
 AWS_SAGEMAKER_API ListLabelingJobsForWorkteamSortByOptions GetListLabelingJobsForWorkteamSortByOptionsForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForListLabelingJobsForWorkteamSortByOptions(ListLabelingJobsForWorkteamSortByOptions value);
+
+/**
+ * Same as GetNameForListLabelingJobsForWorkteamSortByOptions(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForListLabelingJobsForWorkteamSortByOptionsCStr(ListLabelingJobsForWorkteamSortByOptions value);
 } // namespace ListLabelingJobsForWorkteamSortByOptionsMapper
 } // namespace Model
 } // namespace SageMaker
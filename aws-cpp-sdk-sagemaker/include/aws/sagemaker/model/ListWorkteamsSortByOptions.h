@@ -35,6 +35,11 @@ namespace ListWorkteamsSortByOptionsMapper
 AWS_SAGEMAKER_API ListWorkteamsSortByOptions GetListWorkteamsSortByOptionsForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForListWorkteamsSortByOptions(ListWorkteamsSortByOptions value);
+
+/**
+ * Same as GetNameForListWorkteamsSortByOptions(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForListWorkteamsSortByOptionsCStr(ListWorkteamsSortByOptions value);
 } // namespace ListWorkteamsSortByOptionsMapper
 } // namespace Model
 } // namespace SageMaker
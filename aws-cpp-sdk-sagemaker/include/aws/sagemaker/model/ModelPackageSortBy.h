@@ -35,6 +35,11 @@ namespace ModelPackageSortByMapper
 AWS_SAGEMAKER_API ModelPackageSortBy GetModelPackageSortByForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForModelPackageSortBy(ModelPackageSortBy value);
+
+/**
+ * Same as GetNameForModelPackageSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForModelPackageSortByCStr(ModelPackageSortBy value);
 } // namespace ModelPackageSortByMapper
 } // namespace Model
 } // namespace SageMaker
@@ -38,6 +38,11 @@ namespace ModelPackageStatusMapper
 AWS_SAGEMAKER_API ModelPackageStatus GetModelPackageStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForModelPackageStatus(ModelPackageStatus value);
+
+/**
+ * Same as GetNameForModelPackageStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForModelPackageStatusCStr(ModelPackageStatus value);
 } // namespace ModelPackageStatusMapper
 } // namespace Model
 } // namespace SageMaker
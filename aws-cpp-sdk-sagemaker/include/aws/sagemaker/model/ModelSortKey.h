@@ -35,6 +35,11 @@ namespace ModelSortKeyMapper
 AWS_SAGEMAKER_API ModelSortKey GetModelSortKeyForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForModelSortKey(ModelSortKey value);
+
+/**
+ * Same as GetNameForModelSortKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForModelSortKeyCStr(ModelSortKey value);
 } // namespace ModelSortKeyMapper
 } // namespace Model
 } // namespace SageMaker
@@ -36,6 +36,11 @@ namespace NotebookInstanceAcceleratorTypeMapper
 AWS_SAGEMAKER_API NotebookInstanceAcceleratorType GetNotebookInstanceAcceleratorTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForNotebookInstanceAcceleratorType(NotebookInstanceAcceleratorType value);
+
+/**
+ * Same as GetNameForNotebookInstanceAcceleratorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForNotebookInstanceAcceleratorTypeCStr(NotebookInstanceAcceleratorType value);
 } // namespace NotebookInstanceAcceleratorTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -36,6 +36,11 @@ namespace NotebookInstanceLifecycleConfigSortKeyMapper
 AWS_SAGEMAKER_API NotebookInstanceLifecycleConfigSortKey GetNotebookInstanceLifecycleConfigSortKeyForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForNotebookInstanceLifecycleConfigSortKey(NotebookInstanceLifecycleConfigSortKey value);
+
+/**
+ * Same as GetNameForNotebookInstanceLifecycleConfigSortKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForNotebookInstanceLifecycleConfigSortKeyCStr(NotebookInstanceLifecycleConfigSortKey value);
 } // namespace NotebookInstanceLifecycleConfigSortKeyMapper
 } // namespace Model
 } // namespace SageMaker
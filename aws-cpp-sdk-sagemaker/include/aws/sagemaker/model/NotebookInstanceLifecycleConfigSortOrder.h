@@ -35,6 +35,11 @@ namespace NotebookInstanceLifecycleConfigSortOrderMapper
 AWS_SAGEMAKER_API NotebookInstanceLifecycleConfigSortOrder GetNotebookInstanceLifecycleConfigSortOrderForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForNotebookInstanceLifecycleConfigSortOrder(NotebookInstanceLifecycleConfigSortOrder value);
+
+/**
+ * Same as GetNameForNotebookInstanceLifecycleConfigSortOrder(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForNotebookInstanceLifecycleConfigSortOrderCStr(NotebookInstanceLifecycleConfigSortOrder value);
 } // namespace NotebookInstanceLifecycleConfigSortOrderMapper
 } // namespace Model
 } // namespace SageMaker
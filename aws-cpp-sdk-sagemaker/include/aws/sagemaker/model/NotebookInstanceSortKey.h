@@ -36,6 +36,11 @@ namespace NotebookInstanceSortKeyMapper
 AWS_SAGEMAKER_API NotebookInstanceSortKey GetNotebookInstanceSortKeyForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForNotebookInstanceSortKey(NotebookInstanceSortKey value);
+
+/**
+ * Same as GetNameForNotebookInstanceSortKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForNotebookInstanceSortKeyCStr(NotebookInstanceSortKey value);
 } // namespace NotebookInstanceSortKeyMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace NotebookInstanceSortOrderMapper
 AWS_SAGEMAKER_API NotebookInstanceSortOrder GetNotebookInstanceSortOrderForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForNotebookInstanceSortOrder(NotebookInstanceSortOrder value);
+
+/**
+ * Same as GetNameForNotebookInstanceSortOrder(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForNotebookInstanceSortOrderCStr(NotebookInstanceSortOrder value);
 } // namespace NotebookInstanceSortOrderMapper
 } // namespace Model
 } // namespace SageMaker
@@ -40,6 +40,11 @@ namespace NotebookInstanceStatusMapper
 AWS_SAGEMAKER_API NotebookInstanceStatus GetNotebookInstanceStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForNotebookInstanceStatus(NotebookInstanceStatus value);
+
+/**
+ * Same as GetNameForNotebookInstanceStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForNotebookInstanceStatusCStr(NotebookInstanceStatus value);
 } // namespace NotebookInstanceStatusMapper
 } // namespace Model
 } // namespace SageMaker
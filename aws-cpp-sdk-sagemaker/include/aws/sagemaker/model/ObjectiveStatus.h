@@ -36,6 +36,11 @@ namespace ObjectiveStatusMapper
 AWS_SAGEMAKER_API ObjectiveStatus GetObjectiveStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForObjectiveStatus(ObjectiveStatus value);
+
+/**
+ * Same as GetNameForObjectiveStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForObjectiveStatusCStr(ObjectiveStatus value);
 } // namespace ObjectiveStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -40,6 +40,11 @@ namespace OperatorMapper
 AWS_SAGEMAKER_API Operator GetOperatorForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForOperator(Operator value);
+
+/**
+ * Same as GetNameForOperator(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForOperatorCStr(Operator value);
 } // namespace OperatorMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace OrderKeyMapper
 AWS_SAGEMAKER_API OrderKey GetOrderKeyForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForOrderKey(OrderKey value);
+
+/**
+ * Same as GetNameForOrderKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForOrderKeyCStr(OrderKey value);
 } // namespace OrderKeyMapper
 } // namespace Model
 } // namespace SageMaker
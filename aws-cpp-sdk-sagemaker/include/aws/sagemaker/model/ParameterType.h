@@ -37,6 +37,11 @@ namespace ParameterTypeMapper
 AWS_SAGEMAKER_API ParameterType GetParameterTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForParameterType(ParameterType value);
+
+/**
+ * Same as GetNameForParameterType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForParameterTypeCStr(ParameterType value);
 } // namespace ParameterTypeMapper
 } // namespace Model
 } // namespace SageMaker
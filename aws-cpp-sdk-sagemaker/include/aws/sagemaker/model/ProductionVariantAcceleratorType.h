@@ -36,6 +36,11 @@ namespace ProductionVariantAcceleratorTypeMapper
 AWS_SAGEMAKER_API ProductionVariantAcceleratorType GetProductionVariantAcceleratorTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForProductionVariantAcceleratorType(ProductionVariantAcceleratorType value);
+
+/**
+ * Same as GetNameForProductionVariantAcceleratorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForProductionVariantAcceleratorTypeCStr(ProductionVariantAcceleratorType value);
 } // namespace ProductionVariantAcceleratorTypeMapper
 } // namespace Model
 } // namespace SageMaker
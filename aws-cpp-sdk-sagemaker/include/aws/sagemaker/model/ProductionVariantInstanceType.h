@@ -65,6 +65,11 @@ namespace ProductionVariantInstanceTypeMapper
 AWS_SAGEMAKER_API ProductionVariantInstanceType GetProductionVariantInstanceTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForProductionVariantInstanceType(ProductionVariantInstanceType value);
+
+/**
+ * Same as GetNameForProductionVariantInstanceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForProductionVariantInstanceTypeCStr(ProductionVariantInstanceType value);
 } // namespace ProductionVariantInstanceTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace RecordWrapperMapper
 AWS_SAGEMAKER_API RecordWrapper GetRecordWrapperForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForRecordWrapper(RecordWrapper value);
+
+/**
+ * Same as GetNameForRecordWrapper(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForRecordWrapperCStr(RecordWrapper value);
 } // namespace RecordWrapperMapper
 } // namespace Model
 } // namespace SageMaker
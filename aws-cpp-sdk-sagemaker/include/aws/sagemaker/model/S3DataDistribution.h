@@ -35,6 +35,11 @@ namespace S3DataDistributionMapper
 AWS_SAGEMAKER_API S3DataDistribution GetS3DataDistributionForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForS3DataDistribution(S3DataDistribution value);
+
+/**
+ * Same as GetNameForS3DataDistribution(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForS3DataDistributionCStr(S3DataDistribution value);
 } // namespace S3DataDistributionMapper
 } // namespace Model
 } // namespace SageMaker
@@ -36,6 +36,11 @@ namespace S3DataTypeMapper
 AWS_SAGEMAKER_API S3DataType GetS3DataTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForS3DataType(S3DataType value);
+
+/**
+ * Same as GetNameForS3DataType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForS3DataTypeCStr(S3DataType value);
 } // namespace S3DataTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace SearchSortOrderMapper
 AWS_SAGEMAKER_API SearchSortOrder GetSearchSortOrderForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForSearchSortOrder(SearchSortOrder value);
+
+/**
+ * Same as GetNameForSearchSortOrder(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForSearchSortOrderCStr(SearchSortOrder value);
 } // namespace SearchSortOrderMapper
 } // namespace Model
 } // namespace SageMaker
@@ -45,6 +45,11 @@ namespace SecondaryStatusMapper
 AWS_SAGEMAKER_API SecondaryStatus GetSecondaryStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForSecondaryStatus(SecondaryStatus value);
+
+/**
+ * Same as GetNameForSecondaryStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForSecondaryStatusCStr(SecondaryStatus value);
 } // namespace SecondaryStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -36,6 +36,11 @@ namespace SortByMapper
 AWS_SAGEMAKER_API SortBy GetSortByForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForSortBy(SortBy value);
+
+/**
+ * Same as GetNameForSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForSortByCStr(SortBy value);
 } // namespace SortByMapper
 } // namespace Model
 } // namespace SageMaker
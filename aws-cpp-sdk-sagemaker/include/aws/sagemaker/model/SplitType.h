@@ -37,6 +37,11 @@ namespace SplitTypeMapper
 AWS_SAGEMAKER_API SplitType GetSplitTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForSplitType(SplitType value);
+
+/**
+ * Same as GetNameForSplitType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForSplitTypeCStr(SplitType value);
 } // namespace SplitTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -43,6 +43,11 @@ namespace TargetDeviceMapper
 AWS_SAGEMAKER_API TargetDevice GetTargetDeviceForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForTargetDevice(TargetDevice value);
+
+/**
+ * Same as GetNameForTargetDevice(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForTargetDeviceCStr(TargetDevice value);
 } // namespace TargetDeviceMapper
 } // namespace Model
 } // namespace SageMaker
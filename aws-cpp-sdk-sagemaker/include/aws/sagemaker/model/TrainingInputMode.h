@@ -35,6 +35,11 @@ namespace TrainingInputModeMapper
 AWS_SAGEMAKER_API TrainingInputMode GetTrainingInputModeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForTrainingInputMode(TrainingInputMode value);
+
+/**
+ * Same as GetNameForTrainingInputMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForTrainingInputModeCStr(TrainingInputMode value);
 } // namespace TrainingInputModeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -59,6 +59,11 @@ namespace TrainingInstanceTypeMapper
 AWS_SAGEMAKER_API TrainingInstanceType GetTrainingInstanceTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForTrainingInstanceType(TrainingInstanceType value);
+
+/**
+ * Same as GetNameForTrainingInstanceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForTrainingInstanceTypeCStr(TrainingInstanceType value);
 } // namespace TrainingInstanceTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,6 +35,11 @@ namespace TrainingJobEarlyStoppingTypeMapper
 AWS_SAGEMAKER_API TrainingJobEarlyStoppingType GetTrainingJobEarlyStoppingTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForTrainingJobEarlyStoppingType(TrainingJobEarlyStoppingType value);
+
+/**
+ * Same as GetNameForTrainingJobEarlyStoppingType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForTrainingJobEarlyStoppingTypeCStr(TrainingJobEarlyStoppingType value);
 } // namespace TrainingJobEarlyStoppingTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -37,6 +37,11 @@ namespace TrainingJobSortByOptionsMapper
 AWS_SAGEMAKER_API TrainingJobSortByOptions GetTrainingJobSortByOptionsForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForTrainingJobSortByOptions(TrainingJobSortByOptions value);
+
+/**
+ * Same as GetNameForTrainingJobSortByOptions(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForTrainingJobSortByOptionsCStr(TrainingJobSortByOptions value);
 } // namespace TrainingJobSortByOptionsMapper
 } // namespace Model
 } // namespace SageMaker
@@ -38,6 +38,11 @@ namespace TrainingJobStatusMapper
 AWS_SAGEMAKER_API TrainingJobStatus GetTrainingJobStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForTrainingJobStatus(TrainingJobStatus value);
+
+/**
+ * Same as GetNameForTrainingJobStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForTrainingJobStatusCStr(TrainingJobStatus value);
 } // namespace TrainingJobStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -59,6 +59,11 @@ namespace TransformInstanceTypeMapper
 AWS_SAGEMAKER_API TransformInstanceType GetTransformInstanceTypeForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForTransformInstanceType(TransformInstanceType value);
+
+/**
+ * Same as GetNameForTransformInstanceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForTransformInstanceTypeCStr(TransformInstanceType value);
 } // namespace TransformInstanceTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -38,6 +38,11 @@ namespace TransformJobStatusMapper
 AWS_SAGEMAKER_API TransformJobStatus GetTransformJobStatusForName(const Aws::String& name);
 
 AWS_SAGEMAKER_API Aws::String GetNameForTransformJobStatus(TransformJobStatus value);
+
+/**
+ * Same as GetNameForTransformJobStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SAGEMAKER_API const char* GetNameForTransformJobStatusCStr(TransformJobStatus value);
 } // namespace TransformJobStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -30,20 +30,37 @@ namespace Aws
       namespace AlgorithmSortByMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "CreationTime",
+        };
 
         AlgorithmSortBy GetAlgorithmSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return AlgorithmSortBy::Name;
-          }
-          else if (hashCode == CreationTime_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AlgorithmSortBy::CreationTime;
+          case 2420395:
+            if (name == "Name")
+            {
+              return AlgorithmSortBy::Name;
+            }
+            break;
+          case 1750336108:
+            if (name == "CreationTime")
+            {
+              return AlgorithmSortBy::CreationTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AlgorithmSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForAlgorithmSortBy(AlgorithmSortBy enumValue)
+        const char* GetNameForAlgorithmSortByCStr(AlgorithmSortBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AlgorithmSortBy::Name:
-            return "Name";
-          case AlgorithmSortBy::CreationTime:
-            return "CreationTime";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAlgorithmSortBy(AlgorithmSortBy enumValue)
+        {
+          return GetNameForAlgorithmSortByCStr(enumValue);
         }
 
       } // namespace AlgorithmSortByMapper
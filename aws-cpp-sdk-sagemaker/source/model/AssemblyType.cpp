@@ -30,20 +30,37 @@ namespace Aws
       namespace AssemblyTypeMapper
       {
 
-        static const int None_HASH = HashingUtils::HashString("None");
-        static const int Line_HASH = HashingUtils::HashString("Line");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "None",
+          "Line",
+        };
 
         AssemblyType GetAssemblyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == None_HASH)
-          {
-            return AssemblyType::None;
-          }
-          else if (hashCode == Line_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssemblyType::Line;
+          case 2433880:
+            if (name == "None")
+            {
+              return AssemblyType::None;
+            }
+            break;
+          case 2368532:
+            if (name == "Line")
+            {
+              return AssemblyType::Line;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AssemblyType::NOT_SET;
         }
 
-        Aws::String GetNameForAssemblyType(AssemblyType enumValue)
+        const char* GetNameForAssemblyTypeCStr(AssemblyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssemblyType::None:
-            return "None";
-          case AssemblyType::Line:
-            return "Line";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssemblyType(AssemblyType enumValue)
+        {
+          return GetNameForAssemblyTypeCStr(enumValue);
         }
 
       } // namespace AssemblyTypeMapper
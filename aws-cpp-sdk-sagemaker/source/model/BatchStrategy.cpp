@@ -30,20 +30,37 @@ namespace Aws
       namespace BatchStrategyMapper
       {
 
-        static const int MultiRecord_HASH = HashingUtils::HashString("MultiRecord");
-        static const int SingleRecord_HASH = HashingUtils::HashString("SingleRecord");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MultiRecord",
+          "SingleRecord",
+        };
 
         BatchStrategy GetBatchStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MultiRecord_HASH)
-          {
-            return BatchStrategy::MultiRecord;
-          }
-          else if (hashCode == SingleRecord_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BatchStrategy::SingleRecord;
+          case 1364936394:
+            if (name == "MultiRecord")
+            {
+              return BatchStrategy::MultiRecord;
+            }
+            break;
+          case 1929173721:
+            if (name == "SingleRecord")
+            {
+              return BatchStrategy::SingleRecord;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BatchStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForBatchStrategy(BatchStrategy enumValue)
+        const char* GetNameForBatchStrategyCStr(BatchStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BatchStrategy::MultiRecord:
-            return "MultiRecord";
-          case BatchStrategy::SingleRecord:
-            return "SingleRecord";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBatchStrategy(BatchStrategy enumValue)
+        {
+          return GetNameForBatchStrategyCStr(enumValue);
         }
 
       } // namespace BatchStrategyMapper
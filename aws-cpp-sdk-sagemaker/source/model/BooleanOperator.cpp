@@ -30,20 +30,37 @@ namespace Aws
       namespace BooleanOperatorMapper
       {
 
-        static const int And_HASH = HashingUtils::HashString("And");
-        static const int Or_HASH = HashingUtils::HashString("Or");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "And",
+          "Or",
+        };
 
         BooleanOperator GetBooleanOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == And_HASH)
-          {
-            return BooleanOperator::And;
-          }
-          else if (hashCode == Or_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BooleanOperator::Or;
+          case 65975:
+            if (name == "And")
+            {
+              return BooleanOperator::And;
+            }
+            break;
+          case 2563:
+            if (name == "Or")
+            {
+              return BooleanOperator::Or;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BooleanOperator::NOT_SET;
         }
 
-        Aws::String GetNameForBooleanOperator(BooleanOperator enumValue)
+        const char* GetNameForBooleanOperatorCStr(BooleanOperator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BooleanOperator::And:
-            return "And";
-          case BooleanOperator::Or:
-            return "Or";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBooleanOperator(BooleanOperator enumValue)
+        {
+          return GetNameForBooleanOperatorCStr(enumValue);
         }
 
       } // namespace BooleanOperatorMapper
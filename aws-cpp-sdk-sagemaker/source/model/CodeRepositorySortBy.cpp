@@ -30,25 +30,44 @@ namespace Aws
       namespace CodeRepositorySortByMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-        static const int LastModifiedTime_HASH = HashingUtils::HashString("LastModifiedTime");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "CreationTime",
+          "LastModifiedTime",
+        };
 
         CodeRepositorySortBy GetCodeRepositorySortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return CodeRepositorySortBy::Name;
-          }
-          else if (hashCode == CreationTime_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CodeRepositorySortBy::CreationTime;
-          }
-          else if (hashCode == LastModifiedTime_HASH)
-          {
-            return CodeRepositorySortBy::LastModifiedTime;
+          case 2420395:
+            if (name == "Name")
+            {
+              return CodeRepositorySortBy::Name;
+            }
+            break;
+          case 1750336108:
+            if (name == "CreationTime")
+            {
+              return CodeRepositorySortBy::CreationTime;
+            }
+            break;
+          case 1911830284:
+            if (name == "LastModifiedTime")
+            {
+              return CodeRepositorySortBy::LastModifiedTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return CodeRepositorySortBy::NOT_SET;
         }
 
-        Aws::String GetNameForCodeRepositorySortBy(CodeRepositorySortBy enumValue)
+        const char* GetNameForCodeRepositorySortByCStr(CodeRepositorySortBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CodeRepositorySortBy::Name:
-            return "Name";
-          case CodeRepositorySortBy::CreationTime:
-            return "CreationTime";
-          case CodeRepositorySortBy::LastModifiedTime:
-            return "LastModifiedTime";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCodeRepositorySortBy(CodeRepositorySortBy enumValue)
+        {
+          return GetNameForCodeRepositorySortByCStr(enumValue);
         }
 
       } // namespace CodeRepositorySortByMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace CompilationJobStatusMapper
       {
 
-        static const int INPROGRESS_HASH = HashingUtils::HashString("INPROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INPROGRESS",
+          "COMPLETED",
+          "FAILED",
+          "STARTING",
+          "STOPPING",
+          "STOPPED",
+        };
 
         CompilationJobStatus GetCompilationJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INPROGRESS_HASH)
-          {
-            return CompilationJobStatus::INPROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return CompilationJobStatus::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return CompilationJobStatus::FAILED;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return CompilationJobStatus::STARTING;
-          }
-          else if (hashCode == STOPPING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CompilationJobStatus::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return CompilationJobStatus::STOPPED;
+          case -926562734:
+            if (name == "INPROGRESS")
+            {
+              return CompilationJobStatus::INPROGRESS;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return CompilationJobStatus::COMPLETED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return CompilationJobStatus::FAILED;
+            }
+            break;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return CompilationJobStatus::STARTING;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return CompilationJobStatus::STOPPING;
+            }
+            break;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return CompilationJobStatus::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return CompilationJobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCompilationJobStatus(CompilationJobStatus enumValue)
+        const char* GetNameForCompilationJobStatusCStr(CompilationJobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CompilationJobStatus::INPROGRESS:
-            return "INPROGRESS";
-          case CompilationJobStatus::COMPLETED:
-            return "COMPLETED";
-          case CompilationJobStatus::FAILED:
-            return "FAILED";
-          case CompilationJobStatus::STARTING:
-            return "STARTING";
-          case CompilationJobStatus::STOPPING:
-            return "STOPPING";
-          case CompilationJobStatus::STOPPED:
-            return "STOPPED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCompilationJobStatus(CompilationJobStatus enumValue)
+        {
+          return GetNameForCompilationJobStatusCStr(enumValue);
         }
 
       } // namespace CompilationJobStatusMapper
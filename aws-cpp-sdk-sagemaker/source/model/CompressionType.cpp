@@ -30,20 +30,37 @@ namespace Aws
       namespace CompressionTypeMapper
       {
 
-        static const int None_HASH = HashingUtils::HashString("None");
-        static const int Gzip_HASH = HashingUtils::HashString("Gzip");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "None",
+          "Gzip",
+        };
 
         CompressionType GetCompressionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == None_HASH)
-          {
-            return CompressionType::None;
-          }
-          else if (hashCode == Gzip_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CompressionType::Gzip;
+          case 2433880:
+            if (name == "None")
+            {
+              return CompressionType::None;
+            }
+            break;
+          case 2235770:
+            if (name == "Gzip")
+            {
+              return CompressionType::Gzip;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CompressionType::NOT_SET;
         }
 
-        Aws::String GetNameForCompressionType(CompressionType enumValue)
+        const char* GetNameForCompressionTypeCStr(CompressionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CompressionType::None:
-            return "None";
-          case CompressionType::Gzip:
-            return "Gzip";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCompressionType(CompressionType enumValue)
+        {
+          return GetNameForCompressionTypeCStr(enumValue);
         }
 
       } // namespace CompressionTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ContentClassifierMapper
       {
 
-        static const int FreeOfPersonallyIdentifiableInformation_HASH = HashingUtils::HashString("FreeOfPersonallyIdentifiableInformation");
-        static const int FreeOfAdultContent_HASH = HashingUtils::HashString("FreeOfAdultContent");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FreeOfPersonallyIdentifiableInformation",
+          "FreeOfAdultContent",
+        };
 
         ContentClassifier GetContentClassifierForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FreeOfPersonallyIdentifiableInformation_HASH)
-          {
-            return ContentClassifier::FreeOfPersonallyIdentifiableInformation;
-          }
-          else if (hashCode == FreeOfAdultContent_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContentClassifier::FreeOfAdultContent;
+          case 610262310:
+            if (name == "FreeOfPersonallyIdentifiableInformation")
+            {
+              return ContentClassifier::FreeOfPersonallyIdentifiableInformation;
+            }
+            break;
+          case -685478270:
+            if (name == "FreeOfAdultContent")
+            {
+              return ContentClassifier::FreeOfAdultContent;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ContentClassifier::NOT_SET;
         }
 
-        Aws::String GetNameForContentClassifier(ContentClassifier enumValue)
+        const char* GetNameForContentClassifierCStr(ContentClassifier enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContentClassifier::FreeOfPersonallyIdentifiableInformation:
-            return "FreeOfPersonallyIdentifiableInformation";
-          case ContentClassifier::FreeOfAdultContent:
-            return "FreeOfAdultContent";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContentClassifier(ContentClassifier enumValue)
+        {
+          return GetNameForContentClassifierCStr(enumValue);
         }
 
       } // namespace ContentClassifierMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace DetailedAlgorithmStatusMapper
       {
 
-        static const int NotStarted_HASH = HashingUtils::HashString("NotStarted");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NotStarted",
+          "InProgress",
+          "Completed",
+          "Failed",
+        };
 
         DetailedAlgorithmStatus GetDetailedAlgorithmStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NotStarted_HASH)
-          {
-            return DetailedAlgorithmStatus::NotStarted;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return DetailedAlgorithmStatus::InProgress;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return DetailedAlgorithmStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DetailedAlgorithmStatus::Failed;
+          case -1137129906:
+            if (name == "NotStarted")
+            {
+              return DetailedAlgorithmStatus::NotStarted;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return DetailedAlgorithmStatus::InProgress;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return DetailedAlgorithmStatus::Completed;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return DetailedAlgorithmStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DetailedAlgorithmStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDetailedAlgorithmStatus(DetailedAlgorithmStatus enumValue)
+        const char* GetNameForDetailedAlgorithmStatusCStr(DetailedAlgorithmStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DetailedAlgorithmStatus::NotStarted:
-            return "NotStarted";
-          case DetailedAlgorithmStatus::InProgress:
-            return "InProgress";
-          case DetailedAlgorithmStatus::Completed:
-            return "Completed";
-          case DetailedAlgorithmStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDetailedAlgorithmStatus(DetailedAlgorithmStatus enumValue)
+        {
+          return GetNameForDetailedAlgorithmStatusCStr(enumValue);
         }
 
       } // namespace DetailedAlgorithmStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace DetailedModelPackageStatusMapper
       {
 
-        static const int NotStarted_HASH = HashingUtils::HashString("NotStarted");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NotStarted",
+          "InProgress",
+          "Completed",
+          "Failed",
+        };
 
         DetailedModelPackageStatus GetDetailedModelPackageStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NotStarted_HASH)
-          {
-            return DetailedModelPackageStatus::NotStarted;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return DetailedModelPackageStatus::InProgress;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return DetailedModelPackageStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DetailedModelPackageStatus::Failed;
+          case -1137129906:
+            if (name == "NotStarted")
+            {
+              return DetailedModelPackageStatus::NotStarted;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return DetailedModelPackageStatus::InProgress;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return DetailedModelPackageStatus::Completed;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return DetailedModelPackageStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DetailedModelPackageStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDetailedModelPackageStatus(DetailedModelPackageStatus enumValue)
+        const char* GetNameForDetailedModelPackageStatusCStr(DetailedModelPackageStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DetailedModelPackageStatus::NotStarted:
-            return "NotStarted";
-          case DetailedModelPackageStatus::InProgress:
-            return "InProgress";
-          case DetailedModelPackageStatus::Completed:
-            return "Completed";
-          case DetailedModelPackageStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDetailedModelPackageStatus(DetailedModelPackageStatus enumValue)
+        {
+          return GetNameForDetailedModelPackageStatusCStr(enumValue);
         }
 
       } // namespace DetailedModelPackageStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace EndpointConfigSortKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "CreationTime",
+        };
 
         EndpointConfigSortKey GetEndpointConfigSortKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return EndpointConfigSortKey::Name;
-          }
-          else if (hashCode == CreationTime_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EndpointConfigSortKey::CreationTime;
+          case 2420395:
+            if (name == "Name")
+            {
+              return EndpointConfigSortKey::Name;
+            }
+            break;
+          case 1750336108:
+            if (name == "CreationTime")
+            {
+              return EndpointConfigSortKey::CreationTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EndpointConfigSortKey::NOT_SET;
         }
 
-        Aws::String GetNameForEndpointConfigSortKey(EndpointConfigSortKey enumValue)
+        const char* GetNameForEndpointConfigSortKeyCStr(EndpointConfigSortKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EndpointConfigSortKey::Name:
-            return "Name";
-          case EndpointConfigSortKey::CreationTime:
-            return "CreationTime";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEndpointConfigSortKey(EndpointConfigSortKey enumValue)
+        {
+          return GetNameForEndpointConfigSortKeyCStr(enumValue);
         }
 
       } // namespace EndpointConfigSortKeyMapper
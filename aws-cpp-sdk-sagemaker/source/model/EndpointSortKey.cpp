@@ -30,25 +30,44 @@ namespace Aws
       namespace EndpointSortKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "CreationTime",
+          "Status",
+        };
 
         EndpointSortKey GetEndpointSortKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return EndpointSortKey::Name;
-          }
-          else if (hashCode == CreationTime_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EndpointSortKey::CreationTime;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return EndpointSortKey::Status;
+          case 2420395:
+            if (name == "Name")
+            {
+              return EndpointSortKey::Name;
+            }
+            break;
+          case 1750336108:
+            if (name == "CreationTime")
+            {
+              return EndpointSortKey::CreationTime;
+            }
+            break;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return EndpointSortKey::Status;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return EndpointSortKey::NOT_SET;
         }
 
-        Aws::String GetNameForEndpointSortKey(EndpointSortKey enumValue)
+        const char* GetNameForEndpointSortKeyCStr(EndpointSortKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EndpointSortKey::Name:
-            return "Name";
-          case EndpointSortKey::CreationTime:
-            return "CreationTime";
-          case EndpointSortKey::Status:
-            return "Status";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEndpointSortKey(EndpointSortKey enumValue)
+        {
+          return GetNameForEndpointSortKeyCStr(enumValue);
         }
 
       } // namespace EndpointSortKeyMapper
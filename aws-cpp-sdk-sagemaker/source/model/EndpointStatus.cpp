@@ -30,50 +30,79 @@ namespace Aws
       namespace EndpointStatusMapper
       {
 
-        static const int OutOfService_HASH = HashingUtils::HashString("OutOfService");
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Updating_HASH = HashingUtils::HashString("Updating");
-        static const int SystemUpdating_HASH = HashingUtils::HashString("SystemUpdating");
-        static const int RollingBack_HASH = HashingUtils::HashString("RollingBack");
-        static const int InService_HASH = HashingUtils::HashString("InService");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OutOfService",
+          "Creating",
+          "Updating",
+          "SystemUpdating",
+          "RollingBack",
+          "InService",
+          "Deleting",
+          "Failed",
+        };
 
         EndpointStatus GetEndpointStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OutOfService_HASH)
-          {
-            return EndpointStatus::OutOfService;
-          }
-          else if (hashCode == Creating_HASH)
-          {
-            return EndpointStatus::Creating;
-          }
-          else if (hashCode == Updating_HASH)
-          {
-            return EndpointStatus::Updating;
-          }
-          else if (hashCode == SystemUpdating_HASH)
-          {
-            return EndpointStatus::SystemUpdating;
-          }
-          else if (hashCode == RollingBack_HASH)
-          {
-            return EndpointStatus::RollingBack;
-          }
-          else if (hashCode == InService_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EndpointStatus::InService;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return EndpointStatus::Deleting;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return EndpointStatus::Failed;
+          case 468811088:
+            if (name == "OutOfService")
+            {
+              return EndpointStatus::OutOfService;
+            }
+            break;
+          case 1885065945:
+            if (name == "Creating")
+            {
+              return EndpointStatus::Creating;
+            }
+            break;
+          case 1387244390:
+            if (name == "Updating")
+            {
+              return EndpointStatus::Updating;
+            }
+            break;
+          case -1206826315:
+            if (name == "SystemUpdating")
+            {
+              return EndpointStatus::SystemUpdating;
+            }
+            break;
+          case 1894080684:
+            if (name == "RollingBack")
+            {
+              return EndpointStatus::RollingBack;
+            }
+            break;
+          case -1010741840:
+            if (name == "InService")
+            {
+              return EndpointStatus::InService;
+            }
+            break;
+          case 884361160:
+            if (name == "Deleting")
+            {
+              return EndpointStatus::Deleting;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return EndpointStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return EndpointStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEndpointStatus(EndpointStatus enumValue)
+        const char* GetNameForEndpointStatusCStr(EndpointStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EndpointStatus::OutOfService:
-            return "OutOfService";
-          case EndpointStatus::Creating:
-            return "Creating";
-          case EndpointStatus::Updating:
-            return "Updating";
-          case EndpointStatus::SystemUpdating:
-            return "SystemUpdating";
-          case EndpointStatus::RollingBack:
-            return "RollingBack";
-          case EndpointStatus::InService:
-            return "InService";
-          case EndpointStatus::Deleting:
-            return "Deleting";
-          case EndpointStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEndpointStatus(EndpointStatus enumValue)
+        {
+          return GetNameForEndpointStatusCStr(enumValue);
         }
 
       } // namespace EndpointStatusMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace FrameworkMapper
       {
 
-        static const int TENSORFLOW_HASH = HashingUtils::HashString("TENSORFLOW");
-        static const int MXNET_HASH = HashingUtils::HashString("MXNET");
-        static const int ONNX_HASH = HashingUtils::HashString("ONNX");
-        static const int PYTORCH_HASH = HashingUtils::HashString("PYTORCH");
-        static const int XGBOOST_HASH = HashingUtils::HashString("XGBOOST");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TENSORFLOW",
+          "MXNET",
+          "ONNX",
+          "PYTORCH",
+          "XGBOOST",
+        };
 
         Framework GetFrameworkForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TENSORFLOW_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Framework::TENSORFLOW;
-          }
-          else if (hashCode == MXNET_HASH)
-          {
-            return Framework::MXNET;
-          }
-          else if (hashCode == ONNX_HASH)
-          {
-            return Framework::ONNX;
-          }
-          else if (hashCode == PYTORCH_HASH)
-          {
-            return Framework::PYTORCH;
-          }
-          else if (hashCode == XGBOOST_HASH)
-          {
-            return Framework::XGBOOST;
+          case 2000635143:
+            if (name == "TENSORFLOW")
+            {
+              return Framework::TENSORFLOW;
+            }
+            break;
+          case 73809906:
+            if (name == "MXNET")
+            {
+              return Framework::MXNET;
+            }
+            break;
+          case 2430953:
+            if (name == "ONNX")
+            {
+              return Framework::ONNX;
+            }
+            break;
+          case 613855091:
+            if (name == "PYTORCH")
+            {
+              return Framework::PYTORCH;
+            }
+            break;
+          case -1408000524:
+            if (name == "XGBOOST")
+            {
+              return Framework::XGBOOST;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return Framework::NOT_SET;
         }
 
-        Aws::String GetNameForFramework(Framework enumValue)
+        const char* GetNameForFrameworkCStr(Framework enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Framework::TENSORFLOW:
-            return "TENSORFLOW";
-          case Framework::MXNET:
-            return "MXNET";
-          case Framework::ONNX:
-            return "ONNX";
-          case Framework::PYTORCH:
-            return "PYTORCH";
-          case Framework::XGBOOST:
-            return "XGBOOST";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFramework(Framework enumValue)
+        {
+          return GetNameForFrameworkCStr(enumValue);
         }
 
       } // namespace FrameworkMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace HyperParameterTuningJobObjectiveTypeMapper
       {
 
-        static const int Maximize_HASH = HashingUtils::HashString("Maximize");
-        static const int Minimize_HASH = HashingUtils::HashString("Minimize");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Maximize",
+          "Minimize",
+        };
 
         HyperParameterTuningJobObjectiveType GetHyperParameterTuningJobObjectiveTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Maximize_HASH)
-          {
-            return HyperParameterTuningJobObjectiveType::Maximize;
-          }
-          else if (hashCode == Minimize_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HyperParameterTuningJobObjectiveType::Minimize;
+          case 481773292:
+            if (name == "Maximize")
+            {
+              return HyperParameterTuningJobObjectiveType::Maximize;
+            }
+            break;
+          case -1294423362:
+            if (name == "Minimize")
+            {
+              return HyperParameterTuningJobObjectiveType::Minimize;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HyperParameterTuningJobObjectiveType::NOT_SET;
         }
 
-        Aws::String GetNameForHyperParameterTuningJobObjectiveType(HyperParameterTuningJobObjectiveType enumValue)
+        const char* GetNameForHyperParameterTuningJobObjectiveTypeCStr(HyperParameterTuningJobObjectiveType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HyperParameterTuningJobObjectiveType::Maximize:
-            return "Maximize";
-          case HyperParameterTuningJobObjectiveType::Minimize:
-            return "Minimize";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHyperParameterTuningJobObjectiveType(HyperParameterTuningJobObjectiveType enumValue)
+        {
+          return GetNameForHyperParameterTuningJobObjectiveTypeCStr(enumValue);
         }
 
       } // namespace HyperParameterTuningJobObjectiveTypeMapper
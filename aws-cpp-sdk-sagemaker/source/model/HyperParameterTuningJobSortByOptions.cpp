@@ -30,25 +30,44 @@ namespace Aws
       namespace HyperParameterTuningJobSortByOptionsMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "Status",
+          "CreationTime",
+        };
 
         HyperParameterTuningJobSortByOptions GetHyperParameterTuningJobSortByOptionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return HyperParameterTuningJobSortByOptions::Name;
-          }
-          else if (hashCode == Status_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HyperParameterTuningJobSortByOptions::Status;
-          }
-          else if (hashCode == CreationTime_HASH)
-          {
-            return HyperParameterTuningJobSortByOptions::CreationTime;
+          case 2420395:
+            if (name == "Name")
+            {
+              return HyperParameterTuningJobSortByOptions::Name;
+            }
+            break;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return HyperParameterTuningJobSortByOptions::Status;
+            }
+            break;
+          case 1750336108:
+            if (name == "CreationTime")
+            {
+              return HyperParameterTuningJobSortByOptions::CreationTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return HyperParameterTuningJobSortByOptions::NOT_SET;
         }
 
-        Aws::String GetNameForHyperParameterTuningJobSortByOptions(HyperParameterTuningJobSortByOptions enumValue)
+        const char* GetNameForHyperParameterTuningJobSortByOptionsCStr(HyperParameterTuningJobSortByOptions enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HyperParameterTuningJobSortByOptions::Name:
-            return "Name";
-          case HyperParameterTuningJobSortByOptions::Status:
-            return "Status";
-          case HyperParameterTuningJobSortByOptions::CreationTime:
-            return "CreationTime";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHyperParameterTuningJobSortByOptions(HyperParameterTuningJobSortByOptions enumValue)
+        {
+          return GetNameForHyperParameterTuningJobSortByOptionsCStr(enumValue);
         }
 
       } // namespace HyperParameterTuningJobSortByOptionsMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace HyperParameterTuningJobStatusMapper
       {
 
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Completed",
+          "InProgress",
+          "Failed",
+          "Stopped",
+          "Stopping",
+        };
 
         HyperParameterTuningJobStatus GetHyperParameterTuningJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Completed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HyperParameterTuningJobStatus::Completed;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return HyperParameterTuningJobStatus::InProgress;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return HyperParameterTuningJobStatus::Failed;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return HyperParameterTuningJobStatus::Stopped;
-          }
-          else if (hashCode == Stopping_HASH)
-          {
-            return HyperParameterTuningJobStatus::Stopping;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return HyperParameterTuningJobStatus::Completed;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return HyperParameterTuningJobStatus::InProgress;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return HyperParameterTuningJobStatus::Failed;
+            }
+            break;
+          case -219666003:
+            if (name == "Stopped")
+            {
+              return HyperParameterTuningJobStatus::Stopped;
+            }
+            break;
+          case 1780292756:
+            if (name == "Stopping")
+            {
+              return HyperParameterTuningJobStatus::Stopping;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return HyperParameterTuningJobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForHyperParameterTuningJobStatus(HyperParameterTuningJobStatus enumValue)
+        const char* GetNameForHyperParameterTuningJobStatusCStr(HyperParameterTuningJobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HyperParameterTuningJobStatus::Completed:
-            return "Completed";
-          case HyperParameterTuningJobStatus::InProgress:
-            return "InProgress";
-          case HyperParameterTuningJobStatus::Failed:
-            return "Failed";
-          case HyperParameterTuningJobStatus::Stopped:
-            return "Stopped";
-          case HyperParameterTuningJobStatus::Stopping:
-            return "Stopping";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHyperParameterTuningJobStatus(HyperParameterTuningJobStatus enumValue)
+        {
+          return GetNameForHyperParameterTuningJobStatusCStr(enumValue);
         }
 
       } // namespace HyperParameterTuningJobStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace HyperParameterTuningJobStrategyTypeMapper
       {
 
-        static const int Bayesian_HASH = HashingUtils::HashString("Bayesian");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Bayesian",
+        };
 
         HyperParameterTuningJobStrategyType GetHyperParameterTuningJobStrategyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Bayesian_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HyperParameterTuningJobStrategyType::Bayesian;
+          case -1484158162:
+            if (name == "Bayesian")
+            {
+              return HyperParameterTuningJobStrategyType::Bayesian;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return HyperParameterTuningJobStrategyType::NOT_SET;
         }
 
-        Aws::String GetNameForHyperParameterTuningJobStrategyType(HyperParameterTuningJobStrategyType enumValue)
+        const char* GetNameForHyperParameterTuningJobStrategyTypeCStr(HyperParameterTuningJobStrategyType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HyperParameterTuningJobStrategyType::Bayesian:
-            return "Bayesian";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHyperParameterTuningJobStrategyType(HyperParameterTuningJobStrategyType enumValue)
+        {
+          return GetNameForHyperParameterTuningJobStrategyTypeCStr(enumValue);
         }
 
       } // namespace HyperParameterTuningJobStrategyTypeMapper
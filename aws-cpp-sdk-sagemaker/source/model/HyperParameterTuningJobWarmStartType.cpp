@@ -30,20 +30,37 @@ namespace Aws
       namespace HyperParameterTuningJobWarmStartTypeMapper
       {
 
-        static const int IdenticalDataAndAlgorithm_HASH = HashingUtils::HashString("IdenticalDataAndAlgorithm");
-        static const int TransferLearning_HASH = HashingUtils::HashString("TransferLearning");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IdenticalDataAndAlgorithm",
+          "TransferLearning",
+        };
 
         HyperParameterTuningJobWarmStartType GetHyperParameterTuningJobWarmStartTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IdenticalDataAndAlgorithm_HASH)
-          {
-            return HyperParameterTuningJobWarmStartType::IdenticalDataAndAlgorithm;
-          }
-          else if (hashCode == TransferLearning_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HyperParameterTuningJobWarmStartType::TransferLearning;
+          case -2031644713:
+            if (name == "IdenticalDataAndAlgorithm")
+            {
+              return HyperParameterTuningJobWarmStartType::IdenticalDataAndAlgorithm;
+            }
+            break;
+          case -1443448759:
+            if (name == "TransferLearning")
+            {
+              return HyperParameterTuningJobWarmStartType::TransferLearning;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HyperParameterTuningJobWarmStartType::NOT_SET;
         }
 
-        Aws::String GetNameForHyperParameterTuningJobWarmStartType(HyperParameterTuningJobWarmStartType enumValue)
+        const char* GetNameForHyperParameterTuningJobWarmStartTypeCStr(HyperParameterTuningJobWarmStartType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HyperParameterTuningJobWarmStartType::IdenticalDataAndAlgorithm:
-            return "IdenticalDataAndAlgorithm";
-          case HyperParameterTuningJobWarmStartType::TransferLearning:
-            return "TransferLearning";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHyperParameterTuningJobWarmStartType(HyperParameterTuningJobWarmStartType enumValue)
+        {
+          return GetNameForHyperParameterTuningJobWarmStartTypeCStr(enumValue);
         }
 
       } // namespace HyperParameterTuningJobWarmStartTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ListLabelingJobsForWorkteamSortByOptionsMapper
       {
 
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CreationTime",
+        };
 
         ListLabelingJobsForWorkteamSortByOptions GetListLabelingJobsForWorkteamSortByOptionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreationTime_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ListLabelingJobsForWorkteamSortByOptions::CreationTime;
+          case 1750336108:
+            if (name == "CreationTime")
+            {
+              return ListLabelingJobsForWorkteamSortByOptions::CreationTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ListLabelingJobsForWorkteamSortByOptions::NOT_SET;
         }
 
-        Aws::String GetNameForListLabelingJobsForWorkteamSortByOptions(ListLabelingJobsForWorkteamSortByOptions enumValue)
+        const char* GetNameForListLabelingJobsForWorkteamSortByOptionsCStr(ListLabelingJobsForWorkteamSortByOptions enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ListLabelingJobsForWorkteamSortByOptions::CreationTime:
-            return "CreationTime";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForListLabelingJobsForWorkteamSortByOptions(ListLabelingJobsForWorkteamSortByOptions enumValue)
+        {
+          return GetNameForListLabelingJobsForWorkteamSortByOptionsCStr(enumValue);
         }
 
       } // namespace ListLabelingJobsForWorkteamSortByOptionsMapper
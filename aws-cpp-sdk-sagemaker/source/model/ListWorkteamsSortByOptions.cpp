@@ -30,20 +30,37 @@ namespace Aws
       namespace ListWorkteamsSortByOptionsMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreateDate_HASH = HashingUtils::HashString("CreateDate");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "CreateDate",
+        };
 
         ListWorkteamsSortByOptions GetListWorkteamsSortByOptionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return ListWorkteamsSortByOptions::Name;
-          }
-          else if (hashCode == CreateDate_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ListWorkteamsSortByOptions::CreateDate;
+          case 2420395:
+            if (name == "Name")
+            {
+              return ListWorkteamsSortByOptions::Name;
+            }
+            break;
+          case -932773142:
+            if (name == "CreateDate")
+            {
+              return ListWorkteamsSortByOptions::CreateDate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ListWorkteamsSortByOptions::NOT_SET;
         }
 
-        Aws::String GetNameForListWorkteamsSortByOptions(ListWorkteamsSortByOptions enumValue)
+        const char* GetNameForListWorkteamsSortByOptionsCStr(ListWorkteamsSortByOptions enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ListWorkteamsSortByOptions::Name:
-            return "Name";
-          case ListWorkteamsSortByOptions::CreateDate:
-            return "CreateDate";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForListWorkteamsSortByOptions(ListWorkteamsSortByOptions enumValue)
+        {
+          return GetNameForListWorkteamsSortByOptionsCStr(enumValue);
         }
 
       } // namespace ListWorkteamsSortByOptionsMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ModelPackageStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "InProgress",
+          "Completed",
+          "Failed",
+          "Deleting",
+        };
 
         ModelPackageStatus GetModelPackageStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ModelPackageStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return ModelPackageStatus::InProgress;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return ModelPackageStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ModelPackageStatus::Failed;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return ModelPackageStatus::Deleting;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return ModelPackageStatus::Pending;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return ModelPackageStatus::InProgress;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return ModelPackageStatus::Completed;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return ModelPackageStatus::Failed;
+            }
+            break;
+          case 884361160:
+            if (name == "Deleting")
+            {
+              return ModelPackageStatus::Deleting;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ModelPackageStatus::NOT_SET;
         }
 
-        Aws::String GetNameForModelPackageStatus(ModelPackageStatus enumValue)
+        const char* GetNameForModelPackageStatusCStr(ModelPackageStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ModelPackageStatus::Pending:
-            return "Pending";
-          case ModelPackageStatus::InProgress:
-            return "InProgress";
-          case ModelPackageStatus::Completed:
-            return "Completed";
-          case ModelPackageStatus::Failed:
-            return "Failed";
-          case ModelPackageStatus::Deleting:
-            return "Deleting";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForModelPackageStatus(ModelPackageStatus enumValue)
+        {
+          return GetNameForModelPackageStatusCStr(enumValue);
         }
 
       } // namespace ModelPackageStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace NotebookInstanceLifecycleConfigSortKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-        static const int LastModifiedTime_HASH = HashingUtils::HashString("LastModifiedTime");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "CreationTime",
+          "LastModifiedTime",
+        };
 
         NotebookInstanceLifecycleConfigSortKey GetNotebookInstanceLifecycleConfigSortKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return NotebookInstanceLifecycleConfigSortKey::Name;
-          }
-          else if (hashCode == CreationTime_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NotebookInstanceLifecycleConfigSortKey::CreationTime;
-          }
-          else if (hashCode == LastModifiedTime_HASH)
-          {
-            return NotebookInstanceLifecycleConfigSortKey::LastModifiedTime;
+          case 2420395:
+            if (name == "Name")
+            {
+              return NotebookInstanceLifecycleConfigSortKey::Name;
+            }
+            break;
+          case 1750336108:
+            if (name == "CreationTime")
+            {
+              return NotebookInstanceLifecycleConfigSortKey::CreationTime;
+            }
+            break;
+          case 1911830284:
+            if (name == "LastModifiedTime")
+            {
+              return NotebookInstanceLifecycleConfigSortKey::LastModifiedTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return NotebookInstanceLifecycleConfigSortKey::NOT_SET;
         }
 
-        Aws::String GetNameForNotebookInstanceLifecycleConfigSortKey(NotebookInstanceLifecycleConfigSortKey enumValue)
+        const char* GetNameForNotebookInstanceLifecycleConfigSortKeyCStr(NotebookInstanceLifecycleConfigSortKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NotebookInstanceLifecycleConfigSortKey::Name:
-            return "Name";
-          case NotebookInstanceLifecycleConfigSortKey::CreationTime:
-            return "CreationTime";
-          case NotebookInstanceLifecycleConfigSortKey::LastModifiedTime:
-            return "LastModifiedTime";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNotebookInstanceLifecycleConfigSortKey(NotebookInstanceLifecycleConfigSortKey enumValue)
+        {
+          return GetNameForNotebookInstanceLifecycleConfigSortKeyCStr(enumValue);
         }
 
       } // namespace NotebookInstanceLifecycleConfigSortKeyMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace NotebookInstanceLifecycleConfigSortOrderMapper
       {
 
-        static const int Ascending_HASH = HashingUtils::HashString("Ascending");
-        static const int Descending_HASH = HashingUtils::HashString("Descending");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Ascending",
+          "Descending",
+        };
 
         NotebookInstanceLifecycleConfigSortOrder GetNotebookInstanceLifecycleConfigSortOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Ascending_HASH)
-          {
-            return NotebookInstanceLifecycleConfigSortOrder::Ascending;
-          }
-          else if (hashCode == Descending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NotebookInstanceLifecycleConfigSortOrder::Descending;
+          case 1999036088:
+            if (name == "Ascending")
+            {
+              return NotebookInstanceLifecycleConfigSortOrder::Ascending;
+            }
+            break;
+          case 877168408:
+            if (name == "Descending")
+            {
+              return NotebookInstanceLifecycleConfigSortOrder::Descending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return NotebookInstanceLifecycleConfigSortOrder::NOT_SET;
         }
 
-        Aws::String GetNameForNotebookInstanceLifecycleConfigSortOrder(NotebookInstanceLifecycleConfigSortOrder enumValue)
+        const char* GetNameForNotebookInstanceLifecycleConfigSortOrderCStr(NotebookInstanceLifecycleConfigSortOrder enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NotebookInstanceLifecycleConfigSortOrder::Ascending:
-            return "Ascending";
-          case NotebookInstanceLifecycleConfigSortOrder::Descending:
-            return "Descending";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNotebookInstanceLifecycleConfigSortOrder(NotebookInstanceLifecycleConfigSortOrder enumValue)
+        {
+          return GetNameForNotebookInstanceLifecycleConfigSortOrderCStr(enumValue);
         }
 
       } // namespace NotebookInstanceLifecycleConfigSortOrderMapper
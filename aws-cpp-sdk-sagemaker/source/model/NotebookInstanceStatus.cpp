@@ -30,45 +30,72 @@ namespace Aws
       namespace NotebookInstanceStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InService_HASH = HashingUtils::HashString("InService");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Updating_HASH = HashingUtils::HashString("Updating");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "InService",
+          "Stopping",
+          "Stopped",
+          "Failed",
+          "Deleting",
+          "Updating",
+        };
 
         NotebookInstanceStatus GetNotebookInstanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return NotebookInstanceStatus::Pending;
-          }
-          else if (hashCode == InService_HASH)
-          {
-            return NotebookInstanceStatus::InService;
-          }
-          else if (hashCode == Stopping_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NotebookInstanceStatus::Stopping;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return NotebookInstanceStatus::Stopped;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return NotebookInstanceStatus::Failed;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return NotebookInstanceStatus::Deleting;
-          }
-          else if (hashCode == Updating_HASH)
-          {
-            return NotebookInstanceStatus::Updating;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return NotebookInstanceStatus::Pending;
+            }
+            break;
+          case -1010741840:
+            if (name == "InService")
+            {
+              return NotebookInstanceStatus::InService;
+            }
+            break;
+          case 1780292756:
+            if (name == "Stopping")
+            {
+              return NotebookInstanceStatus::Stopping;
+            }
+            break;
+          case -219666003:
+            if (name == "Stopped")
+            {
+              return NotebookInstanceStatus::Stopped;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return NotebookInstanceStatus::Failed;
+            }
+            break;
+          case 884361160:
+            if (name == "Deleting")
+            {
+              return NotebookInstanceStatus::Deleting;
+            }
+            break;
+          case 1387244390:
+            if (name == "Updating")
+            {
+              return NotebookInstanceStatus::Updating;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return NotebookInstanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForNotebookInstanceStatus(NotebookInstanceStatus enumValue)
+        const char* GetNameForNotebookInstanceStatusCStr(NotebookInstanceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NotebookInstanceStatus::Pending:
-            return "Pending";
-          case NotebookInstanceStatus::InService:
-            return "InService";
-          case NotebookInstanceStatus::Stopping:
-            return "Stopping";
-          case NotebookInstanceStatus::Stopped:
-            return "Stopped";
-          case NotebookInstanceStatus::Failed:
-            return "Failed";
-          case NotebookInstanceStatus::Deleting:
-            return "Deleting";
-          case NotebookInstanceStatus::Updating:
-            return "Updating";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNotebookInstanceStatus(NotebookInstanceStatus enumValue)
+        {
+          return GetNameForNotebookInstanceStatusCStr(enumValue);
         }
 
       } // namespace NotebookInstanceStatusMapper
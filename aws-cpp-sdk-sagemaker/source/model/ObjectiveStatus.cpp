@@ -30,25 +30,44 @@ namespace Aws
       namespace ObjectiveStatusMapper
       {
 
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Succeeded",
+          "Pending",
+          "Failed",
+        };
 
         ObjectiveStatus GetObjectiveStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Succeeded_HASH)
-          {
-            return ObjectiveStatus::Succeeded;
-          }
-          else if (hashCode == Pending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ObjectiveStatus::Pending;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ObjectiveStatus::Failed;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return ObjectiveStatus::Succeeded;
+            }
+            break;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return ObjectiveStatus::Pending;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return ObjectiveStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ObjectiveStatus::NOT_SET;
         }
 
-        Aws::String GetNameForObjectiveStatus(ObjectiveStatus enumValue)
+        const char* GetNameForObjectiveStatusCStr(ObjectiveStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ObjectiveStatus::Succeeded:
-            return "Succeeded";
-          case ObjectiveStatus::Pending:
-            return "Pending";
-          case ObjectiveStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForObjectiveStatus(ObjectiveStatus enumValue)
+        {
+          return GetNameForObjectiveStatusCStr(enumValue);
         }
 
       } // namespace ObjectiveStatusMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace OperatorMapper
       {
 
-        static const int Equals_HASH = HashingUtils::HashString("Equals");
-        static const int NotEquals_HASH = HashingUtils::HashString("NotEquals");
-        static const int GreaterThan_HASH = HashingUtils::HashString("GreaterThan");
-        static const int GreaterThanOrEqualTo_HASH = HashingUtils::HashString("GreaterThanOrEqualTo");
-        static const int LessThan_HASH = HashingUtils::HashString("LessThan");
-        static const int LessThanOrEqualTo_HASH = HashingUtils::HashString("LessThanOrEqualTo");
-        static const int Contains_HASH = HashingUtils::HashString("Contains");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Equals",
+          "NotEquals",
+          "GreaterThan",
+          "GreaterThanOrEqualTo",
+          "LessThan",
+          "LessThanOrEqualTo",
+          "Contains",
+        };
 
         Operator GetOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Equals_HASH)
-          {
-            return Operator::Equals;
-          }
-          else if (hashCode == NotEquals_HASH)
-          {
-            return Operator::NotEquals;
-          }
-          else if (hashCode == GreaterThan_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Operator::GreaterThan;
-          }
-          else if (hashCode == GreaterThanOrEqualTo_HASH)
-          {
-            return Operator::GreaterThanOrEqualTo;
-          }
-          else if (hashCode == LessThan_HASH)
-          {
-            return Operator::LessThan;
-          }
-          else if (hashCode == LessThanOrEqualTo_HASH)
-          {
-            return Operator::LessThanOrEqualTo;
-          }
-          else if (hashCode == Contains_HASH)
-          {
-            return Operator::Contains;
+          case 2083351519:
+            if (name == "Equals")
+            {
+              return Operator::Equals;
+            }
+            break;
+          case -1409512366:
+            if (name == "NotEquals")
+            {
+              return Operator::NotEquals;
+            }
+            break;
+          case -1701951333:
+            if (name == "GreaterThan")
+            {
+              return Operator::GreaterThan;
+            }
+            break;
+          case 39747345:
+            if (name == "GreaterThanOrEqualTo")
+            {
+              return Operator::GreaterThanOrEqualTo;
+            }
+            break;
+          case -2140646662:
+            if (name == "LessThan")
+            {
+              return Operator::LessThan;
+            }
+            break;
+          case -1754222702:
+            if (name == "LessThanOrEqualTo")
+            {
+              return Operator::LessThanOrEqualTo;
+            }
+            break;
+          case -502801857:
+            if (name == "Contains")
+            {
+              return Operator::Contains;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return Operator::NOT_SET;
         }
 
-        Aws::String GetNameForOperator(Operator enumValue)
+        const char* GetNameForOperatorCStr(Operator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Operator::Equals:
-            return "Equals";
-          case Operator::NotEquals:
-            return "NotEquals";
-          case Operator::GreaterThan:
-            return "GreaterThan";
-          case Operator::GreaterThanOrEqualTo:
-            return "GreaterThanOrEqualTo";
-          case Operator::LessThan:
-            return "LessThan";
-          case Operator::LessThanOrEqualTo:
-            return "LessThanOrEqualTo";
-          case Operator::Contains:
-            return "Contains";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperator(Operator enumValue)
+        {
+          return GetNameForOperatorCStr(enumValue);
         }
 
       } // namespace OperatorMapper
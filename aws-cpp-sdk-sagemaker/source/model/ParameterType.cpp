@@ -30,30 +30,51 @@ namespace Aws
       namespace ParameterTypeMapper
       {
 
-        static const int Integer_HASH = HashingUtils::HashString("Integer");
-        static const int Continuous_HASH = HashingUtils::HashString("Continuous");
-        static const int Categorical_HASH = HashingUtils::HashString("Categorical");
-        static const int FreeText_HASH = HashingUtils::HashString("FreeText");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Integer",
+          "Continuous",
+          "Categorical",
+          "FreeText",
+        };
 
         ParameterType GetParameterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Integer_HASH)
-          {
-            return ParameterType::Integer;
-          }
-          else if (hashCode == Continuous_HASH)
-          {
-            return ParameterType::Continuous;
-          }
-          else if (hashCode == Categorical_HASH)
-          {
-            return ParameterType::Categorical;
-          }
-          else if (hashCode == FreeText_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ParameterType::FreeText;
+          case -672261858:
+            if (name == "Integer")
+            {
+              return ParameterType::Integer;
+            }
+            break;
+          case -1922388177:
+            if (name == "Continuous")
+            {
+              return ParameterType::Continuous;
+            }
+            break;
+          case -1089790976:
+            if (name == "Categorical")
+            {
+              return ParameterType::Categorical;
+            }
+            break;
+          case -1473700391:
+            if (name == "FreeText")
+            {
+              return ParameterType::FreeText;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ParameterType::NOT_SET;
         }
 
-        Aws::String GetNameForParameterType(ParameterType enumValue)
+        const char* GetNameForParameterTypeCStr(ParameterType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ParameterType::Integer:
-            return "Integer";
-          case ParameterType::Continuous:
-            return "Continuous";
-          case ParameterType::Categorical:
-            return "Categorical";
-          case ParameterType::FreeText:
-            return "FreeText";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForParameterType(ParameterType enumValue)
+        {
+          return GetNameForParameterTypeCStr(enumValue);
         }
 
       } // namespace ParameterTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ProductionVariantAcceleratorTypeMapper
       {
 
-        static const int ml_eia1_medium_HASH = HashingUtils::HashString("ml.eia1.medium");
-        static const int ml_eia1_large_HASH = HashingUtils::HashString("ml.eia1.large");
-        static const int ml_eia1_xlarge_HASH = HashingUtils::HashString("ml.eia1.xlarge");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ml.eia1.medium",
+          "ml.eia1.large",
+          "ml.eia1.xlarge",
+        };
 
         ProductionVariantAcceleratorType GetProductionVariantAcceleratorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ml_eia1_medium_HASH)
-          {
-            return ProductionVariantAcceleratorType::ml_eia1_medium;
-          }
-          else if (hashCode == ml_eia1_large_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProductionVariantAcceleratorType::ml_eia1_large;
-          }
-          else if (hashCode == ml_eia1_xlarge_HASH)
-          {
-            return ProductionVariantAcceleratorType::ml_eia1_xlarge;
+          case 1847596352:
+            if (name == "ml.eia1.medium")
+            {
+              return ProductionVariantAcceleratorType::ml_eia1_medium;
+            }
+            break;
+          case -1881092080:
+            if (name == "ml.eia1.large")
+            {
+              return ProductionVariantAcceleratorType::ml_eia1_large;
+            }
+            break;
+          case -2126066802:
+            if (name == "ml.eia1.xlarge")
+            {
+              return ProductionVariantAcceleratorType::ml_eia1_xlarge;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ProductionVariantAcceleratorType::NOT_SET;
         }
 
-        Aws::String GetNameForProductionVariantAcceleratorType(ProductionVariantAcceleratorType enumValue)
+        const char* GetNameForProductionVariantAcceleratorTypeCStr(ProductionVariantAcceleratorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProductionVariantAcceleratorType::ml_eia1_medium:
-            return "ml.eia1.medium";
-          case ProductionVariantAcceleratorType::ml_eia1_large:
-            return "ml.eia1.large";
-          case ProductionVariantAcceleratorType::ml_eia1_xlarge:
-            return "ml.eia1.xlarge";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProductionVariantAcceleratorType(ProductionVariantAcceleratorType enumValue)
+        {
+          return GetNameForProductionVariantAcceleratorTypeCStr(enumValue);
         }
 
       } // namespace ProductionVariantAcceleratorTypeMapper
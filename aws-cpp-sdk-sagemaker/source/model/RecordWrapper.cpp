@@ -30,20 +30,37 @@ namespace Aws
       namespace RecordWrapperMapper
       {
 
-        static const int None_HASH = HashingUtils::HashString("None");
-        static const int RecordIO_HASH = HashingUtils::HashString("RecordIO");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "None",
+          "RecordIO",
+        };
 
         RecordWrapper GetRecordWrapperForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == None_HASH)
-          {
-            return RecordWrapper::None;
-          }
-          else if (hashCode == RecordIO_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RecordWrapper::RecordIO;
+          case 2433880:
+            if (name == "None")
+            {
+              return RecordWrapper::None;
+            }
+            break;
+          case -734590633:
+            if (name == "RecordIO")
+            {
+              return RecordWrapper::RecordIO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RecordWrapper::NOT_SET;
         }
 
-        Aws::String GetNameForRecordWrapper(RecordWrapper enumValue)
+        const char* GetNameForRecordWrapperCStr(RecordWrapper enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RecordWrapper::None:
-            return "None";
-          case RecordWrapper::RecordIO:
-            return "RecordIO";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRecordWrapper(RecordWrapper enumValue)
+        {
+          return GetNameForRecordWrapperCStr(enumValue);
         }
 
       } // namespace RecordWrapperMapper
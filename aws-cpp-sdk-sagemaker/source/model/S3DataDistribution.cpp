@@ -30,20 +30,37 @@ namespace Aws
       namespace S3DataDistributionMapper
       {
 
-        static const int FullyReplicated_HASH = HashingUtils::HashString("FullyReplicated");
-        static const int ShardedByS3Key_HASH = HashingUtils::HashString("ShardedByS3Key");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FullyReplicated",
+          "ShardedByS3Key",
+        };
 
         S3DataDistribution GetS3DataDistributionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FullyReplicated_HASH)
-          {
-            return S3DataDistribution::FullyReplicated;
-          }
-          else if (hashCode == ShardedByS3Key_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return S3DataDistribution::ShardedByS3Key;
+          case 1168483237:
+            if (name == "FullyReplicated")
+            {
+              return S3DataDistribution::FullyReplicated;
+            }
+            break;
+          case 1315923563:
+            if (name == "ShardedByS3Key")
+            {
+              return S3DataDistribution::ShardedByS3Key;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return S3DataDistribution::NOT_SET;
         }
 
-        Aws::String GetNameForS3DataDistribution(S3DataDistribution enumValue)
+        const char* GetNameForS3DataDistributionCStr(S3DataDistribution enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case S3DataDistribution::FullyReplicated:
-            return "FullyReplicated";
-          case S3DataDistribution::ShardedByS3Key:
-            return "ShardedByS3Key";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForS3DataDistribution(S3DataDistribution enumValue)
+        {
+          return GetNameForS3DataDistributionCStr(enumValue);
         }
 
       } // namespace S3DataDistributionMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace S3DataTypeMapper
       {
 
-        static const int ManifestFile_HASH = HashingUtils::HashString("ManifestFile");
-        static const int S3Prefix_HASH = HashingUtils::HashString("S3Prefix");
-        static const int AugmentedManifestFile_HASH = HashingUtils::HashString("AugmentedManifestFile");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ManifestFile",
+          "S3Prefix",
+          "AugmentedManifestFile",
+        };
 
         S3DataType GetS3DataTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ManifestFile_HASH)
-          {
-            return S3DataType::ManifestFile;
-          }
-          else if (hashCode == S3Prefix_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return S3DataType::S3Prefix;
-          }
-          else if (hashCode == AugmentedManifestFile_HASH)
-          {
-            return S3DataType::AugmentedManifestFile;
+          case -1878705045:
+            if (name == "ManifestFile")
+            {
+              return S3DataType::ManifestFile;
+            }
+            break;
+          case -958859022:
+            if (name == "S3Prefix")
+            {
+              return S3DataType::S3Prefix;
+            }
+            break;
+          case -800436421:
+            if (name == "AugmentedManifestFile")
+            {
+              return S3DataType::AugmentedManifestFile;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return S3DataType::NOT_SET;
         }
 
-        Aws::String GetNameForS3DataType(S3DataType enumValue)
+        const char* GetNameForS3DataTypeCStr(S3DataType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case S3DataType::ManifestFile:
-            return "ManifestFile";
-          case S3DataType::S3Prefix:
-            return "S3Prefix";
-          case S3DataType::AugmentedManifestFile:
-            return "AugmentedManifestFile";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForS3DataType(S3DataType enumValue)
+        {
+          return GetNameForS3DataTypeCStr(enumValue);
         }
 
       } // namespace S3DataTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SearchSortOrderMapper
       {
 
-        static const int Ascending_HASH = HashingUtils::HashString("Ascending");
-        static const int Descending_HASH = HashingUtils::HashString("Descending");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Ascending",
+          "Descending",
+        };
 
         SearchSortOrder GetSearchSortOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Ascending_HASH)
-          {
-            return SearchSortOrder::Ascending;
-          }
-          else if (hashCode == Descending_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SearchSortOrder::Descending;
+          case 1999036088:
+            if (name == "Ascending")
+            {
+              return SearchSortOrder::Ascending;
+            }
+            break;
+          case 877168408:
+            if (name == "Descending")
+            {
+              return SearchSortOrder::Descending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SearchSortOrder::NOT_SET;
         }
 
-        Aws::String GetNameForSearchSortOrder(SearchSortOrder enumValue)
+        const char* GetNameForSearchSortOrderCStr(SearchSortOrder enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SearchSortOrder::Ascending:
-            return "Ascending";
-          case SearchSortOrder::Descending:
-            return "Descending";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSearchSortOrder(SearchSortOrder enumValue)
+        {
+          return GetNameForSearchSortOrderCStr(enumValue);
         }
 
       } // namespace SearchSortOrderMapper
@@ -30,70 +30,107 @@ namespace Aws
       namespace SecondaryStatusMapper
       {
 
-        static const int Starting_HASH = HashingUtils::HashString("Starting");
-        static const int LaunchingMLInstances_HASH = HashingUtils::HashString("LaunchingMLInstances");
-        static const int PreparingTrainingStack_HASH = HashingUtils::HashString("PreparingTrainingStack");
-        static const int Downloading_HASH = HashingUtils::HashString("Downloading");
-        static const int DownloadingTrainingImage_HASH = HashingUtils::HashString("DownloadingTrainingImage");
-        static const int Training_HASH = HashingUtils::HashString("Training");
-        static const int Uploading_HASH = HashingUtils::HashString("Uploading");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-        static const int MaxRuntimeExceeded_HASH = HashingUtils::HashString("MaxRuntimeExceeded");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Starting",
+          "LaunchingMLInstances",
+          "PreparingTrainingStack",
+          "Downloading",
+          "DownloadingTrainingImage",
+          "Training",
+          "Uploading",
+          "Stopping",
+          "Stopped",
+          "MaxRuntimeExceeded",
+          "Completed",
+          "Failed",
+        };
 
         SecondaryStatus GetSecondaryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Starting_HASH)
-          {
-            return SecondaryStatus::Starting;
-          }
-          else if (hashCode == LaunchingMLInstances_HASH)
-          {
-            return SecondaryStatus::LaunchingMLInstances;
-          }
-          else if (hashCode == PreparingTrainingStack_HASH)
-          {
-            return SecondaryStatus::PreparingTrainingStack;
-          }
-          else if (hashCode == Downloading_HASH)
-          {
-            return SecondaryStatus::Downloading;
-          }
-          else if (hashCode == DownloadingTrainingImage_HASH)
-          {
-            return SecondaryStatus::DownloadingTrainingImage;
-          }
-          else if (hashCode == Training_HASH)
-          {
-            return SecondaryStatus::Training;
-          }
-          else if (hashCode == Uploading_HASH)
-          {
-            return SecondaryStatus::Uploading;
-          }
-          else if (hashCode == Stopping_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SecondaryStatus::Stopping;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return SecondaryStatus::Stopped;
-          }
-          else if (hashCode == MaxRuntimeExceeded_HASH)
-          {
-            return SecondaryStatus::MaxRuntimeExceeded;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return SecondaryStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return SecondaryStatus::Failed;
+          case 1381450848:
+            if (name == "Starting")
+            {
+              return SecondaryStatus::Starting;
+            }
+            break;
+          case -296492784:
+            if (name == "LaunchingMLInstances")
+            {
+              return SecondaryStatus::LaunchingMLInstances;
+            }
+            break;
+          case 2024521802:
+            if (name == "PreparingTrainingStack")
+            {
+              return SecondaryStatus::PreparingTrainingStack;
+            }
+            break;
+          case 456739386:
+            if (name == "Downloading")
+            {
+              return SecondaryStatus::Downloading;
+            }
+            break;
+          case -25494393:
+            if (name == "DownloadingTrainingImage")
+            {
+              return SecondaryStatus::DownloadingTrainingImage;
+            }
+            break;
+          case 1340763386:
+            if (name == "Training")
+            {
+              return SecondaryStatus::Training;
+            }
+            break;
+          case -1051894239:
+            if (name == "Uploading")
+            {
+              return SecondaryStatus::Uploading;
+            }
+            break;
+          case 1780292756:
+            if (name == "Stopping")
+            {
+              return SecondaryStatus::Stopping;
+            }
+            break;
+          case -219666003:
+            if (name == "Stopped")
+            {
+              return SecondaryStatus::Stopped;
+            }
+            break;
+          case 1986832743:
+            if (name == "MaxRuntimeExceeded")
+            {
+              return SecondaryStatus::MaxRuntimeExceeded;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return SecondaryStatus::Completed;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return SecondaryStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,43 +142,26 @@ namespace Aws
           return SecondaryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSecondaryStatus(SecondaryStatus enumValue)
+        const char* GetNameForSecondaryStatusCStr(SecondaryStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SecondaryStatus::Starting:
-            return "Starting";
-          case SecondaryStatus::LaunchingMLInstances:
-            return "LaunchingMLInstances";
-          case SecondaryStatus::PreparingTrainingStack:
-            return "PreparingTrainingStack";
-          case SecondaryStatus::Downloading:
-            return "Downloading";
-          case SecondaryStatus::DownloadingTrainingImage:
-            return "DownloadingTrainingImage";
-          case SecondaryStatus::Training:
-            return "Training";
-          case SecondaryStatus::Uploading:
-            return "Uploading";
-          case SecondaryStatus::Stopping:
-            return "Stopping";
-          case SecondaryStatus::Stopped:
-            return "Stopped";
-          case SecondaryStatus::MaxRuntimeExceeded:
-            return "MaxRuntimeExceeded";
-          case SecondaryStatus::Completed:
-            return "Completed";
-          case SecondaryStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSecondaryStatus(SecondaryStatus enumValue)
+        {
+          return GetNameForSecondaryStatusCStr(enumValue);
         }
 
       } // namespace SecondaryStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace SortByMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "CreationTime",
+          "Status",
+        };
 
         SortBy GetSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return SortBy::Name;
-          }
-          else if (hashCode == CreationTime_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SortBy::CreationTime;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return SortBy::Status;
+          case 2420395:
+            if (name == "Name")
+            {
+              return SortBy::Name;
+            }
+            break;
+          case 1750336108:
+            if (name == "CreationTime")
+            {
+              return SortBy::CreationTime;
+            }
+            break;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return SortBy::Status;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SortBy::NOT_SET;
         }
 
-        Aws::String GetNameForSortBy(SortBy enumValue)
+        const char* GetNameForSortByCStr(SortBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SortBy::Name:
-            return "Name";
-          case SortBy::CreationTime:
-            return "CreationTime";
-          case SortBy::Status:
-            return "Status";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSortBy(SortBy enumValue)
+        {
+          return GetNameForSortByCStr(enumValue);
         }
 
       } // namespace SortByMapper
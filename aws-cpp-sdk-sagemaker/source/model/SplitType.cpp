@@ -30,30 +30,51 @@ namespace Aws
       namespace SplitTypeMapper
       {
 
-        static const int None_HASH = HashingUtils::HashString("None");
-        static const int Line_HASH = HashingUtils::HashString("Line");
-        static const int RecordIO_HASH = HashingUtils::HashString("RecordIO");
-        static const int TFRecord_HASH = HashingUtils::HashString("TFRecord");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "None",
+          "Line",
+          "RecordIO",
+          "TFRecord",
+        };
 
         SplitType GetSplitTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == None_HASH)
-          {
-            return SplitType::None;
-          }
-          else if (hashCode == Line_HASH)
-          {
-            return SplitType::Line;
-          }
-          else if (hashCode == RecordIO_HASH)
-          {
-            return SplitType::RecordIO;
-          }
-          else if (hashCode == TFRecord_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SplitType::TFRecord;
+          case 2433880:
+            if (name == "None")
+            {
+              return SplitType::None;
+            }
+            break;
+          case 2368532:
+            if (name == "Line")
+            {
+              return SplitType::Line;
+            }
+            break;
+          case -734590633:
+            if (name == "RecordIO")
+            {
+              return SplitType::RecordIO;
+            }
+            break;
+          case 511853923:
+            if (name == "TFRecord")
+            {
+              return SplitType::TFRecord;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return SplitType::NOT_SET;
         }
 
-        Aws::String GetNameForSplitType(SplitType enumValue)
+        const char* GetNameForSplitTypeCStr(SplitType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SplitType::None:
-            return "None";
-          case SplitType::Line:
-            return "Line";
-          case SplitType::RecordIO:
-            return "RecordIO";
-          case SplitType::TFRecord:
-            return "TFRecord";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSplitType(SplitType enumValue)
+        {
+          return GetNameForSplitTypeCStr(enumValue);
         }
 
       } // namespace SplitTypeMapper
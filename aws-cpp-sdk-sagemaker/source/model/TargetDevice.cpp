@@ -30,60 +30,93 @@ namespace Aws
       namespace TargetDeviceMapper
       {
 
-        static const int ml_m4_HASH = HashingUtils::HashString("ml_m4");
-        static const int ml_m5_HASH = HashingUtils::HashString("ml_m5");
-        static const int ml_c4_HASH = HashingUtils::HashString("ml_c4");
-        static const int ml_c5_HASH = HashingUtils::HashString("ml_c5");
-        static const int ml_p2_HASH = HashingUtils::HashString("ml_p2");
-        static const int ml_p3_HASH = HashingUtils::HashString("ml_p3");
-        static const int jetson_tx1_HASH = HashingUtils::HashString("jetson_tx1");
-        static const int jetson_tx2_HASH = HashingUtils::HashString("jetson_tx2");
-        static const int rasp3b_HASH = HashingUtils::HashString("rasp3b");
-        static const int deeplens_HASH = HashingUtils::HashString("deeplens");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ml_m4",
+          "ml_m5",
+          "ml_c4",
+          "ml_c5",
+          "ml_p2",
+          "ml_p3",
+          "jetson_tx1",
+          "jetson_tx2",
+          "rasp3b",
+          "deeplens",
+        };
 
         TargetDevice GetTargetDeviceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ml_m4_HASH)
-          {
-            return TargetDevice::ml_m4;
-          }
-          else if (hashCode == ml_m5_HASH)
-          {
-            return TargetDevice::ml_m5;
-          }
-          else if (hashCode == ml_c4_HASH)
-          {
-            return TargetDevice::ml_c4;
-          }
-          else if (hashCode == ml_c5_HASH)
-          {
-            return TargetDevice::ml_c5;
-          }
-          else if (hashCode == ml_p2_HASH)
-          {
-            return TargetDevice::ml_p2;
-          }
-          else if (hashCode == ml_p3_HASH)
-          {
-            return TargetDevice::ml_p3;
-          }
-          else if (hashCode == jetson_tx1_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TargetDevice::jetson_tx1;
-          }
-          else if (hashCode == jetson_tx2_HASH)
-          {
-            return TargetDevice::jetson_tx2;
-          }
-          else if (hashCode == rasp3b_HASH)
-          {
-            return TargetDevice::rasp3b;
-          }
-          else if (hashCode == deeplens_HASH)
-          {
-            return TargetDevice::deeplens;
+          case 103975943:
+            if (name == "ml_m4")
+            {
+              return TargetDevice::ml_m4;
+            }
+            break;
+          case 103975944:
+            if (name == "ml_m5")
+            {
+              return TargetDevice::ml_m5;
+            }
+            break;
+          case 103975633:
+            if (name == "ml_c4")
+            {
+              return TargetDevice::ml_c4;
+            }
+            break;
+          case 103975634:
+            if (name == "ml_c5")
+            {
+              return TargetDevice::ml_c5;
+            }
+            break;
+          case 103976034:
+            if (name == "ml_p2")
+            {
+              return TargetDevice::ml_p2;
+            }
+            break;
+          case 103976035:
+            if (name == "ml_p3")
+            {
+              return TargetDevice::ml_p3;
+            }
+            break;
+          case 1048743239:
+            if (name == "jetson_tx1")
+            {
+              return TargetDevice::jetson_tx1;
+            }
+            break;
+          case 1048743240:
+            if (name == "jetson_tx2")
+            {
+              return TargetDevice::jetson_tx2;
+            }
+            break;
+          case -938127269:
+            if (name == "rasp3b")
+            {
+              return TargetDevice::rasp3b;
+            }
+            break;
+          case 629229546:
+            if (name == "deeplens")
+            {
+              return TargetDevice::deeplens;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,39 +128,26 @@ namespace Aws
           return TargetDevice::NOT_SET;
         }
 
-        Aws::String GetNameForTargetDevice(TargetDevice enumValue)
+        const char* GetNameForTargetDeviceCStr(TargetDevice enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TargetDevice::ml_m4:
-            return "ml_m4";
-          case TargetDevice::ml_m5:
-            return "ml_m5";
-          case TargetDevice::ml_c4:
-            return "ml_c4";
-          case TargetDevice::ml_c5:
-            return "ml_c5";
-          case TargetDevice::ml_p2:
-            return "ml_p2";
-          case TargetDevice::ml_p3:
-            return "ml_p3";
-          case TargetDevice::jetson_tx1:
-            return "jetson_tx1";
-          case TargetDevice::jetson_tx2:
-            return "jetson_tx2";
-          case TargetDevice::rasp3b:
-            return "rasp3b";
-          case TargetDevice::deeplens:
-            return "deeplens";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTargetDevice(TargetDevice enumValue)
+        {
+          return GetNameForTargetDeviceCStr(enumValue);
         }
 
       } // namespace TargetDeviceMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace TrainingInputModeMapper
       {
 
-        static const int Pipe_HASH = HashingUtils::HashString("Pipe");
-        static const int File_HASH = HashingUtils::HashString("File");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pipe",
+          "File",
+        };
 
         TrainingInputMode GetTrainingInputModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pipe_HASH)
-          {
-            return TrainingInputMode::Pipe;
-          }
-          else if (hashCode == File_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TrainingInputMode::File;
+          case 2487758:
+            if (name == "Pipe")
+            {
+              return TrainingInputMode::Pipe;
+            }
+            break;
+          case 2189724:
+            if (name == "File")
+            {
+              return TrainingInputMode::File;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TrainingInputMode::NOT_SET;
         }
 
-        Aws::String GetNameForTrainingInputMode(TrainingInputMode enumValue)
+        const char* GetNameForTrainingInputModeCStr(TrainingInputMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TrainingInputMode::Pipe:
-            return "Pipe";
-          case TrainingInputMode::File:
-            return "File";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTrainingInputMode(TrainingInputMode enumValue)
+        {
+          return GetNameForTrainingInputModeCStr(enumValue);
         }
 
       } // namespace TrainingInputModeMapper
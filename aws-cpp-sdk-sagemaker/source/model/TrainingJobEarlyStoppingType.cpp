@@ -30,20 +30,37 @@ namespace Aws
       namespace TrainingJobEarlyStoppingTypeMapper
       {
 
-        static const int Off_HASH = HashingUtils::HashString("Off");
-        static const int Auto_HASH = HashingUtils::HashString("Auto");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Off",
+          "Auto",
+        };
 
         TrainingJobEarlyStoppingType GetTrainingJobEarlyStoppingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Off_HASH)
-          {
-            return TrainingJobEarlyStoppingType::Off;
-          }
-          else if (hashCode == Auto_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TrainingJobEarlyStoppingType::Auto;
+          case 79183:
+            if (name == "Off")
+            {
+              return TrainingJobEarlyStoppingType::Off;
+            }
+            break;
+          case 2052559:
+            if (name == "Auto")
+            {
+              return TrainingJobEarlyStoppingType::Auto;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TrainingJobEarlyStoppingType::NOT_SET;
         }
 
-        Aws::String GetNameForTrainingJobEarlyStoppingType(TrainingJobEarlyStoppingType enumValue)
+        const char* GetNameForTrainingJobEarlyStoppingTypeCStr(TrainingJobEarlyStoppingType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TrainingJobEarlyStoppingType::Off:
-            return "Off";
-          case TrainingJobEarlyStoppingType::Auto:
-            return "Auto";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTrainingJobEarlyStoppingType(TrainingJobEarlyStoppingType enumValue)
+        {
+          return GetNameForTrainingJobEarlyStoppingTypeCStr(enumValue);
         }
 
       } // namespace TrainingJobEarlyStoppingTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace TrainingJobSortByOptionsMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int FinalObjectiveMetricValue_HASH = HashingUtils::HashString("FinalObjectiveMetricValue");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "CreationTime",
+          "Status",
+          "FinalObjectiveMetricValue",
+        };
 
         TrainingJobSortByOptions GetTrainingJobSortByOptionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return TrainingJobSortByOptions::Name;
-          }
-          else if (hashCode == CreationTime_HASH)
-          {
-            return TrainingJobSortByOptions::CreationTime;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return TrainingJobSortByOptions::Status;
-          }
-          else if (hashCode == FinalObjectiveMetricValue_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TrainingJobSortByOptions::FinalObjectiveMetricValue;
+          case 2420395:
+            if (name == "Name")
+            {
+              return TrainingJobSortByOptions::Name;
+            }
+            break;
+          case 1750336108:
+            if (name == "CreationTime")
+            {
+              return TrainingJobSortByOptions::CreationTime;
+            }
+            break;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return TrainingJobSortByOptions::Status;
+            }
+            break;
+          case -1517430498:
+            if (name == "FinalObjectiveMetricValue")
+            {
+              return TrainingJobSortByOptions::FinalObjectiveMetricValue;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return TrainingJobSortByOptions::NOT_SET;
         }
 
-        Aws::String GetNameForTrainingJobSortByOptions(TrainingJobSortByOptions enumValue)
+        const char* GetNameForTrainingJobSortByOptionsCStr(TrainingJobSortByOptions enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TrainingJobSortByOptions::Name:
-            return "Name";
-          case TrainingJobSortByOptions::CreationTime:
-            return "CreationTime";
-          case TrainingJobSortByOptions::Status:
-            return "Status";
-          case TrainingJobSortByOptions::FinalObjectiveMetricValue:
-            return "FinalObjectiveMetricValue";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTrainingJobSortByOptions(TrainingJobSortByOptions enumValue)
+        {
+          return GetNameForTrainingJobSortByOptionsCStr(enumValue);
         }
 
       } // namespace TrainingJobSortByOptionsMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace TrainingJobStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InProgress",
+          "Completed",
+          "Failed",
+          "Stopping",
+          "Stopped",
+        };
 
         TrainingJobStatus GetTrainingJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TrainingJobStatus::InProgress;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return TrainingJobStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return TrainingJobStatus::Failed;
-          }
-          else if (hashCode == Stopping_HASH)
-          {
-            return TrainingJobStatus::Stopping;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return TrainingJobStatus::Stopped;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return TrainingJobStatus::InProgress;
+            }
+            break;
+          case 601036331:
+            if (name == "Completed")
+            {
+              return TrainingJobStatus::Completed;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return TrainingJobStatus::Failed;
+            }
+            break;
+          case 1780292756:
+            if (name == "Stopping")
+            {
+              return TrainingJobStatus::Stopping;
+            }
+            break;
+          case -219666003:
+            if (name == "Stopped")
+            {
+              return TrainingJobStatus::Stopped;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return TrainingJobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTrainingJobStatus(TrainingJobStatus enumValue)
+        const char* GetNameForTrainingJobStatusCStr(TrainingJobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TrainingJobStatus::InProgress:
-            return "InProgress";
-          case TrainingJobStatus::Completed:
-            return "Completed";
-          case TrainingJobStatus::Failed:
-            return "Failed";
-          case TrainingJobStatus::Stopping:
-            return "Stopping";
-          case TrainingJobStatus::Stopped:
-            return "Stopped";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTrainingJobStatus(TrainingJobStatus enumValue)
+        {
+          return GetNameForTrainingJobStatusCStr(enumValue);
         }
 
       } // namespace TrainingJobStatusMapper
@@ -30,140 +30,205 @@ namespace Aws
       namespace TransformInstanceTypeMapper
       {
 
-        static const int ml_m4_xlarge_HASH = HashingUtils::HashString("ml.m4.xlarge");
-        static const int ml_m4_2xlarge_HASH = HashingUtils::HashString("ml.m4.2xlarge");
-        static const int ml_m4_4xlarge_HASH = HashingUtils::HashString("ml.m4.4xlarge");
-        static const int ml_m4_10xlarge_HASH = HashingUtils::HashString("ml.m4.10xlarge");
-        static const int ml_m4_16xlarge_HASH = HashingUtils::HashString("ml.m4.16xlarge");
-        static const int ml_c4_xlarge_HASH = HashingUtils::HashString("ml.c4.xlarge");
-        static const int ml_c4_2xlarge_HASH = HashingUtils::HashString("ml.c4.2xlarge");
-        static const int ml_c4_4xlarge_HASH = HashingUtils::HashString("ml.c4.4xlarge");
-        static const int ml_c4_8xlarge_HASH = HashingUtils::HashString("ml.c4.8xlarge");
-        static const int ml_p2_xlarge_HASH = HashingUtils::HashString("ml.p2.xlarge");
-        static const int ml_p2_8xlarge_HASH = HashingUtils::HashString("ml.p2.8xlarge");
-        static const int ml_p2_16xlarge_HASH = HashingUtils::HashString("ml.p2.16xlarge");
-        static const int ml_p3_2xlarge_HASH = HashingUtils::HashString("ml.p3.2xlarge");
-        static const int ml_p3_8xlarge_HASH = HashingUtils::HashString("ml.p3.8xlarge");
-        static const int ml_p3_16xlarge_HASH = HashingUtils::HashString("ml.p3.16xlarge");
-        static const int ml_c5_xlarge_HASH = HashingUtils::HashString("ml.c5.xlarge");
-        static const int ml_c5_2xlarge_HASH = HashingUtils::HashString("ml.c5.2xlarge");
-        static const int ml_c5_4xlarge_HASH = HashingUtils::HashString("ml.c5.4xlarge");
-        static const int ml_c5_9xlarge_HASH = HashingUtils::HashString("ml.c5.9xlarge");
-        static const int ml_c5_18xlarge_HASH = HashingUtils::HashString("ml.c5.18xlarge");
-        static const int ml_m5_large_HASH = HashingUtils::HashString("ml.m5.large");
-        static const int ml_m5_xlarge_HASH = HashingUtils::HashString("ml.m5.xlarge");
-        static const int ml_m5_2xlarge_HASH = HashingUtils::HashString("ml.m5.2xlarge");
-        static const int ml_m5_4xlarge_HASH = HashingUtils::HashString("ml.m5.4xlarge");
-        static const int ml_m5_12xlarge_HASH = HashingUtils::HashString("ml.m5.12xlarge");
-        static const int ml_m5_24xlarge_HASH = HashingUtils::HashString("ml.m5.24xlarge");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ml.m4.xlarge",
+          "ml.m4.2xlarge",
+          "ml.m4.4xlarge",
+          "ml.m4.10xlarge",
+          "ml.m4.16xlarge",
+          "ml.c4.xlarge",
+          "ml.c4.2xlarge",
+          "ml.c4.4xlarge",
+          "ml.c4.8xlarge",
+          "ml.p2.xlarge",
+          "ml.p2.8xlarge",
+          "ml.p2.16xlarge",
+          "ml.p3.2xlarge",
+          "ml.p3.8xlarge",
+          "ml.p3.16xlarge",
+          "ml.c5.xlarge",
+          "ml.c5.2xlarge",
+          "ml.c5.4xlarge",
+          "ml.c5.9xlarge",
+          "ml.c5.18xlarge",
+          "ml.m5.large",
+          "ml.m5.xlarge",
+          "ml.m5.2xlarge",
+          "ml.m5.4xlarge",
+          "ml.m5.12xlarge",
+          "ml.m5.24xlarge",
+        };
 
         TransformInstanceType GetTransformInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ml_m4_xlarge_HASH)
-          {
-            return TransformInstanceType::ml_m4_xlarge;
-          }
-          else if (hashCode == ml_m4_2xlarge_HASH)
-          {
-            return TransformInstanceType::ml_m4_2xlarge;
-          }
-          else if (hashCode == ml_m4_4xlarge_HASH)
-          {
-            return TransformInstanceType::ml_m4_4xlarge;
-          }
-          else if (hashCode == ml_m4_10xlarge_HASH)
-          {
-            return TransformInstanceType::ml_m4_10xlarge;
-          }
-          else if (hashCode == ml_m4_16xlarge_HASH)
-          {
-            return TransformInstanceType::ml_m4_16xlarge;
-          }
-          else if (hashCode == ml_c4_xlarge_HASH)
-          {
-            return TransformInstanceType::ml_c4_xlarge;
-          }
-          else if (hashCode == ml_c4_2xlarge_HASH)
-          {
-            return TransformInstanceType::ml_c4_2xlarge;
-          }
-          else if (hashCode == ml_c4_4xlarge_HASH)
-          {
-            return TransformInstanceType::ml_c4_4xlarge;
-          }
-          else if (hashCode == ml_c4_8xlarge_HASH)
-          {
-            return TransformInstanceType::ml_c4_8xlarge;
-          }
-          else if (hashCode == ml_p2_xlarge_HASH)
-          {
-            return TransformInstanceType::ml_p2_xlarge;
-          }
-          else if (hashCode == ml_p2_8xlarge_HASH)
-          {
-            return TransformInstanceType::ml_p2_8xlarge;
-          }
-          else if (hashCode == ml_p2_16xlarge_HASH)
-          {
-            return TransformInstanceType::ml_p2_16xlarge;
-          }
-          else if (hashCode == ml_p3_2xlarge_HASH)
-          {
-            return TransformInstanceType::ml_p3_2xlarge;
-          }
-          else if (hashCode == ml_p3_8xlarge_HASH)
-          {
-            return TransformInstanceType::ml_p3_8xlarge;
-          }
-          else if (hashCode == ml_p3_16xlarge_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TransformInstanceType::ml_p3_16xlarge;
-          }
-          else if (hashCode == ml_c5_xlarge_HASH)
-          {
-            return TransformInstanceType::ml_c5_xlarge;
-          }
-          else if (hashCode == ml_c5_2xlarge_HASH)
-          {
-            return TransformInstanceType::ml_c5_2xlarge;
-          }
-          else if (hashCode == ml_c5_4xlarge_HASH)
-          {
-            return TransformInstanceType::ml_c5_4xlarge;
-          }
-          else if (hashCode == ml_c5_9xlarge_HASH)
-          {
-            return TransformInstanceType::ml_c5_9xlarge;
-          }
-          else if (hashCode == ml_c5_18xlarge_HASH)
-          {
-            return TransformInstanceType::ml_c5_18xlarge;
-          }
-          else if (hashCode == ml_m5_large_HASH)
-          {
-            return TransformInstanceType::ml_m5_large;
-          }
-          else if (hashCode == ml_m5_xlarge_HASH)
-          {
-            return TransformInstanceType::ml_m5_xlarge;
-          }
-          else if (hashCode == ml_m5_2xlarge_HASH)
-          {
-            return TransformInstanceType::ml_m5_2xlarge;
-          }
-          else if (hashCode == ml_m5_4xlarge_HASH)
-          {
-            return TransformInstanceType::ml_m5_4xlarge;
-          }
-          else if (hashCode == ml_m5_12xlarge_HASH)
-          {
-            return TransformInstanceType::ml_m5_12xlarge;
-          }
-          else if (hashCode == ml_m5_24xlarge_HASH)
-          {
-            return TransformInstanceType::ml_m5_24xlarge;
+          case -1955237221:
+            if (name == "ml.m4.xlarge")
+            {
+              return TransformInstanceType::ml_m4_xlarge;
+            }
+            break;
+          case -2125314403:
+            if (name == "ml.m4.2xlarge")
+            {
+              return TransformInstanceType::ml_m4_2xlarge;
+            }
+            break;
+          case -350307041:
+            if (name == "ml.m4.4xlarge")
+            {
+              return TransformInstanceType::ml_m4_4xlarge;
+            }
+            break;
+          case 1969377146:
+            if (name == "ml.m4.10xlarge")
+            {
+              return TransformInstanceType::ml_m4_10xlarge;
+            }
+            break;
+          case -1295535360:
+            if (name == "ml.m4.16xlarge")
+            {
+              return TransformInstanceType::ml_m4_16xlarge;
+            }
+            break;
+          case -1060561775:
+            if (name == "ml.c4.xlarge")
+            {
+              return TransformInstanceType::ml_c4_xlarge;
+            }
+            break;
+          case -160179353:
+            if (name == "ml.c4.2xlarge")
+            {
+              return TransformInstanceType::ml_c4_2xlarge;
+            }
+            break;
+          case 1614828009:
+            if (name == "ml.c4.4xlarge")
+            {
+              return TransformInstanceType::ml_c4_4xlarge;
+            }
+            break;
+          case 869875437:
+            if (name == "ml.c4.8xlarge")
+            {
+              return TransformInstanceType::ml_c4_8xlarge;
+            }
+            break;
+          case 2021680608:
+            if (name == "ml.p2.xlarge")
+            {
+              return TransformInstanceType::ml_p2_xlarge;
+            }
+            break;
+          case 1930108798:
+            if (name == "ml.p2.8xlarge")
+            {
+              return TransformInstanceType::ml_p2_8xlarge;
+            }
+            break;
+          case -1998395131:
+            if (name == "ml.p2.16xlarge")
+            {
+              return TransformInstanceType::ml_p2_16xlarge;
+            }
+            break;
+          case -907400455:
+            if (name == "ml.p3.2xlarge")
+            {
+              return TransformInstanceType::ml_p3_2xlarge;
+            }
+            break;
+          case 122654335:
+            if (name == "ml.p3.8xlarge")
+            {
+              return TransformInstanceType::ml_p3_8xlarge;
+            }
+            break;
+          case 2100058660:
+            if (name == "ml.p3.16xlarge")
+            {
+              return TransformInstanceType::ml_p3_16xlarge;
+            }
+            break;
+          case 682248560:
+            if (name == "ml.c5.xlarge")
+            {
+              return TransformInstanceType::ml_c5_xlarge;
+            }
+            break;
+          case -1967633816:
+            if (name == "ml.c5.2xlarge")
+            {
+              return TransformInstanceType::ml_c5_2xlarge;
+            }
+            break;
+          case -192626454:
+            if (name == "ml.c5.4xlarge")
+            {
+              return TransformInstanceType::ml_c5_4xlarge;
+            }
+            break;
+          case -50075345:
+            if (name == "ml.c5.9xlarge")
+            {
+              return TransformInstanceType::ml_c5_9xlarge;
+            }
+            break;
+          case 1072602903:
+            if (name == "ml.c5.18xlarge")
+            {
+              return TransformInstanceType::ml_c5_18xlarge;
+            }
+            break;
+          case -1680814428:
+            if (name == "ml.m5.large")
+            {
+              return TransformInstanceType::ml_m5_large;
+            }
+            break;
+          case -212426886:
+            if (name == "ml.m5.xlarge")
+            {
+              return TransformInstanceType::ml_m5_xlarge;
+            }
+            break;
+          case 362198430:
+            if (name == "ml.m5.2xlarge")
+            {
+              return TransformInstanceType::ml_m5_2xlarge;
+            }
+            break;
+          case 2137205792:
+            if (name == "ml.m5.4xlarge")
+            {
+              return TransformInstanceType::ml_m5_4xlarge;
+            }
+            break;
+          case -747096293:
+            if (name == "ml.m5.12xlarge")
+            {
+              return TransformInstanceType::ml_m5_12xlarge;
+            }
+            break;
+          case -1524245892:
+            if (name == "ml.m5.24xlarge")
+            {
+              return TransformInstanceType::ml_m5_24xlarge;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -175,71 +240,26 @@ namespace Aws
           return TransformInstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForTransformInstanceType(TransformInstanceType enumValue)
+        const char* GetNameForTransformInstanceTypeCStr(TransformInstanceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TransformInstanceType::ml_m4_xlarge:
-            return "ml.m4.xlarge";
-          case TransformInstanceType::ml_m4_2xlarge:
-            return "ml.m4.2xlarge";
-          case TransformInstanceType::ml_m4_4xlarge:
-            return "ml.m4.4xlarge";
-          case TransformInstanceType::ml_m4_10xlarge:
-            return "ml.m4.10xlarge";
-          case TransformInstanceType::ml_m4_16xlarge:
-            return "ml.m4.16xlarge";
-          case TransformInstanceType::ml_c4_xlarge:
-            return "ml.c4.xlarge";
-          case TransformInstanceType::ml_c4_2xlarge:
-            return "ml.c4.2xlarge";
-          case TransformInstanceType::ml_c4_4xlarge:
-            return "ml.c4.4xlarge";
-          case TransformInstanceType::ml_c4_8xlarge:
-            return "ml.c4.8xlarge";
-          case TransformInstanceType::ml_p2_xlarge:
-            return "ml.p2.xlarge";
-          case TransformInstanceType::ml_p2_8xlarge:
-            return "ml.p2.8xlarge";
-          case TransformInstanceType::ml_p2_16xlarge:
-            return "ml.p2.16xlarge";
-          case TransformInstanceType::ml_p3_2xlarge:
-            return "ml.p3.2xlarge";
-          case TransformInstanceType::ml_p3_8xlarge:
-            return "ml.p3.8xlarge";
-          case TransformInstanceType::ml_p3_16xlarge:
-            return "ml.p3.16xlarge";
-          case TransformInstanceType::ml_c5_xlarge:
-            return "ml.c5.xlarge";
-          case TransformInstanceType::ml_c5_2xlarge:
-            return "ml.c5.2xlarge";
-          case TransformInstanceType::ml_c5_4xlarge:
-            return "ml.c5.4xlarge";
-          case TransformInstanceType::ml_c5_9xlarge:
-            return "ml.c5.9xlarge";
-          case TransformInstanceType::ml_c5_18xlarge:
-            return "ml.c5.18xlarge";
-          case TransformInstanceType::ml_m5_large:
-            return "ml.m5.large";
-          case TransformInstanceType::ml_m5_xlarge:
-            return "ml.m5.xlarge";
-          case TransformInstanceType::ml_m5_2xlarge:
-            return "ml.m5.2xlarge";
-          case TransformInstanceType::ml_m5_4xlarge:
-            return "ml.m5.4xlarge";
-          case TransformInstanceType::ml_m5_12xlarge:
-            return "ml.m5.12xlarge";
-          case TransformInstanceType::ml_m5_24xlarge:
-            return "ml.m5.24xlarge";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTransformInstanceType(TransformInstanceType enumValue)
+        {
+          return GetNameForTransformInstanceTypeCStr(enumValue);
         }
 
       } // namespace TransformInstanceTypeMapper
@@ -35,6 +35,11 @@ namespace AwsIamAccessKeyStatusMapper
 AWS_SECURITYHUB_API AwsIamAccessKeyStatus GetAwsIamAccessKeyStatusForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForAwsIamAccessKeyStatus(AwsIamAccessKeyStatus value);
+
+/**
+ * Same as GetNameForAwsIamAccessKeyStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForAwsIamAccessKeyStatusCStr(AwsIamAccessKeyStatus value);
 } // namespace AwsIamAccessKeyStatusMapper
 } // namespace Model
 } // namespace SecurityHub
@@ -37,6 +37,11 @@ namespace ComplianceStatusMapper
 AWS_SECURITYHUB_API ComplianceStatus GetComplianceStatusForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForComplianceStatus(ComplianceStatus value);
+
+/**
+ * Same as GetNameForComplianceStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForComplianceStatusCStr(ComplianceStatus value);
 } // namespace ComplianceStatusMapper
 } // namespace Model
 } // namespace SecurityHub
@@ -34,6 +34,11 @@ namespace DateRangeUnitMapper
 AWS_SECURITYHUB_API DateRangeUnit GetDateRangeUnitForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForDateRangeUnit(DateRangeUnit value);
+
+/**
+ * Same as GetNameForDateRangeUnit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForDateRangeUnitCStr(DateRangeUnit value);
 } // namespace DateRangeUnitMapper
 } // namespace Model
 } // namespace SecurityHub
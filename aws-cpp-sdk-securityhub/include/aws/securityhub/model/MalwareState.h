@@ -36,6 +36,11 @@ namespace MalwareStateMapper
 AWS_SECURITYHUB_API MalwareState GetMalwareStateForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForMalwareState(MalwareState value);
+
+/**
+ * Same as GetNameForMalwareState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForMalwareStateCStr(MalwareState value);
 } // namespace MalwareStateMapper
 } // namespace Model
 } // namespace SecurityHub
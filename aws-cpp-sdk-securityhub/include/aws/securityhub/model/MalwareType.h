@@ -48,6 +48,11 @@ namespace MalwareTypeMapper
 AWS_SECURITYHUB_API MalwareType GetMalwareTypeForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForMalwareType(MalwareType value);
+
+/**
+ * Same as GetNameForMalwareType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForMalwareTypeCStr(MalwareType value);
 } // namespace MalwareTypeMapper
 } // namespace Model
 } // namespace SecurityHub
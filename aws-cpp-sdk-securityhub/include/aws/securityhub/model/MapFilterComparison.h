@@ -34,6 +34,11 @@ namespace MapFilterComparisonMapper
 AWS_SECURITYHUB_API MapFilterComparison GetMapFilterComparisonForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForMapFilterComparison(MapFilterComparison value);
+
+/**
+ * Same as GetNameForMapFilterComparison(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForMapFilterComparisonCStr(MapFilterComparison value);
 } // namespace MapFilterComparisonMapper
 } // namespace Model
 } // namespace SecurityHub
@@ -35,6 +35,11 @@ namespace NetworkDirectionMapper
 AWS_SECURITYHUB_API NetworkDirection GetNetworkDirectionForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForNetworkDirection(NetworkDirection value);
+
+/**
+ * Same as GetNameForNetworkDirection(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForNetworkDirectionCStr(NetworkDirection value);
 } // namespace NetworkDirectionMapper
 } // namespace Model
 } // namespace SecurityHub
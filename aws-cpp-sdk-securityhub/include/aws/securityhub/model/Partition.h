@@ -36,6 +36,11 @@ namespace PartitionMapper
 AWS_SECURITYHUB_API Partition GetPartitionForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForPartition(Partition value);
+
+/**
+ * Same as GetNameForPartition(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForPartitionCStr(Partition value);
 } // namespace PartitionMapper
 } // namespace Model
 } // namespace SecurityHub
@@ -35,6 +35,11 @@ namespace RecordStateMapper
 AWS_SECURITYHUB_API RecordState GetRecordStateForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForRecordState(RecordState value);
+
+/**
+ * Same as GetNameForRecordState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForRecordStateCStr(RecordState value);
 } // namespace RecordStateMapper
 } // namespace Model
 } // namespace SecurityHub
@@ -35,6 +35,11 @@ namespace SortOrderMapper
 AWS_SECURITYHUB_API SortOrder GetSortOrderForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForSortOrder(SortOrder value);
+
+/**
+ * Same as GetNameForSortOrder(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForSortOrderCStr(SortOrder value);
 } // namespace SortOrderMapper
 } // namespace Model
 } // namespace SecurityHub
@@ -37,6 +37,11 @@ namespace StandardsStatusMapper
 AWS_SECURITYHUB_API StandardsStatus GetStandardsStatusForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForStandardsStatus(StandardsStatus value);
+
+/**
+ * Same as GetNameForStandardsStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForStandardsStatusCStr(StandardsStatus value);
 } // namespace StandardsStatusMapper
 } // namespace Model
 } // namespace SecurityHub
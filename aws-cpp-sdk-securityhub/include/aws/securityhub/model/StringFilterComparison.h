@@ -36,6 +36,11 @@ namespace StringFilterComparisonMapper
 AWS_SECURITYHUB_API StringFilterComparison GetStringFilterComparisonForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForStringFilterComparison(StringFilterComparison value);
+
+/**
+ * Same as GetNameForStringFilterComparison(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForStringFilterComparisonCStr(StringFilterComparison value);
 } // namespace StringFilterComparisonMapper
 } // namespace Model
 } // namespace SecurityHub
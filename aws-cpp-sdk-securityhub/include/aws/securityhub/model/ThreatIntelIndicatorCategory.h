@@ -39,6 +39,11 @@ namespace ThreatIntelIndicatorCategoryMapper
 AWS_SECURITYHUB_API ThreatIntelIndicatorCategory GetThreatIntelIndicatorCategoryForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForThreatIntelIndicatorCategory(ThreatIntelIndicatorCategory value);
+
+/**
+ * Same as GetNameForThreatIntelIndicatorCategory(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForThreatIntelIndicatorCategoryCStr(ThreatIntelIndicatorCategory value);
 } // namespace ThreatIntelIndicatorCategoryMapper
 } // namespace Model
 } // namespace SecurityHub
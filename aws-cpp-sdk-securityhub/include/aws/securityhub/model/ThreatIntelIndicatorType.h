@@ -44,6 +44,11 @@ namespace ThreatIntelIndicatorTypeMapper
 AWS_SECURITYHUB_API ThreatIntelIndicatorType GetThreatIntelIndicatorTypeForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForThreatIntelIndicatorType(ThreatIntelIndicatorType value);
+
+/**
+ * Same as GetNameForThreatIntelIndicatorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForThreatIntelIndicatorTypeCStr(ThreatIntelIndicatorType value);
 } // namespace ThreatIntelIndicatorTypeMapper
 } // namespace Model
 } // namespace SecurityHub
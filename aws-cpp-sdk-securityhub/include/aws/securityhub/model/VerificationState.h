@@ -37,6 +37,11 @@ namespace VerificationStateMapper
 AWS_SECURITYHUB_API VerificationState GetVerificationStateForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForVerificationState(VerificationState value);
+
+/**
+ * Same as GetNameForVerificationState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForVerificationStateCStr(VerificationState value);
 } // namespace VerificationStateMapper
 } // namespace Model
 } // namespace SecurityHub
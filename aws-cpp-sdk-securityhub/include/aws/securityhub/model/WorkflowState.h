@@ -38,6 +38,11 @@ namespace WorkflowStateMapper
 AWS_SECURITYHUB_API WorkflowState GetWorkflowStateForName(const Aws::String& name);
 
 AWS_SECURITYHUB_API Aws::String GetNameForWorkflowState(WorkflowState value);
+
+/**
+ * Same as GetNameForWorkflowState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SECURITYHUB_API const char* GetNameForWorkflowStateCStr(WorkflowState value);
 } // namespace WorkflowStateMapper
 } // namespace Model
 } // namespace SecurityHub
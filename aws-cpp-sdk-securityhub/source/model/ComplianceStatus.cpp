@@ -30,30 +30,51 @@ namespace Aws
       namespace ComplianceStatusMapper
       {
 
-        static const int PASSED_HASH = HashingUtils::HashString("PASSED");
-        static const int WARNING_HASH = HashingUtils::HashString("WARNING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int NOT_AVAILABLE_HASH = HashingUtils::HashString("NOT_AVAILABLE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PASSED",
+          "WARNING",
+          "FAILED",
+          "NOT_AVAILABLE",
+        };
 
         ComplianceStatus GetComplianceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PASSED_HASH)
-          {
-            return ComplianceStatus::PASSED;
-          }
-          else if (hashCode == WARNING_HASH)
-          {
-            return ComplianceStatus::WARNING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ComplianceStatus::FAILED;
-          }
-          else if (hashCode == NOT_AVAILABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComplianceStatus::NOT_AVAILABLE;
+          case -1942051728:
+            if (name == "PASSED")
+            {
+              return ComplianceStatus::PASSED;
+            }
+            break;
+          case 1842428796:
+            if (name == "WARNING")
+            {
+              return ComplianceStatus::WARNING;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ComplianceStatus::FAILED;
+            }
+            break;
+          case 140722205:
+            if (name == "NOT_AVAILABLE")
+            {
+              return ComplianceStatus::NOT_AVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ComplianceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForComplianceStatus(ComplianceStatus enumValue)
+        const char* GetNameForComplianceStatusCStr(ComplianceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComplianceStatus::PASSED:
-            return "PASSED";
-          case ComplianceStatus::WARNING:
-            return "WARNING";
-          case ComplianceStatus::FAILED:
-            return "FAILED";
-          case ComplianceStatus::NOT_AVAILABLE:
-            return "NOT_AVAILABLE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComplianceStatus(ComplianceStatus enumValue)
+        {
+          return GetNameForComplianceStatusCStr(enumValue);
         }
 
       } // namespace ComplianceStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace DateRangeUnitMapper
       {
 
-        static const int DAYS_HASH = HashingUtils::HashString("DAYS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DAYS",
+        };
 
         DateRangeUnit GetDateRangeUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DAYS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DateRangeUnit::DAYS;
+          case 2091095:
+            if (name == "DAYS")
+            {
+              return DateRangeUnit::DAYS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return DateRangeUnit::NOT_SET;
         }
 
-        Aws::String GetNameForDateRangeUnit(DateRangeUnit enumValue)
+        const char* GetNameForDateRangeUnitCStr(DateRangeUnit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DateRangeUnit::DAYS:
-            return "DAYS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDateRangeUnit(DateRangeUnit enumValue)
+        {
+          return GetNameForDateRangeUnitCStr(enumValue);
         }
 
       } // namespace DateRangeUnitMapper
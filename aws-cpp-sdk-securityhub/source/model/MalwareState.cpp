@@ -30,25 +30,44 @@ namespace Aws
       namespace MalwareStateMapper
       {
 
-        static const int OBSERVED_HASH = HashingUtils::HashString("OBSERVED");
-        static const int REMOVAL_FAILED_HASH = HashingUtils::HashString("REMOVAL_FAILED");
-        static const int REMOVED_HASH = HashingUtils::HashString("REMOVED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OBSERVED",
+          "REMOVAL_FAILED",
+          "REMOVED",
+        };
 
         MalwareState GetMalwareStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OBSERVED_HASH)
-          {
-            return MalwareState::OBSERVED;
-          }
-          else if (hashCode == REMOVAL_FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MalwareState::REMOVAL_FAILED;
-          }
-          else if (hashCode == REMOVED_HASH)
-          {
-            return MalwareState::REMOVED;
+          case 1131233992:
+            if (name == "OBSERVED")
+            {
+              return MalwareState::OBSERVED;
+            }
+            break;
+          case -1898167280:
+            if (name == "REMOVAL_FAILED")
+            {
+              return MalwareState::REMOVAL_FAILED;
+            }
+            break;
+          case 1809818688:
+            if (name == "REMOVED")
+            {
+              return MalwareState::REMOVED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return MalwareState::NOT_SET;
         }
 
-        Aws::String GetNameForMalwareState(MalwareState enumValue)
+        const char* GetNameForMalwareStateCStr(MalwareState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MalwareState::OBSERVED:
-            return "OBSERVED";
-          case MalwareState::REMOVAL_FAILED:
-            return "REMOVAL_FAILED";
-          case MalwareState::REMOVED:
-            return "REMOVED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMalwareState(MalwareState enumValue)
+        {
+          return GetNameForMalwareStateCStr(enumValue);
         }
 
       } // namespace MalwareStateMapper
@@ -30,85 +30,128 @@ namespace Aws
       namespace MalwareTypeMapper
       {
 
-        static const int ADWARE_HASH = HashingUtils::HashString("ADWARE");
-        static const int BLENDED_THREAT_HASH = HashingUtils::HashString("BLENDED_THREAT");
-        static const int BOTNET_AGENT_HASH = HashingUtils::HashString("BOTNET_AGENT");
-        static const int COIN_MINER_HASH = HashingUtils::HashString("COIN_MINER");
-        static const int EXPLOIT_KIT_HASH = HashingUtils::HashString("EXPLOIT_KIT");
-        static const int KEYLOGGER_HASH = HashingUtils::HashString("KEYLOGGER");
-        static const int MACRO_HASH = HashingUtils::HashString("MACRO");
-        static const int POTENTIALLY_UNWANTED_HASH = HashingUtils::HashString("POTENTIALLY_UNWANTED");
-        static const int SPYWARE_HASH = HashingUtils::HashString("SPYWARE");
-        static const int RANSOMWARE_HASH = HashingUtils::HashString("RANSOMWARE");
-        static const int REMOTE_ACCESS_HASH = HashingUtils::HashString("REMOTE_ACCESS");
-        static const int ROOTKIT_HASH = HashingUtils::HashString("ROOTKIT");
-        static const int TROJAN_HASH = HashingUtils::HashString("TROJAN");
-        static const int VIRUS_HASH = HashingUtils::HashString("VIRUS");
-        static const int WORM_HASH = HashingUtils::HashString("WORM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADWARE",
+          "BLENDED_THREAT",
+          "BOTNET_AGENT",
+          "COIN_MINER",
+          "EXPLOIT_KIT",
+          "KEYLOGGER",
+          "MACRO",
+          "POTENTIALLY_UNWANTED",
+          "SPYWARE",
+          "RANSOMWARE",
+          "REMOTE_ACCESS",
+          "ROOTKIT",
+          "TROJAN",
+          "VIRUS",
+          "WORM",
+        };
 
         MalwareType GetMalwareTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADWARE_HASH)
-          {
-            return MalwareType::ADWARE;
-          }
-          else if (hashCode == BLENDED_THREAT_HASH)
-          {
-            return MalwareType::BLENDED_THREAT;
-          }
-          else if (hashCode == BOTNET_AGENT_HASH)
-          {
-            return MalwareType::BOTNET_AGENT;
-          }
-          else if (hashCode == COIN_MINER_HASH)
-          {
-            return MalwareType::COIN_MINER;
-          }
-          else if (hashCode == EXPLOIT_KIT_HASH)
-          {
-            return MalwareType::EXPLOIT_KIT;
-          }
-          else if (hashCode == KEYLOGGER_HASH)
-          {
-            return MalwareType::KEYLOGGER;
-          }
-          else if (hashCode == MACRO_HASH)
-          {
-            return MalwareType::MACRO;
-          }
-          else if (hashCode == POTENTIALLY_UNWANTED_HASH)
-          {
-            return MalwareType::POTENTIALLY_UNWANTED;
-          }
-          else if (hashCode == SPYWARE_HASH)
-          {
-            return MalwareType::SPYWARE;
-          }
-          else if (hashCode == RANSOMWARE_HASH)
-          {
-            return MalwareType::RANSOMWARE;
-          }
-          else if (hashCode == REMOTE_ACCESS_HASH)
-          {
-            return MalwareType::REMOTE_ACCESS;
-          }
-          else if (hashCode == ROOTKIT_HASH)
-          {
-            return MalwareType::ROOTKIT;
-          }
-          else if (hashCode == TROJAN_HASH)
-          {
-            return MalwareType::TROJAN;
-          }
-          else if (hashCode == VIRUS_HASH)
-          {
-            return MalwareType::VIRUS;
-          }
-          else if (hashCode == WORM_HASH)
-          {
-            return MalwareType::WORM;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 1926351136:
+            if (name == "ADWARE")
+            {
+              return MalwareType::ADWARE;
+            }
+            break;
+          case 558617769:
+            if (name == "BLENDED_THREAT")
+            {
+              return MalwareType::BLENDED_THREAT;
+            }
+            break;
+          case 1147204572:
+            if (name == "BOTNET_AGENT")
+            {
+              return MalwareType::BOTNET_AGENT;
+            }
+            break;
+          case 338593585:
+            if (name == "COIN_MINER")
+            {
+              return MalwareType::COIN_MINER;
+            }
+            break;
+          case 461973986:
+            if (name == "EXPLOIT_KIT")
+            {
+              return MalwareType::EXPLOIT_KIT;
+            }
+            break;
+          case 1509105807:
+            if (name == "KEYLOGGER")
+            {
+              return MalwareType::KEYLOGGER;
+            }
+            break;
+          case 73114540:
+            if (name == "MACRO")
+            {
+              return MalwareType::MACRO;
+            }
+            break;
+          case -378945988:
+            if (name == "POTENTIALLY_UNWANTED")
+            {
+              return MalwareType::POTENTIALLY_UNWANTED;
+            }
+            break;
+          case -1271423463:
+            if (name == "SPYWARE")
+            {
+              return MalwareType::SPYWARE;
+            }
+            break;
+          case 1029423759:
+            if (name == "RANSOMWARE")
+            {
+              return MalwareType::RANSOMWARE;
+            }
+            break;
+          case 1587380093:
+            if (name == "REMOTE_ACCESS")
+            {
+              return MalwareType::REMOTE_ACCESS;
+            }
+            break;
+          case 2098095764:
+            if (name == "ROOTKIT")
+            {
+              return MalwareType::ROOTKIT;
+            }
+            break;
+          case -1811963194:
+            if (name == "TROJAN")
+            {
+              return MalwareType::TROJAN;
+            }
+            break;
+          case 81679069:
+            if (name == "VIRUS")
+            {
+              return MalwareType::VIRUS;
+            }
+            break;
+          case 2670355:
+            if (name == "WORM")
+            {
+              return MalwareType::WORM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -120,49 +163,26 @@ namespace Aws
           return MalwareType::NOT_SET;
         }
 
-        Aws::String GetNameForMalwareType(MalwareType enumValue)
+        const char* GetNameForMalwareTypeCStr(MalwareType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MalwareType::ADWARE:
-            return "ADWARE";
-          case MalwareType::BLENDED_THREAT:
-            return "BLENDED_THREAT";
-          case MalwareType::BOTNET_AGENT:
-            return "BOTNET_AGENT";
-          case MalwareType::COIN_MINER:
-            return "COIN_MINER";
-          case MalwareType::EXPLOIT_KIT:
-            return "EXPLOIT_KIT";
-          case MalwareType::KEYLOGGER:
-            return "KEYLOGGER";
-          case MalwareType::MACRO:
-            return "MACRO";
-          case MalwareType::POTENTIALLY_UNWANTED:
-            return "POTENTIALLY_UNWANTED";
-          case MalwareType::SPYWARE:
-            return "SPYWARE";
-          case MalwareType::RANSOMWARE:
-            return "RANSOMWARE";
-          case MalwareType::REMOTE_ACCESS:
-            return "REMOTE_ACCESS";
-          case MalwareType::ROOTKIT:
-            return "ROOTKIT";
-          case MalwareType::TROJAN:
-            return "TROJAN";
-          case MalwareType::VIRUS:
-            return "VIRUS";
-          case MalwareType::WORM:
-            return "WORM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMalwareType(MalwareType enumValue)
+        {
+          return GetNameForMalwareTypeCStr(enumValue);
         }
 
       } // namespace MalwareTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace MapFilterComparisonMapper
       {
 
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONTAINS",
+        };
 
         MapFilterComparison GetMapFilterComparisonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONTAINS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MapFilterComparison::CONTAINS;
+          case 215180831:
+            if (name == "CONTAINS")
+            {
+              return MapFilterComparison::CONTAINS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return MapFilterComparison::NOT_SET;
         }
 
-        Aws::String GetNameForMapFilterComparison(MapFilterComparison enumValue)
+        const char* GetNameForMapFilterComparisonCStr(MapFilterComparison enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MapFilterComparison::CONTAINS:
-            return "CONTAINS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMapFilterComparison(MapFilterComparison enumValue)
+        {
+          return GetNameForMapFilterComparisonCStr(enumValue);
         }
 
       } // namespace MapFilterComparisonMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace NetworkDirectionMapper
       {
 
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int OUT_HASH = HashingUtils::HashString("OUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN",
+          "OUT",
+        };
 
         NetworkDirection GetNetworkDirectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_HASH)
-          {
-            return NetworkDirection::IN;
-          }
-          else if (hashCode == OUT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NetworkDirection::OUT;
+          case 2341:
+            if (name == "IN")
+            {
+              return NetworkDirection::IN;
+            }
+            break;
+          case 78638:
+            if (name == "OUT")
+            {
+              return NetworkDirection::OUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return NetworkDirection::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkDirection(NetworkDirection enumValue)
+        const char* GetNameForNetworkDirectionCStr(NetworkDirection enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NetworkDirection::IN:
-            return "IN";
-          case NetworkDirection::OUT:
-            return "OUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNetworkDirection(NetworkDirection enumValue)
+        {
+          return GetNameForNetworkDirectionCStr(enumValue);
         }
 
       } // namespace NetworkDirectionMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PartitionMapper
       {
 
-        static const int aws_HASH = HashingUtils::HashString("aws");
-        static const int aws_cn_HASH = HashingUtils::HashString("aws-cn");
-        static const int aws_us_gov_HASH = HashingUtils::HashString("aws-us-gov");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "aws",
+          "aws-cn",
+          "aws-us-gov",
+        };
 
         Partition GetPartitionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_HASH)
-          {
-            return Partition::aws;
-          }
-          else if (hashCode == aws_cn_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Partition::aws_cn;
-          }
-          else if (hashCode == aws_us_gov_HASH)
-          {
-            return Partition::aws_us_gov;
+          case 97021:
+            if (name == "aws")
+            {
+              return Partition::aws;
+            }
+            break;
+          case -1404568261:
+            if (name == "aws-cn")
+            {
+              return Partition::aws_cn;
+            }
+            break;
+          case 1079287215:
+            if (name == "aws-us-gov")
+            {
+              return Partition::aws_us_gov;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Partition::NOT_SET;
         }
 
-        Aws::String GetNameForPartition(Partition enumValue)
+        const char* GetNameForPartitionCStr(Partition enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Partition::aws:
-            return "aws";
-          case Partition::aws_cn:
-            return "aws-cn";
-          case Partition::aws_us_gov:
-            return "aws-us-gov";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPartition(Partition enumValue)
+        {
+          return GetNameForPartitionCStr(enumValue);
         }
 
       } // namespace PartitionMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace RecordStateMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int ARCHIVED_HASH = HashingUtils::HashString("ARCHIVED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "ARCHIVED",
+        };
 
         RecordState GetRecordStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return RecordState::ACTIVE;
-          }
-          else if (hashCode == ARCHIVED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RecordState::ARCHIVED;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return RecordState::ACTIVE;
+            }
+            break;
+          case -933681182:
+            if (name == "ARCHIVED")
+            {
+              return RecordState::ARCHIVED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RecordState::NOT_SET;
         }
 
-        Aws::String GetNameForRecordState(RecordState enumValue)
+        const char* GetNameForRecordStateCStr(RecordState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RecordState::ACTIVE:
-            return "ACTIVE";
-          case RecordState::ARCHIVED:
-            return "ARCHIVED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRecordState(RecordState enumValue)
+        {
+          return GetNameForRecordStateCStr(enumValue);
         }
 
       } // namespace RecordStateMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SortOrderMapper
       {
 
-        static const int asc_HASH = HashingUtils::HashString("asc");
-        static const int desc_HASH = HashingUtils::HashString("desc");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "asc",
+          "desc",
+        };
 
         SortOrder GetSortOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == asc_HASH)
-          {
-            return SortOrder::asc;
-          }
-          else if (hashCode == desc_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SortOrder::desc;
+          case 96881:
+            if (name == "asc")
+            {
+              return SortOrder::asc;
+            }
+            break;
+          case 3079825:
+            if (name == "desc")
+            {
+              return SortOrder::desc;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SortOrder::NOT_SET;
         }
 
-        Aws::String GetNameForSortOrder(SortOrder enumValue)
+        const char* GetNameForSortOrderCStr(SortOrder enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SortOrder::asc:
-            return "asc";
-          case SortOrder::desc:
-            return "desc";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSortOrder(SortOrder enumValue)
+        {
+          return GetNameForSortOrderCStr(enumValue);
         }
 
       } // namespace SortOrderMapper
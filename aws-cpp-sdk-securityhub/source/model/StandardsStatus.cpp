@@ -30,30 +30,51 @@ namespace Aws
       namespace StandardsStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "READY",
+          "FAILED",
+          "DELETING",
+        };
 
         StandardsStatus GetStandardsStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return StandardsStatus::PENDING;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return StandardsStatus::READY;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StandardsStatus::FAILED;
-          }
-          else if (hashCode == DELETING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StandardsStatus::DELETING;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return StandardsStatus::PENDING;
+            }
+            break;
+          case 77848963:
+            if (name == "READY")
+            {
+              return StandardsStatus::READY;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return StandardsStatus::FAILED;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return StandardsStatus::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return StandardsStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStandardsStatus(StandardsStatus enumValue)
+        const char* GetNameForStandardsStatusCStr(StandardsStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StandardsStatus::PENDING:
-            return "PENDING";
-          case StandardsStatus::READY:
-            return "READY";
-          case StandardsStatus::FAILED:
-            return "FAILED";
-          case StandardsStatus::DELETING:
-            return "DELETING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStandardsStatus(StandardsStatus enumValue)
+        {
+          return GetNameForStandardsStatusCStr(enumValue);
         }
 
       } // namespace StandardsStatusMapper
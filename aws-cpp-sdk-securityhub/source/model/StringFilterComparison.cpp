@@ -30,25 +30,44 @@ namespace Aws
       namespace StringFilterComparisonMapper
       {
 
-        static const int EQUALS_HASH = HashingUtils::HashString("EQUALS");
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
-        static const int PREFIX_HASH = HashingUtils::HashString("PREFIX");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EQUALS",
+          "CONTAINS",
+          "PREFIX",
+        };
 
         StringFilterComparison GetStringFilterComparisonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQUALS_HASH)
-          {
-            return StringFilterComparison::EQUALS;
-          }
-          else if (hashCode == CONTAINS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StringFilterComparison::CONTAINS;
-          }
-          else if (hashCode == PREFIX_HASH)
-          {
-            return StringFilterComparison::PREFIX;
+          case 2052813759:
+            if (name == "EQUALS")
+            {
+              return StringFilterComparison::EQUALS;
+            }
+            break;
+          case 215180831:
+            if (name == "CONTAINS")
+            {
+              return StringFilterComparison::CONTAINS;
+            }
+            break;
+          case -1926781294:
+            if (name == "PREFIX")
+            {
+              return StringFilterComparison::PREFIX;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return StringFilterComparison::NOT_SET;
         }
 
-        Aws::String GetNameForStringFilterComparison(StringFilterComparison enumValue)
+        const char* GetNameForStringFilterComparisonCStr(StringFilterComparison enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StringFilterComparison::EQUALS:
-            return "EQUALS";
-          case StringFilterComparison::CONTAINS:
-            return "CONTAINS";
-          case StringFilterComparison::PREFIX:
-            return "PREFIX";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStringFilterComparison(StringFilterComparison enumValue)
+        {
+          return GetNameForStringFilterComparisonCStr(enumValue);
         }
 
       } // namespace StringFilterComparisonMapper
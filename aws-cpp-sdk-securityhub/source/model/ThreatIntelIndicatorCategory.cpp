@@ -30,40 +30,65 @@ namespace Aws
       namespace ThreatIntelIndicatorCategoryMapper
       {
 
-        static const int BACKDOOR_HASH = HashingUtils::HashString("BACKDOOR");
-        static const int CARD_STEALER_HASH = HashingUtils::HashString("CARD_STEALER");
-        static const int COMMAND_AND_CONTROL_HASH = HashingUtils::HashString("COMMAND_AND_CONTROL");
-        static const int DROP_SITE_HASH = HashingUtils::HashString("DROP_SITE");
-        static const int EXPLOIT_SITE_HASH = HashingUtils::HashString("EXPLOIT_SITE");
-        static const int KEYLOGGER_HASH = HashingUtils::HashString("KEYLOGGER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BACKDOOR",
+          "CARD_STEALER",
+          "COMMAND_AND_CONTROL",
+          "DROP_SITE",
+          "EXPLOIT_SITE",
+          "KEYLOGGER",
+        };
 
         ThreatIntelIndicatorCategory GetThreatIntelIndicatorCategoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BACKDOOR_HASH)
-          {
-            return ThreatIntelIndicatorCategory::BACKDOOR;
-          }
-          else if (hashCode == CARD_STEALER_HASH)
-          {
-            return ThreatIntelIndicatorCategory::CARD_STEALER;
-          }
-          else if (hashCode == COMMAND_AND_CONTROL_HASH)
-          {
-            return ThreatIntelIndicatorCategory::COMMAND_AND_CONTROL;
-          }
-          else if (hashCode == DROP_SITE_HASH)
-          {
-            return ThreatIntelIndicatorCategory::DROP_SITE;
-          }
-          else if (hashCode == EXPLOIT_SITE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ThreatIntelIndicatorCategory::EXPLOIT_SITE;
-          }
-          else if (hashCode == KEYLOGGER_HASH)
-          {
-            return ThreatIntelIndicatorCategory::KEYLOGGER;
+          case -1390916331:
+            if (name == "BACKDOOR")
+            {
+              return ThreatIntelIndicatorCategory::BACKDOOR;
+            }
+            break;
+          case -1178969107:
+            if (name == "CARD_STEALER")
+            {
+              return ThreatIntelIndicatorCategory::CARD_STEALER;
+            }
+            break;
+          case -11972703:
+            if (name == "COMMAND_AND_CONTROL")
+            {
+              return ThreatIntelIndicatorCategory::COMMAND_AND_CONTROL;
+            }
+            break;
+          case -1992333673:
+            if (name == "DROP_SITE")
+            {
+              return ThreatIntelIndicatorCategory::DROP_SITE;
+            }
+            break;
+          case 1436530075:
+            if (name == "EXPLOIT_SITE")
+            {
+              return ThreatIntelIndicatorCategory::EXPLOIT_SITE;
+            }
+            break;
+          case 1509105807:
+            if (name == "KEYLOGGER")
+            {
+              return ThreatIntelIndicatorCategory::KEYLOGGER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ThreatIntelIndicatorCategory::NOT_SET;
         }
 
-        Aws::String GetNameForThreatIntelIndicatorCategory(ThreatIntelIndicatorCategory enumValue)
+        const char* GetNameForThreatIntelIndicatorCategoryCStr(ThreatIntelIndicatorCategory enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ThreatIntelIndicatorCategory::BACKDOOR:
-            return "BACKDOOR";
-          case ThreatIntelIndicatorCategory::CARD_STEALER:
-            return "CARD_STEALER";
-          case ThreatIntelIndicatorCategory::COMMAND_AND_CONTROL:
-            return "COMMAND_AND_CONTROL";
-          case ThreatIntelIndicatorCategory::DROP_SITE:
-            return "DROP_SITE";
-          case ThreatIntelIndicatorCategory::EXPLOIT_SITE:
-            return "EXPLOIT_SITE";
-          case ThreatIntelIndicatorCategory::KEYLOGGER:
-            return "KEYLOGGER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForThreatIntelIndicatorCategory(ThreatIntelIndicatorCategory enumValue)
+        {
+          return GetNameForThreatIntelIndicatorCategoryCStr(enumValue);
         }
 
       } // namespace ThreatIntelIndicatorCategoryMapper
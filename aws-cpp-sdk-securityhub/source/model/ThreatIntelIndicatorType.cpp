@@ -30,65 +30,100 @@ namespace Aws
       namespace ThreatIntelIndicatorTypeMapper
       {
 
-        static const int DOMAIN__HASH = HashingUtils::HashString("DOMAIN");
-        static const int EMAIL_ADDRESS_HASH = HashingUtils::HashString("EMAIL_ADDRESS");
-        static const int HASH_MD5_HASH = HashingUtils::HashString("HASH_MD5");
-        static const int HASH_SHA1_HASH = HashingUtils::HashString("HASH_SHA1");
-        static const int HASH_SHA256_HASH = HashingUtils::HashString("HASH_SHA256");
-        static const int HASH_SHA512_HASH = HashingUtils::HashString("HASH_SHA512");
-        static const int IPV4_ADDRESS_HASH = HashingUtils::HashString("IPV4_ADDRESS");
-        static const int IPV6_ADDRESS_HASH = HashingUtils::HashString("IPV6_ADDRESS");
-        static const int MUTEX_HASH = HashingUtils::HashString("MUTEX");
-        static const int PROCESS_HASH = HashingUtils::HashString("PROCESS");
-        static const int URL_HASH = HashingUtils::HashString("URL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DOMAIN",
+          "EMAIL_ADDRESS",
+          "HASH_MD5",
+          "HASH_SHA1",
+          "HASH_SHA256",
+          "HASH_SHA512",
+          "IPV4_ADDRESS",
+          "IPV6_ADDRESS",
+          "MUTEX",
+          "PROCESS",
+          "URL",
+        };
 
         ThreatIntelIndicatorType GetThreatIntelIndicatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DOMAIN__HASH)
-          {
-            return ThreatIntelIndicatorType::DOMAIN_;
-          }
-          else if (hashCode == EMAIL_ADDRESS_HASH)
-          {
-            return ThreatIntelIndicatorType::EMAIL_ADDRESS;
-          }
-          else if (hashCode == HASH_MD5_HASH)
-          {
-            return ThreatIntelIndicatorType::HASH_MD5;
-          }
-          else if (hashCode == HASH_SHA1_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ThreatIntelIndicatorType::HASH_SHA1;
-          }
-          else if (hashCode == HASH_SHA256_HASH)
-          {
-            return ThreatIntelIndicatorType::HASH_SHA256;
-          }
-          else if (hashCode == HASH_SHA512_HASH)
-          {
-            return ThreatIntelIndicatorType::HASH_SHA512;
-          }
-          else if (hashCode == IPV4_ADDRESS_HASH)
-          {
-            return ThreatIntelIndicatorType::IPV4_ADDRESS;
-          }
-          else if (hashCode == IPV6_ADDRESS_HASH)
-          {
-            return ThreatIntelIndicatorType::IPV6_ADDRESS;
-          }
-          else if (hashCode == MUTEX_HASH)
-          {
-            return ThreatIntelIndicatorType::MUTEX;
-          }
-          else if (hashCode == PROCESS_HASH)
-          {
-            return ThreatIntelIndicatorType::PROCESS;
-          }
-          else if (hashCode == URL_HASH)
-          {
-            return ThreatIntelIndicatorType::URL;
+          case 2022099140:
+            if (name == "DOMAIN")
+            {
+              return ThreatIntelIndicatorType::DOMAIN_;
+            }
+            break;
+          case -2012879343:
+            if (name == "EMAIL_ADDRESS")
+            {
+              return ThreatIntelIndicatorType::EMAIL_ADDRESS;
+            }
+            break;
+          case 932109005:
+            if (name == "HASH_MD5")
+            {
+              return ThreatIntelIndicatorType::HASH_MD5;
+            }
+            break;
+          case -1169208906:
+            if (name == "HASH_SHA1")
+            {
+              return ThreatIntelIndicatorType::HASH_SHA1;
+            }
+            break;
+          case 1671675544:
+            if (name == "HASH_SHA256")
+            {
+              return ThreatIntelIndicatorType::HASH_SHA256;
+            }
+            break;
+          case 1671678299:
+            if (name == "HASH_SHA512")
+            {
+              return ThreatIntelIndicatorType::HASH_SHA512;
+            }
+            break;
+          case 1520787354:
+            if (name == "IPV4_ADDRESS")
+            {
+              return ThreatIntelIndicatorType::IPV4_ADDRESS;
+            }
+            break;
+          case -2094121572:
+            if (name == "IPV6_ADDRESS")
+            {
+              return ThreatIntelIndicatorType::IPV6_ADDRESS;
+            }
+            break;
+          case 73726303:
+            if (name == "MUTEX")
+            {
+              return ThreatIntelIndicatorType::MUTEX;
+            }
+            break;
+          case 408463951:
+            if (name == "PROCESS")
+            {
+              return ThreatIntelIndicatorType::PROCESS;
+            }
+            break;
+          case 84303:
+            if (name == "URL")
+            {
+              return ThreatIntelIndicatorType::URL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return ThreatIntelIndicatorType::NOT_SET;
         }
 
-        Aws::String GetNameForThreatIntelIndicatorType(ThreatIntelIndicatorType enumValue)
+        const char* GetNameForThreatIntelIndicatorTypeCStr(ThreatIntelIndicatorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ThreatIntelIndicatorType::DOMAIN_:
-            return "DOMAIN";
-          case ThreatIntelIndicatorType::EMAIL_ADDRESS:
-            return "EMAIL_ADDRESS";
-          case ThreatIntelIndicatorType::HASH_MD5:
-            return "HASH_MD5";
-          case ThreatIntelIndicatorType::HASH_SHA1:
-            return "HASH_SHA1";
-          case ThreatIntelIndicatorType::HASH_SHA256:
-            return "HASH_SHA256";
-          case ThreatIntelIndicatorType::HASH_SHA512:
-            return "HASH_SHA512";
-          case ThreatIntelIndicatorType::IPV4_ADDRESS:
-            return "IPV4_ADDRESS";
-          case ThreatIntelIndicatorType::IPV6_ADDRESS:
-            return "IPV6_ADDRESS";
-          case ThreatIntelIndicatorType::MUTEX:
-            return "MUTEX";
-          case ThreatIntelIndicatorType::PROCESS:
-            return "PROCESS";
-          case ThreatIntelIndicatorType::URL:
-            return "URL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForThreatIntelIndicatorType(ThreatIntelIndicatorType enumValue)
+        {
+          return GetNameForThreatIntelIndicatorTypeCStr(enumValue);
         }
 
       } // namespace ThreatIntelIndicatorTypeMapper
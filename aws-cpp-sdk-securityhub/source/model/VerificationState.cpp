@@ -30,30 +30,51 @@ namespace Aws
       namespace VerificationStateMapper
       {
 
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-        static const int TRUE_POSITIVE_HASH = HashingUtils::HashString("TRUE_POSITIVE");
-        static const int FALSE_POSITIVE_HASH = HashingUtils::HashString("FALSE_POSITIVE");
-        static const int BENIGN_POSITIVE_HASH = HashingUtils::HashString("BENIGN_POSITIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNKNOWN",
+          "TRUE_POSITIVE",
+          "FALSE_POSITIVE",
+          "BENIGN_POSITIVE",
+        };
 
         VerificationState GetVerificationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNKNOWN_HASH)
-          {
-            return VerificationState::UNKNOWN;
-          }
-          else if (hashCode == TRUE_POSITIVE_HASH)
-          {
-            return VerificationState::TRUE_POSITIVE;
-          }
-          else if (hashCode == FALSE_POSITIVE_HASH)
-          {
-            return VerificationState::FALSE_POSITIVE;
-          }
-          else if (hashCode == BENIGN_POSITIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VerificationState::BENIGN_POSITIVE;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return VerificationState::UNKNOWN;
+            }
+            break;
+          case 1648209290:
+            if (name == "TRUE_POSITIVE")
+            {
+              return VerificationState::TRUE_POSITIVE;
+            }
+            break;
+          case 422972853:
+            if (name == "FALSE_POSITIVE")
+            {
+              return VerificationState::FALSE_POSITIVE;
+            }
+            break;
+          case 56141395:
+            if (name == "BENIGN_POSITIVE")
+            {
+              return VerificationState::BENIGN_POSITIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return VerificationState::NOT_SET;
         }
 
-        Aws::String GetNameForVerificationState(VerificationState enumValue)
+        const char* GetNameForVerificationStateCStr(VerificationState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VerificationState::UNKNOWN:
-            return "UNKNOWN";
-          case VerificationState::TRUE_POSITIVE:
-            return "TRUE_POSITIVE";
-          case VerificationState::FALSE_POSITIVE:
-            return "FALSE_POSITIVE";
-          case VerificationState::BENIGN_POSITIVE:
-            return "BENIGN_POSITIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVerificationState(VerificationState enumValue)
+        {
+          return GetNameForVerificationStateCStr(enumValue);
         }
 
       } // namespace VerificationStateMapper
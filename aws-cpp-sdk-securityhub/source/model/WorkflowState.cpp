@@ -30,35 +30,58 @@ namespace Aws
       namespace WorkflowStateMapper
       {
 
-        static const int NEW__HASH = HashingUtils::HashString("NEW");
-        static const int ASSIGNED_HASH = HashingUtils::HashString("ASSIGNED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int DEFERRED_HASH = HashingUtils::HashString("DEFERRED");
-        static const int RESOLVED_HASH = HashingUtils::HashString("RESOLVED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NEW",
+          "ASSIGNED",
+          "IN_PROGRESS",
+          "DEFERRED",
+          "RESOLVED",
+        };
 
         WorkflowState GetWorkflowStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NEW__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WorkflowState::NEW_;
-          }
-          else if (hashCode == ASSIGNED_HASH)
-          {
-            return WorkflowState::ASSIGNED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return WorkflowState::IN_PROGRESS;
-          }
-          else if (hashCode == DEFERRED_HASH)
-          {
-            return WorkflowState::DEFERRED;
-          }
-          else if (hashCode == RESOLVED_HASH)
-          {
-            return WorkflowState::RESOLVED;
+          case 77184:
+            if (name == "NEW")
+            {
+              return WorkflowState::NEW_;
+            }
+            break;
+          case 412745166:
+            if (name == "ASSIGNED")
+            {
+              return WorkflowState::ASSIGNED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return WorkflowState::IN_PROGRESS;
+            }
+            break;
+          case 1430517727:
+            if (name == "DEFERRED")
+            {
+              return WorkflowState::DEFERRED;
+            }
+            break;
+          case 441297912:
+            if (name == "RESOLVED")
+            {
+              return WorkflowState::RESOLVED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return WorkflowState::NOT_SET;
         }
 
-        Aws::String GetNameForWorkflowState(WorkflowState enumValue)
+        const char* GetNameForWorkflowStateCStr(WorkflowState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WorkflowState::NEW_:
-            return "NEW";
-          case WorkflowState::ASSIGNED:
-            return "ASSIGNED";
-          case WorkflowState::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case WorkflowState::DEFERRED:
-            return "DEFERRED";
-          case WorkflowState::RESOLVED:
-            return "RESOLVED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWorkflowState(WorkflowState enumValue)
+        {
+          return GetNameForWorkflowStateCStr(enumValue);
         }
 
       } // namespace WorkflowStateMapper
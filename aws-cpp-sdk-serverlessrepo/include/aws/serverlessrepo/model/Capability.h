@@ -37,6 +37,11 @@ namespace CapabilityMapper
 AWS_SERVERLESSAPPLICATIONREPOSITORY_API Capability GetCapabilityForName(const Aws::String& name);
 
 AWS_SERVERLESSAPPLICATIONREPOSITORY_API Aws::String GetNameForCapability(Capability value);
+
+/**
+ * Same as GetNameForCapability(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVERLESSAPPLICATIONREPOSITORY_API const char* GetNameForCapabilityCStr(Capability value);
 } // namespace CapabilityMapper
 } // namespace Model
 } // namespace ServerlessApplicationRepository
@@ -30,25 +30,44 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int PREPARING_HASH = HashingUtils::HashString("PREPARING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PREPARING",
+          "ACTIVE",
+          "EXPIRED",
+        };
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PREPARING_HASH)
-          {
-            return Status::PREPARING;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Status::ACTIVE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return Status::EXPIRED;
+          case 1775178724:
+            if (name == "PREPARING")
+            {
+              return Status::PREPARING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return Status::ACTIVE;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return Status::EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Status::NOT_SET;
         }
 
-        Aws::String GetNameForStatus(Status enumValue)
+        const char* GetNameForStatusCStr(Status enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Status::PREPARING:
-            return "PREPARING";
-          case Status::ACTIVE:
-            return "ACTIVE";
-          case Status::EXPIRED:
-            return "EXPIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStatus(Status enumValue)
+        {
+          return GetNameForStatusCStr(enumValue);
         }
 
       } // namespace StatusMapper
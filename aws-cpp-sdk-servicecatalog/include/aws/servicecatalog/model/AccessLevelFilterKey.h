@@ -36,6 +36,11 @@ namespace AccessLevelFilterKeyMapper
 AWS_SERVICECATALOG_API AccessLevelFilterKey GetAccessLevelFilterKeyForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForAccessLevelFilterKey(AccessLevelFilterKey value);
+
+/**
+ * Same as GetNameForAccessLevelFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForAccessLevelFilterKeyCStr(AccessLevelFilterKey value);
 } // namespace AccessLevelFilterKeyMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -36,6 +36,11 @@ namespace AccessStatusMapper
 AWS_SERVICECATALOG_API AccessStatus GetAccessStatusForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForAccessStatus(AccessStatus value);
+
+/**
+ * Same as GetNameForAccessStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForAccessStatusCStr(AccessStatus value);
 } // namespace AccessStatusMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -36,6 +36,11 @@ namespace ChangeActionMapper
 AWS_SERVICECATALOG_API ChangeAction GetChangeActionForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForChangeAction(ChangeAction value);
+
+/**
+ * Same as GetNameForChangeAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForChangeActionCStr(ChangeAction value);
 } // namespace ChangeActionMapper
 } // namespace Model
 } // namespace ServiceCatalog
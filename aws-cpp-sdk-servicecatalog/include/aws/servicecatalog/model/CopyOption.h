@@ -34,6 +34,11 @@ namespace CopyOptionMapper
 AWS_SERVICECATALOG_API CopyOption GetCopyOptionForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForCopyOption(CopyOption value);
+
+/**
+ * Same as GetNameForCopyOption(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForCopyOptionCStr(CopyOption value);
 } // namespace CopyOptionMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -36,6 +36,11 @@ namespace CopyProductStatusMapper
 AWS_SERVICECATALOG_API CopyProductStatus GetCopyProductStatusForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForCopyProductStatus(CopyProductStatus value);
+
+/**
+ * Same as GetNameForCopyProductStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForCopyProductStatusCStr(CopyProductStatus value);
 } // namespace CopyProductStatusMapper
 } // namespace Model
 } // namespace ServiceCatalog
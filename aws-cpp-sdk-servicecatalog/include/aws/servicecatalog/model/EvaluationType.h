@@ -35,6 +35,11 @@ namespace EvaluationTypeMapper
 AWS_SERVICECATALOG_API EvaluationType GetEvaluationTypeForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForEvaluationType(EvaluationType value);
+
+/**
+ * Same as GetNameForEvaluationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForEvaluationTypeCStr(EvaluationType value);
 } // namespace EvaluationTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -36,6 +36,11 @@ namespace OrganizationNodeTypeMapper
 AWS_SERVICECATALOG_API OrganizationNodeType GetOrganizationNodeTypeForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForOrganizationNodeType(OrganizationNodeType value);
+
+/**
+ * Same as GetNameForOrganizationNodeType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForOrganizationNodeTypeCStr(OrganizationNodeType value);
 } // namespace OrganizationNodeTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -36,6 +36,11 @@ namespace PortfolioShareTypeMapper
 AWS_SERVICECATALOG_API PortfolioShareType GetPortfolioShareTypeForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForPortfolioShareType(PortfolioShareType value);
+
+/**
+ * Same as GetNameForPortfolioShareType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForPortfolioShareTypeCStr(PortfolioShareType value);
 } // namespace PortfolioShareTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -34,6 +34,11 @@ namespace PrincipalTypeMapper
 AWS_SERVICECATALOG_API PrincipalType GetPrincipalTypeForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForPrincipalType(PrincipalType value);
+
+/**
+ * Same as GetNameForPrincipalType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForPrincipalTypeCStr(PrincipalType value);
 } // namespace PrincipalTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -34,6 +34,11 @@ namespace ProductSourceMapper
 AWS_SERVICECATALOG_API ProductSource GetProductSourceForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForProductSource(ProductSource value);
+
+/**
+ * Same as GetNameForProductSource(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForProductSourceCStr(ProductSource value);
 } // namespace ProductSourceMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -35,6 +35,11 @@ namespace ProductTypeMapper
 AWS_SERVICECATALOG_API ProductType GetProductTypeForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForProductType(ProductType value);
+
+/**
+ * Same as GetNameForProductType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForProductTypeCStr(ProductType value);
 } // namespace ProductTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
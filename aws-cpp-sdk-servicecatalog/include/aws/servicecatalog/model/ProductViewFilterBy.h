@@ -37,6 +37,11 @@ namespace ProductViewFilterByMapper
 AWS_SERVICECATALOG_API ProductViewFilterBy GetProductViewFilterByForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForProductViewFilterBy(ProductViewFilterBy value);
+
+/**
+ * Same as GetNameForProductViewFilterBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForProductViewFilterByCStr(ProductViewFilterBy value);
 } // namespace ProductViewFilterByMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -36,6 +36,11 @@ namespace ProductViewSortByMapper
 AWS_SERVICECATALOG_API ProductViewSortBy GetProductViewSortByForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForProductViewSortBy(ProductViewSortBy value);
+
+/**
+ * Same as GetNameForProductViewSortBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForProductViewSortByCStr(ProductViewSortBy value);
 } // namespace ProductViewSortByMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -39,6 +39,11 @@ namespace ProvisionedProductPlanStatusMapper
 AWS_SERVICECATALOG_API ProvisionedProductPlanStatus GetProvisionedProductPlanStatusForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForProvisionedProductPlanStatus(ProvisionedProductPlanStatus value);
+
+/**
+ * Same as GetNameForProvisionedProductPlanStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForProvisionedProductPlanStatusCStr(ProvisionedProductPlanStatus value);
 } // namespace ProvisionedProductPlanStatusMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -34,6 +34,11 @@ namespace ProvisionedProductPlanTypeMapper
 AWS_SERVICECATALOG_API ProvisionedProductPlanType GetProvisionedProductPlanTypeForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForProvisionedProductPlanType(ProvisionedProductPlanType value);
+
+/**
+ * Same as GetNameForProvisionedProductPlanType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForProvisionedProductPlanTypeCStr(ProvisionedProductPlanType value);
 } // namespace ProvisionedProductPlanTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
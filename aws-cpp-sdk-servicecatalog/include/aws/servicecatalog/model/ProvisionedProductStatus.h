@@ -38,6 +38,11 @@ namespace ProvisionedProductStatusMapper
 AWS_SERVICECATALOG_API ProvisionedProductStatus GetProvisionedProductStatusForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForProvisionedProductStatus(ProvisionedProductStatus value);
+
+/**
+ * Same as GetNameForProvisionedProductStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForProvisionedProductStatusCStr(ProvisionedProductStatus value);
 } // namespace ProvisionedProductStatusMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -34,6 +34,11 @@ namespace ProvisionedProductViewFilterByMapper
 AWS_SERVICECATALOG_API ProvisionedProductViewFilterBy GetProvisionedProductViewFilterByForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForProvisionedProductViewFilterBy(ProvisionedProductViewFilterBy value);
+
+/**
+ * Same as GetNameForProvisionedProductViewFilterBy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForProvisionedProductViewFilterByCStr(ProvisionedProductViewFilterBy value);
 } // namespace ProvisionedProductViewFilterByMapper
 } // namespace Model
 } // namespace ServiceCatalog
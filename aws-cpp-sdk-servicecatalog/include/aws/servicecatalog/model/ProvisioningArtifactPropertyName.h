@@ -34,6 +34,11 @@ namespace ProvisioningArtifactPropertyNameMapper
 AWS_SERVICECATALOG_API ProvisioningArtifactPropertyName GetProvisioningArtifactPropertyNameForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForProvisioningArtifactPropertyName(ProvisioningArtifactPropertyName value);
+
+/**
+ * Same as GetNameForProvisioningArtifactPropertyName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForProvisioningArtifactPropertyNameCStr(ProvisioningArtifactPropertyName value);
 } // namespace ProvisioningArtifactPropertyNameMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -36,6 +36,11 @@ namespace ProvisioningArtifactTypeMapper
 AWS_SERVICECATALOG_API ProvisioningArtifactType GetProvisioningArtifactTypeForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForProvisioningArtifactType(ProvisioningArtifactType value);
+
+/**
+ * Same as GetNameForProvisioningArtifactType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForProvisioningArtifactTypeCStr(ProvisioningArtifactType value);
 } // namespace ProvisioningArtifactTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
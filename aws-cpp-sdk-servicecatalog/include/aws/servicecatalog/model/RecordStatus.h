@@ -38,6 +38,11 @@ namespace RecordStatusMapper
 AWS_SERVICECATALOG_API RecordStatus GetRecordStatusForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForRecordStatus(RecordStatus value);
+
+/**
+ * Same as GetNameForRecordStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForRecordStatusCStr(RecordStatus value);
 } // namespace RecordStatusMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -36,6 +36,11 @@ namespace ReplacementMapper
 AWS_SERVICECATALOG_API Replacement GetReplacementForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForReplacement(Replacement value);
+
+/**
+ * Same as GetNameForReplacement(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForReplacementCStr(Replacement value);
 } // namespace ReplacementMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -39,6 +39,11 @@ namespace ResourceAttributeMapper
 AWS_SERVICECATALOG_API ResourceAttribute GetResourceAttributeForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForResourceAttribute(ResourceAttribute value);
+
+/**
+ * Same as GetNameForResourceAttribute(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForResourceAttributeCStr(ResourceAttribute value);
 } // namespace ResourceAttributeMapper
 } // namespace Model
 } // namespace ServiceCatalog
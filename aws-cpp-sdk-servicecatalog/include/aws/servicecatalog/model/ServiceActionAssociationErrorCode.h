@@ -38,6 +38,11 @@ namespace ServiceActionAssociationErrorCodeMapper
 AWS_SERVICECATALOG_API ServiceActionAssociationErrorCode GetServiceActionAssociationErrorCodeForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForServiceActionAssociationErrorCode(ServiceActionAssociationErrorCode value);
+
+/**
+ * Same as GetNameForServiceActionAssociationErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForServiceActionAssociationErrorCodeCStr(ServiceActionAssociationErrorCode value);
 } // namespace ServiceActionAssociationErrorCodeMapper
 } // namespace Model
 } // namespace ServiceCatalog
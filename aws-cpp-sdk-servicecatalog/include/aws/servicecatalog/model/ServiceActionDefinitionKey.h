@@ -37,6 +37,11 @@ namespace ServiceActionDefinitionKeyMapper
 AWS_SERVICECATALOG_API ServiceActionDefinitionKey GetServiceActionDefinitionKeyForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForServiceActionDefinitionKey(ServiceActionDefinitionKey value);
+
+/**
+ * Same as GetNameForServiceActionDefinitionKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForServiceActionDefinitionKeyCStr(ServiceActionDefinitionKey value);
 } // namespace ServiceActionDefinitionKeyMapper
 } // namespace Model
 } // namespace ServiceCatalog
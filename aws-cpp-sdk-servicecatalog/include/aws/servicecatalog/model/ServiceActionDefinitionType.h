@@ -34,6 +34,11 @@ namespace ServiceActionDefinitionTypeMapper
 AWS_SERVICECATALOG_API ServiceActionDefinitionType GetServiceActionDefinitionTypeForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForServiceActionDefinitionType(ServiceActionDefinitionType value);
+
+/**
+ * Same as GetNameForServiceActionDefinitionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForServiceActionDefinitionTypeCStr(ServiceActionDefinitionType value);
 } // namespace ServiceActionDefinitionTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -38,6 +38,11 @@ namespace ShareStatusMapper
 AWS_SERVICECATALOG_API ShareStatus GetShareStatusForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForShareStatus(ShareStatus value);
+
+/**
+ * Same as GetNameForShareStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForShareStatusCStr(ShareStatus value);
 } // namespace ShareStatusMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -36,6 +36,11 @@ namespace StackSetOperationTypeMapper
 AWS_SERVICECATALOG_API StackSetOperationType GetStackSetOperationTypeForName(const Aws::String& name);
 
 AWS_SERVICECATALOG_API Aws::String GetNameForStackSetOperationType(StackSetOperationType value);
+
+/**
+ * Same as GetNameForStackSetOperationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICECATALOG_API const char* GetNameForStackSetOperationTypeCStr(StackSetOperationType value);
 } // namespace StackSetOperationTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
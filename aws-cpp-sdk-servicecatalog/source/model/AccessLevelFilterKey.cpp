@@ -30,25 +30,44 @@ namespace Aws
       namespace AccessLevelFilterKeyMapper
       {
 
-        static const int Account_HASH = HashingUtils::HashString("Account");
-        static const int Role_HASH = HashingUtils::HashString("Role");
-        static const int User_HASH = HashingUtils::HashString("User");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Account",
+          "Role",
+          "User",
+        };
 
         AccessLevelFilterKey GetAccessLevelFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Account_HASH)
-          {
-            return AccessLevelFilterKey::Account;
-          }
-          else if (hashCode == Role_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccessLevelFilterKey::Role;
-          }
-          else if (hashCode == User_HASH)
-          {
-            return AccessLevelFilterKey::User;
+          case 487334413:
+            if (name == "Account")
+            {
+              return AccessLevelFilterKey::Account;
+            }
+            break;
+          case 2552982:
+            if (name == "Role")
+            {
+              return AccessLevelFilterKey::Role;
+            }
+            break;
+          case 2645995:
+            if (name == "User")
+            {
+              return AccessLevelFilterKey::User;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AccessLevelFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForAccessLevelFilterKey(AccessLevelFilterKey enumValue)
+        const char* GetNameForAccessLevelFilterKeyCStr(AccessLevelFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccessLevelFilterKey::Account:
-            return "Account";
-          case AccessLevelFilterKey::Role:
-            return "Role";
-          case AccessLevelFilterKey::User:
-            return "User";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccessLevelFilterKey(AccessLevelFilterKey enumValue)
+        {
+          return GetNameForAccessLevelFilterKeyCStr(enumValue);
         }
 
       } // namespace AccessLevelFilterKeyMapper
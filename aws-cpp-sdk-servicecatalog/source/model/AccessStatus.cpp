@@ -30,25 +30,44 @@ namespace Aws
       namespace AccessStatusMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int UNDER_CHANGE_HASH = HashingUtils::HashString("UNDER_CHANGE");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLED",
+          "UNDER_CHANGE",
+          "DISABLED",
+        };
 
         AccessStatus GetAccessStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
-          {
-            return AccessStatus::ENABLED;
-          }
-          else if (hashCode == UNDER_CHANGE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AccessStatus::UNDER_CHANGE;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return AccessStatus::DISABLED;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return AccessStatus::ENABLED;
+            }
+            break;
+          case 597211927:
+            if (name == "UNDER_CHANGE")
+            {
+              return AccessStatus::UNDER_CHANGE;
+            }
+            break;
+          case 1053567612:
+            if (name == "DISABLED")
+            {
+              return AccessStatus::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AccessStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAccessStatus(AccessStatus enumValue)
+        const char* GetNameForAccessStatusCStr(AccessStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AccessStatus::ENABLED:
-            return "ENABLED";
-          case AccessStatus::UNDER_CHANGE:
-            return "UNDER_CHANGE";
-          case AccessStatus::DISABLED:
-            return "DISABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAccessStatus(AccessStatus enumValue)
+        {
+          return GetNameForAccessStatusCStr(enumValue);
         }
 
       } // namespace AccessStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ChangeActionMapper
       {
 
-        static const int ADD_HASH = HashingUtils::HashString("ADD");
-        static const int MODIFY_HASH = HashingUtils::HashString("MODIFY");
-        static const int REMOVE_HASH = HashingUtils::HashString("REMOVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ADD",
+          "MODIFY",
+          "REMOVE",
+        };
 
         ChangeAction GetChangeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADD_HASH)
-          {
-            return ChangeAction::ADD;
-          }
-          else if (hashCode == MODIFY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeAction::MODIFY;
-          }
-          else if (hashCode == REMOVE_HASH)
-          {
-            return ChangeAction::REMOVE;
+          case 64641:
+            if (name == "ADD")
+            {
+              return ChangeAction::ADD;
+            }
+            break;
+          case -2015466310:
+            if (name == "MODIFY")
+            {
+              return ChangeAction::MODIFY;
+            }
+            break;
+          case -1881281404:
+            if (name == "REMOVE")
+            {
+              return ChangeAction::REMOVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ChangeAction::NOT_SET;
         }
 
-        Aws::String GetNameForChangeAction(ChangeAction enumValue)
+        const char* GetNameForChangeActionCStr(ChangeAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeAction::ADD:
-            return "ADD";
-          case ChangeAction::MODIFY:
-            return "MODIFY";
-          case ChangeAction::REMOVE:
-            return "REMOVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeAction(ChangeAction enumValue)
+        {
+          return GetNameForChangeActionCStr(enumValue);
         }
 
       } // namespace ChangeActionMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace CopyOptionMapper
       {
 
-        static const int CopyTags_HASH = HashingUtils::HashString("CopyTags");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CopyTags",
+        };
 
         CopyOption GetCopyOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CopyTags_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CopyOption::CopyTags;
+          case -441321138:
+            if (name == "CopyTags")
+            {
+              return CopyOption::CopyTags;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return CopyOption::NOT_SET;
         }
 
-        Aws::String GetNameForCopyOption(CopyOption enumValue)
+        const char* GetNameForCopyOptionCStr(CopyOption enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CopyOption::CopyTags:
-            return "CopyTags";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCopyOption(CopyOption enumValue)
+        {
+          return GetNameForCopyOptionCStr(enumValue);
         }
 
       } // namespace CopyOptionMapper
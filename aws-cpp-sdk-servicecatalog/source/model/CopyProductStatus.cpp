@@ -30,25 +30,44 @@ namespace Aws
       namespace CopyProductStatusMapper
       {
 
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCEEDED",
+          "IN_PROGRESS",
+          "FAILED",
+        };
 
         CopyProductStatus GetCopyProductStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCEEDED_HASH)
-          {
-            return CopyProductStatus::SUCCEEDED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CopyProductStatus::IN_PROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return CopyProductStatus::FAILED;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return CopyProductStatus::SUCCEEDED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return CopyProductStatus::IN_PROGRESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return CopyProductStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return CopyProductStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCopyProductStatus(CopyProductStatus enumValue)
+        const char* GetNameForCopyProductStatusCStr(CopyProductStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CopyProductStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case CopyProductStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case CopyProductStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCopyProductStatus(CopyProductStatus enumValue)
+        {
+          return GetNameForCopyProductStatusCStr(enumValue);
         }
 
       } // namespace CopyProductStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace EvaluationTypeMapper
       {
 
-        static const int STATIC__HASH = HashingUtils::HashString("STATIC");
-        static const int DYNAMIC_HASH = HashingUtils::HashString("DYNAMIC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STATIC",
+          "DYNAMIC",
+        };
 
         EvaluationType GetEvaluationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STATIC__HASH)
-          {
-            return EvaluationType::STATIC_;
-          }
-          else if (hashCode == DYNAMIC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EvaluationType::DYNAMIC;
+          case -1839152530:
+            if (name == "STATIC")
+            {
+              return EvaluationType::STATIC_;
+            }
+            break;
+          case -1452217313:
+            if (name == "DYNAMIC")
+            {
+              return EvaluationType::DYNAMIC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EvaluationType::NOT_SET;
         }
 
-        Aws::String GetNameForEvaluationType(EvaluationType enumValue)
+        const char* GetNameForEvaluationTypeCStr(EvaluationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EvaluationType::STATIC_:
-            return "STATIC";
-          case EvaluationType::DYNAMIC:
-            return "DYNAMIC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEvaluationType(EvaluationType enumValue)
+        {
+          return GetNameForEvaluationTypeCStr(enumValue);
         }
 
       } // namespace EvaluationTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace OrganizationNodeTypeMapper
       {
 
-        static const int ORGANIZATION_HASH = HashingUtils::HashString("ORGANIZATION");
-        static const int ORGANIZATIONAL_UNIT_HASH = HashingUtils::HashString("ORGANIZATIONAL_UNIT");
-        static const int ACCOUNT_HASH = HashingUtils::HashString("ACCOUNT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ORGANIZATION",
+          "ORGANIZATIONAL_UNIT",
+          "ACCOUNT",
+        };
 
         OrganizationNodeType GetOrganizationNodeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ORGANIZATION_HASH)
-          {
-            return OrganizationNodeType::ORGANIZATION;
-          }
-          else if (hashCode == ORGANIZATIONAL_UNIT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OrganizationNodeType::ORGANIZATIONAL_UNIT;
-          }
-          else if (hashCode == ACCOUNT_HASH)
-          {
-            return OrganizationNodeType::ACCOUNT;
+          case -798763725:
+            if (name == "ORGANIZATION")
+            {
+              return OrganizationNodeType::ORGANIZATION;
+            }
+            break;
+          case -1946787707:
+            if (name == "ORGANIZATIONAL_UNIT")
+            {
+              return OrganizationNodeType::ORGANIZATIONAL_UNIT;
+            }
+            break;
+          case -459336179:
+            if (name == "ACCOUNT")
+            {
+              return OrganizationNodeType::ACCOUNT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return OrganizationNodeType::NOT_SET;
         }
 
-        Aws::String GetNameForOrganizationNodeType(OrganizationNodeType enumValue)
+        const char* GetNameForOrganizationNodeTypeCStr(OrganizationNodeType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OrganizationNodeType::ORGANIZATION:
-            return "ORGANIZATION";
-          case OrganizationNodeType::ORGANIZATIONAL_UNIT:
-            return "ORGANIZATIONAL_UNIT";
-          case OrganizationNodeType::ACCOUNT:
-            return "ACCOUNT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOrganizationNodeType(OrganizationNodeType enumValue)
+        {
+          return GetNameForOrganizationNodeTypeCStr(enumValue);
         }
 
       } // namespace OrganizationNodeTypeMapper
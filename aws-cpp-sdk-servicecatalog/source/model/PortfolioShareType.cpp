@@ -30,25 +30,44 @@ namespace Aws
       namespace PortfolioShareTypeMapper
       {
 
-        static const int IMPORTED_HASH = HashingUtils::HashString("IMPORTED");
-        static const int AWS_SERVICECATALOG_HASH = HashingUtils::HashString("AWS_SERVICECATALOG");
-        static const int AWS_ORGANIZATIONS_HASH = HashingUtils::HashString("AWS_ORGANIZATIONS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IMPORTED",
+          "AWS_SERVICECATALOG",
+          "AWS_ORGANIZATIONS",
+        };
 
         PortfolioShareType GetPortfolioShareTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IMPORTED_HASH)
-          {
-            return PortfolioShareType::IMPORTED;
-          }
-          else if (hashCode == AWS_SERVICECATALOG_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PortfolioShareType::AWS_SERVICECATALOG;
-          }
-          else if (hashCode == AWS_ORGANIZATIONS_HASH)
-          {
-            return PortfolioShareType::AWS_ORGANIZATIONS;
+          case 360258308:
+            if (name == "IMPORTED")
+            {
+              return PortfolioShareType::IMPORTED;
+            }
+            break;
+          case -1880706714:
+            if (name == "AWS_SERVICECATALOG")
+            {
+              return PortfolioShareType::AWS_SERVICECATALOG;
+            }
+            break;
+          case 1396431774:
+            if (name == "AWS_ORGANIZATIONS")
+            {
+              return PortfolioShareType::AWS_ORGANIZATIONS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PortfolioShareType::NOT_SET;
         }
 
-        Aws::String GetNameForPortfolioShareType(PortfolioShareType enumValue)
+        const char* GetNameForPortfolioShareTypeCStr(PortfolioShareType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PortfolioShareType::IMPORTED:
-            return "IMPORTED";
-          case PortfolioShareType::AWS_SERVICECATALOG:
-            return "AWS_SERVICECATALOG";
-          case PortfolioShareType::AWS_ORGANIZATIONS:
-            return "AWS_ORGANIZATIONS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPortfolioShareType(PortfolioShareType enumValue)
+        {
+          return GetNameForPortfolioShareTypeCStr(enumValue);
         }
 
       } // namespace PortfolioShareTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace PrincipalTypeMapper
       {
 
-        static const int IAM_HASH = HashingUtils::HashString("IAM");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IAM",
+        };
 
         PrincipalType GetPrincipalTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IAM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PrincipalType::IAM;
+          case 72245:
+            if (name == "IAM")
+            {
+              return PrincipalType::IAM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return PrincipalType::NOT_SET;
         }
 
-        Aws::String GetNameForPrincipalType(PrincipalType enumValue)
+        const char* GetNameForPrincipalTypeCStr(PrincipalType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PrincipalType::IAM:
-            return "IAM";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPrincipalType(PrincipalType enumValue)
+        {
+          return GetNameForPrincipalTypeCStr(enumValue);
         }
 
       } // namespace PrincipalTypeMapper
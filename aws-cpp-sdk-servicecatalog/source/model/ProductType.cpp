@@ -30,20 +30,37 @@ namespace Aws
       namespace ProductTypeMapper
       {
 
-        static const int CLOUD_FORMATION_TEMPLATE_HASH = HashingUtils::HashString("CLOUD_FORMATION_TEMPLATE");
-        static const int MARKETPLACE_HASH = HashingUtils::HashString("MARKETPLACE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CLOUD_FORMATION_TEMPLATE",
+          "MARKETPLACE",
+        };
 
         ProductType GetProductTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLOUD_FORMATION_TEMPLATE_HASH)
-          {
-            return ProductType::CLOUD_FORMATION_TEMPLATE;
-          }
-          else if (hashCode == MARKETPLACE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProductType::MARKETPLACE;
+          case -2036425006:
+            if (name == "CLOUD_FORMATION_TEMPLATE")
+            {
+              return ProductType::CLOUD_FORMATION_TEMPLATE;
+            }
+            break;
+          case -1841095125:
+            if (name == "MARKETPLACE")
+            {
+              return ProductType::MARKETPLACE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ProductType::NOT_SET;
         }
 
-        Aws::String GetNameForProductType(ProductType enumValue)
+        const char* GetNameForProductTypeCStr(ProductType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProductType::CLOUD_FORMATION_TEMPLATE:
-            return "CLOUD_FORMATION_TEMPLATE";
-          case ProductType::MARKETPLACE:
-            return "MARKETPLACE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProductType(ProductType enumValue)
+        {
+          return GetNameForProductTypeCStr(enumValue);
         }
 
       } // namespace ProductTypeMapper
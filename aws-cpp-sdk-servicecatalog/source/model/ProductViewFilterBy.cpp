@@ -30,30 +30,51 @@ namespace Aws
       namespace ProductViewFilterByMapper
       {
 
-        static const int FullTextSearch_HASH = HashingUtils::HashString("FullTextSearch");
-        static const int Owner_HASH = HashingUtils::HashString("Owner");
-        static const int ProductType_HASH = HashingUtils::HashString("ProductType");
-        static const int SourceProductId_HASH = HashingUtils::HashString("SourceProductId");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FullTextSearch",
+          "Owner",
+          "ProductType",
+          "SourceProductId",
+        };
 
         ProductViewFilterBy GetProductViewFilterByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FullTextSearch_HASH)
-          {
-            return ProductViewFilterBy::FullTextSearch;
-          }
-          else if (hashCode == Owner_HASH)
-          {
-            return ProductViewFilterBy::Owner;
-          }
-          else if (hashCode == ProductType_HASH)
-          {
-            return ProductViewFilterBy::ProductType;
-          }
-          else if (hashCode == SourceProductId_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProductViewFilterBy::SourceProductId;
+          case -1202952892:
+            if (name == "FullTextSearch")
+            {
+              return ProductViewFilterBy::FullTextSearch;
+            }
+            break;
+          case 76612243:
+            if (name == "Owner")
+            {
+              return ProductViewFilterBy::Owner;
+            }
+            break;
+          case 176253097:
+            if (name == "ProductType")
+            {
+              return ProductViewFilterBy::ProductType;
+            }
+            break;
+          case -1367952273:
+            if (name == "SourceProductId")
+            {
+              return ProductViewFilterBy::SourceProductId;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ProductViewFilterBy::NOT_SET;
         }
 
-        Aws::String GetNameForProductViewFilterBy(ProductViewFilterBy enumValue)
+        const char* GetNameForProductViewFilterByCStr(ProductViewFilterBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProductViewFilterBy::FullTextSearch:
-            return "FullTextSearch";
-          case ProductViewFilterBy::Owner:
-            return "Owner";
-          case ProductViewFilterBy::ProductType:
-            return "ProductType";
-          case ProductViewFilterBy::SourceProductId:
-            return "SourceProductId";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProductViewFilterBy(ProductViewFilterBy enumValue)
+        {
+          return GetNameForProductViewFilterByCStr(enumValue);
         }
 
       } // namespace ProductViewFilterByMapper
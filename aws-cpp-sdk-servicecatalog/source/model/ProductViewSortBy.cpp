@@ -30,25 +30,44 @@ namespace Aws
       namespace ProductViewSortByMapper
       {
 
-        static const int Title_HASH = HashingUtils::HashString("Title");
-        static const int VersionCount_HASH = HashingUtils::HashString("VersionCount");
-        static const int CreationDate_HASH = HashingUtils::HashString("CreationDate");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Title",
+          "VersionCount",
+          "CreationDate",
+        };
 
         ProductViewSortBy GetProductViewSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Title_HASH)
-          {
-            return ProductViewSortBy::Title;
-          }
-          else if (hashCode == VersionCount_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProductViewSortBy::VersionCount;
-          }
-          else if (hashCode == CreationDate_HASH)
-          {
-            return ProductViewSortBy::CreationDate;
+          case 80818744:
+            if (name == "Title")
+            {
+              return ProductViewSortBy::Title;
+            }
+            break;
+          case 35839799:
+            if (name == "VersionCount")
+            {
+              return ProductViewSortBy::VersionCount;
+            }
+            break;
+          case 1749851981:
+            if (name == "CreationDate")
+            {
+              return ProductViewSortBy::CreationDate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ProductViewSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForProductViewSortBy(ProductViewSortBy enumValue)
+        const char* GetNameForProductViewSortByCStr(ProductViewSortBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProductViewSortBy::Title:
-            return "Title";
-          case ProductViewSortBy::VersionCount:
-            return "VersionCount";
-          case ProductViewSortBy::CreationDate:
-            return "CreationDate";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProductViewSortBy(ProductViewSortBy enumValue)
+        {
+          return GetNameForProductViewSortByCStr(enumValue);
         }
 
       } // namespace ProductViewSortByMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace ProvisionedProductPlanStatusMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_SUCCESS_HASH = HashingUtils::HashString("CREATE_SUCCESS");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
-        static const int EXECUTE_IN_PROGRESS_HASH = HashingUtils::HashString("EXECUTE_IN_PROGRESS");
-        static const int EXECUTE_SUCCESS_HASH = HashingUtils::HashString("EXECUTE_SUCCESS");
-        static const int EXECUTE_FAILED_HASH = HashingUtils::HashString("EXECUTE_FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE_IN_PROGRESS",
+          "CREATE_SUCCESS",
+          "CREATE_FAILED",
+          "EXECUTE_IN_PROGRESS",
+          "EXECUTE_SUCCESS",
+          "EXECUTE_FAILED",
+        };
 
         ProvisionedProductPlanStatus GetProvisionedProductPlanStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
-          {
-            return ProvisionedProductPlanStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_SUCCESS_HASH)
-          {
-            return ProvisionedProductPlanStatus::CREATE_SUCCESS;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
-          {
-            return ProvisionedProductPlanStatus::CREATE_FAILED;
-          }
-          else if (hashCode == EXECUTE_IN_PROGRESS_HASH)
-          {
-            return ProvisionedProductPlanStatus::EXECUTE_IN_PROGRESS;
-          }
-          else if (hashCode == EXECUTE_SUCCESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProvisionedProductPlanStatus::EXECUTE_SUCCESS;
-          }
-          else if (hashCode == EXECUTE_FAILED_HASH)
-          {
-            return ProvisionedProductPlanStatus::EXECUTE_FAILED;
+          case 43560260:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return ProvisionedProductPlanStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case -896382048:
+            if (name == "CREATE_SUCCESS")
+            {
+              return ProvisionedProductPlanStatus::CREATE_SUCCESS;
+            }
+            break;
+          case -835019552:
+            if (name == "CREATE_FAILED")
+            {
+              return ProvisionedProductPlanStatus::CREATE_FAILED;
+            }
+            break;
+          case -1159930339:
+            if (name == "EXECUTE_IN_PROGRESS")
+            {
+              return ProvisionedProductPlanStatus::EXECUTE_IN_PROGRESS;
+            }
+            break;
+          case -4534023:
+            if (name == "EXECUTE_SUCCESS")
+            {
+              return ProvisionedProductPlanStatus::EXECUTE_SUCCESS;
+            }
+            break;
+          case -944797593:
+            if (name == "EXECUTE_FAILED")
+            {
+              return ProvisionedProductPlanStatus::EXECUTE_FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ProvisionedProductPlanStatus::NOT_SET;
         }
 
-        Aws::String GetNameForProvisionedProductPlanStatus(ProvisionedProductPlanStatus enumValue)
+        const char* GetNameForProvisionedProductPlanStatusCStr(ProvisionedProductPlanStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProvisionedProductPlanStatus::CREATE_IN_PROGRESS:
-            return "CREATE_IN_PROGRESS";
-          case ProvisionedProductPlanStatus::CREATE_SUCCESS:
-            return "CREATE_SUCCESS";
-          case ProvisionedProductPlanStatus::CREATE_FAILED:
-            return "CREATE_FAILED";
-          case ProvisionedProductPlanStatus::EXECUTE_IN_PROGRESS:
-            return "EXECUTE_IN_PROGRESS";
-          case ProvisionedProductPlanStatus::EXECUTE_SUCCESS:
-            return "EXECUTE_SUCCESS";
-          case ProvisionedProductPlanStatus::EXECUTE_FAILED:
-            return "EXECUTE_FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProvisionedProductPlanStatus(ProvisionedProductPlanStatus enumValue)
+        {
+          return GetNameForProvisionedProductPlanStatusCStr(enumValue);
         }
 
       } // namespace ProvisionedProductPlanStatusMapper
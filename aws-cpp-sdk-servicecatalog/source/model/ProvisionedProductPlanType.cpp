@@ -30,15 +30,30 @@ namespace Aws
       namespace ProvisionedProductPlanTypeMapper
       {
 
-        static const int CLOUDFORMATION_HASH = HashingUtils::HashString("CLOUDFORMATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CLOUDFORMATION",
+        };
 
         ProvisionedProductPlanType GetProvisionedProductPlanTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLOUDFORMATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProvisionedProductPlanType::CLOUDFORMATION;
+          case -1320699364:
+            if (name == "CLOUDFORMATION")
+            {
+              return ProvisionedProductPlanType::CLOUDFORMATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ProvisionedProductPlanType::NOT_SET;
         }
 
-        Aws::String GetNameForProvisionedProductPlanType(ProvisionedProductPlanType enumValue)
+        const char* GetNameForProvisionedProductPlanTypeCStr(ProvisionedProductPlanType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProvisionedProductPlanType::CLOUDFORMATION:
-            return "CLOUDFORMATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProvisionedProductPlanType(ProvisionedProductPlanType enumValue)
+        {
+          return GetNameForProvisionedProductPlanTypeCStr(enumValue);
         }
 
       } // namespace ProvisionedProductPlanTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ProvisionedProductStatusMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int UNDER_CHANGE_HASH = HashingUtils::HashString("UNDER_CHANGE");
-        static const int TAINTED_HASH = HashingUtils::HashString("TAINTED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int PLAN_IN_PROGRESS_HASH = HashingUtils::HashString("PLAN_IN_PROGRESS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AVAILABLE",
+          "UNDER_CHANGE",
+          "TAINTED",
+          "ERROR",
+          "PLAN_IN_PROGRESS",
+        };
 
         ProvisionedProductStatus GetProvisionedProductStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProvisionedProductStatus::AVAILABLE;
-          }
-          else if (hashCode == UNDER_CHANGE_HASH)
-          {
-            return ProvisionedProductStatus::UNDER_CHANGE;
-          }
-          else if (hashCode == TAINTED_HASH)
-          {
-            return ProvisionedProductStatus::TAINTED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return ProvisionedProductStatus::ERROR_;
-          }
-          else if (hashCode == PLAN_IN_PROGRESS_HASH)
-          {
-            return ProvisionedProductStatus::PLAN_IN_PROGRESS;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return ProvisionedProductStatus::AVAILABLE;
+            }
+            break;
+          case 597211927:
+            if (name == "UNDER_CHANGE")
+            {
+              return ProvisionedProductStatus::UNDER_CHANGE;
+            }
+            break;
+          case -828383647:
+            if (name == "TAINTED")
+            {
+              return ProvisionedProductStatus::TAINTED;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return ProvisionedProductStatus::ERROR_;
+            }
+            break;
+          case -422002703:
+            if (name == "PLAN_IN_PROGRESS")
+            {
+              return ProvisionedProductStatus::PLAN_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ProvisionedProductStatus::NOT_SET;
         }
 
-        Aws::String GetNameForProvisionedProductStatus(ProvisionedProductStatus enumValue)
+        const char* GetNameForProvisionedProductStatusCStr(ProvisionedProductStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProvisionedProductStatus::AVAILABLE:
-            return "AVAILABLE";
-          case ProvisionedProductStatus::UNDER_CHANGE:
-            return "UNDER_CHANGE";
-          case ProvisionedProductStatus::TAINTED:
-            return "TAINTED";
-          case ProvisionedProductStatus::ERROR_:
-            return "ERROR";
-          case ProvisionedProductStatus::PLAN_IN_PROGRESS:
-            return "PLAN_IN_PROGRESS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProvisionedProductStatus(ProvisionedProductStatus enumValue)
+        {
+          return GetNameForProvisionedProductStatusCStr(enumValue);
         }
 
       } // namespace ProvisionedProductStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ProvisionedProductViewFilterByMapper
       {
 
-        static const int SearchQuery_HASH = HashingUtils::HashString("SearchQuery");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SearchQuery",
+        };
 
         ProvisionedProductViewFilterBy GetProvisionedProductViewFilterByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SearchQuery_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProvisionedProductViewFilterBy::SearchQuery;
+          case 1115730912:
+            if (name == "SearchQuery")
+            {
+              return ProvisionedProductViewFilterBy::SearchQuery;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ProvisionedProductViewFilterBy::NOT_SET;
         }
 
-        Aws::String GetNameForProvisionedProductViewFilterBy(ProvisionedProductViewFilterBy enumValue)
+        const char* GetNameForProvisionedProductViewFilterByCStr(ProvisionedProductViewFilterBy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProvisionedProductViewFilterBy::SearchQuery:
-            return "SearchQuery";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProvisionedProductViewFilterBy(ProvisionedProductViewFilterBy enumValue)
+        {
+          return GetNameForProvisionedProductViewFilterByCStr(enumValue);
         }
 
       } // namespace ProvisionedProductViewFilterByMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ProvisioningArtifactPropertyNameMapper
       {
 
-        static const int Id_HASH = HashingUtils::HashString("Id");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Id",
+        };
 
         ProvisioningArtifactPropertyName GetProvisioningArtifactPropertyNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Id_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProvisioningArtifactPropertyName::Id;
+          case 2363:
+            if (name == "Id")
+            {
+              return ProvisioningArtifactPropertyName::Id;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ProvisioningArtifactPropertyName::NOT_SET;
         }
 
-        Aws::String GetNameForProvisioningArtifactPropertyName(ProvisioningArtifactPropertyName enumValue)
+        const char* GetNameForProvisioningArtifactPropertyNameCStr(ProvisioningArtifactPropertyName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProvisioningArtifactPropertyName::Id:
-            return "Id";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProvisioningArtifactPropertyName(ProvisioningArtifactPropertyName enumValue)
+        {
+          return GetNameForProvisioningArtifactPropertyNameCStr(enumValue);
         }
 
       } // namespace ProvisioningArtifactPropertyNameMapper
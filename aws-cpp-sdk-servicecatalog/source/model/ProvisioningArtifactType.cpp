@@ -30,25 +30,44 @@ namespace Aws
       namespace ProvisioningArtifactTypeMapper
       {
 
-        static const int CLOUD_FORMATION_TEMPLATE_HASH = HashingUtils::HashString("CLOUD_FORMATION_TEMPLATE");
-        static const int MARKETPLACE_AMI_HASH = HashingUtils::HashString("MARKETPLACE_AMI");
-        static const int MARKETPLACE_CAR_HASH = HashingUtils::HashString("MARKETPLACE_CAR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CLOUD_FORMATION_TEMPLATE",
+          "MARKETPLACE_AMI",
+          "MARKETPLACE_CAR",
+        };
 
         ProvisioningArtifactType GetProvisioningArtifactTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLOUD_FORMATION_TEMPLATE_HASH)
-          {
-            return ProvisioningArtifactType::CLOUD_FORMATION_TEMPLATE;
-          }
-          else if (hashCode == MARKETPLACE_AMI_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ProvisioningArtifactType::MARKETPLACE_AMI;
-          }
-          else if (hashCode == MARKETPLACE_CAR_HASH)
-          {
-            return ProvisioningArtifactType::MARKETPLACE_CAR;
+          case -2036425006:
+            if (name == "CLOUD_FORMATION_TEMPLATE")
+            {
+              return ProvisioningArtifactType::CLOUD_FORMATION_TEMPLATE;
+            }
+            break;
+          case 1645100425:
+            if (name == "MARKETPLACE_AMI")
+            {
+              return ProvisioningArtifactType::MARKETPLACE_AMI;
+            }
+            break;
+          case 1645101984:
+            if (name == "MARKETPLACE_CAR")
+            {
+              return ProvisioningArtifactType::MARKETPLACE_CAR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ProvisioningArtifactType::NOT_SET;
         }
 
-        Aws::String GetNameForProvisioningArtifactType(ProvisioningArtifactType enumValue)
+        const char* GetNameForProvisioningArtifactTypeCStr(ProvisioningArtifactType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ProvisioningArtifactType::CLOUD_FORMATION_TEMPLATE:
-            return "CLOUD_FORMATION_TEMPLATE";
-          case ProvisioningArtifactType::MARKETPLACE_AMI:
-            return "MARKETPLACE_AMI";
-          case ProvisioningArtifactType::MARKETPLACE_CAR:
-            return "MARKETPLACE_CAR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForProvisioningArtifactType(ProvisioningArtifactType enumValue)
+        {
+          return GetNameForProvisioningArtifactTypeCStr(enumValue);
         }
 
       } // namespace ProvisioningArtifactTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace RecordStatusMapper
       {
 
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int IN_PROGRESS_IN_ERROR_HASH = HashingUtils::HashString("IN_PROGRESS_IN_ERROR");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATED",
+          "IN_PROGRESS",
+          "IN_PROGRESS_IN_ERROR",
+          "SUCCEEDED",
+          "FAILED",
+        };
 
         RecordStatus GetRecordStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RecordStatus::CREATED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return RecordStatus::IN_PROGRESS;
-          }
-          else if (hashCode == IN_PROGRESS_IN_ERROR_HASH)
-          {
-            return RecordStatus::IN_PROGRESS_IN_ERROR;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return RecordStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return RecordStatus::FAILED;
+          case 1746537160:
+            if (name == "CREATED")
+            {
+              return RecordStatus::CREATED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return RecordStatus::IN_PROGRESS;
+            }
+            break;
+          case -640054394:
+            if (name == "IN_PROGRESS_IN_ERROR")
+            {
+              return RecordStatus::IN_PROGRESS_IN_ERROR;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return RecordStatus::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return RecordStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return RecordStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRecordStatus(RecordStatus enumValue)
+        const char* GetNameForRecordStatusCStr(RecordStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RecordStatus::CREATED:
-            return "CREATED";
-          case RecordStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case RecordStatus::IN_PROGRESS_IN_ERROR:
-            return "IN_PROGRESS_IN_ERROR";
-          case RecordStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case RecordStatus::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRecordStatus(RecordStatus enumValue)
+        {
+          return GetNameForRecordStatusCStr(enumValue);
         }
 
       } // namespace RecordStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace RequiresRecreationMapper
       {
 
-        static const int NEVER_HASH = HashingUtils::HashString("NEVER");
-        static const int CONDITIONALLY_HASH = HashingUtils::HashString("CONDITIONALLY");
-        static const int ALWAYS_HASH = HashingUtils::HashString("ALWAYS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NEVER",
+          "CONDITIONALLY",
+          "ALWAYS",
+        };
 
         RequiresRecreation GetRequiresRecreationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NEVER_HASH)
-          {
-            return RequiresRecreation::NEVER;
-          }
-          else if (hashCode == CONDITIONALLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RequiresRecreation::CONDITIONALLY;
-          }
-          else if (hashCode == ALWAYS_HASH)
-          {
-            return RequiresRecreation::ALWAYS;
+          case 74175084:
+            if (name == "NEVER")
+            {
+              return RequiresRecreation::NEVER;
+            }
+            break;
+          case 194198131:
+            if (name == "CONDITIONALLY")
+            {
+              return RequiresRecreation::CONDITIONALLY;
+            }
+            break;
+          case 1933739535:
+            if (name == "ALWAYS")
+            {
+              return RequiresRecreation::ALWAYS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return RequiresRecreation::NOT_SET;
         }
 
-        Aws::String GetNameForRequiresRecreation(RequiresRecreation enumValue)
+        const char* GetNameForRequiresRecreationCStr(RequiresRecreation enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RequiresRecreation::NEVER:
-            return "NEVER";
-          case RequiresRecreation::CONDITIONALLY:
-            return "CONDITIONALLY";
-          case RequiresRecreation::ALWAYS:
-            return "ALWAYS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRequiresRecreation(RequiresRecreation enumValue)
+        {
+          return GetNameForRequiresRecreationCStr(enumValue);
         }
 
       } // namespace RequiresRecreationMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace ResourceAttributeMapper
       {
 
-        static const int PROPERTIES_HASH = HashingUtils::HashString("PROPERTIES");
-        static const int METADATA_HASH = HashingUtils::HashString("METADATA");
-        static const int CREATIONPOLICY_HASH = HashingUtils::HashString("CREATIONPOLICY");
-        static const int UPDATEPOLICY_HASH = HashingUtils::HashString("UPDATEPOLICY");
-        static const int DELETIONPOLICY_HASH = HashingUtils::HashString("DELETIONPOLICY");
-        static const int TAGS_HASH = HashingUtils::HashString("TAGS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PROPERTIES",
+          "METADATA",
+          "CREATIONPOLICY",
+          "UPDATEPOLICY",
+          "DELETIONPOLICY",
+          "TAGS",
+        };
 
         ResourceAttribute GetResourceAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROPERTIES_HASH)
-          {
-            return ResourceAttribute::PROPERTIES;
-          }
-          else if (hashCode == METADATA_HASH)
-          {
-            return ResourceAttribute::METADATA;
-          }
-          else if (hashCode == CREATIONPOLICY_HASH)
-          {
-            return ResourceAttribute::CREATIONPOLICY;
-          }
-          else if (hashCode == UPDATEPOLICY_HASH)
-          {
-            return ResourceAttribute::UPDATEPOLICY;
-          }
-          else if (hashCode == DELETIONPOLICY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceAttribute::DELETIONPOLICY;
-          }
-          else if (hashCode == TAGS_HASH)
-          {
-            return ResourceAttribute::TAGS;
+          case -440960717:
+            if (name == "PROPERTIES")
+            {
+              return ResourceAttribute::PROPERTIES;
+            }
+            break;
+          case 332622639:
+            if (name == "METADATA")
+            {
+              return ResourceAttribute::METADATA;
+            }
+            break;
+          case -1925770031:
+            if (name == "CREATIONPOLICY")
+            {
+              return ResourceAttribute::CREATIONPOLICY;
+            }
+            break;
+          case -2092479685:
+            if (name == "UPDATEPOLICY")
+            {
+              return ResourceAttribute::UPDATEPOLICY;
+            }
+            break;
+          case -606348672:
+            if (name == "DELETIONPOLICY")
+            {
+              return ResourceAttribute::DELETIONPOLICY;
+            }
+            break;
+          case 2567193:
+            if (name == "TAGS")
+            {
+              return ResourceAttribute::TAGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ResourceAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForResourceAttribute(ResourceAttribute enumValue)
+        const char* GetNameForResourceAttributeCStr(ResourceAttribute enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceAttribute::PROPERTIES:
-            return "PROPERTIES";
-          case ResourceAttribute::METADATA:
-            return "METADATA";
-          case ResourceAttribute::CREATIONPOLICY:
-            return "CREATIONPOLICY";
-          case ResourceAttribute::UPDATEPOLICY:
-            return "UPDATEPOLICY";
-          case ResourceAttribute::DELETIONPOLICY:
-            return "DELETIONPOLICY";
-          case ResourceAttribute::TAGS:
-            return "TAGS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceAttribute(ResourceAttribute enumValue)
+        {
+          return GetNameForResourceAttributeCStr(enumValue);
         }
 
       } // namespace ResourceAttributeMapper
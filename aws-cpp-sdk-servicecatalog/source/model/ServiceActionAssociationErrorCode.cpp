@@ -30,35 +30,58 @@ namespace Aws
       namespace ServiceActionAssociationErrorCodeMapper
       {
 
-        static const int DUPLICATE_RESOURCE_HASH = HashingUtils::HashString("DUPLICATE_RESOURCE");
-        static const int INTERNAL_FAILURE_HASH = HashingUtils::HashString("INTERNAL_FAILURE");
-        static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LIMIT_EXCEEDED");
-        static const int RESOURCE_NOT_FOUND_HASH = HashingUtils::HashString("RESOURCE_NOT_FOUND");
-        static const int THROTTLING_HASH = HashingUtils::HashString("THROTTLING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DUPLICATE_RESOURCE",
+          "INTERNAL_FAILURE",
+          "LIMIT_EXCEEDED",
+          "RESOURCE_NOT_FOUND",
+          "THROTTLING",
+        };
 
         ServiceActionAssociationErrorCode GetServiceActionAssociationErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DUPLICATE_RESOURCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServiceActionAssociationErrorCode::DUPLICATE_RESOURCE;
-          }
-          else if (hashCode == INTERNAL_FAILURE_HASH)
-          {
-            return ServiceActionAssociationErrorCode::INTERNAL_FAILURE;
-          }
-          else if (hashCode == LIMIT_EXCEEDED_HASH)
-          {
-            return ServiceActionAssociationErrorCode::LIMIT_EXCEEDED;
-          }
-          else if (hashCode == RESOURCE_NOT_FOUND_HASH)
-          {
-            return ServiceActionAssociationErrorCode::RESOURCE_NOT_FOUND;
-          }
-          else if (hashCode == THROTTLING_HASH)
-          {
-            return ServiceActionAssociationErrorCode::THROTTLING;
+          case -988749598:
+            if (name == "DUPLICATE_RESOURCE")
+            {
+              return ServiceActionAssociationErrorCode::DUPLICATE_RESOURCE;
+            }
+            break;
+          case 1873612264:
+            if (name == "INTERNAL_FAILURE")
+            {
+              return ServiceActionAssociationErrorCode::INTERNAL_FAILURE;
+            }
+            break;
+          case -1452302473:
+            if (name == "LIMIT_EXCEEDED")
+            {
+              return ServiceActionAssociationErrorCode::LIMIT_EXCEEDED;
+            }
+            break;
+          case -8285211:
+            if (name == "RESOURCE_NOT_FOUND")
+            {
+              return ServiceActionAssociationErrorCode::RESOURCE_NOT_FOUND;
+            }
+            break;
+          case 144666983:
+            if (name == "THROTTLING")
+            {
+              return ServiceActionAssociationErrorCode::THROTTLING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ServiceActionAssociationErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForServiceActionAssociationErrorCode(ServiceActionAssociationErrorCode enumValue)
+        const char* GetNameForServiceActionAssociationErrorCodeCStr(ServiceActionAssociationErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServiceActionAssociationErrorCode::DUPLICATE_RESOURCE:
-            return "DUPLICATE_RESOURCE";
-          case ServiceActionAssociationErrorCode::INTERNAL_FAILURE:
-            return "INTERNAL_FAILURE";
-          case ServiceActionAssociationErrorCode::LIMIT_EXCEEDED:
-            return "LIMIT_EXCEEDED";
-          case ServiceActionAssociationErrorCode::RESOURCE_NOT_FOUND:
-            return "RESOURCE_NOT_FOUND";
-          case ServiceActionAssociationErrorCode::THROTTLING:
-            return "THROTTLING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServiceActionAssociationErrorCode(ServiceActionAssociationErrorCode enumValue)
+        {
+          return GetNameForServiceActionAssociationErrorCodeCStr(enumValue);
         }
 
       } // namespace ServiceActionAssociationErrorCodeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ServiceActionDefinitionKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int Version_HASH = HashingUtils::HashString("Version");
-        static const int AssumeRole_HASH = HashingUtils::HashString("AssumeRole");
-        static const int Parameters_HASH = HashingUtils::HashString("Parameters");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "Version",
+          "AssumeRole",
+          "Parameters",
+        };
 
         ServiceActionDefinitionKey GetServiceActionDefinitionKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return ServiceActionDefinitionKey::Name;
-          }
-          else if (hashCode == Version_HASH)
-          {
-            return ServiceActionDefinitionKey::Version;
-          }
-          else if (hashCode == AssumeRole_HASH)
-          {
-            return ServiceActionDefinitionKey::AssumeRole;
-          }
-          else if (hashCode == Parameters_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServiceActionDefinitionKey::Parameters;
+          case 2420395:
+            if (name == "Name")
+            {
+              return ServiceActionDefinitionKey::Name;
+            }
+            break;
+          case 2016261304:
+            if (name == "Version")
+            {
+              return ServiceActionDefinitionKey::Version;
+            }
+            break;
+          case 947538274:
+            if (name == "AssumeRole")
+            {
+              return ServiceActionDefinitionKey::AssumeRole;
+            }
+            break;
+          case -1842766326:
+            if (name == "Parameters")
+            {
+              return ServiceActionDefinitionKey::Parameters;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ServiceActionDefinitionKey::NOT_SET;
         }
 
-        Aws::String GetNameForServiceActionDefinitionKey(ServiceActionDefinitionKey enumValue)
+        const char* GetNameForServiceActionDefinitionKeyCStr(ServiceActionDefinitionKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServiceActionDefinitionKey::Name:
-            return "Name";
-          case ServiceActionDefinitionKey::Version:
-            return "Version";
-          case ServiceActionDefinitionKey::AssumeRole:
-            return "AssumeRole";
-          case ServiceActionDefinitionKey::Parameters:
-            return "Parameters";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServiceActionDefinitionKey(ServiceActionDefinitionKey enumValue)
+        {
+          return GetNameForServiceActionDefinitionKeyCStr(enumValue);
         }
 
       } // namespace ServiceActionDefinitionKeyMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ServiceActionDefinitionTypeMapper
       {
 
-        static const int SSM_AUTOMATION_HASH = HashingUtils::HashString("SSM_AUTOMATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SSM_AUTOMATION",
+        };
 
         ServiceActionDefinitionType GetServiceActionDefinitionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSM_AUTOMATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServiceActionDefinitionType::SSM_AUTOMATION;
+          case 1377734313:
+            if (name == "SSM_AUTOMATION")
+            {
+              return ServiceActionDefinitionType::SSM_AUTOMATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ServiceActionDefinitionType::NOT_SET;
         }
 
-        Aws::String GetNameForServiceActionDefinitionType(ServiceActionDefinitionType enumValue)
+        const char* GetNameForServiceActionDefinitionTypeCStr(ServiceActionDefinitionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServiceActionDefinitionType::SSM_AUTOMATION:
-            return "SSM_AUTOMATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServiceActionDefinitionType(ServiceActionDefinitionType enumValue)
+        {
+          return GetNameForServiceActionDefinitionTypeCStr(enumValue);
         }
 
       } // namespace ServiceActionDefinitionTypeMapper
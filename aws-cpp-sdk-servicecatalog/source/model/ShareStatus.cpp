@@ -30,35 +30,58 @@ namespace Aws
       namespace ShareStatusMapper
       {
 
-        static const int NOT_STARTED_HASH = HashingUtils::HashString("NOT_STARTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int COMPLETED_WITH_ERRORS_HASH = HashingUtils::HashString("COMPLETED_WITH_ERRORS");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NOT_STARTED",
+          "IN_PROGRESS",
+          "COMPLETED",
+          "COMPLETED_WITH_ERRORS",
+          "ERROR",
+        };
 
         ShareStatus GetShareStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_STARTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ShareStatus::NOT_STARTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return ShareStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return ShareStatus::COMPLETED;
-          }
-          else if (hashCode == COMPLETED_WITH_ERRORS_HASH)
-          {
-            return ShareStatus::COMPLETED_WITH_ERRORS;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return ShareStatus::ERROR_;
+          case -1391247659:
+            if (name == "NOT_STARTED")
+            {
+              return ShareStatus::NOT_STARTED;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return ShareStatus::IN_PROGRESS;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return ShareStatus::COMPLETED;
+            }
+            break;
+          case -1638274832:
+            if (name == "COMPLETED_WITH_ERRORS")
+            {
+              return ShareStatus::COMPLETED_WITH_ERRORS;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return ShareStatus::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ShareStatus::NOT_SET;
         }
 
-        Aws::String GetNameForShareStatus(ShareStatus enumValue)
+        const char* GetNameForShareStatusCStr(ShareStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ShareStatus::NOT_STARTED:
-            return "NOT_STARTED";
-          case ShareStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case ShareStatus::COMPLETED:
-            return "COMPLETED";
-          case ShareStatus::COMPLETED_WITH_ERRORS:
-            return "COMPLETED_WITH_ERRORS";
-          case ShareStatus::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForShareStatus(ShareStatus enumValue)
+        {
+          return GetNameForShareStatusCStr(enumValue);
         }
 
       } // namespace ShareStatusMapper
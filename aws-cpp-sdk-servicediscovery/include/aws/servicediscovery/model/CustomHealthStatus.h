@@ -35,6 +35,11 @@ namespace CustomHealthStatusMapper
 AWS_SERVICEDISCOVERY_API CustomHealthStatus GetCustomHealthStatusForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForCustomHealthStatus(CustomHealthStatus value);
+
+/**
+ * Same as GetNameForCustomHealthStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForCustomHealthStatusCStr(CustomHealthStatus value);
 } // namespace CustomHealthStatusMapper
 } // namespace Model
 } // namespace ServiceDiscovery
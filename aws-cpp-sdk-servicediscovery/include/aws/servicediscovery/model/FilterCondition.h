@@ -36,6 +36,11 @@ namespace FilterConditionMapper
 AWS_SERVICEDISCOVERY_API FilterCondition GetFilterConditionForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForFilterCondition(FilterCondition value);
+
+/**
+ * Same as GetNameForFilterCondition(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForFilterConditionCStr(FilterCondition value);
 } // namespace FilterConditionMapper
 } // namespace Model
 } // namespace ServiceDiscovery
@@ -36,6 +36,11 @@ namespace HealthCheckTypeMapper
 AWS_SERVICEDISCOVERY_API HealthCheckType GetHealthCheckTypeForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForHealthCheckType(HealthCheckType value);
+
+/**
+ * Same as GetNameForHealthCheckType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForHealthCheckTypeCStr(HealthCheckType value);
 } // namespace HealthCheckTypeMapper
 } // namespace Model
 } // namespace ServiceDiscovery
@@ -36,6 +36,11 @@ namespace HealthStatusMapper
 AWS_SERVICEDISCOVERY_API HealthStatus GetHealthStatusForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForHealthStatus(HealthStatus value);
+
+/**
+ * Same as GetNameForHealthStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForHealthStatusCStr(HealthStatus value);
 } // namespace HealthStatusMapper
 } // namespace Model
 } // namespace ServiceDiscovery
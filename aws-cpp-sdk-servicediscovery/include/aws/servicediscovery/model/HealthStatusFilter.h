@@ -36,6 +36,11 @@ namespace HealthStatusFilterMapper
 AWS_SERVICEDISCOVERY_API HealthStatusFilter GetHealthStatusFilterForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForHealthStatusFilter(HealthStatusFilter value);
+
+/**
+ * Same as GetNameForHealthStatusFilter(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForHealthStatusFilterCStr(HealthStatusFilter value);
 } // namespace HealthStatusFilterMapper
 } // namespace Model
 } // namespace ServiceDiscovery
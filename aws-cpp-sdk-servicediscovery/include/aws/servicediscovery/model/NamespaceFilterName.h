@@ -34,6 +34,11 @@ namespace NamespaceFilterNameMapper
 AWS_SERVICEDISCOVERY_API NamespaceFilterName GetNamespaceFilterNameForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForNamespaceFilterName(NamespaceFilterName value);
+
+/**
+ * Same as GetNameForNamespaceFilterName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForNamespaceFilterNameCStr(NamespaceFilterName value);
 } // namespace NamespaceFilterNameMapper
 } // namespace Model
 } // namespace ServiceDiscovery
@@ -36,6 +36,11 @@ namespace NamespaceTypeMapper
 AWS_SERVICEDISCOVERY_API NamespaceType GetNamespaceTypeForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForNamespaceType(NamespaceType value);
+
+/**
+ * Same as GetNameForNamespaceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForNamespaceTypeCStr(NamespaceType value);
 } // namespace NamespaceTypeMapper
 } // namespace Model
 } // namespace ServiceDiscovery
@@ -38,6 +38,11 @@ namespace OperationFilterNameMapper
 AWS_SERVICEDISCOVERY_API OperationFilterName GetOperationFilterNameForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForOperationFilterName(OperationFilterName value);
+
+/**
+ * Same as GetNameForOperationFilterName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForOperationFilterNameCStr(OperationFilterName value);
 } // namespace OperationFilterNameMapper
 } // namespace Model
 } // namespace ServiceDiscovery
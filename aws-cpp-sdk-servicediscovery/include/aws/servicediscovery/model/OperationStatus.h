@@ -37,6 +37,11 @@ namespace OperationStatusMapper
 AWS_SERVICEDISCOVERY_API OperationStatus GetOperationStatusForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForOperationStatus(OperationStatus value);
+
+/**
+ * Same as GetNameForOperationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForOperationStatusCStr(OperationStatus value);
 } // namespace OperationStatusMapper
 } // namespace Model
 } // namespace ServiceDiscovery
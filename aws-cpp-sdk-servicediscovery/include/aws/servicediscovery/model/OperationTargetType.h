@@ -36,6 +36,11 @@ namespace OperationTargetTypeMapper
 AWS_SERVICEDISCOVERY_API OperationTargetType GetOperationTargetTypeForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForOperationTargetType(OperationTargetType value);
+
+/**
+ * Same as GetNameForOperationTargetType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForOperationTargetTypeCStr(OperationTargetType value);
 } // namespace OperationTargetTypeMapper
 } // namespace Model
 } // namespace ServiceDiscovery
@@ -38,6 +38,11 @@ namespace OperationTypeMapper
 AWS_SERVICEDISCOVERY_API OperationType GetOperationTypeForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForOperationType(OperationType value);
+
+/**
+ * Same as GetNameForOperationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForOperationTypeCStr(OperationType value);
 } // namespace OperationTypeMapper
 } // namespace Model
 } // namespace ServiceDiscovery
@@ -37,6 +37,11 @@ namespace RecordTypeMapper
 AWS_SERVICEDISCOVERY_API RecordType GetRecordTypeForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForRecordType(RecordType value);
+
+/**
+ * Same as GetNameForRecordType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForRecordTypeCStr(RecordType value);
 } // namespace RecordTypeMapper
 } // namespace Model
 } // namespace ServiceDiscovery
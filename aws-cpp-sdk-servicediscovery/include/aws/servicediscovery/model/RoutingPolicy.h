@@ -35,6 +35,11 @@ namespace RoutingPolicyMapper
 AWS_SERVICEDISCOVERY_API RoutingPolicy GetRoutingPolicyForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForRoutingPolicy(RoutingPolicy value);
+
+/**
+ * Same as GetNameForRoutingPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForRoutingPolicyCStr(RoutingPolicy value);
 } // namespace RoutingPolicyMapper
 } // namespace Model
 } // namespace ServiceDiscovery
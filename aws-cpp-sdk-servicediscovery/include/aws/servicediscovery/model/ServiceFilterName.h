@@ -34,6 +34,11 @@ namespace ServiceFilterNameMapper
 AWS_SERVICEDISCOVERY_API ServiceFilterName GetServiceFilterNameForName(const Aws::String& name);
 
 AWS_SERVICEDISCOVERY_API Aws::String GetNameForServiceFilterName(ServiceFilterName value);
+
+/**
+ * Same as GetNameForServiceFilterName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SERVICEDISCOVERY_API const char* GetNameForServiceFilterNameCStr(ServiceFilterName value);
 } // namespace ServiceFilterNameMapper
 } // namespace Model
 } // namespace ServiceDiscovery
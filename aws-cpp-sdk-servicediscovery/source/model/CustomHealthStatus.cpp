@@ -30,20 +30,37 @@ namespace Aws
       namespace CustomHealthStatusMapper
       {
 
-        static const int HEALTHY_HASH = HashingUtils::HashString("HEALTHY");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HEALTHY",
+          "UNHEALTHY",
+        };
 
         CustomHealthStatus GetCustomHealthStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HEALTHY_HASH)
-          {
-            return CustomHealthStatus::HEALTHY;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CustomHealthStatus::UNHEALTHY;
+          case 1513543037:
+            if (name == "HEALTHY")
+            {
+              return CustomHealthStatus::HEALTHY;
+            }
+            break;
+          case 998988996:
+            if (name == "UNHEALTHY")
+            {
+              return CustomHealthStatus::UNHEALTHY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CustomHealthStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCustomHealthStatus(CustomHealthStatus enumValue)
+        const char* GetNameForCustomHealthStatusCStr(CustomHealthStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CustomHealthStatus::HEALTHY:
-            return "HEALTHY";
-          case CustomHealthStatus::UNHEALTHY:
-            return "UNHEALTHY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCustomHealthStatus(CustomHealthStatus enumValue)
+        {
+          return GetNameForCustomHealthStatusCStr(enumValue);
         }
 
       } // namespace CustomHealthStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace FilterConditionMapper
       {
 
-        static const int EQ_HASH = HashingUtils::HashString("EQ");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int BETWEEN_HASH = HashingUtils::HashString("BETWEEN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EQ",
+          "IN",
+          "BETWEEN",
+        };
 
         FilterCondition GetFilterConditionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQ_HASH)
-          {
-            return FilterCondition::EQ;
-          }
-          else if (hashCode == IN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FilterCondition::IN;
-          }
-          else if (hashCode == BETWEEN_HASH)
-          {
-            return FilterCondition::BETWEEN;
+          case 2220:
+            if (name == "EQ")
+            {
+              return FilterCondition::EQ;
+            }
+            break;
+          case 2341:
+            if (name == "IN")
+            {
+              return FilterCondition::IN;
+            }
+            break;
+          case 501348328:
+            if (name == "BETWEEN")
+            {
+              return FilterCondition::BETWEEN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FilterCondition::NOT_SET;
         }
 
-        Aws::String GetNameForFilterCondition(FilterCondition enumValue)
+        const char* GetNameForFilterConditionCStr(FilterCondition enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FilterCondition::EQ:
-            return "EQ";
-          case FilterCondition::IN:
-            return "IN";
-          case FilterCondition::BETWEEN:
-            return "BETWEEN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFilterCondition(FilterCondition enumValue)
+        {
+          return GetNameForFilterConditionCStr(enumValue);
         }
 
       } // namespace FilterConditionMapper
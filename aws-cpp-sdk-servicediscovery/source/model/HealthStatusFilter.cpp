@@ -30,25 +30,44 @@ namespace Aws
       namespace HealthStatusFilterMapper
       {
 
-        static const int HEALTHY_HASH = HashingUtils::HashString("HEALTHY");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HEALTHY",
+          "UNHEALTHY",
+          "ALL",
+        };
 
         HealthStatusFilter GetHealthStatusFilterForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HEALTHY_HASH)
-          {
-            return HealthStatusFilter::HEALTHY;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HealthStatusFilter::UNHEALTHY;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return HealthStatusFilter::ALL;
+          case 1513543037:
+            if (name == "HEALTHY")
+            {
+              return HealthStatusFilter::HEALTHY;
+            }
+            break;
+          case 998988996:
+            if (name == "UNHEALTHY")
+            {
+              return HealthStatusFilter::UNHEALTHY;
+            }
+            break;
+          case 64897:
+            if (name == "ALL")
+            {
+              return HealthStatusFilter::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return HealthStatusFilter::NOT_SET;
         }
 
-        Aws::String GetNameForHealthStatusFilter(HealthStatusFilter enumValue)
+        const char* GetNameForHealthStatusFilterCStr(HealthStatusFilter enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HealthStatusFilter::HEALTHY:
-            return "HEALTHY";
-          case HealthStatusFilter::UNHEALTHY:
-            return "UNHEALTHY";
-          case HealthStatusFilter::ALL:
-            return "ALL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHealthStatusFilter(HealthStatusFilter enumValue)
+        {
+          return GetNameForHealthStatusFilterCStr(enumValue);
         }
 
       } // namespace HealthStatusFilterMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace NamespaceFilterNameMapper
       {
 
-        static const int TYPE_HASH = HashingUtils::HashString("TYPE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TYPE",
+        };
 
         NamespaceFilterName GetNamespaceFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TYPE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NamespaceFilterName::TYPE;
+          case 2590522:
+            if (name == "TYPE")
+            {
+              return NamespaceFilterName::TYPE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return NamespaceFilterName::NOT_SET;
         }
 
-        Aws::String GetNameForNamespaceFilterName(NamespaceFilterName enumValue)
+        const char* GetNameForNamespaceFilterNameCStr(NamespaceFilterName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NamespaceFilterName::TYPE:
-            return "TYPE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNamespaceFilterName(NamespaceFilterName enumValue)
+        {
+          return GetNameForNamespaceFilterNameCStr(enumValue);
         }
 
       } // namespace NamespaceFilterNameMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace NamespaceTypeMapper
       {
 
-        static const int DNS_PUBLIC_HASH = HashingUtils::HashString("DNS_PUBLIC");
-        static const int DNS_PRIVATE_HASH = HashingUtils::HashString("DNS_PRIVATE");
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DNS_PUBLIC",
+          "DNS_PRIVATE",
+          "HTTP",
+        };
 
         NamespaceType GetNamespaceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DNS_PUBLIC_HASH)
-          {
-            return NamespaceType::DNS_PUBLIC;
-          }
-          else if (hashCode == DNS_PRIVATE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NamespaceType::DNS_PRIVATE;
-          }
-          else if (hashCode == HTTP_HASH)
-          {
-            return NamespaceType::HTTP;
+          case -316797345:
+            if (name == "DNS_PUBLIC")
+            {
+              return NamespaceType::DNS_PUBLIC;
+            }
+            break;
+          case -1309915091:
+            if (name == "DNS_PRIVATE")
+            {
+              return NamespaceType::DNS_PRIVATE;
+            }
+            break;
+          case 2228360:
+            if (name == "HTTP")
+            {
+              return NamespaceType::HTTP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return NamespaceType::NOT_SET;
         }
 
-        Aws::String GetNameForNamespaceType(NamespaceType enumValue)
+        const char* GetNameForNamespaceTypeCStr(NamespaceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NamespaceType::DNS_PUBLIC:
-            return "DNS_PUBLIC";
-          case NamespaceType::DNS_PRIVATE:
-            return "DNS_PRIVATE";
-          case NamespaceType::HTTP:
-            return "HTTP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNamespaceType(NamespaceType enumValue)
+        {
+          return GetNameForNamespaceTypeCStr(enumValue);
         }
 
       } // namespace NamespaceTypeMapper
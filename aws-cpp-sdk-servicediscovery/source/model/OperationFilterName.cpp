@@ -30,35 +30,58 @@ namespace Aws
       namespace OperationFilterNameMapper
       {
 
-        static const int NAMESPACE_ID_HASH = HashingUtils::HashString("NAMESPACE_ID");
-        static const int SERVICE_ID_HASH = HashingUtils::HashString("SERVICE_ID");
-        static const int STATUS_HASH = HashingUtils::HashString("STATUS");
-        static const int TYPE_HASH = HashingUtils::HashString("TYPE");
-        static const int UPDATE_DATE_HASH = HashingUtils::HashString("UPDATE_DATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NAMESPACE_ID",
+          "SERVICE_ID",
+          "STATUS",
+          "TYPE",
+          "UPDATE_DATE",
+        };
 
         OperationFilterName GetOperationFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAMESPACE_ID_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperationFilterName::NAMESPACE_ID;
-          }
-          else if (hashCode == SERVICE_ID_HASH)
-          {
-            return OperationFilterName::SERVICE_ID;
-          }
-          else if (hashCode == STATUS_HASH)
-          {
-            return OperationFilterName::STATUS;
-          }
-          else if (hashCode == TYPE_HASH)
-          {
-            return OperationFilterName::TYPE;
-          }
-          else if (hashCode == UPDATE_DATE_HASH)
-          {
-            return OperationFilterName::UPDATE_DATE;
+          case 1063959199:
+            if (name == "NAMESPACE_ID")
+            {
+              return OperationFilterName::NAMESPACE_ID;
+            }
+            break;
+          case -1239640315:
+            if (name == "SERVICE_ID")
+            {
+              return OperationFilterName::SERVICE_ID;
+            }
+            break;
+          case -1839152142:
+            if (name == "STATUS")
+            {
+              return OperationFilterName::STATUS;
+            }
+            break;
+          case 2590522:
+            if (name == "TYPE")
+            {
+              return OperationFilterName::TYPE;
+            }
+            break;
+          case 1608583524:
+            if (name == "UPDATE_DATE")
+            {
+              return OperationFilterName::UPDATE_DATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return OperationFilterName::NOT_SET;
         }
 
-        Aws::String GetNameForOperationFilterName(OperationFilterName enumValue)
+        const char* GetNameForOperationFilterNameCStr(OperationFilterName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperationFilterName::NAMESPACE_ID:
-            return "NAMESPACE_ID";
-          case OperationFilterName::SERVICE_ID:
-            return "SERVICE_ID";
-          case OperationFilterName::STATUS:
-            return "STATUS";
-          case OperationFilterName::TYPE:
-            return "TYPE";
-          case OperationFilterName::UPDATE_DATE:
-            return "UPDATE_DATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperationFilterName(OperationFilterName enumValue)
+        {
+          return GetNameForOperationFilterNameCStr(enumValue);
         }
 
       } // namespace OperationFilterNameMapper
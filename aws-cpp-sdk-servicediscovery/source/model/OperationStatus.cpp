@@ -30,30 +30,51 @@ namespace Aws
       namespace OperationStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAIL_HASH = HashingUtils::HashString("FAIL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUBMITTED",
+          "PENDING",
+          "SUCCESS",
+          "FAIL",
+        };
 
         OperationStatus GetOperationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
-          {
-            return OperationStatus::SUBMITTED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return OperationStatus::PENDING;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return OperationStatus::SUCCESS;
-          }
-          else if (hashCode == FAIL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperationStatus::FAIL;
+          case -1159694117:
+            if (name == "SUBMITTED")
+            {
+              return OperationStatus::SUBMITTED;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return OperationStatus::PENDING;
+            }
+            break;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return OperationStatus::SUCCESS;
+            }
+            break;
+          case 2150174:
+            if (name == "FAIL")
+            {
+              return OperationStatus::FAIL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return OperationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForOperationStatus(OperationStatus enumValue)
+        const char* GetNameForOperationStatusCStr(OperationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperationStatus::SUBMITTED:
-            return "SUBMITTED";
-          case OperationStatus::PENDING:
-            return "PENDING";
-          case OperationStatus::SUCCESS:
-            return "SUCCESS";
-          case OperationStatus::FAIL:
-            return "FAIL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperationStatus(OperationStatus enumValue)
+        {
+          return GetNameForOperationStatusCStr(enumValue);
         }
 
       } // namespace OperationStatusMapper
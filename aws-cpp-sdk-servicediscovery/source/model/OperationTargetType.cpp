@@ -30,25 +30,44 @@ namespace Aws
       namespace OperationTargetTypeMapper
       {
 
-        static const int NAMESPACE_HASH = HashingUtils::HashString("NAMESPACE");
-        static const int SERVICE_HASH = HashingUtils::HashString("SERVICE");
-        static const int INSTANCE_HASH = HashingUtils::HashString("INSTANCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NAMESPACE",
+          "SERVICE",
+          "INSTANCE",
+        };
 
         OperationTargetType GetOperationTargetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAMESPACE_HASH)
-          {
-            return OperationTargetType::NAMESPACE;
-          }
-          else if (hashCode == SERVICE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperationTargetType::SERVICE;
-          }
-          else if (hashCode == INSTANCE_HASH)
-          {
-            return OperationTargetType::INSTANCE;
+          case -256154309:
+            if (name == "NAMESPACE")
+            {
+              return OperationTargetType::NAMESPACE;
+            }
+            break;
+          case -1592831339:
+            if (name == "SERVICE")
+            {
+              return OperationTargetType::SERVICE;
+            }
+            break;
+          case 1337754773:
+            if (name == "INSTANCE")
+            {
+              return OperationTargetType::INSTANCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return OperationTargetType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationTargetType(OperationTargetType enumValue)
+        const char* GetNameForOperationTargetTypeCStr(OperationTargetType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperationTargetType::NAMESPACE:
-            return "NAMESPACE";
-          case OperationTargetType::SERVICE:
-            return "SERVICE";
-          case OperationTargetType::INSTANCE:
-            return "INSTANCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperationTargetType(OperationTargetType enumValue)
+        {
+          return GetNameForOperationTargetTypeCStr(enumValue);
         }
 
       } // namespace OperationTargetTypeMapper
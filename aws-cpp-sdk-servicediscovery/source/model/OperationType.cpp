@@ -30,35 +30,58 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int CREATE_NAMESPACE_HASH = HashingUtils::HashString("CREATE_NAMESPACE");
-        static const int DELETE_NAMESPACE_HASH = HashingUtils::HashString("DELETE_NAMESPACE");
-        static const int UPDATE_SERVICE_HASH = HashingUtils::HashString("UPDATE_SERVICE");
-        static const int REGISTER_INSTANCE_HASH = HashingUtils::HashString("REGISTER_INSTANCE");
-        static const int DEREGISTER_INSTANCE_HASH = HashingUtils::HashString("DEREGISTER_INSTANCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATE_NAMESPACE",
+          "DELETE_NAMESPACE",
+          "UPDATE_SERVICE",
+          "REGISTER_INSTANCE",
+          "DEREGISTER_INSTANCE",
+        };
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_NAMESPACE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperationType::CREATE_NAMESPACE;
-          }
-          else if (hashCode == DELETE_NAMESPACE_HASH)
-          {
-            return OperationType::DELETE_NAMESPACE;
-          }
-          else if (hashCode == UPDATE_SERVICE_HASH)
-          {
-            return OperationType::UPDATE_SERVICE;
-          }
-          else if (hashCode == REGISTER_INSTANCE_HASH)
-          {
-            return OperationType::REGISTER_INSTANCE;
-          }
-          else if (hashCode == DEREGISTER_INSTANCE_HASH)
-          {
-            return OperationType::DEREGISTER_INSTANCE;
+          case -2123634248:
+            if (name == "CREATE_NAMESPACE")
+            {
+              return OperationType::CREATE_NAMESPACE;
+            }
+            break;
+          case -1175060569:
+            if (name == "DELETE_NAMESPACE")
+            {
+              return OperationType::DELETE_NAMESPACE;
+            }
+            break;
+          case -1392423649:
+            if (name == "UPDATE_SERVICE")
+            {
+              return OperationType::UPDATE_SERVICE;
+            }
+            break;
+          case -2015076687:
+            if (name == "REGISTER_INSTANCE")
+            {
+              return OperationType::REGISTER_INSTANCE;
+            }
+            break;
+          case 611862608:
+            if (name == "DEREGISTER_INSTANCE")
+            {
+              return OperationType::DEREGISTER_INSTANCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return OperationType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationType(OperationType enumValue)
+        const char* GetNameForOperationTypeCStr(OperationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperationType::CREATE_NAMESPACE:
-            return "CREATE_NAMESPACE";
-          case OperationType::DELETE_NAMESPACE:
-            return "DELETE_NAMESPACE";
-          case OperationType::UPDATE_SERVICE:
-            return "UPDATE_SERVICE";
-          case OperationType::REGISTER_INSTANCE:
-            return "REGISTER_INSTANCE";
-          case OperationType::DEREGISTER_INSTANCE:
-            return "DEREGISTER_INSTANCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperationType(OperationType enumValue)
+        {
+          return GetNameForOperationTypeCStr(enumValue);
         }
 
       } // namespace OperationTypeMapper
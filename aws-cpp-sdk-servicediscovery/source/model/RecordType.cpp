@@ -30,30 +30,51 @@ namespace Aws
       namespace RecordTypeMapper
       {
 
-        static const int SRV_HASH = HashingUtils::HashString("SRV");
-        static const int A_HASH = HashingUtils::HashString("A");
-        static const int AAAA_HASH = HashingUtils::HashString("AAAA");
-        static const int CNAME_HASH = HashingUtils::HashString("CNAME");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SRV",
+          "A",
+          "AAAA",
+          "CNAME",
+        };
 
         RecordType GetRecordTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SRV_HASH)
-          {
-            return RecordType::SRV;
-          }
-          else if (hashCode == A_HASH)
-          {
-            return RecordType::A;
-          }
-          else if (hashCode == AAAA_HASH)
-          {
-            return RecordType::AAAA;
-          }
-          else if (hashCode == CNAME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RecordType::CNAME;
+          case 82391:
+            if (name == "SRV")
+            {
+              return RecordType::SRV;
+            }
+            break;
+          case 65:
+            if (name == "A")
+            {
+              return RecordType::A;
+            }
+            break;
+          case 2000960:
+            if (name == "AAAA")
+            {
+              return RecordType::AAAA;
+            }
+            break;
+          case 64264526:
+            if (name == "CNAME")
+            {
+              return RecordType::CNAME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return RecordType::NOT_SET;
         }
 
-        Aws::String GetNameForRecordType(RecordType enumValue)
+        const char* GetNameForRecordTypeCStr(RecordType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RecordType::SRV:
-            return "SRV";
-          case RecordType::A:
-            return "A";
-          case RecordType::AAAA:
-            return "AAAA";
-          case RecordType::CNAME:
-            return "CNAME";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRecordType(RecordType enumValue)
+        {
+          return GetNameForRecordTypeCStr(enumValue);
         }
 
       } // namespace RecordTypeMapper
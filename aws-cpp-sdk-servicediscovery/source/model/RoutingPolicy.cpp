@@ -30,20 +30,37 @@ namespace Aws
       namespace RoutingPolicyMapper
       {
 
-        static const int MULTIVALUE_HASH = HashingUtils::HashString("MULTIVALUE");
-        static const int WEIGHTED_HASH = HashingUtils::HashString("WEIGHTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "MULTIVALUE",
+          "WEIGHTED",
+        };
 
         RoutingPolicy GetRoutingPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MULTIVALUE_HASH)
-          {
-            return RoutingPolicy::MULTIVALUE;
-          }
-          else if (hashCode == WEIGHTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RoutingPolicy::WEIGHTED;
+          case 1755382744:
+            if (name == "MULTIVALUE")
+            {
+              return RoutingPolicy::MULTIVALUE;
+            }
+            break;
+          case 271614231:
+            if (name == "WEIGHTED")
+            {
+              return RoutingPolicy::WEIGHTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RoutingPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForRoutingPolicy(RoutingPolicy enumValue)
+        const char* GetNameForRoutingPolicyCStr(RoutingPolicy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RoutingPolicy::MULTIVALUE:
-            return "MULTIVALUE";
-          case RoutingPolicy::WEIGHTED:
-            return "WEIGHTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRoutingPolicy(RoutingPolicy enumValue)
+        {
+          return GetNameForRoutingPolicyCStr(enumValue);
         }
 
       } // namespace RoutingPolicyMapper
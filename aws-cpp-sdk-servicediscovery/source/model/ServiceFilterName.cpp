@@ -30,15 +30,30 @@ namespace Aws
       namespace ServiceFilterNameMapper
       {
 
-        static const int NAMESPACE_ID_HASH = HashingUtils::HashString("NAMESPACE_ID");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NAMESPACE_ID",
+        };
 
         ServiceFilterName GetServiceFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAMESPACE_ID_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServiceFilterName::NAMESPACE_ID;
+          case 1063959199:
+            if (name == "NAMESPACE_ID")
+            {
+              return ServiceFilterName::NAMESPACE_ID;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ServiceFilterName::NOT_SET;
         }
 
-        Aws::String GetNameForServiceFilterName(ServiceFilterName enumValue)
+        const char* GetNameForServiceFilterNameCStr(ServiceFilterName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServiceFilterName::NAMESPACE_ID:
-            return "NAMESPACE_ID";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServiceFilterName(ServiceFilterName enumValue)
+        {
+          return GetNameForServiceFilterNameCStr(enumValue);
         }
 
       } // namespace ServiceFilterNameMapper
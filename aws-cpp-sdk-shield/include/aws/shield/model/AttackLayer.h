@@ -35,6 +35,11 @@ namespace AttackLayerMapper
 AWS_SHIELD_API AttackLayer GetAttackLayerForName(const Aws::String& name);
 
 AWS_SHIELD_API Aws::String GetNameForAttackLayer(AttackLayer value);
+
+/**
+ * Same as GetNameForAttackLayer(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SHIELD_API const char* GetNameForAttackLayerCStr(AttackLayer value);
 } // namespace AttackLayerMapper
 } // namespace Model
 } // namespace Shield
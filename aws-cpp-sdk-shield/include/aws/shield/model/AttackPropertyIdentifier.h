@@ -39,6 +39,11 @@ namespace AttackPropertyIdentifierMapper
 AWS_SHIELD_API AttackPropertyIdentifier GetAttackPropertyIdentifierForName(const Aws::String& name);
 
 AWS_SHIELD_API Aws::String GetNameForAttackPropertyIdentifier(AttackPropertyIdentifier value);
+
+/**
+ * Same as GetNameForAttackPropertyIdentifier(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SHIELD_API const char* GetNameForAttackPropertyIdentifierCStr(AttackPropertyIdentifier value);
 } // namespace AttackPropertyIdentifierMapper
 } // namespace Model
 } // namespace Shield
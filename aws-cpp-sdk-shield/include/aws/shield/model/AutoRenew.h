@@ -35,6 +35,11 @@ namespace AutoRenewMapper
 AWS_SHIELD_API AutoRenew GetAutoRenewForName(const Aws::String& name);
 
 AWS_SHIELD_API Aws::String GetNameForAutoRenew(AutoRenew value);
+
+/**
+ * Same as GetNameForAutoRenew(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SHIELD_API const char* GetNameForAutoRenewCStr(AutoRenew value);
 } // namespace AutoRenewMapper
 } // namespace Model
 } // namespace Shield
@@ -35,6 +35,11 @@ namespace SubResourceTypeMapper
 AWS_SHIELD_API SubResourceType GetSubResourceTypeForName(const Aws::String& name);
 
 AWS_SHIELD_API Aws::String GetNameForSubResourceType(SubResourceType value);
+
+/**
+ * Same as GetNameForSubResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SHIELD_API const char* GetNameForSubResourceTypeCStr(SubResourceType value);
 } // namespace SubResourceTypeMapper
 } // namespace Model
 } // namespace Shield
@@ -35,6 +35,11 @@ namespace SubscriptionStateMapper
 AWS_SHIELD_API SubscriptionState GetSubscriptionStateForName(const Aws::String& name);
 
 AWS_SHIELD_API Aws::String GetNameForSubscriptionState(SubscriptionState value);
+
+/**
+ * Same as GetNameForSubscriptionState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SHIELD_API const char* GetNameForSubscriptionStateCStr(SubscriptionState value);
 } // namespace SubscriptionStateMapper
 } // namespace Model
 } // namespace Shield
@@ -37,6 +37,11 @@ namespace UnitMapper
 AWS_SHIELD_API Unit GetUnitForName(const Aws::String& name);
 
 AWS_SHIELD_API Aws::String GetNameForUnit(Unit value);
+
+/**
+ * Same as GetNameForUnit(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SHIELD_API const char* GetNameForUnitCStr(Unit value);
 } // namespace UnitMapper
 } // namespace Model
 } // namespace Shield
@@ -30,20 +30,37 @@ namespace Aws
       namespace AttackLayerMapper
       {
 
-        static const int NETWORK_HASH = HashingUtils::HashString("NETWORK");
-        static const int APPLICATION_HASH = HashingUtils::HashString("APPLICATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NETWORK",
+          "APPLICATION",
+        };
 
         AttackLayer GetAttackLayerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NETWORK_HASH)
-          {
-            return AttackLayer::NETWORK;
-          }
-          else if (hashCode == APPLICATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AttackLayer::APPLICATION;
+          case -1733499378:
+            if (name == "NETWORK")
+            {
+              return AttackLayer::NETWORK;
+            }
+            break;
+          case -587753168:
+            if (name == "APPLICATION")
+            {
+              return AttackLayer::APPLICATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AttackLayer::NOT_SET;
         }
 
-        Aws::String GetNameForAttackLayer(AttackLayer enumValue)
+        const char* GetNameForAttackLayerCStr(AttackLayer enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AttackLayer::NETWORK:
-            return "NETWORK";
-          case AttackLayer::APPLICATION:
-            return "APPLICATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAttackLayer(AttackLayer enumValue)
+        {
+          return GetNameForAttackLayerCStr(enumValue);
         }
 
       } // namespace AttackLayerMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace AttackPropertyIdentifierMapper
       {
 
-        static const int DESTINATION_URL_HASH = HashingUtils::HashString("DESTINATION_URL");
-        static const int REFERRER_HASH = HashingUtils::HashString("REFERRER");
-        static const int SOURCE_ASN_HASH = HashingUtils::HashString("SOURCE_ASN");
-        static const int SOURCE_COUNTRY_HASH = HashingUtils::HashString("SOURCE_COUNTRY");
-        static const int SOURCE_IP_ADDRESS_HASH = HashingUtils::HashString("SOURCE_IP_ADDRESS");
-        static const int SOURCE_USER_AGENT_HASH = HashingUtils::HashString("SOURCE_USER_AGENT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DESTINATION_URL",
+          "REFERRER",
+          "SOURCE_ASN",
+          "SOURCE_COUNTRY",
+          "SOURCE_IP_ADDRESS",
+          "SOURCE_USER_AGENT",
+        };
 
         AttackPropertyIdentifier GetAttackPropertyIdentifierForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DESTINATION_URL_HASH)
-          {
-            return AttackPropertyIdentifier::DESTINATION_URL;
-          }
-          else if (hashCode == REFERRER_HASH)
-          {
-            return AttackPropertyIdentifier::REFERRER;
-          }
-          else if (hashCode == SOURCE_ASN_HASH)
-          {
-            return AttackPropertyIdentifier::SOURCE_ASN;
-          }
-          else if (hashCode == SOURCE_COUNTRY_HASH)
-          {
-            return AttackPropertyIdentifier::SOURCE_COUNTRY;
-          }
-          else if (hashCode == SOURCE_IP_ADDRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AttackPropertyIdentifier::SOURCE_IP_ADDRESS;
-          }
-          else if (hashCode == SOURCE_USER_AGENT_HASH)
-          {
-            return AttackPropertyIdentifier::SOURCE_USER_AGENT;
+          case -644044418:
+            if (name == "DESTINATION_URL")
+            {
+              return AttackPropertyIdentifier::DESTINATION_URL;
+            }
+            break;
+          case 60058655:
+            if (name == "REFERRER")
+            {
+              return AttackPropertyIdentifier::REFERRER;
+            }
+            break;
+          case -625081288:
+            if (name == "SOURCE_ASN")
+            {
+              return AttackPropertyIdentifier::SOURCE_ASN;
+            }
+            break;
+          case -357459118:
+            if (name == "SOURCE_COUNTRY")
+            {
+              return AttackPropertyIdentifier::SOURCE_COUNTRY;
+            }
+            break;
+          case 592227168:
+            if (name == "SOURCE_IP_ADDRESS")
+            {
+              return AttackPropertyIdentifier::SOURCE_IP_ADDRESS;
+            }
+            break;
+          case 2010789909:
+            if (name == "SOURCE_USER_AGENT")
+            {
+              return AttackPropertyIdentifier::SOURCE_USER_AGENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return AttackPropertyIdentifier::NOT_SET;
         }
 
-        Aws::String GetNameForAttackPropertyIdentifier(AttackPropertyIdentifier enumValue)
+        const char* GetNameForAttackPropertyIdentifierCStr(AttackPropertyIdentifier enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AttackPropertyIdentifier::DESTINATION_URL:
-            return "DESTINATION_URL";
-          case AttackPropertyIdentifier::REFERRER:
-            return "REFERRER";
-          case AttackPropertyIdentifier::SOURCE_ASN:
-            return "SOURCE_ASN";
-          case AttackPropertyIdentifier::SOURCE_COUNTRY:
-            return "SOURCE_COUNTRY";
-          case AttackPropertyIdentifier::SOURCE_IP_ADDRESS:
-            return "SOURCE_IP_ADDRESS";
-          case AttackPropertyIdentifier::SOURCE_USER_AGENT:
-            return "SOURCE_USER_AGENT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAttackPropertyIdentifier(AttackPropertyIdentifier enumValue)
+        {
+          return GetNameForAttackPropertyIdentifierCStr(enumValue);
         }
 
       } // namespace AttackPropertyIdentifierMapper
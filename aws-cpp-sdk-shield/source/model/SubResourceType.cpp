@@ -30,20 +30,37 @@ namespace Aws
       namespace SubResourceTypeMapper
       {
 
-        static const int IP_HASH = HashingUtils::HashString("IP");
-        static const int URL_HASH = HashingUtils::HashString("URL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IP",
+          "URL",
+        };
 
         SubResourceType GetSubResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IP_HASH)
-          {
-            return SubResourceType::IP;
-          }
-          else if (hashCode == URL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SubResourceType::URL;
+          case 2343:
+            if (name == "IP")
+            {
+              return SubResourceType::IP;
+            }
+            break;
+          case 84303:
+            if (name == "URL")
+            {
+              return SubResourceType::URL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SubResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSubResourceType(SubResourceType enumValue)
+        const char* GetNameForSubResourceTypeCStr(SubResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SubResourceType::IP:
-            return "IP";
-          case SubResourceType::URL:
-            return "URL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSubResourceType(SubResourceType enumValue)
+        {
+          return GetNameForSubResourceTypeCStr(enumValue);
         }
 
       } // namespace SubResourceTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace UnitMapper
       {
 
-        static const int BITS_HASH = HashingUtils::HashString("BITS");
-        static const int BYTES_HASH = HashingUtils::HashString("BYTES");
-        static const int PACKETS_HASH = HashingUtils::HashString("PACKETS");
-        static const int REQUESTS_HASH = HashingUtils::HashString("REQUESTS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BITS",
+          "BYTES",
+          "PACKETS",
+          "REQUESTS",
+        };
 
         Unit GetUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BITS_HASH)
-          {
-            return Unit::BITS;
-          }
-          else if (hashCode == BYTES_HASH)
-          {
-            return Unit::BYTES;
-          }
-          else if (hashCode == PACKETS_HASH)
-          {
-            return Unit::PACKETS;
-          }
-          else if (hashCode == REQUESTS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Unit::REQUESTS;
+          case 2039046:
+            if (name == "BITS")
+            {
+              return Unit::BITS;
+            }
+            break;
+          case 63686731:
+            if (name == "BYTES")
+            {
+              return Unit::BYTES;
+            }
+            break;
+          case -89075509:
+            if (name == "PACKETS")
+            {
+              return Unit::PACKETS;
+            }
+            break;
+          case 389369796:
+            if (name == "REQUESTS")
+            {
+              return Unit::REQUESTS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return Unit::NOT_SET;
         }
 
-        Aws::String GetNameForUnit(Unit enumValue)
+        const char* GetNameForUnitCStr(Unit enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Unit::BITS:
-            return "BITS";
-          case Unit::BYTES:
-            return "BYTES";
-          case Unit::PACKETS:
-            return "PACKETS";
-          case Unit::REQUESTS:
-            return "REQUESTS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUnit(Unit enumValue)
+        {
+          return GetNameForUnitCStr(enumValue);
         }
 
       } // namespace UnitMapper
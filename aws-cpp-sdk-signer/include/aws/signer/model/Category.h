@@ -34,6 +34,11 @@ namespace CategoryMapper
 AWS_SIGNER_API Category GetCategoryForName(const Aws::String& name);
 
 AWS_SIGNER_API Aws::String GetNameForCategory(Category value);
+
+/**
+ * Same as GetNameForCategory(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SIGNER_API const char* GetNameForCategoryCStr(Category value);
 } // namespace CategoryMapper
 } // namespace Model
 } // namespace signer
@@ -35,6 +35,11 @@ namespace EncryptionAlgorithmMapper
 AWS_SIGNER_API EncryptionAlgorithm GetEncryptionAlgorithmForName(const Aws::String& name);
 
 AWS_SIGNER_API Aws::String GetNameForEncryptionAlgorithm(EncryptionAlgorithm value);
+
+/**
+ * Same as GetNameForEncryptionAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SIGNER_API const char* GetNameForEncryptionAlgorithmCStr(EncryptionAlgorithm value);
 } // namespace EncryptionAlgorithmMapper
 } // namespace Model
 } // namespace signer
@@ -35,6 +35,11 @@ namespace HashAlgorithmMapper
 AWS_SIGNER_API HashAlgorithm GetHashAlgorithmForName(const Aws::String& name);
 
 AWS_SIGNER_API Aws::String GetNameForHashAlgorithm(HashAlgorithm value);
+
+/**
+ * Same as GetNameForHashAlgorithm(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SIGNER_API const char* GetNameForHashAlgorithmCStr(HashAlgorithm value);
 } // namespace HashAlgorithmMapper
 } // namespace Model
 } // namespace signer
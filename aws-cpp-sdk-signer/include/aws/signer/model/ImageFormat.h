@@ -34,6 +34,11 @@ namespace ImageFormatMapper
 AWS_SIGNER_API ImageFormat GetImageFormatForName(const Aws::String& name);
 
 AWS_SIGNER_API Aws::String GetNameForImageFormat(ImageFormat value);
+
+/**
+ * Same as GetNameForImageFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SIGNER_API const char* GetNameForImageFormatCStr(ImageFormat value);
 } // namespace ImageFormatMapper
 } // namespace Model
 } // namespace signer
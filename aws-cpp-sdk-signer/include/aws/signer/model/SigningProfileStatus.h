@@ -35,6 +35,11 @@ namespace SigningProfileStatusMapper
 AWS_SIGNER_API SigningProfileStatus GetSigningProfileStatusForName(const Aws::String& name);
 
 AWS_SIGNER_API Aws::String GetNameForSigningProfileStatus(SigningProfileStatus value);
+
+/**
+ * Same as GetNameForSigningProfileStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SIGNER_API const char* GetNameForSigningProfileStatusCStr(SigningProfileStatus value);
 } // namespace SigningProfileStatusMapper
 } // namespace Model
 } // namespace signer
@@ -36,6 +36,11 @@ namespace SigningStatusMapper
 AWS_SIGNER_API SigningStatus GetSigningStatusForName(const Aws::String& name);
 
 AWS_SIGNER_API Aws::String GetNameForSigningStatus(SigningStatus value);
+
+/**
+ * Same as GetNameForSigningStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SIGNER_API const char* GetNameForSigningStatusCStr(SigningStatus value);
 } // namespace SigningStatusMapper
 } // namespace Model
 } // namespace signer
@@ -30,20 +30,37 @@ namespace Aws
       namespace EncryptionAlgorithmMapper
       {
 
-        static const int RSA_HASH = HashingUtils::HashString("RSA");
-        static const int ECDSA_HASH = HashingUtils::HashString("ECDSA");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RSA",
+          "ECDSA",
+        };
 
         EncryptionAlgorithm GetEncryptionAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RSA_HASH)
-          {
-            return EncryptionAlgorithm::RSA;
-          }
-          else if (hashCode == ECDSA_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EncryptionAlgorithm::ECDSA;
+          case 81440:
+            if (name == "RSA")
+            {
+              return EncryptionAlgorithm::RSA;
+            }
+            break;
+          case 65786932:
+            if (name == "ECDSA")
+            {
+              return EncryptionAlgorithm::ECDSA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EncryptionAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionAlgorithm(EncryptionAlgorithm enumValue)
+        const char* GetNameForEncryptionAlgorithmCStr(EncryptionAlgorithm enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EncryptionAlgorithm::RSA:
-            return "RSA";
-          case EncryptionAlgorithm::ECDSA:
-            return "ECDSA";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEncryptionAlgorithm(EncryptionAlgorithm enumValue)
+        {
+          return GetNameForEncryptionAlgorithmCStr(enumValue);
         }
 
       } // namespace EncryptionAlgorithmMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace HashAlgorithmMapper
       {
 
-        static const int SHA1_HASH = HashingUtils::HashString("SHA1");
-        static const int SHA256_HASH = HashingUtils::HashString("SHA256");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SHA1",
+          "SHA256",
+        };
 
         HashAlgorithm GetHashAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SHA1_HASH)
-          {
-            return HashAlgorithm::SHA1;
-          }
-          else if (hashCode == SHA256_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return HashAlgorithm::SHA256;
+          case 2543909:
+            if (name == "SHA1")
+            {
+              return HashAlgorithm::SHA1;
+            }
+            break;
+          case -1850268089:
+            if (name == "SHA256")
+            {
+              return HashAlgorithm::SHA256;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return HashAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForHashAlgorithm(HashAlgorithm enumValue)
+        const char* GetNameForHashAlgorithmCStr(HashAlgorithm enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HashAlgorithm::SHA1:
-            return "SHA1";
-          case HashAlgorithm::SHA256:
-            return "SHA256";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHashAlgorithm(HashAlgorithm enumValue)
+        {
+          return GetNameForHashAlgorithmCStr(enumValue);
         }
 
       } // namespace HashAlgorithmMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SigningProfileStatusMapper
       {
 
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Canceled_HASH = HashingUtils::HashString("Canceled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Active",
+          "Canceled",
+        };
 
         SigningProfileStatus GetSigningProfileStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Active_HASH)
-          {
-            return SigningProfileStatus::Active;
-          }
-          else if (hashCode == Canceled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SigningProfileStatus::Canceled;
+          case 1955883814:
+            if (name == "Active")
+            {
+              return SigningProfileStatus::Active;
+            }
+            break;
+          case -58529607:
+            if (name == "Canceled")
+            {
+              return SigningProfileStatus::Canceled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SigningProfileStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSigningProfileStatus(SigningProfileStatus enumValue)
+        const char* GetNameForSigningProfileStatusCStr(SigningProfileStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SigningProfileStatus::Active:
-            return "Active";
-          case SigningProfileStatus::Canceled:
-            return "Canceled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSigningProfileStatus(SigningProfileStatus enumValue)
+        {
+          return GetNameForSigningProfileStatusCStr(enumValue);
         }
 
       } // namespace SigningProfileStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace SigningStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InProgress",
+          "Failed",
+          "Succeeded",
+        };
 
         SigningStatus GetSigningStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
-          {
-            return SigningStatus::InProgress;
-          }
-          else if (hashCode == Failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SigningStatus::Failed;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return SigningStatus::Succeeded;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return SigningStatus::InProgress;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return SigningStatus::Failed;
+            }
+            break;
+          case -1345265087:
+            if (name == "Succeeded")
+            {
+              return SigningStatus::Succeeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return SigningStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSigningStatus(SigningStatus enumValue)
+        const char* GetNameForSigningStatusCStr(SigningStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SigningStatus::InProgress:
-            return "InProgress";
-          case SigningStatus::Failed:
-            return "Failed";
-          case SigningStatus::Succeeded:
-            return "Succeeded";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSigningStatus(SigningStatus enumValue)
+        {
+          return GetNameForSigningStatusCStr(enumValue);
         }
 
       } // namespace SigningStatusMapper
@@ -40,6 +40,11 @@ namespace EventTypeMapper
 AWS_PINPOINTSMSVOICE_API EventType GetEventTypeForName(const Aws::String& name);
 
 AWS_PINPOINTSMSVOICE_API Aws::String GetNameForEventType(EventType value);
+
+/**
+ * Same as GetNameForEventType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_PINPOINTSMSVOICE_API const char* GetNameForEventTypeCStr(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace PinpointSMSVoice
@@ -30,45 +30,72 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int INITIATED_CALL_HASH = HashingUtils::HashString("INITIATED_CALL");
-        static const int RINGING_HASH = HashingUtils::HashString("RINGING");
-        static const int ANSWERED_HASH = HashingUtils::HashString("ANSWERED");
-        static const int COMPLETED_CALL_HASH = HashingUtils::HashString("COMPLETED_CALL");
-        static const int BUSY_HASH = HashingUtils::HashString("BUSY");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int NO_ANSWER_HASH = HashingUtils::HashString("NO_ANSWER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INITIATED_CALL",
+          "RINGING",
+          "ANSWERED",
+          "COMPLETED_CALL",
+          "BUSY",
+          "FAILED",
+          "NO_ANSWER",
+        };
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIATED_CALL_HASH)
-          {
-            return EventType::INITIATED_CALL;
-          }
-          else if (hashCode == RINGING_HASH)
-          {
-            return EventType::RINGING;
-          }
-          else if (hashCode == ANSWERED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EventType::ANSWERED;
-          }
-          else if (hashCode == COMPLETED_CALL_HASH)
-          {
-            return EventType::COMPLETED_CALL;
-          }
-          else if (hashCode == BUSY_HASH)
-          {
-            return EventType::BUSY;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return EventType::FAILED;
-          }
-          else if (hashCode == NO_ANSWER_HASH)
-          {
-            return EventType::NO_ANSWER;
+          case 1082335570:
+            if (name == "INITIATED_CALL")
+            {
+              return EventType::INITIATED_CALL;
+            }
+            break;
+          case 1925008274:
+            if (name == "RINGING")
+            {
+              return EventType::RINGING;
+            }
+            break;
+          case 283067613:
+            if (name == "ANSWERED")
+            {
+              return EventType::ANSWERED;
+            }
+            break;
+          case -587905038:
+            if (name == "COMPLETED_CALL")
+            {
+              return EventType::COMPLETED_CALL;
+            }
+            break;
+          case 2050553:
+            if (name == "BUSY")
+            {
+              return EventType::BUSY;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return EventType::FAILED;
+            }
+            break;
+          case 1344527356:
+            if (name == "NO_ANSWER")
+            {
+              return EventType::NO_ANSWER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventTypeCStr(EventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EventType::INITIATED_CALL:
-            return "INITIATED_CALL";
-          case EventType::RINGING:
-            return "RINGING";
-          case EventType::ANSWERED:
-            return "ANSWERED";
-          case EventType::COMPLETED_CALL:
-            return "COMPLETED_CALL";
-          case EventType::BUSY:
-            return "BUSY";
-          case EventType::FAILED:
-            return "FAILED";
-          case EventType::NO_ANSWER:
-            return "NO_ANSWER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEventType(EventType enumValue)
+        {
+          return GetNameForEventTypeCStr(enumValue);
         }
 
       } // namespace EventTypeMapper
@@ -47,6 +47,11 @@ namespace AppLaunchStatusMapper
 AWS_SMS_API AppLaunchStatus GetAppLaunchStatusForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForAppLaunchStatus(AppLaunchStatus value);
+
+/**
+ * Same as GetNameForAppLaunchStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForAppLaunchStatusCStr(AppLaunchStatus value);
 } // namespace AppLaunchStatusMapper
 } // namespace Model
 } // namespace SMS
@@ -48,6 +48,11 @@ namespace AppReplicationStatusMapper
 AWS_SMS_API AppReplicationStatus GetAppReplicationStatusForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForAppReplicationStatus(AppReplicationStatus value);
+
+/**
+ * Same as GetNameForAppReplicationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForAppReplicationStatusCStr(AppReplicationStatus value);
 } // namespace AppReplicationStatusMapper
 } // namespace Model
 } // namespace SMS
@@ -39,6 +39,11 @@ namespace AppStatusMapper
 AWS_SMS_API AppStatus GetAppStatusForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForAppStatus(AppStatus value);
+
+/**
+ * Same as GetNameForAppStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForAppStatusCStr(AppStatus value);
 } // namespace AppStatusMapper
 } // namespace Model
 } // namespace SMS
@@ -37,6 +37,11 @@ namespace ConnectorCapabilityMapper
 AWS_SMS_API ConnectorCapability GetConnectorCapabilityForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForConnectorCapability(ConnectorCapability value);
+
+/**
+ * Same as GetNameForConnectorCapability(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForConnectorCapabilityCStr(ConnectorCapability value);
 } // namespace ConnectorCapabilityMapper
 } // namespace Model
 } // namespace SMS
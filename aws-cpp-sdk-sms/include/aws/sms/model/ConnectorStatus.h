@@ -35,6 +35,11 @@ namespace ConnectorStatusMapper
 AWS_SMS_API ConnectorStatus GetConnectorStatusForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForConnectorStatus(ConnectorStatus value);
+
+/**
+ * Same as GetNameForConnectorStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForConnectorStatusCStr(ConnectorStatus value);
 } // namespace ConnectorStatusMapper
 } // namespace Model
 } // namespace SMS
@@ -35,6 +35,11 @@ namespace LicenseTypeMapper
 AWS_SMS_API LicenseType GetLicenseTypeForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForLicenseType(LicenseType value);
+
+/**
+ * Same as GetNameForLicenseType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForLicenseTypeCStr(LicenseType value);
 } // namespace LicenseTypeMapper
 } // namespace Model
 } // namespace SMS
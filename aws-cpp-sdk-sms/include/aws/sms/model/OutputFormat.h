@@ -35,6 +35,11 @@ namespace OutputFormatMapper
 AWS_SMS_API OutputFormat GetOutputFormatForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForOutputFormat(OutputFormat value);
+
+/**
+ * Same as GetNameForOutputFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForOutputFormatCStr(OutputFormat value);
 } // namespace OutputFormatMapper
 } // namespace Model
 } // namespace SMS
@@ -41,6 +41,11 @@ namespace ReplicationJobStateMapper
 AWS_SMS_API ReplicationJobState GetReplicationJobStateForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForReplicationJobState(ReplicationJobState value);
+
+/**
+ * Same as GetNameForReplicationJobState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForReplicationJobStateCStr(ReplicationJobState value);
 } // namespace ReplicationJobStateMapper
 } // namespace Model
 } // namespace SMS
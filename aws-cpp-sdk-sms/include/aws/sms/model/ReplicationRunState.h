@@ -40,6 +40,11 @@ namespace ReplicationRunStateMapper
 AWS_SMS_API ReplicationRunState GetReplicationRunStateForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForReplicationRunState(ReplicationRunState value);
+
+/**
+ * Same as GetNameForReplicationRunState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForReplicationRunStateCStr(ReplicationRunState value);
 } // namespace ReplicationRunStateMapper
 } // namespace Model
 } // namespace SMS
@@ -35,6 +35,11 @@ namespace ReplicationRunTypeMapper
 AWS_SMS_API ReplicationRunType GetReplicationRunTypeForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForReplicationRunType(ReplicationRunType value);
+
+/**
+ * Same as GetNameForReplicationRunType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForReplicationRunTypeCStr(ReplicationRunType value);
 } // namespace ReplicationRunTypeMapper
 } // namespace Model
 } // namespace SMS
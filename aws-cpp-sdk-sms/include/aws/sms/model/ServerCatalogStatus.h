@@ -38,6 +38,11 @@ namespace ServerCatalogStatusMapper
 AWS_SMS_API ServerCatalogStatus GetServerCatalogStatusForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForServerCatalogStatus(ServerCatalogStatus value);
+
+/**
+ * Same as GetNameForServerCatalogStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForServerCatalogStatusCStr(ServerCatalogStatus value);
 } // namespace ServerCatalogStatusMapper
 } // namespace Model
 } // namespace SMS
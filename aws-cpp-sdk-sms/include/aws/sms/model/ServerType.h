@@ -34,6 +34,11 @@ namespace ServerTypeMapper
 AWS_SMS_API ServerType GetServerTypeForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForServerType(ServerType value);
+
+/**
+ * Same as GetNameForServerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForServerTypeCStr(ServerType value);
 } // namespace ServerTypeMapper
 } // namespace Model
 } // namespace SMS
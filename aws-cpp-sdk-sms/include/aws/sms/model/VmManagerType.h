@@ -36,6 +36,11 @@ namespace VmManagerTypeMapper
 AWS_SMS_API VmManagerType GetVmManagerTypeForName(const Aws::String& name);
 
 AWS_SMS_API Aws::String GetNameForVmManagerType(VmManagerType value);
+
+/**
+ * Same as GetNameForVmManagerType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SMS_API const char* GetNameForVmManagerTypeCStr(VmManagerType value);
 } // namespace VmManagerTypeMapper
 } // namespace Model
 } // namespace SMS
@@ -30,80 +30,121 @@ namespace Aws
       namespace AppLaunchStatusMapper
       {
 
-        static const int READY_FOR_CONFIGURATION_HASH = HashingUtils::HashString("READY_FOR_CONFIGURATION");
-        static const int CONFIGURATION_IN_PROGRESS_HASH = HashingUtils::HashString("CONFIGURATION_IN_PROGRESS");
-        static const int CONFIGURATION_INVALID_HASH = HashingUtils::HashString("CONFIGURATION_INVALID");
-        static const int READY_FOR_LAUNCH_HASH = HashingUtils::HashString("READY_FOR_LAUNCH");
-        static const int VALIDATION_IN_PROGRESS_HASH = HashingUtils::HashString("VALIDATION_IN_PROGRESS");
-        static const int LAUNCH_PENDING_HASH = HashingUtils::HashString("LAUNCH_PENDING");
-        static const int LAUNCH_IN_PROGRESS_HASH = HashingUtils::HashString("LAUNCH_IN_PROGRESS");
-        static const int LAUNCHED_HASH = HashingUtils::HashString("LAUNCHED");
-        static const int DELTA_LAUNCH_IN_PROGRESS_HASH = HashingUtils::HashString("DELTA_LAUNCH_IN_PROGRESS");
-        static const int DELTA_LAUNCH_FAILED_HASH = HashingUtils::HashString("DELTA_LAUNCH_FAILED");
-        static const int LAUNCH_FAILED_HASH = HashingUtils::HashString("LAUNCH_FAILED");
-        static const int TERMINATE_IN_PROGRESS_HASH = HashingUtils::HashString("TERMINATE_IN_PROGRESS");
-        static const int TERMINATE_FAILED_HASH = HashingUtils::HashString("TERMINATE_FAILED");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "READY_FOR_CONFIGURATION",
+          "CONFIGURATION_IN_PROGRESS",
+          "CONFIGURATION_INVALID",
+          "READY_FOR_LAUNCH",
+          "VALIDATION_IN_PROGRESS",
+          "LAUNCH_PENDING",
+          "LAUNCH_IN_PROGRESS",
+          "LAUNCHED",
+          "DELTA_LAUNCH_IN_PROGRESS",
+          "DELTA_LAUNCH_FAILED",
+          "LAUNCH_FAILED",
+          "TERMINATE_IN_PROGRESS",
+          "TERMINATE_FAILED",
+          "TERMINATED",
+        };
 
         AppLaunchStatus GetAppLaunchStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == READY_FOR_CONFIGURATION_HASH)
-          {
-            return AppLaunchStatus::READY_FOR_CONFIGURATION;
-          }
-          else if (hashCode == CONFIGURATION_IN_PROGRESS_HASH)
-          {
-            return AppLaunchStatus::CONFIGURATION_IN_PROGRESS;
-          }
-          else if (hashCode == CONFIGURATION_INVALID_HASH)
-          {
-            return AppLaunchStatus::CONFIGURATION_INVALID;
-          }
-          else if (hashCode == READY_FOR_LAUNCH_HASH)
-          {
-            return AppLaunchStatus::READY_FOR_LAUNCH;
-          }
-          else if (hashCode == VALIDATION_IN_PROGRESS_HASH)
-          {
-            return AppLaunchStatus::VALIDATION_IN_PROGRESS;
-          }
-          else if (hashCode == LAUNCH_PENDING_HASH)
-          {
-            return AppLaunchStatus::LAUNCH_PENDING;
-          }
-          else if (hashCode == LAUNCH_IN_PROGRESS_HASH)
-          {
-            return AppLaunchStatus::LAUNCH_IN_PROGRESS;
-          }
-          else if (hashCode == LAUNCHED_HASH)
-          {
-            return AppLaunchStatus::LAUNCHED;
-          }
-          else if (hashCode == DELTA_LAUNCH_IN_PROGRESS_HASH)
-          {
-            return AppLaunchStatus::DELTA_LAUNCH_IN_PROGRESS;
-          }
-          else if (hashCode == DELTA_LAUNCH_FAILED_HASH)
-          {
-            return AppLaunchStatus::DELTA_LAUNCH_FAILED;
-          }
-          else if (hashCode == LAUNCH_FAILED_HASH)
-          {
-            return AppLaunchStatus::LAUNCH_FAILED;
-          }
-          else if (hashCode == TERMINATE_IN_PROGRESS_HASH)
-          {
-            return AppLaunchStatus::TERMINATE_IN_PROGRESS;
-          }
-          else if (hashCode == TERMINATE_FAILED_HASH)
-          {
-            return AppLaunchStatus::TERMINATE_FAILED;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return AppLaunchStatus::TERMINATED;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1558305788:
+            if (name == "READY_FOR_CONFIGURATION")
+            {
+              return AppLaunchStatus::READY_FOR_CONFIGURATION;
+            }
+            break;
+          case 191540766:
+            if (name == "CONFIGURATION_IN_PROGRESS")
+            {
+              return AppLaunchStatus::CONFIGURATION_IN_PROGRESS;
+            }
+            break;
+          case 906328942:
+            if (name == "CONFIGURATION_INVALID")
+            {
+              return AppLaunchStatus::CONFIGURATION_INVALID;
+            }
+            break;
+          case 348854341:
+            if (name == "READY_FOR_LAUNCH")
+            {
+              return AppLaunchStatus::READY_FOR_LAUNCH;
+            }
+            break;
+          case 955578689:
+            if (name == "VALIDATION_IN_PROGRESS")
+            {
+              return AppLaunchStatus::VALIDATION_IN_PROGRESS;
+            }
+            break;
+          case -1175818005:
+            if (name == "LAUNCH_PENDING")
+            {
+              return AppLaunchStatus::LAUNCH_PENDING;
+            }
+            break;
+          case 92460411:
+            if (name == "LAUNCH_IN_PROGRESS")
+            {
+              return AppLaunchStatus::LAUNCH_IN_PROGRESS;
+            }
+            break;
+          case -624623726:
+            if (name == "LAUNCHED")
+            {
+              return AppLaunchStatus::LAUNCHED;
+            }
+            break;
+          case 696304002:
+            if (name == "DELTA_LAUNCH_IN_PROGRESS")
+            {
+              return AppLaunchStatus::DELTA_LAUNCH_IN_PROGRESS;
+            }
+            break;
+          case -133539358:
+            if (name == "DELTA_LAUNCH_FAILED")
+            {
+              return AppLaunchStatus::DELTA_LAUNCH_FAILED;
+            }
+            break;
+          case -1020793271:
+            if (name == "LAUNCH_FAILED")
+            {
+              return AppLaunchStatus::LAUNCH_FAILED;
+            }
+            break;
+          case 970336009:
+            if (name == "TERMINATE_IN_PROGRESS")
+            {
+              return AppLaunchStatus::TERMINATE_IN_PROGRESS;
+            }
+            break;
+          case -1422959621:
+            if (name == "TERMINATE_FAILED")
+            {
+              return AppLaunchStatus::TERMINATE_FAILED;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return AppLaunchStatus::TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -115,47 +156,26 @@ namespace Aws
           return AppLaunchStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAppLaunchStatus(AppLaunchStatus enumValue)
+        const char* GetNameForAppLaunchStatusCStr(AppLaunchStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AppLaunchStatus::READY_FOR_CONFIGURATION:
-            return "READY_FOR_CONFIGURATION";
-          case AppLaunchStatus::CONFIGURATION_IN_PROGRESS:
-            return "CONFIGURATION_IN_PROGRESS";
-          case AppLaunchStatus::CONFIGURATION_INVALID:
-            return "CONFIGURATION_INVALID";
-          case AppLaunchStatus::READY_FOR_LAUNCH:
-            return "READY_FOR_LAUNCH";
-          case AppLaunchStatus::VALIDATION_IN_PROGRESS:
-            return "VALIDATION_IN_PROGRESS";
-          case AppLaunchStatus::LAUNCH_PENDING:
-            return "LAUNCH_PENDING";
-          case AppLaunchStatus::LAUNCH_IN_PROGRESS:
-            return "LAUNCH_IN_PROGRESS";
-          case AppLaunchStatus::LAUNCHED:
-            return "LAUNCHED";
-          case AppLaunchStatus::DELTA_LAUNCH_IN_PROGRESS:
-            return "DELTA_LAUNCH_IN_PROGRESS";
-          case AppLaunchStatus::DELTA_LAUNCH_FAILED:
-            return "DELTA_LAUNCH_FAILED";
-          case AppLaunchStatus::LAUNCH_FAILED:
-            return "LAUNCH_FAILED";
-          case AppLaunchStatus::TERMINATE_IN_PROGRESS:
-            return "TERMINATE_IN_PROGRESS";
-          case AppLaunchStatus::TERMINATE_FAILED:
-            return "TERMINATE_FAILED";
-          case AppLaunchStatus::TERMINATED:
-            return "TERMINATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAppLaunchStatus(AppLaunchStatus enumValue)
+        {
+          return GetNameForAppLaunchStatusCStr(enumValue);
         }
 
       } // namespace AppLaunchStatusMapper
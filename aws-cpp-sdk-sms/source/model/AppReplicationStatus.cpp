@@ -30,85 +30,128 @@ namespace Aws
       namespace AppReplicationStatusMapper
       {
 
-        static const int READY_FOR_CONFIGURATION_HASH = HashingUtils::HashString("READY_FOR_CONFIGURATION");
-        static const int CONFIGURATION_IN_PROGRESS_HASH = HashingUtils::HashString("CONFIGURATION_IN_PROGRESS");
-        static const int CONFIGURATION_INVALID_HASH = HashingUtils::HashString("CONFIGURATION_INVALID");
-        static const int READY_FOR_REPLICATION_HASH = HashingUtils::HashString("READY_FOR_REPLICATION");
-        static const int VALIDATION_IN_PROGRESS_HASH = HashingUtils::HashString("VALIDATION_IN_PROGRESS");
-        static const int REPLICATION_PENDING_HASH = HashingUtils::HashString("REPLICATION_PENDING");
-        static const int REPLICATION_IN_PROGRESS_HASH = HashingUtils::HashString("REPLICATION_IN_PROGRESS");
-        static const int REPLICATED_HASH = HashingUtils::HashString("REPLICATED");
-        static const int DELTA_REPLICATION_IN_PROGRESS_HASH = HashingUtils::HashString("DELTA_REPLICATION_IN_PROGRESS");
-        static const int DELTA_REPLICATED_HASH = HashingUtils::HashString("DELTA_REPLICATED");
-        static const int DELTA_REPLICATION_FAILED_HASH = HashingUtils::HashString("DELTA_REPLICATION_FAILED");
-        static const int REPLICATION_FAILED_HASH = HashingUtils::HashString("REPLICATION_FAILED");
-        static const int REPLICATION_STOPPING_HASH = HashingUtils::HashString("REPLICATION_STOPPING");
-        static const int REPLICATION_STOP_FAILED_HASH = HashingUtils::HashString("REPLICATION_STOP_FAILED");
-        static const int REPLICATION_STOPPED_HASH = HashingUtils::HashString("REPLICATION_STOPPED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "READY_FOR_CONFIGURATION",
+          "CONFIGURATION_IN_PROGRESS",
+          "CONFIGURATION_INVALID",
+          "READY_FOR_REPLICATION",
+          "VALIDATION_IN_PROGRESS",
+          "REPLICATION_PENDING",
+          "REPLICATION_IN_PROGRESS",
+          "REPLICATED",
+          "DELTA_REPLICATION_IN_PROGRESS",
+          "DELTA_REPLICATED",
+          "DELTA_REPLICATION_FAILED",
+          "REPLICATION_FAILED",
+          "REPLICATION_STOPPING",
+          "REPLICATION_STOP_FAILED",
+          "REPLICATION_STOPPED",
+        };
 
         AppReplicationStatus GetAppReplicationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == READY_FOR_CONFIGURATION_HASH)
-          {
-            return AppReplicationStatus::READY_FOR_CONFIGURATION;
-          }
-          else if (hashCode == CONFIGURATION_IN_PROGRESS_HASH)
-          {
-            return AppReplicationStatus::CONFIGURATION_IN_PROGRESS;
-          }
-          else if (hashCode == CONFIGURATION_INVALID_HASH)
-          {
-            return AppReplicationStatus::CONFIGURATION_INVALID;
-          }
-          else if (hashCode == READY_FOR_REPLICATION_HASH)
-          {
-            return AppReplicationStatus::READY_FOR_REPLICATION;
-          }
-          else if (hashCode == VALIDATION_IN_PROGRESS_HASH)
-          {
-            return AppReplicationStatus::VALIDATION_IN_PROGRESS;
-          }
-          else if (hashCode == REPLICATION_PENDING_HASH)
-          {
-            return AppReplicationStatus::REPLICATION_PENDING;
-          }
-          else if (hashCode == REPLICATION_IN_PROGRESS_HASH)
-          {
-            return AppReplicationStatus::REPLICATION_IN_PROGRESS;
-          }
-          else if (hashCode == REPLICATED_HASH)
-          {
-            return AppReplicationStatus::REPLICATED;
-          }
-          else if (hashCode == DELTA_REPLICATION_IN_PROGRESS_HASH)
-          {
-            return AppReplicationStatus::DELTA_REPLICATION_IN_PROGRESS;
-          }
-          else if (hashCode == DELTA_REPLICATED_HASH)
-          {
-            return AppReplicationStatus::DELTA_REPLICATED;
-          }
-          else if (hashCode == DELTA_REPLICATION_FAILED_HASH)
-          {
-            return AppReplicationStatus::DELTA_REPLICATION_FAILED;
-          }
-          else if (hashCode == REPLICATION_FAILED_HASH)
-          {
-            return AppReplicationStatus::REPLICATION_FAILED;
-          }
-          else if (hashCode == REPLICATION_STOPPING_HASH)
-          {
-            return AppReplicationStatus::REPLICATION_STOPPING;
-          }
-          else if (hashCode == REPLICATION_STOP_FAILED_HASH)
-          {
-            return AppReplicationStatus::REPLICATION_STOP_FAILED;
-          }
-          else if (hashCode == REPLICATION_STOPPED_HASH)
-          {
-            return AppReplicationStatus::REPLICATION_STOPPED;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1558305788:
+            if (name == "READY_FOR_CONFIGURATION")
+            {
+              return AppReplicationStatus::READY_FOR_CONFIGURATION;
+            }
+            break;
+          case 191540766:
+            if (name == "CONFIGURATION_IN_PROGRESS")
+            {
+              return AppReplicationStatus::CONFIGURATION_IN_PROGRESS;
+            }
+            break;
+          case 906328942:
+            if (name == "CONFIGURATION_INVALID")
+            {
+              return AppReplicationStatus::CONFIGURATION_INVALID;
+            }
+            break;
+          case 1847862874:
+            if (name == "READY_FOR_REPLICATION")
+            {
+              return AppReplicationStatus::READY_FOR_REPLICATION;
+            }
+            break;
+          case 955578689:
+            if (name == "VALIDATION_IN_PROGRESS")
+            {
+              return AppReplicationStatus::VALIDATION_IN_PROGRESS;
+            }
+            break;
+          case 1843063780:
+            if (name == "REPLICATION_PENDING")
+            {
+              return AppReplicationStatus::REPLICATION_PENDING;
+            }
+            break;
+          case 106638324:
+            if (name == "REPLICATION_IN_PROGRESS")
+            {
+              return AppReplicationStatus::REPLICATION_IN_PROGRESS;
+            }
+            break;
+          case -519012261:
+            if (name == "REPLICATED")
+            {
+              return AppReplicationStatus::REPLICATED;
+            }
+            break;
+          case -1675449267:
+            if (name == "DELTA_REPLICATION_IN_PROGRESS")
+            {
+              return AppReplicationStatus::DELTA_REPLICATION_IN_PROGRESS;
+            }
+            break;
+          case -1983749278:
+            if (name == "DELTA_REPLICATED")
+            {
+              return AppReplicationStatus::DELTA_REPLICATED;
+            }
+            break;
+          case -735208393:
+            if (name == "DELTA_REPLICATION_FAILED")
+            {
+              return AppReplicationStatus::DELTA_REPLICATION_FAILED;
+            }
+            break;
+          case -1339051984:
+            if (name == "REPLICATION_FAILED")
+            {
+              return AppReplicationStatus::REPLICATION_FAILED;
+            }
+            break;
+          case -1593532505:
+            if (name == "REPLICATION_STOPPING")
+            {
+              return AppReplicationStatus::REPLICATION_STOPPING;
+            }
+            break;
+          case -323438841:
+            if (name == "REPLICATION_STOP_FAILED")
+            {
+              return AppReplicationStatus::REPLICATION_STOP_FAILED;
+            }
+            break;
+          case 641332250:
+            if (name == "REPLICATION_STOPPED")
+            {
+              return AppReplicationStatus::REPLICATION_STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -120,49 +163,26 @@ namespace Aws
           return AppReplicationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAppReplicationStatus(AppReplicationStatus enumValue)
+        const char* GetNameForAppReplicationStatusCStr(AppReplicationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AppReplicationStatus::READY_FOR_CONFIGURATION:
-            return "READY_FOR_CONFIGURATION";
-          case AppReplicationStatus::CONFIGURATION_IN_PROGRESS:
-            return "CONFIGURATION_IN_PROGRESS";
-          case AppReplicationStatus::CONFIGURATION_INVALID:
-            return "CONFIGURATION_INVALID";
-          case AppReplicationStatus::READY_FOR_REPLICATION:
-            return "READY_FOR_REPLICATION";
-          case AppReplicationStatus::VALIDATION_IN_PROGRESS:
-            return "VALIDATION_IN_PROGRESS";
-          case AppReplicationStatus::REPLICATION_PENDING:
-            return "REPLICATION_PENDING";
-          case AppReplicationStatus::REPLICATION_IN_PROGRESS:
-            return "REPLICATION_IN_PROGRESS";
-          case AppReplicationStatus::REPLICATED:
-            return "REPLICATED";
-          case AppReplicationStatus::DELTA_REPLICATION_IN_PROGRESS:
-            return "DELTA_REPLICATION_IN_PROGRESS";
-          case AppReplicationStatus::DELTA_REPLICATED:
-            return "DELTA_REPLICATED";
-          case AppReplicationStatus::DELTA_REPLICATION_FAILED:
-            return "DELTA_REPLICATION_FAILED";
-          case AppReplicationStatus::REPLICATION_FAILED:
-            return "REPLICATION_FAILED";
-          case AppReplicationStatus::REPLICATION_STOPPING:
-            return "REPLICATION_STOPPING";
-          case AppReplicationStatus::REPLICATION_STOP_FAILED:
-            return "REPLICATION_STOP_FAILED";
-          case AppReplicationStatus::REPLICATION_STOPPED:
-            return "REPLICATION_STOPPED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAppReplicationStatus(AppReplicationStatus enumValue)
+        {
+          return GetNameForAppReplicationStatusCStr(enumValue);
         }
 
       } // namespace AppReplicationStatusMapper
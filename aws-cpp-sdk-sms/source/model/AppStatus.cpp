@@ -30,40 +30,65 @@ namespace Aws
       namespace AppStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int DELETE_FAILED_HASH = HashingUtils::HashString("DELETE_FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CREATING",
+          "ACTIVE",
+          "UPDATING",
+          "DELETING",
+          "DELETED",
+          "DELETE_FAILED",
+        };
 
         AppStatus GetAppStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
-          {
-            return AppStatus::CREATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return AppStatus::ACTIVE;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return AppStatus::UPDATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return AppStatus::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AppStatus::DELETED;
-          }
-          else if (hashCode == DELETE_FAILED_HASH)
-          {
-            return AppStatus::DELETE_FAILED;
+          case -1691918663:
+            if (name == "CREATING")
+            {
+              return AppStatus::CREATING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return AppStatus::ACTIVE;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return AppStatus::UPDATING;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return AppStatus::DELETING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return AppStatus::DELETED;
+            }
+            break;
+          case 1008657745:
+            if (name == "DELETE_FAILED")
+            {
+              return AppStatus::DELETE_FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return AppStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAppStatus(AppStatus enumValue)
+        const char* GetNameForAppStatusCStr(AppStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AppStatus::CREATING:
-            return "CREATING";
-          case AppStatus::ACTIVE:
-            return "ACTIVE";
-          case AppStatus::UPDATING:
-            return "UPDATING";
-          case AppStatus::DELETING:
-            return "DELETING";
-          case AppStatus::DELETED:
-            return "DELETED";
-          case AppStatus::DELETE_FAILED:
-            return "DELETE_FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAppStatus(AppStatus enumValue)
+        {
+          return GetNameForAppStatusCStr(enumValue);
         }
 
       } // namespace AppStatusMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ConnectorCapabilityMapper
       {
 
-        static const int VSPHERE_HASH = HashingUtils::HashString("VSPHERE");
-        static const int SCVMM_HASH = HashingUtils::HashString("SCVMM");
-        static const int HYPERV_MANAGER_HASH = HashingUtils::HashString("HYPERV-MANAGER");
-        static const int SNAPSHOT_BATCHING_HASH = HashingUtils::HashString("SNAPSHOT_BATCHING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VSPHERE",
+          "SCVMM",
+          "HYPERV-MANAGER",
+          "SNAPSHOT_BATCHING",
+        };
 
         ConnectorCapability GetConnectorCapabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VSPHERE_HASH)
-          {
-            return ConnectorCapability::VSPHERE;
-          }
-          else if (hashCode == SCVMM_HASH)
-          {
-            return ConnectorCapability::SCVMM;
-          }
-          else if (hashCode == HYPERV_MANAGER_HASH)
-          {
-            return ConnectorCapability::HYPERV_MANAGER;
-          }
-          else if (hashCode == SNAPSHOT_BATCHING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectorCapability::SNAPSHOT_BATCHING;
+          case 1468220323:
+            if (name == "VSPHERE")
+            {
+              return ConnectorCapability::VSPHERE;
+            }
+            break;
+          case 78733350:
+            if (name == "SCVMM")
+            {
+              return ConnectorCapability::SCVMM;
+            }
+            break;
+          case -1463625654:
+            if (name == "HYPERV-MANAGER")
+            {
+              return ConnectorCapability::HYPERV_MANAGER;
+            }
+            break;
+          case -1346873725:
+            if (name == "SNAPSHOT_BATCHING")
+            {
+              return ConnectorCapability::SNAPSHOT_BATCHING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ConnectorCapability::NOT_SET;
         }
 
-        Aws::String GetNameForConnectorCapability(ConnectorCapability enumValue)
+        const char* GetNameForConnectorCapabilityCStr(ConnectorCapability enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectorCapability::VSPHERE:
-            return "VSPHERE";
-          case ConnectorCapability::SCVMM:
-            return "SCVMM";
-          case ConnectorCapability::HYPERV_MANAGER:
-            return "HYPERV-MANAGER";
-          case ConnectorCapability::SNAPSHOT_BATCHING:
-            return "SNAPSHOT_BATCHING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectorCapability(ConnectorCapability enumValue)
+        {
+          return GetNameForConnectorCapabilityCStr(enumValue);
         }
 
       } // namespace ConnectorCapabilityMapper
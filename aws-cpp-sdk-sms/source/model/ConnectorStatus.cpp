@@ -30,20 +30,37 @@ namespace Aws
       namespace ConnectorStatusMapper
       {
 
-        static const int HEALTHY_HASH = HashingUtils::HashString("HEALTHY");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HEALTHY",
+          "UNHEALTHY",
+        };
 
         ConnectorStatus GetConnectorStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HEALTHY_HASH)
-          {
-            return ConnectorStatus::HEALTHY;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectorStatus::UNHEALTHY;
+          case 1513543037:
+            if (name == "HEALTHY")
+            {
+              return ConnectorStatus::HEALTHY;
+            }
+            break;
+          case 998988996:
+            if (name == "UNHEALTHY")
+            {
+              return ConnectorStatus::UNHEALTHY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ConnectorStatus::NOT_SET;
         }
 
-        Aws::String GetNameForConnectorStatus(ConnectorStatus enumValue)
+        const char* GetNameForConnectorStatusCStr(ConnectorStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectorStatus::HEALTHY:
-            return "HEALTHY";
-          case ConnectorStatus::UNHEALTHY:
-            return "UNHEALTHY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectorStatus(ConnectorStatus enumValue)
+        {
+          return GetNameForConnectorStatusCStr(enumValue);
         }
 
       } // namespace ConnectorStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace LicenseTypeMapper
       {
 
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int BYOL_HASH = HashingUtils::HashString("BYOL");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AWS",
+          "BYOL",
+        };
 
         LicenseType GetLicenseTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_HASH)
-          {
-            return LicenseType::AWS;
-          }
-          else if (hashCode == BYOL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LicenseType::BYOL;
+          case 65245:
+            if (name == "AWS")
+            {
+              return LicenseType::AWS;
+            }
+            break;
+          case 2054260:
+            if (name == "BYOL")
+            {
+              return LicenseType::BYOL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return LicenseType::NOT_SET;
         }
 
-        Aws::String GetNameForLicenseType(LicenseType enumValue)
+        const char* GetNameForLicenseTypeCStr(LicenseType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LicenseType::AWS:
-            return "AWS";
-          case LicenseType::BYOL:
-            return "BYOL";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLicenseType(LicenseType enumValue)
+        {
+          return GetNameForLicenseTypeCStr(enumValue);
         }
 
       } // namespace LicenseTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace OutputFormatMapper
       {
 
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
-        static const int YAML_HASH = HashingUtils::HashString("YAML");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "JSON",
+          "YAML",
+        };
 
         OutputFormat GetOutputFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JSON_HASH)
-          {
-            return OutputFormat::JSON;
-          }
-          else if (hashCode == YAML_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OutputFormat::YAML;
+          case 2286824:
+            if (name == "JSON")
+            {
+              return OutputFormat::JSON;
+            }
+            break;
+          case 2716327:
+            if (name == "YAML")
+            {
+              return OutputFormat::YAML;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OutputFormat::NOT_SET;
         }
 
-        Aws::String GetNameForOutputFormat(OutputFormat enumValue)
+        const char* GetNameForOutputFormatCStr(OutputFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OutputFormat::JSON:
-            return "JSON";
-          case OutputFormat::YAML:
-            return "YAML";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOutputFormat(OutputFormat enumValue)
+        {
+          return GetNameForOutputFormatCStr(enumValue);
         }
 
       } // namespace OutputFormatMapper
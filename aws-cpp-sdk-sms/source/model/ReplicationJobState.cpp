@@ -30,50 +30,79 @@ namespace Aws
       namespace ReplicationJobStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int PAUSED_ON_FAILURE_HASH = HashingUtils::HashString("PAUSED_ON_FAILURE");
-        static const int FAILING_HASH = HashingUtils::HashString("FAILING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "ACTIVE",
+          "FAILED",
+          "DELETING",
+          "DELETED",
+          "COMPLETED",
+          "PAUSED_ON_FAILURE",
+          "FAILING",
+        };
 
         ReplicationJobState GetReplicationJobStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return ReplicationJobState::PENDING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return ReplicationJobState::ACTIVE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ReplicationJobState::FAILED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ReplicationJobState::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ReplicationJobState::DELETED;
-          }
-          else if (hashCode == COMPLETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReplicationJobState::COMPLETED;
-          }
-          else if (hashCode == PAUSED_ON_FAILURE_HASH)
-          {
-            return ReplicationJobState::PAUSED_ON_FAILURE;
-          }
-          else if (hashCode == FAILING_HASH)
-          {
-            return ReplicationJobState::FAILING;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ReplicationJobState::PENDING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ReplicationJobState::ACTIVE;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ReplicationJobState::FAILED;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ReplicationJobState::DELETING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return ReplicationJobState::DELETED;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return ReplicationJobState::COMPLETED;
+            }
+            break;
+          case 660307643:
+            if (name == "PAUSED_ON_FAILURE")
+            {
+              return ReplicationJobState::PAUSED_ON_FAILURE;
+            }
+            break;
+          case -368603164:
+            if (name == "FAILING")
+            {
+              return ReplicationJobState::FAILING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return ReplicationJobState::NOT_SET;
         }
 
-        Aws::String GetNameForReplicationJobState(ReplicationJobState enumValue)
+        const char* GetNameForReplicationJobStateCStr(ReplicationJobState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReplicationJobState::PENDING:
-            return "PENDING";
-          case ReplicationJobState::ACTIVE:
-            return "ACTIVE";
-          case ReplicationJobState::FAILED:
-            return "FAILED";
-          case ReplicationJobState::DELETING:
-            return "DELETING";
-          case ReplicationJobState::DELETED:
-            return "DELETED";
-          case ReplicationJobState::COMPLETED:
-            return "COMPLETED";
-          case ReplicationJobState::PAUSED_ON_FAILURE:
-            return "PAUSED_ON_FAILURE";
-          case ReplicationJobState::FAILING:
-            return "FAILING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReplicationJobState(ReplicationJobState enumValue)
+        {
+          return GetNameForReplicationJobStateCStr(enumValue);
         }
 
       } // namespace ReplicationJobStateMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace ReplicationRunStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int MISSED_HASH = HashingUtils::HashString("MISSED");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "MISSED",
+          "ACTIVE",
+          "FAILED",
+          "COMPLETED",
+          "DELETING",
+          "DELETED",
+        };
 
         ReplicationRunState GetReplicationRunStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return ReplicationRunState::PENDING;
-          }
-          else if (hashCode == MISSED_HASH)
-          {
-            return ReplicationRunState::MISSED;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReplicationRunState::ACTIVE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ReplicationRunState::FAILED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return ReplicationRunState::COMPLETED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ReplicationRunState::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ReplicationRunState::DELETED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ReplicationRunState::PENDING;
+            }
+            break;
+          case -2020551013:
+            if (name == "MISSED")
+            {
+              return ReplicationRunState::MISSED;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ReplicationRunState::ACTIVE;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ReplicationRunState::FAILED;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return ReplicationRunState::COMPLETED;
+            }
+            break;
+          case 1602343848:
+            if (name == "DELETING")
+            {
+              return ReplicationRunState::DELETING;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return ReplicationRunState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return ReplicationRunState::NOT_SET;
         }
 
-        Aws::String GetNameForReplicationRunState(ReplicationRunState enumValue)
+        const char* GetNameForReplicationRunStateCStr(ReplicationRunState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReplicationRunState::PENDING:
-            return "PENDING";
-          case ReplicationRunState::MISSED:
-            return "MISSED";
-          case ReplicationRunState::ACTIVE:
-            return "ACTIVE";
-          case ReplicationRunState::FAILED:
-            return "FAILED";
-          case ReplicationRunState::COMPLETED:
-            return "COMPLETED";
-          case ReplicationRunState::DELETING:
-            return "DELETING";
-          case ReplicationRunState::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReplicationRunState(ReplicationRunState enumValue)
+        {
+          return GetNameForReplicationRunStateCStr(enumValue);
         }
 
       } // namespace ReplicationRunStateMapper
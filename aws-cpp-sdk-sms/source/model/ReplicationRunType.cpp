@@ -30,20 +30,37 @@ namespace Aws
       namespace ReplicationRunTypeMapper
       {
 
-        static const int ON_DEMAND_HASH = HashingUtils::HashString("ON_DEMAND");
-        static const int AUTOMATIC_HASH = HashingUtils::HashString("AUTOMATIC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ON_DEMAND",
+          "AUTOMATIC",
+        };
 
         ReplicationRunType GetReplicationRunTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ON_DEMAND_HASH)
-          {
-            return ReplicationRunType::ON_DEMAND;
-          }
-          else if (hashCode == AUTOMATIC_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ReplicationRunType::AUTOMATIC;
+          case -2128361301:
+            if (name == "ON_DEMAND")
+            {
+              return ReplicationRunType::ON_DEMAND;
+            }
+            break;
+          case 165298699:
+            if (name == "AUTOMATIC")
+            {
+              return ReplicationRunType::AUTOMATIC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ReplicationRunType::NOT_SET;
         }
 
-        Aws::String GetNameForReplicationRunType(ReplicationRunType enumValue)
+        const char* GetNameForReplicationRunTypeCStr(ReplicationRunType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ReplicationRunType::ON_DEMAND:
-            return "ON_DEMAND";
-          case ReplicationRunType::AUTOMATIC:
-            return "AUTOMATIC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForReplicationRunType(ReplicationRunType enumValue)
+        {
+          return GetNameForReplicationRunTypeCStr(enumValue);
         }
 
       } // namespace ReplicationRunTypeMapper
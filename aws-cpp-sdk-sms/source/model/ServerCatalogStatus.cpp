@@ -30,35 +30,58 @@ namespace Aws
       namespace ServerCatalogStatusMapper
       {
 
-        static const int NOT_IMPORTED_HASH = HashingUtils::HashString("NOT_IMPORTED");
-        static const int IMPORTING_HASH = HashingUtils::HashString("IMPORTING");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NOT_IMPORTED",
+          "IMPORTING",
+          "AVAILABLE",
+          "DELETED",
+          "EXPIRED",
+        };
 
         ServerCatalogStatus GetServerCatalogStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_IMPORTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServerCatalogStatus::NOT_IMPORTED;
-          }
-          else if (hashCode == IMPORTING_HASH)
-          {
-            return ServerCatalogStatus::IMPORTING;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return ServerCatalogStatus::AVAILABLE;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ServerCatalogStatus::DELETED;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return ServerCatalogStatus::EXPIRED;
+          case -1918175472:
+            if (name == "NOT_IMPORTED")
+            {
+              return ServerCatalogStatus::NOT_IMPORTED;
+            }
+            break;
+          case -1716890115:
+            if (name == "IMPORTING")
+            {
+              return ServerCatalogStatus::IMPORTING;
+            }
+            break;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return ServerCatalogStatus::AVAILABLE;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return ServerCatalogStatus::DELETED;
+            }
+            break;
+          case -591252731:
+            if (name == "EXPIRED")
+            {
+              return ServerCatalogStatus::EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ServerCatalogStatus::NOT_SET;
         }
 
-        Aws::String GetNameForServerCatalogStatus(ServerCatalogStatus enumValue)
+        const char* GetNameForServerCatalogStatusCStr(ServerCatalogStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServerCatalogStatus::NOT_IMPORTED:
-            return "NOT_IMPORTED";
-          case ServerCatalogStatus::IMPORTING:
-            return "IMPORTING";
-          case ServerCatalogStatus::AVAILABLE:
-            return "AVAILABLE";
-          case ServerCatalogStatus::DELETED:
-            return "DELETED";
-          case ServerCatalogStatus::EXPIRED:
-            return "EXPIRED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServerCatalogStatus(ServerCatalogStatus enumValue)
+        {
+          return GetNameForServerCatalogStatusCStr(enumValue);
         }
 
       } // namespace ServerCatalogStatusMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ServerTypeMapper
       {
 
-        static const int VIRTUAL_MACHINE_HASH = HashingUtils::HashString("VIRTUAL_MACHINE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VIRTUAL_MACHINE",
+        };
 
         ServerType GetServerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VIRTUAL_MACHINE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ServerType::VIRTUAL_MACHINE;
+          case -408353069:
+            if (name == "VIRTUAL_MACHINE")
+            {
+              return ServerType::VIRTUAL_MACHINE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ServerType::NOT_SET;
         }
 
-        Aws::String GetNameForServerType(ServerType enumValue)
+        const char* GetNameForServerTypeCStr(ServerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ServerType::VIRTUAL_MACHINE:
-            return "VIRTUAL_MACHINE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForServerType(ServerType enumValue)
+        {
+          return GetNameForServerTypeCStr(enumValue);
         }
 
       } // namespace ServerTypeMapper
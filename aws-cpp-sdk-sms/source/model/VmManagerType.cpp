@@ -30,25 +30,44 @@ namespace Aws
       namespace VmManagerTypeMapper
       {
 
-        static const int VSPHERE_HASH = HashingUtils::HashString("VSPHERE");
-        static const int SCVMM_HASH = HashingUtils::HashString("SCVMM");
-        static const int HYPERV_MANAGER_HASH = HashingUtils::HashString("HYPERV-MANAGER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VSPHERE",
+          "SCVMM",
+          "HYPERV-MANAGER",
+        };
 
         VmManagerType GetVmManagerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VSPHERE_HASH)
-          {
-            return VmManagerType::VSPHERE;
-          }
-          else if (hashCode == SCVMM_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VmManagerType::SCVMM;
-          }
-          else if (hashCode == HYPERV_MANAGER_HASH)
-          {
-            return VmManagerType::HYPERV_MANAGER;
+          case 1468220323:
+            if (name == "VSPHERE")
+            {
+              return VmManagerType::VSPHERE;
+            }
+            break;
+          case 78733350:
+            if (name == "SCVMM")
+            {
+              return VmManagerType::SCVMM;
+            }
+            break;
+          case -1463625654:
+            if (name == "HYPERV-MANAGER")
+            {
+              return VmManagerType::HYPERV_MANAGER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return VmManagerType::NOT_SET;
         }
 
-        Aws::String GetNameForVmManagerType(VmManagerType enumValue)
+        const char* GetNameForVmManagerTypeCStr(VmManagerType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VmManagerType::VSPHERE:
-            return "VSPHERE";
-          case VmManagerType::SCVMM:
-            return "SCVMM";
-          case VmManagerType::HYPERV_MANAGER:
-            return "HYPERV-MANAGER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVmManagerType(VmManagerType enumValue)
+        {
+          return GetNameForVmManagerTypeCStr(enumValue);
         }
 
       } // namespace VmManagerTypeMapper
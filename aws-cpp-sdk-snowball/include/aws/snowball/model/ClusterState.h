@@ -38,6 +38,11 @@ namespace ClusterStateMapper
 AWS_SNOWBALL_API ClusterState GetClusterStateForName(const Aws::String& name);
 
 AWS_SNOWBALL_API Aws::String GetNameForClusterState(ClusterState value);
+
+/**
+ * Same as GetNameForClusterState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SNOWBALL_API const char* GetNameForClusterStateCStr(ClusterState value);
 } // namespace ClusterStateMapper
 } // namespace Model
 } // namespace Snowball
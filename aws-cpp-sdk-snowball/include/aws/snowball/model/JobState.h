@@ -46,6 +46,11 @@ namespace JobStateMapper
 AWS_SNOWBALL_API JobState GetJobStateForName(const Aws::String& name);
 
 AWS_SNOWBALL_API Aws::String GetNameForJobState(JobState value);
+
+/**
+ * Same as GetNameForJobState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SNOWBALL_API const char* GetNameForJobStateCStr(JobState value);
 } // namespace JobStateMapper
 } // namespace Model
 } // namespace Snowball
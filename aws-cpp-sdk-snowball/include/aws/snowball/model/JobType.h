@@ -36,6 +36,11 @@ namespace JobTypeMapper
 AWS_SNOWBALL_API JobType GetJobTypeForName(const Aws::String& name);
 
 AWS_SNOWBALL_API Aws::String GetNameForJobType(JobType value);
+
+/**
+ * Same as GetNameForJobType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SNOWBALL_API const char* GetNameForJobTypeCStr(JobType value);
 } // namespace JobTypeMapper
 } // namespace Model
 } // namespace Snowball
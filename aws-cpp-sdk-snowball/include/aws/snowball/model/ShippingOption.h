@@ -37,6 +37,11 @@ namespace ShippingOptionMapper
 AWS_SNOWBALL_API ShippingOption GetShippingOptionForName(const Aws::String& name);
 
 AWS_SNOWBALL_API Aws::String GetNameForShippingOption(ShippingOption value);
+
+/**
+ * Same as GetNameForShippingOption(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SNOWBALL_API const char* GetNameForShippingOptionCStr(ShippingOption value);
 } // namespace ShippingOptionMapper
 } // namespace Model
 } // namespace Snowball
@@ -38,6 +38,11 @@ namespace SnowballCapacityMapper
 AWS_SNOWBALL_API SnowballCapacity GetSnowballCapacityForName(const Aws::String& name);
 
 AWS_SNOWBALL_API Aws::String GetNameForSnowballCapacity(SnowballCapacity value);
+
+/**
+ * Same as GetNameForSnowballCapacity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SNOWBALL_API const char* GetNameForSnowballCapacityCStr(SnowballCapacity value);
 } // namespace SnowballCapacityMapper
 } // namespace Model
 } // namespace Snowball
@@ -37,6 +37,11 @@ namespace SnowballTypeMapper
 AWS_SNOWBALL_API SnowballType GetSnowballTypeForName(const Aws::String& name);
 
 AWS_SNOWBALL_API Aws::String GetNameForSnowballType(SnowballType value);
+
+/**
+ * Same as GetNameForSnowballType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SNOWBALL_API const char* GetNameForSnowballTypeCStr(SnowballType value);
 } // namespace SnowballTypeMapper
 } // namespace Model
 } // namespace Snowball
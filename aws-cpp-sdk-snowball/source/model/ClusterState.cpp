@@ -30,35 +30,58 @@ namespace Aws
       namespace ClusterStateMapper
       {
 
-        static const int AwaitingQuorum_HASH = HashingUtils::HashString("AwaitingQuorum");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InUse_HASH = HashingUtils::HashString("InUse");
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AwaitingQuorum",
+          "Pending",
+          "InUse",
+          "Complete",
+          "Cancelled",
+        };
 
         ClusterState GetClusterStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AwaitingQuorum_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ClusterState::AwaitingQuorum;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return ClusterState::Pending;
-          }
-          else if (hashCode == InUse_HASH)
-          {
-            return ClusterState::InUse;
-          }
-          else if (hashCode == Complete_HASH)
-          {
-            return ClusterState::Complete;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return ClusterState::Cancelled;
+          case 837718507:
+            if (name == "AwaitingQuorum")
+            {
+              return ClusterState::AwaitingQuorum;
+            }
+            break;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return ClusterState::Pending;
+            }
+            break;
+          case 70779394:
+            if (name == "InUse")
+            {
+              return ClusterState::InUse;
+            }
+            break;
+          case -534801063:
+            if (name == "Complete")
+            {
+              return ClusterState::Complete;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return ClusterState::Cancelled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ClusterState::NOT_SET;
         }
 
-        Aws::String GetNameForClusterState(ClusterState enumValue)
+        const char* GetNameForClusterStateCStr(ClusterState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ClusterState::AwaitingQuorum:
-            return "AwaitingQuorum";
-          case ClusterState::Pending:
-            return "Pending";
-          case ClusterState::InUse:
-            return "InUse";
-          case ClusterState::Complete:
-            return "Complete";
-          case ClusterState::Cancelled:
-            return "Cancelled";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForClusterState(ClusterState enumValue)
+        {
+          return GetNameForClusterStateCStr(enumValue);
         }
 
       } // namespace ClusterStateMapper
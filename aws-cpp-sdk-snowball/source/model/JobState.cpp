@@ -30,75 +30,114 @@ namespace Aws
       namespace JobStateMapper
       {
 
-        static const int New_HASH = HashingUtils::HashString("New");
-        static const int PreparingAppliance_HASH = HashingUtils::HashString("PreparingAppliance");
-        static const int PreparingShipment_HASH = HashingUtils::HashString("PreparingShipment");
-        static const int InTransitToCustomer_HASH = HashingUtils::HashString("InTransitToCustomer");
-        static const int WithCustomer_HASH = HashingUtils::HashString("WithCustomer");
-        static const int InTransitToAWS_HASH = HashingUtils::HashString("InTransitToAWS");
-        static const int WithAWSSortingFacility_HASH = HashingUtils::HashString("WithAWSSortingFacility");
-        static const int WithAWS_HASH = HashingUtils::HashString("WithAWS");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Listing_HASH = HashingUtils::HashString("Listing");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "New",
+          "PreparingAppliance",
+          "PreparingShipment",
+          "InTransitToCustomer",
+          "WithCustomer",
+          "InTransitToAWS",
+          "WithAWSSortingFacility",
+          "WithAWS",
+          "InProgress",
+          "Complete",
+          "Cancelled",
+          "Listing",
+          "Pending",
+        };
 
         JobState GetJobStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == New_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobState::New;
-          }
-          else if (hashCode == PreparingAppliance_HASH)
-          {
-            return JobState::PreparingAppliance;
-          }
-          else if (hashCode == PreparingShipment_HASH)
-          {
-            return JobState::PreparingShipment;
-          }
-          else if (hashCode == InTransitToCustomer_HASH)
-          {
-            return JobState::InTransitToCustomer;
-          }
-          else if (hashCode == WithCustomer_HASH)
-          {
-            return JobState::WithCustomer;
-          }
-          else if (hashCode == InTransitToAWS_HASH)
-          {
-            return JobState::InTransitToAWS;
-          }
-          else if (hashCode == WithAWSSortingFacility_HASH)
-          {
-            return JobState::WithAWSSortingFacility;
-          }
-          else if (hashCode == WithAWS_HASH)
-          {
-            return JobState::WithAWS;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return JobState::InProgress;
-          }
-          else if (hashCode == Complete_HASH)
-          {
-            return JobState::Complete;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return JobState::Cancelled;
-          }
-          else if (hashCode == Listing_HASH)
-          {
-            return JobState::Listing;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return JobState::Pending;
+          case 78208:
+            if (name == "New")
+            {
+              return JobState::New;
+            }
+            break;
+          case -642416087:
+            if (name == "PreparingAppliance")
+            {
+              return JobState::PreparingAppliance;
+            }
+            break;
+          case 1331484062:
+            if (name == "PreparingShipment")
+            {
+              return JobState::PreparingShipment;
+            }
+            break;
+          case 2122413799:
+            if (name == "InTransitToCustomer")
+            {
+              return JobState::InTransitToCustomer;
+            }
+            break;
+          case -1002650908:
+            if (name == "WithCustomer")
+            {
+              return JobState::WithCustomer;
+            }
+            break;
+          case 625180244:
+            if (name == "InTransitToAWS")
+            {
+              return JobState::InTransitToAWS;
+            }
+            break;
+          case 1888411408:
+            if (name == "WithAWSSortingFacility")
+            {
+              return JobState::WithAWSSortingFacility;
+            }
+            break;
+          case -1275205577:
+            if (name == "WithAWS")
+            {
+              return JobState::WithAWS;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return JobState::InProgress;
+            }
+            break;
+          case -534801063:
+            if (name == "Complete")
+            {
+              return JobState::Complete;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return JobState::Cancelled;
+            }
+            break;
+          case 1846628964:
+            if (name == "Listing")
+            {
+              return JobState::Listing;
+            }
+            break;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return JobState::Pending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,45 +149,26 @@ namespace Aws
           return JobState::NOT_SET;
         }
 
-        Aws::String GetNameForJobState(JobState enumValue)
+        const char* GetNameForJobStateCStr(JobState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobState::New:
-            return "New";
-          case JobState::PreparingAppliance:
-            return "PreparingAppliance";
-          case JobState::PreparingShipment:
-            return "PreparingShipment";
-          case JobState::InTransitToCustomer:
-            return "InTransitToCustomer";
-          case JobState::WithCustomer:
-            return "WithCustomer";
-          case JobState::InTransitToAWS:
-            return "InTransitToAWS";
-          case JobState::WithAWSSortingFacility:
-            return "WithAWSSortingFacility";
-          case JobState::WithAWS:
-            return "WithAWS";
-          case JobState::InProgress:
-            return "InProgress";
-          case JobState::Complete:
-            return "Complete";
-          case JobState::Cancelled:
-            return "Cancelled";
-          case JobState::Listing:
-            return "Listing";
-          case JobState::Pending:
-            return "Pending";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobState(JobState enumValue)
+        {
+          return GetNameForJobStateCStr(enumValue);
         }
 
       } // namespace JobStateMapper
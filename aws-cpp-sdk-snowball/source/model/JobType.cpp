@@ -30,25 +30,44 @@ namespace Aws
       namespace JobTypeMapper
       {
 
-        static const int IMPORT_HASH = HashingUtils::HashString("IMPORT");
-        static const int EXPORT_HASH = HashingUtils::HashString("EXPORT");
-        static const int LOCAL_USE_HASH = HashingUtils::HashString("LOCAL_USE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IMPORT",
+          "EXPORT",
+          "LOCAL_USE",
+        };
 
         JobType GetJobTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IMPORT_HASH)
-          {
-            return JobType::IMPORT;
-          }
-          else if (hashCode == EXPORT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return JobType::EXPORT;
-          }
-          else if (hashCode == LOCAL_USE_HASH)
-          {
-            return JobType::LOCAL_USE;
+          case -2131466331:
+            if (name == "IMPORT")
+            {
+              return JobType::IMPORT;
+            }
+            break;
+          case 2059143092:
+            if (name == "EXPORT")
+            {
+              return JobType::EXPORT;
+            }
+            break;
+          case 1582678643:
+            if (name == "LOCAL_USE")
+            {
+              return JobType::LOCAL_USE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return JobType::NOT_SET;
         }
 
-        Aws::String GetNameForJobType(JobType enumValue)
+        const char* GetNameForJobTypeCStr(JobType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case JobType::IMPORT:
-            return "IMPORT";
-          case JobType::EXPORT:
-            return "EXPORT";
-          case JobType::LOCAL_USE:
-            return "LOCAL_USE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForJobType(JobType enumValue)
+        {
+          return GetNameForJobTypeCStr(enumValue);
         }
 
       } // namespace JobTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ShippingOptionMapper
       {
 
-        static const int SECOND_DAY_HASH = HashingUtils::HashString("SECOND_DAY");
-        static const int NEXT_DAY_HASH = HashingUtils::HashString("NEXT_DAY");
-        static const int EXPRESS_HASH = HashingUtils::HashString("EXPRESS");
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SECOND_DAY",
+          "NEXT_DAY",
+          "EXPRESS",
+          "STANDARD",
+        };
 
         ShippingOption GetShippingOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SECOND_DAY_HASH)
-          {
-            return ShippingOption::SECOND_DAY;
-          }
-          else if (hashCode == NEXT_DAY_HASH)
-          {
-            return ShippingOption::NEXT_DAY;
-          }
-          else if (hashCode == EXPRESS_HASH)
-          {
-            return ShippingOption::EXPRESS;
-          }
-          else if (hashCode == STANDARD_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ShippingOption::STANDARD;
+          case 910234929:
+            if (name == "SECOND_DAY")
+            {
+              return ShippingOption::SECOND_DAY;
+            }
+            break;
+          case -2086664144:
+            if (name == "NEXT_DAY")
+            {
+              return ShippingOption::NEXT_DAY;
+            }
+            break;
+          case -590996656:
+            if (name == "EXPRESS")
+            {
+              return ShippingOption::EXPRESS;
+            }
+            break;
+          case 2095255229:
+            if (name == "STANDARD")
+            {
+              return ShippingOption::STANDARD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ShippingOption::NOT_SET;
         }
 
-        Aws::String GetNameForShippingOption(ShippingOption enumValue)
+        const char* GetNameForShippingOptionCStr(ShippingOption enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ShippingOption::SECOND_DAY:
-            return "SECOND_DAY";
-          case ShippingOption::NEXT_DAY:
-            return "NEXT_DAY";
-          case ShippingOption::EXPRESS:
-            return "EXPRESS";
-          case ShippingOption::STANDARD:
-            return "STANDARD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForShippingOption(ShippingOption enumValue)
+        {
+          return GetNameForShippingOptionCStr(enumValue);
         }
 
       } // namespace ShippingOptionMapper
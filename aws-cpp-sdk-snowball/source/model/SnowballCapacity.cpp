@@ -30,35 +30,58 @@ namespace Aws
       namespace SnowballCapacityMapper
       {
 
-        static const int T50_HASH = HashingUtils::HashString("T50");
-        static const int T80_HASH = HashingUtils::HashString("T80");
-        static const int T100_HASH = HashingUtils::HashString("T100");
-        static const int T42_HASH = HashingUtils::HashString("T42");
-        static const int NoPreference_HASH = HashingUtils::HashString("NoPreference");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "T50",
+          "T80",
+          "T100",
+          "T42",
+          "NoPreference",
+        };
 
         SnowballCapacity GetSnowballCapacityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == T50_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SnowballCapacity::T50;
-          }
-          else if (hashCode == T80_HASH)
-          {
-            return SnowballCapacity::T80;
-          }
-          else if (hashCode == T100_HASH)
-          {
-            return SnowballCapacity::T100;
-          }
-          else if (hashCode == T42_HASH)
-          {
-            return SnowballCapacity::T42;
-          }
-          else if (hashCode == NoPreference_HASH)
-          {
-            return SnowballCapacity::NoPreference;
+          case 82415:
+            if (name == "T50")
+            {
+              return SnowballCapacity::T50;
+            }
+            break;
+          case 82508:
+            if (name == "T80")
+            {
+              return SnowballCapacity::T80;
+            }
+            break;
+          case 2551069:
+            if (name == "T100")
+            {
+              return SnowballCapacity::T100;
+            }
+            break;
+          case 82386:
+            if (name == "T42")
+            {
+              return SnowballCapacity::T42;
+            }
+            break;
+          case 119045532:
+            if (name == "NoPreference")
+            {
+              return SnowballCapacity::NoPreference;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return SnowballCapacity::NOT_SET;
         }
 
-        Aws::String GetNameForSnowballCapacity(SnowballCapacity enumValue)
+        const char* GetNameForSnowballCapacityCStr(SnowballCapacity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SnowballCapacity::T50:
-            return "T50";
-          case SnowballCapacity::T80:
-            return "T80";
-          case SnowballCapacity::T100:
-            return "T100";
-          case SnowballCapacity::T42:
-            return "T42";
-          case SnowballCapacity::NoPreference:
-            return "NoPreference";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSnowballCapacity(SnowballCapacity enumValue)
+        {
+          return GetNameForSnowballCapacityCStr(enumValue);
         }
 
       } // namespace SnowballCapacityMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace SnowballTypeMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int EDGE_HASH = HashingUtils::HashString("EDGE");
-        static const int EDGE_C_HASH = HashingUtils::HashString("EDGE_C");
-        static const int EDGE_CG_HASH = HashingUtils::HashString("EDGE_CG");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "STANDARD",
+          "EDGE",
+          "EDGE_C",
+          "EDGE_CG",
+        };
 
         SnowballType GetSnowballTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
-          {
-            return SnowballType::STANDARD;
-          }
-          else if (hashCode == EDGE_HASH)
-          {
-            return SnowballType::EDGE;
-          }
-          else if (hashCode == EDGE_C_HASH)
-          {
-            return SnowballType::EDGE_C;
-          }
-          else if (hashCode == EDGE_CG_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SnowballType::EDGE_CG;
+          case 2095255229:
+            if (name == "STANDARD")
+            {
+              return SnowballType::STANDARD;
+            }
+            break;
+          case 2123197:
+            if (name == "EDGE")
+            {
+              return SnowballType::EDGE;
+            }
+            break;
+          case 2040395329:
+            if (name == "EDGE_C")
+            {
+              return SnowballType::EDGE_C;
+            }
+            break;
+          case -1172254170:
+            if (name == "EDGE_CG")
+            {
+              return SnowballType::EDGE_CG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return SnowballType::NOT_SET;
         }
 
-        Aws::String GetNameForSnowballType(SnowballType enumValue)
+        const char* GetNameForSnowballTypeCStr(SnowballType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SnowballType::STANDARD:
-            return "STANDARD";
-          case SnowballType::EDGE:
-            return "EDGE";
-          case SnowballType::EDGE_C:
-            return "EDGE_C";
-          case SnowballType::EDGE_CG:
-            return "EDGE_CG";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSnowballType(SnowballType enumValue)
+        {
+          return GetNameForSnowballTypeCStr(enumValue);
         }
 
       } // namespace SnowballTypeMapper
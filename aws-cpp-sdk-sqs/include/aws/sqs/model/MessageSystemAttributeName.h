@@ -40,6 +40,11 @@ namespace MessageSystemAttributeNameMapper
 AWS_SQS_API MessageSystemAttributeName GetMessageSystemAttributeNameForName(const Aws::String& name);
 
 AWS_SQS_API Aws::String GetNameForMessageSystemAttributeName(MessageSystemAttributeName value);
+
+/**
+ * Same as GetNameForMessageSystemAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SQS_API const char* GetNameForMessageSystemAttributeNameCStr(MessageSystemAttributeName value);
 } // namespace MessageSystemAttributeNameMapper
 } // namespace Model
 } // namespace SQS
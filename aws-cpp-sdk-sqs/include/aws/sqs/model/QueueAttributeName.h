@@ -55,6 +55,11 @@ namespace QueueAttributeNameMapper
 AWS_SQS_API QueueAttributeName GetQueueAttributeNameForName(const Aws::String& name);
 
 AWS_SQS_API Aws::String GetNameForQueueAttributeName(QueueAttributeName value);
+
+/**
+ * Same as GetNameForQueueAttributeName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SQS_API const char* GetNameForQueueAttributeNameCStr(QueueAttributeName value);
 } // namespace QueueAttributeNameMapper
 } // namespace Model
 } // namespace SQS
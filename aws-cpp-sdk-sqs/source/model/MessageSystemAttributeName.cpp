@@ -30,45 +30,72 @@ namespace Aws
       namespace MessageSystemAttributeNameMapper
       {
 
-        static const int SenderId_HASH = HashingUtils::HashString("SenderId");
-        static const int SentTimestamp_HASH = HashingUtils::HashString("SentTimestamp");
-        static const int ApproximateReceiveCount_HASH = HashingUtils::HashString("ApproximateReceiveCount");
-        static const int ApproximateFirstReceiveTimestamp_HASH = HashingUtils::HashString("ApproximateFirstReceiveTimestamp");
-        static const int SequenceNumber_HASH = HashingUtils::HashString("SequenceNumber");
-        static const int MessageDeduplicationId_HASH = HashingUtils::HashString("MessageDeduplicationId");
-        static const int MessageGroupId_HASH = HashingUtils::HashString("MessageGroupId");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SenderId",
+          "SentTimestamp",
+          "ApproximateReceiveCount",
+          "ApproximateFirstReceiveTimestamp",
+          "SequenceNumber",
+          "MessageDeduplicationId",
+          "MessageGroupId",
+        };
 
         MessageSystemAttributeName GetMessageSystemAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SenderId_HASH)
-          {
-            return MessageSystemAttributeName::SenderId;
-          }
-          else if (hashCode == SentTimestamp_HASH)
-          {
-            return MessageSystemAttributeName::SentTimestamp;
-          }
-          else if (hashCode == ApproximateReceiveCount_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MessageSystemAttributeName::ApproximateReceiveCount;
-          }
-          else if (hashCode == ApproximateFirstReceiveTimestamp_HASH)
-          {
-            return MessageSystemAttributeName::ApproximateFirstReceiveTimestamp;
-          }
-          else if (hashCode == SequenceNumber_HASH)
-          {
-            return MessageSystemAttributeName::SequenceNumber;
-          }
-          else if (hashCode == MessageDeduplicationId_HASH)
-          {
-            return MessageSystemAttributeName::MessageDeduplicationId;
-          }
-          else if (hashCode == MessageGroupId_HASH)
-          {
-            return MessageSystemAttributeName::MessageGroupId;
+          case 1312607824:
+            if (name == "SenderId")
+            {
+              return MessageSystemAttributeName::SenderId;
+            }
+            break;
+          case -2082950082:
+            if (name == "SentTimestamp")
+            {
+              return MessageSystemAttributeName::SentTimestamp;
+            }
+            break;
+          case 615849216:
+            if (name == "ApproximateReceiveCount")
+            {
+              return MessageSystemAttributeName::ApproximateReceiveCount;
+            }
+            break;
+          case -1682884177:
+            if (name == "ApproximateFirstReceiveTimestamp")
+            {
+              return MessageSystemAttributeName::ApproximateFirstReceiveTimestamp;
+            }
+            break;
+          case 1938978442:
+            if (name == "SequenceNumber")
+            {
+              return MessageSystemAttributeName::SequenceNumber;
+            }
+            break;
+          case 2122107681:
+            if (name == "MessageDeduplicationId")
+            {
+              return MessageSystemAttributeName::MessageDeduplicationId;
+            }
+            break;
+          case 148503059:
+            if (name == "MessageGroupId")
+            {
+              return MessageSystemAttributeName::MessageGroupId;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return MessageSystemAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForMessageSystemAttributeName(MessageSystemAttributeName enumValue)
+        const char* GetNameForMessageSystemAttributeNameCStr(MessageSystemAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MessageSystemAttributeName::SenderId:
-            return "SenderId";
-          case MessageSystemAttributeName::SentTimestamp:
-            return "SentTimestamp";
-          case MessageSystemAttributeName::ApproximateReceiveCount:
-            return "ApproximateReceiveCount";
-          case MessageSystemAttributeName::ApproximateFirstReceiveTimestamp:
-            return "ApproximateFirstReceiveTimestamp";
-          case MessageSystemAttributeName::SequenceNumber:
-            return "SequenceNumber";
-          case MessageSystemAttributeName::MessageDeduplicationId:
-            return "MessageDeduplicationId";
-          case MessageSystemAttributeName::MessageGroupId:
-            return "MessageGroupId";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMessageSystemAttributeName(MessageSystemAttributeName enumValue)
+        {
+          return GetNameForMessageSystemAttributeNameCStr(enumValue);
         }
 
       } // namespace MessageSystemAttributeNameMapper
@@ -30,120 +30,177 @@ namespace Aws
       namespace QueueAttributeNameMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int Policy_HASH = HashingUtils::HashString("Policy");
-        static const int VisibilityTimeout_HASH = HashingUtils::HashString("VisibilityTimeout");
-        static const int MaximumMessageSize_HASH = HashingUtils::HashString("MaximumMessageSize");
-        static const int MessageRetentionPeriod_HASH = HashingUtils::HashString("MessageRetentionPeriod");
-        static const int ApproximateNumberOfMessages_HASH = HashingUtils::HashString("ApproximateNumberOfMessages");
-        static const int ApproximateNumberOfMessagesNotVisible_HASH = HashingUtils::HashString("ApproximateNumberOfMessagesNotVisible");
-        static const int CreatedTimestamp_HASH = HashingUtils::HashString("CreatedTimestamp");
-        static const int LastModifiedTimestamp_HASH = HashingUtils::HashString("LastModifiedTimestamp");
-        static const int QueueArn_HASH = HashingUtils::HashString("QueueArn");
-        static const int ApproximateNumberOfMessagesDelayed_HASH = HashingUtils::HashString("ApproximateNumberOfMessagesDelayed");
-        static const int DelaySeconds_HASH = HashingUtils::HashString("DelaySeconds");
-        static const int ReceiveMessageWaitTimeSeconds_HASH = HashingUtils::HashString("ReceiveMessageWaitTimeSeconds");
-        static const int RedrivePolicy_HASH = HashingUtils::HashString("RedrivePolicy");
-        static const int FifoQueue_HASH = HashingUtils::HashString("FifoQueue");
-        static const int ContentBasedDeduplication_HASH = HashingUtils::HashString("ContentBasedDeduplication");
-        static const int KmsMasterKeyId_HASH = HashingUtils::HashString("KmsMasterKeyId");
-        static const int KmsDataKeyReusePeriodSeconds_HASH = HashingUtils::HashString("KmsDataKeyReusePeriodSeconds");
-        static const int SentTimestamp_HASH = HashingUtils::HashString("SentTimestamp");
-        static const int ApproximateFirstReceiveTimestamp_HASH = HashingUtils::HashString("ApproximateFirstReceiveTimestamp");
-        static const int ApproximateReceiveCount_HASH = HashingUtils::HashString("ApproximateReceiveCount");
-        static const int SenderId_HASH = HashingUtils::HashString("SenderId");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "All",
+          "Policy",
+          "VisibilityTimeout",
+          "MaximumMessageSize",
+          "MessageRetentionPeriod",
+          "ApproximateNumberOfMessages",
+          "ApproximateNumberOfMessagesNotVisible",
+          "CreatedTimestamp",
+          "LastModifiedTimestamp",
+          "QueueArn",
+          "ApproximateNumberOfMessagesDelayed",
+          "DelaySeconds",
+          "ReceiveMessageWaitTimeSeconds",
+          "RedrivePolicy",
+          "FifoQueue",
+          "ContentBasedDeduplication",
+          "KmsMasterKeyId",
+          "KmsDataKeyReusePeriodSeconds",
+          "SentTimestamp",
+          "ApproximateFirstReceiveTimestamp",
+          "ApproximateReceiveCount",
+          "SenderId",
+        };
 
         QueueAttributeName GetQueueAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
-          {
-            return QueueAttributeName::All;
-          }
-          else if (hashCode == Policy_HASH)
-          {
-            return QueueAttributeName::Policy;
-          }
-          else if (hashCode == VisibilityTimeout_HASH)
-          {
-            return QueueAttributeName::VisibilityTimeout;
-          }
-          else if (hashCode == MaximumMessageSize_HASH)
-          {
-            return QueueAttributeName::MaximumMessageSize;
-          }
-          else if (hashCode == MessageRetentionPeriod_HASH)
-          {
-            return QueueAttributeName::MessageRetentionPeriod;
-          }
-          else if (hashCode == ApproximateNumberOfMessages_HASH)
-          {
-            return QueueAttributeName::ApproximateNumberOfMessages;
-          }
-          else if (hashCode == ApproximateNumberOfMessagesNotVisible_HASH)
-          {
-            return QueueAttributeName::ApproximateNumberOfMessagesNotVisible;
-          }
-          else if (hashCode == CreatedTimestamp_HASH)
-          {
-            return QueueAttributeName::CreatedTimestamp;
-          }
-          else if (hashCode == LastModifiedTimestamp_HASH)
-          {
-            return QueueAttributeName::LastModifiedTimestamp;
-          }
-          else if (hashCode == QueueArn_HASH)
-          {
-            return QueueAttributeName::QueueArn;
-          }
-          else if (hashCode == ApproximateNumberOfMessagesDelayed_HASH)
-          {
-            return QueueAttributeName::ApproximateNumberOfMessagesDelayed;
-          }
-          else if (hashCode == DelaySeconds_HASH)
-          {
-            return QueueAttributeName::DelaySeconds;
-          }
-          else if (hashCode == ReceiveMessageWaitTimeSeconds_HASH)
-          {
-            return QueueAttributeName::ReceiveMessageWaitTimeSeconds;
-          }
-          else if (hashCode == RedrivePolicy_HASH)
-          {
-            return QueueAttributeName::RedrivePolicy;
-          }
-          else if (hashCode == FifoQueue_HASH)
-          {
-            return QueueAttributeName::FifoQueue;
-          }
-          else if (hashCode == ContentBasedDeduplication_HASH)
-          {
-            return QueueAttributeName::ContentBasedDeduplication;
-          }
-          else if (hashCode == KmsMasterKeyId_HASH)
-          {
-            return QueueAttributeName::KmsMasterKeyId;
-          }
-          else if (hashCode == KmsDataKeyReusePeriodSeconds_HASH)
-          {
-            return QueueAttributeName::KmsDataKeyReusePeriodSeconds;
-          }
-          else if (hashCode == SentTimestamp_HASH)
-          {
-            return QueueAttributeName::SentTimestamp;
-          }
-          else if (hashCode == ApproximateFirstReceiveTimestamp_HASH)
-          {
-            return QueueAttributeName::ApproximateFirstReceiveTimestamp;
-          }
-          else if (hashCode == ApproximateReceiveCount_HASH)
-          {
-            return QueueAttributeName::ApproximateReceiveCount;
-          }
-          else if (hashCode == SenderId_HASH)
-          {
-            return QueueAttributeName::SenderId;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 65921:
+            if (name == "All")
+            {
+              return QueueAttributeName::All;
+            }
+            break;
+          case -1898802862:
+            if (name == "Policy")
+            {
+              return QueueAttributeName::Policy;
+            }
+            break;
+          case 1969588687:
+            if (name == "VisibilityTimeout")
+            {
+              return QueueAttributeName::VisibilityTimeout;
+            }
+            break;
+          case -353398136:
+            if (name == "MaximumMessageSize")
+            {
+              return QueueAttributeName::MaximumMessageSize;
+            }
+            break;
+          case -1632737384:
+            if (name == "MessageRetentionPeriod")
+            {
+              return QueueAttributeName::MessageRetentionPeriod;
+            }
+            break;
+          case 1014811520:
+            if (name == "ApproximateNumberOfMessages")
+            {
+              return QueueAttributeName::ApproximateNumberOfMessages;
+            }
+            break;
+          case -424418881:
+            if (name == "ApproximateNumberOfMessagesNotVisible")
+            {
+              return QueueAttributeName::ApproximateNumberOfMessagesNotVisible;
+            }
+            break;
+          case -1423092946:
+            if (name == "CreatedTimestamp")
+            {
+              return QueueAttributeName::CreatedTimestamp;
+            }
+            break;
+          case -1675946953:
+            if (name == "LastModifiedTimestamp")
+            {
+              return QueueAttributeName::LastModifiedTimestamp;
+            }
+            break;
+          case -1099864148:
+            if (name == "QueueArn")
+            {
+              return QueueAttributeName::QueueArn;
+            }
+            break;
+          case 1053838786:
+            if (name == "ApproximateNumberOfMessagesDelayed")
+            {
+              return QueueAttributeName::ApproximateNumberOfMessagesDelayed;
+            }
+            break;
+          case -127380580:
+            if (name == "DelaySeconds")
+            {
+              return QueueAttributeName::DelaySeconds;
+            }
+            break;
+          case 148571609:
+            if (name == "ReceiveMessageWaitTimeSeconds")
+            {
+              return QueueAttributeName::ReceiveMessageWaitTimeSeconds;
+            }
+            break;
+          case -2137215191:
+            if (name == "RedrivePolicy")
+            {
+              return QueueAttributeName::RedrivePolicy;
+            }
+            break;
+          case -68979835:
+            if (name == "FifoQueue")
+            {
+              return QueueAttributeName::FifoQueue;
+            }
+            break;
+          case -374745261:
+            if (name == "ContentBasedDeduplication")
+            {
+              return QueueAttributeName::ContentBasedDeduplication;
+            }
+            break;
+          case -643602777:
+            if (name == "KmsMasterKeyId")
+            {
+              return QueueAttributeName::KmsMasterKeyId;
+            }
+            break;
+          case 1726322798:
+            if (name == "KmsDataKeyReusePeriodSeconds")
+            {
+              return QueueAttributeName::KmsDataKeyReusePeriodSeconds;
+            }
+            break;
+          case -2082950082:
+            if (name == "SentTimestamp")
+            {
+              return QueueAttributeName::SentTimestamp;
+            }
+            break;
+          case -1682884177:
+            if (name == "ApproximateFirstReceiveTimestamp")
+            {
+              return QueueAttributeName::ApproximateFirstReceiveTimestamp;
+            }
+            break;
+          case 615849216:
+            if (name == "ApproximateReceiveCount")
+            {
+              return QueueAttributeName::ApproximateReceiveCount;
+            }
+            break;
+          case 1312607824:
+            if (name == "SenderId")
+            {
+              return QueueAttributeName::SenderId;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -155,63 +212,26 @@ namespace Aws
           return QueueAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForQueueAttributeName(QueueAttributeName enumValue)
+        const char* GetNameForQueueAttributeNameCStr(QueueAttributeName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case QueueAttributeName::All:
-            return "All";
-          case QueueAttributeName::Policy:
-            return "Policy";
-          case QueueAttributeName::VisibilityTimeout:
-            return "VisibilityTimeout";
-          case QueueAttributeName::MaximumMessageSize:
-            return "MaximumMessageSize";
-          case QueueAttributeName::MessageRetentionPeriod:
-            return "MessageRetentionPeriod";
-          case QueueAttributeName::ApproximateNumberOfMessages:
-            return "ApproximateNumberOfMessages";
-          case QueueAttributeName::ApproximateNumberOfMessagesNotVisible:
-            return "ApproximateNumberOfMessagesNotVisible";
-          case QueueAttributeName::CreatedTimestamp:
-            return "CreatedTimestamp";
-          case QueueAttributeName::LastModifiedTimestamp:
-            return "LastModifiedTimestamp";
-          case QueueAttributeName::QueueArn:
-            return "QueueArn";
-          case QueueAttributeName::ApproximateNumberOfMessagesDelayed:
-            return "ApproximateNumberOfMessagesDelayed";
-          case QueueAttributeName::DelaySeconds:
-            return "DelaySeconds";
-          case QueueAttributeName::ReceiveMessageWaitTimeSeconds:
-            return "ReceiveMessageWaitTimeSeconds";
-          case QueueAttributeName::RedrivePolicy:
-            return "RedrivePolicy";
-          case QueueAttributeName::FifoQueue:
-            return "FifoQueue";
-          case QueueAttributeName::ContentBasedDeduplication:
-            return "ContentBasedDeduplication";
-          case QueueAttributeName::KmsMasterKeyId:
-            return "KmsMasterKeyId";
-          case QueueAttributeName::KmsDataKeyReusePeriodSeconds:
-            return "KmsDataKeyReusePeriodSeconds";
-          case QueueAttributeName::SentTimestamp:
-            return "SentTimestamp";
-          case QueueAttributeName::ApproximateFirstReceiveTimestamp:
-            return "ApproximateFirstReceiveTimestamp";
-          case QueueAttributeName::ApproximateReceiveCount:
-            return "ApproximateReceiveCount";
-          case QueueAttributeName::SenderId:
-            return "SenderId";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForQueueAttributeName(QueueAttributeName enumValue)
+        {
+          return GetNameForQueueAttributeNameCStr(enumValue);
         }
 
       } // namespace QueueAttributeNameMapper
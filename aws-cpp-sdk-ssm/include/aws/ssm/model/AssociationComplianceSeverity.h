@@ -38,6 +38,11 @@ namespace AssociationComplianceSeverityMapper
 AWS_SSM_API AssociationComplianceSeverity GetAssociationComplianceSeverityForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForAssociationComplianceSeverity(AssociationComplianceSeverity value);
+
+/**
+ * Same as GetNameForAssociationComplianceSeverity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForAssociationComplianceSeverityCStr(AssociationComplianceSeverity value);
 } // namespace AssociationComplianceSeverityMapper
 } // namespace Model
 } // namespace SSM
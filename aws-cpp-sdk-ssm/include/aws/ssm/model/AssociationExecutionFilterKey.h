@@ -36,6 +36,11 @@ namespace AssociationExecutionFilterKeyMapper
 AWS_SSM_API AssociationExecutionFilterKey GetAssociationExecutionFilterKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForAssociationExecutionFilterKey(AssociationExecutionFilterKey value);
+
+/**
+ * Same as GetNameForAssociationExecutionFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForAssociationExecutionFilterKeyCStr(AssociationExecutionFilterKey value);
 } // namespace AssociationExecutionFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -36,6 +36,11 @@ namespace AssociationExecutionTargetsFilterKeyMapper
 AWS_SSM_API AssociationExecutionTargetsFilterKey GetAssociationExecutionTargetsFilterKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForAssociationExecutionTargetsFilterKey(AssociationExecutionTargetsFilterKey value);
+
+/**
+ * Same as GetNameForAssociationExecutionTargetsFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForAssociationExecutionTargetsFilterKeyCStr(AssociationExecutionTargetsFilterKey value);
 } // namespace AssociationExecutionTargetsFilterKeyMapper
 } // namespace Model
 } // namespace SSM
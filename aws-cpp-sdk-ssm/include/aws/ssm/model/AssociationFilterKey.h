@@ -40,6 +40,11 @@ namespace AssociationFilterKeyMapper
 AWS_SSM_API AssociationFilterKey GetAssociationFilterKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForAssociationFilterKey(AssociationFilterKey value);
+
+/**
+ * Same as GetNameForAssociationFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForAssociationFilterKeyCStr(AssociationFilterKey value);
 } // namespace AssociationFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -36,6 +36,11 @@ namespace AssociationFilterOperatorTypeMapper
 AWS_SSM_API AssociationFilterOperatorType GetAssociationFilterOperatorTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForAssociationFilterOperatorType(AssociationFilterOperatorType value);
+
+/**
+ * Same as GetNameForAssociationFilterOperatorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForAssociationFilterOperatorTypeCStr(AssociationFilterOperatorType value);
 } // namespace AssociationFilterOperatorTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -36,6 +36,11 @@ namespace AssociationStatusNameMapper
 AWS_SSM_API AssociationStatusName GetAssociationStatusNameForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForAssociationStatusName(AssociationStatusName value);
+
+/**
+ * Same as GetNameForAssociationStatusName(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForAssociationStatusNameCStr(AssociationStatusName value);
 } // namespace AssociationStatusNameMapper
 } // namespace Model
 } // namespace SSM
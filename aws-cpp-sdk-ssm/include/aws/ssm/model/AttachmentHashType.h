@@ -34,6 +34,11 @@ namespace AttachmentHashTypeMapper
 AWS_SSM_API AttachmentHashType GetAttachmentHashTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForAttachmentHashType(AttachmentHashType value);
+
+/**
+ * Same as GetNameForAttachmentHashType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForAttachmentHashTypeCStr(AttachmentHashType value);
 } // namespace AttachmentHashTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -34,6 +34,11 @@ namespace AttachmentsSourceKeyMapper
 AWS_SSM_API AttachmentsSourceKey GetAttachmentsSourceKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForAttachmentsSourceKey(AttachmentsSourceKey value);
+
+/**
+ * Same as GetNameForAttachmentsSourceKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForAttachmentsSourceKeyCStr(AttachmentsSourceKey value);
 } // namespace AttachmentsSourceKeyMapper
 } // namespace Model
 } // namespace SSM
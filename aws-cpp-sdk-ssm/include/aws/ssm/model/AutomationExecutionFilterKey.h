@@ -41,6 +41,11 @@ namespace AutomationExecutionFilterKeyMapper
 AWS_SSM_API AutomationExecutionFilterKey GetAutomationExecutionFilterKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForAutomationExecutionFilterKey(AutomationExecutionFilterKey value);
+
+/**
+ * Same as GetNameForAutomationExecutionFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForAutomationExecutionFilterKeyCStr(AutomationExecutionFilterKey value);
 } // namespace AutomationExecutionFilterKeyMapper
 } // namespace Model
 } // namespace SSM
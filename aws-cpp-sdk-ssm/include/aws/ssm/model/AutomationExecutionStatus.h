@@ -41,6 +41,11 @@ namespace AutomationExecutionStatusMapper
 AWS_SSM_API AutomationExecutionStatus GetAutomationExecutionStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForAutomationExecutionStatus(AutomationExecutionStatus value);
+
+/**
+ * Same as GetNameForAutomationExecutionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForAutomationExecutionStatusCStr(AutomationExecutionStatus value);
 } // namespace AutomationExecutionStatusMapper
 } // namespace Model
 } // namespace SSM
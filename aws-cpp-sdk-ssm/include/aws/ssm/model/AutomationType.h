@@ -35,6 +35,11 @@ namespace AutomationTypeMapper
 AWS_SSM_API AutomationType GetAutomationTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForAutomationType(AutomationType value);
+
+/**
+ * Same as GetNameForAutomationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForAutomationTypeCStr(AutomationType value);
 } // namespace AutomationTypeMapper
 } // namespace Model
 } // namespace SSM
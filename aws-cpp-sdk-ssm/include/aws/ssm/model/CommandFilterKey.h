@@ -38,6 +38,11 @@ namespace CommandFilterKeyMapper
 AWS_SSM_API CommandFilterKey GetCommandFilterKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForCommandFilterKey(CommandFilterKey value);
+
+/**
+ * Same as GetNameForCommandFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForCommandFilterKeyCStr(CommandFilterKey value);
 } // namespace CommandFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -41,6 +41,11 @@ namespace CommandInvocationStatusMapper
 AWS_SSM_API CommandInvocationStatus GetCommandInvocationStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForCommandInvocationStatus(CommandInvocationStatus value);
+
+/**
+ * Same as GetNameForCommandInvocationStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForCommandInvocationStatusCStr(CommandInvocationStatus value);
 } // namespace CommandInvocationStatusMapper
 } // namespace Model
 } // namespace SSM
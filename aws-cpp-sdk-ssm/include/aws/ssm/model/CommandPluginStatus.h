@@ -39,6 +39,11 @@ namespace CommandPluginStatusMapper
 AWS_SSM_API CommandPluginStatus GetCommandPluginStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForCommandPluginStatus(CommandPluginStatus value);
+
+/**
+ * Same as GetNameForCommandPluginStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForCommandPluginStatusCStr(CommandPluginStatus value);
 } // namespace CommandPluginStatusMapper
 } // namespace Model
 } // namespace SSM
@@ -40,6 +40,11 @@ namespace CommandStatusMapper
 AWS_SSM_API CommandStatus GetCommandStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForCommandStatus(CommandStatus value);
+
+/**
+ * Same as GetNameForCommandStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForCommandStatusCStr(CommandStatus value);
 } // namespace CommandStatusMapper
 } // namespace Model
 } // namespace SSM
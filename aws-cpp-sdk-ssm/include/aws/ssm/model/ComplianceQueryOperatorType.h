@@ -38,6 +38,11 @@ namespace ComplianceQueryOperatorTypeMapper
 AWS_SSM_API ComplianceQueryOperatorType GetComplianceQueryOperatorTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForComplianceQueryOperatorType(ComplianceQueryOperatorType value);
+
+/**
+ * Same as GetNameForComplianceQueryOperatorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForComplianceQueryOperatorTypeCStr(ComplianceQueryOperatorType value);
 } // namespace ComplianceQueryOperatorTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -39,6 +39,11 @@ namespace ComplianceSeverityMapper
 AWS_SSM_API ComplianceSeverity GetComplianceSeverityForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForComplianceSeverity(ComplianceSeverity value);
+
+/**
+ * Same as GetNameForComplianceSeverity(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForComplianceSeverityCStr(ComplianceSeverity value);
 } // namespace ComplianceSeverityMapper
 } // namespace Model
 } // namespace SSM
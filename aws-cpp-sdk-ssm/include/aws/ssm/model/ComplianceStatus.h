@@ -35,6 +35,11 @@ namespace ComplianceStatusMapper
 AWS_SSM_API ComplianceStatus GetComplianceStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForComplianceStatus(ComplianceStatus value);
+
+/**
+ * Same as GetNameForComplianceStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForComplianceStatusCStr(ComplianceStatus value);
 } // namespace ComplianceStatusMapper
 } // namespace Model
 } // namespace SSM
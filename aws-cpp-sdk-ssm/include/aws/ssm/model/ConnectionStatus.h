@@ -35,6 +35,11 @@ namespace ConnectionStatusMapper
 AWS_SSM_API ConnectionStatus GetConnectionStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForConnectionStatus(ConnectionStatus value);
+
+/**
+ * Same as GetNameForConnectionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForConnectionStatusCStr(ConnectionStatus value);
 } // namespace ConnectionStatusMapper
 } // namespace Model
 } // namespace SSM
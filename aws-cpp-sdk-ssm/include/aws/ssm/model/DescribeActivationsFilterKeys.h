@@ -36,6 +36,11 @@ namespace DescribeActivationsFilterKeysMapper
 AWS_SSM_API DescribeActivationsFilterKeys GetDescribeActivationsFilterKeysForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForDescribeActivationsFilterKeys(DescribeActivationsFilterKeys value);
+
+/**
+ * Same as GetNameForDescribeActivationsFilterKeys(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForDescribeActivationsFilterKeysCStr(DescribeActivationsFilterKeys value);
 } // namespace DescribeActivationsFilterKeysMapper
 } // namespace Model
 } // namespace SSM
@@ -37,6 +37,11 @@ namespace DocumentFilterKeyMapper
 AWS_SSM_API DocumentFilterKey GetDocumentFilterKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForDocumentFilterKey(DocumentFilterKey value);
+
+/**
+ * Same as GetNameForDocumentFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForDocumentFilterKeyCStr(DocumentFilterKey value);
 } // namespace DocumentFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -35,6 +35,11 @@ namespace DocumentFormatMapper
 AWS_SSM_API DocumentFormat GetDocumentFormatForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForDocumentFormat(DocumentFormat value);
+
+/**
+ * Same as GetNameForDocumentFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForDocumentFormatCStr(DocumentFormat value);
 } // namespace DocumentFormatMapper
 } // namespace Model
 } // namespace SSM
@@ -35,6 +35,11 @@ namespace DocumentHashTypeMapper
 AWS_SSM_API DocumentHashType GetDocumentHashTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForDocumentHashType(DocumentHashType value);
+
+/**
+ * Same as GetNameForDocumentHashType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForDocumentHashTypeCStr(DocumentHashType value);
 } // namespace DocumentHashTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -35,6 +35,11 @@ namespace DocumentParameterTypeMapper
 AWS_SSM_API DocumentParameterType GetDocumentParameterTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForDocumentParameterType(DocumentParameterType value);
+
+/**
+ * Same as GetNameForDocumentParameterType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForDocumentParameterTypeCStr(DocumentParameterType value);
 } // namespace DocumentParameterTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -34,6 +34,11 @@ namespace DocumentPermissionTypeMapper
 AWS_SSM_API DocumentPermissionType GetDocumentPermissionTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForDocumentPermissionType(DocumentPermissionType value);
+
+/**
+ * Same as GetNameForDocumentPermissionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForDocumentPermissionTypeCStr(DocumentPermissionType value);
 } // namespace DocumentPermissionTypeMapper
 } // namespace Model
 } // namespace SSM
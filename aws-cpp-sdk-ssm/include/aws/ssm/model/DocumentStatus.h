@@ -38,6 +38,11 @@ namespace DocumentStatusMapper
 AWS_SSM_API DocumentStatus GetDocumentStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForDocumentStatus(DocumentStatus value);
+
+/**
+ * Same as GetNameForDocumentStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForDocumentStatusCStr(DocumentStatus value);
 } // namespace DocumentStatusMapper
 } // namespace Model
 } // namespace SSM
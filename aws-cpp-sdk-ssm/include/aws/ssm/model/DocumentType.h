@@ -38,6 +38,11 @@ namespace DocumentTypeMapper
 AWS_SSM_API DocumentType GetDocumentTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForDocumentType(DocumentType value);
+
+/**
+ * Same as GetNameForDocumentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForDocumentTypeCStr(DocumentType value);
 } // namespace DocumentTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -35,6 +35,11 @@ namespace ExecutionModeMapper
 AWS_SSM_API ExecutionMode GetExecutionModeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForExecutionMode(ExecutionMode value);
+
+/**
+ * Same as GetNameForExecutionMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForExecutionModeCStr(ExecutionMode value);
 } // namespace ExecutionModeMapper
 } // namespace Model
 } // namespace SSM
@@ -36,6 +36,11 @@ namespace FaultMapper
 AWS_SSM_API Fault GetFaultForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForFault(Fault value);
+
+/**
+ * Same as GetNameForFault(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForFaultCStr(Fault value);
 } // namespace FaultMapper
 } // namespace Model
 } // namespace SSM
@@ -41,6 +41,11 @@ namespace InstanceInformationFilterKeyMapper
 AWS_SSM_API InstanceInformationFilterKey GetInstanceInformationFilterKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForInstanceInformationFilterKey(InstanceInformationFilterKey value);
+
+/**
+ * Same as GetNameForInstanceInformationFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForInstanceInformationFilterKeyCStr(InstanceInformationFilterKey value);
 } // namespace InstanceInformationFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -37,6 +37,11 @@ namespace InstancePatchStateOperatorTypeMapper
 AWS_SSM_API InstancePatchStateOperatorType GetInstancePatchStateOperatorTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForInstancePatchStateOperatorType(InstancePatchStateOperatorType value);
+
+/**
+ * Same as GetNameForInstancePatchStateOperatorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForInstancePatchStateOperatorTypeCStr(InstancePatchStateOperatorType value);
 } // namespace InstancePatchStateOperatorTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -35,6 +35,11 @@ namespace InventoryAttributeDataTypeMapper
 AWS_SSM_API InventoryAttributeDataType GetInventoryAttributeDataTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForInventoryAttributeDataType(InventoryAttributeDataType value);
+
+/**
+ * Same as GetNameForInventoryAttributeDataType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForInventoryAttributeDataTypeCStr(InventoryAttributeDataType value);
 } // namespace InventoryAttributeDataTypeMapper
 } // namespace Model
 } // namespace SSM
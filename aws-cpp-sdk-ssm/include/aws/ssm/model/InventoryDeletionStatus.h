@@ -35,6 +35,11 @@ namespace InventoryDeletionStatusMapper
 AWS_SSM_API InventoryDeletionStatus GetInventoryDeletionStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForInventoryDeletionStatus(InventoryDeletionStatus value);
+
+/**
+ * Same as GetNameForInventoryDeletionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForInventoryDeletionStatusCStr(InventoryDeletionStatus value);
 } // namespace InventoryDeletionStatusMapper
 } // namespace Model
 } // namespace SSM
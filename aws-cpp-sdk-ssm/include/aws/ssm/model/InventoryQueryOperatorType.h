@@ -39,6 +39,11 @@ namespace InventoryQueryOperatorTypeMapper
 AWS_SSM_API InventoryQueryOperatorType GetInventoryQueryOperatorTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForInventoryQueryOperatorType(InventoryQueryOperatorType value);
+
+/**
+ * Same as GetNameForInventoryQueryOperatorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForInventoryQueryOperatorTypeCStr(InventoryQueryOperatorType value);
 } // namespace InventoryQueryOperatorTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -35,6 +35,11 @@ namespace InventorySchemaDeleteOptionMapper
 AWS_SSM_API InventorySchemaDeleteOption GetInventorySchemaDeleteOptionForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForInventorySchemaDeleteOption(InventorySchemaDeleteOption value);
+
+/**
+ * Same as GetNameForInventorySchemaDeleteOption(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForInventorySchemaDeleteOptionCStr(InventorySchemaDeleteOption value);
 } // namespace InventorySchemaDeleteOptionMapper
 } // namespace Model
 } // namespace SSM
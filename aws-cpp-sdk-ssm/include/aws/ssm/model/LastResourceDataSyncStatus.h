@@ -36,6 +36,11 @@ namespace LastResourceDataSyncStatusMapper
 AWS_SSM_API LastResourceDataSyncStatus GetLastResourceDataSyncStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForLastResourceDataSyncStatus(LastResourceDataSyncStatus value);
+
+/**
+ * Same as GetNameForLastResourceDataSyncStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForLastResourceDataSyncStatusCStr(LastResourceDataSyncStatus value);
 } // namespace LastResourceDataSyncStatusMapper
 } // namespace Model
 } // namespace SSM
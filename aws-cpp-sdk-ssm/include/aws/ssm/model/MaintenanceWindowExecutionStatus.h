@@ -41,6 +41,11 @@ namespace MaintenanceWindowExecutionStatusMapper
 AWS_SSM_API MaintenanceWindowExecutionStatus GetMaintenanceWindowExecutionStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForMaintenanceWindowExecutionStatus(MaintenanceWindowExecutionStatus value);
+
+/**
+ * Same as GetNameForMaintenanceWindowExecutionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForMaintenanceWindowExecutionStatusCStr(MaintenanceWindowExecutionStatus value);
 } // namespace MaintenanceWindowExecutionStatusMapper
 } // namespace Model
 } // namespace SSM
@@ -34,6 +34,11 @@ namespace MaintenanceWindowResourceTypeMapper
 AWS_SSM_API MaintenanceWindowResourceType GetMaintenanceWindowResourceTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForMaintenanceWindowResourceType(MaintenanceWindowResourceType value);
+
+/**
+ * Same as GetNameForMaintenanceWindowResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForMaintenanceWindowResourceTypeCStr(MaintenanceWindowResourceType value);
 } // namespace MaintenanceWindowResourceTypeMapper
 } // namespace Model
 } // namespace SSM
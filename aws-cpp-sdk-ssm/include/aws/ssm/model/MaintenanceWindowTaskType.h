@@ -37,6 +37,11 @@ namespace MaintenanceWindowTaskTypeMapper
 AWS_SSM_API MaintenanceWindowTaskType GetMaintenanceWindowTaskTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForMaintenanceWindowTaskType(MaintenanceWindowTaskType value);
+
+/**
+ * Same as GetNameForMaintenanceWindowTaskType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForMaintenanceWindowTaskTypeCStr(MaintenanceWindowTaskType value);
 } // namespace MaintenanceWindowTaskTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -39,6 +39,11 @@ namespace NotificationEventMapper
 AWS_SSM_API NotificationEvent GetNotificationEventForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForNotificationEvent(NotificationEvent value);
+
+/**
+ * Same as GetNameForNotificationEvent(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForNotificationEventCStr(NotificationEvent value);
 } // namespace NotificationEventMapper
 } // namespace Model
 } // namespace SSM
@@ -40,6 +40,11 @@ namespace OperatingSystemMapper
 AWS_SSM_API OperatingSystem GetOperatingSystemForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForOperatingSystem(OperatingSystem value);
+
+/**
+ * Same as GetNameForOperatingSystem(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForOperatingSystemCStr(OperatingSystem value);
 } // namespace OperatingSystemMapper
 } // namespace Model
 } // namespace SSM
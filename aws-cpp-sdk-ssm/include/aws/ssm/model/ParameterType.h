@@ -36,6 +36,11 @@ namespace ParameterTypeMapper
 AWS_SSM_API ParameterType GetParameterTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForParameterType(ParameterType value);
+
+/**
+ * Same as GetNameForParameterType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForParameterTypeCStr(ParameterType value);
 } // namespace ParameterTypeMapper
 } // namespace Model
 } // namespace SSM
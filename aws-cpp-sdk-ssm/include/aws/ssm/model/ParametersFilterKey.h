@@ -36,6 +36,11 @@ namespace ParametersFilterKeyMapper
 AWS_SSM_API ParametersFilterKey GetParametersFilterKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForParametersFilterKey(ParametersFilterKey value);
+
+/**
+ * Same as GetNameForParametersFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForParametersFilterKeyCStr(ParametersFilterKey value);
 } // namespace ParametersFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -35,6 +35,11 @@ namespace PatchActionMapper
 AWS_SSM_API PatchAction GetPatchActionForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForPatchAction(PatchAction value);
+
+/**
+ * Same as GetNameForPatchAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForPatchActionCStr(PatchAction value);
 } // namespace PatchActionMapper
 } // namespace Model
 } // namespace SSM
@@ -39,6 +39,11 @@ namespace PatchComplianceDataStateMapper
 AWS_SSM_API PatchComplianceDataState GetPatchComplianceDataStateForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForPatchComplianceDataState(PatchComplianceDataState value);
+
+/**
+ * Same as GetNameForPatchComplianceDataState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForPatchComplianceDataStateCStr(PatchComplianceDataState value);
 } // namespace PatchComplianceDataStateMapper
 } // namespace Model
 } // namespace SSM
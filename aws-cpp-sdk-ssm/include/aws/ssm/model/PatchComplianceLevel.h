@@ -39,6 +39,11 @@ namespace PatchComplianceLevelMapper
 AWS_SSM_API PatchComplianceLevel GetPatchComplianceLevelForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForPatchComplianceLevel(PatchComplianceLevel value);
+
+/**
+ * Same as GetNameForPatchComplianceLevel(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForPatchComplianceLevelCStr(PatchComplianceLevel value);
 } // namespace PatchComplianceLevelMapper
 } // namespace Model
 } // namespace SSM
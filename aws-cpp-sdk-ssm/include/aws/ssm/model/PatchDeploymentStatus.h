@@ -37,6 +37,11 @@ namespace PatchDeploymentStatusMapper
 AWS_SSM_API PatchDeploymentStatus GetPatchDeploymentStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForPatchDeploymentStatus(PatchDeploymentStatus value);
+
+/**
+ * Same as GetNameForPatchDeploymentStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForPatchDeploymentStatusCStr(PatchDeploymentStatus value);
 } // namespace PatchDeploymentStatusMapper
 } // namespace Model
 } // namespace SSM
@@ -40,6 +40,11 @@ namespace PatchFilterKeyMapper
 AWS_SSM_API PatchFilterKey GetPatchFilterKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForPatchFilterKey(PatchFilterKey value);
+
+/**
+ * Same as GetNameForPatchFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForPatchFilterKeyCStr(PatchFilterKey value);
 } // namespace PatchFilterKeyMapper
 } // namespace Model
 } // namespace SSM
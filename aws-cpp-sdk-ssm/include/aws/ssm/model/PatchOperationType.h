@@ -35,6 +35,11 @@ namespace PatchOperationTypeMapper
 AWS_SSM_API PatchOperationType GetPatchOperationTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForPatchOperationType(PatchOperationType value);
+
+/**
+ * Same as GetNameForPatchOperationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForPatchOperationTypeCStr(PatchOperationType value);
 } // namespace PatchOperationTypeMapper
 } // namespace Model
 } // namespace SSM
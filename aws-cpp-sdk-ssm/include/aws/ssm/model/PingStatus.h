@@ -36,6 +36,11 @@ namespace PingStatusMapper
 AWS_SSM_API PingStatus GetPingStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForPingStatus(PingStatus value);
+
+/**
+ * Same as GetNameForPingStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForPingStatusCStr(PingStatus value);
 } // namespace PingStatusMapper
 } // namespace Model
 } // namespace SSM
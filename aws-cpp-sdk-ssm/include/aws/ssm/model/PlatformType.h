@@ -35,6 +35,11 @@ namespace PlatformTypeMapper
 AWS_SSM_API PlatformType GetPlatformTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForPlatformType(PlatformType value);
+
+/**
+ * Same as GetNameForPlatformType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForPlatformTypeCStr(PlatformType value);
 } // namespace PlatformTypeMapper
 } // namespace Model
 } // namespace SSM
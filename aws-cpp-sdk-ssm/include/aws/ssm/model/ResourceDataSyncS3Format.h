@@ -34,6 +34,11 @@ namespace ResourceDataSyncS3FormatMapper
 AWS_SSM_API ResourceDataSyncS3Format GetResourceDataSyncS3FormatForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForResourceDataSyncS3Format(ResourceDataSyncS3Format value);
+
+/**
+ * Same as GetNameForResourceDataSyncS3Format(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForResourceDataSyncS3FormatCStr(ResourceDataSyncS3Format value);
 } // namespace ResourceDataSyncS3FormatMapper
 } // namespace Model
 } // namespace SSM
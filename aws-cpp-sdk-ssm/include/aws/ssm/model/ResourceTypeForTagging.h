@@ -38,6 +38,11 @@ namespace ResourceTypeForTaggingMapper
 AWS_SSM_API ResourceTypeForTagging GetResourceTypeForTaggingForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForResourceTypeForTagging(ResourceTypeForTagging value);
+
+/**
+ * Same as GetNameForResourceTypeForTagging(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForResourceTypeForTaggingCStr(ResourceTypeForTagging value);
 } // namespace ResourceTypeForTaggingMapper
 } // namespace Model
 } // namespace SSM
@@ -38,6 +38,11 @@ namespace SessionFilterKeyMapper
 AWS_SSM_API SessionFilterKey GetSessionFilterKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForSessionFilterKey(SessionFilterKey value);
+
+/**
+ * Same as GetNameForSessionFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForSessionFilterKeyCStr(SessionFilterKey value);
 } // namespace SessionFilterKeyMapper
 } // namespace Model
 } // namespace SSM
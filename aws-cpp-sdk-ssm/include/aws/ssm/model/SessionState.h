@@ -35,6 +35,11 @@ namespace SessionStateMapper
 AWS_SSM_API SessionState GetSessionStateForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForSessionState(SessionState value);
+
+/**
+ * Same as GetNameForSessionState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForSessionStateCStr(SessionState value);
 } // namespace SessionStateMapper
 } // namespace Model
 } // namespace SSM
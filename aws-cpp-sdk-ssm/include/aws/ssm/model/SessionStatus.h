@@ -39,6 +39,11 @@ namespace SessionStatusMapper
 AWS_SSM_API SessionStatus GetSessionStatusForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForSessionStatus(SessionStatus value);
+
+/**
+ * Same as GetNameForSessionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForSessionStatusCStr(SessionStatus value);
 } // namespace SessionStatusMapper
 } // namespace Model
 } // namespace SSM
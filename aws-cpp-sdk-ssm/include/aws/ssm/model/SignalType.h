@@ -38,6 +38,11 @@ namespace SignalTypeMapper
 AWS_SSM_API SignalType GetSignalTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForSignalType(SignalType value);
+
+/**
+ * Same as GetNameForSignalType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForSignalTypeCStr(SignalType value);
 } // namespace SignalTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -39,6 +39,11 @@ namespace StepExecutionFilterKeyMapper
 AWS_SSM_API StepExecutionFilterKey GetStepExecutionFilterKeyForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForStepExecutionFilterKey(StepExecutionFilterKey value);
+
+/**
+ * Same as GetNameForStepExecutionFilterKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForStepExecutionFilterKeyCStr(StepExecutionFilterKey value);
 } // namespace StepExecutionFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -35,6 +35,11 @@ namespace StopTypeMapper
 AWS_SSM_API StopType GetStopTypeForName(const Aws::String& name);
 
 AWS_SSM_API Aws::String GetNameForStopType(StopType value);
+
+/**
+ * Same as GetNameForStopType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SSM_API const char* GetNameForStopTypeCStr(StopType value);
 } // namespace StopTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -30,35 +30,58 @@ namespace Aws
       namespace AssociationComplianceSeverityMapper
       {
 
-        static const int CRITICAL_HASH = HashingUtils::HashString("CRITICAL");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int UNSPECIFIED_HASH = HashingUtils::HashString("UNSPECIFIED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CRITICAL",
+          "HIGH",
+          "MEDIUM",
+          "LOW",
+          "UNSPECIFIED",
+        };
 
         AssociationComplianceSeverity GetAssociationComplianceSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CRITICAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssociationComplianceSeverity::CRITICAL;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return AssociationComplianceSeverity::HIGH;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return AssociationComplianceSeverity::MEDIUM;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return AssociationComplianceSeverity::LOW;
-          }
-          else if (hashCode == UNSPECIFIED_HASH)
-          {
-            return AssociationComplianceSeverity::UNSPECIFIED;
+          case -1560189025:
+            if (name == "CRITICAL")
+            {
+              return AssociationComplianceSeverity::CRITICAL;
+            }
+            break;
+          case 2217378:
+            if (name == "HIGH")
+            {
+              return AssociationComplianceSeverity::HIGH;
+            }
+            break;
+          case -2024701067:
+            if (name == "MEDIUM")
+            {
+              return AssociationComplianceSeverity::MEDIUM;
+            }
+            break;
+          case 75572:
+            if (name == "LOW")
+            {
+              return AssociationComplianceSeverity::LOW;
+            }
+            break;
+          case 526786327:
+            if (name == "UNSPECIFIED")
+            {
+              return AssociationComplianceSeverity::UNSPECIFIED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return AssociationComplianceSeverity::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationComplianceSeverity(AssociationComplianceSeverity enumValue)
+        const char* GetNameForAssociationComplianceSeverityCStr(AssociationComplianceSeverity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssociationComplianceSeverity::CRITICAL:
-            return "CRITICAL";
-          case AssociationComplianceSeverity::HIGH:
-            return "HIGH";
-          case AssociationComplianceSeverity::MEDIUM:
-            return "MEDIUM";
-          case AssociationComplianceSeverity::LOW:
-            return "LOW";
-          case AssociationComplianceSeverity::UNSPECIFIED:
-            return "UNSPECIFIED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssociationComplianceSeverity(AssociationComplianceSeverity enumValue)
+        {
+          return GetNameForAssociationComplianceSeverityCStr(enumValue);
         }
 
       } // namespace AssociationComplianceSeverityMapper
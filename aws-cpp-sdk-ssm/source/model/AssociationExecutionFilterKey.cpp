@@ -30,25 +30,44 @@ namespace Aws
       namespace AssociationExecutionFilterKeyMapper
       {
 
-        static const int ExecutionId_HASH = HashingUtils::HashString("ExecutionId");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int CreatedTime_HASH = HashingUtils::HashString("CreatedTime");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ExecutionId",
+          "Status",
+          "CreatedTime",
+        };
 
         AssociationExecutionFilterKey GetAssociationExecutionFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ExecutionId_HASH)
-          {
-            return AssociationExecutionFilterKey::ExecutionId;
-          }
-          else if (hashCode == Status_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssociationExecutionFilterKey::Status;
-          }
-          else if (hashCode == CreatedTime_HASH)
-          {
-            return AssociationExecutionFilterKey::CreatedTime;
+          case 1212962355:
+            if (name == "ExecutionId")
+            {
+              return AssociationExecutionFilterKey::ExecutionId;
+            }
+            break;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return AssociationExecutionFilterKey::Status;
+            }
+            break;
+          case 1177958837:
+            if (name == "CreatedTime")
+            {
+              return AssociationExecutionFilterKey::CreatedTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AssociationExecutionFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationExecutionFilterKey(AssociationExecutionFilterKey enumValue)
+        const char* GetNameForAssociationExecutionFilterKeyCStr(AssociationExecutionFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssociationExecutionFilterKey::ExecutionId:
-            return "ExecutionId";
-          case AssociationExecutionFilterKey::Status:
-            return "Status";
-          case AssociationExecutionFilterKey::CreatedTime:
-            return "CreatedTime";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssociationExecutionFilterKey(AssociationExecutionFilterKey enumValue)
+        {
+          return GetNameForAssociationExecutionFilterKeyCStr(enumValue);
         }
 
       } // namespace AssociationExecutionFilterKeyMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AssociationExecutionTargetsFilterKeyMapper
       {
 
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int ResourceId_HASH = HashingUtils::HashString("ResourceId");
-        static const int ResourceType_HASH = HashingUtils::HashString("ResourceType");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Status",
+          "ResourceId",
+          "ResourceType",
+        };
 
         AssociationExecutionTargetsFilterKey GetAssociationExecutionTargetsFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Status_HASH)
-          {
-            return AssociationExecutionTargetsFilterKey::Status;
-          }
-          else if (hashCode == ResourceId_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssociationExecutionTargetsFilterKey::ResourceId;
-          }
-          else if (hashCode == ResourceType_HASH)
-          {
-            return AssociationExecutionTargetsFilterKey::ResourceType;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return AssociationExecutionTargetsFilterKey::Status;
+            }
+            break;
+          case 647814633:
+            if (name == "ResourceId")
+            {
+              return AssociationExecutionTargetsFilterKey::ResourceId;
+            }
+            break;
+          case -220044152:
+            if (name == "ResourceType")
+            {
+              return AssociationExecutionTargetsFilterKey::ResourceType;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AssociationExecutionTargetsFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationExecutionTargetsFilterKey(AssociationExecutionTargetsFilterKey enumValue)
+        const char* GetNameForAssociationExecutionTargetsFilterKeyCStr(AssociationExecutionTargetsFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssociationExecutionTargetsFilterKey::Status:
-            return "Status";
-          case AssociationExecutionTargetsFilterKey::ResourceId:
-            return "ResourceId";
-          case AssociationExecutionTargetsFilterKey::ResourceType:
-            return "ResourceType";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssociationExecutionTargetsFilterKey(AssociationExecutionTargetsFilterKey enumValue)
+        {
+          return GetNameForAssociationExecutionTargetsFilterKeyCStr(enumValue);
         }
 
       } // namespace AssociationExecutionTargetsFilterKeyMapper
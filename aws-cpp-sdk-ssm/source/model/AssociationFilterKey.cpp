@@ -30,45 +30,72 @@ namespace Aws
       namespace AssociationFilterKeyMapper
       {
 
-        static const int InstanceId_HASH = HashingUtils::HashString("InstanceId");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int AssociationId_HASH = HashingUtils::HashString("AssociationId");
-        static const int AssociationStatusName_HASH = HashingUtils::HashString("AssociationStatusName");
-        static const int LastExecutedBefore_HASH = HashingUtils::HashString("LastExecutedBefore");
-        static const int LastExecutedAfter_HASH = HashingUtils::HashString("LastExecutedAfter");
-        static const int AssociationName_HASH = HashingUtils::HashString("AssociationName");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InstanceId",
+          "Name",
+          "AssociationId",
+          "AssociationStatusName",
+          "LastExecutedBefore",
+          "LastExecutedAfter",
+          "AssociationName",
+        };
 
         AssociationFilterKey GetAssociationFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InstanceId_HASH)
-          {
-            return AssociationFilterKey::InstanceId;
-          }
-          else if (hashCode == Name_HASH)
-          {
-            return AssociationFilterKey::Name;
-          }
-          else if (hashCode == AssociationId_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssociationFilterKey::AssociationId;
-          }
-          else if (hashCode == AssociationStatusName_HASH)
-          {
-            return AssociationFilterKey::AssociationStatusName;
-          }
-          else if (hashCode == LastExecutedBefore_HASH)
-          {
-            return AssociationFilterKey::LastExecutedBefore;
-          }
-          else if (hashCode == LastExecutedAfter_HASH)
-          {
-            return AssociationFilterKey::LastExecutedAfter;
-          }
-          else if (hashCode == AssociationName_HASH)
-          {
-            return AssociationFilterKey::AssociationName;
+          case -1399478096:
+            if (name == "InstanceId")
+            {
+              return AssociationFilterKey::InstanceId;
+            }
+            break;
+          case 2420395:
+            if (name == "Name")
+            {
+              return AssociationFilterKey::Name;
+            }
+            break;
+          case -1683818148:
+            if (name == "AssociationId")
+            {
+              return AssociationFilterKey::AssociationId;
+            }
+            break;
+          case -1541631778:
+            if (name == "AssociationStatusName")
+            {
+              return AssociationFilterKey::AssociationStatusName;
+            }
+            break;
+          case 873519172:
+            if (name == "LastExecutedBefore")
+            {
+              return AssociationFilterKey::LastExecutedBefore;
+            }
+            break;
+          case -1635270537:
+            if (name == "LastExecutedAfter")
+            {
+              return AssociationFilterKey::LastExecutedAfter;
+            }
+            break;
+          case 1053579916:
+            if (name == "AssociationName")
+            {
+              return AssociationFilterKey::AssociationName;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return AssociationFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationFilterKey(AssociationFilterKey enumValue)
+        const char* GetNameForAssociationFilterKeyCStr(AssociationFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssociationFilterKey::InstanceId:
-            return "InstanceId";
-          case AssociationFilterKey::Name:
-            return "Name";
-          case AssociationFilterKey::AssociationId:
-            return "AssociationId";
-          case AssociationFilterKey::AssociationStatusName:
-            return "AssociationStatusName";
-          case AssociationFilterKey::LastExecutedBefore:
-            return "LastExecutedBefore";
-          case AssociationFilterKey::LastExecutedAfter:
-            return "LastExecutedAfter";
-          case AssociationFilterKey::AssociationName:
-            return "AssociationName";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssociationFilterKey(AssociationFilterKey enumValue)
+        {
+          return GetNameForAssociationFilterKeyCStr(enumValue);
         }
 
       } // namespace AssociationFilterKeyMapper
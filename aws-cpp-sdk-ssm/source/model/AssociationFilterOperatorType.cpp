@@ -30,25 +30,44 @@ namespace Aws
       namespace AssociationFilterOperatorTypeMapper
       {
 
-        static const int EQUAL_HASH = HashingUtils::HashString("EQUAL");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EQUAL",
+          "LESS_THAN",
+          "GREATER_THAN",
+        };
 
         AssociationFilterOperatorType GetAssociationFilterOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQUAL_HASH)
-          {
-            return AssociationFilterOperatorType::EQUAL;
-          }
-          else if (hashCode == LESS_THAN_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssociationFilterOperatorType::LESS_THAN;
-          }
-          else if (hashCode == GREATER_THAN_HASH)
-          {
-            return AssociationFilterOperatorType::GREATER_THAN;
+          case 66219796:
+            if (name == "EQUAL")
+            {
+              return AssociationFilterOperatorType::EQUAL;
+            }
+            break;
+          case -1112834937:
+            if (name == "LESS_THAN")
+            {
+              return AssociationFilterOperatorType::LESS_THAN;
+            }
+            break;
+          case 972152550:
+            if (name == "GREATER_THAN")
+            {
+              return AssociationFilterOperatorType::GREATER_THAN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AssociationFilterOperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationFilterOperatorType(AssociationFilterOperatorType enumValue)
+        const char* GetNameForAssociationFilterOperatorTypeCStr(AssociationFilterOperatorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssociationFilterOperatorType::EQUAL:
-            return "EQUAL";
-          case AssociationFilterOperatorType::LESS_THAN:
-            return "LESS_THAN";
-          case AssociationFilterOperatorType::GREATER_THAN:
-            return "GREATER_THAN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssociationFilterOperatorType(AssociationFilterOperatorType enumValue)
+        {
+          return GetNameForAssociationFilterOperatorTypeCStr(enumValue);
         }
 
       } // namespace AssociationFilterOperatorTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace AssociationStatusNameMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "Success",
+          "Failed",
+        };
 
         AssociationStatusName GetAssociationStatusNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return AssociationStatusName::Pending;
-          }
-          else if (hashCode == Success_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AssociationStatusName::Success;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return AssociationStatusName::Failed;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return AssociationStatusName::Pending;
+            }
+            break;
+          case -202516509:
+            if (name == "Success")
+            {
+              return AssociationStatusName::Success;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return AssociationStatusName::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return AssociationStatusName::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationStatusName(AssociationStatusName enumValue)
+        const char* GetNameForAssociationStatusNameCStr(AssociationStatusName enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AssociationStatusName::Pending:
-            return "Pending";
-          case AssociationStatusName::Success:
-            return "Success";
-          case AssociationStatusName::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAssociationStatusName(AssociationStatusName enumValue)
+        {
+          return GetNameForAssociationStatusNameCStr(enumValue);
         }
 
       } // namespace AssociationStatusNameMapper
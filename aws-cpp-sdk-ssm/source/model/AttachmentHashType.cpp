@@ -30,15 +30,30 @@ namespace Aws
       namespace AttachmentHashTypeMapper
       {
 
-        static const int Sha256_HASH = HashingUtils::HashString("Sha256");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Sha256",
+        };
 
         AttachmentHashType GetAttachmentHashTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Sha256_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AttachmentHashType::Sha256;
+          case -1819762105:
+            if (name == "Sha256")
+            {
+              return AttachmentHashType::Sha256;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return AttachmentHashType::NOT_SET;
         }
 
-        Aws::String GetNameForAttachmentHashType(AttachmentHashType enumValue)
+        const char* GetNameForAttachmentHashTypeCStr(AttachmentHashType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AttachmentHashType::Sha256:
-            return "Sha256";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAttachmentHashType(AttachmentHashType enumValue)
+        {
+          return GetNameForAttachmentHashTypeCStr(enumValue);
         }
 
       } // namespace AttachmentHashTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace AttachmentsSourceKeyMapper
       {
 
-        static const int SourceUrl_HASH = HashingUtils::HashString("SourceUrl");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SourceUrl",
+        };
 
         AttachmentsSourceKey GetAttachmentsSourceKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SourceUrl_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AttachmentsSourceKey::SourceUrl;
+          case 305548084:
+            if (name == "SourceUrl")
+            {
+              return AttachmentsSourceKey::SourceUrl;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return AttachmentsSourceKey::NOT_SET;
         }
 
-        Aws::String GetNameForAttachmentsSourceKey(AttachmentsSourceKey enumValue)
+        const char* GetNameForAttachmentsSourceKeyCStr(AttachmentsSourceKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AttachmentsSourceKey::SourceUrl:
-            return "SourceUrl";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAttachmentsSourceKey(AttachmentsSourceKey enumValue)
+        {
+          return GetNameForAttachmentsSourceKeyCStr(enumValue);
         }
 
       } // namespace AttachmentsSourceKeyMapper
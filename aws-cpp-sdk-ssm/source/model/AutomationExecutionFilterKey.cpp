@@ -30,50 +30,79 @@ namespace Aws
       namespace AutomationExecutionFilterKeyMapper
       {
 
-        static const int DocumentNamePrefix_HASH = HashingUtils::HashString("DocumentNamePrefix");
-        static const int ExecutionStatus_HASH = HashingUtils::HashString("ExecutionStatus");
-        static const int ExecutionId_HASH = HashingUtils::HashString("ExecutionId");
-        static const int ParentExecutionId_HASH = HashingUtils::HashString("ParentExecutionId");
-        static const int CurrentAction_HASH = HashingUtils::HashString("CurrentAction");
-        static const int StartTimeBefore_HASH = HashingUtils::HashString("StartTimeBefore");
-        static const int StartTimeAfter_HASH = HashingUtils::HashString("StartTimeAfter");
-        static const int AutomationType_HASH = HashingUtils::HashString("AutomationType");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DocumentNamePrefix",
+          "ExecutionStatus",
+          "ExecutionId",
+          "ParentExecutionId",
+          "CurrentAction",
+          "StartTimeBefore",
+          "StartTimeAfter",
+          "AutomationType",
+        };
 
         AutomationExecutionFilterKey GetAutomationExecutionFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DocumentNamePrefix_HASH)
-          {
-            return AutomationExecutionFilterKey::DocumentNamePrefix;
-          }
-          else if (hashCode == ExecutionStatus_HASH)
-          {
-            return AutomationExecutionFilterKey::ExecutionStatus;
-          }
-          else if (hashCode == ExecutionId_HASH)
-          {
-            return AutomationExecutionFilterKey::ExecutionId;
-          }
-          else if (hashCode == ParentExecutionId_HASH)
-          {
-            return AutomationExecutionFilterKey::ParentExecutionId;
-          }
-          else if (hashCode == CurrentAction_HASH)
-          {
-            return AutomationExecutionFilterKey::CurrentAction;
-          }
-          else if (hashCode == StartTimeBefore_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AutomationExecutionFilterKey::StartTimeBefore;
-          }
-          else if (hashCode == StartTimeAfter_HASH)
-          {
-            return AutomationExecutionFilterKey::StartTimeAfter;
-          }
-          else if (hashCode == AutomationType_HASH)
-          {
-            return AutomationExecutionFilterKey::AutomationType;
+          case -852768616:
+            if (name == "DocumentNamePrefix")
+            {
+              return AutomationExecutionFilterKey::DocumentNamePrefix;
+            }
+            break;
+          case 320851210:
+            if (name == "ExecutionStatus")
+            {
+              return AutomationExecutionFilterKey::ExecutionStatus;
+            }
+            break;
+          case 1212962355:
+            if (name == "ExecutionId")
+            {
+              return AutomationExecutionFilterKey::ExecutionId;
+            }
+            break;
+          case 245915433:
+            if (name == "ParentExecutionId")
+            {
+              return AutomationExecutionFilterKey::ParentExecutionId;
+            }
+            break;
+          case -1783654161:
+            if (name == "CurrentAction")
+            {
+              return AutomationExecutionFilterKey::CurrentAction;
+            }
+            break;
+          case 1195652750:
+            if (name == "StartTimeBefore")
+            {
+              return AutomationExecutionFilterKey::StartTimeBefore;
+            }
+            break;
+          case -1347784467:
+            if (name == "StartTimeAfter")
+            {
+              return AutomationExecutionFilterKey::StartTimeAfter;
+            }
+            break;
+          case 539263249:
+            if (name == "AutomationType")
+            {
+              return AutomationExecutionFilterKey::AutomationType;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return AutomationExecutionFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForAutomationExecutionFilterKey(AutomationExecutionFilterKey enumValue)
+        const char* GetNameForAutomationExecutionFilterKeyCStr(AutomationExecutionFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AutomationExecutionFilterKey::DocumentNamePrefix:
-            return "DocumentNamePrefix";
-          case AutomationExecutionFilterKey::ExecutionStatus:
-            return "ExecutionStatus";
-          case AutomationExecutionFilterKey::ExecutionId:
-            return "ExecutionId";
-          case AutomationExecutionFilterKey::ParentExecutionId:
-            return "ParentExecutionId";
-          case AutomationExecutionFilterKey::CurrentAction:
-            return "CurrentAction";
-          case AutomationExecutionFilterKey::StartTimeBefore:
-            return "StartTimeBefore";
-          case AutomationExecutionFilterKey::StartTimeAfter:
-            return "StartTimeAfter";
-          case AutomationExecutionFilterKey::AutomationType:
-            return "AutomationType";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAutomationExecutionFilterKey(AutomationExecutionFilterKey enumValue)
+        {
+          return GetNameForAutomationExecutionFilterKeyCStr(enumValue);
         }
 
       } // namespace AutomationExecutionFilterKeyMapper
@@ -30,50 +30,79 @@ namespace Aws
       namespace AutomationExecutionStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Waiting_HASH = HashingUtils::HashString("Waiting");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Cancelling_HASH = HashingUtils::HashString("Cancelling");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "InProgress",
+          "Waiting",
+          "Success",
+          "TimedOut",
+          "Cancelling",
+          "Cancelled",
+          "Failed",
+        };
 
         AutomationExecutionStatus GetAutomationExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return AutomationExecutionStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return AutomationExecutionStatus::InProgress;
-          }
-          else if (hashCode == Waiting_HASH)
-          {
-            return AutomationExecutionStatus::Waiting;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return AutomationExecutionStatus::Success;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
-            return AutomationExecutionStatus::TimedOut;
-          }
-          else if (hashCode == Cancelling_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AutomationExecutionStatus::Cancelling;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return AutomationExecutionStatus::Cancelled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return AutomationExecutionStatus::Failed;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return AutomationExecutionStatus::Pending;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return AutomationExecutionStatus::InProgress;
+            }
+            break;
+          case -1514000851:
+            if (name == "Waiting")
+            {
+              return AutomationExecutionStatus::Waiting;
+            }
+            break;
+          case -202516509:
+            if (name == "Success")
+            {
+              return AutomationExecutionStatus::Success;
+            }
+            break;
+          case -2012269385:
+            if (name == "TimedOut")
+            {
+              return AutomationExecutionStatus::TimedOut;
+            }
+            break;
+          case -412160624:
+            if (name == "Cancelling")
+            {
+              return AutomationExecutionStatus::Cancelling;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return AutomationExecutionStatus::Cancelled;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return AutomationExecutionStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return AutomationExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAutomationExecutionStatus(AutomationExecutionStatus enumValue)
+        const char* GetNameForAutomationExecutionStatusCStr(AutomationExecutionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AutomationExecutionStatus::Pending:
-            return "Pending";
-          case AutomationExecutionStatus::InProgress:
-            return "InProgress";
-          case AutomationExecutionStatus::Waiting:
-            return "Waiting";
-          case AutomationExecutionStatus::Success:
-            return "Success";
-          case AutomationExecutionStatus::TimedOut:
-            return "TimedOut";
-          case AutomationExecutionStatus::Cancelling:
-            return "Cancelling";
-          case AutomationExecutionStatus::Cancelled:
-            return "Cancelled";
-          case AutomationExecutionStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAutomationExecutionStatus(AutomationExecutionStatus enumValue)
+        {
+          return GetNameForAutomationExecutionStatusCStr(enumValue);
         }
 
       } // namespace AutomationExecutionStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace AutomationTypeMapper
       {
 
-        static const int CrossAccount_HASH = HashingUtils::HashString("CrossAccount");
-        static const int Local_HASH = HashingUtils::HashString("Local");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CrossAccount",
+          "Local",
+        };
 
         AutomationType GetAutomationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CrossAccount_HASH)
-          {
-            return AutomationType::CrossAccount;
-          }
-          else if (hashCode == Local_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return AutomationType::Local;
+          case -1625352723:
+            if (name == "CrossAccount")
+            {
+              return AutomationType::CrossAccount;
+            }
+            break;
+          case 73592651:
+            if (name == "Local")
+            {
+              return AutomationType::Local;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return AutomationType::NOT_SET;
         }
 
-        Aws::String GetNameForAutomationType(AutomationType enumValue)
+        const char* GetNameForAutomationTypeCStr(AutomationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case AutomationType::CrossAccount:
-            return "CrossAccount";
-          case AutomationType::Local:
-            return "Local";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForAutomationType(AutomationType enumValue)
+        {
+          return GetNameForAutomationTypeCStr(enumValue);
         }
 
       } // namespace AutomationTypeMapper
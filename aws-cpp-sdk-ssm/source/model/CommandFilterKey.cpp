@@ -30,35 +30,58 @@ namespace Aws
       namespace CommandFilterKeyMapper
       {
 
-        static const int InvokedAfter_HASH = HashingUtils::HashString("InvokedAfter");
-        static const int InvokedBefore_HASH = HashingUtils::HashString("InvokedBefore");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int ExecutionStage_HASH = HashingUtils::HashString("ExecutionStage");
-        static const int DocumentName_HASH = HashingUtils::HashString("DocumentName");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InvokedAfter",
+          "InvokedBefore",
+          "Status",
+          "ExecutionStage",
+          "DocumentName",
+        };
 
         CommandFilterKey GetCommandFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvokedAfter_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CommandFilterKey::InvokedAfter;
-          }
-          else if (hashCode == InvokedBefore_HASH)
-          {
-            return CommandFilterKey::InvokedBefore;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return CommandFilterKey::Status;
-          }
-          else if (hashCode == ExecutionStage_HASH)
-          {
-            return CommandFilterKey::ExecutionStage;
-          }
-          else if (hashCode == DocumentName_HASH)
-          {
-            return CommandFilterKey::DocumentName;
+          case 131011184:
+            if (name == "InvokedAfter")
+            {
+              return CommandFilterKey::InvokedAfter;
+            }
+            break;
+          case -206322325:
+            if (name == "InvokedBefore")
+            {
+              return CommandFilterKey::InvokedBefore;
+            }
+            break;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return CommandFilterKey::Status;
+            }
+            break;
+          case 1811464934:
+            if (name == "ExecutionStage")
+            {
+              return CommandFilterKey::ExecutionStage;
+            }
+            break;
+          case -1309077914:
+            if (name == "DocumentName")
+            {
+              return CommandFilterKey::DocumentName;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return CommandFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForCommandFilterKey(CommandFilterKey enumValue)
+        const char* GetNameForCommandFilterKeyCStr(CommandFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CommandFilterKey::InvokedAfter:
-            return "InvokedAfter";
-          case CommandFilterKey::InvokedBefore:
-            return "InvokedBefore";
-          case CommandFilterKey::Status:
-            return "Status";
-          case CommandFilterKey::ExecutionStage:
-            return "ExecutionStage";
-          case CommandFilterKey::DocumentName:
-            return "DocumentName";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCommandFilterKey(CommandFilterKey enumValue)
+        {
+          return GetNameForCommandFilterKeyCStr(enumValue);
         }
 
       } // namespace CommandFilterKeyMapper
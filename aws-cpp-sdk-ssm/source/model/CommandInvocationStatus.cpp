@@ -30,50 +30,79 @@ namespace Aws
       namespace CommandInvocationStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Delayed_HASH = HashingUtils::HashString("Delayed");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Cancelling_HASH = HashingUtils::HashString("Cancelling");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "InProgress",
+          "Delayed",
+          "Success",
+          "Cancelled",
+          "TimedOut",
+          "Failed",
+          "Cancelling",
+        };
 
         CommandInvocationStatus GetCommandInvocationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return CommandInvocationStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return CommandInvocationStatus::InProgress;
-          }
-          else if (hashCode == Delayed_HASH)
-          {
-            return CommandInvocationStatus::Delayed;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return CommandInvocationStatus::Success;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return CommandInvocationStatus::Cancelled;
-          }
-          else if (hashCode == TimedOut_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CommandInvocationStatus::TimedOut;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return CommandInvocationStatus::Failed;
-          }
-          else if (hashCode == Cancelling_HASH)
-          {
-            return CommandInvocationStatus::Cancelling;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return CommandInvocationStatus::Pending;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return CommandInvocationStatus::InProgress;
+            }
+            break;
+          case -1079965374:
+            if (name == "Delayed")
+            {
+              return CommandInvocationStatus::Delayed;
+            }
+            break;
+          case -202516509:
+            if (name == "Success")
+            {
+              return CommandInvocationStatus::Success;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return CommandInvocationStatus::Cancelled;
+            }
+            break;
+          case -2012269385:
+            if (name == "TimedOut")
+            {
+              return CommandInvocationStatus::TimedOut;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return CommandInvocationStatus::Failed;
+            }
+            break;
+          case -412160624:
+            if (name == "Cancelling")
+            {
+              return CommandInvocationStatus::Cancelling;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return CommandInvocationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCommandInvocationStatus(CommandInvocationStatus enumValue)
+        const char* GetNameForCommandInvocationStatusCStr(CommandInvocationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CommandInvocationStatus::Pending:
-            return "Pending";
-          case CommandInvocationStatus::InProgress:
-            return "InProgress";
-          case CommandInvocationStatus::Delayed:
-            return "Delayed";
-          case CommandInvocationStatus::Success:
-            return "Success";
-          case CommandInvocationStatus::Cancelled:
-            return "Cancelled";
-          case CommandInvocationStatus::TimedOut:
-            return "TimedOut";
-          case CommandInvocationStatus::Failed:
-            return "Failed";
-          case CommandInvocationStatus::Cancelling:
-            return "Cancelling";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCommandInvocationStatus(CommandInvocationStatus enumValue)
+        {
+          return GetNameForCommandInvocationStatusCStr(enumValue);
         }
 
       } // namespace CommandInvocationStatusMapper
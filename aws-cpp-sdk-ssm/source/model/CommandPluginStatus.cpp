@@ -30,40 +30,65 @@ namespace Aws
       namespace CommandPluginStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "InProgress",
+          "Success",
+          "TimedOut",
+          "Cancelled",
+          "Failed",
+        };
 
         CommandPluginStatus GetCommandPluginStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return CommandPluginStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return CommandPluginStatus::InProgress;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return CommandPluginStatus::Success;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
-            return CommandPluginStatus::TimedOut;
-          }
-          else if (hashCode == Cancelled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CommandPluginStatus::Cancelled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return CommandPluginStatus::Failed;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return CommandPluginStatus::Pending;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return CommandPluginStatus::InProgress;
+            }
+            break;
+          case -202516509:
+            if (name == "Success")
+            {
+              return CommandPluginStatus::Success;
+            }
+            break;
+          case -2012269385:
+            if (name == "TimedOut")
+            {
+              return CommandPluginStatus::TimedOut;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return CommandPluginStatus::Cancelled;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return CommandPluginStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return CommandPluginStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCommandPluginStatus(CommandPluginStatus enumValue)
+        const char* GetNameForCommandPluginStatusCStr(CommandPluginStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CommandPluginStatus::Pending:
-            return "Pending";
-          case CommandPluginStatus::InProgress:
-            return "InProgress";
-          case CommandPluginStatus::Success:
-            return "Success";
-          case CommandPluginStatus::TimedOut:
-            return "TimedOut";
-          case CommandPluginStatus::Cancelled:
-            return "Cancelled";
-          case CommandPluginStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCommandPluginStatus(CommandPluginStatus enumValue)
+        {
+          return GetNameForCommandPluginStatusCStr(enumValue);
         }
 
       } // namespace CommandPluginStatusMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace CommandStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Cancelling_HASH = HashingUtils::HashString("Cancelling");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Pending",
+          "InProgress",
+          "Success",
+          "Cancelled",
+          "Failed",
+          "TimedOut",
+          "Cancelling",
+        };
 
         CommandStatus GetCommandStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
-          {
-            return CommandStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return CommandStatus::InProgress;
-          }
-          else if (hashCode == Success_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CommandStatus::Success;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return CommandStatus::Cancelled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return CommandStatus::Failed;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
-            return CommandStatus::TimedOut;
-          }
-          else if (hashCode == Cancelling_HASH)
-          {
-            return CommandStatus::Cancelling;
+          case 982065527:
+            if (name == "Pending")
+            {
+              return CommandStatus::Pending;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return CommandStatus::InProgress;
+            }
+            break;
+          case -202516509:
+            if (name == "Success")
+            {
+              return CommandStatus::Success;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return CommandStatus::Cancelled;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return CommandStatus::Failed;
+            }
+            break;
+          case -2012269385:
+            if (name == "TimedOut")
+            {
+              return CommandStatus::TimedOut;
+            }
+            break;
+          case -412160624:
+            if (name == "Cancelling")
+            {
+              return CommandStatus::Cancelling;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return CommandStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCommandStatus(CommandStatus enumValue)
+        const char* GetNameForCommandStatusCStr(CommandStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CommandStatus::Pending:
-            return "Pending";
-          case CommandStatus::InProgress:
-            return "InProgress";
-          case CommandStatus::Success:
-            return "Success";
-          case CommandStatus::Cancelled:
-            return "Cancelled";
-          case CommandStatus::Failed:
-            return "Failed";
-          case CommandStatus::TimedOut:
-            return "TimedOut";
-          case CommandStatus::Cancelling:
-            return "Cancelling";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCommandStatus(CommandStatus enumValue)
+        {
+          return GetNameForCommandStatusCStr(enumValue);
         }
 
       } // namespace CommandStatusMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace ComplianceQueryOperatorTypeMapper
       {
 
-        static const int EQUAL_HASH = HashingUtils::HashString("EQUAL");
-        static const int NOT_EQUAL_HASH = HashingUtils::HashString("NOT_EQUAL");
-        static const int BEGIN_WITH_HASH = HashingUtils::HashString("BEGIN_WITH");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EQUAL",
+          "NOT_EQUAL",
+          "BEGIN_WITH",
+          "LESS_THAN",
+          "GREATER_THAN",
+        };
 
         ComplianceQueryOperatorType GetComplianceQueryOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQUAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComplianceQueryOperatorType::EQUAL;
-          }
-          else if (hashCode == NOT_EQUAL_HASH)
-          {
-            return ComplianceQueryOperatorType::NOT_EQUAL;
-          }
-          else if (hashCode == BEGIN_WITH_HASH)
-          {
-            return ComplianceQueryOperatorType::BEGIN_WITH;
-          }
-          else if (hashCode == LESS_THAN_HASH)
-          {
-            return ComplianceQueryOperatorType::LESS_THAN;
-          }
-          else if (hashCode == GREATER_THAN_HASH)
-          {
-            return ComplianceQueryOperatorType::GREATER_THAN;
+          case 66219796:
+            if (name == "EQUAL")
+            {
+              return ComplianceQueryOperatorType::EQUAL;
+            }
+            break;
+          case 1022422664:
+            if (name == "NOT_EQUAL")
+            {
+              return ComplianceQueryOperatorType::NOT_EQUAL;
+            }
+            break;
+          case 1626918588:
+            if (name == "BEGIN_WITH")
+            {
+              return ComplianceQueryOperatorType::BEGIN_WITH;
+            }
+            break;
+          case -1112834937:
+            if (name == "LESS_THAN")
+            {
+              return ComplianceQueryOperatorType::LESS_THAN;
+            }
+            break;
+          case 972152550:
+            if (name == "GREATER_THAN")
+            {
+              return ComplianceQueryOperatorType::GREATER_THAN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ComplianceQueryOperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForComplianceQueryOperatorType(ComplianceQueryOperatorType enumValue)
+        const char* GetNameForComplianceQueryOperatorTypeCStr(ComplianceQueryOperatorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComplianceQueryOperatorType::EQUAL:
-            return "EQUAL";
-          case ComplianceQueryOperatorType::NOT_EQUAL:
-            return "NOT_EQUAL";
-          case ComplianceQueryOperatorType::BEGIN_WITH:
-            return "BEGIN_WITH";
-          case ComplianceQueryOperatorType::LESS_THAN:
-            return "LESS_THAN";
-          case ComplianceQueryOperatorType::GREATER_THAN:
-            return "GREATER_THAN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComplianceQueryOperatorType(ComplianceQueryOperatorType enumValue)
+        {
+          return GetNameForComplianceQueryOperatorTypeCStr(enumValue);
         }
 
       } // namespace ComplianceQueryOperatorTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace ComplianceSeverityMapper
       {
 
-        static const int CRITICAL_HASH = HashingUtils::HashString("CRITICAL");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int INFORMATIONAL_HASH = HashingUtils::HashString("INFORMATIONAL");
-        static const int UNSPECIFIED_HASH = HashingUtils::HashString("UNSPECIFIED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CRITICAL",
+          "HIGH",
+          "MEDIUM",
+          "LOW",
+          "INFORMATIONAL",
+          "UNSPECIFIED",
+        };
 
         ComplianceSeverity GetComplianceSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CRITICAL_HASH)
-          {
-            return ComplianceSeverity::CRITICAL;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return ComplianceSeverity::HIGH;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return ComplianceSeverity::MEDIUM;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return ComplianceSeverity::LOW;
-          }
-          else if (hashCode == INFORMATIONAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComplianceSeverity::INFORMATIONAL;
-          }
-          else if (hashCode == UNSPECIFIED_HASH)
-          {
-            return ComplianceSeverity::UNSPECIFIED;
+          case -1560189025:
+            if (name == "CRITICAL")
+            {
+              return ComplianceSeverity::CRITICAL;
+            }
+            break;
+          case 2217378:
+            if (name == "HIGH")
+            {
+              return ComplianceSeverity::HIGH;
+            }
+            break;
+          case -2024701067:
+            if (name == "MEDIUM")
+            {
+              return ComplianceSeverity::MEDIUM;
+            }
+            break;
+          case 75572:
+            if (name == "LOW")
+            {
+              return ComplianceSeverity::LOW;
+            }
+            break;
+          case 860618295:
+            if (name == "INFORMATIONAL")
+            {
+              return ComplianceSeverity::INFORMATIONAL;
+            }
+            break;
+          case 526786327:
+            if (name == "UNSPECIFIED")
+            {
+              return ComplianceSeverity::UNSPECIFIED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ComplianceSeverity::NOT_SET;
         }
 
-        Aws::String GetNameForComplianceSeverity(ComplianceSeverity enumValue)
+        const char* GetNameForComplianceSeverityCStr(ComplianceSeverity enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComplianceSeverity::CRITICAL:
-            return "CRITICAL";
-          case ComplianceSeverity::HIGH:
-            return "HIGH";
-          case ComplianceSeverity::MEDIUM:
-            return "MEDIUM";
-          case ComplianceSeverity::LOW:
-            return "LOW";
-          case ComplianceSeverity::INFORMATIONAL:
-            return "INFORMATIONAL";
-          case ComplianceSeverity::UNSPECIFIED:
-            return "UNSPECIFIED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComplianceSeverity(ComplianceSeverity enumValue)
+        {
+          return GetNameForComplianceSeverityCStr(enumValue);
         }
 
       } // namespace ComplianceSeverityMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ComplianceStatusMapper
       {
 
-        static const int COMPLIANT_HASH = HashingUtils::HashString("COMPLIANT");
-        static const int NON_COMPLIANT_HASH = HashingUtils::HashString("NON_COMPLIANT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COMPLIANT",
+          "NON_COMPLIANT",
+        };
 
         ComplianceStatus GetComplianceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLIANT_HASH)
-          {
-            return ComplianceStatus::COMPLIANT;
-          }
-          else if (hashCode == NON_COMPLIANT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComplianceStatus::NON_COMPLIANT;
+          case 1383764347:
+            if (name == "COMPLIANT")
+            {
+              return ComplianceStatus::COMPLIANT;
+            }
+            break;
+          case 1663567465:
+            if (name == "NON_COMPLIANT")
+            {
+              return ComplianceStatus::NON_COMPLIANT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ComplianceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForComplianceStatus(ComplianceStatus enumValue)
+        const char* GetNameForComplianceStatusCStr(ComplianceStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComplianceStatus::COMPLIANT:
-            return "COMPLIANT";
-          case ComplianceStatus::NON_COMPLIANT:
-            return "NON_COMPLIANT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComplianceStatus(ComplianceStatus enumValue)
+        {
+          return GetNameForComplianceStatusCStr(enumValue);
         }
 
       } // namespace ComplianceStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ConnectionStatusMapper
       {
 
-        static const int Connected_HASH = HashingUtils::HashString("Connected");
-        static const int NotConnected_HASH = HashingUtils::HashString("NotConnected");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Connected",
+          "NotConnected",
+        };
 
         ConnectionStatus GetConnectionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Connected_HASH)
-          {
-            return ConnectionStatus::Connected;
-          }
-          else if (hashCode == NotConnected_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectionStatus::NotConnected;
+          case 1424757481:
+            if (name == "Connected")
+            {
+              return ConnectionStatus::Connected;
+            }
+            break;
+          case -310560362:
+            if (name == "NotConnected")
+            {
+              return ConnectionStatus::NotConnected;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ConnectionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionStatus(ConnectionStatus enumValue)
+        const char* GetNameForConnectionStatusCStr(ConnectionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectionStatus::Connected:
-            return "Connected";
-          case ConnectionStatus::NotConnected:
-            return "NotConnected";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectionStatus(ConnectionStatus enumValue)
+        {
+          return GetNameForConnectionStatusCStr(enumValue);
         }
 
       } // namespace ConnectionStatusMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DescribeActivationsFilterKeysMapper
       {
 
-        static const int ActivationIds_HASH = HashingUtils::HashString("ActivationIds");
-        static const int DefaultInstanceName_HASH = HashingUtils::HashString("DefaultInstanceName");
-        static const int IamRole_HASH = HashingUtils::HashString("IamRole");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ActivationIds",
+          "DefaultInstanceName",
+          "IamRole",
+        };
 
         DescribeActivationsFilterKeys GetDescribeActivationsFilterKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ActivationIds_HASH)
-          {
-            return DescribeActivationsFilterKeys::ActivationIds;
-          }
-          else if (hashCode == DefaultInstanceName_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DescribeActivationsFilterKeys::DefaultInstanceName;
-          }
-          else if (hashCode == IamRole_HASH)
-          {
-            return DescribeActivationsFilterKeys::IamRole;
+          case -1738265182:
+            if (name == "ActivationIds")
+            {
+              return DescribeActivationsFilterKeys::ActivationIds;
+            }
+            break;
+          case 382454145:
+            if (name == "DefaultInstanceName")
+            {
+              return DescribeActivationsFilterKeys::DefaultInstanceName;
+            }
+            break;
+          case -1051463605:
+            if (name == "IamRole")
+            {
+              return DescribeActivationsFilterKeys::IamRole;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DescribeActivationsFilterKeys::NOT_SET;
         }
 
-        Aws::String GetNameForDescribeActivationsFilterKeys(DescribeActivationsFilterKeys enumValue)
+        const char* GetNameForDescribeActivationsFilterKeysCStr(DescribeActivationsFilterKeys enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DescribeActivationsFilterKeys::ActivationIds:
-            return "ActivationIds";
-          case DescribeActivationsFilterKeys::DefaultInstanceName:
-            return "DefaultInstanceName";
-          case DescribeActivationsFilterKeys::IamRole:
-            return "IamRole";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDescribeActivationsFilterKeys(DescribeActivationsFilterKeys enumValue)
+        {
+          return GetNameForDescribeActivationsFilterKeysCStr(enumValue);
         }
 
       } // namespace DescribeActivationsFilterKeysMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace DocumentFilterKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int Owner_HASH = HashingUtils::HashString("Owner");
-        static const int PlatformTypes_HASH = HashingUtils::HashString("PlatformTypes");
-        static const int DocumentType_HASH = HashingUtils::HashString("DocumentType");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "Owner",
+          "PlatformTypes",
+          "DocumentType",
+        };
 
         DocumentFilterKey GetDocumentFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return DocumentFilterKey::Name;
-          }
-          else if (hashCode == Owner_HASH)
-          {
-            return DocumentFilterKey::Owner;
-          }
-          else if (hashCode == PlatformTypes_HASH)
-          {
-            return DocumentFilterKey::PlatformTypes;
-          }
-          else if (hashCode == DocumentType_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DocumentFilterKey::DocumentType;
+          case 2420395:
+            if (name == "Name")
+            {
+              return DocumentFilterKey::Name;
+            }
+            break;
+          case 76612243:
+            if (name == "Owner")
+            {
+              return DocumentFilterKey::Owner;
+            }
+            break;
+          case 1327005606:
+            if (name == "PlatformTypes")
+            {
+              return DocumentFilterKey::PlatformTypes;
+            }
+            break;
+          case -1308876011:
+            if (name == "DocumentType")
+            {
+              return DocumentFilterKey::DocumentType;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return DocumentFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentFilterKey(DocumentFilterKey enumValue)
+        const char* GetNameForDocumentFilterKeyCStr(DocumentFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DocumentFilterKey::Name:
-            return "Name";
-          case DocumentFilterKey::Owner:
-            return "Owner";
-          case DocumentFilterKey::PlatformTypes:
-            return "PlatformTypes";
-          case DocumentFilterKey::DocumentType:
-            return "DocumentType";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDocumentFilterKey(DocumentFilterKey enumValue)
+        {
+          return GetNameForDocumentFilterKeyCStr(enumValue);
         }
 
       } // namespace DocumentFilterKeyMapper
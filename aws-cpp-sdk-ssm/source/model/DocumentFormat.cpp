@@ -30,20 +30,37 @@ namespace Aws
       namespace DocumentFormatMapper
       {
 
-        static const int YAML_HASH = HashingUtils::HashString("YAML");
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "YAML",
+          "JSON",
+        };
 
         DocumentFormat GetDocumentFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == YAML_HASH)
-          {
-            return DocumentFormat::YAML;
-          }
-          else if (hashCode == JSON_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DocumentFormat::JSON;
+          case 2716327:
+            if (name == "YAML")
+            {
+              return DocumentFormat::YAML;
+            }
+            break;
+          case 2286824:
+            if (name == "JSON")
+            {
+              return DocumentFormat::JSON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DocumentFormat::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentFormat(DocumentFormat enumValue)
+        const char* GetNameForDocumentFormatCStr(DocumentFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DocumentFormat::YAML:
-            return "YAML";
-          case DocumentFormat::JSON:
-            return "JSON";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDocumentFormat(DocumentFormat enumValue)
+        {
+          return GetNameForDocumentFormatCStr(enumValue);
         }
 
       } // namespace DocumentFormatMapper
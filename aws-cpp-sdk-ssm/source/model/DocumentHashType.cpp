@@ -30,20 +30,37 @@ namespace Aws
       namespace DocumentHashTypeMapper
       {
 
-        static const int Sha256_HASH = HashingUtils::HashString("Sha256");
-        static const int Sha1_HASH = HashingUtils::HashString("Sha1");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Sha256",
+          "Sha1",
+        };
 
         DocumentHashType GetDocumentHashTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Sha256_HASH)
-          {
-            return DocumentHashType::Sha256;
-          }
-          else if (hashCode == Sha1_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DocumentHashType::Sha1;
+          case -1819762105:
+            if (name == "Sha256")
+            {
+              return DocumentHashType::Sha256;
+            }
+            break;
+          case 2575653:
+            if (name == "Sha1")
+            {
+              return DocumentHashType::Sha1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DocumentHashType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentHashType(DocumentHashType enumValue)
+        const char* GetNameForDocumentHashTypeCStr(DocumentHashType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DocumentHashType::Sha256:
-            return "Sha256";
-          case DocumentHashType::Sha1:
-            return "Sha1";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDocumentHashType(DocumentHashType enumValue)
+        {
+          return GetNameForDocumentHashTypeCStr(enumValue);
         }
 
       } // namespace DocumentHashTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace DocumentParameterTypeMapper
       {
 
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int StringList_HASH = HashingUtils::HashString("StringList");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "String",
+          "StringList",
+        };
 
         DocumentParameterType GetDocumentParameterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == String_HASH)
-          {
-            return DocumentParameterType::String;
-          }
-          else if (hashCode == StringList_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DocumentParameterType::StringList;
+          case -1808118735:
+            if (name == "String")
+            {
+              return DocumentParameterType::String;
+            }
+            break;
+          case 420147311:
+            if (name == "StringList")
+            {
+              return DocumentParameterType::StringList;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DocumentParameterType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentParameterType(DocumentParameterType enumValue)
+        const char* GetNameForDocumentParameterTypeCStr(DocumentParameterType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DocumentParameterType::String:
-            return "String";
-          case DocumentParameterType::StringList:
-            return "StringList";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDocumentParameterType(DocumentParameterType enumValue)
+        {
+          return GetNameForDocumentParameterTypeCStr(enumValue);
         }
 
       } // namespace DocumentParameterTypeMapper
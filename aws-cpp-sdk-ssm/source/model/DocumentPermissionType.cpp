@@ -30,15 +30,30 @@ namespace Aws
       namespace DocumentPermissionTypeMapper
       {
 
-        static const int Share_HASH = HashingUtils::HashString("Share");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Share",
+        };
 
         DocumentPermissionType GetDocumentPermissionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Share_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DocumentPermissionType::Share;
+          case 79847359:
+            if (name == "Share")
+            {
+              return DocumentPermissionType::Share;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return DocumentPermissionType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentPermissionType(DocumentPermissionType enumValue)
+        const char* GetNameForDocumentPermissionTypeCStr(DocumentPermissionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DocumentPermissionType::Share:
-            return "Share";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDocumentPermissionType(DocumentPermissionType enumValue)
+        {
+          return GetNameForDocumentPermissionTypeCStr(enumValue);
         }
 
       } // namespace DocumentPermissionTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace DocumentStatusMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Updating_HASH = HashingUtils::HashString("Updating");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Creating",
+          "Active",
+          "Updating",
+          "Deleting",
+          "Failed",
+        };
 
         DocumentStatus GetDocumentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DocumentStatus::Creating;
-          }
-          else if (hashCode == Active_HASH)
-          {
-            return DocumentStatus::Active;
-          }
-          else if (hashCode == Updating_HASH)
-          {
-            return DocumentStatus::Updating;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return DocumentStatus::Deleting;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return DocumentStatus::Failed;
+          case 1885065945:
+            if (name == "Creating")
+            {
+              return DocumentStatus::Creating;
+            }
+            break;
+          case 1955883814:
+            if (name == "Active")
+            {
+              return DocumentStatus::Active;
+            }
+            break;
+          case 1387244390:
+            if (name == "Updating")
+            {
+              return DocumentStatus::Updating;
+            }
+            break;
+          case 884361160:
+            if (name == "Deleting")
+            {
+              return DocumentStatus::Deleting;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return DocumentStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return DocumentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentStatus(DocumentStatus enumValue)
+        const char* GetNameForDocumentStatusCStr(DocumentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DocumentStatus::Creating:
-            return "Creating";
-          case DocumentStatus::Active:
-            return "Active";
-          case DocumentStatus::Updating:
-            return "Updating";
-          case DocumentStatus::Deleting:
-            return "Deleting";
-          case DocumentStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDocumentStatus(DocumentStatus enumValue)
+        {
+          return GetNameForDocumentStatusCStr(enumValue);
         }
 
       } // namespace DocumentStatusMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace DocumentTypeMapper
       {
 
-        static const int Command_HASH = HashingUtils::HashString("Command");
-        static const int Policy_HASH = HashingUtils::HashString("Policy");
-        static const int Automation_HASH = HashingUtils::HashString("Automation");
-        static const int Session_HASH = HashingUtils::HashString("Session");
-        static const int Package_HASH = HashingUtils::HashString("Package");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Command",
+          "Policy",
+          "Automation",
+          "Session",
+          "Package",
+        };
 
         DocumentType GetDocumentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Command_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DocumentType::Command;
-          }
-          else if (hashCode == Policy_HASH)
-          {
-            return DocumentType::Policy;
-          }
-          else if (hashCode == Automation_HASH)
-          {
-            return DocumentType::Automation;
-          }
-          else if (hashCode == Session_HASH)
-          {
-            return DocumentType::Session;
-          }
-          else if (hashCode == Package_HASH)
-          {
-            return DocumentType::Package;
+          case -1679919317:
+            if (name == "Command")
+            {
+              return DocumentType::Command;
+            }
+            break;
+          case -1898802862:
+            if (name == "Policy")
+            {
+              return DocumentType::Policy;
+            }
+            break;
+          case -1957301961:
+            if (name == "Automation")
+            {
+              return DocumentType::Automation;
+            }
+            break;
+          case -645326218:
+            if (name == "Session")
+            {
+              return DocumentType::Session;
+            }
+            break;
+          case 857590822:
+            if (name == "Package")
+            {
+              return DocumentType::Package;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return DocumentType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentType(DocumentType enumValue)
+        const char* GetNameForDocumentTypeCStr(DocumentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DocumentType::Command:
-            return "Command";
-          case DocumentType::Policy:
-            return "Policy";
-          case DocumentType::Automation:
-            return "Automation";
-          case DocumentType::Session:
-            return "Session";
-          case DocumentType::Package:
-            return "Package";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDocumentType(DocumentType enumValue)
+        {
+          return GetNameForDocumentTypeCStr(enumValue);
         }
 
       } // namespace DocumentTypeMapper
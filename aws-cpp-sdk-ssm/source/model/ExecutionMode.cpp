@@ -30,20 +30,37 @@ namespace Aws
       namespace ExecutionModeMapper
       {
 
-        static const int Auto_HASH = HashingUtils::HashString("Auto");
-        static const int Interactive_HASH = HashingUtils::HashString("Interactive");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Auto",
+          "Interactive",
+        };
 
         ExecutionMode GetExecutionModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Auto_HASH)
-          {
-            return ExecutionMode::Auto;
-          }
-          else if (hashCode == Interactive_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExecutionMode::Interactive;
+          case 2052559:
+            if (name == "Auto")
+            {
+              return ExecutionMode::Auto;
+            }
+            break;
+          case -782993726:
+            if (name == "Interactive")
+            {
+              return ExecutionMode::Interactive;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ExecutionMode::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionMode(ExecutionMode enumValue)
+        const char* GetNameForExecutionModeCStr(ExecutionMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExecutionMode::Auto:
-            return "Auto";
-          case ExecutionMode::Interactive:
-            return "Interactive";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExecutionMode(ExecutionMode enumValue)
+        {
+          return GetNameForExecutionModeCStr(enumValue);
         }
 
       } // namespace ExecutionModeMapper
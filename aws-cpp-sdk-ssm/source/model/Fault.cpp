@@ -30,25 +30,44 @@ namespace Aws
       namespace FaultMapper
       {
 
-        static const int Client_HASH = HashingUtils::HashString("Client");
-        static const int Server_HASH = HashingUtils::HashString("Server");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Client",
+          "Server",
+          "Unknown",
+        };
 
         Fault GetFaultForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Client_HASH)
-          {
-            return Fault::Client;
-          }
-          else if (hashCode == Server_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Fault::Server;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return Fault::Unknown;
+          case 2021122027:
+            if (name == "Client")
+            {
+              return Fault::Client;
+            }
+            break;
+          case -1821959325:
+            if (name == "Server")
+            {
+              return Fault::Server;
+            }
+            break;
+          case 1379812394:
+            if (name == "Unknown")
+            {
+              return Fault::Unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return Fault::NOT_SET;
         }
 
-        Aws::String GetNameForFault(Fault enumValue)
+        const char* GetNameForFaultCStr(Fault enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Fault::Client:
-            return "Client";
-          case Fault::Server:
-            return "Server";
-          case Fault::Unknown:
-            return "Unknown";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFault(Fault enumValue)
+        {
+          return GetNameForFaultCStr(enumValue);
         }
 
       } // namespace FaultMapper
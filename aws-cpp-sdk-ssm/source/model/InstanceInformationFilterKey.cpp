@@ -30,50 +30,79 @@ namespace Aws
       namespace InstanceInformationFilterKeyMapper
       {
 
-        static const int InstanceIds_HASH = HashingUtils::HashString("InstanceIds");
-        static const int AgentVersion_HASH = HashingUtils::HashString("AgentVersion");
-        static const int PingStatus_HASH = HashingUtils::HashString("PingStatus");
-        static const int PlatformTypes_HASH = HashingUtils::HashString("PlatformTypes");
-        static const int ActivationIds_HASH = HashingUtils::HashString("ActivationIds");
-        static const int IamRole_HASH = HashingUtils::HashString("IamRole");
-        static const int ResourceType_HASH = HashingUtils::HashString("ResourceType");
-        static const int AssociationStatus_HASH = HashingUtils::HashString("AssociationStatus");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InstanceIds",
+          "AgentVersion",
+          "PingStatus",
+          "PlatformTypes",
+          "ActivationIds",
+          "IamRole",
+          "ResourceType",
+          "AssociationStatus",
+        };
 
         InstanceInformationFilterKey GetInstanceInformationFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InstanceIds_HASH)
-          {
-            return InstanceInformationFilterKey::InstanceIds;
-          }
-          else if (hashCode == AgentVersion_HASH)
-          {
-            return InstanceInformationFilterKey::AgentVersion;
-          }
-          else if (hashCode == PingStatus_HASH)
-          {
-            return InstanceInformationFilterKey::PingStatus;
-          }
-          else if (hashCode == PlatformTypes_HASH)
-          {
-            return InstanceInformationFilterKey::PlatformTypes;
-          }
-          else if (hashCode == ActivationIds_HASH)
-          {
-            return InstanceInformationFilterKey::ActivationIds;
-          }
-          else if (hashCode == IamRole_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstanceInformationFilterKey::IamRole;
-          }
-          else if (hashCode == ResourceType_HASH)
-          {
-            return InstanceInformationFilterKey::ResourceType;
-          }
-          else if (hashCode == AssociationStatus_HASH)
-          {
-            return InstanceInformationFilterKey::AssociationStatus;
+          case -434147901:
+            if (name == "InstanceIds")
+            {
+              return InstanceInformationFilterKey::InstanceIds;
+            }
+            break;
+          case 2092320307:
+            if (name == "AgentVersion")
+            {
+              return InstanceInformationFilterKey::AgentVersion;
+            }
+            break;
+          case -1499808732:
+            if (name == "PingStatus")
+            {
+              return InstanceInformationFilterKey::PingStatus;
+            }
+            break;
+          case 1327005606:
+            if (name == "PlatformTypes")
+            {
+              return InstanceInformationFilterKey::PlatformTypes;
+            }
+            break;
+          case -1738265182:
+            if (name == "ActivationIds")
+            {
+              return InstanceInformationFilterKey::ActivationIds;
+            }
+            break;
+          case -1051463605:
+            if (name == "IamRole")
+            {
+              return InstanceInformationFilterKey::IamRole;
+            }
+            break;
+          case -220044152:
+            if (name == "ResourceType")
+            {
+              return InstanceInformationFilterKey::ResourceType;
+            }
+            break;
+          case -961629261:
+            if (name == "AssociationStatus")
+            {
+              return InstanceInformationFilterKey::AssociationStatus;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return InstanceInformationFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceInformationFilterKey(InstanceInformationFilterKey enumValue)
+        const char* GetNameForInstanceInformationFilterKeyCStr(InstanceInformationFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstanceInformationFilterKey::InstanceIds:
-            return "InstanceIds";
-          case InstanceInformationFilterKey::AgentVersion:
-            return "AgentVersion";
-          case InstanceInformationFilterKey::PingStatus:
-            return "PingStatus";
-          case InstanceInformationFilterKey::PlatformTypes:
-            return "PlatformTypes";
-          case InstanceInformationFilterKey::ActivationIds:
-            return "ActivationIds";
-          case InstanceInformationFilterKey::IamRole:
-            return "IamRole";
-          case InstanceInformationFilterKey::ResourceType:
-            return "ResourceType";
-          case InstanceInformationFilterKey::AssociationStatus:
-            return "AssociationStatus";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstanceInformationFilterKey(InstanceInformationFilterKey enumValue)
+        {
+          return GetNameForInstanceInformationFilterKeyCStr(enumValue);
         }
 
       } // namespace InstanceInformationFilterKeyMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace InstancePatchStateOperatorTypeMapper
       {
 
-        static const int Equal_HASH = HashingUtils::HashString("Equal");
-        static const int NotEqual_HASH = HashingUtils::HashString("NotEqual");
-        static const int LessThan_HASH = HashingUtils::HashString("LessThan");
-        static const int GreaterThan_HASH = HashingUtils::HashString("GreaterThan");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Equal",
+          "NotEqual",
+          "LessThan",
+          "GreaterThan",
+        };
 
         InstancePatchStateOperatorType GetInstancePatchStateOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Equal_HASH)
-          {
-            return InstancePatchStateOperatorType::Equal;
-          }
-          else if (hashCode == NotEqual_HASH)
-          {
-            return InstancePatchStateOperatorType::NotEqual;
-          }
-          else if (hashCode == LessThan_HASH)
-          {
-            return InstancePatchStateOperatorType::LessThan;
-          }
-          else if (hashCode == GreaterThan_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InstancePatchStateOperatorType::GreaterThan;
+          case 67204884:
+            if (name == "Equal")
+            {
+              return InstancePatchStateOperatorType::Equal;
+            }
+            break;
+          case 1617099841:
+            if (name == "NotEqual")
+            {
+              return InstancePatchStateOperatorType::NotEqual;
+            }
+            break;
+          case -2140646662:
+            if (name == "LessThan")
+            {
+              return InstancePatchStateOperatorType::LessThan;
+            }
+            break;
+          case -1701951333:
+            if (name == "GreaterThan")
+            {
+              return InstancePatchStateOperatorType::GreaterThan;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return InstancePatchStateOperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForInstancePatchStateOperatorType(InstancePatchStateOperatorType enumValue)
+        const char* GetNameForInstancePatchStateOperatorTypeCStr(InstancePatchStateOperatorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InstancePatchStateOperatorType::Equal:
-            return "Equal";
-          case InstancePatchStateOperatorType::NotEqual:
-            return "NotEqual";
-          case InstancePatchStateOperatorType::LessThan:
-            return "LessThan";
-          case InstancePatchStateOperatorType::GreaterThan:
-            return "GreaterThan";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInstancePatchStateOperatorType(InstancePatchStateOperatorType enumValue)
+        {
+          return GetNameForInstancePatchStateOperatorTypeCStr(enumValue);
         }
 
       } // namespace InstancePatchStateOperatorTypeMapper
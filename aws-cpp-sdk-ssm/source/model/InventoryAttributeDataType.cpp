@@ -30,20 +30,37 @@ namespace Aws
       namespace InventoryAttributeDataTypeMapper
       {
 
-        static const int string_HASH = HashingUtils::HashString("string");
-        static const int number_HASH = HashingUtils::HashString("number");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "string",
+          "number",
+        };
 
         InventoryAttributeDataType GetInventoryAttributeDataTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == string_HASH)
-          {
-            return InventoryAttributeDataType::string;
-          }
-          else if (hashCode == number_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InventoryAttributeDataType::number;
+          case -891985903:
+            if (name == "string")
+            {
+              return InventoryAttributeDataType::string;
+            }
+            break;
+          case -1034364087:
+            if (name == "number")
+            {
+              return InventoryAttributeDataType::number;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InventoryAttributeDataType::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryAttributeDataType(InventoryAttributeDataType enumValue)
+        const char* GetNameForInventoryAttributeDataTypeCStr(InventoryAttributeDataType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InventoryAttributeDataType::string:
-            return "string";
-          case InventoryAttributeDataType::number:
-            return "number";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInventoryAttributeDataType(InventoryAttributeDataType enumValue)
+        {
+          return GetNameForInventoryAttributeDataTypeCStr(enumValue);
         }
 
       } // namespace InventoryAttributeDataTypeMapper
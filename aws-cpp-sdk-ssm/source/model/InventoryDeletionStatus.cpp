@@ -30,20 +30,37 @@ namespace Aws
       namespace InventoryDeletionStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InProgress",
+          "Complete",
+        };
 
         InventoryDeletionStatus GetInventoryDeletionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
-          {
-            return InventoryDeletionStatus::InProgress;
-          }
-          else if (hashCode == Complete_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InventoryDeletionStatus::Complete;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return InventoryDeletionStatus::InProgress;
+            }
+            break;
+          case -534801063:
+            if (name == "Complete")
+            {
+              return InventoryDeletionStatus::Complete;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InventoryDeletionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryDeletionStatus(InventoryDeletionStatus enumValue)
+        const char* GetNameForInventoryDeletionStatusCStr(InventoryDeletionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InventoryDeletionStatus::InProgress:
-            return "InProgress";
-          case InventoryDeletionStatus::Complete:
-            return "Complete";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInventoryDeletionStatus(InventoryDeletionStatus enumValue)
+        {
+          return GetNameForInventoryDeletionStatusCStr(enumValue);
         }
 
       } // namespace InventoryDeletionStatusMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace InventoryQueryOperatorTypeMapper
       {
 
-        static const int Equal_HASH = HashingUtils::HashString("Equal");
-        static const int NotEqual_HASH = HashingUtils::HashString("NotEqual");
-        static const int BeginWith_HASH = HashingUtils::HashString("BeginWith");
-        static const int LessThan_HASH = HashingUtils::HashString("LessThan");
-        static const int GreaterThan_HASH = HashingUtils::HashString("GreaterThan");
-        static const int Exists_HASH = HashingUtils::HashString("Exists");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Equal",
+          "NotEqual",
+          "BeginWith",
+          "LessThan",
+          "GreaterThan",
+          "Exists",
+        };
 
         InventoryQueryOperatorType GetInventoryQueryOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Equal_HASH)
-          {
-            return InventoryQueryOperatorType::Equal;
-          }
-          else if (hashCode == NotEqual_HASH)
-          {
-            return InventoryQueryOperatorType::NotEqual;
-          }
-          else if (hashCode == BeginWith_HASH)
-          {
-            return InventoryQueryOperatorType::BeginWith;
-          }
-          else if (hashCode == LessThan_HASH)
-          {
-            return InventoryQueryOperatorType::LessThan;
-          }
-          else if (hashCode == GreaterThan_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InventoryQueryOperatorType::GreaterThan;
-          }
-          else if (hashCode == Exists_HASH)
-          {
-            return InventoryQueryOperatorType::Exists;
+          case 67204884:
+            if (name == "Equal")
+            {
+              return InventoryQueryOperatorType::Equal;
+            }
+            break;
+          case 1617099841:
+            if (name == "NotEqual")
+            {
+              return InventoryQueryOperatorType::NotEqual;
+            }
+            break;
+          case 931217647:
+            if (name == "BeginWith")
+            {
+              return InventoryQueryOperatorType::BeginWith;
+            }
+            break;
+          case -2140646662:
+            if (name == "LessThan")
+            {
+              return InventoryQueryOperatorType::LessThan;
+            }
+            break;
+          case -1701951333:
+            if (name == "GreaterThan")
+            {
+              return InventoryQueryOperatorType::GreaterThan;
+            }
+            break;
+          case 2089476220:
+            if (name == "Exists")
+            {
+              return InventoryQueryOperatorType::Exists;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return InventoryQueryOperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryQueryOperatorType(InventoryQueryOperatorType enumValue)
+        const char* GetNameForInventoryQueryOperatorTypeCStr(InventoryQueryOperatorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InventoryQueryOperatorType::Equal:
-            return "Equal";
-          case InventoryQueryOperatorType::NotEqual:
-            return "NotEqual";
-          case InventoryQueryOperatorType::BeginWith:
-            return "BeginWith";
-          case InventoryQueryOperatorType::LessThan:
-            return "LessThan";
-          case InventoryQueryOperatorType::GreaterThan:
-            return "GreaterThan";
-          case InventoryQueryOperatorType::Exists:
-            return "Exists";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInventoryQueryOperatorType(InventoryQueryOperatorType enumValue)
+        {
+          return GetNameForInventoryQueryOperatorTypeCStr(enumValue);
         }
 
       } // namespace InventoryQueryOperatorTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace InventorySchemaDeleteOptionMapper
       {
 
-        static const int DisableSchema_HASH = HashingUtils::HashString("DisableSchema");
-        static const int DeleteSchema_HASH = HashingUtils::HashString("DeleteSchema");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DisableSchema",
+          "DeleteSchema",
+        };
 
         InventorySchemaDeleteOption GetInventorySchemaDeleteOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DisableSchema_HASH)
-          {
-            return InventorySchemaDeleteOption::DisableSchema;
-          }
-          else if (hashCode == DeleteSchema_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return InventorySchemaDeleteOption::DeleteSchema;
+          case -58218871:
+            if (name == "DisableSchema")
+            {
+              return InventorySchemaDeleteOption::DisableSchema;
+            }
+            break;
+          case -611725492:
+            if (name == "DeleteSchema")
+            {
+              return InventorySchemaDeleteOption::DeleteSchema;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return InventorySchemaDeleteOption::NOT_SET;
         }
 
-        Aws::String GetNameForInventorySchemaDeleteOption(InventorySchemaDeleteOption enumValue)
+        const char* GetNameForInventorySchemaDeleteOptionCStr(InventorySchemaDeleteOption enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case InventorySchemaDeleteOption::DisableSchema:
-            return "DisableSchema";
-          case InventorySchemaDeleteOption::DeleteSchema:
-            return "DeleteSchema";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForInventorySchemaDeleteOption(InventorySchemaDeleteOption enumValue)
+        {
+          return GetNameForInventorySchemaDeleteOptionCStr(enumValue);
         }
 
       } // namespace InventorySchemaDeleteOptionMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace LastResourceDataSyncStatusMapper
       {
 
-        static const int Successful_HASH = HashingUtils::HashString("Successful");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Successful",
+          "Failed",
+          "InProgress",
+        };
 
         LastResourceDataSyncStatus GetLastResourceDataSyncStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Successful_HASH)
-          {
-            return LastResourceDataSyncStatus::Successful;
-          }
-          else if (hashCode == Failed_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LastResourceDataSyncStatus::Failed;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return LastResourceDataSyncStatus::InProgress;
+          case 1259833018:
+            if (name == "Successful")
+            {
+              return LastResourceDataSyncStatus::Successful;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return LastResourceDataSyncStatus::Failed;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return LastResourceDataSyncStatus::InProgress;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return LastResourceDataSyncStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLastResourceDataSyncStatus(LastResourceDataSyncStatus enumValue)
+        const char* GetNameForLastResourceDataSyncStatusCStr(LastResourceDataSyncStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LastResourceDataSyncStatus::Successful:
-            return "Successful";
-          case LastResourceDataSyncStatus::Failed:
-            return "Failed";
-          case LastResourceDataSyncStatus::InProgress:
-            return "InProgress";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLastResourceDataSyncStatus(LastResourceDataSyncStatus enumValue)
+        {
+          return GetNameForLastResourceDataSyncStatusCStr(enumValue);
         }
 
       } // namespace LastResourceDataSyncStatusMapper
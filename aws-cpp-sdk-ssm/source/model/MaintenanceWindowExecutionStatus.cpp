@@ -30,50 +30,79 @@ namespace Aws
       namespace MaintenanceWindowExecutionStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
-        static const int CANCELLING_HASH = HashingUtils::HashString("CANCELLING");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int SKIPPED_OVERLAPPING_HASH = HashingUtils::HashString("SKIPPED_OVERLAPPING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "IN_PROGRESS",
+          "SUCCESS",
+          "FAILED",
+          "TIMED_OUT",
+          "CANCELLING",
+          "CANCELLED",
+          "SKIPPED_OVERLAPPING",
+        };
 
         MaintenanceWindowExecutionStatus GetMaintenanceWindowExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::PENDING;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::IN_PROGRESS;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::FAILED;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::TIMED_OUT;
-          }
-          else if (hashCode == CANCELLING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MaintenanceWindowExecutionStatus::CANCELLING;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::CANCELLED;
-          }
-          else if (hashCode == SKIPPED_OVERLAPPING_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::SKIPPED_OVERLAPPING;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return MaintenanceWindowExecutionStatus::PENDING;
+            }
+            break;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return MaintenanceWindowExecutionStatus::IN_PROGRESS;
+            }
+            break;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return MaintenanceWindowExecutionStatus::SUCCESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return MaintenanceWindowExecutionStatus::FAILED;
+            }
+            break;
+          case -1466757626:
+            if (name == "TIMED_OUT")
+            {
+              return MaintenanceWindowExecutionStatus::TIMED_OUT;
+            }
+            break;
+          case -1920533136:
+            if (name == "CANCELLING")
+            {
+              return MaintenanceWindowExecutionStatus::CANCELLING;
+            }
+            break;
+          case -1031784143:
+            if (name == "CANCELLED")
+            {
+              return MaintenanceWindowExecutionStatus::CANCELLED;
+            }
+            break;
+          case 1437996906:
+            if (name == "SKIPPED_OVERLAPPING")
+            {
+              return MaintenanceWindowExecutionStatus::SKIPPED_OVERLAPPING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,35 +114,26 @@ namespace Aws
           return MaintenanceWindowExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForMaintenanceWindowExecutionStatus(MaintenanceWindowExecutionStatus enumValue)
+        const char* GetNameForMaintenanceWindowExecutionStatusCStr(MaintenanceWindowExecutionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MaintenanceWindowExecutionStatus::PENDING:
-            return "PENDING";
-          case MaintenanceWindowExecutionStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case MaintenanceWindowExecutionStatus::SUCCESS:
-            return "SUCCESS";
-          case MaintenanceWindowExecutionStatus::FAILED:
-            return "FAILED";
-          case MaintenanceWindowExecutionStatus::TIMED_OUT:
-            return "TIMED_OUT";
-          case MaintenanceWindowExecutionStatus::CANCELLING:
-            return "CANCELLING";
-          case MaintenanceWindowExecutionStatus::CANCELLED:
-            return "CANCELLED";
-          case MaintenanceWindowExecutionStatus::SKIPPED_OVERLAPPING:
-            return "SKIPPED_OVERLAPPING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMaintenanceWindowExecutionStatus(MaintenanceWindowExecutionStatus enumValue)
+        {
+          return GetNameForMaintenanceWindowExecutionStatusCStr(enumValue);
         }
 
       } // namespace MaintenanceWindowExecutionStatusMapper
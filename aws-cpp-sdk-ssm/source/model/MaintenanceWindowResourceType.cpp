@@ -30,15 +30,30 @@ namespace Aws
       namespace MaintenanceWindowResourceTypeMapper
       {
 
-        static const int INSTANCE_HASH = HashingUtils::HashString("INSTANCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INSTANCE",
+        };
 
         MaintenanceWindowResourceType GetMaintenanceWindowResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSTANCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MaintenanceWindowResourceType::INSTANCE;
+          case 1337754773:
+            if (name == "INSTANCE")
+            {
+              return MaintenanceWindowResourceType::INSTANCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return MaintenanceWindowResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForMaintenanceWindowResourceType(MaintenanceWindowResourceType enumValue)
+        const char* GetNameForMaintenanceWindowResourceTypeCStr(MaintenanceWindowResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MaintenanceWindowResourceType::INSTANCE:
-            return "INSTANCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMaintenanceWindowResourceType(MaintenanceWindowResourceType enumValue)
+        {
+          return GetNameForMaintenanceWindowResourceTypeCStr(enumValue);
         }
 
       } // namespace MaintenanceWindowResourceTypeMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace MaintenanceWindowTaskTypeMapper
       {
 
-        static const int RUN_COMMAND_HASH = HashingUtils::HashString("RUN_COMMAND");
-        static const int AUTOMATION_HASH = HashingUtils::HashString("AUTOMATION");
-        static const int STEP_FUNCTIONS_HASH = HashingUtils::HashString("STEP_FUNCTIONS");
-        static const int LAMBDA_HASH = HashingUtils::HashString("LAMBDA");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RUN_COMMAND",
+          "AUTOMATION",
+          "STEP_FUNCTIONS",
+          "LAMBDA",
+        };
 
         MaintenanceWindowTaskType GetMaintenanceWindowTaskTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RUN_COMMAND_HASH)
-          {
-            return MaintenanceWindowTaskType::RUN_COMMAND;
-          }
-          else if (hashCode == AUTOMATION_HASH)
-          {
-            return MaintenanceWindowTaskType::AUTOMATION;
-          }
-          else if (hashCode == STEP_FUNCTIONS_HASH)
-          {
-            return MaintenanceWindowTaskType::STEP_FUNCTIONS;
-          }
-          else if (hashCode == LAMBDA_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MaintenanceWindowTaskType::LAMBDA;
+          case -360794793:
+            if (name == "RUN_COMMAND")
+            {
+              return MaintenanceWindowTaskType::RUN_COMMAND;
+            }
+            break;
+          case 829292823:
+            if (name == "AUTOMATION")
+            {
+              return MaintenanceWindowTaskType::AUTOMATION;
+            }
+            break;
+          case 1563951560:
+            if (name == "STEP_FUNCTIONS")
+            {
+              return MaintenanceWindowTaskType::STEP_FUNCTIONS;
+            }
+            break;
+          case -2056763449:
+            if (name == "LAMBDA")
+            {
+              return MaintenanceWindowTaskType::LAMBDA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return MaintenanceWindowTaskType::NOT_SET;
         }
 
-        Aws::String GetNameForMaintenanceWindowTaskType(MaintenanceWindowTaskType enumValue)
+        const char* GetNameForMaintenanceWindowTaskTypeCStr(MaintenanceWindowTaskType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MaintenanceWindowTaskType::RUN_COMMAND:
-            return "RUN_COMMAND";
-          case MaintenanceWindowTaskType::AUTOMATION:
-            return "AUTOMATION";
-          case MaintenanceWindowTaskType::STEP_FUNCTIONS:
-            return "STEP_FUNCTIONS";
-          case MaintenanceWindowTaskType::LAMBDA:
-            return "LAMBDA";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMaintenanceWindowTaskType(MaintenanceWindowTaskType enumValue)
+        {
+          return GetNameForMaintenanceWindowTaskTypeCStr(enumValue);
         }
 
       } // namespace MaintenanceWindowTaskTypeMapper
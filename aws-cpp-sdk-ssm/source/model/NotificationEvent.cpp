@@ -30,40 +30,65 @@ namespace Aws
       namespace NotificationEventMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "All",
+          "InProgress",
+          "Success",
+          "TimedOut",
+          "Cancelled",
+          "Failed",
+        };
 
         NotificationEvent GetNotificationEventForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
-          {
-            return NotificationEvent::All;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return NotificationEvent::InProgress;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return NotificationEvent::Success;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
-            return NotificationEvent::TimedOut;
-          }
-          else if (hashCode == Cancelled_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NotificationEvent::Cancelled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return NotificationEvent::Failed;
+          case 65921:
+            if (name == "All")
+            {
+              return NotificationEvent::All;
+            }
+            break;
+          case 646453906:
+            if (name == "InProgress")
+            {
+              return NotificationEvent::InProgress;
+            }
+            break;
+          case -202516509:
+            if (name == "Success")
+            {
+              return NotificationEvent::Success;
+            }
+            break;
+          case -2012269385:
+            if (name == "TimedOut")
+            {
+              return NotificationEvent::TimedOut;
+            }
+            break;
+          case -1814410959:
+            if (name == "Cancelled")
+            {
+              return NotificationEvent::Cancelled;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return NotificationEvent::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return NotificationEvent::NOT_SET;
         }
 
-        Aws::String GetNameForNotificationEvent(NotificationEvent enumValue)
+        const char* GetNameForNotificationEventCStr(NotificationEvent enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NotificationEvent::All:
-            return "All";
-          case NotificationEvent::InProgress:
-            return "InProgress";
-          case NotificationEvent::Success:
-            return "Success";
-          case NotificationEvent::TimedOut:
-            return "TimedOut";
-          case NotificationEvent::Cancelled:
-            return "Cancelled";
-          case NotificationEvent::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNotificationEvent(NotificationEvent enumValue)
+        {
+          return GetNameForNotificationEventCStr(enumValue);
         }
 
       } // namespace NotificationEventMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace NotificationTypeMapper
       {
 
-        static const int Command_HASH = HashingUtils::HashString("Command");
-        static const int Invocation_HASH = HashingUtils::HashString("Invocation");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Command",
+          "Invocation",
+        };
 
         NotificationType GetNotificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Command_HASH)
-          {
-            return NotificationType::Command;
-          }
-          else if (hashCode == Invocation_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return NotificationType::Invocation;
+          case -1679919317:
+            if (name == "Command")
+            {
+              return NotificationType::Command;
+            }
+            break;
+          case -562801488:
+            if (name == "Invocation")
+            {
+              return NotificationType::Invocation;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return NotificationType::NOT_SET;
         }
 
-        Aws::String GetNameForNotificationType(NotificationType enumValue)
+        const char* GetNameForNotificationTypeCStr(NotificationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case NotificationType::Command:
-            return "Command";
-          case NotificationType::Invocation:
-            return "Invocation";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForNotificationType(NotificationType enumValue)
+        {
+          return GetNameForNotificationTypeCStr(enumValue);
         }
 
       } // namespace NotificationTypeMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace OperatingSystemMapper
       {
 
-        static const int WINDOWS_HASH = HashingUtils::HashString("WINDOWS");
-        static const int AMAZON_LINUX_HASH = HashingUtils::HashString("AMAZON_LINUX");
-        static const int AMAZON_LINUX_2_HASH = HashingUtils::HashString("AMAZON_LINUX_2");
-        static const int UBUNTU_HASH = HashingUtils::HashString("UBUNTU");
-        static const int REDHAT_ENTERPRISE_LINUX_HASH = HashingUtils::HashString("REDHAT_ENTERPRISE_LINUX");
-        static const int SUSE_HASH = HashingUtils::HashString("SUSE");
-        static const int CENTOS_HASH = HashingUtils::HashString("CENTOS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WINDOWS",
+          "AMAZON_LINUX",
+          "AMAZON_LINUX_2",
+          "UBUNTU",
+          "REDHAT_ENTERPRISE_LINUX",
+          "SUSE",
+          "CENTOS",
+        };
 
         OperatingSystem GetOperatingSystemForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WINDOWS_HASH)
-          {
-            return OperatingSystem::WINDOWS;
-          }
-          else if (hashCode == AMAZON_LINUX_HASH)
-          {
-            return OperatingSystem::AMAZON_LINUX;
-          }
-          else if (hashCode == AMAZON_LINUX_2_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperatingSystem::AMAZON_LINUX_2;
-          }
-          else if (hashCode == UBUNTU_HASH)
-          {
-            return OperatingSystem::UBUNTU;
-          }
-          else if (hashCode == REDHAT_ENTERPRISE_LINUX_HASH)
-          {
-            return OperatingSystem::REDHAT_ENTERPRISE_LINUX;
-          }
-          else if (hashCode == SUSE_HASH)
-          {
-            return OperatingSystem::SUSE;
-          }
-          else if (hashCode == CENTOS_HASH)
-          {
-            return OperatingSystem::CENTOS;
+          case 2067476067:
+            if (name == "WINDOWS")
+            {
+              return OperatingSystem::WINDOWS;
+            }
+            break;
+          case -1230363943:
+            if (name == "AMAZON_LINUX")
+            {
+              return OperatingSystem::AMAZON_LINUX;
+            }
+            break;
+          case -1263739828:
+            if (name == "AMAZON_LINUX_2")
+            {
+              return OperatingSystem::AMAZON_LINUX_2;
+            }
+            break;
+          case -1797927193:
+            if (name == "UBUNTU")
+            {
+              return OperatingSystem::UBUNTU;
+            }
+            break;
+          case -630826581:
+            if (name == "REDHAT_ENTERPRISE_LINUX")
+            {
+              return OperatingSystem::REDHAT_ENTERPRISE_LINUX;
+            }
+            break;
+          case 2556980:
+            if (name == "SUSE")
+            {
+              return OperatingSystem::SUSE;
+            }
+            break;
+          case 1984283020:
+            if (name == "CENTOS")
+            {
+              return OperatingSystem::CENTOS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return OperatingSystem::NOT_SET;
         }
 
-        Aws::String GetNameForOperatingSystem(OperatingSystem enumValue)
+        const char* GetNameForOperatingSystemCStr(OperatingSystem enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperatingSystem::WINDOWS:
-            return "WINDOWS";
-          case OperatingSystem::AMAZON_LINUX:
-            return "AMAZON_LINUX";
-          case OperatingSystem::AMAZON_LINUX_2:
-            return "AMAZON_LINUX_2";
-          case OperatingSystem::UBUNTU:
-            return "UBUNTU";
-          case OperatingSystem::REDHAT_ENTERPRISE_LINUX:
-            return "REDHAT_ENTERPRISE_LINUX";
-          case OperatingSystem::SUSE:
-            return "SUSE";
-          case OperatingSystem::CENTOS:
-            return "CENTOS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperatingSystem(OperatingSystem enumValue)
+        {
+          return GetNameForOperatingSystemCStr(enumValue);
         }
 
       } // namespace OperatingSystemMapper
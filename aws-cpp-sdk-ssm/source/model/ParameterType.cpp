@@ -30,25 +30,44 @@ namespace Aws
       namespace ParameterTypeMapper
       {
 
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int StringList_HASH = HashingUtils::HashString("StringList");
-        static const int SecureString_HASH = HashingUtils::HashString("SecureString");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "String",
+          "StringList",
+          "SecureString",
+        };
 
         ParameterType GetParameterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == String_HASH)
-          {
-            return ParameterType::String;
-          }
-          else if (hashCode == StringList_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ParameterType::StringList;
-          }
-          else if (hashCode == SecureString_HASH)
-          {
-            return ParameterType::SecureString;
+          case -1808118735:
+            if (name == "String")
+            {
+              return ParameterType::String;
+            }
+            break;
+          case 420147311:
+            if (name == "StringList")
+            {
+              return ParameterType::StringList;
+            }
+            break;
+          case 769017480:
+            if (name == "SecureString")
+            {
+              return ParameterType::SecureString;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ParameterType::NOT_SET;
         }
 
-        Aws::String GetNameForParameterType(ParameterType enumValue)
+        const char* GetNameForParameterTypeCStr(ParameterType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ParameterType::String:
-            return "String";
-          case ParameterType::StringList:
-            return "StringList";
-          case ParameterType::SecureString:
-            return "SecureString";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForParameterType(ParameterType enumValue)
+        {
+          return GetNameForParameterTypeCStr(enumValue);
         }
 
       } // namespace ParameterTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ParametersFilterKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int Type_HASH = HashingUtils::HashString("Type");
-        static const int KeyId_HASH = HashingUtils::HashString("KeyId");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Name",
+          "Type",
+          "KeyId",
+        };
 
         ParametersFilterKey GetParametersFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
-          {
-            return ParametersFilterKey::Name;
-          }
-          else if (hashCode == Type_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ParametersFilterKey::Type;
-          }
-          else if (hashCode == KeyId_HASH)
-          {
-            return ParametersFilterKey::KeyId;
+          case 2420395:
+            if (name == "Name")
+            {
+              return ParametersFilterKey::Name;
+            }
+            break;
+          case 2622298:
+            if (name == "Type")
+            {
+              return ParametersFilterKey::Type;
+            }
+            break;
+          case 72391610:
+            if (name == "KeyId")
+            {
+              return ParametersFilterKey::KeyId;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ParametersFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForParametersFilterKey(ParametersFilterKey enumValue)
+        const char* GetNameForParametersFilterKeyCStr(ParametersFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ParametersFilterKey::Name:
-            return "Name";
-          case ParametersFilterKey::Type:
-            return "Type";
-          case ParametersFilterKey::KeyId:
-            return "KeyId";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForParametersFilterKey(ParametersFilterKey enumValue)
+        {
+          return GetNameForParametersFilterKeyCStr(enumValue);
         }
 
       } // namespace ParametersFilterKeyMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace PatchActionMapper
       {
 
-        static const int ALLOW_AS_DEPENDENCY_HASH = HashingUtils::HashString("ALLOW_AS_DEPENDENCY");
-        static const int BLOCK_HASH = HashingUtils::HashString("BLOCK");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALLOW_AS_DEPENDENCY",
+          "BLOCK",
+        };
 
         PatchAction GetPatchActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALLOW_AS_DEPENDENCY_HASH)
-          {
-            return PatchAction::ALLOW_AS_DEPENDENCY;
-          }
-          else if (hashCode == BLOCK_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PatchAction::BLOCK;
+          case -420046110:
+            if (name == "ALLOW_AS_DEPENDENCY")
+            {
+              return PatchAction::ALLOW_AS_DEPENDENCY;
+            }
+            break;
+          case 63294573:
+            if (name == "BLOCK")
+            {
+              return PatchAction::BLOCK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PatchAction::NOT_SET;
         }
 
-        Aws::String GetNameForPatchAction(PatchAction enumValue)
+        const char* GetNameForPatchActionCStr(PatchAction enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PatchAction::ALLOW_AS_DEPENDENCY:
-            return "ALLOW_AS_DEPENDENCY";
-          case PatchAction::BLOCK:
-            return "BLOCK";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPatchAction(PatchAction enumValue)
+        {
+          return GetNameForPatchActionCStr(enumValue);
         }
 
       } // namespace PatchActionMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace PatchComplianceDataStateMapper
       {
 
-        static const int INSTALLED_HASH = HashingUtils::HashString("INSTALLED");
-        static const int INSTALLED_OTHER_HASH = HashingUtils::HashString("INSTALLED_OTHER");
-        static const int INSTALLED_REJECTED_HASH = HashingUtils::HashString("INSTALLED_REJECTED");
-        static const int MISSING_HASH = HashingUtils::HashString("MISSING");
-        static const int NOT_APPLICABLE_HASH = HashingUtils::HashString("NOT_APPLICABLE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INSTALLED",
+          "INSTALLED_OTHER",
+          "INSTALLED_REJECTED",
+          "MISSING",
+          "NOT_APPLICABLE",
+          "FAILED",
+        };
 
         PatchComplianceDataState GetPatchComplianceDataStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSTALLED_HASH)
-          {
-            return PatchComplianceDataState::INSTALLED;
-          }
-          else if (hashCode == INSTALLED_OTHER_HASH)
-          {
-            return PatchComplianceDataState::INSTALLED_OTHER;
-          }
-          else if (hashCode == INSTALLED_REJECTED_HASH)
-          {
-            return PatchComplianceDataState::INSTALLED_REJECTED;
-          }
-          else if (hashCode == MISSING_HASH)
-          {
-            return PatchComplianceDataState::MISSING;
-          }
-          else if (hashCode == NOT_APPLICABLE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PatchComplianceDataState::NOT_APPLICABLE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return PatchComplianceDataState::FAILED;
+          case -1479325862:
+            if (name == "INSTALLED")
+            {
+              return PatchComplianceDataState::INSTALLED;
+            }
+            break;
+          case 1469040075:
+            if (name == "INSTALLED_OTHER")
+            {
+              return PatchComplianceDataState::INSTALLED_OTHER;
+            }
+            break;
+          case -981167165:
+            if (name == "INSTALLED_REJECTED")
+            {
+              return PatchComplianceDataState::INSTALLED_REJECTED;
+            }
+            break;
+          case 1787432262:
+            if (name == "MISSING")
+            {
+              return PatchComplianceDataState::MISSING;
+            }
+            break;
+          case 978028715:
+            if (name == "NOT_APPLICABLE")
+            {
+              return PatchComplianceDataState::NOT_APPLICABLE;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return PatchComplianceDataState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return PatchComplianceDataState::NOT_SET;
         }
 
-        Aws::String GetNameForPatchComplianceDataState(PatchComplianceDataState enumValue)
+        const char* GetNameForPatchComplianceDataStateCStr(PatchComplianceDataState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PatchComplianceDataState::INSTALLED:
-            return "INSTALLED";
-          case PatchComplianceDataState::INSTALLED_OTHER:
-            return "INSTALLED_OTHER";
-          case PatchComplianceDataState::INSTALLED_REJECTED:
-            return "INSTALLED_REJECTED";
-          case PatchComplianceDataState::MISSING:
-            return "MISSING";
-          case PatchComplianceDataState::NOT_APPLICABLE:
-            return "NOT_APPLICABLE";
-          case PatchComplianceDataState::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPatchComplianceDataState(PatchComplianceDataState enumValue)
+        {
+          return GetNameForPatchComplianceDataStateCStr(enumValue);
         }
 
       } // namespace PatchComplianceDataStateMapper
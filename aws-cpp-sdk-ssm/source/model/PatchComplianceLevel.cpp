@@ -30,40 +30,65 @@ namespace Aws
       namespace PatchComplianceLevelMapper
       {
 
-        static const int CRITICAL_HASH = HashingUtils::HashString("CRITICAL");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int INFORMATIONAL_HASH = HashingUtils::HashString("INFORMATIONAL");
-        static const int UNSPECIFIED_HASH = HashingUtils::HashString("UNSPECIFIED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CRITICAL",
+          "HIGH",
+          "MEDIUM",
+          "LOW",
+          "INFORMATIONAL",
+          "UNSPECIFIED",
+        };
 
         PatchComplianceLevel GetPatchComplianceLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CRITICAL_HASH)
-          {
-            return PatchComplianceLevel::CRITICAL;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return PatchComplianceLevel::HIGH;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return PatchComplianceLevel::MEDIUM;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return PatchComplianceLevel::LOW;
-          }
-          else if (hashCode == INFORMATIONAL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PatchComplianceLevel::INFORMATIONAL;
-          }
-          else if (hashCode == UNSPECIFIED_HASH)
-          {
-            return PatchComplianceLevel::UNSPECIFIED;
+          case -1560189025:
+            if (name == "CRITICAL")
+            {
+              return PatchComplianceLevel::CRITICAL;
+            }
+            break;
+          case 2217378:
+            if (name == "HIGH")
+            {
+              return PatchComplianceLevel::HIGH;
+            }
+            break;
+          case -2024701067:
+            if (name == "MEDIUM")
+            {
+              return PatchComplianceLevel::MEDIUM;
+            }
+            break;
+          case 75572:
+            if (name == "LOW")
+            {
+              return PatchComplianceLevel::LOW;
+            }
+            break;
+          case 860618295:
+            if (name == "INFORMATIONAL")
+            {
+              return PatchComplianceLevel::INFORMATIONAL;
+            }
+            break;
+          case 526786327:
+            if (name == "UNSPECIFIED")
+            {
+              return PatchComplianceLevel::UNSPECIFIED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return PatchComplianceLevel::NOT_SET;
         }
 
-        Aws::String GetNameForPatchComplianceLevel(PatchComplianceLevel enumValue)
+        const char* GetNameForPatchComplianceLevelCStr(PatchComplianceLevel enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PatchComplianceLevel::CRITICAL:
-            return "CRITICAL";
-          case PatchComplianceLevel::HIGH:
-            return "HIGH";
-          case PatchComplianceLevel::MEDIUM:
-            return "MEDIUM";
-          case PatchComplianceLevel::LOW:
-            return "LOW";
-          case PatchComplianceLevel::INFORMATIONAL:
-            return "INFORMATIONAL";
-          case PatchComplianceLevel::UNSPECIFIED:
-            return "UNSPECIFIED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPatchComplianceLevel(PatchComplianceLevel enumValue)
+        {
+          return GetNameForPatchComplianceLevelCStr(enumValue);
         }
 
       } // namespace PatchComplianceLevelMapper
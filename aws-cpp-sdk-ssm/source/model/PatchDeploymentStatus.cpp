@@ -30,30 +30,51 @@ namespace Aws
       namespace PatchDeploymentStatusMapper
       {
 
-        static const int APPROVED_HASH = HashingUtils::HashString("APPROVED");
-        static const int PENDING_APPROVAL_HASH = HashingUtils::HashString("PENDING_APPROVAL");
-        static const int EXPLICIT_APPROVED_HASH = HashingUtils::HashString("EXPLICIT_APPROVED");
-        static const int EXPLICIT_REJECTED_HASH = HashingUtils::HashString("EXPLICIT_REJECTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "APPROVED",
+          "PENDING_APPROVAL",
+          "EXPLICIT_APPROVED",
+          "EXPLICIT_REJECTED",
+        };
 
         PatchDeploymentStatus GetPatchDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == APPROVED_HASH)
-          {
-            return PatchDeploymentStatus::APPROVED;
-          }
-          else if (hashCode == PENDING_APPROVAL_HASH)
-          {
-            return PatchDeploymentStatus::PENDING_APPROVAL;
-          }
-          else if (hashCode == EXPLICIT_APPROVED_HASH)
-          {
-            return PatchDeploymentStatus::EXPLICIT_APPROVED;
-          }
-          else if (hashCode == EXPLICIT_REJECTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PatchDeploymentStatus::EXPLICIT_REJECTED;
+          case 1967871671:
+            if (name == "APPROVED")
+            {
+              return PatchDeploymentStatus::APPROVED;
+            }
+            break;
+          case -1400920053:
+            if (name == "PENDING_APPROVAL")
+            {
+              return PatchDeploymentStatus::PENDING_APPROVAL;
+            }
+            break;
+          case -1993216926:
+            if (name == "EXPLICIT_APPROVED")
+            {
+              return PatchDeploymentStatus::EXPLICIT_APPROVED;
+            }
+            break;
+          case 508009001:
+            if (name == "EXPLICIT_REJECTED")
+            {
+              return PatchDeploymentStatus::EXPLICIT_REJECTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return PatchDeploymentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPatchDeploymentStatus(PatchDeploymentStatus enumValue)
+        const char* GetNameForPatchDeploymentStatusCStr(PatchDeploymentStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PatchDeploymentStatus::APPROVED:
-            return "APPROVED";
-          case PatchDeploymentStatus::PENDING_APPROVAL:
-            return "PENDING_APPROVAL";
-          case PatchDeploymentStatus::EXPLICIT_APPROVED:
-            return "EXPLICIT_APPROVED";
-          case PatchDeploymentStatus::EXPLICIT_REJECTED:
-            return "EXPLICIT_REJECTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPatchDeploymentStatus(PatchDeploymentStatus enumValue)
+        {
+          return GetNameForPatchDeploymentStatusCStr(enumValue);
         }
 
       } // namespace PatchDeploymentStatusMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace PatchFilterKeyMapper
       {
 
-        static const int PRODUCT_HASH = HashingUtils::HashString("PRODUCT");
-        static const int CLASSIFICATION_HASH = HashingUtils::HashString("CLASSIFICATION");
-        static const int MSRC_SEVERITY_HASH = HashingUtils::HashString("MSRC_SEVERITY");
-        static const int PATCH_ID_HASH = HashingUtils::HashString("PATCH_ID");
-        static const int SECTION_HASH = HashingUtils::HashString("SECTION");
-        static const int PRIORITY_HASH = HashingUtils::HashString("PRIORITY");
-        static const int SEVERITY_HASH = HashingUtils::HashString("SEVERITY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PRODUCT",
+          "CLASSIFICATION",
+          "MSRC_SEVERITY",
+          "PATCH_ID",
+          "SECTION",
+          "PRIORITY",
+          "SEVERITY",
+        };
 
         PatchFilterKey GetPatchFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRODUCT_HASH)
-          {
-            return PatchFilterKey::PRODUCT;
-          }
-          else if (hashCode == CLASSIFICATION_HASH)
-          {
-            return PatchFilterKey::CLASSIFICATION;
-          }
-          else if (hashCode == MSRC_SEVERITY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PatchFilterKey::MSRC_SEVERITY;
-          }
-          else if (hashCode == PATCH_ID_HASH)
-          {
-            return PatchFilterKey::PATCH_ID;
-          }
-          else if (hashCode == SECTION_HASH)
-          {
-            return PatchFilterKey::SECTION;
-          }
-          else if (hashCode == PRIORITY_HASH)
-          {
-            return PatchFilterKey::PRIORITY;
-          }
-          else if (hashCode == SEVERITY_HASH)
-          {
-            return PatchFilterKey::SEVERITY;
+          case 408508623:
+            if (name == "PRODUCT")
+            {
+              return PatchFilterKey::PRODUCT;
+            }
+            break;
+          case -1798367258:
+            if (name == "CLASSIFICATION")
+            {
+              return PatchFilterKey::CLASSIFICATION;
+            }
+            break;
+          case 1755554789:
+            if (name == "MSRC_SEVERITY")
+            {
+              return PatchFilterKey::MSRC_SEVERITY;
+            }
+            break;
+          case 2013033618:
+            if (name == "PATCH_ID")
+            {
+              return PatchFilterKey::PATCH_ID;
+            }
+            break;
+          case -1606743355:
+            if (name == "SECTION")
+            {
+              return PatchFilterKey::SECTION;
+            }
+            break;
+          case -382834268:
+            if (name == "PRIORITY")
+            {
+              return PatchFilterKey::PRIORITY;
+            }
+            break;
+          case -2034040067:
+            if (name == "SEVERITY")
+            {
+              return PatchFilterKey::SEVERITY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return PatchFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForPatchFilterKey(PatchFilterKey enumValue)
+        const char* GetNameForPatchFilterKeyCStr(PatchFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PatchFilterKey::PRODUCT:
-            return "PRODUCT";
-          case PatchFilterKey::CLASSIFICATION:
-            return "CLASSIFICATION";
-          case PatchFilterKey::MSRC_SEVERITY:
-            return "MSRC_SEVERITY";
-          case PatchFilterKey::PATCH_ID:
-            return "PATCH_ID";
-          case PatchFilterKey::SECTION:
-            return "SECTION";
-          case PatchFilterKey::PRIORITY:
-            return "PRIORITY";
-          case PatchFilterKey::SEVERITY:
-            return "SEVERITY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPatchFilterKey(PatchFilterKey enumValue)
+        {
+          return GetNameForPatchFilterKeyCStr(enumValue);
         }
 
       } // namespace PatchFilterKeyMapper
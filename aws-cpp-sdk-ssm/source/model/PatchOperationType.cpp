@@ -30,20 +30,37 @@ namespace Aws
       namespace PatchOperationTypeMapper
       {
 
-        static const int Scan_HASH = HashingUtils::HashString("Scan");
-        static const int Install_HASH = HashingUtils::HashString("Install");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Scan",
+          "Install",
+        };
 
         PatchOperationType GetPatchOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Scan_HASH)
-          {
-            return PatchOperationType::Scan;
-          }
-          else if (hashCode == Install_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PatchOperationType::Install;
+          case 2570909:
+            if (name == "Scan")
+            {
+              return PatchOperationType::Scan;
+            }
+            break;
+          case -672744069:
+            if (name == "Install")
+            {
+              return PatchOperationType::Install;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PatchOperationType::NOT_SET;
         }
 
-        Aws::String GetNameForPatchOperationType(PatchOperationType enumValue)
+        const char* GetNameForPatchOperationTypeCStr(PatchOperationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PatchOperationType::Scan:
-            return "Scan";
-          case PatchOperationType::Install:
-            return "Install";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPatchOperationType(PatchOperationType enumValue)
+        {
+          return GetNameForPatchOperationTypeCStr(enumValue);
         }
 
       } // namespace PatchOperationTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace PingStatusMapper
       {
 
-        static const int Online_HASH = HashingUtils::HashString("Online");
-        static const int ConnectionLost_HASH = HashingUtils::HashString("ConnectionLost");
-        static const int Inactive_HASH = HashingUtils::HashString("Inactive");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Online",
+          "ConnectionLost",
+          "Inactive",
+        };
 
         PingStatus GetPingStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Online_HASH)
-          {
-            return PingStatus::Online;
-          }
-          else if (hashCode == ConnectionLost_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PingStatus::ConnectionLost;
-          }
-          else if (hashCode == Inactive_HASH)
-          {
-            return PingStatus::Inactive;
+          case -1928355213:
+            if (name == "Online")
+            {
+              return PingStatus::Online;
+            }
+            break;
+          case 267970370:
+            if (name == "ConnectionLost")
+            {
+              return PingStatus::ConnectionLost;
+            }
+            break;
+          case 89309323:
+            if (name == "Inactive")
+            {
+              return PingStatus::Inactive;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PingStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPingStatus(PingStatus enumValue)
+        const char* GetNameForPingStatusCStr(PingStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PingStatus::Online:
-            return "Online";
-          case PingStatus::ConnectionLost:
-            return "ConnectionLost";
-          case PingStatus::Inactive:
-            return "Inactive";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPingStatus(PingStatus enumValue)
+        {
+          return GetNameForPingStatusCStr(enumValue);
         }
 
       } // namespace PingStatusMapper
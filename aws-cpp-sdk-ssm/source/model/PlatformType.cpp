@@ -30,20 +30,37 @@ namespace Aws
       namespace PlatformTypeMapper
       {
 
-        static const int Windows_HASH = HashingUtils::HashString("Windows");
-        static const int Linux_HASH = HashingUtils::HashString("Linux");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Windows",
+          "Linux",
+        };
 
         PlatformType GetPlatformTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Windows_HASH)
-          {
-            return PlatformType::Windows;
-          }
-          else if (hashCode == Linux_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PlatformType::Linux;
+          case -1280820637:
+            if (name == "Windows")
+            {
+              return PlatformType::Windows;
+            }
+            break;
+          case 73425108:
+            if (name == "Linux")
+            {
+              return PlatformType::Linux;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return PlatformType::NOT_SET;
         }
 
-        Aws::String GetNameForPlatformType(PlatformType enumValue)
+        const char* GetNameForPlatformTypeCStr(PlatformType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PlatformType::Windows:
-            return "Windows";
-          case PlatformType::Linux:
-            return "Linux";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPlatformType(PlatformType enumValue)
+        {
+          return GetNameForPlatformTypeCStr(enumValue);
         }
 
       } // namespace PlatformTypeMapper
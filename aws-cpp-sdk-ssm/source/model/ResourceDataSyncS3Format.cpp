@@ -30,15 +30,30 @@ namespace Aws
       namespace ResourceDataSyncS3FormatMapper
       {
 
-        static const int JsonSerDe_HASH = HashingUtils::HashString("JsonSerDe");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "JsonSerDe",
+        };
 
         ResourceDataSyncS3Format GetResourceDataSyncS3FormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JsonSerDe_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceDataSyncS3Format::JsonSerDe;
+          case 909721817:
+            if (name == "JsonSerDe")
+            {
+              return ResourceDataSyncS3Format::JsonSerDe;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ResourceDataSyncS3Format::NOT_SET;
         }
 
-        Aws::String GetNameForResourceDataSyncS3Format(ResourceDataSyncS3Format enumValue)
+        const char* GetNameForResourceDataSyncS3FormatCStr(ResourceDataSyncS3Format enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceDataSyncS3Format::JsonSerDe:
-            return "JsonSerDe";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceDataSyncS3Format(ResourceDataSyncS3Format enumValue)
+        {
+          return GetNameForResourceDataSyncS3FormatCStr(enumValue);
         }
 
       } // namespace ResourceDataSyncS3FormatMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int ManagedInstance_HASH = HashingUtils::HashString("ManagedInstance");
-        static const int Document_HASH = HashingUtils::HashString("Document");
-        static const int EC2Instance_HASH = HashingUtils::HashString("EC2Instance");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ManagedInstance",
+          "Document",
+          "EC2Instance",
+        };
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ManagedInstance_HASH)
-          {
-            return ResourceType::ManagedInstance;
-          }
-          else if (hashCode == Document_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceType::Document;
-          }
-          else if (hashCode == EC2Instance_HASH)
-          {
-            return ResourceType::EC2Instance;
+          case 1531883828:
+            if (name == "ManagedInstance")
+            {
+              return ResourceType::ManagedInstance;
+            }
+            break;
+          case 926364987:
+            if (name == "Document")
+            {
+              return ResourceType::Document;
+            }
+            break;
+          case 724267017:
+            if (name == "EC2Instance")
+            {
+              return ResourceType::EC2Instance;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceTypeCStr(ResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceType::ManagedInstance:
-            return "ManagedInstance";
-          case ResourceType::Document:
-            return "Document";
-          case ResourceType::EC2Instance:
-            return "EC2Instance";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceType(ResourceType enumValue)
+        {
+          return GetNameForResourceTypeCStr(enumValue);
         }
 
       } // namespace ResourceTypeMapper
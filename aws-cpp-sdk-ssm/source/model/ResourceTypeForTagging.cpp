@@ -30,35 +30,58 @@ namespace Aws
       namespace ResourceTypeForTaggingMapper
       {
 
-        static const int Document_HASH = HashingUtils::HashString("Document");
-        static const int ManagedInstance_HASH = HashingUtils::HashString("ManagedInstance");
-        static const int MaintenanceWindow_HASH = HashingUtils::HashString("MaintenanceWindow");
-        static const int Parameter_HASH = HashingUtils::HashString("Parameter");
-        static const int PatchBaseline_HASH = HashingUtils::HashString("PatchBaseline");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Document",
+          "ManagedInstance",
+          "MaintenanceWindow",
+          "Parameter",
+          "PatchBaseline",
+        };
 
         ResourceTypeForTagging GetResourceTypeForTaggingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Document_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceTypeForTagging::Document;
-          }
-          else if (hashCode == ManagedInstance_HASH)
-          {
-            return ResourceTypeForTagging::ManagedInstance;
-          }
-          else if (hashCode == MaintenanceWindow_HASH)
-          {
-            return ResourceTypeForTagging::MaintenanceWindow;
-          }
-          else if (hashCode == Parameter_HASH)
-          {
-            return ResourceTypeForTagging::Parameter;
-          }
-          else if (hashCode == PatchBaseline_HASH)
-          {
-            return ResourceTypeForTagging::PatchBaseline;
+          case 926364987:
+            if (name == "Document")
+            {
+              return ResourceTypeForTagging::Document;
+            }
+            break;
+          case 1531883828:
+            if (name == "ManagedInstance")
+            {
+              return ResourceTypeForTagging::ManagedInstance;
+            }
+            break;
+          case -1527242557:
+            if (name == "MaintenanceWindow")
+            {
+              return ResourceTypeForTagging::MaintenanceWindow;
+            }
+            break;
+          case -336538743:
+            if (name == "Parameter")
+            {
+              return ResourceTypeForTagging::Parameter;
+            }
+            break;
+          case 1012912781:
+            if (name == "PatchBaseline")
+            {
+              return ResourceTypeForTagging::PatchBaseline;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ResourceTypeForTagging::NOT_SET;
         }
 
-        Aws::String GetNameForResourceTypeForTagging(ResourceTypeForTagging enumValue)
+        const char* GetNameForResourceTypeForTaggingCStr(ResourceTypeForTagging enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceTypeForTagging::Document:
-            return "Document";
-          case ResourceTypeForTagging::ManagedInstance:
-            return "ManagedInstance";
-          case ResourceTypeForTagging::MaintenanceWindow:
-            return "MaintenanceWindow";
-          case ResourceTypeForTagging::Parameter:
-            return "Parameter";
-          case ResourceTypeForTagging::PatchBaseline:
-            return "PatchBaseline";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceTypeForTagging(ResourceTypeForTagging enumValue)
+        {
+          return GetNameForResourceTypeForTaggingCStr(enumValue);
         }
 
       } // namespace ResourceTypeForTaggingMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace SessionFilterKeyMapper
       {
 
-        static const int InvokedAfter_HASH = HashingUtils::HashString("InvokedAfter");
-        static const int InvokedBefore_HASH = HashingUtils::HashString("InvokedBefore");
-        static const int Target_HASH = HashingUtils::HashString("Target");
-        static const int Owner_HASH = HashingUtils::HashString("Owner");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "InvokedAfter",
+          "InvokedBefore",
+          "Target",
+          "Owner",
+          "Status",
+        };
 
         SessionFilterKey GetSessionFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvokedAfter_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SessionFilterKey::InvokedAfter;
-          }
-          else if (hashCode == InvokedBefore_HASH)
-          {
-            return SessionFilterKey::InvokedBefore;
-          }
-          else if (hashCode == Target_HASH)
-          {
-            return SessionFilterKey::Target;
-          }
-          else if (hashCode == Owner_HASH)
-          {
-            return SessionFilterKey::Owner;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return SessionFilterKey::Status;
+          case 131011184:
+            if (name == "InvokedAfter")
+            {
+              return SessionFilterKey::InvokedAfter;
+            }
+            break;
+          case -206322325:
+            if (name == "InvokedBefore")
+            {
+              return SessionFilterKey::InvokedBefore;
+            }
+            break;
+          case -1797038671:
+            if (name == "Target")
+            {
+              return SessionFilterKey::Target;
+            }
+            break;
+          case 76612243:
+            if (name == "Owner")
+            {
+              return SessionFilterKey::Owner;
+            }
+            break;
+          case -1808614382:
+            if (name == "Status")
+            {
+              return SessionFilterKey::Status;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return SessionFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForSessionFilterKey(SessionFilterKey enumValue)
+        const char* GetNameForSessionFilterKeyCStr(SessionFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SessionFilterKey::InvokedAfter:
-            return "InvokedAfter";
-          case SessionFilterKey::InvokedBefore:
-            return "InvokedBefore";
-          case SessionFilterKey::Target:
-            return "Target";
-          case SessionFilterKey::Owner:
-            return "Owner";
-          case SessionFilterKey::Status:
-            return "Status";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSessionFilterKey(SessionFilterKey enumValue)
+        {
+          return GetNameForSessionFilterKeyCStr(enumValue);
         }
 
       } // namespace SessionFilterKeyMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace SessionStateMapper
       {
 
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int History_HASH = HashingUtils::HashString("History");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Active",
+          "History",
+        };
 
         SessionState GetSessionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Active_HASH)
-          {
-            return SessionState::Active;
-          }
-          else if (hashCode == History_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SessionState::History;
+          case 1955883814:
+            if (name == "Active")
+            {
+              return SessionState::Active;
+            }
+            break;
+          case -1703379852:
+            if (name == "History")
+            {
+              return SessionState::History;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return SessionState::NOT_SET;
         }
 
-        Aws::String GetNameForSessionState(SessionState enumValue)
+        const char* GetNameForSessionStateCStr(SessionState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SessionState::Active:
-            return "Active";
-          case SessionState::History:
-            return "History";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSessionState(SessionState enumValue)
+        {
+          return GetNameForSessionStateCStr(enumValue);
         }
 
       } // namespace SessionStateMapper
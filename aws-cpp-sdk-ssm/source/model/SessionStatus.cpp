@@ -30,40 +30,65 @@ namespace Aws
       namespace SessionStatusMapper
       {
 
-        static const int Connected_HASH = HashingUtils::HashString("Connected");
-        static const int Connecting_HASH = HashingUtils::HashString("Connecting");
-        static const int Disconnected_HASH = HashingUtils::HashString("Disconnected");
-        static const int Terminated_HASH = HashingUtils::HashString("Terminated");
-        static const int Terminating_HASH = HashingUtils::HashString("Terminating");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Connected",
+          "Connecting",
+          "Disconnected",
+          "Terminated",
+          "Terminating",
+          "Failed",
+        };
 
         SessionStatus GetSessionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Connected_HASH)
-          {
-            return SessionStatus::Connected;
-          }
-          else if (hashCode == Connecting_HASH)
-          {
-            return SessionStatus::Connecting;
-          }
-          else if (hashCode == Disconnected_HASH)
-          {
-            return SessionStatus::Disconnected;
-          }
-          else if (hashCode == Terminated_HASH)
-          {
-            return SessionStatus::Terminated;
-          }
-          else if (hashCode == Terminating_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SessionStatus::Terminating;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return SessionStatus::Failed;
+          case 1424757481:
+            if (name == "Connected")
+            {
+              return SessionStatus::Connected;
+            }
+            break;
+          case 1217813208:
+            if (name == "Connecting")
+            {
+              return SessionStatus::Connecting;
+            }
+            break;
+          case -1217068453:
+            if (name == "Disconnected")
+            {
+              return SessionStatus::Disconnected;
+            }
+            break;
+          case 684649027:
+            if (name == "Terminated")
+            {
+              return SessionStatus::Terminated;
+            }
+            break;
+          case -250712386:
+            if (name == "Terminating")
+            {
+              return SessionStatus::Terminating;
+            }
+            break;
+          case 2096857181:
+            if (name == "Failed")
+            {
+              return SessionStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return SessionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSessionStatus(SessionStatus enumValue)
+        const char* GetNameForSessionStatusCStr(SessionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SessionStatus::Connected:
-            return "Connected";
-          case SessionStatus::Connecting:
-            return "Connecting";
-          case SessionStatus::Disconnected:
-            return "Disconnected";
-          case SessionStatus::Terminated:
-            return "Terminated";
-          case SessionStatus::Terminating:
-            return "Terminating";
-          case SessionStatus::Failed:
-            return "Failed";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSessionStatus(SessionStatus enumValue)
+        {
+          return GetNameForSessionStatusCStr(enumValue);
         }
 
       } // namespace SessionStatusMapper
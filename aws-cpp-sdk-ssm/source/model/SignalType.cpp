@@ -30,35 +30,58 @@ namespace Aws
       namespace SignalTypeMapper
       {
 
-        static const int Approve_HASH = HashingUtils::HashString("Approve");
-        static const int Reject_HASH = HashingUtils::HashString("Reject");
-        static const int StartStep_HASH = HashingUtils::HashString("StartStep");
-        static const int StopStep_HASH = HashingUtils::HashString("StopStep");
-        static const int Resume_HASH = HashingUtils::HashString("Resume");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Approve",
+          "Reject",
+          "StartStep",
+          "StopStep",
+          "Resume",
+        };
 
         SignalType GetSignalTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Approve_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SignalType::Approve;
-          }
-          else if (hashCode == Reject_HASH)
-          {
-            return SignalType::Reject;
-          }
-          else if (hashCode == StartStep_HASH)
-          {
-            return SignalType::StartStep;
-          }
-          else if (hashCode == StopStep_HASH)
-          {
-            return SignalType::StopStep;
-          }
-          else if (hashCode == Resume_HASH)
-          {
-            return SignalType::Resume;
+          case 871602989:
+            if (name == "Approve")
+            {
+              return SignalType::Approve;
+            }
+            break;
+          case -1850843201:
+            if (name == "Reject")
+            {
+              return SignalType::Reject;
+            }
+            break;
+          case -125346258:
+            if (name == "StartStep")
+            {
+              return SignalType::StartStep;
+            }
+            break;
+          case 1779439118:
+            if (name == "StopStep")
+            {
+              return SignalType::StopStep;
+            }
+            break;
+          case -1850559411:
+            if (name == "Resume")
+            {
+              return SignalType::Resume;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return SignalType::NOT_SET;
         }
 
-        Aws::String GetNameForSignalType(SignalType enumValue)
+        const char* GetNameForSignalTypeCStr(SignalType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SignalType::Approve:
-            return "Approve";
-          case SignalType::Reject:
-            return "Reject";
-          case SignalType::StartStep:
-            return "StartStep";
-          case SignalType::StopStep:
-            return "StopStep";
-          case SignalType::Resume:
-            return "Resume";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSignalType(SignalType enumValue)
+        {
+          return GetNameForSignalTypeCStr(enumValue);
         }
 
       } // namespace SignalTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace StepExecutionFilterKeyMapper
       {
 
-        static const int StartTimeBefore_HASH = HashingUtils::HashString("StartTimeBefore");
-        static const int StartTimeAfter_HASH = HashingUtils::HashString("StartTimeAfter");
-        static const int StepExecutionStatus_HASH = HashingUtils::HashString("StepExecutionStatus");
-        static const int StepExecutionId_HASH = HashingUtils::HashString("StepExecutionId");
-        static const int StepName_HASH = HashingUtils::HashString("StepName");
-        static const int Action_HASH = HashingUtils::HashString("Action");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "StartTimeBefore",
+          "StartTimeAfter",
+          "StepExecutionStatus",
+          "StepExecutionId",
+          "StepName",
+          "Action",
+        };
 
         StepExecutionFilterKey GetStepExecutionFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == StartTimeBefore_HASH)
-          {
-            return StepExecutionFilterKey::StartTimeBefore;
-          }
-          else if (hashCode == StartTimeAfter_HASH)
-          {
-            return StepExecutionFilterKey::StartTimeAfter;
-          }
-          else if (hashCode == StepExecutionStatus_HASH)
-          {
-            return StepExecutionFilterKey::StepExecutionStatus;
-          }
-          else if (hashCode == StepExecutionId_HASH)
-          {
-            return StepExecutionFilterKey::StepExecutionId;
-          }
-          else if (hashCode == StepName_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StepExecutionFilterKey::StepName;
-          }
-          else if (hashCode == Action_HASH)
-          {
-            return StepExecutionFilterKey::Action;
+          case 1195652750:
+            if (name == "StartTimeBefore")
+            {
+              return StepExecutionFilterKey::StartTimeBefore;
+            }
+            break;
+          case -1347784467:
+            if (name == "StartTimeAfter")
+            {
+              return StepExecutionFilterKey::StartTimeAfter;
+            }
+            break;
+          case 1447926942:
+            if (name == "StepExecutionStatus")
+            {
+              return StepExecutionFilterKey::StepExecutionStatus;
+            }
+            break;
+          case 978915271:
+            if (name == "StepExecutionId")
+            {
+              return StepExecutionFilterKey::StepExecutionId;
+            }
+            break;
+          case 1492980631:
+            if (name == "StepName")
+            {
+              return StepExecutionFilterKey::StepName;
+            }
+            break;
+          case 1955883606:
+            if (name == "Action")
+            {
+              return StepExecutionFilterKey::Action;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return StepExecutionFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForStepExecutionFilterKey(StepExecutionFilterKey enumValue)
+        const char* GetNameForStepExecutionFilterKeyCStr(StepExecutionFilterKey enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StepExecutionFilterKey::StartTimeBefore:
-            return "StartTimeBefore";
-          case StepExecutionFilterKey::StartTimeAfter:
-            return "StartTimeAfter";
-          case StepExecutionFilterKey::StepExecutionStatus:
-            return "StepExecutionStatus";
-          case StepExecutionFilterKey::StepExecutionId:
-            return "StepExecutionId";
-          case StepExecutionFilterKey::StepName:
-            return "StepName";
-          case StepExecutionFilterKey::Action:
-            return "Action";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStepExecutionFilterKey(StepExecutionFilterKey enumValue)
+        {
+          return GetNameForStepExecutionFilterKeyCStr(enumValue);
         }
 
       } // namespace StepExecutionFilterKeyMapper
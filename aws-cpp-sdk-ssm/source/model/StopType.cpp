@@ -30,20 +30,37 @@ namespace Aws
       namespace StopTypeMapper
       {
 
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
-        static const int Cancel_HASH = HashingUtils::HashString("Cancel");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Complete",
+          "Cancel",
+        };
 
         StopType GetStopTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Complete_HASH)
-          {
-            return StopType::Complete;
-          }
-          else if (hashCode == Cancel_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StopType::Cancel;
+          case -534801063:
+            if (name == "Complete")
+            {
+              return StopType::Complete;
+            }
+            break;
+          case 2011110042:
+            if (name == "Cancel")
+            {
+              return StopType::Cancel;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return StopType::NOT_SET;
         }
 
-        Aws::String GetNameForStopType(StopType enumValue)
+        const char* GetNameForStopTypeCStr(StopType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StopType::Complete:
-            return "Complete";
-          case StopType::Cancel:
-            return "Cancel";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStopType(StopType enumValue)
+        {
+          return GetNameForStopTypeCStr(enumValue);
         }
 
       } // namespace StopTypeMapper
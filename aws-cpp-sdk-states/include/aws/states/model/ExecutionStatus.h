@@ -38,6 +38,11 @@ namespace ExecutionStatusMapper
 AWS_SFN_API ExecutionStatus GetExecutionStatusForName(const Aws::String& name);
 
 AWS_SFN_API Aws::String GetNameForExecutionStatus(ExecutionStatus value);
+
+/**
+ * Same as GetNameForExecutionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SFN_API const char* GetNameForExecutionStatusCStr(ExecutionStatus value);
 } // namespace ExecutionStatusMapper
 } // namespace Model
 } // namespace SFN
@@ -78,6 +78,11 @@ namespace HistoryEventTypeMapper
 AWS_SFN_API HistoryEventType GetHistoryEventTypeForName(const Aws::String& name);
 
 AWS_SFN_API Aws::String GetNameForHistoryEventType(HistoryEventType value);
+
+/**
+ * Same as GetNameForHistoryEventType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SFN_API const char* GetNameForHistoryEventTypeCStr(HistoryEventType value);
 } // namespace HistoryEventTypeMapper
 } // namespace Model
 } // namespace SFN
@@ -35,6 +35,11 @@ namespace StateMachineStatusMapper
 AWS_SFN_API StateMachineStatus GetStateMachineStatusForName(const Aws::String& name);
 
 AWS_SFN_API Aws::String GetNameForStateMachineStatus(StateMachineStatus value);
+
+/**
+ * Same as GetNameForStateMachineStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SFN_API const char* GetNameForStateMachineStatusCStr(StateMachineStatus value);
 } // namespace StateMachineStatusMapper
 } // namespace Model
 } // namespace SFN
@@ -30,35 +30,58 @@ namespace Aws
       namespace ExecutionStatusMapper
       {
 
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
-        static const int ABORTED_HASH = HashingUtils::HashString("ABORTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "RUNNING",
+          "SUCCEEDED",
+          "FAILED",
+          "TIMED_OUT",
+          "ABORTED",
+        };
 
         ExecutionStatus GetExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RUNNING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ExecutionStatus::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return ExecutionStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ExecutionStatus::FAILED;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return ExecutionStatus::TIMED_OUT;
-          }
-          else if (hashCode == ABORTED_HASH)
-          {
-            return ExecutionStatus::ABORTED;
+          case -2026200673:
+            if (name == "RUNNING")
+            {
+              return ExecutionStatus::RUNNING;
+            }
+            break;
+          case -562638271:
+            if (name == "SUCCEEDED")
+            {
+              return ExecutionStatus::SUCCEEDED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return ExecutionStatus::FAILED;
+            }
+            break;
+          case -1466757626:
+            if (name == "TIMED_OUT")
+            {
+              return ExecutionStatus::TIMED_OUT;
+            }
+            break;
+          case -476794961:
+            if (name == "ABORTED")
+            {
+              return ExecutionStatus::ABORTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return ExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionStatus(ExecutionStatus enumValue)
+        const char* GetNameForExecutionStatusCStr(ExecutionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ExecutionStatus::RUNNING:
-            return "RUNNING";
-          case ExecutionStatus::SUCCEEDED:
-            return "SUCCEEDED";
-          case ExecutionStatus::FAILED:
-            return "FAILED";
-          case ExecutionStatus::TIMED_OUT:
-            return "TIMED_OUT";
-          case ExecutionStatus::ABORTED:
-            return "ABORTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForExecutionStatus(ExecutionStatus enumValue)
+        {
+          return GetNameForExecutionStatusCStr(enumValue);
         }
 
       } // namespace ExecutionStatusMapper
@@ -30,235 +30,338 @@ namespace Aws
       namespace HistoryEventTypeMapper
       {
 
-        static const int ActivityFailed_HASH = HashingUtils::HashString("ActivityFailed");
-        static const int ActivityScheduleFailed_HASH = HashingUtils::HashString("ActivityScheduleFailed");
-        static const int ActivityScheduled_HASH = HashingUtils::HashString("ActivityScheduled");
-        static const int ActivityStarted_HASH = HashingUtils::HashString("ActivityStarted");
-        static const int ActivitySucceeded_HASH = HashingUtils::HashString("ActivitySucceeded");
-        static const int ActivityTimedOut_HASH = HashingUtils::HashString("ActivityTimedOut");
-        static const int ChoiceStateEntered_HASH = HashingUtils::HashString("ChoiceStateEntered");
-        static const int ChoiceStateExited_HASH = HashingUtils::HashString("ChoiceStateExited");
-        static const int TaskFailed_HASH = HashingUtils::HashString("TaskFailed");
-        static const int TaskScheduled_HASH = HashingUtils::HashString("TaskScheduled");
-        static const int TaskStartFailed_HASH = HashingUtils::HashString("TaskStartFailed");
-        static const int TaskStarted_HASH = HashingUtils::HashString("TaskStarted");
-        static const int TaskSubmitFailed_HASH = HashingUtils::HashString("TaskSubmitFailed");
-        static const int TaskSubmitted_HASH = HashingUtils::HashString("TaskSubmitted");
-        static const int TaskSucceeded_HASH = HashingUtils::HashString("TaskSucceeded");
-        static const int TaskTimedOut_HASH = HashingUtils::HashString("TaskTimedOut");
-        static const int ExecutionFailed_HASH = HashingUtils::HashString("ExecutionFailed");
-        static const int ExecutionStarted_HASH = HashingUtils::HashString("ExecutionStarted");
-        static const int ExecutionSucceeded_HASH = HashingUtils::HashString("ExecutionSucceeded");
-        static const int ExecutionAborted_HASH = HashingUtils::HashString("ExecutionAborted");
-        static const int ExecutionTimedOut_HASH = HashingUtils::HashString("ExecutionTimedOut");
-        static const int FailStateEntered_HASH = HashingUtils::HashString("FailStateEntered");
-        static const int LambdaFunctionFailed_HASH = HashingUtils::HashString("LambdaFunctionFailed");
-        static const int LambdaFunctionScheduleFailed_HASH = HashingUtils::HashString("LambdaFunctionScheduleFailed");
-        static const int LambdaFunctionScheduled_HASH = HashingUtils::HashString("LambdaFunctionScheduled");
-        static const int LambdaFunctionStartFailed_HASH = HashingUtils::HashString("LambdaFunctionStartFailed");
-        static const int LambdaFunctionStarted_HASH = HashingUtils::HashString("LambdaFunctionStarted");
-        static const int LambdaFunctionSucceeded_HASH = HashingUtils::HashString("LambdaFunctionSucceeded");
-        static const int LambdaFunctionTimedOut_HASH = HashingUtils::HashString("LambdaFunctionTimedOut");
-        static const int SucceedStateEntered_HASH = HashingUtils::HashString("SucceedStateEntered");
-        static const int SucceedStateExited_HASH = HashingUtils::HashString("SucceedStateExited");
-        static const int TaskStateAborted_HASH = HashingUtils::HashString("TaskStateAborted");
-        static const int TaskStateEntered_HASH = HashingUtils::HashString("TaskStateEntered");
-        static const int TaskStateExited_HASH = HashingUtils::HashString("TaskStateExited");
-        static const int PassStateEntered_HASH = HashingUtils::HashString("PassStateEntered");
-        static const int PassStateExited_HASH = HashingUtils::HashString("PassStateExited");
-        static const int ParallelStateAborted_HASH = HashingUtils::HashString("ParallelStateAborted");
-        static const int ParallelStateEntered_HASH = HashingUtils::HashString("ParallelStateEntered");
-        static const int ParallelStateExited_HASH = HashingUtils::HashString("ParallelStateExited");
-        static const int ParallelStateFailed_HASH = HashingUtils::HashString("ParallelStateFailed");
-        static const int ParallelStateStarted_HASH = HashingUtils::HashString("ParallelStateStarted");
-        static const int ParallelStateSucceeded_HASH = HashingUtils::HashString("ParallelStateSucceeded");
-        static const int WaitStateAborted_HASH = HashingUtils::HashString("WaitStateAborted");
-        static const int WaitStateEntered_HASH = HashingUtils::HashString("WaitStateEntered");
-        static const int WaitStateExited_HASH = HashingUtils::HashString("WaitStateExited");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ActivityFailed",
+          "ActivityScheduleFailed",
+          "ActivityScheduled",
+          "ActivityStarted",
+          "ActivitySucceeded",
+          "ActivityTimedOut",
+          "ChoiceStateEntered",
+          "ChoiceStateExited",
+          "TaskFailed",
+          "TaskScheduled",
+          "TaskStartFailed",
+          "TaskStarted",
+          "TaskSubmitFailed",
+          "TaskSubmitted",
+          "TaskSucceeded",
+          "TaskTimedOut",
+          "ExecutionFailed",
+          "ExecutionStarted",
+          "ExecutionSucceeded",
+          "ExecutionAborted",
+          "ExecutionTimedOut",
+          "FailStateEntered",
+          "LambdaFunctionFailed",
+          "LambdaFunctionScheduleFailed",
+          "LambdaFunctionScheduled",
+          "LambdaFunctionStartFailed",
+          "LambdaFunctionStarted",
+          "LambdaFunctionSucceeded",
+          "LambdaFunctionTimedOut",
+          "SucceedStateEntered",
+          "SucceedStateExited",
+          "TaskStateAborted",
+          "TaskStateEntered",
+          "TaskStateExited",
+          "PassStateEntered",
+          "PassStateExited",
+          "ParallelStateAborted",
+          "ParallelStateEntered",
+          "ParallelStateExited",
+          "ParallelStateFailed",
+          "ParallelStateStarted",
+          "ParallelStateSucceeded",
+          "WaitStateAborted",
+          "WaitStateEntered",
+          "WaitStateExited",
+        };
 
         HistoryEventType GetHistoryEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ActivityFailed_HASH)
-          {
-            return HistoryEventType::ActivityFailed;
-          }
-          else if (hashCode == ActivityScheduleFailed_HASH)
-          {
-            return HistoryEventType::ActivityScheduleFailed;
-          }
-          else if (hashCode == ActivityScheduled_HASH)
-          {
-            return HistoryEventType::ActivityScheduled;
-          }
-          else if (hashCode == ActivityStarted_HASH)
-          {
-            return HistoryEventType::ActivityStarted;
-          }
-          else if (hashCode == ActivitySucceeded_HASH)
-          {
-            return HistoryEventType::ActivitySucceeded;
-          }
-          else if (hashCode == ActivityTimedOut_HASH)
-          {
-            return HistoryEventType::ActivityTimedOut;
-          }
-          else if (hashCode == ChoiceStateEntered_HASH)
-          {
-            return HistoryEventType::ChoiceStateEntered;
-          }
-          else if (hashCode == ChoiceStateExited_HASH)
-          {
-            return HistoryEventType::ChoiceStateExited;
-          }
-          else if (hashCode == TaskFailed_HASH)
-          {
-            return HistoryEventType::TaskFailed;
-          }
-          else if (hashCode == TaskScheduled_HASH)
-          {
-            return HistoryEventType::TaskScheduled;
-          }
-          else if (hashCode == TaskStartFailed_HASH)
-          {
-            return HistoryEventType::TaskStartFailed;
-          }
-          else if (hashCode == TaskStarted_HASH)
-          {
-            return HistoryEventType::TaskStarted;
-          }
-          else if (hashCode == TaskSubmitFailed_HASH)
-          {
-            return HistoryEventType::TaskSubmitFailed;
-          }
-          else if (hashCode == TaskSubmitted_HASH)
-          {
-            return HistoryEventType::TaskSubmitted;
-          }
-          else if (hashCode == TaskSucceeded_HASH)
-          {
-            return HistoryEventType::TaskSucceeded;
-          }
-          else if (hashCode == TaskTimedOut_HASH)
-          {
-            return HistoryEventType::TaskTimedOut;
-          }
-          else if (hashCode == ExecutionFailed_HASH)
-          {
-            return HistoryEventType::ExecutionFailed;
-          }
-          else if (hashCode == ExecutionStarted_HASH)
-          {
-            return HistoryEventType::ExecutionStarted;
-          }
-          else if (hashCode == ExecutionSucceeded_HASH)
-          {
-            return HistoryEventType::ExecutionSucceeded;
-          }
-          else if (hashCode == ExecutionAborted_HASH)
-          {
-            return HistoryEventType::ExecutionAborted;
-          }
-          else if (hashCode == ExecutionTimedOut_HASH)
-          {
-            return HistoryEventType::ExecutionTimedOut;
-          }
-          else if (hashCode == FailStateEntered_HASH)
-          {
-            return HistoryEventType::FailStateEntered;
-          }
-          else if (hashCode == LambdaFunctionFailed_HASH)
-          {
-            return HistoryEventType::LambdaFunctionFailed;
-          }
-          else if (hashCode == LambdaFunctionScheduleFailed_HASH)
-          {
-            return HistoryEventType::LambdaFunctionScheduleFailed;
-          }
-          else if (hashCode == LambdaFunctionScheduled_HASH)
-          {
-            return HistoryEventType::LambdaFunctionScheduled;
-          }
-          else if (hashCode == LambdaFunctionStartFailed_HASH)
-          {
-            return HistoryEventType::LambdaFunctionStartFailed;
-          }
-          else if (hashCode == LambdaFunctionStarted_HASH)
-          {
-            return HistoryEventType::LambdaFunctionStarted;
-          }
-          else if (hashCode == LambdaFunctionSucceeded_HASH)
-          {
-            return HistoryEventType::LambdaFunctionSucceeded;
-          }
-          else if (hashCode == LambdaFunctionTimedOut_HASH)
-          {
-            return HistoryEventType::LambdaFunctionTimedOut;
-          }
-          else if (hashCode == SucceedStateEntered_HASH)
-          {
-            return HistoryEventType::SucceedStateEntered;
-          }
-          else if (hashCode == SucceedStateExited_HASH)
-          {
-            return HistoryEventType::SucceedStateExited;
-          }
-          else if (hashCode == TaskStateAborted_HASH)
-          {
-            return HistoryEventType::TaskStateAborted;
-          }
-          else if (hashCode == TaskStateEntered_HASH)
-          {
-            return HistoryEventType::TaskStateEntered;
-          }
-          else if (hashCode == TaskStateExited_HASH)
-          {
-            return HistoryEventType::TaskStateExited;
-          }
-          else if (hashCode == PassStateEntered_HASH)
-          {
-            return HistoryEventType::PassStateEntered;
-          }
-          else if (hashCode == PassStateExited_HASH)
-          {
-            return HistoryEventType::PassStateExited;
-          }
-          else if (hashCode == ParallelStateAborted_HASH)
-          {
-            return HistoryEventType::ParallelStateAborted;
-          }
-          else if (hashCode == ParallelStateEntered_HASH)
-          {
-            return HistoryEventType::ParallelStateEntered;
-          }
-          else if (hashCode == ParallelStateExited_HASH)
-          {
-            return HistoryEventType::ParallelStateExited;
-          }
-          else if (hashCode == ParallelStateFailed_HASH)
-          {
-            return HistoryEventType::ParallelStateFailed;
-          }
-          else if (hashCode == ParallelStateStarted_HASH)
-          {
-            return HistoryEventType::ParallelStateStarted;
-          }
-          else if (hashCode == ParallelStateSucceeded_HASH)
-          {
-            return HistoryEventType::ParallelStateSucceeded;
-          }
-          else if (hashCode == WaitStateAborted_HASH)
-          {
-            return HistoryEventType::WaitStateAborted;
-          }
-          else if (hashCode == WaitStateEntered_HASH)
-          {
-            return HistoryEventType::WaitStateEntered;
-          }
-          else if (hashCode == WaitStateExited_HASH)
-          {
-            return HistoryEventType::WaitStateExited;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 503937100:
+            if (name == "ActivityFailed")
+            {
+              return HistoryEventType::ActivityFailed;
+            }
+            break;
+          case 1808460483:
+            if (name == "ActivityScheduleFailed")
+            {
+              return HistoryEventType::ActivityScheduleFailed;
+            }
+            break;
+          case -2040189378:
+            if (name == "ActivityScheduled")
+            {
+              return HistoryEventType::ActivityScheduled;
+            }
+            break;
+          case 1926553170:
+            if (name == "ActivityStarted")
+            {
+              return HistoryEventType::ActivityStarted;
+            }
+            break;
+          case -933744654:
+            if (name == "ActivitySucceeded")
+            {
+              return HistoryEventType::ActivitySucceeded;
+            }
+            break;
+          case 494857446:
+            if (name == "ActivityTimedOut")
+            {
+              return HistoryEventType::ActivityTimedOut;
+            }
+            break;
+          case 136347655:
+            if (name == "ChoiceStateEntered")
+            {
+              return HistoryEventType::ChoiceStateEntered;
+            }
+            break;
+          case 844603821:
+            if (name == "ChoiceStateExited")
+            {
+              return HistoryEventType::ChoiceStateExited;
+            }
+            break;
+          case -1721460158:
+            if (name == "TaskFailed")
+            {
+              return HistoryEventType::TaskFailed;
+            }
+            break;
+          case -1734721400:
+            if (name == "TaskScheduled")
+            {
+              return HistoryEventType::TaskScheduled;
+            }
+            break;
+          case 1242818650:
+            if (name == "TaskStartFailed")
+            {
+              return HistoryEventType::TaskStartFailed;
+            }
+            break;
+          case 1658714908:
+            if (name == "TaskStarted")
+            {
+              return HistoryEventType::TaskStarted;
+            }
+            break;
+          case 2020474042:
+            if (name == "TaskSubmitFailed")
+            {
+              return HistoryEventType::TaskSubmitFailed;
+            }
+            break;
+          case -1225332522:
+            if (name == "TaskSubmitted")
+            {
+              return HistoryEventType::TaskSubmitted;
+            }
+            break;
+          case -628276676:
+            if (name == "TaskSucceeded")
+            {
+              return HistoryEventType::TaskSucceeded;
+            }
+            break;
+          case 781805916:
+            if (name == "TaskTimedOut")
+            {
+              return HistoryEventType::TaskTimedOut;
+            }
+            break;
+          case -68644523:
+            if (name == "ExecutionFailed")
+            {
+              return HistoryEventType::ExecutionFailed;
+            }
+            break;
+          case 1356392041:
+            if (name == "ExecutionStarted")
+            {
+              return HistoryEventType::ExecutionStarted;
+            }
+            break;
+          case 897224265:
+            if (name == "ExecutionSucceeded")
+            {
+              return HistoryEventType::ExecutionSucceeded;
+            }
+            break;
+          case 2058799543:
+            if (name == "ExecutionAborted")
+            {
+              return HistoryEventType::ExecutionAborted;
+            }
+            break;
+          case -268369:
+            if (name == "ExecutionTimedOut")
+            {
+              return HistoryEventType::ExecutionTimedOut;
+            }
+            break;
+          case -1300222460:
+            if (name == "FailStateEntered")
+            {
+              return HistoryEventType::FailStateEntered;
+            }
+            break;
+          case -653369860:
+            if (name == "LambdaFunctionFailed")
+            {
+              return HistoryEventType::LambdaFunctionFailed;
+            }
+            break;
+          case 153559155:
+            if (name == "LambdaFunctionScheduleFailed")
+            {
+              return HistoryEventType::LambdaFunctionScheduleFailed;
+            }
+            break;
+          case 625617550:
+            if (name == "LambdaFunctionScheduled")
+            {
+              return HistoryEventType::LambdaFunctionScheduled;
+            }
+            break;
+          case 1785817312:
+            if (name == "LambdaFunctionStartFailed")
+            {
+              return HistoryEventType::LambdaFunctionStartFailed;
+            }
+            break;
+          case 409775778:
+            if (name == "LambdaFunctionStarted")
+            {
+              return HistoryEventType::LambdaFunctionStarted;
+            }
+            break;
+          case 1732062274:
+            if (name == "LambdaFunctionSucceeded")
+            {
+              return HistoryEventType::LambdaFunctionSucceeded;
+            }
+            break;
+          case 719398550:
+            if (name == "LambdaFunctionTimedOut")
+            {
+              return HistoryEventType::LambdaFunctionTimedOut;
+            }
+            break;
+          case 1652523752:
+            if (name == "SucceedStateEntered")
+            {
+              return HistoryEventType::SucceedStateEntered;
+            }
+            break;
+          case 1586249388:
+            if (name == "SucceedStateExited")
+            {
+              return HistoryEventType::SucceedStateExited;
+            }
+            break;
+          case 72192067:
+            if (name == "TaskStateAborted")
+            {
+              return HistoryEventType::TaskStateAborted;
+            }
+            break;
+          case -324982293:
+            if (name == "TaskStateEntered")
+            {
+              return HistoryEventType::TaskStateEntered;
+            }
+            break;
+          case -1561783:
+            if (name == "TaskStateExited")
+            {
+              return HistoryEventType::TaskStateExited;
+            }
+            break;
+          case -630069641:
+            if (name == "PassStateEntered")
+            {
+              return HistoryEventType::PassStateEntered;
+            }
+            break;
+          case -704139971:
+            if (name == "PassStateExited")
+            {
+              return HistoryEventType::PassStateExited;
+            }
+            break;
+          case 71288261:
+            if (name == "ParallelStateAborted")
+            {
+              return HistoryEventType::ParallelStateAborted;
+            }
+            break;
+          case -325886099:
+            if (name == "ParallelStateEntered")
+            {
+              return HistoryEventType::ParallelStateEntered;
+            }
+            break;
+          case 1106787719:
+            if (name == "ParallelStateExited")
+            {
+              return HistoryEventType::ParallelStateExited;
+            }
+            break;
+          case 1114168199:
+            if (name == "ParallelStateFailed")
+            {
+              return HistoryEventType::ParallelStateFailed;
+            }
+            break;
+          case -631119241:
+            if (name == "ParallelStateStarted")
+            {
+              return HistoryEventType::ParallelStateStarted;
+            }
+            break;
+          case -2135638313:
+            if (name == "ParallelStateSucceeded")
+            {
+              return HistoryEventType::ParallelStateSucceeded;
+            }
+            break;
+          case 955548723:
+            if (name == "WaitStateAborted")
+            {
+              return HistoryEventType::WaitStateAborted;
+            }
+            break;
+          case 558374363:
+            if (name == "WaitStateEntered")
+            {
+              return HistoryEventType::WaitStateEntered;
+            }
+            break;
+          case 26933593:
+            if (name == "WaitStateExited")
+            {
+              return HistoryEventType::WaitStateExited;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -270,109 +373,26 @@ namespace Aws
           return HistoryEventType::NOT_SET;
         }
 
-        Aws::String GetNameForHistoryEventType(HistoryEventType enumValue)
+        const char* GetNameForHistoryEventTypeCStr(HistoryEventType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case HistoryEventType::ActivityFailed:
-            return "ActivityFailed";
-          case HistoryEventType::ActivityScheduleFailed:
-            return "ActivityScheduleFailed";
-          case HistoryEventType::ActivityScheduled:
-            return "ActivityScheduled";
-          case HistoryEventType::ActivityStarted:
-            return "ActivityStarted";
-          case HistoryEventType::ActivitySucceeded:
-            return "ActivitySucceeded";
-          case HistoryEventType::ActivityTimedOut:
-            return "ActivityTimedOut";
-          case HistoryEventType::ChoiceStateEntered:
-            return "ChoiceStateEntered";
-          case HistoryEventType::ChoiceStateExited:
-            return "ChoiceStateExited";
-          case HistoryEventType::TaskFailed:
-            return "TaskFailed";
-          case HistoryEventType::TaskScheduled:
-            return "TaskScheduled";
-          case HistoryEventType::TaskStartFailed:
-            return "TaskStartFailed";
-          case HistoryEventType::TaskStarted:
-            return "TaskStarted";
-          case HistoryEventType::TaskSubmitFailed:
-            return "TaskSubmitFailed";
-          case HistoryEventType::TaskSubmitted:
-            return "TaskSubmitted";
-          case HistoryEventType::TaskSucceeded:
-            return "TaskSucceeded";
-          case HistoryEventType::TaskTimedOut:
-            return "TaskTimedOut";
-          case HistoryEventType::ExecutionFailed:
-            return "ExecutionFailed";
-          case HistoryEventType::ExecutionStarted:
-            return "ExecutionStarted";
-          case HistoryEventType::ExecutionSucceeded:
-            return "ExecutionSucceeded";
-          case HistoryEventType::ExecutionAborted:
-            return "ExecutionAborted";
-          case HistoryEventType::ExecutionTimedOut:
-            return "ExecutionTimedOut";
-          case HistoryEventType::FailStateEntered:
-            return "FailStateEntered";
-          case HistoryEventType::LambdaFunctionFailed:
-            return "LambdaFunctionFailed";
-          case HistoryEventType::LambdaFunctionScheduleFailed:
-            return "LambdaFunctionScheduleFailed";
-          case HistoryEventType::LambdaFunctionScheduled:
-            return "LambdaFunctionScheduled";
-          case HistoryEventType::LambdaFunctionStartFailed:
-            return "LambdaFunctionStartFailed";
-          case HistoryEventType::LambdaFunctionStarted:
-            return "LambdaFunctionStarted";
-          case HistoryEventType::LambdaFunctionSucceeded:
-            return "LambdaFunctionSucceeded";
-          case HistoryEventType::LambdaFunctionTimedOut:
-            return "LambdaFunctionTimedOut";
-          case HistoryEventType::SucceedStateEntered:
-            return "SucceedStateEntered";
-          case HistoryEventType::SucceedStateExited:
-            return "SucceedStateExited";
-          case HistoryEventType::TaskStateAborted:
-            return "TaskStateAborted";
-          case HistoryEventType::TaskStateEntered:
-            return "TaskStateEntered";
-          case HistoryEventType::TaskStateExited:
-            return "TaskStateExited";
-          case HistoryEventType::PassStateEntered:
-            return "PassStateEntered";
-          case HistoryEventType::PassStateExited:
-            return "PassStateExited";
-          case HistoryEventType::ParallelStateAborted:
-            return "ParallelStateAborted";
-          case HistoryEventType::ParallelStateEntered:
-            return "ParallelStateEntered";
-          case HistoryEventType::ParallelStateExited:
-            return "ParallelStateExited";
-          case HistoryEventType::ParallelStateFailed:
-            return "ParallelStateFailed";
-          case HistoryEventType::ParallelStateStarted:
-            return "ParallelStateStarted";
-          case HistoryEventType::ParallelStateSucceeded:
-            return "ParallelStateSucceeded";
-          case HistoryEventType::WaitStateAborted:
-            return "WaitStateAborted";
-          case HistoryEventType::WaitStateEntered:
-            return "WaitStateEntered";
-          case HistoryEventType::WaitStateExited:
-            return "WaitStateExited";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForHistoryEventType(HistoryEventType enumValue)
+        {
+          return GetNameForHistoryEventTypeCStr(enumValue);
         }
 
       } // namespace HistoryEventTypeMapper
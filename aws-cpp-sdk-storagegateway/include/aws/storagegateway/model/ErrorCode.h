@@ -94,6 +94,11 @@ namespace ErrorCodeMapper
 AWS_STORAGEGATEWAY_API ErrorCode GetErrorCodeForName(const Aws::String& name);
 
 AWS_STORAGEGATEWAY_API Aws::String GetNameForErrorCode(ErrorCode value);
+
+/**
+ * Same as GetNameForErrorCode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_STORAGEGATEWAY_API const char* GetNameForErrorCodeCStr(ErrorCode value);
 } // namespace ErrorCodeMapper
 } // namespace Model
 } // namespace StorageGateway
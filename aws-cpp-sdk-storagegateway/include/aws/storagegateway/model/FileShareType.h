@@ -35,6 +35,11 @@ namespace FileShareTypeMapper
 AWS_STORAGEGATEWAY_API FileShareType GetFileShareTypeForName(const Aws::String& name);
 
 AWS_STORAGEGATEWAY_API Aws::String GetNameForFileShareType(FileShareType value);
+
+/**
+ * Same as GetNameForFileShareType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_STORAGEGATEWAY_API const char* GetNameForFileShareTypeCStr(FileShareType value);
 } // namespace FileShareTypeMapper
 } // namespace Model
 } // namespace StorageGateway
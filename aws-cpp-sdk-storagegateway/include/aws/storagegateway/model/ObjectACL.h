@@ -40,6 +40,11 @@ namespace ObjectACLMapper
 AWS_STORAGEGATEWAY_API ObjectACL GetObjectACLForName(const Aws::String& name);
 
 AWS_STORAGEGATEWAY_API Aws::String GetNameForObjectACL(ObjectACL value);
+
+/**
+ * Same as GetNameForObjectACL(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_STORAGEGATEWAY_API const char* GetNameForObjectACLCStr(ObjectACL value);
 } // namespace ObjectACLMapper
 } // namespace Model
 } // namespace StorageGateway
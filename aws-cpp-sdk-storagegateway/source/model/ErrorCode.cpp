@@ -30,315 +30,450 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int ActivationKeyExpired_HASH = HashingUtils::HashString("ActivationKeyExpired");
-        static const int ActivationKeyInvalid_HASH = HashingUtils::HashString("ActivationKeyInvalid");
-        static const int ActivationKeyNotFound_HASH = HashingUtils::HashString("ActivationKeyNotFound");
-        static const int GatewayInternalError_HASH = HashingUtils::HashString("GatewayInternalError");
-        static const int GatewayNotConnected_HASH = HashingUtils::HashString("GatewayNotConnected");
-        static const int GatewayNotFound_HASH = HashingUtils::HashString("GatewayNotFound");
-        static const int GatewayProxyNetworkConnectionBusy_HASH = HashingUtils::HashString("GatewayProxyNetworkConnectionBusy");
-        static const int AuthenticationFailure_HASH = HashingUtils::HashString("AuthenticationFailure");
-        static const int BandwidthThrottleScheduleNotFound_HASH = HashingUtils::HashString("BandwidthThrottleScheduleNotFound");
-        static const int Blocked_HASH = HashingUtils::HashString("Blocked");
-        static const int CannotExportSnapshot_HASH = HashingUtils::HashString("CannotExportSnapshot");
-        static const int ChapCredentialNotFound_HASH = HashingUtils::HashString("ChapCredentialNotFound");
-        static const int DiskAlreadyAllocated_HASH = HashingUtils::HashString("DiskAlreadyAllocated");
-        static const int DiskDoesNotExist_HASH = HashingUtils::HashString("DiskDoesNotExist");
-        static const int DiskSizeGreaterThanVolumeMaxSize_HASH = HashingUtils::HashString("DiskSizeGreaterThanVolumeMaxSize");
-        static const int DiskSizeLessThanVolumeSize_HASH = HashingUtils::HashString("DiskSizeLessThanVolumeSize");
-        static const int DiskSizeNotGigAligned_HASH = HashingUtils::HashString("DiskSizeNotGigAligned");
-        static const int DuplicateCertificateInfo_HASH = HashingUtils::HashString("DuplicateCertificateInfo");
-        static const int DuplicateSchedule_HASH = HashingUtils::HashString("DuplicateSchedule");
-        static const int EndpointNotFound_HASH = HashingUtils::HashString("EndpointNotFound");
-        static const int IAMNotSupported_HASH = HashingUtils::HashString("IAMNotSupported");
-        static const int InitiatorInvalid_HASH = HashingUtils::HashString("InitiatorInvalid");
-        static const int InitiatorNotFound_HASH = HashingUtils::HashString("InitiatorNotFound");
-        static const int InternalError_HASH = HashingUtils::HashString("InternalError");
-        static const int InvalidGateway_HASH = HashingUtils::HashString("InvalidGateway");
-        static const int InvalidEndpoint_HASH = HashingUtils::HashString("InvalidEndpoint");
-        static const int InvalidParameters_HASH = HashingUtils::HashString("InvalidParameters");
-        static const int InvalidSchedule_HASH = HashingUtils::HashString("InvalidSchedule");
-        static const int LocalStorageLimitExceeded_HASH = HashingUtils::HashString("LocalStorageLimitExceeded");
-        static const int LunAlreadyAllocated_HASH = HashingUtils::HashString("LunAlreadyAllocated ");
-        static const int LunInvalid_HASH = HashingUtils::HashString("LunInvalid");
-        static const int MaximumContentLengthExceeded_HASH = HashingUtils::HashString("MaximumContentLengthExceeded");
-        static const int MaximumTapeCartridgeCountExceeded_HASH = HashingUtils::HashString("MaximumTapeCartridgeCountExceeded");
-        static const int MaximumVolumeCountExceeded_HASH = HashingUtils::HashString("MaximumVolumeCountExceeded");
-        static const int NetworkConfigurationChanged_HASH = HashingUtils::HashString("NetworkConfigurationChanged");
-        static const int NoDisksAvailable_HASH = HashingUtils::HashString("NoDisksAvailable");
-        static const int NotImplemented_HASH = HashingUtils::HashString("NotImplemented");
-        static const int NotSupported_HASH = HashingUtils::HashString("NotSupported");
-        static const int OperationAborted_HASH = HashingUtils::HashString("OperationAborted");
-        static const int OutdatedGateway_HASH = HashingUtils::HashString("OutdatedGateway");
-        static const int ParametersNotImplemented_HASH = HashingUtils::HashString("ParametersNotImplemented");
-        static const int RegionInvalid_HASH = HashingUtils::HashString("RegionInvalid");
-        static const int RequestTimeout_HASH = HashingUtils::HashString("RequestTimeout");
-        static const int ServiceUnavailable_HASH = HashingUtils::HashString("ServiceUnavailable");
-        static const int SnapshotDeleted_HASH = HashingUtils::HashString("SnapshotDeleted");
-        static const int SnapshotIdInvalid_HASH = HashingUtils::HashString("SnapshotIdInvalid");
-        static const int SnapshotInProgress_HASH = HashingUtils::HashString("SnapshotInProgress");
-        static const int SnapshotNotFound_HASH = HashingUtils::HashString("SnapshotNotFound");
-        static const int SnapshotScheduleNotFound_HASH = HashingUtils::HashString("SnapshotScheduleNotFound");
-        static const int StagingAreaFull_HASH = HashingUtils::HashString("StagingAreaFull");
-        static const int StorageFailure_HASH = HashingUtils::HashString("StorageFailure");
-        static const int TapeCartridgeNotFound_HASH = HashingUtils::HashString("TapeCartridgeNotFound");
-        static const int TargetAlreadyExists_HASH = HashingUtils::HashString("TargetAlreadyExists");
-        static const int TargetInvalid_HASH = HashingUtils::HashString("TargetInvalid");
-        static const int TargetNotFound_HASH = HashingUtils::HashString("TargetNotFound");
-        static const int UnauthorizedOperation_HASH = HashingUtils::HashString("UnauthorizedOperation");
-        static const int VolumeAlreadyExists_HASH = HashingUtils::HashString("VolumeAlreadyExists");
-        static const int VolumeIdInvalid_HASH = HashingUtils::HashString("VolumeIdInvalid");
-        static const int VolumeInUse_HASH = HashingUtils::HashString("VolumeInUse");
-        static const int VolumeNotFound_HASH = HashingUtils::HashString("VolumeNotFound");
-        static const int VolumeNotReady_HASH = HashingUtils::HashString("VolumeNotReady");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ActivationKeyExpired",
+          "ActivationKeyInvalid",
+          "ActivationKeyNotFound",
+          "GatewayInternalError",
+          "GatewayNotConnected",
+          "GatewayNotFound",
+          "GatewayProxyNetworkConnectionBusy",
+          "AuthenticationFailure",
+          "BandwidthThrottleScheduleNotFound",
+          "Blocked",
+          "CannotExportSnapshot",
+          "ChapCredentialNotFound",
+          "DiskAlreadyAllocated",
+          "DiskDoesNotExist",
+          "DiskSizeGreaterThanVolumeMaxSize",
+          "DiskSizeLessThanVolumeSize",
+          "DiskSizeNotGigAligned",
+          "DuplicateCertificateInfo",
+          "DuplicateSchedule",
+          "EndpointNotFound",
+          "IAMNotSupported",
+          "InitiatorInvalid",
+          "InitiatorNotFound",
+          "InternalError",
+          "InvalidGateway",
+          "InvalidEndpoint",
+          "InvalidParameters",
+          "InvalidSchedule",
+          "LocalStorageLimitExceeded",
+          "LunAlreadyAllocated ",
+          "LunInvalid",
+          "MaximumContentLengthExceeded",
+          "MaximumTapeCartridgeCountExceeded",
+          "MaximumVolumeCountExceeded",
+          "NetworkConfigurationChanged",
+          "NoDisksAvailable",
+          "NotImplemented",
+          "NotSupported",
+          "OperationAborted",
+          "OutdatedGateway",
+          "ParametersNotImplemented",
+          "RegionInvalid",
+          "RequestTimeout",
+          "ServiceUnavailable",
+          "SnapshotDeleted",
+          "SnapshotIdInvalid",
+          "SnapshotInProgress",
+          "SnapshotNotFound",
+          "SnapshotScheduleNotFound",
+          "StagingAreaFull",
+          "StorageFailure",
+          "TapeCartridgeNotFound",
+          "TargetAlreadyExists",
+          "TargetInvalid",
+          "TargetNotFound",
+          "UnauthorizedOperation",
+          "VolumeAlreadyExists",
+          "VolumeIdInvalid",
+          "VolumeInUse",
+          "VolumeNotFound",
+          "VolumeNotReady",
+        };
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ActivationKeyExpired_HASH)
-          {
-            return ErrorCode::ActivationKeyExpired;
-          }
-          else if (hashCode == ActivationKeyInvalid_HASH)
-          {
-            return ErrorCode::ActivationKeyInvalid;
-          }
-          else if (hashCode == ActivationKeyNotFound_HASH)
-          {
-            return ErrorCode::ActivationKeyNotFound;
-          }
-          else if (hashCode == GatewayInternalError_HASH)
-          {
-            return ErrorCode::GatewayInternalError;
-          }
-          else if (hashCode == GatewayNotConnected_HASH)
-          {
-            return ErrorCode::GatewayNotConnected;
-          }
-          else if (hashCode == GatewayNotFound_HASH)
-          {
-            return ErrorCode::GatewayNotFound;
-          }
-          else if (hashCode == GatewayProxyNetworkConnectionBusy_HASH)
-          {
-            return ErrorCode::GatewayProxyNetworkConnectionBusy;
-          }
-          else if (hashCode == AuthenticationFailure_HASH)
-          {
-            return ErrorCode::AuthenticationFailure;
-          }
-          else if (hashCode == BandwidthThrottleScheduleNotFound_HASH)
-          {
-            return ErrorCode::BandwidthThrottleScheduleNotFound;
-          }
-          else if (hashCode == Blocked_HASH)
-          {
-            return ErrorCode::Blocked;
-          }
-          else if (hashCode == CannotExportSnapshot_HASH)
-          {
-            return ErrorCode::CannotExportSnapshot;
-          }
-          else if (hashCode == ChapCredentialNotFound_HASH)
-          {
-            return ErrorCode::ChapCredentialNotFound;
-          }
-          else if (hashCode == DiskAlreadyAllocated_HASH)
-          {
-            return ErrorCode::DiskAlreadyAllocated;
-          }
-          else if (hashCode == DiskDoesNotExist_HASH)
-          {
-            return ErrorCode::DiskDoesNotExist;
-          }
-          else if (hashCode == DiskSizeGreaterThanVolumeMaxSize_HASH)
-          {
-            return ErrorCode::DiskSizeGreaterThanVolumeMaxSize;
-          }
-          else if (hashCode == DiskSizeLessThanVolumeSize_HASH)
-          {
-            return ErrorCode::DiskSizeLessThanVolumeSize;
-          }
-          else if (hashCode == DiskSizeNotGigAligned_HASH)
-          {
-            return ErrorCode::DiskSizeNotGigAligned;
-          }
-          else if (hashCode == DuplicateCertificateInfo_HASH)
-          {
-            return ErrorCode::DuplicateCertificateInfo;
-          }
-          else if (hashCode == DuplicateSchedule_HASH)
-          {
-            return ErrorCode::DuplicateSchedule;
-          }
-          else if (hashCode == EndpointNotFound_HASH)
-          {
-            return ErrorCode::EndpointNotFound;
-          }
-          else if (hashCode == IAMNotSupported_HASH)
-          {
-            return ErrorCode::IAMNotSupported;
-          }
-          else if (hashCode == InitiatorInvalid_HASH)
-          {
-            return ErrorCode::InitiatorInvalid;
-          }
-          else if (hashCode == InitiatorNotFound_HASH)
-          {
-            return ErrorCode::InitiatorNotFound;
-          }
-          else if (hashCode == InternalError_HASH)
-          {
-            return ErrorCode::InternalError;
-          }
-          else if (hashCode == InvalidGateway_HASH)
-          {
-            return ErrorCode::InvalidGateway;
-          }
-          else if (hashCode == InvalidEndpoint_HASH)
-          {
-            return ErrorCode::InvalidEndpoint;
-          }
-          else if (hashCode == InvalidParameters_HASH)
-          {
-            return ErrorCode::InvalidParameters;
-          }
-          else if (hashCode == InvalidSchedule_HASH)
-          {
-            return ErrorCode::InvalidSchedule;
-          }
-          else if (hashCode == LocalStorageLimitExceeded_HASH)
-          {
-            return ErrorCode::LocalStorageLimitExceeded;
-          }
-          else if (hashCode == LunAlreadyAllocated_HASH)
-          {
-            return ErrorCode::LunAlreadyAllocated;
-          }
-          else if (hashCode == LunInvalid_HASH)
-          {
-            return ErrorCode::LunInvalid;
-          }
-          else if (hashCode == MaximumContentLengthExceeded_HASH)
-          {
-            return ErrorCode::MaximumContentLengthExceeded;
-          }
-          else if (hashCode == MaximumTapeCartridgeCountExceeded_HASH)
-          {
-            return ErrorCode::MaximumTapeCartridgeCountExceeded;
-          }
-          else if (hashCode == MaximumVolumeCountExceeded_HASH)
-          {
-            return ErrorCode::MaximumVolumeCountExceeded;
-          }
-          else if (hashCode == NetworkConfigurationChanged_HASH)
-          {
-            return ErrorCode::NetworkConfigurationChanged;
-          }
-          else if (hashCode == NoDisksAvailable_HASH)
-          {
-            return ErrorCode::NoDisksAvailable;
-          }
-          else if (hashCode == NotImplemented_HASH)
-          {
-            return ErrorCode::NotImplemented;
-          }
-          else if (hashCode == NotSupported_HASH)
-          {
-            return ErrorCode::NotSupported;
-          }
-          else if (hashCode == OperationAborted_HASH)
-          {
-            return ErrorCode::OperationAborted;
-          }
-          else if (hashCode == OutdatedGateway_HASH)
-          {
-            return ErrorCode::OutdatedGateway;
-          }
-          else if (hashCode == ParametersNotImplemented_HASH)
-          {
-            return ErrorCode::ParametersNotImplemented;
-          }
-          else if (hashCode == RegionInvalid_HASH)
-          {
-            return ErrorCode::RegionInvalid;
-          }
-          else if (hashCode == RequestTimeout_HASH)
-          {
-            return ErrorCode::RequestTimeout;
-          }
-          else if (hashCode == ServiceUnavailable_HASH)
-          {
-            return ErrorCode::ServiceUnavailable;
-          }
-          else if (hashCode == SnapshotDeleted_HASH)
-          {
-            return ErrorCode::SnapshotDeleted;
-          }
-          else if (hashCode == SnapshotIdInvalid_HASH)
-          {
-            return ErrorCode::SnapshotIdInvalid;
-          }
-          else if (hashCode == SnapshotInProgress_HASH)
-          {
-            return ErrorCode::SnapshotInProgress;
-          }
-          else if (hashCode == SnapshotNotFound_HASH)
-          {
-            return ErrorCode::SnapshotNotFound;
-          }
-          else if (hashCode == SnapshotScheduleNotFound_HASH)
-          {
-            return ErrorCode::SnapshotScheduleNotFound;
-          }
-          else if (hashCode == StagingAreaFull_HASH)
-          {
-            return ErrorCode::StagingAreaFull;
-          }
-          else if (hashCode == StorageFailure_HASH)
-          {
-            return ErrorCode::StorageFailure;
-          }
-          else if (hashCode == TapeCartridgeNotFound_HASH)
-          {
-            return ErrorCode::TapeCartridgeNotFound;
-          }
-          else if (hashCode == TargetAlreadyExists_HASH)
-          {
-            return ErrorCode::TargetAlreadyExists;
-          }
-          else if (hashCode == TargetInvalid_HASH)
-          {
-            return ErrorCode::TargetInvalid;
-          }
-          else if (hashCode == TargetNotFound_HASH)
-          {
-            return ErrorCode::TargetNotFound;
-          }
-          else if (hashCode == UnauthorizedOperation_HASH)
-          {
-            return ErrorCode::UnauthorizedOperation;
-          }
-          else if (hashCode == VolumeAlreadyExists_HASH)
-          {
-            return ErrorCode::VolumeAlreadyExists;
-          }
-          else if (hashCode == VolumeIdInvalid_HASH)
-          {
-            return ErrorCode::VolumeIdInvalid;
-          }
-          else if (hashCode == VolumeInUse_HASH)
-          {
-            return ErrorCode::VolumeInUse;
-          }
-          else if (hashCode == VolumeNotFound_HASH)
-          {
-            return ErrorCode::VolumeNotFound;
-          }
-          else if (hashCode == VolumeNotReady_HASH)
-          {
-            return ErrorCode::VolumeNotReady;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 1103836572:
+            if (name == "ActivationKeyExpired")
+            {
+              return ErrorCode::ActivationKeyExpired;
+            }
+            break;
+          case 77889646:
+            if (name == "ActivationKeyInvalid")
+            {
+              return ErrorCode::ActivationKeyInvalid;
+            }
+            break;
+          case -950859560:
+            if (name == "ActivationKeyNotFound")
+            {
+              return ErrorCode::ActivationKeyNotFound;
+            }
+            break;
+          case 1416050055:
+            if (name == "GatewayInternalError")
+            {
+              return ErrorCode::GatewayInternalError;
+            }
+            break;
+          case 343933370:
+            if (name == "GatewayNotConnected")
+            {
+              return ErrorCode::GatewayNotConnected;
+            }
+            break;
+          case -666589517:
+            if (name == "GatewayNotFound")
+            {
+              return ErrorCode::GatewayNotFound;
+            }
+            break;
+          case -1314083013:
+            if (name == "GatewayProxyNetworkConnectionBusy")
+            {
+              return ErrorCode::GatewayProxyNetworkConnectionBusy;
+            }
+            break;
+          case 385417170:
+            if (name == "AuthenticationFailure")
+            {
+              return ErrorCode::AuthenticationFailure;
+            }
+            break;
+          case 116069665:
+            if (name == "BandwidthThrottleScheduleNotFound")
+            {
+              return ErrorCode::BandwidthThrottleScheduleNotFound;
+            }
+            break;
+          case 1643215308:
+            if (name == "Blocked")
+            {
+              return ErrorCode::Blocked;
+            }
+            break;
+          case -639487589:
+            if (name == "CannotExportSnapshot")
+            {
+              return ErrorCode::CannotExportSnapshot;
+            }
+            break;
+          case 743578746:
+            if (name == "ChapCredentialNotFound")
+            {
+              return ErrorCode::ChapCredentialNotFound;
+            }
+            break;
+          case -631384276:
+            if (name == "DiskAlreadyAllocated")
+            {
+              return ErrorCode::DiskAlreadyAllocated;
+            }
+            break;
+          case -476464166:
+            if (name == "DiskDoesNotExist")
+            {
+              return ErrorCode::DiskDoesNotExist;
+            }
+            break;
+          case 766441358:
+            if (name == "DiskSizeGreaterThanVolumeMaxSize")
+            {
+              return ErrorCode::DiskSizeGreaterThanVolumeMaxSize;
+            }
+            break;
+          case 498086067:
+            if (name == "DiskSizeLessThanVolumeSize")
+            {
+              return ErrorCode::DiskSizeLessThanVolumeSize;
+            }
+            break;
+          case -2083329196:
+            if (name == "DiskSizeNotGigAligned")
+            {
+              return ErrorCode::DiskSizeNotGigAligned;
+            }
+            break;
+          case 587918970:
+            if (name == "DuplicateCertificateInfo")
+            {
+              return ErrorCode::DuplicateCertificateInfo;
+            }
+            break;
+          case 1626949794:
+            if (name == "DuplicateSchedule")
+            {
+              return ErrorCode::DuplicateSchedule;
+            }
+            break;
+          case -345822908:
+            if (name == "EndpointNotFound")
+            {
+              return ErrorCode::EndpointNotFound;
+            }
+            break;
+          case -987787792:
+            if (name == "IAMNotSupported")
+            {
+              return ErrorCode::IAMNotSupported;
+            }
+            break;
+          case 1308428520:
+            if (name == "InitiatorInvalid")
+            {
+              return ErrorCode::InitiatorInvalid;
+            }
+            break;
+          case -1458860130:
+            if (name == "InitiatorNotFound")
+            {
+              return ErrorCode::InitiatorNotFound;
+            }
+            break;
+          case -1693386453:
+            if (name == "InternalError")
+            {
+              return ErrorCode::InternalError;
+            }
+            break;
+          case -1509235603:
+            if (name == "InvalidGateway")
+            {
+              return ErrorCode::InvalidGateway;
+            }
+            break;
+          case -527809396:
+            if (name == "InvalidEndpoint")
+            {
+              return ErrorCode::InvalidEndpoint;
+            }
+            break;
+          case 1877804833:
+            if (name == "InvalidParameters")
+            {
+              return ErrorCode::InvalidParameters;
+            }
+            break;
+          case 1328134542:
+            if (name == "InvalidSchedule")
+            {
+              return ErrorCode::InvalidSchedule;
+            }
+            break;
+          case -493529762:
+            if (name == "LocalStorageLimitExceeded")
+            {
+              return ErrorCode::LocalStorageLimitExceeded;
+            }
+            break;
+          case -999229108:
+            if (name == "LunAlreadyAllocated ")
+            {
+              return ErrorCode::LunAlreadyAllocated;
+            }
+            break;
+          case -1008852398:
+            if (name == "LunInvalid")
+            {
+              return ErrorCode::LunInvalid;
+            }
+            break;
+          case 560940818:
+            if (name == "MaximumContentLengthExceeded")
+            {
+              return ErrorCode::MaximumContentLengthExceeded;
+            }
+            break;
+          case -1889736295:
+            if (name == "MaximumTapeCartridgeCountExceeded")
+            {
+              return ErrorCode::MaximumTapeCartridgeCountExceeded;
+            }
+            break;
+          case 485557864:
+            if (name == "MaximumVolumeCountExceeded")
+            {
+              return ErrorCode::MaximumVolumeCountExceeded;
+            }
+            break;
+          case 641120268:
+            if (name == "NetworkConfigurationChanged")
+            {
+              return ErrorCode::NetworkConfigurationChanged;
+            }
+            break;
+          case 1011966260:
+            if (name == "NoDisksAvailable")
+            {
+              return ErrorCode::NoDisksAvailable;
+            }
+            break;
+          case -2132380593:
+            if (name == "NotImplemented")
+            {
+              return ErrorCode::NotImplemented;
+            }
+            break;
+          case 248847163:
+            if (name == "NotSupported")
+            {
+              return ErrorCode::NotSupported;
+            }
+            break;
+          case -614819704:
+            if (name == "OperationAborted")
+            {
+              return ErrorCode::OperationAborted;
+            }
+            break;
+          case -1867667172:
+            if (name == "OutdatedGateway")
+            {
+              return ErrorCode::OutdatedGateway;
+            }
+            break;
+          case -2055882535:
+            if (name == "ParametersNotImplemented")
+            {
+              return ErrorCode::ParametersNotImplemented;
+            }
+            break;
+          case 1302829123:
+            if (name == "RegionInvalid")
+            {
+              return ErrorCode::RegionInvalid;
+            }
+            break;
+          case 122916850:
+            if (name == "RequestTimeout")
+            {
+              return ErrorCode::RequestTimeout;
+            }
+            break;
+          case -1847483781:
+            if (name == "ServiceUnavailable")
+            {
+              return ErrorCode::ServiceUnavailable;
+            }
+            break;
+          case 683107733:
+            if (name == "SnapshotDeleted")
+            {
+              return ErrorCode::SnapshotDeleted;
+            }
+            break;
+          case 702897880:
+            if (name == "SnapshotIdInvalid")
+            {
+              return ErrorCode::SnapshotIdInvalid;
+            }
+            break;
+          case 2090420086:
+            if (name == "SnapshotInProgress")
+            {
+              return ErrorCode::SnapshotInProgress;
+            }
+            break;
+          case 435110515:
+            if (name == "SnapshotNotFound")
+            {
+              return ErrorCode::SnapshotNotFound;
+            }
+            break;
+          case 785608234:
+            if (name == "SnapshotScheduleNotFound")
+            {
+              return ErrorCode::SnapshotScheduleNotFound;
+            }
+            break;
+          case 1143677431:
+            if (name == "StagingAreaFull")
+            {
+              return ErrorCode::StagingAreaFull;
+            }
+            break;
+          case 1204658863:
+            if (name == "StorageFailure")
+            {
+              return ErrorCode::StorageFailure;
+            }
+            break;
+          case 269657080:
+            if (name == "TapeCartridgeNotFound")
+            {
+              return ErrorCode::TapeCartridgeNotFound;
+            }
+            break;
+          case 752634019:
+            if (name == "TargetAlreadyExists")
+            {
+              return ErrorCode::TargetAlreadyExists;
+            }
+            break;
+          case 767726342:
+            if (name == "TargetInvalid")
+            {
+              return ErrorCode::TargetInvalid;
+            }
+            break;
+          case -1040758464:
+            if (name == "TargetNotFound")
+            {
+              return ErrorCode::TargetNotFound;
+            }
+            break;
+          case -1181827405:
+            if (name == "UnauthorizedOperation")
+            {
+              return ErrorCode::UnauthorizedOperation;
+            }
+            break;
+          case -1928930886:
+            if (name == "VolumeAlreadyExists")
+            {
+              return ErrorCode::VolumeAlreadyExists;
+            }
+            break;
+          case -1137514942:
+            if (name == "VolumeIdInvalid")
+            {
+              return ErrorCode::VolumeIdInvalid;
+            }
+            break;
+          case 772612872:
+            if (name == "VolumeInUse")
+            {
+              return ErrorCode::VolumeInUse;
+            }
+            break;
+          case 2038310345:
+            if (name == "VolumeNotFound")
+            {
+              return ErrorCode::VolumeNotFound;
+            }
+            break;
+          case 2049075178:
+            if (name == "VolumeNotReady")
+            {
+              return ErrorCode::VolumeNotReady;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -350,141 +485,26 @@ namespace Aws
           return ErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        const char* GetNameForErrorCodeCStr(ErrorCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ErrorCode::ActivationKeyExpired:
-            return "ActivationKeyExpired";
-          case ErrorCode::ActivationKeyInvalid:
-            return "ActivationKeyInvalid";
-          case ErrorCode::ActivationKeyNotFound:
-            return "ActivationKeyNotFound";
-          case ErrorCode::GatewayInternalError:
-            return "GatewayInternalError";
-          case ErrorCode::GatewayNotConnected:
-            return "GatewayNotConnected";
-          case ErrorCode::GatewayNotFound:
-            return "GatewayNotFound";
-          case ErrorCode::GatewayProxyNetworkConnectionBusy:
-            return "GatewayProxyNetworkConnectionBusy";
-          case ErrorCode::AuthenticationFailure:
-            return "AuthenticationFailure";
-          case ErrorCode::BandwidthThrottleScheduleNotFound:
-            return "BandwidthThrottleScheduleNotFound";
-          case ErrorCode::Blocked:
-            return "Blocked";
-          case ErrorCode::CannotExportSnapshot:
-            return "CannotExportSnapshot";
-          case ErrorCode::ChapCredentialNotFound:
-            return "ChapCredentialNotFound";
-          case ErrorCode::DiskAlreadyAllocated:
-            return "DiskAlreadyAllocated";
-          case ErrorCode::DiskDoesNotExist:
-            return "DiskDoesNotExist";
-          case ErrorCode::DiskSizeGreaterThanVolumeMaxSize:
-            return "DiskSizeGreaterThanVolumeMaxSize";
-          case ErrorCode::DiskSizeLessThanVolumeSize:
-            return "DiskSizeLessThanVolumeSize";
-          case ErrorCode::DiskSizeNotGigAligned:
-            return "DiskSizeNotGigAligned";
-          case ErrorCode::DuplicateCertificateInfo:
-            return "DuplicateCertificateInfo";
-          case ErrorCode::DuplicateSchedule:
-            return "DuplicateSchedule";
-          case ErrorCode::EndpointNotFound:
-            return "EndpointNotFound";
-          case ErrorCode::IAMNotSupported:
-            return "IAMNotSupported";
-          case ErrorCode::InitiatorInvalid:
-            return "InitiatorInvalid";
-          case ErrorCode::InitiatorNotFound:
-            return "InitiatorNotFound";
-          case ErrorCode::InternalError:
-            return "InternalError";
-          case ErrorCode::InvalidGateway:
-            return "InvalidGateway";
-          case ErrorCode::InvalidEndpoint:
-            return "InvalidEndpoint";
-          case ErrorCode::InvalidParameters:
-            return "InvalidParameters";
-          case ErrorCode::InvalidSchedule:
-            return "InvalidSchedule";
-          case ErrorCode::LocalStorageLimitExceeded:
-            return "LocalStorageLimitExceeded";
-          case ErrorCode::LunAlreadyAllocated:
-            return "LunAlreadyAllocated ";
-          case ErrorCode::LunInvalid:
-            return "LunInvalid";
-          case ErrorCode::MaximumContentLengthExceeded:
-            return "MaximumContentLengthExceeded";
-          case ErrorCode::MaximumTapeCartridgeCountExceeded:
-            return "MaximumTapeCartridgeCountExceeded";
-          case ErrorCode::MaximumVolumeCountExceeded:
-            return "MaximumVolumeCountExceeded";
-          case ErrorCode::NetworkConfigurationChanged:
-            return "NetworkConfigurationChanged";
-          case ErrorCode::NoDisksAvailable:
-            return "NoDisksAvailable";
-          case ErrorCode::NotImplemented:
-            return "NotImplemented";
-          case ErrorCode::NotSupported:
-            return "NotSupported";
-          case ErrorCode::OperationAborted:
-            return "OperationAborted";
-          case ErrorCode::OutdatedGateway:
-            return "OutdatedGateway";
-          case ErrorCode::ParametersNotImplemented:
-            return "ParametersNotImplemented";
-          case ErrorCode::RegionInvalid:
-            return "RegionInvalid";
-          case ErrorCode::RequestTimeout:
-            return "RequestTimeout";
-          case ErrorCode::ServiceUnavailable:
-            return "ServiceUnavailable";
-          case ErrorCode::SnapshotDeleted:
-            return "SnapshotDeleted";
-          case ErrorCode::SnapshotIdInvalid:
-            return "SnapshotIdInvalid";
-          case ErrorCode::SnapshotInProgress:
-            return "SnapshotInProgress";
-          case ErrorCode::SnapshotNotFound:
-            return "SnapshotNotFound";
-          case ErrorCode::SnapshotScheduleNotFound:
-            return "SnapshotScheduleNotFound";
-          case ErrorCode::StagingAreaFull:
-            return "StagingAreaFull";
-          case ErrorCode::StorageFailure:
-            return "StorageFailure";
-          case ErrorCode::TapeCartridgeNotFound:
-            return "TapeCartridgeNotFound";
-          case ErrorCode::TargetAlreadyExists:
-            return "TargetAlreadyExists";
-          case ErrorCode::TargetInvalid:
-            return "TargetInvalid";
-          case ErrorCode::TargetNotFound:
-            return "TargetNotFound";
-          case ErrorCode::UnauthorizedOperation:
-            return "UnauthorizedOperation";
-          case ErrorCode::VolumeAlreadyExists:
-            return "VolumeAlreadyExists";
-          case ErrorCode::VolumeIdInvalid:
-            return "VolumeIdInvalid";
-          case ErrorCode::VolumeInUse:
-            return "VolumeInUse";
-          case ErrorCode::VolumeNotFound:
-            return "VolumeNotFound";
-          case ErrorCode::VolumeNotReady:
-            return "VolumeNotReady";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        {
+          return GetNameForErrorCodeCStr(enumValue);
         }
 
       } // namespace ErrorCodeMapper
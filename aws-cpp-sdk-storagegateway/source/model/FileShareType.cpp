@@ -30,20 +30,37 @@ namespace Aws
       namespace FileShareTypeMapper
       {
 
-        static const int NFS_HASH = HashingUtils::HashString("NFS");
-        static const int SMB_HASH = HashingUtils::HashString("SMB");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NFS",
+          "SMB",
+        };
 
         FileShareType GetFileShareTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NFS_HASH)
-          {
-            return FileShareType::NFS;
-          }
-          else if (hashCode == SMB_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FileShareType::SMB;
+          case 77211:
+            if (name == "NFS")
+            {
+              return FileShareType::NFS;
+            }
+            break;
+          case 82216:
+            if (name == "SMB")
+            {
+              return FileShareType::SMB;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FileShareType::NOT_SET;
         }
 
-        Aws::String GetNameForFileShareType(FileShareType enumValue)
+        const char* GetNameForFileShareTypeCStr(FileShareType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FileShareType::NFS:
-            return "NFS";
-          case FileShareType::SMB:
-            return "SMB";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFileShareType(FileShareType enumValue)
+        {
+          return GetNameForFileShareTypeCStr(enumValue);
         }
 
       } // namespace FileShareTypeMapper
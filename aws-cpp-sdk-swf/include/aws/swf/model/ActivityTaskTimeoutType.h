@@ -37,6 +37,11 @@ namespace ActivityTaskTimeoutTypeMapper
 AWS_SWF_API ActivityTaskTimeoutType GetActivityTaskTimeoutTypeForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForActivityTaskTimeoutType(ActivityTaskTimeoutType value);
+
+/**
+ * Same as GetNameForActivityTaskTimeoutType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForActivityTaskTimeoutTypeCStr(ActivityTaskTimeoutType value);
 } // namespace ActivityTaskTimeoutTypeMapper
 } // namespace Model
 } // namespace SWF
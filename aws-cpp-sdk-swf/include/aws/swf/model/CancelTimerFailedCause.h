@@ -35,6 +35,11 @@ namespace CancelTimerFailedCauseMapper
 AWS_SWF_API CancelTimerFailedCause GetCancelTimerFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForCancelTimerFailedCause(CancelTimerFailedCause value);
+
+/**
+ * Same as GetNameForCancelTimerFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForCancelTimerFailedCauseCStr(CancelTimerFailedCause value);
 } // namespace CancelTimerFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -35,6 +35,11 @@ namespace CancelWorkflowExecutionFailedCauseMapper
 AWS_SWF_API CancelWorkflowExecutionFailedCause GetCancelWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForCancelWorkflowExecutionFailedCause(CancelWorkflowExecutionFailedCause value);
+
+/**
+ * Same as GetNameForCancelWorkflowExecutionFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForCancelWorkflowExecutionFailedCauseCStr(CancelWorkflowExecutionFailedCause value);
 } // namespace CancelWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
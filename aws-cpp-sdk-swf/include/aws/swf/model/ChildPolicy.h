@@ -36,6 +36,11 @@ namespace ChildPolicyMapper
 AWS_SWF_API ChildPolicy GetChildPolicyForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForChildPolicy(ChildPolicy value);
+
+/**
+ * Same as GetNameForChildPolicy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForChildPolicyCStr(ChildPolicy value);
 } // namespace ChildPolicyMapper
 } // namespace Model
 } // namespace SWF
@@ -39,6 +39,11 @@ namespace CloseStatusMapper
 AWS_SWF_API CloseStatus GetCloseStatusForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForCloseStatus(CloseStatus value);
+
+/**
+ * Same as GetNameForCloseStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForCloseStatusCStr(CloseStatus value);
 } // namespace CloseStatusMapper
 } // namespace Model
 } // namespace SWF
@@ -35,6 +35,11 @@ namespace CompleteWorkflowExecutionFailedCauseMapper
 AWS_SWF_API CompleteWorkflowExecutionFailedCause GetCompleteWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForCompleteWorkflowExecutionFailedCause(CompleteWorkflowExecutionFailedCause value);
+
+/**
+ * Same as GetNameForCompleteWorkflowExecutionFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForCompleteWorkflowExecutionFailedCauseCStr(CompleteWorkflowExecutionFailedCause value);
 } // namespace CompleteWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
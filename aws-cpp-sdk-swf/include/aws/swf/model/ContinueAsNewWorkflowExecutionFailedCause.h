@@ -42,6 +42,11 @@ namespace ContinueAsNewWorkflowExecutionFailedCauseMapper
 AWS_SWF_API ContinueAsNewWorkflowExecutionFailedCause GetContinueAsNewWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForContinueAsNewWorkflowExecutionFailedCause(ContinueAsNewWorkflowExecutionFailedCause value);
+
+/**
+ * Same as GetNameForContinueAsNewWorkflowExecutionFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForContinueAsNewWorkflowExecutionFailedCauseCStr(ContinueAsNewWorkflowExecutionFailedCause value);
 } // namespace ContinueAsNewWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
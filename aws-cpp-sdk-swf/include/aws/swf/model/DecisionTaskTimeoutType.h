@@ -34,6 +34,11 @@ namespace DecisionTaskTimeoutTypeMapper
 AWS_SWF_API DecisionTaskTimeoutType GetDecisionTaskTimeoutTypeForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForDecisionTaskTimeoutType(DecisionTaskTimeoutType value);
+
+/**
+ * Same as GetNameForDecisionTaskTimeoutType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForDecisionTaskTimeoutTypeCStr(DecisionTaskTimeoutType value);
 } // namespace DecisionTaskTimeoutTypeMapper
 } // namespace Model
 } // namespace SWF
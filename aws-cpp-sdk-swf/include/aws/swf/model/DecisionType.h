@@ -46,6 +46,11 @@ namespace DecisionTypeMapper
 AWS_SWF_API DecisionType GetDecisionTypeForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForDecisionType(DecisionType value);
+
+/**
+ * Same as GetNameForDecisionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForDecisionTypeCStr(DecisionType value);
 } // namespace DecisionTypeMapper
 } // namespace Model
 } // namespace SWF
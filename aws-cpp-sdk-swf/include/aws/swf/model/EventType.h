@@ -87,6 +87,11 @@ namespace EventTypeMapper
 AWS_SWF_API EventType GetEventTypeForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForEventType(EventType value);
+
+/**
+ * Same as GetNameForEventType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForEventTypeCStr(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace SWF
@@ -35,6 +35,11 @@ namespace ExecutionStatusMapper
 AWS_SWF_API ExecutionStatus GetExecutionStatusForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForExecutionStatus(ExecutionStatus value);
+
+/**
+ * Same as GetNameForExecutionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForExecutionStatusCStr(ExecutionStatus value);
 } // namespace ExecutionStatusMapper
 } // namespace Model
 } // namespace SWF
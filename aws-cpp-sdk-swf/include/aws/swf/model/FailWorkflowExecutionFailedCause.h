@@ -35,6 +35,11 @@ namespace FailWorkflowExecutionFailedCauseMapper
 AWS_SWF_API FailWorkflowExecutionFailedCause GetFailWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForFailWorkflowExecutionFailedCause(FailWorkflowExecutionFailedCause value);
+
+/**
+ * Same as GetNameForFailWorkflowExecutionFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForFailWorkflowExecutionFailedCauseCStr(FailWorkflowExecutionFailedCause value);
 } // namespace FailWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -34,6 +34,11 @@ namespace LambdaFunctionTimeoutTypeMapper
 AWS_SWF_API LambdaFunctionTimeoutType GetLambdaFunctionTimeoutTypeForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForLambdaFunctionTimeoutType(LambdaFunctionTimeoutType value);
+
+/**
+ * Same as GetNameForLambdaFunctionTimeoutType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForLambdaFunctionTimeoutTypeCStr(LambdaFunctionTimeoutType value);
 } // namespace LambdaFunctionTimeoutTypeMapper
 } // namespace Model
 } // namespace SWF
@@ -34,6 +34,11 @@ namespace RecordMarkerFailedCauseMapper
 AWS_SWF_API RecordMarkerFailedCause GetRecordMarkerFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForRecordMarkerFailedCause(RecordMarkerFailedCause value);
+
+/**
+ * Same as GetNameForRecordMarkerFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForRecordMarkerFailedCauseCStr(RecordMarkerFailedCause value);
 } // namespace RecordMarkerFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -35,6 +35,11 @@ namespace RequestCancelActivityTaskFailedCauseMapper
 AWS_SWF_API RequestCancelActivityTaskFailedCause GetRequestCancelActivityTaskFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForRequestCancelActivityTaskFailedCause(RequestCancelActivityTaskFailedCause value);
+
+/**
+ * Same as GetNameForRequestCancelActivityTaskFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForRequestCancelActivityTaskFailedCauseCStr(RequestCancelActivityTaskFailedCause value);
 } // namespace RequestCancelActivityTaskFailedCauseMapper
 } // namespace Model
 } // namespace SWF
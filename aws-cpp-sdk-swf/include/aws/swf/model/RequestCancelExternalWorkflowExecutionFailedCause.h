@@ -36,6 +36,11 @@ namespace RequestCancelExternalWorkflowExecutionFailedCauseMapper
 AWS_SWF_API RequestCancelExternalWorkflowExecutionFailedCause GetRequestCancelExternalWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForRequestCancelExternalWorkflowExecutionFailedCause(RequestCancelExternalWorkflowExecutionFailedCause value);
+
+/**
+ * Same as GetNameForRequestCancelExternalWorkflowExecutionFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForRequestCancelExternalWorkflowExecutionFailedCauseCStr(RequestCancelExternalWorkflowExecutionFailedCause value);
 } // namespace RequestCancelExternalWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -44,6 +44,11 @@ namespace ScheduleActivityTaskFailedCauseMapper
 AWS_SWF_API ScheduleActivityTaskFailedCause GetScheduleActivityTaskFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForScheduleActivityTaskFailedCause(ScheduleActivityTaskFailedCause value);
+
+/**
+ * Same as GetNameForScheduleActivityTaskFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForScheduleActivityTaskFailedCauseCStr(ScheduleActivityTaskFailedCause value);
 } // namespace ScheduleActivityTaskFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -37,6 +37,11 @@ namespace ScheduleLambdaFunctionFailedCauseMapper
 AWS_SWF_API ScheduleLambdaFunctionFailedCause GetScheduleLambdaFunctionFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForScheduleLambdaFunctionFailedCause(ScheduleLambdaFunctionFailedCause value);
+
+/**
+ * Same as GetNameForScheduleLambdaFunctionFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForScheduleLambdaFunctionFailedCauseCStr(ScheduleLambdaFunctionFailedCause value);
 } // namespace ScheduleLambdaFunctionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
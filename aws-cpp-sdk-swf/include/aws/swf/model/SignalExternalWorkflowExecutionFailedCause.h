@@ -36,6 +36,11 @@ namespace SignalExternalWorkflowExecutionFailedCauseMapper
 AWS_SWF_API SignalExternalWorkflowExecutionFailedCause GetSignalExternalWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForSignalExternalWorkflowExecutionFailedCause(SignalExternalWorkflowExecutionFailedCause value);
+
+/**
+ * Same as GetNameForSignalExternalWorkflowExecutionFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForSignalExternalWorkflowExecutionFailedCauseCStr(SignalExternalWorkflowExecutionFailedCause value);
 } // namespace SignalExternalWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
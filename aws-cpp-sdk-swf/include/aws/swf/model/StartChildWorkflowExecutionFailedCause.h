@@ -44,6 +44,11 @@ namespace StartChildWorkflowExecutionFailedCauseMapper
 AWS_SWF_API StartChildWorkflowExecutionFailedCause GetStartChildWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForStartChildWorkflowExecutionFailedCause(StartChildWorkflowExecutionFailedCause value);
+
+/**
+ * Same as GetNameForStartChildWorkflowExecutionFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForStartChildWorkflowExecutionFailedCauseCStr(StartChildWorkflowExecutionFailedCause value);
 } // namespace StartChildWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
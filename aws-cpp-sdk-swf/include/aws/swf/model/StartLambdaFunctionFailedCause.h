@@ -34,6 +34,11 @@ namespace StartLambdaFunctionFailedCauseMapper
 AWS_SWF_API StartLambdaFunctionFailedCause GetStartLambdaFunctionFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForStartLambdaFunctionFailedCause(StartLambdaFunctionFailedCause value);
+
+/**
+ * Same as GetNameForStartLambdaFunctionFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForStartLambdaFunctionFailedCauseCStr(StartLambdaFunctionFailedCause value);
 } // namespace StartLambdaFunctionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -37,6 +37,11 @@ namespace StartTimerFailedCauseMapper
 AWS_SWF_API StartTimerFailedCause GetStartTimerFailedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForStartTimerFailedCause(StartTimerFailedCause value);
+
+/**
+ * Same as GetNameForStartTimerFailedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForStartTimerFailedCauseCStr(StartTimerFailedCause value);
 } // namespace StartTimerFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -34,6 +34,11 @@ namespace WorkflowExecutionCancelRequestedCauseMapper
 AWS_SWF_API WorkflowExecutionCancelRequestedCause GetWorkflowExecutionCancelRequestedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForWorkflowExecutionCancelRequestedCause(WorkflowExecutionCancelRequestedCause value);
+
+/**
+ * Same as GetNameForWorkflowExecutionCancelRequestedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForWorkflowExecutionCancelRequestedCauseCStr(WorkflowExecutionCancelRequestedCause value);
 } // namespace WorkflowExecutionCancelRequestedCauseMapper
 } // namespace Model
 } // namespace SWF
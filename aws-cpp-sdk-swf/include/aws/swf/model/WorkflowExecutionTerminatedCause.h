@@ -36,6 +36,11 @@ namespace WorkflowExecutionTerminatedCauseMapper
 AWS_SWF_API WorkflowExecutionTerminatedCause GetWorkflowExecutionTerminatedCauseForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForWorkflowExecutionTerminatedCause(WorkflowExecutionTerminatedCause value);
+
+/**
+ * Same as GetNameForWorkflowExecutionTerminatedCause(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForWorkflowExecutionTerminatedCauseCStr(WorkflowExecutionTerminatedCause value);
 } // namespace WorkflowExecutionTerminatedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -34,6 +34,11 @@ namespace WorkflowExecutionTimeoutTypeMapper
 AWS_SWF_API WorkflowExecutionTimeoutType GetWorkflowExecutionTimeoutTypeForName(const Aws::String& name);
 
 AWS_SWF_API Aws::String GetNameForWorkflowExecutionTimeoutType(WorkflowExecutionTimeoutType value);
+
+/**
+ * Same as GetNameForWorkflowExecutionTimeoutType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_SWF_API const char* GetNameForWorkflowExecutionTimeoutTypeCStr(WorkflowExecutionTimeoutType value);
 } // namespace WorkflowExecutionTimeoutTypeMapper
 } // namespace Model
 } // namespace SWF
@@ -30,30 +30,51 @@ namespace Aws
       namespace ActivityTaskTimeoutTypeMapper
       {
 
-        static const int START_TO_CLOSE_HASH = HashingUtils::HashString("START_TO_CLOSE");
-        static const int SCHEDULE_TO_START_HASH = HashingUtils::HashString("SCHEDULE_TO_START");
-        static const int SCHEDULE_TO_CLOSE_HASH = HashingUtils::HashString("SCHEDULE_TO_CLOSE");
-        static const int HEARTBEAT_HASH = HashingUtils::HashString("HEARTBEAT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "START_TO_CLOSE",
+          "SCHEDULE_TO_START",
+          "SCHEDULE_TO_CLOSE",
+          "HEARTBEAT",
+        };
 
         ActivityTaskTimeoutType GetActivityTaskTimeoutTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == START_TO_CLOSE_HASH)
-          {
-            return ActivityTaskTimeoutType::START_TO_CLOSE;
-          }
-          else if (hashCode == SCHEDULE_TO_START_HASH)
-          {
-            return ActivityTaskTimeoutType::SCHEDULE_TO_START;
-          }
-          else if (hashCode == SCHEDULE_TO_CLOSE_HASH)
-          {
-            return ActivityTaskTimeoutType::SCHEDULE_TO_CLOSE;
-          }
-          else if (hashCode == HEARTBEAT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ActivityTaskTimeoutType::HEARTBEAT;
+          case 1604344433:
+            if (name == "START_TO_CLOSE")
+            {
+              return ActivityTaskTimeoutType::START_TO_CLOSE;
+            }
+            break;
+          case 1616960038:
+            if (name == "SCHEDULE_TO_START")
+            {
+              return ActivityTaskTimeoutType::SCHEDULE_TO_START;
+            }
+            break;
+          case 1601958844:
+            if (name == "SCHEDULE_TO_CLOSE")
+            {
+              return ActivityTaskTimeoutType::SCHEDULE_TO_CLOSE;
+            }
+            break;
+          case -1307475748:
+            if (name == "HEARTBEAT")
+            {
+              return ActivityTaskTimeoutType::HEARTBEAT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ActivityTaskTimeoutType::NOT_SET;
         }
 
-        Aws::String GetNameForActivityTaskTimeoutType(ActivityTaskTimeoutType enumValue)
+        const char* GetNameForActivityTaskTimeoutTypeCStr(ActivityTaskTimeoutType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActivityTaskTimeoutType::START_TO_CLOSE:
-            return "START_TO_CLOSE";
-          case ActivityTaskTimeoutType::SCHEDULE_TO_START:
-            return "SCHEDULE_TO_START";
-          case ActivityTaskTimeoutType::SCHEDULE_TO_CLOSE:
-            return "SCHEDULE_TO_CLOSE";
-          case ActivityTaskTimeoutType::HEARTBEAT:
-            return "HEARTBEAT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActivityTaskTimeoutType(ActivityTaskTimeoutType enumValue)
+        {
+          return GetNameForActivityTaskTimeoutTypeCStr(enumValue);
         }
 
       } // namespace ActivityTaskTimeoutTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ChildPolicyMapper
       {
 
-        static const int TERMINATE_HASH = HashingUtils::HashString("TERMINATE");
-        static const int REQUEST_CANCEL_HASH = HashingUtils::HashString("REQUEST_CANCEL");
-        static const int ABANDON_HASH = HashingUtils::HashString("ABANDON");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TERMINATE",
+          "REQUEST_CANCEL",
+          "ABANDON",
+        };
 
         ChildPolicy GetChildPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERMINATE_HASH)
-          {
-            return ChildPolicy::TERMINATE;
-          }
-          else if (hashCode == REQUEST_CANCEL_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChildPolicy::REQUEST_CANCEL;
-          }
-          else if (hashCode == ABANDON_HASH)
-          {
-            return ChildPolicy::ABANDON;
+          case 527617601:
+            if (name == "TERMINATE")
+            {
+              return ChildPolicy::TERMINATE;
+            }
+            break;
+          case -1730455990:
+            if (name == "REQUEST_CANCEL")
+            {
+              return ChildPolicy::REQUEST_CANCEL;
+            }
+            break;
+          case -489858475:
+            if (name == "ABANDON")
+            {
+              return ChildPolicy::ABANDON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ChildPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForChildPolicy(ChildPolicy enumValue)
+        const char* GetNameForChildPolicyCStr(ChildPolicy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChildPolicy::TERMINATE:
-            return "TERMINATE";
-          case ChildPolicy::REQUEST_CANCEL:
-            return "REQUEST_CANCEL";
-          case ChildPolicy::ABANDON:
-            return "ABANDON";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChildPolicy(ChildPolicy enumValue)
+        {
+          return GetNameForChildPolicyCStr(enumValue);
         }
 
       } // namespace ChildPolicyMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace CloseStatusMapper
       {
 
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int CONTINUED_AS_NEW_HASH = HashingUtils::HashString("CONTINUED_AS_NEW");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "COMPLETED",
+          "FAILED",
+          "CANCELED",
+          "TERMINATED",
+          "CONTINUED_AS_NEW",
+          "TIMED_OUT",
+        };
 
         CloseStatus GetCloseStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLETED_HASH)
-          {
-            return CloseStatus::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return CloseStatus::FAILED;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return CloseStatus::CANCELED;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return CloseStatus::TERMINATED;
-          }
-          else if (hashCode == CONTINUED_AS_NEW_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CloseStatus::CONTINUED_AS_NEW;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return CloseStatus::TIMED_OUT;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return CloseStatus::COMPLETED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return CloseStatus::FAILED;
+            }
+            break;
+          case 659453081:
+            if (name == "CANCELED")
+            {
+              return CloseStatus::CANCELED;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return CloseStatus::TERMINATED;
+            }
+            break;
+          case 663251445:
+            if (name == "CONTINUED_AS_NEW")
+            {
+              return CloseStatus::CONTINUED_AS_NEW;
+            }
+            break;
+          case -1466757626:
+            if (name == "TIMED_OUT")
+            {
+              return CloseStatus::TIMED_OUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return CloseStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCloseStatus(CloseStatus enumValue)
+        const char* GetNameForCloseStatusCStr(CloseStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CloseStatus::COMPLETED:
-            return "COMPLETED";
-          case CloseStatus::FAILED:
-            return "FAILED";
-          case CloseStatus::CANCELED:
-            return "CANCELED";
-          case CloseStatus::TERMINATED:
-            return "TERMINATED";
-          case CloseStatus::CONTINUED_AS_NEW:
-            return "CONTINUED_AS_NEW";
-          case CloseStatus::TIMED_OUT:
-            return "TIMED_OUT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCloseStatus(CloseStatus enumValue)
+        {
+          return GetNameForCloseStatusCStr(enumValue);
         }
 
       } // namespace CloseStatusMapper
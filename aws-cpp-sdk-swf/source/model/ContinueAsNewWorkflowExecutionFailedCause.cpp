@@ -30,55 +30,86 @@ namespace Aws
       namespace ContinueAsNewWorkflowExecutionFailedCauseMapper
       {
 
-        static const int UNHANDLED_DECISION_HASH = HashingUtils::HashString("UNHANDLED_DECISION");
-        static const int WORKFLOW_TYPE_DEPRECATED_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DEPRECATED");
-        static const int WORKFLOW_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DOES_NOT_EXIST");
-        static const int DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_LIST_UNDEFINED");
-        static const int DEFAULT_CHILD_POLICY_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_CHILD_POLICY_UNDEFINED");
-        static const int CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED_HASH = HashingUtils::HashString("CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNHANDLED_DECISION",
+          "WORKFLOW_TYPE_DEPRECATED",
+          "WORKFLOW_TYPE_DOES_NOT_EXIST",
+          "DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED",
+          "DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED",
+          "DEFAULT_TASK_LIST_UNDEFINED",
+          "DEFAULT_CHILD_POLICY_UNDEFINED",
+          "CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED",
+          "OPERATION_NOT_PERMITTED",
+        };
 
         ContinueAsNewWorkflowExecutionFailedCause GetContinueAsNewWorkflowExecutionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNHANDLED_DECISION_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::UNHANDLED_DECISION;
-          }
-          else if (hashCode == WORKFLOW_TYPE_DEPRECATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED;
-          }
-          else if (hashCode == WORKFLOW_TYPE_DOES_NOT_EXIST_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_LIST_UNDEFINED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_CHILD_POLICY_UNDEFINED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED;
-          }
-          else if (hashCode == CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+          case -369760712:
+            if (name == "UNHANDLED_DECISION")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::UNHANDLED_DECISION;
+            }
+            break;
+          case 412874584:
+            if (name == "WORKFLOW_TYPE_DEPRECATED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED;
+            }
+            break;
+          case -1957867734:
+            if (name == "WORKFLOW_TYPE_DOES_NOT_EXIST")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST;
+            }
+            break;
+          case -1173928279:
+            if (name == "DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case -718320320:
+            if (name == "DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case -123805269:
+            if (name == "DEFAULT_TASK_LIST_UNDEFINED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
+            }
+            break;
+          case -317730012:
+            if (name == "DEFAULT_CHILD_POLICY_UNDEFINED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED;
+            }
+            break;
+          case -1114389121:
+            if (name == "CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED;
+            }
+            break;
+          case 1767122548:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return ContinueAsNewWorkflowExecutionFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForContinueAsNewWorkflowExecutionFailedCause(ContinueAsNewWorkflowExecutionFailedCause enumValue)
+        const char* GetNameForContinueAsNewWorkflowExecutionFailedCauseCStr(ContinueAsNewWorkflowExecutionFailedCause enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ContinueAsNewWorkflowExecutionFailedCause::UNHANDLED_DECISION:
-            return "UNHANDLED_DECISION";
-          case ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED:
-            return "WORKFLOW_TYPE_DEPRECATED";
-          case ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST:
-            return "WORKFLOW_TYPE_DOES_NOT_EXIST";
-          case ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED:
-            return "DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED";
-          case ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED:
-            return "DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED";
-          case ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED:
-            return "DEFAULT_TASK_LIST_UNDEFINED";
-          case ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED:
-            return "DEFAULT_CHILD_POLICY_UNDEFINED";
-          case ContinueAsNewWorkflowExecutionFailedCause::CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED:
-            return "CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED";
-          case ContinueAsNewWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED:
-            return "OPERATION_NOT_PERMITTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForContinueAsNewWorkflowExecutionFailedCause(ContinueAsNewWorkflowExecutionFailedCause enumValue)
+        {
+          return GetNameForContinueAsNewWorkflowExecutionFailedCauseCStr(enumValue);
         }
 
       } // namespace ContinueAsNewWorkflowExecutionFailedCauseMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace DecisionTaskTimeoutTypeMapper
       {
 
-        static const int START_TO_CLOSE_HASH = HashingUtils::HashString("START_TO_CLOSE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "START_TO_CLOSE",
+        };
 
         DecisionTaskTimeoutType GetDecisionTaskTimeoutTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == START_TO_CLOSE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DecisionTaskTimeoutType::START_TO_CLOSE;
+          case 1604344433:
+            if (name == "START_TO_CLOSE")
+            {
+              return DecisionTaskTimeoutType::START_TO_CLOSE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return DecisionTaskTimeoutType::NOT_SET;
         }
 
-        Aws::String GetNameForDecisionTaskTimeoutType(DecisionTaskTimeoutType enumValue)
+        const char* GetNameForDecisionTaskTimeoutTypeCStr(DecisionTaskTimeoutType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DecisionTaskTimeoutType::START_TO_CLOSE:
-            return "START_TO_CLOSE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDecisionTaskTimeoutType(DecisionTaskTimeoutType enumValue)
+        {
+          return GetNameForDecisionTaskTimeoutTypeCStr(enumValue);
         }
 
       } // namespace DecisionTaskTimeoutTypeMapper
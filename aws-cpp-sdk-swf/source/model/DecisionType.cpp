@@ -30,75 +30,114 @@ namespace Aws
       namespace DecisionTypeMapper
       {
 
-        static const int ScheduleActivityTask_HASH = HashingUtils::HashString("ScheduleActivityTask");
-        static const int RequestCancelActivityTask_HASH = HashingUtils::HashString("RequestCancelActivityTask");
-        static const int CompleteWorkflowExecution_HASH = HashingUtils::HashString("CompleteWorkflowExecution");
-        static const int FailWorkflowExecution_HASH = HashingUtils::HashString("FailWorkflowExecution");
-        static const int CancelWorkflowExecution_HASH = HashingUtils::HashString("CancelWorkflowExecution");
-        static const int ContinueAsNewWorkflowExecution_HASH = HashingUtils::HashString("ContinueAsNewWorkflowExecution");
-        static const int RecordMarker_HASH = HashingUtils::HashString("RecordMarker");
-        static const int StartTimer_HASH = HashingUtils::HashString("StartTimer");
-        static const int CancelTimer_HASH = HashingUtils::HashString("CancelTimer");
-        static const int SignalExternalWorkflowExecution_HASH = HashingUtils::HashString("SignalExternalWorkflowExecution");
-        static const int RequestCancelExternalWorkflowExecution_HASH = HashingUtils::HashString("RequestCancelExternalWorkflowExecution");
-        static const int StartChildWorkflowExecution_HASH = HashingUtils::HashString("StartChildWorkflowExecution");
-        static const int ScheduleLambdaFunction_HASH = HashingUtils::HashString("ScheduleLambdaFunction");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ScheduleActivityTask",
+          "RequestCancelActivityTask",
+          "CompleteWorkflowExecution",
+          "FailWorkflowExecution",
+          "CancelWorkflowExecution",
+          "ContinueAsNewWorkflowExecution",
+          "RecordMarker",
+          "StartTimer",
+          "CancelTimer",
+          "SignalExternalWorkflowExecution",
+          "RequestCancelExternalWorkflowExecution",
+          "StartChildWorkflowExecution",
+          "ScheduleLambdaFunction",
+        };
 
         DecisionType GetDecisionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ScheduleActivityTask_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DecisionType::ScheduleActivityTask;
-          }
-          else if (hashCode == RequestCancelActivityTask_HASH)
-          {
-            return DecisionType::RequestCancelActivityTask;
-          }
-          else if (hashCode == CompleteWorkflowExecution_HASH)
-          {
-            return DecisionType::CompleteWorkflowExecution;
-          }
-          else if (hashCode == FailWorkflowExecution_HASH)
-          {
-            return DecisionType::FailWorkflowExecution;
-          }
-          else if (hashCode == CancelWorkflowExecution_HASH)
-          {
-            return DecisionType::CancelWorkflowExecution;
-          }
-          else if (hashCode == ContinueAsNewWorkflowExecution_HASH)
-          {
-            return DecisionType::ContinueAsNewWorkflowExecution;
-          }
-          else if (hashCode == RecordMarker_HASH)
-          {
-            return DecisionType::RecordMarker;
-          }
-          else if (hashCode == StartTimer_HASH)
-          {
-            return DecisionType::StartTimer;
-          }
-          else if (hashCode == CancelTimer_HASH)
-          {
-            return DecisionType::CancelTimer;
-          }
-          else if (hashCode == SignalExternalWorkflowExecution_HASH)
-          {
-            return DecisionType::SignalExternalWorkflowExecution;
-          }
-          else if (hashCode == RequestCancelExternalWorkflowExecution_HASH)
-          {
-            return DecisionType::RequestCancelExternalWorkflowExecution;
-          }
-          else if (hashCode == StartChildWorkflowExecution_HASH)
-          {
-            return DecisionType::StartChildWorkflowExecution;
-          }
-          else if (hashCode == ScheduleLambdaFunction_HASH)
-          {
-            return DecisionType::ScheduleLambdaFunction;
+          case 1292529035:
+            if (name == "ScheduleActivityTask")
+            {
+              return DecisionType::ScheduleActivityTask;
+            }
+            break;
+          case 202654109:
+            if (name == "RequestCancelActivityTask")
+            {
+              return DecisionType::RequestCancelActivityTask;
+            }
+            break;
+          case -11173440:
+            if (name == "CompleteWorkflowExecution")
+            {
+              return DecisionType::CompleteWorkflowExecution;
+            }
+            break;
+          case -1126976901:
+            if (name == "FailWorkflowExecution")
+            {
+              return DecisionType::FailWorkflowExecution;
+            }
+            break;
+          case -1325726049:
+            if (name == "CancelWorkflowExecution")
+            {
+              return DecisionType::CancelWorkflowExecution;
+            }
+            break;
+          case -1328466606:
+            if (name == "ContinueAsNewWorkflowExecution")
+            {
+              return DecisionType::ContinueAsNewWorkflowExecution;
+            }
+            break;
+          case 1817903115:
+            if (name == "RecordMarker")
+            {
+              return DecisionType::RecordMarker;
+            }
+            break;
+          case 409836579:
+            if (name == "StartTimer")
+            {
+              return DecisionType::StartTimer;
+            }
+            break;
+          case 85757131:
+            if (name == "CancelTimer")
+            {
+              return DecisionType::CancelTimer;
+            }
+            break;
+          case 1453743014:
+            if (name == "SignalExternalWorkflowExecution")
+            {
+              return DecisionType::SignalExternalWorkflowExecution;
+            }
+            break;
+          case 1243583429:
+            if (name == "RequestCancelExternalWorkflowExecution")
+            {
+              return DecisionType::RequestCancelExternalWorkflowExecution;
+            }
+            break;
+          case 2027766591:
+            if (name == "StartChildWorkflowExecution")
+            {
+              return DecisionType::StartChildWorkflowExecution;
+            }
+            break;
+          case -1566004394:
+            if (name == "ScheduleLambdaFunction")
+            {
+              return DecisionType::ScheduleLambdaFunction;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,45 +149,26 @@ namespace Aws
           return DecisionType::NOT_SET;
         }
 
-        Aws::String GetNameForDecisionType(DecisionType enumValue)
+        const char* GetNameForDecisionTypeCStr(DecisionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DecisionType::ScheduleActivityTask:
-            return "ScheduleActivityTask";
-          case DecisionType::RequestCancelActivityTask:
-            return "RequestCancelActivityTask";
-          case DecisionType::CompleteWorkflowExecution:
-            return "CompleteWorkflowExecution";
-          case DecisionType::FailWorkflowExecution:
-            return "FailWorkflowExecution";
-          case DecisionType::CancelWorkflowExecution:
-            return "CancelWorkflowExecution";
-          case DecisionType::ContinueAsNewWorkflowExecution:
-            return "ContinueAsNewWorkflowExecution";
-          case DecisionType::RecordMarker:
-            return "RecordMarker";
-          case DecisionType::StartTimer:
-            return "StartTimer";
-          case DecisionType::CancelTimer:
-            return "CancelTimer";
-          case DecisionType::SignalExternalWorkflowExecution:
-            return "SignalExternalWorkflowExecution";
-          case DecisionType::RequestCancelExternalWorkflowExecution:
-            return "RequestCancelExternalWorkflowExecution";
-          case DecisionType::StartChildWorkflowExecution:
-            return "StartChildWorkflowExecution";
-          case DecisionType::ScheduleLambdaFunction:
-            return "ScheduleLambdaFunction";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDecisionType(DecisionType enumValue)
+        {
+          return GetNameForDecisionTypeCStr(enumValue);
         }
 
       } // namespace DecisionTypeMapper
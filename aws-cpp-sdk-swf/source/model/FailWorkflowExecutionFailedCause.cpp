@@ -30,20 +30,37 @@ namespace Aws
       namespace FailWorkflowExecutionFailedCauseMapper
       {
 
-        static const int UNHANDLED_DECISION_HASH = HashingUtils::HashString("UNHANDLED_DECISION");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNHANDLED_DECISION",
+          "OPERATION_NOT_PERMITTED",
+        };
 
         FailWorkflowExecutionFailedCause GetFailWorkflowExecutionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNHANDLED_DECISION_HASH)
-          {
-            return FailWorkflowExecutionFailedCause::UNHANDLED_DECISION;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FailWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+          case -369760712:
+            if (name == "UNHANDLED_DECISION")
+            {
+              return FailWorkflowExecutionFailedCause::UNHANDLED_DECISION;
+            }
+            break;
+          case 1767122548:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return FailWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return FailWorkflowExecutionFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForFailWorkflowExecutionFailedCause(FailWorkflowExecutionFailedCause enumValue)
+        const char* GetNameForFailWorkflowExecutionFailedCauseCStr(FailWorkflowExecutionFailedCause enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FailWorkflowExecutionFailedCause::UNHANDLED_DECISION:
-            return "UNHANDLED_DECISION";
-          case FailWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED:
-            return "OPERATION_NOT_PERMITTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFailWorkflowExecutionFailedCause(FailWorkflowExecutionFailedCause enumValue)
+        {
+          return GetNameForFailWorkflowExecutionFailedCauseCStr(enumValue);
         }
 
       } // namespace FailWorkflowExecutionFailedCauseMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace RecordMarkerFailedCauseMapper
       {
 
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OPERATION_NOT_PERMITTED",
+        };
 
         RecordMarkerFailedCause GetRecordMarkerFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OPERATION_NOT_PERMITTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RecordMarkerFailedCause::OPERATION_NOT_PERMITTED;
+          case 1767122548:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return RecordMarkerFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return RecordMarkerFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForRecordMarkerFailedCause(RecordMarkerFailedCause enumValue)
+        const char* GetNameForRecordMarkerFailedCauseCStr(RecordMarkerFailedCause enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RecordMarkerFailedCause::OPERATION_NOT_PERMITTED:
-            return "OPERATION_NOT_PERMITTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRecordMarkerFailedCause(RecordMarkerFailedCause enumValue)
+        {
+          return GetNameForRecordMarkerFailedCauseCStr(enumValue);
         }
 
       } // namespace RecordMarkerFailedCauseMapper
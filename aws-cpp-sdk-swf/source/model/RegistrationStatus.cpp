@@ -30,20 +30,37 @@ namespace Aws
       namespace RegistrationStatusMapper
       {
 
-        static const int REGISTERED_HASH = HashingUtils::HashString("REGISTERED");
-        static const int DEPRECATED_HASH = HashingUtils::HashString("DEPRECATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REGISTERED",
+          "DEPRECATED",
+        };
 
         RegistrationStatus GetRegistrationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGISTERED_HASH)
-          {
-            return RegistrationStatus::REGISTERED;
-          }
-          else if (hashCode == DEPRECATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RegistrationStatus::DEPRECATED;
+          case -1384838526:
+            if (name == "REGISTERED")
+            {
+              return RegistrationStatus::REGISTERED;
+            }
+            break;
+          case -1147252301:
+            if (name == "DEPRECATED")
+            {
+              return RegistrationStatus::DEPRECATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RegistrationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRegistrationStatus(RegistrationStatus enumValue)
+        const char* GetNameForRegistrationStatusCStr(RegistrationStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RegistrationStatus::REGISTERED:
-            return "REGISTERED";
-          case RegistrationStatus::DEPRECATED:
-            return "DEPRECATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRegistrationStatus(RegistrationStatus enumValue)
+        {
+          return GetNameForRegistrationStatusCStr(enumValue);
         }
 
       } // namespace RegistrationStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace RequestCancelActivityTaskFailedCauseMapper
       {
 
-        static const int ACTIVITY_ID_UNKNOWN_HASH = HashingUtils::HashString("ACTIVITY_ID_UNKNOWN");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVITY_ID_UNKNOWN",
+          "OPERATION_NOT_PERMITTED",
+        };
 
         RequestCancelActivityTaskFailedCause GetRequestCancelActivityTaskFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVITY_ID_UNKNOWN_HASH)
-          {
-            return RequestCancelActivityTaskFailedCause::ACTIVITY_ID_UNKNOWN;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RequestCancelActivityTaskFailedCause::OPERATION_NOT_PERMITTED;
+          case -287776714:
+            if (name == "ACTIVITY_ID_UNKNOWN")
+            {
+              return RequestCancelActivityTaskFailedCause::ACTIVITY_ID_UNKNOWN;
+            }
+            break;
+          case 1767122548:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return RequestCancelActivityTaskFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RequestCancelActivityTaskFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForRequestCancelActivityTaskFailedCause(RequestCancelActivityTaskFailedCause enumValue)
+        const char* GetNameForRequestCancelActivityTaskFailedCauseCStr(RequestCancelActivityTaskFailedCause enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RequestCancelActivityTaskFailedCause::ACTIVITY_ID_UNKNOWN:
-            return "ACTIVITY_ID_UNKNOWN";
-          case RequestCancelActivityTaskFailedCause::OPERATION_NOT_PERMITTED:
-            return "OPERATION_NOT_PERMITTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRequestCancelActivityTaskFailedCause(RequestCancelActivityTaskFailedCause enumValue)
+        {
+          return GetNameForRequestCancelActivityTaskFailedCauseCStr(enumValue);
         }
 
       } // namespace RequestCancelActivityTaskFailedCauseMapper
@@ -30,65 +30,100 @@ namespace Aws
       namespace ScheduleActivityTaskFailedCauseMapper
       {
 
-        static const int ACTIVITY_TYPE_DEPRECATED_HASH = HashingUtils::HashString("ACTIVITY_TYPE_DEPRECATED");
-        static const int ACTIVITY_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ACTIVITY_TYPE_DOES_NOT_EXIST");
-        static const int ACTIVITY_ID_ALREADY_IN_USE_HASH = HashingUtils::HashString("ACTIVITY_ID_ALREADY_IN_USE");
-        static const int OPEN_ACTIVITIES_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_ACTIVITIES_LIMIT_EXCEEDED");
-        static const int ACTIVITY_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("ACTIVITY_CREATION_RATE_EXCEEDED");
-        static const int DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_LIST_UNDEFINED");
-        static const int DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVITY_TYPE_DEPRECATED",
+          "ACTIVITY_TYPE_DOES_NOT_EXIST",
+          "ACTIVITY_ID_ALREADY_IN_USE",
+          "OPEN_ACTIVITIES_LIMIT_EXCEEDED",
+          "ACTIVITY_CREATION_RATE_EXCEEDED",
+          "DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED",
+          "DEFAULT_TASK_LIST_UNDEFINED",
+          "DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED",
+          "DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED",
+          "DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED",
+          "OPERATION_NOT_PERMITTED",
+        };
 
         ScheduleActivityTaskFailedCause GetScheduleActivityTaskFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVITY_TYPE_DEPRECATED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DEPRECATED;
-          }
-          else if (hashCode == ACTIVITY_TYPE_DOES_NOT_EXIST_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == ACTIVITY_ID_ALREADY_IN_USE_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::ACTIVITY_ID_ALREADY_IN_USE;
-          }
-          else if (hashCode == OPEN_ACTIVITIES_LIMIT_EXCEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScheduleActivityTaskFailedCause::OPEN_ACTIVITIES_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == ACTIVITY_CREATION_RATE_EXCEEDED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::ACTIVITY_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_LIST_UNDEFINED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::OPERATION_NOT_PERMITTED;
+          case 1934324392:
+            if (name == "ACTIVITY_TYPE_DEPRECATED")
+            {
+              return ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DEPRECATED;
+            }
+            break;
+          case -1070685574:
+            if (name == "ACTIVITY_TYPE_DOES_NOT_EXIST")
+            {
+              return ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DOES_NOT_EXIST;
+            }
+            break;
+          case -764417112:
+            if (name == "ACTIVITY_ID_ALREADY_IN_USE")
+            {
+              return ScheduleActivityTaskFailedCause::ACTIVITY_ID_ALREADY_IN_USE;
+            }
+            break;
+          case 436124756:
+            if (name == "OPEN_ACTIVITIES_LIMIT_EXCEEDED")
+            {
+              return ScheduleActivityTaskFailedCause::OPEN_ACTIVITIES_LIMIT_EXCEEDED;
+            }
+            break;
+          case -304249438:
+            if (name == "ACTIVITY_CREATION_RATE_EXCEEDED")
+            {
+              return ScheduleActivityTaskFailedCause::ACTIVITY_CREATION_RATE_EXCEEDED;
+            }
+            break;
+          case -1069556015:
+            if (name == "DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case -123805269:
+            if (name == "DEFAULT_TASK_LIST_UNDEFINED")
+            {
+              return ScheduleActivityTaskFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
+            }
+            break;
+          case 209960635:
+            if (name == "DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED")
+            {
+              return ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case -342148158:
+            if (name == "DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return ScheduleActivityTaskFailedCause::DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case 788555249:
+            if (name == "DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED")
+            {
+              return ScheduleActivityTaskFailedCause::DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case 1767122548:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return ScheduleActivityTaskFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return ScheduleActivityTaskFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForScheduleActivityTaskFailedCause(ScheduleActivityTaskFailedCause enumValue)
+        const char* GetNameForScheduleActivityTaskFailedCauseCStr(ScheduleActivityTaskFailedCause enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DEPRECATED:
-            return "ACTIVITY_TYPE_DEPRECATED";
-          case ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DOES_NOT_EXIST:
-            return "ACTIVITY_TYPE_DOES_NOT_EXIST";
-          case ScheduleActivityTaskFailedCause::ACTIVITY_ID_ALREADY_IN_USE:
-            return "ACTIVITY_ID_ALREADY_IN_USE";
-          case ScheduleActivityTaskFailedCause::OPEN_ACTIVITIES_LIMIT_EXCEEDED:
-            return "OPEN_ACTIVITIES_LIMIT_EXCEEDED";
-          case ScheduleActivityTaskFailedCause::ACTIVITY_CREATION_RATE_EXCEEDED:
-            return "ACTIVITY_CREATION_RATE_EXCEEDED";
-          case ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED:
-            return "DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED";
-          case ScheduleActivityTaskFailedCause::DEFAULT_TASK_LIST_UNDEFINED:
-            return "DEFAULT_TASK_LIST_UNDEFINED";
-          case ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED:
-            return "DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED";
-          case ScheduleActivityTaskFailedCause::DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED:
-            return "DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED";
-          case ScheduleActivityTaskFailedCause::DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED:
-            return "DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED";
-          case ScheduleActivityTaskFailedCause::OPERATION_NOT_PERMITTED:
-            return "OPERATION_NOT_PERMITTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScheduleActivityTaskFailedCause(ScheduleActivityTaskFailedCause enumValue)
+        {
+          return GetNameForScheduleActivityTaskFailedCauseCStr(enumValue);
         }
 
       } // namespace ScheduleActivityTaskFailedCauseMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace ScheduleLambdaFunctionFailedCauseMapper
       {
 
-        static const int ID_ALREADY_IN_USE_HASH = HashingUtils::HashString("ID_ALREADY_IN_USE");
-        static const int OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED");
-        static const int LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED");
-        static const int LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION_HASH = HashingUtils::HashString("LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ID_ALREADY_IN_USE",
+          "OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED",
+          "LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED",
+          "LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION",
+        };
 
         ScheduleLambdaFunctionFailedCause GetScheduleLambdaFunctionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ID_ALREADY_IN_USE_HASH)
-          {
-            return ScheduleLambdaFunctionFailedCause::ID_ALREADY_IN_USE;
-          }
-          else if (hashCode == OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED_HASH)
-          {
-            return ScheduleLambdaFunctionFailedCause::OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED_HASH)
-          {
-            return ScheduleLambdaFunctionFailedCause::LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ScheduleLambdaFunctionFailedCause::LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION;
+          case -1393417000:
+            if (name == "ID_ALREADY_IN_USE")
+            {
+              return ScheduleLambdaFunctionFailedCause::ID_ALREADY_IN_USE;
+            }
+            break;
+          case -583228354:
+            if (name == "OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED")
+            {
+              return ScheduleLambdaFunctionFailedCause::OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED;
+            }
+            break;
+          case 21647937:
+            if (name == "LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED")
+            {
+              return ScheduleLambdaFunctionFailedCause::LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED;
+            }
+            break;
+          case 578301322:
+            if (name == "LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION")
+            {
+              return ScheduleLambdaFunctionFailedCause::LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ScheduleLambdaFunctionFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForScheduleLambdaFunctionFailedCause(ScheduleLambdaFunctionFailedCause enumValue)
+        const char* GetNameForScheduleLambdaFunctionFailedCauseCStr(ScheduleLambdaFunctionFailedCause enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ScheduleLambdaFunctionFailedCause::ID_ALREADY_IN_USE:
-            return "ID_ALREADY_IN_USE";
-          case ScheduleLambdaFunctionFailedCause::OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED:
-            return "OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED";
-          case ScheduleLambdaFunctionFailedCause::LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED:
-            return "LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED";
-          case ScheduleLambdaFunctionFailedCause::LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION:
-            return "LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForScheduleLambdaFunctionFailedCause(ScheduleLambdaFunctionFailedCause enumValue)
+        {
+          return GetNameForScheduleLambdaFunctionFailedCauseCStr(enumValue);
         }
 
       } // namespace ScheduleLambdaFunctionFailedCauseMapper
@@ -30,65 +30,100 @@ namespace Aws
       namespace StartChildWorkflowExecutionFailedCauseMapper
       {
 
-        static const int WORKFLOW_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DOES_NOT_EXIST");
-        static const int WORKFLOW_TYPE_DEPRECATED_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DEPRECATED");
-        static const int OPEN_CHILDREN_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_CHILDREN_LIMIT_EXCEEDED");
-        static const int OPEN_WORKFLOWS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_WORKFLOWS_LIMIT_EXCEEDED");
-        static const int CHILD_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("CHILD_CREATION_RATE_EXCEEDED");
-        static const int WORKFLOW_ALREADY_RUNNING_HASH = HashingUtils::HashString("WORKFLOW_ALREADY_RUNNING");
-        static const int DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_LIST_UNDEFINED");
-        static const int DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_CHILD_POLICY_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_CHILD_POLICY_UNDEFINED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WORKFLOW_TYPE_DOES_NOT_EXIST",
+          "WORKFLOW_TYPE_DEPRECATED",
+          "OPEN_CHILDREN_LIMIT_EXCEEDED",
+          "OPEN_WORKFLOWS_LIMIT_EXCEEDED",
+          "CHILD_CREATION_RATE_EXCEEDED",
+          "WORKFLOW_ALREADY_RUNNING",
+          "DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED",
+          "DEFAULT_TASK_LIST_UNDEFINED",
+          "DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED",
+          "DEFAULT_CHILD_POLICY_UNDEFINED",
+          "OPERATION_NOT_PERMITTED",
+        };
 
         StartChildWorkflowExecutionFailedCause GetStartChildWorkflowExecutionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WORKFLOW_TYPE_DOES_NOT_EXIST_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == WORKFLOW_TYPE_DEPRECATED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED;
-          }
-          else if (hashCode == OPEN_CHILDREN_LIMIT_EXCEEDED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::OPEN_CHILDREN_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == OPEN_WORKFLOWS_LIMIT_EXCEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StartChildWorkflowExecutionFailedCause::OPEN_WORKFLOWS_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == CHILD_CREATION_RATE_EXCEEDED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::CHILD_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == WORKFLOW_ALREADY_RUNNING_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::WORKFLOW_ALREADY_RUNNING;
-          }
-          else if (hashCode == DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_LIST_UNDEFINED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_CHILD_POLICY_UNDEFINED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+          case -1957867734:
+            if (name == "WORKFLOW_TYPE_DOES_NOT_EXIST")
+            {
+              return StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST;
+            }
+            break;
+          case 412874584:
+            if (name == "WORKFLOW_TYPE_DEPRECATED")
+            {
+              return StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED;
+            }
+            break;
+          case 856262338:
+            if (name == "OPEN_CHILDREN_LIMIT_EXCEEDED")
+            {
+              return StartChildWorkflowExecutionFailedCause::OPEN_CHILDREN_LIMIT_EXCEEDED;
+            }
+            break;
+          case -13720841:
+            if (name == "OPEN_WORKFLOWS_LIMIT_EXCEEDED")
+            {
+              return StartChildWorkflowExecutionFailedCause::OPEN_WORKFLOWS_LIMIT_EXCEEDED;
+            }
+            break;
+          case 1315082517:
+            if (name == "CHILD_CREATION_RATE_EXCEEDED")
+            {
+              return StartChildWorkflowExecutionFailedCause::CHILD_CREATION_RATE_EXCEEDED;
+            }
+            break;
+          case 650218520:
+            if (name == "WORKFLOW_ALREADY_RUNNING")
+            {
+              return StartChildWorkflowExecutionFailedCause::WORKFLOW_ALREADY_RUNNING;
+            }
+            break;
+          case -1173928279:
+            if (name == "DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return StartChildWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case -123805269:
+            if (name == "DEFAULT_TASK_LIST_UNDEFINED")
+            {
+              return StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
+            }
+            break;
+          case -718320320:
+            if (name == "DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case -317730012:
+            if (name == "DEFAULT_CHILD_POLICY_UNDEFINED")
+            {
+              return StartChildWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED;
+            }
+            break;
+          case 1767122548:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return StartChildWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return StartChildWorkflowExecutionFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForStartChildWorkflowExecutionFailedCause(StartChildWorkflowExecutionFailedCause enumValue)
+        const char* GetNameForStartChildWorkflowExecutionFailedCauseCStr(StartChildWorkflowExecutionFailedCause enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST:
-            return "WORKFLOW_TYPE_DOES_NOT_EXIST";
-          case StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED:
-            return "WORKFLOW_TYPE_DEPRECATED";
-          case StartChildWorkflowExecutionFailedCause::OPEN_CHILDREN_LIMIT_EXCEEDED:
-            return "OPEN_CHILDREN_LIMIT_EXCEEDED";
-          case StartChildWorkflowExecutionFailedCause::OPEN_WORKFLOWS_LIMIT_EXCEEDED:
-            return "OPEN_WORKFLOWS_LIMIT_EXCEEDED";
-          case StartChildWorkflowExecutionFailedCause::CHILD_CREATION_RATE_EXCEEDED:
-            return "CHILD_CREATION_RATE_EXCEEDED";
-          case StartChildWorkflowExecutionFailedCause::WORKFLOW_ALREADY_RUNNING:
-            return "WORKFLOW_ALREADY_RUNNING";
-          case StartChildWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED:
-            return "DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED";
-          case StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED:
-            return "DEFAULT_TASK_LIST_UNDEFINED";
-          case StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED:
-            return "DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED";
-          case StartChildWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED:
-            return "DEFAULT_CHILD_POLICY_UNDEFINED";
-          case StartChildWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED:
-            return "OPERATION_NOT_PERMITTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStartChildWorkflowExecutionFailedCause(StartChildWorkflowExecutionFailedCause enumValue)
+        {
+          return GetNameForStartChildWorkflowExecutionFailedCauseCStr(enumValue);
         }
 
       } // namespace StartChildWorkflowExecutionFailedCauseMapper
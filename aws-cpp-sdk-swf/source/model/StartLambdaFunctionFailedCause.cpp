@@ -30,15 +30,30 @@ namespace Aws
       namespace StartLambdaFunctionFailedCauseMapper
       {
 
-        static const int ASSUME_ROLE_FAILED_HASH = HashingUtils::HashString("ASSUME_ROLE_FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ASSUME_ROLE_FAILED",
+        };
 
         StartLambdaFunctionFailedCause GetStartLambdaFunctionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASSUME_ROLE_FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StartLambdaFunctionFailedCause::ASSUME_ROLE_FAILED;
+          case 1354504979:
+            if (name == "ASSUME_ROLE_FAILED")
+            {
+              return StartLambdaFunctionFailedCause::ASSUME_ROLE_FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return StartLambdaFunctionFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForStartLambdaFunctionFailedCause(StartLambdaFunctionFailedCause enumValue)
+        const char* GetNameForStartLambdaFunctionFailedCauseCStr(StartLambdaFunctionFailedCause enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StartLambdaFunctionFailedCause::ASSUME_ROLE_FAILED:
-            return "ASSUME_ROLE_FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStartLambdaFunctionFailedCause(StartLambdaFunctionFailedCause enumValue)
+        {
+          return GetNameForStartLambdaFunctionFailedCauseCStr(enumValue);
         }
 
       } // namespace StartLambdaFunctionFailedCauseMapper
@@ -30,30 +30,51 @@ namespace Aws
       namespace StartTimerFailedCauseMapper
       {
 
-        static const int TIMER_ID_ALREADY_IN_USE_HASH = HashingUtils::HashString("TIMER_ID_ALREADY_IN_USE");
-        static const int OPEN_TIMERS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_TIMERS_LIMIT_EXCEEDED");
-        static const int TIMER_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("TIMER_CREATION_RATE_EXCEEDED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TIMER_ID_ALREADY_IN_USE",
+          "OPEN_TIMERS_LIMIT_EXCEEDED",
+          "TIMER_CREATION_RATE_EXCEEDED",
+          "OPERATION_NOT_PERMITTED",
+        };
 
         StartTimerFailedCause GetStartTimerFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TIMER_ID_ALREADY_IN_USE_HASH)
-          {
-            return StartTimerFailedCause::TIMER_ID_ALREADY_IN_USE;
-          }
-          else if (hashCode == OPEN_TIMERS_LIMIT_EXCEEDED_HASH)
-          {
-            return StartTimerFailedCause::OPEN_TIMERS_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == TIMER_CREATION_RATE_EXCEEDED_HASH)
-          {
-            return StartTimerFailedCause::TIMER_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StartTimerFailedCause::OPERATION_NOT_PERMITTED;
+          case 1823571518:
+            if (name == "TIMER_ID_ALREADY_IN_USE")
+            {
+              return StartTimerFailedCause::TIMER_ID_ALREADY_IN_USE;
+            }
+            break;
+          case 1439256019:
+            if (name == "OPEN_TIMERS_LIMIT_EXCEEDED")
+            {
+              return StartTimerFailedCause::OPEN_TIMERS_LIMIT_EXCEEDED;
+            }
+            break;
+          case -1212276532:
+            if (name == "TIMER_CREATION_RATE_EXCEEDED")
+            {
+              return StartTimerFailedCause::TIMER_CREATION_RATE_EXCEEDED;
+            }
+            break;
+          case 1767122548:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return StartTimerFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return StartTimerFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForStartTimerFailedCause(StartTimerFailedCause enumValue)
+        const char* GetNameForStartTimerFailedCauseCStr(StartTimerFailedCause enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StartTimerFailedCause::TIMER_ID_ALREADY_IN_USE:
-            return "TIMER_ID_ALREADY_IN_USE";
-          case StartTimerFailedCause::OPEN_TIMERS_LIMIT_EXCEEDED:
-            return "OPEN_TIMERS_LIMIT_EXCEEDED";
-          case StartTimerFailedCause::TIMER_CREATION_RATE_EXCEEDED:
-            return "TIMER_CREATION_RATE_EXCEEDED";
-          case StartTimerFailedCause::OPERATION_NOT_PERMITTED:
-            return "OPERATION_NOT_PERMITTED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStartTimerFailedCause(StartTimerFailedCause enumValue)
+        {
+          return GetNameForStartTimerFailedCauseCStr(enumValue);
         }
 
       } // namespace StartTimerFailedCauseMapper
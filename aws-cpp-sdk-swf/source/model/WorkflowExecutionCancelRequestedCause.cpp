@@ -30,15 +30,30 @@ namespace Aws
       namespace WorkflowExecutionCancelRequestedCauseMapper
       {
 
-        static const int CHILD_POLICY_APPLIED_HASH = HashingUtils::HashString("CHILD_POLICY_APPLIED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CHILD_POLICY_APPLIED",
+        };
 
         WorkflowExecutionCancelRequestedCause GetWorkflowExecutionCancelRequestedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHILD_POLICY_APPLIED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WorkflowExecutionCancelRequestedCause::CHILD_POLICY_APPLIED;
+          case -1421736973:
+            if (name == "CHILD_POLICY_APPLIED")
+            {
+              return WorkflowExecutionCancelRequestedCause::CHILD_POLICY_APPLIED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return WorkflowExecutionCancelRequestedCause::NOT_SET;
         }
 
-        Aws::String GetNameForWorkflowExecutionCancelRequestedCause(WorkflowExecutionCancelRequestedCause enumValue)
+        const char* GetNameForWorkflowExecutionCancelRequestedCauseCStr(WorkflowExecutionCancelRequestedCause enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WorkflowExecutionCancelRequestedCause::CHILD_POLICY_APPLIED:
-            return "CHILD_POLICY_APPLIED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWorkflowExecutionCancelRequestedCause(WorkflowExecutionCancelRequestedCause enumValue)
+        {
+          return GetNameForWorkflowExecutionCancelRequestedCauseCStr(enumValue);
         }
 
       } // namespace WorkflowExecutionCancelRequestedCauseMapper
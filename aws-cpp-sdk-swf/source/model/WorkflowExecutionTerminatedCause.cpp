@@ -30,25 +30,44 @@ namespace Aws
       namespace WorkflowExecutionTerminatedCauseMapper
       {
 
-        static const int CHILD_POLICY_APPLIED_HASH = HashingUtils::HashString("CHILD_POLICY_APPLIED");
-        static const int EVENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("EVENT_LIMIT_EXCEEDED");
-        static const int OPERATOR_INITIATED_HASH = HashingUtils::HashString("OPERATOR_INITIATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CHILD_POLICY_APPLIED",
+          "EVENT_LIMIT_EXCEEDED",
+          "OPERATOR_INITIATED",
+        };
 
         WorkflowExecutionTerminatedCause GetWorkflowExecutionTerminatedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHILD_POLICY_APPLIED_HASH)
-          {
-            return WorkflowExecutionTerminatedCause::CHILD_POLICY_APPLIED;
-          }
-          else if (hashCode == EVENT_LIMIT_EXCEEDED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WorkflowExecutionTerminatedCause::EVENT_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == OPERATOR_INITIATED_HASH)
-          {
-            return WorkflowExecutionTerminatedCause::OPERATOR_INITIATED;
+          case -1421736973:
+            if (name == "CHILD_POLICY_APPLIED")
+            {
+              return WorkflowExecutionTerminatedCause::CHILD_POLICY_APPLIED;
+            }
+            break;
+          case 447221724:
+            if (name == "EVENT_LIMIT_EXCEEDED")
+            {
+              return WorkflowExecutionTerminatedCause::EVENT_LIMIT_EXCEEDED;
+            }
+            break;
+          case 1586915056:
+            if (name == "OPERATOR_INITIATED")
+            {
+              return WorkflowExecutionTerminatedCause::OPERATOR_INITIATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return WorkflowExecutionTerminatedCause::NOT_SET;
         }
 
-        Aws::String GetNameForWorkflowExecutionTerminatedCause(WorkflowExecutionTerminatedCause enumValue)
+        const char* GetNameForWorkflowExecutionTerminatedCauseCStr(WorkflowExecutionTerminatedCause enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WorkflowExecutionTerminatedCause::CHILD_POLICY_APPLIED:
-            return "CHILD_POLICY_APPLIED";
-          case WorkflowExecutionTerminatedCause::EVENT_LIMIT_EXCEEDED:
-            return "EVENT_LIMIT_EXCEEDED";
-          case WorkflowExecutionTerminatedCause::OPERATOR_INITIATED:
-            return "OPERATOR_INITIATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWorkflowExecutionTerminatedCause(WorkflowExecutionTerminatedCause enumValue)
+        {
+          return GetNameForWorkflowExecutionTerminatedCauseCStr(enumValue);
         }
 
       } // namespace WorkflowExecutionTerminatedCauseMapper
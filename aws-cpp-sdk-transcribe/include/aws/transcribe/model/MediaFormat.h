@@ -37,6 +37,11 @@ namespace MediaFormatMapper
 AWS_TRANSCRIBESERVICE_API MediaFormat GetMediaFormatForName(const Aws::String& name);
 
 AWS_TRANSCRIBESERVICE_API Aws::String GetNameForMediaFormat(MediaFormat value);
+
+/**
+ * Same as GetNameForMediaFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_TRANSCRIBESERVICE_API const char* GetNameForMediaFormatCStr(MediaFormat value);
 } // namespace MediaFormatMapper
 } // namespace Model
 } // namespace TranscribeService
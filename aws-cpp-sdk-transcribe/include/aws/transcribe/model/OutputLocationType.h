@@ -35,6 +35,11 @@ namespace OutputLocationTypeMapper
 AWS_TRANSCRIBESERVICE_API OutputLocationType GetOutputLocationTypeForName(const Aws::String& name);
 
 AWS_TRANSCRIBESERVICE_API Aws::String GetNameForOutputLocationType(OutputLocationType value);
+
+/**
+ * Same as GetNameForOutputLocationType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_TRANSCRIBESERVICE_API const char* GetNameForOutputLocationTypeCStr(OutputLocationType value);
 } // namespace OutputLocationTypeMapper
 } // namespace Model
 } // namespace TranscribeService
@@ -36,6 +36,11 @@ namespace TranscriptionJobStatusMapper
 AWS_TRANSCRIBESERVICE_API TranscriptionJobStatus GetTranscriptionJobStatusForName(const Aws::String& name);
 
 AWS_TRANSCRIBESERVICE_API Aws::String GetNameForTranscriptionJobStatus(TranscriptionJobStatus value);
+
+/**
+ * Same as GetNameForTranscriptionJobStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_TRANSCRIBESERVICE_API const char* GetNameForTranscriptionJobStatusCStr(TranscriptionJobStatus value);
 } // namespace TranscriptionJobStatusMapper
 } // namespace Model
 } // namespace TranscribeService
@@ -36,6 +36,11 @@ namespace VocabularyStateMapper
 AWS_TRANSCRIBESERVICE_API VocabularyState GetVocabularyStateForName(const Aws::String& name);
 
 AWS_TRANSCRIBESERVICE_API Aws::String GetNameForVocabularyState(VocabularyState value);
+
+/**
+ * Same as GetNameForVocabularyState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_TRANSCRIBESERVICE_API const char* GetNameForVocabularyStateCStr(VocabularyState value);
 } // namespace VocabularyStateMapper
 } // namespace Model
 } // namespace TranscribeService
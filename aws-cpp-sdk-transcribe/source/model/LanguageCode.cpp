@@ -30,55 +30,86 @@ namespace Aws
       namespace LanguageCodeMapper
       {
 
-        static const int en_US_HASH = HashingUtils::HashString("en-US");
-        static const int es_US_HASH = HashingUtils::HashString("es-US");
-        static const int en_AU_HASH = HashingUtils::HashString("en-AU");
-        static const int fr_CA_HASH = HashingUtils::HashString("fr-CA");
-        static const int en_GB_HASH = HashingUtils::HashString("en-GB");
-        static const int de_DE_HASH = HashingUtils::HashString("de-DE");
-        static const int pt_BR_HASH = HashingUtils::HashString("pt-BR");
-        static const int fr_FR_HASH = HashingUtils::HashString("fr-FR");
-        static const int it_IT_HASH = HashingUtils::HashString("it-IT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "en-US",
+          "es-US",
+          "en-AU",
+          "fr-CA",
+          "en-GB",
+          "de-DE",
+          "pt-BR",
+          "fr-FR",
+          "it-IT",
+        };
 
         LanguageCode GetLanguageCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == en_US_HASH)
-          {
-            return LanguageCode::en_US;
-          }
-          else if (hashCode == es_US_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LanguageCode::es_US;
-          }
-          else if (hashCode == en_AU_HASH)
-          {
-            return LanguageCode::en_AU;
-          }
-          else if (hashCode == fr_CA_HASH)
-          {
-            return LanguageCode::fr_CA;
-          }
-          else if (hashCode == en_GB_HASH)
-          {
-            return LanguageCode::en_GB;
-          }
-          else if (hashCode == de_DE_HASH)
-          {
-            return LanguageCode::de_DE;
-          }
-          else if (hashCode == pt_BR_HASH)
-          {
-            return LanguageCode::pt_BR;
-          }
-          else if (hashCode == fr_FR_HASH)
-          {
-            return LanguageCode::fr_FR;
-          }
-          else if (hashCode == it_IT_HASH)
-          {
-            return LanguageCode::it_IT;
+          case 96598594:
+            if (name == "en-US")
+            {
+              return LanguageCode::en_US;
+            }
+            break;
+          case 96747549:
+            if (name == "es-US")
+            {
+              return LanguageCode::es_US;
+            }
+            break;
+          case 96597976:
+            if (name == "en-AU")
+            {
+              return LanguageCode::en_AU;
+            }
+            break;
+          case 97640703:
+            if (name == "fr-CA")
+            {
+              return LanguageCode::fr_CA;
+            }
+            break;
+          case 96598143:
+            if (name == "en-GB")
+            {
+              return LanguageCode::en_GB;
+            }
+            break;
+          case 95406413:
+            if (name == "de-DE")
+            {
+              return LanguageCode::de_DE;
+            }
+            break;
+          case 106935481:
+            if (name == "pt-BR")
+            {
+              return LanguageCode::pt_BR;
+            }
+            break;
+          case 97640813:
+            if (name == "fr-FR")
+            {
+              return LanguageCode::fr_FR;
+            }
+            break;
+          case 100471053:
+            if (name == "it-IT")
+            {
+              return LanguageCode::it_IT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,37 +121,26 @@ namespace Aws
           return LanguageCode::NOT_SET;
         }
 
-        Aws::String GetNameForLanguageCode(LanguageCode enumValue)
+        const char* GetNameForLanguageCodeCStr(LanguageCode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LanguageCode::en_US:
-            return "en-US";
-          case LanguageCode::es_US:
-            return "es-US";
-          case LanguageCode::en_AU:
-            return "en-AU";
-          case LanguageCode::fr_CA:
-            return "fr-CA";
-          case LanguageCode::en_GB:
-            return "en-GB";
-          case LanguageCode::de_DE:
-            return "de-DE";
-          case LanguageCode::pt_BR:
-            return "pt-BR";
-          case LanguageCode::fr_FR:
-            return "fr-FR";
-          case LanguageCode::it_IT:
-            return "it-IT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLanguageCode(LanguageCode enumValue)
+        {
+          return GetNameForLanguageCodeCStr(enumValue);
         }
 
       } // namespace LanguageCodeMapper
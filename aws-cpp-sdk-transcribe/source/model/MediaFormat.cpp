@@ -30,30 +30,51 @@ namespace Aws
       namespace MediaFormatMapper
       {
 
-        static const int mp3_HASH = HashingUtils::HashString("mp3");
-        static const int mp4_HASH = HashingUtils::HashString("mp4");
-        static const int wav_HASH = HashingUtils::HashString("wav");
-        static const int flac_HASH = HashingUtils::HashString("flac");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "mp3",
+          "mp4",
+          "wav",
+          "flac",
+        };
 
         MediaFormat GetMediaFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == mp3_HASH)
-          {
-            return MediaFormat::mp3;
-          }
-          else if (hashCode == mp4_HASH)
-          {
-            return MediaFormat::mp4;
-          }
-          else if (hashCode == wav_HASH)
-          {
-            return MediaFormat::wav;
-          }
-          else if (hashCode == flac_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MediaFormat::flac;
+          case 108272:
+            if (name == "mp3")
+            {
+              return MediaFormat::mp3;
+            }
+            break;
+          case 108273:
+            if (name == "mp4")
+            {
+              return MediaFormat::mp4;
+            }
+            break;
+          case 117484:
+            if (name == "wav")
+            {
+              return MediaFormat::wav;
+            }
+            break;
+          case 3145576:
+            if (name == "flac")
+            {
+              return MediaFormat::flac;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return MediaFormat::NOT_SET;
         }
 
-        Aws::String GetNameForMediaFormat(MediaFormat enumValue)
+        const char* GetNameForMediaFormatCStr(MediaFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MediaFormat::mp3:
-            return "mp3";
-          case MediaFormat::mp4:
-            return "mp4";
-          case MediaFormat::wav:
-            return "wav";
-          case MediaFormat::flac:
-            return "flac";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMediaFormat(MediaFormat enumValue)
+        {
+          return GetNameForMediaFormatCStr(enumValue);
         }
 
       } // namespace MediaFormatMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace OutputLocationTypeMapper
       {
 
-        static const int CUSTOMER_BUCKET_HASH = HashingUtils::HashString("CUSTOMER_BUCKET");
-        static const int SERVICE_BUCKET_HASH = HashingUtils::HashString("SERVICE_BUCKET");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CUSTOMER_BUCKET",
+          "SERVICE_BUCKET",
+        };
 
         OutputLocationType GetOutputLocationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CUSTOMER_BUCKET_HASH)
-          {
-            return OutputLocationType::CUSTOMER_BUCKET;
-          }
-          else if (hashCode == SERVICE_BUCKET_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OutputLocationType::SERVICE_BUCKET;
+          case 502257003:
+            if (name == "CUSTOMER_BUCKET")
+            {
+              return OutputLocationType::CUSTOMER_BUCKET;
+            }
+            break;
+          case -1923299628:
+            if (name == "SERVICE_BUCKET")
+            {
+              return OutputLocationType::SERVICE_BUCKET;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OutputLocationType::NOT_SET;
         }
 
-        Aws::String GetNameForOutputLocationType(OutputLocationType enumValue)
+        const char* GetNameForOutputLocationTypeCStr(OutputLocationType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OutputLocationType::CUSTOMER_BUCKET:
-            return "CUSTOMER_BUCKET";
-          case OutputLocationType::SERVICE_BUCKET:
-            return "SERVICE_BUCKET";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOutputLocationType(OutputLocationType enumValue)
+        {
+          return GetNameForOutputLocationTypeCStr(enumValue);
         }
 
       } // namespace OutputLocationTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace TranscriptionJobStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IN_PROGRESS",
+          "FAILED",
+          "COMPLETED",
+        };
 
         TranscriptionJobStatus GetTranscriptionJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
-          {
-            return TranscriptionJobStatus::IN_PROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TranscriptionJobStatus::FAILED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return TranscriptionJobStatus::COMPLETED;
+          case -604548089:
+            if (name == "IN_PROGRESS")
+            {
+              return TranscriptionJobStatus::IN_PROGRESS;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return TranscriptionJobStatus::FAILED;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return TranscriptionJobStatus::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return TranscriptionJobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTranscriptionJobStatus(TranscriptionJobStatus enumValue)
+        const char* GetNameForTranscriptionJobStatusCStr(TranscriptionJobStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TranscriptionJobStatus::IN_PROGRESS:
-            return "IN_PROGRESS";
-          case TranscriptionJobStatus::FAILED:
-            return "FAILED";
-          case TranscriptionJobStatus::COMPLETED:
-            return "COMPLETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTranscriptionJobStatus(TranscriptionJobStatus enumValue)
+        {
+          return GetNameForTranscriptionJobStatusCStr(enumValue);
         }
 
       } // namespace TranscriptionJobStatusMapper
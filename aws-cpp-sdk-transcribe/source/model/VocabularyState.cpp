@@ -30,25 +30,44 @@ namespace Aws
       namespace VocabularyStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "READY",
+          "FAILED",
+        };
 
         VocabularyState GetVocabularyStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return VocabularyState::PENDING;
-          }
-          else if (hashCode == READY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return VocabularyState::READY;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return VocabularyState::FAILED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return VocabularyState::PENDING;
+            }
+            break;
+          case 77848963:
+            if (name == "READY")
+            {
+              return VocabularyState::READY;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return VocabularyState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return VocabularyState::NOT_SET;
         }
 
-        Aws::String GetNameForVocabularyState(VocabularyState enumValue)
+        const char* GetNameForVocabularyStateCStr(VocabularyState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case VocabularyState::PENDING:
-            return "PENDING";
-          case VocabularyState::READY:
-            return "READY";
-          case VocabularyState::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForVocabularyState(VocabularyState enumValue)
+        {
+          return GetNameForVocabularyStateCStr(enumValue);
         }
 
       } // namespace VocabularyStateMapper
@@ -0,0 +1,153 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/transfer/TransferHandle.h>
+
+#include <chrono>
+#include <future>
+
+using namespace Aws::Transfer;
+
+namespace
+{
+    static const char* HANDLE_TEST_BUCKET = "handle-test-bucket";
+    static const char* HANDLE_TEST_KEY = "handle-test-key";
+    static const std::chrono::milliseconds PART_LATENCY(10);
+
+    /**
+     * Sends a round of parts through the window of the handle: acquires count slots, then releases them as parts of bytes each.
+     */
+    static void RunRound(TransferHandle& handle, size_t count, uint64_t bytes, std::chrono::milliseconds latency = PART_LATENCY)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            ASSERT_TRUE(handle.AcquirePartSlot());
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            handle.ReleasePartSlot(bytes, latency, true);
+        }
+    }
+}
+
+TEST(TransferHandleTest, TestConstructorsSetDirection)
+{
+    TransferHandle upload(HANDLE_TEST_BUCKET, HANDLE_TEST_KEY, 1024, "upload.bin");
+    ASSERT_EQ(TransferDirection::UPLOAD, upload.GetTransferDirection());
+    ASSERT_EQ(1024u, upload.GetBytesTotalSize());
+    ASSERT_EQ("upload.bin", upload.GetTargetFilePath());
+    ASSERT_EQ(TransferStatus::NOT_STARTED, upload.GetStatus());
+    ASSERT_EQ(0u, upload.GetConcurrencyWindow());
+
+    TransferHandle download(HANDLE_TEST_BUCKET, HANDLE_TEST_KEY, "download.bin");
+    ASSERT_EQ(TransferDirection::DOWNLOAD, download.GetTransferDirection());
+    ASSERT_EQ(0u, download.GetBytesTotalSize());
+    ASSERT_EQ("download.bin", download.GetTargetFilePath());
+
+    TransferHandle streamDownload(HANDLE_TEST_BUCKET, HANDLE_TEST_KEY, []() -> Aws::IOStream* { return nullptr; });
+    ASSERT_EQ(TransferDirection::DOWNLOAD, streamDownload.GetTransferDirection());
+    ASSERT_TRUE(streamDownload.GetTargetFilePath().empty());
+    ASSERT_NE(upload.GetId(), download.GetId());
+}
+
+TEST(TransferHandleTest, TestFixedWindowBlocksPartsBeyondIt)
+{
+    TransferHandle handle(HANDLE_TEST_BUCKET, HANDLE_TEST_KEY, 1024);
+    handle.EnableConcurrencyControl(3, 10, false);
+    ASSERT_EQ(3u, handle.GetConcurrencyWindow());
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(handle.AcquirePartSlot());
+    }
+    auto fourthPart = std::async(std::launch::async, [&handle] { return handle.AcquirePartSlot(); });
+    ASSERT_EQ(std::future_status::timeout, fourthPart.wait_for(std::chrono::milliseconds(100)));
+
+    handle.ReleasePartSlot(100, PART_LATENCY, true);
+    ASSERT_EQ(std::future_status::ready, fourthPart.wait_for(std::chrono::seconds(10)));
+    ASSERT_TRUE(fourthPart.get());
+
+    // not tuned, so neither completed nor failed parts move the window.
+    for (size_t i = 0; i < 3; ++i)
+    {
+        handle.ReleasePartSlot(100, PART_LATENCY, i != 0);
+    }
+    ASSERT_EQ(3u, handle.GetConcurrencyWindow());
+}
+
+TEST(TransferHandleTest, TestCancelReleasesPartsWaitingForTheWindow)
+{
+    TransferHandle handle(HANDLE_TEST_BUCKET, HANDLE_TEST_KEY, 1024);
+    handle.EnableConcurrencyControl(1, 1, false);
+    ASSERT_TRUE(handle.AcquirePartSlot());
+
+    auto waitingPart = std::async(std::launch::async, [&handle] { return handle.AcquirePartSlot(); });
+    ASSERT_EQ(std::future_status::timeout, waitingPart.wait_for(std::chrono::milliseconds(100)));
+
+    handle.Cancel();
+    ASSERT_EQ(std::future_status::ready, waitingPart.wait_for(std::chrono::seconds(10)));
+    ASSERT_FALSE(waitingPart.get());
+}
+
+TEST(TransferHandleTest, TestTunedWindowFollowsThroughputAndLatency)
+{
+    TransferHandle handle(HANDLE_TEST_BUCKET, HANDLE_TEST_KEY, 1024 * 1024 * 1024);
+    handle.EnableConcurrencyControl(2, 16);
+    ASSERT_EQ(2u, handle.GetConcurrencyWindow());
+
+    // Slow start: the first round always doubles the window, later ones while throughput grows. Byte counts differ by orders of
+    // magnitude between rounds so that how long a round takes can't change the outcome.
+    RunRound(handle, 2, 1000);
+    ASSERT_EQ(4u, handle.GetConcurrencyWindow());
+    ASSERT_LT(0u, handle.GetThroughput());
+    RunRound(handle, 4, 1000000);
+    ASSERT_EQ(8u, handle.GetConcurrencyWindow());
+
+    // Throughput stopped growing: slow start ends with the window where it is.
+    RunRound(handle, 8, 1);
+    ASSERT_EQ(8u, handle.GetConcurrencyWindow());
+
+    // Latency within twice the lowest seen: one more part per round.
+    RunRound(handle, 8, 1);
+    ASSERT_EQ(9u, handle.GetConcurrencyWindow());
+
+    // Latency up tenfold without any throughput to show for it: back off by a quarter.
+    RunRound(handle, 9, 0, PART_LATENCY * 10);
+    ASSERT_EQ(7u, handle.GetConcurrencyWindow());
+
+    // A failed part halves the window.
+    ASSERT_TRUE(handle.AcquirePartSlot());
+    handle.ReleasePartSlot(0, PART_LATENCY, false);
+    ASSERT_EQ(3u, handle.GetConcurrencyWindow());
+}
+
+TEST(TransferHandleTest, TestTunedWindowStaysWithinMaximum)
+{
+    TransferHandle handle(HANDLE_TEST_BUCKET, HANDLE_TEST_KEY, 1024 * 1024);
+    handle.EnableConcurrencyControl(8, 3);
+    ASSERT_EQ(3u, handle.GetConcurrencyWindow());
+
+    RunRound(handle, 3, 1000);
+    RunRound(handle, 3, 1000000);
+    ASSERT_EQ(3u, handle.GetConcurrencyWindow());
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(handle.AcquirePartSlot());
+        handle.ReleasePartSlot(0, PART_LATENCY, false);
+    }
+    ASSERT_EQ(1u, handle.GetConcurrencyWindow());
+}
@@ -0,0 +1,654 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/s3/S3Client.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/HeadObjectRequest.h>
+#include <aws/s3/model/ListObjectsV2Request.h>
+#include <aws/s3/model/PutObjectRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/transfer/TransferManager.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif
+
+using namespace Aws::S3;
+using namespace Aws::S3::Model;
+using namespace Aws::Transfer;
+using namespace Aws::Utils;
+
+namespace
+{
+    static const char* ALLOCATION_TAG = "TransferManagerPartsTest";
+    static const char* PARTS_TEST_BUCKET = "parts-test-bucket";
+    static const char* PARTS_TEST_KEY = "parts-test-key";
+    static const char* PARTS_TEST_FILE = "TransferManagerPartsTestFile.bin";
+    static const char* PARTS_TEST_DOWNLOAD_FILE = "TransferManagerPartsTestDownload.bin";
+    static const char* PARTS_TEST_DOWNLOAD_STATE_FILE = "TransferManagerPartsTestDownload.bin.s3download";
+    static const char* PARTS_TEST_DIRECTORY = "TransferManagerPartsTestDirectory";
+    static const uint64_t TEST_PART_SIZE = 64 * 1024;
+
+    /**
+     * S3 stand-in keeping objects in memory. Part uploads and ranged gets complete asynchronously after partDelay, and the most
+     * of them in flight at once is recorded from the moment they are requested.
+     */
+    class InMemoryS3Client : public S3Client
+    {
+    public:
+        InMemoryS3Client(Threading::Executor* executor) :
+            S3Client(Aws::Auth::AWSCredentials("akid", "secret")),
+            partDelay(std::chrono::milliseconds(0)), m_executor(executor),
+            m_nextUploadId(0), m_requestsInFlight(0), m_maxRequestsInFlight(0), m_rangedGets(0), m_conditionalGets(0),
+            m_verifiedParts(0), m_corruptParts(0), m_outstandingRequests(0), m_failRangesFrom((std::numeric_limits<uint64_t>::max)())
+        {
+        }
+
+        void PutTestObject(const Aws::String& key, const Aws::String& body)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_objects[key] = body;
+        }
+
+        Aws::String GetTestObject(const Aws::String& key) const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            auto object = m_objects.find(key);
+            return object == m_objects.end() ? "" : object->second;
+        }
+
+        size_t GetMaxRequestsInFlight() const { return m_maxRequestsInFlight.load(); }
+        size_t GetRangedGets() const { return m_rangedGets.load(); }
+        size_t GetConditionalGets() const { return m_conditionalGets.load(); }
+        size_t GetVerifiedParts() const { return m_verifiedParts.load(); }
+        size_t GetCorruptParts() const { return m_corruptParts.load(); }
+        void ResetCounters() { m_maxRequestsInFlight = 0; m_rangedGets = 0; m_conditionalGets = 0; }
+
+        /**
+         * Makes ranged gets starting at offset or later fail, as if the connection went away from there on.
+         */
+        void FailRangesFrom(uint64_t offset) { m_failRangesFrom = offset; }
+        void StopFailingRanges() { m_failRangesFrom = (std::numeric_limits<uint64_t>::max)(); }
+
+        /**
+         * Waits until the handlers of all requests made so far have returned. A failed transfer can finish while parts are still in flight.
+         */
+        void WaitForOutstandingRequests() const
+        {
+            while (m_outstandingRequests.load() > 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        CreateMultipartUploadOutcome CreateMultipartUpload(const CreateMultipartUploadRequest&) const override
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            auto uploadId = "upload-" + StringUtils::to_string(m_nextUploadId++);
+            m_uploads[uploadId];
+            return CreateMultipartUploadOutcome(CreateMultipartUploadResult().WithUploadId(uploadId));
+        }
+
+        void UploadPartAsync(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler,
+                             const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+        {
+            OnRequestStarted();
+            m_executor->Submit([this, request, handler, context]
+            {
+                std::this_thread::sleep_for(partDelay);
+                Aws::StringStream body;
+                body << request.GetBody()->rdbuf();
+                if (!request.GetContentMD5().empty())
+                {
+                    // what S3 does with Content-MD5.
+                    if (HashingUtils::Base64Encode(HashingUtils::CalculateMD5(body.str())) == request.GetContentMD5())
+                    {
+                        ++m_verifiedParts;
+                    }
+                    else
+                    {
+                        ++m_corruptParts;
+                    }
+                }
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    m_uploads[request.GetUploadId()][request.GetPartNumber()] = body.str();
+                }
+                if (request.GetDataSentEventHandler())
+                {
+                    request.GetDataSentEventHandler()(nullptr, static_cast<long long>(body.str().size()));
+                }
+                OnRequestFinished();
+                handler(this, request, UploadPartOutcome(UploadPartResult().WithETag("etag-" + StringUtils::to_string(request.GetPartNumber()))), context);
+                --m_outstandingRequests;
+            });
+        }
+
+        CompleteMultipartUploadOutcome CompleteMultipartUpload(const CompleteMultipartUploadRequest& request) const override
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            Aws::String body;
+            for (const auto& part : m_uploads[request.GetUploadId()])
+            {
+                body += part.second;
+            }
+            m_objects[request.GetKey()] = body;
+            m_uploads.erase(request.GetUploadId());
+            return CompleteMultipartUploadOutcome(CompleteMultipartUploadResult());
+        }
+
+        AbortMultipartUploadOutcome AbortMultipartUpload(const AbortMultipartUploadRequest& request) const override
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_uploads.erase(request.GetUploadId());
+            return AbortMultipartUploadOutcome(AbortMultipartUploadResult());
+        }
+
+        void PutObjectAsync(const PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler,
+                            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+        {
+            m_executor->Submit([this, request, handler, context]
+            {
+                Aws::StringStream body;
+                body << request.GetBody()->rdbuf();
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    m_objects[request.GetKey()] = body.str();
+                }
+                if (request.GetDataSentEventHandler())
+                {
+                    request.GetDataSentEventHandler()(nullptr, static_cast<long long>(body.str().size()));
+                }
+                handler(this, request, PutObjectOutcome(PutObjectResult()), context);
+            });
+        }
+
+        HeadObjectOutcome HeadObject(const HeadObjectRequest& request) const override
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            auto object = m_objects.find(request.GetKey());
+            if (object == m_objects.end())
+            {
+                return HeadObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::NO_SUCH_KEY, "NoSuchKey", "No such key", false));
+            }
+            HeadObjectResult result;
+            result.SetContentLength(static_cast<long long>(object->second.size()));
+            result.SetETag("\"object-etag\"");
+            return HeadObjectOutcome(std::move(result));
+        }
+
+        /**
+         * Lists at most two keys per page, recording the prefix and delimiter of every request.
+         */
+        ListObjectsV2Outcome ListObjectsV2(const ListObjectsV2Request& request) const override
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_listings.push_back(request.GetPrefix() + "|" + request.GetDelimiter());
+            ListObjectsV2Result result;
+            auto object = request.GetContinuationToken().empty() ? m_objects.lower_bound(request.GetPrefix()) : m_objects.upper_bound(request.GetContinuationToken());
+            for (; object != m_objects.end() && object->first.compare(0, request.GetPrefix().size(), request.GetPrefix()) == 0; ++object)
+            {
+                if (!request.GetDelimiter().empty() && object->first.find(request.GetDelimiter(), request.GetPrefix().size()) != Aws::String::npos)
+                {
+                    continue;
+                }
+                if (result.GetContents().size() == 2)
+                {
+                    result.SetIsTruncated(true);
+                    result.SetNextContinuationToken(result.GetContents().back().GetKey());
+                    break;
+                }
+                result.AddContents(Object().WithKey(object->first).WithSize(static_cast<long long>(object->second.size())).WithLastModified(DateTime::Now()));
+            }
+            return ListObjectsV2Outcome(std::move(result));
+        }
+
+        Aws::Vector<Aws::String> GetListings() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_listings;
+        }
+
+        GetObjectOutcome GetObject(const GetObjectRequest& request) const override
+        {
+            Aws::String body = GetTestObject(request.GetKey());
+            if (!request.GetRange().empty())
+            {
+                ++m_rangedGets;
+                if (request.GetIfMatch() == "\"object-etag\"")
+                {
+                    ++m_conditionalGets;
+                }
+                auto range = StringUtils::Split(request.GetRange().substr(strlen("bytes=")), '-');
+                uint64_t first = StringUtils::ConvertToInt64(range[0].c_str());
+                uint64_t last = StringUtils::ConvertToInt64(range[1].c_str());
+                if (first >= m_failRangesFrom.load())
+                {
+                    return GetObjectOutcome(Aws::Client::AWSError<S3Errors>(S3Errors::INTERNAL_FAILURE, "InternalError", "Connection reset", false));
+                }
+                body = body.substr(static_cast<size_t>(first), static_cast<size_t>(last - first + 1));
+            }
+
+            Stream::ResponseStream responseStream(request.GetResponseStreamFactory());
+            responseStream.GetUnderlyingStream().write(body.c_str(), body.size());
+            responseStream.GetUnderlyingStream().flush();
+            if (request.GetDataReceivedEventHandler())
+            {
+                request.GetDataReceivedEventHandler()(nullptr, nullptr, static_cast<long long>(body.size()));
+            }
+            Aws::Http::HeaderValueCollection headers;
+            headers["etag"] = "\"object-etag\"";
+            Aws::AmazonWebServiceResult<Stream::ResponseStream> result(std::move(responseStream), std::move(headers));
+            return GetObjectOutcome(GetObjectResult(std::move(result)));
+        }
+
+        void GetObjectAsync(const GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler,
+                            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+        {
+            OnRequestStarted();
+            m_executor->Submit([this, request, handler, context]
+            {
+                std::this_thread::sleep_for(partDelay);
+                auto outcome = GetObject(request);
+                OnRequestFinished();
+                handler(this, request, outcome, context);
+                --m_outstandingRequests;
+            });
+        }
+
+        std::chrono::milliseconds partDelay;
+
+    private:
+        void OnRequestStarted() const
+        {
+            ++m_outstandingRequests;
+            size_t inFlight = ++m_requestsInFlight;
+            size_t maxInFlight = m_maxRequestsInFlight.load();
+            while (inFlight > maxInFlight && !m_maxRequestsInFlight.compare_exchange_weak(maxInFlight, inFlight)) {}
+        }
+
+        void OnRequestFinished() const
+        {
+            --m_requestsInFlight;
+        }
+
+        // not owned: the last reference to the client can go away on one of the executor's threads.
+        Threading::Executor* m_executor;
+        mutable std::mutex m_lock;
+        mutable Aws::Map<Aws::String, Aws::String> m_objects;
+        mutable Aws::Map<Aws::String, Aws::Map<int, Aws::String>> m_uploads;
+        mutable Aws::Vector<Aws::String> m_listings;
+        mutable size_t m_nextUploadId;
+        mutable std::atomic<size_t> m_requestsInFlight;
+        mutable std::atomic<size_t> m_maxRequestsInFlight;
+        mutable std::atomic<size_t> m_rangedGets;
+        mutable std::atomic<size_t> m_conditionalGets;
+        mutable std::atomic<size_t> m_verifiedParts;
+        mutable std::atomic<size_t> m_corruptParts;
+        mutable std::atomic<size_t> m_outstandingRequests;
+        std::atomic<uint64_t> m_failRangesFrom;
+    };
+
+    /**
+     * Runs tasks on a pool of its own, counting how many it was given.
+     */
+    class CountingExecutor : public Threading::Executor
+    {
+    public:
+        CountingExecutor(size_t poolSize) : m_pool(poolSize), m_submitted(0) {}
+
+        size_t GetSubmittedTasks() const { return m_submitted.load(); }
+
+    protected:
+        bool SubmitToThread(std::function<void()>&& fn) override
+        {
+            ++m_submitted;
+            return m_pool.Submit(std::move(fn));
+        }
+
+    private:
+        Threading::PooledThreadExecutor m_pool;
+        std::atomic<size_t> m_submitted;
+    };
+
+    static Aws::String MakeTestContent(size_t size)
+    {
+        Aws::String content(size, '\0');
+        for (size_t i = 0; i < size; ++i)
+        {
+            content[i] = static_cast<char>('a' + (i * 7 + i / 4096) % 26);
+        }
+        return content;
+    }
+
+    static void WriteTestFile(const char* fileName, const Aws::String& content)
+    {
+        Aws::OFStream file(fileName, std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+        file.write(content.c_str(), content.size());
+    }
+
+    static Aws::String ReadTestFile(const char* fileName)
+    {
+        Aws::IFStream file(fileName, std::ios_base::in | std::ios_base::binary);
+        Aws::StringStream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    class TransferManagerPartsTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_clientExecutor = Aws::MakeShared<Threading::PooledThreadExecutor>(ALLOCATION_TAG, 8);
+            m_s3Client = Aws::MakeShared<InMemoryS3Client>(ALLOCATION_TAG, m_clientExecutor.get());
+            m_transferExecutor = Aws::MakeShared<Threading::PooledThreadExecutor>(ALLOCATION_TAG, 4);
+            m_configuration = Aws::MakeUnique<TransferManagerConfiguration>(ALLOCATION_TAG, m_transferExecutor.get());
+            m_configuration->s3Client = m_s3Client;
+            m_configuration->bufferSize = TEST_PART_SIZE;
+            m_configuration->transferBufferMaxHeapSize = TEST_PART_SIZE * 16;
+        }
+
+        void TearDown() override
+        {
+            // a failed transfer can finish while its parts are still in flight, they must be done before anything goes away.
+            m_clientExecutor = nullptr;
+            m_transferManager = nullptr;
+            m_transferExecutor = nullptr;
+            m_configuration = nullptr;
+            m_s3Client = nullptr;
+            Aws::FileSystem::RemoveFileIfExists(PARTS_TEST_FILE);
+            Aws::FileSystem::RemoveFileIfExists(PARTS_TEST_DOWNLOAD_FILE);
+            Aws::FileSystem::RemoveFileIfExists(PARTS_TEST_DOWNLOAD_STATE_FILE);
+        }
+
+        std::shared_ptr<TransferManager> CreateTransferManager()
+        {
+            m_transferManager = TransferManager::Create(*m_configuration);
+            return m_transferManager;
+        }
+
+        std::shared_ptr<TransferHandle> UploadTestFile()
+        {
+            auto handle = m_transferManager->UploadFile(PARTS_TEST_FILE, PARTS_TEST_BUCKET, PARTS_TEST_KEY, "binary/octet-stream",
+                                                        Aws::Map<Aws::String, Aws::String>());
+            handle->WaitUntilFinished();
+            return handle;
+        }
+
+        std::shared_ptr<TransferHandle> DownloadTestObject()
+        {
+            auto handle = m_transferManager->DownloadFile(PARTS_TEST_BUCKET, PARTS_TEST_KEY, PARTS_TEST_DOWNLOAD_FILE);
+            handle->WaitUntilFinished();
+            return handle;
+        }
+
+        std::shared_ptr<Threading::PooledThreadExecutor> m_clientExecutor;
+        std::shared_ptr<InMemoryS3Client> m_s3Client;
+        std::shared_ptr<Threading::PooledThreadExecutor> m_transferExecutor;
+        Aws::UniquePtr<TransferManagerConfiguration> m_configuration;
+        std::shared_ptr<TransferManager> m_transferManager;
+    };
+}
+
+TEST_F(TransferManagerPartsTest, TestMappedUploadKeepsPartsInFlightWithinLimit)
+{
+    auto content = MakeTestContent(static_cast<size_t>(TEST_PART_SIZE * 12 + 100));
+    WriteTestFile(PARTS_TEST_FILE, content);
+    m_configuration->useMemoryMappedFiles = true;
+    m_configuration->maxPartsInFlight = 3;
+    m_s3Client->partDelay = std::chrono::milliseconds(20);
+    CreateTransferManager();
+
+    auto handle = UploadTestFile();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_EQ(13u, handle->GetCompletedParts().size());
+    ASSERT_EQ(content, m_s3Client->GetTestObject(PARTS_TEST_KEY));
+    ASSERT_GE(3u, m_s3Client->GetMaxRequestsInFlight());
+}
+
+TEST_F(TransferManagerPartsTest, TestParallelPartReadUploadSendsEveryPart)
+{
+    auto content = MakeTestContent(static_cast<size_t>(TEST_PART_SIZE * 12 + 100));
+    WriteTestFile(PARTS_TEST_FILE, content);
+    CountingExecutor partReadExecutor(4);
+    m_configuration->partReadExecutor = &partReadExecutor;
+    m_configuration->partReadQueueDepth = 2;
+    // parts are read into transfer buffers, so those bound the parts in flight.
+    m_configuration->transferBufferMaxHeapSize = TEST_PART_SIZE * 3;
+    m_s3Client->partDelay = std::chrono::milliseconds(20);
+    CreateTransferManager();
+
+    auto handle = UploadTestFile();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_EQ(13u, handle->GetCompletedParts().size());
+    ASSERT_EQ(13u, partReadExecutor.GetSubmittedTasks());
+    ASSERT_EQ(content, m_s3Client->GetTestObject(PARTS_TEST_KEY));
+    ASSERT_GE(3u, m_s3Client->GetMaxRequestsInFlight());
+    ASSERT_EQ(0u, m_s3Client->GetVerifiedParts() + m_s3Client->GetCorruptParts());
+}
+
+TEST_F(TransferManagerPartsTest, TestContentMD5IsSentForEveryPart)
+{
+    auto content = MakeTestContent(static_cast<size_t>(TEST_PART_SIZE * 12 + 100));
+    WriteTestFile(PARTS_TEST_FILE, content);
+    m_configuration->computeContentMD5 = true;
+    CreateTransferManager();
+
+    auto handle = UploadTestFile();
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_EQ(13u, m_s3Client->GetVerifiedParts());
+
+    // hashed on the part read executor as well.
+    CountingExecutor partReadExecutor(4);
+    m_configuration->partReadExecutor = &partReadExecutor;
+    CreateTransferManager();
+
+    handle = UploadTestFile();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_EQ(13u, partReadExecutor.GetSubmittedTasks());
+    ASSERT_EQ(26u, m_s3Client->GetVerifiedParts());
+    ASSERT_EQ(0u, m_s3Client->GetCorruptParts());
+    ASSERT_EQ(content, m_s3Client->GetTestObject(PARTS_TEST_KEY));
+}
+
+TEST_F(TransferManagerPartsTest, TestMappedDownloadKeepsPartsInFlightWithinLimit)
+{
+    auto content = MakeTestContent(static_cast<size_t>(TEST_PART_SIZE * 12 + 100));
+    m_s3Client->PutTestObject(PARTS_TEST_KEY, content);
+    m_configuration->useMemoryMappedFiles = true;
+    m_configuration->maxPartsInFlight = 3;
+    m_s3Client->partDelay = std::chrono::milliseconds(20);
+    CreateTransferManager();
+
+    auto handle = DownloadTestObject();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_EQ(13u, m_s3Client->GetRangedGets());
+    ASSERT_EQ(content, ReadTestFile(PARTS_TEST_DOWNLOAD_FILE));
+    ASSERT_GE(3u, m_s3Client->GetMaxRequestsInFlight());
+}
+
+#if !defined(_WIN32)
+TEST_F(TransferManagerPartsTest, TestParallelFileDownloadWritesPartsInPlace)
+{
+    auto content = MakeTestContent(static_cast<size_t>(TEST_PART_SIZE * 12 + 100));
+    m_s3Client->PutTestObject(PARTS_TEST_KEY, content);
+    m_configuration->enableParallelFileDownloads = true;
+    m_configuration->maxPartsInFlight = 3;
+    m_s3Client->partDelay = std::chrono::milliseconds(20);
+    CreateTransferManager();
+
+    auto handle = DownloadTestObject();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_EQ(13u, m_s3Client->GetRangedGets());
+    ASSERT_EQ(13u, m_s3Client->GetConditionalGets());
+    ASSERT_EQ(content, ReadTestFile(PARTS_TEST_DOWNLOAD_FILE));
+    ASSERT_GE(3u, m_s3Client->GetMaxRequestsInFlight());
+    ASSERT_FALSE(Aws::IFStream(PARTS_TEST_DOWNLOAD_STATE_FILE).good());
+}
+
+TEST_F(TransferManagerPartsTest, TestParallelFileDownloadResumesFromDownloadState)
+{
+    auto content = MakeTestContent(static_cast<size_t>(TEST_PART_SIZE * 12 + 100));
+    m_s3Client->PutTestObject(PARTS_TEST_KEY, content);
+    m_configuration->enableParallelFileDownloads = true;
+    m_configuration->maxPartsInFlight = 3;
+    CreateTransferManager();
+
+    // parts 9 to 13 fail, the 8 before them are written and recorded when the download fails.
+    m_s3Client->FailRangesFrom(TEST_PART_SIZE * 8);
+    auto failedHandle = DownloadTestObject();
+    ASSERT_EQ(TransferStatus::FAILED, failedHandle->GetStatus());
+    m_s3Client->WaitForOutstandingRequests();
+    ASSERT_TRUE(Aws::IFStream(PARTS_TEST_DOWNLOAD_STATE_FILE).good());
+
+    m_s3Client->StopFailingRanges();
+    m_s3Client->ResetCounters();
+    auto handle = DownloadTestObject();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_EQ(5u, m_s3Client->GetRangedGets());
+    ASSERT_EQ(content.size(), handle->GetBytesTransferred());
+    ASSERT_EQ(content, ReadTestFile(PARTS_TEST_DOWNLOAD_FILE));
+    ASSERT_FALSE(Aws::IFStream(PARTS_TEST_DOWNLOAD_STATE_FILE).good());
+}
+
+TEST_F(TransferManagerPartsTest, TestParallelFileDownloadStartsOverWhenTargetFileChanged)
+{
+    auto content = MakeTestContent(static_cast<size_t>(TEST_PART_SIZE * 12 + 100));
+    m_s3Client->PutTestObject(PARTS_TEST_KEY, content);
+    m_configuration->enableParallelFileDownloads = true;
+    m_configuration->maxPartsInFlight = 3;
+    CreateTransferManager();
+
+    // the first 8 parts are recorded as done, for a target file that is then deleted and for one that is then truncated.
+    for (bool deleteTarget : { true, false })
+    {
+        m_s3Client->FailRangesFrom(TEST_PART_SIZE * 8);
+        ASSERT_EQ(TransferStatus::FAILED, DownloadTestObject()->GetStatus());
+        m_s3Client->WaitForOutstandingRequests();
+        if (deleteTarget)
+        {
+            ASSERT_TRUE(Aws::FileSystem::RemoveFileIfExists(PARTS_TEST_DOWNLOAD_FILE));
+        }
+        else
+        {
+            ASSERT_EQ(0, truncate(PARTS_TEST_DOWNLOAD_FILE, static_cast<off_t>(TEST_PART_SIZE)));
+        }
+
+        m_s3Client->StopFailingRanges();
+        m_s3Client->ResetCounters();
+        auto handle = DownloadTestObject();
+
+        ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+        ASSERT_EQ(13u, m_s3Client->GetRangedGets());
+        ASSERT_EQ(content, ReadTestFile(PARTS_TEST_DOWNLOAD_FILE));
+        ASSERT_FALSE(Aws::IFStream(PARTS_TEST_DOWNLOAD_STATE_FILE).good());
+    }
+}
+#endif
+
+#if defined(__linux__)
+TEST_F(TransferManagerPartsTest, TestMappedDownloadReceivesPartsThatCannotBeMappedIntoBuffers)
+{
+    // Parts larger than what is left of the address space can't be mapped, while smaller allocations still succeed.
+    static const uint64_t largePartSize = 8 * 1024 * 1024;
+    auto content = MakeTestContent(static_cast<size_t>(largePartSize * 3 + 100));
+    m_s3Client->PutTestObject(PARTS_TEST_KEY, content);
+    m_configuration->useMemoryMappedFiles = true;
+    m_configuration->bufferSize = largePartSize;
+    m_configuration->transferBufferMaxHeapSize = largePartSize * 4;
+    CreateTransferManager();
+    // creates the thread arenas and the target file outside of the limit.
+    ASSERT_EQ(TransferStatus::COMPLETED, DownloadTestObject()->GetStatus());
+    Aws::FileSystem::RemoveFileIfExists(PARTS_TEST_DOWNLOAD_FILE);
+    m_s3Client->ResetCounters();
+
+    uint64_t addressSpaceSize = 0;
+    Aws::IFStream status("/proc/self/statm");
+    status >> addressSpaceSize;
+    addressSpaceSize *= static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    struct rlimit originalLimit;
+    ASSERT_EQ(0, getrlimit(RLIMIT_AS, &originalLimit));
+    struct rlimit limit = originalLimit;
+    limit.rlim_cur = static_cast<rlim_t>(addressSpaceSize + largePartSize / 2);
+    ASSERT_EQ(0, setrlimit(RLIMIT_AS, &limit));
+
+    auto handle = DownloadTestObject();
+
+    ASSERT_EQ(0, setrlimit(RLIMIT_AS, &originalLimit));
+    ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    ASSERT_EQ(4u, m_s3Client->GetRangedGets());
+    ASSERT_EQ(content, ReadTestFile(PARTS_TEST_DOWNLOAD_FILE));
+}
+#endif
+
+TEST_F(TransferManagerPartsTest, TestDirectoryUploadListsEachDirectoryLevelAsItIsWalked)
+{
+    auto subDirectory = Aws::FileSystem::Join(PARTS_TEST_DIRECTORY, "sub");
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(subDirectory.c_str(), true));
+    WriteTestFile(Aws::FileSystem::Join(PARTS_TEST_DIRECTORY, "a.txt").c_str(), "unchanged");
+    WriteTestFile(Aws::FileSystem::Join(PARTS_TEST_DIRECTORY, "b.txt").c_str(), "new");
+    WriteTestFile(Aws::FileSystem::Join(subDirectory, "c.txt").c_str(), "unchanged");
+    WriteTestFile(Aws::FileSystem::Join(subDirectory, "d.txt").c_str(), "changed");
+    m_s3Client->PutTestObject("sync/a.txt", "unchanged");
+    m_s3Client->PutTestObject("sync/sub/c.txt", "unchanged");
+    m_s3Client->PutTestObject("sync/sub/d.txt", "old");
+    m_s3Client->PutTestObject("sync/sub/e.txt", "gone locally");
+    m_configuration->maxFilesInFlight = 1;
+    m_configuration->unchangedFileCheck = UnchangedFileCheck::SIZE_AND_MODIFIED_TIME;
+    m_configuration->transferInitiatedCallback = [](const TransferManager*, const std::shared_ptr<const TransferHandle>&) {};
+    CreateTransferManager();
+
+    auto directoryUpload = m_transferManager->UploadDirectory(PARTS_TEST_DIRECTORY, PARTS_TEST_BUCKET, "sync", Aws::Map<Aws::String, Aws::String>());
+    directoryUpload->WaitUntilFinished();
+    Aws::FileSystem::DeepDeleteDirectory(PARTS_TEST_DIRECTORY);
+
+    ASSERT_FALSE(directoryUpload->HasTraversalFailed());
+    ASSERT_EQ(2u, directoryUpload->GetFilesStarted());
+    ASSERT_EQ(2u, directoryUpload->GetFilesCompleted());
+    ASSERT_EQ(2u, directoryUpload->GetFilesSkipped());
+    ASSERT_EQ("new", m_s3Client->GetTestObject("sync/b.txt"));
+    ASSERT_EQ("changed", m_s3Client->GetTestObject("sync/sub/d.txt"));
+    // one page for the top level, two for the three objects directly under sub, and no listing of the whole prefix.
+    auto listings = m_s3Client->GetListings();
+    ASSERT_EQ(3u, listings.size());
+    ASSERT_EQ(1, std::count(listings.begin(), listings.end(), "sync/|/"));
+    ASSERT_EQ(2, std::count(listings.begin(), listings.end(), "sync/sub/|/"));
+}
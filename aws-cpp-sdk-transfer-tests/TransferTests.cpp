@@ -907,6 +907,68 @@ TEST_F(TransferTests, TransferManager_DirectoryUploadAndDownloadTest)
     ASSERT_EQ(1u, m_s3Client->listObjectsV2RequestCount);
 }
 
+TEST_F(TransferTests, TransferManager_DirectoryUploadSkipsUnchangedFilesTest)
+{
+    auto uploadDir = Aws::FileSystem::Join(GetTestFilesDirectory(), "dirSyncUpload");
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(uploadDir.c_str()));
+    auto smallTestFileName = Aws::FileSystem::Join(uploadDir, SMALL_TEST_FILE_NAME);
+    auto contentTestFileName = Aws::FileSystem::Join(uploadDir, CONTENT_TEST_FILE_NAME);
+    auto emptyTestFileName = Aws::FileSystem::Join(uploadDir, EMPTY_TEST_FILE_NAME);
+
+    ScopedTestFile smallFile(smallTestFileName, SMALL_TEST_SIZE, testString);
+    ScopedTestFile contentFile(contentTestFileName, CONTENT_TEST_FILE_TEXT);
+    ScopedTestFile emptyFile(emptyTestFileName, 0, testString);
+
+    if (EmptyBucket(GetTestBucketName()))
+    {
+        WaitForBucketToEmpty(GetTestBucketName());
+    }
+
+    Aws::Vector<std::shared_ptr<const TransferHandle>> initiatedHandles;
+    std::mutex semaphoreLock;
+
+    TransferManagerConfiguration transferManagerConfig(m_executor.get());
+    transferManagerConfig.s3Client = m_s3Client;
+    transferManagerConfig.maxFilesInFlight = 1;
+    transferManagerConfig.unchangedFileCheck = UnchangedFileCheck::SIZE_AND_MODIFIED_TIME;
+    transferManagerConfig.transferInitiatedCallback = [&](const TransferManager*, const std::shared_ptr<const TransferHandle>& handle)
+        {
+            std::lock_guard<std::mutex> m(semaphoreLock);
+            initiatedHandles.push_back(handle);
+        };
+    auto transferManager = TransferManager::Create(transferManagerConfig);
+
+    auto directoryUpload = transferManager->UploadDirectory(uploadDir, GetTestBucketName(), "syncTest", Aws::Map<Aws::String, Aws::String>());
+    directoryUpload->WaitUntilFinished();
+
+    ASSERT_FALSE(directoryUpload->HasTraversalFailed());
+    ASSERT_EQ(3u, directoryUpload->GetFilesStarted());
+    ASSERT_EQ(3u, directoryUpload->GetFilesCompleted());
+    ASSERT_EQ(0u, directoryUpload->GetFilesFailed());
+    ASSERT_EQ(0u, directoryUpload->GetFilesSkipped());
+    ASSERT_EQ(3u, initiatedHandles.size());
+
+    uint64_t bytesUploaded = 0;
+    for (const auto& handle : initiatedHandles)
+    {
+        bytesUploaded += handle->GetBytesTotalSize();
+        ASSERT_TRUE(WaitForObjectToPropagate(GetTestBucketName(), handle->GetKey().c_str()));
+    }
+    ASSERT_EQ(bytesUploaded, directoryUpload->GetBytesTransferred());
+
+    // nothing changed locally, so the second pass finds every object up to date.
+    auto secondDirectoryUpload = transferManager->UploadDirectory(uploadDir, GetTestBucketName(), "syncTest", Aws::Map<Aws::String, Aws::String>());
+    secondDirectoryUpload->WaitUntilFinished();
+
+    ASSERT_EQ(0u, secondDirectoryUpload->GetFilesStarted());
+    ASSERT_EQ(3u, secondDirectoryUpload->GetFilesSkipped());
+    ASSERT_EQ(6u, initiatedHandles.size());
+    for (size_t i = 3; i < initiatedHandles.size(); ++i)
+    {
+        ASSERT_EQ(TransferStatus::EXACT_OBJECT_ALREADY_EXISTS, initiatedHandles[i]->GetStatus());
+    }
+}
+
 // Test of a basic multi part upload - 7.5 megs
 TEST_F(TransferTests, TransferManager_MediumTest)
 {
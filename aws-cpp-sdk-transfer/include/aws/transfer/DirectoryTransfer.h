@@ -0,0 +1,162 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/transfer/Transfer_EXPORTS.h>
+#include <aws/transfer/TransferHandle.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+
+namespace Aws
+{
+    namespace Transfer
+    {
+        /**
+         * Progress of a whole UploadDirectory or DownloadToDirectory operation. The files themselves are still reported one TransferHandle at a time
+         * through the callbacks in TransferManagerConfiguration; this keeps the totals across all of them, and bounds how many of them are in flight.
+         * Counters only cover files whose transfer was started by the directory operation, retries of their handles are not counted.
+         */
+        class AWS_TRANSFER_API DirectoryTransfer
+        {
+        public:
+            /**
+             * maxFilesInFlight of 0 means no limit.
+             */
+            DirectoryTransfer(TransferDirection direction, const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix,
+                    size_t maxFilesInFlight);
+
+            inline TransferDirection GetTransferDirection() const { return m_direction; }
+            inline const Aws::String& GetDirectory() const { return m_directory; }
+            inline const Aws::String& GetBucketName() const { return m_bucketName; }
+            inline const Aws::String& GetPrefix() const { return m_prefix; }
+
+            /**
+             * Number of files whose transfer has been started so far.
+             */
+            inline size_t GetFilesStarted() const { return m_filesStarted.load(); }
+            /**
+             * Number of started files whose transfer completed.
+             */
+            inline size_t GetFilesCompleted() const { return m_filesCompleted.load(); }
+            /**
+             * Number of started files whose transfer failed, was canceled or aborted.
+             */
+            inline size_t GetFilesFailed() const { return m_filesFailed.load(); }
+            /**
+             * Number of files that were not transferred because they were found unchanged.
+             */
+            inline size_t GetFilesSkipped() const { return m_filesSkipped.load(); }
+            /**
+             * Number of files that were started and have not finished yet.
+             */
+            size_t GetFilesInFlight() const;
+            /**
+             * Total size of the files that completed.
+             */
+            inline uint64_t GetBytesTransferred() const { return m_bytesTransferred.load(); }
+
+            /**
+             * Completed files per second since the operation started, or over its whole duration once it has finished.
+             */
+            double GetFilesPerSecond() const;
+            /**
+             * Bytes of completed files per second since the operation started, or over its whole duration once it has finished.
+             */
+            double GetBytesPerSecond() const;
+
+            /**
+             * True once the whole directory tree has been walked, or all pages of the listing have been received.
+             */
+            bool IsTraversalFinished() const;
+            /**
+             * True if walking the directory or listing the bucket failed part way. The files found before that are still transferred.
+             */
+            inline bool HasTraversalFailed() const { return m_traversalFailed.load(); }
+            /**
+             * True once the traversal has finished and every file it started has finished as well.
+             */
+            bool IsFinished() const;
+            /**
+             * Blocks until IsFinished() is true.
+             */
+            void WaitUntilFinished() const;
+            /**
+             * Stops starting new files. Files already started keep going, cancel their handles to stop those as well.
+             */
+            void Cancel();
+            /**
+             * Returns false once Cancel has been called.
+             */
+            inline bool ShouldContinue() const { return !m_cancel.load(); }
+
+            /**
+             * Blocks until fewer than maxFilesInFlight files are in flight and counts one more file as started.
+             * Returns false without waiting any longer once the operation is canceled. Used by TransferManager.
+             */
+            bool AcquireFileSlot();
+            /**
+             * Reports a started file as finished with the final status of its handle. Used by TransferManager.
+             */
+            void OnFileFinished(TransferStatus status, uint64_t bytes);
+            /**
+             * Counts a file that was found unchanged. Used by TransferManager.
+             */
+            void OnFileSkipped();
+            /**
+             * Blocks until the listing page before pageNumber has been handed out, so pages start their files in order and at most one page waits
+             * while another is being started. Used by TransferManager.
+             */
+            void WaitForPageTurn(size_t pageNumber);
+            /**
+             * Lets the page after pageNumber start its files. Used by TransferManager.
+             */
+            void FinishPage(size_t pageNumber);
+            /**
+             * Marks the traversal as done. Used by TransferManager.
+             */
+            void OnTraversalFinished(bool succeeded);
+
+        private:
+            double ElapsedSeconds() const;
+
+            TransferDirection m_direction;
+            Aws::String m_directory;
+            Aws::String m_bucketName;
+            Aws::String m_prefix;
+            size_t m_maxFilesInFlight;
+
+            std::atomic<size_t> m_filesStarted;
+            std::atomic<size_t> m_filesCompleted;
+            std::atomic<size_t> m_filesFailed;
+            std::atomic<size_t> m_filesSkipped;
+            std::atomic<uint64_t> m_bytesTransferred;
+            std::atomic<bool> m_traversalFailed;
+            std::atomic<bool> m_cancel;
+
+            std::chrono::steady_clock::time_point m_startTime;
+            std::chrono::steady_clock::time_point m_finishTime;
+            size_t m_filesInFlight;
+            size_t m_nextPage;
+            bool m_traversalFinished;
+            bool m_finished;
+            mutable std::mutex m_lock;
+            mutable std::condition_variable m_signal;
+        };
+    }
+}
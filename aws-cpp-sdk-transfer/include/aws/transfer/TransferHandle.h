@@ -25,6 +25,7 @@
 #include <aws/s3/S3Errors.h>
 #include <iostream>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <condition_variable>
 
@@ -263,6 +264,42 @@ namespace Aws
              */
             inline void SetBytesTotalSize(uint64_t value) { m_bytesTotalSize.store(value); }
 
+            /**
+             * Size of the parts this transfer is split into. Chosen by TransferManager when the transfer starts, 0 before that.
+             */
+            inline uint64_t GetPartSize() const { return m_partSize.load(); }
+            /**
+             * Size of the parts this transfer is split into. Set by TransferManager.
+             */
+            inline void SetPartSize(uint64_t value) { m_partSize.store(value); }
+
+            /**
+             * Maximum number of parts of this transfer allowed in flight at the same time. It is tuned as parts complete when
+             * TransferManagerConfiguration::enableAdaptiveTransfers is set, fixed at maxPartsInFlight for parallel file downloads,
+             * and 0 (no limit besides the transfer buffers) otherwise.
+             */
+            size_t GetConcurrencyWindow() const;
+            /**
+             * Throughput of this transfer in bytes per second, smoothed over the last few rounds of completed parts. 0 until enough parts have completed.
+             */
+            inline uint64_t GetThroughput() const { return m_throughput.load(); }
+
+            /**
+             * Limits the number of parts in flight to a window of initialWindow parts. If tune is true the window is then tuned between 1 and maxWindow
+             * from the observed throughput and latency of completed parts, otherwise it stays fixed. Used by TransferManager.
+             */
+            void EnableConcurrencyControl(size_t initialWindow, size_t maxWindow, bool tune = true);
+            /**
+             * Blocks until a part may be sent within the concurrency window and counts it as in flight.
+             * Returns false without waiting any longer once the transfer is canceled. Used by TransferManager.
+             */
+            bool AcquirePartSlot();
+            /**
+             * Reports a part that was in flight as finished and adjusts the concurrency window. latency is the time from sending the part
+             * until it finished, bytes the size of the part. Used by TransferManager.
+             */
+            void ReleasePartSlot(uint64_t bytes, std::chrono::milliseconds latency, bool succeeded);
+
             /**
              * Bucket portion of the object location in Amazon S3.
              */
@@ -283,6 +320,19 @@ namespace Aws
             const Aws::String GetVersionId() const { std::lock_guard<std::mutex> locker(m_getterSetterLock); return m_versionId; }
             void SetVersionId(const Aws::String& versionId) { std::lock_guard<std::mutex> locker(m_getterSetterLock); m_versionId = versionId; }
 
+            /**
+             * (Download only) Whether TransferManager itself created the download stream for GetTargetFilePath(), as opposed to a caller supplied one,
+             * so parts may be written to that file directly. Largely for internal use.
+             */
+            inline bool IsDownloadingToFile() const { return m_downloadingToFile.load(); }
+            inline void SetDownloadingToFile(bool value) { m_downloadingToFile.store(value); }
+
+            /**
+             * (Download only) ETag of the object when the download started.
+             */
+            const Aws::String GetObjectETag() const { std::lock_guard<std::mutex> locker(m_getterSetterLock); return m_objectETag; }
+            void SetObjectETag(const Aws::String& eTag) { std::lock_guard<std::mutex> locker(m_getterSetterLock); m_objectETag = eTag; }
+
             /**
              * Upload or Download?
              */
@@ -363,8 +413,11 @@ namespace Aws
             Aws::String GetId() const;
 
         private:
+            TransferHandle(const Aws::String& bucketName, const Aws::String& keyName, uint64_t totalSize, TransferDirection direction,
+                           CreateDownloadStreamCallback createDownloadStreamFn, const Aws::String& targetFilePath);
 
             void CleanupDownloadStream();
+            void StartConcurrencyRound();
 
             std::atomic<bool> m_isMultipart;
             Aws::String m_multipartId;
@@ -381,6 +434,7 @@ namespace Aws
             Aws::String m_fileName;
             Aws::String m_contentType;
             Aws::String m_versionId;
+            Aws::String m_objectETag;
             Aws::Map<Aws::String, Aws::String> m_metadata;
             TransferStatus m_status;
             Aws::Client::AWSError<Aws::S3::S3Errors> m_lastError;
@@ -396,6 +450,24 @@ namespace Aws
             mutable std::mutex m_statusLock;
             mutable std::condition_variable m_waitUntilFinishedSignal;
             mutable std::mutex m_getterSetterLock;
+
+            std::atomic<bool> m_downloadingToFile;
+            std::atomic<uint64_t> m_partSize;
+            std::atomic<uint64_t> m_throughput;
+            bool m_concurrencyControlEnabled;
+            bool m_tuneConcurrencyWindow;
+            bool m_slowStart;
+            size_t m_concurrencyWindow;
+            size_t m_maxConcurrencyWindow;
+            size_t m_partsInFlight;
+            size_t m_roundParts;
+            uint64_t m_roundBytes;
+            std::chrono::milliseconds m_roundLatency;
+            std::chrono::milliseconds m_minLatency;
+            std::chrono::steady_clock::time_point m_roundStart;
+            uint64_t m_lastRoundThroughput;
+            mutable std::mutex m_concurrencyLock;
+            std::condition_variable m_partSlotSignal;
         };
 
         AWS_TRANSFER_API Aws::OStream& operator << (Aws::OStream& s, TransferStatus status);
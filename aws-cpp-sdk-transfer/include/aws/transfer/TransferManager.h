@@ -16,6 +16,7 @@
 #pragma once
 
 #include <aws/transfer/TransferHandle.h>
+#include <aws/transfer/DirectoryTransfer.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/PutObjectRequest.h>
 #include <aws/s3/model/CreateMultipartUploadRequest.h>
@@ -23,6 +24,7 @@
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/ResourceManager.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/client/AsyncCallerContext.h>
 
 #include <memory>
@@ -41,12 +43,29 @@ namespace Aws
 
         const uint64_t MB5 = 5 * 1024 * 1024;
 
+        /**
+         * How UploadDirectory and DownloadToDirectory decide that a file does not need to be transferred again.
+         */
+        enum class UnchangedFileCheck
+        {
+            // Always transfer every file.
+            NONE,
+            // Skip a file when its size matches the object and the copy being transferred to was last modified no earlier than the source.
+            SIZE_AND_MODIFIED_TIME,
+            // Skip a file when its MD5 matches the ETag of the object. Objects uploaded in multiple parts have ETags that are not an MD5,
+            // for those the size and modified time are compared instead.
+            ETAG
+        };
+
         /**
          * Configuration for use with TransferManager. The data here will be copied directly to TransferManager.
          */
         struct TransferManagerConfiguration
         {
-            TransferManagerConfiguration(Aws::Utils::Threading::Executor* executor) : s3Client(nullptr), transferExecutor(executor), transferBufferMaxHeapSize(10 * MB5), bufferSize(MB5)
+            TransferManagerConfiguration(Aws::Utils::Threading::Executor* executor) : s3Client(nullptr), transferExecutor(executor), partReadExecutor(nullptr),
+                partReadQueueDepth(4), computeContentMD5(false), transferBufferMaxHeapSize(10 * MB5), bufferSize(MB5),
+                enableAdaptiveTransfers(false), maxPartsInFlight(64), useMemoryMappedFiles(false),
+                enableParallelFileDownloads(false), maxFilesInFlight(0), unchangedFileCheck(UnchangedFileCheck::NONE)
             {
             }
 
@@ -60,6 +79,23 @@ namespace Aws
              * It is not a bug to use the same executor, but at least be aware that this is how the manager will be used.
              */
             Aws::Utils::Threading::Executor* transferExecutor;
+            /**
+             * Optional executor used to read parts of files being uploaded in parallel. When set, multi-part uploads from a file read each part with
+             * positional reads on this executor, compute its checksum there if requested, and submit it, instead of reading the file one part at a time
+             * on the transferExecutor thread. Uploads from a caller supplied stream are always read sequentially.
+             * This must not be the same executor as transferExecutor, since the transferExecutor thread blocks while waiting for reads to finish.
+             * Default nullptr.
+             */
+            Aws::Utils::Threading::Executor* partReadExecutor;
+            /**
+             * Maximum number of parts of a single upload that are being read on the partReadExecutor at the same time. Default 4.
+             * The total number of parts in memory is still bounded by transferBufferMaxHeapSize.
+             */
+            size_t partReadQueueDepth;
+            /**
+             * If true, the MD5 of each uploaded part is computed and sent as Content-MD5 so that S3 verifies the part. Default false.
+             */
+            bool computeContentMD5;
             /**
              * If you have special arguments you want passed to our put object calls, put them here. We will copy the template for each put object call
              * overriding the body stream, bucket, and key. If object metadata is passed through, we will override that as well.
@@ -86,6 +122,55 @@ namespace Aws
              * to increase your max heap size if this is something you plan on increasing.
              */
             uint64_t bufferSize;
+            /**
+             * If true, each multi-part transfer picks its own part size and tunes how many of its parts are in flight. Default false.
+             * The part size is bufferSize, or the smallest multiple of 1MB that keeps the object within S3's limit of 10,000 parts if that is larger.
+             * Parts larger than bufferSize are allocated for the part instead of coming from the transfer buffers.
+             * The number of parts in flight starts small and grows like tcp slow start while throughput keeps improving, then grows by one part
+             * at a time until part latency rises without throughput following, and is cut in half whenever a part fails.
+             * The current part size, window and throughput are available from TransferHandle.
+             */
+            bool enableAdaptiveTransfers;
+            /**
+             * Upper bound of the concurrency window of a single transfer when enableAdaptiveTransfers is set. Default 64.
+             * The window is also kept within transferBufferMaxHeapSize / part size for parts held in transfer buffers.
+             * Also the number of parts in flight of parallel file downloads without enableAdaptiveTransfers.
+             */
+            size_t maxPartsInFlight;
+            /**
+             * If true, multi-part uploads from a file and multi-part downloads to a file map each part's range of the file into memory and
+             * send it from or receive it into the mapping directly. No transfer buffers are used and the copy between the buffer and the file
+             * goes away, so memory use no longer grows with transferBufferMaxHeapSize. Default false.
+             * Downloads resize the target file to the size of the object before writing to it. The file must not be truncated by anyone else while it
+             * is mapped. Not available on Windows, where the regular buffers are always used.
+             */
+            bool useMemoryMappedFiles;
+            /**
+             * If true, multi-part downloads to a file write each ranged GET straight to its offset in the file with positional writes as the data
+             * arrives, in whatever order the parts complete. No transfer buffers are involved, so maxPartsInFlight parts are requested at once
+             * (or the adaptive window if enableAdaptiveTransfers is set) no matter how large transferBufferMaxHeapSize is. Default false.
+             * Every part is requested with If-Match on the ETag the object had when the download started. Completed parts are recorded in a bitmap
+             * in a "<file>.s3download" file next to the target at checkpoints: every 64MB of parts, and when the download fails or is canceled,
+             * the file is synced once and the parts written before the sync are marked done. Downloading the same object to the same file again,
+             * even after a crash, only fetches the parts that are missing, plus at most the parts written since the last checkpoint. The bitmap
+             * file is removed once the download completes.
+             * Takes precedence over useMemoryMappedFiles for downloads. Not available on Windows.
+             */
+            bool enableParallelFileDownloads;
+            /**
+             * Maximum number of files of a single UploadDirectory or DownloadToDirectory call that are transferring at the same time. Default 0, no limit.
+             * Walking the directory or listing the bucket pauses while the limit is reached and picks up again as files finish, so memory use stays
+             * flat no matter how many files there are. The walk runs on a transferExecutor thread and blocks it while paused, so transferExecutor
+             * needs more threads than that for the transfers themselves to make progress.
+             */
+            size_t maxFilesInFlight;
+            /**
+             * Whether UploadDirectory and DownloadToDirectory skip files that are unchanged. Default NONE.
+             * Uploads list the objects of each directory level, with "/" as the delimiter, as the walk reaches it, so the listing overlaps the uploads
+             * and only the levels on the path to the current file are held in memory: that grows with the number of files in one directory rather
+             * than in the whole tree. Skipped files are reported through transferInitiatedCallback with a handle in the EXACT_OBJECT_ALREADY_EXISTS state.
+             */
+            UnchangedFileCheck unchangedFileCheck;
 
             /**
              * Callback to receive progress updates for uploads.
@@ -201,8 +286,10 @@ namespace Aws
              * directory: the absolute directory on disk to upload
              * bucketName: the name of the S3 bucket to upload to
              * prefix: the prefix to put on all objects uploaded (e.g. put them in x directory in the bucket).
+             *
+             * Returns the DirectoryTransfer tracking the totals of the operation.
              */
-            void UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata);
+            std::shared_ptr<DirectoryTransfer> UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata);
 
             /**
             * Downloads entire contents of an Amazon S3 bucket starting at prefix stores them in a directory (not including the prefix). This is an asynchronous method. You will receive notifications
@@ -212,8 +299,10 @@ namespace Aws
             * directory: the absolute directory on disk to download to
             * bucketName: the name of the S3 bucket to upload to
             * prefix: the prefix in the bucket to use as the root directory (e.g. download all objects at x prefix in S3 and then store them starting in directory with the prefix stripped out).
+            *
+            * Returns the DirectoryTransfer tracking the totals of the operation.
             */
-            void DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix = Aws::String());
+            std::shared_ptr<DirectoryTransfer> DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix = Aws::String());
 
         private:
             /**
@@ -233,6 +322,15 @@ namespace Aws
                                                                    Aws::String>& metadata,
                                                                    const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context,
                                                                    const Aws::String& fileName = "");
+            /**
+             * Opens fileName and creates the TransferHandle to upload it.
+             */
+            std::shared_ptr<TransferHandle> CreateUploadFileHandle(const Aws::String& fileName,
+                                                                   const Aws::String& bucketName,
+                                                                   const Aws::String& keyName,
+                                                                   const Aws::String& contentType,
+                                                                   const Aws::Map<Aws::String, Aws::String>& metadata,
+                                                                   const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
 
             /**
              * Submits the actual task to task schecduler
@@ -262,10 +360,46 @@ namespace Aws
                                                          const Aws::Map<Aws::String, Aws::String>& metadata,
                                                          const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
 
+            /**
+             * Downloads bucketName/keyName through the stream created by writeToStreamfn. downloadingToFile tells whether that stream is
+             * writeToFile opened by TransferManager, in which case parts may be written to the file directly.
+             */
+            std::shared_ptr<TransferHandle> DoDownloadFile(const Aws::String& bucketName,
+                                                           const Aws::String& keyName,
+                                                           CreateDownloadStreamCallback writeToStreamfn,
+                                                           const DownloadConfiguration& downloadConfig,
+                                                           const Aws::String& writeToFile,
+                                                           const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context,
+                                                           bool downloadingToFile);
+
             bool MultipartUploadSupported(uint64_t length) const;
+            /**
+             * Part size to split an object of objectSize bytes into.
+             */
+            uint64_t ComputePartSize(uint64_t objectSize) const;
+            /**
+             * Turns on the concurrency window of handle if adaptive transfers are enabled, or fixes it at maxPartsInFlight for parts that don't
+             * use transfer buffers. Call once its part size is known.
+             */
+            void ConfigureConcurrencyControl(const std::shared_ptr<TransferHandle>& handle, bool usesTransferBuffers = true) const;
+            /**
+             * Returns a buffer of at least length bytes. Buffers up to bufferSize come from the transfer buffers, larger ones are allocated.
+             */
+            Aws::Utils::Array<uint8_t>* AcquirePartBuffer(uint64_t length);
+            void ReleasePartBuffer(Aws::Utils::Array<uint8_t>* buffer);
             bool InitializePartsForDownload(const std::shared_ptr<TransferHandle>& handle);
 
             void DoMultiPartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle);
+            /**
+             * Sends one part whose content has been read into buffer. Ownership of buffer passes to the request, unless buffer is a mapped
+             * region of the file, which mappedRegion then keeps alive until the part completes.
+             */
+            void SubmitUploadPart(const std::shared_ptr<TransferHandle>& handle, const PartPointer& partState, Aws::Utils::Array<uint8_t>* buffer,
+                    const std::shared_ptr<Aws::Utils::Array<uint8_t>>& mappedRegion = nullptr);
+            /**
+             * Completes or fails a multi-part upload once none of its parts are queued or pending anymore.
+             */
+            void CompleteMultiPartUploadIfDone(const std::shared_ptr<TransferHandle>& handle);
             void DoSinglePartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle);
 
             void DoMultiPartUpload(const std::shared_ptr<TransferHandle>& handle);
@@ -285,6 +419,23 @@ namespace Aws
             void HandlePutObjectResponse(const Aws::S3::S3Client*, const Aws::S3::Model::PutObjectRequest&, const Aws::S3::Model::PutObjectOutcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
             void HandleListObjectsResponse(const Aws::S3::S3Client*, const Aws::S3::Model::ListObjectsV2Request&, const Aws::S3::Model::ListObjectsV2Outcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
 
+            /**
+             * Walks the directory of directoryTransfer and starts the upload of every file in it, within the limits of maxFilesInFlight.
+             */
+            void DoUploadDirectory(const std::shared_ptr<DirectoryTransfer>& directoryTransfer, const Aws::Map<Aws::String, Aws::String>& metadata);
+            /**
+             * Starts the download of every object in one page of a directory listing, after requesting the next page.
+             */
+            void DownloadListedObjects(const Aws::S3::Model::ListObjectsV2Request&, const Aws::S3::Model::ListObjectsV2Outcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
+            /**
+             * Reports a file found unchanged by a directory operation as a handle in the EXACT_OBJECT_ALREADY_EXISTS state.
+             */
+            void SkipUnchangedFile(const std::shared_ptr<TransferHandle>& handle, const std::shared_ptr<DirectoryTransfer>& directoryTransfer);
+            /**
+             * Counts handle against directoryTransfer until it reaches a final state.
+             */
+            void TrackDirectoryFile(const std::shared_ptr<TransferHandle>& handle, const std::shared_ptr<DirectoryTransfer>& directoryTransfer);
+
             TransferStatus DetermineIfFailedOrCanceled(const TransferHandle&) const;
             void TriggerUploadProgressCallback(const std::shared_ptr<const TransferHandle>&) const;
             void TriggerDownloadProgressCallback(const std::shared_ptr<const TransferHandle>&) const;
@@ -295,6 +446,9 @@ namespace Aws
 
             Aws::Utils::ExclusiveOwnershipResourceManager<Aws::Utils::Array<uint8_t>*> m_bufferManager;
             TransferManagerConfiguration m_transferConfig;
+            // files started by directory operations that have not reached a final state yet.
+            mutable Aws::Map<const TransferHandle*, std::shared_ptr<DirectoryTransfer>> m_directoryFiles;
+            mutable std::mutex m_directoryFilesLock;
         };
 
         
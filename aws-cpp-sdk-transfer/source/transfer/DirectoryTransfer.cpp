@@ -0,0 +1,165 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/transfer/DirectoryTransfer.h>
+
+namespace Aws
+{
+    namespace Transfer
+    {
+        DirectoryTransfer::DirectoryTransfer(TransferDirection direction, const Aws::String& directory, const Aws::String& bucketName,
+                const Aws::String& prefix, size_t maxFilesInFlight) :
+            m_direction(direction),
+            m_directory(directory),
+            m_bucketName(bucketName),
+            m_prefix(prefix),
+            m_maxFilesInFlight(maxFilesInFlight),
+            m_filesStarted(0),
+            m_filesCompleted(0),
+            m_filesFailed(0),
+            m_filesSkipped(0),
+            m_bytesTransferred(0),
+            m_traversalFailed(false),
+            m_cancel(false),
+            m_startTime(std::chrono::steady_clock::now()),
+            m_finishTime(m_startTime),
+            m_filesInFlight(0),
+            m_nextPage(0),
+            m_traversalFinished(false),
+            m_finished(false)
+        {}
+
+        size_t DirectoryTransfer::GetFilesInFlight() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_filesInFlight;
+        }
+
+        double DirectoryTransfer::ElapsedSeconds() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            auto endTime = m_finished ? m_finishTime : std::chrono::steady_clock::now();
+            return std::chrono::duration_cast<std::chrono::duration<double>>(endTime - m_startTime).count();
+        }
+
+        double DirectoryTransfer::GetFilesPerSecond() const
+        {
+            double elapsed = ElapsedSeconds();
+            return elapsed > 0 ? static_cast<double>(m_filesCompleted.load()) / elapsed : 0;
+        }
+
+        double DirectoryTransfer::GetBytesPerSecond() const
+        {
+            double elapsed = ElapsedSeconds();
+            return elapsed > 0 ? static_cast<double>(m_bytesTransferred.load()) / elapsed : 0;
+        }
+
+        bool DirectoryTransfer::IsTraversalFinished() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_traversalFinished;
+        }
+
+        bool DirectoryTransfer::IsFinished() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_finished;
+        }
+
+        void DirectoryTransfer::WaitUntilFinished() const
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_signal.wait(locker, [this] { return m_finished; });
+        }
+
+        void DirectoryTransfer::Cancel()
+        {
+            m_cancel.store(true);
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_signal.notify_all();
+        }
+
+        bool DirectoryTransfer::AcquireFileSlot()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_signal.wait(locker, [this] { return m_cancel.load() || m_maxFilesInFlight == 0 || m_filesInFlight < m_maxFilesInFlight; });
+            if (m_cancel.load())
+            {
+                return false;
+            }
+
+            ++m_filesInFlight;
+            ++m_filesStarted;
+            return true;
+        }
+
+        void DirectoryTransfer::OnFileFinished(TransferStatus status, uint64_t bytes)
+        {
+            if (status == TransferStatus::COMPLETED)
+            {
+                m_bytesTransferred += bytes;
+                ++m_filesCompleted;
+            }
+            else
+            {
+                ++m_filesFailed;
+            }
+
+            std::lock_guard<std::mutex> locker(m_lock);
+            --m_filesInFlight;
+            if (m_traversalFinished && m_filesInFlight == 0)
+            {
+                m_finished = true;
+                m_finishTime = std::chrono::steady_clock::now();
+            }
+            m_signal.notify_all();
+        }
+
+        void DirectoryTransfer::OnFileSkipped()
+        {
+            ++m_filesSkipped;
+        }
+
+        void DirectoryTransfer::WaitForPageTurn(size_t pageNumber)
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_signal.wait(locker, [this, pageNumber] { return m_nextPage == pageNumber; });
+        }
+
+        void DirectoryTransfer::FinishPage(size_t pageNumber)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_nextPage = pageNumber + 1;
+            m_signal.notify_all();
+        }
+
+        void DirectoryTransfer::OnTraversalFinished(bool succeeded)
+        {
+            if (!succeeded)
+            {
+                m_traversalFailed.store(true);
+            }
+
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_traversalFinished = true;
+            if (m_filesInFlight == 0)
+            {
+                m_finished = true;
+                m_finishTime = std::chrono::steady_clock::now();
+            }
+            m_signal.notify_all();
+        }
+    }
+}
@@ -16,6 +16,7 @@
 #include <aws/transfer/TransferHandle.h>
 #include <aws/core/utils/logging/LogMacros.h>
 
+#include <algorithm>
 #include <cassert>
 
 namespace Aws
@@ -71,46 +72,25 @@ namespace Aws
             return m_completedParts;
         }
 
-        TransferHandle::TransferHandle(const Aws::String& bucketName, const Aws::String& keyName, uint64_t totalSize, const Aws::String& targetFilePath) : 
-            m_isMultipart(false), 
-            m_direction(TransferDirection::UPLOAD), 
-            m_bytesTransferred(0), 
-            m_lastPart(false),
-            m_bytesTotalSize(totalSize),
-            m_bucket(bucketName), 
-            m_key(keyName), 
-            m_fileName(targetFilePath),
-            m_versionId(""),
-            m_status(TransferStatus::NOT_STARTED), 
-            m_cancel(false),
-            m_handleId(Utils::UUID::RandomUUID()),
-            m_createDownloadStreamFn(), 
-            m_downloadStream(nullptr)
+        TransferHandle::TransferHandle(const Aws::String& bucketName, const Aws::String& keyName, uint64_t totalSize, const Aws::String& targetFilePath) :
+            TransferHandle(bucketName, keyName, totalSize, TransferDirection::UPLOAD, CreateDownloadStreamCallback(), targetFilePath)
         {}
 
         TransferHandle::TransferHandle(const Aws::String& bucketName, const Aws::String& keyName, const Aws::String& targetFilePath) :
-            m_isMultipart(false), 
-            m_direction(TransferDirection::DOWNLOAD), 
-            m_bytesTransferred(0), 
-            m_lastPart(false),
-            m_bytesTotalSize(0),
-            m_bucket(bucketName), 
-            m_key(keyName), 
-            m_fileName(targetFilePath),
-            m_versionId(""),
-            m_status(TransferStatus::NOT_STARTED), 
-            m_cancel(false),
-            m_handleId(Utils::UUID::RandomUUID()),
-            m_createDownloadStreamFn(), 
-            m_downloadStream(nullptr)
+            TransferHandle(bucketName, keyName, 0, TransferDirection::DOWNLOAD, CreateDownloadStreamCallback(), targetFilePath)
         {}
 
         TransferHandle::TransferHandle(const Aws::String& bucketName, const Aws::String& keyName, CreateDownloadStreamCallback createDownloadStreamFn, const Aws::String& targetFilePath) :
+            TransferHandle(bucketName, keyName, 0, TransferDirection::DOWNLOAD, createDownloadStreamFn, targetFilePath)
+        {}
+
+        TransferHandle::TransferHandle(const Aws::String& bucketName, const Aws::String& keyName, uint64_t totalSize, TransferDirection direction,
+                                       CreateDownloadStreamCallback createDownloadStreamFn, const Aws::String& targetFilePath) :
             m_isMultipart(false), 
-            m_direction(TransferDirection::DOWNLOAD), 
+            m_direction(direction), 
             m_bytesTransferred(0), 
             m_lastPart(false),
-            m_bytesTotalSize(0),
+            m_bytesTotalSize(totalSize),
             m_bucket(bucketName), 
             m_key(keyName), 
             m_fileName(targetFilePath),
@@ -119,7 +99,22 @@ namespace Aws
             m_cancel(false),
             m_handleId(Utils::UUID::RandomUUID()),
             m_createDownloadStreamFn(createDownloadStreamFn), 
-            m_downloadStream(nullptr)
+            m_downloadStream(nullptr),
+            m_downloadingToFile(false),
+            m_partSize(0),
+            m_throughput(0),
+            m_concurrencyControlEnabled(false),
+            m_tuneConcurrencyWindow(false),
+            m_slowStart(true),
+            m_concurrencyWindow(0),
+            m_maxConcurrencyWindow(0),
+            m_partsInFlight(0),
+            m_roundParts(0),
+            m_roundBytes(0),
+            m_roundLatency(0),
+            m_minLatency(0),
+            m_roundStart(std::chrono::steady_clock::now()),
+            m_lastRoundThroughput(0)
         {}
 
         TransferHandle::~TransferHandle()
@@ -331,6 +326,9 @@ namespace Aws
         {
             AWS_LOGSTREAM_TRACE(CLASS_TAG, "Transfer handle ID [" << GetId() << "] Cancelling transfer.");
             m_cancel.store(true);
+            // wake up anyone blocked waiting for a part slot so they can observe the cancellation.
+            std::lock_guard<std::mutex> locker(m_concurrencyLock);
+            m_partSlotSignal.notify_all();
         }
 
         void TransferHandle::Restart()
@@ -387,5 +385,140 @@ namespace Aws
         {
             return m_handleId;
         }
+
+        static const size_t THROUGHPUT_ROUND_PARTS = 4;
+
+        size_t TransferHandle::GetConcurrencyWindow() const
+        {
+            std::lock_guard<std::mutex> locker(m_concurrencyLock);
+            return m_concurrencyControlEnabled ? m_concurrencyWindow : 0;
+        }
+
+        void TransferHandle::EnableConcurrencyControl(size_t initialWindow, size_t maxWindow, bool tune)
+        {
+            std::lock_guard<std::mutex> locker(m_concurrencyLock);
+            m_maxConcurrencyWindow = (std::max)(maxWindow, static_cast<size_t>(1));
+            m_concurrencyWindow = (std::min)((std::max)(initialWindow, static_cast<size_t>(1)), m_maxConcurrencyWindow);
+            m_concurrencyControlEnabled = true;
+            m_tuneConcurrencyWindow = tune;
+            m_slowStart = true;
+            m_lastRoundThroughput = 0;
+            m_minLatency = std::chrono::milliseconds(0);
+            StartConcurrencyRound();
+        }
+
+        bool TransferHandle::AcquirePartSlot()
+        {
+            std::unique_lock<std::mutex> locker(m_concurrencyLock);
+            m_partSlotSignal.wait(locker, [this]
+            {
+                return !ShouldContinue() || !m_concurrencyControlEnabled || m_partsInFlight < m_concurrencyWindow;
+            });
+
+            if (!ShouldContinue())
+            {
+                return false;
+            }
+
+            // time spent before the first part is sent (e.g. CreateMultipartUpload) shouldn't count against throughput.
+            if (m_partsInFlight == 0 && m_roundParts == 0)
+            {
+                m_roundStart = std::chrono::steady_clock::now();
+            }
+            ++m_partsInFlight;
+            return true;
+        }
+
+        void TransferHandle::ReleasePartSlot(uint64_t bytes, std::chrono::milliseconds latency, bool succeeded)
+        {
+            std::lock_guard<std::mutex> locker(m_concurrencyLock);
+            if (m_partsInFlight > 0)
+            {
+                --m_partsInFlight;
+            }
+
+            if (!succeeded)
+            {
+                // Like a lost packet in tcp: halve the window and stop growing it exponentially.
+                if (m_concurrencyControlEnabled && m_tuneConcurrencyWindow)
+                {
+                    m_concurrencyWindow = (std::max)(m_concurrencyWindow / 2, static_cast<size_t>(1));
+                    m_slowStart = false;
+                    AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Transfer handle ID [" << GetId() << "] Part failed, concurrency window reduced to "
+                            << m_concurrencyWindow << ".");
+                }
+                StartConcurrencyRound();
+                m_partSlotSignal.notify_all();
+                return;
+            }
+
+            ++m_roundParts;
+            m_roundBytes += bytes;
+            m_roundLatency += latency;
+
+            // A round lasts until a window's worth of parts has completed, i.e. roughly one round trip for the whole window.
+            size_t roundSize = m_concurrencyControlEnabled && m_tuneConcurrencyWindow ? m_concurrencyWindow : THROUGHPUT_ROUND_PARTS;
+            if (m_roundParts >= roundSize)
+            {
+                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - m_roundStart).count();
+                uint64_t roundThroughput = m_roundBytes * 1000 / static_cast<uint64_t>((std::max)(elapsed, static_cast<decltype(elapsed)>(1)));
+                uint64_t throughput = m_throughput.load();
+                m_throughput.store(throughput == 0 ? roundThroughput : (throughput * 3 + roundThroughput) / 4);
+
+                auto averageLatency = m_roundLatency / static_cast<long long>(m_roundParts);
+                if (m_minLatency.count() == 0 || averageLatency < m_minLatency)
+                {
+                    m_minLatency = averageLatency;
+                }
+
+                if (m_concurrencyControlEnabled && m_tuneConcurrencyWindow)
+                {
+                    size_t previousWindow = m_concurrencyWindow;
+                    bool throughputGrew = roundThroughput > m_lastRoundThroughput + m_lastRoundThroughput / 8;
+                    if (m_slowStart)
+                    {
+                        // Double the window while that still buys throughput.
+                        if (m_lastRoundThroughput == 0 || throughputGrew)
+                        {
+                            m_concurrencyWindow = (std::min)(m_concurrencyWindow * 2, m_maxConcurrencyWindow);
+                        }
+                        else
+                        {
+                            m_slowStart = false;
+                        }
+                    }
+                    else if (throughputGrew || averageLatency <= m_minLatency * 2)
+                    {
+                        // Probe one more part at a time while parts aren't queueing up behind each other.
+                        m_concurrencyWindow = (std::min)(m_concurrencyWindow + 1, m_maxConcurrencyWindow);
+                    }
+                    else
+                    {
+                        // Latency grew without throughput growing with it: the extra parts are just waiting, so back off.
+                        m_concurrencyWindow = (std::max)(m_concurrencyWindow - (std::max)(m_concurrencyWindow / 4, static_cast<size_t>(1)), static_cast<size_t>(1));
+                    }
+
+                    if (m_concurrencyWindow != previousWindow)
+                    {
+                        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Transfer handle ID [" << GetId() << "] Round of " << m_roundParts << " parts at "
+                                << roundThroughput << " bytes/s, average latency " << averageLatency.count() << " ms. Concurrency window changed from "
+                                << previousWindow << " to " << m_concurrencyWindow << ".");
+                    }
+                }
+
+                m_lastRoundThroughput = roundThroughput;
+                StartConcurrencyRound();
+            }
+
+            m_partSlotSignal.notify_all();
+        }
+
+        void TransferHandle::StartConcurrencyRound()
+        {
+            m_roundParts = 0;
+            m_roundBytes = 0;
+            m_roundLatency = std::chrono::milliseconds(0);
+            m_roundStart = std::chrono::steady_clock::now();
+        }
     }
 }
@@ -19,6 +19,7 @@
 #include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/crypto/MD5.h>
 #include <aws/core/utils/FileSystemUtils.h>
 #include <aws/core/platform/FileSystem.h>
 #include <aws/s3/S3Client.h>
@@ -29,6 +30,18 @@
 #include <aws/s3/model/AbortMultipartUploadRequest.h>
 #include <fstream>
 #include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/mman.h>
+#endif
 
 #include <aws/core/utils/logging/LogMacros.h>
 
@@ -41,16 +54,811 @@ namespace Aws
             return (path.find_last_of('/') == path.size() - 1 || path.find_last_of('\\') == path.size() - 1);
         }
 
+        class PartFile;
+        class DownloadStateFile;
+
         struct TransferHandleAsyncContext : public Aws::Client::AsyncCallerContext
         {
             std::shared_ptr<TransferHandle> handle;
             PartPointer partState;
+            std::chrono::steady_clock::time_point startTime;
+            // set when the part is sent from or received into a mapped region of the file instead of a transfer buffer.
+            std::shared_ptr<Aws::Utils::Array<uint8_t>> mappedRegion;
+            // set when a downloaded part is written straight to its range of the target file.
+            std::shared_ptr<PartFile> targetFile;
+            // set when downloaded parts go into a mapped file, for those received into a transfer buffer because their range couldn't be mapped.
+            std::shared_ptr<PartFile> mappedFile;
+            std::shared_ptr<DownloadStateFile> downloadState;
         };
 
+        static const uint64_t MAX_PARTS_PER_UPLOAD = 10000;
+        static const uint64_t PART_SIZE_GRANULARITY = 1024 * 1024;
+        static const size_t INITIAL_CONCURRENCY_WINDOW = 2;
+
+        static std::chrono::milliseconds ElapsedSince(std::chrono::steady_clock::time_point startTime)
+        {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime);
+        }
+
         struct DownloadDirectoryContext : public Aws::Client::AsyncCallerContext
         {
+            DownloadDirectoryContext() : pageNumber(0) {}
+
             Aws::String rootDirectory;
             Aws::String prefix;
+            std::shared_ptr<DirectoryTransfer> directoryTransfer;
+            // position of the listing page this context was sent with.
+            size_t pageNumber;
+        };
+
+        /**
+         * What a directory operation needs to know about an object to tell whether a file is unchanged.
+         */
+        struct ObjectSummary
+        {
+            ObjectSummary() : size(0), lastModifiedMillis(0) {}
+            ObjectSummary(const Aws::S3::Model::Object& object) :
+                size(static_cast<uint64_t>(object.GetSize())), lastModifiedMillis(object.GetLastModified().Millis()), eTag(object.GetETag())
+            {}
+
+            uint64_t size;
+            int64_t lastModifiedMillis;
+            Aws::String eTag;
+        };
+
+        /**
+         * Gets the size and last modified time of a local file. Returns false if there is no such file.
+         */
+        static bool GetLocalFileInfo(const Aws::String& fileName, uint64_t& size, int64_t& lastModifiedMillis)
+        {
+#ifdef _MSC_VER
+            struct _stat64 fileInfo;
+            if (_wstat64(Aws::Utils::StringUtils::ToWString(fileName.c_str()).c_str(), &fileInfo) != 0)
+#else
+            struct stat fileInfo;
+            if (stat(fileName.c_str(), &fileInfo) != 0)
+#endif
+            {
+                return false;
+            }
+
+            size = static_cast<uint64_t>(fileInfo.st_size);
+            lastModifiedMillis = static_cast<int64_t>(fileInfo.st_mtime) * 1000;
+            return true;
+        }
+
+        static bool FileMatchesETag(const Aws::String& fileName, const Aws::String& eTag)
+        {
+#ifdef _MSC_VER
+            Aws::FStream fileStream(Aws::Utils::StringUtils::ToWString(fileName.c_str()).c_str(), std::ios_base::in | std::ios_base::binary);
+#else
+            Aws::FStream fileStream(fileName.c_str(), std::ios_base::in | std::ios_base::binary);
+#endif
+            if (!fileStream.good())
+            {
+                return false;
+            }
+
+            Aws::String md5 = Aws::Utils::HashingUtils::HexEncode(Aws::Utils::HashingUtils::CalculateMD5(fileStream));
+            return eTag == md5 || eTag == "\"" + md5 + "\"";
+        }
+
+        /**
+         * Decides whether the local file and the object hold the same content according to check. direction tells which of the two is the copy.
+         */
+        static bool IsUnchangedFile(UnchangedFileCheck check, const Aws::String& fileName, const ObjectSummary& object, TransferDirection direction)
+        {
+            uint64_t fileSize = 0;
+            int64_t fileLastModifiedMillis = 0;
+            if (check == UnchangedFileCheck::NONE || !GetLocalFileInfo(fileName, fileSize, fileLastModifiedMillis) || fileSize != object.size)
+            {
+                return false;
+            }
+
+            // ETags of multi-part uploads are not the MD5 of the object, they contain the number of parts after a dash.
+            if (check == UnchangedFileCheck::ETAG && object.eTag.find('-') == Aws::String::npos)
+            {
+                return FileMatchesETag(fileName, object.eTag);
+            }
+
+            // timestamps only have second precision on S3, so the copy counts as current if it was written within the same second.
+            return direction == TransferDirection::UPLOAD ? object.lastModifiedMillis >= fileLastModifiedMillis : fileLastModifiedMillis >= object.lastModifiedMillis;
+        }
+
+        /**
+         * Finds the objects a directory upload compares its files against. Objects are listed one directory level at a time, with "/" as the
+         * delimiter, when the first file of that directory is looked up. Since the directory is walked depth first, a level is never visited again
+         * once a file outside of it comes up, so only the listings of the directories on the path to the current file are kept.
+         */
+        class UploadDirectoryListing
+        {
+        public:
+            UploadDirectoryListing(const std::shared_ptr<Aws::S3::S3Client>& s3Client, const Aws::String& bucketName, const Aws::Map<Aws::String, Aws::String>& accessLogTag) :
+                m_s3Client(s3Client), m_bucketName(bucketName), m_accessLogTag(accessLogTag)
+            {
+            }
+
+            /**
+             * Returns the object with keyName, or nullptr if there is none or its directory level could not be listed.
+             */
+            const ObjectSummary* Find(const Aws::String& keyName)
+            {
+                Aws::String levelPrefix = keyName.substr(0, keyName.find_last_of('/') + 1);
+                for (auto level = m_levels.begin(); level != m_levels.end();)
+                {
+                    if (levelPrefix.compare(0, level->first.size(), level->first) != 0)
+                    {
+                        level = m_levels.erase(level);
+                    }
+                    else
+                    {
+                        ++level;
+                    }
+                }
+
+                auto level = m_levels.find(levelPrefix);
+                if (level == m_levels.end())
+                {
+                    level = m_levels.emplace(levelPrefix, ListLevel(levelPrefix)).first;
+                }
+
+                auto object = level->second.find(keyName);
+                return object == level->second.end() ? nullptr : &object->second;
+            }
+
+        private:
+            Aws::Map<Aws::String, ObjectSummary> ListLevel(const Aws::String& levelPrefix) const
+            {
+                Aws::Map<Aws::String, ObjectSummary> objects;
+                Aws::S3::Model::ListObjectsV2Request request;
+                request.SetCustomizedAccessLogTag(m_accessLogTag);
+                request.WithBucket(m_bucketName)
+                    .WithPrefix(levelPrefix)
+                    .WithDelimiter("/");
+
+                for (;;)
+                {
+                    auto outcome = m_s3Client->ListObjectsV2(request);
+                    if (!outcome.IsSuccess())
+                    {
+                        AWS_LOGSTREAM_WARN(CLASS_TAG, "Listing objects failed for bucket: " << m_bucketName << " with prefix: " << levelPrefix
+                                << ", uploading all files under it. Error message: " << outcome.GetError());
+                        objects.clear();
+                        return objects;
+                    }
+
+                    for (const auto& object : outcome.GetResult().GetContents())
+                    {
+                        objects[object.GetKey()] = ObjectSummary(object);
+                    }
+
+                    if (!outcome.GetResult().GetIsTruncated())
+                    {
+                        return objects;
+                    }
+                    request.SetContinuationToken(outcome.GetResult().GetNextContinuationToken());
+                }
+            }
+
+            std::shared_ptr<Aws::S3::S3Client> m_s3Client;
+            Aws::String m_bucketName;
+            Aws::Map<Aws::String, Aws::String> m_accessLogTag;
+            // listings of the directory levels on the path to the last file looked up, by key prefix.
+            Aws::Map<Aws::String, Aws::Map<Aws::String, ObjectSummary>> m_levels;
+        };
+
+        /**
+         * Reads byte ranges of a file at explicit offsets, so parts can be read from several threads at once without sharing a stream position.
+         */
+        class PartFileReader
+        {
+        public:
+            PartFileReader(const Aws::String& fileName) :
+#ifdef _WIN32
+                m_fileName(fileName)
+            {
+            }
+#else
+                m_fd(open(fileName.c_str(), O_RDONLY | O_CLOEXEC))
+            {
+            }
+
+            ~PartFileReader()
+            {
+                if (m_fd >= 0)
+                {
+                    close(m_fd);
+                }
+            }
+#endif
+
+            PartFileReader(const PartFileReader&) = delete;
+            PartFileReader& operator=(const PartFileReader&) = delete;
+
+#ifdef _WIN32
+            bool IsOpen() const
+            {
+                return true;
+            }
+
+            bool ReadAt(uint64_t offset, unsigned char* buffer, size_t length) const
+            {
+#ifdef _MSC_VER
+                auto wide = Aws::Utils::StringUtils::ToWString(m_fileName.c_str());
+                Aws::IFStream stream(wide.c_str(), std::ios_base::in | std::ios_base::binary);
+#else
+                Aws::IFStream stream(m_fileName.c_str(), std::ios_base::in | std::ios_base::binary);
+#endif
+                stream.seekg(static_cast<std::streamoff>(offset));
+                stream.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(length));
+                return stream.gcount() == static_cast<std::streamsize>(length);
+            }
+#else
+            bool IsOpen() const
+            {
+                return m_fd >= 0;
+            }
+
+            bool ReadAt(uint64_t offset, unsigned char* buffer, size_t length) const
+            {
+                size_t totalRead = 0;
+                while (totalRead < length)
+                {
+                    ssize_t bytesRead = pread(m_fd, buffer + totalRead, length - totalRead, static_cast<off_t>(offset + totalRead));
+                    if (bytesRead < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+                    if (bytesRead <= 0)
+                    {
+                        return false;
+                    }
+                    totalRead += static_cast<size_t>(bytesRead);
+                }
+                return true;
+            }
+#endif
+
+        private:
+#ifdef _WIN32
+            Aws::String m_fileName;
+#else
+            int m_fd;
+#endif
+        };
+
+        /**
+         * A byte range of a file mapped into memory. It is used in place of a transfer buffer, so a part is sent straight from, or received
+         * straight into, the page cache of the file.
+         */
+        class MappedFileRegion : public Aws::Utils::Array<uint8_t>
+        {
+        public:
+#ifdef _WIN32
+            MappedFileRegion(int, uint64_t, size_t, bool) {}
+
+            bool IsMapped() const
+            {
+                return false;
+            }
+#else
+            MappedFileRegion(int fd, uint64_t offset, size_t length, bool writable) : m_mapping(MAP_FAILED), m_mappingLength(0)
+            {
+                // mmap only takes page aligned offsets, so map from the start of the page and skip what precedes the range.
+                static const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+                uint64_t alignedOffset = offset - offset % pageSize;
+                size_t leadingBytes = static_cast<size_t>(offset - alignedOffset);
+                m_mappingLength = length + leadingBytes;
+                if (length == 0)
+                {
+                    return;
+                }
+
+                m_mapping = mmap(nullptr, m_mappingLength, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, static_cast<off_t>(alignedOffset));
+                if (m_mapping == MAP_FAILED)
+                {
+                    return;
+                }
+
+                // parts are streamed front to back; for uploads also start reading the range ahead of the request.
+                madvise(m_mapping, m_mappingLength, MADV_SEQUENTIAL);
+                if (!writable)
+                {
+                    madvise(m_mapping, m_mappingLength, MADV_WILLNEED);
+                }
+
+                m_size = length;
+                m_data.reset(static_cast<uint8_t*>(m_mapping) + leadingBytes);
+            }
+
+            ~MappedFileRegion()
+            {
+                // the memory belongs to the mapping, not to the allocator Array would return it to.
+                m_data.release();
+                if (m_mapping != MAP_FAILED)
+                {
+                    munmap(m_mapping, m_mappingLength);
+                }
+            }
+
+            bool IsMapped() const
+            {
+                return m_mapping != MAP_FAILED;
+            }
+
+        private:
+            void* m_mapping;
+            size_t m_mappingLength;
+#endif
+        };
+
+        /**
+         * What tells the target file of a download apart from another file put in its place between two runs.
+         */
+        struct TargetFileIdentity
+        {
+            uint64_t device;
+            uint64_t inode;
+            uint64_t size;
+            uint64_t modifiedSeconds;
+        };
+
+#ifndef _WIN32
+        static TargetFileIdentity MakeTargetFileIdentity(const struct stat& fileStat)
+        {
+            TargetFileIdentity identity;
+            identity.device = static_cast<uint64_t>(fileStat.st_dev);
+            identity.inode = static_cast<uint64_t>(fileStat.st_ino);
+            identity.size = static_cast<uint64_t>(fileStat.st_size);
+            identity.modifiedSeconds = static_cast<uint64_t>(fileStat.st_mtime);
+            return identity;
+        }
+
+        /**
+         * Identity of the file at fileName, false if there is none.
+         */
+        static bool GetTargetFileIdentity(const Aws::String& fileName, TargetFileIdentity& identity)
+        {
+            struct stat fileStat;
+            if (stat(fileName.c_str(), &fileStat) != 0)
+            {
+                return false;
+            }
+            identity = MakeTargetFileIdentity(fileStat);
+            return true;
+        }
+#endif
+
+        /**
+         * A file whose parts are transferred in place, through MappedFileRegions or positional writes. Opened read only for uploads, or for downloads
+         * read/write and resized to the size of the object without discarding what is already in it. Neither is implemented on Windows, where
+         * the file never opens and the regular buffers are used.
+         */
+        class PartFile
+        {
+        public:
+#ifdef _WIN32
+            PartFile(const Aws::String&, bool, uint64_t) {}
+
+            bool IsOpen() const
+            {
+                return false;
+            }
+#else
+            PartFile(const Aws::String& fileName, bool writable, uint64_t size) :
+                m_fd(open(fileName.c_str(), writable ? O_RDWR | O_CREAT | O_CLOEXEC : O_RDONLY | O_CLOEXEC, 0666)),
+                m_writable(writable)
+            {
+                if (m_fd >= 0 && writable && !Resize(size))
+                {
+                    close(m_fd);
+                    m_fd = -1;
+                }
+            }
+
+            ~PartFile()
+            {
+                if (m_fd >= 0)
+                {
+                    close(m_fd);
+                }
+            }
+
+            bool IsOpen() const
+            {
+                return m_fd >= 0;
+            }
+#endif
+
+            PartFile(const PartFile&) = delete;
+            PartFile& operator=(const PartFile&) = delete;
+
+            /**
+             * Maps length bytes starting at offset. Returns nullptr if the range couldn't be mapped. The mapping stays valid after the file is closed.
+             */
+            std::shared_ptr<MappedFileRegion> Map(uint64_t offset, size_t length) const
+            {
+#ifdef _WIN32
+                AWS_UNREFERENCED_PARAM(offset);
+                AWS_UNREFERENCED_PARAM(length);
+                return nullptr;
+#else
+                auto region = Aws::MakeShared<MappedFileRegion>(CLASS_TAG, m_fd, offset, length, m_writable);
+                return region->IsMapped() ? region : nullptr;
+#endif
+            }
+
+            /**
+             * Writes length bytes of data at offset, independently of any other write in flight. Returns false if not all of it could be written.
+             */
+            bool WriteAt(uint64_t offset, const char* data, size_t length) const
+            {
+#ifdef _WIN32
+                AWS_UNREFERENCED_PARAM(offset);
+                AWS_UNREFERENCED_PARAM(data);
+                AWS_UNREFERENCED_PARAM(length);
+                return false;
+#else
+                size_t totalWritten = 0;
+                while (totalWritten < length)
+                {
+                    ssize_t bytesWritten = pwrite(m_fd, data + totalWritten, length - totalWritten, static_cast<off_t>(offset + totalWritten));
+                    if (bytesWritten < 0 && errno == EINTR)
+                    {
+                        continue;
+                    }
+                    if (bytesWritten <= 0)
+                    {
+                        return false;
+                    }
+                    totalWritten += static_cast<size_t>(bytesWritten);
+                }
+                return true;
+#endif
+            }
+
+            /**
+             * Identity of the open file, false if it can't be read.
+             */
+            bool GetIdentity(TargetFileIdentity& identity) const
+            {
+#ifdef _WIN32
+                AWS_UNREFERENCED_PARAM(identity);
+                return false;
+#else
+                struct stat fileStat;
+                if (fstat(m_fd, &fileStat) != 0)
+                {
+                    return false;
+                }
+                identity = MakeTargetFileIdentity(fileStat);
+                return true;
+#endif
+            }
+
+            /**
+             * Blocks until everything written so far is on disk.
+             */
+            bool Sync() const
+            {
+#ifdef _WIN32
+                return false;
+#elif defined(__APPLE__)
+                return fsync(m_fd) == 0;
+#else
+                return fdatasync(m_fd) == 0;
+#endif
+            }
+
+#ifndef _WIN32
+        private:
+            bool Resize(uint64_t size)
+            {
+                if (ftruncate(m_fd, static_cast<off_t>(size)) != 0)
+                {
+                    return false;
+                }
+#if defined(__linux__)
+                // Writing to a mapped page the file system has no room for raises SIGBUS, so reserve the space up front.
+                // File systems that can't preallocate report EOPNOTSUPP, which is fine.
+                int result = posix_fallocate(m_fd, 0, static_cast<off_t>(size));
+                return result == 0 || result == EOPNOTSUPP || result == EINVAL;
+#else
+                return true;
+#endif
+            }
+
+            int m_fd;
+            bool m_writable;
+#endif
+        };
+
+        /**
+         * Stream buffer that writes a downloaded part straight to its range of the target file as the data arrives.
+         */
+        class PositionalWriteStreamBuf : public std::streambuf
+        {
+        public:
+            PositionalWriteStreamBuf(const std::shared_ptr<PartFile>& file, uint64_t offset, size_t length) :
+                m_file(file), m_offset(offset), m_length(length), m_written(0), m_failed(false)
+            {
+            }
+
+            /**
+             * True once exactly the part's length has been written without errors.
+             */
+            bool IsComplete() const
+            {
+                return !m_failed && m_written == m_length;
+            }
+
+        protected:
+            std::streamsize xsputn(const char* s, std::streamsize n) override
+            {
+                size_t length = static_cast<size_t>(n);
+                if (m_failed || length > m_length - m_written || !m_file->WriteAt(m_offset + m_written, s, length))
+                {
+                    m_failed = true;
+                    return 0;
+                }
+                m_written += length;
+                return n;
+            }
+
+            int_type overflow(int_type ch) override
+            {
+                if (traits_type::eq_int_type(ch, traits_type::eof()))
+                {
+                    return traits_type::not_eof(ch);
+                }
+                char c = traits_type::to_char_type(ch);
+                return xsputn(&c, 1) == 1 ? ch : traits_type::eof();
+            }
+
+        private:
+            std::shared_ptr<PartFile> m_file;
+            uint64_t m_offset;
+            size_t m_length;
+            size_t m_written;
+            bool m_failed;
+        };
+
+        static const char DOWNLOAD_STATE_FILE_SUFFIX[] = ".s3download";
+        static const char DOWNLOAD_STATE_FILE_MAGIC[] = "AWS-TRANSFER-DOWNLOAD-STATE 2";
+        // Parts written since the last checkpoint are synced and recorded together once this much of them is waiting.
+        static const uint64_t DOWNLOAD_STATE_CHECKPOINT_BYTES = 64 * 1024 * 1024;
+
+        /**
+         * Bitmap of the parts of a download that are safely on disk, kept in a small file next to the target file. The header records the
+         * object size, part size and ETag, so the bitmap is only reused for the same object split the same way.
+         * Written parts are recorded at checkpoints: the target file is synced once and then the bits of every part written before the sync
+         * are set, so after a crash every part marked done really is in the file, without syncing the file for every part.
+         * Each checkpoint also records the identity of the target file, and the bitmap is only reused for that same file: a target deleted,
+         * truncated or replaced since would otherwise be recreated with the parts marked done full of zeros.
+         */
+        class DownloadStateFile
+        {
+        public:
+            /**
+             * Opens the state file for fileName, keeping its bitmap if it describes the same download into the same file, otherwise starting over
+             * with no completed parts. existingTarget is the identity fileName had before the download opened it, null if there was no such file.
+             * Returns nullptr if the state file can't be written.
+             */
+            static std::shared_ptr<DownloadStateFile> Open(const Aws::String& fileName, const TargetFileIdentity* existingTarget, uint64_t objectSize,
+                uint64_t partSize, const Aws::String& eTag, size_t partCount)
+            {
+#ifdef _WIN32
+                AWS_UNREFERENCED_PARAM(fileName);
+                AWS_UNREFERENCED_PARAM(existingTarget);
+                AWS_UNREFERENCED_PARAM(objectSize);
+                AWS_UNREFERENCED_PARAM(partSize);
+                AWS_UNREFERENCED_PARAM(eTag);
+                AWS_UNREFERENCED_PARAM(partCount);
+                return nullptr;
+#else
+                Aws::String stateFileName = fileName + DOWNLOAD_STATE_FILE_SUFFIX;
+                int fd = open(stateFileName.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+                if (fd < 0)
+                {
+                    return nullptr;
+                }
+
+                Aws::StringStream headerStream;
+                headerStream << DOWNLOAD_STATE_FILE_MAGIC << "\n" << objectSize << "\n" << partSize << "\n" << eTag << "\n";
+                auto state = Aws::MakeShared<DownloadStateFile>(CLASS_TAG, stateFileName, fd, headerStream.str(), (partCount + 7) / 8);
+                if (!state->Load(existingTarget) && !state->Reset())
+                {
+                    return nullptr;
+                }
+                return state;
+#endif
+            }
+
+            DownloadStateFile(const Aws::String& stateFileName, int fd, const Aws::String& header, size_t bitmapLength) :
+                m_stateFileName(stateFileName), m_fd(fd), m_header(header), m_bitmap(bitmapLength, 0), m_writtenBytes(0)
+            {
+                memset(&m_targetIdentity, 0, sizeof(m_targetIdentity));
+            }
+
+            ~DownloadStateFile()
+            {
+#ifndef _WIN32
+                if (m_fd >= 0)
+                {
+                    close(m_fd);
+                }
+#endif
+            }
+
+            DownloadStateFile(const DownloadStateFile&) = delete;
+            DownloadStateFile& operator=(const DownloadStateFile&) = delete;
+
+            bool IsPartCompleted(int partId) const
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                size_t index = static_cast<size_t>(partId - 1);
+                return (m_bitmap[index / 8] & (1 << (index % 8))) != 0;
+            }
+
+            /**
+             * Notes that partId has been written to targetFile. It is recorded at the next checkpoint, which this call makes itself once
+             * DOWNLOAD_STATE_CHECKPOINT_BYTES of parts are waiting for one.
+             */
+            void MarkPartWritten(int partId, uint64_t bytes, const PartFile& targetFile)
+            {
+                bool checkpoint = false;
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    m_writtenParts.push_back(partId);
+                    m_writtenBytes += bytes;
+                    checkpoint = m_writtenBytes >= DOWNLOAD_STATE_CHECKPOINT_BYTES;
+                }
+                if (checkpoint)
+                {
+                    Checkpoint(targetFile);
+                }
+            }
+
+            /**
+             * Syncs targetFile and records every part written before the call as completed.
+             */
+            void Checkpoint(const PartFile& targetFile)
+            {
+#ifndef _WIN32
+                // a checkpoint finding nothing left to record must still wait for the one recording it.
+                std::lock_guard<std::mutex> checkpointLocker(m_checkpointLock);
+                Aws::Vector<int> writtenParts;
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    writtenParts.swap(m_writtenParts);
+                    m_writtenBytes = 0;
+                }
+                if (writtenParts.empty())
+                {
+                    return;
+                }
+
+                // Parts written while syncing wait for the next checkpoint, the sync doesn't necessarily cover them.
+                TargetFileIdentity targetIdentity;
+                if (!targetFile.Sync() || !targetFile.GetIdentity(targetIdentity))
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "Failed to sync download to [" << m_stateFileName << "], " << writtenParts.size()
+                            << " parts won't be recorded as completed.");
+                    return;
+                }
+
+                std::lock_guard<std::mutex> locker(m_lock);
+                for (int partId : writtenParts)
+                {
+                    size_t index = static_cast<size_t>(partId - 1);
+                    m_bitmap[index / 8] |= static_cast<unsigned char>(1 << (index % 8));
+                }
+                m_targetIdentity = targetIdentity;
+                // A lost update only means the parts are downloaded again.
+                Aws::Vector<char> record(sizeof(m_targetIdentity) + m_bitmap.size());
+                memcpy(record.data(), &m_targetIdentity, sizeof(m_targetIdentity));
+                std::copy(m_bitmap.begin(), m_bitmap.end(), record.begin() + sizeof(m_targetIdentity));
+                if (pwrite(m_fd, record.data(), record.size(), static_cast<off_t>(m_header.size())) != static_cast<ssize_t>(record.size()))
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "Failed to record " << writtenParts.size() << " parts in download state file [" << m_stateFileName << "].");
+                }
+#else
+                AWS_UNREFERENCED_PARAM(targetFile);
+#endif
+            }
+
+            /**
+             * Deletes the state file once the download has completed.
+             */
+            void Remove()
+            {
+#ifndef _WIN32
+                std::lock_guard<std::mutex> locker(m_lock);
+                unlink(m_stateFileName.c_str());
+#endif
+            }
+
+        private:
+#ifndef _WIN32
+            bool Load(const TargetFileIdentity* existingTarget)
+            {
+                Aws::Vector<char> contents(m_header.size() + sizeof(m_targetIdentity) + m_bitmap.size());
+                ssize_t bytesRead = pread(m_fd, contents.data(), contents.size(), 0);
+                if (bytesRead != static_cast<ssize_t>(contents.size()) || m_header.compare(0, m_header.size(), contents.data(), m_header.size()) != 0)
+                {
+                    return false;
+                }
+                memcpy(&m_targetIdentity, contents.data() + m_header.size(), sizeof(m_targetIdentity));
+                std::copy(contents.begin() + m_header.size() + sizeof(m_targetIdentity), contents.end(), m_bitmap.begin());
+                if (std::all_of(m_bitmap.begin(), m_bitmap.end(), [](unsigned char bits) { return bits == 0; }))
+                {
+                    return true;
+                }
+
+                // Parts written after the last checkpoint move the modification time forward, so only an older one means another file.
+                bool sameTarget = existingTarget && existingTarget->device == m_targetIdentity.device && existingTarget->inode == m_targetIdentity.inode &&
+                    existingTarget->size == m_targetIdentity.size && existingTarget->modifiedSeconds >= m_targetIdentity.modifiedSeconds;
+                if (!sameTarget)
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "The target file of download state file [" << m_stateFileName
+                            << "] changed since it was last recorded, starting the download over.");
+                    std::fill(m_bitmap.begin(), m_bitmap.end(), static_cast<unsigned char>(0));
+                    memset(&m_targetIdentity, 0, sizeof(m_targetIdentity));
+                }
+                return sameTarget;
+            }
+
+            bool Reset()
+            {
+                Aws::Vector<char> contents(m_header.begin(), m_header.end());
+                contents.resize(m_header.size() + sizeof(m_targetIdentity) + m_bitmap.size(), 0);
+                return ftruncate(m_fd, 0) == 0 &&
+                    pwrite(m_fd, contents.data(), contents.size(), 0) == static_cast<ssize_t>(contents.size());
+            }
+#endif
+
+            Aws::String m_stateFileName;
+            int m_fd;
+            Aws::String m_header;
+            Aws::Vector<unsigned char> m_bitmap;
+            // recorded right after the bitmap's header, before the bitmap.
+            TargetFileIdentity m_targetIdentity;
+            // parts written since the last checkpoint.
+            Aws::Vector<int> m_writtenParts;
+            uint64_t m_writtenBytes;
+            mutable std::mutex m_lock;
+            std::mutex m_checkpointLock;
+        };
+
+        /**
+         * Bounds the number of parts of one upload that are being read at the same time.
+         */
+        class PartReadWindow
+        {
+        public:
+            PartReadWindow(size_t depth) : m_depth(depth > 0 ? depth : 1), m_inFlight(0) {}
+
+            void Acquire()
+            {
+                std::unique_lock<std::mutex> locker(m_lock);
+                m_signal.wait(locker, [this] { return m_inFlight < m_depth; });
+                ++m_inFlight;
+            }
+
+            void Release()
+            {
+                {
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    --m_inFlight;
+                }
+                m_signal.notify_one();
+            }
+
+        private:
+            size_t m_depth;
+            size_t m_inFlight;
+            std::mutex m_lock;
+            std::condition_variable m_signal;
         };
 
         std::shared_ptr<TransferManager> TransferManager::Create(const TransferManagerConfiguration& config)
@@ -108,31 +916,46 @@ namespace Aws
                                                                       const DownloadConfiguration& downloadConfig,
                                                                       const Aws::String& writeToFile,
                                                                       const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+        {
+            return DoDownloadFile(bucketName, keyName, writeToStreamfn, downloadConfig, writeToFile, context, false);
+        }
+
+        std::shared_ptr<TransferHandle> TransferManager::DoDownloadFile(const Aws::String& bucketName,
+                                                                        const Aws::String& keyName,
+                                                                        CreateDownloadStreamCallback writeToStreamfn,
+                                                                        const DownloadConfiguration& downloadConfig,
+                                                                        const Aws::String& writeToFile,
+                                                                        const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context,
+                                                                        bool downloadingToFile)
         {
             auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, bucketName, keyName, writeToStreamfn, writeToFile);
             handle->ApplyDownloadConfiguration(downloadConfig);
             handle->SetContext(context);
+            handle->SetDownloadingToFile(downloadingToFile);
 
             auto self = shared_from_this();
             m_transferConfig.transferExecutor->Submit([self, handle] { self->DoDownload(handle); });
             return handle;
         }
 
+        static CreateDownloadStreamCallback CreateFileDownloadStreamCallback(const Aws::String& writeToFile)
+        {
+#ifdef _MSC_VER
+            return [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, Aws::Utils::StringUtils::ToWString(writeToFile.c_str()).c_str(),
+                                                        std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
+#else
+            return [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, writeToFile.c_str(),
+                                                        std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
+#endif
+        }
+
         std::shared_ptr<TransferHandle> TransferManager::DownloadFile(const Aws::String& bucketName, 
                                                                       const Aws::String& keyName, 
                                                                       const Aws::String& writeToFile, 
                                                                       const DownloadConfiguration& downloadConfig,
                                                                       const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
         {
-#ifdef _MSC_VER
-            auto createFileFn = [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, Aws::Utils::StringUtils::ToWString(writeToFile.c_str()).c_str(),
-                                                                     std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
-#else
-            auto createFileFn = [=]() { return Aws::New<Aws::FStream>(CLASS_TAG, writeToFile.c_str(),
-                                                                     std::ios_base::out | std::ios_base::in | std::ios_base::binary | std::ios_base::trunc);};
-#endif
-
-            return DownloadFile(bucketName, keyName, createFileFn, downloadConfig, writeToFile, context);
+            return DoDownloadFile(bucketName, keyName, CreateFileDownloadStreamCallback(writeToFile), downloadConfig, writeToFile, context, true);
         }
 
         std::shared_ptr<TransferHandle> TransferManager::RetryUpload(const Aws::String& fileName, const std::shared_ptr<TransferHandle>& retryHandle)
@@ -200,13 +1023,30 @@ namespace Aws
             m_transferConfig.transferExecutor->Submit([self, inProgressHandle] { self->WaitForCancellationAndAbortUpload(inProgressHandle); });
         }
 
-        void TransferManager::UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata)
+        std::shared_ptr<DirectoryTransfer> TransferManager::UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata)
         {
             assert(m_transferConfig.transferInitiatedCallback);
 
+            auto directoryTransfer = Aws::MakeShared<DirectoryTransfer>(CLASS_TAG, TransferDirection::UPLOAD, directory, bucketName, prefix, m_transferConfig.maxFilesInFlight);
             auto self = shared_from_this();
-            auto visitor = [self, bucketName, prefix, metadata](const Aws::FileSystem::DirectoryTree*, const Aws::FileSystem::DirectoryEntry& entry)
+            m_transferConfig.transferExecutor->Submit([self, directoryTransfer, metadata]() { self->DoUploadDirectory(directoryTransfer, metadata); });
+            return directoryTransfer;
+        }
+
+        void TransferManager::DoUploadDirectory(const std::shared_ptr<DirectoryTransfer>& directoryTransfer, const Aws::Map<Aws::String, Aws::String>& metadata)
+        {
+            const auto& bucketName = directoryTransfer->GetBucketName();
+            const auto& prefix = directoryTransfer->GetPrefix();
+
+            UploadDirectoryListing existingObjects(m_transferConfig.s3Client, bucketName, m_transferConfig.customizedAccessLogTag);
+
+            auto visitor = [&](const Aws::FileSystem::DirectoryTree*, const Aws::FileSystem::DirectoryEntry& entry)
             {
+                if (!directoryTransfer->ShouldContinue())
+                {
+                    return false;
+                }
+
                 if (entry && entry.fileType == Aws::FileSystem::FileType::File)
                 {
                     Aws::StringStream ssKey;
@@ -216,19 +1056,46 @@ namespace Aws
 
                     ssKey << prefix << "/" << relativePath;
                     Aws::String keyName = ssKey.str();
+
+                    const ObjectSummary* existingObject = m_transferConfig.unchangedFileCheck == UnchangedFileCheck::NONE ? nullptr : existingObjects.Find(keyName);
+                    if (existingObject && IsUnchangedFile(m_transferConfig.unchangedFileCheck, entry.path, *existingObject, TransferDirection::UPLOAD))
+                    {
+                        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Skipping unchanged file: " << entry.path << " as part of directory upload to S3 Bucket: ["
+                                << bucketName << "] and Key: [" << keyName << "].");
+                        SkipUnchangedFile(Aws::MakeShared<TransferHandle>(CLASS_TAG, bucketName, keyName, static_cast<uint64_t>(entry.fileSize), entry.path),
+                                directoryTransfer);
+                        return true;
+                    }
+
+                    if (!directoryTransfer->AcquireFileSlot())
+                    {
+                        return false;
+                    }
+
                     AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Uploading file: " << entry.path
                             << " as part of directory upload to S3 Bucket: [" << bucketName << "] and Key: ["
                             << keyName << "].");
-                    self->m_transferConfig.transferInitiatedCallback(self.get(), self->UploadFile(entry.path, bucketName, keyName, DEFAULT_CONTENT_TYPE, metadata));
+                    auto handle = CreateUploadFileHandle(entry.path, bucketName, keyName, DEFAULT_CONTENT_TYPE, metadata, nullptr);
+                    TrackDirectoryFile(handle, directoryTransfer);
+                    m_transferConfig.transferInitiatedCallback(this, SubmitUpload(handle));
                 }
 
                 return true;
             };
 
-            m_transferConfig.transferExecutor->Submit([directory, visitor]() { Aws::FileSystem::DirectoryTree dir(directory); dir.TraverseDepthFirst(visitor); });
+            Aws::FileSystem::DirectoryTree directoryTree(directoryTransfer->GetDirectory());
+            if (directoryTree)
+            {
+                directoryTree.TraverseDepthFirst(visitor);
+            }
+            else
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Could not open directory: " << directoryTransfer->GetDirectory() << " for upload to bucket: " << bucketName);
+            }
+            directoryTransfer->OnTraversalFinished(directoryTree);
         }
 
-        void TransferManager::DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix)
+        std::shared_ptr<DirectoryTransfer> TransferManager::DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix)
         {
             assert(m_transferConfig.transferInitiatedCallback);
             Aws::FileSystem::CreateDirectoryIfNotExists(directory.c_str());
@@ -243,11 +1110,14 @@ namespace Aws
             request.WithBucket(bucketName)
                 .WithPrefix(prefix);
 
+            auto directoryTransfer = Aws::MakeShared<DirectoryTransfer>(CLASS_TAG, TransferDirection::DOWNLOAD, directory, bucketName, prefix, m_transferConfig.maxFilesInFlight);
             auto context = Aws::MakeShared<DownloadDirectoryContext>(CLASS_TAG);
             context->rootDirectory = directory;
             context->prefix = prefix;
+            context->directoryTransfer = directoryTransfer;
 
             m_transferConfig.s3Client->ListObjectsV2Async(request, handler, context);
+            return directoryTransfer;
         }
 
         void TransferManager::DoMultiPartUpload(const std::shared_ptr<TransferHandle>& handle)
@@ -283,17 +1153,21 @@ namespace Aws
                 {
                     handle->SetMultipartId(createMultipartResponse.GetResult().GetUploadId());
                     uint64_t totalSize = handle->GetBytesTotalSize();
-                    uint64_t partCount = ( totalSize + m_transferConfig.bufferSize - 1 ) / m_transferConfig.bufferSize;
+                    uint64_t partSize = ComputePartSize(totalSize);
+                    uint64_t partCount = ( totalSize + partSize - 1 ) / partSize;
+                    handle->SetPartSize(partSize);
                     AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Transfer handle [" << handle->GetId()
                             << "] Successfully created a multi-part upload request. Upload ID: ["
                             << createMultipartResponse.GetResult().GetUploadId()
-                            << "]. Splitting the multi-part upload to " << partCount << " part(s).");
+                            << "]. Splitting the multi-part upload to " << partCount << " part(s) of " << partSize << " bytes.");
 
                     for (uint64_t i = 0; i < partCount; ++i)
                     {
-                        uint64_t partSize = (std::min)(totalSize - i * m_transferConfig.bufferSize, m_transferConfig.bufferSize);
+                        uint64_t sizeOfPart = (std::min)(totalSize - i * partSize, partSize);
                         bool lastPart = (i == partCount - 1) ? true : false;
-                        handle->AddQueuedPart(Aws::MakeShared<PartState>(CLASS_TAG, static_cast<int>(i + 1), 0, static_cast<size_t>(partSize), lastPart));
+                        auto partState = Aws::MakeShared<PartState>(CLASS_TAG, static_cast<int>(i + 1), 0, static_cast<size_t>(sizeOfPart), lastPart);
+                        partState->SetRangeBegin(static_cast<size_t>(i * partSize));
+                        handle->AddQueuedPart(partState);
                     }
                 }
                 else
@@ -335,54 +1209,105 @@ namespace Aws
             handle->UpdateStatus(TransferStatus::IN_PROGRESS);
             TriggerTransferStatusUpdatedCallback(handle);
 
+            std::shared_ptr<PartFile> mappedFile;
+            if (m_transferConfig.useMemoryMappedFiles && !handle->GetTargetFilePath().empty())
+            {
+                mappedFile = Aws::MakeShared<PartFile>(CLASS_TAG, handle->GetTargetFilePath(), false, handle->GetBytesTotalSize());
+                if (!mappedFile->IsOpen())
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Could not open file ["
+                            << handle->GetTargetFilePath() << "] for memory mapping, reading parts into transfer buffers.");
+                    mappedFile = nullptr;
+                }
+            }
+            ConfigureConcurrencyControl(handle, mappedFile == nullptr);
 
-            while (sentBytes < handle->GetBytesTotalSize() && handle->ShouldContinue() && partsIter != queuedParts.end())
+            std::shared_ptr<PartFileReader> fileReader;
+            std::shared_ptr<PartReadWindow> readWindow;
+            if (!mappedFile && m_transferConfig.partReadExecutor && !handle->GetTargetFilePath().empty())
             {
-                auto buffer = m_bufferManager.Acquire();
-                if(handle->ShouldContinue())
+                fileReader = Aws::MakeShared<PartFileReader>(CLASS_TAG, handle->GetTargetFilePath());
+                if (fileReader->IsOpen())
+                {
+                    readWindow = Aws::MakeShared<PartReadWindow>(CLASS_TAG, m_transferConfig.partReadQueueDepth);
+                }
+                else
                 {
-                    auto lengthToWrite = partsIter->second->GetSizeInBytes();
-                    streamToPut->seekg((partsIter->first - 1) * m_transferConfig.bufferSize);
-                    streamToPut->read((char*)buffer->GetUnderlyingData(), lengthToWrite);
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Could not open file ["
+                            << handle->GetTargetFilePath() << "] for positional reads, reading parts sequentially.");
+                    fileReader = nullptr;
+                }
+            }
 
-                    auto streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, static_cast<size_t>(lengthToWrite));
-                    auto preallocatedStreamReader = Aws::MakeShared<Aws::IOStream>(CLASS_TAG, streamBuf);
+            while (sentBytes < handle->GetBytesTotalSize() && partsIter != queuedParts.end() && handle->AcquirePartSlot())
+            {
+                auto lengthToWrite = partsIter->second->GetSizeInBytes();
+                auto mappedRegion = mappedFile ? mappedFile->Map(partsIter->second->GetRangeBegin(), lengthToWrite) : nullptr;
+                if (mappedRegion)
+                {
+                    // the part is sent straight out of the page cache, no transfer buffer and no read into it.
+                    handle->AddPendingPart(partsIter->second);
+                    SubmitUploadPart(handle, partsIter->second, mappedRegion.get(), mappedRegion);
+                    sentBytes += lengthToWrite;
+                    ++partsIter;
+                    continue;
+                }
+                else if (mappedFile)
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Could not map part ["
+                            << partsIter->first << "] of file [" << handle->GetTargetFilePath() << "], reading it into a transfer buffer.");
+                }
 
-                    auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
+                auto buffer = AcquirePartBuffer(lengthToWrite);
+                if(handle->ShouldContinue())
+                {
+                    uint64_t partOffset = partsIter->second->GetRangeBegin();
                     PartPointer partPtr = partsIter->second;
-                    Aws::S3::Model::UploadPartRequest uploadPartRequest = m_transferConfig.uploadPartTemplate;
-                    uploadPartRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
-                    uploadPartRequest.SetContinueRequestHandler([handle](const Aws::Http::HttpRequest*) { return handle->ShouldContinue(); });
-                    uploadPartRequest.SetDataSentEventHandler([self, handle, partPtr](const Aws::Http::HttpRequest*, long long amount){ partPtr->OnDataTransferred(amount, handle); self->TriggerUploadProgressCallback(handle); });
-                    uploadPartRequest.SetRequestRetryHandler([partPtr](const AmazonWebServiceRequest&){ partPtr->Reset(); });
-                    uploadPartRequest.WithBucket(handle->GetBucketName())
-                        .WithContentLength(static_cast<long long>(lengthToWrite))
-                        .WithKey(handle->GetKey())
-                        .WithPartNumber(partsIter->first)
-                        .WithUploadId(handle->GetMultiPartId());
 
-                    handle->AddPendingPart(partsIter->second);
-
-                    uploadPartRequest.SetBody(preallocatedStreamReader);
-                    uploadPartRequest.SetContentType(handle->GetContentType());
-                    auto asyncContext = Aws::MakeShared<TransferHandleAsyncContext>(CLASS_TAG);
-                    asyncContext->handle = handle;
-                    asyncContext->partState = partsIter->second;
+                    handle->AddPendingPart(partPtr);
 
-                    auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::UploadPartRequest& request,
-                        const Aws::S3::Model::UploadPartOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+                    if (fileReader)
                     {
-                        self->HandleUploadPartResponse(client, request, outcome, context);
-                    };
+                        // Reads of different parts overlap each other and the uploads already in flight.
+                        readWindow->Acquire();
+                        auto self = shared_from_this();
+                        m_transferConfig.partReadExecutor->Submit([self, handle, partPtr, buffer, partOffset, fileReader, readWindow]
+                        {
+                            bool readSucceeded = fileReader->ReadAt(partOffset, buffer->GetUnderlyingData(), partPtr->GetSizeInBytes());
+                            readWindow->Release();
+                            if (readSucceeded)
+                            {
+                                self->SubmitUploadPart(handle, partPtr, buffer);
+                                return;
+                            }
+
+                            AWS_LOGSTREAM_ERROR(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Failed to read part ["
+                                    << partPtr->GetPartId() << "] from file [" << handle->GetTargetFilePath() << "].");
+                            self->ReleasePartBuffer(buffer);
+                            handle->ReleasePartSlot(partPtr->GetSizeInBytes(), std::chrono::milliseconds(0), false);
+                            Aws::Client::AWSError<Aws::S3::S3Errors> error(Aws::S3::S3Errors::INTERNAL_FAILURE, "ReadFailed", "Failed to read part from file.", false);
+                            handle->ChangePartToFailed(partPtr);
+                            handle->SetError(error);
+                            self->TriggerErrorCallback(handle, error);
+                            self->TriggerTransferStatusUpdatedCallback(handle);
+                            self->CompleteMultiPartUploadIfDone(handle);
+                        });
+                    }
+                    else
+                    {
+                        streamToPut->seekg(partOffset);
+                        streamToPut->read((char*)buffer->GetUnderlyingData(), lengthToWrite);
+                        SubmitUploadPart(handle, partPtr, buffer);
+                    }
 
-                    m_transferConfig.s3Client->UploadPartAsync(uploadPartRequest, callback, asyncContext);
                     sentBytes += lengthToWrite;
 
                     ++partsIter;
                 }
                 else
                 {
-                    m_bufferManager.Release(buffer);
+                    ReleasePartBuffer(buffer);
+                    handle->ReleasePartSlot(0, std::chrono::milliseconds(0), false);
                 }
             }
             //parts get moved from queued to pending on this thread.
@@ -411,12 +1336,58 @@ namespace Aws
 #endif
         }
 
+        void TransferManager::SubmitUploadPart(const std::shared_ptr<TransferHandle>& handle, const PartPointer& partState, Aws::Utils::Array<uint8_t>* buffer,
+                const std::shared_ptr<Aws::Utils::Array<uint8_t>>& mappedRegion)
+        {
+            auto lengthToWrite = partState->GetSizeInBytes();
+            auto streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, static_cast<size_t>(lengthToWrite));
+            auto preallocatedStreamReader = Aws::MakeShared<Aws::IOStream>(CLASS_TAG, streamBuf);
+
+            auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
+            PartPointer partPtr = partState;
+            Aws::S3::Model::UploadPartRequest uploadPartRequest = m_transferConfig.uploadPartTemplate;
+            uploadPartRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
+            uploadPartRequest.SetContinueRequestHandler([handle](const Aws::Http::HttpRequest*) { return handle->ShouldContinue(); });
+            uploadPartRequest.SetDataSentEventHandler([self, handle, partPtr](const Aws::Http::HttpRequest*, long long amount){ partPtr->OnDataTransferred(amount, handle); self->TriggerUploadProgressCallback(handle); });
+            uploadPartRequest.SetRequestRetryHandler([partPtr](const AmazonWebServiceRequest&){ partPtr->Reset(); });
+            uploadPartRequest.WithBucket(handle->GetBucketName())
+                .WithContentLength(static_cast<long long>(lengthToWrite))
+                .WithKey(handle->GetKey())
+                .WithPartNumber(partState->GetPartId())
+                .WithUploadId(handle->GetMultiPartId());
+
+            if (m_transferConfig.computeContentMD5)
+            {
+                // hash the part where it sits in memory, instead of reading it through the stream and rewinding it.
+                Aws::Utils::Crypto::MD5 md5;
+                md5.Update(buffer->GetUnderlyingData(), static_cast<size_t>(lengthToWrite));
+                uploadPartRequest.SetContentMD5(Aws::Utils::HashingUtils::Base64Encode(md5.GetHash().GetResult()));
+            }
+
+            uploadPartRequest.SetBody(preallocatedStreamReader);
+            uploadPartRequest.SetContentType(handle->GetContentType());
+            auto asyncContext = Aws::MakeShared<TransferHandleAsyncContext>(CLASS_TAG);
+            asyncContext->handle = handle;
+            asyncContext->partState = partState;
+            asyncContext->startTime = std::chrono::steady_clock::now();
+            asyncContext->mappedRegion = mappedRegion;
+
+            auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::UploadPartRequest& request,
+                const Aws::S3::Model::UploadPartOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+            {
+                self->HandleUploadPartResponse(client, request, outcome, context);
+            };
+
+            m_transferConfig.s3Client->UploadPartAsync(uploadPartRequest, callback, asyncContext);
+        }
+
         void TransferManager::DoSinglePartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle)
         {
             auto partState = Aws::MakeShared<PartState>(CLASS_TAG, 1, 0, static_cast<size_t>(handle->GetBytesTotalSize()), true);
 
             handle->UpdateStatus(TransferStatus::IN_PROGRESS);
             handle->SetIsMultipart(false);
+            handle->SetPartSize(handle->GetBytesTotalSize());
             handle->AddPendingPart(partState);
             TriggerTransferStatusUpdatedCallback(handle);
 
@@ -476,10 +1447,14 @@ namespace Aws
 
             auto originalStreamBuffer = (Aws::Utils::Stream::PreallocatedStreamBuf*)request.GetBody()->rdbuf();
 
-            m_bufferManager.Release(originalStreamBuffer->GetBuffer());
+            if (!transferContext->mappedRegion)
+            {
+                ReleasePartBuffer(originalStreamBuffer->GetBuffer());
+            }
             Aws::Delete(originalStreamBuffer);
             const auto& handle = transferContext->handle;
             const auto& partState = transferContext->partState;
+            handle->ReleasePartSlot(partState->GetSizeInBytes(), ElapsedSince(transferContext->startTime), outcome.IsSuccess());
 
             if (outcome.IsSuccess())
             {
@@ -517,7 +1492,11 @@ namespace Aws
             }
 
             TriggerTransferStatusUpdatedCallback(handle);
+            CompleteMultiPartUploadIfDone(handle);
+        }
 
+        void TransferManager::CompleteMultiPartUploadIfDone(const std::shared_ptr<TransferHandle>& handle)
+        {
             PartStateMap pendingParts, queuedParts, failedParts, completedParts;
             handle->GetAllPartsTransactional(queuedParts, pendingParts, failedParts, completedParts);
 
@@ -622,7 +1601,8 @@ namespace Aws
             {
                 DownloadConfiguration retryDownloadConfig;
                 retryDownloadConfig.versionId = retryHandle->GetVersionId();
-                return DownloadFile(retryHandle->GetBucketName(), retryHandle->GetKey(), retryHandle->GetCreateDownloadStreamFunction(), retryDownloadConfig, retryHandle->GetTargetFilePath());
+                return DoDownloadFile(retryHandle->GetBucketName(), retryHandle->GetKey(), retryHandle->GetCreateDownloadStreamFunction(), retryDownloadConfig,
+                        retryHandle->GetTargetFilePath(), nullptr, retryHandle->IsDownloadingToFile());
             }
 
             retryHandle->UpdateStatus(TransferStatus::NOT_STARTED);
@@ -700,8 +1680,8 @@ namespace Aws
         bool TransferManager::InitializePartsForDownload(const std::shared_ptr<TransferHandle>& handle)
         {
             bool isRetry = handle->HasParts();
-            size_t bufferSize = static_cast<size_t>(m_transferConfig.bufferSize);
-            if (!isRetry)
+            // objects found by DownloadToDirectory may come with their size and ETag from the listing already.
+            if (!isRetry && handle->GetObjectETag().empty())
             {
                 Aws::S3::Model::HeadObjectRequest headObjectRequest;
                 headObjectRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
@@ -728,25 +1708,31 @@ namespace Aws
                     return false;
                 }
 
-                std::size_t downloadSize = static_cast<size_t>(headObjectOutcome.GetResult().GetContentLength());
-                handle->SetBytesTotalSize(downloadSize);
+                handle->SetBytesTotalSize(static_cast<size_t>(headObjectOutcome.GetResult().GetContentLength()));
                 handle->SetContentType(headObjectOutcome.GetResult().GetContentType());
                 handle->SetMetadata(headObjectOutcome.GetResult().GetMetadata());
                 if(handle->GetVersionId().empty())
                 {
                     handle->SetVersionId(headObjectOutcome.GetResult().GetVersionId());
                 }
+                handle->SetObjectETag(headObjectOutcome.GetResult().GetETag());
+            }
 
+            if (!isRetry)
+            {
+                std::size_t downloadSize = static_cast<size_t>(handle->GetBytesTotalSize());
+                std::size_t partSize = static_cast<size_t>(ComputePartSize(downloadSize));
+                handle->SetPartSize(partSize);
                 // For empty file, we create 1 part here to make downloading behaviors consistent for files with different size.
-                std::size_t partCount = (std::max)((downloadSize + bufferSize - 1) / bufferSize, static_cast<std::size_t>(1));
+                std::size_t partCount = (std::max)((downloadSize + partSize - 1) / partSize, static_cast<std::size_t>(1));
                 handle->SetIsMultipart(partCount > 1);    // doesn't make a difference but let's be accurate
 
                 for(std::size_t i = 0; i < partCount; ++i)
                 {
-                    std::size_t partSize = (i + 1 < partCount ) ? bufferSize : (downloadSize - bufferSize * (partCount - 1));
+                    std::size_t sizeOfPart = (i + 1 < partCount ) ? partSize : (downloadSize - partSize * (partCount - 1));
                     bool lastPart = (i == partCount - 1) ? true : false;
-                    auto partState = Aws::MakeShared<PartState>(CLASS_TAG, static_cast<int>(i + 1), 0, partSize, lastPart);
-                    partState->SetRangeBegin(i * bufferSize);
+                    auto partState = Aws::MakeShared<PartState>(CLASS_TAG, static_cast<int>(i + 1), 0, sizeOfPart, lastPart);
+                    partState->SetRangeBegin(i * partSize);
                     handle->AddQueuedPart(partState);
                 }
             }
@@ -761,8 +1747,29 @@ namespace Aws
             return true;
         }
 
+        /**
+         * Moves the queued parts of handle that state records as already on disk straight to completed. Returns how many there were.
+         */
+        static size_t CompletePartsFromDownloadState(const std::shared_ptr<TransferHandle>& handle, const DownloadStateFile& state)
+        {
+            size_t resumedParts = 0;
+            for (const auto& queuedPart : handle->GetQueuedParts())
+            {
+                const auto& partState = queuedPart.second;
+                if (state.IsPartCompleted(partState->GetPartId()))
+                {
+                    handle->AddPendingPart(partState);
+                    partState->OnDataTransferred(static_cast<long long>(partState->GetSizeInBytes()), handle);
+                    handle->ChangePartToCompleted(partState, handle->GetObjectETag());
+                    ++resumedParts;
+                }
+            }
+            return resumedParts;
+        }
+
         void TransferManager::DoDownload(const std::shared_ptr<TransferHandle>& handle)
         {
+            bool isRetry = handle->HasParts();
             if (!InitializePartsForDownload(handle))
             {
                 return;
@@ -771,7 +1778,6 @@ namespace Aws
             TriggerTransferStatusUpdatedCallback(handle);
 
             bool isMultipart = handle->IsMultipart();
-            size_t bufferSize = static_cast<size_t>(m_transferConfig.bufferSize);
 
             if(!isMultipart)
             {
@@ -780,28 +1786,120 @@ namespace Aws
                 return;
             }
 
+            std::shared_ptr<PartFile> targetFile;
+            std::shared_ptr<DownloadStateFile> downloadState;
+            if (m_transferConfig.enableParallelFileDownloads && handle->IsDownloadingToFile())
+            {
+                uint64_t totalSize = handle->GetBytesTotalSize();
+                // taken before opening the file creates or resizes it.
+                TargetFileIdentity existingTarget = TargetFileIdentity();
+#ifdef _WIN32
+                bool targetExists = false;
+#else
+                bool targetExists = GetTargetFileIdentity(handle->GetTargetFilePath(), existingTarget);
+#endif
+                targetFile = Aws::MakeShared<PartFile>(CLASS_TAG, handle->GetTargetFilePath(), true, totalSize);
+                if (targetFile->IsOpen())
+                {
+                    size_t partCount = static_cast<size_t>((totalSize + handle->GetPartSize() - 1) / handle->GetPartSize());
+                    downloadState = DownloadStateFile::Open(handle->GetTargetFilePath(), targetExists ? &existingTarget : nullptr, totalSize,
+                        handle->GetPartSize(), handle->GetObjectETag(), partCount);
+                    if (!downloadState)
+                    {
+                        AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Could not write download state for file ["
+                                << handle->GetTargetFilePath() << "], the download won't be resumable.");
+                    }
+                    else if (!isRetry)
+                    {
+                        size_t resumedParts = CompletePartsFromDownloadState(handle, *downloadState);
+                        if (resumedParts > 0)
+                        {
+                            AWS_LOGSTREAM_INFO(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Resuming download to file ["
+                                    << handle->GetTargetFilePath() << "], " << resumedParts << " of " << partCount << " parts are already downloaded.");
+                            TriggerDownloadProgressCallback(handle);
+                        }
+                        if (!handle->HasQueuedParts())
+                        {
+                            downloadState->Remove();
+                            handle->UpdateStatus(TransferStatus::COMPLETED);
+                            TriggerTransferStatusUpdatedCallback(handle);
+                            return;
+                        }
+                    }
+                }
+                else
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Could not open file ["
+                            << handle->GetTargetFilePath() << "] for positional writes, downloading parts into transfer buffers.");
+                    targetFile = nullptr;
+                }
+            }
+
+            std::shared_ptr<PartFile> mappedFile;
+            if (!targetFile && m_transferConfig.useMemoryMappedFiles && handle->IsDownloadingToFile())
+            {
+                mappedFile = Aws::MakeShared<PartFile>(CLASS_TAG, handle->GetTargetFilePath(), true, handle->GetBytesTotalSize());
+                if (!mappedFile->IsOpen())
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Could not open file ["
+                            << handle->GetTargetFilePath() << "] for memory mapping, downloading parts into transfer buffers.");
+                    mappedFile = nullptr;
+                }
+            }
+            ConfigureConcurrencyControl(handle, targetFile == nullptr && mappedFile == nullptr);
+
             auto queuedParts = handle->GetQueuedParts();
             auto queuedPartIter = queuedParts.begin();
-            while(queuedPartIter != queuedParts.end() && handle->ShouldContinue())
+            while(queuedPartIter != queuedParts.end() && handle->AcquirePartSlot())
             {
                 const auto& partState = queuedPartIter->second;
-                std::size_t rangeStart = ( partState->GetPartId() - 1 ) * bufferSize;
+                std::size_t rangeStart = partState->GetRangeBegin();
                 std::size_t rangeEnd = rangeStart + partState->GetSizeInBytes() - 1;
-                auto buffer = m_bufferManager.Acquire();
-                partState->SetDownloadBuffer(buffer);
 
-                CreateDownloadStreamCallback responseStreamFunction = [partState, buffer, rangeEnd, rangeStart]() 
-                {                    
-                    auto bufferStream = Aws::New<Aws::Utils::Stream::DefaultUnderlyingStream>(CLASS_TAG, 
-                            Aws::MakeUnique<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, rangeEnd - rangeStart + 1));
-                    partState->SetDownloadPartStream(bufferStream);
-                    return bufferStream;
-                };
+                std::shared_ptr<MappedFileRegion> mappedRegion;
+                if (mappedFile)
+                {
+                    mappedRegion = mappedFile->Map(rangeStart, partState->GetSizeInBytes());
+                    if (!mappedRegion)
+                    {
+                        // the part still goes to its range of the mapped file, written from a transfer buffer once received.
+                        AWS_LOGSTREAM_WARN(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Could not map part ["
+                                << partState->GetPartId() << "] of file [" << handle->GetTargetFilePath() << "], receiving it into a transfer buffer.");
+                    }
+                }
+
+                Aws::Utils::Array<uint8_t>* buffer = nullptr;
+                CreateDownloadStreamCallback responseStreamFunction;
+                if (targetFile)
+                {
+                    // the body goes straight to the part's range of the file, no matter in which order parts arrive.
+                    responseStreamFunction = [partState, targetFile, rangeEnd, rangeStart]()
+                    {
+                        auto fileStream = Aws::New<Aws::Utils::Stream::DefaultUnderlyingStream>(CLASS_TAG,
+                                Aws::MakeUnique<PositionalWriteStreamBuf>(CLASS_TAG, targetFile, rangeStart, rangeEnd - rangeStart + 1));
+                        partState->SetDownloadPartStream(fileStream);
+                        return fileStream;
+                    };
+                }
+                else
+                {
+                    buffer = mappedRegion ? mappedRegion.get() : AcquirePartBuffer(partState->GetSizeInBytes());
+                    if (!mappedRegion)
+                    {
+                        partState->SetDownloadBuffer(buffer);
+                    }
+
+                    responseStreamFunction = [partState, buffer, rangeEnd, rangeStart]() 
+                    {                    
+                        auto bufferStream = Aws::New<Aws::Utils::Stream::DefaultUnderlyingStream>(CLASS_TAG, 
+                                Aws::MakeUnique<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, rangeEnd - rangeStart + 1));
+                        partState->SetDownloadPartStream(bufferStream);
+                        return bufferStream;
+                    };
+                }
 
                 if(handle->ShouldContinue())
                 {
-                    partState->SetDownloadBuffer(buffer);
-
                     Aws::S3::Model::GetObjectRequest getObjectRangeRequest;
                     getObjectRangeRequest.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
                     getObjectRangeRequest.SetContinueRequestHandler([handle](const Aws::Http::HttpRequest*) { return handle->ShouldContinue(); });
@@ -813,6 +1911,11 @@ namespace Aws
                     {
                         getObjectRangeRequest.SetVersionId(handle->GetVersionId());
                     }
+                    // parts written in place must all come from the object the download state was recorded for.
+                    if(targetFile && !handle->GetObjectETag().empty())
+                    {
+                        getObjectRangeRequest.SetIfMatch(handle->GetObjectETag());
+                    }
 
                     auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
 
@@ -831,6 +1934,11 @@ namespace Aws
                     auto asyncContext = Aws::MakeShared<TransferHandleAsyncContext>(CLASS_TAG);
                     asyncContext->handle = handle;
                     asyncContext->partState = partState;
+                    asyncContext->startTime = std::chrono::steady_clock::now();
+                    asyncContext->mappedRegion = mappedRegion;
+                    asyncContext->mappedFile = mappedFile;
+                    asyncContext->targetFile = targetFile;
+                    asyncContext->downloadState = downloadState;
 
                     auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::GetObjectRequest& request,
                         const Aws::S3::Model::GetObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
@@ -843,9 +1951,14 @@ namespace Aws
                     m_transferConfig.s3Client->GetObjectAsync(getObjectRangeRequest, callback, asyncContext);
                     ++queuedPartIter;
                 }
-                else if(buffer)
+                else
                 {
-                    m_bufferManager.Release(buffer);
+                    if (buffer && !mappedRegion)
+                    {
+                        ReleasePartBuffer(buffer);
+                        partState->SetDownloadBuffer(nullptr);
+                    }
+                    handle->ReleasePartSlot(0, std::chrono::milliseconds(0), false);
                     break;
                 }
             }
@@ -859,6 +1972,11 @@ namespace Aws
             }
             if (handle->HasFailedParts())
             {
+                // parts that finished before the queued ones failed didn't see the download end.
+                if (downloadState)
+                {
+                    downloadState->Checkpoint(*targetFile);
+                }
                 handle->UpdateStatus(DetermineIfFailedOrCanceled(*handle));
                 TriggerTransferStatusUpdatedCallback(handle);      
             }
@@ -876,6 +1994,7 @@ namespace Aws
                 std::const_pointer_cast<TransferHandleAsyncContext>(std::static_pointer_cast<const TransferHandleAsyncContext>(context));
             const auto& handle = transferContext->handle;
             const auto& partState = transferContext->partState;
+            handle->ReleasePartSlot(partState->GetSizeInBytes(), ElapsedSince(transferContext->startTime), outcome.IsSuccess());
 
             if (!outcome.IsSuccess())
             {
@@ -889,12 +2008,57 @@ namespace Aws
             }
             else
             {
-                if(handle->ShouldContinue())
+                if(handle->ShouldContinue() && transferContext->targetFile)
                 {
-                    Aws::IOStream* bufferStream = partState->GetDownloadPartStream();
-                    assert(bufferStream);
-                    handle->WritePartToDownloadStream(bufferStream, partState->GetRangeBegin());
-                    handle->ChangePartToCompleted(partState, outcome.GetResult().GetETag());
+                    Aws::IOStream* fileStream = partState->GetDownloadPartStream();
+                    if (fileStream && static_cast<PositionalWriteStreamBuf*>(fileStream->rdbuf())->IsComplete())
+                    {
+                        if (transferContext->downloadState)
+                        {
+                            transferContext->downloadState->MarkPartWritten(partState->GetPartId(), partState->GetSizeInBytes(), *transferContext->targetFile);
+                        }
+                        handle->ChangePartToCompleted(partState, outcome.GetResult().GetETag());
+                    }
+                    else
+                    {
+                        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Failed to write part ["
+                                << partState->GetPartId() << "] to file [" << handle->GetTargetFilePath() << "].");
+                        Aws::Client::AWSError<Aws::S3::S3Errors> error(Aws::S3::S3Errors::INTERNAL_FAILURE, "WriteFailed", "Failed to write part to file.", false);
+                        handle->ChangePartToFailed(partState);
+                        handle->SetError(error);
+                        TriggerErrorCallback(handle, error);
+                    }
+                }
+                else if(handle->ShouldContinue())
+                {
+                    // parts received into the mapped file are already in place.
+                    bool written = true;
+                    if (transferContext->mappedFile && !transferContext->mappedRegion)
+                    {
+                        // the download stream was never opened, writing to it would truncate the mapped file.
+                        written = transferContext->mappedFile->WriteAt(partState->GetRangeBegin(),
+                                reinterpret_cast<const char*>(partState->GetDownloadBuffer()->GetUnderlyingData()), partState->GetSizeInBytes());
+                    }
+                    else if (!transferContext->mappedRegion)
+                    {
+                        Aws::IOStream* bufferStream = partState->GetDownloadPartStream();
+                        assert(bufferStream);
+                        handle->WritePartToDownloadStream(bufferStream, partState->GetRangeBegin());
+                    }
+
+                    if (written)
+                    {
+                        handle->ChangePartToCompleted(partState, outcome.GetResult().GetETag());
+                    }
+                    else
+                    {
+                        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Failed to write part ["
+                                << partState->GetPartId() << "] to file [" << handle->GetTargetFilePath() << "].");
+                        Aws::Client::AWSError<Aws::S3::S3Errors> error(Aws::S3::S3Errors::INTERNAL_FAILURE, "WriteFailed", "Failed to write part to file.", false);
+                        handle->ChangePartToFailed(partState);
+                        handle->SetError(error);
+                        TriggerErrorCallback(handle, error);
+                    }
                 }
                 else
                 {
@@ -905,7 +2069,7 @@ namespace Aws
             // buffer cleanup
             if(partState->GetDownloadBuffer())
             {
-                m_bufferManager.Release(partState->GetDownloadBuffer());
+                ReleasePartBuffer(partState->GetDownloadBuffer());
                 partState->SetDownloadBuffer(nullptr);
             }
 
@@ -918,10 +2082,19 @@ namespace Aws
             {
                 if (failedParts.size() == 0 && handle->GetBytesTransferred() == handle->GetBytesTotalSize())
                 {
+                    if (transferContext->downloadState)
+                    {
+                        transferContext->downloadState->Remove();
+                    }
                     handle->UpdateStatus(TransferStatus::COMPLETED);
                 }
                 else
                 {
+                    // what did arrive is kept for the next attempt.
+                    if (transferContext->downloadState)
+                    {
+                        transferContext->downloadState->Checkpoint(*transferContext->targetFile);
+                    }
                     handle->UpdateStatus(DetermineIfFailedOrCanceled(*handle));
                 }
                 TriggerTransferStatusUpdatedCallback(handle);
@@ -983,6 +2156,14 @@ namespace Aws
 
         void TransferManager::HandleListObjectsResponse(const Aws::S3::S3Client*, const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
             const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+        {
+            // starting the downloads of a page can block until earlier files finish, which must not hold up the client's threads.
+            auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
+            m_transferConfig.transferExecutor->Submit([self, request, outcome, context]() { self->DownloadListedObjects(request, outcome, context); });
+        }
+
+        void TransferManager::DownloadListedObjects(const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
         {
             auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
             auto handler = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
@@ -991,6 +2172,11 @@ namespace Aws
             auto downloadContext = std::static_pointer_cast<const DownloadDirectoryContext>(context);
             const auto& directory = downloadContext->rootDirectory;
             const auto& prefix = downloadContext->prefix;
+            const auto& directoryTransfer = downloadContext->directoryTransfer;
+
+            // pages start their files in order, and the next page is only requested once this one has its turn,
+            // so at most one page waits in memory while another one is being started.
+            directoryTransfer->WaitForPageTurn(downloadContext->pageNumber);
 
             if (outcome.IsSuccess())
             {
@@ -1002,30 +2188,68 @@ namespace Aws
                         " with prefix: " << prefix << ". Number of keys received: " << result.GetContents().size());
 
                 //if it was truncated, we don't care on this pass anyways. Just go ahead and kick off another list objects and will handle it when it finishes.
-                if (result.GetIsTruncated())
+                bool listingContinues = result.GetIsTruncated() && directoryTransfer->ShouldContinue();
+                if (listingContinues)
                 {
                     AWS_LOGSTREAM_TRACE(CLASS_TAG, "Listing objects response has a continuation token for bucket: "
                             << directory << " with prefix: " << prefix << ". Getting the next set of results.");
                     requestCpy.SetContinuationToken(result.GetNextContinuationToken());
-                    m_transferConfig.s3Client->ListObjectsV2Async(requestCpy, handler, context);
+                    auto nextContext = Aws::MakeShared<DownloadDirectoryContext>(CLASS_TAG, *downloadContext);
+                    nextContext->pageNumber = downloadContext->pageNumber + 1;
+                    m_transferConfig.s3Client->ListObjectsV2Async(requestCpy, handler, nextContext);
                 }
 
                 //this can contain matching directories or actual objects to download. If it's a directory, go ahead and create a local directory then
                 // take the new prefix and call list again. if it's an object key, go ahead and initiate download.
                 for (auto& content : result.GetContents())
                 {
-                    if (!IsS3KeyPrefix(content.GetKey()))
+                    if (IsS3KeyPrefix(content.GetKey()))
                     {
-                        Aws::String fileName = DetermineFilePath(downloadContext->rootDirectory, downloadContext->prefix, content.GetKey());
-                        auto lastDelimter = fileName.find_last_of(Aws::FileSystem::PATH_DELIM);
-                        if (lastDelimter != std::string::npos)
-                        {
-                            Aws::FileSystem::CreateDirectoryIfNotExists(fileName.substr(0, lastDelimter).c_str(), true/*create parent dirs*/);
-                        }
-                        AWS_LOGSTREAM_INFO(CLASS_TAG, "Initiating download of key: [" << content.GetKey() <<
+                        continue;
+                    }
+
+                    Aws::String fileName = DetermineFilePath(downloadContext->rootDirectory, downloadContext->prefix, content.GetKey());
+                    ObjectSummary object(content);
+                    if (IsUnchangedFile(m_transferConfig.unchangedFileCheck, fileName, object, TransferDirection::DOWNLOAD))
+                    {
+                        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Skipping download of unchanged key: [" << content.GetKey() <<
                                 "] in bucket: [" << directory << "] to destination file: [" << fileName << "]");
-                        m_transferConfig.transferInitiatedCallback(this, DownloadFile(request.GetBucket(), content.GetKey(), fileName));
+                        auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, request.GetBucket(), content.GetKey(), CreateFileDownloadStreamCallback(fileName), fileName);
+                        handle->SetBytesTotalSize(object.size);
+                        SkipUnchangedFile(handle, directoryTransfer);
+                        continue;
+                    }
+
+                    if (!directoryTransfer->AcquireFileSlot())
+                    {
+                        break;
+                    }
+
+                    auto lastDelimter = fileName.find_last_of(Aws::FileSystem::PATH_DELIM);
+                    if (lastDelimter != std::string::npos)
+                    {
+                        Aws::FileSystem::CreateDirectoryIfNotExists(fileName.substr(0, lastDelimter).c_str(), true/*create parent dirs*/);
+                    }
+                    AWS_LOGSTREAM_INFO(CLASS_TAG, "Initiating download of key: [" << content.GetKey() <<
+                            "] in bucket: [" << directory << "] to destination file: [" << fileName << "]");
+
+                    auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, request.GetBucket(), content.GetKey(), CreateFileDownloadStreamCallback(fileName), fileName);
+                    handle->SetDownloadingToFile(true);
+                    // the listing already tells what HeadObject would about objects that are fetched with a single GetObject,
+                    // and that GetObject returns their metadata, so small files take one request instead of two.
+                    if (object.size <= ComputePartSize(object.size))
+                    {
+                        handle->SetBytesTotalSize(object.size);
+                        handle->SetObjectETag(object.eTag);
                     }
+                    TrackDirectoryFile(handle, directoryTransfer);
+                    m_transferConfig.transferExecutor->Submit([self, handle] { self->DoDownload(handle); });
+                    m_transferConfig.transferInitiatedCallback(this, handle);
+                }
+
+                if (!listingContinues)
+                {
+                    directoryTransfer->OnTraversalFinished(true);
                 }
             }
             else
@@ -1038,7 +2262,31 @@ namespace Aws
                     auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, request.GetBucket(), "");
                     m_transferConfig.errorCallback(this, handle, outcome.GetError());
                 }
+                directoryTransfer->OnTraversalFinished(false);
+            }
+
+            directoryTransfer->FinishPage(downloadContext->pageNumber);
+        }
+
+        void TransferManager::SkipUnchangedFile(const std::shared_ptr<TransferHandle>& handle, const std::shared_ptr<DirectoryTransfer>& directoryTransfer)
+        {
+            handle->UpdateStatus(TransferStatus::EXACT_OBJECT_ALREADY_EXISTS);
+            directoryTransfer->OnFileSkipped();
+            m_transferConfig.transferInitiatedCallback(this, handle);
+            TriggerTransferStatusUpdatedCallback(handle);
+        }
+
+        void TransferManager::TrackDirectoryFile(const std::shared_ptr<TransferHandle>& handle, const std::shared_ptr<DirectoryTransfer>& directoryTransfer)
+        {
+            // a handle that could not even be started has already reported its final state.
+            if (handle->GetStatus() != TransferStatus::NOT_STARTED)
+            {
+                directoryTransfer->OnFileFinished(handle->GetStatus(), 0);
+                return;
             }
+
+            std::lock_guard<std::mutex> locker(m_directoryFilesLock);
+            m_directoryFiles[handle.get()] = directoryTransfer;
         }
 
         Aws::String TransferManager::DetermineFilePath(const Aws::String& directory, const Aws::String& prefix, const Aws::String& keyName)
@@ -1086,6 +2334,28 @@ namespace Aws
             {
                 m_transferConfig.transferStatusUpdatedCallback(this, handle);
             }
+
+            TransferStatus status = handle->GetStatus();
+            if (status == TransferStatus::NOT_STARTED || status == TransferStatus::IN_PROGRESS)
+            {
+                return;
+            }
+
+            std::shared_ptr<DirectoryTransfer> directoryTransfer;
+            {
+                std::lock_guard<std::mutex> locker(m_directoryFilesLock);
+                auto directoryFile = m_directoryFiles.find(handle.get());
+                if (directoryFile != m_directoryFiles.end())
+                {
+                    directoryTransfer = directoryFile->second;
+                    m_directoryFiles.erase(directoryFile);
+                }
+            }
+
+            if (directoryTransfer)
+            {
+                directoryTransfer->OnFileFinished(status, handle->GetBytesTotalSize());
+            }
         }
 
         void TransferManager::TriggerErrorCallback(const std::shared_ptr<const TransferHandle>& handle, const Aws::Client::AWSError<Aws::S3::S3Errors>& error) const
@@ -1103,6 +2373,59 @@ namespace Aws
                    m_transferConfig.s3Client->MultipartUploadSupported();
         }
 
+        uint64_t TransferManager::ComputePartSize(uint64_t objectSize) const
+        {
+            if (!m_transferConfig.enableAdaptiveTransfers)
+            {
+                return m_transferConfig.bufferSize;
+            }
+
+            uint64_t minPartSize = (objectSize + MAX_PARTS_PER_UPLOAD - 1) / MAX_PARTS_PER_UPLOAD;
+            minPartSize = (minPartSize + PART_SIZE_GRANULARITY - 1) / PART_SIZE_GRANULARITY * PART_SIZE_GRANULARITY;
+            return (std::max)(m_transferConfig.bufferSize, minPartSize);
+        }
+
+        void TransferManager::ConfigureConcurrencyControl(const std::shared_ptr<TransferHandle>& handle, bool usesTransferBuffers) const
+        {
+            if (!m_transferConfig.enableAdaptiveTransfers)
+            {
+                // without transfer buffers nothing else would bound the number of parts in flight.
+                if (!usesTransferBuffers)
+                {
+                    handle->EnableConcurrencyControl(m_transferConfig.maxPartsInFlight, m_transferConfig.maxPartsInFlight, false);
+                }
+                return;
+            }
+
+            size_t maxWindow = m_transferConfig.maxPartsInFlight;
+            uint64_t partSize = handle->GetPartSize();
+            if (usesTransferBuffers && partSize > m_transferConfig.bufferSize)
+            {
+                // these parts don't come from the transfer buffers, so keep them within the same budget here.
+                maxWindow = (std::min)(maxWindow, static_cast<size_t>((std::max)(m_transferConfig.transferBufferMaxHeapSize / partSize, static_cast<uint64_t>(1))));
+            }
+            handle->EnableConcurrencyControl(INITIAL_CONCURRENCY_WINDOW, maxWindow);
+        }
+
+        Aws::Utils::Array<uint8_t>* TransferManager::AcquirePartBuffer(uint64_t length)
+        {
+            if (length <= m_transferConfig.bufferSize)
+            {
+                return m_bufferManager.Acquire();
+            }
+            return Aws::New<Aws::Utils::Array<uint8_t>>(CLASS_TAG, static_cast<size_t>(length));
+        }
+
+        void TransferManager::ReleasePartBuffer(Aws::Utils::Array<uint8_t>* buffer)
+        {
+            if (buffer->GetLength() > m_transferConfig.bufferSize)
+            {
+                Aws::Delete(buffer);
+                return;
+            }
+            m_bufferManager.Release(buffer);
+        }
+
         std::shared_ptr<TransferHandle> TransferManager::CreateUploadFileHandle(Aws::IOStream* fileStream,
                                                                                 const Aws::String& bucketName,
                                                                                 const Aws::String& keyName,
@@ -1193,6 +2516,17 @@ namespace Aws
                                                                       const Aws::String& contentType,
                                                                       const Aws::Map<Aws::String, Aws::String>& metadata,
                                                                       const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+        {
+            auto handle = CreateUploadFileHandle(fileName, bucketName, keyName, contentType, metadata, context);
+            return SubmitUpload(handle);
+        }
+
+        std::shared_ptr<TransferHandle> TransferManager::CreateUploadFileHandle(const Aws::String& fileName,
+                                                                                const Aws::String& bucketName,
+                                                                                const Aws::String& keyName,
+                                                                                const Aws::String& contentType,
+                                                                                const Aws::Map<Aws::String, Aws::String>& metadata,
+                                                                                const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
         {
             // destructor of FStream will close stream automatically (when out of scope), no need to call close explicitly
 #ifdef _MSC_VER
@@ -1201,8 +2535,7 @@ namespace Aws
 #else
             auto fileStream = Aws::MakeShared<Aws::FStream>(CLASS_TAG, fileName.c_str(), std::ios_base::in | std::ios_base::binary);
 #endif
-            auto handle = CreateUploadFileHandle(fileStream.get(), bucketName, keyName, contentType, metadata, context, fileName);
-            return SubmitUpload(handle);
+            return CreateUploadFileHandle(fileStream.get(), bucketName, keyName, contentType, metadata, context, fileName);
         }
     }
 }
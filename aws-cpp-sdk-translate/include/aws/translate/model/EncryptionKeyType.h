@@ -34,6 +34,11 @@ namespace EncryptionKeyTypeMapper
 AWS_TRANSLATE_API EncryptionKeyType GetEncryptionKeyTypeForName(const Aws::String& name);
 
 AWS_TRANSLATE_API Aws::String GetNameForEncryptionKeyType(EncryptionKeyType value);
+
+/**
+ * Same as GetNameForEncryptionKeyType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_TRANSLATE_API const char* GetNameForEncryptionKeyTypeCStr(EncryptionKeyType value);
 } // namespace EncryptionKeyTypeMapper
 } // namespace Model
 } // namespace Translate
@@ -34,6 +34,11 @@ namespace MergeStrategyMapper
 AWS_TRANSLATE_API MergeStrategy GetMergeStrategyForName(const Aws::String& name);
 
 AWS_TRANSLATE_API Aws::String GetNameForMergeStrategy(MergeStrategy value);
+
+/**
+ * Same as GetNameForMergeStrategy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_TRANSLATE_API const char* GetNameForMergeStrategyCStr(MergeStrategy value);
 } // namespace MergeStrategyMapper
 } // namespace Model
 } // namespace Translate
@@ -35,6 +35,11 @@ namespace TerminologyDataFormatMapper
 AWS_TRANSLATE_API TerminologyDataFormat GetTerminologyDataFormatForName(const Aws::String& name);
 
 AWS_TRANSLATE_API Aws::String GetNameForTerminologyDataFormat(TerminologyDataFormat value);
+
+/**
+ * Same as GetNameForTerminologyDataFormat(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_TRANSLATE_API const char* GetNameForTerminologyDataFormatCStr(TerminologyDataFormat value);
 } // namespace TerminologyDataFormatMapper
 } // namespace Model
 } // namespace Translate
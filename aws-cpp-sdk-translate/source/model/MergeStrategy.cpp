@@ -30,15 +30,30 @@ namespace Aws
       namespace MergeStrategyMapper
       {
 
-        static const int OVERWRITE_HASH = HashingUtils::HashString("OVERWRITE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "OVERWRITE",
+        };
 
         MergeStrategy GetMergeStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OVERWRITE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MergeStrategy::OVERWRITE;
+          case 2041515883:
+            if (name == "OVERWRITE")
+            {
+              return MergeStrategy::OVERWRITE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return MergeStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForMergeStrategy(MergeStrategy enumValue)
+        const char* GetNameForMergeStrategyCStr(MergeStrategy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MergeStrategy::OVERWRITE:
-            return "OVERWRITE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMergeStrategy(MergeStrategy enumValue)
+        {
+          return GetNameForMergeStrategyCStr(enumValue);
         }
 
       } // namespace MergeStrategyMapper
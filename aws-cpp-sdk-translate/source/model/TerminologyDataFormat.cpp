@@ -30,20 +30,37 @@ namespace Aws
       namespace TerminologyDataFormatMapper
       {
 
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
-        static const int TMX_HASH = HashingUtils::HashString("TMX");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CSV",
+          "TMX",
+        };
 
         TerminologyDataFormat GetTerminologyDataFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CSV_HASH)
-          {
-            return TerminologyDataFormat::CSV;
-          }
-          else if (hashCode == TMX_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TerminologyDataFormat::TMX;
+          case 67046:
+            if (name == "CSV")
+            {
+              return TerminologyDataFormat::CSV;
+            }
+            break;
+          case 83199:
+            if (name == "TMX")
+            {
+              return TerminologyDataFormat::TMX;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TerminologyDataFormat::NOT_SET;
         }
 
-        Aws::String GetNameForTerminologyDataFormat(TerminologyDataFormat enumValue)
+        const char* GetNameForTerminologyDataFormatCStr(TerminologyDataFormat enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TerminologyDataFormat::CSV:
-            return "CSV";
-          case TerminologyDataFormat::TMX:
-            return "TMX";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTerminologyDataFormat(TerminologyDataFormat enumValue)
+        {
+          return GetNameForTerminologyDataFormatCStr(enumValue);
         }
 
       } // namespace TerminologyDataFormatMapper
@@ -35,6 +35,11 @@ namespace ChangeActionMapper
 AWS_WAFREGIONAL_API ChangeAction GetChangeActionForName(const Aws::String& name);
 
 AWS_WAFREGIONAL_API Aws::String GetNameForChangeAction(ChangeAction value);
+
+/**
+ * Same as GetNameForChangeAction(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAFREGIONAL_API const char* GetNameForChangeActionCStr(ChangeAction value);
 } // namespace ChangeActionMapper
 } // namespace Model
 } // namespace WAFRegional
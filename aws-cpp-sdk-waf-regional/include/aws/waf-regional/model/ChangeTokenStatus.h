@@ -36,6 +36,11 @@ namespace ChangeTokenStatusMapper
 AWS_WAFREGIONAL_API ChangeTokenStatus GetChangeTokenStatusForName(const Aws::String& name);
 
 AWS_WAFREGIONAL_API Aws::String GetNameForChangeTokenStatus(ChangeTokenStatus value);
+
+/**
+ * Same as GetNameForChangeTokenStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAFREGIONAL_API const char* GetNameForChangeTokenStatusCStr(ChangeTokenStatus value);
 } // namespace ChangeTokenStatusMapper
 } // namespace Model
 } // namespace WAFRegional
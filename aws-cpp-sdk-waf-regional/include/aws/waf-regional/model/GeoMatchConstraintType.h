@@ -34,6 +34,11 @@ namespace GeoMatchConstraintTypeMapper
 AWS_WAFREGIONAL_API GeoMatchConstraintType GetGeoMatchConstraintTypeForName(const Aws::String& name);
 
 AWS_WAFREGIONAL_API Aws::String GetNameForGeoMatchConstraintType(GeoMatchConstraintType value);
+
+/**
+ * Same as GetNameForGeoMatchConstraintType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAFREGIONAL_API const char* GetNameForGeoMatchConstraintTypeCStr(GeoMatchConstraintType value);
 } // namespace GeoMatchConstraintTypeMapper
 } // namespace Model
 } // namespace WAFRegional
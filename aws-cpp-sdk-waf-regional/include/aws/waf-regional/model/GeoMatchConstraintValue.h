@@ -282,6 +282,11 @@ namespace GeoMatchConstraintValueMapper
 AWS_WAFREGIONAL_API GeoMatchConstraintValue GetGeoMatchConstraintValueForName(const Aws::String& name);
 
 AWS_WAFREGIONAL_API Aws::String GetNameForGeoMatchConstraintValue(GeoMatchConstraintValue value);
+
+/**
+ * Same as GetNameForGeoMatchConstraintValue(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAFREGIONAL_API const char* GetNameForGeoMatchConstraintValueCStr(GeoMatchConstraintValue value);
 } // namespace GeoMatchConstraintValueMapper
 } // namespace Model
 } // namespace WAFRegional
@@ -35,6 +35,11 @@ namespace IPSetDescriptorTypeMapper
 AWS_WAFREGIONAL_API IPSetDescriptorType GetIPSetDescriptorTypeForName(const Aws::String& name);
 
 AWS_WAFREGIONAL_API Aws::String GetNameForIPSetDescriptorType(IPSetDescriptorType value);
+
+/**
+ * Same as GetNameForIPSetDescriptorType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAFREGIONAL_API const char* GetNameForIPSetDescriptorTypeCStr(IPSetDescriptorType value);
 } // namespace IPSetDescriptorTypeMapper
 } // namespace Model
 } // namespace WAFRegional
@@ -36,6 +36,11 @@ namespace ParameterExceptionReasonMapper
 AWS_WAFREGIONAL_API ParameterExceptionReason GetParameterExceptionReasonForName(const Aws::String& name);
 
 AWS_WAFREGIONAL_API Aws::String GetNameForParameterExceptionReason(ParameterExceptionReason value);
+
+/**
+ * Same as GetNameForParameterExceptionReason(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAFREGIONAL_API const char* GetNameForParameterExceptionReasonCStr(ParameterExceptionReason value);
 } // namespace ParameterExceptionReasonMapper
 } // namespace Model
 } // namespace WAFRegional
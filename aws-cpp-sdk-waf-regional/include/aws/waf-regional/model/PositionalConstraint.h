@@ -38,6 +38,11 @@ namespace PositionalConstraintMapper
 AWS_WAFREGIONAL_API PositionalConstraint GetPositionalConstraintForName(const Aws::String& name);
 
 AWS_WAFREGIONAL_API Aws::String GetNameForPositionalConstraint(PositionalConstraint value);
+
+/**
+ * Same as GetNameForPositionalConstraint(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAFREGIONAL_API const char* GetNameForPositionalConstraintCStr(PositionalConstraint value);
 } // namespace PositionalConstraintMapper
 } // namespace Model
 } // namespace WAFRegional
@@ -34,6 +34,11 @@ namespace RateKeyMapper
 AWS_WAFREGIONAL_API RateKey GetRateKeyForName(const Aws::String& name);
 
 AWS_WAFREGIONAL_API Aws::String GetNameForRateKey(RateKey value);
+
+/**
+ * Same as GetNameForRateKey(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAFREGIONAL_API const char* GetNameForRateKeyCStr(RateKey value);
 } // namespace RateKeyMapper
 } // namespace Model
 } // namespace WAFRegional
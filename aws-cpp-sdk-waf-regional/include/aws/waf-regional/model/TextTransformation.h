@@ -39,6 +39,11 @@ namespace TextTransformationMapper
 AWS_WAFREGIONAL_API TextTransformation GetTextTransformationForName(const Aws::String& name);
 
 AWS_WAFREGIONAL_API Aws::String GetNameForTextTransformation(TextTransformation value);
+
+/**
+ * Same as GetNameForTextTransformation(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAFREGIONAL_API const char* GetNameForTextTransformationCStr(TextTransformation value);
 } // namespace TextTransformationMapper
 } // namespace Model
 } // namespace WAFRegional
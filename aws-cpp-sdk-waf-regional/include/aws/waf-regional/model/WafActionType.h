@@ -36,6 +36,11 @@ namespace WafActionTypeMapper
 AWS_WAFREGIONAL_API WafActionType GetWafActionTypeForName(const Aws::String& name);
 
 AWS_WAFREGIONAL_API Aws::String GetNameForWafActionType(WafActionType value);
+
+/**
+ * Same as GetNameForWafActionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAFREGIONAL_API const char* GetNameForWafActionTypeCStr(WafActionType value);
 } // namespace WafActionTypeMapper
 } // namespace Model
 } // namespace WAFRegional
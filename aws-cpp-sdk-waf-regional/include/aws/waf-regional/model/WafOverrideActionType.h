@@ -35,6 +35,11 @@ namespace WafOverrideActionTypeMapper
 AWS_WAFREGIONAL_API WafOverrideActionType GetWafOverrideActionTypeForName(const Aws::String& name);
 
 AWS_WAFREGIONAL_API Aws::String GetNameForWafOverrideActionType(WafOverrideActionType value);
+
+/**
+ * Same as GetNameForWafOverrideActionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAFREGIONAL_API const char* GetNameForWafOverrideActionTypeCStr(WafOverrideActionType value);
 } // namespace WafOverrideActionTypeMapper
 } // namespace Model
 } // namespace WAFRegional
@@ -30,20 +30,37 @@ namespace Aws
       namespace IPSetDescriptorTypeMapper
       {
 
-        static const int IPV4_HASH = HashingUtils::HashString("IPV4");
-        static const int IPV6_HASH = HashingUtils::HashString("IPV6");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IPV4",
+          "IPV6",
+        };
 
         IPSetDescriptorType GetIPSetDescriptorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IPV4_HASH)
-          {
-            return IPSetDescriptorType::IPV4;
-          }
-          else if (hashCode == IPV6_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return IPSetDescriptorType::IPV6;
+          case 2254341:
+            if (name == "IPV4")
+            {
+              return IPSetDescriptorType::IPV4;
+            }
+            break;
+          case 2254343:
+            if (name == "IPV6")
+            {
+              return IPSetDescriptorType::IPV6;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return IPSetDescriptorType::NOT_SET;
         }
 
-        Aws::String GetNameForIPSetDescriptorType(IPSetDescriptorType enumValue)
+        const char* GetNameForIPSetDescriptorTypeCStr(IPSetDescriptorType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case IPSetDescriptorType::IPV4:
-            return "IPV4";
-          case IPSetDescriptorType::IPV6:
-            return "IPV6";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForIPSetDescriptorType(IPSetDescriptorType enumValue)
+        {
+          return GetNameForIPSetDescriptorTypeCStr(enumValue);
         }
 
       } // namespace IPSetDescriptorTypeMapper
@@ -30,90 +30,135 @@ namespace Aws
       namespace ParameterExceptionFieldMapper
       {
 
-        static const int CHANGE_ACTION_HASH = HashingUtils::HashString("CHANGE_ACTION");
-        static const int WAF_ACTION_HASH = HashingUtils::HashString("WAF_ACTION");
-        static const int WAF_OVERRIDE_ACTION_HASH = HashingUtils::HashString("WAF_OVERRIDE_ACTION");
-        static const int PREDICATE_TYPE_HASH = HashingUtils::HashString("PREDICATE_TYPE");
-        static const int IPSET_TYPE_HASH = HashingUtils::HashString("IPSET_TYPE");
-        static const int BYTE_MATCH_FIELD_TYPE_HASH = HashingUtils::HashString("BYTE_MATCH_FIELD_TYPE");
-        static const int SQL_INJECTION_MATCH_FIELD_TYPE_HASH = HashingUtils::HashString("SQL_INJECTION_MATCH_FIELD_TYPE");
-        static const int BYTE_MATCH_TEXT_TRANSFORMATION_HASH = HashingUtils::HashString("BYTE_MATCH_TEXT_TRANSFORMATION");
-        static const int BYTE_MATCH_POSITIONAL_CONSTRAINT_HASH = HashingUtils::HashString("BYTE_MATCH_POSITIONAL_CONSTRAINT");
-        static const int SIZE_CONSTRAINT_COMPARISON_OPERATOR_HASH = HashingUtils::HashString("SIZE_CONSTRAINT_COMPARISON_OPERATOR");
-        static const int GEO_MATCH_LOCATION_TYPE_HASH = HashingUtils::HashString("GEO_MATCH_LOCATION_TYPE");
-        static const int GEO_MATCH_LOCATION_VALUE_HASH = HashingUtils::HashString("GEO_MATCH_LOCATION_VALUE");
-        static const int RATE_KEY_HASH = HashingUtils::HashString("RATE_KEY");
-        static const int RULE_TYPE_HASH = HashingUtils::HashString("RULE_TYPE");
-        static const int NEXT_MARKER_HASH = HashingUtils::HashString("NEXT_MARKER");
-        static const int RESOURCE_ARN_HASH = HashingUtils::HashString("RESOURCE_ARN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CHANGE_ACTION",
+          "WAF_ACTION",
+          "WAF_OVERRIDE_ACTION",
+          "PREDICATE_TYPE",
+          "IPSET_TYPE",
+          "BYTE_MATCH_FIELD_TYPE",
+          "SQL_INJECTION_MATCH_FIELD_TYPE",
+          "BYTE_MATCH_TEXT_TRANSFORMATION",
+          "BYTE_MATCH_POSITIONAL_CONSTRAINT",
+          "SIZE_CONSTRAINT_COMPARISON_OPERATOR",
+          "GEO_MATCH_LOCATION_TYPE",
+          "GEO_MATCH_LOCATION_VALUE",
+          "RATE_KEY",
+          "RULE_TYPE",
+          "NEXT_MARKER",
+          "RESOURCE_ARN",
+        };
 
         ParameterExceptionField GetParameterExceptionFieldForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHANGE_ACTION_HASH)
-          {
-            return ParameterExceptionField::CHANGE_ACTION;
-          }
-          else if (hashCode == WAF_ACTION_HASH)
-          {
-            return ParameterExceptionField::WAF_ACTION;
-          }
-          else if (hashCode == WAF_OVERRIDE_ACTION_HASH)
-          {
-            return ParameterExceptionField::WAF_OVERRIDE_ACTION;
-          }
-          else if (hashCode == PREDICATE_TYPE_HASH)
-          {
-            return ParameterExceptionField::PREDICATE_TYPE;
-          }
-          else if (hashCode == IPSET_TYPE_HASH)
-          {
-            return ParameterExceptionField::IPSET_TYPE;
-          }
-          else if (hashCode == BYTE_MATCH_FIELD_TYPE_HASH)
-          {
-            return ParameterExceptionField::BYTE_MATCH_FIELD_TYPE;
-          }
-          else if (hashCode == SQL_INJECTION_MATCH_FIELD_TYPE_HASH)
-          {
-            return ParameterExceptionField::SQL_INJECTION_MATCH_FIELD_TYPE;
-          }
-          else if (hashCode == BYTE_MATCH_TEXT_TRANSFORMATION_HASH)
-          {
-            return ParameterExceptionField::BYTE_MATCH_TEXT_TRANSFORMATION;
-          }
-          else if (hashCode == BYTE_MATCH_POSITIONAL_CONSTRAINT_HASH)
-          {
-            return ParameterExceptionField::BYTE_MATCH_POSITIONAL_CONSTRAINT;
-          }
-          else if (hashCode == SIZE_CONSTRAINT_COMPARISON_OPERATOR_HASH)
-          {
-            return ParameterExceptionField::SIZE_CONSTRAINT_COMPARISON_OPERATOR;
-          }
-          else if (hashCode == GEO_MATCH_LOCATION_TYPE_HASH)
-          {
-            return ParameterExceptionField::GEO_MATCH_LOCATION_TYPE;
-          }
-          else if (hashCode == GEO_MATCH_LOCATION_VALUE_HASH)
-          {
-            return ParameterExceptionField::GEO_MATCH_LOCATION_VALUE;
-          }
-          else if (hashCode == RATE_KEY_HASH)
-          {
-            return ParameterExceptionField::RATE_KEY;
-          }
-          else if (hashCode == RULE_TYPE_HASH)
-          {
-            return ParameterExceptionField::RULE_TYPE;
-          }
-          else if (hashCode == NEXT_MARKER_HASH)
-          {
-            return ParameterExceptionField::NEXT_MARKER;
-          }
-          else if (hashCode == RESOURCE_ARN_HASH)
-          {
-            return ParameterExceptionField::RESOURCE_ARN;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 93413797:
+            if (name == "CHANGE_ACTION")
+            {
+              return ParameterExceptionField::CHANGE_ACTION;
+            }
+            break;
+          case 639259929:
+            if (name == "WAF_ACTION")
+            {
+              return ParameterExceptionField::WAF_ACTION;
+            }
+            break;
+          case -1120374138:
+            if (name == "WAF_OVERRIDE_ACTION")
+            {
+              return ParameterExceptionField::WAF_OVERRIDE_ACTION;
+            }
+            break;
+          case 1218112738:
+            if (name == "PREDICATE_TYPE")
+            {
+              return ParameterExceptionField::PREDICATE_TYPE;
+            }
+            break;
+          case -2095264962:
+            if (name == "IPSET_TYPE")
+            {
+              return ParameterExceptionField::IPSET_TYPE;
+            }
+            break;
+          case 192984240:
+            if (name == "BYTE_MATCH_FIELD_TYPE")
+            {
+              return ParameterExceptionField::BYTE_MATCH_FIELD_TYPE;
+            }
+            break;
+          case 1088000530:
+            if (name == "SQL_INJECTION_MATCH_FIELD_TYPE")
+            {
+              return ParameterExceptionField::SQL_INJECTION_MATCH_FIELD_TYPE;
+            }
+            break;
+          case 620243530:
+            if (name == "BYTE_MATCH_TEXT_TRANSFORMATION")
+            {
+              return ParameterExceptionField::BYTE_MATCH_TEXT_TRANSFORMATION;
+            }
+            break;
+          case -1792386537:
+            if (name == "BYTE_MATCH_POSITIONAL_CONSTRAINT")
+            {
+              return ParameterExceptionField::BYTE_MATCH_POSITIONAL_CONSTRAINT;
+            }
+            break;
+          case -388357450:
+            if (name == "SIZE_CONSTRAINT_COMPARISON_OPERATOR")
+            {
+              return ParameterExceptionField::SIZE_CONSTRAINT_COMPARISON_OPERATOR;
+            }
+            break;
+          case 1538377308:
+            if (name == "GEO_MATCH_LOCATION_TYPE")
+            {
+              return ParameterExceptionField::GEO_MATCH_LOCATION_TYPE;
+            }
+            break;
+          case 446185071:
+            if (name == "GEO_MATCH_LOCATION_VALUE")
+            {
+              return ParameterExceptionField::GEO_MATCH_LOCATION_VALUE;
+            }
+            break;
+          case 1206199904:
+            if (name == "RATE_KEY")
+            {
+              return ParameterExceptionField::RATE_KEY;
+            }
+            break;
+          case 724151965:
+            if (name == "RULE_TYPE")
+            {
+              return ParameterExceptionField::RULE_TYPE;
+            }
+            break;
+          case 1802656518:
+            if (name == "NEXT_MARKER")
+            {
+              return ParameterExceptionField::NEXT_MARKER;
+            }
+            break;
+          case 1934174860:
+            if (name == "RESOURCE_ARN")
+            {
+              return ParameterExceptionField::RESOURCE_ARN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -125,51 +170,26 @@ namespace Aws
           return ParameterExceptionField::NOT_SET;
         }
 
-        Aws::String GetNameForParameterExceptionField(ParameterExceptionField enumValue)
+        const char* GetNameForParameterExceptionFieldCStr(ParameterExceptionField enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ParameterExceptionField::CHANGE_ACTION:
-            return "CHANGE_ACTION";
-          case ParameterExceptionField::WAF_ACTION:
-            return "WAF_ACTION";
-          case ParameterExceptionField::WAF_OVERRIDE_ACTION:
-            return "WAF_OVERRIDE_ACTION";
-          case ParameterExceptionField::PREDICATE_TYPE:
-            return "PREDICATE_TYPE";
-          case ParameterExceptionField::IPSET_TYPE:
-            return "IPSET_TYPE";
-          case ParameterExceptionField::BYTE_MATCH_FIELD_TYPE:
-            return "BYTE_MATCH_FIELD_TYPE";
-          case ParameterExceptionField::SQL_INJECTION_MATCH_FIELD_TYPE:
-            return "SQL_INJECTION_MATCH_FIELD_TYPE";
-          case ParameterExceptionField::BYTE_MATCH_TEXT_TRANSFORMATION:
-            return "BYTE_MATCH_TEXT_TRANSFORMATION";
-          case ParameterExceptionField::BYTE_MATCH_POSITIONAL_CONSTRAINT:
-            return "BYTE_MATCH_POSITIONAL_CONSTRAINT";
-          case ParameterExceptionField::SIZE_CONSTRAINT_COMPARISON_OPERATOR:
-            return "SIZE_CONSTRAINT_COMPARISON_OPERATOR";
-          case ParameterExceptionField::GEO_MATCH_LOCATION_TYPE:
-            return "GEO_MATCH_LOCATION_TYPE";
-          case ParameterExceptionField::GEO_MATCH_LOCATION_VALUE:
-            return "GEO_MATCH_LOCATION_VALUE";
-          case ParameterExceptionField::RATE_KEY:
-            return "RATE_KEY";
-          case ParameterExceptionField::RULE_TYPE:
-            return "RULE_TYPE";
-          case ParameterExceptionField::NEXT_MARKER:
-            return "NEXT_MARKER";
-          case ParameterExceptionField::RESOURCE_ARN:
-            return "RESOURCE_ARN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForParameterExceptionField(ParameterExceptionField enumValue)
+        {
+          return GetNameForParameterExceptionFieldCStr(enumValue);
         }
 
       } // namespace ParameterExceptionFieldMapper
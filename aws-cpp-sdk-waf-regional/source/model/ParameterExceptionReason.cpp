@@ -30,25 +30,44 @@ namespace Aws
       namespace ParameterExceptionReasonMapper
       {
 
-        static const int INVALID_OPTION_HASH = HashingUtils::HashString("INVALID_OPTION");
-        static const int ILLEGAL_COMBINATION_HASH = HashingUtils::HashString("ILLEGAL_COMBINATION");
-        static const int ILLEGAL_ARGUMENT_HASH = HashingUtils::HashString("ILLEGAL_ARGUMENT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INVALID_OPTION",
+          "ILLEGAL_COMBINATION",
+          "ILLEGAL_ARGUMENT",
+        };
 
         ParameterExceptionReason GetParameterExceptionReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVALID_OPTION_HASH)
-          {
-            return ParameterExceptionReason::INVALID_OPTION;
-          }
-          else if (hashCode == ILLEGAL_COMBINATION_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ParameterExceptionReason::ILLEGAL_COMBINATION;
-          }
-          else if (hashCode == ILLEGAL_ARGUMENT_HASH)
-          {
-            return ParameterExceptionReason::ILLEGAL_ARGUMENT;
+          case 165153757:
+            if (name == "INVALID_OPTION")
+            {
+              return ParameterExceptionReason::INVALID_OPTION;
+            }
+            break;
+          case 138705734:
+            if (name == "ILLEGAL_COMBINATION")
+            {
+              return ParameterExceptionReason::ILLEGAL_COMBINATION;
+            }
+            break;
+          case -1571634810:
+            if (name == "ILLEGAL_ARGUMENT")
+            {
+              return ParameterExceptionReason::ILLEGAL_ARGUMENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ParameterExceptionReason::NOT_SET;
         }
 
-        Aws::String GetNameForParameterExceptionReason(ParameterExceptionReason enumValue)
+        const char* GetNameForParameterExceptionReasonCStr(ParameterExceptionReason enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ParameterExceptionReason::INVALID_OPTION:
-            return "INVALID_OPTION";
-          case ParameterExceptionReason::ILLEGAL_COMBINATION:
-            return "ILLEGAL_COMBINATION";
-          case ParameterExceptionReason::ILLEGAL_ARGUMENT:
-            return "ILLEGAL_ARGUMENT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForParameterExceptionReason(ParameterExceptionReason enumValue)
+        {
+          return GetNameForParameterExceptionReasonCStr(enumValue);
         }
 
       } // namespace ParameterExceptionReasonMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace PositionalConstraintMapper
       {
 
-        static const int EXACTLY_HASH = HashingUtils::HashString("EXACTLY");
-        static const int STARTS_WITH_HASH = HashingUtils::HashString("STARTS_WITH");
-        static const int ENDS_WITH_HASH = HashingUtils::HashString("ENDS_WITH");
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
-        static const int CONTAINS_WORD_HASH = HashingUtils::HashString("CONTAINS_WORD");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EXACTLY",
+          "STARTS_WITH",
+          "ENDS_WITH",
+          "CONTAINS",
+          "CONTAINS_WORD",
+        };
 
         PositionalConstraint GetPositionalConstraintForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXACTLY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PositionalConstraint::EXACTLY;
-          }
-          else if (hashCode == STARTS_WITH_HASH)
-          {
-            return PositionalConstraint::STARTS_WITH;
-          }
-          else if (hashCode == ENDS_WITH_HASH)
-          {
-            return PositionalConstraint::ENDS_WITH;
-          }
-          else if (hashCode == CONTAINS_HASH)
-          {
-            return PositionalConstraint::CONTAINS;
-          }
-          else if (hashCode == CONTAINS_WORD_HASH)
-          {
-            return PositionalConstraint::CONTAINS_WORD;
+          case -605282132:
+            if (name == "EXACTLY")
+            {
+              return PositionalConstraint::EXACTLY;
+            }
+            break;
+          case 1213247476:
+            if (name == "STARTS_WITH")
+            {
+              return PositionalConstraint::STARTS_WITH;
+            }
+            break;
+          case 1027273133:
+            if (name == "ENDS_WITH")
+            {
+              return PositionalConstraint::ENDS_WITH;
+            }
+            break;
+          case 215180831:
+            if (name == "CONTAINS")
+            {
+              return PositionalConstraint::CONTAINS;
+            }
+            break;
+          case 1202064682:
+            if (name == "CONTAINS_WORD")
+            {
+              return PositionalConstraint::CONTAINS_WORD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return PositionalConstraint::NOT_SET;
         }
 
-        Aws::String GetNameForPositionalConstraint(PositionalConstraint enumValue)
+        const char* GetNameForPositionalConstraintCStr(PositionalConstraint enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PositionalConstraint::EXACTLY:
-            return "EXACTLY";
-          case PositionalConstraint::STARTS_WITH:
-            return "STARTS_WITH";
-          case PositionalConstraint::ENDS_WITH:
-            return "ENDS_WITH";
-          case PositionalConstraint::CONTAINS:
-            return "CONTAINS";
-          case PositionalConstraint::CONTAINS_WORD:
-            return "CONTAINS_WORD";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPositionalConstraint(PositionalConstraint enumValue)
+        {
+          return GetNameForPositionalConstraintCStr(enumValue);
         }
 
       } // namespace PositionalConstraintMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace PredicateTypeMapper
       {
 
-        static const int IPMatch_HASH = HashingUtils::HashString("IPMatch");
-        static const int ByteMatch_HASH = HashingUtils::HashString("ByteMatch");
-        static const int SqlInjectionMatch_HASH = HashingUtils::HashString("SqlInjectionMatch");
-        static const int GeoMatch_HASH = HashingUtils::HashString("GeoMatch");
-        static const int SizeConstraint_HASH = HashingUtils::HashString("SizeConstraint");
-        static const int XssMatch_HASH = HashingUtils::HashString("XssMatch");
-        static const int RegexMatch_HASH = HashingUtils::HashString("RegexMatch");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "IPMatch",
+          "ByteMatch",
+          "SqlInjectionMatch",
+          "GeoMatch",
+          "SizeConstraint",
+          "XssMatch",
+          "RegexMatch",
+        };
 
         PredicateType GetPredicateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IPMatch_HASH)
-          {
-            return PredicateType::IPMatch;
-          }
-          else if (hashCode == ByteMatch_HASH)
-          {
-            return PredicateType::ByteMatch;
-          }
-          else if (hashCode == SqlInjectionMatch_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PredicateType::SqlInjectionMatch;
-          }
-          else if (hashCode == GeoMatch_HASH)
-          {
-            return PredicateType::GeoMatch;
-          }
-          else if (hashCode == SizeConstraint_HASH)
-          {
-            return PredicateType::SizeConstraint;
-          }
-          else if (hashCode == XssMatch_HASH)
-          {
-            return PredicateType::XssMatch;
-          }
-          else if (hashCode == RegexMatch_HASH)
-          {
-            return PredicateType::RegexMatch;
+          case -1567260450:
+            if (name == "IPMatch")
+            {
+              return PredicateType::IPMatch;
+            }
+            break;
+          case -64352899:
+            if (name == "ByteMatch")
+            {
+              return PredicateType::ByteMatch;
+            }
+            break;
+          case 1712531580:
+            if (name == "SqlInjectionMatch")
+            {
+              return PredicateType::SqlInjectionMatch;
+            }
+            break;
+          case 1880992020:
+            if (name == "GeoMatch")
+            {
+              return PredicateType::GeoMatch;
+            }
+            break;
+          case -486387490:
+            if (name == "SizeConstraint")
+            {
+              return PredicateType::SizeConstraint;
+            }
+            break;
+          case 1098662893:
+            if (name == "XssMatch")
+            {
+              return PredicateType::XssMatch;
+            }
+            break;
+          case 975497694:
+            if (name == "RegexMatch")
+            {
+              return PredicateType::RegexMatch;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return PredicateType::NOT_SET;
         }
 
-        Aws::String GetNameForPredicateType(PredicateType enumValue)
+        const char* GetNameForPredicateTypeCStr(PredicateType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PredicateType::IPMatch:
-            return "IPMatch";
-          case PredicateType::ByteMatch:
-            return "ByteMatch";
-          case PredicateType::SqlInjectionMatch:
-            return "SqlInjectionMatch";
-          case PredicateType::GeoMatch:
-            return "GeoMatch";
-          case PredicateType::SizeConstraint:
-            return "SizeConstraint";
-          case PredicateType::XssMatch:
-            return "XssMatch";
-          case PredicateType::RegexMatch:
-            return "RegexMatch";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPredicateType(PredicateType enumValue)
+        {
+          return GetNameForPredicateTypeCStr(enumValue);
         }
 
       } // namespace PredicateTypeMapper
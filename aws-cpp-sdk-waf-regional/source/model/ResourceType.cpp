@@ -30,20 +30,37 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int APPLICATION_LOAD_BALANCER_HASH = HashingUtils::HashString("APPLICATION_LOAD_BALANCER");
-        static const int API_GATEWAY_HASH = HashingUtils::HashString("API_GATEWAY");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "APPLICATION_LOAD_BALANCER",
+          "API_GATEWAY",
+        };
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == APPLICATION_LOAD_BALANCER_HASH)
-          {
-            return ResourceType::APPLICATION_LOAD_BALANCER;
-          }
-          else if (hashCode == API_GATEWAY_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceType::API_GATEWAY;
+          case -817525888:
+            if (name == "APPLICATION_LOAD_BALANCER")
+            {
+              return ResourceType::APPLICATION_LOAD_BALANCER;
+            }
+            break;
+          case 412998879:
+            if (name == "API_GATEWAY")
+            {
+              return ResourceType::API_GATEWAY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceTypeCStr(ResourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceType::APPLICATION_LOAD_BALANCER:
-            return "APPLICATION_LOAD_BALANCER";
-          case ResourceType::API_GATEWAY:
-            return "API_GATEWAY";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceType(ResourceType enumValue)
+        {
+          return GetNameForResourceTypeCStr(enumValue);
         }
 
       } // namespace ResourceTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace WafActionTypeMapper
       {
 
-        static const int BLOCK_HASH = HashingUtils::HashString("BLOCK");
-        static const int ALLOW_HASH = HashingUtils::HashString("ALLOW");
-        static const int COUNT_HASH = HashingUtils::HashString("COUNT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BLOCK",
+          "ALLOW",
+          "COUNT",
+        };
 
         WafActionType GetWafActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLOCK_HASH)
-          {
-            return WafActionType::BLOCK;
-          }
-          else if (hashCode == ALLOW_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WafActionType::ALLOW;
-          }
-          else if (hashCode == COUNT_HASH)
-          {
-            return WafActionType::COUNT;
+          case 63294573:
+            if (name == "BLOCK")
+            {
+              return WafActionType::BLOCK;
+            }
+            break;
+          case 62368553:
+            if (name == "ALLOW")
+            {
+              return WafActionType::ALLOW;
+            }
+            break;
+          case 64313583:
+            if (name == "COUNT")
+            {
+              return WafActionType::COUNT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return WafActionType::NOT_SET;
         }
 
-        Aws::String GetNameForWafActionType(WafActionType enumValue)
+        const char* GetNameForWafActionTypeCStr(WafActionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WafActionType::BLOCK:
-            return "BLOCK";
-          case WafActionType::ALLOW:
-            return "ALLOW";
-          case WafActionType::COUNT:
-            return "COUNT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWafActionType(WafActionType enumValue)
+        {
+          return GetNameForWafActionTypeCStr(enumValue);
         }
 
       } // namespace WafActionTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace WafRuleTypeMapper
       {
 
-        static const int REGULAR_HASH = HashingUtils::HashString("REGULAR");
-        static const int RATE_BASED_HASH = HashingUtils::HashString("RATE_BASED");
-        static const int GROUP_HASH = HashingUtils::HashString("GROUP");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REGULAR",
+          "RATE_BASED",
+          "GROUP",
+        };
 
         WafRuleType GetWafRuleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGULAR_HASH)
-          {
-            return WafRuleType::REGULAR;
-          }
-          else if (hashCode == RATE_BASED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WafRuleType::RATE_BASED;
-          }
-          else if (hashCode == GROUP_HASH)
-          {
-            return WafRuleType::GROUP;
+          case 1804446588:
+            if (name == "REGULAR")
+            {
+              return WafRuleType::REGULAR;
+            }
+            break;
+          case -491496588:
+            if (name == "RATE_BASED")
+            {
+              return WafRuleType::RATE_BASED;
+            }
+            break;
+          case 68091487:
+            if (name == "GROUP")
+            {
+              return WafRuleType::GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return WafRuleType::NOT_SET;
         }
 
-        Aws::String GetNameForWafRuleType(WafRuleType enumValue)
+        const char* GetNameForWafRuleTypeCStr(WafRuleType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WafRuleType::REGULAR:
-            return "REGULAR";
-          case WafRuleType::RATE_BASED:
-            return "RATE_BASED";
-          case WafRuleType::GROUP:
-            return "GROUP";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWafRuleType(WafRuleType enumValue)
+        {
+          return GetNameForWafRuleTypeCStr(enumValue);
         }
 
       } // namespace WafRuleTypeMapper
@@ -36,6 +36,11 @@ namespace ChangeTokenStatusMapper
 AWS_WAF_API ChangeTokenStatus GetChangeTokenStatusForName(const Aws::String& name);
 
 AWS_WAF_API Aws::String GetNameForChangeTokenStatus(ChangeTokenStatus value);
+
+/**
+ * Same as GetNameForChangeTokenStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAF_API const char* GetNameForChangeTokenStatusCStr(ChangeTokenStatus value);
 } // namespace ChangeTokenStatusMapper
 } // namespace Model
 } // namespace WAF
@@ -34,6 +34,11 @@ namespace GeoMatchConstraintTypeMapper
 AWS_WAF_API GeoMatchConstraintType GetGeoMatchConstraintTypeForName(const Aws::String& name);
 
 AWS_WAF_API Aws::String GetNameForGeoMatchConstraintType(GeoMatchConstraintType value);
+
+/**
+ * Same as GetNameForGeoMatchConstraintType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAF_API const char* GetNameForGeoMatchConstraintTypeCStr(GeoMatchConstraintType value);
 } // namespace GeoMatchConstraintTypeMapper
 } // namespace Model
 } // namespace WAF
@@ -40,6 +40,11 @@ namespace MatchFieldTypeMapper
 AWS_WAF_API MatchFieldType GetMatchFieldTypeForName(const Aws::String& name);
 
 AWS_WAF_API Aws::String GetNameForMatchFieldType(MatchFieldType value);
+
+/**
+ * Same as GetNameForMatchFieldType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAF_API const char* GetNameForMatchFieldTypeCStr(MatchFieldType value);
 } // namespace MatchFieldTypeMapper
 } // namespace Model
 } // namespace WAF
@@ -49,6 +49,11 @@ namespace ParameterExceptionFieldMapper
 AWS_WAF_API ParameterExceptionField GetParameterExceptionFieldForName(const Aws::String& name);
 
 AWS_WAF_API Aws::String GetNameForParameterExceptionField(ParameterExceptionField value);
+
+/**
+ * Same as GetNameForParameterExceptionField(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAF_API const char* GetNameForParameterExceptionFieldCStr(ParameterExceptionField value);
 } // namespace ParameterExceptionFieldMapper
 } // namespace Model
 } // namespace WAF
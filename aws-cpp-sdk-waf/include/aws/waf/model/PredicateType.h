@@ -40,6 +40,11 @@ namespace PredicateTypeMapper
 AWS_WAF_API PredicateType GetPredicateTypeForName(const Aws::String& name);
 
 AWS_WAF_API Aws::String GetNameForPredicateType(PredicateType value);
+
+/**
+ * Same as GetNameForPredicateType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAF_API const char* GetNameForPredicateTypeCStr(PredicateType value);
 } // namespace PredicateTypeMapper
 } // namespace Model
 } // namespace WAF
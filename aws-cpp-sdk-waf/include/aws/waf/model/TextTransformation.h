@@ -39,6 +39,11 @@ namespace TextTransformationMapper
 AWS_WAF_API TextTransformation GetTextTransformationForName(const Aws::String& name);
 
 AWS_WAF_API Aws::String GetNameForTextTransformation(TextTransformation value);
+
+/**
+ * Same as GetNameForTextTransformation(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAF_API const char* GetNameForTextTransformationCStr(TextTransformation value);
 } // namespace TextTransformationMapper
 } // namespace Model
 } // namespace WAF
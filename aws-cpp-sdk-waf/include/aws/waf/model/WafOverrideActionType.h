@@ -35,6 +35,11 @@ namespace WafOverrideActionTypeMapper
 AWS_WAF_API WafOverrideActionType GetWafOverrideActionTypeForName(const Aws::String& name);
 
 AWS_WAF_API Aws::String GetNameForWafOverrideActionType(WafOverrideActionType value);
+
+/**
+ * Same as GetNameForWafOverrideActionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAF_API const char* GetNameForWafOverrideActionTypeCStr(WafOverrideActionType value);
 } // namespace WafOverrideActionTypeMapper
 } // namespace Model
 } // namespace WAF
@@ -36,6 +36,11 @@ namespace WafRuleTypeMapper
 AWS_WAF_API WafRuleType GetWafRuleTypeForName(const Aws::String& name);
 
 AWS_WAF_API Aws::String GetNameForWafRuleType(WafRuleType value);
+
+/**
+ * Same as GetNameForWafRuleType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WAF_API const char* GetNameForWafRuleTypeCStr(WafRuleType value);
 } // namespace WafRuleTypeMapper
 } // namespace Model
 } // namespace WAF
@@ -30,25 +30,44 @@ namespace Aws
       namespace ChangeTokenStatusMapper
       {
 
-        static const int PROVISIONED_HASH = HashingUtils::HashString("PROVISIONED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int INSYNC_HASH = HashingUtils::HashString("INSYNC");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PROVISIONED",
+          "PENDING",
+          "INSYNC",
+        };
 
         ChangeTokenStatus GetChangeTokenStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROVISIONED_HASH)
-          {
-            return ChangeTokenStatus::PROVISIONED;
-          }
-          else if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ChangeTokenStatus::PENDING;
-          }
-          else if (hashCode == INSYNC_HASH)
-          {
-            return ChangeTokenStatus::INSYNC;
+          case 355751956:
+            if (name == "PROVISIONED")
+            {
+              return ChangeTokenStatus::PROVISIONED;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return ChangeTokenStatus::PENDING;
+            }
+            break;
+          case -2130443968:
+            if (name == "INSYNC")
+            {
+              return ChangeTokenStatus::INSYNC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ChangeTokenStatus::NOT_SET;
         }
 
-        Aws::String GetNameForChangeTokenStatus(ChangeTokenStatus enumValue)
+        const char* GetNameForChangeTokenStatusCStr(ChangeTokenStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ChangeTokenStatus::PROVISIONED:
-            return "PROVISIONED";
-          case ChangeTokenStatus::PENDING:
-            return "PENDING";
-          case ChangeTokenStatus::INSYNC:
-            return "INSYNC";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForChangeTokenStatus(ChangeTokenStatus enumValue)
+        {
+          return GetNameForChangeTokenStatusCStr(enumValue);
         }
 
       } // namespace ChangeTokenStatusMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int EQ_HASH = HashingUtils::HashString("EQ");
-        static const int NE_HASH = HashingUtils::HashString("NE");
-        static const int LE_HASH = HashingUtils::HashString("LE");
-        static const int LT_HASH = HashingUtils::HashString("LT");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int GT_HASH = HashingUtils::HashString("GT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "EQ",
+          "NE",
+          "LE",
+          "LT",
+          "GE",
+          "GT",
+        };
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQ_HASH)
-          {
-            return ComparisonOperator::EQ;
-          }
-          else if (hashCode == NE_HASH)
-          {
-            return ComparisonOperator::NE;
-          }
-          else if (hashCode == LE_HASH)
-          {
-            return ComparisonOperator::LE;
-          }
-          else if (hashCode == LT_HASH)
-          {
-            return ComparisonOperator::LT;
-          }
-          else if (hashCode == GE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ComparisonOperator::GE;
-          }
-          else if (hashCode == GT_HASH)
-          {
-            return ComparisonOperator::GT;
+          case 2220:
+            if (name == "EQ")
+            {
+              return ComparisonOperator::EQ;
+            }
+            break;
+          case 2487:
+            if (name == "NE")
+            {
+              return ComparisonOperator::NE;
+            }
+            break;
+          case 2425:
+            if (name == "LE")
+            {
+              return ComparisonOperator::LE;
+            }
+            break;
+          case 2440:
+            if (name == "LT")
+            {
+              return ComparisonOperator::LT;
+            }
+            break;
+          case 2270:
+            if (name == "GE")
+            {
+              return ComparisonOperator::GE;
+            }
+            break;
+          case 2285:
+            if (name == "GT")
+            {
+              return ComparisonOperator::GT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperatorCStr(ComparisonOperator enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ComparisonOperator::EQ:
-            return "EQ";
-          case ComparisonOperator::NE:
-            return "NE";
-          case ComparisonOperator::LE:
-            return "LE";
-          case ComparisonOperator::LT:
-            return "LT";
-          case ComparisonOperator::GE:
-            return "GE";
-          case ComparisonOperator::GT:
-            return "GT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        {
+          return GetNameForComparisonOperatorCStr(enumValue);
         }
 
       } // namespace ComparisonOperatorMapper
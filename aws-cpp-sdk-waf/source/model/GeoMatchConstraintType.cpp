@@ -30,15 +30,30 @@ namespace Aws
       namespace GeoMatchConstraintTypeMapper
       {
 
-        static const int Country_HASH = HashingUtils::HashString("Country");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "Country",
+        };
 
         GeoMatchConstraintType GetGeoMatchConstraintTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Country_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return GeoMatchConstraintType::Country;
+          case -1672482954:
+            if (name == "Country")
+            {
+              return GeoMatchConstraintType::Country;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return GeoMatchConstraintType::NOT_SET;
         }
 
-        Aws::String GetNameForGeoMatchConstraintType(GeoMatchConstraintType enumValue)
+        const char* GetNameForGeoMatchConstraintTypeCStr(GeoMatchConstraintType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case GeoMatchConstraintType::Country:
-            return "Country";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForGeoMatchConstraintType(GeoMatchConstraintType enumValue)
+        {
+          return GetNameForGeoMatchConstraintTypeCStr(enumValue);
         }
 
       } // namespace GeoMatchConstraintTypeMapper
@@ -30,45 +30,72 @@ namespace Aws
       namespace MatchFieldTypeMapper
       {
 
-        static const int URI_HASH = HashingUtils::HashString("URI");
-        static const int QUERY_STRING_HASH = HashingUtils::HashString("QUERY_STRING");
-        static const int HEADER_HASH = HashingUtils::HashString("HEADER");
-        static const int METHOD_HASH = HashingUtils::HashString("METHOD");
-        static const int BODY_HASH = HashingUtils::HashString("BODY");
-        static const int SINGLE_QUERY_ARG_HASH = HashingUtils::HashString("SINGLE_QUERY_ARG");
-        static const int ALL_QUERY_ARGS_HASH = HashingUtils::HashString("ALL_QUERY_ARGS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "URI",
+          "QUERY_STRING",
+          "HEADER",
+          "METHOD",
+          "BODY",
+          "SINGLE_QUERY_ARG",
+          "ALL_QUERY_ARGS",
+        };
 
         MatchFieldType GetMatchFieldTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == URI_HASH)
-          {
-            return MatchFieldType::URI;
-          }
-          else if (hashCode == QUERY_STRING_HASH)
-          {
-            return MatchFieldType::QUERY_STRING;
-          }
-          else if (hashCode == HEADER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MatchFieldType::HEADER;
-          }
-          else if (hashCode == METHOD_HASH)
-          {
-            return MatchFieldType::METHOD;
-          }
-          else if (hashCode == BODY_HASH)
-          {
-            return MatchFieldType::BODY;
-          }
-          else if (hashCode == SINGLE_QUERY_ARG_HASH)
-          {
-            return MatchFieldType::SINGLE_QUERY_ARG;
-          }
-          else if (hashCode == ALL_QUERY_ARGS_HASH)
-          {
-            return MatchFieldType::ALL_QUERY_ARGS;
+          case 84300:
+            if (name == "URI")
+            {
+              return MatchFieldType::URI;
+            }
+            break;
+          case -2047040632:
+            if (name == "QUERY_STRING")
+            {
+              return MatchFieldType::QUERY_STRING;
+            }
+            break;
+          case 2127025805:
+            if (name == "HEADER")
+            {
+              return MatchFieldType::HEADER;
+            }
+            break;
+          case -2024225567:
+            if (name == "METHOD")
+            {
+              return MatchFieldType::METHOD;
+            }
+            break;
+          case 2044322:
+            if (name == "BODY")
+            {
+              return MatchFieldType::BODY;
+            }
+            break;
+          case 98661096:
+            if (name == "SINGLE_QUERY_ARG")
+            {
+              return MatchFieldType::SINGLE_QUERY_ARG;
+            }
+            break;
+          case -965732462:
+            if (name == "ALL_QUERY_ARGS")
+            {
+              return MatchFieldType::ALL_QUERY_ARGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return MatchFieldType::NOT_SET;
         }
 
-        Aws::String GetNameForMatchFieldType(MatchFieldType enumValue)
+        const char* GetNameForMatchFieldTypeCStr(MatchFieldType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MatchFieldType::URI:
-            return "URI";
-          case MatchFieldType::QUERY_STRING:
-            return "QUERY_STRING";
-          case MatchFieldType::HEADER:
-            return "HEADER";
-          case MatchFieldType::METHOD:
-            return "METHOD";
-          case MatchFieldType::BODY:
-            return "BODY";
-          case MatchFieldType::SINGLE_QUERY_ARG:
-            return "SINGLE_QUERY_ARG";
-          case MatchFieldType::ALL_QUERY_ARGS:
-            return "ALL_QUERY_ARGS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMatchFieldType(MatchFieldType enumValue)
+        {
+          return GetNameForMatchFieldTypeCStr(enumValue);
         }
 
       } // namespace MatchFieldTypeMapper
@@ -30,40 +30,65 @@ namespace Aws
       namespace TextTransformationMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int COMPRESS_WHITE_SPACE_HASH = HashingUtils::HashString("COMPRESS_WHITE_SPACE");
-        static const int HTML_ENTITY_DECODE_HASH = HashingUtils::HashString("HTML_ENTITY_DECODE");
-        static const int LOWERCASE_HASH = HashingUtils::HashString("LOWERCASE");
-        static const int CMD_LINE_HASH = HashingUtils::HashString("CMD_LINE");
-        static const int URL_DECODE_HASH = HashingUtils::HashString("URL_DECODE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "COMPRESS_WHITE_SPACE",
+          "HTML_ENTITY_DECODE",
+          "LOWERCASE",
+          "CMD_LINE",
+          "URL_DECODE",
+        };
 
         TextTransformation GetTextTransformationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return TextTransformation::NONE;
-          }
-          else if (hashCode == COMPRESS_WHITE_SPACE_HASH)
-          {
-            return TextTransformation::COMPRESS_WHITE_SPACE;
-          }
-          else if (hashCode == HTML_ENTITY_DECODE_HASH)
-          {
-            return TextTransformation::HTML_ENTITY_DECODE;
-          }
-          else if (hashCode == LOWERCASE_HASH)
-          {
-            return TextTransformation::LOWERCASE;
-          }
-          else if (hashCode == CMD_LINE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TextTransformation::CMD_LINE;
-          }
-          else if (hashCode == URL_DECODE_HASH)
-          {
-            return TextTransformation::URL_DECODE;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return TextTransformation::NONE;
+            }
+            break;
+          case -474317869:
+            if (name == "COMPRESS_WHITE_SPACE")
+            {
+              return TextTransformation::COMPRESS_WHITE_SPACE;
+            }
+            break;
+          case 447029302:
+            if (name == "HTML_ENTITY_DECODE")
+            {
+              return TextTransformation::HTML_ENTITY_DECODE;
+            }
+            break;
+          case -2022879855:
+            if (name == "LOWERCASE")
+            {
+              return TextTransformation::LOWERCASE;
+            }
+            break;
+          case -1835631623:
+            if (name == "CMD_LINE")
+            {
+              return TextTransformation::CMD_LINE;
+            }
+            break;
+          case -1970474274:
+            if (name == "URL_DECODE")
+            {
+              return TextTransformation::URL_DECODE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,31 +100,26 @@ namespace Aws
           return TextTransformation::NOT_SET;
         }
 
-        Aws::String GetNameForTextTransformation(TextTransformation enumValue)
+        const char* GetNameForTextTransformationCStr(TextTransformation enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TextTransformation::NONE:
-            return "NONE";
-          case TextTransformation::COMPRESS_WHITE_SPACE:
-            return "COMPRESS_WHITE_SPACE";
-          case TextTransformation::HTML_ENTITY_DECODE:
-            return "HTML_ENTITY_DECODE";
-          case TextTransformation::LOWERCASE:
-            return "LOWERCASE";
-          case TextTransformation::CMD_LINE:
-            return "CMD_LINE";
-          case TextTransformation::URL_DECODE:
-            return "URL_DECODE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTextTransformation(TextTransformation enumValue)
+        {
+          return GetNameForTextTransformationCStr(enumValue);
         }
 
       } // namespace TextTransformationMapper
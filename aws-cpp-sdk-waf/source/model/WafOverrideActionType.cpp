@@ -30,20 +30,37 @@ namespace Aws
       namespace WafOverrideActionTypeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int COUNT_HASH = HashingUtils::HashString("COUNT");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "COUNT",
+        };
 
         WafOverrideActionType GetWafOverrideActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return WafOverrideActionType::NONE;
-          }
-          else if (hashCode == COUNT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WafOverrideActionType::COUNT;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return WafOverrideActionType::NONE;
+            }
+            break;
+          case 64313583:
+            if (name == "COUNT")
+            {
+              return WafOverrideActionType::COUNT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return WafOverrideActionType::NOT_SET;
         }
 
-        Aws::String GetNameForWafOverrideActionType(WafOverrideActionType enumValue)
+        const char* GetNameForWafOverrideActionTypeCStr(WafOverrideActionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WafOverrideActionType::NONE:
-            return "NONE";
-          case WafOverrideActionType::COUNT:
-            return "COUNT";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWafOverrideActionType(WafOverrideActionType enumValue)
+        {
+          return GetNameForWafOverrideActionTypeCStr(enumValue);
         }
 
       } // namespace WafOverrideActionTypeMapper
@@ -66,6 +66,11 @@ namespace ActivityTypeMapper
 AWS_WORKDOCS_API ActivityType GetActivityTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForActivityType(ActivityType value);
+
+/**
+ * Same as GetNameForActivityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForActivityTypeCStr(ActivityType value);
 } // namespace ActivityTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -35,6 +35,11 @@ namespace BooleanEnumTypeMapper
 AWS_WORKDOCS_API BooleanEnumType GetBooleanEnumTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForBooleanEnumType(BooleanEnumType value);
+
+/**
+ * Same as GetNameForBooleanEnumType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForBooleanEnumTypeCStr(BooleanEnumType value);
 } // namespace BooleanEnumTypeMapper
 } // namespace Model
 } // namespace WorkDocs
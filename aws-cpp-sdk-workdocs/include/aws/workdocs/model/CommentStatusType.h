@@ -36,6 +36,11 @@ namespace CommentStatusTypeMapper
 AWS_WORKDOCS_API CommentStatusType GetCommentStatusTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForCommentStatusType(CommentStatusType value);
+
+/**
+ * Same as GetNameForCommentStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForCommentStatusTypeCStr(CommentStatusType value);
 } // namespace CommentStatusTypeMapper
 } // namespace Model
 } // namespace WorkDocs
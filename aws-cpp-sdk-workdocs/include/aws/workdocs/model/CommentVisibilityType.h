@@ -35,6 +35,11 @@ namespace CommentVisibilityTypeMapper
 AWS_WORKDOCS_API CommentVisibilityType GetCommentVisibilityTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForCommentVisibilityType(CommentVisibilityType value);
+
+/**
+ * Same as GetNameForCommentVisibilityType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForCommentVisibilityTypeCStr(CommentVisibilityType value);
 } // namespace CommentVisibilityTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -35,6 +35,11 @@ namespace DocumentSourceTypeMapper
 AWS_WORKDOCS_API DocumentSourceType GetDocumentSourceTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForDocumentSourceType(DocumentSourceType value);
+
+/**
+ * Same as GetNameForDocumentSourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForDocumentSourceTypeCStr(DocumentSourceType value);
 } // namespace DocumentSourceTypeMapper
 } // namespace Model
 } // namespace WorkDocs
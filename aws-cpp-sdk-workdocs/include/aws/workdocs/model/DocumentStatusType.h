@@ -35,6 +35,11 @@ namespace DocumentStatusTypeMapper
 AWS_WORKDOCS_API DocumentStatusType GetDocumentStatusTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForDocumentStatusType(DocumentStatusType value);
+
+/**
+ * Same as GetNameForDocumentStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForDocumentStatusTypeCStr(DocumentStatusType value);
 } // namespace DocumentStatusTypeMapper
 } // namespace Model
 } // namespace WorkDocs
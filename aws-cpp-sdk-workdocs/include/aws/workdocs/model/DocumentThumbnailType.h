@@ -36,6 +36,11 @@ namespace DocumentThumbnailTypeMapper
 AWS_WORKDOCS_API DocumentThumbnailType GetDocumentThumbnailTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForDocumentThumbnailType(DocumentThumbnailType value);
+
+/**
+ * Same as GetNameForDocumentThumbnailType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForDocumentThumbnailTypeCStr(DocumentThumbnailType value);
 } // namespace DocumentThumbnailTypeMapper
 } // namespace Model
 } // namespace WorkDocs
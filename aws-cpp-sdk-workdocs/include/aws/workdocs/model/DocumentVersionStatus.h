@@ -34,6 +34,11 @@ namespace DocumentVersionStatusMapper
 AWS_WORKDOCS_API DocumentVersionStatus GetDocumentVersionStatusForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForDocumentVersionStatus(DocumentVersionStatus value);
+
+/**
+ * Same as GetNameForDocumentVersionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForDocumentVersionStatusCStr(DocumentVersionStatus value);
 } // namespace DocumentVersionStatusMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -36,6 +36,11 @@ namespace FolderContentTypeMapper
 AWS_WORKDOCS_API FolderContentType GetFolderContentTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForFolderContentType(FolderContentType value);
+
+/**
+ * Same as GetNameForFolderContentType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForFolderContentTypeCStr(FolderContentType value);
 } // namespace FolderContentTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -44,6 +44,11 @@ namespace LocaleTypeMapper
 AWS_WORKDOCS_API LocaleType GetLocaleTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForLocaleType(LocaleType value);
+
+/**
+ * Same as GetNameForLocaleType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForLocaleTypeCStr(LocaleType value);
 } // namespace LocaleTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -35,6 +35,11 @@ namespace OrderTypeMapper
 AWS_WORKDOCS_API OrderType GetOrderTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForOrderType(OrderType value);
+
+/**
+ * Same as GetNameForOrderType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForOrderTypeCStr(OrderType value);
 } // namespace OrderTypeMapper
 } // namespace Model
 } // namespace WorkDocs
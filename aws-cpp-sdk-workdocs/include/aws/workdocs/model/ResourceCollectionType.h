@@ -34,6 +34,11 @@ namespace ResourceCollectionTypeMapper
 AWS_WORKDOCS_API ResourceCollectionType GetResourceCollectionTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForResourceCollectionType(ResourceCollectionType value);
+
+/**
+ * Same as GetNameForResourceCollectionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForResourceCollectionTypeCStr(ResourceCollectionType value);
 } // namespace ResourceCollectionTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -35,6 +35,11 @@ namespace ResourceSortTypeMapper
 AWS_WORKDOCS_API ResourceSortType GetResourceSortTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForResourceSortType(ResourceSortType value);
+
+/**
+ * Same as GetNameForResourceSortType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForResourceSortTypeCStr(ResourceSortType value);
 } // namespace ResourceSortTypeMapper
 } // namespace Model
 } // namespace WorkDocs
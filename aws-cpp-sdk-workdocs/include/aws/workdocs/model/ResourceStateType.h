@@ -37,6 +37,11 @@ namespace ResourceStateTypeMapper
 AWS_WORKDOCS_API ResourceStateType GetResourceStateTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForResourceStateType(ResourceStateType value);
+
+/**
+ * Same as GetNameForResourceStateType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForResourceStateTypeCStr(ResourceStateType value);
 } // namespace ResourceStateTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -35,6 +35,11 @@ namespace RolePermissionTypeMapper
 AWS_WORKDOCS_API RolePermissionType GetRolePermissionTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForRolePermissionType(RolePermissionType value);
+
+/**
+ * Same as GetNameForRolePermissionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForRolePermissionTypeCStr(RolePermissionType value);
 } // namespace RolePermissionTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -37,6 +37,11 @@ namespace RoleTypeMapper
 AWS_WORKDOCS_API RoleType GetRoleTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForRoleType(RoleType value);
+
+/**
+ * Same as GetNameForRoleType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForRoleTypeCStr(RoleType value);
 } // namespace RoleTypeMapper
 } // namespace Model
 } // namespace WorkDocs
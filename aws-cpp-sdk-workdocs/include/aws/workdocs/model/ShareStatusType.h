@@ -35,6 +35,11 @@ namespace ShareStatusTypeMapper
 AWS_WORKDOCS_API ShareStatusType GetShareStatusTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForShareStatusType(ShareStatusType value);
+
+/**
+ * Same as GetNameForShareStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForShareStatusTypeCStr(ShareStatusType value);
 } // namespace ShareStatusTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -35,6 +35,11 @@ namespace StorageTypeMapper
 AWS_WORKDOCS_API StorageType GetStorageTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForStorageType(StorageType value);
+
+/**
+ * Same as GetNameForStorageType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForStorageTypeCStr(StorageType value);
 } // namespace StorageTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -34,6 +34,11 @@ namespace SubscriptionProtocolTypeMapper
 AWS_WORKDOCS_API SubscriptionProtocolType GetSubscriptionProtocolTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForSubscriptionProtocolType(SubscriptionProtocolType value);
+
+/**
+ * Same as GetNameForSubscriptionProtocolType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForSubscriptionProtocolTypeCStr(SubscriptionProtocolType value);
 } // namespace SubscriptionProtocolTypeMapper
 } // namespace Model
 } // namespace WorkDocs
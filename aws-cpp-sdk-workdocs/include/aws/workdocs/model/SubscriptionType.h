@@ -34,6 +34,11 @@ namespace SubscriptionTypeMapper
 AWS_WORKDOCS_API SubscriptionType GetSubscriptionTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForSubscriptionType(SubscriptionType value);
+
+/**
+ * Same as GetNameForSubscriptionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForSubscriptionTypeCStr(SubscriptionType value);
 } // namespace SubscriptionTypeMapper
 } // namespace Model
 } // namespace WorkDocs
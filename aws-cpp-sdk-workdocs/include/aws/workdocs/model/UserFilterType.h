@@ -35,6 +35,11 @@ namespace UserFilterTypeMapper
 AWS_WORKDOCS_API UserFilterType GetUserFilterTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForUserFilterType(UserFilterType value);
+
+/**
+ * Same as GetNameForUserFilterType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForUserFilterTypeCStr(UserFilterType value);
 } // namespace UserFilterTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -38,6 +38,11 @@ namespace UserSortTypeMapper
 AWS_WORKDOCS_API UserSortType GetUserSortTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForUserSortType(UserSortType value);
+
+/**
+ * Same as GetNameForUserSortType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForUserSortTypeCStr(UserSortType value);
 } // namespace UserSortTypeMapper
 } // namespace Model
 } // namespace WorkDocs
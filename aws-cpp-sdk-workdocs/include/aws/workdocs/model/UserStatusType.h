@@ -36,6 +36,11 @@ namespace UserStatusTypeMapper
 AWS_WORKDOCS_API UserStatusType GetUserStatusTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForUserStatusType(UserStatusType value);
+
+/**
+ * Same as GetNameForUserStatusType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForUserStatusTypeCStr(UserStatusType value);
 } // namespace UserStatusTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -38,6 +38,11 @@ namespace UserTypeMapper
 AWS_WORKDOCS_API UserType GetUserTypeForName(const Aws::String& name);
 
 AWS_WORKDOCS_API Aws::String GetNameForUserType(UserType value);
+
+/**
+ * Same as GetNameForUserType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKDOCS_API const char* GetNameForUserTypeCStr(UserType value);
 } // namespace UserTypeMapper
 } // namespace Model
 } // namespace WorkDocs
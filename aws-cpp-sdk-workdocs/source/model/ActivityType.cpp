@@ -30,175 +30,254 @@ namespace Aws
       namespace ActivityTypeMapper
       {
 
-        static const int DOCUMENT_CHECKED_IN_HASH = HashingUtils::HashString("DOCUMENT_CHECKED_IN");
-        static const int DOCUMENT_CHECKED_OUT_HASH = HashingUtils::HashString("DOCUMENT_CHECKED_OUT");
-        static const int DOCUMENT_RENAMED_HASH = HashingUtils::HashString("DOCUMENT_RENAMED");
-        static const int DOCUMENT_VERSION_UPLOADED_HASH = HashingUtils::HashString("DOCUMENT_VERSION_UPLOADED");
-        static const int DOCUMENT_VERSION_DELETED_HASH = HashingUtils::HashString("DOCUMENT_VERSION_DELETED");
-        static const int DOCUMENT_VERSION_VIEWED_HASH = HashingUtils::HashString("DOCUMENT_VERSION_VIEWED");
-        static const int DOCUMENT_VERSION_DOWNLOADED_HASH = HashingUtils::HashString("DOCUMENT_VERSION_DOWNLOADED");
-        static const int DOCUMENT_RECYCLED_HASH = HashingUtils::HashString("DOCUMENT_RECYCLED");
-        static const int DOCUMENT_RESTORED_HASH = HashingUtils::HashString("DOCUMENT_RESTORED");
-        static const int DOCUMENT_REVERTED_HASH = HashingUtils::HashString("DOCUMENT_REVERTED");
-        static const int DOCUMENT_SHARED_HASH = HashingUtils::HashString("DOCUMENT_SHARED");
-        static const int DOCUMENT_UNSHARED_HASH = HashingUtils::HashString("DOCUMENT_UNSHARED");
-        static const int DOCUMENT_SHARE_PERMISSION_CHANGED_HASH = HashingUtils::HashString("DOCUMENT_SHARE_PERMISSION_CHANGED");
-        static const int DOCUMENT_SHAREABLE_LINK_CREATED_HASH = HashingUtils::HashString("DOCUMENT_SHAREABLE_LINK_CREATED");
-        static const int DOCUMENT_SHAREABLE_LINK_REMOVED_HASH = HashingUtils::HashString("DOCUMENT_SHAREABLE_LINK_REMOVED");
-        static const int DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED_HASH = HashingUtils::HashString("DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED");
-        static const int DOCUMENT_MOVED_HASH = HashingUtils::HashString("DOCUMENT_MOVED");
-        static const int DOCUMENT_COMMENT_ADDED_HASH = HashingUtils::HashString("DOCUMENT_COMMENT_ADDED");
-        static const int DOCUMENT_COMMENT_DELETED_HASH = HashingUtils::HashString("DOCUMENT_COMMENT_DELETED");
-        static const int DOCUMENT_ANNOTATION_ADDED_HASH = HashingUtils::HashString("DOCUMENT_ANNOTATION_ADDED");
-        static const int DOCUMENT_ANNOTATION_DELETED_HASH = HashingUtils::HashString("DOCUMENT_ANNOTATION_DELETED");
-        static const int FOLDER_CREATED_HASH = HashingUtils::HashString("FOLDER_CREATED");
-        static const int FOLDER_DELETED_HASH = HashingUtils::HashString("FOLDER_DELETED");
-        static const int FOLDER_RENAMED_HASH = HashingUtils::HashString("FOLDER_RENAMED");
-        static const int FOLDER_RECYCLED_HASH = HashingUtils::HashString("FOLDER_RECYCLED");
-        static const int FOLDER_RESTORED_HASH = HashingUtils::HashString("FOLDER_RESTORED");
-        static const int FOLDER_SHARED_HASH = HashingUtils::HashString("FOLDER_SHARED");
-        static const int FOLDER_UNSHARED_HASH = HashingUtils::HashString("FOLDER_UNSHARED");
-        static const int FOLDER_SHARE_PERMISSION_CHANGED_HASH = HashingUtils::HashString("FOLDER_SHARE_PERMISSION_CHANGED");
-        static const int FOLDER_SHAREABLE_LINK_CREATED_HASH = HashingUtils::HashString("FOLDER_SHAREABLE_LINK_CREATED");
-        static const int FOLDER_SHAREABLE_LINK_REMOVED_HASH = HashingUtils::HashString("FOLDER_SHAREABLE_LINK_REMOVED");
-        static const int FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED_HASH = HashingUtils::HashString("FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED");
-        static const int FOLDER_MOVED_HASH = HashingUtils::HashString("FOLDER_MOVED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DOCUMENT_CHECKED_IN",
+          "DOCUMENT_CHECKED_OUT",
+          "DOCUMENT_RENAMED",
+          "DOCUMENT_VERSION_UPLOADED",
+          "DOCUMENT_VERSION_DELETED",
+          "DOCUMENT_VERSION_VIEWED",
+          "DOCUMENT_VERSION_DOWNLOADED",
+          "DOCUMENT_RECYCLED",
+          "DOCUMENT_RESTORED",
+          "DOCUMENT_REVERTED",
+          "DOCUMENT_SHARED",
+          "DOCUMENT_UNSHARED",
+          "DOCUMENT_SHARE_PERMISSION_CHANGED",
+          "DOCUMENT_SHAREABLE_LINK_CREATED",
+          "DOCUMENT_SHAREABLE_LINK_REMOVED",
+          "DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED",
+          "DOCUMENT_MOVED",
+          "DOCUMENT_COMMENT_ADDED",
+          "DOCUMENT_COMMENT_DELETED",
+          "DOCUMENT_ANNOTATION_ADDED",
+          "DOCUMENT_ANNOTATION_DELETED",
+          "FOLDER_CREATED",
+          "FOLDER_DELETED",
+          "FOLDER_RENAMED",
+          "FOLDER_RECYCLED",
+          "FOLDER_RESTORED",
+          "FOLDER_SHARED",
+          "FOLDER_UNSHARED",
+          "FOLDER_SHARE_PERMISSION_CHANGED",
+          "FOLDER_SHAREABLE_LINK_CREATED",
+          "FOLDER_SHAREABLE_LINK_REMOVED",
+          "FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED",
+          "FOLDER_MOVED",
+        };
 
         ActivityType GetActivityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DOCUMENT_CHECKED_IN_HASH)
-          {
-            return ActivityType::DOCUMENT_CHECKED_IN;
-          }
-          else if (hashCode == DOCUMENT_CHECKED_OUT_HASH)
-          {
-            return ActivityType::DOCUMENT_CHECKED_OUT;
-          }
-          else if (hashCode == DOCUMENT_RENAMED_HASH)
-          {
-            return ActivityType::DOCUMENT_RENAMED;
-          }
-          else if (hashCode == DOCUMENT_VERSION_UPLOADED_HASH)
-          {
-            return ActivityType::DOCUMENT_VERSION_UPLOADED;
-          }
-          else if (hashCode == DOCUMENT_VERSION_DELETED_HASH)
-          {
-            return ActivityType::DOCUMENT_VERSION_DELETED;
-          }
-          else if (hashCode == DOCUMENT_VERSION_VIEWED_HASH)
-          {
-            return ActivityType::DOCUMENT_VERSION_VIEWED;
-          }
-          else if (hashCode == DOCUMENT_VERSION_DOWNLOADED_HASH)
-          {
-            return ActivityType::DOCUMENT_VERSION_DOWNLOADED;
-          }
-          else if (hashCode == DOCUMENT_RECYCLED_HASH)
-          {
-            return ActivityType::DOCUMENT_RECYCLED;
-          }
-          else if (hashCode == DOCUMENT_RESTORED_HASH)
-          {
-            return ActivityType::DOCUMENT_RESTORED;
-          }
-          else if (hashCode == DOCUMENT_REVERTED_HASH)
-          {
-            return ActivityType::DOCUMENT_REVERTED;
-          }
-          else if (hashCode == DOCUMENT_SHARED_HASH)
-          {
-            return ActivityType::DOCUMENT_SHARED;
-          }
-          else if (hashCode == DOCUMENT_UNSHARED_HASH)
-          {
-            return ActivityType::DOCUMENT_UNSHARED;
-          }
-          else if (hashCode == DOCUMENT_SHARE_PERMISSION_CHANGED_HASH)
-          {
-            return ActivityType::DOCUMENT_SHARE_PERMISSION_CHANGED;
-          }
-          else if (hashCode == DOCUMENT_SHAREABLE_LINK_CREATED_HASH)
-          {
-            return ActivityType::DOCUMENT_SHAREABLE_LINK_CREATED;
-          }
-          else if (hashCode == DOCUMENT_SHAREABLE_LINK_REMOVED_HASH)
-          {
-            return ActivityType::DOCUMENT_SHAREABLE_LINK_REMOVED;
-          }
-          else if (hashCode == DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED_HASH)
-          {
-            return ActivityType::DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED;
-          }
-          else if (hashCode == DOCUMENT_MOVED_HASH)
-          {
-            return ActivityType::DOCUMENT_MOVED;
-          }
-          else if (hashCode == DOCUMENT_COMMENT_ADDED_HASH)
-          {
-            return ActivityType::DOCUMENT_COMMENT_ADDED;
-          }
-          else if (hashCode == DOCUMENT_COMMENT_DELETED_HASH)
-          {
-            return ActivityType::DOCUMENT_COMMENT_DELETED;
-          }
-          else if (hashCode == DOCUMENT_ANNOTATION_ADDED_HASH)
-          {
-            return ActivityType::DOCUMENT_ANNOTATION_ADDED;
-          }
-          else if (hashCode == DOCUMENT_ANNOTATION_DELETED_HASH)
-          {
-            return ActivityType::DOCUMENT_ANNOTATION_DELETED;
-          }
-          else if (hashCode == FOLDER_CREATED_HASH)
-          {
-            return ActivityType::FOLDER_CREATED;
-          }
-          else if (hashCode == FOLDER_DELETED_HASH)
-          {
-            return ActivityType::FOLDER_DELETED;
-          }
-          else if (hashCode == FOLDER_RENAMED_HASH)
-          {
-            return ActivityType::FOLDER_RENAMED;
-          }
-          else if (hashCode == FOLDER_RECYCLED_HASH)
-          {
-            return ActivityType::FOLDER_RECYCLED;
-          }
-          else if (hashCode == FOLDER_RESTORED_HASH)
-          {
-            return ActivityType::FOLDER_RESTORED;
-          }
-          else if (hashCode == FOLDER_SHARED_HASH)
-          {
-            return ActivityType::FOLDER_SHARED;
-          }
-          else if (hashCode == FOLDER_UNSHARED_HASH)
-          {
-            return ActivityType::FOLDER_UNSHARED;
-          }
-          else if (hashCode == FOLDER_SHARE_PERMISSION_CHANGED_HASH)
-          {
-            return ActivityType::FOLDER_SHARE_PERMISSION_CHANGED;
-          }
-          else if (hashCode == FOLDER_SHAREABLE_LINK_CREATED_HASH)
-          {
-            return ActivityType::FOLDER_SHAREABLE_LINK_CREATED;
-          }
-          else if (hashCode == FOLDER_SHAREABLE_LINK_REMOVED_HASH)
-          {
-            return ActivityType::FOLDER_SHAREABLE_LINK_REMOVED;
-          }
-          else if (hashCode == FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED_HASH)
-          {
-            return ActivityType::FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED;
-          }
-          else if (hashCode == FOLDER_MOVED_HASH)
-          {
-            return ActivityType::FOLDER_MOVED;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case -1520961919:
+            if (name == "DOCUMENT_CHECKED_IN")
+            {
+              return ActivityType::DOCUMENT_CHECKED_IN;
+            }
+            break;
+          case 94826834:
+            if (name == "DOCUMENT_CHECKED_OUT")
+            {
+              return ActivityType::DOCUMENT_CHECKED_OUT;
+            }
+            break;
+          case 1935694242:
+            if (name == "DOCUMENT_RENAMED")
+            {
+              return ActivityType::DOCUMENT_RENAMED;
+            }
+            break;
+          case 413991083:
+            if (name == "DOCUMENT_VERSION_UPLOADED")
+            {
+              return ActivityType::DOCUMENT_VERSION_UPLOADED;
+            }
+            break;
+          case 1929008206:
+            if (name == "DOCUMENT_VERSION_DELETED")
+            {
+              return ActivityType::DOCUMENT_VERSION_DELETED;
+            }
+            break;
+          case 1689431823:
+            if (name == "DOCUMENT_VERSION_VIEWED")
+            {
+              return ActivityType::DOCUMENT_VERSION_VIEWED;
+            }
+            break;
+          case 695192242:
+            if (name == "DOCUMENT_VERSION_DOWNLOADED")
+            {
+              return ActivityType::DOCUMENT_VERSION_DOWNLOADED;
+            }
+            break;
+          case -416067883:
+            if (name == "DOCUMENT_RECYCLED")
+            {
+              return ActivityType::DOCUMENT_RECYCLED;
+            }
+            break;
+          case 37744186:
+            if (name == "DOCUMENT_RESTORED")
+            {
+              return ActivityType::DOCUMENT_RESTORED;
+            }
+            break;
+          case 109870119:
+            if (name == "DOCUMENT_REVERTED")
+            {
+              return ActivityType::DOCUMENT_REVERTED;
+            }
+            break;
+          case -1569097719:
+            if (name == "DOCUMENT_SHARED")
+            {
+              return ActivityType::DOCUMENT_SHARED;
+            }
+            break;
+          case 357307106:
+            if (name == "DOCUMENT_UNSHARED")
+            {
+              return ActivityType::DOCUMENT_UNSHARED;
+            }
+            break;
+          case -1232322744:
+            if (name == "DOCUMENT_SHARE_PERMISSION_CHANGED")
+            {
+              return ActivityType::DOCUMENT_SHARE_PERMISSION_CHANGED;
+            }
+            break;
+          case -575345651:
+            if (name == "DOCUMENT_SHAREABLE_LINK_CREATED")
+            {
+              return ActivityType::DOCUMENT_SHAREABLE_LINK_CREATED;
+            }
+            break;
+          case -512064123:
+            if (name == "DOCUMENT_SHAREABLE_LINK_REMOVED")
+            {
+              return ActivityType::DOCUMENT_SHAREABLE_LINK_REMOVED;
+            }
+            break;
+          case -1309992513:
+            if (name == "DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED")
+            {
+              return ActivityType::DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED;
+            }
+            break;
+          case 636807791:
+            if (name == "DOCUMENT_MOVED")
+            {
+              return ActivityType::DOCUMENT_MOVED;
+            }
+            break;
+          case 443933372:
+            if (name == "DOCUMENT_COMMENT_ADDED")
+            {
+              return ActivityType::DOCUMENT_COMMENT_ADDED;
+            }
+            break;
+          case -178213163:
+            if (name == "DOCUMENT_COMMENT_DELETED")
+            {
+              return ActivityType::DOCUMENT_COMMENT_DELETED;
+            }
+            break;
+          case -243966348:
+            if (name == "DOCUMENT_ANNOTATION_ADDED")
+            {
+              return ActivityType::DOCUMENT_ANNOTATION_ADDED;
+            }
+            break;
+          case 175119501:
+            if (name == "DOCUMENT_ANNOTATION_DELETED")
+            {
+              return ActivityType::DOCUMENT_ANNOTATION_DELETED;
+            }
+            break;
+          case 2096198647:
+            if (name == "FOLDER_CREATED")
+            {
+              return ActivityType::FOLDER_CREATED;
+            }
+            break;
+          case -1676860120:
+            if (name == "FOLDER_DELETED")
+            {
+              return ActivityType::FOLDER_DELETED;
+            }
+            break;
+          case -2134989323:
+            if (name == "FOLDER_RENAMED")
+            {
+              return ActivityType::FOLDER_RENAMED;
+            }
+            break;
+          case -2053206814:
+            if (name == "FOLDER_RECYCLED")
+            {
+              return ActivityType::FOLDER_RECYCLED;
+            }
+            break;
+          case -1599394745:
+            if (name == "FOLDER_RESTORED")
+            {
+              return ActivityType::FOLDER_RESTORED;
+            }
+            break;
+          case 516347222:
+            if (name == "FOLDER_SHARED")
+            {
+              return ActivityType::FOLDER_SHARED;
+            }
+            break;
+          case -1279831825:
+            if (name == "FOLDER_UNSHARED")
+            {
+              return ActivityType::FOLDER_UNSHARED;
+            }
+            break;
+          case 1532740437:
+            if (name == "FOLDER_SHARE_PERMISSION_CHANGED")
+            {
+              return ActivityType::FOLDER_SHARE_PERMISSION_CHANGED;
+            }
+            break;
+          case 415240026:
+            if (name == "FOLDER_SHAREABLE_LINK_CREATED")
+            {
+              return ActivityType::FOLDER_SHAREABLE_LINK_CREATED;
+            }
+            break;
+          case 478521554:
+            if (name == "FOLDER_SHAREABLE_LINK_REMOVED")
+            {
+              return ActivityType::FOLDER_SHAREABLE_LINK_REMOVED;
+            }
+            break;
+          case 1275778130:
+            if (name == "FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED")
+            {
+              return ActivityType::FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED;
+            }
+            break;
+          case -1928319102:
+            if (name == "FOLDER_MOVED")
+            {
+              return ActivityType::FOLDER_MOVED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -210,85 +289,26 @@ namespace Aws
           return ActivityType::NOT_SET;
         }
 
-        Aws::String GetNameForActivityType(ActivityType enumValue)
+        const char* GetNameForActivityTypeCStr(ActivityType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ActivityType::DOCUMENT_CHECKED_IN:
-            return "DOCUMENT_CHECKED_IN";
-          case ActivityType::DOCUMENT_CHECKED_OUT:
-            return "DOCUMENT_CHECKED_OUT";
-          case ActivityType::DOCUMENT_RENAMED:
-            return "DOCUMENT_RENAMED";
-          case ActivityType::DOCUMENT_VERSION_UPLOADED:
-            return "DOCUMENT_VERSION_UPLOADED";
-          case ActivityType::DOCUMENT_VERSION_DELETED:
-            return "DOCUMENT_VERSION_DELETED";
-          case ActivityType::DOCUMENT_VERSION_VIEWED:
-            return "DOCUMENT_VERSION_VIEWED";
-          case ActivityType::DOCUMENT_VERSION_DOWNLOADED:
-            return "DOCUMENT_VERSION_DOWNLOADED";
-          case ActivityType::DOCUMENT_RECYCLED:
-            return "DOCUMENT_RECYCLED";
-          case ActivityType::DOCUMENT_RESTORED:
-            return "DOCUMENT_RESTORED";
-          case ActivityType::DOCUMENT_REVERTED:
-            return "DOCUMENT_REVERTED";
-          case ActivityType::DOCUMENT_SHARED:
-            return "DOCUMENT_SHARED";
-          case ActivityType::DOCUMENT_UNSHARED:
-            return "DOCUMENT_UNSHARED";
-          case ActivityType::DOCUMENT_SHARE_PERMISSION_CHANGED:
-            return "DOCUMENT_SHARE_PERMISSION_CHANGED";
-          case ActivityType::DOCUMENT_SHAREABLE_LINK_CREATED:
-            return "DOCUMENT_SHAREABLE_LINK_CREATED";
-          case ActivityType::DOCUMENT_SHAREABLE_LINK_REMOVED:
-            return "DOCUMENT_SHAREABLE_LINK_REMOVED";
-          case ActivityType::DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED:
-            return "DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED";
-          case ActivityType::DOCUMENT_MOVED:
-            return "DOCUMENT_MOVED";
-          case ActivityType::DOCUMENT_COMMENT_ADDED:
-            return "DOCUMENT_COMMENT_ADDED";
-          case ActivityType::DOCUMENT_COMMENT_DELETED:
-            return "DOCUMENT_COMMENT_DELETED";
-          case ActivityType::DOCUMENT_ANNOTATION_ADDED:
-            return "DOCUMENT_ANNOTATION_ADDED";
-          case ActivityType::DOCUMENT_ANNOTATION_DELETED:
-            return "DOCUMENT_ANNOTATION_DELETED";
-          case ActivityType::FOLDER_CREATED:
-            return "FOLDER_CREATED";
-          case ActivityType::FOLDER_DELETED:
-            return "FOLDER_DELETED";
-          case ActivityType::FOLDER_RENAMED:
-            return "FOLDER_RENAMED";
-          case ActivityType::FOLDER_RECYCLED:
-            return "FOLDER_RECYCLED";
-          case ActivityType::FOLDER_RESTORED:
-            return "FOLDER_RESTORED";
-          case ActivityType::FOLDER_SHARED:
-            return "FOLDER_SHARED";
-          case ActivityType::FOLDER_UNSHARED:
-            return "FOLDER_UNSHARED";
-          case ActivityType::FOLDER_SHARE_PERMISSION_CHANGED:
-            return "FOLDER_SHARE_PERMISSION_CHANGED";
-          case ActivityType::FOLDER_SHAREABLE_LINK_CREATED:
-            return "FOLDER_SHAREABLE_LINK_CREATED";
-          case ActivityType::FOLDER_SHAREABLE_LINK_REMOVED:
-            return "FOLDER_SHAREABLE_LINK_REMOVED";
-          case ActivityType::FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED:
-            return "FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED";
-          case ActivityType::FOLDER_MOVED:
-            return "FOLDER_MOVED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForActivityType(ActivityType enumValue)
+        {
+          return GetNameForActivityTypeCStr(enumValue);
         }
 
       } // namespace ActivityTypeMapper
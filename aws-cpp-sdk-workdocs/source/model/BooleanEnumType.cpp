@@ -30,20 +30,37 @@ namespace Aws
       namespace BooleanEnumTypeMapper
       {
 
-        static const int TRUE_HASH = HashingUtils::HashString("TRUE");
-        static const int FALSE_HASH = HashingUtils::HashString("FALSE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "TRUE",
+          "FALSE",
+        };
 
         BooleanEnumType GetBooleanEnumTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRUE_HASH)
-          {
-            return BooleanEnumType::TRUE;
-          }
-          else if (hashCode == FALSE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return BooleanEnumType::FALSE;
+          case 2583950:
+            if (name == "TRUE")
+            {
+              return BooleanEnumType::TRUE;
+            }
+            break;
+          case 66658563:
+            if (name == "FALSE")
+            {
+              return BooleanEnumType::FALSE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return BooleanEnumType::NOT_SET;
         }
 
-        Aws::String GetNameForBooleanEnumType(BooleanEnumType enumValue)
+        const char* GetNameForBooleanEnumTypeCStr(BooleanEnumType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case BooleanEnumType::TRUE:
-            return "TRUE";
-          case BooleanEnumType::FALSE:
-            return "FALSE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForBooleanEnumType(BooleanEnumType enumValue)
+        {
+          return GetNameForBooleanEnumTypeCStr(enumValue);
         }
 
       } // namespace BooleanEnumTypeMapper
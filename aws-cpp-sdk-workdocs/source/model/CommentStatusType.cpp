@@ -30,25 +30,44 @@ namespace Aws
       namespace CommentStatusTypeMapper
       {
 
-        static const int DRAFT_HASH = HashingUtils::HashString("DRAFT");
-        static const int PUBLISHED_HASH = HashingUtils::HashString("PUBLISHED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DRAFT",
+          "PUBLISHED",
+          "DELETED",
+        };
 
         CommentStatusType GetCommentStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DRAFT_HASH)
-          {
-            return CommentStatusType::DRAFT;
-          }
-          else if (hashCode == PUBLISHED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CommentStatusType::PUBLISHED;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return CommentStatusType::DELETED;
+          case 65307009:
+            if (name == "DRAFT")
+            {
+              return CommentStatusType::DRAFT;
+            }
+            break;
+          case -60968498:
+            if (name == "PUBLISHED")
+            {
+              return CommentStatusType::PUBLISHED;
+            }
+            break;
+          case -2026521607:
+            if (name == "DELETED")
+            {
+              return CommentStatusType::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return CommentStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForCommentStatusType(CommentStatusType enumValue)
+        const char* GetNameForCommentStatusTypeCStr(CommentStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CommentStatusType::DRAFT:
-            return "DRAFT";
-          case CommentStatusType::PUBLISHED:
-            return "PUBLISHED";
-          case CommentStatusType::DELETED:
-            return "DELETED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCommentStatusType(CommentStatusType enumValue)
+        {
+          return GetNameForCommentStatusTypeCStr(enumValue);
         }
 
       } // namespace CommentStatusTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace CommentVisibilityTypeMapper
       {
 
-        static const int PUBLIC__HASH = HashingUtils::HashString("PUBLIC");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PUBLIC",
+          "PRIVATE",
+        };
 
         CommentVisibilityType GetCommentVisibilityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PUBLIC__HASH)
-          {
-            return CommentVisibilityType::PUBLIC_;
-          }
-          else if (hashCode == PRIVATE__HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return CommentVisibilityType::PRIVATE_;
+          case -1924094359:
+            if (name == "PUBLIC")
+            {
+              return CommentVisibilityType::PUBLIC_;
+            }
+            break;
+          case 403485027:
+            if (name == "PRIVATE")
+            {
+              return CommentVisibilityType::PRIVATE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return CommentVisibilityType::NOT_SET;
         }
 
-        Aws::String GetNameForCommentVisibilityType(CommentVisibilityType enumValue)
+        const char* GetNameForCommentVisibilityTypeCStr(CommentVisibilityType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case CommentVisibilityType::PUBLIC_:
-            return "PUBLIC";
-          case CommentVisibilityType::PRIVATE_:
-            return "PRIVATE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCommentVisibilityType(CommentVisibilityType enumValue)
+        {
+          return GetNameForCommentVisibilityTypeCStr(enumValue);
         }
 
       } // namespace CommentVisibilityTypeMapper
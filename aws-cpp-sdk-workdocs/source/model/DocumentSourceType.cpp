@@ -30,20 +30,37 @@ namespace Aws
       namespace DocumentSourceTypeMapper
       {
 
-        static const int ORIGINAL_HASH = HashingUtils::HashString("ORIGINAL");
-        static const int WITH_COMMENTS_HASH = HashingUtils::HashString("WITH_COMMENTS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ORIGINAL",
+          "WITH_COMMENTS",
+        };
 
         DocumentSourceType GetDocumentSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ORIGINAL_HASH)
-          {
-            return DocumentSourceType::ORIGINAL;
-          }
-          else if (hashCode == WITH_COMMENTS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DocumentSourceType::WITH_COMMENTS;
+          case -2133296687:
+            if (name == "ORIGINAL")
+            {
+              return DocumentSourceType::ORIGINAL;
+            }
+            break;
+          case -536554163:
+            if (name == "WITH_COMMENTS")
+            {
+              return DocumentSourceType::WITH_COMMENTS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DocumentSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentSourceType(DocumentSourceType enumValue)
+        const char* GetNameForDocumentSourceTypeCStr(DocumentSourceType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DocumentSourceType::ORIGINAL:
-            return "ORIGINAL";
-          case DocumentSourceType::WITH_COMMENTS:
-            return "WITH_COMMENTS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDocumentSourceType(DocumentSourceType enumValue)
+        {
+          return GetNameForDocumentSourceTypeCStr(enumValue);
         }
 
       } // namespace DocumentSourceTypeMapper
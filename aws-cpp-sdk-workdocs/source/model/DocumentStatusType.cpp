@@ -30,20 +30,37 @@ namespace Aws
       namespace DocumentStatusTypeMapper
       {
 
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "INITIALIZED",
+          "ACTIVE",
+        };
 
         DocumentStatusType GetDocumentStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZED_HASH)
-          {
-            return DocumentStatusType::INITIALIZED;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DocumentStatusType::ACTIVE;
+          case -907986252:
+            if (name == "INITIALIZED")
+            {
+              return DocumentStatusType::INITIALIZED;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return DocumentStatusType::ACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return DocumentStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentStatusType(DocumentStatusType enumValue)
+        const char* GetNameForDocumentStatusTypeCStr(DocumentStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DocumentStatusType::INITIALIZED:
-            return "INITIALIZED";
-          case DocumentStatusType::ACTIVE:
-            return "ACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDocumentStatusType(DocumentStatusType enumValue)
+        {
+          return GetNameForDocumentStatusTypeCStr(enumValue);
         }
 
       } // namespace DocumentStatusTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DocumentThumbnailTypeMapper
       {
 
-        static const int SMALL_HASH = HashingUtils::HashString("SMALL");
-        static const int SMALL_HQ_HASH = HashingUtils::HashString("SMALL_HQ");
-        static const int LARGE_HASH = HashingUtils::HashString("LARGE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SMALL",
+          "SMALL_HQ",
+          "LARGE",
+        };
 
         DocumentThumbnailType GetDocumentThumbnailTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SMALL_HASH)
-          {
-            return DocumentThumbnailType::SMALL;
-          }
-          else if (hashCode == SMALL_HQ_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DocumentThumbnailType::SMALL_HQ;
-          }
-          else if (hashCode == LARGE_HASH)
-          {
-            return DocumentThumbnailType::LARGE;
+          case 79011047:
+            if (name == "SMALL")
+            {
+              return DocumentThumbnailType::SMALL;
+            }
+            break;
+          case 176116577:
+            if (name == "SMALL_HQ")
+            {
+              return DocumentThumbnailType::SMALL_HQ;
+            }
+            break;
+          case 72205083:
+            if (name == "LARGE")
+            {
+              return DocumentThumbnailType::LARGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DocumentThumbnailType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentThumbnailType(DocumentThumbnailType enumValue)
+        const char* GetNameForDocumentThumbnailTypeCStr(DocumentThumbnailType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DocumentThumbnailType::SMALL:
-            return "SMALL";
-          case DocumentThumbnailType::SMALL_HQ:
-            return "SMALL_HQ";
-          case DocumentThumbnailType::LARGE:
-            return "LARGE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDocumentThumbnailType(DocumentThumbnailType enumValue)
+        {
+          return GetNameForDocumentThumbnailTypeCStr(enumValue);
         }
 
       } // namespace DocumentThumbnailTypeMapper
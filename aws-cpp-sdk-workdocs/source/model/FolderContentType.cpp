@@ -30,25 +30,44 @@ namespace Aws
       namespace FolderContentTypeMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int DOCUMENT_HASH = HashingUtils::HashString("DOCUMENT");
-        static const int FOLDER_HASH = HashingUtils::HashString("FOLDER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALL",
+          "DOCUMENT",
+          "FOLDER",
+        };
 
         FolderContentType GetFolderContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
-          {
-            return FolderContentType::ALL;
-          }
-          else if (hashCode == DOCUMENT_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return FolderContentType::DOCUMENT;
-          }
-          else if (hashCode == FOLDER_HASH)
-          {
-            return FolderContentType::FOLDER;
+          case 64897:
+            if (name == "ALL")
+            {
+              return FolderContentType::ALL;
+            }
+            break;
+          case 1644347675:
+            if (name == "DOCUMENT")
+            {
+              return FolderContentType::DOCUMENT;
+            }
+            break;
+          case 2079330414:
+            if (name == "FOLDER")
+            {
+              return FolderContentType::FOLDER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return FolderContentType::NOT_SET;
         }
 
-        Aws::String GetNameForFolderContentType(FolderContentType enumValue)
+        const char* GetNameForFolderContentTypeCStr(FolderContentType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case FolderContentType::ALL:
-            return "ALL";
-          case FolderContentType::DOCUMENT:
-            return "DOCUMENT";
-          case FolderContentType::FOLDER:
-            return "FOLDER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForFolderContentType(FolderContentType enumValue)
+        {
+          return GetNameForFolderContentTypeCStr(enumValue);
         }
 
       } // namespace FolderContentTypeMapper
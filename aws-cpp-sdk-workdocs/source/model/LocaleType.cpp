@@ -30,65 +30,100 @@ namespace Aws
       namespace LocaleTypeMapper
       {
 
-        static const int en_HASH = HashingUtils::HashString("en");
-        static const int fr_HASH = HashingUtils::HashString("fr");
-        static const int ko_HASH = HashingUtils::HashString("ko");
-        static const int de_HASH = HashingUtils::HashString("de");
-        static const int es_HASH = HashingUtils::HashString("es");
-        static const int ja_HASH = HashingUtils::HashString("ja");
-        static const int ru_HASH = HashingUtils::HashString("ru");
-        static const int zh_CN_HASH = HashingUtils::HashString("zh_CN");
-        static const int zh_TW_HASH = HashingUtils::HashString("zh_TW");
-        static const int pt_BR_HASH = HashingUtils::HashString("pt_BR");
-        static const int default__HASH = HashingUtils::HashString("default");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "en",
+          "fr",
+          "ko",
+          "de",
+          "es",
+          "ja",
+          "ru",
+          "zh_CN",
+          "zh_TW",
+          "pt_BR",
+          "default",
+        };
 
         LocaleType GetLocaleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == en_HASH)
-          {
-            return LocaleType::en;
-          }
-          else if (hashCode == fr_HASH)
-          {
-            return LocaleType::fr;
-          }
-          else if (hashCode == ko_HASH)
-          {
-            return LocaleType::ko;
-          }
-          else if (hashCode == de_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return LocaleType::de;
-          }
-          else if (hashCode == es_HASH)
-          {
-            return LocaleType::es;
-          }
-          else if (hashCode == ja_HASH)
-          {
-            return LocaleType::ja;
-          }
-          else if (hashCode == ru_HASH)
-          {
-            return LocaleType::ru;
-          }
-          else if (hashCode == zh_CN_HASH)
-          {
-            return LocaleType::zh_CN;
-          }
-          else if (hashCode == zh_TW_HASH)
-          {
-            return LocaleType::zh_TW;
-          }
-          else if (hashCode == pt_BR_HASH)
-          {
-            return LocaleType::pt_BR;
-          }
-          else if (hashCode == default__HASH)
-          {
-            return LocaleType::default_;
+          case 3241:
+            if (name == "en")
+            {
+              return LocaleType::en;
+            }
+            break;
+          case 3276:
+            if (name == "fr")
+            {
+              return LocaleType::fr;
+            }
+            break;
+          case 3428:
+            if (name == "ko")
+            {
+              return LocaleType::ko;
+            }
+            break;
+          case 3201:
+            if (name == "de")
+            {
+              return LocaleType::de;
+            }
+            break;
+          case 3246:
+            if (name == "es")
+            {
+              return LocaleType::es;
+            }
+            break;
+          case 3383:
+            if (name == "ja")
+            {
+              return LocaleType::ja;
+            }
+            break;
+          case 3651:
+            if (name == "ru")
+            {
+              return LocaleType::ru;
+            }
+            break;
+          case 115861276:
+            if (name == "zh_CN")
+            {
+              return LocaleType::zh_CN;
+            }
+            break;
+          case 115861812:
+            if (name == "zh_TW")
+            {
+              return LocaleType::zh_TW;
+            }
+            break;
+          case 106983531:
+            if (name == "pt_BR")
+            {
+              return LocaleType::pt_BR;
+            }
+            break;
+          case 1544803905:
+            if (name == "default")
+            {
+              return LocaleType::default_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,41 +135,26 @@ namespace Aws
           return LocaleType::NOT_SET;
         }
 
-        Aws::String GetNameForLocaleType(LocaleType enumValue)
+        const char* GetNameForLocaleTypeCStr(LocaleType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case LocaleType::en:
-            return "en";
-          case LocaleType::fr:
-            return "fr";
-          case LocaleType::ko:
-            return "ko";
-          case LocaleType::de:
-            return "de";
-          case LocaleType::es:
-            return "es";
-          case LocaleType::ja:
-            return "ja";
-          case LocaleType::ru:
-            return "ru";
-          case LocaleType::zh_CN:
-            return "zh_CN";
-          case LocaleType::zh_TW:
-            return "zh_TW";
-          case LocaleType::pt_BR:
-            return "pt_BR";
-          case LocaleType::default_:
-            return "default";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForLocaleType(LocaleType enumValue)
+        {
+          return GetNameForLocaleTypeCStr(enumValue);
         }
 
       } // namespace LocaleTypeMapper
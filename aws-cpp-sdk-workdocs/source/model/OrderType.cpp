@@ -30,20 +30,37 @@ namespace Aws
       namespace OrderTypeMapper
       {
 
-        static const int ASCENDING_HASH = HashingUtils::HashString("ASCENDING");
-        static const int DESCENDING_HASH = HashingUtils::HashString("DESCENDING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ASCENDING",
+          "DESCENDING",
+        };
 
         OrderType GetOrderTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASCENDING_HASH)
-          {
-            return OrderType::ASCENDING;
-          }
-          else if (hashCode == DESCENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OrderType::DESCENDING;
+          case -1513304392:
+            if (name == "ASCENDING")
+            {
+              return OrderType::ASCENDING;
+            }
+            break;
+          case -631204104:
+            if (name == "DESCENDING")
+            {
+              return OrderType::DESCENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OrderType::NOT_SET;
         }
 
-        Aws::String GetNameForOrderType(OrderType enumValue)
+        const char* GetNameForOrderTypeCStr(OrderType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OrderType::ASCENDING:
-            return "ASCENDING";
-          case OrderType::DESCENDING:
-            return "DESCENDING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOrderType(OrderType enumValue)
+        {
+          return GetNameForOrderTypeCStr(enumValue);
         }
 
       } // namespace OrderTypeMapper
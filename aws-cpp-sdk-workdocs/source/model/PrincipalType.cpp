@@ -30,35 +30,58 @@ namespace Aws
       namespace PrincipalTypeMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int GROUP_HASH = HashingUtils::HashString("GROUP");
-        static const int INVITE_HASH = HashingUtils::HashString("INVITE");
-        static const int ANONYMOUS_HASH = HashingUtils::HashString("ANONYMOUS");
-        static const int ORGANIZATION_HASH = HashingUtils::HashString("ORGANIZATION");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USER",
+          "GROUP",
+          "INVITE",
+          "ANONYMOUS",
+          "ORGANIZATION",
+        };
 
         PrincipalType GetPrincipalTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PrincipalType::USER;
-          }
-          else if (hashCode == GROUP_HASH)
-          {
-            return PrincipalType::GROUP;
-          }
-          else if (hashCode == INVITE_HASH)
-          {
-            return PrincipalType::INVITE;
-          }
-          else if (hashCode == ANONYMOUS_HASH)
-          {
-            return PrincipalType::ANONYMOUS;
-          }
-          else if (hashCode == ORGANIZATION_HASH)
-          {
-            return PrincipalType::ORGANIZATION;
+          case 2614219:
+            if (name == "USER")
+            {
+              return PrincipalType::USER;
+            }
+            break;
+          case 68091487:
+            if (name == "GROUP")
+            {
+              return PrincipalType::GROUP;
+            }
+            break;
+          case -2130369783:
+            if (name == "INVITE")
+            {
+              return PrincipalType::INVITE;
+            }
+            break;
+          case 690783309:
+            if (name == "ANONYMOUS")
+            {
+              return PrincipalType::ANONYMOUS;
+            }
+            break;
+          case -798763725:
+            if (name == "ORGANIZATION")
+            {
+              return PrincipalType::ORGANIZATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return PrincipalType::NOT_SET;
         }
 
-        Aws::String GetNameForPrincipalType(PrincipalType enumValue)
+        const char* GetNameForPrincipalTypeCStr(PrincipalType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PrincipalType::USER:
-            return "USER";
-          case PrincipalType::GROUP:
-            return "GROUP";
-          case PrincipalType::INVITE:
-            return "INVITE";
-          case PrincipalType::ANONYMOUS:
-            return "ANONYMOUS";
-          case PrincipalType::ORGANIZATION:
-            return "ORGANIZATION";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPrincipalType(PrincipalType enumValue)
+        {
+          return GetNameForPrincipalTypeCStr(enumValue);
         }
 
       } // namespace PrincipalTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace ResourceCollectionTypeMapper
       {
 
-        static const int SHARED_WITH_ME_HASH = HashingUtils::HashString("SHARED_WITH_ME");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SHARED_WITH_ME",
+        };
 
         ResourceCollectionType GetResourceCollectionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SHARED_WITH_ME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceCollectionType::SHARED_WITH_ME;
+          case 926472663:
+            if (name == "SHARED_WITH_ME")
+            {
+              return ResourceCollectionType::SHARED_WITH_ME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return ResourceCollectionType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceCollectionType(ResourceCollectionType enumValue)
+        const char* GetNameForResourceCollectionTypeCStr(ResourceCollectionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceCollectionType::SHARED_WITH_ME:
-            return "SHARED_WITH_ME";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceCollectionType(ResourceCollectionType enumValue)
+        {
+          return GetNameForResourceCollectionTypeCStr(enumValue);
         }
 
       } // namespace ResourceCollectionTypeMapper
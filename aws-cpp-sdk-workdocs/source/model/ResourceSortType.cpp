@@ -30,20 +30,37 @@ namespace Aws
       namespace ResourceSortTypeMapper
       {
 
-        static const int DATE_HASH = HashingUtils::HashString("DATE");
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DATE",
+          "NAME",
+        };
 
         ResourceSortType GetResourceSortTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DATE_HASH)
-          {
-            return ResourceSortType::DATE;
-          }
-          else if (hashCode == NAME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceSortType::NAME;
+          case 2090926:
+            if (name == "DATE")
+            {
+              return ResourceSortType::DATE;
+            }
+            break;
+          case 2388619:
+            if (name == "NAME")
+            {
+              return ResourceSortType::NAME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ResourceSortType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceSortType(ResourceSortType enumValue)
+        const char* GetNameForResourceSortTypeCStr(ResourceSortType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceSortType::DATE:
-            return "DATE";
-          case ResourceSortType::NAME:
-            return "NAME";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceSortType(ResourceSortType enumValue)
+        {
+          return GetNameForResourceSortTypeCStr(enumValue);
         }
 
       } // namespace ResourceSortTypeMapper
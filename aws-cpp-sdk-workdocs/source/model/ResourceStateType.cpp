@@ -30,30 +30,51 @@ namespace Aws
       namespace ResourceStateTypeMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int RESTORING_HASH = HashingUtils::HashString("RESTORING");
-        static const int RECYCLING_HASH = HashingUtils::HashString("RECYCLING");
-        static const int RECYCLED_HASH = HashingUtils::HashString("RECYCLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "RESTORING",
+          "RECYCLING",
+          "RECYCLED",
+        };
 
         ResourceStateType GetResourceStateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return ResourceStateType::ACTIVE;
-          }
-          else if (hashCode == RESTORING_HASH)
-          {
-            return ResourceStateType::RESTORING;
-          }
-          else if (hashCode == RECYCLING_HASH)
-          {
-            return ResourceStateType::RECYCLING;
-          }
-          else if (hashCode == RECYCLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ResourceStateType::RECYCLED;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return ResourceStateType::ACTIVE;
+            }
+            break;
+          case 941134763:
+            if (name == "RESTORING")
+            {
+              return ResourceStateType::RESTORING;
+            }
+            break;
+          case -242137488:
+            if (name == "RECYCLING")
+            {
+              return ResourceStateType::RECYCLING;
+            }
+            break;
+          case -7811023:
+            if (name == "RECYCLED")
+            {
+              return ResourceStateType::RECYCLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return ResourceStateType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceStateType(ResourceStateType enumValue)
+        const char* GetNameForResourceStateTypeCStr(ResourceStateType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ResourceStateType::ACTIVE:
-            return "ACTIVE";
-          case ResourceStateType::RESTORING:
-            return "RESTORING";
-          case ResourceStateType::RECYCLING:
-            return "RECYCLING";
-          case ResourceStateType::RECYCLED:
-            return "RECYCLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForResourceStateType(ResourceStateType enumValue)
+        {
+          return GetNameForResourceStateTypeCStr(enumValue);
         }
 
       } // namespace ResourceStateTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace RolePermissionTypeMapper
       {
 
-        static const int DIRECT_HASH = HashingUtils::HashString("DIRECT");
-        static const int INHERITED_HASH = HashingUtils::HashString("INHERITED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DIRECT",
+          "INHERITED",
+        };
 
         RolePermissionType GetRolePermissionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DIRECT_HASH)
-          {
-            return RolePermissionType::DIRECT;
-          }
-          else if (hashCode == INHERITED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RolePermissionType::INHERITED;
+          case 2016710633:
+            if (name == "DIRECT")
+            {
+              return RolePermissionType::DIRECT;
+            }
+            break;
+          case 1229216442:
+            if (name == "INHERITED")
+            {
+              return RolePermissionType::INHERITED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RolePermissionType::NOT_SET;
         }
 
-        Aws::String GetNameForRolePermissionType(RolePermissionType enumValue)
+        const char* GetNameForRolePermissionTypeCStr(RolePermissionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RolePermissionType::DIRECT:
-            return "DIRECT";
-          case RolePermissionType::INHERITED:
-            return "INHERITED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRolePermissionType(RolePermissionType enumValue)
+        {
+          return GetNameForRolePermissionTypeCStr(enumValue);
         }
 
       } // namespace RolePermissionTypeMapper
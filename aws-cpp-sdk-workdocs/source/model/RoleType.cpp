@@ -30,30 +30,51 @@ namespace Aws
       namespace RoleTypeMapper
       {
 
-        static const int VIEWER_HASH = HashingUtils::HashString("VIEWER");
-        static const int CONTRIBUTOR_HASH = HashingUtils::HashString("CONTRIBUTOR");
-        static const int OWNER_HASH = HashingUtils::HashString("OWNER");
-        static const int COOWNER_HASH = HashingUtils::HashString("COOWNER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VIEWER",
+          "CONTRIBUTOR",
+          "OWNER",
+          "COOWNER",
+        };
 
         RoleType GetRoleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VIEWER_HASH)
-          {
-            return RoleType::VIEWER;
-          }
-          else if (hashCode == CONTRIBUTOR_HASH)
-          {
-            return RoleType::CONTRIBUTOR;
-          }
-          else if (hashCode == OWNER_HASH)
-          {
-            return RoleType::OWNER;
-          }
-          else if (hashCode == COOWNER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RoleType::COOWNER;
+          case -1763301870:
+            if (name == "VIEWER")
+            {
+              return RoleType::VIEWER;
+            }
+            break;
+          case 257684667:
+            if (name == "CONTRIBUTOR")
+            {
+              return RoleType::CONTRIBUTOR;
+            }
+            break;
+          case 75627155:
+            if (name == "OWNER")
+            {
+              return RoleType::OWNER;
+            }
+            break;
+          case 1670534567:
+            if (name == "COOWNER")
+            {
+              return RoleType::COOWNER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,27 +86,26 @@ namespace Aws
           return RoleType::NOT_SET;
         }
 
-        Aws::String GetNameForRoleType(RoleType enumValue)
+        const char* GetNameForRoleTypeCStr(RoleType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RoleType::VIEWER:
-            return "VIEWER";
-          case RoleType::CONTRIBUTOR:
-            return "CONTRIBUTOR";
-          case RoleType::OWNER:
-            return "OWNER";
-          case RoleType::COOWNER:
-            return "COOWNER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRoleType(RoleType enumValue)
+        {
+          return GetNameForRoleTypeCStr(enumValue);
         }
 
       } // namespace RoleTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace ShareStatusTypeMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILURE_HASH = HashingUtils::HashString("FAILURE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SUCCESS",
+          "FAILURE",
+        };
 
         ShareStatusType GetShareStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
-          {
-            return ShareStatusType::SUCCESS;
-          }
-          else if (hashCode == FAILURE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ShareStatusType::FAILURE;
+          case -1149187101:
+            if (name == "SUCCESS")
+            {
+              return ShareStatusType::SUCCESS;
+            }
+            break;
+          case -368591510:
+            if (name == "FAILURE")
+            {
+              return ShareStatusType::FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ShareStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForShareStatusType(ShareStatusType enumValue)
+        const char* GetNameForShareStatusTypeCStr(ShareStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ShareStatusType::SUCCESS:
-            return "SUCCESS";
-          case ShareStatusType::FAILURE:
-            return "FAILURE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForShareStatusType(ShareStatusType enumValue)
+        {
+          return GetNameForShareStatusTypeCStr(enumValue);
         }
 
       } // namespace ShareStatusTypeMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace StorageTypeMapper
       {
 
-        static const int UNLIMITED_HASH = HashingUtils::HashString("UNLIMITED");
-        static const int QUOTA_HASH = HashingUtils::HashString("QUOTA");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UNLIMITED",
+          "QUOTA",
+        };
 
         StorageType GetStorageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNLIMITED_HASH)
-          {
-            return StorageType::UNLIMITED;
-          }
-          else if (hashCode == QUOTA_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return StorageType::QUOTA;
+          case 379545793:
+            if (name == "UNLIMITED")
+            {
+              return StorageType::UNLIMITED;
+            }
+            break;
+          case 77416024:
+            if (name == "QUOTA")
+            {
+              return StorageType::QUOTA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return StorageType::NOT_SET;
         }
 
-        Aws::String GetNameForStorageType(StorageType enumValue)
+        const char* GetNameForStorageTypeCStr(StorageType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case StorageType::UNLIMITED:
-            return "UNLIMITED";
-          case StorageType::QUOTA:
-            return "QUOTA";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForStorageType(StorageType enumValue)
+        {
+          return GetNameForStorageTypeCStr(enumValue);
         }
 
       } // namespace StorageTypeMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace SubscriptionProtocolTypeMapper
       {
 
-        static const int HTTPS_HASH = HashingUtils::HashString("HTTPS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "HTTPS",
+        };
 
         SubscriptionProtocolType GetSubscriptionProtocolTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTPS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return SubscriptionProtocolType::HTTPS;
+          case 69079243:
+            if (name == "HTTPS")
+            {
+              return SubscriptionProtocolType::HTTPS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return SubscriptionProtocolType::NOT_SET;
         }
 
-        Aws::String GetNameForSubscriptionProtocolType(SubscriptionProtocolType enumValue)
+        const char* GetNameForSubscriptionProtocolTypeCStr(SubscriptionProtocolType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case SubscriptionProtocolType::HTTPS:
-            return "HTTPS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForSubscriptionProtocolType(SubscriptionProtocolType enumValue)
+        {
+          return GetNameForSubscriptionProtocolTypeCStr(enumValue);
         }
 
       } // namespace SubscriptionProtocolTypeMapper
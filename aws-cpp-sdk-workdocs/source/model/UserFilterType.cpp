@@ -30,20 +30,37 @@ namespace Aws
       namespace UserFilterTypeMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int ACTIVE_PENDING_HASH = HashingUtils::HashString("ACTIVE_PENDING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ALL",
+          "ACTIVE_PENDING",
+        };
 
         UserFilterType GetUserFilterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
-          {
-            return UserFilterType::ALL;
-          }
-          else if (hashCode == ACTIVE_PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UserFilterType::ACTIVE_PENDING;
+          case 64897:
+            if (name == "ALL")
+            {
+              return UserFilterType::ALL;
+            }
+            break;
+          case 1457899838:
+            if (name == "ACTIVE_PENDING")
+            {
+              return UserFilterType::ACTIVE_PENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return UserFilterType::NOT_SET;
         }
 
-        Aws::String GetNameForUserFilterType(UserFilterType enumValue)
+        const char* GetNameForUserFilterTypeCStr(UserFilterType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UserFilterType::ALL:
-            return "ALL";
-          case UserFilterType::ACTIVE_PENDING:
-            return "ACTIVE_PENDING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUserFilterType(UserFilterType enumValue)
+        {
+          return GetNameForUserFilterTypeCStr(enumValue);
         }
 
       } // namespace UserFilterTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace UserSortTypeMapper
       {
 
-        static const int USER_NAME_HASH = HashingUtils::HashString("USER_NAME");
-        static const int FULL_NAME_HASH = HashingUtils::HashString("FULL_NAME");
-        static const int STORAGE_LIMIT_HASH = HashingUtils::HashString("STORAGE_LIMIT");
-        static const int USER_STATUS_HASH = HashingUtils::HashString("USER_STATUS");
-        static const int STORAGE_USED_HASH = HashingUtils::HashString("STORAGE_USED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USER_NAME",
+          "FULL_NAME",
+          "STORAGE_LIMIT",
+          "USER_STATUS",
+          "STORAGE_USED",
+        };
 
         UserSortType GetUserSortTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_NAME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UserSortType::USER_NAME;
-          }
-          else if (hashCode == FULL_NAME_HASH)
-          {
-            return UserSortType::FULL_NAME;
-          }
-          else if (hashCode == STORAGE_LIMIT_HASH)
-          {
-            return UserSortType::STORAGE_LIMIT;
-          }
-          else if (hashCode == USER_STATUS_HASH)
-          {
-            return UserSortType::USER_STATUS;
-          }
-          else if (hashCode == STORAGE_USED_HASH)
-          {
-            return UserSortType::STORAGE_USED;
+          case -1139478913:
+            if (name == "USER_NAME")
+            {
+              return UserSortType::USER_NAME;
+            }
+            break;
+          case 1138971195:
+            if (name == "FULL_NAME")
+            {
+              return UserSortType::FULL_NAME;
+            }
+            break;
+          case 1781404855:
+            if (name == "STORAGE_LIMIT")
+            {
+              return UserSortType::STORAGE_LIMIT;
+            }
+            break;
+          case 337777382:
+            if (name == "USER_STATUS")
+            {
+              return UserSortType::USER_STATUS;
+            }
+            break;
+          case -1050636511:
+            if (name == "STORAGE_USED")
+            {
+              return UserSortType::STORAGE_USED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return UserSortType::NOT_SET;
         }
 
-        Aws::String GetNameForUserSortType(UserSortType enumValue)
+        const char* GetNameForUserSortTypeCStr(UserSortType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UserSortType::USER_NAME:
-            return "USER_NAME";
-          case UserSortType::FULL_NAME:
-            return "FULL_NAME";
-          case UserSortType::STORAGE_LIMIT:
-            return "STORAGE_LIMIT";
-          case UserSortType::USER_STATUS:
-            return "USER_STATUS";
-          case UserSortType::STORAGE_USED:
-            return "STORAGE_USED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUserSortType(UserSortType enumValue)
+        {
+          return GetNameForUserSortTypeCStr(enumValue);
         }
 
       } // namespace UserSortTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace UserStatusTypeMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ACTIVE",
+          "INACTIVE",
+          "PENDING",
+        };
 
         UserStatusType GetUserStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
-          {
-            return UserStatusType::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UserStatusType::INACTIVE;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return UserStatusType::PENDING;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return UserStatusType::ACTIVE;
+            }
+            break;
+          case 807292011:
+            if (name == "INACTIVE")
+            {
+              return UserStatusType::INACTIVE;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return UserStatusType::PENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return UserStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForUserStatusType(UserStatusType enumValue)
+        const char* GetNameForUserStatusTypeCStr(UserStatusType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UserStatusType::ACTIVE:
-            return "ACTIVE";
-          case UserStatusType::INACTIVE:
-            return "INACTIVE";
-          case UserStatusType::PENDING:
-            return "PENDING";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUserStatusType(UserStatusType enumValue)
+        {
+          return GetNameForUserStatusTypeCStr(enumValue);
         }
 
       } // namespace UserStatusTypeMapper
@@ -30,35 +30,58 @@ namespace Aws
       namespace UserTypeMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int ADMIN_HASH = HashingUtils::HashString("ADMIN");
-        static const int POWERUSER_HASH = HashingUtils::HashString("POWERUSER");
-        static const int MINIMALUSER_HASH = HashingUtils::HashString("MINIMALUSER");
-        static const int WORKSPACESUSER_HASH = HashingUtils::HashString("WORKSPACESUSER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USER",
+          "ADMIN",
+          "POWERUSER",
+          "MINIMALUSER",
+          "WORKSPACESUSER",
+        };
 
         UserType GetUserTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UserType::USER;
-          }
-          else if (hashCode == ADMIN_HASH)
-          {
-            return UserType::ADMIN;
-          }
-          else if (hashCode == POWERUSER_HASH)
-          {
-            return UserType::POWERUSER;
-          }
-          else if (hashCode == MINIMALUSER_HASH)
-          {
-            return UserType::MINIMALUSER;
-          }
-          else if (hashCode == WORKSPACESUSER_HASH)
-          {
-            return UserType::WORKSPACESUSER;
+          case 2614219:
+            if (name == "USER")
+            {
+              return UserType::USER;
+            }
+            break;
+          case 62130991:
+            if (name == "ADMIN")
+            {
+              return UserType::ADMIN;
+            }
+            break;
+          case -662210000:
+            if (name == "POWERUSER")
+            {
+              return UserType::POWERUSER;
+            }
+            break;
+          case -1706273588:
+            if (name == "MINIMALUSER")
+            {
+              return UserType::MINIMALUSER;
+            }
+            break;
+          case -1362229431:
+            if (name == "WORKSPACESUSER")
+            {
+              return UserType::WORKSPACESUSER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return UserType::NOT_SET;
         }
 
-        Aws::String GetNameForUserType(UserType enumValue)
+        const char* GetNameForUserTypeCStr(UserType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UserType::USER:
-            return "USER";
-          case UserType::ADMIN:
-            return "ADMIN";
-          case UserType::POWERUSER:
-            return "POWERUSER";
-          case UserType::MINIMALUSER:
-            return "MINIMALUSER";
-          case UserType::WORKSPACESUSER:
-            return "WORKSPACESUSER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUserType(UserType enumValue)
+        {
+          return GetNameForUserTypeCStr(enumValue);
         }
 
       } // namespace UserTypeMapper
@@ -36,6 +36,11 @@ namespace EntityStateMapper
 AWS_WORKMAIL_API EntityState GetEntityStateForName(const Aws::String& name);
 
 AWS_WORKMAIL_API Aws::String GetNameForEntityState(EntityState value);
+
+/**
+ * Same as GetNameForEntityState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKMAIL_API const char* GetNameForEntityStateCStr(EntityState value);
 } // namespace EntityStateMapper
 } // namespace Model
 } // namespace WorkMail
@@ -35,6 +35,11 @@ namespace MemberTypeMapper
 AWS_WORKMAIL_API MemberType GetMemberTypeForName(const Aws::String& name);
 
 AWS_WORKMAIL_API Aws::String GetNameForMemberType(MemberType value);
+
+/**
+ * Same as GetNameForMemberType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKMAIL_API const char* GetNameForMemberTypeCStr(MemberType value);
 } // namespace MemberTypeMapper
 } // namespace Model
 } // namespace WorkMail
@@ -36,6 +36,11 @@ namespace PermissionTypeMapper
 AWS_WORKMAIL_API PermissionType GetPermissionTypeForName(const Aws::String& name);
 
 AWS_WORKMAIL_API Aws::String GetNameForPermissionType(PermissionType value);
+
+/**
+ * Same as GetNameForPermissionType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKMAIL_API const char* GetNameForPermissionTypeCStr(PermissionType value);
 } // namespace PermissionTypeMapper
 } // namespace Model
 } // namespace WorkMail
@@ -35,6 +35,11 @@ namespace ResourceTypeMapper
 AWS_WORKMAIL_API ResourceType GetResourceTypeForName(const Aws::String& name);
 
 AWS_WORKMAIL_API Aws::String GetNameForResourceType(ResourceType value);
+
+/**
+ * Same as GetNameForResourceType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKMAIL_API const char* GetNameForResourceTypeCStr(ResourceType value);
 } // namespace ResourceTypeMapper
 } // namespace Model
 } // namespace WorkMail
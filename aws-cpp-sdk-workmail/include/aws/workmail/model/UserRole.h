@@ -36,6 +36,11 @@ namespace UserRoleMapper
 AWS_WORKMAIL_API UserRole GetUserRoleForName(const Aws::String& name);
 
 AWS_WORKMAIL_API Aws::String GetNameForUserRole(UserRole value);
+
+/**
+ * Same as GetNameForUserRole(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKMAIL_API const char* GetNameForUserRoleCStr(UserRole value);
 } // namespace UserRoleMapper
 } // namespace Model
 } // namespace WorkMail
@@ -30,20 +30,37 @@ namespace Aws
       namespace MemberTypeMapper
       {
 
-        static const int GROUP_HASH = HashingUtils::HashString("GROUP");
-        static const int USER_HASH = HashingUtils::HashString("USER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "GROUP",
+          "USER",
+        };
 
         MemberType GetMemberTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GROUP_HASH)
-          {
-            return MemberType::GROUP;
-          }
-          else if (hashCode == USER_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return MemberType::USER;
+          case 68091487:
+            if (name == "GROUP")
+            {
+              return MemberType::GROUP;
+            }
+            break;
+          case 2614219:
+            if (name == "USER")
+            {
+              return MemberType::USER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return MemberType::NOT_SET;
         }
 
-        Aws::String GetNameForMemberType(MemberType enumValue)
+        const char* GetNameForMemberTypeCStr(MemberType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case MemberType::GROUP:
-            return "GROUP";
-          case MemberType::USER:
-            return "USER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForMemberType(MemberType enumValue)
+        {
+          return GetNameForMemberTypeCStr(enumValue);
         }
 
       } // namespace MemberTypeMapper
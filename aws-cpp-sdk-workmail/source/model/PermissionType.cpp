@@ -30,25 +30,44 @@ namespace Aws
       namespace PermissionTypeMapper
       {
 
-        static const int FULL_ACCESS_HASH = HashingUtils::HashString("FULL_ACCESS");
-        static const int SEND_AS_HASH = HashingUtils::HashString("SEND_AS");
-        static const int SEND_ON_BEHALF_HASH = HashingUtils::HashString("SEND_ON_BEHALF");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "FULL_ACCESS",
+          "SEND_AS",
+          "SEND_ON_BEHALF",
+        };
 
         PermissionType GetPermissionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_ACCESS_HASH)
-          {
-            return PermissionType::FULL_ACCESS;
-          }
-          else if (hashCode == SEND_AS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return PermissionType::SEND_AS;
-          }
-          else if (hashCode == SEND_ON_BEHALF_HASH)
-          {
-            return PermissionType::SEND_ON_BEHALF;
+          case -1035969260:
+            if (name == "FULL_ACCESS")
+            {
+              return PermissionType::FULL_ACCESS;
+            }
+            break;
+          case -1597040567:
+            if (name == "SEND_AS")
+            {
+              return PermissionType::SEND_AS;
+            }
+            break;
+          case -1911436961:
+            if (name == "SEND_ON_BEHALF")
+            {
+              return PermissionType::SEND_ON_BEHALF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return PermissionType::NOT_SET;
         }
 
-        Aws::String GetNameForPermissionType(PermissionType enumValue)
+        const char* GetNameForPermissionTypeCStr(PermissionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case PermissionType::FULL_ACCESS:
-            return "FULL_ACCESS";
-          case PermissionType::SEND_AS:
-            return "SEND_AS";
-          case PermissionType::SEND_ON_BEHALF:
-            return "SEND_ON_BEHALF";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForPermissionType(PermissionType enumValue)
+        {
+          return GetNameForPermissionTypeCStr(enumValue);
         }
 
       } // namespace PermissionTypeMapper
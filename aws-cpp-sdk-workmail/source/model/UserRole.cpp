@@ -30,25 +30,44 @@ namespace Aws
       namespace UserRoleMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int RESOURCE_HASH = HashingUtils::HashString("RESOURCE");
-        static const int SYSTEM_USER_HASH = HashingUtils::HashString("SYSTEM_USER");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "USER",
+          "RESOURCE",
+          "SYSTEM_USER",
+        };
 
         UserRole GetUserRoleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
-          {
-            return UserRole::USER;
-          }
-          else if (hashCode == RESOURCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return UserRole::RESOURCE;
-          }
-          else if (hashCode == SYSTEM_USER_HASH)
-          {
-            return UserRole::SYSTEM_USER;
+          case 2614219:
+            if (name == "USER")
+            {
+              return UserRole::USER;
+            }
+            break;
+          case 441562126:
+            if (name == "RESOURCE")
+            {
+              return UserRole::RESOURCE;
+            }
+            break;
+          case 647412699:
+            if (name == "SYSTEM_USER")
+            {
+              return UserRole::SYSTEM_USER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return UserRole::NOT_SET;
         }
 
-        Aws::String GetNameForUserRole(UserRole enumValue)
+        const char* GetNameForUserRoleCStr(UserRole enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case UserRole::USER:
-            return "USER";
-          case UserRole::RESOURCE:
-            return "RESOURCE";
-          case UserRole::SYSTEM_USER:
-            return "SYSTEM_USER";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForUserRole(UserRole enumValue)
+        {
+          return GetNameForUserRoleCStr(enumValue);
         }
 
       } // namespace UserRoleMapper
@@ -40,6 +40,11 @@ namespace ComputeMapper
 AWS_WORKSPACES_API Compute GetComputeForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForCompute(Compute value);
+
+/**
+ * Same as GetNameForCompute(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForComputeCStr(Compute value);
 } // namespace ComputeMapper
 } // namespace Model
 } // namespace WorkSpaces
@@ -36,6 +36,11 @@ namespace ConnectionStateMapper
 AWS_WORKSPACES_API ConnectionState GetConnectionStateForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForConnectionState(ConnectionState value);
+
+/**
+ * Same as GetNameForConnectionState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForConnectionStateCStr(ConnectionState value);
 } // namespace ConnectionStateMapper
 } // namespace Model
 } // namespace WorkSpaces
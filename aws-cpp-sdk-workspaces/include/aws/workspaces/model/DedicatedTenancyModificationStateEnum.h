@@ -36,6 +36,11 @@ namespace DedicatedTenancyModificationStateEnumMapper
 AWS_WORKSPACES_API DedicatedTenancyModificationStateEnum GetDedicatedTenancyModificationStateEnumForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForDedicatedTenancyModificationStateEnum(DedicatedTenancyModificationStateEnum value);
+
+/**
+ * Same as GetNameForDedicatedTenancyModificationStateEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForDedicatedTenancyModificationStateEnumCStr(DedicatedTenancyModificationStateEnum value);
 } // namespace DedicatedTenancyModificationStateEnumMapper
 } // namespace Model
 } // namespace WorkSpaces
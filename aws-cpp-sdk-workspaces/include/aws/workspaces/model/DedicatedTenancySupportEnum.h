@@ -34,6 +34,11 @@ namespace DedicatedTenancySupportEnumMapper
 AWS_WORKSPACES_API DedicatedTenancySupportEnum GetDedicatedTenancySupportEnumForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForDedicatedTenancySupportEnum(DedicatedTenancySupportEnum value);
+
+/**
+ * Same as GetNameForDedicatedTenancySupportEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForDedicatedTenancySupportEnumCStr(DedicatedTenancySupportEnum value);
 } // namespace DedicatedTenancySupportEnumMapper
 } // namespace Model
 } // namespace WorkSpaces
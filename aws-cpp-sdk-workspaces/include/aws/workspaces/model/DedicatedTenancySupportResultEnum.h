@@ -35,6 +35,11 @@ namespace DedicatedTenancySupportResultEnumMapper
 AWS_WORKSPACES_API DedicatedTenancySupportResultEnum GetDedicatedTenancySupportResultEnumForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForDedicatedTenancySupportResultEnum(DedicatedTenancySupportResultEnum value);
+
+/**
+ * Same as GetNameForDedicatedTenancySupportResultEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForDedicatedTenancySupportResultEnumCStr(DedicatedTenancySupportResultEnum value);
 } // namespace DedicatedTenancySupportResultEnumMapper
 } // namespace Model
 } // namespace WorkSpaces
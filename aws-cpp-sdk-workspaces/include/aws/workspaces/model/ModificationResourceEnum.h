@@ -36,6 +36,11 @@ namespace ModificationResourceEnumMapper
 AWS_WORKSPACES_API ModificationResourceEnum GetModificationResourceEnumForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForModificationResourceEnum(ModificationResourceEnum value);
+
+/**
+ * Same as GetNameForModificationResourceEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForModificationResourceEnumCStr(ModificationResourceEnum value);
 } // namespace ModificationResourceEnumMapper
 } // namespace Model
 } // namespace WorkSpaces
@@ -35,6 +35,11 @@ namespace ModificationStateEnumMapper
 AWS_WORKSPACES_API ModificationStateEnum GetModificationStateEnumForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForModificationStateEnum(ModificationStateEnum value);
+
+/**
+ * Same as GetNameForModificationStateEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForModificationStateEnumCStr(ModificationStateEnum value);
 } // namespace ModificationStateEnumMapper
 } // namespace Model
 } // namespace WorkSpaces
@@ -35,6 +35,11 @@ namespace OperatingSystemTypeMapper
 AWS_WORKSPACES_API OperatingSystemType GetOperatingSystemTypeForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForOperatingSystemType(OperatingSystemType value);
+
+/**
+ * Same as GetNameForOperatingSystemType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForOperatingSystemTypeCStr(OperatingSystemType value);
 } // namespace OperatingSystemTypeMapper
 } // namespace Model
 } // namespace WorkSpaces
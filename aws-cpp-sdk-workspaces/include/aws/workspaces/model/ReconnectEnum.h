@@ -35,6 +35,11 @@ namespace ReconnectEnumMapper
 AWS_WORKSPACES_API ReconnectEnum GetReconnectEnumForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForReconnectEnum(ReconnectEnum value);
+
+/**
+ * Same as GetNameForReconnectEnum(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForReconnectEnumCStr(ReconnectEnum value);
 } // namespace ReconnectEnumMapper
 } // namespace Model
 } // namespace WorkSpaces
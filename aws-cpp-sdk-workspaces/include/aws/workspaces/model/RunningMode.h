@@ -35,6 +35,11 @@ namespace RunningModeMapper
 AWS_WORKSPACES_API RunningMode GetRunningModeForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForRunningMode(RunningMode value);
+
+/**
+ * Same as GetNameForRunningMode(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForRunningModeCStr(RunningMode value);
 } // namespace RunningModeMapper
 } // namespace Model
 } // namespace WorkSpaces
@@ -35,6 +35,11 @@ namespace TargetWorkspaceStateMapper
 AWS_WORKSPACES_API TargetWorkspaceState GetTargetWorkspaceStateForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForTargetWorkspaceState(TargetWorkspaceState value);
+
+/**
+ * Same as GetNameForTargetWorkspaceState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForTargetWorkspaceStateCStr(TargetWorkspaceState value);
 } // namespace TargetWorkspaceStateMapper
 } // namespace Model
 } // namespace WorkSpaces
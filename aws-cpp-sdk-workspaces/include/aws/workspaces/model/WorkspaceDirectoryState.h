@@ -38,6 +38,11 @@ namespace WorkspaceDirectoryStateMapper
 AWS_WORKSPACES_API WorkspaceDirectoryState GetWorkspaceDirectoryStateForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForWorkspaceDirectoryState(WorkspaceDirectoryState value);
+
+/**
+ * Same as GetNameForWorkspaceDirectoryState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForWorkspaceDirectoryStateCStr(WorkspaceDirectoryState value);
 } // namespace WorkspaceDirectoryStateMapper
 } // namespace Model
 } // namespace WorkSpaces
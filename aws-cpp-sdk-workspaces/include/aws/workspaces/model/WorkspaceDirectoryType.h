@@ -35,6 +35,11 @@ namespace WorkspaceDirectoryTypeMapper
 AWS_WORKSPACES_API WorkspaceDirectoryType GetWorkspaceDirectoryTypeForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForWorkspaceDirectoryType(WorkspaceDirectoryType value);
+
+/**
+ * Same as GetNameForWorkspaceDirectoryType(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForWorkspaceDirectoryTypeCStr(WorkspaceDirectoryType value);
 } // namespace WorkspaceDirectoryTypeMapper
 } // namespace Model
 } // namespace WorkSpaces
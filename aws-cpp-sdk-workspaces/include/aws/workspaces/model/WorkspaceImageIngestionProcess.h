@@ -36,6 +36,11 @@ namespace WorkspaceImageIngestionProcessMapper
 AWS_WORKSPACES_API WorkspaceImageIngestionProcess GetWorkspaceImageIngestionProcessForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForWorkspaceImageIngestionProcess(WorkspaceImageIngestionProcess value);
+
+/**
+ * Same as GetNameForWorkspaceImageIngestionProcess(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForWorkspaceImageIngestionProcessCStr(WorkspaceImageIngestionProcess value);
 } // namespace WorkspaceImageIngestionProcessMapper
 } // namespace Model
 } // namespace WorkSpaces
@@ -35,6 +35,11 @@ namespace WorkspaceImageRequiredTenancyMapper
 AWS_WORKSPACES_API WorkspaceImageRequiredTenancy GetWorkspaceImageRequiredTenancyForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForWorkspaceImageRequiredTenancy(WorkspaceImageRequiredTenancy value);
+
+/**
+ * Same as GetNameForWorkspaceImageRequiredTenancy(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForWorkspaceImageRequiredTenancyCStr(WorkspaceImageRequiredTenancy value);
 } // namespace WorkspaceImageRequiredTenancyMapper
 } // namespace Model
 } // namespace WorkSpaces
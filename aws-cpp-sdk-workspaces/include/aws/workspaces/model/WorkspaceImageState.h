@@ -36,6 +36,11 @@ namespace WorkspaceImageStateMapper
 AWS_WORKSPACES_API WorkspaceImageState GetWorkspaceImageStateForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForWorkspaceImageState(WorkspaceImageState value);
+
+/**
+ * Same as GetNameForWorkspaceImageState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForWorkspaceImageStateCStr(WorkspaceImageState value);
 } // namespace WorkspaceImageStateMapper
 } // namespace Model
 } // namespace WorkSpaces
@@ -49,6 +49,11 @@ namespace WorkspaceStateMapper
 AWS_WORKSPACES_API WorkspaceState GetWorkspaceStateForName(const Aws::String& name);
 
 AWS_WORKSPACES_API Aws::String GetNameForWorkspaceState(WorkspaceState value);
+
+/**
+ * Same as GetNameForWorkspaceState(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_WORKSPACES_API const char* GetNameForWorkspaceStateCStr(WorkspaceState value);
 } // namespace WorkspaceStateMapper
 } // namespace Model
 } // namespace WorkSpaces
@@ -30,45 +30,72 @@ namespace Aws
       namespace ComputeMapper
       {
 
-        static const int VALUE_HASH = HashingUtils::HashString("VALUE");
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int PERFORMANCE_HASH = HashingUtils::HashString("PERFORMANCE");
-        static const int POWER_HASH = HashingUtils::HashString("POWER");
-        static const int GRAPHICS_HASH = HashingUtils::HashString("GRAPHICS");
-        static const int POWERPRO_HASH = HashingUtils::HashString("POWERPRO");
-        static const int GRAPHICSPRO_HASH = HashingUtils::HashString("GRAPHICSPRO");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "VALUE",
+          "STANDARD",
+          "PERFORMANCE",
+          "POWER",
+          "GRAPHICS",
+          "POWERPRO",
+          "GRAPHICSPRO",
+        };
 
         Compute GetComputeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VALUE_HASH)
-          {
-            return Compute::VALUE;
-          }
-          else if (hashCode == STANDARD_HASH)
-          {
-            return Compute::STANDARD;
-          }
-          else if (hashCode == PERFORMANCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return Compute::PERFORMANCE;
-          }
-          else if (hashCode == POWER_HASH)
-          {
-            return Compute::POWER;
-          }
-          else if (hashCode == GRAPHICS_HASH)
-          {
-            return Compute::GRAPHICS;
-          }
-          else if (hashCode == POWERPRO_HASH)
-          {
-            return Compute::POWERPRO;
-          }
-          else if (hashCode == GRAPHICSPRO_HASH)
-          {
-            return Compute::GRAPHICSPRO;
+          case 81434961:
+            if (name == "VALUE")
+            {
+              return Compute::VALUE;
+            }
+            break;
+          case 2095255229:
+            if (name == "STANDARD")
+            {
+              return Compute::STANDARD;
+            }
+            break;
+          case 672572432:
+            if (name == "PERFORMANCE")
+            {
+              return Compute::PERFORMANCE;
+            }
+            break;
+          case 76320997:
+            if (name == "POWER")
+            {
+              return Compute::POWER;
+            }
+            break;
+          case 883333771:
+            if (name == "GRAPHICS")
+            {
+              return Compute::GRAPHICS;
+            }
+            break;
+          case 1641201544:
+            if (name == "POWERPRO")
+            {
+              return Compute::POWERPRO;
+            }
+            break;
+          case 131828770:
+            if (name == "GRAPHICSPRO")
+            {
+              return Compute::GRAPHICSPRO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,33 +107,26 @@ namespace Aws
           return Compute::NOT_SET;
         }
 
-        Aws::String GetNameForCompute(Compute enumValue)
+        const char* GetNameForComputeCStr(Compute enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case Compute::VALUE:
-            return "VALUE";
-          case Compute::STANDARD:
-            return "STANDARD";
-          case Compute::PERFORMANCE:
-            return "PERFORMANCE";
-          case Compute::POWER:
-            return "POWER";
-          case Compute::GRAPHICS:
-            return "GRAPHICS";
-          case Compute::POWERPRO:
-            return "POWERPRO";
-          case Compute::GRAPHICSPRO:
-            return "GRAPHICSPRO";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForCompute(Compute enumValue)
+        {
+          return GetNameForComputeCStr(enumValue);
         }
 
       } // namespace ComputeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ConnectionStateMapper
       {
 
-        static const int CONNECTED_HASH = HashingUtils::HashString("CONNECTED");
-        static const int DISCONNECTED_HASH = HashingUtils::HashString("DISCONNECTED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "CONNECTED",
+          "DISCONNECTED",
+          "UNKNOWN",
+        };
 
         ConnectionState GetConnectionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONNECTED_HASH)
-          {
-            return ConnectionState::CONNECTED;
-          }
-          else if (hashCode == DISCONNECTED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ConnectionState::DISCONNECTED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return ConnectionState::UNKNOWN;
+          case -2087582999:
+            if (name == "CONNECTED")
+            {
+              return ConnectionState::CONNECTED;
+            }
+            break;
+          case 935892539:
+            if (name == "DISCONNECTED")
+            {
+              return ConnectionState::DISCONNECTED;
+            }
+            break;
+          case 433141802:
+            if (name == "UNKNOWN")
+            {
+              return ConnectionState::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ConnectionState::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionState(ConnectionState enumValue)
+        const char* GetNameForConnectionStateCStr(ConnectionState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ConnectionState::CONNECTED:
-            return "CONNECTED";
-          case ConnectionState::DISCONNECTED:
-            return "DISCONNECTED";
-          case ConnectionState::UNKNOWN:
-            return "UNKNOWN";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForConnectionState(ConnectionState enumValue)
+        {
+          return GetNameForConnectionStateCStr(enumValue);
         }
 
       } // namespace ConnectionStateMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace DedicatedTenancyModificationStateEnumMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "COMPLETED",
+          "FAILED",
+        };
 
         DedicatedTenancyModificationStateEnum GetDedicatedTenancyModificationStateEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return DedicatedTenancyModificationStateEnum::PENDING;
-          }
-          else if (hashCode == COMPLETED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DedicatedTenancyModificationStateEnum::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return DedicatedTenancyModificationStateEnum::FAILED;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return DedicatedTenancyModificationStateEnum::PENDING;
+            }
+            break;
+          case 1383663147:
+            if (name == "COMPLETED")
+            {
+              return DedicatedTenancyModificationStateEnum::COMPLETED;
+            }
+            break;
+          case 2066319421:
+            if (name == "FAILED")
+            {
+              return DedicatedTenancyModificationStateEnum::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return DedicatedTenancyModificationStateEnum::NOT_SET;
         }
 
-        Aws::String GetNameForDedicatedTenancyModificationStateEnum(DedicatedTenancyModificationStateEnum enumValue)
+        const char* GetNameForDedicatedTenancyModificationStateEnumCStr(DedicatedTenancyModificationStateEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DedicatedTenancyModificationStateEnum::PENDING:
-            return "PENDING";
-          case DedicatedTenancyModificationStateEnum::COMPLETED:
-            return "COMPLETED";
-          case DedicatedTenancyModificationStateEnum::FAILED:
-            return "FAILED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDedicatedTenancyModificationStateEnum(DedicatedTenancyModificationStateEnum enumValue)
+        {
+          return GetNameForDedicatedTenancyModificationStateEnumCStr(enumValue);
         }
 
       } // namespace DedicatedTenancyModificationStateEnumMapper
@@ -30,15 +30,30 @@ namespace Aws
       namespace DedicatedTenancySupportEnumMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ENABLED",
+        };
 
         DedicatedTenancySupportEnum GetDedicatedTenancySupportEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return DedicatedTenancySupportEnum::ENABLED;
+          case -891611359:
+            if (name == "ENABLED")
+            {
+              return DedicatedTenancySupportEnum::ENABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,21 +65,26 @@ namespace Aws
           return DedicatedTenancySupportEnum::NOT_SET;
         }
 
-        Aws::String GetNameForDedicatedTenancySupportEnum(DedicatedTenancySupportEnum enumValue)
+        const char* GetNameForDedicatedTenancySupportEnumCStr(DedicatedTenancySupportEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case DedicatedTenancySupportEnum::ENABLED:
-            return "ENABLED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForDedicatedTenancySupportEnum(DedicatedTenancySupportEnum enumValue)
+        {
+          return GetNameForDedicatedTenancySupportEnumCStr(enumValue);
         }
 
       } // namespace DedicatedTenancySupportEnumMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace ModificationResourceEnumMapper
       {
 
-        static const int ROOT_VOLUME_HASH = HashingUtils::HashString("ROOT_VOLUME");
-        static const int USER_VOLUME_HASH = HashingUtils::HashString("USER_VOLUME");
-        static const int COMPUTE_TYPE_HASH = HashingUtils::HashString("COMPUTE_TYPE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "ROOT_VOLUME",
+          "USER_VOLUME",
+          "COMPUTE_TYPE",
+        };
 
         ModificationResourceEnum GetModificationResourceEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ROOT_VOLUME_HASH)
-          {
-            return ModificationResourceEnum::ROOT_VOLUME;
-          }
-          else if (hashCode == USER_VOLUME_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ModificationResourceEnum::USER_VOLUME;
-          }
-          else if (hashCode == COMPUTE_TYPE_HASH)
-          {
-            return ModificationResourceEnum::COMPUTE_TYPE;
+          case 597294359:
+            if (name == "ROOT_VOLUME")
+            {
+              return ModificationResourceEnum::ROOT_VOLUME;
+            }
+            break;
+          case 419375630:
+            if (name == "USER_VOLUME")
+            {
+              return ModificationResourceEnum::USER_VOLUME;
+            }
+            break;
+          case 435888738:
+            if (name == "COMPUTE_TYPE")
+            {
+              return ModificationResourceEnum::COMPUTE_TYPE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return ModificationResourceEnum::NOT_SET;
         }
 
-        Aws::String GetNameForModificationResourceEnum(ModificationResourceEnum enumValue)
+        const char* GetNameForModificationResourceEnumCStr(ModificationResourceEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ModificationResourceEnum::ROOT_VOLUME:
-            return "ROOT_VOLUME";
-          case ModificationResourceEnum::USER_VOLUME:
-            return "USER_VOLUME";
-          case ModificationResourceEnum::COMPUTE_TYPE:
-            return "COMPUTE_TYPE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForModificationResourceEnum(ModificationResourceEnum enumValue)
+        {
+          return GetNameForModificationResourceEnumCStr(enumValue);
         }
 
       } // namespace ModificationResourceEnumMapper
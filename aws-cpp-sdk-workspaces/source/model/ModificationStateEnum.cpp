@@ -30,20 +30,37 @@ namespace Aws
       namespace ModificationStateEnumMapper
       {
 
-        static const int UPDATE_INITIATED_HASH = HashingUtils::HashString("UPDATE_INITIATED");
-        static const int UPDATE_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_IN_PROGRESS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UPDATE_INITIATED",
+          "UPDATE_IN_PROGRESS",
+        };
 
         ModificationStateEnum GetModificationStateEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UPDATE_INITIATED_HASH)
-          {
-            return ModificationStateEnum::UPDATE_INITIATED;
-          }
-          else if (hashCode == UPDATE_IN_PROGRESS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return ModificationStateEnum::UPDATE_IN_PROGRESS;
+          case 1855869141:
+            if (name == "UPDATE_INITIATED")
+            {
+              return ModificationStateEnum::UPDATE_INITIATED;
+            }
+            break;
+          case 1375009169:
+            if (name == "UPDATE_IN_PROGRESS")
+            {
+              return ModificationStateEnum::UPDATE_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return ModificationStateEnum::NOT_SET;
         }
 
-        Aws::String GetNameForModificationStateEnum(ModificationStateEnum enumValue)
+        const char* GetNameForModificationStateEnumCStr(ModificationStateEnum enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case ModificationStateEnum::UPDATE_INITIATED:
-            return "UPDATE_INITIATED";
-          case ModificationStateEnum::UPDATE_IN_PROGRESS:
-            return "UPDATE_IN_PROGRESS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForModificationStateEnum(ModificationStateEnum enumValue)
+        {
+          return GetNameForModificationStateEnumCStr(enumValue);
         }
 
       } // namespace ModificationStateEnumMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace OperatingSystemTypeMapper
       {
 
-        static const int WINDOWS_HASH = HashingUtils::HashString("WINDOWS");
-        static const int LINUX_HASH = HashingUtils::HashString("LINUX");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "WINDOWS",
+          "LINUX",
+        };
 
         OperatingSystemType GetOperatingSystemTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WINDOWS_HASH)
-          {
-            return OperatingSystemType::WINDOWS;
-          }
-          else if (hashCode == LINUX_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return OperatingSystemType::LINUX;
+          case 2067476067:
+            if (name == "WINDOWS")
+            {
+              return OperatingSystemType::WINDOWS;
+            }
+            break;
+          case 72440020:
+            if (name == "LINUX")
+            {
+              return OperatingSystemType::LINUX;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return OperatingSystemType::NOT_SET;
         }
 
-        Aws::String GetNameForOperatingSystemType(OperatingSystemType enumValue)
+        const char* GetNameForOperatingSystemTypeCStr(OperatingSystemType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case OperatingSystemType::WINDOWS:
-            return "WINDOWS";
-          case OperatingSystemType::LINUX:
-            return "LINUX";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForOperatingSystemType(OperatingSystemType enumValue)
+        {
+          return GetNameForOperatingSystemTypeCStr(enumValue);
         }
 
       } // namespace OperatingSystemTypeMapper
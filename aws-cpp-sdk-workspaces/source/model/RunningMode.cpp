@@ -30,20 +30,37 @@ namespace Aws
       namespace RunningModeMapper
       {
 
-        static const int AUTO_STOP_HASH = HashingUtils::HashString("AUTO_STOP");
-        static const int ALWAYS_ON_HASH = HashingUtils::HashString("ALWAYS_ON");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AUTO_STOP",
+          "ALWAYS_ON",
+        };
 
         RunningMode GetRunningModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_STOP_HASH)
-          {
-            return RunningMode::AUTO_STOP;
-          }
-          else if (hashCode == ALWAYS_ON_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return RunningMode::ALWAYS_ON;
+          case 182458514:
+            if (name == "AUTO_STOP")
+            {
+              return RunningMode::AUTO_STOP;
+            }
+            break;
+          case -361760241:
+            if (name == "ALWAYS_ON")
+            {
+              return RunningMode::ALWAYS_ON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return RunningMode::NOT_SET;
         }
 
-        Aws::String GetNameForRunningMode(RunningMode enumValue)
+        const char* GetNameForRunningModeCStr(RunningMode enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case RunningMode::AUTO_STOP:
-            return "AUTO_STOP";
-          case RunningMode::ALWAYS_ON:
-            return "ALWAYS_ON";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForRunningMode(RunningMode enumValue)
+        {
+          return GetNameForRunningModeCStr(enumValue);
         }
 
       } // namespace RunningModeMapper
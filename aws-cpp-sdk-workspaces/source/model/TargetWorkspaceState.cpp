@@ -30,20 +30,37 @@ namespace Aws
       namespace TargetWorkspaceStateMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int ADMIN_MAINTENANCE_HASH = HashingUtils::HashString("ADMIN_MAINTENANCE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AVAILABLE",
+          "ADMIN_MAINTENANCE",
+        };
 
         TargetWorkspaceState GetTargetWorkspaceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
-          {
-            return TargetWorkspaceState::AVAILABLE;
-          }
-          else if (hashCode == ADMIN_MAINTENANCE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return TargetWorkspaceState::ADMIN_MAINTENANCE;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return TargetWorkspaceState::AVAILABLE;
+            }
+            break;
+          case -281501213:
+            if (name == "ADMIN_MAINTENANCE")
+            {
+              return TargetWorkspaceState::ADMIN_MAINTENANCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return TargetWorkspaceState::NOT_SET;
         }
 
-        Aws::String GetNameForTargetWorkspaceState(TargetWorkspaceState enumValue)
+        const char* GetNameForTargetWorkspaceStateCStr(TargetWorkspaceState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case TargetWorkspaceState::AVAILABLE:
-            return "AVAILABLE";
-          case TargetWorkspaceState::ADMIN_MAINTENANCE:
-            return "ADMIN_MAINTENANCE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForTargetWorkspaceState(TargetWorkspaceState enumValue)
+        {
+          return GetNameForTargetWorkspaceStateCStr(enumValue);
         }
 
       } // namespace TargetWorkspaceStateMapper
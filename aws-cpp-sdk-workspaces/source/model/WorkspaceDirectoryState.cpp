@@ -30,35 +30,58 @@ namespace Aws
       namespace WorkspaceDirectoryStateMapper
       {
 
-        static const int REGISTERING_HASH = HashingUtils::HashString("REGISTERING");
-        static const int REGISTERED_HASH = HashingUtils::HashString("REGISTERED");
-        static const int DEREGISTERING_HASH = HashingUtils::HashString("DEREGISTERING");
-        static const int DEREGISTERED_HASH = HashingUtils::HashString("DEREGISTERED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "REGISTERING",
+          "REGISTERED",
+          "DEREGISTERING",
+          "DEREGISTERED",
+          "ERROR",
+        };
 
         WorkspaceDirectoryState GetWorkspaceDirectoryStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGISTERING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WorkspaceDirectoryState::REGISTERING;
-          }
-          else if (hashCode == REGISTERED_HASH)
-          {
-            return WorkspaceDirectoryState::REGISTERED;
-          }
-          else if (hashCode == DEREGISTERING_HASH)
-          {
-            return WorkspaceDirectoryState::DEREGISTERING;
-          }
-          else if (hashCode == DEREGISTERED_HASH)
-          {
-            return WorkspaceDirectoryState::DEREGISTERED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return WorkspaceDirectoryState::ERROR_;
+          case 19682879:
+            if (name == "REGISTERING")
+            {
+              return WorkspaceDirectoryState::REGISTERING;
+            }
+            break;
+          case -1384838526:
+            if (name == "REGISTERED")
+            {
+              return WorkspaceDirectoryState::REGISTERED;
+            }
+            break;
+          case 1859887902:
+            if (name == "DEREGISTERING")
+            {
+              return WorkspaceDirectoryState::DEREGISTERING;
+            }
+            break;
+          case -632740413:
+            if (name == "DEREGISTERED")
+            {
+              return WorkspaceDirectoryState::DEREGISTERED;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return WorkspaceDirectoryState::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,29 +93,26 @@ namespace Aws
           return WorkspaceDirectoryState::NOT_SET;
         }
 
-        Aws::String GetNameForWorkspaceDirectoryState(WorkspaceDirectoryState enumValue)
+        const char* GetNameForWorkspaceDirectoryStateCStr(WorkspaceDirectoryState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WorkspaceDirectoryState::REGISTERING:
-            return "REGISTERING";
-          case WorkspaceDirectoryState::REGISTERED:
-            return "REGISTERED";
-          case WorkspaceDirectoryState::DEREGISTERING:
-            return "DEREGISTERING";
-          case WorkspaceDirectoryState::DEREGISTERED:
-            return "DEREGISTERED";
-          case WorkspaceDirectoryState::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWorkspaceDirectoryState(WorkspaceDirectoryState enumValue)
+        {
+          return GetNameForWorkspaceDirectoryStateCStr(enumValue);
         }
 
       } // namespace WorkspaceDirectoryStateMapper
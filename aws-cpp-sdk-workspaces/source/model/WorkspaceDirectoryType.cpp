@@ -30,20 +30,37 @@ namespace Aws
       namespace WorkspaceDirectoryTypeMapper
       {
 
-        static const int SIMPLE_AD_HASH = HashingUtils::HashString("SIMPLE_AD");
-        static const int AD_CONNECTOR_HASH = HashingUtils::HashString("AD_CONNECTOR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "SIMPLE_AD",
+          "AD_CONNECTOR",
+        };
 
         WorkspaceDirectoryType GetWorkspaceDirectoryTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIMPLE_AD_HASH)
-          {
-            return WorkspaceDirectoryType::SIMPLE_AD;
-          }
-          else if (hashCode == AD_CONNECTOR_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WorkspaceDirectoryType::AD_CONNECTOR;
+          case 662245840:
+            if (name == "SIMPLE_AD")
+            {
+              return WorkspaceDirectoryType::SIMPLE_AD;
+            }
+            break;
+          case -1414695151:
+            if (name == "AD_CONNECTOR")
+            {
+              return WorkspaceDirectoryType::AD_CONNECTOR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return WorkspaceDirectoryType::NOT_SET;
         }
 
-        Aws::String GetNameForWorkspaceDirectoryType(WorkspaceDirectoryType enumValue)
+        const char* GetNameForWorkspaceDirectoryTypeCStr(WorkspaceDirectoryType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WorkspaceDirectoryType::SIMPLE_AD:
-            return "SIMPLE_AD";
-          case WorkspaceDirectoryType::AD_CONNECTOR:
-            return "AD_CONNECTOR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWorkspaceDirectoryType(WorkspaceDirectoryType enumValue)
+        {
+          return GetNameForWorkspaceDirectoryTypeCStr(enumValue);
         }
 
       } // namespace WorkspaceDirectoryTypeMapper
@@ -30,25 +30,44 @@ namespace Aws
       namespace WorkspaceImageIngestionProcessMapper
       {
 
-        static const int BYOL_REGULAR_HASH = HashingUtils::HashString("BYOL_REGULAR");
-        static const int BYOL_GRAPHICS_HASH = HashingUtils::HashString("BYOL_GRAPHICS");
-        static const int BYOL_GRAPHICSPRO_HASH = HashingUtils::HashString("BYOL_GRAPHICSPRO");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "BYOL_REGULAR",
+          "BYOL_GRAPHICS",
+          "BYOL_GRAPHICSPRO",
+        };
 
         WorkspaceImageIngestionProcess GetWorkspaceImageIngestionProcessForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BYOL_REGULAR_HASH)
-          {
-            return WorkspaceImageIngestionProcess::BYOL_REGULAR;
-          }
-          else if (hashCode == BYOL_GRAPHICS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WorkspaceImageIngestionProcess::BYOL_GRAPHICS;
-          }
-          else if (hashCode == BYOL_GRAPHICSPRO_HASH)
-          {
-            return WorkspaceImageIngestionProcess::BYOL_GRAPHICSPRO;
+          case 510064305:
+            if (name == "BYOL_REGULAR")
+            {
+              return WorkspaceImageIngestionProcess::BYOL_REGULAR;
+            }
+            break;
+          case -587811338:
+            if (name == "BYOL_GRAPHICS")
+            {
+              return WorkspaceImageIngestionProcess::BYOL_GRAPHICS;
+            }
+            break;
+          case -905825065:
+            if (name == "BYOL_GRAPHICSPRO")
+            {
+              return WorkspaceImageIngestionProcess::BYOL_GRAPHICSPRO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return WorkspaceImageIngestionProcess::NOT_SET;
         }
 
-        Aws::String GetNameForWorkspaceImageIngestionProcess(WorkspaceImageIngestionProcess enumValue)
+        const char* GetNameForWorkspaceImageIngestionProcessCStr(WorkspaceImageIngestionProcess enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WorkspaceImageIngestionProcess::BYOL_REGULAR:
-            return "BYOL_REGULAR";
-          case WorkspaceImageIngestionProcess::BYOL_GRAPHICS:
-            return "BYOL_GRAPHICS";
-          case WorkspaceImageIngestionProcess::BYOL_GRAPHICSPRO:
-            return "BYOL_GRAPHICSPRO";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWorkspaceImageIngestionProcess(WorkspaceImageIngestionProcess enumValue)
+        {
+          return GetNameForWorkspaceImageIngestionProcessCStr(enumValue);
         }
 
       } // namespace WorkspaceImageIngestionProcessMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace WorkspaceImageRequiredTenancyMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int DEDICATED_HASH = HashingUtils::HashString("DEDICATED");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "DEFAULT",
+          "DEDICATED",
+        };
 
         WorkspaceImageRequiredTenancy GetWorkspaceImageRequiredTenancyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
-          {
-            return WorkspaceImageRequiredTenancy::DEFAULT;
-          }
-          else if (hashCode == DEDICATED_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WorkspaceImageRequiredTenancy::DEDICATED;
+          case -2032180703:
+            if (name == "DEFAULT")
+            {
+              return WorkspaceImageRequiredTenancy::DEFAULT;
+            }
+            break;
+          case -278458929:
+            if (name == "DEDICATED")
+            {
+              return WorkspaceImageRequiredTenancy::DEDICATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return WorkspaceImageRequiredTenancy::NOT_SET;
         }
 
-        Aws::String GetNameForWorkspaceImageRequiredTenancy(WorkspaceImageRequiredTenancy enumValue)
+        const char* GetNameForWorkspaceImageRequiredTenancyCStr(WorkspaceImageRequiredTenancy enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WorkspaceImageRequiredTenancy::DEFAULT:
-            return "DEFAULT";
-          case WorkspaceImageRequiredTenancy::DEDICATED:
-            return "DEDICATED";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWorkspaceImageRequiredTenancy(WorkspaceImageRequiredTenancy enumValue)
+        {
+          return GetNameForWorkspaceImageRequiredTenancyCStr(enumValue);
         }
 
       } // namespace WorkspaceImageRequiredTenancyMapper
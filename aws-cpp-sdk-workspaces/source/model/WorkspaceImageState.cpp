@@ -30,25 +30,44 @@ namespace Aws
       namespace WorkspaceImageStateMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "AVAILABLE",
+          "PENDING",
+          "ERROR",
+        };
 
         WorkspaceImageState GetWorkspaceImageStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
-          {
-            return WorkspaceImageState::AVAILABLE;
-          }
-          else if (hashCode == PENDING_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return WorkspaceImageState::PENDING;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return WorkspaceImageState::ERROR_;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return WorkspaceImageState::AVAILABLE;
+            }
+            break;
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return WorkspaceImageState::PENDING;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return WorkspaceImageState::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,25 +79,26 @@ namespace Aws
           return WorkspaceImageState::NOT_SET;
         }
 
-        Aws::String GetNameForWorkspaceImageState(WorkspaceImageState enumValue)
+        const char* GetNameForWorkspaceImageStateCStr(WorkspaceImageState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WorkspaceImageState::AVAILABLE:
-            return "AVAILABLE";
-          case WorkspaceImageState::PENDING:
-            return "PENDING";
-          case WorkspaceImageState::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWorkspaceImageState(WorkspaceImageState enumValue)
+        {
+          return GetNameForWorkspaceImageStateCStr(enumValue);
         }
 
       } // namespace WorkspaceImageStateMapper
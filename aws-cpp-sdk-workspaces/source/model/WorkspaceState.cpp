@@ -30,90 +30,135 @@ namespace Aws
       namespace WorkspaceStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int IMPAIRED_HASH = HashingUtils::HashString("IMPAIRED");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int REBOOTING_HASH = HashingUtils::HashString("REBOOTING");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int REBUILDING_HASH = HashingUtils::HashString("REBUILDING");
-        static const int MAINTENANCE_HASH = HashingUtils::HashString("MAINTENANCE");
-        static const int ADMIN_MAINTENANCE_HASH = HashingUtils::HashString("ADMIN_MAINTENANCE");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "PENDING",
+          "AVAILABLE",
+          "IMPAIRED",
+          "UNHEALTHY",
+          "REBOOTING",
+          "STARTING",
+          "REBUILDING",
+          "MAINTENANCE",
+          "ADMIN_MAINTENANCE",
+          "TERMINATING",
+          "TERMINATED",
+          "SUSPENDED",
+          "UPDATING",
+          "STOPPING",
+          "STOPPED",
+          "ERROR",
+        };
 
         WorkspaceState GetWorkspaceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
-          {
-            return WorkspaceState::PENDING;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return WorkspaceState::AVAILABLE;
-          }
-          else if (hashCode == IMPAIRED_HASH)
-          {
-            return WorkspaceState::IMPAIRED;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
-            return WorkspaceState::UNHEALTHY;
-          }
-          else if (hashCode == REBOOTING_HASH)
-          {
-            return WorkspaceState::REBOOTING;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return WorkspaceState::STARTING;
-          }
-          else if (hashCode == REBUILDING_HASH)
-          {
-            return WorkspaceState::REBUILDING;
-          }
-          else if (hashCode == MAINTENANCE_HASH)
-          {
-            return WorkspaceState::MAINTENANCE;
-          }
-          else if (hashCode == ADMIN_MAINTENANCE_HASH)
-          {
-            return WorkspaceState::ADMIN_MAINTENANCE;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return WorkspaceState::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return WorkspaceState::TERMINATED;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
-            return WorkspaceState::SUSPENDED;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return WorkspaceState::UPDATING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return WorkspaceState::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return WorkspaceState::STOPPED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return WorkspaceState::ERROR_;
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
+          {
+          case 35394935:
+            if (name == "PENDING")
+            {
+              return WorkspaceState::PENDING;
+            }
+            break;
+          case 2052692649:
+            if (name == "AVAILABLE")
+            {
+              return WorkspaceState::AVAILABLE;
+            }
+            break;
+          case 347058973:
+            if (name == "IMPAIRED")
+            {
+              return WorkspaceState::IMPAIRED;
+            }
+            break;
+          case 998988996:
+            if (name == "UNHEALTHY")
+            {
+              return WorkspaceState::UNHEALTHY;
+            }
+            break;
+          case -1404612099:
+            if (name == "REBOOTING")
+            {
+              return WorkspaceState::REBOOTING;
+            }
+            break;
+          case 2099433536:
+            if (name == "STARTING")
+            {
+              return WorkspaceState::STARTING;
+            }
+            break;
+          case 257436135:
+            if (name == "REBUILDING")
+            {
+              return WorkspaceState::REBUILDING;
+            }
+            break;
+          case -1824356621:
+            if (name == "MAINTENANCE")
+            {
+              return WorkspaceState::MAINTENANCE;
+            }
+            break;
+          case -281501213:
+            if (name == "ADMIN_MAINTENANCE")
+            {
+              return WorkspaceState::ADMIN_MAINTENANCE;
+            }
+            break;
+          case 234379966:
+            if (name == "TERMINATING")
+            {
+              return WorkspaceState::TERMINATING;
+            }
+            break;
+          case -823723485:
+            if (name == "TERMINATED")
+            {
+              return WorkspaceState::TERMINATED;
+            }
+            break;
+          case 1124965819:
+            if (name == "SUSPENDED")
+            {
+              return WorkspaceState::SUSPENDED;
+            }
+            break;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return WorkspaceState::UPDATING;
+            }
+            break;
+          case -1796691852:
+            if (name == "STOPPING")
+            {
+              return WorkspaceState::STOPPING;
+            }
+            break;
+          case -1166336595:
+            if (name == "STOPPED")
+            {
+              return WorkspaceState::STOPPED;
+            }
+            break;
+          case 66247144:
+            if (name == "ERROR")
+            {
+              return WorkspaceState::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -125,51 +170,26 @@ namespace Aws
           return WorkspaceState::NOT_SET;
         }
 
-        Aws::String GetNameForWorkspaceState(WorkspaceState enumValue)
+        const char* GetNameForWorkspaceStateCStr(WorkspaceState enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case WorkspaceState::PENDING:
-            return "PENDING";
-          case WorkspaceState::AVAILABLE:
-            return "AVAILABLE";
-          case WorkspaceState::IMPAIRED:
-            return "IMPAIRED";
-          case WorkspaceState::UNHEALTHY:
-            return "UNHEALTHY";
-          case WorkspaceState::REBOOTING:
-            return "REBOOTING";
-          case WorkspaceState::STARTING:
-            return "STARTING";
-          case WorkspaceState::REBUILDING:
-            return "REBUILDING";
-          case WorkspaceState::MAINTENANCE:
-            return "MAINTENANCE";
-          case WorkspaceState::ADMIN_MAINTENANCE:
-            return "ADMIN_MAINTENANCE";
-          case WorkspaceState::TERMINATING:
-            return "TERMINATING";
-          case WorkspaceState::TERMINATED:
-            return "TERMINATED";
-          case WorkspaceState::SUSPENDED:
-            return "SUSPENDED";
-          case WorkspaceState::UPDATING:
-            return "UPDATING";
-          case WorkspaceState::STOPPING:
-            return "STOPPING";
-          case WorkspaceState::STOPPED:
-            return "STOPPED";
-          case WorkspaceState::ERROR_:
-            return "ERROR";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForWorkspaceState(WorkspaceState enumValue)
+        {
+          return GetNameForWorkspaceStateCStr(enumValue);
         }
 
       } // namespace WorkspaceStateMapper
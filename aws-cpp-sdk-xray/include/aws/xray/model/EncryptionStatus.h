@@ -35,6 +35,11 @@ namespace EncryptionStatusMapper
 AWS_XRAY_API EncryptionStatus GetEncryptionStatusForName(const Aws::String& name);
 
 AWS_XRAY_API Aws::String GetNameForEncryptionStatus(EncryptionStatus value);
+
+/**
+ * Same as GetNameForEncryptionStatus(), without allocating a string. The name is static, unless it is one the enum overflow container holds.
+ */
+AWS_XRAY_API const char* GetNameForEncryptionStatusCStr(EncryptionStatus value);
 } // namespace EncryptionStatusMapper
 } // namespace Model
 } // namespace XRay
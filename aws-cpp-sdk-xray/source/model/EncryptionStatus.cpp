@@ -30,20 +30,37 @@ namespace Aws
       namespace EncryptionStatusMapper
       {
 
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "UPDATING",
+          "ACTIVE",
+        };
 
         EncryptionStatus GetEncryptionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UPDATING_HASH)
-          {
-            return EncryptionStatus::UPDATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EncryptionStatus::ACTIVE;
+          case 2105227078:
+            if (name == "UPDATING")
+            {
+              return EncryptionStatus::UPDATING;
+            }
+            break;
+          case 1925346054:
+            if (name == "ACTIVE")
+            {
+              return EncryptionStatus::ACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EncryptionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionStatus(EncryptionStatus enumValue)
+        const char* GetNameForEncryptionStatusCStr(EncryptionStatus enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EncryptionStatus::UPDATING:
-            return "UPDATING";
-          case EncryptionStatus::ACTIVE:
-            return "ACTIVE";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEncryptionStatus(EncryptionStatus enumValue)
+        {
+          return GetNameForEncryptionStatusCStr(enumValue);
         }
 
       } // namespace EncryptionStatusMapper
@@ -30,20 +30,37 @@ namespace Aws
       namespace EncryptionTypeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int KMS_HASH = HashingUtils::HashString("KMS");
-
+        // names of the members, indexed by their value.
+        static const char* const NAMES[] =
+        {
+          "",
+          "NONE",
+          "KMS",
+        };
 
         EncryptionType GetEncryptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
-          {
-            return EncryptionType::NONE;
-          }
-          else if (hashCode == KMS_HASH)
+          /*
+          The case labels are the hashes of the names, computed when this file was generated, which lets the compiler
+          turn the switch into a jump table or a binary search. The name is still compared, other strings having the same hash.
+          */
+          switch (hashCode)
           {
-            return EncryptionType::KMS;
+          case 2402104:
+            if (name == "NONE")
+            {
+              return EncryptionType::NONE;
+            }
+            break;
+          case 74545:
+            if (name == "KMS")
+            {
+              return EncryptionType::KMS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,23 +72,26 @@ namespace Aws
           return EncryptionType::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionType(EncryptionType enumValue)
+        const char* GetNameForEncryptionTypeCStr(EncryptionType enumValue)
         {
-          switch(enumValue)
+          size_t index = static_cast<size_t>(enumValue);
+          if (index > 0 && index < sizeof(NAMES) / sizeof(NAMES[0]))
           {
-          case EncryptionType::NONE:
-            return "NONE";
-          case EncryptionType::KMS:
-            return "KMS";
-          default:
-            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-            if(overflowContainer)
-            {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-            }
+            return NAMES[index];
+          }
 
-            return "";
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
+          {
+            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
           }
+
+          return "";
+        }
+
+        Aws::String GetNameForEncryptionType(EncryptionType enumValue)
+        {
+          return GetNameForEncryptionTypeCStr(enumValue);
         }
 
       } // namespace EncryptionTypeMapper
@@ -52,6 +52,8 @@ public class Shape {
     private boolean eventStream;
     private boolean event;
     private boolean sensitive;
+    private boolean jsonReaderDeserializable;
+    private boolean xmlReaderDeserializable;
 
     public boolean isMap() {
         return "map".equals(type.toLowerCase());
@@ -17,20 +17,45 @@ package com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.cpp;
 
 import lombok.Data;
 
+import java.nio.charset.StandardCharsets;
 import java.util.*;
 
 @Data
 public class EnumModel {
     private String name;
     private List<EnumMemberModel> members;
+    // members grouped by the hash of their value, keyed by the case label matching it, so that lookups by name can switch on it.
+    private Map<String, List<EnumMemberModel>> membersByHash;
 
     public EnumModel(String enumName, Collection<String> enumMembers) {
         name = enumName;
         members = new ArrayList<>(enumMembers.size());
+        membersByHash = new LinkedHashMap<>();
         for (String enumMember : enumMembers) {
-           members.add(new EnumMemberModel(PlatformAndKeywordSanitizer.fixEnumValue(enumMember), enumMember));
+           EnumMemberModel member = new EnumMemberModel(PlatformAndKeywordSanitizer.fixEnumValue(enumMember), enumMember);
+           members.add(member);
+           membersByHash.computeIfAbsent(toCaseLabel(hashString(enumMember)), label -> new ArrayList<>()).add(member);
         }
     }
 
+    /**
+     * Same hash as Aws::Utils::HashingUtils::HashString(), which generated code compares this to.
+     * That one hashes chars, signed or not depending on the platform, so only ASCII values hash the same everywhere.
+     */
+    public static int hashString(String value) {
+        int hash = 0;
+        for (byte b : value.getBytes(StandardCharsets.UTF_8)) {
+            if (b < 0) {
+                throw new IllegalArgumentException(String.format("Enum value %s isn't ASCII, its hash would depend on the platform.", value));
+            }
+            hash = b + 31 * hash;
+        }
+        return hash;
+    }
+
+    private static String toCaseLabel(int hash) {
+        // -2147483648 would be the negation of a literal too big for an int.
+        return hash == Integer.MIN_VALUE ? "(-2147483647 - 1)" : Integer.toString(hash);
+    }
 }
 
@@ -16,6 +16,7 @@
 package com.amazonaws.util.awsclientgenerator.generators.cpp.dynamodb;
 
 import com.amazonaws.util.awsclientgenerator.domainmodels.SdkFileEntry;
+import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.Operation;
 import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.ServiceModel;
 import com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.Shape;
 import com.amazonaws.util.awsclientgenerator.generators.cpp.JsonCppClientGenerator;
@@ -24,11 +25,14 @@ import org.apache.velocity.Template;
 import java.nio.charset.StandardCharsets;
 import java.util.Arrays;
 import java.util.HashSet;
+import java.util.List;
 import java.util.Map;
 import java.util.Set;
 
 public class DynamoDBJsonCppClientGenerator extends JsonCppClientGenerator {
 
+    private static final List<String> JSON_READER_OPERATIONS = Arrays.asList("Query", "Scan");
+
     public DynamoDBJsonCppClientGenerator() throws Exception {
         super();
     }
@@ -42,9 +46,32 @@ public class DynamoDBJsonCppClientGenerator extends JsonCppClientGenerator {
         attributeValueShape.setType("structure");
         serviceModel.getShapes().put(attributeValueShape.getName(), attributeValueShape);
 
+        // Query and Scan return the largest responses, read them in a single pass with a JsonReader rather than through a JsonValue DOM.
+        for (String operationName : JSON_READER_OPERATIONS) {
+            Operation operation = serviceModel.getOperations().get(operationName);
+            if (operation != null && operation.getResult() != null) {
+                markJsonReaderDeserializable(operation.getResult().getShape());
+            }
+        }
+
         return super.generateSourceFiles(serviceModel);
     }
 
+    private static void markJsonReaderDeserializable(Shape shape) {
+        if (shape == null || shape.isJsonReaderDeserializable()) {
+            return;
+        }
+
+        shape.setJsonReaderDeserializable(true);
+        if (shape.isStructure()) {
+            shape.getMembers().values().forEach(member -> markJsonReaderDeserializable(member.getShape()));
+        } else if (shape.isList()) {
+            markJsonReaderDeserializable(shape.getListMember().getShape());
+        } else if (shape.isMap()) {
+            markJsonReaderDeserializable(shape.getMapValue().getShape());
+        }
+    }
+
     @Override
     protected SdkFileEntry generateModelHeaderFile(ServiceModel serviceModel, Map.Entry<String, Shape> shapeEntry) throws Exception {
         switch(shapeEntry.getKey()) {
@@ -36,6 +36,7 @@ public class S3RestXmlCppClientGenerator  extends RestXmlCppClientGenerator {
     private static Set<String> opsThatNeedMd5 = new HashSet<>();
     private static Set<String> opsThatDoNotSupportVirtualAddressing = new HashSet<>();
     private static Set<String> bucketLocationConstraints = new HashSet<>();
+    private static Set<String> opsWithXmlReaderResults = new HashSet<>();
 
     static {
         opsThatNeedMd5.add("DeleteObjects");
@@ -48,6 +49,10 @@ public class S3RestXmlCppClientGenerator  extends RestXmlCppClientGenerator {
         opsThatNeedMd5.add("PutObjectLockConfiguration");
         opsThatNeedMd5.add("PutObjectRetention");
 
+        // object listings are the largest responses, read them in a single pass with an XmlReader rather than through an XmlDocument DOM.
+        opsWithXmlReaderResults.add("ListObjects");
+        opsWithXmlReaderResults.add("ListObjectsV2");
+
         opsThatDoNotSupportVirtualAddressing.add("CreateBucket");
         opsThatDoNotSupportVirtualAddressing.add("ListBuckets");
 
@@ -88,6 +93,12 @@ public class S3RestXmlCppClientGenerator  extends RestXmlCppClientGenerator {
                         opsThatNeedMd5.contains(operationEntry.getName()))
                 .forEach(operationEntry -> operationEntry.getRequest().getShape().setComputeContentMd5(true));
 
+        serviceModel.getOperations().values().stream()
+                .filter(operationEntry ->
+                        opsWithXmlReaderResults.contains(operationEntry.getName()) && operationEntry.getResult() != null
+                        && operationEntry.getResult().getShape().getPayload() == null)
+                .forEach(operationEntry -> markXmlReaderDeserializable(operationEntry.getResult().getShape()));
+
         //size and content length should ALWAYS be 64 bit integers, if they aren't set them as that now.
         serviceModel.getShapes().entrySet().stream().filter(shapeEntry -> shapeEntry.getKey().toLowerCase().equals("contentlength") || shapeEntry.getKey().toLowerCase().equals("size"))
                 .forEach(shapeEntry -> shapeEntry.getValue().setType("long"));
@@ -164,6 +175,21 @@ public class S3RestXmlCppClientGenerator  extends RestXmlCppClientGenerator {
         return super.generateSourceFiles(serviceModel);
     }
 
+    private static void markXmlReaderDeserializable(Shape shape) {
+        if (shape == null || shape.isXmlReaderDeserializable()) {
+            return;
+        }
+
+        shape.setXmlReaderDeserializable(true);
+        if (shape.isStructure()) {
+            shape.getMembers().values().forEach(member -> markXmlReaderDeserializable(member.getShape()));
+        } else if (shape.isList()) {
+            markXmlReaderDeserializable(shape.getListMember().getShape());
+        } else if (shape.isMap()) {
+            markXmlReaderDeserializable(shape.getMapValue().getShape());
+        }
+    }
+
     protected void hackGetObjectOutputResponse(ServiceModel serviceModel) {
         Shape getObjectResult  = serviceModel.getShapes().get("GetObjectResult");
         if (getObjectResult == null) return;
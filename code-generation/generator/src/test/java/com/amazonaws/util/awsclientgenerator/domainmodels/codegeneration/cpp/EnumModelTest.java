@@ -17,6 +17,8 @@ package com.amazonaws.util.awsclientgenerator.domainmodels.codegeneration.cpp;
 
 import org.junit.Test;
 
+import java.util.List;
+
 import static java.util.Arrays.asList;
 import static org.junit.Assert.assertEquals;
 
@@ -42,4 +44,31 @@ public class EnumModelTest {
         assertEquals(1, testEnum.getMembers().size());
         assertEquals("DELETE_", testEnum.getMembers().get(0).getMemberName());
     }
+
+    @Test
+    public void hashMatchesHashingUtils() {
+
+        assertEquals(0, EnumModel.hashString(""));
+        assertEquals(-2033592365, EnumModel.hashString("t1.micro"));
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void nonAsciiValue() {
+
+        EnumModel.hashString("caf\u00e9");
+    }
+
+    @Test
+    public void membersGroupedByHash() {
+
+        // "Aa" and "BB" have the same hash.
+        EnumModel testEnum = new EnumModel("TESTENUM", asList("Aa", "t1.micro", "BB"));
+
+        assertEquals(2, testEnum.getMembersByHash().size());
+        List<EnumMemberModel> colliding = testEnum.getMembersByHash().get("2112");
+        assertEquals(2, colliding.size());
+        assertEquals("Aa", colliding.get(0).getMemberStringValue());
+        assertEquals("BB", colliding.get(1).getMemberStringValue());
+        assertEquals(1, testEnum.getMembersByHash().get("-2033592365").size());
+    }
 }
@@ -15,6 +15,8 @@
 
 #include <aws/core/internal/AWSHttpResourceClient.h>
 
+#include <mutex>
+
 class MockEC2MetadataClient : public Aws::Internal::EC2MetadataClient
 {
 public:
@@ -22,27 +24,33 @@ public:
         :EC2MetadataClient()
     { }
 
+    // credentials providers call these from their background refresh thread.
     inline Aws::String GetDefaultCredentials() const override
     {
+        std::lock_guard<std::mutex> locker(m_lock);
         return m_mockedValue;
     }
 
     inline void SetMockedCredentialsValue(const Aws::String& mockValue)
     {
+        std::lock_guard<std::mutex> locker(m_lock);
         m_mockedValue = mockValue;
     }
 
     inline Aws::String GetCurrentRegion() const override
     {
+        std::lock_guard<std::mutex> locker(m_lock);
         return m_region;
     }
 
     inline void SetCurrentRegionValue(const Aws::String& mockValue)
     {
+        std::lock_guard<std::mutex> locker(m_lock);
         m_region = mockValue;
     }
 
 private:
+    mutable std::mutex m_lock;
     Aws::String m_mockedValue;
     Aws::String m_region;
 };
@@ -57,14 +65,17 @@ public:
 
     inline Aws::String GetECSCredentials() const override
     {
+        std::lock_guard<std::mutex> locker(m_lock);
         return m_mockedValue;
     }
 
     inline void SetMockedCredentialsValue(const Aws::String& mockValue)
     {
+        std::lock_guard<std::mutex> locker(m_lock);
         m_mockedValue = mockValue;
     }
 
 private:
+    mutable std::mutex m_lock;
     Aws::String m_mockedValue;
 };